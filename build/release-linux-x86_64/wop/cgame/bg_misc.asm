@@ -0,0 +1,10453 @@
+data
+export bg_itemlist
+align 4
+LABELV bg_itemlist
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+address $47
+address $47
+address $48
+address $49
+address $50
+byte 4 0
+byte 4 0
+byte 4 0
+address $51
+address $52
+byte 4 5
+byte 4 3
+byte 4 0
+address $47
+address $47
+address $53
+address $54
+address $55
+byte 4 0
+byte 4 0
+byte 4 0
+address $56
+address $57
+byte 4 100
+byte 4 3
+byte 4 0
+address $47
+address $47
+address $58
+address $59
+address $60
+byte 4 0
+byte 4 0
+byte 4 0
+address $61
+address $62
+byte 4 0
+byte 4 1
+byte 4 1
+address $47
+address $47
+address $63
+address $64
+address $65
+byte 4 0
+byte 4 0
+byte 4 0
+address $66
+address $67
+byte 4 40
+byte 4 1
+byte 4 2
+address $47
+address $47
+address $68
+address $69
+address $70
+byte 4 0
+byte 4 0
+byte 4 0
+address $71
+address $72
+byte 4 100
+byte 4 1
+byte 4 6
+address $47
+address $47
+address $73
+address $74
+address $75
+byte 4 0
+byte 4 0
+byte 4 0
+address $76
+address $77
+byte 4 10
+byte 4 1
+byte 4 7
+address $47
+address $47
+address $78
+address $79
+address $80
+byte 4 0
+byte 4 0
+byte 4 0
+address $81
+address $82
+byte 4 50
+byte 4 1
+byte 4 8
+address $47
+address $47
+address $83
+address $84
+address $85
+byte 4 0
+byte 4 0
+byte 4 0
+address $86
+address $87
+byte 4 10
+byte 4 1
+byte 4 4
+address $47
+address $47
+address $88
+address $89
+address $90
+byte 4 0
+byte 4 0
+byte 4 0
+address $91
+address $92
+byte 4 10
+byte 4 1
+byte 4 5
+address $47
+address $47
+address $93
+address $94
+address $95
+byte 4 0
+byte 4 0
+byte 4 0
+address $96
+address $97
+byte 4 10
+byte 4 1
+byte 4 3
+address $47
+address $47
+address $98
+address $99
+address $100
+byte 4 0
+byte 4 0
+byte 4 0
+address $101
+address $102
+byte 4 2
+byte 4 1
+byte 4 9
+address $47
+address $47
+address $103
+address $104
+address $105
+byte 4 0
+byte 4 0
+byte 4 0
+address $106
+address $107
+byte 4 20
+byte 4 1
+byte 4 13
+address $47
+address $47
+address $108
+address $109
+address $110
+byte 4 0
+byte 4 0
+byte 4 0
+address $111
+address $112
+byte 4 0
+byte 4 1
+byte 4 12
+address $47
+address $47
+address $113
+address $114
+address $115
+byte 4 0
+byte 4 0
+byte 4 0
+address $116
+address $117
+byte 4 15
+byte 4 2
+byte 4 3
+address $47
+address $47
+address $118
+address $114
+address $119
+byte 4 0
+byte 4 0
+byte 4 0
+address $120
+address $121
+byte 4 50
+byte 4 2
+byte 4 2
+address $47
+address $47
+address $122
+address $114
+address $123
+byte 4 0
+byte 4 0
+byte 4 0
+address $124
+address $125
+byte 4 10
+byte 4 2
+byte 4 4
+address $47
+address $47
+address $126
+address $114
+address $127
+byte 4 0
+byte 4 0
+byte 4 0
+address $128
+address $129
+byte 4 40
+byte 4 2
+byte 4 8
+address $47
+address $47
+address $130
+address $114
+address $131
+byte 4 0
+byte 4 0
+byte 4 0
+address $132
+address $133
+byte 4 60
+byte 4 2
+byte 4 6
+address $47
+address $47
+address $134
+address $114
+address $135
+byte 4 0
+byte 4 0
+byte 4 0
+address $136
+address $137
+byte 4 10
+byte 4 2
+byte 4 5
+address $47
+address $47
+address $138
+address $114
+address $139
+byte 4 0
+byte 4 0
+byte 4 0
+address $140
+address $141
+byte 4 10
+byte 4 2
+byte 4 7
+address $47
+address $47
+address $142
+address $114
+address $143
+byte 4 0
+byte 4 0
+byte 4 0
+address $144
+address $145
+byte 4 3
+byte 4 2
+byte 4 9
+address $47
+address $47
+address $146
+address $114
+address $105
+byte 4 0
+byte 4 0
+byte 4 0
+address $106
+address $147
+byte 4 10
+byte 4 2
+byte 4 13
+address $47
+address $47
+address $148
+address $149
+address $150
+byte 4 0
+byte 4 0
+byte 4 0
+address $151
+address $152
+byte 4 1
+byte 4 2
+byte 4 12
+address $47
+address $47
+address $153
+address $149
+address $154
+byte 4 0
+byte 4 0
+byte 4 0
+address $155
+address $156
+byte 4 1
+byte 4 2
+byte 4 12
+address $47
+address $47
+address $157
+address $149
+address $158
+byte 4 0
+byte 4 0
+byte 4 0
+address $159
+address $160
+byte 4 1
+byte 4 2
+byte 4 12
+address $47
+address $47
+address $161
+address $162
+address $163
+address $164
+byte 4 0
+byte 4 0
+address $165
+address $166
+byte 4 60
+byte 4 6
+byte 4 3
+address $47
+address $47
+address $167
+address $104
+address $105
+address $168
+byte 4 0
+byte 4 0
+address $106
+address $169
+byte 4 60
+byte 4 6
+byte 4 4
+address $47
+address $47
+address $170
+address $171
+address $172
+address $173
+byte 4 0
+byte 4 0
+address $174
+address $175
+byte 4 60
+byte 4 6
+byte 4 5
+address $47
+address $47
+address $176
+address $177
+address $178
+address $179
+byte 4 0
+byte 4 0
+address $180
+address $181
+byte 4 60
+byte 4 6
+byte 4 6
+address $47
+address $47
+address $182
+address $183
+address $184
+address $185
+byte 4 0
+byte 4 0
+address $186
+address $187
+byte 4 30
+byte 4 5
+byte 4 2
+address $47
+address $188
+address $189
+address $190
+address $191
+address $192
+byte 4 0
+byte 4 0
+address $193
+address $194
+byte 4 30
+byte 4 5
+byte 4 3
+address $47
+address $47
+address $195
+address $196
+address $197
+address $198
+byte 4 0
+byte 4 0
+address $199
+address $200
+byte 4 30
+byte 4 5
+byte 4 1
+address $47
+address $47
+address $201
+address $202
+address $203
+address $204
+byte 4 0
+byte 4 0
+address $205
+address $206
+byte 4 30
+byte 4 5
+byte 4 4
+address $47
+address $47
+address $207
+address $208
+address $209
+address $210
+byte 4 0
+byte 4 0
+address $211
+address $212
+byte 4 30
+byte 4 5
+byte 4 5
+address $47
+address $47
+address $213
+address $214
+address $215
+address $216
+byte 4 0
+byte 4 0
+address $217
+address $218
+byte 4 30
+byte 4 5
+byte 4 6
+address $47
+address $219
+address $220
+address $221
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+address $222
+address $223
+byte 4 30
+byte 4 5
+byte 4 7
+address $47
+address $47
+address $224
+byte 4 0
+address $225
+byte 4 0
+byte 4 0
+byte 4 0
+address $226
+address $227
+byte 4 0
+byte 4 8
+byte 4 8
+address $47
+address $47
+address $228
+byte 4 0
+address $229
+byte 4 0
+byte 4 0
+byte 4 0
+address $230
+address $231
+byte 4 0
+byte 4 8
+byte 4 9
+address $47
+address $47
+address $232
+address $233
+address $234
+byte 4 0
+byte 4 0
+byte 4 0
+address $235
+address $236
+byte 4 1
+byte 4 1
+byte 4 10
+address $47
+address $47
+address $237
+address $114
+address $238
+byte 4 0
+byte 4 0
+byte 4 0
+address $239
+address $240
+byte 4 10
+byte 4 2
+byte 4 10
+address $47
+address $47
+byte 4 0
+skip 48
+export bg_numItems
+align 4
+LABELV bg_numItems
+byte 4 41
+export BG_FindItemForPowerup
+code
+proc BG_FindItemForPowerup 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $245
+JUMPV
+LABELV $242
+ADDRLP4 4
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 bg_itemlist+36
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $253
+ADDRLP4 4
+INDIRI4
+ADDRGP4 bg_itemlist+36
+ADDP4
+INDIRI4
+CNSTI4 8
+EQI4 $253
+ADDRLP4 4
+INDIRI4
+ADDRGP4 bg_itemlist+36
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $246
+LABELV $253
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $246
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+RETP4
+ADDRGP4 $241
+JUMPV
+LABELV $246
+LABELV $243
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $245
+ADDRLP4 0
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $242
+CNSTP4 0
+RETP4
+LABELV $241
+endproc BG_FindItemForPowerup 8 0
+export BG_FindItemForHoldable
+proc BG_FindItemForHoldable 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $258
+JUMPV
+LABELV $255
+ADDRLP4 4
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 bg_itemlist+36
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $259
+ADDRLP4 4
+INDIRI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $259
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+RETP4
+ADDRGP4 $254
+JUMPV
+LABELV $259
+LABELV $256
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $258
+ADDRLP4 0
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $255
+CNSTI4 1
+ARGI4
+ADDRGP4 $263
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+CNSTP4 0
+RETP4
+LABELV $254
+endproc BG_FindItemForHoldable 8 8
+export BG_FindItemForWeapon
+proc BG_FindItemForWeapon 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 bg_itemlist+52
+ASGNP4
+ADDRGP4 $268
+JUMPV
+LABELV $265
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $270
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $270
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $264
+JUMPV
+LABELV $270
+LABELV $266
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+LABELV $268
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $265
+CNSTI4 1
+ARGI4
+ADDRGP4 $272
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_Error
+CALLV
+pop
+CNSTP4 0
+RETP4
+LABELV $264
+endproc BG_FindItemForWeapon 8 12
+export BG_FindItem
+proc BG_FindItem 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 bg_itemlist+52
+ASGNP4
+ADDRGP4 $277
+JUMPV
+LABELV $274
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $279
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $273
+JUMPV
+LABELV $279
+LABELV $275
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+LABELV $277
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $274
+CNSTP4 0
+RETP4
+LABELV $273
+endproc BG_FindItem 8 8
+export BG_PlayerTouchesItem
+proc BG_PlayerTouchesItem 36 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1110441984
+GTF4 $292
+ADDRLP4 16
+INDIRF4
+CNSTF4 3259498496
+LTF4 $292
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1108344832
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ADDRLP4 24
+INDIRF4
+GTF4 $292
+ADDRLP4 28
+CNSTF4 3255828480
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ADDRLP4 28
+INDIRF4
+LTF4 $292
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ADDRLP4 24
+INDIRF4
+GTF4 $292
+ADDRLP4 32
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ADDRLP4 28
+INDIRF4
+GEF4 $282
+LABELV $292
+CNSTI4 0
+RETI4
+ADDRGP4 $281
+JUMPV
+LABELV $282
+CNSTI4 1
+RETI4
+LABELV $281
+endproc BG_PlayerTouchesItem 36 12
+export BG_CanItemBeGrabbed
+proc BG_CanItemBeGrabbed 32 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LTI4 $296
+ADDRLP4 4
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $294
+LABELV $296
+CNSTI4 1
+ARGI4
+ADDRGP4 $297
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $294
+ADDRLP4 0
+CNSTI4 52
+ADDRFP4 4
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $299
+ADDRLP4 8
+INDIRI4
+CNSTI4 8
+GTI4 $299
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $341
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $341
+address $339
+address $301
+address $302
+address $305
+address $308
+address $316
+address $334
+address $299
+address $317
+code
+LABELV $301
+CNSTI4 1
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $302
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 376
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 200
+LTI4 $303
+CNSTI4 0
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $303
+CNSTI4 1
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $305
+ADDRLP4 16
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+LTI4 $306
+CNSTI4 0
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $306
+CNSTI4 1
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $308
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 5
+EQI4 $311
+ADDRLP4 20
+INDIRI4
+CNSTI4 100
+NEI4 $309
+LABELV $311
+ADDRLP4 24
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+LTI4 $312
+CNSTI4 0
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $312
+CNSTI4 1
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $309
+ADDRLP4 24
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+LTI4 $314
+CNSTI4 0
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $314
+CNSTI4 1
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $316
+CNSTI4 1
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $317
+ADDRFP4 0
+INDIRI4
+CNSTI4 6
+NEI4 $318
+ADDRFP4 8
+INDIRP4
+CNSTI4 252
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $320
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 9
+EQI4 $325
+ADDRLP4 28
+INDIRI4
+CNSTI4 8
+NEI4 $326
+ADDRFP4 4
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $325
+LABELV $326
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $321
+ADDRFP4 8
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $321
+LABELV $325
+CNSTI4 1
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $320
+ADDRFP4 8
+INDIRP4
+CNSTI4 252
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $327
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 8
+EQI4 $332
+ADDRLP4 28
+INDIRI4
+CNSTI4 9
+NEI4 $333
+ADDRFP4 4
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $332
+LABELV $333
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 9
+NEI4 $329
+ADDRFP4 8
+INDIRP4
+CNSTI4 344
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $329
+LABELV $332
+CNSTI4 1
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $329
+LABELV $327
+LABELV $321
+LABELV $318
+CNSTI4 0
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $334
+ADDRFP4 8
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $335
+ADDRFP4 8
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 bg_itemlist
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 52
+DIVI4
+NEI4 $337
+CNSTI4 1
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $337
+CNSTI4 0
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $335
+CNSTI4 1
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $339
+CNSTI4 1
+ARGI4
+ADDRGP4 $340
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $299
+CNSTI4 0
+RETI4
+LABELV $293
+endproc BG_CanItemBeGrabbed 32 8
+export BG_EvaluateTrajectory
+proc BG_EvaluateTrajectory 92 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $343
+ADDRLP4 8
+INDIRI4
+CNSTI4 6
+GTI4 $343
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $360
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $360
+address $346
+address $346
+address $347
+address $349
+address $348
+address $354
+address $354
+code
+LABELV $346
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $344
+JUMPV
+LABELV $347
+ADDRLP4 0
+CNSTF4 981668463
+ADDRFP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $344
+JUMPV
+LABELV $348
+ADDRLP4 0
+ADDRFP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+CNSTF4 1073741824
+CNSTF4 1078530011
+ADDRLP4 0
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $344
+JUMPV
+LABELV $349
+ADDRFP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDI4
+LEI4 $350
+ADDRFP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $350
+ADDRLP4 0
+CNSTF4 981668463
+ADDRFP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $352
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $352
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $344
+JUMPV
+LABELV $354
+ADDRFP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+GEI4 $355
+ADDRFP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $355
+ADDRLP4 0
+CNSTF4 981668463
+ADDRFP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 5
+NEI4 $357
+ADDRLP4 76
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 80
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+CNSTF4 1137180672
+ADDRLP4 80
+INDIRF4
+MULF4
+ADDRLP4 80
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRGP4 $344
+JUMPV
+LABELV $357
+ADDRLP4 84
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 88
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRF4
+CNSTF4 1128792064
+ADDRLP4 88
+INDIRF4
+MULF4
+ADDRLP4 88
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRGP4 $344
+JUMPV
+LABELV $343
+CNSTI4 1
+ARGI4
+ADDRGP4 $359
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $344
+LABELV $342
+endproc BG_EvaluateTrajectory 92 12
+export BG_EvaluateTrajectoryDelta
+proc BG_EvaluateTrajectoryDelta 48 12
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $362
+ADDRLP4 8
+INDIRI4
+CNSTI4 6
+GTI4 $362
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $377
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $377
+address $365
+address $365
+address $366
+address $368
+address $367
+address $371
+address $371
+code
+LABELV $365
+ADDRLP4 16
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRGP4 $363
+JUMPV
+LABELV $366
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $363
+JUMPV
+LABELV $367
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRLP4 24
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+CNSTF4 1073741824
+CNSTF4 1078530011
+ADDRLP4 4
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1056964608
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $363
+JUMPV
+LABELV $368
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDI4
+LEI4 $369
+ADDRLP4 36
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRGP4 $361
+JUMPV
+LABELV $369
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $363
+JUMPV
+LABELV $371
+ADDRFP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+GEI4 $372
+ADDRFP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $372
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTF4 981668463
+ADDRFP4 4
+INDIRI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 5
+NEI4 $374
+ADDRLP4 40
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRGP4 $363
+JUMPV
+LABELV $374
+ADDRLP4 44
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+CNSTF4 1137180672
+ADDRLP4 4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRGP4 $363
+JUMPV
+LABELV $362
+CNSTI4 1
+ARGI4
+ADDRGP4 $376
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $363
+LABELV $361
+endproc BG_EvaluateTrajectoryDelta 48 12
+data
+export eventnames
+align 4
+LABELV eventnames
+address $378
+address $379
+address $380
+address $381
+address $382
+address $383
+address $384
+address $385
+address $386
+address $387
+address $388
+address $389
+address $390
+address $391
+address $392
+address $393
+address $394
+address $395
+address $396
+address $397
+address $398
+address $399
+address $400
+address $401
+address $402
+address $403
+address $404
+address $405
+address $406
+address $407
+address $408
+address $409
+address $410
+address $411
+address $412
+address $413
+address $414
+address $415
+address $416
+address $417
+address $418
+address $419
+address $420
+address $421
+address $422
+address $423
+address $424
+address $425
+address $426
+address $427
+address $428
+address $429
+address $430
+address $431
+address $432
+address $433
+address $434
+address $435
+address $436
+address $437
+address $438
+address $439
+address $440
+address $441
+address $442
+address $443
+address $444
+address $445
+address $446
+address $447
+address $448
+address $449
+address $450
+address $451
+address $452
+address $453
+address $454
+address $455
+address $456
+address $457
+address $458
+address $459
+address $460
+address $461
+address $462
+address $463
+address $464
+address $465
+address $466
+export BG_AddPredictableEventToPlayerstate
+code
+proc BG_AddPredictableEventToPlayerstate 12 0
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 8
+INDIRP4
+CNSTI4 108
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $467
+endproc BG_AddPredictableEventToPlayerstate 12 0
+export BG_TouchJumpPad
+proc BG_TouchJumpPad 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $469
+ADDRGP4 $468
+JUMPV
+LABELV $469
+ADDRFP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+EQI4 $471
+ADDRFP4 4
+INDIRP4
+CNSTI4 104
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 AngleNormalize180
+CALLF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 1110704128
+GEF4 $473
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $474
+JUMPV
+LABELV $473
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+LABELV $474
+CNSTI4 13
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BG_AddPredictableEventToPlayerstate
+CALLV
+pop
+LABELV $471
+ADDRFP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 456
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $468
+endproc BG_TouchJumpPad 28 12
+export BG_PlayerStateToEntityState
+proc BG_PlayerStateToEntityState 40 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+EQI4 $478
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $476
+LABELV $478
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 10
+ASGNI4
+ADDRGP4 $477
+JUMPV
+LABELV $476
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 -200
+GTI4 $479
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 10
+ASGNI4
+ADDRGP4 $480
+JUMPV
+LABELV $479
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $480
+LABELV $477
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $481
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+LABELV $481
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $483
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+LABELV $483
+ADDRFP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 168
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 65535
+BANDI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CNSTI4 16
+LSHI4
+BORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $485
+ADDRLP4 16
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRGP4 $486
+JUMPV
+LABELV $485
+ADDRLP4 16
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+LABELV $486
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $487
+ADDRFP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $488
+JUMPV
+LABELV $487
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+GEI4 $489
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 2
+SUBI4
+GEI4 $491
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+LABELV $491
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 8
+LSHI4
+BORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $489
+LABELV $488
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $493
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $497
+ADDRLP4 20
+ADDRFP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BORI4
+ASGNI4
+LABELV $497
+LABELV $494
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $493
+ADDRFP4 4
+INDIRP4
+CNSTI4 156
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 204
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $475
+endproc BG_PlayerStateToEntityState 40 0
+export BG_PlayerStateToEntityStateExtraPolate
+proc BG_PlayerStateToEntityStateExtraPolate 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+EQI4 $502
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $500
+LABELV $502
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 10
+ASGNI4
+ADDRGP4 $501
+JUMPV
+LABELV $500
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 -200
+GTI4 $503
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 10
+ASGNI4
+ADDRGP4 $504
+JUMPV
+LABELV $503
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $504
+LABELV $501
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $505
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+LABELV $505
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 50
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $507
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+LABELV $507
+ADDRFP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 168
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $509
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRGP4 $510
+JUMPV
+LABELV $509
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+LABELV $510
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $511
+ADDRFP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $512
+JUMPV
+LABELV $511
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+GEI4 $513
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 2
+SUBI4
+GEI4 $515
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+LABELV $515
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 8
+LSHI4
+BORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $513
+LABELV $512
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $517
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $521
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BORI4
+ASGNI4
+LABELV $521
+LABELV $518
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $517
+ADDRFP4 4
+INDIRP4
+CNSTI4 156
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 204
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $499
+endproc BG_PlayerStateToEntityStateExtraPolate 32 0
+export convertGTStringToGTNumber
+proc convertGTStringToGTNumber 604 12
+ADDRLP4 512
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $526
+ARGP4
+ADDRLP4 516
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 516
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $529
+ADDRLP4 0
+ARGP4
+ADDRGP4 $527
+ARGP4
+ADDRLP4 520
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 520
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $524
+ADDRLP4 0
+ARGP4
+ADDRGP4 $528
+ARGP4
+ADDRLP4 524
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 524
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $524
+LABELV $529
+ADDRLP4 0
+ARGP4
+ADDRGP4 $532
+ARGP4
+ADDRLP4 528
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 528
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $534
+ADDRLP4 0
+ARGP4
+ADDRGP4 $533
+ARGP4
+ADDRLP4 532
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 532
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $530
+LABELV $534
+ADDRLP4 512
+CNSTI4 7
+ASGNI4
+ADDRGP4 $525
+JUMPV
+LABELV $530
+ADDRLP4 512
+CNSTI4 3
+ASGNI4
+ADDRGP4 $525
+JUMPV
+LABELV $524
+ADDRLP4 0
+ARGP4
+ADDRGP4 $537
+ARGP4
+ADDRLP4 528
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 528
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $539
+ADDRLP4 0
+ARGP4
+ADDRGP4 $538
+ARGP4
+ADDRLP4 532
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 532
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $535
+LABELV $539
+ADDRLP4 512
+CNSTI4 8
+ASGNI4
+ADDRGP4 $536
+JUMPV
+LABELV $535
+ADDRLP4 0
+ARGP4
+ADDRGP4 $542
+ARGP4
+ADDRLP4 536
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 536
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $545
+ADDRLP4 0
+ARGP4
+ADDRGP4 $543
+ARGP4
+ADDRLP4 540
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 540
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $540
+ADDRLP4 0
+ARGP4
+ADDRGP4 $544
+ARGP4
+ADDRLP4 544
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 544
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $540
+LABELV $545
+ADDRLP4 512
+CNSTI4 4
+ASGNI4
+ADDRGP4 $541
+JUMPV
+LABELV $540
+ADDRLP4 0
+ARGP4
+ADDRGP4 $548
+ARGP4
+ADDRLP4 548
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 548
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $553
+ADDRLP4 0
+ARGP4
+ADDRGP4 $549
+ARGP4
+ADDRLP4 552
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 552
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $546
+ADDRLP4 0
+ARGP4
+ADDRGP4 $550
+ARGP4
+ADDRLP4 556
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 556
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $553
+ADDRLP4 0
+ARGP4
+ADDRGP4 $551
+ARGP4
+ADDRLP4 560
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 560
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $546
+LABELV $553
+ADDRLP4 512
+CNSTI4 6
+ASGNI4
+ADDRGP4 $547
+JUMPV
+LABELV $546
+ADDRLP4 0
+ARGP4
+ADDRGP4 $556
+ARGP4
+ADDRLP4 564
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 564
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $560
+ADDRLP4 0
+ARGP4
+ADDRGP4 $557
+ARGP4
+ADDRLP4 568
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 568
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $560
+ADDRLP4 0
+ARGP4
+ADDRGP4 $558
+ARGP4
+ADDRLP4 572
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 572
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $554
+LABELV $560
+ADDRLP4 512
+CNSTI4 1
+ASGNI4
+ADDRGP4 $555
+JUMPV
+LABELV $554
+ADDRLP4 0
+ARGP4
+ADDRGP4 $563
+ARGP4
+ADDRLP4 576
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 576
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $567
+ADDRLP4 0
+ARGP4
+ADDRGP4 $532
+ARGP4
+ADDRLP4 580
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 580
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $567
+ADDRLP4 0
+ARGP4
+ADDRGP4 $533
+ARGP4
+ADDRLP4 584
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 584
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $567
+ADDRLP4 0
+ARGP4
+ADDRGP4 $564
+ARGP4
+ADDRLP4 588
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 588
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $561
+LABELV $567
+ADDRLP4 512
+CNSTI4 5
+ASGNI4
+ADDRGP4 $562
+JUMPV
+LABELV $561
+ADDRLP4 0
+ARGP4
+ADDRGP4 $570
+ARGP4
+ADDRLP4 592
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 592
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $574
+ADDRLP4 0
+ARGP4
+ADDRGP4 $571
+ARGP4
+ADDRLP4 596
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 596
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $574
+ADDRLP4 0
+ARGP4
+ADDRGP4 $572
+ARGP4
+ADDRLP4 600
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 600
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $568
+LABELV $574
+ADDRLP4 512
+CNSTI4 0
+ASGNI4
+LABELV $568
+LABELV $562
+LABELV $555
+LABELV $547
+LABELV $541
+LABELV $536
+LABELV $525
+ADDRLP4 512
+INDIRI4
+RETI4
+LABELV $523
+endproc convertGTStringToGTNumber 604 12
+import trap_Cvar_VariableStringBuffer
+import Pmove
+import PM_UpdateViewAngles
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $572
+byte 1 68
+byte 1 77
+byte 1 0
+align 1
+LABELV $571
+byte 1 70
+byte 1 82
+byte 1 69
+byte 1 69
+byte 1 0
+align 1
+LABELV $570
+byte 1 70
+byte 1 70
+byte 1 65
+byte 1 0
+align 1
+LABELV $564
+byte 1 84
+byte 1 68
+byte 1 77
+byte 1 0
+align 1
+LABELV $563
+byte 1 84
+byte 1 70
+byte 1 70
+byte 1 65
+byte 1 0
+align 1
+LABELV $558
+byte 1 84
+byte 1 79
+byte 1 85
+byte 1 82
+byte 1 78
+byte 1 69
+byte 1 89
+byte 1 0
+align 1
+LABELV $557
+byte 1 84
+byte 1 79
+byte 1 85
+byte 1 82
+byte 1 78
+byte 1 65
+byte 1 77
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 0
+align 1
+LABELV $556
+byte 1 49
+byte 1 86
+byte 1 83
+byte 1 49
+byte 1 0
+align 1
+LABELV $551
+byte 1 76
+byte 1 79
+byte 1 76
+byte 1 76
+byte 1 73
+byte 1 0
+align 1
+LABELV $550
+byte 1 76
+byte 1 79
+byte 1 76
+byte 1 76
+byte 1 89
+byte 1 0
+align 1
+LABELV $549
+byte 1 67
+byte 1 65
+byte 1 80
+byte 1 84
+byte 1 85
+byte 1 82
+byte 1 69
+byte 1 0
+align 1
+LABELV $548
+byte 1 67
+byte 1 84
+byte 1 76
+byte 1 0
+align 1
+LABELV $544
+byte 1 83
+byte 1 84
+byte 1 65
+byte 1 78
+byte 1 68
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 0
+align 1
+LABELV $543
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 84
+byte 1 0
+align 1
+LABELV $542
+byte 1 76
+byte 1 80
+byte 1 83
+byte 1 0
+align 1
+LABELV $538
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 79
+byte 1 79
+byte 1 78
+byte 1 0
+align 1
+LABELV $537
+byte 1 66
+byte 1 66
+byte 1 0
+align 1
+LABELV $533
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 0
+align 1
+LABELV $532
+byte 1 84
+byte 1 80
+byte 1 0
+align 1
+LABELV $528
+byte 1 67
+byte 1 79
+byte 1 76
+byte 1 79
+byte 1 82
+byte 1 0
+align 1
+LABELV $527
+byte 1 83
+byte 1 80
+byte 1 82
+byte 1 65
+byte 1 89
+byte 1 0
+align 1
+LABELV $526
+byte 1 83
+byte 1 89
+byte 1 67
+byte 1 0
+align 1
+LABELV $466
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 95
+byte 1 80
+byte 1 65
+byte 1 84
+byte 1 82
+byte 1 79
+byte 1 76
+byte 1 0
+align 1
+LABELV $465
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 95
+byte 1 71
+byte 1 85
+byte 1 65
+byte 1 82
+byte 1 68
+byte 1 66
+byte 1 65
+byte 1 83
+byte 1 69
+byte 1 0
+align 1
+LABELV $464
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 95
+byte 1 71
+byte 1 69
+byte 1 84
+byte 1 70
+byte 1 76
+byte 1 65
+byte 1 71
+byte 1 0
+align 1
+LABELV $463
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 76
+byte 1 76
+byte 1 79
+byte 1 87
+byte 1 77
+byte 1 69
+byte 1 0
+align 1
+LABELV $462
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 95
+byte 1 78
+byte 1 79
+byte 1 0
+align 1
+LABELV $461
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 95
+byte 1 89
+byte 1 69
+byte 1 83
+byte 1 0
+align 1
+LABELV $460
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 66
+byte 1 79
+byte 1 79
+byte 1 77
+byte 1 73
+byte 1 69
+byte 1 83
+byte 1 95
+byte 1 69
+byte 1 88
+byte 1 80
+byte 1 76
+byte 1 79
+byte 1 83
+byte 1 73
+byte 1 79
+byte 1 78
+byte 1 0
+align 1
+LABELV $459
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 66
+byte 1 65
+byte 1 77
+byte 1 66
+byte 1 65
+byte 1 77
+byte 1 95
+byte 1 69
+byte 1 88
+byte 1 80
+byte 1 76
+byte 1 79
+byte 1 83
+byte 1 73
+byte 1 79
+byte 1 78
+byte 1 0
+align 1
+LABELV $458
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 83
+byte 1 78
+byte 1 79
+byte 1 87
+byte 1 0
+align 1
+LABELV $457
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 87
+byte 1 79
+byte 1 79
+byte 1 68
+byte 1 0
+align 1
+LABELV $456
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 70
+byte 1 84
+byte 1 0
+align 1
+LABELV $455
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 83
+byte 1 65
+byte 1 78
+byte 1 68
+byte 1 0
+align 1
+LABELV $454
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 76
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 73
+byte 1 67
+byte 1 69
+byte 1 0
+align 1
+LABELV $453
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 67
+byte 1 65
+byte 1 82
+byte 1 80
+byte 1 69
+byte 1 84
+byte 1 0
+align 1
+LABELV $452
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 72
+byte 1 69
+byte 1 72
+byte 1 69
+byte 1 50
+byte 1 0
+align 1
+LABELV $451
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 72
+byte 1 69
+byte 1 72
+byte 1 69
+byte 1 49
+byte 1 0
+align 1
+LABELV $450
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 0
+align 1
+LABELV $449
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 79
+byte 1 80
+byte 1 76
+byte 1 79
+byte 1 79
+byte 1 80
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 0
+align 1
+LABELV $448
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 68
+byte 1 69
+byte 1 66
+byte 1 85
+byte 1 71
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 0
+align 1
+LABELV $447
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 67
+byte 1 79
+byte 1 82
+byte 1 69
+byte 1 80
+byte 1 76
+byte 1 85
+byte 1 77
+byte 1 0
+align 1
+LABELV $446
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 73
+byte 1 66
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $445
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 87
+byte 1 69
+byte 1 82
+byte 1 85
+byte 1 80
+byte 1 95
+byte 1 80
+byte 1 65
+byte 1 68
+byte 1 80
+byte 1 79
+byte 1 87
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $444
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 87
+byte 1 69
+byte 1 82
+byte 1 85
+byte 1 80
+byte 1 95
+byte 1 82
+byte 1 69
+byte 1 86
+byte 1 73
+byte 1 86
+byte 1 65
+byte 1 76
+byte 1 0
+align 1
+LABELV $443
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 79
+byte 1 66
+byte 1 73
+byte 1 84
+byte 1 85
+byte 1 65
+byte 1 82
+byte 1 89
+byte 1 0
+align 1
+LABELV $442
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 68
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 72
+byte 1 51
+byte 1 0
+align 1
+LABELV $441
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 68
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 72
+byte 1 50
+byte 1 0
+align 1
+LABELV $440
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 68
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 72
+byte 1 49
+byte 1 0
+align 1
+LABELV $439
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 65
+byte 1 73
+byte 1 78
+byte 1 0
+align 1
+LABELV $438
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 80
+byte 1 82
+byte 1 65
+byte 1 89
+byte 1 76
+byte 1 79
+byte 1 71
+byte 1 79
+byte 1 0
+align 1
+LABELV $437
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 72
+byte 1 79
+byte 1 84
+byte 1 71
+byte 1 85
+byte 1 78
+byte 1 0
+align 1
+LABELV $436
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 82
+byte 1 65
+byte 1 73
+byte 1 76
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 73
+byte 1 76
+byte 1 0
+align 1
+LABELV $435
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 84
+byte 1 65
+byte 1 76
+byte 1 0
+align 1
+LABELV $434
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 0
+align 1
+LABELV $433
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 95
+byte 1 72
+byte 1 73
+byte 1 84
+byte 1 0
+align 1
+LABELV $432
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 0
+align 1
+LABELV $431
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 0
+align 1
+LABELV $430
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 69
+byte 1 82
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 0
+align 1
+LABELV $429
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 89
+byte 1 95
+byte 1 66
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 67
+byte 1 69
+byte 1 0
+align 1
+LABELV $428
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 82
+byte 1 69
+byte 1 78
+byte 1 65
+byte 1 68
+byte 1 69
+byte 1 95
+byte 1 66
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 67
+byte 1 69
+byte 1 0
+align 1
+LABELV $427
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 68
+byte 1 82
+byte 1 79
+byte 1 80
+byte 1 95
+byte 1 67
+byte 1 65
+byte 1 82
+byte 1 84
+byte 1 82
+byte 1 73
+byte 1 68
+byte 1 71
+byte 1 69
+byte 1 0
+align 1
+LABELV $426
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 95
+byte 1 66
+byte 1 76
+byte 1 85
+byte 1 69
+byte 1 95
+byte 1 79
+byte 1 85
+byte 1 84
+byte 1 0
+align 1
+LABELV $425
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 95
+byte 1 66
+byte 1 76
+byte 1 85
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 78
+byte 1 0
+align 1
+LABELV $424
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 95
+byte 1 82
+byte 1 69
+byte 1 68
+byte 1 95
+byte 1 79
+byte 1 85
+byte 1 84
+byte 1 0
+align 1
+LABELV $423
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 95
+byte 1 82
+byte 1 69
+byte 1 68
+byte 1 95
+byte 1 73
+byte 1 78
+byte 1 0
+align 1
+LABELV $422
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 95
+byte 1 79
+byte 1 85
+byte 1 84
+byte 1 0
+align 1
+LABELV $421
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 95
+byte 1 73
+byte 1 78
+byte 1 0
+align 1
+LABELV $420
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 80
+byte 1 0
+align 1
+LABELV $419
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 82
+byte 1 69
+byte 1 83
+byte 1 80
+byte 1 65
+byte 1 87
+byte 1 78
+byte 1 0
+align 1
+LABELV $418
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 53
+byte 1 0
+align 1
+LABELV $417
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 52
+byte 1 0
+align 1
+LABELV $416
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 51
+byte 1 0
+align 1
+LABELV $415
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 50
+byte 1 0
+align 1
+LABELV $414
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 49
+byte 1 0
+align 1
+LABELV $413
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $412
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 57
+byte 1 0
+align 1
+LABELV $411
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 56
+byte 1 0
+align 1
+LABELV $410
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 55
+byte 1 0
+align 1
+LABELV $409
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 54
+byte 1 0
+align 1
+LABELV $408
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 53
+byte 1 0
+align 1
+LABELV $407
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 52
+byte 1 0
+align 1
+LABELV $406
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 51
+byte 1 0
+align 1
+LABELV $405
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 50
+byte 1 0
+align 1
+LABELV $404
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 0
+align 1
+LABELV $403
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 48
+byte 1 0
+align 1
+LABELV $402
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 77
+byte 1 80
+byte 1 69
+byte 1 82
+byte 1 73
+byte 1 85
+byte 1 83
+byte 1 95
+byte 1 69
+byte 1 88
+byte 1 80
+byte 1 76
+byte 1 79
+byte 1 68
+byte 1 69
+byte 1 0
+align 1
+LABELV $401
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 73
+byte 1 82
+byte 1 69
+byte 1 95
+byte 1 87
+byte 1 69
+byte 1 65
+byte 1 80
+byte 1 79
+byte 1 78
+byte 1 0
+align 1
+LABELV $400
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 78
+byte 1 71
+byte 1 69
+byte 1 95
+byte 1 87
+byte 1 69
+byte 1 65
+byte 1 80
+byte 1 79
+byte 1 78
+byte 1 0
+align 1
+LABELV $399
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 78
+byte 1 79
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 0
+align 1
+LABELV $398
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 80
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 85
+byte 1 80
+byte 1 0
+align 1
+LABELV $397
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 80
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 85
+byte 1 80
+byte 1 0
+align 1
+LABELV $396
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 67
+byte 1 76
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 0
+align 1
+LABELV $395
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $394
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 76
+byte 1 69
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 0
+align 1
+LABELV $393
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 79
+byte 1 85
+byte 1 67
+byte 1 72
+byte 1 0
+align 1
+LABELV $392
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 74
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 0
+align 1
+LABELV $391
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 74
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 95
+byte 1 80
+byte 1 65
+byte 1 68
+byte 1 0
+align 1
+LABELV $390
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 82
+byte 1 0
+align 1
+LABELV $389
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 68
+byte 1 73
+byte 1 85
+byte 1 77
+byte 1 0
+align 1
+LABELV $388
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 72
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 0
+align 1
+LABELV $387
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 49
+byte 1 54
+byte 1 0
+align 1
+LABELV $386
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 49
+byte 1 50
+byte 1 0
+align 1
+LABELV $385
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 56
+byte 1 0
+align 1
+LABELV $384
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 52
+byte 1 0
+align 1
+LABELV $383
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 87
+byte 1 73
+byte 1 77
+byte 1 0
+align 1
+LABELV $382
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 87
+byte 1 65
+byte 1 68
+byte 1 69
+byte 1 0
+align 1
+LABELV $381
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 0
+align 1
+LABELV $380
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 84
+byte 1 65
+byte 1 76
+byte 1 0
+align 1
+LABELV $379
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 0
+align 1
+LABELV $378
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 78
+byte 1 79
+byte 1 78
+byte 1 69
+byte 1 0
+align 1
+LABELV $376
+byte 1 66
+byte 1 71
+byte 1 95
+byte 1 69
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 68
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 97
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $359
+byte 1 66
+byte 1 71
+byte 1 95
+byte 1 69
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $340
+byte 1 66
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 66
+byte 1 101
+byte 1 71
+byte 1 114
+byte 1 97
+byte 1 98
+byte 1 98
+byte 1 101
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 73
+byte 1 84
+byte 1 95
+byte 1 66
+byte 1 65
+byte 1 68
+byte 1 0
+align 1
+LABELV $297
+byte 1 66
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 66
+byte 1 101
+byte 1 71
+byte 1 114
+byte 1 97
+byte 1 98
+byte 1 98
+byte 1 101
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 120
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $272
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $263
+byte 1 72
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $240
+byte 1 75
+byte 1 77
+byte 1 65
+byte 1 57
+byte 1 55
+byte 1 32
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 0
+align 1
+LABELV $239
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 95
+byte 1 107
+byte 1 109
+byte 1 97
+byte 1 57
+byte 1 55
+byte 1 0
+align 1
+LABELV $238
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 107
+byte 1 109
+byte 1 97
+byte 1 57
+byte 1 55
+byte 1 95
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $237
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 107
+byte 1 109
+byte 1 97
+byte 1 57
+byte 1 55
+byte 1 0
+align 1
+LABELV $236
+byte 1 75
+byte 1 77
+byte 1 65
+byte 1 57
+byte 1 55
+byte 1 0
+align 1
+LABELV $235
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 107
+byte 1 109
+byte 1 97
+byte 1 57
+byte 1 55
+byte 1 0
+align 1
+LABELV $234
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 107
+byte 1 109
+byte 1 97
+byte 1 57
+byte 1 55
+byte 1 47
+byte 1 107
+byte 1 109
+byte 1 97
+byte 1 57
+byte 1 55
+byte 1 0
+align 1
+LABELV $233
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 109
+byte 1 97
+byte 1 57
+byte 1 55
+byte 1 0
+align 1
+LABELV $232
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 107
+byte 1 109
+byte 1 97
+byte 1 57
+byte 1 55
+byte 1 0
+align 1
+LABELV $231
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 76
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $230
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 49
+byte 1 0
+align 1
+LABELV $229
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 116
+byte 1 108
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $228
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 76
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $227
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 76
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $226
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 49
+byte 1 0
+align 1
+LABELV $225
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 116
+byte 1 108
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $224
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 76
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 108
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $223
+byte 1 80
+byte 1 85
+byte 1 80
+byte 1 80
+byte 1 69
+byte 1 84
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $222
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $221
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 121
+byte 1 47
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $220
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $219
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 98
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $218
+byte 1 82
+byte 1 69
+byte 1 86
+byte 1 105
+byte 1 86
+byte 1 65
+byte 1 76
+byte 1 0
+align 1
+LABELV $217
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $216
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $215
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $214
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $213
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $212
+byte 1 86
+byte 1 105
+byte 1 83
+byte 1 105
+byte 1 79
+byte 1 78
+byte 1 76
+byte 1 69
+byte 1 83
+byte 1 83
+byte 1 0
+align 1
+LABELV $211
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $210
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 95
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $209
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $208
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $207
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $206
+byte 1 74
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $205
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $204
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $203
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $202
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $201
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $200
+byte 1 83
+byte 1 80
+byte 1 69
+byte 1 69
+byte 1 68
+byte 1 89
+byte 1 0
+align 1
+LABELV $199
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 121
+byte 1 0
+align 1
+LABELV $198
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 121
+byte 1 95
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $197
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 121
+byte 1 0
+align 1
+LABELV $196
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 121
+byte 1 0
+align 1
+LABELV $195
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 121
+byte 1 0
+align 1
+LABELV $194
+byte 1 67
+byte 1 76
+byte 1 105
+byte 1 77
+byte 1 66
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $193
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $192
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $191
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $190
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $189
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $188
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 51
+byte 1 0
+align 1
+LABELV $187
+byte 1 80
+byte 1 65
+byte 1 68
+byte 1 80
+byte 1 79
+byte 1 87
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $186
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $185
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $184
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $183
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $182
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $181
+byte 1 66
+byte 1 79
+byte 1 79
+byte 1 77
+byte 1 105
+byte 1 69
+byte 1 83
+byte 1 0
+align 1
+LABELV $180
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $179
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $178
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $177
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $176
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $175
+byte 1 66
+byte 1 65
+byte 1 77
+byte 1 66
+byte 1 65
+byte 1 77
+byte 1 0
+align 1
+LABELV $174
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $173
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $172
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $171
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $170
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $169
+byte 1 75
+byte 1 105
+byte 1 76
+byte 1 76
+byte 1 69
+byte 1 82
+byte 1 68
+byte 1 85
+byte 1 67
+byte 1 75
+byte 1 83
+byte 1 0
+align 1
+LABELV $168
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 100
+byte 1 117
+byte 1 99
+byte 1 107
+byte 1 115
+byte 1 95
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $167
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 100
+byte 1 117
+byte 1 99
+byte 1 107
+byte 1 115
+byte 1 0
+align 1
+LABELV $166
+byte 1 70
+byte 1 76
+byte 1 79
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $165
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $164
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $163
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $162
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $161
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $160
+byte 1 110
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 67
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $159
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $158
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 112
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 108
+byte 1 47
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $157
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 95
+byte 1 110
+byte 1 0
+align 1
+LABELV $156
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 67
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $155
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $154
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 112
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 108
+byte 1 47
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $153
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 95
+byte 1 98
+byte 1 0
+align 1
+LABELV $152
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 67
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $151
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $150
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 112
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 108
+byte 1 47
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $149
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 112
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 108
+byte 1 47
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $148
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 95
+byte 1 114
+byte 1 0
+align 1
+LABELV $147
+byte 1 75
+byte 1 105
+byte 1 76
+byte 1 76
+byte 1 69
+byte 1 82
+byte 1 68
+byte 1 85
+byte 1 67
+byte 1 75
+byte 1 83
+byte 1 32
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 0
+align 1
+LABELV $146
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 100
+byte 1 117
+byte 1 99
+byte 1 107
+byte 1 115
+byte 1 0
+align 1
+LABELV $145
+byte 1 73
+byte 1 77
+byte 1 80
+byte 1 69
+byte 1 82
+byte 1 105
+byte 1 85
+byte 1 83
+byte 1 32
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 0
+align 1
+LABELV $144
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $143
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 117
+byte 1 115
+byte 1 95
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $142
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $141
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 0
+align 1
+LABELV $140
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $139
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $138
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $137
+byte 1 66
+byte 1 69
+byte 1 84
+byte 1 84
+byte 1 89
+byte 1 32
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 0
+align 1
+LABELV $136
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 95
+byte 1 98
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $135
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 98
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 121
+byte 1 95
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $134
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 98
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $133
+byte 1 66
+byte 1 79
+byte 1 65
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 0
+align 1
+LABELV $132
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $131
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $130
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $129
+byte 1 66
+byte 1 85
+byte 1 66
+byte 1 66
+byte 1 76
+byte 1 69
+byte 1 46
+byte 1 71
+byte 1 46
+byte 1 32
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 0
+align 1
+LABELV $128
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 98
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 0
+align 1
+LABELV $127
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 98
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $126
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 98
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 0
+align 1
+LABELV $125
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 79
+byte 1 79
+byte 1 78
+byte 1 89
+byte 1 32
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 0
+align 1
+LABELV $124
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 121
+byte 1 0
+align 1
+LABELV $123
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 121
+byte 1 95
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $122
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 121
+byte 1 0
+align 1
+LABELV $121
+byte 1 78
+byte 1 105
+byte 1 80
+byte 1 80
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 0
+align 1
+LABELV $120
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 95
+byte 1 110
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $119
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 110
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $118
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 110
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $117
+byte 1 80
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 0
+align 1
+LABELV $116
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $115
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 112
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $114
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $113
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $112
+byte 1 83
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 80
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $111
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 112
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 108
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $110
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 112
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 108
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 112
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $109
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $108
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 112
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $107
+byte 1 75
+byte 1 105
+byte 1 76
+byte 1 76
+byte 1 69
+byte 1 82
+byte 1 68
+byte 1 85
+byte 1 67
+byte 1 75
+byte 1 83
+byte 1 32
+byte 1 87
+byte 1 69
+byte 1 65
+byte 1 80
+byte 1 79
+byte 1 78
+byte 1 0
+align 1
+LABELV $106
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 100
+byte 1 117
+byte 1 99
+byte 1 107
+byte 1 115
+byte 1 0
+align 1
+LABELV $105
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 100
+byte 1 117
+byte 1 99
+byte 1 107
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 100
+byte 1 117
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 0
+align 1
+LABELV $104
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 100
+byte 1 117
+byte 1 99
+byte 1 107
+byte 1 115
+byte 1 0
+align 1
+LABELV $103
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 100
+byte 1 117
+byte 1 99
+byte 1 107
+byte 1 115
+byte 1 0
+align 1
+LABELV $102
+byte 1 73
+byte 1 77
+byte 1 80
+byte 1 69
+byte 1 82
+byte 1 105
+byte 1 85
+byte 1 83
+byte 1 0
+align 1
+LABELV $101
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 117
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $99
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $98
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $97
+byte 1 80
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $96
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 112
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 112
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $94
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $93
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $92
+byte 1 66
+byte 1 69
+byte 1 84
+byte 1 84
+byte 1 89
+byte 1 0
+align 1
+LABELV $91
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 98
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $90
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 98
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 121
+byte 1 47
+byte 1 98
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $89
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $88
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 98
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $87
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 79
+byte 1 79
+byte 1 78
+byte 1 89
+byte 1 0
+align 1
+LABELV $86
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 121
+byte 1 0
+align 1
+LABELV $85
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 121
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 121
+byte 1 0
+align 1
+LABELV $84
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 121
+byte 1 0
+align 1
+LABELV $83
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 121
+byte 1 0
+align 1
+LABELV $82
+byte 1 66
+byte 1 85
+byte 1 66
+byte 1 66
+byte 1 76
+byte 1 69
+byte 1 46
+byte 1 71
+byte 1 46
+byte 1 0
+align 1
+LABELV $81
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 98
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 0
+align 1
+LABELV $80
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 98
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 98
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 0
+align 1
+LABELV $79
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 98
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 0
+align 1
+LABELV $78
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 98
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 0
+align 1
+LABELV $77
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $76
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $75
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $74
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $73
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $72
+byte 1 66
+byte 1 79
+byte 1 65
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $71
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $70
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $69
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $68
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $67
+byte 1 78
+byte 1 105
+byte 1 80
+byte 1 80
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $66
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 110
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $65
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 110
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 110
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $64
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $63
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 110
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $62
+byte 1 80
+byte 1 85
+byte 1 78
+byte 1 67
+byte 1 72
+byte 1 89
+byte 1 0
+align 1
+LABELV $61
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 121
+byte 1 0
+align 1
+LABELV $60
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 112
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 121
+byte 1 47
+byte 1 112
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 121
+byte 1 0
+align 1
+LABELV $59
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 121
+byte 1 0
+align 1
+LABELV $58
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 121
+byte 1 0
+align 1
+LABELV $57
+byte 1 80
+byte 1 65
+byte 1 68
+byte 1 32
+byte 1 83
+byte 1 72
+byte 1 105
+byte 1 69
+byte 1 76
+byte 1 68
+byte 1 0
+align 1
+LABELV $56
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 108
+byte 1 100
+byte 1 0
+align 1
+LABELV $55
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 47
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 101
+byte 1 108
+byte 1 100
+byte 1 0
+align 1
+LABELV $54
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 101
+byte 1 108
+byte 1 100
+byte 1 0
+align 1
+LABELV $53
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 101
+byte 1 108
+byte 1 100
+byte 1 0
+align 1
+LABELV $52
+byte 1 80
+byte 1 65
+byte 1 68
+byte 1 32
+byte 1 83
+byte 1 72
+byte 1 65
+byte 1 82
+byte 1 68
+byte 1 0
+align 1
+LABELV $51
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $50
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 47
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $49
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 47
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 95
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $48
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $47
+byte 1 0
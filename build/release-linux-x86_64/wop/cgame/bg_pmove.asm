@@ -0,0 +1,9098 @@
+data
+export pm_stopspeed
+align 4
+LABELV pm_stopspeed
+byte 4 1120403456
+export pm_duckScale
+align 4
+LABELV pm_duckScale
+byte 4 1048576000
+export pm_swimScale
+align 4
+LABELV pm_swimScale
+byte 4 1056964608
+export pm_accelerate
+align 4
+LABELV pm_accelerate
+byte 4 1092616192
+export pm_airaccelerate
+align 4
+LABELV pm_airaccelerate
+byte 4 1065353216
+export pm_wateraccelerate
+align 4
+LABELV pm_wateraccelerate
+byte 4 1082130432
+export pm_flyaccelerate
+align 4
+LABELV pm_flyaccelerate
+byte 4 1090519040
+export pm_friction
+align 4
+LABELV pm_friction
+byte 4 1086324736
+export pm_waterfriction
+align 4
+LABELV pm_waterfriction
+byte 4 1065353216
+export pm_flightfriction
+align 4
+LABELV pm_flightfriction
+byte 4 1077936128
+export pm_spectatorfriction
+align 4
+LABELV pm_spectatorfriction
+byte 4 1084227584
+export c_pmove
+align 4
+LABELV c_pmove
+byte 4 0
+export PM_AddEvent
+code
+proc PM_AddEvent 0 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 BG_AddPredictableEventToPlayerstate
+CALLV
+pop
+LABELV $48
+endproc PM_AddEvent 0 12
+export PM_AddTouchEnt
+proc PM_AddTouchEnt 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1022
+NEI4 $50
+ADDRGP4 $49
+JUMPV
+LABELV $50
+ADDRGP4 pm
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 32
+NEI4 $52
+ADDRGP4 $49
+JUMPV
+LABELV $52
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $57
+JUMPV
+LABELV $54
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $58
+ADDRGP4 $49
+JUMPV
+LABELV $58
+LABELV $55
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $57
+ADDRLP4 0
+INDIRI4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+LTI4 $54
+ADDRLP4 4
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $49
+endproc PM_AddTouchEnt 12 0
+proc PM_StartTorsoAnim 8 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+LTI4 $61
+ADDRGP4 $60
+JUMPV
+LABELV $61
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 84
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 128
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+BANDI4
+ADDRLP4 4
+INDIRI4
+BXORI4
+ADDRFP4 0
+INDIRI4
+BORI4
+ASGNI4
+LABELV $60
+endproc PM_StartTorsoAnim 8 0
+proc PM_StartLegsAnim 8 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+LTI4 $64
+ADDRGP4 $63
+JUMPV
+LABELV $64
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $66
+ADDRGP4 $63
+JUMPV
+LABELV $66
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 128
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+BANDI4
+ADDRLP4 4
+INDIRI4
+BXORI4
+ADDRFP4 0
+INDIRI4
+BORI4
+ASGNI4
+LABELV $63
+endproc PM_StartLegsAnim 8 0
+proc PM_ContinueLegsAnim 0 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ADDRFP4 0
+INDIRI4
+NEI4 $69
+ADDRGP4 $68
+JUMPV
+LABELV $69
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $71
+ADDRGP4 $68
+JUMPV
+LABELV $71
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 PM_StartLegsAnim
+CALLV
+pop
+LABELV $68
+endproc PM_ContinueLegsAnim 0 4
+proc PM_ContinueTorsoAnim 0 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ADDRFP4 0
+INDIRI4
+NEI4 $74
+ADDRGP4 $73
+JUMPV
+LABELV $74
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $76
+ADDRGP4 $73
+JUMPV
+LABELV $76
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+LABELV $73
+endproc PM_ContinueTorsoAnim 0 4
+proc PM_ForceLegsAnim 0 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 PM_StartLegsAnim
+CALLV
+pop
+LABELV $78
+endproc PM_ForceLegsAnim 0 4
+export PM_ClipVelocity
+proc PM_ClipVelocity 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 24
+CNSTI4 8
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+GEF4 $80
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $81
+JUMPV
+LABELV $80
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRFP4 12
+INDIRF4
+DIVF4
+ASGNF4
+LABELV $81
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $82
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $83
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $82
+LABELV $79
+endproc PM_ClipVelocity 32 0
+proc PM_Friction 48 4
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 pml+44
+INDIRI4
+CNSTI4 0
+EQI4 $87
+ADDRLP4 16+8
+CNSTF4 0
+ASGNF4
+LABELV $87
+ADDRLP4 16
+ARGP4
+ADDRLP4 32
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $91
+ADDRLP4 0
+INDIRP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $86
+JUMPV
+LABELV $91
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 1
+GTI4 $93
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+44
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $95
+ADDRGP4 pml+52+44
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 36
+INDIRI4
+NEI4 $95
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+NEI4 $100
+ADDRLP4 8
+INDIRF4
+ADDRGP4 pm_stopspeed
+INDIRF4
+GEF4 $103
+ADDRLP4 40
+ADDRGP4 pm_stopspeed
+INDIRF4
+ASGNF4
+ADDRGP4 $104
+JUMPV
+LABELV $103
+ADDRLP4 40
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $104
+ADDRLP4 28
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDRGP4 pm_friction
+INDIRF4
+MULF4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $100
+LABELV $95
+LABELV $93
+ADDRGP4 pm
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $106
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRGP4 pm_waterfriction
+INDIRF4
+MULF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $106
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $109
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRGP4 pm_spectatorfriction
+INDIRF4
+MULF4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $109
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+GEF4 $112
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+LABELV $112
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $86
+endproc PM_Friction 48 4
+proc PM_Accelerate 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 16
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+GTF4 $115
+ADDRGP4 $114
+JUMPV
+LABELV $115
+ADDRLP4 4
+ADDRFP4 8
+INDIRF4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $118
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $118
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $120
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 24
+INDIRI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 24
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $121
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $120
+LABELV $114
+endproc PM_Accelerate 32 0
+proc PM_CmdScale 44 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 21
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 22
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LEI4 $125
+ADDRFP4 0
+INDIRP4
+CNSTI4 22
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 20
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+LABELV $125
+ADDRFP4 0
+INDIRP4
+CNSTI4 23
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 20
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LEI4 $127
+ADDRFP4 0
+INDIRP4
+CNSTI4 23
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 24
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $127
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $129
+CNSTF4 0
+RETF4
+ADDRGP4 $124
+JUMPV
+LABELV $129
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 21
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 22
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 23
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 28
+INDIRI4
+MULI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 32
+INDIRI4
+MULI4
+ADDI4
+ADDRLP4 36
+INDIRI4
+ADDRLP4 36
+INDIRI4
+MULI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 40
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1123942400
+ADDRLP4 4
+INDIRF4
+MULF4
+DIVF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+RETF4
+LABELV $124
+endproc PM_CmdScale 44 4
+proc PM_SetMovementDir 72 0
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 4
+INDIRI4
+NEI4 $134
+ADDRLP4 0
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 4
+INDIRI4
+EQI4 $132
+LABELV $134
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 12
+INDIRI4
+NEI4 $135
+ADDRLP4 8
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 12
+INDIRI4
+LEI4 $135
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $133
+JUMPV
+LABELV $135
+ADDRLP4 16
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 20
+INDIRI4
+GEI4 $137
+ADDRLP4 16
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 20
+INDIRI4
+LEI4 $137
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $133
+JUMPV
+LABELV $137
+ADDRLP4 24
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 28
+INDIRI4
+GEI4 $139
+ADDRLP4 24
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 28
+INDIRI4
+NEI4 $139
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $133
+JUMPV
+LABELV $139
+ADDRLP4 32
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 36
+INDIRI4
+GEI4 $141
+ADDRLP4 32
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 36
+INDIRI4
+GEI4 $141
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $133
+JUMPV
+LABELV $141
+ADDRLP4 40
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 44
+INDIRI4
+NEI4 $143
+ADDRLP4 40
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 44
+INDIRI4
+GEI4 $143
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRGP4 $133
+JUMPV
+LABELV $143
+ADDRLP4 48
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 52
+INDIRI4
+LEI4 $145
+ADDRLP4 48
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 52
+INDIRI4
+GEI4 $145
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRGP4 $133
+JUMPV
+LABELV $145
+ADDRLP4 56
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRLP4 56
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 60
+INDIRI4
+LEI4 $147
+ADDRLP4 56
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 60
+INDIRI4
+NEI4 $147
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 6
+ASGNI4
+ADDRGP4 $133
+JUMPV
+LABELV $147
+ADDRLP4 64
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 68
+INDIRI4
+LEI4 $133
+ADDRLP4 64
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 68
+INDIRI4
+LEI4 $133
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 7
+ASGNI4
+ADDRGP4 $133
+JUMPV
+LABELV $132
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $151
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $152
+JUMPV
+LABELV $151
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $153
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 7
+ASGNI4
+LABELV $153
+LABELV $152
+LABELV $133
+LABELV $131
+endproc PM_SetMovementDir 72 0
+proc PM_CheckJump 12 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $156
+CNSTI4 0
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $156
+ADDRGP4 pm
+INDIRP4
+CNSTI4 27
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+GEI4 $158
+CNSTI4 0
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $158
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $160
+ADDRGP4 pm
+INDIRP4
+CNSTI4 27
+ADDP4
+CNSTI1 0
+ASGNI1
+CNSTI4 0
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $160
+ADDRGP4 pml+48
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+44
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTI4 1023
+ASGNI4
+ADDRLP4 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 328
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $164
+ADDRLP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 12
+EQI4 $164
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1143521280
+ASGNF4
+ADDRGP4 $165
+JUMPV
+LABELV $164
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1132920832
+ASGNF4
+LABELV $165
+CNSTI4 14
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+LTI4 $166
+CNSTI4 18
+ARGI4
+ADDRGP4 PM_ForceLegsAnim
+CALLV
+pop
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -9
+BANDI4
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $166
+CNSTI4 20
+ARGI4
+ADDRGP4 PM_ForceLegsAnim
+CALLV
+pop
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $167
+CNSTI4 1
+RETI4
+LABELV $155
+endproc PM_CheckJump 12 4
+proc PM_CheckWaterJump 56 8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $169
+CNSTI4 0
+RETI4
+ADDRGP4 $168
+JUMPV
+LABELV $169
+ADDRGP4 pm
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $171
+CNSTI4 0
+RETI4
+ADDRGP4 $168
+JUMPV
+LABELV $171
+ADDRLP4 12
+ADDRGP4 pml
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRGP4 pml+4
+INDIRF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 28
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 32
+CNSTF4 1106247680
+ASGNF4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 28
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+CNSTF4 1106247680
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRLP4 36
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $181
+CNSTI4 0
+RETI4
+ADDRGP4 $168
+JUMPV
+LABELV $181
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 44
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRLP4 44
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $184
+CNSTI4 0
+RETI4
+ADDRGP4 $168
+JUMPV
+LABELV $184
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1128792064
+ADDRGP4 pml
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1128792064
+ADDRGP4 pml+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1128792064
+ADDRGP4 pml+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1135542272
+ASGNF4
+ADDRLP4 52
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 256
+BORI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 2000
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $168
+endproc PM_CheckWaterJump 56 8
+proc PM_WaterJumpMove 12 4
+CNSTI4 1
+ARGI4
+ADDRGP4 PM_StepSlideMove
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $190
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -353
+BANDI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $190
+LABELV $188
+endproc PM_WaterJumpMove 12 4
+proc PM_WaterMove 76 16
+ADDRLP4 40
+ADDRGP4 PM_CheckWaterJump
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $193
+ADDRGP4 PM_WaterJumpMove
+CALLV
+pop
+ADDRGP4 $192
+JUMPV
+LABELV $193
+ADDRGP4 PM_Friction
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 PM_CmdScale
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+NEF4 $195
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 8+8
+CNSTF4 3262119936
+ASGNF4
+ADDRGP4 $196
+JUMPV
+LABELV $195
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $199
+ADDRLP4 48
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 56
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 48
+INDIRI4
+ADDRGP4 pml
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 56
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+MULF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 48
+INDIRI4
+ADDRGP4 pml+12
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 56
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+LABELV $200
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $199
+ADDRLP4 8+8
+ADDRLP4 8+8
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 27
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+LABELV $196
+ADDRLP4 24
+ADDRLP4 8
+INDIRB
+ASGNB 12
+ADDRLP4 24
+ARGP4
+ADDRLP4 48
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 pm_swimScale
+INDIRF4
+MULF4
+LEF4 $205
+ADDRLP4 20
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 pm_swimScale
+INDIRF4
+MULF4
+ASGNF4
+LABELV $205
+ADDRLP4 24
+ARGP4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRGP4 pm_wateraccelerate
+INDIRF4
+ARGF4
+ADDRGP4 PM_Accelerate
+CALLV
+pop
+ADDRGP4 pml+48
+INDIRI4
+CNSTI4 0
+EQI4 $207
+ADDRLP4 52
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRGP4 pml+52+24
+INDIRF4
+MULF4
+ADDRLP4 52
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ADDRGP4 pml+52+24+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 52
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRGP4 pml+52+24+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 0
+GEF4 $207
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 60
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRGP4 pml+52+24
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+CNSTF4 1065361605
+ARGF4
+ADDRGP4 PM_ClipVelocity
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 64
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 68
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 72
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+LABELV $207
+CNSTI4 0
+ARGI4
+ADDRGP4 PM_SlideMove
+CALLI4
+pop
+LABELV $192
+endproc PM_WaterMove 76 16
+proc PM_FlyMove 52 12
+ADDRGP4 PM_Friction
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 PM_CmdScale
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+NEF4 $221
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 8+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $222
+JUMPV
+LABELV $221
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $225
+ADDRLP4 40
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 48
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 pml
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 48
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+MULF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 pml+12
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 48
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+LABELV $226
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $225
+ADDRLP4 8+8
+ADDRLP4 8+8
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 27
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+LABELV $222
+ADDRLP4 20
+ADDRLP4 8
+INDIRB
+ASGNB 12
+ADDRLP4 20
+ARGP4
+ADDRLP4 40
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ARGP4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRGP4 pm_flyaccelerate
+INDIRF4
+ARGF4
+ADDRGP4 PM_Accelerate
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 PM_StepSlideMove
+CALLV
+pop
+LABELV $220
+endproc PM_FlyMove 52 12
+proc PM_AirMove 84 16
+ADDRGP4 PM_Friction
+CALLV
+pop
+ADDRLP4 68
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 68
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 68
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 68
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRB
+ASGNB 24
+ADDRLP4 44
+ARGP4
+ADDRLP4 72
+ADDRGP4 PM_CmdScale
+CALLF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRGP4 PM_SetMovementDir
+CALLV
+pop
+ADDRGP4 pml+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 pml+12+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 pml
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRGP4 pml+12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $236
+ADDRLP4 76
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 76
+INDIRI4
+ADDRGP4 pml
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDRLP4 76
+INDIRI4
+ADDRGP4 pml+12
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $237
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $236
+ADDRLP4 4+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 24
+ARGP4
+ADDRLP4 76
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRGP4 pm_airaccelerate
+INDIRF4
+ARGF4
+ADDRGP4 PM_Accelerate
+CALLV
+pop
+ADDRGP4 pml+48
+INDIRI4
+CNSTI4 0
+EQI4 $242
+ADDRLP4 80
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRGP4 pml+52+24
+ARGP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+CNSTF4 1065361605
+ARGF4
+ADDRGP4 PM_ClipVelocity
+CALLV
+pop
+LABELV $242
+CNSTI4 1
+ARGI4
+ADDRGP4 PM_StepSlideMove
+CALLV
+pop
+LABELV $231
+endproc PM_AirMove 84 16
+proc PM_GrappleMove 52 4
+ADDRLP4 28
+CNSTF4 3246391296
+ASGNF4
+ADDRLP4 12
+ADDRLP4 28
+INDIRF4
+ADDRGP4 pml
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 28
+INDIRF4
+ADDRGP4 pml+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 3246391296
+ADDRGP4 pml+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 32
+INDIRP4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 32
+INDIRP4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ADDRLP4 36
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 36
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+8
+INDIRF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 40
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 24
+INDIRF4
+CNSTF4 1120403456
+GTF4 $260
+ADDRLP4 44
+CNSTF4 1092616192
+ADDRLP4 24
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1092616192
+ADDRLP4 24
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRGP4 $261
+JUMPV
+LABELV $260
+ADDRLP4 48
+CNSTF4 1145569280
+ASGNF4
+ADDRLP4 0
+ADDRLP4 48
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1145569280
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ASGNF4
+LABELV $261
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRGP4 pml+48
+CNSTI4 0
+ASGNI4
+LABELV $247
+endproc PM_GrappleMove 52 4
+proc PM_WalkMove 132 16
+ADDRGP4 pm
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 2
+LEI4 $272
+ADDRGP4 pml
+INDIRF4
+ADDRGP4 pml+52+24
+INDIRF4
+MULF4
+ADDRGP4 pml+4
+INDIRF4
+ADDRGP4 pml+52+24+4
+INDIRF4
+MULF4
+ADDF4
+ADDRGP4 pml+8
+INDIRF4
+ADDRGP4 pml+52+24+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 0
+LEF4 $272
+ADDRGP4 PM_WaterMove
+CALLV
+pop
+ADDRGP4 $271
+JUMPV
+LABELV $272
+ADDRLP4 76
+ADDRGP4 PM_CheckJump
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $284
+ADDRGP4 pm
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 1
+LEI4 $286
+ADDRGP4 PM_WaterMove
+CALLV
+pop
+ADDRGP4 $271
+JUMPV
+LABELV $286
+ADDRGP4 PM_AirMove
+CALLV
+pop
+ADDRGP4 $271
+JUMPV
+LABELV $284
+ADDRGP4 PM_Friction
+CALLV
+pop
+ADDRLP4 80
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 80
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 80
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 80
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRB
+ASGNB 24
+ADDRLP4 48
+ARGP4
+ADDRLP4 84
+ADDRGP4 PM_CmdScale
+CALLF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRGP4 PM_SetMovementDir
+CALLV
+pop
+ADDRGP4 pml+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 pml+12+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 88
+ADDRGP4 pml
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRGP4 pml+52+24
+ARGP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+CNSTF4 1065361605
+ARGF4
+ADDRGP4 PM_ClipVelocity
+CALLV
+pop
+ADDRGP4 pml+12
+ARGP4
+ADDRGP4 pml+52+24
+ARGP4
+ADDRGP4 pml+12
+ARGP4
+CNSTF4 1065361605
+ARGF4
+ADDRGP4 PM_ClipVelocity
+CALLV
+pop
+ADDRGP4 pml
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRGP4 pml+12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $298
+ADDRLP4 92
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 92
+INDIRI4
+ADDRGP4 pml
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDRLP4 92
+INDIRI4
+ADDRGP4 pml+12
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $299
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $298
+ADDRLP4 32
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 32
+ARGP4
+ADDRLP4 92
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 92
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 24
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $303
+ADDRLP4 24
+INDIRF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 pm_duckScale
+INDIRF4
+MULF4
+LEF4 $305
+ADDRLP4 24
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 pm_duckScale
+INDIRF4
+MULF4
+ASGNF4
+LABELV $305
+LABELV $303
+ADDRGP4 pm
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $307
+ADDRLP4 100
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 96
+ADDRLP4 100
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1077936128
+DIVF4
+ASGNF4
+ADDRLP4 104
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96
+ADDRLP4 104
+INDIRF4
+ADDRLP4 104
+INDIRF4
+ADDRGP4 pm_swimScale
+INDIRF4
+SUBF4
+ADDRLP4 96
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 100
+INDIRP4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 96
+INDIRF4
+MULF4
+LEF4 $309
+ADDRLP4 24
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 96
+INDIRF4
+MULF4
+ASGNF4
+LABELV $309
+LABELV $307
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+52+44
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 96
+INDIRI4
+NEI4 $315
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+ADDRLP4 96
+INDIRI4
+EQI4 $311
+LABELV $315
+ADDRLP4 72
+ADDRGP4 pm_airaccelerate
+INDIRF4
+ASGNF4
+ADDRGP4 $312
+JUMPV
+LABELV $311
+ADDRLP4 72
+ADDRGP4 pm_accelerate
+INDIRF4
+ASGNF4
+LABELV $312
+ADDRLP4 32
+ARGP4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRGP4 PM_Accelerate
+CALLV
+pop
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+52+44
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 100
+INDIRI4
+NEI4 $320
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+ADDRLP4 100
+INDIRI4
+EQI4 $316
+LABELV $320
+ADDRLP4 104
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 108
+ADDRLP4 104
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ADDRLP4 108
+INDIRP4
+INDIRF4
+ADDRLP4 104
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $316
+LABELV $317
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 104
+INDIRF4
+ASGNF4
+ADDRLP4 108
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRGP4 pml+52+24
+ARGP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+CNSTF4 1065361605
+ARGF4
+ADDRGP4 PM_ClipVelocity
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 112
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ADDRLP4 112
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 116
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 116
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 120
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ADDRLP4 120
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 124
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 128
+CNSTF4 0
+ASGNF4
+ADDRLP4 124
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 128
+INDIRF4
+NEF4 $324
+ADDRLP4 124
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ADDRLP4 128
+INDIRF4
+NEF4 $324
+ADDRGP4 $271
+JUMPV
+LABELV $324
+CNSTI4 0
+ARGI4
+ADDRGP4 PM_StepSlideMove
+CALLV
+pop
+LABELV $271
+endproc PM_WalkMove 132 16
+proc PM_DeadMove 20 4
+ADDRGP4 pml+44
+INDIRI4
+CNSTI4 0
+NEI4 $327
+ADDRGP4 $326
+JUMPV
+LABELV $327
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1101004800
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GTF4 $330
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 $331
+JUMPV
+LABELV $330
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+LABELV $331
+LABELV $326
+endproc PM_DeadMove 20 4
+proc PM_NoclipMove 108 12
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 26
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 1065353216
+GEF4 $333
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRGP4 vec3_origin
+INDIRB
+ASGNB 12
+ADDRGP4 $334
+JUMPV
+LABELV $333
+ADDRLP4 52
+CNSTF4 0
+ASGNF4
+ADDRLP4 56
+CNSTF4 1069547520
+ADDRGP4 pm_friction
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRGP4 pm_stopspeed
+INDIRF4
+GEF4 $336
+ADDRLP4 68
+ADDRGP4 pm_stopspeed
+INDIRF4
+ASGNF4
+ADDRGP4 $337
+JUMPV
+LABELV $336
+ADDRLP4 68
+ADDRLP4 24
+INDIRF4
+ASGNF4
+LABELV $337
+ADDRLP4 60
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 52
+INDIRF4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 24
+INDIRF4
+ADDRLP4 52
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+CNSTF4 0
+GEF4 $339
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+LABELV $339
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 24
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 72
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 76
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 80
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+LABELV $334
+ADDRGP4 pm
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 PM_CmdScale
+CALLF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 72
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 72
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 72
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $341
+ADDRLP4 76
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 76
+INDIRI4
+ADDRGP4 pml
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDRLP4 76
+INDIRI4
+ADDRGP4 pml+12
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $342
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $341
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 27
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 32
+ARGP4
+ADDRLP4 80
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 44
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+ARGP4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRGP4 pm_accelerate
+INDIRF4
+ARGF4
+ADDRGP4 PM_Accelerate
+CALLV
+pop
+ADDRLP4 84
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 88
+ADDRLP4 84
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRF4
+ADDRLP4 84
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 92
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 96
+ADDRLP4 92
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 96
+INDIRP4
+INDIRF4
+ADDRLP4 92
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 100
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 104
+ADDRLP4 100
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRF4
+ADDRLP4 100
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $332
+endproc PM_NoclipMove 108 12
+proc PM_FootstepForSurface 0 0
+ADDRGP4 pml+52+44
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $351
+CNSTI4 0
+RETI4
+ADDRGP4 $350
+JUMPV
+LABELV $351
+ADDRGP4 pml+52+44
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $355
+CNSTI4 2
+RETI4
+ADDRGP4 $350
+JUMPV
+LABELV $355
+ADDRGP4 pml+52+44
+INDIRI4
+CNSTI4 524288
+BANDI4
+CNSTI4 0
+EQI4 $359
+CNSTI4 75
+RETI4
+ADDRGP4 $350
+JUMPV
+LABELV $359
+ADDRGP4 pml+52+44
+INDIRI4
+CNSTI4 1048576
+BANDI4
+CNSTI4 0
+EQI4 $363
+CNSTI4 76
+RETI4
+ADDRGP4 $350
+JUMPV
+LABELV $363
+ADDRGP4 pml+52+44
+INDIRI4
+CNSTI4 2097152
+BANDI4
+CNSTI4 0
+EQI4 $367
+CNSTI4 77
+RETI4
+ADDRGP4 $350
+JUMPV
+LABELV $367
+ADDRGP4 pml+52+44
+INDIRI4
+CNSTI4 4194304
+BANDI4
+CNSTI4 0
+EQI4 $371
+CNSTI4 78
+RETI4
+ADDRGP4 $350
+JUMPV
+LABELV $371
+ADDRGP4 pml+52+44
+INDIRI4
+CNSTI4 8388608
+BANDI4
+CNSTI4 0
+EQI4 $375
+CNSTI4 79
+RETI4
+ADDRGP4 $350
+JUMPV
+LABELV $375
+ADDRGP4 pml+52+44
+INDIRI4
+CNSTI4 16777216
+BANDI4
+CNSTI4 0
+EQI4 $379
+CNSTI4 80
+RETI4
+ADDRGP4 $350
+JUMPV
+LABELV $379
+CNSTI4 1
+RETI4
+LABELV $350
+endproc PM_FootstepForSurface 0 0
+proc PM_CrashLand 56 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $384
+CNSTI4 21
+ARGI4
+ADDRGP4 PM_ForceLegsAnim
+CALLV
+pop
+ADDRGP4 $385
+JUMPV
+LABELV $384
+CNSTI4 19
+ARGI4
+ADDRGP4 PM_ForceLegsAnim
+CALLV
+pop
+LABELV $385
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 130
+ASGNI4
+ADDRLP4 36
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 36
+INDIRP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRGP4 pml+112+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+ADDRGP4 pml+124+8
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 36
+INDIRP4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+NEGI4
+CVIF4 4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 12
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 24
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+CNSTF4 1082130432
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+CNSTF4 0
+GEF4 $390
+ADDRGP4 $383
+JUMPV
+LABELV $390
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 4
+INDIRF4
+NEGF4
+ADDRLP4 44
+INDIRF4
+SUBF4
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRF4
+MULF4
+DIVF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 953267991
+ADDRLP4 0
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $392
+ADDRLP4 0
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+LABELV $392
+ADDRGP4 pm
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $394
+ADDRGP4 $383
+JUMPV
+LABELV $394
+ADDRGP4 pm
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $396
+ADDRLP4 0
+CNSTF4 1048576000
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $397
+JUMPV
+LABELV $396
+ADDRGP4 pm
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $398
+ADDRLP4 0
+CNSTF4 1056964608
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+LABELV $398
+LABELV $397
+ADDRLP4 0
+INDIRF4
+CNSTF4 1065353216
+GEF4 $400
+ADDRGP4 $383
+JUMPV
+LABELV $400
+ADDRGP4 pml+52+44
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $402
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 328
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $406
+ADDRLP4 0
+INDIRF4
+CNSTF4 1088421888
+LEF4 $406
+CNSTI4 10
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 $407
+JUMPV
+LABELV $406
+ADDRLP4 0
+INDIRF4
+CNSTF4 1114636288
+LEF4 $408
+CNSTI4 12
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+CNSTI4 28
+ARGI4
+ADDRGP4 PM_ForceLegsAnim
+CALLV
+pop
+ADDRGP4 $409
+JUMPV
+LABELV $408
+ADDRLP4 0
+INDIRF4
+CNSTF4 1109393408
+LEF4 $410
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $411
+CNSTI4 11
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 $411
+JUMPV
+LABELV $410
+ADDRLP4 0
+INDIRF4
+CNSTF4 1088421888
+LEF4 $414
+CNSTI4 10
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 $415
+JUMPV
+LABELV $414
+ADDRLP4 52
+ADDRGP4 PM_FootstepForSurface
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+LABELV $415
+LABELV $411
+LABELV $409
+LABELV $407
+LABELV $402
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $383
+endproc PM_CrashLand 56 4
+proc PM_CorrectAllSolid 40 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $417
+ADDRGP4 $419
+ARGP4
+ADDRGP4 c_pmove
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $417
+ADDRLP4 20
+CNSTI4 -1
+ASGNI4
+LABELV $420
+ADDRLP4 16
+CNSTI4 -1
+ASGNI4
+LABELV $424
+ADDRLP4 12
+CNSTI4 -1
+ASGNI4
+LABELV $428
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 184
+ADDP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 196
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+INDIRP4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $434
+ADDRLP4 28
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 28
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+CNSTF4 1048576000
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 32
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+CNSTI4 184
+ADDP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+CNSTI4 196
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 pml+52
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 56
+CNSTI4 1
+RETI4
+ADDRGP4 $416
+JUMPV
+LABELV $434
+LABELV $429
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+LEI4 $428
+LABELV $425
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+LEI4 $424
+LABELV $421
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+LEI4 $420
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTI4 1023
+ASGNI4
+ADDRGP4 pml+48
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+44
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+LABELV $416
+endproc PM_CorrectAllSolid 40 28
+proc PM_GroundTraceMissed 80 28
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1023
+EQI4 $442
+ADDRGP4 pm
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $444
+ADDRGP4 $446
+ARGP4
+ADDRGP4 c_pmove
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $444
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1115684864
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 68
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 72
+ADDRLP4 68
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+CNSTI4 184
+ADDP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+CNSTI4 196
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 68
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 68
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $448
+ADDRGP4 pm
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+LTI4 $451
+CNSTI4 18
+ARGI4
+ADDRGP4 PM_ForceLegsAnim
+CALLV
+pop
+ADDRLP4 76
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRI4
+CNSTI4 -9
+BANDI4
+ASGNI4
+ADDRGP4 $452
+JUMPV
+LABELV $451
+CNSTI4 20
+ARGI4
+ADDRGP4 PM_ForceLegsAnim
+CALLV
+pop
+ADDRLP4 76
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $452
+LABELV $448
+LABELV $442
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTI4 1023
+ASGNI4
+ADDRGP4 pml+48
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+44
+CNSTI4 0
+ASGNI4
+LABELV $441
+endproc PM_GroundTraceMissed 80 28
+proc PM_GroundTrace 92 28
+ADDRLP4 68
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 68
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 68
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 56+8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+CNSTF4 1048576000
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 72
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 72
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 184
+ADDP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 196
+ADDP4
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 76
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 pml+52
+ADDRLP4 0
+INDIRB
+ASGNB 56
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $459
+ADDRLP4 0
+ARGP4
+ADDRLP4 80
+ADDRGP4 PM_CorrectAllSolid
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+NEI4 $461
+ADDRGP4 $455
+JUMPV
+LABELV $461
+LABELV $459
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $463
+ADDRGP4 PM_GroundTraceMissed
+CALLV
+pop
+ADDRGP4 pml+48
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $455
+JUMPV
+LABELV $463
+ADDRLP4 80
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 84
+ADDRLP4 80
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 84
+INDIRF4
+CNSTF4 0
+LEF4 $468
+ADDRLP4 80
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0+24
+INDIRF4
+MULF4
+ADDRLP4 80
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ADDRLP4 0+24+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 0+24+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1092616192
+LEF4 $468
+ADDRGP4 pm
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $475
+ADDRGP4 $477
+ARGP4
+ADDRGP4 c_pmove
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $475
+ADDRGP4 pm
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+LTI4 $478
+CNSTI4 18
+ARGI4
+ADDRGP4 PM_ForceLegsAnim
+CALLV
+pop
+ADDRLP4 88
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 -9
+BANDI4
+ASGNI4
+ADDRGP4 $479
+JUMPV
+LABELV $478
+CNSTI4 20
+ARGI4
+ADDRGP4 PM_ForceLegsAnim
+CALLV
+pop
+ADDRLP4 88
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $479
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTI4 1023
+ASGNI4
+ADDRGP4 pml+48
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $455
+JUMPV
+LABELV $468
+ADDRLP4 0+24+8
+INDIRF4
+CNSTF4 1060320051
+GEF4 $482
+ADDRGP4 pm
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $486
+ADDRGP4 $488
+ARGP4
+ADDRGP4 c_pmove
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $486
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTI4 1023
+ASGNI4
+ADDRGP4 pml+48
+CNSTI4 1
+ASGNI4
+ADDRGP4 pml+44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $455
+JUMPV
+LABELV $482
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 32768
+BANDI4
+CNSTI4 0
+EQI4 $491
+ADDRLP4 88
+ADDRGP4 pml+52+44
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $491
+ADDRGP4 pml+48
+CNSTI4 1
+ASGNI4
+ADDRGP4 pml+44
+CNSTI4 1
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $497
+ADDRLP4 88
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 -289
+BANDI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $497
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1023
+NEI4 $499
+ADDRGP4 pm
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $501
+ADDRGP4 $503
+ARGP4
+ADDRGP4 c_pmove
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $501
+ADDRGP4 PM_CrashLand
+CALLV
+pop
+ADDRGP4 pml+124+8
+INDIRF4
+CNSTF4 3276275712
+GEF4 $504
+ADDRLP4 88
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 250
+ASGNI4
+LABELV $504
+LABELV $499
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 0+52
+INDIRI4
+ASGNI4
+ADDRLP4 0+52
+INDIRI4
+ARGI4
+ADDRGP4 PM_AddTouchEnt
+CALLV
+pop
+LABELV $455
+endproc PM_GroundTrace 92 28
+proc PM_SetWaterLevel 56 8
+ADDRGP4 pm
+INDIRP4
+CNSTI4 212
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+CNSTF4 3250585600
+ADDF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 28
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRLP4 28
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $513
+ADDRLP4 36
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 36
+INDIRP4
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 -24
+SUBI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 208
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 212
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0+8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+CNSTF4 3250585600
+ADDF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 40
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRLP4 40
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $516
+ADDRGP4 pm
+INDIRP4
+CNSTI4 212
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+CNSTF4 3250585600
+ADDF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 48
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRLP4 48
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $519
+ADDRGP4 pm
+INDIRP4
+CNSTI4 212
+ADDP4
+CNSTI4 3
+ASGNI4
+LABELV $519
+LABELV $516
+LABELV $513
+LABELV $510
+endproc PM_SetWaterLevel 56 8
+proc PM_CheckDuck 72 28
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 324
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $522
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 26
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTF4 3253731328
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTF4 3253731328
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTF4 3253731328
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTF4 1106247680
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTF4 1106247680
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 204
+ADDP4
+CNSTF4 1106247680
+ASGNF4
+ADDRGP4 $521
+JUMPV
+LABELV $522
+ADDRGP4 pm
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTF4 3245342720
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTF4 3245342720
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTF4 1097859072
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTF4 1097859072
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTF4 3250585600
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $524
+ADDRGP4 pm
+INDIRP4
+CNSTI4 204
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 -16
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $524
+ADDRGP4 pm
+INDIRP4
+CNSTI4 27
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+GEI4 $526
+ADDRLP4 56
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRGP4 $527
+JUMPV
+LABELV $526
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $528
+ADDRGP4 pm
+INDIRP4
+CNSTI4 204
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 56
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 60
+ADDRLP4 56
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 60
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 184
+ADDP4
+ARGP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 196
+ADDP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 60
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $530
+ADDRLP4 68
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+LABELV $530
+LABELV $528
+LABELV $527
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $532
+ADDRGP4 pm
+INDIRP4
+CNSTI4 204
+ADDP4
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 12
+ASGNI4
+ADDRGP4 $533
+JUMPV
+LABELV $532
+ADDRGP4 pm
+INDIRP4
+CNSTI4 204
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 26
+ASGNI4
+LABELV $533
+LABELV $521
+endproc PM_CheckDuck 72 28
+proc PM_Footsteps 64 4
+ADDRLP4 12
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 12
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 16
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 16
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 216
+ADDP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1023
+NEI4 $535
+ADDRGP4 pm
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 1
+LEI4 $534
+CNSTI4 17
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+ADDRGP4 $534
+JUMPV
+LABELV $535
+ADDRLP4 32
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 36
+INDIRI4
+NEI4 $539
+ADDRLP4 32
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 36
+INDIRI4
+NEI4 $539
+ADDRGP4 pm
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+CNSTF4 1084227584
+GEF4 $534
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $543
+CNSTI4 23
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+ADDRGP4 $534
+JUMPV
+LABELV $543
+CNSTI4 22
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+ADDRGP4 $534
+JUMPV
+LABELV $539
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 40
+INDIRI4
+EQI4 $545
+ADDRLP4 4
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $547
+CNSTI4 36
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+ADDRGP4 $546
+JUMPV
+LABELV $547
+CNSTI4 13
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+ADDRGP4 $546
+JUMPV
+LABELV $545
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+NEI4 $549
+ADDRLP4 4
+CNSTF4 1053609165
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $551
+CNSTI4 16
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+ADDRGP4 $552
+JUMPV
+LABELV $551
+CNSTI4 15
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+LABELV $552
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $550
+JUMPV
+LABELV $549
+ADDRLP4 4
+CNSTF4 1050253722
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $553
+CNSTI4 37
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+ADDRGP4 $554
+JUMPV
+LABELV $553
+CNSTI4 14
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+LABELV $554
+LABELV $550
+LABELV $546
+ADDRLP4 44
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 48
+CNSTI4 8
+ASGNI4
+ADDRLP4 0
+ADDRLP4 44
+INDIRP4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRP4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+ADDRGP4 pml+40
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+CVFI4 4
+CNSTI4 255
+BANDI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 64
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 52
+INDIRI4
+ADDI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+ADDI4
+BXORI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $556
+ADDRGP4 pm
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $558
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 56
+INDIRI4
+EQI4 $559
+ADDRGP4 pm
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRLP4 56
+INDIRI4
+NEI4 $559
+ADDRLP4 60
+ADDRGP4 PM_FootstepForSurface
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 $559
+JUMPV
+LABELV $558
+ADDRGP4 pm
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $562
+CNSTI4 3
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 $563
+JUMPV
+LABELV $562
+ADDRGP4 pm
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $564
+CNSTI4 5
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 $565
+JUMPV
+LABELV $564
+ADDRGP4 pm
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $566
+LABELV $566
+LABELV $565
+LABELV $563
+LABELV $559
+LABELV $556
+LABELV $534
+endproc PM_Footsteps 64 4
+proc PM_WaterEvents 16 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+136
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $569
+ADDRGP4 pm
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $569
+CNSTI4 15
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+LABELV $569
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+136
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $572
+ADDRGP4 pm
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $572
+CNSTI4 16
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+LABELV $572
+ADDRLP4 8
+CNSTI4 3
+ASGNI4
+ADDRGP4 pml+136
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $575
+ADDRGP4 pm
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $575
+CNSTI4 17
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+LABELV $575
+ADDRLP4 12
+CNSTI4 3
+ASGNI4
+ADDRGP4 pml+136
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $578
+ADDRGP4 pm
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $578
+CNSTI4 18
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+LABELV $578
+LABELV $568
+endproc PM_WaterEvents 16 4
+proc PM_BeginWeaponChange 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $584
+ADDRFP4 0
+INDIRI4
+CNSTI4 15
+LTI4 $582
+LABELV $584
+ADDRGP4 $581
+JUMPV
+LABELV $582
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRFP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $585
+ADDRGP4 $581
+JUMPV
+LABELV $585
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $587
+ADDRGP4 $581
+JUMPV
+LABELV $587
+CNSTI4 22
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 150
+ADDI4
+ASGNI4
+CNSTI4 9
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+LABELV $581
+endproc PM_BeginWeaponChange 8 4
+proc PM_FinishWeaponChange 16 4
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRU1
+CVUI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $592
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+LTI4 $590
+LABELV $592
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $590
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $593
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $593
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 340
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $595
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $595
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+EQI4 $595
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $595
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 200
+ADDI4
+ASGNI4
+CNSTI4 10
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+LABELV $589
+endproc PM_FinishWeaponChange 16 4
+proc PM_TorsoAnimation 0 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $598
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $600
+CNSTI4 12
+ARGI4
+ADDRGP4 PM_ContinueTorsoAnim
+CALLV
+pop
+ADDRGP4 $597
+JUMPV
+LABELV $600
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 12
+NEI4 $602
+CNSTI4 26
+ARGI4
+ADDRGP4 PM_ContinueTorsoAnim
+CALLV
+pop
+ADDRGP4 $597
+JUMPV
+LABELV $602
+CNSTI4 11
+ARGI4
+ADDRGP4 PM_ContinueTorsoAnim
+CALLV
+pop
+LABELV $598
+LABELV $597
+endproc PM_TorsoAnimation 0 4
+proc PM_Weapon 64 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $605
+ADDRGP4 $604
+JUMPV
+LABELV $605
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 252
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $607
+ADDRGP4 $604
+JUMPV
+LABELV $607
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $609
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $604
+JUMPV
+LABELV $609
+ADDRLP4 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -1048577
+BANDI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $611
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+ADDRLP4 12
+INDIRI4
+EQI4 $613
+ADDRLP4 8
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LEI4 $613
+ADDRGP4 $604
+JUMPV
+LABELV $613
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+NEI4 $612
+ADDRLP4 16
+CNSTI4 52
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $618
+ADDRLP4 20
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 25
+ADDI4
+LTI4 $618
+ADDRGP4 $604
+JUMPV
+LABELV $618
+ADDRLP4 16
+INDIRI4
+CNSTI4 3
+NEI4 $620
+ADDRLP4 16
+INDIRI4
+CNSTI4 25
+ADDI4
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRLP4 24
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 24
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 27
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 32
+INDIRI4
+NEI4 $624
+ADDRLP4 28
+INDIRI4
+ADDRLP4 32
+INDIRI4
+NEI4 $622
+ADDRLP4 24
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $622
+LABELV $624
+CNSTI4 27
+ARGI4
+ADDRGP4 PM_ForceLegsAnim
+CALLV
+pop
+LABELV $622
+ADDRLP4 36
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 1048576
+BORI4
+ASGNI4
+ADDRLP4 40
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 212
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDRGP4 pml+40
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $628
+ADDRLP4 44
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 1024
+BORI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 212
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $628
+JUMPV
+LABELV $620
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+NEI4 $629
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $631
+ADDRGP4 $628
+JUMPV
+LABELV $631
+ADDRLP4 16
+INDIRI4
+CNSTI4 25
+ADDI4
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRLP4 24
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 212
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $633
+ADDRLP4 28
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 1024
+BORI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 212
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $633
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 500
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $628
+JUMPV
+LABELV $629
+ADDRLP4 16
+INDIRI4
+CNSTI4 6
+NEI4 $635
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $637
+ADDRGP4 $628
+JUMPV
+LABELV $637
+ADDRLP4 16
+INDIRI4
+CNSTI4 25
+ADDI4
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 500
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $628
+JUMPV
+LABELV $635
+ADDRLP4 16
+INDIRI4
+CNSTI4 5
+NEI4 $639
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $641
+ADDRGP4 $628
+JUMPV
+LABELV $641
+ADDRLP4 16
+INDIRI4
+CNSTI4 25
+ADDI4
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRLP4 24
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1024
+BORI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 2000
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $604
+JUMPV
+LABELV $639
+ADDRLP4 24
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1024
+BORI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 25
+ADDI4
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $604
+JUMPV
+LABELV $611
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -1025
+BANDI4
+ASGNI4
+LABELV $612
+LABELV $628
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $643
+ADDRLP4 12
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ADDRGP4 pml+40
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 1800
+LEI4 $646
+ADDRLP4 16
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+LABELV $646
+ADDRLP4 16
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 16
+INDIRP4
+INDIRP4
+CNSTI4 456
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_crandom
+CALLF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 16
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 24
+INDIRP4
+CNSTI4 56
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CVIF4 4
+CNSTF4 994352038
+ADDRGP4 pml+40
+INDIRI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+MULI4
+CVIF4 4
+MULF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_crandom
+CALLF4
+ASGNF4
+ADDRLP4 36
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 36
+INDIRP4
+CNSTI4 60
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CVIF4 4
+CNSTF4 994352038
+ADDRGP4 pml+40
+INDIRI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+MULI4
+CVIF4 4
+MULF4
+ADDRLP4 32
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $650
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 800
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $604
+ADDRGP4 $654
+JUMPV
+LABELV $650
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 3000
+LEI4 $604
+CNSTI4 24
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRLP4 44
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 -513
+BANDI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 800
+ASGNI4
+ADDRLP4 48
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 52
+ADDRLP4 48
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 376
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $604
+JUMPV
+LABELV $643
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $657
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRGP4 pml+40
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $657
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $662
+ADDRLP4 8
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $660
+LABELV $662
+ADDRLP4 12
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRU1
+CVUI4 1
+EQI4 $663
+ADDRGP4 pm
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRU1
+CVUI4 1
+ARGI4
+ADDRGP4 PM_BeginWeaponChange
+CALLV
+pop
+LABELV $663
+LABELV $660
+ADDRLP4 12
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 12
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $665
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $665
+ADDRLP4 16
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LEI4 $665
+ADDRLP4 12
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 20
+INDIRI4
+NEI4 $665
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $665
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $667
+ADDRGP4 $604
+JUMPV
+LABELV $667
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $669
+ADDRGP4 PM_FinishWeaponChange
+CALLV
+pop
+ADDRGP4 $604
+JUMPV
+LABELV $669
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $671
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $673
+CNSTI4 12
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+ADDRGP4 $604
+JUMPV
+LABELV $673
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 12
+NEI4 $675
+CNSTI4 26
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+ADDRGP4 $604
+JUMPV
+LABELV $675
+CNSTI4 11
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+ADDRGP4 $604
+JUMPV
+LABELV $671
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $677
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $604
+JUMPV
+LABELV $677
+ADDRLP4 24
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+ADDRLP4 28
+INDIRI4
+EQI4 $679
+ADDRLP4 24
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LEI4 $679
+ADDRLP4 24
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 12
+EQI4 $679
+ADDRGP4 $604
+JUMPV
+LABELV $679
+ADDRLP4 32
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 12
+NEI4 $681
+ADDRLP4 32
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $681
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 400
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $604
+JUMPV
+LABELV $681
+ADDRLP4 36
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $683
+ADDRLP4 36
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $683
+ADDRLP4 40
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 250
+ADDI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $604
+JUMPV
+LABELV $683
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $685
+ADDRGP4 pm
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $687
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $604
+JUMPV
+LABELV $687
+CNSTI4 8
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+ADDRGP4 $686
+JUMPV
+LABELV $685
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 12
+NEI4 $689
+CNSTI4 25
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+ADDRGP4 $690
+JUMPV
+LABELV $689
+CNSTI4 7
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+LABELV $690
+LABELV $686
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 40
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 40
+INDIRP4
+CNSTI4 376
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $691
+CNSTI4 21
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRLP4 44
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 200
+ADDI4
+ASGNI4
+ADDRGP4 $604
+JUMPV
+LABELV $691
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 9
+NEI4 $693
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $604
+JUMPV
+LABELV $693
+LABELV $654
+ADDRLP4 44
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 -513
+BANDI4
+ASGNI4
+ADDRLP4 48
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 376
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $695
+ADDRLP4 52
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 52
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 52
+INDIRP4
+CNSTI4 376
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $695
+CNSTI4 23
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRLP4 52
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 1
+LTI4 $697
+ADDRLP4 52
+INDIRI4
+CNSTI4 12
+GTI4 $697
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $712-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $712
+address $700
+address $703
+address $702
+address $704
+address $705
+address $701
+address $707
+address $706
+address $708
+address $709
+address $710
+address $711
+code
+LABELV $697
+LABELV $700
+ADDRLP4 0
+CNSTI4 400
+ASGNI4
+ADDRGP4 $698
+JUMPV
+LABELV $701
+ADDRLP4 0
+CNSTI4 50
+ASGNI4
+ADDRGP4 $698
+JUMPV
+LABELV $702
+ADDRLP4 0
+CNSTI4 1000
+ASGNI4
+ADDRGP4 $698
+JUMPV
+LABELV $703
+ADDRLP4 0
+CNSTI4 150
+ASGNI4
+ADDRGP4 $698
+JUMPV
+LABELV $704
+ADDRLP4 0
+CNSTI4 800
+ASGNI4
+ADDRGP4 $698
+JUMPV
+LABELV $705
+ADDRLP4 0
+CNSTI4 800
+ASGNI4
+ADDRGP4 $698
+JUMPV
+LABELV $706
+ADDRLP4 0
+CNSTI4 100
+ASGNI4
+ADDRGP4 $698
+JUMPV
+LABELV $707
+ADDRLP4 0
+CNSTI4 2000
+ASGNI4
+ADDRGP4 $698
+JUMPV
+LABELV $708
+ADDRLP4 0
+CNSTI4 200
+ASGNI4
+ADDRGP4 $698
+JUMPV
+LABELV $709
+ADDRLP4 0
+CNSTI4 1500
+ASGNI4
+ADDRGP4 $698
+JUMPV
+LABELV $710
+ADDRLP4 0
+CNSTI4 400
+ASGNI4
+ADDRGP4 $698
+JUMPV
+LABELV $711
+ADDRLP4 0
+CNSTI4 800
+ASGNI4
+LABELV $698
+ADDRLP4 60
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $604
+endproc PM_Weapon 64 4
+proc PM_Animate 0 4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $715
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $717
+CNSTI4 6
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTI4 2294
+ASGNI4
+CNSTI4 72
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+LABELV $717
+LABELV $715
+LABELV $714
+endproc PM_Animate 0 4
+proc PM_DropTimers 4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $720
+ADDRGP4 pml+40
+INDIRI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+LTI4 $722
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 -353
+BANDI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $723
+JUMPV
+LABELV $722
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 pml+40
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $723
+LABELV $720
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $726
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 pml+40
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $729
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $729
+LABELV $726
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $731
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 pml+40
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $734
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $734
+LABELV $731
+LABELV $719
+endproc PM_DropTimers 4 0
+export PM_UpdateViewAngles
+proc PM_UpdateViewAngles 28 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 5
+EQI4 $739
+ADDRLP4 8
+INDIRI4
+CNSTI4 6
+NEI4 $737
+LABELV $739
+ADDRGP4 $736
+JUMPV
+LABELV $737
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $740
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $740
+ADDRGP4 $736
+JUMPV
+LABELV $740
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $742
+ADDRLP4 20
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDP4
+INDIRI4
+ADDI4
+CVII2 4
+ASGNI2
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $746
+ADDRLP4 4
+INDIRI2
+CVII4 2
+CNSTI4 16000
+LEI4 $748
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDP4
+CNSTI4 16000
+ADDRLP4 24
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 4
+CNSTI2 16000
+ASGNI2
+ADDRGP4 $749
+JUMPV
+LABELV $748
+ADDRLP4 4
+INDIRI2
+CVII4 2
+CNSTI4 -16000
+GEI4 $750
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDP4
+CNSTI4 -16000
+ADDRLP4 24
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 4
+CNSTI2 -16000
+ASGNI2
+LABELV $750
+LABELV $749
+LABELV $746
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDP4
+CNSTF4 1001652224
+ADDRLP4 4
+INDIRI2
+CVII4 2
+CVIF4 4
+MULF4
+ASGNF4
+LABELV $743
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $742
+LABELV $736
+endproc PM_UpdateViewAngles 28 0
+export PmoveSingle
+proc PmoveSingle 76 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 pm
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 c_pmove
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 212
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $753
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -33554433
+BANDI4
+ASGNI4
+LABELV $753
+ADDRGP4 pm
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+GTI4 $757
+ADDRGP4 pm
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 64
+LEI4 $755
+LABELV $757
+ADDRLP4 16
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 -17
+BANDI4
+ASGNI4
+LABELV $755
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $758
+ADDRLP4 16
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+ADDRGP4 $759
+JUMPV
+LABELV $758
+ADDRLP4 16
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 -4097
+BANDI4
+ASGNI4
+LABELV $759
+ADDRLP4 16
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 16
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+ADDRLP4 24
+INDIRI4
+NEI4 $760
+ADDRLP4 28
+CNSTI4 4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 20
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 5
+EQI4 $760
+ADDRLP4 32
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $760
+ADDRLP4 16
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 24
+INDIRI4
+EQI4 $760
+ADDRLP4 36
+ADDRLP4 20
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 376
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $760
+ADDRLP4 36
+INDIRI4
+CNSTI4 9
+NEI4 $762
+ADDRLP4 20
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $760
+LABELV $762
+ADDRLP4 40
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $763
+ADDRLP4 40
+INDIRP4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $760
+LABELV $763
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $760
+ADDRLP4 44
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 256
+BORI4
+ASGNI4
+ADDRGP4 $761
+JUMPV
+LABELV $760
+ADDRLP4 44
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 -257
+BANDI4
+ASGNI4
+LABELV $761
+ADDRLP4 44
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+INDIRP4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LEI4 $764
+ADDRLP4 44
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 5
+BANDI4
+ADDRLP4 48
+INDIRI4
+NEI4 $764
+ADDRLP4 52
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 -513
+BANDI4
+ASGNI4
+LABELV $764
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $766
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 25
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CNSTI4 26
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CNSTI4 27
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $766
+ADDRGP4 pml
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 pml+40
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 pml+40
+INDIRI4
+CNSTI4 1
+GEI4 $769
+ADDRGP4 pml+40
+CNSTI4 1
+ASGNI4
+ADDRGP4 $770
+JUMPV
+LABELV $769
+ADDRGP4 pml+40
+INDIRI4
+CNSTI4 200
+LEI4 $773
+ADDRGP4 pml+40
+CNSTI4 200
+ASGNI4
+LABELV $773
+LABELV $770
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 pml+112
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 pml+124
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 pml+36
+CNSTF4 981668463
+ADDRGP4 pml+40
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 52
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 PM_UpdateViewAngles
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 152
+ADDP4
+ARGP4
+ADDRGP4 pml
+ARGP4
+ADDRGP4 pml+12
+ARGP4
+ADDRGP4 pml+24
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+CNSTI4 27
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+GEI4 $783
+ADDRLP4 56
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+LABELV $783
+ADDRGP4 pm
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+GEI4 $785
+ADDRLP4 56
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+ADDRGP4 $786
+JUMPV
+LABELV $785
+ADDRLP4 56
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 60
+ADDRLP4 56
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRLP4 60
+INDIRI4
+ADDRLP4 64
+INDIRI4
+GTI4 $789
+ADDRLP4 60
+INDIRI4
+ADDRLP4 64
+INDIRI4
+NEI4 $787
+ADDRLP4 56
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 64
+INDIRI4
+EQI4 $787
+LABELV $789
+ADDRLP4 68
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRI4
+CNSTI4 -17
+BANDI4
+ASGNI4
+LABELV $787
+LABELV $786
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+LTI4 $790
+ADDRGP4 pm
+INDIRP4
+CNSTI4 25
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 pm
+INDIRP4
+CNSTI4 26
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 pm
+INDIRP4
+CNSTI4 27
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $790
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $792
+ADDRGP4 PM_CheckDuck
+CALLV
+pop
+ADDRGP4 PM_FlyMove
+CALLV
+pop
+ADDRGP4 PM_DropTimers
+CALLV
+pop
+ADDRGP4 $752
+JUMPV
+LABELV $792
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $794
+ADDRGP4 PM_NoclipMove
+CALLV
+pop
+ADDRGP4 PM_DropTimers
+CALLV
+pop
+ADDRGP4 $752
+JUMPV
+LABELV $794
+ADDRLP4 68
+CNSTI4 4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 68
+INDIRI4
+NEI4 $796
+ADDRGP4 $752
+JUMPV
+LABELV $796
+ADDRLP4 72
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 5
+EQI4 $800
+ADDRLP4 72
+INDIRI4
+CNSTI4 6
+NEI4 $798
+LABELV $800
+ADDRGP4 $752
+JUMPV
+LABELV $798
+ADDRGP4 PM_SetWaterLevel
+CALLV
+pop
+ADDRGP4 pml+136
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 PM_CheckDuck
+CALLV
+pop
+ADDRGP4 PM_GroundTrace
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $802
+ADDRGP4 PM_DeadMove
+CALLV
+pop
+LABELV $802
+ADDRGP4 PM_DropTimers
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $804
+ADDRGP4 PM_GrappleMove
+CALLV
+pop
+ADDRGP4 PM_AirMove
+CALLV
+pop
+ADDRGP4 $805
+JUMPV
+LABELV $804
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $806
+ADDRGP4 PM_WaterJumpMove
+CALLV
+pop
+ADDRGP4 $807
+JUMPV
+LABELV $806
+ADDRGP4 pm
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 1
+LEI4 $808
+ADDRGP4 PM_WaterMove
+CALLV
+pop
+ADDRGP4 $809
+JUMPV
+LABELV $808
+ADDRGP4 pml+44
+INDIRI4
+CNSTI4 0
+EQI4 $810
+ADDRGP4 PM_WalkMove
+CALLV
+pop
+ADDRGP4 $811
+JUMPV
+LABELV $810
+ADDRGP4 PM_AirMove
+CALLV
+pop
+LABELV $811
+LABELV $809
+LABELV $807
+LABELV $805
+ADDRGP4 PM_Animate
+CALLV
+pop
+ADDRGP4 PM_GroundTrace
+CALLV
+pop
+ADDRGP4 PM_SetWaterLevel
+CALLV
+pop
+ADDRGP4 PM_Weapon
+CALLV
+pop
+ADDRGP4 PM_TorsoAnimation
+CALLV
+pop
+ADDRGP4 PM_Footsteps
+CALLV
+pop
+ADDRGP4 PM_WaterEvents
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRGP4 trap_SnapVector
+CALLV
+pop
+LABELV $752
+endproc PmoveSingle 76 16
+export Pmove
+proc Pmove 24 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+INDIRI4
+GEI4 $814
+ADDRGP4 $813
+JUMPV
+LABELV $814
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+INDIRI4
+CNSTI4 1000
+ADDI4
+LEI4 $816
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1000
+SUBI4
+ASGNI4
+LABELV $816
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CNSTI4 456
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 63
+BANDI4
+ASGNI4
+ADDRGP4 $819
+JUMPV
+LABELV $818
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $821
+ADDRLP4 12
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+LEI4 $822
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $822
+JUMPV
+LABELV $821
+ADDRLP4 12
+INDIRI4
+CNSTI4 66
+LEI4 $825
+ADDRLP4 12
+CNSTI4 66
+ASGNI4
+LABELV $825
+LABELV $822
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 PmoveSingle
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $827
+ADDRFP4 0
+INDIRP4
+CNSTI4 27
+ADDP4
+CNSTI1 20
+ASGNI1
+LABELV $827
+LABELV $819
+ADDRFP4 0
+INDIRP4
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $818
+LABELV $813
+endproc Pmove 24 4
+import trap_SnapVector
+import PM_StepSlideMove
+import PM_SlideMove
+bss
+export pml
+align 4
+LABELV pml
+skip 140
+export pm
+align 4
+LABELV pm
+skip 4
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $503
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 76
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $488
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 101
+byte 1 112
+byte 1 10
+byte 1 0
+align 1
+LABELV $477
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $446
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 108
+byte 1 105
+byte 1 102
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $419
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 10
+byte 1 0
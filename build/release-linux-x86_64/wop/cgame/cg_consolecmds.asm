@@ -0,0 +1,2698 @@
+code
+proc CG_TargetCommand_f 20 12
+ADDRLP4 8
+ADDRGP4 CG_CrosshairPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $81
+ADDRGP4 $80
+JUMPV
+LABELV $81
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 $83
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $80
+endproc CG_TargetCommand_f 20 12
+proc CG_SizeUp_f 4 8
+ADDRGP4 $86
+ARGP4
+ADDRGP4 cg_viewsize+12
+INDIRI4
+CNSTI4 10
+ADDI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $85
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $84
+endproc CG_SizeUp_f 4 8
+proc CG_SizeDown_f 4 8
+ADDRGP4 $86
+ARGP4
+ADDRGP4 cg_viewsize+12
+INDIRI4
+CNSTI4 10
+SUBI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $85
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $88
+endproc CG_SizeDown_f 4 8
+proc CG_Viewpos_f 0 20
+ADDRGP4 $91
+ARGP4
+ADDRGP4 cg+110648+24
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 cg+110648+24+8
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 cg+111016+4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $90
+endproc CG_Viewpos_f 0 20
+proc CG_ScoresDown_f 0 4
+ADDRGP4 cg+112100
+INDIRI4
+CNSTI4 2000
+ADDI4
+ADDRGP4 cg+107612
+INDIRI4
+GEI4 $103
+ADDRGP4 cg+112100
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRGP4 $109
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+ADDRGP4 cg+121340
+INDIRI4
+CNSTI4 0
+NEI4 $104
+ADDRGP4 cg+121340
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+112104
+CNSTI4 0
+ASGNI4
+ADDRGP4 $104
+JUMPV
+LABELV $103
+ADDRGP4 cg+121340
+CNSTI4 1
+ASGNI4
+LABELV $104
+LABELV $102
+endproc CG_ScoresDown_f 0 4
+proc CG_ScoresUp_f 0 0
+ADDRGP4 cg+121340
+INDIRI4
+CNSTI4 0
+EQI4 $117
+ADDRGP4 cg+121340
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+121348
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+LABELV $117
+LABELV $116
+endproc CG_ScoresUp_f 0 0
+proc CG_TellTarget_f 264 20
+ADDRLP4 260
+ADDRGP4 CG_CrosshairPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 260
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $124
+ADDRGP4 $123
+JUMPV
+LABELV $124
+ADDRLP4 132
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Args
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $126
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 132
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $123
+endproc CG_TellTarget_f 264 20
+proc CG_TellAttacker_f 264 20
+ADDRLP4 260
+ADDRGP4 CG_LastAttacker
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 260
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $128
+ADDRGP4 $127
+JUMPV
+LABELV $128
+ADDRLP4 132
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Args
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $126
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 132
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $127
+endproc CG_TellAttacker_f 264 20
+proc CG_VoiceTellTarget_f 264 20
+ADDRLP4 260
+ADDRGP4 CG_CrosshairPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 260
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $131
+ADDRGP4 $130
+JUMPV
+LABELV $131
+ADDRLP4 132
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Args
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $133
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 132
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $130
+endproc CG_VoiceTellTarget_f 264 20
+proc CG_VoiceTellAttacker_f 264 20
+ADDRLP4 260
+ADDRGP4 CG_LastAttacker
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 260
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $135
+ADDRGP4 $134
+JUMPV
+LABELV $135
+ADDRLP4 132
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Args
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $133
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 132
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $134
+endproc CG_VoiceTellAttacker_f 264 20
+proc CG_StartOrbit_f 1028 12
+ADDRGP4 $138
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1024
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1024
+INDIRI4
+CNSTI4 0
+NEI4 $139
+ADDRGP4 $137
+JUMPV
+LABELV $139
+ADDRGP4 cg_cameraOrbit+8
+INDIRF4
+CNSTF4 0
+EQF4 $141
+ADDRGP4 $144
+ARGP4
+ADDRGP4 $145
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $146
+ARGP4
+ADDRGP4 $145
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $142
+JUMPV
+LABELV $141
+ADDRGP4 $144
+ARGP4
+ADDRGP4 $147
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $146
+ARGP4
+ADDRGP4 $148
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $149
+ARGP4
+ADDRGP4 $145
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $150
+ARGP4
+ADDRGP4 $151
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $142
+LABELV $137
+endproc CG_StartOrbit_f 1028 12
+proc CG_ReChooseLogo_f 0 0
+ADDRGP4 cg+107636
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+107640
+ADDRGP4 cg+107620
+INDIRI4
+CNSTI4 1000
+ADDI4
+ASGNI4
+LABELV $152
+endproc CG_ReChooseLogo_f 0 0
+data
+align 4
+LABELV $157
+address $158
+address $159
+address $160
+address $161
+address $162
+address $163
+address $164
+address $165
+address $166
+byte 4 0
+code
+proc CG_HelpCmd_f 272 12
+ADDRLP4 256
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 0
+GTI4 $167
+ADDRGP4 $169
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $170
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $156
+JUMPV
+LABELV $167
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_Args
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $173
+ARGP4
+ADDRLP4 260
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $171
+ADDRGP4 $174
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 264
+CNSTI4 0
+ASGNI4
+ADDRGP4 $178
+JUMPV
+LABELV $175
+ADDRGP4 $179
+ARGP4
+ADDRLP4 264
+INDIRI4
+ARGI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $157
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $176
+ADDRLP4 264
+ADDRLP4 264
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $178
+ADDRLP4 264
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $157
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $175
+LABELV $171
+LABELV $156
+endproc CG_HelpCmd_f 272 12
+proc CG_DropCartridge_f 0 4
+ADDRGP4 $181
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $180
+endproc CG_DropCartridge_f 0 4
+proc CG_Cam 4 0
+ADDRGP4 cg+132384
+INDIRI4
+CNSTI4 0
+EQI4 $186
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $187
+JUMPV
+LABELV $186
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $187
+ADDRGP4 cg+132384
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+132360
+ADDRGP4 cg+110648+24
+INDIRB
+ASGNB 12
+ADDRGP4 cg+132372
+ADDRGP4 cg+111016
+INDIRB
+ASGNB 12
+LABELV $182
+endproc CG_Cam 4 0
+export Cmd_SetFreecamPos_f
+proc Cmd_SetFreecamPos_f 1072 12
+ADDRLP4 1052
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 3
+GEI4 $194
+ADDRGP4 $196
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $193
+JUMPV
+LABELV $194
+ADDRLP4 1056
+CNSTF4 0
+ASGNF4
+ADDRLP4 1040+8
+ADDRLP4 1056
+INDIRF4
+ASGNF4
+ADDRLP4 1040+4
+ADDRLP4 1056
+INDIRF4
+ASGNF4
+ADDRLP4 1040
+ADDRLP4 1056
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $199
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1060
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1028
+ADDP4
+ADDRLP4 1060
+INDIRF4
+ASGNF4
+LABELV $200
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $199
+CNSTI4 5
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1060
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 1040+4
+ADDRLP4 1060
+INDIRF4
+ASGNF4
+CNSTI4 4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1064
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 1040
+ADDRLP4 1064
+INDIRF4
+ASGNF4
+CNSTI4 6
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1068
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 1040+8
+ADDRLP4 1068
+INDIRF4
+ASGNF4
+ADDRGP4 cg+132360
+ADDRLP4 1028
+INDIRB
+ASGNB 12
+ADDRGP4 cg+132372
+ADDRLP4 1040
+INDIRB
+ASGNB 12
+LABELV $193
+endproc Cmd_SetFreecamPos_f 1072 12
+data
+align 4
+LABELV commands
+address $208
+address CG_TestGun_f
+address $209
+address CG_TestModel_f
+address $210
+address CG_TestModelNextFrame_f
+address $211
+address CG_TestModelPrevFrame_f
+address $212
+address CG_TestModelNextSkin_f
+address $213
+address CG_TestModelPrevSkin_f
+address $214
+address CG_Viewpos_f
+address $215
+address CG_ScoresDown_f
+address $216
+address CG_ScoresUp_f
+address $217
+address CG_ZoomDown_f
+address $218
+address CG_ZoomUp_f
+address $219
+address CG_SizeUp_f
+address $220
+address CG_SizeDown_f
+address $221
+address CG_NextWeapon_f
+address $222
+address CG_PrevWeapon_f
+address $223
+address CG_Weapon_f
+address $224
+address CG_TargetCommand_f
+address $225
+address CG_TellTarget_f
+address $226
+address CG_TellAttacker_f
+address $227
+address CG_VoiceTellTarget_f
+address $228
+address CG_VoiceTellAttacker_f
+address $229
+address CG_StartOrbit_f
+address $230
+address CG_LoadDeferredPlayers
+address $231
+address CG_HelpCmd_f
+address $232
+address CG_ReChooseLogo_f
+address $233
+address CG_DropCartridge_f
+address $234
+address CG_DropCartridge_f
+address $235
+address Cmd_SetFreecamPos_f
+address $236
+address CG_Cam
+address $237
+address DumpPolyInfo
+export CG_ConsoleCommand
+code
+proc CG_ConsoleCommand 16 8
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $242
+JUMPV
+LABELV $239
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $243
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 commands+4
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $238
+JUMPV
+LABELV $243
+LABELV $240
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $242
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 30
+LTU4 $239
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 CG_Cutscene2d_CheckCmd
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $246
+CNSTI4 1
+RETI4
+ADDRGP4 $238
+JUMPV
+LABELV $246
+CNSTI4 0
+RETI4
+LABELV $238
+endproc CG_ConsoleCommand 16 8
+export CG_InitConsoleCommands
+proc CG_InitConsoleCommands 4 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $252
+JUMPV
+LABELV $249
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+LABELV $250
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $252
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 30
+LTU4 $249
+ADDRGP4 $253
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $254
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $255
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $256
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $257
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $258
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $259
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $260
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $261
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $262
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $263
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $264
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $265
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $266
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $267
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $268
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $269
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $270
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $271
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $272
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $273
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $232
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $274
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $275
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $233
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $234
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $231
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $237
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+LABELV $248
+endproc CG_InitConsoleCommands 4 4
+import CG_AddBoundingBox
+import CG_AddBoundingBoxEntity
+import CG_QueryCvar
+import CG_Timestamp
+import CG_LimitCvars
+import trap_RealTime
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import trap_R_inPVS
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_Cutscene2d_Draw
+import CG_Cutscene2d_UpdateTrans
+import CG_Cutscene2d_CheckCmd
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import Main_SpriteParticles
+import LaunchRevivalParticle
+import LaunchSpeedyPuffTrail
+import Init_SpriteParticles
+import AddLFsToScreen
+import AddLFToDrawList
+import Init_LensFlareSys
+import DumpPolyInfo
+import ActiveChooseLogoMenu
+import FindLogoForSpraying
+import Add_LogoToDrawList
+import AddLogosToScene
+import Init_SprayLogoSys
+import Calculate_2DOfDIR
+import Calculate_2DOf3D
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_ChangeLoadingProgress
+import CG_LoadingString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_ScorePlum
+import CG_TeleOutEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_GenerateParticles
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_PortalInView
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_GetWaterMuzzle
+import CG_SprayTrail
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponSRWC
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_Boomies_Explosion
+import CG_BamBam_Explosion
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_LerpTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayer
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_UpdateVoipTeamIDs
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Draw3DModel
+import CG_SetPrintString
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import CG_MessagePrint
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_WorldToScreen
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_DrawPic1024
+import CG_DrawRect1024
+import CG_FillRect1024
+import CG_AdjustFrom1024
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddPolyBatched
+import CG_AddRefEntityBatched
+import CG_FlushSceneBatches
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_ForceModelChange
+import CG_GetCvarFloat
+import CG_GetCvarInt
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StreamAssets
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_icons
+import cg_ambient
+import cg_drawBBox
+import cg_drawVoiceNames
+import cg_drawLensflare
+import cg_timestamps
+import cg_skyLensflare
+import cg_sky
+import cg_curWarmupReady
+import cg_warmupReady
+import cg_glowModelTeam
+import cg_glowModel
+import cg_cineDrawLetterBox
+import cg_cineHideHud
+import cg_LPSwallhackAlpha
+import cg_LPSwallhackSize
+import cg_bigScoreType
+import cg_thirdPersonAutoSwitch
+import cg_drawTimeLeft
+import cg_drawServerInfos
+import cg_drawMessages
+import cg_drawups
+import cg_wopFFAhud
+import cg_printDir
+import cg_drawRealTime
+import cg_correctedWeaponPos
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_streamAssets
+import cg_deferPlayers
+import cg_predictItems
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_chatBeep
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_optimizePrediction
+import cg_nopredict
+import cg_errorDecay
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import trailEnt
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $275
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 82
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 0
+align 1
+LABELV $274
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 0
+align 1
+LABELV $273
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $272
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $271
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $270
+byte 1 99
+byte 1 118
+byte 1 0
+align 1
+LABELV $269
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $268
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $267
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $266
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $265
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 0
+align 1
+LABELV $264
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $263
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $262
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $261
+byte 1 119
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $260
+byte 1 110
+byte 1 111
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $259
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $258
+byte 1 103
+byte 1 111
+byte 1 100
+byte 1 0
+align 1
+LABELV $257
+byte 1 103
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $256
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $255
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $254
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $253
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $237
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 100
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $236
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $235
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $234
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 0
+align 1
+LABELV $233
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 67
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $232
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 104
+byte 1 111
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 0
+align 1
+LABELV $231
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 0
+align 1
+LABELV $230
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $229
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 79
+byte 1 114
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $228
+byte 1 118
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $227
+byte 1 118
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $226
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $225
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $224
+byte 1 116
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 0
+align 1
+LABELV $223
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $222
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 0
+align 1
+LABELV $221
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $220
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $219
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $218
+byte 1 45
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $217
+byte 1 43
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $216
+byte 1 45
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $215
+byte 1 43
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $214
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $213
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $212
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $211
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $210
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $209
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $208
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $196
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 32
+byte 1 120
+byte 1 32
+byte 1 121
+byte 1 32
+byte 1 122
+byte 1 32
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 121
+byte 1 97
+byte 1 119
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 10
+byte 1 0
+align 1
+LABELV $181
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 49
+byte 1 50
+byte 1 59
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 49
+byte 1 50
+byte 1 10
+byte 1 0
+align 1
+LABELV $179
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 32
+byte 1 45
+byte 1 62
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $174
+byte 1 71
+byte 1 84
+byte 1 35
+byte 1 32
+byte 1 45
+byte 1 62
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 10
+byte 1 0
+align 1
+LABELV $173
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $170
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $169
+byte 1 97
+byte 1 118
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 58
+byte 1 10
+byte 1 0
+align 1
+LABELV $166
+byte 1 66
+byte 1 105
+byte 1 103
+byte 1 32
+byte 1 66
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $165
+byte 1 83
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $164
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 84
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 76
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $163
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $162
+byte 1 76
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 80
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $161
+byte 1 83
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $160
+byte 1 83
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $159
+byte 1 84
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $158
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $151
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $150
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 82
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $149
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 65
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $148
+byte 1 49
+byte 1 0
+align 1
+LABELV $147
+byte 1 53
+byte 1 0
+align 1
+LABELV $146
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $145
+byte 1 48
+byte 1 0
+align 1
+LABELV $144
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 79
+byte 1 114
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $138
+byte 1 100
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $133
+byte 1 118
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $126
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $109
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $91
+byte 1 40
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 41
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $86
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $85
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $83
+byte 1 103
+byte 1 99
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
@@ -0,0 +1,4494 @@
+data
+align 4
+LABELV cutscene2d_initialized
+byte 4 0
+code
+proc isPicHandleOK 8 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $86
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+GEI4 $86
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $87
+JUMPV
+LABELV $86
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $87
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $84
+endproc isPicHandleOK 8 0
+proc csPicByHandle 4 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 isPicHandleOK
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $89
+CNSTI4 328
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_cutscene2d
+ADDP4
+RETP4
+ADDRGP4 $88
+JUMPV
+LABELV $89
+CNSTP4 0
+RETP4
+LABELV $88
+endproc csPicByHandle 4 4
+proc Cutscene2d_setPicDefault 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 316
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 320
+ADDP4
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 20
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 28
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+LABELV $91
+endproc Cutscene2d_setPicDefault 32 0
+proc Cutscene2d_ResetPic 12 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 isPicHandleOK
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $93
+CNSTI4 328
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_cutscene2d
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 328
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTI4 328
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_cutscene2d
+ADDP4
+ARGP4
+ADDRGP4 Cutscene2d_setPicDefault
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $95
+ADDRLP4 8
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg_cutscene2d+5248
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $100
+ADDRLP4 8
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $100
+LABELV $96
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+LTI4 $95
+LABELV $93
+LABELV $92
+endproc Cutscene2d_ResetPic 12 12
+proc Cutscene2d_ResetAll 4 12
+ADDRGP4 cg_cutscene2d
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 5632
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $103
+CNSTI4 328
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_cutscene2d
+ADDP4
+ARGP4
+ADDRGP4 Cutscene2d_setPicDefault
+CALLV
+pop
+LABELV $104
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $103
+LABELV $102
+endproc Cutscene2d_ResetAll 4 12
+export CG_Cutscene2d_Init
+proc CG_Cutscene2d_Init 0 0
+ADDRGP4 cutscene2d_initialized
+INDIRI4
+CNSTI4 0
+EQI4 $108
+ADDRGP4 $107
+JUMPV
+LABELV $108
+ADDRGP4 Cutscene2d_ResetAll
+CALLV
+pop
+ADDRGP4 cutscene2d_initialized
+CNSTI4 1
+ASGNI4
+LABELV $107
+endproc CG_Cutscene2d_Init 0 0
+export CG_Cutscene2d_Draw
+proc CG_Cutscene2d_Draw 40 36
+ADDRGP4 CG_Cutscene2d_Init
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $111
+ADDRLP4 4
+CNSTI4 328
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_cutscene2d
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 324
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $115
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $117
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+LABELV $119
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $122
+ARGP4
+ADDRLP4 24
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $123
+ADDRLP4 12
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $123
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRF4
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 32
+ADDRLP4 4
+INDIRP4
+CNSTI4 320
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 312
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ADDRLP4 32
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 316
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $125
+ADDRLP4 12
+INDIRP4
+CNSTI1 92
+ASGNI1
+ADDRLP4 16
+ADDRLP4 12
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+LABELV $125
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $120
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $119
+LABELV $117
+LABELV $115
+LABELV $112
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $111
+LABELV $110
+endproc CG_Cutscene2d_Draw 40 36
+export CG_Cutscene2d_UpdateTrans
+proc CG_Cutscene2d_UpdateTrans 76 4
+ADDRGP4 CG_Cutscene2d_Init
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $128
+ADDRLP4 4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_cutscene2d+5248
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $133
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 isPicHandleOK
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $135
+ADDRLP4 4
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $129
+JUMPV
+LABELV $135
+ADDRLP4 12
+CNSTI4 328
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_cutscene2d
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+GEI4 $137
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $138
+JUMPV
+LABELV $137
+ADDRLP4 8
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $138
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GTI4 $141
+ADDRGP4 $129
+JUMPV
+LABELV $141
+ADDRLP4 28
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+EQI4 $146
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+EQI4 $147
+ADDRLP4 28
+INDIRI4
+CNSTI4 3
+EQI4 $148
+ADDRGP4 $144
+JUMPV
+LABELV $146
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $144
+JUMPV
+LABELV $147
+ADDRLP4 44
+CNSTI4 8
+ASGNI4
+ADDRLP4 48
+ADDRLP4 12
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 52
+CNSTI4 12
+ASGNI4
+ADDRLP4 56
+ADDRLP4 12
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $144
+JUMPV
+LABELV $148
+ADDRLP4 60
+ADDRLP4 12
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+LEF4 $149
+ADDRLP4 12
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $149
+ADDRLP4 12
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $151
+ADDRLP4 12
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $151
+ADDRLP4 64
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+LEF4 $153
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $153
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $155
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $155
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 72
+INDIRF4
+NEF4 $144
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ADDRLP4 72
+INDIRF4
+NEF4 $144
+ADDRLP4 12
+INDIRP4
+CNSTI4 324
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $144
+ADDRLP4 36
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LEI4 $159
+ADDRLP4 36
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+GEI4 $159
+ADDRLP4 4
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $159
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+LABELV $133
+LABELV $129
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $128
+LABELV $127
+endproc CG_Cutscene2d_UpdateTrans 76 4
+proc getFreeTransformation 4 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $164
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_cutscene2d+5248
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $168
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_cutscene2d+5248
+ADDP4
+RETP4
+ADDRGP4 $163
+JUMPV
+LABELV $168
+LABELV $165
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $164
+CNSTP4 0
+RETP4
+LABELV $163
+endproc getFreeTransformation 4 0
+export CG_Cutscene2d_CheckCmd
+proc CG_Cutscene2d_CheckCmd 104 12
+ADDRGP4 CG_Cutscene2d_Init
+CALLV
+pop
+ADDRLP4 8
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $175
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $173
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $176
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $180
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $178
+ADDRGP4 Cutscene2d_ResetAll
+CALLV
+pop
+ADDRGP4 $177
+JUMPV
+LABELV $178
+CNSTI4 1
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 isPicHandleOK
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $177
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRGP4 Cutscene2d_ResetPic
+CALLV
+pop
+ADDRGP4 $177
+JUMPV
+LABELV $176
+ADDRGP4 $183
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $177
+CNSTI4 1
+RETI4
+ADDRGP4 $172
+JUMPV
+LABELV $173
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $186
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $184
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+NEI4 $187
+CNSTI4 1
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 csPicByHandle
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $188
+CNSTI4 2
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+CNSTI4 3
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+CNSTI4 4
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+CNSTI4 5
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+CNSTI4 6
+ARGI4
+ADDRLP4 64
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 324
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $188
+JUMPV
+LABELV $187
+ADDRGP4 $191
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $188
+CNSTI4 1
+RETI4
+ADDRGP4 $172
+JUMPV
+LABELV $184
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $194
+ARGP4
+CNSTI4 11
+ARGI4
+ADDRLP4 20
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $192
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $195
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $198
+CNSTI4 1
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 csPicByHandle
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $199
+CNSTI4 2
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 $199
+JUMPV
+LABELV $198
+ADDRGP4 $202
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $199
+CNSTI4 1
+RETI4
+ADDRGP4 $172
+JUMPV
+LABELV $195
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $203
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $206
+CNSTI4 1
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 csPicByHandle
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $207
+CNSTI4 2
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $211
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRGP4 $212
+JUMPV
+LABELV $211
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+LABELV $212
+ADDRLP4 4
+INDIRP4
+CNSTI4 324
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 $207
+JUMPV
+LABELV $206
+ADDRGP4 $213
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $207
+CNSTI4 1
+RETI4
+ADDRGP4 $172
+JUMPV
+LABELV $203
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $216
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $214
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+NEI4 $217
+CNSTI4 1
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 csPicByHandle
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $218
+CNSTI4 2
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+CNSTI4 3
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRGP4 $218
+JUMPV
+LABELV $217
+ADDRGP4 $221
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $218
+CNSTI4 1
+RETI4
+ADDRGP4 $172
+JUMPV
+LABELV $214
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $224
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $222
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+NEI4 $225
+CNSTI4 1
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 csPicByHandle
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $226
+CNSTI4 2
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+CNSTI4 3
+ARGI4
+ADDRLP4 60
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRGP4 $226
+JUMPV
+LABELV $225
+ADDRGP4 $229
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $226
+CNSTI4 1
+RETI4
+ADDRGP4 $172
+JUMPV
+LABELV $222
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $232
+ARGP4
+ADDRLP4 40
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $230
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LTI4 $233
+CNSTI4 1
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 csPicByHandle
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $234
+CNSTI4 2
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+CNSTI4 3
+ARGI4
+ADDRLP4 64
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 68
+INDIRF4
+ASGNF4
+CNSTI4 4
+ARGI4
+ADDRLP4 72
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $234
+CNSTI4 5
+ARGI4
+ADDRLP4 80
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRGP4 $234
+JUMPV
+LABELV $233
+ADDRGP4 $239
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $234
+CNSTI4 1
+RETI4
+ADDRGP4 $172
+JUMPV
+LABELV $230
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $242
+ARGP4
+ADDRLP4 44
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $240
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $243
+CNSTI4 1
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 csPicByHandle
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $244
+CNSTI4 2
+ARGI4
+ADDRLP4 60
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $244
+JUMPV
+LABELV $243
+ADDRGP4 $247
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 255
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $244
+CNSTI4 1
+RETI4
+ADDRGP4 $172
+JUMPV
+LABELV $240
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $250
+ARGP4
+ADDRLP4 48
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $248
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+NEI4 $251
+CNSTI4 1
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 csPicByHandle
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $252
+CNSTI4 2
+ARGI4
+ADDRLP4 64
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 308
+ADDP4
+ADDRLP4 68
+INDIRF4
+ASGNF4
+CNSTI4 3
+ARGI4
+ADDRLP4 72
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRGP4 $252
+JUMPV
+LABELV $251
+ADDRGP4 $221
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $252
+CNSTI4 1
+RETI4
+ADDRGP4 $172
+JUMPV
+LABELV $248
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $257
+ARGP4
+ADDRLP4 52
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $255
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+NEI4 $258
+CNSTI4 1
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 csPicByHandle
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 64
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $259
+CNSTI4 2
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 316
+ADDP4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+CNSTI4 3
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 320
+ADDP4
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRGP4 $259
+JUMPV
+LABELV $258
+ADDRGP4 $262
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $259
+CNSTI4 1
+RETI4
+ADDRGP4 $172
+JUMPV
+LABELV $255
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $265
+ARGP4
+ADDRLP4 56
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $193
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LTI4 $266
+CNSTI4 1
+ARGI4
+ADDRLP4 60
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 csPicByHandle
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $267
+CNSTI4 2
+ARGI4
+ADDRLP4 72
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 76
+INDIRF4
+ASGNF4
+CNSTI4 3
+ARGI4
+ADDRLP4 80
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 84
+INDIRF4
+ASGNF4
+CNSTI4 4
+ARGI4
+ADDRLP4 88
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 92
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $267
+CNSTI4 5
+ARGI4
+ADDRLP4 96
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRLP4 100
+INDIRF4
+ASGNF4
+ADDRGP4 $267
+JUMPV
+LABELV $266
+ADDRGP4 $239
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $267
+CNSTI4 1
+RETI4
+ADDRGP4 $172
+JUMPV
+LABELV $192
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $274
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 24
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $272
+ADDRLP4 32
+ADDRGP4 getFreeTransformation
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $275
+ADDRGP4 $277
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $172
+JUMPV
+LABELV $275
+ADDRLP4 28
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $281
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $279
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+NEI4 $282
+CNSTI4 1
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 csPicByHandle
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $283
+CNSTI4 4
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 1
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRLP4 64
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 68
+INDIRF4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 52
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+CNSTI4 3
+ARGI4
+ADDRLP4 72
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ADDRLP4 52
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 52
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $283
+JUMPV
+LABELV $282
+ADDRGP4 $287
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $283
+CNSTI4 1
+RETI4
+ADDRGP4 $172
+JUMPV
+LABELV $279
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $290
+ARGP4
+ADDRLP4 40
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $288
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+NEI4 $291
+CNSTI4 1
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 csPicByHandle
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $292
+CNSTI4 4
+ARGI4
+ADDRLP4 60
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 2
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 76
+INDIRF4
+MULF4
+ADDRLP4 76
+INDIRF4
+SUBF4
+ADDRLP4 56
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+CNSTI4 3
+ARGI4
+ADDRLP4 80
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 88
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 88
+INDIRF4
+MULF4
+ADDRLP4 88
+INDIRF4
+SUBF4
+ADDRLP4 56
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 56
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $292
+JUMPV
+LABELV $291
+ADDRGP4 $296
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $292
+CNSTI4 1
+RETI4
+ADDRGP4 $172
+JUMPV
+LABELV $288
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $299
+ARGP4
+ADDRLP4 44
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $297
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+NEI4 $300
+CNSTI4 1
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 csPicByHandle
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $301
+CNSTI4 4
+ARGI4
+ADDRLP4 64
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 2
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRLP4 72
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 60
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+CNSTI4 3
+ARGI4
+ADDRLP4 80
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 60
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 60
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $301
+JUMPV
+LABELV $300
+ADDRGP4 $305
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $301
+CNSTI4 1
+RETI4
+ADDRGP4 $172
+JUMPV
+LABELV $297
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $308
+ARGP4
+ADDRLP4 48
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $306
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $309
+CNSTI4 1
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 csPicByHandle
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $310
+CNSTI4 2
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+NEGF4
+ADDRLP4 64
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+NEGF4
+ADDRLP4 64
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 64
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $310
+JUMPV
+LABELV $309
+ADDRGP4 $314
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $310
+CNSTI4 1
+RETI4
+ADDRGP4 $172
+JUMPV
+LABELV $306
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $317
+ARGP4
+ADDRLP4 52
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $315
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $318
+CNSTI4 1
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 csPicByHandle
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 64
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $319
+CNSTI4 2
+ARGI4
+ADDRLP4 72
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 68
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 324
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $319
+JUMPV
+LABELV $318
+ADDRGP4 $314
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $319
+CNSTI4 1
+RETI4
+ADDRGP4 $172
+JUMPV
+LABELV $315
+LABELV $272
+LABELV $193
+CNSTI4 0
+RETI4
+LABELV $172
+endproc CG_Cutscene2d_CheckCmd 104 12
+bss
+align 4
+LABELV cg_cutscene2d
+skip 5632
+import CG_AddBoundingBox
+import CG_AddBoundingBoxEntity
+import CG_QueryCvar
+import CG_Timestamp
+import CG_LimitCvars
+import trap_RealTime
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import trap_R_inPVS
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import Main_SpriteParticles
+import LaunchRevivalParticle
+import LaunchSpeedyPuffTrail
+import Init_SpriteParticles
+import AddLFsToScreen
+import AddLFToDrawList
+import Init_LensFlareSys
+import DumpPolyInfo
+import ActiveChooseLogoMenu
+import FindLogoForSpraying
+import Add_LogoToDrawList
+import AddLogosToScene
+import Init_SprayLogoSys
+import Calculate_2DOfDIR
+import Calculate_2DOf3D
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_ChangeLoadingProgress
+import CG_LoadingString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_ScorePlum
+import CG_TeleOutEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_GenerateParticles
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_PortalInView
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_GetWaterMuzzle
+import CG_SprayTrail
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponSRWC
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_Boomies_Explosion
+import CG_BamBam_Explosion
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_LerpTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayer
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_UpdateVoipTeamIDs
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Draw3DModel
+import CG_SetPrintString
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import CG_MessagePrint
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_WorldToScreen
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_DrawPic1024
+import CG_DrawRect1024
+import CG_FillRect1024
+import CG_AdjustFrom1024
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddPolyBatched
+import CG_AddRefEntityBatched
+import CG_FlushSceneBatches
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_ForceModelChange
+import CG_GetCvarFloat
+import CG_GetCvarInt
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StreamAssets
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_icons
+import cg_ambient
+import cg_drawBBox
+import cg_drawVoiceNames
+import cg_drawLensflare
+import cg_timestamps
+import cg_skyLensflare
+import cg_sky
+import cg_curWarmupReady
+import cg_warmupReady
+import cg_glowModelTeam
+import cg_glowModel
+import cg_cineDrawLetterBox
+import cg_cineHideHud
+import cg_LPSwallhackAlpha
+import cg_LPSwallhackSize
+import cg_bigScoreType
+import cg_thirdPersonAutoSwitch
+import cg_drawTimeLeft
+import cg_drawServerInfos
+import cg_drawMessages
+import cg_drawups
+import cg_wopFFAhud
+import cg_printDir
+import cg_drawRealTime
+import cg_correctedWeaponPos
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_streamAssets
+import cg_deferPlayers
+import cg_predictItems
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_chatBeep
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_optimizePrediction
+import cg_nopredict
+import cg_errorDecay
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import trailEnt
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $317
+byte 1 99
+byte 1 115
+byte 1 50
+byte 1 100
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 70
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 73
+byte 1 110
+byte 1 0
+align 1
+LABELV $314
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 91
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 73
+byte 1 68
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $308
+byte 1 99
+byte 1 115
+byte 1 50
+byte 1 100
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 70
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 79
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $305
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 91
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 73
+byte 1 68
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 100
+byte 1 87
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 100
+byte 1 72
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $299
+byte 1 99
+byte 1 115
+byte 1 50
+byte 1 100
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $296
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 91
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 73
+byte 1 68
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 119
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 104
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $290
+byte 1 99
+byte 1 115
+byte 1 50
+byte 1 100
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 82
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $287
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 91
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 73
+byte 1 68
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 120
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 121
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $281
+byte 1 99
+byte 1 115
+byte 1 50
+byte 1 100
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 77
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 84
+byte 1 111
+byte 1 0
+align 1
+LABELV $277
+byte 1 91
+byte 1 67
+byte 1 117
+byte 1 116
+byte 1 83
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 50
+byte 1 68
+byte 1 93
+byte 1 32
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 45
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $274
+byte 1 99
+byte 1 115
+byte 1 50
+byte 1 100
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $265
+byte 1 99
+byte 1 115
+byte 1 50
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $262
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 91
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 73
+byte 1 68
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 119
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 119
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $257
+byte 1 99
+byte 1 115
+byte 1 50
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $250
+byte 1 99
+byte 1 115
+byte 1 50
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 79
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $247
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 91
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 73
+byte 1 68
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 40
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 46
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 109
+byte 1 41
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $242
+byte 1 99
+byte 1 115
+byte 1 50
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $239
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 91
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 73
+byte 1 68
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 114
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 103
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 98
+byte 1 93
+byte 1 32
+byte 1 40
+byte 1 91
+byte 1 97
+byte 1 93
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $232
+byte 1 99
+byte 1 115
+byte 1 50
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $229
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 91
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 73
+byte 1 68
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 119
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 104
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $224
+byte 1 99
+byte 1 115
+byte 1 50
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $221
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 91
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 73
+byte 1 68
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 120
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 121
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $216
+byte 1 99
+byte 1 115
+byte 1 50
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 80
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $213
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 91
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 73
+byte 1 68
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 108
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $205
+byte 1 99
+byte 1 115
+byte 1 50
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $202
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 91
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 73
+byte 1 68
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $197
+byte 1 99
+byte 1 115
+byte 1 50
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $194
+byte 1 99
+byte 1 115
+byte 1 50
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 0
+align 1
+LABELV $191
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 91
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 73
+byte 1 68
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 120
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 121
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 119
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 104
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $186
+byte 1 99
+byte 1 115
+byte 1 50
+byte 1 100
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 0
+align 1
+LABELV $183
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 91
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 124
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 73
+byte 1 68
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $180
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $175
+byte 1 99
+byte 1 115
+byte 1 50
+byte 1 100
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $122
+byte 1 92
+byte 1 110
+byte 1 0
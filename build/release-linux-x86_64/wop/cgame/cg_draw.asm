@@ -0,0 +1,17878 @@
+export CG_Draw3DModel
+code
+proc CG_Draw3DModel 508 16
+ADDRFP4 32
+ADDRFP4 32
+INDIRF4
+ASGNF4
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 368
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0+28
+ADDRLP4 0+28
+INDIRF4
+ADDRFP4 32
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+4
+ADDRLP4 0+28+4
+INDIRF4
+ADDRFP4 32
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+8
+ADDRLP4 0+28+8
+INDIRF4
+ADDRFP4 32
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12
+ADDRLP4 0+28+12
+INDIRF4
+ADDRFP4 32
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+4
+ADDRLP4 0+28+12+4
+INDIRF4
+ADDRFP4 32
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+8
+ADDRLP4 0+28+12+8
+INDIRF4
+ADDRFP4 32
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24
+ADDRLP4 0+28+24
+INDIRF4
+ADDRFP4 32
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+4
+ADDRLP4 0+28+24+4
+INDIRF4
+ADDRFP4 32
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+8
+ADDRLP4 0+28+24+8
+INDIRF4
+ADDRFP4 32
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+68
+ADDRFP4 24
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0+108
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0+4
+CNSTI4 64
+ASGNI4
+ADDRFP4 36
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $107
+ADDRLP4 0+116
+ARGP4
+ADDRFP4 36
+INDIRP4
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $107
+ADDRLP4 140+76
+CNSTI4 1
+ASGNI4
+ADDRLP4 140+36
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRLP4 140+16
+CNSTF4 1106247680
+ASGNF4
+ADDRLP4 140+20
+CNSTF4 1106247680
+ASGNF4
+ADDRLP4 140
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 140+4
+ADDRFP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 140+8
+ADDRFP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 140+12
+ADDRFP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 140+72
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRGP4 trap_R_ClearScene
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+ADDRGP4 trap_R_RenderScene
+CALLV
+pop
+LABELV $80
+endproc CG_Draw3DModel 508 16
+export CG_DrawHead
+proc CG_DrawHead 56 40
+ADDRLP4 0
+CNSTI4 1836
+ADDRFP4 16
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088
+ADDP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $122
+ADDRGP4 $120
+JUMPV
+LABELV $122
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 trap_R_ModelBounds
+CALLV
+pop
+ADDRLP4 4+8
+CNSTF4 3204448256
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 28+8
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 1056964608
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 44
+CNSTF4 1060320051
+ADDRLP4 28+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 44
+INDIRF4
+CNSTF4 1049179980
+DIVF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1828
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $136
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1832
+ADDP4
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+ADDRGP4 $137
+JUMPV
+LABELV $136
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+INDIRF4
+ARGF4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+LABELV $137
+ADDRLP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $138
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+104
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $138
+LABELV $120
+endproc CG_DrawHead 56 40
+export CG_DrawFlagModel
+proc CG_DrawFlagModel 72 40
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRFP4 20
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $143
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $143
+ADDRLP4 64
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRGP4 cgs+160652+12
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRGP4 trap_R_ModelBounds
+CALLV
+pop
+ADDRLP4 12+8
+CNSTF4 3213675725
+ADDRLP4 24+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 12+4
+CNSTF4 1056964608
+ADDRLP4 24+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 52
+CNSTF4 1056964608
+ADDRLP4 36+8
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 52
+INDIRF4
+CNSTF4 1049179980
+DIVF4
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 1120403456
+ADDRGP4 cg+107612
+INDIRI4
+CVIF4 4
+CNSTF4 1157234688
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 16
+INDIRI4
+CNSTI4 1
+NEI4 $160
+ADDRLP4 56
+ADDRGP4 cgs+160652+12
+INDIRI4
+ASGNI4
+ADDRGP4 $161
+JUMPV
+LABELV $160
+ADDRFP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $164
+ADDRLP4 56
+ADDRGP4 cgs+160652+16
+INDIRI4
+ASGNI4
+ADDRGP4 $165
+JUMPV
+LABELV $164
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $142
+ADDRLP4 56
+ADDRGP4 cgs+160652+20
+INDIRI4
+ASGNI4
+LABELV $169
+LABELV $165
+LABELV $161
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTF4 1066611507
+ARGF4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+ADDRGP4 $144
+JUMPV
+LABELV $143
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $172
+ADDRFP4 16
+INDIRI4
+CNSTI4 1
+NEI4 $175
+CNSTI4 8
+ARGI4
+ADDRLP4 68
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRGP4 $176
+JUMPV
+LABELV $175
+ADDRFP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $142
+CNSTI4 9
+ARGI4
+ADDRLP4 68
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 68
+INDIRP4
+ASGNP4
+LABELV $178
+LABELV $176
+ADDRLP4 64
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $179
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 64
+INDIRP4
+CVPU4 4
+ADDRGP4 bg_itemlist
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 52
+DIVI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $179
+LABELV $172
+LABELV $144
+LABELV $142
+endproc CG_DrawFlagModel 72 40
+export CG_DrawTeamBackground
+proc CG_DrawTeamBackground 20 20
+ADDRLP4 0+12
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRI4
+CNSTI4 1
+NEI4 $184
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $185
+JUMPV
+LABELV $184
+ADDRFP4 20
+INDIRI4
+CNSTI4 2
+NEI4 $182
+ADDRLP4 16
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1065353216
+ASGNF4
+LABELV $189
+LABELV $185
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cgs+160652+8
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $182
+endproc CG_DrawTeamBackground 20 20
+proc CG_DrawAttacker 52 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 cg+108604+184
+INDIRI4
+CNSTI4 0
+GTI4 $195
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $194
+JUMPV
+LABELV $195
+ADDRGP4 cg+131564
+INDIRI4
+CNSTI4 0
+NEI4 $199
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $194
+JUMPV
+LABELV $199
+ADDRLP4 0
+ADDRGP4 cg+108604+248+24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $209
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+GEI4 $209
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $205
+LABELV $209
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $194
+JUMPV
+LABELV $205
+CNSTI4 1836
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $210
+ADDRGP4 cg+131564
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $194
+JUMPV
+LABELV $210
+ADDRLP4 24
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 cg+131564
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 10000
+LEI4 $216
+ADDRGP4 cg+131564
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $194
+JUMPV
+LABELV $216
+ADDRLP4 4
+CNSTF4 1114636288
+ASGNF4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 8+4
+CNSTF4 1127481344
+ASGNF4
+ADDRLP4 8+8
+CNSTF4 0
+ASGNF4
+CNSTF4 1142947840
+ADDRLP4 4
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 CG_DrawHead
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 $221
+ARGP4
+ADDRLP4 44
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 Q_PrintStrlen
+CALLI4
+ASGNI4
+CNSTI4 640
+ADDRLP4 48
+INDIRI4
+CNSTI4 4
+LSHI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTF4 1056964608
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1073741824
+ADDF4
+RETF4
+LABELV $194
+endproc CG_DrawAttacker 52 24
+proc CG_DrawSnapshot 16 16
+ADDRGP4 $223
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 cg+36
+INDIRI4
+ARGI4
+ADDRGP4 cgs+31452
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 635
+ADDRLP4 4
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1082130432
+ADDF4
+RETF4
+LABELV $222
+endproc CG_DrawSnapshot 16 16
+bss
+align 4
+LABELV $228
+skip 16
+align 4
+LABELV $229
+skip 4
+align 4
+LABELV $230
+skip 4
+code
+proc CG_DrawFPS 56 16
+ADDRLP4 28
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRGP4 $230
+ASGNP4
+ADDRLP4 12
+ADDRLP4 8
+INDIRI4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $229
+INDIRI4
+CNSTI4 4
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $228
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 40
+ADDRGP4 $229
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 4
+LEI4 $231
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 44
+INDIRI4
+ASGNI4
+LABELV $233
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $228
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $234
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $233
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $237
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $237
+ADDRLP4 24
+CNSTI4 4000
+ADDRLP4 4
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $239
+ARGP4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 52
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 635
+ADDRLP4 20
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $231
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1082130432
+ADDF4
+RETF4
+LABELV $227
+endproc CG_DrawFPS 56 16
+proc CG_DrawTimer 56 16
+ADDRLP4 20
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 cgs+34908
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 60
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 40
+CNSTI4 10
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRGP4 $243
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 52
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 635
+ADDRLP4 16
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1082130432
+ADDF4
+RETF4
+LABELV $240
+endproc CG_DrawTimer 56 16
+proc CG_DrawRealTime 80 28
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_RealTime
+CALLI4
+pop
+ADDRGP4 cg_drawRealTime+12
+INDIRI4
+CNSTI4 2
+NEI4 $245
+ADDRLP4 44
+ARGP4
+ADDRGP4 trap_RealTime
+CALLI4
+pop
+CNSTF4 1134559232
+ARGF4
+CNSTF4 1131413504
+ARGF4
+ADDRGP4 $248
+ARGP4
+ADDRGP4 colorBlue
+ARGP4
+CNSTF4 1098907648
+ARGF4
+CNSTF4 1119092736
+CNSTF4 1135869952
+CNSTF4 1114636288
+ADDRLP4 44+8
+INDIRI4
+CNSTI4 12
+MODI4
+CVIF4 4
+MULF4
+ADDRLP4 44+4
+INDIRI4
+CVIF4 4
+ADDF4
+CNSTF4 1144258560
+DIVF4
+MULF4
+SUBF4
+ARGF4
+CNSTI4 2
+ARGI4
+ADDRGP4 DrawTurnableString
+CALLV
+pop
+CNSTF4 1134559232
+ARGF4
+CNSTF4 1131413504
+ARGF4
+ADDRGP4 $251
+ARGP4
+ADDRGP4 colorGreen
+ARGP4
+CNSTF4 1098907648
+ARGF4
+CNSTF4 1119092736
+CNSTF4 1114636288
+ADDRLP4 44+4
+INDIRI4
+CVIF4 4
+MULF4
+ADDRLP4 44
+INDIRI4
+CVIF4 4
+ADDF4
+CNSTF4 1092616192
+DIVF4
+SUBF4
+ARGF4
+CNSTI4 2
+ARGI4
+ADDRGP4 DrawTurnableString
+CALLV
+pop
+CNSTF4 1134559232
+ARGF4
+CNSTF4 1131413504
+ARGF4
+ADDRGP4 $253
+ARGP4
+ADDRGP4 colorRed
+ARGP4
+CNSTF4 1098907648
+ARGF4
+CNSTF4 1119092736
+CNSTF4 1135869952
+ADDRLP4 44
+INDIRI4
+CVIF4 4
+CNSTF4 1114636288
+DIVF4
+MULF4
+SUBF4
+ARGF4
+CNSTI4 2
+ARGI4
+ADDRGP4 DrawTurnableString
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $244
+JUMPV
+LABELV $245
+ADDRGP4 $254
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 44
+CNSTI4 10
+ASGNI4
+ADDRLP4 0+4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+DIVI4
+ADDRLP4 44
+INDIRI4
+MODI4
+ARGI4
+ADDRLP4 0+4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+MODI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 52
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 635
+ADDRLP4 40
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 36
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1082130432
+ADDF4
+RETF4
+LABELV $244
+endproc CG_DrawRealTime 80 28
+proc CG_Drawups 16 16
+ADDRGP4 $259
+ARGP4
+ADDRGP4 cg+131888
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 635
+ADDRLP4 4
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1082130432
+ADDF4
+RETF4
+LABELV $258
+endproc CG_Drawups 16 16
+lit
+align 4
+LABELV $262
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1056964608
+code
+proc CG_DrawTimeLeft 48 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRGP4 $262
+INDIRB
+ASGNB 16
+ADDRGP4 cgs+31484
+INDIRI4
+CNSTI4 0
+GTI4 $263
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $261
+JUMPV
+LABELV $263
+ADDRLP4 0
+CNSTI4 60000
+ADDRGP4 cgs+31484
+INDIRI4
+MULI4
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 cgs+34908
+INDIRI4
+SUBI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 120000
+LTI4 $269
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+CNSTI1 48
+ASGNI1
+ADDRLP4 21
+CNSTI1 55
+ASGNI1
+ADDRGP4 $270
+JUMPV
+LABELV $269
+ADDRLP4 0
+INDIRI4
+CNSTI4 60000
+LTI4 $273
+ADDRLP4 28
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 60000
+SUBI4
+CVIF4 4
+CNSTF4 1198153728
+DIVF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 28
+INDIRF4
+CNSTI4 120000
+ADDRLP4 0
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1206542336
+DIVF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+CNSTI1 48
+ASGNI1
+ADDRLP4 21
+CNSTI1 55
+ASGNI1
+ADDRGP4 $274
+JUMPV
+LABELV $273
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1206542336
+DIVF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 30000
+GEI4 $279
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 500
+DIVI4
+CNSTI4 2
+MODI4
+CNSTI4 0
+EQI4 $283
+ADDRLP4 28
+CNSTI4 48
+ASGNI4
+ADDRGP4 $284
+JUMPV
+LABELV $283
+ADDRLP4 28
+CNSTI4 55
+ASGNI4
+LABELV $284
+ADDRLP4 20
+ADDRLP4 28
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 500
+DIVI4
+CNSTI4 2
+MODI4
+CNSTI4 0
+EQI4 $287
+ADDRLP4 32
+CNSTI4 55
+ASGNI4
+ADDRGP4 $288
+JUMPV
+LABELV $287
+ADDRLP4 32
+CNSTI4 48
+ASGNI4
+LABELV $288
+ADDRLP4 21
+ADDRLP4 32
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRGP4 $280
+JUMPV
+LABELV $279
+ADDRLP4 20
+CNSTI1 48
+ASGNI1
+ADDRLP4 21
+CNSTI1 55
+ASGNI1
+LABELV $280
+LABELV $274
+LABELV $270
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $289
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+CNSTI1 48
+ASGNI1
+ADDRLP4 21
+CNSTI1 55
+ASGNI1
+LABELV $289
+CNSTF4 1140129792
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+CNSTF4 1125515264
+ARGF4
+CNSTF4 1101004800
+ARGF4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+CNSTF4 1140129792
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+CNSTF4 1125515264
+ARGF4
+CNSTF4 1101004800
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 CG_DrawRect
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $293
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 1000
+DIVI4
+CNSTI4 60
+MODI4
+ASGNI4
+ADDRGP4 $295
+ARGP4
+ADDRLP4 20
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 21
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 60000
+DIVI4
+ARGI4
+ADDRLP4 32
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 10
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 36
+INDIRI4
+DIVI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 36
+INDIRI4
+MODI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 492
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTI4 18
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 $294
+JUMPV
+LABELV $293
+CNSTI4 492
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRGP4 $296
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTI4 18
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $294
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1082130432
+ADDF4
+RETF4
+LABELV $261
+endproc CG_DrawTimeLeft 48 36
+export CG_MessagePrint
+proc CG_MessagePrint 0 12
+ADDRGP4 cg+131416
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+131412
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+LABELV $297
+endproc CG_MessagePrint 0 12
+proc CG_DrawMessages 12 16
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 cg+131412
+INDIRI4
+SUBI4
+CNSTI4 6000
+LEI4 $303
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $302
+JUMPV
+LABELV $303
+ADDRGP4 cg+131416
+ARGP4
+ADDRLP4 8
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+CNSTI4 635
+ADDRLP4 0
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRGP4 cg+131416
+ARGP4
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 cg+131412
+INDIRI4
+SUBI4
+CNSTI4 5000
+GEI4 $314
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $315
+JUMPV
+LABELV $314
+ADDRLP4 4
+ADDRGP4 cg+131412
+INDIRI4
+CNSTI4 5000
+ADDI4
+ADDRGP4 cg+107612
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+LABELV $315
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawSmallString
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1082130432
+ADDF4
+RETF4
+LABELV $302
+endproc CG_DrawMessages 12 16
+data
+export gametype_strs
+align 4
+LABELV gametype_strs
+address $316
+address $317
+address $318
+address $319
+address $320
+address $321
+address $322
+address $323
+address $324
+address $325
+lit
+align 4
+LABELV $327
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1051260355
+data
+align 4
+LABELV $328
+byte 4 0
+code
+proc CG_DrawServerInfos 100 40
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRGP4 $327
+INDIRB
+ASGNB 16
+ADDRGP4 cg_drawServerInfos+12
+INDIRI4
+CNSTI4 0
+NEI4 $329
+ADDRGP4 $328
+INDIRI4
+CNSTI4 0
+LEI4 $332
+ADDRLP4 32
+ADDRGP4 $328
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+ADDRGP4 cg+107608
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ASGNI4
+ADDRGP4 $330
+JUMPV
+LABELV $332
+ADDRGP4 $328
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $326
+JUMPV
+LABELV $329
+ADDRGP4 $328
+INDIRI4
+CNSTI4 150
+GEI4 $335
+ADDRLP4 32
+ADDRGP4 $328
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+ADDRGP4 cg+107608
+INDIRI4
+CNSTI4 2
+DIVI4
+ADDI4
+ASGNI4
+ADDRGP4 $336
+JUMPV
+LABELV $335
+ADDRGP4 $328
+CNSTI4 150
+ASGNI4
+LABELV $336
+LABELV $330
+CNSTI4 4
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $338
+ADDRLP4 8
+CNSTI4 6
+ASGNI4
+ADDRGP4 $339
+JUMPV
+LABELV $338
+ADDRLP4 8
+CNSTI4 5
+ASGNI4
+LABELV $339
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 4
+NEI4 $340
+ADDRGP4 cgs+31780
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $340
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $340
+CNSTI4 640
+ADDRGP4 $328
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+CNSTF4 1125515264
+ARGF4
+ADDRLP4 40
+CNSTI4 4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 40
+INDIRI4
+LSHI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+CNSTI4 640
+ADDRGP4 $328
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+CNSTF4 1125515264
+ARGF4
+ADDRLP4 44
+CNSTI4 4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LSHI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 CG_DrawRect
+CALLV
+pop
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ASGNF4
+CNSTI4 640
+ADDRGP4 $328
+INDIRI4
+SUBI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 cgs+31748
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTI4 18
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $345
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 52
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+GTI4 $347
+CNSTI4 640
+ADDRGP4 $328
+INDIRI4
+SUBI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRLP4 56
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTI4 18
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 $348
+JUMPV
+LABELV $347
+CNSTF4 1142947840
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+MULI4
+CNSTI4 4000
+ADDI4
+MODI4
+CVIF4 4
+CNSTF4 1101004800
+DIVF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+CNSTF4 1090519040
+ARGF4
+CNSTF4 1098907648
+ARGF4
+CNSTI4 640
+ADDRGP4 $328
+INDIRI4
+SUBI4
+CNSTI4 2
+ADDI4
+CVIF4 4
+ARGF4
+CNSTF4 0
+ARGF4
+CNSTF4 1142931456
+ARGF4
+CNSTF4 1139802112
+ARGF4
+ADDRGP4 DrawStringWithCutFrame
+CALLV
+pop
+LABELV $348
+LABELV $345
+CNSTI4 640
+ADDRGP4 $328
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ARGF4
+CNSTF4 1125515264
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ASGNF4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cgs+31464
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $354
+ADDRLP4 0
+INDIRI4
+CNSTI4 9
+LTI4 $352
+LABELV $354
+ADDRLP4 52
+CNSTI4 9
+ASGNI4
+ADDRGP4 $353
+JUMPV
+LABELV $352
+ADDRLP4 52
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $353
+ADDRLP4 0
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRGP4 $355
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 gametype_strs
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 640
+ADDRGP4 $328
+INDIRI4
+SUBI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTI4 18
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRGP4 cgs+31684
+ARGP4
+ADDRLP4 68
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 72
+ADDRLP4 68
+INDIRU4
+CNSTU4 13
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 72
+INDIRI4
+CVIF4 4
+ASGNF4
+CNSTI4 640
+ADDRGP4 $328
+INDIRI4
+SUBI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 $357
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRLP4 76
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTI4 18
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRLP4 12
+INDIRF4
+CNSTF4 0
+LEF4 $358
+CNSTF4 1008981770
+ADDRLP4 12
+INDIRF4
+DIVF4
+ADDRGP4 cg+107612
+INDIRI4
+CVIF4 4
+MULF4
+ARGF4
+ADDRLP4 84
+ADDRGP4 sin
+CALLF4
+ASGNF4
+CNSTI4 640
+ADDRGP4 $328
+INDIRI4
+SUBI4
+CNSTI4 45
+ADDI4
+CVIF4 4
+CNSTF4 1090519040
+ADDRLP4 12
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDRLP4 84
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+MULF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+31684
+ARGP4
+ADDRGP4 colorCyan
+ARGP4
+CNSTF4 1090519040
+ARGF4
+CNSTF4 1098907648
+ARGF4
+CNSTI4 640
+ADDRGP4 $328
+INDIRI4
+SUBI4
+CNSTI4 40
+ADDI4
+CVIF4 4
+ARGF4
+CNSTF4 0
+ARGF4
+CNSTF4 1142931456
+ARGF4
+CNSTF4 1139802112
+ARGF4
+ADDRGP4 DrawStringWithCutFrame
+CALLV
+pop
+ADDRGP4 $359
+JUMPV
+LABELV $358
+CNSTI4 640
+ADDRGP4 $328
+INDIRI4
+SUBI4
+CNSTI4 42
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 cgs+31684
+ARGP4
+ADDRGP4 colorCyan
+ARGP4
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTI4 18
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $359
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 4
+NEI4 $367
+ADDRGP4 cgs+31780
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $363
+LABELV $367
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRGP4 $368
+ARGP4
+ADDRGP4 cgs+31476
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 640
+ADDRGP4 $328
+INDIRI4
+SUBI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTI4 18
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $363
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 4
+NEI4 $370
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRGP4 $373
+ARGP4
+ADDRGP4 cgs+31784
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 640
+ADDRGP4 $328
+INDIRI4
+SUBI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTI4 18
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $370
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRGP4 $375
+ARGP4
+ADDRGP4 cgs+31484
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 640
+ADDRGP4 $328
+INDIRI4
+SUBI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTI4 18
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1073741824
+ADDF4
+RETF4
+LABELV $326
+endproc CG_DrawServerInfos 100 40
+proc CG_DrawBotInfo 1052 16
+ADDRLP4 1028
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ASGNI4
+CNSTI4 25
+ARGI4
+ADDRLP4 1040
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 1036
+ADDRLP4 1040
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 30
+ADDI4
+ASGNI4
+ADDRGP4 $379
+JUMPV
+LABELV $378
+ADDRLP4 1036
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 StringDump_GetNext
+CALLV
+pop
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $381
+ADDRGP4 $380
+JUMPV
+LABELV $381
+ADDRLP4 0
+ARGP4
+ADDRLP4 1044
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 1024
+ADDRLP4 1044
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 1024
+INDIRI4
+CNSTI4 0
+EQI4 $385
+ADDRLP4 1024
+INDIRI4
+CNSTI4 635
+LEI4 $383
+LABELV $385
+ADDRGP4 $380
+JUMPV
+LABELV $383
+ADDRLP4 1032
+CNSTI4 635
+ADDRLP4 1024
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRLP4 1028
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawSmallString
+CALLV
+pop
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 20
+ADDI4
+ASGNI4
+LABELV $379
+ADDRGP4 $378
+JUMPV
+LABELV $380
+ADDRLP4 1028
+INDIRI4
+CVIF4 4
+RETF4
+LABELV $377
+endproc CG_DrawBotInfo 1052 16
+proc CG_WoPTeamOverlay 180 40
+ADDRLP4 44
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_drawTeamOverlay+12
+INDIRI4
+CNSTI4 0
+NEI4 $388
+ADDRGP4 $386
+JUMPV
+LABELV $388
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+EQI4 $391
+ADDRLP4 44
+INDIRI4
+CNSTI4 2
+EQI4 $391
+ADDRGP4 $386
+JUMPV
+LABELV $391
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $393
+ADDRLP4 0
+INDIRI4
+CNSTI4 608
+ADDI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $397
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $397
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $395
+JUMPV
+LABELV $397
+LABELV $394
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $393
+LABELV $395
+ADDRLP4 12
+CNSTF4 1112539136
+ASGNF4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $399
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+CNSTF4 1094713344
+SUBF4
+ASGNF4
+LABELV $399
+ADDRLP4 40
+CNSTF4 1130758144
+ADDRLP4 12
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+NEI4 $401
+ADDRLP4 24
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+12
+CNSTF4 1051260355
+ASGNF4
+ADDRGP4 $402
+JUMPV
+LABELV $401
+ADDRLP4 52
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24+12
+CNSTF4 1051260355
+ASGNF4
+LABELV $402
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRGP4 $412
+JUMPV
+LABELV $409
+ADDRLP4 88
+ADDRGP4 cgs+160652+104
+INDIRI4
+ASGNI4
+ADDRLP4 64
+CNSTI4 1836
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088
+ADDP4
+ASGNP4
+ADDRLP4 56
+CNSTF4 1084227584
+ASGNF4
+ADDRLP4 60
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRLP4 12
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+MULF4
+CNSTF4 1119092736
+ADDF4
+ASGNF4
+ADDRLP4 72
+CNSTF4 1115815936
+ASGNF4
+ADDRLP4 84
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 68
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $416
+ADDRGP4 $410
+JUMPV
+LABELV $416
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 84
+INDIRF4
+ARGF4
+ADDRLP4 24
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 92
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 92
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 92
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 96
+CNSTF4 1103626240
+ASGNF4
+ADDRLP4 96
+INDIRF4
+ARGF4
+ADDRLP4 96
+INDIRF4
+ARGF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 68
+ADDRLP4 64
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1120403456
+DIVF4
+ASGNF4
+ADDRLP4 68
+INDIRF4
+CNSTF4 1065353216
+LEF4 $419
+ADDRLP4 68
+CNSTF4 1065353216
+ASGNF4
+LABELV $419
+ADDRLP4 56
+INDIRF4
+CNSTF4 1105199104
+ADDF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ARGF4
+CNSTF4 1108082688
+ADDRLP4 68
+INDIRF4
+MULF4
+ARGF4
+CNSTF4 1084227584
+ARGF4
+ADDRGP4 colorRed
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 68
+ADDRLP4 64
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1120403456
+DIVF4
+ASGNF4
+ADDRLP4 68
+INDIRF4
+CNSTF4 1065353216
+LEF4 $421
+ADDRLP4 68
+CNSTF4 1065353216
+ASGNF4
+LABELV $421
+ADDRLP4 56
+INDIRF4
+CNSTF4 1105199104
+ADDF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 1088421888
+ADDF4
+ARGF4
+CNSTF4 1108082688
+ADDRLP4 68
+INDIRF4
+MULF4
+ARGF4
+CNSTF4 1084227584
+ARGF4
+ADDRGP4 colorBlue
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+CNSTI4 132
+ADDRLP4 64
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $423
+ADDRLP4 64
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 12
+NEI4 $426
+ADDRLP4 64
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $426
+ADDRLP4 88
+ADDRGP4 cgs+160652+352
+INDIRI4
+ASGNI4
+ADDRGP4 $427
+JUMPV
+LABELV $426
+ADDRLP4 64
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 12
+NEI4 $430
+ADDRLP4 64
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $430
+ADDRLP4 88
+ADDRGP4 cgs+160652+344
+INDIRI4
+ASGNI4
+ADDRGP4 $431
+JUMPV
+LABELV $430
+ADDRLP4 88
+CNSTI4 132
+ADDRLP4 64
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $431
+LABELV $427
+LABELV $423
+ADDRLP4 56
+INDIRF4
+CNSTF4 1106247680
+ADDF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 1096810496
+ADDF4
+ARGF4
+ADDRLP4 100
+CNSTF4 1092616192
+ASGNF4
+ADDRLP4 100
+INDIRF4
+ARGF4
+ADDRLP4 100
+INDIRF4
+ARGF4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 104
+ADDRGP4 cgs+31464
+INDIRI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 6
+EQI4 $449
+ADDRLP4 104
+INDIRI4
+CNSTI4 7
+EQI4 $439
+ADDRGP4 $436
+JUMPV
+LABELV $439
+ADDRLP4 56
+INDIRF4
+CNSTF4 1110966272
+ADDF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 1096810496
+ADDF4
+ARGF4
+ADDRLP4 116
+CNSTF4 1092616192
+ASGNF4
+ADDRLP4 116
+INDIRF4
+ARGF4
+ADDRLP4 116
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+NEI4 $446
+ADDRLP4 112
+ADDRGP4 cgs+160652+364
+INDIRI4
+ASGNI4
+ADDRGP4 $447
+JUMPV
+LABELV $446
+ADDRLP4 112
+ADDRGP4 cgs+160652+360
+INDIRI4
+ASGNI4
+LABELV $447
+CNSTI4 24
+ADDRLP4 112
+INDIRI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $448
+ARGP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 120
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRF4
+CNSTF4 1110966272
+ADDF4
+CNSTF4 1093664768
+ADDF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 1096810496
+ADDF4
+ARGF4
+ADDRLP4 120
+INDIRP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+CNSTF4 1090519040
+ARGF4
+CNSTF4 1092616192
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDF4
+ARGF4
+ADDRGP4 DrawStringWithCutFrame
+CALLV
+pop
+ADDRGP4 $436
+JUMPV
+LABELV $449
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $450
+ADDRLP4 8
+INDIRI4
+CNSTI4 8
+EQI4 $454
+ADDRLP4 8
+INDIRI4
+CNSTI4 9
+EQI4 $454
+ADDRGP4 $451
+JUMPV
+LABELV $454
+ADDRLP4 64
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 8
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $456
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 136
+ADDRLP4 140
+INDIRP4
+ASGNP4
+ADDRLP4 136
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $458
+ADDRLP4 136
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRF4
+CNSTF4 1110966272
+ADDF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 1096810496
+ADDF4
+ARGF4
+ADDRLP4 148
+CNSTF4 1092616192
+ASGNF4
+ADDRLP4 148
+INDIRF4
+ARGF4
+ADDRLP4 148
+INDIRF4
+ARGF4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $458
+LABELV $456
+LABELV $451
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 10
+LEI4 $450
+LABELV $436
+ADDRLP4 64
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 76
+CNSTI4 6
+ADDRLP4 80
+INDIRI4
+MULI4
+CVIF4 4
+ADDRLP4 72
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+SUBF4
+CNSTF4 1073741824
+ADDF4
+ASGNF4
+ADDRLP4 76
+INDIRF4
+CNSTF4 0
+LEF4 $460
+CNSTF4 1008981770
+ADDRLP4 76
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+DIVF4
+ADDRGP4 cg+107612
+INDIRI4
+CVIF4 4
+MULF4
+ARGF4
+ADDRLP4 120
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 56
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ADDRLP4 76
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 120
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+MULF4
+SUBF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 1104674816
+ADDF4
+ARGF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+CNSTF4 1086324736
+ARGF4
+CNSTF4 1094713344
+ARGF4
+ADDRLP4 132
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 132
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDF4
+ADDRLP4 132
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDF4
+ARGF4
+ADDRGP4 DrawStringWithCutFrame
+CALLV
+pop
+ADDRGP4 $461
+JUMPV
+LABELV $460
+ADDRLP4 140
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 144
+ADDRLP4 56
+INDIRF4
+ADDRLP4 140
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 144
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 1104674816
+ADDF4
+ARGF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+CNSTF4 1086324736
+ARGF4
+CNSTF4 1094713344
+ARGF4
+ADDRLP4 144
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDF4
+ADDRLP4 140
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDF4
+ARGF4
+ADDRGP4 DrawStringWithCutFrame
+CALLV
+pop
+LABELV $461
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $463
+ADDRLP4 64
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+CNSTI4 608
+ADDI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $467
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $465
+LABELV $467
+ADDRLP4 4
+ADDRGP4 $468
+ASGNP4
+LABELV $465
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 160
+INDIRI4
+ASGNI4
+CNSTI4 6
+ADDRLP4 80
+INDIRI4
+MULI4
+CVIF4 4
+ADDRLP4 72
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+LEF4 $469
+ADDRLP4 76
+CNSTI4 6
+ADDRLP4 80
+INDIRI4
+MULI4
+CVIF4 4
+ADDRLP4 72
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 172
+CNSTF4 1109393408
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 72
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ADDF4
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 172
+INDIRF4
+ADDRLP4 76
+INDIRF4
+MULF4
+CVFI4 4
+MODI4
+CVIF4 4
+ADDRLP4 172
+INDIRF4
+DIVF4
+SUBF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 1104674816
+ADDF4
+CNSTF4 1095761920
+ADDF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+CNSTF4 1086324736
+ARGF4
+CNSTF4 1094713344
+ARGF4
+ADDRLP4 56
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDF4
+ARGF4
+ADDRGP4 DrawStringWithCutFrame
+CALLV
+pop
+ADDRGP4 $470
+JUMPV
+LABELV $469
+ADDRLP4 168
+ADDRLP4 56
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ASGNF4
+ADDRLP4 168
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 1104674816
+ADDF4
+CNSTF4 1095761920
+ADDF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+CNSTF4 1086324736
+ARGF4
+CNSTF4 1094713344
+ARGF4
+ADDRLP4 168
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDF4
+ARGF4
+ADDRGP4 DrawStringWithCutFrame
+CALLV
+pop
+LABELV $470
+LABELV $463
+ADDRLP4 152
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+ADDRLP4 40
+INDIRI4
+LTI4 $472
+ADDRGP4 $411
+JUMPV
+LABELV $472
+LABELV $410
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $412
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+LTI4 $409
+LABELV $411
+LABELV $386
+endproc CG_WoPTeamOverlay 180 40
+lit
+align 4
+LABELV $475
+byte 4 2000
+align 4
+LABELV $476
+byte 4 1065353216
+align 4
+LABELV $477
+byte 4 0
+align 4
+LABELV $478
+byte 4 3
+align 4
+LABELV $479
+byte 4 3
+align 4
+LABELV $480
+byte 4 16
+align 4
+LABELV $481
+byte 4 16
+code
+proc CG_DrawVoiceNames 56 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $482
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+132104
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $486
+ADDRGP4 $483
+JUMPV
+LABELV $486
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+132104
+ADDP4
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 $475
+INDIRI4
+SUBI4
+GEI4 $489
+ADDRGP4 $483
+JUMPV
+LABELV $489
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+108604+140
+INDIRI4
+NEI4 $493
+ADDRGP4 $483
+JUMPV
+LABELV $493
+ADDRLP4 32
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 $478
+INDIRI4
+LEI4 $497
+ADDRGP4 $484
+JUMPV
+LABELV $497
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $221
+ARGP4
+ADDRLP4 40
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+132104
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRGP4 $475
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 44
+ADDRGP4 $476
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 44
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 44
+INDIRF4
+ADDRGP4 $477
+INDIRF4
+SUBF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 Q_PrintStrlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 640
+ADDRLP4 48
+INDIRI4
+CNSTI4 4
+LSHI4
+SUBI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRLP4 52
+ADDRGP4 $480
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 8
+INDIRI4
+ADDRGP4 $479
+INDIRI4
+SUBI4
+ADDRLP4 52
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 $481
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cgs+160652+1008
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+CNSTF4 1099956224
+ADDF4
+ASGNF4
+LABELV $483
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $482
+LABELV $484
+ADDRFP4 0
+INDIRF4
+RETF4
+LABELV $474
+endproc CG_DrawVoiceNames 56 20
+proc CG_DrawUpperRight 20 4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg_drawSnapshot+12
+INDIRI4
+CNSTI4 0
+EQI4 $504
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 CG_DrawSnapshot
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $504
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_drawFPS+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $507
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $510
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $507
+LABELV $510
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 CG_DrawFPS
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $507
+ADDRGP4 cg_drawTimer+12
+INDIRI4
+CNSTI4 0
+EQI4 $511
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 CG_DrawTimer
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $511
+ADDRGP4 cg_drawRealTime+12
+INDIRI4
+CNSTI4 0
+EQI4 $514
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 CG_DrawRealTime
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $514
+ADDRGP4 cg_drawups+12
+INDIRI4
+CNSTI4 0
+EQI4 $517
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 CG_Drawups
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $517
+ADDRGP4 cg_drawTimeLeft+12
+INDIRI4
+CNSTI4 0
+EQI4 $520
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 CG_DrawTimeLeft
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $520
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 CG_DrawServerInfos
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 cg_drawMessages+12
+INDIRI4
+CNSTI4 0
+EQI4 $523
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 CG_DrawMessages
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $523
+ADDRGP4 $528
+ARGP4
+ADDRLP4 12
+ADDRGP4 CG_GetCvarInt
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $526
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 CG_DrawBotInfo
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $526
+ADDRGP4 cg_drawAttacker+12
+INDIRI4
+CNSTI4 0
+EQI4 $529
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 CG_DrawAttacker
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $529
+ADDRGP4 cg_drawVoiceNames+12
+INDIRI4
+CNSTI4 0
+EQI4 $532
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 CG_DrawVoiceNames
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $532
+LABELV $503
+endproc CG_DrawUpperRight 20 4
+proc CG_DrawPowerups 200 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 148
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $537
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $535
+JUMPV
+LABELV $537
+ADDRLP4 164
+CNSTI4 0
+ASGNI4
+ADDRLP4 136
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 164
+INDIRI4
+ASGNI4
+LABELV $539
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 148
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $543
+ADDRGP4 $540
+JUMPV
+LABELV $543
+ADDRLP4 140
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 148
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+LTI4 $548
+ADDRLP4 140
+INDIRI4
+CNSTI4 999000
+LEI4 $546
+LABELV $548
+ADDRGP4 $540
+JUMPV
+LABELV $546
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $552
+JUMPV
+LABELV $549
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ADDRLP4 140
+INDIRI4
+LTI4 $553
+ADDRLP4 0
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $558
+JUMPV
+LABELV $555
+ADDRLP4 172
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+ADDRLP4 68+4
+ADDP4
+ADDRLP4 172
+INDIRI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 176
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 176
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $556
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $558
+ADDRLP4 0
+INDIRI4
+ADDRLP4 132
+INDIRI4
+GEI4 $555
+ADDRGP4 $551
+JUMPV
+LABELV $553
+LABELV $550
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $552
+ADDRLP4 132
+INDIRI4
+ADDRLP4 136
+INDIRI4
+LTI4 $549
+LABELV $551
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 136
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $540
+ADDRLP4 144
+ADDRLP4 144
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 16
+LTI4 $539
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+ADDRGP4 $564
+JUMPV
+LABELV $561
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 168
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 152
+ADDRLP4 168
+INDIRP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $565
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+CNSTF4 1111490560
+SUBF4
+ASGNF4
+ADDRLP4 172
+CNSTI4 2
+ASGNI4
+ADDRLP4 140
+ADDRLP4 144
+INDIRI4
+ADDRLP4 172
+INDIRI4
+LSHI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+ADDRLP4 172
+INDIRI4
+LSHI4
+ADDRLP4 148
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+SUBI4
+CNSTI4 5000
+LTI4 $567
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $568
+JUMPV
+LABELV $567
+ADDRLP4 160
+ADDRLP4 140
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 160
+ADDRLP4 160
+INDIRF4
+ADDRLP4 160
+INDIRF4
+CVFI4 4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRLP4 176+12
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 176+8
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 176+4
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 176
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 176
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $568
+ADDRGP4 cg+131556
+INDIRI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+NEI4 $574
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 cg+131560
+INDIRI4
+SUBI4
+CNSTI4 200
+GEI4 $574
+ADDRLP4 160
+CNSTF4 1065353216
+ADDRGP4 cg+107612
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+131560
+INDIRI4
+CVIF4 4
+SUBF4
+CNSTF4 1128792064
+DIVF4
+SUBF4
+ASGNF4
+ADDRLP4 156
+CNSTF4 1111490560
+CNSTF4 1056964608
+ADDRLP4 160
+INDIRF4
+MULF4
+CNSTF4 1065353216
+ADDF4
+MULF4
+ASGNF4
+ADDRGP4 $575
+JUMPV
+LABELV $574
+ADDRLP4 156
+CNSTF4 1111490560
+ASGNF4
+LABELV $575
+ADDRLP4 152
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+CNSTF4 1142947840
+ADDRLP4 156
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ADDRLP4 156
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ARGF4
+ADDRLP4 156
+INDIRF4
+ARGF4
+ADDRLP4 156
+INDIRF4
+ARGF4
+ADDRLP4 176
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $581
+ARGP4
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+CNSTI4 1000
+DIVI4
+ARGI4
+ADDRLP4 184
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 614
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+CNSTF4 1098907648
+SUBF4
+CVFI4 4
+ARGI4
+ADDRLP4 184
+INDIRP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 188
+CNSTI4 1
+ASGNI4
+ADDRLP4 188
+INDIRI4
+ARGI4
+ADDRLP4 188
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $565
+LABELV $562
+ADDRLP4 144
+ADDRLP4 144
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $564
+ADDRLP4 144
+INDIRI4
+ADDRLP4 136
+INDIRI4
+LTI4 $561
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+RETF4
+LABELV $535
+endproc CG_DrawPowerups 200 36
+lit
+align 4
+LABELV $583
+byte 4 1065353216
+byte 4 1051260355
+byte 4 0
+byte 4 1051260355
+export CG_DrawCartridgeStatus
+code
+proc CG_DrawCartridgeStatus 44 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 $583
+INDIRB
+ASGNB 16
+ADDRLP4 16
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $448
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 25
+SUBI4
+ASGNI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $585
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 1051260355
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1065353216
+ASGNF4
+CNSTF4 1142620160
+ARGF4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 32
+CNSTF4 1101004800
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRGP4 cgs+160652+360
+INDIRI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $586
+JUMPV
+LABELV $585
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $593
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 1051260355
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+CNSTF4 1142620160
+ARGF4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 32
+CNSTF4 1101004800
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRGP4 cgs+160652+364
+INDIRI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $594
+JUMPV
+LABELV $593
+ADDRLP4 32
+CNSTI4 1836
+ASGNI4
+ADDRLP4 36
+CNSTI4 184
+ASGNI4
+ADDRLP4 0
+ADDRLP4 32
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+76
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+76+4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTI4 1836
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+76+8
+ADDP4
+INDIRF4
+ASGNF4
+CNSTF4 1142620160
+ARGF4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 40
+CNSTF4 1101004800
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRGP4 cgs+160652+368
+INDIRI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $594
+LABELV $586
+CNSTF4 1142128640
+ARGF4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1101004800
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRLP4 32
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+CNSTI4 619
+CNSTI4 9
+ADDRLP4 32
+INDIRI4
+MULI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+CNSTI4 9
+ARGI4
+CNSTI4 18
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+CNSTF4 1142128640
+ARGF4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1101004800
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 CG_DrawRect
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+RETI4
+LABELV $582
+endproc CG_DrawCartridgeStatus 44 36
+lit
+align 4
+LABELV $631
+byte 4 1051260355
+byte 4 1051260355
+byte 4 1065353216
+byte 4 1059648963
+code
+proc CG_DrawHoldableItem 48 36
+ADDRLP4 0
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $619
+ADDRLP4 8
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 256
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+ADDRLP4 12
+CNSTF4 1111490560
+ASGNF4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ASGNF4
+CNSTF4 1142161408
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 4
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $624
+CNSTF4 1142161408
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 16
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+204
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $624
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $629
+ADDRLP4 24
+ADDRGP4 $631
+INDIRB
+ASGNB 16
+ADDRLP4 40
+CNSTF4 956502639
+ASGNF4
+ADDRLP4 16
+CNSTI4 48
+ADDRLP4 8
+INDIRI4
+MULI4
+CVIF4 4
+ADDRLP4 40
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1141997568
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 44
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ADDRLP4 44
+INDIRF4
+SUBF4
+ARGF4
+CNSTF4 1092616192
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 24
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+CNSTF4 1092616192
+ARGF4
+CNSTF4 1111490560
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 CG_DrawRect
+CALLV
+pop
+LABELV $629
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+EQI4 $635
+ADDRLP4 4
+INDIRI4
+CNSTI4 6
+EQI4 $635
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $632
+LABELV $635
+ADDRGP4 $448
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 24
+ADDRLP4 32
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 24
+INDIRI4
+ASGNI4
+CNSTI4 616
+ADDRLP4 36
+INDIRI4
+CNSTI4 2
+LSHI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $632
+LABELV $619
+LABELV $617
+endproc CG_DrawHoldableItem 48 36
+proc CG_DrawLowerRight 8 4
+ADDRLP4 0
+CNSTF4 1135869952
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 CG_DrawPowerups
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawHoldableItem
+CALLV
+pop
+LABELV $636
+endproc CG_DrawLowerRight 8 4
+proc CG_DrawPickupItem 16 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $638
+ADDRFP4 0
+INDIRI4
+RETI4
+ADDRGP4 $637
+JUMPV
+LABELV $638
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cg+131800
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $642
+ADDRGP4 cg+131804
+INDIRI4
+ARGI4
+CNSTI4 3000
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $645
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTF4 1090519040
+ARGF4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 16
+ADDI4
+ARGI4
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+28
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $645
+LABELV $642
+ADDRFP4 0
+INDIRI4
+RETI4
+LABELV $637
+endproc CG_DrawPickupItem 16 20
+proc CG_DrawLowerLeft 0 4
+CNSTI4 360
+ARGI4
+ADDRGP4 CG_DrawPickupItem
+CALLI4
+pop
+ADDRGP4 cg_drawTeamOverlay+12
+INDIRI4
+CNSTI4 0
+EQI4 $650
+ADDRGP4 CG_WoPTeamOverlay
+CALLV
+pop
+LABELV $650
+LABELV $649
+endproc CG_DrawLowerLeft 0 4
+proc CG_DrawTeamInfo 48 36
+ADDRGP4 cg_teamChatHeight+12
+INDIRI4
+CNSTI4 8
+GEI4 $654
+ADDRLP4 20
+ADDRGP4 cg_teamChatHeight+12
+INDIRI4
+ASGNI4
+ADDRGP4 $655
+JUMPV
+LABELV $654
+ADDRLP4 20
+CNSTI4 8
+ASGNI4
+LABELV $655
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+GTI4 $658
+ADDRGP4 $653
+JUMPV
+LABELV $658
+ADDRGP4 cgs+160556
+INDIRI4
+ADDRGP4 cgs+160552
+INDIRI4
+EQI4 $660
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 cgs+160556
+INDIRI4
+ADDRLP4 20
+INDIRI4
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160520
+ADDP4
+INDIRI4
+SUBI4
+ADDRGP4 cg_teamChatTime+12
+INDIRI4
+LEI4 $664
+ADDRLP4 28
+ADDRGP4 cgs+160556
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $664
+ADDRLP4 24
+ADDRGP4 cgs+160552
+INDIRI4
+ADDRGP4 cgs+160556
+INDIRI4
+SUBI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $673
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1051260355
+ASGNF4
+ADDRGP4 $674
+JUMPV
+LABELV $673
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $679
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1051260355
+ASGNF4
+ADDRGP4 $680
+JUMPV
+LABELV $679
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1051260355
+ASGNF4
+LABELV $680
+LABELV $674
+CNSTF4 0
+ARGF4
+ADDRLP4 28
+ADDRLP4 24
+INDIRI4
+ASGNI4
+CNSTI4 360
+ADDRLP4 28
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 32
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cgs+160552
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $694
+JUMPV
+LABELV $691
+ADDRLP4 36
+CNSTI4 8
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+CNSTI4 360
+ADDRGP4 cgs+160552
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 3
+LSHI4
+SUBI4
+ARGI4
+CNSTI4 241
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+MODI4
+MULI4
+ADDRGP4 cgs+158592
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $692
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $694
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+160556
+INDIRI4
+GEI4 $691
+LABELV $660
+LABELV $653
+endproc CG_DrawTeamInfo 48 36
+proc CG_DrawReward 68 36
+ADDRGP4 cg_drawRewards+12
+INDIRI4
+CNSTI4 0
+NEI4 $700
+ADDRGP4 $699
+JUMPV
+LABELV $700
+ADDRGP4 cg+131576
+INDIRI4
+ARGI4
+CNSTI4 3000
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $704
+ADDRGP4 cg+131572
+INDIRI4
+CNSTI4 0
+LEI4 $699
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $712
+JUMPV
+LABELV $709
+ADDRLP4 56
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRGP4 cg+131660
+ADDP4
+ADDRLP4 56
+INDIRI4
+ADDRGP4 cg+131660+4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+ADDRGP4 cg+131620
+ADDP4
+ADDRLP4 60
+INDIRI4
+ADDRGP4 cg+131620+4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRGP4 cg+131580
+ADDP4
+ADDRLP4 64
+INDIRI4
+ADDRGP4 cg+131580+4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $710
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $712
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+131572
+INDIRI4
+LTI4 $709
+ADDRGP4 cg+131576
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRGP4 cg+131572
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 cg+131576
+INDIRI4
+ARGI4
+CNSTI4 3000
+ARGI4
+ADDRLP4 60
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRGP4 cg+131660
+INDIRI4
+ADDRGP4 cgs+160652+1556
+INDIRI4
+EQI4 $707
+ADDRGP4 cg+131660
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $707
+LABELV $704
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 cg+131580
+INDIRI4
+CNSTI4 10
+LTI4 $733
+ADDRLP4 8
+CNSTF4 1113587712
+ASGNF4
+ADDRLP4 4
+CNSTF4 1133772800
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 56
+CNSTF4 1110441984
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRGP4 cg+131620
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 20
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $737
+ARGP4
+ADDRGP4 cg+131580
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 20
+ARGP4
+ADDRLP4 60
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 640
+ADDRLP4 60
+INDIRI4
+CNSTI4 3
+LSHI4
+SUBI4
+CNSTI4 2
+DIVI4
+CVIF4 4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 8
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 $734
+JUMPV
+LABELV $733
+ADDRLP4 12
+ADDRGP4 cg+131580
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTF4 1113587712
+ASGNF4
+ADDRLP4 4
+CNSTI4 320
+CNSTI4 48
+ADDRLP4 12
+INDIRI4
+MULI4
+CNSTI4 2
+DIVI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $743
+JUMPV
+LABELV $740
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 56
+CNSTF4 1110441984
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRGP4 cg+131620
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ASGNF4
+LABELV $741
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $743
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $740
+LABELV $734
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $699
+endproc CG_DrawReward 68 36
+export CG_AddLagometerFrameInfo
+proc CG_AddLagometerFrameInfo 8 0
+ADDRLP4 0
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 cg+40
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 lagometer+512
+INDIRI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 lagometer+512
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $746
+endproc CG_AddLagometerFrameInfo 8 0
+export CG_AddLagometerSnapshotInfo
+proc CG_AddLagometerSnapshotInfo 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $752
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+1028
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+ADDRGP4 lagometer+1540
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $751
+JUMPV
+LABELV $752
+ADDRGP4 cg+8
+INDIRI4
+CNSTI4 0
+EQI4 $757
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $757
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $760
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+SUBI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 15
+SUBI4
+ASGNI4
+ADDRGP4 $761
+JUMPV
+LABELV $760
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $761
+LABELV $757
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+1028
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+516
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 lagometer+1540
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $751
+endproc CG_AddLagometerSnapshotInfo 12 0
+proc CG_DrawDisconnect 64 20
+ADDRLP4 44
+ADDRGP4 trap_GetCurrentCmdNumber
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 44
+INDIRI4
+CNSTI4 64
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_GetUserCmd
+CALLI4
+pop
+ADDRLP4 48
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+LEI4 $774
+ADDRLP4 48
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+LEI4 $770
+LABELV $774
+ADDRGP4 $769
+JUMPV
+LABELV $770
+ADDRLP4 24
+ADDRGP4 $775
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 52
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 320
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ARGI4
+CNSTI4 100
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 9
+RSHI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $776
+ADDRGP4 $769
+JUMPV
+LABELV $776
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 7
+EQI4 $783
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 3
+NEI4 $779
+LABELV $783
+ADDRLP4 28
+CNSTF4 1140391936
+ASGNF4
+ADDRGP4 $780
+JUMPV
+LABELV $779
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 8
+NEI4 $784
+ADDRLP4 28
+CNSTF4 1141112832
+ASGNF4
+ADDRGP4 $785
+JUMPV
+LABELV $784
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 6
+NEI4 $787
+ADDRLP4 28
+CNSTF4 1140883456
+ASGNF4
+ADDRGP4 $788
+JUMPV
+LABELV $787
+ADDRLP4 28
+CNSTF4 1142161408
+ASGNF4
+LABELV $788
+LABELV $785
+LABELV $780
+ADDRLP4 32
+CNSTF4 1138229248
+ASGNF4
+ADDRGP4 $790
+ARGP4
+ADDRLP4 56
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 60
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $769
+endproc CG_DrawDisconnect 64 20
+proc CG_DrawLagometer 76 36
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_lagometer+12
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $796
+ADDRGP4 cgs+31460
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $792
+LABELV $796
+ADDRGP4 CG_DrawDisconnect
+CALLV
+pop
+ADDRGP4 $791
+JUMPV
+LABELV $792
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 7
+EQI4 $801
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 3
+NEI4 $797
+LABELV $801
+ADDRLP4 44
+CNSTI4 498
+ASGNI4
+ADDRGP4 $798
+JUMPV
+LABELV $797
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 8
+NEI4 $802
+ADDRLP4 44
+CNSTI4 528
+ASGNI4
+ADDRGP4 $803
+JUMPV
+LABELV $802
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 6
+NEI4 $805
+ADDRLP4 44
+CNSTI4 514
+ASGNI4
+ADDRGP4 $806
+JUMPV
+LABELV $805
+ADDRLP4 44
+CNSTI4 592
+ASGNI4
+LABELV $806
+LABELV $803
+LABELV $798
+ADDRLP4 48
+CNSTI4 432
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 44
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 48
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 56
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+196
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 24
+ADDRLP4 44
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 48
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 60
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 12
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 20
+CNSTI4 -1
+ASGNI4
+ADDRLP4 16
+ADDRLP4 32
+INDIRF4
+CNSTF4 1077936128
+DIVF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 36
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 16
+INDIRF4
+CNSTF4 1133903872
+DIVF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $813
+JUMPV
+LABELV $810
+ADDRLP4 8
+ADDRGP4 lagometer+512
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 127
+BANDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LEF4 $815
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+EQI4 $817
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_color_table+48
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $817
+ADDRLP4 0
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LEF4 $820
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $820
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+8
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRGP4 $816
+JUMPV
+LABELV $815
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $824
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+EQI4 $826
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRGP4 g_color_table+64
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $826
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LEF4 $829
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $829
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 68
+CNSTF4 0
+ASGNF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+8
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $824
+LABELV $816
+LABELV $811
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $813
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 12
+INDIRF4
+LTF4 $810
+ADDRLP4 16
+ADDRLP4 32
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 16
+INDIRF4
+CNSTF4 1147207680
+DIVF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $836
+JUMPV
+LABELV $833
+ADDRLP4 8
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 127
+BANDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+1028
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LEF4 $839
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+516
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $841
+ADDRLP4 20
+INDIRI4
+CNSTI4 5
+EQI4 $842
+ADDRLP4 20
+CNSTI4 5
+ASGNI4
+ADDRGP4 g_color_table+48
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $842
+JUMPV
+LABELV $841
+ADDRLP4 20
+INDIRI4
+CNSTI4 3
+EQI4 $847
+ADDRLP4 20
+CNSTI4 3
+ASGNI4
+ADDRGP4 g_color_table+32
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $847
+LABELV $842
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LEF4 $850
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $850
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+8
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRGP4 $840
+JUMPV
+LABELV $839
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $854
+ADDRLP4 20
+INDIRI4
+CNSTI4 4
+EQI4 $856
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRGP4 g_color_table+16
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $856
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+8
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $854
+LABELV $840
+LABELV $834
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $836
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 12
+INDIRF4
+LTF4 $833
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_nopredict+12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+NEI4 $865
+ADDRGP4 cg_synchronousClients+12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+EQI4 $861
+LABELV $865
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRGP4 $866
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $861
+ADDRGP4 CG_DrawDisconnect
+CALLV
+pop
+LABELV $791
+endproc CG_DrawLagometer 76 36
+export CG_CenterPrint
+proc CG_CenterPrint 8 12
+ADDRGP4 cg+130384
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+130372
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRGP4 cg+130380
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+130376
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 cg+131408
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cg+130384
+ASGNP4
+ADDRGP4 $877
+JUMPV
+LABELV $876
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+NEI4 $879
+ADDRLP4 4
+ADDRGP4 cg+131408
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $879
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $877
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $876
+LABELV $867
+endproc CG_CenterPrint 8 12
+proc CG_DrawCenterString 1064 36
+ADDRGP4 cg+130372
+INDIRI4
+CNSTI4 0
+NEI4 $883
+ADDRGP4 $882
+JUMPV
+LABELV $883
+ADDRGP4 cg+130372
+INDIRI4
+ARGI4
+CNSTF4 1148846080
+ADDRGP4 cg_centertime+8
+INDIRF4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $888
+ADDRGP4 $882
+JUMPV
+LABELV $888
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 cg+130384
+ASGNP4
+ADDRLP4 8
+ADDRGP4 cg+130380
+INDIRI4
+ADDRGP4 cg+131408
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 2
+DIVI4
+SUBI4
+ASGNI4
+ADDRGP4 $894
+JUMPV
+LABELV $893
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $896
+ADDRLP4 1052
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+EQI4 $902
+ADDRLP4 1052
+INDIRI4
+CNSTI4 10
+NEI4 $900
+LABELV $902
+ADDRGP4 $898
+JUMPV
+LABELV $900
+ADDRLP4 4
+INDIRI4
+ADDRLP4 28
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $897
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 50
+LTI4 $896
+LABELV $898
+ADDRLP4 4
+INDIRI4
+ADDRLP4 28
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 28
+ARGP4
+ADDRLP4 1052
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 cg+130376
+INDIRI4
+ADDRLP4 1052
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 640
+ADDRLP4 16
+INDIRI4
+SUBI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 28
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 1056
+CNSTI4 0
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 cg+130376
+INDIRI4
+ARGI4
+CNSTF4 1069547520
+ADDRGP4 cg+130376
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 1056
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+CNSTF4 1069547520
+ADDRGP4 cg+130376
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $908
+JUMPV
+LABELV $907
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $908
+ADDRLP4 1060
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+EQI4 $910
+ADDRLP4 1060
+INDIRI4
+CNSTI4 10
+NEI4 $907
+LABELV $910
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $911
+ADDRGP4 $895
+JUMPV
+LABELV $911
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $894
+ADDRGP4 $893
+JUMPV
+LABELV $895
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $882
+endproc CG_DrawCenterString 1064 36
+proc CG_DrawCrosshair 56 36
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+CNSTI4 0
+NEI4 $914
+ADDRGP4 $913
+JUMPV
+LABELV $914
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $917
+ADDRGP4 $913
+JUMPV
+LABELV $917
+ADDRGP4 cg+108596
+INDIRI4
+CNSTI4 0
+EQI4 $920
+ADDRGP4 $913
+JUMPV
+LABELV $920
+ADDRGP4 cg_crosshairHealth+12
+INDIRI4
+CNSTI4 0
+EQI4 $923
+ADDRLP4 28
+ARGP4
+ADDRGP4 CG_ColorForHealth
+CALLV
+pop
+ADDRLP4 28
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $924
+JUMPV
+LABELV $923
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $924
+ADDRLP4 28
+ADDRGP4 cg_crosshairSize+8
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 cg+131808
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+LEF4 $929
+ADDRLP4 8
+INDIRF4
+CNSTF4 1128792064
+GEF4 $929
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+CNSTF4 1128792064
+DIVF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+LABELV $929
+ADDRLP4 16
+ADDRGP4 cg_crosshairX+12
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 20
+ADDRGP4 cg_crosshairY+12
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 16
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 12
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+GEI4 $934
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $934
+ADDRLP4 24
+ADDRLP4 12
+INDIRI4
+CNSTI4 12
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+148
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 40
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRGP4 cg+110648
+INDIRI4
+CVIF4 4
+ADDF4
+ADDRLP4 36
+INDIRF4
+ADDRGP4 cg+110648+8
+INDIRI4
+CVIF4 4
+ADDRLP4 40
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 44
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRGP4 cg+110648+4
+INDIRI4
+CVIF4 4
+ADDF4
+ADDRLP4 36
+INDIRF4
+ADDRGP4 cg+110648+12
+INDIRI4
+CVIF4 4
+ADDRLP4 44
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 52
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $913
+endproc CG_DrawCrosshair 56 36
+proc CG_DrawCrosshair3D 392 28
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+CNSTI4 0
+NEI4 $946
+ADDRGP4 $945
+JUMPV
+LABELV $946
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $949
+ADDRGP4 $945
+JUMPV
+LABELV $949
+ADDRGP4 cg+108596
+INDIRI4
+CNSTI4 0
+EQI4 $952
+ADDRGP4 $945
+JUMPV
+LABELV $952
+ADDRLP4 356
+ADDRGP4 cg_crosshairSize+8
+INDIRF4
+ASGNF4
+ADDRLP4 276
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 cg+131808
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 276
+INDIRF4
+CNSTF4 0
+LEF4 $958
+ADDRLP4 276
+INDIRF4
+CNSTF4 1128792064
+GEF4 $958
+ADDRLP4 276
+ADDRLP4 276
+INDIRF4
+CNSTF4 1128792064
+DIVF4
+ASGNF4
+ADDRLP4 356
+ADDRLP4 356
+INDIRF4
+ADDRLP4 276
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+MULF4
+ASGNF4
+LABELV $958
+ADDRLP4 292
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+GEI4 $961
+ADDRLP4 292
+CNSTI4 0
+ASGNI4
+LABELV $961
+ADDRLP4 360
+ADDRLP4 292
+INDIRI4
+CNSTI4 12
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+148
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $965
+ARGP4
+ADDRLP4 140
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+ADDRLP4 372
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 268
+ADDRLP4 372
+INDIRF4
+ASGNF4
+ADDRGP4 $966
+ARGP4
+ADDRLP4 140
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+ADDRLP4 376
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 364
+ADDRLP4 268
+INDIRF4
+ADDRLP4 376
+INDIRF4
+DIVF4
+ASGNF4
+CNSTF4 1078530011
+ADDRGP4 cg+110648+16
+INDIRF4
+MULF4
+CNSTF4 1135869952
+DIVF4
+ARGF4
+ADDRLP4 380
+ADDRGP4 tan
+CALLF4
+ASGNF4
+ADDRLP4 352
+ADDRLP4 268
+INDIRF4
+ADDRLP4 380
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 272
+ADDRGP4 cgs+20100+11304
+INDIRI4
+CVIF4 4
+ADDRLP4 364
+INDIRF4
+MULF4
+ADDRLP4 268
+INDIRF4
+MULF4
+CNSTF4 1073741824
+ADDRLP4 352
+INDIRF4
+MULF4
+DIVF4
+ASGNF4
+ADDRLP4 280
+ADDRGP4 cg+110648+24
+INDIRF4
+ADDRGP4 cg+110648+36
+INDIRF4
+ADDRLP4 272
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 280+4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+ADDRGP4 cg+110648+36+4
+INDIRF4
+ADDRLP4 272
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 280+8
+ADDRGP4 cg+110648+24+8
+INDIRF4
+ADDRGP4 cg+110648+36+8
+INDIRF4
+ADDRLP4 272
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 296
+ARGP4
+ADDRGP4 cg+110648+24
+ARGP4
+ADDRLP4 388
+CNSTP4 0
+ASGNP4
+ADDRLP4 388
+INDIRP4
+ARGP4
+ADDRLP4 388
+INDIRP4
+ARGP4
+ADDRLP4 280
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+4
+CNSTI4 24
+ASGNI4
+ADDRLP4 0+68
+ADDRLP4 296+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+132
+ADDRLP4 356
+INDIRF4
+CNSTF4 1142947840
+DIVF4
+ADDRLP4 352
+INDIRF4
+MULF4
+ADDRLP4 296+8
+INDIRF4
+MULF4
+ADDRLP4 272
+INDIRF4
+MULF4
+ADDRLP4 268
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 0+112
+ADDRLP4 360
+INDIRI4
+ASGNI4
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $945
+endproc CG_DrawCrosshair3D 392 28
+proc CG_ScanForCrosshairEntity 96 28
+ADDRLP4 56
+ADDRGP4 cg+110648+24
+INDIRB
+ASGNB 12
+ADDRLP4 84
+CNSTF4 1207959552
+ASGNF4
+ADDRLP4 68
+ADDRLP4 56
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDRGP4 cg+110648+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+4
+ADDRLP4 56+4
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDRGP4 cg+110648+36+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+8
+ADDRLP4 56+8
+INDIRF4
+CNSTF4 1207959552
+ADDRGP4 cg+110648+36+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 88
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 33554433
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 0+52
+INDIRI4
+CNSTI4 64
+LTI4 $1020
+ADDRGP4 $1004
+JUMPV
+LABELV $1020
+ADDRLP4 0+12
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 92
+ADDRGP4 trap_CM_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $1024
+ADDRGP4 $1004
+JUMPV
+LABELV $1024
+CNSTI4 808
+ADDRLP4 0+52
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+188
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $1026
+ADDRGP4 $1004
+JUMPV
+LABELV $1026
+ADDRGP4 cg+131548
+ADDRLP4 0+52
+INDIRI4
+ASGNI4
+ADDRGP4 cg+131552
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+LABELV $1004
+endproc CG_ScanForCrosshairEntity 96 28
+proc CG_DrawCrosshairNames 20 16
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+CNSTI4 0
+NEI4 $1035
+ADDRGP4 $1034
+JUMPV
+LABELV $1035
+ADDRGP4 cg_drawCrosshairNames+12
+INDIRI4
+CNSTI4 0
+NEI4 $1038
+ADDRGP4 $1034
+JUMPV
+LABELV $1038
+ADDRGP4 cg+108596
+INDIRI4
+CNSTI4 0
+EQI4 $1041
+ADDRGP4 $1034
+JUMPV
+LABELV $1041
+ADDRGP4 CG_ScanForCrosshairEntity
+CALLV
+pop
+ADDRGP4 cg+131552
+INDIRI4
+ARGI4
+CNSTI4 1000
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1045
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $1034
+JUMPV
+LABELV $1045
+ADDRLP4 4
+CNSTI4 1836
+ADDRGP4 cg+131548
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+LSHI4
+CVIF4 4
+ASGNF4
+CNSTF4 1134559232
+ADDRLP4 8
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+CVFI4 4
+ARGI4
+CNSTI4 170
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1034
+endproc CG_DrawCrosshairNames 20 16
+data
+align 1
+LABELV $1051
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 69
+byte 1 83
+byte 1 67
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 83
+byte 1 84
+byte 1 65
+byte 1 82
+byte 1 84
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $1052
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+code
+proc CG_DrawSpectator 4 16
+CNSTI4 248
+ARGI4
+CNSTI4 440
+ARGI4
+ADDRGP4 $1053
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 1
+NEI4 $1054
+ADDRGP4 $1052
+ARGP4
+ADDRLP4 0
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+CNSTU4 320
+ADDRLP4 0
+INDIRU4
+CNSTI4 3
+LSHU4
+SUBU4
+CVUI4 4
+ARGI4
+CNSTI4 460
+ARGI4
+ADDRGP4 $1052
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 $1055
+JUMPV
+LABELV $1054
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 5
+LTI4 $1057
+ADDRGP4 $1051
+ARGP4
+ADDRLP4 0
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+CNSTU4 320
+ADDRLP4 0
+INDIRU4
+CNSTI4 3
+LSHU4
+SUBU4
+CVUI4 4
+ARGI4
+CNSTI4 460
+ARGI4
+ADDRGP4 $1051
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $1057
+LABELV $1055
+LABELV $1050
+endproc CG_DrawSpectator 4 16
+proc CG_DrawVote 16 16
+ADDRGP4 cgs+31788
+INDIRI4
+CNSTI4 0
+NEI4 $1061
+ADDRGP4 $1060
+JUMPV
+LABELV $1061
+ADDRGP4 cgs+31800
+INDIRI4
+CNSTI4 0
+EQI4 $1064
+ADDRGP4 cgs+31800
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+160652+1356
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $1064
+ADDRLP4 4
+CNSTI4 30000
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 cgs+31788
+INDIRI4
+SUBI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $1072
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1072
+ADDRGP4 $1074
+ARGP4
+ADDRGP4 cgs+31804
+ARGP4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+CNSTI4 0
+ARGI4
+CNSTI4 58
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawSmallString
+CALLV
+pop
+ADDRGP4 $1076
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 cgs+31792
+INDIRI4
+ARGI4
+ADDRGP4 cgs+31796
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+CNSTI4 0
+ARGI4
+CNSTI4 74
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawSmallString
+CALLV
+pop
+LABELV $1060
+endproc CG_DrawVote 16 16
+proc CG_DrawTeamVote 24 20
+ADDRGP4 cgs+41088+68
+INDIRI4
+CNSTI4 1
+NEI4 $1080
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1081
+JUMPV
+LABELV $1080
+ADDRGP4 cgs+41088+68
+INDIRI4
+CNSTI4 2
+NEI4 $1079
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $1085
+LABELV $1081
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32828
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1088
+ADDRGP4 $1079
+JUMPV
+LABELV $1088
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32852
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1091
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32852
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+160652+1356
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $1091
+ADDRLP4 4
+CNSTI4 30000
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32828
+ADDP4
+INDIRI4
+SUBI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $1099
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1099
+ADDRGP4 $1101
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 cgs+32860
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cgs+32836
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cgs+32844
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRP4
+ASGNP4
+CNSTI4 0
+ARGI4
+CNSTI4 90
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawSmallString
+CALLV
+pop
+LABELV $1079
+endproc CG_DrawTeamVote 24 20
+proc CG_DrawScoreboard 4 0
+ADDRLP4 0
+ADDRGP4 CG_DrawOldScoreboard
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $1105
+endproc CG_DrawScoreboard 4 0
+proc CG_DrawIntermission 4 0
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 2
+NEI4 $1107
+ADDRGP4 CG_DrawCenterString
+CALLV
+pop
+ADDRGP4 $1106
+JUMPV
+LABELV $1107
+ADDRGP4 cg+121348
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 CG_DrawScoreboard
+CALLI4
+ASGNI4
+ADDRGP4 cg+121344
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $1106
+endproc CG_DrawIntermission 4 0
+proc CG_DrawFollow 36 36
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+NEI4 $1114
+CNSTI4 0
+RETI4
+ADDRGP4 $1113
+JUMPV
+LABELV $1114
+ADDRLP4 24
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1065353216
+ASGNF4
+CNSTI4 248
+ARGI4
+CNSTI4 24
+ARGI4
+ADDRGP4 $1120
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRLP4 16
+CNSTI4 1836
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1056964608
+CNSTI4 640
+ADDRLP4 28
+INDIRI4
+CNSTI4 4
+LSHI4
+SUBI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+ARGI4
+CNSTI4 40
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTI4 32
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1113
+endproc CG_DrawFollow 36 36
+proc CG_DrawAmmoWarning 12 16
+ADDRGP4 cg_drawAmmoWarning+12
+INDIRI4
+CNSTI4 0
+NEI4 $1125
+ADDRGP4 $1124
+JUMPV
+LABELV $1125
+ADDRGP4 cg+131544
+INDIRI4
+CNSTI4 0
+NEI4 $1128
+ADDRGP4 $1124
+JUMPV
+LABELV $1128
+ADDRGP4 cg+131544
+INDIRI4
+CNSTI4 2
+NEI4 $1131
+ADDRLP4 0
+ADDRGP4 $1134
+ASGNP4
+ADDRGP4 $1132
+JUMPV
+LABELV $1131
+ADDRLP4 0
+ADDRGP4 $1135
+ASGNP4
+LABELV $1132
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 320
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $1124
+endproc CG_DrawAmmoWarning 12 16
+proc CG_DrawWarmup 84 36
+ADDRLP4 4
+ADDRGP4 cg+131792
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1138
+ADDRGP4 $1136
+JUMPV
+LABELV $1138
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $1140
+ADDRLP4 8
+ADDRGP4 $1142
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 36
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 320
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ARGI4
+CNSTI4 24
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 cg+131796
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1136
+JUMPV
+LABELV $1140
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 1
+NEI4 $1144
+ADDRLP4 36
+CNSTP4 0
+ASGNP4
+ADDRLP4 24
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1150
+JUMPV
+LABELV $1147
+ADDRLP4 40
+CNSTI4 1836
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 cgs+41088
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+EQI4 $1152
+ADDRLP4 40
+INDIRI4
+ADDRGP4 cgs+41088+68
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+NEI4 $1152
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1157
+ADDRLP4 24
+CNSTI4 1836
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088
+ADDP4
+ASGNP4
+ADDRGP4 $1158
+JUMPV
+LABELV $1157
+ADDRLP4 32
+CNSTI4 1836
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088
+ADDP4
+ASGNP4
+LABELV $1158
+LABELV $1152
+LABELV $1148
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1150
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+31488
+INDIRI4
+LTI4 $1147
+ADDRLP4 40
+CNSTU4 0
+ASGNU4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+ADDRLP4 40
+INDIRU4
+EQU4 $1145
+ADDRLP4 32
+INDIRP4
+CVPU4 4
+ADDRLP4 40
+INDIRU4
+EQU4 $1145
+ADDRGP4 $1163
+ARGP4
+ADDRLP4 44
+CNSTI4 4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 20
+LEI4 $1164
+ADDRLP4 12
+CNSTI4 640
+ADDRLP4 16
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $1165
+JUMPV
+LABELV $1164
+ADDRLP4 12
+CNSTI4 32
+ASGNI4
+LABELV $1165
+CNSTI4 320
+ADDRLP4 16
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MULI4
+CNSTI4 2
+DIVI4
+SUBI4
+ARGI4
+CNSTI4 20
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+CNSTF4 1069547520
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 $1145
+JUMPV
+LABELV $1144
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 0
+NEI4 $1166
+ADDRLP4 8
+ADDRGP4 $1169
+ASGNP4
+ADDRGP4 $1167
+JUMPV
+LABELV $1166
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 5
+NEI4 $1170
+ADDRLP4 8
+ADDRGP4 $1173
+ASGNP4
+ADDRGP4 $1171
+JUMPV
+LABELV $1170
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 6
+NEI4 $1174
+ADDRLP4 8
+ADDRGP4 $1177
+ASGNP4
+ADDRGP4 $1175
+JUMPV
+LABELV $1174
+ADDRLP4 8
+ADDRGP4 $468
+ASGNP4
+LABELV $1175
+LABELV $1171
+LABELV $1167
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 20
+LEI4 $1178
+ADDRLP4 12
+CNSTI4 640
+ADDRLP4 16
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $1179
+JUMPV
+LABELV $1178
+ADDRLP4 12
+CNSTI4 32
+ASGNI4
+LABELV $1179
+CNSTI4 320
+ADDRLP4 16
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MULI4
+CNSTI4 2
+DIVI4
+SUBI4
+ARGI4
+CNSTI4 25
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+CNSTF4 1066192077
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $1145
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $1181
+ADDRGP4 cg+131792
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1181
+ADDRLP4 20
+ADDRGP4 cg_warmupReady+8
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRGP4 cg_curWarmupReady+8
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+CNSTF4 0
+LEF4 $1186
+ADDRLP4 28
+INDIRF4
+ADDRLP4 20
+INDIRF4
+GEF4 $1186
+ADDRGP4 $1188
+ARGP4
+ADDRLP4 40
+CNSTF4 1120403456
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRGP4 $1187
+JUMPV
+LABELV $1186
+ADDRGP4 $1189
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 48
+INDIRP4
+ASGNP4
+LABELV $1187
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+131796
+INDIRI4
+EQI4 $1190
+ADDRGP4 cg+131796
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1196
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $1199
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+EQI4 $1202
+ADDRGP4 $1195
+JUMPV
+LABELV $1196
+ADDRGP4 cgs+160652+1732
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $1195
+JUMPV
+LABELV $1199
+ADDRGP4 cgs+160652+1728
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $1195
+JUMPV
+LABELV $1202
+ADDRGP4 cgs+160652+1724
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $1195
+LABELV $1190
+ADDRLP4 52
+ADDRGP4 cg+131796
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $1208
+ADDRLP4 52
+INDIRI4
+CNSTI4 1
+EQI4 $1209
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+EQI4 $1210
+ADDRGP4 $1205
+JUMPV
+LABELV $1208
+ADDRLP4 12
+CNSTI4 28
+ASGNI4
+ADDRGP4 $1206
+JUMPV
+LABELV $1209
+ADDRLP4 12
+CNSTI4 24
+ASGNI4
+ADDRGP4 $1206
+JUMPV
+LABELV $1210
+ADDRLP4 12
+CNSTI4 20
+ASGNI4
+ADDRGP4 $1206
+JUMPV
+LABELV $1205
+ADDRLP4 12
+CNSTI4 16
+ASGNI4
+LABELV $1206
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 56
+INDIRI4
+ASGNI4
+CNSTI4 320
+ADDRLP4 16
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MULI4
+CNSTI4 2
+DIVI4
+SUBI4
+ARGI4
+CNSTI4 70
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+CNSTF4 1069547520
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRLP4 20
+INDIRF4
+CNSTF4 0
+LEF4 $1211
+ADDRLP4 28
+INDIRF4
+ADDRLP4 20
+INDIRF4
+GEF4 $1211
+ADDRGP4 $1213
+ARGP4
+ADDRLP4 72
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 76
+INDIRI4
+ASGNI4
+CNSTI4 320
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+SUBI4
+ARGI4
+CNSTF4 1069547520
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+CNSTI4 72
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $1211
+LABELV $1136
+endproc CG_DrawWarmup 84 36
+proc DrawBigScore 60 40
+ADDRLP4 0
+ADDRGP4 cg_bigScoreType+12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1218
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $1219
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+EQI4 $1227
+ADDRGP4 $1215
+JUMPV
+LABELV $1215
+LABELV $1218
+ADDRLP4 8
+CNSTI4 25
+ASGNI4
+ADDRGP4 $448
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTU4 28
+ADDRLP4 16
+INDIRU4
+DIVU4
+CVUI4 4
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 $1216
+JUMPV
+LABELV $1219
+ADDRLP4 48
+CNSTI4 30
+ASGNI4
+ADDRLP4 16
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTU4 32
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 16+31
+CNSTI1 0
+ASGNI1
+ADDRLP4 8
+CNSTI4 7
+ASGNI4
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1224
+JUMPV
+LABELV $1221
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+MODI4
+CNSTI4 48
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 16
+ADDP4
+ADDRLP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+LABELV $1222
+ADDRLP4 12
+CNSTI4 10
+ADDRLP4 12
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1224
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LEI4 $1225
+ADDRLP4 56
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 56
+INDIRI4
+LTI4 $1221
+LABELV $1225
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 250
+DIVI4
+CNSTI4 7
+BANDI4
+ADDRLP4 16
+ADDP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 $1216
+JUMPV
+LABELV $1227
+ADDRGP4 $448
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTF4 1113063424
+CNSTF4 1025222115
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 2500
+MODI4
+CVIF4 4
+MULF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+CNSTF4 1090519040
+ARGF4
+CNSTF4 1098907648
+ARGF4
+CNSTF4 1104150528
+ARGF4
+CNSTF4 0
+ARGF4
+CNSTF4 1112539136
+ARGF4
+CNSTF4 1139802112
+ARGF4
+ADDRGP4 DrawStringWithCutFrame
+CALLV
+pop
+LABELV $1216
+LABELV $1214
+endproc DrawBigScore 60 40
+lit
+align 4
+LABELV $1230
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 1065353216
+align 4
+LABELV $1231
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+align 4
+LABELV $1232
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+align 4
+LABELV $1233
+byte 4 1065353216
+byte 4 1063675494
+byte 4 1036831949
+byte 4 1065353216
+export CG_GetBalloonStateColor
+code
+proc CG_GetBalloonStateColor 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1236
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 14
+EQI4 $1234
+LABELV $1236
+ADDRFP4 4
+INDIRP4
+ADDRGP4 $1233
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 $1233+4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 $1233+8
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 $1233+12
+INDIRF4
+ASGNF4
+ADDRGP4 $1229
+JUMPV
+LABELV $1234
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1240
+ADDRFP4 4
+INDIRP4
+ADDRGP4 $1232
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 $1232+4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 $1232+8
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 $1232+12
+INDIRF4
+ASGNF4
+ADDRGP4 $1229
+JUMPV
+LABELV $1240
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $1245
+ADDRFP4 4
+INDIRP4
+ADDRGP4 $1230
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 $1230+4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 $1230+8
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 $1230+12
+INDIRF4
+ASGNF4
+ADDRGP4 $1246
+JUMPV
+LABELV $1245
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $1250
+ADDRFP4 4
+INDIRP4
+ADDRGP4 $1231
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 $1231+4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 $1231+8
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 $1231+12
+INDIRF4
+ASGNF4
+ADDRGP4 $1251
+JUMPV
+LABELV $1250
+ADDRFP4 4
+INDIRP4
+ADDRGP4 $1233
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 $1233+4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 $1233+8
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 $1233+12
+INDIRF4
+ASGNF4
+LABELV $1251
+LABELV $1246
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+CNSTI4 11
+GEI4 $1258
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 400
+DIVI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1258
+ADDRFP4 4
+INDIRP4
+ADDRGP4 $1232
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 $1232+4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 $1232+8
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 $1232+12
+INDIRF4
+ASGNF4
+LABELV $1258
+LABELV $1229
+endproc CG_GetBalloonStateColor 8 0
+lit
+align 4
+LABELV $1265
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 1065353216
+align 4
+LABELV $1266
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+align 4
+LABELV $1267
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+align 4
+LABELV $1268
+byte 4 1065353216
+byte 4 1063675494
+byte 4 1036831949
+byte 4 1065353216
+code
+proc CG_GetBalloonColor 24 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ADDRGP4 cgs+34932
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 4
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+CNSTI4 48
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $1273
+ADDRLP4 4
+INDIRI4
+CNSTI4 49
+EQI4 $1277
+ADDRLP4 4
+INDIRI4
+CNSTI4 50
+EQI4 $1281
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $1270
+LABELV $1288
+ADDRLP4 4
+INDIRI4
+CNSTI4 97
+EQI4 $1277
+ADDRLP4 4
+INDIRI4
+CNSTI4 98
+EQI4 $1281
+ADDRGP4 $1270
+JUMPV
+LABELV $1273
+ADDRFP4 4
+INDIRP4
+ADDRGP4 $1267
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 $1267+4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 $1267+8
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 $1267+12
+INDIRF4
+ASGNF4
+ADDRGP4 $1264
+JUMPV
+LABELV $1277
+ADDRFP4 4
+INDIRP4
+ADDRGP4 $1265
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 $1265+4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 $1265+8
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 $1265+12
+INDIRF4
+ASGNF4
+ADDRGP4 $1271
+JUMPV
+LABELV $1281
+ADDRFP4 4
+INDIRP4
+ADDRGP4 $1266
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 $1266+4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 $1266+8
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 $1266+12
+INDIRF4
+ASGNF4
+ADDRGP4 $1271
+JUMPV
+LABELV $1270
+ADDRFP4 4
+INDIRP4
+ADDRGP4 $1268
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 $1268+4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 $1268+8
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 $1268+12
+INDIRF4
+ASGNF4
+ADDRGP4 $1264
+JUMPV
+LABELV $1271
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 400
+DIVI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1289
+ADDRLP4 20
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 97
+EQI4 $1292
+ADDRLP4 20
+INDIRI4
+CNSTI4 98
+NEI4 $1289
+LABELV $1292
+ADDRFP4 4
+INDIRP4
+ADDRGP4 $1267
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 $1267+4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 $1267+8
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 $1267+12
+INDIRF4
+ASGNF4
+LABELV $1289
+LABELV $1264
+endproc CG_GetBalloonColor 24 0
+proc CG_DrawBalloonIcon 128 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_icons+12
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $1297
+ADDRGP4 $1296
+JUMPV
+LABELV $1297
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 CG_GetBalloonStateColor
+CALLV
+pop
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1109393408
+ADDF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRGP4 cg+110648
+ARGP4
+ADDRLP4 92
+ARGP4
+ADDRLP4 96
+ARGP4
+ADDRLP4 100
+ADDRGP4 Calculate_2DOf3D
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 100
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 0
+NEF4 $1302
+ADDRGP4 $1296
+JUMPV
+LABELV $1302
+ADDRLP4 36
+ARGP4
+ADDRGP4 cg+110648+24
+ARGP4
+ADDRLP4 104
+CNSTP4 0
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 25
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 36+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $1307
+ADDRGP4 cg+110648+24
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 DistanceSquared
+CALLF4
+ASGNF4
+ADDRLP4 108
+INDIRF4
+CNSTF4 1198793728
+GEF4 $1310
+ADDRGP4 $1296
+JUMPV
+LABELV $1310
+LABELV $1307
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 108
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+CNSTF4 1056964608
+ARGF4
+CNSTF4 1065353216
+ARGF4
+CNSTF4 1065353216
+CNSTF4 990057071
+ADDRLP4 108
+INDIRF4
+MULF4
+DIVF4
+ARGF4
+ADDRLP4 112
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 112
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 120
+CNSTF4 1098907648
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 92
+INDIRF4
+ADDRLP4 120
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 96
+INDIRF4
+ADDRLP4 120
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 124
+CNSTF4 1107296256
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 124
+INDIRF4
+ARGF4
+ADDRLP4 124
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+328
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1296
+endproc CG_DrawBalloonIcon 128 28
+proc CG_DrawHealthstationIcon 52 20
+ADDRGP4 cg_icons+12
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $1317
+ADDRGP4 $1316
+JUMPV
+LABELV $1317
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1056964608
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 252
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+LEF4 $1320
+ADDRGP4 $1316
+JUMPV
+LABELV $1320
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRGP4 cg+110648
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 28
+ADDRGP4 Calculate_2DOf3D
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 0
+NEF4 $1326
+ADDRGP4 $1316
+JUMPV
+LABELV $1326
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+CNSTF4 1056964608
+ARGF4
+CNSTF4 1065353216
+ARGF4
+CNSTF4 1065353216
+CNSTF4 990057071
+ADDRLP4 32
+INDIRF4
+MULF4
+DIVF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 36
+INDIRF4
+ASGNF4
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 44
+CNSTF4 1098907648
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 44
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 44
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 48
+CNSTF4 1107296256
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+332
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $1316
+endproc CG_DrawHealthstationIcon 52 20
+proc CG_DrawSprayroomIcon 112 28
+ADDRGP4 cg_icons+12
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+NEI4 $1331
+ADDRGP4 $1330
+JUMPV
+LABELV $1331
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $1334
+ADDRGP4 $1330
+JUMPV
+LABELV $1334
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1120403456
+ADDF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRGP4 cg+110648
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 84
+ADDRGP4 Calculate_2DOf3D
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 84
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 0
+NEF4 $1339
+ADDRGP4 $1330
+JUMPV
+LABELV $1339
+ADDRLP4 28
+ARGP4
+ADDRGP4 cg+110648+24
+ARGP4
+ADDRLP4 88
+CNSTP4 0
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 25
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 28+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $1344
+ADDRGP4 cg+110648+24
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 DistanceSquared
+CALLF4
+ASGNF4
+ADDRLP4 92
+INDIRF4
+CNSTF4 1198793728
+GEF4 $1347
+ADDRGP4 $1330
+JUMPV
+LABELV $1347
+LABELV $1344
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 92
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+CNSTF4 1056964608
+ARGF4
+CNSTF4 1065353216
+ARGF4
+CNSTF4 1065353216
+CNSTF4 990057071
+ADDRLP4 92
+INDIRF4
+MULF4
+DIVF4
+ARGF4
+ADDRLP4 96
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 96
+INDIRF4
+ASGNF4
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 104
+CNSTF4 1098907648
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 104
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 104
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 108
+CNSTF4 1107296256
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 108
+INDIRF4
+ARGF4
+ADDRLP4 108
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+336
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $1330
+endproc CG_DrawSprayroomIcon 112 28
+lit
+align 4
+LABELV $1363
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1065353216
+code
+proc CG_DrawBambamIcon 172 36
+ADDRLP4 12
+ADDRGP4 cg+110648+24
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 88
+CNSTP4 0
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 25
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 24+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $1358
+ADDRLP4 0
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRLP4 84
+ARGP4
+ADDRLP4 92
+ADDRGP4 CG_WorldToScreen
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+EQI4 $1361
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 140
+ADDRGP4 DistanceSquared
+CALLF4
+ASGNF4
+ADDRLP4 136
+ADDRLP4 140
+INDIRF4
+ASGNF4
+ADDRLP4 136
+INDIRF4
+ARGF4
+ADDRLP4 144
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+CNSTF4 1065353216
+CNSTF4 1000593162
+ADDRLP4 144
+INDIRF4
+MULF4
+DIVF4
+ARGF4
+ADDRLP4 148
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 96
+ADDRLP4 148
+INDIRF4
+ASGNF4
+ADDRLP4 100
+ADDRLP4 80
+INDIRF4
+CNSTF4 1111490560
+ADDRLP4 96
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 104
+ADDRLP4 84
+INDIRF4
+CNSTF4 1094713344
+ADDRLP4 96
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 108
+CNSTF4 1119879168
+ADDRLP4 96
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 112
+CNSTF4 1103101952
+ADDRLP4 96
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 116
+ADDRFP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 120
+ADDRGP4 $1363
+INDIRB
+ASGNB 16
+ADDRLP4 100
+ARGP4
+ADDRLP4 104
+ARGP4
+ADDRLP4 108
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 100
+INDIRF4
+ARGF4
+ADDRLP4 104
+INDIRF4
+ARGF4
+ADDRLP4 108
+INDIRF4
+ARGF4
+ADDRLP4 112
+INDIRF4
+ARGF4
+ADDRLP4 152
+CNSTF4 0
+ASGNF4
+ADDRLP4 152
+INDIRF4
+ARGF4
+ADDRLP4 152
+INDIRF4
+ARGF4
+ADDRLP4 156
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 156
+INDIRF4
+ARGF4
+ADDRLP4 156
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+888
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 1
+EQI4 $1369
+ADDRGP4 $1366
+JUMPV
+LABELV $1369
+ADDRLP4 120
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $1367
+JUMPV
+LABELV $1366
+ADDRLP4 120+8
+CNSTF4 1065353216
+ASGNF4
+LABELV $1367
+ADDRLP4 120
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 100
+INDIRF4
+ARGF4
+ADDRLP4 104
+INDIRF4
+ARGF4
+ADDRLP4 164
+ADDRLP4 116
+INDIRF4
+ASGNF4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 164
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 112
+INDIRF4
+ARGF4
+ADDRLP4 168
+CNSTF4 0
+ASGNF4
+ADDRLP4 168
+INDIRF4
+ARGF4
+ADDRLP4 168
+INDIRF4
+ARGF4
+ADDRLP4 164
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 cgs+160652+884
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1361
+LABELV $1358
+LABELV $1353
+endproc CG_DrawBambamIcon 172 36
+lit
+align 4
+LABELV $1392
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+align 4
+LABELV $1393
+address $1169
+address $1394
+address $1395
+address $1396
+address $1397
+address $1173
+address $1177
+address $1398
+address $1399
+address $1400
+align 4
+LABELV $1454
+byte 4 1065353216
+byte 4 1056964608
+byte 4 0
+byte 4 1065353216
+data
+align 4
+LABELV $1481
+byte 4 0
+lit
+align 4
+LABELV $1496
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 1065353216
+align 4
+LABELV $1746
+byte 4 1065353216
+byte 4 1063675494
+byte 4 1036831949
+byte 4 1065353216
+align 4
+LABELV $1747
+byte 4 1065353216
+byte 4 1053609165
+byte 4 1036831949
+byte 4 1065353216
+align 4
+LABELV $1864
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+code
+proc CG_Draw2D 144 40
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+EQI4 $1374
+ADDRGP4 $1373
+JUMPV
+LABELV $1374
+ADDRGP4 cg_draw2D+12
+INDIRI4
+CNSTI4 0
+NEI4 $1377
+ADDRGP4 $1373
+JUMPV
+LABELV $1377
+ADDRGP4 cg_cineHideHud+12
+INDIRI4
+CNSTI4 0
+EQI4 $1380
+ADDRGP4 CG_DrawCenterString
+CALLV
+pop
+ADDRGP4 $1373
+JUMPV
+LABELV $1380
+ADDRGP4 cg+107644
+INDIRI4
+CNSTI4 0
+NEI4 $1383
+ADDRGP4 cg+107644
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+LABELV $1383
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 cg+107644
+INDIRI4
+SUBI4
+CNSTI4 8000
+GEI4 $1388
+ADDRLP4 4
+ADDRGP4 $1392
+INDIRB
+ASGNB 16
+ADDRLP4 24
+ADDRGP4 $1393
+INDIRB
+ASGNB 40
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 cg+107644
+INDIRI4
+SUBI4
+CNSTI4 5000
+GEI4 $1401
+ADDRLP4 4+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $1402
+JUMPV
+LABELV $1401
+ADDRLP4 4+12
+CNSTI4 8000
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 cg+107644
+INDIRI4
+SUBI4
+SUBI4
+CVIF4 4
+CNSTF4 1161527296
+DIVF4
+ASGNF4
+LABELV $1402
+ADDRLP4 0
+ADDRGP4 cgs+31464
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1413
+ADDRLP4 0
+INDIRI4
+CNSTI4 9
+LTI4 $1411
+LABELV $1413
+ADDRLP4 68
+CNSTI4 9
+ASGNI4
+ADDRGP4 $1412
+JUMPV
+LABELV $1411
+ADDRLP4 68
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $1412
+ADDRLP4 0
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 20
+ADDRLP4 76
+INDIRU4
+CVUI4 4
+ASGNI4
+CNSTI4 320
+CNSTI4 6
+ADDRLP4 20
+INDIRI4
+MULI4
+SUBI4
+ARGI4
+CNSTI4 214
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+CNSTI4 12
+ARGI4
+CNSTI4 24
+ARGI4
+CNSTI4 30
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+CNSTI4 320
+CNSTI4 6
+ADDRLP4 20
+INDIRI4
+MULI4
+SUBI4
+ARGI4
+CNSTI4 214
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+CNSTI4 12
+ARGI4
+CNSTI4 24
+ARGI4
+CNSTI4 30
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+CNSTI4 3
+ARGI4
+ADDRLP4 88
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 88
+INDIRP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 20
+ADDRLP4 92
+INDIRU4
+CVUI4 4
+ASGNI4
+CNSTI4 320
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+SUBI4
+ARGI4
+CNSTI4 240
+ARGI4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $1388
+ADDRGP4 cg+107636
+INDIRI4
+CNSTI4 0
+EQI4 $1414
+ADDRGP4 ActiveChooseLogoMenu
+CALLV
+pop
+LABELV $1414
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $1417
+ADDRGP4 cg+111040
+INDIRI4
+CNSTI4 0
+EQI4 $1420
+ADDRGP4 CG_ZoomDown_f
+CALLV
+pop
+LABELV $1420
+ADDRGP4 CG_DrawIntermission
+CALLV
+pop
+ADDRGP4 $1373
+JUMPV
+LABELV $1417
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1423
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawUpperRight
+CALLV
+pop
+ADDRGP4 CG_DrawSpectator
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1426
+ADDRGP4 CG_DrawCrosshair
+CALLV
+pop
+LABELV $1426
+ADDRGP4 CG_DrawCrosshairNames
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 CG_DrawScoreboard
+CALLI4
+ASGNI4
+ADDRGP4 cg+121344
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+121344
+INDIRI4
+CNSTI4 0
+NEI4 $1373
+ADDRGP4 CG_DrawCenterString
+CALLV
+pop
+ADDRGP4 $1373
+JUMPV
+LABELV $1423
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 4
+NEI4 $1432
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+GEI4 $1432
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1432
+CNSTI4 228
+ARGI4
+CNSTI4 50
+ARGI4
+ADDRGP4 $1437
+ARGP4
+ADDRGP4 colorGreen
+ARGP4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawUpperRight
+CALLV
+pop
+ADDRGP4 CG_DrawSpectator
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1438
+ADDRGP4 CG_DrawCrosshair
+CALLV
+pop
+LABELV $1438
+ADDRGP4 CG_DrawCrosshairNames
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 CG_DrawScoreboard
+CALLI4
+ASGNI4
+ADDRGP4 cg+121344
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+121344
+INDIRI4
+CNSTI4 0
+NEI4 $1373
+ADDRGP4 CG_DrawCenterString
+CALLV
+pop
+ADDRGP4 $1373
+JUMPV
+LABELV $1432
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $1444
+ADDRLP4 4
+ADDRGP4 CG_DrawScoreboard
+CALLI4
+ASGNI4
+ADDRGP4 cg+121344
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+121344
+INDIRI4
+CNSTI4 0
+NEI4 $1373
+ADDRGP4 CG_DrawCenterString
+CALLV
+pop
+ADDRGP4 $1373
+JUMPV
+LABELV $1444
+ADDRGP4 cg+111040
+INDIRI4
+CNSTI4 0
+EQI4 $1451
+ADDRLP4 4
+ADDRGP4 $1454
+INDIRB
+ASGNB 16
+ADDRGP4 CG_DrawCrosshairNames
+CALLV
+pop
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $1455
+ADDRLP4 20
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $448
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4+12
+CNSTF4 1065353216
+ASGNF4
+CNSTI4 237
+ARGI4
+CNSTI4 361
+ARGI4
+ADDRLP4 20
+ARGP4
+CNSTI4 18
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+LABELV $1455
+ADDRLP4 36
+ADDRGP4 CG_DrawFollow
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $1373
+ADDRGP4 CG_DrawWarmup
+CALLV
+pop
+ADDRGP4 $1373
+JUMPV
+LABELV $1451
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1462
+ADDRGP4 CG_DrawCrosshair
+CALLV
+pop
+LABELV $1462
+ADDRGP4 CG_DrawCrosshairNames
+CALLV
+pop
+ADDRGP4 CG_DrawAmmoWarning
+CALLV
+pop
+ADDRGP4 CG_DrawWeaponSelect
+CALLV
+pop
+ADDRGP4 CG_DrawReward
+CALLV
+pop
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 5
+LTI4 $1464
+ADDRGP4 CG_DrawTeamInfo
+CALLV
+pop
+LABELV $1464
+ADDRGP4 CG_DrawVote
+CALLV
+pop
+ADDRGP4 CG_DrawTeamVote
+CALLV
+pop
+ADDRGP4 CG_DrawLagometer
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawUpperRight
+CALLV
+pop
+ADDRGP4 CG_DrawLowerRight
+CALLV
+pop
+ADDRGP4 CG_DrawLowerLeft
+CALLV
+pop
+ADDRLP4 32
+ADDRGP4 CG_DrawFollow
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $1467
+ADDRGP4 CG_DrawWarmup
+CALLV
+pop
+ADDRGP4 $1468
+JUMPV
+LABELV $1467
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 4
+NEI4 $1469
+CNSTI4 1836
+ADDRGP4 cg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+68
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1469
+CNSTI4 228
+ARGI4
+CNSTI4 90
+ARGI4
+ADDRGP4 $1437
+ARGP4
+ADDRGP4 colorGreen
+ARGP4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $1469
+LABELV $1468
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 3
+EQI4 $1480
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 7
+NEI4 $1475
+LABELV $1480
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 12
+GTI4 $1475
+ADDRLP4 36
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1481
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $1483
+ADDRLP4 40
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+LEI4 $1485
+ADDRLP4 40
+INDIRI4
+CNSTI4 10
+GTI4 $1485
+ADDRLP4 36
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+1380-4
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $1486
+JUMPV
+LABELV $1485
+ADDRLP4 36
+INDIRI4
+CNSTI4 12
+NEI4 $1490
+ADDRGP4 cgs+160652+1432
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $1490
+LABELV $1486
+ADDRGP4 $1481
+ADDRLP4 36
+INDIRI4
+ASGNI4
+LABELV $1483
+ADDRLP4 40
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+LEI4 $1494
+ADDRLP4 40
+INDIRI4
+CNSTI4 10
+GTI4 $1494
+ADDRLP4 44
+ADDRGP4 $1496
+INDIRB
+ASGNB 16
+CNSTF4 1017370378
+ADDRGP4 cg+107612
+INDIRI4
+CVIF4 4
+MULF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 64
+CNSTF4 1048576000
+ADDRLP4 60
+INDIRF4
+MULF4
+CNSTF4 1048576000
+ADDF4
+ASGNF4
+ADDRLP4 44+8
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 44+4
+ADDRLP4 64
+INDIRF4
+ASGNF4
+CNSTI4 256
+ARGI4
+CNSTI4 100
+ARGI4
+ADDRGP4 $1500
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 $448
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 72
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 312
+ARGI4
+CNSTI4 132
+ARGI4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 44
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+CNSTI4 264
+ARGI4
+CNSTI4 164
+ARGI4
+ADDRGP4 $1501
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+CNSTI4 176
+ARGI4
+CNSTI4 196
+ARGI4
+ADDRGP4 $1502
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $1494
+LABELV $1475
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 5
+LTI4 $1503
+ADDRLP4 24
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1504
+JUMPV
+LABELV $1503
+ADDRLP4 24
+ADDRGP4 cg_wopFFAhud+12
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 9
+GTI4 $1510
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+GEI4 $1508
+LABELV $1510
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+LABELV $1508
+LABELV $1504
+ADDRLP4 28
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 -9999
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+LEI4 $1513
+ADDRLP4 28
+INDIRI4
+CNSTI4 12
+NEI4 $1515
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+NEI4 $1515
+CNSTF4 1092616192
+ARGF4
+CNSTF4 1136361472
+ARGF4
+ADDRLP4 40
+CNSTF4 1109917696
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+352
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1515
+ADDRLP4 28
+INDIRI4
+CNSTI4 12
+NEI4 $1519
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $1519
+CNSTF4 1092616192
+ARGF4
+CNSTF4 1136361472
+ARGF4
+ADDRLP4 44
+CNSTF4 1109917696
+ASGNF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+344
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $1520
+JUMPV
+LABELV $1519
+CNSTF4 1092616192
+ARGF4
+CNSTF4 1136361472
+ARGF4
+ADDRLP4 48
+CNSTF4 1109917696
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+CNSTI4 132
+ADDRLP4 28
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $1520
+LABELV $1516
+LABELV $1513
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+CNSTF4 1136001024
+ASGNF4
+ADDRLP4 4
+CNSTF4 1118044160
+ASGNF4
+ADDRLP4 16
+CNSTF4 1122500608
+ASGNF4
+ADDRLP4 8
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 44
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+396
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $1526
+ADDRGP4 $581
+ARGP4
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 20
+ARGI4
+CNSTI4 425
+ARGI4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 colorBlack
+ARGP4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $1526
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 5
+GEI4 $1530
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 4
+NEI4 $1533
+ADDRGP4 cgs+31780
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $1533
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $1540
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1541
+JUMPV
+LABELV $1540
+ADDRLP4 56
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1541
+ADDRLP4 52
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+34912
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $1542
+ADDRLP4 36
+ADDRLP4 52
+INDIRI4
+ASGNI4
+CNSTF4 1091305472
+ARGF4
+CNSTF4 1139212288
+ARGF4
+ADDRLP4 60
+CNSTF4 1096810496
+ASGNF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+540
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $1531
+JUMPV
+LABELV $1542
+ADDRLP4 36
+ADDRGP4 cgs+34916
+INDIRI4
+ASGNI4
+CNSTF4 1091305472
+ARGF4
+CNSTF4 1138589696
+ARGF4
+ADDRLP4 60
+CNSTF4 1096810496
+ASGNF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+540
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $1531
+JUMPV
+LABELV $1533
+ADDRGP4 cgs+34912
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+EQI4 $1550
+ADDRLP4 36
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+ASGNI4
+CNSTF4 1091305472
+ARGF4
+CNSTF4 1139212288
+ARGF4
+ADDRLP4 52
+CNSTF4 1096810496
+ASGNF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+540
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $1531
+JUMPV
+LABELV $1550
+ADDRLP4 36
+ADDRGP4 cgs+34916
+INDIRI4
+ASGNI4
+CNSTF4 1091305472
+ARGF4
+CNSTF4 1138589696
+ARGF4
+ADDRLP4 52
+CNSTF4 1096810496
+ASGNF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+540
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $1531
+JUMPV
+LABELV $1530
+ADDRLP4 36
+ADDRGP4 cgs+34916
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+NEI4 $1561
+CNSTF4 1091305472
+ARGF4
+CNSTF4 1138589696
+ARGF4
+ADDRLP4 52
+CNSTF4 1096810496
+ASGNF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+540
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $1562
+JUMPV
+LABELV $1561
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+NEI4 $1565
+CNSTF4 1091305472
+ARGF4
+CNSTF4 1139212288
+ARGF4
+ADDRLP4 56
+CNSTF4 1096810496
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+540
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $1565
+LABELV $1562
+LABELV $1531
+ADDRGP4 cgs+34912
+INDIRI4
+CNSTI4 -9999
+EQI4 $1569
+ADDRGP4 cgs+34912
+INDIRI4
+CNSTI4 1000
+GEI4 $1572
+ADDRGP4 $1575
+ARGP4
+ADDRGP4 cgs+34912
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 30
+ARGI4
+CNSTI4 442
+ARGI4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 $1573
+JUMPV
+LABELV $1572
+CNSTI4 442
+ARGI4
+ADDRGP4 cgs+34912
+INDIRI4
+ARGI4
+ADDRGP4 DrawBigScore
+CALLV
+pop
+LABELV $1573
+LABELV $1569
+ADDRLP4 36
+INDIRI4
+CNSTI4 -9999
+EQI4 $1578
+ADDRLP4 36
+INDIRI4
+CNSTI4 1000
+GEI4 $1580
+ADDRGP4 $1575
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 30
+ARGI4
+CNSTI4 461
+ARGI4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 $1581
+JUMPV
+LABELV $1580
+CNSTI4 442
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRGP4 DrawBigScore
+CALLV
+pop
+LABELV $1581
+LABELV $1578
+ADDRLP4 56
+CNSTF4 1133740032
+ASGNF4
+ADDRLP4 60
+CNSTF4 0
+ASGNF4
+ADDRLP4 40+8
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 40+4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 cg+131852
+INDIRI4
+LTI4 $1584
+ADDRGP4 cg+131860
+ADDRGP4 cg+131848
+INDIRF4
+ASGNF4
+ADDRGP4 cg+131856
+ADDRGP4 cg+131844
+INDIRF4
+ASGNF4
+ADDRGP4 cg+131864
+ADDRGP4 cg+131852
+INDIRI4
+ASGNI4
+ADDRLP4 64
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRGP4 cg+131852
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 100
+ADDI4
+CVIF4 4
+CNSTF4 1157234688
+ADDRLP4 64
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 68
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 68
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 72
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+131848
+CNSTF4 1101004800
+ADDRLP4 72
+INDIRF4
+MULF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRLP4 76
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 76
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 80
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+131844
+CNSTF4 1084227584
+ADDRLP4 80
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1584
+ADDRLP4 52
+CNSTF4 1112014848
+ASGNF4
+ADDRGP4 cg+131864
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+LEI4 $1598
+ADDRGP4 cg+131864
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+LABELV $1598
+ADDRLP4 36
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 cg+131864
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRGP4 cg+131852
+INDIRI4
+ADDRGP4 cg+131864
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 64
+INDIRF4
+ADDRLP4 64
+INDIRF4
+MULF4
+CNSTF4 1077936128
+CNSTF4 1073741824
+ADDRLP4 64
+INDIRF4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 40+4
+ADDRGP4 cg+131860
+INDIRF4
+ADDRGP4 cg+131848
+INDIRF4
+ADDRGP4 cg+131860
+INDIRF4
+SUBF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 40
+ADDRGP4 cg+131856
+INDIRF4
+ADDRGP4 cg+131844
+INDIRF4
+ADDRGP4 cg+131856
+INDIRF4
+SUBF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+CNSTF4 1137410048
+ARGF4
+ADDRLP4 68
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ARGP4
+ADDRGP4 CG_DrawHead
+CALLV
+pop
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 36
+CNSTF4 1008981770
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 8
+CNSTF4 1130364928
+ASGNF4
+ADDRLP4 12
+CNSTF4 1138655232
+ASGNF4
+ADDRLP4 4
+CNSTF4 1116340224
+ASGNF4
+ADDRLP4 16
+CNSTF4 1101004800
+ASGNF4
+ADDRLP4 8
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 36
+INDIRF4
+CNSTF4 1065353216
+LEF4 $1617
+ADDRLP4 44
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 40
+ADDRLP4 36
+INDIRF4
+ADDRLP4 44
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 44
+INDIRF4
+ASGNF4
+LABELV $1617
+ADDRLP4 44
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 48
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 48
+INDIRF4
+SUBF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 44
+INDIRF4
+GEF4 $1619
+ADDRLP4 52
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 56
+ADDRLP4 52
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 60
+ADDRLP4 4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 60
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 64
+CNSTF4 0
+ASGNF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+564
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $1619
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 68
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 68
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 72
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 68
+INDIRF4
+SUBF4
+ARGF4
+CNSTF4 0
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+548
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRLP4 40
+INDIRF4
+CNSTF4 0
+LEF4 $1625
+ADDRLP4 76
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 80
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 84
+ADDRLP4 76
+INDIRF4
+ADDRLP4 80
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 88
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 88
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 80
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 84
+INDIRF4
+ARGF4
+CNSTF4 0
+ARGF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+556
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $1625
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 36
+CNSTF4 1008981770
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 8
+CNSTF4 1135411200
+ASGNF4
+ADDRLP4 12
+CNSTF4 1138655232
+ASGNF4
+ADDRLP4 4
+CNSTF4 1116340224
+ASGNF4
+ADDRLP4 16
+CNSTF4 1101004800
+ASGNF4
+ADDRLP4 8
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 36
+INDIRF4
+CNSTF4 1065353216
+LEF4 $1630
+ADDRLP4 76
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 40
+ADDRLP4 36
+INDIRF4
+ADDRLP4 76
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 76
+INDIRF4
+ASGNF4
+LABELV $1630
+ADDRLP4 36
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1632
+ADDRLP4 76
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 80
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 84
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 80
+INDIRF4
+SUBF4
+MULF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 80
+INDIRF4
+ARGF4
+CNSTF4 0
+ARGF4
+ADDRLP4 84
+INDIRF4
+ARGF4
+ADDRLP4 84
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+560
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $1632
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 88
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 88
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 92
+CNSTF4 0
+ASGNF4
+ADDRLP4 92
+INDIRF4
+ARGF4
+ADDRLP4 92
+INDIRF4
+ARGF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 cgs+160652+544
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRLP4 40
+INDIRF4
+CNSTF4 0
+LEF4 $1638
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 96
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 96
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 100
+CNSTF4 0
+ASGNF4
+ADDRLP4 100
+INDIRF4
+ARGF4
+ADDRLP4 100
+INDIRF4
+ARGF4
+ADDRLP4 96
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 cgs+160652+552
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $1638
+ADDRLP4 8
+CNSTF4 1129709568
+ASGNF4
+ADDRLP4 12
+CNSTF4 1137377280
+ASGNF4
+ADDRLP4 4
+CNSTF4 1129578496
+ASGNF4
+ADDRLP4 16
+CNSTF4 1116078080
+ASGNF4
+ADDRLP4 8
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 104
+CNSTF4 0
+ASGNF4
+ADDRLP4 104
+INDIRF4
+ARGF4
+ADDRLP4 104
+INDIRF4
+ARGF4
+ADDRLP4 108
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 108
+INDIRF4
+ARGF4
+ADDRLP4 108
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+436
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRLP4 36
+CNSTP4 0
+ASGNP4
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+LABELV $1644
+ADDRLP4 36
+CNSTI4 808
+ADDRLP4 40
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 420
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1648
+ADDRGP4 $1645
+JUMPV
+LABELV $1648
+ADDRLP4 44
+ADDRLP4 36
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 9
+LTI4 $1651
+ADDRLP4 44
+INDIRI4
+CNSTI4 16
+GTI4 $1651
+ADDRLP4 44
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1659-36
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1659
+address $1656
+address $1651
+address $1651
+address $1651
+address $1651
+address $1654
+address $1655
+address $1653
+code
+LABELV $1653
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawBambamIcon
+CALLV
+pop
+ADDRGP4 $1651
+JUMPV
+LABELV $1654
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawBalloonIcon
+CALLV
+pop
+ADDRGP4 $1651
+JUMPV
+LABELV $1655
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawHealthstationIcon
+CALLV
+pop
+ADDRGP4 $1651
+JUMPV
+LABELV $1656
+ADDRLP4 36
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 35
+NEI4 $1651
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawSprayroomIcon
+CALLV
+pop
+LABELV $1651
+LABELV $1645
+ADDRLP4 40
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 1024
+LTI4 $1644
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 7
+EQI4 $1665
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 3
+NEI4 $1661
+LABELV $1665
+ADDRLP4 20
+INDIRI4
+CNSTI4 3
+EQI4 $1661
+ADDRLP4 64
+CNSTF4 0
+ASGNF4
+ADDRLP4 40+8
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 40+4
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 52+8
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 40
+CNSTF4 1116471296
+ASGNF4
+ADDRLP4 52+4
+CNSTF4 1035489772
+ADDRGP4 cg+107612
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 8
+CNSTF4 1141702656
+ASGNF4
+ADDRLP4 12
+CNSTF4 1137999872
+ASGNF4
+ADDRLP4 68
+CNSTF4 1113063424
+ASGNF4
+ADDRLP4 4
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+NEI4 $1671
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRGP4 cgs+160652+360
+INDIRI4
+MULI4
+ADDRGP4 cg_items+4
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 40
+ARGP4
+ADDRLP4 52
+ARGP4
+CNSTF4 1065353216
+ARGF4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+ADDRGP4 $1672
+JUMPV
+LABELV $1671
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+NEI4 $1676
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRGP4 cgs+160652+364
+INDIRI4
+MULI4
+ADDRGP4 cg_items+4
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 40
+ARGP4
+ADDRLP4 52
+ARGP4
+CNSTF4 1065353216
+ARGF4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+ADDRGP4 $1677
+JUMPV
+LABELV $1676
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRGP4 cgs+160652+368
+INDIRI4
+MULI4
+ADDRGP4 cg_items+4
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 40
+ARGP4
+ADDRLP4 52
+ARGP4
+CNSTF4 1065353216
+ARGF4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+LABELV $1677
+LABELV $1672
+ADDRLP4 8
+CNSTF4 1141440512
+ASGNF4
+ADDRLP4 12
+CNSTF4 1136099328
+ASGNF4
+ADDRLP4 4
+CNSTF4 1119354880
+ASGNF4
+ADDRLP4 16
+CNSTF4 1122107392
+ASGNF4
+ADDRLP4 8
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 76
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+476
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRLP4 36
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+ASGNI4
+CNSTF4 1142718464
+ARGF4
+CNSTF4 1136590848
+ARGF4
+ADDRLP4 84
+CNSTF4 1091567616
+ASGNF4
+ADDRLP4 84
+INDIRF4
+ARGF4
+ADDRLP4 84
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LEI4 $1692
+ADDRLP4 80
+ADDRGP4 cgs+160652+568
+INDIRI4
+ASGNI4
+ADDRGP4 $1693
+JUMPV
+LABELV $1692
+ADDRLP4 80
+ADDRGP4 cgs+160652+572
+INDIRI4
+ASGNI4
+LABELV $1693
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTF4 1142718464
+ARGF4
+CNSTF4 1136951296
+ARGF4
+ADDRLP4 92
+CNSTF4 1091567616
+ASGNF4
+ADDRLP4 92
+INDIRF4
+ARGF4
+ADDRLP4 92
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+LEI4 $1699
+ADDRLP4 88
+ADDRGP4 cgs+160652+568
+INDIRI4
+ASGNI4
+ADDRGP4 $1700
+JUMPV
+LABELV $1699
+ADDRLP4 88
+ADDRGP4 cgs+160652+572
+INDIRI4
+ASGNI4
+LABELV $1700
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTF4 1142718464
+ARGF4
+CNSTF4 1137344512
+ARGF4
+ADDRLP4 100
+CNSTF4 1091567616
+ASGNF4
+ADDRLP4 100
+INDIRF4
+ARGF4
+ADDRLP4 100
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRI4
+CNSTI4 2
+LEI4 $1706
+ADDRLP4 96
+ADDRGP4 cgs+160652+568
+INDIRI4
+ASGNI4
+ADDRGP4 $1707
+JUMPV
+LABELV $1706
+ADDRLP4 96
+ADDRGP4 cgs+160652+572
+INDIRI4
+ASGNI4
+LABELV $1707
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTF4 1142718464
+ARGF4
+CNSTF4 1137704960
+ARGF4
+ADDRLP4 108
+CNSTF4 1091567616
+ASGNF4
+ADDRLP4 108
+INDIRF4
+ARGF4
+ADDRLP4 108
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRI4
+CNSTI4 3
+LEI4 $1713
+ADDRLP4 104
+ADDRGP4 cgs+160652+568
+INDIRI4
+ASGNI4
+ADDRGP4 $1714
+JUMPV
+LABELV $1713
+ADDRLP4 104
+ADDRGP4 cgs+160652+572
+INDIRI4
+ASGNI4
+LABELV $1714
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTF4 1142718464
+ARGF4
+CNSTF4 1138065408
+ARGF4
+ADDRLP4 116
+CNSTF4 1091567616
+ASGNF4
+ADDRLP4 116
+INDIRF4
+ARGF4
+ADDRLP4 116
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRI4
+CNSTI4 4
+LEI4 $1720
+ADDRLP4 112
+ADDRGP4 cgs+160652+568
+INDIRI4
+ASGNI4
+ADDRGP4 $1721
+JUMPV
+LABELV $1720
+ADDRLP4 112
+ADDRGP4 cgs+160652+572
+INDIRI4
+ASGNI4
+LABELV $1721
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTF4 1142718464
+ARGF4
+CNSTF4 1138458624
+ARGF4
+ADDRLP4 124
+CNSTF4 1091567616
+ASGNF4
+ADDRLP4 124
+INDIRF4
+ARGF4
+ADDRLP4 124
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRI4
+CNSTI4 5
+LEI4 $1727
+ADDRLP4 120
+ADDRGP4 cgs+160652+568
+INDIRI4
+ASGNI4
+ADDRGP4 $1728
+JUMPV
+LABELV $1727
+ADDRLP4 120
+ADDRGP4 cgs+160652+572
+INDIRI4
+ASGNI4
+LABELV $1728
+ADDRLP4 120
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTF4 1142718464
+ARGF4
+CNSTF4 1138819072
+ARGF4
+ADDRLP4 132
+CNSTF4 1091567616
+ASGNF4
+ADDRLP4 132
+INDIRF4
+ARGF4
+ADDRLP4 132
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRI4
+CNSTI4 6
+LEI4 $1734
+ADDRLP4 128
+ADDRGP4 cgs+160652+568
+INDIRI4
+ASGNI4
+ADDRGP4 $1735
+JUMPV
+LABELV $1734
+ADDRLP4 128
+ADDRGP4 cgs+160652+572
+INDIRI4
+ASGNI4
+LABELV $1735
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTF4 1142718464
+ARGF4
+CNSTF4 1139179520
+ARGF4
+ADDRLP4 140
+CNSTF4 1091567616
+ASGNF4
+ADDRLP4 140
+INDIRF4
+ARGF4
+ADDRLP4 140
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRI4
+CNSTI4 7
+LEI4 $1741
+ADDRLP4 136
+ADDRGP4 cgs+160652+568
+INDIRI4
+ASGNI4
+ADDRGP4 $1742
+JUMPV
+LABELV $1741
+ADDRLP4 136
+ADDRGP4 cgs+160652+572
+INDIRI4
+ASGNI4
+LABELV $1742
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $1661
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 8
+NEI4 $1743
+ADDRLP4 20
+INDIRI4
+CNSTI4 3
+EQI4 $1743
+ADDRLP4 40
+ADDRGP4 $1746
+INDIRB
+ASGNB 16
+ADDRLP4 56
+ADDRGP4 $1747
+INDIRB
+ASGNB 16
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+LABELV $1748
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 72
+ARGP4
+ADDRGP4 CG_GetBalloonColor
+CALLV
+pop
+ADDRLP4 72
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTF4 1142374400
+ARGF4
+CNSTI4 446
+CNSTI4 36
+ADDRLP4 36
+INDIRI4
+MULI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 88
+CNSTF4 1105199104
+ASGNF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+524
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $1749
+ADDRLP4 36
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 3
+LTI4 $1748
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 36
+ADDRGP4 cg+108604+184+36
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $1757
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LEI4 $1759
+ADDRLP4 40
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $1760
+JUMPV
+LABELV $1759
+ADDRLP4 36
+ADDRLP4 36
+INDIRI4
+NEGI4
+ASGNI4
+ADDRLP4 56
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1760
+ADDRLP4 36
+INDIRI4
+CNSTI4 11
+LEI4 $1761
+ADDRLP4 36
+CNSTI4 11
+ASGNI4
+LABELV $1761
+CNSTF4 1142046720
+ARGF4
+ADDRLP4 88
+CNSTF4 1078355558
+ADDRLP4 36
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+CNSTF4 1139638272
+ADDRLP4 88
+INDIRF4
+SUBF4
+ARGF4
+CNSTF4 1090519040
+ARGF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+528
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $1757
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+NEI4 $1765
+CNSTF4 1141899264
+ARGF4
+CNSTF4 1135607808
+ARGF4
+CNSTF4 1115684864
+ARGF4
+CNSTF4 1124073472
+ARGF4
+ADDRGP4 cgs+160652+516
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $1766
+JUMPV
+LABELV $1765
+CNSTF4 1141899264
+ARGF4
+CNSTF4 1135607808
+ARGF4
+CNSTF4 1115684864
+ARGF4
+CNSTF4 1124073472
+ARGF4
+ADDRGP4 cgs+160652+520
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $1766
+LABELV $1743
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 6
+NEI4 $1771
+ADDRLP4 20
+INDIRI4
+CNSTI4 3
+EQI4 $1771
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+NEI4 $1774
+ADDRGP4 cgs+160652+532
+INDIRI4
+CNSTI4 0
+NEI4 $1776
+CNSTF4 1142374400
+ARGF4
+CNSTF4 1136361472
+ARGF4
+ADDRLP4 36
+CNSTF4 1103626240
+ASGNF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRGP4 cgs+34920
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+24
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTF4 1142374400
+ARGF4
+CNSTF4 1138655232
+ARGF4
+ADDRLP4 40
+CNSTF4 1103626240
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRGP4 cgs+34924
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+36
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 cg+108604+312+36
+INDIRI4
+CNSTI4 0
+EQI4 $1786
+CNSTF4 1142325248
+ARGF4
+CNSTF4 1137410048
+ARGF4
+ADDRLP4 44
+CNSTF4 1108082688
+ASGNF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+CNSTI4 2
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawFlagModel
+CALLV
+pop
+LABELV $1786
+CNSTF4 1141899264
+ARGF4
+CNSTF4 1135607808
+ARGF4
+CNSTF4 1115684864
+ARGF4
+CNSTF4 1124073472
+ARGF4
+ADDRGP4 cgs+160652+516
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $1775
+JUMPV
+LABELV $1776
+CNSTF4 1142456320
+ARGF4
+CNSTF4 1136197632
+ARGF4
+ADDRLP4 36
+CNSTF4 1104150528
+ASGNF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRGP4 cgs+34920
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+24
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTF4 1142456320
+ARGF4
+CNSTF4 1137246208
+ARGF4
+ADDRLP4 40
+CNSTF4 1104150528
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRGP4 cgs+34924
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+36
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 cg+108604+312+36
+INDIRI4
+CNSTI4 0
+EQI4 $1799
+CNSTF4 1141850112
+ARGF4
+CNSTF4 1138065408
+ARGF4
+ADDRLP4 44
+CNSTF4 1112014848
+ASGNF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+CNSTI4 2
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawFlagModel
+CALLV
+pop
+LABELV $1799
+CNSTF4 1141669888
+ARGF4
+CNSTF4 1136033792
+ARGF4
+CNSTF4 1117519872
+ARGF4
+CNSTF4 1122369536
+ARGF4
+ADDRGP4 cgs+160652+532
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $1775
+JUMPV
+LABELV $1774
+ADDRGP4 cgs+160652+536
+INDIRI4
+CNSTI4 0
+NEI4 $1806
+CNSTF4 1142374400
+ARGF4
+CNSTF4 1136361472
+ARGF4
+ADDRLP4 36
+CNSTF4 1103626240
+ASGNF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRGP4 cgs+34924
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+36
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTF4 1142374400
+ARGF4
+CNSTF4 1138655232
+ARGF4
+ADDRLP4 40
+CNSTF4 1103626240
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRGP4 cgs+34920
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+24
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 cg+108604+312+32
+INDIRI4
+CNSTI4 0
+EQI4 $1816
+CNSTF4 1142325248
+ARGF4
+CNSTF4 1137410048
+ARGF4
+ADDRLP4 44
+CNSTF4 1108082688
+ASGNF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawFlagModel
+CALLV
+pop
+LABELV $1816
+CNSTF4 1141899264
+ARGF4
+CNSTF4 1135607808
+ARGF4
+CNSTF4 1115684864
+ARGF4
+CNSTF4 1124073472
+ARGF4
+ADDRGP4 cgs+160652+520
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $1807
+JUMPV
+LABELV $1806
+CNSTF4 1142456320
+ARGF4
+CNSTF4 1136197632
+ARGF4
+ADDRLP4 36
+CNSTF4 1104150528
+ASGNF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRGP4 cgs+34924
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+36
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTF4 1142456320
+ARGF4
+CNSTF4 1137246208
+ARGF4
+ADDRLP4 40
+CNSTF4 1104150528
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRGP4 cgs+34920
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+24
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 cg+108604+312+32
+INDIRI4
+CNSTI4 0
+EQI4 $1829
+CNSTF4 1141850112
+ARGF4
+CNSTF4 1138065408
+ARGF4
+ADDRLP4 44
+CNSTF4 1112014848
+ASGNF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawFlagModel
+CALLV
+pop
+LABELV $1829
+CNSTF4 1141669888
+ARGF4
+CNSTF4 1136033792
+ARGF4
+CNSTF4 1117519872
+ARGF4
+CNSTF4 1122369536
+ARGF4
+ADDRGP4 cgs+160652+536
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $1807
+LABELV $1775
+LABELV $1771
+ADDRLP4 36
+CNSTI4 4
+ASGNI4
+ADDRGP4 cgs+31464
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $1836
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+31780
+INDIRI4
+ADDRLP4 36
+INDIRI4
+BANDI4
+ADDRLP4 40
+INDIRI4
+NEI4 $1836
+ADDRGP4 cg_icons+12
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 40
+INDIRI4
+EQI4 $1836
+ADDRLP4 48
+ADDRGP4 cg+112120+36
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31780
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1843
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1849
+JUMPV
+LABELV $1846
+CNSTI4 72
+ADDRLP4 44
+INDIRI4
+MULI4
+ADDRGP4 cg+112120+36
+ADDP4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LEI4 $1851
+ADDRLP4 48
+CNSTI4 72
+ADDRLP4 44
+INDIRI4
+MULI4
+ADDRGP4 cg+112120+36
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1851
+LABELV $1847
+ADDRLP4 44
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1849
+ADDRLP4 44
+INDIRI4
+ADDRGP4 cg+112104
+INDIRI4
+LTI4 $1846
+LABELV $1843
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1860
+JUMPV
+LABELV $1857
+ADDRLP4 72
+CNSTI4 72
+ADDRLP4 44
+INDIRI4
+MULI4
+ADDRGP4 cg+112120
+ADDP4
+ASGNP4
+ADDRLP4 52
+CNSTI4 1836
+ADDRLP4 72
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088
+ADDP4
+ASGNP4
+ADDRLP4 56
+ADDRGP4 $1864
+INDIRB
+ASGNB 16
+ADDRLP4 76
+ADDRLP4 52
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+LEI4 $1865
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 76
+INDIRI4
+SUBI4
+CNSTI4 1500
+GEI4 $1865
+ADDRLP4 56+12
+CNSTI4 1500
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 52
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRI4
+SUBI4
+SUBI4
+CNSTI4 1000
+DIVI4
+CVIF4 4
+ASGNF4
+ADDRLP4 56+12
+INDIRF4
+CNSTF4 1065353216
+LEF4 $1870
+ADDRLP4 56+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $1871
+JUMPV
+LABELV $1870
+ADDRLP4 56+12
+INDIRF4
+CNSTF4 0
+GEF4 $1874
+ADDRLP4 56+12
+CNSTF4 0
+ASGNF4
+LABELV $1874
+LABELV $1871
+ADDRLP4 56+12
+ADDRLP4 56+12
+INDIRF4
+ADDRGP4 cg_LPSwallhackAlpha+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 52
+INDIRP4
+CNSTI4 144
+ADDP4
+ARGP4
+ADDRGP4 cg+110648
+ARGP4
+ADDRLP4 84
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 92
+ADDRGP4 Calculate_2DOf3D
+CALLI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 92
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 80
+INDIRF4
+CNSTF4 0
+EQF4 $1881
+ADDRLP4 80
+INDIRF4
+ARGF4
+ADDRLP4 100
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 96
+CNSTF4 1065353216
+CNSTF4 990057071
+ADDRLP4 100
+INDIRF4
+MULF4
+DIVF4
+ASGNF4
+ADDRLP4 96
+INDIRF4
+CNSTF4 1065353216
+LEF4 $1883
+ADDRLP4 96
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $1884
+JUMPV
+LABELV $1883
+ADDRLP4 96
+INDIRF4
+CNSTF4 1056964608
+GEF4 $1885
+ADDRLP4 96
+CNSTF4 1056964608
+ASGNF4
+LABELV $1885
+LABELV $1884
+ADDRLP4 96
+ADDRLP4 96
+INDIRF4
+ADDRGP4 cg_LPSwallhackSize+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 104
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 56+12
+ADDRLP4 56+12
+INDIRF4
+CNSTF4 1060320051
+ADDRLP4 104
+INDIRF4
+CNSTF4 914765757
+ADDRLP4 80
+INDIRF4
+MULF4
+ADDRLP4 104
+INDIRF4
+ADDF4
+DIVF4
+MULF4
+CNSTF4 1050253722
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 56+12
+INDIRF4
+CNSTF4 1065353216
+LEF4 $1889
+ADDRLP4 56+12
+CNSTF4 1065353216
+ASGNF4
+LABELV $1889
+ADDRLP4 56
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 72
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+GEI4 $1893
+ADDRLP4 108
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 112
+CNSTF4 1098907648
+ADDRLP4 108
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 112
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 112
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 116
+CNSTF4 1107296256
+ADDRLP4 108
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 116
+INDIRF4
+ARGF4
+ADDRLP4 116
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+320
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $1894
+JUMPV
+LABELV $1893
+ADDRLP4 108
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 112
+CNSTF4 1098907648
+ADDRLP4 108
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 112
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 112
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 116
+CNSTF4 1107296256
+ADDRLP4 108
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 116
+INDIRF4
+ARGF4
+ADDRLP4 116
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+324
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $1894
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1881
+LABELV $1865
+LABELV $1858
+ADDRLP4 44
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1860
+ADDRLP4 44
+INDIRI4
+ADDRGP4 cg+112104
+INDIRI4
+LTI4 $1857
+LABELV $1836
+ADDRLP4 44
+ADDRGP4 CG_DrawScoreboard
+CALLI4
+ASGNI4
+ADDRGP4 cg+121344
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 cg+121344
+INDIRI4
+CNSTI4 0
+NEI4 $1900
+ADDRGP4 CG_DrawCenterString
+CALLV
+pop
+LABELV $1900
+LABELV $1373
+endproc CG_Draw2D 144 40
+proc CG_DrawTourneyScoreboard 0 0
+ADDRGP4 CG_DrawOldTourneyScoreboard
+CALLV
+pop
+LABELV $1903
+endproc CG_DrawTourneyScoreboard 0 0
+lit
+align 4
+LABELV $2100
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1036831949
+align 4
+LABELV $2101
+byte 4 1065353216
+byte 4 1056964608
+byte 4 0
+byte 4 1065353216
+align 4
+LABELV $2206
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+align 4
+LABELV $2263
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+align 4
+LABELV $2326
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export CG_DrawActive
+code
+proc CG_DrawActive 188 44
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1905
+ADDRGP4 CG_DrawInformation
+CALLV
+pop
+ADDRGP4 $1904
+JUMPV
+LABELV $1905
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1908
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $1908
+ADDRGP4 CG_DrawTourneyScoreboard
+CALLV
+pop
+ADDRGP4 $1904
+JUMPV
+LABELV $1908
+ADDRGP4 CG_TileClear
+CALLV
+pop
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+111040
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $1912
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $1912
+ADDRGP4 cgs+160652+632
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $1912
+ADDRLP4 16
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 96
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 120
+CNSTU1 255
+ASGNU1
+ADDRLP4 16+72+20+2
+ADDRLP4 120
+INDIRU1
+ASGNU1
+ADDRLP4 16+48+20+2
+ADDRLP4 120
+INDIRU1
+ASGNU1
+ADDRLP4 16+24+20+2
+ADDRLP4 120
+INDIRU1
+ASGNU1
+ADDRLP4 16+20+2
+ADDRLP4 120
+INDIRU1
+ASGNU1
+ADDRLP4 121
+CNSTU1 125
+ASGNU1
+ADDRLP4 16+72+20+3
+ADDRLP4 121
+INDIRU1
+ASGNU1
+ADDRLP4 16+48+20+3
+ADDRLP4 121
+INDIRU1
+ASGNU1
+ADDRLP4 16+24+20+3
+ADDRLP4 121
+INDIRU1
+ASGNU1
+ADDRLP4 16+20+3
+ADDRLP4 121
+INDIRU1
+ASGNU1
+ADDRLP4 124
+CNSTF4 1084227584
+ASGNF4
+ADDRLP4 16
+ADDRGP4 cg+110648+24
+INDIRF4
+ADDRLP4 124
+INDIRF4
+ADDRGP4 cg+110648+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+ADDRLP4 124
+INDIRF4
+ADDRGP4 cg+110648+36+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+8
+ADDRGP4 cg+110648+24+8
+INDIRF4
+CNSTF4 1084227584
+ADDRGP4 cg+110648+36+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+48
+ADDRLP4 16
+INDIRB
+ASGNB 12
+CNSTF4 1078530011
+CNSTF4 1056964608
+ADDRGP4 cg+110648+16
+INDIRF4
+MULF4
+MULF4
+CNSTF4 1127481344
+DIVF4
+ARGF4
+ADDRLP4 128
+ADDRGP4 tan
+CALLF4
+ASGNF4
+ADDRLP4 116
+CNSTF4 1084227584
+ADDRLP4 128
+INDIRF4
+MULF4
+ASGNF4
+CNSTF4 1078530011
+CNSTF4 1056964608
+ADDRGP4 cg+110648+20
+INDIRF4
+MULF4
+MULF4
+CNSTF4 1127481344
+DIVF4
+ARGF4
+ADDRLP4 132
+ADDRGP4 tan
+CALLF4
+ASGNF4
+ADDRLP4 112
+CNSTF4 1084227584
+ADDRLP4 132
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 136
+ADDRLP4 116
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRGP4 cg+110648+36+12
+INDIRF4
+ADDRLP4 136
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 16+4
+INDIRF4
+ADDRGP4 cg+110648+36+12+4
+INDIRF4
+ADDRLP4 136
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 16+8
+INDIRF4
+ADDRGP4 cg+110648+36+12+8
+INDIRF4
+ADDRLP4 116
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+48
+ADDRLP4 16+48
+INDIRF4
+ADDRGP4 cg+110648+36+12
+INDIRF4
+ADDRLP4 116
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+48+4
+ADDRLP4 16+48+4
+INDIRF4
+ADDRGP4 cg+110648+36+12+4
+INDIRF4
+ADDRLP4 116
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+48+8
+ADDRLP4 16+48+8
+INDIRF4
+ADDRGP4 cg+110648+36+12+8
+INDIRF4
+ADDRLP4 116
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+24
+ADDRLP4 16
+INDIRB
+ASGNB 12
+ADDRLP4 16+72
+ADDRLP4 16+48
+INDIRB
+ASGNB 12
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRGP4 cg+110648+36+24
+INDIRF4
+ADDRLP4 112
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 16+4
+INDIRF4
+ADDRGP4 cg+110648+36+24+4
+INDIRF4
+ADDRLP4 112
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 16+8
+INDIRF4
+ADDRGP4 cg+110648+36+24+8
+INDIRF4
+ADDRLP4 112
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+24
+ADDRLP4 16+24
+INDIRF4
+ADDRGP4 cg+110648+36+24
+INDIRF4
+ADDRLP4 112
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+24+4
+ADDRLP4 16+24+4
+INDIRF4
+ADDRGP4 cg+110648+36+24+4
+INDIRF4
+ADDRLP4 112
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+24+8
+ADDRLP4 16+24+8
+INDIRF4
+ADDRGP4 cg+110648+36+24+8
+INDIRF4
+ADDRLP4 112
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+48
+ADDRLP4 16+48
+INDIRF4
+ADDRGP4 cg+110648+36+24
+INDIRF4
+ADDRLP4 112
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+48+4
+ADDRLP4 16+48+4
+INDIRF4
+ADDRGP4 cg+110648+36+24+4
+INDIRF4
+ADDRLP4 112
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+48+8
+ADDRLP4 16+48+8
+INDIRF4
+ADDRGP4 cg+110648+36+24+8
+INDIRF4
+ADDRLP4 112
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+72
+ADDRLP4 16+72
+INDIRF4
+ADDRGP4 cg+110648+36+24
+INDIRF4
+ADDRLP4 112
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+72+4
+ADDRLP4 16+72+4
+INDIRF4
+ADDRGP4 cg+110648+36+24+4
+INDIRF4
+ADDRLP4 112
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+72+8
+ADDRLP4 16+72+8
+INDIRF4
+ADDRGP4 cg+110648+36+24+8
+INDIRF4
+ADDRLP4 112
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cgs+160652+632
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+LABELV $1912
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2082
+ADDRGP4 CG_DrawCrosshair3D
+CALLV
+pop
+LABELV $2082
+ADDRGP4 cg+110648
+ARGP4
+ADDRGP4 trap_R_RenderScene
+CALLV
+pop
+ADDRGP4 cg_printDir+12
+INDIRI4
+CNSTI4 0
+EQI4 $2085
+ADDRGP4 $2088
+ARGP4
+ADDRGP4 cg+110648+36
+INDIRF4
+ARGF4
+ADDRGP4 cg+110648+36+4
+INDIRF4
+ARGF4
+ADDRGP4 cg+110648+36+8
+INDIRF4
+ARGF4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $2085
+ADDRGP4 AddLFsToScreen
+CALLV
+pop
+ADDRGP4 cg+111040
+INDIRI4
+CNSTI4 0
+EQI4 $2097
+ADDRLP4 28
+ADDRGP4 $2100
+INDIRB
+ASGNB 16
+ADDRLP4 44
+ADDRGP4 $2101
+INDIRB
+ASGNB 16
+ADDRLP4 132
+CNSTI4 188
+ASGNI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 132
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 7
+EQI4 $2108
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 132
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $2107
+LABELV $2108
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $2102
+LABELV $2107
+ADDRGP4 CG_ZoomDown_f
+CALLV
+pop
+ADDRGP4 $2103
+JUMPV
+LABELV $2102
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $2109
+ADDRGP4 cg+111036
+INDIRI4
+CNSTI4 0
+LEI4 $2112
+ADDRGP4 cg+111036
+INDIRI4
+CNSTI4 9
+GTI4 $2112
+ADDRLP4 136
+CNSTI4 200
+ASGNI4
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 cg+111044
+INDIRI4
+SUBI4
+ADDRLP4 136
+INDIRI4
+ADDRGP4 cg+111036
+INDIRI4
+MULI4
+ADDRLP4 136
+INDIRI4
+SUBI4
+LTI4 $2112
+ADDRGP4 cg+111036
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+588-4
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRLP4 140
+ADDRGP4 cg+111036
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ADDRLP4 140
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2112
+ADDRGP4 cg+110648
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cg+110648+4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cg+110648+8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cg+110648+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 140
+CNSTF4 0
+ASGNF4
+ADDRLP4 140
+INDIRF4
+ARGF4
+ADDRLP4 140
+INDIRF4
+ARGF4
+ADDRLP4 144
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 144
+INDIRF4
+ARGF4
+ADDRLP4 144
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+576
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRLP4 16
+CNSTF4 3187671040
+CNSTF4 993397696
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+CNSTF4 1133248512
+ARGF4
+CNSTF4 1120403456
+ARGF4
+CNSTF4 1109393408
+ARGF4
+CNSTF4 1101004800
+ARGF4
+ADDRLP4 148
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 148
+INDIRF4
+ARGF4
+CNSTF4 0
+ARGF4
+ADDRLP4 148
+INDIRF4
+CNSTF4 1048576000
+ADDF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 28
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 cgs+160652+584
+INDIRI4
+ARGI4
+ADDRGP4 DrawPic2Color
+CALLV
+pop
+CNSTF4 1133248512
+ARGF4
+CNSTF4 1120403456
+ARGF4
+CNSTF4 1109393408
+ARGF4
+CNSTF4 1101004800
+ARGF4
+ADDRLP4 152
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 156
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 152
+INDIRF4
+ADDRLP4 156
+INDIRF4
+ADDF4
+ARGF4
+CNSTF4 0
+ARGF4
+ADDRLP4 152
+INDIRF4
+CNSTF4 1067450368
+ADDF4
+ARGF4
+ADDRLP4 156
+INDIRF4
+ARGF4
+ADDRLP4 28
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 cgs+160652+584
+INDIRI4
+ARGI4
+ADDRGP4 DrawPic2Color
+CALLV
+pop
+CNSTF4 1134559232
+ARGF4
+CNSTF4 1120403456
+ARGF4
+CNSTF4 1109393408
+ARGF4
+CNSTF4 1101004800
+ARGF4
+ADDRLP4 160
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 160
+INDIRF4
+CNSTF4 1048576000
+ADDF4
+ARGF4
+CNSTF4 0
+ARGF4
+ADDRLP4 160
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 cgs+160652+584
+INDIRI4
+ARGI4
+ADDRGP4 DrawPic2Color
+CALLV
+pop
+CNSTF4 1134559232
+ARGF4
+CNSTF4 1120403456
+ARGF4
+CNSTF4 1109393408
+ARGF4
+CNSTF4 1101004800
+ARGF4
+ADDRLP4 164
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 164
+INDIRF4
+CNSTF4 1067450368
+ADDF4
+ARGF4
+CNSTF4 0
+ARGF4
+ADDRLP4 164
+INDIRF4
+CNSTF4 1069547520
+ADDF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 cgs+160652+584
+INDIRI4
+ARGI4
+ADDRGP4 DrawPic2Color
+CALLV
+pop
+ADDRLP4 116
+CNSTF4 1131937792
+ASGNF4
+ADDRLP4 120
+CNSTF4 1135869952
+ASGNF4
+ADDRLP4 124
+CNSTF4 1125384192
+ASGNF4
+ADDRLP4 128
+CNSTF4 1102577664
+ASGNF4
+ADDRLP4 116
+ARGP4
+ADDRLP4 120
+ARGP4
+ADDRLP4 124
+ARGP4
+ADDRLP4 128
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 116
+INDIRF4
+ARGF4
+ADDRLP4 120
+INDIRF4
+ARGF4
+ADDRLP4 124
+INDIRF4
+ARGF4
+ADDRLP4 128
+INDIRF4
+ARGF4
+ADDRLP4 168
+CNSTF4 1061662228
+ASGNF4
+ADDRLP4 168
+INDIRF4
+ADDRGP4 cg+111028
+INDIRF4
+MULF4
+ARGF4
+CNSTF4 0
+ARGF4
+ADDRLP4 168
+INDIRF4
+ADDRGP4 cg+111028
+INDIRF4
+MULF4
+CNSTF4 1046562734
+ADDF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 cgs+160652+580
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRLP4 172
+CNSTF4 1203982336
+ASGNF4
+ADDRLP4 16
+ADDRGP4 cg+110648+24
+INDIRF4
+ADDRLP4 172
+INDIRF4
+ADDRGP4 cg+110648+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+ADDRLP4 172
+INDIRF4
+ADDRGP4 cg+110648+36+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+8
+ADDRGP4 cg+110648+24+8
+INDIRF4
+CNSTF4 1203982336
+ADDRGP4 cg+110648+36+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+ARGP4
+ADDRGP4 cg+110648+24
+ARGP4
+ADDRLP4 176
+CNSTP4 0
+ASGNP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 16
+ADDRLP4 60+12
+INDIRF4
+ADDRGP4 cg+110648+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 60+12+4
+INDIRF4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 60+12+8
+INDIRF4
+ADDRGP4 cg+110648+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+ARGP4
+ADDRLP4 180
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 180
+INDIRF4
+ASGNF4
+ADDRGP4 $2182
+ARGP4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 184
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 320
+ARGI4
+CNSTI4 190
+ARGI4
+ADDRLP4 184
+INDIRP4
+ARGP4
+ADDRLP4 44
+ARGP4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 $2110
+JUMPV
+LABELV $2109
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $2183
+ADDRGP4 cg+110648
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cg+110648+4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cg+110648+8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cg+110648+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 136
+CNSTF4 0
+ASGNF4
+ADDRLP4 136
+INDIRF4
+ARGF4
+ADDRLP4 136
+INDIRF4
+ARGF4
+ADDRLP4 140
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 140
+INDIRF4
+ARGF4
+ADDRLP4 140
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+624
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $2183
+LABELV $2110
+LABELV $2103
+LABELV $2097
+ADDRLP4 16
+CNSTI4 1836
+ASGNI4
+ADDRLP4 20
+CNSTI4 184
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+160
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+164
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+108596
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $2201
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 24
+INDIRI4
+NEI4 $2201
+ADDRLP4 4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $2201
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 500
+GEI4 $2201
+ADDRLP4 32
+ADDRGP4 $2206
+INDIRB
+ASGNB 16
+ADDRLP4 48
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+CNSTF4 1065353216
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1140457472
+DIVF4
+SUBF4
+ASGNF4
+ADDRLP4 32+12
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 32+8
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 32+4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+NEI4 $2212
+ADDRGP4 cg+110648
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cg+110648+4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cg+110648+8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cg+110648+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 56
+CNSTF4 0
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 60
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+972
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRGP4 $2213
+JUMPV
+LABELV $2212
+ADDRLP4 48
+INDIRI4
+CNSTI4 2
+NEI4 $2223
+ADDRGP4 cg+110648
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cg+110648+4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cg+110648+8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cg+110648+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 64
+CNSTF4 0
+ASGNF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 68
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+968
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRGP4 $2224
+JUMPV
+LABELV $2223
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $2234
+ADDRGP4 cg+110648
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cg+110648+4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cg+110648+8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cg+110648+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 76
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+976
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $2234
+LABELV $2224
+LABELV $2213
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $2201
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+108596
+INDIRI4
+ADDRLP4 32
+INDIRI4
+NEI4 $2245
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $2245
+ADDRGP4 cg+110648
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cg+110648+4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cg+110648+8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cg+110648+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 36
+CNSTF4 0
+ASGNF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 40
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+136
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRGP4 $2246
+JUMPV
+LABELV $2245
+ADDRGP4 cg+131836
+INDIRF4
+CNSTF4 0
+EQF4 $2258
+ADDRGP4 cg+107612
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+131824
+INDIRF4
+SUBF4
+CNSTF4 1140457472
+GEF4 $2258
+ADDRLP4 36
+ADDRGP4 $2263
+INDIRB
+ASGNB 16
+ADDRLP4 52
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 36+12
+ADDRLP4 52
+INDIRF4
+ADDRLP4 52
+INDIRF4
+ADDRGP4 cg+107612
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+131824
+INDIRF4
+SUBF4
+CNSTF4 1140457472
+DIVF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 36
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 cg+110648
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cg+110648+4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cg+110648+8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cg+110648+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 56
+CNSTF4 0
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 60
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+132
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $2259
+JUMPV
+LABELV $2258
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 3001
+LEI4 $2276
+ADDRGP4 cg+108596
+INDIRI4
+CNSTI4 0
+NEI4 $2276
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+CNSTI4 3000
+GEI4 $2276
+ADDRLP4 52
+CNSTF4 1065353216
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1161527296
+DIVF4
+SUBF4
+ASGNF4
+ADDRLP4 36+12
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 36+8
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 36+4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 cg+110648
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cg+110648+4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cg+110648+8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cg+110648+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 56
+CNSTF4 0
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 60
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+140
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $2276
+LABELV $2259
+LABELV $2246
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Draw2D
+CALLV
+pop
+ADDRGP4 $2294
+ARGP4
+ADDRLP4 36
+ADDRGP4 CG_GetCvarInt
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $2295
+ADDRGP4 $2297
+ARGP4
+ADDRLP4 44
+ADDRGP4 CG_GetCvarInt
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 -1
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_draw2D+12
+INDIRI4
+ADDRLP4 48
+INDIRI4
+EQI4 $2298
+ADDRLP4 40
+INDIRI4
+ADDRLP4 48
+INDIRI4
+NEI4 $2298
+ADDRLP4 52
+ADDRGP4 trap_Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $2298
+ADDRLP4 56
+ADDRGP4 cg+108572
+INDIRI4
+ASGNI4
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+LABELV $2302
+ADDRLP4 56
+ADDRLP4 56
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 4
+LTI4 $2305
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+LABELV $2305
+ADDRLP4 64
+ADDRLP4 56
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRGP4 cg+108556
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2307
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 64
+INDIRI4
+ADDRGP4 cg+108556
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 1000
+ADDRLP4 0
+INDIRI4
+MULI4
+GEI4 $2307
+ADDRLP4 56
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+108540
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2312
+CNSTF4 1065353216
+ARGF4
+CNSTI4 14
+ADDRLP4 60
+INDIRI4
+MULI4
+CVIF4 4
+ARGF4
+ADDRLP4 68
+CNSTF4 1096810496
+ASGNF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+108540
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $2312
+CNSTI4 150
+ADDRLP4 56
+INDIRI4
+MULI4
+ADDRGP4 cg+107940
+ADDP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 56
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+108540
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2320
+ADDRLP4 68
+CNSTI4 16
+ASGNI4
+ADDRGP4 $2321
+JUMPV
+LABELV $2320
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+LABELV $2321
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 76
+CNSTI4 1
+ASGNI4
+CNSTI4 14
+ADDRLP4 60
+INDIRI4
+MULI4
+ADDRLP4 76
+INDIRI4
+ADDI4
+ARGI4
+CNSTI4 150
+ADDRLP4 56
+INDIRI4
+MULI4
+ADDRGP4 cg+107940
+ADDP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+CNSTI4 12
+ARGI4
+ADDRLP4 72
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRLP4 60
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2307
+LABELV $2303
+ADDRLP4 56
+INDIRI4
+ADDRGP4 cg+108572
+INDIRI4
+NEI4 $2302
+LABELV $2298
+LABELV $2295
+ADDRGP4 cg_cineDrawLetterBox+12
+INDIRI4
+CNSTI4 0
+EQI4 $2323
+ADDRLP4 44
+ADDRGP4 $2326
+INDIRB
+ASGNB 16
+ADDRLP4 40
+CNSTI4 70
+ASGNI4
+ADDRLP4 60
+CNSTF4 0
+ASGNF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 44
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+CNSTF4 0
+ARGF4
+ADDRLP4 64
+ADDRLP4 40
+INDIRI4
+ASGNI4
+CNSTI4 480
+ADDRLP4 64
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+ADDRLP4 64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 44
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $2323
+ADDRGP4 CG_Cutscene2d_UpdateTrans
+CALLV
+pop
+ADDRGP4 CG_Cutscene2d_Draw
+CALLV
+pop
+LABELV $1904
+endproc CG_DrawActive 188 44
+bss
+align 4
+LABELV lagometer
+skip 1544
+import CG_AddBoundingBox
+import CG_AddBoundingBoxEntity
+import CG_QueryCvar
+import CG_Timestamp
+import CG_LimitCvars
+import trap_RealTime
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import trap_R_inPVS
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_Cutscene2d_Draw
+import CG_Cutscene2d_UpdateTrans
+import CG_Cutscene2d_CheckCmd
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import Main_SpriteParticles
+import LaunchRevivalParticle
+import LaunchSpeedyPuffTrail
+import Init_SpriteParticles
+import AddLFsToScreen
+import AddLFToDrawList
+import Init_LensFlareSys
+import DumpPolyInfo
+import ActiveChooseLogoMenu
+import FindLogoForSpraying
+import Add_LogoToDrawList
+import AddLogosToScene
+import Init_SprayLogoSys
+import Calculate_2DOfDIR
+import Calculate_2DOf3D
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_ChangeLoadingProgress
+import CG_LoadingString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_ScorePlum
+import CG_TeleOutEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_GenerateParticles
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_PortalInView
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_GetWaterMuzzle
+import CG_SprayTrail
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponSRWC
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_Boomies_Explosion
+import CG_BamBam_Explosion
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_LerpTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayer
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_UpdateVoipTeamIDs
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_SetPrintString
+export numSortedTeamPlayers
+align 4
+LABELV numSortedTeamPlayers
+skip 4
+export sortedTeamPlayers
+align 4
+LABELV sortedTeamPlayers
+skip 128
+import CG_WorldToScreen
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_DrawPic1024
+import CG_DrawRect1024
+import CG_FillRect1024
+import CG_AdjustFrom1024
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddPolyBatched
+import CG_AddRefEntityBatched
+import CG_FlushSceneBatches
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_ForceModelChange
+import CG_GetCvarFloat
+import CG_GetCvarInt
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StreamAssets
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_icons
+import cg_ambient
+import cg_drawBBox
+import cg_drawVoiceNames
+import cg_drawLensflare
+import cg_timestamps
+import cg_skyLensflare
+import cg_sky
+import cg_curWarmupReady
+import cg_warmupReady
+import cg_glowModelTeam
+import cg_glowModel
+import cg_cineDrawLetterBox
+import cg_cineHideHud
+import cg_LPSwallhackAlpha
+import cg_LPSwallhackSize
+import cg_bigScoreType
+import cg_thirdPersonAutoSwitch
+import cg_drawTimeLeft
+import cg_drawServerInfos
+import cg_drawMessages
+import cg_drawups
+import cg_wopFFAhud
+import cg_printDir
+import cg_drawRealTime
+import cg_correctedWeaponPos
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_streamAssets
+import cg_deferPlayers
+import cg_predictItems
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_chatBeep
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_optimizePrediction
+import cg_nopredict
+import cg_errorDecay
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import trailEnt
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $2297
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $2294
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 105
+byte 1 102
+byte 1 121
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2182
+byte 1 37
+byte 1 45
+byte 1 52
+byte 1 46
+byte 1 48
+byte 1 102
+byte 1 0
+align 1
+LABELV $2088
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 61
+byte 1 123
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 51
+byte 1 102
+byte 1 124
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 51
+byte 1 102
+byte 1 124
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 51
+byte 1 102
+byte 1 125
+byte 1 10
+byte 1 0
+align 1
+LABELV $1575
+byte 1 37
+byte 1 50
+byte 1 105
+byte 1 0
+align 1
+LABELV $1502
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 33
+byte 1 0
+align 1
+LABELV $1501
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $1500
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $1437
+byte 1 87
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 82
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 33
+byte 1 0
+align 1
+LABELV $1400
+byte 1 85
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $1399
+byte 1 66
+byte 1 105
+byte 1 103
+byte 1 32
+byte 1 66
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1398
+byte 1 83
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $1397
+byte 1 76
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 80
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $1396
+byte 1 83
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1395
+byte 1 83
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1394
+byte 1 84
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $1213
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 34
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 34
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 105
+byte 1 102
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 0
+align 1
+LABELV $1189
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1188
+byte 1 87
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 46
+byte 1 48
+byte 1 102
+byte 1 37
+byte 1 37
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 40
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 46
+byte 1 48
+byte 1 102
+byte 1 37
+byte 1 37
+byte 1 41
+byte 1 0
+align 1
+LABELV $1177
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 84
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 76
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $1173
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $1169
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $1163
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 118
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1142
+byte 1 87
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $1135
+byte 1 76
+byte 1 79
+byte 1 87
+byte 1 32
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 32
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 0
+align 1
+LABELV $1134
+byte 1 79
+byte 1 85
+byte 1 84
+byte 1 32
+byte 1 79
+byte 1 70
+byte 1 32
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 0
+align 1
+LABELV $1120
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $1101
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 86
+byte 1 79
+byte 1 84
+byte 1 69
+byte 1 40
+byte 1 37
+byte 1 105
+byte 1 41
+byte 1 58
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1076
+byte 1 37
+byte 1 105
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 0
+align 1
+LABELV $1074
+byte 1 86
+byte 1 79
+byte 1 84
+byte 1 69
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1053
+byte 1 83
+byte 1 80
+byte 1 69
+byte 1 67
+byte 1 84
+byte 1 65
+byte 1 84
+byte 1 79
+byte 1 82
+byte 1 0
+align 1
+LABELV $966
+byte 1 114
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 111
+byte 1 83
+byte 1 101
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $965
+byte 1 114
+byte 1 95
+byte 1 122
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 106
+byte 1 0
+align 1
+LABELV $866
+byte 1 115
+byte 1 110
+byte 1 99
+byte 1 0
+align 1
+LABELV $790
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $775
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $737
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $581
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 0
+align 1
+LABELV $528
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $468
+byte 1 0
+align 1
+LABELV $448
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $375
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 50
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $373
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 108
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 50
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $368
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 50
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $357
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 58
+byte 1 32
+byte 1 0
+align 1
+LABELV $355
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $325
+byte 1 63
+byte 1 0
+align 1
+LABELV $324
+byte 1 66
+byte 1 66
+byte 1 0
+align 1
+LABELV $323
+byte 1 84
+byte 1 83
+byte 1 89
+byte 1 67
+byte 1 0
+align 1
+LABELV $322
+byte 1 67
+byte 1 84
+byte 1 76
+byte 1 0
+align 1
+LABELV $321
+byte 1 84
+byte 1 70
+byte 1 70
+byte 1 65
+byte 1 0
+align 1
+LABELV $320
+byte 1 76
+byte 1 80
+byte 1 83
+byte 1 0
+align 1
+LABELV $319
+byte 1 83
+byte 1 89
+byte 1 67
+byte 1 0
+align 1
+LABELV $318
+byte 1 83
+byte 1 80
+byte 1 0
+align 1
+LABELV $317
+byte 1 49
+byte 1 86
+byte 1 83
+byte 1 49
+byte 1 0
+align 1
+LABELV $316
+byte 1 70
+byte 1 70
+byte 1 65
+byte 1 0
+align 1
+LABELV $296
+byte 1 94
+byte 1 48
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 94
+byte 1 51
+byte 1 45
+byte 1 45
+byte 1 58
+byte 1 45
+byte 1 45
+byte 1 0
+align 1
+LABELV $295
+byte 1 94
+byte 1 37
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 37
+byte 1 99
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $259
+byte 1 37
+byte 1 46
+byte 1 48
+byte 1 102
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $254
+byte 1 91
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 37
+byte 1 105
+byte 1 93
+byte 1 0
+align 1
+LABELV $253
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 0
+align 1
+LABELV $251
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 62
+byte 1 0
+align 1
+LABELV $248
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 35
+byte 1 35
+byte 1 32
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 35
+byte 1 35
+byte 1 62
+byte 1 0
+align 1
+LABELV $243
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $239
+byte 1 37
+byte 1 105
+byte 1 102
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $223
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $221
+byte 1 110
+byte 1 0
@@ -0,0 +1,3230 @@
+export CG_BubbleTrail
+code
+proc CG_BubbleTrail 96 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 cg_noProjectileTrail+12
+INDIRI4
+CNSTI4 0
+EQI4 $81
+ADDRGP4 $80
+JUMPV
+LABELV $81
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 40
+CNSTI4 4
+ASGNI4
+ADDRLP4 12+4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 44
+CNSTI4 8
+ASGNI4
+ADDRLP4 12+8
+ADDRFP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 48
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 52
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 52
+INDIRI4
+ADDRFP4 8
+INDIRF4
+CVFI4 4
+MODI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $99
+JUMPV
+LABELV $96
+ADDRLP4 72
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRLP4 76
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 1000
+ADDI4
+CVIF4 4
+CNSTF4 1132068864
+ADDRLP4 76
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 64
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 64
+INDIRP4
+CNSTI4 164
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 68
+INDIRP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 68
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 68
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTF4 1077936128
+ASGNF4
+ADDRLP4 68
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+160652+216
+INDIRI4
+ASGNI4
+ADDRLP4 68
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 68
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 68
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 68
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 64
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 84
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTF4 1084227584
+CNSTF4 1073741824
+ADDRLP4 84
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 88
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1084227584
+CNSTF4 1073741824
+ADDRLP4 88
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 92
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1084227584
+CNSTF4 1073741824
+ADDRLP4 92
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1086324736
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $97
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ADDRFP4 8
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+LABELV $99
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ADDRLP4 28
+INDIRF4
+LTF4 $96
+LABELV $80
+endproc CG_BubbleTrail 96 4
+data
+align 4
+LABELV $113
+byte 4 146
+export CG_SmokePuff
+code
+proc CG_SmokePuff 52 4
+ADDRFP4 32
+ADDRFP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+ASGNP4
+ADDRGP4 $113
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_random
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTF4 1135869952
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRFP4 32
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRFP4 32
+INDIRI4
+CVIF4 4
+ADDRFP4 28
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRFP4 36
+INDIRI4
+ADDRFP4 32
+INDIRI4
+LEI4 $114
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRGP4 $115
+JUMPV
+LABELV $114
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+LABELV $115
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRFP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRFP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRFP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1132396544
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 24
+INDIRF4
+LTF4 $117
+ADDRLP4 16
+ADDRLP4 20
+INDIRF4
+ADDRLP4 24
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $118
+JUMPV
+LABELV $117
+ADDRLP4 16
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $118
+ADDRLP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 16
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 32
+CNSTF4 1132396544
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 36
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+LTF4 $120
+ADDRLP4 28
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $121
+JUMPV
+LABELV $120
+ADDRLP4 28
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $121
+ADDRLP4 4
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 28
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 44
+CNSTF4 1132396544
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 48
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 48
+INDIRF4
+LTF4 $123
+ADDRLP4 40
+ADDRLP4 44
+INDIRF4
+ADDRLP4 48
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $124
+JUMPV
+LABELV $123
+ADDRLP4 40
+ADDRLP4 44
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $124
+ADDRLP4 4
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 40
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 4
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 4
+INDIRP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $112
+endproc CG_SmokePuff 52 4
+export CG_TeleOutEffect
+proc CG_TeleOutEffect 60 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRLP4 16
+CNSTP4 0
+ASGNP4
+ADDRLP4 20
+CNSTP4 0
+ASGNP4
+ADDRLP4 28
+ADDRFP4 8
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+LTI4 $128
+ADDRLP4 28
+INDIRI4
+CNSTI4 64
+LTI4 $126
+LABELV $128
+ADDRGP4 $129
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $126
+ADDRLP4 12
+CNSTI4 1836
+ADDRLP4 28
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $131
+ADDRLP4 36
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 16
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $137
+ADDRLP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+ADDRGP4 cgs+160652+960
+INDIRI4
+ASGNI4
+ADDRGP4 $138
+JUMPV
+LABELV $137
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $141
+ADDRLP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+ADDRGP4 cgs+160652+956
+INDIRI4
+ASGNI4
+ADDRGP4 $142
+JUMPV
+LABELV $141
+ADDRLP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+ADDRGP4 cgs+160652+964
+INDIRI4
+ASGNI4
+LABELV $142
+LABELV $138
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $149
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $150
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+EQI4 $151
+ADDRGP4 $147
+JUMPV
+LABELV $149
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $148
+JUMPV
+LABELV $150
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 860
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $148
+JUMPV
+LABELV $151
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 1168
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $147
+LABELV $148
+ADDRLP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+LABELV $132
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $131
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $152
+ADDRGP4 $125
+JUMPV
+LABELV $152
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $154
+ADDRGP4 $125
+JUMPV
+LABELV $154
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $156
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $157
+ADDRGP4 $125
+JUMPV
+LABELV $157
+ADDRLP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $159
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $125
+endproc CG_TeleOutEffect 60 16
+export CG_SpawnEffect
+proc CG_SpawnEffect 16 0
+ADDRLP4 4
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 16
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 1000
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 12
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+ADDRGP4 cgs+160652+952
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $165
+ADDRLP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+ADDRGP4 cgs+160652+960
+INDIRI4
+ASGNI4
+ADDRGP4 $166
+JUMPV
+LABELV $165
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $169
+ADDRLP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+ADDRGP4 cgs+160652+956
+INDIRI4
+ASGNI4
+ADDRGP4 $170
+JUMPV
+LABELV $169
+ADDRLP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+ADDRGP4 cgs+160652+964
+INDIRI4
+ASGNI4
+LABELV $170
+LABELV $166
+LABELV $160
+endproc CG_SpawnEffect 16 0
+export CG_GenerateParticles
+proc CG_GenerateParticles 144 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 24
+ADDRFP4 24
+INDIRF4
+ASGNF4
+ADDRFP4 28
+ADDRFP4 28
+INDIRI4
+ASGNI4
+ADDRFP4 36
+ADDRFP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 40
+ADDRFP4 40
+INDIRI4
+ASGNI4
+ADDRFP4 44
+ADDRFP4 44
+INDIRI4
+ASGNI4
+ADDRFP4 48
+ADDRFP4 48
+INDIRI4
+ASGNI4
+ADDRFP4 52
+ADDRFP4 52
+INDIRI4
+ASGNI4
+ADDRFP4 56
+ADDRFP4 56
+INDIRI4
+ASGNI4
+ADDRFP4 60
+ADDRFP4 60
+INDIRI4
+ASGNI4
+ADDRFP4 64
+ADDRFP4 64
+INDIRI4
+ASGNI4
+ADDRFP4 68
+ADDRFP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRGP4 $179
+JUMPV
+LABELV $176
+ADDRLP4 60
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 64
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRFP4 36
+INDIRI4
+ADDRFP4 40
+INDIRI4
+ADDI4
+CVIF4 4
+CNSTF4 1073741824
+ADDRLP4 64
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRFP4 44
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 72
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDRFP4 56
+INDIRI4
+CVIF4 4
+CNSTF4 1073741824
+ADDRLP4 72
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRFP4 60
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRFP4 36
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 76
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRFP4 48
+INDIRI4
+CVIF4 4
+CNSTF4 1073741824
+ADDRLP4 76
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRFP4 52
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 84
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $180
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 64
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $181
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $181
+ADDRLP4 92
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRGP4 AxisScale
+CALLV
+pop
+ADDRGP4 $181
+JUMPV
+LABELV $180
+ADDRLP4 4
+INDIRP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+LABELV $181
+ADDRFP4 64
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $186
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRGP4 $187
+JUMPV
+LABELV $186
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 2
+ASGNI4
+LABELV $187
+ADDRFP4 64
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $188
+ADDRLP4 88
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $188
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRFP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 92
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 92
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRFP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 96
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 96
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRFP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 100
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 100
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRFP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 108
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRFP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 8+4
+ADDRLP4 8+4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 112
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRFP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 116
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 8+8
+ADDRLP4 8+8
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 116
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRFP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 20
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 124
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 120
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 124
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRFP4 24
+INDIRF4
+MULF4
+ADDF4
+MULF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 132
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 20+4
+INDIRF4
+ADDRLP4 128
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 132
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRFP4 24
+INDIRF4
+MULF4
+ADDF4
+MULF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 20+8
+INDIRF4
+ADDRLP4 136
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 140
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRFP4 24
+INDIRF4
+MULF4
+ADDF4
+MULF4
+ASGNF4
+LABELV $177
+ADDRLP4 56
+ADDRLP4 56
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $179
+ADDRLP4 56
+INDIRI4
+ADDRFP4 28
+INDIRI4
+LTI4 $176
+LABELV $175
+endproc CG_GenerateParticles 144 12
+bss
+align 4
+LABELV $195
+skip 12
+export CG_ScorePlum
+code
+proc CG_ScorePlum 48 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ADDRGP4 cg+108604+140
+INDIRI4
+NEI4 $201
+ADDRGP4 cg_scorePlum+12
+INDIRI4
+CNSTI4 0
+NEI4 $196
+LABELV $201
+ADDRGP4 $194
+JUMPV
+LABELV $196
+ADDRLP4 20
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 8
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 4000
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 36
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 40
+CNSTF4 1101004800
+ASGNF4
+ADDRLP4 36
+INDIRF4
+ADDRGP4 $195+8
+INDIRF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+LTF4 $204
+ADDRLP4 36
+INDIRF4
+ADDRGP4 $195+8
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDF4
+GTF4 $204
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+CNSTF4 1101004800
+SUBF4
+ASGNF4
+LABELV $204
+ADDRGP4 $195
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 44
+CNSTF4 0
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+LABELV $194
+endproc CG_ScorePlum 48 8
+export CG_MakeExplosion
+proc CG_MakeExplosion 60 8
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+GTI4 $211
+ADDRGP4 $213
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $211
+ADDRLP4 36
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 36
+INDIRI4
+CNSTI4 63
+BANDI4
+ASGNI4
+ADDRLP4 40
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $214
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 300
+ADDP4
+ADDRLP4 44
+INDIRI4
+CNSTI4 360
+MODI4
+CVIF4 4
+ASGNF4
+ADDRLP4 48
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 52
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 48
+INDIRF4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 52
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16+8
+CNSTF4 1098907648
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 56
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $215
+JUMPV
+LABELV $214
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $222
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRGP4 $223
+JUMPV
+LABELV $222
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 44
+INDIRI4
+CNSTI4 360
+MODI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ARGP4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRGP4 RotateAroundDirection
+CALLV
+pop
+LABELV $223
+LABELV $215
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 28
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ADDRFP4 16
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 56
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $210
+endproc CG_MakeExplosion 60 8
+import CG_AddBoundingBox
+import CG_AddBoundingBoxEntity
+import CG_QueryCvar
+import CG_Timestamp
+import CG_LimitCvars
+import trap_RealTime
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import trap_R_inPVS
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_Cutscene2d_Draw
+import CG_Cutscene2d_UpdateTrans
+import CG_Cutscene2d_CheckCmd
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import Main_SpriteParticles
+import LaunchRevivalParticle
+import LaunchSpeedyPuffTrail
+import Init_SpriteParticles
+import AddLFsToScreen
+import AddLFToDrawList
+import Init_LensFlareSys
+import DumpPolyInfo
+import ActiveChooseLogoMenu
+import FindLogoForSpraying
+import Add_LogoToDrawList
+import AddLogosToScene
+import Init_SprayLogoSys
+import Calculate_2DOfDIR
+import Calculate_2DOf3D
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_ChangeLoadingProgress
+import CG_LoadingString
+import CG_ProcessSnapshots
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_PortalInView
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_GetWaterMuzzle
+import CG_SprayTrail
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponSRWC
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_Boomies_Explosion
+import CG_BamBam_Explosion
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_LerpTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayer
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_UpdateVoipTeamIDs
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Draw3DModel
+import CG_SetPrintString
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import CG_MessagePrint
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_WorldToScreen
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_DrawPic1024
+import CG_DrawRect1024
+import CG_FillRect1024
+import CG_AdjustFrom1024
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddPolyBatched
+import CG_AddRefEntityBatched
+import CG_FlushSceneBatches
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_ForceModelChange
+import CG_GetCvarFloat
+import CG_GetCvarInt
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StreamAssets
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_icons
+import cg_ambient
+import cg_drawBBox
+import cg_drawVoiceNames
+import cg_drawLensflare
+import cg_timestamps
+import cg_skyLensflare
+import cg_sky
+import cg_curWarmupReady
+import cg_warmupReady
+import cg_glowModelTeam
+import cg_glowModel
+import cg_cineDrawLetterBox
+import cg_cineHideHud
+import cg_LPSwallhackAlpha
+import cg_LPSwallhackSize
+import cg_bigScoreType
+import cg_thirdPersonAutoSwitch
+import cg_drawTimeLeft
+import cg_drawServerInfos
+import cg_drawMessages
+import cg_drawups
+import cg_wopFFAhud
+import cg_printDir
+import cg_drawRealTime
+import cg_correctedWeaponPos
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_streamAssets
+import cg_deferPlayers
+import cg_predictItems
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_chatBeep
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_optimizePrediction
+import cg_nopredict
+import cg_errorDecay
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import trailEnt
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $213
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 77
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $159
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $156
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 0
+align 1
+LABELV $129
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 79
+byte 1 117
+byte 1 116
+byte 1 45
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 0
@@ -0,0 +1,8188 @@
+export CG_LerpTag
+code
+proc CG_LerpTag 32 24
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 31
+ADDRFP4 4
+INDIRI4
+MULI4
+CNSTI4 17
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDI4
+CNSTI4 7
+ADDRFP4 12
+INDIRI4
+MULI4
+ADDI4
+CVIU4 4
+ASGNU4
+ADDRLP4 0
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRGP4 $85
+JUMPV
+LABELV $82
+ADDRLP4 4
+CNSTU4 33
+ADDRLP4 4
+INDIRU4
+MULU4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CVIU4 4
+ADDU4
+ASGNU4
+LABELV $83
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $85
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $82
+ADDRLP4 8
+CNSTU4 76
+ADDRLP4 4
+INDIRU4
+CNSTU4 255
+BANDU4
+MULU4
+ADDRGP4 cg_tagCache
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $86
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRGP4 cg
+INDIRI4
+NEI4 $86
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $86
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+NEI4 $86
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRFP4 12
+INDIRI4
+NEI4 $86
+ADDRLP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 16
+INDIRF4
+NEF4 $86
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $86
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 48
+ADDRLP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $81
+JUMPV
+LABELV $86
+ADDRLP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_LerpTag
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRGP4 cg
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 48
+ADDRLP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+RETI4
+LABELV $81
+endproc CG_LerpTag 32 24
+export CG_PositionEntityOnTag
+proc CG_PositionEntityOnTag 84 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ADDRFP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_LerpTag
+CALLI4
+pop
+ADDRLP4 56
+CNSTI4 68
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $89
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $90
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $89
+ADDRLP4 4+12
+ARGP4
+ADDRLP4 60
+CNSTI4 28
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP
+ARGP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ARGP4
+ADDRGP4 MatrixMultiply
+CALLV
+pop
+ADDRLP4 64
+CNSTI4 100
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $88
+endproc CG_PositionEntityOnTag 84 24
+export CG_PositionRotatedEntityOnTag
+proc CG_PositionRotatedEntityOnTag 120 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ADDRFP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_LerpTag
+CALLI4
+pop
+ADDRLP4 92
+CNSTI4 68
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $95
+ADDRLP4 96
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 96
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 104
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ADDRLP4 112
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $96
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $95
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRLP4 4+12
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRGP4 MatrixMultiply
+CALLV
+pop
+ADDRLP4 52
+ARGP4
+ADDRLP4 96
+CNSTI4 28
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP
+ARGP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+ARGP4
+ADDRGP4 MatrixMultiply
+CALLV
+pop
+LABELV $94
+endproc CG_PositionRotatedEntityOnTag 120 24
+export CG_SetEntitySoundPosition
+proc CG_SetEntitySoundPosition 24 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 16777215
+NEI4 $101
+ADDRLP4 12
+CNSTI4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+38016
+ADDP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_S_UpdateEntityPosition
+CALLV
+pop
+ADDRGP4 $102
+JUMPV
+LABELV $101
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ARGP4
+ADDRGP4 trap_S_UpdateEntityPosition
+CALLV
+pop
+LABELV $102
+LABELV $100
+endproc CG_SetEntitySoundPosition 24 8
+proc CG_EntityEffects 36 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetEntitySoundPosition
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $107
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 7
+EQI4 $109
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+35964
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_AddLoopingSound
+CALLV
+pop
+ADDRGP4 $110
+JUMPV
+LABELV $109
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+35964
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_AddRealLoopingSound
+CALLV
+pop
+LABELV $110
+LABELV $107
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $113
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 255
+ASGNI4
+ADDRLP4 32
+CNSTF4 1132396544
+ASGNF4
+ADDRLP4 8
+ADDRLP4 24
+INDIRI4
+ADDRLP4 28
+INDIRI4
+BANDI4
+CVIF4 4
+ADDRLP4 32
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 24
+INDIRI4
+CNSTI4 8
+RSHI4
+ADDRLP4 28
+INDIRI4
+BANDI4
+CVIF4 4
+ADDRLP4 32
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 24
+INDIRI4
+CNSTI4 16
+RSHI4
+ADDRLP4 28
+INDIRI4
+BANDI4
+CVIF4 4
+ADDRLP4 32
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 1082130432
+ADDRLP4 24
+INDIRI4
+CNSTI4 24
+RSHI4
+ADDRLP4 28
+INDIRI4
+BANDI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $113
+LABELV $106
+endproc CG_EntityEffects 36 20
+proc CG_General 160 44
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 140
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 23
+NEI4 $116
+ADDRFP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $118
+ADDRGP4 cgs+160652+636
+INDIRI4
+ARGI4
+ADDRLP4 140
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+ADDRLP4 140
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRLP4 140
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 148
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 148
+INDIRF4
+ARGF4
+ADDRLP4 148
+INDIRF4
+ARGF4
+ADDRLP4 152
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 152
+INDIRF4
+ARGF4
+ADDRLP4 152
+INDIRF4
+ARGF4
+ADDRLP4 156
+CNSTI4 0
+ASGNI4
+ADDRLP4 156
+INDIRI4
+ARGI4
+ADDRLP4 140
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 156
+INDIRI4
+ARGI4
+ADDRGP4 CG_ImpactMark
+CALLV
+pop
+LABELV $118
+ADDRFP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $116
+ADDRLP4 140
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $122
+ADDRGP4 $115
+JUMPV
+LABELV $122
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+80
+ADDRLP4 140
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+96
+ADDRLP4 0+80
+INDIRI4
+ASGNI4
+ADDRLP4 0+100
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+84
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 140
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+34940
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $132
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $132
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $115
+endproc CG_General 160 44
+proc CG_Speaker 36 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $138
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $140
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $138
+LABELV $140
+ADDRLP4 8
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 100
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+MULI4
+ADDI4
+CVIF4 4
+ADDRLP4 16
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+CVIF4 4
+CNSTF4 1073741824
+ADDRLP4 8
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+LABELV $138
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $142
+ADDRGP4 $137
+JUMPV
+LABELV $142
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+INDIRI4
+GEI4 $144
+ADDRGP4 $137
+JUMPV
+LABELV $144
+CNSTP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+35964
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRLP4 24
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 100
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+MULI4
+ADDI4
+CVIF4 4
+ADDRLP4 32
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+CVIF4 4
+CNSTF4 1073741824
+ADDRLP4 24
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+LABELV $137
+endproc CG_Speaker 36 16
+proc CG_Item 224 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 144
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $150
+ADDRGP4 $152
+ARGP4
+ADDRLP4 144
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $150
+ADDRLP4 168
+CNSTI4 0
+ASGNI4
+ADDRLP4 144
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ADDRLP4 168
+INDIRI4
+EQI4 $155
+ADDRLP4 144
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+ADDRLP4 168
+INDIRI4
+EQI4 $153
+LABELV $155
+ADDRGP4 $149
+JUMPV
+LABELV $153
+ADDRLP4 144
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+ADDRLP4 140
+CNSTI4 52
+ADDRLP4 144
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRGP4 cg_simpleItems+12
+INDIRI4
+CNSTI4 0
+EQI4 $156
+ADDRLP4 140
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 8
+EQI4 $156
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+132
+CNSTF4 1096810496
+ASGNF4
+ADDRLP4 144
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ADDRGP4 cgs+160652+368
+INDIRI4
+NEI4 $161
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $161
+ADDRLP4 0+112
+CNSTI4 24
+ADDRGP4 cgs+160652+364
+INDIRI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $162
+JUMPV
+LABELV $161
+ADDRLP4 0+112
+CNSTI4 24
+ADDRLP4 144
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $162
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRGP4 $149
+JUMPV
+LABELV $156
+ADDRLP4 160
+CNSTF4 925353388
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1000593162
+ADDF4
+ASGNF4
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 1000
+ADDI4
+CVIF4 4
+ADDRLP4 160
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 176
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 180
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ASGNP4
+ADDRLP4 180
+INDIRP4
+ADDRLP4 180
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+ADDRLP4 176
+INDIRF4
+MULF4
+CNSTF4 1082130432
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 184
+ADDRLP4 140
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 5
+EQI4 $182
+ADDRLP4 184
+INDIRI4
+CNSTI4 6
+NEI4 $180
+LABELV $182
+ADDRLP4 0+96
+ADDRLP4 0+80
+INDIRI4
+ASGNI4
+ADDRLP4 192
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 752
+ADDP4
+ADDRLP4 192
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 748
+ADDP4
+ADDRLP4 192
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ADDRLP4 192
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRGP4 cg+110612
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AxisCopy
+CALLV
+pop
+ADDRLP4 0+80
+CNSTI4 0
+ASGNI4
+ADDRGP4 $181
+JUMPV
+LABELV $180
+ADDRLP4 140
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $189
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ADDRGP4 cg+110552
+INDIRB
+ASGNB 12
+ADDRGP4 cg+110564
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AxisCopy
+CALLV
+pop
+ADDRGP4 $190
+JUMPV
+LABELV $189
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ADDRGP4 cg+110504
+INDIRB
+ASGNB 12
+ADDRGP4 cg+110516
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AxisCopy
+CALLV
+pop
+LABELV $190
+LABELV $181
+ADDRLP4 152
+CNSTP4 0
+ASGNP4
+ADDRLP4 140
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $197
+ADDRLP4 152
+CNSTI4 132
+ADDRLP4 140
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+ASGNP4
+ADDRLP4 188
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+ADDRLP4 188
+INDIRP4
+INDIRF4
+ADDRLP4 152
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0+28
+INDIRF4
+MULF4
+ADDRLP4 152
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0+28+12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 152
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0+28+24
+INDIRF4
+MULF4
+ADDF4
+SUBF4
+ASGNF4
+ADDRLP4 196
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+ASGNP4
+ADDRLP4 196
+INDIRP4
+ADDRLP4 196
+INDIRP4
+INDIRF4
+ADDRLP4 152
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0+28+4
+INDIRF4
+MULF4
+ADDRLP4 152
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0+28+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 152
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0+28+24+4
+INDIRF4
+MULF4
+ADDF4
+SUBF4
+ASGNF4
+ADDRLP4 204
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ADDRLP4 204
+INDIRP4
+INDIRF4
+ADDRLP4 152
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0+28+8
+INDIRF4
+MULF4
+ADDRLP4 152
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0+28+12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 152
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0+28+24+8
+INDIRF4
+MULF4
+ADDF4
+SUBF4
+ASGNF4
+ADDRLP4 212
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ASGNP4
+ADDRLP4 212
+INDIRP4
+ADDRLP4 212
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+LABELV $197
+ADDRLP4 144
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ADDRGP4 cgs+160652+368
+INDIRI4
+NEI4 $220
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $220
+ADDRLP4 0+8
+CNSTI4 24
+ADDRGP4 cgs+160652+364
+INDIRI4
+MULI4
+ADDRGP4 cg_items+4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $221
+JUMPV
+LABELV $220
+ADDRLP4 0+8
+CNSTI4 24
+ADDRLP4 144
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_items+4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $221
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+84
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+64
+CNSTI4 0
+ASGNI4
+ADDRLP4 156
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+LTI4 $235
+ADDRLP4 156
+INDIRI4
+CNSTI4 1000
+GEI4 $235
+ADDRLP4 148
+ADDRLP4 156
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 0+28
+ADDRLP4 0+28
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+4
+ADDRLP4 0+28+4
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+8
+ADDRLP4 0+28+8
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12
+ADDRLP4 0+28+12
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+4
+ADDRLP4 0+28+12+4
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+8
+ADDRLP4 0+28+12+8
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24
+ADDRLP4 0+28+24
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+4
+ADDRLP4 0+28+24+4
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+8
+ADDRLP4 0+28+24+8
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 $236
+JUMPV
+LABELV $235
+ADDRLP4 148
+CNSTF4 1065353216
+ASGNF4
+LABELV $236
+ADDRLP4 192
+ADDRLP4 140
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 1
+EQI4 $282
+ADDRLP4 192
+INDIRI4
+CNSTI4 3
+NEI4 $280
+LABELV $282
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $280
+ADDRLP4 140
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $284
+ADDRLP4 0+28
+CNSTF4 1069547520
+ADDRLP4 0+28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+4
+CNSTF4 1069547520
+ADDRLP4 0+28+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+8
+CNSTF4 1069547520
+ADDRLP4 0+28+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12
+CNSTF4 1069547520
+ADDRLP4 0+28+12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+4
+CNSTF4 1069547520
+ADDRLP4 0+28+12+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+8
+CNSTF4 1069547520
+ADDRLP4 0+28+12+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24
+CNSTF4 1069547520
+ADDRLP4 0+28+24
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+4
+CNSTF4 1069547520
+ADDRLP4 0+28+24+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+8
+CNSTF4 1069547520
+ADDRLP4 0+28+24+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+64
+CNSTI4 1
+ASGNI4
+LABELV $284
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRGP4 cg_simpleItems+12
+INDIRI4
+CNSTI4 0
+NEI4 $329
+ADDRLP4 208
+CNSTF4 0
+ASGNF4
+ADDRLP4 196+8
+ADDRLP4 208
+INDIRF4
+ASGNF4
+ADDRLP4 196+4
+ADDRLP4 208
+INDIRF4
+ASGNF4
+ADDRLP4 196
+ADDRLP4 208
+INDIRF4
+ASGNF4
+ADDRLP4 212
+ADDRLP4 140
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 4
+EQI4 $337
+ADDRLP4 212
+INDIRI4
+CNSTI4 5
+EQI4 $337
+ADDRLP4 212
+INDIRI4
+CNSTI4 6
+NEI4 $334
+LABELV $337
+ADDRLP4 216
+CNSTI4 24
+ADDRLP4 144
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_items+4+4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+8
+ADDRLP4 216
+INDIRI4
+ASGNI4
+ADDRLP4 216
+INDIRI4
+CNSTI4 0
+EQI4 $338
+ADDRLP4 220
+ADDRLP4 140
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 220
+INDIRI4
+CNSTI4 5
+EQI4 $345
+ADDRLP4 220
+INDIRI4
+CNSTI4 6
+NEI4 $343
+LABELV $345
+ADDRLP4 0+80
+CNSTF4 1018444120
+ADDRGP4 cg+107612
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+CNSTI4 29
+MODI4
+ASGNI4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 1094713344
+ADDF4
+ASGNF4
+ADDRLP4 196
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $343
+ADDRLP4 196
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 148
+INDIRF4
+CNSTF4 1065353216
+EQF4 $351
+ADDRLP4 0+28
+ADDRLP4 0+28
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+4
+ADDRLP4 0+28+4
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+8
+ADDRLP4 0+28+8
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12
+ADDRLP4 0+28+12
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+4
+ADDRLP4 0+28+12+4
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+8
+ADDRLP4 0+28+12+8
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24
+ADDRLP4 0+28+24
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+4
+ADDRLP4 0+28+24+4
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+8
+ADDRLP4 0+28+24+8
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+64
+CNSTI4 1
+ASGNI4
+LABELV $351
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $338
+LABELV $334
+LABELV $329
+LABELV $149
+endproc CG_Item 224 12
+lit
+align 4
+LABELV $581
+byte 4 3240099840
+byte 4 3240099840
+byte 4 0
+align 4
+LABELV $582
+byte 4 1092616192
+byte 4 1092616192
+byte 4 1073741824
+code
+proc CG_Missile 292 44
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 140
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 15
+LTI4 $397
+ADDRLP4 140
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $397
+ADDRLP4 144
+CNSTI4 132
+ADDRLP4 140
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ADDRLP4 140
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 144
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $399
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 144
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 144
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 144
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $399
+ADDRLP4 144
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $401
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+107612
+INDIRI4
+ARGI4
+ADDRLP4 152
+ARGP4
+ADDRGP4 BG_EvaluateTrajectoryDelta
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRLP4 144
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_AddLoopingSound
+CALLV
+pop
+LABELV $401
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+84
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 144
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $406
+ADDRGP4 trailEnt
+ADDRLP4 0
+INDIRB
+ASGNB 140
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $406
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $408
+ADDRLP4 0+112
+ADDRGP4 cgs+160652+728
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+132
+CNSTF4 1112014848
+ASGNF4
+ADDRLP4 0+136
+CNSTF4 1121714176
+ASGNF4
+ADDRLP4 0+128
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 0+132
+CNSTF4 1113325568
+ASGNF4
+ADDRLP4 0+136
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+128
+CNSTF4 1067030938
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRGP4 $396
+JUMPV
+LABELV $408
+ADDRLP4 152
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 2
+EQI4 $421
+ADDRLP4 152
+INDIRI4
+CNSTI4 7
+NEI4 $419
+LABELV $421
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $422
+ADDRLP4 0+112
+ADDRGP4 cgs+160652+756
+INDIRI4
+ASGNI4
+ADDRLP4 0+132
+CNSTF4 1094713344
+ASGNF4
+ADDRLP4 164
+CNSTI4 5
+ASGNI4
+ADDRGP4 $423
+JUMPV
+LABELV $422
+ADDRLP4 0+112
+ADDRGP4 cgs+160652+740
+INDIRI4
+ASGNI4
+ADDRLP4 0+132
+CNSTF4 1106247680
+ASGNF4
+ADDRLP4 164
+CNSTI4 14
+ASGNI4
+LABELV $423
+ADDRLP4 156
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRLP4 160
+CNSTI4 0
+ASGNI4
+ADDRGP4 $436
+JUMPV
+LABELV $433
+ADDRLP4 140
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 156
+INDIRI4
+ARGI4
+ADDRLP4 0+68
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+136
+CNSTF4 1121714176
+ASGNF4
+ADDRLP4 0+128
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 156
+ADDRLP4 156
+INDIRI4
+CNSTI4 6
+SUBI4
+ASGNI4
+ADDRLP4 0+132
+ADDRLP4 0+132
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+LABELV $434
+ADDRLP4 160
+ADDRLP4 160
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $436
+ADDRLP4 160
+INDIRI4
+ADDRLP4 164
+INDIRI4
+GEI4 $441
+ADDRLP4 156
+INDIRI4
+ADDRLP4 140
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+GTI4 $433
+LABELV $441
+ADDRGP4 $396
+JUMPV
+LABELV $419
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 14
+NEI4 $442
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+132
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0+136
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $446
+ADDRLP4 0+112
+ADDRGP4 cgs+160652+840
+INDIRI4
+ASGNI4
+ADDRGP4 $447
+JUMPV
+LABELV $446
+ADDRLP4 0+112
+ADDRGP4 cgs+160652+836
+INDIRI4
+ASGNI4
+LABELV $447
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRGP4 $396
+JUMPV
+LABELV $442
+ADDRLP4 144
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $454
+ADDRGP4 $396
+JUMPV
+LABELV $454
+ADDRLP4 0+104
+ADDRGP4 cg
+INDIRI4
+CNSTI4 1
+BANDI4
+ASGNI4
+ADDRLP4 0+8
+ADDRLP4 144
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+4
+ADDRLP4 144
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRLP4 140
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $459
+ADDRLP4 168
+CNSTF4 1132396544
+ADDRLP4 140
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 172
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 168
+INDIRF4
+ADDRLP4 172
+INDIRF4
+LTF4 $471
+ADDRLP4 156
+ADDRLP4 168
+INDIRF4
+ADDRLP4 172
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $472
+JUMPV
+LABELV $471
+ADDRLP4 156
+ADDRLP4 168
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $472
+ADDRLP4 0+116
+ADDRLP4 156
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 176
+CNSTF4 1132396544
+ADDRLP4 140
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table+4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 180
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 176
+INDIRF4
+ADDRLP4 180
+INDIRF4
+LTF4 $473
+ADDRLP4 160
+ADDRLP4 176
+INDIRF4
+ADDRLP4 180
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $474
+JUMPV
+LABELV $473
+ADDRLP4 160
+ADDRLP4 176
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $474
+ADDRLP4 0+116+1
+ADDRLP4 160
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 184
+CNSTF4 1132396544
+ADDRLP4 140
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table+8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 188
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 184
+INDIRF4
+ADDRLP4 188
+INDIRF4
+LTF4 $475
+ADDRLP4 164
+ADDRLP4 184
+INDIRF4
+ADDRLP4 188
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $476
+JUMPV
+LABELV $475
+ADDRLP4 164
+ADDRLP4 184
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $476
+ADDRLP4 0+116+2
+ADDRLP4 164
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+LABELV $459
+ADDRLP4 140
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $479
+ADDRLP4 168
+CNSTF4 1132396544
+ADDRGP4 g_color_table+96
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 172
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 168
+INDIRF4
+ADDRLP4 172
+INDIRF4
+LTF4 $494
+ADDRLP4 156
+ADDRLP4 168
+INDIRF4
+ADDRLP4 172
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $495
+JUMPV
+LABELV $494
+ADDRLP4 156
+ADDRLP4 168
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $495
+ADDRLP4 0+116
+ADDRLP4 156
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 176
+CNSTF4 1132396544
+ADDRGP4 g_color_table+96+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 180
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 176
+INDIRF4
+ADDRLP4 180
+INDIRF4
+LTF4 $496
+ADDRLP4 160
+ADDRLP4 176
+INDIRF4
+ADDRLP4 180
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $497
+JUMPV
+LABELV $496
+ADDRLP4 160
+ADDRLP4 176
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $497
+ADDRLP4 0+116+1
+ADDRLP4 160
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 184
+CNSTF4 1132396544
+ADDRGP4 g_color_table+96+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 188
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 184
+INDIRF4
+ADDRLP4 188
+INDIRF4
+LTF4 $498
+ADDRLP4 164
+ADDRLP4 184
+INDIRF4
+ADDRLP4 188
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $499
+JUMPV
+LABELV $498
+ADDRLP4 164
+ADDRLP4 184
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $499
+ADDRLP4 0+116+2
+ADDRLP4 164
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+LABELV $479
+ADDRLP4 140
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRLP4 156
+ADDRGP4 VectorNormalize2
+CALLF4
+ASGNF4
+ADDRLP4 156
+INDIRF4
+CNSTF4 0
+NEF4 $502
+ADDRLP4 0+28+8
+CNSTF4 1065353216
+ASGNF4
+LABELV $502
+ADDRLP4 140
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 13
+EQI4 $507
+ADDRLP4 140
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $509
+ADDRLP4 140
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $511
+ADDRLP4 140
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRGP4 cg+107612
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRGP4 $508
+JUMPV
+LABELV $511
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 4
+DIVI4
+CVIF4 4
+ARGF4
+ADDRGP4 RotateAroundDirection
+CALLV
+pop
+ADDRGP4 $508
+JUMPV
+LABELV $509
+ADDRLP4 0+28
+ARGP4
+ADDRLP4 140
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 RotateAroundDirection
+CALLV
+pop
+ADDRGP4 $508
+JUMPV
+LABELV $507
+ADDRLP4 172
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+28+24+4
+ADDRLP4 172
+INDIRF4
+ASGNF4
+ADDRLP4 0+28+24
+ADDRLP4 172
+INDIRF4
+ASGNF4
+ADDRLP4 0+28+24+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+28+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 176
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+28
+INDIRF4
+ADDRLP4 176
+INDIRF4
+NEF4 $528
+ADDRLP4 0+28+4
+INDIRF4
+ADDRLP4 176
+INDIRF4
+NEF4 $528
+ADDRLP4 0+28
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $529
+JUMPV
+LABELV $528
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+LABELV $529
+ADDRLP4 0+28
+ARGP4
+ADDRLP4 0+28+24
+ARGP4
+ADDRLP4 0+28+12
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 160
+ADDRLP4 0+28
+INDIRF4
+ASGNF4
+ADDRLP4 160+4
+ADDRLP4 0+28+4
+INDIRF4
+ASGNF4
+ADDRLP4 160+8
+ADDRLP4 0+28+8
+INDIRF4
+ASGNF4
+ADDRLP4 0+28
+ADDRLP4 0+28+12
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0+28+4
+ADDRLP4 0+28+12+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0+28+8
+ADDRLP4 0+28+12+8
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0+28+12
+ADDRLP4 160
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0+28+12+4
+ADDRLP4 160+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0+28+12+8
+ADDRLP4 160+8
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 0+84+8
+INDIRF4
+CNSTF4 1092616192
+SUBF4
+ASGNF4
+ADDRLP4 0+84+8
+ADDRLP4 180
+INDIRF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 180
+INDIRF4
+ASGNF4
+ADDRLP4 0+96
+ADDRLP4 0+80
+INDIRI4
+ASGNI4
+ADDRLP4 0+80
+CNSTF4 1018444120
+ADDRGP4 cg+107612
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+CNSTI4 22
+MODI4
+ASGNI4
+ADDRGP4 cg_shadows+12
+INDIRI4
+CNSTI4 1
+NEI4 $578
+ADDRLP4 240
+ADDRGP4 $581
+INDIRB
+ASGNB 12
+ADDRLP4 252
+ADDRGP4 $582
+INDIRB
+ASGNB 12
+ADDRLP4 264
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 264+8
+ADDRLP4 264+8
+INDIRF4
+CNSTF4 1124073472
+SUBF4
+ASGNF4
+ADDRLP4 184
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRLP4 240
+ARGP4
+ADDRLP4 252
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 33619969
+ARGI4
+ADDRGP4 trap_CM_BoxTrace
+CALLV
+pop
+ADDRLP4 184+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $589
+ADDRLP4 280
+CNSTI4 0
+ASGNI4
+ADDRLP4 184+4
+INDIRI4
+ADDRLP4 280
+INDIRI4
+EQI4 $589
+ADDRLP4 184
+INDIRI4
+ADDRLP4 280
+INDIRI4
+NEI4 $584
+LABELV $589
+ADDRLP4 284
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 276
+ADDRLP4 284
+INDIRF4
+ADDRLP4 184+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 cgs+160652+272
+INDIRI4
+ARGI4
+ADDRLP4 184+12
+ARGP4
+ADDRLP4 184+24
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 288
+ADDRLP4 276
+INDIRF4
+ASGNF4
+ADDRLP4 288
+INDIRF4
+ARGF4
+ADDRLP4 288
+INDIRF4
+ARGF4
+ADDRLP4 288
+INDIRF4
+ARGF4
+ADDRLP4 284
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTF4 1092616192
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_ImpactMark
+CALLV
+pop
+LABELV $584
+LABELV $578
+LABELV $508
+ADDRLP4 140
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $595
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 140
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+GEI4 $595
+ADDRLP4 168
+ADDRFP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 168
+INDIRF4
+ADDRLP4 140
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 168+4
+INDIRF4
+ADDRLP4 140
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 168+8
+INDIRF4
+ADDRLP4 140
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 208
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 208
+INDIRF4
+CNSTF4 1140457472
+DIVF4
+ASGNF4
+ADDRLP4 180
+INDIRF4
+CNSTF4 1065353216
+LEF4 $600
+ADDRLP4 180
+CNSTF4 1065353216
+ASGNF4
+LABELV $600
+ADDRLP4 212
+ADDRFP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+ASGNP4
+ADDRLP4 200
+ADDRLP4 140
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 212
+INDIRP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 216
+ADDRLP4 200
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 184
+CNSTF4 1073741824
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 212
+INDIRP4
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ADDRLP4 216
+INDIRF4
+SUBF4
+ADDRLP4 216
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 224
+CNSTF4 1058642330
+ADDRLP4 180
+INDIRF4
+MULF4
+CNSTF4 1036831949
+ADDF4
+ASGNF4
+ADDRLP4 184
+ADDRLP4 184
+INDIRF4
+ADDRLP4 184
+INDIRF4
+ADDRLP4 224
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 184
+ADDRLP4 184
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 224
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 164
+CNSTI4 0
+ASGNI4
+LABELV $603
+ADDRLP4 228
+ADDRLP4 168
+INDIRF4
+ASGNF4
+ADDRLP4 232
+CNSTI4 12
+ADDRLP4 164
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 180
+ADDRLP4 228
+INDIRF4
+ADDRLP4 232
+INDIRI4
+ADDRLP4 0+28
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 168+4
+INDIRF4
+ADDRLP4 232
+INDIRI4
+ADDRLP4 0+28+4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 168+8
+INDIRF4
+ADDRLP4 232
+INDIRI4
+ADDRLP4 0+28+8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 236
+ADDRLP4 180
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 188
+ADDRLP4 232
+INDIRI4
+ADDRLP4 0+28
+ADDP4
+INDIRF4
+ADDRLP4 228
+INDIRF4
+ADDRLP4 236
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 188+4
+ADDRLP4 232
+INDIRI4
+ADDRLP4 0+28+4
+ADDP4
+INDIRF4
+ADDRLP4 168+4
+INDIRF4
+ADDRLP4 236
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 188+8
+CNSTI4 12
+ADDRLP4 164
+INDIRI4
+MULI4
+ADDRLP4 0+28+8
+ADDP4
+INDIRF4
+ADDRLP4 168+8
+INDIRF4
+ADDRLP4 180
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 240
+CNSTI4 12
+ADDRLP4 164
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 240
+INDIRI4
+ADDRLP4 0+28
+ADDP4
+ADDRLP4 240
+INDIRI4
+ADDRLP4 0+28
+ADDP4
+INDIRF4
+ADDRLP4 168
+INDIRF4
+ADDRLP4 180
+INDIRF4
+NEGF4
+CNSTF4 1065353216
+ADDRLP4 184
+INDIRF4
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 244
+CNSTI4 12
+ADDRLP4 164
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 244
+INDIRI4
+ADDRLP4 0+28+4
+ADDP4
+ADDRLP4 244
+INDIRI4
+ADDRLP4 0+28+4
+ADDP4
+INDIRF4
+ADDRLP4 168+4
+INDIRF4
+ADDRLP4 180
+INDIRF4
+NEGF4
+CNSTF4 1065353216
+ADDRLP4 184
+INDIRF4
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 248
+CNSTI4 12
+ADDRLP4 164
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 248
+INDIRI4
+ADDRLP4 0+28+8
+ADDP4
+ADDRLP4 248
+INDIRI4
+ADDRLP4 0+28+8
+ADDP4
+INDIRF4
+ADDRLP4 168+8
+INDIRF4
+ADDRLP4 180
+INDIRF4
+NEGF4
+CNSTF4 1065353216
+ADDRLP4 184
+INDIRF4
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 252
+CNSTI4 12
+ADDRLP4 164
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 256
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 252
+INDIRI4
+ADDRLP4 0+28
+ADDP4
+ADDRLP4 252
+INDIRI4
+ADDRLP4 0+28
+ADDP4
+INDIRF4
+ADDRLP4 188
+INDIRF4
+ADDRLP4 256
+INDIRF4
+ADDRLP4 184
+INDIRF4
+DIVF4
+ADDRLP4 256
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 260
+CNSTI4 12
+ADDRLP4 164
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 264
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0+28+4
+ADDP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0+28+4
+ADDP4
+INDIRF4
+ADDRLP4 188+4
+INDIRF4
+ADDRLP4 264
+INDIRF4
+ADDRLP4 184
+INDIRF4
+DIVF4
+ADDRLP4 264
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 268
+CNSTI4 12
+ADDRLP4 164
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 272
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 268
+INDIRI4
+ADDRLP4 0+28+8
+ADDP4
+ADDRLP4 268
+INDIRI4
+ADDRLP4 0+28+8
+ADDP4
+INDIRF4
+ADDRLP4 188+8
+INDIRF4
+ADDRLP4 272
+INDIRF4
+ADDRLP4 184
+INDIRF4
+DIVF4
+ADDRLP4 272
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $604
+ADDRLP4 164
+ADDRLP4 164
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 3
+LTI4 $603
+ADDRLP4 0+84
+ADDRLP4 0+68
+INDIRF4
+ADDRLP4 168
+INDIRF4
+CNSTF4 3238002688
+CNSTF4 1065353216
+ADDRLP4 184
+INDIRF4
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+84+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRLP4 168+4
+INDIRF4
+CNSTF4 3238002688
+CNSTF4 1065353216
+ADDRLP4 184
+INDIRF4
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+84+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRLP4 168+8
+INDIRF4
+CNSTF4 3238002688
+CNSTF4 1065353216
+ADDRLP4 184
+INDIRF4
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68
+ADDRLP4 0+84
+INDIRB
+ASGNB 12
+LABELV $595
+ADDRLP4 0
+ARGP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_AddRefEntityWithPowerups
+CALLV
+pop
+LABELV $396
+endproc CG_Missile 292 44
+proc CG_Grapple 156 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 140
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 15
+LTI4 $662
+ADDRLP4 140
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $662
+ADDRLP4 144
+CNSTI4 132
+ADDRLP4 140
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ADDRLP4 140
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRGP4 CG_GrappleTrail
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+84
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+104
+ADDRGP4 cg
+INDIRI4
+CNSTI4 1
+BANDI4
+ASGNI4
+ADDRLP4 0+8
+ADDRLP4 144
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+4
+ADDRLP4 144
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRLP4 140
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRLP4 152
+ADDRGP4 VectorNormalize2
+CALLF4
+ASGNF4
+ADDRLP4 152
+INDIRF4
+CNSTF4 0
+NEF4 $669
+ADDRLP4 0+28+8
+CNSTF4 1065353216
+ASGNF4
+LABELV $669
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $661
+endproc CG_Grapple 156 12
+proc CG_Mover 144 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 140
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+84
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0+4
+CNSTI4 64
+ASGNI4
+ADDRLP4 0+104
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 6
+RSHI4
+CNSTI4 1
+BANDI4
+ASGNI4
+ADDRLP4 140
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 16777215
+NEI4 $681
+ADDRLP4 0+8
+ADDRLP4 140
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+36992
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $682
+JUMPV
+LABELV $681
+ADDRLP4 0+8
+ADDRLP4 140
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+34940
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $682
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 140
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $687
+ADDRLP4 0+104
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+8
+ADDRLP4 140
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+34940
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $687
+LABELV $674
+endproc CG_Mover 144 12
+export CG_Beam
+proc CG_Beam 144 12
+ADDRLP4 140
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRLP4 140
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+84
+ADDRLP4 140
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRLP4 0+4
+CNSTI4 64
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $692
+endproc CG_Beam 144 12
+proc CG_Portal 144 12
+ADDRLP4 140
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+84
+ADDRLP4 140
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 140
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 0+28+12
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 PerpendicularVector
+CALLV
+pop
+ADDRLP4 0+28+12
+ADDRGP4 vec3_origin
+INDIRF4
+ADDRLP4 0+28+12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+28+12+4
+ADDRGP4 vec3_origin+4
+INDIRF4
+ADDRLP4 0+28+12+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+28+12+8
+ADDRGP4 vec3_origin+8
+INDIRF4
+ADDRLP4 0+28+12+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+28
+ARGP4
+ADDRLP4 0+28+12
+ARGP4
+ADDRLP4 0+28+24
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 7
+ASGNI4
+ADDRLP4 0+96
+ADDRLP4 140
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+80
+ADDRLP4 140
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+104
+CNSTF4 1135869952
+ADDRLP4 140
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1132462080
+DIVF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $697
+endproc CG_Portal 144 12
+proc CG_CreateRotationMatrix 4 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 VectorInverse
+CALLV
+pop
+LABELV $730
+endproc CG_CreateRotationMatrix 4 16
+proc CG_TransposeMatrix 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $732
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $736
+ADDRLP4 12
+CNSTI4 2
+ASGNI4
+ADDRLP4 16
+CNSTI4 12
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LSHI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LSHI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $737
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $736
+LABELV $733
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $732
+LABELV $731
+endproc CG_TransposeMatrix 24 0
+proc CG_RotatePoint 28 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $740
+endproc CG_RotatePoint 28 0
+export CG_AdjustPositionForMover
+proc CG_AdjustPositionForMover 212 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LEI4 $750
+ADDRFP4 4
+INDIRI4
+CNSTI4 1022
+LTI4 $748
+LABELV $750
+ADDRFP4 16
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 24
+INDIRP4
+ADDRFP4 20
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 $747
+JUMPV
+LABELV $748
+ADDRLP4 48
+CNSTI4 808
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 188
+CNSTI4 4
+ASGNI4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 188
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 188
+INDIRI4
+EQI4 $751
+ADDRFP4 16
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 24
+INDIRP4
+ADDRFP4 20
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 $747
+JUMPV
+LABELV $751
+ADDRLP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 48
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 88
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 48
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 100
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 76
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 76+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 76+8
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 100
+INDIRF4
+ADDRLP4 88
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 100+4
+INDIRF4
+ADDRLP4 88+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 100+8
+INDIRF4
+ADDRLP4 88+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRGP4 CG_CreateRotationMatrix
+CALLV
+pop
+ADDRLP4 148
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRGP4 CG_TransposeMatrix
+CALLV
+pop
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 36
+INDIRB
+ASGNB 12
+ADDRLP4 64
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRGP4 CG_RotatePoint
+CALLV
+pop
+ADDRLP4 52
+ADDRLP4 64
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 52+4
+ADDRLP4 64+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 52+8
+ADDRLP4 64+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 52
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 52+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 52+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 196
+CNSTI4 4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 196
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 196
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 200
+CNSTI4 8
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 200
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 200
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 24
+INDIRP4
+ADDRFP4 20
+INDIRP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 204
+CNSTI4 4
+ASGNI4
+ADDRFP4 24
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+ADDRFP4 20
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 208
+CNSTI4 8
+ASGNI4
+ADDRFP4 24
+INDIRP4
+ADDRLP4 208
+INDIRI4
+ADDP4
+ADDRFP4 20
+INDIRP4
+ADDRLP4 208
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $747
+endproc CG_AdjustPositionForMover 212 12
+proc CG_InterpolateEntityPosition 60 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $786
+ADDRGP4 $789
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $786
+ADDRLP4 8
+ADDRGP4 cg+107596
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 756
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $791
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 760
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+ARGP4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+ARGP4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 756
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $791
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 760
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+CNSTI4 8
+ASGNI4
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 LerpAngle
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 44
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 LerpAngle
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 748
+ADDP4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 52
+CNSTI4 8
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 56
+ADDRGP4 LerpAngle
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 752
+ADDP4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+LABELV $785
+endproc CG_InterpolateEntityPosition 60 12
+proc CG_CalcEntityLerpPositions 28 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_smoothClients+12
+INDIRI4
+CNSTI4 0
+NEI4 $798
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 64
+GEI4 $801
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $803
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $801
+LABELV $803
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 756
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $801
+LABELV $798
+ADDRFP4 0
+INDIRP4
+CNSTI4 416
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $804
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $804
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_InterpolateEntityPosition
+CALLV
+pop
+ADDRGP4 $797
+JUMPV
+LABELV $804
+ADDRFP4 0
+INDIRP4
+CNSTI4 416
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $806
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $806
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 64
+GEI4 $806
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_InterpolateEntityPosition
+CALLV
+pop
+ADDRGP4 $797
+JUMPV
+LABELV $806
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+107612
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRGP4 cg+107612
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg+109072
+CVPU4 4
+EQU4 $810
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 cg+107612
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 CG_AdjustPositionForMover
+CALLV
+pop
+LABELV $810
+LABELV $797
+endproc CG_CalcEntityLerpPositions 28 28
+proc CG_TeamBase 140 12
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 6
+NEI4 $816
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $822
+ADDRLP4 0+8
+ADDRGP4 cgs+160652+84
+INDIRI4
+ASGNI4
+ADDRGP4 $823
+JUMPV
+LABELV $822
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $827
+ADDRLP4 0+8
+ADDRGP4 cgs+160652+88
+INDIRI4
+ASGNI4
+ADDRGP4 $828
+JUMPV
+LABELV $827
+ADDRLP4 0+8
+ADDRGP4 cgs+160652+92
+INDIRI4
+ASGNI4
+LABELV $828
+LABELV $823
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $816
+LABELV $815
+endproc CG_TeamBase 140 12
+proc CG_Balloon 164 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 140
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $836
+ADDRGP4 $835
+JUMPV
+LABELV $836
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 140
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $838
+ADDRLP4 140
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $840
+ADDRLP4 140
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTI4 4000
+ASGNI4
+LABELV $840
+ADDRLP4 140
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+EQI4 $842
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $844
+ADDRLP4 140
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+ADDRLP4 140
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+160652+1108
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $844
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+ADDRLP4 140
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+LABELV $842
+ADDRLP4 0+80
+ADDRLP4 140
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+96
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+100
+CNSTF4 1065353216
+CNSTF4 1092616192
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ADDRLP4 140
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+CVIF4 4
+DIVF4
+SUBF4
+ASGNF4
+ADDRLP4 0+100
+INDIRF4
+CNSTF4 1065353216
+LEF4 $853
+ADDRLP4 0+100
+CNSTF4 1065353216
+ASGNF4
+LABELV $853
+ADDRLP4 0+100
+INDIRF4
+CNSTF4 0
+GEF4 $839
+ADDRLP4 0+100
+CNSTF4 0
+ASGNF4
+ADDRGP4 $839
+JUMPV
+LABELV $838
+ADDRFP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $861
+ADDRLP4 140
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+ADDRLP4 140
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+160652+1112
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $861
+ADDRFP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $839
+ADDRLP4 140
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $865
+ADDRLP4 0+116
+CNSTU1 128
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 0
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 0
+ASGNU1
+ADDRGP4 $866
+JUMPV
+LABELV $865
+ADDRLP4 140
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $872
+ADDRLP4 0+116
+CNSTU1 0
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 0
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 128
+ASGNU1
+ADDRGP4 $873
+JUMPV
+LABELV $872
+ADDRLP4 0+116
+CNSTU1 128
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 128
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 128
+ASGNU1
+LABELV $873
+LABELV $866
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $888
+ARGP4
+ADDRLP4 144
+ADDRGP4 CG_GetCvarInt
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $886
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 148
+ADDRLP4 140
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 1
+EQI4 $897
+ADDRLP4 148
+INDIRI4
+CNSTI4 2
+EQI4 $900
+ADDRGP4 $894
+JUMPV
+LABELV $897
+ADDRGP4 $899
+ARGP4
+ADDRLP4 156
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRLP4 0+108
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRGP4 $895
+JUMPV
+LABELV $900
+ADDRGP4 $902
+ARGP4
+ADDRLP4 160
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRLP4 0+108
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRGP4 $895
+JUMPV
+LABELV $894
+ADDRLP4 0+108
+CNSTI4 0
+ASGNI4
+LABELV $895
+LABELV $886
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+84
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 140
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+34940
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $835
+endproc CG_Balloon 164 16
+data
+align 4
+LABELV $910
+byte 4 0
+code
+proc CG_Station 180 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+84
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+8
+ADDRGP4 cgs+160652+704
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $917
+ADDRGP4 cg+110504
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+CNSTF4 1000593162
+ADDRGP4 cg+107612
+INDIRI4
+CVIF4 4
+MULF4
+ARGF4
+ADDRLP4 152
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 1082130432
+ADDRLP4 152
+INDIRF4
+MULF4
+CNSTF4 1111490560
+ADDF4
+ADDF4
+ASGNF4
+CNSTF4 1000593162
+ADDRGP4 cg+107612
+INDIRI4
+CVIF4 4
+MULF4
+ARGF4
+ADDRLP4 156
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0+84+8
+ADDRLP4 0+84+8
+INDIRF4
+CNSTF4 1082130432
+ADDRLP4 156
+INDIRF4
+MULF4
+CNSTF4 1111490560
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRGP4 cgs+160652+712
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 140
+CNSTF4 0
+ASGNF4
+ADDRLP4 140+4
+CNSTF4 1135869952
+ADDRGP4 cg+110504+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0+8
+ADDRGP4 cgs+160652+708
+INDIRI4
+ASGNI4
+ADDRLP4 0+28
+ADDRLP4 0+28
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+4
+ADDRLP4 0+28+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+8
+ADDRLP4 0+28+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12
+ADDRLP4 0+28+12
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+4
+ADDRLP4 0+28+12+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+8
+ADDRLP4 0+28+12+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24
+ADDRLP4 0+28+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+4
+ADDRLP4 0+28+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+8
+ADDRLP4 0+28+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StopLoopingSound
+CALLV
+pop
+ADDRGP4 $918
+JUMPV
+LABELV $917
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+GEF4 $959
+ADDRFP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+GEF4 $961
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $961
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 cgs+160652+664
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $960
+JUMPV
+LABELV $961
+ADDRFP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+LEF4 $960
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $960
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StopLoopingSound
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 cgs+160652+672
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $960
+JUMPV
+LABELV $959
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $971
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRGP4 cgs+160652+668
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_AddRealLoopingSound
+CALLV
+pop
+LABELV $971
+LABELV $960
+ADDRFP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $975
+ADDRGP4 $910
+INDIRI4
+CNSTI4 2000
+ADDI4
+ADDRGP4 cg+107612
+INDIRI4
+GEI4 $975
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 cgs+160652+676
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $910
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+LABELV $975
+ADDRFP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 cg+110504
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0+28
+CNSTF4 1067869798
+ADDRLP4 0+28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+4
+CNSTF4 1067869798
+ADDRLP4 0+28+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+8
+CNSTF4 1067869798
+ADDRLP4 0+28+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12
+CNSTF4 1067869798
+ADDRLP4 0+28+12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+4
+CNSTF4 1067869798
+ADDRLP4 0+28+12+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+8
+CNSTF4 1067869798
+ADDRLP4 0+28+12+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24
+CNSTF4 1036831949
+ADDRLP4 0+28+24
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+4
+CNSTF4 1036831949
+ADDRLP4 0+28+24+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+8
+CNSTF4 1036831949
+ADDRLP4 0+28+24+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+112
+ADDRGP4 cgs+160652+640
+INDIRI4
+ASGNI4
+ADDRLP4 0+8
+ADDRGP4 cgs+160652+716
+INDIRI4
+ASGNI4
+CNSTF4 990057071
+ADDRGP4 cg+107612
+INDIRI4
+CVIF4 4
+MULF4
+ARGF4
+ADDRLP4 148
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 152
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 1103101952
+ADDRLP4 148
+INDIRF4
+MULF4
+CNSTF4 1107296256
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 152
+INDIRF4
+ASGNF4
+ADDRLP4 0+84+8
+ADDRLP4 152
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+CNSTF4 990057071
+ADDRGP4 cg+107612
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1070134723
+ADDF4
+ARGF4
+ADDRLP4 156
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+INDIRF4
+CNSTF4 1103101952
+ADDRLP4 156
+INDIRF4
+MULF4
+CNSTF4 1107296256
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 0+84+8
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+CNSTF4 990057071
+ADDRGP4 cg+107612
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1078523331
+ADDF4
+ARGF4
+ADDRLP4 164
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 168
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+INDIRF4
+CNSTF4 1103101952
+ADDRLP4 164
+INDIRF4
+MULF4
+CNSTF4 1107296256
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 168
+INDIRF4
+ASGNF4
+ADDRLP4 0+84+8
+ADDRLP4 168
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+CNSTF4 990057071
+ADDRGP4 cg+107612
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1083619410
+ADDF4
+ARGF4
+ADDRLP4 172
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 176
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+INDIRF4
+CNSTF4 1103101952
+ADDRLP4 172
+INDIRF4
+MULF4
+CNSTF4 1107296256
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 176
+INDIRF4
+ASGNF4
+ADDRLP4 0+84+8
+ADDRLP4 176
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $918
+LABELV $909
+endproc CG_Station 180 16
+export CG_BamBam_Explosion
+proc CG_BamBam_Explosion 48 72
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRLP4 16
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 16+8
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 cgs+160652+916
+INDIRI4
+ARGI4
+ADDRGP4 cgs+160652+820
+INDIRI4
+ARGI4
+CNSTI4 800
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_MakeExplosion
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 140
+ADDP4
+CNSTF4 1133903872
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTF4 1060320051
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 152
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 36
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1133903872
+ASGNF4
+ADDRGP4 cgs+160652+856
+INDIRI4
+ARGI4
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTF4 1090519040
+ARGF4
+ADDRLP4 0
+ARGP4
+CNSTF4 1110704128
+ARGF4
+CNSTF4 1125515264
+ARGF4
+CNSTI4 3
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRGP4 cg+107612
+INDIRI4
+ARGI4
+CNSTI4 3000
+ARGI4
+CNSTI4 500
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+CNSTI4 98
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRGP4 CG_GenerateParticles
+CALLV
+pop
+ADDRGP4 cgs+160652+860
+INDIRI4
+ARGI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTF4 1090519040
+ARGF4
+ADDRLP4 0
+ARGP4
+CNSTF4 1110704128
+ARGF4
+CNSTF4 1125515264
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRGP4 cg+107612
+INDIRI4
+ARGI4
+CNSTI4 3000
+ARGI4
+CNSTI4 500
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+CNSTI4 98
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRGP4 CG_GenerateParticles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1022
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+160652+864
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $1030
+endproc CG_BamBam_Explosion 48 72
+export CG_Boomies_Explosion
+proc CG_Boomies_Explosion 24 16
+ADDRLP4 4
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 17
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 1000
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 12
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTF4 1135869952
+CNSTF4 1073741824
+ADDRLP4 12
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTF4 1135869952
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 20
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTF4 1135869952
+CNSTF4 1073741824
+ADDRLP4 20
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1022
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+160652+868
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $1047
+endproc CG_Boomies_Explosion 24 16
+proc CG_DrawBamBam 152 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+34940
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+96
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+LTI4 $1058
+ADDRLP4 140
+INDIRI4
+CNSTI4 6
+GTI4 $1058
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1083
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1083
+address $1061
+address $1063
+address $1070
+address $1070
+address $1073
+address $1073
+address $1076
+code
+LABELV $1061
+ADDRLP4 0+80
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1059
+JUMPV
+LABELV $1063
+ADDRLP4 0+80
+CNSTI4 25
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+SUBI4
+MULI4
+CNSTI4 1000
+DIVI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0+80
+INDIRI4
+CNSTI4 50
+LEI4 $1059
+ADDRLP4 0+80
+CNSTI4 50
+ASGNI4
+ADDRGP4 $1059
+JUMPV
+LABELV $1070
+ADDRLP4 0+80
+CNSTI4 25
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+SUBI4
+MULI4
+CNSTI4 1000
+DIVI4
+CNSTI4 30
+MODI4
+CNSTI4 51
+ADDI4
+ASGNI4
+ADDRGP4 $1059
+JUMPV
+LABELV $1073
+ADDRLP4 148
+CNSTI4 25
+ASGNI4
+ADDRLP4 0+80
+ADDRLP4 148
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+SUBI4
+MULI4
+CNSTI4 1000
+DIVI4
+ADDRLP4 148
+INDIRI4
+MODI4
+CNSTI4 81
+ADDI4
+ASGNI4
+ADDRGP4 $1059
+JUMPV
+LABELV $1076
+ADDRLP4 0+80
+CNSTI4 25
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+SUBI4
+MULI4
+CNSTI4 1000
+DIVI4
+CNSTI4 106
+ADDI4
+ASGNI4
+ADDRLP4 0+80
+INDIRI4
+CNSTI4 200
+LEI4 $1059
+ADDRLP4 0+80
+CNSTI4 200
+ASGNI4
+LABELV $1058
+LABELV $1059
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ADDRLP4 0+80
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1052
+endproc CG_DrawBamBam 152 12
+proc CG_DrawBoomies 140 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+34940
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+80
+CNSTI4 25
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+SUBI4
+MULI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 0+80
+INDIRI4
+CNSTI4 15
+LEI4 $1092
+ADDRLP4 0+80
+CNSTI4 15
+ASGNI4
+LABELV $1092
+ADDRLP4 0+96
+ADDRLP4 0+80
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1085
+endproc CG_DrawBoomies 140 12
+proc CG_AddCEntity 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 18
+LTI4 $1099
+ADDRGP4 $1098
+JUMPV
+LABELV $1099
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CalcEntityLerpPositions
+CALLV
+pop
+ADDRGP4 cg_ambient+12
+INDIRI4
+CNSTI4 0
+NEI4 $1104
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 7
+EQI4 $1101
+LABELV $1104
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_EntityEffects
+CALLV
+pop
+LABELV $1101
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1105
+ADDRLP4 0
+INDIRI4
+CNSTI4 17
+GTI4 $1105
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1124
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1124
+address $1110
+address $1111
+address $1112
+address $1113
+address $1114
+address $1115
+address $1116
+address $1117
+address $1106
+address $1106
+address $1106
+address $1118
+address $1119
+address $1106
+address $1120
+address $1121
+address $1122
+address $1123
+code
+LABELV $1105
+ADDRGP4 $1108
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $1106
+JUMPV
+LABELV $1110
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_General
+CALLV
+pop
+ADDRGP4 $1106
+JUMPV
+LABELV $1111
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 16
+LSHI4
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Player
+CALLV
+pop
+ADDRGP4 $1106
+JUMPV
+LABELV $1112
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Item
+CALLV
+pop
+ADDRGP4 $1106
+JUMPV
+LABELV $1113
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Missile
+CALLV
+pop
+ADDRGP4 $1106
+JUMPV
+LABELV $1114
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Mover
+CALLV
+pop
+ADDRGP4 $1106
+JUMPV
+LABELV $1115
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Beam
+CALLV
+pop
+ADDRGP4 $1106
+JUMPV
+LABELV $1116
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Portal
+CALLV
+pop
+ADDRGP4 $1106
+JUMPV
+LABELV $1117
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Speaker
+CALLV
+pop
+ADDRGP4 $1106
+JUMPV
+LABELV $1118
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Grapple
+CALLV
+pop
+ADDRGP4 $1106
+JUMPV
+LABELV $1119
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_TeamBase
+CALLV
+pop
+ADDRGP4 $1106
+JUMPV
+LABELV $1120
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Balloon
+CALLV
+pop
+ADDRGP4 $1106
+JUMPV
+LABELV $1121
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Station
+CALLV
+pop
+ADDRGP4 $1106
+JUMPV
+LABELV $1122
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawBamBam
+CALLV
+pop
+ADDRGP4 $1106
+JUMPV
+LABELV $1123
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawBoomies
+CALLV
+pop
+LABELV $1106
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddBoundingBoxEntity
+CALLV
+pop
+LABELV $1098
+endproc CG_AddCEntity 16 8
+export CG_AddPacketEntities
+proc CG_AddPacketEntities 20 12
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1126
+ADDRLP4 16
+CNSTI4 8
+ASGNI4
+ADDRLP4 12
+ADDRGP4 cg+48
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $1131
+ADDRGP4 cg+107596
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1127
+JUMPV
+LABELV $1131
+ADDRGP4 cg+107596
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRGP4 $1127
+JUMPV
+LABELV $1126
+ADDRGP4 cg+107596
+CNSTF4 0
+ASGNF4
+LABELV $1127
+ADDRGP4 cg+110504
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+110504+4
+CNSTI4 360
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 2047
+BANDI4
+MULI4
+CVIF4 4
+CNSTF4 1157627904
+DIVF4
+ASGNF4
+ADDRGP4 cg+110504+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+110552
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+110552+4
+CNSTI4 360
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 1023
+BANDI4
+MULI4
+CVIF4 4
+CNSTF4 1149239296
+DIVF4
+ASGNF4
+ADDRGP4 cg+110552+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+110600
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+110600+4
+CNSTI4 360
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 1317
+MODI4
+MULI4
+CVIF4 4
+CNSTF4 1151647744
+DIVF4
+ASGNF4
+ADDRGP4 cg+110600+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+110600
+ARGP4
+ADDRGP4 cg+110612
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRGP4 cg+110504
+ARGP4
+ADDRGP4 cg+110516
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRGP4 cg+110552
+ARGP4
+ADDRGP4 cg+110564
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 8
+ADDRGP4 cg+108604
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 cg+109072
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityState
+CALLV
+pop
+ADDRGP4 cg+109072
+ARGP4
+ADDRGP4 CG_AddCEntity
+CALLV
+pop
+CNSTI4 808
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ARGP4
+ADDRGP4 CG_CalcEntityLerpPositions
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1169
+JUMPV
+LABELV $1166
+ADDRLP4 4
+CNSTI4 808
+CNSTI4 208
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 516
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddCEntity
+CALLV
+pop
+LABELV $1167
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1169
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 512
+ADDP4
+INDIRI4
+LTI4 $1166
+LABELV $1125
+endproc CG_AddPacketEntities 20 12
+bss
+align 4
+LABELV cg_tagCache
+skip 19456
+import CG_AddBoundingBox
+import CG_AddBoundingBoxEntity
+import CG_QueryCvar
+import CG_Timestamp
+import CG_LimitCvars
+import trap_RealTime
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import trap_R_inPVS
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_Cutscene2d_Draw
+import CG_Cutscene2d_UpdateTrans
+import CG_Cutscene2d_CheckCmd
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import Main_SpriteParticles
+import LaunchRevivalParticle
+import LaunchSpeedyPuffTrail
+import Init_SpriteParticles
+import AddLFsToScreen
+import AddLFToDrawList
+import Init_LensFlareSys
+import DumpPolyInfo
+import ActiveChooseLogoMenu
+import FindLogoForSpraying
+import Add_LogoToDrawList
+import AddLogosToScene
+import Init_SprayLogoSys
+import Calculate_2DOfDIR
+import Calculate_2DOf3D
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_ChangeLoadingProgress
+import CG_LoadingString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_ScorePlum
+import CG_TeleOutEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_GenerateParticles
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_PortalInView
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_GetWaterMuzzle
+import CG_SprayTrail
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponSRWC
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayer
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_UpdateVoipTeamIDs
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Draw3DModel
+import CG_SetPrintString
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import CG_MessagePrint
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_WorldToScreen
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_DrawPic1024
+import CG_DrawRect1024
+import CG_FillRect1024
+import CG_AdjustFrom1024
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddPolyBatched
+import CG_AddRefEntityBatched
+import CG_FlushSceneBatches
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_ForceModelChange
+import CG_GetCvarFloat
+import CG_GetCvarInt
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StreamAssets
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_icons
+import cg_ambient
+import cg_drawBBox
+import cg_drawVoiceNames
+import cg_drawLensflare
+import cg_timestamps
+import cg_skyLensflare
+import cg_sky
+import cg_curWarmupReady
+import cg_warmupReady
+import cg_glowModelTeam
+import cg_glowModel
+import cg_cineDrawLetterBox
+import cg_cineHideHud
+import cg_LPSwallhackAlpha
+import cg_LPSwallhackSize
+import cg_bigScoreType
+import cg_thirdPersonAutoSwitch
+import cg_drawTimeLeft
+import cg_drawServerInfos
+import cg_drawMessages
+import cg_drawups
+import cg_wopFFAhud
+import cg_printDir
+import cg_drawRealTime
+import cg_correctedWeaponPos
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_streamAssets
+import cg_deferPlayers
+import cg_predictItems
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_chatBeep
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_optimizePrediction
+import cg_nopredict
+import cg_errorDecay
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+export trailEnt
+align 4
+LABELV trailEnt
+skip 140
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $1108
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $902
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $899
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $888
+byte 1 114
+byte 1 95
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $789
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 80
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 103
+byte 1 46
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 83
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 0
+align 1
+LABELV $152
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 120
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
@@ -0,0 +1,9725 @@
+bss
+align 1
+LABELV $81
+skip 64
+export CG_PlaceString
+code
+proc CG_PlaceString 12 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $82
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -16385
+BANDI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 $84
+ASGNP4
+ADDRGP4 $83
+JUMPV
+LABELV $82
+ADDRLP4 4
+ADDRGP4 $85
+ASGNP4
+LABELV $83
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $86
+ADDRLP4 0
+ADDRGP4 $88
+ASGNP4
+ADDRGP4 $87
+JUMPV
+LABELV $86
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $89
+ADDRLP4 0
+ADDRGP4 $91
+ASGNP4
+ADDRGP4 $90
+JUMPV
+LABELV $89
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $92
+ADDRLP4 0
+ADDRGP4 $94
+ASGNP4
+ADDRGP4 $93
+JUMPV
+LABELV $92
+ADDRFP4 0
+INDIRI4
+CNSTI4 11
+NEI4 $95
+ADDRLP4 0
+ADDRGP4 $97
+ASGNP4
+ADDRGP4 $96
+JUMPV
+LABELV $95
+ADDRFP4 0
+INDIRI4
+CNSTI4 12
+NEI4 $98
+ADDRLP4 0
+ADDRGP4 $100
+ASGNP4
+ADDRGP4 $99
+JUMPV
+LABELV $98
+ADDRFP4 0
+INDIRI4
+CNSTI4 13
+NEI4 $101
+ADDRLP4 0
+ADDRGP4 $103
+ASGNP4
+ADDRGP4 $102
+JUMPV
+LABELV $101
+ADDRFP4 0
+INDIRI4
+CNSTI4 10
+MODI4
+CNSTI4 1
+NEI4 $104
+ADDRGP4 $106
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $105
+JUMPV
+LABELV $104
+ADDRFP4 0
+INDIRI4
+CNSTI4 10
+MODI4
+CNSTI4 2
+NEI4 $107
+ADDRGP4 $109
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $108
+JUMPV
+LABELV $107
+ADDRFP4 0
+INDIRI4
+CNSTI4 10
+MODI4
+CNSTI4 3
+NEI4 $110
+ADDRGP4 $112
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $111
+JUMPV
+LABELV $110
+ADDRGP4 $113
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+LABELV $111
+LABELV $108
+LABELV $105
+LABELV $102
+LABELV $99
+LABELV $96
+LABELV $93
+LABELV $90
+LABELV $87
+ADDRGP4 $81
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $114
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $81
+RETP4
+LABELV $80
+endproc CG_PlaceString 12 20
+lit
+align 4
+LABELV $196
+address $197
+address $198
+address $199
+byte 4 0
+code
+proc CG_Obituary 156 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $118
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $116
+LABELV $118
+ADDRGP4 $119
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $116
+ADDRLP4 92
+CNSTI4 1836
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $123
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $121
+LABELV $123
+ADDRLP4 0
+CNSTI4 1022
+ASGNI4
+ADDRLP4 52
+CNSTP4 0
+ASGNP4
+ADDRGP4 $122
+JUMPV
+LABELV $121
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 52
+ADDRLP4 112
+INDIRP4
+ASGNP4
+LABELV $122
+ADDRLP4 4
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 112
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $124
+ADDRGP4 $115
+JUMPV
+LABELV $124
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 $126
+ARGP4
+ADDRLP4 116
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+CNSTI4 30
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRGP4 $127
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 88
+ADDRGP4 $85
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1022
+EQI4 $128
+ADDRLP4 40
+CNSTP4 0
+ASGNP4
+ADDRGP4 $129
+JUMPV
+LABELV $128
+ADDRLP4 44
+INDIRI4
+CNSTI4 16
+LTI4 $130
+ADDRLP4 44
+INDIRI4
+CNSTI4 26
+GTI4 $130
+ADDRLP4 44
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $150-64
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $150
+address $138
+address $140
+address $142
+address $136
+address $130
+address $134
+address $132
+address $144
+address $146
+address $130
+address $148
+code
+LABELV $132
+ADDRLP4 40
+ADDRGP4 $133
+ASGNP4
+ADDRGP4 $131
+JUMPV
+LABELV $134
+ADDRLP4 40
+ADDRGP4 $135
+ASGNP4
+ADDRGP4 $131
+JUMPV
+LABELV $136
+ADDRLP4 40
+ADDRGP4 $137
+ASGNP4
+ADDRGP4 $131
+JUMPV
+LABELV $138
+ADDRLP4 40
+ADDRGP4 $139
+ASGNP4
+ADDRGP4 $131
+JUMPV
+LABELV $140
+ADDRLP4 40
+ADDRGP4 $141
+ASGNP4
+ADDRGP4 $131
+JUMPV
+LABELV $142
+ADDRLP4 40
+ADDRGP4 $143
+ASGNP4
+ADDRGP4 $131
+JUMPV
+LABELV $144
+ADDRLP4 40
+ADDRGP4 $145
+ASGNP4
+ADDRGP4 $131
+JUMPV
+LABELV $146
+ADDRLP4 40
+ADDRGP4 $147
+ASGNP4
+ADDRGP4 $131
+JUMPV
+LABELV $148
+ADDRLP4 40
+ADDRGP4 $149
+ASGNP4
+ADDRGP4 $131
+JUMPV
+LABELV $130
+ADDRLP4 40
+CNSTP4 0
+ASGNP4
+LABELV $131
+LABELV $129
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $152
+ADDRLP4 96
+ADDRLP4 92
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 124
+CNSTI4 5
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRLP4 124
+INDIRI4
+EQI4 $156
+ADDRLP4 44
+INDIRI4
+CNSTI4 7
+EQI4 $164
+ADDRLP4 44
+INDIRI4
+CNSTI4 9
+EQI4 $172
+ADDRLP4 44
+INDIRI4
+ADDRLP4 124
+INDIRI4
+LTI4 $154
+LABELV $183
+ADDRLP4 44
+INDIRI4
+CNSTI4 13
+EQI4 $180
+ADDRGP4 $154
+JUMPV
+LABELV $156
+ADDRLP4 96
+INDIRI4
+CNSTI4 1
+NEI4 $157
+ADDRLP4 40
+ADDRGP4 $159
+ASGNP4
+ADDRGP4 $155
+JUMPV
+LABELV $157
+ADDRLP4 96
+INDIRI4
+CNSTI4 2
+NEI4 $160
+ADDRLP4 40
+ADDRGP4 $162
+ASGNP4
+ADDRGP4 $155
+JUMPV
+LABELV $160
+ADDRLP4 40
+ADDRGP4 $163
+ASGNP4
+ADDRGP4 $155
+JUMPV
+LABELV $164
+ADDRLP4 96
+INDIRI4
+CNSTI4 1
+NEI4 $165
+ADDRLP4 40
+ADDRGP4 $167
+ASGNP4
+ADDRGP4 $155
+JUMPV
+LABELV $165
+ADDRLP4 96
+INDIRI4
+CNSTI4 2
+NEI4 $168
+ADDRLP4 40
+ADDRGP4 $170
+ASGNP4
+ADDRGP4 $155
+JUMPV
+LABELV $168
+ADDRLP4 40
+ADDRGP4 $171
+ASGNP4
+ADDRGP4 $155
+JUMPV
+LABELV $172
+ADDRLP4 96
+INDIRI4
+CNSTI4 1
+NEI4 $173
+ADDRLP4 40
+ADDRGP4 $175
+ASGNP4
+ADDRGP4 $155
+JUMPV
+LABELV $173
+ADDRLP4 96
+INDIRI4
+CNSTI4 2
+NEI4 $176
+ADDRLP4 40
+ADDRGP4 $178
+ASGNP4
+ADDRGP4 $155
+JUMPV
+LABELV $176
+ADDRLP4 40
+ADDRGP4 $179
+ASGNP4
+ADDRGP4 $155
+JUMPV
+LABELV $180
+ADDRLP4 40
+ADDRGP4 $181
+ASGNP4
+ADDRGP4 $155
+JUMPV
+LABELV $154
+ADDRLP4 40
+ADDRGP4 $182
+ASGNP4
+LABELV $155
+LABELV $152
+ADDRLP4 40
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $184
+ADDRGP4 $186
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $115
+JUMPV
+LABELV $184
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $187
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 5
+GEI4 $190
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 4
+NEI4 $193
+ADDRLP4 124
+ADDRGP4 $196
+INDIRB
+ASGNB 16
+ADDRLP4 96
+ADDRLP4 92
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+GTI4 $202
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+GEI4 $200
+LABELV $202
+ADDRLP4 96
+CNSTI4 2
+ASGNI4
+LABELV $200
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $203
+ADDRGP4 $205
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 96
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 124
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 120
+ADDRLP4 144
+INDIRP4
+ASGNP4
+ADDRGP4 $191
+JUMPV
+LABELV $203
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $206
+ADDRGP4 $208
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 96
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 124
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 120
+ADDRLP4 148
+INDIRP4
+ASGNP4
+ADDRGP4 $191
+JUMPV
+LABELV $206
+ADDRGP4 $209
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 96
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 124
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 120
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRGP4 $191
+JUMPV
+LABELV $193
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 124
+ADDRGP4 CG_PlaceString
+CALLP4
+ASGNP4
+ADDRGP4 $210
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 128
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 120
+ADDRLP4 128
+INDIRP4
+ASGNP4
+ADDRGP4 $191
+JUMPV
+LABELV $190
+ADDRGP4 $213
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 124
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 120
+ADDRLP4 124
+INDIRP4
+ASGNP4
+LABELV $191
+ADDRLP4 120
+INDIRP4
+ARGP4
+CNSTI4 144
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+LABELV $187
+ADDRLP4 52
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $214
+ADDRLP4 0
+CNSTI4 1022
+ASGNI4
+ADDRLP4 56
+ARGP4
+ADDRGP4 $216
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $215
+JUMPV
+LABELV $214
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRGP4 $126
+ARGP4
+ADDRLP4 120
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 120
+INDIRP4
+ARGP4
+CNSTI4 30
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 56
+ARGP4
+ADDRGP4 $127
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $217
+ADDRGP4 cg+121352
+ARGP4
+ADDRLP4 56
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $217
+LABELV $215
+ADDRLP4 0
+INDIRI4
+CNSTI4 1022
+EQI4 $222
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+LTI4 $224
+ADDRLP4 44
+INDIRI4
+CNSTI4 27
+GTI4 $224
+ADDRLP4 44
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $283-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $283
+address $233
+address $228
+address $231
+address $236
+address $239
+address $241
+address $244
+address $246
+address $246
+address $249
+address $252
+address $254
+address $254
+address $268
+address $257
+address $224
+address $273
+address $271
+address $279
+address $260
+address $275
+address $224
+address $224
+address $277
+address $226
+address $263
+address $265
+code
+LABELV $226
+ADDRLP4 40
+ADDRGP4 $227
+ASGNP4
+ADDRGP4 $225
+JUMPV
+LABELV $228
+ADDRLP4 40
+ADDRGP4 $229
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $230
+ASGNP4
+ADDRGP4 $225
+JUMPV
+LABELV $231
+ADDRLP4 40
+ADDRGP4 $232
+ASGNP4
+ADDRGP4 $225
+JUMPV
+LABELV $233
+ADDRLP4 40
+ADDRGP4 $234
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $235
+ASGNP4
+ADDRGP4 $225
+JUMPV
+LABELV $236
+ADDRLP4 40
+ADDRGP4 $237
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $238
+ASGNP4
+ADDRGP4 $225
+JUMPV
+LABELV $239
+ADDRLP4 40
+ADDRGP4 $240
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $238
+ASGNP4
+ADDRGP4 $225
+JUMPV
+LABELV $241
+ADDRLP4 40
+ADDRGP4 $242
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $243
+ASGNP4
+ADDRGP4 $225
+JUMPV
+LABELV $244
+ADDRLP4 40
+ADDRGP4 $245
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $243
+ASGNP4
+ADDRGP4 $225
+JUMPV
+LABELV $246
+ADDRLP4 40
+ADDRGP4 $247
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $248
+ASGNP4
+ADDRGP4 $225
+JUMPV
+LABELV $249
+ADDRLP4 40
+ADDRGP4 $250
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $251
+ASGNP4
+ADDRGP4 $225
+JUMPV
+LABELV $252
+ADDRLP4 40
+ADDRGP4 $253
+ASGNP4
+ADDRGP4 $225
+JUMPV
+LABELV $254
+ADDRLP4 40
+ADDRGP4 $255
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $256
+ASGNP4
+ADDRGP4 $225
+JUMPV
+LABELV $257
+ADDRLP4 40
+ADDRGP4 $258
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $259
+ASGNP4
+ADDRGP4 $225
+JUMPV
+LABELV $260
+ADDRLP4 40
+ADDRGP4 $261
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $262
+ASGNP4
+ADDRGP4 $225
+JUMPV
+LABELV $263
+ADDRLP4 40
+ADDRGP4 $247
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $264
+ASGNP4
+ADDRGP4 $225
+JUMPV
+LABELV $265
+ADDRLP4 40
+ADDRGP4 $266
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $267
+ASGNP4
+ADDRGP4 $225
+JUMPV
+LABELV $268
+ADDRLP4 40
+ADDRGP4 $269
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $270
+ASGNP4
+ADDRGP4 $225
+JUMPV
+LABELV $271
+ADDRLP4 40
+ADDRGP4 $272
+ASGNP4
+ADDRGP4 $225
+JUMPV
+LABELV $273
+ADDRLP4 40
+ADDRGP4 $274
+ASGNP4
+ADDRGP4 $225
+JUMPV
+LABELV $275
+ADDRLP4 40
+ADDRGP4 $276
+ASGNP4
+ADDRGP4 $225
+JUMPV
+LABELV $277
+ADDRLP4 40
+ADDRGP4 $278
+ASGNP4
+ADDRGP4 $225
+JUMPV
+LABELV $279
+ADDRLP4 40
+ADDRGP4 $280
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $281
+ASGNP4
+ADDRGP4 $225
+JUMPV
+LABELV $224
+ADDRLP4 40
+ADDRGP4 $282
+ASGNP4
+LABELV $225
+ADDRLP4 40
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $285
+ADDRGP4 $287
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $115
+JUMPV
+LABELV $285
+LABELV $222
+ADDRGP4 $288
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $115
+endproc CG_Obituary 156 20
+proc CG_UseItem 28 16
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CNSTI4 -769
+BANDI4
+CNSTI4 25
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $292
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+LEI4 $290
+LABELV $292
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $290
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $293
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $296
+ADDRGP4 $298
+ARGP4
+CNSTI4 144
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+LABELV $296
+LABELV $293
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $299
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+GTI4 $299
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $314
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $314
+address $301
+address $300
+address $305
+address $300
+address $300
+code
+LABELV $299
+LABELV $301
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 cgs+160652+1124
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $300
+JUMPV
+LABELV $305
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+LTI4 $306
+ADDRLP4 24
+INDIRI4
+CNSTI4 64
+GEI4 $306
+ADDRLP4 12
+CNSTI4 1836
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 212
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+LABELV $306
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 cgs+160652+1632
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $300
+LABELV $289
+endproc CG_UseItem 28 16
+proc CG_ItemPickup 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+131800
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+131804
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRGP4 cg+131808
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $321
+ADDRGP4 cg_autoswitch+12
+INDIRI4
+CNSTI4 0
+EQI4 $324
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $324
+ADDRGP4 cg+111040
+INDIRI4
+CNSTI4 0
+EQI4 $328
+ADDRGP4 CG_ZoomDown_f
+CALLV
+pop
+LABELV $328
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $331
+ADDRGP4 $315
+JUMPV
+LABELV $331
+ADDRGP4 cg+110500
+INDIRI4
+CNSTI4 12
+NEI4 $334
+ADDRGP4 $315
+JUMPV
+LABELV $334
+ADDRGP4 cg+131812
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRGP4 cg+110500
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $324
+LABELV $321
+ADDRLP4 0
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 bg_itemlist+36
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $341
+ADDRLP4 0
+INDIRI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $341
+ADDRGP4 cg+110500
+INDIRI4
+CNSTI4 12
+EQI4 $345
+ADDRGP4 cg+110500
+INDIRI4
+CNSTI4 1
+EQI4 $345
+ADDRGP4 cg+131812
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRGP4 cg+110500
+CNSTI4 1
+ASGNI4
+LABELV $345
+LABELV $341
+LABELV $315
+endproc CG_ItemPickup 4 0
+proc CG_WaterLevel 56 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 13
+EQI4 $355
+ADDRLP4 16
+INDIRI4
+CNSTI4 23
+NEI4 $353
+LABELV $355
+ADDRLP4 24
+CNSTI4 12
+ASGNI4
+ADDRGP4 $354
+JUMPV
+LABELV $353
+ADDRLP4 24
+CNSTI4 26
+ASGNI4
+LABELV $354
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+INDIRF4
+CNSTF4 3250585600
+ADDF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $358
+ADDRLP4 28
+ADDRLP4 24
+INDIRI4
+CNSTI4 -24
+SUBI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+INDIRF4
+CNSTF4 3250585600
+ADDF4
+ADDRLP4 32
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $361
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+INDIRF4
+CNSTF4 3250585600
+ADDF4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $364
+ADDRLP4 20
+CNSTI4 3
+ASGNI4
+LABELV $364
+LABELV $361
+LABELV $358
+ADDRLP4 20
+INDIRI4
+RETI4
+LABELV $352
+endproc CG_WaterLevel 56 8
+export CG_PainEvent
+proc CG_PainEvent 8 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 500
+GEI4 $367
+ADDRGP4 $366
+JUMPV
+LABELV $367
+ADDRFP4 4
+INDIRI4
+CNSTI4 25
+GEI4 $370
+ADDRLP4 0
+ADDRGP4 $372
+ASGNP4
+ADDRGP4 $371
+JUMPV
+LABELV $370
+ADDRFP4 4
+INDIRI4
+CNSTI4 50
+GEI4 $373
+ADDRLP4 0
+ADDRGP4 $375
+ASGNP4
+ADDRGP4 $374
+JUMPV
+LABELV $373
+ADDRFP4 4
+INDIRI4
+CNSTI4 75
+GEI4 $376
+ADDRLP4 0
+ADDRGP4 $378
+ASGNP4
+ADDRGP4 $377
+JUMPV
+LABELV $376
+ADDRLP4 0
+ADDRGP4 $379
+ASGNP4
+LABELV $377
+LABELV $374
+LABELV $371
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+LABELV $366
+endproc CG_PainEvent 8 16
+lit
+align 4
+LABELV $593
+byte 4 0
+byte 4 0
+byte 4 1065353216
+data
+align 4
+LABELV $1161
+byte 4 0
+export CG_EntityEvent
+code
+proc CG_EntityEvent 176 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CNSTI4 -769
+BANDI4
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $382
+ADDRGP4 $385
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $382
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $386
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRGP4 $391
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $386
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $394
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $392
+LABELV $394
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $392
+ADDRLP4 12
+CNSTI4 1836
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+LTI4 $396
+ADDRLP4 8
+INDIRI4
+CNSTI4 82
+GTI4 $396
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1211-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1211
+address $398
+address $408
+address $485
+address $496
+address $507
+address $558
+address $558
+address $558
+address $558
+address $518
+address $532
+address $544
+address $588
+address $600
+address $632
+address $639
+address $646
+address $653
+address $660
+address $698
+address $712
+address $720
+address $727
+address $732
+address $737
+address $742
+address $747
+address $752
+address $757
+address $762
+address $767
+address $772
+address $777
+address $782
+address $787
+address $792
+address $797
+address $802
+address $807
+address $396
+address $871
+address $864
+address $812
+address $820
+address $827
+address $835
+address $842
+address $850
+address $857
+address $879
+address $890
+address $972
+address $1005
+address $1016
+address $907
+address $914
+address $921
+address $928
+address $967
+address $981
+address $1128
+address $1136
+address $1136
+address $1136
+address $1145
+address $1150
+address $1168
+address $1181
+address $902
+address $1201
+address $1186
+address $610
+address $620
+address $626
+address $419
+address $430
+address $441
+address $452
+address $463
+address $474
+address $1191
+address $1196
+code
+LABELV $398
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $399
+ADDRGP4 $402
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $399
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $397
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 cgs+160652+1132
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $408
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $409
+ADDRGP4 $412
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $409
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $397
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+1132+80
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $419
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $420
+ADDRGP4 $423
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $420
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $397
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+1132+112
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $430
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $431
+ADDRGP4 $434
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $431
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $397
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+1132+128
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $441
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $442
+ADDRGP4 $445
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $442
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $397
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+1132+144
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $452
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $453
+ADDRGP4 $456
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $453
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $397
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+1132+160
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $463
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $464
+ADDRGP4 $467
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $464
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $397
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+1132+176
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $474
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $475
+ADDRGP4 $478
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $475
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $397
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+1132+192
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $485
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $486
+ADDRGP4 $489
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $486
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $397
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+1132+96
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $496
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $497
+ADDRGP4 $500
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $497
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $397
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+1132+96
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $507
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $508
+ADDRGP4 $511
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $508
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $397
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+1132+96
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $518
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $519
+ADDRGP4 $522
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $519
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+160652+1360
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+108604+140
+INDIRI4
+NEI4 $397
+ADDRGP4 cg+110492
+CNSTF4 3238002688
+ASGNF4
+ADDRGP4 cg+110496
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRGP4 $397
+JUMPV
+LABELV $532
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $533
+ADDRGP4 $536
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $533
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $379
+ARGP4
+ADDRLP4 44
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+108604+140
+INDIRI4
+NEI4 $397
+ADDRGP4 cg+110492
+CNSTF4 3246391296
+ASGNF4
+ADDRGP4 cg+110496
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRGP4 $397
+JUMPV
+LABELV $544
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $545
+ADDRGP4 $548
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $545
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $549
+ARGP4
+ADDRLP4 48
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+108604+140
+INDIRI4
+NEI4 $397
+ADDRGP4 cg+110492
+CNSTF4 3250585600
+ASGNF4
+ADDRGP4 cg+110496
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRGP4 $397
+JUMPV
+LABELV $558
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $559
+ADDRGP4 $562
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $559
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+108604+140
+INDIRI4
+EQI4 $563
+ADDRGP4 $397
+JUMPV
+LABELV $563
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+8
+INDIRI4
+ADDRLP4 64
+INDIRI4
+NEI4 $575
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+ADDRLP4 64
+INDIRI4
+NEI4 $575
+ADDRGP4 cg_nopredict+12
+INDIRI4
+ADDRLP4 64
+INDIRI4
+NEI4 $575
+ADDRGP4 cg_synchronousClients+12
+INDIRI4
+ADDRLP4 64
+INDIRI4
+EQI4 $567
+LABELV $575
+ADDRGP4 $397
+JUMPV
+LABELV $567
+ADDRLP4 52
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 cg+110480
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 200
+GEI4 $578
+ADDRLP4 56
+ADDRGP4 cg+110476
+INDIRF4
+CNSTI4 200
+ADDRLP4 52
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1128792064
+DIVF4
+ASGNF4
+ADDRGP4 $579
+JUMPV
+LABELV $578
+ADDRLP4 56
+CNSTF4 0
+ASGNF4
+LABELV $579
+ADDRLP4 60
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 24
+SUBI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRGP4 cg+110476
+ADDRLP4 56
+INDIRF4
+ADDRLP4 60
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRGP4 cg+110476
+INDIRF4
+CNSTF4 1107296256
+LEF4 $582
+ADDRGP4 cg+110476
+CNSTF4 1107296256
+ASGNF4
+LABELV $582
+ADDRGP4 cg+110480
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRGP4 $397
+JUMPV
+LABELV $588
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $589
+ADDRGP4 $592
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $589
+ADDRLP4 52
+ADDRGP4 $593
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ARGP4
+ADDRLP4 52
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRLP4 64
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+CNSTF4 1051260355
+ARGF4
+CNSTF4 1148846080
+ARGF4
+ADDRGP4 cg+107612
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 cgs+160652+208
+INDIRI4
+ARGI4
+ADDRGP4 CG_SmokePuff
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRGP4 cgs+160652+1368
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $599
+ARGP4
+ADDRLP4 52
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $600
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $601
+ADDRGP4 $604
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $601
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $599
+ARGP4
+ADDRLP4 56
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+CNSTI4 808
+ADDRLP4 0
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+188
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $397
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 cgs+160652+1376
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $610
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $611
+ADDRGP4 $614
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $611
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $615
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 64
+INDIRF4
+CNSTF4 1193033728
+LEF4 $615
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRGP4 cgs+160652+680
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $615
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $619
+ARGP4
+ADDRLP4 68
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $620
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $621
+ADDRGP4 $624
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $621
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $625
+ARGP4
+ADDRLP4 72
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $626
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $627
+ADDRGP4 $630
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $627
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $631
+ARGP4
+ADDRLP4 76
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $632
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $633
+ADDRGP4 $636
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $633
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+160652+1616
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $639
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $640
+ADDRGP4 $643
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $640
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+160652+1620
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $646
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $647
+ADDRGP4 $650
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $647
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+160652+1624
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRLP4 12
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $397
+JUMPV
+LABELV $653
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $654
+ADDRGP4 $657
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $654
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $658
+ARGP4
+ADDRLP4 80
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRLP4 12
+INDIRP4
+CNSTI4 164
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRGP4 $397
+JUMPV
+LABELV $660
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $661
+ADDRGP4 $664
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $661
+ADDRLP4 84
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 92
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 1
+LTI4 $667
+ADDRLP4 92
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $665
+LABELV $667
+ADDRGP4 $397
+JUMPV
+LABELV $665
+ADDRLP4 88
+CNSTI4 52
+ADDRLP4 84
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $668
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+160652+1756
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $669
+JUMPV
+LABELV $668
+ADDRLP4 88
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $672
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+160652+1720
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $673
+JUMPV
+LABELV $672
+ADDRLP4 88
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 7
+EQI4 $676
+ADDRLP4 88
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $678
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+160652+692
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $678
+ADDRLP4 96
+ADDRLP4 88
+INDIRP4
+ASGNP4
+ADDRLP4 100
+CNSTI4 1
+ASGNI4
+ADDRLP4 96
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRLP4 100
+INDIRI4
+NEI4 $685
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ADDRLP4 100
+INDIRI4
+ADDRLP4 96
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $682
+LABELV $685
+ADDRLP4 88
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 104
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRLP4 88
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $686
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+160652+696
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $687
+JUMPV
+LABELV $686
+ADDRLP4 88
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 $692
+ARGP4
+ADDRLP4 108
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+NEI4 $690
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+160652+700
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $690
+LABELV $687
+LABELV $682
+LABELV $676
+LABELV $673
+LABELV $669
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $397
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRGP4 CG_ItemPickup
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $698
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $699
+ADDRGP4 $702
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $699
+ADDRLP4 84
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 92
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 1
+LTI4 $705
+ADDRLP4 92
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $703
+LABELV $705
+ADDRGP4 $397
+JUMPV
+LABELV $703
+ADDRLP4 88
+CNSTI4 52
+ADDRLP4 84
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $706
+ADDRLP4 88
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 96
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $706
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $397
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRGP4 CG_ItemPickup
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $712
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $713
+ADDRGP4 $716
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $713
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $397
+ADDRGP4 CG_OutOfAmmoChange
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $720
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $721
+ADDRGP4 $724
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $721
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+160652+1120
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $727
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $728
+ADDRGP4 $731
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $728
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FireWeapon
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $732
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $733
+ADDRGP4 $736
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $733
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $737
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $738
+ADDRGP4 $741
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $738
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $742
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $743
+ADDRGP4 $746
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $743
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $747
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $748
+ADDRGP4 $751
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $748
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $752
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $753
+ADDRGP4 $756
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $753
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $757
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $758
+ADDRGP4 $761
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $758
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $762
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $763
+ADDRGP4 $766
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $763
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $767
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $768
+ADDRGP4 $771
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $768
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $772
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $773
+ADDRGP4 $776
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $773
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $777
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $778
+ADDRGP4 $781
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $778
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $782
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $783
+ADDRGP4 $786
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $783
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $787
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $788
+ADDRGP4 $791
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $788
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $792
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $793
+ADDRGP4 $796
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $793
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $797
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $798
+ADDRGP4 $801
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $798
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $802
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $803
+ADDRGP4 $806
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $803
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $807
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $808
+ADDRGP4 $811
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $808
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $812
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $813
+ADDRGP4 $816
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $813
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+160652+1340
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRLP4 12
+INDIRP4
+CNSTI4 160
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRGP4 $397
+JUMPV
+LABELV $820
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $821
+ADDRGP4 $824
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $821
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+160652+1344
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_TeleOutEffect
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $827
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $828
+ADDRGP4 $831
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $828
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+160652+1340
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRLP4 12
+INDIRP4
+CNSTI4 160
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRGP4 $397
+JUMPV
+LABELV $835
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $836
+ADDRGP4 $839
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $836
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+160652+1344
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_TeleOutEffect
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $842
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $843
+ADDRGP4 $846
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $843
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+160652+1340
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRLP4 12
+INDIRP4
+CNSTI4 160
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRGP4 $397
+JUMPV
+LABELV $850
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $851
+ADDRGP4 $854
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $851
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+160652+1344
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_TeleOutEffect
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $857
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $858
+ADDRGP4 $861
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $858
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+160652+1372
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $864
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $865
+ADDRGP4 $868
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $865
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+160652+1352
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $871
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $872
+ADDRGP4 $875
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $872
+ADDRFP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+160652+1352
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $879
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $880
+ADDRGP4 $883
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $880
+ADDRLP4 88
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $884
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+160652+1760
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $884
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+160652+1764
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $890
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $891
+ADDRGP4 $894
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $891
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRLP4 92
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $896
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+160652+1760
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $896
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+160652+1764
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $902
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $903
+ADDRGP4 $906
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $903
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_ScorePlum
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $907
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $908
+ADDRGP4 $911
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $908
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+CNSTU4 36
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 28
+CNSTI4 132
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $912
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 104
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $912
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_MissileHitPlayer
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $914
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $915
+ADDRGP4 $918
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $915
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+CNSTU4 36
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 28
+CNSTI4 132
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $919
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 116
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 116
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $919
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+ADDRLP4 120
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 120
+INDIRI4
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $921
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $922
+ADDRGP4 $925
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $922
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+CNSTU4 36
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 28
+CNSTI4 132
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $926
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $926
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $928
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $929
+ADDRGP4 $932
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $929
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $933
+ADDRGP4 cg+108596
+INDIRI4
+CNSTI4 0
+NEI4 $933
+ADDRGP4 cg_drawGun+12
+INDIRI4
+CNSTI4 2
+NEI4 $937
+ADDRLP4 132
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ADDRLP4 132
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+110648+36+12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 136
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ADDRLP4 136
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+110648+36+12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ADDRLP4 140
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+110648+36+12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $938
+JUMPV
+LABELV $937
+ADDRGP4 cg_drawGun+12
+INDIRI4
+CNSTI4 3
+NEI4 $951
+ADDRLP4 144
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ADDRLP4 144
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+ADDRGP4 cg+110648+36+12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ADDRLP4 148
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+ADDRGP4 cg+110648+36+12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 152
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ADDRLP4 152
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+ADDRGP4 cg+110648+36+12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $951
+LABELV $938
+LABELV $933
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRGP4 CG_RailTrail
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 255
+EQI4 $397
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $967
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $968
+ADDRGP4 $971
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $968
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_ShotgunFire
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $972
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $973
+ADDRGP4 $976
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $973
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+35964
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $977
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+35964
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $977
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 288
+ADDI4
+ARGI4
+ADDRLP4 136
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 136
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $981
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $982
+ADDRGP4 $985
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $982
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 255
+EQI4 $397
+ADDRLP4 136
+CNSTF4 1107296256
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 160
+ADDRLP4 12
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 1
+EQI4 $991
+ADDRLP4 160
+INDIRI4
+CNSTI4 2
+EQI4 $994
+ADDRGP4 $988
+JUMPV
+LABELV $991
+ADDRLP4 140
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 140+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 140+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $989
+JUMPV
+LABELV $994
+ADDRLP4 168
+CNSTF4 0
+ASGNF4
+ADDRLP4 140
+ADDRLP4 168
+INDIRF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 168
+INDIRF4
+ASGNF4
+ADDRLP4 140+8
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $989
+JUMPV
+LABELV $988
+ADDRLP4 140
+ADDRLP4 12
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $989
+ADDRLP4 140+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 35
+NEI4 $998
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 FindLogoForSpraying
+CALLI4
+ASGNI4
+ADDRLP4 156
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 156
+INDIRI4
+ARGI4
+ADDRLP4 136
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 Add_LogoToDrawList
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $998
+ADDRLP4 168
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+376
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTF4 1135869952
+ADDRLP4 168
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 140
+INDIRF4
+ARGF4
+ADDRLP4 140+4
+INDIRF4
+ARGF4
+ADDRLP4 140+8
+INDIRF4
+ARGF4
+ADDRLP4 140+12
+INDIRF4
+ARGF4
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+ADDRLP4 172
+INDIRI4
+ARGI4
+ADDRLP4 136
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 172
+INDIRI4
+ARGI4
+ADDRGP4 CG_ImpactMark
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $1005
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1006
+ADDRGP4 $1009
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1006
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+35964
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1010
+CNSTP4 0
+ARGP4
+ADDRLP4 136
+CNSTI4 184
+ASGNI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 136
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 136
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+35964
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $1010
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 288
+ADDI4
+ARGI4
+ADDRLP4 136
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 136
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $1016
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1017
+ADDRGP4 $1020
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1017
+ADDRLP4 136
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+LTI4 $397
+ADDRLP4 136
+INDIRI4
+CNSTI4 12
+GTI4 $397
+ADDRLP4 136
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1127
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1127
+address $1024
+address $1034
+address $1044
+address $1056
+address $1068
+address $1090
+address $397
+address $397
+address $1112
+address $1115
+address $1118
+address $1121
+address $1124
+code
+LABELV $1024
+CNSTI4 1836
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+68
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1025
+ADDRGP4 cgs+160652+1676
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $1025
+ADDRGP4 cgs+160652+1680
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $1034
+CNSTI4 1836
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+68
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1035
+ADDRGP4 cgs+160652+1676
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $1035
+ADDRGP4 cgs+160652+1680
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $1044
+CNSTI4 1836
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+68
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1045
+ADDRGP4 cgs+160652+1684
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1046
+JUMPV
+LABELV $1045
+ADDRGP4 cgs+160652+1688
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+LABELV $1046
+ADDRGP4 cgs+160652+1704
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $1056
+CNSTI4 1836
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+68
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1057
+ADDRGP4 cgs+160652+1684
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1058
+JUMPV
+LABELV $1057
+ADDRGP4 cgs+160652+1688
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+LABELV $1058
+ADDRGP4 cgs+160652+1700
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $1068
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 392
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1069
+ADDRGP4 $397
+JUMPV
+LABELV $1069
+CNSTI4 1836
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+68
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1072
+ADDRGP4 cgs+160652+1696
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 cgs+160652+1712
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $1072
+CNSTI4 1836
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+68
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $397
+ADDRGP4 cgs+160652+1692
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 cgs+160652+1708
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $1090
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 388
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1091
+ADDRGP4 $397
+JUMPV
+LABELV $1091
+CNSTI4 1836
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+68
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1094
+ADDRGP4 cgs+160652+1696
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 cgs+160652+1712
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $1094
+CNSTI4 1836
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+68
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $397
+ADDRGP4 cgs+160652+1692
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 cgs+160652+1708
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $1112
+ADDRGP4 cgs+160652+1640
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $1115
+ADDRGP4 cgs+160652+1644
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $1118
+ADDRLP4 144
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1077935709
+ADDRLP4 144
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+MULF4
+CVFI4 4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+1648
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $1121
+ADDRLP4 148
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1077935709
+ADDRLP4 148
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+MULF4
+CVFI4 4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+1660
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $1124
+ADDRGP4 cgs+160652+1672
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $1128
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1129
+ADDRGP4 $1132
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1129
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $397
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_PainEvent
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $1136
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1137
+ADDRGP4 $1140
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1137
+ADDRGP4 $1141
+JUMPV
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $1143
+ARGP4
+ADDRLP4 136
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $1141
+ADDRGP4 $1144
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 62
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 136
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 136
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $1145
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1146
+ADDRGP4 $1149
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1146
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Obituary
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $1150
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1151
+ADDRGP4 $1154
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1151
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1155
+ADDRGP4 cg+131556
+CNSTI4 6
+ASGNI4
+ADDRGP4 cg+131560
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+LABELV $1155
+ADDRGP4 $1161
+INDIRI4
+CNSTI4 800
+ADDI4
+ADDRGP4 cg+107612
+INDIRI4
+GTI4 $397
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 cgs+160652+1752
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $1161
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRGP4 $397
+JUMPV
+LABELV $1168
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1169
+ADDRGP4 $1172
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1169
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1173
+ADDRGP4 cg+131556
+CNSTI4 2
+ASGNI4
+ADDRGP4 cg+131560
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+LABELV $1173
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 cgs+160652+1116
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $1181
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $397
+ADDRGP4 $1185
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $1186
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1187
+ADDRGP4 $1190
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1187
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StopLoopingSound
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $397
+JUMPV
+LABELV $1191
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1192
+ADDRGP4 $1195
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1192
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_BamBam_Explosion
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $1196
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1197
+ADDRGP4 $1200
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1197
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_Boomies_Explosion
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $1201
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1202
+ADDRGP4 $1205
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1202
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Beam
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $396
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1206
+ADDRGP4 $1209
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1206
+ADDRGP4 $1210
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $397
+LABELV $381
+endproc CG_EntityEvent 176 48
+export CG_CheckEvents
+proc CG_CheckEvents 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 18
+LEI4 $1214
+ADDRFP4 0
+INDIRP4
+CNSTI4 428
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1216
+ADDRGP4 $1213
+JUMPV
+LABELV $1216
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1218
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1218
+ADDRFP4 0
+INDIRP4
+CNSTI4 428
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 18
+SUBI4
+ASGNI4
+ADDRGP4 $1215
+JUMPV
+LABELV $1214
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 428
+ADDP4
+INDIRI4
+NEI4 $1220
+ADDRGP4 $1213
+JUMPV
+LABELV $1220
+ADDRFP4 0
+INDIRP4
+CNSTI4 428
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CNSTI4 -769
+BANDI4
+CNSTI4 0
+NEI4 $1222
+ADDRGP4 $1213
+JUMPV
+LABELV $1222
+LABELV $1215
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetEntitySoundPosition
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ARGP4
+ADDRGP4 CG_EntityEvent
+CALLV
+pop
+LABELV $1213
+endproc CG_CheckEvents 8 12
+import CG_AddBoundingBox
+import CG_AddBoundingBoxEntity
+import CG_QueryCvar
+import CG_Timestamp
+import CG_LimitCvars
+import trap_RealTime
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import trap_R_inPVS
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_Cutscene2d_Draw
+import CG_Cutscene2d_UpdateTrans
+import CG_Cutscene2d_CheckCmd
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import Main_SpriteParticles
+import LaunchRevivalParticle
+import LaunchSpeedyPuffTrail
+import Init_SpriteParticles
+import AddLFsToScreen
+import AddLFToDrawList
+import Init_LensFlareSys
+import DumpPolyInfo
+import ActiveChooseLogoMenu
+import FindLogoForSpraying
+import Add_LogoToDrawList
+import AddLogosToScene
+import Init_SprayLogoSys
+import Calculate_2DOfDIR
+import Calculate_2DOf3D
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_ChangeLoadingProgress
+import CG_LoadingString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_ScorePlum
+import CG_TeleOutEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_GenerateParticles
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_PortalInView
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_GetWaterMuzzle
+import CG_SprayTrail
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponSRWC
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_Boomies_Explosion
+import CG_BamBam_Explosion
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_LerpTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_LoadDeferredPlayer
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_UpdateVoipTeamIDs
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Draw3DModel
+import CG_SetPrintString
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import CG_MessagePrint
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_WorldToScreen
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_DrawPic1024
+import CG_DrawRect1024
+import CG_FillRect1024
+import CG_AdjustFrom1024
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddPolyBatched
+import CG_AddRefEntityBatched
+import CG_FlushSceneBatches
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_ForceModelChange
+import CG_GetCvarFloat
+import CG_GetCvarInt
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StreamAssets
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_icons
+import cg_ambient
+import cg_drawBBox
+import cg_drawVoiceNames
+import cg_drawLensflare
+import cg_timestamps
+import cg_skyLensflare
+import cg_sky
+import cg_curWarmupReady
+import cg_warmupReady
+import cg_glowModelTeam
+import cg_glowModel
+import cg_cineDrawLetterBox
+import cg_cineHideHud
+import cg_LPSwallhackAlpha
+import cg_LPSwallhackSize
+import cg_bigScoreType
+import cg_thirdPersonAutoSwitch
+import cg_drawTimeLeft
+import cg_drawServerInfos
+import cg_drawMessages
+import cg_drawups
+import cg_wopFFAhud
+import cg_printDir
+import cg_drawRealTime
+import cg_correctedWeaponPos
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_streamAssets
+import cg_deferPlayers
+import cg_predictItems
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_chatBeep
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_optimizePrediction
+import cg_nopredict
+import cg_errorDecay
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import trailEnt
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $1210
+byte 1 85
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1209
+byte 1 85
+byte 1 78
+byte 1 75
+byte 1 78
+byte 1 79
+byte 1 87
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $1205
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 68
+byte 1 69
+byte 1 66
+byte 1 85
+byte 1 71
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $1200
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 66
+byte 1 79
+byte 1 79
+byte 1 77
+byte 1 73
+byte 1 69
+byte 1 83
+byte 1 95
+byte 1 69
+byte 1 88
+byte 1 80
+byte 1 76
+byte 1 79
+byte 1 83
+byte 1 73
+byte 1 79
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $1195
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 66
+byte 1 65
+byte 1 77
+byte 1 66
+byte 1 65
+byte 1 77
+byte 1 95
+byte 1 69
+byte 1 88
+byte 1 80
+byte 1 76
+byte 1 79
+byte 1 83
+byte 1 73
+byte 1 79
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $1190
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 79
+byte 1 80
+byte 1 76
+byte 1 79
+byte 1 79
+byte 1 80
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $1185
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 73
+byte 1 66
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 10
+byte 1 0
+align 1
+LABELV $1172
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 87
+byte 1 69
+byte 1 82
+byte 1 85
+byte 1 80
+byte 1 95
+byte 1 80
+byte 1 65
+byte 1 68
+byte 1 80
+byte 1 79
+byte 1 87
+byte 1 69
+byte 1 82
+byte 1 10
+byte 1 0
+align 1
+LABELV $1154
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 87
+byte 1 69
+byte 1 82
+byte 1 85
+byte 1 80
+byte 1 95
+byte 1 82
+byte 1 69
+byte 1 86
+byte 1 73
+byte 1 86
+byte 1 65
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $1149
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 79
+byte 1 66
+byte 1 73
+byte 1 84
+byte 1 85
+byte 1 65
+byte 1 82
+byte 1 89
+byte 1 10
+byte 1 0
+align 1
+LABELV $1144
+byte 1 42
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1143
+byte 1 42
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $1140
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 68
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 72
+byte 1 120
+byte 1 10
+byte 1 0
+align 1
+LABELV $1132
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 65
+byte 1 73
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $1020
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $1009
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $985
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 80
+byte 1 82
+byte 1 65
+byte 1 89
+byte 1 76
+byte 1 79
+byte 1 71
+byte 1 79
+byte 1 10
+byte 1 0
+align 1
+LABELV $976
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 69
+byte 1 82
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $971
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 72
+byte 1 79
+byte 1 84
+byte 1 71
+byte 1 85
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $932
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 82
+byte 1 65
+byte 1 73
+byte 1 76
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 73
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $925
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 84
+byte 1 65
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $918
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 10
+byte 1 0
+align 1
+LABELV $911
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 95
+byte 1 72
+byte 1 73
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $906
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 67
+byte 1 79
+byte 1 82
+byte 1 69
+byte 1 80
+byte 1 76
+byte 1 85
+byte 1 77
+byte 1 10
+byte 1 0
+align 1
+LABELV $894
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 89
+byte 1 95
+byte 1 66
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 67
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $883
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 82
+byte 1 69
+byte 1 78
+byte 1 65
+byte 1 68
+byte 1 69
+byte 1 95
+byte 1 66
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 67
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $875
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 82
+byte 1 69
+byte 1 83
+byte 1 80
+byte 1 65
+byte 1 87
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $868
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $861
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 68
+byte 1 82
+byte 1 79
+byte 1 80
+byte 1 95
+byte 1 67
+byte 1 65
+byte 1 82
+byte 1 84
+byte 1 82
+byte 1 73
+byte 1 68
+byte 1 71
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $854
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 95
+byte 1 66
+byte 1 76
+byte 1 85
+byte 1 69
+byte 1 95
+byte 1 79
+byte 1 85
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $846
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 95
+byte 1 66
+byte 1 76
+byte 1 85
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $839
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 95
+byte 1 82
+byte 1 69
+byte 1 68
+byte 1 95
+byte 1 79
+byte 1 85
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $831
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 95
+byte 1 82
+byte 1 69
+byte 1 68
+byte 1 95
+byte 1 73
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $824
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 95
+byte 1 79
+byte 1 85
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $816
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 95
+byte 1 73
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $811
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 52
+byte 1 10
+byte 1 0
+align 1
+LABELV $806
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 51
+byte 1 10
+byte 1 0
+align 1
+LABELV $801
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 50
+byte 1 10
+byte 1 0
+align 1
+LABELV $796
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 49
+byte 1 10
+byte 1 0
+align 1
+LABELV $791
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $786
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 57
+byte 1 10
+byte 1 0
+align 1
+LABELV $781
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 56
+byte 1 10
+byte 1 0
+align 1
+LABELV $776
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 55
+byte 1 10
+byte 1 0
+align 1
+LABELV $771
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 54
+byte 1 10
+byte 1 0
+align 1
+LABELV $766
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 53
+byte 1 10
+byte 1 0
+align 1
+LABELV $761
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 52
+byte 1 10
+byte 1 0
+align 1
+LABELV $756
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 51
+byte 1 10
+byte 1 0
+align 1
+LABELV $751
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 50
+byte 1 10
+byte 1 0
+align 1
+LABELV $746
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 10
+byte 1 0
+align 1
+LABELV $741
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $736
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 77
+byte 1 80
+byte 1 69
+byte 1 82
+byte 1 73
+byte 1 85
+byte 1 83
+byte 1 95
+byte 1 69
+byte 1 88
+byte 1 80
+byte 1 76
+byte 1 79
+byte 1 68
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $731
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 73
+byte 1 82
+byte 1 69
+byte 1 95
+byte 1 87
+byte 1 69
+byte 1 65
+byte 1 80
+byte 1 79
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $724
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 78
+byte 1 71
+byte 1 69
+byte 1 95
+byte 1 87
+byte 1 69
+byte 1 65
+byte 1 80
+byte 1 79
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $716
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 78
+byte 1 79
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 10
+byte 1 0
+align 1
+LABELV $702
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 80
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 85
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $692
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 101
+byte 1 108
+byte 1 100
+byte 1 0
+align 1
+LABELV $664
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 80
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 85
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $658
+byte 1 42
+byte 1 103
+byte 1 97
+byte 1 115
+byte 1 112
+byte 1 0
+align 1
+LABELV $657
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 67
+byte 1 76
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 10
+byte 1 0
+align 1
+LABELV $650
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 69
+byte 1 82
+byte 1 10
+byte 1 0
+align 1
+LABELV $643
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 76
+byte 1 69
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $636
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 79
+byte 1 85
+byte 1 67
+byte 1 72
+byte 1 10
+byte 1 0
+align 1
+LABELV $631
+byte 1 42
+byte 1 104
+byte 1 101
+byte 1 104
+byte 1 101
+byte 1 50
+byte 1 0
+align 1
+LABELV $630
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 72
+byte 1 69
+byte 1 72
+byte 1 69
+byte 1 50
+byte 1 10
+byte 1 0
+align 1
+LABELV $625
+byte 1 42
+byte 1 104
+byte 1 101
+byte 1 104
+byte 1 101
+byte 1 49
+byte 1 0
+align 1
+LABELV $624
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 72
+byte 1 69
+byte 1 72
+byte 1 69
+byte 1 49
+byte 1 10
+byte 1 0
+align 1
+LABELV $619
+byte 1 42
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $614
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $604
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 74
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $599
+byte 1 42
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 49
+byte 1 0
+align 1
+LABELV $592
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 74
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 95
+byte 1 80
+byte 1 65
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $562
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $549
+byte 1 42
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 49
+byte 1 0
+align 1
+LABELV $548
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 82
+byte 1 10
+byte 1 0
+align 1
+LABELV $536
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 68
+byte 1 73
+byte 1 85
+byte 1 77
+byte 1 10
+byte 1 0
+align 1
+LABELV $522
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 72
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $511
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 87
+byte 1 73
+byte 1 77
+byte 1 10
+byte 1 0
+align 1
+LABELV $500
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 87
+byte 1 65
+byte 1 68
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $489
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 10
+byte 1 0
+align 1
+LABELV $478
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 83
+byte 1 78
+byte 1 79
+byte 1 87
+byte 1 10
+byte 1 0
+align 1
+LABELV $467
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 87
+byte 1 79
+byte 1 79
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $456
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 70
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $445
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 83
+byte 1 65
+byte 1 78
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $434
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 76
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 73
+byte 1 67
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $423
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 67
+byte 1 65
+byte 1 82
+byte 1 80
+byte 1 69
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $412
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 84
+byte 1 65
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $402
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $391
+byte 1 90
+byte 1 69
+byte 1 82
+byte 1 79
+byte 1 69
+byte 1 86
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $385
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 32
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 32
+byte 1 0
+align 1
+LABELV $379
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $378
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 55
+byte 1 53
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $375
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 53
+byte 1 48
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $372
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 50
+byte 1 53
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $298
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $288
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $287
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $282
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $281
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $280
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 114
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $278
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $276
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 103
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 112
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $274
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 103
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $272
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 103
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $270
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $269
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $267
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 66
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $266
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $264
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 66
+byte 1 97
+byte 1 109
+byte 1 66
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $262
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $261
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $259
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 75
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 68
+byte 1 117
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $258
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 38
+byte 1 32
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $256
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 73
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $255
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 117
+byte 1 114
+byte 1 118
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $253
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $251
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $250
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $248
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 66
+byte 1 117
+byte 1 98
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 46
+byte 1 71
+byte 1 46
+byte 1 0
+align 1
+LABELV $247
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $245
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 109
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $243
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 66
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $242
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $240
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $238
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 87
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 66
+byte 1 111
+byte 1 109
+byte 1 98
+byte 1 0
+align 1
+LABELV $237
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $235
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 80
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $234
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $232
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $230
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 39
+byte 1 80
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 121
+byte 1 39
+byte 1 0
+align 1
+LABELV $229
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $227
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 117
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $216
+byte 1 110
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $213
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $210
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $209
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $208
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 49
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $205
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $199
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $198
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 0
+align 1
+LABELV $197
+byte 1 104
+byte 1 101
+byte 1 0
+align 1
+LABELV $186
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $182
+byte 1 100
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 109
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $181
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $179
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $178
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $175
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $171
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $170
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $167
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $163
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 87
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 111
+byte 1 109
+byte 1 98
+byte 1 0
+align 1
+LABELV $162
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 87
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 111
+byte 1 109
+byte 1 98
+byte 1 0
+align 1
+LABELV $159
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 87
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 111
+byte 1 109
+byte 1 98
+byte 1 0
+align 1
+LABELV $149
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 104
+byte 1 117
+byte 1 103
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 66
+byte 1 97
+byte 1 109
+byte 1 66
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $147
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 114
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $145
+byte 1 115
+byte 1 97
+byte 1 119
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $143
+byte 1 100
+byte 1 111
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 118
+byte 1 97
+byte 1 0
+align 1
+LABELV $141
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $139
+byte 1 115
+byte 1 97
+byte 1 110
+byte 1 107
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 107
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $137
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $135
+byte 1 99
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $133
+byte 1 115
+byte 1 117
+byte 1 105
+byte 1 99
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $127
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $126
+byte 1 110
+byte 1 0
+align 1
+LABELV $119
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 79
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $114
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $113
+byte 1 37
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $112
+byte 1 37
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $109
+byte 1 37
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $106
+byte 1 37
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $103
+byte 1 49
+byte 1 51
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $100
+byte 1 49
+byte 1 50
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $97
+byte 1 49
+byte 1 49
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $94
+byte 1 94
+byte 1 50
+byte 1 51
+byte 1 114
+byte 1 100
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $91
+byte 1 94
+byte 1 49
+byte 1 50
+byte 1 110
+byte 1 100
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $88
+byte 1 94
+byte 1 52
+byte 1 49
+byte 1 115
+byte 1 116
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $85
+byte 1 0
+align 1
+LABELV $84
+byte 1 84
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 0
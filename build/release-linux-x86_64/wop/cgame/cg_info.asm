@@ -0,0 +1,1751 @@
+export CG_LoadingString
+code
+proc CG_LoadingString 0 12
+ADDRGP4 cg+111052
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 trap_UpdateScreen
+CALLV
+pop
+LABELV $80
+endproc CG_LoadingString 0 12
+export CG_ChangeLoadingProgress
+proc CG_ChangeLoadingProgress 0 0
+ADDRGP4 cg+112076
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 trap_UpdateScreen
+CALLV
+pop
+LABELV $83
+endproc CG_ChangeLoadingProgress 0 0
+export CG_LoadingItem
+proc CG_LoadingItem 16 4
+ADDRLP4 0
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $86
+ADDRGP4 loadingItemIconCount
+INDIRI4
+CNSTI4 26
+GEI4 $86
+ADDRLP4 8
+ADDRGP4 loadingItemIconCount
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 loadingItemIcons
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $86
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+LABELV $85
+endproc CG_LoadingItem 16 4
+export CG_LoadingClient
+proc CG_LoadingClient 220 20
+ADDRFP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 200
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 200
+INDIRP4
+ASGNP4
+ADDRGP4 loadingPlayerIconCount
+INDIRI4
+CNSTI4 16
+GEI4 $89
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRGP4 $91
+ARGP4
+ADDRLP4 204
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 72
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 208
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 68
+ADDRLP4 208
+INDIRP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $92
+ADDRLP4 212
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 68
+ADDRLP4 212
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 212
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $93
+JUMPV
+LABELV $92
+ADDRLP4 68
+ADDRGP4 $94
+ASGNP4
+LABELV $93
+ADDRLP4 136
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $95
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 136
+ARGP4
+ADDRLP4 212
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 loadingPlayerIconCount
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 loadingPlayerIcons
+ADDP4
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRGP4 loadingPlayerIconCount
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 loadingPlayerIcons
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $96
+ADDRLP4 136
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $98
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 136
+ARGP4
+ADDRLP4 216
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 loadingPlayerIconCount
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 loadingPlayerIcons
+ADDP4
+ADDRLP4 216
+INDIRI4
+ASGNI4
+LABELV $96
+ADDRGP4 loadingPlayerIconCount
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 loadingPlayerIcons
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $99
+ADDRLP4 136
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $95
+ARGP4
+ADDRGP4 $101
+ARGP4
+ADDRGP4 $94
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 136
+ARGP4
+ADDRLP4 216
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 loadingPlayerIconCount
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 loadingPlayerIcons
+ADDP4
+ADDRLP4 216
+INDIRI4
+ASGNI4
+LABELV $99
+ADDRGP4 loadingPlayerIconCount
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 loadingPlayerIcons
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $102
+ADDRLP4 216
+ADDRGP4 loadingPlayerIconCount
+ASGNP4
+ADDRLP4 216
+INDIRP4
+ADDRLP4 216
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $102
+LABELV $89
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRGP4 $104
+ARGP4
+ADDRLP4 204
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+LABELV $88
+endproc CG_LoadingClient 220 20
+export CG_DrawInformation
+proc CG_DrawInformation 128 36
+ADDRLP4 52
+CNSTI4 167
+ASGNI4
+ADDRLP4 56
+CNSTI4 125
+ASGNI4
+ADDRLP4 60
+CNSTI4 690
+ASGNI4
+ADDRLP4 64
+CNSTI4 517
+ASGNI4
+ADDRLP4 24
+CNSTF4 1068149419
+ASGNF4
+CNSTI4 0
+ARGI4
+ADDRLP4 72
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 72
+INDIRP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $106
+ARGP4
+ADDRLP4 76
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 80
+CNSTF4 0
+ASGNF4
+ADDRLP4 80
+INDIRF4
+ARGF4
+ADDRLP4 80
+INDIRF4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+CNSTF4 1139802112
+ARGF4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $107
+ARGP4
+ADDRLP4 84
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRGP4 $108
+ARGP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $109
+ADDRGP4 $111
+ARGP4
+ADDRLP4 96
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+LABELV $109
+ADDRLP4 96
+ADDRGP4 cgs+31464
+INDIRI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+LTI4 $112
+ADDRLP4 96
+INDIRI4
+CNSTI4 8
+GTI4 $112
+ADDRLP4 96
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $130
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $130
+address $120
+address $112
+address $112
+address $124
+address $122
+address $128
+address $118
+address $126
+address $116
+code
+LABELV $116
+ADDRLP4 0
+ADDRGP4 $117
+ASGNP4
+ADDRGP4 $113
+JUMPV
+LABELV $118
+ADDRLP4 0
+ADDRGP4 $119
+ASGNP4
+ADDRGP4 $113
+JUMPV
+LABELV $120
+ADDRLP4 0
+ADDRGP4 $121
+ASGNP4
+ADDRGP4 $113
+JUMPV
+LABELV $122
+ADDRLP4 0
+ADDRGP4 $123
+ASGNP4
+ADDRGP4 $113
+JUMPV
+LABELV $124
+ADDRLP4 0
+ADDRGP4 $125
+ASGNP4
+ADDRGP4 $113
+JUMPV
+LABELV $126
+ADDRLP4 0
+ADDRGP4 $127
+ASGNP4
+ADDRGP4 $113
+JUMPV
+LABELV $128
+ADDRLP4 0
+ADDRGP4 $129
+ASGNP4
+ADDRGP4 $113
+JUMPV
+LABELV $112
+ADDRLP4 0
+ADDRGP4 $121
+ASGNP4
+LABELV $113
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 108
+CNSTI4 512
+ASGNI4
+ADDRLP4 68
+ADDRLP4 108
+INDIRI4
+ADDRLP4 52
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDRGP4 cgs+20100+11312
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 108
+INDIRI4
+ADDRLP4 68
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 60
+INDIRI4
+CVIF4 4
+ADDRLP4 24
+INDIRF4
+ADDRGP4 cgs+20100+11312
+INDIRF4
+DIVF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 32
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 36
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic1024
+CALLV
+pop
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 32
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 36
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic1024
+CALLV
+pop
+ADDRLP4 8
+CNSTF4 1133314048
+ASGNF4
+ADDRLP4 12
+CNSTF4 1143521280
+ASGNF4
+ADDRLP4 16
+CNSTF4 1139146752
+ADDRGP4 cg+112076
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 8
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 CG_AdjustFrom1024
+CALLV
+pop
+ADDRGP4 $137
+ARGP4
+ADDRLP4 116
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 120
+CNSTF4 0
+ASGNF4
+ADDRLP4 120
+INDIRF4
+ARGF4
+ADDRLP4 120
+INDIRF4
+ARGF4
+ADDRGP4 cg+112076
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRGP4 $138
+ARGP4
+ADDRLP4 124
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+CNSTF4 1133314048
+ARGF4
+CNSTF4 1143521280
+ARGF4
+CNSTF4 1139146752
+ARGF4
+CNSTF4 1111490560
+ARGF4
+ADDRLP4 124
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic1024
+CALLV
+pop
+LABELV $105
+endproc CG_DrawInformation 128 36
+bss
+align 4
+LABELV loadingItemIcons
+skip 104
+align 4
+LABELV loadingPlayerIcons
+skip 64
+align 4
+LABELV loadingItemIconCount
+skip 4
+align 4
+LABELV loadingPlayerIconCount
+skip 4
+import CG_AddBoundingBox
+import CG_AddBoundingBoxEntity
+import CG_QueryCvar
+import CG_Timestamp
+import CG_LimitCvars
+import trap_RealTime
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import trap_R_inPVS
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_Cutscene2d_Draw
+import CG_Cutscene2d_UpdateTrans
+import CG_Cutscene2d_CheckCmd
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import Main_SpriteParticles
+import LaunchRevivalParticle
+import LaunchSpeedyPuffTrail
+import Init_SpriteParticles
+import AddLFsToScreen
+import AddLFToDrawList
+import Init_LensFlareSys
+import DumpPolyInfo
+import ActiveChooseLogoMenu
+import FindLogoForSpraying
+import Add_LogoToDrawList
+import AddLogosToScene
+import Init_SprayLogoSys
+import Calculate_2DOfDIR
+import Calculate_2DOf3D
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_ScorePlum
+import CG_TeleOutEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_GenerateParticles
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_PortalInView
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_GetWaterMuzzle
+import CG_SprayTrail
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponSRWC
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_Boomies_Explosion
+import CG_BamBam_Explosion
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_LerpTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayer
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_UpdateVoipTeamIDs
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Draw3DModel
+import CG_SetPrintString
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import CG_MessagePrint
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_WorldToScreen
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_DrawPic1024
+import CG_DrawRect1024
+import CG_FillRect1024
+import CG_AdjustFrom1024
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddPolyBatched
+import CG_AddRefEntityBatched
+import CG_FlushSceneBatches
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_ForceModelChange
+import CG_GetCvarFloat
+import CG_GetCvarInt
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StreamAssets
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_icons
+import cg_ambient
+import cg_drawBBox
+import cg_drawVoiceNames
+import cg_drawLensflare
+import cg_timestamps
+import cg_skyLensflare
+import cg_sky
+import cg_curWarmupReady
+import cg_warmupReady
+import cg_glowModelTeam
+import cg_glowModel
+import cg_cineDrawLetterBox
+import cg_cineHideHud
+import cg_LPSwallhackAlpha
+import cg_LPSwallhackSize
+import cg_bigScoreType
+import cg_thirdPersonAutoSwitch
+import cg_drawTimeLeft
+import cg_drawServerInfos
+import cg_drawMessages
+import cg_drawups
+import cg_wopFFAhud
+import cg_printDir
+import cg_drawRealTime
+import cg_correctedWeaponPos
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_streamAssets
+import cg_deferPlayers
+import cg_predictItems
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_chatBeep
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_optimizePrediction
+import cg_nopredict
+import cg_errorDecay
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import trailEnt
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $138
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 47
+byte 1 108
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $137
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 47
+byte 1 108
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $129
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 0
+align 1
+LABELV $127
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 121
+byte 1 99
+byte 1 0
+align 1
+LABELV $125
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 95
+byte 1 115
+byte 1 121
+byte 1 99
+byte 1 0
+align 1
+LABELV $123
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 95
+byte 1 108
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $121
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 95
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 0
+align 1
+LABELV $119
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 108
+byte 1 0
+align 1
+LABELV $117
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 95
+byte 1 98
+byte 1 98
+byte 1 0
+align 1
+LABELV $111
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $108
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $107
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $106
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $104
+byte 1 110
+byte 1 0
+align 1
+LABELV $101
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $98
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $94
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $91
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
@@ -0,0 +1,6422 @@
+code
+proc StrEndWork 124 12
+ADDRGP4 tmpstrl
+INDIRI4
+CNSTI4 0
+NEI4 $84
+ADDRGP4 next_tmpstr
+CNSTI4 0
+ASGNI4
+ADDRGP4 $83
+JUMPV
+LABELV $84
+ADDRLP4 0
+ADDRGP4 parserlvl
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $89
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $90
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+EQI4 $101
+ADDRGP4 $86
+JUMPV
+LABELV $89
+ADDRGP4 nextscript
+ARGP4
+ADDRGP4 tmpString
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $87
+JUMPV
+LABELV $90
+ADDRLP4 8
+ADDRGP4 next_tmpstr
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $94
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+EQI4 $98
+ADDRGP4 $87
+JUMPV
+LABELV $94
+ADDRGP4 tmpString
+ARGP4
+ADDRGP4 $97
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $87
+ADDRGP4 next_tmpstr
+CNSTI4 1
+ASGNI4
+ADDRGP4 $87
+JUMPV
+LABELV $98
+ADDRGP4 tmpString
+ARGP4
+ADDRLP4 20
+ADDRGP4 atof
+CALLF4
+ASGNF4
+CNSTI4 140
+ADDRGP4 numlfs
+INDIRI4
+MULI4
+ADDRGP4 lfmem-140+128
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRGP4 next_tmpstr
+CNSTI4 0
+ASGNI4
+ADDRGP4 $87
+JUMPV
+LABELV $101
+ADDRLP4 16
+ADDRGP4 next_tmpstr
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $87
+ADDRLP4 16
+INDIRI4
+CNSTI4 15
+GTI4 $87
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $202
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $202
+address $105
+address $87
+address $124
+address $127
+address $130
+address $133
+address $136
+address $139
+address $142
+address $145
+address $166
+address $169
+address $177
+address $180
+address $183
+address $186
+code
+LABELV $105
+ADDRGP4 tmpString
+ARGP4
+ADDRGP4 $108
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $106
+ADDRGP4 next_tmpstr
+CNSTI4 2
+ASGNI4
+ADDRGP4 $87
+JUMPV
+LABELV $106
+ADDRGP4 tmpString
+ARGP4
+ADDRGP4 $111
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $109
+ADDRGP4 next_tmpstr
+CNSTI4 3
+ASGNI4
+ADDRGP4 $87
+JUMPV
+LABELV $109
+ADDRGP4 tmpString
+ARGP4
+ADDRGP4 $114
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $112
+ADDRGP4 next_tmpstr
+CNSTI4 4
+ASGNI4
+ADDRGP4 $87
+JUMPV
+LABELV $112
+ADDRGP4 tmpString
+ARGP4
+ADDRGP4 $117
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $115
+ADDRGP4 next_tmpstr
+CNSTI4 5
+ASGNI4
+ADDRGP4 $87
+JUMPV
+LABELV $115
+ADDRGP4 tmpString
+ARGP4
+ADDRGP4 $120
+ARGP4
+ADDRLP4 40
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $118
+ADDRGP4 next_tmpstr
+CNSTI4 9
+ASGNI4
+ADDRGP4 $87
+JUMPV
+LABELV $118
+ADDRGP4 tmpString
+ARGP4
+ADDRGP4 $123
+ARGP4
+ADDRLP4 44
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $87
+ADDRGP4 next_tmpstr
+CNSTI4 11
+ASGNI4
+ADDRGP4 $87
+JUMPV
+LABELV $124
+ADDRGP4 tmpString
+ARGP4
+ADDRLP4 48
+ADDRGP4 atof
+CALLF4
+ASGNF4
+CNSTI4 140
+ADDRGP4 numlfs
+INDIRI4
+MULI4
+ADDRGP4 lfmem-140+136
+ADDP4
+INDIRP4
+CNSTI4 164
+ADDP4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRGP4 next_tmpstr
+CNSTI4 0
+ASGNI4
+ADDRGP4 $87
+JUMPV
+LABELV $127
+ADDRGP4 tmpString
+ARGP4
+ADDRLP4 52
+ADDRGP4 atof
+CALLF4
+ASGNF4
+CNSTI4 140
+ADDRGP4 numlfs
+INDIRI4
+MULI4
+ADDRGP4 lfmem-140+136
+ADDP4
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRGP4 next_tmpstr
+CNSTI4 0
+ASGNI4
+ADDRGP4 $87
+JUMPV
+LABELV $130
+CNSTI4 140
+ADDRGP4 numlfs
+INDIRI4
+MULI4
+ADDRGP4 lfmem-140+136
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 tmpString
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 next_tmpstr
+CNSTI4 0
+ASGNI4
+ADDRGP4 $87
+JUMPV
+LABELV $133
+ADDRGP4 tmpString
+ARGP4
+ADDRLP4 56
+ADDRGP4 atof
+CALLF4
+ASGNF4
+CNSTI4 140
+ADDRGP4 numlfs
+INDIRI4
+MULI4
+ADDRGP4 lfmem-140+136
+ADDP4
+INDIRP4
+CNSTI4 148
+ADDP4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRGP4 next_tmpstr
+CNSTI4 6
+ASGNI4
+ADDRGP4 $87
+JUMPV
+LABELV $136
+ADDRGP4 tmpString
+ARGP4
+ADDRLP4 60
+ADDRGP4 atof
+CALLF4
+ASGNF4
+CNSTI4 140
+ADDRGP4 numlfs
+INDIRI4
+MULI4
+ADDRGP4 lfmem-140+136
+ADDP4
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRGP4 next_tmpstr
+CNSTI4 7
+ASGNI4
+ADDRGP4 $87
+JUMPV
+LABELV $139
+ADDRGP4 tmpString
+ARGP4
+ADDRLP4 64
+ADDRGP4 atof
+CALLF4
+ASGNF4
+CNSTI4 140
+ADDRGP4 numlfs
+INDIRI4
+MULI4
+ADDRGP4 lfmem-140+136
+ADDP4
+INDIRP4
+CNSTI4 156
+ADDP4
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRGP4 next_tmpstr
+CNSTI4 8
+ASGNI4
+ADDRGP4 $87
+JUMPV
+LABELV $142
+ADDRGP4 tmpString
+ARGP4
+ADDRLP4 68
+ADDRGP4 atof
+CALLF4
+ASGNF4
+CNSTI4 140
+ADDRGP4 numlfs
+INDIRI4
+MULI4
+ADDRGP4 lfmem-140+136
+ADDP4
+INDIRP4
+CNSTI4 160
+ADDP4
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRGP4 next_tmpstr
+CNSTI4 0
+ASGNI4
+ADDRGP4 $87
+JUMPV
+LABELV $145
+ADDRGP4 tmpString
+ARGP4
+ADDRGP4 $148
+ARGP4
+ADDRLP4 72
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $146
+CNSTI4 140
+ADDRGP4 numlfs
+INDIRI4
+MULI4
+ADDRGP4 lfmem-140+136
+ADDP4
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 next_tmpstr
+CNSTI4 10
+ASGNI4
+ADDRGP4 $87
+JUMPV
+LABELV $146
+ADDRGP4 tmpString
+ARGP4
+ADDRGP4 $153
+ARGP4
+ADDRLP4 76
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+NEI4 $151
+CNSTI4 140
+ADDRGP4 numlfs
+INDIRI4
+MULI4
+ADDRGP4 lfmem-140+136
+ADDP4
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 next_tmpstr
+CNSTI4 10
+ASGNI4
+ADDRGP4 $87
+JUMPV
+LABELV $151
+ADDRGP4 tmpString
+ARGP4
+ADDRGP4 $158
+ARGP4
+ADDRLP4 80
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+NEI4 $156
+CNSTI4 140
+ADDRGP4 numlfs
+INDIRI4
+MULI4
+ADDRGP4 lfmem-140+136
+ADDP4
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 next_tmpstr
+CNSTI4 10
+ASGNI4
+ADDRGP4 $87
+JUMPV
+LABELV $156
+ADDRGP4 tmpString
+ARGP4
+ADDRGP4 $163
+ARGP4
+ADDRLP4 84
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+NEI4 $161
+CNSTI4 140
+ADDRGP4 numlfs
+INDIRI4
+MULI4
+ADDRGP4 lfmem-140+136
+ADDP4
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRGP4 next_tmpstr
+CNSTI4 15
+ASGNI4
+ADDRGP4 $87
+JUMPV
+LABELV $161
+ADDRGP4 next_tmpstr
+CNSTI4 0
+ASGNI4
+ADDRGP4 $87
+JUMPV
+LABELV $166
+ADDRGP4 tmpString
+ARGP4
+ADDRLP4 88
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 92
+CNSTI4 140
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ADDRGP4 numlfs
+INDIRI4
+MULI4
+ADDRGP4 lfmem-140+136
+ADDP4
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRGP4 next_tmpstr
+CNSTI4 0
+ASGNI4
+ADDRGP4 $87
+JUMPV
+LABELV $169
+ADDRGP4 tmpString
+ARGP4
+ADDRGP4 $172
+ARGP4
+ADDRLP4 96
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+NEI4 $170
+CNSTI4 140
+ADDRGP4 numlfs
+INDIRI4
+MULI4
+ADDRGP4 lfmem-140+136
+ADDP4
+INDIRP4
+CNSTI4 172
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 next_tmpstr
+CNSTI4 0
+ASGNI4
+ADDRGP4 $87
+JUMPV
+LABELV $170
+ADDRGP4 tmpString
+ARGP4
+ADDRLP4 100
+ADDRGP4 atof
+CALLF4
+ASGNF4
+CNSTI4 140
+ADDRGP4 numlfs
+INDIRI4
+MULI4
+ADDRGP4 lfmem-140+136
+ADDP4
+INDIRP4
+CNSTI4 168
+ADDP4
+ADDRLP4 100
+INDIRF4
+ASGNF4
+ADDRGP4 next_tmpstr
+CNSTI4 12
+ASGNI4
+ADDRGP4 $87
+JUMPV
+LABELV $177
+ADDRGP4 tmpString
+ARGP4
+ADDRLP4 100
+ADDRGP4 atof
+CALLF4
+ASGNF4
+CNSTI4 140
+ADDRGP4 numlfs
+INDIRI4
+MULI4
+ADDRGP4 lfmem-140+136
+ADDP4
+INDIRP4
+CNSTI4 172
+ADDP4
+ADDRLP4 100
+INDIRF4
+ASGNF4
+ADDRGP4 next_tmpstr
+CNSTI4 13
+ASGNI4
+ADDRGP4 $87
+JUMPV
+LABELV $180
+ADDRGP4 tmpString
+ARGP4
+ADDRLP4 104
+ADDRGP4 atof
+CALLF4
+ASGNF4
+CNSTI4 140
+ADDRGP4 numlfs
+INDIRI4
+MULI4
+ADDRGP4 lfmem-140+136
+ADDP4
+INDIRP4
+CNSTI4 176
+ADDP4
+ADDRLP4 104
+INDIRF4
+ASGNF4
+ADDRGP4 next_tmpstr
+CNSTI4 14
+ASGNI4
+ADDRGP4 $87
+JUMPV
+LABELV $183
+ADDRGP4 tmpString
+ARGP4
+ADDRLP4 108
+ADDRGP4 atof
+CALLF4
+ASGNF4
+CNSTI4 140
+ADDRGP4 numlfs
+INDIRI4
+MULI4
+ADDRGP4 lfmem-140+136
+ADDP4
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRGP4 next_tmpstr
+CNSTI4 0
+ASGNI4
+ADDRGP4 $87
+JUMPV
+LABELV $186
+ADDRLP4 112
+CNSTI4 0
+ASGNI4
+LABELV $187
+CNSTI4 140
+ADDRLP4 112
+INDIRI4
+MULI4
+ADDRGP4 lfmem
+ADDP4
+ARGP4
+ADDRGP4 tmpString
+ARGP4
+ADDRLP4 116
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 0
+NEI4 $191
+ADDRLP4 120
+CNSTI4 140
+ASGNI4
+ADDRLP4 120
+INDIRI4
+ADDRGP4 numlfs
+INDIRI4
+MULI4
+ADDRGP4 lfmem-140+136
+ADDP4
+INDIRP4
+ADDRLP4 120
+INDIRI4
+ADDP4
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRGP4 $189
+JUMPV
+LABELV $191
+LABELV $188
+ADDRLP4 112
+ADDRLP4 112
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 32
+LTI4 $187
+LABELV $189
+ADDRLP4 116
+CNSTI4 140
+ASGNI4
+ADDRLP4 116
+INDIRI4
+ADDRGP4 numlfs
+INDIRI4
+MULI4
+ADDRGP4 lfmem-140+136
+ADDP4
+INDIRP4
+ADDRLP4 116
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $195
+ADDRGP4 tmpString
+ARGP4
+ADDRGP4 $199
+ARGP4
+ADDRLP4 120
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+EQI4 $195
+ADDRGP4 $200
+ARGP4
+ADDRGP4 tmpString
+ARGP4
+CNSTI4 140
+ADDRGP4 numlfs
+INDIRI4
+MULI4
+ADDRGP4 lfmem-140
+ADDP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $195
+ADDRGP4 next_tmpstr
+CNSTI4 0
+ASGNI4
+ADDRGP4 $87
+JUMPV
+LABELV $86
+ADDRGP4 $203
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $87
+ADDRGP4 tmpstrl
+CNSTI4 0
+ASGNI4
+ADDRGP4 tmpString
+CNSTI1 0
+ASGNI1
+LABELV $83
+endproc StrEndWork 124 12
+export LF_Parser
+proc LF_Parser 8240 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 8192
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $205
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8204
+INDIRP4
+ARGP4
+ADDRLP4 8200
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 8192
+ARGI4
+ADDRLP4 8200
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 8200
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 $206
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 8208
+CNSTI4 0
+ASGNI4
+ADDRGP4 next_tmpstr
+ADDRLP4 8208
+INDIRI4
+ASGNI4
+ADDRLP4 8196
+ADDRLP4 8208
+INDIRI4
+ASGNI4
+ADDRGP4 parserlvl
+ADDRLP4 8208
+INDIRI4
+ASGNI4
+ADDRGP4 tmpstrl
+ADDRLP4 8208
+INDIRI4
+ASGNI4
+ADDRGP4 tmpString
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+ADDRLP4 8208
+INDIRI4
+ASGNI4
+LABELV $207
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $211
+ADDRGP4 $209
+JUMPV
+LABELV $211
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $213
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4+1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $215
+ADDRLP4 8196
+INDIRI4
+CNSTI4 0
+EQI4 $223
+ADDRGP4 StrEndWork
+CALLV
+pop
+ADDRLP4 8196
+CNSTI4 0
+ASGNI4
+ADDRGP4 $223
+JUMPV
+LABELV $220
+LABELV $221
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $223
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+NEI4 $220
+ADDRGP4 $208
+JUMPV
+LABELV $215
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4+1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $224
+ADDRLP4 8196
+INDIRI4
+CNSTI4 0
+EQI4 $232
+ADDRGP4 StrEndWork
+CALLV
+pop
+ADDRLP4 8196
+CNSTI4 0
+ASGNI4
+ADDRGP4 $232
+JUMPV
+LABELV $229
+LABELV $230
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $232
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+EQI4 $234
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4+1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $229
+LABELV $234
+ADDRGP4 $208
+JUMPV
+LABELV $224
+LABELV $213
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+GTI4 $235
+ADDRLP4 8196
+INDIRI4
+CNSTI4 0
+EQI4 $237
+ADDRGP4 StrEndWork
+CALLV
+pop
+ADDRLP4 8196
+CNSTI4 0
+ASGNI4
+LABELV $237
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $208
+ADDRGP4 $209
+JUMPV
+LABELV $235
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $241
+ADDRLP4 8196
+INDIRI4
+CNSTI4 0
+EQI4 $243
+ADDRGP4 StrEndWork
+CALLV
+pop
+ADDRLP4 8196
+CNSTI4 0
+ASGNI4
+LABELV $243
+ADDRLP4 8220
+ADDRGP4 parserlvl
+ASGNP4
+ADDRLP4 8220
+INDIRP4
+ADDRLP4 8220
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8216
+ADDRLP4 8220
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8216
+INDIRI4
+CNSTI4 1
+EQI4 $248
+ADDRLP4 8216
+INDIRI4
+CNSTI4 2
+EQI4 $253
+ADDRGP4 $242
+JUMPV
+LABELV $248
+ADDRGP4 numlfs
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 32
+LTI4 $249
+ADDRGP4 $251
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $204
+JUMPV
+LABELV $249
+CNSTI4 140
+ADDRGP4 numlfs
+INDIRI4
+MULI4
+ADDRGP4 lfmem
+ADDP4
+ARGP4
+ADDRGP4 nextscript
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+CNSTI4 140
+ADDRGP4 numlfs
+INDIRI4
+MULI4
+ADDRGP4 lfmem+128
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 8228
+ADDRGP4 numlfs
+ASGNP4
+ADDRLP4 8228
+INDIRP4
+ADDRLP4 8228
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $242
+JUMPV
+LABELV $253
+ADDRGP4 freeflares
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $254
+ADDRGP4 $256
+ARGP4
+CNSTI4 140
+ADDRGP4 numlfs
+INDIRI4
+MULI4
+ADDRGP4 lfmem-140
+ADDP4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $204
+JUMPV
+LABELV $254
+ADDRLP4 8232
+ADDRGP4 freeflares
+ASGNP4
+ADDRLP4 8212
+ADDRLP4 8232
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 8236
+ADDRLP4 8212
+INDIRP4
+ASGNP4
+ADDRLP4 8232
+INDIRP4
+ADDRLP4 8236
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 8236
+INDIRP4
+CNSTI4 140
+ADDRGP4 numlfs
+INDIRI4
+MULI4
+ADDRGP4 lfmem-140+136
+ADDP4
+INDIRP4
+ASGNP4
+CNSTI4 140
+ADDRGP4 numlfs
+INDIRI4
+MULI4
+ADDRGP4 lfmem-140+136
+ADDP4
+ADDRLP4 8212
+INDIRP4
+ASGNP4
+ADDRGP4 $242
+JUMPV
+LABELV $241
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $262
+ADDRLP4 8196
+INDIRI4
+CNSTI4 0
+EQI4 $264
+ADDRGP4 StrEndWork
+CALLV
+pop
+ADDRLP4 8196
+CNSTI4 0
+ASGNI4
+LABELV $264
+ADDRLP4 8212
+ADDRGP4 parserlvl
+ASGNP4
+ADDRLP4 8212
+INDIRP4
+ADDRLP4 8212
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $263
+JUMPV
+LABELV $262
+ADDRLP4 8196
+INDIRI4
+CNSTI4 0
+NEI4 $266
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 34
+NEI4 $266
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $271
+JUMPV
+LABELV $268
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $272
+ADDRGP4 $270
+JUMPV
+LABELV $272
+ADDRGP4 tmpstrl
+INDIRI4
+CNSTI4 126
+GEI4 $274
+ADDRGP4 tmpstrl
+INDIRI4
+ADDRGP4 tmpString
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 8212
+ADDRGP4 tmpstrl
+ASGNP4
+ADDRLP4 8216
+ADDRLP4 8212
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8212
+INDIRP4
+ADDRLP4 8216
+INDIRI4
+ASGNI4
+ADDRLP4 8216
+INDIRI4
+ADDRGP4 tmpString
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $275
+JUMPV
+LABELV $274
+ADDRGP4 $276
+ARGP4
+CNSTI4 126
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $275
+LABELV $269
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $271
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 34
+NEI4 $268
+LABELV $270
+ADDRGP4 StrEndWork
+CALLV
+pop
+ADDRGP4 $267
+JUMPV
+LABELV $266
+ADDRLP4 8196
+CNSTI4 1
+ASGNI4
+ADDRGP4 tmpstrl
+INDIRI4
+CNSTI4 126
+GEI4 $277
+ADDRGP4 tmpstrl
+INDIRI4
+ADDRGP4 tmpString
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 8212
+ADDRGP4 tmpstrl
+ASGNP4
+ADDRLP4 8216
+ADDRLP4 8212
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8212
+INDIRP4
+ADDRLP4 8216
+INDIRI4
+ASGNI4
+ADDRLP4 8216
+INDIRI4
+ADDRGP4 tmpString
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $278
+JUMPV
+LABELV $277
+ADDRGP4 $276
+ARGP4
+CNSTI4 126
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $278
+LABELV $267
+LABELV $263
+LABELV $242
+LABELV $208
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8192
+LTI4 $207
+LABELV $209
+ADDRGP4 $279
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $204
+endproc LF_Parser 8240 12
+export Load_LFfiles
+proc Load_LFfiles 1204 12
+ADDRGP4 $281
+ARGP4
+ADDRLP4 172
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 172
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $282
+ADDRLP4 4
+ADDRLP4 172
+ASGNP4
+ADDRLP4 168
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $284
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 92
+ARGI4
+ADDRLP4 1196
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 164
+ADDRLP4 1196
+INDIRP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $288
+ADDRGP4 $283
+JUMPV
+LABELV $288
+ADDRLP4 164
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 1200
+CNSTI4 1
+ASGNI4
+ADDRLP4 168
+ADDRLP4 168
+INDIRI4
+ADDRLP4 1200
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 164
+INDIRP4
+ADDRLP4 1200
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $285
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 40
+LTI4 $284
+ADDRGP4 $283
+JUMPV
+LABELV $282
+ADDRLP4 168
+CNSTI4 0
+ASGNI4
+LABELV $283
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $294
+JUMPV
+LABELV $291
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 LF_Parser
+CALLV
+pop
+LABELV $292
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $294
+ADDRLP4 0
+INDIRI4
+ADDRLP4 168
+INDIRI4
+LTI4 $291
+LABELV $280
+endproc Load_LFfiles 1204 12
+export Init_LensFlareSys
+proc Init_LensFlareSys 264 20
+ADDRGP4 flaremem
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 23552
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 lfmem
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 4480
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $296
+ADDRLP4 260
+CNSTI4 184
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+ADDRGP4 flaremem
+ADDP4
+ADDRLP4 260
+INDIRI4
+ADDRGP4 flaremem-184
+ADDP4
+ASGNP4
+LABELV $297
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 128
+LTI4 $296
+ADDRGP4 freeflares
+ADDRGP4 flaremem+23368
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 cg_skyLensflare+16
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $303
+ADDRLP4 4
+ARGP4
+ADDRGP4 $305
+ARGP4
+ADDRGP4 cg+107928
+ARGP4
+ADDRGP4 cg+107928+4
+ARGP4
+ADDRGP4 cg+107928+8
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 62
+ARGI4
+ADDRLP4 260
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRGP4 cg+107800
+ARGP4
+ADDRLP4 260
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $304
+JUMPV
+LABELV $303
+ADDRGP4 cg+107800
+CNSTI1 0
+ASGNI1
+LABELV $304
+ADDRGP4 lfmem
+ARGP4
+ADDRGP4 $199
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 lfmem+136
+ADDRGP4 freeflares
+INDIRP4
+ASGNP4
+ADDRGP4 freeflares
+ADDRGP4 lfmem+136
+INDIRP4
+INDIRP4
+INDIRP4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRGP4 lfmem+136
+INDIRP4
+INDIRP4
+INDIRP4
+INDIRP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 lfmem+136
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTF4 1084227584
+ASGNF4
+ADDRGP4 lfmem+136
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 lfmem+136
+INDIRP4
+CNSTI4 152
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 lfmem+136
+INDIRP4
+CNSTI4 156
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 lfmem+136
+INDIRP4
+CNSTI4 160
+ADDP4
+CNSTF4 1061997773
+ASGNF4
+ADDRGP4 lfmem+136
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRGP4 cgs+160652+8
+INDIRI4
+ASGNI4
+ADDRGP4 lfmem+136
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTF4 1045220557
+ASGNF4
+ADDRGP4 lfmem+136
+INDIRP4
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTF4 1092616192
+ASGNF4
+ADDRGP4 lfmem+136
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 lfmem+136
+INDIRP4
+INDIRP4
+CNSTI4 152
+ADDP4
+CNSTF4 1051260355
+ASGNF4
+ADDRGP4 lfmem+136
+INDIRP4
+INDIRP4
+CNSTI4 156
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 lfmem+136
+INDIRP4
+INDIRP4
+CNSTI4 160
+ADDP4
+CNSTF4 1051260355
+ASGNF4
+ADDRGP4 lfmem+136
+INDIRP4
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRGP4 cgs+160652+8
+INDIRI4
+ASGNI4
+ADDRGP4 lfmem+136
+INDIRP4
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTF4 3197737370
+ASGNF4
+ADDRGP4 lfmem+136
+INDIRP4
+INDIRP4
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTF4 1082130432
+ASGNF4
+ADDRGP4 lfmem+136
+INDIRP4
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 lfmem+136
+INDIRP4
+INDIRP4
+INDIRP4
+CNSTI4 152
+ADDP4
+CNSTF4 1051260355
+ASGNF4
+ADDRGP4 lfmem+136
+INDIRP4
+INDIRP4
+INDIRP4
+CNSTI4 156
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 lfmem+136
+INDIRP4
+INDIRP4
+INDIRP4
+CNSTI4 160
+ADDP4
+CNSTF4 1059648963
+ASGNF4
+ADDRGP4 lfmem+136
+INDIRP4
+INDIRP4
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRGP4 cgs+160652+8
+INDIRI4
+ASGNI4
+ADDRGP4 lfmem+136
+INDIRP4
+INDIRP4
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 lfmem+136
+INDIRP4
+INDIRP4
+INDIRP4
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTF4 1097859072
+ASGNF4
+ADDRGP4 lfmem+136
+INDIRP4
+INDIRP4
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+ADDRGP4 lfmem+136
+INDIRP4
+INDIRP4
+INDIRP4
+INDIRP4
+CNSTI4 152
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 lfmem+136
+INDIRP4
+INDIRP4
+INDIRP4
+INDIRP4
+CNSTI4 156
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 lfmem+136
+INDIRP4
+INDIRP4
+INDIRP4
+INDIRP4
+CNSTI4 160
+ADDP4
+CNSTF4 1051260355
+ASGNF4
+ADDRGP4 lfmem+136
+INDIRP4
+INDIRP4
+INDIRP4
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRGP4 cgs+160652+8
+INDIRI4
+ASGNI4
+ADDRGP4 lfmem+136
+INDIRP4
+INDIRP4
+INDIRP4
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTF4 1073741824
+ASGNF4
+ADDRGP4 lfmem+132
+CNSTI4 1
+ASGNI4
+ADDRGP4 numlfs
+CNSTI4 1
+ASGNI4
+ADDRGP4 Load_LFfiles
+CALLV
+pop
+LABELV $295
+endproc Init_LensFlareSys 264 20
+export AddLFToDrawList
+proc AddLFToDrawList 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 IFDA_firstempty
+INDIRI4
+CNSTI4 16
+NEI4 $354
+ADDRGP4 $353
+JUMPV
+LABELV $354
+ADDRGP4 IFDA_firstempty
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 IFD_Array+16
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRGP4 IFDA_firstempty
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 IFD_Array+16+4
+ADDP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 IFDA_firstempty
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 IFD_Array+16+8
+ADDP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 IFDA_firstempty
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 IFD_Array+4
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRGP4 IFDA_firstempty
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 IFD_Array+4+4
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 IFDA_firstempty
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 IFD_Array+4+8
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $366
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 lfmem
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $370
+ADDRGP4 IFDA_firstempty
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 IFD_Array
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $368
+JUMPV
+LABELV $370
+LABELV $367
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $366
+LABELV $368
+ADDRLP4 4
+ADDRGP4 IFDA_firstempty
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $353
+endproc AddLFToDrawList 8 8
+proc LF_Visible 128 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 lfVisCache
+ASGNP4
+ADDRGP4 $377
+JUMPV
+LABELV $374
+ADDRLP4 92
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 92
+INDIRI4
+LTI4 $378
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 92
+INDIRI4
+SUBI4
+CNSTI4 50
+GEI4 $378
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+EQI4 $378
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+EQI4 $378
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 0
+EQI4 $378
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $373
+JUMPV
+LABELV $378
+LABELV $375
+ADDRLP4 72
+ADDRLP4 72
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+LABELV $377
+ADDRLP4 72
+INDIRI4
+CNSTI4 16
+LTI4 $374
+ADDRLP4 88
+ADDRGP4 lfVisCacheNext
+ASGNP4
+ADDRLP4 92
+ADDRLP4 88
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 44
+ADDRLP4 92
+INDIRI4
+MULI4
+ADDRGP4 lfVisCache
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 16
+MODI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1242325376
+EQF4 $383
+ADDRLP4 4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 96
+CNSTP4 0
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $388
+ADDRLP4 100
+CNSTI4 1
+ASGNI4
+ADDRGP4 $389
+JUMPV
+LABELV $388
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+LABELV $389
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $373
+JUMPV
+LABELV $383
+ADDRLP4 60
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 100
+CNSTF4 1212370944
+ASGNF4
+ADDRLP4 76
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 100
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 108
+CNSTI4 4
+ASGNI4
+ADDRLP4 76+4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 108
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 100
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 108
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112
+CNSTI4 8
+ASGNI4
+ADDRLP4 76+8
+ADDRFP4 8
+INDIRP4
+ADDRLP4 112
+INDIRI4
+ADDP4
+INDIRF4
+CNSTF4 1212370944
+ADDRFP4 4
+INDIRP4
+ADDRLP4 112
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $392
+ADDRLP4 4
+ARGP4
+ADDRLP4 60
+ARGP4
+ADDRLP4 116
+CNSTP4 0
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $396
+ADDRGP4 $394
+JUMPV
+LABELV $396
+ADDRLP4 4+4
+INDIRI4
+CNSTI4 0
+NEI4 $399
+ADDRLP4 120
+CNSTF4 1092616192
+ASGNF4
+ADDRLP4 60
+ADDRLP4 4+12
+INDIRF4
+ADDRLP4 120
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60+4
+ADDRLP4 4+12+4
+INDIRF4
+ADDRLP4 120
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60+8
+ADDRLP4 4+12+8
+INDIRF4
+CNSTF4 1092616192
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $400
+JUMPV
+LABELV $399
+ADDRLP4 120
+CNSTF4 1092616192
+ASGNF4
+ADDRLP4 60
+ADDRLP4 60
+INDIRF4
+ADDRLP4 120
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60+4
+ADDRLP4 60+4
+INDIRF4
+ADDRLP4 120
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60+8
+ADDRLP4 60+8
+INDIRF4
+CNSTF4 1092616192
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $400
+LABELV $393
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+ADDRLP4 4+44
+INDIRI4
+CNSTI4 128
+BANDI4
+ADDRLP4 116
+INDIRI4
+NEI4 $392
+ADDRLP4 4+48
+INDIRI4
+CNSTI4 536870912
+BANDI4
+ADDRLP4 116
+INDIRI4
+NEI4 $392
+LABELV $394
+ADDRLP4 4+44
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $417
+ADDRLP4 120
+CNSTI4 1
+ASGNI4
+ADDRGP4 $418
+JUMPV
+LABELV $417
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+LABELV $418
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+RETI4
+LABELV $373
+endproc LF_Visible 128 28
+proc Calculate_2DdirOf3D 132 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 48
+CNSTI4 8
+ASGNI4
+ADDRFP4 20
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+CNSTF4 1142947840
+ADDRFP4 8
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ADDRGP4 cgs+20100+11304
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 52
+CNSTI4 12
+ASGNI4
+ADDRFP4 20
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+CNSTF4 1139802112
+ADDRFP4 8
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ADDRGP4 cgs+20100+11308
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRFP4 20
+INDIRP4
+CNSTF4 1142947840
+ADDRFP4 8
+INDIRP4
+INDIRI4
+CVIF4 4
+CNSTF4 1056964608
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+MULF4
+ADDRGP4 cgs+20100+11304
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 60
+CNSTI4 4
+ASGNI4
+ADDRFP4 20
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+CNSTF4 1139802112
+ADDRFP4 8
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1056964608
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+MULF4
+ADDRGP4 cgs+20100+11308
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 LF_Visible
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+NEI4 $428
+CNSTF4 0
+RETF4
+ADDRGP4 $419
+JUMPV
+LABELV $428
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1242325376
+EQF4 $430
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 80
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRGP4 $431
+JUMPV
+LABELV $430
+ADDRLP4 72
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 72
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 72
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTF4 1347851172
+ASGNF4
+LABELV $431
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 0
+GTF4 $436
+CNSTF4 0
+RETF4
+ADDRGP4 $419
+JUMPV
+LABELV $436
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 AxisCopy
+CALLV
+pop
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+EQF4 $440
+ADDRLP4 76
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 80
+INDIRF4
+MULF4
+SUBF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+24
+INDIRF4
+MULF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 12+24+4
+INDIRF4
+MULF4
+SUBF4
+MULF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 80
+INDIRF4
+MULF4
+SUBF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+24
+INDIRF4
+MULF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 12+24+8
+INDIRF4
+MULF4
+SUBF4
+MULF4
+SUBF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 12+12+4
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+12
+INDIRF4
+MULF4
+SUBF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+24
+INDIRF4
+MULF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 12+24+8
+INDIRF4
+MULF4
+SUBF4
+MULF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 12+12+8
+INDIRF4
+MULF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+12
+INDIRF4
+MULF4
+SUBF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+24
+INDIRF4
+MULF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 12+24+4
+INDIRF4
+MULF4
+SUBF4
+MULF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRGP4 $441
+JUMPV
+LABELV $440
+ADDRLP4 84
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+MULF4
+SUBF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+24+8
+INDIRF4
+MULF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+24+4
+INDIRF4
+MULF4
+SUBF4
+MULF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+MULF4
+SUBF4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 12+24+8
+INDIRF4
+MULF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+24
+INDIRF4
+MULF4
+SUBF4
+MULF4
+SUBF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+12+4
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+12+8
+INDIRF4
+MULF4
+SUBF4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 12+24+8
+INDIRF4
+MULF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+24
+INDIRF4
+MULF4
+SUBF4
+MULF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+12
+INDIRF4
+MULF4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 12+12+8
+INDIRF4
+MULF4
+SUBF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+24+8
+INDIRF4
+MULF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+24+4
+INDIRF4
+MULF4
+SUBF4
+MULF4
+SUBF4
+DIVF4
+ASGNF4
+LABELV $441
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+24
+INDIRF4
+MULF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12+24+4
+INDIRF4
+MULF4
+SUBF4
+CNSTF4 0
+EQF4 $506
+ADDRLP4 92
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 92
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+SUBF4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRLP4 92
+INDIRF4
+ADDRLP4 12+12+4
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+12
+INDIRF4
+MULF4
+SUBF4
+MULF4
+ADDF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+24
+INDIRF4
+MULF4
+ADDRLP4 92
+INDIRF4
+ADDRLP4 12+24+4
+INDIRF4
+MULF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRGP4 $507
+JUMPV
+LABELV $506
+ADDRLP4 100
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 100
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+SUBF4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRLP4 100
+INDIRF4
+ADDRLP4 12+12+8
+INDIRF4
+MULF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+12
+INDIRF4
+MULF4
+SUBF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+24
+INDIRF4
+MULF4
+ADDRLP4 100
+INDIRF4
+ADDRLP4 12+24+8
+INDIRF4
+MULF4
+SUBF4
+DIVF4
+ASGNF4
+LABELV $507
+ADDRFP4 12
+INDIRP4
+CNSTF4 3212836864
+ADDRFP4 12
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 108
+CNSTF4 1056964608
+ASGNF4
+CNSTF4 1016003125
+ADDRLP4 108
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 112
+ADDRGP4 tan
+CALLF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRFP4 20
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 112
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 120
+CNSTF4 1056964608
+ASGNF4
+CNSTF4 1016003125
+ADDRLP4 120
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 124
+ADDRGP4 tan
+CALLF4
+ASGNF4
+ADDRLP4 128
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ADDRLP4 128
+INDIRP4
+INDIRF4
+ADDRLP4 120
+INDIRF4
+ADDRFP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 124
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+CNSTF4 1065353216
+RETF4
+LABELV $419
+endproc Calculate_2DdirOf3D 132 12
+lit
+align 4
+LABELV $599
+byte 4 0
+byte 4 1065353216
+align 4
+LABELV $600
+byte 4 1065353216
+byte 4 0
+code
+proc DrawLensflare 180 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTF4 1065353216
+CNSTF4 1056964608
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+DIVF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1065353216
+CNSTF4 1056964608
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+DIVF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+CNSTF4 1139802112
+DIVF4
+ASGNF4
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 40
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 140
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 lfmem+136
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $539
+JUMPV
+LABELV $536
+CNSTI4 140
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 lfmem+132
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $541
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $544
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRGP4 cgs+160652+8
+INDIRI4
+ASGNI4
+LABELV $544
+LABELV $541
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $548
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $548
+ADDRGP4 $537
+JUMPV
+LABELV $548
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $550
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $552
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 52
+INDIRF4
+ADDRLP4 52
+INDIRF4
+MULF4
+ADDRLP4 24
+INDIRF4
+GEF4 $554
+ADDRGP4 $537
+JUMPV
+LABELV $554
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRFP4 8
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 24
+INDIRF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+DIVF4
+SUBF4
+MULF4
+ASGNF4
+ADDRGP4 $551
+JUMPV
+LABELV $552
+CNSTF4 1065353216
+ADDRLP4 24
+INDIRF4
+CNSTI4 140
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 lfmem+128
+ADDP4
+INDIRF4
+DIVF4
+GEF4 $556
+ADDRGP4 $537
+JUMPV
+LABELV $556
+ADDRLP4 48
+ADDRFP4 8
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 24
+INDIRF4
+CNSTI4 140
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 lfmem+128
+ADDP4
+INDIRF4
+DIVF4
+SUBF4
+MULF4
+ASGNF4
+ADDRGP4 $551
+JUMPV
+LABELV $550
+ADDRFP4 8
+INDIRF4
+CNSTF4 0
+GEF4 $560
+ADDRGP4 $537
+JUMPV
+LABELV $560
+ADDRLP4 48
+ADDRFP4 8
+INDIRF4
+ASGNF4
+LABELV $551
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+LEF4 $562
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $562
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 1
+EQI4 $566
+ADDRLP4 56
+INDIRI4
+CNSTI4 2
+NEI4 $564
+LABELV $566
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ASGNF4
+LABELV $564
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+LTI4 $567
+ADDRLP4 60
+INDIRI4
+CNSTI4 4
+GTI4 $567
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $642-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $642
+address $579
+address $598
+address $622
+address $623
+code
+LABELV $567
+ADDRLP4 68
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $570
+ADDRLP4 84
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 88
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 84
+INDIRF4
+MULF4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 88
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 92
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 92
+INDIRF4
+ASGNF4
+ADDRLP4 68
+INDIRF4
+CNSTF4 0
+EQF4 $572
+ADDRLP4 68
+CNSTF4 1065353216
+ADDRLP4 68
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 72
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 68
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 72+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 68
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 104
+ADDRGP4 acos
+CALLF4
+ASGNF4
+ADDRLP4 68
+CNSTF4 1119092736
+CNSTF4 1127481344
+ADDRLP4 104
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+SUBF4
+ASGNF4
+ADDRLP4 72+4
+INDIRF4
+CNSTF4 0
+LEF4 $573
+ADDRLP4 68
+CNSTF4 1127481344
+ADDRLP4 68
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $573
+JUMPV
+LABELV $572
+ADDRLP4 68
+CNSTF4 0
+ASGNF4
+LABELV $573
+ADDRLP4 68
+ADDRLP4 68
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $570
+ADDRLP4 84
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ASGNP4
+ADDRLP4 88
+ADDRLP4 84
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 68
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDRLP4 88
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDRLP4 88
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 100
+ADDRLP4 84
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 100
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 104
+CNSTI4 4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 104
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 104
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 100
+INDIRF4
+MULF4
+SUBF4
+ARGF4
+ADDRLP4 108
+CNSTF4 1073741824
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 108
+INDIRF4
+ARGF4
+ADDRLP4 108
+INDIRF4
+ARGF4
+ADDRLP4 112
+CNSTF4 0
+ASGNF4
+ADDRLP4 112
+INDIRF4
+ARGF4
+ADDRLP4 112
+INDIRF4
+ARGF4
+ADDRLP4 116
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 116
+INDIRF4
+ARGF4
+ADDRLP4 116
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+ARGP4
+ADDRLP4 68
+INDIRF4
+ARGF4
+CNSTI4 3
+ARGI4
+ADDRGP4 AdvancedDrawPicA
+CALLV
+pop
+ADDRGP4 $568
+JUMPV
+LABELV $579
+ADDRLP4 68
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+NEGF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 68+4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 100
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 100
+INDIRF4
+CNSTF4 0
+LEF4 $581
+ADDRLP4 4
+INDIRF4
+ADDRLP4 100
+INDIRF4
+LEF4 $581
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $582
+JUMPV
+LABELV $581
+ADDRLP4 104
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 104
+INDIRF4
+CNSTF4 0
+GEF4 $583
+ADDRLP4 4
+INDIRF4
+ADDRLP4 104
+INDIRF4
+NEGF4
+LEF4 $583
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $583
+LABELV $582
+ADDRLP4 76
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 68
+INDIRF4
+SUBF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 76+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 68+4
+INDIRF4
+SUBF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 84
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 68
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 84+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 68+4
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ASGNP4
+ADDRLP4 68
+ADDRLP4 68
+INDIRF4
+ADDRLP4 124
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 68+4
+ADDRLP4 68+4
+INDIRF4
+ADDRLP4 124
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 144
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 140
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 152
+ADDRLP4 144
+INDIRF4
+ADDRLP4 148
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 152
+INDIRF4
+ADDRLP4 156
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 160
+CNSTI4 4
+ASGNI4
+ADDRLP4 164
+ADDRFP4 16
+INDIRP4
+ADDRLP4 160
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 168
+ADDRFP4 4
+INDIRP4
+ADDRLP4 160
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 140
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 164
+INDIRF4
+ADDRLP4 168
+INDIRF4
+ADDRLP4 68+4
+INDIRF4
+SUBF4
+ADDRLP4 76+4
+INDIRF4
+ADDF4
+SUBF4
+ARGF4
+ADDRLP4 152
+INDIRF4
+ADDRLP4 156
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 164
+INDIRF4
+ADDRLP4 168
+INDIRF4
+ADDRLP4 68+4
+INDIRF4
+SUBF4
+ADDRLP4 76+4
+INDIRF4
+SUBF4
+SUBF4
+ARGF4
+ADDRLP4 172
+ADDRLP4 144
+INDIRF4
+ADDRLP4 148
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 176
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 172
+INDIRF4
+ADDRLP4 176
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 164
+INDIRF4
+ADDRLP4 168
+INDIRF4
+ADDRLP4 68+4
+INDIRF4
+ADDF4
+ADDRLP4 84+4
+INDIRF4
+SUBF4
+SUBF4
+ARGF4
+ADDRLP4 172
+INDIRF4
+ADDRLP4 176
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 164
+INDIRF4
+ADDRLP4 168
+INDIRF4
+ADDRLP4 68+4
+INDIRF4
+ADDF4
+ADDRLP4 84+4
+INDIRF4
+ADDF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+ARGP4
+ADDRGP4 Draw4VertsPic
+CALLV
+pop
+ADDRGP4 $568
+JUMPV
+LABELV $598
+ADDRLP4 76
+ADDRGP4 $599
+INDIRB
+ASGNB 8
+ADDRLP4 68
+ADDRGP4 $600
+INDIRB
+ASGNB 8
+ADDRLP4 84
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $601
+ADDRLP4 92
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 96
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 92
+INDIRF4
+ADDRLP4 92
+INDIRF4
+MULF4
+ADDRLP4 96
+INDIRF4
+ADDRLP4 96
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 100
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 84
+ADDRLP4 100
+INDIRF4
+ASGNF4
+ADDRLP4 84
+INDIRF4
+CNSTF4 0
+EQF4 $603
+ADDRLP4 68
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 84
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 68+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 84
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 112
+ADDRGP4 acos
+CALLF4
+ASGNF4
+ADDRLP4 84
+CNSTF4 1070141403
+ADDRLP4 112
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 68+4
+INDIRF4
+CNSTF4 0
+LEF4 $604
+ADDRLP4 84
+CNSTF4 1078530011
+ADDRLP4 84
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $604
+JUMPV
+LABELV $603
+ADDRLP4 84
+CNSTF4 0
+ASGNF4
+LABELV $604
+ADDRLP4 84
+ADDRLP4 84
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $601
+ADDRLP4 92
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 84
+ADDRLP4 84
+INDIRF4
+CNSTF4 1078530011
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDRLP4 92
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDRLP4 92
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1127481344
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 84
+INDIRF4
+ARGF4
+ADDRLP4 96
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 84
+INDIRF4
+ARGF4
+ADDRLP4 100
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 68+4
+ADDRLP4 100
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 68+4
+INDIRF4
+NEGF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 76+4
+ADDRLP4 68
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 68
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 68+4
+ADDRLP4 68+4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 128
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 124
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 132
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 136
+ADDRLP4 128
+INDIRF4
+ADDRLP4 132
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 136
+INDIRF4
+ADDRLP4 140
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 144
+CNSTI4 4
+ASGNI4
+ADDRLP4 148
+ADDRFP4 16
+INDIRP4
+ADDRLP4 144
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 152
+ADDRFP4 4
+INDIRP4
+ADDRLP4 144
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 124
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 148
+INDIRF4
+ADDRLP4 152
+INDIRF4
+ADDRLP4 76+4
+INDIRF4
+SUBF4
+ADDRLP4 68+4
+INDIRF4
+ADDF4
+SUBF4
+ARGF4
+ADDRLP4 136
+INDIRF4
+ADDRLP4 140
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 148
+INDIRF4
+ADDRLP4 152
+INDIRF4
+ADDRLP4 76+4
+INDIRF4
+SUBF4
+ADDRLP4 68+4
+INDIRF4
+SUBF4
+SUBF4
+ARGF4
+ADDRLP4 156
+ADDRLP4 128
+INDIRF4
+ADDRLP4 132
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 156
+INDIRF4
+ADDRLP4 140
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 148
+INDIRF4
+ADDRLP4 152
+INDIRF4
+ADDRLP4 76+4
+INDIRF4
+ADDF4
+ADDRLP4 68+4
+INDIRF4
+SUBF4
+SUBF4
+ARGF4
+ADDRLP4 156
+INDIRF4
+ADDRLP4 140
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 148
+INDIRF4
+ADDRLP4 152
+INDIRF4
+ADDRLP4 76+4
+INDIRF4
+ADDF4
+ADDRLP4 68+4
+INDIRF4
+ADDF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+ARGP4
+ADDRGP4 Draw4VertsPic
+CALLV
+pop
+ADDRGP4 $568
+JUMPV
+LABELV $622
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+CNSTF4 1139802112
+ARGF4
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 76
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+ARGP4
+ADDRLP4 72
+INDIRF4
+ARGF4
+CNSTI4 3
+ARGI4
+ADDRGP4 AdvancedDrawPicA
+CALLV
+pop
+ADDRGP4 $568
+JUMPV
+LABELV $623
+ADDRLP4 104
+CNSTF4 0
+ASGNF4
+ADDRLP4 84
+CNSTF4 0
+ASGNF4
+ADDRLP4 124
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ASGNP4
+ADDRLP4 88
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 124
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 128
+CNSTI4 4
+ASGNI4
+ADDRLP4 88+4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 128
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 128
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 124
+INDIRP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+NEF4 $625
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+LABELV $625
+ADDRLP4 88+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 88+12
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $629
+ADDRLP4 136
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 140
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 136
+INDIRF4
+ADDRLP4 136
+INDIRF4
+MULF4
+ADDRLP4 140
+INDIRF4
+ADDRLP4 140
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 144
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 104
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 104
+INDIRF4
+CNSTF4 0
+EQF4 $631
+ADDRLP4 108
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 104
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 108+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 104
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 108
+INDIRF4
+ARGF4
+ADDRLP4 156
+ADDRGP4 acos
+CALLF4
+ASGNF4
+ADDRLP4 84
+CNSTF4 1070141403
+ADDRLP4 156
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 108+4
+INDIRF4
+CNSTF4 0
+LEF4 $632
+ADDRLP4 84
+CNSTF4 1078530011
+ADDRLP4 84
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $632
+JUMPV
+LABELV $631
+ADDRLP4 84
+CNSTF4 0
+ASGNF4
+LABELV $632
+ADDRLP4 84
+ADDRLP4 84
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $629
+ADDRLP4 136
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 84
+ADDRLP4 84
+INDIRF4
+CNSTF4 1078530011
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDRLP4 136
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDRLP4 136
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1127481344
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 84
+INDIRF4
+ARGF4
+ADDRLP4 140
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 108
+ADDRLP4 140
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 104
+INDIRF4
+MULF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 84
+INDIRF4
+ARGF4
+ADDRLP4 144
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 108+4
+ADDRLP4 144
+INDIRF4
+NEGF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 104
+INDIRF4
+MULF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $639
+ADDRGP4 $641
+ARGP4
+CNSTI4 140
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 lfmem
+ADDP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $532
+JUMPV
+LABELV $639
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 108
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 DrawLensflare
+CALLV
+pop
+LABELV $568
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+LABELV $537
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $539
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $536
+CNSTI4 140
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 lfmem+132
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $532
+endproc DrawLensflare 180 48
+lit
+align 4
+LABELV $652
+byte 4 1242325376
+byte 4 0
+byte 4 0
+export AddLFsToScreen
+code
+proc AddLFsToScreen 88 24
+ADDRGP4 cg_drawLensflare+12
+INDIRI4
+CNSTI4 0
+NEI4 $646
+ADDRGP4 $645
+JUMPV
+LABELV $646
+ADDRGP4 cg+107800
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $649
+ADDRLP4 28
+ADDRGP4 $652
+INDIRB
+ASGNB 12
+ADDRGP4 cg+107928
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRGP4 cg+107648
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $654
+CNSTF4 953267991
+ADDRGP4 cg+107612
+INDIRI4
+CVIF4 4
+MULF4
+ADDRGP4 cg+107788
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 76
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRGP4 cg+107776
+INDIRF4
+NEGF4
+ADDRLP4 76
+INDIRF4
+MULF4
+ASGNF4
+CNSTF4 953267991
+ADDRGP4 cg+107612
+INDIRI4
+CVIF4 4
+MULF4
+ADDRGP4 cg+107788+4
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 80
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 16+4
+ADDRGP4 cg+107776+4
+INDIRF4
+NEGF4
+ADDRLP4 80
+INDIRF4
+MULF4
+ASGNF4
+CNSTF4 953267991
+ADDRGP4 cg+107612
+INDIRI4
+CVIF4 4
+MULF4
+ADDRGP4 cg+107788+8
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 84
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 16+8
+ADDRGP4 cg+107776+8
+INDIRF4
+NEGF4
+ADDRLP4 84
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRGP4 cg+107928
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 VectorRotate
+CALLV
+pop
+ADDRGP4 $655
+JUMPV
+LABELV $654
+ADDRLP4 16
+ADDRGP4 cg+107928
+INDIRF4
+ASGNF4
+ADDRLP4 16+4
+ADDRGP4 cg+107928+4
+INDIRF4
+ASGNF4
+ADDRLP4 16+8
+ADDRGP4 cg+107928+8
+INDIRF4
+ASGNF4
+LABELV $655
+ADDRGP4 cg+107800
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 AddLFToDrawList
+CALLV
+pop
+LABELV $649
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $684
+JUMPV
+LABELV $681
+ADDRLP4 36
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 IFD_Array+4
+ADDP4
+ARGP4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 IFD_Array+16
+ADDP4
+ARGP4
+ADDRGP4 cg+110648
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 40
+ADDRGP4 Calculate_2DdirOf3D
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+NEF4 $688
+ADDRGP4 $682
+JUMPV
+LABELV $688
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 IFD_Array
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 20
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 DrawLensflare
+CALLV
+pop
+LABELV $682
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $684
+ADDRLP4 0
+INDIRI4
+ADDRGP4 IFDA_firstempty
+INDIRI4
+LTI4 $681
+ADDRGP4 IFD_Array
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 512
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 IFDA_firstempty
+CNSTI4 0
+ASGNI4
+LABELV $645
+endproc AddLFsToScreen 88 24
+bss
+align 4
+LABELV lfVisCacheNext
+skip 4
+align 4
+LABELV lfVisCache
+skip 704
+align 1
+LABELV nextscript
+skip 128
+align 1
+LABELV tmpString
+skip 128
+align 4
+LABELV tmpstrl
+skip 4
+align 4
+LABELV next_tmpstr
+skip 4
+align 4
+LABELV parserlvl
+skip 4
+align 4
+LABELV IFDA_firstempty
+skip 4
+align 4
+LABELV IFD_Array
+skip 512
+align 4
+LABELV numlfs
+skip 4
+align 4
+LABELV lfmem
+skip 4480
+align 4
+LABELV freeflares
+skip 4
+align 4
+LABELV flaremem
+skip 23552
+import CG_AddBoundingBox
+import CG_AddBoundingBoxEntity
+import CG_QueryCvar
+import CG_Timestamp
+import CG_LimitCvars
+import trap_RealTime
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import trap_R_inPVS
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_Cutscene2d_Draw
+import CG_Cutscene2d_UpdateTrans
+import CG_Cutscene2d_CheckCmd
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import Main_SpriteParticles
+import LaunchRevivalParticle
+import LaunchSpeedyPuffTrail
+import Init_SpriteParticles
+import DumpPolyInfo
+import ActiveChooseLogoMenu
+import FindLogoForSpraying
+import Add_LogoToDrawList
+import AddLogosToScene
+import Init_SprayLogoSys
+import Calculate_2DOfDIR
+import Calculate_2DOf3D
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_ChangeLoadingProgress
+import CG_LoadingString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_ScorePlum
+import CG_TeleOutEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_GenerateParticles
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_PortalInView
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_GetWaterMuzzle
+import CG_SprayTrail
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponSRWC
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_Boomies_Explosion
+import CG_BamBam_Explosion
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_LerpTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayer
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_UpdateVoipTeamIDs
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Draw3DModel
+import CG_SetPrintString
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import CG_MessagePrint
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_WorldToScreen
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_DrawPic1024
+import CG_DrawRect1024
+import CG_FillRect1024
+import CG_AdjustFrom1024
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddPolyBatched
+import CG_AddRefEntityBatched
+import CG_FlushSceneBatches
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_ForceModelChange
+import CG_GetCvarFloat
+import CG_GetCvarInt
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StreamAssets
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_icons
+import cg_ambient
+import cg_drawBBox
+import cg_drawVoiceNames
+import cg_drawLensflare
+import cg_timestamps
+import cg_skyLensflare
+import cg_sky
+import cg_curWarmupReady
+import cg_warmupReady
+import cg_glowModelTeam
+import cg_glowModel
+import cg_cineDrawLetterBox
+import cg_cineHideHud
+import cg_LPSwallhackAlpha
+import cg_LPSwallhackSize
+import cg_bigScoreType
+import cg_thirdPersonAutoSwitch
+import cg_drawTimeLeft
+import cg_drawServerInfos
+import cg_drawMessages
+import cg_drawups
+import cg_wopFFAhud
+import cg_printDir
+import cg_drawRealTime
+import cg_correctedWeaponPos
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_streamAssets
+import cg_deferPlayers
+import cg_predictItems
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_chatBeep
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_optimizePrediction
+import cg_nopredict
+import cg_errorDecay
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import trailEnt
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $641
+byte 1 69
+byte 1 82
+byte 1 82
+byte 1 79
+byte 1 82
+byte 1 58
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 102
+byte 1 33
+byte 1 33
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $305
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $281
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $279
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 34
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $276
+byte 1 94
+byte 1 50
+byte 1 116
+byte 1 109
+byte 1 112
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 40
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 102
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 62
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 32
+byte 1 105
+byte 1 102
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 95
+byte 1 97
+byte 1 116
+byte 1 64
+byte 1 103
+byte 1 109
+byte 1 120
+byte 1 46
+byte 1 100
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $256
+byte 1 94
+byte 1 49
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 45
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 40
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 41
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 45
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 117
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 40
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 61
+byte 1 37
+byte 1 105
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $251
+byte 1 94
+byte 1 49
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 45
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 117
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 40
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 61
+byte 1 37
+byte 1 105
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $206
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 34
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $205
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $203
+byte 1 94
+byte 1 49
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 45
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 119
+byte 1 114
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 118
+byte 1 108
+byte 1 32
+byte 1 40
+byte 1 119
+byte 1 114
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 39
+byte 1 123
+byte 1 39
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 39
+byte 1 125
+byte 1 39
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $200
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 102
+byte 1 40
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 41
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $199
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $172
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $163
+byte 1 115
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $158
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $153
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $148
+byte 1 98
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $123
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $120
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $117
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $114
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $111
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $108
+byte 1 114
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $97
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
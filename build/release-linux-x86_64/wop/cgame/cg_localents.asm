@@ -0,0 +1,8990 @@
+code
+proc CG_GrowLocalEntities 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2048
+ADDRGP4 cg_numLocalEntities
+INDIRI4
+SUBI4
+GEI4 $82
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $83
+JUMPV
+LABELV $82
+ADDRLP4 4
+CNSTI4 2048
+ADDRGP4 cg_numLocalEntities
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $83
+ADDRFP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $84
+CNSTI4 0
+RETI4
+ADDRGP4 $80
+JUMPV
+LABELV $84
+ADDRLP4 0
+ADDRGP4 cg_numLocalEntities
+INDIRI4
+ASGNI4
+ADDRGP4 $89
+JUMPV
+LABELV $86
+ADDRLP4 8
+CNSTI4 304
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg_localEntities+4
+ADDP4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg_localEntities+304
+ADDP4
+ASGNP4
+LABELV $87
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $89
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg_numLocalEntities
+INDIRI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+LTI4 $86
+CNSTI4 304
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_localEntities+4
+ADDP4
+ADDRGP4 cg_freeLocalEntities
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRGP4 cg_numLocalEntities
+ASGNP4
+ADDRLP4 12
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg_freeLocalEntities
+CNSTI4 304
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg_localEntities
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $80
+endproc CG_GrowLocalEntities 16 0
+export CG_InitLocalEntities
+proc CG_InitLocalEntities 4 12
+ADDRGP4 cg_localEntities
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 622592
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg_activeLocalEntities+4
+ADDRGP4 cg_activeLocalEntities
+ASGNP4
+ADDRLP4 0
+ADDRGP4 cg_activeLocalEntities
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_freeLocalEntities
+CNSTP4 0
+ASGNP4
+ADDRGP4 cg_numLocalEntities
+CNSTI4 0
+ASGNI4
+CNSTI4 512
+ARGI4
+ADDRGP4 CG_GrowLocalEntities
+CALLI4
+pop
+LABELV $93
+endproc CG_InitLocalEntities 4 12
+export CG_FreeLocalEntity
+proc CG_FreeLocalEntity 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $96
+ADDRGP4 $98
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $96
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg_freeLocalEntities
+INDIRP4
+ASGNP4
+ADDRGP4 cg_freeLocalEntities
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $95
+endproc CG_FreeLocalEntity 12 4
+proc CG_FreeExpiringLocalEntity 28 4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+ADDRGP4 cg_activeLocalEntities+4
+INDIRP4
+ASGNP4
+ADDRGP4 $103
+JUMPV
+LABELV $100
+ADDRLP4 8
+ADDRGP4 cg_addingLocalEntity
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 12
+INDIRU4
+CNSTU4 0
+EQU4 $105
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 16
+INDIRU4
+ADDRLP4 12
+INDIRU4
+EQU4 $107
+ADDRLP4 16
+INDIRU4
+ADDRLP4 8
+INDIRP4
+INDIRP4
+CVPU4 4
+NEU4 $105
+LABELV $107
+ADDRGP4 $101
+JUMPV
+LABELV $105
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $110
+ADDRLP4 24
+CNSTI4 32
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+GEI4 $108
+LABELV $110
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $108
+LABELV $101
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $103
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg_activeLocalEntities
+CVPU4 4
+NEU4 $100
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $111
+ADDRGP4 $113
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $111
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+LABELV $99
+endproc CG_FreeExpiringLocalEntity 28 4
+export CG_AllocLocalEntity
+proc CG_AllocLocalEntity 16 12
+ADDRGP4 cg_freeLocalEntities
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $115
+CNSTI4 256
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_GrowLocalEntities
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $115
+ADDRGP4 CG_FreeExpiringLocalEntity
+CALLV
+pop
+LABELV $115
+ADDRLP4 8
+ADDRGP4 cg_freeLocalEntities
+ASGNP4
+ADDRLP4 12
+ADDRLP4 8
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 304
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg_activeLocalEntities+4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 cg_activeLocalEntities
+ASGNP4
+ADDRGP4 cg_activeLocalEntities+4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_activeLocalEntities+4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $114
+endproc CG_AllocLocalEntity 16 12
+proc CG_FragmentBounceMark 0 0
+LABELV $120
+endproc CG_FragmentBounceMark 0 0
+proc CG_FragmentBounceSound 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $121
+endproc CG_FragmentBounceSound 0 0
+proc CG_ReflectVelocity 64 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 cg+107608
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRGP4 cg+107608
+INDIRI4
+CVIF4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BG_EvaluateTrajectoryDelta
+CALLV
+pop
+ADDRLP4 20
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 20
+INDIRF4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 12
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 12
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 12
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $135
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+CNSTF4 0
+LEF4 $131
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 1109393408
+LTF4 $135
+ADDRLP4 60
+INDIRF4
+ADDRGP4 cg+107608
+INDIRI4
+NEGI4
+CVIF4 4
+ADDRLP4 60
+INDIRF4
+MULF4
+GEF4 $131
+LABELV $135
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $131
+LABELV $122
+endproc CG_ReflectVelocity 64 12
+export CG_AddFragment
+proc CG_AddFragment 88 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $137
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 1000
+GEI4 $140
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+ADDRLP4 84
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+ASGNP4
+ADDRLP4 72
+ADDRLP4 84
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRF4
+CNSTF4 1098907648
+CNSTF4 1065353216
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+SUBF4
+MULF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+ARGP4
+ADDRGP4 CG_AddRefEntityBatched
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRGP4 $136
+JUMPV
+LABELV $140
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+ARGP4
+ADDRGP4 CG_AddRefEntityBatched
+CALLV
+pop
+ADDRGP4 $136
+JUMPV
+LABELV $137
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+ADDRGP4 cg+107612
+INDIRI4
+ARGI4
+ADDRLP4 56
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+ARGP4
+ADDRLP4 68
+CNSTP4 0
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 56
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $143
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+ADDRLP4 56
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $146
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ARGP4
+ADDRGP4 cg+107612
+INDIRI4
+ARGI4
+ADDRLP4 72
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 72
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+LABELV $146
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+ARGP4
+ADDRGP4 CG_AddRefEntityBatched
+CALLV
+pop
+ADDRGP4 $136
+JUMPV
+LABELV $143
+ADDRLP4 0+12
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 72
+ADDRGP4 trap_CM_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CVIU4 4
+CNSTU4 2147483648
+BANDU4
+CNSTU4 0
+EQU4 $149
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $136
+JUMPV
+LABELV $149
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_FragmentBounceMark
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_FragmentBounceSound
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_ReflectVelocity
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+ARGP4
+ADDRGP4 CG_AddRefEntityBatched
+CALLV
+pop
+LABELV $136
+endproc CG_AddFragment 88 28
+export CG_AddFadeRGB
+proc CG_AddFadeRGB 60 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 1132396544
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+LTF4 $155
+ADDRLP4 8
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $156
+JUMPV
+LABELV $155
+ADDRLP4 8
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $156
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 8
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 32
+INDIRF4
+LTF4 $158
+ADDRLP4 24
+ADDRLP4 28
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $159
+JUMPV
+LABELV $158
+ADDRLP4 24
+ADDRLP4 28
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $159
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 24
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 44
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 44
+INDIRF4
+LTF4 $161
+ADDRLP4 36
+ADDRLP4 40
+INDIRF4
+ADDRLP4 44
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $162
+JUMPV
+LABELV $161
+ADDRLP4 36
+ADDRLP4 40
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $162
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 36
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 56
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 52
+INDIRF4
+ADDRLP4 56
+INDIRF4
+LTF4 $164
+ADDRLP4 48
+ADDRLP4 52
+INDIRF4
+ADDRLP4 56
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $165
+JUMPV
+LABELV $164
+ADDRLP4 48
+ADDRLP4 52
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $165
+ADDRLP4 0
+INDIRP4
+CNSTI4 119
+ADDP4
+ADDRLP4 48
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntityBatched
+CALLV
+pop
+LABELV $152
+endproc CG_AddFadeRGB 60 4
+export CG_AddSprayTrailFade
+proc CG_AddSprayTrailFade 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 1132396544
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+LTF4 $169
+ADDRLP4 8
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $170
+JUMPV
+LABELV $169
+ADDRLP4 8
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $170
+ADDRLP4 0
+INDIRP4
+CNSTI4 119
+ADDP4
+ADDRLP4 8
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+ADDRGP4 cg+107612
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntityBatched
+CALLV
+pop
+LABELV $166
+endproc CG_AddSprayTrailFade 28 12
+proc CG_AddMoveScaleFade 156 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+LEI4 $174
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 28
+INDIRI4
+GEI4 $174
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTF4 1065353216
+ADDRLP4 36
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRLP4 36
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $175
+JUMPV
+LABELV $174
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $175
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $179
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $181
+ADDRFP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $181
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRLP4 40
+CNSTI4 28
+ASGNI4
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 52
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ADDF4
+ARGF4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRGP4 AxisScale
+CALLV
+pop
+LABELV $181
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+NEI4 $184
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+ADDRGP4 cg+107612
+INDIRI4
+ARGI4
+ADDRLP4 36
+ARGP4
+ADDRGP4 BG_EvaluateTrajectoryDelta
+CALLV
+pop
+ADDRLP4 36
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 48
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+LABELV $184
+LABELV $179
+ADDRLP4 36
+CNSTF4 1132396544
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 40
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 40
+INDIRF4
+LTF4 $188
+ADDRLP4 32
+ADDRLP4 36
+INDIRF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $189
+JUMPV
+LABELV $188
+ADDRLP4 32
+ADDRLP4 36
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $189
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 32
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 48
+CNSTF4 1132396544
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 52
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 52
+INDIRF4
+LTF4 $191
+ADDRLP4 44
+ADDRLP4 48
+INDIRF4
+ADDRLP4 52
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $192
+JUMPV
+LABELV $191
+ADDRLP4 44
+ADDRLP4 48
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $192
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 44
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 60
+CNSTF4 1132396544
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 64
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 64
+INDIRF4
+LTF4 $194
+ADDRLP4 56
+ADDRLP4 60
+INDIRF4
+ADDRLP4 64
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $195
+JUMPV
+LABELV $194
+ADDRLP4 56
+ADDRLP4 60
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $195
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 56
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 72
+CNSTF4 1132396544
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 76
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 76
+INDIRF4
+LTF4 $197
+ADDRLP4 68
+ADDRLP4 72
+INDIRF4
+ADDRLP4 76
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $198
+JUMPV
+LABELV $197
+ADDRLP4 68
+ADDRLP4 72
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $198
+ADDRLP4 0
+INDIRP4
+CNSTI4 119
+ADDP4
+ADDRLP4 68
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $199
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 4
+INDIRF4
+SUBF4
+MULF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+LABELV $199
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+ADDRGP4 cg+107612
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $202
+ADDRLP4 80
+CNSTI4 6
+ASGNI4
+ADDRGP4 cg+107616
+INDIRI4
+ADDRLP4 80
+INDIRI4
+RSHI4
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 80
+INDIRI4
+RSHI4
+EQI4 $204
+ADDRLP4 84
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ARGP4
+ADDRLP4 144
+CNSTP4 0
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 84+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $208
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 84+12
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 152
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ADDRLP4 152
+INDIRP4
+INDIRI4
+CNSTI4 -35
+BANDI4
+ASGNI4
+LABELV $208
+LABELV $204
+LABELV $202
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRGP4 cg+110648+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDRGP4 cg+110648+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+ARGP4
+ADDRLP4 84
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+GEF4 $222
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $173
+JUMPV
+LABELV $222
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntityBatched
+CALLV
+pop
+LABELV $173
+endproc CG_AddMoveScaleFade 156 28
+proc CG_AddScaleFade 48 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1132396544
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 36
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+LTF4 $227
+ADDRLP4 24
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $228
+JUMPV
+LABELV $227
+ADDRLP4 24
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $228
+ADDRLP4 0
+INDIRP4
+CNSTI4 119
+ADDP4
+ADDRLP4 24
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 16
+INDIRF4
+SUBF4
+MULF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRGP4 cg+110648+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDRGP4 cg+110648+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 44
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+GEF4 $239
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $224
+JUMPV
+LABELV $239
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntityBatched
+CALLV
+pop
+LABELV $224
+endproc CG_AddScaleFade 48 4
+proc CG_AddFallScaleFade 56 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1132396544
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 36
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+LTF4 $244
+ADDRLP4 24
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $245
+JUMPV
+LABELV $244
+ADDRLP4 24
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $245
+ADDRLP4 0
+INDIRP4
+CNSTI4 119
+ADDP4
+ADDRLP4 24
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 40
+CNSTI4 76
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 4
+INDIRF4
+SUBF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 4
+INDIRF4
+SUBF4
+MULF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRGP4 cg+110648+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDRGP4 cg+110648+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+ARGP4
+ADDRLP4 52
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+GEF4 $256
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $241
+JUMPV
+LABELV $256
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntityBatched
+CALLV
+pop
+LABELV $241
+endproc CG_AddFallScaleFade 56 4
+proc CG_AddExplosion 56 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+ADDRGP4 cgs+160652+760
+INDIRI4
+NEI4 $259
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 AxisCopy
+CALLV
+pop
+ADDRLP4 40
+CNSTI4 28
+ASGNI4
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+CNSTF4 1045220557
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 52
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+CNSTF4 1028443341
+ADDF4
+ARGF4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRGP4 AxisScale
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntityBatched
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 AxisCopy
+CALLV
+pop
+ADDRGP4 $260
+JUMPV
+LABELV $259
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntityBatched
+CALLV
+pop
+LABELV $260
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $264
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 12
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+GEF4 $267
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $268
+JUMPV
+LABELV $267
+ADDRLP4 4
+CNSTF4 1065353216
+CNSTF4 1073741824
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $268
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $264
+LABELV $258
+endproc CG_AddExplosion 56 20
+proc CG_AddSpriteExplosion 180 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRB
+ASGNB 140
+ADDRLP4 148
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 148
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRLP4 148
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 140
+INDIRF4
+CNSTF4 1065353216
+LEF4 $271
+ADDRLP4 140
+CNSTF4 1065353216
+ASGNF4
+LABELV $271
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 156
+CNSTF4 1051260355
+CNSTF4 1132396544
+ADDRLP4 140
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 160
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 156
+INDIRF4
+ADDRLP4 160
+INDIRF4
+LTF4 $281
+ADDRLP4 152
+ADDRLP4 156
+INDIRF4
+ADDRLP4 160
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $282
+JUMPV
+LABELV $281
+ADDRLP4 152
+ADDRLP4 156
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $282
+ADDRLP4 0+116+3
+ADDRLP4 152
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+132
+CNSTF4 1109917696
+CNSTF4 1065353216
+ADDRLP4 140
+INDIRF4
+SUBF4
+MULF4
+CNSTF4 1106247680
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddRefEntityBatched
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $284
+ADDRLP4 172
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 164
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 172
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 172
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 164
+INDIRF4
+CNSTF4 1056964608
+GEF4 $287
+ADDRLP4 164
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $288
+JUMPV
+LABELV $287
+ADDRLP4 164
+CNSTF4 1065353216
+CNSTF4 1073741824
+ADDRLP4 164
+INDIRF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $288
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+ADDRLP4 164
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+68
+ARGP4
+ADDRLP4 164
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $284
+LABELV $269
+endproc CG_AddSpriteExplosion 180 20
+export CG_AddTrail
+proc CG_AddTrail 216 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 108
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 96
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 96+8
+ADDRLP4 96+8
+INDIRF4
+CNSTF4 1084227584
+SUBF4
+ASGNF4
+ADDRLP4 168
+ADDRLP4 96
+INDIRF4
+ADDRGP4 cg+110648+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 168+4
+ADDRLP4 96+4
+INDIRF4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 168+8
+ADDRLP4 96+8
+INDIRF4
+ADDRGP4 cg+110648+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 108
+INDIRF4
+ADDRGP4 cg+110648+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 156+4
+ADDRLP4 108+4
+INDIRF4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 156+8
+ADDRLP4 108+8
+INDIRF4
+ADDRGP4 cg+110648+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 108
+INDIRF4
+ADDRLP4 96
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 108+4
+INDIRF4
+ADDRLP4 96+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 108+8
+INDIRF4
+ADDRLP4 96+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRLP4 196
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 184
+CNSTF4 1000593162
+ADDRLP4 196
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 168
+ARGP4
+ADDRLP4 144
+ARGP4
+ADDRLP4 132
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 156
+ARGP4
+ADDRLP4 144
+ARGP4
+ADDRLP4 120
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 132
+ARGP4
+ADDRLP4 168
+ARGP4
+ADDRGP4 VectorNormalize2
+CALLF4
+pop
+ADDRLP4 120
+ARGP4
+ADDRLP4 156
+ARGP4
+ADDRGP4 VectorNormalize2
+CALLF4
+pop
+ADDRLP4 200
+CNSTI4 255
+ASGNI4
+ADDRLP4 180
+ADDRLP4 200
+INDIRI4
+ADDRLP4 200
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+SUBI4
+MULI4
+CNSTI4 800
+DIVI4
+SUBI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+GEI4 $323
+ADDRLP4 180
+CNSTI4 0
+ASGNI4
+LABELV $323
+ADDRLP4 180
+INDIRI4
+CNSTI4 255
+LEI4 $325
+ADDRLP4 180
+CNSTI4 255
+ASGNI4
+LABELV $325
+ADDRLP4 0+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 204
+CNSTU1 0
+ASGNU1
+ADDRLP4 0+20+2
+ADDRLP4 204
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+1
+ADDRLP4 204
+INDIRU1
+ASGNU1
+ADDRLP4 0+20
+ADDRLP4 204
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 205
+CNSTU1 0
+ASGNU1
+ADDRLP4 0+24+20+2
+ADDRLP4 205
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+1
+ADDRLP4 205
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20
+ADDRLP4 205
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+12
+ADDRLP4 184
+INDIRF4
+ASGNF4
+ADDRLP4 0+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 206
+ADDRLP4 180
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+48+20+2
+ADDRLP4 206
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20+1
+ADDRLP4 206
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20
+ADDRLP4 206
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+12
+ADDRLP4 184
+INDIRF4
+ASGNF4
+ADDRLP4 0+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 207
+ADDRLP4 180
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+2
+ADDRLP4 207
+INDIRU1
+ASGNU1
+ADDRLP4 0+72+20+1
+ADDRLP4 207
+INDIRU1
+ASGNU1
+ADDRLP4 0+72+20
+ADDRLP4 207
+INDIRU1
+ASGNU1
+ADDRLP4 0+72+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 132
+ARGP4
+ADDRLP4 144
+ARGP4
+ADDRLP4 168
+ARGP4
+CNSTF4 1106247680
+ARGF4
+ADDRGP4 RotatePointAroundVector
+CALLV
+pop
+ADDRLP4 120
+ARGP4
+ADDRLP4 144
+ARGP4
+ADDRLP4 156
+ARGP4
+CNSTF4 1106247680
+ARGF4
+ADDRGP4 RotatePointAroundVector
+CALLV
+pop
+ADDRLP4 208
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 96
+INDIRF4
+ADDRLP4 132
+INDIRF4
+ADDRLP4 208
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 96+4
+INDIRF4
+ADDRLP4 132+4
+INDIRF4
+ADDRLP4 208
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 96+8
+INDIRF4
+ADDRLP4 132+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24
+ADDRLP4 96
+INDIRF4
+ADDRLP4 132
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRLP4 96+4
+INDIRF4
+ADDRLP4 132+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+8
+ADDRLP4 96+8
+INDIRF4
+ADDRLP4 132+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48
+ADDRLP4 108
+INDIRF4
+ADDRLP4 120
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+4
+ADDRLP4 108+4
+INDIRF4
+ADDRLP4 120+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+8
+ADDRLP4 108+8
+INDIRF4
+ADDRLP4 120+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72
+ADDRLP4 108
+INDIRF4
+ADDRLP4 120
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72+4
+ADDRLP4 108+4
+INDIRF4
+ADDRLP4 120+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72+8
+ADDRLP4 108+8
+INDIRF4
+ADDRLP4 120+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddPolyBatched
+CALLV
+pop
+ADDRLP4 132
+ARGP4
+ADDRLP4 144
+ARGP4
+ADDRLP4 168
+ARGP4
+CNSTF4 3253731328
+ARGF4
+ADDRGP4 RotatePointAroundVector
+CALLV
+pop
+ADDRLP4 120
+ARGP4
+ADDRLP4 144
+ARGP4
+ADDRLP4 156
+ARGP4
+CNSTF4 3253731328
+ARGF4
+ADDRGP4 RotatePointAroundVector
+CALLV
+pop
+ADDRLP4 212
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 96
+INDIRF4
+ADDRLP4 132
+INDIRF4
+ADDRLP4 212
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 96+4
+INDIRF4
+ADDRLP4 132+4
+INDIRF4
+ADDRLP4 212
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 96+8
+INDIRF4
+ADDRLP4 132+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24
+ADDRLP4 96
+INDIRF4
+ADDRLP4 132
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRLP4 96+4
+INDIRF4
+ADDRLP4 132+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+8
+ADDRLP4 96+8
+INDIRF4
+ADDRLP4 132+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48
+ADDRLP4 108
+INDIRF4
+ADDRLP4 120
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+4
+ADDRLP4 108+4
+INDIRF4
+ADDRLP4 120+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+8
+ADDRLP4 108+8
+INDIRF4
+ADDRLP4 120+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72
+ADDRLP4 108
+INDIRF4
+ADDRLP4 120
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72+4
+ADDRLP4 108+4
+INDIRF4
+ADDRLP4 120+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72+8
+ADDRLP4 108+8
+INDIRF4
+ADDRLP4 120+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddPolyBatched
+CALLV
+pop
+LABELV $290
+endproc CG_AddTrail 216 16
+export CG_AddTrailTracedRGB
+proc CG_AddTrailTracedRGB 344 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 96
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 108
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 108+8
+ADDRLP4 108+8
+INDIRF4
+CNSTF4 1084227584
+SUBF4
+ASGNF4
+ADDRLP4 188
+ARGP4
+ADDRLP4 108
+ARGP4
+ADDRLP4 252
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 252
+INDIRP4
+ARGP4
+ADDRLP4 252
+INDIRP4
+ARGP4
+ADDRLP4 96
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 96
+ADDRLP4 188+12
+INDIRB
+ASGNB 12
+ADDRLP4 172
+ADDRLP4 108
+INDIRF4
+ADDRGP4 cg+110648+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 172+4
+ADDRLP4 108+4
+INDIRF4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 172+8
+ADDRLP4 108+8
+INDIRF4
+ADDRGP4 cg+110648+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 160
+ADDRLP4 96
+INDIRF4
+ADDRGP4 cg+110648+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 160+4
+ADDRLP4 96+4
+INDIRF4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 160+8
+ADDRLP4 96+8
+INDIRF4
+ADDRGP4 cg+110648+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 96
+INDIRF4
+ADDRLP4 108
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 96+4
+INDIRF4
+ADDRLP4 108+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 96+8
+INDIRF4
+ADDRLP4 108+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRLP4 256
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 184
+CNSTF4 1000593162
+ADDRLP4 256
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 172
+ARGP4
+ADDRLP4 144
+ARGP4
+ADDRLP4 132
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 160
+ARGP4
+ADDRLP4 144
+ARGP4
+ADDRLP4 120
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 132
+ARGP4
+ADDRLP4 172
+ARGP4
+ADDRGP4 VectorNormalize2
+CALLF4
+pop
+ADDRLP4 120
+ARGP4
+ADDRLP4 160
+ARGP4
+ADDRGP4 VectorNormalize2
+CALLF4
+pop
+ADDRLP4 260
+CNSTI4 255
+ASGNI4
+ADDRLP4 156
+ADDRLP4 260
+INDIRI4
+ADDRLP4 260
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+SUBI4
+MULI4
+CNSTI4 800
+DIVI4
+SUBI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+GEI4 $485
+ADDRLP4 156
+CNSTI4 0
+ASGNI4
+LABELV $485
+ADDRLP4 156
+INDIRI4
+CNSTI4 255
+LEI4 $487
+ADDRLP4 156
+CNSTI4 255
+ASGNI4
+LABELV $487
+ADDRLP4 0+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+20
+CNSTU1 0
+ASGNU1
+ADDRLP4 0+20+1
+CNSTU1 0
+ASGNU1
+ADDRLP4 0+20+2
+CNSTU1 0
+ASGNU1
+ADDRLP4 0+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+24+20
+CNSTU1 0
+ASGNU1
+ADDRLP4 0+24+20+1
+CNSTU1 0
+ASGNU1
+ADDRLP4 0+24+20+2
+CNSTU1 0
+ASGNU1
+ADDRLP4 0+24+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+12
+ADDRLP4 184
+INDIRF4
+ASGNF4
+ADDRLP4 0+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 268
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ADDRLP4 156
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 272
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 268
+INDIRF4
+ADDRLP4 272
+INDIRF4
+LTF4 $523
+ADDRLP4 264
+ADDRLP4 268
+INDIRF4
+ADDRLP4 272
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $524
+JUMPV
+LABELV $523
+ADDRLP4 264
+ADDRLP4 268
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $524
+ADDRLP4 0+48+20
+ADDRLP4 264
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 280
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+ADDRLP4 156
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 284
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 280
+INDIRF4
+ADDRLP4 284
+INDIRF4
+LTF4 $529
+ADDRLP4 276
+ADDRLP4 280
+INDIRF4
+ADDRLP4 284
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $530
+JUMPV
+LABELV $529
+ADDRLP4 276
+ADDRLP4 280
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $530
+ADDRLP4 0+48+20+1
+ADDRLP4 276
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 292
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+ADDRLP4 156
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 296
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 292
+INDIRF4
+ADDRLP4 296
+INDIRF4
+LTF4 $535
+ADDRLP4 288
+ADDRLP4 292
+INDIRF4
+ADDRLP4 296
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $536
+JUMPV
+LABELV $535
+ADDRLP4 288
+ADDRLP4 292
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $536
+ADDRLP4 0+48+20+2
+ADDRLP4 288
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+48+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+12
+ADDRLP4 184
+INDIRF4
+ASGNF4
+ADDRLP4 0+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 304
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ADDRLP4 156
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 308
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 304
+INDIRF4
+ADDRLP4 308
+INDIRF4
+LTF4 $548
+ADDRLP4 300
+ADDRLP4 304
+INDIRF4
+ADDRLP4 308
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $549
+JUMPV
+LABELV $548
+ADDRLP4 300
+ADDRLP4 304
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $549
+ADDRLP4 0+72+20
+ADDRLP4 300
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 316
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+ADDRLP4 156
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 320
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 316
+INDIRF4
+ADDRLP4 320
+INDIRF4
+LTF4 $554
+ADDRLP4 312
+ADDRLP4 316
+INDIRF4
+ADDRLP4 320
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $555
+JUMPV
+LABELV $554
+ADDRLP4 312
+ADDRLP4 316
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $555
+ADDRLP4 0+72+20+1
+ADDRLP4 312
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 328
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+ADDRLP4 156
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 332
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 328
+INDIRF4
+ADDRLP4 332
+INDIRF4
+LTF4 $560
+ADDRLP4 324
+ADDRLP4 328
+INDIRF4
+ADDRLP4 332
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $561
+JUMPV
+LABELV $560
+ADDRLP4 324
+ADDRLP4 328
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $561
+ADDRLP4 0+72+20+2
+ADDRLP4 324
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 132
+ARGP4
+ADDRLP4 144
+ARGP4
+ADDRLP4 172
+ARGP4
+CNSTF4 1106247680
+ARGF4
+ADDRGP4 RotatePointAroundVector
+CALLV
+pop
+ADDRLP4 120
+ARGP4
+ADDRLP4 144
+ARGP4
+ADDRLP4 160
+ARGP4
+CNSTF4 1106247680
+ARGF4
+ADDRGP4 RotatePointAroundVector
+CALLV
+pop
+ADDRLP4 336
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 108
+INDIRF4
+ADDRLP4 132
+INDIRF4
+ADDRLP4 336
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 108+4
+INDIRF4
+ADDRLP4 132+4
+INDIRF4
+ADDRLP4 336
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 108+8
+INDIRF4
+ADDRLP4 132+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24
+ADDRLP4 108
+INDIRF4
+ADDRLP4 132
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRLP4 108+4
+INDIRF4
+ADDRLP4 132+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+8
+ADDRLP4 108+8
+INDIRF4
+ADDRLP4 132+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48
+ADDRLP4 96
+INDIRF4
+ADDRLP4 120
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+4
+ADDRLP4 96+4
+INDIRF4
+ADDRLP4 120+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+8
+ADDRLP4 96+8
+INDIRF4
+ADDRLP4 120+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72
+ADDRLP4 96
+INDIRF4
+ADDRLP4 120
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72+4
+ADDRLP4 96+4
+INDIRF4
+ADDRLP4 120+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72+8
+ADDRLP4 96+8
+INDIRF4
+ADDRLP4 120+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddPolyBatched
+CALLV
+pop
+ADDRLP4 132
+ARGP4
+ADDRLP4 144
+ARGP4
+ADDRLP4 172
+ARGP4
+CNSTF4 3253731328
+ARGF4
+ADDRGP4 RotatePointAroundVector
+CALLV
+pop
+ADDRLP4 120
+ARGP4
+ADDRLP4 144
+ARGP4
+ADDRLP4 160
+ARGP4
+CNSTF4 3253731328
+ARGF4
+ADDRGP4 RotatePointAroundVector
+CALLV
+pop
+ADDRLP4 340
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 108
+INDIRF4
+ADDRLP4 132
+INDIRF4
+ADDRLP4 340
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 108+4
+INDIRF4
+ADDRLP4 132+4
+INDIRF4
+ADDRLP4 340
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 108+8
+INDIRF4
+ADDRLP4 132+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24
+ADDRLP4 108
+INDIRF4
+ADDRLP4 132
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRLP4 108+4
+INDIRF4
+ADDRLP4 132+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+8
+ADDRLP4 108+8
+INDIRF4
+ADDRLP4 132+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48
+ADDRLP4 96
+INDIRF4
+ADDRLP4 120
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+4
+ADDRLP4 96+4
+INDIRF4
+ADDRLP4 120+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+8
+ADDRLP4 96+8
+INDIRF4
+ADDRLP4 120+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72
+ADDRLP4 96
+INDIRF4
+ADDRLP4 120
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72+4
+ADDRLP4 96+4
+INDIRF4
+ADDRLP4 120+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72+8
+ADDRLP4 96+8
+INDIRF4
+ADDRLP4 120+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddPolyBatched
+CALLV
+pop
+LABELV $451
+endproc CG_AddTrailTracedRGB 344 28
+export CG_CalcNormAxis
+proc CG_CalcNormAxis 20 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $632
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 0
+LEF4 $634
+ADDRLP4 12
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 3212836864
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ASGNF4
+LABELV $634
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0+4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+NEGF4
+ADDRLP4 0+8
+INDIRF4
+DIVF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRGP4 $633
+JUMPV
+LABELV $632
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $633
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+LABELV $631
+endproc CG_CalcNormAxis 20 12
+data
+align 4
+LABELV $721
+byte 4 3238002688
+byte 4 3238002688
+byte 4 3238002688
+align 4
+LABELV $722
+byte 4 1090519040
+byte 4 1090519040
+byte 4 1090519040
+export CG_AddWaterBeam
+code
+proc CG_AddWaterBeam 404 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $646
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 150
+LEI4 $646
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 348
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 360
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 292
+ARGP4
+ADDRLP4 348
+ARGP4
+ADDRLP4 388
+CNSTP4 0
+ASGNP4
+ADDRLP4 388
+INDIRP4
+ARGP4
+ADDRLP4 388
+INDIRP4
+ARGP4
+ADDRLP4 360
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 292+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $653
+ADDRLP4 292+4
+INDIRI4
+CNSTI4 0
+EQI4 $649
+LABELV $653
+ADDRLP4 292+44
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+NEI4 $645
+CNSTI4 6
+ARGI4
+ADDRLP4 292+52
+INDIRI4
+CNSTI4 1022
+NEI4 $663
+ADDRLP4 292+24+8
+INDIRF4
+CNSTF4 1061997773
+LEF4 $663
+ADDRLP4 392
+CNSTI4 1
+ASGNI4
+ADDRGP4 $664
+JUMPV
+LABELV $663
+ADDRLP4 392
+CNSTI4 0
+ASGNI4
+LABELV $664
+ADDRLP4 392
+INDIRI4
+ARGI4
+ADDRLP4 292+12
+ARGP4
+ADDRLP4 292+24
+ARGP4
+ADDRLP4 396
+CNSTI4 0
+ASGNI4
+ADDRLP4 396
+INDIRI4
+ARGI4
+ADDRLP4 396
+INDIRI4
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+ADDRGP4 $645
+JUMPV
+LABELV $649
+LABELV $646
+ADDRLP4 292
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 292
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $665
+ADDRLP4 292
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $665
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 292
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 150
+LEI4 $665
+ADDRLP4 296
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 296
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 296
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 300
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 300
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 300
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $665
+ADDRLP4 296
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 296
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $668
+ADDRLP4 296
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $668
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 296
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 150
+LEI4 $668
+ADDRLP4 300
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 300
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 300
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 304
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 304
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 304
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $668
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $671
+ADDRLP4 300
+CNSTI4 808
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 300
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $673
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 300
+INDIRP4
+ARGP4
+ADDRLP4 304
+ARGP4
+ADDRGP4 CG_GetWaterMuzzle
+CALLV
+pop
+ADDRLP4 316
+ADDRLP4 300
+INDIRP4
+ASGNP4
+ADDRLP4 108
+CNSTI4 1836
+ADDRLP4 316
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+132
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 304
+INDIRF4
+ADDRLP4 316
+INDIRP4
+CNSTI4 720
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 304+4
+INDIRF4
+ADDRLP4 316
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 304+8
+INDIRF4
+ADDRLP4 316
+INDIRP4
+CNSTI4 728
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1065017672
+GEF4 $674
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $681
+ADDRLP4 320
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 320
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 320
+INDIRP4
+ASGNP4
+LABELV $681
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $674
+JUMPV
+LABELV $673
+ADDRLP4 108
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $674
+ADDRLP4 120
+CNSTF4 1069547520
+ASGNF4
+ADDRGP4 $672
+JUMPV
+LABELV $671
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+ADDRGP4 cg+107612
+INDIRI4
+ARGI4
+ADDRLP4 108
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 50
+LEI4 $684
+ADDRLP4 120
+CNSTF4 1082130432
+ASGNF4
+ADDRGP4 $685
+JUMPV
+LABELV $684
+ADDRLP4 120
+CNSTF4 1008981770
+CNSTF4 1075838976
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+MULF4
+CNSTF4 1069547520
+ADDF4
+ASGNF4
+LABELV $685
+LABELV $672
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+ADDRGP4 cg+107612
+INDIRI4
+ARGI4
+ADDRLP4 96
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 268
+ADDRLP4 96
+INDIRF4
+ADDRLP4 108
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 268+4
+ADDRLP4 96+4
+INDIRF4
+ADDRLP4 108+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 268+8
+ADDRLP4 96+8
+INDIRF4
+ADDRLP4 108+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 304
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 304
+INDIRU4
+EQU4 $697
+ADDRLP4 304
+INDIRU4
+CNSTU4 0
+NEU4 $695
+ADDRLP4 268
+ARGP4
+ADDRLP4 308
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 308
+INDIRF4
+CNSTF4 1124073472
+LEF4 $695
+LABELV $697
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 280
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+ADDRGP4 cg+107612
+INDIRI4
+ARGI4
+ADDRLP4 152
+ARGP4
+ADDRGP4 BG_EvaluateTrajectoryDelta
+CALLV
+pop
+ADDRLP4 152
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 124
+ADDRLP4 120
+INDIRF4
+ASGNF4
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 70
+LEI4 $699
+ADDRLP4 316
+CNSTF4 3271557120
+ASGNF4
+ADDRLP4 108
+ADDRLP4 96
+INDIRF4
+ADDRLP4 316
+INDIRF4
+ADDRLP4 152
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 108+4
+ADDRLP4 96+4
+INDIRF4
+ADDRLP4 316
+INDIRF4
+ADDRLP4 152+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 108+8
+ADDRLP4 96+8
+INDIRF4
+CNSTF4 3271557120
+ADDRLP4 152+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $699
+ADDRLP4 268
+ADDRLP4 96
+INDIRF4
+ADDRLP4 108
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 268+4
+ADDRLP4 96+4
+INDIRF4
+ADDRLP4 108+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 268+8
+ADDRLP4 96+8
+INDIRF4
+ADDRLP4 108+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $696
+JUMPV
+LABELV $695
+ADDRLP4 280
+CNSTI4 255
+ASGNI4
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 50
+LEI4 $714
+ADDRLP4 124
+CNSTF4 1082130432
+ASGNF4
+ADDRGP4 $715
+JUMPV
+LABELV $714
+ADDRLP4 124
+CNSTF4 1008981770
+CNSTF4 1075838976
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+MULF4
+CNSTF4 1069547520
+ADDF4
+ASGNF4
+LABELV $715
+LABELV $696
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 100
+ADDI4
+LEI4 $718
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 140
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 312
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRGP4 $721
+ARGP4
+ADDRGP4 $722
+ARGP4
+ADDRLP4 96
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 312+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $723
+ADDRLP4 376
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 376
+INDIRU4
+CNSTU4 0
+EQU4 $726
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 376
+INDIRU4
+EQU4 $726
+ADDRLP4 380
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 380
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 380
+INDIRP4
+ASGNP4
+LABELV $726
+ADDRLP4 388
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 388
+INDIRU4
+CNSTU4 0
+EQU4 $728
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 388
+INDIRU4
+EQU4 $728
+ADDRLP4 392
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 392
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 392
+INDIRP4
+ASGNP4
+LABELV $728
+ADDRLP4 312+44
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+NEI4 $730
+CNSTI4 6
+ARGI4
+ADDRLP4 312+52
+INDIRI4
+CNSTI4 1022
+NEI4 $739
+ADDRLP4 312+24+8
+INDIRF4
+CNSTF4 1061997773
+LEF4 $739
+ADDRLP4 396
+CNSTI4 1
+ASGNI4
+ADDRGP4 $740
+JUMPV
+LABELV $739
+ADDRLP4 396
+CNSTI4 0
+ASGNI4
+LABELV $740
+ADDRLP4 396
+INDIRI4
+ARGI4
+ADDRLP4 312+12
+ARGP4
+ADDRLP4 312+24
+ARGP4
+ADDRLP4 400
+CNSTI4 0
+ASGNI4
+ADDRLP4 400
+INDIRI4
+ARGI4
+ADDRLP4 400
+INDIRI4
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+LABELV $730
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $645
+JUMPV
+LABELV $723
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+LABELV $718
+ADDRLP4 0+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+24+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+72+20+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 500
+SUBI4
+LEI4 $771
+ADDRLP4 312
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 316
+CNSTF4 1140457472
+ASGNF4
+ADDRLP4 284
+CNSTF4 1132396544
+ADDRLP4 312
+INDIRP4
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ADDRLP4 316
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRLP4 280
+ADDRLP4 280
+INDIRI4
+CVIF4 4
+ADDRLP4 312
+INDIRP4
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRLP4 316
+INDIRF4
+DIVF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $772
+JUMPV
+LABELV $771
+ADDRLP4 284
+CNSTI4 255
+ASGNI4
+LABELV $772
+ADDRLP4 268
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 176
+ADDRLP4 268
+INDIRB
+ASGNB 12
+ADDRLP4 164
+ADDRLP4 268
+INDIRB
+ASGNB 12
+ADDRLP4 316
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 316
+INDIRU4
+CNSTU4 0
+EQU4 $776
+ADDRLP4 316
+INDIRU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+EQU4 $776
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+ADDRGP4 cg+107612
+INDIRI4
+ARGI4
+ADDRLP4 140
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 164
+ADDRLP4 140
+INDIRF4
+ADDRLP4 96
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 164+4
+ADDRLP4 140+4
+INDIRF4
+ADDRLP4 96+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 164+8
+ADDRLP4 140+8
+INDIRF4
+ADDRLP4 96+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 164
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+LABELV $776
+ADDRLP4 176
+ARGP4
+ADDRLP4 232
+ARGP4
+ADDRGP4 CG_CalcNormAxis
+CALLV
+pop
+ADDRLP4 164
+ARGP4
+ADDRLP4 196
+ARGP4
+ADDRGP4 CG_CalcNormAxis
+CALLV
+pop
+ADDRLP4 0+20
+ADDRLP4 280
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+20+1
+ADDRLP4 280
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+20+2
+ADDRLP4 280
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+24+20
+ADDRLP4 280
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+24+20+1
+ADDRLP4 280
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+24+20+2
+ADDRLP4 280
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+48+20
+ADDRLP4 284
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+48+20+1
+ADDRLP4 284
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+48+20+2
+ADDRLP4 284
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20
+ADDRLP4 284
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+1
+ADDRLP4 284
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+2
+ADDRLP4 284
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 320
+CNSTF4 0
+ASGNF4
+ADDRLP4 188
+ADDRLP4 320
+INDIRF4
+ASGNF4
+ADDRLP4 128
+ADDRLP4 320
+INDIRF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 320
+INDIRF4
+ASGNF4
+ADDRLP4 128+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 232
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRGP4 VectorRotateTMatrix
+CALLV
+pop
+ADDRLP4 128
+ARGP4
+ADDRLP4 196
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRGP4 VectorRotateTMatrix
+CALLV
+pop
+ADDRLP4 192
+CNSTI4 0
+ASGNI4
+LABELV $816
+ADDRLP4 176
+ADDRLP4 152
+INDIRB
+ASGNB 12
+ADDRLP4 164
+ADDRLP4 140
+INDIRB
+ASGNB 12
+ADDRLP4 188
+ADDRLP4 188
+INDIRF4
+CNSTF4 1065749138
+ADDF4
+ASGNF4
+ADDRLP4 128
+CNSTF4 0
+ASGNF4
+ADDRLP4 188
+INDIRF4
+ARGF4
+ADDRLP4 324
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 324
+INDIRF4
+ASGNF4
+ADDRLP4 188
+INDIRF4
+ARGF4
+ADDRLP4 328
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 328
+INDIRF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 232
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRGP4 VectorRotateTMatrix
+CALLV
+pop
+ADDRLP4 128
+ARGP4
+ADDRLP4 196
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRGP4 VectorRotateTMatrix
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 108
+INDIRF4
+ADDRLP4 176
+INDIRF4
+ADDRLP4 120
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 108+4
+INDIRF4
+ADDRLP4 176+4
+INDIRF4
+ADDRLP4 120
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 108+8
+INDIRF4
+ADDRLP4 176+8
+INDIRF4
+ADDRLP4 120
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24
+ADDRLP4 108
+INDIRF4
+ADDRLP4 152
+INDIRF4
+ADDRLP4 120
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRLP4 108+4
+INDIRF4
+ADDRLP4 152+4
+INDIRF4
+ADDRLP4 120
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+8
+ADDRLP4 108+8
+INDIRF4
+ADDRLP4 152+8
+INDIRF4
+ADDRLP4 120
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48
+ADDRLP4 96
+INDIRF4
+ADDRLP4 140
+INDIRF4
+ADDRLP4 124
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+4
+ADDRLP4 96+4
+INDIRF4
+ADDRLP4 140+4
+INDIRF4
+ADDRLP4 124
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+8
+ADDRLP4 96+8
+INDIRF4
+ADDRLP4 140+8
+INDIRF4
+ADDRLP4 124
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72
+ADDRLP4 96
+INDIRF4
+ADDRLP4 164
+INDIRF4
+ADDRLP4 124
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72+4
+ADDRLP4 96+4
+INDIRF4
+ADDRLP4 164+4
+INDIRF4
+ADDRLP4 124
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72+8
+ADDRLP4 96+8
+INDIRF4
+ADDRLP4 164+8
+INDIRF4
+ADDRLP4 124
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cgs+160652+744
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddPolyBatched
+CALLV
+pop
+LABELV $817
+ADDRLP4 192
+ADDRLP4 192
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 6
+LTI4 $816
+LABELV $645
+endproc CG_AddWaterBeam 404 28
+export CG_AddPumperTrail
+proc CG_AddPumperTrail 276 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 228
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 184
+CNSTF4 1132396544
+ADDRLP4 228
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ADDRLP4 228
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+24+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+72+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 136
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136
+ARGP4
+ADDRLP4 240
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 164
+ADDRLP4 240
+INDIRF4
+ASGNF4
+ADDRLP4 136
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 136
+ARGP4
+ADDRLP4 188
+ARGP4
+ADDRGP4 CG_CalcNormAxis
+CALLV
+pop
+ADDRLP4 244
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 136
+ADDRLP4 244
+INDIRF4
+ADDRLP4 136
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 136+4
+ADDRLP4 244
+INDIRF4
+ADDRLP4 136+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 136+8
+CNSTF4 1098907648
+ADDRLP4 136+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 248
+CNSTF4 0
+ASGNF4
+ADDRLP4 168
+ADDRLP4 248
+INDIRF4
+ASGNF4
+ADDRLP4 168+4
+ADDRLP4 248
+INDIRF4
+ASGNF4
+ADDRLP4 168+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 168
+ARGP4
+ADDRLP4 188
+ARGP4
+ADDRLP4 120
+ARGP4
+ADDRGP4 VectorRotateTMatrix
+CALLV
+pop
+ADDRLP4 96
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 180
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 160
+CNSTF4 0
+ASGNF4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+48+20
+ADDRLP4 132
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+48+20+1
+ADDRLP4 132
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+48+20+2
+ADDRLP4 132
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20
+ADDRLP4 132
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+1
+ADDRLP4 132
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+2
+ADDRLP4 132
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+LABELV $912
+ADDRLP4 148
+ADDRLP4 120
+INDIRB
+ASGNB 12
+ADDRLP4 108
+ADDRLP4 96
+INDIRB
+ASGNB 12
+ADDRLP4 0+20
+ADDRLP4 0+48+20
+INDIRB
+ASGNB 12
+ADDRLP4 0+24+20
+ADDRLP4 0+72+20
+INDIRB
+ASGNB 12
+ADDRLP4 160
+INDIRF4
+CNSTF4 1045220557
+ADDRLP4 164
+INDIRF4
+MULF4
+LEF4 $923
+ADDRLP4 256
+ADDRLP4 184
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $924
+JUMPV
+LABELV $923
+ADDRLP4 256
+CNSTF4 1084227584
+ADDRLP4 184
+INDIRI4
+CVIF4 4
+ADDRLP4 160
+INDIRF4
+MULF4
+ADDRLP4 164
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+LABELV $924
+ADDRLP4 132
+ADDRLP4 256
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+48+20
+ADDRLP4 132
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+48+20+1
+ADDRLP4 132
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+48+20+2
+ADDRLP4 132
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20
+ADDRLP4 132
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+1
+ADDRLP4 132
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+2
+ADDRLP4 132
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 180
+ADDRLP4 180
+INDIRF4
+CNSTF4 1059117436
+ADDF4
+ASGNF4
+ADDRLP4 168
+CNSTF4 0
+ASGNF4
+ADDRLP4 180
+INDIRF4
+ARGF4
+ADDRLP4 260
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 168+4
+ADDRLP4 260
+INDIRF4
+ASGNF4
+ADDRLP4 180
+INDIRF4
+ARGF4
+ADDRLP4 264
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 168+8
+ADDRLP4 264
+INDIRF4
+ASGNF4
+ADDRLP4 168
+ARGP4
+ADDRLP4 188
+ARGP4
+ADDRLP4 120
+ARGP4
+ADDRGP4 VectorRotateTMatrix
+CALLV
+pop
+ADDRLP4 160
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ADDRLP4 164
+INDIRF4
+LEF4 $943
+ADDRLP4 268
+ADDRLP4 164
+INDIRF4
+ADDRLP4 160
+INDIRF4
+SUBF4
+CNSTF4 1098907648
+DIVF4
+ASGNF4
+ADDRLP4 136
+ADDRLP4 136
+INDIRF4
+ADDRLP4 268
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 136+4
+ADDRLP4 136+4
+INDIRF4
+ADDRLP4 268
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 136+8
+ADDRLP4 136+8
+INDIRF4
+ADDRLP4 164
+INDIRF4
+ADDRLP4 160
+INDIRF4
+SUBF4
+CNSTF4 1098907648
+DIVF4
+MULF4
+ASGNF4
+LABELV $943
+ADDRLP4 160
+ADDRLP4 160
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRLP4 96
+ADDRLP4 108
+INDIRF4
+ADDRLP4 136
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 108+4
+INDIRF4
+ADDRLP4 136+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 96+8
+ADDRLP4 108+8
+INDIRF4
+ADDRLP4 136+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 272
+CNSTF4 1086324736
+ASGNF4
+ADDRLP4 0
+ADDRLP4 108
+INDIRF4
+ADDRLP4 272
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 108+4
+INDIRF4
+ADDRLP4 272
+INDIRF4
+ADDRLP4 148+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 108+8
+INDIRF4
+CNSTF4 1086324736
+ADDRLP4 148+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24
+ADDRLP4 108
+INDIRF4
+CNSTF4 3233808384
+ADDRLP4 148
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRLP4 108+4
+INDIRF4
+CNSTF4 3233808384
+ADDRLP4 148+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+8
+ADDRLP4 108+8
+INDIRF4
+CNSTF4 3233808384
+ADDRLP4 148+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48
+ADDRLP4 96
+INDIRF4
+CNSTF4 3233808384
+ADDRLP4 120
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+4
+ADDRLP4 96+4
+INDIRF4
+CNSTF4 3233808384
+ADDRLP4 120+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+8
+ADDRLP4 96+8
+INDIRF4
+CNSTF4 3233808384
+ADDRLP4 120+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72
+ADDRLP4 96
+INDIRF4
+CNSTF4 1086324736
+ADDRLP4 120
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72+4
+ADDRLP4 96+4
+INDIRF4
+CNSTF4 1086324736
+ADDRLP4 120+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72+8
+ADDRLP4 96+8
+INDIRF4
+CNSTF4 1086324736
+ADDRLP4 120+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cgs+160652+764
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddPolyBatched
+CALLV
+pop
+LABELV $913
+ADDRLP4 160
+INDIRF4
+ADDRLP4 164
+INDIRF4
+LTF4 $912
+LABELV $857
+endproc CG_AddPumperTrail 276 12
+export CG_AddBoomiesExplosion
+proc CG_AddBoomiesExplosion 61 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTF4 1073741824
+CNSTF4 1065772646
+ADDRLP4 4
+INDIRF4
+SUBF4
+MULF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 AxisScale
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+160652+880
+INDIRI4
+ASGNI4
+CNSTF4 1078530011
+ADDRLP4 4
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTF4 1128792064
+ADDRLP4 16
+INDIRF4
+MULF4
+CNSTF4 1101004800
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1048576000
+LEF4 $998
+ADDRLP4 24
+CNSTF4 1132396544
+ASGNF4
+ADDRGP4 $999
+JUMPV
+LABELV $998
+ADDRLP4 24
+CNSTF4 1149173760
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $999
+ADDRLP4 32
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 32
+INDIRF4
+LTF4 $996
+ADDRLP4 20
+ADDRLP4 24
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $997
+JUMPV
+LABELV $996
+ADDRLP4 20
+ADDRLP4 24
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $997
+ADDRLP4 40
+ADDRLP4 20
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 40
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 40
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 40
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntityBatched
+CALLV
+pop
+ADDRLP4 4
+INDIRF4
+CNSTF4 1050253722
+LEF4 $1000
+ADDRLP4 4
+CNSTF4 1077936128
+ADDRLP4 4
+INDIRF4
+CNSTF4 1050253722
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1065353216
+LEF4 $1002
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+LABELV $1002
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cgs+160652+876
+INDIRI4
+ASGNI4
+ADDRLP4 48
+CNSTF4 1132396544
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 52
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 52
+INDIRF4
+LTF4 $1007
+ADDRLP4 44
+ADDRLP4 48
+INDIRF4
+ADDRLP4 52
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1008
+JUMPV
+LABELV $1007
+ADDRLP4 44
+ADDRLP4 48
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1008
+ADDRLP4 60
+ADDRLP4 44
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 60
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 60
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 60
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntityBatched
+CALLV
+pop
+LABELV $1000
+LABELV $990
+endproc CG_AddBoomiesExplosion 61 12
+export CG_AddImperiusBoom
+proc CG_AddImperiusBoom 81 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTF4 1092616192
+CNSTF4 1065772646
+ADDRLP4 4
+INDIRF4
+SUBF4
+MULF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 AxisScale
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+160652+772
+INDIRI4
+ASGNI4
+CNSTF4 1078530011
+ADDRLP4 4
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTF4 1128792064
+ADDRLP4 16
+INDIRF4
+MULF4
+CNSTF4 1101004800
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1048576000
+LEF4 $1017
+ADDRLP4 24
+CNSTF4 1132396544
+ASGNF4
+ADDRGP4 $1018
+JUMPV
+LABELV $1017
+ADDRLP4 24
+CNSTF4 1149173760
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1018
+ADDRLP4 32
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 32
+INDIRF4
+LTF4 $1015
+ADDRLP4 20
+ADDRLP4 24
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1016
+JUMPV
+LABELV $1015
+ADDRLP4 20
+ADDRLP4 24
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1016
+ADDRLP4 40
+ADDRLP4 20
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 40
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 40
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 40
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntityBatched
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cgs+160652+816
+INDIRI4
+ASGNI4
+ADDRLP4 48
+CNSTF4 1132396544
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 52
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 52
+INDIRF4
+LTF4 $1022
+ADDRLP4 44
+ADDRLP4 48
+INDIRF4
+ADDRLP4 52
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1023
+JUMPV
+LABELV $1022
+ADDRLP4 44
+ADDRLP4 48
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1023
+ADDRLP4 60
+ADDRLP4 44
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 60
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 60
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 60
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntityBatched
+CALLV
+pop
+ADDRLP4 4
+INDIRF4
+CNSTF4 1050253722
+LEF4 $1024
+ADDRLP4 4
+CNSTF4 1077936128
+ADDRLP4 4
+INDIRF4
+CNSTF4 1050253722
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1065353216
+LEF4 $1026
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+LABELV $1026
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cgs+160652+812
+INDIRI4
+ASGNI4
+ADDRLP4 68
+CNSTF4 1132396544
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 72
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+LTF4 $1031
+ADDRLP4 64
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1032
+JUMPV
+LABELV $1031
+ADDRLP4 64
+ADDRLP4 68
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1032
+ADDRLP4 80
+ADDRLP4 64
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 80
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 80
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 80
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntityBatched
+CALLV
+pop
+LABELV $1024
+LABELV $1009
+endproc CG_AddImperiusBoom 81 12
+export CG_AddImperiusRings
+proc CG_AddImperiusRings 108 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 1132396544
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 60
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 60
+INDIRF4
+LTF4 $1036
+ADDRLP4 48
+ADDRLP4 56
+INDIRF4
+ADDRLP4 60
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1037
+JUMPV
+LABELV $1036
+ADDRLP4 48
+ADDRLP4 56
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1037
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 48
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 72
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+LTF4 $1039
+ADDRLP4 64
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1040
+JUMPV
+LABELV $1039
+ADDRLP4 64
+ADDRLP4 68
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1040
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 64
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 84
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 80
+INDIRF4
+ADDRLP4 84
+INDIRF4
+LTF4 $1042
+ADDRLP4 76
+ADDRLP4 80
+INDIRF4
+ADDRLP4 84
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1043
+JUMPV
+LABELV $1042
+ADDRLP4 76
+ADDRLP4 80
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1043
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 76
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 92
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 96
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 92
+INDIRF4
+ADDRLP4 96
+INDIRF4
+LTF4 $1045
+ADDRLP4 88
+ADDRLP4 92
+INDIRF4
+ADDRLP4 96
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1046
+JUMPV
+LABELV $1045
+ADDRLP4 88
+ADDRLP4 92
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1046
+ADDRLP4 0
+INDIRP4
+CNSTI4 119
+ADDP4
+ADDRLP4 88
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 104
+CNSTI4 28
+ASGNI4
+ADDRLP4 44
+CNSTF4 1050253722
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 104
+INDIRI4
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+MULF4
+MULF4
+CNSTF4 1036831949
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 104
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 AxisCopy
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 AxisScale
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntityBatched
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 AxisCopy
+CALLV
+pop
+LABELV $1033
+endproc CG_AddImperiusRings 108 12
+export CG_AddTeleffect
+proc CG_AddTeleffect 33 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTF4 1067869798
+CNSTF4 1050253722
+ADDRLP4 4
+INDIRF4
+MULF4
+SUBF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 AxisScale
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+CNSTF4 1132396544
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 24
+INDIRF4
+LTF4 $1051
+ADDRLP4 16
+ADDRLP4 20
+INDIRF4
+ADDRLP4 24
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1052
+JUMPV
+LABELV $1051
+ADDRLP4 16
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1052
+ADDRLP4 32
+ADDRLP4 16
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 32
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 32
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 32
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntityBatched
+CALLV
+pop
+LABELV $1048
+endproc CG_AddTeleffect 33 12
+lit
+align 4
+LABELV $1054
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export CG_AddScorePlum
+code
+proc CG_AddScorePlum 172 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 112
+ADDRGP4 $1054
+INDIRB
+ASGNB 12
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+ASGNP4
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+GEI4 $1056
+ADDRLP4 8
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 17
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 17
+ASGNU1
+ADDRGP4 $1057
+JUMPV
+LABELV $1056
+ADDRLP4 8
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 12
+INDIRI4
+CNSTI4 50
+LTI4 $1058
+ADDRLP4 8
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRGP4 $1059
+JUMPV
+LABELV $1058
+ADDRLP4 12
+INDIRI4
+CNSTI4 20
+LTI4 $1060
+ADDRLP4 136
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRGP4 $1061
+JUMPV
+LABELV $1060
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+LTI4 $1062
+ADDRLP4 8
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRGP4 $1063
+JUMPV
+LABELV $1062
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LTI4 $1064
+ADDRLP4 136
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 136
+INDIRU1
+ASGNU1
+LABELV $1064
+LABELV $1063
+LABELV $1061
+LABELV $1059
+LABELV $1057
+ADDRLP4 80
+INDIRF4
+CNSTF4 1048576000
+GEF4 $1066
+ADDRLP4 136
+CNSTF4 1149173760
+ADDRLP4 80
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 136
+INDIRF4
+ADDRLP4 140
+INDIRF4
+LTF4 $1069
+ADDRLP4 132
+ADDRLP4 136
+INDIRF4
+ADDRLP4 140
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1070
+JUMPV
+LABELV $1069
+ADDRLP4 132
+ADDRLP4 136
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1070
+ADDRLP4 8
+INDIRP4
+CNSTI4 119
+ADDP4
+ADDRLP4 132
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRGP4 $1067
+JUMPV
+LABELV $1066
+ADDRLP4 8
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+LABELV $1067
+ADDRLP4 8
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 16+8
+ADDRLP4 16+8
+INDIRF4
+CNSTF4 1121714176
+CNSTF4 1120403456
+ADDRLP4 80
+INDIRF4
+MULF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 96
+ADDRGP4 cg+110648+24
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 96+4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 96+8
+ADDRGP4 cg+110648+24+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 96
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 28
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 80
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 144
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 28
+INDIRF4
+CNSTF4 1101004800
+ADDRLP4 144
+INDIRF4
+MULF4
+CNSTF4 3240099840
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 80
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 148
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+CNSTF4 1101004800
+ADDRLP4 148
+INDIRF4
+MULF4
+CNSTF4 3240099840
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 80
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 152
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 28+8
+INDIRF4
+CNSTF4 1101004800
+ADDRLP4 152
+INDIRF4
+MULF4
+CNSTF4 3240099840
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 84
+ADDRLP4 16
+INDIRF4
+ADDRGP4 cg+110648+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 84+4
+ADDRLP4 16+4
+INDIRF4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 84+8
+ADDRLP4 16+8
+INDIRF4
+ADDRGP4 cg+110648+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 84
+ARGP4
+ADDRLP4 156
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 156
+INDIRF4
+ASGNF4
+ADDRLP4 124
+INDIRF4
+CNSTF4 1101004800
+GEF4 $1102
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $1053
+JUMPV
+LABELV $1102
+ADDRLP4 160
+CNSTI4 0
+ASGNI4
+ADDRLP4 108
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 160
+INDIRI4
+GEI4 $1104
+ADDRLP4 108
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+NEGI4
+ASGNI4
+LABELV $1104
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1109
+JUMPV
+LABELV $1106
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 40
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+MODI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+DIVI4
+ASGNI4
+LABELV $1107
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1109
+ADDRLP4 164
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 164
+INDIRI4
+EQI4 $1106
+ADDRLP4 12
+INDIRI4
+ADDRLP4 164
+INDIRI4
+NEI4 $1106
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+EQI4 $1110
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 40
+ADDP4
+CNSTI4 10
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1110
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1115
+JUMPV
+LABELV $1112
+ADDRLP4 8
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 28
+INDIRF4
+CNSTF4 1090519040
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1073741824
+DIVF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+CNSTF4 1090519040
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1073741824
+DIVF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 28+8
+INDIRF4
+CNSTF4 1090519040
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1073741824
+DIVF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 168
+CNSTI4 2
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ADDRLP4 168
+INDIRI4
+LSHI4
+ADDRLP4 40
+ADDP4
+INDIRI4
+ADDRLP4 168
+INDIRI4
+LSHI4
+ADDRGP4 cgs+160652+228
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntityBatched
+CALLV
+pop
+LABELV $1113
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1115
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LTI4 $1112
+LABELV $1053
+endproc CG_AddScorePlum 172 12
+export CG_AddLocalEntities
+proc CG_AddLocalEntities 20 8
+ADDRLP4 0
+ADDRGP4 cg_activeLocalEntities
+INDIRP4
+ASGNP4
+ADDRGP4 $1126
+JUMPV
+LABELV $1123
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRGP4 cg_addingLocalEntity
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+LTI4 $1127
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $1124
+JUMPV
+LABELV $1127
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $1130
+ADDRLP4 12
+INDIRI4
+CNSTI4 17
+GTI4 $1130
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1152
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1152
+address $1131
+address $1136
+address $1135
+address $1137
+address $1138
+address $1148
+address $1139
+address $1149
+address $1150
+address $1140
+address $1141
+address $1142
+address $1143
+address $1144
+address $1145
+address $1146
+address $1147
+address $1151
+code
+LABELV $1130
+ADDRGP4 $1133
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $1131
+JUMPV
+LABELV $1135
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddSpriteExplosion
+CALLV
+pop
+ADDRGP4 $1131
+JUMPV
+LABELV $1136
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddExplosion
+CALLV
+pop
+ADDRGP4 $1131
+JUMPV
+LABELV $1137
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddFragment
+CALLV
+pop
+ADDRGP4 $1131
+JUMPV
+LABELV $1138
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddMoveScaleFade
+CALLV
+pop
+ADDRGP4 $1131
+JUMPV
+LABELV $1139
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddFadeRGB
+CALLV
+pop
+ADDRGP4 $1131
+JUMPV
+LABELV $1140
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddSprayTrailFade
+CALLV
+pop
+ADDRGP4 $1131
+JUMPV
+LABELV $1141
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddTrail
+CALLV
+pop
+ADDRGP4 $1131
+JUMPV
+LABELV $1142
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddTrailTracedRGB
+CALLV
+pop
+ADDRGP4 $1131
+JUMPV
+LABELV $1143
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddWaterBeam
+CALLV
+pop
+ADDRGP4 $1131
+JUMPV
+LABELV $1144
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddPumperTrail
+CALLV
+pop
+ADDRGP4 $1131
+JUMPV
+LABELV $1145
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddImperiusBoom
+CALLV
+pop
+ADDRGP4 $1131
+JUMPV
+LABELV $1146
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddImperiusRings
+CALLV
+pop
+ADDRGP4 $1131
+JUMPV
+LABELV $1147
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddTeleffect
+CALLV
+pop
+ADDRGP4 $1131
+JUMPV
+LABELV $1148
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddFallScaleFade
+CALLV
+pop
+ADDRGP4 $1131
+JUMPV
+LABELV $1149
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddScaleFade
+CALLV
+pop
+ADDRGP4 $1131
+JUMPV
+LABELV $1150
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddScorePlum
+CALLV
+pop
+ADDRGP4 $1131
+JUMPV
+LABELV $1151
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddBoomiesExplosion
+CALLV
+pop
+LABELV $1131
+LABELV $1124
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $1126
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg_activeLocalEntities
+CVPU4 4
+NEU4 $1123
+ADDRGP4 cg_addingLocalEntity
+CNSTP4 0
+ASGNP4
+ADDRGP4 CG_FlushSceneBatches
+CALLV
+pop
+LABELV $1122
+endproc CG_AddLocalEntities 20 8
+bss
+align 4
+LABELV cg_addingLocalEntity
+skip 4
+align 4
+LABELV cg_numLocalEntities
+skip 4
+export cg_freeLocalEntities
+align 4
+LABELV cg_freeLocalEntities
+skip 4
+export cg_activeLocalEntities
+align 4
+LABELV cg_activeLocalEntities
+skip 304
+export cg_localEntities
+align 4
+LABELV cg_localEntities
+skip 622592
+import CG_AddBoundingBox
+import CG_AddBoundingBoxEntity
+import CG_QueryCvar
+import CG_Timestamp
+import CG_LimitCvars
+import trap_RealTime
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import trap_R_inPVS
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_Cutscene2d_Draw
+import CG_Cutscene2d_UpdateTrans
+import CG_Cutscene2d_CheckCmd
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import Main_SpriteParticles
+import LaunchRevivalParticle
+import LaunchSpeedyPuffTrail
+import Init_SpriteParticles
+import AddLFsToScreen
+import AddLFToDrawList
+import Init_LensFlareSys
+import DumpPolyInfo
+import ActiveChooseLogoMenu
+import FindLogoForSpraying
+import Add_LogoToDrawList
+import AddLogosToScene
+import Init_SprayLogoSys
+import Calculate_2DOfDIR
+import Calculate_2DOf3D
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_ChangeLoadingProgress
+import CG_LoadingString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_ScorePlum
+import CG_TeleOutEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_GenerateParticles
+import CG_SmokePuff
+import CG_ImpactMark
+import CG_AddMarks
+import CG_PortalInView
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_GetWaterMuzzle
+import CG_SprayTrail
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponSRWC
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_Boomies_Explosion
+import CG_BamBam_Explosion
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_LerpTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayer
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_UpdateVoipTeamIDs
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Draw3DModel
+import CG_SetPrintString
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import CG_MessagePrint
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_WorldToScreen
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_DrawPic1024
+import CG_DrawRect1024
+import CG_FillRect1024
+import CG_AdjustFrom1024
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddPolyBatched
+import CG_AddRefEntityBatched
+import CG_FlushSceneBatches
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_ForceModelChange
+import CG_GetCvarFloat
+import CG_GetCvarInt
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StreamAssets
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_icons
+import cg_ambient
+import cg_drawBBox
+import cg_drawVoiceNames
+import cg_drawLensflare
+import cg_timestamps
+import cg_skyLensflare
+import cg_sky
+import cg_curWarmupReady
+import cg_warmupReady
+import cg_glowModelTeam
+import cg_glowModel
+import cg_cineDrawLetterBox
+import cg_cineHideHud
+import cg_LPSwallhackAlpha
+import cg_LPSwallhackSize
+import cg_bigScoreType
+import cg_thirdPersonAutoSwitch
+import cg_drawTimeLeft
+import cg_drawServerInfos
+import cg_drawMessages
+import cg_drawups
+import cg_wopFFAhud
+import cg_printDir
+import cg_drawRealTime
+import cg_correctedWeaponPos
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_streamAssets
+import cg_deferPlayers
+import cg_predictItems
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_chatBeep
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_optimizePrediction
+import cg_nopredict
+import cg_errorDecay
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import trailEnt
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $1133
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $113
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 76
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 0
+align 1
+LABELV $98
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 76
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
@@ -0,0 +1,15734 @@
+data
+align 4
+LABELV forceModelModificationCount
+byte 4 -1
+align 4
+LABELV glowModelModificationCount
+byte 4 -1
+align 4
+LABELV glowModelTeamModificationCount
+byte 4 -1
+align 4
+LABELV drawTeamOverlayModificationCount
+byte 4 -1
+export vmMain
+code
+proc vmMain 16 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $81
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+GTI4 $81
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $93
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $93
+address $83
+address $84
+address $85
+address $86
+address $87
+address $88
+address $89
+address $90
+address $91
+code
+LABELV $83
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_Init
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $80
+JUMPV
+LABELV $84
+ADDRGP4 CG_Shutdown
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $80
+JUMPV
+LABELV $85
+ADDRLP4 4
+ADDRGP4 CG_ConsoleCommand
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $80
+JUMPV
+LABELV $86
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawActiveFrame
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $80
+JUMPV
+LABELV $87
+ADDRLP4 8
+ADDRGP4 CG_CrosshairPlayer
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $80
+JUMPV
+LABELV $88
+ADDRLP4 12
+ADDRGP4 CG_LastAttacker
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $80
+JUMPV
+LABELV $89
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_KeyEvent
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $80
+JUMPV
+LABELV $90
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_MouseEvent
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $80
+JUMPV
+LABELV $91
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_EventHandling
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $80
+JUMPV
+LABELV $81
+ADDRGP4 $92
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $82
+CNSTI4 -1
+RETI4
+LABELV $80
+endproc vmMain 16 12
+data
+align 4
+LABELV cvarTable
+address cg_ignore
+address $95
+address $96
+byte 4 0
+address cg_autoswitch
+address $97
+address $98
+byte 4 1
+address cg_drawGun
+address $99
+address $98
+byte 4 1
+address cg_zoomFov
+address $100
+address $101
+byte 4 1
+address cg_fov
+address $102
+address $103
+byte 4 1
+address cg_shadows
+address $104
+address $98
+byte 4 1
+address cg_draw2D
+address $105
+address $98
+byte 4 1
+address cg_drawStatus
+address $106
+address $98
+byte 4 1
+address cg_drawTimer
+address $107
+address $96
+byte 4 1
+address cg_drawFPS
+address $108
+address $96
+byte 4 1
+address cg_drawSnapshot
+address $109
+address $96
+byte 4 1
+address cg_draw3dIcons
+address $110
+address $98
+byte 4 1
+address cg_drawIcons
+address $111
+address $98
+byte 4 1
+address cg_drawAmmoWarning
+address $112
+address $98
+byte 4 1
+address cg_drawAttacker
+address $113
+address $98
+byte 4 1
+address cg_drawCrosshair
+address $114
+address $98
+byte 4 1
+address cg_drawCrosshairNames
+address $115
+address $98
+byte 4 1
+address cg_drawRewards
+address $116
+address $98
+byte 4 1
+address cg_crosshairSize
+address $117
+address $118
+byte 4 1
+address cg_crosshairHealth
+address $119
+address $96
+byte 4 1
+address cg_crosshairX
+address $120
+address $96
+byte 4 1
+address cg_crosshairY
+address $121
+address $96
+byte 4 1
+address cg_simpleItems
+address $122
+address $96
+byte 4 1
+address cg_addMarks
+address $123
+address $98
+byte 4 1
+address cg_lagometer
+address $124
+address $96
+byte 4 1
+address cg_gun_x
+address $125
+address $96
+byte 4 512
+address cg_gun_y
+address $126
+address $96
+byte 4 512
+address cg_gun_z
+address $127
+address $96
+byte 4 512
+address cg_centertime
+address $128
+address $129
+byte 4 512
+address cg_runpitch
+address $130
+address $131
+byte 4 1
+address cg_runroll
+address $132
+address $133
+byte 4 1
+address cg_bobup
+address $134
+address $133
+byte 4 512
+address cg_bobpitch
+address $135
+address $131
+byte 4 1
+address cg_bobroll
+address $136
+address $131
+byte 4 1
+address cg_swingSpeed
+address $137
+address $138
+byte 4 512
+address cg_animSpeed
+address $139
+address $98
+byte 4 512
+address cg_debugAnim
+address $140
+address $96
+byte 4 512
+address cg_debugPosition
+address $141
+address $96
+byte 4 512
+address cg_debugEvents
+address $142
+address $96
+byte 4 512
+address cg_errorDecay
+address $143
+address $144
+byte 4 0
+address cg_nopredict
+address $145
+address $96
+byte 4 0
+address cg_optimizePrediction
+address $146
+address $98
+byte 4 1
+address cg_noPlayerAnims
+address $147
+address $96
+byte 4 512
+address cg_showmiss
+address $148
+address $96
+byte 4 0
+address cg_footsteps
+address $149
+address $98
+byte 4 512
+address cg_tracerChance
+address $150
+address $151
+byte 4 512
+address cg_tracerWidth
+address $152
+address $98
+byte 4 512
+address cg_tracerLength
+address $153
+address $144
+byte 4 512
+address cg_thirdPersonRange
+address $154
+address $144
+byte 4 512
+address cg_thirdPersonAngle
+address $155
+address $96
+byte 4 512
+address cg_thirdPerson
+address $156
+address $96
+byte 4 0
+address cg_chatBeep
+address $157
+address $158
+byte 4 1
+address cg_teamChatTime
+address $159
+address $160
+byte 4 1
+address cg_teamChatHeight
+address $161
+address $96
+byte 4 1
+address cg_forceModel
+address $162
+address $96
+byte 4 1
+address cg_predictItems
+address $163
+address $98
+byte 4 1
+address cg_deferPlayers
+address $164
+address $98
+byte 4 1
+address cg_streamAssets
+address $165
+address $98
+byte 4 1
+address cg_drawTeamOverlay
+address $166
+address $167
+byte 4 1
+address cg_teamOverlayUserinfo
+address $168
+address $96
+byte 4 66
+address cg_stats
+address $169
+address $96
+byte 4 0
+address cg_drawFriend
+address $170
+address $98
+byte 4 1
+address cg_teamChatsOnly
+address $171
+address $96
+byte 4 1
+address cg_buildScript
+address $172
+address $96
+byte 4 0
+address cg_paused
+address $173
+address $96
+byte 4 64
+address cg_synchronousClients
+address $174
+address $96
+byte 4 8
+address cg_cameraOrbit
+address $175
+address $96
+byte 4 512
+address cg_cameraOrbitDelay
+address $176
+address $177
+byte 4 1
+address cg_timescaleFadeEnd
+address $178
+address $98
+byte 4 0
+address cg_timescaleFadeSpeed
+address $179
+address $96
+byte 4 0
+address cg_timescale
+address $180
+address $98
+byte 4 0
+address cg_scorePlum
+address $181
+address $98
+byte 4 1
+address cg_smoothClients
+address $182
+address $96
+byte 4 3
+address cg_cameraMode
+address $183
+address $96
+byte 4 512
+address pmove_fixed
+address $184
+address $96
+byte 4 8
+address pmove_msec
+address $185
+address $186
+byte 4 8
+address cg_noTaunt
+address $187
+address $96
+byte 4 1
+address cg_noProjectileTrail
+address $188
+address $96
+byte 4 1
+address cg_smallFont
+address $189
+address $190
+byte 4 1
+address cg_bigFont
+address $191
+address $151
+byte 4 1
+address cg_correctedWeaponPos
+address $192
+address $98
+byte 4 1
+address cg_drawRealTime
+address $193
+address $96
+byte 4 1
+address cg_printDir
+address $194
+address $96
+byte 4 1
+address cg_wopFFAhud
+address $195
+address $96
+byte 4 1
+address cg_drawups
+address $196
+address $96
+byte 4 1
+address cg_drawMessages
+address $197
+address $98
+byte 4 1
+address cg_drawServerInfos
+address $198
+address $96
+byte 4 1
+address cg_drawTimeLeft
+address $199
+address $96
+byte 4 1
+address cg_thirdPersonAutoSwitch
+address $200
+address $96
+byte 4 1
+address cg_bigScoreType
+address $201
+address $96
+byte 4 0
+address cg_LPSwallhackSize
+address $202
+address $203
+byte 4 1
+address cg_LPSwallhackAlpha
+address $204
+address $203
+byte 4 1
+address cg_cineHideHud
+address $205
+address $96
+byte 4 256
+address cg_cineDrawLetterBox
+address $206
+address $96
+byte 4 256
+address cg_glowModel
+address $207
+address $208
+byte 4 1
+address cg_glowModelTeam
+address $209
+address $208
+byte 4 1
+address cg_warmupReady
+address $210
+address $208
+byte 4 8
+address cg_curWarmupReady
+address $211
+address $208
+byte 4 8
+address cg_sky
+address $212
+address $208
+byte 4 8
+address cg_skyLensflare
+address $213
+address $208
+byte 4 8
+address cg_timestamps
+address $214
+address $96
+byte 4 1
+address cg_drawLensflare
+address $215
+address $98
+byte 4 1
+address cg_drawVoiceNames
+address $216
+address $98
+byte 4 1
+address cg_drawBBox
+address $217
+address $96
+byte 4 512
+address cg_ambient
+address $218
+address $98
+byte 4 1
+address cg_icons
+address $219
+address $220
+byte 4 1
+lit
+align 4
+LABELV cvarTableSize
+byte 4 106
+export CG_GetCvarInt
+code
+proc CG_GetCvarInt 36 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+RETI4
+LABELV $221
+endproc CG_GetCvarInt 36 12
+export CG_GetCvarFloat
+proc CG_GetCvarFloat 36 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+RETF4
+LABELV $222
+endproc CG_GetCvarFloat 36 12
+proc CG_RegisterCvars 1036 16
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cvarTable
+ASGNP4
+ADDRGP4 $227
+JUMPV
+LABELV $224
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+LABELV $225
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+LABELV $227
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cvarTableSize
+INDIRI4
+LTI4 $224
+ADDRGP4 $228
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 1032
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31460
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+ADDRGP4 forceModelModificationCount
+ADDRGP4 cg_forceModel+4
+INDIRI4
+ASGNI4
+ADDRGP4 glowModelModificationCount
+ADDRGP4 cg_glowModel+4
+INDIRI4
+ASGNI4
+ADDRGP4 glowModelTeamModificationCount
+ADDRGP4 cg_glowModelTeam+4
+INDIRI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRGP4 $233
+ARGP4
+ADDRGP4 $234
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 $235
+ARGP4
+ADDRGP4 $234
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 $236
+ARGP4
+ADDRGP4 $234
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 $237
+ARGP4
+ADDRGP4 $234
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+LABELV $223
+endproc CG_RegisterCvars 1036 16
+export CG_ForceModelChange
+proc CG_ForceModelChange 12 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $239
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $243
+ADDRGP4 $240
+JUMPV
+LABELV $243
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_NewClientInfo
+CALLV
+pop
+LABELV $240
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $239
+LABELV $238
+endproc CG_ForceModelChange 12 4
+bss
+align 4
+LABELV $246
+skip 4
+export CG_UpdateCvars
+code
+proc CG_UpdateCvars 16 8
+ADDRLP4 12
+ADDRGP4 trap_Cvar_Generation
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 $246
+INDIRI4
+NEI4 $247
+ADDRGP4 $245
+JUMPV
+LABELV $247
+ADDRGP4 $246
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cvarTable
+ASGNP4
+ADDRGP4 $252
+JUMPV
+LABELV $249
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+LABELV $250
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+LABELV $252
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cvarTableSize
+INDIRI4
+LTI4 $249
+ADDRGP4 drawTeamOverlayModificationCount
+INDIRI4
+ADDRGP4 cg_drawTeamOverlay+4
+INDIRI4
+EQI4 $253
+ADDRGP4 drawTeamOverlayModificationCount
+ADDRGP4 cg_drawTeamOverlay+4
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawTeamOverlay+12
+INDIRI4
+CNSTI4 0
+LEI4 $257
+ADDRGP4 $168
+ARGP4
+ADDRGP4 $98
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $258
+JUMPV
+LABELV $257
+ADDRGP4 $168
+ARGP4
+ADDRGP4 $96
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $258
+LABELV $253
+ADDRGP4 forceModelModificationCount
+INDIRI4
+ADDRGP4 cg_forceModel+4
+INDIRI4
+EQI4 $260
+ADDRGP4 forceModelModificationCount
+ADDRGP4 cg_forceModel+4
+INDIRI4
+ASGNI4
+ADDRGP4 CG_ForceModelChange
+CALLV
+pop
+LABELV $260
+ADDRGP4 glowModelModificationCount
+INDIRI4
+ADDRGP4 cg_glowModel+4
+INDIRI4
+EQI4 $264
+ADDRGP4 glowModelModificationCount
+ADDRGP4 cg_glowModel+4
+INDIRI4
+ASGNI4
+ADDRGP4 CG_ForceModelChange
+CALLV
+pop
+LABELV $264
+ADDRGP4 glowModelTeamModificationCount
+INDIRI4
+ADDRGP4 cg_glowModelTeam+4
+INDIRI4
+EQI4 $268
+ADDRGP4 glowModelTeamModificationCount
+ADDRGP4 cg_glowModelTeam+4
+INDIRI4
+ASGNI4
+ADDRGP4 CG_ForceModelChange
+CALLV
+pop
+LABELV $268
+ADDRGP4 CG_LimitCvars
+CALLV
+pop
+LABELV $245
+endproc CG_UpdateCvars 16 8
+export CG_CrosshairPlayer
+proc CG_CrosshairPlayer 0 0
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 cg+131552
+INDIRI4
+CNSTI4 1000
+ADDI4
+LEI4 $273
+CNSTI4 -1
+RETI4
+ADDRGP4 $272
+JUMPV
+LABELV $273
+ADDRGP4 cg+131548
+INDIRI4
+RETI4
+LABELV $272
+endproc CG_CrosshairPlayer 0 0
+export CG_LastAttacker
+proc CG_LastAttacker 0 0
+ADDRGP4 cg+131564
+INDIRI4
+CNSTI4 0
+NEI4 $279
+CNSTI4 -1
+RETI4
+ADDRGP4 $278
+JUMPV
+LABELV $279
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 316
+ADDP4
+INDIRI4
+RETI4
+LABELV $278
+endproc CG_LastAttacker 0 0
+export CG_Printf
+proc CG_Printf 2080 16
+ADDRLP4 2048
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 1024
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2048
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 2048
+CNSTP4 0
+ASGNP4
+ADDRLP4 2068
+ADDRGP4 cg+108572
+ASGNP4
+ADDRLP4 2068
+INDIRP4
+ADDRLP4 2068
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 cg+108572
+INDIRI4
+CNSTI4 4
+LTI4 $286
+ADDRGP4 cg+108572
+CNSTI4 0
+ASGNI4
+LABELV $286
+ADDRGP4 cg+108572
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+108540
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 1024
+ARGP4
+ADDRGP4 $294
+ARGP4
+CNSTI4 12
+ARGI4
+ADDRLP4 2072
+ADDRGP4 Q_strncmp
+CALLI4
+ASGNI4
+ADDRLP4 2072
+INDIRI4
+CNSTI4 0
+NEI4 $292
+ADDRGP4 cg+108572
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+108556
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $293
+JUMPV
+LABELV $292
+ADDRGP4 cg+108572
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+108556
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+LABELV $293
+ADDRLP4 2052
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 CG_Timestamp
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 2052
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1024
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 2076
+CNSTI4 150
+ASGNI4
+ADDRLP4 2076
+INDIRI4
+ADDRGP4 cg+108572
+INDIRI4
+MULI4
+ADDRGP4 cg+107940
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 2076
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $283
+endproc CG_Printf 2080 16
+export CG_Error
+proc CG_Error 1028 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $304
+endproc CG_Error 1028 16
+export Com_Error
+proc Com_Error 1028 16
+ADDRLP4 0
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $306
+endproc Com_Error 1028 16
+export Com_Printf
+proc Com_Printf 1028 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $308
+endproc Com_Printf 1028 16
+bss
+align 1
+LABELV $311
+skip 1024
+export CG_Argv
+code
+proc CG_Argv 0 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $311
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRGP4 $311
+RETP4
+LABELV $310
+endproc CG_Argv 0 12
+proc CG_RegisterItemSounds 92 12
+ADDRLP4 76
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $313
+ADDRLP4 76
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+LABELV $313
+ADDRLP4 0
+ADDRLP4 76
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $317
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $319
+LABELV $317
+ADDRGP4 $312
+JUMPV
+LABELV $318
+ADDRLP4 72
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $322
+JUMPV
+LABELV $321
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $322
+ADDRLP4 84
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+EQI4 $324
+ADDRLP4 84
+INDIRI4
+CNSTI4 32
+NEI4 $321
+LABELV $324
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 72
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+GEI4 $327
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+GEI4 $325
+LABELV $327
+ADDRGP4 $328
+ARGP4
+ADDRLP4 76
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $312
+JUMPV
+LABELV $325
+ADDRLP4 8
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $329
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $329
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+LABELV $319
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $318
+LABELV $312
+endproc CG_RegisterItemSounds 92 12
+proc CG_RegisterSounds 512 16
+ADDRGP4 $334
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 332
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1420
+ADDRLP4 332
+INDIRI4
+ASGNI4
+ADDRGP4 $337
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 336
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1428
+ADDRLP4 336
+INDIRI4
+ASGNI4
+ADDRGP4 $340
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 340
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1424
+ADDRLP4 340
+INDIRI4
+ASGNI4
+ADDRGP4 $343
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 344
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1436
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRGP4 $347
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 348
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1436+4
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRGP4 $351
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 352
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1436+8
+ADDRLP4 352
+INDIRI4
+ASGNI4
+ADDRGP4 $354
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 356
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1724
+ADDRLP4 356
+INDIRI4
+ASGNI4
+ADDRGP4 $357
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 360
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1728
+ADDRLP4 360
+INDIRI4
+ASGNI4
+ADDRGP4 $360
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 364
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1732
+ADDRLP4 364
+INDIRI4
+ASGNI4
+ADDRGP4 $363
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 368
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1736
+ADDRLP4 368
+INDIRI4
+ASGNI4
+ADDRGP4 $366
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 372
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+692
+ADDRLP4 372
+INDIRI4
+ASGNI4
+ADDRGP4 $369
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 376
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+696
+ADDRLP4 376
+INDIRI4
+ASGNI4
+ADDRGP4 $372
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 380
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+700
+ADDRLP4 380
+INDIRI4
+ASGNI4
+ADDRGP4 $375
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 384
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1524
+ADDRLP4 384
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 3
+EQI4 $381
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 7
+EQI4 $381
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $376
+LABELV $381
+ADDRGP4 $384
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 388
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1448
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $388
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 392
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1448+4
+ADDRLP4 392
+INDIRI4
+ASGNI4
+ADDRGP4 $391
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 396
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1456
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRGP4 $394
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 400
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1492
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRGP4 $398
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 404
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1492+4
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRGP4 $402
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 408
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1492+8
+ADDRLP4 408
+INDIRI4
+ASGNI4
+ADDRGP4 $406
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 412
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1492+12
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+160652+1380
+ADDRGP4 cgs+160652+1732
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+160652+1380+4
+ADDRGP4 cgs+160652+1728
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+160652+1380+8
+ADDRGP4 cgs+160652+1724
+INDIRI4
+ASGNI4
+ADDRGP4 $424
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 416
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1380+12
+ADDRLP4 416
+INDIRI4
+ASGNI4
+ADDRGP4 $428
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 420
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1380+16
+ADDRLP4 420
+INDIRI4
+ASGNI4
+ADDRGP4 $432
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 424
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1380+20
+ADDRLP4 424
+INDIRI4
+ASGNI4
+ADDRGP4 $436
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 428
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1380+24
+ADDRLP4 428
+INDIRI4
+ASGNI4
+ADDRGP4 $440
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 432
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1380+28
+ADDRLP4 432
+INDIRI4
+ASGNI4
+ADDRGP4 $444
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 436
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1380+32
+ADDRLP4 436
+INDIRI4
+ASGNI4
+ADDRGP4 $448
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 440
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1380+36
+ADDRLP4 440
+INDIRI4
+ASGNI4
+ADDRGP4 $451
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 444
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1432
+ADDRLP4 444
+INDIRI4
+ASGNI4
+ADDRGP4 $454
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 448
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1580
+ADDRLP4 448
+INDIRI4
+ASGNI4
+ADDRGP4 $457
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 452
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1584
+ADDRLP4 452
+INDIRI4
+ASGNI4
+LABELV $376
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 3
+EQI4 $462
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $458
+LABELV $462
+ADDRGP4 $465
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 388
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1480
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $468
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 392
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1484
+ADDRLP4 392
+INDIRI4
+ASGNI4
+ADDRGP4 $471
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 396
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1488
+ADDRLP4 396
+INDIRI4
+ASGNI4
+LABELV $458
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 5
+LTI4 $476
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $472
+LABELV $476
+ADDRGP4 $479
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 388
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1508
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $482
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 392
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1592
+ADDRLP4 392
+INDIRI4
+ASGNI4
+ADDRGP4 $485
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 396
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1596
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRGP4 $488
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 400
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1600
+ADDRLP4 400
+INDIRI4
+ASGNI4
+LABELV $472
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 6
+LTI4 $493
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $489
+LABELV $493
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 3
+NEI4 $498
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $494
+LABELV $498
+ADDRGP4 $501
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 388
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1536
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $504
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 392
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1532
+ADDRLP4 392
+INDIRI4
+ASGNI4
+ADDRGP4 $507
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 396
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1528
+ADDRLP4 396
+INDIRI4
+ASGNI4
+LABELV $494
+LABELV $489
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 4
+EQI4 $512
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $508
+LABELV $512
+ADDRGP4 $515
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 388
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1512
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $519
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 392
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1512+4
+ADDRLP4 392
+INDIRI4
+ASGNI4
+ADDRGP4 $522
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 396
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1520
+ADDRLP4 396
+INDIRI4
+ASGNI4
+LABELV $508
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 8
+EQI4 $527
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $523
+LABELV $527
+ADDRGP4 $530
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 388
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1460
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $533
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 392
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1464
+ADDRLP4 392
+INDIRI4
+ASGNI4
+ADDRGP4 $536
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 396
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1468
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRGP4 $539
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 400
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1472
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRGP4 $542
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 404
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1476
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRGP4 $545
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 408
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1108
+ADDRLP4 408
+INDIRI4
+ASGNI4
+ADDRGP4 $548
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 412
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1112
+ADDRLP4 412
+INDIRI4
+ASGNI4
+LABELV $523
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 5
+GEI4 $553
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $549
+LABELV $553
+ADDRGP4 $556
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 388
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1648
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $560
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 392
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1648+4
+ADDRLP4 392
+INDIRI4
+ASGNI4
+ADDRGP4 $564
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 396
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1648+8
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRGP4 $567
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 400
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1660
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRGP4 $571
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 404
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1660+4
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRGP4 $575
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 408
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1660+8
+ADDRLP4 408
+INDIRI4
+ASGNI4
+ADDRGP4 $578
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 412
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1672
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRGP4 $581
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 416
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1552
+ADDRLP4 416
+INDIRI4
+ASGNI4
+ADDRGP4 $560
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 420
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1640
+ADDRLP4 420
+INDIRI4
+ASGNI4
+ADDRGP4 $571
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 424
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1644
+ADDRLP4 424
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 6
+EQI4 $590
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $586
+LABELV $590
+ADDRGP4 $593
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 428
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1676
+ADDRLP4 428
+INDIRI4
+ASGNI4
+ADDRGP4 $596
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 432
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1680
+ADDRLP4 432
+INDIRI4
+ASGNI4
+ADDRGP4 $599
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 436
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1684
+ADDRLP4 436
+INDIRI4
+ASGNI4
+ADDRGP4 $602
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 440
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1688
+ADDRLP4 440
+INDIRI4
+ASGNI4
+ADDRGP4 $605
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 444
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1692
+ADDRLP4 444
+INDIRI4
+ASGNI4
+ADDRGP4 $608
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 448
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1696
+ADDRLP4 448
+INDIRI4
+ASGNI4
+ADDRGP4 $611
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 452
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1700
+ADDRLP4 452
+INDIRI4
+ASGNI4
+ADDRGP4 $614
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 456
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1704
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRGP4 $617
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 460
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1712
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRGP4 $620
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 464
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1708
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRGP4 $623
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 468
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1720
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRGP4 $626
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 472
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1716
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRGP4 $629
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 476
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+864
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRGP4 $632
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 480
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+872
+ADDRLP4 480
+INDIRI4
+ASGNI4
+LABELV $586
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 6
+EQI4 $639
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 8
+EQI4 $639
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $633
+LABELV $639
+ADDRGP4 $642
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 428
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+868
+ADDRLP4 428
+INDIRI4
+ASGNI4
+LABELV $633
+LABELV $549
+ADDRGP4 $645
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 388
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1120
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $648
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 392
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1128
+ADDRLP4 392
+INDIRI4
+ASGNI4
+ADDRGP4 $651
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 396
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1124
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRGP4 $654
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 400
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1340
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRGP4 $657
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 404
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1344
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRGP4 $660
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 408
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1352
+ADDRLP4 408
+INDIRI4
+ASGNI4
+ADDRGP4 $663
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 412
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1348
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRGP4 $666
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 416
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1356
+ADDRLP4 416
+INDIRI4
+ASGNI4
+ADDRGP4 $669
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 420
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1360
+ADDRLP4 420
+INDIRI4
+ASGNI4
+ADDRGP4 $672
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 424
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1540
+ADDRLP4 424
+INDIRI4
+ASGNI4
+ADDRGP4 $675
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 428
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1560
+ADDRLP4 428
+INDIRI4
+ASGNI4
+ADDRGP4 $678
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 432
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1564
+ADDRLP4 432
+INDIRI4
+ASGNI4
+ADDRGP4 $681
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 436
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1588
+ADDRLP4 436
+INDIRI4
+ASGNI4
+ADDRGP4 $684
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 440
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1616
+ADDRLP4 440
+INDIRI4
+ASGNI4
+ADDRGP4 $687
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 444
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1620
+ADDRLP4 444
+INDIRI4
+ASGNI4
+ADDRGP4 $690
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 448
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1624
+ADDRLP4 448
+INDIRI4
+ASGNI4
+ADDRGP4 $693
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 452
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1368
+ADDRLP4 452
+INDIRI4
+ASGNI4
+ADDRGP4 $696
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 456
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1372
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRGP4 $699
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 460
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1376
+ADDRLP4 460
+INDIRI4
+ASGNI4
+CNSTF4 1053609165
+ARGF4
+ADDRGP4 CG_ChangeLoadingProgress
+CALLV
+pop
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+LABELV $700
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $704
+ARGP4
+ADDRLP4 64
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 464
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+1132
+ADDP4
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $707
+ARGP4
+ADDRLP4 64
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 468
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+1132+16
+ADDP4
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $711
+ARGP4
+ADDRLP4 64
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 472
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+1132+96
+ADDP4
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $715
+ARGP4
+ADDRLP4 64
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 476
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+1132+80
+ADDP4
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $719
+ARGP4
+ADDRLP4 64
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 480
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+1132+112
+ADDP4
+ADDRLP4 480
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $723
+ARGP4
+ADDRLP4 64
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 484
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+1132+128
+ADDP4
+ADDRLP4 484
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $727
+ARGP4
+ADDRLP4 64
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 488
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+1132+144
+ADDP4
+ADDRLP4 488
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $731
+ARGP4
+ADDRLP4 64
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 492
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+1132+160
+ADDP4
+ADDRLP4 492
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $735
+ARGP4
+ADDRLP4 64
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 496
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+1132+176
+ADDP4
+ADDRLP4 496
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $739
+ARGP4
+ADDRLP4 64
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 500
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+1132+192
+ADDP4
+ADDRLP4 500
+INDIRI4
+ASGNI4
+LABELV $701
+ADDRLP4 64
+ADDRLP4 64
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 4
+LTI4 $700
+CNSTI4 27
+ARGI4
+ADDRLP4 464
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 464
+INDIRP4
+ARGP4
+CNSTI4 257
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 64
+CNSTI4 1
+ASGNI4
+ADDRGP4 $746
+JUMPV
+LABELV $743
+ADDRLP4 64
+INDIRI4
+ADDRLP4 72
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 49
+EQI4 $750
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $747
+LABELV $750
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemSounds
+CALLV
+pop
+LABELV $747
+LABELV $744
+ADDRLP4 64
+ADDRLP4 64
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $746
+ADDRLP4 64
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $743
+ADDRLP4 64
+CNSTI4 1
+ASGNI4
+LABELV $751
+ADDRLP4 64
+INDIRI4
+CNSTI4 288
+ADDI4
+ARGI4
+ADDRLP4 468
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 68
+ADDRLP4 468
+INDIRP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $755
+ADDRGP4 $753
+JUMPV
+LABELV $755
+ADDRLP4 68
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $757
+ADDRGP4 $752
+JUMPV
+LABELV $757
+ADDRLP4 68
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 472
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+35964
+ADDP4
+ADDRLP4 472
+INDIRI4
+ASGNI4
+LABELV $752
+ADDRLP4 64
+ADDRLP4 64
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 256
+LTI4 $751
+LABELV $753
+ADDRGP4 $762
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 468
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1628
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRGP4 $765
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 472
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1116
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRGP4 $768
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 476
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1104
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRGP4 $771
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 480
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1096
+ADDRLP4 480
+INDIRI4
+ASGNI4
+ADDRGP4 $774
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 484
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1752
+ADDRLP4 484
+INDIRI4
+ASGNI4
+ADDRGP4 $777
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 488
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1756
+ADDRLP4 488
+INDIRI4
+ASGNI4
+ADDRGP4 $780
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 492
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+664
+ADDRLP4 492
+INDIRI4
+ASGNI4
+ADDRGP4 $783
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 496
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+668
+ADDRLP4 496
+INDIRI4
+ASGNI4
+ADDRGP4 $786
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 500
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+672
+ADDRLP4 500
+INDIRI4
+ASGNI4
+ADDRGP4 $789
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 504
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+676
+ADDRLP4 504
+INDIRI4
+ASGNI4
+ADDRGP4 $792
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 508
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+680
+ADDRLP4 508
+INDIRI4
+ASGNI4
+LABELV $331
+endproc CG_RegisterSounds 512 16
+data
+align 4
+LABELV $794
+address $795
+address $796
+address $797
+address $798
+address $799
+address $800
+address $801
+address $802
+address $803
+address $804
+address $805
+code
+proc CG_RegisterGraphics 568 16
+ADDRGP4 cg+110648
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 368
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 trap_R_ClearScene
+CALLV
+pop
+ADDRGP4 cgs+31492
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 cgs+31492
+ARGP4
+ADDRGP4 trap_R_LoadWorldMap
+CALLV
+pop
+ADDRGP4 $810
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $811
+ADDRLP4 264
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+ADDRGP4 $794
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+ADDRGP4 cgs+160652+228
+ADDP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+LABELV $812
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+LTI4 $811
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $817
+ADDRGP4 $823
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 268
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ARGP4
+ADDRLP4 272
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+276
+ADDP4
+ADDRLP4 272
+INDIRI4
+ASGNI4
+LABELV $818
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LEI4 $817
+ADDRGP4 $826
+ARGP4
+ADDRLP4 264
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+132
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRGP4 $829
+ARGP4
+ADDRLP4 268
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+136
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRGP4 $832
+ARGP4
+ADDRLP4 272
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+140
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRGP4 $835
+ARGP4
+ADDRLP4 276
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+104
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRGP4 $838
+ARGP4
+ADDRLP4 280
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+980
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRGP4 $841
+ARGP4
+ADDRLP4 284
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+992
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRGP4 $844
+ARGP4
+ADDRLP4 288
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+996
+ADDRLP4 288
+INDIRI4
+ASGNI4
+ADDRGP4 $847
+ARGP4
+ADDRLP4 292
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1000
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRGP4 $850
+ARGP4
+ADDRLP4 296
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1004
+ADDRLP4 296
+INDIRI4
+ASGNI4
+ADDRGP4 $853
+ARGP4
+ADDRLP4 300
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1008
+ADDRLP4 300
+INDIRI4
+ASGNI4
+ADDRGP4 $856
+ARGP4
+ADDRLP4 304
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+332
+ADDRLP4 304
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 4
+EQI4 $861
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $857
+LABELV $861
+ADDRGP4 $864
+ARGP4
+ADDRLP4 308
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+984
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRGP4 $867
+ARGP4
+ADDRLP4 312
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+988
+ADDRLP4 312
+INDIRI4
+ASGNI4
+ADDRGP4 $870
+ARGP4
+ADDRLP4 316
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+320
+ADDRLP4 316
+INDIRI4
+ASGNI4
+ADDRGP4 $873
+ARGP4
+ADDRLP4 320
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+324
+ADDRLP4 320
+INDIRI4
+ASGNI4
+LABELV $857
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 8
+NEI4 $874
+ADDRGP4 $879
+ARGP4
+ADDRLP4 308
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+328
+ADDRLP4 308
+INDIRI4
+ASGNI4
+LABELV $874
+ADDRGP4 $882
+ARGP4
+ADDRLP4 312
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+208
+ADDRLP4 312
+INDIRI4
+ASGNI4
+ADDRGP4 $885
+ARGP4
+ADDRLP4 316
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+224
+ADDRLP4 316
+INDIRI4
+ASGNI4
+ADDRGP4 $888
+ARGP4
+ADDRLP4 320
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+196
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRGP4 $891
+ARGP4
+ADDRLP4 324
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+120
+ADDRLP4 324
+INDIRI4
+ASGNI4
+ADDRGP4 $894
+ARGP4
+ADDRLP4 328
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+216
+ADDRLP4 328
+INDIRI4
+ASGNI4
+ADDRGP4 $897
+ARGP4
+ADDRLP4 332
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+124
+ADDRLP4 332
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $898
+ADDRGP4 $904
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 97
+ADDI4
+ARGI4
+ADDRLP4 340
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 340
+INDIRP4
+ARGP4
+ADDRLP4 344
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+148
+ADDP4
+ADDRLP4 344
+INDIRI4
+ASGNI4
+LABELV $899
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $898
+ADDRGP4 $907
+ARGP4
+ADDRLP4 336
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+204
+ADDRLP4 336
+INDIRI4
+ASGNI4
+ADDRGP4 $910
+ARGP4
+ADDRLP4 340
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+316
+ADDRLP4 340
+INDIRI4
+ASGNI4
+ADDRGP4 $913
+ARGP4
+ADDRLP4 344
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+644
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRGP4 $916
+ARGP4
+ADDRLP4 348
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+648
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRGP4 $919
+ARGP4
+ADDRLP4 352
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+656
+ADDRLP4 352
+INDIRI4
+ASGNI4
+ADDRGP4 $922
+ARGP4
+ADDRLP4 356
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+652
+ADDRLP4 356
+INDIRI4
+ASGNI4
+ADDRGP4 $925
+ARGP4
+ADDRLP4 360
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+660
+ADDRLP4 360
+INDIRI4
+ASGNI4
+ADDRGP4 $928
+ARGP4
+ADDRLP4 364
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+640
+ADDRLP4 364
+INDIRI4
+ASGNI4
+ADDRGP4 $931
+ARGP4
+ADDRLP4 368
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+704
+ADDRLP4 368
+INDIRI4
+ASGNI4
+ADDRGP4 $934
+ARGP4
+ADDRLP4 372
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+708
+ADDRLP4 372
+INDIRI4
+ASGNI4
+ADDRGP4 $937
+ARGP4
+ADDRLP4 376
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+712
+ADDRLP4 376
+INDIRI4
+ASGNI4
+ADDRGP4 $940
+ARGP4
+ADDRLP4 380
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+716
+ADDRLP4 380
+INDIRI4
+ASGNI4
+ADDRGP4 $943
+ARGP4
+ADDRLP4 384
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+636
+ADDRLP4 384
+INDIRI4
+ASGNI4
+CNSTF4 1058642330
+ARGF4
+ADDRGP4 CG_ChangeLoadingProgress
+CALLV
+pop
+ADDRGP4 $947
+ARGP4
+ADDRLP4 388
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+396+4
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $951
+ARGP4
+ADDRLP4 392
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+436+4
+ADDRLP4 392
+INDIRI4
+ASGNI4
+ADDRGP4 $955
+ARGP4
+ADDRLP4 396
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+396+8
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRGP4 $959
+ARGP4
+ADDRLP4 400
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+436+8
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 7
+EQI4 $965
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 3
+EQI4 $965
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $960
+LABELV $965
+ADDRGP4 $968
+ARGP4
+ADDRLP4 404
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+476
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRGP4 $972
+ARGP4
+ADDRLP4 408
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+476+4
+ADDRLP4 408
+INDIRI4
+ASGNI4
+ADDRGP4 $976
+ARGP4
+ADDRLP4 412
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+476+8
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRGP4 $980
+ARGP4
+ADDRLP4 416
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+476+12
+ADDRLP4 416
+INDIRI4
+ASGNI4
+ADDRGP4 $984
+ARGP4
+ADDRLP4 420
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+476+16
+ADDRLP4 420
+INDIRI4
+ASGNI4
+ADDRGP4 $988
+ARGP4
+ADDRLP4 424
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+476+20
+ADDRLP4 424
+INDIRI4
+ASGNI4
+ADDRGP4 $992
+ARGP4
+ADDRLP4 428
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+476+24
+ADDRLP4 428
+INDIRI4
+ASGNI4
+ADDRGP4 $996
+ARGP4
+ADDRLP4 432
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+476+28
+ADDRLP4 432
+INDIRI4
+ASGNI4
+ADDRGP4 $1000
+ARGP4
+ADDRLP4 436
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+476+32
+ADDRLP4 436
+INDIRI4
+ASGNI4
+ADDRGP4 $1004
+ARGP4
+ADDRLP4 440
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+476+36
+ADDRLP4 440
+INDIRI4
+ASGNI4
+ADDRGP4 $1007
+ARGP4
+ADDRLP4 444
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+336
+ADDRLP4 444
+INDIRI4
+ASGNI4
+LABELV $960
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 5
+LTI4 $1012
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $1008
+LABELV $1012
+ADDRGP4 $1015
+ARGP4
+ADDRLP4 404
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+396
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRGP4 $1018
+ARGP4
+ADDRLP4 408
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+436
+ADDRLP4 408
+INDIRI4
+ASGNI4
+ADDRGP4 $1022
+ARGP4
+ADDRLP4 412
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+396+12
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRGP4 $1026
+ARGP4
+ADDRLP4 416
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+436+12
+ADDRLP4 416
+INDIRI4
+ASGNI4
+ADDRGP4 $1030
+ARGP4
+ADDRLP4 420
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+396+16
+ADDRLP4 420
+INDIRI4
+ASGNI4
+ADDRGP4 $1034
+ARGP4
+ADDRLP4 424
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+436+16
+ADDRLP4 424
+INDIRI4
+ASGNI4
+ADDRGP4 $1038
+ARGP4
+ADDRLP4 428
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+396+20
+ADDRLP4 428
+INDIRI4
+ASGNI4
+ADDRGP4 $1042
+ARGP4
+ADDRLP4 432
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+436+20
+ADDRLP4 432
+INDIRI4
+ASGNI4
+ADDRGP4 $1046
+ARGP4
+ADDRLP4 436
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+396+24
+ADDRLP4 436
+INDIRI4
+ASGNI4
+ADDRGP4 $1050
+ARGP4
+ADDRLP4 440
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+436+24
+ADDRLP4 440
+INDIRI4
+ASGNI4
+ADDRGP4 $1054
+ARGP4
+ADDRLP4 444
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+396+28
+ADDRLP4 444
+INDIRI4
+ASGNI4
+ADDRGP4 $1058
+ARGP4
+ADDRLP4 448
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+436+28
+ADDRLP4 448
+INDIRI4
+ASGNI4
+ADDRGP4 $1062
+ARGP4
+ADDRLP4 452
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+396+32
+ADDRLP4 452
+INDIRI4
+ASGNI4
+ADDRGP4 $1066
+ARGP4
+ADDRLP4 456
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+436+32
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRGP4 $1070
+ARGP4
+ADDRLP4 460
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+396+36
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRGP4 $1074
+ARGP4
+ADDRLP4 464
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+436+36
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRGP4 $1009
+JUMPV
+LABELV $1008
+ADDRGP4 $1077
+ARGP4
+ADDRLP4 404
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+112
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 8
+EQI4 $1082
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $1078
+LABELV $1082
+ADDRGP4 $1085
+ARGP4
+ADDRLP4 408
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+516
+ADDRLP4 408
+INDIRI4
+ASGNI4
+ADDRGP4 $1088
+ARGP4
+ADDRLP4 412
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+520
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRGP4 $1091
+ARGP4
+ADDRLP4 416
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+524
+ADDRLP4 416
+INDIRI4
+ASGNI4
+ADDRGP4 $1094
+ARGP4
+ADDRLP4 420
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+528
+ADDRLP4 420
+INDIRI4
+ASGNI4
+ADDRGP4 $1097
+ARGP4
+ADDRLP4 424
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+876
+ADDRLP4 424
+INDIRI4
+ASGNI4
+ADDRGP4 $1100
+ARGP4
+ADDRLP4 428
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+880
+ADDRLP4 428
+INDIRI4
+ASGNI4
+ADDRGP4 $1079
+JUMPV
+LABELV $1078
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 6
+EQI4 $1105
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $1101
+LABELV $1105
+ADDRGP4 $1108
+ARGP4
+ADDRLP4 408
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+532
+ADDRLP4 408
+INDIRI4
+ASGNI4
+ADDRGP4 $1111
+ARGP4
+ADDRLP4 412
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+536
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRGP4 $1114
+ARGP4
+ADDRLP4 416
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+12
+ADDRLP4 416
+INDIRI4
+ASGNI4
+ADDRGP4 $1117
+ARGP4
+ADDRLP4 420
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+16
+ADDRLP4 420
+INDIRI4
+ASGNI4
+ADDRGP4 $1120
+ARGP4
+ADDRLP4 424
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+24
+ADDRLP4 424
+INDIRI4
+ASGNI4
+ADDRGP4 $1124
+ARGP4
+ADDRLP4 428
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+24+4
+ADDRLP4 428
+INDIRI4
+ASGNI4
+ADDRGP4 $1128
+ARGP4
+ADDRLP4 432
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+24+8
+ADDRLP4 432
+INDIRI4
+ASGNI4
+ADDRGP4 $1131
+ARGP4
+ADDRLP4 436
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+36
+ADDRLP4 436
+INDIRI4
+ASGNI4
+ADDRGP4 $1135
+ARGP4
+ADDRLP4 440
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+36+4
+ADDRLP4 440
+INDIRI4
+ASGNI4
+ADDRGP4 $1139
+ARGP4
+ADDRLP4 444
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+36+8
+ADDRLP4 444
+INDIRI4
+ASGNI4
+ADDRGP4 $1142
+ARGP4
+ADDRLP4 448
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+836
+ADDRLP4 448
+INDIRI4
+ASGNI4
+ADDRGP4 $1145
+ARGP4
+ADDRLP4 452
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+840
+ADDRLP4 452
+INDIRI4
+ASGNI4
+ADDRGP4 $1146
+ARGP4
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+pop
+ADDRGP4 $1147
+ARGP4
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+pop
+ADDRGP4 $1150
+ARGP4
+ADDRLP4 456
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+856
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRGP4 $1153
+ARGP4
+ADDRLP4 460
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+860
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRGP4 $1156
+ARGP4
+ADDRLP4 464
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+844
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRGP4 $1159
+ARGP4
+ADDRLP4 468
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+848
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRGP4 $1162
+ARGP4
+ADDRLP4 472
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+852
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRGP4 $1165
+ARGP4
+ADDRLP4 476
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+888
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRGP4 $1168
+ARGP4
+ADDRLP4 480
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+884
+ADDRLP4 480
+INDIRI4
+ASGNI4
+LABELV $1101
+LABELV $1079
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 6
+EQI4 $1175
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 8
+EQI4 $1175
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $1169
+LABELV $1175
+ADDRGP4 $1097
+ARGP4
+ADDRLP4 408
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+876
+ADDRLP4 408
+INDIRI4
+ASGNI4
+ADDRGP4 $1100
+ARGP4
+ADDRLP4 412
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+880
+ADDRLP4 412
+INDIRI4
+ASGNI4
+LABELV $1169
+LABELV $1009
+CNSTF4 1060320051
+ARGF4
+ADDRGP4 CG_ChangeLoadingProgress
+CALLV
+pop
+ADDRGP4 $1182
+ARGP4
+ADDRLP4 404
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+540
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRGP4 $1185
+ARGP4
+ADDRLP4 408
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+544
+ADDRLP4 408
+INDIRI4
+ASGNI4
+ADDRGP4 $1188
+ARGP4
+ADDRLP4 412
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+548
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRGP4 $1191
+ARGP4
+ADDRLP4 416
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+552
+ADDRLP4 416
+INDIRI4
+ASGNI4
+ADDRGP4 $1194
+ARGP4
+ADDRLP4 420
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+556
+ADDRLP4 420
+INDIRI4
+ASGNI4
+ADDRGP4 $1197
+ARGP4
+ADDRLP4 424
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+560
+ADDRLP4 424
+INDIRI4
+ASGNI4
+ADDRGP4 $1200
+ARGP4
+ADDRLP4 428
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+564
+ADDRLP4 428
+INDIRI4
+ASGNI4
+ADDRGP4 $1203
+ARGP4
+ADDRLP4 432
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+568
+ADDRLP4 432
+INDIRI4
+ASGNI4
+ADDRGP4 $1206
+ARGP4
+ADDRLP4 436
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+572
+ADDRLP4 436
+INDIRI4
+ASGNI4
+ADDRGP4 $1209
+ARGP4
+ADDRLP4 440
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+724
+ADDRLP4 440
+INDIRI4
+ASGNI4
+ADDRGP4 $1212
+ARGP4
+ADDRLP4 444
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+116
+ADDRLP4 444
+INDIRI4
+ASGNI4
+ADDRGP4 $1215
+ARGP4
+ADDRLP4 448
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+916
+ADDRLP4 448
+INDIRI4
+ASGNI4
+ADDRGP4 $1218
+ARGP4
+ADDRLP4 452
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+952
+ADDRLP4 452
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 5
+LTI4 $1223
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $1219
+LABELV $1223
+ADDRGP4 $1226
+ARGP4
+ADDRLP4 456
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+964
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRGP4 $1229
+ARGP4
+ADDRLP4 460
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+976
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRGP4 $1220
+JUMPV
+LABELV $1219
+ADDRGP4 $1232
+ARGP4
+ADDRLP4 456
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+956
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRGP4 $1235
+ARGP4
+ADDRLP4 460
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+960
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRGP4 $1238
+ARGP4
+ADDRLP4 464
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+968
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRGP4 $1241
+ARGP4
+ADDRLP4 468
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+972
+ADDRLP4 468
+INDIRI4
+ASGNI4
+LABELV $1220
+ADDRGP4 $1244
+ARGP4
+ADDRLP4 456
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1012
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRGP4 $1247
+ARGP4
+ADDRLP4 460
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1016
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRGP4 $1250
+ARGP4
+ADDRLP4 464
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1020
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRGP4 $1253
+ARGP4
+ADDRLP4 468
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1024
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRGP4 $1256
+ARGP4
+ADDRLP4 472
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1028
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRGP4 cg_items
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 6144
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg_weapons
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 2112
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTI4 27
+ARGI4
+ADDRLP4 476
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 476
+INDIRP4
+ARGP4
+CNSTI4 257
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1260
+JUMPV
+LABELV $1257
+ADDRGP4 cg+24
+INDIRI4
+CNSTI4 0
+EQI4 $1261
+ADDRLP4 480
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 480
+INDIRI4
+ADDRGP4 bg_itemlist+36
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $1261
+ADDRLP4 480
+INDIRI4
+ADDRGP4 bg_itemlist+36
+ADDP4
+INDIRI4
+CNSTI4 8
+EQI4 $1261
+ADDRGP4 $1258
+JUMPV
+LABELV $1261
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 49
+EQI4 $1269
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $1266
+LABELV $1269
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_LoadingItem
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+LABELV $1266
+LABELV $1258
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1260
+ADDRLP4 0
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $1257
+ADDRGP4 $1272
+ARGP4
+ADDRLP4 480
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+300
+ADDRLP4 480
+INDIRI4
+ASGNI4
+ADDRGP4 $1275
+ARGP4
+ADDRLP4 484
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+304
+ADDRLP4 484
+INDIRI4
+ASGNI4
+ADDRGP4 $1278
+ARGP4
+ADDRLP4 488
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+308
+ADDRLP4 488
+INDIRI4
+ASGNI4
+ADDRGP4 $1281
+ARGP4
+ADDRLP4 492
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+312
+ADDRLP4 492
+INDIRI4
+ASGNI4
+ADDRGP4 $1284
+ARGP4
+ADDRLP4 496
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+272
+ADDRLP4 496
+INDIRI4
+ASGNI4
+ADDRGP4 $1287
+ARGP4
+ADDRLP4 500
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+296
+ADDRLP4 500
+INDIRI4
+ASGNI4
+ADDRGP4 $1290
+ARGP4
+ADDRLP4 504
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+792
+ADDRLP4 504
+INDIRI4
+ASGNI4
+ADDRGP4 $1293
+ARGP4
+ADDRLP4 508
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+904
+ADDRLP4 508
+INDIRI4
+ASGNI4
+ADDRLP4 512
+ADDRGP4 trap_CM_NumInlineModels
+CALLI4
+ASGNI4
+ADDRGP4 cgs+36988
+ADDRLP4 512
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1298
+JUMPV
+LABELV $1295
+ADDRLP4 544
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRGP4 $1300
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 544
+ARGP4
+ADDRLP4 556
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+36992
+ADDP4
+ADDRLP4 556
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+36992
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 520
+ARGP4
+ADDRLP4 532
+ARGP4
+ADDRGP4 trap_R_ModelBounds
+CALLV
+pop
+ADDRLP4 516
+CNSTI4 0
+ASGNI4
+LABELV $1303
+ADDRLP4 560
+ADDRLP4 516
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 564
+ADDRLP4 560
+INDIRI4
+ADDRLP4 520
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 560
+INDIRI4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+38016
+ADDP4
+ADDP4
+ADDRLP4 564
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 560
+INDIRI4
+ADDRLP4 532
+ADDP4
+INDIRF4
+ADDRLP4 564
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1304
+ADDRLP4 516
+ADDRLP4 516
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 516
+INDIRI4
+CNSTI4 3
+LTI4 $1303
+LABELV $1296
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1298
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+36988
+INDIRI4
+LTI4 $1295
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $1308
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+ADDI4
+ARGI4
+ADDRLP4 520
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 516
+ADDRLP4 520
+INDIRP4
+ASGNP4
+ADDRLP4 516
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1312
+ADDRGP4 $1310
+JUMPV
+LABELV $1312
+ADDRLP4 516
+INDIRP4
+ARGP4
+ADDRLP4 524
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+34940
+ADDP4
+ADDRLP4 524
+INDIRI4
+ASGNI4
+LABELV $1309
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $1308
+LABELV $1310
+ADDRGP4 CG_ClearParticles
+CALLV
+pop
+LABELV $793
+endproc CG_RegisterGraphics 568 16
+export CG_StreamAssets
+proc CG_StreamAssets 32 4
+ADDRGP4 cg+24
+INDIRI4
+CNSTI4 0
+NEI4 $1316
+ADDRGP4 $1315
+JUMPV
+LABELV $1316
+ADDRLP4 12
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+CNSTI4 27
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 16
+INDIRP4
+ASGNP4
+LABELV $1319
+ADDRGP4 cg+28
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+GEI4 $1322
+ADDRLP4 24
+ADDRGP4 cg+28
+ASGNP4
+ADDRLP4 20
+ADDRLP4 24
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $1320
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 49
+NEI4 $1320
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+ADDRGP4 $1320
+JUMPV
+LABELV $1322
+ADDRLP4 20
+ADDRGP4 CG_LoadDeferredPlayer
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $1328
+ADDRGP4 cg+24
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1315
+JUMPV
+LABELV $1328
+LABELV $1320
+ADDRLP4 20
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 4
+LTI4 $1319
+LABELV $1315
+endproc CG_StreamAssets 32 4
+export CG_BuildSpectatorString
+proc CG_BuildSpectatorString 12 12
+ADDRGP4 cg+121384
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1333
+ADDRLP4 4
+CNSTI4 1836
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+41088
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1337
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+41088+68
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1337
+ADDRGP4 $1344
+ARGP4
+CNSTI4 1836
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+4
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 cg+121384
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $1337
+LABELV $1334
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1333
+ADDRGP4 cg+121384
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+122408
+INDIRI4
+EQI4 $1348
+ADDRGP4 cg+122408
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+122412
+CNSTF4 3212836864
+ASGNF4
+LABELV $1348
+LABELV $1331
+endproc CG_BuildSpectatorString 12 12
+proc CG_RegisterClients 12 4
+ADDRGP4 cg+4
+INDIRI4
+ARGI4
+ADDRGP4 CG_LoadingClient
+CALLV
+pop
+ADDRGP4 cg+4
+INDIRI4
+ARGI4
+ADDRGP4 CG_NewClientInfo
+CALLV
+pop
+ADDRGP4 cg+24
+INDIRI4
+CNSTI4 0
+EQI4 $1356
+ADDRGP4 cg+20
+CNSTI4 0
+ASGNI4
+LABELV $1356
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1360
+ADDRGP4 cg+4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1364
+ADDRGP4 $1361
+JUMPV
+LABELV $1364
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1367
+ADDRGP4 $1361
+JUMPV
+LABELV $1367
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_LoadingClient
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_NewClientInfo
+CALLV
+pop
+LABELV $1361
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1360
+ADDRGP4 CG_BuildSpectatorString
+CALLV
+pop
+LABELV $1353
+endproc CG_RegisterClients 12 4
+export CG_ConfigString
+proc CG_ConfigString 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1372
+ADDRFP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $1370
+LABELV $1372
+ADDRGP4 $1373
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $1370
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs
+ADDP4
+INDIRI4
+ADDRGP4 cgs+4096
+ADDP4
+RETP4
+LABELV $1369
+endproc CG_ConfigString 4 8
+export CG_StartMusic
+proc CG_StartMusic 144 12
+CNSTI4 2
+ARGI4
+ADDRLP4 132
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 132
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 136
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 136
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 140
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 68
+ARGP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRGP4 trap_S_StartBackgroundTrack
+CALLV
+pop
+LABELV $1375
+endproc CG_StartMusic 144 12
+export CG_Init
+proc CG_Init 56 32
+ADDRGP4 cgs
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 162436
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 132388
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg_entities
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 827392
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg_weapons
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 2112
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg_items
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 6144
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTF4 0
+ARGF4
+ADDRGP4 CG_ChangeLoadingProgress
+CALLV
+pop
+ADDRGP4 cg+4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31456
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31452
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $1381
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $1384
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $1387
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 CG_RegisterCvars
+CALLV
+pop
+ADDRGP4 CG_InitConsoleCommands
+CALLV
+pop
+ADDRGP4 cg+110500
+CNSTI4 2
+ASGNI4
+ADDRLP4 16
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cgs+34924
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+34920
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+34928
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cgs+20100
+ARGP4
+ADDRGP4 trap_GetGlconfig
+CALLV
+pop
+ADDRGP4 cgs+31432
+ADDRGP4 cgs+20100+11304
+INDIRI4
+CVIF4 4
+CNSTF4 1142947840
+DIVF4
+ASGNF4
+ADDRGP4 cgs+31436
+ADDRGP4 cgs+20100+11308
+INDIRI4
+CVIF4 4
+CNSTF4 1139802112
+DIVF4
+ASGNF4
+ADDRGP4 cgs+31444
+ADDRGP4 cgs+20100+11304
+INDIRI4
+CVIF4 4
+CNSTF4 1149239296
+DIVF4
+ASGNF4
+ADDRGP4 cgs+31448
+ADDRGP4 cgs+20100+11308
+INDIRI4
+CVIF4 4
+CNSTF4 1145044992
+DIVF4
+ASGNF4
+CNSTF4 1036831949
+ARGF4
+ADDRGP4 CG_ChangeLoadingProgress
+CALLV
+pop
+ADDRGP4 cgs
+ARGP4
+ADDRGP4 trap_GetGameState
+CALLV
+pop
+CNSTI4 20
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1407
+ARGP4
+ADDRLP4 24
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $1405
+ADDRGP4 $1408
+ARGP4
+ADDRGP4 $1407
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $1405
+CNSTI4 21
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34908
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 CG_ParseServerinfo
+CALLV
+pop
+CNSTF4 1045220557
+ARGF4
+ADDRGP4 CG_ChangeLoadingProgress
+CALLV
+pop
+ADDRGP4 $1410
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 cgs+31492
+ARGP4
+ADDRGP4 trap_CM_LoadMap
+CALLV
+pop
+CNSTF4 1050253722
+ARGF4
+ADDRGP4 CG_ChangeLoadingProgress
+CALLV
+pop
+ADDRGP4 cg+20
+CNSTI4 1
+ASGNI4
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_streamAssets+12
+INDIRI4
+ADDRLP4 40
+INDIRI4
+EQI4 $1417
+ADDRGP4 cg_buildScript+12
+INDIRI4
+ADDRLP4 40
+INDIRI4
+NEI4 $1417
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1418
+JUMPV
+LABELV $1417
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+LABELV $1418
+ADDRGP4 cg+24
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $1419
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 CG_RegisterSounds
+CALLV
+pop
+CNSTF4 1056964608
+ARGF4
+ADDRGP4 CG_ChangeLoadingProgress
+CALLV
+pop
+ADDRGP4 $1420
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 CG_RegisterGraphics
+CALLV
+pop
+CNSTF4 1061997773
+ARGF4
+ADDRGP4 CG_ChangeLoadingProgress
+CALLV
+pop
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 7
+EQI4 $1426
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 3
+EQI4 $1426
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $1421
+LABELV $1426
+ADDRGP4 $1427
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 Init_SprayLogoSys
+CALLV
+pop
+LABELV $1421
+ADDRGP4 Init_LensFlareSys
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRGP4 cg+107648
+ARGP4
+ADDRGP4 cg_sky+16
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+107648
+ARGP4
+CNSTI4 60
+ARGI4
+ADDRLP4 52
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1432
+ADDRLP4 44
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 44
+ADDRLP4 44
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRGP4 $1434
+ARGP4
+ADDRGP4 cg+107776
+ARGP4
+ADDRGP4 cg+107788
+ARGP4
+ADDRGP4 cg+107776+4
+ARGP4
+ADDRGP4 cg+107788+4
+ARGP4
+ADDRGP4 cg+107776+8
+ARGP4
+ADDRGP4 cg+107788+8
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+LABELV $1432
+ADDRGP4 Init_SpriteParticles
+CALLV
+pop
+ADDRGP4 $1445
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 CG_RegisterClients
+CALLV
+pop
+ADDRGP4 cg+20
+CNSTI4 0
+ASGNI4
+CNSTF4 1063675494
+ARGF4
+ADDRGP4 CG_ChangeLoadingProgress
+CALLV
+pop
+ADDRGP4 CG_InitLocalEntities
+CALLV
+pop
+ADDRGP4 CG_InitMarkPolys
+CALLV
+pop
+ADDRGP4 cg+111052
+CNSTI1 0
+ASGNI1
+ADDRGP4 CG_SetConfigValues
+CALLV
+pop
+ADDRGP4 CG_StartMusic
+CALLV
+pop
+ADDRGP4 $208
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 CG_ShaderStateChanged
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_S_ClearLoopingSounds
+CALLV
+pop
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_ChangeLoadingProgress
+CALLV
+pop
+LABELV $1376
+endproc CG_Init 56 32
+export CG_Shutdown
+proc CG_Shutdown 0 0
+LABELV $1448
+endproc CG_Shutdown 0 0
+export CG_EventHandling
+proc CG_EventHandling 0 0
+LABELV $1449
+endproc CG_EventHandling 0 0
+export CG_KeyEvent
+proc CG_KeyEvent 0 0
+ADDRGP4 cg+107640
+INDIRI4
+ADDRGP4 cg+107620
+INDIRI4
+GEI4 $1451
+ADDRGP4 cgs+160588
+ADDRFP4 0
+INDIRI4
+ASGNI4
+LABELV $1451
+LABELV $1450
+endproc CG_KeyEvent 0 0
+export CG_MouseEvent
+proc CG_MouseEvent 8 0
+ADDRLP4 0
+ADDRGP4 cgs+160560
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 cgs+160560
+INDIRI4
+CNSTI4 0
+GEI4 $1458
+ADDRGP4 cgs+160560
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1459
+JUMPV
+LABELV $1458
+ADDRGP4 cgs+160560
+INDIRI4
+CNSTI4 640
+LEI4 $1462
+ADDRGP4 cgs+160560
+CNSTI4 640
+ASGNI4
+LABELV $1462
+LABELV $1459
+ADDRLP4 4
+ADDRGP4 cgs+160564
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 cgs+160564
+INDIRI4
+CNSTI4 0
+GEI4 $1467
+ADDRGP4 cgs+160564
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1468
+JUMPV
+LABELV $1467
+ADDRGP4 cgs+160564
+INDIRI4
+CNSTI4 480
+LEI4 $1471
+ADDRGP4 cgs+160564
+CNSTI4 480
+ASGNI4
+LABELV $1471
+LABELV $1468
+LABELV $1456
+endproc CG_MouseEvent 8 0
+bss
+export cg_pmove_msec
+align 4
+LABELV cg_pmove_msec
+skip 272
+export cg_hudFiles
+align 4
+LABELV cg_hudFiles
+skip 272
+import CG_AddBoundingBox
+import CG_AddBoundingBoxEntity
+import CG_QueryCvar
+import CG_Timestamp
+import CG_LimitCvars
+import trap_RealTime
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import trap_R_inPVS
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_Cutscene2d_Draw
+import CG_Cutscene2d_UpdateTrans
+import CG_Cutscene2d_CheckCmd
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import Main_SpriteParticles
+import LaunchRevivalParticle
+import LaunchSpeedyPuffTrail
+import Init_SpriteParticles
+import AddLFsToScreen
+import AddLFToDrawList
+import Init_LensFlareSys
+import DumpPolyInfo
+import ActiveChooseLogoMenu
+import FindLogoForSpraying
+import Add_LogoToDrawList
+import AddLogosToScene
+import Init_SprayLogoSys
+import Calculate_2DOfDIR
+import Calculate_2DOf3D
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_ChangeLoadingProgress
+import CG_LoadingString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_ScorePlum
+import CG_TeleOutEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_GenerateParticles
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_PortalInView
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_GetWaterMuzzle
+import CG_SprayTrail
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponSRWC
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_Boomies_Explosion
+import CG_BamBam_Explosion
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_LerpTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayer
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_UpdateVoipTeamIDs
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Draw3DModel
+import CG_SetPrintString
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import CG_MessagePrint
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_WorldToScreen
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_DrawPic1024
+import CG_DrawRect1024
+import CG_FillRect1024
+import CG_AdjustFrom1024
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddPolyBatched
+import CG_AddRefEntityBatched
+import CG_FlushSceneBatches
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_LoadMenus
+export cg_icons
+align 4
+LABELV cg_icons
+skip 272
+export cg_ambient
+align 4
+LABELV cg_ambient
+skip 272
+export cg_drawBBox
+align 4
+LABELV cg_drawBBox
+skip 272
+export cg_drawVoiceNames
+align 4
+LABELV cg_drawVoiceNames
+skip 272
+export cg_drawLensflare
+align 4
+LABELV cg_drawLensflare
+skip 272
+export cg_timestamps
+align 4
+LABELV cg_timestamps
+skip 272
+export cg_skyLensflare
+align 4
+LABELV cg_skyLensflare
+skip 272
+export cg_sky
+align 4
+LABELV cg_sky
+skip 272
+export cg_curWarmupReady
+align 4
+LABELV cg_curWarmupReady
+skip 272
+export cg_warmupReady
+align 4
+LABELV cg_warmupReady
+skip 272
+export cg_glowModelTeam
+align 4
+LABELV cg_glowModelTeam
+skip 272
+export cg_glowModel
+align 4
+LABELV cg_glowModel
+skip 272
+export cg_cineDrawLetterBox
+align 4
+LABELV cg_cineDrawLetterBox
+skip 272
+export cg_cineHideHud
+align 4
+LABELV cg_cineHideHud
+skip 272
+export cg_LPSwallhackAlpha
+align 4
+LABELV cg_LPSwallhackAlpha
+skip 272
+export cg_LPSwallhackSize
+align 4
+LABELV cg_LPSwallhackSize
+skip 272
+export cg_bigScoreType
+align 4
+LABELV cg_bigScoreType
+skip 272
+export cg_thirdPersonAutoSwitch
+align 4
+LABELV cg_thirdPersonAutoSwitch
+skip 272
+export cg_drawTimeLeft
+align 4
+LABELV cg_drawTimeLeft
+skip 272
+export cg_drawServerInfos
+align 4
+LABELV cg_drawServerInfos
+skip 272
+export cg_drawMessages
+align 4
+LABELV cg_drawMessages
+skip 272
+export cg_drawups
+align 4
+LABELV cg_drawups
+skip 272
+export cg_wopFFAhud
+align 4
+LABELV cg_wopFFAhud
+skip 272
+export cg_printDir
+align 4
+LABELV cg_printDir
+skip 272
+export cg_drawRealTime
+align 4
+LABELV cg_drawRealTime
+skip 272
+export cg_correctedWeaponPos
+align 4
+LABELV cg_correctedWeaponPos
+skip 272
+export cg_noProjectileTrail
+align 4
+LABELV cg_noProjectileTrail
+skip 272
+export cg_noTaunt
+align 4
+LABELV cg_noTaunt
+skip 272
+export cg_bigFont
+align 4
+LABELV cg_bigFont
+skip 272
+export cg_smallFont
+align 4
+LABELV cg_smallFont
+skip 272
+export cg_cameraMode
+align 4
+LABELV cg_cameraMode
+skip 272
+export cg_timescale
+align 4
+LABELV cg_timescale
+skip 272
+export cg_timescaleFadeSpeed
+align 4
+LABELV cg_timescaleFadeSpeed
+skip 272
+export cg_timescaleFadeEnd
+align 4
+LABELV cg_timescaleFadeEnd
+skip 272
+export cg_cameraOrbitDelay
+align 4
+LABELV cg_cameraOrbitDelay
+skip 272
+export cg_cameraOrbit
+align 4
+LABELV cg_cameraOrbit
+skip 272
+export pmove_msec
+align 4
+LABELV pmove_msec
+skip 272
+export pmove_fixed
+align 4
+LABELV pmove_fixed
+skip 272
+export cg_smoothClients
+align 4
+LABELV cg_smoothClients
+skip 272
+export cg_scorePlum
+align 4
+LABELV cg_scorePlum
+skip 272
+export cg_teamChatsOnly
+align 4
+LABELV cg_teamChatsOnly
+skip 272
+export cg_drawFriend
+align 4
+LABELV cg_drawFriend
+skip 272
+export cg_streamAssets
+align 4
+LABELV cg_streamAssets
+skip 272
+export cg_deferPlayers
+align 4
+LABELV cg_deferPlayers
+skip 272
+export cg_predictItems
+align 4
+LABELV cg_predictItems
+skip 272
+export cg_paused
+align 4
+LABELV cg_paused
+skip 272
+export cg_buildScript
+align 4
+LABELV cg_buildScript
+skip 272
+export cg_forceModel
+align 4
+LABELV cg_forceModel
+skip 272
+export cg_stats
+align 4
+LABELV cg_stats
+skip 272
+export cg_teamChatHeight
+align 4
+LABELV cg_teamChatHeight
+skip 272
+export cg_teamChatTime
+align 4
+LABELV cg_teamChatTime
+skip 272
+export cg_chatBeep
+align 4
+LABELV cg_chatBeep
+skip 272
+export cg_synchronousClients
+align 4
+LABELV cg_synchronousClients
+skip 272
+export cg_drawAttacker
+align 4
+LABELV cg_drawAttacker
+skip 272
+export cg_lagometer
+align 4
+LABELV cg_lagometer
+skip 272
+export cg_thirdPerson
+align 4
+LABELV cg_thirdPerson
+skip 272
+export cg_thirdPersonAngle
+align 4
+LABELV cg_thirdPersonAngle
+skip 272
+export cg_thirdPersonRange
+align 4
+LABELV cg_thirdPersonRange
+skip 272
+export cg_zoomFov
+align 4
+LABELV cg_zoomFov
+skip 272
+export cg_fov
+align 4
+LABELV cg_fov
+skip 272
+export cg_simpleItems
+align 4
+LABELV cg_simpleItems
+skip 272
+export cg_ignore
+align 4
+LABELV cg_ignore
+skip 272
+export cg_autoswitch
+align 4
+LABELV cg_autoswitch
+skip 272
+export cg_tracerLength
+align 4
+LABELV cg_tracerLength
+skip 272
+export cg_tracerWidth
+align 4
+LABELV cg_tracerWidth
+skip 272
+export cg_tracerChance
+align 4
+LABELV cg_tracerChance
+skip 272
+export cg_viewsize
+align 4
+LABELV cg_viewsize
+skip 272
+export cg_drawGun
+align 4
+LABELV cg_drawGun
+skip 272
+export cg_gun_z
+align 4
+LABELV cg_gun_z
+skip 272
+export cg_gun_y
+align 4
+LABELV cg_gun_y
+skip 272
+export cg_gun_x
+align 4
+LABELV cg_gun_x
+skip 272
+export cg_gun_frame
+align 4
+LABELV cg_gun_frame
+skip 272
+export cg_addMarks
+align 4
+LABELV cg_addMarks
+skip 272
+export cg_footsteps
+align 4
+LABELV cg_footsteps
+skip 272
+export cg_showmiss
+align 4
+LABELV cg_showmiss
+skip 272
+export cg_noPlayerAnims
+align 4
+LABELV cg_noPlayerAnims
+skip 272
+export cg_optimizePrediction
+align 4
+LABELV cg_optimizePrediction
+skip 272
+export cg_nopredict
+align 4
+LABELV cg_nopredict
+skip 272
+export cg_errorDecay
+align 4
+LABELV cg_errorDecay
+skip 272
+export cg_debugEvents
+align 4
+LABELV cg_debugEvents
+skip 272
+export cg_debugPosition
+align 4
+LABELV cg_debugPosition
+skip 272
+export cg_debugAnim
+align 4
+LABELV cg_debugAnim
+skip 272
+export cg_animSpeed
+align 4
+LABELV cg_animSpeed
+skip 272
+export cg_draw2D
+align 4
+LABELV cg_draw2D
+skip 272
+export cg_drawStatus
+align 4
+LABELV cg_drawStatus
+skip 272
+export cg_crosshairHealth
+align 4
+LABELV cg_crosshairHealth
+skip 272
+export cg_crosshairSize
+align 4
+LABELV cg_crosshairSize
+skip 272
+export cg_crosshairY
+align 4
+LABELV cg_crosshairY
+skip 272
+export cg_crosshairX
+align 4
+LABELV cg_crosshairX
+skip 272
+export cg_teamOverlayUserinfo
+align 4
+LABELV cg_teamOverlayUserinfo
+skip 272
+export cg_drawTeamOverlay
+align 4
+LABELV cg_drawTeamOverlay
+skip 272
+export cg_drawRewards
+align 4
+LABELV cg_drawRewards
+skip 272
+export cg_drawCrosshairNames
+align 4
+LABELV cg_drawCrosshairNames
+skip 272
+export cg_drawCrosshair
+align 4
+LABELV cg_drawCrosshair
+skip 272
+export cg_drawAmmoWarning
+align 4
+LABELV cg_drawAmmoWarning
+skip 272
+export cg_drawIcons
+align 4
+LABELV cg_drawIcons
+skip 272
+export cg_draw3dIcons
+align 4
+LABELV cg_draw3dIcons
+skip 272
+export cg_drawSnapshot
+align 4
+LABELV cg_drawSnapshot
+skip 272
+export cg_drawFPS
+align 4
+LABELV cg_drawFPS
+skip 272
+export cg_drawTimer
+align 4
+LABELV cg_drawTimer
+skip 272
+export cg_shadows
+align 4
+LABELV cg_shadows
+skip 272
+export cg_swingSpeed
+align 4
+LABELV cg_swingSpeed
+skip 272
+export cg_bobroll
+align 4
+LABELV cg_bobroll
+skip 272
+export cg_bobpitch
+align 4
+LABELV cg_bobpitch
+skip 272
+export cg_bobup
+align 4
+LABELV cg_bobup
+skip 272
+export cg_runroll
+align 4
+LABELV cg_runroll
+skip 272
+export cg_runpitch
+align 4
+LABELV cg_runpitch
+skip 272
+export cg_centertime
+align 4
+LABELV cg_centertime
+skip 272
+import cg_markPolys
+export cg_items
+align 4
+LABELV cg_items
+skip 6144
+export cg_weapons
+align 4
+LABELV cg_weapons
+skip 2112
+export cg_entities
+align 4
+LABELV cg_entities
+skip 827392
+export cg
+align 4
+LABELV cg
+skip 132388
+export cgs
+align 4
+LABELV cgs
+skip 162436
+import trailEnt
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $1445
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $1434
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $1427
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $1420
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 0
+align 1
+LABELV $1419
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $1410
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $1408
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1407
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 99
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 53
+byte 1 51
+byte 1 0
+align 1
+LABELV $1387
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $1384
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 49
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $1381
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 87
+byte 1 111
+byte 1 80
+byte 1 97
+byte 1 115
+byte 1 99
+byte 1 105
+byte 1 105
+byte 1 0
+align 1
+LABELV $1373
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 120
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1344
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $1300
+byte 1 42
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1293
+byte 1 107
+byte 1 109
+byte 1 97
+byte 1 77
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $1290
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 77
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $1287
+byte 1 119
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 0
+align 1
+LABELV $1284
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $1281
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 95
+byte 1 109
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $1278
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 47
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 108
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $1275
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 109
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $1272
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $1256
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $1253
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1250
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 103
+byte 1 111
+byte 1 100
+byte 1 0
+align 1
+LABELV $1247
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 121
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1244
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $1241
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 69
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 70
+byte 1 80
+byte 1 0
+align 1
+LABELV $1238
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 69
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 70
+byte 1 80
+byte 1 0
+align 1
+LABELV $1235
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 69
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1232
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 69
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $1229
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 69
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 71
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 70
+byte 1 80
+byte 1 0
+align 1
+LABELV $1226
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 69
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 71
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $1218
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $1215
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $1212
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 51
+byte 1 0
+align 1
+LABELV $1209
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $1206
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $1203
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 116
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $1200
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 121
+byte 1 95
+byte 1 103
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $1197
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 101
+byte 1 108
+byte 1 100
+byte 1 95
+byte 1 103
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $1194
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 121
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $1191
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 101
+byte 1 108
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $1188
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 121
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $1185
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 101
+byte 1 108
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $1182
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1168
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 48
+byte 1 50
+byte 1 0
+align 1
+LABELV $1165
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 48
+byte 1 49
+byte 1 0
+align 1
+LABELV $1162
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $1159
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1156
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $1153
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 84
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 0
+align 1
+LABELV $1150
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 76
+byte 1 101
+byte 1 103
+byte 1 0
+align 1
+LABELV $1147
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $1146
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1145
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 77
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $1142
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 77
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1139
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 51
+byte 1 0
+align 1
+LABELV $1135
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 50
+byte 1 0
+align 1
+LABELV $1131
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 49
+byte 1 0
+align 1
+LABELV $1128
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1124
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 50
+byte 1 0
+align 1
+LABELV $1120
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 49
+byte 1 0
+align 1
+LABELV $1117
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 116
+byte 1 108
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $1114
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 116
+byte 1 108
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1111
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 67
+byte 1 84
+byte 1 76
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $1108
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 67
+byte 1 84
+byte 1 76
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1100
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 67
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $1097
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 112
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $1094
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $1091
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1088
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 107
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $1085
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 107
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1077
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 101
+byte 1 0
+align 1
+LABELV $1074
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 99
+byte 1 95
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $1070
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 95
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $1066
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 99
+byte 1 95
+byte 1 119
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 0
+align 1
+LABELV $1062
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 95
+byte 1 119
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 0
+align 1
+LABELV $1058
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 99
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1054
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1050
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 99
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $1046
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $1042
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 99
+byte 1 95
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $1038
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 95
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $1034
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 99
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1030
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1026
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 99
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $1022
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $1018
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 99
+byte 1 0
+align 1
+LABELV $1015
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 0
+align 1
+LABELV $1007
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 114
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $1004
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $1000
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 114
+byte 1 95
+byte 1 119
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 0
+align 1
+LABELV $996
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 114
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $992
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 114
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $988
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 114
+byte 1 95
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $984
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 114
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $980
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 114
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $976
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 114
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $972
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 114
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $968
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 114
+byte 1 0
+align 1
+LABELV $959
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 99
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $955
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $951
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 99
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $947
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $943
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $940
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $937
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 104
+byte 1 115
+byte 1 95
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $934
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 104
+byte 1 115
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $931
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 104
+byte 1 115
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $928
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $925
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $922
+byte 1 112
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 121
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 66
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 80
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 121
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $919
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 65
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 0
+align 1
+LABELV $916
+byte 1 112
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 121
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 80
+byte 1 97
+byte 1 100
+byte 1 80
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 80
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 121
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $913
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $910
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $907
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 111
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 0
+align 1
+LABELV $904
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 37
+byte 1 99
+byte 1 0
+align 1
+LABELV $897
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $894
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 66
+byte 1 117
+byte 1 98
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $891
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $888
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $885
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 101
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $882
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 101
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 47
+byte 1 112
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 0
+align 1
+LABELV $879
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 98
+byte 1 95
+byte 1 119
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 104
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $873
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 76
+byte 1 80
+byte 1 83
+byte 1 119
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 104
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $870
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 76
+byte 1 80
+byte 1 83
+byte 1 119
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 104
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $867
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $864
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 47
+byte 1 108
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $856
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $853
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 73
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $850
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 47
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $847
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $844
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 47
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $841
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $838
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 103
+byte 1 0
+align 1
+LABELV $835
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $832
+byte 1 119
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $829
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $826
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $823
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $810
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 97
+byte 1 0
+align 1
+LABELV $805
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $804
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $803
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $802
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $801
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 105
+byte 1 120
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $800
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $799
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $798
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 116
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $797
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 116
+byte 1 119
+byte 1 111
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $796
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $795
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 122
+byte 1 101
+byte 1 114
+byte 1 111
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $792
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 121
+byte 1 47
+byte 1 116
+byte 1 114
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $789
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 101
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $786
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $783
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $780
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $777
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $774
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 98
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $771
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $768
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 121
+byte 1 47
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $765
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 51
+byte 1 0
+align 1
+LABELV $762
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $739
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $735
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $731
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 111
+byte 1 102
+byte 1 116
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $727
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $723
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $719
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 112
+byte 1 101
+byte 1 116
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $715
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 110
+byte 1 107
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $711
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $707
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $704
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $699
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $696
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 112
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 108
+byte 1 47
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $693
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $690
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $687
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $684
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $681
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $678
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $675
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $672
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $669
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 108
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $666
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 107
+byte 1 0
+align 1
+LABELV $663
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 111
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 0
+align 1
+LABELV $660
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $657
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $654
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $651
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $648
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $645
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $642
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $632
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $629
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 47
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $626
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 99
+byte 1 116
+byte 1 108
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 121
+byte 1 95
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 0
+align 1
+LABELV $623
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 99
+byte 1 116
+byte 1 108
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 121
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $620
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 99
+byte 1 116
+byte 1 108
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $617
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 99
+byte 1 116
+byte 1 108
+byte 1 47
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $614
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 99
+byte 1 116
+byte 1 108
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $611
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 99
+byte 1 116
+byte 1 108
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $608
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 99
+byte 1 116
+byte 1 108
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 95
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $605
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 99
+byte 1 116
+byte 1 108
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $602
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 99
+byte 1 116
+byte 1 108
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 95
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $599
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 99
+byte 1 116
+byte 1 108
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $596
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 99
+byte 1 116
+byte 1 108
+byte 1 47
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $593
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 99
+byte 1 116
+byte 1 108
+byte 1 47
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $581
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 47
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $578
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $575
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 95
+byte 1 98
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $571
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $567
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $564
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 98
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $560
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $556
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $548
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 98
+byte 1 98
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $545
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 98
+byte 1 98
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $542
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 98
+byte 1 98
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 121
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $539
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 98
+byte 1 98
+byte 1 47
+byte 1 98
+byte 1 105
+byte 1 103
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $536
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 98
+byte 1 98
+byte 1 47
+byte 1 98
+byte 1 105
+byte 1 103
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $533
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 98
+byte 1 98
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $530
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 98
+byte 1 98
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $522
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 108
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $519
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 108
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 110
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $515
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 108
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 95
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $507
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 47
+byte 1 100
+byte 1 109
+byte 1 47
+byte 1 116
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $504
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 47
+byte 1 100
+byte 1 109
+byte 1 47
+byte 1 116
+byte 1 119
+byte 1 111
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $501
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 47
+byte 1 100
+byte 1 109
+byte 1 47
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $488
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 100
+byte 1 109
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $485
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 100
+byte 1 109
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $482
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 100
+byte 1 109
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $479
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 100
+byte 1 109
+byte 1 47
+byte 1 98
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 108
+byte 1 117
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $471
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 99
+byte 1 47
+byte 1 116
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $468
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 99
+byte 1 47
+byte 1 116
+byte 1 119
+byte 1 111
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $465
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 99
+byte 1 47
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 0
+align 1
+LABELV $457
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 99
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $454
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 99
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 103
+byte 1 111
+byte 1 100
+byte 1 0
+align 1
+LABELV $451
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 99
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $448
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $444
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $440
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $436
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $432
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 105
+byte 1 120
+byte 1 0
+align 1
+LABELV $428
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $424
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 0
+align 1
+LABELV $406
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 99
+byte 1 47
+byte 1 119
+byte 1 104
+byte 1 111
+byte 1 95
+byte 1 105
+byte 1 115
+byte 1 0
+align 1
+LABELV $402
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 99
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 117
+byte 1 112
+byte 1 105
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $398
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 99
+byte 1 47
+byte 1 111
+byte 1 109
+byte 1 103
+byte 1 0
+align 1
+LABELV $394
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 99
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $391
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 99
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 99
+byte 1 0
+align 1
+LABELV $388
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 99
+byte 1 47
+byte 1 103
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 98
+byte 1 121
+byte 1 101
+byte 1 0
+align 1
+LABELV $384
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 99
+byte 1 47
+byte 1 110
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 95
+byte 1 100
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $375
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 115
+byte 1 117
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 110
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $372
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 47
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 101
+byte 1 108
+byte 1 100
+byte 1 95
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $369
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $366
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $363
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $360
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $357
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 116
+byte 1 119
+byte 1 111
+byte 1 0
+align 1
+LABELV $354
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 116
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 0
+align 1
+LABELV $351
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $347
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 108
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $343
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 108
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 0
+align 1
+LABELV $340
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 95
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $337
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 47
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $334
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $328
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $294
+byte 1 91
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 112
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 105
+byte 1 102
+byte 1 121
+byte 1 93
+byte 1 0
+align 1
+LABELV $237
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $236
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $235
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $234
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $233
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $228
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $220
+byte 1 40
+byte 1 73
+byte 1 67
+byte 1 79
+byte 1 78
+byte 1 95
+byte 1 65
+byte 1 82
+byte 1 82
+byte 1 79
+byte 1 87
+byte 1 32
+byte 1 124
+byte 1 32
+byte 1 73
+byte 1 67
+byte 1 79
+byte 1 78
+byte 1 95
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 79
+byte 1 79
+byte 1 78
+byte 1 32
+byte 1 124
+byte 1 32
+byte 1 73
+byte 1 67
+byte 1 79
+byte 1 78
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 32
+byte 1 124
+byte 1 32
+byte 1 73
+byte 1 67
+byte 1 79
+byte 1 78
+byte 1 95
+byte 1 72
+byte 1 69
+byte 1 65
+byte 1 76
+byte 1 84
+byte 1 72
+byte 1 83
+byte 1 84
+byte 1 65
+byte 1 84
+byte 1 73
+byte 1 79
+byte 1 78
+byte 1 32
+byte 1 124
+byte 1 32
+byte 1 73
+byte 1 67
+byte 1 79
+byte 1 78
+byte 1 95
+byte 1 83
+byte 1 80
+byte 1 82
+byte 1 65
+byte 1 89
+byte 1 82
+byte 1 79
+byte 1 79
+byte 1 77
+byte 1 41
+byte 1 0
+align 1
+LABELV $219
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $218
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $217
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 66
+byte 1 66
+byte 1 111
+byte 1 120
+byte 1 0
+align 1
+LABELV $216
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 86
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $215
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 76
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $214
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $213
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 107
+byte 1 121
+byte 1 76
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $212
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 107
+byte 1 121
+byte 1 0
+align 1
+LABELV $211
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 82
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 0
+align 1
+LABELV $210
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 82
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 0
+align 1
+LABELV $209
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $208
+byte 1 0
+align 1
+LABELV $207
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $206
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 67
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 76
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 66
+byte 1 111
+byte 1 120
+byte 1 0
+align 1
+LABELV $205
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 67
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 95
+byte 1 104
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 72
+byte 1 85
+byte 1 68
+byte 1 0
+align 1
+LABELV $204
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 76
+byte 1 80
+byte 1 83
+byte 1 119
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 104
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 65
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $203
+byte 1 49
+byte 1 46
+byte 1 48
+byte 1 0
+align 1
+LABELV $202
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 76
+byte 1 80
+byte 1 83
+byte 1 119
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 104
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $201
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 105
+byte 1 103
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $200
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 65
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 83
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $199
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 76
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $198
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $197
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $196
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $195
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 70
+byte 1 70
+byte 1 65
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 0
+align 1
+LABELV $194
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 68
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $193
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 82
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $192
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 80
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $191
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 105
+byte 1 103
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $190
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 53
+byte 1 0
+align 1
+LABELV $189
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $188
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $187
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 84
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $186
+byte 1 56
+byte 1 0
+align 1
+LABELV $185
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $184
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $183
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $182
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $181
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 80
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $180
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $179
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 70
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $178
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 70
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 69
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $177
+byte 1 53
+byte 1 48
+byte 1 0
+align 1
+LABELV $176
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 79
+byte 1 114
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $175
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 79
+byte 1 114
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $174
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 121
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 114
+byte 1 111
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $173
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $172
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 105
+byte 1 108
+byte 1 100
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 0
+align 1
+LABELV $171
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 79
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $170
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $169
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $168
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $167
+byte 1 52
+byte 1 0
+align 1
+LABELV $166
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $165
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 65
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $164
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $163
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $162
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $161
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 72
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $160
+byte 1 51
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $159
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $158
+byte 1 55
+byte 1 0
+align 1
+LABELV $157
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 66
+byte 1 101
+byte 1 101
+byte 1 112
+byte 1 0
+align 1
+LABELV $156
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $155
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 65
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $154
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 82
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $153
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $152
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 119
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $151
+byte 1 48
+byte 1 46
+byte 1 52
+byte 1 0
+align 1
+LABELV $150
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $149
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $148
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $147
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $146
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $145
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $144
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $143
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $142
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $141
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $140
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 0
+align 1
+LABELV $139
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $138
+byte 1 48
+byte 1 46
+byte 1 51
+byte 1 0
+align 1
+LABELV $137
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $136
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $135
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $134
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $133
+byte 1 48
+byte 1 46
+byte 1 48
+byte 1 48
+byte 1 53
+byte 1 0
+align 1
+LABELV $132
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $131
+byte 1 48
+byte 1 46
+byte 1 48
+byte 1 48
+byte 1 50
+byte 1 0
+align 1
+LABELV $130
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $129
+byte 1 51
+byte 1 0
+align 1
+LABELV $128
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $127
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 90
+byte 1 0
+align 1
+LABELV $126
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 89
+byte 1 0
+align 1
+LABELV $125
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 88
+byte 1 0
+align 1
+LABELV $124
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $123
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 115
+byte 1 0
+align 1
+LABELV $122
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $121
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 89
+byte 1 0
+align 1
+LABELV $120
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 88
+byte 1 0
+align 1
+LABELV $119
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $118
+byte 1 50
+byte 1 52
+byte 1 0
+align 1
+LABELV $117
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $116
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 82
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $115
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $114
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $113
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $112
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $111
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 73
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $110
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 51
+byte 1 100
+byte 1 73
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $109
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $108
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 80
+byte 1 83
+byte 1 0
+align 1
+LABELV $107
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $106
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $105
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 50
+byte 1 68
+byte 1 0
+align 1
+LABELV $104
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 0
+align 1
+LABELV $103
+byte 1 57
+byte 1 48
+byte 1 0
+align 1
+LABELV $102
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 0
+align 1
+LABELV $101
+byte 1 50
+byte 1 50
+byte 1 46
+byte 1 53
+byte 1 0
+align 1
+LABELV $100
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 0
+align 1
+LABELV $99
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $98
+byte 1 49
+byte 1 0
+align 1
+LABELV $97
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $96
+byte 1 48
+byte 1 0
+align 1
+LABELV $95
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $92
+byte 1 118
+byte 1 109
+byte 1 77
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
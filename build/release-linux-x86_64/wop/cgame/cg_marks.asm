@@ -0,0 +1,3391 @@
+export CG_InitMarkPolys
+code
+proc CG_InitMarkPolys 12 12
+ADDRGP4 cg_markPolys
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 161792
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $82
+CNSTI4 932
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_markCache+32
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $83
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $82
+ADDRGP4 cg_activeMarkPolys+4
+ADDRGP4 cg_activeMarkPolys
+ASGNP4
+ADDRLP4 4
+ADDRGP4 cg_activeMarkPolys
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 cg_freeMarkPolys
+ADDRGP4 cg_markPolys
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $88
+ADDRLP4 8
+CNSTI4 316
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg_markPolys+4
+ADDP4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg_markPolys+316
+ADDP4
+ASGNP4
+LABELV $89
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 511
+LTI4 $88
+LABELV $81
+endproc CG_InitMarkPolys 12 12
+export CG_FreeMarkPoly
+proc CG_FreeMarkPoly 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $95
+ADDRGP4 $97
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $95
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg_freeMarkPolys
+INDIRP4
+ASGNP4
+ADDRGP4 cg_freeMarkPolys
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $94
+endproc CG_FreeMarkPoly 12 4
+export CG_AllocMark
+proc CG_AllocMark 16 12
+ADDRGP4 cg_freeMarkPolys
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $99
+ADDRLP4 4
+ADDRGP4 cg_activeMarkPolys
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $102
+JUMPV
+LABELV $101
+ADDRGP4 cg_activeMarkPolys
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeMarkPoly
+CALLV
+pop
+LABELV $102
+ADDRLP4 8
+ADDRGP4 cg_activeMarkPolys
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $104
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+EQI4 $101
+LABELV $104
+LABELV $99
+ADDRLP4 8
+ADDRGP4 cg_freeMarkPolys
+ASGNP4
+ADDRLP4 12
+ADDRLP4 8
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 316
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg_activeMarkPolys+4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 cg_activeMarkPolys
+ASGNP4
+ADDRGP4 cg_activeMarkPolys+4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_activeMarkPolys+4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $98
+endproc CG_AllocMark 16 12
+proc CG_CachedMarkFragments 52 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 36
+ADDRFP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTU4 73856093
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIU4 4
+MULU4
+CNSTU4 19349663
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CVFI4 4
+CVIU4 4
+MULU4
+BXORU4
+CNSTU4 83492791
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CVFI4 4
+CVIU4 4
+MULU4
+BXORU4
+ASGNU4
+ADDRLP4 4
+CNSTU4 932
+ADDRLP4 16
+INDIRU4
+ADDRLP4 16
+INDIRU4
+CNSTI4 16
+RSHU4
+BXORU4
+CNSTU4 31
+BANDU4
+MULU4
+ADDRGP4 cg_markCache
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $109
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $109
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $109
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+NEF4 $109
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+NEF4 $109
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRFP4 32
+INDIRI4
+GTI4 $109
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 $114
+JUMPV
+LABELV $111
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $112
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $114
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+LTI4 $111
+ADDRLP4 8
+INDIRI4
+ADDRFP4 24
+INDIRI4
+GTI4 $115
+ADDRFP4 36
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CVIU4 4
+CNSTI4 3
+LSHU4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 164
+ADDP4
+ARGP4
+CNSTU4 12
+ADDRLP4 8
+INDIRI4
+CVIU4 4
+MULU4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $108
+JUMPV
+LABELV $115
+LABELV $109
+CNSTI4 4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRFP4 32
+INDIRI4
+ARGI4
+ADDRFP4 36
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 trap_CM_MarkFragments
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 $120
+JUMPV
+LABELV $117
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 36
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $118
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $120
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $117
+ADDRLP4 12
+INDIRI4
+CNSTI4 16
+GTI4 $123
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+LEI4 $121
+LABELV $123
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $108
+JUMPV
+LABELV $121
+ADDRLP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRFP4 36
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+CVIU4 4
+CNSTI4 3
+LSHU4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 164
+ADDP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+CNSTU4 12
+ADDRLP4 8
+INDIRI4
+CVIU4 4
+MULU4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $108
+endproc CG_CachedMarkFragments 52 28
+export CG_ImpactMark
+proc CG_ImpactMark 6104 40
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 20
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 24
+ADDRFP4 24
+INDIRF4
+ASGNF4
+ADDRFP4 28
+ADDRFP4 28
+INDIRF4
+ASGNF4
+ADDRFP4 32
+ADDRFP4 32
+INDIRI4
+ASGNI4
+ADDRFP4 36
+ADDRFP4 36
+INDIRF4
+ASGNF4
+ADDRFP4 40
+ADDRFP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 cg_addMarks+12
+INDIRI4
+CNSTI4 0
+NEI4 $125
+ADDRGP4 $124
+JUMPV
+LABELV $125
+ADDRFP4 36
+INDIRF4
+CNSTF4 0
+GTF4 $128
+ADDRGP4 $130
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $128
+ADDRLP4 4664
+ADDRGP4 cg_activeMarkPolys+4
+INDIRP4
+ASGNP4
+ADDRGP4 $135
+JUMPV
+LABELV $132
+ADDRLP4 4728
+ADDRLP4 4664
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $136
+ADDRGP4 $134
+JUMPV
+LABELV $136
+ADDRLP4 4664
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRGP4 cgs+160652+636
+INDIRI4
+NEI4 $138
+ADDRGP4 $133
+JUMPV
+LABELV $138
+ADDRLP4 4716
+ADDRLP4 4664
+INDIRP4
+CNSTI4 288
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4716+4
+ADDRLP4 4664
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4716+8
+ADDRLP4 4664
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 36
+INDIRF4
+ADDRLP4 4664
+INDIRP4
+CNSTI4 300
+ADDP4
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+GTF4 $144
+ADDRLP4 4716
+ARGP4
+ADDRLP4 5780
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 5780
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 36
+INDIRF4
+ADDRLP4 4664
+INDIRP4
+CNSTI4 300
+ADDP4
+INDIRF4
+ADDF4
+MULF4
+GEF4 $144
+ADDRLP4 4664
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeMarkPoly
+CALLV
+pop
+LABELV $144
+LABELV $133
+ADDRLP4 4664
+ADDRLP4 4728
+INDIRP4
+ASGNP4
+LABELV $135
+ADDRLP4 4664
+INDIRP4
+CVPU4 4
+ADDRGP4 cg_activeMarkPolys
+CVPU4 4
+NEU4 $132
+LABELV $134
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize2
+CALLF4
+pop
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 PerpendicularVector
+CALLV
+pop
+ADDRLP4 0+24
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 0+12
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 RotatePointAroundVector
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 0+24
+ARGP4
+ADDRLP4 0+12
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 48
+CNSTF4 1056964608
+ADDRFP4 36
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+LABELV $151
+ADDRLP4 5772
+ADDRLP4 44
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 5772
+INDIRI4
+ADDRLP4 4668
+ADDP4
+ADDRLP4 5772
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRFP4 36
+INDIRF4
+ADDRLP4 5772
+INDIRI4
+ADDRLP4 0+12
+ADDP4
+INDIRF4
+MULF4
+SUBF4
+ADDRFP4 36
+INDIRF4
+ADDRLP4 5772
+INDIRI4
+ADDRLP4 0+24
+ADDP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 5780
+ADDRLP4 44
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 5780
+INDIRI4
+ADDRLP4 4668+12
+ADDP4
+ADDRLP4 5780
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRFP4 36
+INDIRF4
+ADDRLP4 5780
+INDIRI4
+ADDRLP4 0+12
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 36
+INDIRF4
+ADDRLP4 5780
+INDIRI4
+ADDRLP4 0+24
+ADDP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 5788
+ADDRLP4 44
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 5788
+INDIRI4
+ADDRLP4 4668+24
+ADDP4
+ADDRLP4 5788
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRFP4 36
+INDIRF4
+ADDRLP4 5788
+INDIRI4
+ADDRLP4 0+12
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 36
+INDIRF4
+ADDRLP4 5788
+INDIRI4
+ADDRLP4 0+24
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 5796
+ADDRLP4 44
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 5796
+INDIRI4
+ADDRLP4 4668+36
+ADDP4
+ADDRLP4 5796
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRFP4 36
+INDIRF4
+ADDRLP4 5796
+INDIRI4
+ADDRLP4 0+12
+ADDP4
+INDIRF4
+MULF4
+SUBF4
+ADDRFP4 36
+INDIRF4
+ADDRLP4 5796
+INDIRI4
+ADDRLP4 0+24
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $152
+ADDRLP4 44
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 3
+LTI4 $151
+ADDRLP4 5772
+CNSTF4 3248488448
+ASGNF4
+ADDRLP4 4736
+ADDRLP4 5772
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4736+4
+ADDRLP4 5772
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4736+8
+CNSTF4 3248488448
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $168
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRFP4 36
+INDIRF4
+ARGF4
+ADDRLP4 4668
+ARGP4
+ADDRLP4 4736
+ARGP4
+CNSTI4 384
+ARGI4
+ADDRLP4 52
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 4748
+ARGP4
+ADDRLP4 5780
+ADDRGP4 CG_CachedMarkFragments
+CALLI4
+ASGNI4
+ADDRLP4 4732
+ADDRLP4 5780
+INDIRI4
+ASGNI4
+ADDRGP4 $169
+JUMPV
+LABELV $168
+CNSTI4 4
+ARGI4
+ADDRLP4 4668
+ARGP4
+ADDRLP4 4736
+ARGP4
+CNSTI4 384
+ARGI4
+ADDRLP4 52
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 4748
+ARGP4
+ADDRLP4 5780
+ADDRGP4 trap_CM_MarkFragments
+CALLI4
+ASGNI4
+ADDRLP4 4732
+ADDRLP4 5780
+INDIRI4
+ASGNI4
+LABELV $169
+ADDRLP4 4732
+INDIRI4
+CNSTI4 0
+NEI4 $170
+ADDRFP4 0
+INDIRI4
+ADDRGP4 cgs+160652+636
+INDIRI4
+NEI4 $170
+ADDRLP4 4732
+CNSTI4 1
+ASGNI4
+ADDRLP4 4748
+CNSTI4 0
+ASGNI4
+ADDRLP4 4748+4
+CNSTI4 4
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+LABELV $175
+ADDRLP4 5780
+CNSTI4 12
+ADDRLP4 44
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 5780
+INDIRI4
+ADDRLP4 52
+ADDP4
+ADDRLP4 5780
+INDIRI4
+ADDRLP4 4668
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $176
+ADDRLP4 44
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 4
+LTI4 $175
+LABELV $170
+ADDRLP4 5788
+CNSTF4 1132396544
+ADDRFP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 5792
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 5788
+INDIRF4
+ADDRLP4 5792
+INDIRF4
+LTF4 $180
+ADDRLP4 5780
+ADDRLP4 5788
+INDIRF4
+ADDRLP4 5792
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $181
+JUMPV
+LABELV $180
+ADDRLP4 5780
+ADDRLP4 5788
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $181
+ADDRLP4 4660
+ADDRLP4 5780
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 5796
+CNSTF4 1132396544
+ADDRFP4 20
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 5800
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 5796
+INDIRF4
+ADDRLP4 5800
+INDIRF4
+LTF4 $184
+ADDRLP4 5784
+ADDRLP4 5796
+INDIRF4
+ADDRLP4 5800
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $185
+JUMPV
+LABELV $184
+ADDRLP4 5784
+ADDRLP4 5796
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $185
+ADDRLP4 4660+1
+ADDRLP4 5784
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 5808
+CNSTF4 1132396544
+ADDRFP4 24
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 5812
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 5808
+INDIRF4
+ADDRLP4 5812
+INDIRF4
+LTF4 $188
+ADDRLP4 5804
+ADDRLP4 5808
+INDIRF4
+ADDRLP4 5812
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $189
+JUMPV
+LABELV $188
+ADDRLP4 5804
+ADDRLP4 5808
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $189
+ADDRLP4 4660+2
+ADDRLP4 5804
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 5820
+CNSTF4 1132396544
+ADDRFP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 5824
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 5820
+INDIRF4
+ADDRLP4 5824
+INDIRF4
+LTF4 $192
+ADDRLP4 5816
+ADDRLP4 5820
+INDIRF4
+ADDRLP4 5824
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $193
+JUMPV
+LABELV $192
+ADDRLP4 5816
+ADDRLP4 5820
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $193
+ADDRLP4 4660+3
+ADDRLP4 5816
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+ADDRLP4 4748
+ASGNP4
+ADDRGP4 $197
+JUMPV
+LABELV $194
+ADDRLP4 40
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 10
+LEI4 $198
+ADDRLP4 40
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 10
+ASGNI4
+LABELV $198
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 5828
+ADDRLP4 5836
+ASGNP4
+ADDRGP4 $203
+JUMPV
+LABELV $200
+ADDRLP4 5828
+INDIRP4
+CNSTI4 12
+ADDRLP4 40
+INDIRP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+ADDI4
+MULI4
+ADDRLP4 52
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 6076
+ADDRLP4 5828
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 6096
+CNSTI4 4
+ASGNI4
+ADDRLP4 6076+4
+ADDRLP4 5828
+INDIRP4
+ADDRLP4 6096
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 6096
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 6100
+CNSTI4 8
+ASGNI4
+ADDRLP4 6076+8
+ADDRLP4 5828
+INDIRP4
+ADDRLP4 6100
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 6100
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 5828
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 6076
+INDIRF4
+ADDRLP4 0+12
+INDIRF4
+MULF4
+ADDRLP4 6076+4
+INDIRF4
+ADDRLP4 0+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 6076+8
+INDIRF4
+ADDRLP4 0+12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 48
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRLP4 5828
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 6076
+INDIRF4
+ADDRLP4 0+24
+INDIRF4
+MULF4
+ADDRLP4 6076+4
+INDIRF4
+ADDRLP4 0+24+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 6076+8
+INDIRF4
+ADDRLP4 0+24+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 48
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRLP4 5828
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 4660
+INDIRI4
+ASGNI4
+LABELV $201
+ADDRLP4 36
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 5828
+ADDRLP4 5828
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+LABELV $203
+ADDRLP4 36
+INDIRI4
+ADDRLP4 40
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $200
+ADDRFP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $220
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 5836
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+ADDRGP4 $195
+JUMPV
+LABELV $220
+ADDRLP4 6076
+ADDRGP4 CG_AllocMark
+CALLP4
+ASGNP4
+ADDRLP4 5832
+ADDRLP4 6076
+INDIRP4
+ASGNP4
+ADDRLP4 5832
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRLP4 5832
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 5832
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 5832
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 40
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 5832
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 5832
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 5832
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 5832
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRFP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 5832
+INDIRP4
+CNSTI4 300
+ADDP4
+ADDRFP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 5832
+INDIRP4
+CNSTI4 288
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 5832
+INDIRP4
+CNSTI4 304
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 5832
+INDIRP4
+CNSTI4 308
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1082130432
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 5832
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1082130432
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 5832
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRLP4 5836
+ARGP4
+CNSTU4 24
+ADDRLP4 40
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIU4 4
+MULU4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 6080
+ADDRGP4 markTotal
+ASGNP4
+ADDRLP4 6080
+INDIRP4
+ADDRLP4 6080
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $195
+ADDRLP4 44
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 40
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+LABELV $197
+ADDRLP4 44
+INDIRI4
+ADDRLP4 4732
+INDIRI4
+LTI4 $194
+LABELV $124
+endproc CG_ImpactMark 6104 40
+export CG_PortalInView
+proc CG_PortalInView 4 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $229
+JUMPV
+LABELV $226
+CNSTI4 208
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 516
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $231
+CNSTI4 1
+RETI4
+ADDRGP4 $225
+JUMPV
+LABELV $231
+LABELV $227
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $229
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 512
+ADDP4
+INDIRI4
+LTI4 $226
+CNSTI4 0
+RETI4
+LABELV $225
+endproc CG_PortalInView 4 0
+export CG_AddMarks
+proc CG_AddMarks 112 12
+ADDRGP4 cg_addMarks+12
+INDIRI4
+CNSTI4 0
+NEI4 $235
+ADDRGP4 $234
+JUMPV
+LABELV $235
+ADDRLP4 44
+ADDRGP4 CG_PortalInView
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $239
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRGP4 $240
+JUMPV
+LABELV $239
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+LABELV $240
+ADDRLP4 20
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg_activeMarkPolys+4
+INDIRP4
+ASGNP4
+ADDRGP4 $247
+JUMPV
+LABELV $244
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $248
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 10000
+ADDI4
+GTI4 $248
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg_activeMarkPolys+4
+INDIRP4
+CVPU4 4
+EQU4 $254
+ADDRLP4 0
+INDIRP4
+CNSTI4 304
+ADDP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 56
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $251
+LABELV $254
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+CNSTI4 304
+ADDP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 60
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+110648+24
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_R_inPVS
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 64
+INDIRI4
+ASGNI4
+LABELV $251
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $257
+ADDRGP4 $245
+JUMPV
+LABELV $257
+LABELV $248
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRGP4 cgs+160652+636
+INDIRI4
+NEI4 $259
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 10000
+ADDI4
+LEI4 $263
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeMarkPoly
+CALLV
+pop
+ADDRGP4 $245
+JUMPV
+LABELV $263
+ADDRLP4 52
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 8000
+SUBI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+LTI4 $266
+ADDRLP4 8
+CNSTF4 1065353216
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+CNSTF4 1157234688
+DIVF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 0
+EQI4 $269
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $274
+JUMPV
+LABELV $271
+ADDRLP4 64
+CNSTI4 20
+ASGNI4
+ADDRLP4 68
+ADDRLP4 0
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 72
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+LTF4 $276
+ADDRLP4 56
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $277
+JUMPV
+LABELV $276
+ADDRLP4 56
+ADDRLP4 68
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $277
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+ADDRLP4 56
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 84
+CNSTI4 24
+ASGNI4
+ADDRLP4 88
+ADDRLP4 0
+INDIRP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 92
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 92
+INDIRF4
+LTF4 $279
+ADDRLP4 76
+ADDRLP4 88
+INDIRF4
+ADDRLP4 92
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $280
+JUMPV
+LABELV $279
+ADDRLP4 76
+ADDRLP4 88
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $280
+ADDRLP4 84
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDP4
+CNSTI4 21
+ADDP4
+ADDRLP4 76
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 104
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 108
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 104
+INDIRF4
+ADDRLP4 108
+INDIRF4
+LTF4 $282
+ADDRLP4 96
+ADDRLP4 104
+INDIRF4
+ADDRLP4 108
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $283
+JUMPV
+LABELV $282
+ADDRLP4 96
+ADDRLP4 104
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $283
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDP4
+CNSTI4 22
+ADDP4
+ADDRLP4 96
+INDIRU4
+CVUU1 4
+ASGNU1
+LABELV $272
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $274
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+LTI4 $271
+LABELV $269
+LABELV $266
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRGP4 CG_AddPolyBatched
+CALLV
+pop
+ADDRGP4 $245
+JUMPV
+LABELV $259
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 10000
+ADDI4
+LEI4 $284
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeMarkPoly
+CALLV
+pop
+ADDRGP4 $245
+JUMPV
+LABELV $284
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRGP4 cgs+160652+312
+INDIRI4
+NEI4 $287
+ADDRLP4 52
+CNSTF4 1138819072
+ASGNF4
+ADDRLP4 8
+ADDRLP4 52
+INDIRF4
+ADDRLP4 52
+INDIRF4
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1161527296
+DIVF4
+MULF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 255
+GEI4 $292
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GEI4 $294
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $294
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 0
+EQI4 $296
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $301
+JUMPV
+LABELV $298
+ADDRLP4 64
+CNSTI4 20
+ASGNI4
+ADDRLP4 68
+ADDRLP4 0
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 72
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+LTF4 $303
+ADDRLP4 56
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $304
+JUMPV
+LABELV $303
+ADDRLP4 56
+ADDRLP4 68
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $304
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+ADDRLP4 56
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 84
+CNSTI4 24
+ASGNI4
+ADDRLP4 88
+ADDRLP4 0
+INDIRP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 92
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 92
+INDIRF4
+LTF4 $306
+ADDRLP4 76
+ADDRLP4 88
+INDIRF4
+ADDRLP4 92
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $307
+JUMPV
+LABELV $306
+ADDRLP4 76
+ADDRLP4 88
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $307
+ADDRLP4 84
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDP4
+CNSTI4 21
+ADDP4
+ADDRLP4 76
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 104
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 108
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 104
+INDIRF4
+ADDRLP4 108
+INDIRF4
+LTF4 $309
+ADDRLP4 96
+ADDRLP4 104
+INDIRF4
+ADDRLP4 108
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $310
+JUMPV
+LABELV $309
+ADDRLP4 96
+ADDRLP4 104
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $310
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDP4
+CNSTI4 22
+ADDP4
+ADDRLP4 96
+INDIRU4
+CVUU1 4
+ASGNU1
+LABELV $299
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $301
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+LTI4 $298
+LABELV $296
+LABELV $292
+LABELV $287
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 10000
+ADDI4
+ADDRGP4 cg+107612
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1000
+GEI4 $312
+ADDRLP4 8
+CNSTI4 255
+ADDRLP4 12
+INDIRI4
+MULI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $314
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $319
+JUMPV
+LABELV $316
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDP4
+CNSTI4 23
+ADDP4
+ADDRLP4 8
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+LABELV $317
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $319
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+LTI4 $316
+ADDRGP4 $315
+JUMPV
+LABELV $314
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $323
+JUMPV
+LABELV $320
+ADDRLP4 60
+CNSTI4 20
+ASGNI4
+ADDRLP4 64
+ADDRLP4 0
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 68
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 64
+INDIRF4
+ADDRLP4 68
+INDIRF4
+LTF4 $325
+ADDRLP4 52
+ADDRLP4 64
+INDIRF4
+ADDRLP4 68
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $326
+JUMPV
+LABELV $325
+ADDRLP4 52
+ADDRLP4 64
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $326
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ADDRLP4 52
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 80
+CNSTI4 24
+ASGNI4
+ADDRLP4 84
+ADDRLP4 0
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 88
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 88
+INDIRF4
+LTF4 $328
+ADDRLP4 72
+ADDRLP4 84
+INDIRF4
+ADDRLP4 88
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $329
+JUMPV
+LABELV $328
+ADDRLP4 72
+ADDRLP4 84
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $329
+ADDRLP4 80
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDP4
+CNSTI4 21
+ADDP4
+ADDRLP4 72
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 100
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 104
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 100
+INDIRF4
+ADDRLP4 104
+INDIRF4
+LTF4 $331
+ADDRLP4 92
+ADDRLP4 100
+INDIRF4
+ADDRLP4 104
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $332
+JUMPV
+LABELV $331
+ADDRLP4 92
+ADDRLP4 100
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $332
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDP4
+CNSTI4 22
+ADDP4
+ADDRLP4 92
+INDIRU4
+CVUU1 4
+ASGNU1
+LABELV $321
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $323
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+LTI4 $320
+LABELV $315
+LABELV $312
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRGP4 CG_AddPolyBatched
+CALLV
+pop
+LABELV $245
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+LABELV $247
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg_activeMarkPolys
+CVPU4 4
+NEU4 $244
+ADDRGP4 CG_FlushSceneBatches
+CALLV
+pop
+LABELV $234
+endproc CG_AddMarks 112 12
+bss
+align 4
+LABELV cg_markCache
+skip 29824
+align 4
+LABELV markTotal
+skip 4
+export cg_freeMarkPolys
+align 4
+LABELV cg_freeMarkPolys
+skip 4
+export cg_activeMarkPolys
+align 4
+LABELV cg_activeMarkPolys
+skip 316
+import CG_AddBoundingBox
+import CG_AddBoundingBoxEntity
+import CG_QueryCvar
+import CG_Timestamp
+import CG_LimitCvars
+import trap_RealTime
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import trap_R_inPVS
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_Cutscene2d_Draw
+import CG_Cutscene2d_UpdateTrans
+import CG_Cutscene2d_CheckCmd
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import Main_SpriteParticles
+import LaunchRevivalParticle
+import LaunchSpeedyPuffTrail
+import Init_SpriteParticles
+import AddLFsToScreen
+import AddLFToDrawList
+import Init_LensFlareSys
+import DumpPolyInfo
+import ActiveChooseLogoMenu
+import FindLogoForSpraying
+import Add_LogoToDrawList
+import AddLogosToScene
+import Init_SprayLogoSys
+import Calculate_2DOfDIR
+import Calculate_2DOf3D
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_ChangeLoadingProgress
+import CG_LoadingString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_ScorePlum
+import CG_TeleOutEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_GenerateParticles
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_GetWaterMuzzle
+import CG_SprayTrail
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponSRWC
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_Boomies_Explosion
+import CG_BamBam_Explosion
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_LerpTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayer
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_UpdateVoipTeamIDs
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Draw3DModel
+import CG_SetPrintString
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import CG_MessagePrint
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_WorldToScreen
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_DrawPic1024
+import CG_DrawRect1024
+import CG_FillRect1024
+import CG_AdjustFrom1024
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddPolyBatched
+import CG_AddRefEntityBatched
+import CG_FlushSceneBatches
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_ForceModelChange
+import CG_GetCvarFloat
+import CG_GetCvarInt
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StreamAssets
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_icons
+import cg_ambient
+import cg_drawBBox
+import cg_drawVoiceNames
+import cg_drawLensflare
+import cg_timestamps
+import cg_skyLensflare
+import cg_sky
+import cg_curWarmupReady
+import cg_warmupReady
+import cg_glowModelTeam
+import cg_glowModel
+import cg_cineDrawLetterBox
+import cg_cineHideHud
+import cg_LPSwallhackAlpha
+import cg_LPSwallhackSize
+import cg_bigScoreType
+import cg_thirdPersonAutoSwitch
+import cg_drawTimeLeft
+import cg_drawServerInfos
+import cg_drawMessages
+import cg_drawups
+import cg_wopFFAhud
+import cg_printDir
+import cg_drawRealTime
+import cg_correctedWeaponPos
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_streamAssets
+import cg_deferPlayers
+import cg_predictItems
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_chatBeep
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_optimizePrediction
+import cg_nopredict
+import cg_errorDecay
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+export cg_markPolys
+align 4
+LABELV cg_markPolys
+skip 161792
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import trailEnt
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $130
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 73
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 77
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 60
+byte 1 61
+byte 1 32
+byte 1 48
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $97
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 76
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
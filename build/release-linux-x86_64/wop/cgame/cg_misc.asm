@@ -0,0 +1,3135 @@
+export CG_LimitCvars
+code
+proc CG_LimitCvars 24 8
+ADDRGP4 $83
+ARGP4
+ADDRLP4 4
+ADDRGP4 CG_GetCvarInt
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $81
+ADDRGP4 $80
+JUMPV
+LABELV $81
+ADDRGP4 $84
+ARGP4
+ADDRGP4 $85
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $88
+ARGP4
+ADDRLP4 8
+ADDRGP4 CG_GetCvarInt
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 25000
+GEI4 $86
+ADDRGP4 $88
+ARGP4
+ADDRGP4 $89
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $86
+ADDRGP4 $90
+ARGP4
+ADDRLP4 12
+ADDRGP4 CG_GetCvarInt
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 20
+GEI4 $91
+ADDRLP4 0
+CNSTI4 20
+ASGNI4
+ADDRGP4 $90
+ARGP4
+ADDRGP4 $93
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $92
+JUMPV
+LABELV $91
+ADDRLP4 0
+INDIRI4
+CNSTI4 250
+LEI4 $94
+ADDRLP4 0
+CNSTI4 250
+ASGNI4
+ADDRGP4 $90
+ARGP4
+ADDRGP4 $96
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $94
+LABELV $92
+ADDRGP4 $99
+ARGP4
+ADDRLP4 16
+ADDRGP4 CG_GetCvarInt
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+MODI4
+CNSTI4 0
+EQI4 $97
+ADDRGP4 $100
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $99
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $97
+LABELV $80
+endproc CG_LimitCvars 24 8
+export CG_Timestamp
+proc CG_Timestamp 40 24
+ADDRGP4 cg_timestamps+12
+INDIRI4
+CNSTI4 1
+NEI4 $102
+ADDRLP4 12
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 cgs+34908
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 60
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 24
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 10
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 36
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRGP4 $107
+ARGP4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $103
+JUMPV
+LABELV $102
+ADDRGP4 cg_timestamps+12
+INDIRI4
+CNSTI4 2
+NEI4 $108
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_RealTime
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRGP4 $107
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 36
+CNSTI4 10
+ASGNI4
+ADDRLP4 0+4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+DIVI4
+ADDRLP4 36
+INDIRI4
+MODI4
+ARGI4
+ADDRLP4 0+4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+MODI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $109
+JUMPV
+LABELV $108
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $114
+ARGP4
+ADDRFP4 4
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $109
+LABELV $103
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $101
+endproc CG_Timestamp 40 24
+export CG_QueryCvar
+proc CG_QueryCvar 2084 20
+ADDRLP4 2080
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 2080
+INDIRI4
+CNSTI4 2
+GEI4 $116
+ADDRGP4 $115
+JUMPV
+LABELV $116
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 1056
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $118
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 1056
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $115
+endproc CG_QueryCvar 2084 20
+proc CG_ColorByEntityType 4 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $120
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+GTI4 $120
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $133
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $133
+address $122
+address $123
+address $124
+address $125
+address $126
+address $127
+address $128
+address $129
+address $130
+address $131
+address $132
+code
+LABELV $120
+ADDRFP4 4
+INDIRP4
+CNSTU1 220
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+CNSTU1 220
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 2
+ADDP4
+CNSTU1 100
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 3
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRGP4 $121
+JUMPV
+LABELV $122
+ADDRFP4 4
+INDIRP4
+CNSTU1 255
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 2
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 3
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRGP4 $121
+JUMPV
+LABELV $123
+ADDRFP4 4
+INDIRP4
+CNSTU1 192
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 2
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 3
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRGP4 $121
+JUMPV
+LABELV $124
+ADDRFP4 4
+INDIRP4
+CNSTU1 128
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 2
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 3
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRGP4 $121
+JUMPV
+LABELV $125
+ADDRFP4 4
+INDIRP4
+CNSTU1 64
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 2
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 3
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRGP4 $121
+JUMPV
+LABELV $126
+ADDRFP4 4
+INDIRP4
+CNSTU1 0
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 2
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 3
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRGP4 $121
+JUMPV
+LABELV $127
+ADDRFP4 4
+INDIRP4
+CNSTU1 0
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+CNSTU1 192
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 2
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 3
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRGP4 $121
+JUMPV
+LABELV $128
+ADDRFP4 4
+INDIRP4
+CNSTU1 0
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+CNSTU1 128
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 2
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 3
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRGP4 $121
+JUMPV
+LABELV $129
+ADDRFP4 4
+INDIRP4
+CNSTU1 0
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+CNSTU1 64
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 2
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 3
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRGP4 $121
+JUMPV
+LABELV $130
+ADDRFP4 4
+INDIRP4
+CNSTU1 0
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 2
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 3
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRGP4 $121
+JUMPV
+LABELV $131
+ADDRFP4 4
+INDIRP4
+CNSTU1 0
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 2
+ADDP4
+CNSTU1 192
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 3
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRGP4 $121
+JUMPV
+LABELV $132
+ADDRFP4 4
+INDIRP4
+CNSTU1 0
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 2
+ADDP4
+CNSTU1 128
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 3
+ADDP4
+CNSTU1 255
+ASGNU1
+LABELV $121
+LABELV $119
+endproc CG_ColorByEntityType 4 0
+proc TransposeMatrix 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $135
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $139
+ADDRLP4 12
+CNSTI4 2
+ASGNI4
+ADDRLP4 16
+CNSTI4 12
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LSHI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LSHI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $140
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $139
+LABELV $136
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $135
+LABELV $134
+endproc TransposeMatrix 24 0
+lit
+align 4
+LABELV $144
+byte 4 0
+byte 4 0
+byte 4 0
+code
+proc CG_EntityVectors 240 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 $144
+INDIRB
+ASGNB 12
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRLP4 144
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $145
+CNSTI4 0
+RETI4
+ADDRGP4 $143
+JUMPV
+LABELV $145
+ADDRLP4 124
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 16777215
+NEI4 $147
+ADDRLP4 148
+CNSTI4 12
+ADDRLP4 124
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+38016
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRF4
+ADDRLP4 148
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 204
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+INDIRF4
+ADDRLP4 148
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 208
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 208
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+INDIRF4
+ADDRLP4 148
+INDIRP4
+ADDRLP4 208
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $150
+CNSTI4 1
+RETI4
+ADDRGP4 $143
+JUMPV
+LABELV $150
+ADDRLP4 156
+ADDRLP4 124
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+36992
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+ARGI4
+ADDRLP4 64
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRGP4 trap_R_ModelBounds
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $153
+ADDRLP4 212
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+ADDRLP4 40
+ADDP4
+ADDRLP4 212
+INDIRI4
+ADDRLP4 52
+ADDP4
+INDIRF4
+ADDRLP4 212
+INDIRI4
+ADDRLP4 64
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 216
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 220
+ADDRLP4 216
+INDIRI4
+ADDRLP4 52
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 216
+INDIRI4
+ADDRLP4 76
+ADDP4
+ADDRLP4 220
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 220
+INDIRF4
+ADDRLP4 216
+INDIRI4
+ADDRLP4 64
+ADDP4
+INDIRF4
+ADDF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $154
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $153
+ADDRLP4 128
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 212
+CNSTF4 0
+ASGNF4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 212
+INDIRF4
+NEF4 $162
+ADDRLP4 128+4
+INDIRF4
+ADDRLP4 212
+INDIRF4
+NEF4 $162
+ADDRLP4 128+8
+INDIRF4
+ADDRLP4 212
+INDIRF4
+EQF4 $148
+LABELV $162
+ADDRLP4 140
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $148
+JUMPV
+LABELV $147
+ADDRLP4 124
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $163
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $165
+CNSTI4 1
+RETI4
+ADDRGP4 $143
+JUMPV
+LABELV $165
+ADDRLP4 204
+ADDRLP4 124
+INDIRP4
+CNSTI4 176
+ADDP4
+ASGNP4
+ADDRLP4 208
+CNSTI4 255
+ASGNI4
+ADDRLP4 152
+ADDRLP4 204
+INDIRP4
+INDIRI4
+ADDRLP4 208
+INDIRI4
+BANDI4
+ASGNI4
+ADDRLP4 200
+ADDRLP4 204
+INDIRP4
+INDIRI4
+CNSTI4 8
+RSHI4
+ADDRLP4 208
+INDIRI4
+BANDI4
+ASGNI4
+ADDRLP4 196
+ADDRLP4 204
+INDIRP4
+INDIRI4
+CNSTI4 16
+RSHI4
+ADDRLP4 208
+INDIRI4
+BANDI4
+CNSTI4 32
+SUBI4
+ASGNI4
+ADDRLP4 212
+ADDRLP4 152
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 212
+INDIRF4
+ASGNF4
+ADDRLP4 76+4
+ADDRLP4 212
+INDIRF4
+ASGNF4
+ADDRLP4 76+8
+ADDRLP4 196
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 216
+ADDRLP4 152
+INDIRI4
+CNSTI4 1
+LSHI4
+CVIF4 4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 216
+INDIRF4
+ASGNF4
+ADDRLP4 40+4
+ADDRLP4 216
+INDIRF4
+ASGNF4
+ADDRLP4 40+8
+ADDRLP4 196
+INDIRI4
+ADDRLP4 200
+INDIRI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $164
+JUMPV
+LABELV $163
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $171
+CNSTI4 0
+RETI4
+ADDRGP4 $143
+JUMPV
+LABELV $171
+ADDRLP4 204
+CNSTF4 1077936128
+ASGNF4
+ADDRLP4 76
+ADDRLP4 204
+INDIRF4
+ASGNF4
+ADDRLP4 76+4
+ADDRLP4 204
+INDIRF4
+ASGNF4
+ADDRLP4 76+8
+CNSTF4 1077936128
+ASGNF4
+ADDRLP4 208
+CNSTF4 1086324736
+ASGNF4
+ADDRLP4 40
+ADDRLP4 208
+INDIRF4
+ASGNF4
+ADDRLP4 40+4
+ADDRLP4 208
+INDIRF4
+ASGNF4
+ADDRLP4 40+8
+CNSTF4 1086324736
+ASGNF4
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+LABELV $164
+LABELV $148
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 76+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 76+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 208
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 208
+INDIRP4
+ADDRLP4 208
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 216
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 216
+INDIRP4
+ADDRLP4 216
+INDIRP4
+INDIRF4
+ADDRLP4 40+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $180
+ADDRLP4 228
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 228
+INDIRI4
+CNSTI4 48
+ADDI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 228
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 236
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 48
+ADDI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 236
+INDIRP4
+ADDRLP4 236
+INDIRP4
+INDIRF4
+ADDRLP4 40+8
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $181
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $180
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $185
+ADDRLP4 128
+ARGP4
+ADDRLP4 160
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 160
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRGP4 TransposeMatrix
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $187
+ADDRLP4 228
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 228
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28+4
+ADDRLP4 228
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28+8
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 VectorRotate
+CALLV
+pop
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDF4
+ASGNF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+ADDF4
+ASGNF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $188
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $187
+LABELV $185
+ADDRLP4 144
+INDIRI4
+RETI4
+LABELV $143
+endproc CG_EntityVectors 240 12
+export CG_AddBoundingBoxEntity
+proc CG_AddBoundingBoxEntity 232 12
+ADDRLP4 196
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_drawBBox+12
+INDIRI4
+CNSTI4 0
+NEI4 $200
+ADDRGP4 $199
+JUMPV
+LABELV $200
+ADDRGP4 $203
+ARGP4
+ADDRLP4 220
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 204
+ADDRLP4 220
+INDIRI4
+ASGNI4
+ADDRGP4 $204
+ARGP4
+ADDRLP4 224
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 200
+ADDRLP4 224
+INDIRI4
+ASGNI4
+ADDRLP4 228
+CNSTI4 0
+ASGNI4
+ADDRLP4 204
+INDIRI4
+ADDRLP4 228
+INDIRI4
+EQI4 $207
+ADDRLP4 200
+INDIRI4
+ADDRLP4 228
+INDIRI4
+NEI4 $205
+LABELV $207
+ADDRGP4 $199
+JUMPV
+LABELV $205
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 208
+ARGP4
+ADDRLP4 100
+ARGP4
+ADDRGP4 CG_EntityVectors
+CALLI4
+pop
+ADDRLP4 0+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+72+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+LABELV $226
+ADDRLP4 196
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 24
+ADDRLP4 96
+INDIRI4
+MULI4
+ADDRLP4 0+20
+ADDP4
+ARGP4
+ADDRGP4 CG_ColorByEntityType
+CALLV
+pop
+LABELV $227
+ADDRLP4 96
+ADDRLP4 96
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 4
+LTI4 $226
+ADDRLP4 0
+ADDRLP4 100
+INDIRB
+ASGNB 12
+ADDRLP4 0+24
+ADDRLP4 100+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+48
+ADDRLP4 100+24
+INDIRB
+ASGNB 12
+ADDRLP4 0+72
+ADDRLP4 100+36
+INDIRB
+ASGNB 12
+ADDRLP4 204
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 100+84
+INDIRB
+ASGNB 12
+ADDRLP4 0+24
+ADDRLP4 100+72
+INDIRB
+ASGNB 12
+ADDRLP4 0+48
+ADDRLP4 100+60
+INDIRB
+ASGNB 12
+ADDRLP4 0+72
+ADDRLP4 100+48
+INDIRB
+ASGNB 12
+ADDRLP4 204
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 100+36
+INDIRB
+ASGNB 12
+ADDRLP4 0+24
+ADDRLP4 100+24
+INDIRB
+ASGNB 12
+ADDRLP4 0+48
+ADDRLP4 100+72
+INDIRB
+ASGNB 12
+ADDRLP4 0+72
+ADDRLP4 100+84
+INDIRB
+ASGNB 12
+ADDRLP4 200
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 100+24
+INDIRB
+ASGNB 12
+ADDRLP4 0+24
+ADDRLP4 100+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+48
+ADDRLP4 100+60
+INDIRB
+ASGNB 12
+ADDRLP4 0+72
+ADDRLP4 100+72
+INDIRB
+ASGNB 12
+ADDRLP4 200
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 100
+INDIRB
+ASGNB 12
+ADDRLP4 0+24
+ADDRLP4 100+36
+INDIRB
+ASGNB 12
+ADDRLP4 0+48
+ADDRLP4 100+84
+INDIRB
+ASGNB 12
+ADDRLP4 0+72
+ADDRLP4 100+48
+INDIRB
+ASGNB 12
+ADDRLP4 200
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 100+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+24
+ADDRLP4 100
+INDIRB
+ASGNB 12
+ADDRLP4 0+48
+ADDRLP4 100+48
+INDIRB
+ASGNB 12
+ADDRLP4 0+72
+ADDRLP4 100+60
+INDIRB
+ASGNB 12
+ADDRLP4 200
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+LABELV $199
+endproc CG_AddBoundingBoxEntity 232 12
+lit
+align 4
+LABELV $271
+byte 4 3245342720
+byte 4 3245342720
+byte 4 3250585600
+align 4
+LABELV $272
+byte 4 1097859072
+byte 4 1097859072
+byte 4 1107296256
+export CG_AddBoundingBox
+code
+proc CG_AddBoundingBox 288 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 216
+ADDRGP4 $271
+INDIRB
+ASGNB 12
+ADDRLP4 200
+ADDRGP4 $272
+INDIRB
+ASGNB 12
+ADDRGP4 cg_drawBBox+12
+INDIRI4
+CNSTI4 0
+NEI4 $273
+ADDRGP4 $270
+JUMPV
+LABELV $273
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+108604+140
+INDIRI4
+NEI4 $276
+ADDRGP4 cg+108596
+INDIRI4
+CNSTI4 0
+NEI4 $276
+ADDRGP4 $270
+JUMPV
+LABELV $276
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $281
+ADDRGP4 $270
+JUMPV
+LABELV $281
+ADDRGP4 $203
+ARGP4
+ADDRLP4 244
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 228
+ADDRLP4 244
+INDIRI4
+ASGNI4
+ADDRGP4 $204
+ARGP4
+ADDRLP4 248
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 212
+ADDRLP4 248
+INDIRI4
+ASGNI4
+ADDRLP4 252
+CNSTI4 0
+ASGNI4
+ADDRLP4 228
+INDIRI4
+ADDRLP4 252
+INDIRI4
+EQI4 $285
+ADDRLP4 212
+INDIRI4
+ADDRLP4 252
+INDIRI4
+NEI4 $283
+LABELV $285
+ADDRGP4 $270
+JUMPV
+LABELV $283
+ADDRLP4 236
+CNSTI4 1836
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+108604+140
+INDIRI4
+NEI4 $287
+ADDRLP4 200+8
+ADDRGP4 cg+108604+164
+INDIRI4
+CNSTI4 6
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $288
+JUMPV
+LABELV $287
+ADDRLP4 272
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+ASGNP4
+ADDRLP4 276
+CNSTI4 255
+ASGNI4
+ADDRLP4 260
+ADDRLP4 272
+INDIRP4
+INDIRI4
+ADDRLP4 276
+INDIRI4
+BANDI4
+ASGNI4
+ADDRLP4 264
+ADDRLP4 272
+INDIRP4
+INDIRI4
+CNSTI4 8
+RSHI4
+ADDRLP4 276
+INDIRI4
+BANDI4
+ASGNI4
+ADDRLP4 268
+ADDRLP4 272
+INDIRP4
+INDIRI4
+CNSTI4 16
+RSHI4
+ADDRLP4 276
+INDIRI4
+BANDI4
+CNSTI4 32
+SUBI4
+ASGNI4
+ADDRLP4 280
+ADDRLP4 260
+INDIRI4
+NEGI4
+CVIF4 4
+ASGNF4
+ADDRLP4 216+4
+ADDRLP4 280
+INDIRF4
+ASGNF4
+ADDRLP4 216
+ADDRLP4 280
+INDIRF4
+ASGNF4
+ADDRLP4 284
+ADDRLP4 260
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 200+4
+ADDRLP4 284
+INDIRF4
+ASGNF4
+ADDRLP4 200
+ADDRLP4 284
+INDIRF4
+ASGNF4
+ADDRLP4 216+8
+ADDRLP4 264
+INDIRI4
+NEGI4
+CVIF4 4
+ASGNF4
+ADDRLP4 200+8
+ADDRLP4 268
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $288
+ADDRLP4 232
+ADDRLP4 200
+INDIRF4
+ADDRLP4 216
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 240
+ADDRLP4 200+4
+INDIRF4
+ADDRLP4 216+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 196
+ADDRLP4 200+8
+INDIRF4
+ADDRLP4 216+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4+72+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 236
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $320
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $322
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4+20
+ADDP4
+CNSTU1 160
+ASGNU1
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4+20+1
+ADDP4
+CNSTU1 0
+ASGNU1
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4+20+2
+ADDP4
+CNSTU1 0
+ASGNU1
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4+20+3
+ADDP4
+CNSTU1 255
+ASGNU1
+LABELV $323
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $322
+ADDRGP4 $321
+JUMPV
+LABELV $320
+ADDRLP4 236
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $333
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $335
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4+20
+ADDP4
+CNSTU1 0
+ASGNU1
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4+20+1
+ADDP4
+CNSTU1 0
+ASGNU1
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4+20+2
+ADDP4
+CNSTU1 192
+ASGNU1
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4+20+3
+ADDP4
+CNSTU1 255
+ASGNU1
+LABELV $336
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $335
+ADDRGP4 $334
+JUMPV
+LABELV $333
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $346
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4+20
+ADDP4
+CNSTU1 0
+ASGNU1
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4+20+1
+ADDP4
+CNSTU1 128
+ASGNU1
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4+20+2
+ADDP4
+CNSTU1 0
+ASGNU1
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4+20+3
+ADDP4
+CNSTU1 255
+ASGNU1
+LABELV $347
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $346
+LABELV $334
+LABELV $321
+ADDRLP4 100+36
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRF4
+ADDRLP4 200
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 100+36+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+INDIRF4
+ADDRLP4 200+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 100+36+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+INDIRF4
+ADDRLP4 200+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 100+24
+ADDRLP4 100+36
+INDIRB
+ASGNB 12
+ADDRLP4 100+24
+ADDRLP4 100+24
+INDIRF4
+ADDRLP4 232
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 100+12
+ADDRLP4 100+24
+INDIRB
+ASGNB 12
+ADDRLP4 100+12+4
+ADDRLP4 100+12+4
+INDIRF4
+ADDRLP4 240
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 100
+ADDRLP4 100+12
+INDIRB
+ASGNB 12
+ADDRLP4 100
+ADDRLP4 100
+INDIRF4
+ADDRLP4 232
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $372
+ADDRLP4 260
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 100+48
+ADDP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 100
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 264
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 100+48+8
+ADDP4
+ASGNP4
+ADDRLP4 264
+INDIRP4
+ADDRLP4 264
+INDIRP4
+INDIRF4
+ADDRLP4 196
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $373
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $372
+ADDRLP4 4
+ADDRLP4 100
+INDIRB
+ASGNB 12
+ADDRLP4 4+24
+ADDRLP4 100+12
+INDIRB
+ASGNB 12
+ADDRLP4 4+48
+ADDRLP4 100+24
+INDIRB
+ASGNB 12
+ADDRLP4 4+72
+ADDRLP4 100+36
+INDIRB
+ASGNB 12
+ADDRLP4 228
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 100+84
+INDIRB
+ASGNB 12
+ADDRLP4 4+24
+ADDRLP4 100+72
+INDIRB
+ASGNB 12
+ADDRLP4 4+48
+ADDRLP4 100+60
+INDIRB
+ASGNB 12
+ADDRLP4 4+72
+ADDRLP4 100+48
+INDIRB
+ASGNB 12
+ADDRLP4 228
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 100+36
+INDIRB
+ASGNB 12
+ADDRLP4 4+24
+ADDRLP4 100+24
+INDIRB
+ASGNB 12
+ADDRLP4 4+48
+ADDRLP4 100+72
+INDIRB
+ASGNB 12
+ADDRLP4 4+72
+ADDRLP4 100+84
+INDIRB
+ASGNB 12
+ADDRLP4 212
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 100+24
+INDIRB
+ASGNB 12
+ADDRLP4 4+24
+ADDRLP4 100+12
+INDIRB
+ASGNB 12
+ADDRLP4 4+48
+ADDRLP4 100+60
+INDIRB
+ASGNB 12
+ADDRLP4 4+72
+ADDRLP4 100+72
+INDIRB
+ASGNB 12
+ADDRLP4 212
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 100
+INDIRB
+ASGNB 12
+ADDRLP4 4+24
+ADDRLP4 100+36
+INDIRB
+ASGNB 12
+ADDRLP4 4+48
+ADDRLP4 100+84
+INDIRB
+ASGNB 12
+ADDRLP4 4+72
+ADDRLP4 100+48
+INDIRB
+ASGNB 12
+ADDRLP4 212
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 100+12
+INDIRB
+ASGNB 12
+ADDRLP4 4+24
+ADDRLP4 100
+INDIRB
+ASGNB 12
+ADDRLP4 4+48
+ADDRLP4 100+48
+INDIRB
+ASGNB 12
+ADDRLP4 4+72
+ADDRLP4 100+60
+INDIRB
+ASGNB 12
+ADDRLP4 212
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+LABELV $270
+endproc CG_AddBoundingBox 288 12
+import trap_RealTime
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import trap_R_inPVS
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_Cutscene2d_Draw
+import CG_Cutscene2d_UpdateTrans
+import CG_Cutscene2d_CheckCmd
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import Main_SpriteParticles
+import LaunchRevivalParticle
+import LaunchSpeedyPuffTrail
+import Init_SpriteParticles
+import AddLFsToScreen
+import AddLFToDrawList
+import Init_LensFlareSys
+import DumpPolyInfo
+import ActiveChooseLogoMenu
+import FindLogoForSpraying
+import Add_LogoToDrawList
+import AddLogosToScene
+import Init_SprayLogoSys
+import Calculate_2DOfDIR
+import Calculate_2DOf3D
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_ChangeLoadingProgress
+import CG_LoadingString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_ScorePlum
+import CG_TeleOutEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_GenerateParticles
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_PortalInView
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_GetWaterMuzzle
+import CG_SprayTrail
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponSRWC
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_Boomies_Explosion
+import CG_BamBam_Explosion
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_LerpTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayer
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_UpdateVoipTeamIDs
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Draw3DModel
+import CG_SetPrintString
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import CG_MessagePrint
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_WorldToScreen
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_DrawPic1024
+import CG_DrawRect1024
+import CG_FillRect1024
+import CG_AdjustFrom1024
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddPolyBatched
+import CG_AddRefEntityBatched
+import CG_FlushSceneBatches
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_ForceModelChange
+import CG_GetCvarFloat
+import CG_GetCvarInt
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StreamAssets
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_icons
+import cg_ambient
+import cg_drawBBox
+import cg_drawVoiceNames
+import cg_drawLensflare
+import cg_timestamps
+import cg_skyLensflare
+import cg_sky
+import cg_curWarmupReady
+import cg_warmupReady
+import cg_glowModelTeam
+import cg_glowModel
+import cg_cineDrawLetterBox
+import cg_cineHideHud
+import cg_LPSwallhackAlpha
+import cg_LPSwallhackSize
+import cg_bigScoreType
+import cg_thirdPersonAutoSwitch
+import cg_drawTimeLeft
+import cg_drawServerInfos
+import cg_drawMessages
+import cg_drawups
+import cg_wopFFAhud
+import cg_printDir
+import cg_drawRealTime
+import cg_correctedWeaponPos
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_streamAssets
+import cg_deferPlayers
+import cg_predictItems
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_chatBeep
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_optimizePrediction
+import cg_nopredict
+import cg_errorDecay
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import trailEnt
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $204
+byte 1 98
+byte 1 98
+byte 1 111
+byte 1 120
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $203
+byte 1 98
+byte 1 98
+byte 1 111
+byte 1 120
+byte 1 0
+align 1
+LABELV $118
+byte 1 113
+byte 1 99
+byte 1 114
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $114
+byte 1 0
+align 1
+LABELV $107
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $100
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $99
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $96
+byte 1 50
+byte 1 53
+byte 1 48
+byte 1 0
+align 1
+LABELV $93
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $90
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 102
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $89
+byte 1 50
+byte 1 53
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $88
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $85
+byte 1 52
+byte 1 48
+byte 1 0
+align 1
+LABELV $84
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $83
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
@@ -0,0 +1,15008 @@
+data
+export cg_customSoundNames
+align 4
+LABELV cg_customSoundNames
+address $80
+address $81
+address $82
+address $83
+address $84
+address $85
+address $86
+address $87
+address $88
+address $89
+address $90
+address $91
+address $92
+address $93
+address $94
+skip 68
+export CG_CustomSound
+code
+proc CG_CustomSound 80 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+EQI4 $96
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 72
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+RETI4
+ADDRGP4 $95
+JUMPV
+LABELV $96
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $100
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $98
+LABELV $100
+ADDRFP4 0
+CNSTI4 0
+ASGNI4
+LABELV $98
+ADDRLP4 68
+CNSTI4 1836
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $105
+JUMPV
+LABELV $102
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_customSoundNames
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+NEI4 $106
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+INDIRP4
+CNSTI4 1700
+ADDP4
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $95
+JUMPV
+LABELV $106
+LABELV $103
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $105
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+GEI4 $108
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_customSoundNames
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $102
+LABELV $108
+ADDRGP4 $109
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $95
+endproc CG_CustomSound 80 12
+proc CG_ParseAnimationFile 20092 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 552
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20032
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 20036
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 20036
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+GTI4 $111
+CNSTI4 0
+RETI4
+ADDRGP4 $110
+JUMPV
+LABELV $111
+ADDRLP4 28
+INDIRI4
+CVIU4 4
+CNSTU4 19999
+LTU4 $113
+ADDRGP4 $115
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $110
+JUMPV
+LABELV $113
+ADDRLP4 32
+ARGP4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 20032
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 28
+INDIRI4
+ADDRLP4 32
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 20032
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 32
+ASGNP4
+ADDRLP4 20040
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+ADDRLP4 20040
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+ADDRLP4 20040
+INDIRI4
+ASGNI4
+ADDRLP4 20048
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 508
+ADDP4
+ADDRLP4 20048
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 504
+ADDP4
+ADDRLP4 20048
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 500
+ADDP4
+ADDRLP4 20048
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 520
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 492
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 496
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $117
+JUMPV
+LABELV $116
+ADDRLP4 20
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 20052
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20052
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $119
+ADDRGP4 $118
+JUMPV
+LABELV $119
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $123
+ARGP4
+ADDRLP4 20056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20056
+INDIRI4
+CNSTI4 0
+NEI4 $121
+ADDRLP4 12
+ARGP4
+ADDRLP4 20060
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20060
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $124
+ADDRGP4 $118
+JUMPV
+LABELV $124
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $128
+ARGP4
+ADDRLP4 20064
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20064
+INDIRI4
+CNSTI4 0
+EQI4 $130
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $129
+ARGP4
+ADDRLP4 20068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20068
+INDIRI4
+CNSTI4 0
+NEI4 $126
+LABELV $130
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $117
+JUMPV
+LABELV $126
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $133
+ARGP4
+ADDRLP4 20072
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20072
+INDIRI4
+CNSTI4 0
+NEI4 $131
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $117
+JUMPV
+LABELV $131
+ADDRGP4 $134
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $117
+JUMPV
+LABELV $121
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $137
+ARGP4
+ADDRLP4 20060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20060
+INDIRI4
+CNSTI4 0
+NEI4 $135
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $138
+ADDRLP4 12
+ARGP4
+ADDRLP4 20064
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20064
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $142
+ADDRGP4 $117
+JUMPV
+LABELV $142
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20068
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 500
+ADDP4
+ADDP4
+ADDRLP4 20068
+INDIRF4
+ASGNF4
+LABELV $139
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $138
+ADDRGP4 $117
+JUMPV
+LABELV $135
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $146
+ARGP4
+ADDRLP4 20064
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20064
+INDIRI4
+CNSTI4 0
+NEI4 $144
+ADDRLP4 12
+ARGP4
+ADDRLP4 20068
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20068
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $147
+ADDRGP4 $118
+JUMPV
+LABELV $147
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20072
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+ADDRLP4 20072
+INDIRF4
+ASGNF4
+ADDRGP4 $117
+JUMPV
+LABELV $144
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $151
+ARGP4
+ADDRLP4 20068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20068
+INDIRI4
+CNSTI4 0
+NEI4 $149
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $152
+ADDRLP4 12
+ARGP4
+ADDRLP4 20072
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20072
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $156
+ADDRGP4 $117
+JUMPV
+LABELV $156
+LABELV $153
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $152
+ADDRGP4 $117
+JUMPV
+LABELV $149
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $160
+ARGP4
+ADDRLP4 20072
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20072
+INDIRI4
+CNSTI4 0
+NEI4 $158
+ADDRLP4 12
+ARGP4
+ADDRLP4 20076
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20076
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $117
+ADDRGP4 $118
+JUMPV
+LABELV $158
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $165
+ARGP4
+ADDRLP4 20076
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20076
+INDIRI4
+CNSTI4 0
+NEI4 $163
+ADDRLP4 12
+ARGP4
+ADDRLP4 20080
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20080
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $166
+ADDRGP4 $118
+JUMPV
+LABELV $166
+ADDRLP4 20084
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20084
+INDIRI4
+CNSTI4 102
+EQI4 $170
+ADDRLP4 20084
+INDIRI4
+CNSTI4 70
+NEI4 $168
+LABELV $170
+ADDRFP4 4
+INDIRP4
+CNSTI4 520
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $117
+JUMPV
+LABELV $168
+ADDRLP4 20088
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20088
+INDIRI4
+CNSTI4 110
+EQI4 $173
+ADDRLP4 20088
+INDIRI4
+CNSTI4 78
+NEI4 $171
+LABELV $173
+ADDRFP4 4
+INDIRP4
+CNSTI4 520
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $117
+JUMPV
+LABELV $171
+ADDRFP4 4
+INDIRP4
+CNSTI4 520
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $117
+JUMPV
+LABELV $163
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $176
+ARGP4
+ADDRLP4 20080
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20080
+INDIRI4
+CNSTI4 0
+NEI4 $174
+ADDRFP4 4
+INDIRP4
+CNSTI4 492
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $117
+JUMPV
+LABELV $174
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $179
+ARGP4
+ADDRLP4 20084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20084
+INDIRI4
+CNSTI4 0
+NEI4 $177
+ADDRFP4 4
+INDIRP4
+CNSTI4 496
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $117
+JUMPV
+LABELV $177
+ADDRLP4 20088
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20088
+INDIRI4
+CNSTI4 48
+LTI4 $180
+ADDRLP4 20088
+INDIRI4
+CNSTI4 57
+GTI4 $180
+ADDRLP4 12
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRGP4 $118
+JUMPV
+LABELV $180
+ADDRGP4 $182
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $117
+ADDRGP4 $116
+JUMPV
+LABELV $118
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $183
+ADDRLP4 12
+ARGP4
+ADDRLP4 20052
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20052
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $187
+ADDRLP4 4
+INDIRI4
+CNSTI4 29
+LTI4 $189
+ADDRLP4 4
+INDIRI4
+CNSTI4 34
+GTI4 $189
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $184
+JUMPV
+LABELV $189
+ADDRLP4 4
+INDIRI4
+CNSTI4 25
+NEI4 $191
+ADDRLP4 8
+INDIRP4
+CNSTI4 700
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 196
+ADDP4
+ARGP4
+CNSTU4 28
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $184
+JUMPV
+LABELV $191
+ADDRLP4 4
+INDIRI4
+CNSTI4 26
+NEI4 $193
+ADDRLP4 8
+INDIRP4
+CNSTI4 728
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 308
+ADDP4
+ARGP4
+CNSTU4 28
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $184
+JUMPV
+LABELV $193
+ADDRLP4 4
+INDIRI4
+CNSTI4 27
+NEI4 $195
+ADDRLP4 8
+INDIRP4
+CNSTI4 756
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 616
+ADDP4
+ARGP4
+CNSTU4 28
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $184
+JUMPV
+LABELV $195
+ADDRLP4 4
+INDIRI4
+CNSTI4 28
+NEI4 $185
+ADDRLP4 8
+INDIRP4
+CNSTI4 784
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 504
+ADDP4
+ARGP4
+CNSTU4 28
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $184
+JUMPV
+LABELV $187
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20056
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 20056
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 13
+NEI4 $199
+ADDRLP4 24
+ADDRLP4 8
+INDIRP4
+CNSTI4 364
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $199
+ADDRLP4 4
+INDIRI4
+CNSTI4 13
+LTI4 $201
+ADDRLP4 4
+INDIRI4
+CNSTI4 29
+GEI4 $201
+ADDRLP4 20064
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 20064
+INDIRP4
+ADDRLP4 20064
+INDIRP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $201
+ADDRLP4 12
+ARGP4
+ADDRLP4 20064
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20064
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $203
+ADDRGP4 $185
+JUMPV
+LABELV $203
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20068
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 20068
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $205
+ADDRLP4 20072
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 20072
+INDIRP4
+ADDRLP4 20072
+INDIRP4
+INDIRI4
+NEGI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $205
+ADDRLP4 12
+ARGP4
+ADDRLP4 20072
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20072
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $207
+ADDRGP4 $185
+JUMPV
+LABELV $207
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20076
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRLP4 20076
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 20080
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20080
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $209
+ADDRGP4 $185
+JUMPV
+LABELV $209
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20084
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 20084
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 0
+NEF4 $211
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $211
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 16
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 16
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+LABELV $184
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 35
+LTI4 $183
+LABELV $185
+ADDRLP4 4
+INDIRI4
+CNSTI4 35
+EQI4 $213
+ADDRGP4 $215
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $110
+JUMPV
+LABELV $213
+ADDRLP4 8
+INDIRP4
+CNSTI4 1008
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 364
+ADDP4
+ARGP4
+CNSTU4 28
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 8
+INDIRP4
+CNSTI4 1028
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1036
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 392
+ADDP4
+ARGP4
+CNSTU4 28
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 8
+INDIRP4
+CNSTI4 1056
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1064
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1068
+ADDP4
+CNSTI4 16
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1072
+ADDP4
+CNSTI4 16
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1076
+ADDP4
+CNSTI4 66
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1080
+ADDP4
+CNSTI4 66
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1084
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1092
+ADDP4
+CNSTI4 16
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1096
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1100
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1104
+ADDP4
+CNSTI4 50
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1108
+ADDP4
+CNSTI4 50
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1112
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1120
+ADDP4
+CNSTI4 16
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1124
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1128
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1132
+ADDP4
+CNSTI4 66
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1136
+ADDP4
+CNSTI4 66
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1140
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $110
+endproc CG_ParseAnimationFile 20092 12
+proc CG_LoadAnimationFile 20 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 animationCache
+ASGNP4
+ADDRGP4 $221
+JUMPV
+LABELV $218
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $222
+ADDRFP4 4
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+CNSTU4 1148
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1212
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 500
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1216
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1228
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 520
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1232
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 492
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1236
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 496
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1240
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $217
+JUMPV
+LABELV $222
+LABELV $219
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1244
+ADDP4
+ASGNP4
+LABELV $221
+ADDRLP4 4
+INDIRI4
+ADDRGP4 numAnimationCache
+INDIRI4
+LTI4 $218
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 CG_ParseAnimationFile
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $224
+CNSTI4 0
+RETI4
+ADDRGP4 $217
+JUMPV
+LABELV $224
+ADDRGP4 numAnimationCache
+INDIRI4
+CNSTI4 32
+GEI4 $226
+ADDRLP4 16
+ADDRGP4 numAnimationCache
+ASGNP4
+ADDRLP4 12
+ADDRLP4 16
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 1244
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 animationCache
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+CNSTU4 1148
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 1212
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1216
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 500
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 1228
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1232
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1236
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1240
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $226
+CNSTI4 1
+RETI4
+LABELV $217
+endproc CG_LoadAnimationFile 20 12
+proc CG_FileExists 32 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTU4 0
+ASGNU4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $232
+JUMPV
+LABELV $229
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRLP4 8
+CNSTU4 31
+ADDRLP4 8
+INDIRU4
+MULU4
+ADDRLP4 12
+INDIRI4
+CVIU4 4
+ADDU4
+ASGNU4
+LABELV $230
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $232
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $229
+ADDRLP4 8
+ADDRLP4 8
+INDIRU4
+CNSTU4 255
+BANDU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 8
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRGP4 fileExistsHash
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $236
+JUMPV
+LABELV $233
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $237
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $228
+JUMPV
+LABELV $237
+LABELV $234
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $236
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $233
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 numFileExistsCache
+INDIRI4
+CNSTI4 512
+GEI4 $239
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 16
+INDIRU4
+CNSTU4 64
+GEU4 $239
+ADDRLP4 24
+ADDRGP4 numFileExistsCache
+ASGNP4
+ADDRLP4 20
+ADDRLP4 24
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 72
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 fileExistsCache
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LEI4 $242
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRGP4 $243
+JUMPV
+LABELV $242
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+LABELV $243
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 8
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRGP4 fileExistsHash
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRGP4 fileExistsHash
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $239
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LEI4 $244
+CNSTI4 1
+RETI4
+ADDRGP4 $228
+JUMPV
+LABELV $244
+CNSTI4 0
+RETI4
+LABELV $228
+endproc CG_FileExists 32 12
+proc CG_FindClientModelFile 88 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 5
+LTI4 $247
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+EQI4 $253
+ADDRGP4 $250
+JUMPV
+LABELV $253
+ADDRLP4 0
+ADDRGP4 $254
+ASGNP4
+ADDRGP4 $251
+JUMPV
+LABELV $250
+ADDRLP4 0
+ADDRGP4 $255
+ASGNP4
+LABELV $251
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $258
+ARGP4
+ADDRLP4 8
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $260
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $259
+ARGP4
+ADDRLP4 12
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $248
+LABELV $260
+ADDRLP4 16
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+CNSTI4 95
+ARGI4
+ADDRLP4 84
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 80
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $248
+ADDRLP4 80
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 20
+ADDRLP4 16
+ASGNP4
+ADDRGP4 $248
+JUMPV
+LABELV $247
+ADDRLP4 0
+ADDRGP4 $128
+ASGNP4
+LABELV $248
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $263
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 CG_FileExists
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $264
+CNSTI4 1
+RETI4
+ADDRGP4 $246
+JUMPV
+LABELV $264
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 5
+LTI4 $266
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $269
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $267
+JUMPV
+LABELV $266
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $269
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $267
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 CG_FileExists
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $246
+endproc CG_FindClientModelFile 88 32
+proc CG_FindClientHeadFile 4 32
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 CG_FindClientModelFile
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $270
+endproc CG_FindClientHeadFile 4 32
+proc CG_RegisterClientSkin 84 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $274
+ARGP4
+ADDRGP4 $275
+ARGP4
+ADDRLP4 64
+ADDRGP4 CG_FindClientModelFile
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+EQI4 $272
+ADDRLP4 0
+ARGP4
+ADDRLP4 68
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+LABELV $272
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $276
+ADDRGP4 $278
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $276
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $281
+ARGP4
+ADDRGP4 $275
+ARGP4
+ADDRLP4 68
+ADDRGP4 CG_FindClientModelFile
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $279
+ADDRLP4 0
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+LABELV $279
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $282
+ADDRGP4 $284
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $282
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $287
+ARGP4
+ADDRGP4 $275
+ARGP4
+ADDRLP4 72
+ADDRGP4 CG_FindClientHeadFile
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $285
+ADDRLP4 0
+ARGP4
+ADDRLP4 76
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ADDRLP4 76
+INDIRI4
+ASGNI4
+LABELV $285
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $288
+ADDRGP4 $290
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $288
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+EQI4 $294
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+EQI4 $294
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+NEI4 $291
+LABELV $294
+CNSTI4 0
+RETI4
+ADDRGP4 $271
+JUMPV
+LABELV $291
+CNSTI4 1
+RETI4
+LABELV $271
+endproc CG_RegisterClientSkin 84 32
+proc CG_RegisterClientModelname 204 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRLP4 68
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 68
+INDIRU4
+EQU4 $301
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 68
+INDIRU4
+EQU4 $301
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+ADDRLP4 68
+INDIRU4
+EQU4 $301
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+ADDRLP4 68
+INDIRU4
+EQU4 $301
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+ADDRLP4 68
+INDIRU4
+NEU4 $296
+LABELV $301
+CNSTI4 0
+RETI4
+ADDRGP4 $295
+JUMPV
+LABELV $296
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $302
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $303
+ADDRGP4 $305
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $295
+JUMPV
+LABELV $303
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $306
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 76
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $307
+ADDRGP4 $305
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $295
+JUMPV
+LABELV $307
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $128
+ARGP4
+ADDRLP4 80
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+EQI4 $309
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $255
+ARGP4
+ADDRLP4 84
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+EQI4 $309
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $254
+ARGP4
+ADDRLP4 88
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+EQI4 $309
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $311
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 92
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $312
+ADDRLP4 96
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 96
+ARGP4
+ADDRGP4 $258
+ARGP4
+ADDRLP4 164
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 160
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $316
+ADDRLP4 96
+ARGP4
+ADDRGP4 $259
+ARGP4
+ADDRLP4 168
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 160
+ADDRLP4 168
+INDIRP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $314
+LABELV $316
+ADDRLP4 160
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $314
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $311
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 96
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 172
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+ADDRLP4 172
+INDIRI4
+ASGNI4
+LABELV $312
+LABELV $309
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $317
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $319
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 92
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+ADDRLP4 92
+INDIRI4
+ASGNI4
+LABELV $317
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $320
+ADDRGP4 $305
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $295
+JUMPV
+LABELV $320
+ADDRFP4 0
+INDIRP4
+CNSTI4 1828
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $322
+ADDRLP4 64
+CNSTI4 1
+ASGNI4
+ADDRLP4 92
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 92
+ARGP4
+CNSTI4 95
+ARGI4
+ADDRLP4 160
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 156
+ADDRLP4 160
+INDIRP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $324
+ADDRLP4 164
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRLP4 156
+ADDRLP4 164
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $324
+ADDRGP4 $255
+ARGP4
+ADDRLP4 92
+ARGP4
+ADDRLP4 164
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $328
+ADDRGP4 $254
+ARGP4
+ADDRLP4 92
+ARGP4
+ADDRLP4 168
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+NEI4 $326
+LABELV $328
+ADDRLP4 92
+ARGP4
+ADDRGP4 $128
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $326
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 92
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 172
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $330
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 92
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 176
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ADDRLP4 176
+INDIRI4
+ASGNI4
+ADDRLP4 92
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 92
+ARGP4
+CNSTI4 95
+ARGI4
+ADDRLP4 180
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 156
+ADDRLP4 180
+INDIRP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $331
+ADDRLP4 184
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRLP4 156
+ADDRLP4 184
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 184
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $331
+ADDRGP4 $255
+ARGP4
+ADDRLP4 92
+ARGP4
+ADDRLP4 184
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $335
+ADDRGP4 $254
+ARGP4
+ADDRLP4 92
+ARGP4
+ADDRLP4 188
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+NEI4 $333
+LABELV $335
+ADDRLP4 92
+ARGP4
+ADDRGP4 $128
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $333
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $336
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 92
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 192
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ADDRLP4 192
+INDIRI4
+ASGNI4
+ADDRLP4 200
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+ADDRLP4 200
+INDIRI4
+EQI4 $340
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ADDRLP4 200
+INDIRI4
+EQI4 $340
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRI4
+ADDRLP4 200
+INDIRI4
+NEI4 $337
+LABELV $340
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $341
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $337
+LABELV $322
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $342
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 CG_RegisterClientSkin
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+NEI4 $342
+ADDRGP4 $344
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $295
+JUMPV
+LABELV $342
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $345
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 CG_LoadAnimationFile
+CALLI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+NEI4 $346
+ADDRGP4 $348
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $295
+JUMPV
+LABELV $346
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $351
+ARGP4
+ADDRGP4 $352
+ARGP4
+ADDRLP4 100
+ADDRGP4 CG_FindClientHeadFile
+CALLI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+EQI4 $349
+ADDRLP4 0
+ARGP4
+ADDRLP4 104
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRGP4 $350
+JUMPV
+LABELV $349
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $351
+ARGP4
+ADDRGP4 $355
+ARGP4
+ADDRLP4 104
+ADDRGP4 CG_FindClientHeadFile
+CALLI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 0
+EQI4 $353
+ADDRLP4 0
+ARGP4
+ADDRLP4 108
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRGP4 $354
+JUMPV
+LABELV $353
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $351
+ARGP4
+ADDRGP4 $275
+ARGP4
+ADDRLP4 108
+ADDRGP4 CG_FindClientHeadFile
+CALLI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+EQI4 $356
+ADDRLP4 0
+ARGP4
+ADDRLP4 112
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+ADDRLP4 112
+INDIRI4
+ASGNI4
+LABELV $356
+LABELV $354
+LABELV $350
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $358
+CNSTI4 0
+RETI4
+ADDRGP4 $295
+JUMPV
+LABELV $358
+CNSTI4 1
+RETI4
+LABELV $295
+endproc CG_RegisterClientModelname 204 32
+proc CG_ColorFromString 20 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $363
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+LEI4 $361
+LABELV $363
+ADDRFP4 4
+INDIRP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $360
+JUMPV
+LABELV $361
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $364
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $364
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $366
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $366
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $368
+ADDRFP4 4
+INDIRP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $368
+LABELV $360
+endproc CG_ColorFromString 20 4
+proc CG_LoadClientInfo 152 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 24
+CNSTI1 0
+ASGNI1
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 292
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 356
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 420
+ADDP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 92
+ADDRGP4 CG_RegisterClientModelname
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+NEI4 $371
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $373
+ADDRGP4 $376
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 292
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 356
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 420
+ADDP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $373
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 5
+LTI4 $377
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 $382
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 $128
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 104
+ADDRGP4 CG_RegisterClientModelname
+CALLI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 0
+NEI4 $378
+ADDRGP4 $383
+ARGP4
+ADDRGP4 $382
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $378
+JUMPV
+LABELV $377
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 $382
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 $128
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 104
+ADDRGP4 CG_RegisterClientModelname
+CALLI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 0
+NEI4 $384
+ADDRGP4 $386
+ARGP4
+ADDRGP4 $382
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $384
+LABELV $378
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $371
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $387
+ADDRLP4 96
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 $391
+ARGP4
+ADDRLP4 148
+ADDRGP4 trap_R_LerpTag
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $389
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $389
+LABELV $387
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+ASGNP4
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 5
+LTI4 $394
+ADDRLP4 96
+ADDRGP4 $382
+ASGNP4
+ADDRGP4 $395
+JUMPV
+LABELV $394
+ADDRLP4 96
+ADDRGP4 $382
+ASGNP4
+LABELV $395
+ADDRLP4 20
+ADDRLP4 96
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $396
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_customSoundNames
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $400
+ADDRGP4 $398
+JUMPV
+LABELV $400
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1700
+ADDP4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $402
+ADDRGP4 $404
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 104
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1700
+ADDP4
+ADDP4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+LABELV $402
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1700
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $405
+ADDRGP4 $404
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 104
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1700
+ADDP4
+ADDP4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+LABELV $405
+LABELV $397
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $396
+LABELV $398
+ADDRFP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cgs+41088
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1836
+DIVI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $408
+ADDRLP4 100
+CNSTI4 808
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+ADDRGP4 cg_entities+168
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $412
+ADDRLP4 100
+INDIRI4
+ADDRGP4 cg_entities+4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $412
+CNSTI4 808
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ARGP4
+ADDRGP4 CG_ResetPlayerEntity
+CALLV
+pop
+LABELV $412
+LABELV $409
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $408
+LABELV $370
+endproc CG_LoadClientInfo 152 24
+proc CG_CopyClientInfoModel 56 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 500
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+CNSTI4 512
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+CNSTI4 516
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 520
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 524
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 528
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 532
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 536
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 540
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 544
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+CNSTI4 548
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 488
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 48
+CNSTI4 552
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ARGP4
+CNSTU4 1148
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 52
+CNSTI4 1700
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+ARGP4
+CNSTU4 128
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $416
+endproc CG_CopyClientInfoModel 56 12
+proc CG_ScanForExistingClientInfo 48 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $421
+JUMPV
+LABELV $418
+ADDRLP4 0
+CNSTI4 1836
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $424
+ADDRGP4 $419
+JUMPV
+LABELV $424
+ADDRLP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $426
+ADDRGP4 $419
+JUMPV
+LABELV $426
+ADDRLP4 8
+CNSTI4 228
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $428
+ADDRLP4 16
+CNSTI4 292
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $428
+ADDRLP4 24
+CNSTI4 356
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $428
+ADDRLP4 32
+CNSTI4 420
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $428
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 5
+LTI4 $431
+ADDRLP4 40
+CNSTI4 68
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $428
+LABELV $431
+ADDRLP4 44
+CNSTI4 1828
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $428
+ADDRFP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $417
+JUMPV
+LABELV $428
+LABELV $419
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $421
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+31488
+INDIRI4
+LTI4 $418
+CNSTI4 0
+RETI4
+LABELV $417
+endproc CG_ScanForExistingClientInfo 48 8
+proc CG_SetDeferredClientInfo 36 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $436
+JUMPV
+LABELV $433
+ADDRLP4 0
+CNSTI4 1836
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $441
+ADDRLP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $439
+LABELV $441
+ADDRGP4 $434
+JUMPV
+LABELV $439
+ADDRLP4 16
+CNSTI4 292
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $446
+ADDRLP4 24
+CNSTI4 228
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $446
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 5
+LTI4 $442
+ADDRLP4 32
+CNSTI4 68
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $442
+LABELV $446
+ADDRGP4 $434
+JUMPV
+LABELV $442
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_LoadClientInfo
+CALLV
+pop
+ADDRGP4 $432
+JUMPV
+LABELV $434
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $436
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+31488
+INDIRI4
+LTI4 $433
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 5
+LTI4 $447
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $453
+JUMPV
+LABELV $450
+ADDRLP4 0
+CNSTI4 1836
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $458
+ADDRLP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $456
+LABELV $458
+ADDRGP4 $451
+JUMPV
+LABELV $456
+ADDRLP4 16
+CNSTI4 292
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $462
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 5
+LTI4 $459
+ADDRLP4 24
+CNSTI4 68
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $459
+LABELV $462
+ADDRGP4 $451
+JUMPV
+LABELV $459
+ADDRLP4 28
+CNSTI4 228
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $463
+ADDRGP4 $451
+JUMPV
+LABELV $463
+ADDRFP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRGP4 $432
+JUMPV
+LABELV $451
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $453
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+31488
+INDIRI4
+LTI4 $450
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_LoadClientInfo
+CALLV
+pop
+ADDRGP4 $432
+JUMPV
+LABELV $447
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $468
+JUMPV
+LABELV $465
+ADDRLP4 0
+CNSTI4 1836
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $471
+ADDRGP4 $466
+JUMPV
+LABELV $471
+ADDRFP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRGP4 $432
+JUMPV
+LABELV $466
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $468
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+31488
+INDIRI4
+LTI4 $465
+ADDRGP4 $473
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_LoadClientInfo
+CALLV
+pop
+LABELV $432
+endproc CG_SetDeferredClientInfo 36 8
+export CG_NewClientInfo
+proc CG_NewClientInfo 2080 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 1916
+CNSTI4 1836
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 1932
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 1840
+ADDRLP4 1932
+INDIRP4
+ASGNP4
+ADDRLP4 1840
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $476
+ADDRLP4 1916
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $474
+JUMPV
+LABELV $476
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1836
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 1840
+INDIRP4
+ARGP4
+ADDRGP4 $478
+ARGP4
+ADDRLP4 1936
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1836
+ADDRLP4 1936
+INDIRP4
+ASGNP4
+ADDRLP4 0+4
+ARGP4
+ADDRLP4 1836
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1840
+INDIRP4
+ARGP4
+ADDRGP4 $481
+ARGP4
+ADDRLP4 1940
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1836
+ADDRLP4 1940
+INDIRP4
+ASGNP4
+ADDRLP4 1836
+INDIRP4
+ARGP4
+ADDRLP4 0+76
+ARGP4
+ADDRGP4 CG_ColorFromString
+CALLV
+pop
+ADDRLP4 1840
+INDIRP4
+ARGP4
+ADDRGP4 $483
+ARGP4
+ADDRLP4 1944
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1836
+ADDRLP4 1944
+INDIRP4
+ASGNP4
+ADDRLP4 1836
+INDIRP4
+ARGP4
+ADDRLP4 1952
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1948
+ADDRLP4 1952
+INDIRI4
+ASGNI4
+ADDRLP4 1948
+INDIRI4
+CNSTI4 0
+GEI4 $484
+ADDRLP4 1948
+CNSTI4 0
+ASGNI4
+ADDRGP4 $485
+JUMPV
+LABELV $484
+ADDRLP4 1948
+INDIRI4
+CNSTI4 6
+LTI4 $486
+ADDRLP4 1948
+CNSTI4 5
+ASGNI4
+LABELV $486
+LABELV $485
+ADDRLP4 0+88
+ADDRLP4 1948
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 spraycolors
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 1840
+INDIRP4
+ARGP4
+ADDRGP4 $489
+ARGP4
+ADDRLP4 1948
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1836
+ADDRLP4 1948
+INDIRP4
+ASGNP4
+ADDRLP4 1836
+INDIRP4
+ARGP4
+ADDRLP4 1952
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+72
+ADDRLP4 1952
+INDIRI4
+ASGNI4
+ADDRLP4 1840
+INDIRP4
+ARGP4
+ADDRGP4 $491
+ARGP4
+ADDRLP4 1956
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1836
+ADDRLP4 1956
+INDIRP4
+ASGNP4
+ADDRLP4 1836
+INDIRP4
+ARGP4
+ADDRLP4 1960
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+192
+ADDRLP4 1960
+INDIRI4
+ASGNI4
+ADDRLP4 1840
+INDIRP4
+ARGP4
+ADDRGP4 $493
+ARGP4
+ADDRLP4 1964
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1836
+ADDRLP4 1964
+INDIRP4
+ASGNP4
+ADDRLP4 1836
+INDIRP4
+ARGP4
+ADDRLP4 1968
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+196
+ADDRLP4 1968
+INDIRI4
+ASGNI4
+ADDRLP4 1840
+INDIRP4
+ARGP4
+ADDRGP4 $495
+ARGP4
+ADDRLP4 1972
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1836
+ADDRLP4 1972
+INDIRP4
+ASGNP4
+ADDRLP4 1836
+INDIRP4
+ARGP4
+ADDRLP4 1976
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+200
+ADDRLP4 1976
+INDIRI4
+ASGNI4
+ADDRLP4 1840
+INDIRP4
+ARGP4
+ADDRGP4 $497
+ARGP4
+ADDRLP4 1980
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1836
+ADDRLP4 1980
+INDIRP4
+ASGNP4
+ADDRLP4 1836
+INDIRP4
+ARGP4
+ADDRLP4 1984
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+68
+ADDRLP4 1984
+INDIRI4
+ASGNI4
+ADDRLP4 1840
+INDIRP4
+ARGP4
+ADDRGP4 $499
+ARGP4
+ADDRLP4 1988
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1836
+ADDRLP4 1988
+INDIRP4
+ASGNP4
+ADDRLP4 0+100
+ARGP4
+ADDRLP4 1836
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1840
+INDIRP4
+ARGP4
+ADDRGP4 $502
+ARGP4
+ADDRLP4 1992
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1836
+ADDRLP4 1992
+INDIRP4
+ASGNP4
+ADDRLP4 1836
+INDIRP4
+ARGP4
+ADDRLP4 1996
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+204
+ADDRLP4 1996
+INDIRI4
+ASGNI4
+ADDRLP4 1924
+ADDRLP4 1916
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $509
+ADDRLP4 2000
+CNSTI4 1836
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $510
+JUMPV
+LABELV $509
+ADDRLP4 2000
+CNSTI4 3
+ASGNI4
+LABELV $510
+ADDRLP4 1920
+ADDRLP4 2000
+INDIRI4
+ASGNI4
+ADDRLP4 1840
+INDIRP4
+ARGP4
+ADDRGP4 $511
+ARGP4
+ADDRLP4 2004
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1836
+ADDRLP4 2004
+INDIRP4
+ASGNP4
+ADDRGP4 cg_forceModel+12
+INDIRI4
+CNSTI4 0
+LEI4 $512
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 5
+LTI4 $515
+ADDRGP4 cg_forceModel+12
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $518
+ADDRLP4 0+68
+INDIRI4
+ADDRLP4 1920
+INDIRI4
+NEI4 $518
+ADDRGP4 $522
+ARGP4
+ADDRLP4 1844
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 $513
+JUMPV
+LABELV $518
+ADDRGP4 cg_forceModel+12
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $523
+ADDRLP4 0+68
+INDIRI4
+ADDRLP4 1920
+INDIRI4
+EQI4 $523
+ADDRGP4 $511
+ARGP4
+ADDRLP4 1844
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 $513
+JUMPV
+LABELV $523
+ADDRLP4 1844
+ARGP4
+ADDRLP4 1836
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $513
+JUMPV
+LABELV $515
+ADDRGP4 cg_forceModel+12
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $527
+ADDRGP4 $511
+ARGP4
+ADDRLP4 1844
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 $513
+JUMPV
+LABELV $527
+ADDRLP4 1844
+ARGP4
+ADDRLP4 1836
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $513
+JUMPV
+LABELV $512
+ADDRLP4 1844
+ARGP4
+ADDRLP4 1836
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $513
+ADDRLP4 1844
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 2008
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 1908
+ADDRLP4 2008
+INDIRP4
+ASGNP4
+ADDRLP4 2008
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $530
+ADDRLP4 1908
+ADDRGP4 $128
+ASGNP4
+ADDRGP4 $531
+JUMPV
+LABELV $530
+ADDRLP4 2012
+ADDRLP4 1908
+INDIRP4
+ASGNP4
+ADDRLP4 1908
+ADDRLP4 2012
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 2012
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $531
+ADDRLP4 0+292
+ARGP4
+ADDRLP4 1908
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0+228
+ARGP4
+ADDRLP4 1844
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1840
+INDIRP4
+ARGP4
+ADDRGP4 $536
+ARGP4
+ADDRLP4 2012
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1836
+ADDRLP4 2012
+INDIRP4
+ASGNP4
+ADDRGP4 cg_forceModel+12
+INDIRI4
+CNSTI4 0
+LEI4 $537
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 5
+LTI4 $540
+ADDRGP4 cg_forceModel+12
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $543
+ADDRLP4 0+68
+INDIRI4
+ADDRLP4 1920
+INDIRI4
+NEI4 $543
+ADDRGP4 $547
+ARGP4
+ADDRLP4 1844
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 $538
+JUMPV
+LABELV $543
+ADDRGP4 cg_forceModel+12
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $548
+ADDRLP4 0+68
+INDIRI4
+ADDRLP4 1920
+INDIRI4
+EQI4 $548
+ADDRGP4 $552
+ARGP4
+ADDRLP4 1844
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 $538
+JUMPV
+LABELV $548
+ADDRLP4 1844
+ARGP4
+ADDRLP4 1836
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $538
+JUMPV
+LABELV $540
+ADDRGP4 cg_forceModel+12
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $553
+ADDRGP4 $552
+ARGP4
+ADDRLP4 1844
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 $538
+JUMPV
+LABELV $553
+ADDRLP4 1844
+ARGP4
+ADDRLP4 1836
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $538
+JUMPV
+LABELV $537
+ADDRLP4 1844
+ARGP4
+ADDRLP4 1836
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $538
+ADDRLP4 1844
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 2016
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 1908
+ADDRLP4 2016
+INDIRP4
+ASGNP4
+ADDRLP4 2016
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $556
+ADDRLP4 1908
+ADDRGP4 $128
+ASGNP4
+ADDRGP4 $557
+JUMPV
+LABELV $556
+ADDRLP4 2020
+ADDRLP4 1908
+INDIRP4
+ASGNP4
+ADDRLP4 1908
+ADDRLP4 2020
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 2020
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $557
+ADDRLP4 0+420
+ARGP4
+ADDRLP4 1908
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0+356
+ARGP4
+ADDRLP4 1844
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0+1828
+CNSTI4 0
+ASGNI4
+ADDRLP4 1912
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 5
+LTI4 $563
+ADDRGP4 cg_glowModel+16
+ARGP4
+ADDRLP4 2020
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 2020
+INDIRU4
+CNSTU4 0
+EQU4 $566
+ADDRLP4 0+68
+INDIRI4
+ADDRLP4 1920
+INDIRI4
+EQI4 $566
+ADDRLP4 1912
+ADDRGP4 cg_glowModel+16
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+ASGNI4
+ADDRLP4 0+1828
+CNSTI4 1
+ASGNI4
+LABELV $566
+ADDRGP4 cg_glowModelTeam+16
+ARGP4
+ADDRLP4 2024
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 2024
+INDIRU4
+CNSTU4 0
+EQU4 $564
+ADDRLP4 0+68
+INDIRI4
+ADDRLP4 1920
+INDIRI4
+NEI4 $564
+ADDRLP4 1912
+ADDRGP4 cg_glowModelTeam+16
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+ASGNI4
+ADDRLP4 0+1828
+CNSTI4 1
+ASGNI4
+ADDRGP4 $564
+JUMPV
+LABELV $563
+ADDRGP4 cg_glowModel+16
+ARGP4
+ADDRLP4 2020
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 2020
+INDIRU4
+CNSTU4 0
+EQU4 $578
+ADDRLP4 1912
+ADDRGP4 cg_glowModel+16
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+ASGNI4
+ADDRLP4 0+1828
+CNSTI4 1
+ASGNI4
+LABELV $578
+LABELV $564
+ADDRLP4 2024
+CNSTF4 1132396544
+ADDRLP4 1912
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 2028
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 2024
+INDIRF4
+ADDRLP4 2028
+INDIRF4
+LTF4 $585
+ADDRLP4 2020
+ADDRLP4 2024
+INDIRF4
+ADDRLP4 2028
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $586
+JUMPV
+LABELV $585
+ADDRLP4 2020
+ADDRLP4 2024
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $586
+ADDRLP4 0+1832
+ADDRLP4 2020
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 2036
+CNSTF4 1132396544
+ADDRLP4 1912
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table+4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 2040
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 2036
+INDIRF4
+ADDRLP4 2040
+INDIRF4
+LTF4 $591
+ADDRLP4 2032
+ADDRLP4 2036
+INDIRF4
+ADDRLP4 2040
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $592
+JUMPV
+LABELV $591
+ADDRLP4 2032
+ADDRLP4 2036
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $592
+ADDRLP4 0+1832+1
+ADDRLP4 2032
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 2048
+CNSTF4 1132396544
+ADDRLP4 1912
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table+8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 2052
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 2048
+INDIRF4
+ADDRLP4 2052
+INDIRF4
+LTF4 $597
+ADDRLP4 2044
+ADDRLP4 2048
+INDIRF4
+ADDRLP4 2052
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $598
+JUMPV
+LABELV $597
+ADDRLP4 2044
+ADDRLP4 2048
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $598
+ADDRLP4 0+1832+2
+ADDRLP4 2044
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+1832+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+ARGP4
+ADDRLP4 2056
+ADDRGP4 CG_ScanForExistingClientInfo
+CALLI4
+ASGNI4
+ADDRLP4 2056
+INDIRI4
+CNSTI4 0
+NEI4 $601
+ADDRLP4 2068
+ADDRGP4 trap_MemoryRemaining
+CALLI4
+ASGNI4
+ADDRLP4 2068
+INDIRI4
+CNSTI4 4000000
+GEI4 $604
+ADDRLP4 2064
+CNSTI4 1
+ASGNI4
+ADDRGP4 $605
+JUMPV
+LABELV $604
+ADDRLP4 2064
+CNSTI4 0
+ASGNI4
+LABELV $605
+ADDRLP4 2060
+ADDRLP4 2064
+INDIRI4
+ASGNI4
+ADDRLP4 2072
+CNSTI4 0
+ASGNI4
+ADDRLP4 2060
+INDIRI4
+ADDRLP4 2072
+INDIRI4
+NEI4 $612
+ADDRGP4 cg_deferPlayers+12
+INDIRI4
+ADDRLP4 2072
+INDIRI4
+NEI4 $613
+ADDRGP4 cg+24
+INDIRI4
+ADDRLP4 2072
+INDIRI4
+EQI4 $606
+LABELV $613
+ADDRLP4 2076
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_buildScript+12
+INDIRI4
+ADDRLP4 2076
+INDIRI4
+NEI4 $606
+ADDRGP4 cg+20
+INDIRI4
+ADDRLP4 2076
+INDIRI4
+NEI4 $606
+LABELV $612
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_SetDeferredClientInfo
+CALLV
+pop
+ADDRLP4 2060
+INDIRI4
+CNSTI4 0
+EQI4 $607
+ADDRGP4 $616
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRLP4 0+484
+CNSTI4 0
+ASGNI4
+ADDRGP4 $607
+JUMPV
+LABELV $606
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_LoadClientInfo
+CALLV
+pop
+LABELV $607
+LABELV $601
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRLP4 1916
+INDIRP4
+ADDRLP4 0
+INDIRB
+ASGNB 1836
+ADDRFP4 0
+INDIRI4
+ADDRGP4 cg+108604+140
+INDIRI4
+NEI4 $618
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 5
+LTI4 $618
+ADDRLP4 0+68
+INDIRI4
+ADDRLP4 1924
+INDIRI4
+EQI4 $618
+ADDRGP4 CG_ForceModelChange
+CALLV
+pop
+LABELV $618
+LABELV $474
+endproc CG_NewClientInfo 2080 12
+export CG_LoadDeferredPlayers
+proc CG_LoadDeferredPlayers 20 4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+41088
+ASGNP4
+ADDRGP4 $628
+JUMPV
+LABELV $625
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $631
+ADDRLP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $631
+ADDRLP4 16
+ADDRGP4 trap_MemoryRemaining
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 4000000
+GEI4 $633
+ADDRGP4 $616
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $626
+JUMPV
+LABELV $633
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_LoadClientInfo
+CALLV
+pop
+LABELV $631
+LABELV $626
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1836
+ADDP4
+ASGNP4
+LABELV $628
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+31488
+INDIRI4
+LTI4 $625
+LABELV $624
+endproc CG_LoadDeferredPlayers 20 4
+export CG_LoadDeferredPlayer
+proc CG_LoadDeferredPlayer 20 4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+41088
+ASGNP4
+ADDRGP4 $639
+JUMPV
+LABELV $636
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $642
+ADDRLP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $642
+ADDRLP4 16
+ADDRGP4 trap_MemoryRemaining
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 4000000
+GEI4 $644
+ADDRGP4 $616
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $645
+JUMPV
+LABELV $644
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_LoadClientInfo
+CALLV
+pop
+LABELV $645
+CNSTI4 1
+RETI4
+ADDRGP4 $635
+JUMPV
+LABELV $642
+LABELV $637
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1836
+ADDP4
+ASGNP4
+LABELV $639
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+31488
+INDIRI4
+LTI4 $636
+CNSTI4 0
+RETI4
+LABELV $635
+endproc CG_LoadDeferredPlayer 20 4
+proc CG_SetLerpFrameAnimation 12 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $649
+ADDRFP4 8
+INDIRI4
+CNSTI4 41
+LTI4 $647
+LABELV $649
+ADDRGP4 $650
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $647
+ADDRLP4 0
+CNSTI4 28
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 cg_debugAnim+12
+INDIRI4
+CNSTI4 0
+EQI4 $651
+ADDRGP4 $654
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $651
+LABELV $646
+endproc CG_SetLerpFrameAnimation 12 8
+proc CG_RunLerpFrame 48 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 cg_animSpeed+12
+INDIRI4
+CNSTI4 0
+NEI4 $656
+ADDRLP4 16
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $655
+JUMPV
+LABELV $656
+ADDRFP4 8
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+NEI4 $661
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $659
+LABELV $661
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetLerpFrameAnimation
+CALLV
+pop
+LABELV $659
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+LTI4 $662
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $665
+ADDRGP4 $655
+JUMPV
+LABELV $665
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+GEI4 $667
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $668
+JUMPV
+LABELV $667
+ADDRLP4 28
+CNSTI4 12
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $668
+ADDRLP4 28
+CNSTI4 12
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+SUBI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRFP4 12
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $670
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+LSHI4
+ASGNI4
+LABELV $670
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $672
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $674
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+SUBI4
+ADDI4
+ASGNI4
+ADDRGP4 $675
+JUMPV
+LABELV $674
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+LABELV $675
+LABELV $672
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $677
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $678
+JUMPV
+LABELV $677
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $679
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $679
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+MODI4
+SUBI4
+ASGNI4
+ADDRGP4 $680
+JUMPV
+LABELV $679
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $680
+LABELV $678
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+LEI4 $681
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRGP4 cg_debugAnim+12
+INDIRI4
+CNSTI4 0
+EQI4 $685
+ADDRGP4 $688
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $685
+LABELV $681
+LABELV $662
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 200
+ADDI4
+LEI4 $689
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+LABELV $689
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+LEI4 $693
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+LABELV $693
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+NEI4 $697
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $698
+JUMPV
+LABELV $697
+ADDRLP4 24
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 1065353216
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+SUBF4
+ASGNF4
+LABELV $698
+LABELV $655
+endproc CG_RunLerpFrame 48 12
+proc CG_ClearLerpFrame 16 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetLerpFrameAnimation
+CALLV
+pop
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $700
+endproc CG_ClearLerpFrame 16 12
+proc CG_PlayerAnimation 20 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg_noPlayerAnims+12
+INDIRI4
+CNSTI4 0
+EQI4 $703
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 20
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $702
+JUMPV
+LABELV $703
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $706
+ADDRLP4 4
+CNSTF4 1073741824
+ASGNF4
+ADDRGP4 $707
+JUMPV
+LABELV $706
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+LABELV $707
+ADDRLP4 0
+CNSTI4 1836
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $709
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+CNSTI4 22
+NEI4 $709
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+ARGP4
+CNSTI4 24
+ARGI4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 CG_RunLerpFrame
+CALLV
+pop
+ADDRGP4 $710
+JUMPV
+LABELV $709
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 CG_RunLerpFrame
+CALLV
+pop
+LABELV $710
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 CG_RunLerpFrame
+CALLV
+pop
+ADDRFP4 16
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 20
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 24
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $702
+endproc CG_PlayerAnimation 20 16
+proc CG_SwingAngles 28 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $712
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 20
+INDIRF4
+GTF4 $716
+ADDRLP4 0
+INDIRF4
+ADDRLP4 20
+INDIRF4
+NEGF4
+GEF4 $714
+LABELV $716
+ADDRFP4 20
+INDIRP4
+CNSTI4 1
+ASGNI4
+LABELV $714
+LABELV $712
+ADDRFP4 20
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $717
+ADDRGP4 $711
+JUMPV
+LABELV $717
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 4
+INDIRF4
+MULF4
+GEF4 $719
+ADDRLP4 4
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 $720
+JUMPV
+LABELV $719
+ADDRLP4 4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+GEF4 $721
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $722
+JUMPV
+LABELV $721
+ADDRLP4 4
+CNSTF4 1073741824
+ASGNF4
+LABELV $722
+LABELV $720
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LTF4 $723
+ADDRLP4 8
+ADDRGP4 cg+107608
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRFP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+LTF4 $726
+ADDRLP4 8
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $726
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 $724
+JUMPV
+LABELV $723
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $728
+ADDRLP4 8
+ADDRGP4 cg+107608
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRFP4 12
+INDIRF4
+NEGF4
+MULF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+GTF4 $731
+ADDRLP4 8
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $731
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+LABELV $728
+LABELV $724
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+LEF4 $733
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+SUBF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 $734
+JUMPV
+LABELV $733
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+NEGF4
+GEF4 $735
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+LABELV $735
+LABELV $734
+LABELV $711
+endproc CG_SwingAngles 28 8
+proc CG_AddPainTwitch 12 0
+ADDRLP4 0
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 200
+LTI4 $739
+ADDRGP4 $737
+JUMPV
+LABELV $739
+ADDRLP4 4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1128792064
+DIVF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $741
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CNSTF4 1101004800
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $742
+JUMPV
+LABELV $741
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CNSTF4 1101004800
+ADDRLP4 4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $742
+LABELV $737
+endproc CG_AddPainTwitch 12 0
+data
+align 4
+LABELV $744
+byte 4 0
+byte 4 22
+byte 4 45
+byte 4 -22
+byte 4 0
+byte 4 22
+byte 4 -45
+byte 4 -22
+code
+proc CG_PlayerAngles 152 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 24+4
+INDIRF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 76
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 84
+CNSTI4 -129
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+BANDI4
+CNSTI4 22
+NEI4 $753
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+BANDI4
+CNSTI4 11
+EQI4 $751
+LABELV $753
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $751
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $754
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRGP4 $755
+JUMPV
+LABELV $754
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+LTI4 $758
+ADDRLP4 52
+INDIRI4
+CNSTI4 7
+LEI4 $756
+LABELV $758
+ADDRGP4 $759
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $756
+LABELV $755
+ADDRLP4 12+4
+ADDRLP4 24+4
+INDIRF4
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $744
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24+4
+INDIRF4
+CNSTF4 1048576000
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $744
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+CNSTF4 1103626240
+ARGF4
+CNSTF4 1119092736
+ARGF4
+ADDRGP4 cg_swingSpeed+8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+ADDRGP4 CG_SwingAngles
+CALLV
+pop
+ADDRLP4 12+4
+INDIRF4
+ARGF4
+CNSTF4 1109393408
+ARGF4
+CNSTF4 1119092736
+ARGF4
+ADDRGP4 cg_swingSpeed+8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+ARGP4
+ADDRGP4 CG_SwingAngles
+CALLV
+pop
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 1127481344
+LEF4 $770
+ADDRLP4 60
+CNSTF4 1061158912
+ADDRLP4 24
+INDIRF4
+CNSTF4 3283353600
+ADDF4
+MULF4
+ASGNF4
+ADDRGP4 $771
+JUMPV
+LABELV $770
+ADDRLP4 60
+CNSTF4 1061158912
+ADDRLP4 24
+INDIRF4
+MULF4
+ASGNF4
+LABELV $771
+ADDRLP4 60
+INDIRF4
+ARGF4
+CNSTF4 1097859072
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1036831949
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+ARGP4
+ADDRGP4 CG_SwingAngles
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LTI4 $772
+ADDRLP4 36
+INDIRI4
+CNSTI4 64
+GEI4 $772
+ADDRLP4 64
+CNSTI4 1836
+ADDRLP4 36
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $775
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $775
+LABELV $772
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 40
+ARGP4
+ADDRLP4 108
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 56
+INDIRF4
+CNSTF4 0
+EQF4 $777
+ADDRLP4 56
+CNSTF4 1028443341
+ADDRLP4 56
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 148
+ADDRLP4 56
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 112+12
+INDIRF4
+MULF4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 112+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 112+12+8
+INDIRF4
+MULF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 148
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 56
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 112
+INDIRF4
+MULF4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 112+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 112+8
+INDIRF4
+MULF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 148
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $777
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LTI4 $791
+ADDRLP4 36
+INDIRI4
+CNSTI4 64
+GEI4 $791
+ADDRLP4 64
+CNSTI4 1836
+ADDRLP4 36
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $794
+ADDRLP4 12+4
+ADDRLP4 0+4
+INDIRF4
+ASGNF4
+ADDRLP4 116
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ADDRLP4 116
+INDIRF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 116
+INDIRF4
+ASGNF4
+LABELV $794
+LABELV $791
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddPainTwitch
+CALLV
+pop
+ADDRLP4 24
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 AnglesSubtract
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 AnglesSubtract
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 24
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+LABELV $743
+endproc CG_PlayerAngles 152 24
+proc CG_SpeedyTrail 52 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+LEI4 $800
+ADDRGP4 $799
+JUMPV
+LABELV $800
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+ARGP4
+ADDRLP4 40
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 40
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 16384
+LEI4 $805
+ADDRFP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 100
+ADDI4
+ASGNI4
+ADDRGP4 $799
+JUMPV
+LABELV $805
+ADDRLP4 28
+INDIRI4
+CNSTI4 1024
+GEI4 $807
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 100
+ADDI4
+ASGNI4
+ADDRGP4 $799
+JUMPV
+LABELV $807
+ADDRFP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $809
+ADDRFP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 100
+ADDI4
+ASGNI4
+ADDRGP4 $799
+JUMPV
+LABELV $809
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $812
+ADDRLP4 48
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+DIVI4
+CVIF4 4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+DIVI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1101004800
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRGP4 LaunchSpeedyPuffTrail
+CALLV
+pop
+LABELV $813
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LTI4 $812
+ADDRFP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 100
+ADDI4
+ASGNI4
+LABELV $799
+endproc CG_SpeedyTrail 52 4
+data
+align 4
+LABELV $822
+byte 4 0
+code
+proc CG_RevivalTrail 20 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 456
+ADDP4
+INDIRI4
+CNSTI4 150
+ADDI4
+ADDRGP4 cg+107612
+INDIRI4
+GEI4 $823
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 12
+ADDRGP4 $822
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $826
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+GTI4 $826
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $834
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $834
+address $828
+address $830
+address $832
+address $833
+code
+LABELV $828
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+CNSTF4 1101004800
+SUBF4
+ASGNF4
+ADDRGP4 $827
+JUMPV
+LABELV $830
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+CNSTF4 1101004800
+ADDF4
+ASGNF4
+ADDRGP4 $827
+JUMPV
+LABELV $832
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1101004800
+SUBF4
+ASGNF4
+ADDRGP4 $827
+JUMPV
+LABELV $833
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1101004800
+ADDF4
+ASGNF4
+ADDRGP4 $827
+JUMPV
+LABELV $826
+ADDRGP4 $822
+CNSTI4 -1
+ASGNI4
+LABELV $827
+ADDRLP4 0
+ARGP4
+CNSTI4 1000
+ARGI4
+ADDRGP4 LaunchRevivalParticle
+CALLV
+pop
+ADDRLP4 16
+ADDRGP4 $822
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 456
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+LABELV $823
+LABELV $821
+endproc CG_RevivalTrail 20 8
+proc CG_TrailItem 192 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 140
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 188
+CNSTF4 0
+ASGNF4
+ADDRLP4 140
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRF4
+CNSTF4 3246391296
+ADDRLP4 152
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+INDIRF4
+CNSTF4 3246391296
+ADDRLP4 152+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+INDIRF4
+CNSTF4 3246391296
+ADDRLP4 152+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 140+4
+INDIRF4
+CNSTF4 1119092736
+ADDF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $836
+endproc CG_TrailItem 192 12
+proc CG_PlayerFlag 356 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+8
+ADDRGP4 cgs+160652+64
+INDIRI4
+ASGNI4
+ADDRLP4 0+12
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+24
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $391
+ARGP4
+ADDRGP4 CG_PositionEntityOnTag
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 140+8
+ADDRGP4 cgs+160652+68
+INDIRI4
+ASGNI4
+ADDRLP4 140+108
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 140+12
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 140+24
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 140+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 332
+CNSTF4 0
+ASGNF4
+ADDRLP4 280+8
+ADDRLP4 332
+INDIRF4
+ASGNF4
+ADDRLP4 280+4
+ADDRLP4 332
+INDIRF4
+ASGNF4
+ADDRLP4 280
+ADDRLP4 332
+INDIRF4
+ASGNF4
+ADDRLP4 312
+CNSTI4 0
+ASGNI4
+ADDRLP4 304
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 22
+EQI4 $868
+ADDRLP4 304
+INDIRI4
+CNSTI4 23
+NEI4 $866
+LABELV $868
+ADDRLP4 320
+CNSTI4 39
+ASGNI4
+ADDRGP4 $867
+JUMPV
+LABELV $866
+ADDRLP4 304
+INDIRI4
+CNSTI4 14
+EQI4 $871
+ADDRLP4 304
+INDIRI4
+CNSTI4 13
+NEI4 $869
+LABELV $871
+ADDRLP4 320
+CNSTI4 39
+ASGNI4
+ADDRLP4 312
+CNSTI4 1
+ASGNI4
+ADDRGP4 $870
+JUMPV
+LABELV $869
+ADDRLP4 320
+CNSTI4 38
+ASGNI4
+ADDRLP4 312
+CNSTI4 1
+ASGNI4
+LABELV $870
+LABELV $867
+ADDRLP4 312
+INDIRI4
+CNSTI4 0
+EQI4 $872
+ADDRLP4 292
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 292+8
+ADDRLP4 292+8
+INDIRF4
+CNSTF4 1120403456
+ADDF4
+ASGNF4
+ADDRLP4 292
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 308
+ADDRLP4 0+28+24
+INDIRF4
+ADDRLP4 292
+INDIRF4
+MULF4
+ADDRLP4 0+28+24+4
+INDIRF4
+ADDRLP4 292+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+28+24+8
+INDIRF4
+ADDRLP4 292+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 308
+INDIRF4
+ARGF4
+ADDRLP4 344
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 344
+INDIRF4
+CNSTF4 1063675494
+GEF4 $885
+ADDRLP4 308
+ADDRLP4 0+28
+INDIRF4
+ADDRLP4 292
+INDIRF4
+MULF4
+ADDRLP4 0+28+4
+INDIRF4
+ADDRLP4 292+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+28+8
+INDIRF4
+ADDRLP4 292+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 308
+INDIRF4
+CNSTF4 1065353216
+LEF4 $894
+ADDRLP4 308
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $895
+JUMPV
+LABELV $894
+ADDRLP4 308
+INDIRF4
+CNSTF4 3212836864
+GEF4 $896
+ADDRLP4 308
+CNSTF4 3212836864
+ASGNF4
+LABELV $896
+LABELV $895
+ADDRLP4 308
+INDIRF4
+ARGF4
+ADDRLP4 348
+ADDRGP4 acos
+CALLF4
+ASGNF4
+ADDRLP4 324
+ADDRLP4 348
+INDIRF4
+ASGNF4
+ADDRLP4 308
+ADDRLP4 0+28+12
+INDIRF4
+ADDRLP4 292
+INDIRF4
+MULF4
+ADDRLP4 0+28+12+4
+INDIRF4
+ADDRLP4 292+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+28+12+8
+INDIRF4
+ADDRLP4 292+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 308
+INDIRF4
+CNSTF4 0
+GEF4 $908
+ADDRLP4 280+4
+CNSTF4 1135869952
+CNSTF4 1127481344
+ADDRLP4 324
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $909
+JUMPV
+LABELV $908
+ADDRLP4 280+4
+CNSTF4 1127481344
+ADDRLP4 324
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ASGNF4
+LABELV $909
+ADDRLP4 280+4
+INDIRF4
+CNSTF4 0
+GEF4 $912
+ADDRLP4 280+4
+ADDRLP4 280+4
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $912
+ADDRLP4 280+4
+INDIRF4
+CNSTF4 1135869952
+LEF4 $916
+ADDRLP4 280+4
+ADDRLP4 280+4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $916
+ADDRLP4 280+4
+INDIRF4
+ARGF4
+CNSTF4 1103626240
+ARGF4
+CNSTF4 1119092736
+ARGF4
+CNSTF4 1041865114
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 600
+ADDP4
+ARGP4
+ADDRGP4 CG_SwingAngles
+CALLV
+pop
+LABELV $885
+LABELV $872
+ADDRLP4 280+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 316
+CNSTI4 1836
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088
+ADDP4
+ASGNP4
+ADDRLP4 316
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+ARGP4
+ADDRLP4 320
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_RunLerpFrame
+CALLV
+pop
+ADDRLP4 140+96
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140+80
+ADDRFP4 0
+INDIRP4
+CNSTI4 584
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140+100
+ADDRFP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 280
+ARGP4
+ADDRLP4 140+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $391
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $850
+endproc CG_PlayerFlag 356 24
+proc CG_PlayerCartridges 200 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 180
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 124
+ADDRFP4 0
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cg+122436
+ADDP4
+ASGNP4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+NEI4 $930
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $928
+JUMPV
+LABELV $930
+ADDRLP4 180
+INDIRI4
+CNSTI4 10
+LEI4 $932
+ADDRLP4 180
+CNSTI4 10
+ASGNI4
+LABELV $932
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $937
+JUMPV
+LABELV $934
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $941
+JUMPV
+LABELV $938
+ADDRLP4 184
+CNSTI4 12
+ASGNI4
+ADDRLP4 188
+ADDRLP4 184
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ADDRLP4 188
+INDIRI4
+ADDRLP4 184
+INDIRI4
+SUBI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $939
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $941
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $938
+ADDRLP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $935
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $937
+ADDRLP4 8
+INDIRI4
+ADDRLP4 180
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+SUBI4
+LTI4 $934
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRLP4 152
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $945
+JUMPV
+LABELV $942
+ADDRLP4 184
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 164
+ADDRLP4 184
+INDIRP4
+INDIRF4
+ADDRLP4 152
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 164+4
+ADDRLP4 184
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 152+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 164+8
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 152+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 164
+ARGP4
+ADDRLP4 188
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 188
+INDIRF4
+CNSTF4 1106247680
+LEF4 $950
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ADDRLP4 152
+INDIRF4
+CNSTF4 1106247680
+ADDRLP4 164
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 152+4
+INDIRF4
+CNSTF4 1106247680
+ADDRLP4 164+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRLP4 152+8
+INDIRF4
+CNSTF4 1106247680
+ADDRLP4 164+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $950
+ADDRLP4 152
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $943
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $945
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+LTI4 $942
+ADDRLP4 12
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 184
+CNSTI4 1836
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 1
+EQI4 $961
+ADDRLP4 184
+INDIRI4
+CNSTI4 2
+EQI4 $966
+ADDRGP4 $956
+JUMPV
+LABELV $961
+ADDRLP4 12+8
+CNSTI4 24
+ADDRGP4 cgs+160652+364
+INDIRI4
+MULI4
+ADDRGP4 cg_items+4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $957
+JUMPV
+LABELV $966
+ADDRLP4 12+8
+CNSTI4 24
+ADDRGP4 cgs+160652+360
+INDIRI4
+MULI4
+ADDRGP4 cg_items+4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $957
+JUMPV
+LABELV $956
+ADDRLP4 12+8
+CNSTI4 24
+ADDRGP4 cgs+160652+368
+INDIRI4
+MULI4
+ADDRGP4 cg_items+4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $957
+ADDRLP4 12+4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 152
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $979
+JUMPV
+LABELV $976
+ADDRLP4 12+28
+ADDRLP4 152
+INDIRF4
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+28+4
+ADDRLP4 152+4
+INDIRF4
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+28+8
+ADDRLP4 152+8
+INDIRF4
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+28+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+28
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 12+28+24
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+28+24+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+28+24+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+28
+ARGP4
+ADDRLP4 12+28+24
+ARGP4
+ADDRLP4 12+28+12
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 12+28+12
+ARGP4
+ADDRGP4 VectorInverse
+CALLV
+pop
+ADDRLP4 12+68
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 176
+CNSTF4 1086918619
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 5000
+ADDI4
+CNSTI4 500
+ADDRLP4 8
+INDIRI4
+MULI4
+SUBI4
+CNSTI4 16
+DIVI4
+CNSTI4 255
+BANDI4
+CVIF4 4
+MULF4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 176
+INDIRF4
+ARGF4
+ADDRLP4 192
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 12+68+8
+ADDRLP4 12+68+8
+INDIRF4
+CNSTF4 1092616192
+ADDRLP4 192
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+112
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1836
+ADDRFP4 0
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddRefEntityWithPowerups
+CALLV
+pop
+ADDRLP4 152
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $977
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $979
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+LTI4 $976
+LABELV $928
+endproc CG_PlayerCartridges 200 12
+proc CG_PlayerPowerups 16 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 8388609
+BANDI4
+CNSTI4 0
+EQI4 $1013
+ADDRGP4 $1012
+JUMPV
+LABELV $1013
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1048576
+BANDI4
+CNSTI4 0
+EQI4 $1015
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRGP4 cgs+160652+1628
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_AddLoopingSound
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+CNSTF4 1101004800
+ARGF4
+CNSTF4 1045220557
+ARGF4
+CNSTF4 0
+ARGF4
+CNSTF4 1053609165
+ARGF4
+CNSTF4 1056964608
+ARGF4
+CNSTF4 1157234688
+ARGF4
+ADDRGP4 cg+107612
+INDIRI4
+ARGI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 cgs+160652+208
+INDIRI4
+ARGI4
+ADDRGP4 CG_SmokePuff
+CALLP4
+pop
+LABELV $1015
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1022
+ADDRGP4 $1012
+JUMPV
+LABELV $1022
+ADDRLP4 4
+CNSTI4 1836
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1029
+ADDRGP4 cg+108596
+INDIRI4
+CNSTI4 0
+EQI4 $1025
+LABELV $1029
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $1030
+ADDRLP4 4
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1032
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+160652+72
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_PlayerFlag
+CALLV
+pop
+ADDRGP4 $1033
+JUMPV
+LABELV $1032
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+160652+12
+INDIRI4
+ARGI4
+ADDRGP4 CG_TrailItem
+CALLV
+pop
+LABELV $1033
+LABELV $1030
+ADDRLP4 0
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $1038
+ADDRLP4 4
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1040
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+160652+76
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_PlayerFlag
+CALLV
+pop
+ADDRGP4 $1041
+JUMPV
+LABELV $1040
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+160652+16
+INDIRI4
+ARGI4
+ADDRGP4 CG_TrailItem
+CALLV
+pop
+LABELV $1041
+LABELV $1038
+LABELV $1025
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $1046
+ADDRLP4 8
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+CNSTF4 1128792064
+ADDF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 12
+CNSTF4 1045220557
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+ADDRGP4 $1047
+JUMPV
+LABELV $1046
+ADDRLP4 0
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $1048
+ADDRLP4 8
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+CNSTF4 1128792064
+ADDF4
+ARGF4
+ADDRLP4 12
+CNSTF4 1045220557
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $1048
+LABELV $1047
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1050
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_SpeedyTrail
+CALLV
+pop
+LABELV $1050
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $1052
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_RevivalTrail
+CALLV
+pop
+LABELV $1052
+LABELV $1012
+endproc CG_PlayerPowerups 16 48
+proc CG_PlayerFloatSprite 149 12
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1055
+ADDRGP4 cg+108596
+INDIRI4
+CNSTI4 0
+NEI4 $1055
+ADDRLP4 140
+CNSTI4 2
+ASGNI4
+ADDRGP4 $1056
+JUMPV
+LABELV $1055
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+LABELV $1056
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+112
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0+132
+CNSTF4 1092616192
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1072
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $1072
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 8
+NEI4 $1075
+ADDRFP4 4
+INDIRI4
+ADDRGP4 cgs+160652+1028
+INDIRI4
+NEI4 $1075
+ADDRLP4 144
+CNSTI4 1836
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+112
+ADDRGP4 cgs+160652+524
+INDIRI4
+ASGNI4
+ADDRLP4 148
+CNSTU1 0
+ASGNU1
+ADDRLP4 0+116+2
+ADDRLP4 148
+INDIRU1
+ASGNU1
+ADDRLP4 0+116+1
+ADDRLP4 148
+INDIRU1
+ASGNU1
+ADDRLP4 0+116
+ADDRLP4 148
+INDIRU1
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+EQI4 $1094
+ADDRGP4 $1092
+JUMPV
+LABELV $1094
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRGP4 $1093
+JUMPV
+LABELV $1092
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+LABELV $1093
+LABELV $1075
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1054
+endproc CG_PlayerFloatSprite 149 12
+proc CG_PlayerSprites 16 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $1099
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+160652+120
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $1098
+JUMPV
+LABELV $1099
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $1103
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+160652+116
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $1098
+JUMPV
+LABELV $1103
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+132104
+ADDP4
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 1000
+SUBI4
+LEI4 $1107
+CNSTI4 1836
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+72
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1111
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+160652+1008
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $1098
+JUMPV
+LABELV $1111
+LABELV $1107
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $1117
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+160652+1012
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $1098
+JUMPV
+LABELV $1117
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $1121
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+160652+1016
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $1098
+JUMPV
+LABELV $1121
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2097152
+BANDI4
+CNSTI4 0
+EQI4 $1125
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+160652+1020
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $1098
+JUMPV
+LABELV $1125
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 4194304
+BANDI4
+CNSTI4 0
+EQI4 $1129
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+160652+1024
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $1098
+JUMPV
+LABELV $1129
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $1133
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+160652+1028
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $1098
+JUMPV
+LABELV $1133
+ADDRLP4 0
+CNSTI4 1836
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $1139
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1139
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 5
+LTI4 $1139
+ADDRGP4 cg_drawFriend+12
+INDIRI4
+CNSTI4 0
+EQI4 $1098
+ADDRGP4 cg_icons+12
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1149
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 8
+NEI4 $1149
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1150
+JUMPV
+LABELV $1149
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $1150
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+160652+112
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+LABELV $1139
+LABELV $1098
+endproc CG_PlayerSprites 16 12
+lit
+align 4
+LABELV $1154
+byte 4 3245342720
+byte 4 3245342720
+byte 4 0
+align 4
+LABELV $1155
+byte 4 1097859072
+byte 4 1097859072
+byte 4 1073741824
+code
+proc CG_PlayerShadow 108 44
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 72
+ADDRGP4 $1154
+INDIRB
+ASGNB 12
+ADDRLP4 84
+ADDRGP4 $1155
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg_shadows+12
+INDIRI4
+CNSTI4 0
+NEI4 $1156
+CNSTI4 0
+RETI4
+ADDRGP4 $1153
+JUMPV
+LABELV $1156
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $1159
+CNSTI4 0
+RETI4
+ADDRGP4 $1153
+JUMPV
+LABELV $1159
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 60+8
+ADDRLP4 60+8
+INDIRF4
+CNSTF4 1124073472
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ARGP4
+ADDRLP4 60
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 84
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 33619969
+ARGI4
+ADDRGP4 trap_CM_BoxTrace
+CALLV
+pop
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+EQF4 $1167
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+4
+INDIRI4
+ADDRLP4 96
+INDIRI4
+NEI4 $1167
+ADDRLP4 0
+INDIRI4
+ADDRLP4 96
+INDIRI4
+EQI4 $1162
+LABELV $1167
+CNSTI4 0
+RETI4
+ADDRGP4 $1153
+JUMPV
+LABELV $1162
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0+12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRGP4 cg_shadows+12
+INDIRI4
+CNSTI4 1
+EQI4 $1170
+CNSTI4 1
+RETI4
+ADDRGP4 $1153
+JUMPV
+LABELV $1170
+ADDRLP4 100
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 56
+ADDRLP4 100
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 cgs+160652+272
+INDIRI4
+ARGI4
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 0+24
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 100
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTF4 1103101952
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_ImpactMark
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1153
+endproc CG_PlayerShadow 108 44
+proc CG_PlayerSplash 196 28
+ADDRGP4 cg_shadows+12
+INDIRI4
+CNSTI4 0
+NEI4 $1179
+ADDRGP4 $1178
+JUMPV
+LABELV $1179
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 164+8
+ADDRLP4 164+8
+INDIRF4
+CNSTF4 1103101952
+SUBF4
+ASGNF4
+ADDRLP4 164
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 180
+ADDRGP4 trap_CM_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 176
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+NEI4 $1183
+ADDRGP4 $1178
+JUMPV
+LABELV $1183
+ADDRLP4 152
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 152+8
+ADDRLP4 152+8
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 152
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 184
+ADDRGP4 trap_CM_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 176
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 57
+BANDI4
+CNSTI4 0
+EQI4 $1186
+ADDRGP4 $1178
+JUMPV
+LABELV $1186
+ADDRLP4 96
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRLP4 164
+ARGP4
+ADDRLP4 188
+CNSTP4 0
+ASGNP4
+ADDRLP4 188
+INDIRP4
+ARGP4
+ADDRLP4 188
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 56
+ARGI4
+ADDRGP4 trap_CM_BoxTrace
+CALLV
+pop
+ADDRLP4 96+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $1188
+ADDRGP4 $1178
+JUMPV
+LABELV $1188
+ADDRLP4 0
+ADDRLP4 96+12
+INDIRB
+ASGNB 12
+ADDRLP4 192
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 192
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 192
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24
+ADDRLP4 96+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+24
+ADDRLP4 0+24
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRLP4 0+24+4
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 0+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+24+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48
+ADDRLP4 96+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+48
+ADDRLP4 0+48
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 0+48+4
+ADDRLP4 0+48+4
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 0+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72
+ADDRLP4 96+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+72
+ADDRLP4 0+72
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 0+72+4
+ADDRLP4 0+72+4
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+ASGNF4
+ADDRLP4 0+72+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+72+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+20+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 cgs+160652+296
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+LABELV $1178
+endproc CG_PlayerSplash 196 28
+export CG_AddRefEntityWithPowerups
+proc CG_AddRefEntityWithPowerups 108 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $1269
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+160652+316
+INDIRI4
+ASGNI4
+ADDRGP4 $1270
+JUMPV
+LABELV $1269
+ADDRFP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1273
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+160652+644
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $1279
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+EQI4 $1280
+ADDRGP4 $1277
+JUMPV
+LABELV $1279
+ADDRLP4 8
+CNSTU1 0
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 8
+INDIRU1
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 8
+INDIRU1
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRGP4 $1278
+JUMPV
+LABELV $1280
+ADDRLP4 16
+CNSTU1 0
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 16
+INDIRU1
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 16
+INDIRU1
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRGP4 $1278
+JUMPV
+LABELV $1277
+ADDRLP4 24
+CNSTU1 255
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 24
+INDIRU1
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 24
+INDIRU1
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 24
+INDIRU1
+ASGNU1
+LABELV $1278
+LABELV $1273
+LABELV $1270
+ADDRFP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $1281
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+160652+656
+INDIRI4
+ASGNI4
+LABELV $1281
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+111040
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $1285
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $1285
+ADDRGP4 cgs+160652+628
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $1285
+ADDRLP4 4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+EQI4 $1294
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $1292
+LABELV $1294
+ADDRLP4 4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+NEI4 $1292
+ADDRGP4 $1293
+JUMPV
+LABELV $1292
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+160652+628
+INDIRI4
+ASGNI4
+LABELV $1293
+LABELV $1285
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $1297
+ADDRFP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $1297
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+160652+660
+INDIRI4
+ASGNI4
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 4000
+LTI4 $1301
+ADDRFP4 0
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRGP4 $1302
+JUMPV
+LABELV $1301
+ADDRLP4 16
+CNSTF4 1132396544
+CNSTI4 255
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+SUBI4
+MULI4
+CVIF4 4
+CNSTF4 1165623296
+DIVF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+LTF4 $1306
+ADDRLP4 12
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1307
+JUMPV
+LABELV $1306
+ADDRLP4 12
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1307
+ADDRFP4 0
+INDIRP4
+CNSTI4 119
+ADDP4
+ADDRLP4 12
+INDIRU4
+CVUU1 4
+ASGNU1
+LABELV $1302
+LABELV $1297
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1308
+ADDRLP4 12
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 1836
+ADDRFP4 4
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+160
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 20
+INDIRI4
+NEI4 $1313
+CNSTI4 1836
+ADDRFP4 4
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+160
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $1313
+ADDRLP4 12
+INDIRI4
+CNSTI4 1500
+GEI4 $1313
+ADDRLP4 32
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+CNSTF4 1153138688
+DIVF4
+ASGNF4
+ADDRLP4 28
+CNSTF4 1050253722
+ADDRLP4 32
+INDIRF4
+MULF4
+CNSTF4 1065437102
+ADDF4
+ASGNF4
+ADDRLP4 72
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 1
+EQI4 $1319
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+EQI4 $1322
+ADDRGP4 $1317
+JUMPV
+LABELV $1319
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+160652+960
+INDIRI4
+ASGNI4
+ADDRGP4 $1318
+JUMPV
+LABELV $1322
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+160652+956
+INDIRI4
+ASGNI4
+ADDRGP4 $1318
+JUMPV
+LABELV $1317
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+160652+964
+INDIRI4
+ASGNI4
+LABELV $1318
+ADDRLP4 80
+CNSTF4 1132396544
+CNSTF4 1065353216
+ADDRLP4 32
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 84
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 80
+INDIRF4
+ADDRLP4 84
+INDIRF4
+LTF4 $1328
+ADDRLP4 76
+ADDRLP4 80
+INDIRF4
+ADDRLP4 84
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1329
+JUMPV
+LABELV $1328
+ADDRLP4 76
+ADDRLP4 80
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1329
+ADDRLP4 92
+ADDRLP4 76
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 92
+INDIRU1
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 92
+INDIRU1
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 92
+INDIRU1
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRGP4 AxisCopy
+CALLV
+pop
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+LABELV $1330
+ADDRLP4 96
+CNSTI4 12
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 96
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 100
+CNSTI4 12
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ADDRLP4 100
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 104
+CNSTI4 12
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1331
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 3
+LTI4 $1330
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 36
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 AxisCopy
+CALLV
+pop
+LABELV $1313
+LABELV $1308
+LABELV $1268
+endproc CG_AddRefEntityWithPowerups 108 8
+export CG_LightVerts
+proc CG_LightVerts 88 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 trap_R_LightForPoint
+CALLI4
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1338
+JUMPV
+LABELV $1335
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+GTF4 $1341
+ADDRLP4 56
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 60
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 60
+INDIRF4
+LTF4 $1344
+ADDRLP4 52
+ADDRLP4 56
+INDIRF4
+ADDRLP4 60
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1345
+JUMPV
+LABELV $1344
+ADDRLP4 52
+ADDRLP4 56
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1345
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+ADDRLP4 52
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 68
+ADDRLP4 12+4
+INDIRF4
+ASGNF4
+ADDRLP4 72
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+LTF4 $1348
+ADDRLP4 64
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1349
+JUMPV
+LABELV $1348
+ADDRLP4 64
+ADDRLP4 68
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1349
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 21
+ADDP4
+ADDRLP4 64
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 80
+ADDRLP4 12+8
+INDIRF4
+ASGNF4
+ADDRLP4 84
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 80
+INDIRF4
+ADDRLP4 84
+INDIRF4
+LTF4 $1352
+ADDRLP4 76
+ADDRLP4 80
+INDIRF4
+ADDRLP4 84
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1353
+JUMPV
+LABELV $1352
+ADDRLP4 76
+ADDRLP4 80
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1353
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 22
+ADDP4
+ADDRLP4 76
+INDIRU4
+CVUU1 4
+ASGNU1
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 23
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRGP4 $1336
+JUMPV
+LABELV $1341
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 255
+LEI4 $1354
+ADDRLP4 0
+CNSTI4 255
+ASGNI4
+LABELV $1354
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 255
+LEI4 $1358
+ADDRLP4 0
+CNSTI4 255
+ASGNI4
+LABELV $1358
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 21
+ADDP4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 255
+LEI4 $1362
+ADDRLP4 0
+CNSTI4 255
+ASGNI4
+LABELV $1362
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 22
+ADDP4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 23
+ADDP4
+CNSTU1 255
+ASGNU1
+LABELV $1336
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1338
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $1335
+CNSTI4 1
+RETI4
+LABELV $1334
+endproc CG_LightVerts 88 16
+export CG_AddStars
+proc CG_AddStars 176 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+8
+ADDRGP4 cgs+160652+724
+INDIRI4
+ASGNI4
+ADDRGP4 cg+108596
+INDIRI4
+CNSTI4 0
+NEI4 $1368
+ADDRFP4 0
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1368
+ADDRLP4 0+4
+CNSTI4 2
+ASGNI4
+LABELV $1368
+ADDRLP4 152
+CNSTI4 3000
+ASGNI4
+ADDRLP4 148
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 152
+INDIRI4
+MODI4
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRLP4 152
+INDIRI4
+DIVI4
+ASGNI4
+ADDRFP4 12
+INDIRF4
+CNSTF4 1065353216
+EQF4 $1374
+ADDRLP4 160
+CNSTF4 1132396544
+ADDRFP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 164
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 160
+INDIRF4
+ADDRLP4 164
+INDIRF4
+LTF4 $1379
+ADDRLP4 156
+ADDRLP4 160
+INDIRF4
+ADDRLP4 164
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1380
+JUMPV
+LABELV $1379
+ADDRLP4 156
+ADDRLP4 160
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1380
+ADDRLP4 0+116+3
+ADDRLP4 156
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+LABELV $1374
+ADDRLP4 144
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRGP4 $1385
+JUMPV
+LABELV $1382
+ADDRLP4 140
+CNSTF4 1086918619
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 3000
+MODI4
+CVIF4 4
+CNSTF4 1161527296
+DIVF4
+ADDRLP4 144
+INDIRI4
+CVIF4 4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+DIVF4
+SUBF4
+ADDRGP4 cg+111016+4
+INDIRF4
+CNSTF4 1135869952
+DIVF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 140
+INDIRF4
+ARGF4
+ADDRLP4 156
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 0+28
+ADDRLP4 156
+INDIRF4
+ASGNF4
+ADDRLP4 140
+INDIRF4
+ARGF4
+ADDRLP4 160
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0+28+4
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 0+28+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 140
+INDIRF4
+ARGF4
+ADDRLP4 164
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0+28+12
+ADDRLP4 164
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 140
+INDIRF4
+ARGF4
+ADDRLP4 168
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 0+28+12+4
+ADDRLP4 168
+INDIRF4
+ASGNF4
+ADDRLP4 0+28+12+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+28+24
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+28+24+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+28+24+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 140
+CNSTF4 1086918619
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 1200
+MODI4
+CVIF4 4
+CNSTF4 1150681088
+DIVF4
+ADDRLP4 144
+INDIRI4
+CVIF4 4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+DIVF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 0+68
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 1092616192
+ADDRLP4 0+28
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1092616192
+ADDRLP4 0+28+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1092616192
+ADDRLP4 0+28+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 140
+INDIRF4
+ARGF4
+ADDRLP4 172
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 1069547520
+ADDRLP4 172
+INDIRF4
+MULF4
+CNSTF4 1096810496
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0+128
+CNSTF4 1028443341
+ADDRLP4 144
+INDIRI4
+ADDRFP4 8
+INDIRI4
+MODI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1383
+ADDRLP4 144
+ADDRLP4 144
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1385
+ADDRLP4 144
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 148
+INDIRI4
+ADDI4
+LTI4 $1382
+LABELV $1364
+endproc CG_AddStars 176 12
+proc CG_PlayerGlowmodel 0 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 1828
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1425
+ADDRFP4 8
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1832
+ADDP4
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 12
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1832
+ADDP4
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 16
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1832
+ADDP4
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1425
+LABELV $1424
+endproc CG_PlayerGlowmodel 0 12
+export CG_Player
+proc CG_Player 500 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 444
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 448
+ADDRFP4 0
+INDIRP4
+CNSTI4 748
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 436
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 428
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 428
+INDIRI4
+CNSTI4 0
+LTI4 $1431
+ADDRLP4 428
+INDIRI4
+CNSTI4 64
+LTI4 $1429
+LABELV $1431
+ADDRGP4 $1432
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $1429
+ADDRLP4 280
+CNSTI4 1836
+ADDRLP4 428
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088
+ADDP4
+ASGNP4
+ADDRLP4 280
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $1434
+ADDRGP4 $1427
+JUMPV
+LABELV $1434
+ADDRLP4 424
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1436
+ADDRGP4 cg+108596
+INDIRI4
+CNSTI4 0
+NEI4 $1439
+ADDRLP4 424
+CNSTI4 2
+ASGNI4
+ADDRGP4 $1440
+JUMPV
+LABELV $1439
+ADDRGP4 cg_cameraMode+12
+INDIRI4
+CNSTI4 0
+EQI4 $1442
+ADDRGP4 $1427
+JUMPV
+LABELV $1442
+LABELV $1440
+LABELV $1436
+ADDRLP4 460
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 460
+INDIRI4
+EQI4 $1445
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ADDRLP4 460
+INDIRI4
+EQI4 $1445
+ADDRLP4 436
+INDIRI4
+CNSTI4 4000
+LTI4 $1447
+ADDRGP4 $1427
+JUMPV
+LABELV $1447
+ADDRLP4 464
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ASGNP4
+ADDRLP4 464
+INDIRP4
+ADDRLP4 464
+INDIRP4
+INDIRF4
+ADDRLP4 436
+INDIRI4
+CVIF4 4
+CNSTF4 1101004800
+DIVF4
+ADDF4
+ASGNF4
+ADDRLP4 468
+ADDRFP4 0
+INDIRP4
+CNSTI4 748
+ADDP4
+ASGNP4
+ADDRLP4 468
+INDIRP4
+ADDRLP4 468
+INDIRP4
+INDIRF4
+ADDRLP4 436
+INDIRI4
+CVIF4 4
+CNSTF4 1092616192
+DIVF4
+ADDF4
+ASGNF4
+LABELV $1445
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 140
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 284
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 428
+INDIRI4
+ARGI4
+ADDRLP4 280
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRLP4 284
+ARGP4
+ADDRGP4 CG_PlayerGlowmodel
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRLP4 140+28
+ARGP4
+ADDRLP4 284+28
+ARGP4
+ADDRGP4 CG_PlayerAngles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+96
+ARGP4
+ADDRLP4 0+80
+ARGP4
+ADDRLP4 0+100
+ARGP4
+ADDRLP4 140+96
+ARGP4
+ADDRLP4 140+80
+ARGP4
+ADDRLP4 140+100
+ARGP4
+ADDRGP4 CG_PlayerAnimation
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_PlayerSprites
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 432
+ARGP4
+ADDRLP4 464
+ADDRGP4 CG_PlayerShadow
+CALLI4
+ASGNI4
+ADDRLP4 440
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_PlayerSplash
+CALLV
+pop
+ADDRGP4 cg_shadows+12
+INDIRI4
+CNSTI4 3
+NEI4 $1458
+ADDRLP4 440
+INDIRI4
+CNSTI4 0
+EQI4 $1458
+ADDRLP4 424
+ADDRLP4 424
+INDIRI4
+CNSTI4 256
+BORI4
+ASGNI4
+LABELV $1458
+ADDRLP4 424
+ADDRLP4 424
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 7
+EQI4 $1465
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 3
+NEI4 $1461
+LABELV $1465
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 424
+INDIRI4
+CNSTI4 -129
+BANDI4
+ARGI4
+ADDRGP4 CG_PlayerCartridges
+CALLV
+pop
+LABELV $1461
+ADDRLP4 0+8
+ADDRLP4 280
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+108
+ADDRLP4 280
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+24
+ADDRLP4 432
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 424
+INDIRI4
+ASGNI4
+ADDRLP4 0+84
+ADDRLP4 0+68
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 280
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddRefEntityWithPowerups
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 0
+NEI4 $1474
+ADDRGP4 $1427
+JUMPV
+LABELV $1474
+ADDRLP4 140+8
+ADDRLP4 280
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140+8
+INDIRI4
+CNSTI4 0
+NEI4 $1478
+ADDRGP4 $1427
+JUMPV
+LABELV $1478
+ADDRLP4 140+108
+ADDRLP4 280
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 140
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 280
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $1483
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 140+24
+ADDRLP4 432
+INDIRF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 424
+INDIRI4
+ASGNI4
+ADDRLP4 140
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 280
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddRefEntityWithPowerups
+CALLV
+pop
+ADDRLP4 284+8
+ADDRLP4 280
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 284+8
+INDIRI4
+CNSTI4 0
+NEI4 $1487
+ADDRGP4 $1427
+JUMPV
+LABELV $1487
+ADDRLP4 284+108
+ADDRLP4 280
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 284+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 284
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRLP4 280
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $1492
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 284+24
+ADDRLP4 432
+INDIRF4
+ASGNF4
+ADDRLP4 284+4
+ADDRLP4 424
+INDIRI4
+ASGNI4
+ADDRLP4 284
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 280
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddRefEntityWithPowerups
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ADDRLP4 444
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 748
+ADDP4
+ADDRLP4 448
+INDIRF4
+ASGNF4
+ADDRLP4 472
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 472
+INDIRI4
+EQI4 $1495
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+ADDRLP4 472
+INDIRI4
+NEI4 $1495
+ADDRLP4 476
+CNSTI4 0
+ASGNI4
+ADDRLP4 480
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1498
+ADDRLP4 484
+CNSTI4 3
+ASGNI4
+ADDRGP4 $1499
+JUMPV
+LABELV $1498
+ADDRLP4 484
+CNSTI4 0
+ASGNI4
+LABELV $1499
+ADDRLP4 476
+ADDRLP4 476
+INDIRI4
+ADDRLP4 484
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1501
+ADDRLP4 488
+CNSTI4 3
+ASGNI4
+ADDRGP4 $1502
+JUMPV
+LABELV $1501
+ADDRLP4 488
+CNSTI4 0
+ASGNI4
+LABELV $1502
+ADDRLP4 476
+ADDRLP4 476
+INDIRI4
+ADDRLP4 488
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 496
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 496
+INDIRI4
+EQI4 $1503
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ADDRLP4 496
+INDIRI4
+EQI4 $1503
+ADDRLP4 436
+INDIRI4
+CNSTI4 1000
+GTI4 $1505
+ADDRLP4 480
+CNSTF4 1065353216
+ADDRLP4 436
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $1506
+JUMPV
+LABELV $1505
+ADDRLP4 480
+CNSTF4 0
+ASGNF4
+LABELV $1506
+LABELV $1503
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 284+68
+ARGP4
+ADDRLP4 476
+INDIRI4
+ARGI4
+ADDRLP4 480
+INDIRF4
+ARGF4
+ADDRGP4 CG_AddStars
+CALLV
+pop
+LABELV $1495
+ADDRLP4 476
+CNSTI4 4
+ASGNI4
+ADDRGP4 cgs+31464
+INDIRI4
+ADDRLP4 476
+INDIRI4
+NEI4 $1508
+ADDRLP4 480
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+31780
+INDIRI4
+ADDRLP4 476
+INDIRI4
+BANDI4
+ADDRLP4 480
+INDIRI4
+NEI4 $1508
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $1508
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 8388609
+BANDI4
+ADDRLP4 480
+INDIRI4
+NEI4 $1508
+ADDRLP4 280
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 488
+ADDRLP4 280
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 488
+INDIRP4
+ADDRLP4 488
+INDIRP4
+INDIRF4
+CNSTF4 1115684864
+ADDF4
+ASGNF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 156
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRGP4 $1509
+JUMPV
+LABELV $1508
+ADDRLP4 280
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+EQI4 $1514
+ADDRLP4 280
+INDIRP4
+CNSTI4 156
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1514
+LABELV $1509
+ADDRLP4 140
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 280
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddPlayerWeapon
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRGP4 CG_PlayerPowerups
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddBoundingBox
+CALLV
+pop
+LABELV $1427
+endproc CG_Player 500 28
+export CG_ResetPlayerEntity
+proc CG_ResetPlayerEntity 40 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 664
+ADDP4
+CNSTI4 -99999
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 692
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1836
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_ClearLerpFrame
+CALLV
+pop
+CNSTI4 1836
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_ClearLerpFrame
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+107612
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRGP4 cg+107612
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 696
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 708
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 48
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 48
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 708
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugPosition+12
+INDIRI4
+CNSTI4 0
+EQI4 $1522
+ADDRGP4 $1525
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1522
+LABELV $1517
+endproc CG_ResetPlayerEntity 40 12
+data
+align 4
+LABELV $1527
+byte 4 0
+export CG_UpdateVoipTeamIDs
+code
+proc CG_UpdateVoipTeamIDs 532 12
+ADDRLP4 260
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1527
+INDIRI4
+CNSTI4 500
+ADDI4
+ADDRGP4 cg+107612
+INDIRI4
+LEI4 $1528
+ADDRGP4 $1526
+JUMPV
+LABELV $1528
+ADDRGP4 $1527
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 5
+GEI4 $1532
+ADDRGP4 $1526
+JUMPV
+LABELV $1532
+ADDRGP4 $1535
+ARGP4
+ADDRLP4 268
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 268
+ARGP4
+ADDRGP4 $1538
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 524
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 524
+INDIRI4
+CNSTI4 0
+EQI4 $1536
+ADDRGP4 $1526
+JUMPV
+LABELV $1536
+ADDRLP4 4
+ARGP4
+ADDRGP4 $1538
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $1539
+ADDRLP4 264
+CNSTI4 3
+ASGNI4
+ADDRGP4 $1540
+JUMPV
+LABELV $1539
+ADDRLP4 264
+CNSTI4 1836
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+68
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1540
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1548
+JUMPV
+LABELV $1545
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1550
+ADDRGP4 $1546
+JUMPV
+LABELV $1550
+CNSTI4 1836
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1553
+ADDRGP4 $1546
+JUMPV
+LABELV $1553
+CNSTI4 1836
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+68
+ADDP4
+INDIRI4
+ADDRLP4 264
+INDIRI4
+EQI4 $1556
+ADDRGP4 $1546
+JUMPV
+LABELV $1556
+CNSTI4 1836
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+72
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1560
+ADDRGP4 $1546
+JUMPV
+LABELV $1560
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+EQI4 $1564
+ADDRGP4 $1566
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 528
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 528
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 260
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1565
+JUMPV
+LABELV $1564
+ADDRGP4 $1567
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 528
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 528
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $1565
+LABELV $1546
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1548
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+31488
+INDIRI4
+LTI4 $1545
+ADDRLP4 268
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 528
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 528
+INDIRI4
+CNSTI4 0
+EQI4 $1568
+ADDRGP4 $1535
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1568
+LABELV $1526
+endproc CG_UpdateVoipTeamIDs 532 12
+bss
+align 4
+LABELV numFileExistsCache
+skip 4
+align 4
+LABELV fileExistsHash
+skip 1024
+align 4
+LABELV fileExistsCache
+skip 36864
+align 4
+LABELV numAnimationCache
+skip 4
+align 4
+LABELV animationCache
+skip 39808
+import CG_AddBoundingBox
+import CG_AddBoundingBoxEntity
+import CG_QueryCvar
+import CG_Timestamp
+import CG_LimitCvars
+import trap_RealTime
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import trap_R_inPVS
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_Cutscene2d_Draw
+import CG_Cutscene2d_UpdateTrans
+import CG_Cutscene2d_CheckCmd
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import Main_SpriteParticles
+import LaunchRevivalParticle
+import LaunchSpeedyPuffTrail
+import Init_SpriteParticles
+import AddLFsToScreen
+import AddLFToDrawList
+import Init_LensFlareSys
+import DumpPolyInfo
+import ActiveChooseLogoMenu
+import FindLogoForSpraying
+import Add_LogoToDrawList
+import AddLogosToScene
+import Init_SprayLogoSys
+import Calculate_2DOfDIR
+import Calculate_2DOf3D
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_ChangeLoadingProgress
+import CG_LoadingString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_ScorePlum
+import CG_TeleOutEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_GenerateParticles
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_PortalInView
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_GetWaterMuzzle
+import CG_SprayTrail
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponSRWC
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_Boomies_Explosion
+import CG_BamBam_Explosion
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_LerpTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_Draw3DModel
+import CG_SetPrintString
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import CG_MessagePrint
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_WorldToScreen
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_DrawPic1024
+import CG_DrawRect1024
+import CG_FillRect1024
+import CG_AdjustFrom1024
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddPolyBatched
+import CG_AddRefEntityBatched
+import CG_FlushSceneBatches
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_ForceModelChange
+import CG_GetCvarFloat
+import CG_GetCvarInt
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StreamAssets
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_icons
+import cg_ambient
+import cg_drawBBox
+import cg_drawVoiceNames
+import cg_drawLensflare
+import cg_timestamps
+import cg_skyLensflare
+import cg_sky
+import cg_curWarmupReady
+import cg_warmupReady
+import cg_glowModelTeam
+import cg_glowModel
+import cg_cineDrawLetterBox
+import cg_cineHideHud
+import cg_LPSwallhackAlpha
+import cg_LPSwallhackSize
+import cg_bigScoreType
+import cg_thirdPersonAutoSwitch
+import cg_drawTimeLeft
+import cg_drawServerInfos
+import cg_drawMessages
+import cg_drawups
+import cg_wopFFAhud
+import cg_printDir
+import cg_drawRealTime
+import cg_correctedWeaponPos
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_streamAssets
+import cg_deferPlayers
+import cg_predictItems
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_chatBeep
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_optimizePrediction
+import cg_nopredict
+import cg_errorDecay
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import trailEnt
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $1567
+byte 1 44
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $1566
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $1538
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $1535
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 112
+byte 1 83
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 84
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $1525
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 121
+byte 1 97
+byte 1 119
+byte 1 61
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $1492
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $1483
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 0
+align 1
+LABELV $1432
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $759
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $688
+byte 1 67
+byte 1 108
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 32
+byte 1 108
+byte 1 102
+byte 1 45
+byte 1 62
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $654
+byte 1 65
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $650
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $616
+byte 1 77
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 46
+byte 1 32
+byte 1 32
+byte 1 85
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $552
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $547
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $536
+byte 1 104
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $522
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $511
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $502
+byte 1 116
+byte 1 108
+byte 1 0
+align 1
+LABELV $499
+byte 1 115
+byte 1 108
+byte 1 0
+align 1
+LABELV $497
+byte 1 116
+byte 1 0
+align 1
+LABELV $495
+byte 1 108
+byte 1 0
+align 1
+LABELV $493
+byte 1 119
+byte 1 0
+align 1
+LABELV $491
+byte 1 104
+byte 1 99
+byte 1 0
+align 1
+LABELV $489
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $483
+byte 1 99
+byte 1 50
+byte 1 0
+align 1
+LABELV $481
+byte 1 99
+byte 1 49
+byte 1 0
+align 1
+LABELV $478
+byte 1 110
+byte 1 0
+align 1
+LABELV $473
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $404
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $391
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $386
+byte 1 68
+byte 1 69
+byte 1 70
+byte 1 65
+byte 1 85
+byte 1 76
+byte 1 84
+byte 1 95
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 69
+byte 1 76
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $383
+byte 1 68
+byte 1 69
+byte 1 70
+byte 1 65
+byte 1 85
+byte 1 76
+byte 1 84
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 95
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 69
+byte 1 76
+byte 1 32
+byte 1 47
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $382
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $376
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 40
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 41
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $355
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $352
+byte 1 112
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $351
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $348
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $345
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $344
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $341
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 103
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $336
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $330
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $329
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $319
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $311
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $306
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $305
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $302
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $290
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $287
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $284
+byte 1 84
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $281
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $278
+byte 1 76
+byte 1 101
+byte 1 103
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $275
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $274
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $269
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $263
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $259
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $258
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $255
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $254
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $215
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $182
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $179
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 0
+align 1
+LABELV $176
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $165
+byte 1 115
+byte 1 101
+byte 1 120
+byte 1 0
+align 1
+LABELV $160
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $151
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $146
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $137
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $134
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $133
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $129
+byte 1 110
+byte 1 111
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $128
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $123
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $115
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $109
+byte 1 85
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $94
+byte 1 42
+byte 1 104
+byte 1 101
+byte 1 104
+byte 1 101
+byte 1 50
+byte 1 0
+align 1
+LABELV $93
+byte 1 42
+byte 1 104
+byte 1 101
+byte 1 104
+byte 1 101
+byte 1 49
+byte 1 0
+align 1
+LABELV $92
+byte 1 42
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $91
+byte 1 42
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 49
+byte 1 0
+align 1
+LABELV $90
+byte 1 42
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $89
+byte 1 42
+byte 1 103
+byte 1 97
+byte 1 115
+byte 1 112
+byte 1 0
+align 1
+LABELV $88
+byte 1 42
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 49
+byte 1 0
+align 1
+LABELV $87
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $86
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 55
+byte 1 53
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $85
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 53
+byte 1 48
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $84
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 50
+byte 1 53
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $83
+byte 1 42
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 49
+byte 1 0
+align 1
+LABELV $82
+byte 1 42
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 51
+byte 1 0
+align 1
+LABELV $81
+byte 1 42
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 50
+byte 1 0
+align 1
+LABELV $80
+byte 1 42
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 49
+byte 1 0
@@ -0,0 +1,2773 @@
+export CG_CheckAmmo
+code
+proc CG_CheckAmmo 20 8
+ADDRLP4 8
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+LABELV $82
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $86
+ADDRGP4 $83
+JUMPV
+LABELV $86
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $88
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+GTI4 $88
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $93-12
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $93
+address $90
+address $90
+address $90
+address $88
+address $90
+code
+LABELV $90
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1000
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+ADDRGP4 $89
+JUMPV
+LABELV $88
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 200
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+LABELV $89
+ADDRLP4 4
+INDIRI4
+CNSTI4 5000
+LTI4 $95
+ADDRGP4 cg+131544
+CNSTI4 0
+ASGNI4
+ADDRGP4 $80
+JUMPV
+LABELV $95
+LABELV $83
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+LTI4 $82
+ADDRLP4 12
+ADDRGP4 cg+131544
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $99
+ADDRGP4 cg+131544
+CNSTI4 2
+ASGNI4
+ADDRGP4 $100
+JUMPV
+LABELV $99
+ADDRGP4 cg+131544
+CNSTI4 1
+ASGNI4
+LABELV $100
+ADDRGP4 cg+131544
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $103
+ADDRGP4 cgs+160652+1348
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $103
+LABELV $80
+endproc CG_CheckAmmo 20 8
+export CG_DamageFeedback
+proc CG_DamageFeedback 84 16
+ADDRGP4 cg+131564
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 40
+GEI4 $112
+ADDRLP4 28
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $113
+JUMPV
+LABELV $112
+ADDRLP4 28
+CNSTF4 1109393408
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+LABELV $113
+ADDRLP4 12
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 1084227584
+GEF4 $114
+ADDRLP4 12
+CNSTF4 1084227584
+ASGNF4
+LABELV $114
+ADDRLP4 12
+INDIRF4
+CNSTF4 1092616192
+LEF4 $116
+ADDRLP4 12
+CNSTF4 1092616192
+ASGNF4
+LABELV $116
+ADDRLP4 60
+CNSTI4 255
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $118
+ADDRFP4 4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $118
+ADDRGP4 cg+131828
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+131832
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+131876
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+131872
+ADDRLP4 12
+INDIRF4
+NEGF4
+ASGNF4
+ADDRGP4 $119
+JUMPV
+LABELV $118
+ADDRLP4 64
+CNSTF4 1135869952
+ASGNF4
+ADDRLP4 68
+CNSTF4 1132396544
+ASGNF4
+ADDRLP4 56
+ADDRLP4 64
+INDIRF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 68
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 64
+INDIRF4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 68
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 32+4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 32+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 32
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 72
+CNSTP4 0
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 vec3_origin
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRGP4 vec3_origin+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRGP4 vec3_origin+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 76
+INDIRF4
+ADDRGP4 cg+110648+36
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 cg+110648+36+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 cg+110648+36+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 76
+INDIRF4
+ADDRGP4 cg+110648+36+12
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 cg+110648+36+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 cg+110648+36+12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 76
+INDIRF4
+ADDRGP4 cg+110648+36+24
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 cg+110648+36+24+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 cg+110648+36+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 80
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRLP4 44
+INDIRF4
+CNSTF4 1036831949
+GEF4 $170
+ADDRLP4 44
+CNSTF4 1036831949
+ASGNF4
+LABELV $170
+ADDRGP4 cg+131876
+ADDRLP4 12
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+131872
+ADDRLP4 12
+INDIRF4
+NEGF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1036831949
+GTF4 $174
+ADDRLP4 16
+CNSTF4 1036831949
+ASGNF4
+LABELV $174
+ADDRGP4 cg+131828
+ADDRLP4 24
+INDIRF4
+NEGF4
+ADDRLP4 16
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 cg+131832
+ADDRLP4 48
+INDIRF4
+ADDRLP4 44
+INDIRF4
+DIVF4
+ASGNF4
+LABELV $119
+ADDRGP4 cg+131828
+INDIRF4
+CNSTF4 1065353216
+LEF4 $178
+ADDRGP4 cg+131828
+CNSTF4 1065353216
+ASGNF4
+LABELV $178
+ADDRGP4 cg+131828
+INDIRF4
+CNSTF4 3212836864
+GEF4 $182
+ADDRGP4 cg+131828
+CNSTF4 3212836864
+ASGNF4
+LABELV $182
+ADDRGP4 cg+131832
+INDIRF4
+CNSTF4 1065353216
+LEF4 $186
+ADDRGP4 cg+131832
+CNSTF4 1065353216
+ASGNF4
+LABELV $186
+ADDRGP4 cg+131832
+INDIRF4
+CNSTF4 3212836864
+GEF4 $190
+ADDRGP4 cg+131832
+CNSTF4 3212836864
+ASGNF4
+LABELV $190
+ADDRLP4 12
+INDIRF4
+CNSTF4 1092616192
+LEF4 $194
+ADDRLP4 12
+CNSTF4 1092616192
+ASGNF4
+LABELV $194
+ADDRGP4 cg+131836
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 cg+131868
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 500
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRGP4 cg+131824
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $108
+endproc CG_DamageFeedback 84 16
+export CG_Respawn
+proc CG_Respawn 0 0
+ADDRGP4 cg+107600
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+131812
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRGP4 cg+110500
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $201
+endproc CG_Respawn 0 0
+export CG_CheckPlayerstateEvents
+proc CG_CheckPlayerstateEvents 52 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 128
+ASGNI4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $208
+ADDRLP4 16
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $208
+ADDRLP4 4
+CNSTI4 808
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 732
+ADDP4
+ARGP4
+ADDRGP4 CG_EntityEvent
+CALLV
+pop
+LABELV $208
+ADDRLP4 4
+ADDRGP4 cg+109072
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRGP4 $214
+JUMPV
+LABELV $211
+ADDRLP4 28
+ADDRFP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+GEI4 $217
+ADDRLP4 32
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 32
+INDIRI4
+SUBI4
+LEI4 $215
+ADDRLP4 36
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 32
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 40
+CNSTI4 112
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+EQI4 $215
+LABELV $217
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 732
+ADDP4
+ARGP4
+ADDRGP4 CG_EntityEvent
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+110412
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 48
+ADDRGP4 cg+110408
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $215
+LABELV $212
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $214
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+LTI4 $211
+LABELV $207
+endproc CG_CheckPlayerstateEvents 52 8
+export CG_CheckChangedPredictableEvents
+proc CG_CheckChangedPredictableEvents 24 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 cg+109072
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRGP4 $225
+JUMPV
+LABELV $222
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+110408
+INDIRI4
+LTI4 $226
+ADDRGP4 $223
+JUMPV
+LABELV $226
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+110408
+INDIRI4
+CNSTI4 16
+SUBI4
+LEI4 $229
+ADDRLP4 16
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+BANDI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 cg+110412
+ADDP4
+INDIRI4
+EQI4 $232
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 732
+ADDP4
+ARGP4
+ADDRGP4 CG_EntityEvent
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+110412
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $236
+ADDRGP4 $239
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $236
+LABELV $232
+LABELV $229
+LABELV $223
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $225
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+LTI4 $222
+LABELV $220
+endproc CG_CheckChangedPredictableEvents 24 8
+proc pushReward 4 0
+ADDRGP4 cg+131572
+INDIRI4
+CNSTI4 9
+GEI4 $241
+ADDRLP4 0
+ADDRGP4 cg+131572
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 cg+131572
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+131660
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+131572
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+131620
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+131572
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+131580
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+LABELV $241
+LABELV $240
+endproc pushReward 4 0
+export CG_CheckLocalSounds
+proc CG_CheckLocalSounds 76 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTI4 252
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $252
+ADDRGP4 $251
+JUMPV
+LABELV $252
+ADDRLP4 16
+CNSTI4 256
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+LEI4 $254
+ADDRGP4 cgs+160652+1540
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $255
+JUMPV
+LABELV $254
+ADDRLP4 20
+CNSTI4 256
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+GEI4 $258
+ADDRGP4 cgs+160652+1552
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $258
+LABELV $255
+ADDRLP4 24
+CNSTI4 184
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $262
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $264
+ADDRGP4 cg+109072
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_PainEvent
+CALLV
+pop
+LABELV $264
+LABELV $262
+ADDRGP4 cg+32
+INDIRI4
+CNSTI4 0
+EQI4 $267
+ADDRGP4 $251
+JUMPV
+LABELV $267
+ADDRLP4 28
+CNSTI4 288
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $270
+ADDRLP4 0
+ADDRGP4 cgs+160652+1560
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgs+160652+1012
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 288
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 pushReward
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $270
+ADDRLP4 32
+CNSTI4 308
+ASGNI4
+ADDRLP4 36
+CNSTI4 65280
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+BANDI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+BANDI4
+EQI4 $276
+ADDRLP4 0
+ADDRGP4 cgs+160652+1580
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgs+160652+1020
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRI4
+CNSTI4 8
+RSHI4
+ARGI4
+ADDRGP4 pushReward
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $276
+ADDRLP4 40
+CNSTI4 308
+ASGNI4
+ADDRLP4 44
+CNSTI4 255
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+BANDI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+BANDI4
+EQI4 $282
+ADDRLP4 0
+ADDRGP4 cgs+160652+1584
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgs+160652+1024
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRI4
+CNSTI4 255
+BANDI4
+ARGI4
+ADDRGP4 pushReward
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $282
+ADDRLP4 48
+CNSTI4 304
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $288
+ADDRLP4 0
+ADDRGP4 cgs+160652+1588
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgs+160652+1028
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 pushReward
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $288
+ADDRLP4 52
+CNSTI4 300
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $294
+ADDRLP4 0
+ADDRGP4 cgs+160652+1564
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgs+160652+1016
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 300
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 pushReward
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $294
+ADDRLP4 56
+CNSTI4 268
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $300
+ADDRLP4 60
+CNSTI4 268
+ASGNI4
+ADDRLP4 64
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+BANDI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+BANDI4
+EQI4 $302
+ADDRGP4 cgs+160652+1564
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $302
+LABELV $300
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 5
+LTI4 $306
+ADDRLP4 60
+CNSTI4 344
+ASGNI4
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $312
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $311
+LABELV $312
+ADDRLP4 68
+CNSTI4 348
+ASGNI4
+ADDRLP4 72
+ADDRFP4 0
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $309
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $309
+LABELV $311
+LABELV $309
+LABELV $306
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $313
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+131792
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $315
+ADDRGP4 cg_cineHideHud+12
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $315
+ADDRLP4 64
+CNSTI4 260
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $319
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 5
+GEI4 $321
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $324
+ADDRGP4 cgs+160652+1592
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $325
+JUMPV
+LABELV $324
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 16384
+NEI4 $328
+ADDRGP4 cgs+160652+1596
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $329
+JUMPV
+LABELV $328
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 -16385
+BANDI4
+CNSTI4 0
+NEI4 $332
+ADDRGP4 cgs+160652+1600
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+LABELV $332
+LABELV $329
+LABELV $325
+LABELV $321
+LABELV $319
+LABELV $315
+LABELV $313
+ADDRGP4 cgs+31484
+INDIRI4
+CNSTI4 0
+LEI4 $336
+ADDRLP4 60
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 cgs+34908
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $341
+ADDRLP4 60
+INDIRI4
+CNSTI4 1000
+CNSTI4 60
+ADDRGP4 cgs+31484
+INDIRI4
+MULI4
+MULI4
+CNSTI4 2000
+ADDI4
+LEI4 $341
+ADDRLP4 64
+ADDRGP4 cg+107628
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRI4
+CNSTI4 7
+BORI4
+ASGNI4
+ADDRGP4 cgs+160652+1524
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $342
+JUMPV
+LABELV $341
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+131792
+INDIRI4
+ADDRLP4 64
+INDIRI4
+NEI4 $348
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 64
+INDIRI4
+NEI4 $348
+ADDRLP4 68
+CNSTI4 1000
+ASGNI4
+ADDRLP4 60
+INDIRI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 60
+ADDRGP4 cgs+31484
+INDIRI4
+MULI4
+MULI4
+ADDRLP4 68
+INDIRI4
+SUBI4
+LEI4 $348
+ADDRLP4 72
+ADDRGP4 cg+107628
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRI4
+CNSTI4 11
+BORI4
+ASGNI4
+ADDRGP4 cgs+160652+1424
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $349
+JUMPV
+LABELV $348
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $356
+ADDRLP4 60
+INDIRI4
+CNSTI4 1000
+CNSTI4 60
+ADDRGP4 cgs+31484
+INDIRI4
+MULI4
+MULI4
+CNSTI4 60000
+SUBI4
+LEI4 $356
+ADDRLP4 72
+ADDRGP4 cg+107628
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRI4
+CNSTI4 3
+BORI4
+ASGNI4
+ADDRGP4 cgs+160652+1428
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $357
+JUMPV
+LABELV $356
+ADDRGP4 cgs+31484
+INDIRI4
+CNSTI4 5
+LEI4 $363
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $363
+ADDRLP4 60
+INDIRI4
+CNSTI4 1000
+CNSTI4 60
+ADDRGP4 cgs+31484
+INDIRI4
+MULI4
+MULI4
+CNSTI4 300000
+SUBI4
+LEI4 $363
+ADDRLP4 72
+ADDRGP4 cg+107628
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRGP4 cgs+160652+1420
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $363
+LABELV $357
+LABELV $349
+LABELV $342
+LABELV $336
+ADDRGP4 cgs+31476
+INDIRI4
+CNSTI4 0
+LEI4 $371
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 6
+GEI4 $371
+ADDRLP4 8
+ADDRGP4 cgs+34912
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 3
+NEI4 $376
+ADDRGP4 cg+107632
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $379
+ADDRLP4 8
+INDIRI4
+CNSTI4 5
+ADDI4
+ADDRGP4 cgs+31476
+INDIRI4
+LTI4 $379
+ADDRLP4 60
+ADDRGP4 cg+107632
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+CNSTI4 7
+BORI4
+ASGNI4
+ADDRGP4 cgs+160652+1480
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $251
+JUMPV
+LABELV $379
+ADDRLP4 60
+CNSTI4 2
+ASGNI4
+ADDRGP4 cgs+31476
+INDIRI4
+ADDRLP4 60
+INDIRI4
+LEI4 $386
+ADDRGP4 cg+107632
+INDIRI4
+ADDRLP4 60
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $386
+ADDRLP4 8
+INDIRI4
+CNSTI4 10
+ADDI4
+ADDRGP4 cgs+31476
+INDIRI4
+LTI4 $386
+ADDRLP4 64
+ADDRGP4 cg+107632
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRI4
+CNSTI4 3
+BORI4
+ASGNI4
+ADDRGP4 cgs+160652+1484
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $251
+JUMPV
+LABELV $386
+ADDRGP4 cgs+31476
+INDIRI4
+CNSTI4 3
+LEI4 $251
+ADDRGP4 cg+107632
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $251
+ADDRLP4 8
+INDIRI4
+CNSTI4 15
+ADDI4
+ADDRGP4 cgs+31476
+INDIRI4
+LTI4 $251
+ADDRLP4 64
+ADDRGP4 cg+107632
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRGP4 cgs+160652+1488
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $251
+JUMPV
+LABELV $376
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 4
+NEI4 $402
+ADDRGP4 cgs+31780
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $402
+ADDRGP4 $251
+JUMPV
+LABELV $402
+ADDRGP4 cg+107632
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $406
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cgs+31476
+INDIRI4
+CNSTI4 1
+SUBI4
+NEI4 $406
+ADDRLP4 60
+ADDRGP4 cg+107632
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+CNSTI4 7
+BORI4
+ASGNI4
+ADDRGP4 cgs+160652+1536
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $407
+JUMPV
+LABELV $406
+ADDRLP4 60
+CNSTI4 2
+ASGNI4
+ADDRGP4 cgs+31476
+INDIRI4
+ADDRLP4 60
+INDIRI4
+LEI4 $413
+ADDRGP4 cg+107632
+INDIRI4
+ADDRLP4 60
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $413
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cgs+31476
+INDIRI4
+ADDRLP4 60
+INDIRI4
+SUBI4
+NEI4 $413
+ADDRLP4 64
+ADDRGP4 cg+107632
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRI4
+CNSTI4 3
+BORI4
+ASGNI4
+ADDRGP4 cgs+160652+1532
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $414
+JUMPV
+LABELV $413
+ADDRLP4 64
+CNSTI4 3
+ASGNI4
+ADDRGP4 cgs+31476
+INDIRI4
+ADDRLP4 64
+INDIRI4
+LEI4 $421
+ADDRGP4 cg+107632
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $421
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cgs+31476
+INDIRI4
+ADDRLP4 64
+INDIRI4
+SUBI4
+NEI4 $421
+ADDRLP4 68
+ADDRGP4 cg+107632
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRGP4 cgs+160652+1528
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+LABELV $421
+LABELV $414
+LABELV $407
+LABELV $371
+LABELV $251
+endproc CG_CheckLocalSounds 76 12
+export CG_TransitionPlayerState
+proc CG_TransitionPlayerState 24 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 140
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $430
+ADDRGP4 cg+107600
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 468
+LABELV $430
+ADDRLP4 8
+CNSTI4 168
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $433
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $433
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DamageFeedback
+CALLV
+pop
+LABELV $433
+ADDRLP4 12
+CNSTI4 264
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $435
+ADDRGP4 CG_Respawn
+CALLV
+pop
+LABELV $435
+ADDRGP4 cg+108592
+INDIRI4
+CNSTI4 0
+EQI4 $437
+ADDRGP4 CG_Respawn
+CALLV
+pop
+ADDRGP4 cg+108592
+CNSTI4 0
+ASGNI4
+LABELV $437
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $441
+ADDRFP4 0
+INDIRP4
+CNSTI4 252
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $441
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CheckLocalSounds
+CALLV
+pop
+LABELV $441
+ADDRGP4 CG_CheckAmmo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CheckPlayerstateEvents
+CALLV
+pop
+ADDRLP4 16
+CNSTI4 164
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $444
+ADDRLP4 20
+CNSTI4 164
+ASGNI4
+ADDRGP4 cg+110484
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRGP4 cg+110488
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+LABELV $444
+LABELV $429
+endproc CG_TransitionPlayerState 24 12
+import eventnames
+import CG_AddBoundingBox
+import CG_AddBoundingBoxEntity
+import CG_QueryCvar
+import CG_Timestamp
+import CG_LimitCvars
+import trap_RealTime
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import trap_R_inPVS
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_Cutscene2d_Draw
+import CG_Cutscene2d_UpdateTrans
+import CG_Cutscene2d_CheckCmd
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import Main_SpriteParticles
+import LaunchRevivalParticle
+import LaunchSpeedyPuffTrail
+import Init_SpriteParticles
+import AddLFsToScreen
+import AddLFToDrawList
+import Init_LensFlareSys
+import DumpPolyInfo
+import ActiveChooseLogoMenu
+import FindLogoForSpraying
+import Add_LogoToDrawList
+import AddLogosToScene
+import Init_SprayLogoSys
+import Calculate_2DOfDIR
+import Calculate_2DOf3D
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_ChangeLoadingProgress
+import CG_LoadingString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_ScorePlum
+import CG_TeleOutEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_GenerateParticles
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_PortalInView
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_GetWaterMuzzle
+import CG_SprayTrail
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponSRWC
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_Boomies_Explosion
+import CG_BamBam_Explosion
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_LerpTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayer
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_UpdateVoipTeamIDs
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Draw3DModel
+import CG_SetPrintString
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import CG_MessagePrint
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_WorldToScreen
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_DrawPic1024
+import CG_DrawRect1024
+import CG_FillRect1024
+import CG_AdjustFrom1024
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddPolyBatched
+import CG_AddRefEntityBatched
+import CG_FlushSceneBatches
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_ForceModelChange
+import CG_GetCvarFloat
+import CG_GetCvarInt
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StreamAssets
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_icons
+import cg_ambient
+import cg_drawBBox
+import cg_drawVoiceNames
+import cg_drawLensflare
+import cg_timestamps
+import cg_skyLensflare
+import cg_sky
+import cg_curWarmupReady
+import cg_warmupReady
+import cg_glowModelTeam
+import cg_glowModel
+import cg_cineDrawLetterBox
+import cg_cineHideHud
+import cg_LPSwallhackAlpha
+import cg_LPSwallhackSize
+import cg_bigScoreType
+import cg_thirdPersonAutoSwitch
+import cg_drawTimeLeft
+import cg_drawServerInfos
+import cg_drawMessages
+import cg_drawups
+import cg_wopFFAhud
+import cg_printDir
+import cg_drawRealTime
+import cg_correctedWeaponPos
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_streamAssets
+import cg_deferPlayers
+import cg_predictItems
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_chatBeep
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_optimizePrediction
+import cg_nopredict
+import cg_errorDecay
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import trailEnt
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $239
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 0
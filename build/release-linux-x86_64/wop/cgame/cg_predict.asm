@@ -0,0 +1,5182 @@
+export CG_BuildSolidList
+code
+proc CG_BuildSolidList 32 0
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_numSolidEntities
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 cg_numTriggerEntities
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $81
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $81
+ADDRGP4 cg+107600
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $81
+ADDRLP4 12
+ADDRGP4 cg+48
+INDIRP4
+ASGNP4
+ADDRGP4 $82
+JUMPV
+LABELV $81
+ADDRLP4 12
+ADDRGP4 cg+44
+INDIRP4
+ASGNP4
+LABELV $82
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $91
+JUMPV
+LABELV $88
+ADDRLP4 0
+CNSTI4 808
+CNSTI4 208
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 516
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+EQI4 $95
+ADDRLP4 24
+INDIRI4
+CNSTI4 8
+EQI4 $95
+ADDRLP4 24
+INDIRI4
+CNSTI4 9
+NEI4 $92
+LABELV $95
+ADDRGP4 cg_numTriggerEntities
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_triggerEntities
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRGP4 cg_numTriggerEntities
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $89
+JUMPV
+LABELV $92
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $96
+ADDRGP4 cg_numSolidEntities
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_solidEntities
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRGP4 cg_numSolidEntities
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $96
+LABELV $89
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $91
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 512
+ADDP4
+INDIRI4
+LTI4 $88
+LABELV $80
+endproc CG_BuildSolidList 32 0
+proc CG_SolidGridRange 28 0
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRGP4 cg_solidGridCell
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ADDRGP4 cg_solidGridOrigin
+INDIRF4
+SUBF4
+ADDRLP4 24
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 cg_solidGridOrigin+4
+INDIRF4
+SUBF4
+ADDRLP4 24
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 cg_solidGridOrigin
+INDIRF4
+SUBF4
+ADDRGP4 cg_solidGridCell
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 4+12
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 cg_solidGridOrigin+4
+INDIRF4
+SUBF4
+ADDRGP4 cg_solidGridCell
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $105
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $109
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $110
+JUMPV
+LABELV $109
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1097859072
+LEF4 $111
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1097859072
+ASGNF4
+LABELV $111
+LABELV $110
+LABELV $106
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $105
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 4+4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 4+8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 20
+INDIRP4
+ADDRLP4 4+12
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $99
+endproc CG_SolidGridRange 28 0
+proc CG_BuildSolidGrid 84 24
+ADDRGP4 cg_solidGridValid
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_numSolidEntities
+INDIRI4
+ADDRGP4 cg_numSolidBModels
+INDIRI4
+SUBI4
+CNSTI4 16
+GEI4 $117
+ADDRGP4 $116
+JUMPV
+LABELV $117
+ADDRLP4 56
+CNSTF4 1232348144
+ASGNF4
+ADDRLP4 28+4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 60
+CNSTF4 3379831792
+ASGNF4
+ADDRLP4 36+4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $124
+JUMPV
+LABELV $121
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_solidEntities
+ADDP4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 16777215
+NEI4 $125
+ADDRGP4 $122
+JUMPV
+LABELV $125
+ADDRLP4 16
+CNSTI4 60
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg_solidBounds
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $127
+ADDRLP4 64
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 16
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 28
+ADDP4
+INDIRF4
+GEF4 $131
+ADDRLP4 68
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+ADDRLP4 28
+ADDP4
+ADDRLP4 68
+INDIRI4
+ADDRLP4 16
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $131
+ADDRLP4 68
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 68
+INDIRI4
+ADDRLP4 36
+ADDP4
+INDIRF4
+LEF4 $133
+ADDRLP4 72
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ADDRLP4 36
+ADDP4
+ADDRLP4 72
+INDIRI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $133
+LABELV $128
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $127
+LABELV $122
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $124
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cg_numSolidEntities
+INDIRI4
+LTI4 $121
+ADDRLP4 52
+ADDRLP4 36
+INDIRF4
+ADDRLP4 28
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36+4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+SUBF4
+ADDRLP4 52
+INDIRF4
+LEF4 $135
+ADDRLP4 52
+ADDRLP4 36+4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $135
+ADDRLP4 64
+ADDRGP4 cg_solidGridCell
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 52
+INDIRF4
+CNSTF4 1098907648
+DIVF4
+ASGNF4
+ADDRLP4 64
+INDIRP4
+INDIRF4
+CNSTF4 1132462080
+GEF4 $141
+ADDRGP4 cg_solidGridCell
+CNSTF4 1132462080
+ASGNF4
+LABELV $141
+ADDRGP4 cg_solidGridOrigin
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRGP4 cg_solidGridOrigin+4
+ADDRLP4 28+4
+INDIRF4
+ASGNF4
+ADDRGP4 cg_solidGridStart
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1028
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRLP4 48
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRGP4 $148
+JUMPV
+LABELV $145
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_solidEntities
+ADDP4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 16777215
+NEI4 $149
+ADDRGP4 $146
+JUMPV
+LABELV $149
+ADDRLP4 16
+CNSTI4 60
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg_solidBounds
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 CG_SolidGridRange
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 $154
+JUMPV
+LABELV $151
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $158
+JUMPV
+LABELV $155
+ADDRLP4 76
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_solidGridStart+4
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $156
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $158
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LEI4 $155
+LABELV $152
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $154
+ADDRLP4 4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LEI4 $151
+ADDRLP4 76
+CNSTI4 1
+ASGNI4
+ADDRLP4 48
+ADDRLP4 48
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ADDRLP4 76
+INDIRI4
+ADDI4
+ADDRLP4 24
+INDIRI4
+ADDRLP4 44
+INDIRI4
+SUBI4
+ADDRLP4 76
+INDIRI4
+ADDI4
+MULI4
+ADDI4
+ASGNI4
+LABELV $146
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $148
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cg_numSolidEntities
+INDIRI4
+LTI4 $145
+ADDRLP4 48
+INDIRI4
+CNSTI4 4096
+LEI4 $160
+ADDRGP4 $116
+JUMPV
+LABELV $160
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $162
+ADDRLP4 72
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 76
+ADDRLP4 72
+INDIRI4
+ADDRGP4 cg_solidGridStart+4
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+ADDRGP4 cg_solidGridStart
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $163
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 256
+LTI4 $162
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $170
+JUMPV
+LABELV $167
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_solidEntities
+ADDP4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 16777215
+NEI4 $171
+ADDRGP4 $168
+JUMPV
+LABELV $171
+ADDRLP4 16
+CNSTI4 60
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg_solidBounds
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 CG_SolidGridRange
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 $176
+JUMPV
+LABELV $173
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $180
+JUMPV
+LABELV $177
+ADDRLP4 80
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_solidGridStart
+ADDP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 80
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_solidGridEntries
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $178
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $180
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LEI4 $177
+LABELV $174
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $176
+ADDRLP4 4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LEI4 $173
+LABELV $168
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $170
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cg_numSolidEntities
+INDIRI4
+LTI4 $167
+ADDRLP4 12
+CNSTI4 256
+ASGNI4
+LABELV $181
+ADDRLP4 72
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ADDRGP4 cg_solidGridStart
+ADDP4
+ADDRLP4 72
+INDIRI4
+ADDRGP4 cg_solidGridStart-4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $182
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+GTI4 $181
+ADDRGP4 cg_solidGridStart
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_solidGridValid
+CNSTI4 1
+ASGNI4
+LABELV $116
+endproc CG_BuildSolidGrid 84 24
+proc CG_BeginSolidIndex 88 0
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_numSolidBModels
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $190
+JUMPV
+LABELV $187
+ADDRLP4 16
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_solidEntities
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 16777215
+NEI4 $191
+ADDRLP4 36
+ADDRGP4 cg_numSolidBModels
+ASGNP4
+ADDRLP4 32
+ADDRLP4 36
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_solidBModels
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $188
+JUMPV
+LABELV $191
+ADDRLP4 0
+CNSTI4 60
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg_solidBounds
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 8
+INDIRP4
+CNSTI4 176
+ADDP4
+ASGNP4
+ADDRLP4 36
+CNSTI4 255
+ASGNI4
+ADDRLP4 4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+BANDI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 8
+RSHI4
+ADDRLP4 36
+INDIRI4
+BANDI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 16
+RSHI4
+ADDRLP4 36
+INDIRI4
+BANDI4
+CNSTI4 32
+SUBI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 4
+INDIRI4
+NEGI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 20
+INDIRI4
+NEGI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $193
+ADDRLP4 80
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+ADDRLP4 84
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+LABELV $194
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $193
+LABELV $188
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $190
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cg_numSolidEntities
+INDIRI4
+LTI4 $187
+ADDRGP4 CG_BuildSolidGrid
+CALLV
+pop
+ADDRGP4 cg_solidIndexValid
+CNSTI4 1
+ASGNI4
+LABELV $186
+endproc CG_BeginSolidIndex 88 0
+proc CG_EndSolidIndex 0 0
+ADDRGP4 cg_solidIndexValid
+CNSTI4 0
+ASGNI4
+LABELV $197
+endproc CG_EndSolidIndex 0 0
+proc CG_SolidCandidates 88 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $199
+ADDRLP4 68
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 68
+INDIRI4
+ADDRFP4 12
+INDIRP4
+ADDP4
+INDIRF4
+GEF4 $203
+ADDRLP4 72
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 72
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 72
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 24
+ADDP4
+ADDRLP4 76
+INDIRI4
+ADDRFP4 12
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 76
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $204
+JUMPV
+LABELV $203
+ADDRLP4 72
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 72
+INDIRI4
+ADDRFP4 12
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 72
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 24
+ADDP4
+ADDRLP4 76
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 76
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $204
+LABELV $200
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $199
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRGP4 $208
+JUMPV
+LABELV $205
+ADDRLP4 72
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 72
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 76
+CNSTI4 2
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LSHI4
+ADDRFP4 16
+INDIRP4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LSHI4
+ADDRGP4 cg_solidBModels
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $206
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $208
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg_numSolidBModels
+INDIRI4
+LTI4 $205
+ADDRGP4 cg_solidGridValid
+INDIRI4
+CNSTI4 0
+NEI4 $209
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $214
+JUMPV
+LABELV $211
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_solidEntities
+ADDP4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 16777215
+NEI4 $215
+ADDRGP4 $212
+JUMPV
+LABELV $215
+ADDRLP4 0
+CNSTI4 60
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg_solidBounds
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+GTF4 $227
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+GTF4 $227
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+GTF4 $227
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+LTF4 $227
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+LTF4 $227
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+GEF4 $217
+LABELV $227
+ADDRGP4 $212
+JUMPV
+LABELV $217
+ADDRLP4 76
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 16
+INDIRP4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $212
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $214
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg_numSolidEntities
+INDIRI4
+LTI4 $211
+ADDRGP4 $210
+JUMPV
+LABELV $209
+ADDRLP4 72
+ADDRGP4 cg_solidStamp
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 60
+ARGP4
+ADDRGP4 CG_SolidGridRange
+CALLV
+pop
+ADDRLP4 40
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRGP4 $231
+JUMPV
+LABELV $228
+ADDRLP4 36
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 $235
+JUMPV
+LABELV $232
+ADDRLP4 8
+ADDRLP4 40
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRLP4 36
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_solidGridStart
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $239
+JUMPV
+LABELV $236
+ADDRLP4 76
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LSHI4
+ADDRGP4 cg_solidGridEntries
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LSHI4
+ADDRGP4 cg_solidStamps
+ADDP4
+INDIRI4
+ADDRGP4 cg_solidStamp
+INDIRI4
+NEI4 $241
+ADDRGP4 $237
+JUMPV
+LABELV $241
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_solidStamps
+ADDP4
+ADDRGP4 cg_solidStamp
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 60
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg_solidBounds
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+GTF4 $253
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+GTF4 $253
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+GTF4 $253
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+LTF4 $253
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+LTF4 $253
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+GEF4 $243
+LABELV $253
+ADDRGP4 $237
+JUMPV
+LABELV $243
+ADDRLP4 84
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 84
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 16
+INDIRP4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $237
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $239
+ADDRLP4 8
+INDIRI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRLP4 36
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_solidGridStart+4
+ADDP4
+INDIRI4
+LTI4 $236
+LABELV $233
+ADDRLP4 36
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $235
+ADDRLP4 36
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LEI4 $232
+LABELV $229
+ADDRLP4 40
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $231
+ADDRLP4 40
+INDIRI4
+ADDRLP4 60
+INDIRI4
+LEI4 $228
+LABELV $210
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $257
+JUMPV
+LABELV $254
+ADDRLP4 48
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 16
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $261
+JUMPV
+LABELV $258
+ADDRLP4 76
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 4
+ADDI4
+ADDRFP4 16
+INDIRP4
+ADDP4
+ADDRLP4 76
+INDIRI4
+ADDRFP4 16
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $259
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $261
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $262
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 16
+INDIRP4
+ADDP4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+GTI4 $258
+LABELV $262
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 4
+ADDI4
+ADDRFP4 16
+INDIRP4
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+LABELV $255
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $257
+ADDRLP4 4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LTI4 $254
+ADDRLP4 44
+INDIRI4
+RETI4
+LABELV $198
+endproc CG_SolidCandidates 88 24
+proc CG_ClipMoveToEntities 1184 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 24
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 cg_solidIndexValid
+INDIRI4
+CNSTI4 0
+EQI4 $264
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRLP4 1164
+ADDRGP4 CG_SolidCandidates
+CALLI4
+ASGNI4
+ADDRLP4 1092
+ADDRLP4 1164
+INDIRI4
+ASGNI4
+ADDRGP4 $265
+JUMPV
+LABELV $264
+ADDRLP4 1092
+ADDRGP4 cg_numSolidEntities
+INDIRI4
+ASGNI4
+LABELV $265
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRGP4 $269
+JUMPV
+LABELV $266
+ADDRGP4 cg_solidIndexValid
+INDIRI4
+CNSTI4 0
+EQI4 $271
+ADDRLP4 1164
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $272
+JUMPV
+LABELV $271
+ADDRLP4 1164
+ADDRLP4 60
+INDIRI4
+ASGNI4
+LABELV $272
+ADDRLP4 64
+ADDRLP4 1164
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_solidEntities
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 64
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 16
+INDIRI4
+NEI4 $273
+ADDRGP4 $267
+JUMPV
+LABELV $273
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 16777215
+EQI4 $275
+ADDRFP4 20
+INDIRI4
+CNSTI4 33554432
+BANDI4
+CNSTI4 0
+NEI4 $275
+ADDRGP4 $267
+JUMPV
+LABELV $275
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 16777215
+NEI4 $277
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1168
+ADDRGP4 trap_CM_InlineModel
+CALLI4
+ASGNI4
+ADDRLP4 1096
+ADDRLP4 1168
+INDIRI4
+ASGNI4
+ADDRLP4 1136
+ADDRLP4 64
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 64
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+107624
+INDIRI4
+ARGI4
+ADDRLP4 1124
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1096
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRLP4 1124
+ARGP4
+ADDRLP4 1136
+ARGP4
+ADDRGP4 trap_CM_TransformedBoxTrace
+CALLV
+pop
+ADDRGP4 $278
+JUMPV
+LABELV $277
+ADDRGP4 cg_solidIndexValid
+INDIRI4
+CNSTI4 0
+EQI4 $280
+ADDRLP4 1148
+CNSTI4 60
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_solidBounds
+ADDP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1148
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRLP4 1148
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRLP4 1148
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 BoxTraceBox
+CALLV
+pop
+ADDRGP4 $281
+JUMPV
+LABELV $280
+ADDRLP4 1168
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+ASGNP4
+ADDRLP4 1172
+CNSTI4 255
+ASGNI4
+ADDRLP4 1152
+ADDRLP4 1168
+INDIRP4
+INDIRI4
+ADDRLP4 1172
+INDIRI4
+BANDI4
+ASGNI4
+ADDRLP4 1156
+ADDRLP4 1168
+INDIRP4
+INDIRI4
+CNSTI4 8
+RSHI4
+ADDRLP4 1172
+INDIRI4
+BANDI4
+ASGNI4
+ADDRLP4 1160
+ADDRLP4 1168
+INDIRP4
+INDIRI4
+CNSTI4 16
+RSHI4
+ADDRLP4 1172
+INDIRI4
+BANDI4
+CNSTI4 32
+SUBI4
+ASGNI4
+ADDRLP4 1176
+ADDRLP4 1152
+INDIRI4
+NEGI4
+CVIF4 4
+ASGNF4
+ADDRLP4 1100+4
+ADDRLP4 1176
+INDIRF4
+ASGNF4
+ADDRLP4 1100
+ADDRLP4 1176
+INDIRF4
+ASGNF4
+ADDRLP4 1180
+ADDRLP4 1152
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 1112+4
+ADDRLP4 1180
+INDIRF4
+ASGNF4
+ADDRLP4 1112
+ADDRLP4 1180
+INDIRF4
+ASGNF4
+ADDRLP4 1100+8
+ADDRLP4 1156
+INDIRI4
+NEGI4
+CVIF4 4
+ASGNF4
+ADDRLP4 1112+8
+ADDRLP4 1160
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1100
+ARGP4
+ADDRLP4 1112
+ARGP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 732
+ADDP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 BoxTraceBox
+CALLV
+pop
+LABELV $281
+LABELV $278
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $289
+ADDRLP4 4+8
+INDIRF4
+ADDRFP4 24
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+GEF4 $286
+LABELV $289
+ADDRLP4 4+52
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 24
+INDIRP4
+ADDRLP4 4
+INDIRB
+ASGNB 56
+ADDRGP4 $287
+JUMPV
+LABELV $286
+ADDRLP4 4+4
+INDIRI4
+CNSTI4 0
+EQI4 $291
+ADDRFP4 24
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $291
+LABELV $287
+ADDRFP4 24
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $294
+ADDRGP4 $263
+JUMPV
+LABELV $294
+LABELV $267
+ADDRLP4 60
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $269
+ADDRLP4 60
+INDIRI4
+ADDRLP4 1092
+INDIRI4
+LTI4 $266
+LABELV $263
+endproc CG_ClipMoveToEntities 1184 36
+export CG_Trace
+proc CG_Trace 60 28
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 trap_CM_BoxTrace
+CALLV
+pop
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+EQF4 $300
+ADDRLP4 56
+CNSTI4 1022
+ASGNI4
+ADDRGP4 $301
+JUMPV
+LABELV $300
+ADDRLP4 56
+CNSTI4 1023
+ASGNI4
+LABELV $301
+ADDRLP4 0+52
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_ClipMoveToEntities
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRB
+ASGNB 56
+LABELV $296
+endproc CG_Trace 60 28
+export CG_PointContents
+proc CG_PointContents 36 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+ADDRGP4 trap_CM_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $306
+JUMPV
+LABELV $303
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_solidEntities
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $307
+ADDRGP4 $304
+JUMPV
+LABELV $307
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 16777215
+EQI4 $309
+ADDRGP4 $304
+JUMPV
+LABELV $309
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 trap_CM_InlineModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $311
+ADDRGP4 $304
+JUMPV
+LABELV $311
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 732
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 744
+ADDP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_CM_TransformedPointContents
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+ADDRLP4 32
+INDIRI4
+BORI4
+ASGNI4
+LABELV $304
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $306
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg_numSolidEntities
+INDIRI4
+LTI4 $303
+ADDRLP4 16
+INDIRI4
+RETI4
+LABELV $302
+endproc CG_PointContents 36 16
+proc CG_InterpolatePlayerState 76 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRGP4 cg+108604
+ASGNP4
+ADDRLP4 4
+ADDRGP4 cg+44
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRGP4 cg+48
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRB
+ASGNB 468
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $318
+ADDRLP4 48
+ADDRGP4 trap_GetCurrentCmdNumber
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRGP4 trap_GetUserCmd
+CALLI4
+pop
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 PM_UpdateViewAngles
+CALLV
+pop
+LABELV $318
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 0
+EQI4 $320
+ADDRGP4 $313
+JUMPV
+LABELV $320
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $325
+ADDRLP4 24
+CNSTI4 8
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+GTI4 $323
+LABELV $325
+ADDRGP4 $313
+JUMPV
+LABELV $323
+ADDRLP4 32
+CNSTI4 8
+ASGNI4
+ADDRLP4 36
+ADDRLP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 36
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 44
+CNSTI4 52
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+GEI4 $327
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+ADDI4
+ASGNI4
+LABELV $327
+ADDRLP4 48
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 48
+INDIRI4
+CVIF4 4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 48
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $329
+ADDRLP4 52
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 56
+CNSTI4 64
+ASGNI4
+ADDRLP4 60
+ADDRLP4 52
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 60
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $333
+ADDRLP4 64
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 68
+CNSTI4 196
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 72
+ADDRGP4 LerpAngle
+CALLF4
+ASGNF4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDP4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+LABELV $333
+ADDRLP4 64
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 68
+CNSTI4 76
+ASGNI4
+ADDRLP4 72
+ADDRLP4 64
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 72
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $330
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $329
+LABELV $313
+endproc CG_InterpolatePlayerState 76 12
+proc CG_TouchItem 24 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_predictItems+12
+INDIRI4
+CNSTI4 0
+NEI4 $336
+ADDRGP4 $335
+JUMPV
+LABELV $336
+ADDRGP4 cg+108604
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cg+107612
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BG_PlayerTouchesItem
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $339
+ADDRGP4 $335
+JUMPV
+LABELV $339
+ADDRFP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+NEI4 $343
+ADDRGP4 $335
+JUMPV
+LABELV $343
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $346
+ADDRGP4 $335
+JUMPV
+LABELV $346
+CNSTI4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+CNSTI4 12
+NEI4 $349
+ADDRLP4 8
+CNSTI4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 $354
+ARGP4
+ADDRLP4 12
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $367
+ADDRGP4 cg+108604+248+4
+INDIRI4
+CNSTI4 2
+EQI4 $368
+LABELV $367
+ADDRLP4 8
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 $358
+ARGP4
+ADDRLP4 16
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $369
+ADDRGP4 cg+108604+248+4
+INDIRI4
+CNSTI4 1
+EQI4 $368
+LABELV $369
+ADDRLP4 8
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 $362
+ARGP4
+ADDRLP4 20
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $352
+LABELV $368
+ADDRGP4 cg+108604+376+48
+INDIRI4
+CNSTI4 8
+LTI4 $352
+ADDRGP4 $335
+JUMPV
+LABELV $352
+LABELV $349
+ADDRGP4 cgs+31464
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cg+108604
+ARGP4
+ADDRLP4 8
+ADDRGP4 BG_CanItemBeGrabbed
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $370
+ADDRGP4 $335
+JUMPV
+LABELV $370
+ADDRLP4 0
+CNSTI4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 6
+NEI4 $374
+ADDRGP4 cg+108604+248+4
+INDIRI4
+CNSTI4 1
+NEI4 $377
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $377
+ADDRGP4 $335
+JUMPV
+LABELV $377
+ADDRGP4 cg+108604+248+4
+INDIRI4
+CNSTI4 2
+NEI4 $382
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 9
+NEI4 $382
+ADDRGP4 $335
+JUMPV
+LABELV $382
+LABELV $374
+CNSTI4 19
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 cg+108604
+ARGP4
+ADDRGP4 BG_AddPredictableEventToPlayerstate
+CALLV
+pop
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $389
+ADDRLP4 16
+ADDRGP4 cg+108604+184+8
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+LSHI4
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+108604+376
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $394
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+108604+376
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $394
+LABELV $389
+LABELV $335
+endproc CG_TouchItem 24 12
+proc CG_TouchTriggerPrediction 92 28
+ADDRGP4 cg+108604+184
+INDIRI4
+CNSTI4 0
+GTI4 $401
+ADDRGP4 $400
+JUMPV
+LABELV $401
+ADDRGP4 cg+108604+4
+INDIRI4
+CNSTI4 2
+NEI4 $408
+ADDRLP4 76
+CNSTI4 1
+ASGNI4
+ADDRGP4 $409
+JUMPV
+LABELV $408
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+LABELV $409
+ADDRLP4 72
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+108604+4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+EQI4 $410
+ADDRLP4 72
+INDIRI4
+ADDRLP4 80
+INDIRI4
+NEI4 $410
+ADDRGP4 $400
+JUMPV
+LABELV $410
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $417
+JUMPV
+LABELV $414
+ADDRLP4 12
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_triggerEntities
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $418
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $418
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_TouchItem
+CALLV
+pop
+ADDRGP4 $415
+JUMPV
+LABELV $418
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 16777215
+EQI4 $420
+ADDRGP4 $415
+JUMPV
+LABELV $420
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 trap_CM_InlineModel
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $422
+ADDRGP4 $415
+JUMPV
+LABELV $422
+ADDRLP4 16
+ARGP4
+ADDRGP4 cg+108604+20
+ARGP4
+ADDRGP4 cg+108604+20
+ARGP4
+ADDRGP4 cg_pmove+184
+ARGP4
+ADDRGP4 cg_pmove+196
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 -1
+ARGI4
+ADDRGP4 trap_CM_BoxTrace
+CALLV
+pop
+ADDRLP4 16+4
+INDIRI4
+CNSTI4 0
+NEI4 $430
+ADDRGP4 $415
+JUMPV
+LABELV $430
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 9
+NEI4 $433
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $438
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $438
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 35
+EQI4 $433
+LABELV $438
+ADDRGP4 $434
+JUMPV
+LABELV $433
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $439
+ADDRGP4 cg+108604
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BG_TouchJumpPad
+CALLV
+pop
+LABELV $439
+LABELV $434
+LABELV $415
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $417
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg_numTriggerEntities
+INDIRI4
+LTI4 $414
+ADDRGP4 cg+108604+460
+INDIRI4
+ADDRGP4 cg+108604+456
+INDIRI4
+EQI4 $442
+ADDRGP4 cg+108604+460
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+108604+448
+CNSTI4 0
+ASGNI4
+LABELV $442
+LABELV $400
+endproc CG_TouchTriggerPrediction 92 28
+export CG_PredictPlayerState
+proc CG_PredictPlayerState 616 28
+ADDRGP4 cg+108600
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+109880
+INDIRI4
+CNSTI4 0
+NEI4 $454
+ADDRGP4 cg+109880
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+108604
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRB
+ASGNB 468
+LABELV $454
+ADDRLP4 532
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+8
+INDIRI4
+ADDRLP4 532
+INDIRI4
+NEI4 $464
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+ADDRLP4 532
+INDIRI4
+EQI4 $460
+LABELV $464
+ADDRGP4 cg+109900
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_InterpolatePlayerState
+CALLV
+pop
+ADDRGP4 $452
+JUMPV
+LABELV $460
+ADDRLP4 536
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_nopredict+12
+INDIRI4
+ADDRLP4 536
+INDIRI4
+NEI4 $470
+ADDRGP4 cg_synchronousClients+12
+INDIRI4
+ADDRLP4 536
+INDIRI4
+EQI4 $466
+LABELV $470
+ADDRGP4 cg+109900
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_InterpolatePlayerState
+CALLV
+pop
+ADDRGP4 $452
+JUMPV
+LABELV $466
+ADDRGP4 cg_pmove
+ADDRGP4 cg+108604
+ASGNP4
+ADDRGP4 cg_pmove+228
+ADDRGP4 CG_Trace
+ASGNP4
+ADDRGP4 cg_pmove+232
+ADDRGP4 CG_PointContents
+ASGNP4
+ADDRGP4 cg_pmove
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $475
+ADDRGP4 cg_pmove+28
+CNSTI4 65537
+ASGNI4
+ADDRGP4 $476
+JUMPV
+LABELV $475
+ADDRGP4 cg_pmove+28
+CNSTI4 33619969
+ASGNI4
+LABELV $476
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $479
+ADDRLP4 540
+ADDRGP4 cg_pmove+28
+ASGNP4
+ADDRLP4 540
+INDIRP4
+ADDRLP4 540
+INDIRP4
+INDIRI4
+CNSTI4 -33554433
+BANDI4
+ASGNI4
+LABELV $479
+ADDRGP4 cgs+31468
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+LEI4 $486
+ADDRLP4 540
+CNSTI4 1
+ASGNI4
+ADDRGP4 $487
+JUMPV
+LABELV $486
+ADDRLP4 540
+CNSTI4 0
+ASGNI4
+LABELV $487
+ADDRGP4 cg_pmove+36
+ADDRLP4 540
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg+108604
+INDIRB
+ASGNB 468
+ADDRLP4 544
+ADDRGP4 trap_GetCurrentCmdNumber
+CALLI4
+ASGNI4
+ADDRLP4 472
+ADDRLP4 544
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 472
+INDIRI4
+CNSTI4 64
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 508
+ARGP4
+ADDRGP4 trap_GetUserCmd
+CALLI4
+pop
+ADDRLP4 548
+ADDRLP4 508
+INDIRI4
+ASGNI4
+ADDRLP4 548
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+LEI4 $489
+ADDRLP4 548
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+GEI4 $489
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $493
+ADDRGP4 $496
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $493
+ADDRGP4 cg+109900
+CNSTI4 0
+ASGNI4
+ADDRGP4 $452
+JUMPV
+LABELV $489
+ADDRLP4 472
+INDIRI4
+ARGI4
+ADDRLP4 484
+ARGP4
+ADDRGP4 trap_GetUserCmd
+CALLI4
+pop
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $498
+ADDRLP4 552
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 552
+INDIRI4
+NEI4 $498
+ADDRGP4 cg+107600
+INDIRI4
+ADDRLP4 552
+INDIRI4
+NEI4 $498
+ADDRGP4 cg+108604
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRB
+ASGNB 468
+ADDRGP4 cg+107624
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $499
+JUMPV
+LABELV $498
+ADDRGP4 cg+108604
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRB
+ASGNB 468
+ADDRGP4 cg+107624
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $499
+ADDRGP4 CG_BeginSolidIndex
+CALLV
+pop
+ADDRGP4 pmove_msec+12
+INDIRI4
+CNSTI4 8
+GEI4 $511
+ADDRGP4 $514
+ARGP4
+ADDRGP4 $515
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 pmove_msec
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 $512
+JUMPV
+LABELV $511
+ADDRGP4 pmove_msec+12
+INDIRI4
+CNSTI4 33
+LEI4 $516
+ADDRGP4 $514
+ARGP4
+ADDRGP4 $519
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 pmove_msec
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+LABELV $516
+LABELV $512
+ADDRGP4 cg_pmove+220
+ADDRGP4 pmove_fixed+12
+INDIRI4
+ASGNI4
+ADDRGP4 cg_pmove+224
+ADDRGP4 pmove_msec+12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 472
+INDIRI4
+CNSTI4 64
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 480
+CNSTI4 0
+ASGNI4
+ADDRLP4 556
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_optimizePrediction+12
+INDIRI4
+ADDRLP4 556
+INDIRI4
+EQI4 $524
+ADDRGP4 cg+109900
+INDIRI4
+ADDRLP4 556
+INDIRI4
+EQI4 $524
+ADDRGP4 cg+107600
+INDIRI4
+ADDRLP4 556
+INDIRI4
+NEI4 $524
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 556
+INDIRI4
+NEI4 $524
+ADDRGP4 cg+110384
+INDIRI4
+ADDRGP4 cg+107624
+INDIRI4
+NEI4 $524
+ADDRGP4 cg+110388
+INDIRI4
+ADDRGP4 cg+108604
+INDIRI4
+NEI4 $524
+ADDRGP4 cg+110392
+INDIRI4
+ADDRGP4 cg_pmove+28
+INDIRI4
+NEI4 $524
+ADDRGP4 cg+110396
+INDIRI4
+ADDRGP4 cg_pmove+220
+INDIRI4
+NEI4 $524
+ADDRGP4 cg+110400
+INDIRI4
+ADDRGP4 cg_pmove+224
+INDIRI4
+NEI4 $524
+ADDRGP4 cg+110404
+INDIRI4
+ADDRGP4 cg_pmove+36
+INDIRI4
+NEI4 $524
+ADDRGP4 cg+110372
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LTI4 $524
+ADDRGP4 cg+110372
+INDIRI4
+ADDRLP4 472
+INDIRI4
+GTI4 $524
+ADDRGP4 cg+108604
+ADDRGP4 cg+109904
+INDIRB
+ASGNB 468
+ADDRGP4 cg+108600
+ADDRGP4 cg+110380
+INDIRI4
+ASGNI4
+ADDRLP4 560
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cg+110372
+INDIRI4
+ADDRLP4 560
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 480
+ADDRLP4 560
+INDIRI4
+ASGNI4
+ADDRGP4 $525
+JUMPV
+LABELV $524
+ADDRGP4 cg+110384
+ADDRGP4 cg+107624
+INDIRI4
+ASGNI4
+ADDRGP4 cg+110388
+ADDRGP4 cg+108604
+INDIRI4
+ASGNI4
+ADDRGP4 cg+110392
+ADDRGP4 cg_pmove+28
+INDIRI4
+ASGNI4
+ADDRGP4 cg+110396
+ADDRGP4 cg_pmove+220
+INDIRI4
+ASGNI4
+ADDRGP4 cg+110400
+ADDRGP4 cg_pmove+224
+INDIRI4
+ASGNI4
+ADDRGP4 cg+110404
+ADDRGP4 cg_pmove+36
+INDIRI4
+ASGNI4
+LABELV $525
+ADDRLP4 480
+INDIRI4
+CNSTI4 0
+EQI4 $563
+ADDRLP4 560
+ADDRGP4 cg+110376
+INDIRI4
+ASGNI4
+ADDRGP4 $564
+JUMPV
+LABELV $563
+ADDRLP4 560
+CNSTI4 0
+ASGNI4
+LABELV $564
+ADDRLP4 476
+ADDRLP4 560
+INDIRI4
+ASGNI4
+ADDRGP4 $568
+JUMPV
+LABELV $565
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cg_pmove+4
+ARGP4
+ADDRGP4 trap_GetUserCmd
+CALLI4
+pop
+ADDRGP4 cg_pmove+220
+INDIRI4
+CNSTI4 0
+EQI4 $570
+ADDRGP4 cg_pmove
+INDIRP4
+ARGP4
+ADDRGP4 cg_pmove+4
+ARGP4
+ADDRGP4 PM_UpdateViewAngles
+CALLV
+pop
+LABELV $570
+ADDRGP4 cg_pmove+4
+INDIRI4
+ADDRGP4 cg+108604
+INDIRI4
+GTI4 $574
+ADDRGP4 $566
+JUMPV
+LABELV $574
+ADDRGP4 cg_pmove+4
+INDIRI4
+ADDRLP4 484
+INDIRI4
+LEI4 $578
+ADDRGP4 $566
+JUMPV
+LABELV $578
+ADDRLP4 480
+INDIRI4
+CNSTI4 0
+NEI4 $581
+ADDRGP4 cg+108604
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $581
+ADDRGP4 cg+107600
+INDIRI4
+CNSTI4 0
+EQI4 $584
+ADDRLP4 580
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+109888+8
+ADDRLP4 580
+INDIRF4
+ASGNF4
+ADDRGP4 cg+109888+4
+ADDRLP4 580
+INDIRF4
+ASGNF4
+ADDRGP4 cg+109888
+ADDRLP4 580
+INDIRF4
+ASGNF4
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $592
+ADDRGP4 $595
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $592
+ADDRGP4 cg+107600
+CNSTI4 0
+ASGNI4
+ADDRGP4 $585
+JUMPV
+LABELV $584
+ADDRGP4 cg+108604+20
+ARGP4
+ADDRGP4 cg+108604+68
+INDIRI4
+ARGI4
+ADDRGP4 cg+107624
+INDIRI4
+ARGI4
+ADDRGP4 cg+107616
+INDIRI4
+ARGI4
+ADDRLP4 580
+ARGP4
+ADDRGP4 cg+108604+152
+ARGP4
+ADDRLP4 592
+ARGP4
+ADDRGP4 CG_AdjustPositionForMover
+CALLV
+pop
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $605
+ADDRLP4 4+20
+ARGP4
+ADDRLP4 580
+ARGP4
+ADDRLP4 604
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 604
+INDIRI4
+CNSTI4 0
+NEI4 $608
+ADDRGP4 $611
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $608
+LABELV $605
+ADDRLP4 564
+ADDRLP4 4+20
+INDIRF4
+ADDRLP4 580
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 564+4
+ADDRLP4 4+20+4
+INDIRF4
+ADDRLP4 580+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 564+8
+ADDRLP4 4+20+8
+INDIRF4
+ADDRLP4 580+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 564
+ARGP4
+ADDRLP4 604
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 576
+ADDRLP4 604
+INDIRF4
+ASGNF4
+ADDRLP4 576
+INDIRF4
+CNSTF4 1036831949
+LEF4 $621
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $623
+ADDRGP4 $626
+ARGP4
+ADDRLP4 576
+INDIRF4
+ARGF4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $623
+ADDRGP4 cg_errorDecay+12
+INDIRI4
+CNSTI4 0
+EQI4 $627
+ADDRLP4 612
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 cg+109884
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 608
+ADDRGP4 cg_errorDecay+8
+INDIRF4
+ADDRLP4 612
+INDIRI4
+CVIF4 4
+SUBF4
+ADDRGP4 cg_errorDecay+8
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 608
+INDIRF4
+CNSTF4 0
+GEF4 $634
+ADDRLP4 608
+CNSTF4 0
+ASGNF4
+LABELV $634
+ADDRLP4 608
+INDIRF4
+CNSTF4 0
+LEF4 $636
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $636
+ADDRGP4 $639
+ARGP4
+ADDRLP4 608
+INDIRF4
+ARGF4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $636
+ADDRGP4 cg+109888
+ADDRGP4 cg+109888
+INDIRF4
+ADDRLP4 608
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+109888+4
+ADDRGP4 cg+109888+4
+INDIRF4
+ADDRLP4 608
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+109888+8
+ADDRGP4 cg+109888+8
+INDIRF4
+ADDRLP4 608
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $628
+JUMPV
+LABELV $627
+ADDRLP4 608
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+109888+8
+ADDRLP4 608
+INDIRF4
+ASGNF4
+ADDRGP4 cg+109888+4
+ADDRLP4 608
+INDIRF4
+ASGNF4
+ADDRGP4 cg+109888
+ADDRLP4 608
+INDIRF4
+ASGNF4
+LABELV $628
+ADDRGP4 cg+109888
+ADDRLP4 564
+INDIRF4
+ADDRGP4 cg+109888
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+109888+4
+ADDRLP4 564+4
+INDIRF4
+ADDRGP4 cg+109888+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+109888+8
+ADDRLP4 564+8
+INDIRF4
+ADDRGP4 cg+109888+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+109884
+ADDRGP4 cg+107616
+INDIRI4
+ASGNI4
+LABELV $621
+LABELV $585
+LABELV $581
+ADDRGP4 cg_pmove+40
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_pmove+220
+INDIRI4
+CNSTI4 0
+EQI4 $670
+ADDRGP4 cg_pmove+4
+ADDRGP4 cg_pmove+4
+INDIRI4
+ADDRGP4 pmove_msec+12
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+ADDRGP4 pmove_msec+12
+INDIRI4
+DIVI4
+ADDRGP4 pmove_msec+12
+INDIRI4
+MULI4
+ASGNI4
+LABELV $670
+ADDRGP4 cg_pmove+48
+ADDRGP4 cgs+31464
+INDIRI4
+ASGNI4
+ADDRGP4 cg_pmove
+ARGP4
+ADDRGP4 Pmove
+CALLV
+pop
+ADDRLP4 476
+CNSTI4 1
+ASGNI4
+ADDRGP4 CG_TouchTriggerPrediction
+CALLV
+pop
+LABELV $566
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $568
+ADDRLP4 0
+INDIRI4
+ADDRLP4 472
+INDIRI4
+LEI4 $565
+ADDRGP4 CG_EndSolidIndex
+CALLV
+pop
+ADDRGP4 cg+109900
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+109904
+ADDRGP4 cg+108604
+INDIRB
+ASGNB 468
+ADDRGP4 cg+110372
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRGP4 cg+110376
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRGP4 cg+110380
+ADDRGP4 cg+108600
+INDIRI4
+ASGNI4
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 1
+LEI4 $687
+ADDRGP4 $690
+ARGP4
+ADDRGP4 cg_pmove+4
+INDIRI4
+ARGI4
+ADDRGP4 cg+107612
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $687
+ADDRLP4 476
+INDIRI4
+CNSTI4 0
+NEI4 $693
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $452
+ADDRGP4 $698
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $452
+JUMPV
+LABELV $693
+ADDRGP4 cg+108604+20
+ARGP4
+ADDRGP4 cg+108604+68
+INDIRI4
+ARGI4
+ADDRGP4 cg+107624
+INDIRI4
+ARGI4
+ADDRGP4 cg+107612
+INDIRI4
+ARGI4
+ADDRGP4 cg+108604+20
+ARGP4
+ADDRGP4 cg+108604+152
+ARGP4
+ADDRGP4 cg+108604+152
+ARGP4
+ADDRGP4 CG_AdjustPositionForMover
+CALLV
+pop
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $711
+ADDRGP4 cg+108604+108
+INDIRI4
+ADDRLP4 4+108
+INDIRI4
+CNSTI4 2
+ADDI4
+LEI4 $714
+ADDRGP4 $719
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $714
+LABELV $711
+ADDRGP4 cg+108604
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_TransitionPlayerState
+CALLV
+pop
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $721
+ADDRGP4 cg+110408
+INDIRI4
+ADDRGP4 cg+108604+108
+INDIRI4
+LEI4 $724
+ADDRGP4 $729
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 cg+110408
+ADDRGP4 cg+108604+108
+INDIRI4
+ASGNI4
+LABELV $724
+LABELV $721
+LABELV $452
+endproc CG_PredictPlayerState 616 28
+bss
+align 4
+LABELV cg_solidStamp
+skip 4
+align 4
+LABELV cg_solidStamps
+skip 1024
+align 4
+LABELV cg_solidGridEntries
+skip 16384
+align 4
+LABELV cg_solidGridStart
+skip 1028
+align 4
+LABELV cg_solidGridCell
+skip 4
+align 4
+LABELV cg_solidGridOrigin
+skip 8
+align 4
+LABELV cg_solidGridValid
+skip 4
+align 4
+LABELV cg_solidBModels
+skip 1024
+align 4
+LABELV cg_numSolidBModels
+skip 4
+align 4
+LABELV cg_solidBounds
+skip 15360
+align 4
+LABELV cg_solidIndexValid
+skip 4
+align 4
+LABELV cg_triggerEntities
+skip 1024
+align 4
+LABELV cg_numTriggerEntities
+skip 4
+align 4
+LABELV cg_solidEntities
+skip 1024
+align 4
+LABELV cg_numSolidEntities
+skip 4
+align 4
+LABELV cg_pmove
+skip 236
+import CG_AddBoundingBox
+import CG_AddBoundingBoxEntity
+import CG_QueryCvar
+import CG_Timestamp
+import CG_LimitCvars
+import trap_RealTime
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import trap_R_inPVS
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_Cutscene2d_Draw
+import CG_Cutscene2d_UpdateTrans
+import CG_Cutscene2d_CheckCmd
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import Main_SpriteParticles
+import LaunchRevivalParticle
+import LaunchSpeedyPuffTrail
+import Init_SpriteParticles
+import AddLFsToScreen
+import AddLFToDrawList
+import Init_LensFlareSys
+import DumpPolyInfo
+import ActiveChooseLogoMenu
+import FindLogoForSpraying
+import Add_LogoToDrawList
+import AddLogosToScene
+import Init_SprayLogoSys
+import Calculate_2DOfDIR
+import Calculate_2DOf3D
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_ChangeLoadingProgress
+import CG_LoadingString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_ScorePlum
+import CG_TeleOutEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_GenerateParticles
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_PortalInView
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_GetWaterMuzzle
+import CG_SprayTrail
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponSRWC
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_Boomies_Explosion
+import CG_BamBam_Explosion
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_LerpTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayer
+import CG_LoadDeferredPlayers
+import CG_UpdateVoipTeamIDs
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Draw3DModel
+import CG_SetPrintString
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import CG_MessagePrint
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_WorldToScreen
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_DrawPic1024
+import CG_DrawRect1024
+import CG_FillRect1024
+import CG_AdjustFrom1024
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddPolyBatched
+import CG_AddRefEntityBatched
+import CG_FlushSceneBatches
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_ForceModelChange
+import CG_GetCvarFloat
+import CG_GetCvarInt
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StreamAssets
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_icons
+import cg_ambient
+import cg_drawBBox
+import cg_drawVoiceNames
+import cg_drawLensflare
+import cg_timestamps
+import cg_skyLensflare
+import cg_sky
+import cg_curWarmupReady
+import cg_warmupReady
+import cg_glowModelTeam
+import cg_glowModel
+import cg_cineDrawLetterBox
+import cg_cineHideHud
+import cg_LPSwallhackAlpha
+import cg_LPSwallhackSize
+import cg_bigScoreType
+import cg_thirdPersonAutoSwitch
+import cg_drawTimeLeft
+import cg_drawServerInfos
+import cg_drawMessages
+import cg_drawups
+import cg_wopFFAhud
+import cg_printDir
+import cg_drawRealTime
+import cg_correctedWeaponPos
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_streamAssets
+import cg_deferPlayers
+import cg_predictItems
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_chatBeep
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_optimizePrediction
+import cg_nopredict
+import cg_errorDecay
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import trailEnt
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $729
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $719
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $698
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $690
+byte 1 91
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 93
+byte 1 32
+byte 1 0
+align 1
+LABELV $639
+byte 1 68
+byte 1 111
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $626
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $611
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $595
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 84
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $519
+byte 1 51
+byte 1 51
+byte 1 0
+align 1
+LABELV $515
+byte 1 56
+byte 1 0
+align 1
+LABELV $514
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $496
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 80
+byte 1 65
+byte 1 67
+byte 1 75
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 66
+byte 1 65
+byte 1 67
+byte 1 75
+byte 1 85
+byte 1 80
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $362
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 95
+byte 1 110
+byte 1 0
+align 1
+LABELV $358
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 95
+byte 1 114
+byte 1 0
+align 1
+LABELV $354
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 95
+byte 1 98
+byte 1 0
@@ -0,0 +1,4518 @@
+code
+proc CG_DrawClientScore 1092 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 1056
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+LTI4 $84
+ADDRLP4 1056
+INDIRI4
+ADDRGP4 cgs+31488
+INDIRI4
+LTI4 $81
+LABELV $84
+ADDRGP4 $85
+ARGP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $80
+JUMPV
+LABELV $81
+ADDRLP4 1048
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRI4
+CNSTI4 16
+LEI4 $86
+ADDRLP4 1060
+CNSTI4 16
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRFP4 16
+INDIRI4
+ADDRLP4 1060
+INDIRI4
+SUBI4
+CNSTI4 2
+DIVI4
+ADDI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1060
+INDIRI4
+ASGNI4
+ADDRGP4 $87
+JUMPV
+LABELV $86
+ADDRLP4 1040
+ADDRFP4 16
+INDIRI4
+ASGNI4
+LABELV $87
+ADDRLP4 0
+CNSTI4 1836
+ADDRFP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088
+ADDP4
+ASGNP4
+ADDRLP4 1044
+CNSTI4 80
+ASGNI4
+ADDRLP4 1052
+CNSTI4 112
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $89
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $90
+ADDRLP4 1044
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 1048
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 1060
+ADDRFP4 16
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 1060
+INDIRF4
+ARGF4
+ADDRLP4 1060
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawFlagModel
+CALLV
+pop
+ADDRGP4 $90
+JUMPV
+LABELV $89
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $94
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $95
+ADDRLP4 1044
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 1048
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 1060
+ADDRFP4 16
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 1060
+INDIRF4
+ARGF4
+ADDRLP4 1060
+INDIRF4
+ARGF4
+CNSTI4 2
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawFlagModel
+CALLV
+pop
+ADDRGP4 $95
+JUMPV
+LABELV $94
+ADDRLP4 1060
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+LEI4 $99
+ADDRLP4 1060
+INDIRI4
+CNSTI4 5
+GTI4 $99
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $100
+ADDRLP4 1044
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 1048
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 1064
+ADDRFP4 16
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 1064
+INDIRF4
+ARGF4
+ADDRLP4 1064
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+276-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $100
+JUMPV
+LABELV $99
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 100
+GEI4 $107
+ADDRLP4 16
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $109
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 1
+NEI4 $110
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 8
+SUBI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawSmallStringColor
+CALLV
+pop
+ADDRGP4 $111
+JUMPV
+LABELV $110
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawSmallStringColor
+CALLV
+pop
+LABELV $111
+LABELV $107
+LABELV $100
+LABELV $95
+LABELV $90
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 1
+NEI4 $113
+ADDRLP4 16
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $116
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 100
+GEI4 $117
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $117
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 8
+ADDI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawSmallStringColor
+CALLV
+pop
+ADDRGP4 $118
+JUMPV
+LABELV $117
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1068
+CNSTI4 0
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+ARGI4
+ADDRLP4 1068
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+ADDRLP4 1040
+INDIRI4
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $118
+LABELV $113
+ADDRLP4 1060
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 1060
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 1060
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 1060
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 1127481344
+ASGNF4
+ADDRLP4 1052
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 1048
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 1064
+ADDRFP4 16
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 1064
+INDIRF4
+ARGF4
+ADDRLP4 1064
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_DrawHead
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $122
+ADDRLP4 16
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $124
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $123
+JUMPV
+LABELV $122
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $125
+ADDRLP4 16
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $127
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $126
+JUMPV
+LABELV $125
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 4
+NEI4 $128
+ADDRGP4 cgs+31780
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $131
+ADDRLP4 16
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $134
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $129
+JUMPV
+LABELV $131
+ADDRLP4 16
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $135
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $129
+JUMPV
+LABELV $128
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 5
+LTI4 $136
+ADDRLP4 16
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $139
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $137
+JUMPV
+LABELV $136
+ADDRLP4 16
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $135
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $137
+LABELV $129
+LABELV $126
+LABELV $123
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $140
+ADDRGP4 localClient
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $147
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 5
+LTI4 $143
+LABELV $147
+ADDRLP4 1084
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $144
+JUMPV
+LABELV $143
+ADDRLP4 1084
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 -16385
+BANDI4
+ASGNI4
+LABELV $144
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+NEI4 $149
+ADDRLP4 1088
+CNSTF4 0
+ASGNF4
+ADDRLP4 1068
+ADDRLP4 1088
+INDIRF4
+ASGNF4
+ADDRLP4 1068+4
+ADDRLP4 1088
+INDIRF4
+ASGNF4
+ADDRLP4 1068+8
+CNSTF4 1060320051
+ASGNF4
+ADDRGP4 $150
+JUMPV
+LABELV $149
+ADDRLP4 1084
+INDIRI4
+CNSTI4 1
+NEI4 $153
+ADDRLP4 1068
+CNSTF4 1060320051
+ASGNF4
+ADDRLP4 1068+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 1068+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $154
+JUMPV
+LABELV $153
+ADDRLP4 1084
+INDIRI4
+CNSTI4 2
+NEI4 $157
+ADDRLP4 1088
+CNSTF4 1060320051
+ASGNF4
+ADDRLP4 1068
+ADDRLP4 1088
+INDIRF4
+ASGNF4
+ADDRLP4 1068+4
+ADDRLP4 1088
+INDIRF4
+ASGNF4
+ADDRLP4 1068+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $158
+JUMPV
+LABELV $157
+ADDRLP4 1088
+CNSTF4 1060320051
+ASGNF4
+ADDRLP4 1068
+ADDRLP4 1088
+INDIRF4
+ASGNF4
+ADDRLP4 1068+4
+ADDRLP4 1088
+INDIRF4
+ASGNF4
+ADDRLP4 1068+8
+CNSTF4 1060320051
+ASGNF4
+LABELV $158
+LABELV $154
+LABELV $150
+ADDRLP4 1068+12
+CNSTF4 1060320051
+ADDRFP4 12
+INDIRF4
+MULF4
+ASGNF4
+CNSTF4 1127219200
+ARGF4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 1040
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 1068
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 5
+GEI4 $164
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $164
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $168
+ADDRGP4 cg+112080
+INDIRI4
+CNSTI4 0
+NEI4 $168
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 4
+NEI4 $172
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+NEI4 $172
+ADDRLP4 1088
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1073740985
+ADDRLP4 1088
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+MULF4
+CVFI4 4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+1512
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $173
+JUMPV
+LABELV $172
+ADDRLP4 1088
+CNSTI4 1
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+ADDRLP4 1088
+INDIRI4
+ADDI4
+ADDRGP4 cg+112084
+INDIRI4
+NEI4 $177
+ADDRGP4 cg+112084
+INDIRI4
+ADDRLP4 1088
+INDIRI4
+LEI4 $177
+ADDRGP4 cgs+160652+1508
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $177
+LABELV $173
+ADDRGP4 cg+112080
+CNSTI4 1
+ASGNI4
+LABELV $168
+LABELV $164
+LABELV $140
+CNSTI4 160
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1068
+CNSTI4 0
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+ARGI4
+ADDRLP4 1068
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRLP4 1068
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+CNSTI4 416
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1072
+CNSTI4 0
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+ARGI4
+ADDRLP4 1072
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+ADDRLP4 1040
+INDIRI4
+ARGI4
+CNSTI4 20
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRFP4 4
+INDIRP4
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $184
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $187
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1076
+CNSTI4 0
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+ARGI4
+ADDRLP4 1076
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRLP4 1076
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $184
+LABELV $80
+endproc CG_DrawClientScore 1092 36
+proc CG_TeamScoreboard 68 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 20+8
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 20+4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 20+12
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $192
+ADDRFP4 12
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+112084
+ADDP4
+INDIRI4
+GEI4 $192
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 $199
+JUMPV
+LABELV $196
+ADDRLP4 8
+CNSTI4 72
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+112120
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1836
+ADDRLP4 8
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+68
+ADDP4
+INDIRI4
+NEI4 $202
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $202
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $206
+ADDRLP4 0
+INDIRI4
+ADDRFP4 12
+INDIRI4
+LEI4 $210
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRGP4 $211
+JUMPV
+LABELV $210
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+LABELV $211
+ADDRLP4 16
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $198
+JUMPV
+LABELV $206
+LABELV $197
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $199
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+112104
+INDIRI4
+LTI4 $196
+LABELV $198
+LABELV $192
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 $215
+JUMPV
+LABELV $212
+ADDRLP4 8
+CNSTI4 72
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+112120
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 1836
+ADDRLP4 8
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+EQI4 $219
+ADDRGP4 $213
+JUMPV
+LABELV $219
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $221
+ADDRFP4 12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+GTI4 $221
+ADDRFP4 12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+NEI4 $223
+ADDRGP4 $225
+ARGP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+112084
+ADDP4
+INDIRI4
+ADDRFP4 12
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 112
+ARGI4
+ADDRFP4 0
+INDIRI4
+ADDRFP4 16
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDI4
+ARGI4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRGP4 colorBlack
+ARGP4
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+CNSTI4 40
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 $222
+JUMPV
+LABELV $223
+ADDRFP4 12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 1
+NEI4 $222
+ADDRFP4 0
+INDIRI4
+ADDRFP4 16
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDI4
+ARGI4
+CNSTI4 72
+ADDRLP4 36
+INDIRI4
+MULI4
+ADDRGP4 cg+112120
+ADDP4
+ARGP4
+ADDRGP4 colorBlack
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawClientScore
+CALLV
+pop
+ADDRGP4 $222
+JUMPV
+LABELV $221
+ADDRFP4 12
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+112084
+ADDP4
+INDIRI4
+GEI4 $230
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $230
+ADDRFP4 12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 1
+NEI4 $230
+ADDRGP4 $225
+ARGP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+112084
+ADDP4
+INDIRI4
+ADDRFP4 12
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 112
+ARGI4
+ADDRFP4 0
+INDIRI4
+ADDRFP4 16
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDI4
+ARGI4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRGP4 colorBlack
+ARGP4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+CNSTI4 40
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 $231
+JUMPV
+LABELV $230
+ADDRFP4 0
+INDIRI4
+ADDRFP4 16
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawClientScore
+CALLV
+pop
+LABELV $231
+LABELV $222
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $213
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $215
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+112104
+INDIRI4
+GEI4 $234
+ADDRLP4 0
+INDIRI4
+ADDRFP4 12
+INDIRI4
+LTI4 $212
+LABELV $234
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $188
+endproc CG_TeamScoreboard 68 36
+export CG_DrawOldScoreboard
+proc CG_DrawOldScoreboard 148 36
+ADDRGP4 cg_paused+12
+INDIRI4
+CNSTI4 0
+EQI4 $236
+ADDRGP4 cg+16
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $235
+JUMPV
+LABELV $236
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 2
+NEI4 $240
+ADDRGP4 cg+108604+4
+INDIRI4
+CNSTI4 5
+NEI4 $240
+ADDRGP4 cg+16
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $235
+JUMPV
+LABELV $240
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+131792
+INDIRI4
+ADDRLP4 72
+INDIRI4
+EQI4 $246
+ADDRGP4 cg+121340
+INDIRI4
+ADDRLP4 72
+INDIRI4
+NEI4 $246
+CNSTI4 0
+RETI4
+ADDRGP4 $235
+JUMPV
+LABELV $246
+ADDRGP4 cg+121340
+INDIRI4
+CNSTI4 0
+NEI4 $258
+ADDRGP4 cg+108604+4
+INDIRI4
+CNSTI4 3
+EQI4 $258
+ADDRGP4 cg+108604+4
+INDIRI4
+CNSTI4 5
+NEI4 $250
+LABELV $258
+ADDRLP4 40
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 48
+ADDRGP4 colorWhite
+ASGNP4
+ADDRGP4 $251
+JUMPV
+LABELV $250
+ADDRGP4 cg+121348
+INDIRI4
+ARGI4
+CNSTI4 200
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $260
+ADDRGP4 cg+16
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+121352
+CNSTI1 0
+ASGNI1
+CNSTI4 0
+RETI4
+ADDRGP4 $235
+JUMPV
+LABELV $260
+ADDRLP4 40
+ADDRLP4 48
+INDIRP4
+INDIRF4
+ASGNF4
+LABELV $251
+CNSTF4 1109393408
+ARGF4
+CNSTF4 1092616192
+ARGF4
+CNSTF4 1141637120
+ARGF4
+CNSTF4 1139474432
+ARGF4
+ADDRGP4 cgs+160652+980
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 cg+121352
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $266
+ADDRGP4 $269
+ARGP4
+ADDRGP4 cg+121352
+ARGP4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 80
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 640
+ADDRLP4 56
+INDIRI4
+SUBI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 40
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRLP4 88
+CNSTI4 16
+ASGNI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $266
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 5
+GEI4 $271
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $272
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 4
+NEI4 $277
+ADDRLP4 76
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+GEI4 $281
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+LABELV $281
+ADDRGP4 cgs+31780
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $283
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 CG_PlaceString
+CALLP4
+ASGNP4
+ADDRGP4 $286
+ARGP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRGP4 $278
+JUMPV
+LABELV $283
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 CG_PlaceString
+CALLP4
+ASGNP4
+ADDRGP4 $289
+ARGP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRGP4 $278
+JUMPV
+LABELV $277
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_PlaceString
+CALLP4
+ASGNP4
+ADDRGP4 $291
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 80
+INDIRP4
+ASGNP4
+LABELV $278
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 76
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 640
+ADDRLP4 56
+INDIRI4
+SUBI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 60
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRLP4 84
+CNSTI4 16
+ASGNI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 $272
+JUMPV
+LABELV $271
+ADDRGP4 cg+112112
+INDIRI4
+ADDRGP4 cg+112112+4
+INDIRI4
+NEI4 $294
+ADDRGP4 $299
+ARGP4
+ADDRGP4 cg+112112
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRGP4 $295
+JUMPV
+LABELV $294
+ADDRGP4 cg+112112
+INDIRI4
+ADDRGP4 cg+112112+4
+INDIRI4
+LTI4 $301
+ADDRGP4 $306
+ARGP4
+ADDRGP4 cg+112112
+INDIRI4
+ARGI4
+ADDRGP4 cg+112112+4
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRGP4 $302
+JUMPV
+LABELV $301
+ADDRGP4 $310
+ARGP4
+ADDRGP4 cg+112112+4
+INDIRI4
+ARGI4
+ADDRGP4 cg+112112
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 76
+INDIRP4
+ASGNP4
+LABELV $302
+LABELV $295
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 76
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 640
+ADDRLP4 56
+INDIRI4
+SUBI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 60
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRLP4 84
+CNSTI4 16
+ASGNI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $272
+ADDRLP4 20
+CNSTI4 80
+ASGNI4
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 4
+NEI4 $314
+ADDRGP4 cgs+31780
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $317
+CNSTF4 1127219200
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1115684864
+ARGF4
+CNSTF4 1101004800
+ARGF4
+ADDRGP4 cgs+160652+988
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $315
+JUMPV
+LABELV $317
+CNSTF4 1127219200
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1115684864
+ARGF4
+CNSTF4 1101004800
+ARGF4
+ADDRGP4 cgs+160652+984
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $315
+JUMPV
+LABELV $314
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 5
+GEI4 $324
+CNSTF4 1127219200
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1115684864
+ARGF4
+CNSTF4 1101004800
+ARGF4
+ADDRGP4 cgs+160652+1000
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $324
+LABELV $315
+CNSTF4 1132724224
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1115684864
+ARGF4
+CNSTF4 1101004800
+ARGF4
+ADDRGP4 cgs+160652+996
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTF4 1135345664
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1115684864
+ARGF4
+CNSTF4 1101004800
+ARGF4
+ADDRGP4 cgs+160652+1004
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTF4 1137704960
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1115684864
+ARGF4
+CNSTF4 1101004800
+ARGF4
+ADDRGP4 cgs+160652+992
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 20
+CNSTI4 100
+ASGNI4
+ADDRLP4 76
+CNSTI4 4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 5
+LTI4 $335
+ADDRLP4 64
+CNSTI4 210
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+SUBI4
+ASGNI4
+ADDRGP4 $336
+JUMPV
+LABELV $335
+ADDRLP4 64
+CNSTI4 210
+ASGNI4
+LABELV $336
+ADDRGP4 cg+112084+12
+INDIRI4
+CNSTI4 0
+LEI4 $338
+ADDRLP4 64
+ADDRLP4 64
+INDIRI4
+CNSTI4 8
+SUBI4
+ASGNI4
+LABELV $338
+ADDRGP4 cg+112104
+INDIRI4
+CNSTI4 0
+NEI4 $342
+ADDRLP4 24
+CNSTI4 50
+ASGNI4
+ADDRGP4 $343
+JUMPV
+LABELV $342
+ADDRLP4 24
+ADDRLP4 64
+INDIRI4
+ADDRGP4 cg+112104
+INDIRI4
+DIVI4
+ASGNI4
+LABELV $343
+ADDRLP4 68
+ADDRGP4 cg+112104
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $347
+ADDRLP4 80
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 80
+INDIRI4
+ADDRGP4 cg+112084
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $348
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $347
+ADDRLP4 24
+INDIRI4
+CNSTI4 40
+LEI4 $352
+ADDRLP4 24
+CNSTI4 40
+ASGNI4
+ADDRGP4 $353
+JUMPV
+LABELV $352
+ADDRLP4 24
+INDIRI4
+CNSTI4 10
+GEI4 $354
+ADDRLP4 104
+ADDRLP4 64
+INDIRI4
+CNSTI4 10
+DIVI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $356
+ADDRLP4 112
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ADDRGP4 cg+112084
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $362
+ADDRLP4 108
+CNSTI4 1
+ASGNI4
+ADDRGP4 $363
+JUMPV
+LABELV $362
+ADDRLP4 108
+CNSTI4 0
+ASGNI4
+LABELV $363
+ADDRLP4 112
+INDIRI4
+ADDRLP4 80
+ADDP4
+ADDRLP4 108
+INDIRI4
+ASGNI4
+LABELV $357
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $356
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+NEI4 $371
+ADDRLP4 108
+CNSTI4 1
+ASGNI4
+ADDRGP4 $372
+JUMPV
+LABELV $371
+ADDRLP4 108
+CNSTI4 0
+ASGNI4
+LABELV $372
+ADDRLP4 80+4
+INDIRI4
+CNSTI4 0
+NEI4 $373
+ADDRLP4 112
+CNSTI4 1
+ASGNI4
+ADDRGP4 $374
+JUMPV
+LABELV $373
+ADDRLP4 112
+CNSTI4 0
+ASGNI4
+LABELV $374
+ADDRLP4 80+8
+INDIRI4
+CNSTI4 0
+NEI4 $375
+ADDRLP4 116
+CNSTI4 1
+ASGNI4
+ADDRGP4 $376
+JUMPV
+LABELV $375
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+LABELV $376
+ADDRLP4 80+12
+INDIRI4
+CNSTI4 0
+NEI4 $377
+ADDRLP4 120
+CNSTI4 1
+ASGNI4
+ADDRGP4 $378
+JUMPV
+LABELV $377
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+LABELV $378
+ADDRLP4 96
+ADDRLP4 108
+INDIRI4
+ADDRLP4 112
+INDIRI4
+ADDI4
+ADDRLP4 116
+INDIRI4
+ADDI4
+ADDRLP4 120
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $380
+JUMPV
+LABELV $379
+ADDRLP4 124
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $382
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+NEI4 $386
+ADDRGP4 $384
+JUMPV
+LABELV $386
+ADDRLP4 100
+ADDRLP4 104
+INDIRI4
+ADDRLP4 96
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+ADDRLP4 80
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $388
+ADDRLP4 128
+INDIRI4
+ADDRGP4 cg+112084
+ADDP4
+INDIRI4
+ADDRLP4 100
+INDIRI4
+GTI4 $388
+ADDRLP4 132
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 132
+INDIRI4
+ADDRGP4 cg+112084
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 80
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 104
+ADDRLP4 104
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+112084
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 124
+CNSTI4 1
+ASGNI4
+LABELV $388
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+NEI4 $400
+ADDRLP4 132
+CNSTI4 1
+ASGNI4
+ADDRGP4 $401
+JUMPV
+LABELV $400
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+LABELV $401
+ADDRLP4 80+4
+INDIRI4
+CNSTI4 0
+NEI4 $402
+ADDRLP4 136
+CNSTI4 1
+ASGNI4
+ADDRGP4 $403
+JUMPV
+LABELV $402
+ADDRLP4 136
+CNSTI4 0
+ASGNI4
+LABELV $403
+ADDRLP4 80+8
+INDIRI4
+CNSTI4 0
+NEI4 $404
+ADDRLP4 140
+CNSTI4 1
+ASGNI4
+ADDRGP4 $405
+JUMPV
+LABELV $404
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+LABELV $405
+ADDRLP4 80+12
+INDIRI4
+CNSTI4 0
+NEI4 $406
+ADDRLP4 144
+CNSTI4 1
+ASGNI4
+ADDRGP4 $407
+JUMPV
+LABELV $406
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+LABELV $407
+ADDRLP4 96
+ADDRLP4 132
+INDIRI4
+ADDRLP4 136
+INDIRI4
+ADDI4
+ADDRLP4 140
+INDIRI4
+ADDI4
+ADDRLP4 144
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $383
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $382
+LABELV $384
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+NEI4 $408
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $410
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 80
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $414
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 80
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $414
+LABELV $411
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $410
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+LABELV $408
+LABELV $380
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+NEI4 $379
+ADDRLP4 24
+CNSTI4 10
+ASGNI4
+ADDRLP4 68
+ADDRLP4 64
+INDIRI4
+ADDRLP4 24
+INDIRI4
+DIVI4
+ASGNI4
+LABELV $354
+LABELV $353
+ADDRGP4 localClient
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 5
+LTI4 $416
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+ADDRLP4 28
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 cg+112112
+INDIRI4
+ADDRGP4 cg+112112+4
+INDIRI4
+LTI4 $419
+CNSTI4 70
+ARGI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 28
+INDIRI4
+SUBI4
+ARGI4
+CNSTI4 506
+ARGI4
+ADDRLP4 4+4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRLP4 28
+INDIRI4
+ADDI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+ARGI4
+CNSTF4 1059648963
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_DrawTeamBackground
+CALLV
+pop
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 CG_TeamScoreboard
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+ADDRLP4 36
+INDIRI4
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+ADDRLP4 28
+INDIRI4
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+ADDRLP4 36
+INDIRI4
+SUBI4
+ASGNI4
+CNSTI4 70
+ARGI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 28
+INDIRI4
+SUBI4
+ARGI4
+CNSTI4 506
+ARGI4
+ADDRLP4 4+8
+INDIRI4
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRLP4 28
+INDIRI4
+ADDI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+ARGI4
+CNSTF4 1059648963
+ARGF4
+CNSTI4 2
+ARGI4
+ADDRGP4 CG_DrawTeamBackground
+CALLV
+pop
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 4+8
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 104
+ADDRGP4 CG_TeamScoreboard
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 108
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+ADDRLP4 108
+INDIRI4
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+ADDRLP4 108
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $420
+JUMPV
+LABELV $419
+CNSTI4 70
+ARGI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 28
+INDIRI4
+SUBI4
+ARGI4
+CNSTI4 506
+ARGI4
+ADDRLP4 4+8
+INDIRI4
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRLP4 28
+INDIRI4
+ADDI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+ARGI4
+CNSTF4 1059648963
+ARGF4
+CNSTI4 2
+ARGI4
+ADDRGP4 CG_DrawTeamBackground
+CALLV
+pop
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 4+8
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 CG_TeamScoreboard
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+ADDRLP4 36
+INDIRI4
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+ADDRLP4 28
+INDIRI4
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+ADDRLP4 36
+INDIRI4
+SUBI4
+ASGNI4
+CNSTI4 70
+ARGI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 28
+INDIRI4
+SUBI4
+ARGI4
+CNSTI4 506
+ARGI4
+ADDRLP4 4+4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRLP4 28
+INDIRI4
+ADDI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+ARGI4
+CNSTF4 1059648963
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_DrawTeamBackground
+CALLV
+pop
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 104
+ADDRGP4 CG_TeamScoreboard
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 108
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+ADDRLP4 108
+INDIRI4
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+ADDRLP4 108
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $420
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 8
+ADDI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 4+12
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 CG_TeamScoreboard
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+ADDRLP4 36
+INDIRI4
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+ADDRGP4 $417
+JUMPV
+LABELV $416
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 CG_TeamScoreboard
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+ADDRLP4 36
+INDIRI4
+ADDRLP4 24
+INDIRI4
+MULI4
+CNSTI4 8
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 4+12
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 88
+ADDRGP4 CG_TeamScoreboard
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+ADDRLP4 60
+INDIRI4
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+LABELV $417
+ADDRLP4 80
+ADDRGP4 cg+16
+ASGNP4
+ADDRLP4 84
+ADDRLP4 80
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 10
+LEI4 $434
+ADDRGP4 CG_LoadDeferredPlayers
+CALLV
+pop
+LABELV $434
+CNSTI4 1
+RETI4
+LABELV $235
+endproc CG_DrawOldScoreboard 148 36
+proc CG_CenterGiantLine 32 36
+ADDRLP4 20
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+CNSTF4 1056964608
+CNSTI4 640
+ADDRLP4 24
+INDIRI4
+CNSTI4 5
+LSHI4
+SUBI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+CNSTI4 48
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $437
+endproc CG_CenterGiantLine 32 36
+export CG_DrawOldTourneyScoreboard
+proc CG_DrawOldTourneyScoreboard 112 36
+ADDRGP4 cg+112100
+INDIRI4
+CNSTI4 2000
+ADDI4
+ADDRGP4 cg+107612
+INDIRI4
+GEI4 $442
+ADDRGP4 cg+112100
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRGP4 $448
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $442
+ADDRLP4 44
+CNSTF4 0
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 8+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+CNSTF4 1139802112
+ARGF4
+ADDRLP4 8
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 52
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 8
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 8+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 8+12
+CNSTF4 1065353216
+ASGNF4
+CNSTI4 4
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $455
+ADDRLP4 4
+ADDRGP4 $457
+ASGNP4
+LABELV $455
+CNSTF4 1090519040
+ARGF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CenterGiantLine
+CALLV
+pop
+ADDRLP4 32
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 64
+CNSTI4 60
+ASGNI4
+ADDRLP4 36
+ADDRLP4 32
+INDIRI4
+ADDRLP4 64
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+ADDRLP4 64
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 72
+CNSTI4 10
+ASGNI4
+ADDRLP4 40
+ADDRLP4 32
+INDIRI4
+ADDRLP4 72
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+ADDRLP4 72
+INDIRI4
+MODI4
+ASGNI4
+ADDRGP4 $459
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 76
+INDIRP4
+ASGNP4
+CNSTF4 1115684864
+ARGF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CenterGiantLine
+CALLV
+pop
+ADDRLP4 24
+CNSTI4 160
+ASGNI4
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 5
+LTI4 $460
+CNSTI4 8
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRGP4 $463
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 80
+CNSTI4 1
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+CNSTI4 48
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 $109
+ARGP4
+ADDRGP4 cg+112112
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+CNSTU4 632
+ADDRLP4 88
+INDIRU4
+CNSTI4 5
+LSHU4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 92
+CNSTI4 1
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+CNSTI4 48
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 64
+ADDI4
+ASGNI4
+CNSTI4 8
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRGP4 $465
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 96
+CNSTI4 1
+ASGNI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+CNSTI4 48
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 $109
+ARGP4
+ADDRGP4 cg+112112+4
+INDIRI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 100
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+CNSTU4 632
+ADDRLP4 104
+INDIRU4
+CNSTI4 5
+LSHU4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 108
+CNSTI4 1
+ASGNI4
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+CNSTI4 48
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 $461
+JUMPV
+LABELV $460
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+LABELV $468
+ADDRLP4 0
+CNSTI4 1836
+ADDRLP4 28
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $473
+ADDRGP4 $469
+JUMPV
+LABELV $473
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $475
+ADDRGP4 $469
+JUMPV
+LABELV $475
+CNSTI4 8
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 80
+CNSTI4 1
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+CNSTI4 48
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 $109
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+CNSTU4 632
+ADDRLP4 88
+INDIRU4
+CNSTI4 5
+LSHU4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 92
+CNSTI4 1
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+CNSTI4 48
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 64
+ADDI4
+ASGNI4
+LABELV $469
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 64
+LTI4 $468
+LABELV $461
+LABELV $441
+endproc CG_DrawOldTourneyScoreboard 112 36
+bss
+align 4
+LABELV localClient
+skip 4
+import CG_AddBoundingBox
+import CG_AddBoundingBoxEntity
+import CG_QueryCvar
+import CG_Timestamp
+import CG_LimitCvars
+import trap_RealTime
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import trap_R_inPVS
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_Cutscene2d_Draw
+import CG_Cutscene2d_UpdateTrans
+import CG_Cutscene2d_CheckCmd
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import Main_SpriteParticles
+import LaunchRevivalParticle
+import LaunchSpeedyPuffTrail
+import Init_SpriteParticles
+import AddLFsToScreen
+import AddLFToDrawList
+import Init_LensFlareSys
+import DumpPolyInfo
+import ActiveChooseLogoMenu
+import FindLogoForSpraying
+import Add_LogoToDrawList
+import AddLogosToScene
+import Init_SprayLogoSys
+import Calculate_2DOfDIR
+import Calculate_2DOf3D
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_ChangeLoadingProgress
+import CG_LoadingString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_ScorePlum
+import CG_TeleOutEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_GenerateParticles
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_PortalInView
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_GetWaterMuzzle
+import CG_SprayTrail
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponSRWC
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_Boomies_Explosion
+import CG_BamBam_Explosion
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_LerpTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayer
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_UpdateVoipTeamIDs
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Draw3DModel
+import CG_SetPrintString
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import CG_MessagePrint
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_WorldToScreen
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_DrawPic1024
+import CG_DrawRect1024
+import CG_FillRect1024
+import CG_AdjustFrom1024
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddPolyBatched
+import CG_AddRefEntityBatched
+import CG_FlushSceneBatches
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_ForceModelChange
+import CG_GetCvarFloat
+import CG_GetCvarInt
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StreamAssets
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_icons
+import cg_ambient
+import cg_drawBBox
+import cg_drawVoiceNames
+import cg_drawLensflare
+import cg_timestamps
+import cg_skyLensflare
+import cg_sky
+import cg_curWarmupReady
+import cg_warmupReady
+import cg_glowModelTeam
+import cg_glowModel
+import cg_cineDrawLetterBox
+import cg_cineHideHud
+import cg_LPSwallhackAlpha
+import cg_LPSwallhackSize
+import cg_bigScoreType
+import cg_thirdPersonAutoSwitch
+import cg_drawTimeLeft
+import cg_drawServerInfos
+import cg_drawMessages
+import cg_drawups
+import cg_wopFFAhud
+import cg_printDir
+import cg_drawRealTime
+import cg_correctedWeaponPos
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_streamAssets
+import cg_deferPlayers
+import cg_predictItems
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_chatBeep
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_optimizePrediction
+import cg_nopredict
+import cg_errorDecay
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import trailEnt
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $465
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $463
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $459
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $457
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $448
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $310
+byte 1 94
+byte 1 52
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 94
+byte 1 48
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 52
+byte 1 37
+byte 1 105
+byte 1 94
+byte 1 48
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 94
+byte 1 49
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $306
+byte 1 94
+byte 1 49
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 94
+byte 1 48
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 49
+byte 1 37
+byte 1 105
+byte 1 94
+byte 1 48
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 94
+byte 1 52
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $299
+byte 1 94
+byte 1 48
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $291
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 48
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $289
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 48
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 76
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $286
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 48
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 38
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 76
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $269
+byte 1 94
+byte 1 48
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $225
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 0
+align 1
+LABELV $187
+byte 1 82
+byte 1 69
+byte 1 65
+byte 1 68
+byte 1 89
+byte 1 0
+align 1
+LABELV $139
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 52
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 52
+byte 1 105
+byte 1 0
+align 1
+LABELV $135
+byte 1 37
+byte 1 53
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 52
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 52
+byte 1 105
+byte 1 0
+align 1
+LABELV $134
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 47
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 52
+byte 1 105
+byte 1 0
+align 1
+LABELV $127
+byte 1 32
+byte 1 83
+byte 1 80
+byte 1 69
+byte 1 67
+byte 1 84
+byte 1 32
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 52
+byte 1 105
+byte 1 0
+align 1
+LABELV $124
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $116
+byte 1 37
+byte 1 105
+byte 1 47
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $109
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $85
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 45
+byte 1 62
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
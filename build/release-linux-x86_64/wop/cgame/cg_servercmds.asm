@@ -0,0 +1,5175 @@
+code
+proc CG_ParseScoreRow 152 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $83
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $81
+LABELV $83
+CNSTI4 -1
+RETI4
+ADDRGP4 $80
+JUMPV
+LABELV $81
+ADDRLP4 0
+CNSTI4 72
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+116728
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+ADDI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 5
+ADDI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 6
+ADDI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 7
+ADDI4
+ARGI4
+ADDRLP4 72
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 8
+ADDI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 9
+ADDI4
+ARGI4
+ADDRLP4 88
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 10
+ADDI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 11
+ADDI4
+ARGI4
+ADDRLP4 104
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 12
+ADDI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRLP4 116
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 13
+ADDI4
+ARGI4
+ADDRLP4 120
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ARGP4
+ADDRLP4 124
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 124
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 14
+ADDI4
+ARGI4
+ADDRLP4 128
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 15
+ADDI4
+ARGI4
+ADDRLP4 136
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 16
+ADDI4
+ARGI4
+ADDRLP4 144
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $80
+endproc CG_ParseScoreRow 152 4
+proc CG_SetScore 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 72
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+112120
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+116728
+ADDP4
+INDIRB
+ASGNB 72
+CNSTI4 72
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+112120
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+CNSTI4 1836
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+168
+ADDP4
+CNSTI4 72
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+112120+4
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 1836
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+208
+ADDP4
+CNSTI4 72
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+112120+20
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 72
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+112120+68
+ADDP4
+CNSTI4 1836
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 72
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+112120+68
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $101
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+112120+68
+ADDP4
+INDIRI4
+CNSTI4 3
+GTI4 $101
+ADDRLP4 8
+CNSTI4 72
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+112120+68
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+112084
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $101
+LABELV $85
+endproc CG_SetScore 12 0
+proc CG_ParseScores 36 12
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+112104
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 cg+112104
+INDIRI4
+CNSTI4 64
+LEI4 $112
+ADDRGP4 cg+112104
+CNSTI4 64
+ASGNI4
+LABELV $112
+ADDRGP4 cg+112084
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 16
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+112112
+ADDRLP4 20
+INDIRI4
+ASGNI4
+CNSTI4 3
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+112112+4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 cg+112120
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 4608
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $126
+JUMPV
+LABELV $123
+CNSTI4 17
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_ParseScoreRow
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $128
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $128
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScore
+CALLV
+pop
+LABELV $124
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $126
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+112104
+INDIRI4
+LTI4 $123
+ADDRGP4 cg+121336
+CNSTI4 1
+ASGNI4
+LABELV $110
+endproc CG_ParseScores 36 12
+proc CG_HexDigit 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+ADDRFP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+LTI4 $132
+ADDRLP4 0
+INDIRI4
+CNSTI4 57
+GTI4 $132
+ADDRFP4 0
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+RETI4
+ADDRGP4 $131
+JUMPV
+LABELV $132
+ADDRLP4 4
+ADDRFP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 97
+LTI4 $134
+ADDRLP4 4
+INDIRI4
+CNSTI4 102
+GTI4 $134
+ADDRFP4 0
+INDIRI1
+CVII4 1
+CNSTI4 97
+SUBI4
+CNSTI4 10
+ADDI4
+RETI4
+ADDRGP4 $131
+JUMPV
+LABELV $134
+CNSTI4 0
+RETI4
+LABELV $131
+endproc CG_HexDigit 8 0
+proc CG_ParseScoreDelta 72 12
+ADDRGP4 cg+121336
+INDIRI4
+CNSTI4 0
+NEI4 $137
+ADDRGP4 cg+112100
+INDIRI4
+CNSTI4 2000
+ADDI4
+ADDRGP4 cg+107612
+INDIRI4
+GEI4 $136
+ADDRGP4 cg+112100
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRGP4 $146
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+ADDRGP4 $136
+JUMPV
+LABELV $137
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+112112
+ADDRLP4 20
+INDIRI4
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+112112+4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+CNSTI4 3
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+112104
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 cg+112104
+INDIRI4
+CNSTI4 64
+LEI4 $151
+ADDRGP4 cg+112104
+CNSTI4 64
+ASGNI4
+LABELV $151
+CNSTI4 5
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $158
+JUMPV
+LABELV $155
+CNSTI4 17
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 6
+ADDI4
+ARGI4
+ADDRGP4 CG_ParseScoreRow
+CALLI4
+pop
+LABELV $156
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $158
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+GEI4 $159
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $155
+LABELV $159
+CNSTI4 4
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 56
+INDIRU4
+CVUI4 4
+ADDRGP4 cg+112104
+INDIRI4
+CNSTI4 1
+LSHI4
+GEI4 $160
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRGP4 cg+112104
+ADDRLP4 60
+INDIRU4
+CNSTI4 1
+RSHU4
+CVUI4 4
+ASGNI4
+LABELV $160
+ADDRGP4 cg+112084
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 16
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg+112120
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 4608
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $171
+JUMPV
+LABELV $168
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 60
+ADDRGP4 CG_HexDigit
+CALLI4
+ASGNI4
+ADDRLP4 64
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 64
+INDIRI4
+LSHI4
+ADDRLP4 64
+INDIRI4
+ADDI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_HexDigit
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 60
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRLP4 68
+INDIRI4
+BORI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $173
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $173
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScore
+CALLV
+pop
+LABELV $169
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $171
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+112104
+INDIRI4
+LTI4 $168
+LABELV $136
+endproc CG_ParseScoreDelta 72 12
+proc CG_ParseTeamInfo 84 8
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 numSortedTeamPlayers
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+LTI4 $178
+ADDRLP4 20
+INDIRI4
+CNSTI4 32
+LEI4 $176
+LABELV $178
+ADDRGP4 $179
+ARGP4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $175
+JUMPV
+LABELV $176
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $183
+JUMPV
+LABELV $180
+ADDRLP4 4
+CNSTI4 7
+ADDRLP4 8
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $186
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $184
+LABELV $186
+ADDRGP4 $187
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $175
+JUMPV
+LABELV $184
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+ADDI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 1836
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+172
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 1836
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+176
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+ADDI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 1836
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+180
+ADDP4
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 6
+ADDI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 1836
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+184
+ADDP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 7
+ADDI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 1836
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+208
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+ADDI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 1836
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+188
+ADDP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+LABELV $181
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $183
+ADDRLP4 8
+INDIRI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+LTI4 $180
+LABELV $175
+endproc CG_ParseTeamInfo 84 8
+export CG_ParseServerinfo
+proc CG_ParseServerinfo 92 16
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $202
+ARGP4
+ADDRLP4 12
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31464
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $203
+ARGP4
+ADDRGP4 cgs+31464
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $202
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $206
+ARGP4
+ADDRLP4 24
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31468
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $208
+ARGP4
+ADDRLP4 32
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31472
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $211
+ARGP4
+ADDRLP4 40
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31480
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31476
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $213
+ARGP4
+ADDRLP4 48
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 cgs+31684
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $215
+ARGP4
+ADDRLP4 52
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 cgs+31748
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $217
+ARGP4
+ADDRLP4 56
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31780
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 64
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31784
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $221
+ARGP4
+ADDRLP4 72
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31484
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $223
+ARGP4
+ADDRLP4 80
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31488
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $213
+ARGP4
+ADDRLP4 88
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 88
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+31492
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $226
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $200
+endproc CG_ParseServerinfo 92 16
+proc CG_ParseWarmup 24 4
+CNSTI4 5
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 cg+131796
+CNSTI4 -1
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $229
+ADDRGP4 cg+131792
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $229
+ADDRGP4 $230
+JUMPV
+LABELV $229
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LEI4 $232
+ADDRGP4 cg+131792
+INDIRI4
+ADDRLP4 20
+INDIRI4
+GTI4 $232
+LABELV $232
+LABELV $230
+ADDRGP4 cg+131792
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $227
+endproc CG_ParseWarmup 24 4
+export CG_SetConfigValues
+proc CG_SetConfigValues 40 12
+CNSTI4 6
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34912
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 7
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34916
+ADDRLP4 16
+INDIRI4
+ASGNI4
+CNSTI4 26
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRGP4 cgs+34932
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 21
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34908
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 6
+NEI4 $242
+CNSTI4 23
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+34920
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRGP4 cgs+34924
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+LABELV $242
+CNSTI4 5
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+131792
+ADDRLP4 36
+INDIRI4
+ASGNI4
+LABELV $236
+endproc CG_SetConfigValues 40 12
+export CG_ShaderStateChanged
+proc CG_ShaderStateChanged 188 12
+CNSTI4 24
+ARGI4
+ADDRLP4 156
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRGP4 $250
+JUMPV
+LABELV $249
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $252
+ARGP4
+ADDRLP4 160
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 160
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $251
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $251
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CVIU4 4
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ADDRLP4 12
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $255
+ARGP4
+ADDRLP4 172
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 172
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $251
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $251
+ADDRLP4 76
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CVIU4 4
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ADDRLP4 76
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $257
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $258
+ARGP4
+ADDRLP4 180
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 180
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $254
+ADDRLP4 140
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CVIU4 4
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ADDRLP4 140
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRGP4 trap_R_RemapShader
+CALLV
+pop
+LABELV $254
+LABELV $250
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $261
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $249
+LABELV $261
+LABELV $251
+LABELV $248
+endproc CG_ShaderStateChanged 188 12
+export CG_UpdateBalloonStates
+proc CG_UpdateBalloonStates 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $263
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $268
+JUMPV
+LABELV $265
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+EQI4 $269
+ADDRLP4 4
+CNSTI1 48
+ASGNI1
+ADDRGP4 $267
+JUMPV
+LABELV $269
+LABELV $266
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $268
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+GEI4 $271
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $265
+LABELV $271
+LABELV $267
+ADDRLP4 12
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 49
+EQI4 $274
+ADDRLP4 12
+INDIRI4
+CNSTI4 50
+NEI4 $272
+LABELV $274
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 49
+NEI4 $275
+ADDRGP4 cgs+160652+1468
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $276
+JUMPV
+LABELV $275
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 50
+NEI4 $279
+ADDRGP4 cgs+160652+1472
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $279
+LABELV $276
+ADDRGP4 cgs+34932
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $262
+JUMPV
+LABELV $272
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $288
+JUMPV
+LABELV $285
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+34932
+ADDP4
+INDIRI1
+CVII4 1
+EQI4 $290
+ADDRLP4 20
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 48
+EQI4 $296
+ADDRLP4 20
+INDIRI4
+CNSTI4 49
+EQI4 $299
+ADDRLP4 20
+INDIRI4
+CNSTI4 50
+EQI4 $302
+ADDRGP4 $294
+JUMPV
+LABELV $296
+ADDRGP4 cgs+160652+1476
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $294
+JUMPV
+LABELV $299
+ADDRGP4 cgs+160652+1460
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $294
+JUMPV
+LABELV $302
+ADDRGP4 cgs+160652+1464
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+LABELV $294
+LABELV $290
+LABELV $286
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $288
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+GEI4 $306
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 20
+INDIRI4
+EQI4 $306
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+34932
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 20
+INDIRI4
+NEI4 $285
+LABELV $306
+LABELV $263
+ADDRGP4 cgs+34932
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $262
+endproc CG_UpdateBalloonStates 28 12
+proc CG_ConfigStringModified 48 12
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 cgs
+ARGP4
+ADDRGP4 trap_GetGameState
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $310
+ADDRGP4 CG_StartMusic
+CALLV
+pop
+ADDRGP4 $311
+JUMPV
+LABELV $310
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $312
+ADDRGP4 CG_ParseServerinfo
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $312
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+NEI4 $314
+ADDRGP4 CG_ParseWarmup
+CALLV
+pop
+ADDRGP4 $315
+JUMPV
+LABELV $314
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+NEI4 $316
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34912
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $317
+JUMPV
+LABELV $316
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+NEI4 $319
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34916
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $320
+JUMPV
+LABELV $319
+ADDRLP4 0
+INDIRI4
+CNSTI4 26
+NEI4 $322
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_UpdateBalloonStates
+CALLV
+pop
+ADDRGP4 $323
+JUMPV
+LABELV $322
+ADDRLP4 0
+INDIRI4
+CNSTI4 21
+NEI4 $324
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34908
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $325
+JUMPV
+LABELV $324
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+NEI4 $327
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31788
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31800
+CNSTI4 1
+ASGNI4
+ADDRGP4 $328
+JUMPV
+LABELV $327
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $331
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31792
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31800
+CNSTI4 1
+ASGNI4
+ADDRGP4 $332
+JUMPV
+LABELV $331
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+NEI4 $335
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31796
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31800
+CNSTI4 1
+ASGNI4
+ADDRGP4 $336
+JUMPV
+LABELV $335
+ADDRLP4 0
+INDIRI4
+CNSTI4 9
+NEI4 $339
+ADDRGP4 cgs+31804
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $340
+JUMPV
+LABELV $339
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $343
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+GTI4 $343
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32828-48
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32852-48
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $344
+JUMPV
+LABELV $343
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $349
+ADDRLP4 0
+INDIRI4
+CNSTI4 17
+GTI4 $349
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32836-64
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32852-64
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $350
+JUMPV
+LABELV $349
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+LTI4 $355
+ADDRLP4 0
+INDIRI4
+CNSTI4 19
+GTI4 $355
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32844-72
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32852-72
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $356
+JUMPV
+LABELV $355
+ADDRLP4 0
+INDIRI4
+CNSTI4 14
+LTI4 $361
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+GTI4 $361
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 cgs+32860-14336
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $362
+JUMPV
+LABELV $361
+ADDRLP4 0
+INDIRI4
+CNSTI4 22
+NEI4 $366
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+32
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $367
+JUMPV
+LABELV $366
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $369
+ADDRLP4 0
+INDIRI4
+CNSTI4 288
+GEI4 $369
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+34940-128
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $370
+JUMPV
+LABELV $369
+ADDRLP4 0
+INDIRI4
+CNSTI4 288
+LTI4 $373
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+GEI4 $373
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+EQI4 $374
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 44
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+35964-1152
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 $374
+JUMPV
+LABELV $373
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+LTI4 $379
+ADDRLP4 0
+INDIRI4
+CNSTI4 608
+GEI4 $379
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+SUBI4
+ARGI4
+ADDRGP4 CG_NewClientInfo
+CALLV
+pop
+ADDRGP4 CG_BuildSpectatorString
+CALLV
+pop
+ADDRGP4 $380
+JUMPV
+LABELV $379
+ADDRLP4 0
+INDIRI4
+CNSTI4 23
+NEI4 $381
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 6
+NEI4 $382
+ADDRGP4 cgs+34920
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRGP4 cgs+34924
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRGP4 $382
+JUMPV
+LABELV $381
+ADDRLP4 0
+INDIRI4
+CNSTI4 24
+NEI4 $388
+ADDRGP4 CG_ShaderStateChanged
+CALLV
+pop
+LABELV $388
+LABELV $382
+LABELV $380
+LABELV $374
+LABELV $370
+LABELV $367
+LABELV $362
+LABELV $356
+LABELV $350
+LABELV $344
+LABELV $340
+LABELV $336
+LABELV $332
+LABELV $328
+LABELV $325
+LABELV $323
+LABELV $320
+LABELV $317
+LABELV $315
+LABELV $313
+LABELV $311
+LABELV $309
+endproc CG_ConfigStringModified 48 12
+proc CG_AddToTeamChat 52 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_teamChatHeight+12
+INDIRI4
+CNSTI4 8
+GEI4 $391
+ADDRLP4 12
+ADDRGP4 cg_teamChatHeight+12
+INDIRI4
+ASGNI4
+ADDRGP4 $392
+JUMPV
+LABELV $391
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+LABELV $392
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LEI4 $398
+ADDRGP4 cg_teamChatTime+12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+GTI4 $395
+LABELV $398
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+160556
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+160552
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $390
+JUMPV
+LABELV $395
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 241
+ADDRGP4 cgs+160552
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MODI4
+MULI4
+ADDRGP4 cgs+158592
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 16
+CNSTI4 55
+ASGNI4
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRGP4 $404
+JUMPV
+LABELV $403
+ADDRLP4 4
+INDIRI4
+CNSTI4 79
+LEI4 $406
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $408
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+SUBP4
+ASGNP4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+SUBP4
+ASGNP4
+LABELV $408
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 cgs+160552
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160520
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRGP4 cgs+160552
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 241
+ADDRGP4 cgs+160552
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MODI4
+MULI4
+ADDRGP4 cgs+158592
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CNSTI1 94
+ASGNI1
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 16
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+LABELV $406
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_IsColorString
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $416
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 32
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 48
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 40
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 44
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $404
+JUMPV
+LABELV $416
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+NEI4 $418
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $418
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 32
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $404
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $403
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 cgs+160552
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160520
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRGP4 cgs+160552
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 cgs+160552
+INDIRI4
+ADDRGP4 cgs+160556
+INDIRI4
+SUBI4
+ADDRLP4 12
+INDIRI4
+LEI4 $424
+ADDRGP4 cgs+160556
+ADDRGP4 cgs+160552
+INDIRI4
+ADDRLP4 12
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $424
+LABELV $390
+endproc CG_AddToTeamChat 52 4
+proc CG_RestartUIMusic 0 4
+ADDRGP4 $431
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $430
+endproc CG_RestartUIMusic 0 4
+proc CG_MapRestart 0 8
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $433
+ADDRGP4 $436
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $433
+ADDRGP4 CG_InitLocalEntities
+CALLV
+pop
+ADDRGP4 CG_InitMarkPolys
+CALLV
+pop
+ADDRGP4 CG_ClearParticles
+CALLV
+pop
+ADDRGP4 Init_SprayLogoSys
+CALLV
+pop
+ADDRGP4 Init_SpriteParticles
+CALLV
+pop
+ADDRGP4 cg+107632
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+107628
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+131576
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+131572
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+32
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+31788
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+108592
+CNSTI4 1
+ASGNI4
+ADDRGP4 CG_StartMusic
+CALLV
+pop
+ADDRGP4 CG_RestartUIMusic
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_S_ClearLoopingSounds
+CALLV
+pop
+ADDRGP4 cg+131792
+INDIRI4
+CNSTI4 0
+NEI4 $445
+ADDRGP4 cgs+160652+1736
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $445
+ADDRGP4 $450
+ARGP4
+ADDRGP4 $451
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $432
+endproc CG_MapRestart 0 8
+proc CG_RemoveChatEscapeChar 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $456
+JUMPV
+LABELV $453
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 25
+NEI4 $457
+ADDRGP4 $454
+JUMPV
+LABELV $457
+ADDRLP4 12
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $454
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $456
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $453
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $452
+endproc CG_RemoveChatEscapeChar 20 0
+proc CG_ServerCommand 312 12
+CNSTI4 0
+ARGI4
+ADDRLP4 164
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $460
+ADDRGP4 $459
+JUMPV
+LABELV $460
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $464
+ARGP4
+ADDRLP4 168
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+NEI4 $462
+CNSTI4 1
+ARGI4
+ADDRLP4 172
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+CNSTI4 144
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 $459
+JUMPV
+LABELV $462
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $467
+ARGP4
+ADDRLP4 172
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+NEI4 $465
+CNSTI4 1
+ARGI4
+ADDRLP4 176
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRGP4 CG_MessagePrint
+CALLV
+pop
+ADDRGP4 $459
+JUMPV
+LABELV $465
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $470
+ARGP4
+ADDRLP4 176
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+NEI4 $468
+ADDRGP4 CG_ConfigStringModified
+CALLV
+pop
+ADDRGP4 $459
+JUMPV
+LABELV $468
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $473
+ARGP4
+ADDRLP4 180
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+NEI4 $471
+CNSTI4 1
+ARGI4
+ADDRLP4 184
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $474
+ARGP4
+ADDRLP4 184
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $459
+JUMPV
+LABELV $471
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $477
+ARGP4
+ADDRLP4 184
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+NEI4 $475
+CNSTI4 1
+ARGI4
+ADDRLP4 192
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 192
+INDIRP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 188
+ADDRLP4 196
+INDIRI4
+ASGNI4
+ADDRLP4 200
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_teamChatsOnly+12
+INDIRI4
+ADDRLP4 200
+INDIRI4
+EQI4 $478
+ADDRLP4 188
+INDIRI4
+ADDRLP4 200
+INDIRI4
+NEI4 $478
+ADDRGP4 $459
+JUMPV
+LABELV $478
+ADDRLP4 204
+ADDRLP4 188
+INDIRI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 0
+EQI4 $483
+ADDRLP4 204
+INDIRI4
+CNSTI4 1
+EQI4 $489
+ADDRLP4 204
+INDIRI4
+CNSTI4 2
+EQI4 $495
+ADDRGP4 $481
+JUMPV
+LABELV $483
+ADDRGP4 cg_chatBeep+12
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $482
+ADDRGP4 cgs+160652+1356
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $482
+JUMPV
+LABELV $489
+ADDRGP4 cg_chatBeep+12
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $482
+ADDRGP4 cgs+160652+1356
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $482
+JUMPV
+LABELV $495
+ADDRGP4 cg_chatBeep+12
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $482
+ADDRGP4 cgs+160652+1356
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $482
+JUMPV
+LABELV $481
+ADDRGP4 $501
+ARGP4
+ADDRLP4 188
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $459
+JUMPV
+LABELV $482
+CNSTI4 3
+ARGI4
+ADDRLP4 208
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 208
+INDIRP4
+ARGP4
+CNSTI4 150
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRGP4 CG_RemoveChatEscapeChar
+CALLV
+pop
+ADDRLP4 188
+INDIRI4
+CNSTI4 1
+NEI4 $502
+ADDRLP4 8
+ARGP4
+ADDRGP4 CG_AddToTeamChat
+CALLV
+pop
+LABELV $502
+ADDRGP4 $504
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 212
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 212
+INDIRP4
+ARGP4
+ADDRLP4 216
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 216
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $505
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+31488
+INDIRI4
+GEI4 $505
+ADDRGP4 cg+108572
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+108540
+ADDP4
+CNSTI4 1836
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+548
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $459
+JUMPV
+LABELV $505
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+NEI4 $459
+ADDRGP4 cg+108572
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+108540
+ADDP4
+ADDRGP4 cgs+160652+104
+INDIRI4
+ASGNI4
+ADDRGP4 $459
+JUMPV
+LABELV $475
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $520
+ARGP4
+ADDRLP4 188
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+NEI4 $518
+ADDRGP4 CG_ParseScores
+CALLV
+pop
+ADDRGP4 $459
+JUMPV
+LABELV $518
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $523
+ARGP4
+ADDRLP4 192
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+NEI4 $521
+ADDRGP4 CG_ParseScoreDelta
+CALLV
+pop
+ADDRGP4 $459
+JUMPV
+LABELV $521
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $526
+ARGP4
+ADDRLP4 196
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+NEI4 $524
+ADDRGP4 CG_ParseTeamInfo
+CALLV
+pop
+ADDRGP4 $459
+JUMPV
+LABELV $524
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $529
+ARGP4
+ADDRLP4 200
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+NEI4 $527
+ADDRGP4 CG_MapRestart
+CALLV
+pop
+ADDRGP4 $459
+JUMPV
+LABELV $527
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $532
+ARGP4
+ADDRLP4 204
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 0
+NEI4 $530
+ADDRGP4 CG_LoadDeferredPlayers
+CALLV
+pop
+ADDRGP4 $459
+JUMPV
+LABELV $530
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $535
+ARGP4
+ADDRLP4 208
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+NEI4 $533
+ADDRGP4 cg+12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $459
+JUMPV
+LABELV $533
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $539
+ARGP4
+ADDRLP4 212
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 0
+NEI4 $537
+CNSTI4 1
+ARGI4
+ADDRLP4 216
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 216
+INDIRP4
+ARGP4
+ADDRLP4 220
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 220
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_WeaponSRWC
+CALLV
+pop
+ADDRGP4 $459
+JUMPV
+LABELV $537
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $542
+ARGP4
+ADDRLP4 216
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 216
+INDIRI4
+CNSTI4 0
+NEI4 $540
+CNSTI4 1
+ARGI4
+ADDRLP4 220
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 220
+INDIRP4
+ARGP4
+ADDRLP4 224
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 224
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $459
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+GTI4 $459
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $567
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $567
+address $545
+address $548
+address $551
+address $556
+code
+LABELV $545
+ADDRLP4 232
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 160
+CNSTF4 1073740985
+ADDRLP4 232
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+1448
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $459
+JUMPV
+LABELV $548
+CNSTI4 2
+ARGI4
+ADDRLP4 236
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+ADDRLP4 240
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 160
+ADDRLP4 240
+INDIRI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+1492
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $459
+JUMPV
+LABELV $551
+ADDRGP4 cgs+160652+1520
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 cgs+160652+1520
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $459
+JUMPV
+LABELV $556
+ADDRGP4 $557
+ARGP4
+ADDRLP4 244
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 244
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $558
+ADDRGP4 $560
+ARGP4
+ADDRLP4 244
+ARGP4
+ADDRLP4 308
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 308
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+ADDRGP4 $559
+JUMPV
+LABELV $558
+ADDRGP4 $561
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $559
+ADDRGP4 cg+107636
+INDIRI4
+CNSTI4 0
+EQI4 $459
+ADDRGP4 $565
+ARGP4
+ADDRGP4 $451
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 cg+107636
+CNSTI4 0
+ASGNI4
+ADDRGP4 $459
+JUMPV
+LABELV $540
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $570
+ARGP4
+ADDRLP4 220
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 220
+INDIRI4
+CNSTI4 0
+NEI4 $568
+ADDRGP4 CG_QueryCvar
+CALLV
+pop
+ADDRGP4 $459
+JUMPV
+LABELV $568
+ADDRGP4 $571
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $459
+endproc CG_ServerCommand 312 12
+export CG_ExecuteNewServerCommands
+proc CG_ExecuteNewServerCommands 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $574
+JUMPV
+LABELV $573
+ADDRLP4 0
+ADDRGP4 cgs+31452
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_GetServerCommand
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $577
+ADDRGP4 CG_ServerCommand
+CALLV
+pop
+LABELV $577
+LABELV $574
+ADDRGP4 cgs+31452
+INDIRI4
+ADDRFP4 0
+INDIRI4
+LTI4 $573
+LABELV $572
+endproc CG_ExecuteNewServerCommands 12 4
+import CG_AddBoundingBox
+import CG_AddBoundingBoxEntity
+import CG_QueryCvar
+import CG_Timestamp
+import CG_LimitCvars
+import trap_RealTime
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import trap_R_inPVS
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_Cutscene2d_Draw
+import CG_Cutscene2d_UpdateTrans
+import CG_Cutscene2d_CheckCmd
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import Main_SpriteParticles
+import LaunchRevivalParticle
+import LaunchSpeedyPuffTrail
+import Init_SpriteParticles
+import AddLFsToScreen
+import AddLFToDrawList
+import Init_LensFlareSys
+import DumpPolyInfo
+import ActiveChooseLogoMenu
+import FindLogoForSpraying
+import Add_LogoToDrawList
+import AddLogosToScene
+import Init_SprayLogoSys
+import Calculate_2DOfDIR
+import Calculate_2DOf3D
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_ChangeLoadingProgress
+import CG_LoadingString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_ScorePlum
+import CG_TeleOutEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_GenerateParticles
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_PortalInView
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_GetWaterMuzzle
+import CG_SprayTrail
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponSRWC
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_Boomies_Explosion
+import CG_BamBam_Explosion
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_LerpTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayer
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_UpdateVoipTeamIDs
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Draw3DModel
+import CG_SetPrintString
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import CG_MessagePrint
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_WorldToScreen
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_DrawPic1024
+import CG_DrawRect1024
+import CG_FillRect1024
+import CG_AdjustFrom1024
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddPolyBatched
+import CG_AddRefEntityBatched
+import CG_FlushSceneBatches
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_ForceModelChange
+import CG_GetCvarFloat
+import CG_GetCvarInt
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StreamAssets
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_icons
+import cg_ambient
+import cg_drawBBox
+import cg_drawVoiceNames
+import cg_drawLensflare
+import cg_timestamps
+import cg_skyLensflare
+import cg_sky
+import cg_curWarmupReady
+import cg_warmupReady
+import cg_glowModelTeam
+import cg_glowModel
+import cg_cineDrawLetterBox
+import cg_cineHideHud
+import cg_LPSwallhackAlpha
+import cg_LPSwallhackSize
+import cg_bigScoreType
+import cg_thirdPersonAutoSwitch
+import cg_drawTimeLeft
+import cg_drawServerInfos
+import cg_drawMessages
+import cg_drawups
+import cg_wopFFAhud
+import cg_printDir
+import cg_drawRealTime
+import cg_correctedWeaponPos
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_streamAssets
+import cg_deferPlayers
+import cg_predictItems
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_chatBeep
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_optimizePrediction
+import cg_nopredict
+import cg_errorDecay
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import trailEnt
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $571
+byte 1 85
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $570
+byte 1 113
+byte 1 99
+byte 1 0
+align 1
+LABELV $565
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $561
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 32
+byte 1 48
+byte 1 49
+byte 1 95
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 10
+byte 1 0
+align 1
+LABELV $560
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $557
+byte 1 115
+byte 1 121
+byte 1 99
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 0
+align 1
+LABELV $542
+byte 1 99
+byte 1 100
+byte 1 105
+byte 1 0
+align 1
+LABELV $539
+byte 1 115
+byte 1 114
+byte 1 119
+byte 1 99
+byte 1 0
+align 1
+LABELV $535
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 76
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $532
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $529
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $526
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 0
+align 1
+LABELV $523
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $520
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $504
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $501
+byte 1 85
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $477
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $474
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $473
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $470
+byte 1 99
+byte 1 115
+byte 1 0
+align 1
+LABELV $467
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $464
+byte 1 99
+byte 1 112
+byte 1 0
+align 1
+LABELV $451
+byte 1 48
+byte 1 0
+align 1
+LABELV $450
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $436
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $431
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 10
+byte 1 0
+align 1
+LABELV $258
+byte 1 64
+byte 1 0
+align 1
+LABELV $255
+byte 1 58
+byte 1 0
+align 1
+LABELV $252
+byte 1 61
+byte 1 0
+align 1
+LABELV $226
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 98
+byte 1 115
+byte 1 112
+byte 1 0
+align 1
+LABELV $223
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $221
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $219
+byte 1 103
+byte 1 95
+byte 1 76
+byte 1 80
+byte 1 83
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 108
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $217
+byte 1 103
+byte 1 95
+byte 1 76
+byte 1 80
+byte 1 83
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $215
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $213
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $211
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $208
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $206
+byte 1 100
+byte 1 109
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $203
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $202
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $187
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $179
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 83
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 0
+align 1
+LABELV $146
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
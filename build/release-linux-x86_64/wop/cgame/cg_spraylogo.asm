@@ -0,0 +1,5745 @@
+export PP2ID
+code
+proc PP2ID 4 0
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $83
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 logoPolys
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 308
+DIVI4
+ASGNI4
+ADDRGP4 $84
+JUMPV
+LABELV $83
+ADDRLP4 0
+CNSTI4 -1
+ASGNI4
+LABELV $84
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $81
+endproc PP2ID 4 0
+export DumpPolyInfo
+proc DumpPolyInfo 32 24
+ADDRGP4 $86
+ARGP4
+ADDRGP4 cg+107612
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $88
+ADDRLP4 0
+CNSTI4 308
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 logoPolys
+ADDP4
+ASGNP4
+ADDRGP4 $92
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 288
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $89
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 256
+LTI4 $88
+ADDRGP4 $93
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 freeLogoPolys
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PP2ID
+CALLI4
+ASGNI4
+ADDRGP4 $94
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 drawLogoPolys
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 PP2ID
+CALLI4
+ASGNI4
+ADDRGP4 $95
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 lastdrawLogoPolys
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 PP2ID
+CALLI4
+ASGNI4
+ADDRGP4 $96
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $97
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 drawLogoPolys
+INDIRP4
+ASGNP4
+ADDRGP4 $99
+JUMPV
+LABELV $98
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 PP2ID
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 PP2ID
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 PP2ID
+CALLI4
+ASGNI4
+ADDRGP4 $101
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $99
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $98
+ADDRGP4 $102
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 freeLogoPolys
+INDIRP4
+ASGNP4
+ADDRGP4 $104
+JUMPV
+LABELV $103
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 PP2ID
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 PP2ID
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 PP2ID
+CALLI4
+ASGNI4
+ADDRGP4 $106
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $104
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $103
+LABELV $85
+endproc DumpPolyInfo 32 24
+export Init_LogoPolyList
+proc Init_LogoPolyList 24 12
+ADDRGP4 logoPolys
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 78848
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRGP4 drawLogoPolys
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 lastdrawLogoPolys
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $108
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $114
+ADDRLP4 8
+CNSTI4 308
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 logoPolys-308
+ADDP4
+ASGNP4
+ADDRGP4 $115
+JUMPV
+LABELV $114
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+LABELV $115
+CNSTI4 308
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 logoPolys
+ADDP4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 255
+EQI4 $119
+ADDRLP4 16
+CNSTI4 308
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 logoPolys+308
+ADDP4
+ASGNP4
+ADDRGP4 $120
+JUMPV
+LABELV $119
+ADDRLP4 16
+CNSTP4 0
+ASGNP4
+LABELV $120
+CNSTI4 308
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 logoPolys+4
+ADDP4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+LABELV $109
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $108
+ADDRGP4 freeLogoPolys
+CNSTI4 308
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 logoPolys-308
+ADDP4
+ASGNP4
+LABELV $107
+endproc Init_LogoPolyList 24 12
+export Sort_Logos
+proc Sort_Logos 84 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $123
+ADDRGP4 $122
+JUMPV
+LABELV $123
+ADDRLP4 44
+ADDRFP4 4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRLP4 8
+ARGP4
+CNSTI4 36
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+CNSTU4 36
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 52
+CNSTI4 36
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 44
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+CNSTU4 36
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 36
+ADDRLP4 44
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTU4 36
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $128
+JUMPV
+LABELV $125
+ADDRLP4 64
+CNSTI4 36
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 64
+INDIRI4
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+GEI4 $129
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+ARGP4
+CNSTI4 36
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+CNSTU4 36
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 76
+CNSTI4 36
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+CNSTU4 36
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTU4 36
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $129
+LABELV $126
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $128
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LEI4 $125
+ADDRLP4 8
+ARGP4
+CNSTI4 36
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+CNSTU4 36
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 76
+CNSTI4 36
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+CNSTU4 36
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 36
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTU4 36
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRGP4 Sort_Logos
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Sort_Logos
+CALLV
+pop
+LABELV $122
+endproc Sort_Logos 84 12
+export Load_Logos
+proc Load_Logos 1320 16
+ADDRGP4 $132
+ARGP4
+ADDRLP4 268
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 268
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $133
+ADDRLP4 4
+ADDRLP4 268
+ASGNP4
+ADDRLP4 264
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $135
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 92
+ARGI4
+ADDRLP4 1292
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 260
+ADDRLP4 1292
+INDIRP4
+ASGNP4
+ADDRLP4 260
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $139
+ADDRGP4 $134
+JUMPV
+LABELV $139
+ADDRLP4 260
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 1296
+CNSTI4 1
+ASGNI4
+ADDRLP4 264
+ADDRLP4 264
+INDIRI4
+ADDRLP4 1296
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 260
+INDIRP4
+ADDRLP4 1296
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $136
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $135
+ADDRGP4 $134
+JUMPV
+LABELV $133
+ADDRLP4 264
+CNSTI4 0
+ASGNI4
+LABELV $134
+ADDRGP4 $144
+ARGP4
+ADDRLP4 1292
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+356
+ADDRLP4 1292
+INDIRI4
+ASGNI4
+ADDRLP4 1296
+CNSTI4 0
+ASGNI4
+ADDRGP4 loadedlogos
+ADDRLP4 1296
+INDIRI4
+ASGNI4
+ADDRGP4 loadedlogos_array
+ARGP4
+ADDRLP4 1296
+INDIRI4
+ARGI4
+CNSTU4 2304
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 264
+INDIRI4
+CNSTI4 64
+LEI4 $145
+ADDRLP4 264
+CNSTI4 64
+ASGNI4
+LABELV $145
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $150
+JUMPV
+LABELV $147
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 loadedlogos_array
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $151
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $153
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1308
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1308
+INDIRP4
+ARGP4
+ADDRLP4 1312
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 loadedlogos_array+32
+ADDP4
+ADDRLP4 1312
+INDIRI4
+ASGNI4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 loadedlogos_array+32
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $154
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 loadedlogos_array+32
+ADDP4
+ADDRGP4 cgs+160652+356
+INDIRI4
+ASGNI4
+LABELV $154
+ADDRLP4 1316
+ADDRGP4 loadedlogos
+ASGNP4
+ADDRLP4 1316
+INDIRP4
+ADDRLP4 1316
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $148
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $150
+ADDRLP4 0
+INDIRI4
+ADDRLP4 264
+INDIRI4
+LTI4 $147
+ADDRGP4 loadedlogos_array
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRGP4 Sort_Logos
+CALLV
+pop
+LABELV $131
+endproc Load_Logos 1320 16
+export Init_SprayLogoSys
+proc Init_SprayLogoSys 28 8
+ADDRGP4 $163
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+372
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $166
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+376
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $169
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+380
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $172
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+384
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $175
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+388
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $178
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+392
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 Load_Logos
+CALLV
+pop
+ADDRGP4 Init_LogoPolyList
+CALLV
+pop
+ADDRGP4 $179
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 24
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 menu_click_sound
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $160
+endproc Init_SprayLogoSys 28 8
+export Free_LogoPoly
+proc Free_LogoPoly 12 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $181
+ADDRGP4 $183
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $180
+JUMPV
+LABELV $181
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 drawLogoPolys
+INDIRP4
+CVPU4 4
+NEU4 $184
+ADDRGP4 drawLogoPolys
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $184
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 lastdrawLogoPolys
+INDIRP4
+CVPU4 4
+NEU4 $186
+ADDRGP4 lastdrawLogoPolys
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $186
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $188
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $188
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $190
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $190
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 308
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ADDRGP4 freeLogoPolys
+INDIRP4
+ASGNP4
+ADDRGP4 freeLogoPolys
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $192
+ADDRGP4 freeLogoPolys
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $192
+ADDRGP4 freeLogoPolys
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $180
+endproc Free_LogoPoly 12 12
+export Alloc_LogoPoly
+proc Alloc_LogoPoly 8 4
+ADDRGP4 freeLogoPolys
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $195
+ADDRLP4 0
+ADDRGP4 freeLogoPolys
+INDIRP4
+ASGNP4
+ADDRGP4 $196
+JUMPV
+LABELV $195
+ADDRGP4 drawLogoPolys
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $197
+ADDRGP4 $199
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $200
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $194
+JUMPV
+LABELV $197
+ADDRLP4 0
+ADDRGP4 drawLogoPolys
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Free_LogoPoly
+CALLV
+pop
+LABELV $196
+ADDRLP4 4
+ADDRGP4 freeLogoPolys
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $201
+ADDRGP4 freeLogoPolys
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $201
+ADDRLP4 0
+INDIRP4
+ADDRGP4 lastdrawLogoPolys
+INDIRP4
+ASGNP4
+ADDRGP4 lastdrawLogoPolys
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $203
+ADDRGP4 lastdrawLogoPolys
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $203
+ADDRGP4 lastdrawLogoPolys
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 drawLogoPolys
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $205
+ADDRGP4 drawLogoPolys
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $205
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $194
+endproc Alloc_LogoPoly 8 4
+export Add_LogoToDrawList
+proc Add_LogoToDrawList 5876 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize2
+CALLF4
+pop
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $208
+ADDRLP4 0+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+4
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 0+24+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $209
+JUMPV
+LABELV $208
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 3212836864
+NEF4 $221
+ADDRLP4 0+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+24+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $222
+JUMPV
+LABELV $221
+ADDRLP4 0+12
+ADDRLP4 0+4
+INDIRF4
+ASGNF4
+ADDRLP4 0+12+4
+ADDRLP4 0
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0+12+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 0+24
+ADDRLP4 0+12+4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDRLP4 0+12+8
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRLP4 0+12+8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRLP4 0+12
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0+24+8
+ADDRLP4 0+12
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDRLP4 0+12+4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0+24
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 0+12
+CNSTF4 3212836864
+ADDRLP4 0+12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+12+4
+CNSTF4 3212836864
+ADDRLP4 0+12+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+12+8
+CNSTF4 3212836864
+ADDRLP4 0+12+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+24
+CNSTF4 3212836864
+ADDRLP4 0+24
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+24+4
+CNSTF4 3212836864
+ADDRLP4 0+24+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+24+8
+CNSTF4 3212836864
+ADDRLP4 0+24+8
+INDIRF4
+MULF4
+ASGNF4
+LABELV $222
+LABELV $209
+ADDRLP4 4672
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 0+12
+INDIRF4
+MULF4
+SUBF4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 0+24
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 4672+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 0+12+4
+INDIRF4
+MULF4
+SUBF4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 0+24+4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 4672+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 0+12+8
+INDIRF4
+MULF4
+SUBF4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 0+24+8
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 4672+12
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 0+12
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 0+24
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 4672+12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 0+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 0+24+4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 4672+12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 0+12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 0+24+8
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 4672+24
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 0+12
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 0+24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4672+24+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 0+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 0+24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4672+24+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 0+12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 0+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4672+36
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 0+12
+INDIRF4
+MULF4
+SUBF4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 0+24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4672+36+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 0+12+4
+INDIRF4
+MULF4
+SUBF4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 0+24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4672+36+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 0+12+8
+INDIRF4
+MULF4
+SUBF4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 0+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 5808
+CNSTF4 3246391296
+ASGNF4
+ADDRLP4 5748
+ADDRLP4 5808
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 5748+4
+ADDRLP4 5808
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 5748+8
+CNSTF4 3246391296
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $330
+ADDRLP4 4656
+CNSTU1 255
+ASGNU1
+ADDRLP4 4656+1
+CNSTU1 0
+ASGNU1
+ADDRLP4 4656+2
+CNSTU1 0
+ASGNU1
+ADDRLP4 4656+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $331
+JUMPV
+LABELV $330
+ADDRFP4 16
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $335
+ADDRLP4 5816
+CNSTU1 0
+ASGNU1
+ADDRLP4 4656
+ADDRLP4 5816
+INDIRU1
+ASGNU1
+ADDRLP4 4656+1
+ADDRLP4 5816
+INDIRU1
+ASGNU1
+ADDRLP4 4656+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 4656+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $336
+JUMPV
+LABELV $335
+ADDRLP4 5824
+CNSTF4 1132396544
+ADDRFP4 16
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 5828
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 5824
+INDIRF4
+ADDRLP4 5828
+INDIRF4
+LTF4 $341
+ADDRLP4 5816
+ADDRLP4 5824
+INDIRF4
+ADDRLP4 5828
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $342
+JUMPV
+LABELV $341
+ADDRLP4 5816
+ADDRLP4 5824
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $342
+ADDRLP4 4656
+ADDRLP4 5816
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 5832
+CNSTF4 1132396544
+ADDRFP4 16
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 5836
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 5832
+INDIRF4
+ADDRLP4 5836
+INDIRF4
+LTF4 $345
+ADDRLP4 5820
+ADDRLP4 5832
+INDIRF4
+ADDRLP4 5836
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $346
+JUMPV
+LABELV $345
+ADDRLP4 5820
+ADDRLP4 5832
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $346
+ADDRLP4 4656+1
+ADDRLP4 5820
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 5844
+CNSTF4 1132396544
+ADDRFP4 16
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 5848
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 5844
+INDIRF4
+ADDRLP4 5848
+INDIRF4
+LTF4 $349
+ADDRLP4 5840
+ADDRLP4 5844
+INDIRF4
+ADDRLP4 5848
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $350
+JUMPV
+LABELV $349
+ADDRLP4 5840
+ADDRLP4 5844
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $350
+ADDRLP4 4656+2
+ADDRLP4 5840
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 4656+3
+CNSTU1 255
+ASGNU1
+LABELV $336
+LABELV $331
+ADDRLP4 4660
+CNSTF4 1056964608
+ADDRFP4 12
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 4664
+ADDRGP4 drawLogoPolys
+INDIRP4
+ASGNP4
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRGP4 $353
+JUMPV
+LABELV $352
+ADDRLP4 4664
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LTI4 $355
+ADDRLP4 5824
+ADDRLP4 4664
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 5828
+ADDRLP4 4664
+INDIRP4
+CNSTI4 280
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 5832
+ADDRLP4 4664
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 5836
+ADDRFP4 12
+INDIRF4
+ADDRLP4 4664
+INDIRP4
+CNSTI4 288
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 5824
+INDIRF4
+ADDRLP4 5824
+INDIRF4
+MULF4
+ADDRLP4 5828
+INDIRF4
+ADDRLP4 5828
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 5832
+INDIRF4
+ADDRLP4 5832
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1073741824
+ADDRLP4 5836
+INDIRF4
+ADDRLP4 5836
+INDIRF4
+MULF4
+MULF4
+GEF4 $355
+ADDRLP4 44
+ADDRLP4 4664
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $355
+ADDRLP4 4664
+ADDRLP4 4664
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $353
+ADDRLP4 4664
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $352
+CNSTI4 4
+ARGI4
+ADDRLP4 4672
+ARGP4
+ADDRLP4 5748
+ARGP4
+CNSTI4 384
+ARGI4
+ADDRLP4 48
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 4724
+ARGP4
+ADDRLP4 5816
+ADDRGP4 trap_CM_MarkFragments
+CALLI4
+ASGNI4
+ADDRLP4 4720
+ADDRLP4 5816
+INDIRI4
+ASGNI4
+ADDRLP4 4668
+CNSTI4 0
+ASGNI4
+ADDRGP4 $360
+JUMPV
+LABELV $357
+ADDRLP4 40
+ADDRLP4 4668
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 4724
+ADDP4
+ASGNP4
+ADDRLP4 5828
+ADDRGP4 Alloc_LogoPoly
+CALLP4
+ASGNP4
+ADDRLP4 5824
+ADDRLP4 5828
+INDIRP4
+ASGNP4
+ADDRLP4 5824
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $361
+ADDRGP4 $207
+JUMPV
+LABELV $361
+ADDRLP4 40
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 10
+LEI4 $363
+ADDRLP4 40
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 10
+ASGNI4
+LABELV $363
+ADDRLP4 5824
+INDIRP4
+CNSTI4 276
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 5824
+INDIRP4
+CNSTI4 296
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 5824
+INDIRP4
+CNSTI4 300
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1082130432
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 5824
+INDIRP4
+CNSTI4 304
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1082130432
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 5824
+INDIRP4
+CNSTI4 288
+ADDP4
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 5824
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRGP4 $370
+JUMPV
+LABELV $367
+ADDRLP4 5820
+CNSTI4 24
+ADDRLP4 36
+INDIRI4
+MULI4
+ADDRLP4 5824
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 5820
+INDIRP4
+CNSTI4 12
+ADDRLP4 40
+INDIRP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+ADDI4
+MULI4
+ADDRLP4 48
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 44
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1036831949
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 5848
+CNSTI4 4
+ASGNI4
+ADDRLP4 5820
+INDIRP4
+ADDRLP4 5848
+INDIRI4
+ADDP4
+CNSTI4 12
+ADDRLP4 40
+INDIRP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+ADDI4
+MULI4
+ADDRLP4 48+4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 5848
+INDIRI4
+ADDP4
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 44
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1036831949
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 5852
+CNSTI4 8
+ASGNI4
+ADDRLP4 5820
+INDIRP4
+ADDRLP4 5852
+INDIRI4
+ADDP4
+CNSTI4 12
+ADDRLP4 40
+INDIRP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+ADDI4
+MULI4
+ADDRLP4 48+8
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 5852
+INDIRI4
+ADDP4
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 44
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1036831949
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 5832
+ADDRLP4 5820
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 5864
+CNSTI4 4
+ASGNI4
+ADDRLP4 5832+4
+ADDRLP4 5820
+INDIRP4
+ADDRLP4 5864
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 5864
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 5868
+CNSTI4 8
+ASGNI4
+ADDRLP4 5832+8
+ADDRLP4 5820
+INDIRP4
+ADDRLP4 5868
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 5868
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 5820
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 5832
+INDIRF4
+ADDRLP4 0+12
+INDIRF4
+MULF4
+ADDRLP4 5832+4
+INDIRF4
+ADDRLP4 0+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 5832+8
+INDIRF4
+ADDRLP4 0+12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 4660
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRLP4 5820
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 5832
+INDIRF4
+ADDRLP4 0+24
+INDIRF4
+MULF4
+ADDRLP4 5832+4
+INDIRF4
+ADDRLP4 0+24+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 5832+8
+INDIRF4
+ADDRLP4 0+24+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 4660
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRLP4 5872
+ADDRLP4 5820
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 5872
+INDIRP4
+ADDRLP4 5872
+INDIRP4
+INDIRF4
+CNSTF4 1092616192
+ADDRLP4 44
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 5820
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 4656
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $368
+ADDRLP4 36
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $370
+ADDRLP4 36
+INDIRI4
+ADDRLP4 40
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $367
+ADDRLP4 5824
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRLP4 5824
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 5824
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 40
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 5824
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 4656
+INDIRU1
+CVUI4 1
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 5824
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 4656+1
+INDIRU1
+CVUI4 1
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 5824
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 4656+2
+INDIRU1
+CVUI4 1
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 5824
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 4656+3
+INDIRU1
+CVUI4 1
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+LABELV $358
+ADDRLP4 4668
+ADDRLP4 4668
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $360
+ADDRLP4 4668
+INDIRI4
+ADDRLP4 4720
+INDIRI4
+LTI4 $357
+LABELV $207
+endproc Add_LogoToDrawList 5876 28
+export AddLogosToScene
+proc AddLogosToScene 68 12
+ADDRLP4 40
+ADDRGP4 CG_PortalInView
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $395
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRGP4 $396
+JUMPV
+LABELV $395
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+LABELV $396
+ADDRLP4 12
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 44
+CNSTF4 0
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 drawLogoPolys
+INDIRP4
+ASGNP4
+ADDRGP4 $400
+JUMPV
+LABELV $399
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 90000
+ADDI4
+GEI4 $402
+ADDRLP4 8
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $403
+JUMPV
+LABELV $402
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 120000
+ADDI4
+GEI4 $405
+ADDRLP4 8
+CNSTF4 1065353216
+ADDRGP4 cg+107612
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 90000
+SUBI4
+CVIF4 4
+CNSTF4 1189765120
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $406
+JUMPV
+LABELV $405
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 Free_LogoPoly
+CALLV
+pop
+ADDRGP4 $400
+JUMPV
+LABELV $406
+LABELV $403
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $409
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 drawLogoPolys
+INDIRP4
+CVPU4 4
+EQU4 $413
+ADDRLP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 52
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $411
+LABELV $413
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 56
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+110648+24
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_R_inPVS
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 60
+INDIRI4
+ASGNI4
+LABELV $411
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $416
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $400
+JUMPV
+LABELV $416
+LABELV $409
+ADDRLP4 8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $418
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $423
+JUMPV
+LABELV $420
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTF4 1132396544
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+MULF4
+CVFI4 4
+CVIU4 4
+CVUU1 4
+ASGNU1
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDP4
+CNSTI4 21
+ADDP4
+CNSTF4 1132396544
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+MULF4
+CVFI4 4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 56
+CNSTI4 24
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDP4
+CNSTI4 22
+ADDP4
+CNSTF4 1132396544
+ADDRLP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+MULF4
+CVFI4 4
+CVIU4 4
+CVUU1 4
+ASGNU1
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDP4
+CNSTI4 23
+ADDP4
+CNSTF4 1132396544
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+MULF4
+CVFI4 4
+CVIU4 4
+CVUU1 4
+ASGNU1
+LABELV $421
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $423
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+LTI4 $420
+LABELV $418
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRGP4 CG_AddPolyBatched
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $400
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $399
+ADDRGP4 CG_FlushSceneBatches
+CALLV
+pop
+LABELV $393
+endproc AddLogosToScene 68 12
+export CursorInBox
+proc CursorInBox 8 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+160560
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LTI4 $425
+ADDRGP4 cgs+160560
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+GTI4 $425
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+160564
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $425
+ADDRGP4 cgs+160564
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 12
+INDIRI4
+ADDI4
+GTI4 $425
+CNSTI4 1
+RETI4
+ADDRGP4 $424
+JUMPV
+LABELV $425
+CNSTI4 0
+RETI4
+LABELV $424
+endproc CursorInBox 8 0
+data
+align 4
+LABELV activepage
+byte 4 0
+code
+proc SkipNumber 16 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $433
+JUMPV
+LABELV $432
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 12
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 97
+LTI4 $435
+ADDRLP4 12
+INDIRI4
+CNSTI4 122
+GTI4 $435
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $431
+JUMPV
+LABELV $435
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $433
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $432
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $431
+endproc SkipNumber 16 4
+lit
+align 4
+LABELV $438
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1051260355
+data
+align 4
+LABELV $439
+byte 4 0
+align 4
+LABELV $440
+byte 4 0
+lit
+align 1
+LABELV $441
+byte 1 48
+byte 1 0
+skip 14
+export ActiveChooseLogoMenu
+code
+proc ActiveChooseLogoMenu 392 36
+ADDRLP4 300
+ADDRGP4 $438
+INDIRB
+ASGNB 16
+ADDRLP4 276
+ADDRGP4 $441
+INDIRB
+ASGNB 16
+ADDRLP4 272
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $442
+ARGP4
+ADDRGP4 $443
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 7
+NEI4 $444
+CNSTI4 1836
+ADDRGP4 cg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+68
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $447
+ADDRLP4 8
+ADDRGP4 colorRed
+ASGNP4
+ADDRGP4 $445
+JUMPV
+LABELV $447
+ADDRLP4 8
+ADDRGP4 colorBlue
+ASGNP4
+ADDRGP4 $445
+JUMPV
+LABELV $444
+ADDRGP4 $452
+ARGP4
+ADDRLP4 276
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 316
+ADDRLP4 276
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 53
+GTI4 $455
+ADDRLP4 316
+INDIRI4
+CNSTI4 48
+GEI4 $453
+LABELV $455
+ADDRLP4 276
+CNSTI1 48
+ASGNI1
+LABELV $453
+ADDRLP4 8
+ADDRLP4 276
+INDIRI1
+CVII4 1
+CNSTI4 4
+LSHI4
+ADDRGP4 spraycolors-768
+ADDP4
+ASGNP4
+LABELV $445
+ADDRLP4 316
+ADDRGP4 trap_Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 292
+ADDRLP4 316
+INDIRI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $457
+ADDRLP4 292
+INDIRI4
+CNSTI4 8
+BORI4
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+LABELV $457
+CNSTF4 1040187392
+ADDRGP4 loadedlogos
+INDIRI4
+CVIF4 4
+MULF4
+ARGF4
+ADDRLP4 320
+ADDRGP4 ceil
+CALLF4
+ASGNF4
+ADDRLP4 296
+ADDRLP4 320
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 cgs+160652+392
+INDIRI4
+CNSTI4 0
+NEI4 $459
+CNSTF4 1121976320
+ARGF4
+CNSTF4 1114636288
+ARGF4
+CNSTF4 1137704960
+ARGF4
+CNSTF4 1134559232
+ARGF4
+ADDRLP4 300
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+CNSTF4 1121976320
+ARGF4
+CNSTF4 1114636288
+ARGF4
+CNSTF4 1137704960
+ARGF4
+CNSTF4 1134559232
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 CG_DrawRect
+CALLV
+pop
+ADDRGP4 $460
+JUMPV
+LABELV $459
+CNSTF4 1120665600
+ARGF4
+CNSTF4 1112014848
+ARGF4
+CNSTF4 1138360320
+ARGF4
+CNSTF4 1135214592
+ARGF4
+ADDRGP4 cgs+160652+392
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $460
+CNSTI4 144
+ARGI4
+CNSTI4 74
+ARGI4
+ADDRGP4 $465
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRLP4 12
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRGP4 activepage
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRGP4 $469
+JUMPV
+LABELV $466
+ADDRLP4 4
+INDIRI4
+ADDRGP4 loadedlogos
+INDIRI4
+LTI4 $470
+ADDRGP4 $468
+JUMPV
+LABELV $470
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 144
+ADDI4
+CVIF4 4
+ARGF4
+CNSTF4 1120403456
+ARGF4
+ADDRLP4 328
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 328
+INDIRF4
+ARGF4
+ADDRLP4 328
+INDIRF4
+ARGF4
+CNSTI4 36
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 loadedlogos_array+32
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTI4 36
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 loadedlogos_array
+ADDP4
+ARGP4
+ADDRLP4 332
+ADDRGP4 SkipNumber
+CALLP4
+ASGNP4
+ADDRLP4 324
+ADDRLP4 332
+INDIRP4
+ASGNP4
+ADDRLP4 324
+INDIRP4
+ARGP4
+ADDRLP4 336
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 144
+ADDI4
+CNSTI4 32
+ADDI4
+ADDRLP4 336
+INDIRI4
+CNSTI4 2
+LSHI4
+SUBI4
+ARGI4
+CNSTI4 174
+ARGI4
+ADDRLP4 324
+INDIRP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 340
+CNSTI4 1
+ASGNI4
+ADDRLP4 340
+INDIRI4
+ARGI4
+ADDRLP4 340
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 144
+ADDI4
+ARGI4
+CNSTI4 100
+ARGI4
+CNSTI4 64
+ARGI4
+CNSTI4 90
+ARGI4
+ADDRLP4 344
+ADDRGP4 CursorInBox
+CALLI4
+ASGNI4
+ADDRLP4 344
+INDIRI4
+CNSTI4 0
+EQI4 $473
+ADDRLP4 12
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $473
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+ADDI4
+ADDRGP4 loadedlogos
+INDIRI4
+LTI4 $475
+ADDRGP4 $467
+JUMPV
+LABELV $475
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 144
+ADDI4
+CVIF4 4
+ARGF4
+CNSTF4 1128792064
+ARGF4
+ADDRLP4 348
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 348
+INDIRF4
+ARGF4
+ADDRLP4 348
+INDIRF4
+ARGF4
+CNSTI4 36
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 loadedlogos_array+144+32
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTI4 36
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 loadedlogos_array+144
+ADDP4
+ARGP4
+ADDRLP4 352
+ADDRGP4 SkipNumber
+CALLP4
+ASGNP4
+ADDRLP4 324
+ADDRLP4 352
+INDIRP4
+ASGNP4
+ADDRLP4 324
+INDIRP4
+ARGP4
+ADDRLP4 356
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 144
+ADDI4
+CNSTI4 32
+ADDI4
+ADDRLP4 356
+INDIRI4
+CNSTI4 2
+LSHI4
+SUBI4
+ARGI4
+CNSTI4 274
+ARGI4
+ADDRLP4 324
+INDIRP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 360
+CNSTI4 1
+ASGNI4
+ADDRLP4 360
+INDIRI4
+ARGI4
+ADDRLP4 360
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 144
+ADDI4
+ARGI4
+CNSTI4 200
+ARGI4
+CNSTI4 64
+ARGI4
+CNSTI4 90
+ARGI4
+ADDRLP4 364
+ADDRGP4 CursorInBox
+CALLI4
+ASGNI4
+ADDRLP4 364
+INDIRI4
+CNSTI4 0
+EQI4 $480
+ADDRLP4 12
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+LABELV $480
+LABELV $467
+ADDRLP4 324
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 324
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 324
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $469
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $466
+LABELV $468
+ADDRLP4 12
+INDIRI4
+CNSTI4 -1
+EQI4 $482
+ADDRLP4 336
+CNSTI4 4
+ASGNI4
+CNSTI4 96
+ADDRLP4 12
+INDIRI4
+ADDRLP4 336
+INDIRI4
+MODI4
+MULI4
+CNSTI4 144
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CNSTI4 8
+MODI4
+ADDRLP4 336
+INDIRI4
+DIVI4
+CNSTI4 0
+EQI4 $485
+ADDRLP4 328
+CNSTI4 200
+ASGNI4
+ADDRGP4 $486
+JUMPV
+LABELV $485
+ADDRLP4 328
+CNSTI4 100
+ASGNI4
+LABELV $486
+ADDRLP4 328
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 340
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 340
+INDIRF4
+ARGF4
+ADDRLP4 340
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 colorLtGrey
+ARGP4
+ADDRGP4 CG_DrawRect
+CALLV
+pop
+LABELV $482
+ADDRLP4 16
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $487
+ARGP4
+ADDRGP4 activepage
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 296
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 16
+ARGP4
+ADDRLP4 344
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+CNSTI4 320
+ADDRLP4 344
+INDIRI4
+CNSTI4 2
+LSHI4
+SUBI4
+ARGI4
+CNSTI4 306
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 348
+CNSTI4 1
+ASGNI4
+ADDRLP4 348
+INDIRI4
+ARGI4
+ADDRLP4 348
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+CNSTF4 1132920832
+ARGF4
+CNSTF4 1134034944
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1101004800
+ARGF4
+ADDRGP4 cgs+160652+384
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTF4 1135214592
+ARGF4
+CNSTF4 1134034944
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1101004800
+ARGF4
+ADDRGP4 cgs+160652+380
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 3
+NEI4 $492
+ADDRLP4 360
+CNSTI4 6
+ASGNI4
+ADDRLP4 352
+CNSTI4 144
+ASGNI4
+ADDRLP4 356
+CNSTI4 344
+ASGNI4
+ADDRLP4 352
+INDIRI4
+ARGI4
+ADDRLP4 364
+CNSTI4 8
+ASGNI4
+ADDRLP4 356
+INDIRI4
+ADDRLP4 364
+INDIRI4
+ADDI4
+ADDRLP4 364
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 $495
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 368
+CNSTI4 1
+ASGNI4
+ADDRLP4 368
+INDIRI4
+ARGI4
+ADDRLP4 368
+INDIRI4
+ARGI4
+ADDRLP4 364
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTI4 -1
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRLP4 352
+ADDRLP4 352
+INDIRI4
+CNSTI4 240
+ADDI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $499
+JUMPV
+LABELV $496
+ADDRLP4 352
+INDIRI4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 356
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 376
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 376
+INDIRF4
+ARGF4
+ADDRLP4 376
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 spraycolors
+ADDP4
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 352
+INDIRI4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDI4
+ARGI4
+ADDRLP4 356
+INDIRI4
+ARGI4
+ADDRLP4 380
+CNSTI4 16
+ASGNI4
+ADDRLP4 380
+INDIRI4
+ARGI4
+ADDRLP4 380
+INDIRI4
+ARGI4
+ADDRLP4 384
+ADDRGP4 CursorInBox
+CALLI4
+ASGNI4
+ADDRLP4 384
+INDIRI4
+CNSTI4 0
+EQI4 $500
+ADDRLP4 352
+INDIRI4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 356
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 388
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 388
+INDIRF4
+ARGF4
+ADDRLP4 388
+INDIRF4
+ARGF4
+ADDRGP4 colorTBlack33
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 272
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $500
+LABELV $497
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $499
+ADDRLP4 0
+INDIRI4
+ADDRLP4 360
+INDIRI4
+LTI4 $496
+LABELV $492
+ADDRLP4 352
+CNSTI4 16
+ASGNI4
+ADDRGP4 cgs+160560
+INDIRI4
+ADDRLP4 352
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRGP4 cgs+160564
+INDIRI4
+ADDRLP4 352
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 356
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 356
+INDIRF4
+ARGF4
+ADDRLP4 356
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+388
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 cgs+160588
+INDIRI4
+CNSTI4 178
+NEI4 $506
+ADDRGP4 $439
+INDIRI4
+CNSTI4 500
+ADDI4
+ADDRGP4 cg+107620
+INDIRI4
+GEI4 $506
+ADDRLP4 12
+INDIRI4
+CNSTI4 -1
+EQI4 $510
+ADDRGP4 menu_click_sound
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $512
+ARGP4
+CNSTI4 36
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 loadedlogos_array
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $513
+ARGP4
+CNSTI4 36
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 loadedlogos_array
+ADDP4
+ARGP4
+ADDRLP4 360
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 360
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+ADDRLP4 292
+INDIRI4
+CNSTI4 -9
+BANDI4
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 cg+107636
+CNSTI4 0
+ASGNI4
+ADDRGP4 $511
+JUMPV
+LABELV $510
+ADDRLP4 272
+INDIRI4
+CNSTI4 -1
+EQI4 $515
+ADDRGP4 menu_click_sound
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $517
+ARGP4
+ADDRLP4 272
+INDIRI4
+ARGI4
+ADDRLP4 360
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $452
+ARGP4
+ADDRLP4 360
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $516
+JUMPV
+LABELV $515
+ADDRGP4 cgs+160560
+INDIRI4
+CNSTI4 270
+LEI4 $518
+ADDRGP4 cgs+160560
+INDIRI4
+CNSTI4 300
+GEI4 $518
+ADDRGP4 cgs+160564
+INDIRI4
+CNSTI4 304
+LEI4 $518
+ADDRGP4 cgs+160564
+INDIRI4
+CNSTI4 324
+GEI4 $518
+ADDRGP4 activepage
+INDIRI4
+CNSTI4 0
+LEI4 $519
+ADDRGP4 menu_click_sound
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRLP4 360
+ADDRGP4 activepage
+ASGNP4
+ADDRLP4 360
+INDIRP4
+ADDRLP4 360
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $519
+JUMPV
+LABELV $518
+ADDRGP4 cgs+160560
+INDIRI4
+CNSTI4 340
+LEI4 $526
+ADDRGP4 cgs+160560
+INDIRI4
+CNSTI4 370
+GEI4 $526
+ADDRGP4 cgs+160564
+INDIRI4
+CNSTI4 304
+LEI4 $526
+ADDRGP4 cgs+160564
+INDIRI4
+CNSTI4 324
+GEI4 $526
+ADDRGP4 activepage
+INDIRI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $532
+ADDRGP4 menu_click_sound
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRLP4 360
+ADDRGP4 activepage
+ASGNP4
+ADDRLP4 360
+INDIRP4
+ADDRLP4 360
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $532
+LABELV $526
+LABELV $519
+LABELV $516
+LABELV $511
+ADDRGP4 $439
+ADDRGP4 cg+107620
+INDIRI4
+ASGNI4
+LABELV $506
+ADDRGP4 cgs+160588
+INDIRI4
+CNSTI4 27
+NEI4 $535
+ADDRLP4 292
+INDIRI4
+CNSTI4 -9
+BANDI4
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 cg+107636
+CNSTI4 0
+ASGNI4
+ADDRGP4 $536
+JUMPV
+LABELV $535
+ADDRGP4 cgs+160588
+INDIRI4
+CNSTI4 142
+EQI4 $544
+ADDRGP4 cgs+160588
+INDIRI4
+CNSTI4 184
+NEI4 $539
+LABELV $544
+ADDRGP4 $440
+INDIRI4
+CNSTI4 500
+ADDI4
+ADDRGP4 cg+107620
+INDIRI4
+GEI4 $539
+ADDRGP4 activepage
+INDIRI4
+CNSTI4 0
+LEI4 $545
+ADDRLP4 360
+ADDRGP4 activepage
+ASGNP4
+ADDRLP4 360
+INDIRP4
+ADDRLP4 360
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $545
+ADDRGP4 $440
+ADDRGP4 cg+107620
+INDIRI4
+ASGNI4
+ADDRGP4 $540
+JUMPV
+LABELV $539
+ADDRGP4 cgs+160588
+INDIRI4
+CNSTI4 141
+EQI4 $553
+ADDRGP4 cgs+160588
+INDIRI4
+CNSTI4 183
+NEI4 $548
+LABELV $553
+ADDRGP4 $440
+INDIRI4
+CNSTI4 500
+ADDI4
+ADDRGP4 cg+107620
+INDIRI4
+GEI4 $548
+ADDRGP4 activepage
+INDIRI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $554
+ADDRLP4 360
+ADDRGP4 activepage
+ASGNP4
+ADDRLP4 360
+INDIRP4
+ADDRLP4 360
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $554
+ADDRGP4 $440
+ADDRGP4 cg+107620
+INDIRI4
+ASGNI4
+ADDRGP4 $549
+JUMPV
+LABELV $548
+ADDRGP4 cgs+160588
+INDIRI4
+CNSTI4 49
+LTI4 $557
+ADDRGP4 cgs+160588
+INDIRI4
+CNSTI4 56
+GTI4 $557
+ADDRLP4 0
+ADDRGP4 cgs+160588
+INDIRI4
+CNSTI4 49
+SUBI4
+ADDRGP4 activepage
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 loadedlogos
+INDIRI4
+GEI4 $558
+ADDRGP4 $512
+ARGP4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 loadedlogos_array
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $513
+ARGP4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 loadedlogos_array
+ADDP4
+ARGP4
+ADDRLP4 360
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 360
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+ADDRLP4 292
+INDIRI4
+CNSTI4 -9
+BANDI4
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 cg+107636
+CNSTI4 0
+ASGNI4
+ADDRGP4 $558
+JUMPV
+LABELV $557
+ADDRGP4 cgs+160588
+INDIRI4
+CNSTI4 156
+NEI4 $565
+ADDRGP4 $568
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $565
+LABELV $558
+LABELV $549
+LABELV $540
+LABELV $536
+ADDRGP4 cg+107636
+INDIRI4
+CNSTI4 0
+NEI4 $569
+ADDRGP4 $442
+ARGP4
+ADDRGP4 $572
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $569
+ADDRGP4 cgs+160588
+CNSTI4 0
+ASGNI4
+LABELV $437
+endproc ActiveChooseLogoMenu 392 36
+export FindLogoForSpraying
+proc FindLogoForSpraying 40 8
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $575
+ADDRGP4 cgs+160652+356
+INDIRI4
+RETI4
+ADDRGP4 $574
+JUMPV
+LABELV $575
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $582
+JUMPV
+LABELV $579
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 loadedlogos_array
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 36
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $583
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 loadedlogos_array+32
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $574
+JUMPV
+LABELV $583
+LABELV $580
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $582
+ADDRLP4 0
+INDIRI4
+ADDRGP4 loadedlogos
+INDIRI4
+LTI4 $579
+ADDRGP4 cgs+160652+356
+INDIRI4
+RETI4
+LABELV $574
+endproc FindLogoForSpraying 40 8
+bss
+align 4
+LABELV logoPolys
+skip 78848
+align 4
+LABELV lastdrawLogoPolys
+skip 4
+align 4
+LABELV drawLogoPolys
+skip 4
+align 4
+LABELV freeLogoPolys
+skip 4
+align 4
+LABELV menu_click_sound
+skip 4
+align 4
+LABELV loadedlogos
+skip 4
+align 4
+LABELV loadedlogos_array
+skip 2304
+import CG_AddBoundingBox
+import CG_AddBoundingBoxEntity
+import CG_QueryCvar
+import CG_Timestamp
+import CG_LimitCvars
+import trap_RealTime
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import trap_R_inPVS
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_Cutscene2d_Draw
+import CG_Cutscene2d_UpdateTrans
+import CG_Cutscene2d_CheckCmd
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import Main_SpriteParticles
+import LaunchRevivalParticle
+import LaunchSpeedyPuffTrail
+import Init_SpriteParticles
+import AddLFsToScreen
+import AddLFToDrawList
+import Init_LensFlareSys
+import Calculate_2DOfDIR
+import Calculate_2DOf3D
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_ChangeLoadingProgress
+import CG_LoadingString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_ScorePlum
+import CG_TeleOutEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_GenerateParticles
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_PortalInView
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_GetWaterMuzzle
+import CG_SprayTrail
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponSRWC
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_Boomies_Explosion
+import CG_BamBam_Explosion
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_LerpTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayer
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_UpdateVoipTeamIDs
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Draw3DModel
+import CG_SetPrintString
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import CG_MessagePrint
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_WorldToScreen
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_DrawPic1024
+import CG_DrawRect1024
+import CG_FillRect1024
+import CG_AdjustFrom1024
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddPolyBatched
+import CG_AddRefEntityBatched
+import CG_FlushSceneBatches
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_ForceModelChange
+import CG_GetCvarFloat
+import CG_GetCvarInt
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StreamAssets
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_icons
+import cg_ambient
+import cg_drawBBox
+import cg_drawVoiceNames
+import cg_drawLensflare
+import cg_timestamps
+import cg_skyLensflare
+import cg_sky
+import cg_curWarmupReady
+import cg_warmupReady
+import cg_glowModelTeam
+import cg_glowModel
+import cg_cineDrawLetterBox
+import cg_cineHideHud
+import cg_LPSwallhackAlpha
+import cg_LPSwallhackSize
+import cg_bigScoreType
+import cg_thirdPersonAutoSwitch
+import cg_drawTimeLeft
+import cg_drawServerInfos
+import cg_drawMessages
+import cg_drawups
+import cg_wopFFAhud
+import cg_printDir
+import cg_drawRealTime
+import cg_correctedWeaponPos
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_streamAssets
+import cg_deferPlayers
+import cg_predictItems
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_chatBeep
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_optimizePrediction
+import cg_nopredict
+import cg_errorDecay
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import trailEnt
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $572
+byte 1 48
+byte 1 0
+align 1
+LABELV $568
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 74
+byte 1 80
+byte 1 69
+byte 1 71
+byte 1 10
+byte 1 0
+align 1
+LABELV $517
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $513
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $512
+byte 1 115
+byte 1 121
+byte 1 99
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 0
+align 1
+LABELV $495
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 83
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 58
+byte 1 0
+align 1
+LABELV $487
+byte 1 37
+byte 1 105
+byte 1 47
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $465
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 83
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 76
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 32
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 0
+align 1
+LABELV $452
+byte 1 115
+byte 1 121
+byte 1 99
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $443
+byte 1 49
+byte 1 0
+align 1
+LABELV $442
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $200
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $199
+byte 1 94
+byte 1 49
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 10
+byte 1 94
+byte 1 49
+byte 1 42
+byte 1 32
+byte 1 69
+byte 1 82
+byte 1 82
+byte 1 79
+byte 1 82
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 76
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 80
+byte 1 111
+byte 1 108
+byte 1 121
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 33
+byte 1 33
+byte 1 33
+byte 1 33
+byte 1 33
+byte 1 33
+byte 1 32
+byte 1 42
+byte 1 10
+byte 1 94
+byte 1 49
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 10
+byte 1 0
+align 1
+LABELV $183
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 82
+byte 1 82
+byte 1 79
+byte 1 82
+byte 1 58
+byte 1 32
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 95
+byte 1 76
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 80
+byte 1 111
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $179
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $178
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 47
+byte 1 98
+byte 1 103
+byte 1 0
+align 1
+LABELV $175
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 51
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $172
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 108
+byte 1 0
+align 1
+LABELV $169
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 114
+byte 1 0
+align 1
+LABELV $166
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $163
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 112
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 0
+align 1
+LABELV $153
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $151
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $144
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 115
+byte 1 47
+byte 1 48
+byte 1 49
+byte 1 95
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $132
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $106
+byte 1 105
+byte 1 100
+byte 1 37
+byte 1 52
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 52
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 32
+byte 1 37
+byte 1 52
+byte 1 100
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $102
+byte 1 10
+byte 1 10
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 10
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 10
+byte 1 0
+align 1
+LABELV $101
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 53
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 52
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 52
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 32
+byte 1 37
+byte 1 52
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $97
+byte 1 10
+byte 1 10
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 10
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 10
+byte 1 0
+align 1
+LABELV $96
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $95
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $94
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $93
+byte 1 10
+byte 1 0
+align 1
+LABELV $92
+byte 1 37
+byte 1 52
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 53
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 56
+byte 1 100
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 54
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 51
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $86
+byte 1 10
+byte 1 10
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 100
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 44
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 10
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 10
+byte 1 112
+byte 1 111
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 10
+byte 1 10
+byte 1 0
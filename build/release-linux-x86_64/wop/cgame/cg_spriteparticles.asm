@@ -0,0 +1,3512 @@
+export Init_SpriteParticles
+code
+proc Init_SpriteParticles 20 12
+ADDRGP4 pmem
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 237568
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRGP4 lastp
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 firstp
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 freep
+ADDRGP4 pmem
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $82
+ADDRLP4 8
+CNSTI4 116
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 pmem
+ADDP4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 pmem+116
+ADDP4
+ASGNP4
+LABELV $83
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2047
+LTI4 $82
+ADDRGP4 cshmem
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 24576
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 ccmem
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 180224
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 csimem
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 49152
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 freecsh
+ADDRGP4 cshmem
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $87
+ADDRLP4 8
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cshmem
+ADDP4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cshmem+12
+ADDP4
+ASGNP4
+LABELV $88
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2047
+LTI4 $87
+ADDRGP4 freecc
+ADDRGP4 ccmem
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $92
+ADDRLP4 8
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 ccmem
+ADDP4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 ccmem+44
+ADDP4
+ASGNP4
+LABELV $93
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4095
+LTI4 $92
+ADDRGP4 freecsi
+ADDRGP4 csimem
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $97
+ADDRLP4 8
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 csimem
+ADDP4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 csimem+12
+ADDP4
+ASGNP4
+LABELV $98
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4095
+LTI4 $97
+ADDRGP4 $102
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 spritehandles
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $104
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 spritehandles+4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $106
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 spritehandles+8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+LABELV $81
+endproc Init_SpriteParticles 20 12
+export Free_SpriteParticle
+proc Free_SpriteParticle 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 12
+INDIRU4
+ADDRGP4 pmem
+CVPU4 4
+LTU4 $111
+ADDRLP4 12
+INDIRU4
+ADDRGP4 pmem+237452
+CVPU4 4
+LEU4 $114
+LABELV $111
+CNSTI4 0
+ARGI4
+ADDRGP4 $112
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+ADDRGP4 $107
+JUMPV
+LABELV $113
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 12
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRP4
+ADDRGP4 freecsh
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRGP4 freecsh
+ADDRLP4 20
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $114
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $113
+ADDRGP4 $117
+JUMPV
+LABELV $116
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 44
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRP4
+ADDRGP4 freecc
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ASGNP4
+ADDRGP4 freecc
+ADDRLP4 20
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $117
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $116
+ADDRGP4 $120
+JUMPV
+LABELV $119
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 16
+INDIRP4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 12
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRP4
+ADDRGP4 freecsi
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ASGNP4
+ADDRGP4 freecsi
+ADDRLP4 20
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+LABELV $120
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $119
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 firstp
+INDIRP4
+CVPU4 4
+NEU4 $122
+ADDRGP4 firstp
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $122
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 lastp
+INDIRP4
+CVPU4 4
+NEU4 $124
+ADDRGP4 lastp
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $124
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $126
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $126
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $128
+ADDRLP4 24
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $128
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 116
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ADDRGP4 freep
+INDIRP4
+ASGNP4
+ADDRGP4 freep
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $107
+endproc Free_SpriteParticle 28 12
+proc AddCCToParticle 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 20
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 24
+ADDRFP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 freecc
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $132
+CNSTI4 1
+RETI4
+ADDRGP4 $131
+JUMPV
+LABELV $132
+ADDRLP4 8
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+GTF4 $139
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 12
+INDIRF4
+LTF4 $139
+ADDRFP4 16
+INDIRF4
+ADDRLP4 8
+INDIRF4
+GTF4 $139
+ADDRFP4 16
+INDIRF4
+ADDRLP4 12
+INDIRF4
+LTF4 $139
+ADDRFP4 20
+INDIRF4
+ADDRLP4 8
+INDIRF4
+GTF4 $139
+ADDRFP4 20
+INDIRF4
+ADDRLP4 12
+INDIRF4
+LTF4 $139
+ADDRFP4 24
+INDIRF4
+ADDRLP4 8
+INDIRF4
+GTF4 $139
+ADDRFP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+GEF4 $134
+LABELV $139
+CNSTI4 2
+RETI4
+ADDRGP4 $131
+JUMPV
+LABELV $134
+ADDRGP4 freecc
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 freecc
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 freecc
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 freecc
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRGP4 freecc
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRGP4 freecc
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 24
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $140
+ADDRGP4 freecc
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 freecc
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 freecc
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 freecc
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ADDRGP4 freecc
+INDIRP4
+ASGNP4
+ADDRGP4 $141
+JUMPV
+LABELV $140
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $145
+JUMPV
+LABELV $142
+LABELV $143
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $145
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $142
+ADDRLP4 0
+INDIRP4
+ADDRGP4 freecc
+INDIRP4
+ASGNP4
+LABELV $141
+ADDRLP4 28
+ADDRGP4 freecc
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 freecc
+ADDRLP4 0
+INDIRP4
+ASGNP4
+CNSTI4 0
+RETI4
+LABELV $131
+endproc AddCCToParticle 32 0
+proc Alloc_SpriteParticle 8 4
+ADDRGP4 freep
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $147
+ADDRGP4 lastp
+INDIRP4
+ARGP4
+ADDRGP4 Free_SpriteParticle
+CALLV
+pop
+LABELV $147
+ADDRLP4 4
+ADDRGP4 freep
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRGP4 firstp
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $149
+ADDRGP4 firstp
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $149
+ADDRLP4 0
+INDIRP4
+ADDRGP4 firstp
+INDIRP4
+ASGNP4
+ADDRGP4 firstp
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 lastp
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $151
+ADDRGP4 lastp
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $151
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $146
+endproc Alloc_SpriteParticle 8 4
+export LaunchSpeedyPuffTrail
+proc LaunchSpeedyPuffTrail 40 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRGP4 Alloc_SpriteParticle
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRGP4 cgs+160652+208
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 4000
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 1045220557
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTF4 1045220557
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTF4 1060320051
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 2100
+ARGI4
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 16
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 AddCCToParticle
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $158
+ADDRGP4 $160
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $158
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 2100
+ARGI4
+CNSTI4 3000
+ARGI4
+ADDRLP4 24
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+CNSTF4 1061997773
+ARGF4
+ADDRLP4 28
+ADDRGP4 AddCCToParticle
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $161
+ADDRGP4 $160
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $161
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 3100
+ARGI4
+CNSTI4 4000
+ARGI4
+ADDRLP4 32
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+CNSTF4 0
+ARGF4
+ADDRLP4 36
+ADDRGP4 AddCCToParticle
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $163
+ADDRGP4 $160
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $163
+LABELV $153
+endproc LaunchSpeedyPuffTrail 40 28
+export LaunchRevivalParticle
+proc LaunchRevivalParticle 32 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 Alloc_SpriteParticle
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRGP4 cgs+160652+224
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTF4 1077936128
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 1045220557
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTF4 1045220557
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 4
+DIVI4
+ARGI4
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+CNSTF4 0
+ARGF4
+ADDRLP4 16
+ADDRGP4 AddCCToParticle
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $170
+ADDRGP4 $160
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $170
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 3
+ADDRFP4 4
+INDIRI4
+MULI4
+CNSTI4 4
+DIVI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 AddCCToParticle
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $172
+ADDRGP4 $160
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $172
+LABELV $165
+endproc LaunchRevivalParticle 32 28
+proc CheckCurrentStats 176 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $175
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ADDRLP4 80
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDI4
+LTI4 $175
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 88
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 88
+INDIRP4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 12
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRP4
+ADDRGP4 freecsh
+INDIRP4
+ASGNP4
+ADDRLP4 92
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRGP4 freecsh
+ADDRLP4 92
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+LABELV $175
+ADDRLP4 88
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $178
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ADDRLP4 88
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDI4
+LTI4 $178
+ADDRLP4 96
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRLP4 96
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $181
+ADDRLP4 92
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $182
+JUMPV
+LABELV $181
+ADDRLP4 104
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 108
+ADDRLP4 104
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 92
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+SUBI4
+ADDRLP4 108
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRLP4 104
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRLP4 108
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 92
+INDIRF4
+CNSTF4 1065353216
+LEF4 $184
+ADDRLP4 92
+CNSTF4 1065353216
+ASGNF4
+LABELV $184
+LABELV $182
+ADDRLP4 104
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRLP4 104
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 92
+INDIRF4
+MULF4
+ADDRLP4 104
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 92
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 116
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRLP4 116
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 92
+INDIRF4
+MULF4
+ADDRLP4 116
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 92
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 128
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 128
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 92
+INDIRF4
+MULF4
+ADDRLP4 128
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 92
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 140
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRLP4 140
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 92
+INDIRF4
+MULF4
+ADDRLP4 140
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 92
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDI4
+LTI4 $186
+ADDRLP4 152
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 152
+INDIRP4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 44
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRP4
+ADDRGP4 freecc
+INDIRP4
+ASGNP4
+ADDRLP4 156
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ASGNP4
+ADDRGP4 freecc
+ADDRLP4 156
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $189
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $189
+LABELV $186
+LABELV $178
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $191
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDI4
+GEI4 $193
+ADDRLP4 100
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ADDRLP4 100
+INDIRP4
+INDIRF4
+CNSTF4 981668463
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 cg+107608
+INDIRI4
+CVIF4 4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $194
+JUMPV
+LABELV $193
+ADDRLP4 96
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 96
+INDIRP4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 12
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRP4
+ADDRGP4 freecsi
+INDIRP4
+ASGNP4
+ADDRLP4 100
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ASGNP4
+ADDRGP4 freecsi
+ADDRLP4 100
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+LABELV $194
+LABELV $191
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTF4 1073741824
+ADDRLP4 96
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 104
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRF4
+CNSTF4 981668463
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ADDRGP4 cg+107608
+INDIRI4
+CVIF4 4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ADDRLP4 112
+INDIRP4
+INDIRF4
+CNSTF4 981668463
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ADDRGP4 cg+107608
+INDIRI4
+CVIF4 4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 120
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ADDRLP4 120
+INDIRP4
+INDIRF4
+CNSTF4 981668463
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ADDRGP4 cg+107608
+INDIRI4
+CVIF4 4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+CNSTF4 0
+LEF4 $202
+ADDRLP4 20
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 124
+CNSTP4 0
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 20+8
+INDIRF4
+CNSTF4 1065353216
+EQF4 $204
+LABELV $204
+LABELV $202
+ADDRLP4 124
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTF4 1073741824
+ADDRLP4 124
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 132
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ADDRLP4 132
+INDIRP4
+INDIRF4
+CNSTF4 981668463
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ADDRGP4 cg+107608
+INDIRI4
+CVIF4 4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 140
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ADDRLP4 140
+INDIRP4
+INDIRF4
+CNSTF4 981668463
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ADDRGP4 cg+107608
+INDIRI4
+CVIF4 4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 148
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ADDRLP4 148
+INDIRP4
+INDIRF4
+CNSTF4 981668463
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ADDRGP4 cg+107608
+INDIRI4
+CVIF4 4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $174
+endproc CheckCurrentStats 176 28
+proc AddSpriteParticleToScene 216 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $211
+ADDRGP4 $210
+JUMPV
+LABELV $211
+ADDRLP4 96
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12+4
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 0+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 100
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+12+4
+ADDRLP4 100
+INDIRF4
+ASGNF4
+ADDRLP4 0+48+12
+ADDRLP4 100
+INDIRF4
+ASGNF4
+ADDRLP4 0+72+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 108
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 112
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 112
+INDIRF4
+LTF4 $239
+ADDRLP4 104
+ADDRLP4 108
+INDIRF4
+ADDRLP4 112
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $240
+JUMPV
+LABELV $239
+ADDRLP4 104
+ADDRLP4 108
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $240
+ADDRLP4 116
+ADDRLP4 104
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20
+ADDRLP4 116
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20
+ADDRLP4 116
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20
+ADDRLP4 116
+INDIRU1
+ASGNU1
+ADDRLP4 0+20
+ADDRLP4 116
+INDIRU1
+ASGNU1
+ADDRLP4 124
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 128
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 124
+INDIRF4
+ADDRLP4 128
+INDIRF4
+LTF4 $253
+ADDRLP4 120
+ADDRLP4 124
+INDIRF4
+ADDRLP4 128
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $254
+JUMPV
+LABELV $253
+ADDRLP4 120
+ADDRLP4 124
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $254
+ADDRLP4 132
+ADDRLP4 120
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+1
+ADDRLP4 132
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20+1
+ADDRLP4 132
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+1
+ADDRLP4 132
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+1
+ADDRLP4 132
+INDIRU1
+ASGNU1
+ADDRLP4 140
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 144
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 140
+INDIRF4
+ADDRLP4 144
+INDIRF4
+LTF4 $267
+ADDRLP4 136
+ADDRLP4 140
+INDIRF4
+ADDRLP4 144
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $268
+JUMPV
+LABELV $267
+ADDRLP4 136
+ADDRLP4 140
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $268
+ADDRLP4 148
+ADDRLP4 136
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+2
+ADDRLP4 148
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20+2
+ADDRLP4 148
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+2
+ADDRLP4 148
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+2
+ADDRLP4 148
+INDIRU1
+ASGNU1
+ADDRLP4 156
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 160
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 156
+INDIRF4
+ADDRLP4 160
+INDIRF4
+LTF4 $281
+ADDRLP4 152
+ADDRLP4 156
+INDIRF4
+ADDRLP4 160
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $282
+JUMPV
+LABELV $281
+ADDRLP4 152
+ADDRLP4 156
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $282
+ADDRLP4 164
+ADDRLP4 152
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+3
+ADDRLP4 164
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20+3
+ADDRLP4 164
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+3
+ADDRLP4 164
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+3
+ADDRLP4 164
+INDIRU1
+ASGNU1
+ADDRLP4 172
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 172
+INDIRP4
+INDIRF4
+ADDRGP4 cg+110648+36+12
+INDIRF4
+NEGF4
+ADDRGP4 cg+110648+36+24
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 172
+INDIRP4
+INDIRF4
+ADDRGP4 cg+110648+36+12+4
+INDIRF4
+NEGF4
+ADDRGP4 cg+110648+36+24+4
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRGP4 cg+110648+36+12+8
+INDIRF4
+NEGF4
+ADDRGP4 cg+110648+36+24+8
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRGP4 cg+110648+36+12
+INDIRF4
+NEGF4
+ADDRGP4 cg+110648+36+24
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRGP4 cg+110648+36+12+4
+INDIRF4
+NEGF4
+ADDRGP4 cg+110648+36+24+4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRGP4 cg+110648+36+12+8
+INDIRF4
+NEGF4
+ADDRGP4 cg+110648+36+24+8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRGP4 cg+110648+36+12
+INDIRF4
+ADDRGP4 cg+110648+36+24
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRGP4 cg+110648+36+12+4
+INDIRF4
+ADDRGP4 cg+110648+36+24+4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRGP4 cg+110648+36+12+8
+INDIRF4
+ADDRGP4 cg+110648+36+24+8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRGP4 cg+110648+36+12
+INDIRF4
+ADDRGP4 cg+110648+36+24
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRGP4 cg+110648+36+12+4
+INDIRF4
+ADDRGP4 cg+110648+36+24+4
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRGP4 cg+110648+36+12+8
+INDIRF4
+ADDRGP4 cg+110648+36+24+8
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $388
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+ADDRGP4 $389
+JUMPV
+LABELV $388
+ADDRGP4 cgs+160652+8
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+LABELV $389
+LABELV $210
+endproc AddSpriteParticleToScene 216 12
+export Main_SpriteParticles
+proc Main_SpriteParticles 12 4
+ADDRLP4 0
+ADDRGP4 firstp
+INDIRP4
+ASGNP4
+ADDRGP4 $396
+JUMPV
+LABELV $393
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+GEI4 $397
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Free_SpriteParticle
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $394
+ADDRGP4 $395
+JUMPV
+LABELV $397
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CheckCurrentStats
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 AddSpriteParticleToScene
+CALLV
+pop
+LABELV $394
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $396
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $393
+LABELV $395
+LABELV $392
+endproc Main_SpriteParticles 12 4
+bss
+export spritehandles
+align 4
+LABELV spritehandles
+skip 12
+align 4
+LABELV freep
+skip 4
+align 4
+LABELV lastp
+skip 4
+align 4
+LABELV firstp
+skip 4
+align 4
+LABELV pmem
+skip 237568
+align 4
+LABELV freecsi
+skip 4
+align 4
+LABELV freecc
+skip 4
+align 4
+LABELV freecsh
+skip 4
+align 4
+LABELV csimem
+skip 49152
+align 4
+LABELV ccmem
+skip 180224
+align 4
+LABELV cshmem
+skip 24576
+import CG_AddBoundingBox
+import CG_AddBoundingBoxEntity
+import CG_QueryCvar
+import CG_Timestamp
+import CG_LimitCvars
+import trap_RealTime
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import trap_R_inPVS
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_Cutscene2d_Draw
+import CG_Cutscene2d_UpdateTrans
+import CG_Cutscene2d_CheckCmd
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import AddLFsToScreen
+import AddLFToDrawList
+import Init_LensFlareSys
+import DumpPolyInfo
+import ActiveChooseLogoMenu
+import FindLogoForSpraying
+import Add_LogoToDrawList
+import AddLogosToScene
+import Init_SprayLogoSys
+import Calculate_2DOfDIR
+import Calculate_2DOf3D
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_ChangeLoadingProgress
+import CG_LoadingString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_ScorePlum
+import CG_TeleOutEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_GenerateParticles
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_PortalInView
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_GetWaterMuzzle
+import CG_SprayTrail
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponSRWC
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_Boomies_Explosion
+import CG_BamBam_Explosion
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_LerpTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayer
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_UpdateVoipTeamIDs
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Draw3DModel
+import CG_SetPrintString
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import CG_MessagePrint
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_WorldToScreen
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_DrawPic1024
+import CG_DrawRect1024
+import CG_FillRect1024
+import CG_AdjustFrom1024
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddPolyBatched
+import CG_AddRefEntityBatched
+import CG_FlushSceneBatches
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_ForceModelChange
+import CG_GetCvarFloat
+import CG_GetCvarInt
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StreamAssets
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_icons
+import cg_ambient
+import cg_drawBBox
+import cg_drawVoiceNames
+import cg_drawLensflare
+import cg_timestamps
+import cg_skyLensflare
+import cg_sky
+import cg_curWarmupReady
+import cg_warmupReady
+import cg_glowModelTeam
+import cg_glowModel
+import cg_cineDrawLetterBox
+import cg_cineHideHud
+import cg_LPSwallhackAlpha
+import cg_LPSwallhackSize
+import cg_bigScoreType
+import cg_thirdPersonAutoSwitch
+import cg_drawTimeLeft
+import cg_drawServerInfos
+import cg_drawMessages
+import cg_drawups
+import cg_wopFFAhud
+import cg_printDir
+import cg_drawRealTime
+import cg_correctedWeaponPos
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_streamAssets
+import cg_deferPlayers
+import cg_predictItems
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_chatBeep
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_optimizePrediction
+import cg_nopredict
+import cg_errorDecay
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import trailEnt
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $160
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 61
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $112
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 119
+byte 1 114
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 112
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $106
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 48
+byte 1 51
+byte 1 0
+align 1
+LABELV $104
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 48
+byte 1 50
+byte 1 0
+align 1
+LABELV $102
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 48
+byte 1 49
+byte 1 0
@@ -0,0 +1,5897 @@
+export CG_TestModel_f
+code
+proc CG_TestModel_f 36 12
+ADDRGP4 cg+132100
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+131896
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 12
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+GEI4 $84
+ADDRGP4 $80
+JUMPV
+LABELV $84
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 cg+132036
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+132036
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cg+131896+8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 3
+NEI4 $90
+CNSTI4 2
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cg+131896+100
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRGP4 cg+131896+80
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+131896+96
+CNSTI4 0
+ASGNI4
+LABELV $90
+ADDRGP4 cg+131896+8
+INDIRI4
+CNSTI4 0
+NEI4 $98
+ADDRGP4 $102
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $80
+JUMPV
+LABELV $98
+ADDRGP4 cg+131896+68
+ADDRGP4 cg+110648+24
+INDIRF4
+CNSTF4 1120403456
+ADDRGP4 cg+110648+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+131896+68+4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+CNSTF4 1120403456
+ADDRGP4 cg+110648+36+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+131896+68+8
+ADDRGP4 cg+110648+24+8
+INDIRF4
+CNSTF4 1120403456
+ADDRGP4 cg+110648+36+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+ADDRGP4 cg+111016+4
+INDIRF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cg+131896+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+LABELV $80
+endproc CG_TestModel_f 36 12
+export CG_TestGun_f
+proc CG_TestGun_f 0 0
+ADDRGP4 CG_TestModel_f
+CALLV
+pop
+ADDRGP4 cg+132100
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+131896+4
+CNSTI4 13
+ASGNI4
+LABELV $133
+endproc CG_TestGun_f 0 0
+export CG_TestModelNextFrame_f
+proc CG_TestModelNextFrame_f 4 8
+ADDRLP4 0
+ADDRGP4 cg+131896+80
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $140
+ARGP4
+ADDRGP4 cg+131896+80
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $137
+endproc CG_TestModelNextFrame_f 4 8
+export CG_TestModelPrevFrame_f
+proc CG_TestModelPrevFrame_f 4 8
+ADDRLP4 0
+ADDRGP4 cg+131896+80
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 cg+131896+80
+INDIRI4
+CNSTI4 0
+GEI4 $146
+ADDRGP4 cg+131896+80
+CNSTI4 0
+ASGNI4
+LABELV $146
+ADDRGP4 $140
+ARGP4
+ADDRGP4 cg+131896+80
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $143
+endproc CG_TestModelPrevFrame_f 4 8
+export CG_TestModelNextSkin_f
+proc CG_TestModelNextSkin_f 4 8
+ADDRLP4 0
+ADDRGP4 cg+131896+104
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $157
+ARGP4
+ADDRGP4 cg+131896+104
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $154
+endproc CG_TestModelNextSkin_f 4 8
+export CG_TestModelPrevSkin_f
+proc CG_TestModelPrevSkin_f 4 8
+ADDRLP4 0
+ADDRGP4 cg+131896+104
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 cg+131896+104
+INDIRI4
+CNSTI4 0
+GEI4 $163
+ADDRGP4 cg+131896+104
+CNSTI4 0
+ASGNI4
+LABELV $163
+ADDRGP4 $157
+ARGP4
+ADDRGP4 cg+131896+104
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $160
+endproc CG_TestModelPrevSkin_f 4 8
+proc CG_AddTestModel 32 4
+ADDRGP4 cg+132036
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cg+131896+8
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+131896+8
+INDIRI4
+CNSTI4 0
+NEI4 $175
+ADDRGP4 $102
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $171
+JUMPV
+LABELV $175
+ADDRGP4 cg+132100
+INDIRI4
+CNSTI4 0
+EQI4 $179
+ADDRGP4 cg+131896+68
+ADDRGP4 cg+110648+24
+INDIRB
+ASGNB 12
+ADDRGP4 cg+131896+28
+ADDRGP4 cg+110648+36
+INDIRB
+ASGNB 12
+ADDRGP4 cg+131896+28+12
+ADDRGP4 cg+110648+36+12
+INDIRB
+ASGNB 12
+ADDRGP4 cg+131896+28+24
+ADDRGP4 cg+110648+36+24
+INDIRB
+ASGNB 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $202
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg+131896+68
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg+110648+36
+ADDP4
+INDIRF4
+ADDRGP4 cg_gun_x+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+131896+68
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+110648+36+12
+ADDP4
+INDIRF4
+ADDRGP4 cg_gun_y+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 24
+INDIRI4
+ADDRGP4 cg+131896+68
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 cg+110648+36+24
+ADDP4
+INDIRF4
+ADDRGP4 cg_gun_z+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $203
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $202
+LABELV $179
+ADDRGP4 cg+131896
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $171
+endproc CG_AddTestModel 32 4
+proc CG_CalcVrect 12 0
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $225
+ADDRLP4 0
+CNSTI4 100
+ASGNI4
+ADDRGP4 $226
+JUMPV
+LABELV $225
+ADDRLP4 0
+CNSTI4 100
+ASGNI4
+LABELV $226
+ADDRGP4 cg+110648+8
+ADDRGP4 cgs+20100+11304
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 100
+DIVI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg+110648+8
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+ADDRGP4 cg+110648+12
+ADDRGP4 cgs+20100+11308
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 100
+DIVI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 cg+110648+12
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+ADDRGP4 cg+110648
+ADDRGP4 cgs+20100+11304
+INDIRI4
+ADDRGP4 cg+110648+8
+INDIRI4
+SUBI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRGP4 cg+110648+4
+ADDRGP4 cgs+20100+11308
+INDIRI4
+ADDRGP4 cg+110648+12
+INDIRI4
+SUBI4
+CNSTI4 2
+DIVI4
+ASGNI4
+LABELV $224
+endproc CG_CalcVrect 12 0
+lit
+align 4
+LABELV MIN_3RD_DIST
+byte 4 1101004800
+data
+align 4
+LABELV $252
+byte 4 3229614080
+byte 4 3229614080
+byte 4 3229614080
+align 4
+LABELV $253
+byte 4 1082130432
+byte 4 1082130432
+byte 4 1082130432
+code
+proc CG_OffsetThirdPersonView 192 28
+ADDRLP4 140
+ADDRGP4 cg+110648+24+8
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ADDRLP4 140
+INDIRP4
+INDIRF4
+ADDRGP4 cg+108604+164
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 56
+ADDRGP4 cg+111016
+INDIRB
+ASGNB 12
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+108604+184
+INDIRI4
+ADDRLP4 144
+INDIRI4
+GTI4 $260
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 4
+NEI4 $266
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+ADDRLP4 144
+INDIRI4
+LTI4 $260
+LABELV $266
+ADDRLP4 56+4
+ADDRGP4 cg+108604+184+16
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 cg+111016+4
+ADDRGP4 cg+108604+184+16
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $260
+ADDRLP4 56
+INDIRF4
+CNSTF4 1110704128
+LEF4 $276
+ADDRLP4 56
+CNSTF4 1110704128
+ASGNF4
+LABELV $276
+ADDRLP4 56
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 148
+CNSTP4 0
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 152
+CNSTF4 1140850688
+ASGNF4
+ADDRLP4 12
+ADDRGP4 cg+110648+24
+INDIRF4
+ADDRLP4 152
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+ADDRLP4 152
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRGP4 cg+110648+24+8
+INDIRF4
+CNSTF4 1140850688
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg+110648+24
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 156
+ADDRGP4 cg+111016
+ASGNP4
+ADDRLP4 156
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 156
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+111016
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 128
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+CNSTF4 1078530011
+ADDRGP4 cg_thirdPersonAngle+8
+INDIRF4
+CNSTF4 1127481344
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 160
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 160
+INDIRF4
+ASGNF4
+CNSTF4 1078530011
+ADDRGP4 cg_thirdPersonAngle+8
+INDIRF4
+CNSTF4 1127481344
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 164
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 164
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRGP4 cg_thirdPersonRange+8
+INDIRF4
+NEGF4
+ADDRLP4 48
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+ADDRGP4 cg_thirdPersonRange+8
+INDIRF4
+NEGF4
+ADDRLP4 48
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+ADDRGP4 cg_thirdPersonRange+8
+INDIRF4
+NEGF4
+ADDRLP4 48
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDRGP4 cg_thirdPersonRange+8
+INDIRF4
+NEGF4
+ADDRLP4 52
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+ADDRGP4 cg_thirdPersonRange+8
+INDIRF4
+NEGF4
+ADDRLP4 52
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+ADDRGP4 cg_thirdPersonRange+8
+INDIRF4
+NEGF4
+ADDRLP4 52
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg_cameraMode+12
+INDIRI4
+CNSTI4 0
+NEI4 $315
+ADDRLP4 72
+ARGP4
+ADDRGP4 cg+110648+24
+ARGP4
+ADDRGP4 $252
+ARGP4
+ADDRGP4 $253
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cg+108604+140
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 72+8
+INDIRF4
+CNSTF4 1065353216
+EQF4 $322
+ADDRLP4 0
+ADDRLP4 72+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1107296256
+CNSTF4 1065353216
+ADDRLP4 72+8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72
+ARGP4
+ADDRGP4 cg+110648+24
+ARGP4
+ADDRGP4 $252
+ARGP4
+ADDRGP4 $253
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cg+108604+140
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 72+12
+INDIRB
+ASGNB 12
+ADDRGP4 cg+110648+24
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 176
+ADDRGP4 DistanceSquared
+CALLF4
+ASGNF4
+ADDRLP4 180
+ADDRGP4 MIN_3RD_DIST
+INDIRF4
+ASGNF4
+ADDRLP4 176
+INDIRF4
+ADDRLP4 180
+INDIRF4
+ADDRLP4 180
+INDIRF4
+MULF4
+GEF4 $333
+ADDRLP4 0
+ADDRGP4 cg+110648+24
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 184
+ADDRGP4 MIN_3RD_DIST
+INDIRF4
+NEGF4
+ADDRLP4 48
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 184
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+ADDRLP4 184
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+ADDRGP4 MIN_3RD_DIST
+INDIRF4
+NEGF4
+ADDRLP4 48
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 188
+ADDRGP4 MIN_3RD_DIST
+INDIRF4
+NEGF4
+ADDRLP4 52
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 188
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+ADDRLP4 188
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+ADDRGP4 MIN_3RD_DIST
+INDIRF4
+NEGF4
+ADDRLP4 52
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $333
+LABELV $322
+LABELV $315
+ADDRGP4 cg+110648+24
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRGP4 cg+110648+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+ADDRGP4 cg+110648+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 176
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 176
+INDIRF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 180
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 180
+INDIRF4
+ASGNF4
+ADDRLP4 68
+INDIRF4
+CNSTF4 1065353216
+GEF4 $368
+ADDRLP4 68
+CNSTF4 1065353216
+ASGNF4
+LABELV $368
+ADDRLP4 12+8
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 184
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRGP4 cg+111016
+CNSTF4 3261411041
+ADDRLP4 184
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 188
+ADDRGP4 cg+111016+4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+ADDRLP4 188
+INDIRP4
+INDIRF4
+ADDRGP4 cg_thirdPersonAngle+8
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $251
+endproc CG_OffsetThirdPersonView 192 28
+proc CG_StepOffset 8 0
+ADDRLP4 0
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 cg+110480
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 200
+GEI4 $378
+ADDRLP4 4
+ADDRGP4 cg+110648+24+8
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 cg+110476
+INDIRF4
+CNSTI4 200
+ADDRLP4 0
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1128792064
+DIVF4
+SUBF4
+ASGNF4
+LABELV $378
+LABELV $375
+endproc CG_StepOffset 8 0
+proc CG_OffsetFirstPersonView 80 0
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $385
+ADDRGP4 $384
+JUMPV
+LABELV $385
+ADDRLP4 20
+ADDRGP4 cg+110648+24
+ASGNP4
+ADDRLP4 4
+ADDRGP4 cg+111016
+ASGNP4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+GTI4 $391
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 4
+NEI4 $396
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LTI4 $391
+LABELV $396
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1109393408
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTF4 3245342720
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 20
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+ADDRGP4 cg+108604+164
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRGP4 $384
+JUMPV
+LABELV $391
+ADDRGP4 cg+131824
+INDIRF4
+CNSTF4 0
+EQF4 $400
+ADDRLP4 32
+ADDRGP4 cg+107612
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+131824
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1120403456
+GEF4 $405
+ADDRLP4 32
+ADDRLP4 32
+INDIRF4
+CNSTF4 1120403456
+DIVF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRGP4 cg+131872
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRGP4 cg+131876
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $406
+JUMPV
+LABELV $405
+ADDRLP4 32
+CNSTF4 1065353216
+ADDRLP4 32
+INDIRF4
+CNSTF4 1120403456
+SUBF4
+CNSTF4 1137180672
+DIVF4
+SUBF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 0
+LEF4 $409
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRGP4 cg+131872
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRGP4 cg+131876
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $409
+LABELV $406
+LABELV $400
+ADDRLP4 8
+ADDRGP4 cg+108604+32
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ADDRGP4 cg+110648+36
+INDIRF4
+MULF4
+ADDRLP4 8+4
+INDIRF4
+ADDRGP4 cg+110648+36+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 8+8
+INDIRF4
+ADDRGP4 cg+110648+36+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRGP4 cg_runpitch+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ADDRGP4 cg+110648+36+12
+INDIRF4
+MULF4
+ADDRLP4 8+4
+INDIRF4
+ADDRGP4 cg+110648+36+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 8+8
+INDIRF4
+ADDRGP4 cg+110648+36+12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRGP4 cg_runroll+8
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRGP4 cg+131888
+INDIRF4
+CNSTF4 1128792064
+LEF4 $443
+ADDRLP4 56
+ADDRGP4 cg+131888
+INDIRF4
+ASGNF4
+ADDRGP4 $444
+JUMPV
+LABELV $443
+ADDRLP4 56
+CNSTF4 1128792064
+ASGNF4
+LABELV $444
+ADDRLP4 28
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg+131880
+INDIRF4
+ADDRGP4 cg_bobpitch+8
+INDIRF4
+MULF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+108604+12
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $447
+ADDRLP4 0
+CNSTF4 1077936128
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+LABELV $447
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg+131880
+INDIRF4
+ADDRGP4 cg_bobroll+8
+INDIRF4
+MULF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+108604+12
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $453
+ADDRLP4 0
+CNSTF4 1077936128
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+LABELV $453
+ADDRGP4 cg+131884
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $457
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $457
+ADDRLP4 64
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 20
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+ADDRGP4 cg+108604+164
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 cg+110488
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 100
+GEI4 $464
+ADDRLP4 72
+ADDRGP4 cg+110648+24+8
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRF4
+ADDRGP4 cg+110484
+INDIRF4
+CNSTI4 100
+ADDRLP4 36
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1120403456
+DIVF4
+SUBF4
+ASGNF4
+LABELV $464
+ADDRLP4 24
+ADDRGP4 cg+131880
+INDIRF4
+ADDRGP4 cg+131888
+INDIRF4
+MULF4
+ADDRGP4 cg_bobup+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 1086324736
+LEF4 $473
+ADDRLP4 24
+CNSTF4 1086324736
+ASGNF4
+LABELV $473
+ADDRLP4 72
+ADDRLP4 20
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 cg+110496
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1125515264
+GEF4 $477
+ADDRLP4 40
+ADDRLP4 0
+INDIRF4
+CNSTF4 1125515264
+DIVF4
+ASGNF4
+ADDRLP4 76
+ADDRGP4 cg+110648+24+8
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+ADDRGP4 cg+110492
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $478
+JUMPV
+LABELV $477
+ADDRLP4 0
+INDIRF4
+CNSTF4 1138819072
+GEF4 $483
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1125515264
+SUBF4
+ASGNF4
+ADDRLP4 40
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRF4
+CNSTF4 1133903872
+DIVF4
+SUBF4
+ASGNF4
+ADDRLP4 76
+ADDRGP4 cg+110648+24+8
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+ADDRGP4 cg+110492
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $483
+LABELV $478
+ADDRGP4 CG_StepOffset
+CALLV
+pop
+LABELV $384
+endproc CG_OffsetFirstPersonView 80 0
+export CG_ZoomDown_f
+proc CG_ZoomDown_f 8 0
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $490
+ADDRGP4 $489
+JUMPV
+LABELV $490
+ADDRGP4 cg+111032
+INDIRI4
+CNSTI4 0
+EQI4 $493
+ADDRGP4 $489
+JUMPV
+LABELV $493
+ADDRGP4 cg+111040
+INDIRI4
+CNSTI4 0
+EQI4 $496
+ADDRGP4 cg+111040
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+111044
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRGP4 $489
+JUMPV
+LABELV $496
+ADDRLP4 0
+CNSTI4 188
+ASGNI4
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 7
+EQI4 $502
+ADDRGP4 cg+44
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 10
+EQI4 $502
+ADDRGP4 $489
+JUMPV
+LABELV $502
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+ADDRLP4 4
+INDIRI4
+NEI4 $511
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 4
+NEI4 $506
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GTI4 $506
+LABELV $511
+ADDRGP4 $489
+JUMPV
+LABELV $506
+ADDRGP4 cg+111036
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+111032
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+111040
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+111044
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+LABELV $489
+endproc CG_ZoomDown_f 8 0
+export CG_ZoomUp_f
+proc CG_ZoomUp_f 0 0
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $518
+ADDRGP4 $517
+JUMPV
+LABELV $518
+ADDRGP4 cg+111036
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+111032
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $523
+ADDRGP4 cg+111040
+CNSTI4 0
+ASGNI4
+LABELV $523
+LABELV $517
+endproc CG_ZoomUp_f 0 0
+proc CG_CalcFov 56 8
+ADDRGP4 cg+108604+4
+INDIRI4
+CNSTI4 5
+NEI4 $528
+ADDRLP4 0
+CNSTF4 1119092736
+ASGNF4
+ADDRGP4 $529
+JUMPV
+LABELV $528
+ADDRGP4 cgs+31468
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $532
+ADDRLP4 0
+CNSTF4 1119092736
+ASGNF4
+ADDRGP4 $533
+JUMPV
+LABELV $532
+ADDRLP4 0
+ADDRGP4 cg_fov+8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1065353216
+GEF4 $536
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $537
+JUMPV
+LABELV $536
+ADDRLP4 0
+INDIRF4
+CNSTF4 1121058816
+LEF4 $538
+ADDRLP4 0
+CNSTF4 1121058816
+ASGNF4
+LABELV $538
+LABELV $537
+LABELV $533
+ADDRLP4 8
+ADDRGP4 cg_zoomFov+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $541
+ADDRLP4 8
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $542
+JUMPV
+LABELV $541
+ADDRLP4 8
+INDIRF4
+CNSTF4 1126170624
+LEF4 $543
+ADDRLP4 8
+CNSTF4 1126170624
+ASGNF4
+LABELV $543
+LABELV $542
+ADDRLP4 8
+CNSTF4 1084227584
+ASGNF4
+ADDRGP4 cg+111040
+INDIRI4
+CNSTI4 0
+EQI4 $545
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $548
+ADDRGP4 cg+111032
+INDIRI4
+CNSTI4 0
+EQI4 $551
+ADDRLP4 32
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 cg+111044
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1157234688
+DIVF4
+ASGNF4
+ADDRGP4 cg+111028
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRGP4 cg+111028
+INDIRF4
+CNSTF4 1065353216
+LEF4 $557
+ADDRGP4 cg+111028
+CNSTF4 1065353216
+ASGNF4
+LABELV $557
+LABELV $551
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 cg+111028
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $546
+JUMPV
+LABELV $548
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $546
+ADDRLP4 8
+CNSTF4 1101004800
+ASGNF4
+ADDRLP4 32
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 cg+111044
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1125515264
+DIVF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1065353216
+LEF4 $567
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 $546
+JUMPV
+LABELV $567
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $546
+JUMPV
+LABELV $545
+ADDRLP4 32
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 cg+111044
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1125515264
+DIVF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1065353216
+GTF4 $571
+ADDRLP4 36
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 36
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $571
+LABELV $546
+LABELV $529
+CNSTF4 1078530011
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 tan
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRGP4 cg+110648+8
+INDIRI4
+CVIF4 4
+ADDRLP4 36
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 cg+110648+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 1135869952
+ADDRLP4 4
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ASGNF4
+ADDRGP4 cg+110648+24
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $579
+ADDRLP4 28
+CNSTF4 1073741824
+CNSTF4 1078530011
+CNSTF4 1053609165
+ADDRGP4 cg+107612
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+MULF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1065353216
+ADDRLP4 48
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 52
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $580
+JUMPV
+LABELV $579
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $580
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 360
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $582
+ADDRGP4 cg+131888
+INDIRF4
+CNSTF4 1140457472
+LEF4 $585
+ADDRGP4 cg+108576
+INDIRF4
+CNSTF4 1069547520
+GEF4 $586
+ADDRLP4 48
+ADDRGP4 cg+108576
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+CNSTF4 981668463
+ADDRGP4 cg+107608
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $586
+JUMPV
+LABELV $585
+ADDRGP4 cg+108576
+INDIRF4
+CNSTF4 1065353216
+LEF4 $593
+ADDRLP4 48
+ADDRGP4 cg+108576
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+CNSTF4 981668463
+ADDRGP4 cg+107608
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+ASGNF4
+ADDRGP4 $594
+JUMPV
+LABELV $593
+ADDRGP4 cg+108576
+INDIRF4
+CNSTF4 1065353216
+GEF4 $598
+ADDRGP4 cg+108576
+CNSTF4 1065353216
+ASGNF4
+LABELV $598
+LABELV $594
+LABELV $586
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 cg+108576
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRGP4 cg+108576
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $583
+JUMPV
+LABELV $582
+ADDRGP4 cg+108576
+CNSTF4 1065353216
+ASGNF4
+LABELV $583
+ADDRGP4 cg+110648+16
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 cg+110648+20
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 cg+111040
+INDIRI4
+CNSTI4 0
+NEI4 $609
+ADDRGP4 cg+111048
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $610
+JUMPV
+LABELV $609
+ADDRGP4 cg+111048
+ADDRGP4 cg+110648+20
+INDIRF4
+CNSTF4 1117126656
+DIVF4
+ASGNF4
+LABELV $610
+ADDRLP4 20
+INDIRI4
+RETI4
+LABELV $527
+endproc CG_CalcFov 56 8
+proc CG_DamageBlendBlob 0 0
+LABELV $616
+endproc CG_DamageBlendBlob 0 0
+proc CG_CalcViewValues 40 12
+ADDRGP4 cg+110648
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 368
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 CG_CalcVrect
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 cg+108604
+ASGNP4
+ADDRGP4 cg+132384
+INDIRI4
+CNSTI4 0
+EQI4 $621
+ADDRLP4 4
+ADDRGP4 cg_fov+8
+INDIRF4
+ASGNF4
+ADDRGP4 cg+110648+24
+ADDRGP4 cg+132360
+INDIRB
+ASGNB 12
+ADDRGP4 cg+111016
+ADDRGP4 cg+132372
+INDIRB
+ASGNB 12
+ADDRGP4 cg+111016
+ARGP4
+ADDRGP4 cg+110648+36
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+CNSTF4 1078530011
+ADDRLP4 4
+INDIRF4
+CNSTF4 1135869952
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 tan
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRGP4 cg+110648+8
+INDIRI4
+CVIF4 4
+ADDRLP4 12
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 cg+110648+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRGP4 cg+110648+20
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRGP4 cg+110648+20
+CNSTF4 1135869952
+ADDRGP4 cg+110648+20
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ASGNF4
+ADDRGP4 cg+110648+16
+ADDRLP4 4
+INDIRF4
+ASGNF4
+CNSTI4 0
+RETI4
+ADDRGP4 $617
+JUMPV
+LABELV $621
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $645
+ADDRGP4 cg+110648+24
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+111016
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+111016
+ARGP4
+ADDRGP4 cg+110648+36
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 CG_CalcFov
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $617
+JUMPV
+LABELV $645
+ADDRGP4 cg+112080
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+131884
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 7
+RSHI4
+ASGNI4
+CNSTF4 1078530011
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 127
+BANDI4
+CVIF4 4
+CNSTF4 1123942400
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRGP4 cg+131880
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRGP4 cg+131888
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 cg+110648+24
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+111016
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg_cameraOrbit+12
+INDIRI4
+CNSTI4 0
+EQI4 $660
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 cg+131892
+INDIRI4
+LEI4 $663
+ADDRGP4 cg+131892
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 cg_cameraOrbitDelay+12
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cg_thirdPersonAngle+8
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ADDRGP4 cg_cameraOrbit+8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $663
+LABELV $660
+ADDRGP4 cg_errorDecay+8
+INDIRF4
+CNSTF4 0
+LEF4 $672
+ADDRLP4 32
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 cg+109884
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cg_errorDecay+8
+INDIRF4
+ADDRLP4 32
+INDIRI4
+CVIF4 4
+SUBF4
+ADDRGP4 cg_errorDecay+8
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+CNSTF4 0
+LEF4 $679
+ADDRLP4 36
+INDIRF4
+CNSTF4 1065353216
+GEF4 $679
+ADDRGP4 cg+110648+24
+ADDRGP4 cg+110648+24
+INDIRF4
+ADDRGP4 cg+109888
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+110648+24+4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+ADDRGP4 cg+109888+4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+110648+24+8
+ADDRGP4 cg+110648+24+8
+INDIRF4
+ADDRGP4 cg+109888+8
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $680
+JUMPV
+LABELV $679
+ADDRGP4 cg+109884
+CNSTI4 0
+ASGNI4
+LABELV $680
+LABELV $672
+ADDRGP4 cg+108596
+INDIRI4
+CNSTI4 0
+EQI4 $703
+ADDRGP4 CG_OffsetThirdPersonView
+CALLV
+pop
+ADDRGP4 $704
+JUMPV
+LABELV $703
+ADDRGP4 CG_OffsetFirstPersonView
+CALLV
+pop
+LABELV $704
+ADDRGP4 cg+111016
+ARGP4
+ADDRGP4 cg+110648+36
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRGP4 cg+108600
+INDIRI4
+CNSTI4 0
+EQI4 $709
+ADDRLP4 28
+ADDRGP4 cg+110648+76
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 5
+BORI4
+ASGNI4
+LABELV $709
+ADDRLP4 28
+ADDRGP4 CG_CalcFov
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+RETI4
+LABELV $617
+endproc CG_CalcViewValues 40 12
+proc CG_PowerupTimerSounds 16 16
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $715
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 356
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+GTI4 $720
+ADDRGP4 $716
+JUMPV
+LABELV $720
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+SUBI4
+CNSTI4 5000
+LTI4 $723
+ADDRGP4 $716
+JUMPV
+LABELV $723
+ADDRLP4 12
+CNSTI4 1000
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+SUBI4
+ADDRLP4 12
+INDIRI4
+DIVI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+107616
+INDIRI4
+SUBI4
+ADDRLP4 12
+INDIRI4
+DIVI4
+EQI4 $726
+CNSTP4 0
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 cgs+160652+1128
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $726
+LABELV $716
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+LTI4 $715
+LABELV $714
+endproc CG_PowerupTimerSounds 16 16
+export CG_AddBufferedSound
+proc CG_AddBufferedSound 4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $734
+ADDRGP4 $733
+JUMPV
+LABELV $734
+ADDRGP4 cg+131700
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+131712
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+131700
+ADDRGP4 cg+131700
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 20
+MODI4
+ASGNI4
+ADDRGP4 cg+131700
+INDIRI4
+ADDRGP4 cg+131704
+INDIRI4
+NEI4 $740
+ADDRLP4 0
+ADDRGP4 cg+131704
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $740
+LABELV $733
+endproc CG_AddBufferedSound 4 0
+proc CG_PlayBufferedSounds 0 8
+ADDRGP4 cg+131708
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+GEI4 $746
+ADDRGP4 cg+131704
+INDIRI4
+ADDRGP4 cg+131700
+INDIRI4
+EQI4 $750
+ADDRGP4 cg+131704
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+131712
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $750
+ADDRGP4 cg+131704
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+131712
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 cg+131704
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+131712
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+131704
+ADDRGP4 cg+131704
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 20
+MODI4
+ASGNI4
+ADDRGP4 cg+131708
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 750
+ADDI4
+ASGNI4
+LABELV $750
+LABELV $746
+LABELV $745
+endproc CG_PlayBufferedSounds 0 8
+export CG_FlushSceneBatches
+proc CG_FlushSceneBatches 0 16
+ADDRGP4 numBatchEntities
+INDIRI4
+CNSTI4 0
+EQI4 $765
+ADDRGP4 batchEntities
+ARGP4
+ADDRGP4 numBatchEntities
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_AddRefEntitiesToScene
+CALLV
+pop
+ADDRGP4 numBatchEntities
+CNSTI4 0
+ASGNI4
+LABELV $765
+ADDRGP4 numBatchPolys
+INDIRI4
+CNSTI4 0
+EQI4 $767
+ADDRGP4 batchShader
+INDIRI4
+ARGI4
+ADDRGP4 batchPolyVerts
+INDIRI4
+ARGI4
+ADDRGP4 batchVerts
+ARGP4
+ADDRGP4 numBatchPolys
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_AddPolysToScene
+CALLV
+pop
+ADDRGP4 numBatchPolys
+CNSTI4 0
+ASGNI4
+LABELV $767
+LABELV $764
+endproc CG_FlushSceneBatches 0 16
+export CG_AddRefEntityBatched
+proc CG_AddRefEntityBatched 8 8
+ADDRGP4 numBatchEntities
+INDIRI4
+CNSTI4 64
+NEI4 $770
+ADDRGP4 batchEntities
+ARGP4
+ADDRGP4 numBatchEntities
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_AddRefEntitiesToScene
+CALLV
+pop
+ADDRGP4 numBatchEntities
+CNSTI4 0
+ASGNI4
+LABELV $770
+ADDRLP4 4
+ADDRGP4 numBatchEntities
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 batchEntities
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 140
+LABELV $769
+endproc CG_AddRefEntityBatched 8 8
+export CG_AddPolyBatched
+proc CG_AddPolyBatched 16 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 numBatchPolys
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $773
+ADDRFP4 0
+INDIRI4
+ADDRGP4 batchShader
+INDIRI4
+NEI4 $776
+ADDRFP4 4
+INDIRI4
+ADDRGP4 batchPolyVerts
+INDIRI4
+NEI4 $776
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRFP4 4
+INDIRI4
+MULI4
+CNSTI4 1024
+LEI4 $773
+LABELV $776
+ADDRGP4 batchShader
+INDIRI4
+ARGI4
+ADDRGP4 batchPolyVerts
+INDIRI4
+ARGI4
+ADDRGP4 batchVerts
+ARGP4
+ADDRGP4 numBatchPolys
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_AddPolysToScene
+CALLV
+pop
+ADDRGP4 numBatchPolys
+CNSTI4 0
+ASGNI4
+LABELV $773
+ADDRGP4 batchShader
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 batchPolyVerts
+ADDRFP4 4
+INDIRI4
+ASGNI4
+CNSTI4 24
+ADDRGP4 numBatchPolys
+INDIRI4
+ADDRFP4 4
+INDIRI4
+MULI4
+MULI4
+ADDRGP4 batchVerts
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTU4 24
+ADDRFP4 4
+INDIRI4
+CVIU4 4
+MULU4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 12
+ADDRGP4 numBatchPolys
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $772
+endproc CG_AddPolyBatched 16 16
+export CG_DrawActiveFrame
+proc CG_DrawActiveFrame 308 16
+ADDRLP4 0
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cg+107612
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRGP4 cg+107620
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 cg+8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 cg_thirdPersonAutoSwitch+12
+INDIRI4
+CNSTI4 1
+NEI4 $781
+ADDRGP4 cg+110500
+INDIRI4
+CNSTI4 1
+NEI4 $784
+ADDRGP4 cg_thirdPerson+12
+INDIRI4
+CNSTI4 0
+NEI4 $784
+ADDRGP4 $788
+ARGP4
+ADDRGP4 $789
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $785
+JUMPV
+LABELV $784
+ADDRGP4 cg+110500
+INDIRI4
+CNSTI4 1
+EQI4 $790
+ADDRGP4 cg_thirdPerson+12
+INDIRI4
+CNSTI4 0
+EQI4 $790
+ADDRGP4 $788
+ARGP4
+ADDRGP4 $794
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $790
+LABELV $785
+LABELV $781
+ADDRGP4 CG_UpdateCvars
+CALLV
+pop
+ADDRGP4 cg+112076
+INDIRF4
+CNSTF4 1065353216
+GEF4 $795
+ADDRGP4 CG_DrawInformation
+CALLV
+pop
+ADDRGP4 $777
+JUMPV
+LABELV $795
+ADDRGP4 cg
+INDIRI4
+CNSTI4 255
+BANDI4
+CNSTI4 0
+NEI4 $798
+ADDRGP4 $800
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $798
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_ClearLoopingSounds
+CALLV
+pop
+ADDRGP4 trap_R_ClearScene
+CALLV
+pop
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $801
+ADDRLP4 0
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $801
+ADDRGP4 CG_StreamAssets
+CALLV
+pop
+ADDRGP4 CG_ProcessSnapshots
+CALLV
+pop
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $809
+ADDRGP4 cg+44
+INDIRP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $805
+LABELV $809
+ADDRGP4 CG_DrawInformation
+CALLV
+pop
+ADDRGP4 $777
+JUMPV
+LABELV $805
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $810
+ADDRGP4 CG_ForceModelChange
+CALLV
+pop
+LABELV $810
+ADDRGP4 cg+110500
+INDIRI4
+ARGI4
+ADDRGP4 cg+111048
+INDIRF4
+ARGF4
+ADDRGP4 trap_SetUserCmdValue
+CALLV
+pop
+ADDRLP4 12
+ADDRGP4 cg
+ASGNP4
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $815
+ADDRLP4 20
+ARGP4
+ADDRGP4 trap_RealTime
+CALLI4
+pop
+ADDRLP4 20
+INDIRI4
+CNSTI4 3
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+1436
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $815
+ADDRGP4 CG_PredictPlayerState
+CALLV
+pop
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_thirdPerson+12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $828
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+GTI4 $825
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 4
+NEI4 $828
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LTI4 $825
+LABELV $828
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $826
+JUMPV
+LABELV $825
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $826
+ADDRGP4 cg+108596
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 CG_CalcViewValues
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 cg+107648
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $829
+ADDRLP4 164
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 12
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 32
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 96
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 164+8
+ADDRLP4 32
+ASGNP4
+ADDRLP4 164+4
+CNSTI4 4
+ASGNI4
+ADDRLP4 188
+CNSTU1 255
+ASGNU1
+ADDRLP4 32+72+20
+ADDRLP4 188
+INDIRU1
+ASGNU1
+ADDRLP4 32+48+20
+ADDRLP4 188
+INDIRU1
+ASGNU1
+ADDRLP4 32+24+20
+ADDRLP4 188
+INDIRU1
+ASGNU1
+ADDRLP4 32+20
+ADDRLP4 188
+INDIRU1
+ASGNU1
+ADDRLP4 189
+CNSTU1 255
+ASGNU1
+ADDRLP4 32+72+20+1
+ADDRLP4 189
+INDIRU1
+ASGNU1
+ADDRLP4 32+48+20+1
+ADDRLP4 189
+INDIRU1
+ASGNU1
+ADDRLP4 32+24+20+1
+ADDRLP4 189
+INDIRU1
+ASGNU1
+ADDRLP4 32+20+1
+ADDRLP4 189
+INDIRU1
+ASGNU1
+ADDRLP4 190
+CNSTU1 255
+ASGNU1
+ADDRLP4 32+72+20+2
+ADDRLP4 190
+INDIRU1
+ASGNU1
+ADDRLP4 32+48+20+2
+ADDRLP4 190
+INDIRU1
+ASGNU1
+ADDRLP4 32+24+20+2
+ADDRLP4 190
+INDIRU1
+ASGNU1
+ADDRLP4 32+20+2
+ADDRLP4 190
+INDIRU1
+ASGNU1
+ADDRLP4 191
+CNSTU1 255
+ASGNU1
+ADDRLP4 32+72+20+3
+ADDRLP4 191
+INDIRU1
+ASGNU1
+ADDRLP4 32+48+20+3
+ADDRLP4 191
+INDIRU1
+ASGNU1
+ADDRLP4 32+24+20+3
+ADDRLP4 191
+INDIRU1
+ASGNU1
+ADDRLP4 32+20+3
+ADDRLP4 191
+INDIRU1
+ASGNU1
+ADDRLP4 32+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 32+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 32+24+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 32+24+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 32+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 32+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 32+72+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 32+72+12+4
+CNSTF4 1065353216
+ASGNF4
+CNSTF4 953267991
+ADDRGP4 cg+107612
+INDIRI4
+CVIF4 4
+MULF4
+ADDRGP4 cg+107788
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 192
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 176
+ADDRGP4 cg+107776
+INDIRF4
+ADDRLP4 192
+INDIRF4
+MULF4
+ASGNF4
+CNSTF4 953267991
+ADDRGP4 cg+107612
+INDIRI4
+CVIF4 4
+MULF4
+ADDRGP4 cg+107788+4
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 196
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 176+4
+ADDRGP4 cg+107776+4
+INDIRF4
+ADDRLP4 196
+INDIRF4
+MULF4
+ASGNF4
+CNSTF4 953267991
+ADDRGP4 cg+107612
+INDIRI4
+CVIF4 4
+MULF4
+ADDRGP4 cg+107788+8
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 200
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 176+8
+ADDRGP4 cg+107776+8
+INDIRF4
+ADDRLP4 200
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 176
+ARGP4
+ADDRLP4 128
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 204
+CNSTF4 1132378194
+ASGNF4
+ADDRLP4 208
+CNSTF4 1132462080
+ASGNF4
+ADDRLP4 32
+ADDRGP4 cg+110648+24
+INDIRF4
+ADDRLP4 204
+INDIRF4
+ADDRLP4 128
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 208
+INDIRF4
+ADDRLP4 152
+INDIRF4
+NEGF4
+ADDRLP4 140
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+ADDRLP4 204
+INDIRF4
+ADDRLP4 128+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 208
+INDIRF4
+ADDRLP4 152+4
+INDIRF4
+NEGF4
+ADDRLP4 140+4
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+8
+ADDRGP4 cg+110648+24+8
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 128+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1132462080
+ADDRLP4 152+8
+INDIRF4
+NEGF4
+ADDRLP4 140+8
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+24
+ADDRGP4 cg+110648+24
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 128
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1132462080
+ADDRLP4 152
+INDIRF4
+ADDRLP4 140
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+24+4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 128+4
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1132462080
+ADDRLP4 152+4
+INDIRF4
+ADDRLP4 140+4
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+24+8
+ADDRGP4 cg+110648+24+8
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 128+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1132462080
+ADDRLP4 152+8
+INDIRF4
+ADDRLP4 140+8
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+48
+ADDRGP4 cg+110648+24
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 128
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1132462080
+ADDRLP4 152
+INDIRF4
+ADDRLP4 140
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+48+4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 128+4
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1132462080
+ADDRLP4 152+4
+INDIRF4
+ADDRLP4 140+4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+48+8
+ADDRGP4 cg+110648+24+8
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 128+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1132462080
+ADDRLP4 152+8
+INDIRF4
+ADDRLP4 140+8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+72
+ADDRGP4 cg+110648+24
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 128
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1132462080
+ADDRLP4 152
+INDIRF4
+NEGF4
+ADDRLP4 140
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+72+4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 128+4
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1132462080
+ADDRLP4 152+4
+INDIRF4
+NEGF4
+ADDRLP4 140+4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+72+8
+ADDRGP4 cg+110648+24+8
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 128+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1132462080
+ADDRLP4 152+8
+INDIRF4
+NEGF4
+ADDRLP4 140+8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $980
+ARGP4
+ADDRGP4 cg+107648
+ARGP4
+ADDRLP4 212
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 212
+INDIRP4
+ARGP4
+ADDRLP4 216
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 164
+ADDRLP4 216
+INDIRI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+ARGI4
+ADDRLP4 164+4
+INDIRI4
+ARGI4
+ADDRLP4 164+8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+ADDRLP4 220
+CNSTF4 1132378194
+ASGNF4
+ADDRLP4 224
+CNSTF4 1132462080
+ASGNF4
+ADDRLP4 32
+ADDRGP4 cg+110648+24
+INDIRF4
+ADDRLP4 220
+INDIRF4
+ADDRLP4 128
+INDIRF4
+MULF4
+SUBF4
+ADDRLP4 224
+INDIRF4
+ADDRLP4 152
+INDIRF4
+ADDRLP4 140
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+ADDRLP4 220
+INDIRF4
+ADDRLP4 128+4
+INDIRF4
+MULF4
+SUBF4
+ADDRLP4 224
+INDIRF4
+ADDRLP4 152+4
+INDIRF4
+ADDRLP4 140+4
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+8
+ADDRGP4 cg+110648+24+8
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 128+8
+INDIRF4
+MULF4
+SUBF4
+CNSTF4 1132462080
+ADDRLP4 152+8
+INDIRF4
+ADDRLP4 140+8
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+24
+ADDRGP4 cg+110648+24
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 128
+INDIRF4
+MULF4
+SUBF4
+CNSTF4 1132462080
+ADDRLP4 152
+INDIRF4
+NEGF4
+ADDRLP4 140
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+24+4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 128+4
+INDIRF4
+MULF4
+SUBF4
+CNSTF4 1132462080
+ADDRLP4 152+4
+INDIRF4
+NEGF4
+ADDRLP4 140+4
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+24+8
+ADDRGP4 cg+110648+24+8
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 128+8
+INDIRF4
+MULF4
+SUBF4
+CNSTF4 1132462080
+ADDRLP4 152+8
+INDIRF4
+NEGF4
+ADDRLP4 140+8
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+48
+ADDRGP4 cg+110648+24
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 128
+INDIRF4
+MULF4
+SUBF4
+CNSTF4 1132462080
+ADDRLP4 152
+INDIRF4
+NEGF4
+ADDRLP4 140
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+48+4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 128+4
+INDIRF4
+MULF4
+SUBF4
+CNSTF4 1132462080
+ADDRLP4 152+4
+INDIRF4
+NEGF4
+ADDRLP4 140+4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+48+8
+ADDRGP4 cg+110648+24+8
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 128+8
+INDIRF4
+MULF4
+SUBF4
+CNSTF4 1132462080
+ADDRLP4 152+8
+INDIRF4
+NEGF4
+ADDRLP4 140+8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+72
+ADDRGP4 cg+110648+24
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 128
+INDIRF4
+MULF4
+SUBF4
+CNSTF4 1132462080
+ADDRLP4 152
+INDIRF4
+ADDRLP4 140
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+72+4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 128+4
+INDIRF4
+MULF4
+SUBF4
+CNSTF4 1132462080
+ADDRLP4 152+4
+INDIRF4
+ADDRLP4 140+4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+72+8
+ADDRGP4 cg+110648+24+8
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 128+8
+INDIRF4
+MULF4
+SUBF4
+CNSTF4 1132462080
+ADDRLP4 152+8
+INDIRF4
+ADDRLP4 140+8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1057
+ARGP4
+ADDRGP4 cg+107648
+ARGP4
+ADDRLP4 228
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 228
+INDIRP4
+ARGP4
+ADDRLP4 232
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 164
+ADDRLP4 232
+INDIRI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+ARGI4
+ADDRLP4 164+4
+INDIRI4
+ARGI4
+ADDRLP4 164+8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+ADDRLP4 236
+CNSTF4 1132378194
+ASGNF4
+ADDRLP4 240
+CNSTF4 1132462080
+ASGNF4
+ADDRLP4 32
+ADDRGP4 cg+110648+24
+INDIRF4
+ADDRLP4 236
+INDIRF4
+ADDRLP4 152
+INDIRF4
+MULF4
+SUBF4
+ADDRLP4 240
+INDIRF4
+ADDRLP4 128
+INDIRF4
+NEGF4
+ADDRLP4 140
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+ADDRLP4 236
+INDIRF4
+ADDRLP4 152+4
+INDIRF4
+MULF4
+SUBF4
+ADDRLP4 240
+INDIRF4
+ADDRLP4 128+4
+INDIRF4
+NEGF4
+ADDRLP4 140+4
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+8
+ADDRGP4 cg+110648+24+8
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 152+8
+INDIRF4
+MULF4
+SUBF4
+CNSTF4 1132462080
+ADDRLP4 128+8
+INDIRF4
+NEGF4
+ADDRLP4 140+8
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+24
+ADDRGP4 cg+110648+24
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 152
+INDIRF4
+MULF4
+SUBF4
+CNSTF4 1132462080
+ADDRLP4 128
+INDIRF4
+ADDRLP4 140
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+24+4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 152+4
+INDIRF4
+MULF4
+SUBF4
+CNSTF4 1132462080
+ADDRLP4 128+4
+INDIRF4
+ADDRLP4 140+4
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+24+8
+ADDRGP4 cg+110648+24+8
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 152+8
+INDIRF4
+MULF4
+SUBF4
+CNSTF4 1132462080
+ADDRLP4 128+8
+INDIRF4
+ADDRLP4 140+8
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+48
+ADDRGP4 cg+110648+24
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 152
+INDIRF4
+MULF4
+SUBF4
+CNSTF4 1132462080
+ADDRLP4 128
+INDIRF4
+ADDRLP4 140
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+48+4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 152+4
+INDIRF4
+MULF4
+SUBF4
+CNSTF4 1132462080
+ADDRLP4 128+4
+INDIRF4
+ADDRLP4 140+4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+48+8
+ADDRGP4 cg+110648+24+8
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 152+8
+INDIRF4
+MULF4
+SUBF4
+CNSTF4 1132462080
+ADDRLP4 128+8
+INDIRF4
+ADDRLP4 140+8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+72
+ADDRGP4 cg+110648+24
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 152
+INDIRF4
+MULF4
+SUBF4
+CNSTF4 1132462080
+ADDRLP4 128
+INDIRF4
+NEGF4
+ADDRLP4 140
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+72+4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 152+4
+INDIRF4
+MULF4
+SUBF4
+CNSTF4 1132462080
+ADDRLP4 128+4
+INDIRF4
+NEGF4
+ADDRLP4 140+4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+72+8
+ADDRGP4 cg+110648+24+8
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 152+8
+INDIRF4
+MULF4
+SUBF4
+CNSTF4 1132462080
+ADDRLP4 128+8
+INDIRF4
+NEGF4
+ADDRLP4 140+8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1134
+ARGP4
+ADDRGP4 cg+107648
+ARGP4
+ADDRLP4 244
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 244
+INDIRP4
+ARGP4
+ADDRLP4 248
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 164
+ADDRLP4 248
+INDIRI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+ARGI4
+ADDRLP4 164+4
+INDIRI4
+ARGI4
+ADDRLP4 164+8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+ADDRLP4 252
+CNSTF4 1132378194
+ASGNF4
+ADDRLP4 256
+CNSTF4 1132462080
+ASGNF4
+ADDRLP4 32
+ADDRGP4 cg+110648+24
+INDIRF4
+ADDRLP4 252
+INDIRF4
+ADDRLP4 152
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 256
+INDIRF4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 140
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+ADDRLP4 252
+INDIRF4
+ADDRLP4 152+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 256
+INDIRF4
+ADDRLP4 128+4
+INDIRF4
+ADDRLP4 140+4
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+8
+ADDRGP4 cg+110648+24+8
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 152+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1132462080
+ADDRLP4 128+8
+INDIRF4
+ADDRLP4 140+8
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+24
+ADDRGP4 cg+110648+24
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 152
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1132462080
+ADDRLP4 128
+INDIRF4
+NEGF4
+ADDRLP4 140
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+24+4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 152+4
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1132462080
+ADDRLP4 128+4
+INDIRF4
+NEGF4
+ADDRLP4 140+4
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+24+8
+ADDRGP4 cg+110648+24+8
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 152+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1132462080
+ADDRLP4 128+8
+INDIRF4
+NEGF4
+ADDRLP4 140+8
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+48
+ADDRGP4 cg+110648+24
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 152
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1132462080
+ADDRLP4 128
+INDIRF4
+NEGF4
+ADDRLP4 140
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+48+4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 152+4
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1132462080
+ADDRLP4 128+4
+INDIRF4
+NEGF4
+ADDRLP4 140+4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+48+8
+ADDRGP4 cg+110648+24+8
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 152+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1132462080
+ADDRLP4 128+8
+INDIRF4
+NEGF4
+ADDRLP4 140+8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+72
+ADDRGP4 cg+110648+24
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 152
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1132462080
+ADDRLP4 128
+INDIRF4
+ADDRLP4 140
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+72+4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 152+4
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1132462080
+ADDRLP4 128+4
+INDIRF4
+ADDRLP4 140+4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+72+8
+ADDRGP4 cg+110648+24+8
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 152+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1132462080
+ADDRLP4 128+8
+INDIRF4
+ADDRLP4 140+8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1211
+ARGP4
+ADDRGP4 cg+107648
+ARGP4
+ADDRLP4 260
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 260
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 164
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+ARGI4
+ADDRLP4 164+4
+INDIRI4
+ARGI4
+ADDRLP4 164+8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+ADDRLP4 268
+CNSTF4 1132378194
+ASGNF4
+ADDRLP4 272
+CNSTF4 1132462080
+ASGNF4
+ADDRLP4 32
+ADDRGP4 cg+110648+24
+INDIRF4
+ADDRLP4 268
+INDIRF4
+ADDRLP4 140
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 272
+INDIRF4
+ADDRLP4 128
+INDIRF4
+NEGF4
+ADDRLP4 152
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+ADDRLP4 268
+INDIRF4
+ADDRLP4 140+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 272
+INDIRF4
+ADDRLP4 128+4
+INDIRF4
+NEGF4
+ADDRLP4 152+4
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+8
+ADDRGP4 cg+110648+24+8
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 140+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1132462080
+ADDRLP4 128+8
+INDIRF4
+NEGF4
+ADDRLP4 152+8
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+24
+ADDRGP4 cg+110648+24
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 140
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1132462080
+ADDRLP4 128
+INDIRF4
+ADDRLP4 152
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+24+4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 140+4
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1132462080
+ADDRLP4 128+4
+INDIRF4
+ADDRLP4 152+4
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+24+8
+ADDRGP4 cg+110648+24+8
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 140+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1132462080
+ADDRLP4 128+8
+INDIRF4
+ADDRLP4 152+8
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+48
+ADDRGP4 cg+110648+24
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 140
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1132462080
+ADDRLP4 128
+INDIRF4
+ADDRLP4 152
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+48+4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 140+4
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1132462080
+ADDRLP4 128+4
+INDIRF4
+ADDRLP4 152+4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+48+8
+ADDRGP4 cg+110648+24+8
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 140+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1132462080
+ADDRLP4 128+8
+INDIRF4
+ADDRLP4 152+8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+72
+ADDRGP4 cg+110648+24
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 140
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1132462080
+ADDRLP4 128
+INDIRF4
+NEGF4
+ADDRLP4 152
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+72+4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 140+4
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1132462080
+ADDRLP4 128+4
+INDIRF4
+NEGF4
+ADDRLP4 152+4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+72+8
+ADDRGP4 cg+110648+24+8
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 140+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1132462080
+ADDRLP4 128+8
+INDIRF4
+NEGF4
+ADDRLP4 152+8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1288
+ARGP4
+ADDRGP4 cg+107648
+ARGP4
+ADDRLP4 276
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 276
+INDIRP4
+ARGP4
+ADDRLP4 280
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 164
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+ARGI4
+ADDRLP4 164+4
+INDIRI4
+ARGI4
+ADDRLP4 164+8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+ADDRLP4 284
+CNSTF4 1132378194
+ASGNF4
+ADDRLP4 288
+CNSTF4 1132462080
+ASGNF4
+ADDRLP4 32
+ADDRGP4 cg+110648+24
+INDIRF4
+ADDRLP4 284
+INDIRF4
+ADDRLP4 140
+INDIRF4
+MULF4
+SUBF4
+ADDRLP4 288
+INDIRF4
+ADDRLP4 128
+INDIRF4
+NEGF4
+ADDRLP4 152
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+ADDRLP4 284
+INDIRF4
+ADDRLP4 140+4
+INDIRF4
+MULF4
+SUBF4
+ADDRLP4 288
+INDIRF4
+ADDRLP4 128+4
+INDIRF4
+NEGF4
+ADDRLP4 152+4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+8
+ADDRGP4 cg+110648+24+8
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 140+8
+INDIRF4
+MULF4
+SUBF4
+CNSTF4 1132462080
+ADDRLP4 128+8
+INDIRF4
+NEGF4
+ADDRLP4 152+8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+24
+ADDRGP4 cg+110648+24
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 140
+INDIRF4
+MULF4
+SUBF4
+CNSTF4 1132462080
+ADDRLP4 128
+INDIRF4
+ADDRLP4 152
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+24+4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 140+4
+INDIRF4
+MULF4
+SUBF4
+CNSTF4 1132462080
+ADDRLP4 128+4
+INDIRF4
+ADDRLP4 152+4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+24+8
+ADDRGP4 cg+110648+24+8
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 140+8
+INDIRF4
+MULF4
+SUBF4
+CNSTF4 1132462080
+ADDRLP4 128+8
+INDIRF4
+ADDRLP4 152+8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+48
+ADDRGP4 cg+110648+24
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 140
+INDIRF4
+MULF4
+SUBF4
+CNSTF4 1132462080
+ADDRLP4 128
+INDIRF4
+ADDRLP4 152
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+48+4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 140+4
+INDIRF4
+MULF4
+SUBF4
+CNSTF4 1132462080
+ADDRLP4 128+4
+INDIRF4
+ADDRLP4 152+4
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+48+8
+ADDRGP4 cg+110648+24+8
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 140+8
+INDIRF4
+MULF4
+SUBF4
+CNSTF4 1132462080
+ADDRLP4 128+8
+INDIRF4
+ADDRLP4 152+8
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+72
+ADDRGP4 cg+110648+24
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 140
+INDIRF4
+MULF4
+SUBF4
+CNSTF4 1132462080
+ADDRLP4 128
+INDIRF4
+NEGF4
+ADDRLP4 152
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+72+4
+ADDRGP4 cg+110648+24+4
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 140+4
+INDIRF4
+MULF4
+SUBF4
+CNSTF4 1132462080
+ADDRLP4 128+4
+INDIRF4
+NEGF4
+ADDRLP4 152+4
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+72+8
+ADDRGP4 cg+110648+24+8
+INDIRF4
+CNSTF4 1132378194
+ADDRLP4 140+8
+INDIRF4
+MULF4
+SUBF4
+CNSTF4 1132462080
+ADDRLP4 128+8
+INDIRF4
+NEGF4
+ADDRLP4 152+8
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1365
+ARGP4
+ADDRGP4 cg+107648
+ARGP4
+ADDRLP4 292
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 292
+INDIRP4
+ARGP4
+ADDRLP4 296
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 164
+ADDRLP4 296
+INDIRI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+ARGI4
+ADDRLP4 164+4
+INDIRI4
+ARGI4
+ADDRLP4 164+8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+ADDRLP4 300
+ADDRGP4 cg+110648+76
+ASGNP4
+ADDRLP4 300
+INDIRP4
+ADDRLP4 300
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRGP4 cg+110648
+ARGP4
+ADDRGP4 trap_R_RenderScene
+CALLV
+pop
+ADDRLP4 304
+ADDRGP4 cg+110648+76
+ASGNP4
+ADDRLP4 304
+INDIRP4
+ADDRLP4 304
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+LABELV $829
+ADDRGP4 cg+108596
+INDIRI4
+CNSTI4 0
+NEI4 $1374
+ADDRGP4 CG_DamageBlendBlob
+CALLV
+pop
+LABELV $1374
+ADDRGP4 cg+108600
+INDIRI4
+CNSTI4 0
+NEI4 $1377
+ADDRGP4 CG_AddPacketEntities
+CALLV
+pop
+ADDRGP4 CG_AddMarks
+CALLV
+pop
+ADDRGP4 CG_AddParticles
+CALLV
+pop
+ADDRGP4 CG_AddLocalEntities
+CALLV
+pop
+ADDRGP4 AddLogosToScene
+CALLV
+pop
+ADDRGP4 Main_SpriteParticles
+CALLV
+pop
+LABELV $1377
+ADDRGP4 cg+108604
+ARGP4
+ADDRGP4 CG_AddViewWeapon
+CALLV
+pop
+ADDRGP4 CG_PlayBufferedSounds
+CALLV
+pop
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 8
+LTI4 $1381
+ADDRGP4 cg+108580
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+GEI4 $1381
+ADDRGP4 cgs+160652+1456
+INDIRI4
+ARGI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 cg+108580
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 20000
+ADDI4
+ASGNI4
+LABELV $1381
+ADDRGP4 cg+131896+8
+INDIRI4
+CNSTI4 0
+EQI4 $1391
+ADDRGP4 CG_AddTestModel
+CALLV
+pop
+LABELV $1391
+ADDRGP4 cg+110648+72
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRGP4 cg+110648+80
+ARGP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTU4 32
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 CG_PowerupTimerSounds
+CALLV
+pop
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 cg+110648+24
+ARGP4
+ADDRGP4 cg+110648+36
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_Respatialize
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+EQI4 $1408
+ADDRGP4 cg+107608
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 cg+107616
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 cg+107608
+INDIRI4
+CNSTI4 0
+GEI4 $1413
+ADDRGP4 cg+107608
+CNSTI4 0
+ASGNI4
+LABELV $1413
+ADDRGP4 cg+107616
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRGP4 CG_AddLagometerFrameInfo
+CALLV
+pop
+LABELV $1408
+ADDRGP4 cg_timescale+8
+INDIRF4
+ADDRGP4 cg_timescaleFadeEnd+8
+INDIRF4
+EQF4 $1419
+ADDRGP4 cg_timescale+8
+INDIRF4
+ADDRGP4 cg_timescaleFadeEnd+8
+INDIRF4
+GEF4 $1423
+ADDRLP4 32
+ADDRGP4 cg_timescale+8
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRGP4 cg_timescaleFadeSpeed+8
+INDIRF4
+ADDRGP4 cg+107608
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1148846080
+DIVF4
+ADDF4
+ASGNF4
+ADDRGP4 cg_timescale+8
+INDIRF4
+ADDRGP4 cg_timescaleFadeEnd+8
+INDIRF4
+LEF4 $1424
+ADDRGP4 cg_timescale+8
+ADDRGP4 cg_timescaleFadeEnd+8
+INDIRF4
+ASGNF4
+ADDRGP4 $1424
+JUMPV
+LABELV $1423
+ADDRLP4 32
+ADDRGP4 cg_timescale+8
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRGP4 cg_timescaleFadeSpeed+8
+INDIRF4
+ADDRGP4 cg+107608
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1148846080
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 cg_timescale+8
+INDIRF4
+ADDRGP4 cg_timescaleFadeEnd+8
+INDIRF4
+GEF4 $1439
+ADDRGP4 cg_timescale+8
+ADDRGP4 cg_timescaleFadeEnd+8
+INDIRF4
+ASGNF4
+LABELV $1439
+LABELV $1424
+ADDRGP4 cg_timescaleFadeSpeed+8
+INDIRF4
+CNSTF4 0
+EQF4 $1445
+ADDRGP4 $1449
+ARGP4
+ADDRGP4 cg_timescale+8
+INDIRF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $1448
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1445
+LABELV $1419
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawActive
+CALLV
+pop
+ADDRGP4 cg_stats+12
+INDIRI4
+CNSTI4 0
+EQI4 $1451
+ADDRGP4 $1454
+ARGP4
+ADDRGP4 cg
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1451
+ADDRGP4 CG_UpdateVoipTeamIDs
+CALLV
+pop
+LABELV $777
+endproc CG_DrawActiveFrame 308 16
+bss
+align 4
+LABELV numBatchPolys
+skip 4
+align 4
+LABELV batchPolyVerts
+skip 4
+align 4
+LABELV batchShader
+skip 4
+align 4
+LABELV batchVerts
+skip 24576
+align 4
+LABELV numBatchEntities
+skip 4
+align 4
+LABELV batchEntities
+skip 8960
+import CG_AddBoundingBox
+import CG_AddBoundingBoxEntity
+import CG_QueryCvar
+import CG_Timestamp
+import CG_LimitCvars
+import trap_RealTime
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import trap_R_inPVS
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_Cutscene2d_Draw
+import CG_Cutscene2d_UpdateTrans
+import CG_Cutscene2d_CheckCmd
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import Main_SpriteParticles
+import LaunchRevivalParticle
+import LaunchSpeedyPuffTrail
+import Init_SpriteParticles
+import AddLFsToScreen
+import AddLFToDrawList
+import Init_LensFlareSys
+import DumpPolyInfo
+import ActiveChooseLogoMenu
+import FindLogoForSpraying
+import Add_LogoToDrawList
+import AddLogosToScene
+import Init_SprayLogoSys
+import Calculate_2DOfDIR
+import Calculate_2DOf3D
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_ChangeLoadingProgress
+import CG_LoadingString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_ScorePlum
+import CG_TeleOutEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_GenerateParticles
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_PortalInView
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_GetWaterMuzzle
+import CG_SprayTrail
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponSRWC
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_Boomies_Explosion
+import CG_BamBam_Explosion
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_LerpTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayer
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_UpdateVoipTeamIDs
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Draw3DModel
+import CG_SetPrintString
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import CG_MessagePrint
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_WorldToScreen
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_DrawPic1024
+import CG_DrawRect1024
+import CG_FillRect1024
+import CG_AdjustFrom1024
+import CG_AdjustFrom640
+import CG_ForceModelChange
+import CG_GetCvarFloat
+import CG_GetCvarInt
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StreamAssets
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_icons
+import cg_ambient
+import cg_drawBBox
+import cg_drawVoiceNames
+import cg_drawLensflare
+import cg_timestamps
+import cg_skyLensflare
+import cg_sky
+import cg_curWarmupReady
+import cg_warmupReady
+import cg_glowModelTeam
+import cg_glowModel
+import cg_cineDrawLetterBox
+import cg_cineHideHud
+import cg_LPSwallhackAlpha
+import cg_LPSwallhackSize
+import cg_bigScoreType
+import cg_thirdPersonAutoSwitch
+import cg_drawTimeLeft
+import cg_drawServerInfos
+import cg_drawMessages
+import cg_drawups
+import cg_wopFFAhud
+import cg_printDir
+import cg_drawRealTime
+import cg_correctedWeaponPos
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_streamAssets
+import cg_deferPlayers
+import cg_predictItems
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_chatBeep
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_optimizePrediction
+import cg_nopredict
+import cg_errorDecay
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import trailEnt
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $1454
+byte 1 99
+byte 1 103
+byte 1 46
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $1449
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $1448
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1365
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 100
+byte 1 110
+byte 1 0
+align 1
+LABELV $1288
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $1211
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $1134
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $1057
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 98
+byte 1 107
+byte 1 0
+align 1
+LABELV $980
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $800
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 10
+byte 1 0
+align 1
+LABELV $794
+byte 1 48
+byte 1 0
+align 1
+LABELV $789
+byte 1 49
+byte 1 0
+align 1
+LABELV $788
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $157
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $140
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $102
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 10
+byte 1 0
@@ -0,0 +1,12757 @@
+lit
+align 4
+LABELV $81
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+export CG_SprayTrail
+code
+proc CG_SprayTrail 156 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRGP4 $81
+INDIRB
+ASGNB 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 116
+CNSTP4 0
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 124
+CNSTF4 1132462080
+ASGNF4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 124
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 124
+INDIRF4
+ADDRLP4 40+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1132462080
+ADDRLP4 40+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 52
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 128
+CNSTP4 0
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 52+8
+INDIRF4
+CNSTF4 1065353216
+EQF4 $86
+ADDRLP4 0
+ADDRLP4 52+12
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 52+12+4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 52+12+8
+INDIRF4
+ASGNF4
+LABELV $86
+CNSTI4 1836
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+68
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $96
+ADDRLP4 24
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 132
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 132
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 132
+INDIRF4
+ASGNF4
+ADDRGP4 $97
+JUMPV
+LABELV $96
+CNSTI4 1836
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+68
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $102
+ADDRLP4 132
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 132
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 132
+INDIRF4
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $103
+JUMPV
+LABELV $102
+ADDRLP4 132
+CNSTI4 1836
+ASGNI4
+ADDRLP4 136
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 132
+INDIRI4
+ADDRLP4 136
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+88
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 132
+INDIRI4
+ADDRLP4 136
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+88+4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24+8
+CNSTI4 1836
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+88+8
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $103
+LABELV $97
+ADDRLP4 12
+ADDRLP4 0
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 136
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 112
+ADDRLP4 136
+INDIRF4
+ASGNF4
+ADDRLP4 140
+CNSTF4 1148846080
+ASGNF4
+ADDRLP4 12
+ADDRLP4 140
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 140
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 1148846080
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTF4 1111490560
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 24+4
+INDIRF4
+ARGF4
+ADDRLP4 24+8
+INDIRF4
+ARGF4
+CNSTF4 1051260355
+ARGF4
+ADDRLP4 144
+CNSTF4 1148846080
+ASGNF4
+ADDRLP4 144
+INDIRF4
+ADDRLP4 112
+INDIRF4
+MULF4
+ADDRLP4 144
+INDIRF4
+DIVF4
+ARGF4
+ADDRGP4 cg+107612
+INDIRI4
+ARGI4
+ADDRLP4 148
+CNSTI4 0
+ASGNI4
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRGP4 cgs+160652+372
+INDIRI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 CG_SmokePuff
+CALLP4
+ASGNP4
+ADDRLP4 108
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 9
+ASGNI4
+ADDRLP4 108
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 256
+ASGNI4
+LABELV $80
+endproc CG_SprayTrail 156 48
+export CG_RailTrail
+proc CG_RailTrail 68 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 40
+CNSTI4 4
+ASGNI4
+ADDRLP4 20+4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 44
+CNSTI4 8
+ASGNI4
+ADDRLP4 20+8
+ADDRFP4 8
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 20+4
+INDIRF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 20
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 8+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 1086324736
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 52
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+CNSTF4 1086324736
+ADDRLP4 8+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+CNSTF4 1086324736
+ADDRLP4 8+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+SUBF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 -1
+ASGNI4
+LABELV $137
+ADDRLP4 64
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 64
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 13
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 500
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1078530011
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1082130432
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+CNSTI4 6
+ADDRLP4 4
+INDIRI4
+MULI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 8+4
+INDIRF4
+CNSTI4 6
+ADDRLP4 4
+INDIRI4
+MULI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 8+8
+INDIRF4
+CNSTI4 6
+ADDRLP4 4
+INDIRI4
+MULI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+CNSTI4 6
+ADDRLP4 4
+INDIRI4
+MULI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 8+4
+INDIRF4
+CNSTI4 6
+ADDRLP4 4
+INDIRI4
+MULI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 8+8
+INDIRF4
+CNSTI4 6
+ADDRLP4 4
+INDIRI4
+MULI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+LABELV $138
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LTI4 $137
+LABELV $129
+endproc CG_RailTrail 68 4
+proc CG_RocketTrail 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $148
+ADDRLP4 8
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 10
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CNSTI4 276
+ADDP4
+ADDRGP4 cgs+160652+732
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CNSTI4 296
+ADDP4
+CNSTF4 1106247680
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CNSTI4 232
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $148
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 800
+ADDI4
+ASGNI4
+LABELV $147
+endproc CG_RocketTrail 12 0
+proc CG_SplasherTrail 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $155
+ADDRLP4 8
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 10
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CNSTI4 276
+ADDP4
+ADDRGP4 cgs+160652+736
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CNSTI4 296
+ADDP4
+CNSTF4 1092616192
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CNSTI4 232
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $155
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 800
+ADDI4
+ASGNI4
+LABELV $154
+endproc CG_SplasherTrail 12 0
+proc CG_KMATrail 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 1836
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $163
+ADDRLP4 12
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 11
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CNSTI4 276
+ADDP4
+ADDRGP4 cgs+160652+892
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 5
+LTI4 $167
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $170
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CNSTI4 124
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CNSTI4 128
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $168
+JUMPV
+LABELV $170
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CNSTI4 124
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CNSTI4 128
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $168
+JUMPV
+LABELV $167
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+NEF4 $172
+ADDRLP4 16
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+NEF4 $172
+ADDRLP4 16
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+NEF4 $172
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1061997773
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CNSTI4 124
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CNSTI4 128
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $172
+LABELV $168
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CNSTI4 296
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CNSTI4 232
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $163
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 800
+ADDI4
+ASGNI4
+LABELV $161
+endproc CG_KMATrail 24 0
+proc CG_ImperiusTrail 212 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 48
+ASGNI4
+ADDRLP4 176
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 176
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ADDRLP4 20
+INDIRI4
+DIVI4
+MULI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+107612
+INDIRI4
+ARGI4
+ADDRLP4 164
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 24+68
+ADDRLP4 164
+INDIRB
+ASGNB 12
+ADDRLP4 24
+CNSTI4 2
+ASGNI4
+ADDRLP4 24+112
+ADDRGP4 cgs+160652+772
+INDIRI4
+ASGNI4
+ADDRLP4 24+132
+CNSTF4 1109393408
+ASGNF4
+ADDRLP4 188
+CNSTU1 255
+ASGNU1
+ADDRLP4 24+116+2
+ADDRLP4 188
+INDIRU1
+ASGNU1
+ADDRLP4 24+116+1
+ADDRLP4 188
+INDIRU1
+ASGNU1
+ADDRLP4 24+116
+ADDRLP4 188
+INDIRU1
+ASGNU1
+ADDRLP4 24
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRGP4 $192
+JUMPV
+LABELV $189
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 192
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 192
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 15
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+ADDRGP4 cgs+160652+916
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+ADDRGP4 cgs+160652+776
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 20
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+CVIF4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1101004800
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 204
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRLP4 204
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 204
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 204
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 204
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+ADDRLP4 8
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 VectorNormalize2
+CALLF4
+ASGNF4
+ADDRLP4 208
+INDIRF4
+CNSTF4 0
+NEF4 $201
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $201
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ARGP4
+ADDRGP4 cg+107612
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 RotateAroundDirection
+CALLV
+pop
+LABELV $190
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $192
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+107612
+INDIRI4
+LEI4 $189
+LABELV $176
+endproc CG_ImperiusTrail 212 12
+export CG_GrappleTrail
+proc CG_GrappleTrail 184 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+107612
+INDIRI4
+ARGI4
+ADDRLP4 152
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+CNSTI4 808
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+732
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 1104150528
+ADDF4
+ASGNF4
+CNSTI4 808
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+744
+ADDP4
+ARGP4
+ADDRLP4 168
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+CNSTF4 3233808384
+ADDRLP4 140
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+CNSTF4 3233808384
+ADDRLP4 140+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 3233808384
+ADDRLP4 140+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+84
+ADDRLP4 152
+INDIRB
+ASGNB 12
+ADDRLP4 0+68
+ARGP4
+ADDRLP4 0+84
+ARGP4
+ADDRLP4 180
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 180
+INDIRF4
+CNSTF4 1115684864
+GEF4 $225
+ADDRGP4 $204
+JUMPV
+LABELV $225
+ADDRLP4 0
+CNSTI4 6
+ASGNI4
+ADDRLP4 0+112
+ADDRGP4 cgs+160652+108
+INDIRI4
+ASGNI4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $204
+endproc CG_GrappleTrail 184 16
+export CG_RegisterWeapon
+proc CG_RegisterWeapon 448 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 132
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $241
+ADDRGP4 $240
+JUMPV
+LABELV $241
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $243
+ADDRGP4 $240
+JUMPV
+LABELV $243
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 132
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 12
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRGP4 bg_itemlist+52
+ASGNP4
+ADDRGP4 $248
+JUMPV
+LABELV $245
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $250
+ADDRLP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $250
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $247
+JUMPV
+LABELV $250
+LABELV $246
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+LABELV $248
+ADDRLP4 4
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $245
+LABELV $247
+ADDRLP4 4
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $252
+ADDRGP4 $254
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $252
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRGP4 bg_itemlist
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 52
+DIVI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRLP4 92
+ARGP4
+ADDRGP4 trap_R_ModelBounds
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $255
+ADDRLP4 112
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 116
+ADDRLP4 112
+INDIRI4
+ADDRLP4 16
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 112
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDP4
+ADDRLP4 116
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 112
+INDIRI4
+ADDRLP4 92
+ADDP4
+INDIRF4
+ADDRLP4 116
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $256
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $255
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 116
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 bg_itemlist+52
+ASGNP4
+ADDRGP4 $262
+JUMPV
+LABELV $259
+ADDRLP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $264
+ADDRLP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $264
+ADDRGP4 $261
+JUMPV
+LABELV $264
+LABELV $260
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+LABELV $262
+ADDRLP4 8
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $259
+LABELV $261
+ADDRLP4 124
+CNSTU4 0
+ASGNU4
+ADDRLP4 8
+INDIRP4
+INDIRP4
+CVPU4 4
+ADDRLP4 124
+INDIRU4
+EQU4 $266
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 124
+INDIRU4
+EQU4 $266
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 128
+INDIRI4
+ASGNI4
+LABELV $266
+ADDRFP4 0
+INDIRI4
+CNSTI4 13
+NEI4 $268
+ADDRLP4 12
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $270
+JUMPV
+LABELV $268
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $271
+ADDRLP4 28
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 28
+ARGP4
+ADDRLP4 28
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 28
+ARGP4
+ADDRGP4 $273
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 28
+ARGP4
+ADDRLP4 128
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 128
+INDIRI4
+ASGNI4
+LABELV $271
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+EQI4 $276
+ADDRFP4 0
+INDIRI4
+CNSTI4 9
+NEI4 $274
+LABELV $276
+ADDRLP4 28
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 28
+ARGP4
+ADDRLP4 28
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 28
+ARGP4
+ADDRGP4 $277
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 28
+ARGP4
+ADDRLP4 132
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRGP4 $275
+JUMPV
+LABELV $274
+ADDRLP4 12
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $275
+ADDRLP4 28
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 28
+ARGP4
+ADDRLP4 28
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 28
+ARGP4
+ADDRGP4 $278
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 28
+ARGP4
+ADDRLP4 132
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $279
+ADDRGP4 $281
+ARGP4
+ADDRLP4 136
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 136
+INDIRI4
+ASGNI4
+LABELV $279
+LABELV $270
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $282
+ADDRFP4 0
+INDIRI4
+CNSTI4 14
+GTI4 $282
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $484-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $484
+address $284
+address $304
+address $312
+address $335
+address $320
+address $291
+address $359
+address $354
+address $409
+address $388
+address $302
+address $440
+address $469
+address $283
+code
+LABELV $284
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $285
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 140
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRGP4 $286
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 144
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRGP4 $287
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 148
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRGP4 $290
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 152
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1032
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRGP4 $283
+JUMPV
+LABELV $291
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $292
+ARGP4
+ADDRLP4 156
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRGP4 $293
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 160
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRGP4 $294
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 164
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRGP4 $295
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 168
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRGP4 $298
+ARGP4
+ADDRLP4 172
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+800
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRGP4 $301
+ARGP4
+ADDRLP4 176
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+744
+ADDRLP4 176
+INDIRI4
+ASGNI4
+ADDRGP4 $283
+JUMPV
+LABELV $302
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $303
+ARGP4
+ADDRLP4 180
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRGP4 CG_GrappleTrail
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTF4 1128792064
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $285
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 184
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRGP4 $283
+JUMPV
+LABELV $304
+ADDRGP4 $305
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 188
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 188
+INDIRI4
+ASGNI4
+ADDRGP4 $308
+ARGP4
+ADDRLP4 192
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+756
+ADDRLP4 192
+INDIRI4
+ASGNI4
+ADDRGP4 $311
+ARGP4
+ADDRLP4 196
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+760
+ADDRLP4 196
+INDIRI4
+ASGNI4
+ADDRGP4 $283
+JUMPV
+LABELV $312
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $313
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 200
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 200
+INDIRI4
+ASGNI4
+ADDRGP4 $316
+ARGP4
+ADDRLP4 204
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+768
+ADDRLP4 204
+INDIRI4
+ASGNI4
+ADDRGP4 $319
+ARGP4
+ADDRLP4 208
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+764
+ADDRLP4 208
+INDIRI4
+ASGNI4
+ADDRGP4 $283
+JUMPV
+LABELV $320
+ADDRGP4 $321
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 212
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRGP4 CG_RocketTrail
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTF4 1128792064
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1157234688
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1115684864
+ASGNF4
+ADDRGP4 $322
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 216
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 216
+INDIRI4
+ASGNI4
+ADDRGP4 $325
+ARGP4
+ADDRLP4 220
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+936
+ADDRLP4 220
+INDIRI4
+ASGNI4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 224
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+728
+ADDRLP4 224
+INDIRI4
+ASGNI4
+ADDRGP4 $331
+ARGP4
+ADDRLP4 228
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+732
+ADDRLP4 228
+INDIRI4
+ASGNI4
+ADDRGP4 $334
+ARGP4
+ADDRLP4 232
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+808
+ADDRLP4 232
+INDIRI4
+ASGNI4
+ADDRGP4 $283
+JUMPV
+LABELV $335
+ADDRGP4 $336
+ARGP4
+ADDRLP4 236
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 236
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1143930880
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1094713344
+ASGNF4
+ADDRGP4 $337
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 240
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 240
+INDIRI4
+ASGNI4
+ADDRGP4 $340
+ARGP4
+ADDRLP4 244
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+804
+ADDRLP4 244
+INDIRI4
+ASGNI4
+ADDRGP4 $343
+ARGP4
+ADDRLP4 248
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+784
+ADDRLP4 248
+INDIRI4
+ASGNI4
+ADDRGP4 $346
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 252
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1760
+ADDRLP4 252
+INDIRI4
+ASGNI4
+ADDRGP4 $349
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 256
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1764
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRGP4 $352
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 260
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1100
+ADDRLP4 260
+INDIRI4
+ASGNI4
+ADDRGP4 $283
+JUMPV
+LABELV $354
+ADDRGP4 $292
+ARGP4
+ADDRLP4 264
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRGP4 $355
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 268
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRGP4 $358
+ARGP4
+ADDRLP4 272
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+796
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRGP4 $283
+JUMPV
+LABELV $359
+ADDRGP4 $360
+ARGP4
+ADDRLP4 276
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRGP4 $321
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 280
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRGP4 CG_SplasherTrail
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1157234688
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 $361
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 284
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRGP4 $362
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 288
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 288
+INDIRI4
+ASGNI4
+ADDRGP4 $365
+ARGP4
+ADDRLP4 292
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+736
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRGP4 $368
+ARGP4
+ADDRLP4 296
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+740
+ADDRLP4 296
+INDIRI4
+ASGNI4
+ADDRGP4 $371
+ARGP4
+ADDRLP4 300
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+788
+ADDRLP4 300
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $372
+ADDRGP4 $378
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 308
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 308
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 312
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+588
+ADDP4
+ADDRLP4 312
+INDIRI4
+ASGNI4
+LABELV $373
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LEI4 $372
+ADDRGP4 $381
+ARGP4
+ADDRLP4 304
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+576
+ADDRLP4 304
+INDIRI4
+ASGNI4
+ADDRGP4 $384
+ARGP4
+ADDRLP4 308
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+580
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRGP4 $387
+ARGP4
+ADDRLP4 312
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+584
+ADDRLP4 312
+INDIRI4
+ASGNI4
+ADDRGP4 $283
+JUMPV
+LABELV $388
+ADDRGP4 $389
+ARGP4
+ADDRLP4 316
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 316
+INDIRI4
+ASGNI4
+ADDRGP4 $321
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 320
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRGP4 CG_KMATrail
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1157234688
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 $390
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 324
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 324
+INDIRI4
+ASGNI4
+ADDRGP4 $393
+ARGP4
+ADDRLP4 328
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+892
+ADDRLP4 328
+INDIRI4
+ASGNI4
+ADDRGP4 $396
+ARGP4
+ADDRLP4 332
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+896
+ADDRLP4 332
+INDIRI4
+ASGNI4
+ADDRGP4 $399
+ARGP4
+ADDRLP4 336
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+900
+ADDRLP4 336
+INDIRI4
+ASGNI4
+ADDRGP4 $402
+ARGP4
+ADDRLP4 340
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+624
+ADDRLP4 340
+INDIRI4
+ASGNI4
+ADDRGP4 $405
+ARGP4
+ADDRLP4 344
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+628
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRGP4 $408
+ARGP4
+ADDRLP4 348
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+632
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRGP4 $283
+JUMPV
+LABELV $409
+ADDRGP4 $410
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 352
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 352
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1060320051
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $411
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 356
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 356
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRGP4 CG_ImperiusTrail
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1140457472
+ASGNF4
+ADDRGP4 $414
+ARGP4
+ADDRLP4 360
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+812
+ADDRLP4 360
+INDIRI4
+ASGNI4
+ADDRGP4 $417
+ARGP4
+ADDRLP4 364
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+816
+ADDRLP4 364
+INDIRI4
+ASGNI4
+ADDRGP4 $420
+ARGP4
+ADDRLP4 368
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+780
+ADDRLP4 368
+INDIRI4
+ASGNI4
+ADDRGP4 $423
+ARGP4
+ADDRLP4 372
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+772
+ADDRLP4 372
+INDIRI4
+ASGNI4
+ADDRGP4 $426
+ARGP4
+ADDRLP4 376
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+776
+ADDRLP4 376
+INDIRI4
+ASGNI4
+ADDRGP4 $429
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 380
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1036
+ADDRLP4 380
+INDIRI4
+ASGNI4
+ADDRGP4 $432
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 384
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+1040
+ADDRLP4 384
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $433
+ADDRGP4 $439
+ARGP4
+ADDRLP4 392
+CNSTI4 10
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 392
+INDIRI4
+DIVI4
+ADDRLP4 392
+INDIRI4
+MODI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 392
+INDIRI4
+MODI4
+ARGI4
+ADDRLP4 396
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 396
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 400
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+1044
+ADDP4
+ADDRLP4 400
+INDIRI4
+ASGNI4
+LABELV $434
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+LTI4 $433
+ADDRGP4 $283
+JUMPV
+LABELV $440
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1060320051
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $441
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 388
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $444
+ARGP4
+ADDRLP4 392
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+348
+ADDRLP4 392
+INDIRI4
+ASGNI4
+ADDRGP4 $447
+ARGP4
+ADDRLP4 396
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+352
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRGP4 $450
+ARGP4
+ADDRLP4 400
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+340
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRGP4 $453
+ARGP4
+ADDRLP4 404
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+344
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRGP4 $456
+ARGP4
+ADDRLP4 408
+ADDRGP4 BG_FindItem
+CALLP4
+ASGNP4
+ADDRGP4 cgs+160652+360
+ADDRLP4 408
+INDIRP4
+CVPU4 4
+ADDRGP4 bg_itemlist
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 52
+DIVI4
+ASGNI4
+ADDRGP4 $459
+ARGP4
+ADDRLP4 412
+ADDRGP4 BG_FindItem
+CALLP4
+ASGNP4
+ADDRGP4 cgs+160652+364
+ADDRLP4 412
+INDIRP4
+CVPU4 4
+ADDRGP4 bg_itemlist
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 52
+DIVI4
+ASGNI4
+ADDRGP4 $462
+ARGP4
+ADDRLP4 416
+ADDRGP4 BG_FindItem
+CALLP4
+ASGNP4
+ADDRGP4 cgs+160652+368
+ADDRLP4 416
+INDIRP4
+CVPU4 4
+ADDRGP4 bg_itemlist
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 52
+DIVI4
+ASGNI4
+ADDRGP4 cgs+160652+364
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+ADDRGP4 cgs+160652+360
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+ADDRGP4 cgs+160652+368
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+ADDRGP4 $283
+JUMPV
+LABELV $469
+ADDRGP4 $472
+ARGP4
+ADDRLP4 420
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+820
+ADDRLP4 420
+INDIRI4
+ASGNI4
+ADDRGP4 $475
+ARGP4
+ADDRLP4 424
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+828
+ADDRLP4 424
+INDIRI4
+ASGNI4
+ADDRGP4 $478
+ARGP4
+ADDRLP4 428
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+832
+ADDRLP4 428
+INDIRI4
+ASGNI4
+ADDRGP4 $481
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 432
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+160652+824
+ADDRLP4 432
+INDIRI4
+ASGNI4
+ADDRGP4 $482
+ARGP4
+ADDRLP4 436
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 436
+INDIRI4
+ASGNI4
+ADDRGP4 $483
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 440
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 440
+INDIRI4
+ASGNI4
+ADDRGP4 $283
+JUMPV
+LABELV $282
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $322
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 444
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 444
+INDIRI4
+ASGNI4
+LABELV $283
+LABELV $240
+endproc CG_RegisterWeapon 448 12
+export CG_RegisterItemVisuals
+proc CG_RegisterItemVisuals 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $489
+ADDRFP4 0
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $487
+LABELV $489
+ADDRGP4 $490
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 bg_numItems
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $487
+ADDRLP4 4
+CNSTI4 24
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_items
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $491
+ADDRGP4 $486
+JUMPV
+LABELV $491
+ADDRLP4 0
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 24
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $493
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+LABELV $493
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 5
+EQI4 $499
+ADDRLP4 20
+INDIRI4
+CNSTI4 4
+EQI4 $499
+ADDRLP4 20
+INDIRI4
+CNSTI4 3
+EQI4 $499
+ADDRLP4 20
+INDIRI4
+CNSTI4 6
+NEI4 $495
+LABELV $499
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $500
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $500
+LABELV $495
+LABELV $486
+endproc CG_RegisterItemVisuals 28 12
+proc CG_MapTorsoToWeaponFrame 36 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 804
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $503
+ADDRFP4 4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 9
+ADDI4
+GEI4 $503
+ADDRFP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 804
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 6
+ADDI4
+RETI4
+ADDRGP4 $502
+JUMPV
+LABELV $503
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 748
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $505
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 6
+ADDI4
+GEI4 $505
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 748
+ADDP4
+INDIRI4
+SUBI4
+RETI4
+ADDRGP4 $502
+JUMPV
+LABELV $505
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LTI4 $507
+ADDRFP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 6
+ADDI4
+GEI4 $507
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRI4
+SUBI4
+RETI4
+ADDRGP4 $502
+JUMPV
+LABELV $507
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 1252
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LTI4 $509
+ADDRFP4 4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRI4
+ADDI4
+GEI4 $509
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1252
+ADDP4
+INDIRI4
+SUBI4
+RETI4
+ADDRGP4 $502
+JUMPV
+LABELV $509
+CNSTI4 0
+RETI4
+LABELV $502
+endproc CG_MapTorsoToWeaponFrame 36 0
+proc CG_CalculateWeaponPosition 40 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ADDRGP4 cg+110648+24
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+ADDRGP4 cg+111016
+INDIRB
+ASGNB 12
+ADDRGP4 cg+131884
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $515
+ADDRLP4 0
+ADDRGP4 cg+131888
+INDIRF4
+NEGF4
+ASGNF4
+ADDRGP4 $516
+JUMPV
+LABELV $515
+ADDRLP4 0
+ADDRGP4 cg+131888
+INDIRF4
+ASGNF4
+LABELV $516
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+CNSTF4 1000593162
+ADDRLP4 0
+INDIRF4
+ADDRGP4 cg+131880
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 0
+INDIRF4
+ADDRGP4 cg+131880
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 1000593162
+ADDRGP4 cg+131888
+INDIRF4
+ADDRGP4 cg+131880
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 cg+110496
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 150
+GEI4 $526
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+CNSTF4 1048576000
+ADDRGP4 cg+110492
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1125515264
+DIVF4
+ADDF4
+ASGNF4
+ADDRGP4 $527
+JUMPV
+LABELV $526
+ADDRLP4 8
+INDIRI4
+CNSTI4 450
+GEI4 $529
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+CNSTF4 1048576000
+ADDRGP4 cg+110492
+INDIRF4
+MULF4
+CNSTI4 450
+ADDRLP4 8
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1133903872
+DIVF4
+ADDF4
+ASGNF4
+LABELV $529
+LABELV $527
+ADDRLP4 0
+ADDRGP4 cg+131888
+INDIRF4
+CNSTF4 1109393408
+ADDF4
+ASGNF4
+CNSTF4 981668463
+ADDRGP4 cg+107612
+INDIRI4
+CVIF4 4
+MULF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $511
+endproc CG_CalculateWeaponPosition 40 4
+proc CG_LightningBolt 124 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 6
+EQI4 $535
+ADDRGP4 $534
+JUMPV
+LABELV $535
+CNSTI4 1836
+ADDRFP4 0
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088+132
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+INDIRI4
+CNSTI4 70
+ADDI4
+GEI4 $539
+ADDRGP4 $534
+JUMPV
+LABELV $539
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_CalcMuzzlePoint
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $542
+ADDRGP4 cg+108604+152
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 84
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRGP4 $543
+JUMPV
+LABELV $542
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 84
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+LABELV $543
+ADDRLP4 96
+CNSTF4 1097859072
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDRLP4 84
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDRLP4 84+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1097859072
+ADDRLP4 84+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1097859072
+SUBF4
+ASGNF4
+ADDRLP4 28
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 100
+CNSTP4 0
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 28+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $558
+ADDRLP4 28+4
+INDIRI4
+CNSTI4 0
+EQI4 $554
+LABELV $558
+ADDRLP4 28+44
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+NEI4 $534
+CNSTI4 6
+ARGI4
+ADDRLP4 28+52
+INDIRI4
+CNSTI4 1022
+NEI4 $568
+ADDRLP4 28+24+8
+INDIRF4
+CNSTF4 1061997773
+LEF4 $568
+ADDRLP4 104
+CNSTI4 1
+ASGNI4
+ADDRGP4 $569
+JUMPV
+LABELV $568
+ADDRLP4 104
+CNSTI4 0
+ASGNI4
+LABELV $569
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRLP4 28+12
+ARGP4
+ADDRLP4 28+24
+ARGP4
+ADDRLP4 108
+CNSTI4 0
+ASGNI4
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+ADDRGP4 $534
+JUMPV
+LABELV $554
+ADDRLP4 104
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 104
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 12
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 10
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 1500
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $572
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+INDIRI4
+CNSTI4 200
+ADDI4
+GEI4 $572
+ADDRLP4 16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1065017672
+LEF4 $575
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $576
+JUMPV
+LABELV $575
+ADDRLP4 116
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 116
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $576
+LABELV $572
+ADDRFP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+ADDRLP4 16
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 10
+SUBI4
+ASGNI4
+ADDRLP4 16+8
+ADDRLP4 16+8
+INDIRF4
+CNSTF4 1041865114
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 10
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTF4 1151090688
+ADDRLP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTF4 1151090688
+ADDRLP4 16+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTF4 1151090688
+ADDRLP4 16+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+CNSTF4 1087722838
+ADDRLP4 4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRF4
+CNSTF4 1087722838
+ADDRLP4 4+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRF4
+CNSTF4 1087722838
+ADDRLP4 4+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $534
+endproc CG_LightningBolt 124 28
+export CG_GetWaterMuzzle
+proc CG_GetWaterMuzzle 32 16
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_CalcMuzzlePoint
+CALLI4
+pop
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $589
+ADDRGP4 cg+108604+152
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRGP4 $590
+JUMPV
+LABELV $589
+ADDRFP4 4
+INDIRP4
+CNSTI4 744
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+LABELV $590
+ADDRLP4 28
+CNSTF4 1097859072
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1097859072
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1097859072
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 0
+INDIRB
+ASGNB 12
+LABELV $586
+endproc CG_GetWaterMuzzle 32 16
+proc CG_MachinegunSpinAngle 36 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 660
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $603
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 652
+ADDP4
+INDIRF4
+CNSTF4 1063675494
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $604
+JUMPV
+LABELV $603
+ADDRLP4 0
+INDIRI4
+CNSTI4 1000
+LEI4 $605
+ADDRLP4 0
+CNSTI4 1000
+ASGNI4
+LABELV $605
+ADDRLP4 8
+CNSTF4 1056964608
+CNSTI4 1000
+ADDRLP4 0
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+CNSTF4 1063675494
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 652
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $604
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+NEI4 $610
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $611
+JUMPV
+LABELV $610
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $611
+ADDRFP4 0
+INDIRP4
+CNSTI4 660
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $607
+ADDRFP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 652
+ADDP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $614
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRGP4 $615
+JUMPV
+LABELV $614
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+LABELV $615
+ADDRFP4 0
+INDIRP4
+CNSTI4 660
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+LABELV $607
+ADDRLP4 4
+INDIRF4
+RETF4
+LABELV $601
+endproc CG_MachinegunSpinAngle 36 4
+proc CG_AddWeaponWithPowerups 5 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $617
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+160652+316
+INDIRI4
+ASGNI4
+ADDRGP4 $618
+JUMPV
+LABELV $617
+ADDRFP4 4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $621
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $623
+ADDRGP4 cgs+160652+648
+INDIRI4
+CNSTI4 0
+EQI4 $623
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ADDRGP4 cgs+160652+648
+INDIRI4
+ASGNI4
+ADDRGP4 $624
+JUMPV
+LABELV $623
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+160652+644
+INDIRI4
+ASGNI4
+LABELV $624
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 4
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 4
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 4
+INDIRU1
+ASGNU1
+LABELV $621
+ADDRFP4 4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $631
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $631
+ADDRGP4 cgs+160652+652
+INDIRI4
+CNSTI4 0
+EQI4 $633
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ADDRGP4 cgs+160652+652
+INDIRI4
+ASGNI4
+ADDRGP4 $634
+JUMPV
+LABELV $633
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+160652+656
+INDIRI4
+ASGNI4
+LABELV $634
+LABELV $631
+LABELV $618
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $616
+endproc CG_AddWeaponWithPowerups 5 4
+data
+align 4
+LABELV $799
+byte 4 0
+export CG_AddPlayerWeapon
+code
+proc CG_AddPlayerWeapon 528 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 140
+ADDRFP4 8
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+ADDRLP4 284
+CNSTI4 132
+ADDRLP4 140
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+ASGNP4
+ADDRLP4 144
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 144+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 144+24
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 144+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 8388609
+BANDI4
+CNSTI4 0
+EQI4 $645
+ADDRLP4 444
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 444
+INDIRP4
+ADDRLP4 444
+INDIRP4
+INDIRI4
+CNSTI4 -257
+BANDI4
+ASGNI4
+LABELV $645
+ADDRLP4 144+8
+ADDRLP4 284
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 12
+NEI4 $648
+ADDRFP4 12
+INDIRI4
+CNSTI4 2
+NEI4 $648
+ADDRLP4 144+108
+ADDRGP4 cgs+160652+348
+INDIRI4
+ASGNI4
+ADDRGP4 $649
+JUMPV
+LABELV $648
+ADDRLP4 140
+INDIRI4
+CNSTI4 12
+NEI4 $653
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $653
+ADDRLP4 144+108
+ADDRGP4 cgs+160652+340
+INDIRI4
+ASGNI4
+LABELV $653
+LABELV $649
+ADDRLP4 144+8
+INDIRI4
+CNSTI4 0
+NEI4 $658
+ADDRGP4 $641
+JUMPV
+LABELV $658
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $661
+ADDRFP4 8
+INDIRP4
+CNSTI4 632
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 448
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+ADDRLP4 448
+INDIRI4
+EQI4 $663
+ADDRLP4 284
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+ADDRLP4 448
+INDIRI4
+EQI4 $663
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+NEI4 $665
+ADDRFP4 8
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $665
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 732
+ADDP4
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRGP4 cgs+160652+1032
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_AddLoopingSound
+CALLV
+pop
+ADDRGP4 $666
+JUMPV
+LABELV $665
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 732
+ADDP4
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRLP4 284
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_AddLoopingSound
+CALLV
+pop
+LABELV $666
+ADDRFP4 8
+INDIRP4
+CNSTI4 632
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $664
+JUMPV
+LABELV $663
+ADDRLP4 284
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $669
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 732
+ADDP4
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRLP4 284
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_AddLoopingSound
+CALLV
+pop
+LABELV $669
+LABELV $664
+LABELV $661
+ADDRLP4 144+96
+ADDRFP4 8
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 448
+ADDRFP4 8
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 456
+CNSTI4 1
+ASGNI4
+ADDRLP4 448
+INDIRI4
+ADDRLP4 456
+INDIRI4
+EQI4 $683
+ADDRLP4 448
+INDIRI4
+ADDRLP4 456
+INDIRI4
+LTI4 $672
+LABELV $690
+ADDRLP4 448
+INDIRI4
+CNSTI4 7
+EQI4 $676
+ADDRGP4 $672
+JUMPV
+LABELV $672
+ADDRLP4 144+80
+CNSTI4 0
+ASGNI4
+ADDRGP4 $673
+JUMPV
+LABELV $676
+ADDRLP4 144+80
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 45
+DIVI4
+ASGNI4
+ADDRLP4 144+80
+INDIRI4
+CNSTI4 23
+LEI4 $673
+ADDRLP4 144+80
+CNSTI4 0
+ASGNI4
+ADDRGP4 $673
+JUMPV
+LABELV $683
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $684
+ADDRLP4 144+80
+CNSTF4 1024416809
+ADDRGP4 cg+107612
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+CNSTI4 15
+MODI4
+CNSTI4 44
+ADDI4
+ASGNI4
+ADDRGP4 $673
+JUMPV
+LABELV $684
+ADDRLP4 144+80
+CNSTF4 1018444120
+ADDRGP4 cg+107612
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+CNSTI4 44
+MODI4
+ASGNI4
+LABELV $673
+ADDRFP4 8
+INDIRP4
+CNSTI4 436
+ADDP4
+ADDRLP4 144+80
+INDIRI4
+ASGNI4
+ADDRLP4 144
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $692
+ARGP4
+ADDRGP4 CG_PositionEntityOnTag
+CALLV
+pop
+ADDRLP4 144
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddWeaponWithPowerups
+CALLV
+pop
+ADDRLP4 284
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $693
+ADDRLP4 300
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 300+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 300+24
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 300+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 300+8
+ADDRLP4 284
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 288+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 288
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 468
+ADDRGP4 CG_MachinegunSpinAngle
+CALLF4
+ASGNF4
+ADDRLP4 288+8
+ADDRLP4 468
+INDIRF4
+ASGNF4
+ADDRLP4 288
+ARGP4
+ADDRLP4 300+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 300
+ARGP4
+ADDRLP4 144
+ARGP4
+ADDRLP4 284
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $702
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 300
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddWeaponWithPowerups
+CALLV
+pop
+LABELV $693
+ADDRLP4 468
+ADDRFP4 8
+INDIRP4
+CNSTI4 168
+ADDP4
+ASGNP4
+ADDRLP4 472
+ADDRGP4 cg_entities
+ASGNP4
+ADDRLP4 440
+CNSTI4 808
+ADDRLP4 468
+INDIRP4
+INDIRI4
+MULI4
+ADDRLP4 472
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 440
+INDIRP4
+CVPU4 4
+ADDRLP4 472
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 808
+DIVI4
+ADDRLP4 468
+INDIRP4
+INDIRI4
+EQI4 $703
+ADDRLP4 440
+ADDRFP4 8
+INDIRP4
+ASGNP4
+LABELV $703
+ADDRLP4 140
+INDIRI4
+CNSTI4 9
+EQI4 $709
+ADDRLP4 140
+INDIRI4
+CNSTI4 6
+EQI4 $709
+ADDRLP4 140
+INDIRI4
+CNSTI4 11
+EQI4 $709
+ADDRLP4 140
+INDIRI4
+CNSTI4 12
+NEI4 $705
+LABELV $709
+ADDRLP4 440
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $705
+ADDRGP4 $706
+JUMPV
+LABELV $705
+ADDRLP4 140
+INDIRI4
+CNSTI4 3
+EQI4 $719
+ADDRLP4 140
+INDIRI4
+CNSTI4 8
+EQI4 $719
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+EQI4 $719
+ADDRLP4 140
+INDIRI4
+CNSTI4 5
+EQI4 $719
+ADDRLP4 140
+INDIRI4
+CNSTI4 4
+EQI4 $719
+ADDRLP4 140
+INDIRI4
+CNSTI4 7
+EQI4 $719
+ADDRLP4 140
+INDIRI4
+CNSTI4 10
+NEI4 $713
+LABELV $719
+ADDRGP4 cg+107612
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 20
+LTI4 $710
+LABELV $713
+ADDRGP4 $641
+JUMPV
+LABELV $710
+LABELV $706
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+24
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+8
+ADDRLP4 284
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 0
+NEI4 $724
+ADDRGP4 $641
+JUMPV
+LABELV $724
+ADDRLP4 140
+INDIRI4
+CNSTI4 10
+NEI4 $727
+ADDRLP4 484
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 480
+CNSTI4 1836
+ADDRLP4 484
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088
+ADDP4
+ASGNP4
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 5
+LTI4 $730
+ADDRLP4 480
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $733
+ADDRLP4 0+116
+CNSTU1 0
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 0
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $731
+JUMPV
+LABELV $733
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 0
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 0
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $731
+JUMPV
+LABELV $730
+ADDRLP4 492
+CNSTF4 1132396544
+ADDRLP4 480
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 496
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 492
+INDIRF4
+ADDRLP4 496
+INDIRF4
+LTF4 $751
+ADDRLP4 488
+ADDRLP4 492
+INDIRF4
+ADDRLP4 496
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $752
+JUMPV
+LABELV $751
+ADDRLP4 488
+ADDRLP4 492
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $752
+ADDRLP4 0+116
+ADDRLP4 488
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 504
+CNSTF4 1132396544
+ADDRLP4 480
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 508
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 504
+INDIRF4
+ADDRLP4 508
+INDIRF4
+LTF4 $756
+ADDRLP4 500
+ADDRLP4 504
+INDIRF4
+ADDRLP4 508
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $757
+JUMPV
+LABELV $756
+ADDRLP4 500
+ADDRLP4 504
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $757
+ADDRLP4 0+116+1
+ADDRLP4 500
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 516
+CNSTF4 1132396544
+ADDRLP4 480
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 520
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 516
+INDIRF4
+ADDRLP4 520
+INDIRF4
+LTF4 $761
+ADDRLP4 512
+ADDRLP4 516
+INDIRF4
+ADDRLP4 520
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $762
+JUMPV
+LABELV $761
+ADDRLP4 512
+ADDRLP4 516
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $762
+ADDRLP4 0+116+2
+ADDRLP4 512
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 524
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+116
+INDIRU1
+CVUI4 1
+ADDRLP4 524
+INDIRI4
+NEI4 $765
+ADDRLP4 0+116+1
+INDIRU1
+CVUI4 1
+ADDRLP4 524
+INDIRI4
+NEI4 $765
+ADDRLP4 0+116+2
+INDIRU1
+CVUI4 1
+ADDRLP4 524
+INDIRI4
+NEI4 $765
+ADDRLP4 0+116
+CNSTU1 0
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 0
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+LABELV $765
+LABELV $731
+LABELV $727
+ADDRLP4 288+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 288
+CNSTF4 0
+ASGNF4
+ADDRLP4 480
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 288+8
+CNSTF4 1092616192
+CNSTF4 1073741824
+ADDRLP4 480
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 288
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $780
+ADDRLP4 140
+INDIRI4
+CNSTI4 9
+NEI4 $781
+ADDRLP4 440
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+NEI4 $784
+ADDRLP4 0+28
+ARGP4
+CNSTF4 1050253722
+ARGF4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AxisScale
+CALLV
+pop
+ADDRGP4 $781
+JUMPV
+LABELV $784
+ADDRFP4 8
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $781
+ADDRGP4 cg+108584
+INDIRI4
+CNSTI4 500
+ADDI4
+ADDRGP4 cg+107612
+INDIRI4
+GEI4 $781
+ADDRGP4 cgs+160652+1040
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 cg+108584
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRGP4 $781
+JUMPV
+LABELV $780
+ADDRFP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $797
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 1800
+GEI4 $797
+ADDRLP4 0+28
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1155596288
+DIVF4
+ARGF4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AxisScale
+CALLV
+pop
+ADDRGP4 cg+108588
+INDIRI4
+CNSTI4 0
+NEI4 $802
+ADDRGP4 cgs+160652+1044
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 cg+108588
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRGP4 $799
+CNSTI4 0
+ASGNI4
+LABELV $802
+ADDRLP4 488
+ADDRGP4 $799
+INDIRI4
+ASGNI4
+ADDRLP4 488
+INDIRI4
+CNSTI4 11
+GTI4 $798
+ADDRLP4 492
+CNSTI4 200
+ASGNI4
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 cg+108588
+INDIRI4
+SUBI4
+ADDRLP4 492
+INDIRI4
+ADDRLP4 488
+INDIRI4
+MULI4
+ADDRLP4 492
+INDIRI4
+ADDI4
+LTI4 $798
+ADDRGP4 $799
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+160652+1044+4
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRLP4 496
+ADDRGP4 $799
+ASGNP4
+ADDRLP4 496
+INDIRP4
+ADDRLP4 496
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $798
+JUMPV
+LABELV $797
+ADDRFP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $816
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 1800
+LEI4 $816
+ADDRGP4 cg+108584
+INDIRI4
+CNSTI4 500
+ADDI4
+ADDRGP4 cg+107612
+INDIRI4
+GEI4 $816
+ADDRGP4 cgs+160652+1040
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 cg+108584
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+LABELV $816
+LABELV $798
+LABELV $781
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $824
+ADDRFP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 4
+EQI4 $824
+ADDRGP4 cg+108588
+CNSTI4 0
+ASGNI4
+LABELV $824
+ADDRLP4 0
+ARGP4
+ADDRLP4 144
+ARGP4
+ADDRLP4 284
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $827
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 140
+INDIRI4
+CNSTI4 12
+NEI4 $828
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $836
+ADDRGP4 cg+108596
+INDIRI4
+CNSTI4 0
+NEI4 $836
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ADDRGP4 cg+108604+140
+INDIRI4
+EQI4 $641
+LABELV $836
+ADDRLP4 440
+INDIRP4
+ARGP4
+ADDRLP4 0+68
+ARGP4
+ADDRGP4 CG_SprayTrail
+CALLV
+pop
+ADDRGP4 $641
+JUMPV
+LABELV $828
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $844
+ADDRGP4 cg+108596
+INDIRI4
+CNSTI4 0
+NEI4 $844
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ADDRGP4 cg+108604+140
+INDIRI4
+EQI4 $838
+LABELV $844
+ADDRLP4 440
+INDIRP4
+ARGP4
+ADDRLP4 0+68
+ARGP4
+ADDRGP4 CG_LightningBolt
+CALLV
+pop
+ADDRLP4 492
+CNSTF4 0
+ASGNF4
+ADDRLP4 284
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 492
+INDIRF4
+NEF4 $849
+ADDRLP4 284
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDRLP4 492
+INDIRF4
+NEF4 $849
+ADDRLP4 284
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ADDRLP4 492
+INDIRF4
+EQF4 $846
+LABELV $849
+ADDRLP4 496
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+68
+ARGP4
+ADDRLP4 496
+INDIRI4
+CNSTI4 31
+BANDI4
+CNSTI4 300
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 284
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 284
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 284
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $846
+LABELV $838
+LABELV $641
+endproc CG_AddPlayerWeapon 528 20
+export CG_AddViewWeapon
+proc CG_AddViewWeapon 200 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 4
+NEI4 $852
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $852
+ADDRGP4 $851
+JUMPV
+LABELV $852
+ADDRFP4 0
+INDIRP4
+CNSTI4 252
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $855
+ADDRGP4 $851
+JUMPV
+LABELV $855
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $857
+ADDRGP4 $851
+JUMPV
+LABELV $857
+ADDRGP4 cg+108596
+INDIRI4
+CNSTI4 0
+EQI4 $859
+ADDRGP4 $851
+JUMPV
+LABELV $859
+ADDRLP4 180
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_drawGun+12
+INDIRI4
+ADDRLP4 180
+INDIRI4
+EQI4 $866
+ADDRGP4 cg+111040
+INDIRI4
+ADDRLP4 180
+INDIRI4
+EQI4 $862
+LABELV $866
+ADDRGP4 cg+108604+104
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $851
+ADDRLP4 184
+ADDRGP4 cg+110648+24
+INDIRB
+ASGNB 12
+ADDRLP4 196
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 184
+ADDRLP4 184
+INDIRF4
+ADDRLP4 196
+INDIRF4
+ADDRGP4 cg+110648+36+24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 184+4
+ADDRLP4 184+4
+INDIRF4
+ADDRLP4 196
+INDIRF4
+ADDRGP4 cg+110648+36+24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 184+8
+ADDRLP4 184+8
+INDIRF4
+CNSTF4 3238002688
+ADDRGP4 cg+110648+36+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 808
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ARGP4
+ADDRLP4 184
+ARGP4
+ADDRGP4 CG_LightningBolt
+CALLV
+pop
+ADDRGP4 $851
+JUMPV
+LABELV $862
+ADDRGP4 cg+132100
+INDIRI4
+CNSTI4 0
+EQI4 $888
+ADDRGP4 $851
+JUMPV
+LABELV $888
+ADDRGP4 cg_fov+12
+INDIRI4
+CNSTI4 90
+LEI4 $891
+ADDRLP4 156
+CNSTF4 3192704205
+ADDRGP4 cg_fov+12
+INDIRI4
+CNSTI4 90
+SUBI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRGP4 $892
+JUMPV
+LABELV $891
+ADDRLP4 156
+CNSTF4 0
+ASGNF4
+LABELV $892
+ADDRLP4 152
+ADDRGP4 cg+109072
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+ADDRLP4 172
+CNSTI4 132
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ARGP4
+ADDRLP4 160
+ARGP4
+ADDRGP4 CG_CalculateWeaponPosition
+CALLV
+pop
+ADDRLP4 144
+ADDRGP4 cg_gun_x+8
+INDIRF4
+ASGNF4
+ADDRLP4 148
+ADDRGP4 cg_gun_y+8
+INDIRF4
+ASGNF4
+ADDRLP4 140
+ADDRGP4 cg_gun_z+8
+INDIRF4
+ADDRLP4 156
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 cg_correctedWeaponPos+12
+INDIRI4
+CNSTI4 0
+EQI4 $900
+ADDRLP4 184
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 1
+LTI4 $903
+ADDRLP4 184
+INDIRI4
+CNSTI4 12
+GTI4 $903
+ADDRLP4 184
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $917-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $917
+address $906
+address $907
+address $908
+address $909
+address $910
+address $911
+address $912
+address $913
+address $914
+address $915
+address $903
+address $916
+code
+LABELV $906
+ADDRLP4 144
+ADDRLP4 144
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 148
+INDIRF4
+CNSTF4 3241148416
+ADDF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+CNSTF4 3212836864
+ADDF4
+ASGNF4
+ADDRGP4 $904
+JUMPV
+LABELV $907
+ADDRLP4 144
+ADDRLP4 144
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 148
+INDIRF4
+CNSTF4 3229614080
+ADDF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+CNSTF4 3212836864
+ADDF4
+ASGNF4
+ADDRGP4 $904
+JUMPV
+LABELV $908
+ADDRLP4 192
+CNSTF4 3221225472
+ASGNF4
+ADDRLP4 144
+ADDRLP4 144
+INDIRF4
+ADDRLP4 192
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 148
+INDIRF4
+ADDRLP4 192
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $904
+JUMPV
+LABELV $909
+ADDRLP4 144
+ADDRLP4 144
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 148
+INDIRF4
+CNSTF4 3225419776
+ADDF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+CNSTF4 3212836864
+ADDF4
+ASGNF4
+ADDRGP4 $904
+JUMPV
+LABELV $910
+ADDRLP4 144
+ADDRLP4 144
+INDIRF4
+CNSTF4 1088421888
+ADDF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 148
+INDIRF4
+CNSTF4 3235905536
+ADDF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+CNSTF4 3229614080
+ADDF4
+ASGNF4
+ADDRGP4 $904
+JUMPV
+LABELV $911
+ADDRLP4 144
+ADDRLP4 144
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ASGNF4
+ADDRLP4 196
+CNSTF4 3221225472
+ASGNF4
+ADDRLP4 148
+ADDRLP4 148
+INDIRF4
+ADDRLP4 196
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+ADDRLP4 196
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $904
+JUMPV
+LABELV $912
+ADDRLP4 144
+ADDRLP4 144
+INDIRF4
+CNSTF4 1100480512
+ADDF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 148
+INDIRF4
+CNSTF4 3235905536
+ADDF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+CNSTF4 3212836864
+ADDF4
+ASGNF4
+ADDRGP4 $904
+JUMPV
+LABELV $913
+ADDRLP4 144
+ADDRLP4 144
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 148
+INDIRF4
+CNSTF4 3225419776
+ADDF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+CNSTF4 0
+ADDF4
+ASGNF4
+ADDRGP4 $904
+JUMPV
+LABELV $914
+ADDRLP4 144
+ADDRLP4 144
+INDIRF4
+CNSTF4 3212836864
+ADDF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 148
+INDIRF4
+CNSTF4 3221225472
+ADDF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ASGNF4
+ADDRGP4 $904
+JUMPV
+LABELV $915
+ADDRLP4 144
+ADDRLP4 144
+INDIRF4
+CNSTF4 1100480512
+ADDF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 148
+INDIRF4
+CNSTF4 3235905536
+ADDF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+CNSTF4 3212836864
+ADDF4
+ASGNF4
+ADDRGP4 $904
+JUMPV
+LABELV $916
+ADDRLP4 144
+ADDRLP4 144
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 148
+INDIRF4
+CNSTF4 3225419776
+ADDF4
+ASGNF4
+LABELV $903
+LABELV $904
+LABELV $900
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+CNSTF4 1088421888
+CNSTF4 1073741824
+ADDRGP4 cg+108576
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRGP4 cg+110648+36
+INDIRF4
+ADDRLP4 144
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRGP4 cg+110648+36+4
+INDIRF4
+ADDRLP4 144
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg+110648+36+8
+INDIRF4
+ADDRLP4 144
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRGP4 cg+110648+36+12
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRGP4 cg+110648+36+12+4
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg+110648+36+12+8
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRGP4 cg+110648+36+24
+INDIRF4
+ADDRLP4 140
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRGP4 cg+110648+36+24+4
+INDIRF4
+ADDRLP4 140
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg+110648+36+24+8
+INDIRF4
+ADDRLP4 140
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 160
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRGP4 cg_gun_frame+12
+INDIRI4
+CNSTI4 0
+EQI4 $981
+ADDRLP4 184
+ADDRGP4 cg_gun_frame+12
+INDIRI4
+ASGNI4
+ADDRLP4 0+96
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRLP4 0+80
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRLP4 0+100
+CNSTF4 0
+ASGNF4
+ADDRGP4 $982
+JUMPV
+LABELV $981
+ADDRLP4 176
+CNSTI4 1836
+ADDRLP4 152
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41088
+ADDP4
+ASGNP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 152
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 188
+ADDRGP4 CG_MapTorsoToWeaponFrame
+CALLI4
+ASGNI4
+ADDRLP4 0+80
+ADDRLP4 188
+INDIRI4
+ASGNI4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 152
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 192
+ADDRGP4 CG_MapTorsoToWeaponFrame
+CALLI4
+ASGNI4
+ADDRLP4 0+96
+ADDRLP4 192
+INDIRI4
+ASGNI4
+ADDRLP4 0+100
+ADDRLP4 152
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $982
+ADDRLP4 0+8
+ADDRLP4 172
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+4
+CNSTI4 13
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cg+109072
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 252
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddPlayerWeapon
+CALLV
+pop
+LABELV $851
+endproc CG_AddViewWeapon 200 16
+export CG_DrawWeaponSelect
+proc CG_DrawWeaponSelect 56 20
+ADDRGP4 cg+108604+184
+INDIRI4
+CNSTI4 0
+GTI4 $996
+ADDRGP4 $995
+JUMPV
+LABELV $996
+ADDRGP4 cg+131812
+INDIRI4
+ARGI4
+CNSTI4 1400
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1001
+ADDRGP4 $995
+JUMPV
+LABELV $1001
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 cg+131804
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 3
+EQI4 $1009
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 7
+NEI4 $1005
+LABELV $1009
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1010
+ADDRLP4 8
+CNSTI4 4096
+ASGNI4
+ADDRGP4 $1011
+JUMPV
+LABELV $1010
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 -4097
+BANDI4
+ASGNI4
+LABELV $1011
+LABELV $1005
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $1013
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $1017
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1017
+LABELV $1014
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $1013
+ADDRLP4 4
+CNSTI4 320
+CNSTI4 20
+ADDRLP4 16
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 360
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $1019
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $1023
+ADDRGP4 $1020
+JUMPV
+LABELV $1023
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+NEI4 $1025
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1025
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 36
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+352
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $1026
+JUMPV
+LABELV $1025
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+NEI4 $1030
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1030
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 40
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+344
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $1031
+JUMPV
+LABELV $1030
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 44
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+CNSTI4 132
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $1031
+LABELV $1026
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+110500
+INDIRI4
+NEI4 $1036
+ADDRLP4 48
+CNSTI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 48
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 52
+CNSTF4 1109393408
+ASGNF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+124
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $1036
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1041
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 48
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652+204
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $1041
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 40
+ADDI4
+ASGNI4
+LABELV $1020
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $1019
+CNSTI4 132
+ADDRGP4 cg+110500
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1046
+ADDRLP4 24
+CNSTI4 132
+ADDRGP4 cg+110500
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+4
+ADDP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1052
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 36
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 640
+ADDRLP4 28
+INDIRI4
+SUBI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 22
+SUBI4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawBigStringColor
+CALLV
+pop
+LABELV $1052
+LABELV $1046
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $995
+endproc CG_DrawWeaponSelect 56 20
+proc CG_WeaponSelectableSprayroom 0 0
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 3
+EQI4 $1059
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 7
+NEI4 $1055
+LABELV $1059
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1060
+ADDRFP4 0
+INDIRI4
+CNSTI4 12
+NEI4 $1063
+CNSTI4 1
+RETI4
+ADDRGP4 $1054
+JUMPV
+LABELV $1063
+CNSTI4 0
+RETI4
+ADDRGP4 $1054
+JUMPV
+LABELV $1060
+LABELV $1055
+ADDRFP4 0
+INDIRI4
+CNSTI4 12
+NEI4 $1065
+CNSTI4 0
+RETI4
+ADDRGP4 $1054
+JUMPV
+LABELV $1065
+CNSTI4 1
+RETI4
+LABELV $1054
+endproc CG_WeaponSelectableSprayroom 0 0
+proc CG_WeaponSelectable 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $1070
+ADDRFP4 0
+INDIRI4
+CNSTI4 12
+LEI4 $1068
+LABELV $1070
+CNSTI4 0
+RETI4
+ADDRGP4 $1067
+JUMPV
+LABELV $1068
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRFP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $1071
+CNSTI4 0
+RETI4
+ADDRGP4 $1067
+JUMPV
+LABELV $1071
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1074
+CNSTI4 0
+RETI4
+ADDRGP4 $1067
+JUMPV
+LABELV $1074
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_WeaponSelectableSprayroom
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1077
+CNSTI4 0
+RETI4
+ADDRGP4 $1067
+JUMPV
+LABELV $1077
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1079
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $1082
+ADDRFP4 0
+INDIRI4
+CNSTI4 12
+EQI4 $1082
+CNSTI4 0
+RETI4
+ADDRGP4 $1067
+JUMPV
+LABELV $1082
+LABELV $1079
+CNSTI4 1
+RETI4
+LABELV $1067
+endproc CG_WeaponSelectable 12 4
+export CG_NextWeapon_f
+proc CG_NextWeapon_f 16 4
+ADDRGP4 cg+111040
+INDIRI4
+CNSTI4 0
+EQI4 $1085
+ADDRGP4 CG_ZoomDown_f
+CALLV
+pop
+LABELV $1085
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1088
+ADDRGP4 $1084
+JUMPV
+LABELV $1088
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $1091
+ADDRGP4 $1084
+JUMPV
+LABELV $1091
+ADDRGP4 cg+131812
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg+110500
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1097
+ADDRLP4 8
+ADDRGP4 cg+110500
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 cg+110500
+INDIRI4
+CNSTI4 15
+NEI4 $1102
+ADDRGP4 cg+110500
+CNSTI4 0
+ASGNI4
+LABELV $1102
+ADDRGP4 cg+110500
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_WeaponSelectable
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1106
+ADDRGP4 $1099
+JUMPV
+LABELV $1106
+LABELV $1098
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+LTI4 $1097
+LABELV $1099
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+LTI4 $1109
+ADDRGP4 cg+110500
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $1109
+LABELV $1084
+endproc CG_NextWeapon_f 16 4
+export CG_PrevWeapon_f
+proc CG_PrevWeapon_f 16 4
+ADDRGP4 cg+111040
+INDIRI4
+CNSTI4 0
+EQI4 $1113
+ADDRGP4 CG_ZoomDown_f
+CALLV
+pop
+LABELV $1113
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1116
+ADDRGP4 $1112
+JUMPV
+LABELV $1116
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $1119
+ADDRGP4 $1112
+JUMPV
+LABELV $1119
+ADDRGP4 cg+131812
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg+110500
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1125
+ADDRLP4 8
+ADDRGP4 cg+110500
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 cg+110500
+INDIRI4
+CNSTI4 -1
+NEI4 $1130
+ADDRGP4 cg+110500
+CNSTI4 14
+ASGNI4
+LABELV $1130
+ADDRGP4 cg+110500
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_WeaponSelectable
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1134
+ADDRGP4 $1127
+JUMPV
+LABELV $1134
+LABELV $1126
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+LTI4 $1125
+LABELV $1127
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+LTI4 $1137
+ADDRGP4 cg+110500
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $1137
+LABELV $1112
+endproc CG_PrevWeapon_f 16 4
+export CG_Weapon_f
+proc CG_Weapon_f 20 4
+ADDRGP4 cg+44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1141
+ADDRGP4 $1140
+JUMPV
+LABELV $1141
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $1144
+ADDRGP4 $1140
+JUMPV
+LABELV $1144
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 cg+111040
+INDIRI4
+CNSTI4 0
+EQI4 $1147
+ADDRGP4 CG_ZoomDown_f
+CALLV
+pop
+LABELV $1147
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_WeaponSelectableSprayroom
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $1150
+ADDRGP4 $1140
+JUMPV
+LABELV $1150
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1152
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $1155
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+EQI4 $1155
+ADDRGP4 $1140
+JUMPV
+LABELV $1155
+LABELV $1152
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $1159
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LEI4 $1157
+LABELV $1159
+ADDRGP4 $1140
+JUMPV
+LABELV $1157
+ADDRGP4 cg+131812
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $1162
+ADDRGP4 $1140
+JUMPV
+LABELV $1162
+ADDRGP4 cg+110500
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $1140
+endproc CG_Weapon_f 20 4
+export CG_WeaponSRWC
+proc CG_WeaponSRWC 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+111040
+INDIRI4
+CNSTI4 0
+EQI4 $1167
+ADDRGP4 CG_ZoomDown_f
+CALLV
+pop
+LABELV $1167
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $1172
+ADDRFP4 0
+INDIRI4
+CNSTI4 12
+LEI4 $1170
+LABELV $1172
+ADDRGP4 $1166
+JUMPV
+LABELV $1170
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRFP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $1173
+ADDRGP4 $1166
+JUMPV
+LABELV $1173
+ADDRGP4 cg+131812
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRGP4 cg+110500
+ADDRFP4 0
+INDIRI4
+ASGNI4
+LABELV $1166
+endproc CG_WeaponSRWC 4 0
+export CG_OutOfAmmoChange
+proc CG_OutOfAmmoChange 8 4
+ADDRGP4 cg+111040
+INDIRI4
+CNSTI4 0
+EQI4 $1180
+ADDRGP4 CG_ZoomDown_f
+CALLV
+pop
+LABELV $1180
+ADDRGP4 cg+131812
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 14
+ASGNI4
+LABELV $1185
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_WeaponSelectable
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1189
+ADDRGP4 cg+110500
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $1187
+JUMPV
+LABELV $1189
+LABELV $1186
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $1185
+LABELV $1187
+LABELV $1179
+endproc CG_OutOfAmmoChange 8 4
+export CG_FireWeapon
+proc CG_FireWeapon 24 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1193
+ADDRGP4 $1192
+JUMPV
+LABELV $1193
+ADDRLP4 8
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 15
+LTI4 $1195
+ADDRGP4 $1197
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $1192
+JUMPV
+LABELV $1195
+ADDRLP4 4
+CNSTI4 132
+ADDRLP4 8
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $1199
+ADDRFP4 0
+INDIRP4
+CNSTI4 632
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1201
+ADDRGP4 $1192
+JUMPV
+LABELV $1201
+LABELV $1199
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1203
+CNSTP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 cgs+160652+1116
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $1203
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1207
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1211
+ADDRGP4 $1209
+JUMPV
+LABELV $1211
+LABELV $1208
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $1207
+LABELV $1209
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $1213
+ADDRLP4 12
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1215
+ADDRLP4 8
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1217
+ADDRLP4 8
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $1217
+CNSTP4 0
+ARGP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $1218
+JUMPV
+LABELV $1217
+CNSTP4 0
+ARGP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $1218
+LABELV $1215
+LABELV $1213
+LABELV $1192
+endproc CG_FireWeapon 24 16
+export CG_MissileHitWall
+proc CG_MissileHitWall 160 72
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 16
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 68
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 600
+ASGNI4
+ADDRLP4 76
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LTI4 $1222
+ADDRFP4 0
+INDIRI4
+CNSTI4 14
+GTI4 $1222
+ADDRFP4 0
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LSHI4
+ADDRGP4 $1333-8
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1333
+address $1301
+address $1294
+address $1231
+address $1245
+address $1224
+address $1275
+address $1281
+address $1284
+address $1327
+address $1222
+address $1222
+address $1308
+address $1261
+code
+LABELV $1222
+LABELV $1224
+ADDRLP4 20
+ADDRGP4 cgs+160652+916
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRGP4 cgs+160652+800
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRLP4 44
+CNSTI4 400
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+160652+300
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 $1223
+JUMPV
+LABELV $1231
+ADDRLP4 20
+ADDRGP4 cgs+160652+916
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRGP4 cgs+160652+804
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 cgs+160652+1100
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+160652+304
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 48
+CNSTF4 1133903872
+ASGNF4
+ADDRLP4 44
+CNSTI4 600
+ASGNI4
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRLP4 80
+CNSTF4 0
+ASGNF4
+ADDRLP4 52
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRLP4 52+4
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRLP4 52+8
+CNSTF4 1133903872
+ASGNF4
+ADDRGP4 cgs+160652+784
+INDIRI4
+ARGI4
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTF4 1098907648
+ARGF4
+ADDRLP4 52
+ARGP4
+CNSTF4 1123024896
+ARGF4
+CNSTF4 1128792064
+ARGF4
+CNSTI4 30
+ARGI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRGP4 cg+107612
+INDIRI4
+ARGI4
+CNSTI4 500
+ARGI4
+CNSTI4 70
+ARGI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRGP4 CG_GenerateParticles
+CALLV
+pop
+ADDRGP4 $1223
+JUMPV
+LABELV $1245
+ADDRLP4 20
+ADDRGP4 cgs+160652+916
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRGP4 cgs+160652+936
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 cgs+160652+1104
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+160652+304
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 48
+CNSTF4 1133903872
+ASGNF4
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRLP4 44
+CNSTI4 1000
+ASGNI4
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 88
+CNSTF4 0
+ASGNF4
+ADDRLP4 52
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRLP4 52+4
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRLP4 52+8
+CNSTF4 1137180672
+ASGNF4
+ADDRGP4 cgs+160652+808
+INDIRI4
+ARGI4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTF4 1098907648
+ARGF4
+ADDRLP4 52
+ARGP4
+CNSTF4 1123024896
+ARGF4
+CNSTF4 1132068864
+ARGF4
+CNSTI4 30
+ARGI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRGP4 cg+107612
+INDIRI4
+ARGI4
+CNSTI4 700
+ARGI4
+CNSTI4 400
+ARGI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+CNSTI4 96
+ARGI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRGP4 CG_GenerateParticles
+CALLV
+pop
+ADDRGP4 $1223
+JUMPV
+LABELV $1261
+ADDRLP4 16
+ADDRGP4 cgs+160652+872
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $1264
+ADDRLP4 32
+ADDRGP4 cgs+160652+852
+INDIRI4
+ASGNI4
+ADDRGP4 $1265
+JUMPV
+LABELV $1264
+ADDRFP4 16
+INDIRI4
+CNSTI4 1
+NEI4 $1268
+ADDRLP4 32
+ADDRGP4 cgs+160652+848
+INDIRI4
+ASGNI4
+LABELV $1268
+LABELV $1265
+ADDRGP4 cgs+160652+844
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTF4 1073741824
+ARGF4
+ADDRGP4 vec3_origin
+ARGP4
+CNSTF4 1123024896
+ARGF4
+CNSTF4 1133903872
+ARGF4
+CNSTI4 10
+ARGI4
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 cg+107612
+INDIRI4
+ARGI4
+CNSTI4 300
+ARGI4
+CNSTI4 200
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 CG_GenerateParticles
+CALLV
+pop
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1223
+JUMPV
+LABELV $1275
+ADDRLP4 0
+ADDRGP4 cgs+160652+792
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTF4 1090519040
+ASGNF4
+ADDRGP4 cgs+160652+788
+INDIRI4
+ARGI4
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRLP4 100
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTF4 1073741824
+ARGF4
+ADDRGP4 vec3_origin
+ARGP4
+CNSTF4 1123024896
+ARGF4
+CNSTF4 1133903872
+ARGF4
+CNSTI4 20
+ARGI4
+ADDRLP4 100
+INDIRI4
+ARGI4
+ADDRGP4 cg+107612
+INDIRI4
+ARGI4
+CNSTI4 300
+ARGI4
+CNSTI4 200
+ARGI4
+ADDRLP4 100
+INDIRI4
+ARGI4
+ADDRLP4 100
+INDIRI4
+ARGI4
+ADDRLP4 100
+INDIRI4
+ARGI4
+ADDRLP4 100
+INDIRI4
+ARGI4
+ADDRLP4 100
+INDIRI4
+ARGI4
+ADDRLP4 100
+INDIRI4
+ARGI4
+ADDRGP4 CG_GenerateParticles
+CALLV
+pop
+ADDRGP4 $1223
+JUMPV
+LABELV $1281
+ADDRLP4 0
+ADDRGP4 cgs+160652+796
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTF4 1103101952
+ASGNF4
+ADDRLP4 104
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRGP4 $1223
+JUMPV
+LABELV $1284
+ADDRLP4 108
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 108
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 14
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 1000
+ADDI4
+ASGNI4
+ADDRLP4 112
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 112
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 112
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 116
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDRLP4 116
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 232
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+CNSTF4 1098907648
+ADDRFP4 12
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 120
+CNSTI4 4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 236
+ADDP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 120
+INDIRI4
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+ADDRFP4 12
+INDIRP4
+ADDRLP4 120
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124
+CNSTI4 8
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 240
+ADDP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 124
+INDIRI4
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+ADDRFP4 12
+INDIRP4
+ADDRLP4 124
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 128
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTF4 1135869952
+CNSTF4 1073741824
+ADDRLP4 128
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 132
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTF4 1135869952
+CNSTF4 1073741824
+ADDRLP4 132
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 136
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTF4 1135869952
+CNSTF4 1073741824
+ADDRLP4 136
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRGP4 cgs+160652+780
+INDIRI4
+ARGI4
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTF4 1098907648
+ARGF4
+ADDRGP4 vec3_origin
+ARGP4
+CNSTF4 1135869952
+ARGF4
+CNSTF4 1153138688
+ARGF4
+CNSTI4 50
+ARGI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRGP4 cg+107612
+INDIRI4
+ARGI4
+CNSTI4 700
+ARGI4
+CNSTI4 400
+ARGI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRGP4 CG_GenerateParticles
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 cgs+160652+304
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 16
+ADDRGP4 cgs+160652+1036
+INDIRI4
+ASGNI4
+ADDRGP4 $1223
+JUMPV
+LABELV $1294
+ADDRLP4 20
+ADDRGP4 cgs+160652+768
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 cgs+160652+1096
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+160652+304
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTF4 1103101952
+ASGNF4
+ADDRGP4 $1223
+JUMPV
+LABELV $1301
+ADDRLP4 20
+ADDRGP4 cgs+160652+916
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRGP4 cgs+160652+760
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+160652+304
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTF4 1082130432
+ASGNF4
+ADDRGP4 $1223
+JUMPV
+LABELV $1308
+ADDRLP4 20
+ADDRGP4 cgs+160652+916
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRGP4 cgs+160652+820
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 cgs+160652+824
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+160652+304
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 48
+CNSTF4 1133903872
+ASGNF4
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRLP4 44
+CNSTI4 800
+ASGNI4
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 1060320051
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 144
+CNSTF4 0
+ASGNF4
+ADDRLP4 52
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 52+4
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 52+8
+CNSTF4 1133903872
+ASGNF4
+ADDRGP4 cgs+160652+828
+INDIRI4
+ARGI4
+ADDRLP4 148
+CNSTI4 0
+ASGNI4
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTF4 1090519040
+ARGF4
+ADDRLP4 52
+ARGP4
+CNSTF4 1110704128
+ARGF4
+CNSTF4 1125515264
+ARGF4
+CNSTI4 4
+ARGI4
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRGP4 cg+107612
+INDIRI4
+ARGI4
+CNSTI4 3000
+ARGI4
+CNSTI4 500
+ARGI4
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRLP4 148
+INDIRI4
+ARGI4
+CNSTI4 98
+ARGI4
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRGP4 CG_GenerateParticles
+CALLV
+pop
+ADDRGP4 cgs+160652+832
+INDIRI4
+ARGI4
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTF4 1090519040
+ARGF4
+ADDRLP4 52
+ARGP4
+CNSTF4 1110704128
+ARGF4
+CNSTF4 1125515264
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRGP4 cg+107612
+INDIRI4
+ARGI4
+CNSTI4 3000
+ARGI4
+CNSTI4 500
+ARGI4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 152
+INDIRI4
+ARGI4
+CNSTI4 98
+ARGI4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRGP4 CG_GenerateParticles
+CALLV
+pop
+ADDRGP4 $1223
+JUMPV
+LABELV $1327
+ADDRLP4 0
+ADDRGP4 cgs+160652+904
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTF4 1090519040
+ASGNF4
+ADDRGP4 cgs+160652+900
+INDIRI4
+ARGI4
+ADDRLP4 156
+CNSTI4 0
+ASGNI4
+ADDRLP4 156
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTF4 1073741824
+ARGF4
+ADDRGP4 vec3_origin
+ARGP4
+CNSTF4 1123024896
+ARGF4
+CNSTF4 1133903872
+ARGF4
+CNSTI4 20
+ARGI4
+ADDRLP4 156
+INDIRI4
+ARGI4
+ADDRGP4 cg+107612
+INDIRI4
+ARGI4
+CNSTI4 300
+ARGI4
+CNSTI4 200
+ARGI4
+ADDRLP4 156
+INDIRI4
+ARGI4
+ADDRLP4 156
+INDIRI4
+ARGI4
+ADDRLP4 156
+INDIRI4
+ARGI4
+ADDRLP4 156
+INDIRI4
+ARGI4
+ADDRLP4 156
+INDIRI4
+ARGI4
+ADDRLP4 156
+INDIRI4
+ARGI4
+ADDRGP4 CG_GenerateParticles
+CALLV
+pop
+LABELV $1223
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $1335
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 1022
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $1335
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $1337
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 CG_MakeExplosion
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDRLP4 4
+INDIRB
+ASGNB 12
+LABELV $1337
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1339
+ADDRGP4 $1219
+JUMPV
+LABELV $1339
+ADDRFP4 0
+INDIRI4
+CNSTI4 6
+NEI4 $1341
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1341
+ADDRGP4 $1219
+JUMPV
+LABELV $1341
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+160652+796
+INDIRI4
+NEI4 $1346
+ADDRLP4 80
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1347
+JUMPV
+LABELV $1346
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+LABELV $1347
+ADDRLP4 36
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 8
+NEI4 $1348
+ADDRLP4 84
+ADDRFP4 16
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+ASGNP4
+ADDRLP4 88
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTF4 1135869952
+ADDRLP4 88
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 92
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 92
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 92
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_ImpactMark
+CALLV
+pop
+ADDRGP4 $1349
+JUMPV
+LABELV $1348
+ADDRLP4 84
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTF4 1135869952
+ADDRLP4 84
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 88
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_ImpactMark
+CALLV
+pop
+LABELV $1349
+LABELV $1219
+endproc CG_MissileHitWall 160 72
+export CG_MissileHitPlayer
+proc CG_MissileHitPlayer 4 24
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $1352
+ADDRLP4 0
+INDIRI4
+CNSTI4 14
+GTI4 $1352
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1354-16
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1354
+address $1353
+address $1353
+address $1352
+address $1353
+address $1353
+address $1353
+address $1353
+address $1352
+address $1352
+address $1352
+address $1353
+code
+LABELV $1353
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+LABELV $1352
+LABELV $1350
+endproc CG_MissileHitPlayer 4 24
+export CG_ShotgunFire
+proc CG_ShotgunFire 168 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 VectorNormalize2
+CALLF4
+pop
+ADDRLP4 92
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 PerpendicularVector
+CALLV
+pop
+ADDRLP4 24
+ARGP4
+ADDRLP4 92
+ARGP4
+ADDRLP4 104
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 120
+CNSTF4 1148846080
+ASGNF4
+ADDRLP4 12
+ADDRLP4 0
+INDIRF4
+ADDRLP4 120
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 120
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1148846080
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 124
+CNSTP4 0
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 36+12
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 36+12+4
+INDIRF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 36+12+8
+INDIRF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 12
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 148+4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 148+8
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136
+ADDRLP4 148+4
+INDIRF4
+ASGNF4
+ADDRLP4 136+4
+ADDRLP4 148
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 136+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 136
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 160
+CNSTF4 1086324736
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 160
+INDIRF4
+ADDRLP4 136
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 160
+INDIRF4
+ADDRLP4 136+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1086324736
+ADDRLP4 136+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1096810496
+SUBF4
+ASGNF4
+ADDRLP4 132
+CNSTI4 -1
+ASGNI4
+LABELV $1388
+ADDRLP4 164
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 128
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 13
+ASGNI4
+ADDRLP4 128
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRLP4 128
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRGP4 cg+107612
+INDIRI4
+CNSTI4 500
+ADDI4
+ASGNI4
+ADDRLP4 128
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1078530011
+ADDRLP4 132
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1082130432
+DIVF4
+ASGNF4
+ADDRLP4 128
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 136
+INDIRF4
+CNSTI4 6
+ADDRLP4 132
+INDIRI4
+MULI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 128
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 136+4
+INDIRF4
+CNSTI4 6
+ADDRLP4 132
+INDIRI4
+MULI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 128
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 136+8
+INDIRF4
+CNSTI4 6
+ADDRLP4 132
+INDIRI4
+MULI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 128
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 136
+INDIRF4
+CNSTI4 6
+ADDRLP4 132
+INDIRI4
+MULI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 128
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 136+4
+INDIRF4
+CNSTI4 6
+ADDRLP4 132
+INDIRI4
+MULI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 128
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 136+8
+INDIRF4
+CNSTI4 6
+ADDRLP4 132
+INDIRI4
+MULI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1389
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LTI4 $1388
+LABELV $1356
+endproc CG_ShotgunFire 168 28
+proc CG_CalcMuzzlePoint 40 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1403
+ADDRFP4 4
+INDIRP4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 20
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRGP4 cg+44
+INDIRP4
+CNSTI4 196
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+CNSTP4 0
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $1402
+JUMPV
+LABELV $1403
+ADDRLP4 12
+CNSTI4 808
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 420
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1411
+CNSTI4 0
+RETI4
+ADDRGP4 $1402
+JUMPV
+LABELV $1411
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 12
+INDIRP4
+CNSTI4 60
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 20
+CNSTP4 0
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 16
+ADDRLP4 12
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 13
+EQI4 $1415
+ADDRLP4 16
+INDIRI4
+CNSTI4 23
+NEI4 $1413
+LABELV $1415
+ADDRLP4 28
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CNSTF4 1094713344
+ADDF4
+ASGNF4
+ADDRGP4 $1414
+JUMPV
+LABELV $1413
+ADDRLP4 28
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CNSTF4 1104150528
+ADDF4
+ASGNF4
+LABELV $1414
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $1402
+endproc CG_CalcMuzzlePoint 40 16
+import CG_AddBoundingBox
+import CG_AddBoundingBoxEntity
+import CG_QueryCvar
+import CG_Timestamp
+import CG_LimitCvars
+import trap_RealTime
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import trap_R_inPVS
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_Cutscene2d_Draw
+import CG_Cutscene2d_UpdateTrans
+import CG_Cutscene2d_CheckCmd
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import Main_SpriteParticles
+import LaunchRevivalParticle
+import LaunchSpeedyPuffTrail
+import Init_SpriteParticles
+import AddLFsToScreen
+import AddLFToDrawList
+import Init_LensFlareSys
+import DumpPolyInfo
+import ActiveChooseLogoMenu
+import FindLogoForSpraying
+import Add_LogoToDrawList
+import AddLogosToScene
+import Init_SprayLogoSys
+import Calculate_2DOfDIR
+import Calculate_2DOf3D
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_ChangeLoadingProgress
+import CG_LoadingString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_ScorePlum
+import CG_TeleOutEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_GenerateParticles
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_PortalInView
+import CG_InitMarkPolys
+import CG_Boomies_Explosion
+import CG_BamBam_Explosion
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_LerpTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayer
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_UpdateVoipTeamIDs
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Draw3DModel
+import CG_SetPrintString
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import CG_MessagePrint
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_WorldToScreen
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_DrawPic1024
+import CG_DrawRect1024
+import CG_FillRect1024
+import CG_AdjustFrom1024
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddPolyBatched
+import CG_AddRefEntityBatched
+import CG_FlushSceneBatches
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_ForceModelChange
+import CG_GetCvarFloat
+import CG_GetCvarInt
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StreamAssets
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_icons
+import cg_ambient
+import cg_drawBBox
+import cg_drawVoiceNames
+import cg_drawLensflare
+import cg_timestamps
+import cg_skyLensflare
+import cg_sky
+import cg_curWarmupReady
+import cg_warmupReady
+import cg_glowModelTeam
+import cg_glowModel
+import cg_cineDrawLetterBox
+import cg_cineHideHud
+import cg_LPSwallhackAlpha
+import cg_LPSwallhackSize
+import cg_bigScoreType
+import cg_thirdPersonAutoSwitch
+import cg_drawTimeLeft
+import cg_drawServerInfos
+import cg_drawMessages
+import cg_drawups
+import cg_wopFFAhud
+import cg_printDir
+import cg_drawRealTime
+import cg_correctedWeaponPos
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_streamAssets
+import cg_deferPlayers
+import cg_predictItems
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_chatBeep
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_optimizePrediction
+import cg_nopredict
+import cg_errorDecay
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import trailEnt
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $1197
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 45
+byte 1 62
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 62
+byte 1 61
+byte 1 32
+byte 1 87
+byte 1 80
+byte 1 95
+byte 1 78
+byte 1 85
+byte 1 77
+byte 1 95
+byte 1 87
+byte 1 69
+byte 1 65
+byte 1 80
+byte 1 79
+byte 1 78
+byte 1 83
+byte 1 0
+align 1
+LABELV $827
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $702
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $692
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $490
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 86
+byte 1 105
+byte 1 115
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 91
+byte 1 48
+byte 1 45
+byte 1 37
+byte 1 100
+byte 1 93
+byte 1 0
+align 1
+LABELV $483
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 100
+byte 1 117
+byte 1 99
+byte 1 107
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 97
+byte 1 108
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $482
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 100
+byte 1 117
+byte 1 99
+byte 1 107
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 100
+byte 1 117
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $481
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 100
+byte 1 117
+byte 1 99
+byte 1 107
+byte 1 115
+byte 1 47
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $478
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 100
+byte 1 117
+byte 1 99
+byte 1 107
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 117
+byte 1 99
+byte 1 107
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $475
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 100
+byte 1 117
+byte 1 99
+byte 1 107
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 117
+byte 1 99
+byte 1 107
+byte 1 119
+byte 1 104
+byte 1 101
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $472
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 68
+byte 1 117
+byte 1 99
+byte 1 107
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $462
+byte 1 110
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 67
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $459
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 67
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $456
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 67
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $453
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 112
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 108
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $450
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 112
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 108
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 112
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 108
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $447
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 112
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 108
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $444
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 112
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 108
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 112
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 108
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $441
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 112
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 108
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $439
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 117
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 37
+byte 1 105
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $432
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 117
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 121
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $429
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 117
+byte 1 115
+byte 1 47
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $426
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 117
+byte 1 115
+byte 1 82
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $423
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 117
+byte 1 115
+byte 1 67
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $420
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 98
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $417
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $414
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 115
+byte 1 112
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $411
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 117
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $410
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 117
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 0
+align 1
+LABELV $408
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 107
+byte 1 109
+byte 1 97
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $405
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 107
+byte 1 109
+byte 1 97
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 65
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 0
+align 1
+LABELV $402
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 95
+byte 1 107
+byte 1 109
+byte 1 97
+byte 1 0
+align 1
+LABELV $399
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 107
+byte 1 109
+byte 1 97
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $396
+byte 1 107
+byte 1 109
+byte 1 97
+byte 1 66
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $393
+byte 1 107
+byte 1 109
+byte 1 97
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $390
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 109
+byte 1 97
+byte 1 57
+byte 1 55
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $389
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 107
+byte 1 109
+byte 1 97
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $387
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $384
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 114
+byte 1 117
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $381
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 0
+align 1
+LABELV $378
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 48
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $371
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $368
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 66
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $365
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $362
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 0
+align 1
+LABELV $361
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $360
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $358
+byte 1 103
+byte 1 117
+byte 1 109
+byte 1 77
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $355
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 98
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $352
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 121
+byte 1 47
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $349
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 121
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 121
+byte 1 98
+byte 1 50
+byte 1 97
+byte 1 0
+align 1
+LABELV $346
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 121
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 121
+byte 1 98
+byte 1 49
+byte 1 97
+byte 1 0
+align 1
+LABELV $343
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 121
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $340
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $337
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $336
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $334
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $331
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $328
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 66
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $325
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $322
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $321
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $319
+byte 1 112
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $316
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $313
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $311
+byte 1 110
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $308
+byte 1 110
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 66
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $305
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $303
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $301
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 66
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $298
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $295
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $294
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $293
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 0
+align 1
+LABELV $292
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 103
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $290
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 121
+byte 1 47
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 105
+byte 1 100
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $287
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 121
+byte 1 47
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $286
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 121
+byte 1 47
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $285
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 121
+byte 1 47
+byte 1 105
+byte 1 100
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $281
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 110
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 110
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $278
+byte 1 95
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $277
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $273
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $254
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
@@ -0,0 +1,5502 @@
+data
+export initrefdef
+align 4
+LABELV initrefdef
+byte 4 0
+code
+proc Initrefdef2D 20 16
+ADDRGP4 refdef2D
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 368
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 refdef2D+76
+CNSTI4 1
+ASGNI4
+ADDRGP4 refdef2D+24
+CNSTF4 1134559232
+ASGNF4
+ADDRGP4 refdef2D+24+4
+CNSTF4 1131413504
+ASGNF4
+ADDRGP4 refdef2D+24+8
+CNSTF4 1148846080
+ASGNF4
+ADDRGP4 refdef2D+36
+CNSTF4 0
+ASGNF4
+ADDRGP4 refdef2D+36+4
+CNSTF4 0
+ASGNF4
+ADDRGP4 refdef2D+36+8
+CNSTF4 3212836864
+ASGNF4
+ADDRGP4 refdef2D+36+12
+CNSTF4 3212836864
+ASGNF4
+ADDRGP4 refdef2D+36+12+4
+CNSTF4 0
+ASGNF4
+ADDRGP4 refdef2D+36+12+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 refdef2D+36+24
+CNSTF4 0
+ASGNF4
+ADDRGP4 refdef2D+36+24+4
+CNSTF4 3212836864
+ASGNF4
+ADDRGP4 refdef2D+36+24+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 16
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 8
+CNSTF4 1142947840
+ASGNF4
+ADDRLP4 12
+CNSTF4 1139802112
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRGP4 refdef2D
+ADDRLP4 0
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 refdef2D+4
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 refdef2D+8
+ADDRLP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 refdef2D+12
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 refdef2D+16
+CNSTF4 1108210966
+ASGNF4
+ADDRGP4 refdef2D+20
+CNSTF4 1104670344
+ASGNF4
+ADDRGP4 refdef2D+72
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRGP4 initrefdef
+CNSTI4 1
+ASGNI4
+LABELV $80
+endproc Initrefdef2D 20 16
+proc DrawPoly 4 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 initrefdef
+INDIRI4
+CNSTI4 0
+NEI4 $116
+ADDRGP4 Initrefdef2D
+CALLV
+pop
+LABELV $116
+ADDRGP4 trap_R_ClearScene
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+ADDRGP4 refdef2D
+ARGP4
+ADDRGP4 trap_R_RenderScene
+CALLV
+pop
+LABELV $115
+endproc DrawPoly 4 12
+export AdvancedDrawPicA
+proc AdvancedDrawPicA 252 12
+ADDRFP4 36
+ADDRFP4 36
+INDIRP4
+ASGNP4
+ADDRFP4 40
+ADDRFP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 96
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 12
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 96
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 96+8
+ADDRLP4 0
+ASGNP4
+ADDRLP4 96+4
+CNSTI4 4
+ASGNI4
+ADDRLP4 96
+ADDRFP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 128
+CNSTF4 1132396544
+ADDRFP4 36
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 132
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 132
+INDIRF4
+LTF4 $129
+ADDRLP4 124
+ADDRLP4 128
+INDIRF4
+ADDRLP4 132
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $130
+JUMPV
+LABELV $129
+ADDRLP4 124
+ADDRLP4 128
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $130
+ADDRLP4 136
+ADDRLP4 124
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRLP4 0+20
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRLP4 144
+CNSTF4 1132396544
+ADDRFP4 36
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 148
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 144
+INDIRF4
+ADDRLP4 148
+INDIRF4
+LTF4 $143
+ADDRLP4 140
+ADDRLP4 144
+INDIRF4
+ADDRLP4 148
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $144
+JUMPV
+LABELV $143
+ADDRLP4 140
+ADDRLP4 144
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $144
+ADDRLP4 152
+ADDRLP4 140
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+1
+ADDRLP4 152
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20+1
+ADDRLP4 152
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+1
+ADDRLP4 152
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+1
+ADDRLP4 152
+INDIRU1
+ASGNU1
+ADDRLP4 160
+CNSTF4 1132396544
+ADDRFP4 36
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 164
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 160
+INDIRF4
+ADDRLP4 164
+INDIRF4
+LTF4 $157
+ADDRLP4 156
+ADDRLP4 160
+INDIRF4
+ADDRLP4 164
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $158
+JUMPV
+LABELV $157
+ADDRLP4 156
+ADDRLP4 160
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $158
+ADDRLP4 168
+ADDRLP4 156
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+2
+ADDRLP4 168
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20+2
+ADDRLP4 168
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+2
+ADDRLP4 168
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+2
+ADDRLP4 168
+INDIRU1
+ASGNU1
+ADDRLP4 176
+CNSTF4 1132396544
+ADDRFP4 36
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 180
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 176
+INDIRF4
+ADDRLP4 180
+INDIRF4
+LTF4 $171
+ADDRLP4 172
+ADDRLP4 176
+INDIRF4
+ADDRLP4 180
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $172
+JUMPV
+LABELV $171
+ADDRLP4 172
+ADDRLP4 176
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $172
+ADDRLP4 184
+ADDRLP4 172
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+3
+ADDRLP4 184
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20+3
+ADDRLP4 184
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+3
+ADDRLP4 184
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+3
+ADDRLP4 184
+INDIRU1
+ASGNU1
+ADDRFP4 40
+CNSTF4 1016003125
+ADDRFP4 40
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRLP4 188
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 116
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRLP4 192
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 116+4
+ADDRLP4 192
+INDIRF4
+NEGF4
+ASGNF4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRLP4 196
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 108
+ADDRLP4 196
+INDIRF4
+ASGNF4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRLP4 200
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 108+4
+ADDRLP4 200
+INDIRF4
+ASGNF4
+ADDRLP4 204
+ADDRFP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 1
+EQI4 $177
+ADDRLP4 204
+INDIRI4
+CNSTI4 2
+EQI4 $192
+ADDRLP4 204
+INDIRI4
+CNSTI4 3
+EQI4 $209
+ADDRGP4 $175
+JUMPV
+LABELV $175
+LABELV $177
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0+24
+ADDRFP4 0
+INDIRF4
+ADDRLP4 116
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 116+4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48
+ADDRFP4 0
+INDIRF4
+ADDRLP4 116
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 108
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 116+4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 108+4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72
+ADDRFP4 0
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72+4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 108+4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $176
+JUMPV
+LABELV $192
+ADDRLP4 208
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 212
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 208
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 212
+INDIRF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 208
+INDIRF4
+ADDRLP4 108+4
+INDIRF4
+ADDRLP4 212
+INDIRF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0+24
+ADDRFP4 0
+INDIRF4
+ADDRLP4 116
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1056964608
+ADDRLP4 108
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 116+4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1056964608
+ADDRLP4 108+4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0+48
+ADDRFP4 0
+INDIRF4
+ADDRLP4 116
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1056964608
+ADDRLP4 108
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 116+4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1056964608
+ADDRLP4 108+4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72
+ADDRFP4 0
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 108
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72+4
+ADDRFP4 4
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 108+4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $176
+JUMPV
+LABELV $209
+ADDRLP4 216
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 220
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 224
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 216
+INDIRF4
+ADDRLP4 116
+INDIRF4
+ADDRLP4 220
+INDIRF4
+MULF4
+MULF4
+SUBF4
+ADDRLP4 216
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 224
+INDIRF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 216
+INDIRF4
+ADDRLP4 116+4
+INDIRF4
+ADDRLP4 220
+INDIRF4
+MULF4
+MULF4
+SUBF4
+ADDRLP4 216
+INDIRF4
+ADDRLP4 108+4
+INDIRF4
+ADDRLP4 224
+INDIRF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 228
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0+24
+ADDRFP4 0
+INDIRF4
+ADDRLP4 228
+INDIRF4
+ADDRLP4 116
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ADDRLP4 228
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 232
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0+24+4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 232
+INDIRF4
+ADDRLP4 116+4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ADDRLP4 232
+INDIRF4
+ADDRLP4 108+4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 236
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0+48
+ADDRFP4 0
+INDIRF4
+ADDRLP4 236
+INDIRF4
+ADDRLP4 116
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ADDRLP4 236
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 240
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0+48+4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 240
+INDIRF4
+ADDRLP4 116+4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ADDRLP4 240
+INDIRF4
+ADDRLP4 108+4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 244
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0+72
+ADDRFP4 0
+INDIRF4
+ADDRLP4 244
+INDIRF4
+ADDRLP4 116
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+MULF4
+SUBF4
+ADDRLP4 244
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 248
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0+72+4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 248
+INDIRF4
+ADDRLP4 116+4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+MULF4
+SUBF4
+ADDRLP4 248
+INDIRF4
+ADDRLP4 108+4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $176
+ADDRLP4 0+12
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+12+4
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0+24+12
+ADDRFP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+24+12+4
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0+48+12
+ADDRFP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+48+12+4
+ADDRFP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0+72+12
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+72+12+4
+ADDRFP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 96
+ARGP4
+ADDRGP4 DrawPoly
+CALLV
+pop
+LABELV $118
+endproc AdvancedDrawPicA 252 12
+export DrawLine
+proc DrawLine 204 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 104
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 12
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 96
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 104+8
+ADDRLP4 0
+ASGNP4
+ADDRLP4 104+4
+CNSTI4 4
+ASGNI4
+ADDRLP4 104
+ADDRGP4 cgs+160652+8
+INDIRI4
+ASGNI4
+ADDRLP4 124
+CNSTF4 1132396544
+ADDRFP4 20
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 128
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 124
+INDIRF4
+ADDRLP4 128
+INDIRF4
+LTF4 $259
+ADDRLP4 120
+ADDRLP4 124
+INDIRF4
+ADDRLP4 128
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $260
+JUMPV
+LABELV $259
+ADDRLP4 120
+ADDRLP4 124
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $260
+ADDRLP4 132
+ADDRLP4 120
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20
+ADDRLP4 132
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20
+ADDRLP4 132
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20
+ADDRLP4 132
+INDIRU1
+ASGNU1
+ADDRLP4 0+20
+ADDRLP4 132
+INDIRU1
+ASGNU1
+ADDRLP4 140
+CNSTF4 1132396544
+ADDRFP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 144
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 140
+INDIRF4
+ADDRLP4 144
+INDIRF4
+LTF4 $273
+ADDRLP4 136
+ADDRLP4 140
+INDIRF4
+ADDRLP4 144
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $274
+JUMPV
+LABELV $273
+ADDRLP4 136
+ADDRLP4 140
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $274
+ADDRLP4 148
+ADDRLP4 136
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+1
+ADDRLP4 148
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20+1
+ADDRLP4 148
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+1
+ADDRLP4 148
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+1
+ADDRLP4 148
+INDIRU1
+ASGNU1
+ADDRLP4 156
+CNSTF4 1132396544
+ADDRFP4 20
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 160
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 156
+INDIRF4
+ADDRLP4 160
+INDIRF4
+LTF4 $287
+ADDRLP4 152
+ADDRLP4 156
+INDIRF4
+ADDRLP4 160
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $288
+JUMPV
+LABELV $287
+ADDRLP4 152
+ADDRLP4 156
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $288
+ADDRLP4 164
+ADDRLP4 152
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+2
+ADDRLP4 164
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20+2
+ADDRLP4 164
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+2
+ADDRLP4 164
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+2
+ADDRLP4 164
+INDIRU1
+ASGNU1
+ADDRLP4 172
+CNSTF4 1132396544
+ADDRFP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 176
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 172
+INDIRF4
+ADDRLP4 176
+INDIRF4
+LTF4 $301
+ADDRLP4 168
+ADDRLP4 172
+INDIRF4
+ADDRLP4 176
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $302
+JUMPV
+LABELV $301
+ADDRLP4 168
+ADDRLP4 172
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $302
+ADDRLP4 180
+ADDRLP4 168
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+3
+ADDRLP4 180
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20+3
+ADDRLP4 180
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+3
+ADDRLP4 180
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+3
+ADDRLP4 180
+INDIRU1
+ASGNU1
+ADDRLP4 96
+ADDRFP4 4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 96+4
+ADDRFP4 8
+INDIRF4
+ADDRFP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 184
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 184
+INDIRF4
+ADDRLP4 184
+INDIRF4
+MULF4
+ADDRLP4 96+4
+INDIRF4
+ADDRLP4 96+4
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 188
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 116
+CNSTF4 1065353216
+ADDRLP4 188
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 96
+ADDRLP4 96
+INDIRF4
+ADDRLP4 116
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 96+4
+INDIRF4
+ADDRLP4 116
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 196
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 196
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDRFP4 16
+INDIRF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 196
+INDIRF4
+ADDRLP4 96+4
+INDIRF4
+ADDRFP4 16
+INDIRF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0+24
+ADDRFP4 8
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 96
+INDIRF4
+ADDRFP4 16
+INDIRF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRFP4 12
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 96+4
+INDIRF4
+ADDRFP4 16
+INDIRF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0+48
+ADDRFP4 8
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 96
+INDIRF4
+ADDRFP4 16
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+4
+ADDRFP4 12
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 96+4
+INDIRF4
+ADDRFP4 16
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72
+ADDRFP4 0
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 96
+INDIRF4
+ADDRFP4 16
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72+4
+ADDRFP4 4
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 96+4
+INDIRF4
+ADDRFP4 16
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+24+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+72+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+72+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 104
+ARGP4
+ADDRGP4 DrawPoly
+CALLV
+pop
+LABELV $246
+endproc DrawLine 204 12
+export DrawPic2Color
+proc DrawPic2Color 233 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 32
+ADDRFP4 32
+INDIRP4
+ASGNP4
+ADDRFP4 36
+ADDRFP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 96
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 12
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 96
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 96+8
+ADDRLP4 0
+ASGNP4
+ADDRLP4 96+4
+CNSTI4 4
+ASGNI4
+ADDRLP4 96
+ADDRFP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 112
+CNSTF4 1132396544
+ADDRFP4 32
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 116
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 112
+INDIRF4
+ADDRLP4 116
+INDIRF4
+LTF4 $346
+ADDRLP4 108
+ADDRLP4 112
+INDIRF4
+ADDRLP4 116
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $347
+JUMPV
+LABELV $346
+ADDRLP4 108
+ADDRLP4 112
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $347
+ADDRLP4 120
+ADDRLP4 108
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20
+ADDRLP4 120
+INDIRU1
+ASGNU1
+ADDRLP4 0+20
+ADDRLP4 120
+INDIRU1
+ASGNU1
+ADDRLP4 128
+CNSTF4 1132396544
+ADDRFP4 36
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 132
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 132
+INDIRF4
+LTF4 $353
+ADDRLP4 124
+ADDRLP4 128
+INDIRF4
+ADDRLP4 132
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $354
+JUMPV
+LABELV $353
+ADDRLP4 124
+ADDRLP4 128
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $354
+ADDRLP4 136
+ADDRLP4 124
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+48+20
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRLP4 144
+CNSTF4 1132396544
+ADDRFP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 148
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 144
+INDIRF4
+ADDRLP4 148
+INDIRF4
+LTF4 $361
+ADDRLP4 140
+ADDRLP4 144
+INDIRF4
+ADDRLP4 148
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $362
+JUMPV
+LABELV $361
+ADDRLP4 140
+ADDRLP4 144
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $362
+ADDRLP4 152
+ADDRLP4 140
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+1
+ADDRLP4 152
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+1
+ADDRLP4 152
+INDIRU1
+ASGNU1
+ADDRLP4 160
+CNSTF4 1132396544
+ADDRFP4 36
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 164
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 160
+INDIRF4
+ADDRLP4 164
+INDIRF4
+LTF4 $370
+ADDRLP4 156
+ADDRLP4 160
+INDIRF4
+ADDRLP4 164
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $371
+JUMPV
+LABELV $370
+ADDRLP4 156
+ADDRLP4 160
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $371
+ADDRLP4 168
+ADDRLP4 156
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+48+20+1
+ADDRLP4 168
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+1
+ADDRLP4 168
+INDIRU1
+ASGNU1
+ADDRLP4 176
+CNSTF4 1132396544
+ADDRFP4 32
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 180
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 176
+INDIRF4
+ADDRLP4 180
+INDIRF4
+LTF4 $378
+ADDRLP4 172
+ADDRLP4 176
+INDIRF4
+ADDRLP4 180
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $379
+JUMPV
+LABELV $378
+ADDRLP4 172
+ADDRLP4 176
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $379
+ADDRLP4 184
+ADDRLP4 172
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+2
+ADDRLP4 184
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+2
+ADDRLP4 184
+INDIRU1
+ASGNU1
+ADDRLP4 192
+CNSTF4 1132396544
+ADDRFP4 36
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 196
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 192
+INDIRF4
+ADDRLP4 196
+INDIRF4
+LTF4 $387
+ADDRLP4 188
+ADDRLP4 192
+INDIRF4
+ADDRLP4 196
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $388
+JUMPV
+LABELV $387
+ADDRLP4 188
+ADDRLP4 192
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $388
+ADDRLP4 200
+ADDRLP4 188
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+48+20+2
+ADDRLP4 200
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+2
+ADDRLP4 200
+INDIRU1
+ASGNU1
+ADDRLP4 208
+CNSTF4 1132396544
+ADDRFP4 32
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 212
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 208
+INDIRF4
+ADDRLP4 212
+INDIRF4
+LTF4 $395
+ADDRLP4 204
+ADDRLP4 208
+INDIRF4
+ADDRLP4 212
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $396
+JUMPV
+LABELV $395
+ADDRLP4 204
+ADDRLP4 208
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $396
+ADDRLP4 216
+ADDRLP4 204
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+3
+ADDRLP4 216
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+3
+ADDRLP4 216
+INDIRU1
+ASGNU1
+ADDRLP4 224
+CNSTF4 1132396544
+ADDRFP4 36
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 228
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 224
+INDIRF4
+ADDRLP4 228
+INDIRF4
+LTF4 $404
+ADDRLP4 220
+ADDRLP4 224
+INDIRF4
+ADDRLP4 228
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $405
+JUMPV
+LABELV $404
+ADDRLP4 220
+ADDRLP4 224
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $405
+ADDRLP4 232
+ADDRLP4 220
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+48+20+3
+ADDRLP4 232
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+3
+ADDRLP4 232
+INDIRU1
+ASGNU1
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0+24
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0+48
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0+72+4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+12+4
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0+24+12
+ADDRFP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+24+12+4
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0+48+12
+ADDRFP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+48+12+4
+ADDRFP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0+72+12
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+72+12+4
+ADDRFP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 96
+ARGP4
+ADDRGP4 DrawPoly
+CALLV
+pop
+LABELV $339
+endproc DrawPic2Color 233 12
+export FillRect2Color
+proc FillRect2Color 233 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 96
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 12
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 96
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 96+8
+ADDRLP4 0
+ASGNP4
+ADDRLP4 96+4
+CNSTI4 4
+ASGNI4
+ADDRLP4 96
+ADDRGP4 cgs+160652+8
+INDIRI4
+ASGNI4
+ADDRLP4 112
+CNSTF4 1132396544
+ADDRFP4 16
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 116
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 112
+INDIRF4
+ADDRLP4 116
+INDIRF4
+LTF4 $443
+ADDRLP4 108
+ADDRLP4 112
+INDIRF4
+ADDRLP4 116
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $444
+JUMPV
+LABELV $443
+ADDRLP4 108
+ADDRLP4 112
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $444
+ADDRLP4 120
+ADDRLP4 108
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20
+ADDRLP4 120
+INDIRU1
+ASGNU1
+ADDRLP4 0+20
+ADDRLP4 120
+INDIRU1
+ASGNU1
+ADDRLP4 128
+CNSTF4 1132396544
+ADDRFP4 20
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 132
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 132
+INDIRF4
+LTF4 $450
+ADDRLP4 124
+ADDRLP4 128
+INDIRF4
+ADDRLP4 132
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $451
+JUMPV
+LABELV $450
+ADDRLP4 124
+ADDRLP4 128
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $451
+ADDRLP4 136
+ADDRLP4 124
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+48+20
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRLP4 144
+CNSTF4 1132396544
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 148
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 144
+INDIRF4
+ADDRLP4 148
+INDIRF4
+LTF4 $458
+ADDRLP4 140
+ADDRLP4 144
+INDIRF4
+ADDRLP4 148
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $459
+JUMPV
+LABELV $458
+ADDRLP4 140
+ADDRLP4 144
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $459
+ADDRLP4 152
+ADDRLP4 140
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+1
+ADDRLP4 152
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+1
+ADDRLP4 152
+INDIRU1
+ASGNU1
+ADDRLP4 160
+CNSTF4 1132396544
+ADDRFP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 164
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 160
+INDIRF4
+ADDRLP4 164
+INDIRF4
+LTF4 $467
+ADDRLP4 156
+ADDRLP4 160
+INDIRF4
+ADDRLP4 164
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $468
+JUMPV
+LABELV $467
+ADDRLP4 156
+ADDRLP4 160
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $468
+ADDRLP4 168
+ADDRLP4 156
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+48+20+1
+ADDRLP4 168
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+1
+ADDRLP4 168
+INDIRU1
+ASGNU1
+ADDRLP4 176
+CNSTF4 1132396544
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 180
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 176
+INDIRF4
+ADDRLP4 180
+INDIRF4
+LTF4 $475
+ADDRLP4 172
+ADDRLP4 176
+INDIRF4
+ADDRLP4 180
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $476
+JUMPV
+LABELV $475
+ADDRLP4 172
+ADDRLP4 176
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $476
+ADDRLP4 184
+ADDRLP4 172
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+2
+ADDRLP4 184
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+2
+ADDRLP4 184
+INDIRU1
+ASGNU1
+ADDRLP4 192
+CNSTF4 1132396544
+ADDRFP4 20
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 196
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 192
+INDIRF4
+ADDRLP4 196
+INDIRF4
+LTF4 $484
+ADDRLP4 188
+ADDRLP4 192
+INDIRF4
+ADDRLP4 196
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $485
+JUMPV
+LABELV $484
+ADDRLP4 188
+ADDRLP4 192
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $485
+ADDRLP4 200
+ADDRLP4 188
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+48+20+2
+ADDRLP4 200
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+2
+ADDRLP4 200
+INDIRU1
+ASGNU1
+ADDRLP4 208
+CNSTF4 1132396544
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 212
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 208
+INDIRF4
+ADDRLP4 212
+INDIRF4
+LTF4 $492
+ADDRLP4 204
+ADDRLP4 208
+INDIRF4
+ADDRLP4 212
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $493
+JUMPV
+LABELV $492
+ADDRLP4 204
+ADDRLP4 208
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $493
+ADDRLP4 216
+ADDRLP4 204
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+3
+ADDRLP4 216
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+3
+ADDRLP4 216
+INDIRU1
+ASGNU1
+ADDRLP4 224
+CNSTF4 1132396544
+ADDRFP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 228
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 224
+INDIRF4
+ADDRLP4 228
+INDIRF4
+LTF4 $501
+ADDRLP4 220
+ADDRLP4 224
+INDIRF4
+ADDRLP4 228
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $502
+JUMPV
+LABELV $501
+ADDRLP4 220
+ADDRLP4 224
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $502
+ADDRLP4 232
+ADDRLP4 220
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+48+20+3
+ADDRLP4 232
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+3
+ADDRLP4 232
+INDIRU1
+ASGNU1
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0+24
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0+48
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0+72+4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+24+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+72+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+72+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96
+ARGP4
+ADDRGP4 DrawPoly
+CALLV
+pop
+LABELV $434
+endproc FillRect2Color 233 12
+export FillTriangle
+proc FillTriangle 157 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 20
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 24
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 72
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 12
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 72
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 72+8
+ADDRLP4 0
+ASGNP4
+ADDRLP4 72+4
+CNSTI4 3
+ASGNI4
+ADDRLP4 72
+ADDRGP4 cgs+160652+8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRF4
+ADDRFP4 0
+INDIRF4
+SUBF4
+ADDRFP4 20
+INDIRF4
+ADDRFP4 4
+INDIRF4
+SUBF4
+MULF4
+ADDRFP4 12
+INDIRF4
+ADDRFP4 4
+INDIRF4
+SUBF4
+ADDRFP4 16
+INDIRF4
+ADDRFP4 0
+INDIRF4
+SUBF4
+MULF4
+SUBF4
+CNSTF4 0
+GEF4 $536
+ADDRLP4 84
+ADDRFP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRLP4 84
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 84
+ADDRFP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 20
+ADDRLP4 84
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $536
+ADDRLP4 100
+CNSTF4 1132396544
+ADDRFP4 24
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 104
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 100
+INDIRF4
+ADDRLP4 104
+INDIRF4
+LTF4 $544
+ADDRLP4 96
+ADDRLP4 100
+INDIRF4
+ADDRLP4 104
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $545
+JUMPV
+LABELV $544
+ADDRLP4 96
+ADDRLP4 100
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $545
+ADDRLP4 108
+ADDRLP4 96
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+48+20
+ADDRLP4 108
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20
+ADDRLP4 108
+INDIRU1
+ASGNU1
+ADDRLP4 0+20
+ADDRLP4 108
+INDIRU1
+ASGNU1
+ADDRLP4 116
+CNSTF4 1132396544
+ADDRFP4 24
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 120
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 116
+INDIRF4
+ADDRLP4 120
+INDIRF4
+LTF4 $555
+ADDRLP4 112
+ADDRLP4 116
+INDIRF4
+ADDRLP4 120
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $556
+JUMPV
+LABELV $555
+ADDRLP4 112
+ADDRLP4 116
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $556
+ADDRLP4 124
+ADDRLP4 112
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+48+20+1
+ADDRLP4 124
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+1
+ADDRLP4 124
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+1
+ADDRLP4 124
+INDIRU1
+ASGNU1
+ADDRLP4 132
+CNSTF4 1132396544
+ADDRFP4 24
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 136
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 132
+INDIRF4
+ADDRLP4 136
+INDIRF4
+LTF4 $566
+ADDRLP4 128
+ADDRLP4 132
+INDIRF4
+ADDRLP4 136
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $567
+JUMPV
+LABELV $566
+ADDRLP4 128
+ADDRLP4 132
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $567
+ADDRLP4 140
+ADDRLP4 128
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+48+20+2
+ADDRLP4 140
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+2
+ADDRLP4 140
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+2
+ADDRLP4 140
+INDIRU1
+ASGNU1
+ADDRLP4 148
+CNSTF4 1132396544
+ADDRFP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 152
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 148
+INDIRF4
+ADDRLP4 152
+INDIRF4
+LTF4 $577
+ADDRLP4 144
+ADDRLP4 148
+INDIRF4
+ADDRLP4 152
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $578
+JUMPV
+LABELV $577
+ADDRLP4 144
+ADDRLP4 148
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $578
+ADDRLP4 156
+ADDRLP4 144
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+48+20+3
+ADDRLP4 156
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+3
+ADDRLP4 156
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+3
+ADDRLP4 156
+INDIRU1
+ASGNU1
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0+24
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0+48
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+48+4
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+24+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+ARGP4
+ADDRGP4 DrawPoly
+CALLV
+pop
+LABELV $531
+endproc FillTriangle 157 12
+export DrawTriangle
+proc DrawTriangle 0 24
+ADDRFP4 24
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRGP4 DrawLine
+CALLV
+pop
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRGP4 DrawLine
+CALLV
+pop
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRGP4 DrawLine
+CALLV
+pop
+LABELV $599
+endproc DrawTriangle 0 24
+export Draw4VertsPic
+proc Draw4VertsPic 169 12
+ADDRFP4 36
+ADDRFP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 96
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 12
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 96
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 96+8
+ADDRLP4 0
+ASGNP4
+ADDRLP4 96+4
+CNSTI4 4
+ASGNI4
+ADDRLP4 96
+ADDRFP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 112
+CNSTF4 1132396544
+ADDRFP4 36
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 116
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 112
+INDIRF4
+ADDRLP4 116
+INDIRF4
+LTF4 $611
+ADDRLP4 108
+ADDRLP4 112
+INDIRF4
+ADDRLP4 116
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $612
+JUMPV
+LABELV $611
+ADDRLP4 108
+ADDRLP4 112
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $612
+ADDRLP4 120
+ADDRLP4 108
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20
+ADDRLP4 120
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20
+ADDRLP4 120
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20
+ADDRLP4 120
+INDIRU1
+ASGNU1
+ADDRLP4 0+20
+ADDRLP4 120
+INDIRU1
+ASGNU1
+ADDRLP4 128
+CNSTF4 1132396544
+ADDRFP4 36
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 132
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 132
+INDIRF4
+LTF4 $625
+ADDRLP4 124
+ADDRLP4 128
+INDIRF4
+ADDRLP4 132
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $626
+JUMPV
+LABELV $625
+ADDRLP4 124
+ADDRLP4 128
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $626
+ADDRLP4 136
+ADDRLP4 124
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+1
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20+1
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+1
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+1
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRLP4 144
+CNSTF4 1132396544
+ADDRFP4 36
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 148
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 144
+INDIRF4
+ADDRLP4 148
+INDIRF4
+LTF4 $639
+ADDRLP4 140
+ADDRLP4 144
+INDIRF4
+ADDRLP4 148
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $640
+JUMPV
+LABELV $639
+ADDRLP4 140
+ADDRLP4 144
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $640
+ADDRLP4 152
+ADDRLP4 140
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+2
+ADDRLP4 152
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20+2
+ADDRLP4 152
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+2
+ADDRLP4 152
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+2
+ADDRLP4 152
+INDIRU1
+ASGNU1
+ADDRLP4 160
+CNSTF4 1132396544
+ADDRFP4 36
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 164
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 160
+INDIRF4
+ADDRLP4 164
+INDIRF4
+LTF4 $653
+ADDRLP4 156
+ADDRLP4 160
+INDIRF4
+ADDRLP4 164
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $654
+JUMPV
+LABELV $653
+ADDRLP4 156
+ADDRLP4 160
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $654
+ADDRLP4 168
+ADDRLP4 156
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+3
+ADDRLP4 168
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20+3
+ADDRLP4 168
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+3
+ADDRLP4 168
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+3
+ADDRLP4 168
+INDIRU1
+ASGNU1
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0+24
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0+48
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+48+4
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0+72
+ADDRFP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+72+4
+ADDRFP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+24+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+72+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 96
+ARGP4
+ADDRGP4 DrawPoly
+CALLV
+pop
+LABELV $600
+endproc Draw4VertsPic 169 12
+export AddCharToScene
+proc AddCharToScene 188 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 32
+NEI4 $684
+ADDRGP4 $683
+JUMPV
+LABELV $684
+ADDRLP4 96
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 12
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 96
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 96+8
+ADDRLP4 0
+ASGNP4
+ADDRLP4 96+4
+CNSTI4 4
+ASGNI4
+ADDRLP4 96
+ADDRGP4 cgs+160652
+INDIRI4
+ASGNI4
+ADDRLP4 120
+CNSTF4 1132396544
+ADDRFP4 12
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 124
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 120
+INDIRF4
+ADDRLP4 124
+INDIRF4
+LTF4 $697
+ADDRLP4 116
+ADDRLP4 120
+INDIRF4
+ADDRLP4 124
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $698
+JUMPV
+LABELV $697
+ADDRLP4 116
+ADDRLP4 120
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $698
+ADDRLP4 128
+ADDRLP4 116
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20
+ADDRLP4 128
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20
+ADDRLP4 128
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20
+ADDRLP4 128
+INDIRU1
+ASGNU1
+ADDRLP4 0+20
+ADDRLP4 128
+INDIRU1
+ASGNU1
+ADDRLP4 136
+CNSTF4 1132396544
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 136
+INDIRF4
+ADDRLP4 140
+INDIRF4
+LTF4 $711
+ADDRLP4 132
+ADDRLP4 136
+INDIRF4
+ADDRLP4 140
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $712
+JUMPV
+LABELV $711
+ADDRLP4 132
+ADDRLP4 136
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $712
+ADDRLP4 144
+ADDRLP4 132
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+1
+ADDRLP4 144
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20+1
+ADDRLP4 144
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+1
+ADDRLP4 144
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+1
+ADDRLP4 144
+INDIRU1
+ASGNU1
+ADDRLP4 152
+CNSTF4 1132396544
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 156
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 152
+INDIRF4
+ADDRLP4 156
+INDIRF4
+LTF4 $725
+ADDRLP4 148
+ADDRLP4 152
+INDIRF4
+ADDRLP4 156
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $726
+JUMPV
+LABELV $725
+ADDRLP4 148
+ADDRLP4 152
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $726
+ADDRLP4 160
+ADDRLP4 148
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+2
+ADDRLP4 160
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20+2
+ADDRLP4 160
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+2
+ADDRLP4 160
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+2
+ADDRLP4 160
+INDIRU1
+ASGNU1
+ADDRLP4 168
+CNSTF4 1132396544
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 172
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 168
+INDIRF4
+ADDRLP4 172
+INDIRF4
+LTF4 $739
+ADDRLP4 164
+ADDRLP4 168
+INDIRF4
+ADDRLP4 172
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $740
+JUMPV
+LABELV $739
+ADDRLP4 164
+ADDRLP4 168
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $740
+ADDRLP4 176
+ADDRLP4 164
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+3
+ADDRLP4 176
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20+3
+ADDRLP4 176
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+3
+ADDRLP4 176
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+3
+ADDRLP4 176
+INDIRU1
+ASGNU1
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0+24
+ADDRFP4 0
+INDIRF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48
+ADDRFP4 0
+INDIRF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDF4
+ADDRFP4 20
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 180
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+48+4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 180
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ADDRFP4 20
+INDIRP4
+ADDRLP4 180
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72
+ADDRFP4 0
+INDIRF4
+ADDRFP4 20
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72+4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 108
+ADDRFP4 8
+INDIRI4
+CNSTI4 4
+RSHI4
+ASGNI4
+ADDRLP4 112
+ADDRFP4 8
+INDIRI4
+CNSTI4 15
+BANDI4
+ASGNI4
+ADDRLP4 0+12
+CNSTF4 1031798784
+ADDRLP4 112
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 0+12+4
+CNSTF4 1031798784
+ADDRLP4 108
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 0+24+12
+CNSTF4 1031798784
+ADDRLP4 112
+INDIRI4
+CNSTI4 1
+ADDI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 0+24+12+4
+CNSTF4 1031798784
+ADDRLP4 108
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 0+48+12
+CNSTF4 1031798784
+ADDRLP4 112
+INDIRI4
+CNSTI4 1
+ADDI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 0+48+12+4
+CNSTF4 1031798784
+ADDRLP4 108
+INDIRI4
+CNSTI4 1
+ADDI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 0+72+12
+CNSTF4 1031798784
+ADDRLP4 112
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 0+72+12+4
+CNSTF4 1031798784
+ADDRLP4 108
+INDIRI4
+CNSTI4 1
+ADDI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRLP4 96+4
+INDIRI4
+ARGI4
+ADDRLP4 96+8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+LABELV $683
+endproc AddCharToScene 188 12
+export colorAndPosinc
+proc colorAndPosinc 16 12
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_IsColorString
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $772
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $774
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+ARGP4
+CNSTU4 12
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $774
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $772
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $771
+endproc colorAndPosinc 16 12
+export DrawTurnableStringFC
+proc DrawTurnableStringFC 80 24
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 20
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 28
+ADDRFP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 initrefdef
+INDIRI4
+CNSTI4 0
+NEI4 $777
+ADDRGP4 Initrefdef2D
+CALLV
+pop
+LABELV $777
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 40
+ADDRLP4 44
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 trap_R_ClearScene
+CALLV
+pop
+ADDRFP4 20
+CNSTF4 1016003125
+ADDRFP4 20
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 1056964608
+ADDRLP4 48
+INDIRF4
+ADDRFP4 16
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 1056964608
+ADDRLP4 52
+INDIRF4
+NEGF4
+ADDRFP4 16
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRLP4 56
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 56
+INDIRF4
+ADDRFP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 60
+INDIRF4
+ADDRFP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 64
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 1
+EQI4 $783
+ADDRLP4 64
+INDIRI4
+CNSTI4 2
+EQI4 $791
+ADDRLP4 64
+INDIRI4
+CNSTI4 3
+EQI4 $800
+ADDRGP4 $781
+JUMPV
+LABELV $781
+LABELV $783
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $787
+JUMPV
+LABELV $784
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 colorAndPosinc
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $788
+ADDRLP4 72
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 AddCharToScene
+CALLV
+pop
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $788
+LABELV $785
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $787
+ADDRLP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+LTI4 $784
+ADDRGP4 $782
+JUMPV
+LABELV $791
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $795
+JUMPV
+LABELV $792
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 colorAndPosinc
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $796
+ADDRLP4 72
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 76
+CNSTF4 1056964608
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+SUBF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 AddCharToScene
+CALLV
+pop
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $796
+LABELV $793
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $795
+ADDRLP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+LTI4 $792
+ADDRGP4 $782
+JUMPV
+LABELV $800
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $804
+JUMPV
+LABELV $801
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 colorAndPosinc
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $805
+ADDRLP4 72
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 76
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+SUBF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 AddCharToScene
+CALLV
+pop
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $805
+LABELV $802
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $804
+ADDRLP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+LTI4 $801
+LABELV $782
+ADDRGP4 refdef2D
+ARGP4
+ADDRGP4 trap_R_RenderScene
+CALLV
+pop
+LABELV $776
+endproc DrawTurnableStringFC 80 24
+export DrawTurnableString
+proc DrawTurnableString 0 32
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 24
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 DrawTurnableStringFC
+CALLV
+pop
+LABELV $809
+endproc DrawTurnableString 0 32
+proc DrawCharWithCutFrame 112 36
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 20
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 24
+ADDRFP4 24
+INDIRF4
+ASGNF4
+ADDRFP4 28
+ADDRFP4 28
+INDIRF4
+ASGNF4
+ADDRFP4 32
+ADDRFP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 40
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ADDRFP4 28
+INDIRF4
+GTF4 $815
+ADDRLP4 44
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 44
+INDIRF4
+ADDRFP4 32
+INDIRF4
+GTF4 $815
+ADDRLP4 40
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ADDRFP4 20
+INDIRF4
+LTF4 $815
+ADDRLP4 44
+INDIRF4
+ADDRFP4 16
+INDIRF4
+ADDF4
+ADDRFP4 24
+INDIRF4
+GEF4 $811
+LABELV $815
+ADDRGP4 $810
+JUMPV
+LABELV $811
+ADDRFP4 20
+INDIRF4
+ADDRFP4 0
+INDIRF4
+LEF4 $817
+ADDRLP4 48
+ADDRFP4 20
+INDIRF4
+ADDRFP4 0
+INDIRF4
+SUBF4
+ADDRFP4 12
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 $818
+JUMPV
+LABELV $817
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+LABELV $818
+ADDRLP4 0
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRFP4 28
+INDIRF4
+ADDRFP4 0
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+GEF4 $820
+ADDRLP4 64
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 52
+ADDRFP4 0
+INDIRF4
+ADDRLP4 64
+INDIRF4
+ADDF4
+ADDRFP4 28
+INDIRF4
+SUBF4
+ADDRLP4 64
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 $821
+JUMPV
+LABELV $820
+ADDRLP4 52
+CNSTF4 0
+ASGNF4
+LABELV $821
+ADDRLP4 8
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRFP4 24
+INDIRF4
+ADDRFP4 4
+INDIRF4
+LEF4 $823
+ADDRLP4 56
+ADDRFP4 24
+INDIRF4
+ADDRFP4 4
+INDIRF4
+SUBF4
+ADDRFP4 16
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 $824
+JUMPV
+LABELV $823
+ADDRLP4 56
+CNSTF4 0
+ASGNF4
+LABELV $824
+ADDRLP4 4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRFP4 32
+INDIRF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 16
+INDIRF4
+ADDF4
+GEF4 $826
+ADDRLP4 68
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 60
+ADDRFP4 4
+INDIRF4
+ADDRLP4 68
+INDIRF4
+ADDF4
+ADDRFP4 32
+INDIRF4
+SUBF4
+ADDRLP4 68
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 $827
+JUMPV
+LABELV $826
+ADDRLP4 60
+CNSTF4 0
+ASGNF4
+LABELV $827
+ADDRLP4 12
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 72
+ADDRFP4 8
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+ADDRLP4 72
+INDIRI4
+CNSTI4 4
+RSHI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 72
+INDIRI4
+CNSTI4 15
+BANDI4
+ASGNI4
+ADDRLP4 76
+CNSTF4 1031798784
+ASGNF4
+ADDRLP4 24
+ADDRLP4 76
+INDIRF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 76
+INDIRF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 88
+CNSTI4 1
+ASGNI4
+ADDRLP4 32
+ADDRLP4 76
+INDIRF4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 88
+INDIRI4
+ADDI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 76
+INDIRF4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 88
+INDIRI4
+ADDI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 24
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 32
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRFP4 16
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 96
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 96
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 104
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 104
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 108
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+MULF4
+ARGF4
+ADDRLP4 104
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+MULF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRGP4 cgs+160652
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $810
+endproc DrawCharWithCutFrame 112 36
+export DrawStringWithCutFrameFC
+proc DrawStringWithCutFrameFC 36 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 20
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 24
+ADDRFP4 24
+INDIRF4
+ASGNF4
+ADDRFP4 28
+ADDRFP4 28
+INDIRF4
+ASGNF4
+ADDRFP4 32
+ADDRFP4 32
+INDIRF4
+ASGNF4
+ADDRFP4 36
+ADDRFP4 36
+INDIRF4
+ASGNF4
+ADDRFP4 40
+ADDRFP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $830
+ADDRGP4 $829
+JUMPV
+LABELV $830
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 28
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $835
+JUMPV
+LABELV $832
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_IsColorString
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $836
+ADDRFP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $838
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 12+12
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $838
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $833
+JUMPV
+LABELV $836
+ADDRFP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 24
+INDIRF4
+ARGF4
+ADDRFP4 28
+INDIRF4
+ARGF4
+ADDRFP4 32
+INDIRF4
+ARGF4
+ADDRFP4 36
+INDIRF4
+ARGF4
+ADDRGP4 DrawCharWithCutFrame
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRFP4 16
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $833
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $835
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $832
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $829
+endproc DrawStringWithCutFrameFC 36 36
+export DrawStringWithCutFrame
+proc DrawStringWithCutFrame 0 44
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 24
+INDIRF4
+ARGF4
+ADDRFP4 28
+INDIRF4
+ARGF4
+ADDRFP4 32
+INDIRF4
+ARGF4
+ADDRFP4 36
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 DrawStringWithCutFrameFC
+CALLV
+pop
+LABELV $841
+endproc DrawStringWithCutFrame 0 44
+bss
+export refdef2D
+align 4
+LABELV refdef2D
+skip 368
+import CG_AddBoundingBox
+import CG_AddBoundingBoxEntity
+import CG_QueryCvar
+import CG_Timestamp
+import CG_LimitCvars
+import trap_RealTime
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import trap_R_inPVS
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntitiesToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_Cutscene2d_Draw
+import CG_Cutscene2d_UpdateTrans
+import CG_Cutscene2d_CheckCmd
+import Main_SpriteParticles
+import LaunchRevivalParticle
+import LaunchSpeedyPuffTrail
+import Init_SpriteParticles
+import AddLFsToScreen
+import AddLFToDrawList
+import Init_LensFlareSys
+import DumpPolyInfo
+import ActiveChooseLogoMenu
+import FindLogoForSpraying
+import Add_LogoToDrawList
+import AddLogosToScene
+import Init_SprayLogoSys
+import Calculate_2DOfDIR
+import Calculate_2DOf3D
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_ChangeLoadingProgress
+import CG_LoadingString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_ScorePlum
+import CG_TeleOutEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_GenerateParticles
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_PortalInView
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_GetWaterMuzzle
+import CG_SprayTrail
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponSRWC
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_Boomies_Explosion
+import CG_BamBam_Explosion
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_LerpTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayer
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_UpdateVoipTeamIDs
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Draw3DModel
+import CG_SetPrintString
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import CG_MessagePrint
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_WorldToScreen
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_DrawPic1024
+import CG_DrawRect1024
+import CG_FillRect1024
+import CG_AdjustFrom1024
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddPolyBatched
+import CG_AddRefEntityBatched
+import CG_FlushSceneBatches
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_ForceModelChange
+import CG_GetCvarFloat
+import CG_GetCvarInt
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StreamAssets
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_icons
+import cg_ambient
+import cg_drawBBox
+import cg_drawVoiceNames
+import cg_drawLensflare
+import cg_timestamps
+import cg_skyLensflare
+import cg_sky
+import cg_curWarmupReady
+import cg_warmupReady
+import cg_glowModelTeam
+import cg_glowModel
+import cg_cineDrawLetterBox
+import cg_cineHideHud
+import cg_LPSwallhackAlpha
+import cg_LPSwallhackSize
+import cg_bigScoreType
+import cg_thirdPersonAutoSwitch
+import cg_drawTimeLeft
+import cg_drawServerInfos
+import cg_drawMessages
+import cg_drawups
+import cg_wopFFAhud
+import cg_printDir
+import cg_drawRealTime
+import cg_correctedWeaponPos
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_streamAssets
+import cg_deferPlayers
+import cg_predictItems
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_chatBeep
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_optimizePrediction
+import cg_nopredict
+import cg_errorDecay
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import trailEnt
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
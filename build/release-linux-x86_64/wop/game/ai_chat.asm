@@ -0,0 +1,8168 @@
+code
+proc BotNumActivePlayers 1056 12
+ADDRLP4 1032
+CNSTI4 0
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+ADDRLP4 1024
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+ADDRGP4 $69
+JUMPV
+LABELV $66
+ADDRLP4 1024
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1036
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1036
+INDIRU4
+CNSTU4 0
+EQU4 $74
+ADDRLP4 0
+ARGP4
+ADDRGP4 $73
+ARGP4
+ADDRLP4 1040
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1044
+INDIRU4
+CNSTU4 0
+NEU4 $71
+LABELV $74
+ADDRGP4 $67
+JUMPV
+LABELV $71
+ADDRLP4 0
+ARGP4
+ADDRGP4 $77
+ARGP4
+ADDRLP4 1048
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRLP4 1052
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 3
+NEI4 $75
+ADDRGP4 $67
+JUMPV
+LABELV $75
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $67
+ADDRLP4 1024
+ADDRLP4 1024
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $69
+ADDRLP4 1024
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $66
+ADDRLP4 1028
+INDIRI4
+RETI4
+LABELV $65
+endproc BotNumActivePlayers 1056 12
+proc BotIsFirstInRankings 1524 12
+ADDRLP4 1496
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1024
+CNSTI4 0
+ASGNI4
+ADDRGP4 $82
+JUMPV
+LABELV $79
+ADDRLP4 1024
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1500
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1500
+INDIRU4
+CNSTU4 0
+EQU4 $86
+ADDRLP4 0
+ARGP4
+ADDRGP4 $73
+ARGP4
+ADDRLP4 1504
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1504
+INDIRP4
+ARGP4
+ADDRLP4 1508
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1508
+INDIRU4
+CNSTU4 0
+NEU4 $84
+LABELV $86
+ADDRGP4 $80
+JUMPV
+LABELV $84
+ADDRLP4 0
+ARGP4
+ADDRGP4 $77
+ARGP4
+ADDRLP4 1512
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1512
+INDIRP4
+ARGP4
+ADDRLP4 1516
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1516
+INDIRI4
+CNSTI4 3
+NEI4 $87
+ADDRGP4 $80
+JUMPV
+LABELV $87
+ADDRLP4 1024
+INDIRI4
+ARGI4
+ADDRLP4 1028
+ARGP4
+ADDRLP4 1520
+ADDRGP4 BotAI_GetClientState
+CALLI4
+ASGNI4
+ADDRLP4 1520
+INDIRI4
+CNSTI4 0
+EQI4 $89
+ADDRLP4 1496
+INDIRI4
+ADDRLP4 1028+248
+INDIRI4
+GEI4 $89
+CNSTI4 0
+RETI4
+ADDRGP4 $78
+JUMPV
+LABELV $89
+LABELV $80
+ADDRLP4 1024
+ADDRLP4 1024
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $82
+ADDRLP4 1024
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $79
+CNSTI4 1
+RETI4
+LABELV $78
+endproc BotIsFirstInRankings 1524 12
+proc BotIsLastInRankings 1524 12
+ADDRLP4 1496
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1024
+CNSTI4 0
+ASGNI4
+ADDRGP4 $96
+JUMPV
+LABELV $93
+ADDRLP4 1024
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1500
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1500
+INDIRU4
+CNSTU4 0
+EQU4 $100
+ADDRLP4 0
+ARGP4
+ADDRGP4 $73
+ARGP4
+ADDRLP4 1504
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1504
+INDIRP4
+ARGP4
+ADDRLP4 1508
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1508
+INDIRU4
+CNSTU4 0
+NEU4 $98
+LABELV $100
+ADDRGP4 $94
+JUMPV
+LABELV $98
+ADDRLP4 0
+ARGP4
+ADDRGP4 $77
+ARGP4
+ADDRLP4 1512
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1512
+INDIRP4
+ARGP4
+ADDRLP4 1516
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1516
+INDIRI4
+CNSTI4 3
+NEI4 $101
+ADDRGP4 $94
+JUMPV
+LABELV $101
+ADDRLP4 1024
+INDIRI4
+ARGI4
+ADDRLP4 1028
+ARGP4
+ADDRLP4 1520
+ADDRGP4 BotAI_GetClientState
+CALLI4
+ASGNI4
+ADDRLP4 1520
+INDIRI4
+CNSTI4 0
+EQI4 $103
+ADDRLP4 1496
+INDIRI4
+ADDRLP4 1028+248
+INDIRI4
+LEI4 $103
+CNSTI4 0
+RETI4
+ADDRGP4 $92
+JUMPV
+LABELV $103
+LABELV $94
+ADDRLP4 1024
+ADDRLP4 1024
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $96
+ADDRLP4 1024
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $93
+CNSTI4 1
+RETI4
+LABELV $92
+endproc BotIsLastInRankings 1524 12
+bss
+align 1
+LABELV $107
+skip 32
+code
+proc BotFirstClientInRankings 1532 12
+ADDRLP4 1496
+CNSTI4 -999999
+ASGNI4
+ADDRLP4 1504
+CNSTI4 0
+ASGNI4
+ADDRLP4 1500
+ADDRLP4 1504
+INDIRI4
+ASGNI4
+ADDRLP4 1024
+ADDRLP4 1504
+INDIRI4
+ASGNI4
+ADDRGP4 $111
+JUMPV
+LABELV $108
+ADDRLP4 1024
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1508
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1508
+INDIRU4
+CNSTU4 0
+EQU4 $115
+ADDRLP4 0
+ARGP4
+ADDRGP4 $73
+ARGP4
+ADDRLP4 1512
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1512
+INDIRP4
+ARGP4
+ADDRLP4 1516
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1516
+INDIRU4
+CNSTU4 0
+NEU4 $113
+LABELV $115
+ADDRGP4 $109
+JUMPV
+LABELV $113
+ADDRLP4 0
+ARGP4
+ADDRGP4 $77
+ARGP4
+ADDRLP4 1520
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1520
+INDIRP4
+ARGP4
+ADDRLP4 1524
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1524
+INDIRI4
+CNSTI4 3
+NEI4 $116
+ADDRGP4 $109
+JUMPV
+LABELV $116
+ADDRLP4 1024
+INDIRI4
+ARGI4
+ADDRLP4 1028
+ARGP4
+ADDRLP4 1528
+ADDRGP4 BotAI_GetClientState
+CALLI4
+ASGNI4
+ADDRLP4 1528
+INDIRI4
+CNSTI4 0
+EQI4 $118
+ADDRLP4 1028+248
+INDIRI4
+ADDRLP4 1496
+INDIRI4
+LEI4 $118
+ADDRLP4 1496
+ADDRLP4 1028+248
+INDIRI4
+ASGNI4
+ADDRLP4 1500
+ADDRLP4 1024
+INDIRI4
+ASGNI4
+LABELV $118
+LABELV $109
+ADDRLP4 1024
+ADDRLP4 1024
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $111
+ADDRLP4 1024
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $108
+ADDRLP4 1500
+INDIRI4
+ARGI4
+ADDRGP4 $107
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRGP4 $107
+RETP4
+LABELV $106
+endproc BotFirstClientInRankings 1532 12
+bss
+align 1
+LABELV $123
+skip 32
+code
+proc BotLastClientInRankings 1532 12
+ADDRLP4 1496
+CNSTI4 999999
+ASGNI4
+ADDRLP4 1504
+CNSTI4 0
+ASGNI4
+ADDRLP4 1500
+ADDRLP4 1504
+INDIRI4
+ASGNI4
+ADDRLP4 1024
+ADDRLP4 1504
+INDIRI4
+ASGNI4
+ADDRGP4 $127
+JUMPV
+LABELV $124
+ADDRLP4 1024
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1508
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1508
+INDIRU4
+CNSTU4 0
+EQU4 $131
+ADDRLP4 0
+ARGP4
+ADDRGP4 $73
+ARGP4
+ADDRLP4 1512
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1512
+INDIRP4
+ARGP4
+ADDRLP4 1516
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1516
+INDIRU4
+CNSTU4 0
+NEU4 $129
+LABELV $131
+ADDRGP4 $125
+JUMPV
+LABELV $129
+ADDRLP4 0
+ARGP4
+ADDRGP4 $77
+ARGP4
+ADDRLP4 1520
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1520
+INDIRP4
+ARGP4
+ADDRLP4 1524
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1524
+INDIRI4
+CNSTI4 3
+NEI4 $132
+ADDRGP4 $125
+JUMPV
+LABELV $132
+ADDRLP4 1024
+INDIRI4
+ARGI4
+ADDRLP4 1028
+ARGP4
+ADDRLP4 1528
+ADDRGP4 BotAI_GetClientState
+CALLI4
+ASGNI4
+ADDRLP4 1528
+INDIRI4
+CNSTI4 0
+EQI4 $134
+ADDRLP4 1028+248
+INDIRI4
+ADDRLP4 1496
+INDIRI4
+GEI4 $134
+ADDRLP4 1496
+ADDRLP4 1028+248
+INDIRI4
+ASGNI4
+ADDRLP4 1500
+ADDRLP4 1024
+INDIRI4
+ASGNI4
+LABELV $134
+LABELV $125
+ADDRLP4 1024
+ADDRLP4 1024
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $127
+ADDRLP4 1024
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $124
+ADDRLP4 1500
+INDIRI4
+ARGI4
+ADDRGP4 $123
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRGP4 $123
+RETP4
+LABELV $122
+endproc BotLastClientInRankings 1532 12
+bss
+align 1
+LABELV $139
+skip 32
+code
+proc BotRandomOpponentName 1320 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1292
+CNSTI4 0
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1292
+INDIRI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1292
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1292
+INDIRI4
+ASGNI4
+ADDRGP4 $143
+JUMPV
+LABELV $140
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $145
+ADDRGP4 $141
+JUMPV
+LABELV $145
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1296
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1296
+INDIRU4
+CNSTU4 0
+EQU4 $149
+ADDRLP4 4
+ARGP4
+ADDRGP4 $73
+ARGP4
+ADDRLP4 1300
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1300
+INDIRP4
+ARGP4
+ADDRLP4 1304
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1304
+INDIRU4
+CNSTU4 0
+NEU4 $147
+LABELV $149
+ADDRGP4 $141
+JUMPV
+LABELV $147
+ADDRLP4 4
+ARGP4
+ADDRGP4 $77
+ARGP4
+ADDRLP4 1308
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1308
+INDIRP4
+ARGP4
+ADDRLP4 1312
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1312
+INDIRI4
+CNSTI4 3
+NEI4 $150
+ADDRGP4 $141
+JUMPV
+LABELV $150
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1316
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1316
+INDIRI4
+CNSTI4 0
+EQI4 $152
+ADDRGP4 $141
+JUMPV
+LABELV $152
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1036
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $141
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $143
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $140
+ADDRLP4 1296
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1296
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+ADDRLP4 1028
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $157
+JUMPV
+LABELV $154
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+GTI4 $158
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1036
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $139
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRGP4 $139
+RETP4
+ADDRGP4 $138
+JUMPV
+LABELV $158
+LABELV $155
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $157
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $154
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRGP4 $139
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRGP4 $139
+RETP4
+LABELV $138
+endproc BotRandomOpponentName 1320 12
+bss
+align 1
+LABELV $161
+skip 128
+code
+proc BotMapTitle 1028 12
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetServerinfo
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $162
+ARGP4
+ADDRLP4 1024
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 1024
+INDIRP4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $161
+RETP4
+LABELV $160
+endproc BotMapTitle 1028 12
+proc BotRandomWeaponName 12 0
+ADDRLP4 4
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTF4 1091462758
+ADDRLP4 4
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $164
+ADDRLP4 8
+INDIRI4
+CNSTI4 7
+GTI4 $164
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $183
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $183
+address $166
+address $168
+address $170
+address $172
+address $174
+address $176
+address $178
+address $180
+code
+LABELV $166
+ADDRGP4 $167
+RETP4
+ADDRGP4 $163
+JUMPV
+LABELV $168
+ADDRGP4 $169
+RETP4
+ADDRGP4 $163
+JUMPV
+LABELV $170
+ADDRGP4 $171
+RETP4
+ADDRGP4 $163
+JUMPV
+LABELV $172
+ADDRGP4 $173
+RETP4
+ADDRGP4 $163
+JUMPV
+LABELV $174
+ADDRGP4 $175
+RETP4
+ADDRGP4 $163
+JUMPV
+LABELV $176
+ADDRGP4 $177
+RETP4
+ADDRGP4 $163
+JUMPV
+LABELV $178
+ADDRGP4 $179
+RETP4
+ADDRGP4 $163
+JUMPV
+LABELV $180
+ADDRGP4 $181
+RETP4
+ADDRGP4 $163
+JUMPV
+LABELV $164
+ADDRGP4 $182
+RETP4
+LABELV $163
+endproc BotRandomWeaponName 12 0
+proc BotVisibleEnemies 172 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $185
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $189
+ADDRGP4 $186
+JUMPV
+LABELV $189
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $191
+ADDRGP4 $186
+JUMPV
+LABELV $191
+ADDRLP4 4
+ARGP4
+ADDRLP4 148
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $196
+ADDRLP4 4+20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $193
+LABELV $196
+ADDRGP4 $186
+JUMPV
+LABELV $193
+ADDRLP4 4
+ARGP4
+ADDRLP4 152
+ADDRGP4 EntityIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $197
+ADDRLP4 4
+ARGP4
+ADDRLP4 156
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+NEI4 $197
+ADDRGP4 $186
+JUMPV
+LABELV $197
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 160
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+EQI4 $199
+ADDRGP4 $186
+JUMPV
+LABELV $199
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 168
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 168
+INDIRF4
+ASGNF4
+ADDRLP4 144
+INDIRF4
+CNSTF4 0
+LEF4 $201
+CNSTI4 1
+RETI4
+ADDRGP4 $184
+JUMPV
+LABELV $201
+LABELV $186
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $185
+CNSTI4 0
+RETI4
+LABELV $184
+endproc BotVisibleEnemies 172 20
+proc BotValidChatPosition 168 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $204
+CNSTI4 1
+RETI4
+ADDRGP4 $203
+JUMPV
+LABELV $204
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5092
+ADDP4
+INDIRI4
+ADDRLP4 152
+INDIRI4
+NEI4 $212
+ADDRFP4 0
+INDIRP4
+CNSTI4 5096
+ADDP4
+INDIRI4
+ADDRLP4 152
+INDIRI4
+NEI4 $212
+ADDRFP4 0
+INDIRP4
+CNSTI4 5100
+ADDP4
+INDIRI4
+ADDRLP4 152
+INDIRI4
+NEI4 $212
+ADDRFP4 0
+INDIRP4
+CNSTI4 5104
+ADDP4
+INDIRI4
+ADDRLP4 152
+INDIRI4
+NEI4 $212
+ADDRFP4 0
+INDIRP4
+CNSTI4 5108
+ADDP4
+INDIRI4
+ADDRLP4 152
+INDIRI4
+NEI4 $212
+ADDRFP4 0
+INDIRP4
+CNSTI4 5112
+ADDP4
+INDIRI4
+ADDRLP4 152
+INDIRI4
+EQI4 $206
+LABELV $212
+CNSTI4 0
+RETI4
+ADDRGP4 $203
+JUMPV
+LABELV $206
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1103101952
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 156
+ADDRGP4 trap_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 24
+BANDI4
+CNSTI4 0
+EQI4 $214
+CNSTI4 0
+RETI4
+ADDRGP4 $203
+JUMPV
+LABELV $214
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 160
+ADDRGP4 trap_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $217
+CNSTI4 0
+RETI4
+ADDRGP4 $203
+JUMPV
+LABELV $217
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 164
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 24
+ADDRLP4 164
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 24+8
+INDIRF4
+CNSTF4 1092616192
+SUBF4
+ASGNF4
+CNSTI4 4
+ARGI4
+ADDRLP4 36
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 60
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 60+80
+INDIRI4
+CNSTI4 1022
+EQI4 $221
+CNSTI4 0
+RETI4
+ADDRGP4 $203
+JUMPV
+LABELV $221
+CNSTI4 1
+RETI4
+LABELV $203
+endproc BotValidChatPosition 168 28
+export BotChat_EnterGame
+proc BotChat_EnterGame 68 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $225
+CNSTI4 0
+RETI4
+ADDRGP4 $224
+JUMPV
+LABELV $225
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $228
+CNSTI4 0
+RETI4
+ADDRGP4 $224
+JUMPV
+LABELV $228
+ADDRLP4 36
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $230
+CNSTI4 0
+RETI4
+ADDRGP4 $224
+JUMPV
+LABELV $230
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $232
+CNSTI4 0
+RETI4
+ADDRGP4 $224
+JUMPV
+LABELV $232
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 27
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 40
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $234
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+ADDRLP4 32
+INDIRF4
+LEF4 $237
+CNSTI4 0
+RETI4
+ADDRGP4 $224
+JUMPV
+LABELV $237
+LABELV $234
+ADDRLP4 44
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+GTI4 $239
+CNSTI4 0
+RETI4
+ADDRGP4 $224
+JUMPV
+LABELV $239
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $241
+CNSTI4 0
+RETI4
+ADDRGP4 $224
+JUMPV
+LABELV $241
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 52
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 60
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $243
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 $244
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6044
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $224
+endproc BotChat_EnterGame 68 32
+export BotChat_ExitGame
+proc BotChat_ExitGame 64 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $246
+CNSTI4 0
+RETI4
+ADDRGP4 $245
+JUMPV
+LABELV $246
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $249
+CNSTI4 0
+RETI4
+ADDRGP4 $245
+JUMPV
+LABELV $249
+ADDRLP4 36
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $251
+CNSTI4 0
+RETI4
+ADDRGP4 $245
+JUMPV
+LABELV $251
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $253
+CNSTI4 0
+RETI4
+ADDRGP4 $245
+JUMPV
+LABELV $253
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 27
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 40
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $255
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+ADDRLP4 32
+INDIRF4
+LEF4 $258
+CNSTI4 0
+RETI4
+ADDRGP4 $245
+JUMPV
+LABELV $258
+LABELV $255
+ADDRLP4 44
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+GTI4 $260
+CNSTI4 0
+RETI4
+ADDRGP4 $245
+JUMPV
+LABELV $260
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 48
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 56
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $262
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 $244
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6044
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $245
+endproc BotChat_ExitGame 64 32
+export BotChat_StartLevel
+proc BotChat_StartLevel 56 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $264
+CNSTI4 0
+RETI4
+ADDRGP4 $263
+JUMPV
+LABELV $264
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $267
+CNSTI4 0
+RETI4
+ADDRGP4 $263
+JUMPV
+LABELV $267
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $269
+CNSTI4 0
+RETI4
+ADDRGP4 $263
+JUMPV
+LABELV $269
+ADDRLP4 40
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $271
+CNSTI4 0
+RETI4
+ADDRGP4 $263
+JUMPV
+LABELV $271
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $273
+CNSTI4 0
+RETI4
+ADDRGP4 $263
+JUMPV
+LABELV $273
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 26
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 44
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $275
+ADDRLP4 48
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+ADDRLP4 32
+INDIRF4
+LEF4 $278
+CNSTI4 0
+RETI4
+ADDRGP4 $263
+JUMPV
+LABELV $278
+LABELV $275
+ADDRLP4 48
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+GTI4 $280
+CNSTI4 0
+RETI4
+ADDRGP4 $263
+JUMPV
+LABELV $280
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 52
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $282
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6044
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $263
+endproc BotChat_StartLevel 56 16
+export BotChat_EndLevel
+proc BotChat_EndLevel 84 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $284
+CNSTI4 0
+RETI4
+ADDRGP4 $283
+JUMPV
+LABELV $284
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $287
+CNSTI4 0
+RETI4
+ADDRGP4 $283
+JUMPV
+LABELV $287
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $289
+CNSTI4 0
+RETI4
+ADDRGP4 $283
+JUMPV
+LABELV $289
+ADDRLP4 44
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $291
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 BotIsFirstInRankings
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $293
+LABELV $293
+CNSTI4 1
+RETI4
+ADDRGP4 $283
+JUMPV
+LABELV $291
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $295
+CNSTI4 0
+RETI4
+ADDRGP4 $283
+JUMPV
+LABELV $295
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 26
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 48
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $297
+ADDRLP4 52
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+ADDRLP4 36
+INDIRF4
+LEF4 $300
+CNSTI4 0
+RETI4
+ADDRGP4 $283
+JUMPV
+LABELV $300
+LABELV $297
+ADDRLP4 52
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 1
+GTI4 $302
+CNSTI4 0
+RETI4
+ADDRGP4 $283
+JUMPV
+LABELV $302
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 56
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 BotIsFirstInRankings
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $304
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 68
+ADDRGP4 BotLastClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 72
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $306
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRGP4 $244
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $305
+JUMPV
+LABELV $304
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 BotIsLastInRankings
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+EQI4 $307
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 72
+ADDRGP4 BotFirstClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 76
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $309
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRGP4 $244
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $308
+JUMPV
+LABELV $307
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 72
+ADDRGP4 BotFirstClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 76
+ADDRGP4 BotLastClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 80
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $310
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $308
+LABELV $305
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6044
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $283
+endproc BotChat_EndLevel 84 32
+export BotChat_Death
+proc BotChat_Death 112 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $312
+CNSTI4 0
+RETI4
+ADDRGP4 $311
+JUMPV
+LABELV $312
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $315
+CNSTI4 0
+RETI4
+ADDRGP4 $311
+JUMPV
+LABELV $315
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 29
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 36
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $317
+CNSTI4 0
+RETI4
+ADDRGP4 $311
+JUMPV
+LABELV $317
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $319
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+ADDRLP4 32
+INDIRF4
+LEF4 $322
+CNSTI4 0
+RETI4
+ADDRGP4 $311
+JUMPV
+LABELV $322
+LABELV $319
+ADDRLP4 40
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+GTI4 $324
+CNSTI4 0
+RETI4
+ADDRGP4 $311
+JUMPV
+LABELV $324
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+LTI4 $326
+ADDRLP4 44
+INDIRI4
+CNSTI4 64
+GEI4 $326
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRGP4 $327
+JUMPV
+LABELV $326
+ADDRLP4 0
+ARGP4
+ADDRGP4 $328
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $327
+ADDRLP4 48
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $329
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $329
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $331
+CNSTI4 0
+RETI4
+ADDRGP4 $311
+JUMPV
+LABELV $331
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $333
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6044
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $330
+JUMPV
+LABELV $329
+ADDRLP4 60
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $334
+CNSTI4 1
+RETI4
+ADDRGP4 $311
+JUMPV
+LABELV $334
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+CNSTI4 16
+NEI4 $336
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $338
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $337
+JUMPV
+LABELV $336
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+CNSTI4 17
+NEI4 $339
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $341
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $340
+JUMPV
+LABELV $339
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+CNSTI4 18
+NEI4 $342
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $344
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $343
+JUMPV
+LABELV $342
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+CNSTI4 21
+NEI4 $345
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $347
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $346
+JUMPV
+LABELV $345
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6008
+ADDP4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+NEI4 $354
+ADDRLP4 88
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 19
+EQI4 $354
+ADDRLP4 88
+INDIRI4
+CNSTI4 22
+EQI4 $354
+ADDRLP4 88
+INDIRI4
+CNSTI4 23
+EQI4 $354
+ADDRLP4 88
+INDIRI4
+CNSTI4 24
+EQI4 $354
+ADDRLP4 88
+INDIRI4
+ADDRLP4 84
+INDIRI4
+NEI4 $348
+LABELV $354
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $355
+ARGP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $349
+JUMPV
+LABELV $348
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+CNSTI4 20
+NEI4 $356
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $358
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $357
+JUMPV
+LABELV $356
+ADDRLP4 96
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 2
+EQI4 $363
+ADDRLP4 96
+INDIRI4
+CNSTI4 10
+EQI4 $363
+ADDRLP4 96
+INDIRI4
+CNSTI4 12
+EQI4 $363
+ADDRLP4 96
+INDIRI4
+CNSTI4 13
+NEI4 $359
+LABELV $363
+ADDRLP4 100
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+GEF4 $359
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $364
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $366
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $360
+JUMPV
+LABELV $364
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $367
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $369
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $360
+JUMPV
+LABELV $367
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $370
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $360
+JUMPV
+LABELV $359
+ADDRLP4 104
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 24
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 108
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 104
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+ADDRLP4 108
+INDIRF4
+GEF4 $371
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $373
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $372
+JUMPV
+LABELV $371
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $374
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $372
+LABELV $360
+LABELV $357
+LABELV $349
+LABELV $346
+LABELV $343
+LABELV $340
+LABELV $337
+ADDRFP4 0
+INDIRP4
+CNSTI4 6044
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $330
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $311
+endproc BotChat_Death 112 16
+export BotChat_Kill
+proc BotChat_Kill 80 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $376
+CNSTI4 0
+RETI4
+ADDRGP4 $375
+JUMPV
+LABELV $376
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $379
+CNSTI4 0
+RETI4
+ADDRGP4 $375
+JUMPV
+LABELV $379
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 28
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 36
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $381
+CNSTI4 0
+RETI4
+ADDRGP4 $375
+JUMPV
+LABELV $381
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $383
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+ADDRLP4 32
+INDIRF4
+LEF4 $386
+CNSTI4 0
+RETI4
+ADDRGP4 $375
+JUMPV
+LABELV $386
+LABELV $383
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $388
+CNSTI4 0
+RETI4
+ADDRGP4 $375
+JUMPV
+LABELV $388
+ADDRLP4 44
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+GTI4 $390
+CNSTI4 0
+RETI4
+ADDRGP4 $375
+JUMPV
+LABELV $390
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $392
+CNSTI4 0
+RETI4
+ADDRGP4 $375
+JUMPV
+LABELV $392
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 BotVisibleEnemies
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $394
+CNSTI4 0
+RETI4
+ADDRGP4 $375
+JUMPV
+LABELV $394
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6044
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 56
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $396
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+EQI4 $396
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $398
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6044
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $397
+JUMPV
+LABELV $396
+ADDRLP4 68
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $399
+CNSTI4 0
+RETI4
+ADDRGP4 $375
+JUMPV
+LABELV $399
+ADDRFP4 0
+INDIRP4
+CNSTI4 6004
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $401
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $403
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $402
+JUMPV
+LABELV $401
+ADDRFP4 0
+INDIRP4
+CNSTI4 6004
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $404
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $406
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $405
+JUMPV
+LABELV $404
+ADDRFP4 0
+INDIRP4
+CNSTI4 6004
+ADDP4
+INDIRI4
+CNSTI4 20
+NEI4 $407
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $409
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $408
+JUMPV
+LABELV $407
+ADDRLP4 72
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 24
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 76
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 72
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+ADDRLP4 76
+INDIRF4
+GEF4 $410
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $412
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $411
+JUMPV
+LABELV $410
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $413
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $411
+LABELV $408
+LABELV $405
+LABELV $402
+LABELV $397
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $375
+endproc BotChat_Kill 80 16
+export BotChat_EnemySuicide
+proc BotChat_EnemySuicide 56 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $415
+CNSTI4 0
+RETI4
+ADDRGP4 $414
+JUMPV
+LABELV $415
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $418
+CNSTI4 0
+RETI4
+ADDRGP4 $414
+JUMPV
+LABELV $418
+ADDRLP4 36
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+GTI4 $420
+CNSTI4 0
+RETI4
+ADDRGP4 $414
+JUMPV
+LABELV $420
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 30
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 40
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 44
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $422
+CNSTI4 0
+RETI4
+ADDRGP4 $414
+JUMPV
+LABELV $422
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $424
+CNSTI4 0
+RETI4
+ADDRGP4 $414
+JUMPV
+LABELV $424
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $426
+ADDRLP4 48
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+ADDRLP4 32
+INDIRF4
+LEF4 $429
+CNSTI4 0
+RETI4
+ADDRGP4 $414
+JUMPV
+LABELV $429
+LABELV $426
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $431
+CNSTI4 0
+RETI4
+ADDRGP4 $414
+JUMPV
+LABELV $431
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 BotVisibleEnemies
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $433
+CNSTI4 0
+RETI4
+ADDRGP4 $414
+JUMPV
+LABELV $433
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $435
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRGP4 $436
+JUMPV
+LABELV $435
+ADDRLP4 0
+ARGP4
+ADDRGP4 $437
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $436
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $438
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6044
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $414
+endproc BotChat_EnemySuicide 56 16
+export BotChat_HitTalking
+proc BotChat_HitTalking 60 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $440
+CNSTI4 0
+RETI4
+ADDRGP4 $439
+JUMPV
+LABELV $440
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $443
+CNSTI4 0
+RETI4
+ADDRGP4 $439
+JUMPV
+LABELV $443
+ADDRLP4 40
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+GTI4 $445
+CNSTI4 0
+RETI4
+ADDRGP4 $439
+JUMPV
+LABELV $445
+ADDRLP4 0
+CNSTI4 832
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 828
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $448
+CNSTI4 0
+RETI4
+ADDRGP4 $439
+JUMPV
+LABELV $448
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $450
+CNSTI4 0
+RETI4
+ADDRGP4 $439
+JUMPV
+LABELV $450
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $454
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $452
+LABELV $454
+CNSTI4 0
+RETI4
+ADDRGP4 $439
+JUMPV
+LABELV $452
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 31
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 48
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 52
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $455
+CNSTI4 0
+RETI4
+ADDRGP4 $439
+JUMPV
+LABELV $455
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $457
+CNSTI4 0
+RETI4
+ADDRGP4 $439
+JUMPV
+LABELV $457
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $459
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+ADDRLP4 36
+INDIRF4
+MULF4
+LEF4 $462
+CNSTI4 0
+RETI4
+ADDRGP4 $439
+JUMPV
+LABELV $462
+LABELV $459
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $464
+CNSTI4 0
+RETI4
+ADDRGP4 $439
+JUMPV
+LABELV $464
+CNSTI4 832
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 828
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $467
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6044
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $439
+endproc BotChat_HitTalking 60 16
+export BotChat_HitNoDeath
+proc BotChat_HitNoDeath 208 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 832
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 828
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $470
+CNSTI4 0
+RETI4
+ADDRGP4 $468
+JUMPV
+LABELV $470
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $472
+CNSTI4 0
+RETI4
+ADDRGP4 $468
+JUMPV
+LABELV $472
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $476
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $474
+LABELV $476
+CNSTI4 0
+RETI4
+ADDRGP4 $468
+JUMPV
+LABELV $474
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $477
+CNSTI4 0
+RETI4
+ADDRGP4 $468
+JUMPV
+LABELV $477
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $480
+CNSTI4 0
+RETI4
+ADDRGP4 $468
+JUMPV
+LABELV $480
+ADDRLP4 184
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 1
+GTI4 $482
+CNSTI4 0
+RETI4
+ADDRGP4 $468
+JUMPV
+LABELV $482
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 188
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 176
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 192
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+EQI4 $484
+CNSTI4 0
+RETI4
+ADDRGP4 $468
+JUMPV
+LABELV $484
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $486
+CNSTI4 0
+RETI4
+ADDRGP4 $468
+JUMPV
+LABELV $486
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $488
+ADDRLP4 196
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+ADDRLP4 176
+INDIRF4
+MULF4
+LEF4 $491
+CNSTI4 0
+RETI4
+ADDRGP4 $468
+JUMPV
+LABELV $491
+LABELV $488
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $493
+CNSTI4 0
+RETI4
+ADDRGP4 $468
+JUMPV
+LABELV $493
+ADDRLP4 36
+ARGP4
+ADDRLP4 196
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+EQI4 $495
+CNSTI4 0
+RETI4
+ADDRGP4 $468
+JUMPV
+LABELV $495
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 200
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+NEI4 $497
+CNSTI4 0
+RETI4
+ADDRGP4 $468
+JUMPV
+LABELV $497
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 204
+ADDRGP4 BotVisibleEnemies
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 0
+EQI4 $499
+CNSTI4 0
+RETI4
+ADDRGP4 $468
+JUMPV
+LABELV $499
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $501
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6044
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $468
+endproc BotChat_HitNoDeath 208 16
+export BotChat_HitNoKill
+proc BotChat_HitNoKill 200 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $503
+CNSTI4 0
+RETI4
+ADDRGP4 $502
+JUMPV
+LABELV $503
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $506
+CNSTI4 0
+RETI4
+ADDRGP4 $502
+JUMPV
+LABELV $506
+ADDRLP4 176
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 1
+GTI4 $508
+CNSTI4 0
+RETI4
+ADDRGP4 $502
+JUMPV
+LABELV $508
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 33
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 180
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 180
+INDIRF4
+ASGNF4
+ADDRLP4 184
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $510
+CNSTI4 0
+RETI4
+ADDRGP4 $502
+JUMPV
+LABELV $510
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $512
+CNSTI4 0
+RETI4
+ADDRGP4 $502
+JUMPV
+LABELV $512
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $514
+ADDRLP4 188
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+ADDRLP4 172
+INDIRF4
+MULF4
+LEF4 $517
+CNSTI4 0
+RETI4
+ADDRGP4 $502
+JUMPV
+LABELV $517
+LABELV $514
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $519
+CNSTI4 0
+RETI4
+ADDRGP4 $502
+JUMPV
+LABELV $519
+ADDRLP4 32
+ARGP4
+ADDRLP4 188
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+EQI4 $521
+CNSTI4 0
+RETI4
+ADDRGP4 $502
+JUMPV
+LABELV $521
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+NEI4 $523
+CNSTI4 0
+RETI4
+ADDRGP4 $502
+JUMPV
+LABELV $523
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 BotVisibleEnemies
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+EQI4 $525
+CNSTI4 0
+RETI4
+ADDRGP4 $502
+JUMPV
+LABELV $525
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $527
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6044
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $502
+endproc BotChat_HitNoKill 200 16
+export BotChat_Random
+proc BotChat_Random 96 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $529
+CNSTI4 0
+RETI4
+ADDRGP4 $528
+JUMPV
+LABELV $529
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $532
+CNSTI4 0
+RETI4
+ADDRGP4 $528
+JUMPV
+LABELV $532
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $534
+CNSTI4 0
+RETI4
+ADDRGP4 $528
+JUMPV
+LABELV $534
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $536
+CNSTI4 0
+RETI4
+ADDRGP4 $528
+JUMPV
+LABELV $536
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+EQI4 $541
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+EQI4 $541
+ADDRLP4 40
+INDIRI4
+CNSTI4 5
+NEI4 $538
+LABELV $541
+CNSTI4 0
+RETI4
+ADDRGP4 $528
+JUMPV
+LABELV $538
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 34
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 44
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1036831949
+ADDRFP4 0
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+MULF4
+LEF4 $542
+CNSTI4 0
+RETI4
+ADDRGP4 $528
+JUMPV
+LABELV $542
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $544
+ADDRLP4 52
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+ADDRLP4 32
+INDIRF4
+LEF4 $547
+CNSTI4 0
+RETI4
+ADDRGP4 $528
+JUMPV
+LABELV $547
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1048576000
+LEF4 $549
+CNSTI4 0
+RETI4
+ADDRGP4 $528
+JUMPV
+LABELV $549
+LABELV $544
+ADDRLP4 52
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 1
+GTI4 $551
+CNSTI4 0
+RETI4
+ADDRGP4 $528
+JUMPV
+LABELV $551
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $553
+CNSTI4 0
+RETI4
+ADDRGP4 $528
+JUMPV
+LABELV $553
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 BotVisibleEnemies
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $555
+CNSTI4 0
+RETI4
+ADDRGP4 $528
+JUMPV
+LABELV $555
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $557
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $558
+JUMPV
+LABELV $557
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+LABELV $558
+ADDRLP4 68
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $559
+CNSTI4 0
+RETI4
+ADDRGP4 $528
+JUMPV
+LABELV $559
+ADDRLP4 72
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 25
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 76
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 72
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+ADDRLP4 76
+INDIRF4
+GEF4 $561
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 84
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRLP4 88
+ADDRGP4 BotRandomWeaponName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $563
+ARGP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 92
+ADDRGP4 $244
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $562
+JUMPV
+LABELV $561
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 84
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRLP4 88
+ADDRGP4 BotRandomWeaponName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $564
+ARGP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 92
+ADDRGP4 $244
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $562
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6044
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $528
+endproc BotChat_Random 96 36
+export BotChatTime
+proc BotChatTime 0 0
+CNSTF4 1073741824
+RETF4
+LABELV $565
+endproc BotChatTime 0 0
+export BotChatTest
+proc BotChatTest 184 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 44
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $243
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $570
+JUMPV
+LABELV $567
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 56
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $243
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 $244
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $568
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $570
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $567
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $262
+ARGP4
+ADDRLP4 52
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $574
+JUMPV
+LABELV $571
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 60
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $262
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 $244
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $572
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $574
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $571
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $282
+ARGP4
+ADDRLP4 56
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $578
+JUMPV
+LABELV $575
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $282
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $576
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $578
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $575
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $306
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $582
+JUMPV
+LABELV $579
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 68
+ADDRGP4 BotFirstClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 72
+ADDRGP4 BotLastClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 76
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $306
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $580
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $582
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $579
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $309
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $586
+JUMPV
+LABELV $583
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 72
+ADDRGP4 BotFirstClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 76
+ADDRGP4 BotLastClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 80
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $309
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $584
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $586
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $583
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $310
+ARGP4
+ADDRLP4 68
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $590
+JUMPV
+LABELV $587
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 76
+ADDRGP4 BotFirstClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 80
+ADDRGP4 BotLastClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 84
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $310
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $588
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $590
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $587
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $338
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $594
+JUMPV
+LABELV $591
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $338
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $592
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $594
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $591
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $341
+ARGP4
+ADDRLP4 76
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $598
+JUMPV
+LABELV $595
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $341
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $596
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $598
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $595
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $344
+ARGP4
+ADDRLP4 80
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $602
+JUMPV
+LABELV $599
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $344
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $600
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $602
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $599
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $347
+ARGP4
+ADDRLP4 84
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $606
+JUMPV
+LABELV $603
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $347
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $604
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $606
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $603
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $355
+ARGP4
+ADDRLP4 88
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $610
+JUMPV
+LABELV $607
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $355
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $608
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $610
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $607
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $358
+ARGP4
+ADDRLP4 92
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $614
+JUMPV
+LABELV $611
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $358
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $612
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $614
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $611
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $366
+ARGP4
+ADDRLP4 96
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $618
+JUMPV
+LABELV $615
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $366
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRLP4 100
+INDIRI4
+ARGI4
+ADDRLP4 100
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $616
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $618
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $615
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $369
+ARGP4
+ADDRLP4 100
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $622
+JUMPV
+LABELV $619
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $369
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 104
+CNSTI4 0
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $620
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $622
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $619
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $370
+ARGP4
+ADDRLP4 104
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $626
+JUMPV
+LABELV $623
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $370
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 108
+CNSTI4 0
+ASGNI4
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $624
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $626
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $623
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $373
+ARGP4
+ADDRLP4 108
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $630
+JUMPV
+LABELV $627
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $373
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 0
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $628
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $630
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $627
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $374
+ARGP4
+ADDRLP4 112
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $634
+JUMPV
+LABELV $631
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $374
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $632
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $634
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $631
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $403
+ARGP4
+ADDRLP4 116
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $638
+JUMPV
+LABELV $635
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $403
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+ADDRLP4 120
+INDIRI4
+ARGI4
+ADDRLP4 120
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $636
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $638
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $635
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $406
+ARGP4
+ADDRLP4 120
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $642
+JUMPV
+LABELV $639
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $406
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 124
+CNSTI4 0
+ASGNI4
+ADDRLP4 124
+INDIRI4
+ARGI4
+ADDRLP4 124
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $640
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $642
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $639
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $409
+ARGP4
+ADDRLP4 124
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 124
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $646
+JUMPV
+LABELV $643
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $409
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 128
+CNSTI4 0
+ASGNI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $644
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $646
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $643
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $412
+ARGP4
+ADDRLP4 128
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $650
+JUMPV
+LABELV $647
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $412
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $648
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $650
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $647
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $413
+ARGP4
+ADDRLP4 132
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $654
+JUMPV
+LABELV $651
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $413
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 136
+CNSTI4 0
+ASGNI4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $652
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $654
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $651
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $438
+ARGP4
+ADDRLP4 136
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $658
+JUMPV
+LABELV $655
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $438
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $656
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $658
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $655
+CNSTI4 832
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 828
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $467
+ARGP4
+ADDRLP4 140
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $663
+JUMPV
+LABELV $660
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $467
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $661
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $663
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $660
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $501
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $667
+JUMPV
+LABELV $664
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $501
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 148
+CNSTI4 0
+ASGNI4
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $665
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $667
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $664
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $527
+ARGP4
+ADDRLP4 148
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $671
+JUMPV
+LABELV $668
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $527
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $669
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $671
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $668
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $672
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 156
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $673
+JUMPV
+LABELV $672
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+LABELV $673
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $563
+ARGP4
+ADDRLP4 156
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $677
+JUMPV
+LABELV $674
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 164
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRLP4 168
+ADDRGP4 BotRandomWeaponName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $563
+ARGP4
+ADDRLP4 160
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 172
+ADDRGP4 $244
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 168
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 176
+CNSTI4 0
+ASGNI4
+ADDRLP4 176
+INDIRI4
+ARGI4
+ADDRLP4 176
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $675
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $677
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $674
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $564
+ARGP4
+ADDRLP4 160
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $681
+JUMPV
+LABELV $678
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 168
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRLP4 172
+ADDRGP4 BotRandomWeaponName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $564
+ARGP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 176
+ADDRGP4 $244
+ASGNP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 168
+INDIRP4
+ARGP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 180
+CNSTI4 0
+ASGNI4
+ADDRLP4 180
+INDIRI4
+ARGI4
+ADDRLP4 180
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $679
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $681
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $678
+LABELV $566
+endproc BotChatTest 184 36
+import BotChooseCorrectWall
+import BotChooseWall
+import BotDumpNodeSwitches
+import BotResetNodeSwitches
+import AINode_Cam
+import AINode_Reachtest
+import AIEnter_Reachtest
+import AINode_Battle_NBG
+import AINode_Battle_Retreat
+import AINode_Battle_Chase
+import AINode_Battle_Fight
+import AINode_Seek_LTG
+import AINode_Seek_NBG
+import AINode_Seek_ActivateEntity
+import AINode_Respawn
+import AIEnter_Battle_NBG
+import AIEnter_Battle_Retreat
+import AIEnter_Battle_Chase
+import AIEnter_Battle_Fight
+import AIEnter_Seek_Camp
+import AIEnter_Seek_LTG
+import AIEnter_Seek_NBG
+import AIEnter_Seek_ActivateEntity
+import AIEnter_Stand
+import BotMatchMessage
+import notleader
+import num_hstations
+import hstations
+import outtele
+import spraytele
+import bwall
+import rwall
+import balloongoal
+import ctf_blueflag
+import ctf_redflag
+import bot_challenge
+import bot_testrchat
+import bot_nochat
+import bot_fastchat
+import maxclients
+import gametype
+import GetCTLFlagGoal
+import GetDroppedLollyGoal
+import CheckMatrixForGoal
+import BotCTFCarryingFlag
+import IsMyBalloon
+import IsBambam
+import IsBoomie
+import IsWall
+import IsDuck
+import BotSelectLogo
+import BotSprayWallCheckAttack
+import BotGetNumClientCarts
+import BotNmyTurnedInvalid
+import BotCheckChargedImp
+import ClientInSprayroom
+import BotMapScripts
+import BotPointAreaNum
+import ClientOnSameTeamFromName
+import ClientFromName
+import BotRememberLastOrderedTask
+import BotOppositeTeam
+import BotTeam
+import BotClearActivateGoalStack
+import BotPopFromActivateGoalStack
+import BotEnableActivateGoalAreas
+import BotAIPredictObstacles
+import BotAIBlocked
+import BotCheckAttack
+import BotAimAtEnemy
+import BotEntityVisible
+import BotRoamGoal
+import BotFindEnemy
+import InFieldOfVision
+import BotVisibleTeamMatesAndEnemies
+import TeamPlayIsOn
+import BotSameTeam
+import BotAttackMove
+import BotWantsToHelp
+import BotWantsToChase
+import BotWantsToRetreat
+import BotAggression
+import BotTeamGoals
+import ClientSkin
+import EasyClientName
+import ClientName
+import BotSetUserInfo
+import EntityIsShooting
+import EntityIsInvisible
+import EntityIsDead
+import BotInLavaOrSlime
+import BotIntermission
+import BotIsObserver
+import BotIsDead
+import BotBattleUseItems
+import BotUpdateBattleInventory
+import BotUpdateInventory
+import BotSetupForMovement
+import BotChooseWeapon
+import BotDeathmatchAI
+import BotSetupDeathmatchAI
+import BotAI_AllowLTGRefresh
+import BotAI_GetSnapshotEntity
+import BotAI_GetEntityState
+import BotAI_GetClientState
+import BotAI_ShareVisibility
+import BotAI_SharedVisibility
+import BotAI_VisTrace
+import BotAI_Trace
+import BotAI_BotInitialChat
+import BotAI_Print
+import BotAddInfo
+import floattime
+import WaypointInit
+import GetWpID
+import BotWpHasSuccessor
+import GetNextWp
+import FindWp
+import BotWpValid
+import BotEntityInfo
+import BotResetState
+import AngleDifference
+import numboomiespots
+import boomiespots
+import numbambamspots
+import bambamspots
+import numwaypoints
+import waypoints
+import bot_developer
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotAllocWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownMoveAI
+import BotSetupMoveAI
+import BotSetBrushModelTypes
+import BotAddAvoidSpot
+import BotInitMoveState
+import BotFreeMoveState
+import BotAllocMoveState
+import BotPredictVisiblePosition
+import BotMovementViewTarget
+import BotReachabilityArea
+import BotResetLastAvoidReach
+import BotResetAvoidReach
+import BotMoveInDirection
+import BotMoveToGoal
+import BotResetMoveState
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GeneticParentsAndChildSelection
+import BotSetChatName
+import BotSetChatGender
+import BotLoadChatFile
+import BotReplaceSynonyms
+import UnifyWhiteSpaces
+import BotMatchVariable
+import BotFindMatch
+import StringContains
+import BotGetChatMessage
+import BotEnterChat
+import BotChatLength
+import BotReplyChat
+import BotNumInitialChats
+import BotInitialChat
+import BotNumConsoleMessages
+import BotNextConsoleMessage
+import BotRemoveConsoleMessage
+import BotQueueConsoleMessage
+import BotFreeChatState
+import BotAllocChatState
+import BotShutdownChatAI
+import BotSetupChatAI
+import BotShutdownCharacters
+import Characteristic_String
+import Characteristic_BInteger
+import Characteristic_Integer
+import Characteristic_BFloat
+import Characteristic_Float
+import BotFreeCharacter
+import BotLoadCharacter
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Walk
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import GetBotLibAPI
+import trap_AAS_BestReachableArea
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntities
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_RealTime
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_EntitiesInPVS
+import trap_RestoreClients
+import trap_RewindClients
+import trap_GetUsercmds
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_TraceBatch
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import g_logDamage
+import g_modInstagib_WeaponJump
+import g_modInstagib
+import g_transmitSVboastermissiles
+import g_KillerduckHealth
+import g_LPS_flags
+import g_LPS_startlives
+import g_skyLensflare
+import g_sky
+import g_q3Items
+import pmove_msec
+import pmove_fixed
+import g_antilag
+import g_smoothClients
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_curWarmupReady
+import g_warmupReady
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import MapSupportsGametype
+import G_GetArenaInfoByMap
+import G_InitGameinfo
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import AI_RemoveBambam
+import AI_AddBambam
+import AI_RemoveBoomie
+import AI_AddBoomie
+import BotCamViewangles
+import BotCamViewTarget
+import BotCamViewEntitiy
+import BotChooseWeap
+import BotCamFire
+import BotCamTaunt
+import BotCamMoveTo
+import BotCamMode
+import BotInterbreedEndMatch
+import Svcmd_BotStats_f
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_LoadBots
+import CantDamageTeamitem
+import boomies_createByPlayer
+import bambam_createByPlayer
+import IsItemSameTeam
+import Instagib_canSpawnEntity
+import Instagib_isRelevantDamageEvent
+import Instagib_calculateDamage
+import Instagib_getSpawnWeapon
+import Instagib_applyWeaponJumpKnockback
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import PrintMsg
+import CheckObeliskAttack
+import Team_GetFlagStatus
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThinkBatch
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogFlush
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import G_GetCvarInt
+import MoveClientToIntermission
+import G_SendScoreboardUpdates
+import DeathmatchScoreboardMessage
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import GetASpawnPosition
+import SelectSpectatorSpawnPoint
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import respawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import Touch_DoorTrigger
+import G_PushablesChanged
+import G_RunMover
+import fire_kma
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_bubbleg
+import fire_bambamMissile
+import fire_duck
+import explode_imperius
+import fire_splasher
+import fire_nipper
+import fire_boaster
+import G_RunExplosion
+import G_RunMissile
+import BerserkerCheck
+import TossClientCubes
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import GametypeNameShort
+import GametypeName
+import RemoveOwnedItems
+import SetAward
+import G_RestorePowerups
+import G_BackupPowerups
+import DeleteDebugLines
+import DebugLineDouble
+import DebugLine
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_NextActiveEntity
+import G_InitEntityLists
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_FindAll
+import G_Find
+import G_EntityIndexChanged
+import G_InitEntityIndex
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import G_Say
+import ConcatArgs
+import Cmd_DropCartridge_f
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $564
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $563
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 0
+align 1
+LABELV $527
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $501
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $467
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $438
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 95
+byte 1 115
+byte 1 117
+byte 1 105
+byte 1 99
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $437
+byte 1 0
+align 1
+LABELV $413
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $412
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $409
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $406
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $403
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $398
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $374
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $373
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $370
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $369
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $366
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $358
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $355
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 115
+byte 1 117
+byte 1 105
+byte 1 99
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $347
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $344
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 118
+byte 1 97
+byte 1 0
+align 1
+LABELV $341
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $338
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $333
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $328
+byte 1 91
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 93
+byte 1 0
+align 1
+LABELV $310
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $309
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $306
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 0
+align 1
+LABELV $282
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $262
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 95
+byte 1 101
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $244
+byte 1 91
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 93
+byte 1 0
+align 1
+LABELV $243
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $182
+byte 1 73
+byte 1 77
+byte 1 80
+byte 1 69
+byte 1 82
+byte 1 105
+byte 1 85
+byte 1 83
+byte 1 0
+align 1
+LABELV $181
+byte 1 66
+byte 1 79
+byte 1 65
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $179
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $177
+byte 1 66
+byte 1 85
+byte 1 66
+byte 1 66
+byte 1 76
+byte 1 69
+byte 1 46
+byte 1 71
+byte 1 46
+byte 1 0
+align 1
+LABELV $175
+byte 1 66
+byte 1 69
+byte 1 84
+byte 1 84
+byte 1 89
+byte 1 0
+align 1
+LABELV $173
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 79
+byte 1 79
+byte 1 78
+byte 1 89
+byte 1 0
+align 1
+LABELV $171
+byte 1 78
+byte 1 105
+byte 1 80
+byte 1 80
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $169
+byte 1 80
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $167
+byte 1 80
+byte 1 85
+byte 1 78
+byte 1 67
+byte 1 72
+byte 1 89
+byte 1 0
+align 1
+LABELV $162
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $77
+byte 1 116
+byte 1 0
+align 1
+LABELV $73
+byte 1 110
+byte 1 0
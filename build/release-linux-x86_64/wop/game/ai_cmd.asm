@@ -0,0 +1,2682 @@
+export BotGetItemTeamGoal
+code
+proc BotGetItemTeamGoal 12 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRU4
+CNSTU4 0
+NEU4 $66
+CNSTI4 0
+RETI4
+ADDRGP4 $65
+JUMPV
+LABELV $66
+ADDRLP4 0
+CNSTI4 -1
+ASGNI4
+LABELV $68
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $71
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $73
+ADDRGP4 $69
+JUMPV
+LABELV $73
+CNSTI4 1
+RETI4
+ADDRGP4 $65
+JUMPV
+LABELV $71
+LABELV $69
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $68
+CNSTI4 0
+RETI4
+LABELV $65
+endproc BotGetItemTeamGoal 12 12
+export BotGetMessageTeamGoal
+proc BotGetMessageTeamGoal 4 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotGetItemTeamGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $76
+CNSTI4 1
+RETI4
+ADDRGP4 $75
+JUMPV
+LABELV $76
+CNSTI4 0
+RETI4
+LABELV $75
+endproc BotGetMessageTeamGoal 4 8
+export FindClientByName
+proc FindClientByName 1032 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $82
+JUMPV
+LABELV $79
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1028
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 0
+NEI4 $84
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $78
+JUMPV
+LABELV $84
+LABELV $80
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $82
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $79
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $89
+JUMPV
+LABELV $86
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1028
+ADDRGP4 Q_stristr
+CALLP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $91
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $78
+JUMPV
+LABELV $91
+LABELV $87
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $89
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $86
+CNSTI4 -1
+RETI4
+LABELV $78
+endproc FindClientByName 1032 12
+export FindEnemyByName
+proc FindEnemyByName 1036 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $97
+JUMPV
+LABELV $94
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1028
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 0
+EQI4 $99
+ADDRGP4 $95
+JUMPV
+LABELV $99
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+NEI4 $101
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $93
+JUMPV
+LABELV $101
+LABELV $95
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $97
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $94
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $106
+JUMPV
+LABELV $103
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1028
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 0
+EQI4 $108
+ADDRGP4 $104
+JUMPV
+LABELV $108
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Q_stristr
+CALLP4
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $110
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $93
+JUMPV
+LABELV $110
+LABELV $104
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $106
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $103
+CNSTI4 -1
+RETI4
+LABELV $93
+endproc FindEnemyByName 1036 12
+export NumPlayersOnSameTeam
+proc NumPlayersOnSameTeam 1044 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1032
+CNSTI4 0
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+ADDRGP4 $116
+JUMPV
+LABELV $113
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1036
+INDIRU4
+CNSTU4 0
+EQU4 $118
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1040
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $120
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $120
+LABELV $118
+LABELV $114
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $116
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $113
+ADDRLP4 1028
+INDIRI4
+RETI4
+LABELV $112
+endproc NumPlayersOnSameTeam 1044 12
+export BotAddressedToBot
+proc BotAddressedToBot 656 16
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 644
+ADDRGP4 ClientOnSameTeamFromName
+CALLI4
+ASGNI4
+ADDRLP4 512
+ADDRLP4 644
+INDIRI4
+ASGNI4
+ADDRLP4 512
+INDIRI4
+CNSTI4 0
+GEI4 $123
+CNSTI4 0
+RETI4
+ADDRGP4 $122
+JUMPV
+LABELV $123
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $125
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 256
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 516
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 256
+ARGP4
+ADDRLP4 648
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 648
+INDIRU4
+CNSTU4 0
+EQU4 $127
+ADDRLP4 516
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRLP4 652
+ADDRGP4 Q_stristr
+CALLP4
+ASGNP4
+ADDRLP4 652
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $127
+CNSTI4 1
+RETI4
+ADDRGP4 $122
+JUMPV
+LABELV $127
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $129
+LABELV $129
+CNSTI4 0
+RETI4
+ADDRGP4 $122
+JUMPV
+LABELV $125
+CNSTI4 1
+RETI4
+LABELV $122
+endproc BotAddressedToBot 656 16
+export BotMatch_WrongWall
+proc BotMatch_WrongWall 1316 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+EQI4 $133
+ADDRGP4 $132
+JUMPV
+LABELV $133
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 256
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 256
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 256
+ARGP4
+ADDRGP4 $137
+ARGP4
+ADDRLP4 1284
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1284
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1288
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1288
+INDIRI4
+CNSTI4 0
+NEI4 $135
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1292
+ADDRGP4 ClientInSprayroom
+CALLI4
+ASGNI4
+ADDRLP4 1292
+INDIRI4
+CNSTI4 0
+EQI4 $138
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1300
+ADDRGP4 BotChooseCorrectWall
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8364
+ADDP4
+ADDRLP4 1300
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $140
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1304
+CNSTI4 0
+ASGNI4
+ADDRLP4 1304
+INDIRI4
+ARGI4
+ADDRLP4 1304
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRGP4 $132
+JUMPV
+LABELV $138
+LABELV $135
+ADDRLP4 0
+ARGP4
+ADDRLP4 1292
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 1280
+ADDRLP4 1292
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1280
+INDIRI4
+ARGI4
+ADDRLP4 1296
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1296
+INDIRI4
+CNSTI4 0
+NEI4 $141
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 24
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1304
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 1300
+ADDRLP4 1304
+INDIRF4
+ASGNF4
+ADDRLP4 1308
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1308
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+ADDRLP4 1300
+INDIRF4
+LEF4 $143
+ADDRGP4 $132
+JUMPV
+LABELV $143
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $145
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1312
+CNSTI4 0
+ASGNI4
+ADDRLP4 1312
+INDIRI4
+ARGI4
+ADDRLP4 1312
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $141
+LABELV $132
+endproc BotMatch_WrongWall 1316 16
+proc BotMatch_GoForBalloon 0 0
+LABELV $146
+endproc BotMatch_GoForBalloon 0 0
+export BotMatch_CatchMe
+proc BotMatch_CatchMe 276 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 260
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+EQI4 $150
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+NEI4 $148
+LABELV $150
+ADDRGP4 $147
+JUMPV
+LABELV $148
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 268
+ADDRGP4 ClientOnSameTeamFromName
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6304
+ADDP4
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6376
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6308
+ADDP4
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRLP4 272
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6368
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 272
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 18
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6372
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1133903872
+ADDF4
+ASGNF4
+LABELV $147
+endproc BotMatch_CatchMe 276 16
+export BotMatch_GetItem
+proc BotMatch_GetItem 540 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 516
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 516
+INDIRI4
+CNSTI4 0
+NEI4 $152
+ADDRGP4 $151
+JUMPV
+LABELV $152
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 520
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 520
+INDIRI4
+CNSTI4 0
+NEI4 $154
+ADDRGP4 $151
+JUMPV
+LABELV $154
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ARGP4
+ADDRLP4 528
+ADDRGP4 BotGetMessageTeamGoal
+CALLI4
+ASGNI4
+ADDRLP4 528
+INDIRI4
+CNSTI4 0
+NEI4 $156
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $158
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRGP4 $151
+JUMPV
+LABELV $156
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 256
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRLP4 532
+ADDRGP4 ClientOnSameTeamFromName
+CALLI4
+ASGNI4
+ADDRLP4 512
+ADDRLP4 532
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6308
+ADDP4
+ADDRLP4 512
+INDIRI4
+ASGNI4
+ADDRLP4 536
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6368
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 536
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 10
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6372
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+LABELV $151
+endproc BotMatch_GetItem 540 16
+proc BotMatch_EnterGame 44 16
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 40
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LTI4 $160
+ADDRLP4 36
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 notleader
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $160
+LABELV $159
+endproc BotMatch_EnterGame 44 16
+proc BotMatch_DropCart 424 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 404
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 404
+INDIRI4
+CNSTI4 0
+NEI4 $163
+ADDRGP4 $162
+JUMPV
+LABELV $163
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 408
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 408
+INDIRI4
+CNSTI4 0
+NEI4 $165
+ADDRGP4 $162
+JUMPV
+LABELV $165
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 412
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $167
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $169
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 416
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 416
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRGP4 $162
+JUMPV
+LABELV $167
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $170
+ADDRGP4 $162
+JUMPV
+LABELV $170
+ADDRFP4 0
+INDIRP4
+CNSTI4 6352
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+EQI4 $172
+ADDRLP4 260+24
+ARGP4
+ADDRLP4 416
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 400
+ADDRLP4 416
+INDIRI4
+ASGNI4
+ADDRLP4 400
+INDIRI4
+CNSTI4 0
+EQI4 $175
+ADDRFP4 0
+INDIRP4
+CNSTI4 6352
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6324
+ADDP4
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ADDRLP4 260+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6328
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6332
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6336
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6340
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6344
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6348
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+LABELV $175
+LABELV $172
+ADDRFP4 0
+INDIRP4
+CNSTI4 6352
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $178
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $180
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 416
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 416
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRGP4 $162
+JUMPV
+LABELV $178
+ADDRFP4 0
+INDIRP4
+CNSTI4 6304
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 416
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 416
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6308
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6376
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 420
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6368
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 420
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 16
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6372
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1097859072
+ADDF4
+ASGNF4
+LABELV $162
+endproc BotMatch_DropCart 424 16
+export BotMatchMessage
+proc BotMatchMessage 340 12
+ADDRLP4 0+256
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTU4 6
+ARGU4
+ADDRLP4 328
+ADDRGP4 trap_BotFindMatch
+CALLI4
+ASGNI4
+ADDRLP4 328
+INDIRI4
+CNSTI4 0
+NEI4 $183
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $185
+ADDRGP4 $188
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $185
+CNSTI4 0
+RETI4
+ADDRGP4 $181
+JUMPV
+LABELV $183
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $189
+ADDRGP4 $192
+ARGP4
+ADDRLP4 0+256
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $189
+ADDRLP4 332
+ADDRLP4 0+256
+INDIRI4
+ASGNI4
+ADDRLP4 336
+CNSTI4 2
+ASGNI4
+ADDRLP4 332
+INDIRI4
+ADDRLP4 336
+INDIRI4
+LTI4 $194
+ADDRLP4 332
+INDIRI4
+CNSTI4 10
+GTI4 $194
+ADDRLP4 332
+INDIRI4
+ADDRLP4 336
+INDIRI4
+LSHI4
+ADDRGP4 $208-8
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $208
+address $201
+address $198
+address $194
+address $194
+address $200
+address $194
+address $199
+address $197
+address $202
+code
+LABELV $197
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_WrongWall
+CALLV
+pop
+ADDRGP4 $195
+JUMPV
+LABELV $198
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_GoForBalloon
+CALLV
+pop
+ADDRGP4 $195
+JUMPV
+LABELV $199
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_DropCart
+CALLV
+pop
+ADDRGP4 $195
+JUMPV
+LABELV $200
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_GetItem
+CALLV
+pop
+ADDRGP4 $195
+JUMPV
+LABELV $201
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_EnterGame
+CALLV
+pop
+ADDRGP4 $195
+JUMPV
+LABELV $202
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_CatchMe
+CALLV
+pop
+ADDRGP4 $195
+JUMPV
+LABELV $194
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $195
+CNSTI4 1
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRLP4 0+256
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $195
+CNSTI4 1
+RETI4
+LABELV $181
+endproc BotMatchMessage 340 12
+import BotClientTravelTimeToGoal
+import BotTeamAI
+import BotChooseCorrectWall
+import BotChooseWall
+import BotDumpNodeSwitches
+import BotResetNodeSwitches
+import AINode_Cam
+import AINode_Reachtest
+import AIEnter_Reachtest
+import AINode_Battle_NBG
+import AINode_Battle_Retreat
+import AINode_Battle_Chase
+import AINode_Battle_Fight
+import AINode_Seek_LTG
+import AINode_Seek_NBG
+import AINode_Seek_ActivateEntity
+import AINode_Respawn
+import AIEnter_Battle_NBG
+import AIEnter_Battle_Retreat
+import AIEnter_Battle_Chase
+import AIEnter_Battle_Fight
+import AIEnter_Seek_Camp
+import AIEnter_Seek_LTG
+import AIEnter_Seek_NBG
+import AIEnter_Seek_ActivateEntity
+import AIEnter_Stand
+bss
+export notleader
+align 4
+LABELV notleader
+skip 256
+import BotChatTest
+import BotChatTime
+import BotChat_Random
+import BotChat_EnemySuicide
+import BotChat_Kill
+import BotChat_Death
+import BotChat_HitNoKill
+import BotChat_HitNoDeath
+import BotChat_HitTalking
+import BotChat_EndLevel
+import BotChat_StartLevel
+import BotChat_ExitGame
+import BotChat_EnterGame
+import num_hstations
+import hstations
+import outtele
+import spraytele
+import bwall
+import rwall
+import balloongoal
+import ctf_blueflag
+import ctf_redflag
+import bot_challenge
+import bot_testrchat
+import bot_nochat
+import bot_fastchat
+import maxclients
+import gametype
+import GetCTLFlagGoal
+import GetDroppedLollyGoal
+import CheckMatrixForGoal
+import BotCTFCarryingFlag
+import IsMyBalloon
+import IsBambam
+import IsBoomie
+import IsWall
+import IsDuck
+import BotSelectLogo
+import BotSprayWallCheckAttack
+import BotGetNumClientCarts
+import BotNmyTurnedInvalid
+import BotCheckChargedImp
+import ClientInSprayroom
+import BotMapScripts
+import BotPointAreaNum
+import ClientOnSameTeamFromName
+import ClientFromName
+import BotRememberLastOrderedTask
+import BotOppositeTeam
+import BotTeam
+import BotClearActivateGoalStack
+import BotPopFromActivateGoalStack
+import BotEnableActivateGoalAreas
+import BotAIPredictObstacles
+import BotAIBlocked
+import BotCheckAttack
+import BotAimAtEnemy
+import BotEntityVisible
+import BotRoamGoal
+import BotFindEnemy
+import InFieldOfVision
+import BotVisibleTeamMatesAndEnemies
+import TeamPlayIsOn
+import BotSameTeam
+import BotAttackMove
+import BotWantsToHelp
+import BotWantsToChase
+import BotWantsToRetreat
+import BotAggression
+import BotTeamGoals
+import ClientSkin
+import EasyClientName
+import ClientName
+import BotSetUserInfo
+import EntityIsShooting
+import EntityIsInvisible
+import EntityIsDead
+import BotInLavaOrSlime
+import BotIntermission
+import BotIsObserver
+import BotIsDead
+import BotBattleUseItems
+import BotUpdateBattleInventory
+import BotUpdateInventory
+import BotSetupForMovement
+import BotChooseWeapon
+import BotDeathmatchAI
+import BotSetupDeathmatchAI
+import BotAI_AllowLTGRefresh
+import BotAI_GetSnapshotEntity
+import BotAI_GetEntityState
+import BotAI_GetClientState
+import BotAI_ShareVisibility
+import BotAI_SharedVisibility
+import BotAI_VisTrace
+import BotAI_Trace
+import BotAI_BotInitialChat
+import BotAI_Print
+import BotAddInfo
+import floattime
+import WaypointInit
+import GetWpID
+import BotWpHasSuccessor
+import GetNextWp
+import FindWp
+import BotWpValid
+import BotEntityInfo
+import BotResetState
+import AngleDifference
+import numboomiespots
+import boomiespots
+import numbambamspots
+import bambamspots
+import numwaypoints
+import waypoints
+import bot_developer
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotAllocWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownMoveAI
+import BotSetupMoveAI
+import BotSetBrushModelTypes
+import BotAddAvoidSpot
+import BotInitMoveState
+import BotFreeMoveState
+import BotAllocMoveState
+import BotPredictVisiblePosition
+import BotMovementViewTarget
+import BotReachabilityArea
+import BotResetLastAvoidReach
+import BotResetAvoidReach
+import BotMoveInDirection
+import BotMoveToGoal
+import BotResetMoveState
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GeneticParentsAndChildSelection
+import BotSetChatName
+import BotSetChatGender
+import BotLoadChatFile
+import BotReplaceSynonyms
+import UnifyWhiteSpaces
+import BotMatchVariable
+import BotFindMatch
+import StringContains
+import BotGetChatMessage
+import BotEnterChat
+import BotChatLength
+import BotReplyChat
+import BotNumInitialChats
+import BotInitialChat
+import BotNumConsoleMessages
+import BotNextConsoleMessage
+import BotRemoveConsoleMessage
+import BotQueueConsoleMessage
+import BotFreeChatState
+import BotAllocChatState
+import BotShutdownChatAI
+import BotSetupChatAI
+import BotShutdownCharacters
+import Characteristic_String
+import Characteristic_BInteger
+import Characteristic_Integer
+import Characteristic_BFloat
+import Characteristic_Float
+import BotFreeCharacter
+import BotLoadCharacter
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Walk
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import GetBotLibAPI
+import trap_AAS_BestReachableArea
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntities
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_RealTime
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_EntitiesInPVS
+import trap_RestoreClients
+import trap_RewindClients
+import trap_GetUsercmds
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_TraceBatch
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import g_logDamage
+import g_modInstagib_WeaponJump
+import g_modInstagib
+import g_transmitSVboastermissiles
+import g_KillerduckHealth
+import g_LPS_flags
+import g_LPS_startlives
+import g_skyLensflare
+import g_sky
+import g_q3Items
+import pmove_msec
+import pmove_fixed
+import g_antilag
+import g_smoothClients
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_curWarmupReady
+import g_warmupReady
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import MapSupportsGametype
+import G_GetArenaInfoByMap
+import G_InitGameinfo
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import AI_RemoveBambam
+import AI_AddBambam
+import AI_RemoveBoomie
+import AI_AddBoomie
+import BotCamViewangles
+import BotCamViewTarget
+import BotCamViewEntitiy
+import BotChooseWeap
+import BotCamFire
+import BotCamTaunt
+import BotCamMoveTo
+import BotCamMode
+import BotInterbreedEndMatch
+import Svcmd_BotStats_f
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_LoadBots
+import CantDamageTeamitem
+import boomies_createByPlayer
+import bambam_createByPlayer
+import IsItemSameTeam
+import Instagib_canSpawnEntity
+import Instagib_isRelevantDamageEvent
+import Instagib_calculateDamage
+import Instagib_getSpawnWeapon
+import Instagib_applyWeaponJumpKnockback
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import PrintMsg
+import CheckObeliskAttack
+import Team_GetFlagStatus
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThinkBatch
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogFlush
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import G_GetCvarInt
+import MoveClientToIntermission
+import G_SendScoreboardUpdates
+import DeathmatchScoreboardMessage
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import GetASpawnPosition
+import SelectSpectatorSpawnPoint
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import respawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import Touch_DoorTrigger
+import G_PushablesChanged
+import G_RunMover
+import fire_kma
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_bubbleg
+import fire_bambamMissile
+import fire_duck
+import explode_imperius
+import fire_splasher
+import fire_nipper
+import fire_boaster
+import G_RunExplosion
+import G_RunMissile
+import BerserkerCheck
+import TossClientCubes
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import GametypeNameShort
+import GametypeName
+import RemoveOwnedItems
+import SetAward
+import G_RestorePowerups
+import G_BackupPowerups
+import DeleteDebugLines
+import DebugLineDouble
+import DebugLine
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_NextActiveEntity
+import G_InitEntityLists
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_FindAll
+import G_Find
+import G_EntityIndexChanged
+import G_InitEntityIndex
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import G_Say
+import ConcatArgs
+import Cmd_DropCartridge_f
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $206
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $192
+byte 1 94
+byte 1 54
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 94
+byte 1 49
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $188
+byte 1 94
+byte 1 50
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 94
+byte 1 49
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $180
+byte 1 119
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 0
+align 1
+LABELV $169
+byte 1 119
+byte 1 104
+byte 1 111
+byte 1 105
+byte 1 115
+byte 1 0
+align 1
+LABELV $158
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $145
+byte 1 119
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $140
+byte 1 119
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $137
+byte 1 110
+byte 1 0
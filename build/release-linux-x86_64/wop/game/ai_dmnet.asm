@@ -0,0 +1,18574 @@
+export BotClientTravelTimeToGoal
+code
+proc BotClientTravelTimeToGoal 480 16
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotAI_GetClientState
+CALLI4
+pop
+ADDRLP4 0+20
+ARGP4
+ADDRLP4 472
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 468
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRLP4 468
+INDIRI4
+CNSTI4 0
+NEI4 $67
+CNSTI4 1
+RETI4
+ADDRGP4 $65
+JUMPV
+LABELV $67
+ADDRLP4 468
+INDIRI4
+ARGI4
+ADDRLP4 0+20
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 476
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 476
+INDIRI4
+RETI4
+LABELV $65
+endproc BotClientTravelTimeToGoal 480 16
+bss
+align 4
+LABELV $71
+skip 4
+code
+proc BotGetTeammates 1068 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $71
+INDIRI4
+CNSTI4 0
+NEI4 $72
+ADDRGP4 $74
+ARGP4
+ADDRLP4 1032
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $71
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+LABELV $72
+ADDRLP4 1036
+CNSTI4 0
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRGP4 $78
+JUMPV
+LABELV $75
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1040
+INDIRU4
+CNSTU4 0
+EQU4 $82
+ADDRLP4 4
+ARGP4
+ADDRGP4 $81
+ARGP4
+ADDRLP4 1044
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1048
+INDIRU4
+CNSTU4 0
+NEU4 $79
+LABELV $82
+ADDRGP4 $76
+JUMPV
+LABELV $79
+ADDRLP4 4
+ARGP4
+ADDRGP4 $85
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1052
+INDIRP4
+ARGP4
+ADDRLP4 1056
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 3
+NEI4 $83
+ADDRGP4 $76
+JUMPV
+LABELV $83
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1060
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+EQI4 $86
+ADDRLP4 1064
+ADDRLP4 1028
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1064
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $88
+ADDRGP4 $77
+JUMPV
+LABELV $88
+LABELV $86
+LABELV $76
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $78
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $71
+INDIRI4
+GEI4 $90
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $75
+LABELV $90
+LABELV $77
+ADDRLP4 1028
+INDIRI4
+RETI4
+LABELV $70
+endproc BotGetTeammates 1068 12
+export BotResetNodeSwitches
+proc BotResetNodeSwitches 0 0
+ADDRGP4 numnodeswitches
+CNSTI4 0
+ASGNI4
+LABELV $91
+endproc BotResetNodeSwitches 0 0
+export BotDumpNodeSwitches
+proc BotDumpNodeSwitches 40 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $93
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 floattime
+INDIRF4
+ARGF4
+CNSTI4 50
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $97
+JUMPV
+LABELV $94
+CNSTI4 1
+ARGI4
+ADDRGP4 $98
+ARGP4
+CNSTI4 144
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 nodeswitch
+ADDP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $95
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $97
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numnodeswitches
+INDIRI4
+LTI4 $94
+CNSTI4 4
+ARGI4
+ADDRGP4 $99
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $92
+endproc BotDumpNodeSwitches 40 20
+proc BotRecordNodeSwitch 44 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 36
+CNSTI4 144
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 numnodeswitches
+INDIRI4
+MULI4
+ADDRGP4 nodeswitch
+ADDP4
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRGP4 $101
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 floattime
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 40
+ADDRGP4 numnodeswitches
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $100
+endproc BotRecordNodeSwitch 44 32
+lit
+align 4
+LABELV $103
+byte 4 3245342720
+byte 4 3245342720
+byte 4 3221225472
+align 4
+LABELV $104
+byte 4 1097859072
+byte 4 1097859072
+byte 4 1073741824
+code
+proc BotGetAirGoal 140 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 96
+ADDRGP4 $103
+INDIRB
+ASGNB 12
+ADDRLP4 108
+ADDRGP4 $104
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1148846080
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 96
+ARGP4
+ADDRLP4 108
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 12+12
+INDIRB
+ASGNB 12
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 96
+ARGP4
+ADDRLP4 108
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 56
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 0
+LEF4 $107
+ADDRLP4 12+12
+ARGP4
+ADDRLP4 132
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 120
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+EQI4 $111
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12+12
+INDIRB
+ASGNB 12
+ADDRLP4 136
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ADDRLP4 136
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 3245342720
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 3245342720
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1097859072
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1097859072
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 128
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $102
+JUMPV
+LABELV $111
+LABELV $107
+CNSTI4 0
+RETI4
+LABELV $102
+endproc BotGetAirGoal 140 28
+proc BotGoForAir 1228 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6148
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1086324736
+SUBF4
+GEF4 $115
+ADDRLP4 56
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetServerinfo
+CALLV
+pop
+ADDRLP4 56
+ARGP4
+ADDRGP4 $117
+ARGP4
+ADDRLP4 1208
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1080
+ARGP4
+ADDRLP4 1208
+INDIRP4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1080
+ARGP4
+ADDRGP4 $120
+ARGP4
+ADDRLP4 1212
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1212
+INDIRI4
+CNSTI4 0
+NEI4 $118
+CNSTI4 0
+RETI4
+ADDRGP4 $114
+JUMPV
+LABELV $118
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1216
+ADDRGP4 BotGetAirGoal
+CALLI4
+ASGNI4
+ADDRLP4 1216
+INDIRI4
+CNSTI4 0
+EQI4 $124
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotPushGoal
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $114
+JUMPV
+LABELV $123
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1220
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 1220
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+NEI4 $126
+CNSTI4 1
+RETI4
+ADDRGP4 $114
+JUMPV
+LABELV $126
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotPopGoal
+CALLV
+pop
+LABELV $124
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4952
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 1224
+ADDRGP4 trap_BotChooseNBGItem
+CALLI4
+ASGNI4
+ADDRLP4 1224
+INDIRI4
+CNSTI4 0
+NEI4 $123
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidGoals
+CALLV
+pop
+LABELV $115
+CNSTI4 0
+RETI4
+LABELV $114
+endproc BotGoForAir 1228 24
+proc BotGotIllegalCartGoal 188 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+NEI4 $129
+ADDRLP4 0+48
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $129
+ADDRLP4 0+44
+INDIRI4
+ARGI4
+ADDRLP4 56
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRLP4 56
+ARGP4
+ADDRGP4 $136
+ARGP4
+ADDRLP4 184
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+NEI4 $134
+ADDRLP4 0+40
+INDIRI4
+CNSTI4 0
+LTI4 $141
+ADDRLP4 0+40
+INDIRI4
+CNSTI4 1022
+LTI4 $137
+LABELV $141
+CNSTI4 0
+RETI4
+ADDRGP4 $128
+JUMPV
+LABELV $137
+CNSTI4 832
+ADDRLP4 0+40
+INDIRI4
+MULI4
+ADDRGP4 g_entities+140
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $142
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0+44
+INDIRI4
+ARGI4
+CNSTF4 1106247680
+ARGF4
+ADDRGP4 trap_BotSetAvoidGoalTime
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotPopGoal
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $128
+JUMPV
+LABELV $142
+LABELV $134
+LABELV $129
+CNSTI4 0
+RETI4
+LABELV $128
+endproc BotGotIllegalCartGoal 188 12
+proc BotNearbyGoal 20 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 BotGoForAir
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $148
+CNSTI4 1
+RETI4
+ADDRGP4 $147
+JUMPV
+LABELV $148
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4952
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 trap_BotChooseNBGItem
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 BotGotIllegalCartGoal
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $150
+CNSTI4 0
+RETI4
+ADDRGP4 $147
+JUMPV
+LABELV $150
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $147
+endproc BotNearbyGoal 20 24
+proc BotReachedGoal 40 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $153
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $155
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $157
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 3212836864
+ARGF4
+ADDRGP4 trap_BotSetAvoidGoalTime
+CALLV
+pop
+LABELV $157
+CNSTI4 1
+RETI4
+ADDRGP4 $152
+JUMPV
+LABELV $155
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_BotItemGoalInVisButNotVisible
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $159
+CNSTI4 1
+RETI4
+ADDRGP4 $152
+JUMPV
+LABELV $159
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $154
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDF4
+LEF4 $154
+ADDRLP4 12
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDF4
+GEF4 $154
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDF4
+LEF4 $154
+ADDRLP4 24
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDF4
+GEF4 $154
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_AAS_Swimming
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $154
+CNSTI4 1
+RETI4
+ADDRGP4 $152
+JUMPV
+LABELV $153
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $169
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $171
+CNSTI4 1
+RETI4
+ADDRGP4 $152
+JUMPV
+LABELV $171
+ADDRFP4 0
+INDIRP4
+CNSTI4 6148
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+LEF4 $170
+CNSTI4 1
+RETI4
+ADDRGP4 $152
+JUMPV
+LABELV $169
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $175
+CNSTI4 1
+RETI4
+ADDRGP4 $152
+JUMPV
+LABELV $175
+LABELV $170
+LABELV $154
+CNSTI4 0
+RETI4
+LABELV $152
+endproc BotReachedGoal 40 16
+proc BotChooseSpawnGoal 72 12
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 56
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRGP4 GetASpawnPosition
+CALLI4
+pop
+ADDRLP4 0
+ADDRLP4 56
+INDIRB
+ASGNB 12
+ADDRLP4 0+16
+CNSTF4 3279945728
+ASGNF4
+ADDRLP4 0+16+4
+CNSTF4 3279945728
+ASGNF4
+ADDRLP4 0+16+8
+CNSTF4 3254779904
+ASGNF4
+ADDRLP4 0+28
+CNSTF4 1132462080
+ASGNF4
+ADDRLP4 0+28+4
+CNSTF4 1132462080
+ASGNF4
+ADDRLP4 0+28+8
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 68
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 0+12
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 0+40
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+44
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+48
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+52
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+12
+INDIRI4
+CNSTI4 0
+EQI4 $193
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotPushGoal
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $177
+JUMPV
+LABELV $193
+CNSTI4 0
+RETI4
+LABELV $177
+endproc BotChooseSpawnGoal 72 12
+proc BotGetItemLongTermGoal 164 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $197
+ADDRFP4 0
+INDIRP4
+CNSTI4 6060
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $198
+JUMPV
+LABELV $197
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotReachedGoal
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $199
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChooseWeapon
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6060
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $199
+LABELV $198
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 6060
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $201
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+EQF4 $203
+ADDRLP4 12
+ADDRGP4 BotAI_AllowLTGRefresh
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $201
+LABELV $203
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotPopGoal
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4952
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 trap_BotChooseLTGItem
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $206
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 BotChooseSpawnGoal
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $204
+LABELV $206
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+pop
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 BotGotIllegalCartGoal
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $207
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+RETI4
+ADDRGP4 $196
+JUMPV
+LABELV $207
+ADDRFP4 0
+INDIRP4
+CNSTI4 6060
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1101004800
+ADDF4
+ASGNF4
+ADDRGP4 $205
+JUMPV
+LABELV $204
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidGoals
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+LABELV $205
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+RETI4
+ADDRGP4 $196
+JUMPV
+LABELV $201
+CNSTI4 1
+RETI4
+LABELV $196
+endproc BotGetItemLongTermGoal 164 16
+export BotChooseWall
+proc BotChooseWall 20 4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 3
+NEI4 $210
+ADDRLP4 4
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+GEF4 $213
+ADDRLP4 0
+ADDRGP4 bwall
+ASGNP4
+ADDRGP4 $214
+JUMPV
+LABELV $213
+ADDRLP4 0
+ADDRGP4 rwall
+ASGNP4
+LABELV $214
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $209
+JUMPV
+LABELV $210
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $215
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1065185444
+GEF4 $218
+ADDRLP4 12
+ADDRGP4 rwall
+ASGNP4
+ADDRGP4 $219
+JUMPV
+LABELV $218
+ADDRLP4 12
+ADDRGP4 bwall
+ASGNP4
+LABELV $219
+ADDRLP4 12
+INDIRP4
+RETP4
+ADDRGP4 $209
+JUMPV
+LABELV $215
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1065185444
+GEF4 $221
+ADDRLP4 12
+ADDRGP4 bwall
+ASGNP4
+ADDRGP4 $222
+JUMPV
+LABELV $221
+ADDRLP4 12
+ADDRGP4 rwall
+ASGNP4
+LABELV $222
+ADDRLP4 12
+INDIRP4
+RETP4
+LABELV $209
+endproc BotChooseWall 20 4
+export BotChooseCorrectWall
+proc BotChooseCorrectWall 4 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $224
+ADDRGP4 rwall
+RETP4
+ADDRGP4 $223
+JUMPV
+LABELV $224
+ADDRGP4 bwall
+RETP4
+LABELV $223
+endproc BotChooseCorrectWall 4 4
+proc SelfTeamGoal 16 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6352
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6324
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6328
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6332
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6336
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6340
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6344
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6348
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+LABELV $226
+endproc SelfTeamGoal 16 4
+proc BotGetLongTermGoal 1072 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 17
+NEI4 $228
+ADDRFP4 0
+INDIRP4
+CNSTI4 8380
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $230
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 SelfTeamGoal
+CALLV
+pop
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $230
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6304
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 620
+ADDRGP4 BotGetNumClientCarts
+CALLI4
+ASGNI4
+ADDRLP4 620
+INDIRI4
+CNSTI4 0
+NEI4 $232
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 624
+ADDRGP4 BotGetItemLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 624
+INDIRI4
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $232
+ADDRFP4 0
+INDIRP4
+CNSTI4 6304
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $234
+ADDRLP4 0+24
+ARGP4
+ADDRLP4 624
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 152
+ADDRLP4 624
+INDIRI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $237
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 632
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 632
+INDIRI4
+CNSTI4 0
+EQI4 $237
+ADDRFP4 0
+INDIRP4
+CNSTI4 6352
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6304
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6324
+ADDP4
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6328
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6332
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6336
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6340
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6344
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6348
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+LABELV $237
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $234
+CNSTI4 1
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $228
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 16
+NEI4 $240
+ADDRFP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $242
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 616
+ADDRGP4 BotGetItemLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 616
+INDIRI4
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $242
+ADDRLP4 616
+ADDRFP4 0
+INDIRP4
+CNSTI4 6368
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 616
+INDIRF4
+CNSTF4 0
+EQF4 $244
+ADDRLP4 616
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $244
+ADDRFP4 0
+INDIRP4
+CNSTI4 6304
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 156
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 620
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $246
+ARGP4
+ADDRLP4 620
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6304
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1048576
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6368
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $244
+ADDRFP4 0
+INDIRP4
+CNSTI4 6304
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $247
+CNSTI4 0
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $247
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6304
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 624
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 624
+INDIRF4
+CNSTF4 0
+EQF4 $249
+ADDRFP4 0
+INDIRP4
+CNSTI4 6376
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 0+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 632
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 632
+INDIRF4
+CNSTF4 1187512320
+GEF4 $258
+ADDRLP4 140
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ARGP4
+ADDRGP4 trap_EA_View
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ARGP4
+ADDRLP4 636
+ARGP4
+ADDRLP4 652
+CNSTP4 0
+ASGNP4
+ADDRLP4 652
+INDIRP4
+ARGP4
+ADDRLP4 652
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 636
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 140
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 140
+INDIRF4
+ADDRLP4 636
+INDIRF4
+MULF4
+ADDRLP4 140+4
+INDIRF4
+ADDRLP4 636+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 140+8
+INDIRF4
+ADDRLP4 636+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1062836634
+LEF4 $260
+ADDRLP4 192
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $266
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 192
+ARGP4
+ADDRGP4 trap_EA_Command
+CALLV
+pop
+LABELV $260
+LABELV $258
+LABELV $249
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $267
+ADDRLP4 0+24
+ARGP4
+ADDRLP4 628
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 152
+ADDRLP4 628
+INDIRI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $270
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 636
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 636
+INDIRI4
+CNSTI4 0
+EQI4 $270
+ADDRFP4 0
+INDIRP4
+CNSTI4 6352
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6304
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6324
+ADDP4
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6328
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6332
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6336
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6340
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6344
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6348
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+LABELV $270
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $267
+CNSTI4 1
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $240
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 18
+NEI4 $273
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $273
+ADDRLP4 616
+ADDRFP4 0
+INDIRP4
+CNSTI4 6368
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 616
+INDIRF4
+CNSTF4 0
+EQF4 $275
+ADDRLP4 616
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $275
+ADDRFP4 0
+INDIRP4
+CNSTI4 6304
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 156
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 620
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $277
+ARGP4
+ADDRLP4 620
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6308
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1048576
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6368
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $275
+ADDRFP4 0
+INDIRP4
+CNSTI4 6372
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $278
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $278
+ADDRFP4 0
+INDIRP4
+CNSTI4 6376
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+SUBF4
+GEF4 $280
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $280
+ADDRFP4 0
+INDIRP4
+CNSTI4 6304
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $282
+CNSTI4 0
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $282
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6304
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 624
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 624
+INDIRF4
+CNSTF4 0
+EQF4 $284
+ADDRLP4 140
+ADDRLP4 0+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 632
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 632
+INDIRF4
+CNSTF4 1147207680
+GEF4 $285
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $284
+ADDRFP4 0
+INDIRP4
+CNSTI4 6376
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $285
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $295
+ADDRLP4 0+24
+ARGP4
+ADDRLP4 628
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 152
+ADDRLP4 628
+INDIRI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $298
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 636
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 636
+INDIRI4
+CNSTI4 0
+EQI4 $298
+ADDRFP4 0
+INDIRP4
+CNSTI4 6352
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6304
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6324
+ADDP4
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6328
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6332
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6336
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6340
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6344
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6348
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+LABELV $298
+LABELV $295
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $273
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $301
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $301
+ADDRLP4 616
+ADDRFP4 0
+INDIRP4
+CNSTI4 6368
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 616
+INDIRF4
+CNSTF4 0
+EQF4 $303
+ADDRLP4 616
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $303
+ADDRFP4 0
+INDIRP4
+CNSTI4 6304
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 156
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 620
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $305
+ARGP4
+ADDRLP4 620
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6308
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1048576
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6368
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $303
+ADDRFP4 0
+INDIRP4
+CNSTI4 6372
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $306
+ADDRFP4 0
+INDIRP4
+CNSTI4 6304
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 156
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 620
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $308
+ARGP4
+ADDRLP4 620
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6304
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $306
+ADDRFP4 0
+INDIRP4
+CNSTI4 6304
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $309
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $309
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6304
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 624
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 624
+INDIRF4
+CNSTF4 0
+EQF4 $311
+ADDRFP4 0
+INDIRP4
+CNSTI4 6376
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 0+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 632
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 636
+ADDRFP4 0
+INDIRP4
+CNSTI4 6384
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 632
+INDIRF4
+ADDRLP4 636
+INDIRI4
+ADDRLP4 636
+INDIRI4
+MULI4
+CVIF4 4
+GEF4 $320
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 448
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $322
+CNSTI4 0
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $322
+ADDRLP4 448+24+8
+INDIRF4
+ADDRLP4 448+84+8
+INDIRF4
+ADDF4
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 0+72+8
+INDIRF4
+ADDF4
+LEF4 $324
+ADDRLP4 640
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 448+24
+INDIRF4
+ADDRLP4 448+84
+INDIRF4
+ADDF4
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 0+72
+INDIRF4
+ADDF4
+ADDRLP4 640
+INDIRF4
+SUBF4
+LEF4 $334
+ADDRLP4 448+24
+INDIRF4
+ADDRLP4 448+72
+INDIRF4
+ADDF4
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 0+84
+INDIRF4
+ADDF4
+ADDRLP4 640
+INDIRF4
+ADDF4
+GEF4 $334
+ADDRLP4 644
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 448+24+4
+INDIRF4
+ADDRLP4 448+84+4
+INDIRF4
+ADDF4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 0+72+4
+INDIRF4
+ADDF4
+ADDRLP4 644
+INDIRF4
+SUBF4
+LEF4 $344
+ADDRLP4 448+24+4
+INDIRF4
+ADDRLP4 448+72+4
+INDIRF4
+ADDF4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 0+84+4
+INDIRF4
+ADDF4
+ADDRLP4 644
+INDIRF4
+ADDF4
+GEF4 $344
+ADDRLP4 648
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 448+24+8
+INDIRF4
+ADDRLP4 448+84+8
+INDIRF4
+ADDF4
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 0+72+8
+INDIRF4
+ADDF4
+ADDRLP4 648
+INDIRF4
+SUBF4
+LEF4 $362
+ADDRLP4 448+24+8
+INDIRF4
+ADDRLP4 448+72+8
+INDIRF4
+ADDF4
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 0+84+8
+INDIRF4
+ADDF4
+ADDRLP4 648
+INDIRF4
+ADDF4
+GEF4 $362
+ADDRLP4 0+36
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRLP4 652
+CNSTP4 0
+ASGNP4
+ADDRLP4 652
+INDIRP4
+ARGP4
+ADDRLP4 652
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 140+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 604
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+ADDRLP4 0+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 604+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+ADDRLP4 0+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 604+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+ADDRLP4 0+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 604
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 140
+INDIRF4
+ADDRLP4 604
+INDIRF4
+MULF4
+ADDRLP4 140+4
+INDIRF4
+ADDRLP4 604+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 140+8
+INDIRF4
+ADDRLP4 604+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1060320051
+LEF4 $389
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 604
+ARGP4
+CNSTF4 1137180672
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+pop
+LABELV $389
+LABELV $362
+LABELV $344
+LABELV $334
+LABELV $324
+ADDRFP4 0
+INDIRP4
+CNSTI4 6104
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+SUBF4
+GEF4 $395
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 36
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 640
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 600
+ADDRLP4 640
+INDIRF4
+ASGNF4
+ADDRLP4 644
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 644
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+ADDRLP4 600
+INDIRF4
+MULF4
+GEF4 $397
+ADDRFP4 0
+INDIRP4
+CNSTI4 6104
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CNSTF4 1097859072
+ADDRLP4 600
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $397
+LABELV $395
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 640
+ADDRGP4 trap_AAS_Swimming
+CALLI4
+ASGNI4
+ADDRLP4 640
+INDIRI4
+CNSTI4 0
+EQI4 $399
+ADDRFP4 0
+INDIRP4
+CNSTI4 6104
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+LABELV $399
+ADDRFP4 0
+INDIRP4
+CNSTI4 6144
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+LEF4 $401
+ADDRLP4 140
+ADDRLP4 0+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 648
+ADDRFP4 0
+INDIRP4
+CNSTI4 6284
+ADDP4
+ASGNP4
+ADDRLP4 648
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 648
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $402
+JUMPV
+LABELV $401
+ADDRLP4 644
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 644
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+MULF4
+GEF4 $410
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 588
+ARGP4
+ADDRGP4 BotRoamGoal
+CALLV
+pop
+ADDRLP4 140
+ADDRLP4 588
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 588+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 588+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 652
+ADDRFP4 0
+INDIRP4
+CNSTI4 6284
+ADDP4
+ASGNP4
+ADDRLP4 652
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 652
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $410
+LABELV $402
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 652
+ADDRGP4 BotGoForAir
+CALLI4
+ASGNI4
+ADDRLP4 652
+INDIRI4
+CNSTI4 0
+EQI4 $416
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6064
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $418
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $416
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $320
+LABELV $311
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $419
+ADDRLP4 0+24
+ARGP4
+ADDRLP4 628
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 152
+ADDRLP4 628
+INDIRI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $422
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 636
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 636
+INDIRI4
+CNSTI4 0
+EQI4 $422
+ADDRFP4 0
+INDIRP4
+CNSTI4 6352
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6304
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6324
+ADDP4
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6328
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6332
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6336
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6340
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6344
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6348
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+LABELV $422
+LABELV $419
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6376
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+SUBF4
+GEF4 $425
+ADDRFP4 0
+INDIRP4
+CNSTI4 6304
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 156
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 628
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $427
+ARGP4
+ADDRLP4 628
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6304
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6376
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $425
+CNSTI4 1
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $301
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $428
+ADDRFP4 0
+INDIRP4
+CNSTI4 6372
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $430
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $430
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6324
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 624
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 616
+ADDRLP4 624
+INDIRI4
+ASGNI4
+ADDRLP4 616
+INDIRI4
+CNSTI4 1000
+LEI4 $432
+ADDRFP4 0
+INDIRP4
+CNSTI4 6128
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $432
+ADDRGP4 $434
+ARGP4
+ADDRLP4 616
+INDIRI4
+ARGI4
+ADDRLP4 628
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 628
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6128
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $435
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $437
+ARGP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 632
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 632
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+ADDRLP4 636
+ADDRLP4 616
+INDIRI4
+ASGNI4
+ADDRLP4 636
+INDIRI4
+CNSTI4 0
+EQI4 $438
+ADDRLP4 636
+INDIRI4
+CNSTI4 50
+GEI4 $438
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRLP4 640
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6128
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+CNSTF4 1077936128
+ADDRLP4 640
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $438
+ADDRLP4 640
+ADDRLP4 616
+INDIRI4
+ASGNI4
+ADDRLP4 640
+INDIRI4
+CNSTI4 0
+EQI4 $440
+ADDRLP4 640
+INDIRI4
+CNSTI4 333
+GEI4 $440
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ARGP4
+CNSTF4 1128792064
+ARGF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 648
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 648
+INDIRF4
+CNSTF4 0
+EQF4 $440
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRLP4 652
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6128
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+CNSTF4 1077936128
+ADDRLP4 652
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $440
+CNSTI4 1
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $435
+ADDRGP4 $442
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6128
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 632
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 632
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+ADDRLP4 636
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 636
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+ADDRGP4 bot_thinktime+12
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+GEF4 $443
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ARGP4
+CNSTF4 1128792064
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6352
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 644
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 644
+INDIRF4
+CNSTF4 0
+EQF4 $446
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRLP4 648
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6128
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+CNSTF4 1077936128
+ADDRLP4 648
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $446
+LABELV $443
+LABELV $428
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $448
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $448
+ADDRLP4 616
+ADDRFP4 0
+INDIRP4
+CNSTI4 6368
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 616
+INDIRF4
+CNSTF4 0
+EQF4 $450
+ADDRLP4 616
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $450
+ADDRFP4 0
+INDIRP4
+CNSTI4 6356
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 192
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $452
+ARGP4
+ADDRLP4 192
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6308
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1048576
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6368
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $450
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6372
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $453
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $453
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 624
+ADDRGP4 trap_BotItemGoalInVisButNotVisible
+CALLI4
+ASGNI4
+ADDRLP4 624
+INDIRI4
+CNSTI4 0
+EQI4 $455
+ADDRFP4 0
+INDIRP4
+CNSTI4 6356
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 192
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $457
+ARGP4
+ADDRLP4 192
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6308
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $456
+JUMPV
+LABELV $455
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 628
+ADDRGP4 BotReachedGoal
+CALLI4
+ASGNI4
+ADDRLP4 628
+INDIRI4
+CNSTI4 0
+EQI4 $458
+ADDRFP4 0
+INDIRP4
+CNSTI4 6356
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 192
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $460
+ARGP4
+ADDRLP4 192
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6308
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $458
+LABELV $456
+CNSTI4 1
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $448
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $461
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 19
+NEI4 $463
+ADDRLP4 616
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 628
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 628
+INDIRI4
+CNSTI4 0
+EQI4 $467
+ADDRFP4 0
+INDIRP4
+CNSTI4 6372
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $465
+LABELV $467
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $465
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 632
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 632
+INDIRI4
+ARGI4
+ADDRLP4 636
+ADDRGP4 Team_GetFlagStatus
+CALLI4
+ASGNI4
+ADDRLP4 620
+ADDRLP4 636
+INDIRI4
+ASGNI4
+ADDRLP4 620
+INDIRI4
+CNSTI4 0
+NEI4 $468
+ADDRFP4 0
+INDIRP4
+CNSTI4 6132
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $468
+ADDRFP4 0
+INDIRP4
+CNSTI4 6132
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $470
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 640
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 640
+INDIRI4
+CNSTI4 1
+NEI4 $472
+ADDRLP4 616
+ADDRGP4 ctf_redflag
+ASGNP4
+ADDRGP4 $473
+JUMPV
+LABELV $472
+ADDRLP4 616
+ADDRGP4 ctf_blueflag
+ASGNP4
+LABELV $473
+ADDRLP4 620
+INDIRI4
+CNSTI4 0
+EQI4 $474
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 616
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 648
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 624
+ADDRLP4 648
+INDIRI4
+ASGNI4
+ADDRLP4 624
+INDIRI4
+CNSTI4 400
+GEI4 $476
+ADDRFP4 0
+INDIRP4
+CNSTI4 6132
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1106247680
+ADDF4
+ASGNF4
+LABELV $476
+LABELV $474
+ADDRGP4 numwaypoints
+INDIRI4
+CNSTI4 0
+NEI4 $478
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 616
+INDIRP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 644
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 644
+INDIRI4
+CNSTI4 0
+EQI4 $480
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 648
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 648
+INDIRI4
+CNSTI4 0
+EQI4 $482
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRLP4 652
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6132
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CNSTF4 1092616192
+ADDRLP4 652
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $483
+JUMPV
+LABELV $482
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $483
+LABELV $480
+CNSTI4 1
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $478
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 652
+ADDRGP4 BotWpValid
+CALLI4
+ASGNI4
+ADDRLP4 652
+INDIRI4
+CNSTI4 0
+NEI4 $484
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 FindWp
+CALLI4
+pop
+LABELV $484
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 656
+ADDRGP4 BotWpHasSuccessor
+CALLI4
+ASGNI4
+ADDRLP4 656
+INDIRI4
+CNSTI4 0
+NEI4 $486
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $488
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 616
+INDIRP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8448
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $486
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8444
+ADDP4
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 664
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 644
+ADDRLP4 664
+INDIRI4
+ASGNI4
+ADDRLP4 644
+INDIRI4
+CNSTI4 0
+EQI4 $490
+ADDRLP4 644
+INDIRI4
+CNSTI4 10
+GEI4 $491
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 GetNextWp
+CALLI4
+pop
+ADDRGP4 $491
+JUMPV
+LABELV $490
+ADDRFP4 0
+INDIRP4
+CNSTI4 8444
+ADDP4
+INDIRP4
+CNSTI4 72
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 672
+ADDRGP4 DistanceSquared
+CALLF4
+ASGNF4
+ADDRLP4 648
+ADDRLP4 672
+INDIRF4
+ASGNF4
+ADDRLP4 648
+INDIRF4
+CNSTF4 1193033728
+GEF4 $494
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 GetNextWp
+CALLI4
+pop
+LABELV $494
+LABELV $491
+ADDRGP4 $496
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8444
+ADDP4
+INDIRP4
+CNSTI4 128
+ADDP4
+ARGP4
+ADDRLP4 668
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 668
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8448
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8444
+ADDP4
+INDIRP4
+CNSTI4 72
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $470
+LABELV $463
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $498
+ADDRFP4 0
+INDIRP4
+CNSTI4 6372
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $500
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $500
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 620
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRLP4 620
+INDIRI4
+ARGI4
+ADDRLP4 624
+ADDRGP4 Team_GetFlagStatus
+CALLI4
+ASGNI4
+ADDRLP4 616
+ADDRLP4 624
+INDIRI4
+ASGNI4
+ADDRGP4 $502
+ARGP4
+ADDRLP4 616
+INDIRI4
+ARGI4
+ADDRLP4 628
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 628
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+ADDRLP4 616
+INDIRI4
+CNSTI4 1
+NEI4 $503
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $503
+ADDRLP4 616
+INDIRI4
+CNSTI4 4
+NEI4 $505
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 140
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 640
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 640
+INDIRF4
+CNSTF4 1111752704
+GEF4 $509
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $509
+CNSTI4 1
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $505
+ADDRGP4 numwaypoints
+INDIRI4
+CNSTI4 0
+NEI4 $511
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 636
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 632
+ADDRLP4 636
+INDIRI4
+ASGNI4
+ADDRLP4 632
+INDIRI4
+CNSTI4 1
+EQI4 $516
+ADDRLP4 632
+INDIRI4
+CNSTI4 2
+EQI4 $517
+ADDRGP4 $513
+JUMPV
+LABELV $516
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $512
+JUMPV
+LABELV $517
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $512
+JUMPV
+LABELV $513
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $511
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 640
+ADDRGP4 BotWpValid
+CALLI4
+ASGNI4
+ADDRLP4 640
+INDIRI4
+CNSTI4 0
+NEI4 $518
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 FindWp
+CALLI4
+pop
+LABELV $518
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 644
+ADDRGP4 BotWpHasSuccessor
+CALLI4
+ASGNI4
+ADDRLP4 644
+INDIRI4
+CNSTI4 0
+NEI4 $520
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $488
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 648
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 648
+INDIRI4
+CNSTI4 1
+NEI4 $522
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $523
+JUMPV
+LABELV $522
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $523
+ADDRFP4 0
+INDIRP4
+CNSTI4 8448
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $520
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8444
+ADDP4
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 652
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 632
+ADDRLP4 652
+INDIRI4
+ASGNI4
+ADDRLP4 632
+INDIRI4
+CNSTI4 0
+EQI4 $525
+ADDRLP4 632
+INDIRI4
+CNSTI4 10
+GEI4 $526
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 GetNextWp
+CALLI4
+pop
+ADDRGP4 $526
+JUMPV
+LABELV $525
+ADDRFP4 0
+INDIRP4
+CNSTI4 8444
+ADDP4
+INDIRP4
+CNSTI4 72
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 660
+ADDRGP4 DistanceSquared
+CALLF4
+ASGNF4
+ADDRLP4 636
+ADDRLP4 660
+INDIRF4
+ASGNF4
+ADDRLP4 636
+INDIRF4
+CNSTF4 1193033728
+GEF4 $529
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 GetNextWp
+CALLI4
+pop
+LABELV $529
+LABELV $526
+ADDRGP4 $496
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8444
+ADDP4
+INDIRP4
+CNSTI4 128
+ADDP4
+ARGP4
+ADDRLP4 656
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 656
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8448
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8444
+ADDP4
+INDIRP4
+CNSTI4 72
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $512
+CNSTI4 1
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $498
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 20
+NEI4 $532
+ADDRFP4 0
+INDIRP4
+CNSTI4 6372
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $534
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $534
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 620
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 620
+INDIRI4
+ARGI4
+ADDRLP4 624
+ADDRGP4 Team_GetFlagStatus
+CALLI4
+ASGNI4
+ADDRLP4 616
+ADDRLP4 624
+INDIRI4
+ASGNI4
+ADDRLP4 616
+INDIRI4
+CNSTI4 4
+EQI4 $536
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $536
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $532
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 21
+NEI4 $538
+ADDRFP4 0
+INDIRP4
+CNSTI4 6372
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $540
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $540
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ARGP4
+ADDRLP4 620
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 620
+INDIRI4
+CNSTI4 0
+EQI4 $542
+ADDRLP4 624
+CNSTI4 76
+ADDRFP4 0
+INDIRP4
+CNSTI4 6304
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 boomiespots+56
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ADDRLP4 624
+INDIRB
+ASGNB 12
+ADDRLP4 648
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+ASGNP4
+ADDRLP4 648
+INDIRP4
+ADDRLP4 648
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 656
+ADDRGP4 AngleDifference
+CALLF4
+ASGNF4
+ADDRLP4 636
+ADDRLP4 656
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6268
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6280
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 664
+ADDRGP4 AngleDifference
+CALLF4
+ASGNF4
+ADDRLP4 640
+ADDRLP4 664
+INDIRF4
+ASGNF4
+ADDRLP4 668
+CNSTF4 1084227584
+ASGNF4
+ADDRLP4 636
+INDIRF4
+ADDRLP4 668
+INDIRF4
+GEF4 $543
+ADDRLP4 640
+INDIRF4
+ADDRLP4 668
+INDIRF4
+GEF4 $543
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $547
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRGP4 $543
+JUMPV
+LABELV $542
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $548
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+LABELV $543
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $538
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 22
+NEI4 $549
+ADDRFP4 0
+INDIRP4
+CNSTI4 6372
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $551
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $551
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ARGP4
+ADDRLP4 620
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 620
+INDIRI4
+CNSTI4 0
+EQI4 $553
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $547
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRGP4 $554
+JUMPV
+LABELV $553
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $548
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+LABELV $554
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $549
+LABELV $461
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $555
+ADDRFP4 0
+INDIRP4
+CNSTI4 6372
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $557
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $557
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 616
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 616
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ARGP4
+ADDRLP4 620
+ADDRGP4 IsMyBalloon
+CALLI4
+ASGNI4
+ADDRLP4 620
+INDIRI4
+CNSTI4 0
+EQI4 $559
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $559
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 140
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 632
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 632
+INDIRF4
+CNSTF4 1163984896
+GEF4 $563
+ADDRLP4 636
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 636
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+MULF4
+GEF4 $565
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 588
+ARGP4
+ADDRGP4 BotRoamGoal
+CALLV
+pop
+ADDRLP4 140
+ADDRLP4 588
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 588+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 588+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 644
+ADDRFP4 0
+INDIRP4
+CNSTI4 6284
+ADDP4
+ASGNP4
+ADDRLP4 644
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 644
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $565
+ADDRFP4 0
+INDIRP4
+CNSTI4 6104
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+SUBF4
+GEF4 $571
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 36
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 640
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 600
+ADDRLP4 640
+INDIRF4
+ASGNF4
+ADDRLP4 644
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 644
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+ADDRLP4 600
+INDIRF4
+MULF4
+GEF4 $573
+ADDRFP4 0
+INDIRP4
+CNSTI4 6104
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CNSTF4 1097859072
+ADDRLP4 600
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $573
+LABELV $571
+ADDRFP4 0
+INDIRP4
+CNSTI4 6104
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $575
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Crouch
+CALLV
+pop
+LABELV $575
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 640
+ADDRGP4 trap_AAS_Swimming
+CALLI4
+ASGNI4
+ADDRLP4 640
+INDIRI4
+CNSTI4 0
+EQI4 $577
+ADDRFP4 0
+INDIRP4
+CNSTI4 6104
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+LABELV $577
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 648
+ADDRGP4 trap_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 648
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $579
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $579
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $563
+CNSTI4 1
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $555
+ADDRLP4 616
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 616
+INDIRI4
+CNSTI4 7
+EQI4 $583
+ADDRLP4 616
+INDIRI4
+CNSTI4 3
+NEI4 $581
+LABELV $583
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $584
+ADDRFP4 0
+INDIRP4
+CNSTI4 5140
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $586
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $586
+ADDRFP4 0
+INDIRP4
+CNSTI4 8364
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $588
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 624
+ADDRGP4 BotChooseCorrectWall
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8364
+ADDP4
+ADDRLP4 624
+INDIRP4
+ASGNP4
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $590
+ADDRGP4 $593
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $590
+LABELV $588
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8364
+ADDP4
+INDIRP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 620
+ADDRGP4 IsWall
+CALLI4
+ASGNI4
+ADDRLP4 620
+INDIRI4
+CNSTI4 0
+EQI4 $594
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChooseWeapon
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAimAtEnemy
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 624
+ADDRGP4 BotSprayWallCheckAttack
+CALLI4
+ASGNI4
+ADDRLP4 624
+INDIRI4
+CNSTI4 0
+EQI4 $596
+ADDRLP4 628
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 628+4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 628+8
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 628
+ARGP4
+ADDRLP4 648
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 648
+INDIRF4
+CNSTF4 1163984896
+GEF4 $595
+ADDRFP4 0
+INDIRP4
+CNSTI4 8368
+ADDP4
+CNSTF4 0
+ASGNF4
+CNSTI4 0
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $596
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 SelfTeamGoal
+CALLV
+pop
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $595
+JUMPV
+LABELV $594
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 624
+ADDRGP4 BotClientTravelTimeToGoal
+CALLI4
+ASGNI4
+ADDRLP4 624
+INDIRI4
+CNSTI4 0
+NEI4 $602
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 spraytele
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $602
+LABELV $595
+CNSTI4 1
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $584
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 13
+NEI4 $582
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 outtele
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 620
+ADDRGP4 BotClientTravelTimeToGoal
+CALLI4
+ASGNI4
+ADDRLP4 620
+INDIRI4
+CNSTI4 0
+NEI4 $606
+ADDRLP4 624
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 624+4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 624+8
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 624
+ARGP4
+CNSTF4 1134559232
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+pop
+LABELV $606
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CNSTI4 4194304
+BANDI4
+CNSTI4 0
+EQI4 $610
+ADDRLP4 624
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 624
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1060320051
+GEF4 $611
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Gesture
+CALLV
+pop
+ADDRGP4 $611
+JUMPV
+LABELV $610
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CNSTI4 2097152
+BANDI4
+CNSTI4 0
+EQI4 $614
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Gesture
+CALLV
+pop
+LABELV $614
+LABELV $611
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 624
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 624
+INDIRI4
+CNSTI4 0
+NEI4 $618
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 628
+ADDRGP4 ClientInSprayroom
+CALLI4
+ASGNI4
+ADDRLP4 628
+INDIRI4
+CNSTI4 0
+NEI4 $616
+LABELV $618
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+CNSTI4 -1
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $616
+CNSTI4 1
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $581
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 8
+NEI4 $619
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 13
+NEI4 $619
+ADDRFP4 0
+INDIRP4
+CNSTI4 6136
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $619
+ADDRLP4 624
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ARGP4
+ADDRLP4 632
+ADDRGP4 BotClientTravelTimeToGoal
+CALLI4
+ASGNI4
+ADDRLP4 632
+INDIRI4
+CNSTI4 150
+GEI4 $621
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 640
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 900
+ADDRGP4 BotGetTeammates
+CALLI4
+ASGNI4
+ADDRLP4 896
+ADDRLP4 900
+INDIRI4
+ASGNI4
+ADDRLP4 636
+CNSTI4 0
+ASGNI4
+ADDRGP4 $626
+JUMPV
+LABELV $623
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 636
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 640
+ADDP4
+INDIRI4
+NEI4 $627
+ADDRGP4 $624
+JUMPV
+LABELV $627
+ADDRLP4 636
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 640
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 904
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 904
+INDIRI4
+CNSTI4 0
+NEI4 $629
+ADDRGP4 $624
+JUMPV
+LABELV $629
+ADDRLP4 1044
+ADDRLP4 904+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1044+4
+ADDRLP4 904+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6316
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1044+8
+ADDRLP4 904+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6320
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1044
+ARGP4
+ADDRLP4 1060
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 1060
+INDIRF4
+CNSTF4 1170735104
+GEF4 $638
+ADDRLP4 624
+CNSTI4 1
+ASGNI4
+ADDRLP4 1064
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1068
+CNSTF4 1073741824
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6136
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 1068
+INDIRF4
+ADDF4
+ADDRLP4 1068
+INDIRF4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $625
+JUMPV
+LABELV $638
+LABELV $624
+ADDRLP4 636
+ADDRLP4 636
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $626
+ADDRLP4 636
+INDIRI4
+ADDRLP4 896
+INDIRI4
+LTI4 $623
+LABELV $625
+LABELV $621
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $640
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+ADDRLP4 624
+INDIRI4
+CNSTI4 0
+NEI4 $641
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $641
+LABELV $619
+LABELV $582
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 14
+NEI4 $643
+ADDRFP4 0
+INDIRP4
+CNSTI4 5072
+ADDP4
+INDIRI4
+CNSTI4 832
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRI4
+LTI4 $645
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6380
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $645
+CNSTI4 832
+CNSTI4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 6380
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 hstations-56+40
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+744
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $648
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6380
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $648
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTI4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 6380
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 hstations-56
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $643
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 624
+ADDRGP4 BotGetItemLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 624
+INDIRI4
+RETI4
+LABELV $227
+endproc BotGetLongTermGoal 1072 20
+export BotLongTermGoal
+proc BotLongTermGoal 4 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotGetLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $654
+endproc BotLongTermGoal 4 16
+proc AINode_Intermission 16 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $656
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotChat_StartLevel
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $658
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 6088
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $659
+JUMPV
+LABELV $658
+ADDRFP4 0
+INDIRP4
+CNSTI4 6088
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ASGNF4
+LABELV $659
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $660
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+LABELV $656
+CNSTI4 1
+RETI4
+LABELV $655
+endproc AINode_Intermission 16 8
+proc AIEnter_Intermission 8 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $662
+ARGP4
+ADDRGP4 $99
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotResetState
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotChat_EndLevel
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $663
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6044
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $663
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRGP4 AINode_Intermission
+ASGNP4
+LABELV $661
+endproc AIEnter_Intermission 8 16
+proc AINode_Observer 4 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $666
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $668
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+LABELV $666
+CNSTI4 1
+RETI4
+LABELV $665
+endproc AINode_Observer 4 8
+proc AIEnter_Observer 0 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $670
+ARGP4
+ADDRGP4 $99
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotResetState
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRGP4 AINode_Observer
+ASGNP4
+LABELV $669
+endproc AIEnter_Observer 0 16
+proc AINode_Stand 24 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6036
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5072
+ADDP4
+INDIRI4
+LEI4 $672
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotChat_HitTalking
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $674
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6096
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+CNSTF4 1036831949
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6088
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDF4
+CNSTF4 1036831949
+ADDF4
+ASGNF4
+LABELV $674
+LABELV $672
+ADDRFP4 0
+INDIRP4
+CNSTI4 6096
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $676
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $678
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $680
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $671
+JUMPV
+LABELV $678
+ADDRFP4 0
+INDIRP4
+CNSTI4 6096
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+LABELV $676
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Talk
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6088
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $681
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6044
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $683
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $671
+JUMPV
+LABELV $681
+CNSTI4 1
+RETI4
+LABELV $671
+endproc AINode_Stand 24 12
+export AIEnter_Stand
+proc AIEnter_Stand 0 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $685
+ARGP4
+ADDRGP4 $99
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6096
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRGP4 AINode_Stand
+ASGNP4
+LABELV $684
+endproc AIEnter_Stand 0 16
+proc AIEnter_Respawn 12 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $687
+ARGP4
+ADDRGP4 $99
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetMoveState
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetGoalState
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotChat_Death
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $688
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6072
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $689
+JUMPV
+LABELV $688
+ADDRLP4 4
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6072
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $689
+ADDRFP4 0
+INDIRP4
+CNSTI4 5984
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRGP4 AINode_Respawn
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6372
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $686
+endproc AIEnter_Respawn 12 16
+export AINode_Respawn
+proc AINode_Respawn 4 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5984
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $691
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $693
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $695
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+ADDRGP4 $692
+JUMPV
+LABELV $693
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Respawn
+CALLV
+pop
+ADDRGP4 $692
+JUMPV
+LABELV $691
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $696
+ADDRFP4 0
+INDIRP4
+CNSTI4 5984
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Respawn
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6072
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $698
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6044
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $698
+LABELV $696
+LABELV $692
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6072
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+EQF4 $700
+ADDRLP4 0
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1056964608
+SUBF4
+GEF4 $700
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Talk
+CALLV
+pop
+LABELV $700
+CNSTI4 1
+RETI4
+LABELV $690
+endproc AINode_Respawn 4 12
+export BotSelectActivateWeapon
+proc BotSelectActivateWeapon 56 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4972
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LEI4 $703
+ADDRFP4 0
+INDIRP4
+CNSTI4 5024
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LEI4 $703
+CNSTI4 2
+RETI4
+ADDRGP4 $702
+JUMPV
+LABELV $703
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4976
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LEI4 $705
+ADDRFP4 0
+INDIRP4
+CNSTI4 5028
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LEI4 $705
+CNSTI4 3
+RETI4
+ADDRGP4 $702
+JUMPV
+LABELV $705
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4996
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LEI4 $707
+ADDRFP4 0
+INDIRP4
+CNSTI4 5048
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LEI4 $707
+CNSTI4 8
+RETI4
+ADDRGP4 $702
+JUMPV
+LABELV $707
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4988
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LEI4 $709
+ADDRFP4 0
+INDIRP4
+CNSTI4 5040
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LEI4 $709
+CNSTI4 6
+RETI4
+ADDRGP4 $702
+JUMPV
+LABELV $709
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 4992
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LEI4 $711
+ADDRLP4 32
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LEI4 $711
+CNSTI4 7
+RETI4
+ADDRGP4 $702
+JUMPV
+LABELV $711
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4984
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LEI4 $713
+ADDRFP4 0
+INDIRP4
+CNSTI4 5036
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LEI4 $713
+CNSTI4 5
+RETI4
+ADDRGP4 $702
+JUMPV
+LABELV $713
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 5000
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LEI4 $715
+ADDRLP4 48
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LEI4 $715
+CNSTI4 9
+RETI4
+ADDRGP4 $702
+JUMPV
+LABELV $715
+CNSTI4 -1
+RETI4
+LABELV $702
+endproc BotSelectActivateWeapon 56 0
+export AIEnter_Seek_ActivateEntity
+proc AIEnter_Seek_ActivateEntity 0 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $718
+ARGP4
+ADDRGP4 $99
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRGP4 AINode_Seek_ActivateEntity
+ASGNP4
+LABELV $717
+endproc AIEnter_Seek_ActivateEntity 0 16
+export AINode_Seek_ActivateEntity
+proc AINode_Seek_ActivateEntity 376 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 320
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 0
+EQI4 $720
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $722
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $719
+JUMPV
+LABELV $720
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 324
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+EQI4 $723
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $725
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $719
+JUMPV
+LABELV $723
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 328
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 328
+INDIRI4
+CNSTI4 0
+EQI4 $726
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $728
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $719
+JUMPV
+LABELV $726
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+CNSTI4 18616254
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 332
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 332
+INDIRI4
+CNSTI4 0
+EQI4 $729
+ADDRLP4 336
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 336
+INDIRP4
+ADDRLP4 336
+INDIRP4
+INDIRI4
+CNSTI4 6291456
+BORI4
+ASGNI4
+LABELV $729
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $731
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $733
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $719
+JUMPV
+LABELV $731
+ADDRLP4 340
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+ASGNP4
+ADDRLP4 52
+ADDRLP4 340
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 344
+CNSTI4 0
+ASGNI4
+ADDRLP4 68
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRLP4 340
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ADDRLP4 344
+INDIRI4
+EQI4 $734
+ADDRLP4 72
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRLP4 352
+CNSTP4 0
+ASGNP4
+ADDRLP4 352
+INDIRP4
+ARGP4
+ADDRLP4 352
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+INDIRP4
+CNSTI4 80
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 72+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $740
+ADDRLP4 72+80
+INDIRI4
+ADDRLP4 52
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $736
+LABELV $740
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+NEI4 $741
+ADDRLP4 364
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 364
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 364
+INDIRP4
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRLP4 308
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ARGP4
+CNSTF4 1101004800
+ARGF4
+ADDRLP4 308
+ARGP4
+ADDRLP4 372
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 372
+INDIRI4
+CNSTI4 0
+EQI4 $745
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+LABELV $745
+LABELV $741
+LABELV $736
+LABELV $734
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $747
+ADDRLP4 52
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 156
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+NEI4 $749
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $751
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $719
+JUMPV
+LABELV $749
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+ADDRLP4 156+24
+ARGP4
+ADDRLP4 348
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 348
+INDIRI4
+CNSTI4 0
+NEI4 $752
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $752
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $755
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotPopFromActivateGoalStack
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $757
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+CNSTI4 0
+RETI4
+ADDRGP4 $719
+JUMPV
+LABELV $757
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $759
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $719
+JUMPV
+LABELV $755
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 52
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $748
+JUMPV
+LABELV $747
+ADDRLP4 52
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $760
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $761
+JUMPV
+LABELV $760
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $762
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 348
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 348
+INDIRI4
+CNSTI4 0
+EQI4 $764
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $764
+LABELV $762
+LABELV $761
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $766
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotPopFromActivateGoalStack
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $768
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+CNSTI4 0
+RETI4
+ADDRGP4 $719
+JUMPV
+LABELV $768
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $770
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $719
+JUMPV
+LABELV $766
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 348
+ADDRGP4 BotAIPredictObstacles
+CALLI4
+ASGNI4
+ADDRLP4 348
+INDIRI4
+CNSTI4 0
+EQI4 $771
+CNSTI4 0
+RETI4
+ADDRGP4 $719
+JUMPV
+LABELV $771
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $773
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $773
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+LABELV $748
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $775
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $777
+ADDRLP4 352
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 352
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 352
+INDIRP4
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRLP4 0+40
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 0+20
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $777
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+NEI4 $784
+ADDRLP4 0+20
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 352
+ADDRGP4 BotSelectActivateWeapon
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 352
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $788
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $788
+ADDRLP4 0+24
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $784
+LABELV $775
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 11
+BANDI4
+CNSTI4 0
+EQI4 $791
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ADDRLP4 0+40
+INDIRB
+ASGNB 12
+ADDRGP4 $792
+JUMPV
+LABELV $791
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $795
+ADDRLP4 348
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 348
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+MULF4
+GEF4 $796
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+ARGP4
+ADDRGP4 BotRoamGoal
+CALLV
+pop
+ADDRLP4 56
+ADDRLP4 296
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 296+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+8
+ADDRLP4 296+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 356
+ADDRFP4 0
+INDIRP4
+CNSTI4 6284
+ADDP4
+ASGNP4
+ADDRLP4 356
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 356
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $796
+JUMPV
+LABELV $795
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $804
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 296
+ARGP4
+ADDRLP4 352
+ADDRGP4 trap_BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 0
+EQI4 $806
+ADDRLP4 56
+ADDRLP4 296
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 296+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+8
+ADDRLP4 296+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $807
+JUMPV
+LABELV $806
+ADDRLP4 0+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+LABELV $807
+ADDRLP4 356
+ADDRFP4 0
+INDIRP4
+CNSTI4 6284
+ADDP4
+ASGNP4
+ADDRLP4 356
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 356
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $804
+LABELV $796
+LABELV $792
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $813
+ADDRFP4 0
+INDIRP4
+CNSTI4 6260
+ADDP4
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+LABELV $813
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 348
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 348
+INDIRI4
+CNSTI4 0
+EQI4 $817
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 352
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 0
+EQI4 $819
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $821
+ARGP4
+ADDRGP4 AIEnter_Battle_NBG
+CALLV
+pop
+ADDRGP4 $820
+JUMPV
+LABELV $819
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEmptyGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $821
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+LABELV $820
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+LABELV $817
+CNSTI4 1
+RETI4
+LABELV $719
+endproc AINode_Seek_ActivateEntity 376 28
+export AIEnter_Seek_NBG
+proc AIEnter_Seek_NBG 204 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 200
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+EQI4 $823
+ADDRLP4 0+44
+INDIRI4
+ARGI4
+ADDRLP4 56
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $826
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRGP4 $824
+JUMPV
+LABELV $823
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $826
+ARGP4
+ADDRGP4 $827
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+LABELV $824
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRGP4 AINode_Seek_NBG
+ASGNP4
+LABELV $822
+endproc AIEnter_Seek_NBG 204 16
+export AINode_Seek_NBG
+proc AINode_Seek_NBG 184 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+EQI4 $829
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $831
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $828
+JUMPV
+LABELV $829
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+EQI4 $832
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $834
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $828
+JUMPV
+LABELV $832
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $835
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $837
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $828
+JUMPV
+LABELV $835
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+CNSTI4 18616254
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $838
+ADDRLP4 148
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ADDRLP4 148
+INDIRP4
+INDIRI4
+CNSTI4 6291456
+BORI4
+ASGNI4
+LABELV $838
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 152
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+NEI4 $840
+ADDRFP4 0
+INDIRP4
+CNSTI4 6064
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $841
+JUMPV
+LABELV $840
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 156
+ADDRGP4 BotReachedGoal
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $842
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChooseWeapon
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6064
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $842
+LABELV $841
+ADDRFP4 0
+INDIRP4
+CNSTI4 6064
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $844
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotPopGoal
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6084
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1028443341
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $846
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $828
+JUMPV
+LABELV $844
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 160
+ADDRGP4 BotAIPredictObstacles
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+EQI4 $847
+CNSTI4 0
+RETI4
+ADDRGP4 $828
+JUMPV
+LABELV $847
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $849
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6064
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $849
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 11
+BANDI4
+CNSTI4 0
+EQI4 $851
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ADDRLP4 0+40
+INDIRB
+ASGNB 12
+ADDRGP4 $852
+JUMPV
+LABELV $851
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $855
+ADDRLP4 168
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+MULF4
+GEF4 $856
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 108
+ARGP4
+ADDRGP4 BotRoamGoal
+CALLV
+pop
+ADDRLP4 120
+ADDRLP4 108
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120+4
+ADDRLP4 108+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120+8
+ADDRLP4 108+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 176
+ADDRFP4 0
+INDIRP4
+CNSTI4 6284
+ADDP4
+ASGNP4
+ADDRLP4 176
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 176
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $856
+JUMPV
+LABELV $855
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $864
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 168
+ADDRGP4 trap_BotGetSecondGoal
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+NEI4 $866
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+pop
+LABELV $866
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 108
+ARGP4
+ADDRLP4 176
+ADDRGP4 trap_BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+EQI4 $868
+ADDRLP4 120
+ADDRLP4 108
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120+4
+ADDRLP4 108+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120+8
+ADDRLP4 108+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $869
+JUMPV
+LABELV $868
+ADDRLP4 0+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+LABELV $869
+ADDRLP4 180
+ADDRFP4 0
+INDIRP4
+CNSTI4 6284
+ADDP4
+ASGNP4
+ADDRLP4 180
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 180
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $864
+LABELV $856
+LABELV $852
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $875
+ADDRFP4 0
+INDIRP4
+CNSTI4 6260
+ADDP4
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+LABELV $875
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 168
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+EQI4 $879
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $881
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $883
+ARGP4
+ADDRGP4 AIEnter_Battle_NBG
+CALLV
+pop
+ADDRGP4 $882
+JUMPV
+LABELV $881
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEmptyGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $883
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+LABELV $882
+LABELV $879
+CNSTI4 1
+RETI4
+LABELV $828
+endproc AINode_Seek_NBG 184 20
+export BotDefendsCapturedBalloon
+proc BotDefendsCapturedBalloon 16 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 8
+NEI4 $887
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $885
+LABELV $887
+CNSTI4 0
+RETI4
+ADDRGP4 $884
+JUMPV
+LABELV $885
+ADDRLP4 4
+CNSTI4 832
+ADDRFP4 0
+INDIRP4
+CNSTI4 6352
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+772
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+52
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $893
+ADDRLP4 0
+INDIRI4
+CNSTI4 49
+EQI4 $892
+LABELV $893
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+NEI4 $890
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+NEI4 $890
+LABELV $892
+CNSTI4 1
+RETI4
+ADDRGP4 $884
+JUMPV
+LABELV $890
+CNSTI4 0
+RETI4
+LABELV $884
+endproc BotDefendsCapturedBalloon 16 4
+export CheckHealth
+proc CheckHealth 52 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 99999
+ASGNI4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 5072
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 832
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8388
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $896
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $894
+ADDRFP4 0
+INDIRP4
+CNSTI4 6380
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $894
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 14
+ASGNI4
+ADDRGP4 $894
+JUMPV
+LABELV $896
+ADDRFP4 0
+INDIRP4
+CNSTI4 8388
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $900
+ADDRLP4 36
+INDIRI4
+CNSTI4 14
+EQI4 $900
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 BotDefendsCapturedBalloon
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $900
+ADDRGP4 $894
+JUMPV
+LABELV $900
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LTI4 $902
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6380
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $894
+JUMPV
+LABELV $902
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $907
+JUMPV
+LABELV $904
+CNSTI4 832
+CNSTI4 56
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 hstations+40
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+744
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $908
+ADDRGP4 $905
+JUMPV
+LABELV $908
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 56
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 hstations
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 BotClientTravelTimeToGoal
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $912
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+GEI4 $912
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $912
+LABELV $905
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $907
+ADDRLP4 0
+INDIRI4
+ADDRGP4 num_hstations
+INDIRI4
+LTI4 $904
+ADDRLP4 44
+ADDRLP4 20
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 24
+CNSTF4 1050253722
+ADDRLP4 44
+INDIRI4
+ADDRLP4 44
+INDIRI4
+MULI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 48
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24
+ADDRLP4 24
+INDIRF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 48
+INDIRF4
+GEF4 $914
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6380
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $915
+JUMPV
+LABELV $914
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 14
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6380
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $915
+LABELV $894
+endproc CheckHealth 52 8
+export BotStateForEntNum
+proc BotStateForEntNum 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 832
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_entities+520
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $924
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $924
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 4
+INDIRI4
+NEI4 $917
+LABELV $924
+CNSTP4 0
+RETP4
+ADDRGP4 $916
+JUMPV
+LABELV $917
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+RETP4
+LABELV $916
+endproc BotStateForEntNum 8 0
+export Pos2Goal
+proc Pos2Goal 4 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+LABELV $925
+endproc Pos2Goal 4 4
+export BotCamMoveTo
+proc BotCamMoveTo 8 8
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotStateForEntNum
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $927
+ADDRGP4 $926
+JUMPV
+LABELV $927
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ARGP4
+ADDRGP4 Pos2Goal
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6324
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $929
+ADDRGP4 $926
+JUMPV
+LABELV $929
+ADDRLP4 0
+INDIRP4
+CNSTI4 8412
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $926
+endproc BotCamMoveTo 8 8
+export BotCamTaunt
+proc BotCamTaunt 8 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotStateForEntNum
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8416
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $931
+endproc BotCamTaunt 8 4
+export BotCamFire
+proc BotCamFire 8 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotStateForEntNum
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8420
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $932
+endproc BotCamFire 8 4
+export BotChooseWeap
+proc BotChooseWeap 8 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotStateForEntNum
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6260
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+LABELV $933
+endproc BotChooseWeap 8 4
+export BotCamViewEntitiy
+proc BotCamViewEntitiy 8 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotStateForEntNum
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8424
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8428
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+LABELV $934
+endproc BotCamViewEntitiy 8 4
+export BotCamViewTarget
+proc BotCamViewTarget 28 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 BotStateForEntNum
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8424
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8432
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+LABELV $935
+endproc BotCamViewTarget 28 8
+export BotCamViewangles
+proc BotCamViewangles 8 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotStateForEntNum
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8424
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8432
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+LABELV $938
+endproc BotCamViewangles 8 4
+export AINode_Cam
+proc AINode_Cam 104 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8416
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $940
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Gesture
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8416
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $940
+ADDRFP4 0
+INDIRP4
+CNSTI4 8420
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $942
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8420
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $942
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8412
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $945
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $948
+ADDRGP4 $945
+JUMPV
+LABELV $948
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 32
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ARGP4
+CNSTI4 18616254
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ARGP4
+CNSTI4 18616254
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 8
+ARGP4
+ADDRLP4 92
+ADDRGP4 trap_BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+EQI4 $949
+ADDRLP4 20
+ADDRLP4 8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20+4
+ADDRLP4 8+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20+8
+ADDRLP4 8+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+LABELV $949
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+EQI4 $945
+ADDRFP4 0
+INDIRP4
+CNSTI4 8412
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $945
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8424
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $957
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+GTI4 $957
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $965
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $965
+address $958
+address $961
+address $964
+address $964
+code
+LABELV $961
+ADDRFP4 0
+INDIRP4
+CNSTI4 8428
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 BotStateForEntNum
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 40
+CNSTI4 4908
+ASGNI4
+ADDRLP4 20
+ADDRLP4 36
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 48
+CNSTI4 4912
+ASGNI4
+ADDRLP4 20+4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 52
+CNSTI4 4916
+ASGNI4
+ADDRLP4 20+8
+ADDRLP4 16
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $958
+JUMPV
+LABELV $964
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8432
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $957
+LABELV $958
+CNSTI4 1
+RETI4
+LABELV $939
+endproc AINode_Cam 104 20
+export AIEnter_Seek_LTG
+proc AIEnter_Seek_LTG 204 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 200
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+EQI4 $967
+ADDRLP4 0+44
+INDIRI4
+ARGI4
+ADDRLP4 56
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $970
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRGP4 $968
+JUMPV
+LABELV $967
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $970
+ARGP4
+ADDRGP4 $827
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+LABELV $968
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRGP4 AINode_Seek_LTG
+ASGNP4
+LABELV $966
+endproc AIEnter_Seek_LTG 204 16
+export AINode_Seek_LTG
+proc AINode_Seek_LTG 280 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+EQI4 $972
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $974
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $971
+JUMPV
+LABELV $972
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $975
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $977
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $971
+JUMPV
+LABELV $975
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $978
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $980
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $971
+JUMPV
+LABELV $978
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 BotChat_Random
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $981
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6088
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 156
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $983
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $971
+JUMPV
+LABELV $981
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+CNSTI4 18616254
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $984
+ADDRLP4 156
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ADDRLP4 156
+INDIRP4
+INDIRI4
+CNSTI4 6291456
+BORI4
+ASGNI4
+LABELV $984
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 160
+ADDRGP4 IsWall
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+NEI4 $986
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $986
+ADDRFP4 0
+INDIRP4
+CNSTI4 6140
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+LEF4 $988
+ADDRLP4 164
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1065353216
+ADDRFP4 0
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+MULF4
+GEF4 $990
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Gesture
+CALLV
+pop
+LABELV $990
+LABELV $988
+ADDRLP4 168
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ADDRLP4 168
+INDIRI4
+NEI4 $992
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 168
+INDIRI4
+ARGI4
+ADDRLP4 172
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $992
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 176
+ADDRGP4 IsWall
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+NEI4 $992
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+EQI4 $994
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $996
+ARGP4
+ADDRGP4 AIEnter_Battle_Retreat
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $971
+JUMPV
+LABELV $994
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEmptyGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $996
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $971
+JUMPV
+LABELV $992
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotTeamGoals
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CheckHealth
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8392
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 184
+ADDRGP4 BotLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+NEI4 $997
+CNSTI4 1
+RETI4
+ADDRGP4 $971
+JUMPV
+LABELV $997
+ADDRFP4 0
+INDIRP4
+CNSTI4 8392
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $999
+CNSTI4 1
+RETI4
+ADDRGP4 $971
+JUMPV
+LABELV $999
+ADDRFP4 0
+INDIRP4
+CNSTI4 6084
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1001
+ADDRFP4 0
+INDIRP4
+CNSTI4 6084
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1003
+ADDRLP4 108
+CNSTI4 400
+ASGNI4
+ADDRGP4 $1004
+JUMPV
+LABELV $1003
+ADDRLP4 108
+CNSTI4 150
+ASGNI4
+LABELV $1004
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 8
+NEI4 $1005
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $1007
+ADDRLP4 108
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1008
+JUMPV
+LABELV $1007
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 13
+NEI4 $1009
+ADDRLP4 108
+CNSTI4 50
+ASGNI4
+ADDRGP4 $1010
+JUMPV
+LABELV $1009
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1011
+ADDRLP4 108
+CNSTI4 100
+ASGNI4
+LABELV $1011
+LABELV $1010
+LABELV $1008
+LABELV $1005
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 19
+NEI4 $1013
+ADDRLP4 108
+CNSTI4 20
+ASGNI4
+LABELV $1013
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 52+12
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 196
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 188
+ADDRLP4 196
+INDIRI4
+ASGNI4
+ADDRLP4 200
+ADDRLP4 188
+INDIRI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+EQI4 $1016
+ADDRLP4 200
+INDIRI4
+ADDRLP4 108
+INDIRI4
+GEI4 $1016
+ADDRLP4 108
+ADDRLP4 188
+INDIRI4
+ASGNI4
+LABELV $1016
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 108
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 208
+ADDRGP4 BotNearbyGoal
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+EQI4 $1018
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 212
+ARGP4
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 212+12
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 276
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 268
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $1021
+ADDRGP4 $1024
+ARGP4
+ADDRLP4 268
+INDIRI4
+ARGI4
+ADDRLP4 188
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $1021
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6064
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+CNSTF4 1008981770
+ADDRLP4 108
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1025
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $971
+JUMPV
+LABELV $1018
+LABELV $1001
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 188
+ADDRGP4 BotAIPredictObstacles
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+EQI4 $1026
+CNSTI4 0
+RETI4
+ADDRGP4 $971
+JUMPV
+LABELV $1026
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1028
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6060
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1028
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 11
+BANDI4
+CNSTI4 0
+EQI4 $1030
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ADDRLP4 0+40
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1034
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+ADDRGP4 $1031
+JUMPV
+LABELV $1030
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1035
+ADDRLP4 196
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+MULF4
+GEF4 $1036
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1040
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRGP4 BotRoamGoal
+CALLV
+pop
+ADDRLP4 124
+ADDRLP4 112
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 112+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 112+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 204
+ADDRFP4 0
+INDIRP4
+CNSTI4 6284
+ADDP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 204
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $1036
+JUMPV
+LABELV $1035
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $1045
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1047
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 112
+ARGP4
+ADDRLP4 200
+ADDRGP4 trap_BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+EQI4 $1048
+ADDRLP4 124
+ADDRLP4 112
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 112+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 112+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $1049
+JUMPV
+LABELV $1048
+ADDRLP4 0+28
+ARGP4
+ADDRLP4 204
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 204
+INDIRF4
+CNSTF4 0
+EQF4 $1054
+ADDRLP4 0+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $1055
+JUMPV
+LABELV $1054
+ADDRLP4 208
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+MULF4
+GEF4 $1058
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRGP4 BotRoamGoal
+CALLV
+pop
+ADDRLP4 124
+ADDRLP4 112
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 112+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 112+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 216
+ADDRFP4 0
+INDIRP4
+CNSTI4 6284
+ADDP4
+ASGNP4
+ADDRLP4 216
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 216
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1058
+LABELV $1055
+LABELV $1049
+ADDRLP4 212
+ADDRFP4 0
+INDIRP4
+CNSTI4 6284
+ADDP4
+ASGNP4
+ADDRLP4 212
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 212
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $1046
+JUMPV
+LABELV $1045
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1064
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+LABELV $1046
+LABELV $1036
+LABELV $1031
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1065
+ADDRFP4 0
+INDIRP4
+CNSTI4 6260
+ADDP4
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+LABELV $1065
+CNSTI4 1
+RETI4
+LABELV $971
+endproc AINode_Seek_LTG 280 20
+export AIEnter_Battle_Fight
+proc AIEnter_Battle_Fight 0 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1070
+ARGP4
+ADDRGP4 $99
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRGP4 AINode_Battle_Fight
+ASGNP4
+LABELV $1069
+endproc AIEnter_Battle_Fight 0 16
+export AIEnter_Battle_SuicidalFight
+proc AIEnter_Battle_SuicidalFight 4 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1070
+ARGP4
+ADDRGP4 $99
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRGP4 AINode_Battle_Fight
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+LABELV $1071
+endproc AIEnter_Battle_SuicidalFight 4 16
+export AINode_Battle_Fight
+proc AINode_Battle_Fight 308 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+EQI4 $1073
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1075
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1072
+JUMPV
+LABELV $1073
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 212
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 0
+EQI4 $1076
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1078
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1072
+JUMPV
+LABELV $1076
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 216
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 216
+INDIRI4
+CNSTI4 0
+EQI4 $1079
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1081
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1072
+JUMPV
+LABELV $1079
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 220
+ADDRGP4 BotCheckChargedImp
+CALLI4
+ASGNI4
+ADDRLP4 220
+INDIRI4
+CNSTI4 0
+EQI4 $1082
+CNSTI4 1
+RETI4
+ADDRGP4 $1072
+JUMPV
+LABELV $1082
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 224
+ADDRGP4 ClientInSprayroom
+CALLI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 0
+EQI4 $1084
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1086
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1072
+JUMPV
+LABELV $1084
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 232
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CNSTI4 0
+EQI4 $1087
+LABELV $1087
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $1091
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 240
+ADDRGP4 BotNmyTurnedInvalid
+CALLI4
+ASGNI4
+ADDRLP4 240
+INDIRI4
+CNSTI4 0
+EQI4 $1089
+LABELV $1091
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1092
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1072
+JUMPV
+LABELV $1089
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6324
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 248
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 248
+INDIRI4
+CNSTI4 250
+LEI4 $1093
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1095
+ARGP4
+ADDRGP4 AIEnter_Battle_Retreat
+CALLV
+pop
+LABELV $1093
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1096
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1098
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1072
+JUMPV
+LABELV $1096
+ADDRFP4 0
+INDIRP4
+CNSTI4 6120
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $1099
+ADDRFP4 0
+INDIRP4
+CNSTI4 6120
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $1100
+ADDRFP4 0
+INDIRP4
+CNSTI4 6120
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6012
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1103
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChat_EnemySuicide
+CALLI4
+pop
+LABELV $1103
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+NEI4 $1105
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+ADDRGP4 BotChat_Kill
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 0
+EQI4 $1105
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6088
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 264
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1107
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+ADDRGP4 $1106
+JUMPV
+LABELV $1105
+ADDRFP4 0
+INDIRP4
+CNSTI4 6060
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1107
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+LABELV $1106
+CNSTI4 0
+RETI4
+ADDRGP4 $1072
+JUMPV
+LABELV $1099
+ADDRLP4 0
+ARGP4
+ADDRLP4 252
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 252
+INDIRI4
+CNSTI4 0
+EQI4 $1108
+ADDRFP4 0
+INDIRP4
+CNSTI4 6120
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $1108
+LABELV $1100
+ADDRLP4 0
+ARGP4
+ADDRLP4 252
+ADDRGP4 EntityIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 252
+INDIRI4
+CNSTI4 0
+EQI4 $1110
+ADDRLP4 0
+ARGP4
+ADDRLP4 256
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 0
+NEI4 $1110
+ADDRLP4 260
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1045220557
+GEF4 $1112
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1114
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1072
+JUMPV
+LABELV $1112
+LABELV $1110
+ADDRLP4 196
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRLP4 196
+ARGP4
+ADDRLP4 260
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 192
+ADDRLP4 260
+INDIRI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+EQI4 $1116
+ADDRLP4 192
+INDIRI4
+ARGI4
+ADDRLP4 268
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 0
+EQI4 $1116
+ADDRFP4 0
+INDIRP4
+CNSTI4 6248
+ADDP4
+ADDRLP4 196
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6244
+ADDP4
+ADDRLP4 192
+INDIRI4
+ASGNI4
+LABELV $1116
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateBattleInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6036
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5072
+ADDP4
+INDIRI4
+LEI4 $1118
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 280
+ADDRGP4 BotChat_HitNoDeath
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+EQI4 $1120
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 288
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6088
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 288
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1122
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1072
+JUMPV
+LABELV $1120
+LABELV $1118
+ADDRFP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6040
+ADDP4
+INDIRI4
+LEI4 $1123
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 284
+ADDRGP4 BotChat_HitNoKill
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+EQI4 $1125
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 292
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6088
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 292
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1127
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1072
+JUMPV
+LABELV $1125
+LABELV $1123
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 288
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 288
+INDIRF4
+CNSTF4 0
+NEF4 $1128
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 292
+ADDRGP4 BotWantsToChase
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+EQI4 $1130
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1132
+ARGP4
+ADDRGP4 AIEnter_Battle_Chase
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1072
+JUMPV
+LABELV $1130
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1132
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1072
+JUMPV
+LABELV $1128
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotBattleUseItems
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+CNSTI4 18616254
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 292
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+EQI4 $1133
+ADDRLP4 296
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 296
+INDIRP4
+ADDRLP4 296
+INDIRP4
+INDIRI4
+CNSTI4 6291456
+BORI4
+ASGNI4
+LABELV $1133
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChooseWeapon
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAttackMove
+CALLV
+pop
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $1135
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6060
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1135
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAimAtEnemy
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAttack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+NEI4 $1137
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 304
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 0
+EQI4 $1139
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1095
+ARGP4
+ADDRGP4 AIEnter_Battle_Retreat
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1072
+JUMPV
+LABELV $1139
+LABELV $1137
+CNSTI4 1
+RETI4
+LABELV $1072
+endproc AINode_Battle_Fight 308 20
+export AIEnter_Battle_Chase
+proc AIEnter_Battle_Chase 0 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1142
+ARGP4
+ADDRGP4 $99
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6076
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRGP4 AINode_Battle_Chase
+ASGNP4
+LABELV $1141
+endproc AIEnter_Battle_Chase 0 16
+export AINode_Battle_Chase
+proc AINode_Battle_Chase 348 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 276
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+EQI4 $1144
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1146
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1143
+JUMPV
+LABELV $1144
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 280
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+EQI4 $1147
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1149
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1143
+JUMPV
+LABELV $1147
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 284
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+EQI4 $1150
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1152
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1143
+JUMPV
+LABELV $1150
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $1155
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 292
+ADDRGP4 BotNmyTurnedInvalid
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+EQI4 $1153
+LABELV $1155
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1156
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1143
+JUMPV
+LABELV $1153
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 300
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 300
+INDIRF4
+CNSTF4 0
+EQF4 $1157
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1142
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1143
+JUMPV
+LABELV $1157
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 304
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 0
+EQI4 $1159
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1161
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1143
+JUMPV
+LABELV $1159
+ADDRFP4 0
+INDIRP4
+CNSTI4 6244
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1162
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1164
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1143
+JUMPV
+LABELV $1162
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 308
+ADDRGP4 ClientInSprayroom
+CALLI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 0
+EQI4 $1165
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1167
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1143
+JUMPV
+LABELV $1165
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+CNSTI4 18616254
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 312
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 0
+EQI4 $1168
+ADDRLP4 316
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 316
+INDIRP4
+ADDRLP4 316
+INDIRP4
+INDIRI4
+CNSTI4 6291456
+BORI4
+ASGNI4
+LABELV $1168
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRLP4 0+40
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6244
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6248
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+16
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0+16+4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0+16+8
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0+28
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0+28+4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0+28+8
+CNSTF4 1090519040
+ASGNF4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $1182
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 108
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+NEI4 $1184
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1098
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1143
+JUMPV
+LABELV $1184
+ADDRLP4 108+24
+ARGP4
+ADDRLP4 320
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 0+12
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 108+24
+INDIRB
+ASGNB 12
+LABELV $1182
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 320
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 0
+EQI4 $1189
+ADDRFP4 0
+INDIRP4
+CNSTI4 6076
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1189
+ADDRLP4 324
+ADDRFP4 0
+INDIRP4
+CNSTI4 6076
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 324
+INDIRF4
+CNSTF4 0
+EQF4 $1193
+ADDRLP4 324
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+SUBF4
+GEF4 $1191
+LABELV $1193
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1194
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1143
+JUMPV
+LABELV $1191
+ADDRFP4 0
+INDIRP4
+CNSTI4 6084
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1195
+ADDRFP4 0
+INDIRP4
+CNSTI4 6084
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 248
+CNSTF4 1125515264
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 248
+INDIRF4
+ARGF4
+ADDRLP4 332
+ADDRGP4 BotNearbyGoal
+CALLI4
+ASGNI4
+ADDRLP4 332
+INDIRI4
+CNSTI4 0
+EQI4 $1197
+ADDRFP4 0
+INDIRP4
+CNSTI4 6064
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 248
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1199
+ARGP4
+ADDRGP4 AIEnter_Battle_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1143
+JUMPV
+LABELV $1197
+LABELV $1195
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateBattleInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 56
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $1200
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6060
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1200
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRLP4 56+20
+INDIRI4
+CNSTI4 11
+BANDI4
+CNSTI4 0
+EQI4 $1202
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ADDRLP4 56+40
+INDIRB
+ASGNB 12
+ADDRGP4 $1203
+JUMPV
+LABELV $1202
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $1206
+ADDRFP4 0
+INDIRP4
+CNSTI4 6076
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+LEF4 $1208
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAimAtEnemy
+CALLV
+pop
+ADDRGP4 $1209
+JUMPV
+LABELV $1208
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 252
+ARGP4
+ADDRLP4 340
+ADDRGP4 trap_BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 340
+INDIRI4
+CNSTI4 0
+EQI4 $1210
+ADDRLP4 264
+ADDRLP4 252
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 264+4
+ADDRLP4 252+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 264+8
+ADDRLP4 252+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 264
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $1211
+JUMPV
+LABELV $1210
+ADDRLP4 56+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+LABELV $1211
+LABELV $1209
+ADDRLP4 336
+ADDRFP4 0
+INDIRP4
+CNSTI4 6284
+ADDP4
+ASGNP4
+ADDRLP4 336
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 336
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1206
+LABELV $1203
+ADDRLP4 56+20
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1217
+ADDRFP4 0
+INDIRP4
+CNSTI4 6260
+ADDP4
+ADDRLP4 56+24
+INDIRI4
+ASGNI4
+LABELV $1217
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6244
+ADDP4
+INDIRI4
+NEI4 $1221
+ADDRFP4 0
+INDIRP4
+CNSTI4 6076
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1221
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 340
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 340
+INDIRI4
+CNSTI4 0
+EQI4 $1223
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1225
+ARGP4
+ADDRGP4 AIEnter_Battle_Retreat
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1143
+JUMPV
+LABELV $1223
+CNSTI4 1
+RETI4
+LABELV $1143
+endproc AINode_Battle_Chase 348 20
+export AIEnter_Battle_Retreat
+proc AIEnter_Battle_Retreat 0 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1227
+ARGP4
+ADDRGP4 $99
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRGP4 AINode_Battle_Retreat
+ASGNP4
+LABELV $1226
+endproc AIEnter_Battle_Retreat 0 16
+export AINode_Battle_Retreat
+proc AINode_Battle_Retreat 532 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 284
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+EQI4 $1229
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1231
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1228
+JUMPV
+LABELV $1229
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 288
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+EQI4 $1232
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1234
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1228
+JUMPV
+LABELV $1232
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 292
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+EQI4 $1235
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1237
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1228
+JUMPV
+LABELV $1235
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+ADDRGP4 BotCheckChargedImp
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+EQI4 $1238
+CNSTI4 1
+RETI4
+ADDRGP4 $1228
+JUMPV
+LABELV $1238
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 300
+ADDRGP4 ClientInSprayroom
+CALLI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+EQI4 $1240
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1242
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1228
+JUMPV
+LABELV $1240
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $1245
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+ADDRGP4 BotNmyTurnedInvalid
+CALLI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 0
+EQI4 $1243
+LABELV $1245
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1246
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1228
+JUMPV
+LABELV $1243
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $1249
+ADDRLP4 52
+ARGP4
+ADDRLP4 312
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 0
+EQI4 $1247
+LABELV $1249
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1250
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1228
+JUMPV
+LABELV $1247
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 320
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 0
+EQI4 $1251
+LABELV $1251
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+CNSTI4 18616254
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 324
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+EQI4 $1253
+ADDRLP4 328
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 328
+INDIRP4
+ADDRLP4 328
+INDIRP4
+INDIRI4
+CNSTI4 6291456
+BORI4
+ASGNI4
+LABELV $1253
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateBattleInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 336
+ADDRGP4 BotWantsToChase
+CALLI4
+ASGNI4
+ADDRLP4 336
+INDIRI4
+CNSTI4 0
+EQI4 $1255
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEmptyGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1257
+ARGP4
+ADDRGP4 AIEnter_Battle_Chase
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1228
+JUMPV
+LABELV $1255
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+EQI4 $1260
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 344
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 344
+INDIRF4
+CNSTF4 0
+EQF4 $1258
+LABELV $1260
+ADDRFP4 0
+INDIRP4
+CNSTI4 6080
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 256
+ADDRLP4 52+24
+INDIRB
+ASGNB 12
+ADDRLP4 256
+ARGP4
+ADDRLP4 348
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 248
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRLP4 352
+ADDRLP4 248
+INDIRI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 0
+EQI4 $1262
+ADDRLP4 352
+INDIRI4
+ARGI4
+ADDRLP4 356
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 356
+INDIRI4
+CNSTI4 0
+EQI4 $1262
+ADDRFP4 0
+INDIRP4
+CNSTI4 6248
+ADDP4
+ADDRLP4 256
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6244
+ADDP4
+ADDRLP4 248
+INDIRI4
+ASGNI4
+LABELV $1262
+LABELV $1258
+ADDRFP4 0
+INDIRP4
+CNSTI4 6080
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+GEF4 $1264
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1266
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1228
+JUMPV
+LABELV $1264
+ADDRFP4 0
+INDIRP4
+CNSTI4 6080
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1267
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 348
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 348
+INDIRI4
+CNSTI4 0
+EQI4 $1269
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1271
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1228
+JUMPV
+LABELV $1269
+LABELV $1267
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotTeamGoals
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotBattleUseItems
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8392
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 192
+ARGP4
+ADDRLP4 352
+ADDRGP4 BotLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 0
+NEI4 $1272
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1274
+ARGP4
+ADDRGP4 AIEnter_Battle_SuicidalFight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1228
+JUMPV
+LABELV $1272
+ADDRFP4 0
+INDIRP4
+CNSTI4 8392
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1275
+CNSTI4 1
+RETI4
+ADDRGP4 $1228
+JUMPV
+LABELV $1275
+ADDRFP4 0
+INDIRP4
+CNSTI4 6084
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1277
+ADDRFP4 0
+INDIRP4
+CNSTI4 6084
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 252
+CNSTF4 1125515264
+ASGNF4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 8
+NEI4 $1279
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $1281
+ADDRLP4 252
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1280
+JUMPV
+LABELV $1281
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 13
+NEI4 $1283
+ADDRLP4 252
+CNSTF4 1112014848
+ASGNF4
+ADDRGP4 $1280
+JUMPV
+LABELV $1283
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1280
+ADDRLP4 252
+CNSTF4 1125515264
+ASGNF4
+ADDRGP4 $1280
+JUMPV
+LABELV $1279
+ADDRLP4 356
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 356
+INDIRI4
+CNSTI4 7
+EQI4 $1289
+ADDRLP4 356
+INDIRI4
+CNSTI4 3
+NEI4 $1287
+LABELV $1289
+ADDRLP4 252
+ADDRLP4 252
+INDIRF4
+CNSTF4 1100349440
+ADDRFP4 0
+INDIRP4
+CNSTI4 5140
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+ASGNF4
+LABELV $1287
+LABELV $1280
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 192
+ARGP4
+ADDRLP4 252
+INDIRF4
+ARGF4
+ADDRLP4 364
+ADDRGP4 BotNearbyGoal
+CALLI4
+ASGNI4
+ADDRLP4 364
+INDIRI4
+CNSTI4 0
+EQI4 $1290
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6064
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 252
+INDIRF4
+CNSTF4 1120403456
+DIVF4
+ADDF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1292
+ARGP4
+ADDRGP4 AIEnter_Battle_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1228
+JUMPV
+LABELV $1290
+LABELV $1277
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 8
+NEI4 $1293
+ADDRLP4 356
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 356
+INDIRI4
+CNSTI4 13
+EQI4 $1295
+ADDRLP4 356
+INDIRI4
+CNSTI4 7
+NEI4 $1293
+LABELV $1295
+ADDRLP4 360
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 360+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6316
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 360+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 6320
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 360
+ARGP4
+ADDRLP4 380
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 380
+INDIRF4
+CNSTF4 1169147904
+GEF4 $1298
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAttackMove
+CALLV
+pop
+ADDRGP4 $1294
+JUMPV
+LABELV $1298
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 192
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRGP4 $1294
+JUMPV
+LABELV $1293
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 360
+ADDRGP4 IsBambam
+CALLI4
+ASGNI4
+ADDRLP4 360
+INDIRI4
+CNSTI4 0
+EQI4 $1300
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAttackMove
+CALLV
+pop
+ADDRGP4 $1301
+JUMPV
+LABELV $1300
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 364
+ADDRGP4 IsBoomie
+CALLI4
+ASGNI4
+ADDRLP4 364
+INDIRI4
+CNSTI4 0
+EQI4 $1302
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 368
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 368
+INDIRI4
+CNSTI4 0
+EQI4 $1304
+ADDRLP4 508
+ADDRLP4 368+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 508+4
+ADDRLP4 368+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 508+8
+ADDRLP4 368+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 508
+ARGP4
+ADDRLP4 524
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 524
+INDIRF4
+CNSTF4 1219479552
+GEF4 $1313
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAttackMove
+CALLV
+pop
+ADDRGP4 $1303
+JUMPV
+LABELV $1313
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 192
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRGP4 $1303
+JUMPV
+LABELV $1304
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 192
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRGP4 $1303
+JUMPV
+LABELV $1302
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 192
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+LABELV $1303
+LABELV $1301
+LABELV $1294
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1315
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6060
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1315
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChooseWeapon
+CALLV
+pop
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $1317
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ADDRLP4 0+40
+INDIRB
+ASGNB 12
+ADDRGP4 $1318
+JUMPV
+LABELV $1317
+ADDRLP4 368
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 368
+INDIRI4
+NEI4 $1321
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+ADDRLP4 368
+INDIRI4
+NEI4 $1321
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 372
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 268
+ADDRLP4 372
+INDIRF4
+ASGNF4
+ADDRLP4 268
+INDIRF4
+CNSTF4 1050253722
+LEF4 $1324
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAimAtEnemy
+CALLV
+pop
+ADDRGP4 $1325
+JUMPV
+LABELV $1324
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 192
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 256
+ARGP4
+ADDRLP4 380
+ADDRGP4 trap_BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 380
+INDIRI4
+CNSTI4 0
+EQI4 $1326
+ADDRLP4 272
+ADDRLP4 256
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 272+4
+ADDRLP4 256+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 272+8
+ADDRLP4 256+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 272
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $1327
+JUMPV
+LABELV $1326
+ADDRLP4 0+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+LABELV $1327
+ADDRLP4 384
+ADDRFP4 0
+INDIRP4
+CNSTI4 6284
+ADDP4
+ASGNP4
+ADDRLP4 384
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 384
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1325
+LABELV $1321
+LABELV $1318
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1333
+ADDRFP4 0
+INDIRP4
+CNSTI4 6260
+ADDP4
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+LABELV $1333
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAttack
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1228
+endproc AINode_Battle_Retreat 532 20
+export AIEnter_Battle_NBG
+proc AIEnter_Battle_NBG 0 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1338
+ARGP4
+ADDRGP4 $99
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRGP4 AINode_Battle_NBG
+ASGNP4
+LABELV $1337
+endproc AIEnter_Battle_NBG 0 16
+export AINode_Battle_NBG
+proc AINode_Battle_NBG 364 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 280
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+EQI4 $1340
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1342
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1339
+JUMPV
+LABELV $1340
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 284
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+EQI4 $1343
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1345
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1339
+JUMPV
+LABELV $1343
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 288
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+EQI4 $1346
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1348
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1339
+JUMPV
+LABELV $1346
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 292
+ADDRGP4 BotCheckChargedImp
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+EQI4 $1349
+CNSTI4 1
+RETI4
+ADDRGP4 $1339
+JUMPV
+LABELV $1349
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $1353
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 300
+ADDRGP4 BotNmyTurnedInvalid
+CALLI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+EQI4 $1351
+LABELV $1353
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1354
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1339
+JUMPV
+LABELV $1351
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $1357
+ADDRLP4 52
+ARGP4
+ADDRLP4 304
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 0
+EQI4 $1355
+LABELV $1357
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1358
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1339
+JUMPV
+LABELV $1355
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 308
+ADDRGP4 ClientInSprayroom
+CALLI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 0
+EQI4 $1359
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1361
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1339
+JUMPV
+LABELV $1359
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+CNSTI4 18616254
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 312
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 0
+EQI4 $1362
+ADDRLP4 316
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 316
+INDIRP4
+ADDRLP4 316
+INDIRP4
+INDIRI4
+CNSTI4 6291456
+BORI4
+ASGNI4
+LABELV $1362
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+EQI4 $1366
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 324
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 324
+INDIRF4
+CNSTF4 0
+EQF4 $1364
+LABELV $1366
+ADDRFP4 0
+INDIRP4
+CNSTI4 6080
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 252
+ADDRLP4 52+24
+INDIRB
+ASGNB 12
+ADDRLP4 252
+ARGP4
+ADDRLP4 328
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 248
+ADDRLP4 328
+INDIRI4
+ASGNI4
+ADDRLP4 332
+ADDRLP4 248
+INDIRI4
+ASGNI4
+ADDRLP4 332
+INDIRI4
+CNSTI4 0
+EQI4 $1368
+ADDRLP4 332
+INDIRI4
+ARGI4
+ADDRLP4 336
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 336
+INDIRI4
+CNSTI4 0
+EQI4 $1368
+ADDRFP4 0
+INDIRP4
+CNSTI4 6248
+ADDP4
+ADDRLP4 252
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6244
+ADDP4
+ADDRLP4 248
+INDIRI4
+ASGNI4
+LABELV $1368
+LABELV $1364
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 192
+ARGP4
+ADDRLP4 328
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 328
+INDIRI4
+CNSTI4 0
+NEI4 $1370
+ADDRFP4 0
+INDIRP4
+CNSTI4 6064
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1371
+JUMPV
+LABELV $1370
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 192
+ARGP4
+ADDRLP4 332
+ADDRGP4 BotReachedGoal
+CALLI4
+ASGNI4
+ADDRLP4 332
+INDIRI4
+CNSTI4 0
+EQI4 $1372
+ADDRFP4 0
+INDIRP4
+CNSTI4 6064
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1372
+LABELV $1371
+ADDRFP4 0
+INDIRP4
+CNSTI4 6064
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1374
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotPopGoal
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 192
+ARGP4
+ADDRLP4 336
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 336
+INDIRI4
+CNSTI4 0
+EQI4 $1376
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1378
+ARGP4
+ADDRGP4 AIEnter_Battle_Retreat
+CALLV
+pop
+ADDRGP4 $1377
+JUMPV
+LABELV $1376
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1378
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+LABELV $1377
+CNSTI4 0
+RETI4
+ADDRGP4 $1339
+JUMPV
+LABELV $1374
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 192
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1379
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6064
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1379
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateBattleInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChooseWeapon
+CALLV
+pop
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $1381
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ADDRLP4 0+40
+INDIRB
+ASGNB 12
+ADDRGP4 $1382
+JUMPV
+LABELV $1381
+ADDRLP4 344
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 344
+INDIRI4
+NEI4 $1385
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+ADDRLP4 344
+INDIRI4
+NEI4 $1385
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 348
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 264
+ADDRLP4 348
+INDIRF4
+ASGNF4
+ADDRLP4 264
+INDIRF4
+CNSTF4 1050253722
+LEF4 $1388
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAimAtEnemy
+CALLV
+pop
+ADDRGP4 $1389
+JUMPV
+LABELV $1388
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 192
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 252
+ARGP4
+ADDRLP4 356
+ADDRGP4 trap_BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 356
+INDIRI4
+CNSTI4 0
+EQI4 $1390
+ADDRLP4 268
+ADDRLP4 252
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 268+4
+ADDRLP4 252+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 268+8
+ADDRLP4 252+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 268
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $1391
+JUMPV
+LABELV $1390
+ADDRLP4 0+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+LABELV $1391
+ADDRLP4 360
+ADDRFP4 0
+INDIRP4
+CNSTI4 6284
+ADDP4
+ASGNP4
+ADDRLP4 360
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 360
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1389
+LABELV $1385
+LABELV $1382
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1397
+ADDRFP4 0
+INDIRP4
+CNSTI4 6260
+ADDP4
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+LABELV $1397
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAttack
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1339
+endproc AINode_Battle_NBG 364 20
+import botstates
+bss
+align 1
+LABELV nodeswitch
+skip 7344
+align 4
+LABELV numnodeswitches
+skip 4
+import bot_thinktime
+import BotTeamAI
+import AINode_Reachtest
+import AIEnter_Reachtest
+import AIEnter_Seek_Camp
+import BotMatchMessage
+import notleader
+import BotChatTest
+import BotChatTime
+import BotChat_Random
+import BotChat_EnemySuicide
+import BotChat_Kill
+import BotChat_Death
+import BotChat_HitNoKill
+import BotChat_HitNoDeath
+import BotChat_HitTalking
+import BotChat_EndLevel
+import BotChat_StartLevel
+import BotChat_ExitGame
+import BotChat_EnterGame
+import num_hstations
+import hstations
+import outtele
+import spraytele
+import bwall
+import rwall
+import balloongoal
+import ctf_blueflag
+import ctf_redflag
+import bot_challenge
+import bot_testrchat
+import bot_nochat
+import bot_fastchat
+import maxclients
+import gametype
+import GetCTLFlagGoal
+import GetDroppedLollyGoal
+import CheckMatrixForGoal
+import BotCTFCarryingFlag
+import IsMyBalloon
+import IsBambam
+import IsBoomie
+import IsWall
+import IsDuck
+import BotSelectLogo
+import BotSprayWallCheckAttack
+import BotGetNumClientCarts
+import BotNmyTurnedInvalid
+import BotCheckChargedImp
+import ClientInSprayroom
+import BotMapScripts
+import BotPointAreaNum
+import ClientOnSameTeamFromName
+import ClientFromName
+import BotRememberLastOrderedTask
+import BotOppositeTeam
+import BotTeam
+import BotClearActivateGoalStack
+import BotPopFromActivateGoalStack
+import BotEnableActivateGoalAreas
+import BotAIPredictObstacles
+import BotAIBlocked
+import BotCheckAttack
+import BotAimAtEnemy
+import BotEntityVisible
+import BotRoamGoal
+import BotFindEnemy
+import InFieldOfVision
+import BotVisibleTeamMatesAndEnemies
+import TeamPlayIsOn
+import BotSameTeam
+import BotAttackMove
+import BotWantsToHelp
+import BotWantsToChase
+import BotWantsToRetreat
+import BotAggression
+import BotTeamGoals
+import ClientSkin
+import EasyClientName
+import ClientName
+import BotSetUserInfo
+import EntityIsShooting
+import EntityIsInvisible
+import EntityIsDead
+import BotInLavaOrSlime
+import BotIntermission
+import BotIsObserver
+import BotIsDead
+import BotBattleUseItems
+import BotUpdateBattleInventory
+import BotUpdateInventory
+import BotSetupForMovement
+import BotChooseWeapon
+import BotDeathmatchAI
+import BotSetupDeathmatchAI
+import BotAI_AllowLTGRefresh
+import BotAI_GetSnapshotEntity
+import BotAI_GetEntityState
+import BotAI_GetClientState
+import BotAI_ShareVisibility
+import BotAI_SharedVisibility
+import BotAI_VisTrace
+import BotAI_Trace
+import BotAI_BotInitialChat
+import BotAI_Print
+import BotAddInfo
+import floattime
+import WaypointInit
+import GetWpID
+import BotWpHasSuccessor
+import GetNextWp
+import FindWp
+import BotWpValid
+import BotEntityInfo
+import BotResetState
+import AngleDifference
+import numboomiespots
+import boomiespots
+import numbambamspots
+import bambamspots
+import numwaypoints
+import waypoints
+import bot_developer
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotAllocWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownMoveAI
+import BotSetupMoveAI
+import BotSetBrushModelTypes
+import BotAddAvoidSpot
+import BotInitMoveState
+import BotFreeMoveState
+import BotAllocMoveState
+import BotPredictVisiblePosition
+import BotMovementViewTarget
+import BotReachabilityArea
+import BotResetLastAvoidReach
+import BotResetAvoidReach
+import BotMoveInDirection
+import BotMoveToGoal
+import BotResetMoveState
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GeneticParentsAndChildSelection
+import BotSetChatName
+import BotSetChatGender
+import BotLoadChatFile
+import BotReplaceSynonyms
+import UnifyWhiteSpaces
+import BotMatchVariable
+import BotFindMatch
+import StringContains
+import BotGetChatMessage
+import BotEnterChat
+import BotChatLength
+import BotReplyChat
+import BotNumInitialChats
+import BotInitialChat
+import BotNumConsoleMessages
+import BotNextConsoleMessage
+import BotRemoveConsoleMessage
+import BotQueueConsoleMessage
+import BotFreeChatState
+import BotAllocChatState
+import BotShutdownChatAI
+import BotSetupChatAI
+import BotShutdownCharacters
+import Characteristic_String
+import Characteristic_BInteger
+import Characteristic_Integer
+import Characteristic_BFloat
+import Characteristic_Float
+import BotFreeCharacter
+import BotLoadCharacter
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Walk
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import GetBotLibAPI
+import trap_AAS_BestReachableArea
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntities
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_RealTime
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_EntitiesInPVS
+import trap_RestoreClients
+import trap_RewindClients
+import trap_GetUsercmds
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_TraceBatch
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import g_logDamage
+import g_modInstagib_WeaponJump
+import g_modInstagib
+import g_transmitSVboastermissiles
+import g_KillerduckHealth
+import g_LPS_flags
+import g_LPS_startlives
+import g_skyLensflare
+import g_sky
+import g_q3Items
+import pmove_msec
+import pmove_fixed
+import g_antilag
+import g_smoothClients
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_curWarmupReady
+import g_warmupReady
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import MapSupportsGametype
+import G_GetArenaInfoByMap
+import G_InitGameinfo
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import AI_RemoveBambam
+import AI_AddBambam
+import AI_RemoveBoomie
+import AI_AddBoomie
+import BotCamMode
+import BotInterbreedEndMatch
+import Svcmd_BotStats_f
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_LoadBots
+import CantDamageTeamitem
+import boomies_createByPlayer
+import bambam_createByPlayer
+import IsItemSameTeam
+import Instagib_canSpawnEntity
+import Instagib_isRelevantDamageEvent
+import Instagib_calculateDamage
+import Instagib_getSpawnWeapon
+import Instagib_applyWeaponJumpKnockback
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import PrintMsg
+import CheckObeliskAttack
+import Team_GetFlagStatus
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThinkBatch
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogFlush
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import G_GetCvarInt
+import MoveClientToIntermission
+import G_SendScoreboardUpdates
+import DeathmatchScoreboardMessage
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import GetASpawnPosition
+import SelectSpectatorSpawnPoint
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import respawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import Touch_DoorTrigger
+import G_PushablesChanged
+import G_RunMover
+import fire_kma
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_bubbleg
+import fire_bambamMissile
+import fire_duck
+import explode_imperius
+import fire_splasher
+import fire_nipper
+import fire_boaster
+import G_RunExplosion
+import G_RunMissile
+import BerserkerCheck
+import TossClientCubes
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import GametypeNameShort
+import GametypeName
+import RemoveOwnedItems
+import SetAward
+import G_RestorePowerups
+import G_BackupPowerups
+import DeleteDebugLines
+import DebugLineDouble
+import DebugLine
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_NextActiveEntity
+import G_InitEntityLists
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_FindAll
+import G_Find
+import G_EntityIndexChanged
+import G_InitEntityIndex
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import G_Say
+import ConcatArgs
+import Cmd_DropCartridge_f
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $1378
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $1361
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 114
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $1358
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $1354
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $1348
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $1345
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1342
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1338
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 0
+align 1
+LABELV $1292
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 0
+align 1
+LABELV $1274
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $1271
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $1266
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $1257
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $1250
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $1246
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $1242
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 114
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $1237
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $1234
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1231
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1227
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $1225
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $1199
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 0
+align 1
+LABELV $1194
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $1167
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 114
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $1164
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 0
+align 1
+LABELV $1161
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $1156
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $1152
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $1149
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1146
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1142
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $1132
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $1127
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $1122
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1114
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1107
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $1098
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 0
+align 1
+LABELV $1095
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $1092
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $1086
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 114
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $1081
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $1078
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1075
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1070
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $1064
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $1047
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $1040
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $1034
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $1025
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 0
+align 1
+LABELV $1024
+byte 1 94
+byte 1 50
+byte 1 103
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 76
+byte 1 84
+byte 1 71
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $996
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $983
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $980
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $977
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $974
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $970
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 76
+byte 1 84
+byte 1 71
+byte 1 0
+align 1
+LABELV $883
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $846
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $837
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $834
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $831
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $827
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $826
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 0
+align 1
+LABELV $821
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $770
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $759
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $751
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $733
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $728
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $725
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $722
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $718
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $695
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $687
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $685
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $683
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $680
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $670
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $668
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $662
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $660
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $640
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $593
+byte 1 119
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 114
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $548
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $547
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $502
+byte 1 110
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $496
+byte 1 119
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $488
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 119
+byte 1 112
+byte 1 0
+align 1
+LABELV $460
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 103
+byte 1 111
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $457
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $452
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $442
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $437
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $434
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $427
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $418
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 76
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 84
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $308
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $305
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $277
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $266
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 67
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $246
+byte 1 103
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $136
+byte 1 110
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 67
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $120
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 107
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $117
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $101
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 50
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $99
+byte 1 0
+align 1
+LABELV $98
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $93
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 65
+byte 1 73
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $85
+byte 1 116
+byte 1 0
+align 1
+LABELV $81
+byte 1 110
+byte 1 0
+align 1
+LABELV $74
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
@@ -0,0 +1,27866 @@
+export ClientInSprayroom
+code
+proc ClientInSprayroom 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+EQI4 $66
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+EQI4 $66
+CNSTI4 0
+RETI4
+ADDRGP4 $65
+JUMPV
+LABELV $66
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $70
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $68
+LABELV $70
+CNSTI4 0
+RETI4
+ADDRGP4 $65
+JUMPV
+LABELV $68
+CNSTI4 832
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $71
+CNSTI4 0
+RETI4
+ADDRGP4 $65
+JUMPV
+LABELV $71
+CNSTI4 0
+CNSTI4 832
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+LTI4 $74
+CNSTI4 0
+RETI4
+ADDRGP4 $65
+JUMPV
+LABELV $74
+CNSTI4 1
+RETI4
+LABELV $65
+endproc ClientInSprayroom 8 0
+export BotCTFCarryingFlag
+proc BotCTFCarryingFlag 0 0
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+EQI4 $78
+CNSTI4 0
+RETI4
+ADDRGP4 $77
+JUMPV
+LABELV $78
+ADDRFP4 0
+INDIRP4
+CNSTI4 5132
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $80
+CNSTI4 1
+RETI4
+ADDRGP4 $77
+JUMPV
+LABELV $80
+ADDRFP4 0
+INDIRP4
+CNSTI4 5136
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $82
+CNSTI4 2
+RETI4
+ADDRGP4 $77
+JUMPV
+LABELV $82
+CNSTI4 0
+RETI4
+LABELV $77
+endproc BotCTFCarryingFlag 0 0
+export BotGetNumClientCarts
+proc BotGetNumClientCarts 4 0
+ADDRLP4 0
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+EQI4 $87
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $85
+LABELV $87
+CNSTI4 832
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $84
+JUMPV
+LABELV $85
+CNSTI4 0
+RETI4
+LABELV $84
+endproc BotGetNumClientCarts 4 0
+bss
+align 4
+LABELV $90
+skip 4
+export BotGetVisTeamPlayers
+code
+proc BotGetVisTeamPlayers 236 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 46
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 156
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 156
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 45
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 160
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 152
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRGP4 $90
+INDIRI4
+CNSTI4 0
+NEI4 $91
+ADDRGP4 $93
+ARGP4
+ADDRLP4 164
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $90
+ADDRLP4 164
+INDIRI4
+ASGNI4
+LABELV $91
+ADDRLP4 168
+CNSTI4 0
+ASGNI4
+ADDRLP4 148
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRGP4 $97
+JUMPV
+LABELV $94
+ADDRLP4 140
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $98
+ADDRGP4 $95
+JUMPV
+LABELV $98
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 192
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+ADDRFP4 12
+INDIRI4
+EQI4 $100
+ADDRGP4 $95
+JUMPV
+LABELV $100
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $105
+ADDRLP4 0
+ARGP4
+ADDRLP4 196
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+NEI4 $105
+ADDRLP4 0
+ARGP4
+ADDRLP4 200
+ADDRGP4 EntityIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+EQI4 $102
+ADDRLP4 0
+ARGP4
+ADDRLP4 204
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 0
+NEI4 $102
+LABELV $105
+ADDRGP4 $95
+JUMPV
+LABELV $102
+ADDRLP4 152
+INDIRF4
+CNSTF4 1056964608
+GEF4 $106
+ADDRLP4 0
+ARGP4
+ADDRLP4 208
+ADDRGP4 EntityIsChatting
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+EQI4 $106
+ADDRGP4 $95
+JUMPV
+LABELV $106
+ADDRLP4 172
+ADDRLP4 0+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 172+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 172+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 172
+ARGP4
+ADDRLP4 216
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 184
+ADDRLP4 216
+INDIRF4
+ASGNF4
+ADDRGP4 lastteleport_time
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+LEF4 $115
+ADDRLP4 172
+ADDRLP4 0+24
+INDIRF4
+ADDRGP4 lastteleport_origin
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 172+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRGP4 lastteleport_origin+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 172+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRGP4 lastteleport_origin+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 172
+ARGP4
+ADDRLP4 220
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 220
+INDIRF4
+CNSTF4 1167663104
+GEF4 $126
+ADDRGP4 $95
+JUMPV
+LABELV $126
+LABELV $115
+ADDRLP4 220
+CNSTF4 1165623296
+ADDRLP4 144
+INDIRF4
+MULF4
+CNSTF4 1147207680
+ADDF4
+ASGNF4
+ADDRLP4 184
+INDIRF4
+ADDRLP4 220
+INDIRF4
+ADDRLP4 220
+INDIRF4
+MULF4
+LEF4 $128
+ADDRGP4 $95
+JUMPV
+LABELV $128
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 228
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 188
+ADDRLP4 228
+INDIRF4
+ASGNF4
+ADDRLP4 188
+INDIRF4
+CNSTF4 0
+GTF4 $132
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $130
+LABELV $132
+ADDRLP4 232
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 148
+ADDRLP4 232
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $133
+ADDRGP4 $96
+JUMPV
+LABELV $133
+LABELV $130
+LABELV $95
+ADDRLP4 140
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $97
+ADDRLP4 140
+INDIRI4
+ADDRGP4 $90
+INDIRI4
+GEI4 $135
+ADDRLP4 140
+INDIRI4
+CNSTI4 64
+LTI4 $94
+LABELV $135
+LABELV $96
+ADDRLP4 148
+INDIRI4
+RETI4
+LABELV $89
+endproc BotGetVisTeamPlayers 236 20
+export IsDuck
+proc IsDuck 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $139
+ADDRFP4 0
+INDIRI4
+CNSTI4 1024
+LEI4 $137
+LABELV $139
+CNSTI4 0
+RETI4
+ADDRGP4 $136
+JUMPV
+LABELV $137
+ADDRLP4 8
+CNSTI4 832
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 g_entities+192
+ADDP4
+INDIRI4
+CNSTI4 13
+NEI4 $143
+ADDRLP4 8
+INDIRI4
+ADDRGP4 g_entities+4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $143
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $144
+JUMPV
+LABELV $143
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $144
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $136
+endproc IsDuck 12 0
+export IsWall
+proc IsWall 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $148
+ADDRFP4 0
+INDIRI4
+CNSTI4 1024
+LEI4 $146
+LABELV $148
+CNSTI4 0
+RETI4
+ADDRGP4 $145
+JUMPV
+LABELV $146
+ADDRLP4 8
+CNSTI4 832
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+CVPU4 4
+ASGNU4
+ADDRLP4 8
+INDIRU4
+ADDRGP4 level+28
+INDIRP4
+CVPU4 4
+EQU4 $156
+ADDRLP4 8
+INDIRU4
+ADDRGP4 level+24
+INDIRP4
+CVPU4 4
+EQU4 $156
+ADDRLP4 8
+INDIRU4
+ADDRGP4 level+32
+INDIRP4
+CVPU4 4
+NEU4 $153
+LABELV $156
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $154
+JUMPV
+LABELV $153
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $154
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $145
+endproc IsWall 12 0
+export IsBambam
+proc IsBambam 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $160
+ADDRFP4 0
+INDIRI4
+CNSTI4 1024
+LEI4 $158
+LABELV $160
+CNSTI4 0
+RETI4
+ADDRGP4 $157
+JUMPV
+LABELV $158
+CNSTI4 832
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+4
+ADDP4
+INDIRI4
+CNSTI4 16
+NEI4 $163
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $164
+JUMPV
+LABELV $163
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $164
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $157
+endproc IsBambam 8 0
+export IsBoomie
+proc IsBoomie 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $168
+ADDRFP4 0
+INDIRI4
+CNSTI4 1024
+LEI4 $166
+LABELV $168
+CNSTI4 0
+RETI4
+ADDRGP4 $165
+JUMPV
+LABELV $166
+CNSTI4 832
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+4
+ADDP4
+INDIRI4
+CNSTI4 17
+NEI4 $171
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $172
+JUMPV
+LABELV $171
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $172
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $165
+endproc IsBoomie 8 0
+export BotTeam
+proc BotTeam 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $176
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $174
+LABELV $176
+CNSTI4 0
+RETI4
+ADDRGP4 $173
+JUMPV
+LABELV $174
+ADDRLP4 0
+CNSTI4 832
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $178
+CNSTI4 0
+RETI4
+ADDRGP4 $173
+JUMPV
+LABELV $178
+ADDRLP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+RETI4
+LABELV $173
+endproc BotTeam 8 0
+export BotOppositeTeam
+proc BotOppositeTeam 12 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $184
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+EQI4 $185
+ADDRGP4 $181
+JUMPV
+LABELV $184
+CNSTI4 2
+RETI4
+ADDRGP4 $180
+JUMPV
+LABELV $185
+CNSTI4 1
+RETI4
+ADDRGP4 $180
+JUMPV
+LABELV $181
+CNSTI4 0
+RETI4
+LABELV $180
+endproc BotOppositeTeam 12 4
+export EntityIsDead
+proc EntityIsDead 484 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 468
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 468
+INDIRI4
+CNSTI4 0
+LTI4 $187
+ADDRLP4 468
+INDIRI4
+CNSTI4 64
+GEI4 $187
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotAI_GetClientState
+CALLI4
+pop
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 0
+EQI4 $189
+CNSTI4 1
+RETI4
+ADDRGP4 $186
+JUMPV
+LABELV $189
+CNSTI4 0
+RETI4
+ADDRGP4 $186
+JUMPV
+LABELV $187
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 472
+ADDRGP4 IsDuck
+CALLI4
+ASGNI4
+ADDRLP4 472
+INDIRI4
+CNSTI4 0
+EQI4 $192
+CNSTI4 0
+RETI4
+ADDRGP4 $186
+JUMPV
+LABELV $192
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 476
+ADDRGP4 IsBambam
+CALLI4
+ASGNI4
+ADDRLP4 476
+INDIRI4
+CNSTI4 0
+EQI4 $194
+CNSTI4 0
+RETI4
+ADDRGP4 $186
+JUMPV
+LABELV $194
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 480
+ADDRGP4 IsBoomie
+CALLI4
+ASGNI4
+ADDRLP4 480
+INDIRI4
+CNSTI4 0
+EQI4 $196
+CNSTI4 0
+RETI4
+ADDRGP4 $186
+JUMPV
+LABELV $196
+CNSTI4 1
+RETI4
+LABELV $186
+endproc EntityIsDead 484 8
+export EntityCarriesCarts
+proc EntityCarriesCarts 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $199
+CNSTI4 0
+RETI4
+ADDRGP4 $198
+JUMPV
+LABELV $199
+CNSTI4 832
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+RETI4
+LABELV $198
+endproc EntityCarriesCarts 0 0
+export EntityIsInvisible
+proc EntityIsInvisible 4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 64
+GEI4 $203
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 EntityCarriesCarts
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $205
+CNSTI4 0
+RETI4
+ADDRGP4 $202
+JUMPV
+LABELV $205
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $207
+CNSTI4 0
+RETI4
+ADDRGP4 $202
+JUMPV
+LABELV $207
+LABELV $203
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $209
+CNSTI4 1
+RETI4
+ADDRGP4 $202
+JUMPV
+LABELV $209
+CNSTI4 0
+RETI4
+LABELV $202
+endproc EntityIsInvisible 4 4
+export EntityIsShooting
+proc EntityIsShooting 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $212
+CNSTI4 1
+RETI4
+ADDRGP4 $211
+JUMPV
+LABELV $212
+CNSTI4 0
+RETI4
+LABELV $211
+endproc EntityIsShooting 0 0
+export EntityIsChatting
+proc EntityIsChatting 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $215
+CNSTI4 1
+RETI4
+ADDRGP4 $214
+JUMPV
+LABELV $215
+CNSTI4 0
+RETI4
+LABELV $214
+endproc EntityIsChatting 0 0
+export GetCTLFlagGoal
+proc GetCTLFlagGoal 60 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $219
+ADDRLP4 24
+CNSTI4 8
+ASGNI4
+ADDRGP4 $220
+JUMPV
+LABELV $219
+ADDRLP4 24
+CNSTI4 9
+ASGNI4
+LABELV $220
+ADDRLP4 8
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 64
+ASGNI4
+ADDRGP4 $224
+JUMPV
+LABELV $221
+ADDRLP4 0
+CNSTI4 832
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $226
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+CNSTI4 828
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $226
+ADDRLP4 36
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $226
+ADDRLP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+ADDRLP4 32
+INDIRI4
+EQI4 $226
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 56
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 40
+CNSTF4 3231711232
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 tv
+CALLP4
+ASGNP4
+ADDRLP4 48
+CNSTF4 1084227584
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 tv
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 56
+ADDRGP4 trap_AAS_BestReachableArea
+CALLI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $217
+JUMPV
+LABELV $226
+LABELV $222
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $224
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $221
+CNSTI4 0
+RETI4
+LABELV $217
+endproc GetCTLFlagGoal 60 16
+export IsMyBalloon
+proc IsMyBalloon 16 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $232
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $232
+ADDRLP4 8
+INDIRI4
+CNSTI4 1024
+LEI4 $229
+LABELV $232
+CNSTI4 0
+RETI4
+ADDRGP4 $228
+JUMPV
+LABELV $229
+ADDRLP4 0
+CNSTI4 832
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+772
+ADDP4
+INDIRI4
+ADDRGP4 level+52
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $239
+ADDRLP4 0
+INDIRI4
+CNSTI4 49
+EQI4 $238
+LABELV $239
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $236
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+NEI4 $236
+LABELV $238
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $237
+JUMPV
+LABELV $236
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $237
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $228
+endproc IsMyBalloon 16 0
+export BotPickUnCappedBalloon
+proc BotPickUnCappedBalloon 52 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $244
+JUMPV
+LABELV $241
+ADDRLP4 8
+CNSTI4 832
+CNSTI4 56
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 balloongoal+40
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+772
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 level+52
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+NEI4 $252
+ADDRLP4 4
+INDIRI4
+CNSTI4 49
+NEI4 $251
+LABELV $252
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 2
+NEI4 $249
+ADDRLP4 4
+INDIRI4
+CNSTI4 50
+EQI4 $249
+LABELV $251
+ADDRLP4 48
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 24
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $249
+LABELV $242
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $244
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+48
+INDIRI4
+LTI4 $241
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $253
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $240
+JUMPV
+LABELV $253
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 40
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+ASGNF4
+ADDRLP4 20
+CNSTF4 1065353216
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $258
+JUMPV
+LABELV $255
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+MULF4
+GEF4 $259
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ARGP4
+CNSTI4 56
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 24-4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 balloongoal
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $257
+JUMPV
+LABELV $259
+LABELV $256
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $258
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LEI4 $255
+LABELV $257
+CNSTI4 1
+RETI4
+LABELV $240
+endproc BotPickUnCappedBalloon 52 12
+export BotPickBestBalloonGoal
+proc BotPickBestBalloonGoal 88 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 40
+CNSTF4 1176256410
+ASGNF4
+ADDRLP4 48
+CNSTI4 -1
+ASGNI4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRLP4 60
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRGP4 $266
+JUMPV
+LABELV $263
+ADDRLP4 36
+CNSTI4 832
+CNSTI4 56
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 balloongoal+40
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+772
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 36
+INDIRI4
+ADDRGP4 level+52
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+NEI4 $274
+ADDRLP4 8
+INDIRI4
+CNSTI4 49
+EQI4 $273
+LABELV $274
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+NEI4 $271
+ADDRLP4 8
+INDIRI4
+CNSTI4 50
+NEI4 $271
+LABELV $273
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 52
+ADDRLP4 52
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $272
+JUMPV
+LABELV $271
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+NEI4 $278
+ADDRLP4 8
+INDIRI4
+CNSTI4 50
+EQI4 $277
+LABELV $278
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 2
+NEI4 $275
+ADDRLP4 8
+INDIRI4
+CNSTI4 49
+NEI4 $275
+LABELV $277
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 56
+ADDRLP4 56
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $276
+JUMPV
+LABELV $275
+ADDRLP4 84
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+LSHI4
+ADDRLP4 20
+ADDP4
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $276
+LABELV $272
+LABELV $264
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $266
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+48
+INDIRI4
+LTI4 $263
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $279
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 BotPickUnCappedBalloon
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+RETI4
+ADDRGP4 $262
+JUMPV
+LABELV $279
+ADDRLP4 44
+ADDRLP4 52
+INDIRI4
+ADDRLP4 56
+INDIRI4
+SUBI4
+ADDRGP4 level+48
+INDIRI4
+ADDI4
+CVIF4 4
+CNSTF4 1073741824
+ADDRGP4 level+48
+INDIRI4
+CVIF4 4
+MULF4
+DIVF4
+ASGNF4
+ADDRLP4 44
+INDIRF4
+CNSTF4 0
+NEF4 $283
+ADDRLP4 44
+CNSTF4 1036831949
+ASGNF4
+LABELV $283
+ADDRLP4 44
+INDIRF4
+CNSTF4 1065353216
+NEF4 $285
+ADDRLP4 44
+CNSTF4 1063675494
+ASGNF4
+LABELV $285
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 scorealert
+ADDP4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $290
+JUMPV
+LABELV $287
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 56
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 balloongoal
+ADDP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 BotClientTravelTimeToGoal
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 0
+NEF4 $292
+ADDRGP4 $288
+JUMPV
+LABELV $292
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $294
+ADDRLP4 16
+CNSTF4 1065353216
+ADDRLP4 44
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $295
+JUMPV
+LABELV $294
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $296
+ADDRLP4 16
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRGP4 $297
+JUMPV
+LABELV $296
+ADDRLP4 16
+CNSTF4 1065353216
+ADDRLP4 44
+INDIRF4
+SUBF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+LABELV $297
+LABELV $295
+ADDRLP4 32
+ADDRLP4 12
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 40
+INDIRF4
+GEF4 $298
+ADDRLP4 40
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $298
+LABELV $288
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $290
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+48
+INDIRI4
+LTI4 $287
+ADDRLP4 48
+INDIRI4
+CNSTI4 -1
+NEI4 $300
+CNSTI4 0
+RETI4
+ADDRGP4 $262
+JUMPV
+LABELV $300
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ARGP4
+CNSTI4 56
+ADDRLP4 48
+INDIRI4
+MULI4
+ADDRGP4 balloongoal
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+LABELV $262
+endproc BotPickBestBalloonGoal 88 12
+proc BotBalloonSeekGoals 48 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 7
+EQI4 $303
+ADDRFP4 0
+INDIRP4
+CNSTI4 4964
+ADDP4
+INDIRI4
+CNSTI4 40
+LTI4 $305
+ADDRFP4 0
+INDIRP4
+CNSTI4 5072
+ADDP4
+INDIRI4
+CNSTI4 30
+GEI4 $303
+LABELV $305
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $302
+JUMPV
+LABELV $303
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $306
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 BotPickBestBalloonGoal
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $308
+ADDRGP4 $302
+JUMPV
+LABELV $308
+ADDRFP4 0
+INDIRP4
+CNSTI4 6308
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6372
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 IsMyBalloon
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $310
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $311
+JUMPV
+LABELV $310
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 13
+ASGNI4
+LABELV $311
+LABELV $306
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 13
+NEI4 $312
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 IsMyBalloon
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $314
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $315
+JUMPV
+LABELV $314
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6316
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 6320
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 IsMyBalloon
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $318
+ADDRLP4 0
+ARGP4
+ADDRLP4 40
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 40
+INDIRF4
+CNSTF4 1169147904
+GEF4 $318
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 7
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6308
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6372
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+LABELV $318
+LABELV $315
+LABELV $312
+LABELV $302
+endproc BotBalloonSeekGoals 48 8
+export BotWantsCarts
+proc BotWantsCarts 360 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8384
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $321
+CNSTI4 0
+RETI4
+ADDRGP4 $320
+JUMPV
+LABELV $321
+ADDRFP4 0
+INDIRP4
+CNSTI4 8384
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5072
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4956
+ADDP4
+INDIRI4
+ADDI4
+CNSTI4 30
+GEI4 $323
+CNSTI4 0
+RETI4
+ADDRGP4 $320
+JUMPV
+LABELV $323
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 268
+ADDRGP4 BotGetVisTeamPlayers
+CALLI4
+ASGNI4
+ADDRLP4 260
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $328
+JUMPV
+LABELV $325
+ADDRLP4 272
+CNSTI4 832
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 272
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $329
+ADDRGP4 $326
+JUMPV
+LABELV $329
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 312
+ADDRGP4 BotGetNumClientCarts
+CALLI4
+ASGNI4
+ADDRLP4 304
+ADDRLP4 312
+INDIRI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 0
+NEI4 $331
+ADDRGP4 $326
+JUMPV
+LABELV $331
+ADDRLP4 272
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRI4
+ADDRLP4 272
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ADDI4
+CNSTI4 15
+GEI4 $333
+ADDRFP4 0
+INDIRP4
+CNSTI4 5072
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4956
+ADDP4
+INDIRI4
+ADDI4
+CNSTI4 30
+LEI4 $333
+ADDRLP4 276
+ADDRLP4 272
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRF4
+ADDRGP4 spraytele
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 276+4
+ADDRLP4 272
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRF4
+ADDRGP4 spraytele+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 276+8
+ADDRLP4 272
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRF4
+ADDRGP4 spraytele+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 276
+ARGP4
+ADDRLP4 328
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 300
+ADDRLP4 328
+INDIRF4
+ASGNF4
+ADDRLP4 288
+ADDRLP4 272
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 288+4
+ADDRLP4 272
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 288+8
+ADDRLP4 272
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 288
+ARGP4
+ADDRLP4 340
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 308
+ADDRLP4 340
+INDIRF4
+ASGNF4
+ADDRLP4 300
+INDIRF4
+CNSTF4 1128792064
+GEF4 $341
+ADDRGP4 $326
+JUMPV
+LABELV $341
+ADDRLP4 300
+INDIRF4
+ADDRLP4 308
+INDIRF4
+GEF4 $343
+ADDRGP4 $326
+JUMPV
+LABELV $343
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $320
+JUMPV
+LABELV $333
+ADDRLP4 328
+ADDRLP4 272
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 332
+CNSTI4 0
+ASGNI4
+ADDRLP4 328
+INDIRP4
+CNSTI4 320
+ADDP4
+INDIRI4
+ADDRLP4 332
+INDIRI4
+NEI4 $345
+ADDRLP4 328
+INDIRP4
+CNSTI4 316
+ADDP4
+INDIRI4
+ADDRLP4 332
+INDIRI4
+NEI4 $345
+ADDRLP4 272
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRI4
+ADDRLP4 328
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ADDI4
+CNSTI4 30
+GEI4 $345
+ADDRFP4 0
+INDIRP4
+CNSTI4 5072
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4956
+ADDP4
+INDIRI4
+ADDI4
+CNSTI4 60
+LEI4 $345
+ADDRLP4 276
+ADDRLP4 272
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRF4
+ADDRGP4 spraytele
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 276+4
+ADDRLP4 272
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRF4
+ADDRGP4 spraytele+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 276+8
+ADDRLP4 272
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRF4
+ADDRGP4 spraytele+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 276
+ARGP4
+ADDRLP4 344
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 300
+ADDRLP4 344
+INDIRF4
+ASGNF4
+ADDRLP4 288
+ADDRLP4 272
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 288+4
+ADDRLP4 272
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 288+8
+ADDRLP4 272
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 288
+ARGP4
+ADDRLP4 356
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 308
+ADDRLP4 356
+INDIRF4
+ASGNF4
+ADDRLP4 300
+INDIRF4
+CNSTF4 1128792064
+GEF4 $353
+ADDRGP4 $326
+JUMPV
+LABELV $353
+ADDRLP4 300
+INDIRF4
+ADDRLP4 308
+INDIRF4
+GEF4 $355
+ADDRGP4 $326
+JUMPV
+LABELV $355
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $320
+JUMPV
+LABELV $345
+LABELV $326
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $328
+ADDRLP4 0
+INDIRI4
+ADDRLP4 260
+INDIRI4
+LTI4 $325
+CNSTI4 0
+RETI4
+LABELV $320
+endproc BotWantsCarts 360 16
+export BotSyCSeekGoals
+proc BotSyCSeekGoals 280 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 ClientInSprayroom
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $358
+ADDRFP4 0
+INDIRP4
+CNSTI4 5140
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $360
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $360
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6372
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6132
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6308
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 BotChooseWall
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8364
+ADDP4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRGP4 $357
+JUMPV
+LABELV $360
+ADDRFP4 0
+INDIRP4
+CNSTI4 5140
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $357
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 13
+EQI4 $357
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 13
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6372
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6308
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $357
+JUMPV
+LABELV $358
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+EQI4 $364
+ADDRLP4 4
+INDIRI4
+CNSTI4 17
+EQI4 $364
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 12
+ADDRGP4 BotWantsCarts
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $366
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 17
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6304
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6372
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1097859072
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6308
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8380
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $368
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6304
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRGP4 $357
+JUMPV
+LABELV $366
+ADDRFP4 0
+INDIRP4
+CNSTI4 5140
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $369
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $369
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6372
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6132
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6308
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 BotChooseWall
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8364
+ADDP4
+ADDRLP4 28
+INDIRP4
+ASGNP4
+LABELV $369
+LABELV $364
+LABELV $357
+endproc BotSyCSeekGoals 280 16
+proc BotSyCRetreatGoals 276 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+EQI4 $372
+ADDRLP4 0
+INDIRI4
+CNSTI4 17
+EQI4 $372
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotWantsCarts
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $374
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 17
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6304
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6372
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1097859072
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6308
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8380
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $368
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6304
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRGP4 $371
+JUMPV
+LABELV $374
+ADDRFP4 0
+INDIRP4
+CNSTI4 5140
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $376
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $376
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6372
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6132
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6308
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 BotChooseWall
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8364
+ADDP4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+LABELV $376
+LABELV $372
+LABELV $371
+endproc BotSyCRetreatGoals 276 16
+data
+align 4
+LABELV $379
+byte 4 0
+code
+proc BotNumberInTeam 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $379
+INDIRI4
+CNSTI4 0
+NEI4 $380
+ADDRGP4 $93
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $379
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $380
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $385
+JUMPV
+LABELV $382
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $386
+ADDRGP4 $384
+JUMPV
+LABELV $386
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $388
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $388
+LABELV $383
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $385
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $379
+INDIRI4
+GEI4 $390
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $382
+LABELV $390
+LABELV $384
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $378
+endproc BotNumberInTeam 16 8
+proc GetTeamFlagCarrier 16 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $393
+ADDRLP4 8
+CNSTI4 8
+ASGNI4
+ADDRGP4 $394
+JUMPV
+LABELV $393
+ADDRLP4 8
+CNSTI4 9
+ASGNI4
+LABELV $394
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $398
+JUMPV
+LABELV $395
+ADDRLP4 12
+CNSTI4 832
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 g_entities+520
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $403
+ADDRLP4 12
+INDIRI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $399
+LABELV $403
+ADDRGP4 $396
+JUMPV
+LABELV $399
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 832
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $404
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $391
+JUMPV
+LABELV $404
+LABELV $396
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $398
+ADDRLP4 0
+INDIRI4
+ADDRGP4 maxclients
+INDIRI4
+GEI4 $407
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $395
+LABELV $407
+CNSTI4 -1
+RETI4
+LABELV $391
+endproc GetTeamFlagCarrier 16 0
+lit
+align 4
+LABELV $409
+byte 4 999999
+code
+proc PickBoomieGoal 40 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 $409
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $413
+JUMPV
+LABELV $410
+ADDRLP4 24
+CNSTI4 76
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 boomiespots+68
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $418
+ADDRLP4 24
+INDIRI4
+ADDRGP4 boomiespots+72
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $414
+LABELV $418
+ADDRGP4 $411
+JUMPV
+LABELV $414
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+CNSTI4 76
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 boomiespots+12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $420
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+GEI4 $420
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $420
+LABELV $411
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $413
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numboomiespots
+INDIRI4
+LTI4 $410
+ADDRLP4 8
+INDIRI4
+ADDRGP4 $409
+INDIRI4
+NEI4 $422
+CNSTI4 0
+RETI4
+ADDRGP4 $408
+JUMPV
+LABELV $422
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ARGP4
+CNSTI4 76
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 boomiespots
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6304
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $408
+endproc PickBoomieGoal 40 16
+lit
+align 4
+LABELV $425
+byte 4 999999
+code
+proc PickBambamGoal 40 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 $425
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $429
+JUMPV
+LABELV $426
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 bambamspots+56
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $434
+ADDRLP4 24
+INDIRI4
+ADDRGP4 bambamspots+60
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $430
+LABELV $434
+ADDRGP4 $427
+JUMPV
+LABELV $430
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 bambamspots+12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $436
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+GEI4 $436
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $436
+LABELV $427
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $429
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numbambamspots
+INDIRI4
+LTI4 $426
+ADDRLP4 8
+INDIRI4
+ADDRGP4 $425
+INDIRI4
+NEI4 $438
+CNSTI4 0
+RETI4
+ADDRGP4 $424
+JUMPV
+LABELV $438
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 bambamspots
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6304
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $424
+endproc PickBambamGoal 40 16
+export BotCtfSeekGoals
+proc BotCtfSeekGoals 72 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 18
+NEI4 $441
+ADDRGP4 $440
+JUMPV
+LABELV $441
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 Team_GetFlagStatus
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 Team_GetFlagStatus
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $443
+ADDRFP4 0
+INDIRP4
+CNSTI4 5072
+ADDP4
+INDIRI4
+CNSTI4 30
+GEI4 $445
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $440
+JUMPV
+LABELV $445
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 TeamCount
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $447
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+NEI4 $449
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 20
+EQI4 $440
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 GetDroppedLollyGoal
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $453
+ADDRFP4 0
+INDIRP4
+CNSTI4 6308
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 20
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6372
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRGP4 $440
+JUMPV
+LABELV $453
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 19
+EQI4 $440
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 19
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6372
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6132
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6308
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $440
+JUMPV
+LABELV $449
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $457
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $440
+JUMPV
+LABELV $457
+LABELV $447
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 19
+EQI4 $440
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 19
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6372
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6132
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6308
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $440
+JUMPV
+LABELV $443
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 20
+EQI4 $461
+ADDRFP4 0
+INDIRP4
+CNSTI4 4964
+ADDP4
+INDIRI4
+CNSTI4 40
+LTI4 $463
+ADDRFP4 0
+INDIRP4
+CNSTI4 5072
+ADDP4
+INDIRI4
+CNSTI4 30
+GEI4 $461
+LABELV $463
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $440
+JUMPV
+LABELV $461
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 BotNumberInTeam
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $464
+ADDRLP4 44
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+EQI4 $468
+ADDRLP4 44
+INDIRI4
+CNSTI4 4
+EQI4 $471
+ADDRGP4 $466
+JUMPV
+LABELV $468
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $469
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 $465
+JUMPV
+LABELV $469
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRGP4 $465
+JUMPV
+LABELV $471
+ADDRLP4 0
+CNSTI4 20
+ASGNI4
+ADDRGP4 $465
+JUMPV
+LABELV $466
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRGP4 $465
+JUMPV
+LABELV $464
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $472
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+NEI4 $474
+ADDRLP4 0
+CNSTI4 20
+ASGNI4
+ADDRGP4 $473
+JUMPV
+LABELV $474
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 $473
+JUMPV
+LABELV $472
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+LABELV $473
+LABELV $465
+ADDRLP4 44
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 44
+INDIRI4
+NEI4 $476
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+EQI4 $476
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+NEI4 $478
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $479
+JUMPV
+LABELV $478
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $479
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6308
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6372
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6128
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $477
+JUMPV
+LABELV $476
+ADDRLP4 48
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 48
+INDIRI4
+NEI4 $480
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+EQI4 $480
+ADDRLP4 8
+INDIRI4
+CNSTI4 4
+NEI4 $482
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 GetCTLFlagGoal
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $484
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $440
+JUMPV
+LABELV $484
+LABELV $482
+ADDRFP4 0
+INDIRP4
+CNSTI4 6308
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6372
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRGP4 $481
+JUMPV
+LABELV $480
+ADDRLP4 52
+CNSTI4 20
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 52
+INDIRI4
+NEI4 $486
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $486
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6312
+ADDP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 GetDroppedLollyGoal
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+NEI4 $488
+ADDRGP4 $440
+JUMPV
+LABELV $488
+ADDRFP4 0
+INDIRP4
+CNSTI4 6308
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 20
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6372
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRGP4 $487
+JUMPV
+LABELV $486
+ADDRLP4 56
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 56
+INDIRI4
+NEI4 $490
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+ADDRLP4 56
+INDIRI4
+EQI4 $490
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 GetTeamFlagCarrier
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 -1
+NEI4 $492
+ADDRGP4 $440
+JUMPV
+LABELV $492
+ADDRFP4 0
+INDIRP4
+CNSTI4 6308
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6304
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6376
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6368
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6144
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6372
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6384
+ADDP4
+CNSTI4 112
+ASGNI4
+LABELV $490
+LABELV $487
+LABELV $481
+LABELV $477
+LABELV $440
+endproc BotCtfSeekGoals 72 12
+export GetDroppedLollyGoal
+proc GetDroppedLollyGoal 20 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $498
+ADDRLP4 4
+ADDRGP4 $495
+ASGNP4
+ADDRGP4 $499
+JUMPV
+LABELV $498
+ADDRLP4 4
+ADDRGP4 $496
+ASGNP4
+LABELV $499
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GEI4 $500
+CNSTI4 0
+RETI4
+ADDRGP4 $494
+JUMPV
+LABELV $500
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $504
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $502
+LABELV $504
+CNSTI4 0
+RETI4
+ADDRGP4 $494
+JUMPV
+LABELV $502
+CNSTI4 1
+RETI4
+LABELV $494
+endproc GetDroppedLollyGoal 20 12
+export BotTeamGoals
+proc BotTeamGoals 4 4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $506
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCtfSeekGoals
+CALLV
+pop
+ADDRGP4 $507
+JUMPV
+LABELV $506
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 8
+NEI4 $508
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotBalloonSeekGoals
+CALLV
+pop
+ADDRGP4 $509
+JUMPV
+LABELV $508
+ADDRLP4 0
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+EQI4 $512
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $510
+LABELV $512
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $513
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSyCRetreatGoals
+CALLV
+pop
+ADDRGP4 $514
+JUMPV
+LABELV $513
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSyCSeekGoals
+CALLV
+pop
+LABELV $514
+LABELV $510
+LABELV $509
+LABELV $507
+LABELV $505
+endproc BotTeamGoals 4 4
+export BotPointAreaNum
+proc BotPointAreaNum 68 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $516
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $515
+JUMPV
+LABELV $516
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 64
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LEI4 $519
+ADDRLP4 20
+INDIRI4
+RETI4
+ADDRGP4 $515
+JUMPV
+LABELV $519
+CNSTI4 0
+RETI4
+LABELV $515
+endproc BotPointAreaNum 68 20
+export ClientName
+proc ClientName 1032 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $524
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $522
+LABELV $524
+CNSTI4 3
+ARGI4
+ADDRGP4 $525
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $526
+RETP4
+ADDRGP4 $521
+JUMPV
+LABELV $522
+ADDRFP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $527
+ARGP4
+ADDRLP4 1028
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+RETP4
+LABELV $521
+endproc ClientName 1032 12
+export ClientSkin
+proc ClientSkin 1032 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $531
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $529
+LABELV $531
+CNSTI4 3
+ARGI4
+ADDRGP4 $532
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $526
+RETP4
+ADDRGP4 $528
+JUMPV
+LABELV $529
+ADDRFP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $533
+ARGP4
+ADDRLP4 1028
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+RETP4
+LABELV $528
+endproc ClientSkin 1032 12
+bss
+align 4
+LABELV $535
+skip 4
+export ClientFromName
+code
+proc ClientFromName 1040 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $535
+INDIRI4
+CNSTI4 0
+NEI4 $536
+ADDRGP4 $93
+ARGP4
+ADDRLP4 1028
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $535
+ADDRLP4 1028
+INDIRI4
+ASGNI4
+LABELV $536
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $541
+JUMPV
+LABELV $538
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $527
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+NEI4 $542
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $534
+JUMPV
+LABELV $542
+LABELV $539
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $541
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $535
+INDIRI4
+GEI4 $544
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $538
+LABELV $544
+CNSTI4 -1
+RETI4
+LABELV $534
+endproc ClientFromName 1040 12
+export ClientOnSameTeamFromName
+proc ClientOnSameTeamFromName 1040 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $549
+JUMPV
+LABELV $546
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1028
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 0
+NEI4 $551
+ADDRGP4 $547
+JUMPV
+LABELV $551
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $527
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+NEI4 $553
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $545
+JUMPV
+LABELV $553
+LABELV $547
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $549
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $546
+CNSTI4 -1
+RETI4
+LABELV $545
+endproc ClientOnSameTeamFromName 1040 12
+lit
+align 1
+LABELV $556
+byte 1 0
+skip 127
+export EasyClientName
+code
+proc EasyClientName 196 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 5
+ADDRGP4 $556
+INDIRB
+ASGNB 128
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 5
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 136
+CNSTI4 0
+ASGNI4
+ADDRGP4 $560
+JUMPV
+LABELV $557
+ADDRLP4 148
+ADDRLP4 136
+INDIRI4
+ADDRLP4 5
+ADDP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ADDRLP4 148
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 127
+BANDI4
+CVII1 4
+ASGNI1
+LABELV $558
+ADDRLP4 136
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $560
+ADDRLP4 136
+INDIRI4
+ADDRLP4 5
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $557
+ADDRLP4 5
+ARGP4
+ADDRGP4 $565
+ARGP4
+ADDRLP4 152
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRGP4 $564
+JUMPV
+LABELV $561
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 156
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $562
+ADDRLP4 5
+ARGP4
+ADDRGP4 $565
+ARGP4
+ADDRLP4 156
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 156
+INDIRP4
+ASGNP4
+LABELV $564
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $561
+ADDRLP4 5
+ARGP4
+ADDRGP4 $566
+ARGP4
+ADDRLP4 160
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 140
+ADDRLP4 160
+INDIRP4
+ASGNP4
+ADDRLP4 5
+ARGP4
+ADDRGP4 $567
+ARGP4
+ADDRLP4 164
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 144
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRLP4 168
+CNSTU4 0
+ASGNU4
+ADDRLP4 140
+INDIRP4
+CVPU4 4
+ADDRLP4 168
+INDIRU4
+EQU4 $568
+ADDRLP4 144
+INDIRP4
+CVPU4 4
+ADDRLP4 168
+INDIRU4
+EQU4 $568
+ADDRLP4 144
+INDIRP4
+CVPU4 4
+ADDRLP4 140
+INDIRP4
+CVPU4 4
+LEU4 $570
+ADDRLP4 144
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 172
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRGP4 $571
+JUMPV
+LABELV $570
+ADDRLP4 140
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 140
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 176
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $571
+LABELV $568
+ADDRLP4 172
+ADDRLP4 5
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 109
+EQI4 $576
+ADDRLP4 172
+INDIRI4
+CNSTI4 77
+NEI4 $572
+LABELV $576
+ADDRLP4 5+1
+INDIRI1
+CVII4 1
+CNSTI4 114
+EQI4 $577
+ADDRLP4 5+1
+INDIRI1
+CVII4 1
+CNSTI4 82
+NEI4 $572
+LABELV $577
+ADDRLP4 5+2
+ARGP4
+ADDRLP4 176
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 5
+ARGP4
+ADDRLP4 5+2
+ARGP4
+ADDRLP4 176
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $572
+ADDRLP4 0
+ADDRLP4 5
+ASGNP4
+ADDRGP4 $581
+JUMPV
+LABELV $580
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 176
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 97
+LTI4 $586
+ADDRLP4 176
+INDIRI4
+CNSTI4 122
+LEI4 $587
+LABELV $586
+ADDRLP4 180
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 48
+LTI4 $588
+ADDRLP4 180
+INDIRI4
+CNSTI4 57
+LEI4 $587
+LABELV $588
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 95
+NEI4 $583
+LABELV $587
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $584
+JUMPV
+LABELV $583
+ADDRLP4 184
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 65
+LTI4 $589
+ADDRLP4 184
+INDIRI4
+CNSTI4 90
+GTI4 $589
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+ADDI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $590
+JUMPV
+LABELV $589
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 188
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $590
+LABELV $584
+LABELV $581
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $580
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 5
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+RETP4
+LABELV $555
+endproc EasyClientName 196 12
+export BotChooseWeapon
+proc BotChooseWeapon 32 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 356
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $592
+ADDRFP4 0
+INDIRP4
+CNSTI4 6260
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6260
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_SelectWeapon
+CALLV
+pop
+ADDRGP4 $591
+JUMPV
+LABELV $592
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $596
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $594
+LABELV $596
+ADDRFP4 0
+INDIRP4
+CNSTI4 6260
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4952
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $597
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6260
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_SelectWeapon
+CALLV
+pop
+ADDRGP4 $595
+JUMPV
+LABELV $597
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChooseWeapon
+CALLV
+pop
+ADDRGP4 $591
+JUMPV
+LABELV $594
+ADDRFP4 0
+INDIRP4
+CNSTI4 6236
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4952
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_BotChooseBestFightWeapon
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 3
+EQI4 $601
+ADDRLP4 20
+INDIRI4
+CNSTI4 7
+NEI4 $599
+LABELV $601
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $602
+ADDRLP4 8
+INDIRI4
+CNSTI4 12
+EQI4 $602
+ADDRLP4 8
+CNSTI4 12
+ASGNI4
+ADDRGP4 $603
+JUMPV
+LABELV $602
+ADDRLP4 8
+INDIRI4
+CNSTI4 12
+NEI4 $604
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+LABELV $604
+LABELV $603
+LABELV $599
+ADDRGP4 g_modInstagib+12
+INDIRI4
+CNSTI4 0
+EQI4 $606
+ADDRLP4 8
+INDIRI4
+CNSTI4 12
+EQI4 $606
+ADDRLP4 24
+ADDRGP4 Instagib_getSpawnWeapon
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6260
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6260
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_SelectWeapon
+CALLV
+pop
+ADDRGP4 $591
+JUMPV
+LABELV $606
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4952
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $609
+ADDRGP4 $591
+JUMPV
+LABELV $609
+ADDRFP4 0
+INDIRP4
+CNSTI4 6260
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $611
+ADDRFP4 0
+INDIRP4
+CNSTI4 6160
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $611
+ADDRFP4 0
+INDIRP4
+CNSTI4 6260
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6260
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_SelectWeapon
+CALLV
+pop
+LABELV $595
+LABELV $591
+endproc BotChooseWeapon 32 8
+export BotSetupForMovement
+proc BotSetupForMovement 92 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 68
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+8
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 0+24
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 0+24+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0+36
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+40
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+44
+ADDRFP4 0
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+CNSTI4 1023
+EQI4 $625
+ADDRLP4 0+64
+ADDRLP4 0+64
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $625
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+ADDRLP4 80
+INDIRI4
+EQI4 $628
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+LEI4 $628
+ADDRLP4 0+64
+ADDRLP4 0+64
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $628
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+ADDRLP4 88
+INDIRI4
+EQI4 $631
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 88
+INDIRI4
+LEI4 $631
+ADDRLP4 0+64
+ADDRLP4 0+64
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+LABELV $631
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $634
+ADDRLP4 0+48
+CNSTI4 4
+ASGNI4
+ADDRGP4 $635
+JUMPV
+LABELV $634
+ADDRLP4 0+48
+CNSTI4 2
+ASGNI4
+LABELV $635
+ADDRFP4 0
+INDIRP4
+CNSTI4 6048
+ADDP4
+INDIRF4
+CNSTF4 1056964608
+LEF4 $638
+ADDRLP4 0+64
+ADDRLP4 0+64
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+LABELV $638
+ADDRLP4 0+52
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotInitMoveState
+CALLV
+pop
+LABELV $613
+endproc BotSetupForMovement 92 12
+export BotCalcWeapEquip
+proc BotCalcWeapEquip 4 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4952
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $643
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4952
+ADDP4
+ADDP4
+INDIRI4
+ADDRFP4 12
+INDIRI4
+LEI4 $645
+ADDRLP4 0
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $646
+JUMPV
+LABELV $645
+ADDRLP4 0
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4952
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $646
+CNSTF4 1120403456
+ADDRLP4 0
+INDIRI4
+ADDRFP4 12
+INDIRI4
+DIVI4
+CVIF4 4
+MULF4
+CVFI4 4
+RETI4
+ADDRGP4 $642
+JUMPV
+LABELV $643
+CNSTI4 0
+RETI4
+LABELV $642
+endproc BotCalcWeapEquip 4 0
+export BotUpdateInventory
+proc BotUpdateInventory 1292 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4952
+ADDP4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4956
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $649
+ADDRLP4 1032
+CNSTI4 1
+ASGNI4
+ADDRGP4 $650
+JUMPV
+LABELV $649
+ADDRLP4 1032
+CNSTI4 0
+ASGNI4
+LABELV $650
+ADDRFP4 0
+INDIRP4
+CNSTI4 4968
+ADDP4
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $652
+ADDRLP4 1040
+CNSTI4 1
+ASGNI4
+ADDRGP4 $653
+JUMPV
+LABELV $652
+ADDRLP4 1040
+CNSTI4 0
+ASGNI4
+LABELV $653
+ADDRFP4 0
+INDIRP4
+CNSTI4 4972
+ADDP4
+ADDRLP4 1040
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $655
+ADDRLP4 1048
+CNSTI4 1
+ASGNI4
+ADDRGP4 $656
+JUMPV
+LABELV $655
+ADDRLP4 1048
+CNSTI4 0
+ASGNI4
+LABELV $656
+ADDRFP4 0
+INDIRP4
+CNSTI4 4976
+ADDP4
+ADDRLP4 1048
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $658
+ADDRLP4 1056
+CNSTI4 1
+ASGNI4
+ADDRGP4 $659
+JUMPV
+LABELV $658
+ADDRLP4 1056
+CNSTI4 0
+ASGNI4
+LABELV $659
+ADDRFP4 0
+INDIRP4
+CNSTI4 4980
+ADDP4
+ADDRLP4 1056
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $661
+ADDRLP4 1064
+CNSTI4 1
+ASGNI4
+ADDRGP4 $662
+JUMPV
+LABELV $661
+ADDRLP4 1064
+CNSTI4 0
+ASGNI4
+LABELV $662
+ADDRFP4 0
+INDIRP4
+CNSTI4 4984
+ADDP4
+ADDRLP4 1064
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $664
+ADDRLP4 1072
+CNSTI4 1
+ASGNI4
+ADDRGP4 $665
+JUMPV
+LABELV $664
+ADDRLP4 1072
+CNSTI4 0
+ASGNI4
+LABELV $665
+ADDRFP4 0
+INDIRP4
+CNSTI4 4988
+ADDP4
+ADDRLP4 1072
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $667
+ADDRLP4 1080
+CNSTI4 1
+ASGNI4
+ADDRGP4 $668
+JUMPV
+LABELV $667
+ADDRLP4 1080
+CNSTI4 0
+ASGNI4
+LABELV $668
+ADDRFP4 0
+INDIRP4
+CNSTI4 4992
+ADDP4
+ADDRLP4 1080
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $670
+ADDRLP4 1088
+CNSTI4 1
+ASGNI4
+ADDRGP4 $671
+JUMPV
+LABELV $670
+ADDRLP4 1088
+CNSTI4 0
+ASGNI4
+LABELV $671
+ADDRFP4 0
+INDIRP4
+CNSTI4 4996
+ADDP4
+ADDRLP4 1088
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $673
+ADDRLP4 1096
+CNSTI4 1
+ASGNI4
+ADDRGP4 $674
+JUMPV
+LABELV $673
+ADDRLP4 1096
+CNSTI4 0
+ASGNI4
+LABELV $674
+ADDRFP4 0
+INDIRP4
+CNSTI4 5000
+ADDP4
+ADDRLP4 1096
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $676
+ADDRLP4 1104
+CNSTI4 1
+ASGNI4
+ADDRGP4 $677
+JUMPV
+LABELV $676
+ADDRLP4 1104
+CNSTI4 0
+ASGNI4
+LABELV $677
+ADDRFP4 0
+INDIRP4
+CNSTI4 5012
+ADDP4
+ADDRLP4 1104
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $679
+ADDRLP4 1112
+CNSTI4 1
+ASGNI4
+ADDRGP4 $680
+JUMPV
+LABELV $679
+ADDRLP4 1112
+CNSTI4 0
+ASGNI4
+LABELV $680
+ADDRFP4 0
+INDIRP4
+CNSTI4 5016
+ADDP4
+ADDRLP4 1112
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5024
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 400
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5028
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 404
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5032
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 408
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5048
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5040
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 416
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5036
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 412
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5044
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 420
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5052
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 428
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5140
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5072
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 26
+NEI4 $682
+ADDRLP4 1160
+CNSTI4 1
+ASGNI4
+ADDRGP4 $683
+JUMPV
+LABELV $682
+ADDRLP4 1160
+CNSTI4 0
+ASGNI4
+LABELV $683
+ADDRFP4 0
+INDIRP4
+CNSTI4 5084
+ADDP4
+ADDRLP4 1160
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 27
+NEI4 $685
+ADDRLP4 1168
+CNSTI4 1
+ASGNI4
+ADDRGP4 $686
+JUMPV
+LABELV $685
+ADDRLP4 1168
+CNSTI4 0
+ASGNI4
+LABELV $686
+ADDRFP4 0
+INDIRP4
+CNSTI4 5088
+ADDP4
+ADDRLP4 1168
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 28
+NEI4 $688
+ADDRLP4 1176
+CNSTI4 1
+ASGNI4
+ADDRGP4 $689
+JUMPV
+LABELV $688
+ADDRLP4 1176
+CNSTI4 0
+ASGNI4
+LABELV $689
+ADDRFP4 0
+INDIRP4
+CNSTI4 5144
+ADDP4
+ADDRLP4 1176
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 29
+NEI4 $691
+ADDRLP4 1184
+CNSTI4 1
+ASGNI4
+ADDRGP4 $692
+JUMPV
+LABELV $691
+ADDRLP4 1184
+CNSTI4 0
+ASGNI4
+LABELV $692
+ADDRFP4 0
+INDIRP4
+CNSTI4 5148
+ADDP4
+ADDRLP4 1184
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 336
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $694
+ADDRLP4 1192
+CNSTI4 1
+ASGNI4
+ADDRGP4 $695
+JUMPV
+LABELV $694
+ADDRLP4 1192
+CNSTI4 0
+ASGNI4
+LABELV $695
+ADDRFP4 0
+INDIRP4
+CNSTI4 5092
+ADDP4
+ADDRLP4 1192
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 340
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $697
+ADDRLP4 1200
+CNSTI4 1
+ASGNI4
+ADDRGP4 $698
+JUMPV
+LABELV $697
+ADDRLP4 1200
+CNSTI4 0
+ASGNI4
+LABELV $698
+ADDRFP4 0
+INDIRP4
+CNSTI4 5096
+ADDP4
+ADDRLP4 1200
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $700
+ADDRLP4 1208
+CNSTI4 1
+ASGNI4
+ADDRGP4 $701
+JUMPV
+LABELV $700
+ADDRLP4 1208
+CNSTI4 0
+ASGNI4
+LABELV $701
+ADDRFP4 0
+INDIRP4
+CNSTI4 5100
+ADDP4
+ADDRLP4 1208
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 344
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $703
+ADDRLP4 1216
+CNSTI4 1
+ASGNI4
+ADDRGP4 $704
+JUMPV
+LABELV $703
+ADDRLP4 1216
+CNSTI4 0
+ASGNI4
+LABELV $704
+ADDRFP4 0
+INDIRP4
+CNSTI4 5104
+ADDP4
+ADDRLP4 1216
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $706
+ADDRLP4 1224
+CNSTI4 1
+ASGNI4
+ADDRGP4 $707
+JUMPV
+LABELV $706
+ADDRLP4 1224
+CNSTI4 0
+ASGNI4
+LABELV $707
+ADDRFP4 0
+INDIRP4
+CNSTI4 5108
+ADDP4
+ADDRLP4 1224
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 352
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $709
+ADDRLP4 1232
+CNSTI4 1
+ASGNI4
+ADDRGP4 $710
+JUMPV
+LABELV $709
+ADDRLP4 1232
+CNSTI4 0
+ASGNI4
+LABELV $710
+ADDRFP4 0
+INDIRP4
+CNSTI4 5112
+ADDP4
+ADDRLP4 1232
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 360
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $712
+ADDRLP4 1240
+CNSTI4 1
+ASGNI4
+ADDRGP4 $713
+JUMPV
+LABELV $712
+ADDRLP4 1240
+CNSTI4 0
+ASGNI4
+LABELV $713
+ADDRFP4 0
+INDIRP4
+CNSTI4 5132
+ADDP4
+ADDRLP4 1240
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 364
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $715
+ADDRLP4 1248
+CNSTI4 1
+ASGNI4
+ADDRGP4 $716
+JUMPV
+LABELV $715
+ADDRLP4 1248
+CNSTI4 0
+ASGNI4
+LABELV $716
+ADDRFP4 0
+INDIRP4
+CNSTI4 5136
+ADDP4
+ADDRLP4 1248
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4960
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 6
+ARGI4
+CNSTI4 19
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRLP4 1260
+ADDRGP4 BotCalcWeapEquip
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1260
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 7
+ARGI4
+CNSTI4 20
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRLP4 1264
+ADDRGP4 BotCalcWeapEquip
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1264
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 8
+ARGI4
+CNSTI4 21
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRLP4 1268
+ADDRGP4 BotCalcWeapEquip
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1268
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 9
+ARGI4
+CNSTI4 22
+ARGI4
+CNSTI4 50
+ARGI4
+ADDRLP4 1272
+ADDRGP4 BotCalcWeapEquip
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1272
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1276
+CNSTI4 10
+ASGNI4
+ADDRLP4 1276
+INDIRI4
+ARGI4
+CNSTI4 23
+ARGI4
+ADDRLP4 1276
+INDIRI4
+ARGI4
+ADDRLP4 1280
+ADDRGP4 BotCalcWeapEquip
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1280
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 11
+ARGI4
+CNSTI4 24
+ARGI4
+CNSTI4 50
+ARGI4
+ADDRLP4 1284
+ADDRGP4 BotCalcWeapEquip
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1284
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 12
+ARGI4
+CNSTI4 25
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 1288
+ADDRGP4 BotCalcWeapEquip
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1288
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5016
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $717
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 100
+ADDI4
+ASGNI4
+LABELV $717
+ADDRFP4 0
+INDIRP4
+CNSTI4 4964
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $647
+endproc BotUpdateInventory 1292 16
+export BotUpdateBattleInventory
+proc BotUpdateBattleInventory 160 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $720
+ADDRGP4 $719
+JUMPV
+LABELV $720
+ADDRLP4 0
+ADDRLP4 12+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5148
+ADDP4
+ADDRLP4 0+8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 156
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5144
+ADDP4
+ADDRLP4 156
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $719
+endproc BotUpdateBattleInventory 160 8
+export BotUseKillerducks
+proc BotUseKillerducks 12 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8404
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $731
+ADDRGP4 $730
+JUMPV
+LABELV $731
+ADDRFP4 0
+INDIRP4
+CNSTI4 8404
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5088
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $733
+ADDRGP4 $730
+JUMPV
+LABELV $733
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTF4 1135542272
+ARGF4
+ADDRGP4 BotVisibleTeamMatesAndEnemies
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $735
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $735
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8404
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ASGNF4
+LABELV $735
+LABELV $730
+endproc BotUseKillerducks 12 16
+lit
+align 4
+LABELV $738
+byte 4 3245342720
+byte 4 3245342720
+byte 4 3221225472
+align 4
+LABELV $739
+byte 4 1097859072
+byte 4 1097859072
+byte 4 1073741824
+export BotBattleUseItems
+code
+proc BotBattleUseItems 472 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 336
+ADDRGP4 $738
+INDIRB
+ASGNB 12
+ADDRLP4 348
+ADDRGP4 $739
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotUseKillerducks
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5084
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $740
+ADDRGP4 $737
+JUMPV
+LABELV $740
+ADDRFP4 0
+INDIRP4
+CNSTI4 5144
+ADDP4
+INDIRI4
+CNSTI4 400
+LEI4 $742
+ADDRGP4 $737
+JUMPV
+LABELV $742
+ADDRLP4 328
+CNSTI4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 5148
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 164+8
+ADDRLP4 164+8
+INDIRF4
+CNSTF4 1120403456
+ADDF4
+ASGNF4
+ADDRLP4 152
+ADDRLP4 164
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 152+4
+ADDRLP4 164+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 152+8
+ADDRLP4 164+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $749
+ADDRGP4 $737
+JUMPV
+LABELV $749
+ADDRLP4 140
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 0+60
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 0+60+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 0+60+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 152
+INDIRF4
+ADDRLP4 140
+INDIRF4
+MULF4
+ADDRLP4 152+4
+INDIRF4
+ADDRLP4 140+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 152+8
+INDIRF4
+ADDRLP4 140+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 0
+GEF4 $768
+ADDRLP4 456
+CNSTI4 1
+ASGNI4
+ADDRGP4 $769
+JUMPV
+LABELV $768
+ADDRLP4 456
+CNSTI4 0
+ASGNI4
+LABELV $769
+ADDRLP4 332
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 176
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+NEI4 $770
+ADDRGP4 $737
+JUMPV
+LABELV $770
+ADDRLP4 316
+ADDRLP4 176+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 316+4
+ADDRLP4 176+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 316+8
+ADDRLP4 176+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 316
+ARGP4
+CNSTF4 1137180672
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+pop
+ADDRLP4 328
+INDIRF4
+CNSTF4 1128792064
+GEF4 $779
+ADDRLP4 364
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 336
+ARGP4
+ADDRLP4 348
+ARGP4
+ADDRLP4 164
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 4259841
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 364+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $737
+ADDRLP4 328
+INDIRF4
+CNSTF4 1125515264
+LEF4 $784
+ADDRLP4 332
+INDIRI4
+CNSTI4 0
+NEI4 $784
+ADDRLP4 468
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 360
+CNSTF4 1073741824
+ADDRLP4 468
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 360
+INDIRF4
+CNSTF4 1050253722
+LEF4 $737
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRGP4 $737
+JUMPV
+LABELV $784
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRGP4 $737
+JUMPV
+LABELV $779
+ADDRLP4 328
+INDIRF4
+CNSTF4 1132068864
+GEF4 $788
+ADDRLP4 332
+INDIRI4
+CNSTI4 0
+EQI4 $788
+ADDRLP4 464
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 360
+CNSTF4 1073741824
+ADDRLP4 464
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 360
+INDIRF4
+CNSTF4 1045220557
+LEF4 $790
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+LABELV $790
+LABELV $788
+LABELV $737
+endproc BotBattleUseItems 472 28
+export BotSetTeleportTime
+proc BotSetTeleportTime 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRI4
+BXORI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $793
+ADDRFP4 0
+INDIRP4
+CNSTI4 6152
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $793
+ADDRFP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $792
+endproc BotSetTeleportTime 8 0
+export BotIsDead
+proc BotIsDead 4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $797
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $798
+JUMPV
+LABELV $797
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $798
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $795
+endproc BotIsDead 4 0
+export BotIsObserver
+proc BotIsObserver 1032 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $800
+CNSTI4 1
+RETI4
+ADDRGP4 $799
+JUMPV
+LABELV $800
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $804
+ARGP4
+ADDRLP4 1024
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRLP4 1028
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 3
+NEI4 $802
+CNSTI4 1
+RETI4
+ADDRGP4 $799
+JUMPV
+LABELV $802
+CNSTI4 0
+RETI4
+LABELV $799
+endproc BotIsObserver 1032 12
+export BotIntermission
+proc BotIntermission 8 0
+ADDRGP4 level+9168
+INDIRI4
+CNSTI4 0
+EQI4 $806
+CNSTI4 1
+RETI4
+ADDRGP4 $805
+JUMPV
+LABELV $806
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+EQI4 $812
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+NEI4 $810
+LABELV $812
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $811
+JUMPV
+LABELV $810
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $811
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $805
+endproc BotIntermission 8 0
+export BotInLavaOrSlime
+proc BotInLavaOrSlime 16 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1102577664
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 24
+BANDI4
+RETI4
+LABELV $813
+endproc BotInLavaOrSlime 16 4
+export TeamPlayIsOn
+proc TeamPlayIsOn 4 0
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+LTI4 $817
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $818
+JUMPV
+LABELV $817
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $818
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $815
+endproc TeamPlayIsOn 4 0
+export BotAggression
+proc BotAggression 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5092
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $820
+ADDRFP4 0
+INDIRP4
+CNSTI4 6260
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $824
+ADDRFP4 0
+INDIRP4
+CNSTI4 5144
+ADDP4
+INDIRI4
+CNSTI4 80
+GEI4 $822
+LABELV $824
+CNSTF4 1116471296
+RETF4
+ADDRGP4 $819
+JUMPV
+LABELV $822
+LABELV $820
+ADDRFP4 0
+INDIRP4
+CNSTI4 5148
+ADDP4
+INDIRI4
+CNSTI4 200
+LEI4 $825
+CNSTF4 0
+RETF4
+ADDRGP4 $819
+JUMPV
+LABELV $825
+ADDRFP4 0
+INDIRP4
+CNSTI4 5072
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $827
+CNSTF4 0
+RETF4
+ADDRGP4 $819
+JUMPV
+LABELV $827
+ADDRFP4 0
+INDIRP4
+CNSTI4 5072
+ADDP4
+INDIRI4
+CNSTI4 80
+GEI4 $829
+ADDRFP4 0
+INDIRP4
+CNSTI4 4956
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $831
+CNSTF4 0
+RETF4
+ADDRGP4 $819
+JUMPV
+LABELV $831
+LABELV $829
+ADDRFP4 0
+INDIRP4
+CNSTI4 5016
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $833
+CNSTF4 1120403456
+RETF4
+ADDRGP4 $819
+JUMPV
+LABELV $833
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5000
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LEI4 $835
+ADDRFP4 0
+INDIRP4
+CNSTI4 5052
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LEI4 $835
+CNSTF4 1120403456
+RETF4
+ADDRGP4 $819
+JUMPV
+LABELV $835
+ADDRFP4 0
+INDIRP4
+CNSTI4 4992
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $837
+ADDRFP4 0
+INDIRP4
+CNSTI4 5044
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $837
+CNSTF4 1119748096
+RETF4
+ADDRGP4 $819
+JUMPV
+LABELV $837
+ADDRFP4 0
+INDIRP4
+CNSTI4 4988
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $839
+ADDRFP4 0
+INDIRP4
+CNSTI4 5040
+ADDP4
+INDIRI4
+CNSTI4 50
+LEI4 $839
+CNSTF4 1119092736
+RETF4
+ADDRGP4 $819
+JUMPV
+LABELV $839
+ADDRFP4 0
+INDIRP4
+CNSTI4 4984
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $841
+ADDRFP4 0
+INDIRP4
+CNSTI4 5036
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $841
+CNSTF4 1119092736
+RETF4
+ADDRGP4 $819
+JUMPV
+LABELV $841
+ADDRFP4 0
+INDIRP4
+CNSTI4 4996
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $843
+ADDRFP4 0
+INDIRP4
+CNSTI4 5048
+ADDP4
+INDIRI4
+CNSTI4 40
+LEI4 $843
+CNSTF4 1118437376
+RETF4
+ADDRGP4 $819
+JUMPV
+LABELV $843
+ADDRFP4 0
+INDIRP4
+CNSTI4 4980
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $845
+ADDRFP4 0
+INDIRP4
+CNSTI4 5032
+ADDP4
+INDIRI4
+CNSTI4 10
+LEI4 $845
+CNSTF4 1117782016
+RETF4
+ADDRGP4 $819
+JUMPV
+LABELV $845
+ADDRFP4 0
+INDIRP4
+CNSTI4 4976
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $847
+ADDRFP4 0
+INDIRP4
+CNSTI4 5028
+ADDP4
+INDIRI4
+CNSTI4 10
+LEI4 $847
+CNSTF4 1112014848
+RETF4
+ADDRGP4 $819
+JUMPV
+LABELV $847
+CNSTF4 0
+RETF4
+LABELV $819
+endproc BotAggression 32 0
+export BotFeelingBad
+proc BotFeelingBad 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6260
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $850
+CNSTF4 1120403456
+RETF4
+ADDRGP4 $849
+JUMPV
+LABELV $850
+ADDRFP4 0
+INDIRP4
+CNSTI4 5072
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $852
+CNSTF4 1120403456
+RETF4
+ADDRGP4 $849
+JUMPV
+LABELV $852
+ADDRFP4 0
+INDIRP4
+CNSTI4 6260
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $854
+CNSTF4 1119092736
+RETF4
+ADDRGP4 $849
+JUMPV
+LABELV $854
+ADDRFP4 0
+INDIRP4
+CNSTI4 5072
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $856
+CNSTF4 1117782016
+RETF4
+ADDRGP4 $849
+JUMPV
+LABELV $856
+CNSTF4 0
+RETF4
+LABELV $849
+endproc BotFeelingBad 0 0
+export BotWantsToRetreat
+proc BotWantsToRetreat 156 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $859
+ADDRLP4 140
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 19
+EQI4 $864
+ADDRLP4 140
+INDIRI4
+CNSTI4 4
+EQI4 $864
+ADDRLP4 140
+INDIRI4
+CNSTI4 20
+NEI4 $860
+LABELV $864
+CNSTI4 1
+RETI4
+ADDRGP4 $858
+JUMPV
+LABELV $859
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 8
+NEI4 $865
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 13
+NEI4 $867
+CNSTI4 1
+RETI4
+ADDRGP4 $858
+JUMPV
+LABELV $867
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $866
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6324
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 144
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 250
+LEI4 $866
+CNSTI4 1
+RETI4
+ADDRGP4 $858
+JUMPV
+LABELV $865
+ADDRLP4 140
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 7
+EQI4 $873
+ADDRLP4 140
+INDIRI4
+CNSTI4 3
+NEI4 $871
+LABELV $873
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 144
+ADDRGP4 IsWall
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $874
+CNSTI4 1
+RETI4
+ADDRGP4 $858
+JUMPV
+LABELV $874
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $876
+CNSTI4 0
+RETI4
+ADDRGP4 $858
+JUMPV
+LABELV $876
+ADDRLP4 0
+ARGP4
+ADDRLP4 148
+ADDRGP4 EntityCarriesCarts
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $878
+CNSTI4 1
+RETI4
+ADDRGP4 $858
+JUMPV
+LABELV $878
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $880
+CNSTI4 0
+RETI4
+ADDRGP4 $858
+JUMPV
+LABELV $880
+ADDRLP4 0
+ARGP4
+ADDRLP4 152
+ADDRGP4 EntityCarriesCarts
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $882
+CNSTI4 0
+RETI4
+ADDRGP4 $858
+JUMPV
+LABELV $882
+LABELV $871
+LABELV $866
+LABELV $860
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 BotAggression
+CALLF4
+ASGNF4
+ADDRLP4 144
+INDIRF4
+CNSTF4 1112014848
+GEF4 $884
+CNSTI4 1
+RETI4
+ADDRGP4 $858
+JUMPV
+LABELV $884
+CNSTI4 0
+RETI4
+LABELV $858
+endproc BotWantsToRetreat 156 16
+export BotWantsToChase
+proc BotWantsToChase 292 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $887
+ADDRLP4 280
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 19
+EQI4 $892
+ADDRLP4 280
+INDIRI4
+CNSTI4 4
+EQI4 $892
+ADDRLP4 280
+INDIRI4
+CNSTI4 20
+NEI4 $888
+LABELV $892
+CNSTI4 0
+RETI4
+ADDRGP4 $886
+JUMPV
+LABELV $887
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 8
+NEI4 $893
+ADDRLP4 280
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 3
+EQI4 $897
+ADDRLP4 280
+INDIRI4
+CNSTI4 13
+NEI4 $894
+LABELV $897
+CNSTI4 0
+RETI4
+ADDRGP4 $886
+JUMPV
+LABELV $893
+ADDRLP4 280
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 7
+EQI4 $900
+ADDRLP4 280
+INDIRI4
+CNSTI4 3
+NEI4 $898
+LABELV $900
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $901
+CNSTI4 0
+RETI4
+ADDRGP4 $886
+JUMPV
+LABELV $901
+ADDRLP4 0
+ARGP4
+ADDRLP4 284
+ADDRGP4 EntityCarriesCarts
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+EQI4 $903
+CNSTI4 0
+RETI4
+ADDRGP4 $886
+JUMPV
+LABELV $903
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 140
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+NEI4 $905
+CNSTI4 0
+RETI4
+ADDRGP4 $886
+JUMPV
+LABELV $905
+ADDRLP4 140
+ARGP4
+ADDRLP4 288
+ADDRGP4 EntityCarriesCarts
+CALLI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+EQI4 $907
+CNSTI4 1
+RETI4
+ADDRGP4 $886
+JUMPV
+LABELV $907
+LABELV $898
+LABELV $894
+LABELV $888
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 284
+ADDRGP4 BotAggression
+CALLF4
+ASGNF4
+ADDRLP4 284
+INDIRF4
+CNSTF4 1112014848
+LEF4 $909
+CNSTI4 1
+RETI4
+ADDRGP4 $886
+JUMPV
+LABELV $909
+CNSTI4 0
+RETI4
+LABELV $886
+endproc BotWantsToChase 292 8
+export BotWantsToHelp
+proc BotWantsToHelp 0 0
+CNSTI4 1
+RETI4
+LABELV $911
+endproc BotWantsToHelp 0 0
+proc BotDontAvoid 68 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 $914
+JUMPV
+LABELV $913
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4+44
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveFromAvoidGoals
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 64
+INDIRI4
+ASGNI4
+LABELV $914
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $913
+LABELV $912
+endproc BotDontAvoid 68 12
+proc BotGoForPowerups 0 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $918
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $919
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $920
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $921
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $922
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $923
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $924
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $925
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6060
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $917
+endproc BotGoForPowerups 0 8
+export BotRoamGoal
+proc BotRoamGoal 180 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+LABELV $927
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 136
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 112
+ADDRLP4 136
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+ASGNF4
+ADDRLP4 112
+INDIRF4
+CNSTF4 1048576000
+LEF4 $931
+ADDRLP4 140
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+GEF4 $933
+ADDRLP4 144
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 144
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+SUBF4
+ASGNF4
+ADDRGP4 $934
+JUMPV
+LABELV $933
+ADDRLP4 148
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 148
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+ADDF4
+ASGNF4
+LABELV $934
+LABELV $931
+ADDRLP4 112
+INDIRF4
+CNSTF4 1061158912
+GEF4 $935
+ADDRLP4 140
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+GEF4 $937
+ADDRLP4 144
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 144
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+SUBF4
+ASGNF4
+ADDRGP4 $938
+JUMPV
+LABELV $937
+ADDRLP4 148
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 148
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+ADDF4
+ASGNF4
+LABELV $938
+LABELV $935
+ADDRLP4 140
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1119879168
+CNSTF4 1073741824
+ADDRLP4 140
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 148
+CNSTP4 0
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 24+12
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24+12+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 24+12+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 156
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 108
+ADDRLP4 156
+INDIRF4
+ASGNF4
+ADDRLP4 108
+INDIRF4
+CNSTF4 1128792064
+LEF4 $949
+ADDRLP4 164
+CNSTF4 1109393408
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDRLP4 164
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDRLP4 164
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+MULF4
+CNSTF4 1109393408
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 120
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 120+4
+ADDRLP4 12+4
+INDIRF4
+ASGNF4
+ADDRLP4 120+8
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1145569280
+SUBF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 172
+CNSTP4 0
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 120
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 24+4
+INDIRI4
+CNSTI4 0
+NEI4 $966
+ADDRLP4 24+12+8
+ADDRLP4 24+12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 24+12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 176
+ADDRGP4 trap_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 132
+ADDRLP4 176
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 24
+BANDI4
+CNSTI4 0
+NEI4 $972
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 12
+ADDRGP4 $926
+JUMPV
+LABELV $972
+LABELV $966
+LABELV $949
+LABELV $928
+ADDRLP4 116
+ADDRLP4 116
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 10
+LTI4 $927
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 12
+LABELV $926
+endproc BotRoamGoal 180 28
+lit
+align 4
+LABELV $976
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export BotAttackMove
+code
+proc BotAttackMove 396 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 56
+ADDRGP4 $976
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 6108
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $977
+ADDRLP4 276+40
+ADDRFP4 4
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 276+12
+ADDRFP4 4
+INDIRP4
+CNSTI4 6244
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 276
+ADDRFP4 4
+INDIRP4
+CNSTI4 6248
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 276+16
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 276+16+4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 276+16+8
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 276+28
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 276+28+4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 276+28+8
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 72
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 276
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 72
+INDIRB
+ASGNB 52
+ADDRGP4 $974
+JUMPV
+LABELV $977
+ADDRLP4 72
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 52
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 344
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 132
+ADDRLP4 344
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 37
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 348
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 336
+ADDRLP4 348
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 36
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 352
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 340
+ADDRLP4 352
+INDIRF4
+ASGNF4
+ADDRLP4 132
+INDIRF4
+CNSTF4 1045220557
+GEF4 $991
+ADDRFP4 0
+INDIRP4
+ADDRLP4 72
+INDIRB
+ASGNB 52
+ADDRGP4 $974
+JUMPV
+LABELV $991
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 136
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+NEI4 $993
+ADDRFP4 0
+INDIRP4
+ADDRLP4 72
+INDIRB
+ASGNB 52
+ADDRGP4 $974
+JUMPV
+LABELV $993
+ADDRLP4 24
+ADDRLP4 136+24
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 136+24+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 136+24+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 360
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 360
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 24
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 36+4
+ADDRLP4 24+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 36+8
+ADDRLP4 24+8
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6104
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $1006
+ADDRLP4 364
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 364
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+ADDRLP4 336
+INDIRF4
+GEF4 $1008
+ADDRLP4 52
+CNSTI4 4
+ASGNI4
+ADDRGP4 $1009
+JUMPV
+LABELV $1008
+ADDRFP4 4
+INDIRP4
+CNSTI4 6104
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $1010
+ADDRLP4 368
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 368
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+ADDRLP4 340
+INDIRF4
+GEF4 $1010
+ADDRFP4 4
+INDIRP4
+CNSTI4 6104
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDRLP4 340
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1010
+LABELV $1009
+LABELV $1006
+ADDRFP4 4
+INDIRP4
+CNSTI4 6104
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $1012
+ADDRLP4 52
+CNSTI4 2
+ASGNI4
+LABELV $1012
+ADDRLP4 52
+INDIRI4
+CNSTI4 4
+NEI4 $1014
+ADDRFP4 4
+INDIRP4
+CNSTI4 6112
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $1016
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1017
+JUMPV
+LABELV $1016
+ADDRFP4 4
+INDIRP4
+CNSTI4 6112
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+LABELV $1017
+LABELV $1014
+ADDRFP4 4
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 364
+ADDRGP4 IsBoomie
+CALLI4
+ASGNI4
+ADDRLP4 364
+INDIRI4
+CNSTI4 0
+EQI4 $1018
+ADDRLP4 68
+CNSTF4 1106247680
+ASGNF4
+ADDRLP4 128
+CNSTF4 1142292480
+ADDRLP4 68
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1019
+JUMPV
+LABELV $1018
+ADDRFP4 4
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1020
+ADDRLP4 368
+CNSTF4 0
+ASGNF4
+ADDRLP4 128
+ADDRLP4 368
+INDIRF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 368
+INDIRF4
+ASGNF4
+ADDRGP4 $1021
+JUMPV
+LABELV $1020
+ADDRLP4 128
+CNSTF4 1124859904
+ASGNF4
+ADDRLP4 68
+CNSTF4 1109393408
+ASGNF4
+LABELV $1021
+LABELV $1019
+ADDRLP4 132
+INDIRF4
+CNSTF4 1053609165
+GTF4 $1022
+ADDRLP4 124
+INDIRF4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 68
+INDIRF4
+ADDF4
+LEF4 $1024
+ADDRFP4 4
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 368
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 368
+INDIRI4
+CNSTI4 0
+EQI4 $1026
+ADDRFP4 0
+INDIRP4
+ADDRLP4 72
+INDIRB
+ASGNB 52
+ADDRGP4 $974
+JUMPV
+LABELV $1026
+LABELV $1024
+ADDRLP4 124
+INDIRF4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 68
+INDIRF4
+SUBF4
+GEF4 $1028
+ADDRFP4 4
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 368
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 368
+INDIRI4
+CNSTI4 0
+EQI4 $1030
+ADDRFP4 0
+INDIRP4
+ADDRLP4 72
+INDIRB
+ASGNB 52
+ADDRGP4 $974
+JUMPV
+LABELV $1030
+LABELV $1028
+ADDRFP4 0
+INDIRP4
+ADDRLP4 72
+INDIRB
+ASGNB 52
+ADDRGP4 $974
+JUMPV
+LABELV $1022
+ADDRLP4 372
+ADDRFP4 4
+INDIRP4
+CNSTI4 6100
+ADDP4
+ASGNP4
+ADDRLP4 372
+INDIRP4
+ADDRLP4 372
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 332
+CNSTF4 1045220557
+CNSTF4 1065353216
+ADDRLP4 132
+INDIRF4
+SUBF4
+MULF4
+CNSTF4 1053609165
+ADDF4
+ASGNF4
+ADDRLP4 132
+INDIRF4
+CNSTF4 1060320051
+LEF4 $1032
+ADDRLP4 380
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 332
+ADDRLP4 332
+INDIRF4
+CNSTF4 1045220557
+CNSTF4 1073741824
+ADDRLP4 380
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1032
+ADDRFP4 4
+INDIRP4
+CNSTI4 6100
+ADDP4
+INDIRF4
+ADDRLP4 332
+INDIRF4
+LEF4 $1034
+ADDRLP4 384
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 384
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1064262697
+LEF4 $1036
+ADDRLP4 388
+ADDRFP4 4
+INDIRP4
+CNSTI4 5980
+ADDP4
+ASGNP4
+ADDRLP4 388
+INDIRP4
+ADDRLP4 388
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6100
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1036
+LABELV $1034
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+LABELV $1038
+ADDRLP4 12
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 24+4
+INDIRF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 5980
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1045
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $1045
+ADDRLP4 384
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 384
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1063675494
+LEF4 $1051
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $1052
+JUMPV
+LABELV $1051
+ADDRLP4 124
+INDIRF4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 68
+INDIRF4
+ADDF4
+LEF4 $1059
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $1060
+JUMPV
+LABELV $1059
+ADDRLP4 124
+INDIRF4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 68
+INDIRF4
+SUBF4
+GEF4 $1067
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $1067
+LABELV $1060
+LABELV $1052
+ADDRFP4 4
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 388
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 388
+INDIRI4
+CNSTI4 0
+EQI4 $1075
+ADDRFP4 0
+INDIRP4
+ADDRLP4 72
+INDIRB
+ASGNB 52
+ADDRGP4 $974
+JUMPV
+LABELV $1075
+ADDRLP4 392
+ADDRFP4 4
+INDIRP4
+CNSTI4 5980
+ADDP4
+ASGNP4
+ADDRLP4 392
+INDIRP4
+ADDRLP4 392
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6100
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1039
+ADDRLP4 48
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 2
+LTI4 $1038
+ADDRFP4 0
+INDIRP4
+ADDRLP4 72
+INDIRB
+ASGNB 52
+LABELV $974
+endproc BotAttackMove 396 16
+export BotSameTeam
+proc BotSameTeam 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $1080
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+LTI4 $1078
+LABELV $1080
+CNSTI4 0
+RETI4
+ADDRGP4 $1077
+JUMPV
+LABELV $1078
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $1083
+ADDRFP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $1081
+LABELV $1083
+CNSTI4 0
+RETI4
+ADDRGP4 $1077
+JUMPV
+LABELV $1081
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+GEI4 $1084
+CNSTI4 0
+RETI4
+ADDRGP4 $1077
+JUMPV
+LABELV $1084
+ADDRLP4 16
+CNSTI4 832
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 20
+INDIRU4
+EQU4 $1090
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 20
+INDIRU4
+NEU4 $1088
+LABELV $1090
+CNSTI4 0
+RETI4
+ADDRGP4 $1077
+JUMPV
+LABELV $1088
+ADDRLP4 28
+CNSTI4 628
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $1092
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1093
+JUMPV
+LABELV $1092
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+LABELV $1093
+ADDRLP4 24
+INDIRI4
+RETI4
+LABELV $1077
+endproc BotSameTeam 32 0
+export InFieldOfVision
+proc InFieldOfVision 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1095
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $1099
+ADDRLP4 4
+INDIRF4
+CNSTF4 1127481344
+LEF4 $1100
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+ADDRGP4 $1100
+JUMPV
+LABELV $1099
+ADDRLP4 4
+INDIRF4
+CNSTF4 3274964992
+GEF4 $1103
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $1103
+LABELV $1100
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+LEF4 $1105
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 4
+INDIRF4
+MULF4
+LEF4 $1106
+CNSTI4 0
+RETI4
+ADDRGP4 $1094
+JUMPV
+LABELV $1105
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 4
+INDIRF4
+NEGF4
+MULF4
+GEF4 $1109
+CNSTI4 0
+RETI4
+ADDRGP4 $1094
+JUMPV
+LABELV $1109
+LABELV $1106
+LABELV $1096
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $1095
+CNSTI4 1
+RETI4
+LABELV $1094
+endproc InFieldOfVision 32 4
+proc BotEntityLineOfSight 248 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 168
+ADDRFP4 16
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 168+8
+ADDRLP4 168+8
+INDIRF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 180
+ADDRFP4 16
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 180+8
+ADDRLP4 180+8
+INDIRF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 trap_InPVSIgnorePortals
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+NEI4 $1114
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 168
+ARGP4
+ADDRLP4 196
+ADDRGP4 trap_InPVSIgnorePortals
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+NEI4 $1114
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 180
+ARGP4
+ADDRLP4 200
+ADDRGP4 trap_InPVSIgnorePortals
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+NEI4 $1114
+CNSTF4 0
+RETF4
+ADDRGP4 $1111
+JUMPV
+LABELV $1114
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 204
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 164
+ADDRLP4 204
+INDIRI4
+ASGNI4
+ADDRLP4 160
+ADDRLP4 164
+INDIRI4
+CNSTI4 64
+BANDI4
+ASGNI4
+ADDRLP4 156
+ADDRLP4 164
+INDIRI4
+CNSTI4 56
+BANDI4
+ASGNI4
+ADDRLP4 144
+CNSTF4 0
+ASGNF4
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+LABELV $1116
+ADDRLP4 84
+CNSTI4 65537
+ASGNI4
+ADDRLP4 104
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 120
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 108
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 92
+ADDRFP4 16
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 216
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 216
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $1120
+ADDRLP4 84
+ADDRLP4 84
+INDIRI4
+CNSTI4 56
+BORI4
+ASGNI4
+LABELV $1120
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $1122
+ADDRLP4 84
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+NEI4 $1124
+ADDRLP4 104
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 120
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 108
+ADDRFP4 16
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 92
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+LABELV $1124
+ADDRLP4 84
+ADDRLP4 84
+INDIRI4
+CNSTI4 56
+BXORI4
+ASGNI4
+LABELV $1122
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 108
+ARGP4
+ADDRLP4 92
+ARGP4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRLP4 220
+ADDRGP4 BotAI_VisTrace
+CALLI4
+ASGNI4
+ADDRLP4 220
+INDIRI4
+CNSTI4 0
+NEI4 $1126
+ADDRLP4 0
+ARGP4
+ADDRLP4 108
+ARGP4
+ADDRLP4 224
+CNSTP4 0
+ASGNP4
+ADDRLP4 224
+INDIRP4
+ARGP4
+ADDRLP4 224
+INDIRP4
+ARGP4
+ADDRLP4 92
+ARGP4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+LABELV $1126
+ADDRLP4 124
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+76
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $1128
+ADDRLP4 84
+ADDRLP4 84
+INDIRI4
+CNSTI4 -57
+BANDI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 228
+CNSTP4 0
+ASGNP4
+ADDRLP4 228
+INDIRP4
+ARGP4
+ADDRLP4 228
+INDIRP4
+ARGP4
+ADDRLP4 92
+ARGP4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 124
+CNSTF4 1056964608
+ASGNF4
+LABELV $1131
+LABELV $1128
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1138
+ADDRLP4 0+80
+INDIRI4
+ADDRLP4 120
+INDIRI4
+NEI4 $1134
+LABELV $1138
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 228
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 152
+ADDRLP4 228
+INDIRI4
+CNSTI4 64
+BANDI4
+ASGNI4
+ADDRLP4 232
+CNSTI4 0
+ASGNI4
+ADDRLP4 160
+INDIRI4
+ADDRLP4 232
+INDIRI4
+EQI4 $1139
+ADDRLP4 152
+INDIRI4
+ADDRLP4 232
+INDIRI4
+EQI4 $1139
+ADDRLP4 132
+ADDRLP4 0+12
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+4
+ADDRLP4 0+12+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+8
+ADDRLP4 0+12+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132
+ARGP4
+ADDRLP4 240
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 240
+INDIRF4
+ASGNF4
+ADDRGP4 $1140
+JUMPV
+LABELV $1139
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+EQI4 $1148
+ADDRLP4 108
+ADDRLP4 0+12
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ARGP4
+ADDRLP4 108
+ARGP4
+ADDRLP4 236
+CNSTP4 0
+ASGNP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 132
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 0+12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0+12+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0+12+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132
+ARGP4
+ADDRLP4 244
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 244
+INDIRF4
+ASGNF4
+ADDRGP4 $1149
+JUMPV
+LABELV $1148
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $1158
+ADDRLP4 92
+ADDRLP4 0+12
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 236
+CNSTP4 0
+ASGNP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+ADDRLP4 92
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 132
+ADDRLP4 92
+INDIRF4
+ADDRLP4 0+12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+4
+ADDRLP4 92+4
+INDIRF4
+ADDRLP4 0+12+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+8
+ADDRLP4 92+8
+INDIRF4
+ADDRLP4 0+12+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132
+ARGP4
+ADDRLP4 240
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 240
+INDIRF4
+ASGNF4
+ADDRGP4 $1159
+JUMPV
+LABELV $1158
+ADDRLP4 148
+CNSTF4 0
+ASGNF4
+LABELV $1159
+LABELV $1149
+LABELV $1140
+ADDRLP4 240
+CNSTF4 1065353216
+ASGNF4
+CNSTF4 981668463
+ADDRLP4 148
+INDIRF4
+MULF4
+ADDRLP4 240
+INDIRF4
+GEF4 $1171
+ADDRLP4 236
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $1172
+JUMPV
+LABELV $1171
+ADDRLP4 236
+CNSTF4 981668463
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1172
+ADDRLP4 128
+ADDRLP4 240
+INDIRF4
+ADDRLP4 236
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 128
+ADDRLP4 128
+INDIRF4
+ADDRLP4 124
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 144
+INDIRF4
+LEF4 $1173
+ADDRLP4 144
+ADDRLP4 128
+INDIRF4
+ASGNF4
+LABELV $1173
+ADDRLP4 144
+INDIRF4
+CNSTF4 1064514355
+LTF4 $1175
+ADDRLP4 144
+INDIRF4
+RETF4
+ADDRGP4 $1111
+JUMPV
+LABELV $1175
+LABELV $1134
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+NEI4 $1177
+ADDRLP4 228
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 228
+INDIRP4
+ADDRLP4 228
+INDIRP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $1178
+JUMPV
+LABELV $1177
+ADDRLP4 88
+INDIRI4
+CNSTI4 1
+NEI4 $1179
+ADDRLP4 232
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 232
+INDIRP4
+ADDRLP4 232
+INDIRP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+LABELV $1179
+LABELV $1178
+LABELV $1117
+ADDRLP4 88
+ADDRLP4 88
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 3
+LTI4 $1116
+ADDRLP4 144
+INDIRF4
+RETF4
+LABELV $1111
+endproc BotEntityLineOfSight 248 28
+export BotEntityVisible
+proc BotEntityVisible 200 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRI4
+CNSTI4 64
+GEI4 $1182
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $1182
+CNSTF4 1065353216
+RETF4
+ADDRGP4 $1181
+JUMPV
+LABELV $1182
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $1184
+CNSTF4 0
+RETF4
+ADDRGP4 $1181
+JUMPV
+LABELV $1184
+ADDRLP4 0
+ADDRLP4 12+72
+INDIRF4
+ADDRLP4 12+84
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+72+4
+INDIRF4
+ADDRLP4 12+84+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+72+8
+INDIRF4
+ADDRLP4 12+84+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 180
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+ADDRLP4 180
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 180
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1056964608
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12+24
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+24+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+24+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 0
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 156+4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 156+8
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 156
+ARGP4
+ADDRLP4 168
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 168
+ARGP4
+ADDRLP4 188
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+NEI4 $1215
+CNSTF4 0
+RETF4
+ADDRGP4 $1181
+JUMPV
+LABELV $1215
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRLP4 192
+ADDRGP4 BotAI_SharedVisibility
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+EQI4 $1217
+ADDRLP4 152
+INDIRF4
+RETF4
+ADDRGP4 $1181
+JUMPV
+LABELV $1217
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 196
+ADDRGP4 BotEntityLineOfSight
+CALLF4
+ASGNF4
+ADDRLP4 152
+ADDRLP4 196
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 152
+INDIRF4
+ARGF4
+ADDRGP4 BotAI_ShareVisibility
+CALLV
+pop
+ADDRLP4 152
+INDIRF4
+RETF4
+LABELV $1181
+endproc BotEntityVisible 200 20
+export EnemyFitsWell
+proc EnemyFitsWell 196 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+GEI4 $1220
+CNSTI4 1
+RETI4
+ADDRGP4 $1219
+JUMPV
+LABELV $1220
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $1222
+CNSTI4 0
+RETI4
+ADDRGP4 $1219
+JUMPV
+LABELV $1222
+CNSTI4 832
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 2
+LTI4 $1224
+CNSTI4 1
+RETI4
+ADDRGP4 $1219
+JUMPV
+LABELV $1224
+ADDRFP4 0
+INDIRP4
+CNSTI4 6260
+ADDP4
+INDIRI4
+CNSTI4 9
+NEI4 $1227
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1229
+CNSTI4 0
+RETI4
+ADDRGP4 $1219
+JUMPV
+LABELV $1229
+ADDRLP4 140
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 180
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 168
+ADDRLP4 180
+INDIRF4
+ASGNF4
+ADDRLP4 152
+ADDRLP4 0+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 152+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 152+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 152
+ARGP4
+ADDRLP4 188
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 164
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 192
+ADDRLP4 164
+INDIRF4
+ASGNF4
+ADDRLP4 192
+INDIRF4
+CNSTF4 1147207680
+GEF4 $1240
+ADDRLP4 168
+INDIRF4
+ADDRLP4 192
+INDIRF4
+LEF4 $1240
+CNSTI4 1
+RETI4
+ADDRGP4 $1219
+JUMPV
+LABELV $1240
+LABELV $1227
+CNSTI4 0
+RETI4
+LABELV $1219
+endproc EnemyFitsWell 196 8
+export BotNmyTurnedInvalid
+proc BotNmyTurnedInvalid 156 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $1243
+CNSTI4 1
+RETI4
+ADDRGP4 $1242
+JUMPV
+LABELV $1243
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 144
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $1245
+CNSTI4 1
+RETI4
+ADDRGP4 $1242
+JUMPV
+LABELV $1245
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 148
+ADDRGP4 ClientInSprayroom
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $1247
+CNSTI4 1
+RETI4
+ADDRGP4 $1242
+JUMPV
+LABELV $1247
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1249
+CNSTI4 1
+RETI4
+ADDRGP4 $1242
+JUMPV
+LABELV $1249
+ADDRLP4 0
+ARGP4
+ADDRLP4 152
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $1251
+CNSTI4 1
+RETI4
+ADDRGP4 $1242
+JUMPV
+LABELV $1251
+CNSTI4 0
+RETI4
+LABELV $1242
+endproc BotNmyTurnedInvalid 156 8
+export BotFindEnemy
+proc BotFindEnemy 512 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 46
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 356
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 356
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 45
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 360
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 192
+ADDRLP4 360
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5988
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5072
+ADDP4
+INDIRI4
+LEI4 $1255
+ADDRLP4 364
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1256
+JUMPV
+LABELV $1255
+ADDRLP4 364
+CNSTI4 0
+ASGNI4
+LABELV $1256
+ADDRLP4 168
+ADDRLP4 364
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5988
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5072
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $1257
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 216
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 216
+INDIRI4
+CNSTI4 0
+EQI4 $1259
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 216
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 376
+ADDRGP4 EnemyFitsWell
+CALLI4
+ASGNI4
+ADDRLP4 376
+INDIRI4
+CNSTI4 0
+EQI4 $1261
+CNSTI4 0
+RETI4
+ADDRGP4 $1253
+JUMPV
+LABELV $1261
+ADDRLP4 144
+ADDRLP4 216+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 216+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 216+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRLP4 384
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 212
+ADDRLP4 384
+INDIRF4
+ASGNF4
+ADDRGP4 $1258
+JUMPV
+LABELV $1259
+ADDRLP4 212
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1258
+JUMPV
+LABELV $1257
+ADDRLP4 212
+CNSTF4 0
+ASGNF4
+LABELV $1258
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 376
+ADDRGP4 ClientInSprayroom
+CALLI4
+ASGNI4
+ADDRLP4 380
+CNSTI4 0
+ASGNI4
+ADDRLP4 376
+INDIRI4
+ADDRLP4 380
+INDIRI4
+EQI4 $1270
+ADDRFP4 0
+INDIRP4
+CNSTI4 5140
+ADDP4
+INDIRI4
+ADDRLP4 380
+INDIRI4
+EQI4 $1270
+ADDRLP4 408
+ADDRFP4 0
+INDIRP4
+CNSTI4 8364
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 384
+ADDRLP4 408
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 384+8
+ADDRLP4 384+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 396
+ADDRLP4 384
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 396+4
+ADDRLP4 384+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 396+8
+ADDRLP4 384+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 396
+ARGP4
+ADDRLP4 500
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 500
+INDIRF4
+CNSTF4 1199570944
+GEF4 $1277
+ADDRLP4 412
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRLP4 508
+CNSTP4 0
+ASGNP4
+ADDRLP4 508
+INDIRP4
+ARGP4
+ADDRLP4 508
+INDIRP4
+ARGP4
+ADDRLP4 384
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 412+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1283
+ADDRLP4 412+80
+INDIRI4
+ADDRLP4 408
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $1279
+LABELV $1283
+ADDRLP4 408
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+NEI4 $1284
+CNSTI4 0
+RETI4
+ADDRGP4 $1253
+JUMPV
+LABELV $1284
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+ADDRLP4 408
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6116
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6012
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6120
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6080
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $1253
+JUMPV
+LABELV $1279
+LABELV $1277
+CNSTI4 0
+RETI4
+ADDRGP4 $1253
+JUMPV
+LABELV $1270
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 384
+ADDRGP4 ClientInSprayroom
+CALLI4
+ASGNI4
+ADDRLP4 384
+INDIRI4
+CNSTI4 0
+EQI4 $1286
+CNSTI4 0
+RETI4
+ADDRGP4 $1253
+JUMPV
+LABELV $1286
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1291
+JUMPV
+LABELV $1288
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $1292
+ADDRGP4 $1289
+JUMPV
+LABELV $1292
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $1294
+ADDRGP4 $1289
+JUMPV
+LABELV $1294
+CNSTI4 832
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+536
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $1296
+ADDRGP4 $1289
+JUMPV
+LABELV $1296
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1299
+ADDRGP4 $1289
+JUMPV
+LABELV $1299
+ADDRLP4 4
+ARGP4
+ADDRLP4 388
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 388
+INDIRI4
+CNSTI4 0
+NEI4 $1304
+ADDRLP4 4+20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $1301
+LABELV $1304
+ADDRGP4 $1289
+JUMPV
+LABELV $1301
+ADDRLP4 4
+ARGP4
+ADDRLP4 392
+ADDRGP4 EntityIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 392
+INDIRI4
+CNSTI4 0
+EQI4 $1305
+ADDRLP4 4
+ARGP4
+ADDRLP4 396
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 396
+INDIRI4
+CNSTI4 0
+NEI4 $1305
+ADDRGP4 $1289
+JUMPV
+LABELV $1305
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 400
+ADDRGP4 ClientInSprayroom
+CALLI4
+ASGNI4
+ADDRLP4 400
+INDIRI4
+CNSTI4 0
+EQI4 $1307
+ADDRGP4 $1289
+JUMPV
+LABELV $1307
+ADDRLP4 192
+INDIRF4
+CNSTF4 1056964608
+GEF4 $1309
+ADDRLP4 4
+ARGP4
+ADDRLP4 404
+ADDRGP4 EntityIsChatting
+CALLI4
+ASGNI4
+ADDRLP4 404
+INDIRI4
+CNSTI4 0
+EQI4 $1309
+ADDRGP4 $1289
+JUMPV
+LABELV $1309
+ADDRGP4 lastteleport_time
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1077936128
+SUBF4
+LEF4 $1311
+ADDRLP4 144
+ADDRLP4 4+24
+INDIRF4
+ADDRGP4 lastteleport_origin
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 4+24+4
+INDIRF4
+ADDRGP4 lastteleport_origin+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 4+24+8
+INDIRF4
+ADDRGP4 lastteleport_origin+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRLP4 408
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 408
+INDIRF4
+CNSTF4 1167663104
+GEF4 $1322
+ADDRGP4 $1289
+JUMPV
+LABELV $1322
+LABELV $1311
+ADDRLP4 144
+ADDRLP4 4+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 4+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 4+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRLP4 412
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 160
+ADDRLP4 412
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 416
+ADDRGP4 EnemyFitsWell
+CALLI4
+ASGNI4
+ADDRLP4 416
+INDIRI4
+CNSTI4 0
+NEI4 $1331
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $1333
+ADDRLP4 160
+INDIRF4
+ADDRLP4 212
+INDIRF4
+LEF4 $1333
+ADDRGP4 $1289
+JUMPV
+LABELV $1333
+LABELV $1331
+ADDRLP4 420
+CNSTF4 1165623296
+ADDRLP4 172
+INDIRF4
+MULF4
+CNSTF4 1147207680
+ADDF4
+ASGNF4
+ADDRLP4 160
+INDIRF4
+ADDRLP4 420
+INDIRF4
+ADDRLP4 420
+INDIRF4
+MULF4
+LEF4 $1335
+ADDRGP4 $1289
+JUMPV
+LABELV $1335
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 424
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 424
+INDIRI4
+CNSTI4 0
+EQI4 $1337
+ADDRGP4 $1289
+JUMPV
+LABELV $1337
+ADDRLP4 428
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 428
+INDIRI4
+GEI4 $1339
+ADDRLP4 168
+INDIRI4
+ADDRLP4 428
+INDIRI4
+NEI4 $1341
+ADDRLP4 4
+ARGP4
+ADDRLP4 432
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 432
+INDIRI4
+CNSTI4 0
+EQI4 $1339
+LABELV $1341
+ADDRLP4 176
+CNSTF4 1135869952
+ASGNF4
+ADDRGP4 $1340
+JUMPV
+LABELV $1339
+ADDRLP4 160
+INDIRF4
+CNSTF4 1226845760
+LEF4 $1343
+ADDRLP4 436
+CNSTF4 1226845760
+ASGNF4
+ADDRGP4 $1344
+JUMPV
+LABELV $1343
+ADDRLP4 436
+ADDRLP4 160
+INDIRF4
+ASGNF4
+LABELV $1344
+ADDRLP4 176
+CNSTF4 1127481344
+CNSTF4 1119092736
+ADDRLP4 436
+INDIRF4
+CNSTF4 1172557824
+DIVF4
+SUBF4
+SUBF4
+ASGNF4
+LABELV $1340
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ARGP4
+ADDRLP4 176
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 444
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 164
+ADDRLP4 444
+INDIRF4
+ASGNF4
+ADDRLP4 164
+INDIRF4
+CNSTF4 0
+GTF4 $1345
+ADDRGP4 $1289
+JUMPV
+LABELV $1345
+ADDRLP4 448
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 448
+INDIRI4
+GEI4 $1347
+ADDRLP4 160
+INDIRF4
+CNSTF4 1176256512
+LEF4 $1347
+ADDRLP4 168
+INDIRI4
+ADDRLP4 448
+INDIRI4
+NEI4 $1347
+ADDRLP4 4
+ARGP4
+ADDRLP4 452
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 452
+INDIRI4
+CNSTI4 0
+NEI4 $1347
+ADDRLP4 144
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+ADDRLP4 4+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+ADDRLP4 4+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+ADDRLP4 4+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRLP4 196
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 4+36
+ARGP4
+CNSTF4 1119092736
+ARGF4
+ADDRLP4 196
+ARGP4
+ADDRLP4 460
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 460
+INDIRI4
+CNSTI4 0
+NEI4 $1356
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateBattleInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 464
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 464
+INDIRI4
+CNSTI4 0
+EQI4 $1359
+ADDRGP4 $1289
+JUMPV
+LABELV $1359
+LABELV $1356
+LABELV $1347
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+ADDRLP4 4+20
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $1362
+ADDRFP4 0
+INDIRP4
+CNSTI4 6116
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRGP4 $1363
+JUMPV
+LABELV $1362
+ADDRFP4 0
+INDIRP4
+CNSTI4 6116
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $1363
+ADDRFP4 0
+INDIRP4
+CNSTI4 6012
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6120
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6080
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $1253
+JUMPV
+LABELV $1289
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1291
+ADDRLP4 0
+INDIRI4
+ADDRGP4 maxclients
+INDIRI4
+GEI4 $1364
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1288
+LABELV $1364
+ADDRLP4 0
+CNSTI4 64
+ASGNI4
+ADDRGP4 $1368
+JUMPV
+LABELV $1365
+ADDRLP4 156
+CNSTI4 832
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1370
+ADDRGP4 $1366
+JUMPV
+LABELV $1370
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $1372
+ADDRGP4 $1366
+JUMPV
+LABELV $1372
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 392
+ADDRGP4 IsBambam
+CALLI4
+ASGNI4
+ADDRLP4 392
+INDIRI4
+CNSTI4 0
+EQI4 $1374
+ADDRLP4 156
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 98
+NEI4 $1379
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 396
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 396
+INDIRI4
+CNSTI4 2
+EQI4 $1378
+LABELV $1379
+ADDRLP4 156
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 114
+NEI4 $1376
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 400
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 400
+INDIRI4
+CNSTI4 1
+NEI4 $1376
+LABELV $1378
+ADDRGP4 $1366
+JUMPV
+LABELV $1376
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 408
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 164
+ADDRLP4 408
+INDIRF4
+ASGNF4
+ADDRLP4 164
+INDIRF4
+CNSTF4 0
+GTF4 $1380
+ADDRGP4 $1366
+JUMPV
+LABELV $1380
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6116
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6012
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6120
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6080
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $1253
+JUMPV
+LABELV $1374
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 396
+ADDRGP4 IsBoomie
+CALLI4
+ASGNI4
+ADDRLP4 396
+INDIRI4
+CNSTI4 0
+EQI4 $1382
+ADDRLP4 156
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 98
+NEI4 $1387
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 400
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 400
+INDIRI4
+CNSTI4 2
+EQI4 $1386
+LABELV $1387
+ADDRLP4 156
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 114
+NEI4 $1384
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 404
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 404
+INDIRI4
+CNSTI4 1
+NEI4 $1384
+LABELV $1386
+ADDRGP4 $1366
+JUMPV
+LABELV $1384
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ARGP4
+CNSTF4 1117782016
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 412
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 164
+ADDRLP4 412
+INDIRF4
+ASGNF4
+ADDRLP4 164
+INDIRF4
+CNSTF4 0
+GTF4 $1388
+ADDRGP4 $1366
+JUMPV
+LABELV $1388
+ADDRLP4 180
+ADDRLP4 156
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 180+4
+ADDRLP4 156
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 180+8
+ADDRLP4 156
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 180
+ARGP4
+ADDRLP4 424
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 208
+ADDRLP4 424
+INDIRF4
+ASGNF4
+ADDRLP4 208
+INDIRF4
+CNSTF4 1209810944
+LEF4 $1392
+ADDRGP4 $1366
+JUMPV
+LABELV $1392
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6116
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6012
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6120
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6080
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $1253
+JUMPV
+LABELV $1382
+LABELV $1366
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1368
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $1365
+CNSTI4 0
+RETI4
+LABELV $1253
+endproc BotFindEnemy 512 28
+lit
+align 4
+LABELV $1395
+byte 4 3238002688
+byte 4 3238002688
+byte 4 3238002688
+align 4
+LABELV $1396
+byte 4 1090519040
+byte 4 1090519040
+byte 4 1090519040
+export BotSprayWallCheckAttack
+code
+proc BotSprayWallCheckAttack 920 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 856
+ADDRGP4 $1395
+INDIRB
+ASGNB 12
+ADDRLP4 868
+ADDRGP4 $1396
+INDIRB
+ASGNB 12
+ADDRLP4 588
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 588
+INDIRI4
+ARGI4
+ADDRLP4 716
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 716
+INDIRI4
+CNSTI4 0
+NEI4 $1397
+CNSTI4 1
+RETI4
+ADDRGP4 $1394
+JUMPV
+LABELV $1397
+ADDRLP4 588
+INDIRI4
+CNSTI4 64
+GTI4 $1399
+CNSTI4 1
+RETI4
+ADDRGP4 $1394
+JUMPV
+LABELV $1399
+ADDRFP4 0
+INDIRP4
+CNSTI4 6160
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1055286886
+SUBF4
+LEF4 $1401
+CNSTI4 1
+RETI4
+ADDRGP4 $1394
+JUMPV
+LABELV $1401
+ADDRLP4 576
+ADDRFP4 0
+INDIRP4
+CNSTI4 6184
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 576+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6188
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 576+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 6192
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 576
+ARGP4
+ADDRLP4 888
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 892
+ADDRFP4 0
+INDIRP4
+CNSTI4 8360
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 888
+INDIRF4
+ADDRLP4 892
+INDIRI4
+ADDRLP4 892
+INDIRI4
+MULI4
+CVIF4 4
+LEF4 $1405
+CNSTI4 1
+RETI4
+ADDRGP4 $1394
+JUMPV
+LABELV $1405
+ADDRLP4 576
+ARGP4
+ADDRLP4 896
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 896
+INDIRF4
+CNSTF4 1176256512
+GEF4 $1407
+ADDRLP4 700
+CNSTF4 1123024896
+ASGNF4
+ADDRGP4 $1408
+JUMPV
+LABELV $1407
+ADDRLP4 700
+CNSTF4 1112014848
+ASGNF4
+LABELV $1408
+ADDRLP4 576
+ARGP4
+ADDRLP4 704
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ARGP4
+ADDRLP4 700
+INDIRF4
+ARGF4
+ADDRLP4 704
+ARGP4
+ADDRLP4 900
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 900
+INDIRI4
+CNSTI4 0
+NEI4 $1409
+CNSTI4 1
+RETI4
+ADDRGP4 $1394
+JUMPV
+LABELV $1409
+ADDRFP4 0
+INDIRP4
+CNSTI4 6236
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6260
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRGP4 trap_BotGetWeaponInfo
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 592
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 24+292
+INDIRF4
+MULF4
+ADDRLP4 592
+INDIRF4
+ADDRLP4 24+292+4
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 24+292
+INDIRF4
+MULF4
+ADDRLP4 592+4
+INDIRF4
+ADDRLP4 24+292+4
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 24+292
+INDIRF4
+MULF4
+ADDRLP4 592+8
+INDIRF4
+ADDRLP4 24+292+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 24+292+8
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 912
+CNSTF4 1132462080
+ASGNF4
+ADDRLP4 604
+ADDRLP4 0
+INDIRF4
+ADDRLP4 912
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 604+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 912
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 604+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1132462080
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 916
+CNSTF4 3242196992
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 916
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 916
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 3242196992
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 616
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 856
+ARGP4
+ADDRLP4 868
+ARGP4
+ADDRLP4 604
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 616+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $1441
+CNSTI4 1
+RETI4
+ADDRGP4 $1394
+JUMPV
+LABELV $1441
+ADDRLP4 616+80
+INDIRI4
+ADDRLP4 588
+INDIRI4
+EQI4 $1444
+CNSTI4 1
+RETI4
+ADDRGP4 $1394
+JUMPV
+LABELV $1444
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $1394
+endproc BotSprayWallCheckAttack 920 28
+export BotVisibleTeamMatesAndEnemies
+proc BotVisibleTeamMatesAndEnemies 188 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1448
+ADDRFP4 4
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $1448
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1450
+ADDRFP4 8
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $1450
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1455
+JUMPV
+LABELV $1452
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $1457
+ADDRGP4 $1453
+JUMPV
+LABELV $1457
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1459
+ADDRGP4 $1453
+JUMPV
+LABELV $1459
+ADDRLP4 144
+ADDRLP4 4+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 4+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 4+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRLP4 164
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 164
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+LEF4 $1468
+ADDRGP4 $1453
+JUMPV
+LABELV $1468
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 176
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 176
+INDIRF4
+ASGNF4
+ADDRLP4 156
+INDIRF4
+CNSTF4 0
+GTF4 $1470
+ADDRGP4 $1453
+JUMPV
+LABELV $1470
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 180
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+EQI4 $1472
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1473
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1473
+JUMPV
+LABELV $1472
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1476
+ADDRFP4 8
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1476
+LABELV $1473
+LABELV $1453
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1455
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $1452
+LABELV $1447
+endproc BotVisibleTeamMatesAndEnemies 188 20
+lit
+align 4
+LABELV $1479
+byte 4 3229614080
+byte 4 3229614080
+byte 4 3229614080
+align 4
+LABELV $1480
+byte 4 1082130432
+byte 4 1082130432
+byte 4 1082130432
+export BotAimAtEnemy
+code
+proc BotAimAtEnemy 1160 52
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 924
+ADDRGP4 $1479
+INDIRB
+ASGNB 12
+ADDRLP4 936
+ADDRGP4 $1480
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $1481
+ADDRGP4 $1478
+JUMPV
+LABELV $1481
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 16
+NEI4 $1483
+ADDRFP4 0
+INDIRP4
+CNSTI4 6304
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 992
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 992
+INDIRI4
+CNSTI4 0
+EQI4 $1485
+ADDRLP4 1132
+ADDRLP4 992+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1132+4
+ADDRLP4 992+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1132+8
+ADDRLP4 992+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1132
+ARGP4
+ADDRLP4 1148
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 1148
+INDIRF4
+CNSTF4 1187512320
+GEF4 $1494
+ADDRGP4 $1478
+JUMPV
+LABELV $1494
+LABELV $1485
+LABELV $1483
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1496
+ADDRGP4 $1478
+JUMPV
+LABELV $1496
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 992
+ADDRGP4 IsWall
+CALLI4
+ASGNI4
+ADDRLP4 992
+INDIRI4
+CNSTI4 0
+EQI4 $1498
+ADDRFP4 0
+INDIRP4
+CNSTI4 8344
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5140
+ADDP4
+INDIRI4
+NEI4 $1502
+ADDRFP4 0
+INDIRP4
+CNSTI4 8368
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1500
+LABELV $1502
+ADDRFP4 0
+INDIRP4
+CNSTI4 8368
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1077936128
+ADDF4
+ASGNF4
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+LABELV $1503
+ADDRLP4 1004
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1000
+ADDRLP4 1004
+INDIRI4
+ADDRLP4 0+84
+ADDP4
+INDIRF4
+ADDRLP4 1004
+INDIRI4
+ADDRLP4 0+72
+ADDP4
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRLP4 1008
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1012
+ADDRLP4 1000
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 1004
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8348
+ADDP4
+ADDP4
+ADDRLP4 1004
+INDIRI4
+ADDRLP4 0+72
+ADDP4
+INDIRF4
+CNSTF4 1041865114
+ADDRLP4 1012
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1060320051
+ADDRLP4 1012
+INDIRF4
+MULF4
+ADDRLP4 1008
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1016
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8360
+ADDP4
+CNSTF4 1125515264
+ADDRLP4 1016
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+CVFI4 4
+ASGNI4
+LABELV $1504
+ADDRLP4 140
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 3
+LTI4 $1503
+ADDRFP4 0
+INDIRP4
+CNSTI4 8344
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5140
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1500
+ADDRLP4 824
+ADDRFP4 0
+INDIRP4
+CNSTI4 8348
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 144
+ADDRLP4 824
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 824+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 824+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6184
+ADDP4
+ADDRLP4 824
+INDIRB
+ASGNB 12
+ADDRGP4 $1478
+JUMPV
+LABELV $1498
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 996
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 820
+ADDRLP4 996
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1000
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 720
+ADDRLP4 1000
+INDIRF4
+ASGNF4
+ADDRLP4 820
+INDIRF4
+CNSTF4 1064514355
+LEF4 $1514
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1004
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 920
+CNSTF4 1056964608
+ADDRLP4 1004
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6116
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 920
+INDIRF4
+SUBF4
+LEF4 $1516
+ADDRGP4 $1478
+JUMPV
+LABELV $1516
+ADDRFP4 0
+INDIRP4
+CNSTI4 6152
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 920
+INDIRF4
+SUBF4
+LEF4 $1518
+ADDRGP4 $1478
+JUMPV
+LABELV $1518
+LABELV $1514
+ADDRFP4 0
+INDIRP4
+CNSTI4 6236
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6260
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 168
+ARGP4
+ADDRGP4 trap_BotGetWeaponInfo
+CALLV
+pop
+ADDRLP4 168+4
+INDIRI4
+CNSTI4 2
+NEI4 $1520
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1008
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 720
+ADDRLP4 1008
+INDIRF4
+ASGNF4
+ADDRGP4 $1521
+JUMPV
+LABELV $1520
+ADDRLP4 168+4
+INDIRI4
+CNSTI4 3
+NEI4 $1523
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 9
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1008
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 720
+ADDRLP4 1008
+INDIRF4
+ASGNF4
+ADDRGP4 $1524
+JUMPV
+LABELV $1523
+ADDRLP4 168+4
+INDIRI4
+CNSTI4 4
+NEI4 $1526
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 11
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1008
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 720
+ADDRLP4 1008
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1012
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 820
+ADDRLP4 1012
+INDIRF4
+ASGNF4
+ADDRGP4 $1527
+JUMPV
+LABELV $1526
+ADDRLP4 168+4
+INDIRI4
+CNSTI4 5
+NEI4 $1529
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 10
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1008
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 720
+ADDRLP4 1008
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 17
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1012
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 820
+ADDRLP4 1012
+INDIRF4
+ASGNF4
+ADDRGP4 $1530
+JUMPV
+LABELV $1529
+ADDRLP4 168+4
+INDIRI4
+CNSTI4 6
+NEI4 $1532
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 12
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1008
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 720
+ADDRLP4 1008
+INDIRF4
+ASGNF4
+ADDRGP4 $1533
+JUMPV
+LABELV $1532
+ADDRLP4 168+4
+INDIRI4
+CNSTI4 7
+NEI4 $1535
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 14
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1008
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 720
+ADDRLP4 1008
+INDIRF4
+ASGNF4
+ADDRGP4 $1536
+JUMPV
+LABELV $1535
+ADDRLP4 168+4
+INDIRI4
+CNSTI4 8
+NEI4 $1538
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 13
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1008
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 720
+ADDRLP4 1008
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 19
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1012
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 820
+ADDRLP4 1012
+INDIRF4
+ASGNF4
+ADDRGP4 $1539
+JUMPV
+LABELV $1538
+ADDRLP4 168+4
+INDIRI4
+CNSTI4 9
+NEI4 $1541
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 15
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1008
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 720
+ADDRLP4 1008
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 20
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1012
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 820
+ADDRLP4 1012
+INDIRF4
+ASGNF4
+LABELV $1541
+LABELV $1539
+LABELV $1536
+LABELV $1533
+LABELV $1530
+LABELV $1527
+LABELV $1524
+LABELV $1521
+ADDRLP4 720
+INDIRF4
+CNSTF4 0
+GTF4 $1544
+ADDRLP4 720
+CNSTF4 953267991
+ASGNF4
+LABELV $1544
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1546
+ADDRGP4 $1478
+JUMPV
+LABELV $1546
+ADDRLP4 0
+ARGP4
+ADDRLP4 1008
+ADDRGP4 EntityIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 1008
+INDIRI4
+CNSTI4 0
+EQI4 $1548
+ADDRLP4 1012
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1012
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1036831949
+LEF4 $1550
+ADDRLP4 720
+CNSTF4 1053609165
+ADDRLP4 720
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1550
+LABELV $1548
+ADDRLP4 156
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 0+60
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 156+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 0+60+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 156+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 0+60+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1012
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 156
+ADDRLP4 156
+INDIRF4
+ADDRLP4 1012
+INDIRF4
+ADDRLP4 0+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 156+4
+ADDRLP4 156+4
+INDIRF4
+ADDRLP4 1012
+INDIRF4
+ADDRLP4 0+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 156+8
+ADDRLP4 156+8
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 0+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6124
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1571
+ADDRFP4 0
+INDIRP4
+CNSTI4 6124
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6196
+ADDP4
+ADDRLP4 156
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6208
+ADDP4
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+LABELV $1571
+ADDRLP4 820
+INDIRF4
+CNSTF4 1063675494
+GEF4 $1574
+ADDRLP4 144
+ADDRLP4 0+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6208
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6212
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6216
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRLP4 1020
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 1020
+INDIRF4
+CNSTF4 1158676480
+LEF4 $1583
+ADDRFP4 0
+INDIRP4
+CNSTI4 6196
+ADDP4
+INDIRF4
+ADDRLP4 156
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6200
+ADDP4
+INDIRF4
+ADDRLP4 156+4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6204
+ADDP4
+INDIRF4
+ADDRLP4 156+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 0
+GEF4 $1585
+ADDRLP4 720
+CNSTF4 1060320051
+ADDRLP4 720
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1585
+LABELV $1583
+LABELV $1574
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1020
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 836
+ADDRLP4 1020
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 836
+INDIRI4
+CNSTI4 0
+EQI4 $1589
+ADDRLP4 724
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRLP4 724+8
+ADDRLP4 724+8
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 900
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 900+8
+ADDRLP4 900+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 900+8
+ADDRLP4 900+8
+INDIRF4
+ADDRLP4 168+292+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 736
+ARGP4
+ADDRLP4 900
+ARGP4
+ADDRLP4 924
+ARGP4
+ADDRLP4 936
+ARGP4
+ADDRLP4 724
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 736+8
+INDIRF4
+CNSTF4 1065353216
+GTF4 $1597
+ADDRLP4 736+80
+INDIRI4
+ADDRLP4 0+20
+INDIRI4
+EQI4 $1597
+ADDRLP4 724+8
+ADDRLP4 724+8
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+LABELV $1597
+ADDRLP4 168+272
+INDIRF4
+CNSTF4 0
+EQF4 $1603
+ADDRLP4 144
+ADDRLP4 724
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 724+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 724+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRLP4 1032
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 840
+ADDRLP4 1032
+INDIRF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 0+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6208
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6212
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6216
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 840
+INDIRF4
+CNSTF4 1120403456
+LEF4 $1619
+ADDRLP4 144
+ARGP4
+ADDRLP4 1040
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 1040
+INDIRF4
+CNSTF4 1149239296
+LTF4 $1617
+LABELV $1619
+ADDRLP4 820
+INDIRF4
+CNSTF4 1061997773
+LEF4 $1620
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1620
+ADDRLP4 144
+ADDRLP4 0+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRLP4 1144
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 840
+ADDRLP4 1144
+INDIRF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 0+60
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 0+60+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 0+60+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1148
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 144
+ADDRLP4 144
+INDIRF4
+ADDRLP4 1148
+INDIRF4
+ADDRLP4 0+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 144+4
+INDIRF4
+ADDRLP4 1148
+INDIRF4
+ADDRLP4 0+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 144+8
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 0+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 1044
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRLP4 1044+8
+ADDRLP4 1044+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 1152
+CNSTF4 0
+ASGNF4
+ADDRLP4 976+8
+ADDRLP4 1152
+INDIRF4
+ASGNF4
+ADDRLP4 976+4
+ADDRLP4 1152
+INDIRF4
+ASGNF4
+ADDRLP4 976
+ADDRLP4 1152
+INDIRF4
+ASGNF4
+ADDRLP4 1056
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1044
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 1156
+CNSTI4 0
+ASGNI4
+ADDRLP4 1156
+INDIRI4
+ARGI4
+ADDRLP4 144
+ARGP4
+ADDRLP4 976
+ARGP4
+ADDRLP4 1156
+INDIRI4
+ARGI4
+CNSTF4 1092616192
+ADDRLP4 840
+INDIRF4
+MULF4
+ADDRLP4 168+272
+INDIRF4
+DIVF4
+CVFI4 4
+ARGI4
+CNSTF4 1036831949
+ARGF4
+ADDRLP4 1156
+INDIRI4
+ARGI4
+ADDRLP4 1156
+INDIRI4
+ARGI4
+ADDRLP4 1156
+INDIRI4
+ARGI4
+ADDRGP4 trap_AAS_PredictClientMovement
+CALLI4
+pop
+ADDRLP4 724
+ADDRLP4 1056
+INDIRB
+ASGNB 12
+ADDRGP4 $1621
+JUMPV
+LABELV $1620
+ADDRLP4 820
+INDIRF4
+CNSTF4 1053609165
+LEF4 $1653
+ADDRLP4 144
+ADDRLP4 0+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRLP4 1048
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 840
+ADDRLP4 1048
+INDIRF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 0+60
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 0+60+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 0+60+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRLP4 1052
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 988
+ADDRLP4 1052
+INDIRF4
+ADDRLP4 0+16
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 1056
+ADDRLP4 840
+INDIRF4
+ASGNF4
+ADDRLP4 1060
+ADDRLP4 988
+INDIRF4
+ASGNF4
+ADDRLP4 724
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 144
+INDIRF4
+ADDRLP4 1056
+INDIRF4
+ADDRLP4 168+272
+INDIRF4
+DIVF4
+ADDRLP4 1060
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 724+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 144+4
+INDIRF4
+ADDRLP4 1056
+INDIRF4
+ADDRLP4 168+272
+INDIRF4
+DIVF4
+ADDRLP4 1060
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 724+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 144+8
+INDIRF4
+ADDRLP4 840
+INDIRF4
+ADDRLP4 168+272
+INDIRF4
+DIVF4
+ADDRLP4 988
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1653
+LABELV $1621
+LABELV $1617
+LABELV $1603
+ADDRLP4 820
+INDIRF4
+CNSTF4 1058642330
+LEF4 $1688
+ADDRLP4 168+344+180
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1688
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+GEF4 $1692
+ADDRLP4 964
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRLP4 964+8
+ADDRLP4 964+8
+INDIRF4
+CNSTF4 1115684864
+SUBF4
+ASGNF4
+ADDRLP4 736
+ARGP4
+ADDRLP4 0+24
+ARGP4
+ADDRLP4 1028
+CNSTP4 0
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRLP4 964
+ARGP4
+ADDRLP4 0+20
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 952
+ADDRLP4 724
+INDIRB
+ASGNB 12
+ADDRLP4 736+4
+INDIRI4
+CNSTI4 0
+EQI4 $1700
+ADDRLP4 952+8
+ADDRLP4 0+24+8
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRGP4 $1701
+JUMPV
+LABELV $1700
+ADDRLP4 952+8
+ADDRLP4 736+12+8
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+ASGNF4
+LABELV $1701
+ADDRLP4 736
+ARGP4
+ADDRLP4 900
+ARGP4
+ADDRLP4 1032
+CNSTP4 0
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRLP4 952
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 736+12+8
+INDIRF4
+ADDRLP4 952+8
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 1036
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 1036
+INDIRF4
+CNSTF4 1112014848
+GEF4 $1709
+ADDRLP4 144
+ADDRLP4 736+12
+INDIRF4
+ADDRLP4 952
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 736+12+4
+INDIRF4
+ADDRLP4 952+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 736+12+8
+INDIRF4
+ADDRLP4 952+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRLP4 1040
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 1040
+INDIRF4
+CNSTF4 1163984896
+GEF4 $1723
+ADDRLP4 144
+ADDRLP4 736+12
+INDIRF4
+ADDRLP4 900
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 736+12+4
+INDIRF4
+ADDRLP4 900+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 736+12+8
+INDIRF4
+ADDRLP4 900+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRLP4 1044
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 1044
+INDIRF4
+CNSTF4 1176256512
+LEF4 $1734
+ADDRLP4 736+12+8
+ADDRLP4 736+12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 736
+ARGP4
+ADDRLP4 736+12
+ARGP4
+ADDRLP4 1048
+CNSTP4 0
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRLP4 0+24
+ARGP4
+ADDRLP4 0+20
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 736+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $1741
+ADDRLP4 724
+ADDRLP4 952
+INDIRB
+ASGNB 12
+LABELV $1741
+LABELV $1734
+LABELV $1723
+LABELV $1709
+LABELV $1692
+LABELV $1688
+ADDRLP4 1028
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 724
+ADDRLP4 724
+INDIRF4
+CNSTF4 1050253722
+CNSTF4 1101004800
+CNSTF4 1073741824
+ADDRLP4 1028
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 720
+INDIRF4
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1032
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 724+4
+ADDRLP4 724+4
+INDIRF4
+CNSTF4 1050253722
+CNSTF4 1101004800
+CNSTF4 1073741824
+ADDRLP4 1032
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 720
+INDIRF4
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1036
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 724+8
+ADDRLP4 724+8
+INDIRF4
+CNSTF4 1050253722
+CNSTF4 1092616192
+CNSTF4 1073741824
+ADDRLP4 1036
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 720
+INDIRF4
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1590
+JUMPV
+LABELV $1589
+ADDRLP4 724
+ADDRFP4 0
+INDIRP4
+CNSTI4 6248
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 724+8
+ADDRLP4 724+8
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 168+4
+INDIRI4
+CNSTI4 3
+EQI4 $1753
+ADDRLP4 168+4
+INDIRI4
+CNSTI4 5
+EQI4 $1753
+ADDRLP4 168+4
+INDIRI4
+CNSTI4 4
+NEI4 $1747
+LABELV $1753
+ADDRLP4 844+40
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 844+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 844
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 844+16
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 844+16+4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 844+16+8
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 844+28
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 844+28+4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 844+28+8
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6248
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6244
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 844
+ARGP4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 824
+ARGP4
+ADDRLP4 1028
+ADDRGP4 trap_BotPredictVisiblePosition
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 0
+EQI4 $1766
+ADDRLP4 144
+ADDRLP4 824
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 824+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 824+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRLP4 1036
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 1036
+INDIRF4
+CNSTF4 1170735104
+LEF4 $1772
+ADDRLP4 724
+ADDRLP4 824
+INDIRB
+ASGNB 12
+ADDRLP4 724+8
+ADDRLP4 724+8
+INDIRF4
+CNSTF4 1101004800
+SUBF4
+ASGNF4
+LABELV $1772
+LABELV $1766
+ADDRLP4 720
+CNSTF4 1065353216
+ASGNF4
+LABELV $1747
+ADDRLP4 736
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 1028
+CNSTP4 0
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRLP4 724
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 736+8
+INDIRF4
+CNSTF4 1063675494
+GEF4 $1775
+ADDRGP4 $1478
+JUMPV
+LABELV $1775
+LABELV $1590
+ADDRLP4 836
+INDIRI4
+CNSTI4 0
+EQI4 $1778
+ADDRLP4 736
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRLP4 1028
+CNSTP4 0
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRLP4 724
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6184
+ADDP4
+ADDRLP4 736+12
+INDIRB
+ASGNB 12
+ADDRGP4 $1779
+JUMPV
+LABELV $1778
+ADDRFP4 0
+INDIRP4
+CNSTI4 6184
+ADDP4
+ADDRLP4 724
+INDIRB
+ASGNB 12
+LABELV $1779
+ADDRLP4 144
+ADDRLP4 724
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 724+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 724+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 168+4
+INDIRI4
+CNSTI4 2
+EQI4 $1793
+ADDRLP4 168+4
+INDIRI4
+CNSTI4 3
+EQI4 $1793
+ADDRLP4 168+4
+INDIRI4
+CNSTI4 6
+EQI4 $1793
+ADDRLP4 168+4
+INDIRI4
+CNSTI4 7
+NEI4 $1785
+LABELV $1793
+ADDRLP4 144
+ARGP4
+ADDRLP4 1028
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 840
+ADDRLP4 1028
+INDIRF4
+ASGNF4
+ADDRLP4 840
+INDIRF4
+CNSTF4 1125515264
+LEF4 $1794
+ADDRLP4 840
+CNSTF4 1125515264
+ASGNF4
+LABELV $1794
+ADDRLP4 948
+CNSTF4 1053609165
+ADDRLP4 840
+INDIRF4
+CNSTF4 1125515264
+DIVF4
+MULF4
+CNSTF4 1058642330
+ADDF4
+ASGNF4
+ADDRLP4 720
+ADDRLP4 720
+INDIRF4
+ADDRLP4 948
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1785
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1028
+ADDRGP4 IsBambam
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 0
+EQI4 $1796
+ADDRLP4 720
+ADDRLP4 720
+INDIRF4
+CNSTF4 1059648963
+CNSTF4 1065353216
+ADDRLP4 720
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1797
+JUMPV
+LABELV $1796
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1036
+ADDRGP4 IsBoomie
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+EQI4 $1798
+ADDRLP4 720
+ADDRLP4 720
+INDIRF4
+CNSTF4 1056964608
+CNSTF4 1065353216
+ADDRLP4 720
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1798
+LABELV $1797
+ADDRLP4 144
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 1044
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 916
+CNSTF4 1091567616
+CNSTF4 1073741824
+ADDRLP4 1044
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 720
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 1048
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1052
+CNSTF4 1056964608
+ASGNF4
+CNSTF4 1073741824
+ADDRLP4 1048
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+ADDRLP4 1052
+INDIRF4
+SUBF4
+MULF4
+ADDRLP4 1052
+INDIRF4
+GEF4 $1800
+ADDRLP4 1056
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ASGNP4
+ADDRLP4 1056
+INDIRP4
+ADDRLP4 1056
+INDIRP4
+INDIRF4
+ADDRLP4 916
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $1801
+JUMPV
+LABELV $1800
+ADDRLP4 1060
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ASGNP4
+ADDRLP4 1060
+INDIRP4
+ADDRLP4 1060
+INDIRP4
+INDIRF4
+ADDRLP4 916
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $1801
+ADDRLP4 1064
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ASGNP4
+ADDRLP4 1064
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 1068
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 1064
+INDIRP4
+ADDRLP4 1068
+INDIRF4
+ASGNF4
+ADDRLP4 1072
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 912
+CNSTF4 1086324736
+CNSTF4 1073741824
+ADDRLP4 1072
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 720
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 1076
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1080
+CNSTF4 1056964608
+ASGNF4
+CNSTF4 1073741824
+ADDRLP4 1076
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+ADDRLP4 1080
+INDIRF4
+SUBF4
+MULF4
+ADDRLP4 1080
+INDIRF4
+GEF4 $1802
+ADDRLP4 1084
+ADDRFP4 0
+INDIRP4
+CNSTI4 6280
+ADDP4
+ASGNP4
+ADDRLP4 1084
+INDIRP4
+ADDRLP4 1084
+INDIRP4
+INDIRF4
+ADDRLP4 912
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $1803
+JUMPV
+LABELV $1802
+ADDRLP4 1088
+ADDRFP4 0
+INDIRP4
+CNSTI4 6280
+ADDP4
+ASGNP4
+ADDRLP4 1088
+INDIRP4
+ADDRLP4 1088
+INDIRP4
+INDIRF4
+ADDRLP4 912
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $1803
+ADDRLP4 1092
+ADDRFP4 0
+INDIRP4
+CNSTI4 6280
+ADDP4
+ASGNP4
+ADDRLP4 1092
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 1096
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 1092
+INDIRP4
+ADDRLP4 1096
+INDIRF4
+ASGNF4
+ADDRGP4 bot_challenge+12
+INDIRI4
+CNSTI4 0
+EQI4 $1804
+ADDRLP4 720
+INDIRF4
+CNSTF4 1063675494
+LEF4 $1807
+ADDRFP4 0
+INDIRP4
+CNSTI4 6116
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $1807
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+INDIRF4
+CNSTF4 1127481344
+LEF4 $1809
+ADDRLP4 1100
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ASGNP4
+ADDRLP4 1100
+INDIRP4
+ADDRLP4 1100
+INDIRP4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $1809
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ARGP4
+ADDRGP4 trap_EA_View
+CALLV
+pop
+LABELV $1807
+LABELV $1804
+LABELV $1478
+endproc BotAimAtEnemy 1160 52
+lit
+align 4
+LABELV $1812
+byte 4 3238002688
+byte 4 3238002688
+byte 4 3238002688
+align 4
+LABELV $1813
+byte 4 1090519040
+byte 4 1090519040
+byte 4 1090519040
+export BotCheckAttack
+code
+proc BotCheckAttack 904 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 804
+ADDRGP4 $1812
+INDIRB
+ASGNB 12
+ADDRLP4 816
+ADDRGP4 $1813
+INDIRB
+ASGNB 12
+ADDRLP4 672
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 852
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 784
+ADDRLP4 852
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6116
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 784
+INDIRF4
+SUBF4
+LEF4 $1814
+ADDRGP4 $1811
+JUMPV
+LABELV $1814
+ADDRFP4 0
+INDIRP4
+CNSTI4 6152
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 784
+INDIRF4
+SUBF4
+LEF4 $1816
+ADDRGP4 $1811
+JUMPV
+LABELV $1816
+ADDRFP4 0
+INDIRP4
+CNSTI4 6160
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1036831949
+SUBF4
+LEF4 $1818
+ADDRGP4 $1811
+JUMPV
+LABELV $1818
+ADDRFP4 0
+INDIRP4
+CNSTI4 6260
+ADDP4
+INDIRI4
+CNSTI4 9
+EQI4 $1820
+ADDRFP4 0
+INDIRP4
+CNSTI4 6164
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $1822
+ADDRGP4 $1811
+JUMPV
+LABELV $1822
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 47
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 856
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 856
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6168
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1824
+ADDRLP4 860
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 860
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+ADDRLP4 828
+INDIRF4
+LEF4 $1826
+ADDRFP4 0
+INDIRP4
+CNSTI4 6164
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 828
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6168
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1827
+JUMPV
+LABELV $1826
+ADDRFP4 0
+INDIRP4
+CNSTI4 6168
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ADDRLP4 828
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6164
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1827
+LABELV $1824
+LABELV $1820
+ADDRLP4 576
+ADDRFP4 0
+INDIRP4
+CNSTI4 6184
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 576+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6188
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 576+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 6192
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6260
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1830
+ADDRLP4 576
+ARGP4
+ADDRLP4 864
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 864
+INDIRF4
+CNSTF4 1163984896
+LEF4 $1832
+ADDRGP4 $1811
+JUMPV
+LABELV $1832
+LABELV $1830
+ADDRLP4 576
+ARGP4
+ADDRLP4 864
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 864
+INDIRF4
+CNSTF4 1176256512
+GEF4 $1834
+ADDRLP4 788
+CNSTF4 1123024896
+ASGNF4
+ADDRGP4 $1835
+JUMPV
+LABELV $1834
+ADDRLP4 788
+CNSTF4 1112014848
+ASGNF4
+LABELV $1835
+ADDRLP4 576
+ARGP4
+ADDRLP4 792
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ARGP4
+ADDRLP4 788
+INDIRF4
+ARGF4
+ADDRLP4 792
+ARGP4
+ADDRLP4 868
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 868
+INDIRI4
+CNSTI4 0
+NEI4 $1836
+ADDRGP4 $1811
+JUMPV
+LABELV $1836
+ADDRLP4 700
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRLP4 876
+CNSTP4 0
+ASGNP4
+ADDRLP4 876
+INDIRP4
+ARGP4
+ADDRLP4 876
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6184
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 700+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1838
+ADDRLP4 700+80
+INDIRI4
+ADDRLP4 672
+INDIRI4
+EQI4 $1838
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 880
+ADDRGP4 IsBambam
+CALLI4
+ASGNI4
+ADDRLP4 880
+INDIRI4
+CNSTI4 0
+NEI4 $1844
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 884
+ADDRGP4 IsBoomie
+CALLI4
+ASGNI4
+ADDRLP4 884
+INDIRI4
+CNSTI4 0
+EQI4 $1811
+LABELV $1844
+ADDRLP4 888
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 832
+ADDRLP4 576
+INDIRF4
+ADDRLP4 888
+INDIRF4
+ADDRLP4 700+8
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 832+4
+ADDRLP4 576+4
+INDIRF4
+ADDRLP4 888
+INDIRF4
+ADDRLP4 700+8
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 832+8
+ADDRLP4 576+8
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 700+8
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 832
+ARGP4
+ADDRLP4 892
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 892
+INDIRF4
+CNSTF4 1147207680
+LEF4 $1843
+ADDRGP4 $1811
+JUMPV
+LABELV $1843
+LABELV $1838
+ADDRFP4 0
+INDIRP4
+CNSTI4 6236
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6260
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRGP4 trap_BotGetWeaponInfo
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 676
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 24+292
+INDIRF4
+MULF4
+ADDRLP4 676
+INDIRF4
+ADDRLP4 24+292+4
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 24+292
+INDIRF4
+MULF4
+ADDRLP4 676+4
+INDIRF4
+ADDRLP4 24+292+4
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 24+292
+INDIRF4
+MULF4
+ADDRLP4 676+8
+INDIRF4
+ADDRLP4 24+292+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 24+292+8
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 888
+CNSTF4 1148846080
+ASGNF4
+ADDRLP4 688
+ADDRLP4 0
+INDIRF4
+ADDRLP4 888
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 688+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 888
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 688+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1148846080
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 892
+CNSTF4 3242196992
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 892
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 892
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 3242196992
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 588
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 804
+ARGP4
+ADDRLP4 816
+ARGP4
+ADDRLP4 688
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 588+80
+INDIRI4
+CNSTI4 0
+LTI4 $1884
+ADDRLP4 588+80
+INDIRI4
+CNSTI4 64
+GEI4 $1884
+ADDRLP4 588+80
+INDIRI4
+ADDRLP4 672
+INDIRI4
+EQI4 $1888
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 588+80
+INDIRI4
+ARGI4
+ADDRLP4 896
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 896
+INDIRI4
+CNSTI4 0
+EQI4 $1891
+ADDRGP4 $1811
+JUMPV
+LABELV $1891
+LABELV $1888
+LABELV $1884
+ADDRLP4 588+80
+INDIRI4
+ADDRLP4 672
+INDIRI4
+NEI4 $1897
+ADDRLP4 672
+INDIRI4
+CNSTI4 64
+LTI4 $1894
+LABELV $1897
+ADDRLP4 24+344+180
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1898
+CNSTF4 1148846080
+ADDRLP4 588+8
+INDIRF4
+MULF4
+ADDRLP4 24+344+172
+INDIRF4
+GEF4 $1902
+ADDRLP4 900
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 844
+ADDRLP4 900
+INDIRF4
+ADDRLP4 24+344+168
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+ADDRLP4 900
+INDIRF4
+ADDRLP4 588+8
+INDIRF4
+MULF4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 844
+INDIRF4
+CNSTF4 0
+LEF4 $1910
+ADDRGP4 $1811
+JUMPV
+LABELV $1910
+LABELV $1902
+LABELV $1898
+LABELV $1894
+ADDRLP4 24+4
+INDIRI4
+CNSTI4 9
+NEI4 $1912
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $1915
+ADDRGP4 $1913
+JUMPV
+LABELV $1915
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+ADDRGP4 $1913
+JUMPV
+LABELV $1912
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+LABELV $1913
+LABELV $1811
+endproc BotCheckAttack 904 28
+lit
+align 4
+LABELV $1918
+byte 4 3238002688
+byte 4 3238002688
+byte 4 3238002688
+align 4
+LABELV $1919
+byte 4 1090519040
+byte 4 1090519040
+byte 4 1090519040
+export CheckSplash
+code
+proc CheckSplash 184 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 48
+ADDRGP4 $1918
+INDIRB
+ASGNB 12
+ADDRLP4 60
+ADDRGP4 $1919
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 36
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 164
+ADDRFP4 4
+INDIRP4
+CNSTI4 292
+ADDP4
+ASGNP4
+ADDRLP4 168
+ADDRFP4 4
+INDIRP4
+CNSTI4 296
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 164
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 168
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 164
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 36+4
+INDIRF4
+ADDRLP4 168
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 36+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 300
+ADDP4
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 176
+CNSTF4 1145569280
+ASGNF4
+ADDRLP4 24
+ADDRLP4 0
+INDIRF4
+ADDRLP4 176
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 176
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 180
+CNSTF4 3242196992
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 180
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 180
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 3242196992
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRLP4 60
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 72+8
+INDIRF4
+RETF4
+LABELV $1917
+endproc CheckSplash 184 28
+export BotCheckChargedImp
+proc BotCheckChargedImp 856 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6260
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4952
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1941
+CNSTI4 0
+RETI4
+ADDRGP4 $1940
+JUMPV
+LABELV $1941
+ADDRFP4 0
+INDIRP4
+CNSTI4 6236
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6260
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 152
+ARGP4
+ADDRGP4 trap_BotGetWeaponInfo
+CALLV
+pop
+ADDRLP4 152+4
+INDIRI4
+CNSTI4 9
+NEI4 $1946
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+NEI4 $1943
+LABELV $1946
+CNSTI4 0
+RETI4
+ADDRGP4 $1940
+JUMPV
+LABELV $1943
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $1947
+CNSTI4 0
+RETI4
+ADDRGP4 $1940
+JUMPV
+LABELV $1947
+ADDRLP4 0
+ADDRLP4 12+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 780
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 740
+ADDRLP4 780
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12+24
+INDIRF4
+ADDRLP4 12+60
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+24+4
+INDIRF4
+ADDRLP4 12+60+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+24+8
+INDIRF4
+ADDRLP4 12+60+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 784
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 736
+ADDRLP4 784
+INDIRF4
+ADDRLP4 12+16
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 788
+ADDRLP4 740
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 720
+ADDRLP4 12+24
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 788
+INDIRF4
+ADDRLP4 152+272
+INDIRF4
+DIVF4
+ADDRLP4 736
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 720+4
+ADDRLP4 12+24+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 788
+INDIRF4
+ADDRLP4 152+272
+INDIRF4
+DIVF4
+ADDRLP4 736
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 720+8
+ADDRLP4 12+24+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 740
+INDIRI4
+CVIF4 4
+ADDRLP4 152+272
+INDIRF4
+DIVF4
+ADDRLP4 736
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 720
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 720+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 720+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 804
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ADDRLP4 804
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6268
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 812
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6280
+ADDP4
+ADDRLP4 812
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ARGP4
+ADDRLP4 820
+ADDRGP4 CheckSplash
+CALLF4
+ASGNF4
+ADDRLP4 704
+ADDRLP4 820
+INDIRF4
+ASGNF4
+ADDRLP4 704
+INDIRF4
+CNSTF4 1063675494
+GEF4 $1986
+ADDRLP4 744
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 744
+ADDRLP4 744
+INDIRF4
+CNSTF4 1097859072
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRLP4 744
+ARGP4
+ADDRLP4 828
+ADDRGP4 CheckSplash
+CALLF4
+ASGNF4
+ADDRLP4 704+4
+ADDRLP4 828
+INDIRF4
+ASGNF4
+ADDRLP4 744
+ADDRLP4 744
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRLP4 744
+ARGP4
+ADDRLP4 832
+ADDRGP4 CheckSplash
+CALLF4
+ASGNF4
+ADDRLP4 704+8
+ADDRLP4 832
+INDIRF4
+ASGNF4
+ADDRLP4 744
+CNSTF4 3264610304
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRLP4 744
+ARGP4
+ADDRLP4 836
+ADDRGP4 CheckSplash
+CALLF4
+ASGNF4
+ADDRLP4 704+12
+ADDRLP4 836
+INDIRF4
+ASGNF4
+ADDRLP4 704
+INDIRF4
+ADDRLP4 704+4
+INDIRF4
+LTF4 $1993
+ADDRLP4 840
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1994
+JUMPV
+LABELV $1993
+ADDRLP4 840
+CNSTI4 1
+ASGNI4
+LABELV $1994
+ADDRLP4 732
+ADDRLP4 840
+INDIRI4
+ASGNI4
+ADDRLP4 732
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 704
+ADDP4
+INDIRF4
+ADDRLP4 704+8
+INDIRF4
+LTF4 $1997
+ADDRLP4 844
+ADDRLP4 732
+INDIRI4
+ASGNI4
+ADDRGP4 $1998
+JUMPV
+LABELV $1997
+ADDRLP4 844
+CNSTI4 2
+ASGNI4
+LABELV $1998
+ADDRLP4 732
+ADDRLP4 844
+INDIRI4
+ASGNI4
+ADDRLP4 732
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 704
+ADDP4
+INDIRF4
+ADDRLP4 704+12
+INDIRF4
+LTF4 $2001
+ADDRLP4 848
+ADDRLP4 732
+INDIRI4
+ASGNI4
+ADDRGP4 $2002
+JUMPV
+LABELV $2001
+ADDRLP4 848
+CNSTI4 3
+ASGNI4
+LABELV $2002
+ADDRLP4 732
+ADDRLP4 848
+INDIRI4
+ASGNI4
+ADDRLP4 732
+INDIRI4
+CNSTI4 0
+LTI4 $2003
+ADDRLP4 732
+INDIRI4
+CNSTI4 3
+GTI4 $2003
+ADDRLP4 732
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2009
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2009
+address $2005
+address $2006
+address $2007
+address $2008
+code
+LABELV $2005
+ADDRLP4 756
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $2004
+JUMPV
+LABELV $2006
+ADDRLP4 756
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 756
+ADDRLP4 756
+INDIRF4
+CNSTF4 1097859072
+SUBF4
+ASGNF4
+ADDRGP4 $2004
+JUMPV
+LABELV $2007
+ADDRLP4 756
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 756
+ADDRLP4 756
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+ADDRGP4 $2004
+JUMPV
+LABELV $2008
+ADDRLP4 756
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 756
+CNSTF4 3264610304
+ASGNF4
+ADDRGP4 $2004
+JUMPV
+LABELV $2003
+ADDRLP4 756
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $2004
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ADDRLP4 756
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 756
+ARGP4
+ADDRGP4 trap_EA_View
+CALLV
+pop
+LABELV $1986
+CNSTI4 1
+RETI4
+LABELV $1940
+endproc BotCheckChargedImp 856 12
+export BotMapScripts
+proc BotMapScripts 1192 16
+ADDRLP4 128
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetServerinfo
+CALLV
+pop
+ADDRLP4 128
+ARGP4
+ADDRGP4 $2011
+ARGP4
+ADDRLP4 1176
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1176
+INDIRP4
+ARGP4
+CNSTU4 127
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRLP4 0+127
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+ARGP4
+ADDRGP4 $2015
+ARGP4
+ADDRLP4 1180
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1180
+INDIRI4
+CNSTI4 0
+NEI4 $2013
+ADDRFP4 0
+INDIRP4
+CNSTI4 5140
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2016
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 outtele
+ARGP4
+CNSTF4 1120403456
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotAddAvoidSpot
+CALLV
+pop
+ADDRLP4 1152
+ADDRGP4 outtele
+INDIRB
+ASGNB 12
+ADDRLP4 1184
+CNSTF4 1120403456
+ASGNF4
+ADDRLP4 1152
+ADDRLP4 1152
+INDIRF4
+ADDRLP4 1184
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1152
+ARGP4
+ADDRLP4 1184
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotAddAvoidSpot
+CALLV
+pop
+ADDRLP4 1164
+ADDRGP4 outtele
+INDIRB
+ASGNB 12
+ADDRLP4 1188
+CNSTF4 1120403456
+ASGNF4
+ADDRLP4 1164
+ADDRLP4 1164
+INDIRF4
+ADDRLP4 1188
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1164
+ARGP4
+ADDRLP4 1188
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotAddAvoidSpot
+CALLV
+pop
+LABELV $2016
+LABELV $2013
+LABELV $2010
+endproc BotMapScripts 1192 16
+data
+align 4
+LABELV VEC_UP
+byte 4 0
+byte 4 3212836864
+byte 4 0
+align 4
+LABELV MOVEDIR_UP
+byte 4 0
+byte 4 0
+byte 4 1065353216
+align 4
+LABELV VEC_DOWN
+byte 4 0
+byte 4 3221225472
+byte 4 0
+align 4
+LABELV MOVEDIR_DOWN
+byte 4 0
+byte 4 0
+byte 4 3212836864
+export BotSetMovedir
+code
+proc BotSetMovedir 12 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 VEC_UP
+ARGP4
+ADDRLP4 0
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2019
+ADDRFP4 4
+INDIRP4
+ADDRGP4 MOVEDIR_UP
+INDIRB
+ASGNB 12
+ADDRGP4 $2020
+JUMPV
+LABELV $2019
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 VEC_DOWN
+ARGP4
+ADDRLP4 4
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2021
+ADDRFP4 4
+INDIRP4
+ADDRGP4 MOVEDIR_DOWN
+INDIRB
+ASGNB 12
+ADDRGP4 $2022
+JUMPV
+LABELV $2021
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+LABELV $2022
+LABELV $2020
+LABELV $2018
+endproc BotSetMovedir 12 16
+export BotModelMinsMaxs
+proc BotModelMinsMaxs 40 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2027
+JUMPV
+LABELV $2024
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2029
+ADDRGP4 $2025
+JUMPV
+LABELV $2029
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2031
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $2031
+ADDRGP4 $2025
+JUMPV
+LABELV $2031
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2033
+ADDRLP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+EQI4 $2033
+ADDRGP4 $2025
+JUMPV
+LABELV $2033
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $2035
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2037
+ADDRFP4 12
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $2037
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2039
+ADDRFP4 16
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 456
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $2039
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $2023
+JUMPV
+LABELV $2035
+LABELV $2025
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 832
+ADDP4
+ASGNP4
+LABELV $2027
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $2024
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2041
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $2041
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2043
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+LABELV $2043
+CNSTI4 0
+RETI4
+LABELV $2023
+endproc BotModelMinsMaxs 40 0
+lit
+align 4
+LABELV $2046
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+align 4
+LABELV $2047
+byte 4 3212836864
+byte 4 3212836864
+byte 4 3212836864
+export BotFuncButtonActivateGoal
+code
+proc BotFuncButtonActivateGoal 648 28
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 304
+ADDRGP4 $2046
+INDIRB
+ASGNB 12
+ADDRLP4 316
+ADDRGP4 $2047
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 564
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRLP4 564
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 564
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 564
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $533
+ARGP4
+ADDRLP4 160
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 160
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2048
+CNSTI4 0
+RETI4
+ADDRGP4 $2045
+JUMPV
+LABELV $2048
+ADDRLP4 160+1
+ARGP4
+ADDRLP4 568
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 288
+ADDRLP4 568
+INDIRI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+NEI4 $2051
+CNSTI4 0
+RETI4
+ADDRGP4 $2045
+JUMPV
+LABELV $2051
+ADDRLP4 572
+CNSTF4 0
+ASGNF4
+ADDRLP4 96+8
+ADDRLP4 572
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 572
+INDIRF4
+ASGNF4
+ADDRLP4 96
+ADDRLP4 572
+INDIRF4
+ASGNF4
+ADDRLP4 288
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 72
+ARGP4
+ADDRLP4 84
+ARGP4
+ADDRLP4 576
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+ASGNI4
+ADDRLP4 344
+ADDRLP4 576
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $2055
+ARGP4
+ADDRLP4 328
+ARGP4
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 328
+INDIRF4
+CNSTF4 0
+NEF4 $2056
+ADDRLP4 328
+CNSTF4 1082130432
+ASGNF4
+LABELV $2056
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $2058
+ARGP4
+ADDRLP4 352
+ARGP4
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 96
+CNSTF4 0
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 352
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 96
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotSetMovedir
+CALLV
+pop
+ADDRLP4 112
+ADDRLP4 84
+INDIRF4
+ADDRLP4 72
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 112+4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 72+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 112+8
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 72+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 72
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 72+4
+INDIRF4
+ADDRLP4 84+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 72+8
+INDIRF4
+ADDRLP4 84+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 580
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 16
+ADDRLP4 580
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 580
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16+8
+CNSTF4 1056964608
+ADDRLP4 16+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 584
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 4+4
+INDIRF4
+ARGF4
+ADDRLP4 588
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 4+8
+INDIRF4
+ARGF4
+ADDRLP4 592
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 584
+INDIRF4
+ADDRLP4 112
+INDIRF4
+MULF4
+ADDRLP4 588
+INDIRF4
+ADDRLP4 112+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 592
+INDIRF4
+ADDRLP4 112+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+CNSTF4 1056964608
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $2081
+ARGP4
+ADDRLP4 348
+ARGP4
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 348
+INDIRF4
+CNSTF4 0
+EQF4 $2082
+ADDRLP4 596
+ADDRLP4 28
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 596
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 596
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 28
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 124
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 356
+ARGP4
+ADDRLP4 600
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 600
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRLP4 604
+CNSTP4 0
+ASGNP4
+ADDRLP4 604
+INDIRP4
+ARGP4
+ADDRLP4 604
+INDIRP4
+ARGP4
+ADDRLP4 124
+ARGP4
+ADDRLP4 600
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 356+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $2094
+ADDRLP4 356+80
+INDIRI4
+ADDRLP4 344
+INDIRI4
+NEI4 $2090
+LABELV $2094
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $2045
+JUMPV
+LABELV $2090
+CNSTI4 4
+ARGI4
+ADDRLP4 136
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2095
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $2099
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 608
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 148
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 612
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 608
+INDIRF4
+ADDRLP4 612
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $2100
+JUMPV
+LABELV $2099
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 616
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 136
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 620
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 616
+INDIRF4
+ADDRLP4 620
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $2100
+LABELV $2096
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $2095
+ADDRLP4 608
+ADDRLP4 28
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 608
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 608
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 28
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 292
+ADDRLP4 124
+INDIRB
+ASGNB 12
+ADDRLP4 292+8
+ADDRLP4 292+8
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 292
+INDIRB
+ASGNB 12
+ADDRLP4 332+8
+ADDRLP4 332+8
+INDIRF4
+CNSTF4 1140850688
+SUBF4
+ASGNF4
+ADDRLP4 292
+ARGP4
+ADDRLP4 332
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 440
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 612
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 108
+ADDRLP4 612
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 108
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $2112
+JUMPV
+LABELV $2109
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 616
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 616
+INDIRI4
+CNSTI4 0
+EQI4 $2113
+ADDRGP4 $2111
+JUMPV
+LABELV $2113
+LABELV $2110
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $2112
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $2109
+LABELV $2111
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $2115
+LABELV $2115
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $2117
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 440
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2119
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $2123
+ADDRLP4 616
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 616
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 620
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 316
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 624
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 628
+ADDRLP4 616
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 628
+INDIRP4
+ADDRLP4 628
+INDIRP4
+INDIRF4
+ADDRLP4 620
+INDIRF4
+ADDRLP4 624
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $2124
+JUMPV
+LABELV $2123
+ADDRLP4 632
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 632
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 636
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 304
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 640
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 644
+ADDRLP4 632
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 644
+INDIRP4
+ADDRLP4 644
+INDIRP4
+INDIRF4
+ADDRLP4 636
+INDIRF4
+ADDRLP4 640
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $2124
+LABELV $2120
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $2119
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2045
+JUMPV
+LABELV $2117
+CNSTI4 0
+RETI4
+ADDRGP4 $2045
+JUMPV
+LABELV $2082
+CNSTI4 4
+ARGI4
+ADDRLP4 136
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2125
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $2129
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 596
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 148
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 600
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 596
+INDIRF4
+ADDRLP4 600
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $2130
+JUMPV
+LABELV $2129
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 604
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 136
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 608
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 604
+INDIRF4
+ADDRLP4 608
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $2130
+LABELV $2126
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $2125
+ADDRLP4 596
+ADDRLP4 28
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 596
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 596
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 28
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 292
+ADDRLP4 124
+INDIRB
+ASGNB 12
+ADDRLP4 292+8
+ADDRLP4 292+8
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 292
+INDIRB
+ASGNB 12
+ADDRLP4 332+8
+ADDRLP4 332+8
+INDIRF4
+CNSTF4 1120403456
+SUBF4
+ASGNF4
+ADDRLP4 292
+ARGP4
+ADDRLP4 332
+ARGP4
+ADDRLP4 32
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 600
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 108
+ADDRLP4 600
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2142
+JUMPV
+LABELV $2139
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 604
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 604
+INDIRI4
+CNSTI4 0
+EQI4 $2143
+ADDRGP4 $2141
+JUMPV
+LABELV $2143
+LABELV $2140
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2142
+ADDRLP4 0
+INDIRI4
+ADDRLP4 108
+INDIRI4
+LTI4 $2139
+LABELV $2141
+ADDRLP4 0
+INDIRI4
+ADDRLP4 108
+INDIRI4
+GEI4 $2145
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 16
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 72+4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 72+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2155
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $2159
+ADDRLP4 604
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 604
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 608
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 316
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 612
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 616
+ADDRLP4 604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 616
+INDIRP4
+ADDRLP4 616
+INDIRP4
+INDIRF4
+ADDRLP4 608
+INDIRF4
+ADDRLP4 612
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $2160
+JUMPV
+LABELV $2159
+ADDRLP4 620
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 620
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 624
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 304
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 628
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 632
+ADDRLP4 620
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 632
+INDIRP4
+ADDRLP4 632
+INDIRP4
+INDIRF4
+ADDRLP4 624
+INDIRF4
+ADDRLP4 628
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $2160
+LABELV $2156
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $2155
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2045
+JUMPV
+LABELV $2145
+CNSTI4 0
+RETI4
+LABELV $2045
+endproc BotFuncButtonActivateGoal 648 28
+export BotFuncDoorActivateGoal
+proc BotFuncDoorActivateGoal 1096 20
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $533
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 12
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2162
+CNSTI4 0
+RETI4
+ADDRGP4 $2161
+JUMPV
+LABELV $2162
+ADDRLP4 12+1
+ARGP4
+ADDRLP4 1080
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1060
+ADDRLP4 1080
+INDIRI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $2165
+CNSTI4 0
+RETI4
+ADDRGP4 $2161
+JUMPV
+LABELV $2165
+ADDRLP4 1084
+CNSTF4 0
+ASGNF4
+ADDRLP4 1064+8
+ADDRLP4 1084
+INDIRF4
+ASGNF4
+ADDRLP4 1064+4
+ADDRLP4 1084
+INDIRF4
+ASGNF4
+ADDRLP4 1064
+ADDRLP4 1084
+INDIRF4
+ASGNF4
+ADDRLP4 1060
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 1036
+ARGP4
+ADDRLP4 1048
+ARGP4
+ADDRLP4 1088
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+ASGNI4
+ADDRLP4 1076
+ADDRLP4 1088
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1036
+INDIRF4
+ADDRLP4 1048
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 1036+4
+INDIRF4
+ADDRLP4 1048+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 1036+8
+INDIRF4
+ADDRLP4 1048+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 1092
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1092
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 1092
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1056964608
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 1076
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $2161
+endproc BotFuncDoorActivateGoal 1096 20
+export BotTriggerMultipleActivateGoal
+proc BotTriggerMultipleActivateGoal 300 20
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 272
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRLP4 272
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 272
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 272
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $533
+ARGP4
+ADDRLP4 84
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 84
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2180
+CNSTI4 0
+RETI4
+ADDRGP4 $2179
+JUMPV
+LABELV $2180
+ADDRLP4 84+1
+ARGP4
+ADDRLP4 276
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 224
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 0
+NEI4 $2183
+CNSTI4 0
+RETI4
+ADDRGP4 $2179
+JUMPV
+LABELV $2183
+ADDRLP4 280
+CNSTF4 0
+ASGNF4
+ADDRLP4 240+8
+ADDRLP4 280
+INDIRF4
+ASGNF4
+ADDRLP4 240+4
+ADDRLP4 280
+INDIRF4
+ASGNF4
+ADDRLP4 240
+ADDRLP4 280
+INDIRF4
+ASGNF4
+ADDRLP4 224
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1073741824
+ARGI4
+ADDRLP4 60
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 284
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+ASGNI4
+ADDRLP4 264
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 60+4
+INDIRF4
+ADDRLP4 72+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 60+8
+INDIRF4
+ADDRLP4 72+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 288
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 4
+ADDRLP4 288
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 288
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1056964608
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 252
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 212
+ADDRLP4 252
+INDIRB
+ASGNB 12
+ADDRLP4 212+8
+ADDRLP4 212+8
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 228
+ADDRLP4 212
+INDIRB
+ASGNB 12
+ADDRLP4 228+8
+ADDRLP4 228+8
+INDIRF4
+CNSTF4 1120403456
+SUBF4
+ASGNF4
+ADDRLP4 212
+ARGP4
+ADDRLP4 228
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 292
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2202
+JUMPV
+LABELV $2199
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 296
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+EQI4 $2203
+ADDRGP4 $2201
+JUMPV
+LABELV $2203
+LABELV $2200
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2202
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $2199
+LABELV $2201
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+GEI4 $2205
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 60+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 60+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 72+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 72+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2179
+JUMPV
+LABELV $2205
+CNSTI4 0
+RETI4
+LABELV $2179
+endproc BotTriggerMultipleActivateGoal 300 20
+export BotPopFromActivateGoalStack
+proc BotPopFromActivateGoalStack 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2216
+CNSTI4 0
+RETI4
+ADDRGP4 $2215
+JUMPV
+LABELV $2216
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ASGNP4
+CNSTI4 1
+RETI4
+LABELV $2215
+endproc BotPopFromActivateGoalStack 4 8
+export BotPushOntoActivateGoalStack
+proc BotPushOntoActivateGoalStack 20 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRLP4 4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1176255488
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2219
+CNSTI4 244
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6392
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2223
+CNSTI4 244
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6392
+ADDP4
+ADDP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+GEF4 $2225
+ADDRLP4 4
+CNSTI4 244
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6392
+ADDP4
+ADDP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $2225
+LABELV $2223
+LABELV $2220
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $2219
+ADDRLP4 8
+INDIRI4
+CNSTI4 -1
+EQI4 $2227
+CNSTI4 244
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6392
+ADDP4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTU4 244
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 244
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6392
+ADDP4
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 244
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6392
+ADDP4
+ADDP4
+CNSTI4 240
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+CNSTI4 244
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6392
+ADDP4
+ADDP4
+ASGNP4
+CNSTI4 1
+RETI4
+ADDRGP4 $2218
+JUMPV
+LABELV $2227
+CNSTI4 0
+RETI4
+LABELV $2218
+endproc BotPushOntoActivateGoalStack 20 12
+export BotClearActivateGoalStack
+proc BotClearActivateGoalStack 0 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $2231
+JUMPV
+LABELV $2230
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotPopFromActivateGoalStack
+CALLI4
+pop
+LABELV $2231
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2230
+LABELV $2229
+endproc BotClearActivateGoalStack 0 4
+export BotEnableActivateGoalAreas
+proc BotEnableActivateGoalAreas 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2237
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2238
+JUMPV
+LABELV $2237
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $2238
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $2234
+ADDRGP4 $2233
+JUMPV
+LABELV $2234
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2242
+JUMPV
+LABELV $2239
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_AAS_EnableRoutingArea
+CALLI4
+pop
+LABELV $2240
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2242
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+LTI4 $2239
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2244
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2245
+JUMPV
+LABELV $2244
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $2245
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $2233
+endproc BotEnableActivateGoalAreas 12 8
+export BotIsGoingToActivateEntity
+proc BotIsGoingToActivateEntity 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $2250
+JUMPV
+LABELV $2247
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $2251
+ADDRGP4 $2248
+JUMPV
+LABELV $2251
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $2253
+CNSTI4 1
+RETI4
+ADDRGP4 $2246
+JUMPV
+LABELV $2253
+LABELV $2248
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2250
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2247
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $2255
+CNSTI4 244
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6392
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2259
+ADDRGP4 $2256
+JUMPV
+LABELV $2259
+CNSTI4 244
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6392
+ADDP4
+ADDP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $2261
+CNSTI4 244
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6392
+ADDP4
+ADDP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+LEF4 $2263
+CNSTI4 1
+RETI4
+ADDRGP4 $2246
+JUMPV
+LABELV $2263
+LABELV $2261
+LABELV $2256
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+LTI4 $2255
+CNSTI4 0
+RETI4
+LABELV $2246
+endproc BotIsGoingToActivateEntity 8 0
+export BotGetActivateGoal
+proc BotGetActivateGoal 3320 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 244
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 3048
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 3048
+INDIRI4
+CNSTI4 0
+NEI4 $2266
+CNSTI4 0
+RETI4
+ADDRGP4 $2265
+JUMPV
+LABELV $2266
+ADDRLP4 1712
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $2268
+ARGP4
+ADDRLP4 3048+104
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 0
+ARGI4
+ADDRLP4 3252
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 3252
+INDIRI4
+ASGNI4
+ADDRGP4 $2273
+JUMPV
+LABELV $2270
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $533
+ARGP4
+ADDRLP4 1584
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3256
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3256
+INDIRI4
+CNSTI4 0
+NEI4 $2274
+ADDRGP4 $2271
+JUMPV
+LABELV $2274
+ADDRLP4 1712
+ARGP4
+ADDRLP4 1584
+ARGP4
+ADDRLP4 3260
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3260
+INDIRI4
+CNSTI4 0
+NEI4 $2276
+ADDRGP4 $2272
+JUMPV
+LABELV $2276
+LABELV $2271
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 3256
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 3256
+INDIRI4
+ASGNI4
+LABELV $2273
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2270
+LABELV $2272
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2278
+CNSTI4 3
+ARGI4
+ADDRGP4 $2280
+ARGP4
+ADDRLP4 1712
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2265
+JUMPV
+LABELV $2278
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2281
+ARGP4
+ADDRLP4 1456
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 1456
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2282
+CNSTI4 3
+ARGI4
+ADDRGP4 $2284
+ARGP4
+ADDRLP4 1712
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2265
+JUMPV
+LABELV $2282
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $2287
+ARGP4
+ADDRLP4 3260
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3260
+INDIRI4
+CNSTI4 0
+NEI4 $2285
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2081
+ARGP4
+ADDRLP4 3208
+ARGP4
+ADDRLP4 3264
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3264
+INDIRI4
+CNSTI4 0
+EQI4 $2288
+ADDRLP4 3208
+INDIRF4
+CNSTF4 0
+EQF4 $2290
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 BotFuncDoorActivateGoal
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $2265
+JUMPV
+LABELV $2290
+LABELV $2288
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2292
+ARGP4
+ADDRLP4 3204
+ARGP4
+ADDRGP4 trap_AAS_IntForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 3204
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2293
+CNSTI4 0
+RETI4
+ADDRGP4 $2265
+JUMPV
+LABELV $2293
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2297
+ARGP4
+ADDRLP4 3192
+ARGP4
+ADDRLP4 3268
+ADDRGP4 trap_AAS_VectorForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3268
+INDIRI4
+CNSTI4 0
+NEI4 $2295
+ADDRLP4 3272
+CNSTF4 0
+ASGNF4
+ADDRLP4 3192+8
+ADDRLP4 3272
+INDIRF4
+ASGNF4
+ADDRLP4 3192+4
+ADDRLP4 3272
+INDIRF4
+ASGNF4
+ADDRLP4 3192
+ADDRLP4 3272
+INDIRF4
+ASGNF4
+LABELV $2295
+ADDRLP4 3192
+ARGP4
+ADDRLP4 3048+24
+ARGP4
+ADDRLP4 3272
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 3272
+INDIRI4
+CNSTI4 0
+NEI4 $2300
+CNSTI4 0
+RETI4
+ADDRGP4 $2265
+JUMPV
+LABELV $2300
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $533
+ARGP4
+ADDRLP4 1712
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 1712
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2303
+ADDRLP4 1712+1
+ARGP4
+ADDRLP4 3276
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 3212
+ADDRLP4 3276
+INDIRI4
+ASGNI4
+ADDRLP4 3212
+INDIRI4
+CNSTI4 0
+EQI4 $2306
+ADDRLP4 3280
+CNSTF4 0
+ASGNF4
+ADDRLP4 3216+8
+ADDRLP4 3280
+INDIRF4
+ASGNF4
+ADDRLP4 3216+4
+ADDRLP4 3280
+INDIRF4
+ASGNF4
+ADDRLP4 3216
+ADDRLP4 3280
+INDIRF4
+ASGNF4
+ADDRLP4 3212
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 3228
+ARGP4
+ADDRLP4 3240
+ARGP4
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+pop
+ADDRLP4 3228
+ARGP4
+ADDRLP4 3240
+ARGP4
+ADDRLP4 2740
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 3284
+ADDRGP4 trap_AAS_BBoxAreas
+CALLI4
+ASGNI4
+ADDRLP4 3188
+ADDRLP4 3284
+INDIRI4
+ASGNI4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2313
+JUMPV
+LABELV $2310
+ADDRFP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 32
+LTI4 $2314
+ADDRGP4 $2312
+JUMPV
+LABELV $2314
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3288
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 3288
+INDIRI4
+CNSTI4 0
+NEI4 $2316
+ADDRGP4 $2311
+JUMPV
+LABELV $2316
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2996
+ARGP4
+ADDRGP4 trap_AAS_AreaInfo
+CALLI4
+pop
+ADDRLP4 2996
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $2318
+ADDRLP4 3296
+ADDRFP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+ASGNP4
+ADDRLP4 3292
+ADDRLP4 3296
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 3296
+INDIRP4
+ADDRLP4 3292
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 3300
+CNSTI4 2
+ASGNI4
+ADDRLP4 3292
+INDIRI4
+ADDRLP4 3300
+INDIRI4
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDP4
+ADDRLP4 132
+INDIRI4
+ADDRLP4 3300
+INDIRI4
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2318
+LABELV $2311
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2313
+ADDRLP4 132
+INDIRI4
+ADDRLP4 3188
+INDIRI4
+LTI4 $2310
+LABELV $2312
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2323
+JUMPV
+LABELV $2320
+ADDRFP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 32
+LTI4 $2324
+ADDRGP4 $2322
+JUMPV
+LABELV $2324
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3288
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 3288
+INDIRI4
+CNSTI4 0
+EQI4 $2326
+ADDRGP4 $2321
+JUMPV
+LABELV $2326
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2996
+ARGP4
+ADDRGP4 trap_AAS_AreaInfo
+CALLI4
+pop
+ADDRLP4 2996
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $2328
+ADDRLP4 3296
+ADDRFP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+ASGNP4
+ADDRLP4 3292
+ADDRLP4 3296
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 3296
+INDIRP4
+ADDRLP4 3292
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 3300
+CNSTI4 2
+ASGNI4
+ADDRLP4 3292
+INDIRI4
+ADDRLP4 3300
+INDIRI4
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDP4
+ADDRLP4 132
+INDIRI4
+ADDRLP4 3300
+INDIRI4
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2328
+LABELV $2321
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2323
+ADDRLP4 132
+INDIRI4
+ADDRLP4 3188
+INDIRI4
+LTI4 $2320
+LABELV $2322
+LABELV $2306
+LABELV $2303
+LABELV $2285
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $2332
+ARGP4
+ADDRLP4 3264
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3264
+INDIRI4
+CNSTI4 0
+NEI4 $2330
+CNSTI4 0
+RETI4
+ADDRGP4 $2265
+JUMPV
+LABELV $2330
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2335
+ARGP4
+ADDRLP4 136
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3268
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3268
+INDIRI4
+CNSTI4 0
+NEI4 $2333
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $2336
+CNSTI4 3
+ARGI4
+ADDRGP4 $2339
+ARGP4
+ADDRLP4 1712
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $2336
+CNSTI4 0
+RETI4
+ADDRGP4 $2265
+JUMPV
+LABELV $2333
+CNSTI4 0
+ARGI4
+ADDRLP4 3272
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 1416
+ADDRLP4 3272
+INDIRI4
+ASGNI4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2343
+JUMPV
+LABELV $2340
+ADDRLP4 0
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1416
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2347
+JUMPV
+LABELV $2344
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2350
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3276
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3276
+INDIRI4
+CNSTI4 0
+NEI4 $2348
+ADDRGP4 $2345
+JUMPV
+LABELV $2348
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRLP4 136
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 3280
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3280
+INDIRI4
+CNSTI4 0
+NEI4 $2351
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 3284
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1416
+ADDP4
+ADDRLP4 3284
+INDIRI4
+ASGNI4
+ADDRGP4 $2346
+JUMPV
+LABELV $2351
+LABELV $2345
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 3276
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 3276
+INDIRI4
+ASGNI4
+LABELV $2347
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2344
+LABELV $2346
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2353
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $2355
+CNSTI4 3
+ARGI4
+ADDRGP4 $2358
+ARGP4
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRLP4 136
+ADDP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $2355
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $2341
+JUMPV
+LABELV $2353
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2281
+ARGP4
+ADDRLP4 1456
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3280
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3280
+INDIRI4
+CNSTI4 0
+NEI4 $2359
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $2341
+CNSTI4 3
+ARGI4
+ADDRGP4 $2364
+ARGP4
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRLP4 136
+ADDP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $2341
+JUMPV
+LABELV $2359
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $2332
+ARGP4
+ADDRLP4 3284
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3284
+INDIRI4
+CNSTI4 0
+NEI4 $2365
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 3288
+ADDRGP4 BotFuncButtonActivateGoal
+CALLI4
+ASGNI4
+ADDRLP4 3288
+INDIRI4
+CNSTI4 0
+NEI4 $2367
+ADDRGP4 $2341
+JUMPV
+LABELV $2367
+ADDRLP4 3292
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 3292
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2369
+ADDRLP4 3292
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $2369
+ADDRLP4 3296
+CNSTI4 44
+ASGNI4
+ADDRLP4 3292
+INDIRP4
+ADDRLP4 3296
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 3296
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $2369
+ADDRLP4 3300
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 3292
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRLP4 3300
+INDIRF4
+LEF4 $2369
+ADDRLP4 3292
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ADDRLP4 3300
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+GEF4 $2369
+ADDRGP4 $2341
+JUMPV
+LABELV $2369
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3304
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 3304
+INDIRI4
+CNSTI4 0
+EQI4 $2371
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3312
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 2736
+ADDRLP4 3312
+INDIRI4
+ASGNI4
+ADDRLP4 2736
+INDIRI4
+CNSTI4 0
+NEI4 $2373
+ADDRGP4 $2341
+JUMPV
+LABELV $2373
+ADDRFP4 8
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 2736
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+CNSTF4 1084227584
+ADDF4
+ASGNF4
+LABELV $2371
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $2265
+JUMPV
+LABELV $2365
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $2377
+ARGP4
+ADDRLP4 3288
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3288
+INDIRI4
+CNSTI4 0
+NEI4 $2375
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 3292
+ADDRGP4 BotTriggerMultipleActivateGoal
+CALLI4
+ASGNI4
+ADDRLP4 3292
+INDIRI4
+CNSTI4 0
+NEI4 $2378
+ADDRGP4 $2341
+JUMPV
+LABELV $2378
+ADDRLP4 3296
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 3296
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2380
+ADDRLP4 3296
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $2380
+ADDRLP4 3300
+CNSTI4 44
+ASGNI4
+ADDRLP4 3296
+INDIRP4
+ADDRLP4 3300
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 3300
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $2380
+ADDRLP4 3304
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 3296
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRLP4 3304
+INDIRF4
+LEF4 $2380
+ADDRLP4 3296
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ADDRLP4 3304
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+GEF4 $2380
+ADDRGP4 $2341
+JUMPV
+LABELV $2380
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3308
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 3308
+INDIRI4
+CNSTI4 0
+EQI4 $2382
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3316
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 2736
+ADDRLP4 3316
+INDIRI4
+ASGNI4
+ADDRLP4 2736
+INDIRI4
+CNSTI4 0
+NEI4 $2384
+ADDRGP4 $2341
+JUMPV
+LABELV $2384
+ADDRFP4 8
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 2736
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+CNSTF4 1084227584
+ADDF4
+ASGNF4
+LABELV $2382
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $2265
+JUMPV
+LABELV $2375
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $2388
+ARGP4
+ADDRLP4 3292
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3292
+INDIRI4
+CNSTI4 0
+NEI4 $2386
+ADDRGP4 $2341
+JUMPV
+LABELV $2386
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $2391
+ARGP4
+ADDRLP4 3296
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3296
+INDIRI4
+CNSTI4 0
+EQI4 $2393
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $2392
+ARGP4
+ADDRLP4 3300
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3300
+INDIRI4
+CNSTI4 0
+NEI4 $2389
+LABELV $2393
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2335
+ARGP4
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRLP4 136+128
+ADDP4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3304
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3304
+INDIRI4
+CNSTI4 0
+EQI4 $2394
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 3308
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1416
+ADDP4
+ADDRLP4 3308
+INDIRI4
+ASGNI4
+LABELV $2394
+LABELV $2389
+LABELV $2341
+LABELV $2343
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+LTI4 $2397
+ADDRLP4 132
+INDIRI4
+CNSTI4 10
+LTI4 $2340
+LABELV $2397
+CNSTI4 0
+RETI4
+LABELV $2265
+endproc BotGetActivateGoal 3320 20
+export BotGoForActivateGoal
+proc BotGoForActivateGoal 144 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $2399
+ADDRFP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+LABELV $2399
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2401
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2403
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2398
+JUMPV
+LABELV $2401
+ADDRFP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotPushOntoActivateGoalStack
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $2405
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2407
+ARGP4
+ADDRGP4 AIEnter_Seek_ActivateEntity
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2398
+JUMPV
+LABELV $2405
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $2398
+endproc BotGoForActivateGoal 144 8
+export BotPrintActivateGoalInfo
+proc BotPrintActivateGoalInfo 296 36
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $2281
+ARGP4
+ADDRLP4 36
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2409
+ADDRLP4 164
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $2411
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $2410
+JUMPV
+LABELV $2409
+ADDRLP4 164
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $2412
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $2410
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 164
+ARGP4
+ADDRGP4 trap_EA_Say
+CALLV
+pop
+LABELV $2408
+endproc BotPrintActivateGoalInfo 296 36
+export BotRandomMove
+proc BotRandomMove 32 16
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+CNSTF4 1135869952
+ADDRLP4 24
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTF4 1137180672
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 12
+INDIRB
+ASGNB 12
+LABELV $2413
+endproc BotRandomMove 32 16
+lit
+align 4
+LABELV $2417
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export BotAIBlocked
+code
+proc BotAIBlocked 472 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 180
+ADDRGP4 $2417
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2418
+ADDRFP4 0
+INDIRP4
+CNSTI4 6172
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $2416
+JUMPV
+LABELV $2418
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $2420
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRandomMove
+CALLV
+pop
+ADDRGP4 $2416
+JUMPV
+LABELV $2420
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $2422
+ADDRGP4 $2416
+JUMPV
+LABELV $2422
+ADDRLP4 440
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 440
+INDIRI4
+EQI4 $2424
+ADDRLP4 24+104
+INDIRI4
+ADDRLP4 440
+INDIRI4
+LEI4 $2424
+ADDRLP4 24+104
+INDIRI4
+ADDRGP4 max_bspmodelindex
+INDIRI4
+GTI4 $2424
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24+20
+INDIRI4
+ARGI4
+ADDRLP4 192
+ARGP4
+ADDRLP4 444
+ADDRGP4 BotGetActivateGoal
+CALLI4
+ASGNI4
+ADDRLP4 436
+ADDRLP4 444
+INDIRI4
+ASGNI4
+ADDRLP4 436
+INDIRI4
+CNSTI4 0
+EQI4 $2429
+ADDRLP4 448
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 448
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2431
+ADDRLP4 448
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $2431
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $2431
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 192+4+40
+INDIRI4
+ARGI4
+ADDRLP4 452
+ADDRGP4 BotIsGoingToActivateEntity
+CALLI4
+ASGNI4
+ADDRLP4 452
+INDIRI4
+CNSTI4 0
+NEI4 $2433
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 192
+ARGP4
+ADDRGP4 BotGoForActivateGoal
+CALLI4
+pop
+LABELV $2433
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $2430
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 456
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 456
+INDIRI4
+CNSTI4 0
+EQI4 $2430
+ADDRGP4 $2416
+JUMPV
+LABELV $2429
+ADDRLP4 192
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+LABELV $2430
+LABELV $2424
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 448
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 448
+INDIRF4
+CNSTF4 1036831949
+GEF4 $2441
+ADDRLP4 168
+CNSTF4 0
+ASGNF4
+ADDRLP4 452
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 168+4
+CNSTF4 1135869952
+ADDRLP4 452
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 168+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 168
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 456
+CNSTP4 0
+ASGNP4
+ADDRLP4 456
+INDIRP4
+ARGP4
+ADDRLP4 456
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+LABELV $2441
+ADDRLP4 164
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 180
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $2445
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $2445
+ADDRLP4 164
+INDIRI4
+CNSTI4 2
+NEI4 $2453
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 164
+INDIRI4
+ARGI4
+ADDRLP4 456
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 456
+INDIRI4
+CNSTI4 0
+NEI4 $2451
+LABELV $2453
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 164
+INDIRI4
+ARGI4
+ADDRLP4 460
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 460
+INDIRI4
+CNSTI4 0
+NEI4 $2454
+ADDRLP4 464
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+ASGNP4
+ADDRLP4 464
+INDIRP4
+ADDRLP4 464
+INDIRP4
+INDIRI4
+CNSTI4 16
+BXORI4
+ASGNI4
+ADDRLP4 468
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 468
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 468
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 3212836864
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 164
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+pop
+LABELV $2454
+LABELV $2451
+ADDRFP4 0
+INDIRP4
+CNSTI4 6172
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1053609165
+SUBF4
+GEF4 $2462
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 AINode_Seek_NBG
+CVPU4 4
+NEU4 $2464
+ADDRFP4 0
+INDIRP4
+CNSTI4 6064
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $2465
+JUMPV
+LABELV $2464
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 AINode_Seek_LTG
+CVPU4 4
+NEU4 $2466
+ADDRFP4 0
+INDIRP4
+CNSTI4 6060
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $2466
+LABELV $2465
+LABELV $2462
+LABELV $2416
+endproc BotAIBlocked 472 16
+export BotAIPredictObstacles
+proc BotAIPredictObstacles 324 44
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 bot_predictobstacles+12
+INDIRI4
+CNSTI4 0
+NEI4 $2469
+CNSTI4 0
+RETI4
+ADDRGP4 $2468
+JUMPV
+LABELV $2469
+ADDRFP4 0
+INDIRP4
+CNSTI4 6180
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $2472
+ADDRFP4 0
+INDIRP4
+CNSTI4 6176
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1086324736
+SUBF4
+LEF4 $2472
+CNSTI4 0
+RETI4
+ADDRGP4 $2468
+JUMPV
+LABELV $2472
+ADDRFP4 0
+INDIRP4
+CNSTI4 6180
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6176
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100
+ARGI4
+CNSTI4 1000
+ARGI4
+CNSTI4 6
+ARGI4
+CNSTI4 1024
+ARGI4
+CNSTI4 67108864
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_AAS_PredictRoute
+CALLI4
+pop
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $2474
+ADDRGP4 DeleteDebugLines
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 DebugLineDouble
+CALLV
+pop
+LABELV $2474
+ADDRLP4 0+16
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $2477
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $2478
+ADDRLP4 300
+CNSTI4 24
+ASGNI4
+ADDRLP4 36
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 255
+ADDRLP4 300
+INDIRI4
+LSHI4
+BANDI4
+ADDRLP4 300
+INDIRI4
+RSHI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $2478
+ADDRLP4 36
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 304
+CNSTP4 0
+ASGNP4
+ADDRLP4 304
+INDIRP4
+ARGP4
+ADDRLP4 304
+INDIRP4
+ARGP4
+ADDRLP4 308
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $2478
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 48
+ARGP4
+ADDRLP4 312
+ADDRGP4 BotGetActivateGoal
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 312
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $2478
+ADDRLP4 316
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 316
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2490
+ADDRLP4 316
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $2490
+ADDRFP4 0
+INDIRP4
+CNSTI4 6388
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $2490
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48+4+40
+INDIRI4
+ARGI4
+ADDRLP4 320
+ADDRGP4 BotIsGoingToActivateEntity
+CALLI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 0
+NEI4 $2492
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRGP4 BotGoForActivateGoal
+CALLI4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2468
+JUMPV
+LABELV $2492
+ADDRLP4 48
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRGP4 $2478
+JUMPV
+LABELV $2477
+ADDRLP4 0+16
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2496
+ADDRLP4 0+24
+INDIRI4
+CNSTI4 67108864
+BANDI4
+CNSTI4 0
+EQI4 $2499
+LABELV $2499
+LABELV $2496
+LABELV $2478
+CNSTI4 0
+RETI4
+LABELV $2468
+endproc BotAIPredictObstacles 324 44
+proc BotCheckConsoleMessages 284 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $2504
+JUMPV
+LABELV $2503
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+12
+ARGP4
+ADDRGP4 BotMatchMessage
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveConsoleMessage
+CALLV
+pop
+LABELV $2504
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 280
+ADDRGP4 trap_BotNextConsoleMessage
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+NEI4 $2503
+LABELV $2502
+endproc BotCheckConsoleMessages 284 8
+export BotCheckForGrenades
+proc BotCheckForGrenades 8 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $2510
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $2508
+LABELV $2510
+ADDRGP4 $2507
+JUMPV
+LABELV $2508
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTF4 1126170624
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotAddAvoidSpot
+CALLV
+pop
+LABELV $2507
+endproc BotCheckForGrenades 8 16
+export BotCheckEvents
+proc BotCheckEvents 172 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 132
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 832
+ADDRLP4 132
+INDIRI4
+MULI4
+ADDRGP4 g_entities+552
+ADDP4
+INDIRI4
+NEI4 $2512
+ADDRGP4 $2511
+JUMPV
+LABELV $2512
+ADDRLP4 136
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ADDP4
+CNSTI4 832
+ADDRLP4 136
+INDIRI4
+MULI4
+ADDRGP4 g_entities+552
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 18
+LEI4 $2516
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 18
+SUBI4
+CNSTI4 -769
+BANDI4
+ASGNI4
+ADDRGP4 $2517
+JUMPV
+LABELV $2516
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CNSTI4 -769
+BANDI4
+ASGNI4
+LABELV $2517
+ADDRLP4 140
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+LTI4 $2518
+ADDRLP4 140
+INDIRI4
+CNSTI4 54
+GTI4 $2557
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2558-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2558
+address $2519
+address $2519
+address $2519
+address $2519
+address $2519
+address $2519
+address $2519
+address $2519
+address $2519
+address $2519
+address $2519
+address $2519
+address $2519
+address $2519
+address $2519
+address $2519
+address $2519
+address $2519
+address $2519
+address $2519
+address $2519
+address $2519
+address $2519
+address $2518
+address $2518
+address $2518
+address $2518
+address $2518
+address $2518
+address $2518
+address $2518
+address $2518
+address $2518
+address $2518
+address $2518
+address $2518
+address $2518
+address $2518
+address $2518
+address $2518
+address $2518
+address $2518
+address $2543
+address $2518
+address $2518
+address $2518
+address $2518
+address $2518
+address $2520
+address $2518
+address $2518
+address $2544
+address $2534
+address $2519
+code
+LABELV $2557
+ADDRLP4 144
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 65
+LTI4 $2518
+ADDRLP4 144
+INDIRI4
+CNSTI4 79
+GTI4 $2518
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2560-260
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2560
+address $2523
+address $2518
+address $2518
+address $2518
+address $2518
+address $2518
+address $2518
+address $2519
+address $2519
+address $2519
+address $2519
+address $2519
+address $2519
+address $2519
+address $2519
+code
+LABELV $2520
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 17
+NEI4 $2519
+ADDRFP4 0
+INDIRP4
+CNSTI4 8380
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2519
+JUMPV
+LABELV $2523
+ADDRLP4 148
+ADDRFP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 152
+ADDRFP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 156
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2524
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRLP4 164
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+ADDRLP4 152
+INDIRI4
+EQI4 $2529
+ADDRLP4 164
+INDIRI4
+CNSTI4 1023
+EQI4 $2529
+ADDRLP4 164
+INDIRI4
+CNSTI4 1022
+NEI4 $2526
+LABELV $2529
+ADDRFP4 0
+INDIRP4
+CNSTI4 6008
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2527
+JUMPV
+LABELV $2526
+ADDRFP4 0
+INDIRP4
+CNSTI4 6008
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2527
+ADDRLP4 168
+ADDRFP4 0
+INDIRP4
+CNSTI4 6028
+ADDP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ADDRLP4 168
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2519
+JUMPV
+LABELV $2524
+ADDRLP4 152
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2530
+ADDRFP4 0
+INDIRP4
+CNSTI4 6004
+ADDP4
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6140
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+CNSTI4 6032
+ADDP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ADDRLP4 164
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2519
+JUMPV
+LABELV $2530
+ADDRLP4 164
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+NEI4 $2519
+ADDRLP4 148
+INDIRI4
+ADDRLP4 164
+INDIRI4
+NEI4 $2519
+ADDRFP4 0
+INDIRP4
+CNSTI4 6012
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2519
+JUMPV
+LABELV $2534
+ADDRLP4 148
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+LTI4 $2537
+ADDRLP4 148
+INDIRI4
+CNSTI4 256
+LEI4 $2535
+LABELV $2537
+CNSTI4 3
+ARGI4
+ADDRGP4 $2538
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $2519
+JUMPV
+LABELV $2535
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 288
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $2541
+ARGP4
+ADDRLP4 152
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+NEI4 $2519
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotGoForPowerups
+CALLV
+pop
+ADDRGP4 $2519
+JUMPV
+LABELV $2543
+ADDRGP4 lastteleport_origin
+ADDRFP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 lastteleport_time
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $2519
+JUMPV
+LABELV $2544
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2519
+ADDRLP4 148
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+LTI4 $2549
+ADDRLP4 148
+INDIRI4
+CNSTI4 256
+LTI4 $2547
+LABELV $2549
+CNSTI4 3
+ARGI4
+ADDRGP4 $2550
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $2519
+JUMPV
+LABELV $2547
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 288
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $2553
+ARGP4
+ADDRLP4 152
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+NEI4 $2519
+ADDRFP4 0
+INDIRP4
+CNSTI4 5076
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $2519
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+LABELV $2518
+LABELV $2519
+LABELV $2511
+endproc BotCheckEvents 172 12
+export BotCheckSnapshot
+proc BotCheckSnapshot 216 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 vec3_origin
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_BotAddAvoidSpot
+CALLV
+pop
+ADDRLP4 208
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2564
+JUMPV
+LABELV $2563
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckEvents
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckForGrenades
+CALLV
+pop
+LABELV $2564
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 208
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 212
+ADDRGP4 BotAI_GetSnapshotEntity
+CALLI4
+ASGNI4
+ADDRLP4 208
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 -1
+NEI4 $2563
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotAI_GetEntityState
+CALLI4
+pop
+ADDRLP4 0+180
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+184
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckEvents
+CALLV
+pop
+LABELV $2562
+endproc BotCheckSnapshot 216 16
+export BotCheckAir
+proc BotCheckAir 4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $2569
+ADDRGP4 $2568
+JUMPV
+LABELV $2569
+ADDRFP4 0
+INDIRP4
+CNSTI4 6148
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $2568
+endproc BotCheckAir 4 4
+export MissingMapConts
+proc MissingMapConts 16 0
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 8
+NEI4 $2572
+ADDRGP4 level+48
+INDIRI4
+CNSTI4 0
+NEI4 $2576
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2577
+JUMPV
+LABELV $2576
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2577
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $2571
+JUMPV
+LABELV $2572
+ADDRLP4 4
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 7
+EQI4 $2580
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $2578
+LABELV $2580
+ADDRLP4 12
+CNSTU4 0
+ASGNU4
+ADDRGP4 level+20
+INDIRP4
+CVPU4 4
+ADDRLP4 12
+INDIRU4
+EQU4 $2590
+ADDRGP4 level+28
+INDIRP4
+CVPU4 4
+ADDRLP4 12
+INDIRU4
+EQU4 $2590
+ADDRGP4 level+24
+INDIRP4
+CVPU4 4
+ADDRLP4 12
+INDIRU4
+EQU4 $2590
+ADDRGP4 level+40
+INDIRP4
+CVPU4 4
+ADDRLP4 12
+INDIRU4
+NEU4 $2586
+LABELV $2590
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2587
+JUMPV
+LABELV $2586
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $2587
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $2571
+JUMPV
+LABELV $2578
+CNSTI4 0
+RETI4
+LABELV $2571
+endproc MissingMapConts 16 0
+export BotDeathmatchAI
+proc BotDeathmatchAI 1496 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6016
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $2592
+ADDRLP4 1460
+ADDRFP4 0
+INDIRP4
+CNSTI4 6016
+ADDP4
+ASGNP4
+ADDRLP4 1460
+INDIRP4
+ADDRLP4 1460
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6016
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $2594
+ADDRGP4 $2591
+JUMPV
+LABELV $2594
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 148
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Characteristic_String
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 292
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 292
+ARGP4
+ADDRGP4 $2596
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 292
+ARGP4
+ADDRGP4 trap_SetUserinfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6020
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2597
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+EQI4 $2597
+ADDRLP4 1316
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 $2600
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4756
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1316
+ARGP4
+ADDRGP4 trap_EA_Command
+CALLV
+pop
+LABELV $2597
+ADDRLP4 148
+INDIRI1
+CVII4 1
+CNSTI4 109
+NEI4 $2601
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotSetChatGender
+CALLV
+pop
+ADDRGP4 $2602
+JUMPV
+LABELV $2601
+ADDRLP4 148
+INDIRI1
+CVII4 1
+CNSTI4 102
+NEI4 $2603
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotSetChatGender
+CALLV
+pop
+ADDRGP4 $2604
+JUMPV
+LABELV $2603
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_BotSetChatGender
+CALLV
+pop
+LABELV $2604
+LABELV $2602
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotSetChatName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6036
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5072
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6040
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8364
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6016
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2592
+ADDRLP4 1460
+ADDRGP4 MissingMapConts
+CALLI4
+ASGNI4
+ADDRLP4 1460
+INDIRI4
+CNSTI4 0
+EQI4 $2605
+ADDRGP4 $2591
+JUMPV
+LABELV $2605
+ADDRLP4 1464
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+ASGNP4
+ADDRLP4 1464
+INDIRP4
+ADDRLP4 1464
+INDIRP4
+INDIRI4
+CNSTI4 -33
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1468
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 1468
+INDIRI4
+CNSTI4 0
+NEI4 $2607
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeleportTime
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotUpdateInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckSnapshot
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAir
+CALLV
+pop
+LABELV $2607
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckConsoleMessages
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1472
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 1472
+INDIRI4
+CNSTI4 0
+NEI4 $2609
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1476
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 1476
+INDIRI4
+CNSTI4 0
+NEI4 $2609
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotTeamAI
+CALLV
+pop
+LABELV $2609
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2611
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2613
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+LABELV $2611
+ADDRFP4 0
+INDIRP4
+CNSTI4 6024
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2614
+ADDRFP4 0
+INDIRP4
+CNSTI4 6056
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+LEF4 $2614
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1484
+ADDRGP4 BotChat_EnterGame
+CALLI4
+ASGNI4
+ADDRLP4 1484
+INDIRI4
+CNSTI4 0
+EQI4 $2616
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1492
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6088
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 1492
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2618
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+LABELV $2616
+ADDRFP4 0
+INDIRP4
+CNSTI4 6024
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $2614
+ADDRGP4 level+9476
+INDIRI4
+CNSTI4 0
+EQI4 $2619
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRGP4 AINode_Cam
+ASGNP4
+LABELV $2619
+ADDRGP4 BotResetNodeSwitches
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2622
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1488
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 1488
+INDIRI4
+CNSTI4 0
+EQI4 $2626
+ADDRGP4 $2624
+JUMPV
+LABELV $2626
+LABELV $2623
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+LTI4 $2622
+LABELV $2624
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $2628
+ADDRGP4 $2591
+JUMPV
+LABELV $2628
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+LTI4 $2630
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotDumpGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotDumpAvoidGoals
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotDumpNodeSwitches
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+CNSTI4 3
+ARGI4
+ADDRGP4 $2632
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 floattime
+INDIRF4
+ARGF4
+CNSTI4 50
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $2630
+ADDRFP4 0
+INDIRP4
+CNSTI4 6036
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5072
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6040
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2591
+endproc BotDeathmatchAI 1496 20
+export BotSelectLogo
+proc BotSelectLogo 1332 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 300
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 300
+ARGP4
+ADDRGP4 $2634
+ARGP4
+ADDRLP4 1328
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1324
+ADDRLP4 1328
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 300
+ARGI4
+ADDRGP4 $2635
+ARGP4
+ADDRLP4 1324
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_EA_Command
+CALLV
+pop
+LABELV $2633
+endproc BotSelectLogo 1332 16
+lit
+align 4
+LABELV $2637
+byte 4 0
+byte 4 0
+byte 4 0
+export CheckMatrixForGoal
+code
+proc CheckMatrixForGoal 132 4
+ADDRLP4 76
+ADDRGP4 $2637
+INDIRB
+ASGNB 12
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 20
+ARGP4
+ADDRLP4 108
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 72
+CNSTI4 9999
+ASGNI4
+ADDRLP4 112
+CNSTI4 54
+ASGNI4
+ADDRLP4 44
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 92
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 116
+CNSTI4 45
+ASGNI4
+ADDRLP4 88
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 100
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 104
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 2
+ASGNI4
+ADDRLP4 40
+ADDRLP4 20
+INDIRF4
+ADDRLP4 104
+INDIRI4
+CVIF4 4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2641
+JUMPV
+LABELV $2638
+ADDRLP4 32
+ADDRLP4 20+4
+INDIRF4
+ADDRLP4 100
+INDIRI4
+CVIF4 4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2645
+JUMPV
+LABELV $2642
+ADDRLP4 12
+ADDRLP4 20+8
+INDIRF4
+ADDRLP4 92
+INDIRI4
+CVIF4 4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2651
+JUMPV
+LABELV $2648
+ADDRLP4 0
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 32
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 120
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $2656
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 124
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 124
+INDIRI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+EQI4 $2658
+ADDRLP4 52
+ADDRLP4 20
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 52+4
+ADDRLP4 20+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 52+8
+ADDRLP4 20+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 52
+ARGP4
+ADDRLP4 128
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 128
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+ADDRLP4 72
+INDIRI4
+GEI4 $2666
+ADDRLP4 72
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 76
+ADDRLP4 0
+INDIRB
+ASGNB 12
+LABELV $2666
+LABELV $2658
+LABELV $2656
+LABELV $2649
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 36
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $2651
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ADDRLP4 20+8
+INDIRF4
+ADDRLP4 44
+INDIRI4
+CVIF4 4
+ADDF4
+LTF4 $2648
+LABELV $2643
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+ADDRLP4 36
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $2645
+ADDRLP4 32
+INDIRI4
+CVIF4 4
+ADDRLP4 20+4
+INDIRF4
+ADDRLP4 88
+INDIRI4
+CVIF4 4
+ADDF4
+LTF4 $2642
+LABELV $2639
+ADDRLP4 40
+ADDRLP4 40
+INDIRI4
+ADDRLP4 36
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $2641
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 96
+INDIRI4
+CVIF4 4
+ADDF4
+LTF4 $2638
+ADDRLP4 72
+INDIRI4
+CNSTI4 9999
+GEI4 $2668
+ADDRFP4 0
+INDIRP4
+ADDRLP4 76
+INDIRB
+ASGNB 12
+ADDRLP4 120
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ARGP4
+ADDRLP4 124
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 124
+INDIRI4
+ASGNI4
+LABELV $2668
+LABELV $2636
+endproc CheckMatrixForGoal 132 4
+export FixGoalArea
+proc FixGoalArea 72 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 28
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 68
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $2673
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $2674
+JUMPV
+LABELV $2673
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CheckMatrixForGoal
+CALLV
+pop
+LABELV $2674
+LABELV $2670
+endproc FixGoalArea 72 20
+export CheckAreaForGoal
+proc CheckAreaForGoal 256 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 176
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 224
+ADDRGP4 trap_AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 220
+ADDRLP4 224
+INDIRI4
+ASGNI4
+ADDRLP4 220
+INDIRI4
+CNSTI4 0
+EQI4 $2676
+ADDRLP4 176
+ADDRLP4 220
+INDIRI4
+ASGNI4
+ADDRLP4 220
+INDIRI4
+ARGI4
+ADDRLP4 232
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CNSTI4 0
+EQI4 $2678
+ADDRLP4 220
+INDIRI4
+RETI4
+ADDRGP4 $2675
+JUMPV
+LABELV $2678
+LABELV $2676
+ADDRLP4 192
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 192+8
+ADDRLP4 192+8
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 192
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 56
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 228
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 184
+ADDRLP4 228
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2684
+JUMPV
+LABELV $2681
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 232
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CNSTI4 0
+EQI4 $2685
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $2675
+JUMPV
+LABELV $2685
+LABELV $2682
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2684
+ADDRLP4 0
+INDIRI4
+ADDRLP4 184
+INDIRI4
+LTI4 $2681
+ADDRLP4 188
+CNSTF4 1232348144
+ASGNF4
+ADDRLP4 208
+CNSTI4 0
+ASGNI4
+ADDRLP4 216
+CNSTI4 1
+ASGNI4
+LABELV $2687
+ADDRLP4 212
+CNSTI4 1
+ASGNI4
+LABELV $2691
+ADDRLP4 204
+CNSTI4 1
+ASGNI4
+LABELV $2695
+ADDRLP4 192
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 232
+CNSTI4 3
+ASGNI4
+ADDRLP4 192
+ADDRLP4 192
+INDIRF4
+ADDRLP4 212
+INDIRI4
+ADDRLP4 232
+INDIRI4
+LSHI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 192+4
+ADDRLP4 192+4
+INDIRF4
+ADDRLP4 204
+INDIRI4
+ADDRLP4 232
+INDIRI4
+LSHI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 192+8
+ADDRLP4 192+8
+INDIRF4
+CNSTI4 12
+ADDRLP4 216
+INDIRI4
+MULI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 192
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 56
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 236
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 184
+ADDRLP4 236
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2704
+JUMPV
+LABELV $2701
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 240
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 240
+INDIRI4
+CNSTI4 0
+EQI4 $2705
+ADDRLP4 244
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 244
+INDIRI4
+ADDRLP4 56
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 244
+INDIRI4
+ADDRLP4 56+4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 56+8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 252
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 252
+INDIRF4
+ASGNF4
+ADDRLP4 180
+INDIRF4
+ADDRLP4 188
+INDIRF4
+GEF4 $2711
+ADDRLP4 208
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 188
+ADDRLP4 180
+INDIRF4
+ASGNF4
+LABELV $2711
+LABELV $2705
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+NEI4 $2713
+ADDRLP4 176
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2713
+LABELV $2702
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2704
+ADDRLP4 0
+INDIRI4
+ADDRLP4 184
+INDIRI4
+LTI4 $2701
+LABELV $2696
+ADDRLP4 204
+ADDRLP4 204
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 -1
+GEI4 $2695
+LABELV $2692
+ADDRLP4 212
+ADDRLP4 212
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 -1
+GEI4 $2691
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+EQI4 $2715
+ADDRLP4 208
+INDIRI4
+RETI4
+ADDRGP4 $2675
+JUMPV
+LABELV $2715
+LABELV $2688
+ADDRLP4 216
+ADDRLP4 216
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 216
+INDIRI4
+CNSTI4 -1
+GEI4 $2687
+ADDRLP4 176
+INDIRI4
+RETI4
+LABELV $2675
+endproc CheckAreaForGoal 256 20
+export BotSetupDeathmatchAI
+proc BotSetupDeathmatchAI 204 16
+ADDRGP4 $2718
+ARGP4
+ADDRLP4 148
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 gametype
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRGP4 $93
+ARGP4
+ADDRLP4 152
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 maxclients
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRGP4 bot_fastchat
+ARGP4
+ADDRGP4 $2719
+ARGP4
+ADDRGP4 $2720
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_nochat
+ARGP4
+ADDRGP4 $2721
+ARGP4
+ADDRGP4 $2720
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_testrchat
+ARGP4
+ADDRGP4 $2722
+ARGP4
+ADDRGP4 $2720
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_challenge
+ARGP4
+ADDRGP4 $2723
+ARGP4
+ADDRGP4 $2720
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_predictobstacles
+ARGP4
+ADDRGP4 $2724
+ARGP4
+ADDRGP4 $2725
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 g_spSkill
+ARGP4
+ADDRGP4 $2726
+ARGP4
+ADDRGP4 $2727
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $2728
+ADDRLP4 160
+CNSTI4 0
+ASGNI4
+ADDRLP4 156
+CNSTI4 0
+ASGNI4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $495
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+ADDRLP4 164
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+GEI4 $2730
+CNSTI4 2
+ARGI4
+ADDRGP4 $2732
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $2730
+CNSTI4 -1
+ARGI4
+ADDRGP4 $496
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+ADDRLP4 168
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+GEI4 $2733
+CNSTI4 2
+ARGI4
+ADDRGP4 $2735
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $2733
+ADDRLP4 0
+ADDRGP4 g_entities+53248
+ASGNP4
+ADDRLP4 8
+CNSTI4 64
+ASGNI4
+ADDRGP4 $2740
+JUMPV
+LABELV $2737
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2742
+ADDRGP4 $2738
+JUMPV
+LABELV $2742
+ADDRLP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $2746
+ARGP4
+ADDRLP4 172
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+NEI4 $2744
+ADDRGP4 ctf_blueflag+40
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 156
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2745
+JUMPV
+LABELV $2744
+ADDRLP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $2750
+ARGP4
+ADDRLP4 176
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+NEI4 $2748
+ADDRGP4 ctf_redflag+40
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 160
+CNSTI4 1
+ASGNI4
+LABELV $2748
+LABELV $2745
+ADDRLP4 180
+CNSTI4 0
+ASGNI4
+ADDRLP4 160
+INDIRI4
+ADDRLP4 180
+INDIRI4
+EQI4 $2752
+ADDRLP4 156
+INDIRI4
+ADDRLP4 180
+INDIRI4
+EQI4 $2752
+ADDRGP4 $2739
+JUMPV
+LABELV $2752
+LABELV $2738
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 832
+ADDP4
+ASGNP4
+LABELV $2740
+ADDRLP4 8
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $2737
+LABELV $2739
+ADDRGP4 WaypointInit
+CALLV
+pop
+LABELV $2728
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 156
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRGP4 $2757
+JUMPV
+LABELV $2754
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2759
+ADDRGP4 $2755
+JUMPV
+LABELV $2759
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+NEI4 $2761
+ADDRGP4 $2756
+JUMPV
+LABELV $2761
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 15
+NEI4 $2763
+CNSTI4 56
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 hstations+40
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 56
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 hstations
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 160
+CNSTI4 56
+ADDRLP4 4
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+ADDRGP4 hstations
+ADDP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+ADDRGP4 hstations+12
+ADDP4
+ADDRLP4 164
+INDIRI4
+ASGNI4
+CNSTI4 56
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 hstations+16
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRB
+ASGNB 12
+CNSTI4 56
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 hstations+28
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRB
+ASGNB 12
+CNSTI4 56
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 hstations+48
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 56
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 hstations+12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 168
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+NEI4 $2770
+CNSTI4 56
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 hstations
+ADDP4
+ARGP4
+ADDRGP4 CheckMatrixForGoal
+CALLV
+pop
+LABELV $2770
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2763
+LABELV $2755
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 832
+ADDP4
+ASGNP4
+LABELV $2757
+ADDRLP4 8
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $2754
+LABELV $2756
+ADDRGP4 num_hstations
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 160
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 7
+EQI4 $2775
+ADDRLP4 160
+INDIRI4
+CNSTI4 3
+NEI4 $2773
+LABELV $2775
+ADDRGP4 level+28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2776
+ADDRLP4 164
+CNSTF4 1073741824
+ASGNF4
+ADDRGP4 bwall
+ADDRGP4 level+28
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRF4
+ADDRGP4 level+28
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 164
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 bwall+4
+ADDRGP4 level+28
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRF4
+ADDRGP4 level+28
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 164
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 level+28
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRF4
+ADDRGP4 level+28
+INDIRP4
+CNSTI4 456
+ADDP4
+INDIRF4
+GEF4 $2784
+ADDRGP4 bwall+8
+ADDRGP4 level+28
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+ASGNF4
+ADDRGP4 $2785
+JUMPV
+LABELV $2784
+ADDRGP4 bwall+8
+ADDRGP4 level+28
+INDIRP4
+CNSTI4 456
+ADDP4
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+ASGNF4
+LABELV $2785
+ADDRGP4 bwall+40
+ADDRGP4 level+28
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 bwall+16
+ADDRGP4 level+28
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 bwall+28
+ADDRGP4 level+28
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 bwall
+ARGP4
+ADDRLP4 168
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRGP4 bwall+12
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRGP4 bwall+48
+CNSTI4 0
+ASGNI4
+ADDRGP4 bwall
+ARGP4
+ADDRGP4 CheckMatrixForGoal
+CALLV
+pop
+LABELV $2776
+ADDRGP4 level+24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2800
+ADDRLP4 164
+CNSTF4 1073741824
+ASGNF4
+ADDRGP4 rwall
+ADDRGP4 level+24
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRF4
+ADDRGP4 level+24
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 164
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 rwall+4
+ADDRGP4 level+24
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRF4
+ADDRGP4 level+24
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 164
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 level+24
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRF4
+ADDRGP4 level+24
+INDIRP4
+CNSTI4 456
+ADDP4
+INDIRF4
+GEF4 $2808
+ADDRGP4 rwall+8
+ADDRGP4 level+24
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+ASGNF4
+ADDRGP4 $2809
+JUMPV
+LABELV $2808
+ADDRGP4 rwall+8
+ADDRGP4 level+24
+INDIRP4
+CNSTI4 456
+ADDP4
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+ASGNF4
+LABELV $2809
+ADDRGP4 rwall+40
+ADDRGP4 level+24
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 rwall+16
+ADDRGP4 level+24
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 rwall+28
+ADDRGP4 level+24
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 rwall
+ARGP4
+ADDRLP4 168
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRGP4 rwall+12
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRGP4 rwall+48
+CNSTI4 0
+ASGNI4
+ADDRGP4 rwall
+ARGP4
+ADDRGP4 CheckMatrixForGoal
+CALLV
+pop
+LABELV $2800
+ADDRGP4 level+20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2824
+ADDRLP4 164
+CNSTF4 1073741824
+ASGNF4
+ADDRGP4 spraytele
+ADDRGP4 level+20
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRF4
+ADDRGP4 level+20
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 164
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 spraytele+4
+ADDRGP4 level+20
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRF4
+ADDRGP4 level+20
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 164
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 spraytele+8
+ADDRGP4 level+20
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRF4
+ADDRGP4 level+20
+INDIRP4
+CNSTI4 456
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRGP4 spraytele+40
+ADDRGP4 level+20
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 spraytele+16
+ADDRGP4 level+20
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 spraytele+28
+ADDRGP4 level+20
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 spraytele
+ARGP4
+ADDRLP4 168
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRGP4 spraytele+12
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRGP4 spraytele+48
+CNSTI4 0
+ASGNI4
+ADDRGP4 spraytele
+ARGP4
+ADDRGP4 FixGoalArea
+CALLV
+pop
+LABELV $2824
+ADDRGP4 level+40
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2774
+ADDRLP4 164
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 outtele
+ADDRLP4 164
+INDIRF4
+ADDRGP4 level+40
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRF4
+ADDRGP4 level+40
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRGP4 outtele+4
+ADDRLP4 164
+INDIRF4
+ADDRGP4 level+40
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRF4
+ADDRGP4 level+40
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRGP4 outtele+8
+ADDRGP4 level+40
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+ADDRGP4 outtele+40
+ADDRGP4 level+40
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 outtele+16
+ADDRGP4 level+40
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 outtele+28
+ADDRGP4 level+40
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 outtele
+ARGP4
+ADDRLP4 168
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRGP4 outtele+12
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRGP4 outtele+48
+CNSTI4 0
+ASGNI4
+ADDRGP4 outtele
+ARGP4
+ADDRGP4 CheckMatrixForGoal
+CALLV
+pop
+ADDRGP4 $2774
+JUMPV
+LABELV $2773
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 8
+NEI4 $2861
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 164
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRGP4 $2866
+JUMPV
+LABELV $2863
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2868
+ADDRGP4 $2864
+JUMPV
+LABELV $2868
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $2870
+ADDRGP4 $2865
+JUMPV
+LABELV $2870
+ADDRLP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $2874
+ARGP4
+ADDRLP4 168
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+NEI4 $2872
+CNSTI4 56
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 balloongoal+40
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 56
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 balloongoal
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+CNSTI4 56
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 balloongoal
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+CNSTI4 56
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 balloongoal+4
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 456
+ADDP4
+INDIRF4
+GEF4 $2879
+ADDRLP4 180
+ADDRLP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $2880
+JUMPV
+LABELV $2879
+ADDRLP4 180
+ADDRLP4 0
+INDIRP4
+CNSTI4 456
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $2880
+CNSTI4 56
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 balloongoal+8
+ADDP4
+ADDRLP4 180
+INDIRF4
+ASGNF4
+ADDRLP4 188
+CNSTI4 56
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 balloongoal+8
+ADDP4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+ADDRLP4 188
+INDIRP4
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 192
+CNSTI4 56
+ADDRLP4 4
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+ADDRGP4 balloongoal
+ADDP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+ADDRGP4 balloongoal+12
+ADDP4
+ADDRLP4 196
+INDIRI4
+ASGNI4
+CNSTI4 56
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 balloongoal+16
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRB
+ASGNB 12
+CNSTI4 56
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 balloongoal+28
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRB
+ASGNB 12
+CNSTI4 56
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 balloongoal+48
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 56
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 balloongoal+12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 200
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+NEI4 $2886
+CNSTI4 56
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 balloongoal
+ADDP4
+ARGP4
+ADDRGP4 CheckMatrixForGoal
+CALLV
+pop
+LABELV $2886
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2872
+LABELV $2864
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 832
+ADDP4
+ASGNP4
+LABELV $2866
+ADDRLP4 8
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $2863
+LABELV $2865
+LABELV $2861
+LABELV $2774
+ADDRLP4 164
+CNSTI4 0
+ASGNI4
+ADDRGP4 max_bspmodelindex
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+ARGI4
+ADDRLP4 168
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRGP4 $2892
+JUMPV
+LABELV $2889
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 $533
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 172
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+NEI4 $2893
+ADDRGP4 $2890
+JUMPV
+LABELV $2893
+ADDRLP4 16
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $2895
+ADDRLP4 16+1
+ARGP4
+ADDRLP4 176
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 176
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+ADDRGP4 max_bspmodelindex
+INDIRI4
+LEI4 $2898
+ADDRGP4 max_bspmodelindex
+ADDRLP4 144
+INDIRI4
+ASGNI4
+LABELV $2898
+LABELV $2895
+LABELV $2890
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 172
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 172
+INDIRI4
+ASGNI4
+LABELV $2892
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2889
+LABELV $2717
+endproc BotSetupDeathmatchAI 204 16
+bss
+align 4
+LABELV max_bspmodelindex
+skip 4
+align 4
+LABELV lastteleport_time
+skip 4
+align 4
+LABELV lastteleport_origin
+skip 12
+align 4
+LABELV g_spSkill
+skip 272
+align 4
+LABELV bot_predictobstacles
+skip 272
+export scorealert
+align 4
+LABELV scorealert
+skip 12
+import BotClientTravelTimeToGoal
+import BotTeamAI
+import BotChooseCorrectWall
+import BotChooseWall
+import BotDumpNodeSwitches
+import BotResetNodeSwitches
+import AINode_Cam
+import AINode_Reachtest
+import AIEnter_Reachtest
+import AINode_Battle_NBG
+import AINode_Battle_Retreat
+import AINode_Battle_Chase
+import AINode_Battle_Fight
+import AINode_Seek_LTG
+import AINode_Seek_NBG
+import AINode_Seek_ActivateEntity
+import AINode_Respawn
+import AIEnter_Battle_NBG
+import AIEnter_Battle_Retreat
+import AIEnter_Battle_Chase
+import AIEnter_Battle_Fight
+import AIEnter_Seek_Camp
+import AIEnter_Seek_LTG
+import AIEnter_Seek_NBG
+import AIEnter_Seek_ActivateEntity
+import AIEnter_Stand
+import BotMatchMessage
+import notleader
+import BotChatTest
+import BotChatTime
+import BotChat_Random
+import BotChat_EnemySuicide
+import BotChat_Kill
+import BotChat_Death
+import BotChat_HitNoKill
+import BotChat_HitNoDeath
+import BotChat_HitTalking
+import BotChat_EndLevel
+import BotChat_StartLevel
+import BotChat_ExitGame
+import BotChat_EnterGame
+export num_hstations
+align 4
+LABELV num_hstations
+skip 4
+export hstations
+align 4
+LABELV hstations
+skip 448
+export outtele
+align 4
+LABELV outtele
+skip 56
+export spraytele
+align 4
+LABELV spraytele
+skip 56
+export bwall
+align 4
+LABELV bwall
+skip 56
+export rwall
+align 4
+LABELV rwall
+skip 56
+export balloongoal
+align 4
+LABELV balloongoal
+skip 168
+export ctf_blueflag
+align 4
+LABELV ctf_blueflag
+skip 56
+export ctf_redflag
+align 4
+LABELV ctf_redflag
+skip 56
+export bot_challenge
+align 4
+LABELV bot_challenge
+skip 272
+export bot_testrchat
+align 4
+LABELV bot_testrchat
+skip 272
+export bot_nochat
+align 4
+LABELV bot_nochat
+skip 272
+export bot_fastchat
+align 4
+LABELV bot_fastchat
+skip 272
+export maxclients
+align 4
+LABELV maxclients
+skip 4
+export gametype
+align 4
+LABELV gametype
+skip 4
+import BotRememberLastOrderedTask
+import BotSetUserInfo
+import BotAI_AllowLTGRefresh
+import BotAI_GetSnapshotEntity
+import BotAI_GetEntityState
+import BotAI_GetClientState
+import BotAI_ShareVisibility
+import BotAI_SharedVisibility
+import BotAI_VisTrace
+import BotAI_Trace
+import BotAI_BotInitialChat
+import BotAI_Print
+import BotAddInfo
+import floattime
+import WaypointInit
+import GetWpID
+import BotWpHasSuccessor
+import GetNextWp
+import FindWp
+import BotWpValid
+import BotEntityInfo
+import BotResetState
+import AngleDifference
+import numboomiespots
+import boomiespots
+import numbambamspots
+import bambamspots
+import numwaypoints
+import waypoints
+import bot_developer
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotAllocWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownMoveAI
+import BotSetupMoveAI
+import BotSetBrushModelTypes
+import BotAddAvoidSpot
+import BotInitMoveState
+import BotFreeMoveState
+import BotAllocMoveState
+import BotPredictVisiblePosition
+import BotMovementViewTarget
+import BotReachabilityArea
+import BotResetLastAvoidReach
+import BotResetAvoidReach
+import BotMoveInDirection
+import BotMoveToGoal
+import BotResetMoveState
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GeneticParentsAndChildSelection
+import BotSetChatName
+import BotSetChatGender
+import BotLoadChatFile
+import BotReplaceSynonyms
+import UnifyWhiteSpaces
+import BotMatchVariable
+import BotFindMatch
+import StringContains
+import BotGetChatMessage
+import BotEnterChat
+import BotChatLength
+import BotReplyChat
+import BotNumInitialChats
+import BotInitialChat
+import BotNumConsoleMessages
+import BotNextConsoleMessage
+import BotRemoveConsoleMessage
+import BotQueueConsoleMessage
+import BotFreeChatState
+import BotAllocChatState
+import BotShutdownChatAI
+import BotSetupChatAI
+import BotShutdownCharacters
+import Characteristic_String
+import Characteristic_BInteger
+import Characteristic_Integer
+import Characteristic_BFloat
+import Characteristic_Float
+import BotFreeCharacter
+import BotLoadCharacter
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Walk
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import GetBotLibAPI
+import trap_AAS_BestReachableArea
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntities
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_RealTime
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_EntitiesInPVS
+import trap_RestoreClients
+import trap_RewindClients
+import trap_GetUsercmds
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_TraceBatch
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import g_logDamage
+import g_modInstagib_WeaponJump
+import g_modInstagib
+import g_transmitSVboastermissiles
+import g_KillerduckHealth
+import g_LPS_flags
+import g_LPS_startlives
+import g_skyLensflare
+import g_sky
+import g_q3Items
+import pmove_msec
+import pmove_fixed
+import g_antilag
+import g_smoothClients
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_curWarmupReady
+import g_warmupReady
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import MapSupportsGametype
+import G_GetArenaInfoByMap
+import G_InitGameinfo
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import AI_RemoveBambam
+import AI_AddBambam
+import AI_RemoveBoomie
+import AI_AddBoomie
+import BotCamViewangles
+import BotCamViewTarget
+import BotCamViewEntitiy
+import BotChooseWeap
+import BotCamFire
+import BotCamTaunt
+import BotCamMoveTo
+import BotCamMode
+import BotInterbreedEndMatch
+import Svcmd_BotStats_f
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_LoadBots
+import CantDamageTeamitem
+import boomies_createByPlayer
+import bambam_createByPlayer
+import IsItemSameTeam
+import Instagib_canSpawnEntity
+import Instagib_isRelevantDamageEvent
+import Instagib_calculateDamage
+import Instagib_getSpawnWeapon
+import Instagib_applyWeaponJumpKnockback
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import PrintMsg
+import CheckObeliskAttack
+import Team_GetFlagStatus
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThinkBatch
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogFlush
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import G_GetCvarInt
+import MoveClientToIntermission
+import G_SendScoreboardUpdates
+import DeathmatchScoreboardMessage
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import GetASpawnPosition
+import SelectSpectatorSpawnPoint
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import respawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import Touch_DoorTrigger
+import G_PushablesChanged
+import G_RunMover
+import fire_kma
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_bubbleg
+import fire_bambamMissile
+import fire_duck
+import explode_imperius
+import fire_splasher
+import fire_nipper
+import fire_boaster
+import G_RunExplosion
+import G_RunMissile
+import BerserkerCheck
+import TossClientCubes
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import GametypeNameShort
+import GametypeName
+import RemoveOwnedItems
+import SetAward
+import G_RestorePowerups
+import G_BackupPowerups
+import DeleteDebugLines
+import DebugLineDouble
+import DebugLine
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_NextActiveEntity
+import G_InitEntityLists
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_FindAll
+import G_Find
+import G_EntityIndexChanged
+import G_InitEntityIndex
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import G_Say
+import ConcatArgs
+import Cmd_DropCartridge_f
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $2874
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 122
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $2750
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 76
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 108
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $2746
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 76
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $2735
+byte 1 67
+byte 1 84
+byte 1 76
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 76
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $2732
+byte 1 67
+byte 1 84
+byte 1 76
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 76
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $2727
+byte 1 50
+byte 1 0
+align 1
+LABELV $2726
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $2725
+byte 1 49
+byte 1 0
+align 1
+LABELV $2724
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $2723
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $2722
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $2721
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $2720
+byte 1 48
+byte 1 0
+align 1
+LABELV $2719
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $2718
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $2635
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $2634
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 0
+align 1
+LABELV $2632
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 65
+byte 1 73
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2618
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 65
+byte 1 73
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2613
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 65
+byte 1 73
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 105
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $2600
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $2596
+byte 1 115
+byte 1 101
+byte 1 120
+byte 1 0
+align 1
+LABELV $2553
+byte 1 42
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 49
+byte 1 0
+align 1
+LABELV $2550
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 69
+byte 1 82
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $2541
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $2538
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $2412
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 73
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2411
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 73
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2407
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 111
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $2403
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 0
+align 1
+LABELV $2392
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $2391
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $2388
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2377
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 109
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 105
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2364
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $2358
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $2350
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $2339
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $2335
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2332
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $2297
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $2292
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $2287
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $2284
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $2281
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2280
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2268
+byte 1 42
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $2081
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $2058
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2055
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $2015
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 0
+align 1
+LABELV $2011
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $925
+byte 1 70
+byte 1 76
+byte 1 79
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $924
+byte 1 75
+byte 1 105
+byte 1 76
+byte 1 76
+byte 1 69
+byte 1 82
+byte 1 68
+byte 1 85
+byte 1 67
+byte 1 75
+byte 1 83
+byte 1 0
+align 1
+LABELV $923
+byte 1 80
+byte 1 65
+byte 1 68
+byte 1 80
+byte 1 79
+byte 1 87
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $922
+byte 1 67
+byte 1 76
+byte 1 105
+byte 1 77
+byte 1 66
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $921
+byte 1 83
+byte 1 80
+byte 1 69
+byte 1 69
+byte 1 68
+byte 1 89
+byte 1 0
+align 1
+LABELV $920
+byte 1 74
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $919
+byte 1 86
+byte 1 105
+byte 1 83
+byte 1 105
+byte 1 79
+byte 1 78
+byte 1 76
+byte 1 69
+byte 1 83
+byte 1 83
+byte 1 0
+align 1
+LABELV $918
+byte 1 82
+byte 1 69
+byte 1 86
+byte 1 105
+byte 1 86
+byte 1 65
+byte 1 76
+byte 1 0
+align 1
+LABELV $804
+byte 1 116
+byte 1 0
+align 1
+LABELV $567
+byte 1 93
+byte 1 0
+align 1
+LABELV $566
+byte 1 91
+byte 1 0
+align 1
+LABELV $565
+byte 1 32
+byte 1 0
+align 1
+LABELV $533
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $532
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $527
+byte 1 110
+byte 1 0
+align 1
+LABELV $526
+byte 1 91
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 93
+byte 1 0
+align 1
+LABELV $525
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $496
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 76
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $495
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 76
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $368
+byte 1 102
+byte 1 101
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $93
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
@@ -0,0 +1,16989 @@
+code
+proc ResetWaypoints 12 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 numwaypoints
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 waypoints
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTU4 16384
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 numbambamspots
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 bambamspots
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTU4 4096
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 numboomiespots
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 boomiespots
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTU4 4864
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+LABELV $68
+endproc ResetWaypoints 12 12
+lit
+align 4
+LABELV $70
+byte 4 1000
+export BotWpValid
+code
+proc BotWpValid 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8444
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $73
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8448
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $73
+ADDRGP4 level+68
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ADDRGP4 $70
+INDIRI4
+GEI4 $73
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $74
+JUMPV
+LABELV $73
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $74
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $69
+endproc BotWpValid 12 0
+proc FindNearestWP 28 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 -1
+ASGNI4
+ADDRLP4 8
+CNSTI4 2147483647
+ASGNI4
+ADDRGP4 numwaypoints
+INDIRI4
+CNSTI4 0
+NEI4 $76
+CNSTP4 0
+RETP4
+ADDRGP4 $75
+JUMPV
+LABELV $76
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $78
+CNSTP4 0
+RETP4
+ADDRGP4 $75
+JUMPV
+LABELV $78
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $83
+JUMPV
+LABELV $80
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LSHI4
+ADDRGP4 waypoints+72+12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $86
+ADDRGP4 $81
+JUMPV
+LABELV $86
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+GEI4 $88
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $88
+LABELV $81
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $83
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numwaypoints
+INDIRI4
+LTI4 $80
+ADDRLP4 8
+INDIRI4
+CNSTI4 2147483647
+NEI4 $90
+CNSTP4 0
+RETP4
+ADDRGP4 $75
+JUMPV
+LABELV $90
+ADDRLP4 12
+INDIRI4
+CNSTI4 8
+LSHI4
+ADDRGP4 waypoints
+ADDP4
+RETP4
+LABELV $75
+endproc FindNearestWP 28 16
+export FindWp
+proc FindWp 72 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRLP4 12
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 FindNearestWP
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $94
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 $95
+JUMPV
+LABELV $94
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 36
+INDIRI4
+ASGNI4
+LABELV $95
+ADDRLP4 20
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $96
+CNSTI4 0
+RETI4
+ADDRGP4 $92
+JUMPV
+LABELV $96
+ADDRFP4 0
+INDIRP4
+CNSTI4 8444
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $101
+JUMPV
+LABELV $98
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 24
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 84
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 64
+INDIRI4
+EQI4 $102
+ADDRLP4 12
+INDIRI4
+ADDRLP4 64
+INDIRI4
+EQI4 $102
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+GEI4 $102
+ADDRFP4 0
+INDIRP4
+CNSTI4 8444
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $100
+JUMPV
+LABELV $102
+LABELV $99
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $101
+ADDRLP4 16
+INDIRI4
+CNSTI4 24
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+INDIRI4
+LTI4 $98
+LABELV $100
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $104
+ADDRGP4 $107
+ARGP4
+ADDRLP4 40
+CNSTI4 128
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8444
+ADDP4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $104
+ADDRFP4 0
+INDIRP4
+CNSTI4 8448
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $92
+endproc FindWp 72 20
+export GetWpID
+proc GetWpID 0 0
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $110
+CNSTI4 0
+RETI4
+ADDRGP4 $109
+JUMPV
+LABELV $110
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 waypoints
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 256
+DIVI4
+RETI4
+LABELV $109
+endproc GetWpID 0 0
+export GetNextWp
+proc GetNextWp 40 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $114
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $115
+JUMPV
+LABELV $114
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+LABELV $115
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $116
+CNSTI4 0
+RETI4
+ADDRGP4 $112
+JUMPV
+LABELV $116
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 BotWpValid
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $118
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 FindWp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $120
+CNSTI4 0
+RETI4
+ADDRGP4 $112
+JUMPV
+LABELV $120
+LABELV $118
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8444
+ADDP4
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $122
+ADDRFP4 0
+INDIRP4
+CNSTI4 8444
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $124
+CNSTI4 0
+RETI4
+ADDRGP4 $112
+JUMPV
+LABELV $124
+ADDRLP4 28
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 8444
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 32
+INDIRP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+INDIRP4
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+CNSTI4 1
+RETI4
+ADDRGP4 $112
+JUMPV
+LABELV $122
+ADDRLP4 28
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 8444
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 36
+INDIRP4
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 36
+INDIRP4
+INDIRP4
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8448
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $112
+endproc GetNextWp 40 8
+export BotWpHasSuccessor
+proc BotWpHasSuccessor 28 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $129
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $130
+JUMPV
+LABELV $129
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $130
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $131
+CNSTI4 0
+RETI4
+ADDRGP4 $127
+JUMPV
+LABELV $131
+ADDRFP4 0
+INDIRP4
+CNSTI4 8444
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $133
+CNSTI4 0
+RETI4
+ADDRGP4 $127
+JUMPV
+LABELV $133
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 8444
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 20
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $138
+ADDRLP4 20
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $136
+LABELV $138
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $137
+JUMPV
+LABELV $136
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $137
+ADDRLP4 16
+INDIRI4
+RETI4
+LABELV $127
+endproc BotWpHasSuccessor 28 4
+proc ParseLink 300 12
+ADDRFP4 0
+ARGP4
+ADDRLP4 276
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 268
+ADDRLP4 276
+INDIRP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $140
+ADDRGP4 $142
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $139
+JUMPV
+LABELV $140
+ADDRLP4 12
+ARGP4
+ADDRLP4 268
+INDIRP4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 0
+ARGP4
+ADDRLP4 280
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 268
+ADDRLP4 280
+INDIRP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $143
+ADDRGP4 $145
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $139
+JUMPV
+LABELV $143
+ADDRLP4 140
+ARGP4
+ADDRLP4 268
+INDIRP4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 284
+CNSTI4 -1
+ASGNI4
+ADDRLP4 8
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $149
+JUMPV
+LABELV $146
+ADDRLP4 288
+CNSTI4 -1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 288
+INDIRI4
+EQI4 $150
+ADDRLP4 8
+INDIRI4
+ADDRLP4 288
+INDIRI4
+EQI4 $150
+ADDRGP4 $148
+JUMPV
+LABELV $150
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+NEI4 $152
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LSHI4
+ADDRGP4 waypoints+128
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 292
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+NEI4 $154
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $147
+JUMPV
+LABELV $154
+LABELV $152
+ADDRLP4 8
+INDIRI4
+CNSTI4 -1
+NEI4 $157
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LSHI4
+ADDRGP4 waypoints+128
+ADDP4
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRLP4 292
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+NEI4 $159
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $159
+LABELV $157
+LABELV $147
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $149
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numwaypoints
+INDIRI4
+LTI4 $146
+LABELV $148
+ADDRLP4 288
+CNSTI4 -1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 288
+INDIRI4
+EQI4 $164
+ADDRLP4 8
+INDIRI4
+ADDRLP4 288
+INDIRI4
+NEI4 $162
+LABELV $164
+ADDRGP4 $165
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $139
+JUMPV
+LABELV $162
+ADDRLP4 272
+CNSTI4 24
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+LSHI4
+ADDRGP4 waypoints
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 272
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 5
+LTI4 $166
+ADDRGP4 $168
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $139
+JUMPV
+LABELV $166
+ADDRLP4 296
+ADDRLP4 272
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 292
+ADDRLP4 296
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 296
+INDIRP4
+ADDRLP4 292
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 272
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 8
+LSHI4
+ADDRGP4 waypoints
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $139
+endproc ParseLink 300 12
+proc ParseBambam 60 16
+ADDRFP4 0
+ARGP4
+ADDRLP4 28
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $170
+ADDRGP4 $172
+ARGP4
+ADDRGP4 numbambamspots
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $169
+JUMPV
+LABELV $170
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 114
+NEI4 $173
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $174
+JUMPV
+LABELV $173
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 98
+NEI4 $175
+ADDRLP4 24
+CNSTI4 2
+ASGNI4
+ADDRGP4 $176
+JUMPV
+LABELV $175
+ADDRGP4 $177
+ARGP4
+ADDRGP4 numbambamspots
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $169
+JUMPV
+LABELV $176
+LABELV $174
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $178
+ADDRFP4 0
+ARGP4
+ADDRLP4 32
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $182
+ADDRGP4 $184
+ARGP4
+ADDRGP4 numbambamspots
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $169
+JUMPV
+LABELV $182
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 36
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $179
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $178
+ADDRGP4 numbambamspots
+INDIRI4
+CNSTI4 64
+LTI4 $185
+ADDRGP4 $187
+ARGP4
+ADDRGP4 numbambamspots
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $169
+JUMPV
+LABELV $185
+ADDRLP4 36
+ADDRGP4 numbambamspots
+ASGNP4
+ADDRLP4 32
+ADDRLP4 36
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 32
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 bambamspots
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 12
+ADDRLP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 trap_AAS_BestReachableArea
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $190
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $188
+LABELV $190
+ADDRGP4 $191
+ARGP4
+ADDRGP4 numbambamspots
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRLP4 56
+ADDRGP4 numbambamspots
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $188
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $169
+endproc ParseBambam 60 16
+proc ParseBoomie 72 16
+ADDRFP4 0
+ARGP4
+ADDRLP4 40
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $193
+ADDRGP4 $195
+ARGP4
+ADDRGP4 numboomiespots
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $192
+JUMPV
+LABELV $193
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 114
+NEI4 $196
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRGP4 $197
+JUMPV
+LABELV $196
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 98
+NEI4 $198
+ADDRLP4 36
+CNSTI4 2
+ASGNI4
+ADDRGP4 $199
+JUMPV
+LABELV $198
+ADDRGP4 $200
+ARGP4
+ADDRGP4 numboomiespots
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $192
+JUMPV
+LABELV $199
+LABELV $197
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $201
+ADDRFP4 0
+ARGP4
+ADDRLP4 44
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $205
+ADDRGP4 $207
+ARGP4
+ADDRGP4 numboomiespots
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $192
+JUMPV
+LABELV $205
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 24
+ADDP4
+ADDRLP4 48
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $202
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $201
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $208
+ADDRFP4 0
+ARGP4
+ADDRLP4 44
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $212
+ADDRGP4 $214
+ARGP4
+ADDRGP4 numboomiespots
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $192
+JUMPV
+LABELV $212
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 48
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $209
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $208
+ADDRLP4 12+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 numboomiespots
+INDIRI4
+CNSTI4 64
+LTI4 $216
+ADDRGP4 $218
+ARGP4
+ADDRGP4 numboomiespots
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $192
+JUMPV
+LABELV $216
+ADDRLP4 48
+ADDRGP4 numboomiespots
+ASGNP4
+ADDRLP4 44
+ADDRLP4 48
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 76
+ADDRLP4 44
+INDIRI4
+MULI4
+ADDRGP4 boomiespots
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 12
+INDIRB
+ASGNB 12
+ADDRLP4 8
+INDIRP4
+ADDRLP4 24
+INDIRB
+ASGNB 12
+ADDRLP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 trap_AAS_BestReachableArea
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $221
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $219
+LABELV $221
+ADDRGP4 $222
+ARGP4
+ADDRGP4 numboomiespots
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRLP4 68
+ADDRGP4 numboomiespots
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $219
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $192
+endproc ParseBoomie 72 16
+proc ParseWaypointFile 60 16
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 ResetWaypoints
+CALLV
+pop
+ADDRGP4 $225
+JUMPV
+LABELV $224
+ADDRFP4 0
+ARGP4
+ADDRLP4 16
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $227
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $226
+JUMPV
+LABELV $227
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $231
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $229
+ADDRGP4 numwaypoints
+INDIRI4
+CNSTI4 64
+LTI4 $232
+ADDRGP4 $234
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $226
+JUMPV
+LABELV $232
+ADDRLP4 28
+ADDRGP4 numwaypoints
+ASGNP4
+ADDRLP4 24
+ADDRLP4 28
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 24
+INDIRI4
+CNSTI4 8
+LSHI4
+ADDRGP4 waypoints
+ADDP4
+ASGNP4
+ADDRFP4 0
+ARGP4
+ADDRLP4 32
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $235
+ADDRGP4 $237
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $226
+JUMPV
+LABELV $235
+ADDRLP4 36
+CNSTI4 128
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $238
+ADDRFP4 0
+ARGP4
+ADDRLP4 40
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $242
+ADDRGP4 $240
+JUMPV
+LABELV $242
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDP4
+ADDRLP4 44
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $239
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $238
+LABELV $240
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+GEI4 $244
+ADDRGP4 $246
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 128
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $226
+JUMPV
+LABELV $244
+ADDRLP4 8
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 44
+ADDRLP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 88
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 100
+ADDP4
+ARGP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_AAS_BestReachableArea
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 8
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $249
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $230
+LABELV $249
+ADDRGP4 $250
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 128
+ADDP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $230
+JUMPV
+LABELV $229
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $253
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $251
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 ParseBambam
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $252
+ADDRGP4 $226
+JUMPV
+LABELV $251
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $258
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $256
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 ParseBoomie
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $257
+ADDRGP4 $226
+JUMPV
+LABELV $256
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $263
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $261
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 36
+ADDRGP4 ParseLink
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $262
+ADDRGP4 $226
+JUMPV
+LABELV $261
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $268
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $266
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 40
+ADDRGP4 ParseLink
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $267
+ADDRGP4 $226
+JUMPV
+LABELV $266
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $273
+ARGP4
+ADDRLP4 40
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $271
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 44
+ADDRGP4 ParseLink
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $272
+ADDRGP4 $226
+JUMPV
+LABELV $271
+ADDRGP4 $276
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $272
+LABELV $267
+LABELV $262
+LABELV $257
+LABELV $252
+LABELV $230
+LABELV $225
+ADDRGP4 $224
+JUMPV
+LABELV $226
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $277
+ADDRGP4 numwaypoints
+CNSTI4 0
+ASGNI4
+ADDRGP4 $279
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $278
+JUMPV
+LABELV $277
+ADDRGP4 $280
+ARGP4
+ADDRGP4 numwaypoints
+INDIRI4
+ARGI4
+ADDRGP4 numbambamspots
+INDIRI4
+ARGI4
+ADDRGP4 numboomiespots
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $278
+LABELV $223
+endproc ParseWaypointFile 60 16
+proc ReadWaypointFile 9364 16
+ADDRLP4 8328
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetServerinfo
+CALLV
+pop
+ADDRLP4 8328
+ARGP4
+ADDRGP4 $282
+ARGP4
+ADDRLP4 9352
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 8264
+ARGP4
+ADDRLP4 9352
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $283
+ARGP4
+ADDRLP4 8264
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 9356
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 9356
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $284
+ADDRGP4 $286
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 9360
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 9360
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRGP4 $281
+JUMPV
+LABELV $284
+ADDRLP4 0
+INDIRI4
+CNSTI4 8192
+LTI4 $287
+ADDRGP4 $289
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 8192
+ARGI4
+ADDRLP4 9360
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 9360
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 $281
+JUMPV
+LABELV $287
+ADDRLP4 72
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ADDRLP4 72
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 72
+ARGP4
+ADDRGP4 ParseWaypointFile
+CALLV
+pop
+LABELV $281
+endproc ReadWaypointFile 9364 16
+export WaypointInit
+proc WaypointInit 0 0
+ADDRGP4 ReadWaypointFile
+CALLV
+pop
+LABELV $290
+endproc WaypointInit 0 0
+export AI_AddBoomie
+proc AI_AddBoomie 16 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $294
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $292
+LABELV $294
+ADDRGP4 $291
+JUMPV
+LABELV $292
+ADDRLP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 21
+EQI4 $295
+ADDRGP4 $291
+JUMPV
+LABELV $295
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 6304
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $299
+ADDRLP4 12
+INDIRI4
+ADDRGP4 numboomiespots
+INDIRI4
+LTI4 $297
+LABELV $299
+ADDRGP4 $291
+JUMPV
+LABELV $297
+CNSTI4 76
+ADDRLP4 0
+INDIRP4
+CNSTI4 6304
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 boomiespots+72
+ADDP4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $291
+endproc AI_AddBoomie 16 0
+export AI_RemoveBoomie
+proc AI_RemoveBoomie 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $305
+JUMPV
+LABELV $302
+CNSTI4 76
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 boomiespots+72
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+NEU4 $306
+CNSTI4 76
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 boomiespots+72
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 $301
+JUMPV
+LABELV $306
+LABELV $303
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $305
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numboomiespots
+INDIRI4
+LTI4 $302
+LABELV $301
+endproc AI_RemoveBoomie 4 0
+export AI_AddBambam
+proc AI_AddBambam 16 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $313
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $311
+LABELV $313
+ADDRGP4 $310
+JUMPV
+LABELV $311
+ADDRLP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 22
+EQI4 $314
+ADDRGP4 $310
+JUMPV
+LABELV $314
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 6304
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $318
+ADDRLP4 12
+INDIRI4
+ADDRGP4 numbambamspots
+INDIRI4
+LTI4 $316
+LABELV $318
+ADDRGP4 $310
+JUMPV
+LABELV $316
+ADDRLP4 0
+INDIRP4
+CNSTI4 6304
+ADDP4
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 bambamspots+60
+ADDP4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $310
+endproc AI_AddBambam 16 0
+export AI_RemoveBambam
+proc AI_RemoveBambam 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $324
+JUMPV
+LABELV $321
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 bambamspots+60
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+NEU4 $325
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 bambamspots+60
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 $320
+JUMPV
+LABELV $325
+LABELV $322
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $324
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numbambamspots
+INDIRI4
+LTI4 $321
+LABELV $320
+endproc AI_RemoveBambam 4 0
+export BotAddInfo
+proc BotAddInfo 0 8
+ADDRGP4 bot_developer+12
+INDIRI4
+ADDRFP4 8
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $330
+ADDRFP4 0
+INDIRP4
+CNSTI4 9956
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 StringDump_Push
+CALLV
+pop
+LABELV $330
+LABELV $329
+endproc BotAddInfo 0 8
+export BotAI_Print
+proc BotAI_Print 2056 16
+ADDRLP4 0
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 2048
+ARGU4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 2052
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 2052
+INDIRI4
+CNSTI4 1
+LTI4 $335
+ADDRLP4 2052
+INDIRI4
+CNSTI4 5
+GTI4 $335
+ADDRLP4 2052
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $348-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $348
+address $337
+address $339
+address $341
+address $343
+address $345
+code
+LABELV $337
+ADDRGP4 $338
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $336
+JUMPV
+LABELV $339
+ADDRGP4 $340
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $336
+JUMPV
+LABELV $341
+ADDRGP4 $342
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $336
+JUMPV
+LABELV $343
+ADDRGP4 $344
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $336
+JUMPV
+LABELV $345
+ADDRGP4 $346
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+ADDRGP4 $336
+JUMPV
+LABELV $335
+ADDRGP4 $347
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $336
+LABELV $333
+endproc BotAI_Print 2056 16
+proc BotAI_CopyTrace 28 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+CNSTI4 12
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 12
+CNSTI4 36
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+CNSTI4 24
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 20
+CNSTI4 41
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 24
+CNSTI4 40
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRU1
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $350
+endproc BotAI_CopyTrace 28 0
+export BotAI_Trace
+proc BotAI_Trace 56 28
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotAI_CopyTrace
+CALLV
+pop
+LABELV $351
+endproc BotAI_Trace 56 28
+export BotAI_VisTrace
+proc BotAI_VisTrace 36 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 visTraces
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $358
+ADDRFP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $358
+ADDRLP4 16
+CNSTI4 64
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+GEI4 $358
+ADDRFP4 8
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $358
+ADDRFP4 8
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $353
+LABELV $358
+CNSTI4 0
+RETI4
+ADDRGP4 $352
+JUMPV
+LABELV $353
+ADDRLP4 4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 visTraces+8
+ADDP4
+ADDP4
+INDIRI2
+CVII4 2
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $360
+CNSTI4 0
+RETI4
+ADDRGP4 $352
+JUMPV
+LABELV $360
+ADDRLP4 0
+CNSTI4 60
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 visTraces+8200-60
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ADDRFP4 20
+INDIRI4
+NEI4 $368
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+ADDRFP4 24
+INDIRI4
+NEI4 $368
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $368
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $364
+LABELV $368
+CNSTI4 0
+RETI4
+ADDRGP4 $352
+JUMPV
+LABELV $364
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 56
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 visTraces+69640-56
+ADDP4
+ARGP4
+ADDRGP4 BotAI_CopyTrace
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $352
+endproc BotAI_VisTrace 36 8
+export BotAI_SharedVisibility
+proc BotAI_SharedVisibility 28 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $376
+ADDRLP4 12
+CNSTI4 64
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+GEI4 $376
+ADDRFP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $376
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $372
+LABELV $376
+CNSTI4 0
+RETI4
+ADDRGP4 $371
+JUMPV
+LABELV $372
+ADDRLP4 0
+CNSTI4 20
+ADDRFP4 4
+INDIRI4
+MULI4
+CNSTI4 1280
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 visMatrix
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 visFrame
+INDIRI4
+NEI4 $379
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $377
+LABELV $379
+CNSTI4 0
+RETI4
+ADDRGP4 $371
+JUMPV
+LABELV $377
+ADDRFP4 12
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $371
+endproc BotAI_SharedVisibility 28 8
+export BotAI_ShareVisibility
+proc BotAI_ShareVisibility 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $385
+ADDRLP4 12
+CNSTI4 64
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+GEI4 $385
+ADDRFP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $385
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $381
+LABELV $385
+ADDRGP4 $380
+JUMPV
+LABELV $381
+ADDRLP4 0
+CNSTI4 20
+ADDRFP4 4
+INDIRI4
+MULI4
+CNSTI4 1280
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 visMatrix
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 visFrame
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 12
+INDIRF4
+ASGNF4
+LABELV $380
+endproc BotAI_ShareVisibility 20 0
+proc BotBatchVisTraces 720 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 624
+CNSTI4 0
+ASGNI4
+ADDRGP4 visTraces
+ADDRLP4 624
+INDIRI4
+ASGNI4
+ADDRGP4 visTraces+4
+ADDRLP4 624
+INDIRI4
+ASGNI4
+ADDRGP4 $390
+ARGP4
+ADDRLP4 628
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 628
+INDIRI4
+CNSTI4 1
+GTI4 $388
+ADDRGP4 $386
+JUMPV
+LABELV $388
+ADDRGP4 visTraces+8
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 8192
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+LABELV $393
+ADDRLP4 632
+ADDRLP4 152
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 632
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $399
+ADDRLP4 632
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $397
+LABELV $399
+ADDRGP4 $394
+JUMPV
+LABELV $397
+ADDRLP4 152
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+ADDRFP4 4
+INDIRI4
+GEI4 $400
+ADDRGP4 $394
+JUMPV
+LABELV $400
+CNSTI4 832
+ADDRLP4 152
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $405
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 156
+ARGP4
+ADDRLP4 640
+ADDRGP4 BotAI_GetClientState
+CALLI4
+ASGNI4
+ADDRLP4 640
+INDIRI4
+CNSTI4 0
+NEI4 $402
+LABELV $405
+ADDRGP4 $394
+JUMPV
+LABELV $402
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+ADDRGP4 $409
+JUMPV
+LABELV $406
+ADDRLP4 148
+CNSTI4 832
+ADDRLP4 144
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 144
+INDIRI4
+ADDRLP4 152
+INDIRI4
+EQI4 $414
+ADDRLP4 148
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $414
+ADDRLP4 148
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $411
+LABELV $414
+ADDRGP4 $407
+JUMPV
+LABELV $411
+ADDRLP4 648
+ADDRLP4 148
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 648
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $417
+ADDRLP4 648
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $415
+LABELV $417
+ADDRGP4 $407
+JUMPV
+LABELV $415
+CNSTI4 832
+ADDRLP4 152
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 652
+ADDRGP4 OnSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 652
+INDIRI4
+CNSTI4 0
+EQI4 $418
+ADDRGP4 $407
+JUMPV
+LABELV $418
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $420
+ADDRGP4 $407
+JUMPV
+LABELV $420
+ADDRGP4 visTraces+4
+INDIRI4
+CNSTI4 1024
+LTI4 $422
+ADDRGP4 $408
+JUMPV
+LABELV $422
+ADDRLP4 0
+CNSTI4 60
+ADDRGP4 visTraces+4
+INDIRI4
+MULI4
+ADDRGP4 visTraces+8200
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 156+20
+INDIRB
+ASGNB 12
+ADDRLP4 656
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 656
+INDIRP4
+ADDRLP4 656
+INDIRP4
+INDIRF4
+ADDRLP4 156+164
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 4+72
+INDIRF4
+ADDRLP4 4+84
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 4+72+4
+INDIRF4
+ADDRLP4 4+84+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 4+72+8
+INDIRF4
+ADDRLP4 4+84+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 660
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 660
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 660
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 664
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 664
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 664
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 668
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 668
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 668
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 672
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 672
+INDIRP4
+ADDRLP4 4+24
+INDIRF4
+ADDRLP4 672
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 676
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 676
+INDIRP4
+ADDRLP4 4+24+4
+INDIRF4
+ADDRLP4 676
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 680
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 680
+INDIRP4
+ADDRLP4 4+24+8
+INDIRF4
+ADDRLP4 680
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 688
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 688
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 688
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 688
+INDIRF4
+ASGNF4
+ADDRLP4 696
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 696
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 696
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 696
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 65537
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRLP4 704
+ADDRGP4 trap_InPVSIgnorePortals
+CALLI4
+ASGNI4
+ADDRLP4 704
+INDIRI4
+CNSTI4 0
+NEI4 $444
+ADDRGP4 $407
+JUMPV
+LABELV $444
+ADDRLP4 708
+ADDRGP4 visTraces+4
+ASGNP4
+ADDRLP4 712
+CNSTI4 1
+ASGNI4
+ADDRLP4 716
+ADDRLP4 708
+INDIRP4
+INDIRI4
+ADDRLP4 712
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 708
+INDIRP4
+ADDRLP4 716
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+ADDRLP4 712
+INDIRI4
+LSHI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 visTraces+8
+ADDP4
+ADDP4
+ADDRLP4 716
+INDIRI4
+CVII2 4
+ASGNI2
+LABELV $407
+ADDRLP4 144
+ADDRLP4 144
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $409
+ADDRLP4 144
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $406
+LABELV $408
+LABELV $394
+ADDRLP4 152
+ADDRLP4 152
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 64
+LTI4 $393
+ADDRGP4 visTraces+4
+INDIRI4
+CNSTI4 0
+EQI4 $448
+ADDRGP4 visTraces+69640
+ARGP4
+ADDRGP4 visTraces+8200
+ARGP4
+ADDRGP4 visTraces+4
+INDIRI4
+ARGI4
+ADDRGP4 trap_TraceBatch
+CALLV
+pop
+ADDRGP4 visTraces
+CNSTI4 1
+ASGNI4
+LABELV $448
+LABELV $386
+endproc BotBatchVisTraces 720 12
+export BotAI_GetClientState
+proc BotAI_GetClientState 4 12
+ADDRLP4 0
+CNSTI4 832
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $455
+CNSTI4 0
+RETI4
+ADDRGP4 $454
+JUMPV
+LABELV $455
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $457
+CNSTI4 0
+RETI4
+ADDRGP4 $454
+JUMPV
+LABELV $457
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ARGP4
+CNSTU4 468
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+LABELV $454
+endproc BotAI_GetClientState 4 12
+export BotAI_GetEntityState
+proc BotAI_GetEntityState 4 12
+ADDRLP4 0
+CNSTI4 832
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 208
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $460
+CNSTI4 0
+RETI4
+ADDRGP4 $459
+JUMPV
+LABELV $460
+ADDRLP4 0
+INDIRP4
+CNSTI4 416
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $462
+CNSTI4 0
+RETI4
+ADDRGP4 $459
+JUMPV
+LABELV $462
+ADDRLP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $464
+CNSTI4 0
+RETI4
+ADDRGP4 $459
+JUMPV
+LABELV $464
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTU4 208
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+LABELV $459
+endproc BotAI_GetEntityState 4 12
+export BotAI_GetSnapshotEntity
+proc BotAI_GetSnapshotEntity 8 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_BotGetSnapshotEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $467
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 208
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTI4 -1
+RETI4
+ADDRGP4 $466
+JUMPV
+LABELV $467
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_GetEntityState
+CALLI4
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+RETI4
+LABELV $466
+endproc BotAI_GetSnapshotEntity 8 12
+export BotAI_BotInitialChat
+proc BotAI_BotInitialChat 56 44
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 32
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 40
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 40
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 48
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $471
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $475
+ADDRGP4 $473
+JUMPV
+LABELV $475
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 52
+ADDRLP4 40
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 52
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $472
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $471
+LABELV $473
+ADDRLP4 40
+CNSTP4 0
+ASGNP4
+ADDRLP4 44
+CNSTI4 1027
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8+4
+INDIRP4
+ARGP4
+ADDRLP4 8+8
+INDIRP4
+ARGP4
+ADDRLP4 8+12
+INDIRP4
+ARGP4
+ADDRLP4 8+16
+INDIRP4
+ARGP4
+ADDRLP4 8+20
+INDIRP4
+ARGP4
+ADDRLP4 8+24
+INDIRP4
+ARGP4
+ADDRLP4 8+28
+INDIRP4
+ARGP4
+ADDRGP4 trap_BotInitialChat
+CALLV
+pop
+LABELV $469
+endproc BotAI_BotInitialChat 56 44
+export BotTestAAS
+proc BotTestAAS 68 12
+ADDRGP4 bot_testsolid
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_testclusters
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_testsolid+12
+INDIRI4
+CNSTI4 0
+EQI4 $485
+ADDRLP4 56
+ADDRGP4 trap_AAS_Initialized
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $488
+ADDRGP4 $484
+JUMPV
+LABELV $488
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $490
+CNSTI4 1
+ARGI4
+ADDRGP4 $492
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $486
+JUMPV
+LABELV $490
+CNSTI4 1
+ARGI4
+ADDRGP4 $493
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $486
+JUMPV
+LABELV $485
+ADDRGP4 bot_testclusters+12
+INDIRI4
+CNSTI4 0
+EQI4 $494
+ADDRLP4 56
+ADDRGP4 trap_AAS_Initialized
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $497
+ADDRGP4 $484
+JUMPV
+LABELV $497
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $499
+CNSTI4 1
+ARGI4
+ADDRGP4 $501
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $500
+JUMPV
+LABELV $499
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_AAS_AreaInfo
+CALLI4
+pop
+ADDRGP4 $502
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4+12
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $500
+LABELV $494
+LABELV $486
+LABELV $484
+endproc BotTestAAS 68 12
+export BotAddInfoLtg
+proc BotAddInfoLtg 148 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $505
+ADDRLP4 0
+INDIRI4
+CNSTI4 22
+GTI4 $505
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $553
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $553
+address $508
+address $505
+address $512
+address $526
+address $518
+address $514
+address $505
+address $534
+address $505
+address $505
+address $540
+address $505
+address $505
+address $520
+address $542
+address $505
+address $538
+address $536
+address $548
+address $516
+address $550
+address $546
+address $544
+code
+LABELV $508
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $506
+ADDRLP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRGP4 $511
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 144
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+CNSTI4 32767
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+ADDRGP4 $506
+JUMPV
+LABELV $512
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $513
+ARGP4
+CNSTI4 32767
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+ADDRGP4 $506
+JUMPV
+LABELV $514
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $515
+ARGP4
+CNSTI4 32767
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+ADDRGP4 $506
+JUMPV
+LABELV $516
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $517
+ARGP4
+CNSTI4 32767
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+ADDRGP4 $506
+JUMPV
+LABELV $518
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $519
+ARGP4
+CNSTI4 32767
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+ADDRGP4 $506
+JUMPV
+LABELV $520
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 8
+NEI4 $521
+ADDRGP4 $523
+ARGP4
+CNSTI4 832
+ADDRFP4 0
+INDIRP4
+CNSTI4 6352
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+640
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 32767
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+ADDRGP4 $506
+JUMPV
+LABELV $521
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $525
+ARGP4
+CNSTI4 32767
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+ADDRGP4 $506
+JUMPV
+LABELV $526
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 8
+NEI4 $527
+ADDRGP4 $529
+ARGP4
+CNSTI4 832
+ADDRFP4 0
+INDIRP4
+CNSTI4 6352
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+640
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 32767
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+ADDRGP4 $506
+JUMPV
+LABELV $527
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $506
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $533
+ARGP4
+CNSTI4 32767
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+ADDRGP4 $506
+JUMPV
+LABELV $534
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $535
+ARGP4
+CNSTI4 32767
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+ADDRGP4 $506
+JUMPV
+LABELV $536
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $537
+ARGP4
+CNSTI4 32767
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+ADDRGP4 $506
+JUMPV
+LABELV $538
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $539
+ARGP4
+CNSTI4 32767
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+ADDRGP4 $506
+JUMPV
+LABELV $540
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $541
+ARGP4
+CNSTI4 32767
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+ADDRGP4 $506
+JUMPV
+LABELV $542
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $543
+ARGP4
+CNSTI4 32767
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+ADDRGP4 $506
+JUMPV
+LABELV $544
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $545
+ARGP4
+CNSTI4 32767
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+ADDRGP4 $506
+JUMPV
+LABELV $546
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $547
+ARGP4
+CNSTI4 32767
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+ADDRGP4 $506
+JUMPV
+LABELV $548
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRGP4 $549
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 144
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+CNSTI4 32767
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+ADDRGP4 $506
+JUMPV
+LABELV $550
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $551
+ARGP4
+CNSTI4 32767
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+ADDRGP4 $506
+JUMPV
+LABELV $505
+ADDRGP4 $552
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 32767
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+LABELV $506
+LABELV $504
+endproc BotAddInfoLtg 148 12
+proc BotAddInfoNode 260 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 AINode_Seek_NBG
+CVPU4 4
+NEU4 $555
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $557
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $556
+JUMPV
+LABELV $555
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 AINode_Seek_LTG
+CVPU4 4
+NEU4 $558
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $560
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $559
+JUMPV
+LABELV $558
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 AINode_Battle_Fight
+CVPU4 4
+NEU4 $561
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $563
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $562
+JUMPV
+LABELV $561
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 AINode_Battle_Chase
+CVPU4 4
+NEU4 $564
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $566
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $565
+JUMPV
+LABELV $564
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 AINode_Battle_Retreat
+CVPU4 4
+NEU4 $567
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $569
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $568
+JUMPV
+LABELV $567
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 AINode_Battle_NBG
+CVPU4 4
+NEU4 $570
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $572
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $571
+JUMPV
+LABELV $570
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $573
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $571
+LABELV $568
+LABELV $565
+LABELV $562
+LABELV $559
+LABELV $556
+ADDRGP4 $574
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 256
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRP4
+ARGP4
+CNSTI4 32767
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+LABELV $554
+endproc BotAddInfoNode 260 12
+proc BotSetInfoConfigString 2108 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAddInfoNode
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6300
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $576
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2048
+ARGP4
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+pop
+ADDRLP4 2048+44
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRLP4 1024
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $579
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $580
+ARGP4
+ADDRLP4 1024
+ARGP4
+ADDRLP4 2104
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2104
+INDIRP4
+ARGP4
+CNSTI4 32767
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+ADDRGP4 $577
+JUMPV
+LABELV $576
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAddInfoLtg
+CALLV
+pop
+LABELV $577
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $581
+ADDRGP4 $582
+JUMPV
+LABELV $581
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+CNSTI4 64
+GEI4 $583
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRGP4 $585
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+ADDRGP4 $584
+JUMPV
+LABELV $583
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 IsDuck
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $586
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $588
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+ADDRGP4 $587
+JUMPV
+LABELV $586
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 IsWall
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $589
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $591
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+ADDRGP4 $590
+JUMPV
+LABELV $589
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 IsBoomie
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $592
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $594
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+ADDRGP4 $593
+JUMPV
+LABELV $592
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 IsBambam
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $595
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $597
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 BotAddInfo
+CALLV
+pop
+LABELV $595
+LABELV $593
+LABELV $590
+LABELV $587
+LABELV $584
+LABELV $582
+LABELV $575
+endproc BotSetInfoConfigString 2108 16
+proc BotInterbreedBots 288 20
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $599
+ADDRLP4 272
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 272
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $603
+ADDRLP4 272
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $603
+ADDRLP4 276
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 280
+ADDRLP4 276
+INDIRI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 276
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 280
+INDIRP4
+CNSTI4 6032
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 280
+INDIRP4
+CNSTI4 6028
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $604
+JUMPV
+LABELV $603
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+LABELV $604
+LABELV $600
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $599
+CNSTI4 64
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRLP4 268
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRLP4 272
+ADDRGP4 trap_GeneticParentsAndChildSelection
+CALLI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+EQI4 $605
+ADDRLP4 276
+CNSTI4 2
+ASGNI4
+ADDRLP4 280
+ADDRGP4 botstates
+ASGNP4
+ADDRLP4 284
+CNSTI4 6228
+ASGNI4
+ADDRLP4 264
+INDIRI4
+ADDRLP4 276
+INDIRI4
+LSHI4
+ADDRLP4 280
+INDIRP4
+ADDP4
+INDIRP4
+ADDRLP4 284
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 268
+INDIRI4
+ADDRLP4 276
+INDIRI4
+LSHI4
+ADDRLP4 280
+INDIRP4
+ADDP4
+INDIRP4
+ADDRLP4 284
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 276
+INDIRI4
+LSHI4
+ADDRLP4 280
+INDIRP4
+ADDP4
+INDIRP4
+ADDRLP4 284
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotInterbreedGoalFuzzyLogic
+CALLV
+pop
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_BotMutateGoalFuzzyLogic
+CALLV
+pop
+LABELV $605
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $607
+ADDRLP4 276
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 276
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $611
+ADDRLP4 276
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $611
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 6032
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 6028
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $611
+LABELV $608
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $607
+LABELV $598
+endproc BotInterbreedBots 288 20
+proc BotWriteInterbreeded 24 8
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $614
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $618
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $618
+ADDRLP4 20
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+CNSTI4 6032
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 6028
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $619
+JUMPV
+LABELV $618
+ADDRLP4 4
+CNSTF4 3212836864
+ASGNF4
+LABELV $619
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $620
+ADDRLP4 8
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $620
+LABELV $615
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $614
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $622
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_BotSaveGoalFuzzyLogic
+CALLV
+pop
+LABELV $622
+LABELV $613
+endproc BotWriteInterbreeded 24 8
+export BotInterbreedEndMatch
+proc BotInterbreedEndMatch 8 8
+ADDRGP4 bot_interbreed
+INDIRI4
+CNSTI4 0
+NEI4 $625
+ADDRGP4 $624
+JUMPV
+LABELV $625
+ADDRLP4 0
+ADDRGP4 bot_interbreedmatchcount
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 bot_interbreedcycle+12
+INDIRI4
+LTI4 $627
+ADDRGP4 bot_interbreedmatchcount
+CNSTI4 0
+ASGNI4
+ADDRGP4 bot_interbreedwrite
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_interbreedwrite+16
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRU4
+CNSTU4 0
+EQU4 $630
+ADDRGP4 bot_interbreedwrite+16
+ARGP4
+ADDRGP4 BotWriteInterbreeded
+CALLV
+pop
+ADDRGP4 $634
+ARGP4
+ADDRGP4 $635
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $630
+ADDRGP4 BotInterbreedBots
+CALLV
+pop
+LABELV $627
+LABELV $624
+endproc BotInterbreedEndMatch 8 8
+proc BotInterbreeding 16 20
+ADDRGP4 bot_interbreedchar
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_interbreedchar+16
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRU4
+CNSTU4 0
+NEU4 $637
+ADDRGP4 $636
+JUMPV
+LABELV $637
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+EQI4 $640
+ADDRGP4 $643
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $642
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 ExitLevel
+CALLV
+pop
+ADDRGP4 $636
+JUMPV
+LABELV $640
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $644
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $648
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $648
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotAIShutdownClient
+CALLI4
+pop
+LABELV $648
+LABELV $645
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $644
+ADDRGP4 $650
+ARGP4
+ADDRGP4 $651
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $655
+JUMPV
+LABELV $652
+ADDRGP4 $657
+ARGP4
+ADDRGP4 bot_interbreedchar+16
+ARGP4
+CNSTI4 50
+ADDRLP4 0
+INDIRI4
+MULI4
+ARGI4
+ADDRGP4 bot_interbreedchar+16
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $653
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $655
+ADDRLP4 0
+INDIRI4
+ADDRGP4 bot_interbreedbots+12
+INDIRI4
+LTI4 $652
+ADDRGP4 $660
+ARGP4
+ADDRGP4 $635
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 bot_interbreed
+CNSTI4 1
+ASGNI4
+LABELV $636
+endproc BotInterbreeding 16 20
+export BotEntityInfo
+proc BotEntityInfo 4 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $664
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $662
+LABELV $664
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $663
+CNSTI4 3
+ARGI4
+ADDRGP4 $668
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $663
+JUMPV
+LABELV $662
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_AAS_EntityInfo
+CALLV
+pop
+LABELV $663
+LABELV $661
+endproc BotEntityInfo 4 12
+export AngleDifference
+proc AngleDifference 12 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $670
+ADDRLP4 0
+INDIRF4
+CNSTF4 1127481344
+LEF4 $671
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+ADDRGP4 $671
+JUMPV
+LABELV $670
+ADDRLP4 0
+INDIRF4
+CNSTF4 3274964992
+GEF4 $674
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $674
+LABELV $671
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $669
+endproc AngleDifference 12 0
+export BotChangeViewAngle
+proc BotChangeViewAngle 24 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRFP4 4
+INDIRF4
+NEF4 $677
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $676
+JUMPV
+LABELV $677
+ADDRLP4 0
+ADDRFP4 4
+INDIRF4
+ADDRFP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 0
+INDIRF4
+LEF4 $679
+ADDRLP4 0
+INDIRF4
+CNSTF4 1127481344
+LEF4 $680
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+ADDRGP4 $680
+JUMPV
+LABELV $679
+ADDRLP4 0
+INDIRF4
+CNSTF4 3274964992
+GEF4 $683
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $683
+LABELV $680
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LEF4 $685
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+LEF4 $686
+ADDRLP4 0
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 $686
+JUMPV
+LABELV $685
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+NEGF4
+GEF4 $689
+ADDRLP4 0
+ADDRFP4 8
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $689
+LABELV $686
+ADDRFP4 0
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+RETF4
+LABELV $676
+endproc BotChangeViewAngle 24 4
+export BotChangeViewAngles
+proc BotChangeViewAngles 80 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+INDIRF4
+CNSTF4 1127481344
+LEF4 $692
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $692
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $694
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+CNSTF4 1008981770
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 28
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+CNSTF4 1065353216
+ARGF4
+CNSTF4 1155596288
+ARGF4
+ADDRLP4 32
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRGP4 $695
+JUMPV
+LABELV $694
+ADDRLP4 16
+CNSTF4 1028443341
+ASGNF4
+ADDRLP4 8
+CNSTF4 1135869952
+ASGNF4
+LABELV $695
+ADDRLP4 8
+INDIRF4
+CNSTF4 1131413504
+GEF4 $696
+ADDRLP4 8
+CNSTF4 1131413504
+ASGNF4
+LABELV $696
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $698
+ADDRGP4 bot_challenge+12
+INDIRI4
+CNSTI4 0
+EQI4 $702
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 AngleDifference
+CALLF4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $705
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $705
+ADDRLP4 44
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 44
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 56
+ADDRGP4 BotChangeViewAngle
+CALLF4
+ASGNF4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRGP4 $703
+JUMPV
+LABELV $702
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6276
+ADDP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 AngleDifference
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 12
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6288
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 60
+ADDRLP4 56
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6288
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1127481344
+LEF4 $707
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6288
+ADDP4
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $707
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6288
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 3274964992
+GEF4 $709
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6288
+ADDP4
+ADDP4
+ADDRLP4 8
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $709
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6288
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $711
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $711
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+NEGF4
+GEF4 $713
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $713
+ADDRLP4 64
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 72
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6288
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+CNSTF4 1055286886
+CNSTF4 1065353216
+ADDRLP4 16
+INDIRF4
+SUBF4
+MULF4
+MULF4
+ASGNF4
+LABELV $703
+LABELV $699
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $698
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+INDIRF4
+CNSTF4 1127481344
+LEF4 $715
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $715
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ARGP4
+ADDRGP4 trap_EA_View
+CALLV
+pop
+LABELV $691
+endproc BotChangeViewAngles 80 16
+export BotInputToUserCommand
+proc BotInputToUserCommand 148 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 24
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 32768
+BANDI4
+CNSTI4 0
+EQI4 $718
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+CNSTI4 -32769
+BANDI4
+ASGNI4
+LABELV $718
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $720
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $720
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $722
+ADDRLP4 56
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $722
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 65536
+BANDI4
+CNSTI4 0
+EQI4 $724
+ADDRLP4 60
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $724
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 131072
+BANDI4
+CNSTI4 0
+EQI4 $726
+ADDRLP4 64
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $726
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $728
+ADDRLP4 68
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $728
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 524288
+BANDI4
+CNSTI4 0
+EQI4 $730
+ADDRLP4 72
+CNSTI4 16
+ASGNI4
+ADDRLP4 76
+ADDRFP4 4
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+BORI4
+ASGNI4
+LABELV $730
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 1048576
+BANDI4
+CNSTI4 0
+EQI4 $732
+ADDRLP4 80
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $732
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 2097152
+BANDI4
+CNSTI4 0
+EQI4 $734
+ADDRLP4 84
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+LABELV $734
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 8388608
+BANDI4
+CNSTI4 0
+EQI4 $736
+ADDRLP4 88
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+LABELV $736
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 16777216
+BANDI4
+CNSTI4 0
+EQI4 $738
+ADDRLP4 92
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 92
+INDIRP4
+INDIRI4
+CNSTI4 256
+BORI4
+ASGNI4
+LABELV $738
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 33554432
+BANDI4
+CNSTI4 0
+EQI4 $740
+ADDRLP4 96
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 96
+INDIRP4
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+LABELV $740
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 134217728
+BANDI4
+CNSTI4 0
+EQI4 $742
+ADDRLP4 100
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ADDRLP4 100
+INDIRP4
+INDIRI4
+CNSTI4 1024
+BORI4
+ASGNI4
+LABELV $742
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1199570944
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+MULF4
+CNSTF4 1135869952
+DIVF4
+CVFI4 4
+CNSTI4 65535
+BANDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1199570944
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+MULF4
+CNSTF4 1135869952
+DIVF4
+CVFI4 4
+CNSTI4 65535
+BANDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1199570944
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+CNSTF4 1135869952
+DIVF4
+CVFI4 4
+CNSTI4 65535
+BANDI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $744
+ADDRLP4 104
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 108
+ADDRLP4 104
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 108
+INDIRP4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRI4
+SUBI4
+CVII2 4
+ASGNI2
+ADDRLP4 108
+INDIRP4
+ADDRLP4 4
+INDIRI2
+CVII4 2
+ASGNI4
+LABELV $745
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $744
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $748
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $749
+JUMPV
+LABELV $748
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+LABELV $749
+ADDRLP4 20+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 32
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 104
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+CNSTF4 1123942400
+ADDRLP4 104
+INDIRP4
+INDIRF4
+MULF4
+CNSTF4 1137180672
+DIVF4
+ASGNF4
+ADDRLP4 112
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 116
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 120
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 124
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 8
+INDIRF4
+ADDRLP4 112
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 8+4
+INDIRF4
+ADDRLP4 116
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 8+8
+INDIRF4
+ADDRLP4 120
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 124
+INDIRP4
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 32
+INDIRF4
+ADDRLP4 112
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 32+4
+INDIRF4
+ADDRLP4 116
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 32+8
+INDIRF4
+ADDRLP4 120
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 124
+INDIRP4
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8+8
+INDIRF4
+ARGF4
+ADDRLP4 128
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 128
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $757
+ADDRLP4 44
+ADDRLP4 44
+INDIRI4
+CNSTI4 127
+ADDI4
+ASGNI4
+LABELV $757
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $759
+ADDRLP4 44
+ADDRLP4 44
+INDIRI4
+CNSTI4 127
+SUBI4
+ASGNI4
+LABELV $759
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $761
+ADDRLP4 48
+ADDRLP4 48
+INDIRI4
+CNSTI4 127
+SUBI4
+ASGNI4
+LABELV $761
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $763
+ADDRLP4 48
+ADDRLP4 48
+INDIRI4
+CNSTI4 127
+ADDI4
+ASGNI4
+LABELV $763
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $765
+ADDRLP4 52
+ADDRLP4 52
+INDIRI4
+CNSTI4 127
+ADDI4
+ASGNI4
+LABELV $765
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $767
+ADDRLP4 52
+ADDRLP4 52
+INDIRI4
+CNSTI4 127
+SUBI4
+ASGNI4
+LABELV $767
+ADDRLP4 44
+INDIRI4
+CNSTI4 127
+LEI4 $770
+ADDRLP4 136
+CNSTI4 127
+ASGNI4
+ADDRGP4 $771
+JUMPV
+LABELV $770
+ADDRLP4 136
+ADDRLP4 44
+INDIRI4
+ASGNI4
+LABELV $771
+ADDRFP4 4
+INDIRP4
+CNSTI4 21
+ADDP4
+ADDRLP4 136
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 48
+INDIRI4
+CNSTI4 127
+LEI4 $773
+ADDRLP4 140
+CNSTI4 127
+ASGNI4
+ADDRGP4 $774
+JUMPV
+LABELV $773
+ADDRLP4 140
+ADDRLP4 48
+INDIRI4
+ASGNI4
+LABELV $774
+ADDRFP4 4
+INDIRP4
+CNSTI4 22
+ADDP4
+ADDRLP4 140
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 52
+INDIRI4
+CNSTI4 127
+LEI4 $776
+ADDRLP4 144
+CNSTI4 127
+ASGNI4
+ADDRGP4 $777
+JUMPV
+LABELV $776
+ADDRLP4 144
+ADDRLP4 52
+INDIRI4
+ASGNI4
+LABELV $777
+ADDRFP4 4
+INDIRP4
+CNSTI4 23
+ADDP4
+ADDRLP4 144
+INDIRI4
+CVII1 4
+ASGNI1
+LABELV $717
+endproc BotInputToUserCommand 148 16
+proc BotUpdateInput 64 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $779
+ADDRLP4 44
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 44
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+CNSTF4 1001652224
+ADDRLP4 44
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 56
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+LABELV $780
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $779
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRGP4 BotChangeViewAngles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_EA_GetInput
+CALLV
+pop
+ADDRLP4 4+32
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $783
+ADDRFP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $786
+ADDRLP4 4+32
+ADDRLP4 4+32
+INDIRI4
+CNSTI4 -10
+BANDI4
+ASGNI4
+LABELV $786
+LABELV $783
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 BotInputToUserCommand
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $789
+ADDRLP4 48
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 48
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6264
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+CNSTF4 1001652224
+ADDRLP4 48
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+LABELV $790
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $789
+LABELV $778
+endproc BotUpdateInput 64 16
+proc BotAIRegularUpdate 0 0
+ADDRGP4 regularupdate_time
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $794
+ADDRGP4 trap_BotUpdateEntityItems
+CALLV
+pop
+ADDRGP4 regularupdate_time
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1050253722
+ADDF4
+ASGNF4
+LABELV $794
+LABELV $793
+endproc BotAIRegularUpdate 0 0
+proc RemoveColorEscapeSequences 24 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $800
+JUMPV
+LABELV $797
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_IsColorString
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $801
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $798
+JUMPV
+LABELV $801
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 126
+LEI4 $803
+ADDRGP4 $798
+JUMPV
+LABELV $803
+ADDRLP4 16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $798
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $800
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $797
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $796
+endproc RemoveColorEscapeSequences 24 4
+proc BotAI 1100 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_ResetInput
+CALLV
+pop
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $808
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $806
+LABELV $808
+CNSTI4 4
+ARGI4
+ADDRGP4 $809
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $805
+JUMPV
+LABELV $806
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRGP4 BotAI_GetClientState
+CALLI4
+pop
+ADDRGP4 $811
+JUMPV
+LABELV $810
+ADDRLP4 12
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 1044
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 1044
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $813
+ADDRGP4 $811
+JUMPV
+LABELV $813
+ADDRLP4 1048
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 1048
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 RemoveColorEscapeSequences
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRGP4 $817
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $815
+ADDRGP4 $816
+JUMPV
+LABELV $815
+ADDRLP4 12
+ARGP4
+ADDRGP4 $820
+ARGP4
+ADDRLP4 1056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $818
+ADDRGP4 $819
+JUMPV
+LABELV $818
+ADDRLP4 12
+ARGP4
+ADDRGP4 $823
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $821
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1064
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 1064
+INDIRU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1072
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1072
+INDIRU4
+CNSTU4 1
+SUBU4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_BotQueueConsoleMessage
+CALLV
+pop
+ADDRGP4 $822
+JUMPV
+LABELV $821
+ADDRLP4 12
+ARGP4
+ADDRGP4 $826
+ARGP4
+ADDRLP4 1064
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+NEI4 $824
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1068
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 1068
+INDIRU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1076
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1076
+INDIRU4
+CNSTU4 1
+SUBU4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_BotQueueConsoleMessage
+CALLV
+pop
+ADDRGP4 $825
+JUMPV
+LABELV $824
+ADDRLP4 12
+ARGP4
+ADDRGP4 $829
+ARGP4
+ADDRLP4 1068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+NEI4 $827
+ADDRGP4 $828
+JUMPV
+LABELV $827
+ADDRLP4 12
+ARGP4
+ADDRGP4 $832
+ARGP4
+ADDRLP4 1072
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+NEI4 $830
+ADDRGP4 $831
+JUMPV
+LABELV $830
+ADDRLP4 12
+ARGP4
+ADDRGP4 $835
+ARGP4
+ADDRLP4 1076
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $833
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1080
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 6260
+ADDP4
+ADDRLP4 1080
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 6260
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_SelectWeapon
+CALLV
+pop
+ADDRGP4 $834
+JUMPV
+LABELV $833
+ADDRLP4 12
+ARGP4
+ADDRGP4 $838
+ARGP4
+ADDRLP4 1080
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+NEI4 $836
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1084
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 3
+NEI4 $839
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotSelectLogo
+CALLV
+pop
+LABELV $839
+LABELV $836
+LABELV $834
+LABELV $831
+LABELV $828
+LABELV $825
+LABELV $822
+LABELV $819
+LABELV $816
+LABELV $811
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1044
+ADDRGP4 trap_BotGetServerCommand
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $810
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $841
+ADDRLP4 1048
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1056
+ADDRLP4 1048
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 6264
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 1056
+INDIRP4
+INDIRF4
+CNSTF4 1001652224
+ADDRLP4 1048
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 1060
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 1056
+INDIRP4
+ADDRLP4 1060
+INDIRF4
+ASGNF4
+LABELV $842
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $841
+ADDRLP4 1048
+ADDRLP4 4
+INDIRP4
+CNSTI4 6052
+ADDP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+ADDRLP4 1048
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4904
+ADDP4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4908
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 4936
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 1064
+ADDRLP4 4
+INDIRP4
+CNSTI4 4944
+ADDP4
+ASGNP4
+ADDRLP4 1064
+INDIRP4
+ADDRLP4 1064
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 1072
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4948
+ADDP4
+ADDRLP4 1072
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 9956
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 BotDeathmatchAI
+CALLV
+pop
+ADDRLP4 1076
+CNSTI4 0
+ASGNI4
+ADDRGP4 bot_developer+12
+INDIRI4
+ADDRLP4 1076
+INDIRI4
+EQI4 $845
+ADDRLP4 4
+INDIRP4
+CNSTI4 8408
+ADDP4
+INDIRI4
+ADDRLP4 1076
+INDIRI4
+EQI4 $845
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotSetInfoConfigString
+CALLV
+pop
+CNSTI4 25
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 9956
+ADDP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $845
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 6260
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_SelectWeapon
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $848
+ADDRLP4 1084
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1092
+ADDRLP4 1084
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 6264
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 1092
+INDIRP4
+INDIRF4
+CNSTF4 1001652224
+ADDRLP4 1084
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+ARGF4
+ADDRLP4 1096
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 1092
+INDIRP4
+ADDRLP4 1096
+INDIRF4
+ASGNF4
+LABELV $849
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $848
+CNSTI4 1
+RETI4
+LABELV $805
+endproc BotAI 1100 12
+proc BotScheduleBotThink 16 0
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $853
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $859
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $857
+LABELV $859
+ADDRGP4 $854
+JUMPV
+LABELV $857
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 bot_thinktime+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 numbots
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $854
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $853
+LABELV $852
+endproc BotScheduleBotThink 16 0
+export BotAISetupClient
+proc BotAISetupClient 512 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $862
+CNSTI4 10980
+ARGI4
+ADDRLP4 440
+ADDRGP4 G_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+ADDRLP4 440
+INDIRP4
+ASGNP4
+LABELV $862
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $864
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $864
+CNSTI4 4
+ARGI4
+ADDRGP4 $866
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $861
+JUMPV
+LABELV $864
+ADDRLP4 448
+ADDRGP4 trap_AAS_Initialized
+CALLI4
+ASGNI4
+ADDRLP4 448
+INDIRI4
+CNSTI4 0
+NEI4 $867
+CNSTI4 4
+ARGI4
+ADDRGP4 $869
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $861
+JUMPV
+LABELV $867
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 thinkStats
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 16
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 456
+ADDRGP4 trap_BotLoadCharacter
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $870
+CNSTI4 4
+ARGI4
+ADDRGP4 $872
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $861
+JUMPV
+LABELV $870
+ADDRLP4 0
+INDIRP4
+CNSTI4 4608
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTU4 292
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 460
+ADDRGP4 trap_BotAllocGoalState
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 40
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Characteristic_String
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 464
+ADDRGP4 trap_BotLoadItemWeights
+CALLI4
+ASGNI4
+ADDRLP4 148
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $873
+ADDRLP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeGoalState
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $861
+JUMPV
+LABELV $873
+ADDRLP4 468
+ADDRGP4 trap_BotAllocWeaponState
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6236
+ADDP4
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Characteristic_String
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6236
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 472
+ADDRGP4 trap_BotLoadWeaponWeights
+CALLI4
+ASGNI4
+ADDRLP4 148
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $875
+ADDRLP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeGoalState
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6236
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeWeaponState
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $861
+JUMPV
+LABELV $875
+ADDRLP4 476
+ADDRGP4 trap_BotAllocChatState
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 21
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Characteristic_String
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 22
+ARGI4
+ADDRLP4 296
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Characteristic_String
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 296
+ARGP4
+ADDRLP4 480
+ADDRGP4 trap_BotLoadChatFile
+CALLI4
+ASGNI4
+ADDRLP4 148
+ADDRLP4 480
+INDIRI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $877
+ADDRLP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeChatState
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeGoalState
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6236
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeWeaponState
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $861
+JUMPV
+LABELV $877
+ADDRLP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 152
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Characteristic_String
+CALLV
+pop
+ADDRLP4 484
+ADDRLP4 152
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 484
+INDIRI4
+CNSTI4 102
+EQI4 $881
+ADDRLP4 484
+INDIRI4
+CNSTI4 70
+NEI4 $879
+LABELV $881
+ADDRLP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotSetChatGender
+CALLV
+pop
+ADDRGP4 $880
+JUMPV
+LABELV $879
+ADDRLP4 488
+ADDRLP4 152
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 488
+INDIRI4
+CNSTI4 109
+EQI4 $884
+ADDRLP4 488
+INDIRI4
+CNSTI4 77
+NEI4 $882
+LABELV $884
+ADDRLP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotSetChatGender
+CALLV
+pop
+ADDRGP4 $883
+JUMPV
+LABELV $882
+ADDRLP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_BotSetChatGender
+CALLV
+pop
+LABELV $883
+LABELV $880
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6016
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6056
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 492
+ADDRGP4 trap_BotAllocMoveState
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+ADDRLP4 492
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 500
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6048
+ADDP4
+ADDRLP4 500
+INDIRF4
+ASGNF4
+ADDRLP4 504
+ADDRGP4 numbots
+ASGNP4
+ADDRLP4 504
+INDIRP4
+ADDRLP4 504
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $887
+ARGP4
+ADDRLP4 508
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 508
+INDIRI4
+CNSTI4 0
+EQI4 $885
+ADDRGP4 $887
+ARGP4
+ADDRGP4 $651
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChatTest
+CALLV
+pop
+LABELV $885
+ADDRGP4 BotScheduleBotThink
+CALLV
+pop
+ADDRGP4 bot_interbreed
+INDIRI4
+CNSTI4 0
+EQI4 $888
+ADDRLP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_BotMutateGoalFuzzyLogic
+CALLV
+pop
+LABELV $888
+CNSTI4 1
+RETI4
+LABELV $861
+endproc BotAISetupClient 512 16
+export BotAIShutdownClient
+proc BotAIShutdownClient 20 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $893
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $891
+LABELV $893
+CNSTI4 0
+RETI4
+ADDRGP4 $890
+JUMPV
+LABELV $891
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotChat_ExitGame
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $894
+ADDRLP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $894
+ADDRLP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeMoveState
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeGoalState
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeChatState
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6236
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeWeaponState
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeCharacter
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 10980
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRGP4 numbots
+ASGNP4
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+RETI4
+LABELV $890
+endproc BotAIShutdownClient 20 12
+export BotResetState
+proc BotResetState 800 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4608
+ADDP4
+ARGP4
+CNSTU4 292
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 324
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+CNSTU4 468
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 320
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 6236
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 792
+ADDRFP4 0
+INDIRP4
+CNSTI4 6056
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 10980
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6236
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 324
+ARGP4
+CNSTU4 468
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4608
+ADDP4
+ARGP4
+ADDRLP4 28
+ARGP4
+CNSTU4 292
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6056
+ADDP4
+ADDRLP4 792
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $897
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetMoveState
+CALLV
+pop
+LABELV $897
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $899
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetGoalState
+CALLV
+pop
+LABELV $899
+ADDRFP4 0
+INDIRP4
+CNSTI4 6236
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $901
+ADDRFP4 0
+INDIRP4
+CNSTI4 6236
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetWeaponState
+CALLV
+pop
+LABELV $901
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $903
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidGoals
+CALLV
+pop
+LABELV $903
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $905
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+LABELV $905
+LABELV $896
+endproc BotResetState 800 12
+export BotAILoadMap
+proc BotAILoadMap 280 16
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $908
+ADDRLP4 4
+ARGP4
+ADDRGP4 $282
+ARGP4
+ADDRGP4 $635
+ARGP4
+CNSTI4 68
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 4+16
+ARGP4
+ADDRLP4 276
+ADDRGP4 trap_BotLibLoadMap
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+EQI4 $910
+CNSTI4 0
+RETI4
+ADDRGP4 $907
+JUMPV
+LABELV $910
+LABELV $908
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $913
+ADDRLP4 276
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 276
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $917
+ADDRLP4 276
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $917
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BotResetState
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 6016
+ADDP4
+CNSTI4 4
+ASGNI4
+LABELV $917
+LABELV $914
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $913
+ADDRGP4 BotSetupDeathmatchAI
+CALLV
+pop
+ADDRLP4 276
+CNSTI4 1
+ASGNI4
+ADDRGP4 entityResend
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+RETI4
+LABELV $907
+endproc BotAILoadMap 280 16
+export BotFindHumanPlayer
+proc BotFindHumanPlayer 4 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $923
+JUMPV
+LABELV $920
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $925
+ADDRGP4 $921
+JUMPV
+LABELV $925
+CNSTI4 832
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $927
+ADDRGP4 $921
+JUMPV
+LABELV $927
+CNSTI4 832
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+RETP4
+ADDRGP4 $919
+JUMPV
+LABELV $921
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $923
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $920
+CNSTP4 0
+RETP4
+LABELV $919
+endproc BotFindHumanPlayer 4 0
+proc ScanForCrossHairPlayer 112 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 92
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 152
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 100
+CNSTP4 0
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 104
+CNSTF4 1207959552
+ASGNF4
+ADDRLP4 24
+ADDRLP4 0
+INDIRF4
+ADDRLP4 104
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 104
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1207959552
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 108
+CNSTP4 0
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 92
+INDIRI4
+ARGI4
+CNSTI4 33554432
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 36+52
+INDIRI4
+CNSTI4 64
+GEI4 $938
+ADDRLP4 36+52
+INDIRI4
+RETI4
+ADDRGP4 $931
+JUMPV
+LABELV $938
+CNSTI4 -1
+RETI4
+LABELV $931
+endproc ScanForCrossHairPlayer 112 28
+data
+align 4
+LABELV $943
+byte 4 -1
+code
+proc BotAIObserve 36 8
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+NEI4 $944
+CNSTI4 25
+ARGI4
+ADDRGP4 $635
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $942
+JUMPV
+LABELV $944
+ADDRLP4 4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 12
+ADDRGP4 BotFindHumanPlayer
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $947
+CNSTI4 25
+ARGI4
+ADDRGP4 $635
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $942
+JUMPV
+LABELV $947
+ADDRLP4 16
+ADDRLP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $949
+ADDRLP4 16
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $949
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 640
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $950
+JUMPV
+LABELV $949
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 ScanForCrossHairPlayer
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 -1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $951
+ADDRGP4 $943
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $951
+ADDRLP4 4
+ADDRGP4 $943
+INDIRI4
+ASGNI4
+LABELV $951
+ADDRGP4 $943
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $950
+ADDRGP4 $643
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $953
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $954
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $960
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $958
+LABELV $960
+ADDRGP4 $955
+JUMPV
+LABELV $958
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $962
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRGP4 $963
+JUMPV
+LABELV $962
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+LABELV $963
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 8408
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+LABELV $955
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $954
+LABELV $942
+endproc BotAIObserve 36 8
+export BotAI_AllowLTGRefresh
+proc BotAI_AllowLTGRefresh 8 0
+ADDRGP4 ltgRefreshes
+INDIRI4
+CNSTI4 2
+LTI4 $965
+CNSTI4 0
+RETI4
+ADDRGP4 $964
+JUMPV
+LABELV $965
+ADDRLP4 0
+ADDRGP4 ltgRefreshes
+ASGNP4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $964
+endproc BotAI_AllowLTGRefresh 8 0
+proc BotAIResetStats 4 12
+ADDRGP4 thinkStats
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 statsFrames
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 statsMaxFrameMsec
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 statsBudgetFrames
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $967
+endproc BotAIResetStats 4 12
+export Svcmd_BotStats_f
+proc Svcmd_BotStats_f 1100 28
+CNSTI4 1
+ARGI4
+ADDRLP4 44
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 44
+ARGP4
+ADDRGP4 $971
+ARGP4
+ADDRLP4 1068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+NEI4 $969
+ADDRGP4 BotAIResetStats
+CALLV
+pop
+ADDRGP4 $968
+JUMPV
+LABELV $969
+ADDRGP4 $972
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $973
+ADDRLP4 1072
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1072
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $979
+ADDRLP4 1072
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $977
+LABELV $979
+ADDRGP4 $974
+JUMPV
+LABELV $977
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 thinkStats
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 1084
+ADDRGP4 ClientName
+CALLP4
+ASGNP4
+ADDRGP4 $980
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1084
+INDIRP4
+ARGP4
+ADDRLP4 1088
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+ARGI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 0
+EQI4 $982
+ADDRLP4 1076
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRGP4 $983
+JUMPV
+LABELV $982
+ADDRLP4 1076
+CNSTF4 0
+ASGNF4
+LABELV $983
+ADDRLP4 1076
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $974
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $973
+ADDRGP4 $984
+ARGP4
+ADDRGP4 statsFrames
+INDIRI4
+ARGI4
+ADDRGP4 statsMaxFrameMsec
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 bot_maxframetime+12
+INDIRI4
+CNSTI4 0
+LEI4 $985
+ADDRGP4 $988
+ARGP4
+ADDRGP4 statsBudgetFrames
+INDIRI4
+ARGI4
+ADDRGP4 bot_maxframetime+12
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $985
+LABELV $968
+endproc Svcmd_BotStats_f 1100 28
+proc BotEntityState 16 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 832
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $994
+ADDRLP4 0
+INDIRP4
+CNSTI4 416
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $994
+ADDRLP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $991
+LABELV $994
+CNSTI4 0
+RETI4
+ADDRGP4 $990
+JUMPV
+LABELV $991
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $995
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 13
+EQI4 $995
+CNSTI4 0
+RETI4
+ADDRGP4 $990
+JUMPV
+LABELV $995
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 18
+LEI4 $997
+CNSTI4 0
+RETI4
+ADDRGP4 $990
+JUMPV
+LABELV $997
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 112
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+GEI4 $999
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $1000
+JUMPV
+LABELV $999
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $1000
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 432
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1001
+ADDRFP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $1002
+JUMPV
+LABELV $1001
+ADDRFP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 2
+ASGNI4
+LABELV $1002
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $990
+endproc BotEntityState 16 12
+proc BotUpdateEntities 172 20
+ADDRLP4 8
+CNSTI4 28
+ASGNI4
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+ADDRLP4 140
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+LABELV $1004
+ADDRLP4 20
+CNSTI4 1
+ADDRLP4 4
+INDIRI4
+CNSTI4 7
+BANDI4
+LSHI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+RSHI4
+ADDRGP4 entityLive
+ADDP4
+INDIRU1
+CVUI4 1
+ADDRLP4 20
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $1009
+ADDRLP4 148
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1010
+JUMPV
+LABELV $1009
+ADDRLP4 148
+CNSTI4 0
+ASGNI4
+LABELV $1010
+ADDRLP4 136
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 156
+ADDRGP4 BotEntityState
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+NEI4 $1011
+ADDRLP4 160
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+RSHI4
+ADDRGP4 entityLive
+ADDP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ADDRLP4 160
+INDIRP4
+INDIRU1
+CVUI4 1
+ADDRLP4 20
+INDIRI4
+BCOMI4
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRGP4 $1005
+JUMPV
+LABELV $1011
+ADDRLP4 160
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+RSHI4
+ADDRGP4 entityLive
+ADDP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ADDRLP4 160
+INDIRP4
+INDIRU1
+CVUI4 1
+ADDRLP4 20
+INDIRI4
+BORI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 164
+CNSTI4 0
+ASGNI4
+ADDRLP4 136
+INDIRI4
+ADDRLP4 164
+INDIRI4
+EQI4 $1013
+ADDRGP4 entityResend
+INDIRI4
+ADDRLP4 164
+INDIRI4
+NEI4 $1013
+ADDRLP4 12
+ADDRLP4 24
+ASGNP4
+ADDRLP4 16
+CNSTI4 112
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 entityStates
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1018
+JUMPV
+LABELV $1015
+ADDRLP4 168
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+INDIRI4
+ADDRLP4 168
+INDIRI4
+ADDRLP4 16
+INDIRP4
+ADDP4
+INDIRI4
+EQI4 $1019
+ADDRGP4 $1017
+JUMPV
+LABELV $1019
+LABELV $1016
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1018
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $1015
+LABELV $1017
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $1021
+ADDRGP4 $1005
+JUMPV
+LABELV $1021
+LABELV $1013
+CNSTI4 112
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 entityStates
+ADDP4
+ADDRLP4 24
+INDIRB
+ASGNB 112
+ADDRLP4 168
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 168
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 entityChanged
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $1005
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1024
+LTI4 $1004
+ADDRGP4 entityResend
+CNSTI4 0
+ASGNI4
+CNSTI4 1024
+ARGI4
+ADDRGP4 entityLive
+ARGP4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRGP4 entityChanged
+ARGP4
+ADDRGP4 entityStates
+ARGP4
+ADDRLP4 148
+ADDRGP4 trap_BotLibUpdateEntities
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 13
+NEI4 $1023
+ADDRGP4 entityResend
+CNSTI4 1
+ASGNI4
+LABELV $1023
+LABELV $1003
+endproc BotUpdateEntities 172 20
+bss
+align 4
+LABELV $1026
+skip 4
+align 4
+LABELV $1027
+skip 4
+align 4
+LABELV $1028
+skip 4
+align 4
+LABELV $1029
+skip 4
+export BotAIStartFrame
+code
+proc BotAIStartFrame 120 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 G_CheckBotSpawn
+CALLV
+pop
+ADDRGP4 bot_developer
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 2
+NEI4 $1030
+ADDRGP4 $1033
+ARGP4
+ADDRGP4 $1034
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $1035
+ARGP4
+ADDRGP4 $1034
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $1031
+JUMPV
+LABELV $1030
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 3
+NEI4 $1036
+ADDRGP4 $1033
+ARGP4
+ADDRGP4 $651
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $1035
+ARGP4
+ADDRGP4 $1034
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $1037
+JUMPV
+LABELV $1036
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 4
+NEI4 $1039
+ADDRGP4 $1035
+ARGP4
+ADDRGP4 $651
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $1033
+ARGP4
+ADDRGP4 $1034
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $1039
+LABELV $1037
+LABELV $1031
+ADDRGP4 bot_fastchat
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_nochat
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_testrchat
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_thinktime
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_maxframetime
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_memorydump
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_saveroutingcache
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_pause
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_showreachesfrom
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_showreachesto
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_roamfactor
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_shownextitem
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_shownoitem
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_cachetest
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_cachetest+12
+INDIRI4
+CNSTI4 0
+EQI4 $1042
+ADDRGP4 $1045
+ARGP4
+ADDRGP4 $651
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $1046
+ARGP4
+ADDRGP4 $1034
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1042
+ADDRGP4 bot_shownextitem+12
+INDIRI4
+CNSTI4 0
+EQI4 $1047
+ADDRGP4 $1050
+ARGP4
+ADDRGP4 $651
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $1051
+ARGP4
+ADDRGP4 $1034
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1047
+ADDRGP4 bot_shownoitem+12
+INDIRI4
+CNSTI4 0
+EQI4 $1052
+ADDRGP4 $1055
+ARGP4
+ADDRGP4 $651
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 trap_BotInitLevelItems
+CALLV
+pop
+ADDRGP4 $1056
+ARGP4
+ADDRGP4 $1034
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1052
+ADDRGP4 $643
+ARGP4
+ADDRGP4 bot_showreachesfrom+12
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $1057
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $643
+ARGP4
+ADDRGP4 bot_showreachesto+12
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $1059
+ARGP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $643
+ARGP4
+ADDRGP4 bot_roamfactor+12
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $1061
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1063
+ADDRGP4 $1066
+ARGP4
+ADDRGP4 $651
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $1063
+ADDRGP4 bot_pause+12
+INDIRI4
+CNSTI4 0
+EQI4 $1067
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1070
+ADDRLP4 52
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1076
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $1074
+LABELV $1076
+ADDRGP4 $1071
+JUMPV
+LABELV $1074
+CNSTI4 832
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $1077
+ADDRGP4 $1071
+JUMPV
+LABELV $1077
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 509
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 510
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 511
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 504
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 488
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+ADDRGP4 trap_BotUserCommand
+CALLV
+pop
+LABELV $1071
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1070
+CNSTI4 1
+RETI4
+ADDRGP4 $1025
+JUMPV
+LABELV $1067
+ADDRGP4 bot_memorydump+12
+INDIRI4
+CNSTI4 0
+EQI4 $1080
+ADDRGP4 $1083
+ARGP4
+ADDRGP4 $651
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $1084
+ARGP4
+ADDRGP4 $1034
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1085
+ARGP4
+CNSTU4 256
+ARGU4
+CNSTU4 10980
+ARGU4
+CNSTF4 1019150169
+ARGF4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $1080
+ADDRGP4 bot_saveroutingcache+12
+INDIRI4
+CNSTI4 0
+EQI4 $1086
+ADDRGP4 $1089
+ARGP4
+ADDRGP4 $651
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $1090
+ARGP4
+ADDRGP4 $1034
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1086
+ADDRGP4 BotInterbreeding
+CALLV
+pop
+ADDRGP4 bot_thinktime+12
+INDIRI4
+CNSTI4 200
+LEI4 $1091
+ADDRGP4 $1094
+ARGP4
+ADDRGP4 $1095
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1091
+ADDRGP4 bot_thinktime+12
+INDIRI4
+ADDRGP4 $1028
+INDIRI4
+EQI4 $1096
+ADDRGP4 $1028
+ADDRGP4 bot_thinktime+12
+INDIRI4
+ASGNI4
+ADDRGP4 BotScheduleBotThink
+CALLV
+pop
+LABELV $1096
+ADDRLP4 56
+ADDRGP4 $1026
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 56
+INDIRP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRGP4 $1027
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 bot_thinktime+12
+INDIRI4
+LEI4 $1100
+ADDRLP4 12
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $1101
+JUMPV
+LABELV $1100
+ADDRLP4 12
+ADDRGP4 bot_thinktime+12
+INDIRI4
+ASGNI4
+LABELV $1101
+ADDRGP4 $1027
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $1104
+ADDRLP4 68
+ADDRGP4 $1027
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRGP4 trap_BotLibStartFrame
+CALLI4
+pop
+ADDRLP4 72
+ADDRGP4 trap_AAS_Initialized
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $1106
+ADDRGP4 entityResend
+CNSTI4 1
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $1025
+JUMPV
+LABELV $1106
+ADDRGP4 BotUpdateEntities
+CALLV
+pop
+ADDRGP4 BotAIRegularUpdate
+CALLV
+pop
+LABELV $1104
+ADDRLP4 68
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRGP4 floattime
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRGP4 BotAIObserve
+CALLV
+pop
+ADDRLP4 72
+ADDRGP4 visFrame
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 BotBatchVisTraces
+CALLV
+pop
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRGP4 ltgRefreshes
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 80
+ADDRGP4 $1029
+ASGNP4
+ADDRLP4 20
+ADDRLP4 80
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 76
+INDIRI4
+ASGNI4
+LABELV $1108
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+CNSTI4 64
+MODI4
+ASGNI4
+ADDRLP4 84
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1114
+ADDRLP4 84
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $1112
+LABELV $1114
+ADDRGP4 $1109
+JUMPV
+LABELV $1112
+ADDRLP4 88
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $1115
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRGP4 bot_maxframetime+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+LEI4 $1117
+ADDRLP4 24
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $1117
+ADDRLP4 28
+INDIRI4
+ADDRGP4 bot_maxframetime+12
+INDIRI4
+LTI4 $1117
+ADDRLP4 96
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 thinkStats+12
+ADDP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 96
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $1122
+ADDRGP4 $1029
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+LABELV $1122
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $1109
+JUMPV
+LABELV $1117
+ADDRLP4 96
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 96
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 100
+ADDRGP4 trap_AAS_Initialized
+CALLI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+NEI4 $1124
+CNSTI4 0
+RETI4
+ADDRGP4 $1025
+JUMPV
+LABELV $1124
+CNSTI4 832
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1126
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 8400
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 104
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRGP4 BotAI
+CALLI4
+pop
+ADDRLP4 108
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 108
+INDIRI4
+ADDRLP4 36
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 112
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 thinkStats
+ADDP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ADDRLP4 112
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 116
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 thinkStats+4
+ADDP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 116
+INDIRP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 thinkStats+8
+ADDP4
+INDIRI4
+LEI4 $1130
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 thinkStats+8
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+LABELV $1130
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1126
+LABELV $1115
+LABELV $1109
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $1108
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+ADDRGP4 visTraces
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRLP4 84
+INDIRI4
+EQI4 $1134
+ADDRLP4 88
+ADDRGP4 statsFrames
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 statsMaxFrameMsec
+INDIRI4
+LEI4 $1136
+ADDRGP4 statsMaxFrameMsec
+ADDRLP4 28
+INDIRI4
+ASGNI4
+LABELV $1136
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $1138
+ADDRLP4 92
+ADDRGP4 statsBudgetFrames
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 92
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1138
+LABELV $1134
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1140
+ADDRLP4 88
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1146
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $1144
+LABELV $1146
+ADDRGP4 $1141
+JUMPV
+LABELV $1144
+CNSTI4 832
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $1147
+ADDRGP4 $1141
+JUMPV
+LABELV $1147
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateInput
+CALLV
+pop
+ADDRLP4 92
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 92
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+ADDRGP4 trap_BotUserCommand
+CALLV
+pop
+LABELV $1141
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1140
+CNSTI4 1
+RETI4
+LABELV $1025
+endproc BotAIStartFrame 120 16
+proc BotInitLibrary 212 16
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 $643
+ARGP4
+ADDRGP4 level+60
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $1152
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 $643
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $1153
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $1154
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 144
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 144
+INDIRU4
+CNSTU4 0
+EQU4 $1155
+ADDRGP4 $1154
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $1155
+ADDRGP4 $1157
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 148
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 148
+INDIRU4
+CNSTU4 0
+EQU4 $1158
+ADDRGP4 $1157
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $1158
+ADDRGP4 $1160
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 152
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 152
+INDIRU4
+CNSTU4 0
+EQU4 $1161
+ADDRGP4 $1160
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $1161
+ADDRGP4 $642
+ARGP4
+ADDRLP4 156
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 gametype
+ADDRLP4 156
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 2
+NEI4 $1163
+ADDRGP4 $1165
+ARGP4
+ADDRGP4 $1166
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $1164
+JUMPV
+LABELV $1163
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+LTI4 $1167
+ADDRGP4 $1165
+ARGP4
+ADDRGP4 $1169
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $1168
+JUMPV
+LABELV $1167
+ADDRGP4 $1165
+ARGP4
+ADDRGP4 $1170
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $1168
+LABELV $1164
+ADDRGP4 $1171
+ARGP4
+ADDRGP4 bot_developer+16
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $1173
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 $1174
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $1175
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 160
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 160
+INDIRU4
+CNSTU4 0
+EQU4 $1176
+ADDRGP4 $1178
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $1176
+ADDRGP4 $1179
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 164
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 164
+INDIRU4
+CNSTU4 0
+EQU4 $1180
+ADDRGP4 $1179
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $1180
+ADDRGP4 $1182
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 168
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 168
+INDIRU4
+CNSTU4 0
+EQU4 $1183
+ADDRGP4 $1185
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $1183
+ADDRGP4 $1186
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 172
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 172
+INDIRU4
+CNSTU4 0
+EQU4 $1187
+ADDRGP4 $1189
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $1187
+ADDRGP4 $1190
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 176
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 176
+INDIRU4
+CNSTU4 0
+EQU4 $1191
+ADDRGP4 $1193
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $1191
+ADDRGP4 $1194
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 180
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 180
+INDIRU4
+CNSTU4 0
+EQU4 $1195
+ADDRGP4 $1197
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $1195
+ADDRGP4 $1090
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 184
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 184
+INDIRU4
+CNSTU4 0
+EQU4 $1198
+ADDRGP4 $1089
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $1198
+ADDRGP4 $1200
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 188
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 188
+INDIRU4
+CNSTU4 0
+EQU4 $1201
+ADDRGP4 $1203
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $1201
+ADDRGP4 $650
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 192
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 192
+INDIRU4
+CNSTU4 0
+NEU4 $1204
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1034
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $1204
+ADDRGP4 $650
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $1206
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 196
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 196
+INDIRU4
+CNSTU4 0
+EQU4 $1207
+ADDRGP4 $1209
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $1207
+ADDRGP4 $1210
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 200
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 200
+INDIRU4
+CNSTU4 0
+EQU4 $1211
+ADDRGP4 $1213
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $1211
+ADDRGP4 $1214
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 204
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 204
+INDIRU4
+CNSTU4 0
+EQU4 $1215
+ADDRGP4 $1217
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $1215
+ADDRLP4 208
+ADDRGP4 trap_BotLibSetup
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+RETI4
+LABELV $1150
+endproc BotInitLibrary 212 16
+export BotAISetup
+proc BotAISetup 8 16
+ADDRGP4 bot_thinktime
+ARGP4
+ADDRGP4 $1094
+ARGP4
+ADDRGP4 $1219
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_maxframetime
+ARGP4
+ADDRGP4 $1220
+ARGP4
+ADDRGP4 $1034
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_memorydump
+ARGP4
+ADDRGP4 $1084
+ARGP4
+ADDRGP4 $1034
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_saveroutingcache
+ARGP4
+ADDRGP4 $1090
+ARGP4
+ADDRGP4 $1034
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_pause
+ARGP4
+ADDRGP4 $1221
+ARGP4
+ADDRGP4 $1034
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_testsolid
+ARGP4
+ADDRGP4 $1222
+ARGP4
+ADDRGP4 $1034
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_testclusters
+ARGP4
+ADDRGP4 $1223
+ARGP4
+ADDRGP4 $1034
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_developer
+ARGP4
+ADDRGP4 $1171
+ARGP4
+ADDRGP4 $1034
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_interbreedchar
+ARGP4
+ADDRGP4 $660
+ARGP4
+ADDRGP4 $635
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_interbreedbots
+ARGP4
+ADDRGP4 $1224
+ARGP4
+ADDRGP4 $1225
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_interbreedcycle
+ARGP4
+ADDRGP4 $1226
+ARGP4
+ADDRGP4 $1227
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_interbreedwrite
+ARGP4
+ADDRGP4 $634
+ARGP4
+ADDRGP4 $635
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_cachetest
+ARGP4
+ADDRGP4 $1046
+ARGP4
+ADDRGP4 $1034
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_roamfactor
+ARGP4
+ADDRGP4 $1228
+ARGP4
+ADDRGP4 $651
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_shownextitem
+ARGP4
+ADDRGP4 $1051
+ARGP4
+ADDRGP4 $1034
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_shownoitem
+ARGP4
+ADDRGP4 $1056
+ARGP4
+ADDRGP4 $1034
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_showreachesfrom
+ARGP4
+ADDRGP4 $1229
+ARGP4
+ADDRGP4 $1034
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_showreachesto
+ARGP4
+ADDRGP4 $1230
+ARGP4
+ADDRGP4 $1034
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1231
+CNSTI4 1
+RETI4
+ADDRGP4 $1218
+JUMPV
+LABELV $1231
+ADDRGP4 botstates
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 256
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 BotAIResetStats
+CALLV
+pop
+ADDRGP4 ResetWaypoints
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 BotInitLibrary
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1233
+CNSTI4 0
+RETI4
+ADDRGP4 $1218
+JUMPV
+LABELV $1233
+CNSTI4 1
+RETI4
+LABELV $1218
+endproc BotAISetup 8 16
+export BotAIShutdown
+proc BotAIShutdown 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1236
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1238
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1242
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $1242
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotAIShutdownClient
+CALLI4
+pop
+LABELV $1242
+LABELV $1239
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1238
+ADDRGP4 $1237
+JUMPV
+LABELV $1236
+ADDRGP4 trap_BotLibShutdown
+CALLI4
+pop
+LABELV $1237
+CNSTI4 1
+RETI4
+LABELV $1235
+endproc BotAIShutdown 8 8
+import ExitLevel
+bss
+align 4
+LABELV entityResend
+skip 4
+align 4
+LABELV entityChanged
+skip 4096
+align 1
+LABELV entityLive
+skip 128
+align 4
+LABELV entityStates
+skip 114688
+align 4
+LABELV visFrame
+skip 4
+align 4
+LABELV visMatrix
+skip 81920
+align 4
+LABELV visTraces
+skip 126984
+align 4
+LABELV statsBudgetFrames
+skip 4
+align 4
+LABELV statsMaxFrameMsec
+skip 4
+align 4
+LABELV statsFrames
+skip 4
+align 4
+LABELV thinkStats
+skip 1024
+align 4
+LABELV ltgRefreshes
+skip 4
+align 4
+LABELV bot_maxframetime
+skip 272
+align 4
+LABELV bot_showreachesto
+skip 272
+align 4
+LABELV bot_showreachesfrom
+skip 272
+align 4
+LABELV bot_shownoitem
+skip 272
+align 4
+LABELV bot_shownextitem
+skip 272
+align 4
+LABELV bot_roamfactor
+skip 272
+align 4
+LABELV bot_cachetest
+skip 272
+align 4
+LABELV bot_interbreedwrite
+skip 272
+align 4
+LABELV bot_interbreedcycle
+skip 272
+align 4
+LABELV bot_interbreedbots
+skip 272
+align 4
+LABELV bot_interbreedchar
+skip 272
+align 4
+LABELV bot_testclusters
+skip 272
+align 4
+LABELV bot_testsolid
+skip 272
+align 4
+LABELV bot_pause
+skip 272
+align 4
+LABELV bot_saveroutingcache
+skip 272
+align 4
+LABELV bot_memorydump
+skip 272
+export bot_thinktime
+align 4
+LABELV bot_thinktime
+skip 272
+align 4
+LABELV bot_interbreedmatchcount
+skip 4
+align 4
+LABELV bot_interbreed
+skip 4
+align 4
+LABELV regularupdate_time
+skip 4
+export numbots
+align 4
+LABELV numbots
+skip 4
+export botstates
+align 4
+LABELV botstates
+skip 256
+import BotChooseCorrectWall
+import BotChooseWall
+import BotDumpNodeSwitches
+import BotResetNodeSwitches
+import AINode_Cam
+import AINode_Reachtest
+import AIEnter_Reachtest
+import AINode_Battle_NBG
+import AINode_Battle_Retreat
+import AINode_Battle_Chase
+import AINode_Battle_Fight
+import AINode_Seek_LTG
+import AINode_Seek_NBG
+import AINode_Seek_ActivateEntity
+import AINode_Respawn
+import AIEnter_Battle_NBG
+import AIEnter_Battle_Retreat
+import AIEnter_Battle_Chase
+import AIEnter_Battle_Fight
+import AIEnter_Seek_Camp
+import AIEnter_Seek_LTG
+import AIEnter_Seek_NBG
+import AIEnter_Seek_ActivateEntity
+import AIEnter_Stand
+import BotMatchMessage
+import notleader
+import BotChatTest
+import BotChatTime
+import BotChat_Random
+import BotChat_EnemySuicide
+import BotChat_Kill
+import BotChat_Death
+import BotChat_HitNoKill
+import BotChat_HitNoDeath
+import BotChat_HitTalking
+import BotChat_EndLevel
+import BotChat_StartLevel
+import BotChat_ExitGame
+import BotChat_EnterGame
+import num_hstations
+import hstations
+import outtele
+import spraytele
+import bwall
+import rwall
+import balloongoal
+import ctf_blueflag
+import ctf_redflag
+import bot_challenge
+import bot_testrchat
+import bot_nochat
+import bot_fastchat
+import maxclients
+import gametype
+import GetCTLFlagGoal
+import GetDroppedLollyGoal
+import CheckMatrixForGoal
+import BotCTFCarryingFlag
+import IsMyBalloon
+import IsBambam
+import IsBoomie
+import IsWall
+import IsDuck
+import BotSelectLogo
+import BotSprayWallCheckAttack
+import BotGetNumClientCarts
+import BotNmyTurnedInvalid
+import BotCheckChargedImp
+import ClientInSprayroom
+import BotMapScripts
+import BotPointAreaNum
+import ClientOnSameTeamFromName
+import ClientFromName
+import BotRememberLastOrderedTask
+import BotOppositeTeam
+import BotTeam
+import BotClearActivateGoalStack
+import BotPopFromActivateGoalStack
+import BotEnableActivateGoalAreas
+import BotAIPredictObstacles
+import BotAIBlocked
+import BotCheckAttack
+import BotAimAtEnemy
+import BotEntityVisible
+import BotRoamGoal
+import BotFindEnemy
+import InFieldOfVision
+import BotVisibleTeamMatesAndEnemies
+import TeamPlayIsOn
+import BotSameTeam
+import BotAttackMove
+import BotWantsToHelp
+import BotWantsToChase
+import BotWantsToRetreat
+import BotAggression
+import BotTeamGoals
+import ClientSkin
+import EasyClientName
+import ClientName
+import BotSetUserInfo
+import EntityIsShooting
+import EntityIsInvisible
+import EntityIsDead
+import BotInLavaOrSlime
+import BotIntermission
+import BotIsObserver
+import BotIsDead
+import BotBattleUseItems
+import BotUpdateBattleInventory
+import BotUpdateInventory
+import BotSetupForMovement
+import BotChooseWeapon
+import BotDeathmatchAI
+import BotSetupDeathmatchAI
+export floattime
+align 4
+LABELV floattime
+skip 4
+export numboomiespots
+align 4
+LABELV numboomiespots
+skip 4
+export boomiespots
+align 4
+LABELV boomiespots
+skip 4864
+export numbambamspots
+align 4
+LABELV numbambamspots
+skip 4
+export bambamspots
+align 4
+LABELV bambamspots
+skip 4096
+export numwaypoints
+align 4
+LABELV numwaypoints
+skip 4
+export waypoints
+align 4
+LABELV waypoints
+skip 16384
+export bot_developer
+align 4
+LABELV bot_developer
+skip 272
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotAllocWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownMoveAI
+import BotSetupMoveAI
+import BotSetBrushModelTypes
+import BotAddAvoidSpot
+import BotInitMoveState
+import BotFreeMoveState
+import BotAllocMoveState
+import BotPredictVisiblePosition
+import BotMovementViewTarget
+import BotReachabilityArea
+import BotResetLastAvoidReach
+import BotResetAvoidReach
+import BotMoveInDirection
+import BotMoveToGoal
+import BotResetMoveState
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GeneticParentsAndChildSelection
+import BotSetChatName
+import BotSetChatGender
+import BotLoadChatFile
+import BotReplaceSynonyms
+import UnifyWhiteSpaces
+import BotMatchVariable
+import BotFindMatch
+import StringContains
+import BotGetChatMessage
+import BotEnterChat
+import BotChatLength
+import BotReplyChat
+import BotNumInitialChats
+import BotInitialChat
+import BotNumConsoleMessages
+import BotNextConsoleMessage
+import BotRemoveConsoleMessage
+import BotQueueConsoleMessage
+import BotFreeChatState
+import BotAllocChatState
+import BotShutdownChatAI
+import BotSetupChatAI
+import BotShutdownCharacters
+import Characteristic_String
+import Characteristic_BInteger
+import Characteristic_Integer
+import Characteristic_BFloat
+import Characteristic_Float
+import BotFreeCharacter
+import BotLoadCharacter
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Walk
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import GetBotLibAPI
+import trap_AAS_BestReachableArea
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntities
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_RealTime
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_EntitiesInPVS
+import trap_RestoreClients
+import trap_RewindClients
+import trap_GetUsercmds
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_TraceBatch
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import g_logDamage
+import g_modInstagib_WeaponJump
+import g_modInstagib
+import g_transmitSVboastermissiles
+import g_KillerduckHealth
+import g_LPS_flags
+import g_LPS_startlives
+import g_skyLensflare
+import g_sky
+import g_q3Items
+import pmove_msec
+import pmove_fixed
+import g_antilag
+import g_smoothClients
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_curWarmupReady
+import g_warmupReady
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import MapSupportsGametype
+import G_GetArenaInfoByMap
+import G_InitGameinfo
+import BotCamViewangles
+import BotCamViewTarget
+import BotCamViewEntitiy
+import BotChooseWeap
+import BotCamFire
+import BotCamTaunt
+import BotCamMoveTo
+import BotCamMode
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_LoadBots
+import CantDamageTeamitem
+import boomies_createByPlayer
+import bambam_createByPlayer
+import IsItemSameTeam
+import Instagib_canSpawnEntity
+import Instagib_isRelevantDamageEvent
+import Instagib_calculateDamage
+import Instagib_getSpawnWeapon
+import Instagib_applyWeaponJumpKnockback
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import PrintMsg
+import CheckObeliskAttack
+import Team_GetFlagStatus
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThinkBatch
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogFlush
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import G_GetCvarInt
+import MoveClientToIntermission
+import G_SendScoreboardUpdates
+import DeathmatchScoreboardMessage
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import GetASpawnPosition
+import SelectSpectatorSpawnPoint
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import respawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import Touch_DoorTrigger
+import G_PushablesChanged
+import G_RunMover
+import fire_kma
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_bubbleg
+import fire_bambamMissile
+import fire_duck
+import explode_imperius
+import fire_splasher
+import fire_nipper
+import fire_boaster
+import G_RunExplosion
+import G_RunMissile
+import BerserkerCheck
+import TossClientCubes
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import GametypeNameShort
+import GametypeName
+import RemoveOwnedItems
+import SetAward
+import G_RestorePowerups
+import G_BackupPowerups
+import DeleteDebugLines
+import DebugLineDouble
+import DebugLine
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_NextActiveEntity
+import G_InitEntityLists
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_FindAll
+import G_Find
+import G_EntityIndexChanged
+import G_InitEntityIndex
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import G_Say
+import ConcatArgs
+import Cmd_DropCartridge_f
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $1230
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 0
+align 1
+LABELV $1229
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 115
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $1228
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 97
+byte 1 109
+byte 1 102
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1227
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $1226
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 99
+byte 1 121
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1225
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $1224
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $1223
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 99
+byte 1 108
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $1222
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 0
+align 1
+LABELV $1221
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $1220
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1219
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $1217
+byte 1 104
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $1214
+byte 1 102
+byte 1 115
+byte 1 95
+byte 1 104
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $1213
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $1210
+byte 1 102
+byte 1 115
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1209
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $1206
+byte 1 102
+byte 1 115
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $1203
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $1200
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $1197
+byte 1 97
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $1194
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 97
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $1193
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 119
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $1190
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 119
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $1189
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $1186
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $1185
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 99
+byte 1 108
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $1182
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 99
+byte 1 108
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $1179
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $1178
+byte 1 110
+byte 1 111
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $1175
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $1174
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 0
+align 1
+LABELV $1173
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1171
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1170
+byte 1 66
+byte 1 79
+byte 1 84
+byte 1 76
+byte 1 73
+byte 1 66
+byte 1 95
+byte 1 71
+byte 1 84
+byte 1 95
+byte 1 70
+byte 1 70
+byte 1 65
+byte 1 0
+align 1
+LABELV $1169
+byte 1 66
+byte 1 79
+byte 1 84
+byte 1 76
+byte 1 73
+byte 1 66
+byte 1 95
+byte 1 71
+byte 1 84
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 0
+align 1
+LABELV $1166
+byte 1 66
+byte 1 79
+byte 1 84
+byte 1 76
+byte 1 73
+byte 1 66
+byte 1 95
+byte 1 71
+byte 1 84
+byte 1 95
+byte 1 83
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 76
+byte 1 69
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $1165
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $1160
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $1157
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 95
+byte 1 97
+byte 1 97
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 107
+byte 1 115
+byte 1 0
+align 1
+LABELV $1154
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 67
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 115
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $1153
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $1152
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $1095
+byte 1 50
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $1094
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 107
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1090
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 0
+align 1
+LABELV $1089
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 0
+align 1
+LABELV $1085
+byte 1 98
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 108
+byte 1 117
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 108
+byte 1 117
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $1084
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 100
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $1083
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 100
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $1066
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $1061
+byte 1 114
+byte 1 111
+byte 1 97
+byte 1 109
+byte 1 102
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1059
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 0
+align 1
+LABELV $1057
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 115
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $1056
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 111
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 0
+align 1
+LABELV $1055
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 111
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 0
+align 1
+LABELV $1051
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 0
+align 1
+LABELV $1050
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 0
+align 1
+LABELV $1046
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $1045
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $1035
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $1034
+byte 1 48
+byte 1 0
+align 1
+LABELV $1033
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 119
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $988
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 107
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $984
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 107
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $980
+byte 1 37
+byte 1 51
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 45
+byte 1 49
+byte 1 54
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 54
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 57
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 57
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 57
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $972
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 107
+byte 1 115
+byte 1 32
+byte 1 32
+byte 1 97
+byte 1 118
+byte 1 103
+byte 1 32
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $971
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $953
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $887
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $872
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $869
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $866
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 65
+byte 1 73
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 112
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 112
+byte 1 10
+byte 1 0
+align 1
+LABELV $838
+byte 1 99
+byte 1 100
+byte 1 105
+byte 1 0
+align 1
+LABELV $835
+byte 1 115
+byte 1 114
+byte 1 119
+byte 1 99
+byte 1 0
+align 1
+LABELV $832
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 76
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $829
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $826
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $823
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $820
+byte 1 99
+byte 1 115
+byte 1 0
+align 1
+LABELV $817
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 0
+align 1
+LABELV $809
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 65
+byte 1 73
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 112
+byte 1 10
+byte 1 0
+align 1
+LABELV $668
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $660
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $657
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 52
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $651
+byte 1 49
+byte 1 0
+align 1
+LABELV $650
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $643
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $642
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $635
+byte 1 0
+align 1
+LABELV $634
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 119
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $597
+byte 1 110
+byte 1 109
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $594
+byte 1 110
+byte 1 109
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 101
+byte 1 0
+align 1
+LABELV $591
+byte 1 110
+byte 1 109
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $588
+byte 1 110
+byte 1 109
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 100
+byte 1 117
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $585
+byte 1 110
+byte 1 109
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $580
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $579
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $574
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $573
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $572
+byte 1 66
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 0
+align 1
+LABELV $569
+byte 1 66
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $566
+byte 1 66
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $563
+byte 1 66
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 70
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $560
+byte 1 83
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 95
+byte 1 76
+byte 1 84
+byte 1 71
+byte 1 0
+align 1
+LABELV $557
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 95
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 0
+align 1
+LABELV $552
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $551
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $549
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $547
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 101
+byte 1 0
+align 1
+LABELV $545
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $543
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $541
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 0
+align 1
+LABELV $539
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 103
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $537
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 101
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $535
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $533
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $529
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $525
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 114
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $523
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $519
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $517
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $515
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 119
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $513
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 0
+align 1
+LABELV $511
+byte 1 32
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $502
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $501
+byte 1 13
+byte 1 94
+byte 1 49
+byte 1 83
+byte 1 111
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 33
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $493
+byte 1 13
+byte 1 94
+byte 1 49
+byte 1 83
+byte 1 79
+byte 1 76
+byte 1 73
+byte 1 68
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 0
+align 1
+LABELV $492
+byte 1 13
+byte 1 101
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 0
+align 1
+LABELV $390
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 84
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $347
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $346
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $344
+byte 1 94
+byte 1 49
+byte 1 70
+byte 1 97
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $342
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $340
+byte 1 94
+byte 1 51
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $338
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $289
+byte 1 94
+byte 1 49
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 44
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $286
+byte 1 94
+byte 1 49
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $283
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 112
+byte 1 0
+align 1
+LABELV $282
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $280
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 121
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $279
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 121
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $276
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $273
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 107
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $268
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 107
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $263
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 107
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $258
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 101
+byte 1 0
+align 1
+LABELV $253
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $250
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 121
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $246
+byte 1 51
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 121
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $237
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 121
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $234
+byte 1 119
+byte 1 97
+byte 1 121
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $231
+byte 1 119
+byte 1 97
+byte 1 121
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $222
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $218
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $214
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $207
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $200
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $195
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $191
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $187
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 112
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $184
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $177
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $172
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $168
+byte 1 119
+byte 1 97
+byte 1 121
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 107
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $165
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $145
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 107
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $142
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 107
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $107
+byte 1 70
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 87
+byte 1 112
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 44
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 111
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 10
+byte 1 0
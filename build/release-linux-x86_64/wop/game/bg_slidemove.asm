@@ -0,0 +1,1835 @@
+code
+proc PM_ClipToPlanes 112 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $52
+JUMPV
+LABELV $49
+ADDRLP4 56
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 60
+CNSTI4 12
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 52
+ADDRLP4 56
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 56
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ADDRLP4 60
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 56
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 60
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 52
+INDIRF4
+CNSTF4 1036831949
+LTF4 $53
+ADDRGP4 $50
+JUMPV
+LABELV $53
+ADDRLP4 52
+INDIRF4
+NEGF4
+ADDRGP4 pml+108
+INDIRF4
+LEF4 $55
+ADDRGP4 pml+108
+ADDRLP4 52
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $55
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+CNSTI4 12
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTF4 1065361605
+ARGF4
+ADDRGP4 PM_ClipVelocity
+CALLV
+pop
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $59
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 12
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 40
+ARGP4
+CNSTF4 1065361605
+ARGF4
+ADDRGP4 PM_ClipVelocity
+CALLV
+pop
+LABELV $59
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $64
+JUMPV
+LABELV $61
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $65
+ADDRGP4 $62
+JUMPV
+LABELV $65
+ADDRLP4 64
+CNSTI4 12
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 64
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1036831949
+LTF4 $67
+ADDRGP4 $62
+JUMPV
+LABELV $67
+ADDRLP4 4
+ARGP4
+CNSTI4 12
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTF4 1065361605
+ARGF4
+ADDRGP4 PM_ClipVelocity
+CALLV
+pop
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $71
+ADDRLP4 40
+ARGP4
+CNSTI4 12
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 40
+ARGP4
+CNSTF4 1065361605
+ARGF4
+ADDRGP4 PM_ClipVelocity
+CALLV
+pop
+LABELV $71
+ADDRLP4 68
+CNSTI4 12
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 68
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 68
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 0
+LTF4 $73
+ADDRGP4 $62
+JUMPV
+LABELV $73
+ADDRLP4 72
+CNSTI4 12
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 72
+INDIRI4
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 24
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 80
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 84
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 80
+INDIRF4
+ADDRLP4 84
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 24+4
+INDIRF4
+ADDRLP4 84
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 24+8
+INDIRF4
+ADDRLP4 84
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 80
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 24+4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 24+8
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $83
+ADDRLP4 92
+CNSTI4 12
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 92
+INDIRI4
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 24
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 100
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 100
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 24+4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 24+8
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 100
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 40+4
+ADDRLP4 24+4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 40+8
+ADDRLP4 24+8
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+LABELV $83
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $94
+JUMPV
+LABELV $91
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $97
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $95
+LABELV $97
+ADDRGP4 $92
+JUMPV
+LABELV $95
+ADDRLP4 96
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 96
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 96
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 96
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1036831949
+LTF4 $98
+ADDRGP4 $92
+JUMPV
+LABELV $98
+CNSTI4 0
+RETI4
+ADDRGP4 $48
+JUMPV
+LABELV $92
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $94
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $91
+LABELV $62
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $64
+ADDRLP4 16
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $61
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $51
+ADDRFP4 8
+INDIRP4
+ADDRLP4 40
+INDIRB
+ASGNB 12
+ADDRGP4 $51
+JUMPV
+LABELV $50
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $52
+ADDRLP4 20
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $49
+LABELV $51
+CNSTI4 1
+RETI4
+LABELV $48
+endproc PM_ClipToPlanes 112 16
+export PM_SlideMove
+proc PM_SlideMove 220 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 156
+CNSTI4 4
+ASGNI4
+ADDRLP4 160
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $105
+ADDRLP4 172
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 144
+ADDRLP4 172
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 144+8
+ADDRLP4 144+8
+INDIRF4
+ADDRLP4 172
+INDIRP4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 176
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 176
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 176
+INDIRP4
+INDIRF4
+ADDRLP4 144+8
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 160+8
+ADDRLP4 144+8
+INDIRF4
+ASGNF4
+ADDRGP4 pml+48
+INDIRI4
+CNSTI4 0
+EQI4 $112
+ADDRLP4 180
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 180
+INDIRP4
+ARGP4
+ADDRGP4 pml+52+24
+ARGP4
+ADDRLP4 180
+INDIRP4
+ARGP4
+CNSTF4 1065361605
+ARGF4
+ADDRGP4 PM_ClipVelocity
+CALLV
+pop
+LABELV $112
+LABELV $105
+ADDRLP4 124
+ADDRGP4 pml+36
+INDIRF4
+ASGNF4
+ADDRGP4 pml+48
+INDIRI4
+CNSTI4 0
+EQI4 $118
+ADDRLP4 120
+CNSTI4 1
+ASGNI4
+ADDRLP4 60
+ADDRGP4 pml+52+24
+INDIRB
+ASGNB 12
+ADDRGP4 $119
+JUMPV
+LABELV $118
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+LABELV $119
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+CNSTI4 12
+ADDRLP4 120
+INDIRI4
+MULI4
+ADDRLP4 60
+ADDP4
+ARGP4
+ADDRGP4 VectorNormalize2
+CALLF4
+pop
+ADDRLP4 120
+ADDRLP4 120
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRGP4 $126
+JUMPV
+LABELV $123
+ADDRLP4 172
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 176
+ADDRLP4 172
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 128
+ADDRLP4 176
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 176
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 124
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 184
+ADDRLP4 172
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 128+4
+ADDRLP4 184
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 184
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ADDRLP4 124
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 188
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 128+8
+ADDRLP4 188
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 188
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 124
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 192
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 196
+ADDRLP4 192
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 196
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 192
+INDIRP4
+CNSTI4 184
+ADDP4
+ARGP4
+ADDRLP4 192
+INDIRP4
+CNSTI4 196
+ADDP4
+ARGP4
+ADDRLP4 128
+ARGP4
+ADDRLP4 196
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 192
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 192
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $129
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 0
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $104
+JUMPV
+LABELV $129
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 0
+LEF4 $131
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 0+12
+INDIRB
+ASGNB 12
+LABELV $131
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $135
+ADDRGP4 $125
+JUMPV
+LABELV $135
+ADDRLP4 0+52
+INDIRI4
+ARGI4
+ADDRGP4 PM_AddTouchEnt
+CALLV
+pop
+ADDRLP4 124
+ADDRLP4 124
+INDIRF4
+ADDRLP4 124
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 120
+INDIRI4
+CNSTI4 5
+LTI4 $140
+ADDRLP4 204
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 208
+CNSTF4 0
+ASGNF4
+ADDRLP4 204
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 208
+INDIRF4
+ASGNF4
+ADDRLP4 204
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 208
+INDIRF4
+ASGNF4
+ADDRLP4 204
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 208
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $104
+JUMPV
+LABELV $140
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRGP4 $145
+JUMPV
+LABELV $142
+ADDRLP4 204
+CNSTI4 12
+ADDRLP4 56
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 204
+INDIRI4
+ADDRLP4 60
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 204
+INDIRI4
+ADDRLP4 60+4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 204
+INDIRI4
+ADDRLP4 60+8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1065185444
+LEF4 $146
+ADDRLP4 208
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 208
+INDIRP4
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 208
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 212
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 212
+INDIRP4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 212
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 216
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 216
+INDIRP4
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 216
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $144
+JUMPV
+LABELV $146
+LABELV $143
+ADDRLP4 56
+ADDRLP4 56
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $145
+ADDRLP4 56
+INDIRI4
+ADDRLP4 120
+INDIRI4
+LTI4 $142
+LABELV $144
+ADDRLP4 56
+INDIRI4
+ADDRLP4 120
+INDIRI4
+GEI4 $160
+ADDRGP4 $124
+JUMPV
+LABELV $160
+CNSTI4 12
+ADDRLP4 120
+INDIRI4
+MULI4
+ADDRLP4 60
+ADDP4
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRLP4 120
+ADDRLP4 120
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 60
+ARGP4
+ADDRLP4 120
+INDIRI4
+ARGI4
+ADDRLP4 144
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 204
+ADDRGP4 PM_ClipToPlanes
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 0
+NEI4 $163
+ADDRLP4 208
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 212
+CNSTF4 0
+ASGNF4
+ADDRLP4 208
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 212
+INDIRF4
+ASGNF4
+ADDRLP4 208
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 212
+INDIRF4
+ASGNF4
+ADDRLP4 208
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 212
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $104
+JUMPV
+LABELV $163
+LABELV $124
+ADDRLP4 140
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $126
+ADDRLP4 140
+INDIRI4
+ADDRLP4 156
+INDIRI4
+LTI4 $123
+LABELV $125
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $165
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 144
+INDIRB
+ASGNB 12
+LABELV $165
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $167
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 160
+INDIRB
+ASGNB 12
+LABELV $167
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $170
+ADDRLP4 172
+CNSTI4 1
+ASGNI4
+ADDRGP4 $171
+JUMPV
+LABELV $170
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+LABELV $171
+ADDRLP4 172
+INDIRI4
+RETI4
+LABELV $104
+endproc PM_SlideMove 220 28
+export PM_StepSlideMove
+proc PM_StepSlideMove 144 28
+ADDRLP4 112
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 68
+ADDRLP4 112
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 96
+ADDRLP4 112
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 PM_SlideMove
+CALLI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 0
+NEI4 $173
+ADDRGP4 $172
+JUMPV
+LABELV $173
+ADDRLP4 80
+ADDRLP4 68
+INDIRB
+ASGNB 12
+ADDRLP4 80+8
+ADDRLP4 80+8
+INDIRF4
+CNSTF4 1099956224
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRLP4 120
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+CNSTI4 184
+ADDP4
+ARGP4
+ADDRLP4 120
+INDIRP4
+CNSTI4 196
+ADDP4
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRLP4 120
+INDIRP4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 120
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 120
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 124
+CNSTF4 0
+ASGNF4
+ADDRLP4 56
+ADDRLP4 124
+INDIRF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 124
+INDIRF4
+ASGNF4
+ADDRLP4 56+8
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+CNSTF4 0
+LEF4 $178
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+EQF4 $188
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 56+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 56+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1060320051
+GEF4 $178
+LABELV $188
+ADDRGP4 $172
+JUMPV
+LABELV $178
+ADDRLP4 56
+ADDRLP4 68
+INDIRB
+ASGNB 12
+ADDRLP4 56+8
+ADDRLP4 56+8
+INDIRF4
+CNSTF4 1099956224
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRLP4 128
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+CNSTI4 184
+ADDP4
+ARGP4
+ADDRLP4 128
+INDIRP4
+CNSTI4 196
+ADDP4
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 128
+INDIRP4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 128
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 128
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $190
+ADDRGP4 pm
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $172
+ADDRGP4 $194
+ARGP4
+ADDRGP4 c_pmove
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $172
+JUMPV
+LABELV $190
+ADDRLP4 108
+ADDRLP4 0+12+8
+INDIRF4
+ADDRLP4 68+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 0+12
+INDIRB
+ASGNB 12
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 96
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 PM_SlideMove
+CALLI4
+pop
+ADDRLP4 80
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 80+8
+ADDRLP4 80+8
+INDIRF4
+ADDRLP4 108
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 132
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 136
+ADDRLP4 132
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 136
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 132
+INDIRP4
+CNSTI4 184
+ADDP4
+ARGP4
+ADDRLP4 132
+INDIRP4
+CNSTI4 196
+ADDP4
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRLP4 136
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 132
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 132
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $200
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 0+12
+INDIRB
+ASGNB 12
+LABELV $200
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $203
+ADDRLP4 140
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 0+24
+ARGP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+CNSTF4 1065361605
+ARGF4
+ADDRGP4 PM_ClipVelocity
+CALLV
+pop
+LABELV $203
+ADDRLP4 92
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 68+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 92
+INDIRF4
+CNSTF4 1073741824
+LEF4 $208
+ADDRLP4 92
+INDIRF4
+CNSTF4 1088421888
+GEF4 $210
+CNSTI4 6
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 $211
+JUMPV
+LABELV $210
+ADDRLP4 92
+INDIRF4
+CNSTF4 1093664768
+GEF4 $212
+CNSTI4 7
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 $213
+JUMPV
+LABELV $212
+ADDRLP4 92
+INDIRF4
+CNSTF4 1097859072
+GEF4 $214
+CNSTI4 8
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 $215
+JUMPV
+LABELV $214
+CNSTI4 9
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+LABELV $215
+LABELV $213
+LABELV $211
+LABELV $208
+ADDRGP4 pm
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $216
+ADDRGP4 $218
+ARGP4
+ADDRGP4 c_pmove
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $216
+LABELV $172
+endproc PM_StepSlideMove 144 28
+import PM_AddEvent
+import PM_AddTouchEnt
+import PM_ClipVelocity
+import c_pmove
+import pm_flightfriction
+import pm_waterfriction
+import pm_friction
+import pm_flyaccelerate
+import pm_wateraccelerate
+import pm_airaccelerate
+import pm_accelerate
+import pm_swimScale
+import pm_duckScale
+import pm_stopspeed
+import pml
+import pm
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $218
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $194
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 98
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 10
+byte 1 0
@@ -0,0 +1,5824 @@
+code
+proc P_DamageFeedback 36 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $62
+ADDRGP4 $61
+JUMPV
+LABELV $62
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+NEF4 $64
+ADDRGP4 $61
+JUMPV
+LABELV $64
+ADDRLP4 4
+INDIRF4
+CNSTF4 1132396544
+LEF4 $66
+ADDRLP4 4
+CNSTF4 1132396544
+ASGNF4
+LABELV $66
+ADDRLP4 0
+INDIRP4
+CNSTI4 800
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $68
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+CNSTI4 255
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+CNSTI4 255
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 800
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $69
+JUMPV
+LABELV $68
+ADDRLP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+CNSTF4 1132462080
+ADDRLP4 8
+INDIRF4
+CNSTF4 1135869952
+DIVF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+CNSTF4 1132462080
+ADDRLP4 8+4
+INDIRF4
+CNSTF4 1135869952
+DIVF4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $69
+ADDRGP4 level+68
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+LEI4 $71
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+NEI4 $71
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 700
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 61
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $71
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $61
+endproc P_DamageFeedback 36 12
+proc P_WorldEffects 40 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 696
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $76
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 852
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 12000
+ADDI4
+ASGNI4
+ADDRGP4 $75
+JUMPV
+LABELV $76
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 800
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 320
+ADDP4
+INDIRI4
+ADDRGP4 level+68
+INDIRI4
+LEI4 $81
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $82
+JUMPV
+LABELV $81
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $82
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $83
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $85
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 852
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 10000
+ADDI4
+ASGNI4
+LABELV $85
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 852
+ADDP4
+INDIRI4
+ADDRGP4 level+68
+INDIRI4
+GEI4 $84
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 852
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1000
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $84
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 752
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 752
+ADDP4
+INDIRI4
+CNSTI4 15
+LEI4 $93
+ADDRFP4 0
+INDIRP4
+CNSTI4 752
+ADDP4
+CNSTI4 15
+ASGNI4
+LABELV $93
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 752
+ADDP4
+INDIRI4
+GTI4 $95
+ADDRGP4 $97
+ARGP4
+ADDRLP4 28
+ADDRGP4 G_SoundIndex
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 G_Sound
+CALLV
+pop
+LABELV $95
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 200
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+CNSTP4 0
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+CNSTP4 0
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 752
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+ADDRGP4 $84
+JUMPV
+LABELV $83
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 852
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 12000
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 752
+ADDP4
+CNSTI4 2
+ASGNI4
+LABELV $84
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $100
+ADDRFP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+INDIRI4
+CNSTI4 24
+BANDI4
+ADDRLP4 16
+INDIRI4
+EQI4 $100
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $102
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+ADDRGP4 level+68
+INDIRI4
+GTI4 $102
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $105
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 67
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRGP4 $106
+JUMPV
+LABELV $105
+ADDRFP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $107
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+CNSTP4 0
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+CNSTI4 30
+ADDRLP4 0
+INDIRI4
+MULI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 18
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+LABELV $107
+ADDRFP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $109
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+CNSTP4 0
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+CNSTI4 10
+ADDRLP4 0
+INDIRI4
+MULI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 17
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+LABELV $109
+LABELV $106
+LABELV $102
+LABELV $100
+LABELV $75
+endproc P_WorldEffects 40 32
+export G_SetClientSound
+proc G_SetClientSound 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 800
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $112
+ADDRFP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+INDIRI4
+CNSTI4 24
+BANDI4
+ADDRLP4 4
+INDIRI4
+EQI4 $112
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 444
+ADDP4
+ADDRGP4 level+388
+INDIRI4
+ASGNI4
+ADDRGP4 $113
+JUMPV
+LABELV $112
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 444
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $113
+LABELV $111
+endproc G_SetClientSound 8 0
+export ClientImpacts
+proc ClientImpacts 76 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 56
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $119
+JUMPV
+LABELV $116
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $123
+JUMPV
+LABELV $120
+ADDRLP4 68
+CNSTI4 2
+ASGNI4
+ADDRLP4 72
+ADDRFP4 4
+INDIRP4
+CNSTI4 56
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LSHI4
+ADDRLP4 72
+INDIRP4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LSHI4
+ADDRLP4 72
+INDIRP4
+ADDP4
+INDIRI4
+NEI4 $124
+ADDRGP4 $122
+JUMPV
+LABELV $124
+LABELV $121
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $123
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $120
+LABELV $122
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $126
+ADDRGP4 $117
+JUMPV
+LABELV $126
+ADDRLP4 8
+CNSTI4 832
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $128
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $128
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $128
+ADDRLP4 8
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $130
+ADDRGP4 $117
+JUMPV
+LABELV $130
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $117
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $119
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+LTI4 $116
+LABELV $115
+endproc ClientImpacts 76 12
+data
+align 4
+LABELV $133
+byte 4 1109393408
+byte 4 1109393408
+byte 4 1112539136
+export G_TouchTriggers
+code
+proc G_TouchTriggers 4304 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $134
+ADDRGP4 $132
+JUMPV
+LABELV $134
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $136
+ADDRGP4 $132
+JUMPV
+LABELV $136
+ADDRLP4 4188
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 4188
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRGP4 $133
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 64+4
+ADDRLP4 4188
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRGP4 $133+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 64+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRGP4 $133+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4192
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 4192
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRGP4 $133
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 76+4
+ADDRLP4 4192
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRGP4 $133+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 76+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRGP4 $133+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4268
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ASGNP4
+ADDRLP4 4272
+ADDRLP4 4268
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4196
+ADDRLP4 4272
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 4272
+INDIRP4
+CNSTI4 764
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4276
+ADDRLP4 4268
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4196+4
+ADDRLP4 4276
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 4276
+INDIRP4
+CNSTI4 768
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4280
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4196+8
+ADDRLP4 4280
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 4280
+INDIRP4
+CNSTI4 772
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4196
+ARGP4
+ADDRLP4 4284
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 4264
+ADDRLP4 4284
+INDIRF4
+ASGNF4
+ADDRLP4 4264
+INDIRF4
+CNSTF4 1170735104
+LTF4 $148
+ADDRLP4 4208
+ARGP4
+ADDRLP4 4292
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4292
+INDIRP4
+CNSTI4 764
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+ARGP4
+ADDRLP4 4292
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+CNSTI4 1022
+ARGI4
+CNSTU4 4294967295
+CVUI4 4
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 4208+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $150
+CNSTI4 832
+ADDRLP4 4208+52
+INDIRI4
+MULI4
+ADDRGP4 g_entities+4
+ADDP4
+INDIRI4
+CNSTI4 9
+NEI4 $150
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 56
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTI4 832
+ADDRLP4 4208+52
+INDIRI4
+MULI4
+ADDRGP4 g_entities+716
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $155
+ADDRLP4 4296
+CNSTI4 832
+ASGNI4
+ADDRLP4 4296
+INDIRI4
+ADDRLP4 4208+52
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 4296
+INDIRI4
+ADDRLP4 4208+52
+INDIRI4
+MULI4
+ADDRGP4 g_entities+716
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $155
+ADDRFP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $162
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $162
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 832
+ADDRLP4 4208+52
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $162
+ADDRLP4 4300
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4300
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRI4
+ADDRLP4 4300
+INDIRP4
+CNSTI4 456
+ADDP4
+INDIRI4
+EQI4 $132
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 460
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 448
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $132
+JUMPV
+LABELV $150
+LABELV $148
+ADDRLP4 64
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 92
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 4196
+ADDRGP4 trap_EntitiesInBox
+CALLI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 4196
+INDIRI4
+ASGNI4
+ADDRLP4 4204
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 4204
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64+4
+ADDRLP4 4204
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4216
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 4216
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 76+4
+ADDRLP4 4216
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 76+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 456
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $174
+JUMPV
+LABELV $171
+ADDRLP4 0
+CNSTI4 832
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 92
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4224
+CNSTI4 716
+ASGNI4
+ADDRLP4 4228
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4224
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 4228
+INDIRU4
+NEU4 $175
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4224
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 4228
+INDIRU4
+NEU4 $175
+ADDRGP4 $172
+JUMPV
+LABELV $175
+ADDRLP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRI4
+CNSTI4 1073741824
+BANDI4
+CNSTI4 0
+NEI4 $177
+ADDRGP4 $172
+JUMPV
+LABELV $177
+ADDRLP4 4232
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4232
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $182
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $179
+ADDRLP4 4232
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $179
+LABELV $182
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 9
+EQI4 $183
+ADDRLP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 Touch_DoorTrigger
+CVPU4 4
+EQU4 $183
+ADDRGP4 $172
+JUMPV
+LABELV $183
+LABELV $179
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $185
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 level+68
+INDIRI4
+ARGI4
+ADDRLP4 4236
+ADDRGP4 BG_PlayerTouchesItem
+CALLI4
+ASGNI4
+ADDRLP4 4236
+INDIRI4
+CNSTI4 0
+NEI4 $186
+ADDRGP4 $172
+JUMPV
+LABELV $185
+ADDRLP4 64
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4236
+ADDRGP4 trap_EntityContact
+CALLI4
+ASGNI4
+ADDRLP4 4236
+INDIRI4
+CNSTI4 0
+NEI4 $190
+ADDRGP4 $172
+JUMPV
+LABELV $190
+LABELV $186
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 56
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $192
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $192
+ADDRFP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $194
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $194
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $194
+LABELV $172
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $174
+ADDRLP4 4
+INDIRI4
+ADDRLP4 88
+INDIRI4
+LTI4 $171
+ADDRLP4 4224
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4224
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRI4
+ADDRLP4 4224
+INDIRP4
+CNSTI4 456
+ADDP4
+INDIRI4
+EQI4 $196
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 460
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 448
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $196
+LABELV $132
+endproc G_TouchTriggers 4304 28
+export SpectatorThink
+proc SpectatorThink 268 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $199
+ADDRLP4 0
+INDIRP4
+CNSTI4 696
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $201
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $202
+JUMPV
+LABELV $201
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 2
+ASGNI4
+LABELV $202
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 400
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 236
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4+4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 24
+ADDRLP4 4+28
+CNSTI4 65537
+ASGNI4
+ADDRLP4 4+228
+ADDRGP4 trap_Trace
+ASGNP4
+ADDRLP4 4+232
+ADDRGP4 trap_PointContents
+ASGNP4
+ADDRLP4 4+48
+ADDRGP4 g_gametype+12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Pmove
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_TouchTriggers
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+LABELV $199
+ADDRLP4 0
+INDIRP4
+CNSTI4 756
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 752
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 752
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 level+68
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 820
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 10000
+GEI4 $209
+ADDRGP4 $198
+JUMPV
+LABELV $209
+ADDRLP4 248
+CNSTI4 1
+ASGNI4
+ADDRLP4 252
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 752
+ADDP4
+INDIRI4
+ADDRLP4 248
+INDIRI4
+BANDI4
+ADDRLP4 252
+INDIRI4
+EQI4 $212
+ADDRLP4 0
+INDIRP4
+CNSTI4 756
+ADDP4
+INDIRI4
+ADDRLP4 248
+INDIRI4
+BANDI4
+ADDRLP4 252
+INDIRI4
+NEI4 $212
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 Cmd_FollowCycle_f
+CALLV
+pop
+LABELV $212
+ADDRLP4 260
+CNSTI4 4
+ASGNI4
+ADDRLP4 264
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 752
+ADDP4
+INDIRI4
+ADDRLP4 260
+INDIRI4
+BANDI4
+ADDRLP4 264
+INDIRI4
+EQI4 $214
+ADDRLP4 0
+INDIRP4
+CNSTI4 756
+ADDP4
+INDIRI4
+ADDRLP4 260
+INDIRI4
+BANDI4
+ADDRLP4 264
+INDIRI4
+NEI4 $214
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 StopFollowing
+CALLV
+pop
+LABELV $214
+LABELV $198
+endproc SpectatorThink 268 12
+export ClientInactivityTimer
+proc ClientInactivityTimer 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 g_inactivity+12
+INDIRI4
+CNSTI4 0
+NEI4 $217
+ADDRFP4 0
+INDIRP4
+CNSTI4 840
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 60000
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 844
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $218
+JUMPV
+LABELV $217
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 493
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 4
+INDIRI4
+NEI4 $225
+ADDRFP4 0
+INDIRP4
+CNSTI4 494
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 4
+INDIRI4
+NEI4 $225
+ADDRFP4 0
+INDIRP4
+CNSTI4 495
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 4
+INDIRI4
+NEI4 $225
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 4
+INDIRI4
+EQI4 $221
+LABELV $225
+ADDRFP4 0
+INDIRP4
+CNSTI4 840
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 1000
+ADDRGP4 g_inactivity+12
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 844
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $222
+JUMPV
+LABELV $221
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $228
+ADDRGP4 level+68
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 840
+ADDP4
+INDIRI4
+LEI4 $230
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 level
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 956
+DIVI4
+ARGI4
+ADDRGP4 $233
+ARGP4
+ADDRGP4 trap_DropClient
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $216
+JUMPV
+LABELV $230
+ADDRGP4 level+68
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 840
+ADDP4
+INDIRI4
+CNSTI4 10000
+SUBI4
+LEI4 $234
+ADDRFP4 0
+INDIRP4
+CNSTI4 844
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $234
+ADDRFP4 0
+INDIRP4
+CNSTI4 844
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 level
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 956
+DIVI4
+ARGI4
+ADDRGP4 $237
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $234
+LABELV $228
+LABELV $222
+LABELV $218
+CNSTI4 1
+RETI4
+LABELV $216
+endproc ClientInactivityTimer 12 8
+export ClientTimerActions
+proc ClientTimerActions 20 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 872
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $240
+JUMPV
+LABELV $239
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 872
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1000
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 336
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $242
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+GEI4 $244
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 15
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1066192077
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+LEF4 $246
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+CNSTF4 1066192077
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $246
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 66
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRGP4 $243
+JUMPV
+LABELV $244
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+GEI4 $243
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 5
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+LEI4 $250
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ASGNI4
+LABELV $250
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 66
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRGP4 $243
+JUMPV
+LABELV $242
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+LEI4 $252
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $252
+LABELV $243
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+LEI4 $254
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $254
+LABELV $240
+ADDRLP4 0
+INDIRP4
+CNSTI4 872
+ADDP4
+INDIRI4
+CNSTI4 1000
+GEI4 $239
+LABELV $238
+endproc ClientTimerActions 20 12
+export ClientIntermissionThink
+proc ClientIntermissionThink 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 -4097
+BANDI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -257
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 756
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 752
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 752
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 752
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 5
+BANDI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 756
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+BXORI4
+BANDI4
+CNSTI4 0
+EQI4 $257
+ADDRFP4 0
+INDIRP4
+CNSTI4 692
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $257
+LABELV $256
+endproc ClientIntermissionThink 24 0
+export ClientEvents
+proc ClientEvents 124 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 2
+SUBI4
+GEI4 $260
+ADDRFP4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+LABELV $260
+ADDRLP4 0
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $265
+JUMPV
+LABELV $262
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 11
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $267
+ADDRLP4 4
+INDIRI4
+CNSTI4 12
+EQI4 $267
+ADDRLP4 4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LTI4 $267
+LABELV $305
+ADDRLP4 4
+INDIRI4
+CNSTI4 23
+LTI4 $267
+ADDRLP4 4
+INDIRI4
+CNSTI4 31
+GTI4 $267
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $306-92
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $306
+address $269
+address $270
+address $267
+address $271
+address $281
+address $282
+address $286
+address $287
+address $296
+code
+LABELV $269
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 FireWeapon
+CALLV
+pop
+ADDRGP4 $267
+JUMPV
+LABELV $270
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 explode_imperius
+CALLP4
+pop
+ADDRGP4 $267
+JUMPV
+LABELV $271
+ADDRLP4 12
+CNSTP4 0
+ASGNP4
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 344
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $272
+CNSTI4 8
+ARGI4
+ADDRLP4 64
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 64
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 8
+ASGNI4
+ADDRGP4 $273
+JUMPV
+LABELV $272
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $274
+CNSTI4 9
+ARGI4
+ADDRLP4 64
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 64
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 9
+ASGNI4
+LABELV $274
+LABELV $273
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $276
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 64
+ADDRGP4 Drop_Item
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 64
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 772
+ADDP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+ADDRGP4 level+68
+INDIRI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 44
+INDIRP4
+CNSTI4 772
+ADDP4
+INDIRI4
+CNSTI4 1
+GEI4 $279
+ADDRLP4 44
+INDIRP4
+CNSTI4 772
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $279
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $276
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 32
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 SelectSpawnPoint
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRGP4 TeleportPlayer
+CALLV
+pop
+ADDRGP4 $267
+JUMPV
+LABELV $281
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 25
+ADDI4
+ASGNI4
+ADDRGP4 $267
+JUMPV
+LABELV $282
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+CNSTF4 1140850688
+GEF4 $267
+ADDRGP4 $285
+ARGP4
+ADDRLP4 68
+ADDRGP4 G_GetCvarInt
+CALLI4
+ASGNI4
+ADDRLP4 72
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRF4
+CNSTF4 1147207680
+CNSTF4 1065353216
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $267
+JUMPV
+LABELV $286
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 152
+ADDP4
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 100
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 100
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRGP4 CalcMuzzlePoint
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRGP4 fire_duck
+CALLP4
+pop
+ADDRGP4 $267
+JUMPV
+LABELV $287
+CNSTI4 5
+ARGI4
+ADDRLP4 80
+ADDRGP4 BG_FindItemForHoldable
+CALLP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $288
+ADDRLP4 8
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $290
+ADDRGP4 $292
+ARGP4
+ADDRLP4 76
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $267
+JUMPV
+LABELV $290
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 bambam_createByPlayer
+CALLI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+EQI4 $267
+ADDRLP4 8
+INDIRP4
+CNSTI4 212
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $267
+JUMPV
+LABELV $288
+ADDRGP4 $295
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $267
+JUMPV
+LABELV $296
+CNSTI4 6
+ARGI4
+ADDRLP4 80
+ADDRGP4 BG_FindItemForHoldable
+CALLP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $297
+ADDRLP4 8
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $299
+ADDRGP4 $292
+ARGP4
+ADDRLP4 76
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $267
+JUMPV
+LABELV $299
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 boomies_createByPlayer
+CALLI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+EQI4 $267
+ADDRLP4 88
+ADDRLP4 8
+INDIRP4
+CNSTI4 212
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $267
+ADDRLP4 92
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 92
+INDIRP4
+INDIRI4
+CNSTI4 1024
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 212
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $267
+JUMPV
+LABELV $297
+ADDRGP4 $295
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $267
+LABELV $263
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $265
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+LTI4 $262
+LABELV $259
+endproc ClientEvents 124 20
+export SendPendingPredictableEvents
+proc SendPendingPredictableEvents 56 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+GEI4 $309
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 8
+LSHI4
+BORI4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 32
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityState
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+ADDRLP4 48
+CNSTI4 140
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 2048
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 428
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $309
+LABELV $308
+endproc SendPendingPredictableEvents 56 12
+export ClientThink_real
+proc ClientThink_real 340 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $312
+ADDRGP4 $311
+JUMPV
+LABELV $312
+ADDRLP4 240
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 472
+ADDP4
+ASGNP4
+ADDRLP4 240
+INDIRP4
+INDIRI4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 200
+ADDI4
+LEI4 $314
+ADDRLP4 240
+INDIRP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 200
+ADDI4
+ASGNI4
+LABELV $314
+ADDRLP4 240
+INDIRP4
+INDIRI4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 1000
+SUBI4
+GEI4 $318
+ADDRLP4 240
+INDIRP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 1000
+SUBI4
+ASGNI4
+LABELV $318
+ADDRLP4 244
+ADDRLP4 240
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 244
+INDIRI4
+CNSTI4 1
+GEI4 $322
+ADDRLP4 0
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $322
+ADDRGP4 $311
+JUMPV
+LABELV $322
+ADDRLP4 244
+INDIRI4
+CNSTI4 200
+LEI4 $324
+ADDRLP4 244
+CNSTI4 200
+ASGNI4
+LABELV $324
+ADDRGP4 pmove_msec+12
+INDIRI4
+CNSTI4 8
+GEI4 $326
+ADDRGP4 $329
+ARGP4
+ADDRGP4 $330
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 pmove_msec
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 $327
+JUMPV
+LABELV $326
+ADDRGP4 pmove_msec+12
+INDIRI4
+CNSTI4 33
+LEI4 $331
+ADDRGP4 $329
+ARGP4
+ADDRGP4 $334
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 pmove_msec
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+LABELV $331
+LABELV $327
+ADDRLP4 252
+CNSTI4 0
+ASGNI4
+ADDRGP4 pmove_fixed+12
+INDIRI4
+ADDRLP4 252
+INDIRI4
+NEI4 $338
+ADDRLP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+ADDRLP4 252
+INDIRI4
+EQI4 $335
+LABELV $338
+ADDRLP4 240
+INDIRP4
+ADDRLP4 240
+INDIRP4
+INDIRI4
+ADDRGP4 pmove_msec+12
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+ADDRGP4 pmove_msec+12
+INDIRI4
+DIVI4
+ADDRGP4 pmove_msec+12
+INDIRI4
+MULI4
+ASGNI4
+LABELV $335
+ADDRGP4 level+9168
+INDIRI4
+CNSTI4 0
+EQI4 $342
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ClientIntermissionThink
+CALLV
+pop
+ADDRGP4 $311
+JUMPV
+LABELV $342
+ADDRLP4 260
+CNSTI4 4096
+ASGNI4
+ADDRLP4 264
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 752
+ADDP4
+INDIRI4
+ADDRLP4 260
+INDIRI4
+BANDI4
+ADDRLP4 264
+INDIRI4
+EQI4 $345
+ADDRLP4 0
+INDIRP4
+CNSTI4 756
+ADDP4
+INDIRI4
+ADDRLP4 260
+INDIRI4
+BANDI4
+ADDRLP4 264
+INDIRI4
+NEI4 $345
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_DropCartridge_f
+CALLV
+pop
+LABELV $345
+ADDRLP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $350
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $347
+ADDRLP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $347
+LABELV $350
+ADDRLP4 0
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $351
+ADDRGP4 $311
+JUMPV
+LABELV $351
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 240
+INDIRP4
+ARGP4
+ADDRGP4 SpectatorThink
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 764
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $311
+JUMPV
+LABELV $347
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 272
+ADDRGP4 ClientInactivityTimer
+CALLI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+NEI4 $353
+ADDRGP4 $311
+JUMPV
+LABELV $353
+ADDRGP4 level+68
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 848
+ADDP4
+INDIRI4
+LEI4 $355
+ADDRLP4 276
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 276
+INDIRP4
+ADDRLP4 276
+INDIRP4
+INDIRI4
+CNSTI4 -6522953
+BANDI4
+ASGNI4
+LABELV $355
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 30
+GTI4 $358
+ADDRLP4 276
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 276
+INDIRP4
+ADDRLP4 276
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRGP4 $359
+JUMPV
+LABELV $358
+ADDRLP4 280
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 280
+INDIRP4
+ADDRLP4 280
+INDIRP4
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+LABELV $359
+ADDRLP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 696
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $360
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $361
+JUMPV
+LABELV $360
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $362
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $363
+JUMPV
+LABELV $362
+ADDRLP4 284
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 284
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 284
+INDIRI4
+EQI4 $364
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $364
+LABELV $363
+LABELV $361
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRGP4 g_gravity+8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRGP4 g_speed+8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+EQI4 $372
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 7
+NEI4 $368
+LABELV $372
+ADDRLP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $368
+ADDRGP4 $369
+JUMPV
+LABELV $368
+ADDRLP4 0
+INDIRP4
+CNSTI4 316
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $373
+ADDRLP4 288
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+ADDRLP4 288
+INDIRP4
+CNSTF4 1073741824
+ADDRLP4 288
+INDIRP4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $374
+JUMPV
+LABELV $373
+ADDRLP4 0
+INDIRP4
+CNSTI4 340
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $375
+ADDRLP4 292
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+ADDRLP4 292
+INDIRP4
+CNSTF4 1069547520
+ADDRLP4 292
+INDIRP4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $376
+JUMPV
+LABELV $375
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $377
+ADDRLP4 296
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+ADDRLP4 296
+INDIRP4
+CNSTF4 1067869798
+ADDRLP4 296
+INDIRP4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $377
+LABELV $376
+LABELV $374
+LABELV $369
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 11
+NEI4 $379
+ADDRLP4 0
+INDIRP4
+CNSTI4 864
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $379
+ADDRLP4 240
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $379
+ADDRLP4 0
+INDIRP4
+CNSTI4 864
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Weapon_HookFree
+CALLV
+pop
+LABELV $379
+ADDRLP4 248
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 236
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 300
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ADDRLP4 300
+INDIRI4
+NEI4 $381
+ADDRLP4 304
+ADDRLP4 240
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 308
+CNSTI4 0
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 308
+INDIRI4
+NEI4 $381
+ADDRLP4 304
+INDIRI4
+ADDRLP4 300
+INDIRI4
+BANDI4
+ADDRLP4 308
+INDIRI4
+EQI4 $381
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ADDRLP4 308
+INDIRI4
+GTI4 $381
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+EQI4 $386
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 7
+NEI4 $385
+LABELV $386
+ADDRLP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $381
+LABELV $385
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 312
+ADDRGP4 CheckGauntletAttack
+CALLI4
+ASGNI4
+ADDRLP4 4+40
+ADDRLP4 312
+INDIRI4
+ASGNI4
+LABELV $381
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 32768
+BANDI4
+CNSTI4 0
+EQI4 $388
+ADDRLP4 312
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ASGNP4
+ADDRLP4 312
+INDIRP4
+ADDRLP4 312
+INDIRP4
+INDIRI4
+CNSTI4 -32769
+BANDI4
+ASGNI4
+ADDRLP4 316
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 488
+ADDP4
+ASGNP4
+ADDRLP4 316
+INDIRP4
+ADDRLP4 316
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $388
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4+4
+ADDRLP4 240
+INDIRP4
+INDIRB
+ASGNB 24
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $391
+ADDRLP4 4+28
+CNSTI4 65537
+ASGNI4
+ADDRGP4 $392
+JUMPV
+LABELV $391
+ADDRFP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $394
+ADDRLP4 4+28
+CNSTI4 37814273
+ASGNI4
+ADDRGP4 $395
+JUMPV
+LABELV $394
+ADDRLP4 4+28
+CNSTI4 33619969
+ASGNI4
+LABELV $395
+LABELV $392
+ADDRLP4 4+228
+ADDRGP4 trap_Trace
+ASGNP4
+ADDRLP4 4+232
+ADDRGP4 trap_PointContents
+ASGNP4
+ADDRLP4 4+32
+ADDRGP4 g_debugMove+12
+INDIRI4
+ASGNI4
+ADDRGP4 g_dmflags+12
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+LEI4 $405
+ADDRLP4 312
+CNSTI4 1
+ASGNI4
+ADDRGP4 $406
+JUMPV
+LABELV $405
+ADDRLP4 312
+CNSTI4 0
+ASGNI4
+LABELV $406
+ADDRLP4 4+36
+ADDRLP4 312
+INDIRI4
+ASGNI4
+ADDRLP4 4+220
+ADDRGP4 pmove_fixed+12
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+BORI4
+ASGNI4
+ADDRLP4 4+224
+ADDRGP4 pmove_msec+12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 764
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 4+48
+ADDRGP4 g_gametype+12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Pmove
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ADDRLP4 248
+INDIRI4
+EQI4 $413
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+LABELV $413
+ADDRGP4 g_smoothClients+12
+INDIRI4
+CNSTI4 0
+EQI4 $416
+ADDRLP4 324
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 324
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 324
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityStateExtraPolate
+CALLV
+pop
+ADDRGP4 $417
+JUMPV
+LABELV $416
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityState
+CALLV
+pop
+LABELV $417
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 SendPendingPredictableEvents
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+NEI4 $419
+ADDRLP4 0
+INDIRP4
+CNSTI4 860
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $419
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ADDRLP4 4+184
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+ADDRLP4 4+196
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 800
+ADDP4
+ADDRLP4 4+212
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+ADDRLP4 4+208
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 248
+INDIRI4
+ARGI4
+ADDRGP4 ClientEvents
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 696
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $425
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_TouchTriggers
+CALLV
+pop
+LABELV $425
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+ADDRGP4 BotTestAAS
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 ClientImpacts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ADDRLP4 248
+INDIRI4
+EQI4 $427
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+LABELV $427
+ADDRLP4 0
+INDIRP4
+CNSTI4 756
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 752
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 752
+ADDP4
+ADDRLP4 240
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 336
+ADDRLP4 0
+INDIRP4
+CNSTI4 760
+ADDP4
+ASGNP4
+ADDRLP4 336
+INDIRP4
+ADDRLP4 336
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 752
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 756
+ADDP4
+INDIRI4
+BCOMI4
+BANDI4
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $430
+ADDRGP4 level+68
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 836
+ADDP4
+INDIRI4
+LEI4 $311
+ADDRGP4 g_forcerespawn+12
+INDIRI4
+CNSTI4 0
+LEI4 $435
+ADDRGP4 level+68
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 836
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 1000
+ADDRGP4 g_forcerespawn+12
+INDIRI4
+MULI4
+LEI4 $435
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 respawn
+CALLV
+pop
+ADDRGP4 $311
+JUMPV
+LABELV $435
+ADDRLP4 240
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 5
+BANDI4
+CNSTI4 0
+EQI4 $311
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 respawn
+CALLV
+pop
+ADDRGP4 $311
+JUMPV
+LABELV $430
+ADDRLP4 4+212
+INDIRI4
+CNSTI4 1
+GTI4 $442
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1023
+EQI4 $442
+ADDRLP4 0
+INDIRP4
+CNSTI4 884
+ADDP4
+INDIRI4
+CNSTI4 500
+ADDI4
+ADDRGP4 level+68
+INDIRI4
+LEI4 $442
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+NEI4 $446
+ADDRLP4 0
+INDIRP4
+CNSTI4 880
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $446
+LABELV $442
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 244
+INDIRI4
+ARGI4
+ADDRGP4 ClientTimerActions
+CALLV
+pop
+LABELV $311
+endproc ClientThink_real 340 16
+export ClientThink
+proc ClientThink 12 8
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 832
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 472
+ADDP4
+ARGP4
+ADDRGP4 trap_GetUsercmd
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 748
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 8
+INDIRI4
+NEI4 $450
+ADDRGP4 g_synchronousClients+12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $450
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ClientThink_real
+CALLV
+pop
+LABELV $450
+LABELV $448
+endproc ClientThink 12 8
+export ClientThinkBatch
+proc ClientThinkBatch 792 12
+ADDRLP4 780
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 832
+ADDRLP4 780
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 780
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 784
+ADDRGP4 trap_GetUsercmds
+CALLI4
+ASGNI4
+ADDRLP4 776
+ADDRLP4 784
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $457
+JUMPV
+LABELV $454
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $458
+ADDRGP4 $456
+JUMPV
+LABELV $458
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 472
+ADDP4
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+ADDP4
+INDIRB
+ASGNB 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 748
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+ADDRLP4 788
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 788
+INDIRI4
+NEI4 $461
+ADDRGP4 g_synchronousClients+12
+INDIRI4
+ADDRLP4 788
+INDIRI4
+NEI4 $461
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ClientThink_real
+CALLV
+pop
+LABELV $461
+LABELV $455
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $457
+ADDRLP4 4
+INDIRI4
+ADDRLP4 776
+INDIRI4
+LTI4 $454
+LABELV $456
+LABELV $453
+endproc ClientThinkBatch 792 12
+export G_RunClient
+proc G_RunClient 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 0
+INDIRI4
+NEI4 $465
+ADDRGP4 g_synchronousClients+12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $465
+ADDRGP4 $464
+JUMPV
+LABELV $465
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 472
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ClientThink_real
+CALLV
+pop
+LABELV $464
+endproc G_RunClient 4 4
+export SpectatorClientEndFrame
+proc SpectatorClientEndFrame 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $470
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 640
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+NEI4 $472
+ADDRLP4 4
+ADDRGP4 level+380
+INDIRI4
+ASGNI4
+ADDRGP4 $473
+JUMPV
+LABELV $472
+ADDRLP4 4
+INDIRI4
+CNSTI4 -2
+NEI4 $475
+ADDRLP4 4
+ADDRGP4 level+384
+INDIRI4
+ASGNI4
+LABELV $475
+LABELV $473
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $478
+ADDRLP4 0
+CNSTI4 956
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $480
+ADDRLP4 12
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $480
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $483
+ADDRLP4 12
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $480
+LABELV $483
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 104
+ASGNI4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 16
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 -540673
+BANDI4
+ADDRLP4 24
+INDIRP4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 540672
+BANDI4
+BORI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRB
+ASGNB 468
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $469
+JUMPV
+LABELV $480
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 640
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $484
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 636
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 level
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 956
+DIVI4
+ARGI4
+ADDRGP4 ClientBegin
+CALLV
+pop
+LABELV $484
+LABELV $478
+LABELV $470
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $486
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 8192
+BORI4
+ASGNI4
+ADDRGP4 $487
+JUMPV
+LABELV $486
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -8193
+BANDI4
+ASGNI4
+LABELV $487
+LABELV $469
+endproc SpectatorClientEndFrame 32 4
+export ClientEndFrame
+proc ClientEndFrame 20 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $492
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $489
+ADDRLP4 4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $489
+LABELV $492
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 SpectatorClientEndFrame
+CALLV
+pop
+ADDRGP4 $488
+JUMPV
+LABELV $489
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $493
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+ADDRGP4 level+68
+INDIRI4
+GEI4 $497
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $497
+LABELV $494
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $493
+ADDRGP4 level+9168
+INDIRI4
+CNSTI4 0
+EQI4 $500
+ADDRGP4 $488
+JUMPV
+LABELV $500
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 P_WorldEffects
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 P_DamageFeedback
+CALLV
+pop
+ADDRGP4 level+68
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 748
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 1000
+LEI4 $503
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 8192
+BORI4
+ASGNI4
+ADDRGP4 $504
+JUMPV
+LABELV $503
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -8193
+BANDI4
+ASGNI4
+LABELV $504
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_SetClientSound
+CALLV
+pop
+ADDRGP4 g_smoothClients+12
+INDIRI4
+CNSTI4 0
+EQI4 $506
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityStateExtraPolate
+CALLV
+pop
+ADDRGP4 $507
+JUMPV
+LABELV $506
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityState
+CALLV
+pop
+LABELV $507
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 SendPendingPredictableEvents
+CALLV
+pop
+LABELV $488
+endproc ClientEndFrame 20 16
+import BotTestSolid
+import trap_AAS_BestReachableArea
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntities
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_RealTime
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_EntitiesInPVS
+import trap_RestoreClients
+import trap_RewindClients
+import trap_GetUsercmds
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_TraceBatch
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import g_logDamage
+import g_modInstagib_WeaponJump
+import g_modInstagib
+import g_transmitSVboastermissiles
+import g_KillerduckHealth
+import g_LPS_flags
+import g_LPS_startlives
+import g_skyLensflare
+import g_sky
+import g_q3Items
+import pmove_msec
+import pmove_fixed
+import g_antilag
+import g_smoothClients
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_curWarmupReady
+import g_warmupReady
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import MapSupportsGametype
+import G_GetArenaInfoByMap
+import G_InitGameinfo
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import AI_RemoveBambam
+import AI_AddBambam
+import AI_RemoveBoomie
+import AI_AddBoomie
+import BotCamViewangles
+import BotCamViewTarget
+import BotCamViewEntitiy
+import BotChooseWeap
+import BotCamFire
+import BotCamTaunt
+import BotCamMoveTo
+import BotCamMode
+import BotInterbreedEndMatch
+import Svcmd_BotStats_f
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_LoadBots
+import CantDamageTeamitem
+import boomies_createByPlayer
+import bambam_createByPlayer
+import IsItemSameTeam
+import Instagib_canSpawnEntity
+import Instagib_isRelevantDamageEvent
+import Instagib_calculateDamage
+import Instagib_getSpawnWeapon
+import Instagib_applyWeaponJumpKnockback
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import PrintMsg
+import CheckObeliskAttack
+import Team_GetFlagStatus
+import Team_CheckDroppedItem
+import OnSameTeam
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogFlush
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import G_GetCvarInt
+import MoveClientToIntermission
+import G_SendScoreboardUpdates
+import DeathmatchScoreboardMessage
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import GetASpawnPosition
+import SelectSpectatorSpawnPoint
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import respawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import Touch_DoorTrigger
+import G_PushablesChanged
+import G_RunMover
+import fire_kma
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_bubbleg
+import fire_bambamMissile
+import fire_duck
+import explode_imperius
+import fire_splasher
+import fire_nipper
+import fire_boaster
+import G_RunExplosion
+import G_RunMissile
+import BerserkerCheck
+import TossClientCubes
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import GametypeNameShort
+import GametypeName
+import RemoveOwnedItems
+import SetAward
+import G_RestorePowerups
+import G_BackupPowerups
+import DeleteDebugLines
+import DebugLineDouble
+import DebugLine
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_NextActiveEntity
+import G_InitEntityLists
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_FindAll
+import G_Find
+import G_EntityIndexChanged
+import G_InitEntityIndex
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import G_Say
+import ConcatArgs
+import Cmd_DropCartridge_f
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $334
+byte 1 51
+byte 1 51
+byte 1 0
+align 1
+LABELV $330
+byte 1 56
+byte 1 0
+align 1
+LABELV $329
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $295
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 34
+byte 1 0
+align 1
+LABELV $292
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 34
+byte 1 0
+align 1
+LABELV $285
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 102
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $237
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 84
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 33
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $233
+byte 1 68
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 100
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $97
+byte 1 42
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
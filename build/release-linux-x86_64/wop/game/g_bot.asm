@@ -0,0 +1,5169 @@
+export trap_Cvar_VariableValue
+code
+proc trap_Cvar_VariableValue 132 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 128
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 128
+INDIRF4
+RETF4
+LABELV $62
+endproc trap_Cvar_VariableValue 132 12
+proc G_ParseBotInfos 2080 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 2052
+CNSTI4 0
+ASGNI4
+ADDRGP4 $65
+JUMPV
+LABELV $64
+ADDRFP4 0
+ARGP4
+ADDRLP4 2056
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2056
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $67
+ADDRGP4 $66
+JUMPV
+LABELV $67
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $71
+ARGP4
+ADDRLP4 2060
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 2060
+INDIRI4
+CNSTI4 0
+EQI4 $69
+ADDRGP4 $72
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $66
+JUMPV
+LABELV $69
+ADDRLP4 2052
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $73
+ADDRGP4 $75
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $66
+JUMPV
+LABELV $73
+ADDRLP4 1028
+CNSTI1 0
+ASGNI1
+ADDRGP4 $77
+JUMPV
+LABELV $76
+ADDRFP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 2064
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2064
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $79
+ADDRGP4 $81
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $78
+JUMPV
+LABELV $79
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $84
+ARGP4
+ADDRLP4 2068
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 2068
+INDIRI4
+CNSTI4 0
+NEI4 $82
+ADDRGP4 $78
+JUMPV
+LABELV $82
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 2072
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2072
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $85
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $87
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $85
+ADDRLP4 1028
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+LABELV $77
+ADDRGP4 $76
+JUMPV
+LABELV $78
+ADDRLP4 1028
+ARGP4
+ADDRLP4 2064
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRGP4 $88
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 2068
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 2068
+INDIRP4
+ARGP4
+ADDRLP4 2072
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 2064
+INDIRU4
+ADDRLP4 2072
+INDIRU4
+ADDU4
+CNSTU4 1
+ADDU4
+CVUI4 4
+ARGI4
+ADDRLP4 2076
+ADDRGP4 G_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 2052
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 2076
+INDIRP4
+ASGNP4
+ADDRLP4 2052
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $89
+ADDRLP4 2052
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1028
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 2052
+ADDRLP4 2052
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $89
+LABELV $65
+ADDRGP4 $64
+JUMPV
+LABELV $66
+ADDRLP4 2052
+INDIRI4
+RETI4
+LABELV $63
+endproc G_ParseBotInfos 2080 12
+export G_AddRandomBot
+proc G_AddRandomBot 84 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRGP4 $95
+JUMPV
+LABELV $92
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $96
+ARGP4
+ADDRLP4 68
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $100
+JUMPV
+LABELV $97
+ADDRLP4 0
+CNSTI4 956
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $102
+ADDRGP4 $98
+JUMPV
+LABELV $102
+CNSTI4 832
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $104
+ADDRGP4 $98
+JUMPV
+LABELV $104
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $108
+ADDRLP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $108
+ADDRGP4 $98
+JUMPV
+LABELV $108
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+NEI4 $110
+ADDRGP4 $99
+JUMPV
+LABELV $110
+LABELV $98
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $100
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $97
+LABELV $99
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $112
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $112
+LABELV $93
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $95
+ADDRLP4 12
+INDIRI4
+ADDRGP4 g_numBots
+INDIRI4
+LTI4 $92
+ADDRLP4 68
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 68
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $118
+JUMPV
+LABELV $115
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $96
+ARGP4
+ADDRLP4 72
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $122
+JUMPV
+LABELV $119
+ADDRLP4 0
+CNSTI4 956
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $124
+ADDRGP4 $120
+JUMPV
+LABELV $124
+CNSTI4 832
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $126
+ADDRGP4 $120
+JUMPV
+LABELV $126
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $130
+ADDRLP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $130
+ADDRGP4 $120
+JUMPV
+LABELV $130
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+NEI4 $132
+ADDRGP4 $121
+JUMPV
+LABELV $132
+LABELV $120
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $122
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $119
+LABELV $121
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $134
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+GTI4 $137
+ADDRGP4 $139
+ARGP4
+ADDRLP4 76
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $140
+ADDRLP4 60
+ADDRGP4 $142
+ASGNP4
+ADDRGP4 $141
+JUMPV
+LABELV $140
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $143
+ADDRLP4 60
+ADDRGP4 $145
+ASGNP4
+ADDRGP4 $144
+JUMPV
+LABELV $143
+ADDRLP4 60
+ADDRGP4 $146
+ASGNP4
+LABELV $144
+LABELV $141
+ADDRLP4 20
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTU4 35
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRLP4 20+35
+CNSTI1 0
+ASGNI1
+ADDRLP4 20
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRGP4 $148
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 80
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 1
+ARGI4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $91
+JUMPV
+LABELV $137
+LABELV $134
+LABELV $116
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $118
+ADDRLP4 12
+INDIRI4
+ADDRGP4 g_numBots
+INDIRI4
+LTI4 $115
+LABELV $91
+endproc G_AddRandomBot 84 20
+export G_RemoveRandomBot
+proc G_RemoveRandomBot 52 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $153
+JUMPV
+LABELV $150
+ADDRLP4 0
+CNSTI4 956
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $155
+ADDRGP4 $151
+JUMPV
+LABELV $155
+CNSTI4 832
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $157
+ADDRGP4 $151
+JUMPV
+LABELV $157
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $161
+ADDRLP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $161
+ADDRGP4 $151
+JUMPV
+LABELV $161
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 8
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRGP4 $163
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 1
+ARGI4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $149
+JUMPV
+LABELV $151
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $153
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $150
+CNSTI4 0
+RETI4
+LABELV $149
+endproc G_RemoveRandomBot 52 8
+export G_CountHumanPlayers
+proc G_CountHumanPlayers 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $168
+JUMPV
+LABELV $165
+ADDRLP4 0
+CNSTI4 956
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $170
+ADDRGP4 $166
+JUMPV
+LABELV $170
+CNSTI4 832
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $172
+ADDRGP4 $166
+JUMPV
+LABELV $172
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $176
+ADDRLP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $176
+ADDRGP4 $166
+JUMPV
+LABELV $176
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $166
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $168
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $165
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $164
+endproc G_CountHumanPlayers 20 0
+export G_CountBotPlayers
+proc G_CountBotPlayers 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $182
+JUMPV
+LABELV $179
+ADDRLP4 4
+CNSTI4 956
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $184
+ADDRGP4 $180
+JUMPV
+LABELV $184
+CNSTI4 832
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $186
+ADDRGP4 $180
+JUMPV
+LABELV $186
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $190
+ADDRLP4 4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $190
+ADDRGP4 $180
+JUMPV
+LABELV $190
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $180
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $182
+ADDRLP4 8
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $179
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $192
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue+4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $196
+ADDRGP4 $193
+JUMPV
+LABELV $196
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue+4
+ADDP4
+INDIRI4
+ADDRGP4 level+68
+INDIRI4
+LEI4 $199
+ADDRGP4 $193
+JUMPV
+LABELV $199
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $193
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $192
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $178
+endproc G_CountBotPlayers 24 0
+bss
+align 4
+LABELV $204
+skip 4
+export G_CheckMinimumPlayers
+code
+proc G_CheckMinimumPlayers 36 4
+ADDRGP4 level+9168
+INDIRI4
+CNSTI4 0
+EQI4 $205
+ADDRGP4 $203
+JUMPV
+LABELV $205
+ADDRGP4 $204
+INDIRI4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 1000
+SUBI4
+LEI4 $208
+ADDRGP4 $203
+JUMPV
+LABELV $208
+ADDRGP4 $204
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+ADDRGP4 bot_minplayers
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 bot_minplayers+12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $213
+ADDRGP4 $203
+JUMPV
+LABELV $213
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+LTI4 $215
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+CNSTI4 2
+DIVI4
+LTI4 $218
+ADDRLP4 0
+ADDRGP4 g_maxclients+12
+INDIRI4
+CNSTI4 2
+DIVI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $218
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 G_CountHumanPlayers
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 G_CountBotPlayers
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRI4
+GEI4 $222
+CNSTI4 1
+ARGI4
+ADDRGP4 G_AddRandomBot
+CALLV
+pop
+ADDRGP4 $223
+JUMPV
+LABELV $222
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRI4
+LEI4 $224
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $224
+CNSTI4 1
+ARGI4
+ADDRGP4 G_RemoveRandomBot
+CALLI4
+pop
+LABELV $224
+LABELV $223
+CNSTI4 2
+ARGI4
+ADDRLP4 24
+ADDRGP4 G_CountHumanPlayers
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 24
+INDIRI4
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRLP4 28
+ADDRGP4 G_CountBotPlayers
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRI4
+GEI4 $226
+CNSTI4 2
+ARGI4
+ADDRGP4 G_AddRandomBot
+CALLV
+pop
+ADDRGP4 $216
+JUMPV
+LABELV $226
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRI4
+LEI4 $216
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $216
+CNSTI4 2
+ARGI4
+ADDRGP4 G_RemoveRandomBot
+CALLI4
+pop
+ADDRGP4 $216
+JUMPV
+LABELV $215
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+NEI4 $230
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $233
+ADDRLP4 0
+ADDRGP4 g_maxclients+12
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $233
+CNSTI4 -1
+ARGI4
+ADDRLP4 12
+ADDRGP4 G_CountHumanPlayers
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+CNSTI4 -1
+ARGI4
+ADDRLP4 16
+ADDRGP4 G_CountBotPlayers
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRI4
+GEI4 $237
+CNSTI4 0
+ARGI4
+ADDRGP4 G_AddRandomBot
+CALLV
+pop
+ADDRGP4 $231
+JUMPV
+LABELV $237
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRI4
+LEI4 $231
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $231
+CNSTI4 3
+ARGI4
+ADDRLP4 24
+ADDRGP4 G_RemoveRandomBot
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $231
+CNSTI4 -1
+ARGI4
+ADDRGP4 G_RemoveRandomBot
+CALLI4
+pop
+ADDRGP4 $231
+JUMPV
+LABELV $230
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+EQI4 $249
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+EQI4 $249
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 0
+NEI4 $243
+LABELV $249
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $250
+ADDRLP4 0
+ADDRGP4 g_maxclients+12
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $250
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ADDRGP4 G_CountHumanPlayers
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 16
+ADDRGP4 G_CountBotPlayers
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRI4
+GEI4 $254
+CNSTI4 0
+ARGI4
+ADDRGP4 G_AddRandomBot
+CALLV
+pop
+ADDRGP4 $255
+JUMPV
+LABELV $254
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRI4
+LEI4 $256
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $256
+CNSTI4 0
+ARGI4
+ADDRGP4 G_RemoveRandomBot
+CALLI4
+pop
+LABELV $256
+LABELV $255
+LABELV $243
+LABELV $231
+LABELV $216
+LABELV $203
+endproc G_CheckMinimumPlayers 36 4
+export G_CheckBotSpawn
+proc G_CheckBotSpawn 1028 12
+ADDRGP4 G_CheckMinimumPlayers
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $259
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue+4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $263
+ADDRGP4 $260
+JUMPV
+LABELV $263
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue+4
+ADDP4
+INDIRI4
+ADDRGP4 level+68
+INDIRI4
+LEI4 $266
+ADDRGP4 $260
+JUMPV
+LABELV $266
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 ClientBegin
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue+4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 2
+NEI4 $271
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+LABELV $271
+LABELV $260
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $259
+LABELV $258
+endproc G_CheckBotSpawn 1028 12
+proc AddBotToSpawnQueue 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $275
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue+4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $279
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue+4
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $274
+JUMPV
+LABELV $279
+LABELV $276
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $275
+ADDRGP4 $284
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 ClientBegin
+CALLV
+pop
+LABELV $274
+endproc AddBotToSpawnQueue 4 4
+export G_RemoveQueuedBotBegin
+proc G_RemoveQueuedBotBegin 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $286
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $290
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue+4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $285
+JUMPV
+LABELV $290
+LABELV $287
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $286
+LABELV $285
+endproc G_RemoveQueuedBotBegin 4 0
+export G_BotConnect
+proc G_BotConnect 1336 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 292
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 292
+ARGP4
+ADDRGP4 $294
+ARGP4
+ADDRLP4 1316
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1316
+INDIRP4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 292
+ARGP4
+ADDRGP4 $296
+ARGP4
+ADDRLP4 1320
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1320
+INDIRP4
+ARGP4
+ADDRLP4 1324
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0+144
+ADDRLP4 1324
+INDIRF4
+ASGNF4
+ADDRLP4 292
+ARGP4
+ADDRGP4 $298
+ARGP4
+ADDRLP4 1328
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0+148
+ARGP4
+ADDRLP4 1328
+INDIRP4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 1332
+ADDRGP4 BotAISetupClient
+CALLI4
+ASGNI4
+ADDRLP4 1332
+INDIRI4
+CNSTI4 0
+NEI4 $300
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $302
+ARGP4
+ADDRGP4 trap_DropClient
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $300
+CNSTI4 1
+RETI4
+LABELV $293
+endproc G_BotConnect 1336 12
+proc G_AddBot 1144 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1060
+ADDRGP4 G_GetBotInfoByName
+CALLP4
+ASGNP4
+ADDRLP4 1032
+ADDRLP4 1060
+INDIRP4
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $304
+ADDRGP4 $306
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $303
+JUMPV
+LABELV $304
+ADDRLP4 4
+CNSTI1 0
+ASGNI1
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $307
+ARGP4
+ADDRLP4 1064
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1048
+ADDRLP4 1064
+INDIRP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $308
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $96
+ARGP4
+ADDRLP4 1068
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1048
+ADDRLP4 1068
+INDIRP4
+ASGNP4
+LABELV $308
+ADDRLP4 1068
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 1068
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $310
+ADDRLP4 1068
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $310
+ADDRLP4 1048
+ADDRFP4 16
+INDIRP4
+ASGNP4
+LABELV $310
+ADDRLP4 4
+ARGP4
+ADDRGP4 $96
+ARGP4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $312
+ARGP4
+ADDRGP4 $313
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $314
+ARGP4
+ADDRGP4 $315
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRGP4 $316
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 1072
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $296
+ARGP4
+ADDRLP4 1072
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRFP4 4
+INDIRF4
+CNSTF4 1065353216
+LTF4 $317
+ADDRFP4 4
+INDIRF4
+CNSTF4 1073741824
+GEF4 $317
+ADDRLP4 4
+ARGP4
+ADDRGP4 $319
+ARGP4
+ADDRGP4 $320
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRGP4 $318
+JUMPV
+LABELV $317
+ADDRFP4 4
+INDIRF4
+CNSTF4 1073741824
+LTF4 $321
+ADDRFP4 4
+INDIRF4
+CNSTF4 1077936128
+GEF4 $321
+ADDRLP4 4
+ARGP4
+ADDRGP4 $319
+ARGP4
+ADDRGP4 $323
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRGP4 $322
+JUMPV
+LABELV $321
+ADDRFP4 4
+INDIRF4
+CNSTF4 1077936128
+LTF4 $324
+ADDRFP4 4
+INDIRF4
+CNSTF4 1082130432
+GEF4 $324
+ADDRLP4 4
+ARGP4
+ADDRGP4 $319
+ARGP4
+ADDRGP4 $326
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+LABELV $324
+LABELV $322
+LABELV $318
+ADDRLP4 0
+ADDRGP4 $327
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1088
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1052
+ADDRLP4 1088
+INDIRP4
+ASGNP4
+ADDRLP4 1052
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $328
+ADDRLP4 1052
+ADDRGP4 $330
+ASGNP4
+LABELV $328
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1052
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 $331
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1092
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1040
+ADDRLP4 1092
+INDIRP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $332
+ADDRLP4 1040
+ADDRGP4 $334
+ASGNP4
+ADDRGP4 $333
+JUMPV
+LABELV $332
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+GEI4 $335
+ADDRFP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $338
+ADDRLP4 1096
+CNSTP4 0
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $142
+ARGP4
+ADDRLP4 1100
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1100
+INDIRI4
+CNSTI4 0
+EQI4 $345
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $342
+ARGP4
+ADDRLP4 1104
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+EQI4 $345
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $343
+ARGP4
+ADDRLP4 1108
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+NEI4 $340
+LABELV $345
+ADDRLP4 1096
+ADDRGP4 $142
+ASGNP4
+ADDRGP4 $341
+JUMPV
+LABELV $340
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $145
+ARGP4
+ADDRLP4 1112
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+EQI4 $351
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $348
+ARGP4
+ADDRLP4 1116
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 0
+EQI4 $351
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $349
+ARGP4
+ADDRLP4 1120
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1120
+INDIRI4
+CNSTI4 0
+NEI4 $346
+LABELV $351
+ADDRLP4 1096
+ADDRGP4 $145
+ASGNP4
+LABELV $346
+LABELV $341
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 $354
+ARGP4
+ADDRLP4 1124
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 1124
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $356
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 $355
+ARGP4
+ADDRLP4 1128
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 1128
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $352
+LABELV $356
+ADDRLP4 1096
+CNSTP4 0
+ASGNP4
+LABELV $352
+ADDRLP4 1096
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $357
+ADDRLP4 1040
+INDIRP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 1132
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 1132
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $359
+ADDRGP4 $361
+ARGP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1096
+INDIRP4
+ARGP4
+ADDRLP4 1136
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1040
+ADDRLP4 1136
+INDIRP4
+ASGNP4
+ADDRGP4 $360
+JUMPV
+LABELV $359
+ADDRGP4 $362
+ARGP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1096
+INDIRP4
+ARGP4
+ADDRLP4 1136
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1040
+ADDRLP4 1136
+INDIRP4
+ASGNP4
+LABELV $360
+LABELV $357
+LABELV $338
+LABELV $335
+LABELV $333
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 $363
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 $364
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1096
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1044
+ADDRLP4 1096
+INDIRP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $365
+ADDRLP4 1044
+ADDRLP4 1040
+INDIRP4
+ASGNP4
+LABELV $365
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 $367
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 $368
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1100
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 1100
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $369
+ADDRLP4 1028
+ADDRGP4 $371
+ASGNP4
+LABELV $369
+ADDRLP4 4
+ARGP4
+ADDRGP4 $372
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 $373
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1104
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 1104
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $374
+ADDRLP4 1028
+ADDRGP4 $376
+ASGNP4
+LABELV $374
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 $377
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1108
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 1108
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $378
+ADDRLP4 1028
+ADDRGP4 $380
+ASGNP4
+LABELV $378
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $381
+ARGP4
+ADDRLP4 1112
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 1112
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $382
+ADDRGP4 $384
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRGP4 $303
+JUMPV
+LABELV $382
+ADDRLP4 1116
+ADDRGP4 trap_BotAllocateClient
+CALLI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1116
+INDIRI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 -1
+NEI4 $385
+ADDRGP4 $387
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $388
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $303
+JUMPV
+LABELV $385
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $391
+ADDRFP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $389
+LABELV $391
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+LTI4 $392
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRLP4 1124
+ADDRGP4 PickTeam
+CALLI4
+ASGNI4
+ADDRLP4 1124
+INDIRI4
+CNSTI4 1
+NEI4 $395
+ADDRFP4 8
+ADDRGP4 $142
+ASGNP4
+ADDRGP4 $393
+JUMPV
+LABELV $395
+ADDRFP4 8
+ADDRGP4 $145
+ASGNP4
+ADDRGP4 $393
+JUMPV
+LABELV $392
+ADDRFP4 8
+ADDRGP4 $142
+ASGNP4
+LABELV $393
+LABELV $389
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $381
+ARGP4
+ADDRLP4 1124
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $294
+ARGP4
+ADDRLP4 1124
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRGP4 $397
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 1128
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $296
+ARGP4
+ADDRLP4 1128
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $298
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 1056
+CNSTI4 832
+ADDRLP4 1036
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 1132
+ADDRLP4 1056
+INDIRP4
+CNSTI4 424
+ADDP4
+ASGNP4
+ADDRLP4 1132
+INDIRP4
+ADDRLP4 1132
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+ADDRLP4 1056
+INDIRP4
+CNSTI4 520
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SetUserinfo
+CALLV
+pop
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRLP4 1136
+CNSTI4 1
+ASGNI4
+ADDRLP4 1136
+INDIRI4
+ARGI4
+ADDRLP4 1136
+INDIRI4
+ARGI4
+ADDRLP4 1140
+ADDRGP4 ClientConnect
+CALLP4
+ASGNP4
+ADDRLP4 1140
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $398
+ADDRGP4 $303
+JUMPV
+LABELV $398
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $400
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRGP4 ClientBegin
+CALLV
+pop
+ADDRGP4 $303
+JUMPV
+LABELV $400
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 AddBotToSpawnQueue
+CALLV
+pop
+LABELV $303
+endproc G_AddBot 1144 12
+export Svcmd_AddBot_f
+proc Svcmd_AddBot_f 4112 20
+ADDRGP4 $405
+ARGP4
+ADDRLP4 4104
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 4104
+INDIRI4
+CNSTI4 0
+NEI4 $403
+ADDRGP4 $402
+JUMPV
+LABELV $403
+CNSTI4 1
+ARGI4
+ADDRLP4 1024
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 1024
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $406
+ADDRGP4 $408
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRGP4 $402
+JUMPV
+LABELV $406
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $409
+ADDRLP4 2048
+CNSTF4 1082130432
+ASGNF4
+ADDRGP4 $410
+JUMPV
+LABELV $409
+ADDRLP4 0
+ARGP4
+ADDRLP4 4108
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 2048
+ADDRLP4 4108
+INDIRF4
+ASGNF4
+ADDRLP4 2048
+INDIRF4
+CNSTF4 1065353216
+GEF4 $411
+ADDRLP4 2048
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $412
+JUMPV
+LABELV $411
+ADDRLP4 2048
+INDIRF4
+CNSTF4 1084227584
+LEF4 $413
+ADDRLP4 2048
+CNSTF4 1084227584
+ASGNF4
+LABELV $413
+LABELV $412
+LABELV $410
+CNSTI4 3
+ARGI4
+ADDRLP4 3076
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $415
+ADDRLP4 4100
+CNSTI4 0
+ASGNI4
+ADDRGP4 $416
+JUMPV
+LABELV $415
+ADDRLP4 0
+ARGP4
+ADDRLP4 4108
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4100
+ADDRLP4 4108
+INDIRI4
+ASGNI4
+LABELV $416
+CNSTI4 5
+ARGI4
+ADDRLP4 2052
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 1024
+ARGP4
+ADDRLP4 2048
+INDIRF4
+ARGF4
+ADDRLP4 3076
+ARGP4
+ADDRLP4 4100
+INDIRI4
+ARGI4
+ADDRLP4 2052
+ARGP4
+ADDRGP4 G_AddBot
+CALLV
+pop
+ADDRGP4 level+68
+INDIRI4
+ADDRGP4 level+76
+INDIRI4
+SUBI4
+CNSTI4 1000
+LEI4 $417
+ADDRGP4 $421
+ARGP4
+ADDRLP4 4108
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 4108
+INDIRI4
+CNSTI4 0
+EQI4 $417
+CNSTI4 -1
+ARGI4
+ADDRGP4 $422
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $417
+LABELV $402
+endproc Svcmd_AddBot_f 4112 20
+export Svcmd_BotList_f
+proc Svcmd_BotList_f 4120 20
+ADDRGP4 $424
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $428
+JUMPV
+LABELV $425
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $96
+ARGP4
+ADDRLP4 4100
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 4100
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $429
+ADDRLP4 4
+ARGP4
+ADDRGP4 $431
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $429
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $307
+ARGP4
+ADDRLP4 4104
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ARGP4
+ADDRLP4 4104
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1028
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $432
+ADDRLP4 1028
+ARGP4
+ADDRGP4 $146
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $432
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $331
+ARGP4
+ADDRLP4 4108
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2052
+ARGP4
+ADDRLP4 4108
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 2052
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $434
+ADDRLP4 2052
+ARGP4
+ADDRGP4 $436
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $434
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $381
+ARGP4
+ADDRLP4 4112
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 3076
+ARGP4
+ADDRLP4 4112
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 3076
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $437
+ADDRLP4 3076
+ARGP4
+ADDRGP4 $439
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $437
+ADDRGP4 $440
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 2052
+ARGP4
+ADDRLP4 3076
+ARGP4
+ADDRLP4 1028
+ARGP4
+ADDRLP4 4116
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4116
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $426
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $428
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_numBots
+INDIRI4
+LTI4 $425
+LABELV $423
+endproc Svcmd_BotList_f 4120 20
+proc G_LoadBotsFromFile 8216 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8200
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8200
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $442
+ADDRGP4 $444
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8204
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRGP4 $441
+JUMPV
+LABELV $442
+ADDRLP4 0
+INDIRI4
+CNSTI4 8192
+LTI4 $445
+ADDRGP4 $447
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 8192
+ARGI4
+ADDRLP4 8204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8204
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 $441
+JUMPV
+LABELV $445
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 8204
+ADDRGP4 g_numBots
+ASGNP4
+ADDRLP4 8208
+ADDRLP4 8204
+INDIRP4
+INDIRI4
+ASGNI4
+CNSTI4 1024
+ADDRLP4 8208
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 8208
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+ARGP4
+ADDRLP4 8212
+ADDRGP4 G_ParseBotInfos
+CALLI4
+ASGNI4
+ADDRLP4 8204
+INDIRP4
+ADDRLP4 8208
+INDIRI4
+ADDRLP4 8212
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $441
+endproc G_LoadBotsFromFile 8216 16
+export G_LoadBots
+proc G_LoadBots 1456 16
+ADDRGP4 bot_minplayers
+ARGP4
+ADDRGP4 $449
+ARGP4
+ADDRGP4 $343
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 $405
+ARGP4
+ADDRLP4 1440
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 1440
+INDIRI4
+CNSTI4 0
+NEI4 $450
+ADDRGP4 $448
+JUMPV
+LABELV $450
+ADDRGP4 g_numBots
+CNSTI4 0
+ASGNI4
+ADDRLP4 1168
+ARGP4
+ADDRGP4 $452
+ARGP4
+ADDRGP4 $146
+ARGP4
+CNSTI4 80
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 1168+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $453
+ADDRLP4 1168+16
+ARGP4
+ADDRGP4 G_LoadBotsFromFile
+CALLV
+pop
+LABELV $453
+LABELV $454
+ADDRGP4 $457
+ARGP4
+ADDRGP4 $458
+ARGP4
+ADDRLP4 144
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1444
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 1444
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 144
+ASGNP4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $462
+JUMPV
+LABELV $459
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1448
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 136
+ADDRLP4 1448
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $463
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_LoadBotsFromFile
+CALLV
+pop
+LABELV $460
+ADDRLP4 1448
+CNSTI4 1
+ASGNI4
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+ADDRLP4 1448
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 136
+INDIRI4
+ADDRLP4 1448
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $462
+ADDRLP4 132
+INDIRI4
+ADDRLP4 140
+INDIRI4
+LTI4 $459
+ADDRGP4 $464
+ARGP4
+ADDRGP4 g_numBots
+INDIRI4
+ARGI4
+ADDRLP4 1452
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1452
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $448
+endproc G_LoadBots 1456 16
+export G_GetBotInfoByNumber
+proc G_GetBotInfoByNumber 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $468
+ADDRFP4 0
+INDIRI4
+ADDRGP4 g_numBots
+INDIRI4
+LTI4 $466
+LABELV $468
+ADDRGP4 $469
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $465
+JUMPV
+LABELV $466
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+INDIRP4
+RETP4
+LABELV $465
+endproc G_GetBotInfoByNumber 8 8
+export G_GetBotInfoByName
+proc G_GetBotInfoByName 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $474
+JUMPV
+LABELV $471
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $96
+ARGP4
+ADDRLP4 8
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $475
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $470
+JUMPV
+LABELV $475
+LABELV $472
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $474
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_numBots
+INDIRI4
+LTI4 $471
+CNSTP4 0
+RETP4
+LABELV $470
+endproc G_GetBotInfoByName 16 8
+import podium3
+import podium2
+import podium1
+bss
+align 4
+LABELV bot_minplayers
+skip 272
+align 4
+LABELV botSpawnQueue
+skip 128
+align 4
+LABELV g_botInfos
+skip 4096
+align 4
+LABELV g_numBots
+skip 4
+import trap_AAS_BestReachableArea
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntities
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_RealTime
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_EntitiesInPVS
+import trap_RestoreClients
+import trap_RewindClients
+import trap_GetUsercmds
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_TraceBatch
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import g_logDamage
+import g_modInstagib_WeaponJump
+import g_modInstagib
+import g_transmitSVboastermissiles
+import g_KillerduckHealth
+import g_LPS_flags
+import g_LPS_startlives
+import g_skyLensflare
+import g_sky
+import g_q3Items
+import pmove_msec
+import pmove_fixed
+import g_antilag
+import g_smoothClients
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_curWarmupReady
+import g_warmupReady
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import MapSupportsGametype
+import G_GetArenaInfoByMap
+import G_InitGameinfo
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import AI_RemoveBambam
+import AI_AddBambam
+import AI_RemoveBoomie
+import AI_AddBoomie
+import BotCamViewangles
+import BotCamViewTarget
+import BotCamViewEntitiy
+import BotChooseWeap
+import BotCamFire
+import BotCamTaunt
+import BotCamMoveTo
+import BotCamMode
+import BotInterbreedEndMatch
+import Svcmd_BotStats_f
+import CantDamageTeamitem
+import boomies_createByPlayer
+import bambam_createByPlayer
+import IsItemSameTeam
+import Instagib_canSpawnEntity
+import Instagib_isRelevantDamageEvent
+import Instagib_calculateDamage
+import Instagib_getSpawnWeapon
+import Instagib_applyWeaponJumpKnockback
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import PrintMsg
+import CheckObeliskAttack
+import Team_GetFlagStatus
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThinkBatch
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogFlush
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import G_GetCvarInt
+import MoveClientToIntermission
+import G_SendScoreboardUpdates
+import DeathmatchScoreboardMessage
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import GetASpawnPosition
+import SelectSpectatorSpawnPoint
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import respawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import Touch_DoorTrigger
+import G_PushablesChanged
+import G_RunMover
+import fire_kma
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_bubbleg
+import fire_bambamMissile
+import fire_duck
+import explode_imperius
+import fire_splasher
+import fire_nipper
+import fire_boaster
+import G_RunExplosion
+import G_RunMissile
+import BerserkerCheck
+import TossClientCubes
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import GametypeNameShort
+import GametypeName
+import RemoveOwnedItems
+import SetAward
+import G_RestorePowerups
+import G_BackupPowerups
+import DeleteDebugLines
+import DebugLineDouble
+import DebugLine
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_NextActiveEntity
+import G_InitEntityLists
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_FindAll
+import G_Find
+import G_EntityIndexChanged
+import G_InitEntityIndex
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import G_Say
+import ConcatArgs
+import Cmd_DropCartridge_f
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $469
+byte 1 94
+byte 1 49
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $464
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $463
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 0
+align 1
+LABELV $458
+byte 1 46
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $457
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $452
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $449
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $447
+byte 1 94
+byte 1 49
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 44
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $444
+byte 1 94
+byte 1 49
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $440
+byte 1 37
+byte 1 45
+byte 1 49
+byte 1 54
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 45
+byte 1 49
+byte 1 54
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $439
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 95
+byte 1 99
+byte 1 46
+byte 1 99
+byte 1 0
+align 1
+LABELV $436
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $431
+byte 1 85
+byte 1 110
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $424
+byte 1 94
+byte 1 49
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 97
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $422
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $421
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $408
+byte 1 85
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 65
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 60
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 91
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 49
+byte 1 45
+byte 1 53
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $405
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $397
+byte 1 37
+byte 1 53
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 0
+align 1
+LABELV $388
+byte 1 94
+byte 1 49
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 39
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 39
+byte 1 32
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 41
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $387
+byte 1 94
+byte 1 49
+byte 1 85
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 46
+byte 1 32
+byte 1 32
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $384
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $381
+byte 1 97
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $380
+byte 1 53
+byte 1 0
+align 1
+LABELV $377
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $376
+byte 1 52
+byte 1 0
+align 1
+LABELV $373
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $372
+byte 1 115
+byte 1 101
+byte 1 120
+byte 1 0
+align 1
+LABELV $371
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $368
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $367
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $364
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $363
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $362
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $361
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $355
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $354
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $349
+byte 1 49
+byte 1 0
+align 1
+LABELV $348
+byte 1 98
+byte 1 0
+align 1
+LABELV $343
+byte 1 48
+byte 1 0
+align 1
+LABELV $342
+byte 1 114
+byte 1 0
+align 1
+LABELV $334
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $331
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $330
+byte 1 49
+byte 1 53
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 0
+align 1
+LABELV $327
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 0
+align 1
+LABELV $326
+byte 1 57
+byte 1 48
+byte 1 0
+align 1
+LABELV $323
+byte 1 55
+byte 1 48
+byte 1 0
+align 1
+LABELV $320
+byte 1 53
+byte 1 48
+byte 1 0
+align 1
+LABELV $319
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $316
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 0
+align 1
+LABELV $315
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $314
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $313
+byte 1 50
+byte 1 53
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $312
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $307
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $306
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $302
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 65
+byte 1 73
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 112
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $298
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $296
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $294
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $284
+byte 1 94
+byte 1 51
+byte 1 85
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $163
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $148
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $146
+byte 1 0
+align 1
+LABELV $145
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $142
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $139
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $96
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $88
+byte 1 92
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 92
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $87
+byte 1 60
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 62
+byte 1 0
+align 1
+LABELV $84
+byte 1 125
+byte 1 0
+align 1
+LABELV $81
+byte 1 85
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $75
+byte 1 77
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 115
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $72
+byte 1 77
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 123
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $71
+byte 1 123
+byte 1 0
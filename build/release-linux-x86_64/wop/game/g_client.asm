@@ -0,0 +1,7509 @@
+data
+align 4
+LABELV playerMins
+byte 4 3245342720
+byte 4 3245342720
+byte 4 3250585600
+align 4
+LABELV playerMaxs
+byte 4 1097859072
+byte 4 1097859072
+byte 4 1107296256
+export SP_info_player_deathmatch
+code
+proc SP_info_player_deathmatch 8 12
+ADDRGP4 $62
+ARGP4
+ADDRGP4 $63
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 G_SpawnInt
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $64
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 8192
+BORI4
+ASGNI4
+LABELV $64
+ADDRGP4 $66
+ARGP4
+ADDRGP4 $63
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 G_SpawnInt
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $67
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $67
+LABELV $61
+endproc SP_info_player_deathmatch 8 12
+export SP_info_player_start
+proc SP_info_player_start 0 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRGP4 $70
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 SP_info_player_deathmatch
+CALLV
+pop
+LABELV $69
+endproc SP_info_player_start 0 4
+export SP_info_player_intermission
+proc SP_info_player_intermission 0 0
+LABELV $71
+endproc SP_info_player_intermission 0 0
+export SpotWouldTelefrag
+proc SpotWouldTelefrag 4144 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4108
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ADDRGP4 playerMins
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4108+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ADDRGP4 playerMins+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4108+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ADDRGP4 playerMins+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4120
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ADDRGP4 playerMaxs
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4120+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ADDRGP4 playerMaxs+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4120+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ADDRGP4 playerMaxs+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4108
+ARGP4
+ADDRLP4 4120
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 4140
+ADDRGP4 trap_EntitiesInBox
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 4140
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $84
+JUMPV
+LABELV $81
+ADDRLP4 4
+CNSTI4 832
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $85
+CNSTI4 1
+RETI4
+ADDRGP4 $72
+JUMPV
+LABELV $85
+LABELV $82
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $84
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $81
+CNSTI4 0
+RETI4
+LABELV $72
+endproc SpotWouldTelefrag 4144 16
+export SelectNearestDeathmatchSpawnPoint
+proc SelectNearestDeathmatchSpawnPoint 44 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTF4 1232348144
+ASGNF4
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRLP4 24
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRGP4 $89
+JUMPV
+LABELV $88
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 40
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+GEF4 $93
+ADDRLP4 20
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $93
+LABELV $89
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRGP4 $70
+ARGP4
+ADDRLP4 32
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $88
+ADDRLP4 24
+INDIRP4
+RETP4
+LABELV $87
+endproc SelectNearestDeathmatchSpawnPoint 44 12
+export GetASpawnPosition
+proc GetASpawnPosition 60 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 32
+INDIRI4
+CNSTI4 127
+BANDI4
+ASGNI4
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 36
+CNSTP4 0
+ASGNP4
+ADDRLP4 20
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRGP4 $97
+JUMPV
+LABELV $96
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 48
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 24
+INDIRF4
+LEF4 $101
+ADDRLP4 24
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $101
+ADDRLP4 52
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+GTI4 $103
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $103
+ADDRGP4 $98
+JUMPV
+LABELV $103
+LABELV $97
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRGP4 $70
+ARGP4
+ADDRLP4 40
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $96
+LABELV $98
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $107
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+LEI4 $105
+LABELV $107
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $109
+JUMPV
+LABELV $108
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 52
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 24
+INDIRF4
+LEF4 $114
+ADDRLP4 24
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $114
+ADDRLP4 56
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+GTI4 $116
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $116
+ADDRGP4 $110
+JUMPV
+LABELV $116
+LABELV $109
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRGP4 $111
+ARGP4
+ADDRLP4 44
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $108
+LABELV $110
+LABELV $105
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $120
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+LEI4 $118
+LABELV $120
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $122
+JUMPV
+LABELV $121
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 52
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 24
+INDIRF4
+LEF4 $127
+ADDRLP4 24
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $127
+ADDRLP4 56
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+GTI4 $129
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $129
+ADDRGP4 $123
+JUMPV
+LABELV $129
+LABELV $122
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRGP4 $124
+ARGP4
+ADDRLP4 44
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $121
+LABELV $123
+LABELV $118
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $131
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+CNSTI4 1
+RETI4
+ADDRGP4 $95
+JUMPV
+LABELV $131
+CNSTI4 0
+RETI4
+LABELV $95
+endproc GetASpawnPosition 60 12
+export SelectRandomDeathmatchSpawnPoint
+proc SelectRandomDeathmatchSpawnPoint 536 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $135
+JUMPV
+LABELV $134
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 524
+ADDRGP4 SpotWouldTelefrag
+CALLI4
+ASGNI4
+ADDRLP4 524
+INDIRI4
+CNSTI4 0
+EQI4 $137
+ADDRGP4 $135
+JUMPV
+LABELV $137
+ADDRLP4 528
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+ADDRLP4 528
+INDIRI4
+EQI4 $142
+ADDRFP4 0
+INDIRI4
+ADDRLP4 528
+INDIRI4
+NEI4 $141
+LABELV $142
+ADDRLP4 532
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 16384
+BANDI4
+ADDRLP4 532
+INDIRI4
+EQI4 $139
+ADDRFP4 0
+INDIRI4
+ADDRLP4 532
+INDIRI4
+NEI4 $139
+LABELV $141
+ADDRGP4 $135
+JUMPV
+LABELV $139
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $135
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRGP4 $70
+ARGP4
+ADDRLP4 524
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 524
+INDIRP4
+ASGNP4
+ADDRLP4 524
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $143
+ADDRLP4 4
+INDIRI4
+CNSTI4 128
+LTI4 $134
+LABELV $143
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $144
+CNSTP4 0
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRGP4 $70
+ARGP4
+ADDRLP4 528
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 528
+INDIRP4
+RETP4
+ADDRGP4 $133
+JUMPV
+LABELV $144
+ADDRLP4 528
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 520
+ADDRLP4 528
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 520
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+INDIRP4
+RETP4
+LABELV $133
+endproc SelectRandomDeathmatchSpawnPoint 536 12
+proc SelectRandomFurthestSpawnPoint 1448 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 524
+CNSTI4 0
+ASGNI4
+ADDRLP4 520
+CNSTP4 0
+ASGNP4
+ADDRGP4 $148
+JUMPV
+LABELV $147
+ADDRLP4 520
+INDIRP4
+ARGP4
+ADDRLP4 548
+ADDRGP4 SpotWouldTelefrag
+CALLI4
+ASGNI4
+ADDRLP4 548
+INDIRI4
+CNSTI4 0
+EQI4 $150
+ADDRGP4 $148
+JUMPV
+LABELV $150
+ADDRLP4 552
+CNSTI4 0
+ASGNI4
+ADDRLP4 520
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+ADDRLP4 552
+INDIRI4
+EQI4 $155
+ADDRFP4 12
+INDIRI4
+ADDRLP4 552
+INDIRI4
+NEI4 $154
+LABELV $155
+ADDRLP4 556
+CNSTI4 0
+ASGNI4
+ADDRLP4 520
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 16384
+BANDI4
+ADDRLP4 556
+INDIRI4
+EQI4 $152
+ADDRFP4 12
+INDIRI4
+ADDRLP4 556
+INDIRI4
+NEI4 $152
+LABELV $154
+ADDRGP4 $148
+JUMPV
+LABELV $152
+ADDRLP4 532
+ADDRLP4 520
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 532+4
+ADDRLP4 520
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 532+8
+ADDRLP4 520
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 532
+ARGP4
+ADDRLP4 568
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 528
+ADDRLP4 568
+INDIRF4
+ASGNF4
+ADDRLP4 516
+CNSTI4 0
+ASGNI4
+ADDRGP4 $161
+JUMPV
+LABELV $158
+ADDRLP4 528
+INDIRF4
+ADDRLP4 516
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+LEF4 $162
+ADDRLP4 524
+INDIRI4
+CNSTI4 64
+LTI4 $164
+ADDRLP4 524
+CNSTI4 63
+ASGNI4
+LABELV $164
+ADDRLP4 0
+ADDRLP4 524
+INDIRI4
+ASGNI4
+ADDRGP4 $169
+JUMPV
+LABELV $166
+ADDRLP4 572
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 572
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 572
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 576
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 576
+INDIRI4
+ADDRLP4 260
+ADDP4
+ADDRLP4 576
+INDIRI4
+ADDRLP4 260-4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $167
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $169
+ADDRLP4 0
+INDIRI4
+ADDRLP4 516
+INDIRI4
+GTI4 $166
+ADDRLP4 516
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 528
+INDIRF4
+ASGNF4
+ADDRLP4 516
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 260
+ADDP4
+ADDRLP4 520
+INDIRP4
+ASGNP4
+ADDRLP4 524
+ADDRLP4 524
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $160
+JUMPV
+LABELV $162
+LABELV $159
+ADDRLP4 516
+ADDRLP4 516
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $161
+ADDRLP4 516
+INDIRI4
+ADDRLP4 524
+INDIRI4
+LTI4 $158
+LABELV $160
+ADDRLP4 516
+INDIRI4
+ADDRLP4 524
+INDIRI4
+LTI4 $172
+ADDRLP4 524
+INDIRI4
+CNSTI4 128
+GEI4 $172
+ADDRLP4 524
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 528
+INDIRF4
+ASGNF4
+ADDRLP4 524
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 260
+ADDP4
+ADDRLP4 520
+INDIRP4
+ASGNP4
+ADDRLP4 524
+ADDRLP4 524
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $172
+LABELV $148
+ADDRLP4 520
+INDIRP4
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRGP4 $70
+ARGP4
+ADDRLP4 548
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 520
+ADDRLP4 548
+INDIRP4
+ASGNP4
+ADDRLP4 548
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $147
+ADDRLP4 524
+INDIRI4
+CNSTI4 0
+NEI4 $174
+ADDRLP4 520
+CNSTP4 0
+ASGNP4
+ADDRLP4 552
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 552
+INDIRI4
+ASGNI4
+ADDRLP4 516
+ADDRLP4 552
+INDIRI4
+ASGNI4
+ADDRGP4 $179
+JUMPV
+LABELV $176
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $181
+JUMPV
+LABELV $180
+ADDRLP4 556+92
+ADDRLP4 520
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 556+92+4
+ADDRLP4 520
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 556+92+8
+ADDRLP4 520
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+CNSTF4 1091567616
+ADDF4
+ADDRLP4 516
+INDIRI4
+CNSTI4 6
+LSHI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 1388
+ARGP4
+ADDRLP4 520
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+ADDRGP4 playerMins
+ARGP4
+ADDRGP4 playerMaxs
+ARGP4
+ADDRLP4 556+92
+ARGP4
+CNSTI4 1023
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 1388+8
+INDIRF4
+CNSTF4 1065353216
+EQF4 $189
+ADDRGP4 $181
+JUMPV
+LABELV $189
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 556
+ARGP4
+ADDRLP4 1444
+ADDRGP4 SpotWouldTelefrag
+CALLI4
+ASGNI4
+ADDRLP4 1444
+INDIRI4
+CNSTI4 0
+EQI4 $192
+ADDRGP4 $181
+JUMPV
+LABELV $192
+ADDRFP4 4
+INDIRP4
+ADDRLP4 556+92
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+ADDRLP4 520
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 520
+INDIRP4
+RETP4
+ADDRGP4 $146
+JUMPV
+LABELV $181
+ADDRLP4 520
+INDIRP4
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRGP4 $70
+ARGP4
+ADDRLP4 556
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 520
+ADDRLP4 556
+INDIRP4
+ASGNP4
+ADDRLP4 556
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $180
+LABELV $177
+ADDRLP4 516
+ADDRLP4 516
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $179
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $176
+CNSTP4 0
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRGP4 $70
+ARGP4
+ADDRLP4 556
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 520
+ADDRLP4 556
+INDIRP4
+ASGNP4
+ADDRLP4 520
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $195
+ADDRGP4 $197
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $195
+ADDRFP4 4
+INDIRP4
+ADDRLP4 520
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 560
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 560
+INDIRP4
+ADDRLP4 560
+INDIRP4
+INDIRF4
+CNSTF4 1091567616
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 520
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 520
+INDIRP4
+RETP4
+ADDRGP4 $146
+JUMPV
+LABELV $174
+ADDRLP4 552
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 556
+CNSTI4 2
+ASGNI4
+ADDRLP4 544
+ADDRLP4 552
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+ADDRLP4 524
+INDIRI4
+ADDRLP4 556
+INDIRI4
+DIVI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 544
+INDIRI4
+ADDRLP4 556
+INDIRI4
+LSHI4
+ADDRLP4 260
+ADDP4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 560
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 560
+INDIRP4
+ADDRLP4 560
+INDIRP4
+INDIRF4
+CNSTF4 1091567616
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 544
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 260
+ADDP4
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 544
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 260
+ADDP4
+INDIRP4
+RETP4
+LABELV $146
+endproc SelectRandomFurthestSpawnPoint 1448 28
+export SelectSpawnPoint
+proc SelectSpawnPoint 4 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 SelectRandomFurthestSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $198
+endproc SelectSpawnPoint 4 16
+proc SelectInitialSpawnPoint 24 16
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $201
+JUMPV
+LABELV $200
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+ADDRLP4 4
+INDIRI4
+EQI4 $206
+ADDRFP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $205
+LABELV $206
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 16384
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $203
+ADDRFP4 8
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $203
+LABELV $205
+ADDRGP4 $201
+JUMPV
+LABELV $203
+ADDRLP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $207
+ADDRGP4 $202
+JUMPV
+LABELV $207
+LABELV $201
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRGP4 $70
+ARGP4
+ADDRLP4 4
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $200
+LABELV $202
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $211
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 SpotWouldTelefrag
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $209
+LABELV $211
+ADDRGP4 vec3_origin
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 SelectSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+RETP4
+ADDRGP4 $199
+JUMPV
+LABELV $209
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+CNSTF4 1091567616
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $199
+endproc SelectInitialSpawnPoint 24 16
+export SelectSpectatorSpawnPoint
+proc SelectSpectatorSpawnPoint 0 0
+ADDRGP4 FindIntermissionPoint
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRGP4 level+9184
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+ADDRGP4 level+9196
+INDIRB
+ASGNB 12
+CNSTP4 0
+RETP4
+LABELV $212
+endproc SelectSpectatorSpawnPoint 0 0
+export InitBodyQue
+proc InitBodyQue 12 0
+ADDRGP4 level+9216
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $217
+ADDRLP4 8
+ADDRGP4 G_Spawn
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRGP4 $221
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+9220
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $218
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $217
+LABELV $215
+endproc InitBodyQue 12 0
+export BodySink
+proc BodySink 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $224
+ADDRLP4 0
+CNSTI4 956
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $224
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $224
+ADDRFP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 5000
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 644
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+ADDRGP4 $223
+JUMPV
+LABELV $224
+ADDRGP4 level+68
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 644
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 6500
+LEI4 $229
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $223
+JUMPV
+LABELV $229
+ADDRFP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 200
+ADDI4
+ASGNI4
+LABELV $223
+endproc BodySink 4 4
+export CopyToBodyQue
+proc CopyToBodyQue 52 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+CNSTU4 2147483648
+BANDU4
+CNSTU4 0
+EQU4 $234
+ADDRGP4 $233
+JUMPV
+LABELV $234
+ADDRGP4 level+9168
+INDIRI4
+CNSTI4 0
+EQI4 $236
+ADDRGP4 $233
+JUMPV
+LABELV $236
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+9220
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 208
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $240
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $240
+ADDRLP4 12
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $240
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $241
+JUMPV
+LABELV $240
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+LABELV $241
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 644
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 568
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 G_PushablesChanged
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 1023
+NEI4 $245
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $246
+JUMPV
+LABELV $245
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $246
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+LTI4 $248
+ADDRLP4 20
+INDIRI4
+CNSTI4 5
+GTI4 $248
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $254
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $254
+address $251
+address $251
+address $252
+address $252
+address $253
+address $253
+code
+LABELV $251
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 $249
+JUMPV
+LABELV $252
+ADDRLP4 40
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $249
+JUMPV
+LABELV $253
+LABELV $248
+ADDRLP4 48
+CNSTI4 5
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+LABELV $249
+ADDRLP4 28
+CNSTI4 424
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 436
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 36
+CNSTI4 448
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 40
+CNSTI4 464
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 44
+CNSTI4 476
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+CNSTI4 65537
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+CNSTI4 67108864
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 1000
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ADDRGP4 BodySink
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+ADDRGP4 body_die
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRI4
+CNSTI4 -200
+GTI4 $256
+ADDRLP4 0
+INDIRP4
+CNSTI4 748
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $257
+JUMPV
+LABELV $256
+ADDRLP4 0
+INDIRP4
+CNSTI4 748
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $257
+ADDRLP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+LABELV $233
+endproc CopyToBodyQue 52 8
+export SetClientViewAngle
+proc SetClientViewAngle 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $259
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4
+CNSTF4 1199570944
+ADDRLP4 8
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+MULF4
+CNSTF4 1135869952
+DIVF4
+CVFI4 4
+CNSTI4 65535
+BANDI4
+ASGNI4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 476
+ADDP4
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $260
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $259
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $258
+endproc SetClientViewAngle 16 0
+export respawn
+proc respawn 24 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CopyToBodyQue
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ClientSpawn
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+GEI4 $264
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+CNSTI4 43
+ARGI4
+ADDRLP4 4
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $265
+JUMPV
+LABELV $264
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $268
+ADDRLP4 8
+CNSTI4 45
+ASGNI4
+ADDRGP4 $269
+JUMPV
+LABELV $268
+ADDRLP4 8
+CNSTI4 47
+ASGNI4
+LABELV $269
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+LABELV $265
+ADDRLP4 20
+CNSTI4 168
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $263
+endproc respawn 24 8
+export TeamCount
+proc TeamCount 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $274
+JUMPV
+LABELV $271
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $276
+ADDRGP4 $272
+JUMPV
+LABELV $276
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $278
+ADDRGP4 $272
+JUMPV
+LABELV $278
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 628
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $280
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $280
+LABELV $272
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $274
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $271
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $270
+endproc TeamCount 8 0
+export TeamLeader
+proc TeamLeader 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $286
+JUMPV
+LABELV $283
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $288
+ADDRGP4 $284
+JUMPV
+LABELV $288
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 628
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $290
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 652
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $292
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $282
+JUMPV
+LABELV $292
+LABELV $290
+LABELV $284
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $286
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $283
+CNSTI4 -1
+RETI4
+LABELV $282
+endproc TeamLeader 4 0
+export PickTeam
+proc PickTeam 24 8
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRLP4 16
+ADDRGP4 TeamCount
+CALLI4
+ASGNI4
+ADDRLP4 0+8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 20
+ADDRGP4 TeamCount
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0+8
+INDIRI4
+ADDRLP4 0+4
+INDIRI4
+LEI4 $297
+CNSTI4 1
+RETI4
+ADDRGP4 $294
+JUMPV
+LABELV $297
+ADDRLP4 0+4
+INDIRI4
+ADDRLP4 0+8
+INDIRI4
+LEI4 $301
+CNSTI4 2
+RETI4
+ADDRGP4 $294
+JUMPV
+LABELV $301
+ADDRGP4 level+80+8
+INDIRI4
+ADDRGP4 level+80+4
+INDIRI4
+LEI4 $305
+CNSTI4 1
+RETI4
+ADDRGP4 $294
+JUMPV
+LABELV $305
+CNSTI4 2
+RETI4
+LABELV $294
+endproc PickTeam 24 8
+proc ClientCleanName 20 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $315
+JUMPV
+LABELV $312
+LABELV $313
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $315
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+EQI4 $312
+ADDRGP4 $319
+JUMPV
+LABELV $316
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+NEI4 $320
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LEI4 $322
+ADDRGP4 $317
+JUMPV
+LABELV $322
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $321
+JUMPV
+LABELV $320
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $324
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $324
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_IsColorString
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $326
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+CNSTI4 0
+NEI4 $325
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $317
+JUMPV
+LABELV $326
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $325
+JUMPV
+LABELV $324
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $325
+LABELV $321
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $317
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $319
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $330
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+LTI4 $316
+LABELV $330
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 12
+INDIRI4
+EQI4 $333
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $331
+LABELV $333
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $334
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $331
+LABELV $311
+endproc ClientCleanName 20 12
+bss
+align 4
+LABELV $336
+skip 9876
+export ClientUserinfoChanged
+code
+proc ClientUserinfoChanged 4356 52
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 1032
+CNSTI4 832
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1032
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 4252
+ADDRGP4 Info_Validate
+CALLI4
+ASGNI4
+ADDRLP4 4252
+INDIRI4
+CNSTI4 0
+NEI4 $337
+ADDRLP4 8
+ARGP4
+ADDRGP4 $339
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $340
+ARGP4
+ADDRGP4 trap_DropClient
+CALLV
+pop
+LABELV $337
+ADDRGP4 $336
+ARGP4
+CNSTI4 1024
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 Info_DictInit
+CALLV
+pop
+ADDRGP4 $336
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 Info_DictParse
+CALLV
+pop
+ADDRGP4 $336
+ARGP4
+ADDRGP4 $341
+ARGP4
+ADDRLP4 4256
+ADDRGP4 Info_DictValue
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4256
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $344
+ARGP4
+ADDRLP4 4260
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 4260
+INDIRI4
+CNSTI4 0
+EQI4 $346
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $345
+ARGP4
+ADDRLP4 4264
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 4264
+INDIRI4
+CNSTI4 0
+NEI4 $342
+LABELV $346
+ADDRLP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $342
+ADDRGP4 $336
+ARGP4
+ADDRGP4 $347
+ARGP4
+ADDRLP4 4268
+ADDRGP4 Info_DictValue
+CALLP4
+ASGNP4
+ADDRLP4 4268
+INDIRP4
+ARGP4
+ADDRLP4 4272
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+ADDRLP4 4272
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+CNSTI4 1000
+GEI4 $348
+ADDRLP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+CNSTI4 25000
+ASGNI4
+LABELV $348
+ADDRGP4 $336
+ARGP4
+ADDRGP4 $350
+ARGP4
+ADDRLP4 4276
+ADDRGP4 Info_DictValue
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4276
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4280
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4280
+INDIRI4
+CNSTI4 0
+NEI4 $351
+ADDRLP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $352
+JUMPV
+LABELV $351
+ADDRLP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $352
+ADDRLP4 2188
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $336
+ARGP4
+ADDRGP4 $353
+ARGP4
+ADDRLP4 4284
+ADDRGP4 Info_DictValue
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4284
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientCleanName
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $357
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $354
+ADDRLP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $354
+LABELV $357
+ADDRLP4 0
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $358
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRGP4 $360
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $358
+LABELV $354
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $361
+ADDRLP4 2188
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 4292
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 4292
+INDIRI4
+CNSTI4 0
+EQI4 $363
+ADDRGP4 $365
+ARGP4
+ADDRLP4 2188
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 4296
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 4296
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $363
+LABELV $361
+ADDRGP4 $336
+ARGP4
+ADDRGP4 $366
+ARGP4
+ADDRLP4 4292
+ADDRGP4 Info_DictValue
+CALLP4
+ASGNP4
+ADDRLP4 4292
+INDIRP4
+ARGP4
+ADDRLP4 4296
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4240
+ADDRLP4 4296
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+ADDRLP4 4240
+INDIRI4
+ASGNI4
+ADDRLP4 4300
+ADDRLP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4300
+INDIRI4
+CNSTI4 1
+LTI4 $369
+ADDRLP4 4300
+INDIRI4
+CNSTI4 100
+LEI4 $367
+LABELV $369
+ADDRLP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+CNSTI4 100
+ASGNI4
+LABELV $367
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+LTI4 $370
+ADDRGP4 $336
+ARGP4
+ADDRGP4 $373
+ARGP4
+ADDRLP4 4308
+ADDRGP4 Info_DictValue
+CALLP4
+ASGNP4
+ADDRLP4 1036
+ARGP4
+ADDRLP4 4308
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $336
+ARGP4
+ADDRGP4 $374
+ARGP4
+ADDRLP4 4312
+ADDRGP4 Info_DictValue
+CALLP4
+ASGNP4
+ADDRLP4 1100
+ARGP4
+ADDRLP4 4312
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $371
+JUMPV
+LABELV $370
+ADDRGP4 $336
+ARGP4
+ADDRGP4 $375
+ARGP4
+ADDRLP4 4308
+ADDRGP4 Info_DictValue
+CALLP4
+ASGNP4
+ADDRLP4 1036
+ARGP4
+ADDRLP4 4308
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $336
+ARGP4
+ADDRGP4 $376
+ARGP4
+ADDRLP4 4312
+ADDRGP4 Info_DictValue
+CALLP4
+ASGNP4
+ADDRLP4 1100
+ARGP4
+ADDRLP4 4312
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $371
+ADDRLP4 4244
+ADDRLP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $336
+ARGP4
+ADDRGP4 $377
+ARGP4
+ADDRLP4 4308
+ADDRGP4 Info_DictValue
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4308
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $380
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4316
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4316
+INDIRI4
+CNSTI4 0
+EQI4 $378
+LABELV $380
+ADDRLP4 0
+INDIRP4
+CNSTI4 612
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $379
+JUMPV
+LABELV $378
+ADDRLP4 0
+INDIRP4
+CNSTI4 612
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $379
+ADDRLP4 4236
+ADDRLP4 0
+INDIRP4
+CNSTI4 652
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $336
+ARGP4
+ADDRGP4 $381
+ARGP4
+ADDRLP4 4320
+ADDRGP4 Info_DictValue
+CALLP4
+ASGNP4
+ADDRLP4 1164
+ARGP4
+ADDRLP4 4320
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $336
+ARGP4
+ADDRGP4 $382
+ARGP4
+ADDRLP4 4324
+ADDRGP4 Info_DictValue
+CALLP4
+ASGNP4
+ADDRLP4 3212
+ARGP4
+ADDRLP4 4324
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1032
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $383
+ADDRLP4 4336
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4332
+CNSTF4 1086115021
+ADDRLP4 4336
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $385
+ARGP4
+ADDRLP4 4332
+INDIRI4
+ARGI4
+ADDRLP4 4340
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4328
+ADDRLP4 4340
+INDIRP4
+ASGNP4
+ADDRGP4 $336
+ARGP4
+ADDRGP4 $387
+ARGP4
+ADDRLP4 4344
+ADDRGP4 Info_DictValue
+CALLP4
+ASGNP4
+ADDRGP4 $386
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 4244
+INDIRI4
+ARGI4
+ADDRLP4 1036
+ARGP4
+ADDRLP4 1100
+ARGP4
+ADDRLP4 1164
+ARGP4
+ADDRLP4 4328
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 644
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 648
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4344
+INDIRP4
+ARGP4
+ADDRLP4 4236
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 660
+ADDP4
+ARGP4
+ADDRLP4 4352
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4352
+INDIRP4
+ASGNP4
+ADDRGP4 $384
+JUMPV
+LABELV $383
+ADDRGP4 $388
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1036
+ARGP4
+ADDRLP4 1100
+ARGP4
+ADDRLP4 1164
+ARGP4
+ADDRLP4 3212
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 644
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 648
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4236
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 660
+ADDP4
+ARGP4
+ADDRLP4 4332
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4332
+INDIRP4
+ASGNP4
+LABELV $384
+ADDRFP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $389
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+LABELV $335
+endproc ClientUserinfoChanged 4356 52
+export ClientConnect
+proc ClientConnect 1072 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+CNSTI4 832
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 Info_Validate
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $391
+ADDRGP4 $393
+RETP4
+ADDRGP4 $390
+JUMPV
+LABELV $391
+ADDRLP4 4
+ARGP4
+ADDRGP4 $341
+ARGP4
+ADDRLP4 1044
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1032
+ADDRLP4 1044
+INDIRP4
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 G_FilterPacket
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+EQI4 $394
+ADDRGP4 $396
+RETP4
+ADDRGP4 $390
+JUMPV
+LABELV $394
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $397
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $344
+ARGP4
+ADDRLP4 1052
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+EQI4 $397
+ADDRLP4 4
+ARGP4
+ADDRGP4 $399
+ARGP4
+ADDRLP4 1056
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1032
+ADDRLP4 1056
+INDIRP4
+ASGNP4
+ADDRGP4 g_password+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $400
+ADDRGP4 g_password+16
+ARGP4
+ADDRGP4 $404
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+EQI4 $400
+ADDRGP4 g_password+16
+ARGP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRLP4 1064
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+EQI4 $400
+ADDRGP4 $406
+RETP4
+ADDRGP4 $390
+JUMPV
+LABELV $400
+LABELV $397
+ADDRLP4 1028
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $407
+ADDRLP4 1056
+ADDRLP4 1028
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ASGNI4
+ADDRGP4 $409
+ARGP4
+ADDRLP4 1056
+INDIRI4
+ARGI4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRLP4 1056
+INDIRI4
+ARGI4
+ADDRGP4 ClientDisconnect
+CALLV
+pop
+LABELV $407
+ADDRLP4 1028
+INDIRP4
+CNSTI4 516
+ADDP4
+CNSTI4 956
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1028
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 956
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 1056
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 1056
+INDIRI4
+NEI4 $413
+ADDRGP4 level+100
+INDIRI4
+ADDRLP4 1056
+INDIRI4
+EQI4 $410
+LABELV $413
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_InitSessionData
+CALLV
+pop
+LABELV $410
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_ReadSessionData
+CALLV
+pop
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $414
+ADDRLP4 1060
+ADDRLP4 1028
+INDIRP4
+CNSTI4 424
+ADDP4
+ASGNP4
+ADDRLP4 1060
+INDIRP4
+ADDRLP4 1060
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+ADDRLP4 1028
+INDIRP4
+CNSTI4 520
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $419
+ADDRLP4 1064
+CNSTI4 1
+ASGNI4
+ADDRGP4 $420
+JUMPV
+LABELV $419
+ADDRLP4 1064
+CNSTI4 0
+ASGNI4
+LABELV $420
+ADDRLP4 1064
+INDIRI4
+ARGI4
+ADDRLP4 1068
+ADDRGP4 G_BotConnect
+CALLI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+NEI4 $416
+ADDRGP4 $421
+RETP4
+ADDRGP4 $390
+JUMPV
+LABELV $416
+LABELV $414
+ADDRLP4 4
+ARGP4
+ADDRGP4 $423
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $341
+ARGP4
+ADDRLP4 1064
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $422
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1060
+INDIRP4
+ARGP4
+ADDRLP4 1064
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $424
+ADDRGP4 $426
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 1068
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 1068
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $424
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+LTI4 $427
+ADDRLP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $427
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 BroadcastTeamChange
+CALLV
+pop
+LABELV $427
+ADDRGP4 CalculateRanks
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $430
+ADDRGP4 SendScoreboardMessageToAllClients
+CALLV
+pop
+LABELV $430
+CNSTP4 0
+RETP4
+LABELV $390
+endproc ClientConnect 1072 16
+export ClientBegin
+proc ClientBegin 52 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 832
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 956
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 416
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $434
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+LABELV $434
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_InitGentity
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 716
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 724
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 468
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 ClientSpawn
+CALLV
+pop
+ADDRGP4 level+9476
+INDIRI4
+CNSTI4 0
+EQI4 $437
+ADDRGP4 $433
+JUMPV
+LABELV $437
+ADDRLP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $440
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $443
+ADDRLP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $440
+LABELV $443
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+GEI4 $444
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+CNSTI4 43
+ARGI4
+ADDRLP4 28
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRGP4 $445
+JUMPV
+LABELV $444
+ADDRLP4 36
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $448
+ADDRLP4 32
+CNSTI4 45
+ASGNI4
+ADDRGP4 $449
+JUMPV
+LABELV $448
+ADDRLP4 32
+CNSTI4 47
+ASGNI4
+LABELV $449
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 40
+INDIRP4
+ASGNP4
+LABELV $445
+ADDRLP4 44
+CNSTI4 168
+ASGNI4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+EQI4 $450
+ADDRGP4 $453
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $450
+LABELV $440
+ADDRGP4 $454
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 CalculateRanks
+CALLV
+pop
+LABELV $433
+endproc ClientBegin 52 12
+export ClientSpawn
+proc ClientSpawn 1448 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 84
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 0
+EQI4 $456
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+ADDRGP4 g_LPS_startlives+12
+INDIRI4
+ASGNI4
+LABELV $456
+ADDRLP4 1376
+CNSTF4 0
+ASGNF4
+ADDRLP4 72+8
+ADDRLP4 1376
+INDIRF4
+ASGNF4
+ADDRLP4 72+4
+ADDRLP4 1376
+INDIRF4
+ASGNF4
+ADDRLP4 72
+ADDRLP4 1376
+INDIRF4
+ASGNF4
+ADDRLP4 1380
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+9476
+INDIRI4
+ADDRLP4 1380
+INDIRI4
+EQI4 $462
+ADDRFP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 1380
+INDIRI4
+EQI4 $462
+ADDRLP4 72
+ADDRGP4 level+9480
+INDIRB
+ASGNB 12
+ADDRLP4 1116
+ADDRGP4 level+9492
+INDIRB
+ASGNB 12
+ADDRLP4 1368
+CNSTP4 0
+ASGNP4
+ADDRGP4 $463
+JUMPV
+LABELV $462
+ADDRLP4 4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $470
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $467
+ADDRLP4 4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $467
+LABELV $470
+ADDRLP4 72
+ARGP4
+ADDRLP4 1116
+ARGP4
+ADDRLP4 1388
+ADDRGP4 SelectSpectatorSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 1368
+ADDRLP4 1388
+INDIRP4
+ASGNP4
+ADDRGP4 $468
+JUMPV
+LABELV $467
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+LTI4 $471
+ADDRLP4 4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 556
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 72
+ARGP4
+ADDRLP4 1116
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $475
+ADDRLP4 1388
+CNSTI4 1
+ASGNI4
+ADDRGP4 $476
+JUMPV
+LABELV $475
+ADDRLP4 1388
+CNSTI4 0
+ASGNI4
+LABELV $476
+ADDRLP4 1388
+INDIRI4
+ARGI4
+ADDRLP4 1396
+ADDRGP4 SelectCTFSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 1368
+ADDRLP4 1396
+INDIRP4
+ASGNP4
+ADDRGP4 $472
+JUMPV
+LABELV $471
+ADDRLP4 1392
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 500
+ADDP4
+INDIRI4
+ADDRLP4 1392
+INDIRI4
+NEI4 $477
+ADDRLP4 4
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRI4
+ADDRLP4 1392
+INDIRI4
+EQI4 $477
+ADDRLP4 4
+INDIRP4
+CNSTI4 500
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 72
+ARGP4
+ADDRLP4 1116
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $480
+ADDRLP4 1396
+CNSTI4 1
+ASGNI4
+ADDRGP4 $481
+JUMPV
+LABELV $480
+ADDRLP4 1396
+CNSTI4 0
+ASGNI4
+LABELV $481
+ADDRLP4 1396
+INDIRI4
+ARGI4
+ADDRLP4 1400
+ADDRGP4 SelectInitialSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 1368
+ADDRLP4 1400
+INDIRP4
+ASGNP4
+ADDRGP4 $478
+JUMPV
+LABELV $477
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 1116
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $483
+ADDRLP4 1396
+CNSTI4 1
+ASGNI4
+ADDRGP4 $484
+JUMPV
+LABELV $483
+ADDRLP4 1396
+CNSTI4 0
+ASGNI4
+LABELV $484
+ADDRLP4 1396
+INDIRI4
+ARGI4
+ADDRLP4 1400
+ADDRGP4 SelectSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 1368
+ADDRLP4 1400
+INDIRP4
+ASGNP4
+LABELV $478
+LABELV $472
+LABELV $468
+LABELV $463
+ADDRLP4 4
+INDIRP4
+CNSTI4 556
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 88
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CNSTI4 540676
+BANDI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 88
+INDIRI4
+CNSTI4 4
+BXORI4
+ASGNI4
+ADDRLP4 1128
+ADDRLP4 4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRB
+ASGNB 160
+ADDRLP4 1288
+ADDRLP4 4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRB
+ASGNB 64
+ADDRLP4 1352
+ADDRLP4 4
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1356
+ADDRLP4 4
+INDIRP4
+CNSTI4 812
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1360
+ADDRLP4 4
+INDIRP4
+CNSTI4 808
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $485
+ADDRLP4 1392
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1392
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 1392
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $486
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $485
+ADDRLP4 1364
+ADDRLP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 956
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 468
+ADDP4
+ADDRLP4 1128
+INDIRB
+ASGNB 160
+ADDRLP4 4
+INDIRP4
+CNSTI4 628
+ADDP4
+ADDRLP4 1288
+INDIRB
+ASGNB 64
+ADDRLP4 4
+INDIRP4
+CNSTI4 452
+ADDP4
+ADDRLP4 1352
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 812
+ADDP4
+ADDRLP4 1356
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 808
+ADDP4
+ADDRLP4 1360
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 824
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $489
+ADDRLP4 1396
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1396
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+ADDRLP4 1396
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $490
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $489
+ADDRLP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+ADDRLP4 1364
+INDIRI4
+ASGNI4
+ADDRLP4 1396
+ADDRLP4 4
+INDIRP4
+CNSTI4 264
+ADDP4
+ASGNP4
+ADDRLP4 1396
+INDIRP4
+ADDRLP4 1396
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 252
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 852
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 12000
+ADDI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRLP4 92
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 92
+ARGP4
+ADDRGP4 $366
+ARGP4
+ADDRLP4 1404
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1404
+INDIRP4
+ARGP4
+ADDRLP4 1408
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 548
+ADDP4
+ADDRLP4 1408
+INDIRI4
+ASGNI4
+ADDRLP4 1412
+ADDRLP4 4
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1412
+INDIRI4
+CNSTI4 1
+LTI4 $496
+ADDRLP4 1412
+INDIRI4
+CNSTI4 100
+LEI4 $494
+LABELV $496
+ADDRLP4 4
+INDIRP4
+CNSTI4 548
+ADDP4
+CNSTI4 100
+ASGNI4
+LABELV $494
+ADDRLP4 4
+INDIRP4
+CNSTI4 208
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 1023
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+CNSTI4 956
+ADDRLP4 84
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 748
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRGP4 $497
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_EntityIndexChanged
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+CNSTI4 33554432
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+CNSTI4 33619969
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+ADDRGP4 player_die
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 800
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 880
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ADDRGP4 playerMins
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+ADDRGP4 playerMaxs
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRGP4 g_modInstagib+12
+INDIRI4
+CNSTI4 0
+EQI4 $498
+ADDRLP4 1424
+ADDRGP4 Instagib_getSpawnWeapon
+CALLI4
+ASGNI4
+ADDRLP4 1420
+ADDRLP4 1424
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 1
+ADDRLP4 1420
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 1420
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 376
+ADDP4
+ADDP4
+CNSTI4 1000000
+ASGNI4
+ADDRGP4 $499
+JUMPV
+LABELV $498
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+NEI4 $501
+ADDRLP4 4
+INDIRP4
+CNSTI4 384
+ADDP4
+CNSTI4 50
+ASGNI4
+ADDRGP4 $502
+JUMPV
+LABELV $501
+ADDRLP4 4
+INDIRP4
+CNSTI4 384
+ADDP4
+CNSTI4 100
+ASGNI4
+LABELV $502
+ADDRLP4 1420
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+ASGNP4
+ADDRLP4 1420
+INDIRP4
+ADDRLP4 1420
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 380
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $499
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+EQI4 $508
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 7
+NEI4 $504
+LABELV $508
+ADDRLP4 1420
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+ASGNP4
+ADDRLP4 1420
+INDIRP4
+ADDRLP4 1420
+INDIRP4
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+LABELV $504
+ADDRLP4 1424
+ADDRLP4 4
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 25
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 1424
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ADDRLP4 1424
+INDIRI4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $509
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTI4 100
+ASGNI4
+LABELV $509
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRGP4 G_SetOrigin
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 72
+INDIRB
+ASGNB 12
+ADDRLP4 1428
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 1428
+INDIRP4
+ADDRLP4 1428
+INDIRP4
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRGP4 level
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 956
+DIVI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 472
+ADDP4
+ARGP4
+ADDRGP4 trap_GetUsercmd
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1116
+ARGP4
+ADDRGP4 SetClientViewAngle
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $512
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 1432
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 752
+ADDP4
+ASGNP4
+ADDRLP4 1432
+INDIRP4
+ADDRLP4 1432
+INDIRP4
+INDIRI4
+CNSTI4 5
+BORI4
+ASGNI4
+LABELV $512
+ADDRLP4 1432
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1432
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $517
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $514
+ADDRLP4 1432
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $514
+LABELV $517
+ADDRGP4 $515
+JUMPV
+LABELV $514
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_KillBox
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $515
+ADDRLP4 1436
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 1436
+INDIRP4
+ADDRLP4 1436
+INDIRP4
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 100
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 836
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 840
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 1000
+ADDRGP4 g_inactivity+12
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 760
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTI4 11
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTI4 22
+ASGNI4
+ADDRGP4 level+9168
+INDIRI4
+CNSTI4 0
+EQI4 $521
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 MoveClientToIntermission
+CALLV
+pop
+ADDRGP4 $522
+JUMPV
+LABELV $521
+ADDRLP4 1368
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_UseTargets
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 14
+ASGNI4
+LABELV $524
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+NEI4 $528
+ADDRGP4 $525
+JUMPV
+LABELV $528
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $530
+ADDRLP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $526
+JUMPV
+LABELV $530
+LABELV $525
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $524
+LABELV $526
+LABELV $522
+ADDRLP4 4
+INDIRP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 100
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 472
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 ClientThink
+CALLV
+pop
+ADDRLP4 1440
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1440
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $534
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $537
+ADDRLP4 1440
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $534
+LABELV $537
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityState
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+LABELV $534
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ClientEndFrame
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityState
+CALLV
+pop
+LABELV $455
+endproc ClientSpawn 1448 20
+export ClientDisconnect
+proc ClientDisconnect 40 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 G_RemoveQueuedBotBegin
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 832
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $541
+ADDRLP4 12
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $539
+LABELV $541
+ADDRGP4 $538
+JUMPV
+LABELV $539
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $545
+JUMPV
+LABELV $542
+ADDRLP4 16
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $550
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $547
+ADDRLP4 16
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $547
+LABELV $550
+ADDRLP4 20
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $547
+ADDRLP4 20
+INDIRP4
+CNSTI4 640
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $547
+CNSTI4 832
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRGP4 StopFollowing
+CALLV
+pop
+LABELV $547
+LABELV $543
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $545
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $542
+ADDRGP4 level+9476
+INDIRI4
+CNSTI4 0
+NEI4 $551
+ADDRLP4 16
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $554
+ADDRLP4 16
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $554
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $557
+ADDRLP4 16
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $554
+LABELV $557
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+GEI4 $558
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+CNSTI4 44
+ARGI4
+ADDRLP4 20
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRGP4 $559
+JUMPV
+LABELV $558
+ADDRLP4 28
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $562
+ADDRLP4 24
+CNSTI4 46
+ASGNI4
+ADDRGP4 $563
+JUMPV
+LABELV $562
+ADDRLP4 24
+CNSTI4 48
+ASGNI4
+LABELV $563
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 32
+INDIRP4
+ASGNP4
+LABELV $559
+ADDRLP4 8
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 36
+CNSTI4 168
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 TossClientItems
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 RemoveOwnedItems
+CALLV
+pop
+LABELV $554
+ADDRGP4 $564
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+LABELV $551
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+NEI4 $565
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+9168
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $565
+ADDRGP4 level+16
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $565
+ADDRGP4 level+124+4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $565
+ADDRLP4 20
+CNSTI4 956
+ADDRGP4 level+124
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 644
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 level+124
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+LABELV $565
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 160
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 520
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRGP4 $574
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_EntityIndexChanged
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 468
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 252
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRGP4 $575
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 CalculateRanks
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $576
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotAIShutdownClient
+CALLI4
+pop
+LABELV $576
+LABELV $538
+endproc ClientDisconnect 40 8
+import trap_AAS_BestReachableArea
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntities
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_RealTime
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_EntitiesInPVS
+import trap_RestoreClients
+import trap_RewindClients
+import trap_GetUsercmds
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_TraceBatch
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import g_logDamage
+import g_modInstagib_WeaponJump
+import g_modInstagib
+import g_transmitSVboastermissiles
+import g_KillerduckHealth
+import g_LPS_flags
+import g_LPS_startlives
+import g_skyLensflare
+import g_sky
+import g_q3Items
+import pmove_msec
+import pmove_fixed
+import g_antilag
+import g_smoothClients
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_curWarmupReady
+import g_warmupReady
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import MapSupportsGametype
+import G_GetArenaInfoByMap
+import G_InitGameinfo
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import AI_RemoveBambam
+import AI_AddBambam
+import AI_RemoveBoomie
+import AI_AddBoomie
+import BotCamViewangles
+import BotCamViewTarget
+import BotCamViewEntitiy
+import BotChooseWeap
+import BotCamFire
+import BotCamTaunt
+import BotCamMoveTo
+import BotCamMode
+import BotInterbreedEndMatch
+import Svcmd_BotStats_f
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_LoadBots
+import CantDamageTeamitem
+import boomies_createByPlayer
+import bambam_createByPlayer
+import IsItemSameTeam
+import Instagib_canSpawnEntity
+import Instagib_isRelevantDamageEvent
+import Instagib_calculateDamage
+import Instagib_getSpawnWeapon
+import Instagib_applyWeaponJumpKnockback
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import PrintMsg
+import CheckObeliskAttack
+import Team_GetFlagStatus
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThinkBatch
+import ClientThink
+import ClientCommand
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogFlush
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import G_GetCvarInt
+import MoveClientToIntermission
+import G_SendScoreboardUpdates
+import DeathmatchScoreboardMessage
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import CalculateRanks
+import AddScore
+import player_die
+import BeginIntermission
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import Touch_DoorTrigger
+import G_PushablesChanged
+import G_RunMover
+import fire_kma
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_bubbleg
+import fire_bambamMissile
+import fire_duck
+import explode_imperius
+import fire_splasher
+import fire_nipper
+import fire_boaster
+import G_RunExplosion
+import G_RunMissile
+import BerserkerCheck
+import TossClientCubes
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import GametypeNameShort
+import GametypeName
+import RemoveOwnedItems
+import SetAward
+import G_RestorePowerups
+import G_BackupPowerups
+import DeleteDebugLines
+import DebugLineDouble
+import DebugLine
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_NextActiveEntity
+import G_InitEntityLists
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_FindAll
+import G_Find
+import G_EntityIndexChanged
+import G_InitEntityIndex
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import G_Say
+import ConcatArgs
+import Cmd_DropCartridge_f
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $575
+byte 1 0
+align 1
+LABELV $574
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $564
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 68
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $497
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $454
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 66
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $453
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $426
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $423
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 103
+byte 1 117
+byte 1 105
+byte 1 100
+byte 1 0
+align 1
+LABELV $422
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $421
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $409
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $406
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $404
+byte 1 110
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $399
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $396
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 0
+align 1
+LABELV $393
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 46
+byte 1 0
+align 1
+LABELV $389
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $388
+byte 1 110
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 116
+byte 1 92
+byte 1 37
+byte 1 105
+byte 1 92
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 104
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 99
+byte 1 49
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 99
+byte 1 50
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 104
+byte 1 99
+byte 1 92
+byte 1 37
+byte 1 105
+byte 1 92
+byte 1 119
+byte 1 92
+byte 1 37
+byte 1 105
+byte 1 92
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 105
+byte 1 92
+byte 1 116
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 100
+byte 1 92
+byte 1 115
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $387
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $386
+byte 1 110
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 116
+byte 1 92
+byte 1 37
+byte 1 105
+byte 1 92
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 104
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 99
+byte 1 49
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 99
+byte 1 50
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 104
+byte 1 99
+byte 1 92
+byte 1 37
+byte 1 105
+byte 1 92
+byte 1 119
+byte 1 92
+byte 1 37
+byte 1 105
+byte 1 92
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 105
+byte 1 92
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 116
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 100
+byte 1 92
+byte 1 115
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $385
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $382
+byte 1 115
+byte 1 121
+byte 1 99
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $381
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $377
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $376
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $375
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $374
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $373
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $366
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $365
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $360
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $353
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $350
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $347
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $345
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $344
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $341
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $340
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 0
+align 1
+LABELV $339
+byte 1 92
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 92
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 0
+align 1
+LABELV $334
+byte 1 85
+byte 1 110
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $221
+byte 1 98
+byte 1 111
+byte 1 100
+byte 1 121
+byte 1 113
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $197
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 40
+byte 1 83
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 82
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 70
+byte 1 117
+byte 1 114
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 41
+byte 1 0
+align 1
+LABELV $124
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $111
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $70
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $66
+byte 1 110
+byte 1 111
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $63
+byte 1 48
+byte 1 0
+align 1
+LABELV $62
+byte 1 110
+byte 1 111
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 0
@@ -0,0 +1,16155 @@
+code
+proc G_ScoreRow 20 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 956
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $62
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $63
+JUMPV
+LABELV $62
+ADDRLP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRI4
+CNSTI4 999
+GEI4 $65
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $66
+JUMPV
+LABELV $65
+ADDRLP4 4
+CNSTI4 999
+ASGNI4
+LABELV $66
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $63
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 60000
+DIVI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 832
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+188
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 808
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $69
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 100
+ADDRLP4 0
+INDIRP4
+CNSTI4 812
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 808
+ADDP4
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $70
+JUMPV
+LABELV $69
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $70
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 288
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 300
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $72
+ADDRLP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $72
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $73
+JUMPV
+LABELV $72
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $73
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRI4
+CNSTI4 8
+RSHI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRI4
+CNSTI4 255
+BANDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $75
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $76
+JUMPV
+LABELV $75
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $76
+ADDRFP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+LABELV $61
+endproc G_ScoreRow 20 0
+proc G_AppendScoreRow 280 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $78
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 264
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 264
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 260
+CNSTI4 0
+ASGNI4
+LABELV $79
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+ARGP4
+CNSTU4 256
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRGP4 $78
+ARGP4
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 16
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRLP4 276
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+ADDRLP4 276
+INDIRU4
+ADDU4
+CVUI4 4
+ASGNI4
+LABELV $80
+ADDRLP4 260
+ADDRLP4 260
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 16
+LTI4 $79
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ADDRFP4 8
+INDIRI4
+LTI4 $83
+CNSTI4 0
+RETI4
+ADDRGP4 $77
+JUMPV
+LABELV $83
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $77
+endproc G_AppendScoreRow 280 16
+proc G_UpdateScoreRows 108 12
+ADDRGP4 scoreNumSorted
+INDIRI4
+ADDRGP4 level+112
+INDIRI4
+NEI4 $96
+ADDRGP4 scoreTeams
+INDIRI4
+ADDRGP4 level+80+4
+INDIRI4
+NEI4 $96
+ADDRGP4 scoreTeams+4
+INDIRI4
+ADDRGP4 level+80+8
+INDIRI4
+EQI4 $93
+LABELV $96
+ADDRLP4 84
+CNSTI4 1
+ASGNI4
+ADDRGP4 $94
+JUMPV
+LABELV $93
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+LABELV $94
+ADDRLP4 76
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRGP4 scoreNumSorted
+ADDRGP4 level+112
+INDIRI4
+ASGNI4
+ADDRGP4 scoreTeams
+ADDRGP4 level+80+4
+INDIRI4
+ASGNI4
+ADDRGP4 scoreTeams+4
+ADDRGP4 level+80+8
+INDIRI4
+ASGNI4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRGP4 $106
+JUMPV
+LABELV $103
+ADDRLP4 88
+ADDRLP4 80
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 88
+INDIRI4
+ADDRGP4 level+124
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+ADDRGP4 scoreOrder
+ADDP4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+EQI4 $109
+ADDRLP4 80
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 scoreOrder
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 76
+CNSTI4 1
+ASGNI4
+LABELV $109
+ADDRLP4 68
+ADDRLP4 72
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 scoreRows
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_ScoreRow
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $111
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $115
+ADDRLP4 100
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 100
+INDIRI4
+EQI4 $115
+ADDRLP4 104
+ADDRLP4 0
+INDIRI4
+ADDRLP4 100
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+ADDRLP4 68
+INDIRP4
+ADDP4
+INDIRI4
+EQI4 $115
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 scoreRowSequence
+ADDP4
+ADDRGP4 scoreSequence
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 76
+CNSTI4 1
+ASGNI4
+ADDRGP4 $113
+JUMPV
+LABELV $115
+LABELV $112
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $111
+LABELV $113
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTU4 64
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $104
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $106
+ADDRLP4 80
+INDIRI4
+ADDRGP4 level+112
+INDIRI4
+LTI4 $103
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $117
+ADDRLP4 88
+ADDRGP4 scoreSequence
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $117
+LABELV $85
+endproc G_UpdateScoreRows 108 12
+export DeathmatchScoreboardMessage
+proc DeathmatchScoreboardMessage 1020 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 G_UpdateScoreRows
+CALLV
+pop
+ADDRLP4 4
+CNSTI1 0
+ASGNI1
+ADDRLP4 1008
+CNSTI4 0
+ASGNI4
+ADDRLP4 1004
+ADDRLP4 1008
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1008
+INDIRI4
+ASGNI4
+ADDRGP4 $123
+JUMPV
+LABELV $120
+ADDRLP4 4
+ARGP4
+ADDRLP4 1004
+ARGP4
+CNSTI4 1000
+ARGI4
+ADDRLP4 1012
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1012
+INDIRI4
+ADDRGP4 level+124
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1012
+INDIRI4
+ADDRGP4 level+124
+ADDP4
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 scoreRows
+ADDP4
+ARGP4
+ADDRLP4 1016
+ADDRGP4 G_AppendScoreRow
+CALLI4
+ASGNI4
+ADDRLP4 1016
+INDIRI4
+CNSTI4 0
+NEI4 $125
+ADDRGP4 $122
+JUMPV
+LABELV $125
+LABELV $121
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $123
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+112
+INDIRI4
+LTI4 $120
+LABELV $122
+ADDRGP4 $129
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 level+80+4
+INDIRI4
+ARGI4
+ADDRGP4 level+80+8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1012
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRLP4 1012
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 620
+ADDP4
+ADDRGP4 scoreSequence
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 624
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+LABELV $119
+endproc DeathmatchScoreboardMessage 1020 20
+lit
+align 1
+LABELV $136
+byte 1 48
+byte 1 49
+byte 1 50
+byte 1 51
+byte 1 52
+byte 1 53
+byte 1 54
+byte 1 55
+byte 1 56
+byte 1 57
+byte 1 97
+byte 1 98
+byte 1 99
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 0
+code
+proc G_ScoreboardDelta 1184 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $140
+JUMPV
+LABELV $137
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+124
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 1008
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+RSHI4
+CNSTI4 15
+BANDI4
+ADDRGP4 $136
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 1008+1
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 15
+BANDI4
+ADDRGP4 $136
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $138
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $140
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+112
+INDIRI4
+LTI4 $137
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 1008
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 8
+ARGP4
+CNSTI4 1000
+ARGI4
+ADDRGP4 $144
+ARGP4
+ADDRGP4 level+80+4
+INDIRI4
+ARGI4
+ADDRGP4 level+80+8
+INDIRI4
+ARGI4
+ADDRGP4 level+112
+INDIRI4
+ARGI4
+ADDRLP4 1008
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $152
+ADDRLP4 1148
+ADDRLP4 1008
+ASGNP4
+ADDRGP4 $153
+JUMPV
+LABELV $152
+ADDRLP4 1148
+ADDRGP4 $150
+ASGNP4
+LABELV $153
+ADDRLP4 1148
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 1152
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1140
+ADDRLP4 1152
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 1156
+CNSTI4 0
+ASGNI4
+ADDRLP4 1144
+ADDRLP4 1156
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1156
+INDIRI4
+ASGNI4
+ADDRGP4 $157
+JUMPV
+LABELV $154
+ADDRLP4 1160
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1160
+INDIRI4
+LSHI4
+ADDRGP4 level+124
+ADDP4
+INDIRI4
+ADDRLP4 1160
+INDIRI4
+LSHI4
+ADDRGP4 scoreRowSequence
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRI4
+LEI4 $159
+ADDRLP4 1144
+ADDRLP4 1144
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $159
+LABELV $155
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $157
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+112
+INDIRI4
+LTI4 $154
+ADDRLP4 1160
+ADDRLP4 1140
+INDIRI4
+ASGNI4
+ADDRLP4 1160
+INDIRI4
+ADDRLP4 8
+ADDP4
+ARGP4
+CNSTU4 1000
+ADDRLP4 1160
+INDIRI4
+CVIU4 4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRGP4 $78
+ARGP4
+ADDRLP4 1144
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 1164
+ADDRLP4 1140
+INDIRI4
+ASGNI4
+ADDRLP4 1164
+INDIRI4
+ADDRLP4 8
+ADDP4
+ARGP4
+ADDRLP4 1168
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1140
+ADDRLP4 1164
+INDIRI4
+CVIU4 4
+ADDRLP4 1168
+INDIRU4
+ADDU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $165
+JUMPV
+LABELV $162
+ADDRLP4 1172
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1172
+INDIRI4
+LSHI4
+ADDRGP4 level+124
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 1172
+INDIRI4
+LSHI4
+ADDRGP4 scoreRowSequence
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRI4
+GTI4 $168
+ADDRGP4 $163
+JUMPV
+LABELV $168
+ADDRLP4 8
+ARGP4
+ADDRLP4 1140
+ARGP4
+CNSTI4 1000
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 scoreRows
+ADDP4
+ARGP4
+ADDRLP4 1180
+ADDRGP4 G_AppendScoreRow
+CALLI4
+ASGNI4
+ADDRLP4 1180
+INDIRI4
+CNSTI4 0
+NEI4 $170
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 DeathmatchScoreboardMessage
+CALLV
+pop
+ADDRGP4 $135
+JUMPV
+LABELV $170
+LABELV $163
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $165
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+112
+INDIRI4
+LTI4 $162
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 620
+ADDP4
+ADDRGP4 scoreSequence
+INDIRI4
+ASGNI4
+CNSTF4 1120403456
+ARGF4
+CNSTF4 1148846080
+ARGF4
+ADDRLP4 1172
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+CNSTI4 1000
+ADDRLP4 1140
+INDIRI4
+MULI4
+ADDRLP4 1172
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+DIVI4
+CVIF4 4
+ARGF4
+ADDRLP4 1176
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 1172
+INDIRP4
+CNSTI4 624
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ADDRLP4 1176
+INDIRF4
+CVFI4 4
+ADDI4
+ASGNI4
+LABELV $135
+endproc G_ScoreboardDelta 1184 28
+export G_SendScoreboardUpdates
+proc G_SendScoreboardUpdates 16 4
+ADDRGP4 level+108
+INDIRI4
+CNSTI4 0
+EQI4 $174
+ADDRGP4 level+108
+CNSTI4 0
+ASGNI4
+ADDRGP4 G_UpdateScoreRows
+CALLV
+pop
+LABELV $174
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $181
+JUMPV
+LABELV $178
+ADDRLP4 0
+CNSTI4 832
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $185
+ADDRLP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $183
+LABELV $185
+ADDRGP4 $179
+JUMPV
+LABELV $183
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRI4
+ADDRGP4 scoreSequence
+INDIRI4
+GEI4 $189
+ADDRGP4 level+68
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 624
+ADDP4
+INDIRI4
+GEI4 $186
+LABELV $189
+ADDRGP4 $179
+JUMPV
+LABELV $186
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $190
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 DeathmatchScoreboardMessage
+CALLV
+pop
+ADDRGP4 $191
+JUMPV
+LABELV $190
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_ScoreboardDelta
+CALLV
+pop
+LABELV $191
+LABELV $179
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $181
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $178
+LABELV $173
+endproc G_SendScoreboardUpdates 16 4
+export Cmd_Score_f
+proc Cmd_Score_f 0 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 DeathmatchScoreboardMessage
+CALLV
+pop
+LABELV $192
+endproc Cmd_Score_f 0 4
+proc CheatsOk 0 8
+ADDRGP4 g_cheats+12
+INDIRI4
+CNSTI4 0
+NEI4 $194
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $197
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $193
+JUMPV
+LABELV $194
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $198
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $200
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $193
+JUMPV
+LABELV $198
+CNSTI4 1
+RETI4
+LABELV $193
+endproc CheatsOk 0 8
+bss
+align 1
+LABELV $202
+skip 1024
+export ConcatArgs
+code
+proc ConcatArgs 1048 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 1040
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1040
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $206
+JUMPV
+LABELV $203
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 1044
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 1044
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+CNSTI4 1023
+LTI4 $207
+ADDRGP4 $205
+JUMPV
+LABELV $207
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $202
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 8
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 1
+SUBI4
+EQI4 $209
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $202
+ADDP4
+CNSTI1 32
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $209
+LABELV $204
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $206
+ADDRLP4 4
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+LTI4 $203
+LABELV $205
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $202
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $202
+RETP4
+LABELV $201
+endproc ConcatArgs 1048 12
+proc SanitizeString 16 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $213
+JUMPV
+LABELV $212
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 27
+NEI4 $215
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $213
+JUMPV
+LABELV $215
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+GEI4 $217
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $213
+JUMPV
+LABELV $217
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+CVII1 4
+ASGNI1
+LABELV $213
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $212
+ADDRFP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $211
+endproc SanitizeString 16 4
+proc ClientNumberFromString 2072 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 2056
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 2056
+INDIRI4
+CNSTI4 48
+LTI4 $220
+ADDRLP4 2056
+INDIRI4
+CNSTI4 57
+GTI4 $220
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 2060
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 2060
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $225
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $222
+LABELV $225
+ADDRGP4 $226
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 2068
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRLP4 2068
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 -1
+RETI4
+ADDRGP4 $219
+JUMPV
+LABELV $222
+ADDRLP4 0
+CNSTI4 956
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $227
+ADDRGP4 $229
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 2068
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRLP4 2068
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 -1
+RETI4
+ADDRGP4 $219
+JUMPV
+LABELV $227
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $219
+JUMPV
+LABELV $220
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ARGP4
+ADDRGP4 SanitizeString
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 level
+INDIRP4
+ASGNP4
+ADDRGP4 $233
+JUMPV
+LABELV $230
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $235
+ADDRGP4 $231
+JUMPV
+LABELV $235
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 SanitizeString
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 1032
+ARGP4
+ADDRLP4 2060
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 2060
+INDIRI4
+CNSTI4 0
+NEI4 $237
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $219
+JUMPV
+LABELV $237
+LABELV $231
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 956
+ADDP4
+ASGNP4
+LABELV $233
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $230
+ADDRGP4 $239
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 2060
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRLP4 2060
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 -1
+RETI4
+LABELV $219
+endproc ClientNumberFromString 2072 8
+proc Cmd_Give_f 148 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 CheatsOk
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+NEI4 $241
+ADDRGP4 $240
+JUMPV
+LABELV $241
+CNSTI4 1
+ARGI4
+ADDRLP4 80
+ADDRGP4 ConcatArgs
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $245
+ARGP4
+ADDRLP4 84
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+NEI4 $243
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $244
+JUMPV
+LABELV $243
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $244
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $249
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $248
+ARGP4
+ADDRLP4 88
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+NEI4 $246
+LABELV $249
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $250
+ADDRGP4 $240
+JUMPV
+LABELV $250
+LABELV $246
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $255
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $254
+ARGP4
+ADDRLP4 92
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+NEI4 $252
+LABELV $255
+ADDRLP4 96
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 192
+ADDP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 96
+INDIRP4
+INDIRI4
+CNSTI4 2046
+BORI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $256
+ADDRGP4 $240
+JUMPV
+LABELV $256
+LABELV $252
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $261
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $260
+ARGP4
+ADDRLP4 96
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+NEI4 $258
+LABELV $261
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $262
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+NEI4 $266
+ADDRGP4 $263
+JUMPV
+LABELV $266
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+NEI4 $268
+ADDRGP4 $263
+JUMPV
+LABELV $268
+ADDRLP4 0
+INDIRI4
+CNSTI4 14
+NEI4 $270
+ADDRGP4 $263
+JUMPV
+LABELV $270
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 376
+ADDP4
+ADDP4
+CNSTI4 999
+ASGNI4
+LABELV $263
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $262
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $272
+ADDRGP4 $240
+JUMPV
+LABELV $272
+LABELV $258
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $277
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $276
+ARGP4
+ADDRLP4 100
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+NEI4 $274
+LABELV $277
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTI4 200
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $278
+ADDRGP4 $240
+JUMPV
+LABELV $278
+LABELV $274
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $282
+ARGP4
+ADDRLP4 104
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 0
+NEI4 $280
+ADDRLP4 108
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 288
+ADDP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ADDRLP4 108
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $240
+JUMPV
+LABELV $280
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $285
+ARGP4
+ADDRLP4 108
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+NEI4 $283
+ADDRLP4 112
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 284
+ADDP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ADDRLP4 112
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $240
+JUMPV
+LABELV $283
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $288
+ARGP4
+ADDRLP4 112
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 0
+NEI4 $286
+ADDRLP4 116
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 308
+ADDP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 116
+INDIRP4
+INDIRI4
+CNSTI4 256
+ADDI4
+ASGNI4
+ADDRGP4 $240
+JUMPV
+LABELV $286
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $291
+ARGP4
+ADDRLP4 116
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 0
+NEI4 $289
+ADDRLP4 120
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 308
+ADDP4
+ASGNP4
+ADDRLP4 124
+ADDRLP4 120
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 120
+INDIRP4
+ADDRLP4 124
+INDIRI4
+CNSTI4 65280
+BANDI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 255
+BANDI4
+BORI4
+ASGNI4
+ADDRGP4 $240
+JUMPV
+LABELV $289
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $294
+ARGP4
+ADDRLP4 120
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+NEI4 $292
+ADDRLP4 124
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 300
+ADDP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ADDRLP4 124
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BerserkerCheck
+CALLV
+pop
+ADDRGP4 $240
+JUMPV
+LABELV $292
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $297
+ARGP4
+ADDRLP4 124
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+NEI4 $295
+ADDRLP4 128
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 292
+ADDP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ADDRLP4 128
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $240
+JUMPV
+LABELV $295
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $300
+ARGP4
+ADDRLP4 128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+NEI4 $298
+ADDRLP4 132
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 296
+ADDP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ADDRLP4 132
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $240
+JUMPV
+LABELV $298
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $303
+ARGP4
+ADDRLP4 132
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $301
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 28
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 212
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $240
+JUMPV
+LABELV $301
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $306
+ARGP4
+ADDRLP4 136
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+NEI4 $304
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 29
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 212
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $240
+JUMPV
+LABELV $304
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $307
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BG_FindItem
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 140
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $309
+ADDRGP4 $240
+JUMPV
+LABELV $309
+ADDRLP4 144
+ADDRGP4 G_Spawn
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 144
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 12
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRLP4 16
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 G_SpawnItem
+CALLV
+pop
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 FinishSpawningItem
+CALLV
+pop
+ADDRLP4 20
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 56
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 Touch_Item
+CALLV
+pop
+ADDRLP4 12
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $311
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+LABELV $311
+LABELV $307
+LABELV $240
+endproc Cmd_Give_f 148 12
+export Cmd_God_f
+proc Cmd_God_f 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 CheatsOk
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $314
+ADDRGP4 $313
+JUMPV
+LABELV $314
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 16
+BXORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+NEI4 $316
+ADDRLP4 0
+ADDRGP4 $318
+ASGNP4
+ADDRGP4 $317
+JUMPV
+LABELV $316
+ADDRLP4 0
+ADDRGP4 $319
+ASGNP4
+LABELV $317
+ADDRGP4 $320
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $313
+endproc Cmd_God_f 16 8
+export Cmd_Notarget_f
+proc Cmd_Notarget_f 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 CheatsOk
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $322
+ADDRGP4 $321
+JUMPV
+LABELV $322
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 32
+BXORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $324
+ADDRLP4 0
+ADDRGP4 $326
+ASGNP4
+ADDRGP4 $325
+JUMPV
+LABELV $324
+ADDRLP4 0
+ADDRGP4 $327
+ASGNP4
+LABELV $325
+ADDRGP4 $320
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $321
+endproc Cmd_Notarget_f 16 8
+export Cmd_Noclip_f
+proc Cmd_Noclip_f 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 CheatsOk
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $329
+ADDRGP4 $328
+JUMPV
+LABELV $329
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 696
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $331
+ADDRLP4 0
+ADDRGP4 $333
+ASGNP4
+ADDRGP4 $332
+JUMPV
+LABELV $331
+ADDRLP4 0
+ADDRGP4 $334
+ASGNP4
+LABELV $332
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 696
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $336
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $337
+JUMPV
+LABELV $336
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $337
+ADDRLP4 12
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $320
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $328
+endproc Cmd_Noclip_f 20 8
+export Cmd_LevelShot_f
+proc Cmd_LevelShot_f 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $339
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $341
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $338
+JUMPV
+LABELV $339
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 CheatsOk
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $342
+ADDRGP4 $338
+JUMPV
+LABELV $342
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 2
+NEI4 $344
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $347
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $338
+JUMPV
+LABELV $344
+ADDRGP4 BeginIntermission
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $348
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $338
+endproc Cmd_LevelShot_f 4 8
+export Cmd_Kill_f
+proc Cmd_Kill_f 16 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $350
+ADDRGP4 $349
+JUMPV
+LABELV $350
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $352
+ADDRGP4 $349
+JUMPV
+LABELV $352
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 -17
+BANDI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 -999
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 880
+ADDP4
+INDIRI4
+CNSTI4 -1
+LEI4 $354
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 832
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 880
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+CNSTI4 100000
+ARGI4
+CNSTI4 22
+ARGI4
+ADDRGP4 player_die
+CALLV
+pop
+ADDRGP4 $355
+JUMPV
+LABELV $354
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 100000
+ARGI4
+CNSTI4 22
+ARGI4
+ADDRGP4 player_die
+CALLV
+pop
+LABELV $355
+LABELV $349
+endproc Cmd_Kill_f 16 20
+export BroadcastTeamChange
+proc BroadcastTeamChange 8 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $357
+ADDRGP4 $359
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $358
+JUMPV
+LABELV $357
+ADDRFP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $360
+ADDRGP4 $362
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $361
+JUMPV
+LABELV $360
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $363
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $363
+ADDRGP4 $365
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $364
+JUMPV
+LABELV $363
+ADDRFP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $366
+ADDRGP4 $368
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $366
+LABELV $364
+LABELV $361
+LABELV $358
+LABELV $356
+endproc BroadcastTeamChange 8 8
+export SetTeam
+proc SetTeam 108 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $370
+ADDRLP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $370
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+LABELV $370
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 level
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 956
+DIVI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $375
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $377
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $376
+ARGP4
+ADDRLP4 40
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $373
+LABELV $377
+ADDRLP4 44
+CNSTI4 3
+ASGNI4
+ADDRLP4 4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 $374
+JUMPV
+LABELV $373
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $380
+ARGP4
+ADDRLP4 44
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $378
+ADDRLP4 4
+CNSTI4 3
+ASGNI4
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRLP4 24
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $379
+JUMPV
+LABELV $378
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $383
+ARGP4
+ADDRLP4 48
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $381
+ADDRLP4 4
+CNSTI4 3
+ASGNI4
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRLP4 24
+CNSTI4 -2
+ASGNI4
+ADDRGP4 $382
+JUMPV
+LABELV $381
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $386
+ARGP4
+ADDRLP4 52
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $388
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $387
+ARGP4
+ADDRLP4 56
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $384
+LABELV $388
+ADDRLP4 4
+CNSTI4 3
+ASGNI4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $385
+JUMPV
+LABELV $384
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+LTI4 $389
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $394
+ARGP4
+ADDRLP4 60
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $396
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $395
+ARGP4
+ADDRLP4 64
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $392
+LABELV $396
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $393
+JUMPV
+LABELV $392
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $399
+ARGP4
+ADDRLP4 68
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $401
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $400
+ARGP4
+ADDRLP4 72
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $397
+LABELV $401
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $398
+JUMPV
+LABELV $397
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 PickTeam
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 76
+INDIRI4
+ASGNI4
+LABELV $398
+LABELV $393
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_teamForceBalance+12
+INDIRI4
+ADDRLP4 76
+INDIRI4
+EQI4 $390
+ADDRLP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+NEI4 $390
+ADDRFP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 76
+INDIRI4
+NEI4 $390
+ADDRLP4 12
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRLP4 96
+ADDRGP4 TeamCount
+CALLI4
+ASGNI4
+ADDRLP4 80+8
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 100
+ADDRGP4 TeamCount
+CALLI4
+ASGNI4
+ADDRLP4 80+4
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 104
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+NEI4 $407
+ADDRLP4 80+4
+INDIRI4
+ADDRLP4 80+8
+INDIRI4
+SUBI4
+ADDRLP4 104
+INDIRI4
+LEI4 $407
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 $411
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $369
+JUMPV
+LABELV $407
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $390
+ADDRLP4 80+8
+INDIRI4
+ADDRLP4 80+4
+INDIRI4
+SUBI4
+CNSTI4 1
+LEI4 $390
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 $416
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $369
+JUMPV
+LABELV $389
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $390
+LABELV $385
+LABELV $382
+LABELV $379
+LABELV $374
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+NEI4 $417
+ADDRGP4 level+116
+INDIRI4
+CNSTI4 2
+LTI4 $417
+ADDRLP4 4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $418
+JUMPV
+LABELV $417
+ADDRGP4 g_maxGameClients+12
+INDIRI4
+CNSTI4 0
+LEI4 $421
+ADDRGP4 level+116
+INDIRI4
+ADDRGP4 g_maxGameClients+12
+INDIRI4
+LTI4 $421
+ADDRLP4 4
+CNSTI4 3
+ASGNI4
+LABELV $421
+LABELV $418
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $426
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $426
+ADDRGP4 $369
+JUMPV
+LABELV $426
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ADDRLP4 68
+INDIRI4
+GTI4 $428
+ADDRLP4 16
+INDIRI4
+ADDRLP4 68
+INDIRI4
+NEI4 $428
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $428
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CopyToBodyQue
+CALLV
+pop
+LABELV $428
+ADDRLP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+EQI4 $430
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $430
+ADDRLP4 72
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRI4
+CNSTI4 -17
+BANDI4
+ASGNI4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 100000
+ARGI4
+CNSTI4 22
+ARGI4
+ADDRGP4 player_die
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 RemoveOwnedItems
+CALLV
+pop
+LABELV $430
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $432
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $432
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 AddTournamentQueue
+CALLV
+pop
+LABELV $432
+ADDRLP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 636
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 640
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $434
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 0
+NEI4 $437
+ADDRLP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRGP4 $438
+JUMPV
+LABELV $437
+ADDRLP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+ADDRGP4 g_LPS_startlives+12
+INDIRI4
+ASGNI4
+LABELV $438
+LABELV $434
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 12
+NEI4 $441
+ADDRGP4 $443
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $441
+ADDRLP4 0
+INDIRP4
+CNSTI4 652
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $446
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $444
+LABELV $446
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 TeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 -1
+EQI4 $453
+ADDRLP4 92
+CNSTI4 832
+ASGNI4
+ADDRLP4 96
+CNSTI4 8
+ASGNI4
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+ADDRLP4 96
+INDIRI4
+BANDI4
+ADDRLP4 100
+INDIRI4
+NEI4 $447
+ADDRLP4 92
+INDIRI4
+ADDRLP4 88
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+ADDRLP4 96
+INDIRI4
+BANDI4
+ADDRLP4 100
+INDIRI4
+EQI4 $447
+LABELV $453
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 SetLeader
+CALLV
+pop
+LABELV $447
+LABELV $444
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+EQI4 $456
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $454
+LABELV $456
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CheckTeamLeader
+CALLV
+pop
+LABELV $454
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 BroadcastTeamChange
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $457
+ADDRGP4 $369
+JUMPV
+LABELV $457
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 ClientBegin
+CALLV
+pop
+LABELV $369
+endproc SetTeam 108 20
+export StopFollowing
+proc StopFollowing 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $463
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $460
+LABELV $463
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 252
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+CNSTI4 3
+ASGNI4
+LABELV $460
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 636
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 -4097
+BANDI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -9
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 152
+ADDP4
+ARGP4
+ADDRGP4 SetClientViewAngle
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $464
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $464
+LABELV $459
+endproc StopFollowing 16 8
+export Cmd_Team_f
+proc Cmd_Team_f 1036 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+EQI4 $467
+ADDRLP4 1024
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1024
+INDIRI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+LTI4 $466
+ADDRLP4 1032
+INDIRI4
+CNSTI4 3
+GTI4 $466
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $479
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $479
+address $475
+address $473
+address $471
+address $477
+code
+LABELV $471
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $466
+JUMPV
+LABELV $473
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $474
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $466
+JUMPV
+LABELV $475
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $476
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $466
+JUMPV
+LABELV $477
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $478
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $466
+JUMPV
+LABELV $467
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 868
+ADDP4
+INDIRI4
+ADDRGP4 level+68
+INDIRI4
+LEI4 $480
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $483
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $466
+JUMPV
+LABELV $480
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+NEI4 $484
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $484
+ADDRLP4 1032
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 648
+ADDP4
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ADDRLP4 1032
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $484
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 SetTeam
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 868
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 5000
+ADDI4
+ASGNI4
+LABELV $466
+endproc Cmd_Team_f 1036 12
+export Cmd_Follow_f
+proc Cmd_Follow_f 1044 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+EQI4 $489
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $488
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 StopFollowing
+CALLV
+pop
+ADDRGP4 $488
+JUMPV
+LABELV $489
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 ClientNumberFromString
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $493
+ADDRGP4 $488
+JUMPV
+LABELV $493
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+NEU4 $495
+ADDRGP4 $488
+JUMPV
+LABELV $495
+ADDRLP4 1036
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $500
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $497
+ADDRLP4 1036
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $497
+LABELV $500
+ADDRGP4 $488
+JUMPV
+LABELV $497
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+NEI4 $501
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $501
+ADDRLP4 1040
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 648
+ADDP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+ADDRLP4 1040
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $501
+ADDRLP4 1040
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $504
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $507
+ADDRLP4 1040
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $504
+LABELV $507
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $386
+ARGP4
+ADDRGP4 SetTeam
+CALLV
+pop
+LABELV $504
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 636
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 640
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $488
+endproc Cmd_Follow_f 1044 12
+export Cmd_FollowCycle_f
+proc Cmd_FollowCycle_f 44 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+NEI4 $509
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $509
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 648
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $509
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $512
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_LPS_flags+12
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $512
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $512
+ADDRLP4 12
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+GEI4 $512
+ADDRGP4 $508
+JUMPV
+LABELV $512
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $516
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $386
+ARGP4
+ADDRGP4 SetTeam
+CALLV
+pop
+LABELV $516
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $518
+ADDRFP4 4
+INDIRI4
+CNSTI4 -1
+EQI4 $518
+ADDRGP4 $520
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $518
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 640
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $521
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $524
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 640
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 StopFollowing
+CALLV
+pop
+ADDRLP4 20
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRGP4 SelectSpectatorSpawnPoint
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 G_SetOrigin
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 20
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 12
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRGP4 SetClientViewAngle
+CALLV
+pop
+ADDRGP4 $508
+JUMPV
+LABELV $524
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $527
+ADDRLP4 0
+ADDRGP4 level+60
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $527
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $530
+ADDRGP4 $522
+JUMPV
+LABELV $530
+ADDRLP4 20
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $535
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $532
+ADDRLP4 20
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $532
+LABELV $535
+ADDRGP4 $522
+JUMPV
+LABELV $532
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 640
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 636
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $508
+JUMPV
+LABELV $522
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $521
+LABELV $508
+endproc Cmd_FollowCycle_f 44 12
+proc G_SayTo 24 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $537
+ADDRGP4 $536
+JUMPV
+LABELV $537
+ADDRFP4 4
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $539
+ADDRGP4 $536
+JUMPV
+LABELV $539
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $541
+ADDRGP4 $536
+JUMPV
+LABELV $541
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $543
+ADDRGP4 $536
+JUMPV
+LABELV $543
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $545
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 OnSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $545
+ADDRGP4 $536
+JUMPV
+LABELV $545
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+NEI4 $547
+ADDRLP4 4
+CNSTI4 516
+ASGNI4
+ADDRLP4 8
+CNSTI4 628
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $547
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $547
+ADDRGP4 $536
+JUMPV
+LABELV $547
+ADDRGP4 $550
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $552
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ASGNI4
+ADDRGP4 $553
+JUMPV
+LABELV $552
+ADDRLP4 16
+CNSTI4 -1
+ASGNI4
+LABELV $553
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+CNSTI4 94
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $536
+endproc G_SayTo 24 28
+export G_Say
+proc G_Say 332 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+GEI4 $555
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $555
+ADDRFP4 8
+CNSTI4 0
+ASGNI4
+LABELV $555
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $558
+ADDRLP4 236
+ADDRGP4 $560
+ASGNP4
+ADDRLP4 228
+CNSTI4 0
+ASGNI4
+ADDRLP4 232
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $559
+JUMPV
+LABELV $558
+ADDRLP4 236
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRLP4 228
+CNSTI4 1
+ASGNI4
+ADDRLP4 232
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ASGNI4
+LABELV $559
+ADDRLP4 228
+INDIRI4
+CNSTI4 0
+NEI4 $561
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $561
+ADDRFP4 0
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+CNSTP4 0
+ASGNP4
+LABELV $561
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $565
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+EQI4 $568
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+EQI4 $574
+ADDRGP4 $563
+JUMPV
+LABELV $563
+LABELV $565
+ADDRGP4 $566
+ARGP4
+ADDRLP4 232
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRLP4 158
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $567
+ARGP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+CNSTI4 94
+ARGI4
+CNSTI4 55
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 224
+CNSTI4 51
+ASGNI4
+ADDRGP4 $564
+JUMPV
+LABELV $568
+ADDRGP4 $569
+ARGP4
+ADDRLP4 232
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRLP4 228
+INDIRI4
+CNSTI4 0
+EQI4 $570
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 240
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 308
+ADDRGP4 Team_GetLocationMsg
+CALLI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 0
+EQI4 $570
+ADDRLP4 158
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $572
+ARGP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+CNSTI4 94
+ARGI4
+CNSTI4 55
+ARGI4
+ADDRLP4 240
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $571
+JUMPV
+LABELV $570
+ADDRLP4 158
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $573
+ARGP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+CNSTI4 94
+ARGI4
+CNSTI4 55
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $571
+ADDRLP4 224
+CNSTI4 53
+ASGNI4
+ADDRGP4 $564
+JUMPV
+LABELV $574
+ADDRGP4 $575
+ARGP4
+ADDRLP4 232
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRLP4 312
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 312
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $576
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+LTI4 $576
+ADDRLP4 316
+CNSTI4 516
+ASGNI4
+ADDRLP4 320
+CNSTI4 628
+ASGNI4
+ADDRLP4 312
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 320
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 320
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $576
+ADDRLP4 228
+INDIRI4
+CNSTI4 0
+EQI4 $576
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 240
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 328
+ADDRGP4 Team_GetLocationMsg
+CALLI4
+ASGNI4
+ADDRLP4 328
+INDIRI4
+CNSTI4 0
+EQI4 $576
+ADDRLP4 158
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $579
+ARGP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+CNSTI4 94
+ARGI4
+CNSTI4 55
+ARGI4
+ADDRLP4 240
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $577
+JUMPV
+LABELV $576
+ADDRLP4 158
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $580
+ARGP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+CNSTI4 94
+ARGI4
+CNSTI4 55
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $577
+ADDRLP4 224
+CNSTI4 51
+ASGNI4
+LABELV $564
+ADDRLP4 8
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTI4 150
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $581
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 224
+INDIRI4
+ARGI4
+ADDRLP4 158
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 G_SayTo
+CALLV
+pop
+ADDRGP4 $554
+JUMPV
+LABELV $581
+ADDRGP4 g_dedicated+12
+INDIRI4
+CNSTI4 0
+EQI4 $583
+ADDRGP4 $586
+ARGP4
+ADDRLP4 158
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $583
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $590
+JUMPV
+LABELV $587
+ADDRLP4 4
+CNSTI4 832
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 224
+INDIRI4
+ARGI4
+ADDRLP4 158
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 G_SayTo
+CALLV
+pop
+LABELV $588
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $590
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $587
+LABELV $554
+endproc G_Say 332 28
+proc Cmd_Say_f 12 16
+ADDRLP4 4
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+GEI4 $593
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $593
+ADDRGP4 $592
+JUMPV
+LABELV $593
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $595
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 ConcatArgs
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $596
+JUMPV
+LABELV $595
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 ConcatArgs
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+LABELV $596
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_Say
+CALLV
+pop
+LABELV $592
+endproc Cmd_Say_f 12 16
+proc Cmd_Tell_f 1068 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1036
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 2
+GEI4 $598
+ADDRGP4 $597
+JUMPV
+LABELV $598
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 1040
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 1040
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $603
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $600
+LABELV $603
+ADDRGP4 $597
+JUMPV
+LABELV $600
+ADDRLP4 0
+CNSTI4 832
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 1052
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 1052
+INDIRU4
+EQU4 $607
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $607
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 1052
+INDIRU4
+NEU4 $604
+LABELV $607
+ADDRGP4 $597
+JUMPV
+LABELV $604
+CNSTI4 2
+ARGI4
+ADDRLP4 1056
+ADDRGP4 ConcatArgs
+CALLP4
+ASGNP4
+ADDRLP4 1032
+ADDRLP4 1056
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 G_Say
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+EQU4 $608
+ADDRFP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $608
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 G_Say
+CALLV
+pop
+LABELV $608
+LABELV $597
+endproc Cmd_Tell_f 1068 16
+data
+align 4
+LABELV gc_orders
+address $610
+address $611
+address $612
+address $613
+address $614
+address $615
+address $616
+export Cmd_GameCommand_f
+code
+proc Cmd_GameCommand_f 1060 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1032
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1036
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1024
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 0
+LTI4 $620
+ADDRLP4 1028
+INDIRI4
+CNSTI4 64
+LTI4 $618
+LABELV $620
+ADDRGP4 $617
+JUMPV
+LABELV $618
+ADDRLP4 1024
+INDIRI4
+CNSTI4 0
+LTI4 $623
+ADDRLP4 1024
+INDIRI4
+CVIU4 4
+CNSTU4 7
+LEU4 $621
+LABELV $623
+ADDRGP4 $617
+JUMPV
+LABELV $621
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 832
+ADDRLP4 1028
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRLP4 1048
+CNSTI4 2
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+ARGI4
+ADDRLP4 1024
+INDIRI4
+ADDRLP4 1048
+INDIRI4
+LSHI4
+ADDRGP4 gc_orders
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 G_Say
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1056
+CNSTI4 2
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+ARGI4
+ADDRLP4 1024
+INDIRI4
+ADDRLP4 1056
+INDIRI4
+LSHI4
+ADDRGP4 gc_orders
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 G_Say
+CALLV
+pop
+LABELV $617
+endproc Cmd_GameCommand_f 1060 16
+export Cmd_Where_f
+proc Cmd_Where_f 8 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 vtos
+CALLP4
+ASGNP4
+ADDRGP4 $625
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $624
+endproc Cmd_Where_f 8 8
+export Cmd_CallVote_f
+proc Cmd_CallVote_f 3164 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 g_allowVote+12
+INDIRI4
+CNSTI4 0
+NEI4 $627
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $630
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $626
+JUMPV
+LABELV $627
+ADDRGP4 level+2444
+INDIRI4
+CNSTI4 0
+EQI4 $631
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $634
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $626
+JUMPV
+LABELV $631
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 604
+ADDP4
+INDIRI4
+CNSTI4 3
+LTI4 $635
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $637
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $626
+JUMPV
+LABELV $635
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $638
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $640
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $626
+JUMPV
+LABELV $638
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 1032
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 1032
+ASGNP4
+ADDRGP4 $644
+JUMPV
+LABELV $641
+ADDRLP4 2056
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 2064
+CNSTI4 10
+ASGNI4
+ADDRLP4 2056
+INDIRI4
+ADDRLP4 2064
+INDIRI4
+EQI4 $648
+ADDRLP4 2056
+INDIRI4
+CNSTI4 13
+EQI4 $648
+ADDRLP4 2056
+INDIRI4
+ADDRLP4 2064
+INDIRI4
+LTI4 $645
+LABELV $650
+ADDRLP4 2056
+INDIRI4
+CNSTI4 59
+EQI4 $648
+ADDRGP4 $645
+JUMPV
+LABELV $648
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $649
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $626
+JUMPV
+LABELV $645
+LABELV $642
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $644
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $641
+ADDRLP4 8
+ARGP4
+ADDRGP4 $653
+ARGP4
+ADDRLP4 2056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2056
+INDIRI4
+CNSTI4 0
+NEI4 $651
+ADDRGP4 $652
+JUMPV
+LABELV $651
+ADDRLP4 8
+ARGP4
+ADDRGP4 $656
+ARGP4
+ADDRLP4 2060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2060
+INDIRI4
+CNSTI4 0
+NEI4 $654
+ADDRGP4 $655
+JUMPV
+LABELV $654
+ADDRLP4 8
+ARGP4
+ADDRGP4 $659
+ARGP4
+ADDRLP4 2064
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2064
+INDIRI4
+CNSTI4 0
+NEI4 $657
+ADDRGP4 $658
+JUMPV
+LABELV $657
+ADDRLP4 8
+ARGP4
+ADDRGP4 $662
+ARGP4
+ADDRLP4 2068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2068
+INDIRI4
+CNSTI4 0
+NEI4 $660
+ADDRGP4 $661
+JUMPV
+LABELV $660
+ADDRLP4 8
+ARGP4
+ADDRGP4 $665
+ARGP4
+ADDRLP4 2072
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2072
+INDIRI4
+CNSTI4 0
+NEI4 $663
+ADDRGP4 $664
+JUMPV
+LABELV $663
+ADDRLP4 8
+ARGP4
+ADDRGP4 $668
+ARGP4
+ADDRLP4 2076
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2076
+INDIRI4
+CNSTI4 0
+NEI4 $666
+ADDRGP4 $667
+JUMPV
+LABELV $666
+ADDRLP4 8
+ARGP4
+ADDRGP4 $671
+ARGP4
+ADDRLP4 2080
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2080
+INDIRI4
+CNSTI4 0
+NEI4 $669
+ADDRGP4 $670
+JUMPV
+LABELV $669
+ADDRLP4 8
+ARGP4
+ADDRGP4 $674
+ARGP4
+ADDRLP4 2084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2084
+INDIRI4
+CNSTI4 0
+NEI4 $672
+ADDRGP4 $673
+JUMPV
+LABELV $672
+ADDRLP4 8
+ARGP4
+ADDRGP4 $677
+ARGP4
+ADDRLP4 2088
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2088
+INDIRI4
+CNSTI4 0
+NEI4 $675
+ADDRGP4 $676
+JUMPV
+LABELV $675
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $649
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $678
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $626
+JUMPV
+LABELV $676
+LABELV $673
+LABELV $670
+LABELV $667
+LABELV $664
+LABELV $661
+LABELV $658
+LABELV $655
+LABELV $652
+ADDRLP4 8
+ARGP4
+ADDRGP4 $659
+ARGP4
+ADDRLP4 2092
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2092
+INDIRI4
+CNSTI4 0
+EQI4 $686
+ADDRLP4 8
+ARGP4
+ADDRGP4 $662
+ARGP4
+ADDRLP4 2096
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2096
+INDIRI4
+CNSTI4 0
+EQI4 $686
+ADDRLP4 8
+ARGP4
+ADDRGP4 $665
+ARGP4
+ADDRLP4 2100
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2100
+INDIRI4
+CNSTI4 0
+EQI4 $686
+ADDRLP4 8
+ARGP4
+ADDRGP4 $668
+ARGP4
+ADDRLP4 2104
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2104
+INDIRI4
+CNSTI4 0
+EQI4 $686
+ADDRLP4 8
+ARGP4
+ADDRGP4 $671
+ARGP4
+ADDRLP4 2108
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2108
+INDIRI4
+CNSTI4 0
+EQI4 $686
+ADDRLP4 8
+ARGP4
+ADDRGP4 $674
+ARGP4
+ADDRLP4 2112
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2112
+INDIRI4
+CNSTI4 0
+EQI4 $686
+ADDRLP4 8
+ARGP4
+ADDRGP4 $677
+ARGP4
+ADDRLP4 2116
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2116
+INDIRI4
+CNSTI4 0
+NEI4 $679
+LABELV $686
+ADDRLP4 2120
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 2120
+INDIRI4
+CNSTI4 3
+GEI4 $687
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $689
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $626
+JUMPV
+LABELV $687
+LABELV $679
+ADDRLP4 8
+ARGP4
+ADDRGP4 $677
+ARGP4
+ADDRLP4 2120
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2120
+INDIRI4
+CNSTI4 0
+NEI4 $690
+CNSTI4 2
+ARGI4
+ADDRLP4 2128
+ADDRGP4 ConcatArgs
+CALLP4
+ASGNP4
+ADDRLP4 2128
+INDIRP4
+ARGP4
+ADDRLP4 2132
+ADDRGP4 convertGTStringToGTNumber
+CALLI4
+ASGNI4
+ADDRLP4 2124
+ADDRLP4 2132
+INDIRI4
+ASGNI4
+ADDRLP4 2124
+INDIRI4
+CNSTI4 -1
+NEI4 $692
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $694
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $626
+JUMPV
+LABELV $692
+ADDRLP4 8
+ARGP4
+ADDRGP4 $662
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1032
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $695
+ARGP4
+ADDRLP4 2124
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $690
+ADDRGP4 level+2448
+INDIRI4
+CNSTI4 0
+EQI4 $696
+ADDRGP4 level+396
+ARGP4
+ADDRGP4 $659
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 2124
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 2124
+INDIRI4
+CNSTI4 0
+EQI4 $703
+ADDRGP4 level+396
+ARGP4
+ADDRGP4 $656
+ARGP4
+CNSTI4 7
+ARGI4
+ADDRLP4 2128
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 2128
+INDIRI4
+CNSTI4 0
+NEI4 $699
+LABELV $703
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $704
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $626
+JUMPV
+LABELV $699
+ADDRGP4 level+2448
+CNSTI4 0
+ASGNI4
+ADDRGP4 $706
+ARGP4
+ADDRGP4 level+396
+ARGP4
+ADDRLP4 2132
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 2132
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $696
+ADDRLP4 8
+ARGP4
+ADDRGP4 $662
+ARGP4
+ADDRLP4 2124
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2124
+INDIRI4
+CNSTI4 0
+NEI4 $708
+ADDRLP4 1032
+ARGP4
+ADDRLP4 2128
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 2128
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+EQI4 $713
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $713
+ADDRLP4 0
+INDIRI4
+CNSTI4 9
+LTI4 $710
+LABELV $713
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $714
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $626
+JUMPV
+LABELV $710
+ADDRGP4 level+396
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $717
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 2136
+ADDRGP4 GametypeName
+CALLP4
+ASGNP4
+ADDRGP4 level+1420
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $720
+ARGP4
+ADDRLP4 2136
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $709
+JUMPV
+LABELV $708
+ADDRLP4 8
+ARGP4
+ADDRGP4 $659
+ARGP4
+ADDRLP4 2128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2128
+INDIRI4
+CNSTI4 0
+NEI4 $721
+ADDRGP4 $725
+ARGP4
+ADDRLP4 1032
+ARGP4
+ADDRLP4 3156
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 3156
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 3160
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 3160
+INDIRI4
+CNSTI4 0
+NEI4 $723
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $726
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $626
+JUMPV
+LABELV $723
+ADDRGP4 $656
+ARGP4
+ADDRLP4 2132
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 2132
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $727
+ADDRGP4 level+396
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $731
+ARGP4
+ADDRLP4 1032
+ARGP4
+ADDRLP4 2132
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $728
+JUMPV
+LABELV $727
+ADDRGP4 level+396
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $734
+ARGP4
+ADDRLP4 1032
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $728
+ADDRGP4 level+1420
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $737
+ARGP4
+ADDRLP4 1032
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $722
+JUMPV
+LABELV $721
+ADDRLP4 8
+ARGP4
+ADDRGP4 $656
+ARGP4
+ADDRLP4 2132
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2132
+INDIRI4
+CNSTI4 0
+NEI4 $738
+ADDRGP4 $656
+ARGP4
+ADDRLP4 2136
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 2136
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $740
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $742
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $626
+JUMPV
+LABELV $740
+ADDRGP4 level+396
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $745
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 level+1420
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $748
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $739
+JUMPV
+LABELV $738
+ADDRLP4 8
+ARGP4
+ADDRGP4 $665
+ARGP4
+ADDRLP4 2136
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2136
+INDIRI4
+CNSTI4 0
+NEI4 $749
+ADDRLP4 2208
+CNSTI4 -1
+ASGNI4
+ADDRLP4 2212
+CNSTI4 0
+ASGNI4
+ADDRLP4 1032
+ARGP4
+ADDRGP4 $245
+ARGP4
+ADDRLP4 2216
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2216
+INDIRI4
+CNSTI4 0
+NEI4 $751
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $753
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $626
+JUMPV
+LABELV $751
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $757
+JUMPV
+LABELV $754
+ADDRLP4 2140
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 2140
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $759
+ADDRGP4 $755
+JUMPV
+LABELV $759
+ADDRLP4 2140
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 1032
+ARGP4
+ADDRLP4 2220
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2220
+INDIRI4
+CNSTI4 0
+NEI4 $761
+ADDRLP4 2208
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 2212
+ADDRLP4 2212
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $755
+JUMPV
+LABELV $761
+ADDRLP4 2144
+ARGP4
+ADDRLP4 2140
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 2144
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 2144
+ARGP4
+ADDRLP4 1032
+ARGP4
+ADDRLP4 2224
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2224
+INDIRI4
+CNSTI4 0
+NEI4 $763
+ADDRLP4 2208
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 2212
+ADDRLP4 2212
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $763
+LABELV $755
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $757
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $754
+ADDRLP4 2208
+INDIRI4
+CNSTI4 -1
+NEI4 $765
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $767
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $626
+JUMPV
+LABELV $765
+ADDRLP4 2212
+INDIRI4
+CNSTI4 1
+LEI4 $768
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $770
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $626
+JUMPV
+LABELV $768
+ADDRGP4 level+396
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $773
+ARGP4
+ADDRLP4 2208
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 level+1420
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $776
+ARGP4
+ADDRLP4 2208
+INDIRI4
+ARGI4
+ADDRLP4 1032
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $750
+JUMPV
+LABELV $749
+ADDRLP4 8
+ARGP4
+ADDRGP4 $653
+ARGP4
+ADDRLP4 2140
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2140
+INDIRI4
+CNSTI4 0
+NEI4 $777
+ADDRGP4 level+396
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $653
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 level+1420
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $783
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $778
+JUMPV
+LABELV $777
+ADDRLP4 8
+ARGP4
+ADDRGP4 $668
+ARGP4
+ADDRLP4 2144
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2144
+INDIRI4
+CNSTI4 0
+NEI4 $784
+ADDRLP4 1032
+ARGP4
+ADDRLP4 2148
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 2148
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $788
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $786
+LABELV $788
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $789
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $626
+JUMPV
+LABELV $786
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $790
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $792
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $626
+JUMPV
+LABELV $790
+ADDRGP4 level+396
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $773
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 level+1420
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $776
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $785
+JUMPV
+LABELV $784
+ADDRLP4 8
+ARGP4
+ADDRGP4 $674
+ARGP4
+ADDRLP4 2148
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2148
+INDIRI4
+CNSTI4 0
+EQI4 $799
+ADDRLP4 8
+ARGP4
+ADDRGP4 $671
+ARGP4
+ADDRLP4 2152
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2152
+INDIRI4
+CNSTI4 0
+NEI4 $626
+LABELV $799
+ADDRLP4 1032
+ARGP4
+ADDRLP4 2156
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 2156
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $800
+ADDRGP4 $802
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 2160
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRLP4 2160
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $626
+JUMPV
+LABELV $800
+ADDRGP4 level+396
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $805
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 level+1420
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $808
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $798
+LABELV $785
+LABELV $778
+LABELV $750
+LABELV $739
+LABELV $722
+LABELV $709
+ADDRGP4 $809
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRGP4 level+1420
+ARGP4
+ADDRLP4 2156
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 2156
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $811
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 level+396
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 level+2444
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+ADDRGP4 level+2452
+CNSTI4 1
+ASGNI4
+ADDRGP4 level+2456
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $820
+JUMPV
+LABELV $817
+ADDRLP4 2160
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 2160
+INDIRP4
+ADDRLP4 2160
+INDIRP4
+INDIRI4
+CNSTI4 -16385
+BANDI4
+ASGNI4
+LABELV $818
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $820
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $817
+ADDRLP4 2160
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 2160
+INDIRP4
+ADDRLP4 2160
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+ADDRLP4 2164
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 604
+ADDP4
+ASGNP4
+ADDRLP4 2164
+INDIRP4
+ADDRLP4 2164
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $822
+ARGP4
+ADDRGP4 level+2444
+INDIRI4
+ARGI4
+ADDRLP4 2168
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 8
+ARGI4
+ADDRLP4 2168
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+CNSTI4 9
+ARGI4
+ADDRGP4 level+1420
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $822
+ARGP4
+ADDRGP4 level+2452
+INDIRI4
+ARGI4
+ADDRLP4 2172
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 10
+ARGI4
+ADDRLP4 2172
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $822
+ARGP4
+ADDRGP4 level+2456
+INDIRI4
+ARGI4
+ADDRLP4 2176
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 11
+ARGI4
+ADDRLP4 2176
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $626
+endproc Cmd_CallVote_f 3164 20
+export Cmd_Vote_f
+proc Cmd_Vote_f 80 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 level+2444
+INDIRI4
+CNSTI4 0
+NEI4 $828
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $831
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $827
+JUMPV
+LABELV $828
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $832
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $834
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $827
+JUMPV
+LABELV $832
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $835
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $837
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $827
+JUMPV
+LABELV $835
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $838
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 68
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 121
+EQI4 $842
+ADDRLP4 68
+INDIRI4
+CNSTI4 89
+EQI4 $842
+ADDRLP4 68
+INDIRI4
+CNSTI4 49
+NEI4 $839
+LABELV $842
+ADDRLP4 72
+ADDRGP4 level+2452
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $822
+ARGP4
+ADDRGP4 level+2452
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 10
+ARGI4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $840
+JUMPV
+LABELV $839
+ADDRLP4 72
+ADDRGP4 level+2456
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $822
+ARGP4
+ADDRGP4 level+2456
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 11
+ARGI4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $840
+LABELV $827
+endproc Cmd_Vote_f 80 12
+export Cmd_CallTeamVote_f
+proc Cmd_CallTeamVote_f 2160 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1032
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 1
+NEI4 $848
+ADDRLP4 1036
+CNSTI4 0
+ASGNI4
+ADDRGP4 $849
+JUMPV
+LABELV $848
+ADDRLP4 1032
+INDIRI4
+CNSTI4 2
+NEI4 $847
+ADDRLP4 1036
+CNSTI4 1
+ASGNI4
+LABELV $851
+LABELV $849
+ADDRGP4 g_allowVote+12
+INDIRI4
+CNSTI4 0
+NEI4 $852
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $630
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $847
+JUMPV
+LABELV $852
+ADDRLP4 1036
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4512
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $855
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $858
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $847
+JUMPV
+LABELV $855
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 608
+ADDP4
+INDIRI4
+CNSTI4 3
+LTI4 $859
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $861
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $847
+JUMPV
+LABELV $859
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $862
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $640
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $847
+JUMPV
+LABELV $862
+CNSTI4 1
+ARGI4
+ADDRLP4 1040
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 $867
+JUMPV
+LABELV $864
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LEI4 $868
+ADDRLP4 4
+ARGP4
+ADDRGP4 $870
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $868
+ADDRLP4 4
+ARGP4
+ADDRLP4 2064
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ARGP4
+ADDRLP4 2068
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 2064
+INDIRU4
+ADDRLP4 4
+ADDP4
+ARGP4
+CNSTU4 1024
+ADDRLP4 2068
+INDIRU4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+LABELV $865
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $867
+ADDRLP4 2064
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 2064
+INDIRI4
+LTI4 $864
+ADDRLP4 1028
+ADDRLP4 4
+ASGNP4
+ADDRGP4 $874
+JUMPV
+LABELV $871
+ADDRLP4 2068
+ADDRLP4 1028
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 2076
+CNSTI4 10
+ASGNI4
+ADDRLP4 2068
+INDIRI4
+ADDRLP4 2076
+INDIRI4
+EQI4 $878
+ADDRLP4 2068
+INDIRI4
+CNSTI4 13
+EQI4 $878
+ADDRLP4 2068
+INDIRI4
+ADDRLP4 2076
+INDIRI4
+LTI4 $875
+LABELV $879
+ADDRLP4 2068
+INDIRI4
+CNSTI4 59
+EQI4 $878
+ADDRGP4 $875
+JUMPV
+LABELV $878
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $649
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $847
+JUMPV
+LABELV $875
+LABELV $872
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $874
+ADDRLP4 1028
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $871
+ADDRLP4 1040
+ARGP4
+ADDRGP4 $882
+ARGP4
+ADDRLP4 2068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2068
+INDIRI4
+CNSTI4 0
+NEI4 $880
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $883
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $884
+JUMPV
+LABELV $883
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $885
+ADDRLP4 2144
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 2144
+INDIRI4
+CNSTI4 0
+EQI4 $892
+ADDRLP4 2144
+INDIRI4
+CNSTI4 48
+LTI4 $892
+ADDRLP4 2144
+INDIRI4
+CNSTI4 57
+LEI4 $889
+LABELV $892
+ADDRGP4 $887
+JUMPV
+LABELV $889
+LABELV $886
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $885
+LABELV $887
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+GEI4 $895
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $893
+LABELV $895
+ADDRLP4 4
+ARGP4
+ADDRLP4 2148
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 2148
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $899
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $896
+LABELV $899
+ADDRGP4 $226
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 2156
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRLP4 2156
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $847
+JUMPV
+LABELV $896
+CNSTI4 832
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $894
+ADDRGP4 $229
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 2156
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRLP4 2156
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $847
+JUMPV
+LABELV $893
+ADDRLP4 2108
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 2108
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $906
+JUMPV
+LABELV $903
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $908
+ADDRGP4 $904
+JUMPV
+LABELV $908
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 628
+ADDP4
+INDIRI4
+ADDRLP4 1032
+INDIRI4
+EQI4 $910
+ADDRGP4 $904
+JUMPV
+LABELV $910
+ADDRLP4 2072
+ARGP4
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 512
+ADDP4
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 2072
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 2072
+ARGP4
+ADDRLP4 2108
+ARGP4
+ADDRLP4 2148
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2148
+INDIRI4
+CNSTI4 0
+NEI4 $912
+ADDRGP4 $905
+JUMPV
+LABELV $912
+LABELV $904
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $906
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $903
+LABELV $905
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $914
+ADDRGP4 $917
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 2148
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRLP4 2148
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $847
+JUMPV
+LABELV $914
+LABELV $894
+LABELV $884
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $695
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $881
+JUMPV
+LABELV $880
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $649
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $918
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $847
+JUMPV
+LABELV $881
+ADDRLP4 1036
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 level+2464
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $921
+ARGP4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $925
+JUMPV
+LABELV $922
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $927
+ADDRGP4 $923
+JUMPV
+LABELV $927
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 628
+ADDP4
+INDIRI4
+ADDRLP4 1032
+INDIRI4
+NEI4 $929
+ADDRGP4 $931
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 2072
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 2072
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $929
+LABELV $923
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $925
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $922
+ADDRLP4 1036
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4512
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4520
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4528
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $939
+JUMPV
+LABELV $936
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 628
+ADDP4
+INDIRI4
+ADDRLP4 1032
+INDIRI4
+NEI4 $941
+ADDRLP4 2072
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 2072
+INDIRP4
+ADDRLP4 2072
+INDIRP4
+INDIRI4
+CNSTI4 -524289
+BANDI4
+ASGNI4
+LABELV $941
+LABELV $937
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $939
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $936
+ADDRLP4 2072
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 2072
+INDIRP4
+ADDRLP4 2072
+INDIRP4
+INDIRI4
+CNSTI4 524288
+BORI4
+ASGNI4
+ADDRLP4 2076
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 608
+ADDP4
+ASGNP4
+ADDRLP4 2076
+INDIRP4
+ADDRLP4 2076
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $822
+ARGP4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4512
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2080
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 12
+ADDI4
+ARGI4
+ADDRLP4 2080
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRLP4 1036
+INDIRI4
+CNSTI4 14
+ADDI4
+ARGI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 level+2464
+ADDP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $822
+ARGP4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4520
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2088
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 16
+ADDI4
+ARGI4
+ADDRLP4 2088
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $822
+ARGP4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2092
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 18
+ADDI4
+ARGI4
+ADDRLP4 2092
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $847
+endproc Cmd_CallTeamVote_f 2160 20
+export Cmd_TeamVote_f
+proc Cmd_TeamVote_f 84 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+NEI4 $948
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $949
+JUMPV
+LABELV $948
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+NEI4 $947
+ADDRLP4 64
+CNSTI4 1
+ASGNI4
+LABELV $951
+LABELV $949
+ADDRLP4 64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4512
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $952
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $955
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $947
+JUMPV
+LABELV $952
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CNSTI4 524288
+BANDI4
+CNSTI4 0
+EQI4 $956
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $958
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $947
+JUMPV
+LABELV $956
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $959
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $837
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $947
+JUMPV
+LABELV $959
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $961
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRLP4 72
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRI4
+CNSTI4 524288
+BORI4
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 121
+EQI4 $967
+ADDRLP4 0+1
+INDIRI1
+CVII4 1
+CNSTI4 89
+EQI4 $967
+ADDRLP4 0+1
+INDIRI1
+CVII4 1
+CNSTI4 49
+NEI4 $962
+LABELV $967
+ADDRLP4 76
+ADDRLP4 64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4520
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $822
+ARGP4
+ADDRLP4 64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4520
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRI4
+CNSTI4 16
+ADDI4
+ARGI4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $963
+JUMPV
+LABELV $962
+ADDRLP4 76
+ADDRLP4 64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4528
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $822
+ARGP4
+ADDRLP4 64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRI4
+CNSTI4 18
+ADDI4
+ARGI4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $963
+LABELV $947
+endproc Cmd_TeamVote_f 84 12
+export Cmd_SetViewpos_f
+proc Cmd_SetViewpos_f 1064 12
+ADDRGP4 g_cheats+12
+INDIRI4
+CNSTI4 0
+NEI4 $973
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $197
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $972
+JUMPV
+LABELV $973
+ADDRLP4 1052
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 5
+EQI4 $976
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $978
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $972
+JUMPV
+LABELV $976
+ADDRLP4 1056
+CNSTF4 0
+ASGNF4
+ADDRLP4 1040+8
+ADDRLP4 1056
+INDIRF4
+ASGNF4
+ADDRLP4 1040+4
+ADDRLP4 1056
+INDIRF4
+ASGNF4
+ADDRLP4 1040
+ADDRLP4 1056
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $981
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1060
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1028
+ADDP4
+ADDRLP4 1060
+INDIRF4
+ASGNF4
+LABELV $982
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $981
+CNSTI4 4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1060
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 1040+4
+ADDRLP4 1060
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1028
+ARGP4
+ADDRLP4 1040
+ARGP4
+ADDRGP4 TeleportPlayer
+CALLV
+pop
+LABELV $972
+endproc Cmd_SetViewpos_f 1064 12
+export Cmd_Stats_f
+proc Cmd_Stats_f 3088 20
+ADDRLP4 4
+ARGP4
+ADDRGP4 $987
+ARGP4
+CNSTI4 3072
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $991
+JUMPV
+LABELV $988
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 1
+LTI4 $993
+ADDRGP4 $995
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 832
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $1000
+ADDRLP4 3076
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1001
+JUMPV
+LABELV $1000
+ADDRLP4 3076
+CNSTI4 0
+ASGNI4
+LABELV $1001
+ADDRLP4 3076
+INDIRI4
+ARGI4
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRGP4 $999
+ARGP4
+ADDRLP4 3084
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 3072
+ARGI4
+ADDRLP4 3084
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $993
+LABELV $989
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $991
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $988
+ADDRGP4 $625
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 3076
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRLP4 3076
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $986
+endproc Cmd_Stats_f 3088 20
+export Cmd_SelectLogo_f
+proc Cmd_SelectLogo_f 4 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+CNSTI4 1
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 660
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+ADDRGP4 $1003
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 660
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $1002
+endproc Cmd_SelectLogo_f 4 12
+export Cmd_ReadyToFight_f
+proc Cmd_ReadyToFight_f 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 700
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $1004
+endproc Cmd_ReadyToFight_f 0 0
+export Cmd_TeamReady_f
+proc Cmd_TeamReady_f 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+GEI4 $1006
+ADDRGP4 $1005
+JUMPV
+LABELV $1006
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $1009
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+EQI4 $1009
+ADDRGP4 $1005
+JUMPV
+LABELV $1009
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1014
+JUMPV
+LABELV $1011
+ADDRLP4 8
+CNSTI4 628
+ASGNI4
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $1016
+CNSTI4 832
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRGP4 Cmd_ReadyToFight_f
+CALLV
+pop
+LABELV $1016
+LABELV $1012
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1014
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $1011
+LABELV $1005
+endproc Cmd_TeamReady_f 12 4
+proc CartridgePickUpAbleForOwner 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 120000
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ADDRGP4 G_FreeEntity
+ASGNP4
+LABELV $1018
+endproc CartridgePickUpAbleForOwner 0 0
+export Cmd_DropCartridge_f
+proc Cmd_DropCartridge_f 60 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1021
+ADDRGP4 $1020
+JUMPV
+LABELV $1021
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 7
+NEI4 $1023
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $1026
+ADDRGP4 $1020
+JUMPV
+LABELV $1026
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTI4 49
+ARGI4
+ADDRGP4 G_TempEntity
+CALLP4
+pop
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 16
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 32
+CNSTF4 1142292480
+ASGNF4
+ADDRLP4 0
+ADDRLP4 32
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1142292480
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1128792064
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1033
+ADDRGP4 $1035
+ARGP4
+ADDRLP4 36
+ADDRGP4 BG_FindItem
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 40
+ADDRGP4 LaunchItem
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRGP4 $1034
+JUMPV
+LABELV $1033
+ADDRGP4 $1036
+ARGP4
+ADDRLP4 36
+ADDRGP4 BG_FindItem
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 40
+ADDRGP4 LaunchItem
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 40
+INDIRP4
+ASGNP4
+LABELV $1034
+ADDRLP4 12
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 700
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 1000
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 704
+ADDP4
+ADDRGP4 CartridgePickUpAbleForOwner
+ASGNP4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 424
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 440
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $1024
+JUMPV
+LABELV $1023
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 6
+NEI4 $1038
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 344
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1041
+CNSTI4 8
+ARGI4
+ADDRLP4 48
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 44
+CNSTI4 8
+ASGNI4
+ADDRGP4 $1042
+JUMPV
+LABELV $1041
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1020
+CNSTI4 9
+ARGI4
+ADDRLP4 48
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 44
+CNSTI4 9
+ASGNI4
+LABELV $1044
+LABELV $1042
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1045
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 888
+ADDP4
+INDIRI4
+ADDRGP4 level+68
+INDIRI4
+LEI4 $1047
+ADDRGP4 $1020
+JUMPV
+LABELV $1047
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 888
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 5000
+ADDI4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 32+8
+ADDRLP4 32+8
+INDIRF4
+CNSTF4 1112014848
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 16
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 48
+CNSTP4 0
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 52
+CNSTF4 1142292480
+ASGNF4
+ADDRLP4 0
+ADDRLP4 52
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 52
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1142292480
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1128792064
+ADDF4
+ASGNF4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 56
+ADDRGP4 LaunchItem
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1045
+LABELV $1038
+LABELV $1024
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1057
+ADDRGP4 $1059
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+LABELV $1057
+LABELV $1020
+endproc Cmd_DropCartridge_f 60 16
+export EditPlayerInventory
+proc EditPlayerInventory 2184 32
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1063
+ARGP4
+ADDRLP4 2048
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2048
+INDIRI4
+CNSTI4 0
+NEI4 $1061
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 64
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 376
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 64
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $1062
+JUMPV
+LABELV $1061
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1066
+ARGP4
+ADDRLP4 2052
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2052
+INDIRI4
+CNSTI4 0
+NEI4 $1064
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1024
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 1024
+ARGP4
+ADDRLP4 2056
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 2060
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 424
+ADDP4
+ASGNP4
+ADDRLP4 2060
+INDIRP4
+ADDRLP4 2060
+INDIRP4
+INDIRI4
+ADDRLP4 2056
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $1065
+JUMPV
+LABELV $1064
+ADDRLP4 0
+ARGP4
+ADDRGP4 $248
+ARGP4
+ADDRLP4 2056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2056
+INDIRI4
+CNSTI4 0
+NEI4 $1067
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1024
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 1024
+ARGP4
+ADDRLP4 2060
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2064
+CNSTP4 0
+ASGNP4
+ADDRLP4 2064
+INDIRP4
+ARGP4
+ADDRLP4 2064
+INDIRP4
+ARGP4
+ADDRLP4 2068
+CNSTP4 0
+ASGNP4
+ADDRLP4 2068
+INDIRP4
+ARGP4
+ADDRLP4 2068
+INDIRP4
+ARGP4
+ADDRLP4 2060
+INDIRI4
+ARGI4
+ADDRLP4 2072
+CNSTI4 0
+ASGNI4
+ADDRLP4 2072
+INDIRI4
+ARGI4
+ADDRLP4 2072
+INDIRI4
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+ADDRGP4 $1068
+JUMPV
+LABELV $1067
+ADDRLP4 0
+ARGP4
+ADDRGP4 $276
+ARGP4
+ADDRLP4 2060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2060
+INDIRI4
+CNSTI4 0
+NEI4 $1069
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1024
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 1024
+ARGP4
+ADDRLP4 2064
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 2068
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 196
+ADDP4
+ASGNP4
+ADDRLP4 2068
+INDIRP4
+ADDRLP4 2068
+INDIRP4
+INDIRI4
+ADDRLP4 2064
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $1070
+JUMPV
+LABELV $1069
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1073
+ARGP4
+ADDRLP4 2064
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2064
+INDIRI4
+CNSTI4 0
+NEI4 $1071
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1024
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 1024
+ARGP4
+ADDRLP4 2068
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 336
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 1000
+ADDRLP4 2068
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+ADDRGP4 $1072
+JUMPV
+LABELV $1071
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1077
+ARGP4
+ADDRLP4 2068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2068
+INDIRI4
+CNSTI4 0
+NEI4 $1075
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1024
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 1024
+ARGP4
+ADDRLP4 2072
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 316
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 1000
+ADDRLP4 2072
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+ADDRGP4 $1076
+JUMPV
+LABELV $1075
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1081
+ARGP4
+ADDRLP4 2072
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2072
+INDIRI4
+CNSTI4 0
+NEI4 $1079
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1024
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 1024
+ARGP4
+ADDRLP4 2076
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 332
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 1000
+ADDRLP4 2076
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+ADDRGP4 $1080
+JUMPV
+LABELV $1079
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1085
+ARGP4
+ADDRLP4 2076
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2076
+INDIRI4
+CNSTI4 0
+NEI4 $1083
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1024
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 1024
+ARGP4
+ADDRLP4 2080
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 328
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 1000
+ADDRLP4 2080
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+ADDRGP4 $1084
+JUMPV
+LABELV $1083
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1089
+ARGP4
+ADDRLP4 2080
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2080
+INDIRI4
+CNSTI4 0
+NEI4 $1087
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1024
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 1024
+ARGP4
+ADDRLP4 2084
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 320
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 1000
+ADDRLP4 2084
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+ADDRGP4 $1088
+JUMPV
+LABELV $1087
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1093
+ARGP4
+ADDRLP4 2084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2084
+INDIRI4
+CNSTI4 0
+NEI4 $1091
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1024
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 340
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 30000
+ADDI4
+ASGNI4
+ADDRGP4 $1092
+JUMPV
+LABELV $1091
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1097
+ARGP4
+ADDRLP4 2088
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2088
+INDIRI4
+CNSTI4 0
+NEI4 $1095
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1024
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 26
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 212
+ADDP4
+CNSTI4 8000
+ASGNI4
+ADDRGP4 $1096
+JUMPV
+LABELV $1095
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1100
+ARGP4
+ADDRLP4 2092
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2092
+INDIRI4
+CNSTI4 0
+NEI4 $1098
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1024
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 27
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 212
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRGP4 $1099
+JUMPV
+LABELV $1098
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1103
+ARGP4
+ADDRLP4 2096
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2096
+INDIRI4
+CNSTI4 0
+NEI4 $1101
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1024
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 28
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 212
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1102
+JUMPV
+LABELV $1101
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1106
+ARGP4
+ADDRLP4 2100
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2100
+INDIRI4
+CNSTI4 0
+NEI4 $1104
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1024
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 29
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 212
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $1105
+JUMPV
+LABELV $1104
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1109
+ARGP4
+ADDRLP4 2104
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2104
+INDIRI4
+CNSTI4 0
+NEI4 $1107
+ADDRLP4 2108
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 192
+ADDP4
+ASGNP4
+ADDRLP4 2108
+INDIRP4
+ADDRLP4 2108
+INDIRP4
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 400
+ADDP4
+CNSTI4 50
+ASGNI4
+ADDRGP4 $1108
+JUMPV
+LABELV $1107
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1112
+ARGP4
+ADDRLP4 2108
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2108
+INDIRI4
+CNSTI4 0
+NEI4 $1110
+ADDRLP4 2112
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 192
+ADDP4
+ASGNP4
+ADDRLP4 2112
+INDIRP4
+ADDRLP4 2112
+INDIRP4
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 404
+ADDP4
+CNSTI4 50
+ASGNI4
+ADDRGP4 $1111
+JUMPV
+LABELV $1110
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1115
+ARGP4
+ADDRLP4 2112
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2112
+INDIRI4
+CNSTI4 0
+NEI4 $1113
+ADDRLP4 2116
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 192
+ADDP4
+ASGNP4
+ADDRLP4 2116
+INDIRP4
+ADDRLP4 2116
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 388
+ADDP4
+CNSTI4 50
+ASGNI4
+ADDRGP4 $1114
+JUMPV
+LABELV $1113
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1118
+ARGP4
+ADDRLP4 2116
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2116
+INDIRI4
+CNSTI4 0
+NEI4 $1116
+ADDRLP4 2120
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 192
+ADDP4
+ASGNP4
+ADDRLP4 2120
+INDIRP4
+ADDRLP4 2120
+INDIRP4
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 392
+ADDP4
+CNSTI4 50
+ASGNI4
+ADDRGP4 $1117
+JUMPV
+LABELV $1116
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1121
+ARGP4
+ADDRLP4 2120
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2120
+INDIRI4
+CNSTI4 0
+NEI4 $1119
+ADDRLP4 2124
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 192
+ADDP4
+ASGNP4
+ADDRLP4 2124
+INDIRP4
+ADDRLP4 2124
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 396
+ADDP4
+CNSTI4 50
+ASGNI4
+ADDRGP4 $1120
+JUMPV
+LABELV $1119
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1124
+ARGP4
+ADDRLP4 2124
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2124
+INDIRI4
+CNSTI4 0
+NEI4 $1122
+ADDRLP4 2128
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 192
+ADDP4
+ASGNP4
+ADDRLP4 2128
+INDIRP4
+ADDRLP4 2128
+INDIRP4
+INDIRI4
+CNSTI4 256
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 408
+ADDP4
+CNSTI4 50
+ASGNI4
+ADDRGP4 $1123
+JUMPV
+LABELV $1122
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1127
+ARGP4
+ADDRLP4 2128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2128
+INDIRI4
+CNSTI4 0
+NEI4 $1125
+ADDRLP4 2132
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 192
+ADDP4
+ASGNP4
+ADDRLP4 2132
+INDIRP4
+ADDRLP4 2132
+INDIRP4
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 412
+ADDP4
+CNSTI4 50
+ASGNI4
+ADDRGP4 $1126
+JUMPV
+LABELV $1125
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1130
+ARGP4
+ADDRLP4 2132
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2132
+INDIRI4
+CNSTI4 0
+NEI4 $1128
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 152
+ADDP4
+ARGP4
+ADDRLP4 2136
+ARGP4
+ADDRLP4 2148
+ARGP4
+ADDRLP4 2160
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2136
+ARGP4
+ADDRLP4 2148
+ARGP4
+ADDRLP4 2160
+ARGP4
+ADDRLP4 2172
+ARGP4
+ADDRGP4 CalcMuzzlePoint
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2172
+ARGP4
+ADDRLP4 2136
+ARGP4
+ADDRGP4 fire_duck
+CALLP4
+pop
+LABELV $1128
+LABELV $1126
+LABELV $1123
+LABELV $1120
+LABELV $1117
+LABELV $1114
+LABELV $1111
+LABELV $1108
+LABELV $1105
+LABELV $1102
+LABELV $1099
+LABELV $1096
+LABELV $1092
+LABELV $1088
+LABELV $1084
+LABELV $1080
+LABELV $1076
+LABELV $1072
+LABELV $1070
+LABELV $1068
+LABELV $1065
+LABELV $1062
+LABELV $1060
+endproc EditPlayerInventory 2184 32
+export Cmd_EditBotInv_f
+proc Cmd_EditBotInv_f 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+NEI4 $1132
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $1135
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1131
+JUMPV
+LABELV $1132
+ADDRLP4 8
+CNSTI4 832
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 640
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+EQU4 $1136
+ADDRFP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $1138
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $1140
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1131
+JUMPV
+LABELV $1138
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 EditPlayerInventory
+CALLV
+pop
+ADDRGP4 $1137
+JUMPV
+LABELV $1136
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1141
+ADDRLP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $1145
+ADDRGP4 $1142
+JUMPV
+LABELV $1145
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 EditPlayerInventory
+CALLV
+pop
+LABELV $1142
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 832
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $1141
+LABELV $1137
+LABELV $1131
+endproc Cmd_EditBotInv_f 16 8
+export ClientCommand
+proc ClientCommand 1148 12
+ADDRLP4 1024
+CNSTI4 832
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 1024
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1150
+ADDRLP4 1028
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $1148
+LABELV $1150
+ADDRLP4 1032
+ADDRLP4 1024
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1147
+ADDRLP4 1032
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1147
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1155
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+NEI4 $1147
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_Team_f
+CALLV
+pop
+ADDRGP4 $1147
+JUMPV
+LABELV $1148
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1158
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+NEI4 $1156
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRLP4 1036
+CNSTI4 0
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRGP4 Cmd_Say_f
+CALLV
+pop
+ADDRGP4 $1147
+JUMPV
+LABELV $1156
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1161
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+NEI4 $1159
+ADDRLP4 1024
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 Cmd_Say_f
+CALLV
+pop
+ADDRGP4 $1147
+JUMPV
+LABELV $1159
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1164
+ARGP4
+ADDRLP4 1040
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $1162
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_Tell_f
+CALLV
+pop
+ADDRGP4 $1147
+JUMPV
+LABELV $1162
+ADDRLP4 0
+ARGP4
+ADDRGP4 $376
+ARGP4
+ADDRLP4 1044
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $1165
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_Score_f
+CALLV
+pop
+ADDRGP4 $1147
+JUMPV
+LABELV $1165
+ADDRGP4 level+9168
+INDIRI4
+CNSTI4 0
+EQI4 $1167
+ADDRGP4 $1147
+JUMPV
+LABELV $1167
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1172
+ARGP4
+ADDRLP4 1048
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $1170
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_Give_f
+CALLV
+pop
+ADDRGP4 $1171
+JUMPV
+LABELV $1170
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1175
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $1173
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_God_f
+CALLV
+pop
+ADDRGP4 $1174
+JUMPV
+LABELV $1173
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1178
+ARGP4
+ADDRLP4 1056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $1176
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_Notarget_f
+CALLV
+pop
+ADDRGP4 $1177
+JUMPV
+LABELV $1176
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1181
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $1179
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_Noclip_f
+CALLV
+pop
+ADDRGP4 $1180
+JUMPV
+LABELV $1179
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1184
+ARGP4
+ADDRLP4 1064
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+NEI4 $1182
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_Kill_f
+CALLV
+pop
+ADDRGP4 $1183
+JUMPV
+LABELV $1182
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1187
+ARGP4
+ADDRLP4 1068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+NEI4 $1185
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_LevelShot_f
+CALLV
+pop
+ADDRGP4 $1186
+JUMPV
+LABELV $1185
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1190
+ARGP4
+ADDRLP4 1072
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+NEI4 $1188
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_Follow_f
+CALLV
+pop
+ADDRGP4 $1189
+JUMPV
+LABELV $1188
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1193
+ARGP4
+ADDRLP4 1076
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $1191
+ADDRLP4 1024
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 Cmd_FollowCycle_f
+CALLV
+pop
+ADDRGP4 $1192
+JUMPV
+LABELV $1191
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1196
+ARGP4
+ADDRLP4 1080
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+NEI4 $1194
+ADDRLP4 1024
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 Cmd_FollowCycle_f
+CALLV
+pop
+ADDRGP4 $1195
+JUMPV
+LABELV $1194
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1155
+ARGP4
+ADDRLP4 1084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+NEI4 $1197
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_Team_f
+CALLV
+pop
+ADDRGP4 $1198
+JUMPV
+LABELV $1197
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1201
+ARGP4
+ADDRLP4 1088
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 0
+NEI4 $1199
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_Where_f
+CALLV
+pop
+ADDRGP4 $1200
+JUMPV
+LABELV $1199
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1204
+ARGP4
+ADDRLP4 1092
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1092
+INDIRI4
+CNSTI4 0
+EQI4 $1206
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1205
+ARGP4
+ADDRLP4 1096
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+CNSTI4 0
+NEI4 $1202
+LABELV $1206
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_CallVote_f
+CALLV
+pop
+ADDRGP4 $1203
+JUMPV
+LABELV $1202
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1209
+ARGP4
+ADDRLP4 1100
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1100
+INDIRI4
+CNSTI4 0
+NEI4 $1207
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_Vote_f
+CALLV
+pop
+ADDRGP4 $1208
+JUMPV
+LABELV $1207
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1212
+ARGP4
+ADDRLP4 1104
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+NEI4 $1210
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_GameCommand_f
+CALLV
+pop
+ADDRGP4 $1211
+JUMPV
+LABELV $1210
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1215
+ARGP4
+ADDRLP4 1108
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+NEI4 $1213
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_SetViewpos_f
+CALLV
+pop
+ADDRGP4 $1214
+JUMPV
+LABELV $1213
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1218
+ARGP4
+ADDRLP4 1112
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+NEI4 $1216
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_Stats_f
+CALLV
+pop
+ADDRGP4 $1217
+JUMPV
+LABELV $1216
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1221
+ARGP4
+ADDRLP4 1116
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 0
+NEI4 $1219
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_SelectLogo_f
+CALLV
+pop
+ADDRGP4 $1220
+JUMPV
+LABELV $1219
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1224
+ARGP4
+ADDRLP4 1120
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1120
+INDIRI4
+CNSTI4 0
+NEI4 $1222
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_ReadyToFight_f
+CALLV
+pop
+ADDRGP4 $1223
+JUMPV
+LABELV $1222
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1227
+ARGP4
+ADDRLP4 1124
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1124
+INDIRI4
+CNSTI4 0
+NEI4 $1225
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_TeamReady_f
+CALLV
+pop
+ADDRGP4 $1226
+JUMPV
+LABELV $1225
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1230
+ARGP4
+ADDRLP4 1128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1128
+INDIRI4
+CNSTI4 0
+EQI4 $1234
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1231
+ARGP4
+ADDRLP4 1132
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1132
+INDIRI4
+CNSTI4 0
+EQI4 $1234
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1232
+ARGP4
+ADDRLP4 1136
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1136
+INDIRI4
+CNSTI4 0
+NEI4 $1228
+LABELV $1234
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_DropCartridge_f
+CALLV
+pop
+ADDRGP4 $1229
+JUMPV
+LABELV $1228
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1237
+ARGP4
+ADDRLP4 1140
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1140
+INDIRI4
+CNSTI4 0
+NEI4 $1235
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_EditBotInv_f
+CALLV
+pop
+ADDRGP4 $1236
+JUMPV
+LABELV $1235
+ADDRGP4 $1238
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1144
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1144
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $1236
+LABELV $1229
+LABELV $1226
+LABELV $1223
+LABELV $1220
+LABELV $1217
+LABELV $1214
+LABELV $1211
+LABELV $1208
+LABELV $1203
+LABELV $1200
+LABELV $1198
+LABELV $1195
+LABELV $1192
+LABELV $1189
+LABELV $1186
+LABELV $1183
+LABELV $1180
+LABELV $1177
+LABELV $1174
+LABELV $1171
+LABELV $1147
+endproc ClientCommand 1148 12
+bss
+align 4
+LABELV scoreSequence
+skip 4
+align 4
+LABELV scoreTeams
+skip 8
+align 4
+LABELV scoreNumSorted
+skip 4
+align 4
+LABELV scoreOrder
+skip 256
+align 4
+LABELV scoreRowSequence
+skip 256
+align 4
+LABELV scoreRows
+skip 4096
+import bot_developer
+import trap_AAS_BestReachableArea
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntities
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_RealTime
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_EntitiesInPVS
+import trap_RestoreClients
+import trap_RewindClients
+import trap_GetUsercmds
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_TraceBatch
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import g_logDamage
+import g_modInstagib_WeaponJump
+import g_modInstagib
+import g_transmitSVboastermissiles
+import g_KillerduckHealth
+import g_LPS_flags
+import g_LPS_startlives
+import g_skyLensflare
+import g_sky
+import g_q3Items
+import pmove_msec
+import pmove_fixed
+import g_antilag
+import g_smoothClients
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_curWarmupReady
+import g_warmupReady
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import MapSupportsGametype
+import G_GetArenaInfoByMap
+import G_InitGameinfo
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import AI_RemoveBambam
+import AI_AddBambam
+import AI_RemoveBoomie
+import AI_AddBoomie
+import BotCamViewangles
+import BotCamViewTarget
+import BotCamViewEntitiy
+import BotChooseWeap
+import BotCamFire
+import BotCamTaunt
+import BotCamMoveTo
+import BotCamMode
+import BotInterbreedEndMatch
+import Svcmd_BotStats_f
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_LoadBots
+import CantDamageTeamitem
+import boomies_createByPlayer
+import bambam_createByPlayer
+import IsItemSameTeam
+import Instagib_canSpawnEntity
+import Instagib_isRelevantDamageEvent
+import Instagib_calculateDamage
+import Instagib_getSpawnWeapon
+import Instagib_applyWeaponJumpKnockback
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import PrintMsg
+import CheckObeliskAttack
+import Team_GetFlagStatus
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThinkBatch
+import ClientThink
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogFlush
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import G_GetCvarInt
+import MoveClientToIntermission
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import GetASpawnPosition
+import SelectSpectatorSpawnPoint
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import respawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import Touch_DoorTrigger
+import G_PushablesChanged
+import G_RunMover
+import fire_kma
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_bubbleg
+import fire_bambamMissile
+import fire_duck
+import explode_imperius
+import fire_splasher
+import fire_nipper
+import fire_boaster
+import G_RunExplosion
+import G_RunMissile
+import BerserkerCheck
+import TossClientCubes
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import GametypeNameShort
+import GametypeName
+import RemoveOwnedItems
+import SetAward
+import G_RestorePowerups
+import G_BackupPowerups
+import DeleteDebugLines
+import DebugLineDouble
+import DebugLine
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_NextActiveEntity
+import G_InitEntityLists
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_FindAll
+import G_Find
+import G_EntityIndexChanged
+import G_InitEntityIndex
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $1238
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1237
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 116
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 0
+align 1
+LABELV $1232
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 0
+align 1
+LABELV $1231
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 67
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $1230
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 67
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $1227
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 82
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 0
+align 1
+LABELV $1224
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 0
+align 1
+LABELV $1221
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 0
+align 1
+LABELV $1218
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $1215
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $1212
+byte 1 103
+byte 1 99
+byte 1 0
+align 1
+LABELV $1209
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $1205
+byte 1 99
+byte 1 118
+byte 1 0
+align 1
+LABELV $1204
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $1201
+byte 1 119
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $1196
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 0
+align 1
+LABELV $1193
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $1190
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $1187
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $1184
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $1181
+byte 1 110
+byte 1 111
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $1178
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $1175
+byte 1 103
+byte 1 111
+byte 1 100
+byte 1 0
+align 1
+LABELV $1172
+byte 1 103
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $1164
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $1161
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $1158
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $1155
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $1140
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1135
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1130
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 100
+byte 1 117
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $1127
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $1124
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 98
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 0
+align 1
+LABELV $1121
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 98
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $1118
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 121
+byte 1 0
+align 1
+LABELV $1115
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1112
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1109
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1106
+byte 1 112
+byte 1 117
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 101
+byte 1 0
+align 1
+LABELV $1103
+byte 1 112
+byte 1 117
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $1100
+byte 1 112
+byte 1 117
+byte 1 95
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 100
+byte 1 117
+byte 1 99
+byte 1 107
+byte 1 115
+byte 1 0
+align 1
+LABELV $1097
+byte 1 112
+byte 1 117
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1093
+byte 1 112
+byte 1 117
+byte 1 95
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1089
+byte 1 112
+byte 1 117
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1085
+byte 1 112
+byte 1 117
+byte 1 95
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1081
+byte 1 112
+byte 1 117
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $1077
+byte 1 112
+byte 1 117
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 121
+byte 1 0
+align 1
+LABELV $1073
+byte 1 112
+byte 1 117
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $1066
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $1063
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $1059
+byte 1 68
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1036
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 67
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $1035
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 67
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $1003
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $999
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $995
+byte 1 37
+byte 1 50
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $987
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $978
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 32
+byte 1 120
+byte 1 32
+byte 1 121
+byte 1 32
+byte 1 122
+byte 1 32
+byte 1 121
+byte 1 97
+byte 1 119
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $961
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $958
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $955
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $931
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $921
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $918
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 60
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 62
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $917
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $882
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $870
+byte 1 32
+byte 1 0
+align 1
+LABELV $861
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 105
+byte 1 109
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $858
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 65
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $838
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $837
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 78
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $834
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $831
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $822
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $811
+byte 1 67
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $809
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $808
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $805
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $802
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 78
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $792
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $789
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 78
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $783
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $776
+byte 1 75
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $773
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $770
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 77
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 105
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 46
+byte 1 32
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 39
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 39
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $767
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 46
+byte 1 32
+byte 1 67
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 39
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 39
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $753
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 79
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 46
+byte 1 32
+byte 1 73
+byte 1 102
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 39
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 39
+byte 1 44
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 39
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 39
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $748
+byte 1 78
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $745
+byte 1 118
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $742
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $737
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $734
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $731
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 59
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $726
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 34
+byte 1 0
+align 1
+LABELV $725
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 98
+byte 1 115
+byte 1 112
+byte 1 0
+align 1
+LABELV $720
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $717
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $714
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $706
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $704
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 102
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $695
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $694
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $689
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 117
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $678
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 44
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 44
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 60
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 44
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 60
+byte 1 110
+byte 1 62
+byte 1 44
+byte 1 32
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 60
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 62
+byte 1 44
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 60
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 62
+byte 1 44
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 60
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 44
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 60
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 62
+byte 1 44
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 60
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 62
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $677
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $674
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $671
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $668
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $665
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $662
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $659
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $656
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $653
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $649
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $640
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 78
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $637
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 105
+byte 1 109
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $634
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 65
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $630
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $625
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $616
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $615
+byte 1 115
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 121
+byte 1 0
+align 1
+LABELV $614
+byte 1 103
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $613
+byte 1 99
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $612
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $611
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $610
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $586
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $580
+byte 1 25
+byte 1 91
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 99
+byte 1 37
+byte 1 99
+byte 1 25
+byte 1 93
+byte 1 25
+byte 1 58
+byte 1 32
+byte 1 0
+align 1
+LABELV $579
+byte 1 25
+byte 1 91
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 99
+byte 1 37
+byte 1 99
+byte 1 25
+byte 1 93
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 25
+byte 1 58
+byte 1 32
+byte 1 0
+align 1
+LABELV $575
+byte 1 84
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $573
+byte 1 25
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 99
+byte 1 37
+byte 1 99
+byte 1 25
+byte 1 41
+byte 1 25
+byte 1 58
+byte 1 32
+byte 1 0
+align 1
+LABELV $572
+byte 1 25
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 99
+byte 1 37
+byte 1 99
+byte 1 25
+byte 1 41
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 25
+byte 1 58
+byte 1 32
+byte 1 0
+align 1
+LABELV $569
+byte 1 83
+byte 1 97
+byte 1 121
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $567
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 99
+byte 1 37
+byte 1 99
+byte 1 25
+byte 1 58
+byte 1 32
+byte 1 0
+align 1
+LABELV $566
+byte 1 83
+byte 1 97
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $560
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $550
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 99
+byte 1 37
+byte 1 99
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $520
+byte 1 67
+byte 1 109
+byte 1 100
+byte 1 95
+byte 1 70
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 67
+byte 1 121
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $483
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 77
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 53
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $478
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $476
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $474
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $472
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $443
+byte 1 115
+byte 1 114
+byte 1 119
+byte 1 99
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $416
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $411
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $400
+byte 1 98
+byte 1 0
+align 1
+LABELV $399
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $395
+byte 1 114
+byte 1 0
+align 1
+LABELV $394
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $387
+byte 1 115
+byte 1 0
+align 1
+LABELV $386
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $383
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 50
+byte 1 0
+align 1
+LABELV $380
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 49
+byte 1 0
+align 1
+LABELV $376
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $375
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $368
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $365
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $362
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $359
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $348
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 76
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $347
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 77
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $341
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 84
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $334
+byte 1 110
+byte 1 111
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 32
+byte 1 79
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $333
+byte 1 110
+byte 1 111
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 32
+byte 1 79
+byte 1 70
+byte 1 70
+byte 1 10
+byte 1 0
+align 1
+LABELV $327
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 79
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $326
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 79
+byte 1 70
+byte 1 70
+byte 1 10
+byte 1 0
+align 1
+LABELV $320
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $319
+byte 1 103
+byte 1 111
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 79
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $318
+byte 1 103
+byte 1 111
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 79
+byte 1 70
+byte 1 70
+byte 1 10
+byte 1 0
+align 1
+LABELV $306
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 101
+byte 1 0
+align 1
+LABELV $303
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $300
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $297
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $294
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $291
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $288
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 103
+byte 1 111
+byte 1 100
+byte 1 0
+align 1
+LABELV $285
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $282
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $276
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $260
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 0
+align 1
+LABELV $254
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $248
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $245
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $239
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $229
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $226
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $200
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $197
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 67
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $150
+byte 1 45
+byte 1 0
+align 1
+LABELV $144
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $129
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $78
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
@@ -0,0 +1,6971 @@
+export BerserkerCheck
+code
+proc BerserkerCheck 80 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $62
+ADDRGP4 $61
+JUMPV
+LABELV $62
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 300
+ADDP4
+INDIRI4
+CNSTI4 5
+MODI4
+CNSTI4 0
+NEI4 $64
+ADDRLP4 68
+CNSTI4 200
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTI4 200
+ASGNI4
+ADDRGP4 $66
+ARGP4
+ADDRLP4 72
+ADDRGP4 BG_FindItem
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRLP4 76
+ADDRGP4 G_Spawn
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_SpawnItem
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 FinishSpawningItem
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 56
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 Touch_Item
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+LABELV $64
+LABELV $61
+endproc BerserkerCheck 80 12
+export ScorePlum
+proc ScorePlum 12 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 69
+ARGI4
+ADDRLP4 4
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 256
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 428
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+LABELV $67
+endproc ScorePlum 12 8
+export AddScore
+proc AddScore 8 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $69
+ADDRGP4 $68
+JUMPV
+LABELV $69
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 0
+EQI4 $71
+ADDRGP4 $68
+JUMPV
+LABELV $71
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+LEI4 $74
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 ScorePlum
+CALLV
+pop
+LABELV $74
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+NEI4 $76
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 252
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+80
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $76
+ADDRGP4 CalculateRanks
+CALLV
+pop
+ADDRGP4 $80
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+LABELV $68
+endproc AddScore 8 16
+export TossClientItems
+proc TossClientItems 56 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+EQI4 $84
+ADDRLP4 16
+INDIRI4
+CNSTI4 11
+NEI4 $82
+LABELV $84
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $85
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRU1
+CVUI4 1
+ASGNI4
+LABELV $85
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 16
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $87
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $87
+LABELV $82
+ADDRGP4 g_modInstagib+12
+INDIRI4
+CNSTI4 0
+EQI4 $89
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $89
+ADDRLP4 28
+CNSTI4 2
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LEI4 $92
+ADDRLP4 16
+INDIRI4
+CNSTI4 11
+EQI4 $92
+ADDRLP4 16
+INDIRI4
+CNSTI4 12
+EQI4 $92
+ADDRLP4 16
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 376
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $92
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 BG_FindItemForWeapon
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 Drop_Item
+CALLP4
+pop
+LABELV $92
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 7
+NEI4 $94
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 8
+LEI4 $97
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 424
+ADDP4
+CNSTI4 8
+ASGNI4
+LABELV $97
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $99
+ADDRGP4 $104
+JUMPV
+LABELV $101
+ADDRGP4 $105
+ARGP4
+ADDRLP4 32
+ADDRGP4 BG_FindItem
+CALLP4
+ASGNP4
+ADDRLP4 36
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+CNSTF4 1135869952
+ADDRLP4 36
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+MULF4
+ARGF4
+ADDRGP4 Drop_Item
+CALLP4
+pop
+LABELV $102
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 424
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $104
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $101
+ADDRGP4 $106
+ARGP4
+ADDRLP4 44
+ADDRGP4 BG_FindItem
+CALLP4
+ASGNP4
+ADDRLP4 48
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+CNSTF4 1135869952
+ADDRLP4 48
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 Drop_Item
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+CNSTI4 700
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 120000
+ADDI4
+ASGNI4
+ADDRGP4 $100
+JUMPV
+LABELV $99
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $108
+ADDRGP4 $113
+JUMPV
+LABELV $110
+ADDRGP4 $106
+ARGP4
+ADDRLP4 32
+ADDRGP4 BG_FindItem
+CALLP4
+ASGNP4
+ADDRLP4 36
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+CNSTF4 1135869952
+ADDRLP4 36
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+MULF4
+ARGF4
+ADDRGP4 Drop_Item
+CALLP4
+pop
+LABELV $111
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 424
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $113
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $110
+ADDRGP4 $105
+ARGP4
+ADDRLP4 44
+ADDRGP4 BG_FindItem
+CALLP4
+ASGNP4
+ADDRLP4 48
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+CNSTF4 1135869952
+ADDRLP4 48
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 Drop_Item
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+CNSTI4 700
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 120000
+ADDI4
+ASGNI4
+LABELV $108
+LABELV $100
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 440
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $95
+JUMPV
+LABELV $94
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+NEI4 $115
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 8
+LEI4 $118
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 424
+ADDP4
+CNSTI4 8
+ASGNI4
+LABELV $118
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 424
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $123
+JUMPV
+LABELV $120
+ADDRGP4 $124
+ARGP4
+ADDRLP4 44
+ADDRGP4 BG_FindItem
+CALLP4
+ASGNP4
+ADDRLP4 48
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+CNSTF4 1135869952
+ADDRLP4 48
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 Drop_Item
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+CNSTI4 700
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 120000
+ADDI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $126
+ADDRLP4 32
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+LABELV $126
+LABELV $121
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 424
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $123
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $120
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 440
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $115
+LABELV $95
+ADDRLP4 12
+CNSTF4 1110704128
+ASGNF4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $128
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+NEI4 $132
+ADDRGP4 $129
+JUMPV
+LABELV $132
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+ADDRGP4 level+68
+INDIRI4
+LEI4 $134
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $137
+ADDRGP4 $129
+JUMPV
+LABELV $137
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 Drop_Item
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 772
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+ADDRGP4 level+68
+INDIRI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 772
+ADDP4
+INDIRI4
+CNSTI4 1
+GEI4 $140
+ADDRLP4 8
+INDIRP4
+CNSTI4 772
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $140
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+CNSTF4 1110704128
+ADDF4
+ASGNF4
+LABELV $134
+LABELV $129
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LTI4 $128
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $142
+CNSTI4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $146
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 BG_FindItemForHoldable
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $149
+ADDRGP4 $143
+JUMPV
+LABELV $149
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 Drop_Item
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 772
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+CNSTF4 1110704128
+ADDF4
+ASGNF4
+LABELV $146
+LABELV $143
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+LTI4 $142
+LABELV $81
+endproc TossClientItems 56 12
+export LookAtKiller
+proc LookAtKiller 40 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 12
+INDIRU4
+CNSTU4 0
+EQU4 $152
+ADDRLP4 12
+INDIRU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+EQU4 $152
+ADDRLP4 20
+CNSTI4 24
+ASGNI4
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28
+CNSTI4 28
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 32
+CNSTI4 32
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $153
+JUMPV
+LABELV $152
+ADDRLP4 16
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 16
+INDIRU4
+CNSTU4 0
+EQU4 $156
+ADDRLP4 16
+INDIRU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+EQU4 $156
+ADDRLP4 20
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+CNSTI4 24
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 32
+CNSTI4 28
+ASGNI4
+ADDRLP4 0+4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36
+CNSTI4 32
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $157
+JUMPV
+LABELV $156
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $151
+JUMPV
+LABELV $157
+LABELV $153
+ADDRLP4 0
+ARGP4
+ADDRLP4 20
+ADDRGP4 vectoyaw
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $151
+endproc LookAtKiller 40 4
+export body_die
+proc body_die 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRI4
+CNSTI4 -200
+LEI4 $161
+ADDRGP4 $160
+JUMPV
+LABELV $161
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+CNSTI4 -199
+ASGNI4
+LABELV $160
+endproc body_die 0 0
+data
+align 4
+LABELV modNames
+address $163
+address $164
+address $165
+address $166
+address $167
+address $168
+address $169
+address $170
+address $171
+address $172
+address $173
+address $174
+address $175
+address $176
+address $177
+address $178
+address $179
+address $180
+address $181
+address $182
+address $183
+address $184
+address $185
+address $186
+address $187
+address $188
+address $189
+address $190
+export CheckAlmostCapture
+code
+proc CheckAlmostCapture 56 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 344
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $194
+ADDRLP4 20
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $192
+LABELV $194
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $195
+ADDRLP4 4
+ADDRGP4 $197
+ASGNP4
+ADDRGP4 $196
+JUMPV
+LABELV $195
+ADDRLP4 4
+ADDRGP4 $198
+ASGNP4
+LABELV $196
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+LABELV $199
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+ASGNP4
+LABELV $200
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $202
+ADDRLP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+NEI4 $199
+LABELV $202
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $203
+ADDRLP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $203
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 36
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 36
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+ARGP4
+ADDRLP4 44
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 44
+INDIRF4
+CNSTF4 1128792064
+GEF4 $207
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 268
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 4
+BXORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $209
+ADDRLP4 52
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 268
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 4
+BXORI4
+ASGNI4
+LABELV $209
+LABELV $207
+LABELV $203
+LABELV $192
+LABELV $191
+endproc CheckAlmostCapture 56 12
+proc CheckAlmostScored 44 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $212
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $214
+ADDRLP4 16
+ADDRGP4 $216
+ASGNP4
+ADDRGP4 $215
+JUMPV
+LABELV $214
+ADDRLP4 16
+ADDRGP4 $217
+ASGNP4
+LABELV $215
+CNSTP4 0
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $218
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 24
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 32
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1128792064
+GEF4 $222
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 268
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 4
+BXORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $224
+ADDRLP4 40
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 268
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 4
+BXORI4
+ASGNI4
+LABELV $224
+LABELV $222
+LABELV $218
+LABELV $212
+LABELV $211
+endproc CheckAlmostScored 44 12
+bss
+align 4
+LABELV $314
+skip 4
+export player_die
+code
+proc player_die 96 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $227
+ADDRGP4 $226
+JUMPV
+LABELV $227
+ADDRGP4 level+9168
+INDIRI4
+CNSTI4 0
+EQI4 $229
+ADDRGP4 $226
+JUMPV
+LABELV $229
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CheckAlmostCapture
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CheckAlmostScored
+CALLV
+pop
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 32
+CNSTU4 0
+ASGNU4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+ADDRLP4 32
+INDIRU4
+EQU4 $232
+ADDRLP4 28
+INDIRP4
+CNSTI4 864
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 32
+INDIRU4
+EQU4 $232
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 864
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Weapon_HookFree
+CALLV
+pop
+LABELV $232
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $234
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $236
+ADDRLP4 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $235
+JUMPV
+LABELV $236
+ADDRLP4 12
+ADDRGP4 $238
+ASGNP4
+ADDRGP4 $235
+JUMPV
+LABELV $234
+ADDRLP4 4
+CNSTI4 1022
+ASGNI4
+ADDRLP4 12
+ADDRGP4 $239
+ASGNP4
+LABELV $235
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $242
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $240
+LABELV $242
+ADDRLP4 4
+CNSTI4 1022
+ASGNI4
+ADDRLP4 12
+ADDRGP4 $239
+ASGNP4
+LABELV $240
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $245
+ADDRFP4 16
+INDIRI4
+CVIU4 4
+CNSTU4 28
+LTU4 $243
+LABELV $245
+ADDRLP4 24
+ADDRGP4 $246
+ASGNP4
+ADDRGP4 $244
+JUMPV
+LABELV $243
+ADDRLP4 24
+ADDRFP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 modNames
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $244
+ADDRGP4 $247
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 65
+ARGI4
+ADDRLP4 48
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+CNSTI4 32
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 280
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $248
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 0
+NEI4 $251
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $254
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $254
+ADDRGP4 CalculateRanks
+CALLV
+pop
+ADDRGP4 SendScoreboardMessageToAllClients
+CALLV
+pop
+LABELV $251
+ADDRLP4 8
+INDIRP4
+CNSTI4 204
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 820
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $257
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $259
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $257
+LABELV $248
+ADDRLP4 60
+CNSTU4 0
+ASGNU4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+ADDRLP4 60
+INDIRU4
+EQU4 $260
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 60
+INDIRU4
+EQU4 $260
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 824
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+EQU4 $265
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 OnSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $265
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 IsItemSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $262
+LABELV $265
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+EQI4 $261
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $269
+ARGP4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRGP4 $261
+JUMPV
+LABELV $262
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+GTI4 $270
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+EQI4 $270
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+EQI4 $270
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 7
+EQI4 $270
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 $276
+ARGP4
+ADDRGP4 AddScore
+CALLV
+pop
+LABELV $270
+ADDRFP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $277
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 340
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $279
+ADDRLP4 80
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 300
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 BerserkerCheck
+CALLV
+pop
+LABELV $279
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 SetAward
+CALLV
+pop
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 268
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRI4
+CNSTI4 2
+BXORI4
+ASGNI4
+LABELV $277
+ADDRGP4 level+68
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 856
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 3000
+GEI4 $281
+ADDRLP4 80
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 288
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 73
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRGP4 SetAward
+CALLV
+pop
+LABELV $281
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 856
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+ADDRGP4 $261
+JUMPV
+LABELV $260
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+EQI4 $285
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $288
+ARGP4
+ADDRGP4 AddScore
+CALLV
+pop
+LABELV $285
+LABELV $261
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Team_FragBonuses
+CALLV
+pop
+ADDRFP4 16
+INDIRI4
+CNSTI4 22
+NEI4 $289
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 344
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $291
+CNSTI4 1
+ARGI4
+ADDRGP4 Team_ReturnFlag
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 344
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $292
+JUMPV
+LABELV $291
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $293
+CNSTI4 2
+ARGI4
+ADDRGP4 Team_ReturnFlag
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 348
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $293
+LABELV $292
+LABELV $289
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 64
+ADDRGP4 trap_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CVIU4 4
+CNSTU4 2147483648
+BANDU4
+CNSTU4 0
+NEU4 $295
+ADDRGP4 level+9476
+INDIRI4
+CNSTI4 0
+NEI4 $295
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 TossClientItems
+CALLV
+pop
+ADDRGP4 $296
+JUMPV
+LABELV $295
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 344
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $298
+CNSTI4 1
+ARGI4
+ADDRGP4 Team_ReturnFlag
+CALLV
+pop
+ADDRGP4 $299
+JUMPV
+LABELV $298
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $300
+CNSTI4 2
+ARGI4
+ADDRGP4 Team_ReturnFlag
+CALLV
+pop
+LABELV $300
+LABELV $299
+LABELV $296
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_Score_f
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $305
+JUMPV
+LABELV $302
+ADDRLP4 68
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $307
+ADDRGP4 $303
+JUMPV
+LABELV $307
+ADDRLP4 68
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $309
+ADDRGP4 $303
+JUMPV
+LABELV $309
+ADDRLP4 68
+INDIRP4
+CNSTI4 640
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+NEI4 $311
+CNSTI4 832
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRGP4 Cmd_Score_f
+CALLV
+pop
+LABELV $311
+LABELV $303
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $305
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $302
+ADDRFP4 0
+INDIRP4
+CNSTI4 748
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+CNSTI4 67108864
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 LookAtKiller
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 456
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 836
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 1700
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 64
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 72
+ADDRGP4 $314
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $317
+ADDRLP4 72
+INDIRI4
+CNSTI4 1
+EQI4 $318
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+EQI4 $319
+ADDRGP4 $315
+JUMPV
+LABELV $317
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $316
+JUMPV
+LABELV $318
+ADDRLP4 16
+CNSTI4 2
+ASGNI4
+ADDRGP4 $316
+JUMPV
+LABELV $319
+LABELV $315
+ADDRLP4 16
+CNSTI4 4
+ASGNI4
+LABELV $316
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRI4
+CNSTI4 -200
+GTI4 $320
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+CNSTI4 -199
+ASGNI4
+LABELV $320
+ADDRLP4 76
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 80
+CNSTI4 128
+ASGNI4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+BANDI4
+ADDRLP4 80
+INDIRI4
+BXORI4
+ADDRLP4 16
+INDIRI4
+BORI4
+ASGNI4
+ADDRLP4 84
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 84
+ADDP4
+ASGNP4
+ADDRLP4 88
+CNSTI4 128
+ASGNI4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRI4
+ADDRLP4 88
+INDIRI4
+BANDI4
+ADDRLP4 88
+INDIRI4
+BXORI4
+ADDRLP4 16
+INDIRI4
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $314
+INDIRI4
+CNSTI4 62
+ADDI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+ADDRGP4 body_die
+ASGNP4
+ADDRLP4 92
+ADDRGP4 $314
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 92
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 3
+MODI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+LABELV $226
+endproc player_die 96 28
+proc CheckArmor 20 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $323
+CNSTI4 0
+RETI4
+ADDRGP4 $322
+JUMPV
+LABELV $323
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $325
+CNSTI4 0
+RETI4
+ADDRGP4 $322
+JUMPV
+LABELV $325
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $327
+CNSTI4 0
+RETI4
+ADDRGP4 $322
+JUMPV
+LABELV $327
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+CNSTF4 1059648963
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+MULF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 ceil
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $329
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $329
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $331
+CNSTI4 0
+RETI4
+ADDRGP4 $322
+JUMPV
+LABELV $331
+ADDRLP4 16
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $322
+endproc CheckArmor 20 4
+export G_Damage
+proc G_Damage 100 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 28
+ADDRFP4 28
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 748
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $334
+ADDRGP4 $333
+JUMPV
+LABELV $334
+ADDRGP4 level+9164
+INDIRI4
+CNSTI4 0
+EQI4 $336
+ADDRGP4 $333
+JUMPV
+LABELV $336
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $341
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $339
+LABELV $341
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $339
+ADDRLP4 0
+INDIRP4
+CNSTI4 880
+ADDP4
+INDIRI4
+CNSTI4 -1
+LEI4 $339
+ADDRFP4 28
+INDIRI4
+CNSTI4 21
+EQI4 $345
+ADDRFP4 28
+INDIRI4
+CNSTI4 18
+EQI4 $345
+ADDRFP4 28
+INDIRI4
+CNSTI4 17
+EQI4 $345
+ADDRFP4 28
+INDIRI4
+CNSTI4 24
+EQI4 $345
+ADDRFP4 28
+INDIRI4
+CNSTI4 22
+NEI4 $339
+LABELV $345
+ADDRLP4 0
+INDIRP4
+CNSTI4 884
+ADDP4
+INDIRI4
+CNSTI4 5000
+ADDI4
+ADDRGP4 level+68
+INDIRI4
+GEI4 $346
+ADDRLP4 0
+INDIRP4
+CNSTI4 880
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $347
+JUMPV
+LABELV $346
+ADDRFP4 8
+CNSTI4 832
+ADDRLP4 0
+INDIRP4
+CNSTI4 880
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+LABELV $347
+LABELV $339
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $349
+ADDRFP4 4
+ADDRGP4 g_entities+850304
+ASGNP4
+LABELV $349
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $352
+ADDRFP4 8
+ADDRGP4 g_entities+850304
+ASGNP4
+LABELV $352
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $355
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 CantDamageTeamitem
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $355
+ADDRGP4 $333
+JUMPV
+LABELV $355
+ADDRLP4 40
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+NEI4 $357
+ADDRFP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $333
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $361
+ADDRLP4 48
+INDIRI4
+CNSTI4 4
+NEI4 $333
+LABELV $361
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $333
+JUMPV
+LABELV $357
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $362
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+EQU4 $362
+ADDRLP4 16
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ADDRLP4 16
+INDIRI4
+MULI4
+CNSTI4 100
+DIVI4
+ASGNI4
+LABELV $362
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $364
+ADDRLP4 0
+INDIRP4
+CNSTI4 696
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $366
+ADDRGP4 $333
+JUMPV
+LABELV $366
+LABELV $364
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $368
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+ADDRGP4 $369
+JUMPV
+LABELV $368
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+LABELV $369
+ADDRGP4 g_modInstagib+12
+INDIRI4
+CNSTI4 0
+EQI4 $370
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 Instagib_calculateDamage
+CALLI4
+ASGNI4
+ADDRFP4 20
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $370
+ADDRLP4 4
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 28
+INDIRI4
+CNSTI4 13
+NEI4 $373
+ADDRLP4 4
+INDIRI4
+CNSTI4 100
+LEI4 $373
+ADDRLP4 4
+CNSTI4 100
+ASGNI4
+LABELV $373
+ADDRFP4 28
+INDIRI4
+CNSTI4 1
+NEI4 $375
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+NEU4 $375
+ADDRLP4 4
+CNSTF4 1073741824
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $375
+ADDRFP4 28
+INDIRI4
+CNSTI4 5
+NEI4 $377
+ADDRLP4 4
+CNSTF4 1073741824
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $377
+ADDRLP4 4
+INDIRI4
+CNSTI4 200
+LEI4 $379
+ADDRLP4 4
+CNSTI4 200
+ASGNI4
+LABELV $379
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $381
+ADDRFP4 24
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $383
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $383
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $385
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $385
+ADDRLP4 60
+CNSTF4 1128792064
+ASGNF4
+ADDRLP4 68
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 72
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRGP4 g_knockback+8
+INDIRF4
+ADDRLP4 68
+INDIRF4
+MULF4
+ADDRLP4 72
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 48+4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 g_knockback+8
+INDIRF4
+ADDRLP4 68
+INDIRF4
+MULF4
+ADDRLP4 72
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 48+8
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 g_knockback+8
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+MULF4
+ADDRLP4 60
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 76
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+ADDRLP4 48
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+ADDRLP4 48+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 84
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRF4
+ADDRLP4 48+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $394
+ADDRLP4 88
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LSHI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 50
+GEI4 $396
+ADDRLP4 88
+CNSTI4 50
+ASGNI4
+LABELV $396
+ADDRLP4 88
+INDIRI4
+CNSTI4 200
+LEI4 $398
+ADDRLP4 88
+CNSTI4 200
+ASGNI4
+LABELV $398
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 92
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 92
+INDIRP4
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+LABELV $394
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+EQU4 $402
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 OnSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+EQI4 $400
+LABELV $402
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 880
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $401
+JUMPV
+LABELV $400
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 880
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 884
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+LABELV $401
+LABELV $385
+ADDRFP4 24
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $404
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+EQU4 $409
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 OnSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $408
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 IsItemSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+NEI4 $408
+LABELV $409
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+NEU4 $406
+ADDRFP4 28
+INDIRI4
+CNSTI4 27
+NEI4 $406
+LABELV $408
+ADDRGP4 g_friendlyFire+12
+INDIRI4
+CNSTI4 0
+NEI4 $410
+ADDRGP4 $333
+JUMPV
+LABELV $410
+LABELV $406
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $413
+ADDRGP4 $333
+JUMPV
+LABELV $413
+LABELV $404
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $415
+ADDRLP4 0
+INDIRP4
+CNSTI4 320
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $415
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 67
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRFP4 24
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $419
+ADDRFP4 28
+INDIRI4
+CNSTI4 21
+NEI4 $417
+LABELV $419
+ADDRGP4 $333
+JUMPV
+LABELV $417
+ADDRFP4 20
+CNSTF4 1056964608
+ADDRFP4 20
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $415
+ADDRLP4 56
+CNSTU4 0
+ASGNU4
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 56
+INDIRU4
+EQU4 $420
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+EQU4 $420
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+LEI4 $420
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 56
+INDIRU4
+EQU4 $420
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 3
+EQI4 $420
+ADDRLP4 68
+INDIRI4
+ADDRLP4 64
+INDIRI4
+EQI4 $420
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 OnSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $422
+ADDRLP4 76
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 256
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $423
+JUMPV
+LABELV $422
+ADDRLP4 76
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 256
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $423
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 276
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRI4
+CNSTI4 8
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+BORI4
+ASGNI4
+LABELV $420
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+NEU4 $424
+ADDRFP4 20
+CNSTF4 1056964608
+ADDRFP4 20
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $424
+ADDRFP4 20
+INDIRI4
+CNSTI4 1
+GEI4 $426
+ADDRFP4 20
+CNSTI4 1
+ASGNI4
+LABELV $426
+ADDRLP4 8
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 72
+ADDRGP4 CheckArmor
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 g_debugDamage+12
+INDIRI4
+CNSTI4 0
+EQI4 $428
+ADDRGP4 $431
+ARGP4
+ADDRGP4 level+68
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $428
+ADDRGP4 g_logDamage+12
+INDIRI4
+CNSTI4 0
+EQI4 $433
+ADDRGP4 $436
+ARGP4
+ADDRLP4 76
+ADDRGP4 g_entities
+CVPU4 4
+ASGNU4
+ADDRLP4 80
+CNSTI4 832
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 76
+INDIRU4
+SUBU4
+CVUI4 4
+ADDRLP4 80
+INDIRI4
+DIVI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 76
+INDIRU4
+SUBU4
+CVUI4 4
+ADDRLP4 80
+INDIRI4
+DIVI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+ADDRLP4 76
+INDIRU4
+SUBU4
+CVUI4 4
+ADDRLP4 80
+INDIRI4
+DIVI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+LABELV $433
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $437
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $439
+ADDRLP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 $440
+JUMPV
+LABELV $439
+ADDRLP4 0
+INDIRP4
+CNSTI4 880
+ADDP4
+INDIRI4
+CNSTI4 -1
+LEI4 $441
+ADDRLP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 880
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $442
+JUMPV
+LABELV $441
+ADDRLP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+CNSTI4 1022
+ASGNI4
+LABELV $442
+LABELV $440
+ADDRLP4 76
+ADDRLP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 84
+ADDRLP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $443
+ADDRLP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+ADDRFP4 12
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 800
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $444
+JUMPV
+LABELV $443
+ADDRLP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 800
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $444
+LABELV $437
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 6
+NEI4 $445
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Team_CheckHurtCarrier
+CALLV
+pop
+LABELV $445
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $448
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 828
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 832
+ADDP4
+ADDRFP4 28
+INDIRI4
+ASGNI4
+LABELV $448
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $450
+ADDRLP4 76
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $452
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $452
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $454
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $456
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRI4
+CNSTI4 2048
+BORI4
+ASGNI4
+LABELV $456
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRI4
+CNSTI4 -999
+GEI4 $458
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+CNSTI4 -999
+ASGNI4
+LABELV $458
+ADDRFP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $333
+JUMPV
+LABELV $454
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $460
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $460
+LABELV $450
+LABELV $333
+endproc G_Damage 100 24
+proc CanDamageCorners 52 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 476
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1056964608
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $469
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 60
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 36
+ADDP4
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $474
+ADDRLP4 28
+CNSTF4 3245342720
+ASGNF4
+ADDRGP4 $475
+JUMPV
+LABELV $474
+ADDRLP4 28
+CNSTF4 1097859072
+ASGNF4
+LABELV $475
+ADDRLP4 36
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $477
+ADDRLP4 40
+CNSTF4 3245342720
+ASGNF4
+ADDRGP4 $478
+JUMPV
+LABELV $477
+ADDRLP4 40
+CNSTF4 1097859072
+ASGNF4
+LABELV $478
+ADDRLP4 48
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDF4
+ASGNF4
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 48
+ADDP4
+CNSTI4 1023
+ASGNI4
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 52
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $470
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $469
+LABELV $462
+endproc CanDamageCorners 52 12
+proc CanDamage 8 0
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+EQF4 $482
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+NEI4 $480
+LABELV $482
+CNSTI4 1
+RETI4
+ADDRGP4 $479
+JUMPV
+LABELV $480
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $483
+CNSTI4 56
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+NEF4 $487
+CNSTI4 1
+RETI4
+ADDRGP4 $479
+JUMPV
+LABELV $487
+LABELV $484
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $483
+CNSTI4 0
+RETI4
+LABELV $479
+endproc CanDamage 8 0
+proc G_RadiusDamageBatch 4024 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 3992
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 60
+ADDRFP4 16
+INDIRI4
+CVIU4 4
+MULU4
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $493
+JUMPV
+LABELV $490
+ADDRLP4 1924
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4+36
+ADDP4
+ADDRLP4 1924
+INDIRP4
+CNSTI4 464
+ADDP4
+INDIRF4
+ADDRLP4 1924
+INDIRP4
+CNSTI4 476
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4+36+4
+ADDP4
+ADDRLP4 1924
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRF4
+ADDRLP4 1924
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4+36+8
+ADDP4
+ADDRLP4 1924
+INDIRP4
+CNSTI4 472
+ADDP4
+INDIRF4
+ADDRLP4 1924
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4012
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4012
+INDIRI4
+ADDRLP4 4+36
+ADDP4
+CNSTF4 1056964608
+ADDRLP4 4012
+INDIRI4
+ADDRLP4 4+36
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4016
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4016
+INDIRI4
+ADDRLP4 4+36+4
+ADDP4
+CNSTF4 1056964608
+ADDRLP4 4016
+INDIRI4
+ADDRLP4 4+36+4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4020
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4020
+INDIRI4
+ADDRLP4 4+36+8
+ADDP4
+CNSTF4 1056964608
+ADDRLP4 4020
+INDIRI4
+ADDRLP4 4+36+8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4+48
+ADDP4
+CNSTI4 1023
+ASGNI4
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4+52
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $491
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $493
+ADDRLP4 0
+INDIRI4
+ADDRFP4 16
+INDIRI4
+LTI4 $490
+ADDRLP4 2060
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 trap_TraceBatch
+CALLV
+pop
+ADDRLP4 3996
+CNSTI4 0
+ASGNI4
+ADDRLP4 2056
+ADDRLP4 3996
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 3996
+INDIRI4
+ASGNI4
+ADDRGP4 $514
+JUMPV
+LABELV $511
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1928
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 4004
+CNSTI4 56
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4004
+INDIRI4
+ADDRLP4 2060+8
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+EQF4 $519
+ADDRLP4 4004
+INDIRI4
+ADDRLP4 2060+52
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRP4
+INDIRI4
+NEI4 $515
+LABELV $519
+ADDRGP4 $512
+JUMPV
+LABELV $515
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1928
+ADDP4
+ADDRLP4 2056
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 60
+ADDRLP4 2056
+INDIRI4
+MULI4
+ADDRGP4 cornerRequests
+ADDP4
+ARGP4
+ADDRGP4 CanDamageCorners
+CALLV
+pop
+ADDRLP4 2056
+ADDRLP4 2056
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+LABELV $512
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $514
+ADDRLP4 0
+INDIRI4
+ADDRFP4 16
+INDIRI4
+LTI4 $511
+ADDRLP4 2056
+INDIRI4
+CNSTI4 0
+EQI4 $520
+ADDRGP4 cornerResults
+ARGP4
+ADDRGP4 cornerRequests
+ARGP4
+ADDRLP4 2056
+INDIRI4
+ARGI4
+ADDRGP4 trap_TraceBatch
+CALLV
+pop
+LABELV $520
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $525
+JUMPV
+LABELV $522
+ADDRLP4 4008
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4008
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 56
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 2060
+ADDP4
+ARGP4
+ADDRLP4 4008
+INDIRI4
+ADDRLP4 1928
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $527
+ADDRLP4 4000
+CNSTI4 56
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1928
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cornerResults
+ADDP4
+ASGNP4
+ADDRGP4 $528
+JUMPV
+LABELV $527
+ADDRLP4 4000
+CNSTP4 0
+ASGNP4
+LABELV $528
+ADDRLP4 4000
+INDIRP4
+ARGP4
+ADDRLP4 4012
+ADDRGP4 CanDamage
+CALLI4
+ASGNI4
+ADDRLP4 4008
+INDIRI4
+ADDRLP4 3864
+ADDP4
+ADDRLP4 4012
+INDIRI4
+ASGNI4
+LABELV $523
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $525
+ADDRLP4 0
+INDIRI4
+ADDRFP4 16
+INDIRI4
+LTI4 $522
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $532
+JUMPV
+LABELV $529
+ADDRLP4 1924
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1924
+INDIRP4
+CNSTI4 748
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $533
+ADDRGP4 $530
+JUMPV
+LABELV $533
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 3864
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $535
+ADDRLP4 1924
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4000
+ADDRGP4 LogAccuracyHit
+CALLI4
+ASGNI4
+ADDRLP4 4000
+INDIRI4
+CNSTI4 0
+EQI4 $537
+ADDRLP4 3992
+CNSTI4 1
+ASGNI4
+LABELV $537
+ADDRLP4 3852
+ADDRLP4 1924
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 3852+4
+ADDRLP4 1924
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 3852+8
+ADDRLP4 1924
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 3852+8
+ADDRLP4 3852+8
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 1924
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 3852
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 12
+INDIRP4
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+LABELV $535
+LABELV $530
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $532
+ADDRLP4 0
+INDIRI4
+ADDRFP4 16
+INDIRI4
+LTI4 $529
+ADDRLP4 3992
+INDIRI4
+RETI4
+LABELV $489
+endproc G_RadiusDamageBatch 4024 32
+export G_RadiusDamage
+proc G_RadiusDamage 4436 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 4412
+CNSTI4 0
+ASGNI4
+ADDRFP4 12
+INDIRF4
+CNSTF4 1065353216
+GEF4 $543
+ADDRFP4 12
+CNSTF4 1065353216
+ASGNF4
+LABELV $543
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $545
+ADDRLP4 4416
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4416
+INDIRI4
+ADDRLP4 4388
+ADDP4
+ADDRLP4 4416
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4420
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4420
+INDIRI4
+ADDRLP4 4400
+ADDP4
+ADDRLP4 4420
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $546
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $545
+ADDRLP4 4388
+ARGP4
+ADDRLP4 4400
+ARGP4
+ADDRLP4 288
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 4416
+ADDRGP4 trap_EntitiesInBox
+CALLI4
+ASGNI4
+ADDRLP4 4384
+ADDRLP4 4416
+INDIRI4
+ASGNI4
+ADDRLP4 4420
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+ADDRLP4 4420
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 4420
+INDIRI4
+ASGNI4
+ADDRGP4 $552
+JUMPV
+LABELV $549
+ADDRLP4 4
+CNSTI4 832
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 288
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+NEU4 $553
+ADDRGP4 $550
+JUMPV
+LABELV $553
+ADDRLP4 4
+INDIRP4
+CNSTI4 748
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $555
+ADDRGP4 $550
+JUMPV
+LABELV $555
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $557
+ADDRLP4 4424
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4424
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 4424
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 464
+ADDP4
+ADDP4
+INDIRF4
+GEF4 $561
+ADDRLP4 4428
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4428
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 4428
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 464
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 4428
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $562
+JUMPV
+LABELV $561
+ADDRLP4 4428
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4428
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 4428
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 476
+ADDP4
+ADDP4
+INDIRF4
+LEF4 $563
+ADDRLP4 4432
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4432
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 4432
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 4432
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 476
+ADDP4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $564
+JUMPV
+LABELV $563
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $564
+LABELV $562
+LABELV $558
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $557
+ADDRLP4 8
+ARGP4
+ADDRLP4 4424
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 4424
+INDIRF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ADDRFP4 12
+INDIRF4
+LTF4 $565
+ADDRGP4 $550
+JUMPV
+LABELV $565
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 160
+ADDP4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 28
+INDIRF4
+ADDRFP4 12
+INDIRF4
+DIVF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 4428
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 4428
+INDIRI4
+ASGNI4
+ADDRLP4 4428
+INDIRI4
+CNSTI4 32
+NEI4 $567
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 160
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRLP4 4432
+ADDRGP4 G_RadiusDamageBatch
+CALLI4
+ASGNI4
+ADDRLP4 4432
+INDIRI4
+CNSTI4 0
+EQI4 $569
+ADDRLP4 4412
+CNSTI4 1
+ASGNI4
+LABELV $569
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $567
+LABELV $550
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $552
+ADDRLP4 24
+INDIRI4
+ADDRLP4 4384
+INDIRI4
+LTI4 $549
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $571
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 160
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRLP4 4428
+ADDRGP4 G_RadiusDamageBatch
+CALLI4
+ASGNI4
+ADDRLP4 4428
+INDIRI4
+CNSTI4 0
+EQI4 $571
+ADDRLP4 4412
+CNSTI4 1
+ASGNI4
+LABELV $571
+ADDRLP4 4412
+INDIRI4
+RETI4
+LABELV $542
+endproc G_RadiusDamage 4436 24
+bss
+align 4
+LABELV cornerResults
+skip 7168
+align 4
+LABELV cornerRequests
+skip 7680
+import trap_AAS_BestReachableArea
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntities
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_RealTime
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_EntitiesInPVS
+import trap_RestoreClients
+import trap_RewindClients
+import trap_GetUsercmds
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_TraceBatch
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import g_logDamage
+import g_modInstagib_WeaponJump
+import g_modInstagib
+import g_transmitSVboastermissiles
+import g_KillerduckHealth
+import g_LPS_flags
+import g_LPS_startlives
+import g_skyLensflare
+import g_sky
+import g_q3Items
+import pmove_msec
+import pmove_fixed
+import g_antilag
+import g_smoothClients
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_curWarmupReady
+import g_warmupReady
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import MapSupportsGametype
+import G_GetArenaInfoByMap
+import G_InitGameinfo
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import AI_RemoveBambam
+import AI_AddBambam
+import AI_RemoveBoomie
+import AI_AddBoomie
+import BotCamViewangles
+import BotCamViewTarget
+import BotCamViewEntitiy
+import BotChooseWeap
+import BotCamFire
+import BotCamTaunt
+import BotCamMoveTo
+import BotCamMode
+import BotInterbreedEndMatch
+import Svcmd_BotStats_f
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_LoadBots
+import CantDamageTeamitem
+import boomies_createByPlayer
+import bambam_createByPlayer
+import IsItemSameTeam
+import Instagib_canSpawnEntity
+import Instagib_isRelevantDamageEvent
+import Instagib_calculateDamage
+import Instagib_getSpawnWeapon
+import Instagib_applyWeaponJumpKnockback
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import PrintMsg
+import CheckObeliskAttack
+import Team_GetFlagStatus
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThinkBatch
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogFlush
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import G_GetCvarInt
+import MoveClientToIntermission
+import G_SendScoreboardUpdates
+import DeathmatchScoreboardMessage
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import GetASpawnPosition
+import SelectSpectatorSpawnPoint
+import SpotWouldTelefrag
+import CalculateRanks
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import respawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import Touch_DoorTrigger
+import G_PushablesChanged
+import G_RunMover
+import fire_kma
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_bubbleg
+import fire_bambamMissile
+import fire_duck
+import explode_imperius
+import fire_splasher
+import fire_nipper
+import fire_boaster
+import G_RunExplosion
+import G_RunMissile
+import TossClientCubes
+import G_InvulnerabilityEffect
+import GametypeNameShort
+import GametypeName
+import RemoveOwnedItems
+import SetAward
+import G_RestorePowerups
+import G_BackupPowerups
+import DeleteDebugLines
+import DebugLineDouble
+import DebugLine
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_NextActiveEntity
+import G_InitEntityLists
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_FindAll
+import G_Find
+import G_EntityIndexChanged
+import G_InitEntityIndex
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import G_Say
+import ConcatArgs
+import Cmd_DropCartridge_f
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $436
+byte 1 68
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $431
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $288
+byte 1 115
+byte 1 117
+byte 1 105
+byte 1 99
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $276
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $269
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $259
+byte 1 99
+byte 1 100
+byte 1 105
+byte 1 32
+byte 1 50
+byte 1 0
+align 1
+LABELV $247
+byte 1 75
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $246
+byte 1 60
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 121
+byte 1 62
+byte 1 0
+align 1
+LABELV $239
+byte 1 60
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 62
+byte 1 0
+align 1
+LABELV $238
+byte 1 60
+byte 1 110
+byte 1 111
+byte 1 110
+byte 1 45
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 62
+byte 1 0
+align 1
+LABELV $217
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $216
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $198
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 76
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 108
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $197
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 76
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $190
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 66
+byte 1 79
+byte 1 79
+byte 1 77
+byte 1 73
+byte 1 69
+byte 1 83
+byte 1 0
+align 1
+LABELV $189
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 66
+byte 1 65
+byte 1 77
+byte 1 66
+byte 1 65
+byte 1 77
+byte 1 0
+align 1
+LABELV $188
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 71
+byte 1 82
+byte 1 65
+byte 1 80
+byte 1 80
+byte 1 76
+byte 1 69
+byte 1 0
+align 1
+LABELV $187
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 84
+byte 1 82
+byte 1 73
+byte 1 71
+byte 1 71
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 72
+byte 1 85
+byte 1 82
+byte 1 84
+byte 1 0
+align 1
+LABELV $186
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 82
+byte 1 71
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $185
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 83
+byte 1 85
+byte 1 73
+byte 1 67
+byte 1 73
+byte 1 68
+byte 1 69
+byte 1 0
+align 1
+LABELV $184
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 0
+align 1
+LABELV $183
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 70
+byte 1 82
+byte 1 65
+byte 1 71
+byte 1 0
+align 1
+LABELV $182
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 67
+byte 1 82
+byte 1 85
+byte 1 83
+byte 1 72
+byte 1 0
+align 1
+LABELV $181
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 76
+byte 1 65
+byte 1 86
+byte 1 65
+byte 1 0
+align 1
+LABELV $180
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 83
+byte 1 76
+byte 1 73
+byte 1 77
+byte 1 69
+byte 1 0
+align 1
+LABELV $179
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $178
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 75
+byte 1 73
+byte 1 76
+byte 1 76
+byte 1 69
+byte 1 82
+byte 1 68
+byte 1 85
+byte 1 67
+byte 1 75
+byte 1 83
+byte 1 0
+align 1
+LABELV $177
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 73
+byte 1 78
+byte 1 74
+byte 1 69
+byte 1 67
+byte 1 84
+byte 1 79
+byte 1 82
+byte 1 0
+align 1
+LABELV $176
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 73
+byte 1 77
+byte 1 80
+byte 1 69
+byte 1 82
+byte 1 73
+byte 1 85
+byte 1 83
+byte 1 95
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 0
+align 1
+LABELV $175
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 73
+byte 1 77
+byte 1 80
+byte 1 69
+byte 1 82
+byte 1 73
+byte 1 85
+byte 1 83
+byte 1 0
+align 1
+LABELV $174
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 66
+byte 1 79
+byte 1 65
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $173
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $172
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 66
+byte 1 85
+byte 1 66
+byte 1 66
+byte 1 76
+byte 1 69
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 0
+align 1
+LABELV $171
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 66
+byte 1 85
+byte 1 66
+byte 1 66
+byte 1 76
+byte 1 69
+byte 1 71
+byte 1 0
+align 1
+LABELV $170
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 66
+byte 1 69
+byte 1 84
+byte 1 84
+byte 1 89
+byte 1 95
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 0
+align 1
+LABELV $169
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 66
+byte 1 69
+byte 1 84
+byte 1 84
+byte 1 89
+byte 1 0
+align 1
+LABELV $168
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 79
+byte 1 79
+byte 1 78
+byte 1 89
+byte 1 95
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 0
+align 1
+LABELV $167
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 79
+byte 1 79
+byte 1 78
+byte 1 89
+byte 1 0
+align 1
+LABELV $166
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 78
+byte 1 73
+byte 1 80
+byte 1 80
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $165
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 80
+byte 1 85
+byte 1 78
+byte 1 67
+byte 1 72
+byte 1 89
+byte 1 0
+align 1
+LABELV $164
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 80
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $163
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 85
+byte 1 78
+byte 1 75
+byte 1 78
+byte 1 79
+byte 1 87
+byte 1 78
+byte 1 0
+align 1
+LABELV $124
+byte 1 110
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 67
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $106
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 67
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $105
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 67
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $80
+byte 1 65
+byte 1 100
+byte 1 100
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $66
+byte 1 80
+byte 1 85
+byte 1 80
+byte 1 80
+byte 1 69
+byte 1 84
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 0
@@ -0,0 +1,4730 @@
+code
+proc Touch_triggerChild 12 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTU4 0
+ASGNU4
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRU4
+EQU4 $62
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 600
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRU4
+EQU4 $62
+ADDRLP4 4
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRU4
+EQU4 $62
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 600
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $62
+LABELV $61
+endproc Touch_triggerChild 12 12
+proc createTrigger 36 4
+ADDRLP4 4
+ADDRGP4 G_Spawn
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRGP4 $65
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 600
+ADDP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 4
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ADDRLP4 12
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 4
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+ADDRLP4 20
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 8
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 456
+ADDP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+ADDRLP4 28
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+CNSTI4 128
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+CNSTI4 1073741824
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+ADDRGP4 Touch_triggerChild
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $64
+endproc createTrigger 36 4
+export IsItemSameTeam
+proc IsItemSameTeam 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRU4
+EQU4 $70
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRU4
+EQU4 $70
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRU4
+NEU4 $67
+LABELV $70
+CNSTI4 0
+RETI4
+ADDRGP4 $66
+JUMPV
+LABELV $67
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 16
+EQI4 $73
+ADDRLP4 8
+INDIRI4
+CNSTI4 17
+NEI4 $71
+LABELV $73
+ADDRFP4 0
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 114
+NEI4 $77
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $76
+LABELV $77
+ADDRFP4 0
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 98
+NEI4 $74
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $74
+LABELV $76
+CNSTI4 1
+RETI4
+ADDRGP4 $66
+JUMPV
+LABELV $74
+LABELV $71
+CNSTI4 0
+RETI4
+LABELV $66
+endproc IsItemSameTeam 12 0
+export CantDamageTeamitem
+proc CantDamageTeamitem 12 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $79
+CNSTI4 0
+RETI4
+ADDRGP4 $78
+JUMPV
+LABELV $79
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+EQI4 $83
+ADDRLP4 0
+INDIRI4
+CNSTI4 17
+NEI4 $81
+LABELV $83
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 IsItemSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $84
+ADDRGP4 g_friendlyFire+12
+INDIRI4
+CNSTI4 0
+EQI4 $88
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $89
+JUMPV
+LABELV $88
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+LABELV $89
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $78
+JUMPV
+LABELV $84
+LABELV $81
+CNSTI4 0
+RETI4
+LABELV $78
+endproc CantDamageTeamitem 12 8
+lit
+align 4
+LABELV $91
+byte 4 3271557120
+byte 4 3271557120
+byte 4 3253731328
+align 4
+LABELV $92
+byte 4 1124073472
+byte 4 1124073472
+byte 4 1115684864
+export IsBambamBoomieSpotClean
+code
+proc IsBambamBoomieSpotClean 156 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 48
+ADDRGP4 $91
+INDIRB
+ASGNB 12
+ADDRLP4 60
+ADDRGP4 $92
+INDIRB
+ASGNB 12
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 48
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 48+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 48+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 48+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 48+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 60
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 60+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 60+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 60+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 60+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 48
+ARGP4
+ADDRLP4 60
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 80
+ADDRGP4 trap_EntitiesInBox
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $104
+JUMPV
+LABELV $101
+ADDRLP4 84
+CNSTI4 832
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 17
+NEI4 $105
+ADDRLP4 84
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 DistanceSquared
+CALLF4
+ASGNF4
+ADDRLP4 88
+ADDRLP4 92
+INDIRF4
+ASGNF4
+ADDRLP4 88
+INDIRF4
+CNSTF4 1166016512
+GEF4 $106
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $109
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $90
+JUMPV
+LABELV $105
+ADDRLP4 84
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $110
+ADDRLP4 84
+INDIRP4
+CNSTI4 828
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $110
+ADDRLP4 84
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 DistanceSquared
+CALLF4
+ASGNF4
+ADDRLP4 92
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 92
+INDIRF4
+CNSTF4 1166016512
+GEF4 $111
+ADDRLP4 84
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+NEI4 $111
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $114
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $90
+JUMPV
+LABELV $110
+ADDRLP4 84
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 15
+NEI4 $115
+ADDRLP4 84
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 DistanceSquared
+CALLF4
+ASGNF4
+ADDRLP4 92
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 92
+INDIRF4
+CNSTF4 1182793728
+GEF4 $116
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $119
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $90
+JUMPV
+LABELV $115
+ADDRLP4 84
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $120
+ADDRLP4 96
+ADDRLP4 84
+INDIRP4
+CNSTI4 828
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 8
+EQI4 $122
+ADDRLP4 96
+INDIRI4
+CNSTI4 9
+NEI4 $120
+LABELV $122
+ADDRLP4 84
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 DistanceSquared
+CALLF4
+ASGNF4
+ADDRLP4 100
+ADDRLP4 104
+INDIRF4
+ASGNF4
+ADDRLP4 100
+INDIRF4
+CNSTF4 1199570944
+GEF4 $121
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $125
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $90
+JUMPV
+LABELV $120
+ADDRLP4 84
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $126
+ADDRLP4 100
+ADDRLP4 84
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRF4
+ADDRLP4 84
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 100+4
+ADDRLP4 84
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRF4
+ADDRLP4 84
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 100+8
+ADDRLP4 84
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRF4
+ADDRLP4 84
+INDIRP4
+CNSTI4 456
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 124
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 100
+ADDRLP4 124
+INDIRF4
+ADDRLP4 100
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 100+4
+ADDRLP4 124
+INDIRF4
+ADDRLP4 100+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 100+8
+CNSTF4 1056964608
+ADDRLP4 100+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 100
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 DistanceSquared
+CALLF4
+ASGNF4
+ADDRLP4 112
+ADDRLP4 128
+INDIRF4
+ASGNF4
+ADDRLP4 112
+INDIRF4
+CNSTF4 1182793728
+GEF4 $127
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $136
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $90
+JUMPV
+LABELV $126
+ADDRLP4 84
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $139
+ARGP4
+ADDRLP4 100
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+NEI4 $137
+ADDRLP4 84
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 DistanceSquared
+CALLF4
+ASGNF4
+ADDRLP4 104
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 104
+INDIRF4
+CNSTF4 1182793728
+GEF4 $138
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $136
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $90
+JUMPV
+LABELV $137
+ADDRLP4 84
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $144
+ARGP4
+ADDRLP4 104
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 0
+EQI4 $146
+ADDRLP4 84
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $145
+ARGP4
+ADDRLP4 108
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+NEI4 $142
+LABELV $146
+ADDRLP4 84
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 116
+ADDRGP4 DistanceSquared
+CALLF4
+ASGNF4
+ADDRLP4 112
+ADDRLP4 116
+INDIRF4
+ASGNF4
+ADDRLP4 112
+INDIRF4
+CNSTF4 1182793728
+GEF4 $143
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $149
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $90
+JUMPV
+LABELV $142
+ADDRLP4 84
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $152
+ARGP4
+ADDRLP4 112
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 0
+EQI4 $154
+ADDRLP4 84
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $153
+ARGP4
+ADDRLP4 116
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 0
+NEI4 $150
+LABELV $154
+ADDRLP4 84
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 124
+ADDRGP4 DistanceSquared
+CALLF4
+ASGNF4
+ADDRLP4 120
+ADDRLP4 124
+INDIRF4
+ASGNF4
+ADDRLP4 120
+INDIRF4
+CNSTF4 1182793728
+GEF4 $151
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $157
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $90
+JUMPV
+LABELV $150
+ADDRLP4 84
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $160
+ARGP4
+ADDRLP4 120
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+NEI4 $158
+ADDRLP4 124
+ADDRLP4 84
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRF4
+ADDRLP4 84
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 84
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRF4
+ADDRLP4 84
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 84
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRF4
+ADDRLP4 84
+INDIRP4
+CNSTI4 456
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 148
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 124
+ADDRLP4 148
+INDIRF4
+ADDRLP4 124
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 148
+INDIRF4
+ADDRLP4 124+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 124+8
+CNSTF4 1056964608
+ADDRLP4 124+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 124
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 DistanceSquared
+CALLF4
+ASGNF4
+ADDRLP4 136
+ADDRLP4 152
+INDIRF4
+ASGNF4
+ADDRLP4 136
+INDIRF4
+CNSTF4 1182793728
+GEF4 $167
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRGP4 $169
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $90
+JUMPV
+LABELV $167
+LABELV $158
+LABELV $151
+LABELV $143
+LABELV $138
+LABELV $127
+LABELV $121
+LABELV $116
+LABELV $111
+LABELV $106
+LABELV $102
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $104
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $101
+CNSTI4 1
+RETI4
+LABELV $90
+endproc IsBambamBoomieSpotClean 156 16
+proc bambam_touch 144 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $171
+ADDRGP4 $170
+JUMPV
+LABELV $171
+ADDRFP4 0
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $173
+ADDRGP4 $170
+JUMPV
+LABELV $173
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 IsItemSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $175
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 644
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $178
+ADDRGP4 level+68
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+CNSTI4 100
+LEI4 $175
+LABELV $178
+ADDRLP4 40
+CNSTF4 1155596288
+ASGNF4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 24+8
+ADDRLP4 24+8
+INDIRF4
+CNSTF4 1115684864
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 104
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 104
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $184
+ADDRLP4 36
+INDIRF4
+CNSTF4 1134559232
+LEF4 $184
+ADDRGP4 $170
+JUMPV
+LABELV $184
+ADDRLP4 112
+ADDRLP4 36
+INDIRF4
+ADDRLP4 40
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ADDRLP4 112
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 112
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 40
+INDIRF4
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 44
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 120
+CNSTP4 0
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ARGP4
+ADDRLP4 120
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 44+8
+INDIRF4
+CNSTF4 1065353216
+EQF4 $192
+ADDRLP4 44+52
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+NEI4 $188
+LABELV $192
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $193
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 1000
+ADDI4
+ASGNI4
+ADDRGP4 $170
+JUMPV
+LABELV $193
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 4
+EQI4 $196
+ADDRGP4 $170
+JUMPV
+LABELV $196
+ADDRFP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 1000
+ADDI4
+ASGNI4
+ADDRLP4 124
+ADDRLP4 12
+INDIRF4
+ADDRLP4 24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+CNSTF4 0
+LEF4 $205
+ADDRLP4 136
+CNSTF4 1065353216
+ADDRLP4 36
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 124
+INDIRF4
+ADDRLP4 136
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 124+4
+INDIRF4
+ADDRLP4 136
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 124+8
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRGP4 $211
+ARGP4
+ADDRLP4 140
+ADDRGP4 G_SoundIndex
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 52
+ARGI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 644
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+LABELV $205
+LABELV $188
+LABELV $175
+LABELV $170
+endproc bambam_touch 144 28
+proc bambam_die 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 604
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 748
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+ADDRGP4 DirToByte
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 81
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 AI_RemoveBambam
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 114
+NEI4 $216
+ADDRLP4 20
+ADDRGP4 level+9504+4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $217
+JUMPV
+LABELV $216
+ADDRFP4 0
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 98
+NEI4 $220
+ADDRLP4 24
+ADDRGP4 level+9504+8
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $220
+LABELV $217
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $213
+endproc bambam_die 28 12
+proc bambam_think 12 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $225
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+GTI4 $225
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $247
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $247
+address $228
+address $231
+address $234
+address $240
+address $242
+address $245
+address $237
+code
+LABELV $228
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+ADDRGP4 $226
+JUMPV
+LABELV $231
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 20000
+ADDI4
+ASGNI4
+ADDRGP4 $226
+JUMPV
+LABELV $234
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+CNSTI4 6
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 3760
+ADDI4
+ASGNI4
+ADDRGP4 $226
+JUMPV
+LABELV $237
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 20000
+ADDI4
+ASGNI4
+ADDRGP4 $226
+JUMPV
+LABELV $240
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 1000
+ADDI4
+ASGNI4
+ADDRGP4 $226
+JUMPV
+LABELV $242
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $226
+JUMPV
+LABELV $245
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 20000
+ADDI4
+ASGNI4
+LABELV $225
+LABELV $226
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $248
+ADDRGP4 $250
+ARGP4
+ADDRLP4 8
+ADDRGP4 G_SoundIndex
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 52
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+LABELV $248
+LABELV $224
+endproc bambam_think 12 12
+proc bambam_pain 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1133903872
+DIVF4
+ASGNF4
+LABELV $251
+endproc bambam_pain 4 0
+lit
+align 4
+LABELV bambamMin
+byte 4 3249537024
+byte 4 3249537024
+byte 4 0
+align 4
+LABELV bambamMax
+byte 4 1102053376
+byte 4 1102053376
+byte 4 1108869120
+export bambam_createByPlayer
+code
+proc bambam_createByPlayer 164 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+CNSTI4 5
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+9504
+ADDP4
+INDIRI4
+GTI4 $253
+ADDRGP4 $256
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $252
+JUMPV
+LABELV $253
+ADDRLP4 108
+CNSTF4 0
+ASGNF4
+ADDRLP4 84+8
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 84+4
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 84
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 84+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 84
+ARGP4
+ADDRLP4 96
+ARGP4
+ADDRLP4 112
+CNSTP4 0
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 60+8
+ADDRLP4 60+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 120
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 72
+ADDRLP4 60
+INDIRF4
+ADDRLP4 120
+INDIRF4
+ADDRLP4 96
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72+4
+ADDRLP4 60+4
+INDIRF4
+ADDRLP4 120
+INDIRF4
+ADDRLP4 96+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72+8
+ADDRLP4 60+8
+INDIRF4
+CNSTF4 1115684864
+ADDRLP4 96+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 60
+ARGP4
+ADDRGP4 bambamMin
+ARGP4
+ADDRGP4 bambamMax
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 124
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 124
+INDIRI4
+NEI4 $270
+ADDRLP4 4+4
+INDIRI4
+ADDRLP4 124
+INDIRI4
+EQI4 $267
+LABELV $270
+ADDRGP4 $271
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $252
+JUMPV
+LABELV $267
+ADDRLP4 4
+ARGP4
+ADDRLP4 60
+ARGP4
+ADDRLP4 128
+CNSTP4 0
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 4+12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1065353216
+EQF4 $273
+ADDRGP4 $271
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $252
+JUMPV
+LABELV $273
+ADDRLP4 60
+ADDRLP4 4+12
+INDIRB
+ASGNB 12
+ADDRLP4 72
+ADDRLP4 4+12
+INDIRB
+ASGNB 12
+ADDRLP4 72+8
+ADDRLP4 72+8
+INDIRF4
+CNSTF4 1132462080
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 60
+ARGP4
+ADDRGP4 bambamMin
+ARGP4
+ADDRGP4 bambamMax
+ARGP4
+ADDRLP4 72
+ARGP4
+CNSTI4 1023
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 132
+INDIRI4
+NEI4 $286
+ADDRLP4 4+4
+INDIRI4
+ADDRLP4 132
+INDIRI4
+NEI4 $286
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $286
+ADDRLP4 4+52
+INDIRI4
+CNSTI4 1022
+EQI4 $279
+LABELV $286
+ADDRGP4 $271
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRLP4 136
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $252
+JUMPV
+LABELV $279
+ADDRLP4 4+12
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 IsBambamBoomieSpotClean
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+NEI4 $287
+CNSTI4 0
+RETI4
+ADDRGP4 $252
+JUMPV
+LABELV $287
+ADDRLP4 140
+ADDRGP4 G_Spawn
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 140
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRGP4 $290
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 16
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $291
+ADDRGP4 $293
+ARGP4
+ADDRLP4 144
+ADDRGP4 G_ModelIndex
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 668
+ADDP4
+ADDRGP4 $294
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $292
+JUMPV
+LABELV $291
+ADDRGP4 $295
+ARGP4
+ADDRLP4 144
+ADDRGP4 G_ModelIndex
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 668
+ADDP4
+ADDRGP4 $296
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $292
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+CNSTI4 128
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+12
+ARGP4
+ADDRGP4 G_SetOrigin
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ADDRGP4 bambamMin
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+ADDRGP4 bambamMax
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+CNSTI4 33554432
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+ADDRGP4 bambam_die
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 748
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+CNSTI4 300
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 600
+ADDP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1133903872
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+ADDRGP4 bambam_pain
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ADDRGP4 bambam_think
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 100
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+ADDRGP4 bambam_touch
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 1157234688
+ARGF4
+CNSTF4 1148846080
+ARGF4
+ADDRLP4 152
+ADDRGP4 createTrigger
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 604
+ADDP4
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+ADDRGP4 $299
+ARGP4
+ADDRLP4 156
+ADDRGP4 G_SoundIndex
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 52
+ARGI4
+ADDRLP4 156
+INDIRI4
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+9504
+ADDP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ADDRLP4 160
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 AI_AddBambam
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $252
+endproc bambam_createByPlayer 164 28
+proc boomies_die 32 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 604
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 748
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+ADDRGP4 DirToByte
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 82
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 AI_RemoveBoomie
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 114
+NEI4 $304
+ADDRLP4 20
+ADDRGP4 level+9520+4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $305
+JUMPV
+LABELV $304
+ADDRFP4 0
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 98
+NEI4 $308
+ADDRLP4 24
+ADDRGP4 level+9520+8
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $308
+LABELV $305
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 600
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 1128792064
+ARGF4
+CNSTF4 1132068864
+ARGF4
+CNSTP4 0
+ARGP4
+CNSTI4 27
+ARGI4
+ADDRGP4 G_RadiusDamage
+CALLI4
+pop
+LABELV $301
+endproc boomies_die 32 24
+proc boomies_touch 8 20
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $313
+ADDRGP4 $312
+JUMPV
+LABELV $313
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 IsItemSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $315
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 999
+ARGI4
+CNSTI4 22
+ARGI4
+ADDRGP4 boomies_die
+CALLV
+pop
+LABELV $315
+LABELV $312
+endproc boomies_touch 8 20
+export boomies_createByPlayer
+proc boomies_createByPlayer 148 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+CNSTI4 30
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+9520
+ADDP4
+INDIRI4
+GTI4 $318
+ADDRGP4 $256
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $317
+JUMPV
+LABELV $318
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 56+8
+ADDRLP4 56+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRLP4 96
+CNSTP4 0
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 100
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 80
+ADDRLP4 56
+INDIRF4
+ADDRLP4 100
+INDIRF4
+ADDRLP4 68
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80+4
+ADDRLP4 56+4
+INDIRF4
+ADDRLP4 100
+INDIRF4
+ADDRLP4 68+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80+8
+ADDRLP4 56+8
+INDIRF4
+CNSTF4 1115684864
+ADDRLP4 68+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 104
+CNSTP4 0
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 108
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 108
+INDIRI4
+NEI4 $331
+ADDRLP4 0+4
+INDIRI4
+ADDRLP4 108
+INDIRI4
+EQI4 $328
+LABELV $331
+ADDRGP4 $271
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $317
+JUMPV
+LABELV $328
+ADDRLP4 0+12
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 IsBambamBoomieSpotClean
+CALLI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 0
+NEI4 $332
+CNSTI4 0
+RETI4
+ADDRGP4 $317
+JUMPV
+LABELV $332
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $335
+ADDRLP4 0+52
+INDIRI4
+CNSTI4 1022
+NEI4 $335
+ADDRLP4 120
+ADDRGP4 G_Spawn
+CALLP4
+ASGNP4
+ADDRLP4 116
+ADDRLP4 120
+INDIRP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRGP4 $339
+ASGNP4
+ADDRLP4 116
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 17
+ASGNI4
+ADDRLP4 116
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $340
+ADDRGP4 $342
+ARGP4
+ADDRLP4 124
+ADDRGP4 G_ModelIndex
+CALLI4
+ASGNI4
+ADDRLP4 116
+INDIRP4
+CNSTI4 160
+ADDP4
+ADDRLP4 124
+INDIRI4
+ASGNI4
+ADDRLP4 116
+INDIRP4
+CNSTI4 668
+ADDP4
+ADDRGP4 $294
+ASGNP4
+ADDRGP4 $341
+JUMPV
+LABELV $340
+ADDRGP4 $343
+ARGP4
+ADDRLP4 124
+ADDRGP4 G_ModelIndex
+CALLI4
+ASGNI4
+ADDRLP4 116
+INDIRP4
+CNSTI4 160
+ADDP4
+ADDRLP4 124
+INDIRI4
+ASGNI4
+ADDRLP4 116
+INDIRP4
+CNSTI4 668
+ADDP4
+ADDRGP4 $296
+ASGNP4
+LABELV $341
+ADDRLP4 116
+INDIRP4
+CNSTI4 424
+ADDP4
+CNSTI4 128
+ASGNI4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 0+12
+ARGP4
+ADDRGP4 G_SetOrigin
+CALLV
+pop
+ADDRLP4 0+24
+ARGP4
+ADDRLP4 116
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 116
+INDIRP4
+CNSTI4 436
+ADDP4
+CNSTF4 3246391296
+ASGNF4
+ADDRLP4 116
+INDIRP4
+CNSTI4 440
+ADDP4
+CNSTF4 3246391296
+ASGNF4
+ADDRLP4 116
+INDIRP4
+CNSTI4 444
+ADDP4
+CNSTF4 3246391296
+ASGNF4
+ADDRLP4 116
+INDIRP4
+CNSTI4 448
+ADDP4
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 116
+INDIRP4
+CNSTI4 452
+ADDP4
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 116
+INDIRP4
+CNSTI4 456
+ADDP4
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 116
+INDIRP4
+CNSTI4 460
+ADDP4
+CNSTI4 67108864
+ASGNI4
+ADDRLP4 116
+INDIRP4
+CNSTI4 728
+ADDP4
+ADDRGP4 boomies_die
+ASGNP4
+ADDRLP4 116
+INDIRP4
+CNSTI4 748
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 116
+INDIRP4
+CNSTI4 744
+ADDP4
+CNSTI4 80
+ASGNI4
+ADDRLP4 116
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+ADDRLP4 116
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 116
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 116
+INDIRP4
+CNSTI4 716
+ADDP4
+ADDRGP4 boomies_touch
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 132
+CNSTF4 1125515264
+ASGNF4
+ADDRLP4 132
+INDIRF4
+ARGF4
+ADDRLP4 132
+INDIRF4
+ARGF4
+ADDRLP4 136
+ADDRGP4 createTrigger
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+CNSTI4 604
+ADDP4
+ADDRLP4 136
+INDIRP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+CNSTI4 600
+ADDP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+ADDRGP4 $347
+ARGP4
+ADDRLP4 140
+ADDRGP4 G_SoundIndex
+CALLI4
+ASGNI4
+ADDRLP4 116
+INDIRP4
+ARGP4
+CNSTI4 52
+ARGI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRLP4 144
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+9520
+ADDP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ADDRLP4 144
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRGP4 AI_AddBoomie
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $317
+JUMPV
+LABELV $335
+ADDRGP4 $271
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 116
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ARGI4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $317
+endproc boomies_createByPlayer 148 28
+import trap_AAS_BestReachableArea
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntities
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_RealTime
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_EntitiesInPVS
+import trap_RestoreClients
+import trap_RewindClients
+import trap_GetUsercmds
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_TraceBatch
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import g_logDamage
+import g_modInstagib_WeaponJump
+import g_modInstagib
+import g_transmitSVboastermissiles
+import g_KillerduckHealth
+import g_LPS_flags
+import g_LPS_startlives
+import g_skyLensflare
+import g_sky
+import g_q3Items
+import pmove_msec
+import pmove_fixed
+import g_antilag
+import g_smoothClients
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_curWarmupReady
+import g_warmupReady
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import MapSupportsGametype
+import G_GetArenaInfoByMap
+import G_InitGameinfo
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import AI_RemoveBambam
+import AI_AddBambam
+import AI_RemoveBoomie
+import AI_AddBoomie
+import BotCamViewangles
+import BotCamViewTarget
+import BotCamViewEntitiy
+import BotChooseWeap
+import BotCamFire
+import BotCamTaunt
+import BotCamMoveTo
+import BotCamMode
+import BotInterbreedEndMatch
+import Svcmd_BotStats_f
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_LoadBots
+import Instagib_canSpawnEntity
+import Instagib_isRelevantDamageEvent
+import Instagib_calculateDamage
+import Instagib_getSpawnWeapon
+import Instagib_applyWeaponJumpKnockback
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import PrintMsg
+import CheckObeliskAttack
+import Team_GetFlagStatus
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThinkBatch
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogFlush
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import G_GetCvarInt
+import MoveClientToIntermission
+import G_SendScoreboardUpdates
+import DeathmatchScoreboardMessage
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import GetASpawnPosition
+import SelectSpectatorSpawnPoint
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import respawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import Touch_DoorTrigger
+import G_PushablesChanged
+import G_RunMover
+import fire_kma
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_bubbleg
+import fire_bambamMissile
+import fire_duck
+import explode_imperius
+import fire_splasher
+import fire_nipper
+import fire_boaster
+import G_RunExplosion
+import G_RunMissile
+import BerserkerCheck
+import TossClientCubes
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import GametypeNameShort
+import GametypeName
+import RemoveOwnedItems
+import SetAward
+import G_RestorePowerups
+import G_BackupPowerups
+import DeleteDebugLines
+import DebugLineDouble
+import DebugLine
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_NextActiveEntity
+import G_InitEntityLists
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_FindAll
+import G_Find
+import G_EntityIndexChanged
+import G_InitEntityIndex
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import G_Say
+import ConcatArgs
+import Cmd_DropCartridge_f
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $347
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $343
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $342
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $339
+byte 1 66
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $299
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $296
+byte 1 114
+byte 1 0
+align 1
+LABELV $295
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $294
+byte 1 98
+byte 1 0
+align 1
+LABELV $293
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $290
+byte 1 66
+byte 1 97
+byte 1 109
+byte 1 66
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $271
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 105
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 34
+byte 1 0
+align 1
+LABELV $256
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $250
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 47
+byte 1 122
+byte 1 122
+byte 1 122
+byte 1 0
+align 1
+LABELV $211
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $169
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 84
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 34
+byte 1 0
+align 1
+LABELV $160
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 122
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $157
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 84
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 34
+byte 1 0
+align 1
+LABELV $153
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $152
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $149
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 84
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 34
+byte 1 0
+align 1
+LABELV $145
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $144
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $139
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $136
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 84
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 34
+byte 1 0
+align 1
+LABELV $125
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 84
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 34
+byte 1 0
+align 1
+LABELV $119
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 84
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 34
+byte 1 0
+align 1
+LABELV $114
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 84
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 34
+byte 1 0
+align 1
+LABELV $109
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 84
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 66
+byte 1 79
+byte 1 79
+byte 1 77
+byte 1 105
+byte 1 69
+byte 1 34
+byte 1 0
+align 1
+LABELV $65
+byte 1 67
+byte 1 84
+byte 1 76
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 84
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 0
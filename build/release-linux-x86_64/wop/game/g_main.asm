@@ -0,0 +1,11962 @@
+data
+align 4
+LABELV gameCvarTable
+address g_cheats
+address $62
+address $63
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+address $64
+address $65
+byte 4 68
+byte 4 0
+byte 4 0
+byte 4 0
+address $66
+address $67
+byte 4 64
+byte 4 0
+byte 4 0
+address g_restarted
+address $68
+address $69
+byte 4 64
+byte 4 0
+byte 4 0
+byte 4 0
+address $70
+address $63
+byte 4 68
+byte 4 0
+byte 4 0
+address g_gametype
+address $71
+address $69
+byte 4 38
+byte 4 0
+byte 4 0
+address g_maxclients
+address $72
+address $73
+byte 4 37
+byte 4 0
+byte 4 0
+address g_maxGameClients
+address $74
+address $69
+byte 4 37
+byte 4 0
+byte 4 0
+address g_dmflags
+address $75
+address $69
+byte 4 5
+byte 4 0
+byte 4 1
+address g_fraglimit
+address $76
+address $69
+byte 4 1029
+byte 4 0
+byte 4 1
+address g_timelimit
+address $77
+address $78
+byte 4 1029
+byte 4 0
+byte 4 1
+address g_capturelimit
+address $76
+address $69
+byte 4 1029
+byte 4 0
+byte 4 0
+address g_synchronousClients
+address $79
+address $69
+byte 4 8
+byte 4 0
+byte 4 0
+address g_friendlyFire
+address $80
+address $69
+byte 4 1
+byte 4 0
+byte 4 1
+address g_teamAutoJoin
+address $81
+address $69
+byte 4 1
+byte 4 0
+byte 4 0
+address g_teamForceBalance
+address $82
+address $83
+byte 4 1
+byte 4 0
+byte 4 0
+address g_warmup
+address $84
+address $85
+byte 4 5
+byte 4 0
+byte 4 1
+address g_doWarmup
+address $86
+address $69
+byte 4 5
+byte 4 0
+byte 4 1
+address g_warmupReady
+address $87
+address $88
+byte 4 41
+byte 4 0
+byte 4 1
+address g_curWarmupReady
+address $89
+address $88
+byte 4 72
+byte 4 0
+byte 4 0
+address g_log
+address $90
+address $91
+byte 4 1
+byte 4 0
+byte 4 0
+address g_logSync
+address $92
+address $69
+byte 4 1
+byte 4 0
+byte 4 0
+address g_password
+address $93
+address $63
+byte 4 2
+byte 4 0
+byte 4 0
+address g_banIPs
+address $94
+address $63
+byte 4 1
+byte 4 0
+byte 4 0
+address g_filterBan
+address $95
+address $83
+byte 4 1
+byte 4 0
+byte 4 0
+address g_needpass
+address $96
+address $69
+byte 4 68
+byte 4 0
+byte 4 0
+address g_dedicated
+address $97
+address $69
+byte 4 0
+byte 4 0
+byte 4 0
+address g_speed
+address $98
+address $99
+byte 4 0
+byte 4 0
+byte 4 1
+address g_gravity
+address $100
+address $101
+byte 4 0
+byte 4 0
+byte 4 1
+address g_knockback
+address $102
+address $103
+byte 4 0
+byte 4 0
+byte 4 1
+address g_quadfactor
+address $104
+address $105
+byte 4 0
+byte 4 0
+byte 4 1
+address g_weaponRespawn
+address $106
+address $107
+byte 4 0
+byte 4 0
+byte 4 1
+address g_weaponTeamRespawn
+address $108
+address $107
+byte 4 0
+byte 4 0
+byte 4 1
+address g_forcerespawn
+address $109
+address $85
+byte 4 0
+byte 4 0
+byte 4 1
+address g_inactivity
+address $110
+address $111
+byte 4 0
+byte 4 0
+byte 4 1
+address g_debugMove
+address $112
+address $69
+byte 4 0
+byte 4 0
+byte 4 0
+address g_debugDamage
+address $113
+address $69
+byte 4 0
+byte 4 0
+byte 4 0
+address g_debugAlloc
+address $114
+address $69
+byte 4 0
+byte 4 0
+byte 4 0
+address g_motd
+address $115
+address $63
+byte 4 0
+byte 4 0
+byte 4 0
+address g_podiumDist
+address $116
+address $117
+byte 4 0
+byte 4 0
+byte 4 0
+address g_podiumDrop
+address $118
+address $119
+byte 4 0
+byte 4 0
+byte 4 0
+address g_allowVote
+address $120
+address $83
+byte 4 5
+byte 4 0
+byte 4 0
+address g_listEntity
+address $121
+address $69
+byte 4 0
+byte 4 0
+byte 4 0
+address g_smoothClients
+address $122
+address $83
+byte 4 0
+byte 4 0
+byte 4 0
+address g_antilag
+address $123
+address $83
+byte 4 5
+byte 4 0
+byte 4 1
+address pmove_fixed
+address $124
+address $69
+byte 4 8
+byte 4 0
+byte 4 0
+address pmove_msec
+address $125
+address $126
+byte 4 8
+byte 4 0
+byte 4 0
+address g_KillerduckHealth
+address $127
+address $128
+byte 4 1
+byte 4 0
+byte 4 0
+address g_q3Items
+address $129
+address $69
+byte 4 33
+byte 4 0
+byte 4 0
+address g_sky
+address $130
+address $63
+byte 4 72
+byte 4 0
+byte 4 0
+address g_skyLensflare
+address $131
+address $63
+byte 4 72
+byte 4 0
+byte 4 0
+address g_LPS_startlives
+address $132
+address $78
+byte 4 37
+byte 4 0
+byte 4 0
+address g_LPS_flags
+address $133
+address $69
+byte 4 37
+byte 4 0
+byte 4 0
+address nextmapBackUp
+address $134
+address $63
+byte 4 0
+byte 4 0
+byte 4 0
+address g_transmitSVboastermissiles
+address $135
+address $69
+byte 4 0
+byte 4 0
+byte 4 1
+address g_suddenDeath
+address $136
+address $83
+byte 4 1
+byte 4 0
+byte 4 0
+address g_modInstagib
+address $137
+address $69
+byte 4 37
+byte 4 0
+byte 4 1
+address g_modInstagib_WeaponJump
+address $138
+address $83
+byte 4 1
+byte 4 0
+byte 4 1
+byte 4 0
+address $139
+address $140
+byte 4 68
+byte 4 0
+byte 4 0
+byte 4 0
+address $141
+address $140
+byte 4 68
+byte 4 0
+byte 4 0
+address g_logDamage
+address $142
+address $69
+byte 4 1
+byte 4 0
+byte 4 0
+lit
+align 4
+LABELV gameCvarTableSize
+byte 4 61
+export vmMain
+code
+proc vmMain 16 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $144
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+GTI4 $144
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $158
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $158
+address $146
+address $147
+address $148
+address $152
+address $150
+address $151
+address $153
+address $149
+address $154
+address $155
+address $156
+address $157
+code
+LABELV $146
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 G_InitGame
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $143
+JUMPV
+LABELV $147
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 G_ShutdownGame
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $143
+JUMPV
+LABELV $148
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 ClientConnect
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CVUI4 4
+RETI4
+ADDRGP4 $143
+JUMPV
+LABELV $149
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 ClientThink
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $143
+JUMPV
+LABELV $150
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $143
+JUMPV
+LABELV $151
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 ClientDisconnect
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $143
+JUMPV
+LABELV $152
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 ClientBegin
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $143
+JUMPV
+LABELV $153
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 ClientCommand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $143
+JUMPV
+LABELV $154
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 G_RunFrame
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $143
+JUMPV
+LABELV $155
+ADDRLP4 8
+ADDRGP4 ConsoleCommand
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $143
+JUMPV
+LABELV $156
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 BotAIStartFrame
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $143
+JUMPV
+LABELV $157
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 ClientThinkBatch
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $143
+JUMPV
+LABELV $144
+CNSTI4 -1
+RETI4
+LABELV $143
+endproc vmMain 16 12
+export G_GetCvarInt
+proc G_GetCvarInt 36 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+RETI4
+LABELV $159
+endproc G_GetCvarInt 36 12
+export G_Printf
+proc G_Printf 1028 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $160
+endproc G_Printf 1028 16
+export G_Error
+proc G_Error 1028 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $162
+endproc G_Error 1028 16
+proc G_FindTeams 56 12
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+CNSTI4 832
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRGP4 $168
+JUMPV
+LABELV $165
+ADDRLP4 4
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $170
+ADDRGP4 $166
+JUMPV
+LABELV $170
+ADDRLP4 4
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $172
+ADDRGP4 $166
+JUMPV
+LABELV $172
+ADDRLP4 4
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $174
+ADDRGP4 $166
+JUMPV
+LABELV $174
+ADDRLP4 4
+INDIRP4
+CNSTI4 792
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 832
+ADDP4
+ASGNP4
+ADDRGP4 $179
+JUMPV
+LABELV $176
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $181
+ADDRGP4 $177
+JUMPV
+LABELV $181
+ADDRLP4 0
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $183
+ADDRGP4 $177
+JUMPV
+LABELV $183
+ADDRLP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $185
+ADDRGP4 $177
+JUMPV
+LABELV $185
+ADDRLP4 36
+CNSTI4 668
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $187
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 788
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 788
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 792
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 1024
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 664
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $189
+ADDRLP4 52
+CNSTI4 664
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 664
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_EntityIndexChanged
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_EntityIndexChanged
+CALLV
+pop
+LABELV $189
+LABELV $187
+LABELV $177
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 832
+ADDP4
+ASGNP4
+LABELV $179
+ADDRLP4 8
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $176
+LABELV $166
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 832
+ADDP4
+ASGNP4
+LABELV $168
+ADDRLP4 16
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $165
+ADDRGP4 $191
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $164
+endproc G_FindTeams 56 12
+proc G_RegisterCvars 16 16
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 gameCvarTable
+ASGNP4
+ADDRGP4 $196
+JUMPV
+LABELV $193
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $197
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $197
+LABELV $194
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+LABELV $196
+ADDRLP4 4
+INDIRI4
+ADDRGP4 gameCvarTableSize
+INDIRI4
+LTI4 $193
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 0
+LTI4 $203
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+LTI4 $199
+LABELV $203
+ADDRGP4 $204
+ARGP4
+ADDRGP4 g_gametype+12
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $71
+ARGP4
+ADDRGP4 $69
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $199
+ADDRGP4 level+392
+ADDRGP4 g_warmup+4
+INDIRI4
+ASGNI4
+LABELV $192
+endproc G_RegisterCvars 16 16
+bss
+align 4
+LABELV $209
+skip 4
+export G_UpdateCvars
+code
+proc G_UpdateCvars 36 12
+ADDRLP4 12
+ADDRGP4 trap_Cvar_Generation
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 $209
+INDIRI4
+NEI4 $210
+ADDRGP4 $208
+JUMPV
+LABELV $210
+ADDRGP4 $209
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 gameCvarTable
+ASGNP4
+ADDRGP4 $215
+JUMPV
+LABELV $212
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $216
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+EQI4 $218
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $220
+ADDRGP4 $222
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $223
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+LABELV $220
+LABELV $218
+LABELV $216
+LABELV $213
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+LABELV $215
+ADDRLP4 4
+INDIRI4
+ADDRGP4 gameCvarTableSize
+INDIRI4
+LTI4 $212
+LABELV $208
+endproc G_UpdateCvars 36 12
+proc G_InitGame 1068 28
+ADDRGP4 $225
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $226
+ARGP4
+ADDRGP4 $65
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 srand
+CALLV
+pop
+ADDRGP4 G_RegisterCvars
+CALLV
+pop
+ADDRGP4 G_ProcessIPBans
+CALLV
+pop
+ADDRGP4 G_InitMemory
+CALLV
+pop
+ADDRGP4 level
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 9536
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 level+68
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 level+76
+ADDRFP4 0
+INDIRI4
+ASGNI4
+CNSTI4 8
+ARGI4
+ADDRGP4 $63
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+CNSTI4 9
+ARGI4
+ADDRGP4 $63
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $230
+ARGP4
+ADDRLP4 4
+ADDRGP4 G_SoundIndex
+CALLI4
+ASGNI4
+ADDRGP4 level+388
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 logBufferUsed
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 2
+EQI4 $231
+ADDRGP4 g_log+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $231
+ADDRGP4 g_logSync+12
+INDIRI4
+CNSTI4 0
+EQI4 $235
+ADDRGP4 g_log+16
+ARGP4
+ADDRGP4 level+56
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+ADDRGP4 $236
+JUMPV
+LABELV $235
+ADDRGP4 g_log+16
+ARGP4
+ADDRGP4 level+56
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+LABELV $236
+ADDRGP4 level+56
+INDIRI4
+CNSTI4 0
+NEI4 $242
+ADDRGP4 $245
+ARGP4
+ADDRGP4 g_log+16
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $232
+JUMPV
+LABELV $242
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_RealTime
+CALLI4
+pop
+ADDRLP4 44
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetServerinfo
+CALLV
+pop
+ADDRGP4 $247
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 $248
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 $249
+ARGP4
+ADDRLP4 8+8
+INDIRI4
+ARGI4
+ADDRLP4 8+4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8+12
+INDIRI4
+ARGI4
+ADDRLP4 8+16
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 8+20
+INDIRI4
+CNSTI4 1900
+ADDI4
+ARGI4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 $232
+JUMPV
+LABELV $231
+ADDRGP4 $255
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $232
+ADDRGP4 G_InitWorldSession
+CALLV
+pop
+ADDRGP4 g_entities
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 851968
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 G_InitEntityIndex
+CALLV
+pop
+ADDRGP4 G_InitEntityLists
+CALLV
+pop
+ADDRGP4 level+4
+ADDRGP4 g_entities
+ASGNP4
+ADDRGP4 level+60
+ADDRGP4 g_maxclients+12
+INDIRI4
+ASGNI4
+ADDRGP4 g_clients
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 61184
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 level
+ADDRGP4 g_clients
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $262
+JUMPV
+LABELV $259
+CNSTI4 832
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $260
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $262
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $259
+ADDRGP4 level+12
+CNSTI4 64
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $266
+CNSTI4 832
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+524
+ADDP4
+ADDRGP4 $271
+ASGNP4
+CNSTI4 832
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRGP4 G_EntityIndexChanged
+CALLV
+pop
+LABELV $267
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $266
+ADDRGP4 level+4
+INDIRP4
+ARGP4
+ADDRGP4 level+12
+INDIRI4
+ARGI4
+CNSTI4 832
+ARGI4
+ADDRGP4 level
+INDIRP4
+ARGP4
+CNSTI4 956
+ARGI4
+ADDRGP4 trap_LocateGameData
+CALLV
+pop
+ADDRGP4 InitBodyQue
+CALLV
+pop
+ADDRGP4 ClearRegisteredItems
+CALLV
+pop
+ADDRGP4 G_SpawnEntitiesFromString
+CALLV
+pop
+ADDRGP4 G_FindTeams
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+LTI4 $274
+ADDRGP4 G_CheckTeamItems
+CALLV
+pop
+LABELV $274
+ADDRGP4 SaveRegisteredItems
+CALLV
+pop
+ADDRGP4 $277
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $280
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $278
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 BotAISetup
+CALLI4
+pop
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 BotAILoadMap
+CALLI4
+pop
+ADDRGP4 G_LoadBots
+CALLV
+pop
+LABELV $278
+ADDRGP4 nextmapBackUp+16
+ARGP4
+ADDRLP4 12
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 12
+INDIRU4
+CNSTU4 0
+EQU4 $281
+ADDRGP4 $284
+ARGP4
+ADDRGP4 nextmapBackUp+16
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $134
+ARGP4
+ADDRGP4 $63
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $281
+ADDRGP4 G_InitGameinfo
+CALLV
+pop
+LABELV $224
+endproc G_InitGame 1068 28
+proc G_ShutdownGame 264 12
+ADDRGP4 $284
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $289
+ARGP4
+ADDRLP4 256
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 256
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $287
+ADDRGP4 $134
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $288
+JUMPV
+LABELV $287
+ADDRGP4 $134
+ARGP4
+ADDRGP4 $63
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $288
+ADDRGP4 $290
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 level+56
+INDIRI4
+CNSTI4 0
+EQI4 $291
+ADDRGP4 $294
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 $247
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 G_LogFlush
+CALLV
+pop
+ADDRGP4 level+56
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 level+56
+CNSTI4 0
+ASGNI4
+LABELV $291
+ADDRGP4 G_WriteSessionData
+CALLV
+pop
+ADDRGP4 $280
+ARGP4
+ADDRLP4 260
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+EQI4 $297
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotAIShutdown
+CALLI4
+pop
+LABELV $297
+LABELV $286
+endproc G_ShutdownGame 264 12
+export Com_Error
+proc Com_Error 1028 16
+ADDRLP4 0
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $299
+endproc Com_Error 1028 16
+export Com_Printf
+proc Com_Printf 1028 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $301
+endproc Com_Printf 1028 16
+proc AddTournamentPlayer 24 8
+ADDRGP4 level+120
+INDIRI4
+CNSTI4 2
+LTI4 $304
+ADDRGP4 $303
+JUMPV
+LABELV $304
+ADDRGP4 level+9168
+INDIRI4
+CNSTI4 0
+EQI4 $307
+ADDRGP4 $303
+JUMPV
+LABELV $307
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $313
+JUMPV
+LABELV $310
+ADDRLP4 0
+CNSTI4 956
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $315
+ADDRGP4 $311
+JUMPV
+LABELV $315
+ADDRLP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $317
+ADDRGP4 $311
+JUMPV
+LABELV $317
+ADDRLP4 0
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $321
+ADDRLP4 0
+INDIRP4
+CNSTI4 640
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $319
+LABELV $321
+ADDRGP4 $311
+JUMPV
+LABELV $319
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $324
+ADDRLP4 20
+CNSTI4 632
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+LEI4 $322
+LABELV $324
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $322
+LABELV $311
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $313
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $310
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $325
+ADDRGP4 $303
+JUMPV
+LABELV $325
+ADDRGP4 level+16
+CNSTI4 -1
+ASGNI4
+CNSTI4 832
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRGP4 level
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 956
+DIVI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRGP4 SetTeam
+CALLV
+pop
+LABELV $303
+endproc AddTournamentPlayer 24 8
+export AddTournamentQueue
+proc AddTournamentQueue 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $333
+JUMPV
+LABELV $330
+ADDRLP4 0
+CNSTI4 956
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $335
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+NEU4 $337
+ADDRLP4 0
+INDIRP4
+CNSTI4 632
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $338
+JUMPV
+LABELV $337
+ADDRLP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $339
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 632
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $339
+LABELV $338
+LABELV $335
+LABELV $331
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $333
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $330
+LABELV $329
+endproc AddTournamentQueue 12 0
+proc RemoveTournamentLoser 4 8
+ADDRGP4 level+120
+INDIRI4
+CNSTI4 2
+EQI4 $342
+ADDRGP4 $341
+JUMPV
+LABELV $342
+ADDRLP4 0
+ADDRGP4 level+124+4
+INDIRI4
+ASGNI4
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $347
+ADDRGP4 $341
+JUMPV
+LABELV $347
+CNSTI4 832
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRGP4 $349
+ARGP4
+ADDRGP4 SetTeam
+CALLV
+pop
+LABELV $341
+endproc RemoveTournamentLoser 4 8
+proc AdjustTournamentScores 8 4
+ADDRLP4 0
+ADDRGP4 level+124
+INDIRI4
+ASGNI4
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $352
+ADDRLP4 4
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 644
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+LABELV $352
+ADDRLP4 0
+ADDRGP4 level+124+4
+INDIRI4
+ASGNI4
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $356
+ADDRLP4 4
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 648
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+LABELV $356
+LABELV $350
+endproc AdjustTournamentScores 8 4
+proc SortRanks 56 0
+ADDRLP4 8
+CNSTI4 956
+ASGNI4
+ADDRLP4 12
+ADDRGP4 level
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $361
+ADDRLP4 0
+INDIRP4
+CNSTI4 640
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $359
+LABELV $361
+CNSTI4 1
+RETI4
+ADDRGP4 $358
+JUMPV
+LABELV $359
+ADDRLP4 4
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $364
+ADDRLP4 4
+INDIRP4
+CNSTI4 640
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $362
+LABELV $364
+CNSTI4 -1
+RETI4
+ADDRGP4 $358
+JUMPV
+LABELV $362
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $365
+CNSTI4 1
+RETI4
+ADDRGP4 $358
+JUMPV
+LABELV $365
+ADDRLP4 4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $367
+CNSTI4 -1
+RETI4
+ADDRGP4 $358
+JUMPV
+LABELV $367
+ADDRLP4 24
+CNSTI4 628
+ASGNI4
+ADDRLP4 28
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $369
+ADDRLP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $369
+ADDRLP4 32
+CNSTI4 632
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+LEI4 $371
+CNSTI4 -1
+RETI4
+ADDRGP4 $358
+JUMPV
+LABELV $371
+ADDRLP4 36
+CNSTI4 632
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+GEI4 $373
+CNSTI4 1
+RETI4
+ADDRGP4 $358
+JUMPV
+LABELV $373
+CNSTI4 0
+RETI4
+ADDRGP4 $358
+JUMPV
+LABELV $369
+ADDRLP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $375
+CNSTI4 1
+RETI4
+ADDRGP4 $358
+JUMPV
+LABELV $375
+ADDRLP4 4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $377
+CNSTI4 -1
+RETI4
+ADDRGP4 $358
+JUMPV
+LABELV $377
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $379
+ADDRGP4 g_LPS_flags+12
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $379
+ADDRGP4 $383
+JUMPV
+LABELV $379
+ADDRLP4 32
+CNSTI4 248
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+LEI4 $384
+CNSTI4 -1
+RETI4
+ADDRGP4 $358
+JUMPV
+LABELV $384
+ADDRLP4 36
+CNSTI4 248
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+GEI4 $386
+CNSTI4 1
+RETI4
+ADDRGP4 $358
+JUMPV
+LABELV $386
+LABELV $383
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $388
+ADDRLP4 40
+CNSTI4 656
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+LEI4 $391
+CNSTI4 -1
+RETI4
+ADDRGP4 $358
+JUMPV
+LABELV $391
+ADDRLP4 44
+CNSTI4 656
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+GEI4 $393
+CNSTI4 1
+RETI4
+ADDRGP4 $358
+JUMPV
+LABELV $393
+ADDRLP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $395
+ADDRLP4 48
+CNSTI4 820
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRI4
+LEI4 $397
+CNSTI4 -1
+RETI4
+ADDRGP4 $358
+JUMPV
+LABELV $397
+ADDRLP4 52
+CNSTI4 820
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+GEI4 $399
+CNSTI4 1
+RETI4
+ADDRGP4 $358
+JUMPV
+LABELV $399
+LABELV $395
+LABELV $388
+CNSTI4 0
+RETI4
+LABELV $358
+endproc SortRanks 56 0
+proc SortRanksLPS 48 0
+ADDRLP4 8
+CNSTI4 956
+ASGNI4
+ADDRLP4 12
+ADDRGP4 level
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $404
+ADDRLP4 0
+INDIRP4
+CNSTI4 640
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $402
+LABELV $404
+CNSTI4 1
+RETI4
+ADDRGP4 $401
+JUMPV
+LABELV $402
+ADDRLP4 4
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $407
+ADDRLP4 4
+INDIRP4
+CNSTI4 640
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $405
+LABELV $407
+CNSTI4 -1
+RETI4
+ADDRGP4 $401
+JUMPV
+LABELV $405
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $408
+CNSTI4 1
+RETI4
+ADDRGP4 $401
+JUMPV
+LABELV $408
+ADDRLP4 4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $410
+CNSTI4 -1
+RETI4
+ADDRGP4 $401
+JUMPV
+LABELV $410
+ADDRLP4 24
+CNSTI4 628
+ASGNI4
+ADDRLP4 28
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $412
+ADDRLP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $412
+ADDRLP4 32
+CNSTI4 632
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+GEI4 $414
+CNSTI4 -1
+RETI4
+ADDRGP4 $401
+JUMPV
+LABELV $414
+ADDRLP4 36
+CNSTI4 632
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+LEI4 $416
+CNSTI4 1
+RETI4
+ADDRGP4 $401
+JUMPV
+LABELV $416
+CNSTI4 0
+RETI4
+ADDRGP4 $401
+JUMPV
+LABELV $412
+ADDRLP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $418
+CNSTI4 1
+RETI4
+ADDRGP4 $401
+JUMPV
+LABELV $418
+ADDRLP4 4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $420
+CNSTI4 -1
+RETI4
+ADDRGP4 $401
+JUMPV
+LABELV $420
+ADDRLP4 32
+CNSTI4 656
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+LEI4 $422
+CNSTI4 -1
+RETI4
+ADDRGP4 $401
+JUMPV
+LABELV $422
+ADDRLP4 36
+CNSTI4 656
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+GEI4 $424
+CNSTI4 1
+RETI4
+ADDRGP4 $401
+JUMPV
+LABELV $424
+ADDRLP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $426
+ADDRLP4 40
+CNSTI4 820
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+LEI4 $428
+CNSTI4 -1
+RETI4
+ADDRGP4 $401
+JUMPV
+LABELV $428
+ADDRLP4 44
+CNSTI4 820
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+GEI4 $430
+CNSTI4 1
+RETI4
+ADDRGP4 $401
+JUMPV
+LABELV $430
+LABELV $426
+CNSTI4 0
+RETI4
+LABELV $401
+endproc SortRanksLPS 48 0
+export CalculateRanks
+proc CalculateRanks 576 16
+ADDRGP4 level+380
+CNSTI4 -1
+ASGNI4
+ADDRGP4 level+384
+CNSTI4 -1
+ASGNI4
+ADDRGP4 level+112
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+116
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+120
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+2460
+CNSTI4 0
+ASGNI4
+ADDRLP4 532
+CNSTI1 0
+ASGNI1
+ADDRLP4 12
+ADDRLP4 532
+INDIRI1
+ASGNI1
+ADDRLP4 268
+ADDRLP4 532
+INDIRI1
+ASGNI1
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $442
+JUMPV
+LABELV $439
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4536
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $440
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $442
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 2
+LTU4 $439
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $449
+JUMPV
+LABELV $446
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $451
+ADDRLP4 536
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 628
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 level+112
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+124
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 540
+ADDRGP4 level+112
+ASGNP4
+ADDRLP4 540
+INDIRP4
+ADDRLP4 540
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $456
+ARGP4
+CNSTI4 832
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $460
+ADDRLP4 544
+CNSTI4 1
+ASGNI4
+ADDRGP4 $461
+JUMPV
+LABELV $460
+ADDRLP4 544
+CNSTI4 0
+ASGNI4
+LABELV $461
+ADDRLP4 544
+INDIRI4
+ARGI4
+ADDRLP4 548
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 268
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 548
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRGP4 $456
+ARGP4
+ADDRLP4 536
+INDIRI4
+ARGI4
+ADDRLP4 552
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 552
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 536
+INDIRI4
+CNSTI4 3
+EQI4 $462
+ADDRLP4 556
+ADDRGP4 level+116
+ASGNP4
+ADDRLP4 556
+INDIRP4
+ADDRLP4 556
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $465
+ADDRLP4 560
+ADDRGP4 level+120
+ASGNP4
+ADDRLP4 560
+INDIRP4
+ADDRLP4 560
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTI4 832
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $468
+ADDRLP4 564
+ADDRGP4 level+2460
+ASGNP4
+ADDRLP4 564
+INDIRP4
+ADDRLP4 564
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 536
+INDIRI4
+CNSTI4 1
+NEI4 $473
+ADDRLP4 568
+ADDRGP4 level+4536
+ASGNP4
+ADDRLP4 568
+INDIRP4
+ADDRLP4 568
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $474
+JUMPV
+LABELV $473
+ADDRLP4 536
+INDIRI4
+CNSTI4 2
+NEI4 $476
+ADDRLP4 572
+ADDRGP4 level+4536+4
+ASGNP4
+ADDRLP4 572
+INDIRP4
+ADDRLP4 572
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $476
+LABELV $474
+LABELV $468
+ADDRGP4 level+380
+INDIRI4
+CNSTI4 -1
+NEI4 $480
+ADDRGP4 level+380
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $481
+JUMPV
+LABELV $480
+ADDRGP4 level+384
+INDIRI4
+CNSTI4 -1
+NEI4 $484
+ADDRGP4 level+384
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $484
+LABELV $481
+LABELV $465
+LABELV $462
+LABELV $451
+LABELV $447
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $449
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $446
+ADDRLP4 12
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $488
+ADDRLP4 12
+ARGP4
+ADDRGP4 $140
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $488
+ADDRLP4 268
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $490
+ADDRLP4 268
+ARGP4
+ADDRGP4 $140
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $490
+ADDRGP4 $139
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $141
+ARGP4
+ADDRLP4 268
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 level+124
+ARGP4
+ADDRGP4 level+112
+INDIRI4
+CVIU4 4
+ARGU4
+CNSTU4 4
+ARGU4
+ADDRGP4 SortRanks
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+LTI4 $495
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $501
+JUMPV
+LABELV $498
+ADDRLP4 4
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+124
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRGP4 level+80+4
+INDIRI4
+ADDRGP4 level+80+8
+INDIRI4
+NEI4 $504
+ADDRLP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $505
+JUMPV
+LABELV $504
+ADDRGP4 level+80+4
+INDIRI4
+ADDRGP4 level+80+8
+INDIRI4
+LEI4 $510
+ADDRLP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $511
+JUMPV
+LABELV $510
+ADDRLP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $511
+LABELV $505
+LABELV $499
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $501
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+112
+INDIRI4
+LTI4 $498
+ADDRGP4 $496
+JUMPV
+LABELV $495
+ADDRLP4 524
+CNSTI4 -1
+ASGNI4
+ADDRLP4 536
+CNSTI4 0
+ASGNI4
+ADDRLP4 528
+ADDRLP4 536
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 536
+INDIRI4
+ASGNI4
+ADDRGP4 $519
+JUMPV
+LABELV $516
+ADDRLP4 4
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+124
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $522
+ADDRGP4 g_LPS_flags+12
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $522
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $522
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $528
+ADDRLP4 8
+INDIRI4
+ADDRLP4 528
+INDIRI4
+EQI4 $526
+LABELV $528
+ADDRLP4 524
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+124
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 260
+ADDP4
+ADDRLP4 524
+INDIRI4
+ASGNI4
+ADDRGP4 $527
+JUMPV
+LABELV $526
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+124-4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 260
+ADDP4
+ADDRLP4 524
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+124
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 260
+ADDP4
+ADDRLP4 524
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $527
+ADDRLP4 528
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 2
+NEI4 $533
+ADDRGP4 level+120
+INDIRI4
+CNSTI4 1
+NEI4 $533
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+124
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 260
+ADDP4
+ADDRLP4 524
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $533
+LABELV $517
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $519
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+120
+INDIRI4
+LTI4 $516
+LABELV $496
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+LTI4 $538
+ADDRGP4 $541
+ARGP4
+ADDRGP4 level+80+4
+INDIRI4
+ARGI4
+ADDRLP4 536
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 6
+ARGI4
+ADDRLP4 536
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $541
+ARGP4
+ADDRGP4 level+80+8
+INDIRI4
+ARGI4
+ADDRLP4 540
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 7
+ARGI4
+ADDRLP4 540
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $539
+JUMPV
+LABELV $538
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $546
+ADDRGP4 g_LPS_flags+12
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $546
+ADDRGP4 level+112
+INDIRI4
+CNSTI4 0
+NEI4 $550
+ADDRGP4 $541
+ARGP4
+CNSTI4 -9999
+ARGI4
+ADDRLP4 536
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 6
+ARGI4
+ADDRLP4 536
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $541
+ARGP4
+CNSTI4 -9999
+ARGI4
+ADDRLP4 540
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 7
+ARGI4
+ADDRLP4 540
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $547
+JUMPV
+LABELV $550
+ADDRGP4 level+112
+INDIRI4
+CNSTI4 1
+NEI4 $553
+ADDRGP4 $541
+ARGP4
+CNSTI4 956
+ADDRGP4 level+124
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $559
+ADDRLP4 536
+CNSTI4 0
+ASGNI4
+ADDRGP4 $560
+JUMPV
+LABELV $559
+ADDRLP4 536
+CNSTI4 956
+ADDRGP4 level+124
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $560
+ADDRLP4 536
+INDIRI4
+ARGI4
+ADDRLP4 540
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 6
+ARGI4
+ADDRLP4 540
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $541
+ARGP4
+CNSTI4 -9999
+ARGI4
+ADDRLP4 544
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 7
+ARGI4
+ADDRLP4 544
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $547
+JUMPV
+LABELV $553
+ADDRGP4 $541
+ARGP4
+CNSTI4 956
+ADDRGP4 level+124
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $564
+ADDRLP4 536
+CNSTI4 0
+ASGNI4
+ADDRGP4 $565
+JUMPV
+LABELV $564
+ADDRLP4 536
+CNSTI4 956
+ADDRGP4 level+124
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $565
+ADDRLP4 536
+INDIRI4
+ARGI4
+ADDRLP4 540
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 6
+ARGI4
+ADDRLP4 540
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $541
+ARGP4
+CNSTI4 956
+ADDRGP4 level+124+4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $571
+ADDRLP4 544
+CNSTI4 0
+ASGNI4
+ADDRGP4 $572
+JUMPV
+LABELV $571
+ADDRLP4 544
+CNSTI4 956
+ADDRGP4 level+124+4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $572
+ADDRLP4 544
+INDIRI4
+ARGI4
+ADDRLP4 548
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 7
+ARGI4
+ADDRLP4 548
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $547
+JUMPV
+LABELV $546
+ADDRGP4 level+112
+INDIRI4
+CNSTI4 0
+NEI4 $573
+ADDRGP4 $541
+ARGP4
+CNSTI4 -9999
+ARGI4
+ADDRLP4 536
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 6
+ARGI4
+ADDRLP4 536
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $541
+ARGP4
+CNSTI4 -9999
+ARGI4
+ADDRLP4 540
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 7
+ARGI4
+ADDRLP4 540
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $574
+JUMPV
+LABELV $573
+ADDRGP4 level+112
+INDIRI4
+CNSTI4 1
+NEI4 $576
+ADDRGP4 $541
+ARGP4
+CNSTI4 956
+ADDRGP4 level+124
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 536
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 6
+ARGI4
+ADDRLP4 536
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $541
+ARGP4
+CNSTI4 -9999
+ARGI4
+ADDRLP4 540
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 7
+ARGI4
+ADDRLP4 540
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $577
+JUMPV
+LABELV $576
+ADDRGP4 $541
+ARGP4
+CNSTI4 956
+ADDRGP4 level+124
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 536
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 6
+ARGI4
+ADDRLP4 536
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $541
+ARGP4
+CNSTI4 956
+ADDRGP4 level+124+4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 540
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 7
+ARGI4
+ADDRLP4 540
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $577
+LABELV $574
+LABELV $547
+LABELV $539
+ADDRGP4 CheckExitRules
+CALLV
+pop
+ADDRGP4 level+9168
+INDIRI4
+CNSTI4 0
+EQI4 $583
+ADDRGP4 SendScoreboardMessageToAllClients
+CALLV
+pop
+LABELV $583
+LABELV $432
+endproc CalculateRanks 576 16
+export SendScoreboardMessageToAllClients
+proc SendScoreboardMessageToAllClients 4 4
+ADDRGP4 level+9168
+INDIRI4
+CNSTI4 0
+NEI4 $587
+ADDRGP4 level+108
+CNSTI4 1
+ASGNI4
+ADDRGP4 $586
+JUMPV
+LABELV $587
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $594
+JUMPV
+LABELV $591
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $596
+CNSTI4 832
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRGP4 DeathmatchScoreboardMessage
+CALLV
+pop
+LABELV $596
+LABELV $592
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $594
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $591
+LABELV $586
+endproc SendScoreboardMessageToAllClients 4 4
+export MoveClientToIntermission
+proc MoveClientToIntermission 0 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $599
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 StopFollowing
+CALLV
+pop
+LABELV $599
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRGP4 level+9184
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRGP4 level+9184
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDRGP4 level+9196
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 64
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $598
+endproc MoveClientToIntermission 0 12
+export FindIntermissionPoint
+proc FindIntermissionPoint 32 16
+CNSTP4 0
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRGP4 $605
+ARGP4
+ADDRLP4 20
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $606
+ADDRGP4 vec3_origin
+ARGP4
+ADDRGP4 level+9184
+ARGP4
+ADDRGP4 level+9196
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 SelectSpawnPoint
+CALLP4
+pop
+ADDRGP4 $607
+JUMPV
+LABELV $606
+ADDRGP4 level+9184
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 level+9196
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 660
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $612
+ADDRLP4 0
+INDIRP4
+CNSTI4 660
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 G_PickTarget
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $614
+ADDRLP4 28
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 28
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ADDRGP4 level+9184
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 28
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ADDRGP4 level+9184+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ADDRGP4 level+9184+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+ARGP4
+ADDRGP4 level+9196
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+LABELV $614
+LABELV $612
+LABELV $607
+LABELV $604
+endproc FindIntermissionPoint 32 16
+export BeginIntermission
+proc BeginIntermission 8 4
+ADDRGP4 level+9168
+INDIRI4
+CNSTI4 0
+EQI4 $625
+ADDRGP4 $624
+JUMPV
+LABELV $625
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+NEI4 $628
+ADDRGP4 AdjustTournamentScores
+CALLV
+pop
+LABELV $628
+ADDRGP4 level+9168
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+ADDRGP4 FindIntermissionPoint
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 2
+NEI4 $633
+ADDRGP4 UpdateTournamentInfo
+CALLV
+pop
+ADDRGP4 SpawnModelsOnVictoryPads
+CALLV
+pop
+LABELV $633
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $639
+JUMPV
+LABELV $636
+ADDRLP4 0
+CNSTI4 832
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $641
+ADDRGP4 $637
+JUMPV
+LABELV $641
+ADDRLP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $643
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 respawn
+CALLV
+pop
+LABELV $643
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 MoveClientToIntermission
+CALLV
+pop
+LABELV $637
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $639
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $636
+ADDRGP4 SendScoreboardMessageToAllClients
+CALLV
+pop
+LABELV $624
+endproc BeginIntermission 8 4
+export ExitLevel
+proc ExitLevel 8 8
+ADDRGP4 BotInterbreedEndMatch
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+NEI4 $646
+ADDRGP4 level+104
+INDIRI4
+CNSTI4 0
+NEI4 $645
+ADDRGP4 RemoveTournamentLoser
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $652
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 level+104
+CNSTI4 1
+ASGNI4
+ADDRGP4 level+9172
+CNSTP4 0
+ASGNP4
+ADDRGP4 level+9168
+CNSTI4 0
+ASGNI4
+ADDRGP4 $645
+JUMPV
+LABELV $646
+CNSTI4 2
+ARGI4
+ADDRGP4 $656
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 level+9172
+CNSTP4 0
+ASGNP4
+ADDRGP4 level+9168
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+80+4
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+80+8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $666
+JUMPV
+LABELV $663
+ADDRLP4 4
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $668
+ADDRGP4 $664
+JUMPV
+LABELV $668
+ADDRLP4 4
+INDIRP4
+CNSTI4 248
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $664
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $666
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $663
+ADDRGP4 G_WriteSessionData
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $673
+JUMPV
+LABELV $670
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $675
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $675
+LABELV $671
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $673
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $670
+LABELV $645
+endproc ExitLevel 8 8
+export G_LogFlush
+proc G_LogFlush 4 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+56
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $678
+ADDRGP4 logBufferUsed
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $678
+ADDRGP4 logBuffer
+ARGP4
+ADDRGP4 logBufferUsed
+INDIRI4
+ARGI4
+ADDRGP4 level+56
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+LABELV $678
+ADDRGP4 logBufferUsed
+CNSTI4 0
+ASGNI4
+LABELV $677
+endproc G_LogFlush 4 12
+export G_LogPrintf
+proc G_LogPrintf 1076 24
+ADDRLP4 1024
+ADDRGP4 level+68
+INDIRI4
+ADDRGP4 level+76
+INDIRI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 1048
+CNSTI4 60
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1024
+INDIRI4
+ADDRLP4 1048
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 1024
+ADDRLP4 1024
+INDIRI4
+ADDRLP4 1048
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 1060
+CNSTI4 10
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1024
+INDIRI4
+ADDRLP4 1060
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 1024
+ADDRLP4 1024
+INDIRI4
+ADDRLP4 1060
+INDIRI4
+ADDRLP4 1040
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $685
+ARGP4
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRLP4 1024
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 1032
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 0+7
+ARGP4
+CNSTU4 1017
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 1032
+CNSTP4 0
+ASGNP4
+ADDRGP4 g_dedicated+12
+INDIRI4
+CNSTI4 0
+EQI4 $688
+ADDRGP4 $691
+ARGP4
+ADDRLP4 0+7
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $688
+ADDRGP4 level+56
+INDIRI4
+CNSTI4 0
+NEI4 $693
+ADDRGP4 $682
+JUMPV
+LABELV $693
+ADDRLP4 0
+ARGP4
+ADDRLP4 1068
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1028
+ADDRLP4 1068
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 logBufferUsed
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+ADDI4
+CNSTI4 16384
+LEI4 $696
+ADDRGP4 G_LogFlush
+CALLV
+pop
+LABELV $696
+ADDRGP4 logBufferUsed
+INDIRI4
+ADDRGP4 logBuffer
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1028
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 1072
+ADDRGP4 logBufferUsed
+ASGNP4
+ADDRLP4 1072
+INDIRP4
+ADDRLP4 1072
+INDIRP4
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 g_logSync+12
+INDIRI4
+CNSTI4 0
+EQI4 $698
+ADDRGP4 G_LogFlush
+CALLV
+pop
+LABELV $698
+LABELV $682
+endproc G_LogPrintf 1076 24
+export LogExit
+proc LogExit 12 12
+ADDRGP4 $702
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 level+9164
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+CNSTI4 22
+ARGI4
+ADDRGP4 $83
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRLP4 8
+ADDRGP4 level+112
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 32
+LEI4 $706
+ADDRLP4 8
+CNSTI4 32
+ASGNI4
+LABELV $706
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+LTI4 $708
+ADDRGP4 $711
+ARGP4
+ADDRGP4 level+80+4
+INDIRI4
+ARGI4
+ADDRGP4 level+80+8
+INDIRI4
+ARGI4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+LABELV $708
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $719
+JUMPV
+LABELV $716
+ADDRLP4 4
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+124
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $721
+ADDRGP4 $717
+JUMPV
+LABELV $721
+ADDRLP4 4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $723
+ADDRGP4 $717
+JUMPV
+LABELV $723
+ADDRGP4 $725
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+124
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+LABELV $717
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $719
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $716
+LABELV $701
+endproc LogExit 12 12
+proc CheckIntermissionExit 24 0
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 2
+NEI4 $728
+ADDRGP4 $727
+JUMPV
+LABELV $728
+ADDRGP4 level+68
+INDIRI4
+ADDRGP4 level+9168
+INDIRI4
+CNSTI4 25000
+ADDI4
+LEI4 $731
+ADDRGP4 ExitLevel
+CALLV
+pop
+ADDRGP4 $727
+JUMPV
+LABELV $731
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $738
+JUMPV
+LABELV $735
+ADDRLP4 0
+CNSTI4 956
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $740
+ADDRGP4 $736
+JUMPV
+LABELV $740
+CNSTI4 832
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $742
+ADDRGP4 $736
+JUMPV
+LABELV $742
+ADDRLP4 0
+INDIRP4
+CNSTI4 692
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $746
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+GEI4 $747
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDRLP4 4
+INDIRI4
+LSHI4
+BORI4
+ASGNI4
+ADDRGP4 $747
+JUMPV
+LABELV $746
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $747
+LABELV $736
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $738
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $735
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $753
+JUMPV
+LABELV $750
+ADDRLP4 0
+CNSTI4 956
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $755
+ADDRGP4 $751
+JUMPV
+LABELV $755
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $751
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $753
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $750
+ADDRGP4 level+68
+INDIRI4
+ADDRGP4 level+9168
+INDIRI4
+CNSTI4 5000
+ADDI4
+GEI4 $757
+ADDRGP4 $727
+JUMPV
+LABELV $757
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $761
+ADDRGP4 level+9176
+CNSTI4 0
+ASGNI4
+ADDRGP4 $727
+JUMPV
+LABELV $761
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $764
+ADDRGP4 ExitLevel
+CALLV
+pop
+ADDRGP4 $727
+JUMPV
+LABELV $764
+ADDRGP4 level+9176
+INDIRI4
+CNSTI4 0
+NEI4 $766
+ADDRGP4 level+9176
+CNSTI4 1
+ASGNI4
+ADDRGP4 level+9180
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+LABELV $766
+ADDRGP4 level+68
+INDIRI4
+ADDRGP4 level+9180
+INDIRI4
+CNSTI4 10000
+ADDI4
+GEI4 $772
+ADDRGP4 $727
+JUMPV
+LABELV $772
+ADDRGP4 ExitLevel
+CALLV
+pop
+LABELV $727
+endproc CheckIntermissionExit 24 0
+proc ScoreIsTied 24 0
+ADDRGP4 level+120
+INDIRI4
+CNSTI4 2
+GEI4 $777
+CNSTI4 0
+RETI4
+ADDRGP4 $776
+JUMPV
+LABELV $777
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $780
+CNSTI4 0
+RETI4
+ADDRGP4 $776
+JUMPV
+LABELV $780
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+LTI4 $783
+ADDRGP4 level+80+4
+INDIRI4
+ADDRGP4 level+80+8
+INDIRI4
+NEI4 $791
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $792
+JUMPV
+LABELV $791
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $792
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $776
+JUMPV
+LABELV $783
+ADDRLP4 12
+CNSTI4 956
+ASGNI4
+ADDRLP4 16
+ADDRGP4 level
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 248
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ADDRGP4 level+124
+INDIRI4
+MULI4
+ADDRLP4 16
+INDIRP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 level+124+4
+INDIRI4
+MULI4
+ADDRLP4 16
+INDIRP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $797
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $798
+JUMPV
+LABELV $797
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $798
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $776
+endproc ScoreIsTied 24 0
+proc CheckExitRules 32 8
+ADDRGP4 level+9168
+INDIRI4
+CNSTI4 0
+EQI4 $800
+ADDRGP4 CheckIntermissionExit
+CALLV
+pop
+ADDRGP4 $799
+JUMPV
+LABELV $800
+ADDRGP4 level+9164
+INDIRI4
+CNSTI4 0
+EQI4 $803
+ADDRGP4 level+68
+INDIRI4
+ADDRGP4 level+9164
+INDIRI4
+SUBI4
+CNSTI4 1000
+LTI4 $799
+ADDRGP4 level+9164
+CNSTI4 0
+ASGNI4
+ADDRGP4 BeginIntermission
+CALLV
+pop
+ADDRGP4 $799
+JUMPV
+LABELV $803
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 0
+EQI4 $811
+ADDRGP4 $799
+JUMPV
+LABELV $811
+ADDRGP4 g_suddenDeath+12
+INDIRI4
+CNSTI4 0
+EQI4 $814
+ADDRLP4 8
+ADDRGP4 ScoreIsTied
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $814
+ADDRGP4 $799
+JUMPV
+LABELV $814
+ADDRGP4 g_timelimit+12
+INDIRI4
+CNSTI4 0
+LTI4 $821
+ADDRGP4 g_timelimit+12
+INDIRI4
+CNSTI4 35791
+LEI4 $817
+LABELV $821
+ADDRGP4 $822
+ARGP4
+ADDRGP4 g_timelimit+12
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $77
+ARGP4
+ADDRGP4 $69
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 g_timelimit
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+LABELV $817
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_timelimit+12
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $824
+ADDRGP4 level+16
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $824
+ADDRGP4 level+68
+INDIRI4
+ADDRGP4 level+76
+INDIRI4
+SUBI4
+CNSTI4 60000
+ADDRGP4 g_timelimit+12
+INDIRI4
+MULI4
+LTI4 $828
+CNSTI4 -1
+ARGI4
+ADDRGP4 $833
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $834
+ARGP4
+ADDRGP4 LogExit
+CALLV
+pop
+ADDRGP4 $799
+JUMPV
+LABELV $828
+LABELV $824
+ADDRGP4 g_fraglimit+12
+INDIRI4
+CNSTI4 0
+GEI4 $835
+ADDRGP4 $838
+ARGP4
+ADDRGP4 g_fraglimit+12
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $840
+ARGP4
+ADDRGP4 $69
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 g_fraglimit
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+LABELV $835
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $841
+ADDRGP4 g_LPS_flags+12
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $841
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $848
+JUMPV
+LABELV $845
+ADDRLP4 0
+CNSTI4 956
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $850
+ADDRGP4 $846
+JUMPV
+LABELV $850
+ADDRLP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $852
+ADDRGP4 $846
+JUMPV
+LABELV $852
+ADDRLP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $854
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $854
+LABELV $846
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $848
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $845
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+GTI4 $842
+ADDRLP4 16
+INDIRI4
+ADDRGP4 level+120
+INDIRI4
+GEI4 $842
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $859
+ADDRGP4 $861
+ARGP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $860
+JUMPV
+LABELV $859
+CNSTI4 -1
+ARGI4
+ADDRGP4 $862
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $860
+ADDRGP4 $863
+ARGP4
+ADDRGP4 LogExit
+CALLV
+pop
+ADDRGP4 $799
+JUMPV
+LABELV $841
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 6
+GEI4 $864
+ADDRGP4 g_fraglimit+12
+INDIRI4
+CNSTI4 0
+EQI4 $864
+ADDRGP4 level+80+4
+INDIRI4
+ADDRGP4 g_fraglimit+12
+INDIRI4
+LTI4 $868
+CNSTI4 -1
+ARGI4
+ADDRGP4 $873
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $863
+ARGP4
+ADDRGP4 LogExit
+CALLV
+pop
+ADDRGP4 $799
+JUMPV
+LABELV $868
+ADDRGP4 level+80+8
+INDIRI4
+ADDRGP4 g_fraglimit+12
+INDIRI4
+LTI4 $874
+CNSTI4 -1
+ARGI4
+ADDRGP4 $879
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $863
+ARGP4
+ADDRGP4 LogExit
+CALLV
+pop
+ADDRGP4 $799
+JUMPV
+LABELV $874
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $883
+JUMPV
+LABELV $880
+ADDRLP4 0
+CNSTI4 956
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $885
+ADDRGP4 $881
+JUMPV
+LABELV $885
+ADDRLP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $887
+ADDRGP4 $881
+JUMPV
+LABELV $887
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ADDRGP4 g_fraglimit+12
+INDIRI4
+LTI4 $889
+ADDRGP4 $863
+ARGP4
+ADDRGP4 LogExit
+CALLV
+pop
+ADDRGP4 $892
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $799
+JUMPV
+LABELV $889
+LABELV $881
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $883
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $880
+LABELV $864
+LABELV $842
+ADDRGP4 g_capturelimit+12
+INDIRI4
+CNSTI4 0
+GEI4 $893
+ADDRGP4 $896
+ARGP4
+ADDRGP4 g_capturelimit+12
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $898
+ARGP4
+ADDRGP4 $69
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 g_capturelimit
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+LABELV $893
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 6
+LTI4 $899
+ADDRGP4 g_capturelimit+12
+INDIRI4
+CNSTI4 0
+EQI4 $899
+ADDRGP4 level+80+4
+INDIRI4
+ADDRGP4 g_capturelimit+12
+INDIRI4
+LTI4 $903
+CNSTI4 -1
+ARGI4
+ADDRGP4 $873
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $863
+ARGP4
+ADDRGP4 LogExit
+CALLV
+pop
+ADDRGP4 $799
+JUMPV
+LABELV $903
+ADDRGP4 level+80+8
+INDIRI4
+ADDRGP4 g_capturelimit+12
+INDIRI4
+LTI4 $908
+CNSTI4 -1
+ARGI4
+ADDRGP4 $879
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $863
+ARGP4
+ADDRGP4 LogExit
+CALLV
+pop
+LABELV $908
+LABELV $899
+LABELV $799
+endproc CheckExitRules 32 8
+proc CheckTournament 32 8
+ADDRGP4 level+120
+INDIRI4
+CNSTI4 0
+NEI4 $914
+ADDRGP4 $913
+JUMPV
+LABELV $914
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+NEI4 $917
+ADDRGP4 level+120
+INDIRI4
+CNSTI4 2
+GEI4 $920
+ADDRGP4 AddTournamentPlayer
+CALLV
+pop
+LABELV $920
+ADDRGP4 level+120
+INDIRI4
+CNSTI4 2
+EQI4 $923
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 -1
+EQI4 $913
+ADDRGP4 level+16
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $541
+ARGP4
+ADDRGP4 level+16
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 5
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $931
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 $913
+JUMPV
+LABELV $923
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 0
+NEI4 $932
+ADDRGP4 $913
+JUMPV
+LABELV $932
+ADDRGP4 g_warmup+4
+INDIRI4
+ADDRGP4 level+392
+INDIRI4
+EQI4 $935
+ADDRGP4 level+392
+ADDRGP4 g_warmup+4
+INDIRI4
+ASGNI4
+ADDRGP4 level+16
+CNSTI4 -1
+ASGNI4
+LABELV $935
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 0
+GEI4 $942
+ADDRGP4 level+120
+INDIRI4
+CNSTI4 2
+NEI4 $913
+ADDRLP4 0
+CNSTI4 1000
+ASGNI4
+ADDRGP4 level+16
+ADDRGP4 level+68
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_warmup+12
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ADDI4
+ASGNI4
+ADDRGP4 $541
+ARGP4
+ADDRGP4 level+16
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 5
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $913
+JUMPV
+LABELV $942
+ADDRGP4 level+68
+INDIRI4
+ADDRGP4 level+16
+INDIRI4
+LEI4 $918
+ADDRLP4 0
+ADDRGP4 level+16
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 10000
+ADDI4
+ASGNI4
+ADDRGP4 $68
+ARGP4
+ADDRGP4 $83
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $652
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 level+104
+CNSTI4 1
+ASGNI4
+ADDRGP4 $913
+JUMPV
+LABELV $917
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 2
+EQI4 $958
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 0
+EQI4 $958
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+LTI4 $962
+CNSTI4 -1
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRLP4 20
+ADDRGP4 TeamCount
+CALLI4
+ASGNI4
+ADDRLP4 4+8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 24
+ADDRGP4 TeamCount
+CALLI4
+ASGNI4
+ADDRLP4 4+4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 4+4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LTI4 $971
+ADDRLP4 4+8
+INDIRI4
+ADDRLP4 28
+INDIRI4
+GEI4 $963
+LABELV $971
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $963
+JUMPV
+LABELV $962
+ADDRGP4 level+120
+INDIRI4
+CNSTI4 2
+GEI4 $972
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $972
+LABELV $963
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $975
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 -1
+EQI4 $913
+ADDRGP4 level+16
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $541
+ARGP4
+ADDRGP4 level+16
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 5
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $931
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 $913
+JUMPV
+LABELV $975
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 0
+NEI4 $982
+ADDRGP4 $913
+JUMPV
+LABELV $982
+ADDRGP4 g_warmup+4
+INDIRI4
+ADDRGP4 level+392
+INDIRI4
+EQI4 $985
+ADDRGP4 level+392
+ADDRGP4 g_warmup+4
+INDIRI4
+ASGNI4
+ADDRGP4 level+16
+CNSTI4 -1
+ASGNI4
+LABELV $985
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 0
+GEI4 $992
+ADDRLP4 20
+CNSTI4 1000
+ASGNI4
+ADDRGP4 level+16
+ADDRGP4 level+68
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 g_warmup+12
+INDIRI4
+MULI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ADDI4
+ASGNI4
+ADDRGP4 $541
+ARGP4
+ADDRGP4 level+16
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 5
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $913
+JUMPV
+LABELV $992
+ADDRGP4 level+68
+INDIRI4
+ADDRGP4 level+16
+INDIRI4
+LEI4 $999
+ADDRLP4 20
+ADDRGP4 level+16
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 10000
+ADDI4
+ASGNI4
+ADDRGP4 $68
+ARGP4
+ADDRGP4 $83
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $652
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 level+104
+CNSTI4 1
+ASGNI4
+LABELV $999
+LABELV $958
+LABELV $918
+LABELV $913
+endproc CheckTournament 32 8
+proc CheckVote 4 8
+ADDRGP4 level+2448
+INDIRI4
+CNSTI4 0
+EQI4 $1006
+ADDRGP4 level+2448
+INDIRI4
+ADDRGP4 level+68
+INDIRI4
+GEI4 $1006
+ADDRGP4 level+2448
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1012
+ARGP4
+ADDRGP4 level+396
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $1006
+ADDRGP4 level+2444
+INDIRI4
+CNSTI4 0
+NEI4 $1014
+ADDRGP4 $1005
+JUMPV
+LABELV $1014
+ADDRGP4 level+68
+INDIRI4
+ADDRGP4 level+2444
+INDIRI4
+SUBI4
+CNSTI4 30000
+LTI4 $1017
+ADDRGP4 $1021
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+CNSTI4 -1
+ARGI4
+ADDRGP4 $1022
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1018
+JUMPV
+LABELV $1017
+ADDRGP4 level+2452
+INDIRI4
+ADDRGP4 level+2460
+INDIRI4
+CNSTI4 2
+DIVI4
+LEI4 $1023
+ADDRGP4 $1027
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+CNSTI4 -1
+ARGI4
+ADDRGP4 $1028
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 level+2448
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 3000
+ADDI4
+ASGNI4
+ADDRGP4 $1024
+JUMPV
+LABELV $1023
+ADDRGP4 level+2456
+INDIRI4
+ADDRGP4 level+2460
+INDIRI4
+CNSTI4 2
+DIVI4
+LTI4 $1005
+ADDRGP4 $1035
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+CNSTI4 -1
+ARGI4
+ADDRGP4 $1022
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $1032
+LABELV $1024
+LABELV $1018
+ADDRGP4 level+2444
+CNSTI4 0
+ASGNI4
+CNSTI4 8
+ARGI4
+ADDRGP4 $63
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $1005
+endproc CheckVote 4 8
+proc PrintTeam 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1041
+JUMPV
+LABELV $1038
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 628
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $1043
+ADDRGP4 $1039
+JUMPV
+LABELV $1043
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $1039
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1041
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $1038
+LABELV $1037
+endproc PrintTeam 4 8
+export SetLeader
+proc SetLeader 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+CNSTI4 956
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1046
+ADDRGP4 $1048
+ARGP4
+CNSTI4 956
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 PrintTeam
+CALLV
+pop
+ADDRGP4 $1045
+JUMPV
+LABELV $1046
+CNSTI4 956
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 628
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $1049
+ADDRGP4 $1051
+ARGP4
+CNSTI4 956
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 PrintTeam
+CALLV
+pop
+ADDRGP4 $1045
+JUMPV
+LABELV $1049
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1055
+JUMPV
+LABELV $1052
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 628
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $1057
+ADDRGP4 $1053
+JUMPV
+LABELV $1057
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 652
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1059
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 652
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+LABELV $1059
+LABELV $1053
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1055
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $1052
+CNSTI4 956
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 652
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+LABELV $1045
+endproc SetLeader 8 8
+export CheckTeamLeader
+proc CheckTeamLeader 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1065
+JUMPV
+LABELV $1062
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 628
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $1067
+ADDRGP4 $1063
+JUMPV
+LABELV $1067
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 652
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1069
+ADDRGP4 $1064
+JUMPV
+LABELV $1069
+LABELV $1063
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1065
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $1062
+LABELV $1064
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $1071
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1077
+JUMPV
+LABELV $1074
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 628
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $1079
+ADDRGP4 $1075
+JUMPV
+LABELV $1079
+CNSTI4 832
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $1081
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 652
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1076
+JUMPV
+LABELV $1081
+LABELV $1075
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1077
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $1074
+LABELV $1076
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $1085
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1091
+JUMPV
+LABELV $1088
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 628
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $1093
+ADDRGP4 $1089
+JUMPV
+LABELV $1093
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 652
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1090
+JUMPV
+LABELV $1089
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1091
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $1088
+LABELV $1090
+LABELV $1085
+LABELV $1071
+LABELV $1061
+endproc CheckTeamLeader 4 0
+proc CheckTeamVote 20 12
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $1096
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1097
+JUMPV
+LABELV $1096
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $1095
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $1099
+LABELV $1097
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4512
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1100
+ADDRGP4 $1095
+JUMPV
+LABELV $1100
+ADDRGP4 level+68
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4512
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 30000
+LTI4 $1103
+CNSTI4 -1
+ARGI4
+ADDRGP4 $1107
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1104
+JUMPV
+LABELV $1103
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 level+4520
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 level+4536
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+DIVI4
+LEI4 $1108
+CNSTI4 -1
+ARGI4
+ADDRGP4 $1112
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1115
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 level+2464
+ADDP4
+ARGP4
+CNSTI4 6
+ARGI4
+ADDRLP4 12
+ADDRGP4 Q_strncmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $1113
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 level+2464+7
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 SetLeader
+CALLV
+pop
+ADDRGP4 $1109
+JUMPV
+LABELV $1113
+ADDRGP4 $1012
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 level+2464
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $1109
+JUMPV
+LABELV $1108
+ADDRLP4 12
+CNSTI4 2
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 level+4528
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 level+4536
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+DIVI4
+LTI4 $1095
+CNSTI4 -1
+ARGI4
+ADDRGP4 $1107
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $1121
+LABELV $1109
+LABELV $1104
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4512
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+ADDI4
+ARGI4
+ADDRGP4 $63
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $1095
+endproc CheckTeamVote 20 12
+data
+align 4
+LABELV $1126
+byte 4 -1
+code
+proc CheckCvars 4 8
+ADDRGP4 g_password+4
+INDIRI4
+ADDRGP4 $1126
+INDIRI4
+EQI4 $1127
+ADDRGP4 $1126
+ADDRGP4 g_password+4
+INDIRI4
+ASGNI4
+ADDRGP4 g_password+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1131
+ADDRGP4 g_password+16
+ARGP4
+ADDRGP4 $1135
+ARGP4
+ADDRLP4 0
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1131
+ADDRGP4 $96
+ARGP4
+ADDRGP4 $83
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1132
+JUMPV
+LABELV $1131
+ADDRGP4 $96
+ARGP4
+ADDRGP4 $69
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1132
+LABELV $1127
+LABELV $1125
+endproc CheckCvars 4 8
+export G_RunThink
+proc G_RunThink 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GTF4 $1137
+ADDRGP4 $1136
+JUMPV
+LABELV $1137
+ADDRLP4 0
+INDIRF4
+ADDRGP4 level+68
+INDIRI4
+CVIF4 4
+LEF4 $1139
+ADDRGP4 $1136
+JUMPV
+LABELV $1139
+ADDRFP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1142
+ADDRGP4 $1144
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $1142
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1136
+endproc G_RunThink 8 4
+data
+align 4
+LABELV $1254
+byte 4 0
+code
+proc WoP_RunFrame 304 32
+ADDRLP4 20
+CNSTP4 0
+ASGNP4
+ADDRLP4 4+4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 16
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1150
+JUMPV
+LABELV $1147
+ADDRLP4 28
+CNSTI4 832
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1152
+ADDRGP4 $1148
+JUMPV
+LABELV $1152
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $1154
+ADDRLP4 36
+ADDRLP4 28
+INDIRP4
+CNSTI4 424
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 -33
+BANDI4
+ASGNI4
+ADDRGP4 $1148
+JUMPV
+LABELV $1154
+ADDRLP4 28
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1156
+ADDRGP4 $1148
+JUMPV
+LABELV $1156
+ADDRLP4 40
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 16
+RSHI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $1158
+ADDRLP4 44
+ADDRLP4 28
+INDIRP4
+CNSTI4 424
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+ADDRGP4 $1159
+JUMPV
+LABELV $1158
+ADDRLP4 48
+ADDRLP4 28
+INDIRP4
+CNSTI4 424
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 -33
+BANDI4
+ASGNI4
+LABELV $1159
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+16
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LEI4 $1160
+ADDRGP4 g_warmupReady+8
+INDIRF4
+CNSTF4 0
+LEF4 $1160
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $1160
+ADDRLP4 28
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 52
+INDIRI4
+NEI4 $1160
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 700
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1164
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+LABELV $1164
+LABELV $1160
+ADDRLP4 28
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $1166
+ADDRLP4 28
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 316
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1168
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+EQI4 $1173
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 7
+NEI4 $1172
+LABELV $1173
+ADDRLP4 28
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $1168
+LABELV $1172
+ADDRLP4 128
+CNSTF4 1028443341
+ASGNF4
+ADDRLP4 132
+ADDRLP4 28
+INDIRP4
+CNSTI4 516
+ADDP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 28
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRF4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 132
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 28
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRF4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 132
+INDIRP4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56+8
+ADDRLP4 28
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRF4
+CNSTF4 1028443341
+ADDRLP4 28
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68
+ARGP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 436
+ADDP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 448
+ADDP4
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 68+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1176
+ADDRLP4 144
+CNSTI4 832
+ADDRLP4 68+52
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1180
+ADDRLP4 164
+CNSTI4 488
+ASGNI4
+ADDRLP4 148
+ADDRLP4 144
+INDIRP4
+ADDRLP4 164
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 164
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 172
+CNSTI4 492
+ASGNI4
+ADDRLP4 148+4
+ADDRLP4 144
+INDIRP4
+ADDRLP4 172
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 172
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 176
+CNSTI4 496
+ASGNI4
+ADDRLP4 148+8
+ADDRLP4 144
+INDIRP4
+ADDRLP4 176
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 176
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 148
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 148+8
+INDIRF4
+CNSTF4 0
+GEF4 $1184
+ADDRLP4 148+8
+CNSTF4 3212836864
+ADDRLP4 148+8
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1184
+ADDRLP4 180
+ADDRLP4 144
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 180
+INDIRP4
+ADDRLP4 180
+INDIRP4
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 148
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 184
+ADDRLP4 144
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 184
+INDIRP4
+ADDRLP4 184
+INDIRP4
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 148+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 188
+ADDRLP4 144
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+ADDRLP4 188
+INDIRP4
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 148+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 192
+ADDRLP4 144
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 192
+INDIRP4
+ADDRLP4 192
+INDIRP4
+INDIRF4
+CNSTF4 1120403456
+ADDF4
+ASGNF4
+LABELV $1180
+LABELV $1176
+LABELV $1168
+ADDRLP4 28
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1190
+ADDRGP4 level+68
+INDIRI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 728
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 1000
+GTI4 $1195
+ADDRLP4 28
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $1192
+LABELV $1195
+ADDRLP4 28
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 732
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 $1193
+JUMPV
+LABELV $1192
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 736
+ADDP4
+INDIRI4
+ADDRGP4 level+68
+INDIRI4
+GEI4 $1196
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRLP4 28
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+CNSTP4 0
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+CNSTI4 3
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 11
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+ADDRLP4 72
+ADDRLP4 28
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 736
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRI4
+CNSTI4 200
+ADDI4
+ASGNI4
+LABELV $1196
+LABELV $1193
+LABELV $1190
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $1199
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+16
+INDIRI4
+ADDRLP4 56
+INDIRI4
+NEI4 $1202
+ADDRLP4 28
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ADDRLP4 56
+INDIRI4
+LEI4 $1202
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1205
+ADDRLP4 4
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRGP4 $1206
+JUMPV
+LABELV $1205
+ADDRLP4 4+4
+ADDRLP4 28
+INDIRP4
+ASGNP4
+LABELV $1206
+ADDRLP4 28
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1208
+ADDRLP4 60
+ADDRLP4 28
+INDIRP4
+CNSTI4 424
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $1208
+LABELV $1202
+ADDRLP4 60
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+CNSTI4 216
+ADDP4
+ADDRLP4 60
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 g_LPS_flags+12
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $1210
+ADDRLP4 64
+ADDRLP4 28
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1210
+ADDRLP4 28
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1213
+ADDRLP4 64
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRI4
+CNSTI4 -8388609
+BANDI4
+ASGNI4
+ADDRGP4 $1214
+JUMPV
+LABELV $1213
+ADDRLP4 64
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRI4
+CNSTI4 8388608
+BORI4
+ASGNI4
+LABELV $1214
+LABELV $1199
+ADDRLP4 28
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRI4
+CNSTI4 50
+ADDI4
+ADDRGP4 level+68
+INDIRI4
+GEI4 $1215
+ADDRLP4 56
+ADDRLP4 28
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 -32769
+BANDI4
+ASGNI4
+LABELV $1215
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+EQI4 $1222
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 7
+NEI4 $1218
+LABELV $1222
+ADDRLP4 56
+ADDRLP4 28
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRLP4 56
+INDIRP4
+CNSTI4 660
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 60
+INDIRI4
+NEI4 $1223
+ADDRLP4 64
+ADDRLP4 56
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $1226
+ADDRLP4 64
+INDIRI4
+CNSTI4 1000
+ADDI4
+ADDRGP4 level+68
+INDIRI4
+GEI4 $1223
+LABELV $1226
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1227
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRLP4 28
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 724
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+LABELV $1223
+LABELV $1218
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+EQI4 $1233
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 7
+NEI4 $1229
+LABELV $1233
+ADDRLP4 28
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1229
+ADDRLP4 56
+ADDRLP4 28
+INDIRP4
+CNSTI4 516
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 56
+INDIRP4
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRI4
+ADDRGP4 level+68
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 56
+INDIRP4
+INDIRP4
+CNSTI4 216
+ADDP4
+ADDRLP4 32
+INDIRI4
+CNSTI4 1000
+DIVI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+GTI4 $1235
+ADDRGP4 level+36
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1237
+ADDRLP4 28
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRGP4 level+36
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 60
+ADDRLP4 28
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+CNSTF4 1091567616
+ADDF4
+ASGNF4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 level+36
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 SetClientViewAngle
+CALLV
+pop
+ADDRGP4 $1242
+ARGP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 720
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1238
+JUMPV
+LABELV $1237
+ADDRLP4 28
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1243
+ADDRGP4 $1148
+JUMPV
+LABELV $1243
+ADDRLP4 28
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $1245
+ADDRGP4 $1148
+JUMPV
+LABELV $1245
+ADDRLP4 60
+ADDRLP4 28
+INDIRP4
+CNSTI4 536
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+CNSTI4 -17
+BANDI4
+ASGNI4
+ADDRLP4 68
+CNSTI4 -999
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 744
+ADDP4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+CNSTI4 100000
+ARGI4
+CNSTI4 22
+ARGI4
+ADDRGP4 player_die
+CALLV
+pop
+LABELV $1238
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1247
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRLP4 28
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 216
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1235
+LABELV $1229
+LABELV $1166
+LABELV $1148
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1150
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $1147
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $1248
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_LPS_flags+12
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 28
+INDIRI4
+EQI4 $1248
+ADDRGP4 level+16
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $1248
+ADDRLP4 4+4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1248
+ADDRLP4 296
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1255
+ADDRLP4 40
+ARGP4
+ADDRGP4 level+124
+ARGP4
+CNSTU4 256
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 40
+ARGP4
+ADDRGP4 level+112
+INDIRI4
+CVIU4 4
+ARGU4
+CNSTU4 4
+ARGU4
+ADDRGP4 SortRanksLPS
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+ADDRGP4 g_LPS_flags+12
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1259
+ADDRLP4 36
+ADDRGP4 g_LPS_startlives+12
+INDIRI4
+ASGNI4
+ADDRGP4 $1260
+JUMPV
+LABELV $1259
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+LABELV $1260
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1266
+JUMPV
+LABELV $1263
+ADDRLP4 32
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 40
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $1268
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+NEI4 $1265
+ADDRLP4 296
+CNSTI4 1
+ASGNI4
+LABELV $1271
+LABELV $1268
+ADDRLP4 32
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+NEI4 $1272
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 $1274
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1273
+JUMPV
+LABELV $1272
+ADDRGP4 $1275
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 300
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 300
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $1273
+CNSTI4 956
+ADDRLP4 32
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1276
+ADDRGP4 $1264
+JUMPV
+LABELV $1276
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LEI4 $1278
+ADDRLP4 300
+CNSTI4 832
+ADDRLP4 32
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRLP4 300
+INDIRI4
+ADDRGP4 g_entities+92
+ADDP4
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRGP4 $1281
+ARGP4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRLP4 36
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1278
+LABELV $1264
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1266
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $1263
+LABELV $1265
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 656
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1254
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+ADDRGP4 $1256
+JUMPV
+LABELV $1255
+ADDRGP4 level+68
+INDIRI4
+ADDRGP4 $1254
+INDIRI4
+SUBI4
+CNSTI4 10000
+LEI4 $1283
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1289
+JUMPV
+LABELV $1286
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $1291
+ADDRGP4 $1287
+JUMPV
+LABELV $1291
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1293
+ADDRGP4 $1287
+JUMPV
+LABELV $1293
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 656
+ADDP4
+ADDRGP4 g_LPS_startlives+12
+INDIRI4
+ASGNI4
+CNSTI4 832
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRGP4 ClientSpawn
+CALLV
+pop
+LABELV $1287
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1289
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $1286
+ADDRGP4 $1284
+JUMPV
+LABELV $1283
+ADDRGP4 level+68
+INDIRI4
+ADDRGP4 $1254
+INDIRI4
+SUBI4
+CNSTI4 5000
+LEI4 $1296
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 500
+MODI4
+CNSTI4 0
+NEI4 $1296
+ADDRGP4 $1300
+ARGP4
+CNSTI4 10000
+ADDRGP4 level+68
+INDIRI4
+ADDRGP4 $1254
+INDIRI4
+SUBI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ARGI4
+ADDRLP4 300
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 300
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $1296
+LABELV $1284
+LABELV $1256
+LABELV $1248
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 0
+EQI4 $1302
+ADDRLP4 12
+INDIRF4
+CNSTF4 0
+EQF4 $1302
+ADDRLP4 16
+INDIRF4
+ADDRLP4 12
+INDIRF4
+DIVF4
+ADDRGP4 g_warmupReady+8
+INDIRF4
+GEF4 $1305
+ADDRGP4 level+16
+CNSTI4 -1
+ASGNI4
+LABELV $1305
+ADDRGP4 $1309
+ARGP4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 12
+INDIRF4
+DIVF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $89
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1302
+LABELV $1145
+endproc WoP_RunFrame 304 32
+proc G_RunFrame 32 12
+ADDRGP4 level+104
+INDIRI4
+CNSTI4 0
+EQI4 $1311
+ADDRGP4 $1310
+JUMPV
+LABELV $1311
+ADDRLP4 8
+ADDRGP4 level+64
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 level+72
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+ADDRGP4 level+68
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 G_UpdateCvars
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRLP4 12
+ADDRGP4 G_NextActiveEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRGP4 $1321
+JUMPV
+LABELV $1318
+ADDRGP4 level+68
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 300
+LEI4 $1322
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1325
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1327
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 128
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1327
+LABELV $1325
+ADDRLP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1329
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+ADDRGP4 $1319
+JUMPV
+LABELV $1329
+ADDRLP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1331
+ADDRLP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+LABELV $1331
+LABELV $1322
+ADDRLP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1333
+ADDRGP4 $1319
+JUMPV
+LABELV $1333
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 416
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $1335
+ADDRLP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $1335
+ADDRGP4 $1319
+JUMPV
+LABELV $1335
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1337
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_RunMissile
+CALLV
+pop
+ADDRGP4 $1319
+JUMPV
+LABELV $1337
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 13
+NEI4 $1339
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_RunExplosion
+CALLV
+pop
+ADDRGP4 $1319
+JUMPV
+LABELV $1339
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $1343
+ADDRLP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1341
+LABELV $1343
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_RunItem
+CALLV
+pop
+ADDRGP4 $1319
+JUMPV
+LABELV $1341
+ADDRLP4 28
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $1344
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_RunMover
+CALLV
+pop
+ADDRGP4 $1319
+JUMPV
+LABELV $1344
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+CNSTI4 64
+GEI4 $1346
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_RunClient
+CALLV
+pop
+ADDRGP4 $1319
+JUMPV
+LABELV $1346
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_RunThink
+CALLV
+pop
+LABELV $1319
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 G_NextActiveEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+LABELV $1321
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1318
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1351
+JUMPV
+LABELV $1348
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1353
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ClientEndFrame
+CALLV
+pop
+LABELV $1353
+LABELV $1349
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 832
+ADDP4
+ASGNP4
+LABELV $1351
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $1348
+ADDRGP4 CheckTournament
+CALLV
+pop
+ADDRGP4 CheckExitRules
+CALLV
+pop
+ADDRGP4 CheckTeamStatus
+CALLV
+pop
+ADDRGP4 CheckVote
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 CheckTeamVote
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 CheckTeamVote
+CALLV
+pop
+ADDRGP4 CheckCvars
+CALLV
+pop
+ADDRGP4 G_SendScoreboardUpdates
+CALLV
+pop
+ADDRGP4 g_listEntity+12
+INDIRI4
+CNSTI4 0
+EQI4 $1355
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1358
+ADDRGP4 $1362
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 832
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+524
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $1359
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1024
+LTI4 $1358
+ADDRGP4 $121
+ARGP4
+ADDRGP4 $69
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1355
+ADDRGP4 level+9168
+INDIRI4
+CNSTI4 0
+NEI4 $1364
+ADDRGP4 WoP_RunFrame
+CALLV
+pop
+LABELV $1364
+ADDRGP4 G_LogFlush
+CALLV
+pop
+LABELV $1310
+endproc G_RunFrame 32 12
+bss
+export g_suddenDeath
+align 4
+LABELV g_suddenDeath
+skip 272
+export nextmapBackUp
+align 4
+LABELV nextmapBackUp
+skip 272
+export g_listEntity
+align 4
+LABELV g_listEntity
+skip 272
+export g_podiumDrop
+align 4
+LABELV g_podiumDrop
+skip 272
+export g_podiumDist
+align 4
+LABELV g_podiumDist
+skip 272
+export g_logSync
+align 4
+LABELV g_logSync
+skip 272
+export g_log
+align 4
+LABELV g_log
+skip 272
+export g_clients
+align 4
+LABELV g_clients
+skip 61184
+align 4
+LABELV logBufferUsed
+skip 4
+align 1
+LABELV logBuffer
+skip 16384
+import trap_AAS_BestReachableArea
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntities
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_RealTime
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_EntitiesInPVS
+import trap_RestoreClients
+import trap_RewindClients
+import trap_GetUsercmds
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_TraceBatch
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+export g_logDamage
+align 4
+LABELV g_logDamage
+skip 272
+export g_modInstagib_WeaponJump
+align 4
+LABELV g_modInstagib_WeaponJump
+skip 272
+export g_modInstagib
+align 4
+LABELV g_modInstagib
+skip 272
+export g_transmitSVboastermissiles
+align 4
+LABELV g_transmitSVboastermissiles
+skip 272
+export g_KillerduckHealth
+align 4
+LABELV g_KillerduckHealth
+skip 272
+export g_LPS_flags
+align 4
+LABELV g_LPS_flags
+skip 272
+export g_LPS_startlives
+align 4
+LABELV g_LPS_startlives
+skip 272
+export g_skyLensflare
+align 4
+LABELV g_skyLensflare
+skip 272
+export g_sky
+align 4
+LABELV g_sky
+skip 272
+export g_q3Items
+align 4
+LABELV g_q3Items
+skip 272
+export pmove_msec
+align 4
+LABELV pmove_msec
+skip 272
+export pmove_fixed
+align 4
+LABELV pmove_fixed
+skip 272
+export g_antilag
+align 4
+LABELV g_antilag
+skip 272
+export g_smoothClients
+align 4
+LABELV g_smoothClients
+skip 272
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+export g_filterBan
+align 4
+LABELV g_filterBan
+skip 272
+export g_banIPs
+align 4
+LABELV g_banIPs
+skip 272
+export g_teamForceBalance
+align 4
+LABELV g_teamForceBalance
+skip 272
+export g_teamAutoJoin
+align 4
+LABELV g_teamAutoJoin
+skip 272
+export g_allowVote
+align 4
+LABELV g_allowVote
+skip 272
+export g_curWarmupReady
+align 4
+LABELV g_curWarmupReady
+skip 272
+export g_warmupReady
+align 4
+LABELV g_warmupReady
+skip 272
+export g_doWarmup
+align 4
+LABELV g_doWarmup
+skip 272
+export g_warmup
+align 4
+LABELV g_warmup
+skip 272
+export g_motd
+align 4
+LABELV g_motd
+skip 272
+export g_synchronousClients
+align 4
+LABELV g_synchronousClients
+skip 272
+export g_weaponTeamRespawn
+align 4
+LABELV g_weaponTeamRespawn
+skip 272
+export g_weaponRespawn
+align 4
+LABELV g_weaponRespawn
+skip 272
+export g_debugDamage
+align 4
+LABELV g_debugDamage
+skip 272
+export g_debugAlloc
+align 4
+LABELV g_debugAlloc
+skip 272
+export g_debugMove
+align 4
+LABELV g_debugMove
+skip 272
+export g_inactivity
+align 4
+LABELV g_inactivity
+skip 272
+export g_forcerespawn
+align 4
+LABELV g_forcerespawn
+skip 272
+export g_quadfactor
+align 4
+LABELV g_quadfactor
+skip 272
+export g_knockback
+align 4
+LABELV g_knockback
+skip 272
+export g_speed
+align 4
+LABELV g_speed
+skip 272
+export g_gravity
+align 4
+LABELV g_gravity
+skip 272
+export g_needpass
+align 4
+LABELV g_needpass
+skip 272
+export g_password
+align 4
+LABELV g_password
+skip 272
+export g_friendlyFire
+align 4
+LABELV g_friendlyFire
+skip 272
+export g_capturelimit
+align 4
+LABELV g_capturelimit
+skip 272
+export g_timelimit
+align 4
+LABELV g_timelimit
+skip 272
+export g_fraglimit
+align 4
+LABELV g_fraglimit
+skip 272
+export g_dmflags
+align 4
+LABELV g_dmflags
+skip 272
+export g_restarted
+align 4
+LABELV g_restarted
+skip 272
+export g_maxGameClients
+align 4
+LABELV g_maxGameClients
+skip 272
+export g_maxclients
+align 4
+LABELV g_maxclients
+skip 272
+export g_cheats
+align 4
+LABELV g_cheats
+skip 272
+export g_dedicated
+align 4
+LABELV g_dedicated
+skip 272
+export g_gametype
+align 4
+LABELV g_gametype
+skip 272
+export g_entities
+align 4
+LABELV g_entities
+skip 851968
+export level
+align 4
+LABELV level
+skip 9536
+import Pickup_Team
+import CheckTeamStatus
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import MapSupportsGametype
+import G_GetArenaInfoByMap
+import G_InitGameinfo
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import AI_RemoveBambam
+import AI_AddBambam
+import AI_RemoveBoomie
+import AI_AddBoomie
+import BotCamViewangles
+import BotCamViewTarget
+import BotCamViewEntitiy
+import BotChooseWeap
+import BotCamFire
+import BotCamTaunt
+import BotCamMoveTo
+import BotCamMode
+import BotInterbreedEndMatch
+import Svcmd_BotStats_f
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_LoadBots
+import CantDamageTeamitem
+import boomies_createByPlayer
+import bambam_createByPlayer
+import IsItemSameTeam
+import Instagib_canSpawnEntity
+import Instagib_isRelevantDamageEvent
+import Instagib_calculateDamage
+import Instagib_getSpawnWeapon
+import Instagib_applyWeaponJumpKnockback
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import PrintMsg
+import CheckObeliskAttack
+import Team_GetFlagStatus
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThinkBatch
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_SendScoreboardUpdates
+import DeathmatchScoreboardMessage
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import GetASpawnPosition
+import SelectSpectatorSpawnPoint
+import SpotWouldTelefrag
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import respawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import Touch_DoorTrigger
+import G_PushablesChanged
+import G_RunMover
+import fire_kma
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_bubbleg
+import fire_bambamMissile
+import fire_duck
+import explode_imperius
+import fire_splasher
+import fire_nipper
+import fire_boaster
+import G_RunExplosion
+import G_RunMissile
+import BerserkerCheck
+import TossClientCubes
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import GametypeNameShort
+import GametypeName
+import RemoveOwnedItems
+import SetAward
+import G_RestorePowerups
+import G_BackupPowerups
+import DeleteDebugLines
+import DebugLineDouble
+import DebugLine
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_NextActiveEntity
+import G_InitEntityLists
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_FindAll
+import G_Find
+import G_EntityIndexChanged
+import G_InitEntityIndex
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import G_Say
+import ConcatArgs
+import Cmd_DropCartridge_f
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $1362
+byte 1 37
+byte 1 52
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1309
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $1300
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 78
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 82
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1281
+byte 1 115
+byte 1 117
+byte 1 114
+byte 1 118
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $1275
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 82
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1274
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 82
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1247
+byte 1 99
+byte 1 100
+byte 1 105
+byte 1 32
+byte 1 48
+byte 1 0
+align 1
+LABELV $1242
+byte 1 115
+byte 1 114
+byte 1 119
+byte 1 99
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1227
+byte 1 99
+byte 1 100
+byte 1 105
+byte 1 32
+byte 1 51
+byte 1 0
+align 1
+LABELV $1144
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 45
+byte 1 62
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 107
+byte 1 0
+align 1
+LABELV $1135
+byte 1 110
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $1115
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1112
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1107
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1051
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1048
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1035
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1028
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1027
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1022
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1021
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $1012
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $931
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 58
+byte 1 10
+byte 1 0
+align 1
+LABELV $898
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $896
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $892
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $879
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $873
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $863
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $862
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 76
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 80
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $861
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 76
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 80
+byte 1 97
+byte 1 100
+byte 1 33
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $840
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $838
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $834
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $833
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $822
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $725
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $711
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 32
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $702
+byte 1 69
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $691
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $685
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 0
+align 1
+LABELV $656
+byte 1 118
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 10
+byte 1 0
+align 1
+LABELV $652
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $605
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $541
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $456
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 0
+align 1
+LABELV $349
+byte 1 115
+byte 1 0
+align 1
+LABELV $328
+byte 1 102
+byte 1 0
+align 1
+LABELV $294
+byte 1 83
+byte 1 104
+byte 1 117
+byte 1 116
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 10
+byte 1 0
+align 1
+LABELV $290
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 83
+byte 1 104
+byte 1 117
+byte 1 116
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 10
+byte 1 0
+align 1
+LABELV $289
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $284
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $280
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $277
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 10
+byte 1 0
+align 1
+LABELV $271
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $255
+byte 1 78
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $249
+byte 1 76
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 46
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 46
+byte 1 37
+byte 1 52
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $248
+byte 1 73
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $247
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 10
+byte 1 0
+align 1
+LABELV $245
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $230
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 121
+byte 1 0
+align 1
+LABELV $226
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $225
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 32
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 122
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 10
+byte 1 0
+align 1
+LABELV $223
+byte 1 67
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $222
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $204
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $191
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $142
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 68
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $141
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 95
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $140
+byte 1 40
+byte 1 78
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 41
+byte 1 0
+align 1
+LABELV $139
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 95
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $138
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 74
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $137
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 80
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $136
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 117
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 110
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $135
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 83
+byte 1 86
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $134
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 66
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 85
+byte 1 112
+byte 1 0
+align 1
+LABELV $133
+byte 1 103
+byte 1 95
+byte 1 76
+byte 1 80
+byte 1 83
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $132
+byte 1 103
+byte 1 95
+byte 1 76
+byte 1 80
+byte 1 83
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 108
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $131
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 107
+byte 1 121
+byte 1 76
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $130
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 107
+byte 1 121
+byte 1 0
+align 1
+LABELV $129
+byte 1 103
+byte 1 95
+byte 1 113
+byte 1 51
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $128
+byte 1 45
+byte 1 49
+byte 1 0
+align 1
+LABELV $127
+byte 1 103
+byte 1 95
+byte 1 75
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 100
+byte 1 117
+byte 1 99
+byte 1 107
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $126
+byte 1 56
+byte 1 0
+align 1
+LABELV $125
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $124
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $123
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $122
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $121
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $120
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $119
+byte 1 55
+byte 1 48
+byte 1 0
+align 1
+LABELV $118
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 109
+byte 1 68
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $117
+byte 1 56
+byte 1 48
+byte 1 0
+align 1
+LABELV $116
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 109
+byte 1 68
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $115
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 116
+byte 1 100
+byte 1 0
+align 1
+LABELV $114
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 0
+align 1
+LABELV $113
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 68
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $112
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 77
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $111
+byte 1 54
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $110
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $109
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $108
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $107
+byte 1 53
+byte 1 0
+align 1
+LABELV $106
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $105
+byte 1 50
+byte 1 0
+align 1
+LABELV $104
+byte 1 103
+byte 1 95
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 102
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $103
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $102
+byte 1 103
+byte 1 95
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $101
+byte 1 56
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $100
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 118
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $99
+byte 1 50
+byte 1 56
+byte 1 48
+byte 1 0
+align 1
+LABELV $98
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $96
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $95
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 66
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $94
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 73
+byte 1 80
+byte 1 115
+byte 1 0
+align 1
+LABELV $93
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $92
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 83
+byte 1 121
+byte 1 110
+byte 1 99
+byte 1 0
+align 1
+LABELV $91
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 0
+align 1
+LABELV $90
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 0
+align 1
+LABELV $89
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 82
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 0
+align 1
+LABELV $88
+byte 1 48
+byte 1 46
+byte 1 48
+byte 1 0
+align 1
+LABELV $87
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 82
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 0
+align 1
+LABELV $86
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $85
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $84
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $83
+byte 1 49
+byte 1 0
+align 1
+LABELV $82
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 66
+byte 1 97
+byte 1 108
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $81
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 65
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 74
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $80
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $79
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 121
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 114
+byte 1 111
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $78
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $77
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $76
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $75
+byte 1 100
+byte 1 109
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $74
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $73
+byte 1 49
+byte 1 50
+byte 1 0
+align 1
+LABELV $72
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $71
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $70
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $69
+byte 1 48
+byte 1 0
+align 1
+LABELV $68
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $67
+byte 1 79
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 49
+byte 1 53
+byte 1 32
+byte 1 50
+byte 1 48
+byte 1 50
+byte 1 54
+byte 1 0
+align 1
+LABELV $66
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $65
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $64
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $63
+byte 1 0
+align 1
+LABELV $62
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 0
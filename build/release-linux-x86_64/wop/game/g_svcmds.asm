@@ -0,0 +1,6259 @@
+code
+proc StringToFilter 160 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+LABELV $62
+ADDRLP4 132
+INDIRI4
+ADDRLP4 136
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRLP4 132
+INDIRI4
+ADDRLP4 140
+ADDP4
+CNSTU1 0
+ASGNU1
+LABELV $63
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 4
+LTI4 $62
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+LABELV $66
+ADDRLP4 144
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 48
+LTI4 $72
+ADDRLP4 144
+INDIRI4
+CNSTI4 57
+LEI4 $70
+LABELV $72
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $73
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $75
+ADDRGP4 $68
+JUMPV
+LABELV $75
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $67
+JUMPV
+LABELV $73
+ADDRGP4 $77
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $61
+JUMPV
+LABELV $70
+ADDRLP4 128
+CNSTI4 0
+ASGNI4
+ADDRGP4 $79
+JUMPV
+LABELV $78
+ADDRLP4 148
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 156
+CNSTI4 1
+ASGNI4
+ADDRLP4 128
+ADDRLP4 148
+INDIRI4
+ADDRLP4 156
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 152
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 152
+INDIRP4
+ADDRLP4 156
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 148
+INDIRI4
+ADDRLP4 0
+ADDP4
+ADDRLP4 152
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $79
+ADDRLP4 148
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 48
+LTI4 $81
+ADDRLP4 148
+INDIRI4
+CNSTI4 57
+LEI4 $78
+LABELV $81
+ADDRLP4 128
+INDIRI4
+ADDRLP4 0
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+ARGP4
+ADDRLP4 152
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ADDRLP4 136
+ADDP4
+ADDRLP4 152
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 132
+INDIRI4
+ADDRLP4 140
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $82
+ADDRGP4 $68
+JUMPV
+LABELV $82
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $67
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 4
+LTI4 $66
+LABELV $68
+ADDRFP4 4
+INDIRP4
+ADDRLP4 140
+INDIRU4
+ASGNU4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 136
+INDIRU4
+ASGNU4
+CNSTI4 1
+RETI4
+LABELV $61
+endproc StringToFilter 160 8
+proc UpdateIPBans 348 12
+ADDRLP4 80
+CNSTI1 0
+ASGNI1
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRGP4 $88
+JUMPV
+LABELV $85
+ADDRLP4 76
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 ipFilters+4
+ADDP4
+INDIRU4
+CNSTU4 4294967295
+NEU4 $89
+ADDRGP4 $86
+JUMPV
+LABELV $89
+ADDRLP4 336
+ADDRLP4 76
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 336
+INDIRI4
+ADDRGP4 ipFilters+4
+ADDP4
+INDIRU4
+ASGNU4
+ADDRLP4 68
+ADDRLP4 336
+INDIRI4
+ADDRGP4 ipFilters
+ADDP4
+INDIRU4
+ASGNU4
+ADDRLP4 4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $93
+ADDRLP4 0
+INDIRI4
+ADDRLP4 68
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 255
+EQI4 $97
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $99
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRGP4 $98
+JUMPV
+LABELV $97
+ADDRGP4 $100
+ARGP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 72
+ADDP4
+INDIRU1
+CVUI4 1
+ARGI4
+ADDRLP4 340
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 340
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $98
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+GEI4 $104
+ADDRLP4 344
+ADDRGP4 $101
+ASGNP4
+ADDRGP4 $105
+JUMPV
+LABELV $104
+ADDRLP4 344
+ADDRGP4 $102
+ASGNP4
+LABELV $105
+ADDRLP4 344
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $94
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $93
+ADDRLP4 80
+ARGP4
+ADDRLP4 340
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ARGP4
+ADDRLP4 344
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 340
+INDIRU4
+ADDRLP4 344
+INDIRU4
+ADDU4
+CNSTU4 255
+GEU4 $106
+ADDRLP4 80
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRGP4 $107
+JUMPV
+LABELV $106
+ADDRGP4 $108
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $87
+JUMPV
+LABELV $107
+LABELV $86
+ADDRLP4 76
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $88
+ADDRLP4 76
+INDIRI4
+ADDRGP4 numIPFilters
+INDIRI4
+LTI4 $85
+LABELV $87
+ADDRGP4 $109
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $84
+endproc UpdateIPBans 348 12
+export G_FilterPacket
+proc G_FilterPacket 28 0
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $112
+JUMPV
+LABELV $111
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRGP4 $115
+JUMPV
+LABELV $114
+ADDRLP4 16
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 10
+ADDRLP4 16
+INDIRP4
+INDIRU1
+CVUI4 1
+MULI4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ADDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $115
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 48
+LTI4 $117
+ADDRLP4 16
+INDIRI4
+CNSTI4 57
+LEI4 $114
+LABELV $117
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $120
+ADDRLP4 20
+INDIRI4
+CNSTI4 58
+NEI4 $118
+LABELV $120
+ADDRGP4 $113
+JUMPV
+LABELV $118
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $112
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $121
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LTI4 $111
+LABELV $121
+LABELV $113
+ADDRLP4 12
+ADDRLP4 8
+INDIRU4
+ASGNU4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $125
+JUMPV
+LABELV $122
+ADDRLP4 16
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 12
+INDIRU4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 ipFilters
+ADDP4
+INDIRU4
+BANDU4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 ipFilters+4
+ADDP4
+INDIRU4
+NEU4 $126
+ADDRGP4 g_filterBan+12
+INDIRI4
+CNSTI4 0
+EQI4 $131
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $132
+JUMPV
+LABELV $131
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $132
+ADDRLP4 20
+INDIRI4
+RETI4
+ADDRGP4 $110
+JUMPV
+LABELV $126
+LABELV $123
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $125
+ADDRLP4 4
+INDIRI4
+ADDRGP4 numIPFilters
+INDIRI4
+LTI4 $122
+ADDRGP4 g_filterBan+12
+INDIRI4
+CNSTI4 0
+NEI4 $135
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $136
+JUMPV
+LABELV $135
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+LABELV $136
+ADDRLP4 24
+INDIRI4
+RETI4
+LABELV $110
+endproc G_FilterPacket 28 0
+proc AddIP 8 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $141
+JUMPV
+LABELV $138
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 ipFilters+4
+ADDP4
+INDIRU4
+CNSTU4 4294967295
+NEU4 $142
+ADDRGP4 $140
+JUMPV
+LABELV $142
+LABELV $139
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $141
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numIPFilters
+INDIRI4
+LTI4 $138
+LABELV $140
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numIPFilters
+INDIRI4
+NEI4 $145
+ADDRGP4 numIPFilters
+INDIRI4
+CNSTI4 1024
+NEI4 $147
+ADDRGP4 $149
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $137
+JUMPV
+LABELV $147
+ADDRLP4 4
+ADDRGP4 numIPFilters
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $145
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 ipFilters
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 StringToFilter
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $150
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 ipFilters+4
+ADDP4
+CNSTU4 4294967295
+ASGNU4
+LABELV $150
+ADDRGP4 UpdateIPBans
+CALLV
+pop
+LABELV $137
+endproc AddIP 8 8
+export G_ProcessIPBans
+proc G_ProcessIPBans 276 12
+ADDRLP4 8
+ARGP4
+ADDRGP4 g_banIPs+16
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 264
+ADDRGP4 g_banIPs+16
+ASGNP4
+ADDRLP4 0
+ADDRLP4 264
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 264
+INDIRP4
+ASGNP4
+ADDRGP4 $158
+JUMPV
+LABELV $155
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 268
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 268
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $163
+ADDRGP4 $157
+JUMPV
+LABELV $162
+ADDRLP4 272
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 272
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 272
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $163
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+EQI4 $162
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $165
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 AddIP
+CALLV
+pop
+LABELV $165
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $156
+LABELV $158
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $155
+LABELV $157
+LABELV $153
+endproc G_ProcessIPBans 276 12
+export Svcmd_AddIP_f
+proc Svcmd_AddIP_f 1028 12
+ADDRLP4 1024
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1024
+INDIRI4
+CNSTI4 2
+GEI4 $168
+ADDRGP4 $170
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $167
+JUMPV
+LABELV $168
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 AddIP
+CALLV
+pop
+LABELV $167
+endproc Svcmd_AddIP_f 1028 12
+export Svcmd_RemoveIP_f
+proc Svcmd_RemoveIP_f 1048 12
+ADDRLP4 1036
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 2
+GEI4 $172
+ADDRGP4 $174
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $171
+JUMPV
+LABELV $172
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 StringToFilter
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $175
+ADDRGP4 $171
+JUMPV
+LABELV $175
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $180
+JUMPV
+LABELV $177
+ADDRLP4 1044
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+ADDRGP4 ipFilters
+ADDP4
+INDIRU4
+ADDRLP4 4
+INDIRU4
+NEU4 $181
+ADDRLP4 1044
+INDIRI4
+ADDRGP4 ipFilters+4
+ADDP4
+INDIRU4
+ADDRLP4 4+4
+INDIRU4
+NEU4 $181
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 ipFilters+4
+ADDP4
+CNSTU4 4294967295
+ASGNU4
+ADDRGP4 $186
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 UpdateIPBans
+CALLV
+pop
+ADDRGP4 $171
+JUMPV
+LABELV $181
+LABELV $178
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $180
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numIPFilters
+INDIRI4
+LTI4 $177
+ADDRGP4 $187
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $171
+endproc Svcmd_RemoveIP_f 1048 12
+export Svcmd_EntityList_f
+proc Svcmd_EntityList_f 16 8
+ADDRLP4 0
+ADDRGP4 g_entities+832
+ASGNP4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $193
+JUMPV
+LABELV $190
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $195
+ADDRGP4 $191
+JUMPV
+LABELV $195
+ADDRGP4 $197
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $198
+ADDRLP4 8
+INDIRI4
+CNSTI4 11
+GTI4 $198
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $226
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $226
+address $201
+address $203
+address $205
+address $207
+address $209
+address $211
+address $213
+address $215
+address $217
+address $219
+address $221
+address $223
+code
+LABELV $201
+ADDRGP4 $202
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $199
+JUMPV
+LABELV $203
+ADDRGP4 $204
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $199
+JUMPV
+LABELV $205
+ADDRGP4 $206
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $199
+JUMPV
+LABELV $207
+ADDRGP4 $208
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $199
+JUMPV
+LABELV $209
+ADDRGP4 $210
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $199
+JUMPV
+LABELV $211
+ADDRGP4 $212
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $199
+JUMPV
+LABELV $213
+ADDRGP4 $214
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $199
+JUMPV
+LABELV $215
+ADDRGP4 $216
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $199
+JUMPV
+LABELV $217
+ADDRGP4 $218
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $199
+JUMPV
+LABELV $219
+ADDRGP4 $220
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $199
+JUMPV
+LABELV $221
+ADDRGP4 $222
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $199
+JUMPV
+LABELV $223
+ADDRGP4 $224
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $199
+JUMPV
+LABELV $198
+ADDRGP4 $225
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $199
+ADDRLP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $227
+ADDRGP4 $229
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $227
+ADDRGP4 $230
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $191
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 832
+ADDP4
+ASGNP4
+LABELV $193
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $190
+LABELV $188
+endproc Svcmd_EntityList_f 16 8
+export ClientForString
+proc ClientForString 1048 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1036
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 48
+LTI4 $232
+ADDRLP4 1036
+INDIRI4
+CNSTI4 57
+GTI4 $232
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1040
+INDIRI4
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+LTI4 $237
+ADDRLP4 1044
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $234
+LABELV $237
+ADDRGP4 $238
+ARGP4
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $231
+JUMPV
+LABELV $234
+ADDRLP4 0
+CNSTI4 956
+ADDRLP4 1032
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $239
+ADDRGP4 $241
+ARGP4
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $231
+JUMPV
+LABELV $239
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $231
+JUMPV
+LABELV $232
+ADDRLP4 1028
+CNSTI4 0
+ASGNI4
+ADDRGP4 $245
+JUMPV
+LABELV $242
+ADDRLP4 0
+CNSTI4 956
+ADDRLP4 1028
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $247
+ADDRGP4 $243
+JUMPV
+LABELV $247
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $249
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $231
+JUMPV
+LABELV $249
+ADDRGP4 $251
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $243
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $245
+ADDRLP4 1028
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $242
+ADDRGP4 $252
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+LABELV $231
+endproc ClientForString 1048 12
+proc Svcmd_Say_f 12 16
+ADDRLP4 0
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+GEI4 $254
+ADDRGP4 $256
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $253
+JUMPV
+LABELV $254
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 ConcatArgs
+CALLP4
+ASGNP4
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_Say
+CALLV
+pop
+LABELV $253
+endproc Svcmd_Say_f 12 16
+proc Svcmd_Tell_f 28 16
+ADDRLP4 12
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+GEI4 $258
+ADDRGP4 $260
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $257
+JUMPV
+LABELV $258
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $263
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $261
+LABELV $263
+ADDRGP4 $264
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $257
+JUMPV
+LABELV $261
+ADDRLP4 8
+CNSTI4 832
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $265
+ADDRGP4 $267
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $257
+JUMPV
+LABELV $265
+CNSTI4 2
+ARGI4
+ADDRLP4 24
+ADDRGP4 ConcatArgs
+CALLP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 G_Say
+CALLV
+pop
+LABELV $257
+endproc Svcmd_Tell_f 28 16
+proc Svcmd_ClientCommand_f 44 12
+ADDRLP4 12
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+GEI4 $270
+ADDRGP4 $272
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $269
+JUMPV
+LABELV $270
+ADDRLP4 16
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $276
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+EQI4 $278
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+EQI4 $280
+ADDRGP4 $273
+JUMPV
+LABELV $276
+ADDRLP4 8
+ADDRGP4 $277
+ASGNP4
+ADDRGP4 $274
+JUMPV
+LABELV $278
+ADDRLP4 8
+ADDRGP4 $279
+ASGNP4
+ADDRGP4 $274
+JUMPV
+LABELV $280
+ADDRLP4 8
+ADDRGP4 $281
+ASGNP4
+ADDRGP4 $274
+JUMPV
+LABELV $273
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRGP4 $282
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $274
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $285
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $283
+LABELV $285
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+EQI4 $283
+ADDRGP4 $264
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $269
+JUMPV
+LABELV $283
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+EQI4 $286
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $286
+ADDRGP4 $267
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $269
+JUMPV
+LABELV $286
+CNSTI4 2
+ARGI4
+ADDRLP4 36
+ADDRGP4 ConcatArgs
+CALLP4
+ASGNP4
+ADDRGP4 $288
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $269
+endproc Svcmd_ClientCommand_f 44 12
+export Svcmd_ForceTeam_f
+proc Svcmd_ForceTeam_f 1036 12
+ADDRLP4 1028
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 3
+GEI4 $290
+ADDRGP4 $292
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $289
+JUMPV
+LABELV $290
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1032
+ADDRGP4 ClientForString
+CALLP4
+ASGNP4
+ADDRLP4 1024
+ADDRLP4 1032
+INDIRP4
+ASGNP4
+ADDRLP4 1024
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $293
+ADDRGP4 $289
+JUMPV
+LABELV $293
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+CNSTI4 832
+ADDRLP4 1024
+INDIRP4
+CVPU4 4
+ADDRGP4 level
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 956
+DIVI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 SetTeam
+CALLV
+pop
+LABELV $289
+endproc Svcmd_ForceTeam_f 1036 12
+proc Svcmd_SetGameType_f 20 8
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 ConcatArgs
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 convertGTStringToGTNumber
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+EQI4 $296
+ADDRGP4 $298
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $297
+JUMPV
+LABELV $296
+ADDRGP4 $299
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $297
+LABELV $295
+endproc Svcmd_SetGameType_f 20 8
+export Svcmd_StopCam
+proc Svcmd_StopCam 0 0
+ADDRGP4 level+9476
+CNSTI4 0
+ASGNI4
+LABELV $300
+endproc Svcmd_StopCam 0 0
+export FileExists
+proc FileExists 4 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $303
+CNSTI4 0
+RETI4
+ADDRGP4 $302
+JUMPV
+LABELV $303
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $302
+endproc FileExists 4 12
+export Svcmd_StartCam
+proc Svcmd_StartCam 1164 16
+ADDRLP4 128
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetServerinfo
+CALLV
+pop
+ADDRLP4 128
+ARGP4
+ADDRGP4 $306
+ARGP4
+ADDRLP4 1152
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 1152
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $307
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1156
+ADDRGP4 FileExists
+CALLI4
+ASGNI4
+ADDRLP4 1156
+INDIRI4
+CNSTI4 0
+NEI4 $308
+ADDRGP4 $310
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $305
+JUMPV
+LABELV $308
+ADDRGP4 $311
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1160
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1160
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 level+9476
+CNSTI4 1
+ASGNI4
+LABELV $305
+endproc Svcmd_StartCam 1164 16
+export FreezePlayers
+proc FreezePlayers 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $317
+JUMPV
+LABELV $314
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $319
+ADDRGP4 $315
+JUMPV
+LABELV $319
+CNSTI4 832
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $321
+ADDRGP4 $315
+JUMPV
+LABELV $321
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $327
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRGP4 $328
+JUMPV
+LABELV $327
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $328
+CNSTI4 832
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $315
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $317
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $314
+LABELV $313
+endproc FreezePlayers 8 0
+export Svcmd_CamCmd
+proc Svcmd_CamCmd 3144 12
+ADDRGP4 level+9476
+INDIRI4
+CNSTI4 0
+NEI4 $330
+ADDRGP4 $329
+JUMPV
+LABELV $330
+ADDRLP4 3080
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 3080
+INDIRI4
+CNSTI4 2
+GEI4 $333
+ADDRGP4 $329
+JUMPV
+LABELV $333
+CNSTI4 1
+ARGI4
+ADDRLP4 1028
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 1028
+ARGP4
+ADDRGP4 $281
+ARGP4
+ADDRLP4 3084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3084
+INDIRI4
+CNSTI4 0
+NEI4 $335
+CNSTI4 2
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRGP4 $337
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 3088
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 3088
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $336
+JUMPV
+LABELV $335
+ADDRLP4 1028
+ARGP4
+ADDRGP4 $340
+ARGP4
+ADDRLP4 3088
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3088
+INDIRI4
+CNSTI4 0
+NEI4 $338
+ADDRLP4 3104
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 3104
+INDIRI4
+CNSTI4 8
+EQI4 $341
+ADDRLP4 3108
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 3108
+INDIRI4
+CNSTI4 6
+EQI4 $341
+ADDRGP4 $343
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $329
+JUMPV
+LABELV $341
+CNSTI4 2
+ARGI4
+ADDRLP4 2056
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 2056
+ARGP4
+ADDRLP4 3112
+ADDRGP4 ClientForString
+CALLP4
+ASGNP4
+ADDRLP4 2052
+ADDRLP4 3112
+INDIRP4
+ASGNP4
+ADDRLP4 2052
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $344
+ADDRGP4 $329
+JUMPV
+LABELV $344
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $346
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 3116
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 3092
+ADDP4
+ADDRLP4 3116
+INDIRF4
+ASGNF4
+LABELV $347
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $346
+CNSTI4 832
+ADDRLP4 2052
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRLP4 3092
+ARGP4
+ADDRGP4 G_SetOrigin
+CALLV
+pop
+ADDRLP4 2052
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 3092
+INDIRB
+ASGNB 12
+ADDRLP4 3116
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 3116
+INDIRI4
+CNSTI4 8
+NEI4 $339
+ADDRLP4 3120
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 12
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTI4 6
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 3132
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 3120
+ADDRLP4 3132
+INDIRI4
+CVIF4 4
+ASGNF4
+CNSTI4 7
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 3136
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 3120+4
+ADDRLP4 3136
+INDIRI4
+CVIF4 4
+ASGNF4
+CNSTI4 832
+ADDRLP4 2052
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRLP4 3120
+ARGP4
+ADDRGP4 SetClientViewAngle
+CALLV
+pop
+ADDRGP4 $339
+JUMPV
+LABELV $338
+ADDRLP4 1028
+ARGP4
+ADDRGP4 $355
+ARGP4
+ADDRLP4 3092
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3092
+INDIRI4
+CNSTI4 0
+NEI4 $353
+ADDRLP4 3096
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 3096
+INDIRI4
+CNSTI4 8
+EQI4 $356
+ADDRGP4 $358
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $329
+JUMPV
+LABELV $356
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $359
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 3100
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+9480
+ADDP4
+ADDRLP4 3100
+INDIRF4
+ASGNF4
+LABELV $360
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $359
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $364
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 3100
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+9492
+ADDP4
+ADDRLP4 3100
+INDIRF4
+ASGNF4
+LABELV $365
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $364
+ADDRGP4 $354
+JUMPV
+LABELV $353
+ADDRLP4 1028
+ARGP4
+ADDRGP4 $371
+ARGP4
+ADDRLP4 3096
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3096
+INDIRI4
+CNSTI4 0
+NEI4 $369
+ADDRLP4 3112
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 3112
+INDIRI4
+CNSTI4 6
+EQI4 $372
+ADDRGP4 $374
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $329
+JUMPV
+LABELV $372
+CNSTI4 2
+ARGI4
+ADDRLP4 2056
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $375
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 3116
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 3100
+ADDP4
+ADDRLP4 3116
+INDIRF4
+ASGNF4
+LABELV $376
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $375
+ADDRLP4 2056
+ARGP4
+ADDRLP4 3116
+ADDRGP4 ClientForString
+CALLP4
+ASGNP4
+ADDRLP4 2052
+ADDRLP4 3116
+INDIRP4
+ASGNP4
+ADDRLP4 2052
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $379
+ADDRGP4 $329
+JUMPV
+LABELV $379
+ADDRLP4 2052
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3100
+ARGP4
+ADDRGP4 BotCamMoveTo
+CALLV
+pop
+ADDRGP4 $370
+JUMPV
+LABELV $369
+ADDRLP4 1028
+ARGP4
+ADDRGP4 $383
+ARGP4
+ADDRLP4 3100
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3100
+INDIRI4
+CNSTI4 0
+NEI4 $381
+ADDRLP4 3116
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 3116
+INDIRI4
+CNSTI4 5
+EQI4 $384
+ADDRGP4 $386
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $329
+JUMPV
+LABELV $384
+CNSTI4 2
+ARGI4
+ADDRLP4 2056
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 2056
+ARGP4
+ADDRLP4 3120
+ADDRGP4 ClientForString
+CALLP4
+ASGNP4
+ADDRLP4 2052
+ADDRLP4 3120
+INDIRP4
+ASGNP4
+ADDRLP4 2052
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $387
+ADDRGP4 $329
+JUMPV
+LABELV $387
+CNSTI4 3
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 3124
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 3104
+ADDRLP4 3124
+INDIRI4
+CVIF4 4
+ASGNF4
+CNSTI4 4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 3128
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 3104+4
+ADDRLP4 3128
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 2052
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3104
+ARGP4
+ADDRGP4 BotCamViewangles
+CALLV
+pop
+ADDRGP4 $382
+JUMPV
+LABELV $381
+ADDRLP4 1028
+ARGP4
+ADDRGP4 $392
+ARGP4
+ADDRLP4 3104
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3104
+INDIRI4
+CNSTI4 0
+NEI4 $390
+ADDRLP4 3120
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 3120
+INDIRI4
+CNSTI4 6
+EQI4 $393
+ADDRGP4 $395
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $329
+JUMPV
+LABELV $393
+CNSTI4 2
+ARGI4
+ADDRLP4 2056
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 2056
+ARGP4
+ADDRLP4 3124
+ADDRGP4 ClientForString
+CALLP4
+ASGNP4
+ADDRLP4 2052
+ADDRLP4 3124
+INDIRP4
+ASGNP4
+ADDRLP4 2052
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $396
+ADDRGP4 $329
+JUMPV
+LABELV $396
+CNSTI4 3
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 3128
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 3108
+ADDRLP4 3128
+INDIRI4
+CVIF4 4
+ASGNF4
+CNSTI4 4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 3132
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 3108+4
+ADDRLP4 3132
+INDIRI4
+CVIF4 4
+ASGNF4
+CNSTI4 5
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 3136
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 3108+8
+ADDRLP4 3136
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 2052
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3108
+ARGP4
+ADDRGP4 BotCamViewTarget
+CALLV
+pop
+ADDRGP4 $391
+JUMPV
+LABELV $390
+ADDRLP4 1028
+ARGP4
+ADDRGP4 $402
+ARGP4
+ADDRLP4 3108
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3108
+INDIRI4
+CNSTI4 0
+NEI4 $400
+ADDRLP4 3116
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 3116
+INDIRI4
+CNSTI4 4
+EQI4 $403
+ADDRGP4 $405
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $329
+JUMPV
+LABELV $403
+CNSTI4 2
+ARGI4
+ADDRLP4 2056
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 2056
+ARGP4
+ADDRLP4 3120
+ADDRGP4 ClientForString
+CALLP4
+ASGNP4
+ADDRLP4 2052
+ADDRLP4 3120
+INDIRP4
+ASGNP4
+ADDRLP4 2052
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $406
+ADDRGP4 $329
+JUMPV
+LABELV $406
+CNSTI4 3
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 3124
+ADDRGP4 ClientForString
+CALLP4
+ASGNP4
+ADDRLP4 3112
+ADDRLP4 3124
+INDIRP4
+ASGNP4
+ADDRLP4 3112
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $408
+ADDRGP4 $329
+JUMPV
+LABELV $408
+ADDRLP4 3128
+CNSTI4 140
+ASGNI4
+ADDRLP4 2052
+INDIRP4
+ADDRLP4 3128
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3112
+INDIRP4
+ADDRLP4 3128
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotCamViewEntitiy
+CALLV
+pop
+ADDRGP4 $401
+JUMPV
+LABELV $400
+ADDRLP4 1028
+ARGP4
+ADDRGP4 $412
+ARGP4
+ADDRLP4 3112
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3112
+INDIRI4
+CNSTI4 0
+NEI4 $410
+ADDRLP4 3116
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 3116
+INDIRI4
+CNSTI4 3
+GEI4 $413
+ADDRGP4 $329
+JUMPV
+LABELV $413
+CNSTI4 2
+ARGI4
+ADDRLP4 2056
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 2056
+ARGP4
+ADDRLP4 3120
+ADDRGP4 ClientForString
+CALLP4
+ASGNP4
+ADDRLP4 2052
+ADDRLP4 3120
+INDIRP4
+ASGNP4
+ADDRLP4 2052
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $415
+ADDRGP4 $329
+JUMPV
+LABELV $415
+CNSTI4 832
+ADDRLP4 2052
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 EditPlayerInventory
+CALLV
+pop
+ADDRGP4 $411
+JUMPV
+LABELV $410
+ADDRLP4 1028
+ARGP4
+ADDRGP4 $419
+ARGP4
+ADDRLP4 3116
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3116
+INDIRI4
+CNSTI4 0
+NEI4 $417
+ADDRLP4 3120
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 3120
+INDIRI4
+CNSTI4 4
+EQI4 $420
+ADDRGP4 $422
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $329
+JUMPV
+LABELV $420
+CNSTI4 2
+ARGI4
+ADDRLP4 2056
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 2056
+ARGP4
+ADDRLP4 3124
+ADDRGP4 ClientForString
+CALLP4
+ASGNP4
+ADDRLP4 2052
+ADDRLP4 3124
+INDIRP4
+ASGNP4
+ADDRLP4 2052
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $423
+ADDRGP4 $329
+JUMPV
+LABELV $423
+CNSTI4 3
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 3128
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 2052
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3128
+INDIRI4
+ARGI4
+ADDRGP4 BotChooseWeap
+CALLV
+pop
+ADDRGP4 $418
+JUMPV
+LABELV $417
+ADDRLP4 1028
+ARGP4
+ADDRGP4 $427
+ARGP4
+ADDRLP4 3120
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3120
+INDIRI4
+CNSTI4 0
+NEI4 $425
+ADDRLP4 3124
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 3124
+INDIRI4
+CNSTI4 3
+EQI4 $428
+ADDRGP4 $430
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $329
+JUMPV
+LABELV $428
+CNSTI4 2
+ARGI4
+ADDRLP4 2056
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 2056
+ARGP4
+ADDRLP4 3128
+ADDRGP4 ClientForString
+CALLP4
+ASGNP4
+ADDRLP4 2052
+ADDRLP4 3128
+INDIRP4
+ASGNP4
+ADDRLP4 2052
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $431
+ADDRGP4 $329
+JUMPV
+LABELV $431
+ADDRLP4 2052
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotCamTaunt
+CALLV
+pop
+ADDRGP4 $426
+JUMPV
+LABELV $425
+ADDRLP4 1028
+ARGP4
+ADDRGP4 $435
+ARGP4
+ADDRLP4 3124
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3124
+INDIRI4
+CNSTI4 0
+NEI4 $433
+ADDRLP4 3128
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 3128
+INDIRI4
+CNSTI4 3
+EQI4 $436
+ADDRGP4 $438
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $329
+JUMPV
+LABELV $436
+CNSTI4 2
+ARGI4
+ADDRLP4 2056
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 2056
+ARGP4
+ADDRLP4 3132
+ADDRGP4 ClientForString
+CALLP4
+ASGNP4
+ADDRLP4 2052
+ADDRLP4 3132
+INDIRP4
+ASGNP4
+ADDRLP4 2052
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $439
+ADDRGP4 $329
+JUMPV
+LABELV $439
+ADDRLP4 2052
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotCamFire
+CALLV
+pop
+ADDRGP4 $434
+JUMPV
+LABELV $433
+ADDRLP4 1028
+ARGP4
+ADDRGP4 $443
+ARGP4
+ADDRLP4 3128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3128
+INDIRI4
+CNSTI4 0
+NEI4 $441
+ADDRLP4 3136
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 3136
+INDIRI4
+CNSTI4 3
+EQI4 $444
+ADDRGP4 $446
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $329
+JUMPV
+LABELV $444
+CNSTI4 2
+ARGI4
+ADDRLP4 2056
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 2056
+ARGP4
+ADDRLP4 3140
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 3132
+ADDRLP4 3140
+INDIRI4
+ASGNI4
+ADDRLP4 3132
+INDIRI4
+ARGI4
+ADDRGP4 FreezePlayers
+CALLV
+pop
+LABELV $441
+LABELV $434
+LABELV $426
+LABELV $418
+LABELV $411
+LABELV $401
+LABELV $391
+LABELV $382
+LABELV $370
+LABELV $354
+LABELV $339
+LABELV $336
+LABELV $329
+endproc Svcmd_CamCmd 3144 12
+export ConsoleCommand
+proc ConsoleCommand 3144 12
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $450
+ARGP4
+ADDRLP4 1024
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1024
+INDIRI4
+CNSTI4 0
+NEI4 $448
+ADDRGP4 Svcmd_EntityList_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $447
+JUMPV
+LABELV $448
+ADDRLP4 0
+ARGP4
+ADDRGP4 $453
+ARGP4
+ADDRLP4 1028
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 0
+NEI4 $451
+ADDRGP4 Svcmd_ForceTeam_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $447
+JUMPV
+LABELV $451
+ADDRLP4 0
+ARGP4
+ADDRGP4 $456
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+NEI4 $454
+ADDRGP4 Svcmd_GameMem_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $447
+JUMPV
+LABELV $454
+ADDRLP4 0
+ARGP4
+ADDRGP4 $459
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+NEI4 $457
+ADDRGP4 Svcmd_AddBot_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $447
+JUMPV
+LABELV $457
+ADDRLP4 0
+ARGP4
+ADDRGP4 $462
+ARGP4
+ADDRLP4 1040
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $460
+ADDRGP4 Svcmd_BotList_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $447
+JUMPV
+LABELV $460
+ADDRLP4 0
+ARGP4
+ADDRGP4 $465
+ARGP4
+ADDRLP4 1044
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $463
+ADDRGP4 Svcmd_BotStats_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $447
+JUMPV
+LABELV $463
+ADDRLP4 0
+ARGP4
+ADDRGP4 $468
+ARGP4
+ADDRLP4 1048
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $466
+ADDRGP4 Svcmd_AbortPodium_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $447
+JUMPV
+LABELV $466
+ADDRLP4 0
+ARGP4
+ADDRGP4 $471
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $469
+ADDRGP4 Svcmd_AddIP_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $447
+JUMPV
+LABELV $469
+ADDRLP4 0
+ARGP4
+ADDRGP4 $474
+ARGP4
+ADDRLP4 1056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $472
+ADDRGP4 Svcmd_RemoveIP_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $447
+JUMPV
+LABELV $472
+ADDRLP4 0
+ARGP4
+ADDRGP4 $477
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $475
+CNSTI4 0
+ARGI4
+ADDRGP4 $478
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $447
+JUMPV
+LABELV $475
+ADDRLP4 0
+ARGP4
+ADDRGP4 $481
+ARGP4
+ADDRLP4 1064
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+NEI4 $479
+ADDRGP4 Svcmd_SetGameType_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $447
+JUMPV
+LABELV $479
+ADDRLP4 0
+ARGP4
+ADDRGP4 $484
+ARGP4
+ADDRLP4 1068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+NEI4 $482
+ADDRGP4 Svcmd_StartCam
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $447
+JUMPV
+LABELV $482
+ADDRLP4 0
+ARGP4
+ADDRGP4 $487
+ARGP4
+ADDRLP4 1072
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+NEI4 $485
+ADDRGP4 Svcmd_StopCam
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $447
+JUMPV
+LABELV $485
+ADDRLP4 0
+ARGP4
+ADDRGP4 $490
+ARGP4
+ADDRLP4 1076
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $488
+ADDRGP4 Svcmd_CamCmd
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $447
+JUMPV
+LABELV $488
+ADDRLP4 0
+ARGP4
+ADDRGP4 $493
+ARGP4
+ADDRLP4 1080
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+NEI4 $491
+ADDRGP4 WaypointInit
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $447
+JUMPV
+LABELV $491
+ADDRLP4 0
+ARGP4
+ADDRGP4 $496
+ARGP4
+ADDRLP4 1084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+NEI4 $494
+CNSTI4 1
+ARGI4
+ADDRLP4 2112
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 1088
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 2112
+ARGP4
+ADDRLP4 3136
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 3136
+INDIRU4
+CNSTU4 0
+NEU4 $497
+ADDRGP4 $499
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $447
+JUMPV
+LABELV $497
+ADDRLP4 1088
+ARGP4
+ADDRLP4 3140
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 3140
+INDIRU4
+CNSTU4 0
+NEU4 $500
+ADDRLP4 1088
+ARGP4
+ADDRGP4 $502
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $500
+ADDRLP4 2112
+ARGP4
+ADDRLP4 1088
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $447
+JUMPV
+LABELV $494
+ADDRGP4 g_dedicated+12
+INDIRI4
+CNSTI4 0
+EQI4 $503
+ADDRLP4 0
+ARGP4
+ADDRGP4 $508
+ARGP4
+ADDRLP4 1088
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 0
+NEI4 $506
+ADDRGP4 Svcmd_Say_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $447
+JUMPV
+LABELV $506
+ADDRLP4 0
+ARGP4
+ADDRGP4 $511
+ARGP4
+ADDRLP4 1092
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1092
+INDIRI4
+CNSTI4 0
+NEI4 $509
+ADDRGP4 Svcmd_Tell_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $447
+JUMPV
+LABELV $509
+ADDRLP4 0
+ARGP4
+ADDRGP4 $514
+ARGP4
+ADDRLP4 1096
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+CNSTI4 0
+NEI4 $512
+CNSTI4 1
+ARGI4
+ADDRGP4 Svcmd_ClientCommand_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $447
+JUMPV
+LABELV $512
+ADDRLP4 0
+ARGP4
+ADDRGP4 $517
+ARGP4
+ADDRLP4 1100
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1100
+INDIRI4
+CNSTI4 0
+NEI4 $515
+CNSTI4 0
+ARGI4
+ADDRGP4 Svcmd_ClientCommand_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $447
+JUMPV
+LABELV $515
+ADDRLP4 0
+ARGP4
+ADDRGP4 $520
+ARGP4
+ADDRLP4 1104
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+NEI4 $518
+CNSTI4 2
+ARGI4
+ADDRGP4 Svcmd_ClientCommand_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $447
+JUMPV
+LABELV $518
+CNSTI4 0
+ARGI4
+ADDRLP4 1108
+ADDRGP4 ConcatArgs
+CALLP4
+ASGNP4
+ADDRGP4 $521
+ARGP4
+ADDRLP4 1108
+INDIRP4
+ARGP4
+ADDRLP4 1112
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 1112
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $447
+JUMPV
+LABELV $503
+CNSTI4 0
+RETI4
+LABELV $447
+endproc ConsoleCommand 3144 12
+import WaypointInit
+import EditPlayerInventory
+bss
+align 4
+LABELV numIPFilters
+skip 4
+align 4
+LABELV ipFilters
+skip 8192
+import trap_AAS_BestReachableArea
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntities
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_RealTime
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_EntitiesInPVS
+import trap_RestoreClients
+import trap_RewindClients
+import trap_GetUsercmds
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_TraceBatch
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import g_logDamage
+import g_modInstagib_WeaponJump
+import g_modInstagib
+import g_transmitSVboastermissiles
+import g_KillerduckHealth
+import g_LPS_flags
+import g_LPS_startlives
+import g_skyLensflare
+import g_sky
+import g_q3Items
+import pmove_msec
+import pmove_fixed
+import g_antilag
+import g_smoothClients
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_curWarmupReady
+import g_warmupReady
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import MapSupportsGametype
+import G_GetArenaInfoByMap
+import G_InitGameinfo
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import AI_RemoveBambam
+import AI_AddBambam
+import AI_RemoveBoomie
+import AI_AddBoomie
+import BotCamViewangles
+import BotCamViewTarget
+import BotCamViewEntitiy
+import BotChooseWeap
+import BotCamFire
+import BotCamTaunt
+import BotCamMoveTo
+import BotCamMode
+import BotInterbreedEndMatch
+import Svcmd_BotStats_f
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_LoadBots
+import CantDamageTeamitem
+import boomies_createByPlayer
+import bambam_createByPlayer
+import IsItemSameTeam
+import Instagib_canSpawnEntity
+import Instagib_isRelevantDamageEvent
+import Instagib_calculateDamage
+import Instagib_getSpawnWeapon
+import Instagib_applyWeaponJumpKnockback
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import PrintMsg
+import CheckObeliskAttack
+import Team_GetFlagStatus
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThinkBatch
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogFlush
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import G_GetCvarInt
+import MoveClientToIntermission
+import G_SendScoreboardUpdates
+import DeathmatchScoreboardMessage
+import FireWeapon
+import GetASpawnPosition
+import SelectSpectatorSpawnPoint
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import respawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import Touch_DoorTrigger
+import G_PushablesChanged
+import G_RunMover
+import fire_kma
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_bubbleg
+import fire_bambamMissile
+import fire_duck
+import explode_imperius
+import fire_splasher
+import fire_nipper
+import fire_boaster
+import G_RunExplosion
+import G_RunMissile
+import BerserkerCheck
+import TossClientCubes
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import GametypeNameShort
+import GametypeName
+import RemoveOwnedItems
+import SetAward
+import G_RestorePowerups
+import G_BackupPowerups
+import DeleteDebugLines
+import DebugLineDouble
+import DebugLine
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_NextActiveEntity
+import G_InitEntityLists
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_FindAll
+import G_Find
+import G_EntityIndexChanged
+import G_InitEntityIndex
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import G_Say
+import ConcatArgs
+import Cmd_DropCartridge_f
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $521
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $520
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $517
+byte 1 115
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $514
+byte 1 115
+byte 1 99
+byte 1 112
+byte 1 0
+align 1
+LABELV $511
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $508
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $502
+byte 1 49
+byte 1 0
+align 1
+LABELV $499
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $496
+byte 1 98
+byte 1 108
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $493
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 119
+byte 1 112
+byte 1 0
+align 1
+LABELV $490
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 0
+align 1
+LABELV $487
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $484
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $481
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $478
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 73
+byte 1 80
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $477
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $474
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $471
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $468
+byte 1 97
+byte 1 98
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $465
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $462
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $459
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $456
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 0
+align 1
+LABELV $453
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $450
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $446
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 91
+byte 1 48
+byte 1 124
+byte 1 49
+byte 1 93
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $443
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $438
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $435
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $430
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $427
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $422
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 111
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 73
+byte 1 68
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $419
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 111
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $412
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 0
+align 1
+LABELV $405
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $402
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $395
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 120
+byte 1 32
+byte 1 121
+byte 1 32
+byte 1 122
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $392
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $386
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 120
+byte 1 32
+byte 1 121
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $383
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $374
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 120
+byte 1 32
+byte 1 121
+byte 1 32
+byte 1 122
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $371
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $358
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 120
+byte 1 32
+byte 1 121
+byte 1 32
+byte 1 122
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 98
+byte 1 32
+byte 1 99
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $355
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $343
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 47
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 120
+byte 1 32
+byte 1 121
+byte 1 32
+byte 1 122
+byte 1 32
+byte 1 40
+byte 1 97
+byte 1 32
+byte 1 98
+byte 1 41
+byte 1 32
+byte 1 10
+byte 1 97
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 80
+byte 1 73
+byte 1 84
+byte 1 67
+byte 1 72
+byte 1 45
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 98
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 89
+byte 1 65
+byte 1 87
+byte 1 45
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $340
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $337
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $311
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $310
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $307
+byte 1 99
+byte 1 117
+byte 1 116
+byte 1 115
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 115
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 115
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $306
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $299
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $298
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $292
+byte 1 85
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 60
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $288
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $282
+byte 1 83
+byte 1 118
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 95
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 67
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 102
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 67
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $281
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $279
+byte 1 99
+byte 1 112
+byte 1 0
+align 1
+LABELV $277
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $272
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 36
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 32
+byte 1 60
+byte 1 99
+byte 1 105
+byte 1 100
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $267
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $264
+byte 1 78
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $260
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 60
+byte 1 99
+byte 1 105
+byte 1 100
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $256
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 60
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $252
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $251
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 60
+byte 1 45
+byte 1 62
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $241
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $238
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $230
+byte 1 10
+byte 1 0
+align 1
+LABELV $229
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $225
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $224
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 71
+byte 1 82
+byte 1 65
+byte 1 80
+byte 1 80
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $222
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 73
+byte 1 78
+byte 1 86
+byte 1 73
+byte 1 83
+byte 1 73
+byte 1 66
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $220
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 95
+byte 1 84
+byte 1 82
+byte 1 73
+byte 1 71
+byte 1 71
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 0
+align 1
+LABELV $218
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 80
+byte 1 85
+byte 1 83
+byte 1 72
+byte 1 95
+byte 1 84
+byte 1 82
+byte 1 73
+byte 1 71
+byte 1 71
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $216
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 83
+byte 1 80
+byte 1 69
+byte 1 65
+byte 1 75
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $214
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 65
+byte 1 76
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $212
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 66
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $210
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 77
+byte 1 79
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $208
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $206
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $204
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $202
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 69
+byte 1 82
+byte 1 65
+byte 1 76
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $197
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 58
+byte 1 0
+align 1
+LABELV $187
+byte 1 68
+byte 1 105
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $186
+byte 1 82
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $174
+byte 1 85
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 105
+byte 1 112
+byte 1 32
+byte 1 60
+byte 1 105
+byte 1 112
+byte 1 45
+byte 1 109
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $170
+byte 1 85
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 105
+byte 1 112
+byte 1 32
+byte 1 60
+byte 1 105
+byte 1 112
+byte 1 45
+byte 1 109
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $149
+byte 1 73
+byte 1 80
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 10
+byte 1 0
+align 1
+LABELV $109
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 73
+byte 1 80
+byte 1 115
+byte 1 0
+align 1
+LABELV $108
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 73
+byte 1 80
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 67
+byte 1 86
+byte 1 65
+byte 1 82
+byte 1 95
+byte 1 86
+byte 1 65
+byte 1 76
+byte 1 85
+byte 1 69
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 82
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 10
+byte 1 0
+align 1
+LABELV $102
+byte 1 32
+byte 1 0
+align 1
+LABELV $101
+byte 1 46
+byte 1 0
+align 1
+LABELV $100
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $99
+byte 1 42
+byte 1 0
+align 1
+LABELV $77
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
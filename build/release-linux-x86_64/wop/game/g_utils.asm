@@ -0,0 +1,6019 @@
+data
+export remapCount
+align 4
+LABELV remapCount
+byte 4 0
+export AddRemap
+code
+proc AddRemap 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $66
+JUMPV
+LABELV $63
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 132
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 remappedShaders
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $67
+CNSTI4 132
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 remappedShaders+64
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+CNSTI4 132
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 remappedShaders+128
+ADDP4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 $62
+JUMPV
+LABELV $67
+LABELV $64
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $66
+ADDRLP4 0
+INDIRI4
+ADDRGP4 remapCount
+INDIRI4
+LTI4 $63
+ADDRGP4 remapCount
+INDIRI4
+CNSTI4 128
+GEI4 $71
+CNSTI4 132
+ADDRGP4 remapCount
+INDIRI4
+MULI4
+ADDRGP4 remappedShaders+64
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+CNSTI4 132
+ADDRGP4 remapCount
+INDIRI4
+MULI4
+ADDRGP4 remappedShaders
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+CNSTI4 132
+ADDRGP4 remapCount
+INDIRI4
+MULI4
+ADDRGP4 remappedShaders+128
+ADDP4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRGP4 remapCount
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $71
+LABELV $62
+endproc AddRemap 8 8
+bss
+align 1
+LABELV $76
+skip 4096
+export BuildShaderStateConfig
+code
+proc BuildShaderStateConfig 144 24
+ADDRGP4 $76
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $80
+JUMPV
+LABELV $77
+ADDRLP4 4
+ARGP4
+CNSTI4 133
+ARGI4
+ADDRGP4 $81
+ARGP4
+ADDRLP4 140
+CNSTI4 132
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ADDRGP4 remappedShaders
+ADDP4
+ARGP4
+ADDRLP4 140
+INDIRI4
+ADDRGP4 remappedShaders+64
+ADDP4
+ARGP4
+ADDRLP4 140
+INDIRI4
+ADDRGP4 remappedShaders+128
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $76
+ARGP4
+CNSTI4 4096
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $78
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $80
+ADDRLP4 0
+INDIRI4
+ADDRGP4 remapCount
+INDIRI4
+LTI4 $77
+ADDRGP4 $76
+RETP4
+LABELV $75
+endproc BuildShaderStateConfig 144 24
+proc G_FindConfigstringIndex 1036 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $87
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $85
+LABELV $87
+CNSTI4 0
+RETI4
+ADDRGP4 $84
+JUMPV
+LABELV $85
+ADDRLP4 1024
+CNSTI4 1
+ASGNI4
+ADDRGP4 $91
+JUMPV
+LABELV $88
+ADDRFP4 4
+INDIRI4
+ADDRLP4 1024
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $92
+ADDRGP4 $90
+JUMPV
+LABELV $92
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+NEI4 $94
+ADDRLP4 1024
+INDIRI4
+RETI4
+ADDRGP4 $84
+JUMPV
+LABELV $94
+LABELV $89
+ADDRLP4 1024
+ADDRLP4 1024
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $91
+ADDRLP4 1024
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $88
+LABELV $90
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $96
+CNSTI4 0
+RETI4
+ADDRGP4 $84
+JUMPV
+LABELV $96
+ADDRLP4 1024
+INDIRI4
+ADDRFP4 8
+INDIRI4
+NEI4 $98
+ADDRGP4 $100
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $98
+ADDRFP4 4
+INDIRI4
+ADDRLP4 1024
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRLP4 1024
+INDIRI4
+RETI4
+LABELV $84
+endproc G_FindConfigstringIndex 1036 12
+export G_ModelIndex
+proc G_ModelIndex 4 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 256
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ADDRGP4 G_FindConfigstringIndex
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $101
+endproc G_ModelIndex 4 16
+export G_SoundIndex
+proc G_SoundIndex 4 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 288
+ARGI4
+CNSTI4 256
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ADDRGP4 G_FindConfigstringIndex
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $102
+endproc G_SoundIndex 4 16
+export G_TeamCommand
+proc G_TeamCommand 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $107
+JUMPV
+LABELV $104
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $109
+CNSTI4 956
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 628
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $111
+ADDRGP4 $113
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $111
+LABELV $109
+LABELV $105
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $107
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+LTI4 $104
+LABELV $103
+endproc G_TeamCommand 8 8
+proc G_EntityIndexField 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 524
+NEU4 $116
+CNSTI4 0
+RETI4
+ADDRGP4 $115
+JUMPV
+LABELV $116
+ADDRFP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 664
+NEU4 $118
+CNSTI4 1
+RETI4
+ADDRGP4 $115
+JUMPV
+LABELV $118
+ADDRFP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 660
+NEU4 $120
+CNSTI4 2
+RETI4
+ADDRGP4 $115
+JUMPV
+LABELV $120
+CNSTI4 -1
+RETI4
+LABELV $115
+endproc G_EntityIndexField 0 0
+proc G_EntityIndexHash 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTU4 0
+ASGNU4
+ADDRGP4 $126
+JUMPV
+LABELV $123
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 97
+LTI4 $127
+ADDRLP4 0
+INDIRI4
+CNSTI4 122
+GTI4 $127
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+SUBI4
+ASGNI4
+LABELV $127
+ADDRLP4 4
+CNSTU4 31
+ADDRLP4 4
+INDIRU4
+MULU4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+ADDU4
+ASGNU4
+LABELV $124
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $126
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $123
+ADDRLP4 4
+INDIRU4
+ADDRLP4 4
+INDIRU4
+CNSTI4 10
+RSHU4
+BXORU4
+CNSTU4 255
+BANDU4
+CVUI4 4
+RETI4
+LABELV $122
+endproc G_EntityIndexHash 12 0
+export G_InitEntityIndex
+proc G_InitEntityIndex 16 12
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRGP4 entityIndex
+ASGNP4
+ADDRGP4 $133
+JUMPV
+LABELV $130
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $134
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $135
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $134
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $138
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 9216
+ADDP4
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 13312
+ADDP4
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $139
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $138
+LABELV $131
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 17408
+ADDP4
+ASGNP4
+LABELV $133
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+LTI4 $130
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 entityIndexNumChanged
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 entityIndexIsChanged
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+CNSTU4 4096
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+LABELV $129
+endproc G_InitEntityIndex 16 12
+export G_EntityIndexChanged
+proc G_EntityIndexChanged 12 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 entityIndexChangeTime
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 entityIndexIsChanged
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $144
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 entityIndexIsChanged
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ADDRGP4 entityIndexNumChanged
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 entityIndexChanged
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $144
+LABELV $142
+endproc G_EntityIndexChanged 12 0
+proc G_IndexEntityField 60 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 832
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 13312
+ADDP4
+ADDP4
+INDIRP4
+CVPU4 4
+NEU4 $147
+ADDRGP4 $146
+JUMPV
+LABELV $147
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 9216
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $149
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5120
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $151
+ADDRLP4 16
+CNSTI4 2
+ASGNI4
+ADDRLP4 20
+ADDRFP4 8
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5120
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRLP4 28
+INDIRP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 28
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $152
+JUMPV
+LABELV $151
+ADDRLP4 32
+CNSTI4 2
+ASGNI4
+ADDRLP4 36
+ADDRFP4 8
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 9216
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRLP4 36
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $152
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $153
+ADDRLP4 44
+CNSTI4 2
+ASGNI4
+ADDRLP4 48
+ADDRFP4 8
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 5120
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LSHI4
+ADDRLP4 56
+INDIRP4
+ADDP4
+ADDRLP4 48
+INDIRI4
+ADDRLP4 56
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $153
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 9216
+ADDP4
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $149
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 13312
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $155
+ADDRGP4 $146
+JUMPV
+LABELV $155
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 G_EntityIndexHash
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 9216
+ADDP4
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5120
+ADDP4
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRGP4 $160
+JUMPV
+LABELV $157
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5120
+ADDP4
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+LABELV $158
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+ADDP4
+ASGNP4
+LABELV $160
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 -1
+EQI4 $161
+ADDRLP4 20
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $157
+LABELV $161
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 -1
+EQI4 $162
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5120
+ADDP4
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+LABELV $162
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+LABELV $146
+endproc G_IndexEntityField 60 4
+proc G_UpdateEntityIndex 20 12
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $168
+JUMPV
+LABELV $165
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 entityIndexChanged
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 entityIndex
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 G_IndexEntityField
+CALLV
+pop
+ADDRGP4 entityIndex+17408
+ARGP4
+CNSTI4 664
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 G_IndexEntityField
+CALLV
+pop
+ADDRGP4 entityIndex+34816
+ARGP4
+CNSTI4 660
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 G_IndexEntityField
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 entityIndexChangeTime
+ADDP4
+INDIRI4
+ADDRGP4 level+68
+INDIRI4
+LTI4 $171
+ADDRLP4 16
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 entityIndexChanged
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $172
+JUMPV
+LABELV $171
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 entityIndexIsChanged
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $172
+LABELV $166
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $168
+ADDRLP4 4
+INDIRI4
+ADDRGP4 entityIndexNumChanged
+INDIRI4
+LTI4 $165
+ADDRGP4 entityIndexNumChanged
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $164
+endproc G_UpdateEntityIndex 20 12
+export G_Find
+proc G_Find 36 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 G_EntityIndexField
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 -1
+EQI4 $175
+ADDRGP4 G_UpdateEntityIndex
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $178
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $179
+JUMPV
+LABELV $178
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $179
+ADDRLP4 12
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 G_EntityIndexHash
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 17408
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 entityIndex
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $183
+JUMPV
+LABELV $180
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+GEI4 $185
+ADDRGP4 $181
+JUMPV
+LABELV $185
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $187
+ADDRGP4 $182
+JUMPV
+LABELV $187
+ADDRFP4 0
+CNSTI4 832
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $190
+ADDRGP4 $181
+JUMPV
+LABELV $190
+ADDRLP4 0
+ADDRFP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $192
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $192
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $174
+JUMPV
+LABELV $192
+LABELV $181
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 17408
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 entityIndex+1024
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $183
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+NEI4 $180
+LABELV $182
+CNSTP4 0
+RETP4
+ADDRGP4 $174
+JUMPV
+LABELV $175
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $194
+ADDRFP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRGP4 $199
+JUMPV
+LABELV $194
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 832
+ADDP4
+ASGNP4
+ADDRGP4 $199
+JUMPV
+LABELV $196
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $201
+ADDRGP4 $197
+JUMPV
+LABELV $201
+ADDRLP4 0
+ADDRFP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $203
+ADDRGP4 $197
+JUMPV
+LABELV $203
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $205
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $174
+JUMPV
+LABELV $205
+LABELV $197
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 832
+ADDP4
+ASGNP4
+LABELV $199
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTI4 832
+ADDRGP4 level+12
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+CVPU4 4
+LTU4 $196
+CNSTP4 0
+RETP4
+LABELV $174
+endproc G_Find 36 8
+export G_FindAll
+proc G_FindAll 20 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $211
+JUMPV
+LABELV $208
+ADDRLP4 12
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $209
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+LABELV $211
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $212
+ADDRLP4 4
+INDIRI4
+ADDRFP4 12
+INDIRI4
+LTI4 $208
+LABELV $212
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $207
+endproc G_FindAll 20 12
+export G_PickTarget
+proc G_PickTarget 140 16
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $214
+ADDRGP4 $216
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $213
+JUMPV
+LABELV $214
+CNSTI4 664
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 132
+ADDRGP4 G_FindAll
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $217
+ADDRGP4 $219
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $213
+JUMPV
+LABELV $217
+ADDRLP4 136
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MODI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRP4
+RETP4
+LABELV $213
+endproc G_PickTarget 140 16
+export G_UseTargets
+proc G_UseTargets 24 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $221
+ADDRGP4 $220
+JUMPV
+LABELV $221
+ADDRLP4 8
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRU4
+EQU4 $223
+ADDRFP4 0
+INDIRP4
+CNSTI4 676
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRU4
+EQU4 $223
+ADDRLP4 12
+CNSTF4 981668463
+ADDRGP4 level+68
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 676
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRGP4 AddRemap
+CALLV
+pop
+ADDRLP4 20
+ADDRGP4 BuildShaderStateConfig
+CALLP4
+ASGNP4
+CNSTI4 24
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $223
+ADDRFP4 0
+INDIRP4
+CNSTI4 660
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $226
+ADDRGP4 $220
+JUMPV
+LABELV $226
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $229
+JUMPV
+LABELV $228
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+NEU4 $231
+ADDRGP4 $233
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $232
+JUMPV
+LABELV $231
+ADDRLP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $234
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $234
+LABELV $232
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $236
+ADDRGP4 $238
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $220
+JUMPV
+LABELV $236
+LABELV $229
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 664
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 660
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $228
+LABELV $220
+endproc G_UseTargets 24 12
+bss
+align 4
+LABELV $240
+skip 4
+align 4
+LABELV $241
+skip 96
+export tv
+code
+proc tv 12 0
+ADDRLP4 4
+ADDRGP4 $240
+ASGNP4
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 $241
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 7
+BANDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $239
+endproc tv 12 0
+bss
+align 4
+LABELV $243
+skip 4
+align 1
+LABELV $244
+skip 256
+export vtos
+code
+proc vtos 16 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 $243
+ASGNP4
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 $244
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 7
+BANDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $245
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $242
+endproc vtos 16 24
+data
+align 4
+LABELV $247
+byte 4 0
+byte 4 3212836864
+byte 4 0
+align 4
+LABELV $248
+byte 4 0
+byte 4 0
+byte 4 1065353216
+align 4
+LABELV $249
+byte 4 0
+byte 4 3221225472
+byte 4 0
+align 4
+LABELV $250
+byte 4 0
+byte 4 0
+byte 4 3212836864
+export G_SetMovedir
+code
+proc G_SetMovedir 16 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $247
+ARGP4
+ADDRLP4 0
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $251
+ADDRFP4 4
+INDIRP4
+ADDRGP4 $248
+INDIRB
+ASGNB 12
+ADDRGP4 $252
+JUMPV
+LABELV $251
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $249
+ARGP4
+ADDRLP4 4
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $253
+ADDRFP4 4
+INDIRP4
+ADDRGP4 $250
+INDIRB
+ASGNB 12
+ADDRGP4 $254
+JUMPV
+LABELV $253
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+LABELV $254
+LABELV $252
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $246
+endproc G_SetMovedir 16 16
+export vectoyaw
+proc vectoyaw 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+NEF4 $256
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+NEF4 $256
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRGP4 $257
+JUMPV
+LABELV $256
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 0
+EQF4 $258
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1127481344
+ADDRLP4 16
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ASGNF4
+ADDRGP4 $259
+JUMPV
+LABELV $258
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+LEF4 $260
+ADDRLP4 0
+CNSTF4 1119092736
+ASGNF4
+ADDRGP4 $261
+JUMPV
+LABELV $260
+ADDRLP4 0
+CNSTF4 1132920832
+ASGNF4
+LABELV $261
+LABELV $259
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $262
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $262
+LABELV $257
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $255
+endproc vectoyaw 20 8
+export G_InitEntityLists
+proc G_InitEntityLists 4 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 freeEntityHead
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 freeEntityCount
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 freeEntityQueued
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTU4 4096
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 activeEntities
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 128
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+LABELV $264
+endproc G_InitEntityLists 4 12
+export G_NextActiveEntity
+proc G_NextActiveEntity 28 0
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $267
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $268
+JUMPV
+LABELV $267
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $268
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $272
+JUMPV
+LABELV $269
+CNSTI4 832
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+520
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $274
+CNSTI4 832
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+RETP4
+ADDRGP4 $265
+JUMPV
+LABELV $274
+LABELV $270
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $272
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+GEI4 $277
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $269
+LABELV $277
+ADDRGP4 $279
+JUMPV
+LABELV $278
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+RSHI4
+CNSTI4 2
+LSHI4
+ADDRGP4 activeEntities
+ADDP4
+INDIRU4
+ADDRLP4 0
+INDIRI4
+CNSTI4 31
+BANDI4
+RSHU4
+ASGNU4
+ADDRLP4 4
+INDIRU4
+CNSTU4 0
+NEU4 $285
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 31
+BORI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $279
+JUMPV
+LABELV $284
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRU4
+ADDRLP4 20
+INDIRI4
+RSHU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $285
+ADDRLP4 4
+INDIRU4
+CNSTU4 1
+BANDU4
+CNSTU4 0
+EQU4 $284
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $287
+ADDRGP4 $280
+JUMPV
+LABELV $287
+CNSTI4 832
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+520
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $290
+CNSTI4 832
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+RETP4
+ADDRGP4 $265
+JUMPV
+LABELV $290
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+RSHI4
+CNSTI4 2
+LSHI4
+ADDRGP4 activeEntities
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDRLP4 0
+INDIRI4
+CNSTI4 31
+BANDI4
+LSHU4
+BCOMU4
+BANDU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $279
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $278
+LABELV $280
+CNSTP4 0
+RETP4
+LABELV $265
+endproc G_NextActiveEntity 28 0
+export G_InitGentity
+proc G_InitGentity 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRGP4 $294
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+CNSTI4 1023
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+CNSTI4 1023
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $295
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+RSHI4
+CNSTI4 2
+LSHI4
+ADDRGP4 activeEntities
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDRLP4 4
+INDIRI4
+CNSTI4 31
+BANDI4
+LSHU4
+BORU4
+ASGNU4
+LABELV $295
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_EntityIndexChanged
+CALLV
+pop
+ADDRGP4 G_PushablesChanged
+CALLV
+pop
+LABELV $293
+endproc G_InitGentity 12 4
+export G_Spawn
+proc G_Spawn 32 20
+ADDRGP4 $299
+JUMPV
+LABELV $298
+ADDRLP4 0
+CNSTI4 832
+ADDRGP4 freeEntityHead
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 freeEntities
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $301
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 level+76
+INDIRI4
+CNSTI4 2000
+ADDI4
+LEI4 $301
+ADDRGP4 level+68
+INDIRI4
+ADDRLP4 12
+INDIRI4
+SUBI4
+CNSTI4 1000
+GEI4 $301
+ADDRGP4 level+12
+INDIRI4
+CNSTI4 1022
+GEI4 $301
+ADDRGP4 $300
+JUMPV
+LABELV $301
+ADDRLP4 16
+CNSTI4 2
+ASGNI4
+ADDRGP4 freeEntityHead
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 freeEntities
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 freeEntityQueued
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+ADDRGP4 freeEntityHead
+ASGNP4
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+CNSTI4 1024
+MODI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 freeEntityCount
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $306
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_InitGentity
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $297
+JUMPV
+LABELV $306
+LABELV $299
+ADDRGP4 freeEntityCount
+INDIRI4
+CNSTI4 0
+NEI4 $298
+LABELV $300
+ADDRGP4 level+12
+INDIRI4
+CNSTI4 1022
+NEI4 $308
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $311
+ADDRGP4 $315
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 832
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+524
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $312
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1024
+LTI4 $311
+ADDRGP4 $317
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $308
+ADDRLP4 0
+CNSTI4 832
+ADDRGP4 level+12
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRGP4 level+12
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 level+4
+INDIRP4
+ARGP4
+ADDRGP4 level+12
+INDIRI4
+ARGI4
+CNSTI4 832
+ARGI4
+ADDRGP4 level
+INDIRP4
+ARGP4
+CNSTI4 956
+ARGI4
+ADDRGP4 trap_LocateGameData
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_InitGentity
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $297
+endproc G_Spawn 32 20
+export G_EntitiesFree
+proc G_EntitiesFree 4 0
+ADDRGP4 level+12
+INDIRI4
+CNSTI4 1022
+LTI4 $327
+ADDRGP4 freeEntityCount
+INDIRI4
+CNSTI4 0
+LEI4 $325
+LABELV $327
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $326
+JUMPV
+LABELV $325
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $326
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $322
+endproc G_EntitiesFree 4 0
+export G_FreeEntity
+proc G_FreeEntity 12 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $329
+ADDRGP4 $328
+JUMPV
+LABELV $329
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 832
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRGP4 $331
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_EntityIndexChanged
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 832
+DIVI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $333
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 freeEntityQueued
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $333
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 freeEntityQueued
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 freeEntityHead
+INDIRI4
+ADDRGP4 freeEntityCount
+INDIRI4
+ADDI4
+CNSTI4 1024
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 freeEntities
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 freeEntityCount
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $333
+LABELV $328
+endproc G_FreeEntity 12 12
+export G_TempEntity
+proc G_TempEntity 20 8
+ADDRLP4 16
+ADDRGP4 G_Spawn
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRGP4 $336
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4+4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_SetOrigin
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $335
+endproc G_TempEntity 20 8
+export G_KillBox
+proc G_KillBox 4168 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4136
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ASGNP4
+ADDRLP4 4108
+ADDRLP4 4136
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4108+4
+ADDRLP4 4136
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4108+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4148
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ASGNP4
+ADDRLP4 4120
+ADDRLP4 4148
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4120+4
+ADDRLP4 4148
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4120+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 456
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4108
+ARGP4
+ADDRLP4 4120
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 4156
+ADDRGP4 trap_EntitiesInBox
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 4156
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $350
+JUMPV
+LABELV $347
+ADDRLP4 4
+CNSTI4 832
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $351
+ADDRGP4 $348
+JUMPV
+LABELV $351
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4164
+CNSTP4 0
+ASGNP4
+ADDRLP4 4164
+INDIRP4
+ARGP4
+ADDRLP4 4164
+INDIRP4
+ARGP4
+CNSTI4 100000
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTI4 20
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+LABELV $348
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $350
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $347
+LABELV $342
+endproc G_KillBox 4168 32
+export G_AddPredictableEvent
+proc G_AddPredictableEvent 0 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $354
+ADDRGP4 $353
+JUMPV
+LABELV $354
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BG_AddPredictableEventToPlayerstate
+CALLV
+pop
+LABELV $353
+endproc G_AddPredictableEvent 0 12
+export G_AddEvent
+proc G_AddEvent 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $357
+ADDRGP4 $359
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $356
+JUMPV
+LABELV $357
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $360
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 128
+ASGNI4
+ADDRLP4 12
+CNSTI4 768
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+BANDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+ADDI4
+ADDRLP4 12
+INDIRI4
+BANDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+ADDRGP4 $361
+JUMPV
+LABELV $360
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 768
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+ADDI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+LABELV $361
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+LABELV $356
+endproc G_AddEvent 16 8
+export G_Sound
+proc G_Sound 8 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 52
+ARGI4
+ADDRLP4 4
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+LABELV $364
+endproc G_Sound 8 8
+export G_SetOrigin
+proc G_SetOrigin 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+LABELV $365
+endproc G_SetOrigin 8 0
+lit
+align 4
+LABELV $367
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export DebugLine
+code
+proc DebugLine 120 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 72
+ADDRGP4 $367
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+24
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+36
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 60
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 100
+CNSTI4 4
+ASGNI4
+ADDRLP4 60+4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 104
+CNSTI4 8
+ASGNI4
+ADDRLP4 60+8
+ADDRFP4 4
+INDIRP4
+ADDRLP4 104
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 104
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 60
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 84
+ADDRLP4 60
+INDIRF4
+ADDRLP4 72
+INDIRF4
+MULF4
+ADDRLP4 60+4
+INDIRF4
+ADDRLP4 72+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 60+8
+INDIRF4
+ADDRLP4 72+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 84
+INDIRF4
+CNSTF4 1065185444
+GTF4 $379
+ADDRLP4 84
+INDIRF4
+CNSTF4 3212669092
+GEF4 $377
+LABELV $379
+ADDRLP4 48
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 48+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 48+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $378
+JUMPV
+LABELV $377
+ADDRLP4 60
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+LABELV $378
+ADDRLP4 48
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 112
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 112
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 112
+INDIRF4
+ADDRLP4 48+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 48+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+12
+ADDRLP4 0+12
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 48
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+12+4
+ADDRLP4 0+12+4
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 48+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+12+8
+ADDRLP4 0+12+8
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 48+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24
+ADDRLP4 0+24
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 48
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRLP4 0+24+4
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 48+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+8
+ADDRLP4 0+24+8
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 48+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+36
+ADDRLP4 0+36
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 48
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+36+4
+ADDRLP4 0+36+4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 48+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+36+8
+ADDRLP4 0+36+8
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 48+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 116
+ADDRGP4 trap_DebugPolygonCreate
+CALLI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+RETI4
+LABELV $366
+endproc DebugLine 120 12
+lit
+align 4
+LABELV $425
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export DebugLineDouble
+code
+proc DebugLineDouble 168 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 48
+ADDRGP4 $425
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+24
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+36
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 120
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 148
+CNSTI4 4
+ASGNI4
+ADDRLP4 120+4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 148
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 148
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 152
+CNSTI4 8
+ASGNI4
+ADDRLP4 120+8
+ADDRFP4 4
+INDIRP4
+ADDRLP4 152
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 152
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 132
+ADDRLP4 120
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+ADDRLP4 120+4
+INDIRF4
+ADDRLP4 48+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 120+8
+INDIRF4
+ADDRLP4 48+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 132
+INDIRF4
+CNSTF4 1065185444
+GTF4 $437
+ADDRLP4 132
+INDIRF4
+CNSTF4 3212669092
+GEF4 $435
+LABELV $437
+ADDRLP4 60
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 60+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 60+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $436
+JUMPV
+LABELV $435
+ADDRLP4 120
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRLP4 60
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+LABELV $436
+ADDRLP4 60
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 160
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 72
+ADDRLP4 0
+INDIRF4
+ADDRLP4 160
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 160
+INDIRF4
+ADDRLP4 48+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 48+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72+12
+ADDRLP4 0+12
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 48
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72+12+4
+ADDRLP4 0+12+4
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 48+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72+12+8
+ADDRLP4 0+12+8
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 48+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72+24
+ADDRLP4 0+24
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 48
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72+24+4
+ADDRLP4 0+24+4
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 48+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72+24+8
+ADDRLP4 0+24+8
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 48+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72+36
+ADDRLP4 0+36
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 48
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72+36+4
+ADDRLP4 0+36+4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 48+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72+36+8
+ADDRLP4 0+36+8
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 48+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 164
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 164
+INDIRF4
+ADDRLP4 60
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 164
+INDIRF4
+ADDRLP4 60+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 60+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+12
+ADDRLP4 0+12
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 60
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+12+4
+ADDRLP4 0+12+4
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 60+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+12+8
+ADDRLP4 0+12+8
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 60+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24
+ADDRLP4 0+24
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 60
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRLP4 0+24+4
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 60+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+8
+ADDRLP4 0+24+8
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 60+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+36
+ADDRLP4 0+36
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 60
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+36+4
+ADDRLP4 0+36+4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 60+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+36+8
+ADDRLP4 0+36+8
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 60+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_DebugPolygonCreate
+CALLI4
+pop
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 72
+ARGP4
+ADDRGP4 trap_DebugPolygonCreate
+CALLI4
+pop
+LABELV $424
+endproc DebugLineDouble 168 12
+export DeleteDebugLines
+proc DeleteDebugLines 108 12
+ADDRGP4 $525
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 100
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $529
+JUMPV
+LABELV $526
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_DebugPolygonDelete
+CALLV
+pop
+LABELV $527
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $529
+ADDRLP4 4
+ARGP4
+ADDRLP4 104
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 104
+INDIRI4
+LTI4 $526
+LABELV $524
+endproc DeleteDebugLines 108 12
+proc AwardName 48 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 65536
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $542
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+GTI4 $554
+LABELV $553
+ADDRLP4 20
+CNSTI4 64
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $536
+ADDRLP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+GTI4 $556
+LABELV $555
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+EQI4 $534
+ADDRGP4 $531
+JUMPV
+LABELV $556
+ADDRLP4 28
+CNSTI4 2048
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $538
+ADDRLP4 4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LTI4 $531
+LABELV $557
+ADDRLP4 4
+INDIRI4
+CNSTI4 32768
+EQI4 $540
+ADDRGP4 $531
+JUMPV
+LABELV $554
+ADDRLP4 36
+CNSTI4 262144
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $546
+ADDRLP4 4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+GTI4 $559
+LABELV $558
+ADDRLP4 4
+INDIRI4
+CNSTI4 131072
+EQI4 $544
+ADDRGP4 $531
+JUMPV
+LABELV $559
+ADDRLP4 44
+CNSTI4 2097152
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+EQI4 $548
+ADDRLP4 4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LTI4 $531
+LABELV $560
+ADDRLP4 4
+INDIRI4
+CNSTI4 4194304
+EQI4 $550
+ADDRGP4 $531
+JUMPV
+LABELV $534
+ADDRLP4 0
+ADDRGP4 $535
+ASGNP4
+ADDRGP4 $532
+JUMPV
+LABELV $536
+ADDRLP4 0
+ADDRGP4 $537
+ASGNP4
+ADDRGP4 $532
+JUMPV
+LABELV $538
+ADDRLP4 0
+ADDRGP4 $539
+ASGNP4
+ADDRGP4 $532
+JUMPV
+LABELV $540
+ADDRLP4 0
+ADDRGP4 $541
+ASGNP4
+ADDRGP4 $532
+JUMPV
+LABELV $542
+ADDRLP4 0
+ADDRGP4 $543
+ASGNP4
+ADDRGP4 $532
+JUMPV
+LABELV $544
+ADDRLP4 0
+ADDRGP4 $545
+ASGNP4
+ADDRGP4 $532
+JUMPV
+LABELV $546
+ADDRLP4 0
+ADDRGP4 $547
+ASGNP4
+ADDRGP4 $532
+JUMPV
+LABELV $548
+ADDRLP4 0
+ADDRGP4 $549
+ASGNP4
+ADDRGP4 $532
+JUMPV
+LABELV $550
+ADDRLP4 0
+ADDRGP4 $551
+ASGNP4
+ADDRGP4 $532
+JUMPV
+LABELV $531
+ADDRLP4 0
+ADDRGP4 $552
+ASGNP4
+LABELV $532
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $530
+endproc AwardName 48 0
+export SetAward
+proc SetAward 12 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $562
+ADDRGP4 $561
+JUMPV
+LABELV $562
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 -6522953
+BANDI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 848
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 4000
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 AwardName
+CALLP4
+ASGNP4
+ADDRGP4 $565
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 level
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 956
+DIVI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+LABELV $561
+endproc SetAward 12 12
+export RemoveOwnedItems
+proc RemoveOwnedItems 20 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 64
+ASGNI4
+ADDRLP4 0
+CNSTI4 832
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRGP4 $570
+JUMPV
+LABELV $567
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $572
+ADDRGP4 $568
+JUMPV
+LABELV $572
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 16
+EQI4 $577
+ADDRLP4 12
+INDIRI4
+CNSTI4 17
+EQI4 $577
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+NEI4 $574
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 13
+NEI4 $574
+LABELV $577
+ADDRLP4 0
+INDIRP4
+CNSTI4 600
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+NEU4 $578
+ADDRLP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $580
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 999
+ARGI4
+CNSTI4 22
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $580
+LABELV $578
+LABELV $574
+LABELV $568
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 832
+ADDP4
+ASGNP4
+LABELV $570
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $567
+LABELV $566
+endproc RemoveOwnedItems 20 20
+data
+align 4
+LABELV gametypeNames
+address $582
+address $583
+address $584
+address $585
+address $586
+address $587
+address $588
+address $589
+address $590
+export GametypeName
+code
+proc GametypeName 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $594
+ADDRFP4 0
+INDIRI4
+CNSTI4 9
+LTI4 $592
+LABELV $594
+ADDRGP4 $595
+RETP4
+ADDRGP4 $591
+JUMPV
+LABELV $592
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 gametypeNames
+ADDP4
+INDIRP4
+RETP4
+LABELV $591
+endproc GametypeName 4 0
+data
+align 4
+LABELV gametypeNamesShort
+address $596
+address $597
+address $598
+address $599
+address $600
+address $601
+address $602
+address $603
+address $604
+export GametypeNameShort
+code
+proc GametypeNameShort 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $608
+ADDRFP4 0
+INDIRI4
+CNSTI4 9
+LTI4 $606
+LABELV $608
+ADDRGP4 $595
+RETP4
+ADDRGP4 $605
+JUMPV
+LABELV $606
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 gametypeNamesShort
+ADDP4
+INDIRP4
+RETP4
+LABELV $605
+endproc GametypeNameShort 4 0
+export G_BackupPowerups
+proc G_BackupPowerups 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $613
+JUMPV
+LABELV $610
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 892
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $611
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $613
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 16
+LTU4 $610
+LABELV $609
+endproc G_BackupPowerups 12 0
+export G_RestorePowerups
+proc G_RestorePowerups 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $618
+JUMPV
+LABELV $615
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 892
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 892
+ADDP4
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $616
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $618
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 16
+LTU4 $615
+LABELV $614
+endproc G_RestorePowerups 12 0
+bss
+align 4
+LABELV activeEntities
+skip 128
+align 4
+LABELV freeEntityQueued
+skip 4096
+align 4
+LABELV freeEntityCount
+skip 4
+align 4
+LABELV freeEntityHead
+skip 4
+align 4
+LABELV freeEntities
+skip 4096
+align 4
+LABELV entityIndexIsChanged
+skip 4096
+align 4
+LABELV entityIndexChangeTime
+skip 4096
+align 4
+LABELV entityIndexNumChanged
+skip 4
+align 4
+LABELV entityIndexChanged
+skip 4096
+align 4
+LABELV entityIndex
+skip 52224
+export remappedShaders
+align 4
+LABELV remappedShaders
+skip 16896
+import trap_AAS_BestReachableArea
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntities
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_RealTime
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_EntitiesInPVS
+import trap_RestoreClients
+import trap_RewindClients
+import trap_GetUsercmds
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_TraceBatch
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import g_logDamage
+import g_modInstagib_WeaponJump
+import g_modInstagib
+import g_transmitSVboastermissiles
+import g_KillerduckHealth
+import g_LPS_flags
+import g_LPS_startlives
+import g_skyLensflare
+import g_sky
+import g_q3Items
+import pmove_msec
+import pmove_fixed
+import g_antilag
+import g_smoothClients
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_curWarmupReady
+import g_warmupReady
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import MapSupportsGametype
+import G_GetArenaInfoByMap
+import G_InitGameinfo
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import AI_RemoveBambam
+import AI_AddBambam
+import AI_RemoveBoomie
+import AI_AddBoomie
+import BotCamViewangles
+import BotCamViewTarget
+import BotCamViewEntitiy
+import BotChooseWeap
+import BotCamFire
+import BotCamTaunt
+import BotCamMoveTo
+import BotCamMode
+import BotInterbreedEndMatch
+import Svcmd_BotStats_f
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_LoadBots
+import CantDamageTeamitem
+import boomies_createByPlayer
+import bambam_createByPlayer
+import IsItemSameTeam
+import Instagib_canSpawnEntity
+import Instagib_isRelevantDamageEvent
+import Instagib_calculateDamage
+import Instagib_getSpawnWeapon
+import Instagib_applyWeaponJumpKnockback
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import PrintMsg
+import CheckObeliskAttack
+import Team_GetFlagStatus
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThinkBatch
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogFlush
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import G_GetCvarInt
+import MoveClientToIntermission
+import G_SendScoreboardUpdates
+import DeathmatchScoreboardMessage
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import GetASpawnPosition
+import SelectSpectatorSpawnPoint
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import respawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import Touch_DoorTrigger
+import G_PushablesChanged
+import G_RunMover
+import fire_kma
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_bubbleg
+import fire_bambamMissile
+import fire_duck
+import explode_imperius
+import fire_splasher
+import fire_nipper
+import fire_boaster
+import G_RunExplosion
+import G_RunMissile
+import BerserkerCheck
+import TossClientCubes
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import G_TouchTriggers
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import G_Say
+import ConcatArgs
+import Cmd_DropCartridge_f
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $604
+byte 1 66
+byte 1 66
+byte 1 0
+align 1
+LABELV $603
+byte 1 84
+byte 1 83
+byte 1 89
+byte 1 67
+byte 1 0
+align 1
+LABELV $602
+byte 1 67
+byte 1 84
+byte 1 76
+byte 1 0
+align 1
+LABELV $601
+byte 1 84
+byte 1 70
+byte 1 70
+byte 1 65
+byte 1 0
+align 1
+LABELV $600
+byte 1 76
+byte 1 80
+byte 1 83
+byte 1 0
+align 1
+LABELV $599
+byte 1 83
+byte 1 89
+byte 1 67
+byte 1 0
+align 1
+LABELV $598
+byte 1 83
+byte 1 80
+byte 1 0
+align 1
+LABELV $597
+byte 1 49
+byte 1 86
+byte 1 83
+byte 1 49
+byte 1 0
+align 1
+LABELV $596
+byte 1 70
+byte 1 70
+byte 1 65
+byte 1 0
+align 1
+LABELV $595
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $590
+byte 1 66
+byte 1 105
+byte 1 103
+byte 1 32
+byte 1 66
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $589
+byte 1 83
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $588
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 84
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 76
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $587
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $586
+byte 1 76
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 80
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $585
+byte 1 83
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $584
+byte 1 83
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $583
+byte 1 84
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $582
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $565
+byte 1 65
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $552
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $551
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $549
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 103
+byte 1 111
+byte 1 100
+byte 1 0
+align 1
+LABELV $547
+byte 1 100
+byte 1 101
+byte 1 110
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $545
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $543
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $541
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $539
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $537
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $535
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $525
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 112
+byte 1 111
+byte 1 108
+byte 1 121
+byte 1 115
+byte 1 0
+align 1
+LABELV $359
+byte 1 71
+byte 1 95
+byte 1 65
+byte 1 100
+byte 1 100
+byte 1 69
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 122
+byte 1 101
+byte 1 114
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $336
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 112
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $331
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $317
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $315
+byte 1 37
+byte 1 52
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $294
+byte 1 110
+byte 1 111
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $245
+byte 1 40
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 41
+byte 1 0
+align 1
+LABELV $238
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $233
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $219
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 84
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $216
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 84
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $113
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $100
+byte 1 71
+byte 1 95
+byte 1 70
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 73
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 120
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $81
+byte 1 37
+byte 1 115
+byte 1 61
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 37
+byte 1 53
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 64
+byte 1 0
@@ -0,0 +1,7788 @@
+code
+proc VectorCompare 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+NEF4 $12
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+NEF4 $12
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+EQF4 $9
+LABELV $12
+CNSTI4 0
+RETI4
+ADDRGP4 $8
+JUMPV
+LABELV $9
+CNSTI4 1
+RETI4
+LABELV $8
+endproc VectorCompare 16 0
+proc VectorLength 20 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+RETF4
+LABELV $13
+endproc VectorLength 20 4
+proc VectorLengthSquared 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+RETF4
+LABELV $14
+endproc VectorLengthSquared 16 0
+proc Distance 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+CNSTI4 8
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 28
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+RETF4
+LABELV $15
+endproc Distance 32 4
+proc DistanceSquared 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+CNSTI4 8
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+RETF4
+LABELV $18
+endproc DistanceSquared 32 0
+proc VectorNormalizeFast 36 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 Q_rsqrt
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+LABELV $25
+endproc VectorNormalizeFast 36 4
+proc VectorInverse 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $26
+endproc VectorInverse 12 0
+proc CrossProduct 40 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 36
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $27
+endproc CrossProduct 40 0
+data
+export vec3_origin
+align 4
+LABELV vec3_origin
+byte 4 0
+byte 4 0
+byte 4 0
+export axisDefault
+align 4
+LABELV axisDefault
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export colorBlack
+align 4
+LABELV colorBlack
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export colorRed
+align 4
+LABELV colorRed
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export colorGreen
+align 4
+LABELV colorGreen
+byte 4 0
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+export colorBlue
+align 4
+LABELV colorBlue
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+export colorYellow
+align 4
+LABELV colorYellow
+byte 4 1065353216
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+export colorMagenta
+align 4
+LABELV colorMagenta
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+export colorCyan
+align 4
+LABELV colorCyan
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+export colorWhite
+align 4
+LABELV colorWhite
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+export colorLtGrey
+align 4
+LABELV colorLtGrey
+byte 4 1061158912
+byte 4 1061158912
+byte 4 1061158912
+byte 4 1065353216
+export colorMdGrey
+align 4
+LABELV colorMdGrey
+byte 4 1056964608
+byte 4 1056964608
+byte 4 1056964608
+byte 4 1065353216
+export colorDkGrey
+align 4
+LABELV colorDkGrey
+byte 4 1048576000
+byte 4 1048576000
+byte 4 1048576000
+byte 4 1065353216
+export colorTBlack33
+align 4
+LABELV colorTBlack33
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1051260355
+export colorTBlack66
+align 4
+LABELV colorTBlack66
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1059648963
+export colorDkGreen
+align 4
+LABELV colorDkGreen
+byte 4 0
+byte 4 1056964608
+byte 4 0
+byte 4 1065353216
+export colorDkBlue
+align 4
+LABELV colorDkBlue
+byte 4 0
+byte 4 0
+byte 4 1056964608
+byte 4 1065353216
+export colorDkRed
+align 4
+LABELV colorDkRed
+byte 4 1056964608
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export colorDkLilac
+align 4
+LABELV colorDkLilac
+byte 4 1053609165
+byte 4 0
+byte 4 1053609165
+byte 4 1065353216
+export colorDkOrange
+align 4
+LABELV colorDkOrange
+byte 4 1061158912
+byte 4 1050253722
+byte 4 0
+byte 4 1065353216
+export g_color_table
+align 4
+LABELV g_color_table
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+export spraycolors
+align 4
+LABELV spraycolors
+byte 4 0
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export bytedirs
+align 4
+LABELV bytedirs
+byte 4 3204879951
+byte 4 0
+byte 4 1062847556
+byte 4 3202531056
+byte 4 1047828139
+byte 4 1063074669
+byte 4 3197577718
+byte 4 0
+byte 4 1064605338
+byte 4 3198039930
+byte 4 1056964608
+byte 4 1062149053
+byte 4 3190184938
+byte 4 1049007711
+byte 4 1064532072
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 0
+byte 4 1062847556
+byte 4 1057396303
+byte 4 3189189110
+byte 4 1060597999
+byte 4 1060013330
+byte 4 1041705462
+byte 4 1060597999
+byte 4 1060013330
+byte 4 0
+byte 4 1057396303
+byte 4 1062847556
+byte 4 1050556282
+byte 4 1056964608
+byte 4 1062149053
+byte 4 1057396303
+byte 4 0
+byte 4 1062847556
+byte 4 1050094070
+byte 4 0
+byte 4 1064605338
+byte 4 1055047408
+byte 4 1047828139
+byte 4 1063074669
+byte 4 1042701290
+byte 4 1049007711
+byte 4 1064532072
+byte 4 3207496978
+byte 4 1041705462
+byte 4 1060597999
+byte 4 3209632701
+byte 4 1050556282
+byte 4 1056964608
+byte 4 3205921044
+byte 4 1054458931
+byte 4 1060121929
+byte 4 3210331204
+byte 4 1057396303
+byte 4 0
+byte 4 3210558317
+byte 4 1055047408
+byte 4 1047828139
+byte 4 3208081647
+byte 4 1060013330
+byte 4 1041705462
+byte 4 3207605577
+byte 4 1058437396
+byte 4 1054458931
+byte 4 3204448256
+byte 4 1062149053
+byte 4 1050556282
+byte 4 3195311787
+byte 4 1063074669
+byte 4 1055047408
+byte 4 3201942579
+byte 4 1060121929
+byte 4 1058437396
+byte 4 3208081647
+byte 4 1060013330
+byte 4 3189189110
+byte 4 3204448256
+byte 4 1062149053
+byte 4 3198039930
+byte 4 3204879951
+byte 4 1062847556
+byte 4 0
+byte 4 0
+byte 4 1062847556
+byte 4 3204879951
+byte 4 3195311787
+byte 4 1063074669
+byte 4 3202531056
+byte 4 0
+byte 4 1064605338
+byte 4 3197577718
+byte 4 3196491359
+byte 4 1064532072
+byte 4 3190184938
+byte 4 0
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 1064605338
+byte 4 1050094070
+byte 4 3196491359
+byte 4 1064532072
+byte 4 1042701290
+byte 4 1047828139
+byte 4 1063074669
+byte 4 1055047408
+byte 4 1049007711
+byte 4 1064532072
+byte 4 1042701290
+byte 4 1056964608
+byte 4 1062149053
+byte 4 1050556282
+byte 4 1047828139
+byte 4 1063074669
+byte 4 3202531056
+byte 4 1049007711
+byte 4 1064532072
+byte 4 3190184938
+byte 4 1056964608
+byte 4 1062149053
+byte 4 3198039930
+byte 4 1062847556
+byte 4 1057396303
+byte 4 0
+byte 4 1060597999
+byte 4 1060013330
+byte 4 1041705462
+byte 4 1060597999
+byte 4 1060013330
+byte 4 3189189110
+byte 4 1057396303
+byte 4 1062847556
+byte 4 0
+byte 4 1054458931
+byte 4 1060121929
+byte 4 1058437396
+byte 4 1063074669
+byte 4 1055047408
+byte 4 1047828139
+byte 4 1060121929
+byte 4 1058437396
+byte 4 1054458931
+byte 4 1062149053
+byte 4 1050556282
+byte 4 1056964608
+byte 4 1060013330
+byte 4 1041705462
+byte 4 1060597999
+byte 4 1058437396
+byte 4 1054458931
+byte 4 1060121929
+byte 4 1064605338
+byte 4 1050094070
+byte 4 0
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 1064532072
+byte 4 1042701290
+byte 4 1049007711
+byte 4 1062847556
+byte 4 3204879951
+byte 4 0
+byte 4 1064605338
+byte 4 3197577718
+byte 4 0
+byte 4 1063074669
+byte 4 3202531056
+byte 4 1047828139
+byte 4 1064532072
+byte 4 3190184938
+byte 4 1049007711
+byte 4 1062149053
+byte 4 3198039930
+byte 4 1056964608
+byte 4 1060013330
+byte 4 3189189110
+byte 4 1060597999
+byte 4 1062847556
+byte 4 0
+byte 4 1057396303
+byte 4 1063074669
+byte 4 1055047408
+byte 4 3195311787
+byte 4 1062149053
+byte 4 1050556282
+byte 4 3204448256
+byte 4 1064532072
+byte 4 1042701290
+byte 4 3196491359
+byte 4 1057396303
+byte 4 0
+byte 4 3210331204
+byte 4 1060013330
+byte 4 1041705462
+byte 4 3208081647
+byte 4 1060013330
+byte 4 3189189110
+byte 4 3208081647
+byte 4 1062847556
+byte 4 0
+byte 4 3204879951
+byte 4 1062149053
+byte 4 3198039930
+byte 4 3204448256
+byte 4 1063074669
+byte 4 3202531056
+byte 4 3195311787
+byte 4 1064532072
+byte 4 3190184938
+byte 4 3196491359
+byte 4 1041705462
+byte 4 1060597999
+byte 4 3207496978
+byte 4 1050556282
+byte 4 1056964608
+byte 4 3209632701
+byte 4 1054458931
+byte 4 1060121929
+byte 4 3205921044
+byte 4 1055047408
+byte 4 1047828139
+byte 4 3210558317
+byte 4 1058437396
+byte 4 1054458931
+byte 4 3207605577
+byte 4 1060121929
+byte 4 1058437396
+byte 4 3201942579
+byte 4 3189189110
+byte 4 1060597999
+byte 4 3207496978
+byte 4 3198039930
+byte 4 1056964608
+byte 4 3209632701
+byte 4 0
+byte 4 1057396303
+byte 4 3210331204
+byte 4 3204879951
+byte 4 0
+byte 4 3210331204
+byte 4 3202531056
+byte 4 1047828139
+byte 4 3210558317
+byte 4 3197577718
+byte 4 0
+byte 4 3212088986
+byte 4 3190184938
+byte 4 1049007711
+byte 4 3212015720
+byte 4 0
+byte 4 0
+byte 4 3212836864
+byte 4 1050094070
+byte 4 0
+byte 4 3212088986
+byte 4 1042701290
+byte 4 1049007711
+byte 4 3212015720
+byte 4 3202531056
+byte 4 3195311787
+byte 4 3210558317
+byte 4 3198039930
+byte 4 3204448256
+byte 4 3209632701
+byte 4 3190184938
+byte 4 3196491359
+byte 4 3212015720
+byte 4 0
+byte 4 3210331204
+byte 4 3204879951
+byte 4 3189189110
+byte 4 3208081647
+byte 4 3207496978
+byte 4 1041705462
+byte 4 3208081647
+byte 4 3207496978
+byte 4 0
+byte 4 3204879951
+byte 4 3210331204
+byte 4 1050556282
+byte 4 3204448256
+byte 4 3209632701
+byte 4 1055047408
+byte 4 3195311787
+byte 4 3210558317
+byte 4 1042701290
+byte 4 3196491359
+byte 4 3212015720
+byte 4 1047828139
+byte 4 3210558317
+byte 4 3202531056
+byte 4 1056964608
+byte 4 3209632701
+byte 4 3198039930
+byte 4 1054458931
+byte 4 3207605577
+byte 4 3205921044
+byte 4 1060597999
+byte 4 3207496978
+byte 4 3189189110
+byte 4 1060121929
+byte 4 3205921044
+byte 4 3201942579
+byte 4 1058437396
+byte 4 3201942579
+byte 4 3207605577
+byte 4 0
+byte 4 3212088986
+byte 4 3197577718
+byte 4 0
+byte 4 3212836864
+byte 4 0
+byte 4 1049007711
+byte 4 3212015720
+byte 4 3190184938
+byte 4 0
+byte 4 3210331204
+byte 4 1057396303
+byte 4 0
+byte 4 3212088986
+byte 4 1050094070
+byte 4 1047828139
+byte 4 3210558317
+byte 4 1055047408
+byte 4 1049007711
+byte 4 3212015720
+byte 4 1042701290
+byte 4 1056964608
+byte 4 3209632701
+byte 4 1050556282
+byte 4 1060597999
+byte 4 3207496978
+byte 4 1041705462
+byte 4 1057396303
+byte 4 3210331204
+byte 4 0
+byte 4 3195311787
+byte 4 3210558317
+byte 4 3202531056
+byte 4 3204448256
+byte 4 3209632701
+byte 4 3198039930
+byte 4 3196491359
+byte 4 3212015720
+byte 4 3190184938
+byte 4 3210331204
+byte 4 3204879951
+byte 4 0
+byte 4 3208081647
+byte 4 3207496978
+byte 4 3189189110
+byte 4 3208081647
+byte 4 3207496978
+byte 4 1041705462
+byte 4 3204879951
+byte 4 3210331204
+byte 4 0
+byte 4 3204448256
+byte 4 3209632701
+byte 4 1050556282
+byte 4 3195311787
+byte 4 3210558317
+byte 4 1055047408
+byte 4 3196491359
+byte 4 3212015720
+byte 4 1042701290
+byte 4 3210558317
+byte 4 3202531056
+byte 4 1047828139
+byte 4 3209632701
+byte 4 3198039930
+byte 4 1056964608
+byte 4 3207605577
+byte 4 3205921044
+byte 4 1054458931
+byte 4 3207496978
+byte 4 3189189110
+byte 4 1060597999
+byte 4 3202531056
+byte 4 3195311787
+byte 4 1063074669
+byte 4 3205921044
+byte 4 3201942579
+byte 4 1060121929
+byte 4 3198039930
+byte 4 3204448256
+byte 4 1062149053
+byte 4 3189189110
+byte 4 3208081647
+byte 4 1060013330
+byte 4 3201942579
+byte 4 3207605577
+byte 4 1058437396
+byte 4 3190184938
+byte 4 3196491359
+byte 4 1064532072
+byte 4 1055047408
+byte 4 3195311787
+byte 4 1063074669
+byte 4 1042701290
+byte 4 3196491359
+byte 4 1064532072
+byte 4 1050556282
+byte 4 3204448256
+byte 4 1062149053
+byte 4 1041705462
+byte 4 3208081647
+byte 4 1060013330
+byte 4 0
+byte 4 3204879951
+byte 4 1062847556
+byte 4 1054458931
+byte 4 3207605577
+byte 4 1058437396
+byte 4 1058437396
+byte 4 3201942579
+byte 4 1060121929
+byte 4 1060121929
+byte 4 3205921044
+byte 4 1054458931
+byte 4 3212088986
+byte 4 1050094070
+byte 4 0
+byte 4 3212015720
+byte 4 1042701290
+byte 4 1049007711
+byte 4 3212836864
+byte 4 0
+byte 4 0
+byte 4 3210331204
+byte 4 0
+byte 4 1057396303
+byte 4 3212088986
+byte 4 3197577718
+byte 4 0
+byte 4 3212015720
+byte 4 3190184938
+byte 4 1049007711
+byte 4 3210558317
+byte 4 1055047408
+byte 4 3195311787
+byte 4 3212015720
+byte 4 1042701290
+byte 4 3196491359
+byte 4 3209632701
+byte 4 1050556282
+byte 4 3204448256
+byte 4 3210558317
+byte 4 3202531056
+byte 4 3195311787
+byte 4 3212015720
+byte 4 3190184938
+byte 4 3196491359
+byte 4 3209632701
+byte 4 3198039930
+byte 4 3204448256
+byte 4 3207496978
+byte 4 1041705462
+byte 4 3208081647
+byte 4 3207496978
+byte 4 3189189110
+byte 4 3208081647
+byte 4 3210331204
+byte 4 0
+byte 4 3204879951
+byte 4 3207605577
+byte 4 1058437396
+byte 4 3201942579
+byte 4 3205921044
+byte 4 1054458931
+byte 4 3207605577
+byte 4 3201942579
+byte 4 1060121929
+byte 4 3205921044
+byte 4 3201942579
+byte 4 3207605577
+byte 4 3205921044
+byte 4 3205921044
+byte 4 3201942579
+byte 4 3207605577
+byte 4 3207605577
+byte 4 3205921044
+byte 4 3201942579
+export Q_rand
+code
+proc Q_rand 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTU4 69069
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CVIU4 4
+MULU4
+CNSTU4 1
+ADDU4
+CVUI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+RETI4
+LABELV $46
+endproc Q_rand 4 0
+export Q_random
+proc Q_random 4 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 Q_rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 65535
+BANDI4
+CVIF4 4
+CNSTF4 1199570944
+DIVF4
+RETF4
+LABELV $47
+endproc Q_random 4 4
+export Q_crandom
+proc Q_crandom 4 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 Q_random
+CALLF4
+ASGNF4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+RETF4
+LABELV $48
+endproc Q_crandom 4 4
+export ClampChar
+proc ClampChar 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 -128
+GEI4 $50
+CNSTI4 -128
+RETI4
+ADDRGP4 $49
+JUMPV
+LABELV $50
+ADDRFP4 0
+INDIRI4
+CNSTI4 127
+LEI4 $52
+CNSTI4 127
+RETI4
+ADDRGP4 $49
+JUMPV
+LABELV $52
+ADDRFP4 0
+INDIRI4
+CVII1 4
+CVII4 1
+RETI4
+LABELV $49
+endproc ClampChar 0 0
+export ClampShort
+proc ClampShort 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 -32768
+GEI4 $55
+CNSTI4 -32768
+RETI4
+ADDRGP4 $54
+JUMPV
+LABELV $55
+ADDRFP4 0
+INDIRI4
+CNSTI4 32767
+LEI4 $57
+CNSTI4 32767
+RETI4
+ADDRGP4 $54
+JUMPV
+LABELV $57
+ADDRFP4 0
+INDIRI4
+CVII2 4
+CVII4 2
+RETI4
+LABELV $54
+endproc ClampShort 0 0
+export DirToByte
+proc DirToByte 28 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $60
+CNSTI4 0
+RETI4
+ADDRGP4 $59
+JUMPV
+LABELV $60
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+LABELV $62
+ADDRLP4 24
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 bytedirs
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 bytedirs+4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 bytedirs+8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $68
+ADDRLP4 8
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $68
+LABELV $63
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 162
+LTI4 $62
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $59
+endproc DirToByte 28 0
+export ByteToDir
+proc ByteToDir 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $73
+ADDRFP4 0
+INDIRI4
+CNSTI4 162
+LTI4 $71
+LABELV $73
+ADDRFP4 4
+INDIRP4
+ADDRGP4 vec3_origin
+INDIRB
+ASGNB 12
+ADDRGP4 $70
+JUMPV
+LABELV $71
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bytedirs
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $70
+endproc ByteToDir 4 0
+export ColorBytes3
+proc ColorBytes3 40 0
+ADDRLP4 12
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LTF4 $76
+ADDRLP4 4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $77
+JUMPV
+LABELV $76
+ADDRLP4 4
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $77
+ADDRLP4 0
+ADDRLP4 4
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 20
+CNSTF4 1132396544
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 24
+INDIRF4
+LTF4 $80
+ADDRLP4 8
+ADDRLP4 20
+INDIRF4
+ADDRLP4 24
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $81
+JUMPV
+LABELV $80
+ADDRLP4 8
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $81
+ADDRLP4 0+1
+ADDRLP4 8
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 32
+CNSTF4 1132396544
+ADDRFP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 36
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+LTF4 $84
+ADDRLP4 28
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $85
+JUMPV
+LABELV $84
+ADDRLP4 28
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $85
+ADDRLP4 0+2
+ADDRLP4 28
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRU4
+RETU4
+LABELV $74
+endproc ColorBytes3 40 0
+export ColorBytes4
+proc ColorBytes4 52 0
+ADDRLP4 12
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LTF4 $88
+ADDRLP4 4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $89
+JUMPV
+LABELV $88
+ADDRLP4 4
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $89
+ADDRLP4 0
+ADDRLP4 4
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 20
+CNSTF4 1132396544
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 24
+INDIRF4
+LTF4 $92
+ADDRLP4 8
+ADDRLP4 20
+INDIRF4
+ADDRLP4 24
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $93
+JUMPV
+LABELV $92
+ADDRLP4 8
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $93
+ADDRLP4 0+1
+ADDRLP4 8
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 32
+CNSTF4 1132396544
+ADDRFP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 36
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+LTF4 $96
+ADDRLP4 28
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $97
+JUMPV
+LABELV $96
+ADDRLP4 28
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $97
+ADDRLP4 0+2
+ADDRLP4 28
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 44
+CNSTF4 1132396544
+ADDRFP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 48
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 48
+INDIRF4
+LTF4 $100
+ADDRLP4 40
+ADDRLP4 44
+INDIRF4
+ADDRLP4 48
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $101
+JUMPV
+LABELV $100
+ADDRLP4 40
+ADDRLP4 44
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $101
+ADDRLP4 0+3
+ADDRLP4 40
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRU4
+RETU4
+LABELV $86
+endproc ColorBytes4 52 0
+export NormalizeColor
+proc NormalizeColor 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+LEF4 $103
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $103
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+LEF4 $105
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $105
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+NEF4 $107
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 $108
+JUMPV
+LABELV $107
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+DIVF4
+ASGNF4
+LABELV $108
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $102
+endproc NormalizeColor 16 0
+export PlaneFromPoints
+proc PlaneFromPoints 76 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 32
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36
+CNSTI4 8
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 48
+CNSTI4 4
+ASGNI4
+ADDRLP4 12+4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 52
+CNSTI4 8
+ASGNI4
+ADDRLP4 12+8
+ADDRFP4 12
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 56
+INDIRF4
+CNSTF4 0
+NEF4 $114
+CNSTI4 0
+RETI4
+ADDRGP4 $109
+JUMPV
+LABELV $114
+ADDRLP4 68
+CNSTI4 4
+ASGNI4
+ADDRLP4 72
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $109
+endproc PlaneFromPoints 76 12
+export RotatePointAroundVector
+proc RotatePointAroundVector 260 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 148
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 148+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 148+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 160
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 PerpendicularVector
+CALLV
+pop
+ADDRLP4 160
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRLP4 176
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 40
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 40+12
+ADDRLP4 160+4
+INDIRF4
+ASGNF4
+ADDRLP4 40+24
+ADDRLP4 160+8
+INDIRF4
+ASGNF4
+ADDRLP4 40+4
+ADDRLP4 176
+INDIRF4
+ASGNF4
+ADDRLP4 40+12+4
+ADDRLP4 176+4
+INDIRF4
+ASGNF4
+ADDRLP4 40+24+4
+ADDRLP4 176+8
+INDIRF4
+ASGNF4
+ADDRLP4 40+8
+ADDRLP4 148
+INDIRF4
+ASGNF4
+ADDRLP4 40+12+8
+ADDRLP4 148+4
+INDIRF4
+ASGNF4
+ADDRLP4 40+24+8
+ADDRLP4 148+8
+INDIRF4
+ASGNF4
+ADDRLP4 112
+ARGP4
+ADDRLP4 40
+ARGP4
+CNSTU4 36
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 112+4
+ADDRLP4 40+12
+INDIRF4
+ASGNF4
+ADDRLP4 112+8
+ADDRLP4 40+24
+INDIRF4
+ASGNF4
+ADDRLP4 112+12
+ADDRLP4 40+4
+INDIRF4
+ASGNF4
+ADDRLP4 112+12+8
+ADDRLP4 40+24+4
+INDIRF4
+ASGNF4
+ADDRLP4 112+24
+ADDRLP4 40+8
+INDIRF4
+ASGNF4
+ADDRLP4 112+24+4
+ADDRLP4 40+12+8
+INDIRF4
+ASGNF4
+ADDRLP4 76
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 36
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 228
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 76+24+8
+ADDRLP4 228
+INDIRF4
+ASGNF4
+ADDRLP4 76+12+4
+ADDRLP4 228
+INDIRF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 228
+INDIRF4
+ASGNF4
+ADDRLP4 172
+CNSTF4 1078530011
+ADDRFP4 12
+INDIRF4
+MULF4
+CNSTF4 1127481344
+DIVF4
+ASGNF4
+ADDRLP4 172
+INDIRF4
+ARGF4
+ADDRLP4 232
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 232
+INDIRF4
+ASGNF4
+ADDRLP4 172
+INDIRF4
+ARGF4
+ADDRLP4 236
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 76+4
+ADDRLP4 236
+INDIRF4
+ASGNF4
+ADDRLP4 172
+INDIRF4
+ARGF4
+ADDRLP4 240
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 76+12
+ADDRLP4 240
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 172
+INDIRF4
+ARGF4
+ADDRLP4 244
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 76+12+4
+ADDRLP4 244
+INDIRF4
+ASGNF4
+ADDRLP4 40
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 188
+ARGP4
+ADDRGP4 MatrixMultiply
+CALLV
+pop
+ADDRLP4 188
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 MatrixMultiply
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $161
+ADDRLP4 252
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRLP4 252
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 252
+INDIRI4
+ADDRLP4 4+4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 252
+INDIRI4
+ADDRLP4 4+8
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $162
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $161
+LABELV $116
+endproc RotatePointAroundVector 260 12
+export RotateAroundDirection
+proc RotateAroundDirection 24 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 PerpendicularVector
+CALLV
+pop
+ADDRFP4 4
+INDIRF4
+CNSTF4 0
+EQF4 $168
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 RotatePointAroundVector
+CALLV
+pop
+LABELV $168
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+LABELV $167
+endproc RotateAroundDirection 24 16
+export vectoangles
+proc vectoangles 40 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+NEF4 $171
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+NEF4 $171
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+LEF4 $173
+ADDRLP4 4
+CNSTF4 1119092736
+ASGNF4
+ADDRGP4 $172
+JUMPV
+LABELV $173
+ADDRLP4 4
+CNSTF4 1132920832
+ASGNF4
+ADDRGP4 $172
+JUMPV
+LABELV $171
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 0
+EQF4 $175
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1127481344
+ADDRLP4 24
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ASGNF4
+ADDRGP4 $176
+JUMPV
+LABELV $175
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+LEF4 $177
+ADDRLP4 0
+CNSTF4 1119092736
+ASGNF4
+ADDRGP4 $178
+JUMPV
+LABELV $177
+ADDRLP4 0
+CNSTF4 1132920832
+ASGNF4
+LABELV $178
+LABELV $176
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $179
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $179
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 1127481344
+ADDRLP4 36
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+GEF4 $181
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $181
+LABELV $172
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $170
+endproc vectoangles 40 8
+export AnglesToAxis
+proc AnglesToAxis 16 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 vec3_origin
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 vec3_origin+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRGP4 vec3_origin+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $183
+endproc AnglesToAxis 16 16
+export AxisClear
+proc AxisClear 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $188
+endproc AxisClear 0 0
+export AxisCopy
+proc AxisCopy 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+CNSTI4 12
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+CNSTI4 24
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $189
+endproc AxisCopy 8 0
+export AxisScale
+proc AxisScale 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+CNSTI4 12
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+CNSTI4 16
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+CNSTI4 20
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 24
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24
+CNSTI4 28
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 28
+CNSTI4 32
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $190
+endproc AxisScale 32 0
+export ProjectPointOnPlane
+proc ProjectPointOnPlane 72 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 24
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 32
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 Q_fabs
+CALLF4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+CNSTF4 0
+NEF4 $192
+ADDRFP4 0
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 $191
+JUMPV
+LABELV $192
+ADDRLP4 0
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 48
+CNSTI4 4
+ASGNI4
+ADDRLP4 52
+ADDRFP4 8
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 56
+CNSTI4 8
+ASGNI4
+ADDRLP4 16
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 64
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 68
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $191
+endproc ProjectPointOnPlane 72 4
+export MakeNormalVectors
+proc MakeNormalVectors 36 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+CNSTI4 4
+ASGNI4
+ADDRLP4 16
+CNSTI4 8
+ASGNI4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 24
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+CNSTI4 8
+ASGNI4
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+LABELV $198
+endproc MakeNormalVectors 36 12
+export VectorRotate
+proc VectorRotate 40 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $199
+endproc VectorRotate 40 0
+export VectorRotateTMatrix
+proc VectorRotateTMatrix 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $200
+endproc VectorRotateTMatrix 32 0
+export Q_rsqrt
+proc Q_rsqrt 24 0
+ADDRLP4 12
+CNSTF4 1069547520
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 8
+CNSTF4 1056964608
+ADDRLP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 1597463007
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+RSHI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRLP4 0
+INDIRF4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $201
+endproc Q_rsqrt 24 0
+export Q_fabs
+proc Q_fabs 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 2147483647
+BANDI4
+ASGNI4
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $202
+endproc Q_fabs 4 0
+export LerpAngle
+proc LerpAngle 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 0
+INDIRF4
+SUBF4
+CNSTF4 1127481344
+LEF4 $204
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $204
+ADDRFP4 4
+INDIRF4
+ADDRFP4 0
+INDIRF4
+SUBF4
+CNSTF4 3274964992
+GEF4 $206
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $206
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 0
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $203
+endproc LerpAngle 8 0
+export AngleSubtract
+proc AngleSubtract 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ADDRFP4 4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $210
+JUMPV
+LABELV $209
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $210
+ADDRLP4 0
+INDIRF4
+CNSTF4 1127481344
+GTF4 $209
+ADDRGP4 $213
+JUMPV
+LABELV $212
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $213
+ADDRLP4 0
+INDIRF4
+CNSTF4 3274964992
+LTF4 $212
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $208
+endproc AngleSubtract 4 0
+export AnglesSubtract
+proc AnglesSubtract 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $215
+endproc AnglesSubtract 20 8
+export AngleMod
+proc AngleMod 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 0
+CNSTF4 1001652224
+CNSTF4 1127615329
+ADDRFP4 0
+INDIRF4
+MULF4
+CVFI4 4
+CNSTI4 65535
+BANDI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+RETF4
+LABELV $216
+endproc AngleMod 0 0
+export AngleNormalize360
+proc AngleNormalize360 0 0
+CNSTF4 1001652224
+CNSTF4 1127615329
+ADDRFP4 0
+INDIRF4
+MULF4
+CVFI4 4
+CNSTI4 65535
+BANDI4
+CVIF4 4
+MULF4
+RETF4
+LABELV $217
+endproc AngleNormalize360 0 0
+export AngleNormalize180
+proc AngleNormalize180 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 AngleNormalize360
+CALLF4
+ASGNF4
+ADDRFP4 0
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1127481344
+LEF4 $219
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $219
+ADDRFP4 0
+INDIRF4
+RETF4
+LABELV $218
+endproc AngleNormalize180 4 4
+export AngleDelta
+proc AngleDelta 4 4
+ADDRFP4 0
+INDIRF4
+ADDRFP4 4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 AngleNormalize180
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $221
+endproc AngleDelta 4 4
+export SetPlaneSignbits
+proc SetPlaneSignbits 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $223
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $227
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BORI4
+ASGNI4
+LABELV $227
+LABELV $224
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $223
+ADDRFP4 0
+INDIRP4
+CNSTI4 17
+ADDP4
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+LABELV $222
+endproc SetPlaneSignbits 12 0
+export BoxOnPlaneSide
+proc BoxOnPlaneSide 60 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 3
+GEI4 $230
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+GTF4 $232
+CNSTI4 1
+RETI4
+ADDRGP4 $229
+JUMPV
+LABELV $232
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+LTF4 $234
+CNSTI4 2
+RETI4
+ADDRGP4 $229
+JUMPV
+LABELV $234
+CNSTI4 3
+RETI4
+ADDRGP4 $229
+JUMPV
+LABELV $230
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 17
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 8
+GEI4 $237
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $239
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+CNSTI4 17
+ADDP4
+INDIRU1
+CVUI4 1
+ADDRLP4 0
+INDIRI4
+RSHI4
+CNSTI4 1
+BANDI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 2
+ASGNI4
+ADDRLP4 36
+ADDRLP4 4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LSHI4
+ADDRLP4 8
+ADDP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 40
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $244
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRGP4 $245
+JUMPV
+LABELV $244
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+LABELV $245
+ADDRLP4 48
+CNSTI4 2
+ASGNI4
+ADDRLP4 52
+ADDRLP4 44
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LSHI4
+ADDRLP4 8
+ADDP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 0
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRLP4 56
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 56
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $240
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $239
+LABELV $237
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+LTF4 $246
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+LABELV $246
+ADDRLP4 8+4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+GEF4 $248
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $248
+ADDRLP4 16
+INDIRI4
+RETI4
+LABELV $229
+endproc BoxOnPlaneSide 60 0
+export RadiusFromBounds
+proc RadiusFromBounds 36 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $252
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $257
+ADDRLP4 32
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 $258
+JUMPV
+LABELV $257
+ADDRLP4 32
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $258
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+LABELV $253
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $252
+ADDRLP4 12
+ARGP4
+ADDRLP4 24
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+RETF4
+LABELV $251
+endproc RadiusFromBounds 36 4
+export ClearBounds
+proc ClearBounds 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTF4 1203982208
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+CNSTF4 3351465856
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $259
+endproc ClearBounds 16 0
+export AddPointToBounds
+proc AddPointToBounds 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+GEF4 $261
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+LABELV $261
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+LEF4 $263
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+LABELV $263
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+GEF4 $265
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $265
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+LEF4 $267
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $267
+ADDRLP4 8
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+GEF4 $269
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $269
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+LEF4 $271
+ADDRLP4 16
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $271
+LABELV $260
+endproc AddPointToBounds 20 0
+export BoundsIntersect
+proc BoundsIntersect 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+LTF4 $280
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+LTF4 $280
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+LTF4 $280
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+GTF4 $280
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+GTF4 $280
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+LEF4 $274
+LABELV $280
+CNSTI4 0
+RETI4
+ADDRGP4 $273
+JUMPV
+LABELV $274
+CNSTI4 1
+RETI4
+LABELV $273
+endproc BoundsIntersect 24 0
+export BoundsIntersectSphere
+proc BoundsIntersectSphere 36 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+SUBF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+GTF4 $288
+ADDRLP4 4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+LTF4 $288
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 24
+ADDRFP4 8
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRFP4 12
+INDIRF4
+SUBF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+GTF4 $288
+ADDRLP4 24
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+LTF4 $288
+ADDRLP4 28
+CNSTI4 8
+ASGNI4
+ADDRLP4 32
+ADDRFP4 8
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRFP4 12
+INDIRF4
+SUBF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+GTF4 $288
+ADDRLP4 32
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+GEF4 $282
+LABELV $288
+CNSTI4 0
+RETI4
+ADDRGP4 $281
+JUMPV
+LABELV $282
+CNSTI4 1
+RETI4
+LABELV $281
+endproc BoundsIntersectSphere 36 0
+export BoundsIntersectPoint
+proc BoundsIntersectPoint 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+GTF4 $296
+ADDRLP4 4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+LTF4 $296
+ADDRLP4 16
+CNSTI4 4
+ASGNI4
+ADDRLP4 20
+ADDRFP4 8
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+GTF4 $296
+ADDRLP4 20
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+LTF4 $296
+ADDRLP4 24
+CNSTI4 8
+ASGNI4
+ADDRLP4 28
+ADDRFP4 8
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+GTF4 $296
+ADDRLP4 28
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+GEF4 $290
+LABELV $296
+CNSTI4 0
+RETI4
+ADDRGP4 $289
+JUMPV
+LABELV $290
+CNSTI4 1
+RETI4
+LABELV $289
+endproc BoundsIntersectPoint 32 0
+proc BoxClipBox 208 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRFP4 28
+ADDRFP4 28
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $298
+ADDRFP4 12
+ADDRGP4 vec3_origin
+ASGNP4
+LABELV $298
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $300
+ADDRFP4 16
+ADDRGP4 vec3_origin
+ASGNP4
+LABELV $300
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $302
+ADDRLP4 176
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1056964608
+ADDRLP4 176
+INDIRI4
+ADDRFP4 12
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 176
+INDIRI4
+ADDRFP4 16
+INDIRP4
+ADDP4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+ADDRLP4 24
+ADDP4
+ADDRLP4 180
+INDIRI4
+ADDRFP4 12
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 180
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 184
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+ADDRLP4 24+12
+ADDP4
+ADDRLP4 184
+INDIRI4
+ADDRFP4 16
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 184
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 188
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+ADDRLP4 132
+ADDP4
+ADDRLP4 188
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 188
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 188
+INDIRI4
+ADDRFP4 28
+INDIRP4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 192
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+ADDRLP4 144
+ADDP4
+ADDRLP4 192
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 192
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 192
+INDIRI4
+ADDRFP4 28
+INDIRP4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $303
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $302
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $307
+ADDRLP4 176
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+ADDRLP4 4
+ADDP4
+CNSTF4 1056964608
+ADDRLP4 176
+INDIRI4
+ADDRLP4 24
+ADDP4
+INDIRF4
+ADDRLP4 176
+INDIRI4
+ADDRLP4 24+12
+ADDP4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+ADDRLP4 48
+ADDP4
+ADDRLP4 180
+INDIRI4
+ADDRLP4 24
+ADDP4
+INDIRF4
+ADDRLP4 180
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 184
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+ADDRLP4 48+12
+ADDP4
+ADDRLP4 184
+INDIRI4
+ADDRLP4 24+12
+ADDP4
+INDIRF4
+ADDRLP4 184
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 188
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+ADDRLP4 100
+ADDP4
+ADDRLP4 188
+INDIRI4
+ADDRLP4 132
+ADDP4
+INDIRF4
+ADDRLP4 188
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 192
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+ADDRLP4 112
+ADDP4
+ADDRLP4 192
+INDIRI4
+ADDRLP4 144
+ADDP4
+INDIRF4
+ADDRLP4 192
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 196
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+ADDRLP4 100
+ADDP4
+INDIRF4
+ADDRLP4 196
+INDIRI4
+ADDRLP4 112
+ADDP4
+INDIRF4
+GEF4 $314
+ADDRLP4 200
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+ADDRLP4 72
+ADDP4
+ADDRLP4 200
+INDIRI4
+ADDRLP4 100
+ADDP4
+INDIRF4
+ADDRLP4 200
+INDIRI4
+ADDRLP4 48
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 204
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+ADDRLP4 72+12
+ADDP4
+ADDRLP4 204
+INDIRI4
+ADDRLP4 112
+ADDP4
+INDIRF4
+ADDRLP4 204
+INDIRI4
+ADDRLP4 48+12
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $315
+JUMPV
+LABELV $314
+ADDRLP4 200
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+ADDRLP4 72
+ADDP4
+ADDRLP4 200
+INDIRI4
+ADDRLP4 112
+ADDP4
+INDIRF4
+ADDRLP4 200
+INDIRI4
+ADDRLP4 48
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 204
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+ADDRLP4 72+12
+ADDP4
+ADDRLP4 204
+INDIRI4
+ADDRLP4 100
+ADDP4
+INDIRF4
+ADDRLP4 204
+INDIRI4
+ADDRLP4 48+12
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $315
+LABELV $308
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $307
+ADDRFP4 32
+INDIRI4
+CNSTI4 33554432
+BANDI4
+CNSTI4 0
+NEI4 $320
+ADDRGP4 $297
+JUMPV
+LABELV $320
+ADDRLP4 132
+INDIRF4
+ADDRLP4 144
+INDIRF4
+NEF4 $322
+ADDRLP4 132+4
+INDIRF4
+ADDRLP4 144+4
+INDIRF4
+NEF4 $322
+ADDRLP4 132+8
+INDIRF4
+ADDRLP4 144+8
+INDIRF4
+NEF4 $322
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $328
+ADDRLP4 176
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+ADDRLP4 72
+ADDP4
+INDIRF4
+ADDRLP4 176
+INDIRI4
+ADDRFP4 24
+INDIRP4
+ADDP4
+INDIRF4
+GTF4 $335
+ADDRLP4 176
+INDIRI4
+ADDRLP4 72+12
+ADDP4
+INDIRF4
+ADDRLP4 176
+INDIRI4
+ADDRFP4 20
+INDIRP4
+ADDP4
+INDIRF4
+GEF4 $332
+LABELV $335
+ADDRGP4 $297
+JUMPV
+LABELV $332
+LABELV $329
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $328
+ADDRLP4 180
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 33554432
+ASGNI4
+ADDRGP4 $297
+JUMPV
+LABELV $322
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $336
+ADDRLP4 176
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 180
+CNSTF4 1040187392
+ASGNF4
+ADDRLP4 176
+INDIRI4
+ADDRLP4 72+12
+ADDP4
+INDIRF4
+ADDRLP4 176
+INDIRI4
+ADDRFP4 20
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 180
+INDIRF4
+SUBF4
+LTF4 $343
+ADDRLP4 176
+INDIRI4
+ADDRLP4 72
+ADDP4
+INDIRF4
+ADDRLP4 176
+INDIRI4
+ADDRFP4 24
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 180
+INDIRF4
+ADDF4
+LEF4 $340
+LABELV $343
+ADDRGP4 $297
+JUMPV
+LABELV $340
+LABELV $337
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $336
+ADDRLP4 156
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 160
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 172
+CNSTI4 -1
+ASGNI4
+ADDRLP4 176
+CNSTI4 0
+ASGNI4
+ADDRLP4 168
+ADDRLP4 176
+INDIRI4
+ASGNI4
+ADDRLP4 164
+ADDRLP4 176
+INDIRI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 176
+INDIRI4
+ASGNI4
+LABELV $344
+ADDRLP4 184
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 96
+INDIRI4
+ADDRLP4 184
+INDIRI4
+RSHI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+ADDRLP4 184
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $348
+ADDRLP4 188
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 188
+INDIRI4
+ADDRFP4 24
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 188
+INDIRI4
+ADDRLP4 48
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 188
+INDIRI4
+ADDRLP4 100
+ADDP4
+INDIRF4
+ADDRLP4 128
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 188
+INDIRI4
+ADDRLP4 112
+ADDP4
+INDIRF4
+ADDRLP4 128
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $349
+JUMPV
+LABELV $348
+ADDRLP4 188
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 188
+INDIRI4
+ADDRFP4 20
+INDIRP4
+ADDP4
+INDIRF4
+NEGF4
+ADDRLP4 188
+INDIRI4
+ADDRLP4 48+12
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 188
+INDIRI4
+ADDRLP4 100
+ADDP4
+INDIRF4
+NEGF4
+ADDRLP4 128
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 188
+INDIRI4
+ADDRLP4 112
+ADDP4
+INDIRF4
+NEGF4
+ADDRLP4 128
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $349
+ADDRLP4 20
+INDIRF4
+CNSTF4 0
+LEF4 $351
+ADDRLP4 168
+CNSTI4 1
+ASGNI4
+LABELV $351
+ADDRLP4 16
+INDIRF4
+CNSTF4 0
+LEF4 $353
+ADDRLP4 164
+CNSTI4 1
+ASGNI4
+LABELV $353
+ADDRLP4 16
+INDIRF4
+CNSTF4 0
+LEF4 $355
+ADDRLP4 20
+INDIRF4
+CNSTF4 1040187392
+GEF4 $357
+ADDRLP4 20
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LTF4 $355
+LABELV $357
+ADDRGP4 $297
+JUMPV
+LABELV $355
+ADDRLP4 196
+CNSTF4 0
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 196
+INDIRF4
+GTF4 $358
+ADDRLP4 20
+INDIRF4
+ADDRLP4 196
+INDIRF4
+GTF4 $358
+ADDRGP4 $345
+JUMPV
+LABELV $358
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+LEF4 $360
+ADDRLP4 124
+ADDRLP4 16
+INDIRF4
+CNSTF4 1040187392
+SUBF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 124
+INDIRF4
+CNSTF4 0
+GEF4 $362
+ADDRLP4 124
+CNSTF4 0
+ASGNF4
+LABELV $362
+ADDRLP4 124
+INDIRF4
+ADDRLP4 156
+INDIRF4
+LEF4 $361
+ADDRLP4 156
+ADDRLP4 124
+INDIRF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRGP4 $361
+JUMPV
+LABELV $360
+ADDRLP4 124
+ADDRLP4 16
+INDIRF4
+CNSTF4 1040187392
+ADDF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 124
+INDIRF4
+CNSTF4 1065353216
+LEF4 $366
+ADDRLP4 124
+CNSTF4 1065353216
+ASGNF4
+LABELV $366
+ADDRLP4 124
+INDIRF4
+ADDRLP4 160
+INDIRF4
+GEF4 $368
+ADDRLP4 160
+ADDRLP4 124
+INDIRF4
+ASGNF4
+LABELV $368
+LABELV $361
+LABELV $345
+ADDRLP4 96
+ADDRLP4 96
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 6
+LTI4 $344
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+NEI4 $370
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+NEI4 $371
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 33554432
+ASGNI4
+ADDRGP4 $371
+JUMPV
+LABELV $370
+ADDRLP4 156
+INDIRF4
+ADDRLP4 160
+INDIRF4
+GEF4 $374
+ADDRLP4 156
+INDIRF4
+CNSTF4 3212836864
+LEF4 $374
+ADDRLP4 156
+INDIRF4
+CNSTF4 1065353216
+GEF4 $374
+ADDRLP4 156
+INDIRF4
+CNSTF4 0
+GEF4 $376
+ADDRLP4 156
+CNSTF4 0
+ASGNF4
+LABELV $376
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 156
+INDIRF4
+ASGNF4
+ADDRLP4 188
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 172
+INDIRI4
+ADDRLP4 188
+INDIRI4
+RSHI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+ADDRLP4 188
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $378
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 24
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRGP4 $379
+JUMPV
+LABELV $378
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 20
+INDIRP4
+ADDP4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+ADDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 41
+ADDP4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+LABELV $379
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 33554432
+ASGNI4
+LABELV $374
+LABELV $371
+LABELV $297
+endproc BoxClipBox 208 0
+export BoxTraceBox
+proc BoxTraceBox 16 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 56
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRFP4 32
+INDIRI4
+ARGI4
+ADDRGP4 BoxClipBox
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $381
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+ADDRLP4 12
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $382
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $381
+LABELV $380
+endproc BoxTraceBox 16 36
+export VectorNormalize
+proc VectorNormalize 44 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+EQF4 $386
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 1065353216
+ADDRLP4 24
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $386
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $385
+endproc VectorNormalize 44 4
+export VectorNormalize2
+proc VectorNormalize2 40 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+EQF4 $389
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 1065353216
+ADDRLP4 24
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 36
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $390
+JUMPV
+LABELV $389
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+LABELV $390
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $388
+endproc VectorNormalize2 40 4
+export _VectorMA
+proc _VectorMA 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $391
+endproc _VectorMA 8 0
+export _DotProduct
+proc _DotProduct 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+RETF4
+LABELV $392
+endproc _DotProduct 16 0
+export _VectorSubtract
+proc _VectorSubtract 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $393
+endproc _VectorSubtract 8 0
+export _VectorAdd
+proc _VectorAdd 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $394
+endproc _VectorAdd 8 0
+export _VectorCopy
+proc _VectorCopy 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $395
+endproc _VectorCopy 8 0
+export _VectorScale
+proc _VectorScale 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $396
+endproc _VectorScale 8 0
+export Vector4Scale
+proc Vector4Scale 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+CNSTI4 12
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $397
+endproc Vector4Scale 12 0
+export Q_log2
+proc Q_log2 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $400
+JUMPV
+LABELV $399
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $400
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+RSHI4
+ASGNI4
+ADDRFP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $399
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $398
+endproc Q_log2 8 0
+export MatrixMultiply
+proc MatrixMultiply 104 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+CNSTI4 12
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 44
+CNSTI4 16
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+CNSTI4 20
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68
+CNSTI4 24
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80
+CNSTI4 28
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 92
+CNSTI4 32
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $402
+endproc MatrixMultiply 104 0
+bss
+align 4
+LABELV $404
+skip 4
+align 4
+LABELV $405
+skip 4
+align 4
+LABELV $406
+skip 4
+align 4
+LABELV $407
+skip 4
+align 4
+LABELV $408
+skip 4
+align 4
+LABELV $409
+skip 4
+export AngleVectors
+code
+proc AngleVectors 36 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTF4 1016003125
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRGP4 $406
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 $409
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1016003125
+ADDRFP4 0
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRGP4 $405
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 $408
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1016003125
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRGP4 $404
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 $407
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $410
+ADDRFP4 4
+INDIRP4
+ADDRGP4 $408
+INDIRF4
+ADDRGP4 $409
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 $408
+INDIRF4
+ADDRGP4 $406
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 $405
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $410
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $412
+ADDRLP4 28
+CNSTF4 3212836864
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 28
+INDIRF4
+ADDRGP4 $404
+INDIRF4
+MULF4
+ADDRGP4 $405
+INDIRF4
+MULF4
+ADDRGP4 $409
+INDIRF4
+MULF4
+ADDRLP4 28
+INDIRF4
+ADDRGP4 $407
+INDIRF4
+MULF4
+ADDRGP4 $406
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 3212836864
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 32
+INDIRF4
+ADDRGP4 $404
+INDIRF4
+MULF4
+ADDRGP4 $405
+INDIRF4
+MULF4
+ADDRGP4 $406
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRF4
+ADDRGP4 $407
+INDIRF4
+MULF4
+ADDRGP4 $409
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 3212836864
+ADDRGP4 $404
+INDIRF4
+MULF4
+ADDRGP4 $408
+INDIRF4
+MULF4
+ASGNF4
+LABELV $412
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $414
+ADDRFP4 12
+INDIRP4
+ADDRGP4 $407
+INDIRF4
+ADDRGP4 $405
+INDIRF4
+MULF4
+ADDRGP4 $409
+INDIRF4
+MULF4
+ADDRGP4 $404
+INDIRF4
+NEGF4
+ADDRGP4 $406
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 $407
+INDIRF4
+ADDRGP4 $405
+INDIRF4
+MULF4
+ADDRGP4 $406
+INDIRF4
+MULF4
+ADDRGP4 $404
+INDIRF4
+NEGF4
+ADDRGP4 $409
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 $407
+INDIRF4
+ADDRGP4 $408
+INDIRF4
+MULF4
+ASGNF4
+LABELV $414
+LABELV $403
+endproc AngleVectors 36 4
+export PerpendicularVector
+proc PerpendicularVector 40 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $420
+JUMPV
+LABELV $417
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 4
+INDIRF4
+GEF4 $421
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+LABELV $421
+LABELV $418
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $420
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $417
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 ProjectPointOnPlane
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+LABELV $416
+endproc PerpendicularVector 40 12
+export Q_isnan
+proc Q_isnan 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRU4
+CNSTU4 2147483647
+BANDU4
+ASGNU4
+ADDRLP4 0
+CNSTU4 2139095040
+ADDRLP4 0
+INDIRU4
+SUBU4
+ASGNU4
+ADDRLP4 0
+INDIRU4
+CNSTI4 31
+RSHU4
+CVUI4 4
+RETI4
+LABELV $425
+endproc Q_isnan 4 0
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_acos
+import Q_IsColorString
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
@@ -0,0 +1,9021 @@
+data
+export demo_protocols
+align 4
+LABELV demo_protocols
+byte 4 66
+byte 4 67
+byte 4 68
+byte 4 69
+byte 4 70
+byte 4 71
+byte 4 0
+export Q_IsColorString
+code
+proc Q_IsColorString 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $27
+CNSTI4 0
+RETI4
+ADDRGP4 $26
+JUMPV
+LABELV $27
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+EQI4 $29
+CNSTI4 0
+RETI4
+ADDRGP4 $26
+JUMPV
+LABELV $29
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $31
+CNSTI4 0
+RETI4
+ADDRGP4 $26
+JUMPV
+LABELV $31
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+GEI4 $33
+CNSTI4 0
+RETI4
+ADDRGP4 $26
+JUMPV
+LABELV $33
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 65
+LTI4 $41
+ADDRLP4 4
+INDIRI4
+CNSTI4 90
+LEI4 $40
+LABELV $41
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 97
+LTI4 $42
+ADDRLP4 8
+INDIRI4
+CNSTI4 122
+LEI4 $40
+LABELV $42
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 48
+LTI4 $38
+ADDRLP4 12
+INDIRI4
+CNSTI4 57
+GTI4 $38
+LABELV $40
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $39
+JUMPV
+LABELV $38
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $39
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $35
+CNSTI4 0
+RETI4
+ADDRGP4 $26
+JUMPV
+LABELV $35
+CNSTI4 1
+RETI4
+LABELV $26
+endproc Q_IsColorString 16 0
+export Com_Clamp
+proc Com_Clamp 0 0
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRF4
+ADDRFP4 0
+INDIRF4
+GEF4 $44
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $43
+JUMPV
+LABELV $44
+ADDRFP4 8
+INDIRF4
+ADDRFP4 4
+INDIRF4
+LEF4 $46
+ADDRFP4 4
+INDIRF4
+RETF4
+ADDRGP4 $43
+JUMPV
+LABELV $46
+ADDRFP4 8
+INDIRF4
+RETF4
+LABELV $43
+endproc Com_Clamp 0 0
+export COM_SkipPath
+proc COM_SkipPath 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $50
+JUMPV
+LABELV $49
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $52
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $52
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $50
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $49
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $48
+endproc COM_SkipPath 4 0
+export COM_GetExtension
+proc COM_GetExtension 16 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 46
+ARGI4
+ADDRLP4 8
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $55
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 12
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $57
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+GEU4 $55
+LABELV $57
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+RETP4
+ADDRGP4 $54
+JUMPV
+LABELV $55
+ADDRGP4 $58
+RETP4
+LABELV $54
+endproc COM_GetExtension 16 8
+export COM_StripExtension
+proc COM_StripExtension 20 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 46
+ARGI4
+ADDRLP4 8
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $60
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 12
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $62
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+GEU4 $60
+LABELV $62
+ADDRFP4 8
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1
+ADDI4
+GEI4 $64
+ADDRLP4 16
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $65
+JUMPV
+LABELV $64
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $65
+ADDRFP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+LABELV $60
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+NEU4 $66
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+LEI4 $66
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $67
+JUMPV
+LABELV $66
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $67
+LABELV $59
+endproc COM_StripExtension 20 12
+export COM_CompareExtension
+proc COM_CompareExtension 20 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 8
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 12
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+GTI4 $69
+ADDRFP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $71
+CNSTI4 1
+RETI4
+ADDRGP4 $68
+JUMPV
+LABELV $71
+LABELV $69
+CNSTI4 0
+RETI4
+LABELV $68
+endproc COM_CompareExtension 20 8
+export COM_DefaultExtension
+proc COM_DefaultExtension 16 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 46
+ARGI4
+ADDRLP4 8
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $74
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 12
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $76
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+GEU4 $74
+LABELV $76
+ADDRGP4 $73
+JUMPV
+LABELV $74
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $73
+endproc COM_DefaultExtension 16 12
+export CopyShortSwap
+proc CopyShortSwap 8 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ADDRLP4 4
+INDIRP4
+INDIRU1
+ASGNU1
+LABELV $77
+endproc CopyShortSwap 8 0
+export CopyLongSwap
+proc CopyLongSwap 8 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 3
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 2
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 3
+ADDP4
+ADDRLP4 4
+INDIRP4
+INDIRU1
+ASGNU1
+LABELV $78
+endproc CopyLongSwap 8 0
+export ShortSwap
+proc ShortSwap 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CVII2 4
+ASGNI2
+ADDRLP4 4
+ADDRFP4 0
+INDIRI2
+CVII4 2
+ASGNI4
+ADDRLP4 8
+CNSTI4 255
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRLP4 1
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+RSHI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+ADDRLP4 12
+INDIRI4
+LSHI4
+ADDRLP4 1
+INDIRU1
+CVUI4 1
+ADDI4
+CVII2 4
+CVII4 2
+RETI4
+LABELV $79
+endproc ShortSwap 16 0
+export ShortNoSwap
+proc ShortNoSwap 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CVII2 4
+ASGNI2
+ADDRFP4 0
+INDIRI2
+CVII4 2
+RETI4
+LABELV $80
+endproc ShortNoSwap 0 0
+export LongSwap
+proc LongSwap 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 255
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRLP4 1
+ADDRFP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+RSHI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 16
+CNSTI4 16
+ASGNI4
+ADDRLP4 2
+ADDRFP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+RSHI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 20
+CNSTI4 24
+ASGNI4
+ADDRLP4 3
+ADDRFP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+RSHI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+ADDRLP4 20
+INDIRI4
+LSHI4
+ADDRLP4 1
+INDIRU1
+CVUI4 1
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDI4
+ADDRLP4 2
+INDIRU1
+CVUI4 1
+ADDRLP4 12
+INDIRI4
+LSHI4
+ADDI4
+ADDRLP4 3
+INDIRU1
+CVUI4 1
+ADDI4
+RETI4
+LABELV $81
+endproc LongSwap 24 0
+export LongNoSwap
+proc LongNoSwap 0 0
+ADDRFP4 0
+INDIRI4
+RETI4
+LABELV $82
+endproc LongNoSwap 0 0
+export Long64Swap
+proc Long64Swap 12 0
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 7
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+1
+ADDRLP4 8
+INDIRP4
+CNSTI4 6
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+2
+ADDRFP4 4
+INDIRP4
+CNSTI4 5
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+3
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+5
+ADDRFP4 4
+INDIRP4
+CNSTI4 2
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+6
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+7
+ADDRFP4 4
+INDIRP4
+INDIRU1
+ASGNU1
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRB
+ASGNB 8
+LABELV $83
+endproc Long64Swap 12 0
+export Long64NoSwap
+proc Long64NoSwap 0 0
+ADDRFP4 0
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 8
+LABELV $92
+endproc Long64NoSwap 0 0
+export FloatSwap
+proc FloatSwap 8 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 4
+ADDRGP4 LongSwap
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+ASGNU4
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $94
+endproc FloatSwap 8 4
+export FloatNoSwap
+proc FloatNoSwap 0 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+RETF4
+LABELV $95
+endproc FloatNoSwap 0 0
+export COM_BeginParseSession
+proc COM_BeginParseSession 0 16
+ADDRGP4 com_lines
+CNSTI4 1
+ASGNI4
+ADDRGP4 com_tokenline
+CNSTI4 0
+ASGNI4
+ADDRGP4 com_parsename
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $97
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $96
+endproc COM_BeginParseSession 0 16
+export COM_GetCurrentParseLine
+proc COM_GetCurrentParseLine 0 0
+ADDRGP4 com_tokenline
+INDIRI4
+CNSTI4 0
+EQI4 $99
+ADDRGP4 com_tokenline
+INDIRI4
+RETI4
+ADDRGP4 $98
+JUMPV
+LABELV $99
+ADDRGP4 com_lines
+INDIRI4
+RETI4
+LABELV $98
+endproc COM_GetCurrentParseLine 0 0
+bss
+align 1
+LABELV $102
+skip 1024
+export Com_ParseLine
+code
+proc Com_ParseLine 28 0
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $103
+ADDRLP4 12
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $109
+ADDRLP4 20
+CNSTI4 10
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $109
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+NEI4 $106
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 20
+INDIRI4
+EQI4 $106
+LABELV $109
+ADDRGP4 $105
+JUMPV
+LABELV $106
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+CNSTU4 1023
+LTU4 $110
+ADDRGP4 $105
+JUMPV
+LABELV $110
+ADDRLP4 24
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 $102
+ADDP4
+ADDRLP4 0
+INDIRI4
+CVII1 4
+ASGNI1
+LABELV $104
+ADDRGP4 $103
+JUMPV
+LABELV $105
+ADDRLP4 4
+INDIRI4
+ADDRGP4 $102
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $102
+RETP4
+LABELV $101
+endproc Com_ParseLine 28 0
+export COM_Parse
+proc COM_Parse 4 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $112
+endproc COM_Parse 4 8
+bss
+align 1
+LABELV $114
+skip 4096
+export COM_ParseError
+code
+proc COM_ParseError 8 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRGP4 $114
+ARGP4
+CNSTU4 4096
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ADDRGP4 COM_GetCurrentParseLine
+CALLI4
+ASGNI4
+ADDRGP4 $116
+ARGP4
+ADDRGP4 com_parsename
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $114
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $113
+endproc COM_ParseError 8 16
+bss
+align 1
+LABELV $118
+skip 4096
+export COM_ParseWarning
+code
+proc COM_ParseWarning 8 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRGP4 $118
+ARGP4
+CNSTU4 4096
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ADDRGP4 COM_GetCurrentParseLine
+CALLI4
+ASGNI4
+ADDRGP4 $120
+ARGP4
+ADDRGP4 com_parsename
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $118
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $117
+endproc COM_ParseWarning 8 16
+export COM_Compress
+proc COM_Compress 48 0
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $122
+ADDRGP4 $125
+JUMPV
+LABELV $124
+ADDRLP4 24
+CNSTI4 47
+ASGNI4
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ADDRLP4 24
+INDIRI4
+NEI4 $127
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 24
+INDIRI4
+NEI4 $127
+ADDRGP4 $130
+JUMPV
+LABELV $129
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $130
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $132
+ADDRLP4 28
+INDIRI4
+CNSTI4 10
+NEI4 $129
+LABELV $132
+ADDRGP4 $128
+JUMPV
+LABELV $127
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $133
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $133
+ADDRGP4 $136
+JUMPV
+LABELV $135
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $136
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $138
+ADDRLP4 32
+INDIRI4
+CNSTI4 42
+NEI4 $135
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $135
+LABELV $138
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $134
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $134
+JUMPV
+LABELV $133
+ADDRLP4 28
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 10
+EQI4 $143
+ADDRLP4 28
+INDIRI4
+CNSTI4 13
+NEI4 $141
+LABELV $143
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ASGNP4
+ADDRGP4 $142
+JUMPV
+LABELV $141
+ADDRLP4 32
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 32
+EQI4 $146
+ADDRLP4 32
+INDIRI4
+CNSTI4 9
+NEI4 $144
+LABELV $146
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRLP4 16
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ASGNP4
+ADDRGP4 $145
+JUMPV
+LABELV $144
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $147
+ADDRLP4 36
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 36
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+CNSTI1 10
+ASGNI1
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $147
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $149
+ADDRLP4 36
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 36
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+CNSTI1 32
+ASGNI1
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $149
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 34
+NEI4 $151
+ADDRLP4 36
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 36
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 4
+INDIRI1
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $154
+JUMPV
+LABELV $153
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 40
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $155
+ADDRLP4 40
+INDIRI4
+CNSTI4 34
+EQI4 $155
+ADDRLP4 44
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 44
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 4
+INDIRI1
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $157
+LABELV $154
+ADDRGP4 $153
+JUMPV
+LABELV $155
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 34
+NEI4 $152
+ADDRLP4 40
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 40
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 4
+INDIRI1
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $152
+JUMPV
+LABELV $151
+ADDRLP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI1
+ASGNI1
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $152
+LABELV $145
+LABELV $142
+LABELV $134
+LABELV $128
+LABELV $125
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 4
+ADDRLP4 24
+INDIRI1
+ASGNI1
+ADDRLP4 24
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $124
+ADDRLP4 8
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $122
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+RETI4
+LABELV $121
+endproc COM_Compress 48 0
+export COM_ParseView
+proc COM_ParseView 40 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $162
+ADDRLP4 12
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 $163
+JUMPV
+LABELV $162
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $163
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $165
+JUMPV
+LABELV $167
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $170
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $172
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $172
+CNSTI4 0
+RETI4
+ADDRGP4 $160
+JUMPV
+LABELV $170
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+NEI4 $174
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+LABELV $174
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $168
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+LEI4 $167
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $176
+ADDRFP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $176
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $178
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $178
+CNSTI4 0
+RETI4
+ADDRGP4 $160
+JUMPV
+LABELV $176
+ADDRLP4 24
+CNSTI4 47
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 24
+INDIRI4
+NEI4 $180
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 24
+INDIRI4
+NEI4 $180
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $183
+JUMPV
+LABELV $182
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $183
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $185
+ADDRLP4 28
+INDIRI4
+CNSTI4 10
+NEI4 $182
+LABELV $185
+ADDRGP4 $181
+JUMPV
+LABELV $180
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $166
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $166
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $189
+JUMPV
+LABELV $188
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+NEI4 $191
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $191
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $189
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $193
+ADDRLP4 36
+INDIRI4
+CNSTI4 42
+NEI4 $188
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $188
+LABELV $193
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $187
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+LABELV $187
+LABELV $181
+LABELV $165
+ADDRGP4 $168
+JUMPV
+LABELV $166
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 34
+NEI4 $196
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRGP4 $199
+JUMPV
+LABELV $198
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+NEI4 $201
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $201
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $199
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $203
+ADDRLP4 20
+INDIRI4
+CNSTI4 34
+NEI4 $198
+LABELV $203
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 12
+INDIRP4
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $205
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $206
+JUMPV
+LABELV $205
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $206
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRGP4 $197
+JUMPV
+LABELV $196
+ADDRFP4 12
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $207
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $208
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+GTI4 $207
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 12
+INDIRP4
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $197
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $210
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $210
+CNSTI4 1
+RETI4
+LABELV $160
+endproc COM_ParseView 40 0
+export COM_ViewEquals
+proc COM_ViewEquals 16 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $214
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 12
+INDIRI4
+NEI4 $214
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $215
+JUMPV
+LABELV $214
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $215
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $212
+endproc COM_ViewEquals 16 12
+export COM_ViewCopy
+proc COM_ViewCopy 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+GEI4 $217
+ADDRGP4 $216
+JUMPV
+LABELV $217
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $220
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $221
+JUMPV
+LABELV $220
+ADDRLP4 4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $221
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $216
+endproc COM_ViewCopy 8 12
+export COM_ParseExt
+proc COM_ParseExt 20 16
+ADDRGP4 com_tokenline
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $223
+ADDRLP4 12
+ADDRGP4 com_token
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 12
+INDIRP4
+RETP4
+ADDRGP4 $222
+JUMPV
+LABELV $223
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 com_lines
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ADDRGP4 COM_ParseView
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $225
+ADDRFP4 0
+INDIRP4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $227
+ADDRFP4 0
+INDIRP4
+CNSTP4 0
+ASGNP4
+LABELV $227
+ADDRLP4 16
+ADDRGP4 com_token
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 16
+INDIRP4
+RETP4
+ADDRGP4 $222
+JUMPV
+LABELV $225
+ADDRGP4 com_tokenline
+ADDRLP4 0+8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 com_token
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 COM_ViewCopy
+CALLV
+pop
+ADDRGP4 com_token
+RETP4
+LABELV $222
+endproc COM_ParseExt 20 16
+proc COM_MatchToken 12 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $231
+CNSTI4 1
+ARGI4
+ADDRGP4 $233
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $231
+LABELV $230
+endproc COM_MatchToken 12 16
+export SkipBracedSection
+proc SkipBracedSection 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $235
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $238
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $239
+JUMPV
+LABELV $238
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $239
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $234
+JUMPV
+LABELV $235
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 com_lines
+ARGP4
+ADDRLP4 4
+ADDRGP4 COM_SkipBracedView
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $240
+ADDRFP4 0
+INDIRP4
+CNSTP4 0
+ASGNP4
+LABELV $240
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $234
+endproc SkipBracedSection 8 12
+export COM_SkipBracedView
+proc COM_SkipBracedView 16 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+LABELV $243
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ADDRGP4 COM_ParseView
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $246
+ADDRGP4 $245
+JUMPV
+LABELV $246
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 1
+NEI4 $248
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $251
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $252
+JUMPV
+LABELV $251
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $253
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $253
+LABELV $252
+LABELV $248
+LABELV $244
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $243
+LABELV $245
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $256
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $257
+JUMPV
+LABELV $256
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $257
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $242
+endproc COM_SkipBracedView 16 16
+export SkipRestOfLine
+proc SkipRestOfLine 13 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $262
+ADDRGP4 $258
+JUMPV
+LABELV $261
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 10
+NEI4 $264
+ADDRLP4 8
+ADDRGP4 com_lines
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $263
+JUMPV
+LABELV $264
+LABELV $262
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 8
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 0
+ADDRLP4 12
+INDIRI1
+ASGNI1
+ADDRLP4 12
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $261
+LABELV $263
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $258
+endproc SkipRestOfLine 13 0
+export Parse1DMatrix
+proc Parse1DMatrix 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $267
+ARGP4
+ADDRGP4 COM_MatchToken
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $271
+JUMPV
+LABELV $268
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $269
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $271
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $268
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $272
+ARGP4
+ADDRGP4 COM_MatchToken
+CALLV
+pop
+LABELV $266
+endproc Parse1DMatrix 16 8
+export Parse2DMatrix
+proc Parse2DMatrix 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $267
+ARGP4
+ADDRGP4 COM_MatchToken
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $277
+JUMPV
+LABELV $274
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+MULI4
+CNSTI4 2
+LSHI4
+ADDRFP4 12
+INDIRP4
+ADDP4
+ARGP4
+ADDRGP4 Parse1DMatrix
+CALLV
+pop
+LABELV $275
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $277
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $274
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $272
+ARGP4
+ADDRGP4 COM_MatchToken
+CALLV
+pop
+LABELV $273
+endproc Parse2DMatrix 8 12
+export Parse3DMatrix
+proc Parse3DMatrix 12 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $267
+ARGP4
+ADDRGP4 COM_MatchToken
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $282
+JUMPV
+LABELV $279
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 12
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRI4
+MULI4
+CNSTI4 2
+LSHI4
+ADDRFP4 16
+INDIRP4
+ADDP4
+ARGP4
+ADDRGP4 Parse2DMatrix
+CALLV
+pop
+LABELV $280
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $282
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $279
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $272
+ARGP4
+ADDRGP4 COM_MatchToken
+CALLV
+pop
+LABELV $278
+endproc Parse3DMatrix 12 16
+export Com_HexStrToInt
+proc Com_HexStrToInt 36 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $284
+CNSTI4 -1
+RETI4
+ADDRGP4 $283
+JUMPV
+LABELV $284
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+NEI4 $286
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 120
+NEI4 $286
+ADDRFP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $286
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 12
+ADDRLP4 16
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $291
+JUMPV
+LABELV $288
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 24
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 28
+ADDRLP4 20
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 48
+LTI4 $292
+ADDRLP4 28
+INDIRI4
+CNSTI4 57
+GTI4 $292
+ADDRLP4 20
+ADDRLP4 20
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CVII1 4
+ASGNI1
+ADDRGP4 $293
+JUMPV
+LABELV $292
+ADDRLP4 32
+ADDRLP4 20
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 97
+LTI4 $294
+ADDRLP4 32
+INDIRI4
+CNSTI4 102
+GTI4 $294
+ADDRLP4 20
+ADDRLP4 20
+INDIRI1
+CVII4 1
+CNSTI4 97
+SUBI4
+CNSTI4 10
+ADDI4
+CVII1 4
+ASGNI1
+ADDRGP4 $295
+JUMPV
+LABELV $294
+CNSTI4 -1
+RETI4
+ADDRGP4 $283
+JUMPV
+LABELV $295
+LABELV $293
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 20
+INDIRI1
+CVII4 1
+ADDI4
+ASGNI4
+LABELV $289
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $291
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $288
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $283
+JUMPV
+LABELV $286
+CNSTI4 -1
+RETI4
+LABELV $283
+endproc Com_HexStrToInt 36 4
+export Q_isprint
+proc Q_isprint 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $297
+ADDRLP4 0
+INDIRI4
+CNSTI4 126
+GTI4 $297
+CNSTI4 1
+RETI4
+ADDRGP4 $296
+JUMPV
+LABELV $297
+CNSTI4 0
+RETI4
+LABELV $296
+endproc Q_isprint 4 0
+export Q_islower
+proc Q_islower 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 97
+LTI4 $300
+ADDRLP4 0
+INDIRI4
+CNSTI4 122
+GTI4 $300
+CNSTI4 1
+RETI4
+ADDRGP4 $299
+JUMPV
+LABELV $300
+CNSTI4 0
+RETI4
+LABELV $299
+endproc Q_islower 4 0
+export Q_isupper
+proc Q_isupper 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 65
+LTI4 $303
+ADDRLP4 0
+INDIRI4
+CNSTI4 90
+GTI4 $303
+CNSTI4 1
+RETI4
+ADDRGP4 $302
+JUMPV
+LABELV $303
+CNSTI4 0
+RETI4
+LABELV $302
+endproc Q_isupper 4 0
+export Q_isalpha
+proc Q_isalpha 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 97
+LTI4 $309
+ADDRFP4 0
+INDIRI4
+CNSTI4 122
+LEI4 $308
+LABELV $309
+ADDRFP4 0
+INDIRI4
+CNSTI4 65
+LTI4 $306
+ADDRFP4 0
+INDIRI4
+CNSTI4 90
+GTI4 $306
+LABELV $308
+CNSTI4 1
+RETI4
+ADDRGP4 $305
+JUMPV
+LABELV $306
+CNSTI4 0
+RETI4
+LABELV $305
+endproc Q_isalpha 8 0
+export Q_isanumber
+proc Q_isanumber 16 8
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $311
+CNSTI4 0
+RETI4
+ADDRGP4 $310
+JUMPV
+LABELV $311
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 8
+ADDRGP4 strtod
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $314
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $315
+JUMPV
+LABELV $314
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $315
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $310
+endproc Q_isanumber 16 8
+export Q_isintegral
+proc Q_isintegral 8 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+NEF4 $318
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $319
+JUMPV
+LABELV $318
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $319
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $316
+endproc Q_isintegral 8 0
+export Q_strncpyz
+proc Q_strncpyz 0 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $321
+CNSTI4 0
+ARGI4
+ADDRGP4 $323
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $321
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $324
+CNSTI4 0
+ARGI4
+ADDRGP4 $326
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $324
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+GEI4 $327
+CNSTI4 0
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $327
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $320
+endproc Q_strncpyz 0 12
+export Q_stricmpn
+proc Q_stricmpn 36 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $331
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $333
+CNSTI4 0
+RETI4
+ADDRGP4 $330
+JUMPV
+LABELV $333
+CNSTI4 -1
+RETI4
+ADDRGP4 $330
+JUMPV
+LABELV $331
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $335
+CNSTI4 1
+RETI4
+ADDRGP4 $330
+JUMPV
+LABELV $335
+LABELV $337
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+ADDRLP4 8
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $340
+CNSTI4 0
+RETI4
+ADDRGP4 $330
+JUMPV
+LABELV $340
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $342
+ADDRLP4 0
+INDIRI4
+CNSTI4 97
+LTI4 $344
+ADDRLP4 0
+INDIRI4
+CNSTI4 122
+GTI4 $344
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+SUBI4
+ASGNI4
+LABELV $344
+ADDRLP4 4
+INDIRI4
+CNSTI4 97
+LTI4 $346
+ADDRLP4 4
+INDIRI4
+CNSTI4 122
+GTI4 $346
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+SUBI4
+ASGNI4
+LABELV $346
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $348
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GEI4 $351
+ADDRLP4 32
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $352
+JUMPV
+LABELV $351
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+LABELV $352
+ADDRLP4 32
+INDIRI4
+RETI4
+ADDRGP4 $330
+JUMPV
+LABELV $348
+LABELV $342
+LABELV $338
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $337
+CNSTI4 0
+RETI4
+LABELV $330
+endproc Q_stricmpn 36 0
+export Q_strncmp
+proc Q_strncmp 28 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+LABELV $354
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+ADDRLP4 8
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $357
+CNSTI4 0
+RETI4
+ADDRGP4 $353
+JUMPV
+LABELV $357
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $359
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GEI4 $362
+ADDRLP4 24
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $363
+JUMPV
+LABELV $362
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+LABELV $363
+ADDRLP4 24
+INDIRI4
+RETI4
+ADDRGP4 $353
+JUMPV
+LABELV $359
+LABELV $355
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $354
+CNSTI4 0
+RETI4
+LABELV $353
+endproc Q_strncmp 28 0
+export Q_stricmp
+proc Q_stricmp 12 12
+ADDRLP4 4
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+EQU4 $366
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+EQU4 $366
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 99999
+ARGI4
+ADDRLP4 8
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $367
+JUMPV
+LABELV $366
+ADDRLP4 0
+CNSTI4 -1
+ASGNI4
+LABELV $367
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $364
+endproc Q_stricmp 12 12
+export Q_strlwr
+proc Q_strlwr 12 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $370
+JUMPV
+LABELV $369
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $370
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $369
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $368
+endproc Q_strlwr 12 4
+export Q_strupr
+proc Q_strupr 12 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $374
+JUMPV
+LABELV $373
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 toupper
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $374
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $373
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $372
+endproc Q_strupr 12 4
+export Q_strcat
+proc Q_strcat 12 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $377
+CNSTI4 0
+ARGI4
+ADDRGP4 $379
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $377
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $376
+endproc Q_strcat 12 12
+export Q_stristr
+proc Q_stristr 36 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 8
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 1
+ADDRLP4 12
+INDIRI1
+ASGNI1
+ADDRLP4 12
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $381
+ADDRLP4 16
+ADDRLP4 1
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 97
+LTI4 $383
+ADDRLP4 16
+INDIRI4
+CNSTI4 122
+GTI4 $383
+ADDRLP4 1
+ADDRLP4 1
+INDIRI1
+CVII4 1
+CNSTI4 32
+SUBI4
+CVII1 4
+ASGNI1
+LABELV $383
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 20
+INDIRU4
+ASGNU4
+LABELV $385
+LABELV $388
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 24
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 0
+ADDRLP4 28
+INDIRI1
+ASGNI1
+ADDRLP4 28
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $391
+CNSTP4 0
+RETP4
+ADDRGP4 $380
+JUMPV
+LABELV $391
+ADDRLP4 32
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 97
+LTI4 $393
+ADDRLP4 32
+INDIRI4
+CNSTI4 122
+GTI4 $393
+ADDRLP4 0
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 32
+SUBI4
+CVII1 4
+ASGNI1
+LABELV $393
+LABELV $389
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ADDRLP4 1
+INDIRI1
+CVII4 1
+NEI4 $388
+LABELV $386
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 24
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $385
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 -1
+ADDP4
+ASGNP4
+LABELV $381
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $380
+endproc Q_stristr 36 12
+export Q_PrintStrlen
+proc Q_PrintStrlen 16 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $396
+CNSTI4 0
+RETI4
+ADDRGP4 $395
+JUMPV
+LABELV $396
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $399
+JUMPV
+LABELV $398
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_IsColorString
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $401
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $399
+JUMPV
+LABELV $401
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $399
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $398
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $395
+endproc Q_PrintStrlen 16 4
+export Q_CleanStr
+proc Q_CleanStr 28 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $405
+JUMPV
+LABELV $404
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_IsColorString
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $407
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $408
+JUMPV
+LABELV $407
+ADDRLP4 20
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 32
+LTI4 $409
+ADDRLP4 20
+INDIRI4
+CNSTI4 126
+GTI4 $409
+ADDRLP4 24
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 4
+INDIRI1
+ASGNI1
+LABELV $409
+LABELV $408
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $405
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 4
+ADDRLP4 16
+INDIRI1
+ASGNI1
+ADDRLP4 16
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $404
+ADDRLP4 8
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $403
+endproc Q_CleanStr 28 4
+export Q_CountChar
+proc Q_CountChar 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $415
+JUMPV
+LABELV $412
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRFP4 4
+INDIRI1
+CVII4 1
+NEI4 $416
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $416
+LABELV $413
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $415
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $412
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $411
+endproc Q_CountChar 4 0
+export Com_sprintf
+proc Com_sprintf 12 16
+ADDRLP4 4
+ADDRFP4 8+4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_vsnprintf
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $420
+ADDRGP4 $422
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $420
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $418
+endproc Com_sprintf 12 16
+bss
+align 1
+LABELV $424
+skip 64000
+data
+align 4
+LABELV $425
+byte 4 0
+export va
+code
+proc va 20 16
+ADDRLP4 8
+ADDRGP4 $425
+ASGNP4
+ADDRLP4 12
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+CNSTI4 32000
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+BANDI4
+MULI4
+ADDRGP4 $424
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTU4 32000
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+INDIRP4
+RETP4
+LABELV $423
+endproc va 20 16
+export Com_TruncateLongString
+proc Com_TruncateLongString 8 12
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+GTI4 $428
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $429
+JUMPV
+LABELV $428
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 29
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $430
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI4 -29
+ADDP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $429
+LABELV $427
+endproc Com_TruncateLongString 8 12
+bss
+align 1
+LABELV $432
+skip 16384
+data
+align 4
+LABELV $433
+byte 4 0
+export Info_ValueForKey
+code
+proc Info_ValueForKey 8220 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8196
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 8196
+INDIRU4
+EQU4 $436
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 8196
+INDIRU4
+NEU4 $434
+LABELV $436
+ADDRGP4 $58
+RETP4
+ADDRGP4 $431
+JUMPV
+LABELV $434
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8200
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8200
+INDIRU4
+CNSTU4 8192
+LTU4 $437
+CNSTI4 1
+ARGI4
+ADDRGP4 $439
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $437
+ADDRLP4 8204
+ADDRGP4 $433
+ASGNP4
+ADDRLP4 8204
+INDIRP4
+ADDRLP4 8204
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $443
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $443
+JUMPV
+LABELV $442
+ADDRLP4 0
+ADDRLP4 4
+ASGNP4
+ADDRGP4 $446
+JUMPV
+LABELV $445
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $448
+ADDRGP4 $58
+RETP4
+ADDRGP4 $431
+JUMPV
+LABELV $448
+ADDRLP4 8208
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8216
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8208
+INDIRP4
+ADDRLP4 8216
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8212
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 8212
+INDIRP4
+ADDRLP4 8216
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8208
+INDIRP4
+ADDRLP4 8212
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $446
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $445
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $433
+INDIRI4
+CNSTI4 13
+LSHI4
+ADDRGP4 $432
+ADDP4
+ASGNP4
+ADDRGP4 $451
+JUMPV
+LABELV $450
+ADDRLP4 8208
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8216
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8208
+INDIRP4
+ADDRLP4 8216
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8212
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 8212
+INDIRP4
+ADDRLP4 8216
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8208
+INDIRP4
+ADDRLP4 8212
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $451
+ADDRLP4 8208
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 8208
+INDIRI4
+CNSTI4 92
+EQI4 $453
+ADDRLP4 8208
+INDIRI4
+CNSTI4 0
+NEI4 $450
+LABELV $453
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8212
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8212
+INDIRI4
+CNSTI4 0
+NEI4 $454
+ADDRGP4 $433
+INDIRI4
+CNSTI4 13
+LSHI4
+ADDRGP4 $432
+ADDP4
+RETP4
+ADDRGP4 $431
+JUMPV
+LABELV $454
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $456
+ADDRGP4 $444
+JUMPV
+LABELV $456
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $443
+ADDRGP4 $442
+JUMPV
+LABELV $444
+ADDRGP4 $58
+RETP4
+LABELV $431
+endproc Info_ValueForKey 8220 8
+export Info_NextPair
+proc Info_NextPair 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $459
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $459
+ADDRFP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 8
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $462
+JUMPV
+LABELV $461
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $464
+ADDRLP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $458
+JUMPV
+LABELV $464
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $462
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $461
+ADDRLP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $467
+JUMPV
+LABELV $466
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $467
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 92
+EQI4 $469
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $466
+LABELV $469
+ADDRLP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $458
+endproc Info_NextPair 20 0
+export Info_RemoveKey
+proc Info_RemoveKey 2080 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2056
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 2056
+INDIRU4
+CNSTU4 1024
+LTU4 $471
+CNSTI4 1
+ARGI4
+ADDRGP4 $473
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $471
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 92
+ARGI4
+ADDRLP4 2060
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 2060
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $477
+ADDRGP4 $470
+JUMPV
+LABELV $476
+ADDRLP4 1028
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $479
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $479
+ADDRLP4 0
+ADDRLP4 4
+ASGNP4
+ADDRGP4 $482
+JUMPV
+LABELV $481
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $484
+ADDRGP4 $470
+JUMPV
+LABELV $484
+ADDRLP4 2068
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 2076
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 2068
+INDIRP4
+ADDRLP4 2076
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 2072
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 2072
+INDIRP4
+ADDRLP4 2076
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 2068
+INDIRP4
+ADDRLP4 2072
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $482
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $481
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1032
+ASGNP4
+ADDRGP4 $487
+JUMPV
+LABELV $486
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $489
+ADDRGP4 $470
+JUMPV
+LABELV $489
+ADDRLP4 2068
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 2076
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 2068
+INDIRP4
+ADDRLP4 2076
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 2072
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 2072
+INDIRP4
+ADDRLP4 2076
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 2068
+INDIRP4
+ADDRLP4 2072
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $487
+ADDRLP4 2068
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 2068
+INDIRI4
+CNSTI4 92
+EQI4 $491
+ADDRLP4 2068
+INDIRI4
+CNSTI4 0
+NEI4 $486
+LABELV $491
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 2072
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 2072
+INDIRI4
+CNSTI4 0
+NEI4 $492
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2076
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2076
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRGP4 $470
+JUMPV
+LABELV $492
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $494
+ADDRGP4 $470
+JUMPV
+LABELV $494
+LABELV $477
+ADDRGP4 $476
+JUMPV
+LABELV $470
+endproc Info_RemoveKey 2080 12
+export Info_RemoveKey_Big
+proc Info_RemoveKey_Big 16416 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16392
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 16392
+INDIRU4
+CNSTU4 8192
+LTU4 $497
+CNSTI4 1
+ARGI4
+ADDRGP4 $499
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $497
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 92
+ARGI4
+ADDRLP4 16396
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 16396
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $503
+ADDRGP4 $496
+JUMPV
+LABELV $502
+ADDRLP4 8196
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $505
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $505
+ADDRLP4 0
+ADDRLP4 4
+ASGNP4
+ADDRGP4 $508
+JUMPV
+LABELV $507
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $510
+ADDRGP4 $496
+JUMPV
+LABELV $510
+ADDRLP4 16404
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16412
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16404
+INDIRP4
+ADDRLP4 16412
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 16408
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 16408
+INDIRP4
+ADDRLP4 16412
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 16404
+INDIRP4
+ADDRLP4 16408
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $508
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $507
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8200
+ASGNP4
+ADDRGP4 $513
+JUMPV
+LABELV $512
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $515
+ADDRGP4 $496
+JUMPV
+LABELV $515
+ADDRLP4 16404
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16412
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16404
+INDIRP4
+ADDRLP4 16412
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 16408
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 16408
+INDIRP4
+ADDRLP4 16412
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 16404
+INDIRP4
+ADDRLP4 16408
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $513
+ADDRLP4 16404
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16404
+INDIRI4
+CNSTI4 92
+EQI4 $517
+ADDRLP4 16404
+INDIRI4
+CNSTI4 0
+NEI4 $512
+LABELV $517
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 16408
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 16408
+INDIRI4
+CNSTI4 0
+NEI4 $518
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16412
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8196
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16412
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRGP4 $496
+JUMPV
+LABELV $518
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $520
+ADDRGP4 $496
+JUMPV
+LABELV $520
+LABELV $503
+ADDRGP4 $502
+JUMPV
+LABELV $496
+endproc Info_RemoveKey_Big 16416 12
+export Info_Validate
+proc Info_Validate 8 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 34
+ARGI4
+ADDRLP4 0
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $523
+CNSTI4 0
+RETI4
+ADDRGP4 $522
+JUMPV
+LABELV $523
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 59
+ARGI4
+ADDRLP4 4
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $525
+CNSTI4 0
+RETI4
+ADDRGP4 $522
+JUMPV
+LABELV $525
+CNSTI4 1
+RETI4
+LABELV $522
+endproc Info_Validate 8 8
+export StringDump_Push
+proc StringDump_Push 1036 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $528
+ASGNP4
+ADDRGP4 $532
+JUMPV
+LABELV $529
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 1028
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $533
+ADDRGP4 $535
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $527
+JUMPV
+LABELV $533
+LABELV $530
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $532
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $529
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $536
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1028
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1028
+INDIRU4
+ADDRLP4 1032
+INDIRU4
+ADDU4
+CNSTU4 1024
+LTU4 $537
+ADDRGP4 $539
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $527
+JUMPV
+LABELV $537
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $527
+endproc StringDump_Push 1036 16
+export StringDump_GetNext
+proc StringDump_GetNext 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $541
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $541
+ADDRFP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $544
+JUMPV
+LABELV $543
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $546
+ADDRLP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $540
+JUMPV
+LABELV $546
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $544
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $543
+ADDRLP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $540
+endproc StringDump_GetNext 20 0
+export Info_SetValueForKey
+proc Info_SetValueForKey 1048 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $528
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1028
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1028
+INDIRU4
+CNSTU4 1024
+LTU4 $555
+CNSTI4 1
+ARGI4
+ADDRGP4 $551
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+ADDRGP4 $555
+JUMPV
+LABELV $552
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 1032
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $558
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 1036
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $556
+LABELV $558
+ADDRGP4 $559
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $548
+JUMPV
+LABELV $556
+LABELV $553
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $555
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $552
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Info_RemoveKey
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $562
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1036
+INDIRU4
+CNSTU4 0
+NEU4 $560
+LABELV $562
+ADDRGP4 $548
+JUMPV
+LABELV $560
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $563
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1040
+INDIRU4
+ADDRLP4 1044
+INDIRU4
+ADDU4
+CNSTU4 1024
+LTU4 $564
+ADDRGP4 $539
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $548
+JUMPV
+LABELV $564
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $548
+endproc Info_SetValueForKey 1048 20
+export Info_SetValueForKey_Big
+proc Info_SetValueForKey_Big 8208 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $528
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8196
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8196
+INDIRU4
+CNSTU4 8192
+LTU4 $572
+CNSTI4 1
+ARGI4
+ADDRGP4 $551
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+ADDRGP4 $572
+JUMPV
+LABELV $569
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8200
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 8200
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $575
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8204
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 8204
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $573
+LABELV $575
+ADDRGP4 $559
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $566
+JUMPV
+LABELV $573
+LABELV $570
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $572
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $569
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Info_RemoveKey_Big
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $576
+ADDRGP4 $566
+JUMPV
+LABELV $576
+ADDRLP4 4
+ARGP4
+CNSTI4 8192
+ARGI4
+ADDRGP4 $563
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 8200
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8204
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8200
+INDIRU4
+ADDRLP4 8204
+INDIRU4
+ADDU4
+CNSTU4 8192
+LTU4 $578
+ADDRGP4 $580
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $566
+JUMPV
+LABELV $578
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $566
+endproc Info_SetValueForKey_Big 8208 20
+proc Info_DictHash 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTU4 0
+ASGNU4
+ADDRGP4 $583
+JUMPV
+LABELV $582
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CVIU4 4
+CVUU1 4
+CVUI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTU4 31
+ADDRLP4 0
+INDIRU4
+MULU4
+ADDRLP4 8
+INDIRI4
+CVIU4 4
+ADDU4
+ASGNU4
+LABELV $583
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $582
+ADDRLP4 0
+INDIRU4
+CNSTU4 63
+BANDU4
+CVUI4 4
+RETI4
+LABELV $581
+endproc Info_DictHash 12 4
+proc Info_DictFind 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1556
+ADDP4
+ADDP4
+INDIRI2
+CVII4 2
+ASGNI4
+ADDRGP4 $589
+JUMPV
+LABELV $586
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+INDIRI2
+CVII4 2
+ADDRFP4 0
+INDIRP4
+CNSTI4 1684
+ADDP4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $590
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $585
+JUMPV
+LABELV $590
+LABELV $587
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1044
+ADDP4
+ADDP4
+INDIRI2
+CVII4 2
+ASGNI4
+LABELV $589
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $586
+CNSTI4 -1
+RETI4
+LABELV $585
+endproc Info_DictFind 12 8
+proc Info_DictLink 20 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+INDIRI2
+CVII4 2
+ADDRFP4 0
+INDIRP4
+CNSTI4 1684
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Info_DictHash
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1044
+ADDP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1556
+ADDP4
+ADDP4
+INDIRI2
+ASGNI2
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1556
+ADDP4
+ADDP4
+ADDRFP4 4
+INDIRI4
+CVII2 4
+ASGNI2
+LABELV $592
+endproc Info_DictLink 20 4
+proc Info_DictClear 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $594
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1556
+ADDP4
+ADDP4
+CNSTI2 -1
+ASGNI2
+LABELV $595
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $594
+LABELV $593
+endproc Info_DictClear 4 0
+bss
+align 1
+LABELV $599
+skip 8192
+code
+proc Info_DictCompact 72 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $603
+JUMPV
+LABELV $600
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+INDIRI2
+CVII4 2
+CNSTI4 0
+GEI4 $604
+ADDRGP4 $601
+JUMPV
+LABELV $604
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+INDIRI2
+CVII4 2
+ADDRFP4 0
+INDIRP4
+CNSTI4 1684
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 24
+INDIRU4
+CNSTU4 1
+ADDU4
+CVUI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 $599
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+INDIRI2
+CVII4 2
+ADDRFP4 0
+INDIRP4
+CNSTI4 1684
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRI4
+CVII2 4
+ASGNI2
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDP4
+INDIRI2
+CVII4 2
+ADDRFP4 0
+INDIRP4
+CNSTI4 1684
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 36
+INDIRU4
+CNSTU4 1
+ADDU4
+CVUI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 $599
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDP4
+INDIRI2
+CVII4 2
+ADDRFP4 0
+INDIRP4
+CNSTI4 1684
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRI4
+CVII2 4
+ASGNI2
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $601
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $603
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $600
+ADDRFP4 0
+INDIRP4
+CNSTI4 1684
+ADDP4
+ARGP4
+ADDRGP4 $599
+ARGP4
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Info_DictClear
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $609
+JUMPV
+LABELV $606
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+INDIRI2
+CVII4 2
+CNSTI4 0
+GEI4 $610
+ADDRGP4 $607
+JUMPV
+LABELV $610
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LSHI4
+ADDRLP4 28
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LSHI4
+ADDRLP4 28
+INDIRP4
+ADDP4
+INDIRI2
+ASGNI2
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LSHI4
+ADDRLP4 40
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LSHI4
+ADDRLP4 40
+INDIRP4
+ADDP4
+INDIRI2
+ASGNI2
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+INDIRI2
+CVII4 2
+ADDRFP4 0
+INDIRP4
+CNSTI4 1684
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDP4
+INDIRI2
+CVII4 2
+ADDRFP4 0
+INDIRP4
+CNSTI4 1684
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+CVIU4 4
+ADDRLP4 48
+INDIRU4
+ADDRLP4 56
+INDIRU4
+ADDU4
+CNSTU4 2
+ADDU4
+ADDU4
+CVUI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Info_DictLink
+CALLV
+pop
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $607
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $609
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $606
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $598
+endproc Info_DictCompact 72 12
+export Info_DictInit
+proc Info_DictInit 0 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 8192
+LEI4 $613
+ADDRFP4 4
+CNSTI4 8192
+ASGNI4
+LABELV $613
+ADDRFP4 0
+INDIRP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Info_DictClear
+CALLV
+pop
+LABELV $612
+endproc Info_DictInit 0 4
+export Info_DictParse
+proc Info_DictParse 80 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 8191
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Info_DictClear
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $619
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $619
+JUMPV
+LABELV $618
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $622
+JUMPV
+LABELV $621
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $626
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LTI4 $624
+LABELV $626
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $615
+JUMPV
+LABELV $624
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 28
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 24
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1684
+ADDP4
+ADDP4
+ADDRLP4 24
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $622
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $621
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 24
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1684
+ADDP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $628
+JUMPV
+LABELV $627
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LTI4 $630
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $615
+JUMPV
+LABELV $630
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 36
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 32
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1684
+ADDP4
+ADDP4
+ADDRLP4 32
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $628
+ADDRLP4 28
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 92
+EQI4 $632
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $627
+LABELV $632
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 36
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1684
+ADDP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $633
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $633
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+LTI4 $635
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $615
+JUMPV
+LABELV $635
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1684
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 48
+INDIRI4
+NEI4 $640
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+EQI4 $639
+LABELV $640
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1684
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 Info_DictHash
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1684
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 Info_DictFind
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+LTI4 $637
+LABELV $639
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $619
+JUMPV
+LABELV $637
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+ADDRLP4 8
+INDIRI4
+CVII2 4
+ASGNI2
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDP4
+ADDRLP4 12
+INDIRI4
+CVII2 4
+ASGNI2
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Info_DictLink
+CALLV
+pop
+ADDRLP4 76
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+LABELV $619
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $641
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 256
+LTI4 $618
+LABELV $641
+LABELV $615
+endproc Info_DictParse 80 12
+export Info_DictValue
+proc Info_DictValue 16 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $643
+ADDRGP4 $58
+RETP4
+ADDRGP4 $642
+JUMPV
+LABELV $643
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Info_DictHash
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 Info_DictFind
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $645
+ADDRGP4 $58
+RETP4
+ADDRGP4 $642
+JUMPV
+LABELV $645
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDP4
+INDIRI2
+CVII4 2
+ADDRFP4 0
+INDIRP4
+CNSTI4 1684
+ADDP4
+ADDP4
+RETP4
+LABELV $642
+endproc Info_DictValue 16 12
+export Info_DictRemove
+proc Info_DictRemove 40 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Info_DictHash
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1556
+ADDP4
+ADDP4
+ASGNP4
+ADDRGP4 $651
+JUMPV
+LABELV $648
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+INDIRI2
+CVII4 2
+ADDRFP4 0
+INDIRP4
+CNSTI4 1684
+ADDP4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $652
+ADDRGP4 $650
+JUMPV
+LABELV $652
+LABELV $649
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1044
+ADDP4
+ADDP4
+ASGNP4
+LABELV $651
+ADDRLP4 16
+ADDRLP4 4
+INDIRP4
+INDIRI2
+CVII4 2
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+GEI4 $648
+LABELV $650
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $654
+ADDRGP4 $647
+JUMPV
+LABELV $654
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1044
+ADDP4
+ADDP4
+INDIRI2
+ASGNI2
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+INDIRI2
+CVII4 2
+ADDRFP4 0
+INDIRP4
+CNSTI4 1684
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDP4
+INDIRI2
+CVII4 2
+ADDRFP4 0
+INDIRP4
+CNSTI4 1684
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CVIU4 4
+ADDRLP4 24
+INDIRU4
+ADDRLP4 32
+INDIRU4
+ADDU4
+CNSTU4 2
+ADDU4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+CNSTI2 -1
+ASGNI2
+LABELV $647
+endproc Info_DictRemove 40 8
+export Info_DictSet
+proc Info_DictSet 88 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $528
+ASGNP4
+ADDRGP4 $660
+JUMPV
+LABELV $657
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 28
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 32
+CNSTU4 0
+ASGNU4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+ADDRLP4 32
+INDIRU4
+NEU4 $663
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+ADDRLP4 32
+INDIRU4
+EQU4 $661
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 40
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $661
+LABELV $663
+ADDRGP4 $559
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $656
+JUMPV
+LABELV $661
+LABELV $658
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $660
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $657
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $666
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 32
+INDIRI4
+NEI4 $664
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+NEI4 $664
+LABELV $666
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Info_DictRemove
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $656
+JUMPV
+LABELV $664
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 12
+ADDRLP4 36
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 40
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 Info_DictHash
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 Info_DictFind
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $667
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDP4
+INDIRI2
+CVII4 2
+ADDRFP4 0
+INDIRP4
+CNSTI4 1684
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 24
+ADDRLP4 56
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $668
+JUMPV
+LABELV $667
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+CNSTI4 2
+ADDI4
+ASGNI4
+LABELV $668
+ADDRLP4 16
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+LTI4 $669
+ADDRGP4 $539
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $656
+JUMPV
+LABELV $669
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $671
+ADDRLP4 8
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LEI4 $673
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+CNSTI4 1
+ADDI4
+CNSTI4 8192
+LEI4 $675
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDP4
+INDIRI2
+CVII4 2
+ADDRFP4 0
+INDIRP4
+CNSTI4 1684
+ADDP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Info_DictCompact
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 Info_DictFind
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 56
+INDIRI4
+ASGNI4
+LABELV $675
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CVII2 4
+ASGNI2
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDI4
+ASGNI4
+LABELV $673
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDP4
+INDIRI2
+CVII4 2
+ADDRFP4 0
+INDIRP4
+CNSTI4 1684
+ADDP4
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 52
+INDIRI4
+ADDI4
+CVIU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $656
+JUMPV
+LABELV $671
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 256
+EQI4 $679
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+CNSTI4 2
+ADDI4
+CNSTI4 8192
+LEI4 $677
+LABELV $679
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Info_DictCompact
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 256
+NEI4 $680
+ADDRGP4 $682
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $656
+JUMPV
+LABELV $680
+LABELV $677
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 60
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 56
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CVII2 4
+ASGNI2
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1684
+ADDP4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+CVIU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 72
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CVII2 4
+ASGNI2
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1684
+ADDP4
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+CVIU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 84
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Info_DictLink
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $656
+endproc Info_DictSet 88 16
+export Info_DictWrite
+proc Info_DictWrite 56 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $687
+JUMPV
+LABELV $684
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+INDIRI2
+CVII4 2
+CNSTI4 0
+GEI4 $688
+ADDRGP4 $685
+JUMPV
+LABELV $688
+ADDRLP4 28
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LSHI4
+ASGNI4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 1684
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+INDIRI2
+CVII4 2
+ADDRLP4 36
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDP4
+INDIRI2
+CVII4 2
+ADDRLP4 36
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 40
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 12
+ADDRLP4 44
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+CNSTI4 2
+ADDI4
+ADDRFP4 8
+INDIRI4
+LTI4 $690
+ADDRGP4 $686
+JUMPV
+LABELV $690
+ADDRLP4 48
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI1 92
+ASGNI1
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 52
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI1 92
+ASGNI1
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $685
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $687
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+LTI4 $684
+LABELV $686
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+LEI4 $692
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $692
+LABELV $683
+endproc Info_DictWrite 56 12
+proc Com_CharIsOneOfCharset 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $698
+JUMPV
+LABELV $695
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRFP4 0
+INDIRI1
+CVII4 1
+NEI4 $699
+CNSTI4 1
+RETI4
+ADDRGP4 $694
+JUMPV
+LABELV $699
+LABELV $696
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $698
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+ADDRLP4 4
+INDIRU4
+LTU4 $695
+CNSTI4 0
+RETI4
+LABELV $694
+endproc Com_CharIsOneOfCharset 8 4
+export Com_SkipCharset
+proc Com_SkipCharset 8 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $703
+JUMPV
+LABELV $702
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Com_CharIsOneOfCharset
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $704
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $706
+LABELV $703
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $702
+LABELV $704
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $701
+endproc Com_SkipCharset 8 8
+export Com_SkipTokens
+proc Com_SkipTokens 20 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $709
+JUMPV
+LABELV $708
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Com_CharIsOneOfCharset
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $711
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $714
+JUMPV
+LABELV $713
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $714
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Com_CharIsOneOfCharset
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $713
+ADDRGP4 $712
+JUMPV
+LABELV $711
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $716
+ADDRGP4 $710
+JUMPV
+LABELV $716
+LABELV $712
+LABELV $709
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $708
+LABELV $710
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $718
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $707
+JUMPV
+LABELV $718
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $707
+endproc Com_SkipTokens 20 8
+bss
+align 4
+LABELV com_tokenline
+skip 4
+align 4
+LABELV com_lines
+skip 4
+align 1
+LABELV com_parsename
+skip 1024
+align 1
+LABELV com_token
+skip 1024
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import Com_RandomBytes
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $682
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $580
+byte 1 66
+byte 1 73
+byte 1 71
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $563
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $559
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 99
+byte 1 39
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $551
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 86
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $539
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $536
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $535
+byte 1 94
+byte 1 51
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 68
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 95
+byte 1 80
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 32
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 99
+byte 1 39
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $528
+byte 1 92
+byte 1 59
+byte 1 34
+byte 1 0
+align 1
+LABELV $499
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 66
+byte 1 105
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $473
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $439
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 86
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $430
+byte 1 32
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 32
+byte 1 0
+align 1
+LABELV $422
+byte 1 67
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 102
+byte 1 58
+byte 1 32
+byte 1 79
+byte 1 117
+byte 1 116
+byte 1 112
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 44
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $379
+byte 1 81
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $329
+byte 1 81
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 110
+byte 1 99
+byte 1 112
+byte 1 121
+byte 1 122
+byte 1 58
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 60
+byte 1 32
+byte 1 49
+byte 1 0
+align 1
+LABELV $326
+byte 1 81
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 110
+byte 1 99
+byte 1 112
+byte 1 121
+byte 1 122
+byte 1 58
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 32
+byte 1 115
+byte 1 114
+byte 1 99
+byte 1 0
+align 1
+LABELV $323
+byte 1 81
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 110
+byte 1 99
+byte 1 112
+byte 1 121
+byte 1 122
+byte 1 58
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $272
+byte 1 41
+byte 1 0
+align 1
+LABELV $267
+byte 1 40
+byte 1 0
+align 1
+LABELV $233
+byte 1 77
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 84
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 33
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $120
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $116
+byte 1 69
+byte 1 82
+byte 1 82
+byte 1 79
+byte 1 82
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $97
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $58
+byte 1 0
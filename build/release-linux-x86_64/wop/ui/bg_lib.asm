@@ -0,0 +1,8202 @@
+code
+proc swapfunc 24 0
+ADDRFP4 12
+INDIRI4
+CNSTI4 1
+GTI4 $27
+ADDRLP4 8
+ADDRFP4 8
+INDIRI4
+CVIU4 4
+CNSTI4 2
+RSHU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+LABELV $29
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $30
+ADDRLP4 12
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+GTI4 $29
+ADDRGP4 $28
+JUMPV
+LABELV $27
+ADDRLP4 8
+ADDRFP4 8
+INDIRI4
+CVIU4 4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+LABELV $32
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 12
+INDIRI1
+ASGNI1
+LABELV $33
+ADDRLP4 12
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+GTI4 $32
+LABELV $28
+LABELV $26
+endproc swapfunc 24 0
+proc med3 40 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+GEI4 $41
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+GEI4 $43
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $44
+JUMPV
+LABELV $43
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+GEI4 $45
+ADDRLP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $46
+JUMPV
+LABELV $45
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $46
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+LABELV $44
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $42
+JUMPV
+LABELV $41
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+LEI4 $47
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $48
+JUMPV
+LABELV $47
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+GEI4 $49
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $50
+JUMPV
+LABELV $49
+ADDRLP4 16
+ADDRFP4 8
+INDIRP4
+ASGNP4
+LABELV $50
+ADDRLP4 12
+ADDRLP4 16
+INDIRP4
+ASGNP4
+LABELV $48
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+LABELV $42
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $35
+endproc med3 40 8
+export qsort
+proc qsort 124 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRU4
+ASGNU4
+ADDRFP4 8
+ADDRFP4 8
+INDIRU4
+ASGNU4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+LABELV $52
+ADDRLP4 52
+CNSTU4 3
+ASGNU4
+ADDRLP4 56
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CVUI4 4
+CVIU4 4
+ADDRLP4 52
+INDIRU4
+BANDU4
+ADDRLP4 56
+INDIRU4
+NEU4 $57
+ADDRFP4 8
+INDIRU4
+ADDRLP4 52
+INDIRU4
+BANDU4
+ADDRLP4 56
+INDIRU4
+EQU4 $55
+LABELV $57
+ADDRLP4 44
+CNSTI4 2
+ASGNI4
+ADDRGP4 $56
+JUMPV
+LABELV $55
+ADDRFP4 8
+INDIRU4
+CNSTU4 4
+NEU4 $58
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRGP4 $59
+JUMPV
+LABELV $58
+ADDRLP4 48
+CNSTI4 1
+ASGNI4
+LABELV $59
+ADDRLP4 44
+ADDRLP4 48
+INDIRI4
+ASGNI4
+LABELV $56
+ADDRLP4 16
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRU4
+CNSTU4 7
+GEU4 $60
+ADDRLP4 32
+ADDRFP4 8
+INDIRU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRGP4 $65
+JUMPV
+LABELV $62
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRGP4 $69
+JUMPV
+LABELV $66
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $70
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 $71
+JUMPV
+LABELV $70
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $71
+LABELV $67
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+ASGNP4
+LABELV $69
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+LEU4 $72
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+GTI4 $66
+LABELV $72
+LABELV $63
+ADDRLP4 32
+ADDRFP4 8
+INDIRU4
+ADDRLP4 32
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $65
+ADDRLP4 32
+INDIRP4
+CVPU4 4
+ADDRFP4 4
+INDIRU4
+ADDRFP4 8
+INDIRU4
+MULU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CVPU4 4
+LTU4 $62
+ADDRGP4 $51
+JUMPV
+LABELV $60
+ADDRLP4 32
+ADDRFP4 4
+INDIRU4
+CNSTI4 1
+RSHU4
+ADDRFP4 8
+INDIRU4
+MULU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRU4
+CNSTU4 7
+LEU4 $73
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRFP4 4
+INDIRU4
+CNSTU4 1
+SUBU4
+ADDRFP4 8
+INDIRU4
+MULU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRU4
+CNSTU4 40
+LEU4 $75
+ADDRLP4 40
+ADDRFP4 4
+INDIRU4
+CNSTI4 3
+RSHU4
+ADDRFP4 8
+INDIRU4
+MULU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 med3
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 88
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 88
+INDIRI4
+SUBP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 88
+INDIRI4
+ADDRLP4 32
+INDIRP4
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 med3
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRLP4 100
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+LSHI4
+SUBP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 100
+INDIRI4
+SUBP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 med3
+CALLP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 104
+INDIRP4
+ASGNP4
+LABELV $75
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 med3
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 72
+INDIRP4
+ASGNP4
+LABELV $73
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $77
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRGP4 $78
+JUMPV
+LABELV $77
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $78
+ADDRLP4 72
+ADDRFP4 8
+INDIRU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRLP4 76
+ADDRFP4 4
+INDIRU4
+CNSTU4 1
+SUBU4
+ADDRFP4 8
+INDIRU4
+MULU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRGP4 $84
+JUMPV
+LABELV $83
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $86
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $88
+ADDRLP4 80
+ADDRLP4 20
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRGP4 $89
+JUMPV
+LABELV $88
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $89
+ADDRLP4 20
+ADDRFP4 8
+INDIRU4
+ADDRLP4 20
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $86
+ADDRLP4 4
+ADDRFP4 8
+INDIRU4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $84
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+GTU4 $90
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+LEI4 $83
+LABELV $90
+ADDRGP4 $92
+JUMPV
+LABELV $91
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $94
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $96
+ADDRLP4 88
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRGP4 $97
+JUMPV
+LABELV $96
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $97
+ADDRLP4 24
+ADDRLP4 24
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+ASGNP4
+LABELV $94
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+ASGNP4
+LABELV $92
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+GTU4 $98
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+GEI4 $91
+LABELV $98
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+LEU4 $99
+ADDRGP4 $81
+JUMPV
+LABELV $99
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $101
+ADDRLP4 96
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRGP4 $102
+JUMPV
+LABELV $101
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $102
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRFP4 8
+INDIRU4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+ASGNP4
+ADDRGP4 $84
+JUMPV
+LABELV $81
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $103
+ADDRLP4 32
+ADDRFP4 8
+INDIRU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRGP4 $108
+JUMPV
+LABELV $105
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRGP4 $112
+JUMPV
+LABELV $109
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $113
+ADDRLP4 80
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRGP4 $114
+JUMPV
+LABELV $113
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $114
+LABELV $110
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+ASGNP4
+LABELV $112
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+LEU4 $115
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+GTI4 $109
+LABELV $115
+LABELV $106
+ADDRLP4 32
+ADDRFP4 8
+INDIRU4
+ADDRLP4 32
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $108
+ADDRLP4 32
+INDIRP4
+CVPU4 4
+ADDRFP4 4
+INDIRU4
+ADDRFP4 8
+INDIRU4
+MULU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CVPU4 4
+LTU4 $105
+ADDRGP4 $51
+JUMPV
+LABELV $103
+ADDRLP4 36
+ADDRFP4 4
+INDIRU4
+ADDRFP4 8
+INDIRU4
+MULU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 88
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 88
+INDIRU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 88
+INDIRU4
+SUBU4
+CVUI4 4
+GEI4 $117
+ADDRLP4 80
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $118
+JUMPV
+LABELV $117
+ADDRLP4 80
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+LABELV $118
+ADDRLP4 12
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LEI4 $119
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+SUBP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $119
+ADDRLP4 100
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 100
+INDIRU4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CVIU4 4
+ADDRLP4 36
+INDIRP4
+CVPU4 4
+ADDRLP4 100
+INDIRU4
+SUBU4
+CVUI4 4
+CVIU4 4
+ADDRFP4 8
+INDIRU4
+SUBU4
+GEU4 $122
+ADDRLP4 96
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CVIU4 4
+ASGNU4
+ADDRGP4 $123
+JUMPV
+LABELV $122
+ADDRLP4 96
+ADDRLP4 36
+INDIRP4
+CVPU4 4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CVIU4 4
+ADDRFP4 8
+INDIRU4
+SUBU4
+ASGNU4
+LABELV $123
+ADDRLP4 12
+ADDRLP4 96
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LEI4 $124
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 12
+INDIRI4
+SUBP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $124
+ADDRLP4 108
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CVIU4 4
+ADDRFP4 8
+INDIRU4
+LEU4 $126
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+CVIU4 4
+ADDRFP4 8
+INDIRU4
+DIVU4
+ARGU4
+ADDRFP4 8
+INDIRU4
+ARGU4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+LABELV $126
+ADDRLP4 116
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CVIU4 4
+ADDRFP4 8
+INDIRU4
+LEU4 $128
+ADDRFP4 0
+ADDRLP4 36
+INDIRP4
+ADDRLP4 12
+INDIRI4
+SUBP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 12
+INDIRI4
+CVIU4 4
+ADDRFP4 8
+INDIRU4
+DIVU4
+ASGNU4
+ADDRGP4 $52
+JUMPV
+LABELV $128
+LABELV $51
+endproc qsort 124 16
+export strcat
+proc strcat 16 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $132
+JUMPV
+LABELV $131
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $132
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $131
+ADDRGP4 $135
+JUMPV
+LABELV $134
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $135
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $134
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $130
+endproc strcat 16 0
+export strcpy
+proc strcpy 16 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $139
+JUMPV
+LABELV $138
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $139
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $138
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $137
+endproc strcpy 16 0
+export strcmp
+proc strcmp 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $143
+JUMPV
+LABELV $142
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $143
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $146
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $146
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $142
+LABELV $146
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+SUBI4
+RETI4
+LABELV $141
+endproc strcmp 12 0
+export strchr
+proc strchr 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $149
+JUMPV
+LABELV $148
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRFP4 4
+INDIRI4
+NEI4 $151
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $147
+JUMPV
+LABELV $151
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $149
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $148
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $153
+CNSTP4 0
+RETP4
+ADDRGP4 $147
+JUMPV
+LABELV $153
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $147
+endproc strchr 0 0
+export strrchr
+proc strrchr 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $157
+JUMPV
+LABELV $156
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRFP4 4
+INDIRI4
+NEI4 $159
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $159
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $157
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $156
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $161
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $155
+JUMPV
+LABELV $161
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $155
+endproc strrchr 4 0
+export strstr
+proc strstr 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $165
+JUMPV
+LABELV $164
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $170
+JUMPV
+LABELV $167
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+EQI4 $171
+ADDRGP4 $169
+JUMPV
+LABELV $171
+LABELV $168
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $170
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $167
+LABELV $169
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $173
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $163
+JUMPV
+LABELV $173
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $165
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $164
+CNSTP4 0
+RETP4
+LABELV $163
+endproc strstr 8 0
+export tolower
+proc tolower 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 65
+LTI4 $176
+ADDRFP4 0
+INDIRI4
+CNSTI4 90
+GTI4 $176
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+LABELV $176
+ADDRFP4 0
+INDIRI4
+RETI4
+LABELV $175
+endproc tolower 4 0
+export toupper
+proc toupper 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 97
+LTI4 $179
+ADDRFP4 0
+INDIRI4
+CNSTI4 122
+GTI4 $179
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -32
+ADDI4
+ASGNI4
+LABELV $179
+ADDRFP4 0
+INDIRI4
+RETI4
+LABELV $178
+endproc toupper 4 0
+proc powN 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $182
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $185
+JUMPV
+LABELV $184
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+MODI4
+CNSTI4 1
+NEI4 $187
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRFP4 0
+INDIRF4
+MULF4
+ASGNF4
+LABELV $187
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRFP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+DIVI4
+ASGNI4
+LABELV $185
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+GTI4 $184
+ADDRLP4 0
+INDIRF4
+RETF4
+ADDRGP4 $181
+JUMPV
+LABELV $182
+ADDRFP4 4
+INDIRI4
+CNSTI4 -2147483648
+NEI4 $189
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 powN
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 0
+INDIRF4
+DIVF4
+RETF4
+ADDRGP4 $181
+JUMPV
+LABELV $189
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+NEGI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 powN
+CALLF4
+ASGNF4
+CNSTF4 1065353216
+ADDRLP4 4
+INDIRF4
+DIVF4
+RETF4
+LABELV $181
+endproc powN 8 8
+export tan
+proc tan 8 4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+DIVF4
+RETF4
+LABELV $191
+endproc tan 8 4
+data
+align 4
+LABELV randSeed
+byte 4 0
+export srand
+code
+proc srand 0 0
+ADDRGP4 randSeed
+ADDRFP4 0
+INDIRU4
+CVUI4 4
+ASGNI4
+LABELV $192
+endproc srand 0 0
+export rand
+proc rand 4 0
+ADDRLP4 0
+ADDRGP4 randSeed
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 69069
+ADDRLP4 0
+INDIRP4
+INDIRI4
+MULI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 32767
+BANDI4
+RETI4
+LABELV $193
+endproc rand 4 0
+export atof
+proc atof 36 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $196
+JUMPV
+LABELV $195
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $198
+CNSTF4 0
+RETF4
+ADDRGP4 $194
+JUMPV
+LABELV $198
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $196
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+LEI4 $195
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 43
+EQI4 $203
+ADDRLP4 12
+INDIRI4
+CNSTI4 45
+EQI4 $204
+ADDRGP4 $200
+JUMPV
+LABELV $203
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $201
+JUMPV
+LABELV $204
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTF4 3212836864
+ASGNF4
+ADDRGP4 $201
+JUMPV
+LABELV $200
+ADDRLP4 8
+CNSTF4 1065353216
+ASGNF4
+LABELV $201
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 46
+EQI4 $205
+LABELV $207
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 20
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+LTI4 $212
+ADDRLP4 0
+INDIRI4
+CNSTI4 57
+LEI4 $210
+LABELV $212
+ADDRGP4 $206
+JUMPV
+LABELV $210
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 4
+CNSTF4 1092616192
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+LABELV $208
+ADDRGP4 $207
+JUMPV
+ADDRGP4 $206
+JUMPV
+LABELV $205
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $206
+ADDRLP4 0
+INDIRI4
+CNSTI4 46
+NEI4 $213
+ADDRLP4 20
+CNSTF4 1036831949
+ASGNF4
+LABELV $215
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+LTI4 $220
+ADDRLP4 0
+INDIRI4
+CNSTI4 57
+LEI4 $218
+LABELV $220
+ADDRGP4 $217
+JUMPV
+LABELV $218
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 20
+CNSTF4 1036831949
+ADDRLP4 20
+INDIRF4
+MULF4
+ASGNF4
+LABELV $216
+ADDRGP4 $215
+JUMPV
+LABELV $217
+LABELV $213
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+RETF4
+LABELV $194
+endproc atof 36 0
+export _atof
+proc _atof 40 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 48
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRGP4 $223
+JUMPV
+LABELV $222
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $225
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+CNSTF4 0
+RETF4
+ADDRGP4 $221
+JUMPV
+LABELV $225
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $223
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+LEI4 $222
+ADDRLP4 16
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 43
+EQI4 $230
+ADDRLP4 16
+INDIRI4
+CNSTI4 45
+EQI4 $231
+ADDRGP4 $227
+JUMPV
+LABELV $230
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $228
+JUMPV
+LABELV $231
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTF4 3212836864
+ASGNF4
+ADDRGP4 $228
+JUMPV
+LABELV $227
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+LABELV $228
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 46
+EQI4 $232
+LABELV $234
+ADDRLP4 24
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+LTI4 $239
+ADDRLP4 0
+INDIRI4
+CNSTI4 57
+LEI4 $237
+LABELV $239
+ADDRGP4 $236
+JUMPV
+LABELV $237
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 8
+CNSTF4 1092616192
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+LABELV $235
+ADDRGP4 $234
+JUMPV
+LABELV $236
+LABELV $232
+ADDRLP4 0
+INDIRI4
+CNSTI4 46
+NEI4 $240
+ADDRLP4 24
+CNSTF4 1036831949
+ASGNF4
+LABELV $242
+ADDRLP4 28
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 28
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+LTI4 $247
+ADDRLP4 0
+INDIRI4
+CNSTI4 57
+LEI4 $245
+LABELV $247
+ADDRGP4 $244
+JUMPV
+LABELV $245
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1036831949
+ADDRLP4 24
+INDIRF4
+MULF4
+ASGNF4
+LABELV $243
+ADDRGP4 $242
+JUMPV
+LABELV $244
+LABELV $240
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+RETF4
+LABELV $221
+endproc _atof 40 0
+export strtod
+proc strtod 60 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $250
+JUMPV
+LABELV $249
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $250
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 32
+EQI4 $249
+ADDRLP4 8
+INDIRI4
+CNSTI4 12
+EQI4 $249
+ADDRLP4 8
+INDIRI4
+CNSTI4 10
+EQI4 $249
+ADDRLP4 8
+INDIRI4
+CNSTI4 13
+EQI4 $249
+ADDRLP4 8
+INDIRI4
+CNSTI4 9
+EQI4 $249
+ADDRLP4 8
+INDIRI4
+CNSTI4 11
+EQI4 $249
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $254
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 12
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $252
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $255
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 3
+ADDP4
+ASGNP4
+LABELV $255
+ADDRFP4 0
+INDIRP4
+CNSTI4 3
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 40
+NEI4 $257
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 24
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 28
+ADDRGP4 strtol
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 41
+NEI4 $259
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+CNSTI4 8388607
+BANDI4
+CNSTI4 2139095040
+BORI4
+CVIU4 4
+ASGNU4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $261
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $261
+ADDRLP4 16
+INDIRF4
+RETF4
+ADDRGP4 $248
+JUMPV
+LABELV $259
+LABELV $257
+ADDRLP4 16
+CNSTU4 2147483647
+ASGNU4
+ADDRLP4 16
+INDIRF4
+RETF4
+ADDRGP4 $248
+JUMPV
+LABELV $252
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $265
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 16
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $263
+ADDRLP4 20
+CNSTU4 2139095040
+ASGNU4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $266
+ADDRLP4 20
+INDIRF4
+RETF4
+ADDRGP4 $248
+JUMPV
+LABELV $266
+ADDRFP4 0
+INDIRP4
+CNSTI4 3
+ADDP4
+ARGP4
+ADDRGP4 $270
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRLP4 24
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $268
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRGP4 $269
+JUMPV
+LABELV $268
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 3
+ADDP4
+ASGNP4
+LABELV $269
+ADDRLP4 20
+INDIRF4
+RETF4
+ADDRGP4 $248
+JUMPV
+LABELV $263
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 45
+NEI4 $271
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $272
+JUMPV
+LABELV $271
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 43
+NEI4 $273
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $273
+LABELV $272
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $277
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 20
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $275
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRGP4 $279
+JUMPV
+LABELV $278
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 48
+LTI4 $281
+ADDRLP4 32
+INDIRI4
+CNSTI4 57
+GTI4 $281
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 36
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTF4 1098907648
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRLP4 36
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRGP4 $282
+JUMPV
+LABELV $281
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 65
+LTI4 $283
+ADDRLP4 40
+INDIRI4
+CNSTI4 70
+GTI4 $283
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 44
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTF4 1098907648
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1092616192
+ADDF4
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ADDF4
+CNSTF4 1115815936
+SUBF4
+ASGNF4
+ADDRGP4 $284
+JUMPV
+LABELV $283
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 97
+LTI4 $280
+ADDRLP4 48
+INDIRI4
+CNSTI4 102
+GTI4 $280
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 52
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTF4 1098907648
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1092616192
+ADDF4
+ADDRLP4 52
+INDIRP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ADDF4
+CNSTF4 1120010240
+SUBF4
+ASGNF4
+LABELV $286
+LABELV $284
+LABELV $282
+LABELV $279
+ADDRGP4 $278
+JUMPV
+LABELV $280
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+GEU4 $287
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $287
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 46
+NEI4 $289
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 32
+CNSTF4 1031798784
+ASGNF4
+LABELV $291
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 48
+LTI4 $295
+ADDRLP4 36
+INDIRI4
+CNSTI4 57
+GTI4 $295
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 40
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 40
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $296
+JUMPV
+LABELV $295
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 65
+LTI4 $297
+ADDRLP4 44
+INDIRI4
+CNSTI4 70
+GTI4 $297
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 48
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 48
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+ADDI4
+CNSTI4 65
+SUBI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $298
+JUMPV
+LABELV $297
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 97
+LTI4 $293
+ADDRLP4 52
+INDIRI4
+CNSTI4 102
+GTI4 $293
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 56
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 56
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+ADDI4
+CNSTI4 97
+SUBI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+LABELV $300
+LABELV $298
+LABELV $296
+LABELV $292
+ADDRLP4 32
+ADDRLP4 32
+INDIRF4
+CNSTF4 1098907648
+DIVF4
+ASGNF4
+ADDRGP4 $291
+JUMPV
+LABELV $293
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+GEU4 $301
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $301
+LABELV $289
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+EQU4 $303
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 32
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 112
+NEI4 $303
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 24
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 40
+ADDRGP4 strtol
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+CVPU4 4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+NEU4 $305
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $307
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $307
+ADDRLP4 0
+INDIRF4
+RETF4
+ADDRGP4 $248
+JUMPV
+LABELV $305
+CNSTF4 1073741824
+ARGF4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 powN
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ASGNF4
+LABELV $303
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $309
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+LABELV $309
+ADDRLP4 0
+INDIRF4
+RETF4
+ADDRGP4 $248
+JUMPV
+LABELV $275
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRGP4 $314
+JUMPV
+LABELV $311
+LABELV $312
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 32
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTF4 1092616192
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ADDF4
+CNSTF4 1111490560
+SUBF4
+ASGNF4
+LABELV $314
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 48
+LTI4 $315
+ADDRLP4 36
+INDIRI4
+CNSTI4 57
+LEI4 $311
+LABELV $315
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+GEU4 $316
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $316
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 46
+NEI4 $318
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 40
+CNSTF4 1036831949
+ASGNF4
+ADDRGP4 $323
+JUMPV
+LABELV $320
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 44
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CVIF4 4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $321
+ADDRLP4 40
+ADDRLP4 40
+INDIRF4
+CNSTF4 1092616192
+DIVF4
+ASGNF4
+LABELV $323
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 48
+LTI4 $324
+ADDRLP4 48
+INDIRI4
+CNSTI4 57
+LEI4 $320
+LABELV $324
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+GEU4 $325
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $325
+LABELV $318
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+EQU4 $327
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 40
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 101
+NEI4 $327
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 24
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 48
+ADDRGP4 strtol
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+CVPU4 4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+NEU4 $329
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $331
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $331
+ADDRLP4 0
+INDIRF4
+RETF4
+ADDRGP4 $248
+JUMPV
+LABELV $329
+CNSTF4 1092616192
+ARGF4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 powN
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 52
+INDIRF4
+MULF4
+ASGNF4
+LABELV $327
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $333
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+LABELV $333
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $248
+endproc strtod 60 12
+export atoi
+proc atoi 28 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $337
+JUMPV
+LABELV $336
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $339
+CNSTI4 0
+RETI4
+ADDRGP4 $335
+JUMPV
+LABELV $339
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $337
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+LEI4 $336
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 43
+EQI4 $344
+ADDRLP4 12
+INDIRI4
+CNSTI4 45
+EQI4 $345
+ADDRGP4 $341
+JUMPV
+LABELV $344
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $342
+JUMPV
+LABELV $345
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $342
+JUMPV
+LABELV $341
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+LABELV $342
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $346
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 20
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+LTI4 $351
+ADDRLP4 0
+INDIRI4
+CNSTI4 57
+LEI4 $349
+LABELV $351
+ADDRGP4 $348
+JUMPV
+LABELV $349
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 10
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $347
+ADDRGP4 $346
+JUMPV
+LABELV $348
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+RETI4
+LABELV $335
+endproc atoi 28 0
+export _atoi
+proc _atoi 32 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRGP4 $354
+JUMPV
+LABELV $353
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $356
+CNSTI4 0
+RETI4
+ADDRGP4 $352
+JUMPV
+LABELV $356
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $354
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+LEI4 $353
+ADDRLP4 16
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 43
+EQI4 $361
+ADDRLP4 16
+INDIRI4
+CNSTI4 45
+EQI4 $362
+ADDRGP4 $358
+JUMPV
+LABELV $361
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $359
+JUMPV
+LABELV $362
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $359
+JUMPV
+LABELV $358
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+LABELV $359
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $363
+ADDRLP4 24
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+LTI4 $368
+ADDRLP4 0
+INDIRI4
+CNSTI4 57
+LEI4 $366
+LABELV $368
+ADDRGP4 $365
+JUMPV
+LABELV $366
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 10
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $364
+ADDRGP4 $363
+JUMPV
+LABELV $365
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MULI4
+RETI4
+LABELV $352
+endproc _atoi 32 0
+export strtol
+proc strtol 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $370
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $370
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $375
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+EQI4 $375
+ADDRFP4 8
+INDIRI4
+CNSTI4 36
+LEI4 $377
+LABELV $375
+CNSTI4 0
+RETI4
+ADDRGP4 $369
+JUMPV
+LABELV $376
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $377
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 32
+EQI4 $376
+ADDRLP4 12
+INDIRI4
+CNSTI4 12
+EQI4 $376
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+EQI4 $376
+ADDRLP4 12
+INDIRI4
+CNSTI4 13
+EQI4 $376
+ADDRLP4 12
+INDIRI4
+CNSTI4 9
+EQI4 $376
+ADDRLP4 12
+INDIRI4
+CNSTI4 11
+EQI4 $376
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 45
+NEI4 $379
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $380
+JUMPV
+LABELV $379
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 43
+NEI4 $381
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $381
+LABELV $380
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+NEI4 $383
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $385
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $385
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 120
+EQI4 $389
+ADDRLP4 16
+INDIRI4
+CNSTI4 88
+NEI4 $387
+LABELV $389
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $390
+ADDRFP4 8
+INDIRI4
+CNSTI4 16
+EQI4 $390
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $392
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $392
+CNSTI4 0
+RETI4
+ADDRGP4 $369
+JUMPV
+LABELV $390
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRFP4 8
+CNSTI4 16
+ASGNI4
+ADDRGP4 $384
+JUMPV
+LABELV $387
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $384
+ADDRFP4 8
+CNSTI4 8
+ASGNI4
+ADDRGP4 $384
+JUMPV
+LABELV $383
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $396
+ADDRFP4 8
+CNSTI4 10
+ASGNI4
+LABELV $396
+LABELV $384
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $399
+JUMPV
+LABELV $398
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 48
+LTI4 $401
+ADDRLP4 20
+INDIRI4
+CNSTI4 57
+GTI4 $401
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRGP4 $402
+JUMPV
+LABELV $401
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 97
+LTI4 $403
+ADDRLP4 24
+INDIRI4
+CNSTI4 122
+GTI4 $403
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+ADDI4
+CNSTI4 97
+SUBI4
+ASGNI4
+ADDRGP4 $404
+JUMPV
+LABELV $403
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 65
+LTI4 $400
+ADDRLP4 28
+INDIRI4
+CNSTI4 90
+GTI4 $400
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+ADDI4
+CNSTI4 65
+SUBI4
+ASGNI4
+LABELV $406
+LABELV $404
+LABELV $402
+ADDRLP4 16
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $407
+ADDRGP4 $400
+JUMPV
+LABELV $407
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 -2147483648
+ADDI4
+ADDRFP4 8
+INDIRI4
+DIVI4
+GEI4 $409
+ADDRLP4 0
+CNSTI4 -2147483648
+ASGNI4
+ADDRGP4 $410
+JUMPV
+LABELV $409
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $410
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $411
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $411
+LABELV $399
+ADDRGP4 $398
+JUMPV
+LABELV $400
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $413
+ADDRLP4 0
+INDIRI4
+CNSTI4 -2147483648
+NEI4 $415
+ADDRLP4 0
+CNSTI4 2147483647
+ASGNI4
+ADDRGP4 $416
+JUMPV
+LABELV $415
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+NEGI4
+ASGNI4
+LABELV $416
+LABELV $413
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $369
+endproc strtol 32 0
+export abs
+proc abs 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $419
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+NEGI4
+ASGNI4
+ADDRGP4 $420
+JUMPV
+LABELV $419
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+LABELV $420
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $417
+endproc abs 4 0
+export fabs
+proc fabs 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $423
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+NEGF4
+ASGNF4
+ADDRGP4 $424
+JUMPV
+LABELV $423
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+LABELV $424
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $421
+endproc fabs 4 0
+proc dopr 276 32
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 48
+INDIRI4
+CVIU4 4
+ASGNU4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRLP4 44
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 44
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 44
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 24
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 $427
+JUMPV
+LABELV $426
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $429
+ADDRLP4 0
+CNSTI4 8
+ASGNI4
+LABELV $429
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $432
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+GTI4 $432
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $539
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $539
+address $433
+address $436
+address $446
+address $451
+address $454
+address $461
+address $472
+address $477
+address $432
+code
+LABELV $433
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 37
+NEI4 $434
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $435
+JUMPV
+LABELV $434
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 56
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 56
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $435
+ADDRLP4 60
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 60
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 60
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $432
+JUMPV
+LABELV $436
+ADDRLP4 64
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 72
+CNSTI4 32
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 72
+INDIRI4
+EQI4 $442
+ADDRLP4 64
+INDIRI4
+CNSTI4 35
+EQI4 $443
+ADDRLP4 64
+INDIRI4
+ADDRLP4 72
+INDIRI4
+LTI4 $437
+LABELV $445
+ADDRLP4 64
+INDIRI4
+CNSTI4 43
+EQI4 $441
+ADDRLP4 64
+INDIRI4
+CNSTI4 45
+EQI4 $440
+ADDRLP4 64
+INDIRI4
+CNSTI4 48
+EQI4 $444
+ADDRGP4 $437
+JUMPV
+LABELV $440
+ADDRLP4 84
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+ADDRLP4 84
+INDIRI4
+BORI4
+ASGNI4
+ADDRLP4 80
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 80
+INDIRP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 80
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $432
+JUMPV
+LABELV $441
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRLP4 88
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 88
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 88
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $432
+JUMPV
+LABELV $442
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+ADDRLP4 92
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 92
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 92
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $432
+JUMPV
+LABELV $443
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+ADDRLP4 96
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 96
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 96
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $432
+JUMPV
+LABELV $444
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+ADDRLP4 100
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 100
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 100
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $432
+JUMPV
+LABELV $437
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 $432
+JUMPV
+LABELV $446
+ADDRLP4 80
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+CNSTI4 48
+ADDRLP4 80
+INDIRI4
+GTI4 $447
+ADDRLP4 80
+INDIRI4
+CNSTI4 57
+GTI4 $447
+ADDRLP4 16
+CNSTI4 10
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ADDI4
+ASGNI4
+ADDRLP4 84
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 84
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 84
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $432
+JUMPV
+LABELV $447
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $449
+ADDRLP4 88
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 88
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 88
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 84
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 84
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 84
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRGP4 $432
+JUMPV
+LABELV $449
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRGP4 $432
+JUMPV
+LABELV $451
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 46
+NEI4 $452
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRLP4 84
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 84
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 84
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $432
+JUMPV
+LABELV $452
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRGP4 $432
+JUMPV
+LABELV $454
+ADDRLP4 84
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+CNSTI4 48
+ADDRLP4 84
+INDIRI4
+GTI4 $455
+ADDRLP4 84
+INDIRI4
+CNSTI4 57
+GTI4 $455
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GEI4 $457
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $457
+ADDRLP4 8
+CNSTI4 10
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ADDI4
+ASGNI4
+ADDRLP4 88
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 88
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 88
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $432
+JUMPV
+LABELV $455
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $459
+ADDRLP4 92
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 92
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 88
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 88
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 88
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRGP4 $432
+JUMPV
+LABELV $459
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRGP4 $432
+JUMPV
+LABELV $461
+ADDRLP4 88
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 96
+CNSTI4 104
+ASGNI4
+ADDRLP4 88
+INDIRI4
+ADDRLP4 96
+INDIRI4
+EQI4 $465
+ADDRLP4 88
+INDIRI4
+ADDRLP4 96
+INDIRI4
+GTI4 $469
+LABELV $468
+ADDRLP4 88
+INDIRI4
+CNSTI4 76
+EQI4 $467
+ADDRGP4 $463
+JUMPV
+LABELV $469
+ADDRLP4 88
+INDIRI4
+CNSTI4 108
+EQI4 $466
+ADDRGP4 $463
+JUMPV
+LABELV $465
+ADDRLP4 104
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 100
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 100
+INDIRP4
+ADDRLP4 104
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 100
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $463
+JUMPV
+LABELV $466
+ADDRLP4 12
+CNSTI4 2
+ASGNI4
+ADDRLP4 108
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 108
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 108
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $463
+JUMPV
+LABELV $467
+ADDRLP4 12
+CNSTI4 4
+ASGNI4
+ADDRLP4 112
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 112
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 112
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $463
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+EQI4 $470
+ADDRLP4 0
+CNSTI4 7
+ASGNI4
+ADDRGP4 $432
+JUMPV
+LABELV $470
+ADDRLP4 0
+CNSTI4 6
+ASGNI4
+ADDRGP4 $432
+JUMPV
+LABELV $472
+ADDRLP4 100
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 108
+EQI4 $476
+ADDRGP4 $474
+JUMPV
+LABELV $476
+ADDRLP4 12
+CNSTI4 3
+ASGNI4
+ADDRLP4 104
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 104
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 104
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $474
+ADDRLP4 0
+CNSTI4 7
+ASGNI4
+ADDRGP4 $432
+JUMPV
+LABELV $477
+ADDRLP4 104
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 69
+EQI4 $513
+ADDRLP4 112
+CNSTI4 71
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ADDRLP4 112
+INDIRI4
+EQI4 $517
+ADDRLP4 104
+INDIRI4
+ADDRLP4 112
+INDIRI4
+GTI4 $534
+LABELV $533
+ADDRLP4 104
+INDIRI4
+CNSTI4 37
+EQI4 $531
+ADDRGP4 $479
+JUMPV
+LABELV $534
+ADDRLP4 120
+CNSTI4 88
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ADDRLP4 120
+INDIRI4
+EQI4 $502
+ADDRLP4 104
+INDIRI4
+ADDRLP4 120
+INDIRI4
+LTI4 $479
+LABELV $535
+ADDRLP4 104
+INDIRI4
+CNSTI4 99
+LTI4 $479
+ADDRLP4 104
+INDIRI4
+CNSTI4 120
+GTI4 $479
+ADDRLP4 104
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $536-396
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $536
+address $521
+address $481
+address $514
+address $510
+address $518
+address $479
+address $481
+address $479
+address $479
+address $479
+address $479
+address $524
+address $488
+address $523
+address $479
+address $479
+address $522
+address $479
+address $495
+address $479
+address $532
+address $503
+code
+LABELV $481
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+NEI4 $482
+ADDRLP4 128
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 128
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 128
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRI4
+CVII2 4
+CVII4 2
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $482
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+NEI4 $484
+ADDRLP4 132
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 132
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 132
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $485
+JUMPV
+LABELV $484
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+NEI4 $486
+ADDRLP4 136
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 136
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 136
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $487
+JUMPV
+LABELV $486
+ADDRLP4 140
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 140
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 140
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $487
+LABELV $485
+LABELV $483
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRLP4 32
+INDIRI4
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 144
+ADDRGP4 fmtint
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 144
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $479
+JUMPV
+LABELV $488
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+NEI4 $489
+ADDRLP4 148
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 148
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 148
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CNSTU4 65535
+BANDU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $490
+JUMPV
+LABELV $489
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+NEI4 $491
+ADDRLP4 152
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 152
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $492
+JUMPV
+LABELV $491
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+NEI4 $493
+ADDRLP4 156
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 156
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $494
+JUMPV
+LABELV $493
+ADDRLP4 160
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 160
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 160
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+LABELV $494
+LABELV $492
+LABELV $490
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRLP4 32
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 fmtint
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 164
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $479
+JUMPV
+LABELV $495
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+NEI4 $496
+ADDRLP4 168
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 168
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 168
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CNSTU4 65535
+BANDU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $497
+JUMPV
+LABELV $496
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+NEI4 $498
+ADDRLP4 172
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 172
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 172
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $499
+JUMPV
+LABELV $498
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+NEI4 $500
+ADDRLP4 176
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 176
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 176
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $501
+JUMPV
+LABELV $500
+ADDRLP4 180
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 180
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 180
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+LABELV $501
+LABELV $499
+LABELV $497
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRLP4 32
+INDIRI4
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 184
+ADDRGP4 fmtint
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 184
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $479
+JUMPV
+LABELV $502
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $503
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+NEI4 $504
+ADDRLP4 188
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 188
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 188
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CNSTU4 65535
+BANDU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $505
+JUMPV
+LABELV $504
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+NEI4 $506
+ADDRLP4 192
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 192
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 192
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $507
+JUMPV
+LABELV $506
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+NEI4 $508
+ADDRLP4 196
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 196
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 196
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $509
+JUMPV
+LABELV $508
+ADDRLP4 200
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 200
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 200
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+LABELV $509
+LABELV $507
+LABELV $505
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRLP4 32
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 204
+ADDRGP4 fmtint
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 204
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $479
+JUMPV
+LABELV $510
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+NEI4 $511
+ADDRLP4 208
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 208
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 208
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $512
+JUMPV
+LABELV $511
+ADDRLP4 212
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 212
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 212
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $512
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 216
+ADDRGP4 fmtfp
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 216
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $479
+JUMPV
+LABELV $513
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $514
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+NEI4 $515
+ADDRLP4 220
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 220
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 220
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $516
+JUMPV
+LABELV $515
+ADDRLP4 224
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 224
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 224
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $516
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 228
+ADDRGP4 fmtfp
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 228
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $479
+JUMPV
+LABELV $517
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $518
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+NEI4 $519
+ADDRLP4 232
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 232
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 232
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $520
+JUMPV
+LABELV $519
+ADDRLP4 236
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 236
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 236
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $520
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 240
+ADDRGP4 fmtfp
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 240
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $479
+JUMPV
+LABELV $521
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRLP4 244
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 244
+INDIRP4
+ASGNP4
+ADDRLP4 244
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRI4
+CVII1 4
+CVII4 1
+ARGI4
+ADDRLP4 248
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 248
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $479
+JUMPV
+LABELV $522
+ADDRLP4 252
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 252
+INDIRP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 252
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 256
+ADDRGP4 fmtstr
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 256
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $479
+JUMPV
+LABELV $523
+ADDRLP4 260
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 260
+INDIRP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 260
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRLP4 40
+INDIRP4
+CVPU4 4
+CVUI4 4
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 264
+ADDRGP4 fmtint
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 264
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $479
+JUMPV
+LABELV $524
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+NEI4 $525
+ADDRLP4 272
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 272
+INDIRP4
+ASGNP4
+ADDRLP4 268
+ADDRLP4 272
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ADDRLP4 28
+INDIRU4
+CVUI4 4
+CVII2 4
+ASGNI2
+ADDRGP4 $479
+JUMPV
+LABELV $525
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+NEI4 $527
+ADDRLP4 272
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 272
+INDIRP4
+ASGNP4
+ADDRLP4 268
+ADDRLP4 272
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ADDRLP4 28
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $479
+JUMPV
+LABELV $527
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+NEI4 $529
+ADDRLP4 272
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 272
+INDIRP4
+ASGNP4
+ADDRLP4 268
+ADDRLP4 272
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ADDRLP4 28
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $479
+JUMPV
+LABELV $529
+ADDRLP4 272
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 272
+INDIRP4
+ASGNP4
+ADDRLP4 268
+ADDRLP4 272
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ADDRLP4 28
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $479
+JUMPV
+LABELV $531
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 268
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 268
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $479
+JUMPV
+LABELV $532
+ADDRLP4 272
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 272
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 272
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $479
+ADDRLP4 128
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 128
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 128
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+LABELV $432
+LABELV $427
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+NEI4 $426
+ADDRFP4 4
+INDIRU4
+CNSTU4 0
+EQU4 $540
+ADDRLP4 28
+INDIRU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $540
+ADDRLP4 24
+INDIRI4
+RETI4
+LABELV $425
+endproc dopr 276 32
+proc fmtstr 32 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRU4
+ASGNU4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $543
+ADDRFP4 12
+ADDRGP4 $545
+ASGNP4
+LABELV $543
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $549
+JUMPV
+LABELV $546
+LABELV $547
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $549
+ADDRLP4 8
+INDIRI4
+ADDRFP4 12
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $546
+ADDRFP4 24
+INDIRI4
+CNSTI4 0
+LTI4 $550
+ADDRFP4 24
+INDIRI4
+ADDRLP4 8
+INDIRI4
+GEI4 $550
+ADDRLP4 8
+ADDRFP4 24
+INDIRI4
+ASGNI4
+LABELV $550
+ADDRLP4 0
+ADDRFP4 20
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $552
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $552
+ADDRFP4 16
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $557
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+NEGI4
+ASGNI4
+ADDRGP4 $557
+JUMPV
+LABELV $556
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+CNSTI4 32
+ARGI4
+ADDRLP4 20
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $557
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $556
+ADDRGP4 $560
+JUMPV
+LABELV $559
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+ADDRLP4 20
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 20
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 24
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $560
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 20
+INDIRI4
+EQI4 $562
+ADDRFP4 24
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LTI4 $559
+ADDRLP4 12
+INDIRI4
+ADDRFP4 24
+INDIRI4
+LTI4 $559
+LABELV $562
+ADDRGP4 $564
+JUMPV
+LABELV $563
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+CNSTI4 32
+ARGI4
+ADDRLP4 28
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $564
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $563
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $542
+endproc fmtstr 32 16
+proc fmtint 84 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRU4
+ASGNU4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 28
+ADDRFP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 24
+INDIRI4
+CNSTI4 0
+GEI4 $567
+ADDRFP4 24
+CNSTI4 0
+ASGNI4
+LABELV $567
+ADDRLP4 8
+ADDRFP4 12
+INDIRI4
+CVIU4 4
+ASGNU4
+ADDRFP4 28
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+NEI4 $569
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+GEI4 $571
+ADDRLP4 48
+CNSTI4 45
+ASGNI4
+ADDRLP4 8
+ADDRFP4 12
+INDIRI4
+NEGI4
+CVIU4 4
+ASGNU4
+ADDRGP4 $572
+JUMPV
+LABELV $571
+ADDRFP4 28
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $573
+ADDRLP4 48
+CNSTI4 43
+ASGNI4
+ADDRGP4 $574
+JUMPV
+LABELV $573
+ADDRFP4 28
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $575
+ADDRLP4 48
+CNSTI4 32
+ASGNI4
+LABELV $575
+LABELV $574
+LABELV $572
+LABELV $569
+ADDRFP4 28
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $577
+ADDRLP4 44
+ADDRGP4 $579
+ASGNP4
+ADDRGP4 $578
+JUMPV
+LABELV $577
+ADDRLP4 44
+ADDRGP4 $580
+ASGNP4
+LABELV $578
+LABELV $581
+ADDRLP4 52
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 52
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 16
+ADDP4
+ADDRLP4 8
+INDIRU4
+ADDRFP4 16
+INDIRI4
+CVIU4 4
+MODU4
+ADDRLP4 44
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 8
+ADDRLP4 8
+INDIRU4
+ADDRFP4 16
+INDIRI4
+CVIU4 4
+DIVU4
+ASGNU4
+LABELV $582
+ADDRLP4 8
+INDIRU4
+CNSTU4 0
+EQU4 $584
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 24
+LTU4 $581
+LABELV $584
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 24
+NEU4 $585
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $585
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 40
+ADDRFP4 24
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 24
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LEI4 $589
+ADDRLP4 52
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $590
+JUMPV
+LABELV $589
+ADDRLP4 52
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $590
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $591
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRGP4 $592
+JUMPV
+LABELV $591
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+LABELV $592
+ADDRLP4 4
+ADDRFP4 20
+INDIRI4
+ADDRLP4 52
+INDIRI4
+SUBI4
+ADDRLP4 56
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+GEI4 $593
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+LABELV $593
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $595
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $595
+ADDRFP4 28
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $597
+ADDRLP4 40
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LEI4 $600
+ADDRLP4 68
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $601
+JUMPV
+LABELV $600
+ADDRLP4 68
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $601
+ADDRLP4 40
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $597
+ADDRFP4 28
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $605
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+NEGI4
+ASGNI4
+ADDRGP4 $605
+JUMPV
+LABELV $604
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+CNSTI4 32
+ARGI4
+ADDRLP4 68
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $605
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GTI4 $604
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $607
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+ADDRLP4 48
+INDIRI4
+CVII1 4
+CVII4 1
+ARGI4
+ADDRLP4 68
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $607
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+LEI4 $615
+ADDRGP4 $612
+JUMPV
+LABELV $611
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+CNSTI4 48
+ARGI4
+ADDRLP4 72
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 72
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $612
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+GTI4 $611
+ADDRGP4 $615
+JUMPV
+LABELV $614
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+ADDRLP4 72
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ADDRLP4 16
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 76
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 76
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $615
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $614
+ADDRGP4 $618
+JUMPV
+LABELV $617
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+CNSTI4 32
+ARGI4
+ADDRLP4 80
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 80
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $618
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $617
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $566
+endproc fmtint 84 16
+proc abs_val 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $621
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $621
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $620
+endproc abs_val 4 0
+proc round 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1056964608
+LTF4 $624
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $624
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $623
+endproc round 8 0
+proc fmtfp 136 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRU4
+ASGNU4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+GEI4 $627
+ADDRFP4 20
+CNSTI4 6
+ASGNI4
+LABELV $627
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 80
+ADDRGP4 abs_val
+CALLF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRF4
+CNSTF4 0
+GEF4 $629
+ADDRLP4 72
+CNSTI4 45
+ASGNI4
+ADDRGP4 $630
+JUMPV
+LABELV $629
+ADDRFP4 24
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $631
+ADDRLP4 72
+CNSTI4 43
+ASGNI4
+ADDRGP4 $632
+JUMPV
+LABELV $631
+ADDRFP4 24
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $633
+ADDRLP4 72
+CNSTI4 32
+ASGNI4
+LABELV $633
+LABELV $632
+LABELV $630
+ADDRLP4 12
+ADDRLP4 76
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 20
+INDIRI4
+CNSTI4 9
+LEI4 $635
+ADDRFP4 20
+CNSTI4 9
+ASGNI4
+LABELV $635
+CNSTF4 1092616192
+ARGF4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 powN
+CALLF4
+ASGNF4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+SUBF4
+MULF4
+ARGF4
+ADDRLP4 88
+ADDRGP4 round
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 88
+INDIRI4
+ASGNI4
+CNSTF4 1092616192
+ARGF4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 powN
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRLP4 92
+INDIRF4
+LTF4 $637
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTF4 1092616192
+ARGF4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 powN
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRLP4 96
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+LABELV $637
+LABELV $639
+ADDRLP4 100
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $643
+ADDRLP4 96
+ADDRGP4 $579
+ASGNP4
+ADDRGP4 $644
+JUMPV
+LABELV $643
+ADDRLP4 96
+ADDRGP4 $580
+ASGNP4
+LABELV $644
+ADDRLP4 100
+INDIRI4
+ADDRLP4 24
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+MODI4
+ADDRLP4 96
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+DIVI4
+ASGNI4
+LABELV $640
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $645
+ADDRLP4 8
+INDIRI4
+CNSTI4 20
+LTI4 $639
+LABELV $645
+ADDRLP4 8
+INDIRI4
+CNSTI4 20
+NEI4 $646
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $646
+ADDRLP4 8
+INDIRI4
+ADDRLP4 24
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $648
+ADDRLP4 100
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $652
+ADDRLP4 96
+ADDRGP4 $579
+ASGNP4
+ADDRGP4 $653
+JUMPV
+LABELV $652
+ADDRLP4 96
+ADDRGP4 $580
+ASGNP4
+LABELV $653
+ADDRLP4 100
+INDIRI4
+ADDRLP4 48
+ADDP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 10
+MODI4
+ADDRLP4 96
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 10
+DIVI4
+ASGNI4
+LABELV $649
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $654
+ADDRLP4 20
+INDIRI4
+CNSTI4 20
+LTI4 $648
+LABELV $654
+ADDRLP4 20
+INDIRI4
+CNSTI4 20
+NEI4 $655
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $655
+ADDRLP4 20
+INDIRI4
+ADDRLP4 48
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $658
+ADDRLP4 96
+CNSTI4 1
+ASGNI4
+ADDRGP4 $659
+JUMPV
+LABELV $658
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+LABELV $659
+ADDRLP4 0
+ADDRFP4 16
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ADDRFP4 20
+INDIRI4
+SUBI4
+CNSTI4 1
+SUBI4
+ADDRLP4 96
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 68
+ADDRFP4 20
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+GEI4 $660
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $660
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $662
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $662
+ADDRFP4 24
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $664
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+NEGI4
+ASGNI4
+LABELV $664
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRFP4 24
+INDIRI4
+CNSTI4 16
+BANDI4
+ADDRLP4 100
+INDIRI4
+EQI4 $674
+ADDRLP4 0
+INDIRI4
+ADDRLP4 100
+INDIRI4
+LEI4 $674
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $671
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+ADDRLP4 72
+INDIRI4
+CVII1 4
+CVII4 1
+ARGI4
+ADDRLP4 104
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRGP4 $671
+JUMPV
+LABELV $670
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+CNSTI4 48
+ARGI4
+ADDRLP4 104
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $671
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $670
+ADDRGP4 $674
+JUMPV
+LABELV $673
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+CNSTI4 32
+ARGI4
+ADDRLP4 104
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $674
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $673
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $679
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+ADDRLP4 72
+INDIRI4
+CVII1 4
+CVII4 1
+ARGI4
+ADDRLP4 104
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $679
+JUMPV
+LABELV $678
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+ADDRLP4 108
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+ADDRLP4 24
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 112
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 112
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $679
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GTI4 $678
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+LEI4 $690
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+CNSTI4 46
+ARGI4
+ADDRLP4 116
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 116
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $684
+JUMPV
+LABELV $683
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+CNSTI4 48
+ARGI4
+ADDRLP4 120
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 120
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $684
+ADDRLP4 124
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 124
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+GTI4 $683
+ADDRGP4 $687
+JUMPV
+LABELV $686
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+ADDRLP4 128
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+ADDRLP4 48
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 132
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 132
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $687
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+GTI4 $686
+ADDRGP4 $690
+JUMPV
+LABELV $689
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+CNSTI4 32
+ARGI4
+ADDRLP4 116
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 116
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $690
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $689
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $626
+endproc fmtfp 136 16
+proc dopr_outch 8 0
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 4
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ADDRFP4 8
+INDIRU4
+GEU4 $693
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRU4
+ASGNU4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 0
+INDIRU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRFP4 12
+INDIRI1
+ASGNI1
+LABELV $693
+CNSTI4 1
+RETI4
+LABELV $692
+endproc dopr_outch 8 0
+export Q_vsnprintf
+proc Q_vsnprintf 4 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 dopr
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $695
+endproc Q_vsnprintf 4 16
+export sscanf
+proc sscanf 84 4
+ADDRLP4 8
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $699
+JUMPV
+LABELV $698
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 37
+EQI4 $701
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $699
+JUMPV
+LABELV $701
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+LTI4 $703
+ADDRLP4 0
+INDIRI4
+CNSTI4 57
+GTI4 $703
+ADDRFP4 4
+ARGP4
+ADDRLP4 20
+ADDRGP4 _atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+CVIU4 4
+ASGNU4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 -1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRGP4 $704
+JUMPV
+LABELV $703
+ADDRLP4 4
+CNSTU4 1023
+ASGNU4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $704
+ADDRLP4 24
+CNSTI4 100
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $707
+ADDRLP4 0
+INDIRI4
+CNSTI4 102
+EQI4 $708
+ADDRLP4 0
+INDIRI4
+CNSTI4 105
+EQI4 $707
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LTI4 $705
+LABELV $718
+ADDRLP4 0
+INDIRI4
+CNSTI4 115
+EQI4 $709
+ADDRLP4 0
+INDIRI4
+CNSTI4 117
+EQI4 $707
+ADDRGP4 $705
+JUMPV
+LABELV $707
+ADDRLP4 32
+ADDRLP4 8
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ARGP4
+ADDRLP4 36
+ADDRGP4 _atoi
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $706
+JUMPV
+LABELV $708
+ADDRLP4 40
+ADDRLP4 8
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ARGP4
+ADDRLP4 44
+ADDRGP4 _atof
+CALLF4
+ASGNF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRGP4 $706
+JUMPV
+LABELV $709
+ADDRLP4 52
+ADDRLP4 8
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 52
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $711
+JUMPV
+LABELV $710
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $711
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 32
+EQI4 $710
+ADDRLP4 56
+INDIRI4
+CNSTI4 12
+EQI4 $710
+ADDRLP4 56
+INDIRI4
+CNSTI4 10
+EQI4 $710
+ADDRLP4 56
+INDIRI4
+CNSTI4 13
+EQI4 $710
+ADDRLP4 56
+INDIRI4
+CNSTI4 9
+EQI4 $710
+ADDRLP4 56
+INDIRI4
+CNSTI4 11
+EQI4 $710
+ADDRGP4 $714
+JUMPV
+LABELV $713
+ADDRLP4 60
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+ADDRLP4 48
+ADDRLP4 60
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 64
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $714
+ADDRLP4 76
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $717
+ADDRLP4 76
+INDIRI4
+CNSTI4 32
+EQI4 $717
+ADDRLP4 76
+INDIRI4
+CNSTI4 12
+EQI4 $717
+ADDRLP4 76
+INDIRI4
+CNSTI4 10
+EQI4 $717
+ADDRLP4 76
+INDIRI4
+CNSTI4 13
+EQI4 $717
+ADDRLP4 76
+INDIRI4
+CNSTI4 9
+EQI4 $717
+ADDRLP4 76
+INDIRI4
+CNSTI4 11
+EQI4 $717
+ADDRLP4 72
+ADDRLP4 4
+INDIRU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 72
+INDIRU4
+CNSTU4 1
+SUBU4
+ASGNU4
+ADDRLP4 72
+INDIRU4
+CNSTU4 0
+NEU4 $713
+LABELV $717
+ADDRLP4 80
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 80
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $705
+LABELV $706
+LABELV $699
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $698
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $696
+endproc sscanf 84 4
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import strncpy
+import strlen
+import demo_protocols
+lit
+align 1
+LABELV $580
+byte 1 48
+byte 1 49
+byte 1 50
+byte 1 51
+byte 1 52
+byte 1 53
+byte 1 54
+byte 1 55
+byte 1 56
+byte 1 57
+byte 1 97
+byte 1 98
+byte 1 99
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 0
+align 1
+LABELV $579
+byte 1 48
+byte 1 49
+byte 1 50
+byte 1 51
+byte 1 52
+byte 1 53
+byte 1 54
+byte 1 55
+byte 1 56
+byte 1 57
+byte 1 65
+byte 1 66
+byte 1 67
+byte 1 68
+byte 1 69
+byte 1 70
+byte 1 0
+align 1
+LABELV $545
+byte 1 60
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 62
+byte 1 0
+align 1
+LABELV $277
+byte 1 48
+byte 1 120
+byte 1 0
+align 1
+LABELV $270
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $265
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 0
+align 1
+LABELV $254
+byte 1 110
+byte 1 97
+byte 1 110
+byte 1 0
@@ -0,0 +1,7609 @@
+export Com_Error
+code
+proc Com_Error 1028 16
+ADDRLP4 0
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $77
+endproc Com_Error 1028 16
+export Com_Printf
+proc Com_Printf 1028 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $79
+endproc Com_Printf 1028 16
+export UI_ClampCvar
+proc UI_ClampCvar 0 0
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRF4
+ADDRFP4 0
+INDIRF4
+GEF4 $82
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $81
+JUMPV
+LABELV $82
+ADDRFP4 8
+INDIRF4
+ADDRFP4 4
+INDIRF4
+LEF4 $84
+ADDRFP4 4
+INDIRF4
+RETF4
+ADDRGP4 $81
+JUMPV
+LABELV $84
+ADDRFP4 8
+INDIRF4
+RETF4
+LABELV $81
+endproc UI_ClampCvar 0 0
+export UI_StartDemoLoop
+proc UI_StartDemoLoop 0 8
+CNSTI4 2
+ARGI4
+ADDRGP4 $87
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $86
+endproc UI_StartDemoLoop 0 8
+export UI_StartCreditMusic
+proc UI_StartCreditMusic 4 8
+ADDRGP4 uis+11424
+CNSTI4 1
+ASGNI4
+ADDRGP4 trap_S_StopBackgroundTrack
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 $90
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_S_StartBackgroundTrack
+CALLV
+pop
+LABELV $88
+endproc UI_StartCreditMusic 4 8
+export UI_StartMusic
+proc UI_StartMusic 4 8
+ADDRGP4 uis+11424
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRGP4 $93
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_S_StartBackgroundTrack
+CALLV
+pop
+LABELV $91
+endproc UI_StartMusic 4 8
+export UI_StopMusic
+proc UI_StopMusic 0 0
+ADDRGP4 uis+11424
+INDIRI4
+CNSTI4 1
+NEI4 $95
+ADDRGP4 trap_S_StopBackgroundTrack
+CALLV
+pop
+LABELV $95
+ADDRGP4 uis+11424
+CNSTI4 0
+ASGNI4
+LABELV $94
+endproc UI_StopMusic 0 0
+export UI_PushMenu
+proc UI_PushMenu 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $103
+JUMPV
+LABELV $100
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uis+24
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+NEU4 $105
+ADDRGP4 uis+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $102
+JUMPV
+LABELV $105
+LABELV $101
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $103
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uis+16
+INDIRI4
+LTI4 $100
+LABELV $102
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uis+16
+INDIRI4
+NEI4 $109
+ADDRGP4 uis+16
+INDIRI4
+CNSTI4 8
+LTI4 $112
+ADDRGP4 $115
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $112
+ADDRLP4 12
+ADDRGP4 uis+16
+ASGNP4
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uis+24
+ADDP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $109
+ADDRGP4 uis+20
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 m_entersound
+CNSTI4 1
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 288
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $119
+ADDRFP4 0
+INDIRP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $120
+JUMPV
+LABELV $119
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $124
+JUMPV
+LABELV $121
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 26624
+BANDU4
+CNSTU4 0
+NEU4 $125
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Menu_SetCursor
+CALLV
+pop
+ADDRGP4 $123
+JUMPV
+LABELV $125
+LABELV $122
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $124
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $121
+LABELV $123
+LABELV $120
+ADDRGP4 uis+13856
+CNSTI4 1
+ASGNI4
+LABELV $99
+endproc UI_PushMenu 16 8
+export UI_PopMenu
+proc UI_PopMenu 4 4
+ADDRLP4 0
+ADDRGP4 uis+16
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 uis+16
+INDIRI4
+CNSTI4 0
+GEI4 $130
+ADDRGP4 $133
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $130
+ADDRGP4 uis+16
+INDIRI4
+CNSTI4 0
+EQI4 $134
+ADDRGP4 uis+20
+ADDRGP4 uis+16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uis+24-4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 uis+13856
+CNSTI4 1
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $134
+ADDRGP4 UI_ForceMenuOff
+CALLV
+pop
+LABELV $135
+LABELV $128
+endproc UI_PopMenu 4 4
+export UI_ForceMenuOff
+proc UI_ForceMenuOff 8 8
+ADDRGP4 uis+16
+CNSTI4 0
+ASGNI4
+ADDRGP4 uis+20
+CNSTP4 0
+ASGNP4
+ADDRGP4 $147
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CVFI4 4
+CNSTI4 0
+NEI4 $145
+ADDRGP4 UI_StopMusic
+CALLV
+pop
+LABELV $145
+ADDRLP4 4
+ADDRGP4 trap_Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -3
+BANDI4
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 trap_Key_ClearStates
+CALLV
+pop
+ADDRGP4 $147
+ARGP4
+ADDRGP4 $148
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $142
+endproc UI_ForceMenuOff 8 8
+export UI_LerpColor
+proc UI_LerpColor 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $150
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $154
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $155
+JUMPV
+LABELV $154
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+LEF4 $156
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $156
+LABELV $155
+LABELV $151
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $150
+LABELV $149
+endproc UI_LerpColor 12 0
+lit
+align 4
+LABELV propMap
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 8
+byte 4 11
+byte 4 122
+byte 4 7
+byte 4 154
+byte 4 181
+byte 4 14
+byte 4 55
+byte 4 122
+byte 4 17
+byte 4 79
+byte 4 122
+byte 4 18
+byte 4 101
+byte 4 122
+byte 4 23
+byte 4 153
+byte 4 122
+byte 4 18
+byte 4 9
+byte 4 93
+byte 4 7
+byte 4 207
+byte 4 122
+byte 4 8
+byte 4 230
+byte 4 122
+byte 4 9
+byte 4 177
+byte 4 122
+byte 4 18
+byte 4 30
+byte 4 152
+byte 4 18
+byte 4 85
+byte 4 181
+byte 4 7
+byte 4 34
+byte 4 93
+byte 4 11
+byte 4 110
+byte 4 181
+byte 4 6
+byte 4 130
+byte 4 152
+byte 4 14
+byte 4 22
+byte 4 64
+byte 4 17
+byte 4 41
+byte 4 64
+byte 4 12
+byte 4 58
+byte 4 64
+byte 4 17
+byte 4 78
+byte 4 64
+byte 4 18
+byte 4 98
+byte 4 64
+byte 4 19
+byte 4 120
+byte 4 64
+byte 4 18
+byte 4 141
+byte 4 64
+byte 4 18
+byte 4 204
+byte 4 64
+byte 4 16
+byte 4 162
+byte 4 64
+byte 4 17
+byte 4 182
+byte 4 64
+byte 4 18
+byte 4 59
+byte 4 181
+byte 4 7
+byte 4 35
+byte 4 181
+byte 4 7
+byte 4 203
+byte 4 152
+byte 4 14
+byte 4 56
+byte 4 93
+byte 4 14
+byte 4 228
+byte 4 152
+byte 4 14
+byte 4 177
+byte 4 181
+byte 4 18
+byte 4 28
+byte 4 122
+byte 4 22
+byte 4 5
+byte 4 4
+byte 4 18
+byte 4 27
+byte 4 4
+byte 4 18
+byte 4 48
+byte 4 4
+byte 4 18
+byte 4 69
+byte 4 4
+byte 4 17
+byte 4 90
+byte 4 4
+byte 4 13
+byte 4 106
+byte 4 4
+byte 4 13
+byte 4 121
+byte 4 4
+byte 4 18
+byte 4 143
+byte 4 4
+byte 4 17
+byte 4 164
+byte 4 4
+byte 4 8
+byte 4 175
+byte 4 4
+byte 4 16
+byte 4 195
+byte 4 4
+byte 4 18
+byte 4 216
+byte 4 4
+byte 4 12
+byte 4 230
+byte 4 4
+byte 4 23
+byte 4 6
+byte 4 34
+byte 4 18
+byte 4 27
+byte 4 34
+byte 4 18
+byte 4 48
+byte 4 34
+byte 4 18
+byte 4 68
+byte 4 34
+byte 4 18
+byte 4 90
+byte 4 34
+byte 4 17
+byte 4 110
+byte 4 34
+byte 4 18
+byte 4 130
+byte 4 34
+byte 4 14
+byte 4 146
+byte 4 34
+byte 4 18
+byte 4 166
+byte 4 34
+byte 4 19
+byte 4 185
+byte 4 34
+byte 4 29
+byte 4 215
+byte 4 34
+byte 4 18
+byte 4 234
+byte 4 34
+byte 4 18
+byte 4 5
+byte 4 64
+byte 4 14
+byte 4 60
+byte 4 152
+byte 4 7
+byte 4 106
+byte 4 151
+byte 4 13
+byte 4 83
+byte 4 152
+byte 4 7
+byte 4 128
+byte 4 122
+byte 4 17
+byte 4 4
+byte 4 152
+byte 4 21
+byte 4 134
+byte 4 181
+byte 4 5
+byte 4 5
+byte 4 4
+byte 4 18
+byte 4 27
+byte 4 4
+byte 4 18
+byte 4 48
+byte 4 4
+byte 4 18
+byte 4 69
+byte 4 4
+byte 4 17
+byte 4 90
+byte 4 4
+byte 4 13
+byte 4 106
+byte 4 4
+byte 4 13
+byte 4 121
+byte 4 4
+byte 4 18
+byte 4 143
+byte 4 4
+byte 4 17
+byte 4 164
+byte 4 4
+byte 4 8
+byte 4 175
+byte 4 4
+byte 4 16
+byte 4 195
+byte 4 4
+byte 4 18
+byte 4 216
+byte 4 4
+byte 4 12
+byte 4 230
+byte 4 4
+byte 4 23
+byte 4 6
+byte 4 34
+byte 4 18
+byte 4 27
+byte 4 34
+byte 4 18
+byte 4 48
+byte 4 34
+byte 4 18
+byte 4 68
+byte 4 34
+byte 4 18
+byte 4 90
+byte 4 34
+byte 4 17
+byte 4 110
+byte 4 34
+byte 4 18
+byte 4 130
+byte 4 34
+byte 4 14
+byte 4 146
+byte 4 34
+byte 4 18
+byte 4 166
+byte 4 34
+byte 4 19
+byte 4 185
+byte 4 34
+byte 4 29
+byte 4 215
+byte 4 34
+byte 4 18
+byte 4 234
+byte 4 34
+byte 4 18
+byte 4 5
+byte 4 64
+byte 4 14
+byte 4 153
+byte 4 152
+byte 4 13
+byte 4 11
+byte 4 181
+byte 4 5
+byte 4 180
+byte 4 152
+byte 4 13
+byte 4 79
+byte 4 93
+byte 4 17
+byte 4 0
+byte 4 0
+byte 4 -1
+export UI_ProportionalStringWidth
+code
+proc UI_ProportionalStringWidth 16 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $160
+JUMPV
+LABELV $159
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 127
+BANDI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 propMap+8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+EQI4 $163
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+ADDI4
+ASGNI4
+LABELV $163
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $160
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $159
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+SUBI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $158
+endproc UI_ProportionalStringWidth 16 0
+export UI_DrawProportionalString2
+proc UI_DrawProportionalString2 4152 12
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 4108
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 4112
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+13832
+INDIRF4
+MULF4
+ADDRGP4 uis+13840
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4136
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+13836
+INDIRF4
+MULF4
+ADDRGP4 uis+13844
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $171
+JUMPV
+LABELV $170
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 127
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+CNSTI4 32
+NEI4 $173
+ADDRLP4 4108
+CNSTF4 1090519040
+ADDRGP4 uis+13832
+INDIRF4
+MULF4
+ADDRFP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $174
+JUMPV
+LABELV $173
+CNSTI4 12
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+MULI4
+ADDRGP4 propMap+8
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $176
+ADDRLP4 4140
+CNSTI4 12
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+MULI4
+ASGNI4
+ADDRLP4 4144
+CNSTF4 1132462080
+ASGNF4
+ADDRLP4 4120
+ADDRLP4 4140
+INDIRI4
+ADDRGP4 propMap
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 4144
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 4116
+ADDRLP4 4140
+INDIRI4
+ADDRGP4 propMap+4
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 4144
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 4128
+ADDRLP4 4140
+INDIRI4
+ADDRGP4 propMap+8
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 4144
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 4132
+CNSTF4 1037565952
+ASGNF4
+ADDRLP4 4108
+ADDRLP4 4140
+INDIRI4
+ADDRGP4 propMap+8
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+13832
+INDIRF4
+MULF4
+ADDRFP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4124
+CNSTF4 1104674816
+ADDRGP4 uis+13836
+INDIRF4
+MULF4
+ADDRFP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 128
+NEI4 $184
+ADDRLP4 12
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPics
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $184
+ADDRLP4 8
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 4112
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 12+4
+ADDP4
+ADDRLP4 4136
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 12+8
+ADDP4
+ADDRLP4 4108
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 12+12
+ADDP4
+ADDRLP4 4124
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 12+16
+ADDP4
+ADDRLP4 4120
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 12+20
+ADDP4
+ADDRLP4 4116
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 12+24
+ADDP4
+ADDRLP4 4120
+INDIRF4
+ADDRLP4 4128
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 12+28
+ADDP4
+ADDRLP4 4116
+INDIRF4
+ADDRLP4 4132
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $176
+LABELV $174
+ADDRLP4 4112
+ADDRLP4 4112
+INDIRF4
+ADDRLP4 4108
+INDIRF4
+CNSTF4 1077936128
+ADDRGP4 uis+13832
+INDIRF4
+MULF4
+ADDRFP4 16
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $171
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $170
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $194
+ADDRLP4 12
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPics
+CALLV
+pop
+LABELV $194
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $165
+endproc UI_DrawProportionalString2 4152 12
+export UI_ProportionalSizeScale
+proc UI_ProportionalSizeScale 0 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $197
+CNSTF4 1061158912
+RETF4
+ADDRGP4 $196
+JUMPV
+LABELV $197
+CNSTF4 1065353216
+RETF4
+LABELV $196
+endproc UI_ProportionalSizeScale 0 0
+export UI_DrawProportionalString
+proc UI_DrawProportionalString 52 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 UI_ProportionalSizeScale
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 12
+INDIRI4
+CNSTI4 7
+BANDI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $201
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+EQI4 $203
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+EQI4 $204
+ADDRGP4 $201
+JUMPV
+LABELV $203
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 UI_ProportionalStringWidth
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 36
+INDIRI4
+CVIF4 4
+ADDRLP4 16
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ASGNI4
+ADDRGP4 $201
+JUMPV
+LABELV $204
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 UI_ProportionalStringWidth
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+ADDRLP4 16
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $201
+ADDRFP4 12
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $206
+ADDRLP4 36
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 40
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 uis+13816
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawProportionalString2
+CALLV
+pop
+LABELV $206
+ADDRFP4 12
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $212
+ADDRLP4 36
+CNSTF4 1060320051
+ASGNF4
+ADDRLP4 0
+ADDRLP4 36
+INDIRF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 36
+INDIRF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1060320051
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 uis+13816
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawProportionalString2
+CALLV
+pop
+ADDRGP4 $199
+JUMPV
+LABELV $212
+ADDRFP4 12
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $218
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 uis+13816
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawProportionalString2
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 75
+DIVI4
+CVIF4 4
+ARGF4
+ADDRLP4 40
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1048576000
+ADDRLP4 40
+INDIRF4
+MULF4
+CNSTF4 1061158912
+ADDF4
+ASGNF4
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 48
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+SUBI4
+CNSTF4 1086303764
+ADDRLP4 44
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+MULF4
+CVFI4 4
+ADDI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+SUBI4
+CNSTF4 1086303764
+ADDRLP4 48
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191182336
+DIVF4
+MULF4
+CVFI4 4
+ADDI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 uis+13816
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawProportionalString2
+CALLV
+pop
+ADDRGP4 $199
+JUMPV
+LABELV $218
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 uis+13816
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawProportionalString2
+CALLV
+pop
+LABELV $199
+endproc UI_DrawProportionalString 52 24
+export CharWidthForStringStyle
+proc CharWidthForStringStyle 0 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $228
+CNSTI4 8
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $228
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $230
+CNSTI4 32
+RETI4
+ADDRGP4 $227
+JUMPV
+LABELV $230
+CNSTI4 16
+RETI4
+LABELV $227
+endproc CharWidthForStringStyle 0 0
+export CharHeightForStringStyle
+proc CharHeightForStringStyle 0 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $233
+CNSTI4 16
+RETI4
+ADDRGP4 $232
+JUMPV
+LABELV $233
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $235
+CNSTI4 48
+RETI4
+ADDRGP4 $232
+JUMPV
+LABELV $235
+CNSTI4 16
+RETI4
+LABELV $232
+endproc CharHeightForStringStyle 0 0
+export UI_AutoWrappedString_LineCount
+proc UI_AutoWrappedString_LineCount 1084 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $240
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $238
+LABELV $240
+CNSTI4 0
+RETI4
+ADDRGP4 $237
+JUMPV
+LABELV $238
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 1056
+ADDRGP4 UI_ProportionalSizeScale
+CALLF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 1056
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 28
+ASGNP4
+ADDRLP4 8
+ADDRLP4 28
+ASGNP4
+ADDRLP4 12
+ADDRLP4 28
+ASGNP4
+ADDRGP4 $242
+JUMPV
+LABELV $241
+LABELV $244
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $245
+ADDRLP4 1060
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 32
+EQI4 $248
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+EQI4 $248
+ADDRLP4 1060
+INDIRI4
+CNSTI4 10
+NEI4 $244
+LABELV $248
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $249
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 1068
+ADDRGP4 UI_ProportionalStringWidth
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 1068
+INDIRI4
+CVIF4 4
+ADDRLP4 24
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $250
+JUMPV
+LABELV $249
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 1072
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 1076
+ADDRGP4 CharWidthForStringStyle
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 1072
+INDIRU4
+ADDRLP4 1076
+INDIRI4
+CVIU4 4
+MULU4
+CVUI4 4
+ASGNI4
+LABELV $250
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI1
+ASGNI1
+ADDRLP4 16
+INDIRI4
+ADDRFP4 0
+INDIRI4
+GTI4 $253
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 10
+NEI4 $251
+LABELV $253
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+NEU4 $254
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $254
+ADDRLP4 8
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $256
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $243
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $243
+JUMPV
+LABELV $256
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $252
+JUMPV
+LABELV $251
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $260
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $243
+JUMPV
+LABELV $260
+LABELV $252
+LABELV $242
+ADDRGP4 $241
+JUMPV
+LABELV $243
+ADDRLP4 20
+INDIRI4
+RETI4
+LABELV $237
+endproc UI_AutoWrappedString_LineCount 1084 12
+export UI_DrawString_AutoWrapped
+proc UI_DrawString_AutoWrapped 1080 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 24
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRFP4 28
+ADDRFP4 28
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $265
+ADDRFP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $263
+LABELV $265
+ADDRGP4 $262
+JUMPV
+LABELV $263
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRLP4 1052
+ADDRGP4 UI_ProportionalSizeScale
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 1052
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 24
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+ASGNP4
+ADDRLP4 8
+ADDRLP4 24
+ASGNP4
+ADDRGP4 $267
+JUMPV
+LABELV $266
+LABELV $269
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $270
+ADDRLP4 1056
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 32
+EQI4 $273
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+EQI4 $273
+ADDRLP4 1056
+INDIRI4
+CNSTI4 10
+NEI4 $269
+LABELV $273
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+NEI4 $274
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $276
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRGP4 $277
+JUMPV
+LABELV $276
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $277
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ADDRFP4 12
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $267
+JUMPV
+LABELV $274
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $278
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1064
+ADDRGP4 UI_ProportionalStringWidth
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 1064
+INDIRI4
+CVIF4 4
+ADDRLP4 20
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $279
+JUMPV
+LABELV $278
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1068
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRLP4 1072
+ADDRGP4 CharWidthForStringStyle
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 1068
+INDIRU4
+ADDRLP4 1072
+INDIRI4
+CVIU4 4
+MULU4
+CVUI4 4
+ASGNI4
+LABELV $279
+ADDRLP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI1
+ASGNI1
+ADDRLP4 16
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LEI4 $280
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+NEU4 $282
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $282
+ADDRLP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $284
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRGP4 $285
+JUMPV
+LABELV $284
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $285
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ADDRFP4 12
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $286
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $268
+ADDRFP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $290
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRGP4 $268
+JUMPV
+LABELV $290
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRGP4 $268
+JUMPV
+LABELV $286
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $281
+JUMPV
+LABELV $280
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $292
+ADDRFP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $294
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRGP4 $268
+JUMPV
+LABELV $294
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRGP4 $268
+JUMPV
+LABELV $292
+LABELV $281
+LABELV $267
+ADDRGP4 $266
+JUMPV
+LABELV $268
+LABELV $262
+endproc UI_DrawString_AutoWrapped 1080 20
+proc UI_DrawString2 4164 12
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 4140
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRFP4 20
+INDIRI4
+NEGI4
+GEI4 $297
+ADDRGP4 $296
+JUMPV
+LABELV $297
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 4108
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+13832
+INDIRF4
+MULF4
+ADDRGP4 uis+13840
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4144
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+13836
+INDIRF4
+MULF4
+ADDRGP4 uis+13844
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4112
+ADDRFP4 16
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+13832
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4148
+ADDRFP4 20
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+13836
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $306
+JUMPV
+LABELV $305
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4152
+ADDRGP4 Q_IsColorString
+CALLI4
+ASGNI4
+ADDRLP4 4152
+INDIRI4
+CNSTI4 0
+EQI4 $308
+ADDRLP4 4140
+INDIRI4
+CNSTI4 0
+NEI4 $310
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $312
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uis+13812
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPics
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $312
+ADDRLP4 4124
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 4124+12
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4124
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $310
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $306
+JUMPV
+LABELV $308
+ADDRLP4 4104
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 255
+BANDI4
+CVII1 4
+ASGNI1
+ADDRLP4 4104
+INDIRI1
+CVII4 1
+CNSTI4 32
+EQI4 $316
+ADDRLP4 4156
+CNSTF4 1031798784
+ASGNF4
+ADDRLP4 4160
+ADDRLP4 4104
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4116
+ADDRLP4 4156
+INDIRF4
+ADDRLP4 4160
+INDIRI4
+CNSTI4 4
+RSHI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 4120
+ADDRLP4 4156
+INDIRF4
+ADDRLP4 4160
+INDIRI4
+CNSTI4 15
+BANDI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 128
+NEI4 $318
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uis+13812
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPics
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $318
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 4108
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 8+4
+ADDP4
+ADDRLP4 4144
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 8+8
+ADDP4
+ADDRLP4 4112
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 8+12
+ADDP4
+ADDRLP4 4148
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 8+16
+ADDP4
+ADDRLP4 4120
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 8+20
+ADDP4
+ADDRLP4 4116
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 8+24
+ADDP4
+ADDRLP4 4120
+INDIRF4
+CNSTF4 1031798784
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 8+28
+ADDP4
+ADDRLP4 4116
+INDIRF4
+CNSTF4 1031798784
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $316
+ADDRLP4 4108
+ADDRLP4 4108
+INDIRF4
+ADDRLP4 4112
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $306
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $305
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $328
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uis+13812
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPics
+CALLV
+pop
+LABELV $328
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $296
+endproc UI_DrawString2 4164 12
+export UI_DrawString
+proc UI_DrawString 92 24
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $332
+ADDRGP4 $331
+JUMPV
+LABELV $332
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 4096
+BANDI4
+ADDRLP4 64
+INDIRI4
+EQI4 $334
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 200
+DIVI4
+CNSTI4 1
+BANDI4
+ADDRLP4 64
+INDIRI4
+EQI4 $334
+ADDRGP4 $331
+JUMPV
+LABELV $334
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 CharWidthForStringStyle
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 72
+ADDRGP4 CharHeightForStringStyle
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $337
+ADDRLP4 76
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 24
+ADDRLP4 76
+INDIRF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 76
+INDIRF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 1061997773
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24+12
+CNSTF4 1061997773
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 75
+DIVI4
+CVIF4 4
+ARGF4
+ADDRLP4 84
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 84
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 UI_LerpColor
+CALLV
+pop
+ADDRGP4 $338
+JUMPV
+LABELV $337
+ADDRLP4 0
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $338
+ADDRLP4 40
+ADDRLP4 0
+ASGNP4
+ADDRLP4 76
+ADDRFP4 12
+INDIRI4
+CNSTI4 7
+BANDI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+EQI4 $349
+ADDRLP4 76
+INDIRI4
+CNSTI4 2
+EQI4 $350
+ADDRGP4 $347
+JUMPV
+LABELV $349
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 60
+ADDRLP4 84
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 60
+INDIRI4
+ADDRLP4 16
+INDIRI4
+MULI4
+CNSTI4 2
+DIVI4
+SUBI4
+ASGNI4
+ADDRGP4 $347
+JUMPV
+LABELV $350
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 60
+ADDRLP4 88
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 60
+INDIRI4
+ADDRLP4 16
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+LABELV $347
+ADDRFP4 12
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $351
+ADDRLP4 84
+CNSTF4 0
+ASGNF4
+ADDRLP4 44+8
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 44+4
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 44+12
+ADDRLP4 40
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 88
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 88
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 88
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawString2
+CALLV
+pop
+LABELV $351
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawString2
+CALLV
+pop
+LABELV $331
+endproc UI_DrawString 92 24
+export UI_DrawStringNS
+proc UI_DrawStringNS 84 24
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $357
+ADDRGP4 $356
+JUMPV
+LABELV $357
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 4096
+BANDI4
+ADDRLP4 64
+INDIRI4
+EQI4 $359
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 200
+DIVI4
+CNSTI4 1
+BANDI4
+ADDRLP4 64
+INDIRI4
+EQI4 $359
+ADDRGP4 $356
+JUMPV
+LABELV $359
+ADDRFP4 12
+INDIRI4
+CNSTI4 32768
+BANDI4
+CNSTI4 0
+EQI4 $362
+ADDRLP4 68
+ADDRFP4 16
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRGP4 $363
+JUMPV
+LABELV $362
+ADDRLP4 68
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 68
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 68
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $363
+ADDRFP4 12
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $364
+ADDRLP4 68
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 8
+ADDRLP4 68
+INDIRF4
+ADDRFP4 20
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 68
+INDIRF4
+ADDRFP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8+8
+CNSTF4 1061997773
+ADDRFP4 20
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8+12
+CNSTF4 1061997773
+ADDRFP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 75
+DIVI4
+CVIF4 4
+ARGF4
+ADDRLP4 76
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 44
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 76
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 UI_LerpColor
+CALLV
+pop
+ADDRLP4 24
+ADDRLP4 44
+ASGNP4
+ADDRGP4 $365
+JUMPV
+LABELV $364
+ADDRLP4 24
+ADDRFP4 20
+INDIRP4
+ASGNP4
+LABELV $365
+ADDRLP4 68
+ADDRFP4 12
+INDIRI4
+CNSTI4 7
+BANDI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+EQI4 $373
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+EQI4 $374
+ADDRGP4 $371
+JUMPV
+LABELV $373
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 60
+ADDRLP4 76
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 60
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 2
+DIVI4
+SUBI4
+ASGNI4
+ADDRGP4 $371
+JUMPV
+LABELV $374
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 60
+ADDRLP4 80
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 60
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+LABELV $371
+ADDRFP4 12
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $375
+ADDRLP4 76
+CNSTF4 0
+ASGNF4
+ADDRLP4 28+8
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 28+4
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 28+12
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 80
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 80
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawString2
+CALLV
+pop
+LABELV $375
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawString2
+CALLV
+pop
+LABELV $356
+endproc UI_DrawStringNS 84 24
+export UI_DrawChar
+proc UI_DrawChar 2 20
+ADDRLP4 0
+ADDRFP4 8
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0+1
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $380
+endproc UI_DrawChar 2 20
+export UI_IsFullscreen
+proc UI_IsFullscreen 4 0
+ADDRGP4 uis+20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $383
+ADDRLP4 0
+ADDRGP4 trap_Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $383
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 280
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $382
+JUMPV
+LABELV $383
+CNSTI4 0
+RETI4
+LABELV $382
+endproc UI_IsFullscreen 4 0
+export UI_SetActiveMenu
+proc UI_SetActiveMenu 8 8
+ADDRGP4 Menu_Cache
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $388
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+GTI4 $388
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $397
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $397
+address $391
+address $392
+address $393
+address $388
+address $388
+address $395
+address $395
+code
+LABELV $391
+ADDRGP4 UI_ForceMenuOff
+CALLV
+pop
+ADDRGP4 $387
+JUMPV
+LABELV $392
+ADDRGP4 UI_MainMenu
+CALLV
+pop
+ADDRGP4 $387
+JUMPV
+LABELV $393
+ADDRGP4 $147
+ARGP4
+ADDRGP4 $394
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 UI_InGameMenu
+CALLV
+pop
+ADDRGP4 $387
+JUMPV
+LABELV $395
+LABELV $388
+ADDRGP4 $396
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $389
+LABELV $387
+endproc UI_SetActiveMenu 8 8
+export UI_KeyEvent
+proc UI_KeyEvent 16 8
+ADDRGP4 uis+20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $399
+ADDRGP4 $398
+JUMPV
+LABELV $399
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $402
+ADDRGP4 $398
+JUMPV
+LABELV $402
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 272
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $404
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 272
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $405
+JUMPV
+LABELV $404
+ADDRGP4 uis+20
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 Menu_DefaultKey
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $405
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $409
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menu_null_sound
+INDIRI4
+EQI4 $409
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $409
+LABELV $398
+endproc UI_KeyEvent 16 8
+export UI_MouseEvent
+proc UI_MouseEvent 76 8
+ADDRGP4 uis+20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $412
+ADDRGP4 $411
+JUMPV
+LABELV $412
+ADDRLP4 8
+ADDRGP4 uis+8
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 uis+8
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+13840
+INDIRF4
+NEGF4
+GEF4 $416
+ADDRGP4 uis+8
+ADDRGP4 uis+13840
+INDIRF4
+NEGF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $417
+JUMPV
+LABELV $416
+ADDRGP4 uis+8
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+13840
+INDIRF4
+CNSTF4 1142947840
+ADDF4
+LEF4 $422
+ADDRGP4 uis+8
+ADDRGP4 uis+13840
+INDIRF4
+CNSTF4 1142947840
+ADDF4
+CVFI4 4
+ASGNI4
+LABELV $422
+LABELV $417
+ADDRLP4 12
+ADDRGP4 uis+12
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 uis+12
+INDIRI4
+CNSTI4 0
+GEI4 $429
+ADDRGP4 uis+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $430
+JUMPV
+LABELV $429
+ADDRGP4 uis+12
+INDIRI4
+CNSTI4 480
+LEI4 $433
+ADDRGP4 uis+12
+CNSTI4 480
+ASGNI4
+LABELV $433
+LABELV $430
+ADDRGP4 uis+11404
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $437
+ADDRGP4 $411
+JUMPV
+LABELV $437
+ADDRGP4 uis+20
+INDIRP4
+INDIRI4
+CNSTI4 0
+LTI4 $440
+CNSTI4 178
+ARGI4
+ADDRLP4 16
+ADDRGP4 trap_Key_IsDown
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $440
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRLP4 24
+CNSTI4 12
+ASGNI4
+ADDRGP4 uis+20
+INDIRP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ADDRGP4 uis+20
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $440
+ADDRGP4 uis+20
+INDIRP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ADDRGP4 uis+20
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ADDP4
+INDIRP4
+INDIRI4
+CNSTI4 1
+NEI4 $440
+ADDRLP4 28
+ADDRGP4 uis+20
+INDIRP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 40
+CNSTI4 16
+ASGNI4
+ADDRLP4 32
+ADDRGP4 uis+8
+INDIRI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+SUBI4
+ADDRLP4 40
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 28
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 28
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 32
+INDIRI4
+CVIF4 4
+CNSTF4 1117782016
+DIVF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRLP4 48
+INDIRF4
+SUBF4
+MULF4
+ADDRLP4 48
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+GEF4 $450
+ADDRLP4 28
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $451
+JUMPV
+LABELV $450
+ADDRLP4 28
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+LEF4 $452
+ADDRLP4 28
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $452
+LABELV $451
+ADDRLP4 28
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+EQF4 $454
+ADDRLP4 28
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $454
+ADDRLP4 28
+INDIRP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $454
+LABELV $440
+ADDRLP4 4
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $459
+JUMPV
+LABELV $456
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 24576
+BANDU4
+CNSTU4 0
+EQU4 $462
+ADDRGP4 $457
+JUMPV
+LABELV $462
+ADDRGP4 uis+8
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+LTI4 $472
+ADDRGP4 uis+8
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+GTI4 $472
+ADDRGP4 uis+12
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+LTI4 $472
+ADDRGP4 uis+12
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+LEI4 $464
+LABELV $472
+ADDRGP4 $457
+JUMPV
+LABELV $464
+ADDRGP4 uis+20
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $473
+ADDRGP4 uis+20
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Menu_SetCursor
+CALLV
+pop
+ADDRLP4 32
+CNSTI4 4
+ASGNI4
+ADDRGP4 uis+20
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $477
+ADDRGP4 uis+20
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+GEI4 $477
+ADDRLP4 36
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 48
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 4294966783
+BANDU4
+ASGNU4
+LABELV $477
+ADDRGP4 uis+20
+INDIRP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 1048576
+BANDU4
+CNSTU4 0
+NEU4 $484
+ADDRGP4 menu_move_sound
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $484
+LABELV $473
+ADDRLP4 32
+ADDRGP4 uis+20
+INDIRP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 48
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 512
+BORU4
+ASGNU4
+ADDRGP4 $411
+JUMPV
+LABELV $457
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $459
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $456
+ADDRGP4 uis+20
+INDIRP4
+INDIRI4
+CNSTI4 0
+LTI4 $490
+ADDRGP4 uis+20
+INDIRP4
+INDIRI4
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+GEI4 $490
+ADDRLP4 28
+ADDRGP4 uis+20
+INDIRP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 48
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 4294966783
+BANDU4
+ASGNU4
+LABELV $490
+LABELV $411
+endproc UI_MouseEvent 76 8
+bss
+align 1
+LABELV $498
+skip 1024
+export UI_Argv
+code
+proc UI_Argv 0 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $498
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRGP4 $498
+RETP4
+LABELV $497
+endproc UI_Argv 0 12
+bss
+align 1
+LABELV $500
+skip 1024
+export UI_Cvar_VariableString
+code
+proc UI_Cvar_VariableString 0 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $500
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 $500
+RETP4
+LABELV $499
+endproc UI_Cvar_VariableString 0 12
+export UI_Cache_f
+proc UI_Cache_f 0 0
+ADDRGP4 MainMenu_Cache
+CALLV
+pop
+ADDRGP4 InGame_Cache
+CALLV
+pop
+ADDRGP4 ConfirmMenu_Cache
+CALLV
+pop
+ADDRGP4 PlayerSettings_Cache
+CALLV
+pop
+ADDRGP4 Controls_Cache
+CALLV
+pop
+ADDRGP4 Demos_Cache
+CALLV
+pop
+ADDRGP4 Preferences_Cache
+CALLV
+pop
+ADDRGP4 ServerInfo_Cache
+CALLV
+pop
+ADDRGP4 SpecifyServer_Cache
+CALLV
+pop
+ADDRGP4 ArenaServers_Cache
+CALLV
+pop
+ADDRGP4 StartServer_Cache
+CALLV
+pop
+ADDRGP4 GraphicsOptions_Cache
+CALLV
+pop
+ADDRGP4 UI_DisplayOptionsMenu_Cache
+CALLV
+pop
+ADDRGP4 UI_SoundOptionsMenu_Cache
+CALLV
+pop
+ADDRGP4 UI_NetworkOptionsMenu_Cache
+CALLV
+pop
+ADDRGP4 TeamMain_Cache
+CALLV
+pop
+ADDRGP4 UI_AddBots_Cache
+CALLV
+pop
+ADDRGP4 UI_RemoveBots_Cache
+CALLV
+pop
+ADDRGP4 UI_SetupMenu_Cache
+CALLV
+pop
+ADDRGP4 SetupDefaultMenu_Cache
+CALLV
+pop
+ADDRGP4 UI_BigCredits_Cache
+CALLV
+pop
+ADDRGP4 UI_BotSelectMenu_Cache
+CALLV
+pop
+ADDRGP4 UI_ModsMenu_Cache
+CALLV
+pop
+LABELV $501
+endproc UI_Cache_f 0 0
+export UI_ConsoleCommand
+proc UI_ConsoleCommand 36 8
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 uis
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uis+4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 uis+4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 UI_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 Menu_Cache
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $507
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $505
+ADDRGP4 UI_TeamOrdersMenu_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $502
+JUMPV
+LABELV $505
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $510
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $508
+ADDRGP4 MusicMenu_Open
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $502
+JUMPV
+LABELV $508
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $513
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $511
+ADDRGP4 Music_Check
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $502
+JUMPV
+LABELV $511
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $516
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $514
+ADDRGP4 Music_NextTrack
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $502
+JUMPV
+LABELV $514
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $519
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $517
+ADDRGP4 Music_TriggerRestart
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $502
+JUMPV
+LABELV $517
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $522
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $520
+ADDRGP4 UI_HelpMenu_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $502
+JUMPV
+LABELV $520
+CNSTI4 0
+RETI4
+LABELV $502
+endproc UI_ConsoleCommand 36 8
+export UI_Shutdown
+proc UI_Shutdown 0 0
+ADDRGP4 UI_StopMusic
+CALLV
+pop
+ADDRGP4 MusicMenu_Shutdown
+CALLV
+pop
+LABELV $523
+endproc UI_Shutdown 0 0
+export UI_Init
+proc UI_Init 0 8
+ADDRGP4 UI_RegisterCvars
+CALLV
+pop
+ADDRGP4 SetDefaultBinds_onUnusedKeys
+CALLV
+pop
+ADDRGP4 s_wop_restarted+12
+INDIRI4
+CNSTI4 1
+EQI4 $525
+ADDRGP4 $528
+ARGP4
+ADDRGP4 $394
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $525
+ADDRGP4 MusicMenu_Init
+CALLV
+pop
+ADDRGP4 UI_InitGameinfo
+CALLV
+pop
+ADDRGP4 uis+56
+ARGP4
+ADDRGP4 trap_GetGlconfig
+CALLV
+pop
+ADDRGP4 uis+13832
+CNSTF4 986500301
+ADDRGP4 uis+56+11304
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRGP4 uis+13836
+CNSTF4 990414985
+ADDRGP4 uis+56+11308
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+CNSTI4 480
+ADDRGP4 uis+56+11304
+INDIRI4
+MULI4
+CNSTI4 640
+ADDRGP4 uis+56+11308
+INDIRI4
+MULI4
+LEI4 $536
+ADDRGP4 uis+13840
+CNSTF4 1056964608
+ADDRGP4 uis+56+11304
+INDIRI4
+CVIF4 4
+CNSTF4 1068149419
+ADDRGP4 uis+56+11308
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRGP4 uis+13832
+ADDRGP4 uis+13836
+INDIRF4
+ASGNF4
+ADDRGP4 $537
+JUMPV
+LABELV $536
+ADDRGP4 uis+13840
+CNSTF4 0
+ASGNF4
+LABELV $537
+CNSTI4 480
+ADDRGP4 uis+56+11304
+INDIRI4
+MULI4
+CNSTI4 640
+ADDRGP4 uis+56+11308
+INDIRI4
+MULI4
+GEI4 $550
+ADDRGP4 uis+13844
+CNSTF4 1056964608
+ADDRGP4 uis+56+11308
+INDIRI4
+CVIF4 4
+CNSTF4 1061158912
+ADDRGP4 uis+56+11304
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRGP4 uis+13836
+ADDRGP4 uis+13832
+INDIRF4
+ASGNF4
+ADDRGP4 $551
+JUMPV
+LABELV $550
+ADDRGP4 uis+13844
+CNSTF4 0
+ASGNF4
+LABELV $551
+ADDRGP4 uis+13848
+CNSTF4 1059061760
+ADDRGP4 uis+13832
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 Menu_Cache
+CALLV
+pop
+ADDRGP4 uis+20
+CNSTP4 0
+ASGNP4
+ADDRGP4 uis+16
+CNSTI4 0
+ASGNI4
+LABELV $524
+endproc UI_Init 0 8
+export UI_AdjustFrom640
+proc UI_AdjustFrom640 16 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 uis+13832
+INDIRF4
+MULF4
+ADDRGP4 uis+13840
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 uis+13836
+INDIRF4
+MULF4
+ADDRGP4 uis+13844
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ADDRGP4 uis+13832
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRGP4 uis+13836
+INDIRF4
+MULF4
+ASGNF4
+LABELV $568
+endproc UI_AdjustFrom640 16 0
+export UI_AdjustFrom1024
+proc UI_AdjustFrom1024 16 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 uis+13848
+INDIRF4
+MULF4
+ADDRGP4 uis+13840
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 uis+13848
+INDIRF4
+MULF4
+ADDRGP4 uis+13844
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ADDRGP4 uis+13848
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRGP4 uis+13848
+INDIRF4
+MULF4
+ASGNF4
+LABELV $575
+endproc UI_AdjustFrom1024 16 0
+export UI_DrawNamedPic
+proc UI_DrawNamedPic 16 36
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 UI_AdjustFrom640
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $582
+endproc UI_DrawNamedPic 16 36
+export UI_DrawHandlePic
+proc UI_DrawHandlePic 16 36
+ADDRFP4 8
+INDIRF4
+CNSTF4 0
+GEF4 $584
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $585
+JUMPV
+LABELV $584
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+LABELV $585
+ADDRFP4 12
+INDIRF4
+CNSTF4 0
+GEF4 $586
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRGP4 $587
+JUMPV
+LABELV $586
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+LABELV $587
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 UI_AdjustFrom640
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $583
+endproc UI_DrawHandlePic 16 36
+export UI_DrawHandlePic1024
+proc UI_DrawHandlePic1024 16 36
+ADDRFP4 8
+INDIRF4
+CNSTF4 0
+GEF4 $589
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $590
+JUMPV
+LABELV $589
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+LABELV $590
+ADDRFP4 12
+INDIRF4
+CNSTF4 0
+GEF4 $591
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRGP4 $592
+JUMPV
+LABELV $591
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+LABELV $592
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 UI_AdjustFrom1024
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $588
+endproc UI_DrawHandlePic1024 16 36
+export UI_FillRect
+proc UI_FillRect 4 36
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 UI_AdjustFrom640
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 uis+11392
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $593
+endproc UI_FillRect 4 36
+export UI_DrawRect
+proc UI_DrawRect 24 36
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 UI_AdjustFrom640
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 uis+11392
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 uis+11392
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRFP4 20
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRGP4 uis+11392
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRLP4 16
+ADDRFP4 20
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRGP4 uis+11392
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $595
+endproc UI_DrawRect 24 36
+export UI_SetColor
+proc UI_SetColor 0 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $600
+endproc UI_SetColor 0 4
+export UI_UpdateScreen
+proc UI_UpdateScreen 0 0
+ADDRGP4 trap_UpdateScreen
+CALLV
+pop
+LABELV $601
+endproc UI_UpdateScreen 0 0
+export UI_DrawIngameBG
+proc UI_DrawIngameBG 12 20
+ADDRLP4 0
+CNSTF4 1139802112
+ADDRGP4 uis+56+11304
+INDIRI4
+CVIF4 4
+MULF4
+ADDRGP4 uis+56+11308
+INDIRI4
+CVIF4 4
+DIVF4
+CNSTF4 1142947840
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $607
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $607
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 0
+INDIRF4
+MULF4
+SUBF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1142947840
+ADDF4
+ARGF4
+CNSTF4 1139802112
+ARGF4
+ADDRGP4 uis+11500
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $602
+endproc UI_DrawIngameBG 12 20
+export UI_DrawMenu
+proc UI_DrawMenu 72 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $611
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+CNSTI4 65536
+BANDI4
+CNSTI4 0
+EQI4 $613
+ADDRGP4 uis+16
+INDIRI4
+CNSTI4 2
+SUBI4
+CNSTI4 0
+LEI4 $614
+ADDRGP4 uis+16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uis+24-8
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawMenu
+CALLV
+pop
+ADDRGP4 $614
+JUMPV
+LABELV $613
+ADDRFP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $621
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 uis+56+11304
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 uis+56+11308
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 uis+11392
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $628
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $630
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+CNSTF4 1139802112
+ARGF4
+ADDRGP4 uis+11436
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $630
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+CNSTI4 32768
+BANDI4
+CNSTI4 0
+EQI4 $633
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+CNSTF4 1139802112
+ARGF4
+ADDRGP4 uis+11432
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $633
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $636
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+CNSTF4 1139802112
+ARGF4
+ADDRGP4 uis+11440
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $636
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $639
+ADDRLP4 16
+CNSTF4 0
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+CNSTF4 1139802112
+ARGF4
+ADDRGP4 uis+11444
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $639
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $642
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+CNSTF4 1139802112
+ARGF4
+ADDRGP4 uis+11448
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $642
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $645
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+CNSTF4 1139802112
+ARGF4
+ADDRGP4 uis+11452
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $645
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $648
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+CNSTF4 1139802112
+ARGF4
+ADDRGP4 uis+11456
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $648
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $651
+ADDRLP4 32
+CNSTF4 0
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+CNSTF4 1139802112
+ARGF4
+ADDRGP4 uis+11460
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $651
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $654
+ADDRLP4 36
+CNSTF4 0
+ASGNF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+CNSTF4 1139802112
+ARGF4
+ADDRGP4 uis+11464
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $654
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $657
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+CNSTF4 1139802112
+ARGF4
+ADDRGP4 uis+11468
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $657
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $660
+ADDRLP4 44
+CNSTF4 0
+ASGNF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+CNSTF4 1139802112
+ARGF4
+ADDRGP4 uis+11472
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $660
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $663
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+CNSTF4 1139802112
+ARGF4
+ADDRGP4 uis+11476
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $663
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $666
+ADDRLP4 52
+CNSTF4 0
+ASGNF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+CNSTF4 1139802112
+ARGF4
+ADDRGP4 uis+11480
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $666
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+CNSTI4 131072
+BANDI4
+CNSTI4 0
+EQI4 $669
+ADDRLP4 56
+CNSTF4 0
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+CNSTF4 1139802112
+ARGF4
+ADDRGP4 uis+11484
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $669
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $672
+ADDRLP4 60
+CNSTF4 0
+ASGNF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+CNSTF4 1139802112
+ARGF4
+ADDRGP4 uis+11488
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $672
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $675
+ADDRLP4 64
+CNSTF4 0
+ASGNF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+CNSTF4 1139802112
+ARGF4
+ADDRGP4 uis+11492
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $675
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $629
+ADDRLP4 68
+CNSTF4 0
+ASGNF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+CNSTF4 1139802112
+ARGF4
+ADDRGP4 uis+11496
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+ADDRGP4 $629
+JUMPV
+LABELV $628
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+CNSTF4 1139802112
+ARGF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+LABELV $629
+LABELV $621
+LABELV $614
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $681
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $682
+JUMPV
+LABELV $681
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+LABELV $682
+ADDRGP4 uis+13856
+INDIRI4
+CNSTI4 0
+EQI4 $683
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 UI_MouseEvent
+CALLV
+pop
+ADDRGP4 uis+13856
+CNSTI4 0
+ASGNI4
+LABELV $683
+LABELV $611
+LABELV $610
+endproc UI_DrawMenu 72 36
+export UI_Refresh
+proc UI_Refresh 48 24
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 uis
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uis+4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 uis+4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 trap_Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $690
+ADDRGP4 $687
+JUMPV
+LABELV $690
+ADDRGP4 UI_UpdateCvars
+CALLV
+pop
+ADDRGP4 $147
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+NEF4 $692
+ADDRGP4 uis+11424
+INDIRI4
+CNSTI4 0
+NEI4 $693
+ADDRGP4 UI_StartMusic
+CALLV
+pop
+ADDRGP4 $693
+JUMPV
+LABELV $692
+ADDRGP4 Music_Check
+CALLV
+pop
+LABELV $693
+ADDRGP4 uis+20
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawMenu
+CALLV
+pop
+ADDRGP4 uis+20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $702
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $698
+LABELV $702
+CNSTP4 0
+ARGP4
+ADDRGP4 UI_SetColor
+CALLV
+pop
+ADDRLP4 12
+CNSTI4 16
+ASGNI4
+ADDRGP4 uis+8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRGP4 uis+12
+INDIRI4
+ADDRLP4 12
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 uis+13820
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $698
+ADDRGP4 uis+11388
+INDIRI4
+CNSTI4 0
+EQI4 $706
+ADDRLP4 40
+ADDRGP4 trap_Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $710
+ADDRLP4 36
+CNSTI4 240
+ASGNI4
+ADDRGP4 $711
+JUMPV
+LABELV $710
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+LABELV $711
+ADDRLP4 12
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $712
+ARGP4
+ADDRGP4 uis+8
+INDIRI4
+ARGI4
+ADDRGP4 uis+12
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 16
+ARGP4
+ADDRLP4 44
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 32
+ADDRLP4 44
+INDIRU4
+CVUI4 4
+ASGNI4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 32
+INDIRI4
+CNSTI4 3
+LSHI4
+CNSTI4 2
+ADDI4
+CVIF4 4
+ARGF4
+CNSTF4 1099956224
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 32
+INDIRI4
+CNSTI4 3
+LSHI4
+CNSTI4 2
+ADDI4
+CVIF4 4
+ARGF4
+CNSTF4 1099956224
+ARGF4
+ADDRGP4 colorBlack
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_DrawRect
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $706
+ADDRGP4 m_entersound
+INDIRI4
+CNSTI4 0
+EQI4 $715
+ADDRGP4 m_entersound
+CNSTI4 0
+ASGNI4
+LABELV $715
+LABELV $687
+endproc UI_Refresh 48 24
+export UI_DrawTextBox
+proc UI_DrawTextBox 24 24
+ADDRLP4 0
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRLP4 8
+CNSTI4 16
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+CNSTI4 4
+ASGNI4
+ADDRLP4 20
+CNSTI4 16
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_DrawRect
+CALLV
+pop
+LABELV $717
+endproc UI_DrawTextBox 24 24
+export UI_CursorInRect
+proc UI_CursorInRect 8 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 uis+8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LTI4 $727
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 uis+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $727
+ADDRGP4 uis+8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+GTI4 $727
+ADDRGP4 uis+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 12
+INDIRI4
+ADDI4
+LEI4 $719
+LABELV $727
+CNSTI4 0
+RETI4
+ADDRGP4 $718
+JUMPV
+LABELV $719
+CNSTI4 1
+RETI4
+LABELV $718
+endproc UI_CursorInRect 8 0
+export UI_ModelIcon
+proc UI_ModelIcon 80 20
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 68
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $729
+ADDRLP4 72
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 72
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $730
+JUMPV
+LABELV $729
+ADDRLP4 0
+ADDRGP4 $731
+ASGNP4
+LABELV $730
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $732
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $733
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $731
+ARGP4
+ADDRLP4 76
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $733
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $735
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $733
+LABELV $728
+endproc UI_ModelIcon 80 20
+proc GetBotListSpecialScore 20 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $739
+ARGP4
+ADDRLP4 0
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $737
+CNSTI4 5
+RETI4
+ADDRGP4 $736
+JUMPV
+LABELV $737
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $742
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $740
+CNSTI4 4
+RETI4
+ADDRGP4 $736
+JUMPV
+LABELV $740
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $745
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $743
+CNSTI4 3
+RETI4
+ADDRGP4 $736
+JUMPV
+LABELV $743
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $748
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $746
+CNSTI4 2
+RETI4
+ADDRGP4 $736
+JUMPV
+LABELV $746
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $751
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $749
+CNSTI4 1
+RETI4
+ADDRGP4 $736
+JUMPV
+LABELV $749
+CNSTI4 0
+RETI4
+LABELV $736
+endproc GetBotListSpecialScore 20 8
+export BotListCompare
+proc BotListCompare 60 8
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 UI_GetBotInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 UI_GetBotInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $753
+ARGP4
+ADDRLP4 32
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $753
+ARGP4
+ADDRLP4 36
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 GetBotListSpecialScore
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 GetBotListSpecialScore
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 56
+INDIRI4
+NEI4 $756
+ADDRLP4 44
+INDIRI4
+ADDRLP4 56
+INDIRI4
+EQI4 $754
+LABELV $756
+ADDRLP4 44
+INDIRI4
+ADDRLP4 40
+INDIRI4
+SUBI4
+RETI4
+ADDRGP4 $752
+JUMPV
+LABELV $754
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+RETI4
+LABELV $752
+endproc BotListCompare 60 8
+bss
+align 4
+LABELV m_entersound
+skip 4
+import UI_HelpMenu_Cache
+import UI_HelpMenu_f
+import UI_HelpMenu
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import UI_InitGameinfo
+import UI_GetNumBots
+import UI_GetBotInfoByNumber
+import UI_GetNumArenas
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_VoiceIngame
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_GetVoiceGainClient
+import trap_GetVoiceMuteAll
+import trap_GetVoiceMuteClient
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_CIN_SetExtents
+import trap_CIN_StopCinematic
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_PlayCinematic
+import trap_RealTime
+import trap_S_StartBackgroundTrack
+import trap_S_StopBackgroundTrack
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_SaveCachedServers
+import trap_LAN_LoadCachedServers
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+export uis
+align 4
+LABELV uis
+skip 13860
+import UI_ClearModelCache
+import UI_PrecacheClientModelname
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import UI_SpecifyPasswordMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import Demos_Cache
+import UI_DemosMenu
+import SetDefaultBinds_onUnusedKeys
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import SetupDefaultMenu_Cache
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import Music_NextTrack
+import Music_TriggerRestart
+import Music_Check
+import MusicMenu_Cache
+import MusicMenu_Open
+import MusicMenu_Shutdown
+import MusicMenu_Init
+import UI_CallVoteMenu
+import UI_InGameMenu
+import InGame_Cache
+import UI_SecretMenu
+import UI_InitBigCredits
+import UI_BigCredits_Cache
+import UI_CreditMenu
+import ExitMenu_Cache
+import ExitMenu_Init
+import UI_MainMenu
+import MainMenu_Cache
+import UI_UpdateCvars
+import UI_RegisterCvars
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import listbar_bluecolor
+import text_color_bluehighlight
+import text_color_bluenormal
+import text_color_ighighlight
+import text_color_ignormal
+import listbar_igcolor
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_lightOrange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_click_sound
+import menu_switch_sound
+import menu_move_sound
+import ScrollList_Key
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import wop_AutoBindUnusedKeys
+import wop_AutoswitchSongByNextMap
+import con_notifytime
+import s_wop_restarted
+import syc_logo
+import spraycolor
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_createGametype
+import ui_browserHidePrivate
+import ui_browserOnlyHumans
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $753
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $751
+byte 1 102
+byte 1 97
+byte 1 116
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $748
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 108
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $745
+byte 1 109
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $742
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 103
+byte 1 105
+byte 1 114
+byte 1 108
+byte 1 0
+align 1
+LABELV $739
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $735
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $732
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $731
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $712
+byte 1 40
+byte 1 37
+byte 1 105
+byte 1 44
+byte 1 37
+byte 1 105
+byte 1 41
+byte 1 0
+align 1
+LABELV $528
+byte 1 115
+byte 1 95
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $522
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 0
+align 1
+LABELV $519
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 0
+align 1
+LABELV $516
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $513
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 0
+align 1
+LABELV $510
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 0
+align 1
+LABELV $507
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 79
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $396
+byte 1 85
+byte 1 73
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $394
+byte 1 49
+byte 1 0
+align 1
+LABELV $148
+byte 1 48
+byte 1 0
+align 1
+LABELV $147
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $133
+byte 1 85
+byte 1 73
+byte 1 95
+byte 1 80
+byte 1 111
+byte 1 112
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 58
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $115
+byte 1 85
+byte 1 73
+byte 1 95
+byte 1 80
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 58
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $93
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 47
+byte 1 50
+byte 1 50
+byte 1 107
+byte 1 104
+byte 1 122
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 101
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $90
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 48
+byte 1 57
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 45
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 40
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 41
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $87
+byte 1 100
+byte 1 49
+byte 1 10
+byte 1 0
@@ -0,0 +1,3491 @@
+data
+align 4
+LABELV colorTOrange
+byte 4 1065353216
+byte 4 1054615798
+byte 4 0
+byte 4 1059648963
+align 4
+LABELV colorMOver
+byte 4 1053609165
+byte 4 0
+byte 4 1053609165
+byte 4 1065353216
+align 4
+LABELV callvote_strs
+address $77
+address $78
+address $79
+address $80
+address $81
+address $82
+address $83
+byte 4 0
+code
+proc UI_CallVote_Vote 8 8
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $86
+ADDRGP4 $85
+JUMPV
+LABELV $86
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+EQI4 $91
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+EQI4 $93
+ADDRGP4 $89
+JUMPV
+LABELV $91
+CNSTI4 2
+ARGI4
+ADDRGP4 $92
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $89
+JUMPV
+LABELV $93
+CNSTI4 2
+ARGI4
+ADDRGP4 $94
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $89
+LABELV $85
+endproc UI_CallVote_Vote 8 8
+proc UI_CallVote_GoEvent 20 12
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $96
+ADDRGP4 $95
+JUMPV
+LABELV $96
+ADDRGP4 s_callVoteMenu+1996
+ADDRGP4 uis+4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 s_callVoteMenu+1424+48
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRGP4 s_callVoteMenu+1976
+INDIRI4
+CNSTI4 0
+EQI4 $102
+ADDRGP4 s_callVoteMenu+968+68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_callVoteMenu+968+80
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $80
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $105
+ADDRGP4 $111
+ARGP4
+ADDRGP4 s_callVoteMenu+1988
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRGP4 $103
+JUMPV
+LABELV $105
+ADDRGP4 $113
+ARGP4
+ADDRGP4 s_callVoteMenu+968+68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_callVoteMenu+968+80
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 s_callVoteMenu+1988
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRGP4 $103
+JUMPV
+LABELV $102
+ADDRGP4 s_callVoteMenu+1088+48
+INDIRU4
+CNSTU4 20480
+BANDU4
+CNSTU4 0
+NEU4 $119
+ADDRGP4 $113
+ARGP4
+ADDRGP4 s_callVoteMenu+968+68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_callVoteMenu+968+80
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 s_callVoteMenu+1088+64+12
+ARGP4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $120
+JUMPV
+LABELV $119
+ADDRGP4 s_callVoteMenu+968+68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_callVoteMenu+968+80
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $82
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $130
+ADDRLP4 0
+ADDRGP4 $136
+ASGNP4
+ADDRGP4 $131
+JUMPV
+LABELV $130
+ADDRGP4 s_callVoteMenu+968+68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_callVoteMenu+968+80
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $83
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $137
+ADDRLP4 0
+ADDRGP4 $143
+ASGNP4
+ADDRGP4 $138
+JUMPV
+LABELV $137
+ADDRGP4 $144
+ARGP4
+ADDRGP4 s_callVoteMenu+968+68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_callVoteMenu+968+80
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+LABELV $138
+LABELV $131
+LABELV $120
+LABELV $103
+ADDRGP4 uis+11424
+CNSTI4 2
+ASGNI4
+ADDRGP4 $150
+ARGP4
+ADDRGP4 $151
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $152
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $95
+endproc UI_CallVote_GoEvent 20 12
+proc UI_CallVote_ClickListItem 0 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $154
+ADDRGP4 $153
+JUMPV
+LABELV $154
+ADDRGP4 s_callVoteMenu+1984
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 20
+SUBI4
+ADDRGP4 s_callVoteMenu+1980
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 s_callVoteMenu+1988
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $153
+endproc UI_CallVote_ClickListItem 0 0
+proc UI_CallVote_BackEvent 0 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $160
+ADDRGP4 $159
+JUMPV
+LABELV $160
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $159
+endproc UI_CallVote_BackEvent 0 0
+proc UI_CallVote_UpdateItems 20 4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRGP4 ArrayForListStrs
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $166
+JUMPV
+LABELV $163
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 s_callVoteMenu+1980
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $169
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+GEI4 $169
+CNSTI4 84
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 s_callVoteMenu+296+64
+ADDP4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 84
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 s_callVoteMenu+296+48
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $169
+LABELV $164
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 12
+INDIRU4
+CNSTU4 1
+ADDU4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $166
+ADDRLP4 0
+INDIRI4
+ADDRGP4 s_callVoteMenu+1976
+INDIRI4
+LTI4 $163
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $178
+JUMPV
+LABELV $175
+ADDRLP4 16
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_callVoteMenu+296+48
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+LABELV $176
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $178
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $175
+LABELV $162
+endproc UI_CallVote_UpdateItems 20 4
+proc UI_CallVote_UpEvent 4 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $182
+ADDRGP4 $181
+JUMPV
+LABELV $182
+ADDRGP4 s_callVoteMenu+1980
+INDIRI4
+CNSTI4 0
+LEI4 $184
+ADDRLP4 0
+ADDRGP4 s_callVoteMenu+1980
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 UI_CallVote_UpdateItems
+CALLV
+pop
+LABELV $184
+LABELV $181
+endproc UI_CallVote_UpEvent 4 0
+proc UI_CallVote_DownEvent 4 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $189
+ADDRGP4 $188
+JUMPV
+LABELV $189
+ADDRGP4 s_callVoteMenu+1980
+INDIRI4
+CNSTI4 8
+ADDI4
+ADDRGP4 s_callVoteMenu+1976
+INDIRI4
+GEI4 $191
+ADDRLP4 0
+ADDRGP4 s_callVoteMenu+1980
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 UI_CallVote_UpdateItems
+CALLV
+pop
+LABELV $191
+LABELV $188
+endproc UI_CallVote_DownEvent 4 0
+proc UI_CallVote_UpdatePassiveButtons 32 8
+ADDRGP4 s_callVoteMenu+1992
+INDIRI4
+CNSTI4 0
+EQI4 $197
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $200
+ADDRLP4 4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_callVoteMenu+296+48
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+LABELV $201
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $200
+ADDRLP4 4
+ADDRGP4 s_callVoteMenu+968+48
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRLP4 8
+ADDRGP4 s_callVoteMenu+1088+48
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRLP4 12
+ADDRGP4 s_callVoteMenu+1424+48
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRLP4 16
+ADDRGP4 s_callVoteMenu+1760+48
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRLP4 20
+ADDRGP4 s_callVoteMenu+1868+48
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRLP4 24
+ADDRGP4 s_callVoteMenu+1592+48
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+ADDRLP4 28
+ADDRGP4 s_callVoteMenu+1676+48
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+ADDRGP4 $198
+JUMPV
+LABELV $197
+ADDRLP4 4
+ADDRGP4 s_callVoteMenu+968+48
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+ADDRGP4 s_callVoteMenu+968
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 UI_CallVote_CVType
+CALLV
+pop
+ADDRLP4 8
+ADDRGP4 s_callVoteMenu+1424+48
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+ADDRLP4 12
+ADDRGP4 s_callVoteMenu+1592+48
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRLP4 16
+ADDRGP4 s_callVoteMenu+1676+48
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+LABELV $198
+LABELV $196
+endproc UI_CallVote_UpdatePassiveButtons 32 8
+proc UI_CallVote_Draw 1084 24
+ADDRGP4 UI_DrawIngameBG
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 110
+ARGI4
+ADDRGP4 $230
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_black
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+CNSTI4 8
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigString
+CALLI4
+pop
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $231
+ADDRGP4 s_callVoteMenu+1992
+INDIRI4
+CNSTI4 0
+NEI4 $233
+ADDRGP4 s_callVoteMenu+1992
+CNSTI4 1
+ASGNI4
+ADDRGP4 UI_CallVote_UpdatePassiveButtons
+CALLV
+pop
+LABELV $233
+ADDRLP4 0
+ARGP4
+ADDRLP4 1064
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1060
+ADDRLP4 1064
+INDIRI4
+CNSTI4 30000
+ADDI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+CNSTI4 240
+ARGI4
+CNSTI4 130
+ARGI4
+ADDRGP4 $237
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTF4 1098907648
+ARGF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 UI_DrawStringNS
+CALLV
+pop
+ADDRGP4 $238
+ARGP4
+ADDRLP4 1068
+ADDRLP4 1060
+INDIRI4
+ASGNI4
+ADDRLP4 1072
+CNSTI4 60
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+ADDRLP4 1072
+INDIRI4
+DIVI4
+ARGI4
+ADDRLP4 1068
+INDIRI4
+ADDRLP4 1072
+INDIRI4
+MODI4
+ARGI4
+ADDRLP4 1076
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 240
+ARGI4
+CNSTI4 146
+ARGI4
+ADDRLP4 1076
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTF4 1098907648
+ARGF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 UI_DrawStringNS
+CALLV
+pop
+CNSTI4 9
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigString
+CALLI4
+pop
+CNSTI4 240
+ARGI4
+CNSTI4 170
+ARGI4
+ADDRGP4 $239
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTF4 1098907648
+ARGF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 UI_DrawStringNS
+CALLV
+pop
+ADDRLP4 1024
+CNSTI4 0
+ASGNI4
+LABELV $240
+ADDRLP4 1028
+ARGP4
+CNSTI4 20
+ADDRLP4 1024
+INDIRI4
+MULI4
+ADDRLP4 0
+ADDP4
+ARGP4
+CNSTI4 21
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1024
+ADDRLP4 1024
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTI4 240
+ARGI4
+CNSTI4 17
+ADDRLP4 1024
+INDIRI4
+MULI4
+CNSTI4 170
+ADDI4
+ARGI4
+ADDRLP4 1028
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTF4 1098907648
+ARGF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 UI_DrawStringNS
+CALLV
+pop
+LABELV $241
+ADDRLP4 1028
+ARGP4
+ADDRLP4 1080
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1080
+INDIRU4
+CNSTU4 20
+EQU4 $240
+CNSTI4 10
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigString
+CALLI4
+pop
+CNSTI4 230
+ARGI4
+CNSTI4 285
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTF4 1102577664
+ARGF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 UI_DrawStringNS
+CALLV
+pop
+CNSTI4 11
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigString
+CALLI4
+pop
+CNSTI4 360
+ARGI4
+CNSTI4 285
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 2
+ARGI4
+CNSTF4 1102577664
+ARGF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 UI_DrawStringNS
+CALLV
+pop
+ADDRGP4 $232
+JUMPV
+LABELV $231
+ADDRGP4 s_callVoteMenu+1992
+INDIRI4
+CNSTI4 0
+EQI4 $243
+ADDRGP4 s_callVoteMenu+1992
+CNSTI4 0
+ASGNI4
+ADDRGP4 UI_CallVote_UpdatePassiveButtons
+CALLV
+pop
+LABELV $243
+ADDRGP4 uis+4
+INDIRI4
+ADDRGP4 s_callVoteMenu+1996
+INDIRI4
+SUBI4
+CNSTI4 5000
+LEI4 $247
+ADDRLP4 1024
+ADDRGP4 s_callVoteMenu+1424+48
+ASGNP4
+ADDRLP4 1024
+INDIRP4
+ADDRLP4 1024
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+LABELV $247
+CNSTI4 240
+ARGI4
+CNSTI4 130
+ARGI4
+ADDRGP4 $253
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTF4 1099956224
+ARGF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 UI_DrawStringNS
+CALLV
+pop
+ADDRGP4 s_callVoteMenu+1976
+INDIRI4
+CNSTI4 0
+EQI4 $254
+ADDRLP4 1024
+ADDRGP4 s_callVoteMenu+1984
+INDIRI4
+ADDRGP4 s_callVoteMenu+1980
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1024
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 0
+LTI4 $259
+ADDRLP4 1028
+INDIRI4
+CNSTI4 8
+GEI4 $259
+CNSTF4 1130627072
+ARGF4
+CNSTI4 18
+ADDRLP4 1024
+INDIRI4
+MULI4
+CNSTI4 170
+ADDI4
+CVIF4 4
+ARGF4
+CNSTF4 1126432768
+ARGF4
+CNSTF4 1099956224
+ARGF4
+ADDRGP4 colorTOrange
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+LABELV $259
+LABELV $254
+LABELV $232
+ADDRGP4 s_callVoteMenu
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+LABELV $229
+endproc UI_CallVote_Draw 1084 24
+proc CallVoteMenu_Key 16 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 141
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $266
+ADDRLP4 0
+INDIRI4
+CNSTI4 142
+EQI4 $264
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $263
+LABELV $268
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 183
+EQI4 $266
+ADDRLP4 8
+INDIRI4
+CNSTI4 184
+EQI4 $264
+ADDRGP4 $263
+JUMPV
+LABELV $264
+ADDRGP4 s_callVoteMenu+1760
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 UI_CallVote_UpEvent
+CALLV
+pop
+ADDRGP4 $263
+JUMPV
+LABELV $266
+ADDRGP4 s_callVoteMenu+1868
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 UI_CallVote_DownEvent
+CALLV
+pop
+LABELV $263
+ADDRGP4 s_callVoteMenu
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 Menu_DefaultKey
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $261
+endproc CallVoteMenu_Key 16 8
+proc removeEndings 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 12
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $273
+JUMPV
+LABELV $270
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $274
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ADDRFP4 4
+INDIRI4
+LTI4 $276
+ADDRLP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $272
+JUMPV
+LABELV $276
+LABELV $274
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+EQU4 $278
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $278
+LABELV $271
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $273
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ADDRFP4 4
+INDIRI4
+LTI4 $270
+LABELV $272
+LABELV $269
+endproc removeEndings 20 8
+data
+align 4
+LABELV cvGametype_strs
+address $280
+address $281
+address $282
+address $283
+address $284
+address $285
+address $286
+byte 4 0
+code
+proc UI_CallVote_CVType 1100 16
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $288
+ADDRGP4 $287
+JUMPV
+LABELV $288
+ADDRLP4 1036
+ADDRGP4 s_callVoteMenu+1088+48
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+ADDRLP4 1036
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRGP4 s_callVoteMenu+1976
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_callVoteMenu+1980
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_callVoteMenu+1984
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_callVoteMenu+1988
+ADDRGP4 ArrayForListStrs
+ASGNP4
+ADDRGP4 ArrayForListStrs
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 8192
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 1032
+ADDRGP4 s_callVoteMenu+968+68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_callVoteMenu+968+80
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $78
+ARGP4
+ADDRLP4 1040
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $300
+ADDRLP4 1044
+ADDRGP4 s_callVoteMenu+1088+48
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+ADDRLP4 1044
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigString
+CALLI4
+pop
+ADDRLP4 8
+ARGP4
+ADDRGP4 $78
+ARGP4
+ADDRLP4 1048
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 s_callVoteMenu+1088+64+12
+ARGP4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $301
+JUMPV
+LABELV $300
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $79
+ARGP4
+ADDRLP4 1044
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $310
+ADDRLP4 1048
+ADDRGP4 s_callVoteMenu+1088+48
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+ADDRLP4 1048
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigString
+CALLI4
+pop
+ADDRLP4 8
+ARGP4
+ADDRGP4 $79
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 s_callVoteMenu+1088+64+12
+ARGP4
+ADDRLP4 1052
+INDIRP4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $311
+JUMPV
+LABELV $310
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $80
+ARGP4
+ADDRLP4 1048
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $320
+ADDRLP4 0
+ADDRGP4 ArrayForListStrs
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $325
+JUMPV
+LABELV $322
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cvGametype_strs
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 8192
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 ArrayForListStrs
+CVPU4 4
+SUBU4
+CVUI4 4
+SUBI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1056
+ADDRGP4 s_callVoteMenu+1976
+ASGNP4
+ADDRLP4 1056
+INDIRP4
+ADDRLP4 1056
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1060
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 1060
+INDIRU4
+CNSTU4 1
+ADDU4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+CNSTI4 8192
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 ArrayForListStrs
+CVPU4 4
+SUBU4
+CVUI4 4
+GEI4 $327
+ADDRGP4 $321
+JUMPV
+LABELV $327
+LABELV $323
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $325
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cvGametype_strs
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $322
+ADDRGP4 $321
+JUMPV
+LABELV $320
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $81
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $329
+ADDRGP4 $332
+ARGP4
+ADDRGP4 $333
+ARGP4
+ADDRGP4 ArrayForListStrs
+ARGP4
+CNSTI4 8192
+ARGI4
+ADDRLP4 1056
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRGP4 s_callVoteMenu+1976
+ADDRLP4 1056
+INDIRI4
+ASGNI4
+ADDRGP4 ArrayForListStrs
+ARGP4
+CNSTI4 8192
+ARGI4
+ADDRGP4 $334
+ARGP4
+ADDRGP4 removeEndings
+CALLV
+pop
+ADDRGP4 $330
+JUMPV
+LABELV $329
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $77
+ARGP4
+ADDRLP4 1056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $335
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigString
+CALLI4
+pop
+ADDRLP4 8
+ARGP4
+ADDRGP4 $337
+ARGP4
+ADDRLP4 1064
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1064
+INDIRP4
+ARGP4
+ADDRLP4 1068
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1060
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 ArrayForListStrs
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $341
+JUMPV
+LABELV $338
+ADDRLP4 4
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigString
+CALLI4
+pop
+ADDRLP4 8
+ARGP4
+ADDRGP4 $342
+ARGP4
+ADDRLP4 1076
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1072
+ADDRLP4 1076
+INDIRP4
+ASGNP4
+ADDRLP4 1080
+ADDRLP4 1072
+INDIRP4
+ASGNP4
+ADDRLP4 1080
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $343
+ADDRLP4 1080
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $343
+ADDRLP4 8
+ARGP4
+ADDRGP4 $342
+ARGP4
+ADDRLP4 1084
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1084
+INDIRP4
+ARGP4
+CNSTI4 8192
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 ArrayForListStrs
+CVPU4 4
+SUBU4
+CVUI4 4
+SUBI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1092
+ADDRGP4 s_callVoteMenu+1976
+ASGNP4
+ADDRLP4 1092
+INDIRP4
+ADDRLP4 1092
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1096
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 1096
+INDIRU4
+CNSTU4 1
+ADDU4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+CNSTI4 8192
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 ArrayForListStrs
+CVPU4 4
+SUBU4
+CVUI4 4
+GEI4 $346
+ADDRGP4 $340
+JUMPV
+LABELV $346
+LABELV $343
+LABELV $339
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $341
+ADDRLP4 4
+INDIRI4
+ADDRLP4 1060
+INDIRI4
+LTI4 $338
+LABELV $340
+LABELV $335
+LABELV $330
+LABELV $321
+LABELV $311
+LABELV $301
+ADDRGP4 UI_CallVote_UpdateItems
+CALLV
+pop
+ADDRGP4 s_callVoteMenu+1976
+INDIRI4
+CNSTI4 8
+LEI4 $348
+ADDRLP4 1060
+ADDRGP4 s_callVoteMenu+1868+48
+ASGNP4
+ADDRLP4 1060
+INDIRP4
+ADDRLP4 1060
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+ADDRLP4 1064
+ADDRGP4 s_callVoteMenu+1760+48
+ASGNP4
+ADDRLP4 1064
+INDIRP4
+ADDRLP4 1064
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+ADDRGP4 $349
+JUMPV
+LABELV $348
+ADDRLP4 1060
+ADDRGP4 s_callVoteMenu+1868+48
+ASGNP4
+ADDRLP4 1060
+INDIRP4
+ADDRLP4 1060
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRLP4 1064
+ADDRGP4 s_callVoteMenu+1760+48
+ASGNP4
+ADDRLP4 1064
+INDIRP4
+ADDRLP4 1064
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+LABELV $349
+LABELV $287
+endproc UI_CallVote_CVType 1100 16
+proc UI_CallVoteMenu_Init 1056 12
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigString
+CALLI4
+pop
+ADDRGP4 s_callVoteMenu
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 2000
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 s_callVoteMenu+268
+ADDRGP4 UI_CallVote_Draw
+ASGNP4
+ADDRGP4 s_callVoteMenu+280
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_callVoteMenu+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_callVoteMenu+272
+ADDRGP4 CallVoteMenu_Key
+ASGNP4
+ADDRGP4 UI_CallVote_Cache
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 148
+ASGNI4
+ADDRGP4 s_callVoteMenu+968
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_callVoteMenu+968+48
+CNSTU4 2097154
+ASGNU4
+ADDRGP4 s_callVoteMenu+968+16
+CNSTI4 250
+ASGNI4
+ADDRGP4 s_callVoteMenu+968+20
+CNSTI4 148
+ASGNI4
+ADDRGP4 s_callVoteMenu+968+4
+ADDRGP4 $373
+ASGNP4
+ADDRGP4 s_callVoteMenu+968+12
+CNSTI4 12
+ASGNI4
+ADDRGP4 s_callVoteMenu+968+80
+ADDRGP4 callvote_strs
+ASGNP4
+ADDRGP4 s_callVoteMenu+968+68
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_callVoteMenu+968+52
+ADDRGP4 UI_CallVote_CVType
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 20
+ADDI4
+ASGNI4
+ADDRGP4 s_callVoteMenu+1088
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_callVoteMenu+1088+4
+ADDRGP4 $385
+ASGNP4
+ADDRGP4 s_callVoteMenu+1088+48
+CNSTU4 2097186
+ASGNU4
+ADDRGP4 s_callVoteMenu+1088+16
+CNSTI4 300
+ASGNI4
+ADDRGP4 s_callVoteMenu+1088+20
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_callVoteMenu+1088+64+8
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_callVoteMenu+1088+64+268
+CNSTI4 5
+ASGNI4
+ADDRLP4 1032
+ADDRGP4 s_callVoteMenu+1088+48
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ADDRLP4 1032
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRGP4 s_callVoteMenu+1760
+CNSTI4 11
+ASGNI4
+ADDRGP4 s_callVoteMenu+1760+76
+CNSTI4 638
+ASGNI4
+ADDRGP4 s_callVoteMenu+1760+80
+CNSTI4 300
+ASGNI4
+ADDRGP4 s_callVoteMenu+1760+84
+CNSTI4 29
+ASGNI4
+ADDRGP4 s_callVoteMenu+1760+88
+CNSTI4 74
+ASGNI4
+ADDRGP4 $411
+ARGP4
+ADDRLP4 1036
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_callVoteMenu+1760+64
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRGP4 $414
+ARGP4
+ADDRLP4 1040
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_callVoteMenu+1760+72
+ADDRLP4 1040
+INDIRI4
+ASGNI4
+ADDRGP4 s_callVoteMenu+1760+52
+ADDRGP4 UI_CallVote_UpEvent
+ASGNP4
+ADDRGP4 s_callVoteMenu+1760+12
+CNSTI4 13
+ASGNI4
+ADDRGP4 s_callVoteMenu+1868
+CNSTI4 11
+ASGNI4
+ADDRGP4 s_callVoteMenu+1868+76
+CNSTI4 638
+ASGNI4
+ADDRGP4 s_callVoteMenu+1868+80
+CNSTI4 398
+ASGNI4
+ADDRGP4 s_callVoteMenu+1868+84
+CNSTI4 29
+ASGNI4
+ADDRGP4 s_callVoteMenu+1868+88
+CNSTI4 74
+ASGNI4
+ADDRGP4 $430
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_callVoteMenu+1868+64
+ADDRLP4 1044
+INDIRI4
+ASGNI4
+ADDRGP4 $433
+ARGP4
+ADDRLP4 1048
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_callVoteMenu+1868+72
+ADDRLP4 1048
+INDIRI4
+ASGNI4
+ADDRGP4 s_callVoteMenu+1868+52
+ADDRGP4 UI_CallVote_DownEvent
+ASGNP4
+ADDRGP4 s_callVoteMenu+1868+12
+CNSTI4 14
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 170
+ASGNI4
+ADDRGP4 $441
+JUMPV
+LABELV $438
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_callVoteMenu+296
+ADDP4
+CNSTI4 12
+ASGNI4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_callVoteMenu+296+76
+ADDP4
+CNSTF4 1098907648
+ASGNF4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_callVoteMenu+296+48
+ADDP4
+CNSTU4 4
+ASGNU4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_callVoteMenu+296+12
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 20
+ADDI4
+ASGNI4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_callVoteMenu+296+16
+ADDP4
+CNSTI4 230
+ASGNI4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_callVoteMenu+296+20
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_callVoteMenu+296+52
+ADDP4
+ADDRGP4 UI_CallVote_ClickListItem
+ASGNP4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_callVoteMenu+296+64
+ADDP4
+ADDRGP4 $457
+ASGNP4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_callVoteMenu+296+72
+ADDP4
+ADDRGP4 color_black
+ASGNP4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_callVoteMenu+296+80
+ADDP4
+ADDRGP4 colorMOver
+ASGNP4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_callVoteMenu+296+68
+ADDP4
+CNSTI4 16
+ASGNI4
+LABELV $439
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+LABELV $441
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $438
+ADDRLP4 4
+CNSTI4 270
+ASGNI4
+ADDRGP4 s_callVoteMenu+1592
+CNSTI4 12
+ASGNI4
+ADDRGP4 s_callVoteMenu+1592+76
+CNSTF4 1107296256
+ASGNF4
+ADDRGP4 s_callVoteMenu+1592+48
+CNSTU4 4
+ASGNU4
+ADDRGP4 s_callVoteMenu+1592+52
+ADDRGP4 UI_CallVote_Vote
+ASGNP4
+ADDRGP4 s_callVoteMenu+1592+12
+CNSTI4 15
+ASGNI4
+ADDRGP4 s_callVoteMenu+1592+16
+CNSTI4 230
+ASGNI4
+ADDRGP4 s_callVoteMenu+1592+20
+CNSTI4 250
+ASGNI4
+ADDRGP4 s_callVoteMenu+1592+64
+ADDRGP4 $479
+ASGNP4
+ADDRGP4 s_callVoteMenu+1592+68
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_callVoteMenu+1592+72
+ADDRGP4 color_black
+ASGNP4
+ADDRGP4 s_callVoteMenu+1592+80
+ADDRGP4 color_orange
+ASGNP4
+ADDRGP4 s_callVoteMenu+1676
+CNSTI4 12
+ASGNI4
+ADDRGP4 s_callVoteMenu+1676+76
+CNSTF4 1107296256
+ASGNF4
+ADDRGP4 s_callVoteMenu+1676+48
+CNSTU4 16
+ASGNU4
+ADDRGP4 s_callVoteMenu+1676+52
+ADDRGP4 UI_CallVote_Vote
+ASGNP4
+ADDRGP4 s_callVoteMenu+1676+12
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_callVoteMenu+1676+16
+CNSTI4 360
+ASGNI4
+ADDRGP4 s_callVoteMenu+1676+20
+CNSTI4 250
+ASGNI4
+ADDRGP4 s_callVoteMenu+1676+64
+ADDRGP4 $501
+ASGNP4
+ADDRGP4 s_callVoteMenu+1676+68
+CNSTI4 18
+ASGNI4
+ADDRGP4 s_callVoteMenu+1676+72
+ADDRGP4 color_black
+ASGNP4
+ADDRGP4 s_callVoteMenu+1676+80
+ADDRGP4 color_orange
+ASGNP4
+ADDRLP4 4
+CNSTI4 300
+ASGNI4
+ADDRGP4 s_callVoteMenu+1424
+CNSTI4 12
+ASGNI4
+ADDRGP4 s_callVoteMenu+1424+76
+CNSTF4 1103101952
+ASGNF4
+ADDRGP4 s_callVoteMenu+1424+48
+CNSTU4 16
+ASGNU4
+ADDRGP4 s_callVoteMenu+1424+52
+ADDRGP4 UI_CallVote_GoEvent
+ASGNP4
+ADDRGP4 s_callVoteMenu+1424+12
+CNSTI4 11
+ASGNI4
+ADDRGP4 s_callVoteMenu+1424+16
+CNSTI4 360
+ASGNI4
+ADDRGP4 s_callVoteMenu+1424+20
+CNSTI4 336
+ASGNI4
+ADDRGP4 s_callVoteMenu+1424+64
+ADDRGP4 $523
+ASGNP4
+ADDRGP4 s_callVoteMenu+1424+68
+CNSTI4 18
+ASGNI4
+ADDRGP4 s_callVoteMenu+1424+72
+ADDRGP4 color_black
+ASGNP4
+ADDRGP4 s_callVoteMenu+1424+80
+ADDRGP4 color_orange
+ASGNP4
+ADDRGP4 s_callVoteMenu+1508
+CNSTI4 12
+ASGNI4
+ADDRGP4 s_callVoteMenu+1508+76
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 s_callVoteMenu+1508+52
+ADDRGP4 UI_CallVote_BackEvent
+ASGNP4
+ADDRGP4 s_callVoteMenu+1508+12
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_callVoteMenu+1508+16
+CNSTI4 230
+ASGNI4
+ADDRGP4 s_callVoteMenu+1508+20
+CNSTI4 340
+ASGNI4
+ADDRGP4 s_callVoteMenu+1508+64
+ADDRGP4 $543
+ASGNP4
+ADDRGP4 s_callVoteMenu+1508+68
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_callVoteMenu+1508+72
+ADDRGP4 color_black
+ASGNP4
+ADDRGP4 s_callVoteMenu+1508+80
+ADDRGP4 color_orange
+ASGNP4
+ADDRGP4 s_callVoteMenu
+ARGP4
+ADDRGP4 s_callVoteMenu+968
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_callVoteMenu
+ARGP4
+ADDRGP4 s_callVoteMenu+1760
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_callVoteMenu
+ARGP4
+ADDRGP4 s_callVoteMenu+1868
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_callVoteMenu
+ARGP4
+ADDRGP4 s_callVoteMenu+1088
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $554
+ADDRGP4 s_callVoteMenu
+ARGP4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_callVoteMenu+296
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRLP4 1052
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+ADDRGP4 s_callVoteMenu+296+32
+ADDP4
+ADDRLP4 1052
+INDIRI4
+ADDRGP4 s_callVoteMenu+296+24
+ADDP4
+INDIRI4
+CNSTI4 160
+ADDI4
+ASGNI4
+LABELV $555
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $554
+ADDRGP4 s_callVoteMenu
+ARGP4
+ADDRGP4 s_callVoteMenu+1592
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_callVoteMenu
+ARGP4
+ADDRGP4 s_callVoteMenu+1676
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_callVoteMenu
+ARGP4
+ADDRGP4 s_callVoteMenu+1424
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_callVoteMenu
+ARGP4
+ADDRGP4 s_callVoteMenu+1508
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 UI_CallVote_UpdatePassiveButtons
+CALLV
+pop
+LABELV $359
+endproc UI_CallVoteMenu_Init 1056 12
+proc UI_CallVote_Cache 0 4
+ADDRGP4 $411
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $414
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $430
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $433
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $567
+endproc UI_CallVote_Cache 0 4
+export UI_CallVoteMenu
+proc UI_CallVoteMenu 0 4
+ADDRGP4 UI_CallVoteMenu_Init
+CALLV
+pop
+ADDRGP4 s_callVoteMenu
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $568
+endproc UI_CallVoteMenu 0 4
+bss
+align 4
+LABELV s_callVoteMenu
+skip 2000
+align 1
+LABELV ArrayForListStrs
+skip 8192
+import UI_HelpMenu_Cache
+import UI_HelpMenu_f
+import UI_HelpMenu
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import UI_InitGameinfo
+import UI_GetNumBots
+import UI_GetBotInfoByNumber
+import UI_GetNumArenas
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_VoiceIngame
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_GetVoiceGainClient
+import trap_GetVoiceMuteAll
+import trap_GetVoiceMuteClient
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_CIN_SetExtents
+import trap_CIN_StopCinematic
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_PlayCinematic
+import trap_RealTime
+import trap_S_StartBackgroundTrack
+import trap_S_StopBackgroundTrack
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_SaveCachedServers
+import trap_LAN_LoadCachedServers
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import BotListCompare
+import uis
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString2
+import UI_AutoWrappedString_LineCount
+import UI_DrawString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawIngameBG
+import UI_DrawStringNS
+import UI_ModelIcon
+import UI_DrawHandlePic1024
+import UI_AdjustFrom1024
+import UI_StopMusic
+import UI_StartCreditMusic
+import UI_StartMusic
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_ClearModelCache
+import UI_PrecacheClientModelname
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import UI_SpecifyPasswordMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import Demos_Cache
+import UI_DemosMenu
+import SetDefaultBinds_onUnusedKeys
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import SetupDefaultMenu_Cache
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import Music_NextTrack
+import Music_TriggerRestart
+import Music_Check
+import MusicMenu_Cache
+import MusicMenu_Open
+import MusicMenu_Shutdown
+import MusicMenu_Init
+import UI_InGameMenu
+import InGame_Cache
+import UI_SecretMenu
+import UI_InitBigCredits
+import UI_BigCredits_Cache
+import UI_CreditMenu
+import ExitMenu_Cache
+import ExitMenu_Init
+import UI_MainMenu
+import MainMenu_Cache
+import UI_UpdateCvars
+import UI_RegisterCvars
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import listbar_bluecolor
+import text_color_bluehighlight
+import text_color_bluenormal
+import text_color_ighighlight
+import text_color_ignormal
+import listbar_igcolor
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_lightOrange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_click_sound
+import menu_switch_sound
+import menu_move_sound
+import ScrollList_Key
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import wop_AutoBindUnusedKeys
+import wop_AutoswitchSongByNextMap
+import con_notifytime
+import s_wop_restarted
+import syc_logo
+import spraycolor
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_createGametype
+import ui_browserHidePrivate
+import ui_browserOnlyHumans
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $543
+byte 1 66
+byte 1 65
+byte 1 67
+byte 1 75
+byte 1 0
+align 1
+LABELV $523
+byte 1 71
+byte 1 79
+byte 1 33
+byte 1 0
+align 1
+LABELV $501
+byte 1 78
+byte 1 79
+byte 1 0
+align 1
+LABELV $479
+byte 1 89
+byte 1 69
+byte 1 83
+byte 1 0
+align 1
+LABELV $457
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $433
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 49
+byte 1 0
+align 1
+LABELV $430
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 48
+byte 1 0
+align 1
+LABELV $414
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 117
+byte 1 112
+byte 1 49
+byte 1 0
+align 1
+LABELV $411
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 117
+byte 1 112
+byte 1 48
+byte 1 0
+align 1
+LABELV $385
+byte 1 86
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $373
+byte 1 0
+align 1
+LABELV $342
+byte 1 110
+byte 1 0
+align 1
+LABELV $337
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $334
+byte 1 46
+byte 1 98
+byte 1 115
+byte 1 112
+byte 1 0
+align 1
+LABELV $333
+byte 1 98
+byte 1 115
+byte 1 112
+byte 1 0
+align 1
+LABELV $332
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $286
+byte 1 66
+byte 1 105
+byte 1 103
+byte 1 32
+byte 1 66
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $285
+byte 1 83
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $284
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 84
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 76
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $283
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $282
+byte 1 76
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 80
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $281
+byte 1 83
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $280
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $253
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $239
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 98
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 58
+byte 1 0
+align 1
+LABELV $238
+byte 1 76
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 37
+byte 1 50
+byte 1 46
+byte 1 50
+byte 1 100
+byte 1 0
+align 1
+LABELV $237
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $230
+byte 1 67
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 32
+byte 1 86
+byte 1 79
+byte 1 84
+byte 1 69
+byte 1 0
+align 1
+LABELV $152
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $151
+byte 1 48
+byte 1 0
+align 1
+LABELV $150
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $144
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $143
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $136
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $113
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $94
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 0
+align 1
+LABELV $92
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $83
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $82
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $81
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $80
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $79
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $78
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $77
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
@@ -0,0 +1,1065 @@
+code
+proc ConfirmMenu_Event 4 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $79
+ADDRGP4 $78
+JUMPV
+LABELV $79
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $81
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $82
+JUMPV
+LABELV $81
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $82
+ADDRGP4 s_confirm+584
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $83
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 s_confirm+584
+INDIRP4
+CALLV
+pop
+LABELV $83
+LABELV $78
+endproc ConfirmMenu_Event 4 4
+proc ConfirmMenu_Key 32 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 110
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $91
+ADDRFP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GTI4 $96
+LABELV $95
+ADDRLP4 12
+CNSTI4 78
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $91
+ADDRFP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $88
+LABELV $97
+ADDRFP4 0
+INDIRI4
+CNSTI4 89
+EQI4 $93
+ADDRGP4 $88
+JUMPV
+LABELV $96
+ADDRFP4 0
+INDIRI4
+CNSTI4 134
+EQI4 $90
+ADDRLP4 20
+CNSTI4 135
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $90
+ADDRFP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+GTI4 $99
+LABELV $98
+ADDRFP4 0
+INDIRI4
+CNSTI4 121
+EQI4 $93
+ADDRGP4 $88
+JUMPV
+LABELV $99
+ADDRFP4 0
+INDIRI4
+CNSTI4 163
+EQI4 $90
+ADDRFP4 0
+INDIRI4
+CNSTI4 165
+EQI4 $90
+ADDRGP4 $88
+JUMPV
+LABELV $90
+ADDRFP4 0
+CNSTI4 9
+ASGNI4
+ADDRGP4 $89
+JUMPV
+LABELV $91
+ADDRGP4 s_confirm+392
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 ConfirmMenu_Event
+CALLV
+pop
+ADDRGP4 $89
+JUMPV
+LABELV $93
+ADDRGP4 s_confirm+296
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 ConfirmMenu_Event
+CALLV
+pop
+LABELV $88
+LABELV $89
+ADDRGP4 s_confirm
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 Menu_DefaultKey
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+RETI4
+LABELV $87
+endproc ConfirmMenu_Key 32 8
+proc ConfirmMenu_Draw 0 24
+ADDRGP4 UI_DrawIngameBG
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 204
+ARGI4
+ADDRGP4 s_confirm+576
+INDIRP4
+ARGP4
+ADDRGP4 s_confirm+588
+INDIRI4
+ARGI4
+CNSTF4 1103101952
+ARGF4
+ADDRGP4 color_black
+ARGP4
+ADDRGP4 UI_DrawStringNS
+CALLV
+pop
+ADDRGP4 s_confirm
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+ADDRGP4 s_confirm+580
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $103
+ADDRGP4 s_confirm+580
+INDIRP4
+CALLV
+pop
+LABELV $103
+LABELV $100
+endproc ConfirmMenu_Draw 0 24
+export ConfirmMenu_Cache
+proc ConfirmMenu_Cache 0 4
+ADDRGP4 $108
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $107
+endproc ConfirmMenu_Cache 0 4
+proc UI_ConfirmMenu_Style 3124 12
+ADDRGP4 s_confirm
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 596
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 ConfirmMenu_Cache
+CALLV
+pop
+ADDRGP4 $110
+ARGP4
+ADDRLP4 3108
+ADDRGP4 UI_ProportionalStringWidth
+CALLI4
+ASGNI4
+ADDRLP4 3092
+ADDRLP4 3108
+INDIRI4
+ASGNI4
+ADDRGP4 $111
+ARGP4
+ADDRLP4 3112
+ADDRGP4 UI_ProportionalStringWidth
+CALLI4
+ASGNI4
+ADDRLP4 3096
+ADDRLP4 3112
+INDIRI4
+CNSTI4 3
+ADDI4
+ASGNI4
+ADDRGP4 $112
+ARGP4
+ADDRLP4 3116
+ADDRGP4 UI_ProportionalStringWidth
+CALLI4
+ASGNI4
+ADDRLP4 3100
+ADDRLP4 3116
+INDIRI4
+CNSTI4 3
+ADDI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 320
+ADDRLP4 3092
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 3096
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 3104
+ADDRLP4 4
+INDIRI4
+ADDRLP4 3100
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 s_confirm+572
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_confirm+576
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 s_confirm+580
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 s_confirm+584
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRGP4 s_confirm+588
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_confirm+268
+ADDRGP4 ConfirmMenu_Draw
+ASGNP4
+ADDRGP4 s_confirm+272
+ADDRGP4 ConfirmMenu_Key
+ASGNP4
+ADDRGP4 s_confirm+276
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_GetClientState
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CNSTI4 5
+LTI4 $121
+ADDRGP4 s_confirm+280
+CNSTI4 0
+ASGNI4
+ADDRGP4 $122
+JUMPV
+LABELV $121
+ADDRGP4 s_confirm+280
+CNSTI4 1
+ASGNI4
+LABELV $122
+ADDRGP4 s_confirm+296
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_confirm+296+4
+ADDRGP4 $128
+ASGNP4
+ADDRGP4 s_confirm+296+48
+CNSTU4 132
+ASGNU4
+ADDRGP4 s_confirm+296+52
+ADDRGP4 ConfirmMenu_Event
+ASGNP4
+ADDRGP4 s_confirm+296+12
+CNSTI4 11
+ASGNI4
+ADDRGP4 s_confirm+296+16
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+ADDI4
+ASGNI4
+ADDRGP4 s_confirm+296+20
+CNSTI4 264
+ASGNI4
+ADDRGP4 s_confirm+296+80
+CNSTI4 43
+ASGNI4
+ADDRGP4 s_confirm+296+84
+CNSTI4 30
+ASGNI4
+ADDRGP4 s_confirm+296+64
+ADDRGP4 $145
+ASGNP4
+ADDRGP4 s_confirm+296+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_confirm+392
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_confirm+392+4
+ADDRGP4 $151
+ASGNP4
+ADDRGP4 s_confirm+392+48
+CNSTU4 132
+ASGNU4
+ADDRGP4 s_confirm+392+52
+ADDRGP4 ConfirmMenu_Event
+ASGNP4
+ADDRGP4 s_confirm+392+12
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_confirm+392+16
+ADDRLP4 3104
+INDIRI4
+ASGNI4
+ADDRGP4 s_confirm+392+20
+CNSTI4 264
+ASGNI4
+ADDRGP4 s_confirm+392+80
+CNSTI4 33
+ASGNI4
+ADDRGP4 s_confirm+392+84
+CNSTI4 30
+ASGNI4
+ADDRGP4 s_confirm+392+64
+ADDRGP4 $168
+ASGNP4
+ADDRGP4 s_confirm+392+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_confirm
+ARGP4
+ADDRGP4 s_confirm+296
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_confirm
+ARGP4
+ADDRGP4 s_confirm+392
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_confirm
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+ADDRGP4 s_confirm
+ARGP4
+ADDRGP4 s_confirm+392
+ARGP4
+ADDRGP4 Menu_SetCursorToItem
+CALLV
+pop
+LABELV $109
+endproc UI_ConfirmMenu_Style 3124 12
+export UI_ConfirmMenu
+proc UI_ConfirmMenu 0 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 8193
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 UI_ConfirmMenu_Style
+CALLV
+pop
+LABELV $174
+endproc UI_ConfirmMenu 0 16
+bss
+align 4
+LABELV s_confirm
+skip 596
+import UI_HelpMenu_Cache
+import UI_HelpMenu_f
+import UI_HelpMenu
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import UI_InitGameinfo
+import UI_GetNumBots
+import UI_GetBotInfoByNumber
+import UI_GetNumArenas
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_VoiceIngame
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_GetVoiceGainClient
+import trap_GetVoiceMuteAll
+import trap_GetVoiceMuteClient
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_CIN_SetExtents
+import trap_CIN_StopCinematic
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_PlayCinematic
+import trap_RealTime
+import trap_S_StartBackgroundTrack
+import trap_S_StopBackgroundTrack
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_SaveCachedServers
+import trap_LAN_LoadCachedServers
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import BotListCompare
+import uis
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString2
+import UI_AutoWrappedString_LineCount
+import UI_DrawString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawIngameBG
+import UI_DrawStringNS
+import UI_ModelIcon
+import UI_DrawHandlePic1024
+import UI_AdjustFrom1024
+import UI_StopMusic
+import UI_StartCreditMusic
+import UI_StartMusic
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_ClearModelCache
+import UI_PrecacheClientModelname
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import UI_SpecifyPasswordMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import Demos_Cache
+import UI_DemosMenu
+import SetDefaultBinds_onUnusedKeys
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import SetupDefaultMenu_Cache
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import Music_NextTrack
+import Music_TriggerRestart
+import Music_Check
+import MusicMenu_Cache
+import MusicMenu_Open
+import MusicMenu_Shutdown
+import MusicMenu_Init
+import UI_CallVoteMenu
+import UI_InGameMenu
+import InGame_Cache
+import UI_SecretMenu
+import UI_InitBigCredits
+import UI_BigCredits_Cache
+import UI_CreditMenu
+import ExitMenu_Cache
+import ExitMenu_Init
+import UI_MainMenu
+import MainMenu_Cache
+import UI_UpdateCvars
+import UI_RegisterCvars
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import listbar_bluecolor
+import text_color_bluehighlight
+import text_color_bluenormal
+import text_color_ighighlight
+import text_color_ignormal
+import listbar_igcolor
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_lightOrange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_click_sound
+import menu_switch_sound
+import menu_move_sound
+import ScrollList_Key
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import wop_AutoBindUnusedKeys
+import wop_AutoswitchSongByNextMap
+import con_notifytime
+import s_wop_restarted
+import syc_logo
+import spraycolor
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_createGametype
+import ui_browserHidePrivate
+import ui_browserOnlyHumans
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $168
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 101
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 47
+byte 1 110
+byte 1 111
+byte 1 49
+byte 1 0
+align 1
+LABELV $151
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 101
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 47
+byte 1 110
+byte 1 111
+byte 1 48
+byte 1 0
+align 1
+LABELV $145
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 101
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 47
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 49
+byte 1 0
+align 1
+LABELV $128
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 101
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 47
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 48
+byte 1 0
+align 1
+LABELV $112
+byte 1 47
+byte 1 0
+align 1
+LABELV $111
+byte 1 89
+byte 1 69
+byte 1 83
+byte 1 0
+align 1
+LABELV $110
+byte 1 89
+byte 1 69
+byte 1 83
+byte 1 47
+byte 1 78
+byte 1 79
+byte 1 0
+align 1
+LABELV $108
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 99
+byte 1 117
+byte 1 116
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
@@ -0,0 +1,7729 @@
+data
+align 4
+LABELV controls_binding_color
+byte 4 1065353216
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+align 4
+LABELV g_bindings
+address $80
+address $81
+byte 4 0
+byte 4 0
+byte 4 9
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $82
+address $83
+byte 4 1
+byte 4 0
+byte 4 13
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $84
+address $85
+byte 4 2
+byte 4 1
+byte 4 138
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $86
+address $87
+byte 4 3
+byte 4 2
+byte 4 132
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $88
+address $89
+byte 4 4
+byte 4 3
+byte 4 133
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $90
+address $91
+byte 4 5
+byte 4 6
+byte 4 44
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $92
+address $93
+byte 4 6
+byte 4 7
+byte 4 46
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $94
+address $95
+byte 4 7
+byte 4 4
+byte 4 32
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $96
+address $97
+byte 4 8
+byte 4 5
+byte 4 99
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $98
+address $99
+byte 4 9
+byte 4 12
+byte 4 49
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $100
+address $101
+byte 4 10
+byte 4 13
+byte 4 50
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $102
+address $103
+byte 4 11
+byte 4 14
+byte 4 51
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $104
+address $105
+byte 4 12
+byte 4 15
+byte 4 52
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $106
+address $107
+byte 4 13
+byte 4 16
+byte 4 53
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $108
+address $109
+byte 4 14
+byte 4 17
+byte 4 54
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $110
+address $111
+byte 4 15
+byte 4 18
+byte 4 55
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $112
+address $113
+byte 4 16
+byte 4 19
+byte 4 56
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $114
+address $115
+byte 4 17
+byte 4 20
+byte 4 57
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $116
+address $117
+byte 4 18
+byte 4 22
+byte 4 137
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $118
+address $119
+byte 4 19
+byte 4 0
+byte 4 91
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $120
+address $121
+byte 4 20
+byte 4 0
+byte 4 93
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $122
+address $123
+byte 4 21
+byte 4 23
+byte 4 180
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $124
+address $125
+byte 4 22
+byte 4 25
+byte 4 116
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $126
+address $127
+byte 4 23
+byte 4 25
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $128
+address $128
+byte 4 24
+byte 4 0
+byte 4 43
+byte 4 174
+byte 4 -1
+byte 4 -1
+address $129
+address $129
+byte 4 25
+byte 4 0
+byte 4 45
+byte 4 173
+byte 4 -1
+byte 4 -1
+address $130
+address $131
+byte 4 26
+byte 4 0
+byte 4 109
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $132
+address $133
+byte 4 27
+byte 4 0
+byte 4 110
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $134
+address $135
+byte 4 28
+byte 4 0
+byte 4 127
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $136
+address $137
+byte 4 29
+byte 4 0
+byte 4 107
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $138
+address $139
+byte 4 30
+byte 4 0
+byte 4 117
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $140
+address $141
+byte 4 31
+byte 4 0
+byte 4 103
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $142
+address $143
+byte 4 32
+byte 4 0
+byte 4 104
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $144
+address $145
+byte 4 33
+byte 4 0
+byte 4 114
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $146
+address $147
+byte 4 34
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+align 4
+LABELV g_configcvars
+address $148
+byte 4 0
+byte 4 0
+address $149
+byte 4 0
+byte 4 0
+address $150
+byte 4 0
+byte 4 0
+address $151
+byte 4 0
+byte 4 0
+address $152
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+align 4
+LABELV g_movement_controls
+address s_controls+1064
+address s_controls+680
+address s_controls+744
+address s_controls+808
+address s_controls+872
+address s_controls+936
+address s_controls+1000
+address s_controls+2372
+address s_controls+1896
+byte 4 0
+align 4
+LABELV g_weapons_controls
+address s_controls+1704
+address s_controls+1832
+address s_controls+1768
+address s_controls+2240
+address s_controls+1192
+address s_controls+1128
+address s_controls+1256
+address s_controls+1320
+address s_controls+1384
+address s_controls+1448
+address s_controls+1512
+address s_controls+1576
+address s_controls+1640
+byte 4 0
+align 4
+LABELV g_looking_controls
+address s_controls+2028
+address s_controls+2108
+address s_controls+1960
+address s_controls+2176
+byte 4 0
+align 4
+LABELV g_misc_controls
+address s_controls+2308
+address s_controls+3692
+address s_controls+3756
+address s_controls+3820
+address s_controls+3884
+address s_controls+3948
+address s_controls+4012
+address s_controls+4076
+address s_controls+4140
+address s_controls+4204
+address s_controls+4332
+address s_controls+4396
+address s_controls+4268
+byte 4 0
+align 4
+LABELV g_controls
+address g_movement_controls
+address g_looking_controls
+address g_weapons_controls
+address g_misc_controls
+code
+proc Controls_InitCvars 28 8
+ADDRLP4 0
+ADDRGP4 g_configcvars
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $193
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $197
+ADDRGP4 $195
+JUMPV
+LABELV $197
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Reset
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $194
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRGP4 $193
+JUMPV
+LABELV $195
+LABELV $192
+endproc Controls_InitCvars 28 8
+proc Controls_GetCvarDefault 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 g_configcvars
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $200
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $204
+CNSTF4 0
+RETF4
+ADDRGP4 $199
+JUMPV
+LABELV $204
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $206
+ADDRGP4 $202
+JUMPV
+LABELV $206
+LABELV $201
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRGP4 $200
+JUMPV
+LABELV $202
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+RETF4
+LABELV $199
+endproc Controls_GetCvarDefault 12 8
+proc Controls_GetCvarValue 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 g_configcvars
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $209
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $213
+CNSTF4 0
+RETF4
+ADDRGP4 $208
+JUMPV
+LABELV $213
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $215
+ADDRGP4 $211
+JUMPV
+LABELV $215
+LABELV $210
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRGP4 $209
+JUMPV
+LABELV $211
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+RETF4
+LABELV $208
+endproc Controls_GetCvarValue 12 8
+proc Controls_UpdateModel 20 28
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRGP4 s_controls+4532+8
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 s_controls+4532+4
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 s_controls+4532
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRGP4 s_controls+4544+8
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 s_controls+4544+4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 s_controls+4544
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 s_controls+4532+4
+CNSTF4 1125515264
+ASGNF4
+ADDRGP4 s_controls+4544+4
+ADDRGP4 s_controls+4532+4
+INDIRF4
+ASGNF4
+ADDRGP4 s_controls+4556
+CNSTI4 22
+ASGNI4
+ADDRGP4 s_controls+4560
+CNSTI4 11
+ASGNI4
+ADDRGP4 s_controls+4564
+CNSTI4 -1
+ASGNI4
+ADDRGP4 s_controls+4568
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+LTI4 $239
+ADDRLP4 8
+INDIRI4
+CNSTI4 25
+GTI4 $239
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $302-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $302
+address $240
+address $242
+address $244
+address $246
+address $248
+address $256
+address $262
+address $250
+address $253
+address $268
+address $270
+address $272
+address $274
+address $276
+address $278
+address $280
+address $282
+address $284
+address $286
+address $288
+address $290
+address $292
+address $294
+address $296
+address $300
+code
+LABELV $240
+ADDRGP4 s_controls+4556
+CNSTI4 15
+ASGNI4
+ADDRGP4 $239
+JUMPV
+LABELV $242
+ADDRGP4 s_controls+4556
+CNSTI4 14
+ASGNI4
+ADDRGP4 $239
+JUMPV
+LABELV $244
+ADDRGP4 s_controls+4556
+CNSTI4 16
+ASGNI4
+ADDRGP4 $239
+JUMPV
+LABELV $246
+ADDRGP4 s_controls+4556
+CNSTI4 18
+ASGNI4
+ADDRGP4 $239
+JUMPV
+LABELV $248
+ADDRGP4 s_controls+4556
+CNSTI4 23
+ASGNI4
+ADDRGP4 $239
+JUMPV
+LABELV $250
+ADDRLP4 12
+ADDRGP4 s_controls+4532+4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+CNSTF4 1119092736
+ADDF4
+ASGNF4
+ADDRGP4 $239
+JUMPV
+LABELV $253
+ADDRLP4 16
+ADDRGP4 s_controls+4532+4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CNSTF4 1119092736
+SUBF4
+ASGNF4
+ADDRGP4 $239
+JUMPV
+LABELV $256
+ADDRGP4 s_controls+4556
+CNSTI4 14
+ASGNI4
+ADDRGP4 s_controls+4544+4
+ADDRGP4 s_controls+4532+4
+INDIRF4
+CNSTF4 1119092736
+ADDF4
+ASGNF4
+ADDRGP4 $239
+JUMPV
+LABELV $262
+ADDRGP4 s_controls+4556
+CNSTI4 14
+ASGNI4
+ADDRGP4 s_controls+4544+4
+ADDRGP4 s_controls+4532+4
+INDIRF4
+CNSTF4 1119092736
+SUBF4
+ASGNF4
+ADDRGP4 $239
+JUMPV
+LABELV $268
+ADDRGP4 s_controls+4532
+CNSTF4 3258187776
+ASGNF4
+ADDRGP4 $239
+JUMPV
+LABELV $270
+ADDRGP4 s_controls+4532
+CNSTF4 1110704128
+ASGNF4
+ADDRGP4 $239
+JUMPV
+LABELV $272
+ADDRGP4 s_controls+4564
+CNSTI4 1
+ASGNI4
+ADDRGP4 $239
+JUMPV
+LABELV $274
+ADDRGP4 s_controls+4564
+CNSTI4 2
+ASGNI4
+ADDRGP4 $239
+JUMPV
+LABELV $276
+ADDRGP4 s_controls+4564
+CNSTI4 3
+ASGNI4
+ADDRGP4 $239
+JUMPV
+LABELV $278
+ADDRGP4 s_controls+4564
+CNSTI4 4
+ASGNI4
+ADDRGP4 $239
+JUMPV
+LABELV $280
+ADDRGP4 s_controls+4564
+CNSTI4 5
+ASGNI4
+ADDRGP4 $239
+JUMPV
+LABELV $282
+ADDRGP4 s_controls+4564
+CNSTI4 6
+ASGNI4
+ADDRGP4 $239
+JUMPV
+LABELV $284
+ADDRGP4 s_controls+4564
+CNSTI4 7
+ASGNI4
+ADDRGP4 $239
+JUMPV
+LABELV $286
+ADDRGP4 s_controls+4564
+CNSTI4 8
+ASGNI4
+ADDRGP4 $239
+JUMPV
+LABELV $288
+ADDRGP4 s_controls+4564
+CNSTI4 9
+ASGNI4
+ADDRGP4 $239
+JUMPV
+LABELV $290
+ADDRGP4 s_controls+4564
+CNSTI4 11
+ASGNI4
+ADDRGP4 $239
+JUMPV
+LABELV $292
+ADDRGP4 s_controls+4560
+CNSTI4 7
+ASGNI4
+ADDRGP4 $239
+JUMPV
+LABELV $294
+ADDRGP4 s_controls+4560
+CNSTI4 6
+ASGNI4
+ADDRGP4 $239
+JUMPV
+LABELV $296
+ADDRGP4 s_controls+4556
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_controls+4560
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_controls+4564
+CNSTI4 0
+ASGNI4
+ADDRGP4 $239
+JUMPV
+LABELV $300
+ADDRGP4 s_controls+4568
+CNSTI4 1
+ASGNI4
+LABELV $239
+ADDRGP4 s_controls+2436
+ARGP4
+ADDRGP4 s_controls+4556
+INDIRI4
+ARGI4
+ADDRGP4 s_controls+4560
+INDIRI4
+ARGI4
+ADDRGP4 s_controls+4532
+ARGP4
+ADDRGP4 s_controls+4544
+ARGP4
+ADDRGP4 s_controls+4564
+INDIRI4
+ARGI4
+ADDRGP4 s_controls+4568
+INDIRI4
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetInfo
+CALLV
+pop
+LABELV $217
+endproc Controls_UpdateModel 20 28
+proc Controls_Update 80 4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $312
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_controls
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $319
+JUMPV
+LABELV $316
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+LABELV $317
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $319
+ADDRLP4 20
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $316
+LABELV $313
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+LTI4 $312
+ADDRLP4 8
+ADDRGP4 s_controls+4460
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_controls
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $324
+JUMPV
+LABELV $321
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRU4
+CNSTU4 4294938623
+BANDU4
+ASGNU4
+LABELV $322
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $324
+ADDRLP4 20
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $321
+ADDRLP4 16
+CNSTI4 180
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $328
+JUMPV
+LABELV $325
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 492
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 348
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 668
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+LABELV $326
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+LABELV $328
+ADDRLP4 24
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $325
+ADDRGP4 s_controls+4464
+INDIRI4
+CNSTI4 0
+EQI4 $329
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $335
+JUMPV
+LABELV $332
+ADDRLP4 28
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_controls+12
+ADDP4
+INDIRP4
+CNSTI4 48
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+LABELV $333
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $335
+ADDRLP4 12
+INDIRI4
+ADDRGP4 s_controls+8
+INDIRI4
+LTI4 $332
+ADDRLP4 28
+ADDRGP4 s_controls
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_controls+12
+ADDP4
+INDIRP4
+CNSTI4 48
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 32
+ADDRGP4 s_controls+4668+48
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRGP4 $311
+JUMPV
+LABELV $329
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $344
+JUMPV
+LABELV $341
+ADDRLP4 28
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_controls+12
+ADDP4
+INDIRP4
+CNSTI4 48
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+LABELV $342
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $344
+ADDRLP4 12
+INDIRI4
+ADDRGP4 s_controls+8
+INDIRI4
+LTI4 $341
+ADDRLP4 28
+ADDRGP4 s_controls+392+48
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 4294958911
+BANDU4
+ASGNU4
+ADDRLP4 32
+ADDRGP4 s_controls+296+48
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 4294958911
+BANDU4
+ASGNU4
+ADDRLP4 36
+ADDRGP4 s_controls+488+48
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 4294958911
+BANDU4
+ASGNU4
+ADDRLP4 40
+ADDRGP4 s_controls+584+48
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRU4
+CNSTU4 4294958911
+BANDU4
+ASGNU4
+ADDRLP4 44
+ADDRGP4 s_controls+392+48
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRU4
+CNSTU4 128
+BORU4
+ASGNU4
+ADDRLP4 48
+ADDRGP4 s_controls+296+48
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRU4
+CNSTU4 128
+BORU4
+ASGNU4
+ADDRLP4 52
+ADDRGP4 s_controls+488+48
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRU4
+CNSTU4 128
+BORU4
+ASGNU4
+ADDRLP4 56
+ADDRGP4 s_controls+584+48
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRU4
+CNSTU4 128
+BORU4
+ASGNU4
+ADDRLP4 60
+ADDRGP4 s_controls+4460
+INDIRI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+LTI4 $363
+ADDRLP4 60
+INDIRI4
+CNSTI4 3
+GTI4 $363
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $378
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $378
+address $366
+address $369
+address $372
+address $375
+code
+LABELV $366
+ADDRLP4 64
+ADDRGP4 s_controls+296+48
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRU4
+CNSTU4 64
+BORU4
+ASGNU4
+ADDRGP4 $364
+JUMPV
+LABELV $369
+ADDRLP4 68
+ADDRGP4 s_controls+392+48
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRU4
+CNSTU4 64
+BORU4
+ASGNU4
+ADDRGP4 $364
+JUMPV
+LABELV $372
+ADDRLP4 72
+ADDRGP4 s_controls+488+48
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRU4
+CNSTU4 64
+BORU4
+ASGNU4
+ADDRGP4 $364
+JUMPV
+LABELV $375
+ADDRLP4 76
+ADDRGP4 s_controls+584+48
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRU4
+CNSTU4 64
+BORU4
+ASGNU4
+LABELV $363
+LABELV $364
+ADDRGP4 $381
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 64
+INDIRF4
+CVFI4 4
+CNSTI4 0
+EQI4 $383
+ADDRGP4 $382
+ARGP4
+ADDRLP4 68
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 68
+INDIRF4
+CVFI4 4
+CNSTI4 1
+NEI4 $379
+LABELV $383
+ADDRLP4 72
+ADDRGP4 s_controls+4268+48
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+LABELV $379
+LABELV $311
+endproc Controls_Update 80 4
+proc Controls_DrawKeyBinding 116 20
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 96
+INDIRP4
+CVPU4 4
+NEU4 $388
+ADDRLP4 88
+CNSTI4 1
+ASGNI4
+ADDRGP4 $389
+JUMPV
+LABELV $388
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+LABELV $389
+ADDRLP4 48
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 g_bindings+24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 -1
+NEI4 $391
+ADDRLP4 4
+ARGP4
+ADDRGP4 $393
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $392
+JUMPV
+LABELV $391
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_Key_KeynumToStringBuf
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 g_bindings+28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 -1
+EQI4 $395
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 56
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_Key_KeynumToStringBuf
+CALLV
+pop
+ADDRLP4 56
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $397
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $395
+LABELV $392
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $398
+ADDRLP4 104
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 108
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 112
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+SUBI4
+ADDRLP4 112
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRLP4 108
+INDIRI4
+SUBI4
+ADDRLP4 112
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 listbar_color
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRLP4 36
+INDIRI4
+CNSTI4 8
+SUBI4
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 g_bindings+4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 18
+ARGI4
+ADDRGP4 text_color_highlight
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 36
+INDIRI4
+CNSTI4 8
+ADDI4
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 16400
+ARGI4
+ADDRGP4 text_color_highlight
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRGP4 s_controls+4464
+INDIRI4
+CNSTI4 0
+EQI4 $401
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+CNSTI4 61
+ARGI4
+CNSTI4 4113
+ARGI4
+ADDRGP4 text_color_highlight
+ARGP4
+ADDRGP4 UI_DrawChar
+CALLV
+pop
+CNSTI4 500
+ARGI4
+CNSTI4 408
+ARGI4
+ADDRGP4 $404
+ARGP4
+CNSTI4 16401
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRGP4 $399
+JUMPV
+LABELV $401
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+CNSTI4 13
+ARGI4
+CNSTI4 4113
+ARGI4
+ADDRGP4 text_color_highlight
+ARGP4
+ADDRGP4 UI_DrawChar
+CALLV
+pop
+CNSTI4 500
+ARGI4
+CNSTI4 398
+ARGI4
+ADDRGP4 $405
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 500
+ARGI4
+CNSTI4 417
+ARGI4
+ADDRGP4 $406
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRGP4 $399
+JUMPV
+LABELV $398
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 8192
+BANDU4
+CNSTU4 0
+EQU4 $407
+ADDRLP4 36
+INDIRI4
+CNSTI4 8
+SUBI4
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 g_bindings+4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 18
+ARGI4
+ADDRGP4 text_color_disabled
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 36
+INDIRI4
+CNSTI4 8
+ADDI4
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 text_color_disabled
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRGP4 $408
+JUMPV
+LABELV $407
+ADDRLP4 36
+INDIRI4
+CNSTI4 8
+SUBI4
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 g_bindings+4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 18
+ARGI4
+ADDRGP4 controls_binding_color
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 36
+INDIRI4
+CNSTI4 8
+ADDI4
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 controls_binding_color
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $408
+LABELV $399
+LABELV $386
+endproc Controls_DrawKeyBinding 116 20
+proc Controls_StatusBar 0 20
+CNSTI4 500
+ARGI4
+CNSTI4 408
+ARGI4
+ADDRGP4 $412
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $411
+endproc Controls_StatusBar 0 20
+proc Controls_GetKeyAssignment 280 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 268
+CNSTI4 -1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRLP4 272
+CNSTI4 0
+ASGNI4
+ADDRLP4 260
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 272
+INDIRI4
+ASGNI4
+LABELV $414
+ADDRLP4 256
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_Key_GetBindingBuf
+CALLV
+pop
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $418
+ADDRGP4 $415
+JUMPV
+LABELV $418
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 276
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+NEI4 $420
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRLP4 260
+ADDRLP4 260
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+NEI4 $422
+ADDRGP4 $416
+JUMPV
+LABELV $422
+LABELV $420
+LABELV $415
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 256
+LTI4 $414
+LABELV $416
+LABELV $413
+endproc Controls_GetKeyAssignment 280 12
+proc Controls_GetConfig 48 12
+ADDRLP4 0
+ADDRGP4 g_bindings
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $425
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $429
+ADDRGP4 $427
+JUMPV
+LABELV $429
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Controls_GetKeyAssignment
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $426
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRGP4 $425
+JUMPV
+LABELV $427
+ADDRGP4 $149
+ARGP4
+ADDRLP4 20
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+CNSTF4 0
+GEF4 $435
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $436
+JUMPV
+LABELV $435
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $436
+ADDRGP4 s_controls+1960+64
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $152
+ARGP4
+ADDRLP4 24
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 UI_ClampCvar
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+2108+64
+ADDRLP4 28
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $150
+ARGP4
+ADDRLP4 32
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 UI_ClampCvar
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+2240+64
+ADDRLP4 36
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $151
+ARGP4
+ADDRLP4 40
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+CNSTF4 1073741824
+ARGF4
+CNSTF4 1106247680
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 UI_ClampCvar
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+2028+72
+ADDRLP4 44
+INDIRF4
+ASGNF4
+LABELV $424
+endproc Controls_GetConfig 48 12
+proc Controls_SetConfig 24 8
+ADDRLP4 0
+ADDRGP4 g_bindings
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $444
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $448
+ADDRGP4 $446
+JUMPV
+LABELV $448
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $450
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Key_SetBinding
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $452
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Key_SetBinding
+CALLV
+pop
+LABELV $452
+LABELV $450
+LABELV $445
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRGP4 $444
+JUMPV
+LABELV $446
+ADDRGP4 s_controls+1960+64
+INDIRI4
+CNSTI4 0
+EQI4 $454
+ADDRGP4 $149
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRGP4 $149
+ARGP4
+ADDRLP4 12
+INDIRF4
+NEGF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $455
+JUMPV
+LABELV $454
+ADDRGP4 $149
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRGP4 $149
+ARGP4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $455
+ADDRGP4 $152
+ARGP4
+ADDRGP4 s_controls+2108+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $150
+ARGP4
+ADDRGP4 s_controls+2240+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $151
+ARGP4
+ADDRGP4 s_controls+2028+72
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $464
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $443
+endproc Controls_SetConfig 24 8
+export SetDefaultBinds_onUnusedKeys
+proc SetDefaultBinds_onUnusedKeys 24 12
+ADDRGP4 wop_AutoBindUnusedKeys+12
+INDIRI4
+CNSTI4 0
+NEI4 $466
+ADDRGP4 $465
+JUMPV
+LABELV $466
+ADDRLP4 0
+ADDRGP4 g_bindings
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $469
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $473
+ADDRGP4 $471
+JUMPV
+LABELV $473
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $475
+ADDRGP4 $470
+JUMPV
+LABELV $475
+ADDRLP4 4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRGP4 trap_Key_GetBindingBuf
+CALLV
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $477
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Key_SetBinding
+CALLV
+pop
+LABELV $477
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $479
+ADDRGP4 $470
+JUMPV
+LABELV $479
+ADDRLP4 4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRGP4 trap_Key_GetBindingBuf
+CALLV
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $481
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Key_SetBinding
+CALLV
+pop
+LABELV $481
+LABELV $470
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRGP4 $469
+JUMPV
+LABELV $471
+LABELV $465
+endproc SetDefaultBinds_onUnusedKeys 24 12
+proc Controls_SetDefaults 28 4
+ADDRLP4 0
+ADDRGP4 g_bindings
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $484
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $488
+ADDRGP4 $486
+JUMPV
+LABELV $488
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $485
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRGP4 $484
+JUMPV
+LABELV $486
+ADDRGP4 $149
+ARGP4
+ADDRLP4 12
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 0
+GEF4 $493
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $494
+JUMPV
+LABELV $493
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $494
+ADDRGP4 s_controls+1960+64
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $152
+ARGP4
+ADDRLP4 16
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+2108+64
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $150
+ARGP4
+ADDRLP4 20
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+2240+64
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $151
+ARGP4
+ADDRLP4 24
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+2028+72
+ADDRLP4 24
+INDIRF4
+ASGNF4
+LABELV $483
+endproc Controls_SetDefaults 28 4
+proc Controls_MenuKey 44 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 s_controls+4464
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $502
+ADDRLP4 24
+CNSTI4 140
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $507
+ADDRFP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+GTI4 $514
+LABELV $513
+ADDRLP4 32
+CNSTI4 27
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $508
+ADDRFP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LTI4 $512
+LABELV $515
+ADDRFP4 0
+INDIRI4
+CNSTI4 127
+EQI4 $507
+ADDRGP4 $512
+JUMPV
+LABELV $514
+ADDRLP4 40
+CNSTI4 171
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+EQI4 $507
+ADDRFP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+LTI4 $512
+LABELV $516
+ADDRFP4 0
+INDIRI4
+CNSTI4 179
+EQI4 $508
+ADDRGP4 $512
+JUMPV
+LABELV $507
+ADDRFP4 0
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $503
+JUMPV
+LABELV $508
+ADDRGP4 s_controls+3688
+INDIRI4
+CNSTI4 0
+EQI4 $512
+ADDRGP4 Controls_SetConfig
+CALLV
+pop
+ADDRGP4 $512
+JUMPV
+LABELV $502
+ADDRFP4 0
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $517
+ADDRGP4 $512
+JUMPV
+LABELV $517
+ADDRLP4 24
+CNSTI4 27
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $521
+ADDRFP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LTI4 $519
+LABELV $524
+ADDRFP4 0
+INDIRI4
+CNSTI4 96
+EQI4 $512
+ADDRGP4 $519
+JUMPV
+LABELV $521
+ADDRGP4 s_controls+4464
+CNSTI4 0
+ASGNI4
+ADDRGP4 Controls_Update
+CALLV
+pop
+ADDRGP4 menu_null_sound
+INDIRI4
+RETI4
+ADDRGP4 $501
+JUMPV
+LABELV $519
+LABELV $503
+ADDRGP4 s_controls+3688
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 -1
+EQI4 $526
+ADDRLP4 0
+ADDRGP4 g_bindings
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $528
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $532
+ADDRGP4 $530
+JUMPV
+LABELV $532
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $534
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $534
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $536
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $536
+LABELV $529
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRGP4 $528
+JUMPV
+LABELV $530
+LABELV $526
+ADDRLP4 8
+ADDRGP4 s_controls
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_controls+12
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 g_bindings
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $539
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $543
+ADDRGP4 $541
+JUMPV
+LABELV $543
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $545
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $547
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $549
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $551
+ARGP4
+ADDRGP4 trap_Key_SetBinding
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $549
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $541
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $551
+ARGP4
+ADDRGP4 trap_Key_SetBinding
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $541
+JUMPV
+LABELV $547
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $554
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $541
+JUMPV
+LABELV $554
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $556
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $556
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $541
+JUMPV
+LABELV $556
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $551
+ARGP4
+ADDRGP4 trap_Key_SetBinding
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $551
+ARGP4
+ADDRGP4 trap_Key_SetBinding
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $541
+JUMPV
+LABELV $545
+LABELV $540
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRGP4 $539
+JUMPV
+LABELV $541
+ADDRGP4 s_controls+4464
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $559
+ADDRGP4 Controls_Update
+CALLV
+pop
+ADDRGP4 menu_null_sound
+INDIRI4
+RETI4
+ADDRGP4 $501
+JUMPV
+LABELV $559
+LABELV $512
+ADDRGP4 s_controls
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 Menu_DefaultKey
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+RETI4
+LABELV $501
+endproc Controls_MenuKey 44 8
+proc Controls_ResetDefaults_Action 0 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $562
+ADDRGP4 $561
+JUMPV
+LABELV $562
+ADDRGP4 s_controls+3688
+CNSTI4 1
+ASGNI4
+ADDRGP4 Controls_SetDefaults
+CALLV
+pop
+ADDRGP4 Controls_Update
+CALLV
+pop
+LABELV $561
+endproc Controls_ResetDefaults_Action 0 0
+proc Controls_ResetDefaults_Draw 0 20
+CNSTI4 320
+ARGI4
+CNSTI4 356
+ARGI4
+ADDRGP4 $566
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_yellow
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 383
+ARGI4
+ADDRGP4 $567
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_yellow
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+LABELV $565
+endproc Controls_ResetDefaults_Draw 0 20
+proc Controls_MenuEvent 12 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 43
+LTI4 $569
+ADDRLP4 0
+INDIRI4
+CNSTI4 49
+GTI4 $608
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $609-172
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $609
+address $604
+address $569
+address $604
+address $604
+address $569
+address $569
+address $604
+code
+LABELV $608
+ADDRLP4 0
+INDIRI4
+CNSTI4 100
+LTI4 $569
+ADDRLP4 0
+INDIRI4
+CNSTI4 107
+GTI4 $569
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $611-400
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $611
+address $572
+address $576
+address $580
+address $584
+address $588
+address $592
+address $598
+address $601
+code
+LABELV $572
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $570
+ADDRGP4 s_controls+4460
+CNSTI4 0
+ASGNI4
+ADDRGP4 Controls_Update
+CALLV
+pop
+ADDRGP4 $570
+JUMPV
+LABELV $576
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $570
+ADDRGP4 s_controls+4460
+CNSTI4 1
+ASGNI4
+ADDRGP4 Controls_Update
+CALLV
+pop
+ADDRGP4 $570
+JUMPV
+LABELV $580
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $570
+ADDRGP4 s_controls+4460
+CNSTI4 2
+ASGNI4
+ADDRGP4 Controls_Update
+CALLV
+pop
+ADDRGP4 $570
+JUMPV
+LABELV $584
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $570
+ADDRGP4 s_controls+4460
+CNSTI4 3
+ASGNI4
+ADDRGP4 Controls_Update
+CALLV
+pop
+ADDRGP4 $570
+JUMPV
+LABELV $588
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $570
+ADDRGP4 $591
+ARGP4
+ADDRGP4 Controls_ResetDefaults_Draw
+ARGP4
+ADDRGP4 Controls_ResetDefaults_Action
+ARGP4
+ADDRGP4 UI_ConfirmMenu
+CALLV
+pop
+ADDRGP4 $570
+JUMPV
+LABELV $592
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $570
+ADDRGP4 s_controls+3688
+INDIRI4
+CNSTI4 0
+EQI4 $595
+ADDRGP4 Controls_SetConfig
+CALLV
+pop
+LABELV $595
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $570
+JUMPV
+LABELV $598
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $570
+ADDRGP4 Controls_SetConfig
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $570
+JUMPV
+LABELV $601
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $570
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $570
+JUMPV
+LABELV $604
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $570
+ADDRGP4 s_controls+3688
+CNSTI4 1
+ASGNI4
+LABELV $569
+LABELV $570
+LABELV $568
+endproc Controls_MenuEvent 12 12
+proc Controls_ActionEvent 0 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $614
+CNSTI4 0
+ARGI4
+ADDRGP4 Controls_UpdateModel
+CALLV
+pop
+ADDRGP4 $615
+JUMPV
+LABELV $614
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $616
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 g_bindings+12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Controls_UpdateModel
+CALLV
+pop
+ADDRGP4 $617
+JUMPV
+LABELV $616
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $619
+ADDRGP4 s_controls+4464
+INDIRI4
+CNSTI4 0
+NEI4 $619
+ADDRGP4 s_controls+4464
+CNSTI4 1
+ASGNI4
+ADDRGP4 Controls_Update
+CALLV
+pop
+LABELV $619
+LABELV $617
+LABELV $615
+LABELV $613
+endproc Controls_ActionEvent 0 4
+proc Controls_MenuInit 0 12
+ADDRGP4 s_controls
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 4752
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 Controls_Cache
+CALLV
+pop
+ADDRGP4 s_controls+272
+ADDRGP4 Controls_MenuKey
+ASGNP4
+ADDRGP4 s_controls+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_controls+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_controls+288
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_controls+284
+CNSTI4 32832
+ASGNI4
+ADDRGP4 s_controls+392
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_controls+392+4
+ADDRGP4 $632
+ASGNP4
+ADDRGP4 s_controls+392+48
+CNSTU4 132
+ASGNU4
+ADDRGP4 s_controls+392+16
+CNSTI4 412
+ASGNI4
+ADDRGP4 s_controls+392+20
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_controls+392+12
+CNSTI4 101
+ASGNI4
+ADDRGP4 s_controls+392+52
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+392+80
+CNSTI4 75
+ASGNI4
+ADDRGP4 s_controls+392+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_controls+392+64
+ADDRGP4 $649
+ASGNP4
+ADDRGP4 s_controls+392+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_controls+296
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_controls+296+4
+ADDRGP4 $655
+ASGNP4
+ADDRGP4 s_controls+296+48
+CNSTU4 132
+ASGNU4
+ADDRGP4 s_controls+296+16
+CNSTI4 500
+ASGNI4
+ADDRGP4 s_controls+296+20
+CNSTI4 45
+ASGNI4
+ADDRGP4 s_controls+296+12
+CNSTI4 100
+ASGNI4
+ADDRGP4 s_controls+296+52
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+296+80
+CNSTI4 80
+ASGNI4
+ADDRGP4 s_controls+296+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_controls+296+64
+ADDRGP4 $672
+ASGNP4
+ADDRGP4 s_controls+296+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_controls+488
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_controls+488+4
+ADDRGP4 $678
+ASGNP4
+ADDRGP4 s_controls+488+48
+CNSTU4 132
+ASGNU4
+ADDRGP4 s_controls+488+16
+CNSTI4 478
+ASGNI4
+ADDRGP4 s_controls+488+20
+CNSTI4 90
+ASGNI4
+ADDRGP4 s_controls+488+12
+CNSTI4 102
+ASGNI4
+ADDRGP4 s_controls+488+52
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+488+80
+CNSTI4 105
+ASGNI4
+ADDRGP4 s_controls+488+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_controls+488+64
+ADDRGP4 $695
+ASGNP4
+ADDRGP4 s_controls+488+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_controls+584
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_controls+584+4
+ADDRGP4 $701
+ASGNP4
+ADDRGP4 s_controls+584+48
+CNSTU4 132
+ASGNU4
+ADDRGP4 s_controls+584+16
+CNSTI4 401
+ASGNI4
+ADDRGP4 s_controls+584+20
+CNSTI4 79
+ASGNI4
+ADDRGP4 s_controls+584+12
+CNSTI4 103
+ASGNI4
+ADDRGP4 s_controls+584+52
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+584+80
+CNSTI4 75
+ASGNI4
+ADDRGP4 s_controls+584+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_controls+584+64
+ADDRGP4 $718
+ASGNP4
+ADDRGP4 s_controls+584+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_controls+4572
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_controls+4572+4
+ADDRGP4 $724
+ASGNP4
+ADDRGP4 s_controls+4572+48
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_controls+4572+16
+CNSTI4 549
+ASGNI4
+ADDRGP4 s_controls+4572+20
+CNSTI4 440
+ASGNI4
+ADDRGP4 s_controls+4572+12
+CNSTI4 105
+ASGNI4
+ADDRGP4 s_controls+4572+52
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+4572+80
+CNSTI4 80
+ASGNI4
+ADDRGP4 s_controls+4572+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_controls+4572+64
+ADDRGP4 $741
+ASGNP4
+ADDRGP4 s_controls+4572+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_controls+680
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+680+48
+CNSTU4 12292
+ASGNU4
+ADDRGP4 s_controls+680+52
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+680+60
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+680+12
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_controls+744
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+744+48
+CNSTU4 12292
+ASGNU4
+ADDRGP4 s_controls+744+52
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+744+60
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+744+12
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_controls+808
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+808+48
+CNSTU4 12292
+ASGNU4
+ADDRGP4 s_controls+808+52
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+808+60
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+808+12
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_controls+872
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+872+48
+CNSTU4 12292
+ASGNU4
+ADDRGP4 s_controls+872+52
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+872+60
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+872+12
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_controls+936
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+936+48
+CNSTU4 12292
+ASGNU4
+ADDRGP4 s_controls+936+52
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+936+60
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+936+12
+CNSTI4 7
+ASGNI4
+ADDRGP4 s_controls+1000
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1000+48
+CNSTU4 12292
+ASGNU4
+ADDRGP4 s_controls+1000+52
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1000+60
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1000+12
+CNSTI4 8
+ASGNI4
+ADDRGP4 s_controls+1064
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1064+48
+CNSTU4 12292
+ASGNU4
+ADDRGP4 s_controls+1064+52
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1064+60
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1064+12
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1192
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1192+48
+CNSTU4 12292
+ASGNU4
+ADDRGP4 s_controls+1192+52
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1192+60
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1192+12
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_controls+1128
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1128+48
+CNSTU4 12292
+ASGNU4
+ADDRGP4 s_controls+1128+52
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1128+60
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1128+12
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_controls+1256
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1256+48
+CNSTU4 12292
+ASGNU4
+ADDRGP4 s_controls+1256+52
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1256+60
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1256+12
+CNSTI4 11
+ASGNI4
+ADDRGP4 s_controls+1320
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1320+48
+CNSTU4 12292
+ASGNU4
+ADDRGP4 s_controls+1320+52
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1320+60
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1320+12
+CNSTI4 12
+ASGNI4
+ADDRGP4 s_controls+1384
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1384+48
+CNSTU4 12292
+ASGNU4
+ADDRGP4 s_controls+1384+52
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1384+60
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1384+12
+CNSTI4 13
+ASGNI4
+ADDRGP4 s_controls+1448
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1448+48
+CNSTU4 12292
+ASGNU4
+ADDRGP4 s_controls+1448+52
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1448+60
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1448+12
+CNSTI4 14
+ASGNI4
+ADDRGP4 s_controls+1512
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1512+48
+CNSTU4 12292
+ASGNU4
+ADDRGP4 s_controls+1512+52
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1512+60
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1512+12
+CNSTI4 15
+ASGNI4
+ADDRGP4 s_controls+1576
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1576+48
+CNSTU4 12292
+ASGNU4
+ADDRGP4 s_controls+1576+52
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1576+60
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1576+12
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_controls+1640
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1640+48
+CNSTU4 12292
+ASGNU4
+ADDRGP4 s_controls+1640+52
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1640+60
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1640+12
+CNSTI4 17
+ASGNI4
+ADDRGP4 s_controls+1704
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1704+48
+CNSTU4 12292
+ASGNU4
+ADDRGP4 s_controls+1704+52
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1704+60
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1704+12
+CNSTI4 18
+ASGNI4
+ADDRGP4 s_controls+1768
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1768+48
+CNSTU4 12292
+ASGNU4
+ADDRGP4 s_controls+1768+52
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1768+60
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1768+12
+CNSTI4 19
+ASGNI4
+ADDRGP4 s_controls+1832
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1832+48
+CNSTU4 12292
+ASGNU4
+ADDRGP4 s_controls+1832+52
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1832+60
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1832+12
+CNSTI4 20
+ASGNI4
+ADDRGP4 s_controls+2372
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2372+48
+CNSTU4 12292
+ASGNU4
+ADDRGP4 s_controls+2372+52
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2372+60
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2372+12
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_controls+2372+8
+ADDRGP4 $926
+ASGNP4
+ADDRGP4 s_controls+2308
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2308+48
+CNSTU4 12292
+ASGNU4
+ADDRGP4 s_controls+2308+52
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2308+60
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2308+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_controls+1960
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_controls+1960+48
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+1960+16
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+1960+4
+ADDRGP4 $943
+ASGNP4
+ADDRGP4 s_controls+1960+12
+CNSTI4 43
+ASGNI4
+ADDRGP4 s_controls+1960+52
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+1960+56
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+1960+8
+ADDRGP4 $952
+ASGNP4
+ADDRGP4 s_controls+2108
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_controls+2108+48
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+2108+16
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+2108+4
+ADDRGP4 $960
+ASGNP4
+ADDRGP4 s_controls+2108+12
+CNSTI4 49
+ASGNI4
+ADDRGP4 s_controls+2108+52
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+2108+56
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+2108+8
+ADDRGP4 $969
+ASGNP4
+ADDRGP4 s_controls+2240
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_controls+2240+48
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+2240+16
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+2240+4
+ADDRGP4 $977
+ASGNP4
+ADDRGP4 s_controls+2240+12
+CNSTI4 45
+ASGNI4
+ADDRGP4 s_controls+2240+52
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+2240+56
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+2240+8
+ADDRGP4 $986
+ASGNP4
+ADDRGP4 s_controls+2028
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_controls+2028+16
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+2028+48
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+2028+4
+ADDRGP4 $994
+ASGNP4
+ADDRGP4 s_controls+2028+12
+CNSTI4 46
+ASGNI4
+ADDRGP4 s_controls+2028+52
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+2028+64
+CNSTF4 1073741824
+ASGNF4
+ADDRGP4 s_controls+2028+68
+CNSTF4 1106247680
+ASGNF4
+ADDRGP4 s_controls+2028+56
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+2176
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2176+48
+CNSTU4 12292
+ASGNU4
+ADDRGP4 s_controls+2176+52
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2176+60
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2176+12
+CNSTI4 34
+ASGNI4
+ADDRGP4 s_controls+2176+8
+ADDRGP4 $1016
+ASGNP4
+ADDRGP4 s_controls+1896
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1896+48
+CNSTU4 12292
+ASGNU4
+ADDRGP4 s_controls+1896+52
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1896+60
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1896+12
+CNSTI4 21
+ASGNI4
+ADDRGP4 s_controls+1896+8
+ADDRGP4 $1028
+ASGNP4
+ADDRGP4 s_controls+3692
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+3692+48
+CNSTU4 12292
+ASGNU4
+ADDRGP4 s_controls+3692+52
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+3692+60
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+3692+12
+CNSTI4 22
+ASGNI4
+ADDRGP4 s_controls+3692+8
+ADDRGP4 $1040
+ASGNP4
+ADDRGP4 s_controls+3756
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+3756+48
+CNSTU4 12292
+ASGNU4
+ADDRGP4 s_controls+3756+52
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+3756+60
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+3756+12
+CNSTI4 23
+ASGNI4
+ADDRGP4 s_controls+3820
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+3820+48
+CNSTU4 12292
+ASGNU4
+ADDRGP4 s_controls+3820+52
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+3820+60
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+3820+12
+CNSTI4 24
+ASGNI4
+ADDRGP4 s_controls+3820+8
+ADDRGP4 $1061
+ASGNP4
+ADDRGP4 s_controls+3884
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+3884+48
+CNSTU4 12292
+ASGNU4
+ADDRGP4 s_controls+3884+52
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+3884+60
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+3884+12
+CNSTI4 25
+ASGNI4
+ADDRGP4 s_controls+3884+8
+ADDRGP4 $1073
+ASGNP4
+ADDRGP4 s_controls+3948
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+3948+48
+CNSTU4 12292
+ASGNU4
+ADDRGP4 s_controls+3948+52
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+3948+60
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+3948+12
+CNSTI4 26
+ASGNI4
+ADDRGP4 s_controls+4012
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+4012+48
+CNSTU4 12292
+ASGNU4
+ADDRGP4 s_controls+4012+52
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+4012+60
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+4012+12
+CNSTI4 27
+ASGNI4
+ADDRGP4 s_controls+4076
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+4076+48
+CNSTU4 12292
+ASGNU4
+ADDRGP4 s_controls+4076+52
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+4076+60
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+4076+12
+CNSTI4 28
+ASGNI4
+ADDRGP4 s_controls+4204
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+4204+48
+CNSTU4 12292
+ASGNU4
+ADDRGP4 s_controls+4204+52
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+4204+60
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+4204+12
+CNSTI4 30
+ASGNI4
+ADDRGP4 s_controls+4204+8
+ADDRGP4 $1112
+ASGNP4
+ADDRGP4 s_controls+4268
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+4268+48
+CNSTU4 12292
+ASGNU4
+ADDRGP4 s_controls+4268+52
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+4268+60
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+4268+12
+CNSTI4 33
+ASGNI4
+ADDRGP4 s_controls+4268+8
+ADDRGP4 $1124
+ASGNP4
+ADDRGP4 s_controls+4140
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+4140+48
+CNSTU4 12292
+ASGNU4
+ADDRGP4 s_controls+4140+52
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+4140+60
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+4140+12
+CNSTI4 29
+ASGNI4
+ADDRGP4 s_controls+4140+8
+ADDRGP4 $1136
+ASGNP4
+ADDRGP4 s_controls+4332
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+4332+48
+CNSTU4 12292
+ASGNU4
+ADDRGP4 s_controls+4332+52
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+4332+60
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+4332+12
+CNSTI4 31
+ASGNI4
+ADDRGP4 s_controls+4332+8
+ADDRGP4 $1148
+ASGNP4
+ADDRGP4 s_controls+4396
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+4396+48
+CNSTU4 12292
+ASGNU4
+ADDRGP4 s_controls+4396+52
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+4396+60
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+4396+12
+CNSTI4 32
+ASGNI4
+ADDRGP4 s_controls+4396+8
+ADDRGP4 $1160
+ASGNP4
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+392
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+296
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+488
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+584
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2028
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2108
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1960
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2176
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1064
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+680
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+744
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+808
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+872
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+936
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1000
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1704
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1832
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1768
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2240
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1192
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1128
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1256
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1320
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1384
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1448
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1512
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1576
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1640
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2308
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2372
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1896
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+3692
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+3756
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+3820
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+3884
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+3948
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+4012
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+4076
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+4140
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+4204
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+4332
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+4396
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+4268
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+4572
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 Controls_InitCvars
+CALLV
+pop
+ADDRGP4 Controls_GetConfig
+CALLV
+pop
+ADDRGP4 s_controls+4460
+CNSTI4 1
+ASGNI4
+ADDRGP4 Controls_Update
+CALLV
+pop
+LABELV $623
+endproc Controls_MenuInit 0 12
+export Controls_Cache
+proc Controls_Cache 0 4
+ADDRGP4 $724
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $741
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $632
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $649
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $655
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $672
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $678
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $695
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $701
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $718
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $1206
+endproc Controls_Cache 0 4
+export UI_ControlsMenu
+proc UI_ControlsMenu 0 4
+ADDRGP4 Controls_MenuInit
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $1207
+endproc UI_ControlsMenu 0 4
+bss
+align 4
+LABELV s_controls
+skip 4752
+import UI_HelpMenu_Cache
+import UI_HelpMenu_f
+import UI_HelpMenu
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import UI_InitGameinfo
+import UI_GetNumBots
+import UI_GetBotInfoByNumber
+import UI_GetNumArenas
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_VoiceIngame
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_GetVoiceGainClient
+import trap_GetVoiceMuteAll
+import trap_GetVoiceMuteClient
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_CIN_SetExtents
+import trap_CIN_StopCinematic
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_PlayCinematic
+import trap_RealTime
+import trap_S_StartBackgroundTrack
+import trap_S_StopBackgroundTrack
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_SaveCachedServers
+import trap_LAN_LoadCachedServers
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import BotListCompare
+import uis
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString2
+import UI_AutoWrappedString_LineCount
+import UI_DrawString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawIngameBG
+import UI_DrawStringNS
+import UI_ModelIcon
+import UI_DrawHandlePic1024
+import UI_AdjustFrom1024
+import UI_StopMusic
+import UI_StartCreditMusic
+import UI_StartMusic
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_ClearModelCache
+import UI_PrecacheClientModelname
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import UI_SpecifyPasswordMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import Demos_Cache
+import UI_DemosMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import SetupDefaultMenu_Cache
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import Music_NextTrack
+import Music_TriggerRestart
+import Music_Check
+import MusicMenu_Cache
+import MusicMenu_Open
+import MusicMenu_Shutdown
+import MusicMenu_Init
+import UI_CallVoteMenu
+import UI_InGameMenu
+import InGame_Cache
+import UI_SecretMenu
+import UI_InitBigCredits
+import UI_BigCredits_Cache
+import UI_CreditMenu
+import ExitMenu_Cache
+import ExitMenu_Init
+import UI_MainMenu
+import MainMenu_Cache
+import UI_UpdateCvars
+import UI_RegisterCvars
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import listbar_bluecolor
+import text_color_bluehighlight
+import text_color_bluenormal
+import text_color_ighighlight
+import text_color_ignormal
+import listbar_igcolor
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_lightOrange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_click_sound
+import menu_switch_sound
+import menu_move_sound
+import ScrollList_Key
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import wop_AutoBindUnusedKeys
+import wop_AutoswitchSongByNextMap
+import con_notifytime
+import s_wop_restarted
+import syc_logo
+import spraycolor
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_createGametype
+import ui_browserHidePrivate
+import ui_browserOnlyHumans
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $1160
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 119
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 47
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 32
+byte 1 47
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 0
+align 1
+LABELV $1148
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 117
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $1136
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 0
+align 1
+LABELV $1124
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 107
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 103
+byte 1 104
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 104
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 46
+byte 1 32
+byte 1 84
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 102
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 104
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 46
+byte 1 0
+align 1
+LABELV $1112
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 44
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 103
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 46
+byte 1 0
+align 1
+LABELV $1073
+byte 1 67
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 41
+byte 1 46
+byte 1 0
+align 1
+LABELV $1061
+byte 1 67
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 41
+byte 1 46
+byte 1 0
+align 1
+LABELV $1040
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 46
+byte 1 0
+align 1
+LABELV $1028
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 46
+byte 1 0
+align 1
+LABELV $1016
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $994
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $986
+byte 1 73
+byte 1 102
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 46
+byte 1 0
+align 1
+LABELV $977
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $969
+byte 1 83
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 104
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $960
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $952
+byte 1 83
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 40
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 41
+byte 1 46
+byte 1 0
+align 1
+LABELV $943
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $926
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 100
+byte 1 117
+byte 1 99
+byte 1 107
+byte 1 115
+byte 1 32
+byte 1 47
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 47
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 121
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 101
+byte 1 41
+byte 1 46
+byte 1 0
+align 1
+LABELV $741
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 98
+byte 1 116
+byte 1 110
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 49
+byte 1 0
+align 1
+LABELV $724
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 98
+byte 1 116
+byte 1 110
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 48
+byte 1 0
+align 1
+LABELV $718
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 49
+byte 1 0
+align 1
+LABELV $701
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 48
+byte 1 0
+align 1
+LABELV $695
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 49
+byte 1 0
+align 1
+LABELV $678
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 48
+byte 1 0
+align 1
+LABELV $672
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 49
+byte 1 0
+align 1
+LABELV $655
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 48
+byte 1 0
+align 1
+LABELV $649
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 49
+byte 1 0
+align 1
+LABELV $632
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 48
+byte 1 0
+align 1
+LABELV $591
+byte 1 83
+byte 1 69
+byte 1 84
+byte 1 32
+byte 1 84
+byte 1 79
+byte 1 32
+byte 1 68
+byte 1 69
+byte 1 70
+byte 1 65
+byte 1 85
+byte 1 76
+byte 1 84
+byte 1 83
+byte 1 63
+byte 1 0
+align 1
+LABELV $567
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 114
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 0
+align 1
+LABELV $566
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 84
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $551
+byte 1 0
+align 1
+LABELV $464
+byte 1 105
+byte 1 110
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $412
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 67
+byte 1 76
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $406
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 66
+byte 1 65
+byte 1 67
+byte 1 75
+byte 1 83
+byte 1 80
+byte 1 65
+byte 1 67
+byte 1 69
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $405
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 67
+byte 1 76
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $404
+byte 1 87
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 32
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 32
+byte 1 69
+byte 1 83
+byte 1 67
+byte 1 65
+byte 1 80
+byte 1 69
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $397
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 0
+align 1
+LABELV $393
+byte 1 63
+byte 1 63
+byte 1 63
+byte 1 0
+align 1
+LABELV $382
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 112
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 86
+byte 1 65
+byte 1 68
+byte 1 0
+align 1
+LABELV $381
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $152
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $151
+byte 1 115
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $150
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $149
+byte 1 109
+byte 1 95
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $148
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $147
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 0
+align 1
+LABELV $146
+byte 1 43
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $145
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $144
+byte 1 43
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $143
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $142
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 0
+align 1
+LABELV $141
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $140
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $139
+byte 1 51
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 0
+align 1
+LABELV $138
+byte 1 116
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $137
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 0
+align 1
+LABELV $136
+byte 1 116
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $135
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $134
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 67
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $133
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 112
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $132
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $131
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $130
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 0
+align 1
+LABELV $129
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 0
+align 1
+LABELV $128
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $127
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $126
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 50
+byte 1 0
+align 1
+LABELV $125
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $124
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $123
+byte 1 103
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $122
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 51
+byte 1 0
+align 1
+LABELV $121
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $120
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $119
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $118
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 0
+align 1
+LABELV $117
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $116
+byte 1 43
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $115
+byte 1 73
+byte 1 77
+byte 1 80
+byte 1 69
+byte 1 82
+byte 1 105
+byte 1 85
+byte 1 83
+byte 1 0
+align 1
+LABELV $114
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 57
+byte 1 0
+align 1
+LABELV $113
+byte 1 66
+byte 1 85
+byte 1 66
+byte 1 66
+byte 1 76
+byte 1 69
+byte 1 46
+byte 1 71
+byte 1 46
+byte 1 0
+align 1
+LABELV $112
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 56
+byte 1 0
+align 1
+LABELV $111
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $110
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 55
+byte 1 0
+align 1
+LABELV $109
+byte 1 66
+byte 1 79
+byte 1 65
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $108
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 54
+byte 1 0
+align 1
+LABELV $107
+byte 1 66
+byte 1 69
+byte 1 84
+byte 1 84
+byte 1 89
+byte 1 0
+align 1
+LABELV $106
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 53
+byte 1 0
+align 1
+LABELV $105
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 79
+byte 1 79
+byte 1 78
+byte 1 89
+byte 1 0
+align 1
+LABELV $104
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 52
+byte 1 0
+align 1
+LABELV $103
+byte 1 80
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $102
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 51
+byte 1 0
+align 1
+LABELV $101
+byte 1 78
+byte 1 105
+byte 1 80
+byte 1 80
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $100
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 50
+byte 1 0
+align 1
+LABELV $99
+byte 1 80
+byte 1 85
+byte 1 78
+byte 1 67
+byte 1 72
+byte 1 89
+byte 1 0
+align 1
+LABELV $98
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 49
+byte 1 0
+align 1
+LABELV $97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 47
+byte 1 32
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $96
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $95
+byte 1 117
+byte 1 112
+byte 1 32
+byte 1 47
+byte 1 32
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $94
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $93
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 32
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $92
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $91
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $90
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $89
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $88
+byte 1 43
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $87
+byte 1 119
+byte 1 97
+byte 1 108
+byte 1 107
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $86
+byte 1 43
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $85
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 32
+byte 1 47
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 108
+byte 1 107
+byte 1 0
+align 1
+LABELV $84
+byte 1 43
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $83
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 0
+align 1
+LABELV $82
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 50
+byte 1 0
+align 1
+LABELV $81
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $80
+byte 1 43
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
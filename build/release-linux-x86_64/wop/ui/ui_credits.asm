@@ -0,0 +1,1586 @@
+code
+proc UI_CreditMenu_Key 0 8
+ADDRFP4 0
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $79
+CNSTI4 0
+RETI4
+ADDRGP4 $78
+JUMPV
+LABELV $79
+CNSTI4 1
+ARGI4
+ADDRGP4 $81
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $78
+endproc UI_CreditMenu_Key 0 8
+proc UI_CreditMenu_Draw 8 20
+ADDRGP4 $83
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+CNSTF4 1139802112
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $82
+endproc UI_CreditMenu_Draw 8 20
+lit
+align 4
+LABELV $85
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export UI_CreditMenu
+code
+proc UI_CreditMenu 20 20
+ADDRLP4 0
+ADDRGP4 $85
+INDIRB
+ASGNB 16
+ADDRLP4 16
+CNSTF4 0
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRGP4 uis+13840
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+CNSTF4 1073741824
+CNSTF4 1142947840
+ADDRGP4 uis+13832
+INDIRF4
+DIVF4
+MULF4
+ARGF4
+CNSTF4 1139802112
+ADDRGP4 uis+13836
+INDIRF4
+DIVF4
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRGP4 s_credits
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 296
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 s_credits+268
+ADDRGP4 UI_CreditMenu_Draw
+ASGNP4
+ADDRGP4 s_credits+272
+ADDRGP4 UI_CreditMenu_Key
+ASGNP4
+ADDRGP4 s_credits+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_credits
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $84
+endproc UI_CreditMenu 20 20
+proc UI_checkMenuExitKeys 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 179
+EQI4 $95
+ADDRFP4 0
+INDIRI4
+CNSTI4 27
+NEI4 $93
+LABELV $95
+ADDRGP4 UI_StopMusic
+CALLV
+pop
+LABELV $93
+ADDRGP4 uis+20
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 Menu_DefaultKey
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $92
+endproc UI_checkMenuExitKeys 8 8
+data
+export creditbgs
+align 4
+LABELV creditbgs
+address $97
+address $98
+address $99
+address $100
+address $101
+address $102
+address $103
+address $104
+byte 4 0
+export UI_BigCredits_Cache
+code
+proc UI_BigCredits_Cache 4 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $107
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 creditbgs
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $108
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $107
+LABELV $106
+endproc UI_BigCredits_Cache 4 4
+export UI_BigCreditsAction
+proc UI_BigCreditsAction 4 8
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $112
+ADDRGP4 $111
+JUMPV
+LABELV $112
+ADDRLP4 0
+ADDRGP4 s_bigcredits+392
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 s_bigcredits+392
+INDIRI4
+CNSTI4 8
+LTI4 $115
+ADDRGP4 s_bigcredits+392
+CNSTI4 0
+ASGNI4
+LABELV $115
+ADDRGP4 s_bigcredits+296+4
+ADDRGP4 s_bigcredits+392
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 creditbgs
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 s_bigcredits+296+72
+CNSTI4 0
+ASGNI4
+ADDRGP4 menu_switch_sound
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $111
+endproc UI_BigCreditsAction 4 8
+export UI_InitBigCredits
+proc UI_InitBigCredits 0 12
+ADDRGP4 s_bigcredits
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 396
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 UI_StartCreditMusic
+CALLV
+pop
+ADDRGP4 UI_BigCredits_Cache
+CALLV
+pop
+ADDRGP4 s_bigcredits+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_bigcredits+272
+ADDRGP4 UI_checkMenuExitKeys
+ASGNP4
+ADDRGP4 s_bigcredits+296
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_bigcredits+296+4
+ADDRGP4 creditbgs
+INDIRP4
+ASGNP4
+ADDRGP4 s_bigcredits+296+48
+CNSTU4 1048580
+ASGNU4
+ADDRGP4 s_bigcredits+296+52
+ADDRGP4 UI_BigCreditsAction
+ASGNP4
+ADDRGP4 s_bigcredits+296+16
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_bigcredits+296+20
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_bigcredits+296+80
+CNSTI4 640
+ASGNI4
+ADDRGP4 s_bigcredits+296+84
+CNSTI4 480
+ASGNI4
+ADDRGP4 s_bigcredits
+ARGP4
+ADDRGP4 s_bigcredits+296
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_bigcredits
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $124
+endproc UI_InitBigCredits 0 12
+export setSecretShaderStr
+proc setSecretShaderStr 16 8
+ADDRGP4 s_secretmenu+392
+ARGP4
+ADDRGP4 $146
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 s_secretmenu+392
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 4
+INDIRU4
+CVUI4 4
+ASGNI4
+LABELV $148
+ADDRLP4 8
+CNSTI4 10
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 s_secretmenu+392
+ADDP4
+ADDRGP4 s_secretmenu+904
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRLP4 8
+INDIRI4
+DIVI4
+ADDRLP4 8
+INDIRI4
+MODI4
+CNSTI4 48
+ADDI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+INDIRI4
+ADDRGP4 s_secretmenu+392+1
+ADDP4
+ADDRGP4 s_secretmenu+904
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 10
+MODI4
+CNSTI4 48
+ADDI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+INDIRI4
+ADDRGP4 s_secretmenu+392+2
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 s_secretmenu+392
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $156
+ADDRGP4 $144
+JUMPV
+LABELV $156
+ADDRGP4 s_secretmenu+904
+INDIRI4
+CNSTI4 0
+EQI4 $159
+ADDRGP4 s_secretmenu+904
+CNSTI4 0
+ASGNI4
+ADDRGP4 $148
+JUMPV
+LABELV $159
+ADDRGP4 s_secretmenu+908
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 s_secretmenu+392
+ADDP4
+CNSTI1 46
+ASGNI1
+ADDRLP4 0
+INDIRI4
+ADDRGP4 s_secretmenu+392+1
+ADDP4
+CNSTI1 46
+ASGNI1
+LABELV $144
+endproc setSecretShaderStr 16 8
+export UI_SecretAction
+proc UI_SecretAction 4 8
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $168
+ADDRGP4 $167
+JUMPV
+LABELV $168
+ADDRLP4 0
+ADDRGP4 s_secretmenu+904
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 setSecretShaderStr
+CALLV
+pop
+ADDRGP4 s_secretmenu+296+72
+CNSTI4 0
+ASGNI4
+ADDRGP4 menu_switch_sound
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $167
+endproc UI_SecretAction 4 8
+lit
+align 4
+LABELV $177
+byte 4 0
+byte 4 1061997773
+byte 4 0
+byte 4 1053609165
+align 4
+LABELV $178
+byte 4 0
+byte 4 1056964608
+byte 4 1056964608
+byte 4 1050253722
+code
+proc Secret_MenuDraw 96 24
+ADDRGP4 s_secretmenu+908
+INDIRI4
+CNSTI4 0
+EQI4 $174
+ADDRLP4 0
+ADDRGP4 $177
+INDIRB
+ASGNB 16
+ADDRLP4 16
+ADDRGP4 $178
+INDIRB
+ASGNB 16
+ADDRGP4 uis+4
+INDIRI4
+CVIF4 4
+CNSTF4 1142292480
+DIVF4
+CNSTF4 1073741824
+ADDF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRGP4 uis+4
+INDIRI4
+CVIF4 4
+CNSTF4 1150681088
+DIVF4
+CNSTF4 1065353216
+SUBF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 40
+CNSTF4 1134559232
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 32
+INDIRF4
+MULF4
+SUBF4
+CVFI4 4
+ARGI4
+ADDRLP4 44
+CNSTF4 1131413504
+ASGNF4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+SUBF4
+CVFI4 4
+ARGI4
+ADDRGP4 $181
+ARGP4
+CNSTI4 1
+ARGI4
+CNSTF4 1101004800
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 UI_DrawStringNS
+CALLV
+pop
+ADDRGP4 uis+4
+INDIRI4
+CVIF4 4
+CNSTF4 1145569280
+DIVF4
+CNSTF4 1065353216
+ADDF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRGP4 uis+4
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+CNSTF4 1077936128
+ADDF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 56
+CNSTF4 1134559232
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+SUBF4
+CVFI4 4
+ARGI4
+ADDRLP4 60
+CNSTF4 1131413504
+ASGNF4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 52
+INDIRF4
+MULF4
+SUBF4
+CVFI4 4
+ARGI4
+ADDRGP4 $184
+ARGP4
+CNSTI4 1
+ARGI4
+CNSTF4 1101004800
+ARGF4
+ADDRGP4 colorLtGrey
+ARGP4
+ADDRGP4 UI_DrawStringNS
+CALLV
+pop
+ADDRGP4 uis+4
+INDIRI4
+CVIF4 4
+CNSTF4 1147207680
+DIVF4
+CNSTF4 1073741824
+SUBF4
+ARGF4
+ADDRLP4 64
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRGP4 uis+4
+INDIRI4
+CVIF4 4
+CNSTF4 1145569280
+DIVF4
+CNSTF4 1073741824
+SUBF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 72
+CNSTF4 1134559232
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 64
+INDIRF4
+MULF4
+SUBF4
+CVFI4 4
+ARGI4
+ADDRLP4 76
+CNSTF4 1131413504
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 68
+INDIRF4
+MULF4
+SUBF4
+CVFI4 4
+ARGI4
+ADDRGP4 $187
+ARGP4
+CNSTI4 1
+ARGI4
+CNSTF4 1101004800
+ARGF4
+ADDRGP4 colorDkGrey
+ARGP4
+ADDRGP4 UI_DrawStringNS
+CALLV
+pop
+ADDRGP4 uis+4
+INDIRI4
+CVIF4 4
+CNSTF4 1143930880
+DIVF4
+CNSTF4 1077936128
+ADDF4
+ARGF4
+ADDRLP4 80
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRGP4 uis+4
+INDIRI4
+CVIF4 4
+CNSTF4 1152319488
+DIVF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 84
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 88
+CNSTF4 1134559232
+ASGNF4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 80
+INDIRF4
+MULF4
+SUBF4
+CVFI4 4
+ARGI4
+ADDRLP4 92
+CNSTF4 1131413504
+ASGNF4
+ADDRLP4 92
+INDIRF4
+ADDRLP4 92
+INDIRF4
+ADDRLP4 84
+INDIRF4
+MULF4
+SUBF4
+CVFI4 4
+ARGI4
+ADDRGP4 $190
+ARGP4
+CNSTI4 1
+ARGI4
+CNSTF4 1101004800
+ARGF4
+ADDRLP4 16
+ARGP4
+ADDRGP4 UI_DrawStringNS
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 220
+ARGI4
+ADDRGP4 $191
+ARGP4
+CNSTI4 1
+ARGI4
+CNSTF4 1101004800
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawStringNS
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 240
+ARGI4
+ADDRGP4 s_secretmenu+392
+ARGP4
+CNSTI4 1
+ARGI4
+CNSTF4 1097859072
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawStringNS
+CALLV
+pop
+ADDRGP4 $175
+JUMPV
+LABELV $174
+ADDRGP4 s_secretmenu
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+LABELV $175
+LABELV $173
+endproc Secret_MenuDraw 96 24
+export UI_SecretMenu
+proc UI_SecretMenu 0 12
+ADDRGP4 s_secretmenu
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 912
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 UI_StartCreditMusic
+CALLV
+pop
+ADDRGP4 setSecretShaderStr
+CALLV
+pop
+ADDRGP4 s_secretmenu+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_secretmenu+268
+ADDRGP4 Secret_MenuDraw
+ASGNP4
+ADDRGP4 s_secretmenu+272
+ADDRGP4 UI_checkMenuExitKeys
+ASGNP4
+ADDRGP4 s_secretmenu+296
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_secretmenu+296+4
+ADDRGP4 s_secretmenu+392
+ASGNP4
+ADDRGP4 s_secretmenu+296+48
+CNSTU4 1048580
+ASGNU4
+ADDRGP4 s_secretmenu+296+52
+ADDRGP4 UI_SecretAction
+ASGNP4
+ADDRGP4 s_secretmenu+296+16
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_secretmenu+296+20
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_secretmenu+296+80
+CNSTI4 640
+ASGNI4
+ADDRGP4 s_secretmenu+296+84
+CNSTI4 480
+ASGNI4
+ADDRGP4 s_secretmenu
+ARGP4
+ADDRGP4 s_secretmenu+296
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_secretmenu
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $193
+endproc UI_SecretMenu 0 12
+bss
+align 4
+LABELV s_secretmenu
+skip 912
+align 4
+LABELV s_bigcredits
+skip 396
+align 4
+LABELV s_credits
+skip 296
+import UI_HelpMenu_Cache
+import UI_HelpMenu_f
+import UI_HelpMenu
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import UI_InitGameinfo
+import UI_GetNumBots
+import UI_GetBotInfoByNumber
+import UI_GetNumArenas
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_VoiceIngame
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_GetVoiceGainClient
+import trap_GetVoiceMuteAll
+import trap_GetVoiceMuteClient
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_CIN_SetExtents
+import trap_CIN_StopCinematic
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_PlayCinematic
+import trap_RealTime
+import trap_S_StartBackgroundTrack
+import trap_S_StopBackgroundTrack
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_SaveCachedServers
+import trap_LAN_LoadCachedServers
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import BotListCompare
+import uis
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString2
+import UI_AutoWrappedString_LineCount
+import UI_DrawString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawIngameBG
+import UI_DrawStringNS
+import UI_ModelIcon
+import UI_DrawHandlePic1024
+import UI_AdjustFrom1024
+import UI_StopMusic
+import UI_StartCreditMusic
+import UI_StartMusic
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_ClearModelCache
+import UI_PrecacheClientModelname
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import UI_SpecifyPasswordMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import Demos_Cache
+import UI_DemosMenu
+import SetDefaultBinds_onUnusedKeys
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import SetupDefaultMenu_Cache
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import Music_NextTrack
+import Music_TriggerRestart
+import Music_Check
+import MusicMenu_Cache
+import MusicMenu_Open
+import MusicMenu_Shutdown
+import MusicMenu_Init
+import UI_CallVoteMenu
+import UI_InGameMenu
+import InGame_Cache
+import ExitMenu_Cache
+import ExitMenu_Init
+import UI_MainMenu
+import MainMenu_Cache
+import UI_UpdateCvars
+import UI_RegisterCvars
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import listbar_bluecolor
+import text_color_bluehighlight
+import text_color_bluenormal
+import text_color_ighighlight
+import text_color_ignormal
+import listbar_igcolor
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_lightOrange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_click_sound
+import menu_switch_sound
+import menu_move_sound
+import ScrollList_Key
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import wop_AutoBindUnusedKeys
+import wop_AutoswitchSongByNextMap
+import con_notifytime
+import s_wop_restarted
+import syc_logo
+import spraycolor
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_createGametype
+import ui_browserHidePrivate
+import ui_browserOnlyHumans
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $191
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 45
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $190
+byte 1 102
+byte 1 42
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $187
+byte 1 45
+byte 1 46
+byte 1 45
+byte 1 0
+align 1
+LABELV $184
+byte 1 61
+byte 1 40
+byte 1 0
+align 1
+LABELV $181
+byte 1 42
+byte 1 99
+byte 1 114
+byte 1 121
+byte 1 42
+byte 1 0
+align 1
+LABELV $146
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $104
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 48
+byte 1 48
+byte 1 56
+byte 1 0
+align 1
+LABELV $103
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 48
+byte 1 48
+byte 1 55
+byte 1 0
+align 1
+LABELV $102
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 48
+byte 1 48
+byte 1 54
+byte 1 0
+align 1
+LABELV $101
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 48
+byte 1 48
+byte 1 53
+byte 1 0
+align 1
+LABELV $100
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 48
+byte 1 48
+byte 1 52
+byte 1 0
+align 1
+LABELV $99
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 48
+byte 1 48
+byte 1 51
+byte 1 0
+align 1
+LABELV $98
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 48
+byte 1 48
+byte 1 50
+byte 1 0
+align 1
+LABELV $97
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 48
+byte 1 48
+byte 1 49
+byte 1 0
+align 1
+LABELV $83
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 116
+byte 1 122
+byte 1 46
+byte 1 106
+byte 1 112
+byte 1 103
+byte 1 0
+align 1
+LABELV $81
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 10
+byte 1 0
@@ -0,0 +1,1359 @@
+code
+proc Demos_MenuEvent 12 8
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $79
+ADDRGP4 $78
+JUMPV
+LABELV $79
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LTI4 $81
+ADDRLP4 0
+INDIRI4
+CNSTI4 14
+GTI4 $81
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $95-40
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $95
+address $90
+address $84
+address $81
+address $93
+address $91
+code
+LABELV $84
+ADDRGP4 UI_ForceMenuOff
+CALLV
+pop
+ADDRGP4 $85
+ARGP4
+ADDRGP4 s_demos+296+68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_demos+296+80
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $82
+JUMPV
+LABELV $90
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $82
+JUMPV
+LABELV $91
+ADDRGP4 s_demos+296
+ARGP4
+CNSTI4 142
+ARGI4
+ADDRGP4 ScrollList_Key
+CALLI4
+pop
+ADDRGP4 $82
+JUMPV
+LABELV $93
+ADDRGP4 s_demos+296
+ARGP4
+CNSTI4 141
+ARGI4
+ADDRGP4 ScrollList_Key
+CALLI4
+pop
+LABELV $81
+LABELV $82
+LABELV $78
+endproc Demos_MenuEvent 12 8
+proc UI_DemosMenu_Key 4 8
+ADDRGP4 s_demos
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 Menu_DefaultKey
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $97
+endproc UI_DemosMenu_Key 4 8
+proc UI_SortDemos 12 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $98
+endproc UI_SortDemos 12 8
+proc Demos_MenuInit 96 20
+ADDRGP4 s_demos
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 37700
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 s_demos+272
+ADDRGP4 UI_DemosMenu_Key
+ASGNP4
+ADDRGP4 Demos_Cache
+CALLV
+pop
+ADDRGP4 s_demos+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_demos+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_demos+284
+CNSTI4 33792
+ASGNI4
+ADDRGP4 s_demos+416
+CNSTI4 11
+ASGNI4
+ADDRGP4 s_demos+416+76
+CNSTI4 96
+ASGNI4
+ADDRGP4 s_demos+416+80
+CNSTI4 240
+ASGNI4
+ADDRGP4 s_demos+416+84
+CNSTI4 38
+ASGNI4
+ADDRGP4 s_demos+416+88
+CNSTI4 98
+ASGNI4
+ADDRGP4 $115
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_demos+416+64
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 $118
+ARGP4
+ADDRLP4 52
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_demos+416+72
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRGP4 s_demos+416+52
+ADDRGP4 Demos_MenuEvent
+ASGNP4
+ADDRGP4 s_demos+416+12
+CNSTI4 14
+ASGNI4
+ADDRGP4 s_demos+524
+CNSTI4 11
+ASGNI4
+ADDRGP4 s_demos+524+76
+CNSTI4 96
+ASGNI4
+ADDRGP4 s_demos+524+80
+CNSTI4 422
+ASGNI4
+ADDRGP4 s_demos+524+84
+CNSTI4 38
+ASGNI4
+ADDRGP4 s_demos+524+88
+CNSTI4 98
+ASGNI4
+ADDRGP4 $134
+ARGP4
+ADDRLP4 56
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_demos+524+64
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 $137
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_demos+524+72
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 s_demos+524+52
+ADDRGP4 Demos_MenuEvent
+ASGNP4
+ADDRGP4 s_demos+524+12
+CNSTI4 13
+ASGNI4
+ADDRGP4 s_demos+632
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_demos+632+4
+ADDRGP4 $145
+ASGNP4
+ADDRGP4 s_demos+632+48
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_demos+632+16
+CNSTI4 8
+ASGNI4
+ADDRGP4 s_demos+632+20
+CNSTI4 440
+ASGNI4
+ADDRGP4 s_demos+632+12
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_demos+632+52
+ADDRGP4 Demos_MenuEvent
+ASGNP4
+ADDRGP4 s_demos+632+80
+CNSTI4 80
+ASGNI4
+ADDRGP4 s_demos+632+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_demos+632+64
+ADDRGP4 $162
+ASGNP4
+ADDRGP4 s_demos+632+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_demos+728
+CNSTI4 11
+ASGNI4
+ADDRGP4 s_demos+728+76
+CNSTI4 84
+ASGNI4
+ADDRGP4 s_demos+728+80
+CNSTI4 350
+ASGNI4
+ADDRGP4 s_demos+728+84
+CNSTI4 63
+ASGNI4
+ADDRGP4 s_demos+728+88
+CNSTI4 63
+ASGNI4
+ADDRGP4 $176
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_demos+728+64
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRGP4 $179
+ARGP4
+ADDRLP4 68
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_demos+728+72
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRGP4 s_demos+728+52
+ADDRGP4 Demos_MenuEvent
+ASGNP4
+ADDRGP4 s_demos+728+12
+CNSTI4 11
+ASGNI4
+ADDRGP4 s_demos+296
+CNSTI4 8
+ASGNI4
+ADDRGP4 s_demos+296+48
+CNSTU4 256
+ASGNU4
+ADDRGP4 s_demos+296+52
+ADDRGP4 Demos_MenuEvent
+ASGNP4
+ADDRGP4 s_demos+296+12
+CNSTI4 12
+ASGNI4
+ADDRGP4 s_demos+296+16
+CNSTI4 100
+ASGNI4
+ADDRGP4 s_demos+296+20
+CNSTI4 60
+ASGNI4
+ADDRGP4 s_demos+296+84
+CNSTI4 28
+ASGNI4
+ADDRGP4 s_demos+296+88
+CNSTI4 20
+ASGNI4
+ADDRGP4 s_demos+296+92
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRGP4 s_demos+836
+ASGNP4
+ADDRGP4 s_demos+296+80
+ADDRGP4 s_demos+33604
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $206
+JUMPV
+LABELV $205
+ADDRLP4 16
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $208
+ARGP4
+ADDRGP4 $209
+ARGP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 demo_protocols
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $210
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTU4 32768
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 s_demos+836
+CVPU4 4
+SUBU4
+CVUI4 4
+CVIU4 4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRLP4 80
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $217
+JUMPV
+LABELV $214
+ADDRLP4 88
+ADDRGP4 s_demos+296+72
+ASGNP4
+ADDRLP4 84
+ADDRLP4 88
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 84
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_demos+296+80
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 92
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRGP4 s_demos+296+72
+INDIRI4
+CNSTI4 1024
+LTI4 $222
+ADDRGP4 $216
+JUMPV
+LABELV $222
+LABELV $215
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $217
+ADDRLP4 4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+LTI4 $214
+LABELV $216
+ADDRGP4 s_demos+296+72
+INDIRI4
+CNSTI4 1024
+LTI4 $226
+ADDRGP4 $207
+JUMPV
+LABELV $226
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $206
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 demo_protocols
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $205
+LABELV $207
+ADDRGP4 s_demos+296+72
+INDIRI4
+CNSTI4 0
+NEI4 $230
+ADDRGP4 s_demos+296+80
+INDIRP4
+ADDRGP4 $236
+ASGNP4
+ADDRGP4 s_demos+296+72
+CNSTI4 1
+ASGNI4
+ADDRLP4 72
+ADDRGP4 s_demos+728+48
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+LABELV $230
+ADDRGP4 s_demos+296+80
+INDIRP4
+ARGP4
+ADDRGP4 s_demos+296+72
+INDIRI4
+CVIU4 4
+ARGU4
+CNSTU4 4
+ARGU4
+ADDRGP4 UI_SortDemos
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+ADDRGP4 s_demos
+ARGP4
+ADDRGP4 s_demos+296
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_demos
+ARGP4
+ADDRGP4 s_demos+416
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_demos
+ARGP4
+ADDRGP4 s_demos+524
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_demos
+ARGP4
+ADDRGP4 s_demos+632
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_demos
+ARGP4
+ADDRGP4 s_demos+728
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $99
+endproc Demos_MenuInit 96 20
+export Demos_Cache
+proc Demos_Cache 0 4
+ADDRGP4 $145
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $162
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $176
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $179
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $115
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $118
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $134
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $137
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $252
+endproc Demos_Cache 0 4
+export UI_DemosMenu
+proc UI_DemosMenu 0 4
+ADDRGP4 Demos_MenuInit
+CALLV
+pop
+ADDRGP4 s_demos
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $253
+endproc UI_DemosMenu 0 4
+bss
+align 4
+LABELV s_demos
+skip 37700
+import UI_HelpMenu_Cache
+import UI_HelpMenu_f
+import UI_HelpMenu
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import UI_InitGameinfo
+import UI_GetNumBots
+import UI_GetBotInfoByNumber
+import UI_GetNumArenas
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_VoiceIngame
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_GetVoiceGainClient
+import trap_GetVoiceMuteAll
+import trap_GetVoiceMuteClient
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_CIN_SetExtents
+import trap_CIN_StopCinematic
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_PlayCinematic
+import trap_RealTime
+import trap_S_StartBackgroundTrack
+import trap_S_StopBackgroundTrack
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_SaveCachedServers
+import trap_LAN_LoadCachedServers
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import BotListCompare
+import uis
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString2
+import UI_AutoWrappedString_LineCount
+import UI_DrawString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawIngameBG
+import UI_DrawStringNS
+import UI_ModelIcon
+import UI_DrawHandlePic1024
+import UI_AdjustFrom1024
+import UI_StopMusic
+import UI_StartCreditMusic
+import UI_StartMusic
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_ClearModelCache
+import UI_PrecacheClientModelname
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import UI_SpecifyPasswordMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import SetDefaultBinds_onUnusedKeys
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import SetupDefaultMenu_Cache
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import Music_NextTrack
+import Music_TriggerRestart
+import Music_Check
+import MusicMenu_Cache
+import MusicMenu_Open
+import MusicMenu_Shutdown
+import MusicMenu_Init
+import UI_CallVoteMenu
+import UI_InGameMenu
+import InGame_Cache
+import UI_SecretMenu
+import UI_InitBigCredits
+import UI_BigCredits_Cache
+import UI_CreditMenu
+import ExitMenu_Cache
+import ExitMenu_Init
+import UI_MainMenu
+import MainMenu_Cache
+import UI_UpdateCvars
+import UI_RegisterCvars
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import listbar_bluecolor
+import text_color_bluehighlight
+import text_color_bluenormal
+import text_color_ighighlight
+import text_color_ignormal
+import listbar_igcolor
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_lightOrange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_click_sound
+import menu_switch_sound
+import menu_move_sound
+import ScrollList_Key
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import wop_AutoBindUnusedKeys
+import wop_AutoswitchSongByNextMap
+import con_notifytime
+import s_wop_restarted
+import syc_logo
+import spraycolor
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_createGametype
+import ui_browserHidePrivate
+import ui_browserOnlyHumans
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $236
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 115
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $210
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $209
+byte 1 100
+byte 1 109
+byte 1 95
+byte 1 0
+align 1
+LABELV $208
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $179
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 49
+byte 1 0
+align 1
+LABELV $176
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 48
+byte 1 0
+align 1
+LABELV $162
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 66
+byte 1 116
+byte 1 110
+byte 1 66
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 49
+byte 1 0
+align 1
+LABELV $145
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 66
+byte 1 116
+byte 1 110
+byte 1 66
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 48
+byte 1 0
+align 1
+LABELV $137
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 49
+byte 1 0
+align 1
+LABELV $134
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 48
+byte 1 0
+align 1
+LABELV $118
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 117
+byte 1 112
+byte 1 49
+byte 1 0
+align 1
+LABELV $115
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 117
+byte 1 112
+byte 1 48
+byte 1 0
+align 1
+LABELV $85
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
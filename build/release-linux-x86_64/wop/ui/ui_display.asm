@@ -0,0 +1,2237 @@
+data
+align 4
+LABELV anaglyph_names
+address $78
+address $79
+address $80
+address $81
+address $82
+address $83
+address $84
+byte 4 0
+code
+proc ApplyPressed 4 8
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $86
+ADDRGP4 $85
+JUMPV
+LABELV $86
+ADDRGP4 $88
+ARGP4
+ADDRGP4 displayOptionsInfo+680+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $91
+ARGP4
+ADDRGP4 displayOptionsInfo+948+72
+INDIRF4
+CNSTF4 1120403456
+DIVF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 displayOptionsInfo+1028+48
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+CNSTI4 2
+ARGI4
+ADDRGP4 $96
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $85
+endproc ApplyPressed 4 8
+proc UI_DisplayOptionsMenu_Event 12 8
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $98
+ADDRGP4 $97
+JUMPV
+LABELV $98
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LTI4 $100
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+GTI4 $100
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $124-40
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $124
+address $104
+address $101
+address $105
+address $106
+address $107
+address $111
+address $101
+address $112
+address $101
+code
+LABELV $104
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_GraphicsOptionsMenu
+CALLV
+pop
+ADDRGP4 $101
+JUMPV
+LABELV $105
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_SoundOptionsMenu
+CALLV
+pop
+ADDRGP4 $101
+JUMPV
+LABELV $106
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_NetworkOptionsMenu
+CALLV
+pop
+ADDRGP4 $101
+JUMPV
+LABELV $107
+ADDRGP4 $108
+ARGP4
+ADDRGP4 displayOptionsInfo+748+72
+INDIRF4
+CNSTF4 1092616192
+DIVF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $101
+JUMPV
+LABELV $111
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $101
+JUMPV
+LABELV $112
+ADDRGP4 $113
+ARGP4
+ADDRGP4 displayOptionsInfo+828+68
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 displayOptionsInfo+828+68
+INDIRI4
+CNSTI4 0
+NEI4 $116
+ADDRLP4 8
+ADDRGP4 displayOptionsInfo+948+48
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRGP4 $101
+JUMPV
+LABELV $116
+ADDRLP4 8
+ADDRGP4 displayOptionsInfo+948+48
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+LABELV $100
+LABELV $101
+LABELV $97
+endproc UI_DisplayOptionsMenu_Event 12 8
+proc DisplayOptions_UpdateMenuItems 16 4
+ADDRLP4 0
+ADDRGP4 displayOptionsInfo+1028+48
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRGP4 $88
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ADDRGP4 displayOptionsInfo+680+64
+INDIRI4
+EQI4 $129
+ADDRLP4 8
+ADDRGP4 displayOptionsInfo+1028+48
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+ADDRGP4 $130
+JUMPV
+LABELV $129
+ADDRGP4 $91
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CVFI4 4
+CVIF4 4
+ADDRGP4 displayOptionsInfo+948+72
+INDIRF4
+EQF4 $135
+ADDRLP4 12
+ADDRGP4 displayOptionsInfo+1028+48
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $135
+LABELV $130
+LABELV $126
+endproc DisplayOptions_UpdateMenuItems 16 4
+proc DisplayOptions_MenuDraw 0 4
+ADDRGP4 DisplayOptions_UpdateMenuItems
+CALLV
+pop
+ADDRGP4 displayOptionsInfo
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+LABELV $141
+endproc DisplayOptions_MenuDraw 0 4
+proc UI_DisplayOptionsMenu_Init 36 12
+ADDRGP4 displayOptionsInfo
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1220
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 UI_DisplayOptionsMenu_Cache
+CALLV
+pop
+ADDRGP4 displayOptionsInfo+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 displayOptionsInfo+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 displayOptionsInfo+268
+ADDRGP4 DisplayOptions_MenuDraw
+ASGNP4
+ADDRGP4 displayOptionsInfo+284
+CNSTI4 32776
+ASGNI4
+ADDRGP4 displayOptionsInfo+296
+CNSTI4 6
+ASGNI4
+ADDRGP4 displayOptionsInfo+296+4
+ADDRGP4 $150
+ASGNP4
+ADDRGP4 displayOptionsInfo+296+48
+CNSTU4 132
+ASGNU4
+ADDRGP4 displayOptionsInfo+296+52
+ADDRGP4 UI_DisplayOptionsMenu_Event
+ASGNP4
+ADDRGP4 displayOptionsInfo+296+12
+CNSTI4 10
+ASGNI4
+ADDRGP4 displayOptionsInfo+296+16
+CNSTI4 26
+ASGNI4
+ADDRGP4 displayOptionsInfo+296+20
+CNSTI4 37
+ASGNI4
+ADDRGP4 displayOptionsInfo+296+80
+CNSTI4 130
+ASGNI4
+ADDRGP4 displayOptionsInfo+296+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 displayOptionsInfo+296+64
+ADDRGP4 $167
+ASGNP4
+ADDRGP4 displayOptionsInfo+296+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 displayOptionsInfo+392
+CNSTI4 6
+ASGNI4
+ADDRGP4 displayOptionsInfo+392+4
+ADDRGP4 $173
+ASGNP4
+ADDRGP4 displayOptionsInfo+392+48
+CNSTU4 68
+ASGNU4
+ADDRGP4 displayOptionsInfo+392+52
+ADDRGP4 UI_DisplayOptionsMenu_Event
+ASGNP4
+ADDRGP4 displayOptionsInfo+392+12
+CNSTI4 11
+ASGNI4
+ADDRGP4 displayOptionsInfo+392+16
+CNSTI4 159
+ASGNI4
+ADDRGP4 displayOptionsInfo+392+20
+CNSTI4 30
+ASGNI4
+ADDRGP4 displayOptionsInfo+392+80
+CNSTI4 122
+ASGNI4
+ADDRGP4 displayOptionsInfo+392+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 displayOptionsInfo+392+64
+ADDRGP4 $190
+ASGNP4
+ADDRGP4 displayOptionsInfo+392+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 displayOptionsInfo+488
+CNSTI4 6
+ASGNI4
+ADDRGP4 displayOptionsInfo+488+4
+ADDRGP4 $196
+ASGNP4
+ADDRGP4 displayOptionsInfo+488+48
+CNSTU4 132
+ASGNU4
+ADDRGP4 displayOptionsInfo+488+52
+ADDRGP4 UI_DisplayOptionsMenu_Event
+ASGNP4
+ADDRGP4 displayOptionsInfo+488+12
+CNSTI4 12
+ASGNI4
+ADDRGP4 displayOptionsInfo+488+16
+CNSTI4 40
+ASGNI4
+ADDRGP4 displayOptionsInfo+488+20
+CNSTI4 77
+ASGNI4
+ADDRGP4 displayOptionsInfo+488+80
+CNSTI4 130
+ASGNI4
+ADDRGP4 displayOptionsInfo+488+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 displayOptionsInfo+488+64
+ADDRGP4 $213
+ASGNP4
+ADDRGP4 displayOptionsInfo+488+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 displayOptionsInfo+584
+CNSTI4 6
+ASGNI4
+ADDRGP4 displayOptionsInfo+584+4
+ADDRGP4 $219
+ASGNP4
+ADDRGP4 displayOptionsInfo+584+48
+CNSTU4 132
+ASGNU4
+ADDRGP4 displayOptionsInfo+584+52
+ADDRGP4 UI_DisplayOptionsMenu_Event
+ASGNP4
+ADDRGP4 displayOptionsInfo+584+12
+CNSTI4 13
+ASGNI4
+ADDRGP4 displayOptionsInfo+584+16
+CNSTI4 170
+ASGNI4
+ADDRGP4 displayOptionsInfo+584+20
+CNSTI4 80
+ASGNI4
+ADDRGP4 displayOptionsInfo+584+80
+CNSTI4 100
+ASGNI4
+ADDRGP4 displayOptionsInfo+584+84
+CNSTI4 45
+ASGNI4
+ADDRGP4 displayOptionsInfo+584+64
+ADDRGP4 $236
+ASGNP4
+ADDRGP4 displayOptionsInfo+584+92
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+CNSTI4 230
+ASGNI4
+ADDRGP4 displayOptionsInfo+680
+CNSTI4 5
+ASGNI4
+ADDRGP4 displayOptionsInfo+680+4
+ADDRGP4 $242
+ASGNP4
+ADDRGP4 displayOptionsInfo+680+48
+CNSTU4 2
+ASGNU4
+ADDRGP4 displayOptionsInfo+680+52
+ADDRGP4 UI_DisplayOptionsMenu_Event
+ASGNP4
+ADDRGP4 displayOptionsInfo+680+12
+CNSTI4 16
+ASGNI4
+ADDRGP4 displayOptionsInfo+680+16
+CNSTI4 175
+ASGNI4
+ADDRGP4 displayOptionsInfo+680+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $88
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 displayOptionsInfo+680+64
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 displayOptionsInfo+680+8
+ADDRGP4 $257
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 displayOptionsInfo+748
+CNSTI4 1
+ASGNI4
+ADDRGP4 displayOptionsInfo+748+4
+ADDRGP4 $261
+ASGNP4
+ADDRGP4 displayOptionsInfo+748+48
+CNSTU4 2
+ASGNU4
+ADDRGP4 displayOptionsInfo+748+52
+ADDRGP4 UI_DisplayOptionsMenu_Event
+ASGNP4
+ADDRGP4 displayOptionsInfo+748+12
+CNSTI4 14
+ASGNI4
+ADDRGP4 displayOptionsInfo+748+16
+CNSTI4 175
+ASGNI4
+ADDRGP4 displayOptionsInfo+748+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 displayOptionsInfo+748+64
+CNSTF4 1084227584
+ASGNF4
+ADDRGP4 displayOptionsInfo+748+68
+CNSTF4 1101004800
+ASGNF4
+ADDRGP4 uis+56+11292
+INDIRI4
+CNSTI4 0
+NEI4 $276
+ADDRLP4 8
+ADDRGP4 displayOptionsInfo+748+48
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+LABELV $276
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 34
+ADDI4
+ASGNI4
+ADDRGP4 displayOptionsInfo+828
+CNSTI4 3
+ASGNI4
+ADDRGP4 displayOptionsInfo+828+4
+ADDRGP4 $285
+ASGNP4
+ADDRGP4 displayOptionsInfo+828+48
+CNSTU4 2
+ASGNU4
+ADDRGP4 displayOptionsInfo+828+52
+ADDRGP4 UI_DisplayOptionsMenu_Event
+ASGNP4
+ADDRGP4 displayOptionsInfo+828+12
+CNSTI4 17
+ASGNI4
+ADDRGP4 displayOptionsInfo+828+16
+CNSTI4 175
+ASGNI4
+ADDRGP4 displayOptionsInfo+828+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 displayOptionsInfo+828+80
+ADDRGP4 anaglyph_names
+ASGNP4
+ADDRGP4 displayOptionsInfo+828+8
+ADDRGP4 $300
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 displayOptionsInfo+948
+CNSTI4 1
+ASGNI4
+ADDRGP4 displayOptionsInfo+948+4
+ADDRGP4 $304
+ASGNP4
+ADDRGP4 displayOptionsInfo+948+48
+CNSTU4 2
+ASGNU4
+ADDRGP4 displayOptionsInfo+948+52
+ADDRGP4 UI_DisplayOptionsMenu_Event
+ASGNP4
+ADDRGP4 displayOptionsInfo+948+12
+CNSTI4 18
+ASGNI4
+ADDRGP4 displayOptionsInfo+948+16
+CNSTI4 175
+ASGNI4
+ADDRGP4 displayOptionsInfo+948+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 displayOptionsInfo+948+64
+CNSTF4 0
+ASGNF4
+ADDRGP4 displayOptionsInfo+948+68
+CNSTF4 1120403456
+ASGNF4
+ADDRGP4 displayOptionsInfo+1028
+CNSTI4 6
+ASGNI4
+ADDRGP4 displayOptionsInfo+1028+4
+ADDRGP4 $322
+ASGNP4
+ADDRGP4 displayOptionsInfo+1028+48
+CNSTU4 20736
+ASGNU4
+ADDRGP4 displayOptionsInfo+1028+52
+ADDRGP4 ApplyPressed
+ASGNP4
+ADDRGP4 displayOptionsInfo+1028+16
+CNSTI4 516
+ASGNI4
+ADDRGP4 displayOptionsInfo+1028+20
+CNSTI4 405
+ASGNI4
+ADDRGP4 displayOptionsInfo+1028+80
+CNSTI4 102
+ASGNI4
+ADDRGP4 displayOptionsInfo+1028+84
+CNSTI4 61
+ASGNI4
+ADDRGP4 displayOptionsInfo+1028+64
+ADDRGP4 $322
+ASGNP4
+ADDRGP4 displayOptionsInfo+1124
+CNSTI4 6
+ASGNI4
+ADDRGP4 displayOptionsInfo+1124+4
+ADDRGP4 $340
+ASGNP4
+ADDRGP4 displayOptionsInfo+1124+48
+CNSTU4 260
+ASGNU4
+ADDRGP4 displayOptionsInfo+1124+52
+ADDRGP4 UI_DisplayOptionsMenu_Event
+ASGNP4
+ADDRGP4 displayOptionsInfo+1124+12
+CNSTI4 15
+ASGNI4
+ADDRGP4 displayOptionsInfo+1124+16
+CNSTI4 9
+ASGNI4
+ADDRGP4 displayOptionsInfo+1124+20
+CNSTI4 440
+ASGNI4
+ADDRGP4 displayOptionsInfo+1124+80
+CNSTI4 80
+ASGNI4
+ADDRGP4 displayOptionsInfo+1124+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 displayOptionsInfo+1124+64
+ADDRGP4 $357
+ASGNP4
+ADDRGP4 displayOptionsInfo+1124+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 displayOptionsInfo
+ARGP4
+ADDRGP4 displayOptionsInfo+296
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 displayOptionsInfo
+ARGP4
+ADDRGP4 displayOptionsInfo+392
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 displayOptionsInfo
+ARGP4
+ADDRGP4 displayOptionsInfo+488
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 displayOptionsInfo
+ARGP4
+ADDRGP4 displayOptionsInfo+584
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 displayOptionsInfo
+ARGP4
+ADDRGP4 displayOptionsInfo+680
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 displayOptionsInfo
+ARGP4
+ADDRGP4 displayOptionsInfo+748
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 displayOptionsInfo
+ARGP4
+ADDRGP4 displayOptionsInfo+828
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 displayOptionsInfo
+ARGP4
+ADDRGP4 displayOptionsInfo+948
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 displayOptionsInfo
+ARGP4
+ADDRGP4 displayOptionsInfo+1028
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 displayOptionsInfo
+ARGP4
+ADDRGP4 displayOptionsInfo+1124
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 $108
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 displayOptionsInfo+748+72
+CNSTF4 1092616192
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $113
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1088421888
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 displayOptionsInfo+828+68
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $91
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1120403456
+ARGF4
+CNSTF4 1120403456
+ADDRLP4 24
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 displayOptionsInfo+948+72
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRGP4 displayOptionsInfo+828+68
+INDIRI4
+CNSTI4 0
+NEI4 $376
+ADDRLP4 32
+ADDRGP4 displayOptionsInfo+948+48
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+LABELV $376
+LABELV $142
+endproc UI_DisplayOptionsMenu_Init 36 12
+export UI_DisplayOptionsMenu_Cache
+proc UI_DisplayOptionsMenu_Cache 0 4
+ADDRGP4 $340
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $357
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $150
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $167
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $173
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $190
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $196
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $213
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $219
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $236
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $382
+endproc UI_DisplayOptionsMenu_Cache 0 4
+export UI_DisplayOptionsMenu
+proc UI_DisplayOptionsMenu 0 8
+ADDRGP4 UI_DisplayOptionsMenu_Init
+CALLV
+pop
+ADDRGP4 displayOptionsInfo
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+ADDRGP4 displayOptionsInfo
+ARGP4
+ADDRGP4 displayOptionsInfo+392
+ARGP4
+ADDRGP4 Menu_SetCursorToItem
+CALLV
+pop
+LABELV $383
+endproc UI_DisplayOptionsMenu 0 8
+bss
+align 4
+LABELV displayOptionsInfo
+skip 1220
+import UI_HelpMenu_Cache
+import UI_HelpMenu_f
+import UI_HelpMenu
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import UI_InitGameinfo
+import UI_GetNumBots
+import UI_GetBotInfoByNumber
+import UI_GetNumArenas
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_VoiceIngame
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_GetVoiceGainClient
+import trap_GetVoiceMuteAll
+import trap_GetVoiceMuteClient
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_CIN_SetExtents
+import trap_CIN_StopCinematic
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_PlayCinematic
+import trap_RealTime
+import trap_S_StartBackgroundTrack
+import trap_S_StopBackgroundTrack
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_SaveCachedServers
+import trap_LAN_LoadCachedServers
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import BotListCompare
+import uis
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString2
+import UI_AutoWrappedString_LineCount
+import UI_DrawString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawIngameBG
+import UI_DrawStringNS
+import UI_ModelIcon
+import UI_DrawHandlePic1024
+import UI_AdjustFrom1024
+import UI_StopMusic
+import UI_StartCreditMusic
+import UI_StartMusic
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_ClearModelCache
+import UI_PrecacheClientModelname
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import UI_SpecifyPasswordMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import Demos_Cache
+import UI_DemosMenu
+import SetDefaultBinds_onUnusedKeys
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import SetupDefaultMenu_Cache
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import Music_NextTrack
+import Music_TriggerRestart
+import Music_Check
+import MusicMenu_Cache
+import MusicMenu_Open
+import MusicMenu_Shutdown
+import MusicMenu_Init
+import UI_CallVoteMenu
+import UI_InGameMenu
+import InGame_Cache
+import UI_SecretMenu
+import UI_InitBigCredits
+import UI_BigCredits_Cache
+import UI_CreditMenu
+import ExitMenu_Cache
+import ExitMenu_Init
+import UI_MainMenu
+import MainMenu_Cache
+import UI_UpdateCvars
+import UI_RegisterCvars
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import listbar_bluecolor
+import text_color_bluehighlight
+import text_color_bluenormal
+import text_color_ighighlight
+import text_color_ignormal
+import listbar_igcolor
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_lightOrange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_click_sound
+import menu_switch_sound
+import menu_move_sound
+import ScrollList_Key
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import wop_AutoBindUnusedKeys
+import wop_AutoswitchSongByNextMap
+import con_notifytime
+import s_wop_restarted
+import syc_logo
+import spraycolor
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_createGametype
+import ui_browserHidePrivate
+import ui_browserOnlyHumans
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $357
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 66
+byte 1 116
+byte 1 110
+byte 1 66
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 49
+byte 1 0
+align 1
+LABELV $340
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 66
+byte 1 116
+byte 1 110
+byte 1 66
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 48
+byte 1 0
+align 1
+LABELV $322
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 47
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 0
+align 1
+LABELV $304
+byte 1 71
+byte 1 114
+byte 1 101
+byte 1 121
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $300
+byte 1 83
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 51
+byte 1 68
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 111
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 32
+byte 1 69
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 103
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 111
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 107
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 46
+byte 1 0
+align 1
+LABELV $285
+byte 1 83
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 111
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 51
+byte 1 68
+byte 1 58
+byte 1 0
+align 1
+LABELV $261
+byte 1 66
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 58
+byte 1 0
+align 1
+LABELV $257
+byte 1 73
+byte 1 102
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 119
+byte 1 111
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 106
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 46
+byte 1 32
+byte 1 73
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 106
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 102
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 114
+byte 1 121
+byte 1 46
+byte 1 0
+align 1
+LABELV $242
+byte 1 73
+byte 1 103
+byte 1 110
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 72
+byte 1 87
+byte 1 45
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 58
+byte 1 0
+align 1
+LABELV $236
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 47
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 107
+byte 1 49
+byte 1 0
+align 1
+LABELV $219
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 47
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 107
+byte 1 48
+byte 1 0
+align 1
+LABELV $213
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 47
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 49
+byte 1 0
+align 1
+LABELV $196
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 47
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 48
+byte 1 0
+align 1
+LABELV $190
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 47
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 49
+byte 1 0
+align 1
+LABELV $173
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 47
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 48
+byte 1 0
+align 1
+LABELV $167
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 49
+byte 1 0
+align 1
+LABELV $150
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 48
+byte 1 0
+align 1
+LABELV $113
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 110
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 121
+byte 1 112
+byte 1 104
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $108
+byte 1 114
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 0
+align 1
+LABELV $96
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $91
+byte 1 114
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 121
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $88
+byte 1 114
+byte 1 95
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 104
+byte 1 119
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 0
+align 1
+LABELV $84
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 45
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $83
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 45
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $82
+byte 1 99
+byte 1 121
+byte 1 97
+byte 1 110
+byte 1 45
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $81
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 45
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $80
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 45
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $79
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 45
+byte 1 99
+byte 1 121
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $78
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 0
@@ -0,0 +1,3306 @@
+code
+proc UI_Alloc 12 0
+ADDRGP4 allocPoint
+INDIRI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+CNSTI4 131072
+LEI4 $78
+ADDRGP4 outOfMemory
+CNSTI4 1
+ASGNI4
+CNSTP4 0
+RETP4
+ADDRGP4 $77
+JUMPV
+LABELV $78
+ADDRLP4 4
+ADDRGP4 allocPoint
+ASGNP4
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRGP4 memoryPool
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 31
+ADDI4
+CNSTI4 -32
+BANDI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $77
+endproc UI_Alloc 12 0
+proc UI_InitMemory 4 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 allocPoint
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 outOfMemory
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $80
+endproc UI_InitMemory 4 0
+proc UI_ParseInfos 2080 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 2052
+CNSTI4 0
+ASGNI4
+ADDRGP4 $83
+JUMPV
+LABELV $82
+ADDRFP4 0
+ARGP4
+ADDRLP4 2056
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2056
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $85
+ADDRGP4 $84
+JUMPV
+LABELV $85
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $89
+ARGP4
+ADDRLP4 2060
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 2060
+INDIRI4
+CNSTI4 0
+EQI4 $87
+ADDRGP4 $90
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $84
+JUMPV
+LABELV $87
+ADDRLP4 2052
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $91
+ADDRGP4 $93
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $84
+JUMPV
+LABELV $91
+ADDRLP4 1028
+CNSTI1 0
+ASGNI1
+ADDRGP4 $95
+JUMPV
+LABELV $94
+ADDRFP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 2064
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2064
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $97
+ADDRGP4 $99
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $96
+JUMPV
+LABELV $97
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $102
+ARGP4
+ADDRLP4 2068
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 2068
+INDIRI4
+CNSTI4 0
+NEI4 $100
+ADDRGP4 $96
+JUMPV
+LABELV $100
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 2072
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2072
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $103
+ADDRLP4 1028
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $105
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRGP4 $104
+JUMPV
+LABELV $103
+ADDRLP4 1028
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+LABELV $104
+LABELV $95
+ADDRGP4 $94
+JUMPV
+LABELV $96
+ADDRLP4 1028
+ARGP4
+ADDRLP4 2064
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRGP4 $106
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 2068
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 2068
+INDIRP4
+ARGP4
+ADDRLP4 2072
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 2064
+INDIRU4
+ADDRLP4 2072
+INDIRU4
+ADDU4
+CNSTU4 1
+ADDU4
+CVUI4 4
+ARGI4
+ADDRLP4 2076
+ADDRGP4 UI_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 2052
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 2076
+INDIRP4
+ASGNP4
+ADDRLP4 2052
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $107
+ADDRLP4 2052
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1028
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 2052
+ADDRLP4 2052
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $107
+LABELV $83
+ADDRGP4 $82
+JUMPV
+LABELV $84
+ADDRLP4 2052
+INDIRI4
+RETI4
+LABELV $81
+endproc UI_ParseInfos 2080 12
+proc UI_LoadArenasFromFile 8216 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8200
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8200
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $110
+ADDRGP4 $112
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8204
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRGP4 $109
+JUMPV
+LABELV $110
+ADDRLP4 0
+INDIRI4
+CNSTI4 8192
+LTI4 $113
+ADDRGP4 $115
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 8192
+ARGI4
+ADDRLP4 8204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8204
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 $109
+JUMPV
+LABELV $113
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 8204
+ADDRGP4 ui_numArenas
+ASGNP4
+ADDRLP4 8208
+ADDRLP4 8204
+INDIRP4
+INDIRI4
+ASGNI4
+CNSTI4 1024
+ADDRLP4 8208
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 8208
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+ARGP4
+ADDRLP4 8212
+ADDRGP4 UI_ParseInfos
+CALLI4
+ASGNI4
+ADDRLP4 8204
+INDIRP4
+ADDRLP4 8208
+INDIRI4
+ADDRLP4 8212
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $109
+endproc UI_LoadArenasFromFile 8216 16
+proc UI_LoadArenas 2528 16
+ADDRGP4 ui_numArenas
+CNSTI4 0
+ASGNI4
+ADDRLP4 168
+ARGP4
+ADDRGP4 $117
+ARGP4
+ADDRGP4 $118
+ARGP4
+CNSTI4 80
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 168+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $119
+ADDRLP4 168+16
+ARGP4
+ADDRGP4 UI_LoadArenasFromFile
+CALLV
+pop
+LABELV $119
+ADDRGP4 $123
+ARGP4
+ADDRGP4 $124
+ARGP4
+ADDRLP4 440
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRLP4 2488
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 152
+ADDRLP4 2488
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 440
+ASGNP4
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRGP4 $128
+JUMPV
+LABELV $125
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 2492
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 144
+ADDRLP4 2492
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 $129
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 12
+ARGP4
+ADDRGP4 UI_LoadArenasFromFile
+CALLV
+pop
+LABELV $126
+ADDRLP4 2492
+CNSTI4 1
+ASGNI4
+ADDRLP4 140
+ADDRLP4 140
+INDIRI4
+ADDRLP4 2492
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 144
+INDIRI4
+ADDRLP4 2492
+INDIRI4
+ADDI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $128
+ADDRLP4 140
+INDIRI4
+ADDRLP4 152
+INDIRI4
+LTI4 $125
+ADDRGP4 $130
+ARGP4
+ADDRGP4 ui_numArenas
+INDIRI4
+ARGI4
+ADDRLP4 2496
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 2496
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRGP4 outOfMemory
+INDIRI4
+CNSTI4 0
+EQI4 $131
+ADDRGP4 $133
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $131
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $137
+JUMPV
+LABELV $134
+ADDRGP4 $139
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 2500
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $138
+ARGP4
+ADDRLP4 2500
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+LABELV $135
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $137
+ADDRLP4 0
+INDIRI4
+ADDRGP4 ui_numArenas
+INDIRI4
+LTI4 $134
+ADDRLP4 2500
+CNSTI4 0
+ASGNI4
+ADDRGP4 ui_numSinglePlayerArenas
+ADDRLP4 2500
+INDIRI4
+ASGNI4
+ADDRGP4 ui_numSpecialSinglePlayerArenas
+ADDRLP4 2500
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 2500
+INDIRI4
+ASGNI4
+ADDRGP4 $143
+JUMPV
+LABELV $140
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $144
+ARGP4
+ADDRLP4 2504
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 2504
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $145
+ADDRGP4 $141
+JUMPV
+LABELV $145
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $149
+ARGP4
+ADDRLP4 2508
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 2508
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $147
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $150
+ARGP4
+ADDRLP4 2512
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 148
+ADDRLP4 2512
+INDIRP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $151
+ADDRLP4 2516
+ADDRGP4 ui_numSpecialSinglePlayerArenas
+ASGNP4
+ADDRLP4 2516
+INDIRP4
+ADDRLP4 2516
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $141
+JUMPV
+LABELV $151
+ADDRLP4 2516
+ADDRGP4 ui_numSinglePlayerArenas
+ASGNP4
+ADDRLP4 2516
+INDIRP4
+ADDRLP4 2516
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $147
+LABELV $141
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $143
+ADDRLP4 0
+INDIRI4
+ADDRGP4 ui_numArenas
+INDIRI4
+LTI4 $140
+ADDRLP4 0
+ADDRGP4 ui_numSinglePlayerArenas
+INDIRI4
+CNSTI4 4
+MODI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $153
+ADDRLP4 2504
+ADDRGP4 ui_numSinglePlayerArenas
+ASGNP4
+ADDRLP4 2504
+INDIRP4
+ADDRLP4 2504
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $155
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 2512
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 2512
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $153
+ADDRLP4 2504
+CNSTI4 0
+ASGNI4
+ADDRLP4 160
+ADDRLP4 2504
+INDIRI4
+ASGNI4
+ADDRLP4 164
+ADDRLP4 160
+INDIRI4
+ADDRGP4 ui_numSinglePlayerArenas
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 156
+ADDRLP4 164
+INDIRI4
+ADDRGP4 ui_numSpecialSinglePlayerArenas
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 2504
+INDIRI4
+ASGNI4
+ADDRGP4 $159
+JUMPV
+LABELV $156
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $144
+ARGP4
+ADDRLP4 2508
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 2508
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $160
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $149
+ARGP4
+ADDRLP4 2512
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 2512
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $162
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $150
+ARGP4
+ADDRLP4 2516
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 148
+ADDRLP4 2516
+INDIRP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $164
+ADDRGP4 $139
+ARGP4
+ADDRLP4 2520
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRLP4 164
+ADDRLP4 2520
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 2520
+INDIRI4
+ARGI4
+ADDRLP4 2524
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $138
+ARGP4
+ADDRLP4 2524
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRGP4 $157
+JUMPV
+LABELV $164
+ADDRGP4 $139
+ARGP4
+ADDRLP4 2520
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRLP4 160
+ADDRLP4 2520
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 2520
+INDIRI4
+ARGI4
+ADDRLP4 2524
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $138
+ARGP4
+ADDRLP4 2524
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRGP4 $157
+JUMPV
+LABELV $162
+LABELV $160
+ADDRGP4 $139
+ARGP4
+ADDRLP4 2512
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRLP4 156
+ADDRLP4 2512
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 2512
+INDIRI4
+ARGI4
+ADDRLP4 2516
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $138
+ARGP4
+ADDRLP4 2516
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+LABELV $157
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $159
+ADDRLP4 0
+INDIRI4
+ADDRGP4 ui_numArenas
+INDIRI4
+LTI4 $156
+LABELV $116
+endproc UI_LoadArenas 2528 16
+export UI_GetArenaInfoByNumber
+proc UI_GetArenaInfoByNumber 24 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $169
+ADDRFP4 0
+INDIRI4
+ADDRGP4 ui_numArenas
+INDIRI4
+LTI4 $167
+LABELV $169
+ADDRGP4 $170
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $166
+JUMPV
+LABELV $167
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $174
+JUMPV
+LABELV $171
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $138
+ARGP4
+ADDRLP4 12
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $175
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $175
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $166
+JUMPV
+LABELV $175
+LABELV $172
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $174
+ADDRLP4 0
+INDIRI4
+ADDRGP4 ui_numArenas
+INDIRI4
+LTI4 $171
+CNSTP4 0
+RETP4
+LABELV $166
+endproc UI_GetArenaInfoByNumber 24 8
+proc UI_LoadBotsFromFile 8216 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8200
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8200
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $178
+ADDRGP4 $112
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8204
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRGP4 $177
+JUMPV
+LABELV $178
+ADDRLP4 0
+INDIRI4
+CNSTI4 8192
+LTI4 $180
+ADDRGP4 $115
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 8192
+ARGI4
+ADDRLP4 8204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8204
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 $177
+JUMPV
+LABELV $180
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 8204
+ADDRGP4 ui_numBots
+ASGNP4
+ADDRLP4 8208
+ADDRLP4 8204
+INDIRP4
+INDIRI4
+ASGNI4
+CNSTI4 1024
+ADDRLP4 8208
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 8208
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_botInfos
+ADDP4
+ARGP4
+ADDRLP4 8212
+ADDRGP4 UI_ParseInfos
+CALLI4
+ASGNI4
+ADDRLP4 8204
+INDIRP4
+ADDRLP4 8208
+INDIRI4
+ADDRLP4 8212
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 outOfMemory
+INDIRI4
+CNSTI4 0
+EQI4 $182
+ADDRGP4 $184
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $182
+LABELV $177
+endproc UI_LoadBotsFromFile 8216 16
+proc UI_LoadBots 1452 16
+ADDRGP4 ui_numBots
+CNSTI4 0
+ASGNI4
+ADDRLP4 144
+ARGP4
+ADDRGP4 $186
+ARGP4
+ADDRGP4 $118
+ARGP4
+CNSTI4 80
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 144+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $187
+ADDRLP4 144+16
+ARGP4
+ADDRGP4 UI_LoadBotsFromFile
+CALLV
+pop
+LABELV $187
+LABELV $188
+ADDRGP4 $123
+ARGP4
+ADDRGP4 $191
+ARGP4
+ADDRLP4 416
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1440
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 1440
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 416
+ASGNP4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $195
+JUMPV
+LABELV $192
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1444
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 136
+ADDRLP4 1444
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $129
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 UI_LoadBotsFromFile
+CALLV
+pop
+LABELV $193
+ADDRLP4 1444
+CNSTI4 1
+ASGNI4
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+ADDRLP4 1444
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 136
+INDIRI4
+ADDRLP4 1444
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $195
+ADDRLP4 132
+INDIRI4
+ADDRLP4 140
+INDIRI4
+LTI4 $192
+ADDRGP4 $196
+ARGP4
+ADDRGP4 ui_numBots
+INDIRI4
+ARGI4
+ADDRLP4 1448
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1448
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $185
+endproc UI_LoadBots 1452 16
+export UI_GetBotInfoByNumber
+proc UI_GetBotInfoByNumber 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $200
+ADDRFP4 0
+INDIRI4
+ADDRGP4 ui_numBots
+INDIRI4
+LTI4 $198
+LABELV $200
+ADDRGP4 $201
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $197
+JUMPV
+LABELV $198
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_botInfos
+ADDP4
+INDIRP4
+RETP4
+LABELV $197
+endproc UI_GetBotInfoByNumber 8 8
+export UI_GetNumArenas
+proc UI_GetNumArenas 0 0
+ADDRGP4 ui_numArenas
+INDIRI4
+RETI4
+LABELV $202
+endproc UI_GetNumArenas 0 0
+export UI_GetNumBots
+proc UI_GetNumBots 0 0
+ADDRGP4 ui_numBots
+INDIRI4
+RETI4
+LABELV $203
+endproc UI_GetNumBots 0 0
+proc UI_LoadLogoForMenu 12 12
+ADDRGP4 uis+13808
+INDIRI4
+CNSTI4 64
+LTI4 $205
+ADDRGP4 $204
+JUMPV
+LABELV $205
+ADDRGP4 uis+13808
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 uis+11504
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $214
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uis+13808
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uis+13552
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 uis+13808
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $204
+endproc UI_LoadLogoForMenu 12 12
+proc UI_SearchSpraylogos 2112 16
+ADDRGP4 $217
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 1040
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 2064
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 2064
+INDIRI4
+ASGNI4
+ADDRGP4 $218
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 12
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+ADDRLP4 1040
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $222
+JUMPV
+LABELV $219
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 46
+ARGI4
+ADDRLP4 2072
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 2068
+ADDRLP4 2072
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2076
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 2076
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $229
+ADDRLP4 2068
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $229
+ADDRLP4 2068
+INDIRP4
+ARGP4
+ADDRLP4 2084
+ADDRGP4 Q_strlwr
+CALLP4
+ASGNP4
+ADDRGP4 $225
+ARGP4
+ADDRLP4 2084
+INDIRP4
+ARGP4
+ADDRLP4 2088
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2088
+INDIRI4
+CNSTI4 0
+EQI4 $223
+ADDRLP4 2068
+INDIRP4
+ARGP4
+ADDRLP4 2092
+ADDRGP4 Q_strlwr
+CALLP4
+ASGNP4
+ADDRGP4 $226
+ARGP4
+ADDRLP4 2092
+INDIRP4
+ARGP4
+ADDRLP4 2096
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2096
+INDIRI4
+CNSTI4 0
+EQI4 $223
+ADDRLP4 2068
+INDIRP4
+ARGP4
+ADDRLP4 2100
+ADDRGP4 Q_strlwr
+CALLP4
+ASGNP4
+ADDRGP4 $227
+ARGP4
+ADDRLP4 2100
+INDIRP4
+ARGP4
+ADDRLP4 2104
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2104
+INDIRI4
+CNSTI4 0
+EQI4 $223
+LABELV $229
+ADDRGP4 $220
+JUMPV
+LABELV $223
+ADDRLP4 2068
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $230
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $231
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2108
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 2108
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_LoadLogoForMenu
+CALLV
+pop
+LABELV $220
+ADDRLP4 2068
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 2068
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ADDRLP4 2068
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $222
+ADDRLP4 8
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+LTI4 $219
+ADDRGP4 $232
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 2072
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 2072
+INDIRU4
+CNSTU4 1
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $233
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $233
+ADDRGP4 $235
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $216
+endproc UI_SearchSpraylogos 2112 16
+proc UI_SearchLensFlares 2112 16
+ADDRGP4 $237
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $123
+ARGP4
+ADDRGP4 $238
+ARGP4
+ADDRLP4 1072
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 2096
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 1068
+ADDRLP4 2096
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 1072
+ASGNP4
+ADDRLP4 44
+CNSTI1 0
+ASGNI1
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRGP4 $242
+JUMPV
+LABELV $239
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 2100
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 40
+ADDRLP4 2100
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $238
+ARGP4
+ADDRLP4 2104
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 2104
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $243
+ARGP4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $231
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 2108
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 2108
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $240
+ADDRLP4 2100
+CNSTI4 1
+ASGNI4
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+ADDRLP4 2100
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 40
+INDIRI4
+ADDRLP4 2100
+INDIRI4
+ADDI4
+ADDRLP4 36
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $242
+ADDRLP4 32
+INDIRI4
+ADDRLP4 1068
+INDIRI4
+LTI4 $239
+ADDRGP4 $244
+ARGP4
+ADDRLP4 1068
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 44
+ARGP4
+ADDRLP4 2104
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 32
+ADDRLP4 2104
+INDIRU4
+CNSTU4 1
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 44
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $245
+ADDRLP4 32
+INDIRI4
+ADDRLP4 44
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $245
+ADDRGP4 $247
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $236
+endproc UI_SearchLensFlares 2112 16
+export UI_InitGameinfo
+proc UI_InitGameinfo 4 4
+ADDRGP4 UI_InitMemory
+CALLV
+pop
+ADDRGP4 UI_LoadArenas
+CALLV
+pop
+ADDRGP4 UI_LoadBots
+CALLV
+pop
+ADDRGP4 UI_SearchSpraylogos
+CALLV
+pop
+ADDRGP4 UI_SearchLensFlares
+CALLV
+pop
+ADDRGP4 $251
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+NEF4 $252
+ADDRGP4 ui_numSpecialSinglePlayerArenas
+INDIRI4
+CNSTI4 0
+NEI4 $249
+ADDRGP4 ui_numSinglePlayerArenas
+INDIRI4
+CNSTI4 4
+NEI4 $249
+LABELV $252
+ADDRGP4 uis+13852
+CNSTI4 1
+ASGNI4
+ADDRGP4 $250
+JUMPV
+LABELV $249
+ADDRGP4 uis+13852
+CNSTI4 0
+ASGNI4
+LABELV $250
+LABELV $248
+endproc UI_InitGameinfo 4 4
+bss
+align 4
+LABELV outOfMemory
+skip 4
+align 4
+LABELV allocPoint
+skip 4
+align 1
+LABELV memoryPool
+skip 131072
+align 4
+LABELV ui_numSpecialSinglePlayerArenas
+skip 4
+align 4
+LABELV ui_numSinglePlayerArenas
+skip 4
+align 4
+LABELV ui_arenaInfos
+skip 4096
+align 4
+LABELV ui_numArenas
+skip 4
+align 4
+LABELV ui_botInfos
+skip 4096
+align 4
+LABELV ui_numBots
+skip 4
+import UI_HelpMenu_Cache
+import UI_HelpMenu_f
+import UI_HelpMenu
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_VoiceIngame
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_GetVoiceGainClient
+import trap_GetVoiceMuteAll
+import trap_GetVoiceMuteClient
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_CIN_SetExtents
+import trap_CIN_StopCinematic
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_PlayCinematic
+import trap_RealTime
+import trap_S_StartBackgroundTrack
+import trap_S_StopBackgroundTrack
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_SaveCachedServers
+import trap_LAN_LoadCachedServers
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import BotListCompare
+import uis
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString2
+import UI_AutoWrappedString_LineCount
+import UI_DrawString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawIngameBG
+import UI_DrawStringNS
+import UI_ModelIcon
+import UI_DrawHandlePic1024
+import UI_AdjustFrom1024
+import UI_StopMusic
+import UI_StartCreditMusic
+import UI_StartMusic
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_ClearModelCache
+import UI_PrecacheClientModelname
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import UI_SpecifyPasswordMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import Demos_Cache
+import UI_DemosMenu
+import SetDefaultBinds_onUnusedKeys
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import SetupDefaultMenu_Cache
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import Music_NextTrack
+import Music_TriggerRestart
+import Music_Check
+import MusicMenu_Cache
+import MusicMenu_Open
+import MusicMenu_Shutdown
+import MusicMenu_Init
+import UI_CallVoteMenu
+import UI_InGameMenu
+import InGame_Cache
+import UI_SecretMenu
+import UI_InitBigCredits
+import UI_BigCredits_Cache
+import UI_CreditMenu
+import ExitMenu_Cache
+import ExitMenu_Init
+import UI_MainMenu
+import MainMenu_Cache
+import UI_UpdateCvars
+import UI_RegisterCvars
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import listbar_bluecolor
+import text_color_bluehighlight
+import text_color_bluenormal
+import text_color_ighighlight
+import text_color_ignormal
+import listbar_igcolor
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_lightOrange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_click_sound
+import menu_switch_sound
+import menu_move_sound
+import ScrollList_Key
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import wop_AutoBindUnusedKeys
+import wop_AutoswitchSongByNextMap
+import con_notifytime
+import s_wop_restarted
+import syc_logo
+import spraycolor
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_createGametype
+import ui_browserHidePrivate
+import ui_browserOnlyHumans
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $251
+byte 1 102
+byte 1 115
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $247
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $244
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $243
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $238
+byte 1 46
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $237
+byte 1 115
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 76
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 45
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 58
+byte 1 10
+byte 1 0
+align 1
+LABELV $235
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $232
+byte 1 10
+byte 1 76
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $231
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 0
+align 1
+LABELV $230
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 0
+align 1
+LABELV $227
+byte 1 46
+byte 1 112
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $226
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $225
+byte 1 46
+byte 1 106
+byte 1 112
+byte 1 103
+byte 1 0
+align 1
+LABELV $218
+byte 1 76
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 115
+byte 1 58
+byte 1 10
+byte 1 0
+align 1
+LABELV $217
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $214
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $201
+byte 1 94
+byte 1 49
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $196
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $191
+byte 1 46
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $186
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $184
+byte 1 94
+byte 1 51
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 103
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 111
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $170
+byte 1 94
+byte 1 49
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $155
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $150
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $149
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $144
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $139
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $138
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $133
+byte 1 94
+byte 1 51
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 103
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 111
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $130
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $129
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 0
+align 1
+LABELV $124
+byte 1 46
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 0
+align 1
+LABELV $123
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $118
+byte 1 0
+align 1
+LABELV $117
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $115
+byte 1 94
+byte 1 49
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 44
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $112
+byte 1 94
+byte 1 49
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $106
+byte 1 92
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 92
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $105
+byte 1 60
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 62
+byte 1 0
+align 1
+LABELV $102
+byte 1 125
+byte 1 0
+align 1
+LABELV $99
+byte 1 85
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $93
+byte 1 77
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 115
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $90
+byte 1 77
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 123
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $89
+byte 1 123
+byte 1 0
@@ -0,0 +1,1488 @@
+data
+align 4
+LABELV HELP_GAMETYPE
+address $78
+address $79
+address $80
+address $81
+address $82
+address $83
+address $84
+address $85
+lit
+align 4
+LABELV GAMETYPE_REMAP
+byte 4 0
+byte 4 7
+byte 4 7
+byte 4 1
+byte 4 2
+byte 4 3
+byte 4 4
+byte 4 5
+byte 4 6
+byte 4 7
+data
+align 4
+LABELV HELP_ITEM
+address $86
+address $87
+lit
+align 4
+LABELV NUM_HELP_ITEM
+byte 4 2
+data
+align 4
+LABELV helpMin
+byte 4 0
+align 4
+LABELV helpIndex
+byte 4 0
+align 4
+LABELV helpList
+byte 4 0
+code
+proc UI_HelpMenu_AdjustButtons 16 8
+ADDRLP4 0
+ADDRGP4 helpMenuInfo+316+48
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 4
+ADDRGP4 helpMenuInfo+412+48
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRGP4 helpIndex
+INDIRI4
+CNSTI4 0
+GTI4 $93
+ADDRLP4 8
+ADDRGP4 helpMenuInfo+316+48
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+LABELV $93
+ADDRGP4 helpIndex
+INDIRI4
+ADDRGP4 helpMax
+INDIRI4
+LTI4 $97
+ADDRLP4 8
+ADDRGP4 helpMenuInfo+412+48
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+LABELV $97
+ADDRGP4 $102
+ARGP4
+ADDRGP4 helpIndex
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 helpList
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 helpMenuInfo+296
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $88
+endproc UI_HelpMenu_AdjustButtons 16 8
+proc UI_HelpMenu_Event 16 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $104
+ADDRGP4 $103
+JUMPV
+LABELV $104
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+EQI4 $109
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+EQI4 $110
+ADDRGP4 $106
+JUMPV
+LABELV $109
+ADDRLP4 8
+ADDRGP4 helpIndex
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $107
+JUMPV
+LABELV $110
+LABELV $106
+ADDRLP4 12
+ADDRGP4 helpIndex
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $107
+ADDRGP4 helpIndex
+INDIRI4
+ADDRGP4 helpMin
+INDIRI4
+GEI4 $111
+ADDRGP4 helpIndex
+ADDRGP4 helpMin
+INDIRI4
+ASGNI4
+ADDRGP4 $112
+JUMPV
+LABELV $111
+ADDRGP4 helpIndex
+INDIRI4
+ADDRGP4 helpMax
+INDIRI4
+LEI4 $113
+ADDRGP4 helpIndex
+ADDRGP4 helpMax
+INDIRI4
+ASGNI4
+LABELV $113
+LABELV $112
+ADDRGP4 UI_HelpMenu_AdjustButtons
+CALLV
+pop
+LABELV $103
+endproc UI_HelpMenu_Event 16 0
+proc UI_HelpMenu_Key 20 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 134
+EQI4 $118
+ADDRLP4 4
+CNSTI4 135
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $120
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GTI4 $124
+LABELV $123
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 103
+EQI4 $122
+ADDRLP4 8
+INDIRI4
+CNSTI4 104
+EQI4 $122
+ADDRGP4 $117
+JUMPV
+LABELV $124
+ADDRLP4 12
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 163
+EQI4 $118
+ADDRLP4 12
+INDIRI4
+CNSTI4 165
+EQI4 $120
+ADDRGP4 $117
+JUMPV
+LABELV $118
+ADDRGP4 helpMenuInfo+316
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 UI_HelpMenu_Event
+CALLV
+pop
+ADDRGP4 $117
+JUMPV
+LABELV $120
+ADDRGP4 helpMenuInfo+412
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 UI_HelpMenu_Event
+CALLV
+pop
+ADDRGP4 $117
+JUMPV
+LABELV $122
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $115
+JUMPV
+LABELV $117
+ADDRGP4 helpMenuInfo
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 Menu_DefaultKey
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+RETI4
+LABELV $115
+endproc UI_HelpMenu_Key 20 8
+proc UI_DrawHelpMenuImg 0 20
+ADDRGP4 helpMenuInfo+308
+INDIRF4
+ARGF4
+ADDRGP4 helpMenuInfo+312
+INDIRF4
+ARGF4
+ADDRGP4 helpMenuInfo+300
+INDIRF4
+ARGF4
+ADDRGP4 helpMenuInfo+304
+INDIRF4
+ARGF4
+ADDRGP4 helpMenuInfo+296
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $125
+endproc UI_DrawHelpMenuImg 0 20
+proc UI_HelpMenu_Draw 0 4
+ADDRGP4 UI_DrawHelpMenuImg
+CALLV
+pop
+ADDRGP4 helpMenuInfo
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+LABELV $131
+endproc UI_HelpMenu_Draw 0 4
+proc UI_HelpMenu_SetTopic 1064 12
+ADDRLP4 1032
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 1
+LEI4 $133
+CNSTI4 1
+ARGI4
+ADDRLP4 1036
+ADDRGP4 UI_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 1036
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $137
+ARGP4
+ADDRLP4 1040
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $135
+ADDRGP4 helpList
+ADDRGP4 HELP_GAMETYPE
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigString
+CALLI4
+pop
+ADDRLP4 8
+ARGP4
+ADDRGP4 $138
+ARGP4
+ADDRLP4 1044
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1048
+INDIRI4
+ASGNI4
+ADDRLP4 1052
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+LTI4 $141
+ADDRLP4 1052
+INDIRI4
+CNSTI4 9
+LEI4 $139
+LABELV $141
+ADDRLP4 0
+CNSTI4 9
+ASGNI4
+LABELV $139
+ADDRLP4 1056
+ADDRGP4 helpIndex
+ASGNP4
+ADDRLP4 1056
+INDIRP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 GAMETYPE_REMAP
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1060
+ADDRLP4 1056
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 helpMin
+ADDRLP4 1060
+INDIRI4
+ASGNI4
+ADDRGP4 helpMax
+ADDRLP4 1060
+INDIRI4
+ASGNI4
+ADDRGP4 helpMenuInfo+316+48
+CNSTU4 4096
+ASGNU4
+ADDRGP4 helpMenuInfo+412+48
+CNSTU4 4096
+ASGNU4
+ADDRGP4 helpMenuInfo+300
+CNSTF4 1136295936
+ASGNF4
+ADDRGP4 helpMenuInfo+304
+CNSTF4 1137016832
+ASGNF4
+ADDRGP4 helpMenuInfo+308
+CNSTF4 1125515264
+ASGNF4
+ADDRGP4 helpMenuInfo+312
+CNSTF4 0
+ASGNF4
+ADDRGP4 $134
+JUMPV
+LABELV $135
+ADDRLP4 1044
+ADDRGP4 helpMin
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 helpMax
+ADDRGP4 NUM_HELP_ITEM
+INDIRU4
+CNSTU4 1
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRGP4 helpList
+ADDRGP4 HELP_ITEM
+ASGNP4
+ADDRGP4 helpIndex
+ADDRLP4 1044
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 helpMenuInfo+300
+CNSTF4 1140424704
+ASGNF4
+ADDRGP4 helpMenuInfo+304
+CNSTF4 1138262016
+ASGNF4
+ADDRGP4 helpMenuInfo+308
+CNSTF4 1119354880
+ASGNF4
+ADDRGP4 helpMenuInfo+312
+CNSTF4 0
+ASGNF4
+ADDRGP4 $134
+JUMPV
+LABELV $133
+ADDRGP4 helpMin
+CNSTI4 0
+ASGNI4
+ADDRLP4 1036
+ADDRGP4 helpMax
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+ADDRGP4 NUM_HELP_ITEM
+INDIRU4
+CNSTU4 1
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRGP4 helpList
+ADDRGP4 HELP_ITEM
+ASGNP4
+ADDRGP4 helpIndex
+ADDRLP4 1036
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 helpMenuInfo+300
+CNSTF4 1140424704
+ASGNF4
+ADDRGP4 helpMenuInfo+304
+CNSTF4 1138262016
+ASGNF4
+ADDRGP4 helpMenuInfo+308
+CNSTF4 1119354880
+ASGNF4
+ADDRGP4 helpMenuInfo+312
+CNSTF4 0
+ASGNF4
+LABELV $134
+ADDRGP4 UI_HelpMenu_AdjustButtons
+CALLV
+pop
+LABELV $132
+endproc UI_HelpMenu_SetTopic 1064 12
+proc UI_HelpMenu_Init 0 12
+ADDRGP4 UI_HelpMenu_Cache
+CALLV
+pop
+ADDRGP4 helpMenuInfo
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 508
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 helpMenuInfo+280
+CNSTI4 0
+ASGNI4
+ADDRGP4 helpMenuInfo+272
+ADDRGP4 UI_HelpMenu_Key
+ASGNP4
+ADDRGP4 helpMenuInfo+268
+ADDRGP4 UI_HelpMenu_Draw
+ASGNP4
+ADDRGP4 helpMenuInfo+316
+CNSTI4 6
+ASGNI4
+ADDRGP4 helpMenuInfo+316+12
+CNSTI4 10
+ASGNI4
+ADDRGP4 helpMenuInfo+316+16
+CNSTI4 266
+ASGNI4
+ADDRGP4 helpMenuInfo+316+20
+CNSTI4 350
+ASGNI4
+ADDRGP4 helpMenuInfo+316+80
+CNSTI4 45
+ASGNI4
+ADDRGP4 helpMenuInfo+316+84
+CNSTI4 27
+ASGNI4
+ADDRGP4 helpMenuInfo+316+4
+ADDRGP4 $175
+ASGNP4
+ADDRGP4 helpMenuInfo+316+64
+ADDRGP4 $178
+ASGNP4
+ADDRGP4 helpMenuInfo+316+48
+CNSTU4 128
+ASGNU4
+ADDRGP4 helpMenuInfo+316+52
+ADDRGP4 UI_HelpMenu_Event
+ASGNP4
+ADDRGP4 helpMenuInfo+412
+CNSTI4 6
+ASGNI4
+ADDRGP4 helpMenuInfo+412+12
+CNSTI4 11
+ASGNI4
+ADDRGP4 helpMenuInfo+412+16
+CNSTI4 329
+ASGNI4
+ADDRGP4 helpMenuInfo+412+20
+CNSTI4 350
+ASGNI4
+ADDRGP4 helpMenuInfo+412+80
+CNSTI4 45
+ASGNI4
+ADDRGP4 helpMenuInfo+412+84
+CNSTI4 27
+ASGNI4
+ADDRGP4 helpMenuInfo+412+4
+ADDRGP4 $196
+ASGNP4
+ADDRGP4 helpMenuInfo+412+64
+ADDRGP4 $199
+ASGNP4
+ADDRGP4 helpMenuInfo+412+48
+CNSTU4 128
+ASGNU4
+ADDRGP4 helpMenuInfo+412+52
+ADDRGP4 UI_HelpMenu_Event
+ASGNP4
+ADDRGP4 helpMenuInfo
+ARGP4
+ADDRGP4 helpMenuInfo+316
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 helpMenuInfo
+ARGP4
+ADDRGP4 helpMenuInfo+412
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 UI_HelpMenu_SetTopic
+CALLV
+pop
+LABELV $158
+endproc UI_HelpMenu_Init 0 12
+export UI_HelpMenu_Cache
+proc UI_HelpMenu_Cache 0 4
+ADDRGP4 $175
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $178
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $196
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $199
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $206
+endproc UI_HelpMenu_Cache 0 4
+export UI_HelpMenu
+proc UI_HelpMenu 0 8
+ADDRGP4 $208
+ARGP4
+ADDRGP4 $209
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 UI_HelpMenu_Init
+CALLV
+pop
+ADDRGP4 helpMenuInfo
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $207
+endproc UI_HelpMenu 0 8
+export UI_HelpMenu_f
+proc UI_HelpMenu_f 0 0
+ADDRGP4 UI_HelpMenu
+CALLV
+pop
+LABELV $210
+endproc UI_HelpMenu_f 0 0
+bss
+align 4
+LABELV helpMax
+skip 4
+align 4
+LABELV helpMenuInfo
+skip 508
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import UI_InitGameinfo
+import UI_GetNumBots
+import UI_GetBotInfoByNumber
+import UI_GetNumArenas
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_VoiceIngame
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_GetVoiceGainClient
+import trap_GetVoiceMuteAll
+import trap_GetVoiceMuteClient
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_CIN_SetExtents
+import trap_CIN_StopCinematic
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_PlayCinematic
+import trap_RealTime
+import trap_S_StartBackgroundTrack
+import trap_S_StopBackgroundTrack
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_SaveCachedServers
+import trap_LAN_LoadCachedServers
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import BotListCompare
+import uis
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString2
+import UI_AutoWrappedString_LineCount
+import UI_DrawString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawIngameBG
+import UI_DrawStringNS
+import UI_ModelIcon
+import UI_DrawHandlePic1024
+import UI_AdjustFrom1024
+import UI_StopMusic
+import UI_StartCreditMusic
+import UI_StartMusic
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_ClearModelCache
+import UI_PrecacheClientModelname
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import UI_SpecifyPasswordMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import Demos_Cache
+import UI_DemosMenu
+import SetDefaultBinds_onUnusedKeys
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import SetupDefaultMenu_Cache
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import Music_NextTrack
+import Music_TriggerRestart
+import Music_Check
+import MusicMenu_Cache
+import MusicMenu_Open
+import MusicMenu_Shutdown
+import MusicMenu_Init
+import UI_CallVoteMenu
+import UI_InGameMenu
+import InGame_Cache
+import UI_SecretMenu
+import UI_InitBigCredits
+import UI_BigCredits_Cache
+import UI_CreditMenu
+import ExitMenu_Cache
+import ExitMenu_Init
+import UI_MainMenu
+import MainMenu_Cache
+import UI_UpdateCvars
+import UI_RegisterCvars
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import listbar_bluecolor
+import text_color_bluehighlight
+import text_color_bluenormal
+import text_color_ighighlight
+import text_color_ignormal
+import listbar_igcolor
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_lightOrange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_click_sound
+import menu_switch_sound
+import menu_move_sound
+import ScrollList_Key
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import wop_AutoBindUnusedKeys
+import wop_AutoswitchSongByNextMap
+import con_notifytime
+import s_wop_restarted
+import syc_logo
+import spraycolor
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_createGametype
+import ui_browserHidePrivate
+import ui_browserOnlyHumans
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $209
+byte 1 49
+byte 1 0
+align 1
+LABELV $208
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $199
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 49
+byte 1 0
+align 1
+LABELV $196
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 48
+byte 1 0
+align 1
+LABELV $178
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 117
+byte 1 112
+byte 1 49
+byte 1 0
+align 1
+LABELV $175
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 117
+byte 1 112
+byte 1 48
+byte 1 0
+align 1
+LABELV $138
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $137
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $102
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $87
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $86
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $85
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 95
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $84
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 95
+byte 1 98
+byte 1 98
+byte 1 0
+align 1
+LABELV $83
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 121
+byte 1 99
+byte 1 0
+align 1
+LABELV $82
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 108
+byte 1 0
+align 1
+LABELV $81
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 0
+align 1
+LABELV $80
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 95
+byte 1 108
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $79
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 95
+byte 1 115
+byte 1 121
+byte 1 99
+byte 1 0
+align 1
+LABELV $78
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 95
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 0
@@ -0,0 +1,1981 @@
+code
+proc InGame_RestartAction 0 8
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $79
+ADDRGP4 $78
+JUMPV
+LABELV $79
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $81
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $78
+endproc InGame_RestartAction 0 8
+proc InGame_QuitAction 0 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $83
+ADDRGP4 $82
+JUMPV
+LABELV $83
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_CreditMenu
+CALLV
+pop
+LABELV $82
+endproc InGame_QuitAction 0 0
+export InGame_Event
+proc InGame_Event 8 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $86
+ADDRGP4 $85
+JUMPV
+LABELV $86
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LTI4 $88
+ADDRLP4 0
+INDIRI4
+CNSTI4 23
+GTI4 $88
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $111-40
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $111
+address $91
+address $100
+address $101
+address $92
+address $99
+address $93
+address $95
+address $97
+address $104
+address $102
+address $109
+address $105
+address $107
+address $103
+code
+LABELV $91
+ADDRGP4 UI_TeamMainMenu
+CALLV
+pop
+ADDRGP4 $89
+JUMPV
+LABELV $92
+ADDRGP4 UI_SetupMenu
+CALLV
+pop
+ADDRGP4 $89
+JUMPV
+LABELV $93
+CNSTI4 2
+ARGI4
+ADDRGP4 $94
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $89
+JUMPV
+LABELV $95
+ADDRGP4 $96
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 InGame_RestartAction
+ARGP4
+ADDRGP4 UI_ConfirmMenu
+CALLV
+pop
+ADDRGP4 $89
+JUMPV
+LABELV $97
+ADDRGP4 $98
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 InGame_QuitAction
+ARGP4
+ADDRGP4 UI_ConfirmMenu
+CALLV
+pop
+ADDRGP4 $89
+JUMPV
+LABELV $99
+ADDRGP4 UI_ServerInfoMenu
+CALLV
+pop
+ADDRGP4 $89
+JUMPV
+LABELV $100
+ADDRGP4 UI_AddBotsMenu
+CALLV
+pop
+ADDRGP4 $89
+JUMPV
+LABELV $101
+ADDRGP4 UI_RemoveBotsMenu
+CALLV
+pop
+ADDRGP4 $89
+JUMPV
+LABELV $102
+ADDRGP4 UI_VoiceIngame
+CALLV
+pop
+ADDRGP4 $89
+JUMPV
+LABELV $103
+ADDRGP4 UI_CallVoteMenu
+CALLV
+pop
+ADDRGP4 $89
+JUMPV
+LABELV $104
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $89
+JUMPV
+LABELV $105
+CNSTI4 2
+ARGI4
+ADDRGP4 $106
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $89
+JUMPV
+LABELV $107
+CNSTI4 2
+ARGI4
+ADDRGP4 $108
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $89
+JUMPV
+LABELV $109
+CNSTI4 2
+ARGI4
+ADDRGP4 $110
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $88
+LABELV $89
+LABELV $85
+endproc InGame_Event 8 12
+proc InGame_Draw 0 4
+ADDRGP4 UI_DrawIngameBG
+CALLV
+pop
+ADDRGP4 s_ingame
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+LABELV $113
+endproc InGame_Draw 0 4
+proc InGame_MenuInit 1100 12
+ADDRGP4 $115
+ARGP4
+ADDRLP4 1048
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 1048
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $116
+ARGP4
+ADDRLP4 1052
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 1052
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $118
+ADDRLP4 1056
+CNSTI4 1
+ASGNI4
+ADDRGP4 $119
+JUMPV
+LABELV $118
+ADDRLP4 1056
+CNSTI4 0
+ASGNI4
+LABELV $119
+ADDRLP4 12
+ADDRLP4 1056
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+EQI4 $123
+ADDRLP4 8
+INDIRI4
+CNSTI4 7
+NEI4 $121
+LABELV $123
+ADDRLP4 1060
+CNSTI4 1
+ASGNI4
+ADDRGP4 $122
+JUMPV
+LABELV $121
+ADDRLP4 1060
+CNSTI4 0
+ASGNI4
+LABELV $122
+ADDRLP4 16
+ADDRLP4 1060
+INDIRI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigString
+CALLI4
+pop
+ADDRLP4 20
+ARGP4
+ADDRGP4 $124
+ARGP4
+ADDRLP4 1068
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1068
+INDIRP4
+ARGP4
+ADDRLP4 1072
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 1072
+INDIRI4
+ASGNI4
+ADDRGP4 s_ingame
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1388
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 InGame_Cache
+CALLV
+pop
+ADDRGP4 s_ingame+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_ingame+280
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_ingame+288
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_ingame+268
+ADDRGP4 InGame_Draw
+ASGNP4
+ADDRLP4 0
+CNSTI4 110
+ASGNI4
+ADDRGP4 s_ingame+296
+CNSTI4 12
+ASGNI4
+ADDRGP4 s_ingame+296+76
+CNSTF4 1101004800
+ASGNF4
+ADDRGP4 s_ingame+296+48
+CNSTU4 8
+ASGNU4
+ADDRGP4 s_ingame+296+16
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_ingame+296+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_ingame+296+12
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_ingame+296+52
+ADDRGP4 InGame_Event
+ASGNP4
+ADDRGP4 s_ingame+296+64
+ADDRGP4 $144
+ASGNP4
+ADDRGP4 s_ingame+296+72
+ADDRGP4 color_black
+ASGNP4
+ADDRGP4 s_ingame+296+80
+ADDRGP4 color_orange
+ASGNP4
+ADDRGP4 s_ingame+296+68
+CNSTI4 17
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_ingame+884
+CNSTI4 12
+ASGNI4
+ADDRGP4 s_ingame+884+76
+CNSTF4 1101004800
+ASGNF4
+ADDRGP4 s_ingame+884+48
+CNSTU4 8
+ASGNU4
+ADDRGP4 s_ingame+884+16
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_ingame+884+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_ingame+884+12
+CNSTI4 11
+ASGNI4
+ADDRGP4 s_ingame+884+52
+ADDRGP4 InGame_Event
+ASGNP4
+ADDRGP4 s_ingame+884+64
+ADDRGP4 $166
+ASGNP4
+ADDRGP4 s_ingame+884+72
+ADDRGP4 color_black
+ASGNP4
+ADDRGP4 s_ingame+884+80
+ADDRGP4 color_orange
+ASGNP4
+ADDRGP4 s_ingame+884+68
+CNSTI4 17
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $177
+ADDRGP4 $175
+ARGP4
+ADDRLP4 1076
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1076
+INDIRF4
+CNSTF4 0
+EQF4 $177
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $173
+LABELV $177
+ADDRLP4 1080
+ADDRGP4 s_ingame+884+48
+ASGNP4
+ADDRLP4 1080
+INDIRP4
+ADDRLP4 1080
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+LABELV $173
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_ingame+968
+CNSTI4 12
+ASGNI4
+ADDRGP4 s_ingame+968+76
+CNSTF4 1101004800
+ASGNF4
+ADDRGP4 s_ingame+968+48
+CNSTU4 8
+ASGNU4
+ADDRGP4 s_ingame+968+16
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_ingame+968+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_ingame+968+12
+CNSTI4 12
+ASGNI4
+ADDRGP4 s_ingame+968+52
+ADDRGP4 InGame_Event
+ASGNP4
+ADDRGP4 s_ingame+968+64
+ADDRGP4 $195
+ASGNP4
+ADDRGP4 s_ingame+968+72
+ADDRGP4 color_black
+ASGNP4
+ADDRGP4 s_ingame+968+80
+ADDRGP4 color_orange
+ASGNP4
+ADDRGP4 s_ingame+968+68
+CNSTI4 17
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $205
+ADDRGP4 $175
+ARGP4
+ADDRLP4 1080
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1080
+INDIRF4
+CNSTF4 0
+EQF4 $205
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $202
+LABELV $205
+ADDRLP4 1084
+ADDRGP4 s_ingame+968+48
+ASGNP4
+ADDRLP4 1084
+INDIRP4
+ADDRLP4 1084
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+LABELV $202
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_ingame+1052
+CNSTI4 12
+ASGNI4
+ADDRGP4 s_ingame+1052+76
+CNSTF4 1101004800
+ASGNF4
+ADDRGP4 s_ingame+1052+48
+CNSTU4 8
+ASGNU4
+ADDRGP4 s_ingame+1052+16
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_ingame+1052+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_ingame+1052+12
+CNSTI4 19
+ASGNI4
+ADDRGP4 s_ingame+1052+52
+ADDRGP4 InGame_Event
+ASGNP4
+ADDRGP4 s_ingame+1052+64
+ADDRGP4 $223
+ASGNP4
+ADDRGP4 s_ingame+1052+72
+ADDRGP4 color_black
+ASGNP4
+ADDRGP4 s_ingame+1052+80
+ADDRGP4 color_orange
+ASGNP4
+ADDRGP4 s_ingame+1052+68
+CNSTI4 17
+ASGNI4
+ADDRGP4 $232
+ARGP4
+ADDRLP4 1084
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1084
+INDIRF4
+CNSTF4 0
+EQF4 $234
+ADDRGP4 $233
+ARGP4
+ADDRLP4 1088
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1088
+INDIRF4
+CNSTF4 0
+NEF4 $230
+LABELV $234
+ADDRLP4 1092
+ADDRGP4 s_ingame+1052+48
+ASGNP4
+ADDRLP4 1092
+INDIRP4
+ADDRLP4 1092
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+LABELV $230
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_ingame+1136
+CNSTI4 12
+ASGNI4
+ADDRGP4 s_ingame+1136+76
+CNSTF4 1101004800
+ASGNF4
+ADDRGP4 s_ingame+1136+48
+CNSTU4 8
+ASGNU4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $242
+ADDRLP4 1092
+ADDRGP4 s_ingame+1136+48
+ASGNP4
+ADDRLP4 1092
+INDIRP4
+ADDRLP4 1092
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+LABELV $242
+ADDRGP4 s_ingame+1136+16
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_ingame+1136+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_ingame+1136+12
+CNSTI4 23
+ASGNI4
+ADDRGP4 s_ingame+1136+52
+ADDRGP4 InGame_Event
+ASGNP4
+ADDRGP4 s_ingame+1136+64
+ADDRGP4 $256
+ASGNP4
+ADDRGP4 s_ingame+1136+72
+ADDRGP4 color_black
+ASGNP4
+ADDRGP4 s_ingame+1136+80
+ADDRGP4 color_orange
+ASGNP4
+ADDRGP4 s_ingame+1136+68
+CNSTI4 17
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_ingame+548
+CNSTI4 12
+ASGNI4
+ADDRGP4 s_ingame+548+76
+CNSTF4 1101004800
+ASGNF4
+ADDRGP4 s_ingame+548+48
+CNSTU4 8
+ASGNU4
+ADDRGP4 s_ingame+548+16
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_ingame+548+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_ingame+548+12
+CNSTI4 13
+ASGNI4
+ADDRGP4 s_ingame+548+52
+ADDRGP4 InGame_Event
+ASGNP4
+ADDRGP4 s_ingame+548+64
+ADDRGP4 $278
+ASGNP4
+ADDRGP4 s_ingame+548+72
+ADDRGP4 color_black
+ASGNP4
+ADDRGP4 s_ingame+548+80
+ADDRGP4 color_orange
+ASGNP4
+ADDRGP4 s_ingame+548+68
+CNSTI4 17
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_ingame+464
+CNSTI4 12
+ASGNI4
+ADDRGP4 s_ingame+464+76
+CNSTF4 1101004800
+ASGNF4
+ADDRGP4 s_ingame+464+48
+CNSTU4 8
+ASGNU4
+ADDRGP4 s_ingame+464+16
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_ingame+464+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_ingame+464+12
+CNSTI4 22
+ASGNI4
+ADDRGP4 s_ingame+464+52
+ADDRGP4 InGame_Event
+ASGNP4
+ADDRGP4 s_ingame+464+64
+ADDRGP4 $300
+ASGNP4
+ADDRGP4 s_ingame+464+72
+ADDRGP4 color_black
+ASGNP4
+ADDRGP4 s_ingame+464+80
+ADDRGP4 color_orange
+ASGNP4
+ADDRGP4 s_ingame+464+68
+CNSTI4 17
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $307
+ADDRLP4 1096
+ADDRGP4 s_ingame+464+48
+ASGNP4
+ADDRLP4 1096
+INDIRP4
+ADDRLP4 1096
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+LABELV $307
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_ingame+632
+CNSTI4 12
+ASGNI4
+ADDRGP4 s_ingame+632+76
+CNSTF4 1101004800
+ASGNF4
+ADDRGP4 s_ingame+632+48
+CNSTU4 8
+ASGNU4
+ADDRGP4 s_ingame+632+16
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_ingame+632+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_ingame+632+12
+CNSTI4 14
+ASGNI4
+ADDRGP4 s_ingame+632+52
+ADDRGP4 InGame_Event
+ASGNP4
+ADDRGP4 s_ingame+632+64
+ADDRGP4 $326
+ASGNP4
+ADDRGP4 s_ingame+632+72
+ADDRGP4 color_black
+ASGNP4
+ADDRGP4 s_ingame+632+80
+ADDRGP4 color_orange
+ASGNP4
+ADDRGP4 s_ingame+632+68
+CNSTI4 17
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_ingame+800
+CNSTI4 12
+ASGNI4
+ADDRGP4 s_ingame+800+76
+CNSTF4 1101004800
+ASGNF4
+ADDRGP4 s_ingame+800+48
+CNSTU4 8
+ASGNU4
+ADDRGP4 s_ingame+800+16
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_ingame+800+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_ingame+800+12
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_ingame+800+52
+ADDRGP4 InGame_Event
+ASGNP4
+ADDRGP4 s_ingame+800+64
+ADDRGP4 $348
+ASGNP4
+ADDRGP4 s_ingame+800+72
+ADDRGP4 color_black
+ASGNP4
+ADDRGP4 s_ingame+800+80
+ADDRGP4 color_orange
+ASGNP4
+ADDRGP4 s_ingame+800+68
+CNSTI4 17
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $355
+ADDRLP4 1096
+ADDRGP4 s_ingame+800+48
+ASGNP4
+ADDRLP4 1096
+INDIRP4
+ADDRLP4 1096
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+LABELV $355
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $359
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_ingame+380
+CNSTI4 12
+ASGNI4
+ADDRGP4 s_ingame+380+76
+CNSTF4 1101004800
+ASGNF4
+ADDRGP4 s_ingame+380+48
+CNSTU4 8
+ASGNU4
+ADDRGP4 s_ingame+380+16
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_ingame+380+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_ingame+380+12
+CNSTI4 20
+ASGNI4
+ADDRGP4 s_ingame+380+52
+ADDRGP4 InGame_Event
+ASGNP4
+ADDRGP4 s_ingame+380+64
+ADDRGP4 $376
+ASGNP4
+ADDRGP4 s_ingame+380+72
+ADDRGP4 color_black
+ASGNP4
+ADDRGP4 s_ingame+380+80
+ADDRGP4 color_orange
+ASGNP4
+ADDRGP4 s_ingame+380+68
+CNSTI4 17
+ASGNI4
+LABELV $359
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_ingame+1304
+CNSTI4 12
+ASGNI4
+ADDRGP4 s_ingame+1304+76
+CNSTF4 1101004800
+ASGNF4
+ADDRGP4 s_ingame+1304+48
+CNSTU4 8
+ASGNU4
+ADDRGP4 s_ingame+1304+16
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_ingame+1304+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_ingame+1304+12
+CNSTI4 18
+ASGNI4
+ADDRGP4 s_ingame+1304+52
+ADDRGP4 InGame_Event
+ASGNP4
+ADDRGP4 s_ingame+1304+64
+ADDRGP4 $398
+ASGNP4
+ADDRGP4 s_ingame+1304+72
+ADDRGP4 color_black
+ASGNP4
+ADDRGP4 s_ingame+1304+80
+ADDRGP4 color_orange
+ASGNP4
+ADDRGP4 s_ingame+1304+68
+CNSTI4 17
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_ingame+716
+CNSTI4 12
+ASGNI4
+ADDRGP4 s_ingame+716+76
+CNSTF4 1101004800
+ASGNF4
+ADDRGP4 s_ingame+716+48
+CNSTU4 8
+ASGNU4
+ADDRGP4 s_ingame+716+16
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_ingame+716+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_ingame+716+12
+CNSTI4 15
+ASGNI4
+ADDRGP4 s_ingame+716+52
+ADDRGP4 InGame_Event
+ASGNP4
+ADDRGP4 s_ingame+716+64
+ADDRGP4 $420
+ASGNP4
+ADDRGP4 s_ingame+716+72
+ADDRGP4 color_black
+ASGNP4
+ADDRGP4 s_ingame+716+80
+ADDRGP4 color_orange
+ASGNP4
+ADDRGP4 s_ingame+716+68
+CNSTI4 17
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_ingame+1220
+CNSTI4 12
+ASGNI4
+ADDRGP4 s_ingame+1220+76
+CNSTF4 1101004800
+ASGNF4
+ADDRGP4 s_ingame+1220+48
+CNSTU4 8
+ASGNU4
+ADDRGP4 s_ingame+1220+16
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_ingame+1220+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_ingame+1220+12
+CNSTI4 17
+ASGNI4
+ADDRGP4 s_ingame+1220+52
+ADDRGP4 InGame_Event
+ASGNP4
+ADDRGP4 s_ingame+1220+64
+ADDRGP4 $442
+ASGNP4
+ADDRGP4 s_ingame+1220+72
+ADDRGP4 color_black
+ASGNP4
+ADDRGP4 s_ingame+1220+80
+ADDRGP4 color_orange
+ASGNP4
+ADDRGP4 s_ingame+1220+68
+CNSTI4 17
+ASGNI4
+ADDRGP4 s_ingame
+ARGP4
+ADDRGP4 s_ingame+296
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_ingame
+ARGP4
+ADDRGP4 s_ingame+884
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_ingame
+ARGP4
+ADDRGP4 s_ingame+968
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_ingame
+ARGP4
+ADDRGP4 s_ingame+1052
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_ingame
+ARGP4
+ADDRGP4 s_ingame+1136
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_ingame
+ARGP4
+ADDRGP4 s_ingame+548
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_ingame
+ARGP4
+ADDRGP4 s_ingame+464
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_ingame
+ARGP4
+ADDRGP4 s_ingame+632
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_ingame
+ARGP4
+ADDRGP4 s_ingame+800
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $458
+ADDRGP4 s_ingame
+ARGP4
+ADDRGP4 s_ingame+380
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $458
+ADDRGP4 s_ingame
+ARGP4
+ADDRGP4 s_ingame+1304
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_ingame
+ARGP4
+ADDRGP4 s_ingame+716
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_ingame
+ARGP4
+ADDRGP4 s_ingame+1220
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $114
+endproc InGame_MenuInit 1100 12
+export InGame_Cache
+proc InGame_Cache 0 0
+LABELV $464
+endproc InGame_Cache 0 0
+export UI_InGameMenu
+proc UI_InGameMenu 0 4
+ADDRGP4 uis+16
+CNSTI4 0
+ASGNI4
+ADDRGP4 uis+8
+CNSTI4 319
+ASGNI4
+ADDRGP4 uis+12
+CNSTI4 80
+ASGNI4
+ADDRGP4 InGame_MenuInit
+CALLV
+pop
+ADDRGP4 s_ingame
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $465
+endproc UI_InGameMenu 0 4
+bss
+align 4
+LABELV s_ingame
+skip 1388
+import UI_HelpMenu_Cache
+import UI_HelpMenu_f
+import UI_HelpMenu
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import UI_InitGameinfo
+import UI_GetNumBots
+import UI_GetBotInfoByNumber
+import UI_GetNumArenas
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_VoiceIngame
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_GetVoiceGainClient
+import trap_GetVoiceMuteAll
+import trap_GetVoiceMuteClient
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_CIN_SetExtents
+import trap_CIN_StopCinematic
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_PlayCinematic
+import trap_RealTime
+import trap_S_StartBackgroundTrack
+import trap_S_StopBackgroundTrack
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_SaveCachedServers
+import trap_LAN_LoadCachedServers
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import BotListCompare
+import uis
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString2
+import UI_AutoWrappedString_LineCount
+import UI_DrawString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawIngameBG
+import UI_DrawStringNS
+import UI_ModelIcon
+import UI_DrawHandlePic1024
+import UI_AdjustFrom1024
+import UI_StopMusic
+import UI_StartCreditMusic
+import UI_StartMusic
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_ClearModelCache
+import UI_PrecacheClientModelname
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import UI_SpecifyPasswordMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import Demos_Cache
+import UI_DemosMenu
+import SetDefaultBinds_onUnusedKeys
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import SetupDefaultMenu_Cache
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import Music_NextTrack
+import Music_TriggerRestart
+import Music_Check
+import MusicMenu_Cache
+import MusicMenu_Open
+import MusicMenu_Shutdown
+import MusicMenu_Init
+import UI_CallVoteMenu
+import UI_SecretMenu
+import UI_InitBigCredits
+import UI_BigCredits_Cache
+import UI_CreditMenu
+import ExitMenu_Cache
+import ExitMenu_Init
+import UI_MainMenu
+import MainMenu_Cache
+import UI_UpdateCvars
+import UI_RegisterCvars
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import listbar_bluecolor
+import text_color_bluehighlight
+import text_color_bluenormal
+import text_color_ighighlight
+import text_color_ignormal
+import listbar_igcolor
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_lightOrange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_click_sound
+import menu_switch_sound
+import menu_move_sound
+import ScrollList_Key
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import wop_AutoBindUnusedKeys
+import wop_AutoswitchSongByNextMap
+import con_notifytime
+import s_wop_restarted
+import syc_logo
+import spraycolor
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_createGametype
+import ui_browserHidePrivate
+import ui_browserOnlyHumans
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $442
+byte 1 69
+byte 1 88
+byte 1 73
+byte 1 84
+byte 1 32
+byte 1 71
+byte 1 65
+byte 1 77
+byte 1 69
+byte 1 0
+align 1
+LABELV $420
+byte 1 76
+byte 1 69
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 32
+byte 1 65
+byte 1 82
+byte 1 69
+byte 1 78
+byte 1 65
+byte 1 0
+align 1
+LABELV $398
+byte 1 82
+byte 1 69
+byte 1 83
+byte 1 85
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 71
+byte 1 65
+byte 1 77
+byte 1 69
+byte 1 0
+align 1
+LABELV $376
+byte 1 83
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 67
+byte 1 84
+byte 1 32
+byte 1 76
+byte 1 79
+byte 1 71
+byte 1 79
+byte 1 0
+align 1
+LABELV $348
+byte 1 82
+byte 1 69
+byte 1 83
+byte 1 84
+byte 1 65
+byte 1 82
+byte 1 84
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 80
+byte 1 0
+align 1
+LABELV $326
+byte 1 83
+byte 1 69
+byte 1 82
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 73
+byte 1 78
+byte 1 70
+byte 1 79
+byte 1 0
+align 1
+LABELV $300
+byte 1 78
+byte 1 69
+byte 1 88
+byte 1 84
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 80
+byte 1 0
+align 1
+LABELV $278
+byte 1 83
+byte 1 69
+byte 1 84
+byte 1 85
+byte 1 80
+byte 1 0
+align 1
+LABELV $256
+byte 1 67
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 32
+byte 1 86
+byte 1 79
+byte 1 84
+byte 1 69
+byte 1 0
+align 1
+LABELV $233
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $232
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $223
+byte 1 86
+byte 1 79
+byte 1 73
+byte 1 67
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 84
+byte 1 0
+align 1
+LABELV $195
+byte 1 82
+byte 1 69
+byte 1 77
+byte 1 79
+byte 1 86
+byte 1 69
+byte 1 32
+byte 1 66
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 0
+align 1
+LABELV $175
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $166
+byte 1 65
+byte 1 68
+byte 1 68
+byte 1 32
+byte 1 66
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 0
+align 1
+LABELV $144
+byte 1 83
+byte 1 84
+byte 1 65
+byte 1 82
+byte 1 84
+byte 1 0
+align 1
+LABELV $124
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $116
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $115
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $110
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 104
+byte 1 111
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 10
+byte 1 0
+align 1
+LABELV $108
+byte 1 118
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 10
+byte 1 0
+align 1
+LABELV $106
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 10
+byte 1 0
+align 1
+LABELV $98
+byte 1 69
+byte 1 88
+byte 1 73
+byte 1 84
+byte 1 32
+byte 1 71
+byte 1 65
+byte 1 77
+byte 1 69
+byte 1 63
+byte 1 0
+align 1
+LABELV $96
+byte 1 82
+byte 1 69
+byte 1 83
+byte 1 84
+byte 1 65
+byte 1 82
+byte 1 84
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 80
+byte 1 63
+byte 1 0
+align 1
+LABELV $94
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $81
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 48
+byte 1 10
+byte 1 0
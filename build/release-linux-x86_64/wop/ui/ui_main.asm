@@ -0,0 +1,1951 @@
+export vmMain
+code
+proc vmMain 12 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $78
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+GTI4 $78
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $91
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $91
+address $80
+address $81
+address $82
+address $83
+address $84
+address $85
+address $86
+address $87
+address $88
+address $89
+address $90
+code
+LABELV $80
+CNSTI4 4
+RETI4
+ADDRGP4 $77
+JUMPV
+LABELV $81
+ADDRGP4 UI_Init
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $77
+JUMPV
+LABELV $82
+ADDRGP4 UI_Shutdown
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $77
+JUMPV
+LABELV $83
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 UI_KeyEvent
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $77
+JUMPV
+LABELV $84
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 UI_MouseEvent
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $77
+JUMPV
+LABELV $85
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_Refresh
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $77
+JUMPV
+LABELV $86
+ADDRLP4 4
+ADDRGP4 UI_IsFullscreen
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $77
+JUMPV
+LABELV $87
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_SetActiveMenu
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $77
+JUMPV
+LABELV $88
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 UI_ConsoleCommand
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $77
+JUMPV
+LABELV $89
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawConnectScreen
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $77
+JUMPV
+LABELV $90
+CNSTI4 0
+RETI4
+ADDRGP4 $77
+JUMPV
+LABELV $78
+CNSTI4 -1
+RETI4
+LABELV $77
+endproc vmMain 12 8
+data
+align 4
+LABELV cvarTable
+address ui_ffa_fraglimit
+address $93
+address $94
+byte 4 1
+address ui_ffa_timelimit
+address $95
+address $96
+byte 4 1
+address ui_tourney_fraglimit
+address $97
+address $96
+byte 4 1
+address ui_tourney_timelimit
+address $98
+address $99
+byte 4 1
+address ui_team_fraglimit
+address $100
+address $96
+byte 4 1
+address ui_team_timelimit
+address $101
+address $94
+byte 4 1
+address ui_team_friendly
+address $102
+address $103
+byte 4 1
+address ui_ctf_capturelimit
+address $104
+address $105
+byte 4 1
+address ui_ctf_timelimit
+address $106
+address $107
+byte 4 1
+address ui_ctf_friendly
+address $108
+address $96
+byte 4 1
+address ui_arenasFile
+address $109
+address $110
+byte 4 80
+address ui_botsFile
+address $111
+address $110
+byte 4 80
+address ui_browserMaster
+address $112
+address $113
+byte 4 1
+address ui_browserGameType
+address $114
+address $96
+byte 4 1
+address ui_browserSortKey
+address $115
+address $116
+byte 4 1
+address ui_browserShowFull
+address $117
+address $96
+byte 4 1
+address ui_browserShowEmpty
+address $118
+address $103
+byte 4 1
+address ui_browserOnlyHumans
+address $119
+address $103
+byte 4 1
+address ui_browserHidePrivate
+address $120
+address $96
+byte 4 1
+address ui_createGametype
+address $121
+address $122
+byte 4 0
+address ui_drawCrosshair
+address $123
+address $103
+byte 4 1
+address ui_drawCrosshairNames
+address $124
+address $103
+byte 4 1
+address ui_marks
+address $125
+address $103
+byte 4 1
+address ui_server1
+address $126
+address $110
+byte 4 1
+address ui_server2
+address $127
+address $110
+byte 4 1
+address ui_server3
+address $128
+address $110
+byte 4 1
+address ui_server4
+address $129
+address $110
+byte 4 1
+address ui_server5
+address $130
+address $110
+byte 4 1
+address ui_server6
+address $131
+address $110
+byte 4 1
+address ui_server7
+address $132
+address $110
+byte 4 1
+address ui_server8
+address $133
+address $110
+byte 4 1
+address ui_server9
+address $134
+address $110
+byte 4 1
+address ui_server10
+address $135
+address $110
+byte 4 1
+address ui_server11
+address $136
+address $110
+byte 4 1
+address ui_server12
+address $137
+address $110
+byte 4 1
+address ui_server13
+address $138
+address $110
+byte 4 1
+address ui_server14
+address $139
+address $110
+byte 4 1
+address ui_server15
+address $140
+address $110
+byte 4 1
+address ui_server16
+address $141
+address $110
+byte 4 1
+address spraycolor
+address $142
+address $96
+byte 4 3
+address syc_logo
+address $143
+address $110
+byte 4 1
+address s_wop_restarted
+address $144
+address $96
+byte 4 320
+address con_notifytime
+address $145
+address $146
+byte 4 1
+address wop_AutoswitchSongByNextMap
+address $147
+address $96
+byte 4 1
+address wop_AutoBindUnusedKeys
+address $148
+address $103
+byte 4 1
+align 4
+LABELV cvarTableSize
+byte 4 45
+export UI_RegisterCvars
+code
+proc UI_RegisterCvars 12 16
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cvarTable
+ASGNP4
+ADDRGP4 $153
+JUMPV
+LABELV $150
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+LABELV $151
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+LABELV $153
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cvarTableSize
+INDIRI4
+LTI4 $150
+CNSTP4 0
+ARGP4
+ADDRGP4 $154
+ARGP4
+ADDRGP4 $110
+ARGP4
+CNSTI4 80
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 $155
+ARGP4
+ADDRGP4 $110
+ARGP4
+CNSTI4 80
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+LABELV $149
+endproc UI_RegisterCvars 12 16
+bss
+align 4
+LABELV $157
+skip 4
+export UI_UpdateCvars
+code
+proc UI_UpdateCvars 16 4
+ADDRLP4 12
+ADDRGP4 trap_Cvar_Generation
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 $157
+INDIRI4
+NEI4 $158
+ADDRGP4 $156
+JUMPV
+LABELV $158
+ADDRGP4 $157
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cvarTable
+ASGNP4
+ADDRGP4 $163
+JUMPV
+LABELV $160
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $164
+ADDRGP4 $161
+JUMPV
+LABELV $164
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+LABELV $161
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+LABELV $163
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cvarTableSize
+INDIRI4
+LTI4 $160
+LABELV $156
+endproc UI_UpdateCvars 16 4
+import UI_HelpMenu_Cache
+import UI_HelpMenu_f
+import UI_HelpMenu
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import UI_InitGameinfo
+import UI_GetNumBots
+import UI_GetBotInfoByNumber
+import UI_GetNumArenas
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_VoiceIngame
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_GetVoiceGainClient
+import trap_GetVoiceMuteAll
+import trap_GetVoiceMuteClient
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_CIN_SetExtents
+import trap_CIN_StopCinematic
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_PlayCinematic
+import trap_RealTime
+import trap_S_StartBackgroundTrack
+import trap_S_StopBackgroundTrack
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_SaveCachedServers
+import trap_LAN_LoadCachedServers
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import BotListCompare
+import uis
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString2
+import UI_AutoWrappedString_LineCount
+import UI_DrawString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawIngameBG
+import UI_DrawStringNS
+import UI_ModelIcon
+import UI_DrawHandlePic1024
+import UI_AdjustFrom1024
+import UI_StopMusic
+import UI_StartCreditMusic
+import UI_StartMusic
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_ClearModelCache
+import UI_PrecacheClientModelname
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import UI_SpecifyPasswordMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import Demos_Cache
+import UI_DemosMenu
+import SetDefaultBinds_onUnusedKeys
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import SetupDefaultMenu_Cache
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import Music_NextTrack
+import Music_TriggerRestart
+import Music_Check
+import MusicMenu_Cache
+import MusicMenu_Open
+import MusicMenu_Shutdown
+import MusicMenu_Init
+import UI_CallVoteMenu
+import UI_InGameMenu
+import InGame_Cache
+import UI_SecretMenu
+import UI_InitBigCredits
+import UI_BigCredits_Cache
+import UI_CreditMenu
+import ExitMenu_Cache
+import ExitMenu_Init
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import listbar_bluecolor
+import text_color_bluehighlight
+import text_color_bluenormal
+import text_color_ighighlight
+import text_color_ignormal
+import listbar_igcolor
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_lightOrange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_click_sound
+import menu_switch_sound
+import menu_move_sound
+import ScrollList_Key
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+bss
+export wop_AutoBindUnusedKeys
+align 4
+LABELV wop_AutoBindUnusedKeys
+skip 272
+export wop_AutoswitchSongByNextMap
+align 4
+LABELV wop_AutoswitchSongByNextMap
+skip 272
+export con_notifytime
+align 4
+LABELV con_notifytime
+skip 272
+export s_wop_restarted
+align 4
+LABELV s_wop_restarted
+skip 272
+export syc_logo
+align 4
+LABELV syc_logo
+skip 272
+export spraycolor
+align 4
+LABELV spraycolor
+skip 272
+export ui_server16
+align 4
+LABELV ui_server16
+skip 272
+export ui_server15
+align 4
+LABELV ui_server15
+skip 272
+export ui_server14
+align 4
+LABELV ui_server14
+skip 272
+export ui_server13
+align 4
+LABELV ui_server13
+skip 272
+export ui_server12
+align 4
+LABELV ui_server12
+skip 272
+export ui_server11
+align 4
+LABELV ui_server11
+skip 272
+export ui_server10
+align 4
+LABELV ui_server10
+skip 272
+export ui_server9
+align 4
+LABELV ui_server9
+skip 272
+export ui_server8
+align 4
+LABELV ui_server8
+skip 272
+export ui_server7
+align 4
+LABELV ui_server7
+skip 272
+export ui_server6
+align 4
+LABELV ui_server6
+skip 272
+export ui_server5
+align 4
+LABELV ui_server5
+skip 272
+export ui_server4
+align 4
+LABELV ui_server4
+skip 272
+export ui_server3
+align 4
+LABELV ui_server3
+skip 272
+export ui_server2
+align 4
+LABELV ui_server2
+skip 272
+export ui_server1
+align 4
+LABELV ui_server1
+skip 272
+export ui_marks
+align 4
+LABELV ui_marks
+skip 272
+export ui_drawCrosshairNames
+align 4
+LABELV ui_drawCrosshairNames
+skip 272
+export ui_drawCrosshair
+align 4
+LABELV ui_drawCrosshair
+skip 272
+export ui_createGametype
+align 4
+LABELV ui_createGametype
+skip 272
+export ui_browserHidePrivate
+align 4
+LABELV ui_browserHidePrivate
+skip 272
+export ui_browserOnlyHumans
+align 4
+LABELV ui_browserOnlyHumans
+skip 272
+export ui_browserShowEmpty
+align 4
+LABELV ui_browserShowEmpty
+skip 272
+export ui_browserShowFull
+align 4
+LABELV ui_browserShowFull
+skip 272
+export ui_browserSortKey
+align 4
+LABELV ui_browserSortKey
+skip 272
+export ui_browserGameType
+align 4
+LABELV ui_browserGameType
+skip 272
+export ui_browserMaster
+align 4
+LABELV ui_browserMaster
+skip 272
+export ui_botsFile
+align 4
+LABELV ui_botsFile
+skip 272
+export ui_arenasFile
+align 4
+LABELV ui_arenasFile
+skip 272
+export ui_ctf_friendly
+align 4
+LABELV ui_ctf_friendly
+skip 272
+export ui_ctf_timelimit
+align 4
+LABELV ui_ctf_timelimit
+skip 272
+export ui_ctf_capturelimit
+align 4
+LABELV ui_ctf_capturelimit
+skip 272
+export ui_team_friendly
+align 4
+LABELV ui_team_friendly
+skip 272
+export ui_team_timelimit
+align 4
+LABELV ui_team_timelimit
+skip 272
+export ui_team_fraglimit
+align 4
+LABELV ui_team_fraglimit
+skip 272
+export ui_tourney_timelimit
+align 4
+LABELV ui_tourney_timelimit
+skip 272
+export ui_tourney_fraglimit
+align 4
+LABELV ui_tourney_fraglimit
+skip 272
+export ui_ffa_timelimit
+align 4
+LABELV ui_ffa_timelimit
+skip 272
+export ui_ffa_fraglimit
+align 4
+LABELV ui_ffa_fraglimit
+skip 272
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $155
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $154
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $148
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 65
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 66
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 85
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 115
+byte 1 0
+align 1
+LABELV $147
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 65
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 83
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 66
+byte 1 121
+byte 1 78
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $146
+byte 1 52
+byte 1 0
+align 1
+LABELV $145
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 105
+byte 1 102
+byte 1 121
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $144
+byte 1 115
+byte 1 95
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $143
+byte 1 115
+byte 1 121
+byte 1 99
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 0
+align 1
+LABELV $142
+byte 1 115
+byte 1 121
+byte 1 99
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $141
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 54
+byte 1 0
+align 1
+LABELV $140
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 53
+byte 1 0
+align 1
+LABELV $139
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 52
+byte 1 0
+align 1
+LABELV $138
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 51
+byte 1 0
+align 1
+LABELV $137
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 50
+byte 1 0
+align 1
+LABELV $136
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 49
+byte 1 0
+align 1
+LABELV $135
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $134
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 57
+byte 1 0
+align 1
+LABELV $133
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 56
+byte 1 0
+align 1
+LABELV $132
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 55
+byte 1 0
+align 1
+LABELV $131
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 54
+byte 1 0
+align 1
+LABELV $130
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 53
+byte 1 0
+align 1
+LABELV $129
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 52
+byte 1 0
+align 1
+LABELV $128
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 51
+byte 1 0
+align 1
+LABELV $127
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $126
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $125
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 115
+byte 1 0
+align 1
+LABELV $124
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $123
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $122
+byte 1 51
+byte 1 0
+align 1
+LABELV $121
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $120
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 72
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 80
+byte 1 114
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $119
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 79
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 72
+byte 1 117
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $118
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 69
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $117
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 70
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $116
+byte 1 53
+byte 1 0
+align 1
+LABELV $115
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 0
+align 1
+LABELV $114
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $113
+byte 1 50
+byte 1 0
+align 1
+LABELV $112
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $111
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $110
+byte 1 0
+align 1
+LABELV $109
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $108
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $107
+byte 1 51
+byte 1 48
+byte 1 0
+align 1
+LABELV $106
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $105
+byte 1 56
+byte 1 0
+align 1
+LABELV $104
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $103
+byte 1 49
+byte 1 0
+align 1
+LABELV $102
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $101
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $100
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $99
+byte 1 49
+byte 1 53
+byte 1 0
+align 1
+LABELV $98
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $97
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $96
+byte 1 48
+byte 1 0
+align 1
+LABELV $95
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $94
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $93
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
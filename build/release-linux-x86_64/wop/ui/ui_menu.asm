@@ -0,0 +1,1986 @@
+export Main_MenuEvent
+code
+proc Main_MenuEvent 8 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $80
+ADDRGP4 $79
+JUMPV
+LABELV $80
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LTI4 $82
+ADDRLP4 0
+INDIRI4
+CNSTI4 17
+GTI4 $82
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $93-40
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $93
+address $85
+address $86
+address $87
+address $88
+address $89
+address $92
+address $90
+address $91
+code
+LABELV $85
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_StartServerMenu
+CALLV
+pop
+ADDRGP4 $83
+JUMPV
+LABELV $86
+ADDRGP4 UI_ArenaServersMenu
+CALLV
+pop
+ADDRGP4 $83
+JUMPV
+LABELV $87
+ADDRGP4 UI_SetupMenu
+CALLV
+pop
+ADDRGP4 $83
+JUMPV
+LABELV $88
+ADDRGP4 UI_DemosMenu
+CALLV
+pop
+ADDRGP4 $83
+JUMPV
+LABELV $89
+ADDRGP4 UI_ModsMenu
+CALLV
+pop
+ADDRGP4 $83
+JUMPV
+LABELV $90
+ADDRGP4 UI_InitBigCredits
+CALLV
+pop
+ADDRGP4 $83
+JUMPV
+LABELV $91
+ADDRGP4 UI_SecretMenu
+CALLV
+pop
+ADDRGP4 $83
+JUMPV
+LABELV $92
+ADDRGP4 ExitMenu_Init
+CALLV
+pop
+LABELV $82
+LABELV $83
+LABELV $79
+endproc Main_MenuEvent 8 4
+export MainMenu_Cache
+proc MainMenu_Cache 0 4
+ADDRGP4 $96
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $97
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $98
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $99
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $100
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $101
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $102
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $103
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $104
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $105
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $106
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $107
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $108
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $109
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $95
+endproc MainMenu_Cache 0 4
+export ErrorMessage_Key
+proc ErrorMessage_Key 0 8
+ADDRGP4 $111
+ARGP4
+ADDRGP4 $112
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 UI_MainMenu
+CALLV
+pop
+ADDRGP4 menu_null_sound
+INDIRI4
+RETI4
+LABELV $110
+endproc ErrorMessage_Key 0 8
+data
+export CINhandle
+align 4
+LABELV CINhandle
+byte 4 -1
+lit
+align 4
+LABELV $114
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1059648963
+code
+proc Main_MenuDraw 48 32
+ADDRLP4 8
+ADDRGP4 $114
+INDIRB
+ASGNB 16
+ADDRGP4 s_main+1064
+ARGP4
+ADDRLP4 24
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 24
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 s_main+1320
+INDIRI4
+CNSTI4 0
+EQI4 $116
+ADDRGP4 uis+4
+INDIRI4
+ADDRGP4 s_main+1320
+INDIRI4
+SUBI4
+CNSTI4 5000
+GTI4 $116
+ADDRGP4 uis+4
+INDIRI4
+ADDRGP4 s_main+1320
+INDIRI4
+SUBI4
+CNSTI4 4750
+LEI4 $121
+ADDRLP4 0
+CNSTF4 1098907648
+CNSTI4 5000
+ADDRGP4 uis+4
+INDIRI4
+ADDRGP4 s_main+1320
+INDIRI4
+SUBI4
+SUBI4
+CVIF4 4
+CNSTF4 1132068864
+DIVF4
+MULF4
+ASGNF4
+ADDRGP4 $122
+JUMPV
+LABELV $121
+ADDRGP4 uis+4
+INDIRI4
+ADDRGP4 s_main+1320
+INDIRI4
+SUBI4
+CNSTI4 250
+LEI4 $127
+ADDRLP4 0
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 $128
+JUMPV
+LABELV $127
+ADDRLP4 0
+CNSTF4 1098907648
+ADDRGP4 uis+4
+INDIRI4
+ADDRGP4 s_main+1320
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1132068864
+DIVF4
+MULF4
+ASGNF4
+LABELV $128
+LABELV $122
+ADDRLP4 32
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+CNSTF4 1082130432
+ADDF4
+ASGNF4
+CNSTF4 1134559232
+CNSTF4 1048576000
+ADDRLP4 0
+INDIRF4
+ADDRLP4 32
+INDIRF4
+MULF4
+MULF4
+SUBF4
+ARGF4
+CNSTF4 1131413504
+ADDRLP4 0
+INDIRF4
+SUBF4
+ARGF4
+CNSTF4 1056964608
+ADDRLP4 32
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+MULF4
+ARGF4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 8
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRLP4 40
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+CNSTF4 1082130432
+ADDF4
+ASGNF4
+CNSTF4 1134559232
+CNSTF4 1048576000
+ADDRLP4 0
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+MULF4
+SUBF4
+ARGF4
+CNSTF4 1131413504
+ADDRLP4 0
+INDIRF4
+SUBF4
+ARGF4
+CNSTF4 1056964608
+ADDRLP4 40
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+MULF4
+ARGF4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRF4
+MULF4
+ARGF4
+ADDRGP4 colorBlack
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_DrawRect
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTF4 1131413504
+ADDRLP4 0
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+CVFI4 4
+ARGI4
+ADDRGP4 s_main+1064
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawStringNS
+CALLV
+pop
+LABELV $116
+ADDRGP4 s_errorMessage+296
+ARGP4
+ADDRLP4 28
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 28
+INDIRU4
+CNSTU4 0
+EQU4 $134
+CNSTI4 320
+ARGI4
+CNSTI4 192
+ARGI4
+CNSTI4 600
+ARGI4
+CNSTI4 20
+ARGI4
+ADDRGP4 s_errorMessage+296
+ARGP4
+CNSTI4 2065
+ARGI4
+ADDRGP4 menu_text_color
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_DrawString_AutoWrapped
+CALLV
+pop
+ADDRGP4 $135
+JUMPV
+LABELV $134
+ADDRGP4 s_main
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+LABELV $135
+ADDRGP4 CINhandle
+INDIRI4
+CNSTI4 0
+LTI4 $138
+ADDRGP4 CINhandle
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_RunCinematic
+CALLI4
+pop
+ADDRGP4 CINhandle
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_DrawCinematic
+CALLV
+pop
+LABELV $138
+LABELV $113
+endproc Main_MenuDraw 48 32
+export Main_MenuKey
+proc Main_MenuKey 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 27
+EQI4 $143
+ADDRFP4 0
+INDIRI4
+CNSTI4 179
+NEI4 $141
+LABELV $143
+CNSTI4 0
+RETI4
+ADDRGP4 $140
+JUMPV
+LABELV $141
+ADDRGP4 s_main
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 Menu_DefaultKey
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $140
+endproc Main_MenuKey 8 8
+export UI_MainMenu
+proc UI_MainMenu 44 24
+ADDRGP4 $145
+ARGP4
+ADDRGP4 $146
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $147
+ARGP4
+ADDRGP4 $112
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $150
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CVFI4 4
+CNSTI4 0
+EQI4 $148
+ADDRGP4 $151
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $152
+ADDRLP4 4
+ARGP4
+ADDRGP4 $154
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $152
+ADDRGP4 CINhandle
+INDIRI4
+CNSTI4 0
+LTI4 $155
+ADDRGP4 CINhandle
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_StopCinematic
+CALLI4
+pop
+LABELV $155
+ADDRLP4 4
+ARGP4
+ADDRLP4 36
+CNSTI4 10
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+CNSTI4 160
+ARGI4
+CNSTI4 120
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRLP4 40
+ADDRGP4 trap_CIN_PlayCinematic
+CALLI4
+ASGNI4
+ADDRGP4 CINhandle
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 trap_S_StopBackgroundTrack
+CALLV
+pop
+LABELV $148
+ADDRGP4 s_main
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1324
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 s_errorMessage
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 4392
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 MainMenu_Cache
+CALLV
+pop
+ADDRGP4 $111
+ARGP4
+ADDRGP4 s_errorMessage+296
+ARGP4
+CNSTI4 4096
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 s_errorMessage+296
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRU4
+CNSTU4 0
+EQU4 $159
+ADDRGP4 s_errorMessage+268
+ADDRGP4 Main_MenuDraw
+ASGNP4
+ADDRGP4 s_errorMessage+272
+ADDRGP4 ErrorMessage_Key
+ASGNP4
+ADDRGP4 s_errorMessage+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_errorMessage+276
+CNSTI4 1
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 uis+16
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_errorMessage
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+ADDRGP4 $144
+JUMPV
+LABELV $159
+ADDRGP4 s_main+268
+ADDRGP4 Main_MenuDraw
+ASGNP4
+ADDRGP4 s_main+272
+ADDRGP4 Main_MenuKey
+ASGNP4
+ADDRGP4 s_main+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_main+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_main+284
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_main+288
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_main+296
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_main+296+4
+ADDRGP4 $98
+ASGNP4
+ADDRGP4 s_main+296+48
+CNSTU4 132
+ASGNU4
+ADDRGP4 s_main+296+16
+CNSTI4 497
+ASGNI4
+ADDRGP4 s_main+296+20
+CNSTI4 140
+ASGNI4
+ADDRGP4 s_main+296+12
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_main+296+52
+ADDRGP4 Main_MenuEvent
+ASGNP4
+ADDRGP4 s_main+296+80
+CNSTI4 120
+ASGNI4
+ADDRGP4 s_main+296+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_main+296+64
+ADDRGP4 $99
+ASGNP4
+ADDRGP4 s_main+296+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_main
+ARGP4
+ADDRGP4 s_main+296
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_main+392
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_main+392+4
+ADDRGP4 $96
+ASGNP4
+ADDRGP4 s_main+392+48
+CNSTU4 132
+ASGNU4
+ADDRGP4 s_main+392+16
+CNSTI4 508
+ASGNI4
+ADDRGP4 s_main+392+20
+CNSTI4 175
+ASGNI4
+ADDRGP4 s_main+392+12
+CNSTI4 11
+ASGNI4
+ADDRGP4 s_main+392+52
+ADDRGP4 Main_MenuEvent
+ASGNP4
+ADDRGP4 s_main+392+80
+CNSTI4 120
+ASGNI4
+ADDRGP4 s_main+392+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_main+392+64
+ADDRGP4 $97
+ASGNP4
+ADDRGP4 s_main+392+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_main
+ARGP4
+ADDRGP4 s_main+392
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_main+488
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_main+488+4
+ADDRGP4 $100
+ASGNP4
+ADDRGP4 s_main+488+48
+CNSTU4 132
+ASGNU4
+ADDRGP4 s_main+488+16
+CNSTI4 496
+ASGNI4
+ADDRGP4 s_main+488+20
+CNSTI4 210
+ASGNI4
+ADDRGP4 s_main+488+12
+CNSTI4 12
+ASGNI4
+ADDRGP4 s_main+488+52
+ADDRGP4 Main_MenuEvent
+ASGNP4
+ADDRGP4 s_main+488+80
+CNSTI4 120
+ASGNI4
+ADDRGP4 s_main+488+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_main+488+64
+ADDRGP4 $101
+ASGNP4
+ADDRGP4 s_main+488+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_main
+ARGP4
+ADDRGP4 s_main+488
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_main+584
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_main+584+4
+ADDRGP4 $102
+ASGNP4
+ADDRGP4 s_main+584+48
+CNSTU4 132
+ASGNU4
+ADDRGP4 s_main+584+16
+CNSTI4 510
+ASGNI4
+ADDRGP4 s_main+584+20
+CNSTI4 245
+ASGNI4
+ADDRGP4 s_main+584+12
+CNSTI4 13
+ASGNI4
+ADDRGP4 s_main+584+52
+ADDRGP4 Main_MenuEvent
+ASGNP4
+ADDRGP4 s_main+584+80
+CNSTI4 120
+ASGNI4
+ADDRGP4 s_main+584+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_main+584+64
+ADDRGP4 $103
+ASGNP4
+ADDRGP4 s_main+584+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_main
+ARGP4
+ADDRGP4 s_main+584
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_main+680
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_main+680+4
+ADDRGP4 $104
+ASGNP4
+ADDRGP4 s_main+680+48
+CNSTU4 132
+ASGNU4
+ADDRGP4 s_main+680+16
+CNSTI4 516
+ASGNI4
+ADDRGP4 s_main+680+20
+CNSTI4 280
+ASGNI4
+ADDRGP4 s_main+680+12
+CNSTI4 14
+ASGNI4
+ADDRGP4 s_main+680+52
+ADDRGP4 Main_MenuEvent
+ASGNP4
+ADDRGP4 s_main+680+80
+CNSTI4 80
+ASGNI4
+ADDRGP4 s_main+680+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_main+680+64
+ADDRGP4 $105
+ASGNP4
+ADDRGP4 s_main+680+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_main
+ARGP4
+ADDRGP4 s_main+680
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_main+776
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_main+776+4
+ADDRGP4 $106
+ASGNP4
+ADDRGP4 s_main+776+48
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_main+776+16
+CNSTI4 530
+ASGNI4
+ADDRGP4 s_main+776+20
+CNSTI4 315
+ASGNI4
+ADDRGP4 s_main+776+12
+CNSTI4 15
+ASGNI4
+ADDRGP4 s_main+776+52
+ADDRGP4 Main_MenuEvent
+ASGNP4
+ADDRGP4 s_main+776+80
+CNSTI4 80
+ASGNI4
+ADDRGP4 s_main+776+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_main+776+64
+ADDRGP4 $107
+ASGNP4
+ADDRGP4 s_main+776+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_main
+ARGP4
+ADDRGP4 s_main+776
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_main+872
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_main+872+4
+ADDRGP4 $108
+ASGNP4
+ADDRGP4 s_main+872+48
+CNSTU4 132
+ASGNU4
+ADDRGP4 s_main+872+16
+CNSTI4 505
+ASGNI4
+ADDRGP4 s_main+872+20
+CNSTI4 420
+ASGNI4
+ADDRGP4 s_main+872+12
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_main+872+52
+ADDRGP4 Main_MenuEvent
+ASGNP4
+ADDRGP4 s_main+872+80
+CNSTI4 120
+ASGNI4
+ADDRGP4 s_main+872+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_main+872+64
+ADDRGP4 $109
+ASGNP4
+ADDRGP4 s_main+872+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_main
+ARGP4
+ADDRGP4 s_main+872
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_main+968
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_main+968+48
+CNSTU4 1054720
+ASGNU4
+ADDRGP4 s_main+968+16
+CNSTI4 129
+ASGNI4
+ADDRGP4 s_main+968+20
+CNSTI4 431
+ASGNI4
+ADDRGP4 s_main+968+12
+CNSTI4 17
+ASGNI4
+ADDRGP4 s_main+968+52
+ADDRGP4 Main_MenuEvent
+ASGNP4
+ADDRGP4 s_main+968+80
+CNSTI4 22
+ASGNI4
+ADDRGP4 s_main+968+84
+CNSTI4 22
+ASGNI4
+ADDRGP4 s_main
+ARGP4
+ADDRGP4 s_main+968
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 uis+16
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_main
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $144
+endproc UI_MainMenu 44 24
+bss
+align 4
+LABELV s_errorMessage
+skip 4392
+align 4
+LABELV s_main
+skip 1324
+import UI_HelpMenu_Cache
+import UI_HelpMenu_f
+import UI_HelpMenu
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import UI_InitGameinfo
+import UI_GetNumBots
+import UI_GetBotInfoByNumber
+import UI_GetNumArenas
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_VoiceIngame
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_GetVoiceGainClient
+import trap_GetVoiceMuteAll
+import trap_GetVoiceMuteClient
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_CIN_SetExtents
+import trap_CIN_StopCinematic
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_PlayCinematic
+import trap_RealTime
+import trap_S_StartBackgroundTrack
+import trap_S_StopBackgroundTrack
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_SaveCachedServers
+import trap_LAN_LoadCachedServers
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import BotListCompare
+import uis
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString2
+import UI_AutoWrappedString_LineCount
+import UI_DrawString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawIngameBG
+import UI_DrawStringNS
+import UI_ModelIcon
+import UI_DrawHandlePic1024
+import UI_AdjustFrom1024
+import UI_StopMusic
+import UI_StartCreditMusic
+import UI_StartMusic
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_ClearModelCache
+import UI_PrecacheClientModelname
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import UI_SpecifyPasswordMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import Demos_Cache
+import UI_DemosMenu
+import SetDefaultBinds_onUnusedKeys
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import SetupDefaultMenu_Cache
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import Music_NextTrack
+import Music_TriggerRestart
+import Music_Check
+import MusicMenu_Cache
+import MusicMenu_Open
+import MusicMenu_Shutdown
+import MusicMenu_Init
+import UI_CallVoteMenu
+import UI_InGameMenu
+import InGame_Cache
+import UI_SecretMenu
+import UI_InitBigCredits
+import UI_BigCredits_Cache
+import UI_CreditMenu
+import ExitMenu_Cache
+import ExitMenu_Init
+import UI_UpdateCvars
+import UI_RegisterCvars
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import listbar_bluecolor
+import text_color_bluehighlight
+import text_color_bluenormal
+import text_color_ighighlight
+import text_color_ignormal
+import listbar_igcolor
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_lightOrange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_click_sound
+import menu_switch_sound
+import menu_move_sound
+import ScrollList_Key
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import wop_AutoBindUnusedKeys
+import wop_AutoswitchSongByNextMap
+import con_notifytime
+import s_wop_restarted
+import syc_logo
+import spraycolor
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_createGametype
+import ui_browserHidePrivate
+import ui_browserOnlyHumans
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $154
+byte 1 105
+byte 1 100
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 46
+byte 1 114
+byte 1 111
+byte 1 113
+byte 1 0
+align 1
+LABELV $151
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 67
+byte 1 105
+byte 1 110
+byte 1 84
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $150
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 67
+byte 1 105
+byte 1 110
+byte 1 84
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $147
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $146
+byte 1 49
+byte 1 0
+align 1
+LABELV $145
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $112
+byte 1 0
+align 1
+LABELV $111
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $109
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 47
+byte 1 66
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 67
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 49
+byte 1 0
+align 1
+LABELV $108
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 47
+byte 1 66
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 67
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 48
+byte 1 0
+align 1
+LABELV $107
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 47
+byte 1 66
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 69
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 49
+byte 1 0
+align 1
+LABELV $106
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 47
+byte 1 66
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 69
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 48
+byte 1 0
+align 1
+LABELV $105
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 47
+byte 1 66
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 115
+byte 1 49
+byte 1 0
+align 1
+LABELV $104
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 47
+byte 1 66
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 115
+byte 1 48
+byte 1 0
+align 1
+LABELV $103
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 47
+byte 1 66
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 115
+byte 1 49
+byte 1 0
+align 1
+LABELV $102
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 47
+byte 1 66
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 115
+byte 1 48
+byte 1 0
+align 1
+LABELV $101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 47
+byte 1 66
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 112
+byte 1 49
+byte 1 0
+align 1
+LABELV $100
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 47
+byte 1 66
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 112
+byte 1 48
+byte 1 0
+align 1
+LABELV $99
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 47
+byte 1 66
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $98
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 47
+byte 1 66
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 48
+byte 1 0
+align 1
+LABELV $97
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 47
+byte 1 66
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 77
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 105
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $96
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 47
+byte 1 66
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 77
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 105
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 48
+byte 1 0
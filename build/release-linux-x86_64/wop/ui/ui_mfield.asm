@@ -0,0 +1,2512 @@
+export MField_Draw
+code
+proc MField_Draw 1060 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 1048
+INDIRU4
+CNSTU4 1
+ADDU4
+CVUI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+GTI4 $78
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $79
+JUMPV
+LABELV $78
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ADDRLP4 4
+INDIRI4
+LEI4 $80
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $82
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $82
+LABELV $80
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $79
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ADDRLP4 4
+INDIRI4
+LEI4 $84
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $84
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $86
+ADDRGP4 $88
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $86
+ADDRLP4 12
+ARGP4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRFP4 12
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+NEI4 $89
+ADDRGP4 $77
+JUMPV
+LABELV $89
+ADDRLP4 1052
+ADDRGP4 trap_Key_GetOverstrikeMode
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+EQI4 $91
+ADDRLP4 1040
+CNSTI4 11
+ASGNI4
+ADDRGP4 $92
+JUMPV
+LABELV $91
+ADDRLP4 1040
+CNSTI4 10
+ASGNI4
+LABELV $92
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+CNSTI4 -16385
+BANDI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $93
+ADDRLP4 1036
+CNSTI4 8
+ASGNI4
+ADDRGP4 $94
+JUMPV
+LABELV $93
+ADDRFP4 12
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $95
+ADDRLP4 1036
+CNSTI4 32
+ASGNI4
+ADDRGP4 $96
+JUMPV
+LABELV $95
+ADDRLP4 1036
+CNSTI4 16
+ASGNI4
+LABELV $96
+LABELV $94
+ADDRFP4 12
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $97
+ADDRLP4 12
+ARGP4
+ADDRLP4 1056
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 1056
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+MULI4
+CNSTI4 2
+DIVI4
+SUBI4
+ASGNI4
+ADDRGP4 $98
+JUMPV
+LABELV $97
+ADDRFP4 12
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $99
+ADDRLP4 12
+ARGP4
+ADDRLP4 1056
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 1056
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+LABELV $99
+LABELV $98
+ADDRFP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ADDRLP4 1036
+INDIRI4
+MULI4
+ADDI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 -4
+BANDI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawChar
+CALLV
+pop
+LABELV $77
+endproc MField_Draw 1060 20
+proc MField_Paste 76 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_GetClipboardData
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 72
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 68
+ADDRLP4 72
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $105
+JUMPV
+LABELV $102
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRGP4 MField_CharEvent
+CALLV
+pop
+LABELV $103
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $105
+ADDRLP4 0
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LTI4 $102
+LABELV $101
+endproc MField_Paste 76 8
+proc MField_KeyDownEvent 64 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 139
+EQI4 $109
+ADDRFP4 4
+INDIRI4
+CNSTI4 170
+NEI4 $107
+LABELV $109
+CNSTI4 138
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_Key_IsDown
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $107
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 MField_Paste
+CALLV
+pop
+ADDRGP4 $106
+JUMPV
+LABELV $107
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 12
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 140
+EQI4 $112
+ADDRFP4 4
+INDIRI4
+CNSTI4 171
+NEI4 $110
+LABELV $112
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+GEI4 $106
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 24
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRGP4 $106
+JUMPV
+LABELV $110
+ADDRFP4 4
+INDIRI4
+CNSTI4 135
+EQI4 $117
+ADDRFP4 4
+INDIRI4
+CNSTI4 165
+NEI4 $115
+LABELV $117
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+GEI4 $118
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $118
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDI4
+LTI4 $106
+ADDRLP4 28
+INDIRI4
+ADDRLP4 0
+INDIRI4
+GTI4 $106
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $106
+JUMPV
+LABELV $115
+ADDRFP4 4
+INDIRI4
+CNSTI4 134
+EQI4 $124
+ADDRFP4 4
+INDIRI4
+CNSTI4 163
+NEI4 $122
+LABELV $124
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+LEI4 $125
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $125
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+GEI4 $106
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $106
+JUMPV
+LABELV $122
+ADDRFP4 4
+INDIRI4
+CNSTI4 143
+EQI4 $132
+ADDRFP4 4
+INDIRI4
+CNSTI4 160
+EQI4 $132
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 97
+NEI4 $129
+CNSTI4 137
+ARGI4
+ADDRLP4 36
+ADDRGP4 trap_Key_IsDown
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $129
+LABELV $132
+ADDRFP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $106
+JUMPV
+LABELV $129
+ADDRFP4 4
+INDIRI4
+CNSTI4 144
+EQI4 $136
+ADDRFP4 4
+INDIRI4
+CNSTI4 166
+EQI4 $136
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 101
+NEI4 $133
+CNSTI4 137
+ARGI4
+ADDRLP4 48
+ADDRGP4 trap_Key_IsDown
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $133
+LABELV $136
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $106
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $106
+JUMPV
+LABELV $133
+ADDRFP4 4
+INDIRI4
+CNSTI4 139
+EQI4 $141
+ADDRFP4 4
+INDIRI4
+CNSTI4 170
+NEI4 $139
+LABELV $141
+ADDRLP4 60
+ADDRGP4 trap_Key_GetOverstrikeMode
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+NEI4 $143
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRGP4 $144
+JUMPV
+LABELV $143
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+LABELV $144
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRGP4 trap_Key_SetOverstrikeMode
+CALLV
+pop
+LABELV $139
+LABELV $106
+endproc MField_KeyDownEvent 64 12
+proc MField_CharEvent 36 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 22
+NEI4 $146
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 MField_Paste
+CALLV
+pop
+ADDRGP4 $145
+JUMPV
+LABELV $146
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $148
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 MField_Clear
+CALLV
+pop
+ADDRGP4 $145
+JUMPV
+LABELV $148
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 8
+NEI4 $150
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+LEI4 $145
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 12
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 -1
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRLP4 12
+INDIRI4
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+GEI4 $145
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $145
+JUMPV
+LABELV $150
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $156
+ADDRFP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $145
+JUMPV
+LABELV $156
+ADDRFP4 4
+INDIRI4
+CNSTI4 5
+NEI4 $158
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $145
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $145
+JUMPV
+LABELV $158
+ADDRFP4 4
+INDIRI4
+CNSTI4 32
+GEI4 $162
+ADDRGP4 $145
+JUMPV
+LABELV $162
+ADDRLP4 8
+ADDRGP4 trap_Key_GetOverstrikeMode
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $164
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 255
+EQI4 $168
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $165
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LTI4 $165
+LABELV $168
+ADDRGP4 $145
+JUMPV
+LABELV $164
+ADDRLP4 0
+INDIRI4
+CNSTI4 255
+EQI4 $171
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $169
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $169
+LABELV $171
+ADDRGP4 $145
+JUMPV
+LABELV $169
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 24
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $165
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+ADDRFP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $174
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $172
+LABELV $174
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $172
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $175
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $175
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+NEI4 $177
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $177
+LABELV $145
+endproc MField_CharEvent 36 12
+export MField_Clear
+proc MField_Clear 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $179
+endproc MField_Clear 0 0
+export MenuField_Init
+proc MenuField_Init 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRGP4 MField_Clear
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 2
+BANDU4
+CNSTU4 0
+EQU4 $181
+ADDRLP4 0
+CNSTI4 8
+ASGNI4
+ADDRLP4 8
+CNSTI4 16
+ASGNI4
+ADDRGP4 $182
+JUMPV
+LABELV $181
+ADDRLP4 12
+CNSTI4 16
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $182
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $183
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 12
+INDIRU4
+CNSTU4 1
+ADDU4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+MULU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $184
+JUMPV
+LABELV $183
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $184
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $180
+endproc MenuField_Init 32 4
+export MenuField_Draw
+proc MenuField_Draw 84 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 2
+BANDU4
+CNSTU4 0
+EQU4 $186
+ADDRLP4 16
+CNSTI4 8
+ASGNI4
+ADDRLP4 0
+CNSTI4 16
+ASGNI4
+ADDRGP4 $187
+JUMPV
+LABELV $186
+ADDRLP4 16
+CNSTI4 16
+ASGNI4
+ADDRLP4 0
+CNSTI4 32
+ASGNI4
+LABELV $187
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 32
+INDIRP4
+CVPU4 4
+NEU4 $188
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+ADDRGP4 $189
+JUMPV
+LABELV $188
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $189
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 8192
+BANDU4
+CNSTU4 0
+EQU4 $190
+ADDRLP4 12
+ADDRGP4 text_color_disabled
+ASGNP4
+ADDRGP4 $191
+JUMPV
+LABELV $190
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $192
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 8388608
+BANDU4
+CNSTU4 0
+EQU4 $194
+ADDRLP4 12
+ADDRGP4 text_color_bluehighlight
+ASGNP4
+ADDRGP4 $193
+JUMPV
+LABELV $194
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 2097152
+BANDU4
+CNSTU4 0
+EQU4 $197
+ADDRLP4 36
+ADDRGP4 text_color_ighighlight
+ASGNP4
+ADDRGP4 $198
+JUMPV
+LABELV $197
+ADDRLP4 36
+ADDRGP4 text_color_highlight
+ASGNP4
+LABELV $198
+ADDRLP4 12
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRGP4 $193
+JUMPV
+LABELV $192
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 8388608
+BANDU4
+CNSTU4 0
+EQU4 $199
+ADDRLP4 12
+ADDRGP4 text_color_bluenormal
+ASGNP4
+ADDRGP4 $200
+JUMPV
+LABELV $199
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 2097152
+BANDU4
+CNSTU4 0
+EQU4 $202
+ADDRLP4 36
+ADDRGP4 text_color_ignormal
+ASGNP4
+ADDRGP4 $203
+JUMPV
+LABELV $202
+ADDRLP4 36
+ADDRGP4 text_color_normal
+ASGNP4
+LABELV $203
+ADDRLP4 12
+ADDRLP4 36
+INDIRP4
+ASGNP4
+LABELV $200
+LABELV $193
+LABELV $191
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $204
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 8388608
+BANDU4
+CNSTU4 0
+EQU4 $206
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 48
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+SUBI4
+ADDRLP4 48
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+SUBI4
+ADDRLP4 48
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 listbar_bluecolor
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRGP4 $207
+JUMPV
+LABELV $206
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 2097152
+BANDU4
+CNSTU4 0
+EQU4 $208
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 64
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 56
+INDIRI4
+SUBI4
+ADDRLP4 64
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+SUBI4
+ADDRLP4 64
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 listbar_igcolor
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRGP4 $209
+JUMPV
+LABELV $208
+ADDRLP4 72
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 76
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 80
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+SUBI4
+ADDRLP4 80
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+SUBI4
+ADDRLP4 80
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 listbar_color
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+LABELV $209
+LABELV $207
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 13
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4097
+BORI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawChar
+CALLV
+pop
+LABELV $204
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $210
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -16385
+BANDI4
+CNSTI4 2
+BORI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $210
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 MField_Draw
+CALLV
+pop
+LABELV $185
+endproc MenuField_Draw 84 20
+export MenuField_Key
+proc MenuField_Key 44 8
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 132
+EQI4 $214
+ADDRLP4 8
+CNSTI4 133
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $214
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+GTI4 $226
+LABELV $225
+ADDRLP4 16
+CNSTI4 9
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $214
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $213
+LABELV $227
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+EQI4 $215
+ADDRGP4 $213
+JUMPV
+LABELV $226
+ADDRLP4 0
+INDIRI4
+CNSTI4 167
+EQI4 $214
+ADDRLP4 24
+CNSTI4 169
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $215
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+GTI4 $229
+LABELV $228
+ADDRLP4 0
+INDIRI4
+CNSTI4 161
+EQI4 $214
+ADDRGP4 $213
+JUMPV
+LABELV $229
+ADDRLP4 0
+INDIRI4
+CNSTI4 185
+LTI4 $213
+ADDRLP4 0
+INDIRI4
+CNSTI4 188
+GTI4 $213
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $230-740
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $230
+address $215
+address $215
+address $215
+address $215
+code
+LABELV $215
+ADDRFP4 4
+INDIRP4
+CNSTI4 9
+ASGNI4
+ADDRGP4 $214
+JUMPV
+LABELV $213
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $217
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1025
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 524288
+BANDU4
+CNSTU4 0
+EQU4 $219
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 Q_islower
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $219
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+SUBI4
+ASGNI4
+ADDRGP4 $220
+JUMPV
+LABELV $219
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 262144
+BANDU4
+CNSTU4 0
+EQU4 $221
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 Q_isupper
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $221
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 -32
+SUBI4
+ASGNI4
+ADDRGP4 $222
+JUMPV
+LABELV $221
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 32
+BANDU4
+CNSTU4 0
+EQU4 $223
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 Q_isalpha
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $223
+ADDRGP4 menu_buzz_sound
+INDIRI4
+RETI4
+ADDRGP4 $212
+JUMPV
+LABELV $223
+LABELV $222
+LABELV $220
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 MField_CharEvent
+CALLV
+pop
+ADDRGP4 $214
+JUMPV
+LABELV $217
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 MField_KeyDownEvent
+CALLV
+pop
+LABELV $214
+CNSTI4 0
+RETI4
+LABELV $212
+endproc MenuField_Key 44 8
+import UI_HelpMenu_Cache
+import UI_HelpMenu_f
+import UI_HelpMenu
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import UI_InitGameinfo
+import UI_GetNumBots
+import UI_GetBotInfoByNumber
+import UI_GetNumArenas
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_VoiceIngame
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_GetVoiceGainClient
+import trap_GetVoiceMuteAll
+import trap_GetVoiceMuteClient
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_CIN_SetExtents
+import trap_CIN_StopCinematic
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_PlayCinematic
+import trap_RealTime
+import trap_S_StartBackgroundTrack
+import trap_S_StopBackgroundTrack
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_SaveCachedServers
+import trap_LAN_LoadCachedServers
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import BotListCompare
+import uis
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString2
+import UI_AutoWrappedString_LineCount
+import UI_DrawString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawIngameBG
+import UI_DrawStringNS
+import UI_ModelIcon
+import UI_DrawHandlePic1024
+import UI_AdjustFrom1024
+import UI_StopMusic
+import UI_StartCreditMusic
+import UI_StartMusic
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_ClearModelCache
+import UI_PrecacheClientModelname
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import UI_SpecifyPasswordMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import Demos_Cache
+import UI_DemosMenu
+import SetDefaultBinds_onUnusedKeys
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import SetupDefaultMenu_Cache
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import Music_NextTrack
+import Music_TriggerRestart
+import Music_Check
+import MusicMenu_Cache
+import MusicMenu_Open
+import MusicMenu_Shutdown
+import MusicMenu_Init
+import UI_CallVoteMenu
+import UI_InGameMenu
+import InGame_Cache
+import UI_SecretMenu
+import UI_InitBigCredits
+import UI_BigCredits_Cache
+import UI_CreditMenu
+import ExitMenu_Cache
+import ExitMenu_Init
+import UI_MainMenu
+import MainMenu_Cache
+import UI_UpdateCvars
+import UI_RegisterCvars
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import listbar_bluecolor
+import text_color_bluehighlight
+import text_color_bluenormal
+import text_color_ighighlight
+import text_color_ignormal
+import listbar_igcolor
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_lightOrange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_click_sound
+import menu_switch_sound
+import menu_move_sound
+import ScrollList_Key
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import wop_AutoBindUnusedKeys
+import wop_AutoswitchSongByNextMap
+import con_notifytime
+import s_wop_restarted
+import syc_logo
+import spraycolor
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_createGametype
+import ui_browserHidePrivate
+import ui_browserOnlyHumans
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $88
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 76
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 62
+byte 1 61
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 82
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 82
+byte 1 83
+byte 1 0
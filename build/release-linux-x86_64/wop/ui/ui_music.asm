@@ -0,0 +1,3774 @@
+code
+proc Playlist_AddTrack 20 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 musicInfo+19600
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $83
+ADDRFP4 4
+INDIRI4
+ADDRGP4 musicInfo+19600
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $86
+ADDRFP4 0
+INDIRI4
+ADDRGP4 musicInfo+19600
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+NEI4 $86
+ADDRGP4 musicInfo+19612
+CNSTI4 0
+ASGNI4
+ADDRGP4 trap_S_StopBackgroundTrack
+CALLV
+pop
+ADDRGP4 musicInfo+19600
+INDIRP4
+CVPU4 4
+ADDRGP4 musicInfo+19604
+INDIRP4
+CVPU4 4
+NEU4 $91
+ADDRGP4 musicInfo+19604
+CNSTP4 0
+ASGNP4
+LABELV $91
+ADDRLP4 0
+ADDRGP4 musicInfo+19600
+INDIRP4
+ASGNP4
+ADDRGP4 musicInfo+19600
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 freeOrderItems
+INDIRP4
+ASGNP4
+ADDRGP4 freeOrderItems
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $82
+JUMPV
+LABELV $86
+ADDRLP4 8
+ADDRGP4 musicInfo+19600
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRGP4 $101
+JUMPV
+LABELV $98
+ADDRFP4 0
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+NEI4 $103
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $103
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 musicInfo+19604
+INDIRP4
+CVPU4 4
+NEU4 $105
+ADDRGP4 musicInfo+19604
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $105
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 freeOrderItems
+INDIRP4
+ASGNP4
+ADDRGP4 freeOrderItems
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $82
+JUMPV
+LABELV $103
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $99
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $101
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $98
+LABELV $83
+ADDRGP4 freeOrderItems
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $109
+ADDRGP4 $111
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $82
+JUMPV
+LABELV $109
+ADDRLP4 8
+ADDRGP4 freeOrderItems
+ASGNP4
+ADDRLP4 12
+ADDRLP4 8
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRGP4 musicInfo+19600
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $112
+ADDRGP4 musicInfo+19604
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 musicInfo+19600
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $113
+JUMPV
+LABELV $112
+ADDRGP4 musicInfo+19604
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 musicInfo+19604
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $113
+ADDRLP4 0
+INDIRP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $119
+ADDRGP4 Music_Check
+CALLV
+pop
+LABELV $119
+LABELV $82
+endproc Playlist_AddTrack 20 4
+proc Playlist_Clear 8 0
+ADDRGP4 freeOrderItems
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $122
+ADDRGP4 freeOrderItems
+ADDRGP4 musicInfo+19600
+INDIRP4
+ASGNP4
+ADDRGP4 $123
+JUMPV
+LABELV $122
+ADDRLP4 0
+ADDRGP4 freeOrderItems
+INDIRP4
+ASGNP4
+ADDRGP4 $128
+JUMPV
+LABELV $125
+LABELV $126
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $128
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $125
+ADDRLP4 0
+INDIRP4
+ADDRGP4 musicInfo+19600
+INDIRP4
+ASGNP4
+LABELV $123
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRGP4 musicInfo+19604
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 musicInfo+19600
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 musicInfo+19612
+CNSTI4 0
+ASGNI4
+ADDRGP4 trap_S_StopBackgroundTrack
+CALLV
+pop
+LABELV $121
+endproc Playlist_Clear 8 0
+proc Playlist_AddAllTracks 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 Playlist_Clear
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $137
+JUMPV
+LABELV $134
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $142
+JUMPV
+LABELV $139
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Playlist_AddTrack
+CALLV
+pop
+LABELV $140
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $142
+ADDRLP4 0
+INDIRI4
+CNSTI4 1960
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 musicInfo+1956
+ADDP4
+INDIRI4
+LTI4 $139
+LABELV $135
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $137
+ADDRLP4 4
+INDIRI4
+ADDRGP4 musicInfo+19608
+INDIRI4
+LTI4 $134
+LABELV $133
+endproc Playlist_AddAllTracks 8 12
+proc SortTracks 16 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 64
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $144
+endproc SortTracks 16 8
+data
+align 4
+LABELV musicInitialized
+byte 4 0
+export MusicMenu_Init
+code
+proc MusicMenu_Init 6260 20
+ADDRGP4 musicInitialized
+CNSTI4 1
+ASGNI4
+ADDRGP4 musicInfo
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 19616
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 playOrderMemory
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1800
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 freeOrderItems
+ADDRGP4 playOrderMemory
+ASGNP4
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+LABELV $146
+ADDRLP4 2116
+CNSTI4 12
+ADDRLP4 56
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 2116
+INDIRI4
+ADDRGP4 playOrderMemory
+ADDP4
+ADDRLP4 2116
+INDIRI4
+ADDRGP4 playOrderMemory+12
+ADDP4
+ASGNP4
+LABELV $147
+ADDRLP4 56
+ADDRLP4 56
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 149
+LTI4 $146
+ADDRGP4 $151
+ARGP4
+ADDRGP4 $152
+ARGP4
+ADDRLP4 1092
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 2116
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 1088
+ADDRLP4 2116
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 1092
+ASGNP4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 10
+LEI4 $153
+ADDRLP4 1088
+CNSTI4 10
+ASGNI4
+LABELV $153
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRGP4 $158
+JUMPV
+LABELV $155
+ADDRLP4 52
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $159
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRGP4 $156
+JUMPV
+LABELV $159
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 2120
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 60
+ADDRLP4 2120
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRGP4 $163
+ARGP4
+ADDRLP4 2124
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2124
+INDIRI4
+CNSTI4 0
+EQI4 $165
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRGP4 $164
+ARGP4
+ADDRLP4 2128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2128
+INDIRI4
+CNSTI4 0
+NEI4 $161
+LABELV $165
+ADDRGP4 $156
+JUMPV
+LABELV $161
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 52
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $166
+ADDRLP4 16
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $167
+JUMPV
+LABELV $166
+ADDRLP4 16
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $168
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $167
+CNSTI4 1960
+ADDRGP4 musicInfo+19608
+INDIRI4
+MULI4
+ADDRGP4 musicInfo+1924
+ADDP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $175
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 2132
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 2132
+INDIRP4
+ARGP4
+ADDRLP4 2136
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+CNSTI4 1960
+ADDRGP4 musicInfo+19608
+INDIRI4
+MULI4
+ADDRGP4 musicInfo+1920
+ADDP4
+ADDRLP4 2136
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $176
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 2140
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 2140
+INDIRP4
+ARGP4
+ADDRGP4 $177
+ARGP4
+ADDRLP4 64
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 2144
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 2144
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 64
+ASGNP4
+ADDRLP4 48
+INDIRI4
+CNSTI4 15
+ADDRLP4 0
+INDIRI4
+SUBI4
+LEI4 $178
+ADDRLP4 48
+CNSTI4 15
+ADDRLP4 0
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $178
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $183
+JUMPV
+LABELV $180
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $184
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $181
+JUMPV
+LABELV $184
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 2148
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 2148
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 2152
+CNSTI4 64
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+LSHI4
+CNSTI4 1960
+ADDRGP4 musicInfo+19608
+INDIRI4
+MULI4
+ADDRGP4 musicInfo
+ADDP4
+ADDP4
+ADDRLP4 2152
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 2152
+INDIRI4
+ARGI4
+ADDRGP4 $188
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+LSHI4
+CNSTI4 1960
+ADDRGP4 musicInfo+19608
+INDIRI4
+MULI4
+ADDRGP4 musicInfo
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 3
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+LSHI4
+CNSTI4 1960
+ADDRGP4 musicInfo+19608
+INDIRI4
+MULI4
+ADDRGP4 musicInfo
+ADDP4
+ADDP4
+ARGP4
+ADDRGP4 $177
+ARGP4
+ADDRLP4 2156
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 2156
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $181
+ADDRLP4 2148
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 2148
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 2148
+INDIRI4
+ADDI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $183
+ADDRLP4 12
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LTI4 $180
+CNSTI4 1960
+ADDRGP4 musicInfo+19608
+INDIRI4
+MULI4
+ADDRGP4 musicInfo
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+ARGU4
+CNSTU4 128
+ARGU4
+ADDRGP4 SortTracks
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $193
+CNSTI4 1960
+ADDRGP4 musicInfo+19608
+INDIRI4
+MULI4
+ADDRGP4 musicInfo+1956
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 2152
+ADDRGP4 musicInfo+19608
+ASGNP4
+ADDRLP4 2152
+INDIRP4
+ADDRLP4 2152
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $193
+LABELV $156
+ADDRLP4 2120
+CNSTI4 1
+ASGNI4
+ADDRLP4 56
+ADDRLP4 56
+INDIRI4
+ADDRLP4 2120
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 60
+INDIRI4
+ADDRLP4 2120
+INDIRI4
+ADDI4
+ADDRLP4 52
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $158
+ADDRLP4 56
+INDIRI4
+ADDRLP4 1088
+INDIRI4
+LTI4 $155
+ADDRGP4 musicInfo+19600
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $198
+ADDRGP4 $201
+ARGP4
+ADDRLP4 6236
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 6244
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 6240
+ADDRLP4 6244
+INDIRI4
+ASGNI4
+ADDRLP4 6236
+INDIRI4
+CNSTI4 0
+NEI4 $202
+ADDRGP4 $204
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 Playlist_AddAllTracks
+CALLV
+pop
+ADDRGP4 $145
+JUMPV
+LABELV $202
+ADDRLP4 6240
+INDIRI4
+CVIU4 4
+CNSTU4 4096
+LTU4 $205
+ADDRGP4 $207
+ARGP4
+ADDRLP4 6240
+INDIRI4
+ARGI4
+CNSTU4 4095
+ARGU4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $205
+ADDRLP4 2140
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 4096
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 2140
+ARGP4
+CNSTI4 4095
+ARGI4
+ADDRLP4 6236
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 6236
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 2136
+ADDRLP4 2140
+ASGNP4
+LABELV $208
+ADDRLP4 2136
+ARGP4
+ADDRLP4 6248
+ADDRGP4 Com_ParseLine
+CALLP4
+ASGNP4
+ADDRLP4 2132
+ADDRLP4 6248
+INDIRP4
+ASGNP4
+ADDRLP4 6252
+CNSTI4 0
+ASGNI4
+ADDRLP4 2136
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 6252
+INDIRI4
+NEI4 $212
+ADDRLP4 2132
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 6252
+INDIRI4
+NEI4 $212
+ADDRGP4 $210
+JUMPV
+LABELV $212
+ADDRLP4 2132
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $214
+ADDRGP4 $208
+JUMPV
+LABELV $214
+ADDRLP4 2128
+CNSTI4 0
+ASGNI4
+ADDRGP4 $219
+JUMPV
+LABELV $216
+ADDRLP4 2124
+CNSTI4 0
+ASGNI4
+ADDRGP4 $224
+JUMPV
+LABELV $221
+ADDRLP4 2124
+INDIRI4
+CNSTI4 7
+LSHI4
+CNSTI4 1960
+ADDRLP4 2128
+INDIRI4
+MULI4
+ADDRGP4 musicInfo
+ADDP4
+ADDP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRLP4 2132
+INDIRP4
+ARGP4
+ADDRLP4 6256
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 6256
+INDIRI4
+CNSTI4 0
+NEI4 $226
+ADDRLP4 2128
+INDIRI4
+ARGI4
+ADDRLP4 2124
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 Playlist_AddTrack
+CALLV
+pop
+ADDRGP4 $223
+JUMPV
+LABELV $226
+LABELV $222
+ADDRLP4 2124
+ADDRLP4 2124
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $224
+ADDRLP4 2124
+INDIRI4
+CNSTI4 1960
+ADDRLP4 2128
+INDIRI4
+MULI4
+ADDRGP4 musicInfo+1956
+ADDP4
+INDIRI4
+LTI4 $221
+LABELV $223
+LABELV $217
+ADDRLP4 2128
+ADDRLP4 2128
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $219
+ADDRLP4 2128
+INDIRI4
+ADDRGP4 musicInfo+19608
+INDIRI4
+LTI4 $216
+ADDRGP4 $208
+JUMPV
+LABELV $210
+LABELV $198
+LABELV $145
+endproc MusicMenu_Init 6260 20
+export MusicMenu_Shutdown
+proc MusicMenu_Shutdown 32 12
+ADDRGP4 musicInitialized
+INDIRI4
+CNSTI4 0
+NEI4 $229
+ADDRGP4 $228
+JUMPV
+LABELV $229
+ADDRGP4 $201
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $231
+ADDRGP4 $233
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $228
+JUMPV
+LABELV $231
+ADDRLP4 0
+ADDRGP4 musicInfo+19600
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $237
+JUMPV
+LABELV $234
+ADDRGP4 $239
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 7
+LSHI4
+CNSTI4 1960
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 musicInfo
+ADDP4
+ADDP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 16
+ADDRLP4 28
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+LABELV $235
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+ADDI4
+ASGNI4
+LABELV $237
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $234
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+LABELV $228
+endproc MusicMenu_Shutdown 32 12
+proc Music_PrintTrackInfo 0 8
+ADDRGP4 $241
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $240
+endproc Music_PrintTrackInfo 0 8
+proc Music_PlayNextTrack 0 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Music_PrintTrackInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRGP4 $243
+ARGP4
+ADDRGP4 trap_S_StartBackgroundTrack
+CALLV
+pop
+LABELV $242
+endproc Music_PlayNextTrack 0 8
+export Music_NextTrack
+proc Music_NextTrack 4 4
+ADDRGP4 musicInfo+19600
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $245
+ADDRGP4 $244
+JUMPV
+LABELV $245
+ADDRGP4 musicInfo+19600
+INDIRP4
+CVPU4 4
+ADDRGP4 musicInfo+19604
+INDIRP4
+CVPU4 4
+EQU4 $248
+ADDRLP4 0
+ADDRGP4 musicInfo+19600
+INDIRP4
+ASGNP4
+ADDRGP4 musicInfo+19600
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 musicInfo+19604
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 musicInfo+19604
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $248
+ADDRGP4 musicInfo+19600
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 7
+LSHI4
+CNSTI4 1960
+ADDRGP4 musicInfo+19600
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 musicInfo
+ADDP4
+ADDP4
+ARGP4
+ADDRGP4 Music_PlayNextTrack
+CALLV
+pop
+LABELV $244
+endproc Music_NextTrack 4 4
+export Music_TriggerRestart
+proc Music_TriggerRestart 0 0
+ADDRGP4 musicInfo+19612
+CNSTI4 0
+ASGNI4
+LABELV $258
+endproc Music_TriggerRestart 0 0
+export Music_Check
+proc Music_Check 0 4
+ADDRGP4 uis+11424
+INDIRI4
+CNSTI4 1
+NEI4 $261
+ADDRGP4 $260
+JUMPV
+LABELV $261
+ADDRGP4 musicInfo+19600
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $264
+ADDRGP4 $260
+JUMPV
+LABELV $264
+ADDRGP4 musicInfo+19612
+INDIRI4
+CNSTI4 0
+NEI4 $267
+ADDRGP4 wop_AutoswitchSongByNextMap+12
+INDIRI4
+CNSTI4 0
+EQI4 $270
+ADDRGP4 Music_NextTrack
+CALLV
+pop
+ADDRGP4 $271
+JUMPV
+LABELV $270
+ADDRGP4 musicInfo+19600
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 7
+LSHI4
+CNSTI4 1960
+ADDRGP4 musicInfo+19600
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 musicInfo
+ADDP4
+ADDP4
+ARGP4
+ADDRGP4 Music_PlayNextTrack
+CALLV
+pop
+LABELV $271
+ADDRGP4 musicInfo+19612
+CNSTI4 1
+ASGNI4
+LABELV $267
+LABELV $260
+endproc Music_Check 0 4
+proc MusicMenu_Event 12 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $277
+ADDRGP4 $276
+JUMPV
+LABELV $277
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 25
+LTI4 $279
+ADDRLP4 4
+INDIRI4
+CNSTI4 28
+GTI4 $279
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $302-100
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $302
+address $281
+address $288
+address $297
+address $298
+code
+LABELV $281
+ADDRGP4 musicMenu+1992
+INDIRI4
+CNSTI4 4294967294
+EQI4 $282
+ADDRGP4 musicMenu+1996
+ADDRGP4 uis+4
+INDIRI4
+ASGNI4
+LABELV $282
+ADDRGP4 musicMenu+1992
+CNSTI4 4294967294
+ASGNI4
+ADDRGP4 $280
+JUMPV
+LABELV $288
+ADDRGP4 musicInfo+19608
+INDIRI4
+CNSTI4 2
+LTI4 $293
+ADDRGP4 musicMenu+1992
+INDIRI4
+CNSTI4 0
+EQI4 $289
+LABELV $293
+ADDRGP4 $276
+JUMPV
+LABELV $289
+ADDRGP4 musicMenu+1992
+CNSTI4 4294967295
+ASGNI4
+ADDRGP4 musicMenu+1996
+ADDRGP4 uis+4
+INDIRI4
+ASGNI4
+ADDRGP4 $280
+JUMPV
+LABELV $297
+ADDRGP4 Playlist_Clear
+CALLV
+pop
+ADDRGP4 $280
+JUMPV
+LABELV $298
+CNSTI4 0
+ARGI4
+ADDRGP4 Playlist_AddAllTracks
+CALLV
+pop
+ADDRGP4 $280
+JUMPV
+LABELV $279
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 10
+LTI4 $299
+ADDRLP4 8
+INDIRI4
+CNSTI4 25
+GEI4 $299
+ADDRGP4 musicMenu+2000
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+SUBI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 Playlist_AddTrack
+CALLV
+pop
+LABELV $299
+LABELV $280
+LABELV $276
+endproc MusicMenu_Event 12 12
+proc MusicMenu_Draw 28 24
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRGP4 musicMenu+1992
+INDIRI4
+CNSTI4 0
+EQI4 $305
+ADDRGP4 musicMenu+1992
+INDIRI4
+CNSTI4 0
+GEI4 $308
+ADDRLP4 4
+ADDRGP4 uis+4
+INDIRI4
+ADDRGP4 musicMenu+1996
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $309
+JUMPV
+LABELV $308
+ADDRGP4 musicMenu+1992
+INDIRI4
+CNSTI4 0
+LEI4 $313
+ADDRLP4 4
+CNSTI4 1000
+ADDRGP4 uis+4
+INDIRI4
+ADDRGP4 musicMenu+1996
+INDIRI4
+SUBI4
+SUBI4
+CVIF4 4
+ASGNF4
+LABELV $313
+LABELV $309
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 981668463
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $318
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 musicMenu+296+16
+ADDP4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1128005632
+ADDF4
+CVFI4 4
+ASGNI4
+LABELV $319
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+LTI4 $318
+ADDRGP4 musicMenu+1664+76
+CNSTF4 1070386381
+ADDRLP4 4
+INDIRF4
+MULF4
+CNSTF4 1147617280
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 musicMenu+1772+76
+CNSTF4 1070386381
+ADDRLP4 4
+INDIRF4
+MULF4
+CNSTF4 1148157952
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 musicMenu+1880+76
+CNSTF4 1070386381
+ADDRLP4 4
+INDIRF4
+MULF4
+CNSTF4 1147617280
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 musicMenu+1556+76
+CNSTF4 1070386381
+ADDRLP4 4
+INDIRF4
+MULF4
+CNSTF4 1148092416
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 uis+4
+INDIRI4
+ADDRGP4 musicMenu+1996
+INDIRI4
+SUBI4
+CNSTI4 1000
+LEI4 $306
+ADDRGP4 musicMenu+1992
+INDIRI4
+CNSTI4 4294967295
+NEI4 $336
+ADDRGP4 menu_switch_sound
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 musicMenu+1992
+CNSTI4 1
+ASGNI4
+ADDRGP4 musicMenu+1996
+ADDRGP4 uis+4
+INDIRI4
+ASGNI4
+ADDRGP4 musicMenu+2000
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRGP4 musicInfo+19608
+INDIRI4
+LTI4 $342
+ADDRGP4 musicMenu+2000
+CNSTI4 0
+ASGNI4
+ADDRGP4 $343
+JUMPV
+LABELV $342
+ADDRLP4 12
+ADDRGP4 musicMenu+2000
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $343
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $348
+ADDRLP4 0
+INDIRI4
+CNSTI4 1960
+ADDRGP4 musicMenu+2000
+INDIRI4
+MULI4
+ADDRGP4 musicInfo+1956
+ADDP4
+INDIRI4
+LTI4 $352
+ADDRLP4 12
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 musicMenu+296+48
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRGP4 $353
+JUMPV
+LABELV $352
+ADDRLP4 12
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 musicMenu+296+48
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $353
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+LSHI4
+CNSTI4 1960
+ADDRGP4 musicMenu+2000
+INDIRI4
+MULI4
+ADDRGP4 musicInfo
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 20
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 musicMenu+296+32
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 musicMenu+296+24
+ADDP4
+INDIRI4
+CVIU4 4
+ADDRLP4 16
+INDIRU4
+CNSTI4 3
+LSHU4
+ADDU4
+CVUI4 4
+ASGNI4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 musicMenu+296+64
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+LSHI4
+CNSTI4 1960
+ADDRGP4 musicMenu+2000
+INDIRI4
+MULI4
+ADDRGP4 musicInfo
+ADDP4
+ADDP4
+ASGNP4
+LABELV $349
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+LTI4 $348
+ADDRGP4 $306
+JUMPV
+LABELV $336
+ADDRGP4 musicMenu+1992
+INDIRI4
+CNSTI4 1
+NEI4 $368
+ADDRGP4 musicMenu+1992
+CNSTI4 0
+ASGNI4
+ADDRGP4 $306
+JUMPV
+LABELV $368
+ADDRGP4 musicMenu+1992
+INDIRI4
+CNSTI4 4294967294
+NEI4 $306
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $306
+JUMPV
+LABELV $305
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $375
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 musicMenu+296+16
+ADDP4
+CNSTI4 188
+ASGNI4
+LABELV $376
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+LTI4 $375
+ADDRGP4 musicMenu+1664+76
+CNSTI4 925
+ASGNI4
+ADDRGP4 musicMenu+1772+76
+CNSTI4 958
+ASGNI4
+ADDRGP4 musicMenu+1880+76
+CNSTI4 925
+ASGNI4
+ADDRGP4 musicMenu+1556+76
+CNSTI4 954
+ASGNI4
+LABELV $306
+CNSTI4 1960
+ADDRGP4 musicMenu+2000
+INDIRI4
+MULI4
+ADDRGP4 musicInfo+1920
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $389
+ADDRLP4 4
+INDIRF4
+CNSTF4 1124204544
+ADDF4
+ARGF4
+CNSTF4 1114898432
+ARGF4
+CNSTF4 1136066560
+ARGF4
+CNSTF4 1135149056
+ARGF4
+CNSTI4 1960
+ADDRGP4 musicMenu+2000
+INDIRI4
+MULI4
+ADDRGP4 musicInfo+1920
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+ADDRGP4 $390
+JUMPV
+LABELV $389
+ADDRLP4 4
+INDIRF4
+CNSTF4 1126170624
+ADDF4
+ARGF4
+CNSTF4 1114636288
+ARGF4
+CNSTF4 1135050752
+ARGF4
+CNSTF4 1135214592
+ARGF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRLP4 4
+INDIRF4
+CNSTF4 1126825984
+ADDF4
+CVFI4 4
+ARGI4
+CNSTI4 62
+ARGI4
+CNSTI4 1960
+ADDRGP4 musicMenu+2000
+INDIRI4
+MULI4
+ADDRGP4 musicInfo+1924
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTF4 1098907648
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawStringNS
+CALLV
+pop
+LABELV $390
+ADDRLP4 4
+INDIRF4
+CNSTF4 1138262016
+ADDF4
+ARGF4
+CNSTF4 1116209152
+ARGF4
+CNSTF4 1140457472
+ARGF4
+CNSTF4 1134395392
+ARGF4
+ADDRGP4 musicMenu+1988
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+ADDRGP4 musicInfo+19600
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $398
+ADDRLP4 8
+ADDRGP4 musicInfo+19600
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $404
+JUMPV
+LABELV $401
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRGP4 musicMenu+2000
+INDIRI4
+NEI4 $406
+ADDRGP4 $409
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1128005632
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 20
+CNSTI4 18
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+CNSTI4 82
+ADDI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $406
+LABELV $402
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $404
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $401
+LABELV $398
+ADDRGP4 musicMenu
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+LABELV $304
+endproc MusicMenu_Draw 28 24
+proc MusicMenu_Key 28 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 83
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $420
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GTI4 $429
+LABELV $428
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 27
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $413
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $411
+LABELV $430
+ADDRFP4 0
+INDIRI4
+CNSTI4 77
+EQI4 $413
+ADDRGP4 $411
+JUMPV
+LABELV $429
+ADDRLP4 16
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 115
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $420
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+GTI4 $432
+LABELV $431
+ADDRFP4 0
+INDIRI4
+CNSTI4 109
+EQI4 $413
+ADDRGP4 $411
+JUMPV
+LABELV $432
+ADDRFP4 0
+INDIRI4
+CNSTI4 179
+EQI4 $413
+ADDRGP4 $411
+JUMPV
+LABELV $413
+ADDRGP4 musicMenu+1992
+INDIRI4
+CNSTI4 4294967294
+EQI4 $414
+ADDRGP4 musicMenu+1996
+ADDRGP4 uis+4
+INDIRI4
+ASGNI4
+LABELV $414
+ADDRGP4 musicMenu+1992
+CNSTI4 4294967294
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $410
+JUMPV
+LABELV $420
+ADDRGP4 musicInfo+19608
+INDIRI4
+CNSTI4 1
+LEI4 $421
+ADDRGP4 musicMenu+1992
+INDIRI4
+CNSTI4 0
+NEI4 $421
+ADDRGP4 musicMenu+1992
+CNSTI4 4294967295
+ASGNI4
+ADDRGP4 musicMenu+1996
+ADDRGP4 uis+4
+INDIRI4
+ASGNI4
+LABELV $421
+CNSTI4 0
+RETI4
+ADDRGP4 $410
+JUMPV
+LABELV $411
+ADDRGP4 musicMenu
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 Menu_DefaultKey
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+RETI4
+LABELV $410
+endproc MusicMenu_Key 28 8
+export MusicMenu_Cache
+proc MusicMenu_Cache 4 4
+ADDRGP4 $435
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 musicMenu+1988
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $433
+endproc MusicMenu_Cache 4 4
+export MusicMenu_Open
+proc MusicMenu_Open 44 12
+ADDRGP4 musicMenu
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 2004
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 uis+11424
+CNSTI4 2
+ASGNI4
+ADDRGP4 $438
+ARGP4
+ADDRGP4 $439
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 MusicMenu_Cache
+CALLV
+pop
+ADDRGP4 musicMenu+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 musicMenu+280
+CNSTI4 0
+ASGNI4
+ADDRGP4 musicMenu+268
+ADDRGP4 MusicMenu_Draw
+ASGNP4
+ADDRGP4 musicMenu+272
+ADDRGP4 MusicMenu_Key
+ASGNP4
+ADDRLP4 4
+CNSTI4 82
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $444
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 musicMenu+296
+ADDP4
+CNSTI4 12
+ASGNI4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 musicMenu+296+76
+ADDP4
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1960
+ADDRGP4 musicMenu+2000
+INDIRI4
+MULI4
+ADDRGP4 musicInfo+1956
+ADDP4
+INDIRI4
+LTI4 $451
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 musicMenu+296+48
+ADDP4
+CNSTU4 20480
+ASGNU4
+ADDRGP4 $452
+JUMPV
+LABELV $451
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 musicMenu+296+48
+ADDP4
+CNSTU4 0
+ASGNU4
+LABELV $452
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 musicMenu+296+16
+ADDP4
+CNSTI4 188
+ASGNI4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 musicMenu+296+20
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 musicMenu+296+12
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+ADDI4
+ASGNI4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 musicMenu+296+52
+ADDP4
+ADDRGP4 MusicMenu_Event
+ASGNP4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 musicMenu+296+64
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+LSHI4
+CNSTI4 1960
+ADDRGP4 musicMenu+2000
+INDIRI4
+MULI4
+ADDRGP4 musicInfo
+ADDP4
+ADDP4
+ASGNP4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 musicMenu+296+72
+ADDP4
+ADDRGP4 color_white
+ASGNP4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 musicMenu+296+68
+ADDP4
+CNSTI4 16
+ASGNI4
+ADDRGP4 musicMenu
+ARGP4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 musicMenu+296
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+LABELV $445
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+LTI4 $444
+ADDRGP4 musicMenu+1664+76
+CNSTI4 925
+ASGNI4
+ADDRGP4 musicMenu+1772+76
+CNSTI4 958
+ASGNI4
+ADDRGP4 musicMenu+1880+76
+CNSTI4 925
+ASGNI4
+ADDRGP4 musicMenu+1556+76
+CNSTI4 954
+ASGNI4
+ADDRGP4 musicMenu+1664
+CNSTI4 11
+ASGNI4
+ADDRGP4 musicInfo+19608
+INDIRI4
+CNSTI4 2
+GEI4 $484
+ADDRGP4 musicMenu+1664+48
+CNSTU4 20480
+ASGNU4
+LABELV $484
+ADDRGP4 musicMenu+1664+80
+CNSTI4 348
+ASGNI4
+ADDRGP4 musicMenu+1664+12
+CNSTI4 26
+ASGNI4
+ADDRGP4 musicMenu+1664+52
+ADDRGP4 MusicMenu_Event
+ASGNP4
+ADDRGP4 musicMenu+1664+84
+CNSTI4 76
+ASGNI4
+ADDRGP4 musicMenu+1664+88
+CNSTI4 19
+ASGNI4
+ADDRGP4 $501
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 musicMenu+1664+64
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $504
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 musicMenu+1664+72
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 musicMenu
+ARGP4
+ADDRGP4 musicMenu+1664
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 musicMenu+1772
+CNSTI4 11
+ASGNI4
+ADDRGP4 musicMenu+1772+80
+CNSTI4 369
+ASGNI4
+ADDRGP4 musicMenu+1772+12
+CNSTI4 27
+ASGNI4
+ADDRGP4 musicMenu+1772+52
+ADDRGP4 MusicMenu_Event
+ASGNP4
+ADDRGP4 musicMenu+1772+84
+CNSTI4 43
+ASGNI4
+ADDRGP4 musicMenu+1772+88
+CNSTI4 19
+ASGNI4
+ADDRGP4 $519
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 musicMenu+1772+64
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $522
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 musicMenu+1772+72
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 musicMenu
+ARGP4
+ADDRGP4 musicMenu+1772
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 musicMenu+1880
+CNSTI4 11
+ASGNI4
+ADDRGP4 musicMenu+1880+80
+CNSTI4 369
+ASGNI4
+ADDRGP4 musicMenu+1880+12
+CNSTI4 28
+ASGNI4
+ADDRGP4 musicMenu+1880+52
+ADDRGP4 MusicMenu_Event
+ASGNP4
+ADDRGP4 musicMenu+1880+84
+CNSTI4 31
+ASGNI4
+ADDRGP4 musicMenu+1880+88
+CNSTI4 19
+ASGNI4
+ADDRGP4 $537
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 musicMenu+1880+64
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $540
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 musicMenu+1880+72
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 musicMenu
+ARGP4
+ADDRGP4 musicMenu+1880
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 musicMenu+1556
+CNSTI4 11
+ASGNI4
+ADDRGP4 musicMenu+1556+80
+CNSTI4 413
+ASGNI4
+ADDRGP4 musicMenu+1556+12
+CNSTI4 25
+ASGNI4
+ADDRGP4 musicMenu+1556+52
+ADDRGP4 MusicMenu_Event
+ASGNP4
+ADDRLP4 32
+CNSTI4 55
+ASGNI4
+ADDRGP4 musicMenu+1556+88
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 musicMenu+1556+84
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 $555
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 musicMenu+1556+64
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $558
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 musicMenu+1556+72
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 musicMenu
+ARGP4
+ADDRGP4 musicMenu+1556
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 musicMenu
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+ADDRGP4 musicMenu+1992
+CNSTI4 1
+ASGNI4
+ADDRGP4 musicMenu+1996
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 1000
+ADDI4
+ASGNI4
+LABELV $436
+endproc MusicMenu_Open 44 12
+bss
+align 4
+LABELV musicInfo
+skip 19616
+align 4
+LABELV freeOrderItems
+skip 4
+align 4
+LABELV playOrderMemory
+skip 1800
+align 4
+LABELV musicMenu
+skip 2004
+import UI_HelpMenu_Cache
+import UI_HelpMenu_f
+import UI_HelpMenu
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import UI_InitGameinfo
+import UI_GetNumBots
+import UI_GetBotInfoByNumber
+import UI_GetNumArenas
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_VoiceIngame
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_GetVoiceGainClient
+import trap_GetVoiceMuteAll
+import trap_GetVoiceMuteClient
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_CIN_SetExtents
+import trap_CIN_StopCinematic
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_PlayCinematic
+import trap_RealTime
+import trap_S_StartBackgroundTrack
+import trap_S_StopBackgroundTrack
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_SaveCachedServers
+import trap_LAN_LoadCachedServers
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import BotListCompare
+import uis
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString2
+import UI_AutoWrappedString_LineCount
+import UI_DrawString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawIngameBG
+import UI_DrawStringNS
+import UI_ModelIcon
+import UI_DrawHandlePic1024
+import UI_AdjustFrom1024
+import UI_StopMusic
+import UI_StartCreditMusic
+import UI_StartMusic
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_ClearModelCache
+import UI_PrecacheClientModelname
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import UI_SpecifyPasswordMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import Demos_Cache
+import UI_DemosMenu
+import SetDefaultBinds_onUnusedKeys
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import SetupDefaultMenu_Cache
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import UI_CallVoteMenu
+import UI_InGameMenu
+import InGame_Cache
+import UI_SecretMenu
+import UI_InitBigCredits
+import UI_BigCredits_Cache
+import UI_CreditMenu
+import ExitMenu_Cache
+import ExitMenu_Init
+import UI_MainMenu
+import MainMenu_Cache
+import UI_UpdateCvars
+import UI_RegisterCvars
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import listbar_bluecolor
+import text_color_bluehighlight
+import text_color_bluenormal
+import text_color_ighighlight
+import text_color_ignormal
+import listbar_igcolor
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_lightOrange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_click_sound
+import menu_switch_sound
+import menu_move_sound
+import ScrollList_Key
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import wop_AutoBindUnusedKeys
+import wop_AutoswitchSongByNextMap
+import con_notifytime
+import s_wop_restarted
+import syc_logo
+import spraycolor
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_createGametype
+import ui_browserHidePrivate
+import ui_browserOnlyHumans
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $558
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 47
+byte 1 101
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $555
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 47
+byte 1 101
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 0
+align 1
+LABELV $540
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 47
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $537
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 47
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 0
+align 1
+LABELV $522
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 47
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $519
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 47
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 0
+align 1
+LABELV $504
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 47
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $501
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 47
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 0
+align 1
+LABELV $439
+byte 1 49
+byte 1 0
+align 1
+LABELV $438
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $435
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 47
+byte 1 98
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 0
+align 1
+LABELV $409
+byte 1 37
+byte 1 50
+byte 1 105
+byte 1 46
+byte 1 0
+align 1
+LABELV $243
+byte 1 60
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 67
+byte 1 77
+byte 1 68
+byte 1 62
+byte 1 0
+align 1
+LABELV $241
+byte 1 91
+byte 1 87
+byte 1 111
+byte 1 80
+byte 1 32
+byte 1 77
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 93
+byte 1 58
+byte 1 32
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $239
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $233
+byte 1 94
+byte 1 49
+byte 1 91
+byte 1 87
+byte 1 111
+byte 1 80
+byte 1 32
+byte 1 77
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 93
+byte 1 58
+byte 1 32
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $207
+byte 1 94
+byte 1 51
+byte 1 91
+byte 1 87
+byte 1 111
+byte 1 80
+byte 1 32
+byte 1 77
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 93
+byte 1 58
+byte 1 32
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 40
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 37
+byte 1 108
+byte 1 100
+byte 1 41
+byte 1 44
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 116
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $204
+byte 1 91
+byte 1 87
+byte 1 111
+byte 1 80
+byte 1 32
+byte 1 77
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 93
+byte 1 58
+byte 1 32
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 44
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 97
+byte 1 118
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $201
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $188
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $177
+byte 1 46
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 0
+align 1
+LABELV $176
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $175
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 98
+byte 1 103
+byte 1 0
+align 1
+LABELV $168
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 0
+align 1
+LABELV $164
+byte 1 46
+byte 1 46
+byte 1 0
+align 1
+LABELV $163
+byte 1 46
+byte 1 0
+align 1
+LABELV $152
+byte 1 47
+byte 1 0
+align 1
+LABELV $151
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 0
+align 1
+LABELV $111
+byte 1 94
+byte 1 49
+byte 1 91
+byte 1 87
+byte 1 111
+byte 1 80
+byte 1 32
+byte 1 77
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 93
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 115
+byte 1 33
+byte 1 10
+byte 1 0
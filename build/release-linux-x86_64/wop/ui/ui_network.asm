@@ -0,0 +1,1602 @@
+data
+align 4
+LABELV rate_items
+address $77
+address $78
+address $79
+byte 4 0
+code
+proc UI_NetworkOptionsMenu_Event 8 8
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $82
+ADDRGP4 $81
+JUMPV
+LABELV $82
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LTI4 $84
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+GTI4 $84
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $110-40
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $110
+address $87
+address $88
+address $89
+address $85
+address $91
+address $105
+address $109
+code
+LABELV $87
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_GraphicsOptionsMenu
+CALLV
+pop
+ADDRGP4 $85
+JUMPV
+LABELV $88
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_DisplayOptionsMenu
+CALLV
+pop
+ADDRGP4 $85
+JUMPV
+LABELV $89
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_SoundOptionsMenu
+CALLV
+pop
+ADDRGP4 $85
+JUMPV
+LABELV $91
+ADDRGP4 networkOptionsInfo+680+68
+INDIRI4
+CNSTI4 0
+NEI4 $92
+ADDRGP4 $96
+ARGP4
+CNSTF4 1165623296
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $85
+JUMPV
+LABELV $92
+ADDRGP4 networkOptionsInfo+680+68
+INDIRI4
+CNSTI4 1
+NEI4 $97
+ADDRGP4 $96
+ARGP4
+CNSTF4 1167867904
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $85
+JUMPV
+LABELV $97
+ADDRGP4 networkOptionsInfo+680+68
+INDIRI4
+CNSTI4 2
+NEI4 $85
+ADDRGP4 $96
+ARGP4
+CNSTF4 1187205120
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $85
+JUMPV
+LABELV $105
+ADDRGP4 $106
+ARGP4
+ADDRGP4 networkOptionsInfo+800+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $85
+JUMPV
+LABELV $109
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $84
+LABELV $85
+LABELV $81
+endproc UI_NetworkOptionsMenu_Event 8 8
+proc UI_NetworkOptionsMenu_Init 20 12
+ADDRGP4 networkOptionsInfo
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 964
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 UI_NetworkOptionsMenu_Cache
+CALLV
+pop
+ADDRGP4 networkOptionsInfo+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 networkOptionsInfo+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 networkOptionsInfo+284
+CNSTI4 32776
+ASGNI4
+ADDRGP4 networkOptionsInfo+296
+CNSTI4 6
+ASGNI4
+ADDRGP4 networkOptionsInfo+296+4
+ADDRGP4 $119
+ASGNP4
+ADDRGP4 networkOptionsInfo+296+48
+CNSTU4 132
+ASGNU4
+ADDRGP4 networkOptionsInfo+296+52
+ADDRGP4 UI_NetworkOptionsMenu_Event
+ASGNP4
+ADDRGP4 networkOptionsInfo+296+12
+CNSTI4 10
+ASGNI4
+ADDRGP4 networkOptionsInfo+296+16
+CNSTI4 26
+ASGNI4
+ADDRGP4 networkOptionsInfo+296+20
+CNSTI4 37
+ASGNI4
+ADDRGP4 networkOptionsInfo+296+80
+CNSTI4 130
+ASGNI4
+ADDRGP4 networkOptionsInfo+296+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 networkOptionsInfo+296+64
+ADDRGP4 $136
+ASGNP4
+ADDRGP4 networkOptionsInfo+296+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 networkOptionsInfo+392
+CNSTI4 6
+ASGNI4
+ADDRGP4 networkOptionsInfo+392+4
+ADDRGP4 $142
+ASGNP4
+ADDRGP4 networkOptionsInfo+392+48
+CNSTU4 132
+ASGNU4
+ADDRGP4 networkOptionsInfo+392+52
+ADDRGP4 UI_NetworkOptionsMenu_Event
+ASGNP4
+ADDRGP4 networkOptionsInfo+392+12
+CNSTI4 11
+ASGNI4
+ADDRGP4 networkOptionsInfo+392+16
+CNSTI4 159
+ASGNI4
+ADDRGP4 networkOptionsInfo+392+20
+CNSTI4 30
+ASGNI4
+ADDRGP4 networkOptionsInfo+392+80
+CNSTI4 122
+ASGNI4
+ADDRGP4 networkOptionsInfo+392+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 networkOptionsInfo+392+64
+ADDRGP4 $159
+ASGNP4
+ADDRGP4 networkOptionsInfo+392+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 networkOptionsInfo+488
+CNSTI4 6
+ASGNI4
+ADDRGP4 networkOptionsInfo+488+4
+ADDRGP4 $165
+ASGNP4
+ADDRGP4 networkOptionsInfo+488+48
+CNSTU4 132
+ASGNU4
+ADDRGP4 networkOptionsInfo+488+52
+ADDRGP4 UI_NetworkOptionsMenu_Event
+ASGNP4
+ADDRGP4 networkOptionsInfo+488+12
+CNSTI4 12
+ASGNI4
+ADDRGP4 networkOptionsInfo+488+16
+CNSTI4 40
+ASGNI4
+ADDRGP4 networkOptionsInfo+488+20
+CNSTI4 77
+ASGNI4
+ADDRGP4 networkOptionsInfo+488+80
+CNSTI4 130
+ASGNI4
+ADDRGP4 networkOptionsInfo+488+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 networkOptionsInfo+488+64
+ADDRGP4 $182
+ASGNP4
+ADDRGP4 networkOptionsInfo+488+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 networkOptionsInfo+584
+CNSTI4 6
+ASGNI4
+ADDRGP4 networkOptionsInfo+584+4
+ADDRGP4 $188
+ASGNP4
+ADDRGP4 networkOptionsInfo+584+48
+CNSTU4 68
+ASGNU4
+ADDRGP4 networkOptionsInfo+584+52
+ADDRGP4 UI_NetworkOptionsMenu_Event
+ASGNP4
+ADDRGP4 networkOptionsInfo+584+12
+CNSTI4 13
+ASGNI4
+ADDRGP4 networkOptionsInfo+584+16
+CNSTI4 170
+ASGNI4
+ADDRGP4 networkOptionsInfo+584+20
+CNSTI4 80
+ASGNI4
+ADDRGP4 networkOptionsInfo+584+80
+CNSTI4 100
+ASGNI4
+ADDRGP4 networkOptionsInfo+584+84
+CNSTI4 45
+ASGNI4
+ADDRGP4 networkOptionsInfo+584+64
+ADDRGP4 $205
+ASGNP4
+ADDRGP4 networkOptionsInfo+584+92
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+CNSTI4 222
+ASGNI4
+ADDRGP4 networkOptionsInfo+680
+CNSTI4 3
+ASGNI4
+ADDRGP4 networkOptionsInfo+680+4
+ADDRGP4 $211
+ASGNP4
+ADDRGP4 networkOptionsInfo+680+48
+CNSTU4 2
+ASGNU4
+ADDRGP4 networkOptionsInfo+680+52
+ADDRGP4 UI_NetworkOptionsMenu_Event
+ASGNP4
+ADDRGP4 networkOptionsInfo+680+12
+CNSTI4 14
+ASGNI4
+ADDRGP4 networkOptionsInfo+680+16
+CNSTI4 190
+ASGNI4
+ADDRGP4 networkOptionsInfo+680+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 networkOptionsInfo+680+80
+ADDRGP4 rate_items
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 networkOptionsInfo+800
+CNSTI4 5
+ASGNI4
+ADDRGP4 networkOptionsInfo+800+4
+ADDRGP4 $227
+ASGNP4
+ADDRGP4 networkOptionsInfo+800+48
+CNSTU4 2
+ASGNU4
+ADDRGP4 networkOptionsInfo+800+52
+ADDRGP4 UI_NetworkOptionsMenu_Event
+ASGNP4
+ADDRGP4 networkOptionsInfo+800+12
+CNSTI4 15
+ASGNI4
+ADDRGP4 networkOptionsInfo+800+16
+CNSTI4 190
+ASGNI4
+ADDRGP4 networkOptionsInfo+800+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 networkOptionsInfo+800+8
+ADDRGP4 $240
+ASGNP4
+ADDRGP4 networkOptionsInfo+868
+CNSTI4 6
+ASGNI4
+ADDRGP4 networkOptionsInfo+868+4
+ADDRGP4 $244
+ASGNP4
+ADDRGP4 networkOptionsInfo+868+48
+CNSTU4 260
+ASGNU4
+ADDRGP4 networkOptionsInfo+868+52
+ADDRGP4 UI_NetworkOptionsMenu_Event
+ASGNP4
+ADDRGP4 networkOptionsInfo+868+12
+CNSTI4 16
+ASGNI4
+ADDRGP4 networkOptionsInfo+868+16
+CNSTI4 9
+ASGNI4
+ADDRGP4 networkOptionsInfo+868+20
+CNSTI4 440
+ASGNI4
+ADDRGP4 networkOptionsInfo+868+80
+CNSTI4 80
+ASGNI4
+ADDRGP4 networkOptionsInfo+868+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 networkOptionsInfo+868+64
+ADDRGP4 $261
+ASGNP4
+ADDRGP4 networkOptionsInfo+868+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 networkOptionsInfo
+ARGP4
+ADDRGP4 networkOptionsInfo+296
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 networkOptionsInfo
+ARGP4
+ADDRGP4 networkOptionsInfo+392
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 networkOptionsInfo
+ARGP4
+ADDRGP4 networkOptionsInfo+488
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 networkOptionsInfo
+ARGP4
+ADDRGP4 networkOptionsInfo+584
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 networkOptionsInfo
+ARGP4
+ADDRGP4 networkOptionsInfo+680
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 networkOptionsInfo
+ARGP4
+ADDRGP4 networkOptionsInfo+800
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 networkOptionsInfo
+ARGP4
+ADDRGP4 networkOptionsInfo+868
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 $96
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4000
+GTI4 $271
+ADDRGP4 networkOptionsInfo+680+68
+CNSTI4 0
+ASGNI4
+ADDRGP4 $272
+JUMPV
+LABELV $271
+ADDRLP4 4
+INDIRI4
+CNSTI4 5000
+GTI4 $275
+ADDRGP4 networkOptionsInfo+680+68
+CNSTI4 1
+ASGNI4
+ADDRGP4 $276
+JUMPV
+LABELV $275
+ADDRGP4 networkOptionsInfo+680+68
+CNSTI4 2
+ASGNI4
+LABELV $276
+LABELV $272
+ADDRGP4 $106
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 0
+EQF4 $284
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $285
+JUMPV
+LABELV $284
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $285
+ADDRGP4 networkOptionsInfo+800+64
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $112
+endproc UI_NetworkOptionsMenu_Init 20 12
+export UI_NetworkOptionsMenu_Cache
+proc UI_NetworkOptionsMenu_Cache 0 4
+ADDRGP4 $244
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $261
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $119
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $136
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $142
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $159
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $165
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $182
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $188
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $205
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $286
+endproc UI_NetworkOptionsMenu_Cache 0 4
+export UI_NetworkOptionsMenu
+proc UI_NetworkOptionsMenu 0 8
+ADDRGP4 UI_NetworkOptionsMenu_Init
+CALLV
+pop
+ADDRGP4 networkOptionsInfo
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+ADDRGP4 networkOptionsInfo
+ARGP4
+ADDRGP4 networkOptionsInfo+584
+ARGP4
+ADDRGP4 Menu_SetCursorToItem
+CALLV
+pop
+LABELV $287
+endproc UI_NetworkOptionsMenu 0 8
+bss
+align 4
+LABELV networkOptionsInfo
+skip 964
+import UI_HelpMenu_Cache
+import UI_HelpMenu_f
+import UI_HelpMenu
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import UI_InitGameinfo
+import UI_GetNumBots
+import UI_GetBotInfoByNumber
+import UI_GetNumArenas
+import UI_GetArenaInfoByNumber
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_VoiceIngame
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_GetVoiceGainClient
+import trap_GetVoiceMuteAll
+import trap_GetVoiceMuteClient
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_CIN_SetExtents
+import trap_CIN_StopCinematic
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_PlayCinematic
+import trap_RealTime
+import trap_S_StartBackgroundTrack
+import trap_S_StopBackgroundTrack
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_SaveCachedServers
+import trap_LAN_LoadCachedServers
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import BotListCompare
+import uis
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString2
+import UI_AutoWrappedString_LineCount
+import UI_DrawString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawIngameBG
+import UI_DrawStringNS
+import UI_ModelIcon
+import UI_DrawHandlePic1024
+import UI_AdjustFrom1024
+import UI_StopMusic
+import UI_StartCreditMusic
+import UI_StartMusic
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_ClearModelCache
+import UI_PrecacheClientModelname
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import UI_SpecifyPasswordMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import Demos_Cache
+import UI_DemosMenu
+import SetDefaultBinds_onUnusedKeys
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import SetupDefaultMenu_Cache
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import Music_NextTrack
+import Music_TriggerRestart
+import Music_Check
+import MusicMenu_Cache
+import MusicMenu_Open
+import MusicMenu_Shutdown
+import MusicMenu_Init
+import UI_CallVoteMenu
+import UI_InGameMenu
+import InGame_Cache
+import UI_SecretMenu
+import UI_InitBigCredits
+import UI_BigCredits_Cache
+import UI_CreditMenu
+import ExitMenu_Cache
+import ExitMenu_Init
+import UI_MainMenu
+import MainMenu_Cache
+import UI_UpdateCvars
+import UI_RegisterCvars
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import listbar_bluecolor
+import text_color_bluehighlight
+import text_color_bluenormal
+import text_color_ighighlight
+import text_color_ignormal
+import listbar_igcolor
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_lightOrange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_click_sound
+import menu_switch_sound
+import menu_move_sound
+import ScrollList_Key
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import wop_AutoBindUnusedKeys
+import wop_AutoswitchSongByNextMap
+import con_notifytime
+import s_wop_restarted
+import syc_logo
+import spraycolor
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_createGametype
+import ui_browserHidePrivate
+import ui_browserOnlyHumans
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $261
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 66
+byte 1 116
+byte 1 110
+byte 1 66
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 49
+byte 1 0
+align 1
+LABELV $244
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 66
+byte 1 116
+byte 1 110
+byte 1 66
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 48
+byte 1 0
+align 1
+LABELV $240
+byte 1 69
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 32
+byte 1 47
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 46
+byte 1 32
+byte 1 78
+byte 1 79
+byte 1 84
+byte 1 69
+byte 1 58
+byte 1 32
+byte 1 67
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 32
+byte 1 79
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $227
+byte 1 65
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 68
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 58
+byte 1 0
+align 1
+LABELV $211
+byte 1 68
+byte 1 97
+byte 1 116
+byte 1 97
+byte 1 32
+byte 1 82
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $205
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 47
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 107
+byte 1 49
+byte 1 0
+align 1
+LABELV $188
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 47
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 107
+byte 1 48
+byte 1 0
+align 1
+LABELV $182
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 47
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 49
+byte 1 0
+align 1
+LABELV $165
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 47
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 48
+byte 1 0
+align 1
+LABELV $159
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 47
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 49
+byte 1 0
+align 1
+LABELV $142
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 47
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 48
+byte 1 0
+align 1
+LABELV $136
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 49
+byte 1 0
+align 1
+LABELV $119
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 48
+byte 1 0
+align 1
+LABELV $106
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 68
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $96
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $79
+byte 1 76
+byte 1 65
+byte 1 78
+byte 1 47
+byte 1 67
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 120
+byte 1 68
+byte 1 83
+byte 1 76
+byte 1 0
+align 1
+LABELV $78
+byte 1 73
+byte 1 83
+byte 1 68
+byte 1 78
+byte 1 0
+align 1
+LABELV $77
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 0
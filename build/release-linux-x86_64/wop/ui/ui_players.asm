@@ -0,0 +1,8982 @@
+code
+proc UI_PlayerInfo_SetWeapon 84 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1176
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+LABELV $78
+ADDRFP4 0
+INDIRP4
+CNSTI4 1240
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1128
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1132
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $79
+ADDRGP4 $77
+JUMPV
+LABELV $79
+ADDRLP4 0
+ADDRGP4 bg_itemlist+52
+ASGNP4
+ADDRGP4 $84
+JUMPV
+LABELV $81
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $86
+ADDRGP4 $82
+JUMPV
+LABELV $86
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $88
+ADDRGP4 $83
+JUMPV
+LABELV $88
+LABELV $82
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+LABELV $84
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $81
+LABELV $83
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $90
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1124
+ADDP4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+LABELV $90
+ADDRFP4 0
+INDIRP4
+CNSTI4 1124
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $92
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $94
+ADDRFP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $78
+JUMPV
+LABELV $94
+ADDRFP4 4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $78
+JUMPV
+LABELV $92
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+EQI4 $99
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $99
+ADDRFP4 4
+INDIRI4
+CNSTI4 9
+NEI4 $96
+LABELV $99
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $100
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1128
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+LABELV $96
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $101
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1132
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 76
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+LTI4 $102
+ADDRLP4 76
+INDIRI4
+CNSTI4 11
+GTI4 $102
+ADDRLP4 76
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $114-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $114
+address $105
+address $106
+address $106
+address $107
+address $108
+address $109
+address $110
+address $111
+address $112
+address $102
+address $113
+code
+LABELV $105
+ADDRFP4 0
+INDIRP4
+CNSTI4 1136
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1140
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1144
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $103
+JUMPV
+LABELV $106
+ADDRFP4 0
+INDIRP4
+CNSTI4 1136
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1140
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1144
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $103
+JUMPV
+LABELV $107
+ADDRFP4 0
+INDIRP4
+CNSTI4 1136
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1140
+ADDP4
+CNSTF4 1060320051
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1144
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 $103
+JUMPV
+LABELV $108
+ADDRFP4 0
+INDIRP4
+CNSTI4 1136
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1140
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1144
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $103
+JUMPV
+LABELV $109
+ADDRFP4 0
+INDIRP4
+CNSTI4 1136
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1140
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1144
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $103
+JUMPV
+LABELV $110
+ADDRFP4 0
+INDIRP4
+CNSTI4 1136
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1140
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1144
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $103
+JUMPV
+LABELV $111
+ADDRFP4 0
+INDIRP4
+CNSTI4 1136
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1140
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1144
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $103
+JUMPV
+LABELV $112
+ADDRFP4 0
+INDIRP4
+CNSTI4 1136
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1140
+ADDP4
+CNSTF4 1060320051
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1144
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $103
+JUMPV
+LABELV $113
+ADDRFP4 0
+INDIRP4
+CNSTI4 1136
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1140
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1144
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $103
+JUMPV
+LABELV $102
+ADDRFP4 0
+INDIRP4
+CNSTI4 1136
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1140
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1144
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $103
+LABELV $77
+endproc UI_PlayerInfo_SetWeapon 84 12
+proc UI_ForceLegsAnim 8 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1180
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 128
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+BANDI4
+ADDRLP4 4
+INDIRI4
+BXORI4
+ADDRFP4 4
+INDIRI4
+BORI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 18
+NEI4 $117
+ADDRFP4 0
+INDIRP4
+CNSTI4 1216
+ADDP4
+CNSTI4 1000
+ASGNI4
+LABELV $117
+LABELV $116
+endproc UI_ForceLegsAnim 8 0
+proc UI_SetLegsAnim 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1204
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $120
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1204
+ADDP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $120
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_ForceLegsAnim
+CALLV
+pop
+LABELV $119
+endproc UI_SetLegsAnim 4 8
+proc UI_ForceTorsoAnim 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1184
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 128
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+BANDI4
+ADDRLP4 4
+INDIRI4
+BXORI4
+ADDRFP4 4
+INDIRI4
+BORI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 6
+NEI4 $123
+ADDRFP4 0
+INDIRP4
+CNSTI4 1208
+ADDP4
+CNSTI4 2300
+ASGNI4
+LABELV $123
+ADDRFP4 4
+INDIRI4
+CNSTI4 7
+EQI4 $127
+ADDRFP4 4
+INDIRI4
+CNSTI4 8
+NEI4 $125
+LABELV $127
+ADDRFP4 0
+INDIRP4
+CNSTI4 1208
+ADDP4
+CNSTI4 500
+ASGNI4
+LABELV $125
+LABELV $122
+endproc UI_ForceTorsoAnim 12 0
+proc UI_SetTorsoAnim 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1212
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $129
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1212
+ADDP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $129
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_ForceTorsoAnim
+CALLV
+pop
+LABELV $128
+endproc UI_SetTorsoAnim 4 8
+proc UI_TorsoSequencing 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1184
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1176
+ADDP4
+INDIRI4
+EQI4 $132
+ADDRLP4 0
+INDIRI4
+CNSTI4 9
+EQI4 $134
+ADDRFP4 0
+INDIRP4
+CNSTI4 1208
+ADDP4
+CNSTI4 300
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 9
+ARGI4
+ADDRGP4 UI_ForceTorsoAnim
+CALLV
+pop
+LABELV $134
+LABELV $132
+ADDRFP4 0
+INDIRP4
+CNSTI4 1208
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $136
+ADDRGP4 $131
+JUMPV
+LABELV $136
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+NEI4 $138
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $140
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 12
+ARGI4
+ADDRGP4 UI_SetTorsoAnim
+CALLV
+pop
+ADDRGP4 $131
+JUMPV
+LABELV $140
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 11
+ARGI4
+ADDRGP4 UI_SetTorsoAnim
+CALLV
+pop
+ADDRGP4 $131
+JUMPV
+LABELV $138
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+EQI4 $144
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+NEI4 $142
+LABELV $144
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $145
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 12
+ARGI4
+ADDRGP4 UI_SetTorsoAnim
+CALLV
+pop
+ADDRGP4 $131
+JUMPV
+LABELV $145
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 11
+ARGI4
+ADDRGP4 UI_SetTorsoAnim
+CALLV
+pop
+ADDRGP4 $131
+JUMPV
+LABELV $142
+ADDRLP4 0
+INDIRI4
+CNSTI4 9
+NEI4 $147
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetWeapon
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 1208
+ADDP4
+CNSTI4 300
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRGP4 UI_ForceTorsoAnim
+CALLV
+pop
+ADDRGP4 $131
+JUMPV
+LABELV $147
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $149
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $151
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 12
+ARGI4
+ADDRGP4 UI_SetTorsoAnim
+CALLV
+pop
+ADDRGP4 $131
+JUMPV
+LABELV $151
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 11
+ARGI4
+ADDRGP4 UI_SetTorsoAnim
+CALLV
+pop
+LABELV $149
+LABELV $131
+endproc UI_TorsoSequencing 16 8
+proc UI_LegsSequencing 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1180
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1216
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $154
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+NEI4 $153
+CNSTF4 1078530011
+CNSTI4 1000
+ADDRFP4 0
+INDIRP4
+CNSTI4 1216
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRGP4 jumpHeight
+CNSTF4 1113587712
+ADDRLP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $153
+JUMPV
+LABELV $154
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+NEI4 $158
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 19
+ARGI4
+ADDRGP4 UI_ForceLegsAnim
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 1216
+ADDP4
+CNSTI4 130
+ASGNI4
+ADDRGP4 jumpHeight
+CNSTF4 0
+ASGNF4
+ADDRGP4 $153
+JUMPV
+LABELV $158
+ADDRLP4 0
+INDIRI4
+CNSTI4 19
+NEI4 $160
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 22
+ARGI4
+ADDRGP4 UI_SetLegsAnim
+CALLV
+pop
+LABELV $160
+LABELV $153
+endproc UI_LegsSequencing 12 8
+proc UI_PositionEntityOnTag 84 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ADDRFP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_CM_LerpTag
+CALLI4
+pop
+ADDRLP4 56
+CNSTI4 68
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $163
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $164
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $163
+ADDRLP4 4+12
+ARGP4
+ADDRLP4 60
+CNSTI4 28
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP
+ARGP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ARGP4
+ADDRGP4 MatrixMultiply
+CALLV
+pop
+ADDRLP4 64
+CNSTI4 100
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $162
+endproc UI_PositionEntityOnTag 84 24
+proc UI_PositionRotatedEntityOnTag 120 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ADDRFP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_CM_LerpTag
+CALLI4
+pop
+ADDRLP4 92
+CNSTI4 68
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $169
+ADDRLP4 96
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 96
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 104
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ADDRLP4 112
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $170
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $169
+ADDRLP4 96
+CNSTI4 28
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRGP4 MatrixMultiply
+CALLV
+pop
+ADDRLP4 4+12
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 MatrixMultiply
+CALLV
+pop
+LABELV $168
+endproc UI_PositionRotatedEntityOnTag 120 24
+proc UI_SetLerpFrameAnimation 12 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $177
+ADDRFP4 8
+INDIRI4
+CNSTI4 35
+LTI4 $175
+LABELV $177
+ADDRGP4 $178
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $175
+ADDRLP4 0
+CNSTI4 28
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $174
+endproc UI_SetLerpFrameAnimation 12 8
+proc UI_RunLerpFrame 48 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+NEI4 $182
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $180
+LABELV $182
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 UI_SetLerpFrameAnimation
+CALLV
+pop
+LABELV $180
+ADDRGP4 dp_realtime
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+LTI4 $183
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $185
+ADDRGP4 $179
+JUMPV
+LABELV $185
+ADDRGP4 dp_realtime
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+GEI4 $187
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $188
+JUMPV
+LABELV $187
+ADDRLP4 28
+CNSTI4 12
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $188
+ADDRLP4 28
+CNSTI4 12
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+SUBI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $189
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+LSHI4
+ASGNI4
+LABELV $189
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $191
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $193
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+SUBI4
+ADDI4
+ASGNI4
+ADDRGP4 $194
+JUMPV
+LABELV $193
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 dp_realtime
+INDIRI4
+ASGNI4
+LABELV $194
+LABELV $191
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $195
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $196
+JUMPV
+LABELV $195
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $197
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $197
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+MODI4
+SUBI4
+ASGNI4
+ADDRGP4 $198
+JUMPV
+LABELV $197
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $198
+LABELV $196
+ADDRGP4 dp_realtime
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+LEI4 $199
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 dp_realtime
+INDIRI4
+ASGNI4
+LABELV $199
+LABELV $183
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRGP4 dp_realtime
+INDIRI4
+CNSTI4 200
+ADDI4
+LEI4 $201
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 dp_realtime
+INDIRI4
+ASGNI4
+LABELV $201
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRGP4 dp_realtime
+INDIRI4
+LEI4 $203
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 dp_realtime
+INDIRI4
+ASGNI4
+LABELV $203
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+NEI4 $205
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $206
+JUMPV
+LABELV $205
+ADDRLP4 24
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 1065353216
+ADDRGP4 dp_realtime
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+SUBF4
+ASGNF4
+LABELV $206
+LABELV $179
+endproc UI_RunLerpFrame 48 12
+proc UI_PlayerAnimation 16 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1216
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 uis
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1216
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $208
+ADDRFP4 0
+INDIRP4
+CNSTI4 1216
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $208
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_LegsSequencing
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $210
+ADDRFP4 0
+INDIRP4
+CNSTI4 1180
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+CNSTI4 22
+NEI4 $210
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+CNSTI4 24
+ARGI4
+ADDRGP4 UI_RunLerpFrame
+CALLV
+pop
+ADDRGP4 $211
+JUMPV
+LABELV $210
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1180
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_RunLerpFrame
+CALLV
+pop
+LABELV $211
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 1208
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRGP4 uis
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1208
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $212
+ADDRFP4 0
+INDIRP4
+CNSTI4 1208
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $212
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_TorsoSequencing
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1184
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_RunLerpFrame
+CALLV
+pop
+ADDRFP4 16
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 20
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 24
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $207
+endproc UI_PlayerAnimation 16 12
+proc UI_SwingAngles 28 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $215
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 20
+INDIRF4
+GTF4 $219
+ADDRLP4 0
+INDIRF4
+ADDRLP4 20
+INDIRF4
+NEGF4
+GEF4 $217
+LABELV $219
+ADDRFP4 20
+INDIRP4
+CNSTI4 1
+ASGNI4
+LABELV $217
+LABELV $215
+ADDRFP4 20
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $220
+ADDRGP4 $214
+JUMPV
+LABELV $220
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 Q_fabs
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 4
+INDIRF4
+MULF4
+GEF4 $222
+ADDRLP4 4
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 $223
+JUMPV
+LABELV $222
+ADDRLP4 4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+GEF4 $224
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $225
+JUMPV
+LABELV $224
+ADDRLP4 4
+CNSTF4 1073741824
+ASGNF4
+LABELV $225
+LABELV $223
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LTF4 $226
+ADDRLP4 8
+ADDRGP4 uis
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRFP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+LTF4 $228
+ADDRLP4 8
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $228
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 $227
+JUMPV
+LABELV $226
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $230
+ADDRLP4 8
+ADDRGP4 uis
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRFP4 12
+INDIRF4
+NEGF4
+MULF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+GTF4 $232
+ADDRLP4 8
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $232
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+LABELV $230
+LABELV $227
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+LEF4 $234
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+SUBF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 $235
+JUMPV
+LABELV $234
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+NEGF4
+GEF4 $236
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+LABELV $236
+LABELV $235
+LABELV $214
+endproc UI_SwingAngles 28 8
+proc UI_MovedirAdjustment 72 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 1152
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1156
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1168
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 1160
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1172
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+CNSTP4 0
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 Q_fabs
+CALLF4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+CNSTF4 1008981770
+GEF4 $241
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $241
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 Q_fabs
+CALLF4
+ASGNF4
+ADDRLP4 40
+INDIRF4
+CNSTF4 1008981770
+GEF4 $243
+ADDRLP4 0+4
+CNSTF4 0
+ASGNF4
+LABELV $243
+ADDRLP4 44
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 44
+INDIRF4
+NEF4 $247
+ADDRLP4 0
+INDIRF4
+ADDRLP4 44
+INDIRF4
+LEF4 $247
+CNSTF4 0
+RETF4
+ADDRGP4 $238
+JUMPV
+LABELV $247
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 48
+INDIRF4
+GEF4 $250
+ADDRLP4 0
+INDIRF4
+ADDRLP4 48
+INDIRF4
+LEF4 $250
+CNSTF4 1102053376
+RETF4
+ADDRGP4 $238
+JUMPV
+LABELV $250
+ADDRLP4 52
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+GEF4 $253
+ADDRLP4 0
+INDIRF4
+ADDRLP4 52
+INDIRF4
+NEF4 $253
+CNSTF4 1110704128
+RETF4
+ADDRGP4 $238
+JUMPV
+LABELV $253
+ADDRLP4 56
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+GEF4 $256
+ADDRLP4 0
+INDIRF4
+ADDRLP4 56
+INDIRF4
+GEF4 $256
+CNSTF4 3249537024
+RETF4
+ADDRGP4 $238
+JUMPV
+LABELV $256
+ADDRLP4 60
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 60
+INDIRF4
+NEF4 $259
+ADDRLP4 0
+INDIRF4
+ADDRLP4 60
+INDIRF4
+GEF4 $259
+CNSTF4 0
+RETF4
+ADDRGP4 $238
+JUMPV
+LABELV $259
+ADDRLP4 64
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 64
+INDIRF4
+LEF4 $262
+ADDRLP4 0
+INDIRF4
+ADDRLP4 64
+INDIRF4
+GEF4 $262
+CNSTF4 1102053376
+RETF4
+ADDRGP4 $238
+JUMPV
+LABELV $262
+ADDRLP4 68
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 68
+INDIRF4
+LEF4 $265
+ADDRLP4 0
+INDIRF4
+ADDRLP4 68
+INDIRF4
+NEF4 $265
+CNSTF4 3258187776
+RETF4
+ADDRGP4 $238
+JUMPV
+LABELV $265
+CNSTF4 3249537024
+RETF4
+LABELV $238
+endproc UI_MovedirAdjustment 72 16
+proc UI_PlayerAngles 184 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 1152
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 12+4
+INDIRF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 52
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 UI_MovedirAdjustment
+CALLF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+4
+INDIRF4
+CNSTF4 1048576000
+ADDRLP4 36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+CNSTF4 1103626240
+ARGF4
+CNSTF4 1119092736
+ARGF4
+CNSTF4 1050253722
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+ARGP4
+ADDRGP4 UI_SwingAngles
+CALLV
+pop
+ADDRLP4 24+4
+INDIRF4
+ARGF4
+CNSTF4 1109393408
+ARGF4
+CNSTF4 1119092736
+ARGF4
+CNSTF4 1050253722
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRGP4 UI_SwingAngles
+CALLV
+pop
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 1127481344
+LEF4 $283
+ADDRLP4 40
+CNSTF4 1061158912
+ADDRLP4 12
+INDIRF4
+CNSTF4 3283353600
+ADDF4
+MULF4
+ASGNF4
+ADDRGP4 $284
+JUMPV
+LABELV $283
+ADDRLP4 40
+CNSTF4 1061158912
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+LABELV $284
+ADDRLP4 40
+INDIRF4
+ARGF4
+CNSTF4 1097859072
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1036831949
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ARGP4
+ADDRGP4 UI_SwingAngles
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1120
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $285
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $285
+ADDRFP4 0
+INDIRP4
+CNSTI4 1116
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $287
+ADDRLP4 24+4
+ADDRLP4 0+4
+INDIRF4
+ASGNF4
+ADDRLP4 76
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 76
+INDIRF4
+ASGNF4
+LABELV $287
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 AnglesSubtract
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 AnglesSubtract
+CALLV
+pop
+ADDRLP4 24
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1112
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 80
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1112
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 84
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1112
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 88
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1112
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 92
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 92
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1112
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 96
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 96
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1112
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 100
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ADDRLP4 100
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1112
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 104
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1112
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 108
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ADDRLP4 108
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1112
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1112
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 116
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 116
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1112
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 120
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ADDRLP4 120
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1112
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 124
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ADDRLP4 124
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1112
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 128
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ADDRLP4 128
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1112
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 132
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ADDRLP4 132
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1112
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 136
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ADDRLP4 136
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1112
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ADDRLP4 140
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1112
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 144
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ADDRLP4 144
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1112
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1112
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 152
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ADDRLP4 152
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1112
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 156
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ADDRLP4 156
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1112
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 160
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ADDRLP4 160
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1112
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 164
+ADDRFP4 12
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ADDRLP4 164
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1112
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 168
+ADDRFP4 12
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ADDRLP4 168
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1112
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 172
+ADDRFP4 12
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ADDRLP4 172
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1112
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 176
+ADDRFP4 12
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 176
+INDIRP4
+ADDRLP4 176
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1112
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 180
+ADDRFP4 12
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 180
+INDIRP4
+ADDRLP4 180
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1112
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $268
+endproc UI_PlayerAngles 184 24
+proc UI_PlayerFloatSprite 140 12
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+112
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0+132
+CNSTF4 1092616192
+ASGNF4
+ADDRLP4 0+4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $292
+endproc UI_PlayerFloatSprite 140 12
+export UI_MachinegunSpinAngle
+proc UI_MachinegunSpinAngle 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 dp_realtime
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1236
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1228
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $300
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 1232
+ADDP4
+INDIRF4
+CNSTF4 1063675494
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $301
+JUMPV
+LABELV $300
+ADDRLP4 4
+INDIRI4
+CNSTI4 1000
+LEI4 $302
+ADDRLP4 4
+CNSTI4 1000
+ASGNI4
+LABELV $302
+ADDRLP4 12
+CNSTF4 1056964608
+CNSTI4 1000
+ADDRLP4 4
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+CNSTF4 1063675494
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 1232
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $301
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1184
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+NEI4 $304
+ADDRLP4 0
+CNSTI4 7
+ASGNI4
+LABELV $304
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+EQI4 $309
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $310
+JUMPV
+LABELV $309
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $310
+ADDRFP4 0
+INDIRP4
+CNSTI4 1228
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $306
+ADDRFP4 0
+INDIRP4
+CNSTI4 1236
+ADDP4
+ADDRGP4 dp_realtime
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1232
+ADDP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+NEI4 $312
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRGP4 $313
+JUMPV
+LABELV $312
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+LABELV $313
+ADDRFP4 0
+INDIRP4
+CNSTI4 1228
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+LABELV $306
+ADDRLP4 8
+INDIRF4
+RETF4
+LABELV $299
+endproc UI_MachinegunSpinAngle 32 4
+lit
+align 4
+LABELV $315
+byte 4 3246391296
+byte 4 3246391296
+byte 4 3250585600
+align 4
+LABELV $316
+byte 4 1098907648
+byte 4 1098907648
+byte 4 1107296256
+export UI_DrawPlayer
+code
+proc UI_DrawPlayer 1308 28
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 1084
+ADDRGP4 $315
+INDIRB
+ASGNB 12
+ADDRLP4 1096
+ADDRGP4 $316
+INDIRB
+ASGNB 12
+ADDRLP4 1260
+CNSTI4 0
+ASGNI4
+ADDRFP4 16
+INDIRP4
+INDIRI4
+ADDRLP4 1260
+INDIRI4
+EQI4 $321
+ADDRFP4 16
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ADDRLP4 1260
+INDIRI4
+EQI4 $321
+ADDRFP4 16
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+ADDRLP4 1260
+INDIRI4
+EQI4 $321
+ADDRFP4 16
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+ADDRLP4 1260
+INDIRI4
+NEI4 $317
+LABELV $321
+ADDRGP4 $314
+JUMPV
+LABELV $317
+ADDRGP4 dp_realtime
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1196
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $322
+ADDRGP4 dp_realtime
+INDIRI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1200
+ADDP4
+INDIRI4
+LEI4 $322
+ADDRFP4 16
+INDIRP4
+CNSTI4 1188
+ADDP4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1192
+ADDP4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1196
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1200
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1176
+ADDP4
+INDIRI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRI4
+EQI4 $324
+ADDRGP4 weaponChangeSound
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $324
+LABELV $322
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 UI_AdjustFrom640
+CALLV
+pop
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ADDRGP4 jumpHeight
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 368
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 380
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 520
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 660
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 16
+INDIRP4
+CNSTI4 1244
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $326
+ADDRLP4 380+116
+ARGP4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1248
+ADDP4
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 520+116
+ARGP4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1248
+ADDP4
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 660+116
+ARGP4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1248
+ADDP4
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $326
+ADDRLP4 12+76
+CNSTI4 1
+ASGNI4
+ADDRLP4 12+36
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRLP4 12
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 12+4
+ADDRFP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 12+8
+ADDRFP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 12+12
+ADDRFP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 12+16
+CNSTF4 1119092736
+ADDRLP4 12+8
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+56+11308
+INDIRI4
+CVIF4 4
+DIVF4
+MULF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+CNSTF4 1078530011
+ADDRLP4 12+16
+INDIRF4
+CNSTF4 1135869952
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 1268
+ADDRGP4 tan
+CALLF4
+ASGNF4
+ADDRLP4 1252
+ADDRLP4 12+8
+INDIRI4
+CVIF4 4
+ADDRLP4 1268
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 12+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 1252
+INDIRF4
+ARGF4
+ADDRLP4 1272
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRLP4 12+20
+ADDRLP4 1272
+INDIRF4
+ASGNF4
+ADDRLP4 12+20
+CNSTF4 1122316001
+ADDRLP4 12+20
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 1248
+CNSTF4 1060320051
+ADDRLP4 1096+8
+INDIRF4
+ADDRLP4 1084+8
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+CNSTF4 1056964608
+CNSTF4 1078530011
+ADDRLP4 12+16
+INDIRF4
+MULF4
+CNSTF4 1127481344
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 1276
+ADDRGP4 tan
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1248
+INDIRF4
+ADDRLP4 1276
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 1056964608
+ADDRLP4 1084+4
+INDIRF4
+ADDRLP4 1096+4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 3204448256
+ADDRLP4 1084+8
+INDIRF4
+ADDRLP4 1096+8
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1100
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1104
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1108
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+72
+ADDRGP4 dp_realtime
+INDIRI4
+ASGNI4
+ADDRGP4 trap_R_ClearScene
+CALLV
+pop
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 380+28
+ARGP4
+ADDRLP4 520+28
+ARGP4
+ADDRLP4 660+28
+ARGP4
+ADDRGP4 UI_PlayerAngles
+CALLV
+pop
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 380+96
+ARGP4
+ADDRLP4 380+80
+ARGP4
+ADDRLP4 380+100
+ARGP4
+ADDRLP4 520+96
+ARGP4
+ADDRLP4 520+80
+ARGP4
+ADDRLP4 520+100
+ARGP4
+ADDRGP4 UI_PlayerAnimation
+CALLV
+pop
+ADDRLP4 800
+CNSTI4 192
+ASGNI4
+ADDRLP4 380+8
+ADDRFP4 16
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 380+108
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 380+68
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 380+12
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 380+4
+ADDRLP4 800
+INDIRI4
+ASGNI4
+ADDRLP4 380+84
+ADDRLP4 380+68
+INDIRB
+ASGNB 12
+ADDRLP4 380
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 380+8
+INDIRI4
+CNSTI4 0
+NEI4 $373
+ADDRGP4 $314
+JUMPV
+LABELV $373
+ADDRLP4 520+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 520+8
+INDIRI4
+CNSTI4 0
+NEI4 $377
+ADDRGP4 $314
+JUMPV
+LABELV $377
+ADDRLP4 520+108
+ADDRFP4 16
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 520+12
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 520
+ARGP4
+ADDRLP4 380
+ARGP4
+ADDRFP4 16
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $382
+ARGP4
+ADDRGP4 UI_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 520+4
+ADDRLP4 800
+INDIRI4
+ASGNI4
+ADDRLP4 520
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 660+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 660+8
+INDIRI4
+CNSTI4 0
+NEI4 $385
+ADDRGP4 $314
+JUMPV
+LABELV $385
+ADDRLP4 660+108
+ADDRFP4 16
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 660+12
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 660
+ARGP4
+ADDRLP4 520
+ARGP4
+ADDRFP4 16
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $390
+ARGP4
+ADDRGP4 UI_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 660+4
+ADDRLP4 800
+INDIRI4
+ASGNI4
+ADDRLP4 660
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 16
+INDIRP4
+CNSTI4 1176
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $392
+ADDRLP4 804
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 804+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 1124
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 804+12
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 804
+ARGP4
+ADDRLP4 520
+ARGP4
+ADDRFP4 16
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $396
+ARGP4
+ADDRGP4 UI_PositionEntityOnTag
+CALLV
+pop
+ADDRLP4 804+4
+ADDRLP4 800
+INDIRI4
+ASGNI4
+ADDRLP4 804
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $392
+ADDRLP4 1284
+ADDRFP4 16
+INDIRP4
+CNSTI4 1240
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1284
+INDIRI4
+CNSTI4 2
+EQI4 $401
+ADDRLP4 1284
+INDIRI4
+CNSTI4 1
+EQI4 $401
+ADDRLP4 1284
+INDIRI4
+CNSTI4 9
+NEI4 $398
+LABELV $401
+ADDRLP4 944
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 944+12
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 944+4
+ADDRLP4 800
+INDIRI4
+ASGNI4
+ADDRLP4 944+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 1128
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1288+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 1288
+CNSTF4 0
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 1300
+ADDRGP4 UI_MachinegunSpinAngle
+CALLF4
+ASGNF4
+ADDRLP4 1288+8
+ADDRLP4 1300
+INDIRF4
+ASGNF4
+ADDRLP4 1304
+ADDRFP4 16
+INDIRP4
+CNSTI4 1240
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1304
+INDIRI4
+CNSTI4 1
+EQI4 $409
+ADDRLP4 1304
+INDIRI4
+CNSTI4 9
+NEI4 $407
+LABELV $409
+ADDRLP4 1288
+ADDRLP4 1288+8
+INDIRF4
+ASGNF4
+ADDRLP4 1288+8
+CNSTF4 0
+ASGNF4
+LABELV $407
+ADDRLP4 1288
+ARGP4
+ADDRLP4 944+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 944
+ARGP4
+ADDRLP4 804
+ARGP4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1124
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $413
+ARGP4
+ADDRGP4 UI_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 944
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $398
+ADDRGP4 dp_realtime
+INDIRI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1148
+ADDP4
+INDIRI4
+GTI4 $414
+ADDRFP4 16
+INDIRP4
+CNSTI4 1132
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $416
+ADDRLP4 1108
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 1108+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 1132
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1108+12
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 1108
+ARGP4
+ADDRLP4 804
+ARGP4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1124
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $420
+ARGP4
+ADDRGP4 UI_PositionEntityOnTag
+CALLV
+pop
+ADDRLP4 1108+4
+ADDRLP4 800
+INDIRI4
+ASGNI4
+ADDRLP4 1108
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $416
+ADDRLP4 1292
+CNSTF4 0
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1136
+ADDP4
+INDIRF4
+ADDRLP4 1292
+INDIRF4
+NEF4 $425
+ADDRFP4 16
+INDIRP4
+CNSTI4 1140
+ADDP4
+INDIRF4
+ADDRLP4 1292
+INDIRF4
+NEF4 $425
+ADDRFP4 16
+INDIRP4
+CNSTI4 1144
+ADDP4
+INDIRF4
+ADDRLP4 1292
+INDIRF4
+EQF4 $422
+LABELV $425
+ADDRLP4 1296
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1108+68
+ARGP4
+ADDRLP4 1296
+INDIRI4
+CNSTI4 31
+BANDI4
+CNSTI4 200
+ADDI4
+CVIF4 4
+ARGF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1136
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1140
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1144
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $422
+LABELV $414
+ADDRFP4 16
+INDIRP4
+CNSTI4 1220
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $427
+ADDRGP4 $429
+ARGP4
+ADDRLP4 1288
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1288
+INDIRI4
+ARGI4
+ADDRGP4 UI_PlayerFloatSprite
+CALLV
+pop
+LABELV $427
+ADDRLP4 1288
+CNSTF4 1120403456
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 1288
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 1288
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1120403456
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+CNSTF4 1140457472
+ARGF4
+ADDRLP4 1292
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 1292
+INDIRF4
+ARGF4
+ADDRLP4 1292
+INDIRF4
+ARGF4
+ADDRLP4 1292
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+ADDRLP4 1296
+CNSTF4 1120403456
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 1296
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 1296
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1120403456
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+CNSTF4 1140457472
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1300
+CNSTF4 0
+ASGNF4
+ADDRLP4 1300
+INDIRF4
+ARGF4
+ADDRLP4 1300
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_R_RenderScene
+CALLV
+pop
+LABELV $314
+endproc UI_DrawPlayer 1308 28
+proc UI_RegisterClientSkin 84 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $435
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $436
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 68
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $437
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+EQI4 $441
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+EQI4 $441
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+NEI4 $438
+LABELV $441
+CNSTI4 0
+RETI4
+ADDRGP4 $434
+JUMPV
+LABELV $438
+CNSTI4 1
+RETI4
+LABELV $434
+endproc UI_RegisterClientSkin 84 20
+proc UI_ParseAnimationFile 20088 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+ASGNP4
+ADDRLP4 20040
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1108
+ADDP4
+ADDRLP4 20040
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1104
+ADDP4
+ADDRLP4 20040
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1100
+ADDP4
+ADDRLP4 20040
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1112
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 980
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 1116
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1120
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20032
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 20044
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 20044
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+GTI4 $443
+CNSTI4 0
+RETI4
+ADDRGP4 $442
+JUMPV
+LABELV $443
+ADDRLP4 28
+INDIRI4
+CVIU4 4
+CNSTU4 19999
+LTU4 $445
+ADDRGP4 $447
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $442
+JUMPV
+LABELV $445
+ADDRLP4 32
+ARGP4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 20032
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 28
+INDIRI4
+ADDRLP4 32
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 20032
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 32
+ASGNP4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 $449
+JUMPV
+LABELV $448
+ADDRLP4 20
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 20048
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20048
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $451
+ADDRGP4 $450
+JUMPV
+LABELV $451
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $455
+ARGP4
+ADDRLP4 20052
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20052
+INDIRI4
+CNSTI4 0
+NEI4 $453
+ADDRLP4 12
+ARGP4
+ADDRLP4 20056
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20056
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $449
+ADDRGP4 $450
+JUMPV
+LABELV $453
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $460
+ARGP4
+ADDRLP4 20056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20056
+INDIRI4
+CNSTI4 0
+NEI4 $458
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $461
+ADDRLP4 12
+ARGP4
+ADDRLP4 20060
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20060
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $465
+ADDRGP4 $449
+JUMPV
+LABELV $465
+LABELV $462
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $461
+ADDRGP4 $449
+JUMPV
+LABELV $458
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $469
+ARGP4
+ADDRLP4 20060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20060
+INDIRI4
+CNSTI4 0
+NEI4 $467
+ADDRLP4 12
+ARGP4
+ADDRLP4 20064
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20064
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $449
+ADDRGP4 $450
+JUMPV
+LABELV $467
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $474
+ARGP4
+ADDRLP4 20064
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20064
+INDIRI4
+CNSTI4 0
+NEI4 $472
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $475
+ADDRLP4 12
+ARGP4
+ADDRLP4 20068
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20068
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $479
+ADDRGP4 $449
+JUMPV
+LABELV $479
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20072
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1100
+ADDP4
+ADDP4
+ADDRLP4 20072
+INDIRF4
+ASGNF4
+LABELV $476
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $475
+ADDRGP4 $449
+JUMPV
+LABELV $472
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $483
+ARGP4
+ADDRLP4 20068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20068
+INDIRI4
+CNSTI4 0
+NEI4 $481
+ADDRLP4 12
+ARGP4
+ADDRLP4 20072
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20072
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $484
+ADDRGP4 $450
+JUMPV
+LABELV $484
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20076
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1112
+ADDP4
+ADDRLP4 20076
+INDIRF4
+ASGNF4
+ADDRGP4 $449
+JUMPV
+LABELV $481
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $488
+ARGP4
+ADDRLP4 20072
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20072
+INDIRI4
+CNSTI4 0
+NEI4 $486
+ADDRLP4 12
+ARGP4
+ADDRLP4 20076
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20076
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $449
+ADDRGP4 $450
+JUMPV
+LABELV $486
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $493
+ARGP4
+ADDRLP4 20076
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20076
+INDIRI4
+CNSTI4 0
+NEI4 $491
+ADDRFP4 4
+INDIRP4
+CNSTI4 1116
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $449
+JUMPV
+LABELV $491
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $496
+ARGP4
+ADDRLP4 20080
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20080
+INDIRI4
+CNSTI4 0
+NEI4 $494
+ADDRFP4 4
+INDIRP4
+CNSTI4 1120
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $449
+JUMPV
+LABELV $494
+ADDRLP4 20084
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20084
+INDIRI4
+CNSTI4 48
+LTI4 $497
+ADDRLP4 20084
+INDIRI4
+CNSTI4 57
+GTI4 $497
+ADDRLP4 12
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRGP4 $450
+JUMPV
+LABELV $497
+ADDRGP4 $499
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $449
+ADDRGP4 $448
+JUMPV
+LABELV $450
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $500
+ADDRLP4 12
+ARGP4
+ADDRLP4 20048
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20048
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $504
+ADDRLP4 4
+INDIRI4
+CNSTI4 25
+LTI4 $502
+ADDRLP4 4
+INDIRI4
+CNSTI4 34
+GTI4 $502
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $501
+JUMPV
+LABELV $504
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20052
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 20052
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 13
+NEI4 $508
+ADDRLP4 24
+ADDRLP4 8
+INDIRP4
+CNSTI4 364
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $508
+ADDRLP4 4
+INDIRI4
+CNSTI4 13
+LTI4 $510
+ADDRLP4 4
+INDIRI4
+CNSTI4 29
+GEI4 $510
+ADDRLP4 20060
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 20060
+INDIRP4
+ADDRLP4 20060
+INDIRP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $510
+ADDRLP4 12
+ARGP4
+ADDRLP4 20060
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20060
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $512
+ADDRGP4 $502
+JUMPV
+LABELV $512
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20064
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 20064
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $514
+ADDRLP4 20068
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 20068
+INDIRP4
+ADDRLP4 20068
+INDIRP4
+INDIRI4
+NEGI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $514
+ADDRLP4 12
+ARGP4
+ADDRLP4 20068
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20068
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $516
+ADDRGP4 $502
+JUMPV
+LABELV $516
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20072
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRLP4 20072
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 20076
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20076
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $518
+ADDRGP4 $502
+JUMPV
+LABELV $518
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20080
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 20080
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 0
+NEF4 $520
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $520
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 16
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 16
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+LABELV $501
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 35
+LTI4 $500
+LABELV $502
+ADDRLP4 4
+INDIRI4
+CNSTI4 35
+EQI4 $522
+ADDRGP4 $524
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $442
+JUMPV
+LABELV $522
+CNSTI4 1
+RETI4
+LABELV $442
+endproc UI_ParseAnimationFile 20088 12
+proc UI_LoadClientModelname 588 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 456
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $526
+CNSTI4 0
+RETI4
+ADDRGP4 $525
+JUMPV
+LABELV $526
+ADDRLP4 64
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 64
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 460
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 452
+ADDRLP4 460
+INDIRP4
+ASGNP4
+ADDRLP4 452
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $528
+ADDRLP4 128
+ARGP4
+ADDRGP4 $530
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $529
+JUMPV
+LABELV $528
+ADDRLP4 128
+ARGP4
+ADDRLP4 452
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 452
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $529
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $531
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 464
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $532
+ADDRGP4 $534
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $525
+JUMPV
+LABELV $532
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $535
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 468
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $536
+ADDRGP4 $534
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $525
+JUMPV
+LABELV $536
+ADDRLP4 128
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $538
+ADDRLP4 128
+ARGP4
+ADDRGP4 $530
+ARGP4
+ADDRLP4 472
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 472
+INDIRI4
+CNSTI4 0
+EQI4 $538
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $540
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 128
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 476
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $541
+ADDRLP4 480
+ARGP4
+ADDRLP4 128
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 480
+ARGP4
+ADDRGP4 $545
+ARGP4
+ADDRLP4 548
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 544
+ADDRLP4 548
+INDIRP4
+ASGNP4
+ADDRLP4 548
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $547
+ADDRLP4 480
+ARGP4
+ADDRGP4 $546
+ARGP4
+ADDRLP4 552
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 544
+ADDRLP4 552
+INDIRP4
+ASGNP4
+ADDRLP4 552
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $543
+LABELV $547
+ADDRLP4 544
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $543
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $540
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 480
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 556
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRLP4 556
+INDIRI4
+ASGNI4
+LABELV $541
+LABELV $538
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $548
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $550
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 476
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRLP4 476
+INDIRI4
+ASGNI4
+LABELV $548
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $551
+ADDRGP4 $534
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $525
+JUMPV
+LABELV $551
+ADDRLP4 476
+CNSTI4 0
+ASGNI4
+ADDRLP4 192
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1244
+ADDP4
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRGP4 $553
+ARGP4
+ADDRLP4 480
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 196
+ARGP4
+ADDRLP4 480
+INDIRP4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 196
+ARGP4
+ADDRLP4 484
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 484
+INDIRU4
+CNSTU4 0
+EQU4 $554
+ADDRLP4 456
+CNSTI4 1
+ASGNI4
+ADDRLP4 192
+ADDRLP4 196
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+ASGNI4
+ADDRLP4 488
+ARGP4
+ADDRLP4 128
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 488
+ARGP4
+CNSTI4 95
+ARGI4
+ADDRLP4 556
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 552
+ADDRLP4 556
+INDIRP4
+ASGNP4
+ADDRLP4 552
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $556
+ADDRLP4 560
+ADDRLP4 552
+INDIRP4
+ASGNP4
+ADDRLP4 552
+ADDRLP4 560
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 560
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $556
+ADDRGP4 $560
+ARGP4
+ADDRLP4 488
+ARGP4
+ADDRLP4 560
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 560
+INDIRI4
+CNSTI4 0
+EQI4 $562
+ADDRGP4 $561
+ARGP4
+ADDRLP4 488
+ARGP4
+ADDRLP4 564
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 564
+INDIRI4
+CNSTI4 0
+NEI4 $558
+LABELV $562
+ADDRLP4 488
+ARGP4
+ADDRGP4 $530
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $558
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $563
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 488
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 568
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 568
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $564
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 488
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 572
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 572
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $565
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 488
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 576
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 576
+INDIRI4
+ASGNI4
+ADDRLP4 584
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 584
+INDIRI4
+EQI4 $569
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ADDRLP4 584
+INDIRI4
+EQI4 $569
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+ADDRLP4 584
+INDIRI4
+NEI4 $566
+LABELV $569
+ADDRLP4 456
+CNSTI4 0
+ASGNI4
+ADDRGP4 $567
+JUMPV
+LABELV $566
+ADDRFP4 0
+INDIRP4
+CNSTI4 1244
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $567
+LABELV $554
+ADDRLP4 492
+CNSTF4 1132396544
+ADDRLP4 192
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 496
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 492
+INDIRF4
+ADDRLP4 496
+INDIRF4
+LTF4 $571
+ADDRLP4 488
+ADDRLP4 492
+INDIRF4
+ADDRLP4 496
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $572
+JUMPV
+LABELV $571
+ADDRLP4 488
+ADDRLP4 492
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $572
+ADDRFP4 0
+INDIRP4
+CNSTI4 1248
+ADDP4
+ADDRLP4 488
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 504
+CNSTF4 1132396544
+ADDRLP4 192
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table+4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 508
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 504
+INDIRF4
+ADDRLP4 508
+INDIRF4
+LTF4 $575
+ADDRLP4 500
+ADDRLP4 504
+INDIRF4
+ADDRLP4 508
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $576
+JUMPV
+LABELV $575
+ADDRLP4 500
+ADDRLP4 504
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $576
+ADDRFP4 0
+INDIRP4
+CNSTI4 1249
+ADDP4
+ADDRLP4 500
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 516
+CNSTF4 1132396544
+ADDRLP4 192
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table+8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 520
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 516
+INDIRF4
+ADDRLP4 520
+INDIRF4
+LTF4 $579
+ADDRLP4 512
+ADDRLP4 516
+INDIRF4
+ADDRLP4 520
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $580
+JUMPV
+LABELV $579
+ADDRLP4 512
+ADDRLP4 516
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $580
+ADDRFP4 0
+INDIRP4
+CNSTI4 1250
+ADDP4
+ADDRLP4 512
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 1251
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 456
+INDIRI4
+CNSTI4 0
+NEI4 $581
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 128
+ARGP4
+ADDRLP4 524
+ADDRGP4 UI_RegisterClientSkin
+CALLI4
+ASGNI4
+ADDRLP4 524
+INDIRI4
+CNSTI4 0
+NEI4 $581
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 $530
+ARGP4
+ADDRLP4 528
+ADDRGP4 UI_RegisterClientSkin
+CALLI4
+ASGNI4
+ADDRLP4 528
+INDIRI4
+CNSTI4 0
+NEI4 $583
+ADDRGP4 $585
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 128
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $525
+JUMPV
+LABELV $583
+LABELV $581
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $586
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 528
+ADDRGP4 UI_ParseAnimationFile
+CALLI4
+ASGNI4
+ADDRLP4 528
+INDIRI4
+CNSTI4 0
+NEI4 $587
+ADDRGP4 $589
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $525
+JUMPV
+LABELV $587
+CNSTI4 1
+RETI4
+LABELV $525
+endproc UI_LoadClientModelname 588 20
+export UI_ClearModelCache
+proc UI_ClearModelCache 0 12
+ADDRGP4 uiModelCache
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 12640
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 uiModelCacheTime
+CNSTI4 0
+ASGNI4
+LABELV $591
+endproc UI_ClearModelCache 0 12
+proc UI_CopyModelInfo 48 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 56
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 60
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 112
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 116
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 120
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ARGP4
+CNSTU4 980
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 24
+CNSTI4 1100
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 28
+CNSTI4 1112
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+CNSTI4 1116
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 1120
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+CNSTI4 1244
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 1248
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ARGP4
+CNSTU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $592
+endproc UI_CopyModelInfo 48 12
+proc UI_CachedModel 288 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $553
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 8
+ADDRGP4 uiModelCache
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $594
+ADDRLP4 0
+CNSTI4 1580
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiModelCache
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $598
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 272
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+NEI4 $598
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 276
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+NEI4 $598
+ADDRLP4 280
+ADDRGP4 uiModelCacheTime
+ASGNP4
+ADDRLP4 284
+ADDRLP4 280
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 280
+INDIRP4
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 324
+ADDP4
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $593
+JUMPV
+LABELV $598
+ADDRLP4 280
+CNSTI4 324
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 280
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 280
+INDIRI4
+ADDP4
+INDIRI4
+GEI4 $600
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $600
+LABELV $595
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+LTI4 $594
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1580
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 328
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 272
+ADDRGP4 UI_LoadClientModelname
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 320
+ADDP4
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRLP4 276
+ADDRGP4 uiModelCacheTime
+ASGNP4
+ADDRLP4 280
+ADDRLP4 276
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 276
+INDIRP4
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 324
+ADDP4
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $593
+endproc UI_CachedModel 288 12
+export UI_RegisterClientModelname
+proc UI_RegisterClientModelname 16 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $605
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+INDIRU4
+CNSTU4 64
+LTU4 $603
+LABELV $605
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 UI_LoadClientModelname
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $602
+JUMPV
+LABELV $603
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 UI_CachedModel
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 328
+ADDP4
+ARGP4
+ADDRGP4 UI_CopyModelInfo
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 320
+ADDP4
+INDIRI4
+RETI4
+LABELV $602
+endproc UI_RegisterClientModelname 16 8
+export UI_PrecacheClientModelname
+proc UI_PrecacheClientModelname 280 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $609
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 264
+INDIRU4
+CNSTU4 64
+LTU4 $607
+LABELV $609
+CNSTI4 0
+RETI4
+ADDRGP4 $606
+JUMPV
+LABELV $607
+ADDRGP4 $553
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $610
+ADDRLP4 268
+CNSTI4 1580
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiModelCache
+ADDP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $614
+ADDRLP4 268
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 272
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+NEI4 $614
+CNSTI4 1580
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiModelCache+64
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 276
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+NEI4 $614
+CNSTI4 0
+RETI4
+ADDRGP4 $606
+JUMPV
+LABELV $614
+LABELV $611
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $610
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_CachedModel
+CALLP4
+pop
+CNSTI4 1
+RETI4
+LABELV $606
+endproc UI_PrecacheClientModelname 280 12
+export UI_PlayerInfo_SetModel
+proc UI_PlayerInfo_SetModel 12 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1252
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 UI_RegisterClientModelname
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1176
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1192
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1196
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1220
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1224
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetWeapon
+CALLV
+pop
+LABELV $617
+endproc UI_PlayerInfo_SetModel 12 12
+export UI_PlayerInfo_SetInfo
+proc UI_PlayerInfo_SetInfo 40 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1220
+ADDP4
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1152
+ADDP4
+ADDRFP4 12
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 1164
+ADDP4
+ADDRFP4 16
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 1224
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $619
+ADDRFP4 0
+INDIRP4
+CNSTI4 1224
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 jumpHeight
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1204
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_ForceLegsAnim
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1212
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 UI_ForceTorsoAnim
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 20
+INDIRI4
+CNSTI4 -1
+EQI4 $618
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1176
+ADDP4
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1192
+ADDP4
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1196
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetWeapon
+CALLV
+pop
+ADDRGP4 $618
+JUMPV
+LABELV $619
+ADDRFP4 20
+INDIRI4
+CNSTI4 -1
+NEI4 $623
+ADDRFP4 0
+INDIRP4
+CNSTI4 1196
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $624
+JUMPV
+LABELV $623
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $625
+ADDRFP4 0
+INDIRP4
+CNSTI4 1196
+ADDP4
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ADDRGP4 dp_realtime
+INDIRI4
+CNSTI4 250
+ADDI4
+ASGNI4
+LABELV $625
+LABELV $624
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $629
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $627
+LABELV $629
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1176
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetWeapon
+CALLV
+pop
+ADDRGP4 jumpHeight
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1204
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_ForceLegsAnim
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 1212
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 UI_ForceTorsoAnim
+CALLV
+pop
+ADDRGP4 $618
+JUMPV
+LABELV $627
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1180
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 18
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $630
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $632
+ADDRLP4 0
+INDIRI4
+CNSTI4 19
+NEI4 $630
+LABELV $632
+ADDRFP4 0
+INDIRP4
+CNSTI4 1204
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $631
+JUMPV
+LABELV $630
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $633
+ADDRGP4 jumpHeight
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1204
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_ForceLegsAnim
+CALLV
+pop
+LABELV $633
+LABELV $631
+ADDRFP4 8
+INDIRI4
+CNSTI4 11
+EQI4 $637
+ADDRFP4 8
+INDIRI4
+CNSTI4 12
+NEI4 $635
+LABELV $637
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $640
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $638
+LABELV $640
+ADDRFP4 8
+CNSTI4 12
+ASGNI4
+ADDRGP4 $639
+JUMPV
+LABELV $638
+ADDRFP4 8
+CNSTI4 11
+ASGNI4
+LABELV $639
+LABELV $635
+ADDRFP4 8
+INDIRI4
+CNSTI4 7
+EQI4 $643
+ADDRFP4 8
+INDIRI4
+CNSTI4 8
+NEI4 $641
+LABELV $643
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $646
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $644
+LABELV $646
+ADDRFP4 8
+CNSTI4 8
+ASGNI4
+ADDRGP4 $645
+JUMPV
+LABELV $644
+ADDRFP4 8
+CNSTI4 7
+ASGNI4
+LABELV $645
+ADDRFP4 0
+INDIRP4
+CNSTI4 1148
+ADDP4
+ADDRGP4 dp_realtime
+INDIRI4
+CNSTI4 20
+ADDI4
+ASGNI4
+LABELV $641
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1184
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1176
+ADDP4
+INDIRI4
+NEI4 $650
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+EQI4 $650
+ADDRLP4 0
+INDIRI4
+CNSTI4 9
+NEI4 $647
+LABELV $650
+ADDRFP4 0
+INDIRP4
+CNSTI4 1212
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $648
+JUMPV
+LABELV $647
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+EQI4 $653
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+NEI4 $651
+LABELV $653
+ADDRFP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $651
+ADDRFP4 0
+INDIRP4
+CNSTI4 1212
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $652
+JUMPV
+LABELV $651
+ADDRFP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $654
+ADDRFP4 0
+INDIRP4
+CNSTI4 1212
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 UI_ForceTorsoAnim
+CALLV
+pop
+LABELV $654
+LABELV $652
+LABELV $648
+LABELV $618
+endproc UI_PlayerInfo_SetInfo 40 8
+bss
+align 4
+LABELV uiModelCacheTime
+skip 4
+align 4
+LABELV uiModelCache
+skip 12640
+align 4
+LABELV jumpHeight
+skip 4
+align 4
+LABELV dp_realtime
+skip 4
+import UI_HelpMenu_Cache
+import UI_HelpMenu_f
+import UI_HelpMenu
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import UI_InitGameinfo
+import UI_GetNumBots
+import UI_GetBotInfoByNumber
+import UI_GetNumArenas
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_VoiceIngame
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_GetVoiceGainClient
+import trap_GetVoiceMuteAll
+import trap_GetVoiceMuteClient
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_CIN_SetExtents
+import trap_CIN_StopCinematic
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_PlayCinematic
+import trap_RealTime
+import trap_S_StartBackgroundTrack
+import trap_S_StopBackgroundTrack
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_SaveCachedServers
+import trap_LAN_LoadCachedServers
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import BotListCompare
+import uis
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString2
+import UI_AutoWrappedString_LineCount
+import UI_DrawString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawIngameBG
+import UI_DrawStringNS
+import UI_ModelIcon
+import UI_DrawHandlePic1024
+import UI_AdjustFrom1024
+import UI_StopMusic
+import UI_StartCreditMusic
+import UI_StartMusic
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import UI_SpecifyPasswordMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import Demos_Cache
+import UI_DemosMenu
+import SetDefaultBinds_onUnusedKeys
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import SetupDefaultMenu_Cache
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import Music_NextTrack
+import Music_TriggerRestart
+import Music_Check
+import MusicMenu_Cache
+import MusicMenu_Open
+import MusicMenu_Shutdown
+import MusicMenu_Init
+import UI_CallVoteMenu
+import UI_InGameMenu
+import InGame_Cache
+import UI_SecretMenu
+import UI_InitBigCredits
+import UI_BigCredits_Cache
+import UI_CreditMenu
+import ExitMenu_Cache
+import ExitMenu_Init
+import UI_MainMenu
+import MainMenu_Cache
+import UI_UpdateCvars
+import UI_RegisterCvars
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import listbar_bluecolor
+import text_color_bluehighlight
+import text_color_bluenormal
+import text_color_ighighlight
+import text_color_ignormal
+import listbar_igcolor
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_lightOrange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_click_sound
+import menu_switch_sound
+import menu_move_sound
+import ScrollList_Key
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import wop_AutoBindUnusedKeys
+import wop_AutoswitchSongByNextMap
+import con_notifytime
+import s_wop_restarted
+import syc_logo
+import spraycolor
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_createGametype
+import ui_browserHidePrivate
+import ui_browserOnlyHumans
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $589
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $586
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $585
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $565
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $564
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $563
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $561
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $560
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $553
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $550
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $546
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $545
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $540
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $535
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $534
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $531
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $530
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $524
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $499
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $496
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 0
+align 1
+LABELV $493
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $488
+byte 1 115
+byte 1 101
+byte 1 120
+byte 1 0
+align 1
+LABELV $483
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $474
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $469
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $460
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $455
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $447
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $437
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $436
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $435
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $429
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 51
+byte 1 0
+align 1
+LABELV $420
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $413
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $396
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $390
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $382
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 0
+align 1
+LABELV $178
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $101
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $100
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 0
@@ -0,0 +1,5795 @@
+data
+align 4
+LABELV gamecodetoui
+byte 4 4
+byte 4 2
+byte 4 3
+byte 4 0
+byte 4 5
+byte 4 1
+byte 4 6
+align 4
+LABELV uitogamecode
+byte 4 4
+byte 4 6
+byte 4 2
+byte 4 3
+byte 4 1
+byte 4 5
+byte 4 7
+code
+proc PlayerSettings_DrawName 56 20
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 32
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 32
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+INDIRI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+NEI4 $82
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRGP4 $83
+JUMPV
+LABELV $82
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+LABELV $83
+ADDRLP4 20
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 16
+ASGNI4
+ADDRLP4 12
+ADDRGP4 text_color_normal
+ASGNP4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $84
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+ADDRLP4 12
+ADDRGP4 text_color_highlight
+ASGNP4
+LABELV $84
+ADDRLP4 36
+ADDRLP4 36
+INDIRI4
+CNSTI4 10
+ADDI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 27
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRGP4 g_color_table+112
+ASGNP4
+ADDRLP4 8
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $88
+JUMPV
+LABELV $87
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $90
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 Q_IsColorString
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $90
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $92
+ADDRLP4 16
+CNSTI4 7
+ASGNI4
+LABELV $92
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $88
+JUMPV
+LABELV $90
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawChar
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 8
+ADDI4
+ASGNI4
+LABELV $88
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 4
+ADDRLP4 48
+INDIRI1
+ASGNI1
+ADDRLP4 48
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $87
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $94
+ADDRLP4 52
+ADDRGP4 trap_Key_GetOverstrikeMode
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $96
+ADDRLP4 4
+CNSTI1 11
+ASGNI1
+ADDRGP4 $97
+JUMPV
+LABELV $96
+ADDRLP4 4
+CNSTI1 10
+ASGNI1
+LABELV $97
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 -16385
+BANDI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRGP4 color_white
+ARGP4
+ADDRGP4 UI_DrawChar
+CALLV
+pop
+LABELV $94
+LABELV $80
+endproc PlayerSettings_DrawName 56 20
+proc PlayerSettings_DefaultSkin 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $102
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ps_playericons+772-4
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $103
+JUMPV
+LABELV $102
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $103
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $107
+JUMPV
+LABELV $104
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 ps_playericons+1156
+ADDP4
+ARGP4
+ADDRGP4 $112
+ARGP4
+ADDRLP4 12
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $109
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $98
+JUMPV
+LABELV $109
+LABELV $105
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $107
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ps_playericons+772
+ADDP4
+INDIRI4
+LEI4 $104
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $98
+endproc PlayerSettings_DefaultSkin 16 8
+proc PlayerSettings_CacheNeighbours 52 8
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_playersettings+2968
+INDIRI4
+ADDRLP4 32
+INDIRI4
+NEI4 $118
+ADDRGP4 ps_playericons+768
+INDIRI4
+ADDRLP4 32
+INDIRI4
+GTI4 $114
+LABELV $118
+ADDRGP4 $113
+JUMPV
+LABELV $114
+ADDRLP4 28
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+ADDRGP4 s_playersettings+2944
+INDIRI4
+ASGNI4
+ADDRGP4 $122
+JUMPV
+LABELV $119
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 ps_playericons+1156
+ADDP4
+ARGP4
+ADDRGP4 s_playersettings+4356
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $126
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $121
+JUMPV
+LABELV $126
+LABELV $120
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $122
+ADDRLP4 0
+INDIRI4
+ADDRGP4 s_playersettings+2944+4
+INDIRI4
+LEI4 $119
+LABELV $121
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 s_playersettings+2944
+INDIRI4
+LEI4 $130
+ADDRLP4 36
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ADDRLP4 36
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 40
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $130
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+LTI4 $133
+ADDRLP4 28
+INDIRI4
+ADDRGP4 s_playersettings+2944+4
+INDIRI4
+GEI4 $133
+ADDRLP4 40
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ADDRLP4 40
+INDIRI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $133
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $140
+JUMPV
+LABELV $137
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ps_playericons+772
+ADDP4
+INDIRI4
+ADDRGP4 s_playersettings+2944+4
+INDIRI4
+NEI4 $142
+ADDRGP4 $139
+JUMPV
+LABELV $142
+LABELV $138
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $140
+ADDRLP4 4
+INDIRI4
+ADDRGP4 ps_playericons+768
+INDIRI4
+LTI4 $137
+LABELV $139
+ADDRLP4 4
+INDIRI4
+ADDRGP4 ps_playericons+768
+INDIRI4
+GEI4 $147
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LEI4 $150
+ADDRLP4 40
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ADDRLP4 40
+INDIRI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 PlayerSettings_DefaultSkin
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+LABELV $150
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRGP4 ps_playericons+768
+INDIRI4
+GEI4 $152
+ADDRLP4 40
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ADDRLP4 40
+INDIRI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 PlayerSettings_DefaultSkin
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+LABELV $152
+LABELV $147
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $158
+JUMPV
+LABELV $155
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 ps_playericons+1156
+ADDP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 UI_PrecacheClientModelname
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $159
+ADDRGP4 $113
+JUMPV
+LABELV $159
+LABELV $156
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $158
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $155
+ADDRGP4 s_playersettings+2968
+CNSTI4 1
+ASGNI4
+LABELV $113
+endproc PlayerSettings_CacheNeighbours 52 8
+proc PlayerSettings_DrawPlayer 88 28
+ADDRGP4 $164
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 s_playersettings+4356
+ARGP4
+ADDRLP4 80
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+EQI4 $165
+ADDRGP4 s_playersettings+3100
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 UI_PlayerInfo_SetModel
+CALLV
+pop
+ADDRGP4 s_playersettings+4356
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 68+4
+CNSTF4 1128136704
+ASGNF4
+ADDRLP4 84
+CNSTF4 0
+ASGNF4
+ADDRLP4 68
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 68+8
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRGP4 s_playersettings+3100
+ARGP4
+CNSTI4 22
+ARGI4
+CNSTI4 11
+ARGI4
+ADDRLP4 68
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+CNSTI4 2
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetInfo
+CALLV
+pop
+ADDRGP4 s_playersettings+2964
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+ADDRGP4 s_playersettings+2968
+CNSTI4 0
+ASGNI4
+ADDRGP4 $166
+JUMPV
+LABELV $165
+ADDRGP4 PlayerSettings_CacheNeighbours
+CALLV
+pop
+LABELV $166
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 s_playersettings+3100
+ARGP4
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 2
+DIVI4
+ARGI4
+ADDRGP4 UI_DrawPlayer
+CALLV
+pop
+LABELV $163
+endproc PlayerSettings_DrawPlayer 88 28
+proc PlayerSettings_SaveChanges 0 8
+ADDRGP4 $180
+ARGP4
+ADDRGP4 s_playersettings+668+64+12
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $184
+ARGP4
+ADDRGP4 s_playersettings+1124+68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uitogamecode
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $187
+ARGP4
+ADDRGP4 s_playersettings+2960
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 uis+11504
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $179
+endproc PlayerSettings_SaveChanges 0 8
+proc PlayerSettings_MenuKey 20 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 179
+EQI4 $193
+ADDRFP4 0
+INDIRI4
+CNSTI4 27
+NEI4 $191
+LABELV $193
+ADDRGP4 PlayerSettings_SaveChanges
+CALLV
+pop
+LABELV $191
+ADDRFP4 0
+INDIRI4
+CNSTI4 183
+EQI4 $196
+ADDRFP4 0
+INDIRI4
+CNSTI4 141
+NEI4 $194
+LABELV $196
+ADDRGP4 s_playersettings+3100+1188
+INDIRI4
+CNSTI4 9
+LTI4 $197
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $198
+JUMPV
+LABELV $197
+ADDRLP4 0
+ADDRGP4 s_playersettings+3100+1188
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $198
+ADDRGP4 s_playersettings+3100
+ARGP4
+CNSTI4 22
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $207
+ADDRLP4 12
+CNSTI4 12
+ASGNI4
+ADDRGP4 $208
+JUMPV
+LABELV $207
+ADDRLP4 12
+CNSTI4 11
+ASGNI4
+LABELV $208
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 s_playersettings+3100+1152
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetInfo
+CALLV
+pop
+ADDRGP4 $195
+JUMPV
+LABELV $194
+ADDRFP4 0
+INDIRI4
+CNSTI4 184
+EQI4 $211
+ADDRFP4 0
+INDIRI4
+CNSTI4 142
+NEI4 $209
+LABELV $211
+ADDRGP4 s_playersettings+3100+1188
+INDIRI4
+CNSTI4 1
+GTI4 $212
+ADDRLP4 0
+CNSTI4 9
+ASGNI4
+ADDRGP4 $213
+JUMPV
+LABELV $212
+ADDRLP4 0
+ADDRGP4 s_playersettings+3100+1188
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $213
+ADDRGP4 s_playersettings+3100
+ARGP4
+CNSTI4 22
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $222
+ADDRLP4 16
+CNSTI4 12
+ASGNI4
+ADDRGP4 $223
+JUMPV
+LABELV $222
+ADDRLP4 16
+CNSTI4 11
+ASGNI4
+LABELV $223
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 s_playersettings+3100+1152
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetInfo
+CALLV
+pop
+LABELV $209
+LABELV $195
+ADDRGP4 s_playersettings
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 Menu_DefaultKey
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+RETI4
+LABELV $190
+endproc PlayerSettings_MenuKey 20 28
+proc PlayerSettings_SetMenuItems 104 28
+ADDRGP4 $180
+ARGP4
+ADDRLP4 20
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 s_playersettings+668+64+12
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $184
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 24
+INDIRF4
+CVFI4 4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $233
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LEI4 $231
+LABELV $233
+ADDRLP4 0
+CNSTI4 6
+ASGNI4
+LABELV $231
+ADDRGP4 s_playersettings+1124+68
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 gamecodetoui
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_playersettings+3100
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1252
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4+4
+CNSTF4 1125515264
+ASGNF4
+ADDRLP4 32
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRGP4 $164
+ARGP4
+ADDRLP4 36
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 s_playersettings+3100
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRGP4 UI_PlayerInfo_SetModel
+CALLV
+pop
+ADDRGP4 s_playersettings+3100
+ARGP4
+CNSTI4 22
+ARGI4
+CNSTI4 11
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+CNSTI4 2
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetInfo
+CALLV
+pop
+ADDRGP4 $164
+ARGP4
+ADDRLP4 80
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 44
+ARGP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRGP4 $244
+JUMPV
+LABELV $241
+ADDRLP4 40
+INDIRI4
+ADDRLP4 44
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $245
+ADDRLP4 40
+INDIRI4
+ADDRLP4 44
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $243
+JUMPV
+LABELV $245
+LABELV $242
+ADDRLP4 40
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $244
+ADDRLP4 40
+INDIRI4
+CVIU4 4
+CNSTU4 32
+LTU4 $241
+LABELV $243
+ADDRLP4 44
+ARGP4
+ADDRLP4 84
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 76
+ADDRLP4 84
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRGP4 $250
+JUMPV
+LABELV $247
+ADDRLP4 88
+CNSTI4 68
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ps_playericons+772
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 ps_playericons+1156
+ADDP4
+ASGNP4
+ADDRLP4 44
+ARGP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+NEI4 $254
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $260
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRGP4 $261
+JUMPV
+LABELV $260
+ADDRLP4 96
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ps_playericons+772-4
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $261
+ADDRGP4 s_playersettings+2940
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRGP4 s_playersettings+2944
+ADDRGP4 s_playersettings+2940
+INDIRI4
+ASGNI4
+ADDRGP4 s_playersettings+2944+4
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ps_playericons+772
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 4
+ADDI4
+ADDRGP4 ps_playericons+768
+INDIRI4
+GEI4 $271
+ADDRLP4 100
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $272
+JUMPV
+LABELV $271
+ADDRLP4 100
+ADDRGP4 ps_playericons+768
+INDIRI4
+CNSTI4 4
+SUBI4
+ASGNI4
+LABELV $272
+ADDRGP4 s_playersettings+2936
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRGP4 $249
+JUMPV
+LABELV $254
+LABELV $248
+ADDRLP4 40
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $250
+ADDRLP4 40
+INDIRI4
+ADDRGP4 ps_playericons+768
+INDIRI4
+LTI4 $247
+LABELV $249
+ADDRGP4 $273
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 1084227584
+ARGF4
+CNSTF4 1120403456
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 44
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 s_playersettings+1004+68
+CNSTI4 20
+ADDRLP4 16
+INDIRI4
+CNSTI4 5
+DIVI4
+SUBI4
+ASGNI4
+LABELV $224
+endproc PlayerSettings_SetMenuItems 104 28
+proc GetSpecialSkinScore 12 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $279
+ARGP4
+ADDRLP4 0
+ADDRGP4 Q_stristr
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $277
+CNSTI4 3
+RETI4
+ADDRGP4 $276
+JUMPV
+LABELV $277
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $282
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stristr
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $280
+CNSTI4 2
+RETI4
+ADDRGP4 $276
+JUMPV
+LABELV $280
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $285
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stristr
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $283
+CNSTI4 1
+RETI4
+ADDRGP4 $276
+JUMPV
+LABELV $283
+CNSTI4 0
+RETI4
+LABELV $276
+endproc GetSpecialSkinScore 12 8
+proc SkinComp 32 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 GetSpecialSkinScore
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 GetSpecialSkinScore
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $289
+ADDRLP4 12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $287
+LABELV $289
+ADDRLP4 12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+RETI4
+ADDRGP4 $286
+JUMPV
+LABELV $287
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+RETI4
+LABELV $286
+endproc SkinComp 32 8
+proc sortSkins 4 16
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 ps_playericons+1156
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+CVIU4 4
+ARGU4
+CNSTU4 68
+ARGU4
+ADDRGP4 SkinComp
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+LABELV $290
+endproc sortSkins 4 16
+lit
+align 1
+LABELV fixedModelList
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 0
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 103
+byte 1 105
+byte 1 114
+byte 1 108
+byte 1 0
+byte 1 109
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 108
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 121
+byte 1 0
+byte 1 102
+byte 1 97
+byte 1 116
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 0
+align 4
+LABELV numFixedModels
+byte 4 5
+code
+proc IsEntryInList 24 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $294
+JUMPV
+LABELV $293
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 12
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $296
+CNSTI4 1
+RETI4
+ADDRGP4 $292
+JUMPV
+LABELV $296
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $294
+ADDRLP4 4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $293
+CNSTI4 0
+RETI4
+LABELV $292
+endproc IsEntryInList 24 8
+proc IsAFixedModelListEntry 4 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 fixedModelList
+ARGP4
+ADDRGP4 numFixedModels
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 IsEntryInList
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $298
+endproc IsAFixedModelListEntry 4 12
+proc TweakModelFolderList 2088 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 2060
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 fixedModelList
+ARGP4
+CNSTU4 39
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 2060
+ADDRGP4 numFixedModels
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12+39
+ASGNP4
+ADDRGP4 $302
+JUMPV
+LABELV $301
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2068
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 2064
+ADDRLP4 2068
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 2064
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $304
+ADDRLP4 2064
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $304
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2072
+ADDRGP4 IsAFixedModelListEntry
+CALLI4
+ASGNI4
+ADDRLP4 2072
+INDIRI4
+CNSTI4 0
+NEI4 $306
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 2060
+INDIRI4
+ARGI4
+ADDRLP4 2076
+ADDRGP4 IsEntryInList
+CALLI4
+ASGNI4
+ADDRLP4 2076
+INDIRI4
+CNSTI4 0
+NEI4 $306
+ADDRLP4 2080
+CNSTI4 2048
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 12
+CVPU4 4
+SUBU4
+CVUI4 4
+SUBI4
+ASGNI4
+ADDRLP4 2080
+INDIRI4
+ADDRLP4 2064
+INDIRI4
+CNSTI4 1
+ADDI4
+GEI4 $308
+ADDRGP4 $310
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $299
+JUMPV
+LABELV $308
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2080
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 2084
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 2084
+INDIRU4
+CNSTU4 1
+ADDU4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 2060
+ADDRLP4 2060
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $306
+ADDRLP4 2080
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 2064
+INDIRI4
+ADDRLP4 2080
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 2080
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $302
+ADDRLP4 8
+INDIRI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+LTI4 $301
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTU4 2048
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+ADDRLP4 2060
+INDIRI4
+ASGNI4
+LABELV $299
+endproc TweakModelFolderList 2088 12
+proc PlayerSettings_BuildList 4260 20
+ADDRLP4 2144
+CNSTI4 0
+ASGNI4
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+ADDRLP4 76
+CNSTP4 0
+ASGNP4
+ADDRLP4 64
+CNSTP4 0
+ASGNP4
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRGP4 ps_playericons
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 44676
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $312
+ARGP4
+ADDRGP4 $313
+ARGP4
+ADDRLP4 2148
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRLP4 4196
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 2144
+ADDRLP4 4196
+INDIRI4
+ASGNI4
+ADDRLP4 2148
+ARGP4
+ADDRLP4 2144
+ARGP4
+ADDRGP4 TweakModelFolderList
+CALLV
+pop
+ADDRLP4 76
+ADDRLP4 2148
+ASGNP4
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRGP4 $317
+JUMPV
+LABELV $314
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 4200
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 92
+ADDRLP4 4200
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+EQI4 $319
+ADDRLP4 92
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 76
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $319
+ADDRLP4 92
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 76
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $319
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRGP4 $323
+ARGP4
+ADDRLP4 4208
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 4208
+INDIRI4
+CNSTI4 0
+EQI4 $326
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRGP4 $324
+ARGP4
+ADDRLP4 4212
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 4216
+CNSTI4 0
+ASGNI4
+ADDRLP4 4212
+INDIRI4
+ADDRLP4 4216
+INDIRI4
+EQI4 $326
+ADDRLP4 76
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 4216
+INDIRI4
+NEI4 $321
+LABELV $326
+ADDRGP4 $315
+JUMPV
+LABELV $321
+ADDRGP4 $330
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 4220
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4220
+INDIRP4
+ARGP4
+ADDRLP4 4224
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 ps_playericons+768
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ps_playericons
+ADDP4
+ADDRLP4 4224
+INDIRI4
+ASGNI4
+ADDRLP4 4224
+INDIRI4
+CNSTI4 0
+NEI4 $327
+ADDRGP4 $315
+JUMPV
+LABELV $327
+ADDRGP4 $333
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 4228
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4228
+INDIRP4
+ARGP4
+ADDRLP4 4232
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 ps_playericons+768
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ps_playericons+384
+ADDP4
+ADDRLP4 4232
+INDIRI4
+ASGNI4
+ADDRGP4 $334
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 4236
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4236
+INDIRP4
+ARGP4
+ADDRGP4 $335
+ARGP4
+ADDRLP4 96
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRLP4 4240
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 84
+ADDRLP4 4240
+INDIRI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 96
+ASGNP4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRGP4 $339
+JUMPV
+LABELV $336
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 4244
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 72
+ADDRLP4 4244
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $344
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRLP4 4248
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 4248
+INDIRI4
+CNSTI4 0
+NEI4 $342
+ADDRGP4 $347
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4252
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4252
+INDIRP4
+ARGP4
+ADDRLP4 4256
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+CNSTI4 68
+ADDRLP4 80
+INDIRI4
+MULI4
+ADDRGP4 ps_playericons+1156+64
+ADDP4
+ADDRLP4 4256
+INDIRI4
+ASGNI4
+CNSTI4 68
+ADDRLP4 80
+INDIRI4
+MULI4
+ADDRGP4 ps_playericons+1156
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $349
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 0+5
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $342
+LABELV $337
+ADDRLP4 4244
+CNSTI4 1
+ASGNI4
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+ADDRLP4 4244
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 72
+INDIRI4
+ADDRLP4 4244
+INDIRI4
+ADDI4
+ADDRLP4 64
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $339
+ADDRLP4 68
+INDIRI4
+ADDRLP4 84
+INDIRI4
+GEI4 $351
+ADDRGP4 ps_playericons+768
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ps_playericons+772
+ADDP4
+INDIRI4
+CNSTI4 640
+LTI4 $336
+LABELV $351
+ADDRGP4 ps_playericons+768
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ps_playericons+772
+ADDP4
+ADDRLP4 80
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 4248
+ADDRGP4 ps_playericons+768
+ASGNP4
+ADDRLP4 4248
+INDIRP4
+ADDRLP4 4248
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $315
+ADDRLP4 4200
+CNSTI4 1
+ASGNI4
+ADDRLP4 88
+ADDRLP4 88
+INDIRI4
+ADDRLP4 4200
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 76
+ADDRLP4 92
+INDIRI4
+ADDRLP4 4200
+INDIRI4
+ADDI4
+ADDRLP4 76
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $317
+ADDRLP4 88
+INDIRI4
+ADDRLP4 2144
+INDIRI4
+GEI4 $355
+ADDRGP4 ps_playericons+768
+INDIRI4
+CNSTI4 96
+LTI4 $314
+LABELV $355
+ADDRLP4 4204
+CNSTI4 0
+ASGNI4
+ADDRLP4 68
+ADDRLP4 4204
+INDIRI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 4204
+INDIRI4
+ASGNI4
+ADDRGP4 $359
+JUMPV
+LABELV $356
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ps_playericons+772
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 sortSkins
+CALLV
+pop
+ADDRLP4 68
+ADDRLP4 88
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ps_playericons+772
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $357
+ADDRLP4 88
+ADDRLP4 88
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $359
+ADDRLP4 88
+INDIRI4
+ADDRGP4 ps_playericons+768
+INDIRI4
+LTI4 $356
+LABELV $311
+endproc PlayerSettings_BuildList 4260 20
+bss
+align 1
+LABELV $364
+skip 32
+code
+proc PlayerSettings_Draw 24 28
+ADDRGP4 s_playersettings+2964
+INDIRI4
+CNSTI4 0
+NEI4 $365
+ADDRGP4 s_playersettings+2964
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 5000
+ADDI4
+ASGNI4
+LABELV $365
+ADDRGP4 s_playersettings+2964
+INDIRI4
+ADDRGP4 uis+4
+INDIRI4
+GEI4 $370
+ADDRGP4 s_playersettings+3100
+ARGP4
+CNSTI4 22
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 s_playersettings+3100+1152
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRGP4 s_playersettings+3100+1188
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetInfo
+CALLV
+pop
+ADDRGP4 s_playersettings+2964
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 15000
+ADDI4
+ASGNI4
+LABELV $370
+ADDRGP4 s_playersettings+2952
+INDIRI4
+CNSTI4 0
+EQI4 $381
+CNSTI4 178
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_Key_IsDown
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $384
+ADDRLP4 8
+ADDRGP4 s_playersettings+3100+64+20
+ASGNP4
+ADDRLP4 12
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ADDRGP4 uis+8
+INDIRI4
+ADDRGP4 s_playersettings+2956
+INDIRI4
+SUBI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 s_playersettings+3100+8+20
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 s_playersettings+3100+1152+4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 s_playersettings+2956
+ADDRGP4 uis+8
+INDIRI4
+ASGNI4
+ADDRGP4 $385
+JUMPV
+LABELV $384
+ADDRGP4 s_playersettings+2952
+CNSTI4 0
+ASGNI4
+LABELV $385
+LABELV $381
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $400
+CNSTI4 108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playersettings+1868+64
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 s_playersettings+2936
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ps_playericons
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playersettings+1868+72
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 s_playersettings+2936
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ps_playericons+384
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $401
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $400
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $411
+ADDRLP4 4
+ADDRGP4 s_playersettings+2940
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 s_playersettings+2944+4
+INDIRI4
+LEI4 $416
+ADDRLP4 8
+CNSTI4 108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playersettings+2300+48
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRGP4 $417
+JUMPV
+LABELV $416
+CNSTI4 108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playersettings+2300+64
+ADDP4
+CNSTI4 68
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 ps_playericons+1156+64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playersettings+2300+48
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $417
+LABELV $412
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $411
+ADDRGP4 $428
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+CNSTF4 0
+ARGF4
+CNSTF4 1084227584
+ARGF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 spraycolors
+ADDP4
+ARGP4
+ADDRGP4 UI_SetColor
+CALLV
+pop
+CNSTF4 1117257728
+ARGF4
+CNSTF4 1139277824
+ARGF4
+ADDRLP4 12
+CNSTF4 1119879168
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRGP4 s_playersettings+2960
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uis+13552
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic1024
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 UI_SetColor
+CALLV
+pop
+ADDRGP4 $164
+ARGP4
+ADDRLP4 16
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 $364
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $434
+JUMPV
+LABELV $431
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $364
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $435
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $364
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $433
+JUMPV
+LABELV $435
+LABELV $432
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $434
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 32
+LTU4 $431
+LABELV $433
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $364+1
+ADDP4
+ARGP4
+ADDRGP4 $112
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $437
+CNSTI4 320
+ARGI4
+CNSTI4 440
+ARGI4
+ADDRGP4 $364
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRGP4 $438
+JUMPV
+LABELV $437
+CNSTI4 320
+ARGI4
+CNSTI4 440
+ARGI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $364+1
+ADDP4
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+LABELV $438
+ADDRGP4 s_playersettings
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+LABELV $363
+endproc PlayerSettings_Draw 24 28
+proc PlayerSettings_MenuEvent 124 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $442
+ADDRGP4 $441
+JUMPV
+LABELV $442
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 11
+LTI4 $444
+ADDRLP4 4
+INDIRI4
+CNSTI4 30
+GTI4 $444
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $536-44
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $536
+address $445
+address $444
+address $447
+address $444
+address $448
+address $453
+address $459
+address $465
+address $472
+address $472
+address $472
+address $472
+address $472
+address $506
+address $506
+address $506
+address $515
+address $521
+address $530
+address $524
+code
+LABELV $447
+ADDRGP4 PlayerSettings_SaveChanges
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $445
+JUMPV
+LABELV $448
+ADDRGP4 s_playersettings+2936
+INDIRI4
+CNSTI4 0
+LEI4 $445
+ADDRLP4 12
+ADDRGP4 s_playersettings+2936
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $445
+JUMPV
+LABELV $453
+ADDRGP4 s_playersettings+2936
+INDIRI4
+CNSTI4 4
+ADDI4
+ADDRGP4 ps_playericons+768
+INDIRI4
+GEI4 $445
+ADDRLP4 16
+ADDRGP4 s_playersettings+2936
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $445
+JUMPV
+LABELV $459
+ADDRGP4 s_playersettings+2940
+INDIRI4
+ADDRGP4 s_playersettings+2944
+INDIRI4
+LEI4 $445
+ADDRLP4 20
+ADDRGP4 s_playersettings+2940
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $445
+JUMPV
+LABELV $465
+ADDRGP4 s_playersettings+2940
+INDIRI4
+CNSTI4 2
+ADDI4
+ADDRGP4 s_playersettings+2944+4
+INDIRI4
+GEI4 $445
+ADDRLP4 24
+ADDRGP4 s_playersettings+2940
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $445
+JUMPV
+LABELV $472
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 s_playersettings+2936
+INDIRI4
+CNSTI4 19
+SUBI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LEI4 $474
+ADDRLP4 28
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ps_playericons+772-4
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 s_playersettings+2940
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 s_playersettings+2944
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $475
+JUMPV
+LABELV $474
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_playersettings+2940
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 s_playersettings+2944
+ADDRLP4 32
+INDIRI4
+ASGNI4
+LABELV $475
+ADDRGP4 s_playersettings+2944+4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ps_playericons+772
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 s_playersettings+2944
+INDIRI4
+ASGNI4
+ADDRGP4 $488
+JUMPV
+LABELV $485
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 ps_playericons+1156
+ADDP4
+ARGP4
+ADDRGP4 $112
+ARGP4
+ADDRLP4 36
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $492
+ADDRLP4 40
+ARGP4
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 ps_playericons+1156
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 40
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 108
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 104
+ADDRLP4 108
+INDIRP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $496
+ADDRLP4 104
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $496
+ADDRLP4 40
+ARGP4
+ADDRLP4 112
+ADDRGP4 Q_strlwr
+CALLP4
+ASGNP4
+ADDRGP4 $498
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRLP4 116
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 120
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $164
+ARGP4
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 ps_playericons+1156
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $500
+ARGP4
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 ps_playericons+1156
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $502
+ARGP4
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 ps_playericons+1156
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $504
+ARGP4
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 ps_playericons+1156
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $445
+JUMPV
+LABELV $492
+LABELV $486
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $488
+ADDRLP4 0
+INDIRI4
+ADDRGP4 s_playersettings+2944+4
+INDIRI4
+LEI4 $485
+ADDRGP4 $445
+JUMPV
+LABELV $506
+ADDRGP4 $164
+ARGP4
+CNSTI4 68
+ADDRLP4 4
+INDIRI4
+CNSTI4 24
+SUBI4
+ADDRGP4 s_playersettings+2940
+INDIRI4
+ADDI4
+MULI4
+ADDRGP4 ps_playericons+1156
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $500
+ARGP4
+CNSTI4 68
+ADDRLP4 4
+INDIRI4
+CNSTI4 24
+SUBI4
+ADDRGP4 s_playersettings+2940
+INDIRI4
+ADDI4
+MULI4
+ADDRGP4 ps_playericons+1156
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $502
+ARGP4
+CNSTI4 68
+ADDRLP4 4
+INDIRI4
+CNSTI4 24
+SUBI4
+ADDRGP4 s_playersettings+2940
+INDIRI4
+ADDI4
+MULI4
+ADDRGP4 ps_playericons+1156
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $504
+ARGP4
+CNSTI4 68
+ADDRLP4 4
+INDIRI4
+CNSTI4 24
+SUBI4
+ADDRGP4 s_playersettings+2940
+INDIRI4
+ADDI4
+MULI4
+ADDRGP4 ps_playericons+1156
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $445
+JUMPV
+LABELV $515
+CNSTI4 178
+ARGI4
+ADDRLP4 36
+ADDRGP4 trap_Key_IsDown
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $516
+ADDRGP4 s_playersettings+2952
+CNSTI4 1
+ASGNI4
+LABELV $516
+ADDRGP4 s_playersettings+2956
+ADDRGP4 uis+8
+INDIRI4
+ASGNI4
+ADDRGP4 $445
+JUMPV
+LABELV $521
+ADDRGP4 $522
+ARGP4
+ADDRGP4 uis+8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 14
+DIVI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $428
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $445
+JUMPV
+LABELV $524
+ADDRLP4 44
+ADDRGP4 s_playersettings+2960
+ASGNP4
+ADDRLP4 48
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+GEI4 $445
+ADDRGP4 s_playersettings+2960
+ADDRGP4 uis+13808
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $445
+JUMPV
+LABELV $530
+ADDRLP4 52
+ADDRGP4 s_playersettings+2960
+ASGNP4
+ADDRLP4 56
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRGP4 uis+13808
+INDIRI4
+LTI4 $445
+ADDRGP4 s_playersettings+2960
+CNSTI4 0
+ASGNI4
+LABELV $444
+LABELV $445
+LABELV $441
+endproc PlayerSettings_MenuEvent 124 12
+proc PlayerSettings_MenuInit 112 12
+ADDRGP4 s_playersettings
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 4420
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 UI_ClearModelCache
+CALLV
+pop
+ADDRGP4 PlayerSettings_Cache
+CALLV
+pop
+ADDRGP4 s_playersettings+272
+ADDRGP4 PlayerSettings_MenuKey
+ASGNP4
+ADDRGP4 s_playersettings+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_playersettings+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_playersettings+2944+4
+ADDRGP4 ps_playericons+772
+INDIRI4
+ASGNI4
+ADDRGP4 s_playersettings+268
+ADDRGP4 PlayerSettings_Draw
+ASGNP4
+ADDRGP4 s_playersettings+284
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_playersettings+2972
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_playersettings+2972+48
+CNSTU4 1050628
+ASGNU4
+ADDRGP4 s_playersettings+2972+16
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_playersettings+2972+20
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_playersettings+2972+80
+CNSTI4 640
+ASGNI4
+ADDRGP4 s_playersettings+2972+84
+CNSTI4 480
+ASGNI4
+ADDRGP4 s_playersettings
+ARGP4
+ADDRGP4 s_playersettings+2972
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_playersettings+572
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_playersettings+572+48
+CNSTU4 1050624
+ASGNU4
+ADDRGP4 s_playersettings+572+60
+ADDRGP4 PlayerSettings_DrawPlayer
+ASGNP4
+ADDRGP4 s_playersettings+572+16
+CNSTI4 160
+ASGNI4
+ADDRGP4 s_playersettings+572+20
+CNSTI4 15
+ASGNI4
+ADDRGP4 s_playersettings+572+80
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_playersettings+572+84
+CNSTI4 560
+ASGNI4
+ADDRGP4 s_playersettings+572+52
+ADDRGP4 PlayerSettings_MenuEvent
+ASGNP4
+ADDRGP4 s_playersettings+572+12
+CNSTI4 27
+ASGNI4
+ADDRGP4 s_playersettings
+ARGP4
+ADDRGP4 s_playersettings+572
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_playersettings+1436
+CNSTI4 11
+ASGNI4
+ADDRGP4 s_playersettings+1436+76
+CNSTI4 34
+ASGNI4
+ADDRGP4 s_playersettings+1436+80
+CNSTI4 33
+ASGNI4
+ADDRGP4 s_playersettings+1436+84
+CNSTI4 55
+ASGNI4
+ADDRGP4 s_playersettings+1436+88
+CNSTI4 117
+ASGNI4
+ADDRGP4 s_playersettings+1436+92
+CNSTI4 38
+ASGNI4
+ADDRGP4 s_playersettings+1436+96
+CNSTI4 38
+ASGNI4
+ADDRGP4 s_playersettings+1436+100
+CNSTI4 56
+ASGNI4
+ADDRGP4 s_playersettings+1436+104
+CNSTI4 117
+ASGNI4
+ADDRGP4 $596
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_playersettings+1436+64
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $599
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_playersettings+1436+72
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 s_playersettings+1436+52
+ADDRGP4 PlayerSettings_MenuEvent
+ASGNP4
+ADDRGP4 s_playersettings+1436+12
+CNSTI4 15
+ASGNI4
+ADDRGP4 s_playersettings
+ARGP4
+ADDRGP4 s_playersettings+1436
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_playersettings+1544
+CNSTI4 11
+ASGNI4
+ADDRGP4 s_playersettings+1544+76
+CNSTI4 937
+ASGNI4
+ADDRGP4 s_playersettings+1544+80
+CNSTI4 32
+ASGNI4
+ADDRGP4 s_playersettings+1544+84
+CNSTI4 55
+ASGNI4
+ADDRGP4 s_playersettings+1544+88
+CNSTI4 117
+ASGNI4
+ADDRGP4 s_playersettings+1544+92
+CNSTI4 933
+ASGNI4
+ADDRGP4 s_playersettings+1544+96
+CNSTI4 35
+ASGNI4
+ADDRGP4 s_playersettings+1544+100
+CNSTI4 58
+ASGNI4
+ADDRGP4 s_playersettings+1544+104
+CNSTI4 120
+ASGNI4
+ADDRGP4 $624
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_playersettings+1544+64
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $627
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_playersettings+1544+72
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 s_playersettings+1544+52
+ADDRGP4 PlayerSettings_MenuEvent
+ASGNP4
+ADDRGP4 s_playersettings+1544+12
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_playersettings
+ARGP4
+ADDRGP4 s_playersettings+1544
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_playersettings+1652
+CNSTI4 11
+ASGNI4
+ADDRGP4 s_playersettings+1652+76
+CNSTI4 873
+ASGNI4
+ADDRGP4 s_playersettings+1652+80
+CNSTI4 193
+ASGNI4
+ADDRGP4 s_playersettings+1652+84
+CNSTI4 117
+ASGNI4
+ADDRGP4 s_playersettings+1652+88
+CNSTI4 37
+ASGNI4
+ADDRGP4 s_playersettings+1652+92
+CNSTI4 875
+ASGNI4
+ADDRGP4 s_playersettings+1652+96
+CNSTI4 199
+ASGNI4
+ADDRGP4 s_playersettings+1652+100
+CNSTI4 119
+ASGNI4
+ADDRGP4 s_playersettings+1652+104
+CNSTI4 39
+ASGNI4
+ADDRGP4 $652
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_playersettings+1652+64
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $655
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_playersettings+1652+72
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 s_playersettings+1652+52
+ADDRGP4 PlayerSettings_MenuEvent
+ASGNP4
+ADDRGP4 s_playersettings+1652+12
+CNSTI4 17
+ASGNI4
+ADDRGP4 s_playersettings
+ARGP4
+ADDRGP4 s_playersettings+1652
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_playersettings+1760
+CNSTI4 11
+ASGNI4
+ADDRGP4 s_playersettings+1760+76
+CNSTI4 871
+ASGNI4
+ADDRGP4 s_playersettings+1760+80
+CNSTI4 687
+ASGNI4
+ADDRGP4 s_playersettings+1760+84
+CNSTI4 117
+ASGNI4
+ADDRGP4 s_playersettings+1760+88
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_playersettings+1760+92
+CNSTI4 876
+ASGNI4
+ADDRGP4 s_playersettings+1760+96
+CNSTI4 692
+ASGNI4
+ADDRGP4 s_playersettings+1760+100
+CNSTI4 117
+ASGNI4
+ADDRGP4 s_playersettings+1760+104
+CNSTI4 40
+ASGNI4
+ADDRGP4 $680
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_playersettings+1760+64
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $683
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_playersettings+1760+72
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 s_playersettings+1760+52
+ADDRGP4 PlayerSettings_MenuEvent
+ASGNP4
+ADDRGP4 s_playersettings+1760+12
+CNSTI4 18
+ASGNI4
+ADDRGP4 s_playersettings
+ARGP4
+ADDRGP4 s_playersettings+1760
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $689
+CNSTI4 108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playersettings+1868
+ADDP4
+CNSTI4 11
+ASGNI4
+CNSTI4 108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playersettings+1868+76
+ADDP4
+CNSTI4 180
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 160
+ADDI4
+ASGNI4
+CNSTI4 108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playersettings+1868+80
+ADDP4
+CNSTI4 16
+ASGNI4
+ADDRLP4 40
+CNSTI4 108
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 160
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 s_playersettings+1868+88
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 s_playersettings+1868+84
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+CNSTI4 108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playersettings+1868+64
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playersettings+1868+72
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playersettings+1868+52
+ADDP4
+ADDRGP4 PlayerSettings_MenuEvent
+ASGNP4
+CNSTI4 108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playersettings+1868+12
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 19
+ADDI4
+ASGNI4
+ADDRGP4 s_playersettings
+ARGP4
+CNSTI4 108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playersettings+1868
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $690
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $689
+ADDRGP4 s_playersettings+2300
+CNSTI4 11
+ASGNI4
+ADDRGP4 s_playersettings+2300+76
+CNSTI4 867
+ASGNI4
+ADDRGP4 s_playersettings+2300+80
+CNSTI4 253
+ASGNI4
+ADDRLP4 36
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_playersettings+2300+88
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 s_playersettings+2300+84
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 s_playersettings+2300+92
+CNSTI4 866
+ASGNI4
+ADDRGP4 s_playersettings+2300+96
+CNSTI4 253
+ASGNI4
+ADDRLP4 40
+CNSTI4 138
+ASGNI4
+ADDRGP4 s_playersettings+2300+104
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 s_playersettings+2300+100
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 s_playersettings+2300+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $732
+ARGP4
+ADDRLP4 44
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_playersettings+2300+68
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 s_playersettings+2300+52
+ADDRGP4 PlayerSettings_MenuEvent
+ASGNP4
+ADDRGP4 s_playersettings+2300+12
+CNSTI4 24
+ASGNI4
+ADDRGP4 s_playersettings+2300+108
+CNSTI4 11
+ASGNI4
+ADDRGP4 s_playersettings+2300+108+76
+CNSTI4 867
+ASGNI4
+ADDRGP4 s_playersettings+2300+108+80
+CNSTI4 396
+ASGNI4
+ADDRLP4 48
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_playersettings+2300+108+88
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 s_playersettings+2300+108+84
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 s_playersettings+2300+108+92
+CNSTI4 866
+ASGNI4
+ADDRGP4 s_playersettings+2300+108+96
+CNSTI4 395
+ASGNI4
+ADDRLP4 52
+CNSTI4 138
+ASGNI4
+ADDRGP4 s_playersettings+2300+108+104
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRGP4 s_playersettings+2300+108+100
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRGP4 s_playersettings+2300+108+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $732
+ARGP4
+ADDRLP4 56
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_playersettings+2300+108+68
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 s_playersettings+2300+108+52
+ADDRGP4 PlayerSettings_MenuEvent
+ASGNP4
+ADDRGP4 s_playersettings+2300+108+12
+CNSTI4 25
+ASGNI4
+ADDRGP4 s_playersettings+2300+216
+CNSTI4 11
+ASGNI4
+ADDRGP4 s_playersettings+2300+216+76
+CNSTI4 867
+ASGNI4
+ADDRGP4 s_playersettings+2300+216+80
+CNSTI4 540
+ASGNI4
+ADDRLP4 60
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_playersettings+2300+216+88
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 s_playersettings+2300+216+84
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 s_playersettings+2300+216+92
+CNSTI4 866
+ASGNI4
+ADDRGP4 s_playersettings+2300+216+96
+CNSTI4 539
+ASGNI4
+ADDRLP4 64
+CNSTI4 138
+ASGNI4
+ADDRGP4 s_playersettings+2300+216+104
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRGP4 s_playersettings+2300+216+100
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRGP4 s_playersettings+2300+216+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $732
+ARGP4
+ADDRLP4 68
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_playersettings+2300+216+68
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRGP4 s_playersettings+2300+216+52
+ADDRGP4 PlayerSettings_MenuEvent
+ASGNP4
+ADDRGP4 s_playersettings+2300+216+12
+CNSTI4 26
+ASGNI4
+ADDRGP4 s_playersettings
+ARGP4
+ADDRGP4 s_playersettings+2300
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_playersettings
+ARGP4
+ADDRGP4 s_playersettings+2300+108
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_playersettings
+ARGP4
+ADDRGP4 s_playersettings+2300+216
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 $187
+ARGP4
+ADDRLP4 76
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 76
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $818
+ADDRLP4 76
+ARGP4
+ADDRGP4 $820
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $818
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRGP4 $824
+JUMPV
+LABELV $821
+ADDRLP4 72
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 uis+11504
+ADDP4
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 108
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+NEI4 $826
+ADDRGP4 s_playersettings+2960
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRGP4 $823
+JUMPV
+LABELV $826
+LABELV $822
+ADDRLP4 72
+ADDRLP4 72
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $824
+ADDRLP4 72
+INDIRI4
+ADDRGP4 uis+13808
+INDIRI4
+LTI4 $821
+LABELV $823
+ADDRGP4 s_playersettings+2732
+CNSTI4 11
+ASGNI4
+ADDRGP4 s_playersettings+2732+76
+CNSTI4 76
+ASGNI4
+ADDRGP4 s_playersettings+2732+80
+CNSTI4 570
+ASGNI4
+ADDRGP4 s_playersettings+2732+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_playersettings+2732+88
+CNSTI4 20
+ASGNI4
+ADDRGP4 $841
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_playersettings+2732+64
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRGP4 $844
+ARGP4
+ADDRLP4 76
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_playersettings+2732+72
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRGP4 s_playersettings+2732+52
+ADDRGP4 PlayerSettings_MenuEvent
+ASGNP4
+ADDRGP4 s_playersettings+2732+12
+CNSTI4 30
+ASGNI4
+ADDRGP4 s_playersettings+2624
+CNSTI4 11
+ASGNI4
+ADDRGP4 s_playersettings+2624+76
+CNSTI4 130
+ASGNI4
+ADDRGP4 s_playersettings+2624+80
+CNSTI4 570
+ASGNI4
+ADDRGP4 s_playersettings+2624+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_playersettings+2624+88
+CNSTI4 20
+ASGNI4
+ADDRGP4 $860
+ARGP4
+ADDRLP4 80
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_playersettings+2624+64
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRGP4 $863
+ARGP4
+ADDRLP4 84
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_playersettings+2624+72
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRGP4 s_playersettings+2624+52
+ADDRGP4 PlayerSettings_MenuEvent
+ASGNP4
+ADDRGP4 s_playersettings+2624+12
+CNSTI4 29
+ASGNI4
+ADDRGP4 s_playersettings
+ARGP4
+ADDRGP4 s_playersettings+2732
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_playersettings
+ARGP4
+ADDRGP4 s_playersettings+2624
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_playersettings+1244
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_playersettings+1244+4
+ADDRGP4 $873
+ASGNP4
+ADDRGP4 s_playersettings+1244+48
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_playersettings+1244+16
+CNSTI4 8
+ASGNI4
+ADDRGP4 s_playersettings+1244+20
+CNSTI4 440
+ASGNI4
+ADDRGP4 s_playersettings+1244+12
+CNSTI4 13
+ASGNI4
+ADDRGP4 s_playersettings+1244+52
+ADDRGP4 PlayerSettings_MenuEvent
+ASGNP4
+ADDRGP4 s_playersettings+1244+80
+CNSTI4 80
+ASGNI4
+ADDRGP4 s_playersettings+1244+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_playersettings+1244+64
+ADDRGP4 $890
+ASGNP4
+ADDRGP4 s_playersettings+1244+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_playersettings+668
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_playersettings+668+48
+CNSTU4 32768
+ASGNU4
+ADDRGP4 s_playersettings+668+60
+ADDRGP4 PlayerSettings_DrawName
+ASGNP4
+ADDRGP4 s_playersettings+668+64+8
+CNSTI4 20
+ASGNI4
+ADDRGP4 s_playersettings+668+64+268
+CNSTI4 20
+ASGNI4
+ADDRGP4 s_playersettings+668+16
+CNSTI4 20
+ASGNI4
+ADDRGP4 s_playersettings+668+20
+CNSTI4 160
+ASGNI4
+ADDRGP4 s_playersettings+668+24
+CNSTI4 12
+ASGNI4
+ADDRGP4 s_playersettings+668+28
+CNSTI4 152
+ASGNI4
+ADDRGP4 s_playersettings+668+32
+CNSTI4 150
+ASGNI4
+ADDRGP4 s_playersettings+668+36
+CNSTI4 214
+ASGNI4
+ADDRGP4 s_playersettings+2840
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_playersettings+2840+48
+CNSTU4 4
+ASGNU4
+ADDRGP4 s_playersettings+2840+16
+CNSTI4 36
+ASGNI4
+ADDRGP4 s_playersettings+2840+20
+CNSTI4 379
+ASGNI4
+ADDRGP4 s_playersettings+2840+80
+CNSTI4 82
+ASGNI4
+ADDRGP4 s_playersettings+2840+84
+CNSTI4 18
+ASGNI4
+ADDRGP4 s_playersettings+2840+12
+CNSTI4 28
+ASGNI4
+ADDRGP4 s_playersettings+2840+52
+ADDRGP4 PlayerSettings_MenuEvent
+ASGNP4
+ADDRGP4 s_playersettings
+ARGP4
+ADDRGP4 s_playersettings+2840
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_playersettings
+ARGP4
+ADDRGP4 s_playersettings+668
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_playersettings
+ARGP4
+ADDRGP4 s_playersettings+1244
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 PlayerSettings_SetMenuItems
+CALLV
+pop
+LABELV $538
+endproc PlayerSettings_MenuInit 112 12
+export PlayerSettings_Cache
+proc PlayerSettings_Cache 32 4
+ADDRGP4 $935
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $936
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $937
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $938
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $939
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $940
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $942
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_playersettings+3068
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $944
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_playersettings+3072
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $947
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_playersettings+3072+4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $950
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_playersettings+3072+8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $953
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_playersettings+3072+12
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $956
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_playersettings+3072+16
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $959
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_playersettings+3072+20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $962
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_playersettings+3072+24
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $873
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $890
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 PlayerSettings_BuildList
+CALLV
+pop
+LABELV $934
+endproc PlayerSettings_Cache 32 4
+export UI_PlayerSettingsMenu
+proc UI_PlayerSettingsMenu 0 4
+ADDRGP4 PlayerSettings_MenuInit
+CALLV
+pop
+ADDRGP4 s_playersettings
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $963
+endproc UI_PlayerSettingsMenu 0 4
+bss
+align 4
+LABELV ps_playericons
+skip 44676
+align 4
+LABELV s_playersettings
+skip 4420
+import UI_HelpMenu_Cache
+import UI_HelpMenu_f
+import UI_HelpMenu
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import UI_InitGameinfo
+import UI_GetNumBots
+import UI_GetBotInfoByNumber
+import UI_GetNumArenas
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_VoiceIngame
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_GetVoiceGainClient
+import trap_GetVoiceMuteAll
+import trap_GetVoiceMuteClient
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_CIN_SetExtents
+import trap_CIN_StopCinematic
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_PlayCinematic
+import trap_RealTime
+import trap_S_StartBackgroundTrack
+import trap_S_StopBackgroundTrack
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_SaveCachedServers
+import trap_LAN_LoadCachedServers
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import BotListCompare
+import uis
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString2
+import UI_AutoWrappedString_LineCount
+import UI_DrawString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawIngameBG
+import UI_DrawStringNS
+import UI_ModelIcon
+import UI_DrawHandlePic1024
+import UI_AdjustFrom1024
+import UI_StopMusic
+import UI_StartCreditMusic
+import UI_StartMusic
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_ClearModelCache
+import UI_PrecacheClientModelname
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import UI_SpecifyPasswordMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import Demos_Cache
+import UI_DemosMenu
+import SetDefaultBinds_onUnusedKeys
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import SetupDefaultMenu_Cache
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import Music_NextTrack
+import Music_TriggerRestart
+import Music_Check
+import MusicMenu_Cache
+import MusicMenu_Open
+import MusicMenu_Shutdown
+import MusicMenu_Init
+import UI_CallVoteMenu
+import UI_InGameMenu
+import InGame_Cache
+import UI_SecretMenu
+import UI_InitBigCredits
+import UI_BigCredits_Cache
+import UI_CreditMenu
+import ExitMenu_Cache
+import ExitMenu_Init
+import UI_MainMenu
+import MainMenu_Cache
+import UI_UpdateCvars
+import UI_RegisterCvars
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import listbar_bluecolor
+import text_color_bluehighlight
+import text_color_bluenormal
+import text_color_ighighlight
+import text_color_ignormal
+import listbar_igcolor
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_lightOrange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_click_sound
+import menu_switch_sound
+import menu_move_sound
+import ScrollList_Key
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import wop_AutoBindUnusedKeys
+import wop_AutoswitchSongByNextMap
+import con_notifytime
+import s_wop_restarted
+import syc_logo
+import spraycolor
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_createGametype
+import ui_browserHidePrivate
+import ui_browserOnlyHumans
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $962
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $959
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 99
+byte 1 121
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $956
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $953
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $950
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 110
+byte 1 0
+align 1
+LABELV $947
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 121
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $944
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $942
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $940
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $939
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $938
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $937
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $936
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 49
+byte 1 95
+byte 1 114
+byte 1 0
+align 1
+LABELV $935
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 50
+byte 1 95
+byte 1 108
+byte 1 0
+align 1
+LABELV $890
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 66
+byte 1 116
+byte 1 110
+byte 1 66
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 49
+byte 1 0
+align 1
+LABELV $873
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 66
+byte 1 116
+byte 1 110
+byte 1 66
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 48
+byte 1 0
+align 1
+LABELV $863
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $860
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $844
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $841
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $820
+byte 1 48
+byte 1 49
+byte 1 95
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $732
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $683
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 95
+byte 1 109
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $680
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $655
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 117
+byte 1 112
+byte 1 95
+byte 1 109
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $652
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $627
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $624
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $599
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $596
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $522
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $504
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $502
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $500
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $498
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $428
+byte 1 115
+byte 1 121
+byte 1 99
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $349
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $347
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $344
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 0
+align 1
+LABELV $335
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 59
+byte 1 112
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $334
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $333
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 66
+byte 1 0
+align 1
+LABELV $330
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $324
+byte 1 46
+byte 1 46
+byte 1 0
+align 1
+LABELV $323
+byte 1 46
+byte 1 0
+align 1
+LABELV $313
+byte 1 47
+byte 1 0
+align 1
+LABELV $312
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $310
+byte 1 69
+byte 1 82
+byte 1 82
+byte 1 79
+byte 1 82
+byte 1 58
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 0
+align 1
+LABELV $285
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $282
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $279
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $273
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $187
+byte 1 115
+byte 1 121
+byte 1 99
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 0
+align 1
+LABELV $184
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $180
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $164
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $112
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
@@ -0,0 +1,5558 @@
+data
+align 4
+LABELV page1_options
+address s_preferences+296
+address s_preferences+1028
+address s_preferences+1096
+address s_preferences+1216
+address s_preferences+1404
+address s_preferences+1336
+address s_preferences+1608
+address s_preferences+1540
+address s_preferences+1472
+address s_preferences+892
+address s_preferences+960
+address s_preferences+1924
+address s_preferences+688
+byte 4 0
+align 4
+LABELV page2_options
+address s_preferences+416
+address s_preferences+552
+address s_preferences+620
+address s_preferences+756
+address s_preferences+484
+address s_preferences+824
+address s_preferences+2044
+address s_preferences+2112
+address s_preferences+2180
+address s_preferences+2248
+address s_preferences+2316
+address s_preferences+2384
+byte 4 0
+align 4
+LABELV ffahud_names
+address $103
+address $104
+address $105
+address $106
+address $107
+address $108
+address $109
+address $110
+address $111
+address $112
+byte 4 0
+align 4
+LABELV con_notifytime_strs
+address $113
+address $114
+address $115
+address $116
+byte 4 0
+align 4
+LABELV glowcolor_names
+address $117
+address $118
+address $119
+address $120
+address $121
+address $122
+address $123
+address $124
+byte 4 0
+code
+proc UpdateGlowColorFlags 4 0
+ADDRGP4 s_preferences+1924+48
+INDIRU4
+CNSTU4 4096
+BANDU4
+CNSTU4 0
+EQU4 $126
+ADDRGP4 $125
+JUMPV
+LABELV $126
+ADDRGP4 s_preferences+960+64
+INDIRI4
+CNSTI4 0
+NEI4 $130
+ADDRLP4 0
+ADDRGP4 s_preferences+1924+48
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRGP4 $131
+JUMPV
+LABELV $130
+ADDRLP4 0
+ADDRGP4 s_preferences+1924+48
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+LABELV $131
+LABELV $125
+endproc UpdateGlowColorFlags 4 0
+proc Preferences_SetMenuItems 172 12
+ADDRGP4 $139
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $140
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LEI4 $141
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+GTI4 $141
+ADDRGP4 s_preferences+1216+68
+CNSTI4 0
+ASGNI4
+ADDRGP4 $142
+JUMPV
+LABELV $141
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LEI4 $145
+ADDRGP4 s_preferences+1216+68
+CNSTI4 1
+ASGNI4
+ADDRGP4 $146
+JUMPV
+LABELV $145
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $149
+ADDRLP4 4
+INDIRI4
+CNSTI4 -5
+LTI4 $149
+ADDRGP4 s_preferences+1216+68
+CNSTI4 2
+ASGNI4
+ADDRGP4 $150
+JUMPV
+LABELV $149
+ADDRLP4 4
+INDIRI4
+CNSTI4 -5
+GEI4 $153
+ADDRGP4 s_preferences+1216+68
+CNSTI4 3
+ASGNI4
+LABELV $153
+LABELV $150
+LABELV $146
+LABELV $142
+ADDRGP4 $159
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1091567616
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_preferences+1096+68
+ADDRLP4 28
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $162
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_preferences+1336+64
+ADDRLP4 36
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $165
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_preferences+1404+64
+ADDRLP4 44
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $168
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_preferences+1472+64
+ADDRLP4 52
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $171
+ARGP4
+ADDRLP4 56
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_preferences+1540+64
+ADDRLP4 60
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $174
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_preferences+1608+64
+ADDRLP4 68
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 s_preferences+2044+64
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+ASGNI4
+ADDRGP4 s_preferences+2180+64
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+BANDI4
+ASGNI4
+ADDRGP4 s_preferences+2112+64
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+BANDI4
+ASGNI4
+ADDRGP4 s_preferences+2248+64
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+BANDI4
+ASGNI4
+ADDRGP4 s_preferences+2316+64
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+BANDI4
+ASGNI4
+ADDRGP4 $187
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 s_preferences+296+68
+ADDRLP4 72
+INDIRF4
+CVFI4 4
+CNSTI4 12
+MODI4
+ASGNI4
+ADDRGP4 $190
+ARGP4
+ADDRLP4 80
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 80
+INDIRF4
+CNSTF4 0
+EQF4 $192
+ADDRLP4 76
+CNSTI4 1
+ASGNI4
+ADDRGP4 $193
+JUMPV
+LABELV $192
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+LABELV $193
+ADDRGP4 s_preferences+416+64
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRGP4 $196
+ARGP4
+ADDRLP4 88
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 88
+INDIRF4
+CNSTF4 0
+EQF4 $198
+ADDRLP4 84
+CNSTI4 1
+ASGNI4
+ADDRGP4 $199
+JUMPV
+LABELV $198
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+LABELV $199
+ADDRGP4 s_preferences+484+64
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRGP4 $202
+ARGP4
+ADDRLP4 96
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 96
+INDIRF4
+CNSTF4 0
+EQF4 $204
+ADDRLP4 92
+CNSTI4 1
+ASGNI4
+ADDRGP4 $205
+JUMPV
+LABELV $204
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+LABELV $205
+ADDRGP4 s_preferences+552+64
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRGP4 $208
+ARGP4
+ADDRLP4 104
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 104
+INDIRF4
+CNSTF4 0
+EQF4 $210
+ADDRLP4 100
+CNSTI4 1
+ASGNI4
+ADDRGP4 $211
+JUMPV
+LABELV $210
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+LABELV $211
+ADDRGP4 s_preferences+688+64
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRGP4 $214
+ARGP4
+ADDRLP4 112
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 112
+INDIRF4
+CNSTF4 0
+EQF4 $216
+ADDRLP4 108
+CNSTI4 1
+ASGNI4
+ADDRGP4 $217
+JUMPV
+LABELV $216
+ADDRLP4 108
+CNSTI4 0
+ASGNI4
+LABELV $217
+ADDRGP4 s_preferences+620+64
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRGP4 $220
+ARGP4
+ADDRLP4 120
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 120
+INDIRF4
+CNSTF4 0
+NEF4 $222
+ADDRLP4 116
+CNSTI4 1
+ASGNI4
+ADDRGP4 $223
+JUMPV
+LABELV $222
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+LABELV $223
+ADDRGP4 s_preferences+756+64
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRGP4 $226
+ARGP4
+ADDRLP4 128
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 128
+INDIRF4
+CNSTF4 0
+EQF4 $228
+ADDRLP4 124
+CNSTI4 1
+ASGNI4
+ADDRGP4 $229
+JUMPV
+LABELV $228
+ADDRLP4 124
+CNSTI4 0
+ASGNI4
+LABELV $229
+ADDRGP4 s_preferences+824+64
+ADDRLP4 124
+INDIRI4
+ASGNI4
+ADDRGP4 $232
+ARGP4
+ADDRLP4 136
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 136
+INDIRF4
+CNSTF4 0
+EQF4 $234
+ADDRLP4 132
+CNSTI4 1
+ASGNI4
+ADDRGP4 $235
+JUMPV
+LABELV $234
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+LABELV $235
+ADDRGP4 s_preferences+892+64
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRGP4 $238
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 144
+INDIRF4
+CNSTF4 0
+EQF4 $240
+ADDRLP4 140
+CNSTI4 1
+ASGNI4
+ADDRGP4 $241
+JUMPV
+LABELV $240
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+LABELV $241
+ADDRGP4 s_preferences+1028+64
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRGP4 $244
+ARGP4
+ADDRLP4 152
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 152
+INDIRF4
+CNSTF4 0
+EQF4 $246
+ADDRLP4 148
+CNSTI4 1
+ASGNI4
+ADDRGP4 $247
+JUMPV
+LABELV $246
+ADDRLP4 148
+CNSTI4 0
+ASGNI4
+LABELV $247
+ADDRGP4 s_preferences+1676+64
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRGP4 $250
+ARGP4
+ADDRLP4 160
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 160
+INDIRF4
+CNSTF4 0
+EQF4 $252
+ADDRLP4 156
+CNSTI4 1
+ASGNI4
+ADDRGP4 $253
+JUMPV
+LABELV $252
+ADDRLP4 156
+CNSTI4 0
+ASGNI4
+LABELV $253
+ADDRGP4 s_preferences+2384+64
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRGP4 $256
+ARGP4
+ADDRLP4 164
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 s_preferences+1924+68
+ADDRLP4 164
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 s_preferences+1924+68
+INDIRI4
+CNSTI4 0
+EQI4 $262
+ADDRLP4 168
+CNSTI4 1
+ASGNI4
+ADDRGP4 $263
+JUMPV
+LABELV $262
+ADDRLP4 168
+CNSTI4 0
+ASGNI4
+LABELV $263
+ADDRGP4 s_preferences+960+64
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRGP4 UpdateGlowColorFlags
+CALLV
+pop
+LABELV $138
+endproc Preferences_SetMenuItems 172 12
+proc SwitchPage 32 0
+ADDRLP4 20
+ADDRGP4 page
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $266
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $267
+JUMPV
+LABELV $266
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $267
+ADDRLP4 20
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 page
+INDIRI4
+CNSTI4 0
+NEI4 $268
+ADDRLP4 12
+ADDRGP4 page1_options
+ASGNP4
+ADDRLP4 8
+ADDRGP4 page2_options
+ASGNP4
+ADDRGP4 $269
+JUMPV
+LABELV $268
+ADDRLP4 12
+ADDRGP4 page2_options
+ASGNP4
+ADDRLP4 8
+ADDRGP4 page1_options
+ASGNP4
+LABELV $269
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $273
+JUMPV
+LABELV $270
+ADDRLP4 24
+ADDRLP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+LABELV $271
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $273
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $270
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $277
+JUMPV
+LABELV $274
+ADDRLP4 28
+ADDRLP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $275
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $277
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $274
+ADDRGP4 UpdateGlowColorFlags
+CALLV
+pop
+LABELV $264
+endproc SwitchPage 32 0
+proc Preferences_Event 24 8
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $279
+ADDRGP4 $278
+JUMPV
+LABELV $279
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 127
+LTI4 $281
+ADDRLP4 0
+INDIRI4
+CNSTI4 154
+GTI4 $281
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $393-508
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $393
+address $284
+address $295
+address $298
+address $304
+address $307
+address $310
+address $313
+address $316
+address $319
+address $330
+address $281
+address $333
+address $334
+address $374
+address $337
+address $340
+address $343
+address $346
+address $350
+address $392
+address $322
+address $322
+address $353
+address $353
+address $353
+address $353
+address $353
+address $388
+code
+LABELV $284
+ADDRLP4 8
+ADDRGP4 s_preferences+296+68
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 s_preferences+296+68
+INDIRI4
+CNSTI4 12
+NEI4 $287
+ADDRGP4 s_preferences+296+68
+CNSTI4 0
+ASGNI4
+LABELV $287
+ADDRGP4 $187
+ARGP4
+ADDRGP4 s_preferences+296+68
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $282
+JUMPV
+LABELV $295
+ADDRGP4 $190
+ARGP4
+ADDRGP4 s_preferences+416+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $282
+JUMPV
+LABELV $298
+ADDRGP4 $220
+ARGP4
+ADDRGP4 s_preferences+756+64
+INDIRI4
+CNSTI4 0
+NEI4 $302
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $303
+JUMPV
+LABELV $302
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $303
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $282
+JUMPV
+LABELV $304
+ADDRGP4 $196
+ARGP4
+ADDRGP4 s_preferences+484+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $282
+JUMPV
+LABELV $307
+ADDRGP4 $202
+ARGP4
+ADDRGP4 s_preferences+552+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $282
+JUMPV
+LABELV $310
+ADDRGP4 $214
+ARGP4
+ADDRGP4 s_preferences+620+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $282
+JUMPV
+LABELV $313
+ADDRGP4 $208
+ARGP4
+ADDRGP4 s_preferences+688+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $282
+JUMPV
+LABELV $316
+ADDRGP4 $226
+ARGP4
+ADDRGP4 s_preferences+824+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $282
+JUMPV
+LABELV $319
+ADDRGP4 $232
+ARGP4
+ADDRGP4 s_preferences+892+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $282
+JUMPV
+LABELV $322
+ADDRGP4 s_preferences+960+64
+INDIRI4
+CNSTI4 0
+NEI4 $323
+ADDRGP4 $256
+ARGP4
+ADDRGP4 $327
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $324
+JUMPV
+LABELV $323
+ADDRGP4 $256
+ARGP4
+ADDRGP4 s_preferences+1924+68
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $324
+ADDRGP4 UpdateGlowColorFlags
+CALLV
+pop
+ADDRGP4 $282
+JUMPV
+LABELV $330
+ADDRGP4 $238
+ARGP4
+ADDRGP4 s_preferences+1028+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $282
+JUMPV
+LABELV $333
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $282
+JUMPV
+LABELV $334
+ADDRGP4 $159
+ARGP4
+ADDRGP4 s_preferences+1096+68
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $282
+JUMPV
+LABELV $337
+ADDRGP4 $162
+ARGP4
+ADDRGP4 s_preferences+1336+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $282
+JUMPV
+LABELV $340
+ADDRGP4 $165
+ARGP4
+ADDRGP4 s_preferences+1404+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $282
+JUMPV
+LABELV $343
+ADDRGP4 $168
+ARGP4
+ADDRGP4 s_preferences+1472+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $282
+JUMPV
+LABELV $346
+ADDRGP4 $347
+ARGP4
+ADDRGP4 s_preferences+1540+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $282
+JUMPV
+LABELV $350
+ADDRGP4 $174
+ARGP4
+ADDRGP4 s_preferences+1608+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $282
+JUMPV
+LABELV $353
+ADDRGP4 $139
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+CNSTI4 -32
+BANDI4
+ASGNI4
+ADDRGP4 s_preferences+2044+64
+INDIRI4
+CNSTI4 0
+EQI4 $354
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $354
+ADDRGP4 s_preferences+2180+64
+INDIRI4
+CNSTI4 0
+EQI4 $358
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $358
+ADDRGP4 s_preferences+2112+64
+INDIRI4
+CNSTI4 0
+EQI4 $362
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $362
+ADDRGP4 s_preferences+2248+64
+INDIRI4
+CNSTI4 0
+EQI4 $366
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $366
+ADDRGP4 s_preferences+2316+64
+INDIRI4
+CNSTI4 0
+EQI4 $370
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+LABELV $370
+ADDRGP4 $139
+ARGP4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $282
+JUMPV
+LABELV $374
+ADDRLP4 16
+ADDRGP4 s_preferences+1216+68
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $282
+ADDRLP4 16
+INDIRI4
+CNSTI4 3
+GTI4 $282
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $387
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $387
+address $379
+address $381
+address $383
+address $385
+code
+LABELV $379
+ADDRGP4 $140
+ARGP4
+ADDRGP4 $380
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $282
+JUMPV
+LABELV $381
+ADDRGP4 $140
+ARGP4
+ADDRGP4 $382
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $282
+JUMPV
+LABELV $383
+ADDRGP4 $140
+ARGP4
+ADDRGP4 $384
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $282
+JUMPV
+LABELV $385
+ADDRGP4 $140
+ARGP4
+ADDRGP4 $386
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $282
+JUMPV
+LABELV $388
+ADDRGP4 $389
+ARGP4
+ADDRGP4 s_preferences+2384+64
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $250
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $282
+JUMPV
+LABELV $392
+ADDRGP4 SwitchPage
+CALLV
+pop
+LABELV $281
+LABELV $282
+LABELV $278
+endproc Preferences_Event 24 8
+proc Crosshair_Draw 52 20
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 32
+CNSTI4 16
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+NEI4 $397
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $398
+JUMPV
+LABELV $397
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+LABELV $398
+ADDRLP4 16
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 8192
+BANDU4
+CNSTU4 0
+EQU4 $399
+ADDRLP4 12
+ADDRGP4 text_color_disabled
+ASGNP4
+ADDRGP4 $400
+JUMPV
+LABELV $399
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $401
+ADDRLP4 12
+ADDRGP4 text_color_highlight
+ASGNP4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+ADDRGP4 $402
+JUMPV
+LABELV $401
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 1
+BANDU4
+CNSTU4 0
+EQU4 $403
+ADDRLP4 12
+ADDRGP4 text_color_highlight
+ASGNP4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+ADDRGP4 $404
+JUMPV
+LABELV $403
+ADDRLP4 12
+ADDRGP4 text_color_normal
+ASGNP4
+LABELV $404
+LABELV $402
+LABELV $400
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $405
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 48
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+SUBI4
+ADDRLP4 48
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+SUBI4
+ADDRLP4 48
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 listbar_color
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 13
+ARGI4
+CNSTI4 4113
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawChar
+CALLV
+pop
+LABELV $405
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+SUBI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+BORI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $407
+ADDRGP4 $395
+JUMPV
+LABELV $407
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 36
+CNSTF4 1103101952
+ASGNF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_preferences+2452
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $395
+endproc Crosshair_Draw 52 20
+proc Preferences_MenuInit 20 12
+ADDRGP4 s_preferences
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 2500
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 Preferences_Cache
+CALLV
+pop
+ADDRGP4 s_preferences+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_preferences+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_preferences+284
+CNSTI4 36864
+ASGNI4
+ADDRLP4 0
+CNSTI4 156
+ASGNI4
+ADDRGP4 s_preferences+296
+CNSTI4 7
+ASGNI4
+ADDRGP4 s_preferences+296+48
+CNSTU4 98306
+ASGNU4
+ADDRGP4 s_preferences+296+16
+CNSTI4 534
+ASGNI4
+ADDRGP4 s_preferences+296+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_preferences+296+4
+ADDRGP4 $423
+ASGNP4
+ADDRGP4 s_preferences+296+52
+ADDRGP4 Preferences_Event
+ASGNP4
+ADDRGP4 s_preferences+296+60
+ADDRGP4 Crosshair_Draw
+ASGNP4
+ADDRGP4 s_preferences+296+12
+CNSTI4 127
+ASGNI4
+ADDRGP4 s_preferences+296+28
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+SUBI4
+ASGNI4
+ADDRGP4 s_preferences+296+36
+ADDRLP4 0
+INDIRI4
+CNSTI4 20
+ADDI4
+ASGNI4
+ADDRGP4 s_preferences+296+4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRGP4 s_preferences+296+24
+CNSTU4 534
+ADDRLP4 12
+INDIRU4
+CNSTU4 1
+ADDU4
+CNSTI4 3
+LSHU4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRGP4 s_preferences+296+32
+CNSTI4 582
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_preferences+1028
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_preferences+1028+4
+ADDRGP4 $443
+ASGNP4
+ADDRGP4 s_preferences+1028+48
+CNSTU4 4098
+ASGNU4
+ADDRGP4 s_preferences+1028+52
+ADDRGP4 Preferences_Event
+ASGNP4
+ADDRGP4 s_preferences+1028+12
+CNSTI4 136
+ASGNI4
+ADDRGP4 s_preferences+1028+16
+CNSTI4 534
+ASGNI4
+ADDRGP4 s_preferences+1028+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_preferences+1028+8
+ADDRGP4 $456
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_preferences+1096
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_preferences+1096+4
+ADDRGP4 $460
+ASGNP4
+ADDRGP4 s_preferences+1096+48
+CNSTU4 4098
+ASGNU4
+ADDRGP4 s_preferences+1096+52
+ADDRGP4 Preferences_Event
+ASGNP4
+ADDRGP4 s_preferences+1096+12
+CNSTI4 139
+ASGNI4
+ADDRGP4 s_preferences+1096+16
+CNSTI4 534
+ASGNI4
+ADDRGP4 s_preferences+1096+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_preferences+1096+80
+ADDRGP4 ffahud_names
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_preferences+1216
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_preferences+1216+4
+ADDRGP4 $476
+ASGNP4
+ADDRGP4 s_preferences+1216+48
+CNSTU4 4098
+ASGNU4
+ADDRGP4 s_preferences+1216+52
+ADDRGP4 Preferences_Event
+ASGNP4
+ADDRGP4 s_preferences+1216+12
+CNSTI4 140
+ASGNI4
+ADDRGP4 s_preferences+1216+16
+CNSTI4 534
+ASGNI4
+ADDRGP4 s_preferences+1216+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_preferences+1216+80
+ADDRGP4 con_notifytime_strs
+ASGNP4
+ADDRGP4 s_preferences+1216+8
+ADDRGP4 $491
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_preferences+1404
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_preferences+1404+4
+ADDRGP4 $495
+ASGNP4
+ADDRGP4 s_preferences+1404+48
+CNSTU4 4098
+ASGNU4
+ADDRGP4 s_preferences+1404+52
+ADDRGP4 Preferences_Event
+ASGNP4
+ADDRGP4 s_preferences+1404+12
+CNSTI4 142
+ASGNI4
+ADDRGP4 s_preferences+1404+16
+CNSTI4 534
+ASGNI4
+ADDRGP4 s_preferences+1404+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_preferences+1336
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_preferences+1336+4
+ADDRGP4 $509
+ASGNP4
+ADDRGP4 s_preferences+1336+48
+CNSTU4 4098
+ASGNU4
+ADDRGP4 s_preferences+1336+52
+ADDRGP4 Preferences_Event
+ASGNP4
+ADDRGP4 s_preferences+1336+12
+CNSTI4 141
+ASGNI4
+ADDRGP4 s_preferences+1336+16
+CNSTI4 534
+ASGNI4
+ADDRGP4 s_preferences+1336+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_preferences+1608
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_preferences+1608+4
+ADDRGP4 $523
+ASGNP4
+ADDRGP4 s_preferences+1608+48
+CNSTU4 4098
+ASGNU4
+ADDRGP4 s_preferences+1608+52
+ADDRGP4 Preferences_Event
+ASGNP4
+ADDRGP4 s_preferences+1608+12
+CNSTI4 145
+ASGNI4
+ADDRGP4 s_preferences+1608+16
+CNSTI4 534
+ASGNI4
+ADDRGP4 s_preferences+1608+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_preferences+1540
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_preferences+1540+4
+ADDRGP4 $537
+ASGNP4
+ADDRGP4 s_preferences+1540+48
+CNSTU4 4098
+ASGNU4
+ADDRGP4 s_preferences+1540+52
+ADDRGP4 Preferences_Event
+ASGNP4
+ADDRGP4 s_preferences+1540+12
+CNSTI4 144
+ASGNI4
+ADDRGP4 s_preferences+1540+16
+CNSTI4 534
+ASGNI4
+ADDRGP4 s_preferences+1540+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_preferences+1472
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_preferences+1472+4
+ADDRGP4 $551
+ASGNP4
+ADDRGP4 s_preferences+1472+48
+CNSTU4 4098
+ASGNU4
+ADDRGP4 s_preferences+1472+52
+ADDRGP4 Preferences_Event
+ASGNP4
+ADDRGP4 s_preferences+1472+12
+CNSTI4 143
+ASGNI4
+ADDRGP4 s_preferences+1472+16
+CNSTI4 534
+ASGNI4
+ADDRGP4 s_preferences+1472+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_preferences+892
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_preferences+892+4
+ADDRGP4 $565
+ASGNP4
+ADDRGP4 s_preferences+892+48
+CNSTU4 4098
+ASGNU4
+ADDRGP4 s_preferences+892+52
+ADDRGP4 Preferences_Event
+ASGNP4
+ADDRGP4 s_preferences+892+12
+CNSTI4 135
+ASGNI4
+ADDRGP4 s_preferences+892+16
+CNSTI4 534
+ASGNI4
+ADDRGP4 s_preferences+892+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_preferences+892+8
+ADDRGP4 $578
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_preferences+960
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_preferences+960+4
+ADDRGP4 $582
+ASGNP4
+ADDRGP4 s_preferences+960+48
+CNSTU4 4098
+ASGNU4
+ADDRGP4 s_preferences+960+52
+ADDRGP4 Preferences_Event
+ASGNP4
+ADDRGP4 s_preferences+960+12
+CNSTI4 147
+ASGNI4
+ADDRGP4 s_preferences+960+16
+CNSTI4 534
+ASGNI4
+ADDRGP4 s_preferences+960+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_preferences+960+8
+ADDRGP4 $595
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_preferences+1924
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_preferences+1924+4
+ADDRGP4 $599
+ASGNP4
+ADDRGP4 s_preferences+1924+48
+CNSTU4 4098
+ASGNU4
+ADDRGP4 s_preferences+1924+52
+ADDRGP4 Preferences_Event
+ASGNP4
+ADDRGP4 s_preferences+1924+12
+CNSTI4 148
+ASGNI4
+ADDRGP4 s_preferences+1924+16
+CNSTI4 534
+ASGNI4
+ADDRGP4 s_preferences+1924+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_preferences+1924+80
+ADDRGP4 glowcolor_names
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_preferences+688
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_preferences+688+4
+ADDRGP4 $615
+ASGNP4
+ADDRGP4 s_preferences+688+48
+CNSTU4 4098
+ASGNU4
+ADDRGP4 s_preferences+688+52
+ADDRGP4 Preferences_Event
+ASGNP4
+ADDRGP4 s_preferences+688+12
+CNSTI4 133
+ASGNI4
+ADDRGP4 s_preferences+688+16
+CNSTI4 534
+ASGNI4
+ADDRGP4 s_preferences+688+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_preferences+688+8
+ADDRGP4 $628
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+ADDI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 156
+ASGNI4
+ADDRGP4 s_preferences+416
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_preferences+416+4
+ADDRGP4 $632
+ASGNP4
+ADDRGP4 s_preferences+416+48
+CNSTU4 4098
+ASGNU4
+ADDRGP4 s_preferences+416+52
+ADDRGP4 Preferences_Event
+ASGNP4
+ADDRGP4 s_preferences+416+12
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_preferences+416+16
+CNSTI4 534
+ASGNI4
+ADDRGP4 s_preferences+416+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_preferences+416+8
+ADDRGP4 $645
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_preferences+552
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_preferences+552+4
+ADDRGP4 $649
+ASGNP4
+ADDRGP4 s_preferences+552+48
+CNSTU4 4098
+ASGNU4
+ADDRGP4 s_preferences+552+52
+ADDRGP4 Preferences_Event
+ASGNP4
+ADDRGP4 s_preferences+552+12
+CNSTI4 131
+ASGNI4
+ADDRGP4 s_preferences+552+16
+CNSTI4 534
+ASGNI4
+ADDRGP4 s_preferences+552+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_preferences+552+8
+ADDRGP4 $662
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_preferences+620
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_preferences+620+4
+ADDRGP4 $666
+ASGNP4
+ADDRGP4 s_preferences+620+48
+CNSTU4 4098
+ASGNU4
+ADDRGP4 s_preferences+620+52
+ADDRGP4 Preferences_Event
+ASGNP4
+ADDRGP4 s_preferences+620+12
+CNSTI4 132
+ASGNI4
+ADDRGP4 s_preferences+620+16
+CNSTI4 534
+ASGNI4
+ADDRGP4 s_preferences+620+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_preferences+756
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_preferences+756+4
+ADDRGP4 $680
+ASGNP4
+ADDRGP4 s_preferences+756+48
+CNSTU4 4098
+ASGNU4
+ADDRGP4 s_preferences+756+52
+ADDRGP4 Preferences_Event
+ASGNP4
+ADDRGP4 s_preferences+756+12
+CNSTI4 129
+ASGNI4
+ADDRGP4 s_preferences+756+16
+CNSTI4 534
+ASGNI4
+ADDRGP4 s_preferences+756+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_preferences+484
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_preferences+484+4
+ADDRGP4 $694
+ASGNP4
+ADDRGP4 s_preferences+484+48
+CNSTU4 4098
+ASGNU4
+ADDRGP4 s_preferences+484+52
+ADDRGP4 Preferences_Event
+ASGNP4
+ADDRGP4 s_preferences+484+12
+CNSTI4 130
+ASGNI4
+ADDRGP4 s_preferences+484+16
+CNSTI4 534
+ASGNI4
+ADDRGP4 s_preferences+484+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_preferences+824
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_preferences+824+4
+ADDRGP4 $708
+ASGNP4
+ADDRGP4 s_preferences+824+48
+CNSTU4 4098
+ASGNU4
+ADDRGP4 s_preferences+824+52
+ADDRGP4 Preferences_Event
+ASGNP4
+ADDRGP4 s_preferences+824+12
+CNSTI4 134
+ASGNI4
+ADDRGP4 s_preferences+824+16
+CNSTI4 534
+ASGNI4
+ADDRGP4 s_preferences+824+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_preferences+824+8
+ADDRGP4 $721
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_preferences+2384
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_preferences+2384+4
+ADDRGP4 $725
+ASGNP4
+ADDRGP4 s_preferences+2384+48
+CNSTU4 4098
+ASGNU4
+ADDRGP4 s_preferences+2384+52
+ADDRGP4 Preferences_Event
+ASGNP4
+ADDRGP4 s_preferences+2384+12
+CNSTI4 154
+ASGNI4
+ADDRGP4 s_preferences+2384+16
+CNSTI4 534
+ASGNI4
+ADDRGP4 s_preferences+2384+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_preferences+2112
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_preferences+2112+4
+ADDRGP4 $739
+ASGNP4
+ADDRGP4 s_preferences+2112+48
+CNSTU4 4098
+ASGNU4
+ADDRGP4 s_preferences+2112+52
+ADDRGP4 Preferences_Event
+ASGNP4
+ADDRGP4 s_preferences+2112+12
+CNSTI4 150
+ASGNI4
+ADDRGP4 s_preferences+2112+16
+CNSTI4 534
+ASGNI4
+ADDRGP4 s_preferences+2112+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_preferences+2112+8
+ADDRGP4 $752
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_preferences+2248
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_preferences+2248+4
+ADDRGP4 $756
+ASGNP4
+ADDRGP4 s_preferences+2248+48
+CNSTU4 4098
+ASGNU4
+ADDRGP4 s_preferences+2248+52
+ADDRGP4 Preferences_Event
+ASGNP4
+ADDRGP4 s_preferences+2248+12
+CNSTI4 152
+ASGNI4
+ADDRGP4 s_preferences+2248+16
+CNSTI4 534
+ASGNI4
+ADDRGP4 s_preferences+2248+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_preferences+2248+8
+ADDRGP4 $769
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_preferences+2316
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_preferences+2316+4
+ADDRGP4 $773
+ASGNP4
+ADDRGP4 s_preferences+2316+48
+CNSTU4 4098
+ASGNU4
+ADDRGP4 s_preferences+2316+52
+ADDRGP4 Preferences_Event
+ASGNP4
+ADDRGP4 s_preferences+2316+12
+CNSTI4 153
+ASGNI4
+ADDRGP4 s_preferences+2316+16
+CNSTI4 534
+ASGNI4
+ADDRGP4 s_preferences+2316+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_preferences+2316+8
+ADDRGP4 $786
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_preferences+2180
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_preferences+2180+4
+ADDRGP4 $790
+ASGNP4
+ADDRGP4 s_preferences+2180+48
+CNSTU4 4098
+ASGNU4
+ADDRGP4 s_preferences+2180+52
+ADDRGP4 Preferences_Event
+ASGNP4
+ADDRGP4 s_preferences+2180+12
+CNSTI4 151
+ASGNI4
+ADDRGP4 s_preferences+2180+16
+CNSTI4 534
+ASGNI4
+ADDRGP4 s_preferences+2180+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_preferences+2180+8
+ADDRGP4 $803
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_preferences+2044
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_preferences+2044+4
+ADDRGP4 $807
+ASGNP4
+ADDRGP4 s_preferences+2044+48
+CNSTU4 4098
+ASGNU4
+ADDRGP4 s_preferences+2044+52
+ADDRGP4 Preferences_Event
+ASGNP4
+ADDRGP4 s_preferences+2044+12
+CNSTI4 149
+ASGNI4
+ADDRGP4 s_preferences+2044+16
+CNSTI4 534
+ASGNI4
+ADDRGP4 s_preferences+2044+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_preferences+2044+8
+ADDRGP4 $820
+ASGNP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+ADDI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LEI4 $822
+ADDRLP4 16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $823
+JUMPV
+LABELV $822
+ADDRLP4 16
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $823
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 s_preferences+1744
+CNSTI4 12
+ASGNI4
+ADDRGP4 s_preferences+1744+76
+CNSTF4 1101004800
+ASGNF4
+ADDRGP4 s_preferences+1744+48
+CNSTU4 8
+ASGNU4
+ADDRGP4 s_preferences+1744+16
+CNSTI4 534
+ASGNI4
+ADDRGP4 s_preferences+1744+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_preferences+1744+12
+CNSTI4 146
+ASGNI4
+ADDRGP4 s_preferences+1744+52
+ADDRGP4 Preferences_Event
+ASGNP4
+ADDRGP4 s_preferences+1744+64
+ADDRGP4 $839
+ASGNP4
+ADDRGP4 s_preferences+1744+72
+ADDRGP4 color_lightOrange
+ASGNP4
+ADDRGP4 s_preferences+1744+80
+ADDRGP4 color_orange
+ASGNP4
+ADDRGP4 s_preferences+1744+68
+CNSTI4 17
+ASGNI4
+ADDRGP4 s_preferences+1828
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_preferences+1828+4
+ADDRGP4 $849
+ASGNP4
+ADDRGP4 s_preferences+1828+48
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_preferences+1828+16
+CNSTI4 552
+ASGNI4
+ADDRGP4 s_preferences+1828+20
+CNSTI4 440
+ASGNI4
+ADDRGP4 s_preferences+1828+12
+CNSTI4 138
+ASGNI4
+ADDRGP4 s_preferences+1828+52
+ADDRGP4 Preferences_Event
+ASGNP4
+ADDRGP4 s_preferences+1828+80
+CNSTI4 80
+ASGNI4
+ADDRGP4 s_preferences+1828+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_preferences+1828+64
+ADDRGP4 $866
+ASGNP4
+ADDRGP4 s_preferences+1828+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_preferences
+ARGP4
+ADDRGP4 s_preferences+296
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_preferences
+ARGP4
+ADDRGP4 s_preferences+1028
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_preferences
+ARGP4
+ADDRGP4 s_preferences+1096
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_preferences
+ARGP4
+ADDRGP4 s_preferences+1216
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_preferences
+ARGP4
+ADDRGP4 s_preferences+1404
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_preferences
+ARGP4
+ADDRGP4 s_preferences+1336
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_preferences
+ARGP4
+ADDRGP4 s_preferences+1608
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_preferences
+ARGP4
+ADDRGP4 s_preferences+1540
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_preferences
+ARGP4
+ADDRGP4 s_preferences+1472
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_preferences
+ARGP4
+ADDRGP4 s_preferences+892
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_preferences
+ARGP4
+ADDRGP4 s_preferences+960
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_preferences
+ARGP4
+ADDRGP4 s_preferences+1924
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_preferences
+ARGP4
+ADDRGP4 s_preferences+688
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_preferences
+ARGP4
+ADDRGP4 s_preferences+416
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_preferences
+ARGP4
+ADDRGP4 s_preferences+552
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_preferences
+ARGP4
+ADDRGP4 s_preferences+620
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_preferences
+ARGP4
+ADDRGP4 s_preferences+756
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_preferences
+ARGP4
+ADDRGP4 s_preferences+484
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_preferences
+ARGP4
+ADDRGP4 s_preferences+824
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_preferences
+ARGP4
+ADDRGP4 s_preferences+2384
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_preferences
+ARGP4
+ADDRGP4 s_preferences+2112
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_preferences
+ARGP4
+ADDRGP4 s_preferences+2248
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_preferences
+ARGP4
+ADDRGP4 s_preferences+2316
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_preferences
+ARGP4
+ADDRGP4 s_preferences+2180
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_preferences
+ARGP4
+ADDRGP4 s_preferences+2044
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_preferences
+ARGP4
+ADDRGP4 s_preferences+1744
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_preferences
+ARGP4
+ADDRGP4 s_preferences+1828
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 Preferences_SetMenuItems
+CALLV
+pop
+ADDRGP4 page
+CNSTI4 1
+ASGNI4
+ADDRGP4 SwitchPage
+CALLV
+pop
+LABELV $410
+endproc Preferences_MenuInit 20 12
+export Preferences_Cache
+proc Preferences_Cache 16 8
+ADDRGP4 $849
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $866
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $897
+ADDRGP4 $902
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 97
+ADDI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_preferences+2452
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $898
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $897
+LABELV $896
+endproc Preferences_Cache 16 8
+export UI_PreferencesMenu
+proc UI_PreferencesMenu 0 4
+ADDRGP4 Preferences_MenuInit
+CALLV
+pop
+ADDRGP4 s_preferences
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $903
+endproc UI_PreferencesMenu 0 4
+bss
+align 4
+LABELV page
+skip 4
+align 4
+LABELV s_preferences
+skip 2500
+import UI_HelpMenu_Cache
+import UI_HelpMenu_f
+import UI_HelpMenu
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import UI_InitGameinfo
+import UI_GetNumBots
+import UI_GetBotInfoByNumber
+import UI_GetNumArenas
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_VoiceIngame
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_GetVoiceGainClient
+import trap_GetVoiceMuteAll
+import trap_GetVoiceMuteClient
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_CIN_SetExtents
+import trap_CIN_StopCinematic
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_PlayCinematic
+import trap_RealTime
+import trap_S_StartBackgroundTrack
+import trap_S_StopBackgroundTrack
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_SaveCachedServers
+import trap_LAN_LoadCachedServers
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import BotListCompare
+import uis
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString2
+import UI_AutoWrappedString_LineCount
+import UI_DrawString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawIngameBG
+import UI_DrawStringNS
+import UI_ModelIcon
+import UI_DrawHandlePic1024
+import UI_AdjustFrom1024
+import UI_StopMusic
+import UI_StartCreditMusic
+import UI_StartMusic
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_ClearModelCache
+import UI_PrecacheClientModelname
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import UI_SpecifyPasswordMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import Demos_Cache
+import UI_DemosMenu
+import SetDefaultBinds_onUnusedKeys
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import SetupDefaultMenu_Cache
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import Music_NextTrack
+import Music_TriggerRestart
+import Music_Check
+import MusicMenu_Cache
+import MusicMenu_Open
+import MusicMenu_Shutdown
+import MusicMenu_Init
+import UI_CallVoteMenu
+import UI_InGameMenu
+import InGame_Cache
+import UI_SecretMenu
+import UI_InitBigCredits
+import UI_BigCredits_Cache
+import UI_CreditMenu
+import ExitMenu_Cache
+import ExitMenu_Init
+import UI_MainMenu
+import MainMenu_Cache
+import UI_UpdateCvars
+import UI_RegisterCvars
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import listbar_bluecolor
+import text_color_bluehighlight
+import text_color_bluenormal
+import text_color_ighighlight
+import text_color_ignormal
+import listbar_igcolor
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_lightOrange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_click_sound
+import menu_switch_sound
+import menu_move_sound
+import ScrollList_Key
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import wop_AutoBindUnusedKeys
+import wop_AutoswitchSongByNextMap
+import con_notifytime
+import s_wop_restarted
+import syc_logo
+import spraycolor
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_createGametype
+import ui_browserHidePrivate
+import ui_browserOnlyHumans
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $902
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 37
+byte 1 99
+byte 1 0
+align 1
+LABELV $866
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 66
+byte 1 116
+byte 1 110
+byte 1 66
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 49
+byte 1 0
+align 1
+LABELV $849
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 66
+byte 1 116
+byte 1 110
+byte 1 66
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 48
+byte 1 0
+align 1
+LABELV $839
+byte 1 77
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $820
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 76
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 80
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 44
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 103
+byte 1 104
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 109
+byte 1 46
+byte 1 0
+align 1
+LABELV $807
+byte 1 76
+byte 1 80
+byte 1 83
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 73
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 0
+align 1
+LABELV $803
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 120
+byte 1 101
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 103
+byte 1 104
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 109
+byte 1 46
+byte 1 0
+align 1
+LABELV $790
+byte 1 66
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 66
+byte 1 111
+byte 1 120
+byte 1 32
+byte 1 73
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 0
+align 1
+LABELV $786
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 114
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 44
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 103
+byte 1 104
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $773
+byte 1 83
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 73
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 0
+align 1
+LABELV $769
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 121
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 44
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 103
+byte 1 104
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 109
+byte 1 46
+byte 1 0
+align 1
+LABELV $756
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 73
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 0
+align 1
+LABELV $752
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 87
+byte 1 111
+byte 1 80
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 103
+byte 1 104
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 46
+byte 1 0
+align 1
+LABELV $739
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 73
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 0
+align 1
+LABELV $725
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 76
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $721
+byte 1 65
+byte 1 108
+byte 1 115
+byte 1 111
+byte 1 32
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 86
+byte 1 45
+byte 1 83
+byte 1 89
+byte 1 78
+byte 1 67
+byte 1 46
+byte 1 32
+byte 1 69
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 102
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 39
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 104
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 122
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 102
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 115
+byte 1 46
+byte 1 0
+align 1
+LABELV $708
+byte 1 83
+byte 1 121
+byte 1 110
+byte 1 99
+byte 1 32
+byte 1 69
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $694
+byte 1 68
+byte 1 121
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 0
+align 1
+LABELV $680
+byte 1 72
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 32
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 83
+byte 1 107
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $666
+byte 1 68
+byte 1 121
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 115
+byte 1 58
+byte 1 0
+align 1
+LABELV $662
+byte 1 69
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 101
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 46
+byte 1 0
+align 1
+LABELV $649
+byte 1 77
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 87
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 58
+byte 1 0
+align 1
+LABELV $645
+byte 1 69
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 51
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 50
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 46
+byte 1 0
+align 1
+LABELV $632
+byte 1 83
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 58
+byte 1 0
+align 1
+LABELV $628
+byte 1 69
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 46
+byte 1 32
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 46
+byte 1 0
+align 1
+LABELV $615
+byte 1 73
+byte 1 100
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 102
+byte 1 121
+byte 1 32
+byte 1 84
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 58
+byte 1 0
+align 1
+LABELV $599
+byte 1 71
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 58
+byte 1 0
+align 1
+LABELV $595
+byte 1 69
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 46
+byte 1 0
+align 1
+LABELV $582
+byte 1 71
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 58
+byte 1 0
+align 1
+LABELV $578
+byte 1 69
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 46
+byte 1 0
+align 1
+LABELV $565
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 58
+byte 1 0
+align 1
+LABELV $551
+byte 1 68
+byte 1 105
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 70
+byte 1 80
+byte 1 83
+byte 1 58
+byte 1 0
+align 1
+LABELV $537
+byte 1 68
+byte 1 105
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 86
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $523
+byte 1 68
+byte 1 105
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $509
+byte 1 68
+byte 1 105
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 76
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 58
+byte 1 0
+align 1
+LABELV $495
+byte 1 68
+byte 1 105
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 0
+align 1
+LABELV $491
+byte 1 83
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 104
+byte 1 101
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 111
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $476
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 0
+align 1
+LABELV $460
+byte 1 70
+byte 1 70
+byte 1 65
+byte 1 32
+byte 1 72
+byte 1 117
+byte 1 100
+byte 1 58
+byte 1 0
+align 1
+LABELV $456
+byte 1 69
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 52
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 72
+byte 1 85
+byte 1 68
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 46
+byte 1 0
+align 1
+LABELV $443
+byte 1 68
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $423
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 58
+byte 1 0
+align 1
+LABELV $389
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $386
+byte 1 45
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $384
+byte 1 45
+byte 1 53
+byte 1 0
+align 1
+LABELV $382
+byte 1 56
+byte 1 0
+align 1
+LABELV $380
+byte 1 51
+byte 1 0
+align 1
+LABELV $347
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 85
+byte 1 80
+byte 1 83
+byte 1 0
+align 1
+LABELV $327
+byte 1 0
+align 1
+LABELV $256
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $250
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 76
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $244
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 68
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $238
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $232
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $226
+byte 1 114
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $220
+byte 1 114
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 115
+byte 1 107
+byte 1 121
+byte 1 0
+align 1
+LABELV $214
+byte 1 114
+byte 1 95
+byte 1 100
+byte 1 121
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $208
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $202
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 115
+byte 1 0
+align 1
+LABELV $196
+byte 1 114
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $190
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $187
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $174
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 82
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $171
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $168
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 80
+byte 1 83
+byte 1 0
+align 1
+LABELV $165
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $162
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 76
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $159
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 70
+byte 1 70
+byte 1 65
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 0
+align 1
+LABELV $140
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 105
+byte 1 102
+byte 1 121
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $139
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $124
+byte 1 94
+byte 1 55
+byte 1 87
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $123
+byte 1 94
+byte 1 54
+byte 1 77
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 97
+byte 1 0
+align 1
+LABELV $122
+byte 1 94
+byte 1 53
+byte 1 67
+byte 1 121
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $121
+byte 1 94
+byte 1 52
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $120
+byte 1 94
+byte 1 51
+byte 1 89
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $119
+byte 1 94
+byte 1 50
+byte 1 71
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $118
+byte 1 94
+byte 1 49
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $117
+byte 1 94
+byte 1 48
+byte 1 66
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $116
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 40
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 41
+byte 1 0
+align 1
+LABELV $115
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 40
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 41
+byte 1 0
+align 1
+LABELV $114
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $113
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $112
+byte 1 65
+byte 1 105
+byte 1 114
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $111
+byte 1 87
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 0
+align 1
+LABELV $110
+byte 1 70
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $109
+byte 1 82
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $108
+byte 1 87
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $107
+byte 1 67
+byte 1 104
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $106
+byte 1 71
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $105
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $104
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $103
+byte 1 66
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
@@ -0,0 +1,11737 @@
+data
+export menu_text_color
+align 4
+LABELV menu_text_color
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+export menu_dim_color
+align 4
+LABELV menu_dim_color
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1061158912
+export color_black
+align 4
+LABELV color_black
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export color_white
+align 4
+LABELV color_white
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+export color_yellow
+align 4
+LABELV color_yellow
+byte 4 1065353216
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+export color_blue
+align 4
+LABELV color_blue
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+export color_lightOrange
+align 4
+LABELV color_lightOrange
+byte 4 1065353216
+byte 4 1059984507
+byte 4 0
+byte 4 1065353216
+export color_orange
+align 4
+LABELV color_orange
+byte 4 1065353216
+byte 4 1054615798
+byte 4 0
+byte 4 1065353216
+export color_red
+align 4
+LABELV color_red
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export color_dim
+align 4
+LABELV color_dim
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1048576000
+lit
+align 4
+LABELV pulse_color
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+data
+export text_color_disabled
+align 4
+LABELV text_color_disabled
+byte 4 1056964608
+byte 4 1056964608
+byte 4 1056964608
+byte 4 1065353216
+export text_color_normal
+align 4
+LABELV text_color_normal
+byte 4 1065353216
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+export text_color_highlight
+align 4
+LABELV text_color_highlight
+byte 4 1065353216
+byte 4 1051260355
+byte 4 0
+byte 4 1065353216
+export listbar_color
+align 4
+LABELV listbar_color
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1056964608
+export text_color_ignormal
+align 4
+LABELV text_color_ignormal
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export text_color_ighighlight
+align 4
+LABELV text_color_ighighlight
+byte 4 1053609165
+byte 4 0
+byte 4 1053609165
+byte 4 1065353216
+export listbar_igcolor
+align 4
+LABELV listbar_igcolor
+byte 4 1065353216
+byte 4 1054615798
+byte 4 0
+byte 4 1051260355
+export text_color_bluenormal
+align 4
+LABELV text_color_bluenormal
+byte 4 1053609165
+byte 4 1053609165
+byte 4 1065353216
+byte 4 1065353216
+export text_color_bluehighlight
+align 4
+LABELV text_color_bluehighlight
+byte 4 1050253722
+byte 4 1050253722
+byte 4 1065353216
+byte 4 1065353216
+export listbar_bluecolor
+align 4
+LABELV listbar_bluecolor
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1051260355
+code
+proc Text_Init 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+LABELV $77
+endproc Text_Init 4 0
+proc Text_Draw 548 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 528
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 532
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $79
+ADDRLP4 16
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $79
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $81
+ADDRLP4 16
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $81
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 8192
+BANDU4
+CNSTU4 0
+EQU4 $83
+ADDRLP4 0
+ADDRGP4 text_color_disabled
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRGP4 text_color_disabled+4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRGP4 text_color_disabled+8
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRGP4 text_color_disabled+12
+INDIRF4
+ASGNF4
+ADDRGP4 $84
+JUMPV
+LABELV $83
+ADDRLP4 540
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 540
+INDIRP4
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 540
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 131072
+BANDU4
+CNSTU4 0
+EQU4 $94
+ADDRGP4 uis+4
+INDIRI4
+CVIF4 4
+CNSTF4 1125515264
+DIVF4
+ARGF4
+ADDRLP4 544
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1053609165
+ADDRLP4 544
+INDIRF4
+MULF4
+CNSTF4 1058642330
+ADDF4
+ASGNF4
+LABELV $94
+LABELV $84
+ADDRLP4 528
+INDIRI4
+ARGI4
+ADDRLP4 532
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $78
+endproc Text_Draw 548 20
+proc TextS_Init 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $99
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1098907648
+ASGNF4
+LABELV $99
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 32768
+BANDI4
+CNSTI4 0
+EQI4 $101
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_PrintStrlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $102
+JUMPV
+LABELV $101
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_PrintStrlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+CNSTF4 1056964608
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $102
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 16
+BANDU4
+CNSTU4 0
+EQU4 $103
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $104
+JUMPV
+LABELV $103
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 8
+BANDU4
+CNSTU4 0
+EQU4 $105
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ASGNI4
+LABELV $105
+LABELV $104
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $98
+endproc TextS_Init 32 4
+proc TextS_Draw 60 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 8192
+BANDU4
+CNSTU4 0
+EQU4 $108
+ADDRLP4 0
+ADDRGP4 text_color_disabled
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRGP4 text_color_disabled+4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRGP4 text_color_disabled+8
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRGP4 text_color_disabled+12
+INDIRF4
+ASGNF4
+ADDRGP4 $109
+JUMPV
+LABELV $108
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $116
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 36
+INDIRP4
+CVPU4 4
+NEU4 $116
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 40
+INDIRP4
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 40
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $117
+JUMPV
+LABELV $116
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 44
+INDIRP4
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 44
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $117
+LABELV $109
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 256
+BANDU4
+CNSTU4 0
+EQU4 $124
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 56
+INDIRP4
+CVPU4 4
+NEU4 $126
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+ADDRGP4 $127
+JUMPV
+LABELV $126
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 8192
+BORI4
+ASGNI4
+LABELV $127
+LABELV $124
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 UI_DrawStringNS
+CALLV
+pop
+LABELV $107
+endproc TextS_Draw 60 24
+proc Bitmap_Init 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $129
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+NEGI4
+ASGNI4
+LABELV $129
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GEI4 $131
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+NEGI4
+ASGNI4
+LABELV $131
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 16
+BANDU4
+CNSTU4 0
+EQU4 $133
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $134
+JUMPV
+LABELV $133
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 8
+BANDU4
+CNSTU4 0
+EQU4 $135
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ASGNI4
+LABELV $135
+LABELV $134
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $128
+endproc Bitmap_Init 20 0
+proc Bitmap_Draw 100 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 16
+BANDU4
+CNSTU4 0
+EQU4 $138
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $139
+JUMPV
+LABELV $138
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 8
+BANDU4
+CNSTU4 0
+EQU4 $140
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+LABELV $140
+LABELV $139
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $142
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $142
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $144
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $144
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+LABELV $144
+LABELV $142
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $146
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $146
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+LABELV $146
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 8192
+BANDU4
+CNSTU4 0
+EQU4 $148
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $149
+ADDRGP4 colorMdGrey
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $149
+JUMPV
+LABELV $148
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $152
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $157
+ADDRLP4 72
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+ASGNU4
+ADDRLP4 76
+CNSTU4 0
+ASGNU4
+ADDRLP4 72
+INDIRU4
+CNSTU4 64
+BANDU4
+ADDRLP4 76
+INDIRU4
+NEU4 $154
+ADDRLP4 72
+INDIRU4
+CNSTU4 128
+BANDU4
+ADDRLP4 76
+INDIRU4
+EQU4 $157
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 80
+INDIRP4
+CVPU4 4
+EQU4 $154
+LABELV $157
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $154
+LABELV $152
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+ASGNU4
+ADDRLP4 72
+CNSTU4 0
+ASGNU4
+ADDRLP4 68
+INDIRU4
+CNSTU4 131072
+BANDU4
+ADDRLP4 72
+INDIRU4
+NEU4 $160
+ADDRLP4 68
+INDIRU4
+CNSTU4 256
+BANDU4
+ADDRLP4 72
+INDIRU4
+EQU4 $158
+LABELV $160
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 80
+INDIRP4
+CVPU4 4
+NEU4 $158
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $161
+ADDRLP4 84
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 84
+INDIRP4
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 32+4
+ADDRLP4 84
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 32+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 32+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 16
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 32+4
+INDIRF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 32+8
+INDIRF4
+ASGNF4
+ADDRLP4 16+12
+ADDRLP4 32+12
+INDIRF4
+ASGNF4
+ADDRGP4 $162
+JUMPV
+LABELV $161
+ADDRLP4 16
+ADDRGP4 pulse_color
+INDIRF4
+ASGNF4
+ADDRLP4 16+4
+ADDRGP4 pulse_color+4
+INDIRF4
+ASGNF4
+ADDRLP4 16+8
+ADDRGP4 pulse_color+8
+INDIRF4
+ASGNF4
+ADDRLP4 16+12
+ADDRGP4 pulse_color+12
+INDIRF4
+ASGNF4
+LABELV $162
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 75
+DIVI4
+CVIF4 4
+ARGF4
+ADDRLP4 84
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 16+12
+CNSTF4 1056964608
+ADDRLP4 84
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRLP4 16
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $159
+JUMPV
+LABELV $158
+ADDRLP4 88
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+ASGNU4
+ADDRLP4 92
+CNSTU4 0
+ASGNU4
+ADDRLP4 88
+INDIRU4
+CNSTU4 64
+BANDU4
+ADDRLP4 92
+INDIRU4
+NEU4 $182
+ADDRLP4 88
+INDIRU4
+CNSTU4 128
+BANDU4
+ADDRLP4 92
+INDIRU4
+EQU4 $180
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 96
+INDIRP4
+CVPU4 4
+NEU4 $180
+LABELV $182
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $183
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $184
+JUMPV
+LABELV $183
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $184
+LABELV $180
+LABELV $159
+LABELV $149
+LABELV $137
+endproc Bitmap_Draw 100 20
+proc Bitmap1024S_Init 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $186
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+NEGI4
+ASGNI4
+LABELV $186
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $188
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+NEGI4
+ASGNI4
+LABELV $188
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 1059061760
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1059061760
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1059061760
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1059061760
+ADDRLP4 12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $185
+endproc Bitmap1024S_Init 20 0
+proc Bitmap1024S_Draw 28 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $191
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LEI4 $193
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $193
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic1024
+CALLV
+pop
+LABELV $193
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+NEU4 $195
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic1024
+CALLV
+pop
+ADDRGP4 $192
+JUMPV
+LABELV $195
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic1024
+CALLV
+pop
+ADDRGP4 $192
+JUMPV
+LABELV $191
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+EQU4 $197
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $197
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic1024
+CALLV
+pop
+LABELV $197
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic1024
+CALLV
+pop
+LABELV $192
+LABELV $190
+endproc Bitmap1024S_Draw 28 20
+proc Action_Init 24 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $200
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $201
+JUMPV
+LABELV $200
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $201
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+LABELV $199
+endproc Action_Init 24 4
+proc Action_Draw 32 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 menu_text_color
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 8192
+BANDU4
+CNSTU4 0
+EQU4 $203
+ADDRLP4 0
+ADDRGP4 text_color_disabled
+ASGNP4
+ADDRGP4 $204
+JUMPV
+LABELV $203
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 256
+BANDU4
+CNSTU4 0
+EQU4 $205
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+NEI4 $205
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 8388608
+BANDU4
+CNSTU4 0
+EQU4 $207
+ADDRLP4 0
+ADDRGP4 text_color_bluehighlight
+ASGNP4
+ADDRGP4 $206
+JUMPV
+LABELV $207
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 2097152
+BANDU4
+CNSTU4 0
+EQU4 $210
+ADDRLP4 20
+ADDRGP4 text_color_ighighlight
+ASGNP4
+ADDRGP4 $211
+JUMPV
+LABELV $210
+ADDRLP4 20
+ADDRGP4 text_color_highlight
+ASGNP4
+LABELV $211
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRGP4 $206
+JUMPV
+LABELV $205
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 128
+BANDU4
+CNSTU4 0
+EQU4 $212
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+NEI4 $212
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 8388608
+BANDU4
+CNSTU4 0
+EQU4 $214
+ADDRLP4 0
+ADDRGP4 text_color_bluehighlight
+ASGNP4
+ADDRGP4 $213
+JUMPV
+LABELV $214
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 2097152
+BANDU4
+CNSTU4 0
+EQU4 $217
+ADDRLP4 24
+ADDRGP4 text_color_ighighlight
+ASGNP4
+ADDRGP4 $218
+JUMPV
+LABELV $217
+ADDRLP4 24
+ADDRGP4 text_color_highlight
+ASGNP4
+LABELV $218
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $213
+JUMPV
+LABELV $212
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 1
+BANDU4
+CNSTU4 0
+EQU4 $219
+ADDRLP4 12
+CNSTI4 4096
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 8388608
+BANDU4
+CNSTU4 0
+EQU4 $221
+ADDRLP4 0
+ADDRGP4 text_color_bluehighlight
+ASGNP4
+ADDRGP4 $222
+JUMPV
+LABELV $221
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 2097152
+BANDU4
+CNSTU4 0
+EQU4 $224
+ADDRLP4 24
+ADDRGP4 text_color_ighighlight
+ASGNP4
+ADDRGP4 $225
+JUMPV
+LABELV $224
+ADDRLP4 24
+ADDRGP4 text_color_highlight
+ASGNP4
+LABELV $225
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+ASGNP4
+LABELV $222
+LABELV $219
+LABELV $213
+LABELV $206
+LABELV $204
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+NEI4 $226
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+SUBI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 13
+ARGI4
+CNSTI4 4096
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawChar
+CALLV
+pop
+LABELV $226
+LABELV $202
+endproc Action_Draw 32 20
+proc RadioButton_Init 24 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $229
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $230
+JUMPV
+LABELV $229
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $230
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+CNSTI4 8
+ADDI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 48
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+LABELV $228
+endproc RadioButton_Init 24 4
+proc RadioButton_Key 44 8
+ADDRLP4 0
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 163
+EQI4 $237
+ADDRLP4 4
+CNSTI4 165
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $237
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GTI4 $244
+LABELV $243
+ADDRLP4 8
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 13
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $237
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $232
+LABELV $245
+ADDRLP4 16
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 134
+EQI4 $237
+ADDRLP4 16
+INDIRI4
+CNSTI4 135
+EQI4 $237
+ADDRGP4 $232
+JUMPV
+LABELV $244
+ADDRLP4 20
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 178
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $234
+ADDRLP4 20
+INDIRI4
+ADDRLP4 24
+INDIRI4
+GTI4 $247
+LABELV $246
+ADDRFP4 4
+INDIRI4
+CNSTI4 169
+EQI4 $237
+ADDRGP4 $232
+JUMPV
+LABELV $247
+ADDRLP4 28
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 185
+LTI4 $232
+ADDRLP4 28
+INDIRI4
+CNSTI4 188
+GTI4 $232
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $248-740
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $248
+address $237
+address $237
+address $237
+address $237
+code
+LABELV $234
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 512
+BANDU4
+CNSTU4 0
+NEU4 $235
+ADDRGP4 $233
+JUMPV
+LABELV $235
+LABELV $237
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $239
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRGP4 $240
+JUMPV
+LABELV $239
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+LABELV $240
+ADDRLP4 36
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $241
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 40
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $241
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $231
+JUMPV
+LABELV $232
+LABELV $233
+CNSTI4 0
+RETI4
+LABELV $231
+endproc RadioButton_Key 44 8
+proc RadioButton_Draw 76 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+NEI4 $252
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $253
+JUMPV
+LABELV $252
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $253
+ADDRLP4 12
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 8192
+BANDU4
+CNSTU4 0
+EQU4 $254
+ADDRLP4 8
+ADDRGP4 text_color_disabled
+ASGNP4
+ADDRLP4 16
+CNSTI4 16
+ASGNI4
+ADDRGP4 $255
+JUMPV
+LABELV $254
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $256
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 8388608
+BANDU4
+CNSTU4 0
+EQU4 $258
+ADDRLP4 8
+ADDRGP4 text_color_bluehighlight
+ASGNP4
+ADDRGP4 $259
+JUMPV
+LABELV $258
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 2097152
+BANDU4
+CNSTU4 0
+EQU4 $261
+ADDRLP4 28
+ADDRGP4 text_color_ighighlight
+ASGNP4
+ADDRGP4 $262
+JUMPV
+LABELV $261
+ADDRLP4 28
+ADDRGP4 text_color_highlight
+ASGNP4
+LABELV $262
+ADDRLP4 8
+ADDRLP4 28
+INDIRP4
+ASGNP4
+LABELV $259
+ADDRLP4 16
+CNSTI4 16400
+ASGNI4
+ADDRGP4 $257
+JUMPV
+LABELV $256
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 8388608
+BANDU4
+CNSTU4 0
+EQU4 $263
+ADDRLP4 8
+ADDRGP4 text_color_bluenormal
+ASGNP4
+ADDRGP4 $264
+JUMPV
+LABELV $263
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 2097152
+BANDU4
+CNSTU4 0
+EQU4 $266
+ADDRLP4 28
+ADDRGP4 text_color_ignormal
+ASGNP4
+ADDRGP4 $267
+JUMPV
+LABELV $266
+ADDRLP4 28
+ADDRGP4 text_color_normal
+ASGNP4
+LABELV $267
+ADDRLP4 8
+ADDRLP4 28
+INDIRP4
+ASGNP4
+LABELV $264
+ADDRLP4 16
+CNSTI4 16
+ASGNI4
+LABELV $257
+LABELV $255
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $268
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 8388608
+BANDU4
+CNSTU4 0
+EQU4 $270
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+SUBI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+SUBI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 listbar_bluecolor
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRGP4 $271
+JUMPV
+LABELV $270
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 2097152
+BANDU4
+CNSTU4 0
+EQU4 $272
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+SUBI4
+ADDRLP4 56
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+SUBI4
+ADDRLP4 56
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 listbar_igcolor
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRGP4 $273
+JUMPV
+LABELV $272
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 72
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+SUBI4
+ADDRLP4 72
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRLP4 68
+INDIRI4
+SUBI4
+ADDRLP4 72
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 listbar_color
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+LABELV $273
+LABELV $271
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 13
+ARGI4
+CNSTI4 4113
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawChar
+CALLV
+pop
+LABELV $268
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $274
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+SUBI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 18
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $274
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $276
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRGP4 uis+13828
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+ADDI4
+CNSTI4 16
+ADDI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $279
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRGP4 $277
+JUMPV
+LABELV $276
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRGP4 uis+13824
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+ADDI4
+CNSTI4 16
+ADDI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $281
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $277
+LABELV $250
+endproc RadioButton_Draw 76 20
+proc Slider_Init 24 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $283
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $284
+JUMPV
+LABELV $283
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $284
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+CNSTI4 8
+ADDI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 104
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+LABELV $282
+endproc Slider_Init 24 4
+proc Slider_Key 52 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 163
+EQI4 $296
+ADDRLP4 8
+CNSTI4 165
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $299
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+GTI4 $303
+LABELV $302
+ADDRLP4 12
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 134
+EQI4 $296
+ADDRLP4 12
+INDIRI4
+CNSTI4 135
+EQI4 $299
+ADDRGP4 $286
+JUMPV
+LABELV $303
+ADDRFP4 4
+INDIRI4
+CNSTI4 178
+EQI4 $288
+ADDRGP4 $286
+JUMPV
+LABELV $288
+ADDRLP4 24
+CNSTI4 16
+ASGNI4
+ADDRLP4 16
+ADDRGP4 uis+8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+SUBI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+CNSTF4 1117782016
+DIVF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+MULF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+GEF4 $290
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $291
+JUMPV
+LABELV $290
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+LEF4 $292
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $292
+LABELV $291
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+EQF4 $294
+ADDRLP4 0
+ADDRGP4 menu_move_sound
+INDIRI4
+ASGNI4
+ADDRGP4 $287
+JUMPV
+LABELV $294
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $287
+JUMPV
+LABELV $296
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+LEF4 $297
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 menu_move_sound
+INDIRI4
+ASGNI4
+ADDRGP4 $287
+JUMPV
+LABELV $297
+ADDRLP4 0
+ADDRGP4 menu_buzz_sound
+INDIRI4
+ASGNI4
+ADDRGP4 $287
+JUMPV
+LABELV $299
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+GEF4 $300
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 menu_move_sound
+INDIRI4
+ASGNI4
+ADDRGP4 $287
+JUMPV
+LABELV $300
+ADDRLP4 0
+ADDRGP4 menu_buzz_sound
+INDIRI4
+ASGNI4
+ADDRGP4 $287
+JUMPV
+LABELV $286
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $287
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $304
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $304
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $304
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $285
+endproc Slider_Key 52 8
+proc Slider_Draw 44 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+NEI4 $308
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $309
+JUMPV
+LABELV $308
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+LABELV $309
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 8192
+BANDU4
+CNSTU4 0
+EQU4 $310
+ADDRLP4 12
+ADDRGP4 text_color_disabled
+ASGNP4
+ADDRLP4 8
+CNSTI4 16
+ASGNI4
+ADDRGP4 $311
+JUMPV
+LABELV $310
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $312
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 8388608
+BANDU4
+CNSTU4 0
+EQU4 $314
+ADDRLP4 12
+ADDRGP4 text_color_bluehighlight
+ASGNP4
+ADDRGP4 $315
+JUMPV
+LABELV $314
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 2097152
+BANDU4
+CNSTU4 0
+EQU4 $317
+ADDRLP4 32
+ADDRGP4 text_color_ighighlight
+ASGNP4
+ADDRGP4 $318
+JUMPV
+LABELV $317
+ADDRLP4 32
+ADDRGP4 text_color_highlight
+ASGNP4
+LABELV $318
+ADDRLP4 12
+ADDRLP4 32
+INDIRP4
+ASGNP4
+LABELV $315
+ADDRLP4 8
+CNSTI4 16400
+ASGNI4
+ADDRGP4 $313
+JUMPV
+LABELV $312
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 8388608
+BANDU4
+CNSTU4 0
+EQU4 $319
+ADDRLP4 12
+ADDRGP4 text_color_bluenormal
+ASGNP4
+ADDRGP4 $320
+JUMPV
+LABELV $319
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 2097152
+BANDU4
+CNSTU4 0
+EQU4 $322
+ADDRLP4 32
+ADDRGP4 text_color_ignormal
+ASGNP4
+ADDRGP4 $323
+JUMPV
+LABELV $322
+ADDRLP4 32
+ADDRGP4 text_color_normal
+ASGNP4
+LABELV $323
+ADDRLP4 12
+ADDRLP4 32
+INDIRP4
+ASGNP4
+LABELV $320
+ADDRLP4 8
+CNSTI4 16
+ASGNI4
+LABELV $313
+LABELV $311
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+SUBI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 -16385
+BANDI4
+CNSTI4 2
+BORI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 UI_SetColor
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+ADDI4
+CVIF4 4
+ARGF4
+CNSTF4 1119879168
+ARGF4
+CNSTF4 1090519040
+ARGF4
+ADDRGP4 sliderBar
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 UI_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+LEF4 $324
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $326
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $325
+JUMPV
+LABELV $326
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+LEF4 $325
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $325
+JUMPV
+LABELV $324
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $325
+ADDRLP4 8
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $330
+ADDRLP4 16
+ADDRGP4 sliderButton_1
+INDIRI4
+ASGNI4
+ADDRGP4 $331
+JUMPV
+LABELV $330
+ADDRLP4 16
+ADDRGP4 sliderButton_0
+INDIRI4
+ASGNI4
+LABELV $331
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+ADDI4
+CVIF4 4
+CNSTF4 1116733440
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+CNSTI4 2
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1094713344
+ARGF4
+CNSTF4 1098907648
+ARGF4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $306
+endproc Slider_Draw 44 20
+proc SpinControl_Init 44 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $333
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 12
+INDIRU4
+CNSTI4 3
+LSHU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $334
+JUMPV
+LABELV $333
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $334
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 8
+SUBI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $336
+JUMPV
+LABELV $335
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 24
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LEI4 $338
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $338
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $336
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $335
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+CNSTI4 8
+ADDI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 8388608
+BANDU4
+CNSTU4 0
+EQU4 $340
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $342
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRGP4 colorBlack
+ASGNP4
+LABELV $342
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $344
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRGP4 colorBlue
+ASGNP4
+LABELV $344
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $346
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 colorBlue
+ASGNP4
+LABELV $346
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $341
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ADDRGP4 colorWhite
+ASGNP4
+ADDRGP4 $341
+JUMPV
+LABELV $340
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 2097152
+BANDU4
+CNSTU4 0
+EQU4 $350
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $352
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRGP4 colorWhite
+ASGNP4
+LABELV $352
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $354
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRGP4 colorBlack
+ASGNP4
+LABELV $354
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $356
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 color_orange
+ASGNP4
+LABELV $356
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $351
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ADDRGP4 colorBlack
+ASGNP4
+ADDRGP4 $351
+JUMPV
+LABELV $350
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $360
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRGP4 color_orange
+ASGNP4
+LABELV $360
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $362
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRGP4 colorYellow
+ASGNP4
+LABELV $362
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $364
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 colorRed
+ASGNP4
+LABELV $364
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $366
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ADDRGP4 colorYellow
+ASGNP4
+LABELV $366
+LABELV $351
+LABELV $341
+LABELV $332
+endproc SpinControl_Init 44 4
+proc SpinControl_Key 32 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 163
+EQI4 $405
+ADDRLP4 8
+CNSTI4 165
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $371
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+GTI4 $409
+LABELV $408
+ADDRLP4 12
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 134
+EQI4 $405
+ADDRLP4 12
+INDIRI4
+CNSTI4 135
+EQI4 $371
+ADDRGP4 $369
+JUMPV
+LABELV $409
+ADDRFP4 4
+INDIRI4
+CNSTI4 178
+EQI4 $371
+ADDRGP4 $369
+JUMPV
+LABELV $371
+ADDRLP4 20
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 20
+INDIRU4
+EQU4 $372
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 4194304
+BANDU4
+ADDRLP4 20
+INDIRU4
+NEU4 $372
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+LTI4 $374
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $374
+ADDRLP4 0
+ADDRGP4 menu_click_sound
+INDIRI4
+ASGNI4
+ADDRGP4 $370
+JUMPV
+LABELV $372
+ADDRGP4 uis+11404
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 640
+LEI4 $377
+ADDRGP4 uis+11408
+CNSTI4 640
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $378
+JUMPV
+LABELV $377
+ADDRGP4 uis+11408
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+LABELV $378
+ADDRGP4 uis+11408+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+CVIF4 4
+ASGNF4
+ADDRGP4 uis+11408+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1090519040
+ADDF4
+CNSTF4 1056964608
+ADDRGP4 uis+11408+12
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRGP4 uis+11408+4
+INDIRF4
+ADDRGP4 uis+11408+12
+INDIRF4
+ADDF4
+CNSTF4 1139802112
+LEF4 $387
+ADDRGP4 uis+11408+4
+CNSTF4 1139802112
+ADDRGP4 uis+11408+12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $388
+JUMPV
+LABELV $387
+ADDRGP4 uis+11408+4
+INDIRF4
+CNSTF4 0
+GEF4 $397
+ADDRGP4 uis+11408+4
+CNSTF4 0
+ASGNF4
+LABELV $397
+LABELV $388
+ADDRGP4 uis+11408+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 menu_click_sound
+INDIRI4
+RETI4
+ADDRGP4 $368
+JUMPV
+LABELV $405
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $406
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $406
+ADDRLP4 0
+ADDRGP4 menu_move_sound
+INDIRI4
+ASGNI4
+LABELV $369
+LABELV $370
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $410
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $410
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $410
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $368
+endproc SpinControl_Key 32 8
+proc SpinControl_Draw 80 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+CNSTI4 16
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+NEI4 $414
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $415
+JUMPV
+LABELV $414
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $415
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 8192
+BANDU4
+CNSTU4 0
+EQU4 $416
+ADDRLP4 0
+ADDRGP4 text_color_disabled
+ASGNP4
+ADDRGP4 $417
+JUMPV
+LABELV $416
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $418
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 8388608
+BANDU4
+CNSTU4 0
+EQU4 $420
+ADDRLP4 0
+ADDRGP4 text_color_bluehighlight
+ASGNP4
+ADDRGP4 $421
+JUMPV
+LABELV $420
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 2097152
+BANDU4
+CNSTU4 0
+EQU4 $423
+ADDRLP4 32
+ADDRGP4 text_color_ighighlight
+ASGNP4
+ADDRGP4 $424
+JUMPV
+LABELV $423
+ADDRLP4 32
+ADDRGP4 text_color_highlight
+ASGNP4
+LABELV $424
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+LABELV $421
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+ADDRGP4 $419
+JUMPV
+LABELV $418
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 1
+BANDU4
+CNSTU4 0
+EQU4 $425
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 8388608
+BANDU4
+CNSTU4 0
+EQU4 $427
+ADDRLP4 0
+ADDRGP4 text_color_bluehighlight
+ASGNP4
+ADDRGP4 $428
+JUMPV
+LABELV $427
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 2097152
+BANDU4
+CNSTU4 0
+EQU4 $430
+ADDRLP4 32
+ADDRGP4 text_color_ighighlight
+ASGNP4
+ADDRGP4 $431
+JUMPV
+LABELV $430
+ADDRLP4 32
+ADDRGP4 text_color_highlight
+ASGNP4
+LABELV $431
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+LABELV $428
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+ADDRGP4 $426
+JUMPV
+LABELV $425
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 8388608
+BANDU4
+CNSTU4 0
+EQU4 $432
+ADDRLP4 0
+ADDRGP4 text_color_bluenormal
+ASGNP4
+ADDRGP4 $433
+JUMPV
+LABELV $432
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 2097152
+BANDU4
+CNSTU4 0
+EQU4 $435
+ADDRLP4 32
+ADDRGP4 text_color_ignormal
+ASGNP4
+ADDRGP4 $436
+JUMPV
+LABELV $435
+ADDRLP4 32
+ADDRGP4 text_color_normal
+ASGNP4
+LABELV $436
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+LABELV $433
+LABELV $426
+LABELV $419
+LABELV $417
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $437
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 8388608
+BANDU4
+CNSTU4 0
+EQU4 $439
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+SUBI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+SUBI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 listbar_bluecolor
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRGP4 $440
+JUMPV
+LABELV $439
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 2097152
+BANDU4
+CNSTU4 0
+EQU4 $441
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 60
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+SUBI4
+ADDRLP4 60
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRLP4 56
+INDIRI4
+SUBI4
+ADDRLP4 60
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 listbar_igcolor
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRGP4 $442
+JUMPV
+LABELV $441
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 72
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 76
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 68
+INDIRI4
+SUBI4
+ADDRLP4 76
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+SUBI4
+ADDRLP4 76
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 listbar_color
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+LABELV $442
+LABELV $440
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 13
+ARGI4
+CNSTI4 4113
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawChar
+CALLV
+pop
+LABELV $437
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+SUBI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 -16385
+BANDI4
+CNSTI4 2
+BORI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $412
+endproc SpinControl_Draw 80 20
+proc ScrollList_Init 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $444
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $445
+JUMPV
+LABELV $444
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $446
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTI4 3
+ASGNI4
+LABELV $446
+LABELV $445
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 8
+BANDU4
+CNSTU4 0
+EQU4 $448
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ASGNI4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ASGNI4
+LABELV $448
+LABELV $443
+endproc ScrollList_Init 32 0
+export ScrollList_Key
+proc ScrollList_Key 184 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 160
+LTI4 $566
+ADDRFP4 4
+INDIRI4
+CNSTI4 168
+GTI4 $567
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $568-640
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $568
+address $466
+address $522
+address $476
+address $548
+address $451
+address $557
+address $469
+address $536
+address $487
+code
+LABELV $566
+ADDRFP4 4
+INDIRI4
+CNSTI4 132
+LTI4 $451
+ADDRFP4 4
+INDIRI4
+CNSTI4 144
+GTI4 $451
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $570-528
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $570
+address $522
+address $536
+address $548
+address $557
+address $451
+address $451
+address $451
+address $451
+address $451
+address $487
+address $476
+address $466
+address $469
+code
+LABELV $567
+ADDRLP4 52
+CNSTI4 178
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $453
+ADDRFP4 4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LTI4 $451
+LABELV $572
+ADDRFP4 4
+INDIRI4
+CNSTI4 183
+EQI4 $510
+ADDRFP4 4
+INDIRI4
+CNSTI4 184
+EQI4 $498
+ADDRGP4 $451
+JUMPV
+LABELV $453
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 512
+BANDU4
+CNSTU4 0
+EQU4 $452
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+ADDI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 64
+INDIRI4
+SUBI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 8
+BANDU4
+CNSTU4 0
+EQU4 $456
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ASGNI4
+LABELV $456
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 UI_CursorInRect
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $458
+ADDRLP4 28
+ADDRGP4 uis+8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+SUBI4
+CNSTI4 8
+DIVI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ADDI4
+DIVI4
+ASGNI4
+ADDRLP4 32
+ADDRGP4 uis+12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+CNSTI4 16
+DIVI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 36
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+GEI4 $462
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+EQI4 $464
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $464
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $450
+JUMPV
+LABELV $464
+LABELV $462
+LABELV $458
+ADDRGP4 menu_null_sound
+INDIRI4
+RETI4
+ADDRGP4 $450
+JUMPV
+LABELV $466
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+EQI4 $467
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $467
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $450
+JUMPV
+LABELV $467
+ADDRGP4 menu_buzz_sound
+INDIRI4
+RETI4
+ADDRGP4 $450
+JUMPV
+LABELV $469
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+CNSTI4 1
+LEI4 $470
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+ASGNP4
+ADDRLP4 84
+ADDRLP4 80
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+DIVI4
+CNSTI4 1
+ADDI4
+ADDRLP4 84
+INDIRI4
+MULI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+ADDRLP4 80
+INDIRP4
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRGP4 $471
+JUMPV
+LABELV $470
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+SUBI4
+ASGNI4
+LABELV $471
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $472
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $472
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+EQI4 $474
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $474
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $450
+JUMPV
+LABELV $474
+ADDRGP4 menu_buzz_sound
+INDIRI4
+RETI4
+ADDRGP4 $450
+JUMPV
+LABELV $476
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+CNSTI4 1
+LEI4 $477
+ADDRGP4 menu_null_sound
+INDIRI4
+RETI4
+ADDRGP4 $450
+JUMPV
+LABELV $477
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $479
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 88
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $481
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $481
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $483
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $483
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $485
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $485
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $450
+JUMPV
+LABELV $479
+ADDRGP4 menu_buzz_sound
+INDIRI4
+RETI4
+ADDRGP4 $450
+JUMPV
+LABELV $487
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+CNSTI4 1
+LEI4 $488
+ADDRGP4 menu_null_sound
+INDIRI4
+RETI4
+ADDRGP4 $450
+JUMPV
+LABELV $488
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $490
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 92
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 92
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+LEI4 $492
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $492
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $494
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $494
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $496
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $496
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $450
+JUMPV
+LABELV $490
+ADDRGP4 menu_buzz_sound
+INDIRI4
+RETI4
+ADDRGP4 $450
+JUMPV
+LABELV $498
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+CNSTI4 1
+LEI4 $499
+ADDRGP4 menu_null_sound
+INDIRI4
+RETI4
+ADDRGP4 $450
+JUMPV
+LABELV $499
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $501
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 6
+GEI4 $504
+ADDRLP4 88
+CNSTI4 1
+ASGNI4
+ADDRGP4 $505
+JUMPV
+LABELV $504
+ADDRLP4 88
+CNSTI4 3
+ASGNI4
+LABELV $505
+ADDRLP4 84
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 92
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 92
+INDIRP4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $506
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $506
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $508
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $508
+ADDRGP4 menu_null_sound
+INDIRI4
+RETI4
+ADDRGP4 $450
+JUMPV
+LABELV $501
+ADDRGP4 menu_buzz_sound
+INDIRI4
+RETI4
+ADDRGP4 $450
+JUMPV
+LABELV $510
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+CNSTI4 1
+LEI4 $511
+ADDRGP4 menu_null_sound
+INDIRI4
+RETI4
+ADDRGP4 $450
+JUMPV
+LABELV $511
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+SUBI4
+GEI4 $513
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 6
+GEI4 $516
+ADDRLP4 92
+CNSTI4 1
+ASGNI4
+ADDRGP4 $517
+JUMPV
+LABELV $516
+ADDRLP4 92
+CNSTI4 3
+ASGNI4
+LABELV $517
+ADDRLP4 88
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 96
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 96
+INDIRP4
+INDIRI4
+ADDRLP4 88
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+SUBI4
+LEI4 $518
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $518
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $520
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $520
+ADDRGP4 menu_null_sound
+INDIRI4
+RETI4
+ADDRGP4 $450
+JUMPV
+LABELV $513
+ADDRGP4 menu_buzz_sound
+INDIRI4
+RETI4
+ADDRGP4 $450
+JUMPV
+LABELV $522
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $523
+ADDRGP4 menu_buzz_sound
+INDIRI4
+RETI4
+ADDRGP4 $450
+JUMPV
+LABELV $523
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 92
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 92
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+GEI4 $525
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $527
+ADDRLP4 100
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ADDRLP4 100
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $528
+JUMPV
+LABELV $527
+ADDRLP4 104
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $528
+LABELV $525
+ADDRLP4 104
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 108
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ADDRLP4 108
+INDIRI4
+LTI4 $531
+ADDRLP4 104
+INDIRI4
+ADDRLP4 108
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+LEI4 $529
+LABELV $531
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $532
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $532
+LABELV $529
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $534
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $534
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $450
+JUMPV
+LABELV $536
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+NEI4 $537
+ADDRGP4 menu_buzz_sound
+INDIRI4
+RETI4
+ADDRGP4 $450
+JUMPV
+LABELV $537
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 120
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ADDRLP4 120
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+MULI4
+ADDI4
+LTI4 $539
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $541
+ADDRLP4 128
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ADDRLP4 128
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $542
+JUMPV
+LABELV $541
+ADDRLP4 132
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ADDRLP4 132
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $542
+LABELV $539
+ADDRLP4 132
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 136
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ADDRLP4 136
+INDIRI4
+LTI4 $545
+ADDRLP4 132
+INDIRI4
+ADDRLP4 136
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+LEI4 $543
+LABELV $545
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $543
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $546
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $546
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $450
+JUMPV
+LABELV $548
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $549
+ADDRGP4 menu_null_sound
+INDIRI4
+RETI4
+ADDRGP4 $450
+JUMPV
+LABELV $549
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+GEI4 $551
+ADDRGP4 menu_buzz_sound
+INDIRI4
+RETI4
+ADDRGP4 $450
+JUMPV
+LABELV $551
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 156
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ADDRLP4 156
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+GEI4 $553
+ADDRLP4 168
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ADDRLP4 168
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $553
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $555
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $555
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $450
+JUMPV
+LABELV $557
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $558
+ADDRGP4 menu_null_sound
+INDIRI4
+RETI4
+ADDRGP4 $450
+JUMPV
+LABELV $558
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+LTI4 $560
+ADDRGP4 menu_buzz_sound
+INDIRI4
+RETI4
+ADDRGP4 $450
+JUMPV
+LABELV $560
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+MULI4
+ADDI4
+CNSTI4 1
+SUBI4
+LEI4 $562
+ADDRLP4 180
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 180
+INDIRP4
+ADDRLP4 180
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $562
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $564
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $564
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $450
+JUMPV
+LABELV $451
+LABELV $452
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 Q_isprint
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+NEI4 $573
+CNSTI4 0
+RETI4
+ADDRGP4 $450
+JUMPV
+LABELV $573
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 Q_isupper
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+EQI4 $575
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 -32
+SUBI4
+ASGNI4
+LABELV $575
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $580
+JUMPV
+LABELV $577
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRP4
+ADDP4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 72
+ADDRGP4 Q_isupper
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $581
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -32
+SUBI4
+ASGNI4
+LABELV $581
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $583
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+GEI4 $585
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $586
+JUMPV
+LABELV $585
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+LEI4 $587
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $587
+LABELV $586
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $589
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $591
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $591
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $450
+JUMPV
+LABELV $589
+ADDRGP4 menu_buzz_sound
+INDIRI4
+RETI4
+ADDRGP4 $450
+JUMPV
+LABELV $583
+LABELV $578
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $580
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+LEI4 $577
+ADDRGP4 menu_buzz_sound
+INDIRI4
+RETI4
+LABELV $450
+endproc ScrollList_Key 184 16
+proc ScrollList_Draw 196 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+NEI4 $595
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRGP4 $596
+JUMPV
+LABELV $595
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+LABELV $596
+ADDRLP4 32
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRGP4 $600
+JUMPV
+LABELV $597
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $604
+JUMPV
+LABELV $601
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+LTI4 $605
+ADDRGP4 $603
+JUMPV
+LABELV $605
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+NEI4 $607
+ADDRLP4 24
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 8
+BANDU4
+CNSTU4 0
+EQU4 $609
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+CNSTI4 2
+DIVI4
+CNSTI4 1
+ADDI4
+SUBI4
+ASGNI4
+LABELV $609
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 8388608
+BANDU4
+CNSTU4 0
+EQU4 $611
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+CVIF4 4
+ARGF4
+CNSTF4 1099956224
+ARGF4
+ADDRGP4 listbar_bluecolor
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRGP4 $612
+JUMPV
+LABELV $611
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 2097152
+BANDU4
+CNSTU4 0
+EQU4 $613
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+CVIF4 4
+ARGF4
+CNSTF4 1099956224
+ARGF4
+ADDRGP4 listbar_igcolor
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRGP4 $614
+JUMPV
+LABELV $613
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+CVIF4 4
+ARGF4
+CNSTF4 1099956224
+ARGF4
+ADDRGP4 listbar_color
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+LABELV $614
+LABELV $612
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 8388608
+BANDU4
+CNSTU4 0
+EQU4 $615
+ADDRLP4 16
+ADDRGP4 text_color_bluehighlight
+ASGNP4
+ADDRGP4 $616
+JUMPV
+LABELV $615
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 2097152
+BANDU4
+CNSTU4 0
+EQU4 $618
+ADDRLP4 52
+ADDRGP4 text_color_ighighlight
+ASGNP4
+ADDRGP4 $619
+JUMPV
+LABELV $618
+ADDRLP4 52
+ADDRGP4 text_color_highlight
+ASGNP4
+LABELV $619
+ADDRLP4 16
+ADDRLP4 52
+INDIRP4
+ASGNP4
+LABELV $616
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $620
+ADDRLP4 8
+CNSTI4 16400
+ASGNI4
+ADDRGP4 $608
+JUMPV
+LABELV $620
+ADDRLP4 8
+CNSTI4 16
+ASGNI4
+ADDRGP4 $608
+JUMPV
+LABELV $607
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 8388608
+BANDU4
+CNSTU4 0
+EQU4 $622
+ADDRLP4 16
+ADDRGP4 text_color_bluenormal
+ASGNP4
+ADDRGP4 $623
+JUMPV
+LABELV $622
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 2097152
+BANDU4
+CNSTU4 0
+EQU4 $625
+ADDRLP4 52
+ADDRGP4 text_color_ignormal
+ASGNP4
+ADDRGP4 $626
+JUMPV
+LABELV $625
+ADDRLP4 52
+ADDRGP4 text_color_normal
+ASGNP4
+LABELV $626
+ADDRLP4 16
+ADDRLP4 52
+INDIRP4
+ASGNP4
+LABELV $623
+ADDRLP4 8
+CNSTI4 16
+ASGNI4
+LABELV $608
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 8
+BANDU4
+CNSTU4 0
+EQU4 $627
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $627
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 Q_PrintStrlen
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+LEI4 $629
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 126
+LEI4 $631
+ADDRLP4 56
+CNSTI4 126
+ASGNI4
+LABELV $631
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+NEI4 $633
+ADDRLP4 188
+ADDRLP4 12
+INDIRI4
+ADDRLP4 56
+INDIRI4
+SUBI4
+ASGNI4
+CNSTF4 1017370378
+ADDRGP4 uis+4
+INDIRI4
+CVIF4 4
+MULF4
+ADDRLP4 188
+INDIRI4
+CVIF4 4
+DIVF4
+ARGF4
+ADDRLP4 192
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 60
+ARGP4
+ADDRLP4 188
+INDIRI4
+CNSTI4 1
+ADDI4
+CVIF4 4
+CNSTF4 1056964608
+ADDRLP4 192
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+MULF4
+CVFI4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRP4
+ADDP4
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 56
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 60
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRGP4 $630
+JUMPV
+LABELV $633
+ADDRLP4 60
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 56
+INDIRI4
+ADDRLP4 60-4
+ADDP4
+ARGP4
+ADDRGP4 $637
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 60
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRGP4 $630
+JUMPV
+LABELV $629
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $630
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+LABELV $602
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $604
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+ADDI4
+LTI4 $601
+LABELV $603
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ADDI4
+CNSTI4 3
+LSHI4
+ADDI4
+ASGNI4
+LABELV $598
+ADDRLP4 36
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $600
+ADDRLP4 36
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+LTI4 $597
+LABELV $593
+endproc ScrollList_Draw 196 20
+export Menu_AddItem
+proc Menu_AddItem 40 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $639
+ADDRGP4 $641
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $639
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 48
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 4294966783
+BANDU4
+ASGNU4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 32768
+BANDU4
+CNSTU4 0
+NEU4 $642
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+LTI4 $644
+ADDRLP4 28
+INDIRI4
+CNSTI4 12
+GTI4 $644
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $658-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $658
+address $651
+address $647
+address $649
+address $648
+address $650
+address $652
+address $653
+address $654
+address $644
+address $644
+address $655
+address $656
+code
+LABELV $647
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Action_Init
+CALLV
+pop
+ADDRGP4 $645
+JUMPV
+LABELV $648
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 MenuField_Init
+CALLV
+pop
+ADDRGP4 $645
+JUMPV
+LABELV $649
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 SpinControl_Init
+CALLV
+pop
+ADDRGP4 $645
+JUMPV
+LABELV $650
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 RadioButton_Init
+CALLV
+pop
+ADDRGP4 $645
+JUMPV
+LABELV $651
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Slider_Init
+CALLV
+pop
+ADDRGP4 $645
+JUMPV
+LABELV $652
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Bitmap_Init
+CALLV
+pop
+ADDRGP4 $645
+JUMPV
+LABELV $653
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Text_Init
+CALLV
+pop
+ADDRGP4 $645
+JUMPV
+LABELV $654
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 ScrollList_Init
+CALLV
+pop
+ADDRGP4 $645
+JUMPV
+LABELV $655
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Bitmap1024S_Init
+CALLV
+pop
+ADDRGP4 $645
+JUMPV
+LABELV $656
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 TextS_Init
+CALLV
+pop
+ADDRGP4 $645
+JUMPV
+LABELV $644
+ADDRGP4 $657
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $645
+LABELV $642
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $638
+endproc Menu_AddItem 40 8
+export Menu_CursorMoved
+proc Menu_CursorMoved 32 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+NEI4 $661
+ADDRGP4 $660
+JUMPV
+LABELV $661
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $663
+ADDRLP4 12
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+GEI4 $663
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $665
+ADDRLP4 24
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CALLV
+pop
+LABELV $665
+LABELV $663
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+LTI4 $667
+ADDRLP4 20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+GEI4 $667
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $669
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRP4
+CALLV
+pop
+LABELV $669
+LABELV $667
+LABELV $660
+endproc Menu_CursorMoved 32 8
+export Menu_SetCursor
+proc Menu_SetCursor 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 24576
+BANDU4
+CNSTU4 0
+EQU4 $672
+ADDRGP4 $671
+JUMPV
+LABELV $672
+ADDRGP4 uis+11404
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $674
+ADDRGP4 $671
+JUMPV
+LABELV $674
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_CursorMoved
+CALLV
+pop
+LABELV $671
+endproc Menu_SetCursor 4 4
+export Menu_SetCursorToItem
+proc Menu_SetCursorToItem 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $681
+JUMPV
+LABELV $678
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+NEU4 $682
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Menu_SetCursor
+CALLV
+pop
+ADDRGP4 $677
+JUMPV
+LABELV $682
+LABELV $679
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $681
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $678
+LABELV $677
+endproc Menu_SetCursorToItem 4 8
+proc Menu_AdjustCursor 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $687
+JUMPV
+LABELV $686
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 26624
+BANDU4
+CNSTU4 0
+EQU4 $688
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $690
+LABELV $687
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $691
+ADDRLP4 12
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $686
+LABELV $691
+LABELV $688
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $692
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $693
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $696
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $698
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $684
+JUMPV
+LABELV $698
+ADDRFP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $687
+JUMPV
+LABELV $696
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $693
+JUMPV
+LABELV $692
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+GEI4 $700
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $702
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $704
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $684
+JUMPV
+LABELV $704
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $687
+JUMPV
+LABELV $702
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $700
+LABELV $693
+LABELV $684
+endproc Menu_AdjustCursor 24 0
+lit
+align 4
+LABELV $707
+byte 4 16
+align 4
+LABELV $708
+byte 4 250
+align 4
+LABELV $709
+byte 4 5
+align 4
+LABELV $710
+byte 4 20
+align 4
+LABELV $711
+byte 4 10
+code
+proc UI_DrawToolTip 52 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $712
+ADDRGP4 $706
+JUMPV
+LABELV $712
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $714
+ADDRGP4 $706
+JUMPV
+LABELV $714
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 UI_ProportionalStringWidth
+CALLI4
+ASGNI4
+ADDRGP4 $707
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 UI_ProportionalSizeScale
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 32
+INDIRI4
+CVIF4 4
+ADDRLP4 36
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 $708
+INDIRI4
+LEI4 $716
+ADDRGP4 $708
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $707
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 40
+ADDRGP4 UI_AutoWrappedString_LineCount
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 $708
+INDIRI4
+ADDRGP4 $709
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDI4
+ASGNI4
+ADDRGP4 $717
+JUMPV
+LABELV $716
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ADDRGP4 $709
+INDIRI4
+ADDRLP4 40
+INDIRI4
+LSHI4
+ADDI4
+ASGNI4
+LABELV $717
+ADDRLP4 12
+ADDRLP4 20
+INDIRI4
+ADDRGP4 $710
+INDIRI4
+MULI4
+ADDRGP4 $709
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 640
+ADDRLP4 8
+INDIRI4
+SUBI4
+LEI4 $718
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $720
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $720
+LABELV $718
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+SUBI4
+ADDRGP4 $711
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $722
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 240
+GEI4 $722
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 15
+ADDI4
+ADDRGP4 $711
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $722
+ADDRLP4 44
+ADDRGP4 $709
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 $708
+INDIRI4
+ARGI4
+CNSTI4 20
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $707
+INDIRI4
+ARGI4
+ADDRGP4 menu_text_color
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_DrawString_AutoWrapped
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 colorYellow
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 UI_DrawRect
+CALLV
+pop
+LABELV $706
+endproc UI_DrawToolTip 52 32
+export Menu_Draw
+proc Menu_Draw 44 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $728
+JUMPV
+LABELV $725
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 4096
+BANDU4
+CNSTU4 0
+EQU4 $729
+ADDRGP4 $726
+JUMPV
+LABELV $729
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $731
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $732
+JUMPV
+LABELV $731
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+LTI4 $733
+ADDRLP4 8
+INDIRI4
+CNSTI4 12
+GTI4 $733
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $747-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $747
+address $738
+address $740
+address $739
+address $737
+address $736
+address $741
+address $742
+address $743
+address $733
+address $733
+address $744
+address $745
+code
+LABELV $736
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 RadioButton_Draw
+CALLV
+pop
+ADDRGP4 $734
+JUMPV
+LABELV $737
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 MenuField_Draw
+CALLV
+pop
+ADDRGP4 $734
+JUMPV
+LABELV $738
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Slider_Draw
+CALLV
+pop
+ADDRGP4 $734
+JUMPV
+LABELV $739
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 SpinControl_Draw
+CALLV
+pop
+ADDRGP4 $734
+JUMPV
+LABELV $740
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Action_Draw
+CALLV
+pop
+ADDRGP4 $734
+JUMPV
+LABELV $741
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Bitmap_Draw
+CALLV
+pop
+ADDRGP4 $734
+JUMPV
+LABELV $742
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Text_Draw
+CALLV
+pop
+ADDRGP4 $734
+JUMPV
+LABELV $743
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScrollList_Draw
+CALLV
+pop
+ADDRGP4 $734
+JUMPV
+LABELV $744
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Bitmap1024S_Draw
+CALLV
+pop
+ADDRGP4 $734
+JUMPV
+LABELV $745
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 TextS_Draw
+CALLV
+pop
+ADDRGP4 $734
+JUMPV
+LABELV $733
+ADDRGP4 $746
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $734
+LABELV $732
+ADDRGP4 uis+11388
+INDIRI4
+CNSTI4 0
+EQI4 $749
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 16384
+BANDU4
+CNSTU4 0
+NEU4 $752
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 28
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 32
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+SUBI4
+ADDRLP4 36
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+SUBI4
+ADDRLP4 36
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 512
+BANDU4
+CNSTU4 0
+EQU4 $754
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 colorYellow
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_DrawRect
+CALLV
+pop
+ADDRGP4 $755
+JUMPV
+LABELV $754
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_DrawRect
+CALLV
+pop
+LABELV $755
+LABELV $752
+LABELV $749
+LABELV $726
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $728
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $725
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $756
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $758
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $758
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawToolTip
+CALLV
+pop
+LABELV $756
+ADDRGP4 uis+11404
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $760
+ADDRLP4 12
+ADDRGP4 uis+12
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+11408+4
+INDIRF4
+SUBF4
+CNSTF4 1098907648
+DIVF4
+CVFI4 4
+ASGNI4
+CNSTF4 0
+ARGF4
+ADDRGP4 uis+11404
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 32
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 36
+CNSTF4 1084227584
+ASGNF4
+ADDRLP4 16
+ADDRGP4 uis+11408
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16+4
+ADDRGP4 uis+11408+4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16+8
+ADDRGP4 uis+11408+8
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+ADDRLP4 16+12
+ADDRGP4 uis+11408+12
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16+4
+INDIRF4
+ARGF4
+ADDRLP4 16+8
+INDIRF4
+ARGF4
+ADDRLP4 16+12
+INDIRF4
+ARGF4
+ADDRGP4 uis+11404
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $784
+JUMPV
+LABELV $781
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $786
+ADDRGP4 uis+11408
+INDIRF4
+ARGF4
+ADDRGP4 uis+11408+4
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+CVIF4 4
+ADDF4
+ARGF4
+ADDRGP4 uis+11408+8
+INDIRF4
+ARGF4
+CNSTF4 1098907648
+ARGF4
+ADDRGP4 uis+11404
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+LABELV $786
+ADDRGP4 uis+11408
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 uis+11408+4
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+CVIF4 4
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uis+11404
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+CNSTF4 1098907648
+ARGF4
+ADDRGP4 uis+11404
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawStringNS
+CALLV
+pop
+LABELV $782
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $784
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uis+11404
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+LTI4 $781
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16+4
+INDIRF4
+ARGF4
+ADDRLP4 16+8
+INDIRF4
+ARGF4
+ADDRLP4 16+12
+INDIRF4
+ARGF4
+ADDRGP4 uis+11404
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 UI_DrawRect
+CALLV
+pop
+LABELV $760
+LABELV $724
+endproc Menu_Draw 44 24
+export Menu_ItemAtCursor
+proc Menu_ItemAtCursor 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $806
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $804
+LABELV $806
+CNSTP4 0
+RETP4
+ADDRGP4 $803
+JUMPV
+LABELV $804
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+RETP4
+LABELV $803
+endproc Menu_ItemAtCursor 12 0
+export Menu_ActivateItem
+proc Menu_ActivateItem 4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $808
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 1048576
+BANDU4
+CNSTU4 0
+NEU4 $810
+ADDRGP4 menu_click_sound
+INDIRI4
+RETI4
+ADDRGP4 $807
+JUMPV
+LABELV $810
+LABELV $808
+CNSTI4 0
+RETI4
+LABELV $807
+endproc Menu_ActivateItem 4 8
+export Menu_DefaultKey
+proc Menu_DefaultKey 112 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 uis+11404
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $813
+ADDRFP4 4
+INDIRI4
+CNSTI4 156
+EQI4 $813
+ADDRFP4 4
+INDIRI4
+CNSTI4 178
+EQI4 $816
+ADDRGP4 uis+11404
+CNSTP4 0
+ASGNP4
+CNSTI4 0
+RETI4
+ADDRGP4 $812
+JUMPV
+LABELV $816
+ADDRGP4 uis+8
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+11408
+INDIRF4
+LEF4 $819
+ADDRGP4 uis+8
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+11408
+INDIRF4
+ADDRGP4 uis+11408+8
+INDIRF4
+ADDF4
+GEF4 $819
+ADDRGP4 uis+12
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+11408+4
+INDIRF4
+LEF4 $819
+ADDRGP4 uis+12
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+11408+4
+INDIRF4
+ADDRGP4 uis+11408+12
+INDIRF4
+ADDF4
+GEF4 $819
+ADDRGP4 uis+11404
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 uis+12
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+11408+4
+INDIRF4
+SUBF4
+CNSTF4 1098907648
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRLP4 12
+CNSTI4 68
+ASGNI4
+ADDRGP4 uis+11404
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $844
+ADDRGP4 uis+11404
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+ADDRGP4 uis+11404
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+LTI4 $839
+LABELV $844
+ADDRGP4 $845
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 uis+11404
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $839
+ADDRGP4 uis+11404
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $847
+ADDRGP4 uis+11404
+INDIRP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 uis+11404
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $847
+ADDRGP4 uis+11404
+CNSTP4 0
+ASGNP4
+CNSTI4 0
+RETI4
+ADDRGP4 $812
+JUMPV
+LABELV $819
+ADDRGP4 uis+11404
+CNSTP4 0
+ASGNP4
+CNSTI4 0
+RETI4
+ADDRGP4 $812
+JUMPV
+LABELV $813
+ADDRLP4 12
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 27
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $856
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $854
+LABELV $857
+ADDRFP4 4
+INDIRI4
+CNSTI4 179
+EQI4 $856
+ADDRGP4 $854
+JUMPV
+LABELV $856
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 menu_null_sound
+INDIRI4
+RETI4
+ADDRGP4 $812
+JUMPV
+LABELV $854
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $860
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $858
+LABELV $860
+CNSTI4 0
+RETI4
+ADDRGP4 $812
+JUMPV
+LABELV $858
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 32
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 32
+INDIRU4
+EQU4 $861
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 24576
+BANDU4
+ADDRLP4 32
+INDIRU4
+NEU4 $861
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+LTI4 $863
+ADDRLP4 36
+INDIRI4
+CNSTI4 8
+GTI4 $863
+ADDRLP4 36
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $871-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $871
+address $868
+address $863
+address $866
+address $870
+address $867
+address $863
+address $863
+address $869
+code
+LABELV $866
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 SpinControl_Key
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 $864
+JUMPV
+LABELV $867
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 RadioButton_Key
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 $864
+JUMPV
+LABELV $868
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 Slider_Key
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRGP4 $864
+JUMPV
+LABELV $869
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 ScrollList_Key
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 $864
+JUMPV
+LABELV $870
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRLP4 60
+ADDRGP4 MenuField_Key
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+LABELV $863
+LABELV $864
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $873
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $812
+JUMPV
+LABELV $873
+LABELV $861
+ADDRLP4 36
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 155
+EQI4 $877
+ADDRLP4 40
+CNSTI4 156
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRLP4 40
+INDIRI4
+EQI4 $882
+ADDRLP4 36
+INDIRI4
+ADDRLP4 40
+INDIRI4
+GTI4 $901
+LABELV $900
+ADDRLP4 44
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 48
+CNSTI4 13
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRLP4 48
+INDIRI4
+EQI4 $895
+ADDRLP4 44
+INDIRI4
+ADDRLP4 48
+INDIRI4
+GTI4 $903
+LABELV $902
+ADDRFP4 4
+INDIRI4
+CNSTI4 9
+EQI4 $887
+ADDRGP4 $875
+JUMPV
+LABELV $903
+ADDRLP4 52
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 132
+EQI4 $884
+ADDRLP4 52
+INDIRI4
+CNSTI4 133
+EQI4 $887
+ADDRGP4 $875
+JUMPV
+LABELV $901
+ADDRLP4 56
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 167
+EQI4 $887
+ADDRLP4 60
+CNSTI4 169
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $895
+ADDRLP4 56
+INDIRI4
+ADDRLP4 60
+INDIRI4
+GTI4 $905
+LABELV $904
+ADDRFP4 4
+INDIRI4
+CNSTI4 161
+EQI4 $884
+ADDRGP4 $875
+JUMPV
+LABELV $905
+ADDRLP4 64
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 178
+LTI4 $875
+ADDRLP4 64
+INDIRI4
+CNSTI4 188
+GTI4 $906
+ADDRLP4 64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $907-712
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $907
+address $890
+address $875
+address $890
+address $875
+address $875
+address $875
+address $875
+address $895
+address $895
+address $895
+address $895
+code
+LABELV $906
+ADDRLP4 68
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 217
+LTI4 $875
+ADDRLP4 68
+INDIRI4
+CNSTI4 232
+GTI4 $875
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $909-868
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $909
+address $895
+address $895
+address $895
+address $895
+address $895
+address $895
+address $895
+address $895
+address $895
+address $895
+address $895
+address $895
+address $895
+address $895
+address $895
+address $895
+code
+LABELV $877
+ADDRGP4 $880
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 72
+INDIRF4
+CVFI4 4
+CNSTI4 0
+EQI4 $876
+ADDRLP4 76
+ADDRGP4 uis+11388
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRGP4 $876
+JUMPV
+LABELV $882
+CNSTI4 2
+ARGI4
+ADDRGP4 $883
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $876
+JUMPV
+LABELV $884
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 Menu_AdjustCursor
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+EQI4 $876
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_CursorMoved
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 menu_move_sound
+INDIRI4
+ASGNI4
+ADDRGP4 $876
+JUMPV
+LABELV $887
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 Menu_AdjustCursor
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+EQI4 $876
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_CursorMoved
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 menu_move_sound
+INDIRI4
+ASGNI4
+ADDRGP4 $876
+JUMPV
+LABELV $890
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $876
+ADDRLP4 96
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+ASGNU4
+ADDRLP4 100
+CNSTU4 0
+ASGNU4
+ADDRLP4 96
+INDIRU4
+CNSTU4 512
+BANDU4
+ADDRLP4 100
+INDIRU4
+EQU4 $876
+ADDRLP4 96
+INDIRU4
+CNSTU4 24576
+BANDU4
+ADDRLP4 100
+INDIRU4
+NEU4 $876
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 Menu_ActivateItem
+CALLI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+RETI4
+ADDRGP4 $812
+JUMPV
+LABELV $895
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $876
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRU4
+CNSTU4 26624
+BANDU4
+CNSTU4 0
+NEU4 $876
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 Menu_ActivateItem
+CALLI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+RETI4
+ADDRGP4 $812
+JUMPV
+LABELV $875
+LABELV $876
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $812
+endproc Menu_DefaultKey 112 8
+export Menu_Cache
+proc Menu_Cache 132 8
+ADDRGP4 $913
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uis+13812
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $915
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uis+13816
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $917
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uis+13820
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $919
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uis+13824
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $921
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uis+13828
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $923
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uis+11392
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $925
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uis+11428
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $927
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uis+11432
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $929
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uis+11436
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 $931
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uis+11440
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $933
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uis+11444
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $935
+ARGP4
+ADDRLP4 44
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uis+11448
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 $937
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uis+11452
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 $939
+ARGP4
+ADDRLP4 52
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uis+11456
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRGP4 $941
+ARGP4
+ADDRLP4 56
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uis+11460
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 $943
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uis+11464
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 $945
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uis+11468
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRGP4 $947
+ARGP4
+ADDRLP4 68
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uis+11472
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRGP4 $949
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uis+11476
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRGP4 $951
+ARGP4
+ADDRLP4 76
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uis+11480
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRGP4 $953
+ARGP4
+ADDRLP4 80
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uis+11484
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRGP4 $955
+ARGP4
+ADDRLP4 84
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uis+11488
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRGP4 $957
+ARGP4
+ADDRLP4 88
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uis+11492
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRGP4 $959
+ARGP4
+ADDRLP4 92
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uis+11496
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRGP4 $961
+ARGP4
+ADDRLP4 96
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uis+11500
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRGP4 $962
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 100
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 menu_switch_sound
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRGP4 $963
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 104
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 menu_click_sound
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRGP4 $964
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 108
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 menu_move_sound
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRGP4 $965
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 112
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 menu_buzz_sound
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRGP4 $966
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 116
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 weaponChangeSound
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRGP4 menu_null_sound
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $967
+ARGP4
+ADDRLP4 120
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 sliderBar
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRGP4 $968
+ARGP4
+ADDRLP4 124
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 sliderButton_0
+ADDRLP4 124
+INDIRI4
+ASGNI4
+ADDRGP4 $969
+ARGP4
+ADDRLP4 128
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 sliderButton_1
+ADDRLP4 128
+INDIRI4
+ASGNI4
+LABELV $911
+endproc Menu_Cache 132 8
+bss
+align 4
+LABELV sliderButton_1
+skip 4
+align 4
+LABELV sliderButton_0
+skip 4
+align 4
+LABELV sliderBar
+skip 4
+import UI_HelpMenu_Cache
+import UI_HelpMenu_f
+import UI_HelpMenu
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import UI_InitGameinfo
+import UI_GetNumBots
+import UI_GetBotInfoByNumber
+import UI_GetNumArenas
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_VoiceIngame
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_GetVoiceGainClient
+import trap_GetVoiceMuteAll
+import trap_GetVoiceMuteClient
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_CIN_SetExtents
+import trap_CIN_StopCinematic
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_PlayCinematic
+import trap_RealTime
+import trap_S_StartBackgroundTrack
+import trap_S_StopBackgroundTrack
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_SaveCachedServers
+import trap_LAN_LoadCachedServers
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import BotListCompare
+import uis
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString2
+import UI_AutoWrappedString_LineCount
+import UI_DrawString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawIngameBG
+import UI_DrawStringNS
+import UI_ModelIcon
+import UI_DrawHandlePic1024
+import UI_AdjustFrom1024
+import UI_StopMusic
+import UI_StartCreditMusic
+import UI_StartMusic
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_ClearModelCache
+import UI_PrecacheClientModelname
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import UI_SpecifyPasswordMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import Demos_Cache
+import UI_DemosMenu
+import SetDefaultBinds_onUnusedKeys
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import SetupDefaultMenu_Cache
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import Music_NextTrack
+import Music_TriggerRestart
+import Music_Check
+import MusicMenu_Cache
+import MusicMenu_Open
+import MusicMenu_Shutdown
+import MusicMenu_Init
+import UI_CallVoteMenu
+import UI_InGameMenu
+import InGame_Cache
+import UI_SecretMenu
+import UI_InitBigCredits
+import UI_BigCredits_Cache
+import UI_CreditMenu
+import ExitMenu_Cache
+import ExitMenu_Init
+import UI_MainMenu
+import MainMenu_Cache
+import UI_UpdateCvars
+import UI_RegisterCvars
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import list_color
+import name_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+export weaponChangeSound
+align 4
+LABELV weaponChangeSound
+skip 4
+export menu_null_sound
+align 4
+LABELV menu_null_sound
+skip 4
+export menu_buzz_sound
+align 4
+LABELV menu_buzz_sound
+skip 4
+export menu_click_sound
+align 4
+LABELV menu_click_sound
+skip 4
+export menu_switch_sound
+align 4
+LABELV menu_switch_sound
+skip 4
+export menu_move_sound
+align 4
+LABELV menu_move_sound
+skip 4
+import Menu_Focus
+import wop_AutoBindUnusedKeys
+import wop_AutoswitchSongByNextMap
+import con_notifytime
+import s_wop_restarted
+import syc_logo
+import spraycolor
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_createGametype
+import ui_browserHidePrivate
+import ui_browserOnlyHumans
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $969
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $968
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $967
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $966
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $965
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 95
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $964
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $963
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $962
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 95
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $961
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 47
+byte 1 98
+byte 1 103
+byte 1 50
+byte 1 0
+align 1
+LABELV $959
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 98
+byte 1 103
+byte 1 0
+align 1
+LABELV $957
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 98
+byte 1 103
+byte 1 0
+align 1
+LABELV $955
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 111
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 103
+byte 1 0
+align 1
+LABELV $953
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 121
+byte 1 47
+byte 1 98
+byte 1 103
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $951
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 121
+byte 1 47
+byte 1 98
+byte 1 103
+byte 1 0
+align 1
+LABELV $949
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 98
+byte 1 103
+byte 1 0
+align 1
+LABELV $947
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 103
+byte 1 0
+align 1
+LABELV $945
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 98
+byte 1 103
+byte 1 0
+align 1
+LABELV $943
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 103
+byte 1 0
+align 1
+LABELV $941
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 115
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $939
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 101
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 47
+byte 1 101
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $937
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $935
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 112
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $933
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 112
+byte 1 47
+byte 1 66
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 103
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $931
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 47
+byte 1 66
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 103
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $929
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $927
+byte 1 115
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 66
+byte 1 103
+byte 1 0
+align 1
+LABELV $925
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $923
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $921
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 95
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 0
+align 1
+LABELV $919
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 95
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $917
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 51
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $915
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 49
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $913
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 87
+byte 1 111
+byte 1 80
+byte 1 97
+byte 1 115
+byte 1 99
+byte 1 105
+byte 1 105
+byte 1 0
+align 1
+LABELV $883
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 74
+byte 1 80
+byte 1 69
+byte 1 71
+byte 1 10
+byte 1 0
+align 1
+LABELV $880
+byte 1 100
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $845
+byte 1 69
+byte 1 82
+byte 1 82
+byte 1 79
+byte 1 82
+byte 1 58
+byte 1 32
+byte 1 119
+byte 1 114
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 64
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 63
+byte 1 63
+byte 1 63
+byte 1 10
+byte 1 0
+align 1
+LABELV $746
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 95
+byte 1 68
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $657
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 95
+byte 1 65
+byte 1 100
+byte 1 100
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $641
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 95
+byte 1 65
+byte 1 100
+byte 1 100
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $637
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 0
+align 1
+LABELV $281
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $279
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 0
@@ -0,0 +1,1841 @@
+code
+proc UI_RemoveBotsMenu_SetBotNames 1036 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $82
+JUMPV
+LABELV $79
+ADDRGP4 removeBotsMenuInfo+2316
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 removeBotsMenuInfo+2900
+ADDP4
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigString
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $88
+ARGP4
+ADDRLP4 1028
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 removeBotsMenuInfo+2708
+ADDP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 removeBotsMenuInfo+2708
+ADDP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $91
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 removeBotsMenuInfo+2324
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 UI_ModelIcon
+CALLV
+pop
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 removeBotsMenuInfo+1268+72
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $80
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $82
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+GEI4 $95
+ADDRGP4 removeBotsMenuInfo+2316
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ADDRGP4 removeBotsMenuInfo+2312
+INDIRI4
+LTI4 $79
+LABELV $95
+LABELV $78
+endproc UI_RemoveBotsMenu_SetBotNames 1036 12
+proc UI_RemoveBotsMenu_DeleteEvent 8 8
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $97
+ADDRGP4 $96
+JUMPV
+LABELV $97
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 14
+NEI4 $99
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $104
+JUMPV
+LABELV $101
+ADDRGP4 $106
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 removeBotsMenuInfo+2900
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $102
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $104
+ADDRLP4 0
+INDIRI4
+ADDRGP4 removeBotsMenuInfo+2312
+INDIRI4
+LTI4 $101
+ADDRGP4 $100
+JUMPV
+LABELV $99
+ADDRGP4 $106
+ARGP4
+ADDRGP4 removeBotsMenuInfo+2316
+INDIRI4
+ADDRGP4 removeBotsMenuInfo+2320
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 removeBotsMenuInfo+2900
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $100
+ADDRGP4 uis+11424
+CNSTI4 2
+ASGNI4
+ADDRGP4 $112
+ARGP4
+ADDRGP4 $113
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $96
+endproc UI_RemoveBotsMenu_DeleteEvent 8 8
+proc UI_RemoveBotsMenu_BotEvent 0 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $115
+ADDRGP4 $114
+JUMPV
+LABELV $115
+CNSTI4 84
+ADDRGP4 removeBotsMenuInfo+2320
+INDIRI4
+MULI4
+ADDRGP4 removeBotsMenuInfo+764+72
+ADDP4
+ADDRGP4 colorBlack
+ASGNP4
+CNSTI4 84
+ADDRGP4 removeBotsMenuInfo+2320
+INDIRI4
+MULI4
+ADDRGP4 removeBotsMenuInfo+764+80
+ADDP4
+ADDRGP4 colorDkLilac
+ASGNP4
+ADDRGP4 removeBotsMenuInfo+2320
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 20
+SUBI4
+ASGNI4
+CNSTI4 84
+ADDRGP4 removeBotsMenuInfo+2320
+INDIRI4
+MULI4
+ADDRGP4 removeBotsMenuInfo+764+72
+ADDP4
+ADDRGP4 colorDkOrange
+ASGNP4
+CNSTI4 84
+ADDRGP4 removeBotsMenuInfo+2320
+INDIRI4
+MULI4
+ADDRGP4 removeBotsMenuInfo+764+80
+ADDP4
+ADDRGP4 color_orange
+ASGNP4
+LABELV $114
+endproc UI_RemoveBotsMenu_BotEvent 0 0
+proc UI_RemoveBotsMenu_BackEvent 0 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $131
+ADDRGP4 $130
+JUMPV
+LABELV $131
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $130
+endproc UI_RemoveBotsMenu_BackEvent 0 0
+proc UI_RemoveBotsMenu_UpEvent 4 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $134
+ADDRGP4 $133
+JUMPV
+LABELV $134
+ADDRGP4 removeBotsMenuInfo+2316
+INDIRI4
+CNSTI4 0
+LEI4 $136
+ADDRLP4 0
+ADDRGP4 removeBotsMenuInfo+2316
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 UI_RemoveBotsMenu_SetBotNames
+CALLV
+pop
+LABELV $136
+LABELV $133
+endproc UI_RemoveBotsMenu_UpEvent 4 0
+proc UI_RemoveBotsMenu_DownEvent 4 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $141
+ADDRGP4 $140
+JUMPV
+LABELV $141
+ADDRGP4 removeBotsMenuInfo+2316
+INDIRI4
+CNSTI4 6
+ADDI4
+ADDRGP4 removeBotsMenuInfo+2312
+INDIRI4
+GEI4 $143
+ADDRLP4 0
+ADDRGP4 removeBotsMenuInfo+2316
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 UI_RemoveBotsMenu_SetBotNames
+CALLV
+pop
+LABELV $143
+LABELV $140
+endproc UI_RemoveBotsMenu_DownEvent 4 0
+proc UI_RemoveBotsMenu_GetBots 1056 12
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigString
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $149
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1040
+INDIRI4
+ASGNI4
+ADDRGP4 removeBotsMenuInfo+2312
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $154
+JUMPV
+LABELV $151
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigString
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $155
+ARGP4
+ADDRLP4 1044
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1048
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 0
+NEI4 $156
+ADDRGP4 $152
+JUMPV
+LABELV $156
+ADDRGP4 removeBotsMenuInfo+2312
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 removeBotsMenuInfo+2900
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 1052
+ADDRGP4 removeBotsMenuInfo+2312
+ASGNP4
+ADDRLP4 1052
+INDIRP4
+ADDRLP4 1052
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $152
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $154
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1032
+INDIRI4
+LTI4 $151
+LABELV $148
+endproc UI_RemoveBotsMenu_GetBots 1056 12
+export UI_RemoveBots_Cache
+proc UI_RemoveBots_Cache 0 4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $163
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $164
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $165
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $161
+endproc UI_RemoveBots_Cache 0 4
+proc UI_RemoveBotsMenu_Draw 0 20
+ADDRGP4 UI_DrawIngameBG
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 110
+ARGI4
+ADDRGP4 $167
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_black
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRGP4 removeBotsMenuInfo
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+LABELV $166
+endproc UI_RemoveBotsMenu_Draw 0 20
+proc RemoveBotsMenu_Key 24 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 114
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $175
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GTI4 $178
+LABELV $177
+ADDRFP4 0
+INDIRI4
+CNSTI4 82
+EQI4 $175
+ADDRGP4 $169
+JUMPV
+LABELV $178
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 141
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $173
+ADDRLP4 8
+INDIRI4
+CNSTI4 142
+EQI4 $171
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $169
+LABELV $179
+ADDRLP4 16
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 183
+EQI4 $173
+ADDRLP4 16
+INDIRI4
+CNSTI4 184
+EQI4 $171
+ADDRGP4 $169
+JUMPV
+LABELV $171
+ADDRGP4 removeBotsMenuInfo+2096
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 UI_RemoveBotsMenu_UpEvent
+CALLV
+pop
+ADDRGP4 $170
+JUMPV
+LABELV $173
+ADDRGP4 removeBotsMenuInfo+2204
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 UI_RemoveBotsMenu_DownEvent
+CALLV
+pop
+ADDRGP4 $170
+JUMPV
+LABELV $175
+ADDRGP4 removeBotsMenuInfo+1844
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 UI_RemoveBotsMenu_DeleteEvent
+CALLV
+pop
+LABELV $169
+LABELV $170
+ADDRGP4 removeBotsMenuInfo
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 Menu_DefaultKey
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+RETI4
+LABELV $168
+endproc RemoveBotsMenu_Key 24 8
+proc UI_RemoveBotsMenu_Init 44 12
+ADDRGP4 removeBotsMenuInfo
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 6996
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 removeBotsMenuInfo+280
+CNSTI4 0
+ASGNI4
+ADDRGP4 removeBotsMenuInfo+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 removeBotsMenuInfo+268
+ADDRGP4 UI_RemoveBotsMenu_Draw
+ASGNP4
+ADDRGP4 removeBotsMenuInfo+272
+ADDRGP4 RemoveBotsMenu_Key
+ASGNP4
+ADDRGP4 UI_RemoveBots_Cache
+CALLV
+pop
+ADDRGP4 UI_RemoveBotsMenu_GetBots
+CALLV
+pop
+ADDRGP4 UI_RemoveBotsMenu_SetBotNames
+CALLV
+pop
+ADDRGP4 removeBotsMenuInfo+2312
+INDIRI4
+CNSTI4 6
+GEI4 $188
+ADDRLP4 12
+ADDRGP4 removeBotsMenuInfo+2312
+INDIRI4
+ASGNI4
+ADDRGP4 $189
+JUMPV
+LABELV $188
+ADDRLP4 12
+CNSTI4 6
+ASGNI4
+LABELV $189
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 removeBotsMenuInfo+2096
+CNSTI4 11
+ASGNI4
+ADDRGP4 removeBotsMenuInfo+2096+76
+CNSTI4 638
+ASGNI4
+ADDRGP4 removeBotsMenuInfo+2096+80
+CNSTI4 236
+ASGNI4
+ADDRGP4 removeBotsMenuInfo+2096+84
+CNSTI4 29
+ASGNI4
+ADDRGP4 removeBotsMenuInfo+2096+88
+CNSTI4 74
+ASGNI4
+ADDRGP4 $162
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 removeBotsMenuInfo+2096+64
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $163
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 removeBotsMenuInfo+2096+72
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 removeBotsMenuInfo+2096+52
+ADDRGP4 UI_RemoveBotsMenu_UpEvent
+ASGNP4
+ADDRGP4 removeBotsMenuInfo+2096+12
+CNSTI4 10
+ASGNI4
+ADDRGP4 removeBotsMenuInfo+2204
+CNSTI4 11
+ASGNI4
+ADDRGP4 removeBotsMenuInfo+2204+76
+CNSTI4 638
+ASGNI4
+ADDRGP4 removeBotsMenuInfo+2204+80
+CNSTI4 332
+ASGNI4
+ADDRGP4 removeBotsMenuInfo+2204+84
+CNSTI4 29
+ASGNI4
+ADDRGP4 removeBotsMenuInfo+2204+88
+CNSTI4 74
+ASGNI4
+ADDRGP4 $164
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 removeBotsMenuInfo+2204+64
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $165
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 removeBotsMenuInfo+2204+72
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 removeBotsMenuInfo+2204+52
+ADDRGP4 UI_RemoveBotsMenu_DownEvent
+ASGNP4
+ADDRGP4 removeBotsMenuInfo+2204+12
+CNSTI4 11
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 140
+ASGNI4
+ADDRGP4 $227
+JUMPV
+LABELV $224
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 removeBotsMenuInfo+1268
+ADDP4
+CNSTI4 6
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 removeBotsMenuInfo+1268+4
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 removeBotsMenuInfo+2324
+ADDP4
+ASGNP4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 removeBotsMenuInfo+1268+48
+ADDP4
+CNSTU4 16384
+ASGNU4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 removeBotsMenuInfo+1268+16
+ADDP4
+CNSTI4 230
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 removeBotsMenuInfo+1268+20
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 removeBotsMenuInfo+1268+80
+ADDP4
+CNSTI4 20
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 removeBotsMenuInfo+1268+84
+ADDP4
+CNSTI4 20
+ASGNI4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 removeBotsMenuInfo+764
+ADDP4
+CNSTI4 12
+ASGNI4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 removeBotsMenuInfo+764+76
+ADDP4
+CNSTF4 1101004800
+ASGNF4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 removeBotsMenuInfo+764+48
+ADDP4
+CNSTU4 4
+ASGNU4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 removeBotsMenuInfo+764+12
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 20
+ADDI4
+ASGNI4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 removeBotsMenuInfo+764+16
+ADDP4
+CNSTI4 250
+ASGNI4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 removeBotsMenuInfo+764+20
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 removeBotsMenuInfo+764+52
+ADDP4
+ADDRGP4 UI_RemoveBotsMenu_BotEvent
+ASGNP4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 removeBotsMenuInfo+764+64
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 removeBotsMenuInfo+2708
+ADDP4
+ASGNP4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 removeBotsMenuInfo+764+72
+ADDP4
+ADDRGP4 colorBlack
+ASGNP4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 removeBotsMenuInfo+764+80
+ADDP4
+ADDRGP4 colorDkLilac
+ASGNP4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 removeBotsMenuInfo+764+68
+ADDP4
+CNSTI4 16
+ASGNI4
+LABELV $225
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 20
+ADDI4
+ASGNI4
+LABELV $227
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $224
+ADDRGP4 removeBotsMenuInfo+1844
+CNSTI4 12
+ASGNI4
+ADDRGP4 removeBotsMenuInfo+1844+76
+CNSTF4 1103101952
+ASGNF4
+ADDRGP4 removeBotsMenuInfo+1844+48
+CNSTU4 16
+ASGNU4
+ADDRGP4 removeBotsMenuInfo+1844+52
+ADDRGP4 UI_RemoveBotsMenu_DeleteEvent
+ASGNP4
+ADDRGP4 removeBotsMenuInfo+1844+12
+CNSTI4 12
+ASGNI4
+ADDRGP4 removeBotsMenuInfo+1844+16
+CNSTI4 380
+ASGNI4
+ADDRGP4 removeBotsMenuInfo+1844+20
+CNSTI4 280
+ASGNI4
+ADDRGP4 removeBotsMenuInfo+1844+64
+ADDRGP4 $279
+ASGNP4
+ADDRGP4 removeBotsMenuInfo+1844+68
+CNSTI4 18
+ASGNI4
+ADDRGP4 removeBotsMenuInfo+1844+72
+ADDRGP4 color_black
+ASGNP4
+ADDRGP4 removeBotsMenuInfo+1844+80
+ADDRGP4 color_orange
+ASGNP4
+ADDRGP4 removeBotsMenuInfo+1928
+CNSTI4 12
+ASGNI4
+ADDRGP4 removeBotsMenuInfo+1928+76
+CNSTF4 1097229926
+ASGNF4
+ADDRGP4 removeBotsMenuInfo+1928+48
+CNSTU4 16
+ASGNU4
+ADDRGP4 removeBotsMenuInfo+1928+52
+ADDRGP4 UI_RemoveBotsMenu_DeleteEvent
+ASGNP4
+ADDRGP4 removeBotsMenuInfo+1928+12
+CNSTI4 14
+ASGNI4
+ADDRGP4 removeBotsMenuInfo+1928+16
+CNSTI4 380
+ASGNI4
+ADDRGP4 removeBotsMenuInfo+1928+20
+CNSTI4 306
+ASGNI4
+ADDRGP4 removeBotsMenuInfo+1928+64
+ADDRGP4 $301
+ASGNP4
+ADDRGP4 removeBotsMenuInfo+1928+68
+CNSTI4 18
+ASGNI4
+ADDRGP4 removeBotsMenuInfo+1928+72
+ADDRGP4 color_black
+ASGNP4
+ADDRGP4 removeBotsMenuInfo+1928+80
+ADDRGP4 color_orange
+ASGNP4
+ADDRGP4 removeBotsMenuInfo+2012
+CNSTI4 12
+ASGNI4
+ADDRGP4 removeBotsMenuInfo+2012+76
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 removeBotsMenuInfo+2012+52
+ADDRGP4 UI_RemoveBotsMenu_BackEvent
+ASGNP4
+ADDRGP4 removeBotsMenuInfo+2012+12
+CNSTI4 13
+ASGNI4
+ADDRGP4 removeBotsMenuInfo+2012+16
+CNSTI4 245
+ASGNI4
+ADDRGP4 removeBotsMenuInfo+2012+20
+CNSTI4 315
+ASGNI4
+ADDRGP4 removeBotsMenuInfo+2012+64
+ADDRGP4 $321
+ASGNP4
+ADDRGP4 removeBotsMenuInfo+2012+68
+CNSTI4 16
+ASGNI4
+ADDRGP4 removeBotsMenuInfo+2012+72
+ADDRGP4 color_black
+ASGNP4
+ADDRGP4 removeBotsMenuInfo+2012+80
+ADDRGP4 color_orange
+ASGNP4
+ADDRGP4 removeBotsMenuInfo
+ARGP4
+ADDRGP4 removeBotsMenuInfo+2096
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 removeBotsMenuInfo
+ARGP4
+ADDRGP4 removeBotsMenuInfo+2204
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $333
+JUMPV
+LABELV $330
+ADDRGP4 removeBotsMenuInfo
+ARGP4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 removeBotsMenuInfo+764
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 removeBotsMenuInfo
+ARGP4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 removeBotsMenuInfo+1268
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $331
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $333
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $330
+ADDRGP4 removeBotsMenuInfo
+ARGP4
+ADDRGP4 removeBotsMenuInfo+1844
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 removeBotsMenuInfo
+ARGP4
+ADDRGP4 removeBotsMenuInfo+1928
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 removeBotsMenuInfo
+ARGP4
+ADDRGP4 removeBotsMenuInfo+2012
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 removeBotsMenuInfo+2316
+CNSTI4 0
+ASGNI4
+ADDRGP4 removeBotsMenuInfo+2320
+CNSTI4 0
+ASGNI4
+ADDRGP4 removeBotsMenuInfo+764+72
+ADDRGP4 colorDkOrange
+ASGNP4
+ADDRGP4 removeBotsMenuInfo+764+80
+ADDRGP4 color_orange
+ASGNP4
+LABELV $180
+endproc UI_RemoveBotsMenu_Init 44 12
+export UI_RemoveBotsMenu
+proc UI_RemoveBotsMenu 0 4
+ADDRGP4 UI_RemoveBotsMenu_Init
+CALLV
+pop
+ADDRGP4 removeBotsMenuInfo
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $345
+endproc UI_RemoveBotsMenu 0 4
+bss
+align 4
+LABELV removeBotsMenuInfo
+skip 6996
+import UI_HelpMenu_Cache
+import UI_HelpMenu_f
+import UI_HelpMenu
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import UI_InitGameinfo
+import UI_GetNumBots
+import UI_GetBotInfoByNumber
+import UI_GetNumArenas
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_VoiceIngame
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_GetVoiceGainClient
+import trap_GetVoiceMuteAll
+import trap_GetVoiceMuteClient
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_CIN_SetExtents
+import trap_CIN_StopCinematic
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_PlayCinematic
+import trap_RealTime
+import trap_S_StartBackgroundTrack
+import trap_S_StopBackgroundTrack
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_SaveCachedServers
+import trap_LAN_LoadCachedServers
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import BotListCompare
+import uis
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString2
+import UI_AutoWrappedString_LineCount
+import UI_DrawString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawIngameBG
+import UI_DrawStringNS
+import UI_ModelIcon
+import UI_DrawHandlePic1024
+import UI_AdjustFrom1024
+import UI_StopMusic
+import UI_StartCreditMusic
+import UI_StartMusic
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_ClearModelCache
+import UI_PrecacheClientModelname
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import UI_SpecifyPasswordMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import Demos_Cache
+import UI_DemosMenu
+import SetDefaultBinds_onUnusedKeys
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import SetupDefaultMenu_Cache
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import Music_NextTrack
+import Music_TriggerRestart
+import Music_Check
+import MusicMenu_Cache
+import MusicMenu_Open
+import MusicMenu_Shutdown
+import MusicMenu_Init
+import UI_CallVoteMenu
+import UI_InGameMenu
+import InGame_Cache
+import UI_SecretMenu
+import UI_InitBigCredits
+import UI_BigCredits_Cache
+import UI_CreditMenu
+import ExitMenu_Cache
+import ExitMenu_Init
+import UI_MainMenu
+import MainMenu_Cache
+import UI_UpdateCvars
+import UI_RegisterCvars
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import listbar_bluecolor
+import text_color_bluehighlight
+import text_color_bluenormal
+import text_color_ighighlight
+import text_color_ignormal
+import listbar_igcolor
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_lightOrange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_click_sound
+import menu_switch_sound
+import menu_move_sound
+import ScrollList_Key
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import wop_AutoBindUnusedKeys
+import wop_AutoswitchSongByNextMap
+import con_notifytime
+import s_wop_restarted
+import syc_logo
+import spraycolor
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_createGametype
+import ui_browserHidePrivate
+import ui_browserOnlyHumans
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $321
+byte 1 66
+byte 1 65
+byte 1 67
+byte 1 75
+byte 1 0
+align 1
+LABELV $301
+byte 1 82
+byte 1 69
+byte 1 77
+byte 1 79
+byte 1 86
+byte 1 69
+byte 1 32
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 0
+align 1
+LABELV $279
+byte 1 82
+byte 1 69
+byte 1 77
+byte 1 79
+byte 1 86
+byte 1 69
+byte 1 0
+align 1
+LABELV $167
+byte 1 82
+byte 1 69
+byte 1 77
+byte 1 79
+byte 1 86
+byte 1 69
+byte 1 32
+byte 1 66
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 0
+align 1
+LABELV $165
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 49
+byte 1 0
+align 1
+LABELV $164
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 48
+byte 1 0
+align 1
+LABELV $163
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 117
+byte 1 112
+byte 1 49
+byte 1 0
+align 1
+LABELV $162
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 117
+byte 1 112
+byte 1 48
+byte 1 0
+align 1
+LABELV $155
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $149
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $113
+byte 1 48
+byte 1 0
+align 1
+LABELV $112
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $106
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $91
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $88
+byte 1 110
+byte 1 0
@@ -0,0 +1,1653 @@
+data
+align 4
+LABELV serverinfo_artlist
+address $77
+address $78
+address $79
+address $80
+byte 4 0
+code
+proc Favorites_Add 280 12
+ADDRGP4 $83
+ARGP4
+ADDRLP4 136
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 136
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $84
+ADDRGP4 $82
+JUMPV
+LABELV $84
+ADDRLP4 264
+CNSTI4 0
+ASGNI4
+ADDRLP4 132
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 264
+INDIRI4
+ASGNI4
+LABELV $86
+ADDRGP4 $90
+ARGP4
+ADDRLP4 128
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 268
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 136
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 272
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+NEI4 $91
+ADDRGP4 $82
+JUMPV
+LABELV $91
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $93
+ADDRLP4 132
+ADDRLP4 128
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $88
+JUMPV
+LABELV $93
+ADDRLP4 276
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 48
+LTI4 $97
+ADDRLP4 276
+INDIRI4
+CNSTI4 57
+LEI4 $95
+LABELV $97
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $95
+ADDRLP4 132
+ADDRLP4 128
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $95
+LABELV $87
+ADDRLP4 128
+ADDRLP4 128
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 16
+LTI4 $86
+LABELV $88
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+EQI4 $98
+ADDRGP4 $90
+ARGP4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRLP4 268
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ARGP4
+ADDRLP4 136
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $98
+LABELV $82
+endproc Favorites_Add 280 12
+proc ServerInfo_Event 16 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 100
+LTI4 $101
+ADDRLP4 0
+INDIRI4
+CNSTI4 103
+GTI4 $101
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $126-400
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $126
+address $104
+address $107
+address $110
+address $117
+code
+LABELV $104
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $105
+ADDRGP4 $102
+JUMPV
+LABELV $105
+ADDRGP4 Favorites_Add
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $102
+JUMPV
+LABELV $107
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $108
+ADDRGP4 $102
+JUMPV
+LABELV $108
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $102
+JUMPV
+LABELV $110
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $111
+ADDRGP4 $102
+JUMPV
+LABELV $111
+ADDRGP4 s_serverinfo+1708
+INDIRI4
+CNSTI4 0
+LEI4 $102
+ADDRLP4 8
+ADDRGP4 s_serverinfo+1708
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $102
+JUMPV
+LABELV $117
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $118
+ADDRGP4 $102
+JUMPV
+LABELV $118
+ADDRGP4 s_serverinfo+1708
+INDIRI4
+ADDRGP4 s_serverinfo+1712
+INDIRI4
+ADDI4
+ADDRGP4 s_serverinfo+1704
+INDIRI4
+GEI4 $102
+ADDRLP4 12
+ADDRGP4 s_serverinfo+1708
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $101
+LABELV $102
+LABELV $100
+endproc ServerInfo_Event 16 0
+proc ServerInfo_MenuDraw 2092 20
+ADDRLP4 2064
+CNSTI4 0
+ASGNI4
+ADDRLP4 2068
+CNSTI4 -1
+ASGNI4
+ADDRGP4 UI_DrawIngameBG
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 110
+ARGI4
+ADDRGP4 $129
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_black
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 140
+ASGNI4
+ADDRLP4 2060
+ADDRGP4 s_serverinfo+680
+ASGNP4
+ADDRGP4 s_serverinfo+1712
+CNSTI4 0
+ASGNI4
+ADDRGP4 $133
+JUMPV
+LABELV $132
+ADDRLP4 2064
+ADDRLP4 2064
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 2060
+ARGP4
+ADDRLP4 1032
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Info_NextPair
+CALLV
+pop
+ADDRLP4 1032
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $136
+ADDRGP4 $134
+JUMPV
+LABELV $136
+ADDRLP4 2068
+ADDRLP4 2068
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 s_serverinfo+1708
+INDIRI4
+ADDRLP4 2068
+INDIRI4
+LEI4 $138
+ADDRGP4 $133
+JUMPV
+LABELV $138
+ADDRLP4 0
+INDIRI4
+CNSTI4 260
+LEI4 $141
+ADDRGP4 $134
+JUMPV
+LABELV $141
+ADDRLP4 1032
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $143
+ARGP4
+ADDRLP4 1032
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 1032
+ARGP4
+ADDRLP4 2072
+ADDRGP4 Q_PrintStrlen
+CALLI4
+ASGNI4
+ADDRLP4 2056
+ADDRLP4 2072
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 2076
+ADDRGP4 Q_PrintStrlen
+CALLI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 2076
+INDIRI4
+ASGNI4
+ADDRLP4 2056
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+ADDI4
+CNSTI4 20
+GEI4 $144
+CNSTI4 230
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1032
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 color_black
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 2056
+INDIRI4
+CNSTI4 3
+LSHI4
+CNSTI4 230
+ADDI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 color_blue
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 2080
+ADDRGP4 s_serverinfo+1712
+ASGNP4
+ADDRLP4 2080
+INDIRP4
+ADDRLP4 2080
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $145
+JUMPV
+LABELV $144
+CNSTI4 230
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1032
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 color_black
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 2080
+CNSTI4 0
+ASGNI4
+ADDRGP4 $150
+JUMPV
+LABELV $147
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 260
+LEI4 $151
+ADDRGP4 $149
+JUMPV
+LABELV $151
+ADDRGP4 $153
+ARGP4
+ADDRLP4 2080
+INDIRI4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRLP4 2084
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 230
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 2084
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 color_blue
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 2088
+ADDRGP4 s_serverinfo+1712
+ASGNP4
+ADDRLP4 2088
+INDIRP4
+ADDRLP4 2088
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $148
+ADDRLP4 2080
+ADDRLP4 2080
+INDIRI4
+CNSTI4 20
+ADDI4
+ASGNI4
+LABELV $150
+ADDRLP4 2080
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $147
+LABELV $149
+LABELV $145
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+LABELV $133
+ADDRLP4 2060
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $155
+ADDRLP4 2064
+INDIRI4
+ADDRGP4 s_serverinfo+1704
+INDIRI4
+LTI4 $132
+LABELV $155
+LABELV $134
+ADDRGP4 s_serverinfo
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+LABELV $128
+endproc ServerInfo_MenuDraw 2092 20
+proc ServerInfo_MenuKey 16 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 141
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $161
+ADDRLP4 0
+INDIRI4
+CNSTI4 142
+EQI4 $159
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $157
+LABELV $163
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 183
+EQI4 $161
+ADDRLP4 8
+INDIRI4
+CNSTI4 184
+EQI4 $159
+ADDRGP4 $157
+JUMPV
+LABELV $159
+ADDRGP4 s_serverinfo+296
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 ServerInfo_Event
+CALLV
+pop
+ADDRGP4 $158
+JUMPV
+LABELV $161
+ADDRGP4 s_serverinfo+404
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 ServerInfo_Event
+CALLV
+pop
+LABELV $157
+LABELV $158
+ADDRGP4 s_serverinfo
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 Menu_DefaultKey
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $156
+endproc ServerInfo_MenuKey 16 8
+export ServerInfo_Cache
+proc ServerInfo_Cache 4 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $165
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 serverinfo_artlist
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $169
+ADDRGP4 $167
+JUMPV
+LABELV $169
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 serverinfo_artlist
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $166
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $165
+JUMPV
+LABELV $167
+LABELV $164
+endproc ServerInfo_Cache 4 4
+export UI_ServerInfoMenu
+proc UI_ServerInfoMenu 2076 12
+ADDRGP4 s_serverinfo
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1716
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 ServerInfo_Cache
+CALLV
+pop
+ADDRGP4 s_serverinfo+268
+ADDRGP4 ServerInfo_MenuDraw
+ASGNP4
+ADDRGP4 s_serverinfo+272
+ADDRGP4 ServerInfo_MenuKey
+ASGNP4
+ADDRGP4 s_serverinfo+296
+CNSTI4 11
+ASGNI4
+ADDRGP4 s_serverinfo+296+76
+CNSTI4 630
+ASGNI4
+ADDRGP4 s_serverinfo+296+80
+CNSTI4 226
+ASGNI4
+ADDRGP4 s_serverinfo+296+84
+CNSTI4 29
+ASGNI4
+ADDRGP4 s_serverinfo+296+88
+CNSTI4 74
+ASGNI4
+ADDRGP4 $77
+ARGP4
+ADDRLP4 2052
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_serverinfo+296+64
+ADDRLP4 2052
+INDIRI4
+ASGNI4
+ADDRGP4 $78
+ARGP4
+ADDRLP4 2056
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_serverinfo+296+72
+ADDRLP4 2056
+INDIRI4
+ASGNI4
+ADDRGP4 s_serverinfo+296+52
+ADDRGP4 ServerInfo_Event
+ASGNP4
+ADDRGP4 s_serverinfo+296+12
+CNSTI4 102
+ASGNI4
+ADDRGP4 s_serverinfo
+ARGP4
+ADDRGP4 s_serverinfo+296
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serverinfo+404
+CNSTI4 11
+ASGNI4
+ADDRGP4 s_serverinfo+404+76
+CNSTI4 630
+ASGNI4
+ADDRGP4 s_serverinfo+404+80
+CNSTI4 362
+ASGNI4
+ADDRGP4 s_serverinfo+404+84
+CNSTI4 29
+ASGNI4
+ADDRGP4 s_serverinfo+404+88
+CNSTI4 74
+ASGNI4
+ADDRGP4 $79
+ARGP4
+ADDRLP4 2060
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_serverinfo+404+64
+ADDRLP4 2060
+INDIRI4
+ASGNI4
+ADDRGP4 $80
+ARGP4
+ADDRLP4 2064
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_serverinfo+404+72
+ADDRLP4 2064
+INDIRI4
+ASGNI4
+ADDRGP4 s_serverinfo+404+52
+ADDRGP4 ServerInfo_Event
+ASGNP4
+ADDRGP4 s_serverinfo+404+12
+CNSTI4 103
+ASGNI4
+ADDRGP4 s_serverinfo
+ARGP4
+ADDRGP4 s_serverinfo+404
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serverinfo+596
+CNSTI4 12
+ASGNI4
+ADDRGP4 s_serverinfo+596+76
+CNSTF4 1099956224
+ASGNF4
+ADDRGP4 s_serverinfo+596+48
+CNSTU4 8
+ASGNU4
+ADDRGP4 s_serverinfo+596+52
+ADDRGP4 ServerInfo_Event
+ASGNP4
+ADDRGP4 s_serverinfo+596+12
+CNSTI4 100
+ASGNI4
+ADDRGP4 s_serverinfo+596+16
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_serverinfo+596+20
+CNSTI4 290
+ASGNI4
+ADDRGP4 s_serverinfo+596+64
+ADDRGP4 $225
+ASGNP4
+ADDRGP4 s_serverinfo+596+68
+CNSTI4 17
+ASGNI4
+ADDRGP4 s_serverinfo+596+72
+ADDRGP4 colorDkBlue
+ASGNP4
+ADDRGP4 s_serverinfo+596+80
+ADDRGP4 colorBlue
+ASGNP4
+ADDRGP4 $234
+ARGP4
+ADDRLP4 2068
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 2068
+INDIRF4
+CNSTF4 0
+EQF4 $232
+ADDRLP4 2072
+ADDRGP4 s_serverinfo+596+48
+ASGNP4
+ADDRLP4 2072
+INDIRP4
+ADDRLP4 2072
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+LABELV $232
+ADDRGP4 s_serverinfo+512
+CNSTI4 12
+ASGNI4
+ADDRGP4 s_serverinfo+512+76
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 s_serverinfo+512+52
+ADDRGP4 ServerInfo_Event
+ASGNP4
+ADDRGP4 s_serverinfo+512+12
+CNSTI4 101
+ASGNI4
+ADDRGP4 s_serverinfo+512+16
+CNSTI4 245
+ASGNI4
+ADDRGP4 s_serverinfo+512+20
+CNSTI4 315
+ASGNI4
+ADDRGP4 s_serverinfo+512+64
+ADDRGP4 $250
+ASGNP4
+ADDRGP4 s_serverinfo+512+68
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_serverinfo+512+72
+ADDRGP4 color_black
+ASGNP4
+ADDRGP4 s_serverinfo+512+80
+ADDRGP4 color_orange
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRGP4 s_serverinfo+680
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigString
+CALLI4
+pop
+ADDRGP4 s_serverinfo+1704
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 s_serverinfo+680
+ASGNP4
+ADDRGP4 $261
+JUMPV
+LABELV $260
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1028
+ARGP4
+ADDRGP4 Info_NextPair
+CALLV
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $263
+ADDRGP4 $262
+JUMPV
+LABELV $263
+ADDRLP4 2072
+ADDRGP4 s_serverinfo+1704
+ASGNP4
+ADDRLP4 2072
+INDIRP4
+ADDRLP4 2072
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $261
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $260
+LABELV $262
+ADDRGP4 s_serverinfo
+ARGP4
+ADDRGP4 s_serverinfo+596
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serverinfo
+ARGP4
+ADDRGP4 s_serverinfo+512
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serverinfo
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $171
+endproc UI_ServerInfoMenu 2076 12
+bss
+align 4
+LABELV s_serverinfo
+skip 1716
+import UI_HelpMenu_Cache
+import UI_HelpMenu_f
+import UI_HelpMenu
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import UI_InitGameinfo
+import UI_GetNumBots
+import UI_GetBotInfoByNumber
+import UI_GetNumArenas
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_VoiceIngame
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_GetVoiceGainClient
+import trap_GetVoiceMuteAll
+import trap_GetVoiceMuteClient
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_CIN_SetExtents
+import trap_CIN_StopCinematic
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_PlayCinematic
+import trap_RealTime
+import trap_S_StartBackgroundTrack
+import trap_S_StopBackgroundTrack
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_SaveCachedServers
+import trap_LAN_LoadCachedServers
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import BotListCompare
+import uis
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString2
+import UI_AutoWrappedString_LineCount
+import UI_DrawString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawIngameBG
+import UI_DrawStringNS
+import UI_ModelIcon
+import UI_DrawHandlePic1024
+import UI_AdjustFrom1024
+import UI_StopMusic
+import UI_StartCreditMusic
+import UI_StartMusic
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_ClearModelCache
+import UI_PrecacheClientModelname
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import UI_SpecifyPasswordMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import Demos_Cache
+import UI_DemosMenu
+import SetDefaultBinds_onUnusedKeys
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import SetupDefaultMenu_Cache
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import Music_NextTrack
+import Music_TriggerRestart
+import Music_Check
+import MusicMenu_Cache
+import MusicMenu_Open
+import MusicMenu_Shutdown
+import MusicMenu_Init
+import UI_CallVoteMenu
+import UI_InGameMenu
+import InGame_Cache
+import UI_SecretMenu
+import UI_InitBigCredits
+import UI_BigCredits_Cache
+import UI_CreditMenu
+import ExitMenu_Cache
+import ExitMenu_Init
+import UI_MainMenu
+import MainMenu_Cache
+import UI_UpdateCvars
+import UI_RegisterCvars
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import listbar_bluecolor
+import text_color_bluehighlight
+import text_color_bluenormal
+import text_color_ighighlight
+import text_color_ignormal
+import listbar_igcolor
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_lightOrange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_click_sound
+import menu_switch_sound
+import menu_move_sound
+import ScrollList_Key
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import wop_AutoBindUnusedKeys
+import wop_AutoswitchSongByNextMap
+import con_notifytime
+import s_wop_restarted
+import syc_logo
+import spraycolor
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_createGametype
+import ui_browserHidePrivate
+import ui_browserOnlyHumans
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $250
+byte 1 66
+byte 1 65
+byte 1 67
+byte 1 75
+byte 1 0
+align 1
+LABELV $234
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $225
+byte 1 65
+byte 1 68
+byte 1 68
+byte 1 32
+byte 1 84
+byte 1 79
+byte 1 32
+byte 1 70
+byte 1 65
+byte 1 86
+byte 1 79
+byte 1 82
+byte 1 105
+byte 1 84
+byte 1 69
+byte 1 83
+byte 1 0
+align 1
+LABELV $153
+byte 1 37
+byte 1 50
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 0
+align 1
+LABELV $143
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 0
+align 1
+LABELV $129
+byte 1 83
+byte 1 69
+byte 1 82
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 73
+byte 1 78
+byte 1 70
+byte 1 79
+byte 1 0
+align 1
+LABELV $90
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $83
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 65
+byte 1 100
+byte 1 100
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $80
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 49
+byte 1 0
+align 1
+LABELV $79
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 48
+byte 1 0
+align 1
+LABELV $78
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 117
+byte 1 112
+byte 1 49
+byte 1 0
+align 1
+LABELV $77
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 117
+byte 1 112
+byte 1 48
+byte 1 0
@@ -0,0 +1,8448 @@
+data
+align 1
+LABELV global_names
+byte 1 0
+skip 18
+skip 76
+align 4
+LABELV master_items
+address $79
+address $80
+skip 24
+align 4
+LABELV servertype_items
+address $81
+address $82
+address $83
+address $84
+address $85
+address $86
+address $87
+address $88
+byte 4 0
+align 4
+LABELV sortkey_items
+address $89
+address $90
+address $91
+address $92
+address $93
+address $94
+byte 4 0
+align 4
+LABELV gamenames
+address $95
+address $96
+address $97
+address $98
+address $99
+address $100
+address $101
+address $102
+address $103
+address $104
+byte 4 0
+align 1
+LABELV quake3worldMessage
+byte 1 86
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 111
+byte 1 102
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 46
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 78
+byte 1 101
+byte 1 119
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 67
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 117
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 44
+byte 1 32
+byte 1 69
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+code
+proc ServerCleanName 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $112
+JUMPV
+LABELV $109
+LABELV $110
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $112
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+EQI4 $109
+ADDRGP4 $116
+JUMPV
+LABELV $113
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+NEI4 $117
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LEI4 $119
+ADDRGP4 $114
+JUMPV
+LABELV $119
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $118
+JUMPV
+LABELV $117
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $121
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $121
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_IsColorString
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $123
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $114
+JUMPV
+LABELV $123
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $122
+JUMPV
+LABELV $121
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $122
+LABELV $118
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 32
+LTI4 $128
+ADDRLP4 20
+INDIRI4
+CNSTI4 125
+GTI4 $128
+ADDRLP4 20
+INDIRI4
+CNSTI4 96
+NEI4 $125
+LABELV $128
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $114
+JUMPV
+LABELV $125
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+NEI4 $129
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $129
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $114
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $116
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $131
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+LTI4 $113
+LABELV $131
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 16
+INDIRI4
+EQI4 $135
+ADDRLP4 8
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $135
+ADDRLP4 12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $132
+LABELV $135
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $136
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $132
+LABELV $108
+endproc ServerCleanName 28 12
+proc ArenaServers_MaxPing 8 4
+ADDRGP4 $138
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 100
+GEI4 $139
+ADDRLP4 0
+CNSTI4 100
+ASGNI4
+LABELV $139
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $137
+endproc ArenaServers_MaxPing 8 4
+proc ArenaServers_Compare 72 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 g_sortkey
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $142
+ADDRLP4 16
+INDIRI4
+CNSTI4 5
+GTI4 $142
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $170
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $170
+address $144
+address $145
+address $146
+address $160
+address $165
+address $155
+code
+LABELV $144
+ADDRLP4 20
+CNSTI4 64
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+RETI4
+ADDRGP4 $141
+JUMPV
+LABELV $145
+ADDRLP4 28
+CNSTI4 98
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+RETI4
+ADDRGP4 $141
+JUMPV
+LABELV $146
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 36
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+GEF4 $147
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+LABELV $147
+ADDRLP4 40
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 40
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 0
+GEF4 $149
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+LABELV $149
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+GEF4 $151
+CNSTI4 1
+RETI4
+ADDRGP4 $141
+JUMPV
+LABELV $151
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+NEF4 $153
+CNSTI4 0
+RETI4
+ADDRGP4 $141
+JUMPV
+LABELV $153
+CNSTI4 -1
+RETI4
+ADDRGP4 $141
+JUMPV
+LABELV $155
+ADDRLP4 44
+CNSTI4 136
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+GEF4 $156
+CNSTI4 1
+RETI4
+ADDRGP4 $141
+JUMPV
+LABELV $156
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+NEF4 $158
+CNSTI4 0
+RETI4
+ADDRGP4 $141
+JUMPV
+LABELV $158
+CNSTI4 -1
+RETI4
+ADDRGP4 $141
+JUMPV
+LABELV $160
+ADDRLP4 48
+CNSTI4 152
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRI4
+GEI4 $161
+CNSTI4 -1
+RETI4
+ADDRGP4 $141
+JUMPV
+LABELV $161
+ADDRLP4 52
+CNSTI4 152
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $163
+CNSTI4 0
+RETI4
+ADDRGP4 $141
+JUMPV
+LABELV $163
+CNSTI4 1
+RETI4
+ADDRGP4 $141
+JUMPV
+LABELV $165
+ADDRLP4 56
+CNSTI4 148
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRI4
+GEI4 $166
+CNSTI4 -1
+RETI4
+ADDRGP4 $141
+JUMPV
+LABELV $166
+ADDRLP4 60
+CNSTI4 148
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRI4
+LEI4 $168
+CNSTI4 1
+RETI4
+ADDRGP4 $141
+JUMPV
+LABELV $168
+ADDRLP4 64
+CNSTI4 64
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+RETI4
+ADDRGP4 $141
+JUMPV
+LABELV $142
+CNSTI4 0
+RETI4
+LABELV $141
+endproc ArenaServers_Compare 72 8
+proc ArenaServers_Go 8 8
+ADDRLP4 0
+CNSTI4 80
+ADDRGP4 g_arenaservers+928+68
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+2224+76
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $176
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $178
+ADDRGP4 $180
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRGP4 UI_SpecifyPasswordMenu
+CALLV
+pop
+ADDRGP4 $179
+JUMPV
+LABELV $178
+ADDRGP4 $180
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $179
+LABELV $176
+LABELV $171
+endproc ArenaServers_Go 8 8
+bss
+align 1
+LABELV $182
+skip 64
+code
+proc ArenaServers_UpdatePicture 4 16
+ADDRGP4 g_arenaservers+928+72
+INDIRI4
+CNSTI4 0
+NEI4 $183
+ADDRGP4 g_arenaservers+1048+4
+CNSTP4 0
+ASGNP4
+ADDRGP4 $184
+JUMPV
+LABELV $183
+ADDRLP4 0
+CNSTI4 80
+ADDRGP4 g_arenaservers+928+68
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+2224+76
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $182
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $193
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 98
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 g_arenaservers+1048+4
+ADDRGP4 $182
+ASGNP4
+LABELV $184
+ADDRGP4 g_arenaservers+1048+72
+CNSTI4 0
+ASGNI4
+LABELV $181
+endproc ArenaServers_UpdatePicture 4 16
+proc ArenaServers_UpdateMenu 88 56
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+88240
+INDIRI4
+ADDRLP4 36
+INDIRI4
+GTI4 $203
+ADDRGP4 g_arenaservers+88244
+INDIRP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LEI4 $199
+LABELV $203
+ADDRGP4 g_arenaservers+88256
+INDIRI4
+CNSTI4 0
+EQI4 $204
+ADDRGP4 g_arenaservers+88252
+INDIRI4
+ADDRGP4 g_arenaservers+88240
+INDIRI4
+GTI4 $204
+ADDRGP4 g_arenaservers+88240
+INDIRI4
+CNSTI4 0
+LEI4 $209
+ADDRGP4 g_arenaservers+1360+64
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $214
+ARGP4
+ADDRGP4 g_arenaservers+88252
+INDIRI4
+ARGI4
+ADDRGP4 g_arenaservers+88240
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $210
+JUMPV
+LABELV $209
+ADDRGP4 g_arenaservers+1360+64
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $210
+ADDRGP4 g_arenaservers+1444+64
+ADDRGP4 $222
+ASGNP4
+ADDRGP4 $200
+JUMPV
+LABELV $204
+ADDRLP4 40
+ADDRGP4 g_arenaservers+296+48
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 44
+ADDRGP4 g_arenaservers+416+48
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 48
+ADDRGP4 g_arenaservers+536+48
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 52
+ADDRGP4 g_arenaservers+724+48
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 56
+ADDRGP4 g_arenaservers+792+48
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 60
+ADDRGP4 g_arenaservers+860+48
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 64
+ADDRGP4 g_arenaservers+656+48
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 68
+ADDRGP4 g_arenaservers+928+48
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 72
+ADDRGP4 g_arenaservers+1900+48
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 76
+ADDRGP4 g_arenaservers+2116+48
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 80
+ADDRGP4 g_servertype
+INDIRI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 2
+LTI4 $243
+ADDRLP4 80
+INDIRI4
+CNSTI4 6
+GTI4 $243
+ADDRGP4 g_arenaservers+1444+64
+ADDRGP4 quake3worldMessage
+ASGNP4
+ADDRGP4 $244
+JUMPV
+LABELV $243
+ADDRGP4 g_arenaservers+1444+64
+ADDRGP4 $249
+ASGNP4
+LABELV $244
+ADDRGP4 g_arenaservers+1360+64
+INDIRP4
+ARGP4
+ADDRGP4 $252
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $200
+JUMPV
+LABELV $199
+ADDRGP4 g_arenaservers+88256
+INDIRI4
+CNSTI4 0
+EQI4 $253
+ADDRGP4 g_arenaservers+1360+64
+INDIRP4
+ARGP4
+ADDRGP4 $219
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 g_arenaservers+1444+64
+ADDRGP4 $222
+ASGNP4
+ADDRLP4 40
+ADDRGP4 g_arenaservers+296+48
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 44
+ADDRGP4 g_arenaservers+416+48
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 48
+ADDRGP4 g_arenaservers+536+48
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 52
+ADDRGP4 g_arenaservers+724+48
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 56
+ADDRGP4 g_arenaservers+792+48
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 60
+ADDRGP4 g_arenaservers+860+48
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 64
+ADDRGP4 g_arenaservers+656+48
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 68
+ADDRGP4 g_arenaservers+928+48
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 72
+ADDRGP4 g_arenaservers+1900+48
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 76
+ADDRGP4 g_arenaservers+2116+48
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRGP4 $254
+JUMPV
+LABELV $253
+ADDRGP4 g_arenaservers+88240
+INDIRI4
+CNSTI4 0
+GEI4 $280
+ADDRGP4 g_arenaservers+1360+64
+INDIRP4
+ARGP4
+ADDRGP4 $285
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $281
+JUMPV
+LABELV $280
+ADDRGP4 g_arenaservers+1360+64
+INDIRP4
+ARGP4
+ADDRGP4 $288
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $281
+ADDRLP4 40
+ADDRGP4 g_servertype
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+LTI4 $289
+ADDRLP4 40
+INDIRI4
+CNSTI4 6
+GTI4 $289
+ADDRGP4 g_arenaservers+1444+64
+ADDRGP4 quake3worldMessage
+ASGNP4
+ADDRGP4 $290
+JUMPV
+LABELV $289
+ADDRGP4 g_arenaservers+1444+64
+ADDRGP4 $249
+ASGNP4
+LABELV $290
+ADDRLP4 44
+ADDRGP4 g_arenaservers+296+48
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 48
+ADDRGP4 g_arenaservers+416+48
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 52
+ADDRGP4 g_arenaservers+536+48
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 56
+ADDRGP4 g_arenaservers+724+48
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 60
+ADDRGP4 g_arenaservers+792+48
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 64
+ADDRGP4 g_arenaservers+860+48
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 68
+ADDRGP4 g_arenaservers+656+48
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 72
+ADDRGP4 g_arenaservers+928+48
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 76
+ADDRGP4 g_arenaservers+1900+48
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 80
+ADDRGP4 g_arenaservers+2116+48
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+LABELV $254
+ADDRGP4 g_arenaservers+928+72
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+928+68
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+928+76
+CNSTI4 0
+ASGNI4
+ADDRGP4 ArenaServers_UpdatePicture
+CALLV
+pop
+ADDRGP4 $198
+JUMPV
+LABELV $200
+ADDRLP4 0
+ADDRGP4 g_arenaservers+88248
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRGP4 g_arenaservers+88244
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $326
+JUMPV
+LABELV $323
+ADDRLP4 4
+CNSTI4 80
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+2224
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_emptyservers
+INDIRI4
+ADDRLP4 44
+INDIRI4
+NEI4 $328
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+NEI4 $328
+ADDRGP4 $324
+JUMPV
+LABELV $328
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_emptyservers
+INDIRI4
+ADDRLP4 48
+INDIRI4
+NEI4 $330
+ADDRGP4 g_onlyhumans
+INDIRI4
+ADDRLP4 48
+INDIRI4
+EQI4 $330
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+NEI4 $330
+ADDRGP4 $324
+JUMPV
+LABELV $330
+ADDRGP4 g_fullservers
+INDIRI4
+CNSTI4 0
+NEI4 $332
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+NEI4 $332
+ADDRGP4 $324
+JUMPV
+LABELV $332
+ADDRLP4 56
+ADDRGP4 g_gametype
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+LTI4 $334
+ADDRLP4 56
+INDIRI4
+CNSTI4 7
+GTI4 $334
+ADDRLP4 56
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $358
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $358
+address $335
+address $337
+address $340
+address $343
+address $346
+address $349
+address $352
+address $355
+code
+LABELV $337
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $335
+ADDRGP4 $324
+JUMPV
+LABELV $340
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $335
+ADDRGP4 $324
+JUMPV
+LABELV $343
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+CNSTI4 4
+EQI4 $335
+ADDRGP4 $324
+JUMPV
+LABELV $346
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $335
+ADDRGP4 $324
+JUMPV
+LABELV $349
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+CNSTI4 6
+EQI4 $335
+ADDRGP4 $324
+JUMPV
+LABELV $352
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+CNSTI4 7
+EQI4 $335
+ADDRGP4 $324
+JUMPV
+LABELV $355
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+CNSTI4 8
+EQI4 $335
+ADDRGP4 $324
+JUMPV
+LABELV $334
+LABELV $335
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_hideprivate
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $359
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $359
+ADDRGP4 $324
+JUMPV
+LABELV $359
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+GEI4 $361
+ADDRLP4 16
+ADDRGP4 $363
+ASGNP4
+ADDRGP4 $362
+JUMPV
+LABELV $361
+ADDRLP4 72
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $364
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+LEI4 $364
+ADDRLP4 16
+ADDRGP4 $363
+ASGNP4
+ADDRGP4 $365
+JUMPV
+LABELV $364
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 100
+GEI4 $366
+ADDRLP4 16
+ADDRGP4 $368
+ASGNP4
+ADDRGP4 $367
+JUMPV
+LABELV $366
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 200
+GEI4 $369
+ADDRLP4 16
+ADDRGP4 $371
+ASGNP4
+ADDRGP4 $370
+JUMPV
+LABELV $369
+ADDRLP4 16
+ADDRGP4 $372
+ASGNP4
+LABELV $370
+LABELV $367
+LABELV $365
+LABELV $362
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+LTI4 $373
+ADDRLP4 20
+ADDRGP4 $372
+ASGNP4
+ADDRGP4 $374
+JUMPV
+LABELV $373
+ADDRLP4 20
+ADDRGP4 $371
+ASGNP4
+LABELV $374
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $375
+ADDRLP4 24
+ADDRGP4 $372
+ASGNP4
+ADDRGP4 $376
+JUMPV
+LABELV $375
+ADDRLP4 24
+ADDRGP4 $371
+ASGNP4
+LABELV $376
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $377
+ADDRLP4 28
+ADDRGP4 $379
+ASGNP4
+ADDRGP4 $378
+JUMPV
+LABELV $377
+ADDRLP4 28
+ADDRGP4 $371
+ASGNP4
+LABELV $378
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 76
+ARGI4
+ADDRGP4 $380
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 98
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $324
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ASGNP4
+LABELV $326
+ADDRLP4 12
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LTI4 $323
+ADDRGP4 g_arenaservers+928+72
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+928+68
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+928+76
+CNSTI4 0
+ASGNI4
+ADDRGP4 ArenaServers_UpdatePicture
+CALLV
+pop
+LABELV $198
+endproc ArenaServers_UpdateMenu 88 56
+proc ArenaServers_Remove 28 12
+ADDRGP4 g_arenaservers+928+72
+INDIRI4
+CNSTI4 0
+NEI4 $388
+ADDRGP4 $387
+JUMPV
+LABELV $388
+ADDRLP4 8
+CNSTI4 80
+ADDRGP4 g_arenaservers+928+68
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+2224
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $398
+JUMPV
+LABELV $395
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+88272
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $400
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_arenaservers+89296
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $403
+ADDRLP4 20
+CNSTI4 6
+ASGNI4
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 g_arenaservers+88272
+ADDP4
+ARGP4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 g_arenaservers+88272+64
+ADDP4
+ARGP4
+ADDRGP4 g_arenaservers+89296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+CNSTI4 64
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $403
+ADDRLP4 16
+ADDRGP4 g_arenaservers+89296
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 g_arenaservers+89296
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+88272
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 64
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $400
+LABELV $396
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $398
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_arenaservers+89296
+INDIRI4
+LTI4 $395
+LABELV $397
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $416
+JUMPV
+LABELV $413
+CNSTI4 192
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_favoriteserverlist
+ADDP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+NEU4 $417
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $419
+ADDRLP4 16
+CNSTI4 192
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 g_favoriteserverlist
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 g_favoriteserverlist+192
+ADDP4
+ARGP4
+CNSTU4 192
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 1
+SUBI4
+CVIU4 4
+MULU4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $419
+ADDRLP4 12
+ADDRGP4 g_numfavoriteservers
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+CNSTI4 192
+ADDRLP4 12
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 g_favoriteserverlist
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 192
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $415
+JUMPV
+LABELV $417
+LABELV $414
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $416
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+LTI4 $413
+LABELV $415
+ADDRGP4 g_arenaservers+88240
+ADDRGP4 g_arenaservers+89296
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+88252
+ADDRGP4 g_arenaservers+89296
+INDIRI4
+ASGNI4
+LABELV $387
+endproc ArenaServers_Remove 28 12
+proc ArenaServers_RemoveNode 8 12
+ADDRLP4 0
+CNSTI4 192
+ADDRGP4 g_arenaservers+88244
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+88248
+INDIRP4
+ADDP4
+CNSTI4 -192
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+GEU4 $429
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+ARGP4
+CNSTU4 192
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 192
+DIVI4
+CVIU4 4
+MULU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $429
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 192
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4
+ADDRGP4 g_arenaservers+88244
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $426
+endproc ArenaServers_RemoveNode 8 12
+proc ArenaServers_Place 216 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 192
+ADDRGP4 g_arenaservers+88248
+INDIRP4
+ASGNP4
+ADDRLP4 196
+CNSTI4 192
+ADDRGP4 g_arenaservers+88244
+INDIRP4
+INDIRI4
+MULI4
+ADDRLP4 192
+INDIRP4
+ADDP4
+CNSTI4 -192
+ADDP4
+ASGNP4
+ADDRGP4 $436
+JUMPV
+LABELV $435
+ADDRLP4 204
+ADDRFP4 0
+INDIRP4
+CNSTI4 -192
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 204
+INDIRP4
+INDIRB
+ASGNB 192
+ADDRLP4 204
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 192
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRB
+ASGNB 192
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 -192
+ADDP4
+ASGNP4
+LABELV $436
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 192
+INDIRP4
+CVPU4 4
+LEU4 $438
+ADDRFP4 0
+INDIRP4
+CNSTI4 -192
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 204
+ADDRGP4 ArenaServers_Compare
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 0
+GTI4 $435
+LABELV $438
+ADDRGP4 $440
+JUMPV
+LABELV $439
+ADDRLP4 212
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 212
+INDIRP4
+INDIRB
+ASGNB 192
+ADDRLP4 212
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 192
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRB
+ASGNB 192
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ASGNP4
+LABELV $440
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 196
+INDIRP4
+CVPU4 4
+GEU4 $442
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ARGP4
+ADDRLP4 212
+ADDRGP4 ArenaServers_Compare
+CALLI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 0
+GTI4 $439
+LABELV $442
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $432
+endproc ArenaServers_Place 216 8
+proc ArenaServers_Insert 112 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $447
+JUMPV
+LABELV $444
+CNSTI4 192
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+88248
+INDIRP4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $449
+ADDRLP4 4
+CNSTI4 192
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+88248
+INDIRP4
+ADDP4
+ASGNP4
+ADDRGP4 $446
+JUMPV
+LABELV $449
+LABELV $445
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $447
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_arenaservers+88244
+INDIRP4
+INDIRI4
+LTI4 $444
+LABELV $446
+ADDRLP4 12
+ADDRGP4 ArenaServers_MaxPing
+CALLI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $453
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 1
+EQI4 $453
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $455
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 ArenaServers_RemoveNode
+CALLV
+pop
+LABELV $455
+CNSTP4 0
+RETP4
+ADDRGP4 $443
+JUMPV
+LABELV $453
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $457
+ADDRGP4 $458
+JUMPV
+LABELV $457
+ADDRGP4 g_arenaservers+88244
+INDIRP4
+INDIRI4
+ADDRGP4 g_arenaservers+88264
+INDIRI4
+LTI4 $459
+ADDRLP4 4
+CNSTI4 192
+ADDRGP4 g_arenaservers+88244
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+88248
+INDIRP4
+ADDP4
+CNSTI4 -192
+ADDP4
+ASGNP4
+ADDRGP4 $460
+JUMPV
+LABELV $459
+ADDRLP4 4
+CNSTI4 192
+ADDRGP4 g_arenaservers+88244
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+88248
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 g_arenaservers+88244
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $460
+LABELV $458
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $468
+ARGP4
+ADDRLP4 16
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+CNSTI4 34
+ARGI4
+ADDRGP4 ServerCleanName
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $469
+ARGP4
+ADDRLP4 20
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 98
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 98
+ADDP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $470
+ARGP4
+ADDRLP4 24
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $471
+ARGP4
+ADDRLP4 32
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRLP4 40
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $473
+ARGP4
+ADDRLP4 48
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $474
+ARGP4
+ADDRLP4 56
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $475
+ARGP4
+ADDRLP4 64
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $476
+ARGP4
+ADDRLP4 72
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $477
+ARGP4
+ADDRLP4 76
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $478
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $479
+JUMPV
+LABELV $478
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LEI4 $480
+ADDRLP4 0
+CNSTI4 9
+ASGNI4
+LABELV $480
+LABELV $479
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $482
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $484
+ARGP4
+ADDRLP4 88
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+EQI4 $482
+ADDRLP4 4
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 156
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 172
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $482
+ADDRLP4 4
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 156
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 gamenames
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 172
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $483
+ADDRGP4 $485
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 98
+ADDP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 104
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 -1
+EQI4 $487
+ADDRLP4 92
+CNSTI4 1
+ASGNI4
+ADDRGP4 $488
+JUMPV
+LABELV $487
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+LABELV $488
+ADDRLP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 ArenaServers_Place
+CALLP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+RETP4
+LABELV $443
+endproc ArenaServers_Insert 112 12
+proc ArenaServers_InsertCached 1116 16
+CNSTI4 2
+ARGI4
+ADDRLP4 1104
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRLP4 1100
+ADDRLP4 1104
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $493
+JUMPV
+LABELV $490
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1108
+ADDRGP4 trap_LAN_GetServerPing
+CALLI4
+ASGNI4
+ADDRLP4 1092
+ADDRLP4 1108
+INDIRI4
+ASGNI4
+ADDRLP4 1092
+INDIRI4
+CNSTI4 0
+GTI4 $494
+ADDRGP4 $491
+JUMPV
+LABELV $494
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_LAN_GetServerAddressString
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 68
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_LAN_GetServerInfo
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRLP4 1092
+INDIRI4
+ARGI4
+ADDRLP4 1112
+ADDRGP4 ArenaServers_Insert
+CALLP4
+ASGNP4
+ADDRLP4 1096
+ADDRLP4 1112
+INDIRP4
+ASGNP4
+ADDRLP4 1096
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $496
+ADDRLP4 1096
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $496
+LABELV $491
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $493
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1100
+INDIRI4
+LTI4 $490
+LABELV $489
+endproc ArenaServers_InsertCached 1116 16
+proc ArenaServers_RemoveCached 16 12
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $502
+JUMPV
+LABELV $499
+CNSTI4 192
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+88248
+INDIRP4
+ADDP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $504
+ADDRGP4 $500
+JUMPV
+LABELV $504
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $507
+ADDRLP4 12
+CNSTI4 192
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+88248
+INDIRP4
+ADDP4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+88248
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 192
+LABELV $507
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $500
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $502
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_arenaservers+88244
+INDIRP4
+INDIRI4
+LTI4 $499
+CNSTI4 192
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+88248
+INDIRP4
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 192
+ADDRGP4 g_arenaservers+88244
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CVIU4 4
+MULU4
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 g_arenaservers+88244
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $498
+endproc ArenaServers_RemoveCached 16 12
+proc ArenaServers_InsertFavorites 1036 12
+ADDRLP4 8
+CNSTI1 0
+ASGNI1
+ADDRLP4 8
+ARGP4
+ADDRGP4 $468
+ARGP4
+ADDRGP4 $515
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $519
+JUMPV
+LABELV $516
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $524
+JUMPV
+LABELV $521
+ADDRLP4 4
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+88272
+ADDP4
+ARGP4
+CNSTI4 192
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_favoriteserverlist
+ADDP4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+NEI4 $525
+ADDRGP4 $523
+JUMPV
+LABELV $525
+LABELV $522
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $524
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+LTI4 $521
+LABELV $523
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+LTI4 $528
+ADDRLP4 1032
+ADDRGP4 ArenaServers_MaxPing
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+88272
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRGP4 ArenaServers_Insert
+CALLP4
+pop
+LABELV $528
+LABELV $517
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $519
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_arenaservers+89296
+INDIRI4
+LTI4 $516
+LABELV $514
+endproc ArenaServers_InsertFavorites 1036 12
+proc ArenaServers_LoadFavorites 3172 12
+ADDRLP4 3148
+CNSTI4 0
+ASGNI4
+ADDRLP4 72
+ARGP4
+ADDRGP4 g_favoriteserverlist
+ARGP4
+CNSTU4 3072
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 68
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+ASGNI4
+ADDRGP4 g_favoriteserverlist
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 3072
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 3152
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_numfavoriteservers
+ADDRLP4 3152
+INDIRI4
+ASGNI4
+ADDRLP4 3144
+ADDRLP4 3152
+INDIRI4
+ASGNI4
+LABELV $532
+ADDRGP4 $536
+ARGP4
+ADDRLP4 3144
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 3156
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 3156
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $537
+ADDRGP4 $533
+JUMPV
+LABELV $537
+ADDRLP4 3160
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 3160
+INDIRI4
+CNSTI4 91
+EQI4 $539
+ADDRLP4 3160
+INDIRI4
+CNSTI4 48
+LTI4 $541
+ADDRLP4 3160
+INDIRI4
+CNSTI4 57
+LEI4 $539
+LABELV $541
+ADDRGP4 $533
+JUMPV
+LABELV $539
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+88272
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $547
+JUMPV
+LABELV $544
+CNSTI4 192
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 72
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 3164
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3164
+INDIRI4
+CNSTI4 0
+NEI4 $548
+ADDRGP4 $546
+JUMPV
+LABELV $548
+LABELV $545
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $547
+ADDRLP4 0
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LTI4 $544
+LABELV $546
+ADDRLP4 0
+INDIRI4
+ADDRLP4 68
+INDIRI4
+GEI4 $550
+ADDRLP4 3168
+CNSTI4 192
+ASGNI4
+ADDRLP4 3168
+INDIRI4
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+MULI4
+ADDRGP4 g_favoriteserverlist
+ADDP4
+ARGP4
+ADDRLP4 3168
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 72
+ADDP4
+ARGP4
+CNSTU4 192
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 3148
+CNSTI4 1
+ASGNI4
+ADDRGP4 $551
+JUMPV
+LABELV $550
+CNSTI4 192
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+MULI4
+ADDRGP4 g_favoriteserverlist
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 3168
+ADDRGP4 ArenaServers_MaxPing
+CALLI4
+ASGNI4
+CNSTI4 192
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+MULI4
+ADDRGP4 g_favoriteserverlist+148
+ADDP4
+ADDRLP4 3168
+INDIRI4
+ASGNI4
+LABELV $551
+ADDRLP4 3168
+ADDRGP4 g_numfavoriteservers
+ASGNP4
+ADDRLP4 3168
+INDIRP4
+ADDRLP4 3168
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $533
+ADDRLP4 3144
+ADDRLP4 3144
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 3144
+INDIRI4
+CNSTI4 16
+LTI4 $532
+ADDRGP4 g_arenaservers+89296
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+ASGNI4
+ADDRLP4 3148
+INDIRI4
+CNSTI4 0
+NEI4 $554
+ADDRGP4 g_numfavoriteservers
+CNSTI4 0
+ASGNI4
+LABELV $554
+LABELV $531
+endproc ArenaServers_LoadFavorites 3172 12
+proc ArenaServers_AddToFavorites 152 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $557
+ADDRGP4 $556
+JUMPV
+LABELV $557
+ADDRLP4 136
+CNSTI4 0
+ASGNI4
+ADDRLP4 132
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 136
+INDIRI4
+ASGNI4
+LABELV $559
+ADDRGP4 $536
+ARGP4
+ADDRLP4 128
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 144
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+NEI4 $563
+ADDRGP4 $556
+JUMPV
+LABELV $563
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $565
+ADDRLP4 132
+ADDRLP4 128
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $561
+JUMPV
+LABELV $565
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 91
+EQI4 $567
+ADDRLP4 148
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 48
+LTI4 $569
+ADDRLP4 148
+INDIRI4
+CNSTI4 57
+LEI4 $567
+LABELV $569
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $567
+ADDRLP4 132
+ADDRLP4 128
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $567
+LABELV $560
+ADDRLP4 128
+ADDRLP4 128
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 16
+LTI4 $559
+LABELV $561
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+EQI4 $570
+ADDRGP4 $536
+ARGP4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 ArenaServers_LoadFavorites
+CALLV
+pop
+LABELV $570
+LABELV $556
+endproc ArenaServers_AddToFavorites 152 12
+proc ArenaServers_StopRefresh 4 16
+ADDRGP4 g_arenaservers+88256
+INDIRI4
+CNSTI4 0
+NEI4 $573
+ADDRGP4 $572
+JUMPV
+LABELV $573
+ADDRGP4 g_arenaservers+88256
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 1
+NEI4 $577
+ADDRGP4 ArenaServers_InsertFavorites
+CALLV
+pop
+LABELV $577
+ADDRGP4 g_arenaservers+88240
+INDIRI4
+CNSTI4 0
+LTI4 $579
+ADDRGP4 g_arenaservers+88252
+ADDRGP4 g_arenaservers+88244
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+88240
+ADDRGP4 g_arenaservers+88244
+INDIRP4
+INDIRI4
+ASGNI4
+LABELV $579
+ADDRGP4 g_arenaservers+88248
+INDIRP4
+ARGP4
+ADDRGP4 g_arenaservers+88244
+INDIRP4
+INDIRI4
+CVIU4 4
+ARGU4
+CNSTU4 192
+ARGU4
+ADDRGP4 ArenaServers_Compare
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 g_servertype
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $588
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+GTI4 $588
+ADDRGP4 g_arenaservers+88240
+INDIRI4
+CNSTI4 0
+LEI4 $588
+ADDRGP4 trap_LAN_SaveCachedServers
+CALLV
+pop
+LABELV $588
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+LABELV $572
+endproc ArenaServers_StopRefresh 4 16
+proc ArenaServers_DoRefresh 1132 16
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRLP4 1112
+ADDRGP4 g_servertype
+INDIRI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+EQI4 $594
+ADDRLP4 1112
+INDIRI4
+CNSTI4 1
+EQI4 $595
+ADDRGP4 $592
+JUMPV
+LABELV $594
+ADDRLP4 1108
+CNSTI4 0
+ASGNI4
+ADDRGP4 $593
+JUMPV
+LABELV $595
+ADDRLP4 1108
+CNSTI4 3
+ASGNI4
+ADDRGP4 $593
+JUMPV
+LABELV $592
+ADDRLP4 1108
+CNSTI4 2
+ASGNI4
+LABELV $593
+ADDRGP4 uis+4
+INDIRI4
+ADDRGP4 g_arenaservers+88268
+INDIRI4
+GEI4 $596
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 1
+EQI4 $600
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 0
+NEI4 $602
+ADDRLP4 1108
+INDIRI4
+ARGI4
+ADDRLP4 1116
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 0
+NEI4 $603
+ADDRGP4 $591
+JUMPV
+LABELV $602
+ADDRLP4 1108
+INDIRI4
+ARGI4
+ADDRLP4 1116
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 0
+GEI4 $606
+ADDRGP4 $591
+JUMPV
+LABELV $606
+LABELV $603
+LABELV $600
+LABELV $596
+ADDRGP4 uis+4
+INDIRI4
+ADDRGP4 g_arenaservers+88260
+INDIRI4
+GEI4 $608
+ADDRGP4 $591
+JUMPV
+LABELV $608
+ADDRGP4 g_arenaservers+88260
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 20
+ADDI4
+ASGNI4
+ADDRLP4 1116
+ADDRGP4 ArenaServers_MaxPing
+CALLI4
+ASGNI4
+ADDRLP4 1104
+ADDRLP4 1116
+INDIRI4
+ASGNI4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+LABELV $614
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 68
+ARGP4
+ADDRGP4 trap_LAN_GetPing
+CALLV
+pop
+ADDRLP4 1120
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ADDRLP4 1120
+INDIRI4
+EQI4 $620
+ADDRLP4 68
+INDIRI4
+ADDRLP4 1120
+INDIRI4
+NEI4 $618
+LABELV $620
+ADDRGP4 $615
+JUMPV
+LABELV $618
+ADDRLP4 68
+INDIRI4
+ADDRLP4 1104
+INDIRI4
+LTI4 $621
+ADDRLP4 80
+CNSTI1 0
+ASGNI1
+ADDRLP4 68
+ADDRLP4 1104
+INDIRI4
+ASGNI4
+ADDRGP4 $622
+JUMPV
+LABELV $621
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRLP4 80
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_LAN_GetPingInfo
+CALLV
+pop
+LABELV $622
+ADDRLP4 0
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRGP4 ArenaServers_Insert
+CALLP4
+pop
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRGP4 trap_LAN_ClearPing
+CALLV
+pop
+ADDRLP4 72
+CNSTI4 1
+ASGNI4
+LABELV $615
+ADDRLP4 64
+ADDRLP4 64
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 256
+LTI4 $614
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 1
+NEI4 $623
+ADDRGP4 g_arenaservers+88240
+ADDRGP4 g_arenaservers+89296
+INDIRI4
+ASGNI4
+ADDRGP4 $624
+JUMPV
+LABELV $623
+ADDRLP4 1108
+INDIRI4
+ARGI4
+ADDRLP4 1120
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRGP4 g_arenaservers+88240
+ADDRLP4 1120
+INDIRI4
+ASGNI4
+LABELV $624
+ADDRLP4 1120
+ADDRGP4 trap_LAN_GetPingQueueCount
+CALLI4
+ASGNI4
+ADDRLP4 76
+CNSTI4 256
+ADDRLP4 1120
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $631
+JUMPV
+LABELV $628
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 1
+NEI4 $634
+ADDRLP4 0
+ARGP4
+ADDRGP4 g_arenaservers+88252
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+88272
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $635
+JUMPV
+LABELV $634
+ADDRLP4 1108
+INDIRI4
+ARGI4
+ADDRGP4 g_arenaservers+88252
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_LAN_GetServerAddressString
+CALLV
+pop
+LABELV $635
+ADDRGP4 $639
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1124
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1124
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRLP4 1128
+ADDRGP4 g_arenaservers+88252
+ASGNP4
+ADDRLP4 1128
+INDIRP4
+ADDRLP4 1128
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 72
+CNSTI4 1
+ASGNI4
+LABELV $629
+ADDRLP4 76
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $631
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+LEI4 $641
+ADDRGP4 g_arenaservers+88252
+INDIRI4
+ADDRGP4 g_arenaservers+88240
+INDIRI4
+LTI4 $628
+LABELV $641
+ADDRLP4 1124
+ADDRGP4 trap_LAN_GetPingQueueCount
+CALLI4
+ASGNI4
+ADDRLP4 1124
+INDIRI4
+CNSTI4 0
+NEI4 $642
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 1
+EQI4 $644
+ADDRGP4 g_arenaservers+88240
+INDIRI4
+CNSTI4 0
+LEI4 $644
+ADDRGP4 ArenaServers_RemoveCached
+CALLV
+pop
+LABELV $644
+ADDRGP4 ArenaServers_StopRefresh
+CALLV
+pop
+ADDRGP4 $591
+JUMPV
+LABELV $642
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $647
+ADDRGP4 $591
+JUMPV
+LABELV $647
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+LABELV $591
+endproc ArenaServers_DoRefresh 1132 16
+proc ArenaServers_StartRefresh 96 16
+ADDRGP4 g_arenaservers+88248
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 192
+ADDRGP4 g_arenaservers+88264
+INDIRI4
+CVIU4 4
+MULU4
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $652
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_LAN_ClearPing
+CALLV
+pop
+LABELV $653
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $652
+ADDRGP4 g_arenaservers+88256
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_arenaservers+88252
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+88260
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+88244
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+88240
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+88268
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 7000
+ADDI4
+ASGNI4
+ADDRLP4 68
+ADDRGP4 g_servertype
+INDIRI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LTI4 $663
+ADDRLP4 68
+INDIRI4
+CNSTI4 6
+GTI4 $663
+ADDRGP4 ArenaServers_InsertCached
+CALLV
+pop
+LABELV $663
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 0
+NEI4 $665
+CNSTI4 2
+ARGI4
+ADDRGP4 $667
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $649
+JUMPV
+LABELV $665
+ADDRLP4 72
+ADDRGP4 g_servertype
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LTI4 $668
+ADDRLP4 72
+INDIRI4
+CNSTI4 6
+GTI4 $668
+ADDRLP4 76
+ADDRGP4 g_arenaservers+416+68
+INDIRI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+LTI4 $670
+ADDRLP4 76
+INDIRI4
+CNSTI4 7
+GTI4 $670
+ADDRLP4 76
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $689
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $689
+address $674
+address $675
+address $677
+address $679
+address $681
+address $683
+address $685
+address $687
+code
+LABELV $670
+LABELV $674
+ADDRLP4 4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $671
+JUMPV
+LABELV $675
+ADDRLP4 4
+ARGP4
+ADDRGP4 $676
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $671
+JUMPV
+LABELV $677
+ADDRLP4 4
+ARGP4
+ADDRGP4 $678
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $671
+JUMPV
+LABELV $679
+ADDRLP4 4
+ARGP4
+ADDRGP4 $680
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $671
+JUMPV
+LABELV $681
+ADDRLP4 4
+ARGP4
+ADDRGP4 $682
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $671
+JUMPV
+LABELV $683
+ADDRLP4 4
+ARGP4
+ADDRGP4 $684
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $671
+JUMPV
+LABELV $685
+ADDRLP4 4
+ARGP4
+ADDRGP4 $686
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $671
+JUMPV
+LABELV $687
+ADDRLP4 4
+ARGP4
+ADDRGP4 $688
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $671
+ADDRGP4 g_emptyservers
+INDIRI4
+CNSTI4 0
+EQI4 $690
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $692
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $690
+ADDRGP4 g_fullservers
+INDIRI4
+CNSTI4 0
+EQI4 $693
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $695
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $693
+ADDRLP4 36
+CNSTI1 0
+ASGNI1
+ADDRGP4 $696
+ARGP4
+ADDRLP4 36
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 master_items
+ADDP4
+INDIRP4
+CNSTU4 8
+ADDP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ARGP4
+ADDRLP4 84
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 84
+INDIRU4
+CNSTU4 0
+EQU4 $697
+ADDRGP4 $699
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRLP4 36
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 88
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $698
+JUMPV
+LABELV $697
+ADDRGP4 $701
+ARGP4
+ADDRLP4 88
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 $700
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRLP4 88
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 92
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $698
+LABELV $668
+LABELV $649
+endproc ArenaServers_StartRefresh 96 16
+export ArenaServers_SaveChanges
+proc ArenaServers_SaveChanges 12 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $706
+JUMPV
+LABELV $703
+ADDRGP4 $536
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+88272
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $704
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $706
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_arenaservers+89296
+INDIRI4
+LTI4 $703
+ADDRGP4 $712
+JUMPV
+LABELV $709
+ADDRGP4 $536
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $249
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $710
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $712
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $709
+LABELV $702
+endproc ArenaServers_SaveChanges 12 8
+export ArenaServers_Sort
+proc ArenaServers_Sort 0 16
+ADDRGP4 g_sortkey
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $714
+ADDRGP4 $713
+JUMPV
+LABELV $714
+ADDRGP4 g_sortkey
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+88248
+INDIRP4
+ARGP4
+ADDRGP4 g_arenaservers+88244
+INDIRP4
+INDIRI4
+CVIU4 4
+ARGU4
+CNSTU4 192
+ARGU4
+ADDRGP4 ArenaServers_Compare
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+LABELV $713
+endproc ArenaServers_Sort 0 16
+export ArenaServers_SetType
+proc ArenaServers_SetType 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 g_servertype
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $719
+ADDRLP4 4
+ADDRGP4 g_arenaservers+1696+48
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+ADDRLP4 8
+ADDRGP4 g_arenaservers+1528+48
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRLP4 12
+ADDRGP4 g_arenaservers+1612+48
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRGP4 g_arenaservers+88248
+ADDRGP4 g_favoriteserverlist
+ASGNP4
+ADDRGP4 g_arenaservers+88244
+ADDRGP4 g_numfavoriteservers
+ASGNP4
+ADDRGP4 g_arenaservers+88264
+CNSTI4 16
+ASGNI4
+ADDRGP4 $720
+JUMPV
+LABELV $719
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $730
+ADDRFP4 0
+INDIRI4
+CNSTI4 6
+GTI4 $730
+ADDRLP4 8
+ADDRGP4 g_arenaservers+1696+48
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRLP4 12
+ADDRGP4 g_arenaservers+1528+48
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+ADDRLP4 16
+ADDRGP4 g_arenaservers+1612+48
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+ADDRGP4 g_arenaservers+88248
+ADDRGP4 g_globalserverlist
+ASGNP4
+ADDRGP4 g_arenaservers+88244
+ADDRGP4 g_numglobalservers
+ASGNP4
+ADDRGP4 g_arenaservers+88264
+CNSTI4 1024
+ASGNI4
+ADDRGP4 $731
+JUMPV
+LABELV $730
+ADDRLP4 8
+ADDRGP4 g_arenaservers+1696+48
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRLP4 12
+ADDRGP4 g_arenaservers+1528+48
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+ADDRLP4 16
+ADDRGP4 g_arenaservers+1612+48
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+ADDRGP4 g_arenaservers+88248
+ADDRGP4 g_localserverlist
+ASGNP4
+ADDRGP4 g_arenaservers+88244
+ADDRGP4 g_numlocalservers
+ASGNP4
+ADDRGP4 g_arenaservers+88264
+CNSTI4 128
+ASGNI4
+LABELV $731
+LABELV $720
+ADDRGP4 ArenaServers_StartRefresh
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+RETI4
+LABELV $718
+endproc ArenaServers_SetType 20 0
+proc ArenaServers_Event 16 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $751
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+EQI4 $751
+ADDRGP4 $750
+JUMPV
+LABELV $751
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LTI4 $753
+ADDRLP4 0
+INDIRI4
+CNSTI4 27
+GTI4 $753
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $829-40
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $829
+address $755
+address $763
+address $769
+address $775
+address $781
+address $799
+address $802
+address $804
+address $806
+address $807
+address $808
+address $753
+address $809
+address $810
+address $787
+address $793
+address $811
+address $820
+code
+LABELV $755
+ADDRGP4 g_arenaservers+296+68
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 ArenaServers_SetType
+CALLI4
+ASGNI4
+ADDRGP4 g_arenaservers+296+68
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $760
+ARGP4
+ADDRGP4 g_arenaservers+296+68
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $754
+JUMPV
+LABELV $763
+ADDRGP4 $764
+ARGP4
+ADDRGP4 g_arenaservers+416+68
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 g_gametype
+ADDRGP4 g_arenaservers+416+68
+INDIRI4
+ASGNI4
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 $754
+JUMPV
+LABELV $769
+ADDRGP4 $770
+ARGP4
+ADDRGP4 g_arenaservers+536+68
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 g_arenaservers+536+68
+INDIRI4
+ARGI4
+ADDRGP4 ArenaServers_Sort
+CALLV
+pop
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 $754
+JUMPV
+LABELV $775
+ADDRGP4 $776
+ARGP4
+ADDRGP4 g_arenaservers+656+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 g_fullservers
+ADDRGP4 g_arenaservers+656+64
+INDIRI4
+ASGNI4
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 $754
+JUMPV
+LABELV $781
+ADDRGP4 $782
+ARGP4
+ADDRGP4 g_arenaservers+724+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 g_emptyservers
+ADDRGP4 g_arenaservers+724+64
+INDIRI4
+ASGNI4
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 $754
+JUMPV
+LABELV $787
+ADDRGP4 $788
+ARGP4
+ADDRGP4 g_arenaservers+792+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 g_onlyhumans
+ADDRGP4 g_arenaservers+792+64
+INDIRI4
+ASGNI4
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 $754
+JUMPV
+LABELV $793
+ADDRGP4 $794
+ARGP4
+ADDRGP4 g_arenaservers+860+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 g_hideprivate
+ADDRGP4 g_arenaservers+860+64
+INDIRI4
+ASGNI4
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 $754
+JUMPV
+LABELV $799
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $754
+ADDRGP4 ArenaServers_UpdatePicture
+CALLV
+pop
+ADDRGP4 $754
+JUMPV
+LABELV $802
+ADDRGP4 g_arenaservers+928
+ARGP4
+CNSTI4 132
+ARGI4
+ADDRGP4 ScrollList_Key
+CALLI4
+pop
+ADDRGP4 $754
+JUMPV
+LABELV $804
+ADDRGP4 g_arenaservers+928
+ARGP4
+CNSTI4 133
+ARGI4
+ADDRGP4 ScrollList_Key
+CALLI4
+pop
+ADDRGP4 $754
+JUMPV
+LABELV $806
+ADDRGP4 ArenaServers_StopRefresh
+CALLV
+pop
+ADDRGP4 ArenaServers_SaveChanges
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $754
+JUMPV
+LABELV $807
+ADDRGP4 ArenaServers_StartRefresh
+CALLV
+pop
+ADDRGP4 $754
+JUMPV
+LABELV $808
+ADDRGP4 UI_SpecifyServerMenu
+CALLV
+pop
+ADDRGP4 $754
+JUMPV
+LABELV $809
+ADDRGP4 ArenaServers_Go
+CALLV
+pop
+ADDRGP4 $754
+JUMPV
+LABELV $810
+ADDRGP4 ArenaServers_Remove
+CALLV
+pop
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 $754
+JUMPV
+LABELV $811
+ADDRGP4 g_arenaservers+928+72
+INDIRI4
+CNSTI4 0
+NEI4 $812
+ADDRGP4 $754
+JUMPV
+LABELV $812
+CNSTI4 80
+ADDRGP4 g_arenaservers+928+68
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+2224+76
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 ArenaServers_AddToFavorites
+CALLV
+pop
+ADDRGP4 $754
+JUMPV
+LABELV $820
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $824
+JUMPV
+LABELV $821
+CNSTI4 80
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+2224+76
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 ArenaServers_AddToFavorites
+CALLV
+pop
+LABELV $822
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $824
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_arenaservers+928+72
+INDIRI4
+LTI4 $821
+LABELV $753
+LABELV $754
+LABELV $750
+endproc ArenaServers_Event 16 8
+proc ArenaServers_MenuDraw 0 4
+ADDRGP4 g_arenaservers+88256
+INDIRI4
+CNSTI4 0
+EQI4 $832
+ADDRGP4 ArenaServers_DoRefresh
+CALLV
+pop
+LABELV $832
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+LABELV $831
+endproc ArenaServers_MenuDraw 0 4
+proc ArenaServers_MenuKey 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 32
+NEI4 $836
+ADDRGP4 g_arenaservers+88256
+INDIRI4
+CNSTI4 0
+EQI4 $836
+ADDRGP4 ArenaServers_StopRefresh
+CALLV
+pop
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $835
+JUMPV
+LABELV $836
+ADDRFP4 0
+INDIRI4
+CNSTI4 140
+EQI4 $842
+ADDRFP4 0
+INDIRI4
+CNSTI4 171
+NEI4 $839
+LABELV $842
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 1
+NEI4 $839
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRLP4 4
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+ADDRGP4 g_arenaservers+928
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+NEU4 $839
+ADDRGP4 ArenaServers_Remove
+CALLV
+pop
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $835
+JUMPV
+LABELV $839
+ADDRFP4 0
+INDIRI4
+CNSTI4 179
+EQI4 $845
+ADDRFP4 0
+INDIRI4
+CNSTI4 27
+NEI4 $843
+LABELV $845
+ADDRGP4 ArenaServers_StopRefresh
+CALLV
+pop
+ADDRGP4 ArenaServers_SaveChanges
+CALLV
+pop
+LABELV $843
+ADDRFP4 0
+INDIRI4
+CNSTI4 184
+NEI4 $846
+ADDRGP4 g_arenaservers+928
+ARGP4
+CNSTI4 132
+ARGI4
+ADDRGP4 ScrollList_Key
+CALLI4
+pop
+LABELV $846
+ADDRFP4 0
+INDIRI4
+CNSTI4 183
+NEI4 $849
+ADDRGP4 g_arenaservers+928
+ARGP4
+CNSTI4 133
+ARGI4
+ADDRGP4 ScrollList_Key
+CALLI4
+pop
+LABELV $849
+ADDRFP4 0
+INDIRI4
+CNSTI4 13
+EQI4 $854
+ADDRFP4 0
+INDIRI4
+CNSTI4 169
+NEI4 $852
+LABELV $854
+ADDRGP4 ArenaServers_Go
+CALLV
+pop
+LABELV $852
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 Menu_DefaultKey
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+RETI4
+LABELV $835
+endproc ArenaServers_MenuKey 20 8
+proc ArenaServers_ConstructMasterList 32 16
+ADDRLP4 28
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $857
+ADDRLP4 6
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRGP4 $861
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 6
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $862
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 master_items
+ADDP4
+CNSTI4 19
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 global_names
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $862
+LABELV $858
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LTI4 $857
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 master_items
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 28
+INDIRI4
+RETI4
+LABELV $855
+endproc ArenaServers_ConstructMasterList 32 16
+bss
+align 1
+LABELV $865
+skip 64
+code
+proc ArenaServers_MenuInit 104 16
+ADDRGP4 g_arenaservers
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 89300
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 ArenaServers_Cache
+CALLV
+pop
+ADDRGP4 g_arenaservers+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_arenaservers+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_arenaservers+268
+ADDRGP4 ArenaServers_MenuDraw
+ASGNP4
+ADDRGP4 g_arenaservers+272
+ADDRGP4 ArenaServers_MenuKey
+ASGNP4
+ADDRGP4 g_arenaservers+284
+CNSTI4 33024
+ASGNI4
+ADDRLP4 12
+ADDRGP4 ArenaServers_ConstructMasterList
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+296
+CNSTI4 3
+ASGNI4
+ADDRGP4 g_arenaservers+296+4
+ADDRGP4 $874
+ASGNP4
+ADDRGP4 g_arenaservers+296+48
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+296+52
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+296+12
+CNSTI4 10
+ASGNI4
+ADDRGP4 g_arenaservers+296+16
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+296+20
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+296+80
+ADDRGP4 master_items
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+416
+CNSTI4 3
+ASGNI4
+ADDRGP4 g_arenaservers+416+4
+ADDRGP4 $890
+ASGNP4
+ADDRGP4 g_arenaservers+416+48
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+416+52
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+416+12
+CNSTI4 11
+ASGNI4
+ADDRGP4 g_arenaservers+416+16
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+416+20
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+416+80
+ADDRGP4 servertype_items
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+536
+CNSTI4 3
+ASGNI4
+ADDRGP4 g_arenaservers+536+4
+ADDRGP4 $906
+ASGNP4
+ADDRGP4 g_arenaservers+536+48
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+536+52
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+536+12
+CNSTI4 12
+ASGNI4
+ADDRGP4 g_arenaservers+536+16
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+536+20
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+536+80
+ADDRGP4 sortkey_items
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+656
+CNSTI4 5
+ASGNI4
+ADDRGP4 g_arenaservers+656+4
+ADDRGP4 $922
+ASGNP4
+ADDRGP4 g_arenaservers+656+48
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+656+52
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+656+12
+CNSTI4 13
+ASGNI4
+ADDRGP4 g_arenaservers+656+16
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+656+20
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+724
+CNSTI4 5
+ASGNI4
+ADDRGP4 g_arenaservers+724+4
+ADDRGP4 $936
+ASGNP4
+ADDRGP4 g_arenaservers+724+48
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+724+52
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+724+12
+CNSTI4 14
+ASGNI4
+ADDRGP4 g_arenaservers+724+16
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+724+20
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+792
+CNSTI4 5
+ASGNI4
+ADDRGP4 g_arenaservers+792+4
+ADDRGP4 $950
+ASGNP4
+ADDRGP4 g_arenaservers+792+48
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+792+52
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+792+12
+CNSTI4 24
+ASGNI4
+ADDRGP4 g_arenaservers+792+16
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+792+20
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+860
+CNSTI4 5
+ASGNI4
+ADDRGP4 g_arenaservers+860+4
+ADDRGP4 $964
+ASGNP4
+ADDRGP4 g_arenaservers+860+48
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+860+52
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+860+12
+CNSTI4 25
+ASGNI4
+ADDRGP4 g_arenaservers+860+16
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+860+20
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+928
+CNSTI4 8
+ASGNI4
+ADDRGP4 g_arenaservers+928+48
+CNSTU4 128
+ASGNU4
+ADDRGP4 g_arenaservers+928+12
+CNSTI4 15
+ASGNI4
+ADDRGP4 g_arenaservers+928+52
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+928+16
+CNSTI4 50
+ASGNI4
+ADDRGP4 g_arenaservers+928+20
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+928+84
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+928+88
+CNSTI4 11
+ASGNI4
+ADDRGP4 g_arenaservers+928+80
+ADDRGP4 g_arenaservers+84144
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $993
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_arenaservers+84144
+ADDP4
+CNSTI4 80
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+2224
+ADDP4
+ASGNP4
+LABELV $994
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $993
+ADDRGP4 g_arenaservers+1048
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+1048+48
+CNSTU4 16388
+ASGNU4
+ADDRGP4 g_arenaservers+1048+16
+CNSTI4 46
+ASGNI4
+ADDRGP4 g_arenaservers+1048+20
+CNSTI4 66
+ASGNI4
+ADDRGP4 g_arenaservers+1048+80
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+1048+84
+CNSTI4 96
+ASGNI4
+ADDRGP4 g_arenaservers+1048+68
+ADDRGP4 $1012
+ASGNP4
+ADDRGP4 g_arenaservers+1144
+CNSTI4 11
+ASGNI4
+ADDRGP4 g_arenaservers+1144+76
+CNSTI4 900
+ASGNI4
+ADDRGP4 g_arenaservers+1144+80
+CNSTI4 319
+ASGNI4
+ADDRGP4 g_arenaservers+1144+84
+CNSTI4 38
+ASGNI4
+ADDRGP4 g_arenaservers+1144+88
+CNSTI4 100
+ASGNI4
+ADDRGP4 $1024
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 g_arenaservers+1144+64
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $1027
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 g_arenaservers+1144+72
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+1144+52
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1144+12
+CNSTI4 16
+ASGNI4
+ADDRGP4 g_arenaservers+1252
+CNSTI4 11
+ASGNI4
+ADDRGP4 g_arenaservers+1252+76
+CNSTI4 900
+ASGNI4
+ADDRGP4 g_arenaservers+1252+80
+CNSTI4 496
+ASGNI4
+ADDRGP4 g_arenaservers+1252+84
+CNSTI4 38
+ASGNI4
+ADDRGP4 g_arenaservers+1252+88
+CNSTI4 99
+ASGNI4
+ADDRGP4 $1043
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 g_arenaservers+1252+64
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $1046
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 g_arenaservers+1252+72
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+1252+52
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1252+12
+CNSTI4 17
+ASGNI4
+ADDRLP4 4
+CNSTI4 385
+ASGNI4
+ADDRGP4 g_arenaservers+1360
+CNSTI4 7
+ASGNI4
+ADDRGP4 g_arenaservers+1360+16
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+1360+20
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+1360+64
+ADDRGP4 $865
+ASGNP4
+ADDRGP4 g_arenaservers+1360+68
+CNSTI4 17
+ASGNI4
+ADDRGP4 g_arenaservers+1360+72
+ADDRGP4 menu_text_color
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+1444
+CNSTI4 7
+ASGNI4
+ADDRGP4 g_arenaservers+1444+16
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+1444+20
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+1444+64
+ADDRGP4 $249
+ASGNP4
+ADDRGP4 g_arenaservers+1444+68
+CNSTI4 17
+ASGNI4
+ADDRGP4 g_arenaservers+1444+72
+ADDRGP4 text_color_normal
+ASGNP4
+ADDRGP4 g_arenaservers+1696
+CNSTI4 11
+ASGNI4
+ADDRGP4 g_arenaservers+1696+76
+CNSTI4 810
+ASGNI4
+ADDRGP4 g_arenaservers+1696+80
+CNSTI4 89
+ASGNI4
+ADDRGP4 g_arenaservers+1696+84
+CNSTI4 133
+ASGNI4
+ADDRGP4 g_arenaservers+1696+88
+CNSTI4 83
+ASGNI4
+ADDRGP4 $1084
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 g_arenaservers+1696+64
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 $1087
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 g_arenaservers+1696+72
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+1696+52
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1696+12
+CNSTI4 23
+ASGNI4
+ADDRGP4 g_arenaservers+1528
+CNSTI4 12
+ASGNI4
+ADDRGP4 g_arenaservers+1528+76
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 g_arenaservers+1528+48
+CNSTU4 256
+ASGNU4
+ADDRGP4 g_arenaservers+1528+52
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1528+12
+CNSTI4 26
+ASGNI4
+ADDRGP4 g_arenaservers+1528+16
+CNSTI4 465
+ASGNI4
+ADDRGP4 g_arenaservers+1528+20
+CNSTI4 20
+ASGNI4
+ADDRGP4 g_arenaservers+1528+64
+ADDRGP4 $1107
+ASGNP4
+ADDRGP4 g_arenaservers+1528+68
+CNSTI4 16
+ASGNI4
+ADDRGP4 g_arenaservers+1528+72
+ADDRGP4 color_orange
+ASGNP4
+ADDRGP4 g_arenaservers+1528+80
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 g_arenaservers+1612
+CNSTI4 12
+ASGNI4
+ADDRGP4 g_arenaservers+1612+76
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 g_arenaservers+1612+48
+CNSTU4 256
+ASGNU4
+ADDRGP4 g_arenaservers+1612+52
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1612+12
+CNSTI4 27
+ASGNI4
+ADDRGP4 g_arenaservers+1612+16
+CNSTI4 465
+ASGNI4
+ADDRGP4 g_arenaservers+1612+20
+CNSTI4 40
+ASGNI4
+ADDRGP4 g_arenaservers+1612+64
+ADDRGP4 $1129
+ASGNP4
+ADDRGP4 g_arenaservers+1612+68
+CNSTI4 16
+ASGNI4
+ADDRGP4 g_arenaservers+1612+72
+ADDRGP4 color_orange
+ASGNP4
+ADDRGP4 g_arenaservers+1612+80
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 g_arenaservers+1804
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+1804+4
+ADDRGP4 $1139
+ASGNP4
+ADDRGP4 g_arenaservers+1804+48
+CNSTU4 260
+ASGNU4
+ADDRGP4 g_arenaservers+1804+52
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1804+12
+CNSTI4 18
+ASGNI4
+ADDRGP4 g_arenaservers+1804+16
+CNSTI4 8
+ASGNI4
+ADDRGP4 g_arenaservers+1804+20
+CNSTI4 440
+ASGNI4
+ADDRGP4 g_arenaservers+1804+80
+CNSTI4 80
+ASGNI4
+ADDRGP4 g_arenaservers+1804+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 g_arenaservers+1804+64
+ADDRGP4 $1156
+ASGNP4
+ADDRGP4 g_arenaservers+2008
+CNSTI4 11
+ASGNI4
+ADDRGP4 g_arenaservers+2008+76
+CNSTI4 360
+ASGNI4
+ADDRGP4 g_arenaservers+2008+80
+CNSTI4 674
+ASGNI4
+ADDRGP4 g_arenaservers+2008+84
+CNSTI4 120
+ASGNI4
+ADDRGP4 g_arenaservers+2008+88
+CNSTI4 60
+ASGNI4
+ADDRGP4 $1168
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 g_arenaservers+2008+64
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $1171
+ARGP4
+ADDRLP4 44
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 g_arenaservers+2008+72
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+2008+52
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+2008+12
+CNSTI4 20
+ASGNI4
+ADDRGP4 g_arenaservers+1900
+CNSTI4 11
+ASGNI4
+ADDRGP4 g_arenaservers+1900+76
+CNSTI4 530
+ASGNI4
+ADDRGP4 g_arenaservers+1900+80
+CNSTI4 674
+ASGNI4
+ADDRGP4 g_arenaservers+1900+84
+CNSTI4 120
+ASGNI4
+ADDRGP4 g_arenaservers+1900+88
+CNSTI4 60
+ASGNI4
+ADDRGP4 $1187
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 g_arenaservers+1900+64
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 $1190
+ARGP4
+ADDRLP4 52
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 g_arenaservers+1900+72
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+1900+52
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1900+12
+CNSTI4 19
+ASGNI4
+ADDRGP4 g_arenaservers+2116
+CNSTI4 11
+ASGNI4
+ADDRGP4 g_arenaservers+2116+76
+CNSTI4 865
+ASGNI4
+ADDRGP4 g_arenaservers+2116+80
+CNSTI4 658
+ASGNI4
+ADDRGP4 g_arenaservers+2116+84
+CNSTI4 135
+ASGNI4
+ADDRGP4 g_arenaservers+2116+88
+CNSTI4 97
+ASGNI4
+ADDRGP4 $1206
+ARGP4
+ADDRLP4 56
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 g_arenaservers+2116+64
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 $1209
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 g_arenaservers+2116+72
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+2116+52
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+2116+12
+CNSTI4 22
+ASGNI4
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+296
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+416
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+536
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+656
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+724
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+792
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+860
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1048
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+928
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1360
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1444
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1144
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1252
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1528
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1612
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1696
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1804
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+2008
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1900
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+2116
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 ArenaServers_LoadFavorites
+CALLV
+pop
+CNSTF4 0
+ARGF4
+CNSTF4 1088421888
+ARGF4
+ADDRGP4 ui_browserGameType+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 64
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_gametype
+ADDRLP4 64
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 g_arenaservers+416+68
+ADDRGP4 g_gametype
+INDIRI4
+ASGNI4
+CNSTF4 0
+ARGF4
+CNSTF4 1084227584
+ARGF4
+ADDRGP4 ui_browserSortKey+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 68
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_sortkey
+ADDRLP4 68
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 g_arenaservers+536+68
+ADDRGP4 g_sortkey
+INDIRI4
+ASGNI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 ui_browserShowFull+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 72
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_fullservers
+ADDRLP4 72
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 g_arenaservers+656+64
+ADDRGP4 g_fullservers
+INDIRI4
+ASGNI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 ui_browserShowEmpty+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 76
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_emptyservers
+ADDRLP4 76
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 g_arenaservers+724+64
+ADDRGP4 g_emptyservers
+INDIRI4
+ASGNI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 ui_browserOnlyHumans+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 80
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_arenaservers+792+64
+ADDRLP4 80
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 g_onlyhumans
+ADDRGP4 ui_browserOnlyHumans+12
+INDIRI4
+ASGNI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 ui_browserHidePrivate+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 84
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_hideprivate
+ADDRLP4 84
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 g_arenaservers+860+64
+ADDRGP4 g_hideprivate
+INDIRI4
+ASGNI4
+ADDRGP4 g_servertype
+ADDRGP4 ui_browserMaster+12
+INDIRI4
+ASGNI4
+ADDRLP4 88
+ADDRGP4 g_servertype
+INDIRI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+LTI4 $1256
+ADDRLP4 88
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $1254
+LABELV $1256
+ADDRGP4 g_servertype
+CNSTI4 0
+ASGNI4
+LABELV $1254
+CNSTI4 2
+ARGI4
+ADDRLP4 92
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+GTI4 $1257
+ADDRGP4 trap_LAN_LoadCachedServers
+CALLV
+pop
+LABELV $1257
+ADDRLP4 96
+ADDRGP4 g_servertype
+ASGNP4
+ADDRLP4 96
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 ArenaServers_SetType
+CALLI4
+ASGNI4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+296+68
+ADDRLP4 100
+INDIRI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRGP4 $696
+ARGP4
+ADDRGP4 $249
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+LABELV $864
+endproc ArenaServers_MenuInit 104 16
+export ArenaServers_Cache
+proc ArenaServers_Cache 12 20
+ADDRGP4 $1139
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1156
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1168
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1171
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1187
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1190
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1206
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1209
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1024
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1027
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1043
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1046
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1012
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 global_names
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1262
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1264
+ADDRLP4 4
+CNSTI4 19
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 global_names
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $1268
+ARGP4
+ADDRGP4 $77
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $1265
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LTI4 $1264
+LABELV $1262
+LABELV $1261
+endproc ArenaServers_Cache 12 20
+export UI_ArenaServersMenu
+proc UI_ArenaServersMenu 0 4
+ADDRGP4 ArenaServers_MenuInit
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $1269
+endproc UI_ArenaServersMenu 0 4
+bss
+align 4
+LABELV g_hideprivate
+skip 4
+align 4
+LABELV g_onlyhumans
+skip 4
+align 4
+LABELV g_fullservers
+skip 4
+align 4
+LABELV g_emptyservers
+skip 4
+align 4
+LABELV g_sortkey
+skip 4
+align 4
+LABELV g_gametype
+skip 4
+align 4
+LABELV g_servertype
+skip 4
+align 4
+LABELV g_numfavoriteservers
+skip 4
+align 4
+LABELV g_favoriteserverlist
+skip 3072
+align 4
+LABELV g_numlocalservers
+skip 4
+align 4
+LABELV g_localserverlist
+skip 24576
+align 4
+LABELV g_numglobalservers
+skip 4
+align 4
+LABELV g_globalserverlist
+skip 196608
+align 4
+LABELV g_arenaservers
+skip 89300
+import UI_HelpMenu_Cache
+import UI_HelpMenu_f
+import UI_HelpMenu
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import UI_InitGameinfo
+import UI_GetNumBots
+import UI_GetBotInfoByNumber
+import UI_GetNumArenas
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_VoiceIngame
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_GetVoiceGainClient
+import trap_GetVoiceMuteAll
+import trap_GetVoiceMuteClient
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_CIN_SetExtents
+import trap_CIN_StopCinematic
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_PlayCinematic
+import trap_RealTime
+import trap_S_StartBackgroundTrack
+import trap_S_StopBackgroundTrack
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_SaveCachedServers
+import trap_LAN_LoadCachedServers
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import BotListCompare
+import uis
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString2
+import UI_AutoWrappedString_LineCount
+import UI_DrawString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawIngameBG
+import UI_DrawStringNS
+import UI_ModelIcon
+import UI_DrawHandlePic1024
+import UI_AdjustFrom1024
+import UI_StopMusic
+import UI_StartCreditMusic
+import UI_StartMusic
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_ClearModelCache
+import UI_PrecacheClientModelname
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import StartServer_Cache
+import UI_StartServerMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import UI_SpecifyPasswordMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import Demos_Cache
+import UI_DemosMenu
+import SetDefaultBinds_onUnusedKeys
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import SetupDefaultMenu_Cache
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import Music_NextTrack
+import Music_TriggerRestart
+import Music_Check
+import MusicMenu_Cache
+import MusicMenu_Open
+import MusicMenu_Shutdown
+import MusicMenu_Init
+import UI_CallVoteMenu
+import UI_InGameMenu
+import InGame_Cache
+import UI_SecretMenu
+import UI_InitBigCredits
+import UI_BigCredits_Cache
+import UI_CreditMenu
+import ExitMenu_Cache
+import ExitMenu_Init
+import UI_MainMenu
+import MainMenu_Cache
+import UI_UpdateCvars
+import UI_RegisterCvars
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import listbar_bluecolor
+import text_color_bluehighlight
+import text_color_bluenormal
+import text_color_ighighlight
+import text_color_ignormal
+import listbar_igcolor
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_lightOrange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_click_sound
+import menu_switch_sound
+import menu_move_sound
+import ScrollList_Key
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import wop_AutoBindUnusedKeys
+import wop_AutoswitchSongByNextMap
+import con_notifytime
+import s_wop_restarted
+import syc_logo
+import spraycolor
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_createGametype
+import ui_browserHidePrivate
+import ui_browserOnlyHumans
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $1268
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $1209
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 49
+byte 1 0
+align 1
+LABELV $1206
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 48
+byte 1 0
+align 1
+LABELV $1190
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 49
+byte 1 0
+align 1
+LABELV $1187
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 48
+byte 1 0
+align 1
+LABELV $1171
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 121
+byte 1 49
+byte 1 0
+align 1
+LABELV $1168
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 121
+byte 1 48
+byte 1 0
+align 1
+LABELV $1156
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 66
+byte 1 116
+byte 1 110
+byte 1 66
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 49
+byte 1 0
+align 1
+LABELV $1139
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 66
+byte 1 116
+byte 1 110
+byte 1 66
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 48
+byte 1 0
+align 1
+LABELV $1129
+byte 1 65
+byte 1 100
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 70
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $1107
+byte 1 65
+byte 1 100
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 70
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $1087
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 49
+byte 1 0
+align 1
+LABELV $1084
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 48
+byte 1 0
+align 1
+LABELV $1046
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 49
+byte 1 0
+align 1
+LABELV $1043
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 48
+byte 1 0
+align 1
+LABELV $1027
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 117
+byte 1 112
+byte 1 49
+byte 1 0
+align 1
+LABELV $1024
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 117
+byte 1 112
+byte 1 48
+byte 1 0
+align 1
+LABELV $1012
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $964
+byte 1 72
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $950
+byte 1 79
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 58
+byte 1 0
+align 1
+LABELV $936
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 69
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $922
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 70
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 58
+byte 1 0
+align 1
+LABELV $906
+byte 1 83
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 66
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $890
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $874
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 58
+byte 1 0
+align 1
+LABELV $861
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $856
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 50
+byte 1 51
+byte 1 52
+byte 1 53
+byte 1 54
+byte 1 55
+byte 1 56
+byte 1 57
+byte 1 48
+byte 1 0
+align 1
+LABELV $794
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 72
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 80
+byte 1 114
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $788
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 79
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 72
+byte 1 117
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $782
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 69
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $776
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 70
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $770
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 0
+align 1
+LABELV $764
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $760
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $701
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $700
+byte 1 103
+byte 1 108
+byte 1 111
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $699
+byte 1 103
+byte 1 108
+byte 1 111
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $696
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $695
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $692
+byte 1 32
+byte 1 101
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $688
+byte 1 32
+byte 1 98
+byte 1 98
+byte 1 0
+align 1
+LABELV $686
+byte 1 32
+byte 1 116
+byte 1 115
+byte 1 121
+byte 1 99
+byte 1 0
+align 1
+LABELV $684
+byte 1 32
+byte 1 99
+byte 1 116
+byte 1 108
+byte 1 0
+align 1
+LABELV $682
+byte 1 32
+byte 1 116
+byte 1 100
+byte 1 109
+byte 1 0
+align 1
+LABELV $680
+byte 1 32
+byte 1 108
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $678
+byte 1 32
+byte 1 115
+byte 1 121
+byte 1 99
+byte 1 0
+align 1
+LABELV $676
+byte 1 32
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 0
+align 1
+LABELV $667
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $639
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $536
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $515
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $485
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 98
+byte 1 115
+byte 1 112
+byte 1 0
+align 1
+LABELV $484
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $477
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $476
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $475
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 80
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $474
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 80
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $473
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $472
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $471
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $470
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $469
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $468
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $380
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 50
+byte 1 46
+byte 1 50
+byte 1 50
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 45
+byte 1 49
+byte 1 56
+byte 1 46
+byte 1 49
+byte 1 56
+byte 1 115
+byte 1 94
+byte 1 51
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 50
+byte 1 100
+byte 1 43
+byte 1 37
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 37
+byte 1 50
+byte 1 100
+byte 1 94
+byte 1 51
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 45
+byte 1 56
+byte 1 46
+byte 1 56
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 45
+byte 1 51
+byte 1 100
+byte 1 0
+align 1
+LABELV $379
+byte 1 94
+byte 1 53
+byte 1 0
+align 1
+LABELV $372
+byte 1 94
+byte 1 49
+byte 1 0
+align 1
+LABELV $371
+byte 1 94
+byte 1 51
+byte 1 0
+align 1
+LABELV $368
+byte 1 94
+byte 1 50
+byte 1 0
+align 1
+LABELV $363
+byte 1 94
+byte 1 52
+byte 1 0
+align 1
+LABELV $288
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $285
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 0
+align 1
+LABELV $252
+byte 1 72
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 82
+byte 1 69
+byte 1 70
+byte 1 82
+byte 1 69
+byte 1 83
+byte 1 72
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $249
+byte 1 0
+align 1
+LABELV $222
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 83
+byte 1 80
+byte 1 65
+byte 1 67
+byte 1 69
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $219
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 46
+byte 1 0
+align 1
+LABELV $214
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 46
+byte 1 0
+align 1
+LABELV $193
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 66
+byte 1 0
+align 1
+LABELV $180
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $138
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 80
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $136
+byte 1 110
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $106
+byte 1 94
+byte 1 48
+byte 1 0
+align 1
+LABELV $104
+byte 1 63
+byte 1 0
+align 1
+LABELV $103
+byte 1 66
+byte 1 66
+byte 1 0
+align 1
+LABELV $102
+byte 1 84
+byte 1 83
+byte 1 89
+byte 1 67
+byte 1 0
+align 1
+LABELV $101
+byte 1 67
+byte 1 84
+byte 1 76
+byte 1 0
+align 1
+LABELV $100
+byte 1 84
+byte 1 70
+byte 1 70
+byte 1 65
+byte 1 0
+align 1
+LABELV $99
+byte 1 76
+byte 1 80
+byte 1 83
+byte 1 0
+align 1
+LABELV $98
+byte 1 83
+byte 1 89
+byte 1 67
+byte 1 0
+align 1
+LABELV $97
+byte 1 83
+byte 1 80
+byte 1 0
+align 1
+LABELV $96
+byte 1 49
+byte 1 86
+byte 1 83
+byte 1 49
+byte 1 0
+align 1
+LABELV $95
+byte 1 70
+byte 1 70
+byte 1 65
+byte 1 0
+align 1
+LABELV $94
+byte 1 72
+byte 1 117
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $93
+byte 1 80
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $92
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $91
+byte 1 79
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 83
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $90
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $89
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $88
+byte 1 66
+byte 1 105
+byte 1 103
+byte 1 32
+byte 1 66
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $87
+byte 1 83
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $86
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 84
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 76
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $85
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $84
+byte 1 76
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 80
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $83
+byte 1 83
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $82
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $81
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $80
+byte 1 70
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $79
+byte 1 76
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $78
+byte 1 49
+byte 1 50
+byte 1 51
+byte 1 52
+byte 1 53
+byte 1 54
+byte 1 55
+byte 1 56
+byte 1 57
+byte 1 48
+byte 1 0
+align 1
+LABELV $77
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 0
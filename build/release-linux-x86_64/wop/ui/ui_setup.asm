@@ -0,0 +1,1720 @@
+code
+proc SetupDefaultMenu_Event 8 8
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $80
+ADDRGP4 $79
+JUMPV
+LABELV $80
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+EQI4 $85
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+EQI4 $89
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+EQI4 $89
+ADDRGP4 $82
+JUMPV
+LABELV $85
+CNSTI4 2
+ARGI4
+ADDRGP4 $86
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $87
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $88
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $83
+JUMPV
+LABELV $89
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $82
+LABELV $83
+LABELV $79
+endproc SetupDefaultMenu_Event 8 8
+proc SetupDefaultMenu_Draw 0 24
+CNSTI4 175
+ARGI4
+CNSTI4 380
+ARGI4
+ADDRGP4 $91
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTF4 1101004800
+ARGF4
+ADDRGP4 color_yellow
+ARGP4
+ADDRGP4 UI_DrawStringNS
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 402
+ARGI4
+ADDRGP4 $92
+ARGP4
+CNSTI4 1
+ARGI4
+CNSTF4 1101004800
+ARGF4
+ADDRGP4 color_yellow
+ARGP4
+ADDRGP4 UI_DrawStringNS
+CALLV
+pop
+ADDRGP4 setupDefaultMenu
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+LABELV $90
+endproc SetupDefaultMenu_Draw 0 24
+proc SetupDefaultMenu_Init 0 12
+ADDRGP4 SetupDefaultMenu_Cache
+CALLV
+pop
+ADDRGP4 setupDefaultMenu
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 584
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 setupDefaultMenu+268
+ADDRGP4 SetupDefaultMenu_Draw
+ASGNP4
+ADDRGP4 setupDefaultMenu+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 setupDefaultMenu+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 setupDefaultMenu+284
+CNSTI4 32784
+ASGNI4
+ADDRGP4 setupDefaultMenu+296
+CNSTI4 6
+ASGNI4
+ADDRGP4 setupDefaultMenu+296+4
+ADDRGP4 $101
+ASGNP4
+ADDRGP4 setupDefaultMenu+296+48
+CNSTU4 132
+ASGNU4
+ADDRGP4 setupDefaultMenu+296+16
+CNSTI4 382
+ASGNI4
+ADDRGP4 setupDefaultMenu+296+20
+CNSTI4 284
+ASGNI4
+ADDRGP4 setupDefaultMenu+296+12
+CNSTI4 10
+ASGNI4
+ADDRGP4 setupDefaultMenu+296+52
+ADDRGP4 SetupDefaultMenu_Event
+ASGNP4
+ADDRGP4 setupDefaultMenu+296+80
+CNSTI4 65
+ASGNI4
+ADDRGP4 setupDefaultMenu+296+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 setupDefaultMenu+296+64
+ADDRGP4 $118
+ASGNP4
+ADDRGP4 setupDefaultMenu+296+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 setupDefaultMenu
+ARGP4
+ADDRGP4 setupDefaultMenu+296
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 setupDefaultMenu+392
+CNSTI4 6
+ASGNI4
+ADDRGP4 setupDefaultMenu+392+4
+ADDRGP4 $125
+ASGNP4
+ADDRGP4 setupDefaultMenu+392+48
+CNSTU4 132
+ASGNU4
+ADDRGP4 setupDefaultMenu+392+16
+CNSTI4 492
+ASGNI4
+ADDRGP4 setupDefaultMenu+392+20
+CNSTI4 284
+ASGNI4
+ADDRGP4 setupDefaultMenu+392+12
+CNSTI4 11
+ASGNI4
+ADDRGP4 setupDefaultMenu+392+52
+ADDRGP4 SetupDefaultMenu_Event
+ASGNP4
+ADDRGP4 setupDefaultMenu+392+80
+CNSTI4 45
+ASGNI4
+ADDRGP4 setupDefaultMenu+392+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 setupDefaultMenu+392+64
+ADDRGP4 $142
+ASGNP4
+ADDRGP4 setupDefaultMenu+392+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 setupDefaultMenu
+ARGP4
+ADDRGP4 setupDefaultMenu+392
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 setupDefaultMenu+488
+CNSTI4 6
+ASGNI4
+ADDRGP4 setupDefaultMenu+488+4
+ADDRGP4 $149
+ASGNP4
+ADDRGP4 setupDefaultMenu+488+48
+CNSTU4 260
+ASGNU4
+ADDRGP4 setupDefaultMenu+488+16
+CNSTI4 8
+ASGNI4
+ADDRGP4 setupDefaultMenu+488+20
+CNSTI4 440
+ASGNI4
+ADDRGP4 setupDefaultMenu+488+12
+CNSTI4 12
+ASGNI4
+ADDRGP4 setupDefaultMenu+488+52
+ADDRGP4 SetupDefaultMenu_Event
+ASGNP4
+ADDRGP4 setupDefaultMenu+488+80
+CNSTI4 80
+ASGNI4
+ADDRGP4 setupDefaultMenu+488+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 setupDefaultMenu+488+64
+ADDRGP4 $166
+ASGNP4
+ADDRGP4 setupDefaultMenu+488+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 setupDefaultMenu
+ARGP4
+ADDRGP4 setupDefaultMenu+488
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 setupDefaultMenu
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $93
+endproc SetupDefaultMenu_Init 0 12
+export SetupDefaultMenu_Cache
+proc SetupDefaultMenu_Cache 0 4
+ADDRGP4 $101
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $118
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $125
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $142
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $170
+endproc SetupDefaultMenu_Cache 0 4
+proc UI_SetupMenu_Event 8 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $172
+ADDRGP4 $171
+JUMPV
+LABELV $172
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LTI4 $174
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+GTI4 $174
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $183-40
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $183
+address $177
+address $178
+address $179
+address $180
+address $174
+address $174
+address $174
+address $181
+address $182
+code
+LABELV $177
+ADDRGP4 UI_PlayerSettingsMenu
+CALLV
+pop
+ADDRGP4 $175
+JUMPV
+LABELV $178
+ADDRGP4 UI_ControlsMenu
+CALLV
+pop
+ADDRGP4 $175
+JUMPV
+LABELV $179
+ADDRGP4 UI_GraphicsOptionsMenu
+CALLV
+pop
+ADDRGP4 $175
+JUMPV
+LABELV $180
+ADDRGP4 UI_PreferencesMenu
+CALLV
+pop
+ADDRGP4 $175
+JUMPV
+LABELV $181
+ADDRGP4 SetupDefaultMenu_Init
+CALLV
+pop
+ADDRGP4 $175
+JUMPV
+LABELV $182
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $174
+LABELV $175
+LABELV $171
+endproc UI_SetupMenu_Event 8 0
+proc UI_SetupMenu_Init 4 12
+ADDRGP4 UI_SetupMenu_Cache
+CALLV
+pop
+ADDRGP4 setupMenuInfo
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 872
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 setupMenuInfo+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 setupMenuInfo+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 setupMenuInfo+288
+CNSTI4 1
+ASGNI4
+ADDRGP4 setupMenuInfo+284
+CNSTI4 32772
+ASGNI4
+ADDRGP4 setupMenuInfo+296
+CNSTI4 6
+ASGNI4
+ADDRGP4 setupMenuInfo+296+4
+ADDRGP4 $193
+ASGNP4
+ADDRGP4 setupMenuInfo+296+48
+CNSTU4 132
+ASGNU4
+ADDRGP4 setupMenuInfo+296+16
+CNSTI4 42
+ASGNI4
+ADDRGP4 setupMenuInfo+296+20
+CNSTI4 46
+ASGNI4
+ADDRGP4 setupMenuInfo+296+12
+CNSTI4 10
+ASGNI4
+ADDRGP4 setupMenuInfo+296+52
+ADDRGP4 UI_SetupMenu_Event
+ASGNP4
+ADDRGP4 setupMenuInfo+296+80
+CNSTI4 120
+ASGNI4
+ADDRGP4 setupMenuInfo+296+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 setupMenuInfo+296+64
+ADDRGP4 $210
+ASGNP4
+ADDRGP4 setupMenuInfo+296+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 setupMenuInfo
+ARGP4
+ADDRGP4 setupMenuInfo+296
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 setupMenuInfo+392
+CNSTI4 6
+ASGNI4
+ADDRGP4 setupMenuInfo+392+4
+ADDRGP4 $217
+ASGNP4
+ADDRGP4 setupMenuInfo+392+48
+CNSTU4 132
+ASGNU4
+ADDRGP4 setupMenuInfo+392+16
+CNSTI4 30
+ASGNI4
+ADDRGP4 setupMenuInfo+392+20
+CNSTI4 87
+ASGNI4
+ADDRGP4 setupMenuInfo+392+12
+CNSTI4 11
+ASGNI4
+ADDRGP4 setupMenuInfo+392+52
+ADDRGP4 UI_SetupMenu_Event
+ASGNP4
+ADDRGP4 setupMenuInfo+392+80
+CNSTI4 160
+ASGNI4
+ADDRGP4 setupMenuInfo+392+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 setupMenuInfo+392+64
+ADDRGP4 $234
+ASGNP4
+ADDRGP4 setupMenuInfo+392+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 setupMenuInfo
+ARGP4
+ADDRGP4 setupMenuInfo+392
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 setupMenuInfo+488
+CNSTI4 6
+ASGNI4
+ADDRGP4 setupMenuInfo+488+4
+ADDRGP4 $241
+ASGNP4
+ADDRGP4 setupMenuInfo+488+48
+CNSTU4 132
+ASGNU4
+ADDRGP4 setupMenuInfo+488+16
+CNSTI4 59
+ASGNI4
+ADDRGP4 setupMenuInfo+488+20
+CNSTI4 127
+ASGNI4
+ADDRGP4 setupMenuInfo+488+12
+CNSTI4 12
+ASGNI4
+ADDRGP4 setupMenuInfo+488+52
+ADDRGP4 UI_SetupMenu_Event
+ASGNP4
+ADDRGP4 setupMenuInfo+488+80
+CNSTI4 120
+ASGNI4
+ADDRGP4 setupMenuInfo+488+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 setupMenuInfo+488+64
+ADDRGP4 $258
+ASGNP4
+ADDRGP4 setupMenuInfo+488+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 setupMenuInfo
+ARGP4
+ADDRGP4 setupMenuInfo+488
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 setupMenuInfo+584
+CNSTI4 6
+ASGNI4
+ADDRGP4 setupMenuInfo+584+4
+ADDRGP4 $265
+ASGNP4
+ADDRGP4 setupMenuInfo+584+48
+CNSTU4 132
+ASGNU4
+ADDRGP4 setupMenuInfo+584+16
+CNSTI4 41
+ASGNI4
+ADDRGP4 setupMenuInfo+584+20
+CNSTI4 167
+ASGNI4
+ADDRGP4 setupMenuInfo+584+12
+CNSTI4 13
+ASGNI4
+ADDRGP4 setupMenuInfo+584+52
+ADDRGP4 UI_SetupMenu_Event
+ASGNP4
+ADDRGP4 setupMenuInfo+584+80
+CNSTI4 120
+ASGNI4
+ADDRGP4 setupMenuInfo+584+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 setupMenuInfo+584+64
+ADDRGP4 $282
+ASGNP4
+ADDRGP4 setupMenuInfo+584+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 setupMenuInfo
+ARGP4
+ADDRGP4 setupMenuInfo+584
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 $288
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+NEF4 $286
+ADDRGP4 setupMenuInfo+680
+CNSTI4 6
+ASGNI4
+ADDRGP4 setupMenuInfo+680+4
+ADDRGP4 $292
+ASGNP4
+ADDRGP4 setupMenuInfo+680+48
+CNSTU4 132
+ASGNU4
+ADDRGP4 setupMenuInfo+680+16
+CNSTI4 41
+ASGNI4
+ADDRGP4 setupMenuInfo+680+20
+CNSTI4 207
+ASGNI4
+ADDRGP4 setupMenuInfo+680+12
+CNSTI4 17
+ASGNI4
+ADDRGP4 setupMenuInfo+680+52
+ADDRGP4 UI_SetupMenu_Event
+ASGNP4
+ADDRGP4 setupMenuInfo+680+80
+CNSTI4 160
+ASGNI4
+ADDRGP4 setupMenuInfo+680+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 setupMenuInfo+680+64
+ADDRGP4 $309
+ASGNP4
+ADDRGP4 setupMenuInfo+680+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 setupMenuInfo
+ARGP4
+ADDRGP4 setupMenuInfo+680
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $286
+ADDRGP4 setupMenuInfo+776
+CNSTI4 6
+ASGNI4
+ADDRGP4 setupMenuInfo+776+4
+ADDRGP4 $149
+ASGNP4
+ADDRGP4 setupMenuInfo+776+48
+CNSTU4 260
+ASGNU4
+ADDRGP4 setupMenuInfo+776+16
+CNSTI4 8
+ASGNI4
+ADDRGP4 setupMenuInfo+776+20
+CNSTI4 440
+ASGNI4
+ADDRGP4 setupMenuInfo+776+12
+CNSTI4 18
+ASGNI4
+ADDRGP4 setupMenuInfo+776+52
+ADDRGP4 UI_SetupMenu_Event
+ASGNP4
+ADDRGP4 setupMenuInfo+776+80
+CNSTI4 80
+ASGNI4
+ADDRGP4 setupMenuInfo+776+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 setupMenuInfo+776+64
+ADDRGP4 $166
+ASGNP4
+ADDRGP4 setupMenuInfo+776+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 setupMenuInfo
+ARGP4
+ADDRGP4 setupMenuInfo+776
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $185
+endproc UI_SetupMenu_Init 4 12
+export UI_SetupMenu_Cache
+proc UI_SetupMenu_Cache 0 4
+ADDRGP4 $193
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $210
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $217
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $234
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $241
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $258
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $292
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $309
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $265
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $282
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $149
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $166
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $335
+endproc UI_SetupMenu_Cache 0 4
+export UI_SetupMenu
+proc UI_SetupMenu 0 4
+ADDRGP4 UI_SetupMenu_Init
+CALLV
+pop
+ADDRGP4 setupMenuInfo
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $336
+endproc UI_SetupMenu 0 4
+bss
+align 4
+LABELV setupDefaultMenu
+skip 584
+align 4
+LABELV setupMenuInfo
+skip 872
+import UI_HelpMenu_Cache
+import UI_HelpMenu_f
+import UI_HelpMenu
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import UI_InitGameinfo
+import UI_GetNumBots
+import UI_GetBotInfoByNumber
+import UI_GetNumArenas
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_VoiceIngame
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_GetVoiceGainClient
+import trap_GetVoiceMuteAll
+import trap_GetVoiceMuteClient
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_CIN_SetExtents
+import trap_CIN_StopCinematic
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_PlayCinematic
+import trap_RealTime
+import trap_S_StartBackgroundTrack
+import trap_S_StopBackgroundTrack
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_SaveCachedServers
+import trap_LAN_LoadCachedServers
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import BotListCompare
+import uis
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString2
+import UI_AutoWrappedString_LineCount
+import UI_DrawString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawIngameBG
+import UI_DrawStringNS
+import UI_ModelIcon
+import UI_DrawHandlePic1024
+import UI_AdjustFrom1024
+import UI_StopMusic
+import UI_StartCreditMusic
+import UI_StartMusic
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_ClearModelCache
+import UI_PrecacheClientModelname
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import UI_SpecifyPasswordMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import Demos_Cache
+import UI_DemosMenu
+import SetDefaultBinds_onUnusedKeys
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import Music_NextTrack
+import Music_TriggerRestart
+import Music_Check
+import MusicMenu_Cache
+import MusicMenu_Open
+import MusicMenu_Shutdown
+import MusicMenu_Init
+import UI_CallVoteMenu
+import UI_InGameMenu
+import InGame_Cache
+import UI_SecretMenu
+import UI_InitBigCredits
+import UI_BigCredits_Cache
+import UI_CreditMenu
+import ExitMenu_Cache
+import ExitMenu_Init
+import UI_MainMenu
+import MainMenu_Cache
+import UI_UpdateCvars
+import UI_RegisterCvars
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import listbar_bluecolor
+import text_color_bluehighlight
+import text_color_bluenormal
+import text_color_ighighlight
+import text_color_ignormal
+import listbar_igcolor
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_lightOrange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_click_sound
+import menu_switch_sound
+import menu_move_sound
+import ScrollList_Key
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import wop_AutoBindUnusedKeys
+import wop_AutoswitchSongByNextMap
+import con_notifytime
+import s_wop_restarted
+import syc_logo
+import spraycolor
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_createGametype
+import ui_browserHidePrivate
+import ui_browserOnlyHumans
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $309
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 112
+byte 1 47
+byte 1 66
+byte 1 116
+byte 1 110
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 115
+byte 1 49
+byte 1 0
+align 1
+LABELV $292
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 112
+byte 1 47
+byte 1 66
+byte 1 116
+byte 1 110
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 115
+byte 1 48
+byte 1 0
+align 1
+LABELV $288
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $282
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 112
+byte 1 47
+byte 1 66
+byte 1 116
+byte 1 110
+byte 1 79
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 49
+byte 1 0
+align 1
+LABELV $265
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 112
+byte 1 47
+byte 1 66
+byte 1 116
+byte 1 110
+byte 1 79
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 48
+byte 1 0
+align 1
+LABELV $258
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 112
+byte 1 47
+byte 1 66
+byte 1 116
+byte 1 110
+byte 1 83
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 49
+byte 1 0
+align 1
+LABELV $241
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 112
+byte 1 47
+byte 1 66
+byte 1 116
+byte 1 110
+byte 1 83
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 48
+byte 1 0
+align 1
+LABELV $234
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 112
+byte 1 47
+byte 1 66
+byte 1 116
+byte 1 110
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 115
+byte 1 49
+byte 1 0
+align 1
+LABELV $217
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 112
+byte 1 47
+byte 1 66
+byte 1 116
+byte 1 110
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 115
+byte 1 48
+byte 1 0
+align 1
+LABELV $210
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 112
+byte 1 47
+byte 1 66
+byte 1 116
+byte 1 110
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $193
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 112
+byte 1 47
+byte 1 66
+byte 1 116
+byte 1 110
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 48
+byte 1 0
+align 1
+LABELV $166
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 66
+byte 1 116
+byte 1 110
+byte 1 66
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 49
+byte 1 0
+align 1
+LABELV $149
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 66
+byte 1 116
+byte 1 110
+byte 1 66
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 48
+byte 1 0
+align 1
+LABELV $142
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 47
+byte 1 110
+byte 1 111
+byte 1 49
+byte 1 0
+align 1
+LABELV $125
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 47
+byte 1 110
+byte 1 111
+byte 1 48
+byte 1 0
+align 1
+LABELV $118
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 47
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 49
+byte 1 0
+align 1
+LABELV $101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 47
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 48
+byte 1 0
+align 1
+LABELV $92
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 114
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 0
+align 1
+LABELV $91
+byte 1 84
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 42
+byte 1 94
+byte 1 49
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 94
+byte 1 51
+byte 1 42
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $88
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $87
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $86
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 10
+byte 1 0
@@ -0,0 +1,3230 @@
+data
+align 4
+LABELV recording_modes
+address $77
+address $78
+byte 4 0
+align 4
+LABELV quality_items
+address $79
+address $80
+address $81
+byte 4 0
+align 4
+LABELV soundSystem_items
+address $82
+address $83
+byte 4 0
+code
+proc UI_SoundOptionsMenu_Update 56 4
+ADDRGP4 $86
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 1187205120
+ADDRLP4 20
+INDIRF4
+LEF4 $88
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $89
+JUMPV
+LABELV $88
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $89
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 soundOptionsInfo+1148+64
+INDIRI4
+CNSTI4 0
+NEI4 $93
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $94
+JUMPV
+LABELV $93
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+LABELV $94
+ADDRLP4 8
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 soundOptionsInfo+1216+68
+INDIRI4
+CNSTI4 0
+NEI4 $98
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRGP4 $99
+JUMPV
+LABELV $98
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+LABELV $99
+ADDRLP4 12
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $100
+ADDRLP4 32
+ADDRGP4 soundOptionsInfo+1336+48
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 4294963199
+BANDU4
+ASGNU4
+ADDRLP4 36
+ADDRGP4 soundOptionsInfo+1148+48
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 40
+ADDRGP4 soundOptionsInfo+1216+48
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 44
+ADDRGP4 soundOptionsInfo+1420+48
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 48
+ADDRGP4 soundOptionsInfo+1500+48
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRGP4 $101
+JUMPV
+LABELV $100
+ADDRLP4 32
+ADDRGP4 soundOptionsInfo+1336+48
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 4096
+BORU4
+ASGNU4
+ADDRLP4 36
+ADDRGP4 soundOptionsInfo+1148+48
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $116
+ADDRLP4 40
+ADDRGP4 soundOptionsInfo+1216+48
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 44
+ADDRGP4 soundOptionsInfo+1420+48
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 48
+ADDRGP4 soundOptionsInfo+1500+48
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRGP4 $117
+JUMPV
+LABELV $116
+ADDRLP4 40
+ADDRGP4 soundOptionsInfo+1216+48
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 44
+ADDRGP4 soundOptionsInfo+1500+48
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $128
+ADDRLP4 48
+ADDRGP4 soundOptionsInfo+1420+48
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRGP4 $129
+JUMPV
+LABELV $128
+ADDRLP4 52
+ADDRGP4 soundOptionsInfo+1420+48
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+LABELV $129
+LABELV $117
+LABELV $101
+ADDRLP4 0
+ADDRGP4 soundOptionsInfo+1336+20
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $136
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+LABELV $136
+ADDRGP4 soundOptionsInfo+1148+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 soundOptionsInfo+1216+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 soundOptionsInfo+1420+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 soundOptionsInfo+1500+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $85
+endproc UI_SoundOptionsMenu_Update 56 4
+proc UI_SoundOptionsMenu_Event 20 8
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $147
+ADDRGP4 $146
+JUMPV
+LABELV $147
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LTI4 $149
+ADDRLP4 0
+INDIRI4
+CNSTI4 24
+GTI4 $149
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $218-40
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $218
+address $152
+address $153
+address $150
+address $155
+address $156
+address $160
+address $149
+address $149
+address $164
+address $184
+address $185
+address $180
+address $168
+address $172
+address $176
+code
+LABELV $152
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_GraphicsOptionsMenu
+CALLV
+pop
+ADDRGP4 $150
+JUMPV
+LABELV $153
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_DisplayOptionsMenu
+CALLV
+pop
+ADDRGP4 $150
+JUMPV
+LABELV $155
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_NetworkOptionsMenu
+CALLV
+pop
+ADDRGP4 $150
+JUMPV
+LABELV $156
+ADDRGP4 $157
+ARGP4
+ADDRGP4 soundOptionsInfo+680+72
+INDIRF4
+CNSTF4 1092616192
+DIVF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $150
+JUMPV
+LABELV $160
+ADDRGP4 $161
+ARGP4
+ADDRGP4 soundOptionsInfo+760+72
+INDIRF4
+CNSTF4 1092616192
+DIVF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $150
+JUMPV
+LABELV $164
+ADDRGP4 $165
+ARGP4
+ADDRGP4 soundOptionsInfo+1080+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $150
+JUMPV
+LABELV $168
+ADDRGP4 $169
+ARGP4
+ADDRGP4 soundOptionsInfo+1500+72
+INDIRF4
+CNSTF4 1092616192
+DIVF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $150
+JUMPV
+LABELV $172
+ADDRGP4 $173
+ARGP4
+ADDRGP4 soundOptionsInfo+1148+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $150
+JUMPV
+LABELV $176
+ADDRGP4 $177
+ARGP4
+ADDRGP4 soundOptionsInfo+1216+68
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $150
+JUMPV
+LABELV $180
+ADDRGP4 $181
+ARGP4
+ADDRGP4 soundOptionsInfo+1420+72
+INDIRF4
+CNSTF4 1092616192
+DIVF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $150
+JUMPV
+LABELV $184
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $150
+JUMPV
+LABELV $185
+ADDRGP4 soundOptionsInfo+1776
+INDIRI4
+ADDRGP4 soundOptionsInfo+960+68
+INDIRI4
+NEI4 $194
+ADDRGP4 soundOptionsInfo+1772
+INDIRI4
+ADDRGP4 soundOptionsInfo+840+68
+INDIRI4
+EQI4 $150
+LABELV $194
+ADDRLP4 12
+ADDRGP4 soundOptionsInfo+960+68
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $199
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+EQI4 $200
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+EQI4 $201
+ADDRGP4 $195
+JUMPV
+LABELV $195
+LABELV $199
+ADDRLP4 8
+CNSTI4 11025
+ASGNI4
+ADDRGP4 $196
+JUMPV
+LABELV $200
+ADDRLP4 8
+CNSTI4 22050
+ASGNI4
+ADDRGP4 $196
+JUMPV
+LABELV $201
+ADDRLP4 8
+CNSTI4 44100
+ASGNI4
+LABELV $196
+ADDRLP4 8
+INDIRI4
+CNSTI4 44100
+NEI4 $202
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $202
+ADDRGP4 $204
+ARGP4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 soundOptionsInfo+1776
+ADDRGP4 soundOptionsInfo+960+68
+INDIRI4
+ASGNI4
+ADDRGP4 $208
+ARGP4
+ADDRGP4 soundOptionsInfo+840+68
+INDIRI4
+CNSTI4 1
+NEI4 $212
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $213
+JUMPV
+LABELV $212
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $213
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 soundOptionsInfo+1772
+ADDRGP4 soundOptionsInfo+840+68
+INDIRI4
+ASGNI4
+ADDRGP4 UI_ForceMenuOff
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $217
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $149
+LABELV $150
+ADDRGP4 UI_SoundOptionsMenu_Update
+CALLV
+pop
+LABELV $146
+endproc UI_SoundOptionsMenu_Event 20 8
+proc SoundOptions_UpdateMenuItems 8 0
+ADDRGP4 soundOptionsInfo+840+68
+INDIRI4
+CNSTI4 0
+NEI4 $221
+ADDRLP4 0
+ADDRGP4 soundOptionsInfo+960+48
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRGP4 $222
+JUMPV
+LABELV $221
+ADDRLP4 0
+ADDRGP4 soundOptionsInfo+960+48
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+LABELV $222
+ADDRLP4 0
+ADDRGP4 soundOptionsInfo+1580+48
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRGP4 soundOptionsInfo+1772
+INDIRI4
+ADDRGP4 soundOptionsInfo+840+68
+INDIRI4
+EQI4 $231
+ADDRLP4 4
+ADDRGP4 soundOptionsInfo+1580+48
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $231
+ADDRGP4 soundOptionsInfo+1776
+INDIRI4
+ADDRGP4 soundOptionsInfo+960+68
+INDIRI4
+EQI4 $238
+ADDRLP4 4
+ADDRGP4 soundOptionsInfo+1580+48
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $238
+LABELV $220
+endproc SoundOptions_UpdateMenuItems 8 0
+proc SoundOptions_MenuDraw 0 4
+ADDRGP4 SoundOptions_UpdateMenuItems
+CALLV
+pop
+ADDRGP4 soundOptionsInfo
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+LABELV $245
+endproc SoundOptions_MenuDraw 0 4
+proc UI_SoundOptionsMenu_Init 44 12
+ADDRGP4 soundOptionsInfo
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1780
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 UI_SoundOptionsMenu_Cache
+CALLV
+pop
+ADDRGP4 soundOptionsInfo+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 soundOptionsInfo+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 soundOptionsInfo+268
+ADDRGP4 SoundOptions_MenuDraw
+ASGNP4
+ADDRGP4 soundOptionsInfo+284
+CNSTI4 32776
+ASGNI4
+ADDRGP4 soundOptionsInfo+296
+CNSTI4 6
+ASGNI4
+ADDRGP4 soundOptionsInfo+296+4
+ADDRGP4 $254
+ASGNP4
+ADDRGP4 soundOptionsInfo+296+48
+CNSTU4 132
+ASGNU4
+ADDRGP4 soundOptionsInfo+296+52
+ADDRGP4 UI_SoundOptionsMenu_Event
+ASGNP4
+ADDRGP4 soundOptionsInfo+296+12
+CNSTI4 10
+ASGNI4
+ADDRGP4 soundOptionsInfo+296+16
+CNSTI4 26
+ASGNI4
+ADDRGP4 soundOptionsInfo+296+20
+CNSTI4 37
+ASGNI4
+ADDRGP4 soundOptionsInfo+296+80
+CNSTI4 130
+ASGNI4
+ADDRGP4 soundOptionsInfo+296+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 soundOptionsInfo+296+64
+ADDRGP4 $271
+ASGNP4
+ADDRGP4 soundOptionsInfo+296+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 soundOptionsInfo+392
+CNSTI4 6
+ASGNI4
+ADDRGP4 soundOptionsInfo+392+4
+ADDRGP4 $277
+ASGNP4
+ADDRGP4 soundOptionsInfo+392+48
+CNSTU4 132
+ASGNU4
+ADDRGP4 soundOptionsInfo+392+52
+ADDRGP4 UI_SoundOptionsMenu_Event
+ASGNP4
+ADDRGP4 soundOptionsInfo+392+12
+CNSTI4 11
+ASGNI4
+ADDRGP4 soundOptionsInfo+392+16
+CNSTI4 159
+ASGNI4
+ADDRGP4 soundOptionsInfo+392+20
+CNSTI4 30
+ASGNI4
+ADDRGP4 soundOptionsInfo+392+80
+CNSTI4 122
+ASGNI4
+ADDRGP4 soundOptionsInfo+392+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 soundOptionsInfo+392+64
+ADDRGP4 $294
+ASGNP4
+ADDRGP4 soundOptionsInfo+392+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 soundOptionsInfo+488
+CNSTI4 6
+ASGNI4
+ADDRGP4 soundOptionsInfo+488+4
+ADDRGP4 $300
+ASGNP4
+ADDRGP4 soundOptionsInfo+488+48
+CNSTU4 68
+ASGNU4
+ADDRGP4 soundOptionsInfo+488+52
+ADDRGP4 UI_SoundOptionsMenu_Event
+ASGNP4
+ADDRGP4 soundOptionsInfo+488+12
+CNSTI4 12
+ASGNI4
+ADDRGP4 soundOptionsInfo+488+16
+CNSTI4 40
+ASGNI4
+ADDRGP4 soundOptionsInfo+488+20
+CNSTI4 77
+ASGNI4
+ADDRGP4 soundOptionsInfo+488+80
+CNSTI4 130
+ASGNI4
+ADDRGP4 soundOptionsInfo+488+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 soundOptionsInfo+488+64
+ADDRGP4 $317
+ASGNP4
+ADDRGP4 soundOptionsInfo+488+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 soundOptionsInfo+584
+CNSTI4 6
+ASGNI4
+ADDRGP4 soundOptionsInfo+584+4
+ADDRGP4 $323
+ASGNP4
+ADDRGP4 soundOptionsInfo+584+48
+CNSTU4 132
+ASGNU4
+ADDRGP4 soundOptionsInfo+584+52
+ADDRGP4 UI_SoundOptionsMenu_Event
+ASGNP4
+ADDRGP4 soundOptionsInfo+584+12
+CNSTI4 13
+ASGNI4
+ADDRGP4 soundOptionsInfo+584+16
+CNSTI4 170
+ASGNI4
+ADDRGP4 soundOptionsInfo+584+20
+CNSTI4 80
+ASGNI4
+ADDRGP4 soundOptionsInfo+584+80
+CNSTI4 100
+ASGNI4
+ADDRGP4 soundOptionsInfo+584+84
+CNSTI4 45
+ASGNI4
+ADDRGP4 soundOptionsInfo+584+64
+ADDRGP4 $340
+ASGNP4
+ADDRGP4 soundOptionsInfo+584+92
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+CNSTI4 213
+ASGNI4
+ADDRGP4 soundOptionsInfo+680
+CNSTI4 1
+ASGNI4
+ADDRGP4 soundOptionsInfo+680+4
+ADDRGP4 $346
+ASGNP4
+ADDRGP4 soundOptionsInfo+680+48
+CNSTU4 2
+ASGNU4
+ADDRGP4 soundOptionsInfo+680+52
+ADDRGP4 UI_SoundOptionsMenu_Event
+ASGNP4
+ADDRGP4 soundOptionsInfo+680+12
+CNSTI4 14
+ASGNI4
+ADDRGP4 soundOptionsInfo+680+16
+CNSTI4 180
+ASGNI4
+ADDRGP4 soundOptionsInfo+680+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 soundOptionsInfo+680+64
+CNSTF4 0
+ASGNF4
+ADDRGP4 soundOptionsInfo+680+68
+CNSTF4 1092616192
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 soundOptionsInfo+760
+CNSTI4 1
+ASGNI4
+ADDRGP4 soundOptionsInfo+760+4
+ADDRGP4 $364
+ASGNP4
+ADDRGP4 soundOptionsInfo+760+48
+CNSTU4 2
+ASGNU4
+ADDRGP4 soundOptionsInfo+760+52
+ADDRGP4 UI_SoundOptionsMenu_Event
+ASGNP4
+ADDRGP4 soundOptionsInfo+760+12
+CNSTI4 15
+ASGNI4
+ADDRGP4 soundOptionsInfo+760+16
+CNSTI4 180
+ASGNI4
+ADDRGP4 soundOptionsInfo+760+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 soundOptionsInfo+760+64
+CNSTF4 0
+ASGNF4
+ADDRGP4 soundOptionsInfo+760+68
+CNSTF4 1092616192
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 soundOptionsInfo+840
+CNSTI4 3
+ASGNI4
+ADDRGP4 soundOptionsInfo+840+4
+ADDRGP4 $382
+ASGNP4
+ADDRGP4 soundOptionsInfo+840+48
+CNSTU4 258
+ASGNU4
+ADDRGP4 soundOptionsInfo+840+52
+ADDRGP4 UI_SoundOptionsMenu_Event
+ASGNP4
+ADDRGP4 soundOptionsInfo+840+12
+CNSTI4 17
+ASGNI4
+ADDRGP4 soundOptionsInfo+840+16
+CNSTI4 180
+ASGNI4
+ADDRGP4 soundOptionsInfo+840+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 soundOptionsInfo+840+80
+ADDRGP4 soundSystem_items
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 soundOptionsInfo+960
+CNSTI4 3
+ASGNI4
+ADDRGP4 soundOptionsInfo+960+4
+ADDRGP4 $398
+ASGNP4
+ADDRGP4 soundOptionsInfo+960+48
+CNSTU4 258
+ASGNU4
+ADDRGP4 soundOptionsInfo+960+52
+ADDRGP4 UI_SoundOptionsMenu_Event
+ASGNP4
+ADDRGP4 soundOptionsInfo+960+12
+CNSTI4 16
+ASGNI4
+ADDRGP4 soundOptionsInfo+960+16
+CNSTI4 180
+ASGNI4
+ADDRGP4 soundOptionsInfo+960+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 soundOptionsInfo+960+80
+ADDRGP4 quality_items
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 soundOptionsInfo+1080
+CNSTI4 5
+ASGNI4
+ADDRGP4 soundOptionsInfo+1080+4
+ADDRGP4 $414
+ASGNP4
+ADDRGP4 soundOptionsInfo+1080+48
+CNSTU4 2
+ASGNU4
+ADDRGP4 soundOptionsInfo+1080+52
+ADDRGP4 UI_SoundOptionsMenu_Event
+ASGNP4
+ADDRGP4 soundOptionsInfo+1080+12
+CNSTI4 18
+ASGNI4
+ADDRGP4 soundOptionsInfo+1080+16
+CNSTI4 180
+ASGNI4
+ADDRGP4 soundOptionsInfo+1080+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 soundOptionsInfo+1080+8
+ADDRGP4 $427
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 34
+ADDI4
+ASGNI4
+ADDRGP4 soundOptionsInfo+1148
+CNSTI4 5
+ASGNI4
+ADDRGP4 soundOptionsInfo+1148+4
+ADDRGP4 $431
+ASGNP4
+ADDRGP4 soundOptionsInfo+1148+48
+CNSTU4 2
+ASGNU4
+ADDRGP4 soundOptionsInfo+1148+52
+ADDRGP4 UI_SoundOptionsMenu_Event
+ASGNP4
+ADDRGP4 soundOptionsInfo+1148+12
+CNSTI4 23
+ASGNI4
+ADDRGP4 soundOptionsInfo+1148+16
+CNSTI4 180
+ASGNI4
+ADDRGP4 soundOptionsInfo+1148+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 soundOptionsInfo+1336
+CNSTI4 7
+ASGNI4
+ADDRGP4 soundOptionsInfo+1336+48
+CNSTU4 131072
+ASGNU4
+ADDRGP4 soundOptionsInfo+1336+16
+CNSTI4 155
+ASGNI4
+ADDRGP4 soundOptionsInfo+1336+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 soundOptionsInfo+1336+64
+ADDRGP4 $451
+ASGNP4
+ADDRGP4 soundOptionsInfo+1336+68
+CNSTI4 17
+ASGNI4
+ADDRGP4 soundOptionsInfo+1336+72
+ADDRGP4 menu_text_color
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 soundOptionsInfo+1216
+CNSTI4 3
+ASGNI4
+ADDRGP4 soundOptionsInfo+1216+4
+ADDRGP4 $459
+ASGNP4
+ADDRGP4 soundOptionsInfo+1216+48
+CNSTU4 2
+ASGNU4
+ADDRGP4 soundOptionsInfo+1216+52
+ADDRGP4 UI_SoundOptionsMenu_Event
+ASGNP4
+ADDRGP4 soundOptionsInfo+1216+12
+CNSTI4 24
+ASGNI4
+ADDRGP4 soundOptionsInfo+1216+16
+CNSTI4 180
+ASGNI4
+ADDRGP4 soundOptionsInfo+1216+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 soundOptionsInfo+1216+80
+ADDRGP4 recording_modes
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 soundOptionsInfo+1420
+CNSTI4 1
+ASGNI4
+ADDRGP4 soundOptionsInfo+1420+4
+ADDRGP4 $475
+ASGNP4
+ADDRGP4 soundOptionsInfo+1420+48
+CNSTU4 2
+ASGNU4
+ADDRGP4 soundOptionsInfo+1420+52
+ADDRGP4 UI_SoundOptionsMenu_Event
+ASGNP4
+ADDRGP4 soundOptionsInfo+1420+12
+CNSTI4 21
+ASGNI4
+ADDRGP4 soundOptionsInfo+1420+16
+CNSTI4 180
+ASGNI4
+ADDRGP4 soundOptionsInfo+1420+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 soundOptionsInfo+1420+64
+CNSTF4 0
+ASGNF4
+ADDRGP4 soundOptionsInfo+1420+68
+CNSTF4 1092616192
+ASGNF4
+ADDRGP4 soundOptionsInfo+1420+8
+ADDRGP4 $492
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 soundOptionsInfo+1500
+CNSTI4 1
+ASGNI4
+ADDRGP4 soundOptionsInfo+1500+4
+ADDRGP4 $496
+ASGNP4
+ADDRGP4 soundOptionsInfo+1500+48
+CNSTU4 2
+ASGNU4
+ADDRGP4 soundOptionsInfo+1500+52
+ADDRGP4 UI_SoundOptionsMenu_Event
+ASGNP4
+ADDRGP4 soundOptionsInfo+1500+12
+CNSTI4 22
+ASGNI4
+ADDRGP4 soundOptionsInfo+1500+16
+CNSTI4 180
+ASGNI4
+ADDRGP4 soundOptionsInfo+1500+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 soundOptionsInfo+1500+64
+CNSTF4 0
+ASGNF4
+ADDRGP4 soundOptionsInfo+1500+68
+CNSTF4 1092616192
+ASGNF4
+ADDRGP4 soundOptionsInfo+1500+8
+ADDRGP4 $513
+ASGNP4
+ADDRGP4 soundOptionsInfo+1676
+CNSTI4 6
+ASGNI4
+ADDRGP4 soundOptionsInfo+1676+4
+ADDRGP4 $517
+ASGNP4
+ADDRGP4 soundOptionsInfo+1676+48
+CNSTU4 260
+ASGNU4
+ADDRGP4 soundOptionsInfo+1676+52
+ADDRGP4 UI_SoundOptionsMenu_Event
+ASGNP4
+ADDRGP4 soundOptionsInfo+1676+12
+CNSTI4 19
+ASGNI4
+ADDRGP4 soundOptionsInfo+1676+16
+CNSTI4 9
+ASGNI4
+ADDRGP4 soundOptionsInfo+1676+20
+CNSTI4 440
+ASGNI4
+ADDRGP4 soundOptionsInfo+1676+80
+CNSTI4 80
+ASGNI4
+ADDRGP4 soundOptionsInfo+1676+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 soundOptionsInfo+1676+64
+ADDRGP4 $534
+ASGNP4
+ADDRGP4 soundOptionsInfo+1676+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 soundOptionsInfo+1580
+CNSTI4 6
+ASGNI4
+ADDRGP4 soundOptionsInfo+1580+4
+ADDRGP4 $540
+ASGNP4
+ADDRGP4 soundOptionsInfo+1580+48
+CNSTU4 20736
+ASGNU4
+ADDRGP4 soundOptionsInfo+1580+52
+ADDRGP4 UI_SoundOptionsMenu_Event
+ASGNP4
+ADDRGP4 soundOptionsInfo+1580+12
+CNSTI4 20
+ASGNI4
+ADDRGP4 soundOptionsInfo+1580+16
+CNSTI4 516
+ASGNI4
+ADDRGP4 soundOptionsInfo+1580+20
+CNSTI4 405
+ASGNI4
+ADDRGP4 soundOptionsInfo+1580+80
+CNSTI4 102
+ASGNI4
+ADDRGP4 soundOptionsInfo+1580+84
+CNSTI4 61
+ASGNI4
+ADDRGP4 soundOptionsInfo+1580+64
+ADDRGP4 $540
+ASGNP4
+ADDRGP4 soundOptionsInfo
+ARGP4
+ADDRGP4 soundOptionsInfo+296
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 soundOptionsInfo
+ARGP4
+ADDRGP4 soundOptionsInfo+392
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 soundOptionsInfo
+ARGP4
+ADDRGP4 soundOptionsInfo+488
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 soundOptionsInfo
+ARGP4
+ADDRGP4 soundOptionsInfo+584
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 soundOptionsInfo
+ARGP4
+ADDRGP4 soundOptionsInfo+680
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 soundOptionsInfo
+ARGP4
+ADDRGP4 soundOptionsInfo+760
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 soundOptionsInfo
+ARGP4
+ADDRGP4 soundOptionsInfo+840
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 soundOptionsInfo
+ARGP4
+ADDRGP4 soundOptionsInfo+960
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 soundOptionsInfo
+ARGP4
+ADDRGP4 soundOptionsInfo+1080
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 soundOptionsInfo
+ARGP4
+ADDRGP4 soundOptionsInfo+1148
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 soundOptionsInfo
+ARGP4
+ADDRGP4 soundOptionsInfo+1336
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 soundOptionsInfo
+ARGP4
+ADDRGP4 soundOptionsInfo+1216
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 soundOptionsInfo
+ARGP4
+ADDRGP4 soundOptionsInfo+1420
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 soundOptionsInfo
+ARGP4
+ADDRGP4 soundOptionsInfo+1500
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 soundOptionsInfo
+ARGP4
+ADDRGP4 soundOptionsInfo+1676
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 soundOptionsInfo
+ARGP4
+ADDRGP4 soundOptionsInfo+1580
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 $157
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 soundOptionsInfo+680+72
+CNSTF4 1092616192
+ADDRLP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 soundOptionsInfo+760+72
+CNSTF4 1092616192
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $208
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 0
+EQF4 $577
+ADDRGP4 soundOptionsInfo+1772
+CNSTI4 1
+ASGNI4
+ADDRGP4 $578
+JUMPV
+LABELV $577
+ADDRGP4 soundOptionsInfo+1772
+CNSTI4 0
+ASGNI4
+LABELV $578
+ADDRGP4 soundOptionsInfo+840+68
+ADDRGP4 soundOptionsInfo+1772
+INDIRI4
+ASGNI4
+ADDRGP4 $204
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $584
+ADDRLP4 4
+CNSTI4 44100
+ASGNI4
+LABELV $584
+ADDRLP4 4
+INDIRI4
+CNSTI4 11025
+GTI4 $586
+ADDRGP4 soundOptionsInfo+1776
+CNSTI4 0
+ASGNI4
+ADDRGP4 $587
+JUMPV
+LABELV $586
+ADDRLP4 4
+INDIRI4
+CNSTI4 22050
+GTI4 $589
+ADDRGP4 soundOptionsInfo+1776
+CNSTI4 1
+ASGNI4
+ADDRGP4 $590
+JUMPV
+LABELV $589
+ADDRGP4 soundOptionsInfo+1776
+CNSTI4 2
+ASGNI4
+LABELV $590
+LABELV $587
+ADDRGP4 soundOptionsInfo+960+68
+ADDRGP4 soundOptionsInfo+1776
+INDIRI4
+ASGNI4
+ADDRGP4 $165
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+CVFI4 4
+CNSTI4 0
+EQI4 $599
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $600
+JUMPV
+LABELV $599
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+LABELV $600
+ADDRGP4 soundOptionsInfo+1080+64
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $169
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 soundOptionsInfo+1500+72
+CNSTF4 1092616192
+ADDRLP4 32
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $173
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 soundOptionsInfo+1148+64
+ADDRLP4 36
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $177
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 soundOptionsInfo+1216+68
+ADDRLP4 40
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 UI_SoundOptionsMenu_Update
+CALLV
+pop
+LABELV $246
+endproc UI_SoundOptionsMenu_Init 44 12
+export UI_SoundOptionsMenu_Cache
+proc UI_SoundOptionsMenu_Cache 0 4
+ADDRGP4 $517
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $534
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $254
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $271
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $277
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $294
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $300
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $317
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $323
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $340
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $540
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $540
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $607
+endproc UI_SoundOptionsMenu_Cache 0 4
+export UI_SoundOptionsMenu
+proc UI_SoundOptionsMenu 0 8
+ADDRGP4 UI_SoundOptionsMenu_Init
+CALLV
+pop
+ADDRGP4 soundOptionsInfo
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+ADDRGP4 soundOptionsInfo
+ARGP4
+ADDRGP4 soundOptionsInfo+488
+ARGP4
+ADDRGP4 Menu_SetCursorToItem
+CALLV
+pop
+LABELV $608
+endproc UI_SoundOptionsMenu 0 8
+bss
+align 4
+LABELV soundOptionsInfo
+skip 1780
+import UI_HelpMenu_Cache
+import UI_HelpMenu_f
+import UI_HelpMenu
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import UI_InitGameinfo
+import UI_GetNumBots
+import UI_GetBotInfoByNumber
+import UI_GetNumArenas
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_VoiceIngame
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_GetVoiceGainClient
+import trap_GetVoiceMuteAll
+import trap_GetVoiceMuteClient
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_CIN_SetExtents
+import trap_CIN_StopCinematic
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_PlayCinematic
+import trap_RealTime
+import trap_S_StartBackgroundTrack
+import trap_S_StopBackgroundTrack
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_SaveCachedServers
+import trap_LAN_LoadCachedServers
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import BotListCompare
+import uis
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString2
+import UI_AutoWrappedString_LineCount
+import UI_DrawString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawIngameBG
+import UI_DrawStringNS
+import UI_ModelIcon
+import UI_DrawHandlePic1024
+import UI_AdjustFrom1024
+import UI_StopMusic
+import UI_StartCreditMusic
+import UI_StartMusic
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_ClearModelCache
+import UI_PrecacheClientModelname
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import UI_SpecifyPasswordMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import Demos_Cache
+import UI_DemosMenu
+import SetDefaultBinds_onUnusedKeys
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import SetupDefaultMenu_Cache
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import Music_NextTrack
+import Music_TriggerRestart
+import Music_Check
+import MusicMenu_Cache
+import MusicMenu_Open
+import MusicMenu_Shutdown
+import MusicMenu_Init
+import UI_CallVoteMenu
+import UI_InGameMenu
+import InGame_Cache
+import UI_SecretMenu
+import UI_InitBigCredits
+import UI_BigCredits_Cache
+import UI_CreditMenu
+import ExitMenu_Cache
+import ExitMenu_Init
+import UI_MainMenu
+import MainMenu_Cache
+import UI_UpdateCvars
+import UI_RegisterCvars
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import listbar_bluecolor
+import text_color_bluehighlight
+import text_color_bluenormal
+import text_color_ighighlight
+import text_color_ignormal
+import listbar_igcolor
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_lightOrange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_click_sound
+import menu_switch_sound
+import menu_move_sound
+import ScrollList_Key
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import wop_AutoBindUnusedKeys
+import wop_AutoswitchSongByNextMap
+import con_notifytime
+import s_wop_restarted
+import syc_logo
+import spraycolor
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_createGametype
+import ui_browserHidePrivate
+import ui_browserOnlyHumans
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $540
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 47
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 0
+align 1
+LABELV $534
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 66
+byte 1 116
+byte 1 110
+byte 1 66
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 49
+byte 1 0
+align 1
+LABELV $517
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 66
+byte 1 116
+byte 1 110
+byte 1 66
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 48
+byte 1 0
+align 1
+LABELV $513
+byte 1 84
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 97
+byte 1 117
+byte 1 100
+byte 1 105
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 32
+byte 1 84
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 117
+byte 1 100
+byte 1 105
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 99
+byte 1 104
+byte 1 111
+byte 1 46
+byte 1 32
+byte 1 73
+byte 1 102
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 39
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 112
+byte 1 104
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 46
+byte 1 0
+align 1
+LABELV $496
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 86
+byte 1 111
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $492
+byte 1 73
+byte 1 102
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 104
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 106
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 104
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 102
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $475
+byte 1 86
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 84
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 58
+byte 1 0
+align 1
+LABELV $459
+byte 1 86
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 0
+align 1
+LABELV $451
+byte 1 110
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 107
+byte 1 58
+byte 1 0
+align 1
+LABELV $431
+byte 1 86
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 0
+align 1
+LABELV $427
+byte 1 69
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 105
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 46
+byte 1 0
+align 1
+LABELV $414
+byte 1 65
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 83
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 83
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 0
+align 1
+LABELV $398
+byte 1 83
+byte 1 68
+byte 1 76
+byte 1 32
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $382
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 83
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 58
+byte 1 0
+align 1
+LABELV $364
+byte 1 77
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 86
+byte 1 111
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $346
+byte 1 69
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 86
+byte 1 111
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $340
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 47
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 107
+byte 1 49
+byte 1 0
+align 1
+LABELV $323
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 47
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 107
+byte 1 48
+byte 1 0
+align 1
+LABELV $317
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 47
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 49
+byte 1 0
+align 1
+LABELV $300
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 47
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 48
+byte 1 0
+align 1
+LABELV $294
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 47
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 49
+byte 1 0
+align 1
+LABELV $277
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 47
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 48
+byte 1 0
+align 1
+LABELV $271
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 49
+byte 1 0
+align 1
+LABELV $254
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 48
+byte 1 0
+align 1
+LABELV $217
+byte 1 115
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $208
+byte 1 115
+byte 1 95
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 79
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 65
+byte 1 76
+byte 1 0
+align 1
+LABELV $204
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 100
+byte 1 108
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $181
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 112
+byte 1 86
+byte 1 65
+byte 1 68
+byte 1 84
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 0
+align 1
+LABELV $177
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 112
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 86
+byte 1 65
+byte 1 68
+byte 1 0
+align 1
+LABELV $173
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $169
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 112
+byte 1 71
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 68
+byte 1 117
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $165
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 65
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 83
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 66
+byte 1 121
+byte 1 78
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $161
+byte 1 115
+byte 1 95
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 118
+byte 1 111
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $157
+byte 1 115
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $86
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $83
+byte 1 79
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 65
+byte 1 76
+byte 1 0
+align 1
+LABELV $82
+byte 1 83
+byte 1 68
+byte 1 76
+byte 1 0
+align 1
+LABELV $81
+byte 1 72
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 0
+align 1
+LABELV $80
+byte 1 77
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $79
+byte 1 76
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $78
+byte 1 65
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 0
+align 1
+LABELV $77
+byte 1 80
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 107
+byte 1 0
@@ -0,0 +1,1294 @@
+data
+align 4
+LABELV specifyserver_artlist
+address $77
+address $78
+address $79
+address $80
+byte 4 0
+code
+proc SpecifyServer_Event 272 16
+ADDRLP4 256
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 102
+EQI4 $107
+ADDRLP4 256
+INDIRI4
+CNSTI4 103
+EQI4 $86
+ADDRGP4 $83
+JUMPV
+LABELV $86
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $87
+ADDRGP4 $84
+JUMPV
+LABELV $87
+ADDRGP4 s_specifyserver+296+64+12
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $84
+ADDRLP4 0
+ARGP4
+ADDRGP4 s_specifyserver+296+64+12
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 s_specifyserver+632+64+12
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $97
+ADDRLP4 0
+ARGP4
+ADDRLP4 264
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 264
+INDIRU4
+ADDRLP4 0
+ADDP4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $102
+ARGP4
+ADDRGP4 s_specifyserver+632+64+12
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $97
+ADDRGP4 $106
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 268
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 268
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $84
+JUMPV
+LABELV $107
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $108
+ADDRGP4 $84
+JUMPV
+LABELV $108
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $83
+LABELV $84
+LABELV $82
+endproc SpecifyServer_Event 272 16
+lit
+align 4
+LABELV $111
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1056964608
+export SpecifyServer_DrawField
+code
+proc SpecifyServer_DrawField 84 20
+ADDRLP4 40
+ADDRGP4 text_color_highlight
+ASGNP4
+ADDRLP4 44
+ADDRGP4 $111
+INDIRB
+ASGNB 16
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 32
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 76
+ADDP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 Q_PrintStrlen
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 32
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ADDRLP4 68
+INDIRI4
+SUBI4
+CNSTI4 2
+DIVI4
+CNSTI4 3
+LSHI4
+ADDI4
+ASGNI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+INDIRI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+NEI4 $113
+ADDRLP4 60
+CNSTI4 1
+ASGNI4
+ADDRGP4 $114
+JUMPV
+LABELV $113
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+LABELV $114
+ADDRLP4 20
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 16
+ASGNI4
+ADDRLP4 12
+ADDRGP4 text_color_normal
+ASGNP4
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $115
+ADDRLP4 12
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRGP4 $116
+JUMPV
+LABELV $115
+ADDRLP4 12
+ADDRGP4 text_color_normal
+ASGNP4
+LABELV $116
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $117
+ADDRLP4 76
+ADDRGP4 trap_Key_GetOverstrikeMode
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $119
+ADDRLP4 4
+CNSTI1 11
+ASGNI1
+ADDRGP4 $120
+JUMPV
+LABELV $119
+ADDRLP4 4
+CNSTI1 10
+ASGNI1
+LABELV $120
+ADDRLP4 32
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+CVIF4 4
+ARGF4
+CNSTF4 1098907648
+ARGF4
+ADDRLP4 44
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawChar
+CALLV
+pop
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 -4097
+BANDI4
+ASGNI4
+LABELV $117
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $121
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 40
+INDIRP4
+ASGNP4
+LABELV $121
+ADDRLP4 8
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $124
+JUMPV
+LABELV $123
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $126
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 Q_IsColorString
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $126
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $128
+ADDRLP4 16
+CNSTI4 7
+ASGNI4
+LABELV $128
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $124
+JUMPV
+LABELV $126
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawChar
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 8
+ADDI4
+ASGNI4
+LABELV $124
+ADDRLP4 76
+ADDRLP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 4
+ADDRLP4 76
+INDIRI1
+ASGNI1
+ADDRLP4 76
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $123
+LABELV $110
+endproc SpecifyServer_DrawField 84 20
+export SpecifyServer_MenuInit
+proc SpecifyServer_MenuInit 8 16
+ADDRGP4 s_specifyserver
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 SpecifyServer_Cache
+CALLV
+pop
+ADDRGP4 s_specifyserver+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_specifyserver+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_specifyserver+284
+CNSTI4 34816
+ASGNI4
+ADDRGP4 s_specifyserver+296
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_specifyserver+296+4
+ADDRGP4 $137
+ASGNP4
+ADDRGP4 s_specifyserver+296+48
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_specifyserver+296+16
+CNSTI4 230
+ASGNI4
+ADDRGP4 s_specifyserver+296+20
+CNSTI4 230
+ASGNI4
+ADDRGP4 s_specifyserver+296+64+8
+CNSTI4 22
+ASGNI4
+ADDRGP4 s_specifyserver+296+64+268
+CNSTI4 80
+ASGNI4
+ADDRGP4 s_specifyserver+296+60
+ADDRGP4 SpecifyServer_DrawField
+ASGNP4
+ADDRGP4 s_specifyserver+632
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_specifyserver+632+4
+ADDRGP4 $137
+ASGNP4
+ADDRGP4 s_specifyserver+632+48
+CNSTU4 290
+ASGNU4
+ADDRGP4 s_specifyserver+632+16
+CNSTI4 230
+ASGNI4
+ADDRGP4 s_specifyserver+632+20
+CNSTI4 275
+ASGNI4
+ADDRGP4 s_specifyserver+632+64+8
+CNSTI4 22
+ASGNI4
+ADDRGP4 s_specifyserver+632+64+268
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_specifyserver+632+60
+ADDRGP4 SpecifyServer_DrawField
+ASGNP4
+ADDRGP4 s_specifyserver+1076
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_specifyserver+1076+4
+ADDRGP4 $77
+ASGNP4
+ADDRGP4 s_specifyserver+1076+48
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_specifyserver+1076+16
+CNSTI4 8
+ASGNI4
+ADDRGP4 s_specifyserver+1076+20
+CNSTI4 440
+ASGNI4
+ADDRGP4 s_specifyserver+1076+12
+CNSTI4 102
+ASGNI4
+ADDRGP4 s_specifyserver+1076+52
+ADDRGP4 SpecifyServer_Event
+ASGNP4
+ADDRGP4 s_specifyserver+1076+80
+CNSTI4 80
+ASGNI4
+ADDRGP4 s_specifyserver+1076+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_specifyserver+1076+64
+ADDRGP4 $78
+ASGNP4
+ADDRGP4 s_specifyserver+1076+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_specifyserver+968
+CNSTI4 11
+ASGNI4
+ADDRGP4 s_specifyserver+968+76
+CNSTI4 845
+ASGNI4
+ADDRGP4 s_specifyserver+968+80
+CNSTI4 658
+ASGNI4
+ADDRGP4 s_specifyserver+968+84
+CNSTI4 135
+ASGNI4
+ADDRGP4 s_specifyserver+968+88
+CNSTI4 97
+ASGNI4
+ADDRGP4 $79
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_specifyserver+968+64
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $80
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_specifyserver+968+72
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_specifyserver+968+52
+ADDRGP4 SpecifyServer_Event
+ASGNP4
+ADDRGP4 s_specifyserver+968+12
+CNSTI4 103
+ASGNI4
+ADDRGP4 s_specifyserver
+ARGP4
+ADDRGP4 s_specifyserver+296
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_specifyserver
+ARGP4
+ADDRGP4 s_specifyserver+632
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_specifyserver
+ARGP4
+ADDRGP4 s_specifyserver+968
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_specifyserver
+ARGP4
+ADDRGP4 s_specifyserver+1076
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_specifyserver+632+64+12
+ARGP4
+CNSTI4 6
+ARGI4
+ADDRGP4 $214
+ARGP4
+CNSTI4 27960
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $130
+endproc SpecifyServer_MenuInit 8 16
+export SpecifyServer_Cache
+proc SpecifyServer_Cache 4 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $216
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 specifyserver_artlist
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $220
+ADDRGP4 $218
+JUMPV
+LABELV $220
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 specifyserver_artlist
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $217
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $216
+JUMPV
+LABELV $218
+LABELV $215
+endproc SpecifyServer_Cache 4 4
+export UI_SpecifyServerMenu
+proc UI_SpecifyServerMenu 0 4
+ADDRGP4 SpecifyServer_MenuInit
+CALLV
+pop
+ADDRGP4 s_specifyserver
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $222
+endproc UI_SpecifyServerMenu 0 4
+bss
+align 4
+LABELV s_specifyserver
+skip 1172
+import UI_HelpMenu_Cache
+import UI_HelpMenu_f
+import UI_HelpMenu
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import UI_InitGameinfo
+import UI_GetNumBots
+import UI_GetBotInfoByNumber
+import UI_GetNumArenas
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_VoiceIngame
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_GetVoiceGainClient
+import trap_GetVoiceMuteAll
+import trap_GetVoiceMuteClient
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_CIN_SetExtents
+import trap_CIN_StopCinematic
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_PlayCinematic
+import trap_RealTime
+import trap_S_StartBackgroundTrack
+import trap_S_StopBackgroundTrack
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_SaveCachedServers
+import trap_LAN_LoadCachedServers
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import BotListCompare
+import uis
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString2
+import UI_AutoWrappedString_LineCount
+import UI_DrawString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawIngameBG
+import UI_DrawStringNS
+import UI_ModelIcon
+import UI_DrawHandlePic1024
+import UI_AdjustFrom1024
+import UI_StopMusic
+import UI_StartCreditMusic
+import UI_StartMusic
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_ClearModelCache
+import UI_PrecacheClientModelname
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import UI_SpecifyPasswordMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import Demos_Cache
+import UI_DemosMenu
+import SetDefaultBinds_onUnusedKeys
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import SetupDefaultMenu_Cache
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import Music_NextTrack
+import Music_TriggerRestart
+import Music_Check
+import MusicMenu_Cache
+import MusicMenu_Open
+import MusicMenu_Shutdown
+import MusicMenu_Init
+import UI_CallVoteMenu
+import UI_InGameMenu
+import InGame_Cache
+import UI_SecretMenu
+import UI_InitBigCredits
+import UI_BigCredits_Cache
+import UI_CreditMenu
+import ExitMenu_Cache
+import ExitMenu_Init
+import UI_MainMenu
+import MainMenu_Cache
+import UI_UpdateCvars
+import UI_RegisterCvars
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import listbar_bluecolor
+import text_color_bluehighlight
+import text_color_bluenormal
+import text_color_ighighlight
+import text_color_ignormal
+import listbar_igcolor
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_lightOrange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_click_sound
+import menu_switch_sound
+import menu_move_sound
+import ScrollList_Key
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import wop_AutoBindUnusedKeys
+import wop_AutoswitchSongByNextMap
+import con_notifytime
+import s_wop_restarted
+import syc_logo
+import spraycolor
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_createGametype
+import ui_browserHidePrivate
+import ui_browserOnlyHumans
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $214
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $137
+byte 1 0
+align 1
+LABELV $106
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $102
+byte 1 58
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $80
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 49
+byte 1 0
+align 1
+LABELV $79
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 48
+byte 1 0
+align 1
+LABELV $78
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 66
+byte 1 116
+byte 1 110
+byte 1 66
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 49
+byte 1 0
+align 1
+LABELV $77
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 66
+byte 1 116
+byte 1 110
+byte 1 66
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 48
+byte 1 0
@@ -0,0 +1,8953 @@
+data
+align 4
+LABELV gametype_items
+address $79
+address $80
+address $81
+address $82
+address $83
+address $84
+address $85
+byte 4 0
+align 4
+LABELV gametype_remap
+byte 4 3
+byte 4 7
+byte 4 6
+byte 4 8
+byte 4 4
+byte 4 0
+byte 4 5
+align 4
+LABELV gametype_remap2
+byte 4 5
+byte 4 5
+byte 4 5
+byte 4 0
+byte 4 4
+byte 4 6
+byte 4 2
+byte 4 1
+byte 4 3
+align 4
+LABELV teamstrs
+address $86
+address $87
+address $88
+address $89
+byte 4 0
+code
+proc GametypeBits 56 8
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $92
+JUMPV
+LABELV $91
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $94
+ADDRGP4 $93
+JUMPV
+LABELV $94
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $98
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $96
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRGP4 $92
+JUMPV
+LABELV $96
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $101
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $99
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRGP4 $92
+JUMPV
+LABELV $99
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $104
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $102
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+ADDRGP4 $92
+JUMPV
+LABELV $102
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $107
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $105
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+ADDRGP4 $92
+JUMPV
+LABELV $105
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $110
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $112
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $111
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $108
+LABELV $112
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRGP4 $92
+JUMPV
+LABELV $108
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $115
+ARGP4
+ADDRLP4 40
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $113
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+ADDRGP4 $92
+JUMPV
+LABELV $113
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $118
+ARGP4
+ADDRLP4 44
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $116
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+ADDRGP4 $92
+JUMPV
+LABELV $116
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $121
+ARGP4
+ADDRLP4 48
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $119
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+ADDRGP4 $92
+JUMPV
+LABELV $119
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $124
+ARGP4
+ADDRLP4 52
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $122
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 256
+BORI4
+ASGNI4
+LABELV $122
+LABELV $92
+ADDRGP4 $91
+JUMPV
+LABELV $93
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $90
+endproc GametypeBits 56 8
+bss
+align 1
+LABELV $126
+skip 384
+align 1
+LABELV $127
+skip 384
+code
+proc StartServer_Update 32 16
+ADDRLP4 4
+CNSTI4 6
+ADDRGP4 s_startserver+3620
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $129
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ADDRGP4 s_startserver+3616
+INDIRI4
+LTI4 $133
+ADDRGP4 $157
+JUMPV
+LABELV $133
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 $126
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $136
+ARGP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 5
+LSHI4
+ADDRGP4 s_startserver+3628
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 $126
+ADDP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $138
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 $126
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $140
+ARGP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 5
+LSHI4
+ADDRGP4 s_startserver+3628
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $138
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 $127
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $142
+ARGP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 5
+LSHI4
+ADDRGP4 s_startserver+3628
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 20
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+416+48
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRU4
+CNSTU4 4294946751
+BANDU4
+ASGNU4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+416+4
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 $126
+ADDP4
+ASGNP4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+416+72
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+416+64
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 $127
+ADDP4
+ASGNP4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+416+76
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $130
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $129
+ADDRGP4 $157
+JUMPV
+LABELV $154
+ADDRLP4 8
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+416+48
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 4294967231
+BANDU4
+ASGNU4
+ADDRLP4 12
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+416+48
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+416+4
+ADDP4
+CNSTP4 0
+ASGNP4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+416+72
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $155
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $157
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $154
+ADDRGP4 s_startserver+3616
+INDIRI4
+CNSTI4 0
+NEI4 $166
+ADDRGP4 $167
+JUMPV
+LABELV $166
+ADDRGP4 s_startserver+3612
+INDIRI4
+CNSTI4 -1
+EQI4 $169
+ADDRLP4 0
+ADDRGP4 s_startserver+3612
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $173
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+GEI4 $173
+ADDRLP4 12
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+416+48
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 64
+BORU4
+ASGNU4
+LABELV $173
+LABELV $169
+LABELV $167
+LABELV $125
+endproc StartServer_Update 32 16
+proc StartServer_MapEvent 16 0
+ADDRLP4 8
+CNSTI4 6
+ADDRGP4 s_startserver+3620
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 11
+SUBI4
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $179
+ADDRGP4 s_startserver+3612
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $177
+JUMPV
+LABELV $179
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $182
+ADDRGP4 $177
+JUMPV
+LABELV $182
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $184
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+10288
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $188
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+10288
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $195
+JUMPV
+LABELV $192
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+10288+4
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $196
+ADDRGP4 $186
+JUMPV
+LABELV $196
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 s_startserver+10288+4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 s_startserver+10288+4
+ADDP4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 s_startserver+10288
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+10288
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $193
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $195
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $192
+ADDRGP4 $186
+JUMPV
+LABELV $188
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+10288
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $206
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+10288
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $186
+JUMPV
+LABELV $206
+LABELV $185
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $184
+LABELV $186
+ADDRGP4 StartServer_Update
+CALLV
+pop
+LABELV $177
+endproc StartServer_MapEvent 16 0
+proc StartServer_GametypeEvent 1108 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $211
+ADDRGP4 $210
+JUMPV
+LABELV $211
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $213
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+10288
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $217
+ADDRGP4 $215
+JUMPV
+LABELV $217
+ADDRLP4 1052
+CNSTI4 5
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1052
+INDIRI4
+LSHI4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+10288
+ADDP4
+INDIRI4
+ADDRLP4 1052
+INDIRI4
+LSHI4
+ADDRGP4 s_startserver+3628
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $214
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $213
+LABELV $215
+ADDRGP4 $223
+ARGP4
+ADDRGP4 s_startserver+296+68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 gametype_remap
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1048
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $222
+ARGP4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $223
+ARGP4
+ADDRGP4 s_startserver+296+68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 gametype_remap
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1052
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $226
+ARGP4
+ADDRLP4 1052
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 s_startserver+296+68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 gametype_remap
+ADDP4
+INDIRI4
+CNSTI4 5
+LTI4 $229
+ADDRLP4 1056
+ADDRGP4 s_startserver+2336+48
+ASGNP4
+ADDRLP4 1056
+INDIRP4
+ADDRLP4 1056
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRGP4 $230
+JUMPV
+LABELV $229
+ADDRLP4 1060
+ADDRGP4 s_startserver+2336+48
+ASGNP4
+ADDRLP4 1060
+INDIRP4
+ADDRLP4 1060
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+LABELV $230
+ADDRGP4 s_startserver+296+68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 gametype_remap
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $237
+ADDRLP4 1064
+ADDRGP4 s_startserver+2876+48
+ASGNP4
+ADDRLP4 1064
+INDIRP4
+ADDRLP4 1064
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRGP4 $238
+JUMPV
+LABELV $237
+ADDRLP4 1068
+ADDRGP4 s_startserver+2876+48
+ASGNP4
+ADDRLP4 1068
+INDIRP4
+ADDRLP4 1068
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+LABELV $238
+ADDRLP4 1072
+ADDRGP4 UI_GetNumArenas
+CALLI4
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 1072
+INDIRI4
+ASGNI4
+ADDRGP4 s_startserver+3616
+CNSTI4 0
+ASGNI4
+ADDRLP4 1076
+CNSTI4 2
+ASGNI4
+ADDRLP4 1080
+ADDRGP4 gametype_remap
+ASGNP4
+ADDRLP4 1040
+CNSTI4 1
+ADDRGP4 s_startserver+296+68
+INDIRI4
+ADDRLP4 1076
+INDIRI4
+LSHI4
+ADDRLP4 1080
+INDIRP4
+ADDP4
+INDIRI4
+LSHI4
+ASGNI4
+ADDRGP4 s_startserver+296+68
+INDIRI4
+ADDRLP4 1076
+INDIRI4
+LSHI4
+ADDRLP4 1080
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $248
+ADDRLP4 1040
+ADDRLP4 1040
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $248
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $255
+JUMPV
+LABELV $252
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1084
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 1032
+ADDRLP4 1084
+INDIRP4
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $256
+ARGP4
+ADDRLP4 1088
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1088
+INDIRP4
+ARGP4
+ADDRLP4 1092
+ADDRGP4 GametypeBits
+CALLI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1092
+INDIRI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+ADDRLP4 1040
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $257
+ADDRGP4 $253
+JUMPV
+LABELV $257
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $261
+ARGP4
+ADDRLP4 1096
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 s_startserver+3616
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 s_startserver+3628
+ADDP4
+ARGP4
+ADDRLP4 1096
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $264
+ARGP4
+ADDRLP4 1100
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 s_startserver+3616
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 s_startserver+5676
+ADDP4
+ARGP4
+ADDRLP4 1100
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_startserver+3616
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+7724
+ADDP4
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRLP4 1104
+ADDRGP4 s_startserver+3616
+ASGNP4
+ADDRLP4 1104
+INDIRP4
+ADDRLP4 1104
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 s_startserver+3616
+INDIRI4
+CNSTI4 64
+LTI4 $268
+ADDRGP4 $254
+JUMPV
+LABELV $268
+LABELV $253
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $255
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1044
+INDIRI4
+LTI4 $252
+LABELV $254
+ADDRLP4 1084
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+3624
+ADDRGP4 s_startserver+3616
+INDIRI4
+ADDRLP4 1084
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+ADDRLP4 1084
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 s_startserver+3620
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_startserver+3612
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $275
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+10288
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $276
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $275
+ADDRLP4 1088
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1088
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1088
+INDIRI4
+ASGNI4
+ADDRGP4 $283
+JUMPV
+LABELV $280
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $284
+ADDRGP4 $282
+JUMPV
+LABELV $284
+ADDRLP4 1092
+CNSTI4 0
+ASGNI4
+ADDRGP4 $289
+JUMPV
+LABELV $286
+ADDRLP4 1092
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 s_startserver+3628
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $291
+ADDRGP4 $287
+JUMPV
+LABELV $291
+ADDRLP4 1096
+CNSTI4 5
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1096
+INDIRI4
+LSHI4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRLP4 1092
+INDIRI4
+ADDRLP4 1096
+INDIRI4
+LSHI4
+ADDRGP4 s_startserver+3628
+ADDP4
+ARGP4
+ADDRLP4 1100
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1100
+INDIRI4
+CNSTI4 0
+NEI4 $294
+ADDRLP4 1028
+INDIRI4
+CNSTI4 32
+LTI4 $297
+ADDRGP4 $299
+JUMPV
+LABELV $297
+ADDRLP4 1104
+ADDRLP4 1028
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1104
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+10288
+ADDP4
+ADDRLP4 1092
+INDIRI4
+ASGNI4
+ADDRGP4 $288
+JUMPV
+LABELV $294
+LABELV $287
+ADDRLP4 1092
+ADDRLP4 1092
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $289
+ADDRLP4 1092
+INDIRI4
+ADDRGP4 s_startserver+3616
+INDIRI4
+LTI4 $286
+LABELV $288
+LABELV $281
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $283
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $280
+LABELV $282
+LABELV $299
+ADDRGP4 StartServer_Update
+CALLV
+pop
+LABELV $210
+endproc StartServer_GametypeEvent 1108 12
+proc StartServer_MenuEvent 176 24
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $302
+ADDRGP4 $301
+JUMPV
+LABELV $302
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 17
+LTI4 $304
+ADDRLP4 0
+INDIRI4
+CNSTI4 21
+GTI4 $410
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $411-68
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $411
+address $307
+address $312
+address $409
+address $304
+address $319
+code
+LABELV $410
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+EQI4 $318
+ADDRGP4 $304
+JUMPV
+LABELV $307
+ADDRGP4 s_startserver+3620
+INDIRI4
+CNSTI4 0
+LEI4 $305
+ADDRLP4 8
+ADDRGP4 s_startserver+3620
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 StartServer_Update
+CALLV
+pop
+ADDRGP4 $305
+JUMPV
+LABELV $312
+ADDRGP4 s_startserver+3620
+INDIRI4
+ADDRGP4 s_startserver+3624
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $305
+ADDRLP4 8
+ADDRGP4 s_startserver+3620
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 StartServer_Update
+CALLV
+pop
+ADDRGP4 $305
+JUMPV
+LABELV $318
+ADDRGP4 UI_BotSelectMenu
+CALLV
+pop
+ADDRGP4 $305
+JUMPV
+LABELV $319
+ADDRGP4 $320
+ARGP4
+ADDRGP4 s_startserver+296+68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 gametype_remap
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 s_startserver+10288
+INDIRI4
+CNSTI4 -1
+NEI4 $323
+ADDRGP4 $326
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $305
+JUMPV
+LABELV $323
+ADDRGP4 s_startserver+1328+64+12
+ARGP4
+ADDRLP4 108
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 76
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRGP4 s_startserver+1664+64+12
+ARGP4
+ADDRLP4 112
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRGP4 s_startserver+2000+64+12
+ARGP4
+ADDRLP4 116
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 92
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 96
+ADDRGP4 s_startserver+1208+68
+INDIRI4
+ASGNI4
+ADDRLP4 88
+ADDRGP4 s_startserver+2336+64
+INDIRI4
+ASGNI4
+ADDRLP4 100
+ADDRGP4 s_startserver+2404+64
+INDIRI4
+ASGNI4
+ADDRLP4 104
+ADDRGP4 s_startserver+2808+64
+INDIRI4
+ASGNI4
+ADDRLP4 84
+ADDRGP4 s_startserver+296+68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 gametype_remap
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 120
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+LTI4 $346
+ADDRLP4 120
+INDIRI4
+CNSTI4 6
+GTI4 $346
+ADDRLP4 120
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $362
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $362
+address $348
+address $351
+address $346
+address $346
+address $346
+address $354
+address $358
+code
+LABELV $348
+LABELV $346
+ADDRGP4 $349
+ARGP4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $350
+ARGP4
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $347
+JUMPV
+LABELV $351
+ADDRGP4 $352
+ARGP4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $353
+ARGP4
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $347
+JUMPV
+LABELV $354
+ADDRGP4 $355
+ARGP4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $356
+ARGP4
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $357
+ARGP4
+ADDRLP4 88
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $347
+JUMPV
+LABELV $358
+ADDRGP4 $359
+ARGP4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $360
+ARGP4
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $361
+ARGP4
+ADDRLP4 88
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $347
+CNSTF4 1065353216
+ARGF4
+CNSTF4 1115684864
+ARGF4
+ADDRLP4 92
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 124
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $363
+ARGP4
+ADDRLP4 124
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTF4 0
+ARGF4
+CNSTF4 1073741824
+ARGF4
+ADDRLP4 96
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 128
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $364
+ARGP4
+ADDRLP4 128
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTF4 0
+ARGF4
+ADDRLP4 132
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 132
+INDIRF4
+ARGF4
+ADDRLP4 132
+INDIRF4
+ARGF4
+ADDRLP4 136
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $365
+ARGP4
+ADDRLP4 136
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTF4 0
+ARGF4
+ADDRLP4 140
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 140
+INDIRF4
+ARGF4
+ADDRLP4 140
+INDIRF4
+ARGF4
+ADDRLP4 144
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $366
+ARGP4
+ADDRLP4 144
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $367
+ARGP4
+ADDRLP4 88
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $368
+ARGP4
+ADDRLP4 100
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRLP4 84
+INDIRI4
+CNSTI4 4
+NEI4 $369
+ADDRGP4 $371
+ARGP4
+ADDRGP4 s_startserver+2876+64+12
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $369
+ADDRGP4 $375
+ARGP4
+ADDRLP4 104
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $376
+ARGP4
+ADDRGP4 s_startserver+2472+64+12
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $380
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+10288
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $384
+ADDRGP4 $382
+JUMPV
+LABELV $384
+ADDRLP4 148
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $387
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $388
+ARGP4
+ADDRLP4 168
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+ADDRGP4 s_startserver+10288
+ADDP4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 s_startserver+3628
+ADDP4
+ARGP4
+ADDRLP4 168
+INDIRI4
+ADDRGP4 s_startserver+10288+4
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $394
+ADDRLP4 164
+CNSTI4 0
+ASGNI4
+ADDRGP4 $395
+JUMPV
+LABELV $394
+ADDRLP4 164
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $395
+ADDRLP4 164
+INDIRI4
+ARGI4
+ADDRLP4 172
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 148
+ARGP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $381
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 32
+LTI4 $380
+LABELV $382
+CNSTI4 2
+ARGI4
+ADDRGP4 $396
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $397
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $401
+JUMPV
+LABELV $398
+ADDRLP4 12
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $403
+ARGP4
+ADDRLP4 148
+CNSTI4 36
+ADDRLP4 8
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+ADDRGP4 s_startserver+7980
+ADDP4
+ARGP4
+ADDRGP4 s_startserver+10284
+INDIRI4
+ARGI4
+ADDRLP4 148
+INDIRI4
+ADDRGP4 s_startserver+7980+32
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 teamstrs
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $399
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $401
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+GEI4 $408
+CNSTI4 36
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+7980
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $398
+LABELV $408
+ADDRGP4 $305
+JUMPV
+LABELV $409
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $304
+LABELV $305
+LABELV $301
+endproc StartServer_MenuEvent 176 24
+proc StartServer_LevelshotDraw 88 24
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $414
+ADDRGP4 $413
+JUMPV
+LABELV $414
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $416
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $416
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $418
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $418
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+LABELV $418
+LABELV $416
+ADDRLP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $420
+ADDRLP4 4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $420
+ADDRLP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $420
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 44
+INDIRP4
+CVPU4 4
+NEU4 $422
+ADDRLP4 4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $422
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+ADDRGP4 $423
+JUMPV
+LABELV $422
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $424
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $424
+LABELV $423
+ADDRLP4 16
+CNSTI4 6
+ADDRGP4 s_startserver+3620
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDI4
+CNSTI4 11
+SUBI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $427
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+10288
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $431
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 9
+LEI4 $434
+ADDRLP4 8
+INDIRI4
+CNSTI4 8
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CNSTI4 6
+ADDI4
+CVIF4 4
+ARGF4
+CNSTF4 1101004800
+ARGF4
+CNSTF4 1108082688
+ARGF4
+ADDRLP4 48
+CNSTI4 10
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRLP4 48
+INDIRI4
+DIVI4
+ADDRLP4 48
+INDIRI4
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+10416
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CNSTI4 8
+ADDI4
+CNSTI4 23
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CNSTI4 6
+ADDI4
+CVIF4 4
+ARGF4
+CNSTF4 1101004800
+ARGF4
+CNSTF4 1108082688
+ARGF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 10
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+10416
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+ADDRGP4 $429
+JUMPV
+LABELV $434
+ADDRLP4 8
+INDIRI4
+CNSTI4 8
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CNSTI4 6
+ADDI4
+CVIF4 4
+ARGF4
+CNSTF4 1101004800
+ARGF4
+CNSTF4 1108082688
+ARGF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 10
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+10416
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+ADDRGP4 $429
+JUMPV
+LABELV $431
+LABELV $428
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $427
+LABELV $429
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 2
+DIVI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 52
+INDIRP4
+CVPU4 4
+NEU4 $439
+ADDRLP4 56
+ARGP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 s_startserver+3628
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 56
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 56
+ARGP4
+CNSTI4 1
+ARGI4
+CNSTF4 1096810496
+ARGF4
+ADDRGP4 color_white
+ARGP4
+ADDRGP4 UI_DrawStringNS
+CALLV
+pop
+ADDRGP4 $440
+JUMPV
+LABELV $439
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 s_startserver+5676
+ADDP4
+ARGP4
+CNSTI4 1
+ARGI4
+CNSTF4 1096810496
+ARGF4
+ADDRGP4 color_white
+ARGP4
+ADDRGP4 UI_DrawStringNS
+CALLV
+pop
+LABELV $440
+LABELV $413
+endproc StartServer_LevelshotDraw 88 24
+proc StartServer_Draw 0 4
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+LABELV $443
+endproc StartServer_Draw 0 4
+proc GameType_Draw 56 24
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 32
+CNSTI4 16
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+NEI4 $446
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $447
+JUMPV
+LABELV $446
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+LABELV $447
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 color_black
+ASGNP4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $448
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 48
+CNSTI4 15
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+SUBI4
+MULI4
+ADDRLP4 48
+INDIRI4
+ADDI4
+CNSTI4 16
+DIVI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 listbar_color
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+LABELV $448
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+CNSTF4 1097859072
+ARGF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawStringNS
+CALLV
+pop
+LABELV $444
+endproc GameType_Draw 56 24
+data
+align 4
+LABELV dedicated_list
+address $450
+address $451
+address $452
+byte 4 0
+code
+proc StartServer_MenuInit 80 12
+ADDRGP4 s_startserver
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 10456
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $454
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+10288
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $455
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $454
+ADDRGP4 StartServer_Cache
+CALLV
+pop
+ADDRGP4 s_startserver+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_startserver+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_startserver+284
+CNSTI4 40960
+ASGNI4
+ADDRGP4 s_startserver+268
+ADDRGP4 StartServer_Draw
+ASGNP4
+ADDRGP4 s_startserver+296
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_startserver+296+48
+CNSTU4 4194562
+ASGNU4
+ADDRGP4 s_startserver+296+52
+ADDRGP4 StartServer_GametypeEvent
+ASGNP4
+ADDRGP4 s_startserver+296+12
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_startserver+296+16
+CNSTI4 300
+ASGNI4
+ADDRGP4 s_startserver+296+20
+CNSTI4 430
+ASGNI4
+ADDRGP4 s_startserver+296+80
+ADDRGP4 gametype_items
+ASGNP4
+ADDRGP4 s_startserver+296+60
+ADDRGP4 GameType_Draw
+ASGNP4
+ADDRGP4 $226
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1090519040
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_startserver+296+68
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+CNSTI4 2
+LSHI4
+ADDRGP4 gametype_remap2
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $480
+ADDRLP4 24
+CNSTI4 2
+ASGNI4
+ADDRLP4 8
+CNSTI4 138
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+MODI4
+MULI4
+CNSTI4 60
+ADDI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 118
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+DIVI4
+MULI4
+CNSTI4 40
+ADDI4
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+416
+ADDP4
+CNSTI4 6
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+416+48
+ADDP4
+CNSTU4 4
+ASGNU4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+416+12
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+ADDI4
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+416+52
+ADDP4
+ADDRGP4 StartServer_MapEvent
+ASGNP4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+416+16
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+416+20
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+416+80
+ADDP4
+CNSTI4 128
+ASGNI4
+ADDRLP4 32
+CNSTI4 96
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+416+84
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+416+68
+ADDP4
+ADDRGP4 $501
+ASGNP4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+416+60
+ADDP4
+ADDRGP4 StartServer_LevelshotDraw
+ASGNP4
+LABELV $481
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $480
+ADDRGP4 s_startserver+992
+CNSTI4 11
+ASGNI4
+ADDRGP4 s_startserver+992+76
+CNSTI4 199
+ASGNI4
+ADDRGP4 s_startserver+992+80
+CNSTI4 640
+ASGNI4
+ADDRGP4 s_startserver+992+84
+CNSTI4 99
+ASGNI4
+ADDRGP4 s_startserver+992+88
+CNSTI4 38
+ASGNI4
+ADDRGP4 $515
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_startserver+992+64
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $518
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_startserver+992+72
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 s_startserver+992+52
+ADDRGP4 StartServer_MenuEvent
+ASGNP4
+ADDRGP4 s_startserver+992+12
+CNSTI4 17
+ASGNI4
+ADDRGP4 s_startserver+1100
+CNSTI4 11
+ASGNI4
+ADDRGP4 s_startserver+1100+76
+CNSTI4 318
+ASGNI4
+ADDRGP4 s_startserver+1100+80
+CNSTI4 640
+ASGNI4
+ADDRGP4 s_startserver+1100+84
+CNSTI4 98
+ASGNI4
+ADDRGP4 s_startserver+1100+88
+CNSTI4 38
+ASGNI4
+ADDRGP4 $534
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_startserver+1100+64
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $537
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_startserver+1100+72
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 s_startserver+1100+52
+ADDRGP4 StartServer_MenuEvent
+ASGNP4
+ADDRGP4 s_startserver+1100+12
+CNSTI4 18
+ASGNI4
+ADDRGP4 s_startserver+3308
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+3308+4
+ADDRGP4 $545
+ASGNP4
+ADDRGP4 s_startserver+3308+48
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_startserver+3308+52
+ADDRGP4 StartServer_MenuEvent
+ASGNP4
+ADDRGP4 s_startserver+3308+12
+CNSTI4 19
+ASGNI4
+ADDRGP4 s_startserver+3308+64
+ADDRGP4 $554
+ASGNP4
+ADDRGP4 s_startserver+3308+16
+CNSTI4 8
+ASGNI4
+ADDRGP4 s_startserver+3308+20
+CNSTI4 440
+ASGNI4
+ADDRGP4 s_startserver+3308+80
+CNSTI4 80
+ASGNI4
+ADDRGP4 s_startserver+3308+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_startserver+3308+92
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+CNSTI4 176
+ASGNI4
+ADDRGP4 s_startserver+2472
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_startserver+2472+4
+ADDRGP4 $568
+ASGNP4
+ADDRGP4 s_startserver+2472+48
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_startserver+2472+16
+CNSTI4 502
+ASGNI4
+ADDRGP4 s_startserver+2472+20
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_startserver+2472+64+8
+CNSTI4 12
+ASGNI4
+ADDRGP4 s_startserver+2472+64+268
+CNSTI4 64
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_startserver+2336
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_startserver+2336+48
+CNSTU4 8194
+ASGNU4
+ADDRGP4 s_startserver+2336+16
+CNSTI4 502
+ASGNI4
+ADDRGP4 s_startserver+2336+20
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_startserver+2336+4
+ADDRGP4 $590
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_startserver+2404
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_startserver+2404+48
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_startserver+2404+16
+CNSTI4 502
+ASGNI4
+ADDRGP4 s_startserver+2404+20
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_startserver+2404+4
+ADDRGP4 $600
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_startserver+2808
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_startserver+2808+48
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_startserver+2808+16
+CNSTI4 502
+ASGNI4
+ADDRGP4 s_startserver+2808+20
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_startserver+2808+4
+ADDRGP4 $610
+ASGNP4
+ADDRGP4 $375
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_startserver+2808+64
+ADDRLP4 40
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_startserver+1208
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_startserver+1208+48
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_startserver+1208+16
+CNSTI4 502
+ASGNI4
+ADDRGP4 s_startserver+1208+20
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_startserver+1208+4
+ADDRGP4 $622
+ASGNP4
+ADDRGP4 s_startserver+1208+80
+ADDRGP4 dedicated_list
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_startserver+1664
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_startserver+1664+4
+ADDRGP4 $628
+ASGNP4
+ADDRGP4 s_startserver+1664+48
+CNSTU4 34
+ASGNU4
+ADDRGP4 s_startserver+1664+16
+CNSTI4 502
+ASGNI4
+ADDRGP4 s_startserver+1664+20
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_startserver+1664+64+8
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_startserver+1664+64+268
+CNSTI4 3
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_startserver+1328
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_startserver+1328+4
+ADDRGP4 $644
+ASGNP4
+ADDRGP4 s_startserver+1328+48
+CNSTU4 34
+ASGNU4
+ADDRGP4 s_startserver+1328+16
+CNSTI4 502
+ASGNI4
+ADDRGP4 s_startserver+1328+20
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_startserver+1328+64+8
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_startserver+1328+64+268
+CNSTI4 3
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_startserver+2000
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_startserver+2000+4
+ADDRGP4 $660
+ASGNP4
+ADDRGP4 s_startserver+2000+48
+CNSTU4 34
+ASGNU4
+ADDRGP4 s_startserver+2000+16
+CNSTI4 502
+ASGNI4
+ADDRGP4 s_startserver+2000+20
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_startserver+2000+64+8
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_startserver+2000+64+268
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_startserver+2876
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_startserver+2876+4
+ADDRGP4 $676
+ASGNP4
+ADDRGP4 s_startserver+2876+48
+CNSTU4 34
+ASGNU4
+ADDRGP4 s_startserver+2876+16
+CNSTI4 502
+ASGNI4
+ADDRGP4 s_startserver+2876+20
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_startserver+2876+64+8
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_startserver+2876+64+268
+CNSTI4 3
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 20
+ADDI4
+ASGNI4
+ADDRGP4 s_startserver+3212
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+3212+4
+ADDRGP4 $692
+ASGNP4
+ADDRGP4 s_startserver+3212+48
+CNSTU4 132
+ASGNU4
+ADDRGP4 s_startserver+3212+52
+ADDRGP4 StartServer_MenuEvent
+ASGNP4
+ADDRGP4 s_startserver+3212+12
+CNSTI4 32
+ASGNI4
+ADDRGP4 s_startserver+3212+64
+ADDRGP4 $701
+ASGNP4
+ADDRGP4 s_startserver+3212+16
+CNSTI4 443
+ASGNI4
+ADDRGP4 s_startserver+3212+20
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_startserver+3212+80
+CNSTI4 118
+ASGNI4
+ADDRGP4 s_startserver+3212+84
+CNSTI4 22
+ASGNI4
+ADDRGP4 s_startserver+3212+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_startserver+3404
+CNSTI4 11
+ASGNI4
+ADDRGP4 s_startserver+3404+76
+CNSTI4 870
+ASGNI4
+ADDRGP4 s_startserver+3404+80
+CNSTI4 655
+ASGNI4
+ADDRGP4 s_startserver+3404+84
+CNSTI4 135
+ASGNI4
+ADDRGP4 s_startserver+3404+88
+CNSTI4 97
+ASGNI4
+ADDRGP4 $723
+ARGP4
+ADDRLP4 44
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_startserver+3404+64
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 $726
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 s_startserver+3404+72
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 s_startserver+3404+52
+ADDRGP4 StartServer_MenuEvent
+ASGNP4
+ADDRGP4 s_startserver+3404+12
+CNSTI4 21
+ASGNI4
+ADDRGP4 s_startserver+3512
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+3512+48
+CNSTU4 1050628
+ASGNU4
+ADDRGP4 s_startserver+3512+16
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_startserver+3512+20
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_startserver+3512+80
+CNSTI4 640
+ASGNI4
+ADDRGP4 s_startserver+3512+84
+CNSTI4 480
+ASGNI4
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+3512
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+296
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRLP4 52
+ADDRGP4 s_startserver+296+32
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 8
+SUBI4
+ASGNI4
+ADDRLP4 56
+ADDRGP4 s_startserver+296+24
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 8
+ADDI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $748
+ADDRGP4 s_startserver
+ARGP4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+416
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $749
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $748
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+992
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+1100
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+2472
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+2336
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+2404
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+2808
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+1208
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+1664
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+1328
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+2000
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+2876
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+3212
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+3404
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+3308
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 $376
+ARGP4
+ADDRLP4 60
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 s_startserver+2472+64+12
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $365
+ARGP4
+ADDRLP4 64
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 s_startserver+1328+64+12
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $366
+ARGP4
+ADDRLP4 68
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 s_startserver+1664+64+12
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $363
+ARGP4
+ADDRLP4 72
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 s_startserver+2000+64+12
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $371
+ARGP4
+ADDRLP4 76
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 s_startserver+2876+64+12
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTP4 0
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 StartServer_GametypeEvent
+CALLV
+pop
+LABELV $453
+endproc StartServer_MenuInit 80 12
+export StartServer_Cache
+proc StartServer_Cache 108 16
+ADDRGP4 $723
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $726
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $515
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $518
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $534
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $537
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $545
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $554
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $692
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $701
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $501
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $798
+ADDRGP4 $803
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+10416
+ADDP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+LABELV $799
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LTI4 $798
+ADDRLP4 84
+ADDRGP4 UI_GetNumArenas
+CALLI4
+ASGNI4
+ADDRGP4 s_startserver+3616
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $808
+JUMPV
+LABELV $805
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 88
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 68
+ADDRLP4 88
+INDIRP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRGP4 $261
+ARGP4
+ADDRLP4 92
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 s_startserver+3628
+ADDP4
+ARGP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRGP4 $256
+ARGP4
+ADDRLP4 96
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 GametypeBits
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+7724
+ADDP4
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $136
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 s_startserver+3628
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 104
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 0
+NEI4 $814
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $140
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 s_startserver+3628
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $814
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $142
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 s_startserver+3628
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $806
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $808
+ADDRLP4 0
+INDIRI4
+ADDRGP4 s_startserver+3616
+INDIRI4
+LTI4 $805
+ADDRLP4 88
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+3624
+ADDRGP4 s_startserver+3616
+INDIRI4
+ADDRLP4 88
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+ADDRLP4 88
+INDIRI4
+DIVI4
+ASGNI4
+LABELV $797
+endproc StartServer_Cache 108 16
+export UI_StartServerMenu
+proc UI_StartServerMenu 0 4
+ADDRGP4 StartServer_MenuInit
+CALLV
+pop
+ADDRGP4 s_startserver+3608
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $820
+endproc UI_StartServerMenu 0 4
+data
+align 4
+LABELV botSkill_list
+address $823
+address $824
+address $825
+address $826
+address $827
+byte 4 0
+code
+proc UI_BotSelectMenu_BuildList 12 16
+ADDRGP4 botSelectInfo+7552
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRGP4 UI_GetNumBots
+CALLI4
+ASGNI4
+ADDRGP4 botSelectInfo+7548
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 botSelectInfo+7556
+ADDRGP4 botSelectInfo+7548
+INDIRI4
+CNSTI4 16
+DIVI4
+ASGNI4
+ADDRGP4 botSelectInfo+7548
+INDIRI4
+CNSTI4 16
+MODI4
+CNSTI4 0
+EQI4 $833
+ADDRLP4 8
+ADDRGP4 botSelectInfo+7556
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $833
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $840
+JUMPV
+LABELV $837
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botSelectInfo+7564
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $838
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $840
+ADDRLP4 0
+INDIRI4
+ADDRGP4 botSelectInfo+7548
+INDIRI4
+LTI4 $837
+ADDRGP4 botSelectInfo+7564
+ARGP4
+ADDRGP4 botSelectInfo+7548
+INDIRI4
+CVIU4 4
+ARGU4
+CNSTU4 4
+ARGU4
+ADDRGP4 BotListCompare
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+LABELV $828
+endproc UI_BotSelectMenu_BuildList 12 16
+proc ServerPlayerIcon 80 20
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 68
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $847
+ADDRLP4 72
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 72
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $848
+JUMPV
+LABELV $847
+ADDRLP4 0
+ADDRGP4 $849
+ASGNP4
+LABELV $848
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $850
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $851
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $849
+ARGP4
+ADDRLP4 76
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $851
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $853
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $851
+LABELV $846
+endproc ServerPlayerIcon 80 20
+proc UI_BotSelectMenu_UpdateGrid 32 12
+ADDRLP4 4
+ADDRGP4 botSelectInfo+7552
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $856
+ADDRLP4 4
+INDIRI4
+ADDRGP4 botSelectInfo+7548
+INDIRI4
+GEI4 $860
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botSelectInfo+7564
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 UI_GetBotInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $864
+ARGP4
+ADDRLP4 16
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 botSelectInfo+11660
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 ServerPlayerIcon
+CALLV
+pop
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $867
+ARGP4
+ADDRLP4 20
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 botSelectInfo+12684
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 botSelectInfo+12684
+ADDP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+380+4
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 botSelectInfo+11660
+ADDP4
+ASGNP4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3452+72
+ADDP4
+ADDRGP4 color_orange
+ASGNP4
+ADDRLP4 28
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1916+48
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 4294950911
+BANDU4
+ASGNU4
+ADDRGP4 $861
+JUMPV
+LABELV $860
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+380+4
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 12
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1916+48
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 botSelectInfo+12684
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $861
+ADDRLP4 12
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+380+48
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 4294967231
+BANDU4
+ASGNU4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+380+72
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1916+48
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 256
+BORU4
+ASGNU4
+LABELV $857
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $856
+ADDRLP4 0
+ADDRGP4 botSelectInfo+7560
+INDIRI4
+CNSTI4 16
+MODI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+380+48
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 64
+BORU4
+ASGNU4
+ADDRLP4 20
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1916+48
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRU4
+CNSTU4 4294967039
+BANDU4
+ASGNU4
+ADDRGP4 botSelectInfo+7556
+INDIRI4
+CNSTI4 1
+LEI4 $892
+ADDRGP4 botSelectInfo+7552
+INDIRI4
+CNSTI4 0
+LEI4 $895
+ADDRLP4 24
+ADDRGP4 botSelectInfo+4796+48
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 4294950911
+BANDU4
+ASGNU4
+ADDRGP4 $896
+JUMPV
+LABELV $895
+ADDRLP4 24
+ADDRGP4 botSelectInfo+4796+48
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+LABELV $896
+ADDRGP4 botSelectInfo+7552
+INDIRI4
+ADDRGP4 botSelectInfo+7556
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $902
+ADDRLP4 24
+ADDRGP4 botSelectInfo+4904+48
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 4294950911
+BANDU4
+ASGNU4
+ADDRGP4 $893
+JUMPV
+LABELV $902
+ADDRLP4 24
+ADDRGP4 botSelectInfo+4904+48
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRGP4 $893
+JUMPV
+LABELV $892
+ADDRLP4 24
+ADDRGP4 botSelectInfo+4796+48
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRLP4 28
+ADDRGP4 botSelectInfo+4904+48
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+LABELV $893
+LABELV $854
+endproc UI_BotSelectMenu_UpdateGrid 32 12
+proc UI_BotSelectMenu_LeftEvent 4 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $915
+ADDRGP4 $914
+JUMPV
+LABELV $915
+ADDRGP4 botSelectInfo+7552
+INDIRI4
+CNSTI4 0
+LEI4 $917
+ADDRLP4 0
+ADDRGP4 botSelectInfo+7552
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 botSelectInfo+7560
+ADDRGP4 botSelectInfo+7552
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRGP4 UI_BotSelectMenu_UpdateGrid
+CALLV
+pop
+LABELV $917
+LABELV $914
+endproc UI_BotSelectMenu_LeftEvent 4 0
+proc UI_BotSelectMenu_RightEvent 4 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $924
+ADDRGP4 $923
+JUMPV
+LABELV $924
+ADDRGP4 botSelectInfo+7552
+INDIRI4
+ADDRGP4 botSelectInfo+7556
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $926
+ADDRLP4 0
+ADDRGP4 botSelectInfo+7552
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 botSelectInfo+7560
+ADDRGP4 botSelectInfo+7552
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRGP4 UI_BotSelectMenu_UpdateGrid
+CALLV
+pop
+LABELV $926
+LABELV $923
+endproc UI_BotSelectMenu_RightEvent 4 0
+export getNumSelectedBots
+proc getNumSelectedBots 8 0
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $934
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+7980
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $938
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $938
+LABELV $935
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $934
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $933
+endproc getNumSelectedBots 8 0
+export getSlotsLeft
+proc getSlotsLeft 12 4
+ADDRGP4 s_startserver+2000+64+12
+ARGP4
+ADDRLP4 4
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_startserver+1208+68
+INDIRI4
+CNSTI4 0
+NEI4 $945
+ADDRLP4 8
+ADDRGP4 getNumSelectedBots
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+CNSTI4 1
+SUBI4
+RETI4
+ADDRGP4 $941
+JUMPV
+LABELV $945
+ADDRLP4 8
+ADDRGP4 getNumSelectedBots
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+RETI4
+LABELV $941
+endproc getSlotsLeft 12 4
+export UI_BotSelectMenu_UpdateList
+proc UI_BotSelectMenu_UpdateList 40 8
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $950
+ADDRLP4 4
+ADDRGP4 $954
+ASGNP4
+ADDRGP4 $958
+JUMPV
+LABELV $955
+ADDRLP4 0
+INDIRI4
+ADDRGP4 botSelectInfo+7544
+INDIRI4
+GEI4 $959
+ADDRGP4 $956
+JUMPV
+LABELV $959
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+7980
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $962
+ADDRLP4 4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+7980
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $957
+JUMPV
+LABELV $962
+LABELV $956
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $958
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $955
+LABELV $957
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $966
+CNSTI4 84
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+5012+64
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 84
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+5012+48
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+ADDRGP4 s_startserver+296+68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 gametype_remap
+ADDP4
+INDIRI4
+CNSTI4 5
+LTI4 $972
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+7980-36+32
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $976
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+7980-36+32
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $976
+CNSTI4 84
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+6020+64
+ADDP4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+7980-36+32
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 teamstrs
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 84
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+6020+48
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+7980-36+32
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $997
+ADDRLP4 24
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 $998
+JUMPV
+LABELV $997
+ADDRLP4 24
+ADDRGP4 color_blue
+ASGNP4
+LABELV $998
+CNSTI4 84
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+6020+72
+ADDP4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $967
+JUMPV
+LABELV $972
+ADDRLP4 28
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+7980-36+32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $1005
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+EQI4 $1007
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+EQI4 $1008
+ADDRGP4 $999
+JUMPV
+LABELV $999
+LABELV $1005
+ADDRLP4 20
+ADDRGP4 $1006
+ASGNP4
+ADDRLP4 24
+ADDRGP4 color_white
+ASGNP4
+ADDRGP4 $1000
+JUMPV
+LABELV $1007
+ADDRLP4 20
+ADDRGP4 $87
+ASGNP4
+ADDRLP4 24
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 $1000
+JUMPV
+LABELV $1008
+ADDRLP4 20
+ADDRGP4 $88
+ASGNP4
+ADDRLP4 24
+ADDRGP4 color_blue
+ASGNP4
+LABELV $1000
+ADDRLP4 36
+CNSTI4 84
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+6020+48
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+CNSTI4 84
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+6020+64
+ADDP4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+CNSTI4 84
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+6020+72
+ADDP4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $967
+JUMPV
+LABELV $966
+ADDRLP4 16
+CNSTI4 84
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+5012+48
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRLP4 20
+CNSTI4 84
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+6020+48
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+LABELV $967
+LABELV $951
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 12
+LTI4 $950
+ADDRLP4 16
+ADDRGP4 getSlotsLeft
+CALLI4
+ASGNI4
+ADDRGP4 $1021
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 botSelectInfo+7364+64
+ADDRLP4 20
+INDIRP4
+ASGNP4
+LABELV $949
+endproc UI_BotSelectMenu_UpdateList 40 8
+proc UI_BotSelectMenu_BotEvent 20 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $1023
+ADDRGP4 $1022
+JUMPV
+LABELV $1023
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1025
+ADDRLP4 8
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+380+48
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 4294967231
+BANDU4
+ASGNU4
+ADDRLP4 12
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1916+48
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 256
+BORU4
+ASGNU4
+LABELV $1026
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $1025
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+380+48
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 64
+BORU4
+ASGNU4
+ADDRLP4 12
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1916+48
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 4294967039
+BANDU4
+ASGNU4
+ADDRGP4 botSelectInfo+7560
+ADDRGP4 botSelectInfo+7552
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 getSlotsLeft
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+GTI4 $1039
+ADDRGP4 $1022
+JUMPV
+LABELV $1039
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1041
+CNSTI4 36
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+7980
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1045
+ADDRGP4 $1042
+JUMPV
+LABELV $1045
+CNSTI4 36
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+7980
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 botSelectInfo+12684
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_startserver+296+68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 gametype_remap
+ADDP4
+INDIRI4
+CNSTI4 5
+LTI4 $1050
+CNSTI4 36
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+7980+32
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1043
+JUMPV
+LABELV $1050
+CNSTI4 36
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+7980+32
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1043
+JUMPV
+LABELV $1042
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $1041
+LABELV $1043
+ADDRGP4 UI_BotSelectMenu_UpdateList
+CALLV
+pop
+LABELV $1022
+endproc UI_BotSelectMenu_BotEvent 20 12
+proc UI_BotSelectMenu_BackEvent 0 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $1059
+ADDRGP4 $1058
+JUMPV
+LABELV $1059
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $1058
+endproc UI_BotSelectMenu_BackEvent 0 0
+export UI_BotSelectMenu_Cache
+proc UI_BotSelectMenu_Cache 0 4
+ADDRGP4 $545
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $554
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1062
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1063
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1064
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1065
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1066
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1067
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1068
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $1061
+endproc UI_BotSelectMenu_Cache 0 4
+proc UI_BotSelectMenu_SelectBotName 44 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $1070
+ADDRGP4 $1069
+JUMPV
+LABELV $1070
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRGP4 botSelectInfo+7544
+INDIRI4
+ADDI4
+ASGNI4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+7980
+ADDP4
+ARGP4
+ADDRGP4 $954
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $1077
+JUMPV
+LABELV $1074
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+7980+36
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1078
+ADDRGP4 $1076
+JUMPV
+LABELV $1078
+ADDRLP4 4
+ARGP4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+7980
+ADDP4
+ARGP4
+CNSTU4 36
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 40
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 s_startserver+7980
+ADDP4
+ARGP4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 s_startserver+7980+36
+ADDP4
+ARGP4
+CNSTU4 36
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+7980+36
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTU4 36
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1075
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1077
+ADDRLP4 0
+INDIRI4
+CNSTI4 63
+LTI4 $1074
+LABELV $1076
+ADDRGP4 UI_BotSelectMenu_UpdateList
+CALLV
+pop
+LABELV $1069
+endproc UI_BotSelectMenu_SelectBotName 44 12
+proc UI_BotSelectMenu_SelectBotTeam 12 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $1089
+ADDRGP4 $1088
+JUMPV
+LABELV $1089
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRGP4 botSelectInfo+7544
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 s_startserver+296+68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 gametype_remap
+ADDP4
+INDIRI4
+CNSTI4 5
+LTI4 $1092
+ADDRLP4 8
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 s_startserver+7980+32
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1101
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $1102
+JUMPV
+LABELV $1101
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $1102
+ADDRLP4 8
+INDIRI4
+ADDRGP4 s_startserver+7980+32
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $1093
+JUMPV
+LABELV $1092
+ADDRLP4 4
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+7980+32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LEI4 $1105
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1105
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+7980+32
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $1093
+ADDRGP4 UI_BotSelectMenu_UpdateList
+CALLV
+pop
+LABELV $1088
+endproc UI_BotSelectMenu_SelectBotTeam 12 0
+proc UI_BotSelectMenu_ListUp 4 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $1110
+ADDRGP4 $1109
+JUMPV
+LABELV $1110
+ADDRGP4 botSelectInfo+7544
+INDIRI4
+CNSTI4 0
+LEI4 $1112
+ADDRLP4 0
+ADDRGP4 botSelectInfo+7544
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1112
+ADDRGP4 UI_BotSelectMenu_UpdateList
+CALLV
+pop
+LABELV $1109
+endproc UI_BotSelectMenu_ListUp 4 0
+proc UI_BotSelectMenu_ListDown 4 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $1117
+ADDRGP4 $1116
+JUMPV
+LABELV $1117
+ADDRGP4 botSelectInfo+7544
+INDIRI4
+CNSTI4 52
+GEI4 $1119
+ADDRLP4 0
+ADDRGP4 botSelectInfo+7544
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1119
+ADDRGP4 UI_BotSelectMenu_UpdateList
+CALLV
+pop
+LABELV $1116
+endproc UI_BotSelectMenu_ListDown 4 0
+proc UI_BotSelectMenu_BotSkillChanged 0 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $1124
+ADDRGP4 $1123
+JUMPV
+LABELV $1124
+ADDRGP4 s_startserver+10284
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1123
+endproc UI_BotSelectMenu_BotSkillChanged 0 0
+proc UI_BotSelectMenu_DrawBotIcon 48 20
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1128
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1128
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1130
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1130
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+LABELV $1130
+LABELV $1128
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1132
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 32
+INDIRP4
+CVPU4 4
+EQU4 $1134
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 36
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ARGF4
+ADDRGP4 $1136
+ARGP4
+ADDRGP4 UI_DrawNamedPic
+CALLV
+pop
+LABELV $1134
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $1132
+LABELV $1127
+endproc UI_BotSelectMenu_DrawBotIcon 48 20
+proc UI_BotSelectMenu_Init 64 12
+ADDRGP4 botSelectInfo
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 12940
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 botSelectInfo+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 botSelectInfo+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 botSelectInfo+284
+CNSTI4 49152
+ASGNI4
+ADDRGP4 UI_BotSelectMenu_Cache
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 54
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $1144
+JUMPV
+LABELV $1141
+ADDRLP4 4
+CNSTI4 51
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $1145
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+380
+ADDP4
+CNSTI4 6
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+380+48
+ADDP4
+CNSTU4 4
+ASGNU4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+380+16
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+380+20
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+380+4
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 botSelectInfo+11660
+ADDP4
+ASGNP4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+380+80
+ADDP4
+CNSTI4 64
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+380+84
+ADDP4
+CNSTI4 64
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+380+64
+ADDP4
+ADDRGP4 $1065
+ASGNP4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+380+88
+ADDP4
+ADDRGP4 colorRed
+ASGNP4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+380+52
+ADDP4
+ADDRGP4 UI_BotSelectMenu_BotEvent
+ASGNP4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+380+12
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+380+60
+ADDP4
+ADDRGP4 UI_BotSelectMenu_DrawBotIcon
+ASGNP4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1916
+ADDP4
+CNSTI4 6
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1916+48
+ADDP4
+CNSTU4 33028
+ASGNU4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1916+52
+ADDP4
+ADDRGP4 UI_BotSelectMenu_BotEvent
+ASGNP4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1916+12
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1916+16
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+SUBI4
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1916+20
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 16
+SUBI4
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1916+24
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1916+28
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1916+32
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+ADDI4
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1916+36
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+ADDI4
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1916+80
+ADDP4
+CNSTI4 128
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1916+84
+ADDP4
+CNSTI4 128
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1916+64
+ADDP4
+ADDRGP4 $1064
+ASGNP4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1916+88
+ADDP4
+ADDRGP4 colorRed
+ASGNP4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3452
+ADDP4
+CNSTI4 7
+ASGNI4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3452+48
+ADDP4
+CNSTU4 2
+ASGNU4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3452+16
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3452+20
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+ADDI4
+ASGNI4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3452+64
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 botSelectInfo+12684
+ADDP4
+ASGNP4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3452+72
+ADDP4
+ADDRGP4 color_orange
+ASGNP4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3452+68
+ADDP4
+CNSTI4 17
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 91
+ADDI4
+ASGNI4
+LABELV $1146
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+LTI4 $1145
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 85
+ADDI4
+ASGNI4
+LABELV $1142
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1144
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+LTI4 $1141
+ADDRGP4 botSelectInfo+4796
+CNSTI4 11
+ASGNI4
+ADDRGP4 botSelectInfo+4796+76
+CNSTI4 233
+ASGNI4
+ADDRGP4 botSelectInfo+4796+80
+CNSTI4 640
+ASGNI4
+ADDRGP4 botSelectInfo+4796+84
+CNSTI4 99
+ASGNI4
+ADDRGP4 botSelectInfo+4796+88
+CNSTI4 38
+ASGNI4
+ADDRGP4 $515
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 botSelectInfo+4796+64
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $518
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 botSelectInfo+4796+72
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 botSelectInfo+4796+52
+ADDRGP4 UI_BotSelectMenu_LeftEvent
+ASGNP4
+ADDRGP4 botSelectInfo+4904
+CNSTI4 11
+ASGNI4
+ADDRGP4 botSelectInfo+4904+76
+CNSTI4 372
+ASGNI4
+ADDRGP4 botSelectInfo+4904+80
+CNSTI4 640
+ASGNI4
+ADDRGP4 botSelectInfo+4904+84
+CNSTI4 98
+ASGNI4
+ADDRGP4 botSelectInfo+4904+88
+CNSTI4 38
+ASGNI4
+ADDRGP4 $534
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 botSelectInfo+4904+64
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 $537
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 botSelectInfo+4904+72
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 botSelectInfo+4904+52
+ADDRGP4 UI_BotSelectMenu_RightEvent
+ASGNP4
+ADDRLP4 8
+CNSTI4 222
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $1244
+CNSTI4 84
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+5012
+ADDP4
+CNSTI4 12
+ASGNI4
+CNSTI4 84
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+5012+76
+ADDP4
+CNSTF4 1098907648
+ASGNF4
+CNSTI4 84
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+5012+48
+ADDP4
+CNSTU4 2
+ASGNU4
+CNSTI4 84
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+5012+16
+ADDP4
+CNSTI4 430
+ASGNI4
+CNSTI4 84
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+5012+20
+ADDP4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDI4
+ASGNI4
+CNSTI4 84
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+5012+64
+ADDP4
+ADDRGP4 $1259
+ASGNP4
+CNSTI4 84
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+5012+72
+ADDP4
+ADDRGP4 color_white
+ASGNP4
+CNSTI4 84
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+5012+80
+ADDP4
+ADDRGP4 color_orange
+ASGNP4
+CNSTI4 84
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+5012+12
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+CNSTI4 84
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+5012+52
+ADDP4
+ADDRGP4 UI_BotSelectMenu_SelectBotName
+ASGNP4
+CNSTI4 84
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+6020
+ADDP4
+CNSTI4 12
+ASGNI4
+CNSTI4 84
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+6020+76
+ADDP4
+CNSTF4 1098907648
+ASGNF4
+CNSTI4 84
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+6020+48
+ADDP4
+CNSTU4 2
+ASGNU4
+CNSTI4 84
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+6020+16
+ADDP4
+CNSTI4 550
+ASGNI4
+CNSTI4 84
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+6020+20
+ADDP4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDI4
+ASGNI4
+CNSTI4 84
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+6020+64
+ADDP4
+ADDRGP4 $1279
+ASGNP4
+CNSTI4 84
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+6020+72
+ADDP4
+ADDRGP4 color_blue
+ASGNP4
+CNSTI4 84
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+6020+80
+ADDP4
+ADDRGP4 color_white
+ASGNP4
+CNSTI4 84
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+6020+12
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+CNSTI4 84
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+6020+52
+ADDP4
+ADDRGP4 UI_BotSelectMenu_SelectBotTeam
+ASGNP4
+LABELV $1245
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 12
+LTI4 $1244
+ADDRLP4 8
+CNSTI4 768
+ADDRLP4 8
+INDIRI4
+MULI4
+CNSTI4 480
+DIVI4
+ASGNI4
+ADDRGP4 botSelectInfo+7028
+CNSTI4 11
+ASGNI4
+ADDRGP4 botSelectInfo+7028+76
+CNSTI4 974
+ASGNI4
+ADDRGP4 botSelectInfo+7028+80
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 botSelectInfo+7028+84
+CNSTI4 38
+ASGNI4
+ADDRGP4 botSelectInfo+7028+88
+CNSTI4 100
+ASGNI4
+ADDRGP4 $1299
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 botSelectInfo+7028+64
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $1302
+ARGP4
+ADDRLP4 44
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 botSelectInfo+7028+72
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 botSelectInfo+7028+52
+ADDRGP4 UI_BotSelectMenu_ListUp
+ASGNP4
+ADDRGP4 botSelectInfo+7136
+CNSTI4 11
+ASGNI4
+ADDRGP4 botSelectInfo+7136+76
+CNSTI4 974
+ASGNI4
+ADDRGP4 botSelectInfo+7136+80
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+CNSTF4 1134139802
+ADDF4
+CNSTF4 1120272384
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRGP4 botSelectInfo+7136+84
+CNSTI4 38
+ASGNI4
+ADDRGP4 botSelectInfo+7136+88
+CNSTI4 99
+ASGNI4
+ADDRGP4 $1316
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 botSelectInfo+7136+64
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 $1319
+ARGP4
+ADDRLP4 52
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 botSelectInfo+7136+72
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRGP4 botSelectInfo+7136+52
+ADDRGP4 UI_BotSelectMenu_ListDown
+ASGNP4
+ADDRGP4 botSelectInfo+7244
+CNSTI4 3
+ASGNI4
+ADDRGP4 botSelectInfo+7244+48
+CNSTU4 2
+ASGNU4
+ADDRGP4 botSelectInfo+7244+4
+ADDRGP4 $1327
+ASGNP4
+ADDRGP4 botSelectInfo+7244+16
+CNSTI4 485
+ASGNI4
+ADDRGP4 botSelectInfo+7244+20
+CNSTI4 420
+ASGNI4
+ADDRGP4 botSelectInfo+7244+80
+ADDRGP4 botSkill_list
+ASGNP4
+ADDRGP4 botSelectInfo+7244+68
+CNSTI4 1
+ASGNI4
+ADDRGP4 botSelectInfo+7244+52
+ADDRGP4 UI_BotSelectMenu_BotSkillChanged
+ASGNP4
+ADDRGP4 s_startserver+10284
+CNSTI4 2
+ASGNI4
+ADDRGP4 botSelectInfo+7364
+CNSTI4 12
+ASGNI4
+ADDRGP4 botSelectInfo+7364+48
+CNSTU4 2
+ASGNU4
+ADDRLP4 56
+ADDRGP4 getSlotsLeft
+CALLI4
+ASGNI4
+ADDRGP4 $1021
+ARGP4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 botSelectInfo+7364+64
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRGP4 botSelectInfo+7364+16
+CNSTI4 430
+ASGNI4
+ADDRGP4 botSelectInfo+7364+20
+CNSTI4 440
+ASGNI4
+ADDRGP4 botSelectInfo+7364+72
+ADDRGP4 color_yellow
+ASGNP4
+ADDRGP4 botSelectInfo+7448
+CNSTI4 6
+ASGNI4
+ADDRGP4 botSelectInfo+7448+4
+ADDRGP4 $545
+ASGNP4
+ADDRGP4 botSelectInfo+7448+48
+CNSTU4 260
+ASGNU4
+ADDRGP4 botSelectInfo+7448+52
+ADDRGP4 UI_BotSelectMenu_BackEvent
+ASGNP4
+ADDRGP4 botSelectInfo+7448+16
+CNSTI4 552
+ASGNI4
+ADDRGP4 botSelectInfo+7448+20
+CNSTI4 440
+ASGNI4
+ADDRGP4 botSelectInfo+7448+80
+CNSTI4 80
+ASGNI4
+ADDRGP4 botSelectInfo+7448+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 botSelectInfo+7448+64
+ADDRGP4 $554
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $1367
+ADDRGP4 botSelectInfo
+ARGP4
+CNSTI4 96
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+380
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $1368
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 16
+LTI4 $1367
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 botSelectInfo+4796
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 botSelectInfo+4904
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $1374
+ADDRGP4 botSelectInfo
+ARGP4
+CNSTI4 84
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+5012
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+CNSTI4 84
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+6020
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $1375
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 12
+LTI4 $1374
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 botSelectInfo+7028
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 botSelectInfo+7136
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 botSelectInfo+7244
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 botSelectInfo+7364
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 botSelectInfo+7448
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 UI_BotSelectMenu_BuildList
+CALLV
+pop
+ADDRGP4 UI_BotSelectMenu_UpdateList
+CALLV
+pop
+ADDRGP4 botSelectInfo+7552
+ADDRGP4 botSelectInfo+7560
+INDIRI4
+CNSTI4 16
+DIVI4
+ASGNI4
+ADDRGP4 UI_BotSelectMenu_UpdateGrid
+CALLV
+pop
+LABELV $1137
+endproc UI_BotSelectMenu_Init 64 12
+export UI_BotSelectMenu
+proc UI_BotSelectMenu 0 4
+ADDRGP4 UI_BotSelectMenu_Init
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $1387
+endproc UI_BotSelectMenu 0 4
+bss
+align 4
+LABELV botSelectInfo
+skip 12940
+align 4
+LABELV s_startserver
+skip 10456
+import UI_HelpMenu_Cache
+import UI_HelpMenu_f
+import UI_HelpMenu
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import UI_InitGameinfo
+import UI_GetNumBots
+import UI_GetBotInfoByNumber
+import UI_GetNumArenas
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_VoiceIngame
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_GetVoiceGainClient
+import trap_GetVoiceMuteAll
+import trap_GetVoiceMuteClient
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_CIN_SetExtents
+import trap_CIN_StopCinematic
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_PlayCinematic
+import trap_RealTime
+import trap_S_StartBackgroundTrack
+import trap_S_StopBackgroundTrack
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_SaveCachedServers
+import trap_LAN_LoadCachedServers
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import BotListCompare
+import uis
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString2
+import UI_AutoWrappedString_LineCount
+import UI_DrawString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawIngameBG
+import UI_DrawStringNS
+import UI_ModelIcon
+import UI_DrawHandlePic1024
+import UI_AdjustFrom1024
+import UI_StopMusic
+import UI_StartCreditMusic
+import UI_StartMusic
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_ClearModelCache
+import UI_PrecacheClientModelname
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import UI_SpecifyPasswordMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import Demos_Cache
+import UI_DemosMenu
+import SetDefaultBinds_onUnusedKeys
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import SetupDefaultMenu_Cache
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import Music_NextTrack
+import Music_TriggerRestart
+import Music_Check
+import MusicMenu_Cache
+import MusicMenu_Open
+import MusicMenu_Shutdown
+import MusicMenu_Init
+import UI_CallVoteMenu
+import UI_InGameMenu
+import InGame_Cache
+import UI_SecretMenu
+import UI_InitBigCredits
+import UI_BigCredits_Cache
+import UI_CreditMenu
+import ExitMenu_Cache
+import ExitMenu_Init
+import UI_MainMenu
+import MainMenu_Cache
+import UI_UpdateCvars
+import UI_RegisterCvars
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import listbar_bluecolor
+import text_color_bluehighlight
+import text_color_bluenormal
+import text_color_ighighlight
+import text_color_ignormal
+import listbar_igcolor
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_lightOrange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_click_sound
+import menu_switch_sound
+import menu_move_sound
+import ScrollList_Key
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import wop_AutoBindUnusedKeys
+import wop_AutoswitchSongByNextMap
+import con_notifytime
+import s_wop_restarted
+import syc_logo
+import spraycolor
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_createGametype
+import ui_browserHidePrivate
+import ui_browserOnlyHumans
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $1327
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 58
+byte 1 0
+align 1
+LABELV $1319
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 49
+byte 1 0
+align 1
+LABELV $1316
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 48
+byte 1 0
+align 1
+LABELV $1302
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 117
+byte 1 112
+byte 1 49
+byte 1 0
+align 1
+LABELV $1299
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 117
+byte 1 112
+byte 1 48
+byte 1 0
+align 1
+LABELV $1279
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $1259
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $1136
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $1068
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 103
+byte 1 115
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 114
+byte 1 0
+align 1
+LABELV $1067
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 103
+byte 1 115
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 108
+byte 1 0
+align 1
+LABELV $1066
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 103
+byte 1 115
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $1065
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1064
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $1063
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $1062
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $1021
+byte 1 79
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 83
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 50
+byte 1 100
+byte 1 0
+align 1
+LABELV $1006
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $954
+byte 1 0
+align 1
+LABELV $867
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $864
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $853
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $850
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $849
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $827
+byte 1 66
+byte 1 114
+byte 1 117
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 78
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $826
+byte 1 80
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $825
+byte 1 77
+byte 1 111
+byte 1 115
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 66
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $824
+byte 1 70
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 80
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $823
+byte 1 75
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $803
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $726
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 49
+byte 1 0
+align 1
+LABELV $723
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 48
+byte 1 0
+align 1
+LABELV $701
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 49
+byte 1 0
+align 1
+LABELV $692
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 48
+byte 1 0
+align 1
+LABELV $676
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 76
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 0
+align 1
+LABELV $660
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 83
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 58
+byte 1 0
+align 1
+LABELV $644
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 76
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 58
+byte 1 0
+align 1
+LABELV $628
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 76
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 58
+byte 1 0
+align 1
+LABELV $622
+byte 1 68
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 58
+byte 1 0
+align 1
+LABELV $610
+byte 1 80
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 0
+align 1
+LABELV $600
+byte 1 73
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 80
+byte 1 97
+byte 1 100
+byte 1 58
+byte 1 0
+align 1
+LABELV $590
+byte 1 70
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $568
+byte 1 72
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $554
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 66
+byte 1 116
+byte 1 110
+byte 1 66
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 49
+byte 1 0
+align 1
+LABELV $545
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 66
+byte 1 116
+byte 1 110
+byte 1 66
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 48
+byte 1 0
+align 1
+LABELV $537
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 49
+byte 1 0
+align 1
+LABELV $534
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 48
+byte 1 0
+align 1
+LABELV $518
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 49
+byte 1 0
+align 1
+LABELV $515
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 48
+byte 1 0
+align 1
+LABELV $501
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $452
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $451
+byte 1 76
+byte 1 65
+byte 1 78
+byte 1 0
+align 1
+LABELV $450
+byte 1 78
+byte 1 111
+byte 1 0
+align 1
+LABELV $403
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $397
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 51
+byte 1 10
+byte 1 0
+align 1
+LABELV $396
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 59
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 59
+byte 1 32
+byte 1 118
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $388
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 59
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 118
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $387
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $376
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $375
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $371
+byte 1 103
+byte 1 95
+byte 1 76
+byte 1 80
+byte 1 83
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 108
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $368
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 80
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $367
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $366
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $365
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $364
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $363
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $361
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $360
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $359
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $357
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $356
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $355
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $353
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $352
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $350
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $349
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $326
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $320
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $264
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $261
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $256
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $226
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $223
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $222
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $142
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 66
+byte 1 0
+align 1
+LABELV $140
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $136
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 65
+byte 1 0
+align 1
+LABELV $124
+byte 1 66
+byte 1 66
+byte 1 0
+align 1
+LABELV $121
+byte 1 76
+byte 1 80
+byte 1 83
+byte 1 0
+align 1
+LABELV $118
+byte 1 83
+byte 1 121
+byte 1 67
+byte 1 95
+byte 1 116
+byte 1 112
+byte 1 0
+align 1
+LABELV $115
+byte 1 83
+byte 1 121
+byte 1 67
+byte 1 95
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 0
+align 1
+LABELV $111
+byte 1 67
+byte 1 84
+byte 1 76
+byte 1 0
+align 1
+LABELV $110
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 0
+align 1
+LABELV $107
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $104
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $101
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 0
+align 1
+LABELV $98
+byte 1 70
+byte 1 70
+byte 1 65
+byte 1 0
+align 1
+LABELV $89
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $88
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $87
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $86
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 0
+align 1
+LABELV $85
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $84
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $83
+byte 1 76
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 80
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $82
+byte 1 66
+byte 1 105
+byte 1 103
+byte 1 32
+byte 1 66
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $81
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 84
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 76
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $80
+byte 1 83
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $79
+byte 1 83
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
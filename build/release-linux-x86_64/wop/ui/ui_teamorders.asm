@@ -0,0 +1,2127 @@
+data
+align 4
+LABELV ctfOrders
+address $78
+address $79
+address $80
+address $81
+address $82
+address $83
+address $84
+byte 4 0
+align 4
+LABELV ctfMessages
+address $78
+address $85
+address $86
+address $87
+address $88
+address $89
+address $90
+byte 4 0
+align 4
+LABELV teamOrders
+address $78
+address $80
+address $91
+address $82
+address $83
+address $92
+address $93
+byte 4 0
+align 4
+LABELV teamMessages
+address $78
+address $86
+address $94
+address $88
+address $89
+address $95
+address $90
+byte 4 0
+code
+proc UI_TeamOrdersMenu_BackEvent 0 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $97
+ADDRGP4 $96
+JUMPV
+LABELV $97
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $96
+endproc UI_TeamOrdersMenu_BackEvent 0 0
+proc UI_TeamOrdersMenu_SetList 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+EQI4 $102
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+EQI4 $111
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+EQI4 $118
+ADDRGP4 $100
+JUMPV
+LABELV $100
+LABELV $102
+ADDRGP4 teamOrdersMenuInfo+296+12
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 teamOrdersMenuInfo+296+72
+ADDRGP4 teamOrdersMenuInfo+504
+INDIRI4
+ASGNI4
+ADDRGP4 teamOrdersMenuInfo+296+80
+ADDRGP4 teamOrdersMenuInfo+512
+ASGNP4
+ADDRGP4 $101
+JUMPV
+LABELV $111
+ADDRGP4 teamOrdersMenuInfo+296+12
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 teamOrdersMenuInfo+296+72
+CNSTI4 7
+ASGNI4
+ADDRGP4 teamOrdersMenuInfo+296+80
+ADDRGP4 ctfOrders
+ASGNP4
+ADDRGP4 $101
+JUMPV
+LABELV $118
+ADDRGP4 teamOrdersMenuInfo+296+12
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 teamOrdersMenuInfo+296+72
+CNSTI4 7
+ASGNI4
+ADDRGP4 teamOrdersMenuInfo+296+80
+ADDRGP4 teamOrders
+ASGNP4
+LABELV $101
+ADDRGP4 teamOrdersMenuInfo+296+36
+ADDRGP4 teamOrdersMenuInfo+296+28
+INDIRI4
+CNSTI4 24
+ADDRGP4 teamOrdersMenuInfo+296+72
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+LABELV $99
+endproc UI_TeamOrdersMenu_SetList 4 0
+export UI_TeamOrdersMenu_Key
+proc UI_TeamOrdersMenu_Key 72 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 teamOrdersMenuInfo
+ARGP4
+ADDRLP4 16
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 teamOrdersMenuInfo+296
+CVPU4 4
+EQU4 $132
+ADDRGP4 teamOrdersMenuInfo
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 Menu_DefaultKey
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+RETI4
+ADDRGP4 $131
+JUMPV
+LABELV $132
+ADDRLP4 24
+CNSTI4 161
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $143
+ADDRFP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+GTI4 $150
+LABELV $149
+ADDRFP4 0
+INDIRI4
+CNSTI4 132
+EQI4 $143
+ADDRFP4 0
+INDIRI4
+CNSTI4 133
+EQI4 $146
+ADDRGP4 $135
+JUMPV
+LABELV $150
+ADDRLP4 36
+CNSTI4 167
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $146
+ADDRFP4 0
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LTI4 $135
+LABELV $151
+ADDRFP4 0
+INDIRI4
+CNSTI4 178
+EQI4 $137
+ADDRGP4 $135
+JUMPV
+LABELV $137
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 UI_CursorInRect
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $138
+ADDRLP4 12
+ADDRGP4 uis+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 24
+DIVI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $141
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $131
+JUMPV
+LABELV $141
+LABELV $138
+ADDRGP4 menu_null_sound
+INDIRI4
+RETI4
+ADDRGP4 $131
+JUMPV
+LABELV $143
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $144
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $145
+JUMPV
+LABELV $144
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $145
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $131
+JUMPV
+LABELV $146
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+NEI4 $147
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $148
+JUMPV
+LABELV $147
+ADDRLP4 68
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $148
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $131
+JUMPV
+LABELV $135
+ADDRGP4 teamOrdersMenuInfo
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 Menu_DefaultKey
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+RETI4
+LABELV $131
+endproc UI_TeamOrdersMenu_Key 72 16
+proc UI_TeamOrdersMenu_ListDraw 36 24
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+NEI4 $154
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRGP4 $155
+JUMPV
+LABELV $154
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+LABELV $155
+ADDRLP4 24
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 320
+ASGNI4
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $159
+JUMPV
+LABELV $156
+ADDRLP4 8
+CNSTI4 17
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+NEI4 $160
+ADDRLP4 16
+ADDRGP4 color_orange
+ASGNP4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $161
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+ADDRGP4 $161
+JUMPV
+LABELV $160
+ADDRLP4 16
+ADDRGP4 color_black
+ASGNP4
+LABELV $161
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTF4 1099956224
+ARGF4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawStringNS
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 24
+ADDI4
+ASGNI4
+LABELV $157
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $159
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+LTI4 $156
+LABELV $152
+endproc UI_TeamOrdersMenu_ListDraw 36 24
+proc UI_TeamOrdersMenu_ListEvent 272 16
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $165
+ADDRGP4 $164
+JUMPV
+LABELV $165
+ADDRLP4 264
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 264
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 260
+ADDRLP4 264
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $167
+ADDRGP4 teamOrdersMenuInfo+508
+ADDRLP4 260
+INDIRI4
+ASGNI4
+ADDRGP4 teamOrdersMenuInfo+500
+INDIRI4
+CNSTI4 6
+NEI4 $170
+CNSTI4 11
+ARGI4
+ADDRGP4 UI_TeamOrdersMenu_SetList
+CALLV
+pop
+ADDRGP4 $164
+JUMPV
+LABELV $170
+CNSTI4 12
+ARGI4
+ADDRGP4 UI_TeamOrdersMenu_SetList
+CALLV
+pop
+ADDRGP4 $164
+JUMPV
+LABELV $167
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+NEI4 $173
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ctfMessages
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 teamOrdersMenuInfo+508
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 teamOrdersMenuInfo+548
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $174
+JUMPV
+LABELV $173
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 teamMessages
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 teamOrdersMenuInfo+508
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 teamOrdersMenuInfo+548
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $174
+ADDRGP4 $179
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 268
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 268
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $164
+endproc UI_TeamOrdersMenu_ListEvent 272 16
+proc UI_TeamOrdersMenu_BuildBotList 4168 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $181
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 teamOrdersMenuInfo+512
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 teamOrdersMenuInfo+548
+ADDP4
+ASGNP4
+LABELV $182
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 9
+LTI4 $181
+ADDRLP4 1036
+ARGP4
+ADDRGP4 trap_GetClientState
+CALLV
+pop
+ADDRGP4 teamOrdersMenuInfo+548
+ARGP4
+ADDRGP4 $188
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 teamOrdersMenuInfo+504
+CNSTI4 1
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigString
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $190
+ARGP4
+ADDRLP4 4128
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4128
+INDIRP4
+ARGP4
+ADDRLP4 4132
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4120
+ADDRLP4 4132
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $192
+ARGP4
+ADDRLP4 4136
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4136
+INDIRP4
+ARGP4
+ADDRLP4 4140
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 teamOrdersMenuInfo+500
+ADDRLP4 4140
+INDIRI4
+ASGNI4
+ADDRLP4 1036+8
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigString
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $194
+ARGP4
+ADDRLP4 4144
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4124
+ADDRLP4 4144
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $198
+JUMPV
+LABELV $195
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigString
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1036+8
+INDIRI4
+NEI4 $200
+ADDRGP4 $196
+JUMPV
+LABELV $200
+ADDRLP4 4
+ARGP4
+ADDRGP4 $203
+ARGP4
+ADDRLP4 4148
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4148
+INDIRP4
+ARGP4
+ADDRLP4 4152
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 4152
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 0
+NEI4 $204
+ADDRGP4 $196
+JUMPV
+LABELV $204
+ADDRLP4 4
+ARGP4
+ADDRGP4 $194
+ARGP4
+ADDRLP4 4156
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1032
+ADDRLP4 4156
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 1032
+INDIRI1
+CVII4 1
+ADDRLP4 4124
+INDIRI1
+CVII4 1
+EQI4 $206
+ADDRGP4 $196
+JUMPV
+LABELV $206
+ADDRLP4 4
+ARGP4
+ADDRGP4 $210
+ARGP4
+ADDRLP4 4160
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 teamOrdersMenuInfo+504
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 teamOrdersMenuInfo+548
+ADDP4
+ARGP4
+ADDRLP4 4160
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 teamOrdersMenuInfo+504
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 teamOrdersMenuInfo+548
+ADDP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 4164
+ADDRGP4 teamOrdersMenuInfo+504
+ASGNP4
+ADDRLP4 4164
+INDIRP4
+ADDRLP4 4164
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $196
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $198
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4120
+INDIRI4
+GEI4 $214
+ADDRGP4 teamOrdersMenuInfo+504
+INDIRI4
+CNSTI4 9
+LTI4 $195
+LABELV $214
+LABELV $180
+endproc UI_TeamOrdersMenu_BuildBotList 4168 12
+proc TeamOrderMenu_Draw 0 20
+ADDRGP4 UI_DrawIngameBG
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 110
+ARGI4
+ADDRGP4 $216
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_black
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRGP4 teamOrdersMenuInfo
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+LABELV $215
+endproc TeamOrderMenu_Draw 0 20
+proc UI_TeamOrdersMenu_Init 0 12
+ADDRGP4 UI_TeamOrdersMenu_Cache
+CALLV
+pop
+ADDRGP4 teamOrdersMenuInfo
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 692
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 teamOrdersMenuInfo+280
+CNSTI4 0
+ASGNI4
+ADDRGP4 teamOrdersMenuInfo+272
+ADDRGP4 UI_TeamOrdersMenu_Key
+ASGNP4
+ADDRGP4 UI_TeamOrdersMenu_BuildBotList
+CALLV
+pop
+ADDRGP4 teamOrdersMenuInfo+268
+ADDRGP4 TeamOrderMenu_Draw
+ASGNP4
+ADDRGP4 teamOrdersMenuInfo+296
+CNSTI4 8
+ASGNI4
+ADDRGP4 teamOrdersMenuInfo+296+48
+CNSTU4 256
+ASGNU4
+ADDRGP4 teamOrdersMenuInfo+296+60
+ADDRGP4 UI_TeamOrdersMenu_ListDraw
+ASGNP4
+ADDRGP4 teamOrdersMenuInfo+296+52
+ADDRGP4 UI_TeamOrdersMenu_ListEvent
+ASGNP4
+ADDRGP4 teamOrdersMenuInfo+296+16
+CNSTI4 256
+ASGNI4
+ADDRGP4 teamOrdersMenuInfo+296+20
+CNSTI4 140
+ASGNI4
+ADDRGP4 teamOrdersMenuInfo+416
+CNSTI4 12
+ASGNI4
+ADDRGP4 teamOrdersMenuInfo+416+76
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 teamOrdersMenuInfo+416+48
+CNSTU4 256
+ASGNU4
+ADDRGP4 teamOrdersMenuInfo+416+52
+ADDRGP4 UI_TeamOrdersMenu_BackEvent
+ASGNP4
+ADDRGP4 teamOrdersMenuInfo+416+16
+CNSTI4 245
+ASGNI4
+ADDRGP4 teamOrdersMenuInfo+416+20
+CNSTI4 315
+ASGNI4
+ADDRGP4 teamOrdersMenuInfo+416+64
+ADDRGP4 $245
+ASGNP4
+ADDRGP4 teamOrdersMenuInfo+416+68
+CNSTI4 16
+ASGNI4
+ADDRGP4 teamOrdersMenuInfo+416+72
+ADDRGP4 color_black
+ASGNP4
+ADDRGP4 teamOrdersMenuInfo
+ARGP4
+ADDRGP4 teamOrdersMenuInfo+296
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 teamOrdersMenuInfo
+ARGP4
+ADDRGP4 teamOrdersMenuInfo+416
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 teamOrdersMenuInfo+296+24
+CNSTI4 220
+ASGNI4
+ADDRGP4 teamOrdersMenuInfo+296+28
+ADDRGP4 teamOrdersMenuInfo+296+20
+INDIRI4
+ASGNI4
+ADDRGP4 teamOrdersMenuInfo+296+32
+CNSTI4 420
+ASGNI4
+CNSTI4 10
+ARGI4
+ADDRGP4 UI_TeamOrdersMenu_SetList
+CALLV
+pop
+LABELV $217
+endproc UI_TeamOrdersMenu_Init 0 12
+export UI_TeamOrdersMenu_Cache
+proc UI_TeamOrdersMenu_Cache 0 4
+ADDRGP4 $261
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $260
+endproc UI_TeamOrdersMenu_Cache 0 4
+export UI_TeamOrdersMenu
+proc UI_TeamOrdersMenu 0 4
+ADDRGP4 UI_TeamOrdersMenu_Init
+CALLV
+pop
+ADDRGP4 teamOrdersMenuInfo
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $262
+endproc UI_TeamOrdersMenu 0 4
+export UI_TeamOrdersMenu_f
+proc UI_TeamOrdersMenu_f 4128 12
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigString
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $192
+ARGP4
+ADDRLP4 4112
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4112
+INDIRP4
+ARGP4
+ADDRLP4 4116
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 teamOrdersMenuInfo+500
+ADDRLP4 4116
+INDIRI4
+ASGNI4
+ADDRGP4 teamOrdersMenuInfo+500
+INDIRI4
+CNSTI4 5
+GEI4 $265
+ADDRGP4 $263
+JUMPV
+LABELV $265
+ADDRLP4 1024
+ARGP4
+ADDRGP4 trap_GetClientState
+CALLV
+pop
+ADDRLP4 1024+8
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigString
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $194
+ARGP4
+ADDRLP4 4120
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4120
+INDIRP4
+ARGP4
+ADDRLP4 4124
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4108
+ADDRLP4 4124
+INDIRI4
+ASGNI4
+ADDRLP4 4108
+INDIRI4
+CNSTI4 3
+NEI4 $269
+ADDRGP4 $263
+JUMPV
+LABELV $269
+ADDRGP4 UI_TeamOrdersMenu
+CALLV
+pop
+LABELV $263
+endproc UI_TeamOrdersMenu_f 4128 12
+bss
+align 4
+LABELV teamOrdersMenuInfo
+skip 692
+import UI_HelpMenu_Cache
+import UI_HelpMenu_f
+import UI_HelpMenu
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import UI_InitGameinfo
+import UI_GetNumBots
+import UI_GetBotInfoByNumber
+import UI_GetNumArenas
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_VoiceIngame
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_GetVoiceGainClient
+import trap_GetVoiceMuteAll
+import trap_GetVoiceMuteClient
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_CIN_SetExtents
+import trap_CIN_StopCinematic
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_PlayCinematic
+import trap_RealTime
+import trap_S_StartBackgroundTrack
+import trap_S_StopBackgroundTrack
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_SaveCachedServers
+import trap_LAN_LoadCachedServers
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import BotListCompare
+import uis
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString2
+import UI_AutoWrappedString_LineCount
+import UI_DrawString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawIngameBG
+import UI_DrawStringNS
+import UI_ModelIcon
+import UI_DrawHandlePic1024
+import UI_AdjustFrom1024
+import UI_StopMusic
+import UI_StartCreditMusic
+import UI_StartMusic
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_ClearModelCache
+import UI_PrecacheClientModelname
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import UI_SpecifyPasswordMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import Demos_Cache
+import UI_DemosMenu
+import SetDefaultBinds_onUnusedKeys
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import SetupDefaultMenu_Cache
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import Music_NextTrack
+import Music_TriggerRestart
+import Music_Check
+import MusicMenu_Cache
+import MusicMenu_Open
+import MusicMenu_Shutdown
+import MusicMenu_Init
+import UI_CallVoteMenu
+import UI_InGameMenu
+import InGame_Cache
+import UI_SecretMenu
+import UI_InitBigCredits
+import UI_BigCredits_Cache
+import UI_CreditMenu
+import ExitMenu_Cache
+import ExitMenu_Init
+import UI_MainMenu
+import MainMenu_Cache
+import UI_UpdateCvars
+import UI_RegisterCvars
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import listbar_bluecolor
+import text_color_bluehighlight
+import text_color_bluenormal
+import text_color_ighighlight
+import text_color_ignormal
+import listbar_igcolor
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_lightOrange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_click_sound
+import menu_switch_sound
+import menu_move_sound
+import ScrollList_Key
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import wop_AutoBindUnusedKeys
+import wop_AutoswitchSongByNextMap
+import con_notifytime
+import s_wop_restarted
+import syc_logo
+import spraycolor
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_createGametype
+import ui_browserHidePrivate
+import ui_browserOnlyHumans
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $261
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 47
+byte 1 98
+byte 1 103
+byte 1 0
+align 1
+LABELV $245
+byte 1 66
+byte 1 65
+byte 1 67
+byte 1 75
+byte 1 0
+align 1
+LABELV $216
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 32
+byte 1 79
+byte 1 82
+byte 1 68
+byte 1 69
+byte 1 82
+byte 1 83
+byte 1 0
+align 1
+LABELV $210
+byte 1 110
+byte 1 0
+align 1
+LABELV $203
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $194
+byte 1 116
+byte 1 0
+align 1
+LABELV $192
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $190
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $188
+byte 1 69
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 121
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $179
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $95
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 103
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $94
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $93
+byte 1 73
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 32
+byte 1 67
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $92
+byte 1 71
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $91
+byte 1 82
+byte 1 111
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $90
+byte 1 73
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $89
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $88
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $87
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $86
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $85
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $84
+byte 1 73
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $83
+byte 1 82
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $82
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $81
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $80
+byte 1 70
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $79
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $78
+byte 1 73
+byte 1 32
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
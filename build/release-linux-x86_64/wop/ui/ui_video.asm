@@ -0,0 +1,5648 @@
+data
+align 4
+LABELV s_ivo_templates
+byte 4 2
+byte 4 1
+byte 4 3
+byte 4 2
+byte 4 2
+byte 4 2
+byte 4 1
+byte 4 0
+byte 4 4
+byte 4 2
+byte 4 2
+byte 4 1
+byte 4 3
+byte 4 0
+byte 4 0
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 3
+byte 4 0
+byte 4 1
+byte 4 1
+byte 4 2
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 2
+byte 4 0
+byte 4 0
+byte 4 1
+byte 4 1
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 2
+byte 4 1
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1
+byte 4 0
+byte 4 0
+export power
+code
+proc power 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $83
+JUMPV
+LABELV $80
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+LABELV $81
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $83
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $80
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $79
+endproc power 8 0
+data
+align 4
+LABELV builtinResolutions
+address $84
+address $85
+address $86
+address $87
+address $88
+address $89
+address $90
+address $91
+address $92
+address $93
+address $94
+address $95
+address $96
+address $97
+address $98
+address $99
+address $100
+byte 4 0
+align 4
+LABELV knownRatios
+address $101
+address $102
+address $103
+address $104
+address $105
+address $106
+address $107
+address $108
+address $109
+address $110
+address $111
+address $112
+address $113
+address $114
+byte 4 0
+byte 4 0
+align 4
+LABELV resolutions
+address builtinResolutions
+align 4
+LABELV resolutionsDetected
+byte 4 0
+code
+proc GraphicsOptions_FindBuiltinResolution 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 resolutionsDetected
+INDIRI4
+CNSTI4 0
+NEI4 $116
+ADDRFP4 0
+INDIRI4
+RETI4
+ADDRGP4 $115
+JUMPV
+LABELV $116
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $118
+CNSTI4 -1
+RETI4
+ADDRGP4 $115
+JUMPV
+LABELV $118
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $123
+JUMPV
+LABELV $120
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 builtinResolutions
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $124
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $115
+JUMPV
+LABELV $124
+LABELV $121
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $123
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 builtinResolutions
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $120
+CNSTI4 -1
+RETI4
+LABELV $115
+endproc GraphicsOptions_FindBuiltinResolution 12 8
+proc GraphicsOptions_FindDetectedResolution 20 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 resolutionsDetected
+INDIRI4
+CNSTI4 0
+NEI4 $127
+ADDRFP4 0
+INDIRI4
+RETI4
+ADDRGP4 $126
+JUMPV
+LABELV $127
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $129
+CNSTI4 -1
+RETI4
+ADDRGP4 $126
+JUMPV
+LABELV $129
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 builtinResolutions
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 8
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $134
+JUMPV
+LABELV $131
+ADDRLP4 12
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LSHI4
+ADDRGP4 builtinResolutions
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $135
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $126
+JUMPV
+LABELV $135
+LABELV $132
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $134
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $131
+CNSTI4 -1
+RETI4
+LABELV $126
+endproc GraphicsOptions_FindDetectedResolution 20 12
+proc AddAspectRatios 52 20
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $141
+JUMPV
+LABELV $138
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 resolutions
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 120
+ARGI4
+ADDRLP4 28
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 28
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 32
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 resolutions
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+ADDRLP4 32
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRGP4 $142
+ARGP4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+DIVF4
+ARGF4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $146
+JUMPV
+LABELV $143
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 knownRatios
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $147
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 knownRatios+4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $145
+JUMPV
+LABELV $147
+LABELV $144
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $146
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 knownRatios
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $143
+LABELV $145
+ADDRLP4 4
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 resolutionStrings
+ADDP4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $150
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 resolutions
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 resolutions
+INDIRP4
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 resolutionStrings
+ADDP4
+ASGNP4
+LABELV $139
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $141
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 resolutions
+INDIRP4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $138
+LABELV $137
+endproc AddAspectRatios 52 20
+proc GraphicsOptions_GetResolutions 24 12
+ADDRGP4 $152
+ARGP4
+ADDRLP4 0
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 resbuf
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 resbuf
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $153
+ADDRLP4 4
+ADDRGP4 resbuf
+ASGNP4
+ADDRLP4 8
+CNSTU4 0
+ASGNU4
+ADDRGP4 $156
+JUMPV
+LABELV $155
+ADDRLP4 12
+ADDRLP4 8
+INDIRU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 12
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 12
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRGP4 detectedResolutions
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 16
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $158
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $158
+LABELV $156
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $160
+ADDRLP4 8
+INDIRU4
+CNSTU4 31
+LTU4 $155
+LABELV $160
+ADDRLP4 8
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRGP4 detectedResolutions
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+INDIRU4
+CNSTU4 0
+EQU4 $161
+ADDRGP4 resolutions
+ADDRGP4 detectedResolutions
+ASGNP4
+ADDRGP4 resolutionsDetected
+CNSTI4 1
+ASGNI4
+LABELV $161
+LABELV $153
+ADDRGP4 AddAspectRatios
+CALLV
+pop
+LABELV $151
+endproc GraphicsOptions_GetResolutions 24 12
+proc GraphicsOptions_GetInitialVideo 0 0
+ADDRGP4 s_ivo+12
+ADDRGP4 s_graphicsoptions+1280+68
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo
+ADDRGP4 s_graphicsoptions+800+68
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+4
+ADDRGP4 s_graphicsoptions+1040+68
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+8
+ADDRGP4 s_graphicsoptions+920+68
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+20
+ADDRGP4 s_graphicsoptions+1400+68
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+24
+ADDRGP4 s_graphicsoptions+1520+68
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+16
+ADDRGP4 s_graphicsoptions+1160+68
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+28
+ADDRGP4 s_graphicsoptions+1640+68
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+32
+ADDRGP4 s_graphicsoptions+1760+68
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+36
+ADDRGP4 s_graphicsoptions+1880+68
+INDIRI4
+ASGNI4
+LABELV $163
+endproc GraphicsOptions_GetInitialVideo 0 0
+proc GraphicsOptions_CheckConfig 4 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $197
+JUMPV
+LABELV $194
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+12
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1280+68
+INDIRI4
+EQI4 $198
+ADDRGP4 $195
+JUMPV
+LABELV $198
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+800+68
+INDIRI4
+EQI4 $203
+ADDRGP4 $195
+JUMPV
+LABELV $203
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+4
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1040+68
+INDIRI4
+EQI4 $207
+ADDRGP4 $195
+JUMPV
+LABELV $207
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+8
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+920+68
+INDIRI4
+EQI4 $212
+ADDRGP4 $195
+JUMPV
+LABELV $212
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+20
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1400+68
+INDIRI4
+EQI4 $217
+ADDRGP4 $195
+JUMPV
+LABELV $217
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+24
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1520+68
+INDIRI4
+EQI4 $222
+ADDRGP4 $195
+JUMPV
+LABELV $222
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+28
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1640+68
+INDIRI4
+EQI4 $227
+ADDRGP4 $195
+JUMPV
+LABELV $227
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+32
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1760+68
+INDIRI4
+EQI4 $232
+ADDRGP4 $195
+JUMPV
+LABELV $232
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+36
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1880+68
+INDIRI4
+EQI4 $237
+ADDRGP4 $195
+JUMPV
+LABELV $237
+ADDRGP4 s_graphicsoptions+680+68
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $193
+JUMPV
+LABELV $195
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $197
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 4
+LTU4 $194
+ADDRGP4 s_graphicsoptions+680+68
+CNSTI4 4
+ASGNI4
+LABELV $193
+endproc GraphicsOptions_CheckConfig 4 0
+proc GraphicsOptions_UpdateMenuItems 8 0
+ADDRGP4 s_graphicsoptions+1040+68
+INDIRI4
+CNSTI4 0
+NEI4 $247
+ADDRGP4 s_graphicsoptions+1280+68
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 s_graphicsoptions+1280+48
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRGP4 $248
+JUMPV
+LABELV $247
+ADDRLP4 0
+ADDRGP4 s_graphicsoptions+1280+48
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+LABELV $248
+ADDRLP4 0
+ADDRGP4 s_graphicsoptions+2000+48
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRGP4 s_ivo
+INDIRI4
+ADDRGP4 s_graphicsoptions+800+68
+INDIRI4
+EQI4 $259
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+2000+48
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $259
+ADDRGP4 s_ivo+4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1040+68
+INDIRI4
+EQI4 $265
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+2000+48
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $265
+ADDRGP4 s_ivo+8
+INDIRI4
+ADDRGP4 s_graphicsoptions+920+68
+INDIRI4
+EQI4 $272
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+2000+48
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $272
+ADDRGP4 s_ivo+12
+INDIRI4
+ADDRGP4 s_graphicsoptions+1280+68
+INDIRI4
+EQI4 $279
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+2000+48
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $279
+ADDRGP4 s_ivo+16
+INDIRI4
+ADDRGP4 s_graphicsoptions+1160+68
+INDIRI4
+EQI4 $286
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+2000+48
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $286
+ADDRGP4 s_ivo+20
+INDIRI4
+ADDRGP4 s_graphicsoptions+1400+68
+INDIRI4
+EQI4 $293
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+2000+48
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $293
+ADDRGP4 s_ivo+24
+INDIRI4
+ADDRGP4 s_graphicsoptions+1520+68
+INDIRI4
+EQI4 $300
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+2000+48
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $300
+ADDRGP4 s_ivo+28
+INDIRI4
+ADDRGP4 s_graphicsoptions+1640+68
+INDIRI4
+EQI4 $307
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+2000+48
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $307
+ADDRGP4 s_ivo+32
+INDIRI4
+ADDRGP4 s_graphicsoptions+1760+68
+INDIRI4
+EQI4 $314
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+2000+48
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $314
+ADDRGP4 s_ivo+36
+INDIRI4
+ADDRGP4 s_graphicsoptions+1880+68
+INDIRI4
+EQI4 $321
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+2000+48
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $321
+ADDRGP4 GraphicsOptions_CheckConfig
+CALLV
+pop
+LABELV $246
+endproc GraphicsOptions_UpdateMenuItems 8 0
+proc GraphicsOptions_ApplyChanges 56 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $329
+ADDRGP4 $328
+JUMPV
+LABELV $329
+ADDRLP4 0
+ADDRGP4 s_graphicsoptions+1160+68
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $335
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $337
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+EQI4 $338
+ADDRGP4 $331
+JUMPV
+LABELV $335
+ADDRGP4 $336
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $332
+JUMPV
+LABELV $337
+ADDRGP4 $336
+ARGP4
+CNSTF4 1098907648
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $332
+JUMPV
+LABELV $338
+ADDRGP4 $336
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $331
+LABELV $332
+ADDRGP4 $339
+ARGP4
+CNSTI4 3
+ADDRGP4 s_graphicsoptions+920+68
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $342
+ARGP4
+ADDRGP4 s_graphicsoptions+1040+68
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+1280+68
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $349
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $353
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+EQI4 $354
+ADDRGP4 $345
+JUMPV
+LABELV $349
+ADDRGP4 $350
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $351
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $352
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $346
+JUMPV
+LABELV $353
+ADDRGP4 $350
+ARGP4
+CNSTF4 1098907648
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $351
+ARGP4
+CNSTF4 1098907648
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $352
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $346
+JUMPV
+LABELV $354
+ADDRGP4 $350
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $351
+ARGP4
+CNSTF4 1103101952
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $345
+LABELV $346
+ADDRGP4 s_graphicsoptions+1400+68
+INDIRI4
+CNSTI4 2
+NEI4 $355
+ADDRGP4 $359
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $360
+ARGP4
+CNSTF4 1082130432
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $356
+JUMPV
+LABELV $355
+ADDRGP4 s_graphicsoptions+1400+68
+INDIRI4
+CNSTI4 1
+NEI4 $361
+ADDRGP4 $359
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $360
+ARGP4
+CNSTF4 1094713344
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $362
+JUMPV
+LABELV $361
+ADDRGP4 $359
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $360
+ARGP4
+CNSTF4 1101004800
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $362
+LABELV $356
+ADDRGP4 s_graphicsoptions+1520+68
+INDIRI4
+CNSTI4 0
+EQI4 $365
+ADDRGP4 $369
+ARGP4
+ADDRGP4 $370
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $366
+JUMPV
+LABELV $365
+ADDRGP4 $369
+ARGP4
+ADDRGP4 $371
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $366
+ADDRGP4 $372
+ARGP4
+ADDRGP4 s_graphicsoptions+1640+68
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 s_graphicsoptions+1760+68
+INDIRI4
+CNSTI4 0
+LEI4 $375
+ADDRGP4 $379
+ARGP4
+ADDRGP4 $380
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 s_graphicsoptions+1760+68
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 power
+CALLI4
+ASGNI4
+ADDRGP4 $381
+ARGP4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $376
+JUMPV
+LABELV $375
+ADDRGP4 $379
+ARGP4
+ADDRGP4 $384
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $381
+ARGP4
+ADDRGP4 $384
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $376
+ADDRGP4 s_graphicsoptions+1880+68
+INDIRI4
+CNSTI4 0
+LEI4 $385
+CNSTI4 2
+ARGI4
+ADDRGP4 s_graphicsoptions+1880+68
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 power
+CALLI4
+ASGNI4
+ADDRGP4 $389
+ARGP4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $386
+JUMPV
+LABELV $385
+ADDRGP4 $389
+ARGP4
+ADDRGP4 $384
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $386
+ADDRGP4 resolutionsDetected
+INDIRI4
+CNSTI4 0
+EQI4 $392
+ADDRGP4 s_graphicsoptions+800+68
+INDIRI4
+CNSTI4 -1
+EQI4 $400
+ADDRGP4 s_graphicsoptions+800+68
+INDIRI4
+CVIU4 4
+CNSTU4 32
+LTU4 $394
+LABELV $400
+ADDRGP4 s_graphicsoptions+800+68
+CNSTI4 0
+ASGNI4
+LABELV $394
+ADDRGP4 s_graphicsoptions+800+68
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 GraphicsOptions_FindBuiltinResolution
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 -1
+NEI4 $405
+ADDRLP4 16
+ARGP4
+ADDRGP4 s_graphicsoptions+800+68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+CNSTI4 120
+ARGI4
+ADDRLP4 48
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 s_graphicsoptions+800+68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 120
+ARGI4
+ADDRLP4 52
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 52
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $411
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $412
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $405
+ADDRGP4 $413
+ARGP4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $393
+JUMPV
+LABELV $392
+ADDRGP4 $413
+ARGP4
+ADDRGP4 s_graphicsoptions+800+68
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $393
+CNSTI4 2
+ARGI4
+ADDRGP4 $416
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $328
+endproc GraphicsOptions_ApplyChanges 56 12
+proc GraphicsOptions_Event 12 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $418
+ADDRGP4 $417
+JUMPV
+LABELV $418
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 101
+LTI4 $420
+ADDRLP4 4
+INDIRI4
+CNSTI4 108
+GTI4 $420
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $451-404
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $451
+address $446
+address $420
+address $423
+address $420
+address $421
+address $448
+address $449
+address $450
+code
+LABELV $423
+ADDRLP4 0
+CNSTI4 40
+ADDRGP4 s_graphicsoptions+680+68
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates
+ADDP4
+ASGNP4
+ADDRGP4 s_graphicsoptions+800+68
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+920+68
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1280+68
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1160+68
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1400+68
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1520+68
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1040+68
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1640+68
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1760+68
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1880+68
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $421
+JUMPV
+LABELV $446
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $421
+JUMPV
+LABELV $448
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_DisplayOptionsMenu
+CALLV
+pop
+ADDRGP4 $421
+JUMPV
+LABELV $449
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_SoundOptionsMenu
+CALLV
+pop
+ADDRGP4 $421
+JUMPV
+LABELV $450
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_NetworkOptionsMenu
+CALLV
+pop
+LABELV $420
+LABELV $421
+LABELV $417
+endproc GraphicsOptions_Event 12 0
+export GraphicsOptions_MenuDraw
+proc GraphicsOptions_MenuDraw 0 4
+ADDRGP4 GraphicsOptions_UpdateMenuItems
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+LABELV $453
+endproc GraphicsOptions_MenuDraw 0 4
+proc GraphicsOptions_SetMenuItems 1056 12
+ADDRGP4 $413
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+ADDRGP4 GraphicsOptions_FindDetectedResolution
+CALLI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+800+68
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+800+68
+INDIRI4
+CNSTI4 0
+GEI4 $457
+ADDRGP4 resolutionsDetected
+INDIRI4
+CNSTI4 0
+EQI4 $461
+ADDRGP4 $411
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1022
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 1036
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1036
+INDIRU4
+CNSTU4 1
+ADDU4
+ADDRLP4 12
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 12
+ARGP4
+ADDRLP4 1040
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1040
+INDIRU4
+ADDRLP4 12
+ADDP4
+CNSTI1 120
+ASGNI1
+ADDRLP4 12
+ARGP4
+ADDRLP4 1044
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 12
+ARGP4
+ADDRLP4 1048
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRGP4 $412
+ARGP4
+ADDRLP4 1044
+INDIRU4
+ADDRLP4 12
+ADDP4
+ARGP4
+CNSTU4 1024
+ADDRLP4 1048
+INDIRU4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $466
+JUMPV
+LABELV $463
+ADDRLP4 12
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $467
+ADDRGP4 s_graphicsoptions+800+68
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $465
+JUMPV
+LABELV $467
+LABELV $464
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $466
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $463
+LABELV $465
+ADDRGP4 s_graphicsoptions+800+68
+INDIRI4
+CNSTI4 0
+GEI4 $462
+ADDRGP4 s_graphicsoptions+800+68
+CNSTI4 0
+ASGNI4
+ADDRGP4 $462
+JUMPV
+LABELV $461
+ADDRGP4 s_graphicsoptions+800+68
+CNSTI4 2
+ASGNI4
+LABELV $462
+LABELV $457
+ADDRGP4 $342
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 s_graphicsoptions+1040+68
+ADDRLP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $339
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 s_graphicsoptions+920+68
+CNSTI4 3
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+SUBI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+920+68
+INDIRI4
+CNSTI4 0
+GEI4 $483
+ADDRGP4 s_graphicsoptions+920+68
+CNSTI4 0
+ASGNI4
+ADDRGP4 $484
+JUMPV
+LABELV $483
+ADDRGP4 s_graphicsoptions+920+68
+INDIRI4
+CNSTI4 3
+LEI4 $489
+ADDRGP4 s_graphicsoptions+920+68
+CNSTI4 3
+ASGNI4
+LABELV $489
+LABELV $484
+ADDRGP4 $336
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 28
+CNSTI4 16
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $501
+ADDRLP4 16
+INDIRI4
+ADDRLP4 28
+INDIRI4
+GTI4 $508
+LABELV $507
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $498
+ADDRGP4 $495
+JUMPV
+LABELV $508
+ADDRLP4 16
+INDIRI4
+CNSTI4 32
+EQI4 $504
+ADDRGP4 $495
+JUMPV
+LABELV $495
+LABELV $498
+ADDRGP4 s_graphicsoptions+1160+68
+CNSTI4 0
+ASGNI4
+ADDRGP4 $496
+JUMPV
+LABELV $501
+ADDRGP4 s_graphicsoptions+1160+68
+CNSTI4 1
+ASGNI4
+ADDRGP4 $496
+JUMPV
+LABELV $504
+ADDRGP4 s_graphicsoptions+1160+68
+CNSTI4 2
+ASGNI4
+LABELV $496
+ADDRGP4 $369
+ARGP4
+ADDRLP4 32
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 $371
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $509
+ADDRGP4 s_graphicsoptions+1520+68
+CNSTI4 0
+ASGNI4
+ADDRGP4 $510
+JUMPV
+LABELV $509
+ADDRGP4 s_graphicsoptions+1520+68
+CNSTI4 1
+ASGNI4
+LABELV $510
+ADDRGP4 $359
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 40
+INDIRF4
+CNSTF4 0
+LEF4 $515
+ADDRGP4 $360
+ARGP4
+ADDRLP4 44
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 44
+INDIRF4
+CNSTF4 1101004800
+LTF4 $517
+ADDRGP4 s_graphicsoptions+1400+68
+CNSTI4 0
+ASGNI4
+ADDRGP4 $516
+JUMPV
+LABELV $517
+ADDRGP4 s_graphicsoptions+1400+68
+CNSTI4 1
+ASGNI4
+ADDRGP4 $516
+JUMPV
+LABELV $515
+ADDRGP4 s_graphicsoptions+1400+68
+CNSTI4 2
+ASGNI4
+LABELV $516
+ADDRGP4 $350
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 48
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 56
+CNSTI4 16
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRLP4 56
+INDIRI4
+EQI4 $531
+ADDRLP4 44
+INDIRI4
+ADDRLP4 56
+INDIRI4
+GTI4 $538
+LABELV $537
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $528
+ADDRGP4 $525
+JUMPV
+LABELV $538
+ADDRLP4 44
+INDIRI4
+CNSTI4 32
+EQI4 $534
+ADDRGP4 $525
+JUMPV
+LABELV $525
+LABELV $528
+ADDRGP4 s_graphicsoptions+1280+68
+CNSTI4 0
+ASGNI4
+ADDRGP4 $526
+JUMPV
+LABELV $531
+ADDRGP4 s_graphicsoptions+1280+68
+CNSTI4 1
+ASGNI4
+ADDRGP4 $526
+JUMPV
+LABELV $534
+ADDRGP4 s_graphicsoptions+1280+68
+CNSTI4 2
+ASGNI4
+LABELV $526
+ADDRGP4 s_graphicsoptions+1040+68
+INDIRI4
+CNSTI4 0
+NEI4 $539
+ADDRGP4 s_graphicsoptions+1280+68
+CNSTI4 0
+ASGNI4
+LABELV $539
+ADDRGP4 $372
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 s_graphicsoptions+1640+68
+ADDRLP4 60
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $389
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 72
+ADDRGP4 ceil
+CALLF4
+ASGNF4
+ADDRGP4 s_graphicsoptions+1880+68
+ADDRLP4 72
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $379
+ARGP4
+ADDRLP4 76
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 76
+INDIRF4
+CNSTF4 0
+EQF4 $549
+ADDRGP4 $381
+ARGP4
+ADDRLP4 80
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 80
+INDIRF4
+ARGF4
+ADDRLP4 84
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 84
+INDIRF4
+ARGF4
+ADDRLP4 88
+ADDRGP4 ceil
+CALLF4
+ASGNF4
+ADDRGP4 s_graphicsoptions+1760+68
+ADDRLP4 88
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $550
+JUMPV
+LABELV $549
+ADDRGP4 s_graphicsoptions+1760+68
+CNSTI4 0
+ASGNI4
+LABELV $550
+LABELV $454
+endproc GraphicsOptions_SetMenuItems 1056 12
+data
+align 4
+LABELV $556
+address $557
+address $558
+address $559
+byte 4 0
+align 4
+LABELV $560
+address $561
+address $562
+address $563
+address $564
+address $565
+byte 4 0
+align 4
+LABELV $566
+address $557
+address $558
+address $559
+byte 4 0
+align 4
+LABELV $567
+address $568
+address $569
+byte 4 0
+align 4
+LABELV $570
+address $571
+address $572
+address $573
+address $574
+byte 4 0
+align 4
+LABELV $575
+address $576
+address $577
+address $578
+address $579
+address $580
+byte 4 0
+align 4
+LABELV $581
+address $576
+address $577
+address $578
+byte 4 0
+align 4
+LABELV $582
+address $571
+address $572
+address $573
+byte 4 0
+align 4
+LABELV $583
+address $576
+address $584
+byte 4 0
+export GraphicsOptions_MenuInit
+code
+proc GraphicsOptions_MenuInit 4 12
+ADDRGP4 s_graphicsoptions
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 2192
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 GraphicsOptions_GetResolutions
+CALLV
+pop
+ADDRGP4 GraphicsOptions_Cache
+CALLV
+pop
+ADDRGP4 s_graphicsoptions+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_graphicsoptions+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_graphicsoptions+268
+ADDRGP4 GraphicsOptions_MenuDraw
+ASGNP4
+ADDRGP4 s_graphicsoptions+284
+CNSTI4 32776
+ASGNI4
+ADDRGP4 s_graphicsoptions+296
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_graphicsoptions+296+4
+ADDRGP4 $592
+ASGNP4
+ADDRGP4 s_graphicsoptions+296+48
+CNSTU4 68
+ASGNU4
+ADDRGP4 s_graphicsoptions+296+52
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+296+12
+CNSTI4 105
+ASGNI4
+ADDRGP4 s_graphicsoptions+296+16
+CNSTI4 26
+ASGNI4
+ADDRGP4 s_graphicsoptions+296+20
+CNSTI4 37
+ASGNI4
+ADDRGP4 s_graphicsoptions+296+80
+CNSTI4 130
+ASGNI4
+ADDRGP4 s_graphicsoptions+296+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_graphicsoptions+296+64
+ADDRGP4 $609
+ASGNP4
+ADDRGP4 s_graphicsoptions+296+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_graphicsoptions+392
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_graphicsoptions+392+4
+ADDRGP4 $615
+ASGNP4
+ADDRGP4 s_graphicsoptions+392+48
+CNSTU4 132
+ASGNU4
+ADDRGP4 s_graphicsoptions+392+52
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+392+12
+CNSTI4 106
+ASGNI4
+ADDRGP4 s_graphicsoptions+392+16
+CNSTI4 159
+ASGNI4
+ADDRGP4 s_graphicsoptions+392+20
+CNSTI4 30
+ASGNI4
+ADDRGP4 s_graphicsoptions+392+80
+CNSTI4 122
+ASGNI4
+ADDRGP4 s_graphicsoptions+392+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_graphicsoptions+392+64
+ADDRGP4 $632
+ASGNP4
+ADDRGP4 s_graphicsoptions+392+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_graphicsoptions+488
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_graphicsoptions+488+4
+ADDRGP4 $638
+ASGNP4
+ADDRGP4 s_graphicsoptions+488+48
+CNSTU4 132
+ASGNU4
+ADDRGP4 s_graphicsoptions+488+52
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+488+12
+CNSTI4 107
+ASGNI4
+ADDRGP4 s_graphicsoptions+488+16
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_graphicsoptions+488+20
+CNSTI4 77
+ASGNI4
+ADDRGP4 s_graphicsoptions+488+80
+CNSTI4 130
+ASGNI4
+ADDRGP4 s_graphicsoptions+488+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_graphicsoptions+488+64
+ADDRGP4 $655
+ASGNP4
+ADDRGP4 s_graphicsoptions+488+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_graphicsoptions+584
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_graphicsoptions+584+4
+ADDRGP4 $661
+ASGNP4
+ADDRGP4 s_graphicsoptions+584+48
+CNSTU4 132
+ASGNU4
+ADDRGP4 s_graphicsoptions+584+52
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+584+12
+CNSTI4 108
+ASGNI4
+ADDRGP4 s_graphicsoptions+584+16
+CNSTI4 170
+ASGNI4
+ADDRGP4 s_graphicsoptions+584+20
+CNSTI4 80
+ASGNI4
+ADDRGP4 s_graphicsoptions+584+80
+CNSTI4 100
+ASGNI4
+ADDRGP4 s_graphicsoptions+584+84
+CNSTI4 45
+ASGNI4
+ADDRGP4 s_graphicsoptions+584+64
+ADDRGP4 $678
+ASGNP4
+ADDRGP4 s_graphicsoptions+584+92
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+CNSTI4 180
+ASGNI4
+ADDRGP4 s_graphicsoptions+680
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+680+4
+ADDRGP4 $684
+ASGNP4
+ADDRGP4 s_graphicsoptions+680+48
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_graphicsoptions+680+16
+CNSTI4 184
+ASGNI4
+ADDRGP4 s_graphicsoptions+680+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+680+52
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+680+12
+CNSTI4 103
+ASGNI4
+ADDRGP4 s_graphicsoptions+680+80
+ADDRGP4 $560
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 36
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+800
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+800+4
+ADDRGP4 $700
+ASGNP4
+ADDRGP4 s_graphicsoptions+800+48
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_graphicsoptions+800+16
+CNSTI4 184
+ASGNI4
+ADDRGP4 s_graphicsoptions+800+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+800+80
+ADDRGP4 resolutions
+INDIRP4
+ASGNP4
+ADDRGP4 s_graphicsoptions+800+52
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+800+12
+CNSTI4 104
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1280
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1280+4
+ADDRGP4 $716
+ASGNP4
+ADDRGP4 s_graphicsoptions+1280+48
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_graphicsoptions+1280+16
+CNSTI4 184
+ASGNI4
+ADDRGP4 s_graphicsoptions+1280+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1280+80
+ADDRGP4 $566
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1040
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1040+80
+ADDRGP4 $583
+ASGNP4
+ADDRGP4 s_graphicsoptions+1040+4
+ADDRGP4 $730
+ASGNP4
+ADDRGP4 s_graphicsoptions+1040+48
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_graphicsoptions+1040+16
+CNSTI4 184
+ASGNI4
+ADDRGP4 s_graphicsoptions+1040+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1040+8
+ADDRGP4 $739
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1400
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1400+4
+ADDRGP4 $743
+ASGNP4
+ADDRGP4 s_graphicsoptions+1400+48
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_graphicsoptions+1400+16
+CNSTI4 184
+ASGNI4
+ADDRGP4 s_graphicsoptions+1400+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1400+80
+ADDRGP4 $582
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+920
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+920+4
+ADDRGP4 $755
+ASGNP4
+ADDRGP4 s_graphicsoptions+920+48
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_graphicsoptions+920+16
+CNSTI4 184
+ASGNI4
+ADDRGP4 s_graphicsoptions+920+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+920+80
+ADDRGP4 $570
+ASGNP4
+ADDRGP4 s_graphicsoptions+920+8
+ADDRGP4 $766
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1160
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1160+4
+ADDRGP4 $770
+ASGNP4
+ADDRGP4 s_graphicsoptions+1160+48
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_graphicsoptions+1160+16
+CNSTI4 184
+ASGNI4
+ADDRGP4 s_graphicsoptions+1160+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1160+80
+ADDRGP4 $556
+ASGNP4
+ADDRGP4 s_graphicsoptions+1160+8
+ADDRGP4 $781
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1520
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1520+4
+ADDRGP4 $785
+ASGNP4
+ADDRGP4 s_graphicsoptions+1520+48
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_graphicsoptions+1520+16
+CNSTI4 184
+ASGNI4
+ADDRGP4 s_graphicsoptions+1520+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1520+80
+ADDRGP4 $567
+ASGNP4
+ADDRGP4 s_graphicsoptions+1520+8
+ADDRGP4 $796
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1640
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1640+80
+ADDRGP4 $583
+ASGNP4
+ADDRGP4 s_graphicsoptions+1640+4
+ADDRGP4 $802
+ASGNP4
+ADDRGP4 s_graphicsoptions+1640+48
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_graphicsoptions+1640+16
+CNSTI4 184
+ASGNI4
+ADDRGP4 s_graphicsoptions+1640+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1640+8
+ADDRGP4 $811
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1760
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1760+4
+ADDRGP4 $815
+ASGNP4
+ADDRGP4 s_graphicsoptions+1760+48
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_graphicsoptions+1760+16
+CNSTI4 184
+ASGNI4
+ADDRGP4 s_graphicsoptions+1760+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1760+80
+ADDRGP4 $575
+ASGNP4
+ADDRGP4 s_graphicsoptions+1760+8
+ADDRGP4 $826
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1880
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1880+4
+ADDRGP4 $830
+ASGNP4
+ADDRGP4 s_graphicsoptions+1880+48
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_graphicsoptions+1880+16
+CNSTI4 184
+ASGNI4
+ADDRGP4 s_graphicsoptions+1880+20
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1880+80
+ADDRGP4 $581
+ASGNP4
+ADDRGP4 s_graphicsoptions+1880+8
+ADDRGP4 $841
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+2096
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_graphicsoptions+2096+4
+ADDRGP4 $845
+ASGNP4
+ADDRGP4 s_graphicsoptions+2096+48
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_graphicsoptions+2096+52
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+2096+12
+CNSTI4 101
+ASGNI4
+ADDRGP4 s_graphicsoptions+2096+16
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_graphicsoptions+2096+20
+CNSTI4 440
+ASGNI4
+ADDRGP4 s_graphicsoptions+2096+80
+CNSTI4 80
+ASGNI4
+ADDRGP4 s_graphicsoptions+2096+84
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_graphicsoptions+2096+64
+ADDRGP4 $862
+ASGNP4
+ADDRGP4 s_graphicsoptions+2096+92
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_graphicsoptions+2000
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_graphicsoptions+2000+4
+ADDRGP4 $868
+ASGNP4
+ADDRGP4 s_graphicsoptions+2000+48
+CNSTU4 20736
+ASGNU4
+ADDRGP4 s_graphicsoptions+2000+52
+ADDRGP4 GraphicsOptions_ApplyChanges
+ASGNP4
+ADDRGP4 s_graphicsoptions+2000+16
+CNSTI4 516
+ASGNI4
+ADDRGP4 s_graphicsoptions+2000+20
+CNSTI4 405
+ASGNI4
+ADDRGP4 s_graphicsoptions+2000+80
+CNSTI4 102
+ASGNI4
+ADDRGP4 s_graphicsoptions+2000+84
+CNSTI4 61
+ASGNI4
+ADDRGP4 s_graphicsoptions+2000+64
+ADDRGP4 $868
+ASGNP4
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+296
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+392
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+488
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+584
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+680
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+800
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1280
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1040
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1400
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+920
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1160
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1520
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1640
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1760
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1880
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+2096
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+2000
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 GraphicsOptions_SetMenuItems
+CALLV
+pop
+ADDRGP4 GraphicsOptions_GetInitialVideo
+CALLV
+pop
+LABELV $555
+endproc GraphicsOptions_MenuInit 4 12
+export GraphicsOptions_Cache
+proc GraphicsOptions_Cache 0 4
+ADDRGP4 $845
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $862
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $592
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $609
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $615
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $632
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $638
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $655
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $661
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $678
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $868
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $868
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $900
+endproc GraphicsOptions_Cache 0 4
+export UI_GraphicsOptionsMenu
+proc UI_GraphicsOptionsMenu 0 8
+ADDRGP4 GraphicsOptions_MenuInit
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+296
+ARGP4
+ADDRGP4 Menu_SetCursorToItem
+CALLV
+pop
+LABELV $901
+endproc UI_GraphicsOptionsMenu 0 8
+bss
+align 4
+LABELV detectedResolutions
+skip 128
+align 1
+LABELV resolutionStrings
+skip 4096
+align 1
+LABELV resbuf
+skip 1024
+align 4
+LABELV s_graphicsoptions
+skip 2192
+align 4
+LABELV s_ivo
+skip 40
+import UI_HelpMenu_Cache
+import UI_HelpMenu_f
+import UI_HelpMenu
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import UI_InitGameinfo
+import UI_GetNumBots
+import UI_GetBotInfoByNumber
+import UI_GetNumArenas
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_VoiceIngame
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_GetVoiceGainClient
+import trap_GetVoiceMuteAll
+import trap_GetVoiceMuteClient
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_CIN_SetExtents
+import trap_CIN_StopCinematic
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_PlayCinematic
+import trap_RealTime
+import trap_S_StartBackgroundTrack
+import trap_S_StopBackgroundTrack
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_SaveCachedServers
+import trap_LAN_LoadCachedServers
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import BotListCompare
+import uis
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString2
+import UI_AutoWrappedString_LineCount
+import UI_DrawString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawIngameBG
+import UI_DrawStringNS
+import UI_ModelIcon
+import UI_DrawHandlePic1024
+import UI_AdjustFrom1024
+import UI_StopMusic
+import UI_StartCreditMusic
+import UI_StartMusic
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_ClearModelCache
+import UI_PrecacheClientModelname
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import UI_SpecifyPasswordMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import Demos_Cache
+import UI_DemosMenu
+import SetDefaultBinds_onUnusedKeys
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import SetupDefaultMenu_Cache
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import Music_NextTrack
+import Music_TriggerRestart
+import Music_Check
+import MusicMenu_Cache
+import MusicMenu_Open
+import MusicMenu_Shutdown
+import MusicMenu_Init
+import UI_CallVoteMenu
+import UI_InGameMenu
+import InGame_Cache
+import UI_SecretMenu
+import UI_InitBigCredits
+import UI_BigCredits_Cache
+import UI_CreditMenu
+import ExitMenu_Cache
+import ExitMenu_Init
+import UI_MainMenu
+import MainMenu_Cache
+import UI_UpdateCvars
+import UI_RegisterCvars
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import listbar_bluecolor
+import text_color_bluehighlight
+import text_color_bluenormal
+import text_color_ighighlight
+import text_color_ignormal
+import listbar_igcolor
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_lightOrange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_click_sound
+import menu_switch_sound
+import menu_move_sound
+import ScrollList_Key
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import wop_AutoBindUnusedKeys
+import wop_AutoswitchSongByNextMap
+import con_notifytime
+import s_wop_restarted
+import syc_logo
+import spraycolor
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_createGametype
+import ui_browserHidePrivate
+import ui_browserOnlyHumans
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $868
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 47
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 0
+align 1
+LABELV $862
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 66
+byte 1 116
+byte 1 110
+byte 1 66
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 49
+byte 1 0
+align 1
+LABELV $845
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 66
+byte 1 116
+byte 1 110
+byte 1 66
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 48
+byte 1 0
+align 1
+LABELV $841
+byte 1 83
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 103
+byte 1 104
+byte 1 32
+byte 1 101
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 32
+byte 1 78
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 46
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 33
+byte 1 0
+align 1
+LABELV $830
+byte 1 65
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 97
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 0
+align 1
+LABELV $826
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 32
+byte 1 78
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 46
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 33
+byte 1 0
+align 1
+LABELV $815
+byte 1 65
+byte 1 110
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $811
+byte 1 83
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 97
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 40
+byte 1 109
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 115
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 41
+byte 1 46
+byte 1 0
+align 1
+LABELV $802
+byte 1 67
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 0
+align 1
+LABELV $796
+byte 1 65
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 112
+byte 1 110
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 32
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 46
+byte 1 32
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 84
+byte 1 114
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 46
+byte 1 0
+align 1
+LABELV $785
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 0
+align 1
+LABELV $781
+byte 1 65
+byte 1 100
+byte 1 106
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 46
+byte 1 0
+align 1
+LABELV $770
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $766
+byte 1 65
+byte 1 100
+byte 1 106
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 46
+byte 1 0
+align 1
+LABELV $755
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 58
+byte 1 0
+align 1
+LABELV $743
+byte 1 71
+byte 1 101
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 58
+byte 1 0
+align 1
+LABELV $739
+byte 1 79
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 117
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 104
+byte 1 121
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 115
+byte 1 46
+byte 1 32
+byte 1 10
+byte 1 79
+byte 1 102
+byte 1 102
+byte 1 58
+byte 1 32
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 44
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 117
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 46
+byte 1 32
+byte 1 40
+byte 1 78
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 41
+byte 1 46
+byte 1 0
+align 1
+LABELV $730
+byte 1 70
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 58
+byte 1 0
+align 1
+LABELV $716
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 104
+byte 1 58
+byte 1 0
+align 1
+LABELV $700
+byte 1 86
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 111
+byte 1 32
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $684
+byte 1 71
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 58
+byte 1 0
+align 1
+LABELV $678
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 47
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 107
+byte 1 49
+byte 1 0
+align 1
+LABELV $661
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 47
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 107
+byte 1 48
+byte 1 0
+align 1
+LABELV $655
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 47
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 49
+byte 1 0
+align 1
+LABELV $638
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 47
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 48
+byte 1 0
+align 1
+LABELV $632
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 47
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 49
+byte 1 0
+align 1
+LABELV $615
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 47
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 48
+byte 1 0
+align 1
+LABELV $609
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 49
+byte 1 0
+align 1
+LABELV $592
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 48
+byte 1 0
+align 1
+LABELV $584
+byte 1 79
+byte 1 110
+byte 1 0
+align 1
+LABELV $580
+byte 1 49
+byte 1 54
+byte 1 120
+byte 1 0
+align 1
+LABELV $579
+byte 1 56
+byte 1 120
+byte 1 0
+align 1
+LABELV $578
+byte 1 52
+byte 1 120
+byte 1 0
+align 1
+LABELV $577
+byte 1 50
+byte 1 120
+byte 1 0
+align 1
+LABELV $576
+byte 1 79
+byte 1 102
+byte 1 102
+byte 1 0
+align 1
+LABELV $574
+byte 1 77
+byte 1 97
+byte 1 120
+byte 1 105
+byte 1 109
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $573
+byte 1 72
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 0
+align 1
+LABELV $572
+byte 1 77
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $571
+byte 1 76
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $569
+byte 1 84
+byte 1 114
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $568
+byte 1 66
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $565
+byte 1 67
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $564
+byte 1 70
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $563
+byte 1 70
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $562
+byte 1 78
+byte 1 111
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $561
+byte 1 72
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 32
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $559
+byte 1 51
+byte 1 50
+byte 1 32
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $558
+byte 1 49
+byte 1 54
+byte 1 32
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $557
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $416
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $413
+byte 1 114
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $412
+byte 1 114
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $411
+byte 1 114
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 119
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $389
+byte 1 114
+byte 1 95
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 105
+byte 1 115
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $384
+byte 1 48
+byte 1 0
+align 1
+LABELV $381
+byte 1 114
+byte 1 95
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 95
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 121
+byte 1 0
+align 1
+LABELV $380
+byte 1 49
+byte 1 0
+align 1
+LABELV $379
+byte 1 114
+byte 1 95
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 95
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 121
+byte 1 0
+align 1
+LABELV $372
+byte 1 114
+byte 1 95
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $371
+byte 1 71
+byte 1 76
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 80
+byte 1 77
+byte 1 65
+byte 1 80
+byte 1 95
+byte 1 78
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 69
+byte 1 83
+byte 1 84
+byte 1 0
+align 1
+LABELV $370
+byte 1 71
+byte 1 76
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 80
+byte 1 77
+byte 1 65
+byte 1 80
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 0
+align 1
+LABELV $369
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $360
+byte 1 114
+byte 1 95
+byte 1 115
+byte 1 117
+byte 1 98
+byte 1 100
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $359
+byte 1 114
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 100
+byte 1 66
+byte 1 105
+byte 1 97
+byte 1 115
+byte 1 0
+align 1
+LABELV $352
+byte 1 114
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 105
+byte 1 108
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $351
+byte 1 114
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 104
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $350
+byte 1 114
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $342
+byte 1 114
+byte 1 95
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $339
+byte 1 114
+byte 1 95
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 109
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $336
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $152
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 118
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $150
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 0
+align 1
+LABELV $142
+byte 1 37
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $114
+byte 1 49
+byte 1 54
+byte 1 58
+byte 1 57
+byte 1 0
+align 1
+LABELV $113
+byte 1 49
+byte 1 46
+byte 1 55
+byte 1 56
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $112
+byte 1 53
+byte 1 58
+byte 1 51
+byte 1 0
+align 1
+LABELV $111
+byte 1 49
+byte 1 46
+byte 1 54
+byte 1 55
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $110
+byte 1 49
+byte 1 54
+byte 1 58
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $109
+byte 1 49
+byte 1 46
+byte 1 54
+byte 1 48
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $108
+byte 1 49
+byte 1 52
+byte 1 58
+byte 1 57
+byte 1 0
+align 1
+LABELV $107
+byte 1 49
+byte 1 46
+byte 1 53
+byte 1 54
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $106
+byte 1 51
+byte 1 58
+byte 1 50
+byte 1 0
+align 1
+LABELV $105
+byte 1 49
+byte 1 46
+byte 1 53
+byte 1 48
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $104
+byte 1 52
+byte 1 58
+byte 1 51
+byte 1 0
+align 1
+LABELV $103
+byte 1 49
+byte 1 46
+byte 1 51
+byte 1 51
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $102
+byte 1 53
+byte 1 58
+byte 1 52
+byte 1 0
+align 1
+LABELV $101
+byte 1 49
+byte 1 46
+byte 1 50
+byte 1 53
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $100
+byte 1 50
+byte 1 53
+byte 1 54
+byte 1 48
+byte 1 120
+byte 1 49
+byte 1 54
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $99
+byte 1 50
+byte 1 48
+byte 1 52
+byte 1 56
+byte 1 120
+byte 1 49
+byte 1 53
+byte 1 51
+byte 1 54
+byte 1 0
+align 1
+LABELV $98
+byte 1 49
+byte 1 57
+byte 1 50
+byte 1 48
+byte 1 120
+byte 1 49
+byte 1 50
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $97
+byte 1 49
+byte 1 57
+byte 1 50
+byte 1 48
+byte 1 120
+byte 1 49
+byte 1 48
+byte 1 56
+byte 1 48
+byte 1 0
+align 1
+LABELV $96
+byte 1 49
+byte 1 54
+byte 1 56
+byte 1 48
+byte 1 120
+byte 1 49
+byte 1 48
+byte 1 53
+byte 1 48
+byte 1 0
+align 1
+LABELV $95
+byte 1 49
+byte 1 54
+byte 1 48
+byte 1 48
+byte 1 120
+byte 1 49
+byte 1 50
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $94
+byte 1 49
+byte 1 54
+byte 1 48
+byte 1 48
+byte 1 120
+byte 1 57
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $93
+byte 1 49
+byte 1 52
+byte 1 52
+byte 1 48
+byte 1 120
+byte 1 57
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $92
+byte 1 49
+byte 1 51
+byte 1 54
+byte 1 54
+byte 1 120
+byte 1 55
+byte 1 54
+byte 1 56
+byte 1 0
+align 1
+LABELV $91
+byte 1 49
+byte 1 50
+byte 1 56
+byte 1 48
+byte 1 120
+byte 1 49
+byte 1 48
+byte 1 50
+byte 1 52
+byte 1 0
+align 1
+LABELV $90
+byte 1 49
+byte 1 50
+byte 1 56
+byte 1 48
+byte 1 120
+byte 1 57
+byte 1 54
+byte 1 48
+byte 1 0
+align 1
+LABELV $89
+byte 1 49
+byte 1 50
+byte 1 56
+byte 1 48
+byte 1 120
+byte 1 56
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $88
+byte 1 49
+byte 1 50
+byte 1 56
+byte 1 48
+byte 1 120
+byte 1 55
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $87
+byte 1 49
+byte 1 49
+byte 1 53
+byte 1 50
+byte 1 120
+byte 1 56
+byte 1 54
+byte 1 52
+byte 1 0
+align 1
+LABELV $86
+byte 1 49
+byte 1 48
+byte 1 50
+byte 1 52
+byte 1 120
+byte 1 55
+byte 1 54
+byte 1 56
+byte 1 0
+align 1
+LABELV $85
+byte 1 56
+byte 1 48
+byte 1 48
+byte 1 120
+byte 1 54
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $84
+byte 1 54
+byte 1 52
+byte 1 48
+byte 1 120
+byte 1 52
+byte 1 56
+byte 1 48
+byte 1 0
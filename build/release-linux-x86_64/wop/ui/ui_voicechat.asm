@@ -0,0 +1,2177 @@
+data
+align 4
+LABELV sendTarget_names
+address $78
+address $79
+byte 4 0
+code
+proc UI_VoiceChatMenu_SetClientNames 16 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $81
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 voiceChatMenuInfo+1436
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $82
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $81
+ADDRGP4 voiceChatMenuInfo+1628
+CNSTI4 0
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+1640
+INDIRI4
+CNSTI4 0
+NEI4 $87
+ADDRGP4 $80
+JUMPV
+LABELV $87
+ADDRGP4 voiceChatMenuInfo+1632
+INDIRI4
+ADDRGP4 voiceChatMenuInfo+1640
+INDIRI4
+LTI4 $90
+ADDRGP4 voiceChatMenuInfo+1632
+ADDRGP4 voiceChatMenuInfo+1640
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $90
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRGP4 voiceChatMenuInfo+1632
+INDIRI4
+ASGNI4
+ADDRGP4 $99
+JUMPV
+LABELV $96
+ADDRLP4 4
+INDIRI4
+ADDRGP4 voiceChatMenuInfo+1640
+INDIRI4
+LTI4 $101
+ADDRGP4 $98
+JUMPV
+LABELV $101
+ADDRLP4 8
+CNSTI4 5
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LSHI4
+ADDRGP4 voiceChatMenuInfo+1436
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LSHI4
+ADDRGP4 voiceChatMenuInfo+1644
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 12
+ADDRGP4 voiceChatMenuInfo+1628
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $97
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $99
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $96
+LABELV $98
+LABELV $80
+endproc UI_VoiceChatMenu_SetClientNames 16 12
+proc UI_VoiceChatMenu_UpdateSelection 24 4
+CNSTI4 84
+ADDRGP4 voiceChatMenuInfo+1636
+INDIRI4
+MULI4
+ADDRGP4 voiceChatMenuInfo+296+72
+ADDP4
+ADDRGP4 colorBlack
+ASGNP4
+CNSTI4 84
+ADDRGP4 voiceChatMenuInfo+1636
+INDIRI4
+MULI4
+ADDRGP4 voiceChatMenuInfo+296+80
+ADDP4
+ADDRGP4 colorDkLilac
+ASGNP4
+ADDRGP4 voiceChatMenuInfo+1636
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 voiceChatMenuInfo+1636
+INDIRI4
+ADDRGP4 voiceChatMenuInfo+1632
+INDIRI4
+ADDI4
+ADDRGP4 voiceChatMenuInfo+3692
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+CNSTI4 84
+ADDRGP4 voiceChatMenuInfo+1636
+INDIRI4
+MULI4
+ADDRGP4 voiceChatMenuInfo+296+72
+ADDP4
+ADDRGP4 colorDkOrange
+ASGNP4
+CNSTI4 84
+ADDRGP4 voiceChatMenuInfo+1636
+INDIRI4
+MULI4
+ADDRGP4 voiceChatMenuInfo+296+80
+ADDP4
+ADDRGP4 color_orange
+ASGNP4
+ADDRLP4 4
+ADDRGP4 voiceChatMenuInfo+880+48
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 trap_GetVoiceMuteClient
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $129
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $130
+JUMPV
+LABELV $129
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $130
+ADDRGP4 voiceChatMenuInfo+880+64
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 voiceChatMenuInfo+800+48
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 trap_GetVoiceGainClient
+CALLF4
+ASGNF4
+ADDRGP4 voiceChatMenuInfo+800+72
+CNSTF4 1084227584
+ADDRLP4 20
+INDIRF4
+MULF4
+ASGNF4
+LABELV $107
+endproc UI_VoiceChatMenu_UpdateSelection 24 4
+proc UI_VoiceChatMenu_UpEvent 8 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $136
+ADDRGP4 $135
+JUMPV
+LABELV $136
+ADDRGP4 voiceChatMenuInfo+1632
+INDIRI4
+CNSTI4 0
+LEI4 $138
+ADDRLP4 4
+ADDRGP4 voiceChatMenuInfo+1632
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 UI_VoiceChatMenu_SetClientNames
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 voiceChatMenuInfo+1636
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $143
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+LABELV $143
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 UI_VoiceChatMenu_UpdateSelection
+CALLV
+pop
+LABELV $138
+LABELV $135
+endproc UI_VoiceChatMenu_UpEvent 8 4
+proc UI_VoiceChatMenu_DownEvent 8 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $146
+ADDRGP4 $145
+JUMPV
+LABELV $146
+ADDRGP4 voiceChatMenuInfo+1632
+INDIRI4
+CNSTI4 6
+ADDI4
+ADDRGP4 voiceChatMenuInfo+1640
+INDIRI4
+GEI4 $148
+ADDRLP4 4
+ADDRGP4 voiceChatMenuInfo+1632
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 UI_VoiceChatMenu_SetClientNames
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 voiceChatMenuInfo+1636
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $154
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $154
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 UI_VoiceChatMenu_UpdateSelection
+CALLV
+pop
+LABELV $148
+LABELV $145
+endproc UI_VoiceChatMenu_DownEvent 8 4
+proc UI_VoiceChatMenu_Key 16 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 141
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $161
+ADDRLP4 0
+INDIRI4
+CNSTI4 142
+EQI4 $159
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $157
+LABELV $163
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 183
+EQI4 $161
+ADDRLP4 8
+INDIRI4
+CNSTI4 184
+EQI4 $159
+ADDRGP4 $157
+JUMPV
+LABELV $159
+ADDRGP4 voiceChatMenuInfo+1220
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 UI_VoiceChatMenu_UpEvent
+CALLV
+pop
+ADDRGP4 $158
+JUMPV
+LABELV $161
+ADDRGP4 voiceChatMenuInfo+1328
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 UI_VoiceChatMenu_DownEvent
+CALLV
+pop
+LABELV $157
+LABELV $158
+ADDRGP4 voiceChatMenuInfo
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 Menu_DefaultKey
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $156
+endproc UI_VoiceChatMenu_Key 16 8
+proc UI_VoiceChatMenu_Draw 0 20
+ADDRGP4 UI_DrawIngameBG
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 110
+ARGI4
+ADDRGP4 $165
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_black
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRGP4 voiceChatMenuInfo
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+LABELV $164
+endproc UI_VoiceChatMenu_Draw 0 20
+proc UI_VoiceChatMenu_SelectEvent 0 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $167
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 5
+SUBI4
+ARGI4
+ADDRGP4 UI_VoiceChatMenu_UpdateSelection
+CALLV
+pop
+LABELV $167
+LABELV $166
+endproc UI_VoiceChatMenu_SelectEvent 0 4
+proc UI_VoiceChatMenu_BackEvent 0 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $170
+ADDRGP4 $169
+JUMPV
+LABELV $170
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $169
+endproc UI_VoiceChatMenu_BackEvent 0 0
+proc UI_VoiceChatMenu_GainSliderEvent 16 12
+ADDRLP4 0
+ADDRGP4 voiceChatMenuInfo+1632
+INDIRI4
+ADDRGP4 voiceChatMenuInfo+1636
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 voiceChatMenuInfo+3692
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 8
+ADDRGP4 voiceChatMenuInfo+800+72
+INDIRF4
+CNSTF4 1084227584
+DIVF4
+ASGNF4
+ADDRGP4 $178
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $172
+endproc UI_VoiceChatMenu_GainSliderEvent 16 12
+proc UI_VoiceChatMenu_MuteEvent 16 8
+ADDRLP4 0
+ADDRGP4 voiceChatMenuInfo+1632
+INDIRI4
+ADDRGP4 voiceChatMenuInfo+1636
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 voiceChatMenuInfo+3692
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $183
+ADDRGP4 $179
+JUMPV
+LABELV $183
+ADDRGP4 voiceChatMenuInfo+880+64
+INDIRI4
+CNSTI4 0
+EQI4 $185
+ADDRGP4 $189
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $186
+JUMPV
+LABELV $185
+ADDRGP4 $190
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $186
+LABELV $179
+endproc UI_VoiceChatMenu_MuteEvent 16 8
+proc UI_VoiceChatMenu_MuteAllEvent 0 8
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $192
+ADDRGP4 $191
+JUMPV
+LABELV $192
+ADDRGP4 voiceChatMenuInfo+948+64
+INDIRI4
+CNSTI4 0
+EQI4 $194
+CNSTI4 2
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $195
+JUMPV
+LABELV $194
+CNSTI4 2
+ARGI4
+ADDRGP4 $199
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $195
+LABELV $191
+endproc UI_VoiceChatMenu_MuteAllEvent 0 8
+proc UI_VoiceChatMenu_sendTargetEvent 8 8
+ADDRLP4 0
+ADDRGP4 voiceChatMenuInfo+1016+68
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $203
+ADDRGP4 $200
+JUMPV
+LABELV $203
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $207
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $205
+LABELV $207
+ADDRGP4 $200
+JUMPV
+LABELV $205
+ADDRGP4 $208
+ARGP4
+ADDRGP4 voiceChatMenuInfo+1016+68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sendTarget_names
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $200
+endproc UI_VoiceChatMenu_sendTargetEvent 8 8
+proc UI_VoiceChatMenu_InitClients 1088 12
+ADDRGP4 $212
+ARGP4
+ADDRLP4 1036
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 voiceChatMenuInfo+1640
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $214
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigString
+CALLI4
+pop
+ADDRLP4 12
+ARGP4
+ADDRGP4 $218
+ARGP4
+ADDRLP4 1068
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 1068
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1072
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1072
+INDIRU4
+CNSTU4 0
+NEU4 $219
+ADDRGP4 $215
+JUMPV
+LABELV $219
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 1076
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $221
+ADDRGP4 $215
+JUMPV
+LABELV $221
+ADDRLP4 1084
+ADDRGP4 voiceChatMenuInfo+1640
+ASGNP4
+ADDRLP4 1080
+ADDRLP4 1084
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 1084
+INDIRP4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 1080
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 voiceChatMenuInfo+1644
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 voiceChatMenuInfo+1644
+ADDP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 8
+INDIRI4
+ADDRGP4 voiceChatMenuInfo+3692
+ADDP4
+ADDRLP4 0
+INDIRI4
+CVII1 4
+ASGNI1
+LABELV $215
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $214
+LABELV $211
+endproc UI_VoiceChatMenu_InitClients 1088 12
+proc UI_VoiceChatMenu_Init 112 12
+ADDRGP4 voiceChatMenuInfo
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 3756
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 voiceChatMenuInfo+268
+ADDRGP4 UI_VoiceChatMenu_Draw
+ASGNP4
+ADDRGP4 voiceChatMenuInfo+280
+CNSTI4 0
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+272
+ADDRGP4 UI_VoiceChatMenu_Key
+ASGNP4
+ADDRGP4 UI_VoiceChatMenu_Cache
+CALLV
+pop
+ADDRGP4 UI_VoiceChatMenu_InitClients
+CALLV
+pop
+ADDRGP4 UI_VoiceChatMenu_SetClientNames
+CALLV
+pop
+ADDRGP4 voiceChatMenuInfo+1220
+CNSTI4 11
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+1220+76
+CNSTI4 638
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+1220+80
+CNSTI4 236
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+1220+84
+CNSTI4 29
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+1220+88
+CNSTI4 74
+ASGNI4
+ADDRGP4 $243
+ARGP4
+ADDRLP4 76
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+1220+64
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRGP4 $246
+ARGP4
+ADDRLP4 80
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+1220+72
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+1220+52
+ADDRGP4 UI_VoiceChatMenu_UpEvent
+ASGNP4
+ADDRGP4 voiceChatMenuInfo+1220+12
+CNSTI4 3
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+1328
+CNSTI4 11
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+1328+76
+CNSTI4 638
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+1328+80
+CNSTI4 332
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+1328+84
+CNSTI4 29
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+1328+88
+CNSTI4 74
+ASGNI4
+ADDRGP4 $262
+ARGP4
+ADDRLP4 84
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+1328+64
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRGP4 $265
+ARGP4
+ADDRLP4 88
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+1328+72
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+1328+52
+ADDRGP4 UI_VoiceChatMenu_DownEvent
+ASGNP4
+ADDRGP4 voiceChatMenuInfo+1328+12
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 140
+ASGNI4
+ADDRGP4 $273
+JUMPV
+LABELV $270
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 voiceChatMenuInfo+296
+ADDP4
+CNSTI4 12
+ASGNI4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 voiceChatMenuInfo+296+76
+ADDP4
+CNSTF4 1101004800
+ASGNF4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 voiceChatMenuInfo+296+48
+ADDP4
+CNSTU4 4
+ASGNU4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 voiceChatMenuInfo+296+12
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+ADDI4
+ASGNI4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 voiceChatMenuInfo+296+16
+ADDP4
+CNSTI4 250
+ASGNI4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 voiceChatMenuInfo+296+20
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 voiceChatMenuInfo+296+52
+ADDP4
+ADDRGP4 UI_VoiceChatMenu_SelectEvent
+ASGNP4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 voiceChatMenuInfo+296+64
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 voiceChatMenuInfo+1436
+ADDP4
+ASGNP4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 voiceChatMenuInfo+296+72
+ADDP4
+ADDRGP4 colorBlack
+ASGNP4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 voiceChatMenuInfo+296+80
+ADDP4
+ADDRGP4 colorDkLilac
+ASGNP4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 voiceChatMenuInfo+296+68
+ADDP4
+CNSTI4 16
+ASGNI4
+LABELV $271
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 20
+ADDI4
+ASGNI4
+LABELV $273
+ADDRLP4 0
+INDIRI4
+ADDRGP4 voiceChatMenuInfo+1628
+INDIRI4
+LTI4 $270
+ADDRLP4 8
+CNSTI4 266
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+800
+CNSTI4 1
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+800+4
+ADDRGP4 $300
+ASGNP4
+ADDRGP4 voiceChatMenuInfo+800+48
+CNSTU4 8396800
+ASGNU4
+ADDRGP4 voiceChatMenuInfo+800+52
+ADDRGP4 UI_VoiceChatMenu_GainSliderEvent
+ASGNP4
+ADDRGP4 voiceChatMenuInfo+800+16
+CNSTI4 315
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+800+20
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+800+64
+CNSTF4 0
+ASGNF4
+ADDRGP4 voiceChatMenuInfo+800+68
+CNSTF4 1092616192
+ASGNF4
+ADDRGP4 voiceChatMenuInfo+800+72
+CNSTF4 1084227584
+ASGNF4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+880
+CNSTI4 5
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+880+4
+ADDRGP4 $318
+ASGNP4
+ADDRGP4 voiceChatMenuInfo+880+48
+CNSTU4 8396802
+ASGNU4
+ADDRGP4 voiceChatMenuInfo+880+52
+ADDRGP4 UI_VoiceChatMenu_MuteEvent
+ASGNP4
+ADDRGP4 voiceChatMenuInfo+880+16
+CNSTI4 315
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+880+20
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+880+64
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+948
+CNSTI4 5
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+948+4
+ADDRGP4 $332
+ASGNP4
+ADDRGP4 voiceChatMenuInfo+948+48
+CNSTU4 8388610
+ASGNU4
+ADDRGP4 voiceChatMenuInfo+948+52
+ADDRGP4 UI_VoiceChatMenu_MuteAllEvent
+ASGNP4
+ADDRGP4 voiceChatMenuInfo+948+16
+CNSTI4 315
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+948+20
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 96
+ADDRGP4 trap_GetVoiceMuteAll
+CALLI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+EQI4 $344
+ADDRLP4 92
+CNSTI4 1
+ASGNI4
+ADDRGP4 $345
+JUMPV
+LABELV $344
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+LABELV $345
+ADDRGP4 voiceChatMenuInfo+948+64
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+1016
+CNSTI4 3
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+1016+4
+ADDRGP4 $349
+ASGNP4
+ADDRGP4 voiceChatMenuInfo+1016+48
+CNSTU4 2
+ASGNU4
+ADDRGP4 voiceChatMenuInfo+1016+52
+ADDRGP4 UI_VoiceChatMenu_sendTargetEvent
+ASGNP4
+ADDRGP4 voiceChatMenuInfo+1016+16
+CNSTI4 315
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+1016+20
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+1016+80
+ADDRGP4 sendTarget_names
+ASGNP4
+ADDRGP4 $208
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $361
+JUMPV
+LABELV $360
+ADDRLP4 100
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 voiceChatMenuInfo+1016+80
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 12
+ARGP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 104
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 108
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+NEI4 $367
+ADDRGP4 voiceChatMenuInfo+1016+68
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $362
+JUMPV
+LABELV $367
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $361
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 voiceChatMenuInfo+1016+80
+INDIRP4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $360
+LABELV $362
+ADDRGP4 voiceChatMenuInfo+1136
+CNSTI4 12
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+1136+76
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 voiceChatMenuInfo+1136+52
+ADDRGP4 UI_VoiceChatMenu_BackEvent
+ASGNP4
+ADDRGP4 voiceChatMenuInfo+1136+12
+CNSTI4 1
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+1136+16
+CNSTI4 245
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+1136+20
+CNSTI4 340
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+1136+64
+ADDRGP4 $384
+ASGNP4
+ADDRGP4 voiceChatMenuInfo+1136+68
+CNSTI4 16
+ASGNI4
+ADDRGP4 voiceChatMenuInfo+1136+72
+ADDRGP4 color_black
+ASGNP4
+ADDRGP4 voiceChatMenuInfo+1136+80
+ADDRGP4 color_orange
+ASGNP4
+ADDRGP4 voiceChatMenuInfo
+ARGP4
+ADDRGP4 voiceChatMenuInfo+1220
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 voiceChatMenuInfo
+ARGP4
+ADDRGP4 voiceChatMenuInfo+1328
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $396
+JUMPV
+LABELV $393
+ADDRGP4 voiceChatMenuInfo
+ARGP4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 voiceChatMenuInfo+296
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $394
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $396
+ADDRLP4 0
+INDIRI4
+ADDRGP4 voiceChatMenuInfo+1628
+INDIRI4
+LTI4 $393
+ADDRGP4 voiceChatMenuInfo
+ARGP4
+ADDRGP4 voiceChatMenuInfo+800
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 voiceChatMenuInfo
+ARGP4
+ADDRGP4 voiceChatMenuInfo+880
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 voiceChatMenuInfo
+ARGP4
+ADDRGP4 voiceChatMenuInfo+948
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 voiceChatMenuInfo
+ARGP4
+ADDRGP4 voiceChatMenuInfo+1016
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 voiceChatMenuInfo
+ARGP4
+ADDRGP4 voiceChatMenuInfo+1136
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $227
+endproc UI_VoiceChatMenu_Init 112 12
+export UI_VoiceChatMenu_Cache
+proc UI_VoiceChatMenu_Cache 0 4
+ADDRGP4 $243
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $246
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $262
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $265
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $404
+endproc UI_VoiceChatMenu_Cache 0 4
+export UI_VoiceIngame
+proc UI_VoiceIngame 0 4
+ADDRGP4 UI_VoiceChatMenu_Init
+CALLV
+pop
+ADDRGP4 voiceChatMenuInfo
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $405
+endproc UI_VoiceIngame 0 4
+bss
+align 4
+LABELV voiceChatMenuInfo
+skip 3756
+import UI_HelpMenu_Cache
+import UI_HelpMenu_f
+import UI_HelpMenu
+import DrawStringWithCutFrame
+import DrawTurnableString
+import Draw4VertsPic
+import DrawTriangle
+import FillTriangle
+import DrawPic2Color
+import DrawLine
+import AdvancedDrawPicA
+import UI_InitGameinfo
+import UI_GetNumBots
+import UI_GetBotInfoByNumber
+import UI_GetNumArenas
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_GetVoiceGainClient
+import trap_GetVoiceMuteAll
+import trap_GetVoiceMuteClient
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_CIN_SetExtents
+import trap_CIN_StopCinematic
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_PlayCinematic
+import trap_RealTime
+import trap_S_StartBackgroundTrack
+import trap_S_StopBackgroundTrack
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_SaveCachedServers
+import trap_LAN_LoadCachedServers
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import BotListCompare
+import uis
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString2
+import UI_AutoWrappedString_LineCount
+import UI_DrawString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawIngameBG
+import UI_DrawStringNS
+import UI_ModelIcon
+import UI_DrawHandlePic1024
+import UI_AdjustFrom1024
+import UI_StopMusic
+import UI_StartCreditMusic
+import UI_StartMusic
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_ClearModelCache
+import UI_PrecacheClientModelname
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import UI_SpecifyPasswordMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import Demos_Cache
+import UI_DemosMenu
+import SetDefaultBinds_onUnusedKeys
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import SetupDefaultMenu_Cache
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import Music_NextTrack
+import Music_TriggerRestart
+import Music_Check
+import MusicMenu_Cache
+import MusicMenu_Open
+import MusicMenu_Shutdown
+import MusicMenu_Init
+import UI_CallVoteMenu
+import UI_InGameMenu
+import InGame_Cache
+import UI_SecretMenu
+import UI_InitBigCredits
+import UI_BigCredits_Cache
+import UI_CreditMenu
+import ExitMenu_Cache
+import ExitMenu_Init
+import UI_MainMenu
+import MainMenu_Cache
+import UI_UpdateCvars
+import UI_RegisterCvars
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import listbar_bluecolor
+import text_color_bluehighlight
+import text_color_bluenormal
+import text_color_ighighlight
+import text_color_ignormal
+import listbar_igcolor
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_lightOrange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_click_sound
+import menu_switch_sound
+import menu_move_sound
+import ScrollList_Key
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import wop_AutoBindUnusedKeys
+import wop_AutoswitchSongByNextMap
+import con_notifytime
+import s_wop_restarted
+import syc_logo
+import spraycolor
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_createGametype
+import ui_browserHidePrivate
+import ui_browserOnlyHumans
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
+lit
+align 1
+LABELV $384
+byte 1 66
+byte 1 65
+byte 1 67
+byte 1 75
+byte 1 0
+align 1
+LABELV $349
+byte 1 84
+byte 1 97
+byte 1 108
+byte 1 107
+byte 1 32
+byte 1 84
+byte 1 111
+byte 1 58
+byte 1 0
+align 1
+LABELV $332
+byte 1 77
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $318
+byte 1 77
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $300
+byte 1 86
+byte 1 111
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $265
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 49
+byte 1 0
+align 1
+LABELV $262
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 48
+byte 1 0
+align 1
+LABELV $246
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 117
+byte 1 112
+byte 1 49
+byte 1 0
+align 1
+LABELV $243
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 117
+byte 1 112
+byte 1 48
+byte 1 0
+align 1
+LABELV $218
+byte 1 110
+byte 1 0
+align 1
+LABELV $212
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $208
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 112
+byte 1 83
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 84
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $199
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 112
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 109
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $198
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 112
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $190
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 112
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $189
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 112
+byte 1 32
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $178
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 112
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $165
+byte 1 86
+byte 1 79
+byte 1 73
+byte 1 67
+byte 1 69
+byte 1 0
+align 1
+LABELV $79
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $78
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
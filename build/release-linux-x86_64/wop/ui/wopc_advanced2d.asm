@@ -0,0 +1,5421 @@
+data
+export initrefdef
+align 4
+LABELV initrefdef
+byte 4 0
+code
+proc Initrefdef2D 20 16
+ADDRGP4 refdef2D
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 368
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 refdef2D+76
+CNSTI4 1
+ASGNI4
+ADDRGP4 refdef2D+24
+CNSTF4 1134559232
+ASGNF4
+ADDRGP4 refdef2D+24+4
+CNSTF4 1131413504
+ASGNF4
+ADDRGP4 refdef2D+24+8
+CNSTF4 1148846080
+ASGNF4
+ADDRGP4 refdef2D+36
+CNSTF4 0
+ASGNF4
+ADDRGP4 refdef2D+36+4
+CNSTF4 0
+ASGNF4
+ADDRGP4 refdef2D+36+8
+CNSTF4 3212836864
+ASGNF4
+ADDRGP4 refdef2D+36+12
+CNSTF4 3212836864
+ASGNF4
+ADDRGP4 refdef2D+36+12+4
+CNSTF4 0
+ASGNF4
+ADDRGP4 refdef2D+36+12+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 refdef2D+36+24
+CNSTF4 0
+ASGNF4
+ADDRGP4 refdef2D+36+24+4
+CNSTF4 3212836864
+ASGNF4
+ADDRGP4 refdef2D+36+24+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 16
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 8
+CNSTF4 1142947840
+ASGNF4
+ADDRLP4 12
+CNSTF4 1139802112
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 UI_AdjustFrom640
+CALLV
+pop
+ADDRGP4 refdef2D
+ADDRLP4 0
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 refdef2D+4
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 refdef2D+8
+ADDRLP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 refdef2D+12
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 refdef2D+16
+CNSTF4 1108210966
+ASGNF4
+ADDRGP4 refdef2D+20
+CNSTF4 1104670344
+ASGNF4
+ADDRGP4 refdef2D+72
+ADDRGP4 uis+4
+INDIRI4
+ASGNI4
+ADDRGP4 initrefdef
+CNSTI4 1
+ASGNI4
+LABELV $77
+endproc Initrefdef2D 20 16
+proc DrawPoly 4 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 initrefdef
+INDIRI4
+CNSTI4 0
+NEI4 $113
+ADDRGP4 Initrefdef2D
+CALLV
+pop
+LABELV $113
+ADDRGP4 trap_R_ClearScene
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+ADDRGP4 refdef2D
+ARGP4
+ADDRGP4 trap_R_RenderScene
+CALLV
+pop
+LABELV $112
+endproc DrawPoly 4 12
+export AdvancedDrawPicA
+proc AdvancedDrawPicA 252 12
+ADDRFP4 36
+ADDRFP4 36
+INDIRP4
+ASGNP4
+ADDRFP4 40
+ADDRFP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 96
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 12
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 96
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 96+8
+ADDRLP4 0
+ASGNP4
+ADDRLP4 96+4
+CNSTI4 4
+ASGNI4
+ADDRLP4 96
+ADDRFP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 128
+CNSTF4 1132396544
+ADDRFP4 36
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 132
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 132
+INDIRF4
+LTF4 $126
+ADDRLP4 124
+ADDRLP4 128
+INDIRF4
+ADDRLP4 132
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $127
+JUMPV
+LABELV $126
+ADDRLP4 124
+ADDRLP4 128
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $127
+ADDRLP4 136
+ADDRLP4 124
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRLP4 0+20
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRLP4 144
+CNSTF4 1132396544
+ADDRFP4 36
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 148
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 144
+INDIRF4
+ADDRLP4 148
+INDIRF4
+LTF4 $140
+ADDRLP4 140
+ADDRLP4 144
+INDIRF4
+ADDRLP4 148
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $141
+JUMPV
+LABELV $140
+ADDRLP4 140
+ADDRLP4 144
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $141
+ADDRLP4 152
+ADDRLP4 140
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+1
+ADDRLP4 152
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20+1
+ADDRLP4 152
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+1
+ADDRLP4 152
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+1
+ADDRLP4 152
+INDIRU1
+ASGNU1
+ADDRLP4 160
+CNSTF4 1132396544
+ADDRFP4 36
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 164
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 160
+INDIRF4
+ADDRLP4 164
+INDIRF4
+LTF4 $154
+ADDRLP4 156
+ADDRLP4 160
+INDIRF4
+ADDRLP4 164
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $155
+JUMPV
+LABELV $154
+ADDRLP4 156
+ADDRLP4 160
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $155
+ADDRLP4 168
+ADDRLP4 156
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+2
+ADDRLP4 168
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20+2
+ADDRLP4 168
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+2
+ADDRLP4 168
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+2
+ADDRLP4 168
+INDIRU1
+ASGNU1
+ADDRLP4 176
+CNSTF4 1132396544
+ADDRFP4 36
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 180
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 176
+INDIRF4
+ADDRLP4 180
+INDIRF4
+LTF4 $168
+ADDRLP4 172
+ADDRLP4 176
+INDIRF4
+ADDRLP4 180
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $169
+JUMPV
+LABELV $168
+ADDRLP4 172
+ADDRLP4 176
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $169
+ADDRLP4 184
+ADDRLP4 172
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+3
+ADDRLP4 184
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20+3
+ADDRLP4 184
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+3
+ADDRLP4 184
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+3
+ADDRLP4 184
+INDIRU1
+ASGNU1
+ADDRFP4 40
+CNSTF4 1016003125
+ADDRFP4 40
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRLP4 188
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 116
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRLP4 192
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 116+4
+ADDRLP4 192
+INDIRF4
+NEGF4
+ASGNF4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRLP4 196
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 108
+ADDRLP4 196
+INDIRF4
+ASGNF4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRLP4 200
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 108+4
+ADDRLP4 200
+INDIRF4
+ASGNF4
+ADDRLP4 204
+ADDRFP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 1
+EQI4 $174
+ADDRLP4 204
+INDIRI4
+CNSTI4 2
+EQI4 $189
+ADDRLP4 204
+INDIRI4
+CNSTI4 3
+EQI4 $206
+ADDRGP4 $172
+JUMPV
+LABELV $172
+LABELV $174
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0+24
+ADDRFP4 0
+INDIRF4
+ADDRLP4 116
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 116+4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48
+ADDRFP4 0
+INDIRF4
+ADDRLP4 116
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 108
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 116+4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 108+4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72
+ADDRFP4 0
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72+4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 108+4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $173
+JUMPV
+LABELV $189
+ADDRLP4 208
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 212
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 208
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 212
+INDIRF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 208
+INDIRF4
+ADDRLP4 108+4
+INDIRF4
+ADDRLP4 212
+INDIRF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0+24
+ADDRFP4 0
+INDIRF4
+ADDRLP4 116
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1056964608
+ADDRLP4 108
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 116+4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1056964608
+ADDRLP4 108+4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0+48
+ADDRFP4 0
+INDIRF4
+ADDRLP4 116
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1056964608
+ADDRLP4 108
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 116+4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1056964608
+ADDRLP4 108+4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72
+ADDRFP4 0
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 108
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72+4
+ADDRFP4 4
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 108+4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $173
+JUMPV
+LABELV $206
+ADDRLP4 216
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 220
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 224
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 216
+INDIRF4
+ADDRLP4 116
+INDIRF4
+ADDRLP4 220
+INDIRF4
+MULF4
+MULF4
+SUBF4
+ADDRLP4 216
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 224
+INDIRF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 216
+INDIRF4
+ADDRLP4 116+4
+INDIRF4
+ADDRLP4 220
+INDIRF4
+MULF4
+MULF4
+SUBF4
+ADDRLP4 216
+INDIRF4
+ADDRLP4 108+4
+INDIRF4
+ADDRLP4 224
+INDIRF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 228
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0+24
+ADDRFP4 0
+INDIRF4
+ADDRLP4 228
+INDIRF4
+ADDRLP4 116
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ADDRLP4 228
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 232
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0+24+4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 232
+INDIRF4
+ADDRLP4 116+4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ADDRLP4 232
+INDIRF4
+ADDRLP4 108+4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 236
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0+48
+ADDRFP4 0
+INDIRF4
+ADDRLP4 236
+INDIRF4
+ADDRLP4 116
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ADDRLP4 236
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 240
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0+48+4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 240
+INDIRF4
+ADDRLP4 116+4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ADDRLP4 240
+INDIRF4
+ADDRLP4 108+4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 244
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0+72
+ADDRFP4 0
+INDIRF4
+ADDRLP4 244
+INDIRF4
+ADDRLP4 116
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+MULF4
+SUBF4
+ADDRLP4 244
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 248
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0+72+4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 248
+INDIRF4
+ADDRLP4 116+4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+MULF4
+SUBF4
+ADDRLP4 248
+INDIRF4
+ADDRLP4 108+4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $173
+ADDRLP4 0+12
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+12+4
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0+24+12
+ADDRFP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+24+12+4
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0+48+12
+ADDRFP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+48+12+4
+ADDRFP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0+72+12
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+72+12+4
+ADDRFP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 96
+ARGP4
+ADDRGP4 DrawPoly
+CALLV
+pop
+LABELV $115
+endproc AdvancedDrawPicA 252 12
+export DrawLine
+proc DrawLine 204 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 104
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 12
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 96
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 104+8
+ADDRLP4 0
+ASGNP4
+ADDRLP4 104+4
+CNSTI4 4
+ASGNI4
+ADDRLP4 104
+ADDRGP4 uis+11392
+INDIRI4
+ASGNI4
+ADDRLP4 124
+CNSTF4 1132396544
+ADDRFP4 20
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 128
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 124
+INDIRF4
+ADDRLP4 128
+INDIRF4
+LTF4 $255
+ADDRLP4 120
+ADDRLP4 124
+INDIRF4
+ADDRLP4 128
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $256
+JUMPV
+LABELV $255
+ADDRLP4 120
+ADDRLP4 124
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $256
+ADDRLP4 132
+ADDRLP4 120
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20
+ADDRLP4 132
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20
+ADDRLP4 132
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20
+ADDRLP4 132
+INDIRU1
+ASGNU1
+ADDRLP4 0+20
+ADDRLP4 132
+INDIRU1
+ASGNU1
+ADDRLP4 140
+CNSTF4 1132396544
+ADDRFP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 144
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 140
+INDIRF4
+ADDRLP4 144
+INDIRF4
+LTF4 $269
+ADDRLP4 136
+ADDRLP4 140
+INDIRF4
+ADDRLP4 144
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $270
+JUMPV
+LABELV $269
+ADDRLP4 136
+ADDRLP4 140
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $270
+ADDRLP4 148
+ADDRLP4 136
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+1
+ADDRLP4 148
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20+1
+ADDRLP4 148
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+1
+ADDRLP4 148
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+1
+ADDRLP4 148
+INDIRU1
+ASGNU1
+ADDRLP4 156
+CNSTF4 1132396544
+ADDRFP4 20
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 160
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 156
+INDIRF4
+ADDRLP4 160
+INDIRF4
+LTF4 $283
+ADDRLP4 152
+ADDRLP4 156
+INDIRF4
+ADDRLP4 160
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $284
+JUMPV
+LABELV $283
+ADDRLP4 152
+ADDRLP4 156
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $284
+ADDRLP4 164
+ADDRLP4 152
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+2
+ADDRLP4 164
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20+2
+ADDRLP4 164
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+2
+ADDRLP4 164
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+2
+ADDRLP4 164
+INDIRU1
+ASGNU1
+ADDRLP4 172
+CNSTF4 1132396544
+ADDRFP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 176
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 172
+INDIRF4
+ADDRLP4 176
+INDIRF4
+LTF4 $297
+ADDRLP4 168
+ADDRLP4 172
+INDIRF4
+ADDRLP4 176
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $298
+JUMPV
+LABELV $297
+ADDRLP4 168
+ADDRLP4 172
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $298
+ADDRLP4 180
+ADDRLP4 168
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+3
+ADDRLP4 180
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20+3
+ADDRLP4 180
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+3
+ADDRLP4 180
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+3
+ADDRLP4 180
+INDIRU1
+ASGNU1
+ADDRLP4 96
+ADDRFP4 4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 96+4
+ADDRFP4 8
+INDIRF4
+ADDRFP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 184
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 184
+INDIRF4
+ADDRLP4 184
+INDIRF4
+MULF4
+ADDRLP4 96+4
+INDIRF4
+ADDRLP4 96+4
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 188
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 116
+CNSTF4 1065353216
+ADDRLP4 188
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 96
+ADDRLP4 96
+INDIRF4
+ADDRLP4 116
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 96+4
+INDIRF4
+ADDRLP4 116
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 196
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 196
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDRFP4 16
+INDIRF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 196
+INDIRF4
+ADDRLP4 96+4
+INDIRF4
+ADDRFP4 16
+INDIRF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0+24
+ADDRFP4 8
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 96
+INDIRF4
+ADDRFP4 16
+INDIRF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRFP4 12
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 96+4
+INDIRF4
+ADDRFP4 16
+INDIRF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0+48
+ADDRFP4 8
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 96
+INDIRF4
+ADDRFP4 16
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+4
+ADDRFP4 12
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 96+4
+INDIRF4
+ADDRFP4 16
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72
+ADDRFP4 0
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 96
+INDIRF4
+ADDRFP4 16
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72+4
+ADDRFP4 4
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 96+4
+INDIRF4
+ADDRFP4 16
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+24+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+72+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+72+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 104
+ARGP4
+ADDRGP4 DrawPoly
+CALLV
+pop
+LABELV $243
+endproc DrawLine 204 12
+export DrawPic2Color
+proc DrawPic2Color 233 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 32
+ADDRFP4 32
+INDIRP4
+ASGNP4
+ADDRFP4 36
+ADDRFP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 96
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 12
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 96
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 96+8
+ADDRLP4 0
+ASGNP4
+ADDRLP4 96+4
+CNSTI4 4
+ASGNI4
+ADDRLP4 96
+ADDRFP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 112
+CNSTF4 1132396544
+ADDRFP4 32
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 116
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 112
+INDIRF4
+ADDRLP4 116
+INDIRF4
+LTF4 $342
+ADDRLP4 108
+ADDRLP4 112
+INDIRF4
+ADDRLP4 116
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $343
+JUMPV
+LABELV $342
+ADDRLP4 108
+ADDRLP4 112
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $343
+ADDRLP4 120
+ADDRLP4 108
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20
+ADDRLP4 120
+INDIRU1
+ASGNU1
+ADDRLP4 0+20
+ADDRLP4 120
+INDIRU1
+ASGNU1
+ADDRLP4 128
+CNSTF4 1132396544
+ADDRFP4 36
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 132
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 132
+INDIRF4
+LTF4 $349
+ADDRLP4 124
+ADDRLP4 128
+INDIRF4
+ADDRLP4 132
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $350
+JUMPV
+LABELV $349
+ADDRLP4 124
+ADDRLP4 128
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $350
+ADDRLP4 136
+ADDRLP4 124
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+48+20
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRLP4 144
+CNSTF4 1132396544
+ADDRFP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 148
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 144
+INDIRF4
+ADDRLP4 148
+INDIRF4
+LTF4 $357
+ADDRLP4 140
+ADDRLP4 144
+INDIRF4
+ADDRLP4 148
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $358
+JUMPV
+LABELV $357
+ADDRLP4 140
+ADDRLP4 144
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $358
+ADDRLP4 152
+ADDRLP4 140
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+1
+ADDRLP4 152
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+1
+ADDRLP4 152
+INDIRU1
+ASGNU1
+ADDRLP4 160
+CNSTF4 1132396544
+ADDRFP4 36
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 164
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 160
+INDIRF4
+ADDRLP4 164
+INDIRF4
+LTF4 $366
+ADDRLP4 156
+ADDRLP4 160
+INDIRF4
+ADDRLP4 164
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $367
+JUMPV
+LABELV $366
+ADDRLP4 156
+ADDRLP4 160
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $367
+ADDRLP4 168
+ADDRLP4 156
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+48+20+1
+ADDRLP4 168
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+1
+ADDRLP4 168
+INDIRU1
+ASGNU1
+ADDRLP4 176
+CNSTF4 1132396544
+ADDRFP4 32
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 180
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 176
+INDIRF4
+ADDRLP4 180
+INDIRF4
+LTF4 $374
+ADDRLP4 172
+ADDRLP4 176
+INDIRF4
+ADDRLP4 180
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $375
+JUMPV
+LABELV $374
+ADDRLP4 172
+ADDRLP4 176
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $375
+ADDRLP4 184
+ADDRLP4 172
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+2
+ADDRLP4 184
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+2
+ADDRLP4 184
+INDIRU1
+ASGNU1
+ADDRLP4 192
+CNSTF4 1132396544
+ADDRFP4 36
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 196
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 192
+INDIRF4
+ADDRLP4 196
+INDIRF4
+LTF4 $383
+ADDRLP4 188
+ADDRLP4 192
+INDIRF4
+ADDRLP4 196
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $384
+JUMPV
+LABELV $383
+ADDRLP4 188
+ADDRLP4 192
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $384
+ADDRLP4 200
+ADDRLP4 188
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+48+20+2
+ADDRLP4 200
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+2
+ADDRLP4 200
+INDIRU1
+ASGNU1
+ADDRLP4 208
+CNSTF4 1132396544
+ADDRFP4 32
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 212
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 208
+INDIRF4
+ADDRLP4 212
+INDIRF4
+LTF4 $391
+ADDRLP4 204
+ADDRLP4 208
+INDIRF4
+ADDRLP4 212
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $392
+JUMPV
+LABELV $391
+ADDRLP4 204
+ADDRLP4 208
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $392
+ADDRLP4 216
+ADDRLP4 204
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+3
+ADDRLP4 216
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+3
+ADDRLP4 216
+INDIRU1
+ASGNU1
+ADDRLP4 224
+CNSTF4 1132396544
+ADDRFP4 36
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 228
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 224
+INDIRF4
+ADDRLP4 228
+INDIRF4
+LTF4 $400
+ADDRLP4 220
+ADDRLP4 224
+INDIRF4
+ADDRLP4 228
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $401
+JUMPV
+LABELV $400
+ADDRLP4 220
+ADDRLP4 224
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $401
+ADDRLP4 232
+ADDRLP4 220
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+48+20+3
+ADDRLP4 232
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+3
+ADDRLP4 232
+INDIRU1
+ASGNU1
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0+24
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0+48
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0+72+4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+12+4
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0+24+12
+ADDRFP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+24+12+4
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0+48+12
+ADDRFP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+48+12+4
+ADDRFP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0+72+12
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+72+12+4
+ADDRFP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 96
+ARGP4
+ADDRGP4 DrawPoly
+CALLV
+pop
+LABELV $335
+endproc DrawPic2Color 233 12
+export FillRect2Color
+proc FillRect2Color 233 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 96
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 12
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 96
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 96+8
+ADDRLP4 0
+ASGNP4
+ADDRLP4 96+4
+CNSTI4 4
+ASGNI4
+ADDRLP4 96
+ADDRGP4 uis+11392
+INDIRI4
+ASGNI4
+ADDRLP4 112
+CNSTF4 1132396544
+ADDRFP4 16
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 116
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 112
+INDIRF4
+ADDRLP4 116
+INDIRF4
+LTF4 $438
+ADDRLP4 108
+ADDRLP4 112
+INDIRF4
+ADDRLP4 116
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $439
+JUMPV
+LABELV $438
+ADDRLP4 108
+ADDRLP4 112
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $439
+ADDRLP4 120
+ADDRLP4 108
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20
+ADDRLP4 120
+INDIRU1
+ASGNU1
+ADDRLP4 0+20
+ADDRLP4 120
+INDIRU1
+ASGNU1
+ADDRLP4 128
+CNSTF4 1132396544
+ADDRFP4 20
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 132
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 132
+INDIRF4
+LTF4 $445
+ADDRLP4 124
+ADDRLP4 128
+INDIRF4
+ADDRLP4 132
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $446
+JUMPV
+LABELV $445
+ADDRLP4 124
+ADDRLP4 128
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $446
+ADDRLP4 136
+ADDRLP4 124
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+48+20
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRLP4 144
+CNSTF4 1132396544
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 148
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 144
+INDIRF4
+ADDRLP4 148
+INDIRF4
+LTF4 $453
+ADDRLP4 140
+ADDRLP4 144
+INDIRF4
+ADDRLP4 148
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $454
+JUMPV
+LABELV $453
+ADDRLP4 140
+ADDRLP4 144
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $454
+ADDRLP4 152
+ADDRLP4 140
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+1
+ADDRLP4 152
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+1
+ADDRLP4 152
+INDIRU1
+ASGNU1
+ADDRLP4 160
+CNSTF4 1132396544
+ADDRFP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 164
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 160
+INDIRF4
+ADDRLP4 164
+INDIRF4
+LTF4 $462
+ADDRLP4 156
+ADDRLP4 160
+INDIRF4
+ADDRLP4 164
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $463
+JUMPV
+LABELV $462
+ADDRLP4 156
+ADDRLP4 160
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $463
+ADDRLP4 168
+ADDRLP4 156
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+48+20+1
+ADDRLP4 168
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+1
+ADDRLP4 168
+INDIRU1
+ASGNU1
+ADDRLP4 176
+CNSTF4 1132396544
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 180
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 176
+INDIRF4
+ADDRLP4 180
+INDIRF4
+LTF4 $470
+ADDRLP4 172
+ADDRLP4 176
+INDIRF4
+ADDRLP4 180
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $471
+JUMPV
+LABELV $470
+ADDRLP4 172
+ADDRLP4 176
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $471
+ADDRLP4 184
+ADDRLP4 172
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+2
+ADDRLP4 184
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+2
+ADDRLP4 184
+INDIRU1
+ASGNU1
+ADDRLP4 192
+CNSTF4 1132396544
+ADDRFP4 20
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 196
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 192
+INDIRF4
+ADDRLP4 196
+INDIRF4
+LTF4 $479
+ADDRLP4 188
+ADDRLP4 192
+INDIRF4
+ADDRLP4 196
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $480
+JUMPV
+LABELV $479
+ADDRLP4 188
+ADDRLP4 192
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $480
+ADDRLP4 200
+ADDRLP4 188
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+48+20+2
+ADDRLP4 200
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+2
+ADDRLP4 200
+INDIRU1
+ASGNU1
+ADDRLP4 208
+CNSTF4 1132396544
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 212
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 208
+INDIRF4
+ADDRLP4 212
+INDIRF4
+LTF4 $487
+ADDRLP4 204
+ADDRLP4 208
+INDIRF4
+ADDRLP4 212
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $488
+JUMPV
+LABELV $487
+ADDRLP4 204
+ADDRLP4 208
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $488
+ADDRLP4 216
+ADDRLP4 204
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+3
+ADDRLP4 216
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+3
+ADDRLP4 216
+INDIRU1
+ASGNU1
+ADDRLP4 224
+CNSTF4 1132396544
+ADDRFP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 228
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 224
+INDIRF4
+ADDRLP4 228
+INDIRF4
+LTF4 $496
+ADDRLP4 220
+ADDRLP4 224
+INDIRF4
+ADDRLP4 228
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $497
+JUMPV
+LABELV $496
+ADDRLP4 220
+ADDRLP4 224
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $497
+ADDRLP4 232
+ADDRLP4 220
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+48+20+3
+ADDRLP4 232
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+3
+ADDRLP4 232
+INDIRU1
+ASGNU1
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0+24
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0+48
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0+72+4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+24+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+72+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+72+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96
+ARGP4
+ADDRGP4 DrawPoly
+CALLV
+pop
+LABELV $430
+endproc FillRect2Color 233 12
+export FillTriangle
+proc FillTriangle 157 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 20
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 24
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 72
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 12
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 72
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 72+8
+ADDRLP4 0
+ASGNP4
+ADDRLP4 72+4
+CNSTI4 3
+ASGNI4
+ADDRLP4 72
+ADDRGP4 uis+11392
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRF4
+ADDRFP4 0
+INDIRF4
+SUBF4
+ADDRFP4 20
+INDIRF4
+ADDRFP4 4
+INDIRF4
+SUBF4
+MULF4
+ADDRFP4 12
+INDIRF4
+ADDRFP4 4
+INDIRF4
+SUBF4
+ADDRFP4 16
+INDIRF4
+ADDRFP4 0
+INDIRF4
+SUBF4
+MULF4
+SUBF4
+CNSTF4 0
+GEF4 $530
+ADDRLP4 84
+ADDRFP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRLP4 84
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 84
+ADDRFP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 20
+ADDRLP4 84
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $530
+ADDRLP4 100
+CNSTF4 1132396544
+ADDRFP4 24
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 104
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 100
+INDIRF4
+ADDRLP4 104
+INDIRF4
+LTF4 $538
+ADDRLP4 96
+ADDRLP4 100
+INDIRF4
+ADDRLP4 104
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $539
+JUMPV
+LABELV $538
+ADDRLP4 96
+ADDRLP4 100
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $539
+ADDRLP4 108
+ADDRLP4 96
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+48+20
+ADDRLP4 108
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20
+ADDRLP4 108
+INDIRU1
+ASGNU1
+ADDRLP4 0+20
+ADDRLP4 108
+INDIRU1
+ASGNU1
+ADDRLP4 116
+CNSTF4 1132396544
+ADDRFP4 24
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 120
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 116
+INDIRF4
+ADDRLP4 120
+INDIRF4
+LTF4 $549
+ADDRLP4 112
+ADDRLP4 116
+INDIRF4
+ADDRLP4 120
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $550
+JUMPV
+LABELV $549
+ADDRLP4 112
+ADDRLP4 116
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $550
+ADDRLP4 124
+ADDRLP4 112
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+48+20+1
+ADDRLP4 124
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+1
+ADDRLP4 124
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+1
+ADDRLP4 124
+INDIRU1
+ASGNU1
+ADDRLP4 132
+CNSTF4 1132396544
+ADDRFP4 24
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 136
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 132
+INDIRF4
+ADDRLP4 136
+INDIRF4
+LTF4 $560
+ADDRLP4 128
+ADDRLP4 132
+INDIRF4
+ADDRLP4 136
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $561
+JUMPV
+LABELV $560
+ADDRLP4 128
+ADDRLP4 132
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $561
+ADDRLP4 140
+ADDRLP4 128
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+48+20+2
+ADDRLP4 140
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+2
+ADDRLP4 140
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+2
+ADDRLP4 140
+INDIRU1
+ASGNU1
+ADDRLP4 148
+CNSTF4 1132396544
+ADDRFP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 152
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 148
+INDIRF4
+ADDRLP4 152
+INDIRF4
+LTF4 $571
+ADDRLP4 144
+ADDRLP4 148
+INDIRF4
+ADDRLP4 152
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $572
+JUMPV
+LABELV $571
+ADDRLP4 144
+ADDRLP4 148
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $572
+ADDRLP4 156
+ADDRLP4 144
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+48+20+3
+ADDRLP4 156
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+3
+ADDRLP4 156
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+3
+ADDRLP4 156
+INDIRU1
+ASGNU1
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0+24
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0+48
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+48+4
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+24+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+ARGP4
+ADDRGP4 DrawPoly
+CALLV
+pop
+LABELV $526
+endproc FillTriangle 157 12
+export DrawTriangle
+proc DrawTriangle 0 24
+ADDRFP4 24
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRGP4 DrawLine
+CALLV
+pop
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRGP4 DrawLine
+CALLV
+pop
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRGP4 DrawLine
+CALLV
+pop
+LABELV $593
+endproc DrawTriangle 0 24
+export Draw4VertsPic
+proc Draw4VertsPic 169 12
+ADDRFP4 36
+ADDRFP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 96
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 12
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 96
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 96+8
+ADDRLP4 0
+ASGNP4
+ADDRLP4 96+4
+CNSTI4 4
+ASGNI4
+ADDRLP4 96
+ADDRFP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 112
+CNSTF4 1132396544
+ADDRFP4 36
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 116
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 112
+INDIRF4
+ADDRLP4 116
+INDIRF4
+LTF4 $605
+ADDRLP4 108
+ADDRLP4 112
+INDIRF4
+ADDRLP4 116
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $606
+JUMPV
+LABELV $605
+ADDRLP4 108
+ADDRLP4 112
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $606
+ADDRLP4 120
+ADDRLP4 108
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20
+ADDRLP4 120
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20
+ADDRLP4 120
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20
+ADDRLP4 120
+INDIRU1
+ASGNU1
+ADDRLP4 0+20
+ADDRLP4 120
+INDIRU1
+ASGNU1
+ADDRLP4 128
+CNSTF4 1132396544
+ADDRFP4 36
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 132
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 132
+INDIRF4
+LTF4 $619
+ADDRLP4 124
+ADDRLP4 128
+INDIRF4
+ADDRLP4 132
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $620
+JUMPV
+LABELV $619
+ADDRLP4 124
+ADDRLP4 128
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $620
+ADDRLP4 136
+ADDRLP4 124
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+1
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20+1
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+1
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+1
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRLP4 144
+CNSTF4 1132396544
+ADDRFP4 36
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 148
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 144
+INDIRF4
+ADDRLP4 148
+INDIRF4
+LTF4 $633
+ADDRLP4 140
+ADDRLP4 144
+INDIRF4
+ADDRLP4 148
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $634
+JUMPV
+LABELV $633
+ADDRLP4 140
+ADDRLP4 144
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $634
+ADDRLP4 152
+ADDRLP4 140
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+2
+ADDRLP4 152
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20+2
+ADDRLP4 152
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+2
+ADDRLP4 152
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+2
+ADDRLP4 152
+INDIRU1
+ASGNU1
+ADDRLP4 160
+CNSTF4 1132396544
+ADDRFP4 36
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 164
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 160
+INDIRF4
+ADDRLP4 164
+INDIRF4
+LTF4 $647
+ADDRLP4 156
+ADDRLP4 160
+INDIRF4
+ADDRLP4 164
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $648
+JUMPV
+LABELV $647
+ADDRLP4 156
+ADDRLP4 160
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $648
+ADDRLP4 168
+ADDRLP4 156
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+3
+ADDRLP4 168
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20+3
+ADDRLP4 168
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+3
+ADDRLP4 168
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+3
+ADDRLP4 168
+INDIRU1
+ASGNU1
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0+24
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0+48
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+48+4
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0+72
+ADDRFP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+72+4
+ADDRFP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+24+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+72+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 96
+ARGP4
+ADDRGP4 DrawPoly
+CALLV
+pop
+LABELV $594
+endproc Draw4VertsPic 169 12
+export AddCharToScene
+proc AddCharToScene 188 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 32
+NEI4 $678
+ADDRGP4 $677
+JUMPV
+LABELV $678
+ADDRLP4 96
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 12
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 96
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 96+8
+ADDRLP4 0
+ASGNP4
+ADDRLP4 96+4
+CNSTI4 4
+ASGNI4
+ADDRLP4 96
+ADDRGP4 uis+13812
+INDIRI4
+ASGNI4
+ADDRLP4 120
+CNSTF4 1132396544
+ADDRFP4 12
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 124
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 120
+INDIRF4
+ADDRLP4 124
+INDIRF4
+LTF4 $691
+ADDRLP4 116
+ADDRLP4 120
+INDIRF4
+ADDRLP4 124
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $692
+JUMPV
+LABELV $691
+ADDRLP4 116
+ADDRLP4 120
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $692
+ADDRLP4 128
+ADDRLP4 116
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20
+ADDRLP4 128
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20
+ADDRLP4 128
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20
+ADDRLP4 128
+INDIRU1
+ASGNU1
+ADDRLP4 0+20
+ADDRLP4 128
+INDIRU1
+ASGNU1
+ADDRLP4 136
+CNSTF4 1132396544
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 136
+INDIRF4
+ADDRLP4 140
+INDIRF4
+LTF4 $705
+ADDRLP4 132
+ADDRLP4 136
+INDIRF4
+ADDRLP4 140
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $706
+JUMPV
+LABELV $705
+ADDRLP4 132
+ADDRLP4 136
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $706
+ADDRLP4 144
+ADDRLP4 132
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+1
+ADDRLP4 144
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20+1
+ADDRLP4 144
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+1
+ADDRLP4 144
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+1
+ADDRLP4 144
+INDIRU1
+ASGNU1
+ADDRLP4 152
+CNSTF4 1132396544
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 156
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 152
+INDIRF4
+ADDRLP4 156
+INDIRF4
+LTF4 $719
+ADDRLP4 148
+ADDRLP4 152
+INDIRF4
+ADDRLP4 156
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $720
+JUMPV
+LABELV $719
+ADDRLP4 148
+ADDRLP4 152
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $720
+ADDRLP4 160
+ADDRLP4 148
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+2
+ADDRLP4 160
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20+2
+ADDRLP4 160
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+2
+ADDRLP4 160
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+2
+ADDRLP4 160
+INDIRU1
+ASGNU1
+ADDRLP4 168
+CNSTF4 1132396544
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 172
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 168
+INDIRF4
+ADDRLP4 172
+INDIRF4
+LTF4 $733
+ADDRLP4 164
+ADDRLP4 168
+INDIRF4
+ADDRLP4 172
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $734
+JUMPV
+LABELV $733
+ADDRLP4 164
+ADDRLP4 168
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $734
+ADDRLP4 176
+ADDRLP4 164
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+72+20+3
+ADDRLP4 176
+INDIRU1
+ASGNU1
+ADDRLP4 0+48+20+3
+ADDRLP4 176
+INDIRU1
+ASGNU1
+ADDRLP4 0+24+20+3
+ADDRLP4 176
+INDIRU1
+ASGNU1
+ADDRLP4 0+20+3
+ADDRLP4 176
+INDIRU1
+ASGNU1
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0+24
+ADDRFP4 0
+INDIRF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48
+ADDRFP4 0
+INDIRF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDF4
+ADDRFP4 20
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 180
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+48+4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 180
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ADDRFP4 20
+INDIRP4
+ADDRLP4 180
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72
+ADDRFP4 0
+INDIRF4
+ADDRFP4 20
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72+4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 108
+ADDRFP4 8
+INDIRI4
+CNSTI4 4
+RSHI4
+ASGNI4
+ADDRLP4 112
+ADDRFP4 8
+INDIRI4
+CNSTI4 15
+BANDI4
+ASGNI4
+ADDRLP4 0+12
+CNSTF4 1031798784
+ADDRLP4 112
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 0+12+4
+CNSTF4 1031798784
+ADDRLP4 108
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 0+24+12
+CNSTF4 1031798784
+ADDRLP4 112
+INDIRI4
+CNSTI4 1
+ADDI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 0+24+12+4
+CNSTF4 1031798784
+ADDRLP4 108
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 0+48+12
+CNSTF4 1031798784
+ADDRLP4 112
+INDIRI4
+CNSTI4 1
+ADDI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 0+48+12+4
+CNSTF4 1031798784
+ADDRLP4 108
+INDIRI4
+CNSTI4 1
+ADDI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 0+72+12
+CNSTF4 1031798784
+ADDRLP4 112
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 0+72+12+4
+CNSTF4 1031798784
+ADDRLP4 108
+INDIRI4
+CNSTI4 1
+ADDI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRLP4 96+4
+INDIRI4
+ARGI4
+ADDRLP4 96+8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+LABELV $677
+endproc AddCharToScene 188 12
+export colorAndPosinc
+proc colorAndPosinc 16 12
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_IsColorString
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $766
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $768
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+ARGP4
+CNSTU4 12
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $768
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $766
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $765
+endproc colorAndPosinc 16 12
+export DrawTurnableStringFC
+proc DrawTurnableStringFC 80 24
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 20
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 28
+ADDRFP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 initrefdef
+INDIRI4
+CNSTI4 0
+NEI4 $771
+ADDRGP4 Initrefdef2D
+CALLV
+pop
+LABELV $771
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 40
+ADDRLP4 44
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 trap_R_ClearScene
+CALLV
+pop
+ADDRFP4 20
+CNSTF4 1016003125
+ADDRFP4 20
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 1056964608
+ADDRLP4 48
+INDIRF4
+ADDRFP4 16
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 1056964608
+ADDRLP4 52
+INDIRF4
+NEGF4
+ADDRFP4 16
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRLP4 56
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 56
+INDIRF4
+ADDRFP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 60
+INDIRF4
+ADDRFP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 64
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 1
+EQI4 $777
+ADDRLP4 64
+INDIRI4
+CNSTI4 2
+EQI4 $785
+ADDRLP4 64
+INDIRI4
+CNSTI4 3
+EQI4 $794
+ADDRGP4 $775
+JUMPV
+LABELV $775
+LABELV $777
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $781
+JUMPV
+LABELV $778
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 colorAndPosinc
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $782
+ADDRLP4 72
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 AddCharToScene
+CALLV
+pop
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $782
+LABELV $779
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $781
+ADDRLP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+LTI4 $778
+ADDRGP4 $776
+JUMPV
+LABELV $785
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $789
+JUMPV
+LABELV $786
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 colorAndPosinc
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $790
+ADDRLP4 72
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 76
+CNSTF4 1056964608
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+SUBF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 AddCharToScene
+CALLV
+pop
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $790
+LABELV $787
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $789
+ADDRLP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+LTI4 $786
+ADDRGP4 $776
+JUMPV
+LABELV $794
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $798
+JUMPV
+LABELV $795
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 colorAndPosinc
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $799
+ADDRLP4 72
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 76
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+SUBF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 AddCharToScene
+CALLV
+pop
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $799
+LABELV $796
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $798
+ADDRLP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+LTI4 $795
+LABELV $776
+ADDRGP4 refdef2D
+ARGP4
+ADDRGP4 trap_R_RenderScene
+CALLV
+pop
+LABELV $770
+endproc DrawTurnableStringFC 80 24
+export DrawTurnableString
+proc DrawTurnableString 0 32
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 24
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 DrawTurnableStringFC
+CALLV
+pop
+LABELV $803
+endproc DrawTurnableString 0 32
+proc DrawCharWithCutFrame 112 36
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 20
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 24
+ADDRFP4 24
+INDIRF4
+ASGNF4
+ADDRFP4 28
+ADDRFP4 28
+INDIRF4
+ASGNF4
+ADDRFP4 32
+ADDRFP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 40
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ADDRFP4 28
+INDIRF4
+GTF4 $809
+ADDRLP4 44
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 44
+INDIRF4
+ADDRFP4 32
+INDIRF4
+GTF4 $809
+ADDRLP4 40
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ADDRFP4 20
+INDIRF4
+LTF4 $809
+ADDRLP4 44
+INDIRF4
+ADDRFP4 16
+INDIRF4
+ADDF4
+ADDRFP4 24
+INDIRF4
+GEF4 $805
+LABELV $809
+ADDRGP4 $804
+JUMPV
+LABELV $805
+ADDRFP4 20
+INDIRF4
+ADDRFP4 0
+INDIRF4
+LEF4 $811
+ADDRLP4 48
+ADDRFP4 20
+INDIRF4
+ADDRFP4 0
+INDIRF4
+SUBF4
+ADDRFP4 12
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 $812
+JUMPV
+LABELV $811
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+LABELV $812
+ADDRLP4 0
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRFP4 28
+INDIRF4
+ADDRFP4 0
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+GEF4 $814
+ADDRLP4 64
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 52
+ADDRFP4 0
+INDIRF4
+ADDRLP4 64
+INDIRF4
+ADDF4
+ADDRFP4 28
+INDIRF4
+SUBF4
+ADDRLP4 64
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 $815
+JUMPV
+LABELV $814
+ADDRLP4 52
+CNSTF4 0
+ASGNF4
+LABELV $815
+ADDRLP4 8
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRFP4 24
+INDIRF4
+ADDRFP4 4
+INDIRF4
+LEF4 $817
+ADDRLP4 56
+ADDRFP4 24
+INDIRF4
+ADDRFP4 4
+INDIRF4
+SUBF4
+ADDRFP4 16
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 $818
+JUMPV
+LABELV $817
+ADDRLP4 56
+CNSTF4 0
+ASGNF4
+LABELV $818
+ADDRLP4 4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRFP4 32
+INDIRF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 16
+INDIRF4
+ADDF4
+GEF4 $820
+ADDRLP4 68
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 60
+ADDRFP4 4
+INDIRF4
+ADDRLP4 68
+INDIRF4
+ADDF4
+ADDRFP4 32
+INDIRF4
+SUBF4
+ADDRLP4 68
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 $821
+JUMPV
+LABELV $820
+ADDRLP4 60
+CNSTF4 0
+ASGNF4
+LABELV $821
+ADDRLP4 12
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 72
+ADDRFP4 8
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+ADDRLP4 72
+INDIRI4
+CNSTI4 4
+RSHI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 72
+INDIRI4
+CNSTI4 15
+BANDI4
+ASGNI4
+ADDRLP4 76
+CNSTF4 1031798784
+ASGNF4
+ADDRLP4 24
+ADDRLP4 76
+INDIRF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 76
+INDIRF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 88
+CNSTI4 1
+ASGNI4
+ADDRLP4 32
+ADDRLP4 76
+INDIRF4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 88
+INDIRI4
+ADDI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 76
+INDIRF4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 88
+INDIRI4
+ADDI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 24
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 32
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRFP4 16
+ARGP4
+ADDRGP4 UI_AdjustFrom640
+CALLV
+pop
+ADDRLP4 96
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 96
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 104
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 104
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 108
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+MULF4
+ARGF4
+ADDRLP4 104
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+MULF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRGP4 uis+13812
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $804
+endproc DrawCharWithCutFrame 112 36
+export DrawStringWithCutFrameFC
+proc DrawStringWithCutFrameFC 36 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 20
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 24
+ADDRFP4 24
+INDIRF4
+ASGNF4
+ADDRFP4 28
+ADDRFP4 28
+INDIRF4
+ASGNF4
+ADDRFP4 32
+ADDRFP4 32
+INDIRF4
+ASGNF4
+ADDRFP4 36
+ADDRFP4 36
+INDIRF4
+ASGNF4
+ADDRFP4 40
+ADDRFP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $824
+ADDRGP4 $823
+JUMPV
+LABELV $824
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 28
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $829
+JUMPV
+LABELV $826
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_IsColorString
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $830
+ADDRFP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $832
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 12+12
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $832
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $827
+JUMPV
+LABELV $830
+ADDRFP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 24
+INDIRF4
+ARGF4
+ADDRFP4 28
+INDIRF4
+ARGF4
+ADDRFP4 32
+INDIRF4
+ARGF4
+ADDRFP4 36
+INDIRF4
+ARGF4
+ADDRGP4 DrawCharWithCutFrame
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRFP4 16
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $827
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $829
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $826
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $823
+endproc DrawStringWithCutFrameFC 36 36
+export DrawStringWithCutFrame
+proc DrawStringWithCutFrame 0 44
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 24
+INDIRF4
+ARGF4
+ADDRFP4 28
+INDIRF4
+ARGF4
+ADDRFP4 32
+INDIRF4
+ARGF4
+ADDRFP4 36
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 DrawStringWithCutFrameFC
+CALLV
+pop
+LABELV $835
+endproc DrawStringWithCutFrame 0 44
+bss
+export refdef2D
+align 4
+LABELV refdef2D
+skip 368
+import UI_HelpMenu_Cache
+import UI_HelpMenu_f
+import UI_HelpMenu
+import UI_InitGameinfo
+import UI_GetNumBots
+import UI_GetBotInfoByNumber
+import UI_GetNumArenas
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_VoiceIngame
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_GetVoiceGainClient
+import trap_GetVoiceMuteAll
+import trap_GetVoiceMuteClient
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_CIN_SetExtents
+import trap_CIN_StopCinematic
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_PlayCinematic
+import trap_RealTime
+import trap_S_StartBackgroundTrack
+import trap_S_StopBackgroundTrack
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_SaveCachedServers
+import trap_LAN_LoadCachedServers
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPics
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Generation
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import BotListCompare
+import uis
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString2
+import UI_AutoWrappedString_LineCount
+import UI_DrawString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawIngameBG
+import UI_DrawStringNS
+import UI_ModelIcon
+import UI_DrawHandlePic1024
+import UI_AdjustFrom1024
+import UI_StopMusic
+import UI_StartCreditMusic
+import UI_StartMusic
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_ClearModelCache
+import UI_PrecacheClientModelname
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import UI_SpecifyPasswordMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import Demos_Cache
+import UI_DemosMenu
+import SetDefaultBinds_onUnusedKeys
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import SetupDefaultMenu_Cache
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import Music_NextTrack
+import Music_TriggerRestart
+import Music_Check
+import MusicMenu_Cache
+import MusicMenu_Open
+import MusicMenu_Shutdown
+import MusicMenu_Init
+import UI_CallVoteMenu
+import UI_InGameMenu
+import InGame_Cache
+import UI_SecretMenu
+import UI_InitBigCredits
+import UI_BigCredits_Cache
+import UI_CreditMenu
+import ExitMenu_Cache
+import ExitMenu_Init
+import UI_MainMenu
+import MainMenu_Cache
+import UI_UpdateCvars
+import UI_RegisterCvars
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import listbar_bluecolor
+import text_color_bluehighlight
+import text_color_bluenormal
+import text_color_ighighlight
+import text_color_ignormal
+import listbar_igcolor
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_lightOrange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_click_sound
+import menu_switch_sound
+import menu_move_sound
+import ScrollList_Key
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import wop_AutoBindUnusedKeys
+import wop_AutoswitchSongByNextMap
+import con_notifytime
+import s_wop_restarted
+import syc_logo
+import spraycolor
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_createGametype
+import ui_browserHidePrivate
+import ui_browserOnlyHumans
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import convertGTStringToGTNumber
+import BoxTraceBox
+import Com_Printf
+import Com_Error
+import StringDump_GetNext
+import StringDump_Push
+import Info_DictWrite
+import Info_DictRemove
+import Info_DictSet
+import Info_DictValue
+import Info_DictParse
+import Info_DictInit
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_SkipBracedView
+import SkipBracedSection
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ViewCopy
+import COM_ViewEquals
+import COM_ParseView
+import COM_ParseExt
+import COM_Parse
+import Com_ParseLine
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisScale
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotateTMatrix
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import spraycolors
+import g_color_table
+import Q_IsColorString
+import colorDkOrange
+import colorDkLilac
+import colorDkRed
+import colorDkBlue
+import colorDkGreen
+import colorTBlack66
+import colorTBlack33
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+import demo_protocols
@@ -86,6 +86,8 @@ typedef struct aas_entity_s {
 	aas_link_t *areas;
 	// links into the BSP leaves
 	bsp_link_t *leaves;
+	// got a state since it was last unlinked, so it may be kept as is
+	qboolean hasstate;
 } aas_entity_t;
 
 typedef struct aas_settings_s {
@@ -134,6 +136,7 @@ typedef struct aas_settings_s {
 // routing cache
 typedef struct aas_routingcache_s {
 	byte type;			   // portal or area cache
+	byte sysmemory;		   // allocated with malloc by a job worker
 	float time;			   // last time accessed or updated
 	int size;			   // size of the routing cache
 	int cluster;		   // cluster the cache is for
@@ -173,6 +176,16 @@ typedef struct aas_reversedreachability_s {
 	aas_reversedlink_t *first;
 } aas_reversedreachability_t;
 
+// the area settings the routing reads, packed together
+typedef struct aas_routingarea_s {
+	int cluster;			// cluster the area belongs to, if negative it's a portal
+	int clusterareanum;		// number of the area in the cluster
+	int firstreachablearea; // first reachable area in the reachable area index
+	int travelflags;		// contents travel flags, TFL_INVALID while the area is disabled
+	unsigned short numreachableareas;
+	unsigned short presencetype;
+} aas_routingarea_t;
+
 // areas a reachability goes through
 typedef struct aas_reachabilityareas_s {
 	int firstarea, numareas;
@@ -189,6 +202,9 @@ typedef struct aas_s {
 	// name of the aas file
 	char filename[MAX_QPATH];
 	char mapname[MAX_QPATH];
+	// the aas file mapped read only, the geometry lumps point into it
+	const byte *mappedfile;
+	int64_t mappedfilesize;
 	// bounding boxes
 	int numbboxes;
 	aas_bbox_t *bboxes;
@@ -222,6 +238,12 @@ typedef struct aas_s {
 	// nodes of the bsp tree
 	int numnodes;
 	aas_node_t *nodes;
+	// uniform grid over the nodes, every cell stores the node the point
+	// lookups in it start at, or minus the area when it's inside one area
+	int *areagrid;
+	int areagridsize[3];
+	vec3_t areagridorigin;
+	float areagridscale; // 1 / cell size
 	// cluster portals
 	int numportals;
 	aas_portal_t *portals;
@@ -250,6 +272,12 @@ typedef struct aas_s {
 	int travelflagfortype[MAX_TRAVELTYPES];
 	// travel flags for each area based on contents
 	int *areacontentstravelflags;
+	// copies of the area and reachability fields the routing reads, the
+	// reachability fields each in their own array
+	aas_routingarea_t *routingareas;
+	int *reachareanum;
+	int *reachtravelflags;
+	unsigned short *reachtraveltime;
 	// routing update
 	aas_routingupdate_t *areaupdate;
 	aas_routingupdate_t *portalupdate;
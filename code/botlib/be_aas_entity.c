@@ -69,6 +69,7 @@ int AAS_UpdateEntity(int entnum, bot_entitystate_t *state) {
 		ent->areas = NULL;
 
 		ent->leaves = NULL;
+		ent->hasstate = qfalse;
 		return BLERR_NOERROR;
 	}
 
@@ -93,6 +94,7 @@ int AAS_UpdateEntity(int entnum, bot_entitystate_t *state) {
 	ent->i.number = entnum;
 	// updated so set valid flag
 	ent->i.valid = qtrue;
+	ent->hasstate = qtrue;
 	// link everything the first frame
 	if (aasworld.numframes == 1)
 		relink = qtrue;
@@ -142,6 +144,75 @@ int AAS_UpdateEntity(int entnum, bot_entitystate_t *state) {
 	return BLERR_NOERROR;
 }
 
+/*
+=================
+AAS_KeepEntity
+
+Marks an entity that didn't change as updated this frame, without
+touching its links
+=================
+*/
+static void AAS_KeepEntity(aas_entity_t *ent) {
+	ent->i.update_time = AAS_Time() - ent->i.ltime;
+	ent->i.ltime = AAS_Time();
+	VectorCopy(ent->i.origin, ent->i.lastvisorigin);
+	ent->i.valid = qtrue;
+}
+
+/*
+=================
+AAS_UpdateEntities
+
+Updates all entities for a frame. The entities in changed get their
+state from states[entnum], the other ones with their bit set in live
+keep the state they had, and all remaining entities are unlinked.
+Returns BLERR_ENTITYSTATEMISSING if a live entity never got a state,
+the caller should send all of them again.
+=================
+*/
+int AAS_UpdateEntities(int numEntities, const byte *live, int numChanged, const int *changed,
+					   bot_entitystate_t *states) {
+	int i, entnum, errnum;
+	aas_entity_t *ent;
+
+	if (!aasworld.loaded) {
+		botimport.Print(PRT_MESSAGE, "AAS_UpdateEntities: not loaded\n");
+		return BLERR_NOAASFILE;
+	}
+
+	for (i = 0; i < numChanged; i++) {
+		entnum = changed[i];
+		if (entnum < 0 || entnum >= numEntities || entnum >= aasworld.maxentities) {
+			botimport.Print(PRT_ERROR, "AAS_UpdateEntities: invalid entity number %d\n", entnum);
+			return BLERR_INVALIDENTITYNUMBER;
+		}
+		AAS_UpdateEntity(entnum, &states[entnum]);
+	}
+
+	errnum = BLERR_NOERROR;
+	numEntities = MIN(numEntities, aasworld.maxentities);
+
+	for (i = 0; i < numEntities; i++) {
+		ent = &aasworld.entities[i];
+
+		if (!(live[i >> 3] & (1 << (i & 7)))) {
+			if (ent->areas || ent->leaves || ent->hasstate)
+				AAS_UpdateEntity(i, NULL);
+			continue;
+		}
+
+		if (ent->i.valid)
+			continue;
+
+		if (ent->hasstate)
+			AAS_KeepEntity(ent);
+		else
+			errnum = BLERR_ENTITYSTATEMISSING;
+	}
+
+	return errnum;
+}
+
 void AAS_EntityInfo(int entnum, aas_entityinfo_t *info) {
 	if (!aasworld.initialized) {
 		botimport.Print(PRT_FATAL, "AAS_EntityInfo: aasworld not initialized\n");
@@ -247,6 +318,7 @@ void AAS_ResetEntityLinks(void) {
 	for (i = 0; i < aasworld.maxentities; i++) {
 		aasworld.entities[i].areas = NULL;
 		aasworld.entities[i].leaves = NULL;
+		aasworld.entities[i].hasstate = qfalse;
 	}
 }
 
@@ -269,6 +341,7 @@ void AAS_UnlinkInvalidEntities(void) {
 			ent->areas = NULL;
 			AAS_UnlinkFromBSPLeaves(ent->leaves);
 			ent->leaves = NULL;
+			ent->hasstate = qfalse;
 		}
 	}
 }
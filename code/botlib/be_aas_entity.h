@@ -38,6 +38,9 @@ void AAS_UnlinkInvalidEntities(void);
 void AAS_ResetEntityLinks(void);
 // updates an entity
 int AAS_UpdateEntity(int ent, bot_entitystate_t *state);
+// updates the changed entities and keeps the other live ones
+int AAS_UpdateEntities(int numEntities, const byte *live, int numChanged, const int *changed,
+					   bot_entitystate_t *states);
 // gives the entity data used for collision detection
 void AAS_EntityBSPData(int entnum, bsp_entdata_t *entdata);
 #endif // AASINTERN
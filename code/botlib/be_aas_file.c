@@ -30,6 +30,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
  *****************************************************************************/
 
 #include "../qcommon/q_shared.h"
+#include "../qcommon/qcommon.h"
 #include "l_memory.h"
 #include "l_script.h"
 #include "l_precomp.h"
@@ -150,72 +151,113 @@ void AAS_SwapAASData(void) {
 	}
 }
 //===========================================================================
+// whether the memory is in the mapped aas file
+
+//===========================================================================
+static qboolean AAS_InMappedAASFile(const void *ptr) {
+	return aasworld.mappedfile && (const byte *)ptr >= aasworld.mappedfile &&
+		   (const byte *)ptr < aasworld.mappedfile + aasworld.mappedfilesize;
+}
+//===========================================================================
+// free a lump unless it points into the mapped aas file
+
+//===========================================================================
+static void AAS_FreeAASLump(void *lump) {
+	if (lump && !AAS_InMappedAASFile(lump))
+		FreeMemory(lump);
+}
+//===========================================================================
 // dump the current loaded aas file
 
 //===========================================================================
 void AAS_DumpAASData(void) {
 	aasworld.numbboxes = 0;
-	if (aasworld.bboxes)
-		FreeMemory(aasworld.bboxes);
+	AAS_FreeAASLump(aasworld.bboxes);
 	aasworld.bboxes = NULL;
 	aasworld.numvertexes = 0;
-	if (aasworld.vertexes)
-		FreeMemory(aasworld.vertexes);
+	AAS_FreeAASLump(aasworld.vertexes);
 	aasworld.vertexes = NULL;
 	aasworld.numplanes = 0;
-	if (aasworld.planes)
-		FreeMemory(aasworld.planes);
+	AAS_FreeAASLump(aasworld.planes);
 	aasworld.planes = NULL;
 	aasworld.numedges = 0;
-	if (aasworld.edges)
-		FreeMemory(aasworld.edges);
+	AAS_FreeAASLump(aasworld.edges);
 	aasworld.edges = NULL;
 	aasworld.edgeindexsize = 0;
-	if (aasworld.edgeindex)
-		FreeMemory(aasworld.edgeindex);
+	AAS_FreeAASLump(aasworld.edgeindex);
 	aasworld.edgeindex = NULL;
 	aasworld.numfaces = 0;
-	if (aasworld.faces)
-		FreeMemory(aasworld.faces);
+	AAS_FreeAASLump(aasworld.faces);
 	aasworld.faces = NULL;
 	aasworld.faceindexsize = 0;
-	if (aasworld.faceindex)
-		FreeMemory(aasworld.faceindex);
+	AAS_FreeAASLump(aasworld.faceindex);
 	aasworld.faceindex = NULL;
 	aasworld.numareas = 0;
-	if (aasworld.areas)
-		FreeMemory(aasworld.areas);
+	AAS_FreeAASLump(aasworld.areas);
 	aasworld.areas = NULL;
 	aasworld.numareasettings = 0;
-	if (aasworld.areasettings)
-		FreeMemory(aasworld.areasettings);
+	AAS_FreeAASLump(aasworld.areasettings);
 	aasworld.areasettings = NULL;
 	aasworld.reachabilitysize = 0;
-	if (aasworld.reachability)
-		FreeMemory(aasworld.reachability);
+	AAS_FreeAASLump(aasworld.reachability);
 	aasworld.reachability = NULL;
 	aasworld.numnodes = 0;
-	if (aasworld.nodes)
-		FreeMemory(aasworld.nodes);
+	AAS_FreeAASLump(aasworld.nodes);
 	aasworld.nodes = NULL;
 	aasworld.numportals = 0;
-	if (aasworld.portals)
-		FreeMemory(aasworld.portals);
+	AAS_FreeAASLump(aasworld.portals);
 	aasworld.portals = NULL;
 	aasworld.numportals = 0;
-	if (aasworld.portalindex)
-		FreeMemory(aasworld.portalindex);
+	AAS_FreeAASLump(aasworld.portalindex);
 	aasworld.portalindex = NULL;
 	aasworld.portalindexsize = 0;
-	if (aasworld.clusters)
-		FreeMemory(aasworld.clusters);
+	AAS_FreeAASLump(aasworld.clusters);
 	aasworld.clusters = NULL;
 	aasworld.numclusters = 0;
 
+	if (aasworld.mappedfile)
+		FS_UnmapFile(aasworld.mappedfile, aasworld.mappedfilesize);
+	aasworld.mappedfile = NULL;
+	aasworld.mappedfilesize = 0;
+
 	aasworld.loaded = qfalse;
 	aasworld.initialized = qfalse;
 	aasworld.savefile = qfalse;
 }
+//===========================================================================
+// copy a lump out of the mapped aas file
+
+//===========================================================================
+static void *AAS_UnshareAASLump(void *lump, int length) {
+	void *buf;
+
+	if (!lump || !AAS_InMappedAASFile(lump))
+		return lump;
+	buf = GetClearedHunkMemory(length + 1);
+	Com_Memcpy(buf, lump, length);
+	return buf;
+}
+//===========================================================================
+// give the lumps that point into the mapped aas file their own copies and
+// drop the mapping, needed before the aas data is modified or written
+
+//===========================================================================
+void AAS_UnshareAASData(void) {
+	if (!aasworld.mappedfile)
+		return;
+	aasworld.vertexes = AAS_UnshareAASLump(aasworld.vertexes, aasworld.numvertexes * sizeof(aas_vertex_t));
+	aasworld.planes = AAS_UnshareAASLump(aasworld.planes, aasworld.numplanes * sizeof(aas_plane_t));
+	aasworld.edges = AAS_UnshareAASLump(aasworld.edges, aasworld.numedges * sizeof(aas_edge_t));
+	aasworld.edgeindex = AAS_UnshareAASLump(aasworld.edgeindex, aasworld.edgeindexsize * sizeof(aas_edgeindex_t));
+	aasworld.faces = AAS_UnshareAASLump(aasworld.faces, aasworld.numfaces * sizeof(aas_face_t));
+	aasworld.faceindex = AAS_UnshareAASLump(aasworld.faceindex, aasworld.faceindexsize * sizeof(aas_faceindex_t));
+	aasworld.areas = AAS_UnshareAASLump(aasworld.areas, aasworld.numareas * sizeof(aas_area_t));
+	aasworld.nodes = AAS_UnshareAASLump(aasworld.nodes, aasworld.numnodes * sizeof(aas_node_t));
+
+	FS_UnmapFile(aasworld.mappedfile, aasworld.mappedfilesize);
+	aasworld.mappedfile = NULL;
+	aasworld.mappedfilesize = 0;
+}
 
 #ifdef AASFILEDEBUG
 void AAS_FileInfo(void) {
@@ -269,8 +311,15 @@ char *AAS_LoadAASLump(fileHandle_t fp, int offset, int length, int *lastoffset,
 		// just alloc a dummy
 		return (char *)GetClearedHunkMemory(size + 1);
 	}
+	// the lump has to be inside the file
+	if (aasworld.mappedfile && (offset < 0 || length < 0 || offset > aasworld.mappedfilesize - length)) {
+		AAS_Error("aas lump outside the file\n");
+		AAS_DumpAASData();
+		botimport.FS_FCloseFile(fp);
+		return NULL;
+	}
 	// seek to the data
-	if (offset != *lastoffset) {
+	if (!aasworld.mappedfile && offset != *lastoffset) {
 		botimport.Print(PRT_WARNING, "AAS file not sequentially read\n");
 		if (botimport.FS_Seek(fp, offset, FS_SEEK_SET)) {
 			AAS_Error("can't seek to aas lump\n");
@@ -281,6 +330,11 @@ char *AAS_LoadAASLump(fileHandle_t fp, int offset, int length, int *lastoffset,
 	}
 	// allocate memory
 	buf = (char *)GetClearedHunkMemory(length + 1);
+	// copy the data out of the mapped file
+	if (aasworld.mappedfile) {
+		Com_Memcpy(buf, aasworld.mappedfile + offset, length);
+		return buf;
+	}
 	// read the data
 	if (length) {
 		botimport.FS_Read(buf, length, fp);
@@ -288,6 +342,17 @@ char *AAS_LoadAASLump(fileHandle_t fp, int offset, int length, int *lastoffset,
 	}
 	return buf;
 }
+//===========================================================================
+// point a lump that is never modified into the mapped aas file, so that all
+// servers running the map share one copy, or else load it like any other
+
+//===========================================================================
+static char *AAS_LoadSharedAASLump(fileHandle_t fp, int offset, int length, int *lastoffset, int size) {
+	if (aasworld.mappedfile && length > 0 && offset >= 0 && !(offset & 3) &&
+		offset <= aasworld.mappedfilesize - length)
+		return (char *)aasworld.mappedfile + offset;
+	return AAS_LoadAASLump(fp, offset, length, lastoffset, size);
+}
 
 void AAS_DData(unsigned char *data, int size) {
 	int i;
@@ -343,6 +408,10 @@ int AAS_LoadAASFile(char *filename) {
 		botimport.FS_FCloseFile(fp);
 		return BLERR_WRONGAASFILEVERSION;
 	}
+#ifdef Q3_LITTLE_ENDIAN
+	// lumps can only be used in place when they don't need swapping
+	aasworld.mappedfile = FS_MapFile(filename, &aasworld.mappedfilesize);
+#endif
 	// load the lumps:
 	// bounding boxes
 	offset = LittleLong(header.lumps[AASLUMP_BBOXES].fileofs);
@@ -354,49 +423,49 @@ int AAS_LoadAASFile(char *filename) {
 	// vertexes
 	offset = LittleLong(header.lumps[AASLUMP_VERTEXES].fileofs);
 	length = LittleLong(header.lumps[AASLUMP_VERTEXES].filelen);
-	aasworld.vertexes = (aas_vertex_t *)AAS_LoadAASLump(fp, offset, length, &lastoffset, sizeof(aas_vertex_t));
+	aasworld.vertexes = (aas_vertex_t *)AAS_LoadSharedAASLump(fp, offset, length, &lastoffset, sizeof(aas_vertex_t));
 	aasworld.numvertexes = length / sizeof(aas_vertex_t);
 	if (aasworld.numvertexes && !aasworld.vertexes)
 		return BLERR_CANNOTREADAASLUMP;
 	// planes
 	offset = LittleLong(header.lumps[AASLUMP_PLANES].fileofs);
 	length = LittleLong(header.lumps[AASLUMP_PLANES].filelen);
-	aasworld.planes = (aas_plane_t *)AAS_LoadAASLump(fp, offset, length, &lastoffset, sizeof(aas_plane_t));
+	aasworld.planes = (aas_plane_t *)AAS_LoadSharedAASLump(fp, offset, length, &lastoffset, sizeof(aas_plane_t));
 	aasworld.numplanes = length / sizeof(aas_plane_t);
 	if (aasworld.numplanes && !aasworld.planes)
 		return BLERR_CANNOTREADAASLUMP;
 	// edges
 	offset = LittleLong(header.lumps[AASLUMP_EDGES].fileofs);
 	length = LittleLong(header.lumps[AASLUMP_EDGES].filelen);
-	aasworld.edges = (aas_edge_t *)AAS_LoadAASLump(fp, offset, length, &lastoffset, sizeof(aas_edge_t));
+	aasworld.edges = (aas_edge_t *)AAS_LoadSharedAASLump(fp, offset, length, &lastoffset, sizeof(aas_edge_t));
 	aasworld.numedges = length / sizeof(aas_edge_t);
 	if (aasworld.numedges && !aasworld.edges)
 		return BLERR_CANNOTREADAASLUMP;
 	// edgeindex
 	offset = LittleLong(header.lumps[AASLUMP_EDGEINDEX].fileofs);
 	length = LittleLong(header.lumps[AASLUMP_EDGEINDEX].filelen);
-	aasworld.edgeindex = (aas_edgeindex_t *)AAS_LoadAASLump(fp, offset, length, &lastoffset, sizeof(aas_edgeindex_t));
+	aasworld.edgeindex = (aas_edgeindex_t *)AAS_LoadSharedAASLump(fp, offset, length, &lastoffset, sizeof(aas_edgeindex_t));
 	aasworld.edgeindexsize = length / sizeof(aas_edgeindex_t);
 	if (aasworld.edgeindexsize && !aasworld.edgeindex)
 		return BLERR_CANNOTREADAASLUMP;
 	// faces
 	offset = LittleLong(header.lumps[AASLUMP_FACES].fileofs);
 	length = LittleLong(header.lumps[AASLUMP_FACES].filelen);
-	aasworld.faces = (aas_face_t *)AAS_LoadAASLump(fp, offset, length, &lastoffset, sizeof(aas_face_t));
+	aasworld.faces = (aas_face_t *)AAS_LoadSharedAASLump(fp, offset, length, &lastoffset, sizeof(aas_face_t));
 	aasworld.numfaces = length / sizeof(aas_face_t);
 	if (aasworld.numfaces && !aasworld.faces)
 		return BLERR_CANNOTREADAASLUMP;
 	// faceindex
 	offset = LittleLong(header.lumps[AASLUMP_FACEINDEX].fileofs);
 	length = LittleLong(header.lumps[AASLUMP_FACEINDEX].filelen);
-	aasworld.faceindex = (aas_faceindex_t *)AAS_LoadAASLump(fp, offset, length, &lastoffset, sizeof(aas_faceindex_t));
+	aasworld.faceindex = (aas_faceindex_t *)AAS_LoadSharedAASLump(fp, offset, length, &lastoffset, sizeof(aas_faceindex_t));
 	aasworld.faceindexsize = length / sizeof(aas_faceindex_t);
 	if (aasworld.faceindexsize && !aasworld.faceindex)
 		return BLERR_CANNOTREADAASLUMP;
 	// convex areas
 	offset = LittleLong(header.lumps[AASLUMP_AREAS].fileofs);
 	length = LittleLong(header.lumps[AASLUMP_AREAS].filelen);
-	aasworld.areas = (aas_area_t *)AAS_LoadAASLump(fp, offset, length, &lastoffset, sizeof(aas_area_t));
+	aasworld.areas = (aas_area_t *)AAS_LoadSharedAASLump(fp, offset, length, &lastoffset, sizeof(aas_area_t));
 	aasworld.numareas = length / sizeof(aas_area_t);
 	if (aasworld.numareas && !aasworld.areas)
 		return BLERR_CANNOTREADAASLUMP;
@@ -419,7 +488,7 @@ int AAS_LoadAASFile(char *filename) {
 	// nodes
 	offset = LittleLong(header.lumps[AASLUMP_NODES].fileofs);
 	length = LittleLong(header.lumps[AASLUMP_NODES].filelen);
-	aasworld.nodes = (aas_node_t *)AAS_LoadAASLump(fp, offset, length, &lastoffset, sizeof(aas_node_t));
+	aasworld.nodes = (aas_node_t *)AAS_LoadSharedAASLump(fp, offset, length, &lastoffset, sizeof(aas_node_t));
 	aasworld.numnodes = length / sizeof(aas_node_t);
 	if (aasworld.numnodes && !aasworld.nodes)
 		return BLERR_CANNOTREADAASLUMP;
@@ -445,8 +514,9 @@ int AAS_LoadAASFile(char *filename) {
 	aasworld.numclusters = length / sizeof(aas_cluster_t);
 	if (aasworld.numclusters && !aasworld.clusters)
 		return BLERR_CANNOTREADAASLUMP;
-	// swap everything
-	AAS_SwapAASData();
+	// swap everything, the mapped file is only used when that does nothing
+	if (!aasworld.mappedfile)
+		AAS_SwapAASData();
 	// aas file is loaded
 	aasworld.loaded = qtrue;
 	// close the file
@@ -486,6 +556,8 @@ qboolean AAS_WriteAASFile(char *filename) {
 	fileHandle_t fp;
 
 	botimport.Print(PRT_MESSAGE, "writing %s\n", filename);
+	// the file is rewritten and the data swapped in place
+	AAS_UnshareAASData();
 	// swap the aas data
 	AAS_SwapAASData();
 	// initialize the file header
@@ -36,6 +36,8 @@ int AAS_LoadAASFile(char *filename);
 qboolean AAS_WriteAASFile(char *filename);
 // dumps the loaded AAS data
 void AAS_DumpAASData(void);
+// copies the lumps out of the mapped aas file before they are modified
+void AAS_UnshareAASData(void);
 // print AAS file information
 void AAS_FileInfo(void);
 #endif // AASINTERN
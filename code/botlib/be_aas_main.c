@@ -239,6 +239,8 @@ int AAS_StartFrame(float time) {
 	AAS_ContinueInit(time);
 
 	aasworld.frameroutingupdates = 0;
+	// the sync point of the routing cache, no route queries run here
+	AAS_RoutingFrame();
 
 	AAS_ClearShownPolygons();
 	AAS_ClearShownDebugLines();
@@ -365,6 +367,8 @@ int AAS_LoadMap(const char *mapname) {
 	}
 
 	AAS_InitSettings();
+	// initialize the point to area grid
+	AAS_InitAreaGrid();
 	// initialize the AAS link heap for the new map
 	AAS_InitAASLinkHeap();
 	// initialize the AAS linked entities for the new map
@@ -406,6 +410,8 @@ void AAS_Shutdown(void) {
 	AAS_FreeRoutingCaches();
 	// free aas link heap
 	AAS_FreeAASLinkHeap();
+	// free the point to area grid
+	AAS_FreeAreaGrid();
 	// free aas linked entities
 	AAS_FreeAASLinkedEntities();
 	// free the aas data
@@ -240,6 +240,8 @@ void AAS_Optimize(void) {
 	int i, sign;
 	optimized_t optimized;
 
+	// the optimized lumps replace the loaded ones
+	AAS_UnshareAASData();
 	AAS_OptimizeAlloc(&optimized);
 	for (i = 1; i < aasworld.numareas; i++) {
 		AAS_OptimizeArea(&optimized, i);
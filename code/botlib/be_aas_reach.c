@@ -78,6 +78,26 @@ static int reach_rocketjump;   // rocket jump
 static int reach_jumppad;	   // jump pads
 // if true grapple reachabilities are skipped
 static int calcgrapplereach;
+// areas sorted into a grid over their x-y bounds, the reachability calculation
+// only tests area pairs that are near enough to be connected
+#define REACH_GRIDCELLSIZE 256
+#define MAX_REACH_GRIDCELLS 65536
+static float reachgridmins[2];
+static float reachgridcellsize;
+static int reachgridsize[2];
+static int *reachgridcells; // first area index of every cell, one extra for the end
+static int *reachgridareas; // areas in the grid cells
+static int *reachareastamp; // last area the area was gathered for
+static int *reachnearbyareas;
+static int *reachweaponjumpareas;
+static int numreachweaponjumpareas;
+// start point of grapple and weapon jumps, the same for all destination areas
+static int reachstartareanum;
+static int reachstartsolid;
+static vec3_t reachstart;
+// reachability calculation statistics
+static int reachstarttime;
+static int reachpairs;
 // linked reachability
 typedef struct aas_lreachability_s {
 	int areanum;				   // number of the reachable area
@@ -3222,6 +3242,32 @@ static void AAS_Reachability_JumpPad(void) {
 	}
 }
 //===========================================================================
+// returns the point on the ground below the center of the given area to
+// start grapple and weapon jumps from, false if the trace started in solid
+
+//===========================================================================
+static int AAS_ReachabilityStartPoint(int areanum, vec3_t areastart) {
+	vec3_t start, end;
+	aas_trace_t trace;
+
+	// the trace only depends on the start area so it is done once per area
+	if (areanum != reachstartareanum) {
+		VectorCopy(aasworld.areas[areanum].center, start);
+		if (!AAS_PointAreaNum(start))
+			Log_Write("area %d center %f %f %f in solid?\r\n", areanum, start[0], start[1], start[2]);
+		VectorCopy(start, end);
+		end[2] -= 1000;
+		trace = AAS_TraceClientBBox(start, end, PRESENCE_CROUCH, -1);
+		reachstartsolid = trace.startsolid;
+		VectorCopy(trace.endpos, reachstart);
+		reachstartareanum = areanum;
+	}
+	if (reachstartsolid)
+		return qfalse;
+	VectorCopy(reachstart, areastart);
+	return qtrue;
+}
+//===========================================================================
 // never point at ground faces
 // always a higher and pretty far area
 
@@ -3256,14 +3302,8 @@ static int AAS_Reachability_Grapple(int area1num, int area2num) {
 	VectorCopy(aasworld.areas[area1num].center, start);
 	// if not a swim area
 	if (!AAS_AreaSwim(area1num)) {
-		if (!AAS_PointAreaNum(start))
-			Log_Write("area %d center %f %f %f in solid?\r\n", area1num, start[0], start[1], start[2]);
-		VectorCopy(start, end);
-		end[2] -= 1000;
-		trace = AAS_TraceClientBBox(start, end, PRESENCE_CROUCH, -1);
-		if (trace.startsolid)
+		if (!AAS_ReachabilityStartPoint(area1num, areastart))
 			return qfalse;
-		VectorCopy(trace.endpos, areastart);
 	} else {
 		if (!(AAS_PointContents(start) & (CONTENTS_LAVA | CONTENTS_SLIME | CONTENTS_WATER)))
 			return qfalse;
@@ -3445,10 +3485,9 @@ int AAS_Reachability_WeaponJump(int area1num, int area2num) {
 	aas_face_t *face2;
 	aas_area_t *area1, *area2;
 	aas_lreachability_t *lreach;
-	vec3_t areastart, facecenter, start, end, dir, cmdmove; // teststart;
+	vec3_t areastart, facecenter, dir, cmdmove; // teststart;
 	vec3_t velocity;
 	aas_clientmove_t move;
-	aas_trace_t trace;
 
 	visualize = qfalse;
 	//	if (area1num == 4436 && area2num == 4318)
@@ -3469,16 +3508,8 @@ int AAS_Reachability_WeaponJump(int area1num, int area2num) {
 	if (area2->maxs[2] < area1->mins[2])
 		return qfalse;
 
-	VectorCopy(aasworld.areas[area1num].center, start);
-	// if not a swim area
-	if (!AAS_PointAreaNum(start))
-		Log_Write("area %d center %f %f %f in solid?\r\n", area1num, start[0], start[1], start[2]);
-	VectorCopy(start, end);
-	end[2] -= 1000;
-	trace = AAS_TraceClientBBox(start, end, PRESENCE_CROUCH, -1);
-	if (trace.startsolid)
+	if (!AAS_ReachabilityStartPoint(area1num, areastart))
 		return qfalse;
-	VectorCopy(trace.endpos, areastart);
 
 	// areastart is now the start point
 
@@ -3759,6 +3790,147 @@ static void AAS_StoreReachability(void) {
 	}
 }
 //===========================================================================
+// sorts the areas into a grid over their x-y bounds and collects the weapon
+// jump areas
+
+//===========================================================================
+static void AAS_SetupReachabilityGrid(void) {
+	int i, j, n, x, y, mins[2], maxs[2], numcells;
+	vec3_t worldmins, worldmaxs;
+	aas_area_t *area;
+
+	ClearBounds(worldmins, worldmaxs);
+	for (i = 1; i < aasworld.numareas; i++) {
+		AddPointToBounds(aasworld.areas[i].mins, worldmins, worldmaxs);
+		AddPointToBounds(aasworld.areas[i].maxs, worldmins, worldmaxs);
+	}
+	reachgridcellsize = REACH_GRIDCELLSIZE;
+	while (1) {
+		for (i = 0; i < 2; i++) {
+			reachgridmins[i] = worldmins[i];
+			reachgridsize[i] = (int)((worldmaxs[i] - worldmins[i]) / reachgridcellsize) + 1;
+		}
+		if (reachgridsize[0] * reachgridsize[1] <= MAX_REACH_GRIDCELLS)
+			break;
+		reachgridcellsize *= 2;
+	}
+	numcells = reachgridsize[0] * reachgridsize[1];
+	reachgridcells = (int *)GetClearedMemory((numcells + 1) * sizeof(int));
+	// count the areas in every cell
+	for (i = 1; i < aasworld.numareas; i++) {
+		area = &aasworld.areas[i];
+		for (j = 0; j < 2; j++) {
+			mins[j] = (int)((area->mins[j] - reachgridmins[j]) / reachgridcellsize);
+			maxs[j] = (int)((area->maxs[j] - reachgridmins[j]) / reachgridcellsize);
+		}
+		for (y = mins[1]; y <= maxs[1]; y++) {
+			for (x = mins[0]; x <= maxs[0]; x++) {
+				reachgridcells[y * reachgridsize[0] + x + 1]++;
+			}
+		}
+	}
+	for (i = 0; i < numcells; i++) {
+		reachgridcells[i + 1] += reachgridcells[i];
+	}
+	reachgridareas = (int *)GetMemory(reachgridcells[numcells] * sizeof(int));
+	// fill in the areas, cell starts are advanced while filling and restored after
+	for (i = 1; i < aasworld.numareas; i++) {
+		area = &aasworld.areas[i];
+		for (j = 0; j < 2; j++) {
+			mins[j] = (int)((area->mins[j] - reachgridmins[j]) / reachgridcellsize);
+			maxs[j] = (int)((area->maxs[j] - reachgridmins[j]) / reachgridcellsize);
+		}
+		for (y = mins[1]; y <= maxs[1]; y++) {
+			for (x = mins[0]; x <= maxs[0]; x++) {
+				n = y * reachgridsize[0] + x;
+				reachgridareas[reachgridcells[n]++] = i;
+			}
+		}
+	}
+	for (i = numcells; i > 0; i--) {
+		reachgridcells[i] = reachgridcells[i - 1];
+	}
+	reachgridcells[0] = 0;
+
+	reachareastamp = (int *)GetClearedMemory(aasworld.numareas * sizeof(int));
+	reachnearbyareas = (int *)GetMemory(aasworld.numareas * sizeof(int));
+
+	reachweaponjumpareas = (int *)GetMemory(aasworld.numareas * sizeof(int));
+	numreachweaponjumpareas = 0;
+	for (i = 1; i < aasworld.numareas; i++) {
+		if (aasworld.areasettings[i].areaflags & AREA_WEAPONJUMP)
+			reachweaponjumpareas[numreachweaponjumpareas++] = i;
+	}
+}
+//===========================================================================
+
+//===========================================================================
+static void AAS_ShutdownReachabilityGrid(void) {
+	if (reachgridcells)
+		FreeMemory(reachgridcells);
+	reachgridcells = NULL;
+	if (reachgridareas)
+		FreeMemory(reachgridareas);
+	reachgridareas = NULL;
+	if (reachareastamp)
+		FreeMemory(reachareastamp);
+	reachareastamp = NULL;
+	if (reachnearbyareas)
+		FreeMemory(reachnearbyareas);
+	reachnearbyareas = NULL;
+	if (reachweaponjumpareas)
+		FreeMemory(reachweaponjumpareas);
+	reachweaponjumpareas = NULL;
+	numreachweaponjumpareas = 0;
+}
+//===========================================================================
+
+//===========================================================================
+static int AAS_CompareAreaNums(const void *a, const void *b) {
+	return *(const int *)a - *(const int *)b;
+}
+//===========================================================================
+// stores the areas whose x-y bounds are within the given distance of the
+// bounds of the given area in reachnearbyareas, sorted by area number
+
+//===========================================================================
+static int AAS_NearbyReachabilityAreas(int areanum, float dist) {
+	int i, j, k, x, y, mins[2], maxs[2], numareas;
+	aas_area_t *area, *area2;
+
+	area = &aasworld.areas[areanum];
+	for (i = 0; i < 2; i++) {
+		mins[i] = (int)((area->mins[i] - dist - reachgridmins[i]) / reachgridcellsize);
+		maxs[i] = (int)((area->maxs[i] + dist - reachgridmins[i]) / reachgridcellsize);
+		if (mins[i] < 0)
+			mins[i] = 0;
+		if (maxs[i] >= reachgridsize[i])
+			maxs[i] = reachgridsize[i] - 1;
+	}
+	numareas = 0;
+	for (y = mins[1]; y <= maxs[1]; y++) {
+		for (x = mins[0]; x <= maxs[0]; x++) {
+			k = y * reachgridsize[0] + x;
+			for (j = reachgridcells[k]; j < reachgridcells[k + 1]; j++) {
+				i = reachgridareas[j];
+				// areas spanning several cells are only tested once
+				if (reachareastamp[i] == areanum)
+					continue;
+				reachareastamp[i] = areanum;
+				area2 = &aasworld.areas[i];
+				if (area->mins[0] > area2->maxs[0] + dist || area->maxs[0] < area2->mins[0] - dist)
+					continue;
+				if (area->mins[1] > area2->maxs[1] + dist || area->maxs[1] < area2->mins[1] - dist)
+					continue;
+				reachnearbyareas[numareas++] = i;
+			}
+		}
+	}
+	// test the areas in the same order as a full scan would
+	qsort(reachnearbyareas, numareas, sizeof(int), AAS_CompareAreaNums);
+	return numareas;
+}
+//===========================================================================
 
 // TRAVEL_WALK					100%	equal floor height + steps
 // TRAVEL_CROUCH				100%
@@ -3783,7 +3955,8 @@ static void AAS_StoreReachability(void) {
 
 //===========================================================================
 int AAS_ContinueInitReachability(float time) {
-	int i, j, todo, start_time;
+	int i, j, k, todo, start_time, numareas;
+	float pairdist;
 	static float framereachability, reachability_delay;
 	static int lastpercentage;
 
@@ -3798,7 +3971,14 @@ int AAS_ContinueInitReachability(float time) {
 		lastpercentage = 0;
 		framereachability = 2000;
 		reachability_delay = 1000;
+		reachstarttime = Sys_MilliSeconds();
+		reachpairs = 0;
 	}
+	// areas further apart than this can't have a swim, walk, step, barrier,
+	// water jump, walk off ledge, ladder or jump reachability
+	pairdist = 2 * AAS_MaxJumpDistance(aassettings.phys_jumpvel);
+	if (pairdist < 10)
+		pairdist = 10;
 	// number of areas to calculate reachability for this cycle
 	todo = aasworld.numreachabilityareas + (int)framereachability;
 	start_time = Sys_MilliSeconds();
@@ -3809,8 +3989,11 @@ int AAS_ContinueInitReachability(float time) {
 		if (aasworld.areasettings[i].contents & AREACONTENTS_JUMPPAD) {
 			continue;
 		}
-		// loop over the areas
-		for (j = 1; j < aasworld.numareas; j++) {
+		// loop over the areas near enough
+		numareas = AAS_NearbyReachabilityAreas(i, pairdist);
+		reachpairs += numareas;
+		for (k = 0; k < numareas; k++) {
+			j = reachnearbyareas[k];
 			if (i == j)
 				continue;
 			// never create reachabilities from teleporter or jumppad areas to regular areas
@@ -3842,8 +4025,11 @@ int AAS_ContinueInitReachability(float time) {
 		if (aasworld.areasettings[i].contents & (AREACONTENTS_TELEPORTER | AREACONTENTS_JUMPPAD)) {
 			continue;
 		}
-		// loop over the areas
-		for (j = 1; j < aasworld.numareas; j++) {
+		// loop over the areas, without grapple reachabilities only weapon jump areas can be reached
+		numareas = calcgrapplereach ? aasworld.numareas - 1 : numreachweaponjumpareas;
+		reachpairs += numareas;
+		for (k = 0; k < numareas; k++) {
+			j = calcgrapplereach ? k + 1 : reachweaponjumpareas[k];
 			if (i == j)
 				continue;
 
@@ -3911,9 +4097,13 @@ int AAS_ContinueInitReachability(float time) {
 		AAS_ShutDownReachabilityHeap();
 
 		FreeMemory(areareachability);
+		AAS_ShutdownReachabilityGrid();
 
 		aasworld.numreachabilityareas++;
 
+		botimport.Print(PRT_MESSAGE, "%d area pairs tested in %d msec\n", reachpairs,
+						Sys_MilliSeconds() - reachstarttime);
+
 		botimport.Print(PRT_MESSAGE, "calculating clusters...\n");
 	} else {
 		lastpercentage = aasworld.numreachabilityareas * 1000 / aasworld.numareas;
@@ -3924,6 +4114,9 @@ int AAS_ContinueInitReachability(float time) {
 }
 
 void AAS_InitReachability(void) {
+	reachstartareanum = 0;
+	AAS_ShutdownReachabilityGrid();
+
 	if (!aasworld.loaded)
 		return;
 
@@ -3951,4 +4144,5 @@ void AAS_InitReachability(void) {
 	areareachability = (aas_lreachability_t **)GetClearedMemory(aasworld.numareas * sizeof(aas_lreachability_t *));
 
 	AAS_SetWeaponJumpAreaFlags();
+	AAS_SetupReachabilityGrid();
 }
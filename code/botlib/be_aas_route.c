@@ -30,6 +30,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
  *****************************************************************************/
 
 #include "../qcommon/q_shared.h"
+#include "../qcommon/qcommon.h"
 #include "l_utils.h"
 #include "l_memory.h"
 #include "l_log.h"
@@ -73,8 +74,41 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
   for every area (aasworld.numareas) the portal cache stores
   aasworld.numportals travel times
 
+  threading:
+  route queries may run on the job workers.  A cache is never changed once
+  it has been put at the head of its list, so lookups walk the lists without
+  locking.  A missing cache is created under routingmutex and published with
+  a release store.  Hits are written to a per-thread log instead of moving
+  the cache in the time sorted list, the logs are applied and old cache is
+  freed in AAS_RoutingFrame, when no queries are running.
+
 */
 
+// hits a thread logs between two AAS_RoutingFrame calls, more are applied
+// to the time sorted list directly under the lock
+#define MAX_ROUTINGCACHETOUCHES 1024
+
+// free routing cache at the start of a frame until this much zone is left,
+// leaves room for the cache created during the frame
+#define MIN_ROUTINGFREEMEMORY (2 * 1024 * 1024)
+
+typedef struct {
+	int numtouches;
+	aas_routingcache_t *touches[MAX_ROUTINGCACHETOUCHES];
+} aas_routingthread_t;
+
+static aas_routingthread_t routingthreads[MAX_JOB_THREADS + 1];
+static sysMutex_t *routingmutex;
+static Q_THREADLOCAL int routinglockdepth;
+
+// travel flags the bots route with, see ai_dmnet.c
+static const int precomputetravelflags[] = {TFL_DEFAULT, TFL_DEFAULT | TFL_LAVA | TFL_SLIME};
+
+static int precomputeportal; // next portal to precompute, 0 when done
+static int precomputetravelflag;
+static int precomputetime;	 // msec spent each frame
+static int precomputesave;	 // write the route cache when done
+
 #ifdef ROUTING_DEBUG
 int numareacacheupdates;
 int numportalcacheupdates;
@@ -82,6 +116,7 @@ int numportalcacheupdates;
 
 int routingcachesize;
 int max_routingcachesize;
+static int sysroutingcachesize; // created by the job workers
 
 #ifdef ROUTING_DEBUG
 void AAS_RoutingInfo(void) {
@@ -188,7 +223,67 @@ void AAS_LinkCache(aas_routingcache_t *cache) {
 void AAS_FreeRoutingCache(aas_routingcache_t *cache) {
 	AAS_UnlinkCache(cache);
 	routingcachesize -= cache->size;
-	FreeMemory(cache);
+	if (cache->sysmemory) {
+		sysroutingcachesize -= cache->size;
+		free(cache);
+	} else {
+		FreeMemory(cache);
+	}
+}
+
+//===========================================================================
+// the routing lock only serializes the creation of cache, the lookups
+// don't take it.  It can be taken again by the thread holding it.
+//===========================================================================
+static void AAS_LockRouting(void) {
+	if (routinglockdepth++ == 0 && routingmutex)
+		Sys_LockMutex(routingmutex);
+}
+
+static void AAS_UnlockRouting(void) {
+	if (--routinglockdepth == 0 && routingmutex)
+		Sys_UnlockMutex(routingmutex);
+}
+
+//===========================================================================
+// moves the cache the thread logged to the newest end of the time sorted
+// list, the lock must be held
+//===========================================================================
+static void AAS_ApplyCacheTouches(aas_routingthread_t *rt) {
+	int i;
+	aas_routingcache_t *cache;
+
+	for (i = 0; i < rt->numtouches; i++) {
+		cache = rt->touches[i];
+		AAS_UnlinkCache(cache);
+		cache->time = AAS_Time();
+		AAS_LinkCache(cache);
+	}
+	rt->numtouches = 0;
+}
+
+//===========================================================================
+// applies the hits of all threads, must be called before any cache is
+// freed so that the logs don't keep pointers to it
+//===========================================================================
+static void AAS_FlushCacheTouches(void) {
+	int i;
+
+	for (i = 0; i <= MAX_JOB_THREADS; i++) {
+		AAS_ApplyCacheTouches(&routingthreads[i]);
+	}
+}
+
+static void AAS_TouchCache(aas_routingcache_t *cache) {
+	aas_routingthread_t *rt;
+
+	rt = &routingthreads[Com_JobThreadIndex()];
+	if (rt->numtouches >= MAX_ROUTINGCACHETOUCHES) {
+		AAS_LockRouting();
+		AAS_ApplyCacheTouches(rt);
+		AAS_UnlockRouting();
+	}
+	rt->touches[rt->numtouches++] = cache;
 }
 
 void AAS_RemoveRoutingCacheInCluster(int clusternum) {
@@ -198,6 +293,7 @@ void AAS_RemoveRoutingCacheInCluster(int clusternum) {
 
 	if (!aasworld.clusterareacache)
 		return;
+	AAS_FlushCacheTouches();
 	cluster = &aasworld.clusters[clusternum];
 	for (i = 0; i < cluster->numareas; i++) {
 		for (cache = aasworld.clusterareacache[clusternum][i]; cache; cache = nextcache) {
@@ -221,6 +317,7 @@ void AAS_RemoveRoutingCacheUsingArea(int areanum) {
 		AAS_RemoveRoutingCacheInCluster(aasworld.portals[-clusternum].frontcluster);
 		AAS_RemoveRoutingCacheInCluster(aasworld.portals[-clusternum].backcluster);
 	}
+	AAS_FlushCacheTouches();
 	// remove all portal cache
 	for (i = 0; i < aasworld.numareas; i++) {
 		// refresh portal cache
@@ -249,6 +346,12 @@ int AAS_EnableRoutingArea(int areanum, int enable) {
 		aasworld.areasettings[areanum].areaflags &= ~AREA_DISABLED;
 	else
 		aasworld.areasettings[areanum].areaflags |= AREA_DISABLED;
+	if (aasworld.routingareas) {
+		if (enable)
+			aasworld.routingareas[areanum].travelflags &= ~TFL_INVALID;
+		else
+			aasworld.routingareas[areanum].travelflags |= TFL_INVALID;
+	}
 	// if the status of the area changed
 	if ((flags & AREA_DISABLED) != (aasworld.areasettings[areanum].areaflags & AREA_DISABLED)) {
 		// remove all routing cache involving this area
@@ -305,9 +408,51 @@ void AAS_InitAreaContentsTravelFlags(void) {
 	}
 }
 
+//===========================================================================
+// packs the area and reachability fields the routing update loops read,
+// so that they touch a few small arrays instead of the file structures
+//===========================================================================
+static void AAS_InitRoutingLayout(void) {
+	int i;
+	char *ptr;
+	aas_areasettings_t *settings;
+	aas_routingarea_t *area;
+
+	if (aasworld.routingareas)
+		FreeMemory(aasworld.routingareas);
+	ptr = (char *)GetClearedMemory(aasworld.numareas * sizeof(aas_routingarea_t) +
+								   aasworld.reachabilitysize * (2 * sizeof(int) + sizeof(unsigned short)));
+	aasworld.routingareas = (aas_routingarea_t *)ptr;
+	ptr += aasworld.numareas * sizeof(aas_routingarea_t);
+	aasworld.reachareanum = (int *)ptr;
+	ptr += aasworld.reachabilitysize * sizeof(int);
+	aasworld.reachtravelflags = (int *)ptr;
+	ptr += aasworld.reachabilitysize * sizeof(int);
+	aasworld.reachtraveltime = (unsigned short *)ptr;
+
+	for (i = 0; i < aasworld.numareas; i++) {
+		settings = &aasworld.areasettings[i];
+		area = &aasworld.routingareas[i];
+		area->cluster = settings->cluster;
+		area->clusterareanum = settings->clusterareanum;
+		area->firstreachablearea = settings->firstreachablearea;
+		area->travelflags = aasworld.areacontentstravelflags[i];
+		if (settings->areaflags & AREA_DISABLED)
+			area->travelflags |= TFL_INVALID;
+		area->numreachableareas = settings->numreachableareas;
+		area->presencetype = settings->presencetype;
+	}
+	for (i = 0; i < aasworld.reachabilitysize; i++) {
+		aasworld.reachareanum[i] = aasworld.reachability[i].areanum;
+		aasworld.reachtravelflags[i] = AAS_TravelFlagForType_inline(aasworld.reachability[i].traveltype);
+		aasworld.reachtraveltime[i] = aasworld.reachability[i].traveltime;
+	}
+}
+
 void AAS_CreateReversedReachability(void) {
-	int i, n;
-	aas_reversedlink_t *revlink;
+	int i, n, numlinks;
+	aas_reversedlink_t *revlink, *links;
+	aas_reversedreachability_t *revreach;
 	aas_reachability_t *reach;
 	aas_areasettings_t *settings;
 	char *ptr;
@@ -325,29 +470,46 @@ void AAS_CreateReversedReachability(void) {
 
 	aasworld.reversedreachability = (aas_reversedreachability_t *)ptr;
 	// pointer to the memory for the reversed links
-	ptr += aasworld.numareas * sizeof(aas_reversedreachability_t);
-	// check all reachabilities of all areas
+	links = (aas_reversedlink_t *)(ptr + aasworld.numareas * sizeof(aas_reversedreachability_t));
+	// count the links into every area
 	for (i = 1; i < aasworld.numareas; i++) {
 		// settings of the area
 		settings = &aasworld.areasettings[i];
 
 		if (settings->numreachableareas >= 128)
 			botimport.Print(PRT_WARNING, "area %d has more than 128 reachabilities\n", i);
-		// create reversed links for the reachabilities
+		for (n = 0; n < settings->numreachableareas && n < 128; n++) {
+			reach = &aasworld.reachability[settings->firstreachablearea + n];
+			aasworld.reversedreachability[reach->areanum].numlinks++;
+		}
+	}
+	// the links of an area are stored next to each other so the routing
+	// update reads them in one go, for now first points past the end of them
+	for (numlinks = 0, i = 0; i < aasworld.numareas; i++) {
+		numlinks += aasworld.reversedreachability[i].numlinks;
+		aasworld.reversedreachability[i].first = links + numlinks;
+	}
+	// create reversed links for the reachabilities, filled in from the back
+	// so they're in the same order as when every link was put in front
+	for (i = 1; i < aasworld.numareas; i++) {
+		settings = &aasworld.areasettings[i];
 		for (n = 0; n < settings->numreachableareas && n < 128; n++) {
 			// reachability link
 			reach = &aasworld.reachability[settings->firstreachablearea + n];
 
-			revlink = (aas_reversedlink_t *)ptr;
-			ptr += sizeof(aas_reversedlink_t);
-
+			revlink = --aasworld.reversedreachability[reach->areanum].first;
 			revlink->areanum = i;
 			revlink->linknum = settings->firstreachablearea + n;
-			revlink->next = aasworld.reversedreachability[reach->areanum].first;
-			aasworld.reversedreachability[reach->areanum].first = revlink;
-			aasworld.reversedreachability[reach->areanum].numlinks++;
 		}
 	}
+	for (i = 0; i < aasworld.numareas; i++) {
+		revreach = &aasworld.reversedreachability[i];
+		for (n = 0; n < revreach->numlinks; n++) {
+			revreach->first[n].next = n + 1 < revreach->numlinks ? &revreach->first[n + 1] : NULL;
+		}
+		if (!revreach->numlinks)
+			revreach->first = NULL;
+	}
 #ifdef DEBUG
 	botimport.Print(PRT_MESSAGE, "reversed reachability %d msec\n", Sys_MilliSeconds() - starttime);
 #endif
@@ -522,13 +684,49 @@ static aas_routingcache_t *AAS_AllocRoutingCache(int numtraveltimes) {
 
 	routingcachesize += size;
 
-	cache = (aas_routingcache_t *)GetClearedMemory(size);
+	// the zone can only be used from the main thread
+	if (Com_JobThreadIndex()) {
+		cache = (aas_routingcache_t *)calloc(1, size);
+		if (!cache)
+			return NULL;
+		cache->sysmemory = qtrue;
+		sysroutingcachesize += size;
+	} else {
+		cache = (aas_routingcache_t *)GetClearedMemory(size);
+	}
 	cache->reachabilities =
 		(unsigned char *)cache + sizeof(aas_routingcache_t) + numtraveltimes * sizeof(unsigned short int);
 	cache->size = size;
 	return cache;
 }
 
+//===========================================================================
+// finds the cache without undesired travel flags in a list that may be
+// growing on another thread
+//===========================================================================
+static aas_routingcache_t *AAS_FindRoutingCache(aas_routingcache_t **list, int travelflags) {
+	aas_routingcache_t *cache;
+
+	for (cache = (aas_routingcache_t *)Q_LoadPtrAcquire(list); cache; cache = cache->next) {
+		if (cache->travelflags == travelflags)
+			break;
+	}
+	return cache;
+}
+
+//===========================================================================
+// puts a complete cache at the head of its list, the lock must be held
+//===========================================================================
+static void AAS_PublishRoutingCache(aas_routingcache_t **list, aas_routingcache_t *cache) {
+	cache->prev = NULL;
+	cache->next = *list;
+	if (*list)
+		(*list)->prev = cache;
+	cache->time = AAS_RoutingTime();
+	AAS_LinkCache(cache);
+	Q_StorePtrRelease(list, cache);
+}
+
 static void AAS_FreeAllClusterAreaCache(void) {
 	int i, j;
 	aas_routingcache_t *cache, *nextcache;
@@ -537,6 +735,7 @@ static void AAS_FreeAllClusterAreaCache(void) {
 	// free all cluster cache if existing
 	if (!aasworld.clusterareacache)
 		return;
+	AAS_FlushCacheTouches();
 	// free caches
 	for (i = 0; i < aasworld.numclusters; i++) {
 		cluster = &aasworld.clusters[i];
@@ -579,6 +778,7 @@ static void AAS_FreeAllPortalCache(void) {
 	// free all portal cache if existing
 	if (!aasworld.portalcache)
 		return;
+	AAS_FlushCacheTouches();
 	// free portal caches
 	for (i = 0; i < aasworld.numareas; i++) {
 		for (cache = aasworld.portalcache[i]; cache; cache = nextcache) {
@@ -631,6 +831,7 @@ void AAS_CreateAllRoutingCache(void) {
 	for (i = 1; i < aasworld.numareas; i++) {
 		if (!AAS_AreaReachability(i))
 			continue;
+		AAS_RoutingFrame();
 		for (j = 1; j < aasworld.numareas; j++) {
 			if (i == j)
 				continue;
@@ -645,25 +846,78 @@ void AAS_CreateAllRoutingCache(void) {
 }
 
 // the route cache header
-// this header is followed by numportalcache + numareacache aas_routingcache_t
-// structures that store routing cache
+// this header is followed by numportalcache + numareacache records.  Every
+// record is a routecacherecord_t followed by numtraveltimes travel times and
+// numtraveltimes reachability indices relative to the first reachability of
+// the area, the portal cache comes first
 typedef struct routecacheheader_s {
 	int ident;
 	int version;
 	int numareas;
 	int numclusters;
+	int numportals;
 	int areacrc;
 	int clustercrc;
+	int reachabilitycrc;
 	int numportalcache;
 	int numareacache;
 } routecacheheader_t;
 
+typedef struct routecacherecord_s {
+	int cluster;
+	int areanum;
+	int travelflags;
+	int numtraveltimes;
+} routecacherecord_t;
+
 #define RCID (('C' << 24) + ('R' << 16) + ('E' << 8) + 'M')
-#define RCVERSION 2
+#define RCVERSION 3
 
 // void AAS_DecompressVis(byte *in, int numareas, byte *decompressed);
 // int AAS_CompressVis(byte *vis, int numareas, byte *dest);
 
+static void AAS_RouteCacheHeader(routecacheheader_t *header) {
+	Com_Memset(header, 0, sizeof(*header));
+	header->ident = RCID;
+	header->version = RCVERSION;
+	header->numareas = aasworld.numareas;
+	header->numclusters = aasworld.numclusters;
+	header->numportals = aasworld.numportals;
+	header->areacrc = CRC_ProcessString((unsigned char *)aasworld.areas, sizeof(aas_area_t) * aasworld.numareas);
+	header->clustercrc =
+		CRC_ProcessString((unsigned char *)aasworld.clusters, sizeof(aas_cluster_t) * aasworld.numclusters);
+	header->reachabilitycrc = CRC_ProcessString((unsigned char *)aasworld.reachability,
+												sizeof(aas_reachability_t) * aasworld.reachabilitysize);
+}
+
+static void AAS_SwapRouteCacheHeader(routecacheheader_t *header) {
+	int i;
+
+	for (i = 0; i < sizeof(*header) / sizeof(int); i++) {
+		((int *)header)[i] = LittleLong(((int *)header)[i]);
+	}
+}
+
+static int AAS_WriteCacheRecord(fileHandle_t fp, aas_routingcache_t *cache, int numtraveltimes) {
+	routecacherecord_t record;
+	unsigned short traveltimes[512];
+	int i, n;
+
+	record.cluster = LittleLong(cache->cluster);
+	record.areanum = LittleLong(cache->areanum);
+	record.travelflags = LittleLong(cache->travelflags);
+	record.numtraveltimes = LittleLong(numtraveltimes);
+	botimport.FS_Write(&record, sizeof(record), fp);
+	for (i = 0; i < numtraveltimes; i += n) {
+		for (n = 0; n < ARRAY_LEN(traveltimes) && i + n < numtraveltimes; n++) {
+			traveltimes[n] = LittleShort(cache->traveltimes[i + n]);
+		}
+		botimport.FS_Write(traveltimes, n * sizeof(unsigned short), fp);
+	}
+	botimport.FS_Write(cache->reachabilities, numtraveltimes, fp);
+	return sizeof(record) + numtraveltimes * (sizeof(unsigned short) + 1);
+}
+
 void AAS_WriteRouteCache(void) {
 	int i, j, numportalcache, numareacache, totalsize;
 	aas_routingcache_t *cache;
@@ -672,6 +926,14 @@ void AAS_WriteRouteCache(void) {
 	char filename[MAX_QPATH];
 	routecacheheader_t routecacheheader;
 
+	// cache created with disabled areas doesn't match the map as loaded
+	for (i = 1; i < aasworld.numareas; i++) {
+		if (aasworld.areasettings[i].areaflags & AREA_DISABLED) {
+			botimport.Print(PRT_WARNING, "route cache not written, area %d is disabled\n", i);
+			return;
+		}
+	}
+
 	numportalcache = 0;
 	for (i = 0; i < aasworld.numareas; i++) {
 		for (cache = aasworld.portalcache[i]; cache; cache = cache->next) {
@@ -695,141 +957,148 @@ void AAS_WriteRouteCache(void) {
 		return;
 	}
 	// create the header
-	routecacheheader.ident = RCID;
-	routecacheheader.version = RCVERSION;
-	routecacheheader.numareas = aasworld.numareas;
-	routecacheheader.numclusters = aasworld.numclusters;
-	routecacheheader.areacrc =
-		CRC_ProcessString((unsigned char *)aasworld.areas, sizeof(aas_area_t) * aasworld.numareas);
-	routecacheheader.clustercrc =
-		CRC_ProcessString((unsigned char *)aasworld.clusters, sizeof(aas_cluster_t) * aasworld.numclusters);
+	AAS_RouteCacheHeader(&routecacheheader);
 	routecacheheader.numportalcache = numportalcache;
 	routecacheheader.numareacache = numareacache;
 	// write the header
+	AAS_SwapRouteCacheHeader(&routecacheheader);
 	botimport.FS_Write(&routecacheheader, sizeof(routecacheheader_t), fp);
 
 	totalsize = 0;
 	// write all the cache
 	for (i = 0; i < aasworld.numareas; i++) {
 		for (cache = aasworld.portalcache[i]; cache; cache = cache->next) {
-			botimport.FS_Write(cache, cache->size, fp);
-			totalsize += cache->size;
+			totalsize += AAS_WriteCacheRecord(fp, cache, aasworld.numportals);
 		}
 	}
 	for (i = 0; i < aasworld.numclusters; i++) {
 		cluster = &aasworld.clusters[i];
 		for (j = 0; j < cluster->numareas; j++) {
 			for (cache = aasworld.clusterareacache[i][j]; cache; cache = cache->next) {
-				botimport.FS_Write(cache, cache->size, fp);
-				totalsize += cache->size;
+				totalsize += AAS_WriteCacheRecord(fp, cache, cluster->numreachabilityareas);
 			}
 		}
 	}
-	// write the visareas
-	/*
-	for (i = 0; i < aasworld.numareas; i++)
-	{
-		if (!aasworld.areavisibility[i]) {
-			size = 0;
-			botimport.FS_Write(&size, sizeof(int), fp);
-			continue;
-		}
-		AAS_DecompressVis( aasworld.areavisibility[i], aasworld.numareas, aasworld.decompressedvis );
-		size = AAS_CompressVis( aasworld.decompressedvis, aasworld.numareas, aasworld.decompressedvis );
-		botimport.FS_Write(&size, sizeof(int), fp);
-		botimport.FS_Write(aasworld.decompressedvis, size, fp);
-	}
-	*/
 
 	botimport.FS_FCloseFile(fp);
 	botimport.Print(PRT_MESSAGE, "\nroute cache written to %s\n", filename);
 	botimport.Print(PRT_MESSAGE, "written %d bytes of routing cache\n", totalsize);
 }
 
-static aas_routingcache_t *AAS_ReadCache(fileHandle_t fp) {
-	int size;
-	aas_routingcache_t *cache;
+//===========================================================================
+// reads one cache record and adds the cache to its list, returns qfalse
+// if the record doesn't fit the loaded map
+//===========================================================================
+static int AAS_ReadCacheRecord(fileHandle_t fp, int type) {
+	routecacherecord_t record;
+	aas_routingcache_t *cache, **list;
+	int i, numtraveltimes, areacluster;
 
-	botimport.FS_Read(&size, sizeof(size), fp);
-	cache = (aas_routingcache_t *)GetMemory(size);
-	cache->size = size;
-	botimport.FS_Read((unsigned char *)cache + sizeof(size), size - sizeof(size), fp);
-	cache->reachabilities = (unsigned char *)cache + sizeof(aas_routingcache_t) - sizeof(unsigned short) +
-							(size - sizeof(aas_routingcache_t) + sizeof(unsigned short)) / 3 * 2;
-	return cache;
+	if (botimport.FS_Read(&record, sizeof(record), fp) != sizeof(record))
+		return qfalse;
+	record.cluster = LittleLong(record.cluster);
+	record.areanum = LittleLong(record.areanum);
+	record.travelflags = LittleLong(record.travelflags);
+	record.numtraveltimes = LittleLong(record.numtraveltimes);
+
+	if (record.areanum <= 0 || record.areanum >= aasworld.numareas)
+		return qfalse;
+	if (record.cluster <= 0 || record.cluster >= aasworld.numclusters)
+		return qfalse;
+	if (type == CACHETYPE_PORTAL) {
+		numtraveltimes = aasworld.numportals;
+		list = &aasworld.portalcache[record.areanum];
+	} else {
+		// the goal area must be in the cluster or one of its portals
+		areacluster = aasworld.areasettings[record.areanum].cluster;
+		if (areacluster > 0) {
+			if (areacluster != record.cluster)
+				return qfalse;
+		} else if (aasworld.portals[-areacluster].frontcluster != record.cluster &&
+				   aasworld.portals[-areacluster].backcluster != record.cluster) {
+			return qfalse;
+		}
+		numtraveltimes = aasworld.clusters[record.cluster].numreachabilityareas;
+		list = &aasworld.clusterareacache[record.cluster][AAS_ClusterAreaNum(record.cluster, record.areanum)];
+	}
+	if (record.numtraveltimes != numtraveltimes)
+		return qfalse;
+
+	cache = AAS_AllocRoutingCache(numtraveltimes);
+	cache->type = type;
+	cache->cluster = record.cluster;
+	cache->areanum = record.areanum;
+	VectorCopy(aasworld.areas[record.areanum].center, cache->origin);
+	cache->starttraveltime = 1;
+	cache->travelflags = record.travelflags;
+	if (botimport.FS_Read(cache->traveltimes, numtraveltimes * sizeof(unsigned short), fp) !=
+			numtraveltimes * sizeof(unsigned short) ||
+		botimport.FS_Read(cache->reachabilities, numtraveltimes, fp) != numtraveltimes) {
+		AAS_FreeRoutingCache(cache);
+		return qfalse;
+	}
+	for (i = 0; i < numtraveltimes; i++) {
+		cache->traveltimes[i] = LittleShort(cache->traveltimes[i]);
+	}
+	// a file with the same cache twice
+	if (AAS_FindRoutingCache(list, cache->travelflags)) {
+		AAS_FreeRoutingCache(cache);
+		return qtrue;
+	}
+	AAS_PublishRoutingCache(list, cache);
+	return qtrue;
 }
 
 static int AAS_ReadRouteCache(void) {
-	int i, clusterareanum; //, size;
+	int i, numportalcache, numareacache;
 	fileHandle_t fp;
 	char filename[MAX_QPATH];
-	routecacheheader_t routecacheheader;
-	aas_routingcache_t *cache;
+	routecacheheader_t routecacheheader, expected;
 
 	Com_sprintf(filename, MAX_QPATH, "maps/%s.rcd", aasworld.mapname);
 	botimport.FS_FOpenFile(filename, &fp, FS_READ);
 	if (!fp) {
 		return qfalse;
 	}
-	botimport.FS_Read(&routecacheheader, sizeof(routecacheheader_t), fp);
+	if (botimport.FS_Read(&routecacheheader, sizeof(routecacheheader_t), fp) != sizeof(routecacheheader_t)) {
+		botimport.FS_FCloseFile(fp);
+		return qfalse;
+	}
+	AAS_SwapRouteCacheHeader(&routecacheheader);
 	if (routecacheheader.ident != RCID) {
+		botimport.FS_FCloseFile(fp);
 		AAS_Error("%s is not a route cache dump\n", filename);
 		return qfalse;
 	}
 	if (routecacheheader.version != RCVERSION) {
-		AAS_Error("route cache dump has wrong version %d, should be %d\n", routecacheheader.version, RCVERSION);
-		return qfalse;
-	}
-	if (routecacheheader.numareas != aasworld.numareas) {
-		// AAS_Error("route cache dump has wrong number of areas\n");
-		return qfalse;
-	}
-	if (routecacheheader.numclusters != aasworld.numclusters) {
-		// AAS_Error("route cache dump has wrong number of clusters\n");
-		return qfalse;
-	}
-	if (routecacheheader.areacrc !=
-		CRC_ProcessString((unsigned char *)aasworld.areas, sizeof(aas_area_t) * aasworld.numareas)) {
-		// AAS_Error("route cache dump area CRC incorrect\n");
+		// an older dump, it's written again by the next precompute
+		botimport.FS_FCloseFile(fp);
+		botimport.Print(PRT_MESSAGE, "%s has version %d, should be %d\n", filename, routecacheheader.version,
+						RCVERSION);
 		return qfalse;
 	}
-	if (routecacheheader.clustercrc !=
-		CRC_ProcessString((unsigned char *)aasworld.clusters, sizeof(aas_cluster_t) * aasworld.numclusters)) {
-		// AAS_Error("route cache dump cluster CRC incorrect\n");
+	// the cache must have been created from this exact AAS data
+	AAS_RouteCacheHeader(&expected);
+	if (routecacheheader.numareas != expected.numareas || routecacheheader.numclusters != expected.numclusters ||
+		routecacheheader.numportals != expected.numportals || routecacheheader.areacrc != expected.areacrc ||
+		routecacheheader.clustercrc != expected.clustercrc ||
+		routecacheheader.reachabilitycrc != expected.reachabilitycrc) {
+		botimport.FS_FCloseFile(fp);
+		botimport.Print(PRT_MESSAGE, "%s doesn't match %s.aas\n", filename, aasworld.mapname);
 		return qfalse;
 	}
-	// read all the portal cache
-	for (i = 0; i < routecacheheader.numportalcache; i++) {
-		cache = AAS_ReadCache(fp);
-		cache->next = aasworld.portalcache[cache->areanum];
-		cache->prev = NULL;
-		if (aasworld.portalcache[cache->areanum])
-			aasworld.portalcache[cache->areanum]->prev = cache;
-		aasworld.portalcache[cache->areanum] = cache;
-	}
-	// read all the cluster area cache
-	for (i = 0; i < routecacheheader.numareacache; i++) {
-		cache = AAS_ReadCache(fp);
-		clusterareanum = AAS_ClusterAreaNum(cache->cluster, cache->areanum);
-		cache->next = aasworld.clusterareacache[cache->cluster][clusterareanum];
-		cache->prev = NULL;
-		if (aasworld.clusterareacache[cache->cluster][clusterareanum])
-			aasworld.clusterareacache[cache->cluster][clusterareanum]->prev = cache;
-		aasworld.clusterareacache[cache->cluster][clusterareanum] = cache;
-	}
-	// read the visareas
-	/*
-	aasworld.areavisibility = (byte **) GetClearedMemory(aasworld.numareas * sizeof(byte *));
-	aasworld.decompressedvis = (byte *) GetClearedMemory(aasworld.numareas * sizeof(byte));
-	for (i = 0; i < aasworld.numareas; i++)
-	{
-		botimport.FS_Read(&size, sizeof(size), fp );
-		if (size) {
-			aasworld.areavisibility[i] = (byte *) GetMemory(size);
-			botimport.FS_Read(aasworld.areavisibility[i], size, fp );
+	numportalcache = routecacheheader.numportalcache;
+	numareacache = routecacheheader.numareacache;
+
+	AAS_LockRouting();
+	for (i = 0; i < numportalcache + numareacache; i++) {
+		if (!AAS_ReadCacheRecord(fp, i < numportalcache ? CACHETYPE_PORTAL : CACHETYPE_AREA)) {
+			botimport.Print(PRT_WARNING, "%s is damaged, read %d of %d caches\n", filename, i,
+							numportalcache + numareacache);
+			break;
 		}
 	}
-	*/
+	AAS_UnlockRouting();
 
 	botimport.FS_FCloseFile(fp);
 	return qtrue;
@@ -912,10 +1181,302 @@ static void AAS_InitReachabilityAreas(void) {
 	}
 }
 
+//===========================================================================
+// goal directed route search
+//
+// an A* search over the reachabilities that answers a single route query
+// without creating any routing cache.  A node is a reachability, its cost
+// the travel time to the end of the reachability.  The heuristic is the
+// distance to the goal area at a speed a little above walking, unless a
+// reachability that travels faster (teleporters, jump pads) is closer.
+// Travel times are truncated to hundredths so it can overestimate by that.
+//===========================================================================
+
+// a little under DISTANCEFACTOR_WALK
+#define ASTAR_DISTANCEFACTOR 0.25f
+
+typedef struct {
+	int size;				// number of reachabilities the arrays are for
+	unsigned int query;		// stamp of the current search
+	unsigned int *stamp;	// search the reachability was last reached in
+	int *traveltime;		// travel time to the end of the reachability
+	int *estimate;			// traveltime plus the heuristic
+	int *firstreach;		// reachability the route leaves the start area with
+	int *heappos;			// position in the heap, -1 when done
+	int *heap;
+	int heapsize;
+} aas_astar_t;
+
+static aas_astar_t astarthreads[MAX_JOB_THREADS + 1];
+
+// reachabilities faster than ASTAR_DISTANCEFACTOR
+static int *astarwarps;
+static int numastarwarps;
+static int minastarwarptime;
+// position of each reachability in the reversed links of the area it
+// leads to, -1 when it has none, for the lookups in areatraveltimes
+static int *astarrevlinkindex;
+
+static int routingastar;
+
+static void AAS_FreeAStarThread(aas_astar_t *as) {
+	free(as->stamp);
+	free(as->traveltime);
+	free(as->estimate);
+	free(as->firstreach);
+	free(as->heappos);
+	free(as->heap);
+	Com_Memset(as, 0, sizeof(*as));
+}
+
+static void AAS_FreeRouteSearch(void) {
+	int i;
+
+	for (i = 0; i <= MAX_JOB_THREADS; i++) {
+		AAS_FreeAStarThread(&astarthreads[i]);
+	}
+	if (astarwarps)
+		FreeMemory(astarwarps);
+	astarwarps = NULL;
+	numastarwarps = 0;
+	if (astarrevlinkindex)
+		FreeMemory(astarrevlinkindex);
+	astarrevlinkindex = NULL;
+}
+
+static void AAS_InitRouteSearch(void) {
+	int i, n;
+	float dist;
+	aas_reachability_t *reach;
+	aas_reversedlink_t *revlink;
+
+	AAS_FreeRouteSearch();
+	routingastar = (int)LibVarValue("routingastar", "1");
+
+	astarwarps = (int *)GetClearedMemory(aasworld.reachabilitysize * sizeof(int));
+	numastarwarps = 0;
+	minastarwarptime = 0;
+	for (i = 1; i < aasworld.reachabilitysize; i++) {
+		reach = &aasworld.reachability[i];
+		dist = Distance(reach->start, reach->end);
+		if (reach->traveltime < dist * ASTAR_DISTANCEFACTOR) {
+			if (!numastarwarps || reach->traveltime < minastarwarptime)
+				minastarwarptime = reach->traveltime;
+			astarwarps[numastarwarps++] = i;
+		}
+	}
+
+	astarrevlinkindex = (int *)GetMemory(aasworld.reachabilitysize * sizeof(int));
+	for (i = 0; i < aasworld.reachabilitysize; i++) {
+		astarrevlinkindex[i] = -1;
+	}
+	for (i = 1; i < aasworld.numareas; i++) {
+		for (n = 0, revlink = aasworld.reversedreachability[i].first; revlink; revlink = revlink->next, n++) {
+			astarrevlinkindex[revlink->linknum] = n;
+		}
+	}
+}
+
+//===========================================================================
+// the search arrays of the calling thread, allocated with malloc so that
+// the job workers can search too
+//===========================================================================
+static aas_astar_t *AAS_AStarThread(void) {
+	aas_astar_t *as;
+	int size;
+
+	as = &astarthreads[Com_JobThreadIndex()];
+	size = aasworld.reachabilitysize;
+	if (as->size != size) {
+		AAS_FreeAStarThread(as);
+		as->stamp = (unsigned int *)calloc(size, sizeof(unsigned int));
+		as->traveltime = (int *)malloc(size * sizeof(int));
+		as->estimate = (int *)malloc(size * sizeof(int));
+		as->firstreach = (int *)malloc(size * sizeof(int));
+		as->heappos = (int *)malloc(size * sizeof(int));
+		as->heap = (int *)malloc(size * sizeof(int));
+		if (!as->stamp || !as->traveltime || !as->estimate || !as->firstreach || !as->heappos || !as->heap) {
+			AAS_FreeAStarThread(as);
+			return NULL;
+		}
+		as->size = size;
+	}
+	// start a new search, clear the stamps when they wrap
+	if (++as->query == 0) {
+		Com_Memset(as->stamp, 0, size * sizeof(unsigned int));
+		as->query = 1;
+	}
+	as->heapsize = 0;
+	return as;
+}
+
+static int AAS_AStarHeuristic(vec3_t point, aas_area_t *goal) {
+	int i;
+	float d, dist, best;
+	vec3_t v;
+
+	// distance to the bounds of the goal area
+	for (i = 0; i < 3; i++) {
+		if (point[i] < goal->mins[i])
+			v[i] = goal->mins[i] - point[i];
+		else if (point[i] > goal->maxs[i])
+			v[i] = point[i] - goal->maxs[i];
+		else
+			v[i] = 0;
+	}
+	best = VectorLength(v);
+	// or to the nearest fast reachability, which can go anywhere
+	if (numastarwarps) {
+		dist = best;
+		for (i = 0; i < numastarwarps && dist > 0; i++) {
+			d = Distance(point, aasworld.reachability[astarwarps[i]].start);
+			if (d < dist)
+				dist = d;
+		}
+		if (dist * ASTAR_DISTANCEFACTOR + minastarwarptime < best * ASTAR_DISTANCEFACTOR)
+			return dist * ASTAR_DISTANCEFACTOR + minastarwarptime;
+	}
+	return best * ASTAR_DISTANCEFACTOR;
+}
+
+static void AAS_AStarHeapSet(aas_astar_t *as, int pos, int reachnum) {
+	as->heap[pos] = reachnum;
+	as->heappos[reachnum] = pos;
+}
+
+static void AAS_AStarHeapUp(aas_astar_t *as, int pos) {
+	int reachnum, parent;
+
+	reachnum = as->heap[pos];
+	while (pos > 0) {
+		parent = (pos - 1) / 2;
+		if (as->estimate[as->heap[parent]] <= as->estimate[reachnum])
+			break;
+		AAS_AStarHeapSet(as, pos, as->heap[parent]);
+		pos = parent;
+	}
+	AAS_AStarHeapSet(as, pos, reachnum);
+}
+
+static int AAS_AStarHeapPop(aas_astar_t *as) {
+	int top, reachnum, pos, child;
+
+	top = as->heap[0];
+	as->heappos[top] = -1;
+	reachnum = as->heap[--as->heapsize];
+	pos = 0;
+	while ((child = 2 * pos + 1) < as->heapsize) {
+		if (child + 1 < as->heapsize && as->estimate[as->heap[child + 1]] < as->estimate[as->heap[child]])
+			child++;
+		if (as->estimate[reachnum] <= as->estimate[as->heap[child]])
+			break;
+		AAS_AStarHeapSet(as, pos, as->heap[child]);
+		pos = child;
+	}
+	if (as->heapsize)
+		AAS_AStarHeapSet(as, pos, reachnum);
+	return top;
+}
+
+//===========================================================================
+// reaches the reachability with the given travel time, if that's better
+//===========================================================================
+static void AAS_AStarReach(aas_astar_t *as, int reachnum, int traveltime, int firstreach, aas_area_t *goal) {
+	if (as->stamp[reachnum] == as->query) {
+		// done already or no improvement
+		if (as->heappos[reachnum] < 0 || as->traveltime[reachnum] <= traveltime)
+			return;
+		as->estimate[reachnum] -= as->traveltime[reachnum] - traveltime;
+		as->traveltime[reachnum] = traveltime;
+		as->firstreach[reachnum] = firstreach;
+		AAS_AStarHeapUp(as, as->heappos[reachnum]);
+		return;
+	}
+	as->stamp[reachnum] = as->query;
+	as->traveltime[reachnum] = traveltime;
+	as->estimate[reachnum] = traveltime + AAS_AStarHeuristic(aasworld.reachability[reachnum].end, goal);
+	as->firstreach[reachnum] = firstreach;
+	as->heappos[reachnum] = as->heapsize;
+	as->heap[as->heapsize++] = reachnum;
+	AAS_AStarHeapUp(as, as->heapsize - 1);
+}
+
+static ID_INLINE int AAS_AStarUsable(int linknum, int badtravelflags) {
+	// an undesired travel type, or the next area is disabled or has a not
+	// allowed travel flag
+	return !((aasworld.reachtravelflags[linknum] | aasworld.routingareas[aasworld.reachareanum[linknum]].travelflags) &
+			 badtravelflags);
+}
+
+//===========================================================================
+// same results as AAS_AreaRouteToGoalArea, but found with a search that
+// creates no routing cache.  Disabled areas are read as the search goes,
+// so AAS_EnableRoutingArea needs nothing repaired for it.
+//===========================================================================
+static int AAS_AreaRouteAStar(int areanum, vec3_t origin, int goalareanum, int travelflags, int *traveltime,
+							  int *reachnum) {
+	int i, t, badtravelflags, linknum, nextlinknum, revindex;
+	aas_astar_t *as;
+	aas_area_t *goal;
+	aas_areasettings_t *settings;
+	aas_reachability_t *reach, *nextreach;
+
+	as = AAS_AStarThread();
+	if (!as || !astarrevlinkindex)
+		return qfalse;
+
+	goal = &aasworld.areas[goalareanum];
+	badtravelflags = ~travelflags;
+	// leave the start area
+	settings = &aasworld.areasettings[areanum];
+	for (i = 0; i < settings->numreachableareas; i++) {
+		linknum = settings->firstreachablearea + i;
+		reach = &aasworld.reachability[linknum];
+		if (!AAS_AStarUsable(linknum, badtravelflags))
+			continue;
+		t = reach->traveltime;
+		if (origin)
+			t += AAS_AreaTravelTime(areanum, origin, reach->start);
+		AAS_AStarReach(as, linknum, t, linknum, goal);
+	}
+
+	while (as->heapsize) {
+		linknum = AAS_AStarHeapPop(as);
+		reach = &aasworld.reachability[linknum];
+		// the first time the goal area is entered is the shortest route there
+		if (reach->areanum == goalareanum) {
+			// the cache starts with one at the goal area
+			*traveltime = 1 + as->traveltime[linknum];
+			*reachnum = as->firstreach[linknum];
+			return qtrue;
+		}
+		revindex = astarrevlinkindex[linknum];
+		settings = &aasworld.areasettings[reach->areanum];
+		for (i = 0; i < settings->numreachableareas; i++) {
+			nextlinknum = settings->firstreachablearea + i;
+			if (!AAS_AStarUsable(nextlinknum, badtravelflags))
+				continue;
+			nextreach = &aasworld.reachability[nextlinknum];
+			// travel time through the area
+			if (revindex >= 0)
+				t = aasworld.areatraveltimes[reach->areanum][i][revindex];
+			else
+				t = AAS_AreaTravelTime(reach->areanum, reach->end, nextreach->start);
+			t += as->traveltime[linknum] + nextreach->traveltime;
+			AAS_AStarReach(as, nextlinknum, t, as->firstreach[linknum], goal);
+		}
+	}
+	return qfalse;
+}
+
 void AAS_InitRouting(void) {
+	int loaded;
+
 	AAS_InitTravelFlagFromType();
 
 	AAS_InitAreaContentsTravelFlags();
+	// pack the fields the routing reads
+	AAS_InitRoutingLayout();
 	// initialize the routing update fields
 	AAS_InitRoutingUpdate();
 	// create reversed reachability links used by the routing update algorithm
@@ -930,6 +1491,8 @@ void AAS_InitRouting(void) {
 	AAS_InitPortalMaxTravelTimes();
 	// get the areas reachabilities go through
 	AAS_InitReachabilityAreas();
+	// initialize the goal directed route search
+	AAS_InitRouteSearch();
 
 #ifdef ROUTING_DEBUG
 	numareacacheupdates = 0;
@@ -937,9 +1500,21 @@ void AAS_InitRouting(void) {
 #endif // ROUTING_DEBUG
 
 	routingcachesize = 0;
+	sysroutingcachesize = 0;
 	max_routingcachesize = 1024 * (int)LibVarValue("max_routingcache", "4096");
+	if (!routingmutex)
+		routingmutex = Sys_CreateMutex();
 	// read any routing cache if available
-	AAS_ReadRouteCache();
+	loaded = AAS_ReadRouteCache();
+	// build the portal routing in the background, with precomputeroutes 2
+	// it's saved for the next time the map is loaded
+	precomputeportal = 0;
+	precomputetravelflag = 0;
+	if ((int)LibVarValue("precomputeroutes", "0")) {
+		precomputeportal = 1;
+		precomputetime = (int)LibVarValue("precomputeroutetime", "2");
+		precomputesave = !loaded && (int)LibVarValue("precomputeroutes", "0") >= 2;
+	}
 }
 
 void AAS_FreeRoutingCaches(void) {
@@ -947,6 +1522,8 @@ void AAS_FreeRoutingCaches(void) {
 	AAS_FreeAllClusterAreaCache();
 	// free all the existing portal cache
 	AAS_FreeAllPortalCache();
+	// free the route search data
+	AAS_FreeRouteSearch();
 	// free cached travel times within areas
 	if (aasworld.areatraveltimes)
 		FreeMemory(aasworld.areatraveltimes);
@@ -982,6 +1559,13 @@ void AAS_FreeRoutingCaches(void) {
 	if (aasworld.areacontentstravelflags)
 		FreeMemory(aasworld.areacontentstravelflags);
 	aasworld.areacontentstravelflags = NULL;
+	// free the packed routing fields
+	if (aasworld.routingareas)
+		FreeMemory(aasworld.routingareas);
+	aasworld.routingareas = NULL;
+	aasworld.reachareanum = NULL;
+	aasworld.reachtravelflags = NULL;
+	aasworld.reachtraveltime = NULL;
 }
 //===========================================================================
 // update the given routing cache
@@ -1127,7 +1711,7 @@ static void AAS_UpdateAreaRoutingCache(aas_routingcache_t *areacache) {
 	int badtravelflags, linknum, nextareanum;
 	unsigned short int startareatraveltimes[128], t;
 	aas_routingupdate_t *curupdate;
-	aas_reachability_t *reach;
+	aas_routingarea_t *nextarea;
 	aas_reversedreachability_t *revreach;
 	aas_reversedlink_t *revlink;
 
@@ -1163,100 +1747,100 @@ static void AAS_UpdateAreaRoutingCache(aas_routingcache_t *areacache) {
 		// iterate over all reachabilities, update traveltimes
 		revreach = &aasworld.reversedreachability[curupdate->areanum];
 
+		// all reachabilities lead into the current area, the area flags
+		// also hold TFL_INVALID when it's disabled
+		if (aasworld.routingareas[curupdate->areanum].travelflags & badtravelflags)
+			continue;
+
 		for (i = 0, revlink = revreach->first; revlink; revlink = revlink->next, i++) {
 			linknum = revlink->linknum;
-			reach = &aasworld.reachability[linknum];
 			// if there is used an undesired travel type
-			if (AAS_TravelFlagForType_inline(reach->traveltype) & badtravelflags)
-				continue;
-			// if not allowed to enter the next area
-			if (aasworld.areasettings[reach->areanum].areaflags & AREA_DISABLED)
-				continue;
-			// if the next area has a not allowed travel flag
-			if (AAS_AreaContentsTravelFlags_inline(reach->areanum) & badtravelflags)
+			if (aasworld.reachtravelflags[linknum] & badtravelflags)
 				continue;
 			// number of the area the reversed reachability leads to
 			nextareanum = revlink->areanum;
+			nextarea = &aasworld.routingareas[nextareanum];
 			// get the cluster number of the area
-			cluster = aasworld.areasettings[nextareanum].cluster;
+			cluster = nextarea->cluster;
 			// don't leave the cluster
 			if (cluster > 0 && cluster != areacache->cluster)
 				continue;
 			// get the number of the area in the cluster
-			clusterareanum = AAS_ClusterAreaNum(areacache->cluster, nextareanum);
+			if (cluster > 0)
+				clusterareanum = nextarea->clusterareanum;
+			else
+				clusterareanum = AAS_ClusterAreaNum(areacache->cluster, nextareanum);
 			if (clusterareanum >= numreachabilityareas)
 				continue;
 			// time already travelled plus the traveltime through
 			// the current area plus the travel time from the reachability
 			t = curupdate->tmptraveltime +
 				// AAS_AreaTravelTime(curupdate->areanum, curupdate->start, reach->end) +
-				curupdate->areatraveltimes[i] + reach->traveltime;
+				curupdate->areatraveltimes[i] + aasworld.reachtraveltime[linknum];
 
 			if (aasworld.areaupdate[clusterareanum].tmptraveltime == TT_INF) {
 				aasworld.areaupdate[clusterareanum].areanum = nextareanum;
 				aasworld.areaupdate[clusterareanum].tmptraveltime = t;
 				aasworld.areaupdate[clusterareanum].areatraveltimes =
-					aasworld
-						.areatraveltimes[nextareanum][linknum - aasworld.areasettings[nextareanum].firstreachablearea];
+					aasworld.areatraveltimes[nextareanum][linknum - nextarea->firstreachablearea];
 				ClusterCacheHeapInsert(&aasworld.areaupdate[clusterareanum]);
 				// store new best values
 				areacache->traveltimes[clusterareanum] = t;
-				areacache->reachabilities[clusterareanum] =
-					linknum - aasworld.areasettings[nextareanum].firstreachablearea;
+				areacache->reachabilities[clusterareanum] = linknum - nextarea->firstreachablearea;
 			}
 			// already in the queue, update value
 			else if (areacache->traveltimes[clusterareanum] > t) {
 				// areanum is already set
 				aasworld.areaupdate[clusterareanum].tmptraveltime = t;
 				aasworld.areaupdate[clusterareanum].areatraveltimes =
-					aasworld
-						.areatraveltimes[nextareanum][linknum - aasworld.areasettings[nextareanum].firstreachablearea];
+					aasworld.areatraveltimes[nextareanum][linknum - nextarea->firstreachablearea];
 				ClusterCacheHeapDecreaseKey(&aasworld.areaupdate[clusterareanum]);
 				// store new best values
 				areacache->traveltimes[clusterareanum] = t;
-				areacache->reachabilities[clusterareanum] =
-					linknum - aasworld.areasettings[nextareanum].firstreachablearea;
+				areacache->reachabilities[clusterareanum] = linknum - nextarea->firstreachablearea;
 			}
 		}
 	}
 }
 // cyr}
 
-static aas_routingcache_t *AAS_GetAreaRoutingCache(int clusternum, int areanum, int travelflags) {
+//===========================================================================
+// returns the area cache, creates it when missing if create is set
+//===========================================================================
+static aas_routingcache_t *AAS_GetAreaRoutingCache(int clusternum, int areanum, int travelflags, int create) {
 	int clusterareanum;
-	aas_routingcache_t *cache, *clustercache;
+	aas_routingcache_t *cache, **list;
 
 	// number of the area in the cluster
 	clusterareanum = AAS_ClusterAreaNum(clusternum, areanum);
 	// pointer to the cache for the area in the cluster
-	clustercache = aasworld.clusterareacache[clusternum][clusterareanum];
-	// find the cache without undesired travel flags
-	for (cache = clustercache; cache; cache = cache->next) {
-		// if there aren't used any undesired travel types for the cache
-		if (cache->travelflags == travelflags)
-			break;
+	list = &aasworld.clusterareacache[clusternum][clusterareanum];
+	cache = AAS_FindRoutingCache(list, travelflags);
+	if (cache) {
+		// the cache has been accessed
+		AAS_TouchCache(cache);
+		return cache;
 	}
-	// if there was no cache
+	if (!create)
+		return NULL;
+	AAS_LockRouting();
+	// another thread may have created it in the meantime
+	cache = AAS_FindRoutingCache(list, travelflags);
 	if (!cache) {
 		cache = AAS_AllocRoutingCache(aasworld.clusters[clusternum].numreachabilityareas);
-		cache->cluster = clusternum;
-		cache->areanum = areanum;
-		VectorCopy(aasworld.areas[areanum].center, cache->origin);
-		cache->starttraveltime = 1;
-		cache->travelflags = travelflags;
-		cache->prev = NULL;
-		cache->next = clustercache;
-		if (clustercache)
-			clustercache->prev = cache;
-		aasworld.clusterareacache[clusternum][clusterareanum] = cache;
-		AAS_UpdateAreaRoutingCache(cache);
-	} else {
-		AAS_UnlinkCache(cache);
+		if (cache) {
+			cache->type = CACHETYPE_AREA;
+			cache->cluster = clusternum;
+			cache->areanum = areanum;
+			VectorCopy(aasworld.areas[areanum].center, cache->origin);
+			cache->starttraveltime = 1;
+			cache->travelflags = travelflags;
+			AAS_UpdateAreaRoutingCache(cache);
+			AAS_PublishRoutingCache(list, cache);
+			aasworld.frameroutingupdates++;
+		}
 	}
-	// the cache has been accessed
-	cache->time = AAS_RoutingTime();
-	cache->type = CACHETYPE_AREA;
-	AAS_LinkCache(cache);
+	AAS_UnlockRouting();
 	return cache;
 }
 
@@ -1303,7 +1887,9 @@ static void AAS_UpdatePortalRoutingCache(aas_routingcache_t *portalcache) {
 
 		cluster = &aasworld.clusters[curupdate->cluster];
 
-		cache = AAS_GetAreaRoutingCache(curupdate->cluster, curupdate->areanum, portalcache->travelflags);
+		cache = AAS_GetAreaRoutingCache(curupdate->cluster, curupdate->areanum, portalcache->travelflags, qtrue);
+		if (!cache)
+			continue;
 		// take all portals of the cluster
 		for (i = 0; i < cluster->numportals; i++) {
 			portalnum = aasworld.portalindex[cluster->firstportal + i];
@@ -1352,43 +1938,99 @@ static void AAS_UpdatePortalRoutingCache(aas_routingcache_t *portalcache) {
 
 // cyr}
 
-static aas_routingcache_t *AAS_GetPortalRoutingCache(int clusternum, int areanum, int travelflags) {
-	aas_routingcache_t *cache;
+static aas_routingcache_t *AAS_GetPortalRoutingCache(int clusternum, int areanum, int travelflags, int create) {
+	aas_routingcache_t *cache, **list;
 
 	// find the cached portal routing if existing
-	for (cache = aasworld.portalcache[areanum]; cache; cache = cache->next) {
-		if (cache->travelflags == travelflags)
-			break;
+	list = &aasworld.portalcache[areanum];
+	cache = AAS_FindRoutingCache(list, travelflags);
+	if (cache) {
+		// the cache has been accessed
+		AAS_TouchCache(cache);
+		return cache;
 	}
+	if (!create)
+		return NULL;
+	AAS_LockRouting();
+	cache = AAS_FindRoutingCache(list, travelflags);
 	// if the portal routing isn't cached
 	if (!cache) {
 		cache = AAS_AllocRoutingCache(aasworld.numportals);
-		cache->cluster = clusternum;
-		cache->areanum = areanum;
-		VectorCopy(aasworld.areas[areanum].center, cache->origin);
-		cache->starttraveltime = 1;
-		cache->travelflags = travelflags;
-		// add the cache to the cache list
-		cache->prev = NULL;
-		cache->next = aasworld.portalcache[areanum];
-		if (aasworld.portalcache[areanum])
-			aasworld.portalcache[areanum]->prev = cache;
-		aasworld.portalcache[areanum] = cache;
-		// update the cache
-		AAS_UpdatePortalRoutingCache(cache);
-	} else {
-		AAS_UnlinkCache(cache);
+		if (cache) {
+			cache->type = CACHETYPE_PORTAL;
+			cache->cluster = clusternum;
+			cache->areanum = areanum;
+			VectorCopy(aasworld.areas[areanum].center, cache->origin);
+			cache->starttraveltime = 1;
+			cache->travelflags = travelflags;
+			// update the cache
+			AAS_UpdatePortalRoutingCache(cache);
+			// add the cache to the cache list
+			AAS_PublishRoutingCache(list, cache);
+			aasworld.frameroutingupdates++;
+		}
 	}
-	// the cache has been accessed
-	cache->time = AAS_RoutingTime();
-	cache->type = CACHETYPE_PORTAL;
-	AAS_LinkCache(cache);
+	AAS_UnlockRouting();
 	return cache;
 }
 
+//===========================================================================
+// builds the area to portal and portal to portal travel times of every
+// portal for the travel flags the bots route with, a few msec each frame,
+// so that the first routes a bot asks for don't have to create them
+//===========================================================================
+static void AAS_PrecomputeRoutes(void) {
+	int starttime, travelflags, frameroutingupdates;
+	aas_portal_t *portal;
+
+	if (!precomputeportal || !aasworld.initialized)
+		return;
+
+	// doesn't count towards the routing updates of the frame
+	frameroutingupdates = aasworld.frameroutingupdates;
+	starttime = Sys_Milliseconds();
+	do {
+		if (precomputeportal >= aasworld.numportals) {
+			precomputeportal = 0;
+			botimport.Print(PRT_MESSAGE, "precomputed routing of %d portals, %d bytes routing cache\n",
+							aasworld.numportals - 1, routingcachesize);
+			if (precomputesave)
+				AAS_WriteRouteCache();
+			break;
+		}
+		portal = &aasworld.portals[precomputeportal];
+		travelflags = precomputetravelflags[precomputetravelflag];
+		// travel times of all areas in both clusters to the portal
+		AAS_GetAreaRoutingCache(portal->frontcluster, portal->areanum, travelflags, qtrue);
+		AAS_GetAreaRoutingCache(portal->backcluster, portal->areanum, travelflags, qtrue);
+		// travel times of all other portals to the portal
+		AAS_GetPortalRoutingCache(portal->frontcluster, portal->areanum, travelflags, qtrue);
+
+		if (++precomputetravelflag >= ARRAY_LEN(precomputetravelflags)) {
+			precomputetravelflag = 0;
+			precomputeportal++;
+		}
+	} while (Sys_Milliseconds() - starttime < precomputetime);
+	aasworld.frameroutingupdates = frameroutingupdates;
+}
+
+//===========================================================================
+// called at the start of every frame, while no route queries are running
+//===========================================================================
+void AAS_RoutingFrame(void) {
+	AAS_FlushCacheTouches();
+	// make sure the routing cache doesn't grow to large, the cache the job
+	// workers create comes from the system and is kept below max_routingcache
+	while (AvailableMemory() < MIN_ROUTINGFREEMEMORY || sysroutingcachesize > max_routingcachesize) {
+		if (!AAS_FreeOldestCache())
+			break;
+	}
+	AAS_PrecomputeRoutes();
+}
+
 static int AAS_AreaRouteToGoalArea(int areanum, vec3_t origin, int goalareanum, int travelflags, int *traveltime,
 								   int *reachnum) {
-	int clusternum, goalclusternum, portalnum, i, clusterareanum, bestreachnum;
+	int clusternum, goalclusternum, portalnum, i, clusterareanum, bestreachnum, create;
 	unsigned short int t, besttime;
 	aas_portal_t *portal;
 	aas_cluster_t *cluster;
@@ -1419,25 +2061,12 @@ static int AAS_AreaRouteToGoalArea(int areanum, vec3_t origin, int goalareanum,
 	if (!aasworld.areasettings[areanum].numreachableareas || !aasworld.areasettings[goalareanum].numreachableareas) {
 		return qfalse;
 	}
-	// make sure the routing cache doesn't grow to large
-	while (AvailableMemory() < 1 * 1024 * 1024) {
-		if (!AAS_FreeOldestCache())
-			break;
-	}
-
 	if (AAS_AreaDoNotEnter(areanum) || AAS_AreaDoNotEnter(goalareanum)) {
 		travelflags |= TFL_DONOTENTER;
 	}
-	// NOTE: the number of routing updates is limited per frame
-	/*
-	if (aasworld.frameroutingupdates > MAX_FRAMEROUTINGUPDATES)
-	{
-#ifdef DEBUG
-		//Log_Write("WARNING: AAS_AreaTravelTimeToGoalArea: frame routing updates overflowed");
-#endif
-		return 0;
-	}
-	*/
+	// NOTE: the number of routing updates is limited per frame, once they're
+	// used up the routes without cache are searched for directly
+	create = !routingastar || aasworld.frameroutingupdates < MAX_FRAMEROUTINGUPDATES;
 
 	clusternum = aasworld.areasettings[areanum].cluster;
 	goalclusternum = aasworld.areasettings[goalareanum].cluster;
@@ -1459,7 +2088,9 @@ static int AAS_AreaRouteToGoalArea(int areanum, vec3_t origin, int goalareanum,
 	// NOTE: there might be a shorter route via another cluster!!! but we don't care
 	if (clusternum > 0 && goalclusternum > 0 && clusternum == goalclusternum) {
 
-		areacache = AAS_GetAreaRoutingCache(clusternum, goalareanum, travelflags);
+		areacache = AAS_GetAreaRoutingCache(clusternum, goalareanum, travelflags, create);
+		if (!areacache)
+			return AAS_AreaRouteAStar(areanum, origin, goalareanum, travelflags, traveltime, reachnum);
 		// the number of the area in the cluster
 		clusterareanum = AAS_ClusterAreaNum(clusternum, areanum);
 		// the cluster the area is in
@@ -1490,7 +2121,9 @@ static int AAS_AreaRouteToGoalArea(int areanum, vec3_t origin, int goalareanum,
 		goalclusternum = portal->frontcluster;
 	}
 	// get the portal routing cache
-	portalcache = AAS_GetPortalRoutingCache(goalclusternum, goalareanum, travelflags);
+	portalcache = AAS_GetPortalRoutingCache(goalclusternum, goalareanum, travelflags, create);
+	if (!portalcache)
+		return AAS_AreaRouteAStar(areanum, origin, goalareanum, travelflags, traveltime, reachnum);
 	// if the area is a cluster portal, read directly from the portal cache
 	if (clusternum < 0) {
 		*traveltime = portalcache->traveltimes[-clusternum];
@@ -1511,7 +2144,9 @@ static int AAS_AreaRouteToGoalArea(int areanum, vec3_t origin, int goalareanum,
 
 		portal = &aasworld.portals[portalnum];
 		// get the cache of the portal area
-		areacache = AAS_GetAreaRoutingCache(clusternum, portal->areanum, travelflags);
+		areacache = AAS_GetAreaRoutingCache(clusternum, portal->areanum, travelflags, qtrue);
+		if (!areacache)
+			continue;
 		// current area inside the current cluster
 		clusterareanum = AAS_ClusterAreaNum(clusternum, areanum);
 		// if the area is NOT a reachability area
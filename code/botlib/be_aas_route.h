@@ -34,6 +34,8 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 void AAS_InitRouting(void);
 // free the AAS routing caches
 void AAS_FreeRoutingCaches(void);
+// applies the cache hits of all threads and frees old routing cache
+void AAS_RoutingFrame(void);
 // returns the travel time from start to end in the given area
 unsigned short int AAS_AreaTravelTime(int areanum, vec3_t start, vec3_t end);
 
@@ -162,6 +162,130 @@ void AAS_FreeAASLinkedEntities(void) {
 		FreeMemory(aasworld.arealinkedentities);
 	aasworld.arealinkedentities = NULL;
 }
+//===========================================================================
+// returns the node the box is completely in, or minus the area when the
+// box ends up in a leaf
+
+//===========================================================================
+static int AAS_BoxNode(vec3_t mins, vec3_t maxs) {
+	int nodenum, i;
+	vec_t mindist, maxdist;
+	aas_node_t *node;
+	aas_plane_t *plane;
+
+	nodenum = 1;
+	while (nodenum > 0) {
+		node = &aasworld.nodes[nodenum];
+		plane = &aasworld.planes[node->planenum];
+		// distances of the box corners nearest to and furthest along the normal
+		mindist = maxdist = -plane->dist;
+		for (i = 0; i < 3; i++) {
+			if (plane->normal[i] >= 0) {
+				mindist += plane->normal[i] * mins[i];
+				maxdist += plane->normal[i] * maxs[i];
+			} else {
+				mindist += plane->normal[i] * maxs[i];
+				maxdist += plane->normal[i] * mins[i];
+			}
+		}
+		// same sides as AAS_PointAreaNum picks for the points in the box
+		if (mindist > 0)
+			nodenum = node->children[0];
+		else if (maxdist <= 0)
+			nodenum = node->children[1];
+		else
+			break;
+	}
+	return nodenum;
+}
+
+//===========================================================================
+// builds the point to area grid with the smallest cells that fit in
+// max_aasgrid KB, cells are at least 32 units
+
+//===========================================================================
+void AAS_InitAreaGrid(void) {
+	int i, x, y, z, maxsize, cellsize, numcells, numareacells, *cell;
+	vec3_t mins, maxs, cellmins, cellmaxs;
+
+	AAS_FreeAreaGrid();
+	if (!aasworld.loaded || aasworld.numareas <= 1 || aasworld.numnodes <= 1)
+		return;
+#ifdef BSPC
+	maxsize = 2048 * 1024;
+#else
+	maxsize = 1024 * (int)LibVarValue("max_aasgrid", "2048");
+#endif
+	if (maxsize <= 0)
+		return;
+
+	ClearBounds(mins, maxs);
+	for (i = 1; i < aasworld.numareas; i++) {
+		AddPointToBounds(aasworld.areas[i].mins, mins, maxs);
+		AddPointToBounds(aasworld.areas[i].maxs, mins, maxs);
+	}
+
+	for (cellsize = 32;; cellsize *= 2) {
+		for (i = 0; i < 3; i++) {
+			aasworld.areagridsize[i] = (int)ceil((maxs[i] - mins[i]) / cellsize) + 1;
+		}
+		numcells = aasworld.areagridsize[0] * aasworld.areagridsize[1] * aasworld.areagridsize[2];
+		if (numcells <= maxsize / (int)sizeof(int))
+			break;
+	}
+	VectorCopy(mins, aasworld.areagridorigin);
+	aasworld.areagridscale = 1.0f / cellsize;
+	aasworld.areagrid = (int *)GetHunkMemory(numcells * sizeof(int));
+
+	numareacells = 0;
+	cell = aasworld.areagrid;
+	for (z = 0; z < aasworld.areagridsize[2]; z++) {
+		for (y = 0; y < aasworld.areagridsize[1]; y++) {
+			for (x = 0; x < aasworld.areagridsize[0]; x++, cell++) {
+				// a unit bigger on all sides, the cell a point is put in
+				// can be off by float rounding
+				cellmins[0] = mins[0] + x * cellsize - 1;
+				cellmins[1] = mins[1] + y * cellsize - 1;
+				cellmins[2] = mins[2] + z * cellsize - 1;
+				cellmaxs[0] = cellmins[0] + cellsize + 2;
+				cellmaxs[1] = cellmins[1] + cellsize + 2;
+				cellmaxs[2] = cellmins[2] + cellsize + 2;
+				*cell = AAS_BoxNode(cellmins, cellmaxs);
+				if (*cell <= 0)
+					numareacells++;
+			}
+		}
+	}
+	botimport.Print(PRT_MESSAGE, "area grid %dx%dx%d cells of %d units, %d KB, %d%% in one area\n",
+					aasworld.areagridsize[0], aasworld.areagridsize[1], aasworld.areagridsize[2], cellsize,
+					(int)(numcells * sizeof(int) / 1024), numareacells * 100 / numcells);
+}
+
+void AAS_FreeAreaGrid(void) {
+	if (aasworld.areagrid)
+		FreeMemory(aasworld.areagrid);
+	aasworld.areagrid = NULL;
+}
+
+//===========================================================================
+// returns the node to start the point lookup at
+
+//===========================================================================
+static ID_INLINE int AAS_AreaGridNode(vec3_t point) {
+	int i, cell[3];
+	float f;
+
+	if (!aasworld.areagrid)
+		return 1;
+	for (i = 0; i < 3; i++) {
+		f = (point[i] - aasworld.areagridorigin[i]) * aasworld.areagridscale;
+		if (f < 0 || f >= aasworld.areagridsize[i])
+			return 1;
+		cell[i] = (int)f;
+	}
+	return aasworld.areagrid[(cell[2] * aasworld.areagridsize[1] + cell[1]) * aasworld.areagridsize[0] + cell[0]];
+}
+
 //===========================================================================
 // returns the AAS area the point is in
 
@@ -177,8 +301,9 @@ int AAS_PointAreaNum(vec3_t point) {
 		return 0;
 	}
 
-	// start with node 1 because node zero is a dummy used for solid leafs
-	nodenum = 1;
+	// start with node 1 because node zero is a dummy used for solid leafs,
+	// or further down the tree at the node the grid cell of the point is in
+	nodenum = AAS_AreaGridNode(point);
 	while (nodenum > 0) {
 //		botimport.Print(PRT_MESSAGE, "[%d]", nodenum);
 #ifdef AAS_SAMPLE_DEBUG
@@ -34,6 +34,8 @@ void AAS_InitAASLinkHeap(void);
 void AAS_InitAASLinkedEntities(void);
 void AAS_FreeAASLinkHeap(void);
 void AAS_FreeAASLinkedEntities(void);
+void AAS_InitAreaGrid(void);
+void AAS_FreeAreaGrid(void);
 aas_face_t *AAS_AreaGroundFace(int areanum, vec3_t point);
 aas_face_t *AAS_TraceEndFace(aas_trace_t *trace);
 aas_plane_t *AAS_PlaneFromNum(int planenum);
@@ -132,9 +132,37 @@ typedef struct bot_matchtemplate_s {
 	int type;
 	int subtype;
 	bot_matchpiece_t *first;
+	int firstrequired; // string pieces that have to be in a message
+	int numrequired;
 	struct bot_matchtemplate_s *next;
 } bot_matchtemplate_t;
 
+// node of the automaton over the match template strings
+typedef struct bot_matchnode_s {
+	int child;	 // first child
+	int sibling; // next child of the same parent
+	int fail;	 // node of the longest proper suffix in the automaton
+	int report;	 // this or the nearest fail node with outputs, 0 if none
+	int output;	 // first output, index into matchoutputs
+	unsigned char c;
+} bot_matchnode_t;
+
+// string piece found when a node is reached
+typedef struct bot_matchoutput_s {
+	int piece;
+	int next;
+} bot_matchoutput_t;
+
+// matches of recent messages, every bot gets the same console messages
+#define MATCHCACHE_SIZE 64
+
+typedef struct bot_matchcache_s {
+	int valid;
+	int found;
+	unsigned long int context;
+	bot_match_t match;
+} bot_matchcache_t;
+
 // reply chat key
 typedef struct bot_replychatkey_s {
 	int flags;
@@ -187,6 +215,14 @@ static bot_consolemessage_t *consolemessageheap = NULL;
 static bot_consolemessage_t *freeconsolemessages = NULL;
 // list with match strings
 static bot_matchtemplate_t *matchtemplates = NULL;
+// the match template strings compiled into an Aho-Corasick automaton
+static bot_matchnode_t *matchnodes = NULL;
+static int matchrootgoto[256];
+static bot_matchoutput_t *matchoutputs = NULL;
+// message the pieces were last found in
+static int *matchpiecestamp = NULL;
+static int matchstamp;
+static bot_matchcache_t matchcache[MATCHCACHE_SIZE];
 // list with synonyms
 static bot_synonymlist_t *synonyms = NULL;
 // list with random strings
@@ -511,7 +547,7 @@ static bot_synonymlist_t *BotLoadSynonyms(const char *filename) {
 			ptr = (char *)GetClearedHunkMemory(size);
 
 		PC_SetBaseFolder(BOTFILESBASEFOLDER);
-		source = LoadSourceFile(filename);
+		source = LoadCachedSourceFile(filename);
 		if (!source) {
 			botimport.Print(PRT_ERROR, "couldn't load %s\n", filename);
 			return NULL;
@@ -816,7 +852,7 @@ static bot_randomlist_t *BotLoadRandomStrings(const char *filename) {
 			ptr = (char *)GetClearedHunkMemory(size);
 
 		PC_SetBaseFolder(BOTFILESBASEFOLDER);
-		source = LoadSourceFile(filename);
+		source = LoadCachedSourceFile(filename);
 		if (!source) {
 			botimport.Print(PRT_ERROR, "couldn't load %s\n", filename);
 			return NULL;
@@ -1065,7 +1101,7 @@ static bot_matchtemplate_t *BotLoadMatchTemplates(const char *matchfile) {
 	unsigned long int context;
 
 	PC_SetBaseFolder(BOTFILESBASEFOLDER);
-	source = LoadSourceFile(matchfile);
+	source = LoadCachedSourceFile(matchfile);
 	if (!source) {
 		botimport.Print(PRT_ERROR, "couldn't load %s\n", matchfile);
 		return NULL;
@@ -1202,19 +1238,191 @@ static int StringsMatch(bot_matchpiece_t *pieces, bot_match_t *match) {
 	return qfalse;
 }
 
+static void BotFreeMatchAutomaton(void) {
+	if (matchnodes)
+		FreeMemory(matchnodes);
+	matchnodes = NULL;
+	if (matchoutputs)
+		FreeMemory(matchoutputs);
+	matchoutputs = NULL;
+	if (matchpiecestamp)
+		FreeMemory(matchpiecestamp);
+	matchpiecestamp = NULL;
+	Com_Memset(matchcache, 0, sizeof(matchcache));
+}
+
+static int BotMatchNodeChild(int node, unsigned char c) {
+	int child;
+
+	for (child = matchnodes[node].child; child; child = matchnodes[child].sibling) {
+		if (matchnodes[child].c == c)
+			return child;
+	}
+	return 0;
+}
+
+// builds the automaton over the strings of the match templates, the
+// string pieces without an empty alternative have to be found in a
+// message for the template to match
+static void BotCompileMatchTemplates(bot_matchtemplate_t *matches) {
+	bot_matchtemplate_t *mt;
+	bot_matchpiece_t *mp;
+	bot_matchstring_t *ms;
+	int numchars, numstrings, numpieces, numnodes, numoutputs, numrequired;
+	int node, child, fail, head, tail, *queue;
+	unsigned char c;
+	const char *ptr;
+
+	BotFreeMatchAutomaton();
+	// count the required pieces and their strings
+	numchars = numstrings = numpieces = 0;
+	for (mt = matches; mt; mt = mt->next) {
+		for (mp = mt->first; mp; mp = mp->next) {
+			if (mp->type != MT_STRING)
+				continue;
+			for (ms = mp->firststring; ms; ms = ms->next) {
+				if (!*ms->string)
+					break;
+			}
+			if (ms)
+				continue;
+			for (ms = mp->firststring; ms; ms = ms->next) {
+				numchars += strlen(ms->string);
+				numstrings++;
+			}
+			numpieces++;
+		}
+	}
+	matchnodes = (bot_matchnode_t *)GetClearedMemory((numchars + 1) * sizeof(bot_matchnode_t));
+	matchoutputs = (bot_matchoutput_t *)GetClearedMemory((numstrings + 1) * sizeof(bot_matchoutput_t));
+	matchpiecestamp = (int *)GetClearedMemory((numpieces + 1) * sizeof(int));
+	matchstamp = 0;
+	// add the strings to the trie, case insensitive like StringContains
+	numnodes = 1;
+	numoutputs = 1;
+	numrequired = 0;
+	for (mt = matches; mt; mt = mt->next) {
+		mt->firstrequired = numrequired;
+		for (mp = mt->first; mp; mp = mp->next) {
+			if (mp->type != MT_STRING)
+				continue;
+			for (ms = mp->firststring; ms; ms = ms->next) {
+				if (!*ms->string)
+					break;
+			}
+			if (ms)
+				continue;
+			for (ms = mp->firststring; ms; ms = ms->next) {
+				node = 0;
+				for (ptr = ms->string; *ptr; ptr++) {
+					c = tolower(*(const unsigned char *)ptr);
+					child = BotMatchNodeChild(node, c);
+					if (!child) {
+						child = numnodes++;
+						matchnodes[child].c = c;
+						matchnodes[child].sibling = matchnodes[node].child;
+						matchnodes[node].child = child;
+					}
+					node = child;
+				}
+				matchoutputs[numoutputs].piece = numrequired;
+				matchoutputs[numoutputs].next = matchnodes[node].output;
+				matchnodes[node].output = numoutputs++;
+			}
+			numrequired++;
+		}
+		mt->numrequired = numrequired - mt->firstrequired;
+	}
+	// the fail links in breadth first order
+	queue = (int *)GetMemory(numnodes * sizeof(int));
+	Com_Memset(matchrootgoto, 0, sizeof(matchrootgoto));
+	head = tail = 0;
+	for (child = matchnodes[0].child; child; child = matchnodes[child].sibling) {
+		matchrootgoto[matchnodes[child].c] = child;
+		matchnodes[child].fail = 0;
+		matchnodes[child].report = matchnodes[child].output ? child : 0;
+		queue[tail++] = child;
+	}
+	while (head < tail) {
+		node = queue[head++];
+		for (child = matchnodes[node].child; child; child = matchnodes[child].sibling) {
+			c = matchnodes[child].c;
+			for (fail = matchnodes[node].fail; fail && !BotMatchNodeChild(fail, c); fail = matchnodes[fail].fail)
+				;
+			fail = fail ? BotMatchNodeChild(fail, c) : matchrootgoto[c];
+			matchnodes[child].fail = fail;
+			matchnodes[child].report = matchnodes[child].output ? child : matchnodes[fail].report;
+			queue[tail++] = child;
+		}
+	}
+	FreeMemory(queue);
+}
+
+// marks the required pieces with a string in the message
+static void BotMatchPiecesInString(const char *str) {
+	int node, next, report, output;
+	unsigned char c;
+
+	matchstamp++;
+	node = 0;
+	for (; *str; str++) {
+		c = tolower(*(const unsigned char *)str);
+		for (next = 0; node; node = matchnodes[node].fail) {
+			next = BotMatchNodeChild(node, c);
+			if (next)
+				break;
+		}
+		node = next ? next : matchrootgoto[c];
+		for (report = matchnodes[node].report; report; report = matchnodes[matchnodes[report].fail].report) {
+			for (output = matchnodes[report].output; output; output = matchoutputs[output].next)
+				matchpiecestamp[matchoutputs[output].piece] = matchstamp;
+		}
+	}
+}
+
+static int BotMatchCacheHash(const char *str, unsigned long int context) {
+	unsigned int hash;
+
+	for (hash = context; *str; str++)
+		hash = hash * 31 + *(const unsigned char *)str;
+	return (hash ^ (hash >> 16)) & (MATCHCACHE_SIZE - 1);
+}
+
 int BotFindMatch(const char *str, bot_match_t *match, unsigned long int context) {
 	int i;
 	bot_matchtemplate_t *ms;
+	bot_matchcache_t *cache;
 
 	Q_strncpyz(match->string, str, sizeof(match->string));
 	// remove any trailing enters
 	while (strlen(match->string) && match->string[strlen(match->string) - 1] == '\n') {
 		match->string[strlen(match->string) - 1] = '\0';
 	}
+	// the other bots often just matched the same message
+	cache = &matchcache[BotMatchCacheHash(match->string, context)];
+	if (cache->valid && cache->context == context && !strcmp(cache->match.string, match->string)) {
+		*match = cache->match;
+		return cache->found;
+	}
+	cache->valid = qtrue;
+	cache->context = context;
+	cache->found = qfalse;
+	// find the template strings in the message in one go
+	if (matchnodes)
+		BotMatchPiecesInString(match->string);
 	// compare the string with all the match strings
 	for (ms = matchtemplates; ms; ms = ms->next) {
 		if (!(ms->context & context))
 			continue;
+		// skip the templates with a piece that isn't in the message
+		if (matchnodes) {
+			for (i = 0; i < ms->numrequired; i++) {
+				if (matchpiecestamp[ms->firstrequired + i] != matchstamp)
+					break;
+			}
+			if (i < ms->numrequired)
+				continue;
+		}
 		// reset the match variable offsets
 		for (i = 0; i < MAX_MATCHVARIABLES; i++)
 			match->variables[i].offset = -1;
@@ -1222,9 +1430,12 @@ int BotFindMatch(const char *str, bot_match_t *match, unsigned long int context)
 		if (StringsMatch(ms->first, match)) {
 			match->type = ms->type;
 			match->subtype = ms->subtype;
+			cache->found = qtrue;
+			cache->match = *match;
 			return qtrue;
 		}
 	}
+	cache->match = *match;
 	return qfalse;
 }
 
@@ -1527,7 +1738,7 @@ static bot_replychat_t *BotLoadReplyChat(const char *filename) {
 	bot_replychatkey_t *key;
 
 	PC_SetBaseFolder(BOTFILESBASEFOLDER);
-	source = LoadSourceFile(filename);
+	source = LoadCachedSourceFile(filename);
 	if (!source) {
 		botimport.Print(PRT_ERROR, "couldn't load %s\n", filename);
 		return NULL;
@@ -1707,7 +1918,7 @@ static bot_chat_t *BotLoadInitialChat(const char *chatfile, const char *chatname
 			ptr = (char *)GetClearedMemory(size);
 		// load the source file
 		PC_SetBaseFolder(BOTFILESBASEFOLDER);
-		source = LoadSourceFile(chatfile);
+		source = LoadCachedSourceFile(chatfile);
 		if (!source) {
 			botimport.Print(PRT_ERROR, "couldn't load %s\n", chatfile);
 			return NULL;
@@ -2497,6 +2708,7 @@ int BotSetupChatAI(void) {
 	file = LibVarString("matchfile", "match.c");
 	matchtemplates = BotLoadMatchTemplates(file);
 #endif
+	BotCompileMatchTemplates(matchtemplates);
 
 	InitConsoleMessageHeap();
 
@@ -2529,6 +2741,7 @@ void BotShutdownChatAI(void) {
 	if (matchtemplates)
 		BotFreeMatchTemplates(matchtemplates);
 	matchtemplates = NULL;
+	BotFreeMatchAutomaton();
 	if (randomstrings)
 		FreeMemory(randomstrings);
 	randomstrings = NULL;
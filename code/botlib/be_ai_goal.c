@@ -269,7 +269,7 @@ itemconfig_t *LoadItemConfig(const char *filename) {
 
 	Q_strncpyz(path, filename, sizeof(path));
 	PC_SetBaseFolder(BOTFILESBASEFOLDER);
-	source = LoadSourceFile(path);
+	source = LoadCachedSourceFile(path);
 	if (!source) {
 		botimport.Print(PRT_ERROR, "couldn't load %s\n", path);
 		return NULL;
@@ -269,7 +269,7 @@ weightconfig_t *ReadWeightConfig(const char *filename) {
 	}
 
 	PC_SetBaseFolder(BOTFILESBASEFOLDER);
-	source = LoadSourceFile(filename);
+	source = LoadCachedSourceFile(filename);
 	if (!source) {
 		botimport.Print(PRT_ERROR, "couldn't load %s\n", filename);
 		return NULL;
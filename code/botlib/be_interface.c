@@ -246,6 +246,14 @@ static int Export_BotLibUpdateEntity(int ent, bot_entitystate_t *state) {
 	return AAS_UpdateEntity(ent, state);
 }
 
+static int Export_BotLibUpdateEntities(int numEntities, const byte *live, int numChanged, const int *changed,
+									   bot_entitystate_t *states) {
+	if (!BotLibSetup("BotUpdateEntities"))
+		return BLERR_LIBRARYNOTSETUP;
+
+	return AAS_UpdateEntities(numEntities, live, numChanged, changed, states);
+}
+
 void AAS_TestMovementPrediction(int entnum, vec3_t origin, vec3_t dir);
 void ElevatorBottomCenter(aas_reachability_t *reach, vec3_t bottomcenter);
 int BotGetReachabilityToGoal(vec3_t origin, int areanum, int lastgoalareanum, int lastareanum, int *avoidreach,
@@ -794,6 +802,7 @@ botlib_export_t *GetBotLibAPI(int apiVersion, botlib_import_t *import) {
 	be_botlib_export.BotLibStartFrame = Export_BotLibStartFrame;
 	be_botlib_export.BotLibLoadMap = Export_BotLibLoadMap;
 	be_botlib_export.BotLibUpdateEntity = Export_BotLibUpdateEntity;
+	be_botlib_export.BotLibUpdateEntities = Export_BotLibUpdateEntities;
 	be_botlib_export.Test = BotExportTest;
 
 	return &be_botlib_export;
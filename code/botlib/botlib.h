@@ -77,6 +77,7 @@ struct weaponinfo_s;
 #define BLERR_CANNOTLOADITEMCONFIG 10	 // cannot load item config
 #define BLERR_CANNOTLOADWEAPONWEIGHTS 11 // cannot load weapon weights
 #define BLERR_CANNOTLOADWEAPONCONFIG 12	 // cannot load weapon config
+#define BLERR_ENTITYSTATEMISSING 13		 // entity kept without ever being updated
 
 // action flags
 #define ACTION_ATTACK 0x00000001
@@ -420,6 +421,9 @@ typedef struct botlib_export_s {
 	int (*BotLibLoadMap)(const char *mapname);
 	// entity updates
 	int (*BotLibUpdateEntity)(int ent, bot_entitystate_t *state);
+	// entity updates for a frame, only the changed entities carry a state
+	int (*BotLibUpdateEntities)(int numEntities, const byte *live, int numChanged, const int *changed,
+								bot_entitystate_t *states);
 	// just for testing
 	int (*Test)(int parm0, char *parm1, vec3_t parm2, vec3_t parm3);
 } botlib_export_t;
@@ -254,21 +254,168 @@ void DumpMemory(void) {
 
 #else
 
+// small blocks are handed out from pools of fixed size blocks, the script,
+// precompiler and chat code allocate and free lots of tokens and strings
+#define POOL_ID 0x5ab1e
+#define POOL_PAGE_SIZE (64 * 1024)
+#define POOL_MAX_BLOCK 2048
+#define POOL_GRANULE 8
+#define POOL_NUM_CLASSES 15
+
+// in front of every block, size is the offset from the page for pool blocks
+typedef struct memoryheader_s {
+	int id;
+	int size;
+} memoryheader_t;
+
+typedef struct memorypage_s {
+	struct memorypage_s *next, *prev; // pages of the class with free blocks
+	memoryheader_t *freeblocks;		  // linked through the block data
+	int numfree;
+	int poolclass;
+} memorypage_t;
+
+typedef struct memorypool_s {
+	int blocksize; // including the header
+	int blocksperpage;
+	memorypage_t *partial;
+	int numpages;
+	int used;
+	int peak;
+	int allocs;
+} memorypool_t;
+
+// a class for every half power of two, a token_t fits the 1536 byte blocks
+static const int poolblocksizes[POOL_NUM_CLASSES] = {16,  24,  32,	48,	 64,   96,	 128, 192,
+													 256, 384, 512, 768, 1024, 1536, POOL_MAX_BLOCK};
+static memorypool_t pools[POOL_NUM_CLASSES];
+static byte poolclassforsize[POOL_MAX_BLOCK / POOL_GRANULE];
+
+static int zoneblocks, zonebytes;
+
+static void InitMemoryPools(void) {
+	memorypool_t *pool;
+	int i, c;
+
+	for (i = 0, c = 0; i < ARRAY_LEN(poolclassforsize); i++) {
+		while ((i + 1) * POOL_GRANULE > poolblocksizes[c])
+			c++;
+		poolclassforsize[i] = c;
+	}
+
+	for (c = 0, pool = pools; c < POOL_NUM_CLASSES; c++, pool++) {
+		pool->blocksize = poolblocksizes[c];
+		pool->blocksperpage = (POOL_PAGE_SIZE - PAD(sizeof(memorypage_t), POOL_GRANULE)) / pool->blocksize;
+	}
+}
+
+static memoryheader_t *GetPoolBlock(int size) {
+	memorypool_t *pool;
+	memorypage_t *page;
+	memoryheader_t *block;
+	byte *ptr;
+	int i;
+
+	if (!pools[0].blocksize)
+		InitMemoryPools();
+
+	pool = &pools[poolclassforsize[(size - 1) / POOL_GRANULE]];
+
+	page = pool->partial;
+	if (!page) {
+		page = botimport.GetMemory(POOL_PAGE_SIZE);
+		if (!page)
+			return NULL;
+		page->next = page->prev = NULL;
+		page->poolclass = pool - pools;
+		page->numfree = pool->blocksperpage;
+		page->freeblocks = NULL;
+
+		ptr = (byte *)page + PAD(sizeof(memorypage_t), POOL_GRANULE) + (pool->blocksperpage - 1) * pool->blocksize;
+		for (i = 0; i < pool->blocksperpage; i++, ptr -= pool->blocksize) {
+			block = (memoryheader_t *)ptr;
+			block->id = 0;
+			*(memoryheader_t **)(block + 1) = page->freeblocks;
+			page->freeblocks = block;
+		}
+
+		pool->partial = page;
+		pool->numpages++;
+	}
+
+	block = page->freeblocks;
+	page->freeblocks = *(memoryheader_t **)(block + 1);
+	if (!--page->numfree) {
+		// full pages are only found again through their blocks
+		pool->partial = page->next;
+		if (page->next)
+			page->next->prev = NULL;
+		page->next = NULL;
+	}
+
+	block->id = POOL_ID;
+	block->size = (byte *)block - (byte *)page;
+
+	if (++pool->used > pool->peak)
+		pool->peak = pool->used;
+	pool->allocs++;
+
+	return block;
+}
+
+static void FreePoolBlock(memoryheader_t *block) {
+	memorypage_t *page = (memorypage_t *)((byte *)block - block->size);
+	memorypool_t *pool = &pools[page->poolclass];
+
+	block->id = 0;
+	*(memoryheader_t **)(block + 1) = page->freeblocks;
+	page->freeblocks = block;
+	pool->used--;
+
+	if (page->numfree++ == 0) {
+		page->prev = NULL;
+		page->next = pool->partial;
+		if (pool->partial)
+			pool->partial->prev = page;
+		pool->partial = page;
+	}
+
+	// give completely empty pages back, but keep one around
+	if (page->numfree == pool->blocksperpage && pool->numpages > 1) {
+		if (page->prev)
+			page->prev->next = page->next;
+		else
+			pool->partial = page->next;
+		if (page->next)
+			page->next->prev = page->prev;
+		pool->numpages--;
+		botimport.FreeMemory(page);
+	}
+}
+
 #ifdef MEMDEBUG
 void *GetMemoryDebug(unsigned long size, char *label, char *file, int line)
 #else
 void *GetMemory(unsigned long size)
 #endif // MEMDEBUG
 {
-	void *ptr;
-	unsigned long int *memid;
+	memoryheader_t *block;
 
-	ptr = botimport.GetMemory(size + sizeof(unsigned long int));
-	if (!ptr)
+	if (size <= POOL_MAX_BLOCK - sizeof(memoryheader_t)) {
+		block = GetPoolBlock(size + sizeof(memoryheader_t));
+		if (!block)
+			return NULL;
+		return block + 1;
+	}
+
+	block = botimport.GetMemory(size + sizeof(memoryheader_t));
+	if (!block)
 		return NULL;
-	memid = (unsigned long int *)ptr;
-	*memid = MEM_ID;
-	return (unsigned long int *)((char *)ptr + sizeof(unsigned long int));
+	block->id = MEM_ID;
+	block->size = size + sizeof(memoryheader_t);
+	zoneblocks++;
+	zonebytes += block->size;
+	return block + 1;
 }
 
 #ifdef MEMDEBUG
@@ -293,15 +440,14 @@ void *GetHunkMemoryDebug(unsigned long size, char *label, char *file, int line)
 void *GetHunkMemory(unsigned long size)
 #endif // MEMDEBUG
 {
-	void *ptr;
-	unsigned long int *memid;
+	memoryheader_t *block;
 
-	ptr = botimport.HunkAlloc(size + sizeof(unsigned long int));
-	if (!ptr)
+	block = botimport.HunkAlloc(size + sizeof(memoryheader_t));
+	if (!block)
 		return NULL;
-	memid = (unsigned long int *)ptr;
-	*memid = HUNK_ID;
-	return (unsigned long int *)((char *)ptr + sizeof(unsigned long int));
+	block->id = HUNK_ID;
+	block->size = size + sizeof(memoryheader_t);
+	return block + 1;
 }
 
 #ifdef MEMDEBUG
@@ -321,12 +467,16 @@ void *GetClearedHunkMemory(unsigned long size)
 }
 
 void FreeMemory(void *ptr) {
-	unsigned long int *memid;
+	memoryheader_t *block;
 
-	memid = (unsigned long int *)((char *)ptr - sizeof(unsigned long int));
+	block = (memoryheader_t *)ptr - 1;
 
-	if (*memid == MEM_ID) {
-		botimport.FreeMemory(memid);
+	if (block->id == POOL_ID) {
+		FreePoolBlock(block);
+	} else if (block->id == MEM_ID) {
+		zoneblocks--;
+		zonebytes -= block->size;
+		botimport.FreeMemory(block);
 	}
 }
 
@@ -335,6 +485,20 @@ int AvailableMemory(void) {
 }
 
 void PrintUsedMemorySize(void) {
+	memorypool_t *pool;
+	int c, poolbytes, usedbytes;
+
+	poolbytes = usedbytes = 0;
+	for (c = 0, pool = pools; c < POOL_NUM_CLASSES; c++, pool++) {
+		if (!pool->allocs)
+			continue;
+		botimport.Print(PRT_MESSAGE, "pool %4d bytes: %5d used, %5d peak, %8d allocs, %3d pages\n", pool->blocksize,
+						pool->used, pool->peak, pool->allocs, pool->numpages);
+		poolbytes += pool->numpages * POOL_PAGE_SIZE;
+		usedbytes += pool->used * pool->blocksize;
+	}
+	botimport.Print(PRT_MESSAGE, "pooled memory: %d KB in use of %d KB\n", usedbytes >> 10, poolbytes >> 10);
+	botimport.Print(PRT_MESSAGE, "zone memory: %d KB in %d blocks\n", zonebytes >> 10, zoneblocks);
 }
 
 void PrintMemoryLabels(void) {
@@ -117,6 +117,107 @@ token_t *freetokens;					//free tokens from the heap
 // list with global defines added to every source loaded
 static define_t *globaldefines;
 
+#ifdef BOTLIB
+// Bot character, chat, weight and item files are run through the precompiler
+// every time a bot is loaded. The first load records the tokens a file expands
+// to, later loads only check that the file and its includes did not change and
+// replay the recorded tokens. The cache lives in zone memory so it is kept
+// across map changes.
+
+#define MAX_CACHEDSOURCEFILES 16
+#define MAX_SOURCECACHESIZE 0x200000
+
+#define HASH_INIT_VALUE 2166136261u
+#define HASH_PRIME 16777619u
+
+typedef struct cachedfile_s {
+	char filename[MAX_QPATH]; // file name the script was loaded with
+	int length;				  // length of the file in bytes
+	unsigned int hash;		  // hash of the file contents
+} cachedfile_t;
+
+typedef struct cachedtoken_s {
+	int string;					// offset of the token string in the string pool
+	int type;					// token type
+	int subtype;				// token sub type
+	unsigned long int intvalue; // integer value
+	float floatvalue;			// floating point value
+	int line;					// line the token was on
+	int scriptline;				// line of the script after reading the token
+	int file;					// cached file the token was read from
+} cachedtoken_t;
+
+typedef struct sourcecache_s {
+	char filename[MAX_QPATH];				   // file name the source was loaded with
+	char basefolder[MAX_QPATH];				   // base folder the source was loaded from
+	unsigned int defineshash;				   // hash of the global defines
+	int numfiles;							   // number of files read
+	cachedfile_t files[MAX_CACHEDSOURCEFILES]; // the source file followed by its includes
+	int numtokens;							   // number of tokens
+	cachedtoken_t *tokens;					   // preprocessed tokens
+	char *strings;							   // token strings
+	int size;								   // allocated size in bytes
+	int refs;								   // number of sources replaying the cache
+	int linked;								   // true when in the cache list
+	struct sourcecache_s *prev, *next;		   // cache list, most recently used first
+} sourcecache_t;
+
+static char pc_basefolder[MAX_QPATH];
+static sourcecache_t *sourcecache;
+static int sourcecachesize;
+// source that is being recorded
+static source_t *recordsource;
+static sourcecache_t recordcache;
+static script_t *recordscripts[MAX_CACHEDSOURCEFILES];
+static int recordfailed;
+// number of errors and warnings printed so far
+static int numdiagnostics;
+
+static unsigned int PC_HashData(const char *data, int length, unsigned int hash) {
+	int i;
+
+	for (i = 0; i < length; i++) {
+		hash ^= (unsigned char)data[i];
+		hash *= HASH_PRIME;
+	}
+	return hash;
+}
+
+static int PC_RecordedScript(const script_t *script) {
+	int i;
+
+	for (i = 0; i < recordcache.numfiles; i++) {
+		if (recordscripts[i] == script)
+			return i;
+	}
+	return 0;
+}
+
+static void PC_RecordScript(script_t *script) {
+	int i, n;
+
+	n = recordcache.numfiles;
+	for (i = 0; i < recordcache.numfiles; i++) {
+		// an earlier script may have been freed and its memory reused
+		if (recordscripts[i] == script)
+			recordscripts[i] = NULL;
+		if (!Q_stricmp(recordcache.files[i].filename, script->filename))
+			n = i;
+	}
+	if (n >= MAX_CACHEDSOURCEFILES || strlen(script->filename) >= MAX_QPATH) {
+		recordfailed = qtrue;
+		return;
+	}
+	recordscripts[n] = script;
+	if (n < recordcache.numfiles)
+		return;
+	Q_strncpyz(recordcache.files[n].filename, script->filename, sizeof(recordcache.files[n].filename));
+	recordcache.files[n].length = script->length;
+	recordcache.files[n].hash = PC_HashData(script->buffer, script->length, HASH_INIT_VALUE);
+	recordcache.numfiles++;
+}
+#endif // BOTLIB
+
 void QDECL SourceError(source_t *source, const char *fmt, ...) {
 	char text[1024];
 	va_list ap;
@@ -125,6 +226,7 @@ void QDECL SourceError(source_t *source, const char *fmt, ...) {
 	Q_vsnprintf(text, sizeof(text), fmt, ap);
 	va_end(ap);
 #ifdef BOTLIB
+	numdiagnostics++;
 	botimport.Print(PRT_ERROR, "file %s, line %d: %s\n", source->scriptstack->filename, source->scriptstack->line,
 					text);
 #endif // BOTLIB
@@ -146,6 +248,7 @@ void QDECL SourceWarning(source_t *source, const char *fmt, ...) {
 	Q_vsnprintf(text, sizeof(text), fmt, ap);
 	va_end(ap);
 #ifdef BOTLIB
+	numdiagnostics++;
 	botimport.Print(PRT_WARNING, "file %s, line %d: %s\n", source->scriptstack->filename, source->scriptstack->line,
 					text);
 #endif // BOTLIB
@@ -202,6 +305,10 @@ static void PC_PushScript(source_t *source, script_t *script) {
 	// push the script on the script stack
 	script->next = source->scriptstack;
 	source->scriptstack = script;
+#ifdef BOTLIB
+	if (source == recordsource)
+		PC_RecordScript(script);
+#endif // BOTLIB
 }
 
 static void PC_InitTokenHeap(void) {
@@ -266,6 +373,12 @@ static int PC_ReadSourceToken(source_t *source, token_t *token) {
 				PC_PopIndent(source, &type, &skip);
 			}
 		}
+#ifdef BOTLIB
+		// an included script that could not be read up to the end
+		else if (source == recordsource) {
+			recordfailed = qtrue;
+		}
+#endif // BOTLIB
 		// if this was the initial script
 		if (!source->scriptstack->next)
 			return qfalse;
@@ -2250,9 +2363,51 @@ int QuakeCMacro(source_t *source) {
 }
 #endif // QUAKEC
 
+#ifdef BOTLIB
+static int PC_ReadCachedToken(source_t *source, token_t *token) {
+	const sourcecache_t *cache;
+	const cachedtoken_t *t;
+
+	cache = source->cache;
+	// tokens unread by the caller come first
+	if (source->tokens) {
+		PC_ReadSourceToken(source, token);
+	} else {
+		if (source->cachetoken >= cache->numtokens) {
+			Com_Memset(token, 0, sizeof(token_t));
+			return qfalse;
+		}
+		t = &cache->tokens[source->cachetoken++];
+		Q_strncpyz(token->string, cache->strings + t->string, sizeof(token->string));
+		token->type = t->type;
+		token->subtype = t->subtype;
+		token->intvalue = t->intvalue;
+		token->floatvalue = t->floatvalue;
+		token->whitespace_p = NULL;
+		token->endwhitespace_p = NULL;
+		token->line = t->line;
+		token->linescrossed = 0;
+		token->next = NULL;
+		// keep the script stack pointing at the token for error messages
+		if (t->file != source->cachefile) {
+			Q_strncpyz(source->scriptstack->filename, cache->files[t->file].filename,
+					   sizeof(source->scriptstack->filename));
+			source->cachefile = t->file;
+		}
+		source->scriptstack->line = t->scriptline;
+	}
+	Com_Memcpy(&source->token, token, sizeof(token_t));
+	return qtrue;
+}
+#endif // BOTLIB
+
 int PC_ReadToken(source_t *source, token_t *token) {
 	define_t *define;
 
+#ifdef BOTLIB
+	if (source->cache)
+		return PC_ReadCachedToken(source, token);
+#endif // BOTLIB
 	while (1) {
 		if (!PC_ReadSourceToken(source, token))
 			return qfalse;
@@ -2461,6 +2616,206 @@ void PC_SetPunctuations(source_t *source, punctuation_t *p) {
 	source->punctuations = p;
 }
 
+#ifdef BOTLIB
+static unsigned int PC_GlobalDefinesHash(void) {
+	define_t *define;
+	token_t *token;
+	unsigned int hash;
+
+	hash = HASH_INIT_VALUE;
+	for (define = globaldefines; define; define = define->next) {
+		hash = PC_HashData(define->name, strlen(define->name) + 1, hash);
+		for (token = define->parms; token; token = token->next)
+			hash = PC_HashData(token->string, strlen(token->string) + 1, hash);
+		for (token = define->tokens; token; token = token->next)
+			hash = PC_HashData(token->string, strlen(token->string) + 1, hash);
+	}
+	return hash;
+}
+
+static void PC_ReleaseSourceCache(sourcecache_t *cache) {
+	cache->refs--;
+	if (!cache->refs && !cache->linked)
+		FreeMemory(cache);
+}
+
+static void PC_UnlinkSourceCache(sourcecache_t *cache) {
+	if (cache->prev)
+		cache->prev->next = cache->next;
+	else
+		sourcecache = cache->next;
+	if (cache->next)
+		cache->next->prev = cache->prev;
+	sourcecachesize -= cache->size;
+	cache->linked = qfalse;
+}
+
+static void PC_RemoveSourceCache(sourcecache_t *cache) {
+	PC_UnlinkSourceCache(cache);
+	if (!cache->refs)
+		FreeMemory(cache);
+}
+
+static void PC_LinkSourceCache(sourcecache_t *cache) {
+	sourcecache_t *last;
+
+	if (cache->size > MAX_SOURCECACHESIZE)
+		return;
+	// drop the least recently used sources until the new one fits
+	while (sourcecache && sourcecachesize + cache->size > MAX_SOURCECACHESIZE) {
+		for (last = sourcecache; last->next; last = last->next)
+			;
+		PC_RemoveSourceCache(last);
+	}
+	cache->prev = NULL;
+	cache->next = sourcecache;
+	if (sourcecache)
+		sourcecache->prev = cache;
+	sourcecache = cache;
+	sourcecachesize += cache->size;
+	cache->linked = qtrue;
+}
+
+static int PC_SourceCacheChanged(const sourcecache_t *cache, const script_t *script) {
+	script_t *include;
+	int i, changed;
+
+	if (cache->files[0].length != script->length ||
+		cache->files[0].hash != PC_HashData(script->buffer, script->length, HASH_INIT_VALUE))
+		return qtrue;
+	for (i = 1; i < cache->numfiles; i++) {
+		include = LoadScriptFile(cache->files[i].filename);
+		if (!include)
+			return qtrue;
+		changed = cache->files[i].length != include->length ||
+				  cache->files[i].hash != PC_HashData(include->buffer, include->length, HASH_INIT_VALUE);
+		FreeScript(include);
+		if (changed)
+			return qtrue;
+	}
+	return qfalse;
+}
+
+static sourcecache_t *PC_FindSourceCache(const source_t *source, unsigned int defineshash) {
+	sourcecache_t *cache;
+
+	for (cache = sourcecache; cache; cache = cache->next) {
+		if (cache->defineshash != defineshash)
+			continue;
+		if (Q_stricmp(cache->filename, source->filename) || Q_stricmp(cache->basefolder, pc_basefolder))
+			continue;
+		if (PC_SourceCacheChanged(cache, source->scriptstack)) {
+			PC_RemoveSourceCache(cache);
+			return NULL;
+		}
+		// move to the front of the list
+		PC_UnlinkSourceCache(cache);
+		PC_LinkSourceCache(cache);
+		return cache;
+	}
+	return NULL;
+}
+
+// reads the whole source and stores the resulting tokens, complete is set
+// when the source was read up to the end without errors or warnings
+static sourcecache_t *PC_RecordSource(source_t *source, int *complete) {
+	cachedtoken_t *tokens, *newtokens, *t;
+	char *strings, *newstrings;
+	int numtokens, maxtokens, stringsize, maxstringsize, length, diagnostics;
+	sourcecache_t *cache;
+	token_t token;
+
+	Com_Memset(&recordcache, 0, sizeof(recordcache));
+	Com_Memset(recordscripts, 0, sizeof(recordscripts));
+	recordfailed = qfalse;
+	recordsource = source;
+	PC_RecordScript(source->scriptstack);
+	diagnostics = numdiagnostics;
+
+	tokens = NULL;
+	strings = NULL;
+	numtokens = maxtokens = 0;
+	stringsize = maxstringsize = 0;
+	while (PC_ReadToken(source, &token)) {
+		if (numtokens >= maxtokens) {
+			maxtokens = maxtokens ? maxtokens * 2 : 1024;
+			newtokens = (cachedtoken_t *)GetMemory(maxtokens * sizeof(cachedtoken_t));
+			if (tokens) {
+				Com_Memcpy(newtokens, tokens, numtokens * sizeof(cachedtoken_t));
+				FreeMemory(tokens);
+			}
+			tokens = newtokens;
+		}
+		length = strlen(token.string) + 1;
+		if (stringsize + length > maxstringsize) {
+			maxstringsize = maxstringsize ? maxstringsize * 2 : 8192;
+			newstrings = (char *)GetMemory(maxstringsize);
+			if (strings) {
+				Com_Memcpy(newstrings, strings, stringsize);
+				FreeMemory(strings);
+			}
+			strings = newstrings;
+		}
+		t = &tokens[numtokens++];
+		t->string = stringsize;
+		Com_Memcpy(strings + stringsize, token.string, length);
+		stringsize += length;
+		t->type = token.type;
+		t->subtype = token.subtype;
+		t->intvalue = token.intvalue;
+		t->floatvalue = token.floatvalue;
+		t->line = token.line;
+		t->scriptline = source->scriptstack->line;
+		t->file = PC_RecordedScript(source->scriptstack);
+	}
+	recordsource = NULL;
+
+	*complete = !recordfailed && numdiagnostics == diagnostics && !source->scriptstack->next &&
+				EndOfScript(source->scriptstack) && !source->indentstack;
+
+	length = sizeof(sourcecache_t) + numtokens * sizeof(cachedtoken_t) + stringsize;
+	cache = (sourcecache_t *)GetMemory(length);
+	Com_Memcpy(cache, &recordcache, sizeof(sourcecache_t));
+	cache->numtokens = numtokens;
+	cache->tokens = (cachedtoken_t *)(cache + 1);
+	cache->strings = (char *)(cache->tokens + numtokens);
+	cache->size = length;
+	if (tokens) {
+		Com_Memcpy(cache->tokens, tokens, numtokens * sizeof(cachedtoken_t));
+		FreeMemory(tokens);
+	}
+	if (strings) {
+		Com_Memcpy(cache->strings, strings, stringsize);
+		FreeMemory(strings);
+	}
+	return cache;
+}
+
+static void PC_UseSourceCache(source_t *source) {
+	sourcecache_t *cache;
+	unsigned int defineshash;
+	int complete;
+
+	if (strlen(source->filename) >= MAX_QPATH)
+		return;
+	defineshash = PC_GlobalDefinesHash();
+	cache = PC_FindSourceCache(source, defineshash);
+	if (!cache) {
+		// the source is read up to the end here, so it replays its own recording
+		cache = PC_RecordSource(source, &complete);
+		Q_strncpyz(cache->filename, source->filename, sizeof(cache->filename));
+		Q_strncpyz(cache->basefolder, pc_basefolder, sizeof(cache->basefolder));
+		cache->defineshash = defineshash;
+		if (complete)
+			PC_LinkSourceCache(cache);
+	}
+	cache->refs++;
+	source->cache = cache;
+	source->cachetoken = 0;
+	source->cachefile = 0;
+}
+#endif // BOTLIB
+
 source_t *LoadSourceFile(const char *filename) {
 	source_t *source;
 	script_t *script;
@@ -2490,6 +2845,17 @@ source_t *LoadSourceFile(const char *filename) {
 	return source;
 }
 
+#ifdef BOTLIB
+source_t *LoadCachedSourceFile(const char *filename) {
+	source_t *source;
+
+	source = LoadSourceFile(filename);
+	if (source)
+		PC_UseSourceCache(source);
+	return source;
+}
+#endif // BOTLIB
+
 source_t *LoadSourceMemory(char *ptr, int length, char *name) {
 	source_t *source;
 	script_t *script;
@@ -2525,6 +2891,10 @@ void FreeSource(source_t *source) {
 	indent_t *indent;
 	int i;
 
+#ifdef BOTLIB
+	if (source->cache)
+		PC_ReleaseSourceCache(source->cache);
+#endif // BOTLIB
 	// free all the scripts
 	while (source->scriptstack) {
 		script = source->scriptstack;
@@ -2582,7 +2952,7 @@ int PC_LoadSourceHandle(const char *filename) {
 	}
 	if (i >= MAX_SOURCEFILES)
 		return 0;
-	PS_SetBaseFolder("");
+	PC_SetBaseFolder("");
 	source = LoadSourceFile(filename);
 	if (!source)
 		return 0;
@@ -2636,6 +3006,9 @@ int PC_SourceFileAndLine(int handle, char *filename, int *line) {
 }
 
 void PC_SetBaseFolder(const char *path) {
+#ifdef BOTLIB
+	Q_strncpyz(pc_basefolder, path, sizeof(pc_basefolder));
+#endif // BOTLIB
 	PS_SetBaseFolder(path);
 }
 
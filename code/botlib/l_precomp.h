@@ -96,6 +96,9 @@ typedef struct source_s {
 	indent_t *indentstack;		 // stack with indents
 	int skip;					 // > 0 if skipping conditional code
 	token_t token;				 // last read token
+	struct sourcecache_s *cache; // cached tokens to replay instead of the scripts
+	int cachetoken;				 // next cached token to replay
+	int cachefile;				 // cached file the script stack is named after
 } source_t;
 
 // read a token from the source
@@ -134,6 +137,8 @@ void PC_SetPunctuations(source_t *source, punctuation_t *p);
 void PC_SetBaseFolder(const char *path);
 // load a source file
 source_t *LoadSourceFile(const char *filename);
+// load a source file, replaying its tokens from the source cache when unchanged
+source_t *LoadCachedSourceFile(const char *filename);
 // load a source from memory
 source_t *LoadSourceMemory(char *ptr, int length, char *name);
 // free the given source
@@ -148,42 +148,57 @@ void CG_DrawPic1024(float x, float y, float width, float height, qhandle_t Shade
 
 /*
 ===============
-CG_DrawChar
+CG_CharPic
 
-Coordinates and size in 640*480 virtual screen size
+Fills in the stretch pic of a charset character, returns qfalse
+for characters that don't draw anything
 ===============
 */
-void CG_DrawChar(int x, int y, int width, int height, int ch) {
+static qboolean CG_CharPic(stretchPic_t *pic, int x, int y, int width, int height, int ch) {
 	int row, col;
-	float frow, fcol;
 	float size;
-	float ax, ay, aw, ah;
 
 	ch &= 255;
 
 	if (ch == ' ') {
-		return;
+		return qfalse;
 	}
 
 	// For some reason, newline maps to a char
 	if (ch == '\n') {
-		return;
+		return qfalse;
 	}
 
-	ax = x;
-	ay = y;
-	aw = width;
-	ah = height;
-	CG_AdjustFrom640(&ax, &ay, &aw, &ah);
+	pic->x = x;
+	pic->y = y;
+	pic->w = width;
+	pic->h = height;
+	CG_AdjustFrom640(&pic->x, &pic->y, &pic->w, &pic->h);
 
 	row = ch >> 4;
 	col = ch & 15;
 
-	frow = row * 0.0625f;
-	fcol = col * 0.0625f;
 	size = 0.0625f;
+	pic->s1 = col * size;
+	pic->t1 = row * size;
+	pic->s2 = pic->s1 + size;
+	pic->t2 = pic->t1 + size;
+	return qtrue;
+}
+
+/*
+===============
+CG_DrawChar
+
+Coordinates and size in 640*480 virtual screen size
+===============
+*/
+void CG_DrawChar(int x, int y, int width, int height, int ch) {
+	stretchPic_t pic;
 
-	trap_R_DrawStretchPic(ax, ay, aw, ah, fcol, frow, fcol + size, frow + size, cgs.media.charsetShader);
+	if (CG_CharPic(&pic, x, y, width, height, ch)) {
+		trap_R_DrawStretchPic(pic.x, pic.y, pic.w, pic.h, pic.s1, pic.t1, pic.s2, pic.t2, cgs.media.charsetShader);
+	}
 }
 
 /*
@@ -194,18 +209,26 @@ Draws a multi-colored string with a drop shadow, optionally forcing
 to a fixed color.
 
 Coordinates are at 640 by 480 virtual resolution
+
+The characters of each color run go to the renderer in one call
 ==================
 */
+#define MAX_STRING_PICS 128
+
 void CG_DrawStringExt(int x, int y, const char *string, const float *setColor, qboolean forceColor, qboolean shadow,
 					  int charWidth, int charHeight, int maxChars) {
 	vec4_t color;
 	const char *s;
 	int xx;
 	int cnt;
+	stretchPic_t pics[MAX_STRING_PICS];
+	int numPics;
 
 	if (maxChars <= 0)
 		maxChars = 32767; // do them all!
 
+	numPics = 0;
+
 	// draw the drop shadow
 	if (shadow) {
 		color[0] = color[1] = color[2] = 0;
@@ -219,11 +242,21 @@ void CG_DrawStringExt(int x, int y, const char *string, const float *setColor, q
 				s += 2;
 				continue;
 			}
-			CG_DrawChar(xx + 1, y + 1, charWidth, charHeight, *s);
+			if (numPics == MAX_STRING_PICS) {
+				trap_R_DrawStretchPics(pics, numPics, cgs.media.charsetShader);
+				numPics = 0;
+			}
+			if (CG_CharPic(&pics[numPics], xx + 1, y + 1, charWidth, charHeight, *s)) {
+				numPics++;
+			}
 			cnt++;
 			xx += charWidth;
 			s++;
 		}
+		if (numPics) {
+			trap_R_DrawStretchPics(pics, numPics, cgs.media.charsetShader);
+			numPics = 0;
+		}
 	}
 
 	// draw the colored text
@@ -234,6 +267,10 @@ void CG_DrawStringExt(int x, int y, const char *string, const float *setColor, q
 	while (*s && cnt < maxChars) {
 		if (Q_IsColorString(s)) {
 			if (!forceColor) {
+				if (numPics) {
+					trap_R_DrawStretchPics(pics, numPics, cgs.media.charsetShader);
+					numPics = 0;
+				}
 				memcpy(color, g_color_table[ColorIndex(*(s + 1))], sizeof(color));
 				color[3] = setColor[3];
 				trap_R_SetColor(color);
@@ -241,11 +278,20 @@ void CG_DrawStringExt(int x, int y, const char *string, const float *setColor, q
 			s += 2;
 			continue;
 		}
-		CG_DrawChar(xx, y, charWidth, charHeight, *s);
+		if (numPics == MAX_STRING_PICS) {
+			trap_R_DrawStretchPics(pics, numPics, cgs.media.charsetShader);
+			numPics = 0;
+		}
+		if (CG_CharPic(&pics[numPics], xx, y, charWidth, charHeight, *s)) {
+			numPics++;
+		}
 		xx += charWidth;
 		cnt++;
 		s++;
 	}
+	if (numPics) {
+		trap_R_DrawStretchPics(pics, numPics, cgs.media.charsetShader);
+	}
 	trap_R_SetColor(NULL);
 }
 
@@ -26,6 +26,59 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 refEntity_t trailEnt; // HERBY
 
+#define TAG_CACHE_SIZE 256 // power of two
+
+typedef struct {
+	int clientFrame;
+	qhandle_t model;
+	int startFrame, endFrame;
+	float frac;
+	const char *tagName;
+	orientation_t tag;
+	int found;
+} tagCacheEntry_t;
+
+static tagCacheEntry_t cg_tagCache[TAG_CACHE_SIZE];
+
+/*
+======================
+CG_LerpTag
+
+trap_R_LerpTag with a cache that lives for one frame. Players sharing a
+model and animation frame, weapons in their idle frame and repeated
+lookups on the same parent all resolve without another trap call.
+======================
+*/
+int CG_LerpTag(orientation_t *tag, qhandle_t model, int startFrame, int endFrame, float frac, const char *tagName) {
+	tagCacheEntry_t *entry;
+	unsigned hash;
+	const char *s;
+
+	hash = model * 31 + startFrame * 17 + endFrame * 7;
+	for (s = tagName; *s; s++) {
+		hash = hash * 33 + *s;
+	}
+	entry = &cg_tagCache[hash & (TAG_CACHE_SIZE - 1)];
+
+	if (entry->tagName && entry->clientFrame == cg.clientFrame && entry->model == model &&
+		entry->startFrame == startFrame && entry->endFrame == endFrame && entry->frac == frac &&
+		!strcmp(entry->tagName, tagName)) {
+		*tag = entry->tag;
+		return entry->found;
+	}
+
+	entry->found = trap_R_LerpTag(&entry->tag, model, startFrame, endFrame, frac, tagName);
+	entry->clientFrame = cg.clientFrame;
+	entry->model = model;
+	entry->startFrame = startFrame;
+	entry->endFrame = endFrame;
+	entry->frac = frac;
+	entry->tagName = tagName;
+
+	*tag = entry->tag;
+	return entry->found;
+}
+
 /*
 ======================
 CG_PositionEntityOnTag
@@ -39,7 +92,7 @@ void CG_PositionEntityOnTag(refEntity_t *entity, const refEntity_t *parent, qhan
 	orientation_t lerped;
 
 	// lerp the tag
-	trap_R_LerpTag(&lerped, parentModel, parent->oldframe, parent->frame, 1.0 - parent->backlerp, tagName);
+	CG_LerpTag(&lerped, parentModel, parent->oldframe, parent->frame, 1.0 - parent->backlerp, tagName);
 
 	// FIXME: allow origin offsets along tag?
 	VectorCopy(parent->origin, entity->origin);
@@ -68,7 +121,7 @@ void CG_PositionRotatedEntityOnTag(refEntity_t *entity, const refEntity_t *paren
 
 	// AxisClear( entity->axis );
 	// lerp the tag
-	trap_R_LerpTag(&lerped, parentModel, parent->oldframe, parent->frame, 1.0 - parent->backlerp, tagName);
+	CG_LerpTag(&lerped, parentModel, parent->oldframe, parent->frame, 1.0 - parent->backlerp, tagName);
 
 	// FIXME: allow origin offsets along tag?
 	VectorCopy(parent->origin, entity->origin);
@@ -246,6 +299,9 @@ static void CG_Item(centity_t *cent) {
 		return;
 	}
 
+	// items still streaming in are registered the first time they are seen
+	CG_RegisterItemVisuals(es->modelindex);
+
 	item = &bg_itemlist[es->modelindex];
 	if (cg_simpleItems.integer && item->giType != IT_TEAM) {
 		memset(&ent, 0, sizeof(ent));
@@ -861,10 +917,13 @@ void CG_AdjustPositionForMover(const vec3_t in, int moverNum, int fromTime, int
 /*
 =============================
 CG_InterpolateEntityPosition
+
+The end points only depend on the two snapshots, so they are evaluated
+once and reused for every frame until the next snapshot arrives
 =============================
 */
 static void CG_InterpolateEntityPosition(centity_t *cent) {
-	vec3_t current, next;
+	const float *current, *next;
 	float f;
 
 	// it would be an internal error to find an entity that interpolates without
@@ -877,16 +936,22 @@ static void CG_InterpolateEntityPosition(centity_t *cent) {
 
 	// this will linearize a sine or parabolic curve, but it is important
 	// to not extrapolate player positions if more recent data is available
-	BG_EvaluateTrajectory(&cent->currentState.pos, cg.snap->serverTime, current);
-	BG_EvaluateTrajectory(&cent->nextState.pos, cg.nextSnap->serverTime, next);
+	if (!cent->lerpCached) {
+		BG_EvaluateTrajectory(&cent->currentState.pos, cg.snap->serverTime, cent->lerpFromOrigin);
+		BG_EvaluateTrajectory(&cent->nextState.pos, cg.nextSnap->serverTime, cent->lerpToOrigin);
+		BG_EvaluateTrajectory(&cent->currentState.apos, cg.snap->serverTime, cent->lerpFromAngles);
+		BG_EvaluateTrajectory(&cent->nextState.apos, cg.nextSnap->serverTime, cent->lerpToAngles);
+		cent->lerpCached = qtrue;
+	}
 
+	current = cent->lerpFromOrigin;
+	next = cent->lerpToOrigin;
 	cent->lerpOrigin[0] = current[0] + f * (next[0] - current[0]);
 	cent->lerpOrigin[1] = current[1] + f * (next[1] - current[1]);
 	cent->lerpOrigin[2] = current[2] + f * (next[2] - current[2]);
 
-	BG_EvaluateTrajectory(&cent->currentState.apos, cg.snap->serverTime, current);
-	BG_EvaluateTrajectory(&cent->nextState.apos, cg.nextSnap->serverTime, next);
-
+	current = cent->lerpFromAngles;
+	next = cent->lerpToAngles;
 	cent->lerpAngles[0] = LerpAngle(current[0], next[0], f);
 	cent->lerpAngles[1] = LerpAngle(current[1], next[1], f);
 	cent->lerpAngles[2] = LerpAngle(current[2], next[2], f);
@@ -903,9 +968,11 @@ static void CG_CalcEntityLerpPositions(centity_t *cent) {
 	// if this player does not want to see extrapolated players
 	if (!cg_smoothClients.integer) {
 		// make sure the clients use TR_INTERPOLATE
-		if (cent->currentState.number < MAX_CLIENTS) {
+		if (cent->currentState.number < MAX_CLIENTS &&
+			(cent->currentState.pos.trType != TR_INTERPOLATE || cent->nextState.pos.trType != TR_INTERPOLATE)) {
 			cent->currentState.pos.trType = TR_INTERPOLATE;
 			cent->nextState.pos.trType = TR_INTERPOLATE;
+			cent->lerpCached = qfalse;
 		}
 	}
 
@@ -591,6 +591,73 @@ void AddLFToDrawList(const char *lfname, vec3_t origin, vec3_t dir) {
 	IFDA_firstempty++;
 }
 
+/*
+#######################
+LF_Visible
+
+Traces from the view to a lf-origin, or along a sky-dir until the sky is hit.
+The traces are the expensive part of a lensflare, so a result is kept for
+LF_VIS_CACHE_MSEC as long as the view and the lf don't move.
+#######################
+*/
+#define LF_VIS_CACHE_MSEC 50
+
+typedef struct {
+	vec3_t point;
+	vec3_t dir;
+	vec3_t vieworg;
+	int time;
+	qboolean visible;
+} lfVisCache_t;
+
+static lfVisCache_t lfVisCache[MAX_SCREENLFS];
+static int lfVisCacheNext;
+
+static qboolean LF_Visible(vec3_t point, vec3_t dir, vec3_t vieworg) {
+	lfVisCache_t *c;
+	trace_t tr;
+	vec3_t start, end;
+	int i;
+
+	for (i = 0, c = lfVisCache; i < MAX_SCREENLFS; i++, c++) {
+		if (cg.time >= c->time && cg.time - c->time < LF_VIS_CACHE_MSEC && VectorCompare(c->point, point) &&
+			VectorCompare(c->dir, dir) && VectorCompare(c->vieworg, vieworg)) {
+			return c->visible;
+		}
+	}
+
+	c = &lfVisCache[lfVisCacheNext];
+	lfVisCacheNext = (lfVisCacheNext + 1) % MAX_SCREENLFS;
+	VectorCopy(point, c->point);
+	VectorCopy(dir, c->dir);
+	VectorCopy(vieworg, c->vieworg);
+	c->time = cg.time;
+
+	if (point[0] != 2300000.0f) {
+		CG_Trace(&tr, vieworg, NULL, NULL, point, cg.snap->ps.clientNum, CONTENTS_SOLID);
+		c->visible = (tr.fraction == 1.0f);
+		return c->visible;
+	}
+
+	VectorCopy(vieworg, start);
+	VectorMA(vieworg, 200000.0f, dir, end);
+
+	do {
+		CG_Trace(&tr, start, NULL, NULL, end, cg.snap->ps.clientNum, CONTENTS_SOLID);
+		if (tr.fraction == 1.0f)
+			break;
+
+		if (!tr.startsolid) {
+			VectorMA(tr.endpos, 10.0f, dir, start);
+		} else {
+			VectorMA(start, 10.0f, dir, start);
+		}
+	} while (tr.surfaceFlags & SURF_NODRAW || tr.contents & CONTENTS_TRANSLUCENT);
+
+	c->visible = (tr.surfaceFlags & SURF_SKY) != 0;
+	return c->visible;
+}
+
 /*
 #######################
 Calculate_2DdirOf3D
@@ -605,7 +672,6 @@ static float Calculate_2DdirOf3D(vec3_t point, vec3_t dir, refdef_t *refdef, vec
 								 vec4_t xywh) {
 	vec3_t vec;
 	vec3_t axis[3];
-	trace_t tr;
 
 	// x,y of the center ... Width, Height ... all convertet to the 640x480-screen
 	xywh[2] = 640.0f * (float)refdef->width / (float)cgs.glconfig.vidWidth;
@@ -614,12 +680,11 @@ static float Calculate_2DdirOf3D(vec3_t point, vec3_t dir, refdef_t *refdef, vec
 	xywh[0] = 640.0f * (float)(refdef->x + refdef->width * 0.5f) / (float)cgs.glconfig.vidWidth;
 	xywh[1] = 480.0f * (float)(refdef->y + refdef->height * 0.5f) / (float)cgs.glconfig.vidHeight;
 
+	if (!LF_Visible(point, dir, refdef->vieworg))
+		return 0.0f;
+
 	if (point[0] != 2300000.0f) // a small hack to mark only dirs (origins have to be between 65535 and -65535)
 	{
-		CG_Trace(&tr, refdef->vieworg, NULL, NULL, point, cg.snap->ps.clientNum, CONTENTS_SOLID);
-		if (tr.fraction != 1.0f)
-			return 0.0f;
-
 		// make a vector from camera to dot
 		vec[0] = point[0] - refdef->vieworg[0];
 		vec[1] = point[1] - refdef->vieworg[1];
@@ -627,34 +692,6 @@ static float Calculate_2DdirOf3D(vec3_t point, vec3_t dir, refdef_t *refdef, vec
 
 		*distanceSquared = VectorLengthSquared(vec);
 	} else {
-		vec3_t start;
-		start[0] = refdef->vieworg[0];
-		start[1] = refdef->vieworg[1];
-		start[2] = refdef->vieworg[2];
-
-		vec[0] = refdef->vieworg[0] + dir[0] * 200000.0f;
-		vec[1] = refdef->vieworg[1] + dir[1] * 200000.0f;
-		vec[2] = refdef->vieworg[2] + dir[2] * 200000.0f;
-
-		do {
-			CG_Trace(&tr, start, NULL, NULL, vec, cg.snap->ps.clientNum, CONTENTS_SOLID);
-			if (tr.fraction == 1.0f)
-				break;
-
-			if (!tr.startsolid) {
-				start[0] = tr.endpos[0] + dir[0] * 10.0f;
-				start[1] = tr.endpos[1] + dir[1] * 10.0f;
-				start[2] = tr.endpos[2] + dir[2] * 10.0f;
-			} else {
-				start[0] += dir[0] * 10.0f;
-				start[1] += dir[1] * 10.0f;
-				start[2] += dir[2] * 10.0f;
-			}
-		} while (tr.surfaceFlags & SURF_NODRAW || tr.contents & CONTENTS_TRANSLUCENT);
-
-		if (!(tr.surfaceFlags & SURF_SKY))
-			return 0.0f;
-
 		vec[0] = dir[0];
 		vec[1] = dir[1];
 		vec[2] = dir[2];
@@ -173,6 +173,7 @@ typedef struct markPoly_s {
 
 	vec3_t origin;
 	float radius;
+	vec3_t pvsOrigin; // origin pulled off the surface, for PVS tests
 } markPoly_t;
 
 typedef enum {
@@ -291,6 +292,12 @@ typedef struct centity_s {
 	// exact interpolated position of entity on this frame
 	vec3_t lerpOrigin;
 	vec3_t lerpAngles;
+
+	// trajectories evaluated at cg.snap and cg.nextSnap, they only change
+	// when CG_SetNextSnap clears lerpCached
+	qboolean lerpCached;
+	vec3_t lerpFromOrigin, lerpToOrigin;
+	vec3_t lerpFromAngles, lerpToAngles;
 } centity_t;
 
 //======================================================================
@@ -488,6 +495,8 @@ typedef struct {
 	qboolean levelShot; // taking a level menu screenshot
 	int deferredPlayerLoading;
 	qboolean loading;			  // don't defer players at initial startup
+	qboolean streaming;			  // items and other players are still loaded during play
+	int streamItem;				  // next item CG_StreamAssets looks at
 	qboolean intermissionStarted; // don't play voice rewards, because game will end shortly
 
 	// there are only one or two snapshot_t that are relevant at a time
@@ -553,6 +562,19 @@ typedef struct {
 	int predictedErrorTime;
 	vec3_t predictedError;
 
+	// incremental prediction, only valid while the base snapshot stays the same
+	qboolean pmoveStateValid;
+	playerState_t pmoveState; // predictedPlayerState before the mover adjustment
+	int pmoveCommand;		  // last command run into pmoveState
+	qboolean pmoveMoved;
+	qboolean pmoveHyperspace;
+	int pmoveBaseTime; // cg.physicsTime of the base snapshot
+	int pmoveBaseCommandTime;
+	int pmoveTracemask;
+	int pmoveFixed;
+	int pmoveMsec;
+	qboolean pmoveNoFootsteps;
+
 	int eventSequence;
 	int predictableEvents[MAX_PREDICTED_EVENTS];
 
@@ -606,6 +628,8 @@ typedef struct {
 	int selectedScore;
 	int teamScores[2];
 	score_t scores[MAX_CLIENTS];
+	score_t clientScores[MAX_CLIENTS]; // the last row of every client, "scored" only updates some
+	qboolean scoreRowsValid;		   // a full "scores" arrived since the cgame started
 	qboolean showScores;
 	qboolean scoreBoardShowing;
 	int scoreFadeTime;
@@ -1272,6 +1296,7 @@ extern vmCvar_t cg_debugPosition;
 extern vmCvar_t cg_debugEvents;
 extern vmCvar_t cg_errorDecay;
 extern vmCvar_t cg_nopredict;
+extern vmCvar_t cg_optimizePrediction;
 extern vmCvar_t cg_noPlayerAnims;
 extern vmCvar_t cg_showmiss;
 extern vmCvar_t cg_footsteps;
@@ -1305,6 +1330,7 @@ extern vmCvar_t cg_buildScript;
 extern vmCvar_t cg_paused;
 extern vmCvar_t cg_predictItems;
 extern vmCvar_t cg_deferPlayers;
+extern vmCvar_t cg_streamAssets;
 extern vmCvar_t cg_drawFriend;
 extern vmCvar_t cg_teamChatsOnly;
 extern vmCvar_t cg_scorePlum;
@@ -1368,6 +1394,7 @@ void QDECL CG_Printf(const char *msg, ...) __attribute__((format(printf, 1, 2)))
 void QDECL CG_Error(const char *msg, ...) __attribute__((noreturn, format(printf, 1, 2)));
 
 void CG_StartMusic(void);
+void CG_StreamAssets(void);
 
 void CG_UpdateCvars(void);
 
@@ -1399,6 +1426,9 @@ void CG_TestModelPrevSkin_f(void);
 void CG_ZoomDown_f(void);
 void CG_ZoomUp_f(void);
 void CG_AddBufferedSound(sfxHandle_t sfx);
+void CG_FlushSceneBatches(void);
+void CG_AddRefEntityBatched(const refEntity_t *re);
+void CG_AddPolyBatched(qhandle_t hShader, int numVerts, const polyVert_t *verts);
 
 void CG_DrawActiveFrame(int serverTime, stereoFrame_t stereoView, qboolean demoPlayback);
 
@@ -1473,6 +1503,7 @@ void CG_Trace(trace_t *result, const vec3_t start, const vec3_t mins, const vec3
 			  int skipNumber, int mask);
 void CG_PredictPlayerState(void);
 void CG_LoadDeferredPlayers(void);
+qboolean CG_LoadDeferredPlayer(void);
 
 //
 // cg_events.c
@@ -1490,6 +1521,7 @@ void CG_AddPacketEntities(void);
 void CG_Beam(centity_t *cent);
 void CG_AdjustPositionForMover(const vec3_t in, int moverNum, int fromTime, int toTime, vec3_t out, vec3_t angles_in, vec3_t angles_out);
 
+int CG_LerpTag(orientation_t *tag, qhandle_t model, int startFrame, int endFrame, float frac, const char *tagName);
 void CG_PositionEntityOnTag(refEntity_t *entity, const refEntity_t *parent, qhandle_t parentModel, char *tagName);
 void CG_PositionRotatedEntityOnTag(refEntity_t *entity, const refEntity_t *parent, qhandle_t parentModel,
 								   char *tagName);
@@ -1528,6 +1560,7 @@ void CG_OutOfAmmoChange(void); // should this be in pmove?
 // cg_marks.c
 //
 void CG_InitMarkPolys(void);
+qboolean CG_PortalInView(void);
 void CG_AddMarks(void);
 void CG_ImpactMark(qhandle_t markShader, const vec3_t origin, const vec3_t dir, float orientation, float r, float g,
 				   float b, float a, qboolean alphaFade, float radius, qboolean temporary);
@@ -1659,6 +1692,7 @@ int trap_Milliseconds(void);
 // console variable interaction
 void trap_Cvar_Register(vmCvar_t *vmCvar, const char *varName, const char *defaultValue, int flags);
 void trap_Cvar_Update(vmCvar_t *vmCvar);
+int trap_Cvar_Generation(void);
 void trap_Cvar_Set(const char *var_name, const char *value);
 void trap_Cvar_VariableStringBuffer(const char *var_name, char *buffer, int bufsize);
 
@@ -1740,6 +1774,7 @@ qhandle_t trap_R_RegisterShaderNoMip(const char *name); // returns all white if
 // Nothing is drawn until R_RenderScene is called.
 void trap_R_ClearScene(void);
 void trap_R_AddRefEntityToScene(const refEntity_t *re);
+void trap_R_AddRefEntitiesToScene(const refEntity_t *ents, int numEnts);
 
 // polys are intended for simple wall marks, not really for doing
 // significant construction
@@ -1751,6 +1786,7 @@ void trap_R_RenderScene(const refdef_t *fd);
 void trap_R_SetColor(const float *rgba); // NULL = 1,1,1,1
 void trap_R_DrawStretchPic(float x, float y, float w, float h, float s1, float t1, float s2, float t2,
 						   qhandle_t hShader);
+void trap_R_DrawStretchPics(const stretchPic_t *pics, int numPics, qhandle_t hShader);
 void trap_R_ModelBounds(clipHandle_t model, vec3_t mins, vec3_t maxs);
 int trap_R_LerpTag(orientation_t *tag, clipHandle_t mod, int startFrame, int endFrame, float frac, const char *tagName);
 void trap_R_RemapShader(const char *oldShader, const char *newShader, const char *timeOffset);
@@ -1821,6 +1857,8 @@ qboolean trap_getCameraInfo(int time, vec3_t *origin, vec3_t *angles);
 
 qboolean trap_GetEntityToken(char *buffer, int bufferSize);
 
+qboolean trap_R_inPVS(const vec3_t p1, const vec3_t p2);
+
 void CG_ClearParticles(void);
 void CG_AddParticles(void);
 void CG_ParticleSnow(qhandle_t pshader, vec3_t origin, vec3_t origin2, int turb, float range, int snum);
@@ -26,10 +26,42 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 #include "cg_local.h"
 
-#define MAX_LOCAL_ENTITIES 512
+// the pool starts at MIN_LOCAL_ENTITIES and grows in steps when it runs dry
+#define MIN_LOCAL_ENTITIES 512
+#define MAX_LOCAL_ENTITIES 2048
+#define LOCAL_ENTITY_GROWTH 256
+
 localEntity_t cg_localEntities[MAX_LOCAL_ENTITIES];
 localEntity_t cg_activeLocalEntities; // double linked list
 localEntity_t *cg_freeLocalEntities;  // single linked list
+static int cg_numLocalEntities;		  // how many have been put in use
+
+static localEntity_t *cg_addingLocalEntity; // being processed by CG_AddLocalEntities
+
+/*
+===================
+CG_GrowLocalEntities
+
+Links the next count unused entries into the free list
+===================
+*/
+static qboolean CG_GrowLocalEntities(int count) {
+	int i;
+
+	count = MIN(count, MAX_LOCAL_ENTITIES - cg_numLocalEntities);
+	if (count <= 0) {
+		return qfalse;
+	}
+
+	for (i = cg_numLocalEntities; i < cg_numLocalEntities + count - 1; i++) {
+		cg_localEntities[i].next = &cg_localEntities[i + 1];
+	}
+	cg_localEntities[i].next = cg_freeLocalEntities;
+	cg_freeLocalEntities = &cg_localEntities[cg_numLocalEntities];
+
+	cg_numLocalEntities += count;
+	return qtrue;
+}
 
 /*
 ===================
@@ -39,15 +71,12 @@ This is called at startup and for tournement restarts
 ===================
 */
 void CG_InitLocalEntities(void) {
-	int i;
-
 	memset(cg_localEntities, 0, sizeof(cg_localEntities));
 	cg_activeLocalEntities.next = &cg_activeLocalEntities;
 	cg_activeLocalEntities.prev = &cg_activeLocalEntities;
-	cg_freeLocalEntities = cg_localEntities;
-	for (i = 0; i < MAX_LOCAL_ENTITIES - 1; i++) {
-		cg_localEntities[i].next = &cg_localEntities[i + 1];
-	}
+	cg_freeLocalEntities = NULL;
+	cg_numLocalEntities = 0;
+	CG_GrowLocalEntities(MIN_LOCAL_ENTITIES);
 }
 
 /*
@@ -69,20 +98,47 @@ void CG_FreeLocalEntity(localEntity_t *le) {
 	cg_freeLocalEntities = le;
 }
 
+/*
+===================
+CG_FreeExpiringLocalEntity
+
+Frees the active entity closest to its end time, rather than the oldest
+one, so a burst of short lived debris doesn't take out long effects.
+Leaves alone what CG_AddLocalEntities is in the middle of.
+===================
+*/
+static void CG_FreeExpiringLocalEntity(void) {
+	localEntity_t *le, *best;
+
+	best = NULL;
+	for (le = cg_activeLocalEntities.next; le != &cg_activeLocalEntities; le = le->next) {
+		if (cg_addingLocalEntity && (le == cg_addingLocalEntity || le == cg_addingLocalEntity->prev)) {
+			continue;
+		}
+		if (!best || le->endTime < best->endTime) {
+			best = le;
+		}
+	}
+
+	if (!best) {
+		CG_Error("CG_AllocLocalEntity: no local entity to free");
+	}
+
+	CG_FreeLocalEntity(best);
+}
+
 /*
 ===================
 CG_AllocLocalEntity
 
-Will always succeed, even if it requires freeing an old active entity
+Will always succeed, even if it requires freeing an active entity
 ===================
 */
 localEntity_t *CG_AllocLocalEntity(void) {
 	localEntity_t *le;
 
-	if (!cg_freeLocalEntities) {
-		// no free entities, so free the one at the end of the chain
-		// remove the oldest active entity
-		CG_FreeLocalEntity(cg_activeLocalEntities.prev);
+	if (!cg_freeLocalEntities && !CG_GrowLocalEntities(LOCAL_ENTITY_GROWTH)) {
+		CG_FreeExpiringLocalEntity();
 	}
 
 	le = cg_freeLocalEntities;
@@ -179,10 +235,10 @@ void CG_AddFragment(localEntity_t *le) {
 			le->refEntity.renderfx |= RF_LIGHTING_ORIGIN;
 			oldZ = le->refEntity.origin[2];
 			le->refEntity.origin[2] -= 16 * (1.0 - (float)t / SINK_TIME);
-			trap_R_AddRefEntityToScene(&le->refEntity);
+			CG_AddRefEntityBatched(&le->refEntity);
 			le->refEntity.origin[2] = oldZ;
 		} else {
-			trap_R_AddRefEntityToScene(&le->refEntity);
+			CG_AddRefEntityBatched(&le->refEntity);
 		}
 
 		return;
@@ -204,7 +260,7 @@ void CG_AddFragment(localEntity_t *le) {
 			AnglesToAxis(angles, le->refEntity.axis);
 		}
 
-		trap_R_AddRefEntityToScene(&le->refEntity);
+		CG_AddRefEntityBatched(&le->refEntity);
 		return;
 	}
 
@@ -225,7 +281,7 @@ void CG_AddFragment(localEntity_t *le) {
 	// reflect the velocity on the trace plane
 	CG_ReflectVelocity(le, &trace);
 
-	trap_R_AddRefEntityToScene(&le->refEntity);
+	CG_AddRefEntityBatched(&le->refEntity);
 }
 
 /*
@@ -256,7 +312,7 @@ void CG_AddFadeRGB(localEntity_t *le) {
 	re->shaderRGBA[2] = le->color[2] * c;
 	re->shaderRGBA[3] = le->color[3] * c;
 
-	trap_R_AddRefEntityToScene(re);
+	CG_AddRefEntityBatched(re);
 }
 
 /*
@@ -279,7 +335,7 @@ void CG_AddSprayTrailFade(localEntity_t *le) {
 
 	BG_EvaluateTrajectory(&le->pos, cg.time, re->origin);
 
-	trap_R_AddRefEntityToScene(re);
+	CG_AddRefEntityBatched(re);
 }
 
 /*
@@ -362,7 +418,7 @@ static void CG_AddMoveScaleFade(localEntity_t *le) {
 		return;
 	}
 
-	trap_R_AddRefEntityToScene(re);
+	CG_AddRefEntityBatched(re);
 }
 
 /*
@@ -397,7 +453,7 @@ static void CG_AddScaleFade(localEntity_t *le) {
 		return;
 	}
 
-	trap_R_AddRefEntityToScene(re);
+	CG_AddRefEntityBatched(re);
 }
 
 /*
@@ -436,7 +492,7 @@ static void CG_AddFallScaleFade(localEntity_t *le) {
 		return;
 	}
 
-	trap_R_AddRefEntityToScene(re);
+	CG_AddRefEntityBatched(re);
 }
 
 /*
@@ -454,10 +510,10 @@ static void CG_AddExplosion(localEntity_t *ex) {
 		vec3_t axisCopy[3];
 		AxisCopy(ent->axis, axisCopy);
 		AxisScale(ent->axis, 0.05 + 0.2 * (float)(cg.time - ex->startTime) / (ex->endTime - ex->startTime), ent->axis);
-		trap_R_AddRefEntityToScene(ent);
+		CG_AddRefEntityBatched(ent);
 		AxisCopy(axisCopy, ent->axis);
 	} else
-		trap_R_AddRefEntityToScene(ent);
+		CG_AddRefEntityBatched(ent);
 
 	// add the dlight
 	if (ex->light) {
@@ -498,7 +554,7 @@ static void CG_AddSpriteExplosion(localEntity_t *le) {
 	re.reType = RT_SPRITE;
 	re.radius = 42 * (1.0 - c) + 30;
 
-	trap_R_AddRefEntityToScene(&re);
+	CG_AddRefEntityBatched(&re);
 
 	// add the dlight
 	if (le->light) {
@@ -586,7 +642,7 @@ void CG_AddTrail(localEntity_t *le) {
 	VectorMA(endPos, -le->refEntity.radius, endDelta, verts[2].xyz);
 	VectorMA(endPos, le->refEntity.radius, endDelta, verts[3].xyz);
 
-	trap_R_AddPolyToScene(le->refEntity.customShader, 4, verts);
+	CG_AddPolyBatched(le->refEntity.customShader, 4, verts);
 
 	// add second plane
 	RotatePointAroundVector(startDelta, beamDir, startDir, -30);
@@ -597,7 +653,7 @@ void CG_AddTrail(localEntity_t *le) {
 	VectorMA(endPos, -le->refEntity.radius, endDelta, verts[2].xyz);
 	VectorMA(endPos, le->refEntity.radius, endDelta, verts[3].xyz);
 
-	trap_R_AddPolyToScene(le->refEntity.customShader, 4, verts);
+	CG_AddPolyBatched(le->refEntity.customShader, 4, verts);
 }
 
 /*
@@ -683,7 +739,7 @@ void CG_AddTrailTracedRGB(localEntity_t *le) {
 	VectorMA(endPos, -le->refEntity.radius, endDelta, verts[2].xyz);
 	VectorMA(endPos, le->refEntity.radius, endDelta, verts[3].xyz);
 
-	trap_R_AddPolyToScene(le->refEntity.customShader, 4, verts);
+	CG_AddPolyBatched(le->refEntity.customShader, 4, verts);
 
 	// add second plane
 	RotatePointAroundVector(startDelta, beamDir, startDir, -30);
@@ -694,7 +750,7 @@ void CG_AddTrailTracedRGB(localEntity_t *le) {
 	VectorMA(endPos, -le->refEntity.radius, endDelta, verts[2].xyz);
 	VectorMA(endPos, le->refEntity.radius, endDelta, verts[3].xyz);
 
-	trap_R_AddPolyToScene(le->refEntity.customShader, 4, verts);
+	CG_AddPolyBatched(le->refEntity.customShader, 4, verts);
 }
 
 /*
@@ -938,7 +994,7 @@ void CG_AddWaterBeam(localEntity_t *le) {
 		VectorMA(endPos, endwidth, endDelta, verts[2].xyz);
 		VectorMA(endPos, endwidth, endDir, verts[3].xyz);
 
-		trap_R_AddPolyToScene(cgs.media.waterBeamShader, 4, verts);
+		CG_AddPolyBatched(cgs.media.waterBeamShader, 4, verts);
 	}
 
 	// add planes
@@ -954,7 +1010,7 @@ void CG_AddWaterBeam(localEntity_t *le) {
 			VectorMA( endPos, -BOASTER_WIDTH, endDelta, verts[2].xyz );
 			VectorMA( endPos,  BOASTER_WIDTH, endDelta, verts[3].xyz );
 
-			trap_R_AddPolyToScene( cgs.media.waterBeamShader, 4, verts );
+			CG_AddPolyBatched( cgs.media.waterBeamShader, 4, verts );
 		}*/
 }
 
@@ -1043,7 +1099,7 @@ void CG_AddPumperTrail(localEntity_t *le) {
 		VectorMA(newPos, -PUMPER_WIDTH, newDelta, verts[2].xyz);
 		VectorMA(newPos, PUMPER_WIDTH, newDelta, verts[3].xyz);
 
-		trap_R_AddPolyToScene(cgs.media.pumperTrailShader, 4, verts);
+		CG_AddPolyBatched(cgs.media.pumperTrailShader, 4, verts);
 	} while (pos < dist);
 }
 
@@ -1064,14 +1120,14 @@ void CG_AddBoomiesExplosion(localEntity_t *le) {
 	re->customShader = cgs.media.boomiesCoreShader;
 	re->radius = 20 + 200 * sin(M_PI * frac);
 	re->shaderRGBA[0] = re->shaderRGBA[1] = re->shaderRGBA[2] = (frac > 0.25) ? 255 : 255 * 4 * frac;
-	trap_R_AddRefEntityToScene(re);
+	CG_AddRefEntityBatched(re);
 
 	/*	// render the rings
 		re->reType = RT_MODEL;
 		re->customShader = 0;
 		re->hModel = cgs.media.imperiusRingsModel;
 		re->shaderRGBA[0] = re->shaderRGBA[1] = re->shaderRGBA[2] = 255 * frac;
-		trap_R_AddRefEntityToScene( re );
+		CG_AddRefEntityBatched( re );
 	*/
 	// render the sphere
 	if (frac > 0.3) {
@@ -1082,7 +1138,7 @@ void CG_AddBoomiesExplosion(localEntity_t *le) {
 		re->customShader = 0;
 		re->hModel = cgs.media.boomiesSphereModel;
 		re->shaderRGBA[0] = re->shaderRGBA[1] = re->shaderRGBA[2] = 255 * frac;
-		trap_R_AddRefEntityToScene(re);
+		CG_AddRefEntityBatched(re);
 	}
 }
 
@@ -1108,14 +1164,14 @@ void CG_AddImperiusBoom(localEntity_t *le) {
 	re->customShader = cgs.media.imperiusCoreShader;
 	re->radius = 20 + 200 * sin(M_PI * frac);
 	re->shaderRGBA[0] = re->shaderRGBA[1] = re->shaderRGBA[2] = (frac > 0.25) ? 255 : 255 * 4 * frac;
-	trap_R_AddRefEntityToScene(re);
+	CG_AddRefEntityBatched(re);
 
 	// render the rings
 	re->reType = RT_MODEL;
 	re->customShader = 0;
 	re->hModel = cgs.media.imperiusRingsModel;
 	re->shaderRGBA[0] = re->shaderRGBA[1] = re->shaderRGBA[2] = 255 * frac;
-	trap_R_AddRefEntityToScene(re);
+	CG_AddRefEntityBatched(re);
 
 	// render the sphere
 	if (frac > 0.3) {
@@ -1124,7 +1180,7 @@ void CG_AddImperiusBoom(localEntity_t *le) {
 			frac = 1.0;
 		re->hModel = cgs.media.imperiusSphereModel;
 		re->shaderRGBA[0] = re->shaderRGBA[1] = re->shaderRGBA[2] = 255 * frac;
-		trap_R_AddRefEntityToScene(re);
+		CG_AddRefEntityBatched(re);
 	}
 }
 
@@ -1151,7 +1207,7 @@ void CG_AddImperiusRings(localEntity_t *le) {
 	AxisCopy(re->axis, axis);
 	AxisScale(axis, s, re->axis);
 
-	trap_R_AddRefEntityToScene(re);
+	CG_AddRefEntityBatched(re);
 
 	AxisCopy(axis, re->axis);
 }
@@ -1176,7 +1232,7 @@ void CG_AddTeleffect(localEntity_t *le) {
 	// render the rings
 	re->reType = RT_MODEL;
 	re->shaderRGBA[0] = re->shaderRGBA[1] = re->shaderRGBA[2] = 255 * frac;
-	trap_R_AddRefEntityToScene(re);
+	CG_AddRefEntityBatched(re);
 }
 
 /*
@@ -1259,7 +1315,7 @@ void CG_AddScorePlum(localEntity_t *le) {
 	for (i = 0; i < numdigits; i++) {
 		VectorMA(origin, (float)(((float)numdigits / 2) - i) * NUMBER_SIZE, vec, re->origin);
 		re->customShader = cgs.media.numberShaders[digits[numdigits - 1 - i]];
-		trap_R_AddRefEntityToScene(re);
+		CG_AddRefEntityBatched(re);
 	}
 }
 
@@ -1281,6 +1337,7 @@ void CG_AddLocalEntities(void) {
 		// grab next now, so if the local entity is freed we
 		// still have it
 		next = le->prev;
+		cg_addingLocalEntity = le;
 
 		if (cg.time >= le->endTime) {
 			CG_FreeLocalEntity(le);
@@ -1363,4 +1420,7 @@ void CG_AddLocalEntities(void) {
 			break;
 		}
 	}
+
+	cg_addingLocalEntity = NULL;
+	CG_FlushSceneBatches();
 }
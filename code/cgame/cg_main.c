@@ -108,6 +108,7 @@ vmCvar_t cg_debugPosition;
 vmCvar_t cg_debugEvents;
 vmCvar_t cg_errorDecay;
 vmCvar_t cg_nopredict;
+vmCvar_t cg_optimizePrediction;
 vmCvar_t cg_noPlayerAnims;
 vmCvar_t cg_showmiss;
 vmCvar_t cg_footsteps;
@@ -141,6 +142,7 @@ vmCvar_t cg_forceModel;
 vmCvar_t cg_paused;
 vmCvar_t cg_predictItems;
 vmCvar_t cg_deferPlayers;
+vmCvar_t cg_streamAssets;
 vmCvar_t cg_drawTeamOverlay;
 vmCvar_t cg_teamOverlayUserinfo;
 vmCvar_t cg_drawFriend;
@@ -247,6 +249,7 @@ static cvarTable_t cvarTable[] = {	   // bk001129
 	{&cg_debugEvents, "cg_debugevents", "0", CVAR_CHEAT},
 	{&cg_errorDecay, "cg_errordecay", "100", 0},
 	{&cg_nopredict, "cg_nopredict", "0", 0},
+	{&cg_optimizePrediction, "cg_optimizePrediction", "1", CVAR_ARCHIVE},
 	{&cg_noPlayerAnims, "cg_noplayeranims", "0", CVAR_CHEAT},
 	{&cg_showmiss, "cg_showmiss", "0", 0},
 	{&cg_footsteps, "cg_footsteps", "1", CVAR_CHEAT},
@@ -262,6 +265,7 @@ static cvarTable_t cvarTable[] = {	   // bk001129
 	{&cg_forceModel, "cg_forceModel", "0", CVAR_ARCHIVE},
 	{&cg_predictItems, "cg_predictItems", "1", CVAR_ARCHIVE},
 	{&cg_deferPlayers, "cg_deferPlayers", "1", CVAR_ARCHIVE},
+	{&cg_streamAssets, "cg_streamAssets", "1", CVAR_ARCHIVE},
 	{&cg_drawTeamOverlay, "cg_drawTeamOverlay", "4", CVAR_ARCHIVE},
 	{&cg_teamOverlayUserinfo, "teamoverlay", "0", CVAR_ROM | CVAR_USERINFO},
 	{&cg_stats, "cg_stats", "0", 0},
@@ -397,9 +401,17 @@ CG_UpdateCvars
 =================
 */
 void CG_UpdateCvars(void) {
-	int i;
+	static int lastGeneration;
+	int i, generation;
 	cvarTable_t *cv;
 
+	// nothing changed since the last update
+	generation = trap_Cvar_Generation();
+	if (generation == lastGeneration) {
+		return;
+	}
+	lastGeneration = generation;
+
 	for (i = 0, cv = cvarTable; i < cvarTableSize; i++, cv++) {
 		trap_Cvar_Update(cv->vmCvar);
 	}
@@ -1116,7 +1128,12 @@ static void CG_RegisterGraphics(void) {
 	// only register the items that the server says we need
 	Q_strncpyz(items, CG_ConfigString(CS_ITEMS), sizeof(items));
 
+	// when streaming, only weapons and team items are needed up front as the
+	// HUD draws their icons unchecked, CG_StreamAssets registers the rest
 	for (i = 1; i < bg_numItems; i++) {
+		if (cg.streaming && bg_itemlist[i].giType != IT_WEAPON && bg_itemlist[i].giType != IT_TEAM) {
+			continue;
+		}
 		if (items[i] == '1' || cg_buildScript.integer) {
 			CG_LoadingItem(i);
 			CG_RegisterItemVisuals(i);
@@ -1174,6 +1191,42 @@ static void CG_RegisterGraphics(void) {
 	*/
 }
 
+/*
+=================
+CG_StreamAssets
+
+Registers the media CG_Init left out in streaming mode, a few milliseconds
+worth each frame.  Items seen before this gets to them are registered when
+they are first drawn, other players use a deferred model until then.
+=================
+*/
+void CG_StreamAssets(void) {
+	const char *items;
+	int start, i;
+
+	if (!cg.streaming) {
+		return;
+	}
+
+	start = trap_Milliseconds();
+	items = CG_ConfigString(CS_ITEMS);
+
+	do {
+		if (cg.streamItem < bg_numItems) {
+			i = cg.streamItem++;
+			if (i > 0 && items[i] == '1') {
+				CG_RegisterItemVisuals(i);
+			}
+			continue;
+		}
+
+		if (!CG_LoadDeferredPlayer()) {
+			cg.streaming = qfalse;
+			return;
+		}
+	} while (trap_Milliseconds() - start < 4);
+}
+
 /*
 =======================
 CG_BuildSpectatorString
@@ -1206,6 +1259,11 @@ static void CG_RegisterClients(void) {
 	CG_LoadingClient(cg.clientNum);
 	CG_NewClientInfo(cg.clientNum);
 
+	// the others start with a deferred model and are loaded by CG_StreamAssets
+	if (cg.streaming) {
+		cg.loading = qfalse;
+	}
+
 	for (i = 0; i < MAX_CLIENTS; i++) {
 		const char *clientInfo;
 
@@ -1336,6 +1394,9 @@ void CG_Init(int serverMessageNum, int serverCommandSequence, int clientNum) {
 
 	cg.loading = qtrue; // force players to load instead of defer
 
+	// load only what the first frames need, the rest follows during play
+	cg.streaming = cg_streamAssets.integer && !cg_buildScript.integer;
+
 	CG_LoadingString("sounds");
 
 	CG_RegisterSounds();
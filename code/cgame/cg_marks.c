@@ -39,6 +39,24 @@ markPoly_t *cg_freeMarkPolys;  // single linked list
 markPoly_t cg_markPolys[MAX_MARK_POLYS];
 static int markTotal;
 
+// fragments of temporary marks, which are asked for again every frame
+// with the same values as long as the entity stands still
+#define MARK_CACHE_SIZE 32 // must be a power of two
+#define MARK_CACHE_FRAGMENTS 16
+#define MARK_CACHE_POINTS 64
+
+typedef struct {
+	vec3_t origin;
+	vec3_t dir;
+	float orientation;
+	float radius;
+	int numFragments; // -1 if unused
+	markFragment_t fragments[MARK_CACHE_FRAGMENTS];
+	vec3_t points[MARK_CACHE_POINTS];
+} markCache_t;
+
+static markCache_t cg_markCache[MARK_CACHE_SIZE];
+
 /*
 ===================
 CG_InitMarkPolys
@@ -51,6 +69,10 @@ void CG_InitMarkPolys(void) {
 
 	memset(cg_markPolys, 0, sizeof(cg_markPolys));
 
+	for (i = 0; i < MARK_CACHE_SIZE; i++) {
+		cg_markCache[i].numFragments = -1;
+	}
+
 	cg_activeMarkPolys.nextMark = &cg_activeMarkPolys;
 	cg_activeMarkPolys.prevMark = &cg_activeMarkPolys;
 	cg_freeMarkPolys = cg_markPolys;
@@ -111,6 +133,63 @@ markPoly_t *CG_AllocMark(void) {
 	return le;
 }
 
+/*
+=================
+CG_CachedMarkFragments
+
+trap_CM_MarkFragments for temporary marks, reusing the result of an
+earlier call with the same mark
+=================
+*/
+static int CG_CachedMarkFragments(const vec3_t origin, const vec3_t dir, float orientation, float radius,
+								  const vec3_t *points, const vec3_t projection, int maxPoints, vec3_t pointBuffer,
+								  int maxFragments, markFragment_t *fragmentBuffer) {
+	markCache_t *mc;
+	unsigned hash;
+	int numFragments, numPoints;
+	int i;
+
+	hash = (unsigned)(int)origin[0] * 73856093u ^ (unsigned)(int)origin[1] * 19349663u ^
+		   (unsigned)(int)origin[2] * 83492791u;
+	mc = &cg_markCache[(hash ^ (hash >> 16)) & (MARK_CACHE_SIZE - 1)];
+
+	if (mc->numFragments >= 0 && VectorCompare(mc->origin, origin) && VectorCompare(mc->dir, dir) &&
+		mc->orientation == orientation && mc->radius == radius && mc->numFragments <= maxFragments) {
+		numPoints = 0;
+		for (i = 0; i < mc->numFragments; i++) {
+			numPoints += mc->fragments[i].numPoints;
+		}
+		if (numPoints <= maxPoints) {
+			memcpy(fragmentBuffer, mc->fragments, mc->numFragments * sizeof(mc->fragments[0]));
+			memcpy(pointBuffer, mc->points, numPoints * sizeof(mc->points[0]));
+			return mc->numFragments;
+		}
+	}
+
+	numFragments = trap_CM_MarkFragments(4, points, projection, maxPoints, pointBuffer, maxFragments, fragmentBuffer);
+
+	numPoints = 0;
+	for (i = 0; i < numFragments; i++) {
+		numPoints += fragmentBuffer[i].numPoints;
+	}
+
+	// too large ones are just not cached
+	if (numFragments > MARK_CACHE_FRAGMENTS || numPoints > MARK_CACHE_POINTS) {
+		mc->numFragments = -1;
+		return numFragments;
+	}
+
+	VectorCopy(origin, mc->origin);
+	VectorCopy(dir, mc->dir);
+	mc->orientation = orientation;
+	mc->radius = radius;
+	mc->numFragments = numFragments;
+	memcpy(mc->fragments, fragmentBuffer, numFragments * sizeof(mc->fragments[0]));
+	memcpy(mc->points, pointBuffer, numPoints * sizeof(mc->points[0]));
+
+	return numFragments;
+}
+
 /*
 =================
 CG_ImpactMark
@@ -183,8 +262,13 @@ void CG_ImpactMark(qhandle_t markShader, const vec3_t origin, const vec3_t dir,
 
 	// get the fragments
 	VectorScale(dir, -20, projection);
-	numFragments = trap_CM_MarkFragments(4, (void *)originalPoints, projection, MAX_MARK_POINTS, markPoints[0],
-										 MAX_MARK_FRAGMENTS, markFragments);
+	if (temporary) {
+		numFragments = CG_CachedMarkFragments(origin, dir, orientation, radius, (void *)originalPoints, projection,
+											  MAX_MARK_POINTS, markPoints[0], MAX_MARK_FRAGMENTS, markFragments);
+	} else {
+		numFragments = trap_CM_MarkFragments(4, (void *)originalPoints, projection, MAX_MARK_POINTS, markPoints[0],
+											 MAX_MARK_FRAGMENTS, markFragments);
+	}
 
 	if (!numFragments && markShader == cgs.media.SchaumShader) {
 		numFragments = 1;
@@ -238,14 +322,37 @@ void CG_ImpactMark(qhandle_t markShader, const vec3_t origin, const vec3_t dir,
 		mark->color[3] = alpha;
 		mark->radius = radius;
 		VectorCopy(origin, mark->origin);
+		VectorMA(origin, 4, axis[0], mark->pvsOrigin);
 		memcpy(mark->verts, verts, mf->numPoints * sizeof(verts[0]));
 		markTotal++;
 	}
 }
 
+/*
+===============
+CG_PortalInView
+
+A portal camera can show marks outside our own PVS
+===============
+*/
+qboolean CG_PortalInView(void) {
+	int i;
+
+	for (i = 0; i < cg.snap->numEntities; i++) {
+		if (cg.snap->entities[i].eType == ET_PORTAL) {
+			return qtrue;
+		}
+	}
+	return qfalse;
+}
+
 /*
 ===============
 CG_AddMarks
+
+Marks outside the view's PVS are skipped.  The fragments of one impact
+are next to each other in the list and share an origin, so the PVS is
+only tested once for each impact.
 ===============
 */
 #define MARK_TOTAL_TIME 10000
@@ -256,17 +363,33 @@ void CG_AddMarks(void) {
 	markPoly_t *mp, *next;
 	int t;
 	int fade;
+	qboolean cull, visible;
+	vec3_t lastOrigin;
 
 	if (!cg_addMarks.integer) {
 		return;
 	}
 
+	cull = !CG_PortalInView();
+	visible = qtrue;
+	VectorClear(lastOrigin);
+
 	mp = cg_activeMarkPolys.nextMark;
 	for (; mp != &cg_activeMarkPolys; mp = next) {
 		// grab next now, so if the local entity is freed we
 		// still have it
 		next = mp->nextMark;
 
+		if (cull && cg.time <= mp->time + MARK_TOTAL_TIME) {
+			if (mp == cg_activeMarkPolys.nextMark || !VectorCompare(mp->pvsOrigin, lastOrigin)) {
+				VectorCopy(mp->pvsOrigin, lastOrigin);
+				visible = trap_R_inPVS(cg.refdef.vieworg, mp->pvsOrigin);
+			}
+			if (!visible) {
+				continue;
+			}
+		}
+
 		if (mp->markShader == cgs.media.SchaumShader) {
 			if (cg.time > mp->time + 10000) {
 				CG_FreeMarkPoly(mp);
@@ -285,7 +408,7 @@ void CG_AddMarks(void) {
 				}
 			}
 
-			trap_R_AddPolyToScene(mp->markShader, mp->poly.numVerts, mp->verts);
+			CG_AddPolyBatched(mp->markShader, mp->poly.numVerts, mp->verts);
 			continue;
 		}
 
@@ -330,6 +453,8 @@ void CG_AddMarks(void) {
 			}
 		}
 
-		trap_R_AddPolyToScene(mp->markShader, mp->poly.numVerts, mp->verts);
+		CG_AddPolyBatched(mp->markShader, mp->poly.numVerts, mp->verts);
 	}
+
+	CG_FlushSceneBatches();
 }
@@ -759,9 +759,9 @@ void CG_AddParticleToScene(cparticle_t *p, vec3_t org, float alpha) {
 	}
 
 	if (p->type == P_WEATHER || p->type == P_WEATHER_TURBULENT || p->type == P_WEATHER_FLURRY)
-		trap_R_AddPolyToScene(p->pshader, 3, TRIverts);
+		CG_AddPolyBatched(p->pshader, 3, TRIverts);
 	else
-		trap_R_AddPolyToScene(p->pshader, 4, verts);
+		CG_AddPolyBatched(p->pshader, 4, verts);
 }
 
 // Ridah, made this static so it doesn't interfere with other files
@@ -879,6 +879,8 @@ void CG_AddParticles(void) {
 		CG_AddParticleToScene(p, org, alpha);
 	}
 
+	CG_FlushSceneBatches();
+
 	active_particles = active;
 }
 
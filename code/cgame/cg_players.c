@@ -308,15 +308,114 @@ static qboolean CG_ParseAnimationFile(const char *filename, clientInfo_t *ci) {
 	return qtrue;
 }
 
+/*
+==========================
+CG_LoadAnimationFile
+
+Players sharing a model share its animation.cfg, so the parsed
+result is kept instead of reading the file again for every skin
+==========================
+*/
+#define MAX_ANIMATION_CACHE 32
+
+typedef struct {
+	char filename[MAX_QPATH];
+	animation_t animations[MAX_TOTALANIMATIONS];
+	footstep_t footsteps;
+	vec3_t headOffset;
+	float headScale;
+	gender_t gender;
+	qboolean fixedlegs;
+	qboolean fixedtorso;
+} animationCache_t;
+
+static animationCache_t animationCache[MAX_ANIMATION_CACHE];
+static int numAnimationCache;
+
+static qboolean CG_LoadAnimationFile(const char *filename, clientInfo_t *ci) {
+	animationCache_t *ac;
+	int i;
+
+	for (i = 0, ac = animationCache; i < numAnimationCache; i++, ac++) {
+		if (!Q_stricmp(ac->filename, filename)) {
+			memcpy(ci->animations, ac->animations, sizeof(ci->animations));
+			ci->footsteps = ac->footsteps;
+			VectorCopy(ac->headOffset, ci->headOffset);
+			ci->headScale = ac->headScale;
+			ci->gender = ac->gender;
+			ci->fixedlegs = ac->fixedlegs;
+			ci->fixedtorso = ac->fixedtorso;
+			return qtrue;
+		}
+	}
+
+	if (!CG_ParseAnimationFile(filename, ci)) {
+		return qfalse;
+	}
+
+	if (numAnimationCache < MAX_ANIMATION_CACHE) {
+		ac = &animationCache[numAnimationCache++];
+		Q_strncpyz(ac->filename, filename, sizeof(ac->filename));
+		memcpy(ac->animations, ci->animations, sizeof(ac->animations));
+		ac->footsteps = ci->footsteps;
+		VectorCopy(ci->headOffset, ac->headOffset);
+		ac->headScale = ci->headScale;
+		ac->gender = ci->gender;
+		ac->fixedlegs = ci->fixedlegs;
+		ac->fixedtorso = ci->fixedtorso;
+	}
+
+	return qtrue;
+}
+
 /*
 ==========================
 CG_FileExists
+
+Model and skin probing asks for the same few names over and over,
+so the answers are remembered for the rest of the level
 ==========================
 */
+#define FILE_EXISTS_HASH_SIZE 256
+#define MAX_FILE_EXISTS_CACHE 512
+
+typedef struct fileExists_s {
+	char filename[MAX_QPATH];
+	qboolean exists;
+	struct fileExists_s *next;
+} fileExists_t;
+
+static fileExists_t fileExistsCache[MAX_FILE_EXISTS_CACHE];
+static fileExists_t *fileExistsHash[FILE_EXISTS_HASH_SIZE];
+static int numFileExistsCache;
+
 static qboolean CG_FileExists(const char *filename) {
+	fileExists_t *fe;
 	int len;
+	unsigned hash;
+
+	hash = 0;
+	for (len = 0; filename[len]; len++) {
+		hash = hash * 31 + tolower(filename[len]);
+	}
+	hash &= (FILE_EXISTS_HASH_SIZE - 1);
+
+	for (fe = fileExistsHash[hash]; fe; fe = fe->next) {
+		if (!Q_stricmp(fe->filename, filename)) {
+			return fe->exists;
+		}
+	}
 
 	len = trap_FS_FOpenFile(filename, 0, FS_READ);
+
+	if (numFileExistsCache < MAX_FILE_EXISTS_CACHE && strlen(filename) < MAX_QPATH) {
+		fe = &fileExistsCache[numFileExistsCache++];
+		Q_strncpyz(fe->filename, filename, sizeof(fe->filename));
+		fe->exists = (len > 0);
+		fe->next = fileExistsHash[hash];
+		fileExistsHash[hash] = fe;
+	}
+
 	if (len > 0) {
 		return qtrue;
 	}
@@ -537,7 +636,7 @@ static qboolean CG_RegisterClientModelname(clientInfo_t *ci, const char *modelNa
 
 	// load the animations
 	Com_sprintf(filename, sizeof(filename), "models/wop_players/%s/animation.cfg", modelName);
-	if (!CG_ParseAnimationFile(filename, ci)) {
+	if (!CG_LoadAnimationFile(filename, ci)) {
 		Com_Printf("Failed to load animation file %s\n", filename);
 		return qfalse;
 	}
@@ -969,7 +1068,7 @@ void CG_NewClientInfo(int clientNum) {
 		forceDefer = trap_MemoryRemaining() < 4000000;
 
 		// if we are defering loads, just have it pick the first valid
-		if (forceDefer || (cg_deferPlayers.integer && !cg_buildScript.integer && !cg.loading)) {
+		if (forceDefer || ((cg_deferPlayers.integer || cg.streaming) && !cg_buildScript.integer && !cg.loading)) {
 			// keep whatever they had if it won't violate team skins
 			CG_SetDeferredClientInfo(&newInfo);
 			// if we are low on memory, leave them with this model
@@ -1020,6 +1119,32 @@ void CG_LoadDeferredPlayers(void) {
 	}
 }
 
+/*
+======================
+CG_LoadDeferredPlayer
+
+Loads the first deferred player, returns qfalse if there is none
+======================
+*/
+qboolean CG_LoadDeferredPlayer(void) {
+	int i;
+	clientInfo_t *ci;
+
+	for (i = 0, ci = cgs.clientinfo; i < cgs.maxclients; i++, ci++) {
+		if (ci->infoValid && ci->deferred) {
+			// if we are low on memory, leave it deferred
+			if (trap_MemoryRemaining() < 4000000) {
+				CG_Printf("Memory is low.  Using deferred model.\n");
+				ci->deferred = qfalse;
+			} else {
+				CG_LoadClientInfo(ci);
+			}
+			return qtrue;
+		}
+	}
+	return qfalse;
+}
+
 /*
 =============================================================================
 
@@ -76,6 +76,305 @@ void CG_BuildSolidList(void) {
 	}
 }
 
+/*
+===============================================================================
+
+SOLID ENTITY INDEX
+
+Prediction runs pmove for every unacknowledged command and each move traces
+against all solid entities.  While it runs nothing moves, so the bounds of the
+solid entities are worked out once and bucketed into a coarse grid, letting a
+trace skip everything its swept box does not touch.  Bmodels are always tested
+since their clip bounds are not known here.
+
+===============================================================================
+*/
+
+#define SOLID_GRID_SIZE 16 // cells along each axis
+#define SOLID_GRID_MIN_CELL 256 // smallest cell edge, in units
+#define SOLID_GRID_MIN_ENTITIES 16 // below this a plain scan of the bounds is cheaper
+#define MAX_SOLID_GRID_ENTRIES 4096
+
+typedef struct {
+	vec3_t absmin, absmax;
+	vec3_t origin;
+	vec3_t bmins, bmaxs;
+} solidBounds_t;
+
+static qboolean cg_solidIndexValid;
+static solidBounds_t cg_solidBounds[MAX_ENTITIES_IN_SNAPSHOT];
+static int cg_numSolidBModels;
+static int cg_solidBModels[MAX_ENTITIES_IN_SNAPSHOT];
+
+static qboolean cg_solidGridValid;
+static vec2_t cg_solidGridOrigin;
+static float cg_solidGridCell;
+static int cg_solidGridStart[SOLID_GRID_SIZE * SOLID_GRID_SIZE + 1];
+static int cg_solidGridEntries[MAX_SOLID_GRID_ENTRIES];
+static int cg_solidStamps[MAX_ENTITIES_IN_SNAPSHOT];
+static int cg_solidStamp;
+
+/*
+====================
+CG_SolidGridRange
+
+Returns the cells covered by the given bounds, clamped to the grid
+====================
+*/
+static void CG_SolidGridRange(const vec3_t mins, const vec3_t maxs, int *x0, int *y0, int *x1, int *y1) {
+	float v[4];
+	int i;
+
+	v[0] = (mins[0] - cg_solidGridOrigin[0]) / cg_solidGridCell;
+	v[1] = (mins[1] - cg_solidGridOrigin[1]) / cg_solidGridCell;
+	v[2] = (maxs[0] - cg_solidGridOrigin[0]) / cg_solidGridCell;
+	v[3] = (maxs[1] - cg_solidGridOrigin[1]) / cg_solidGridCell;
+
+	for (i = 0; i < 4; i++) {
+		if (v[i] < 0) {
+			v[i] = 0;
+		} else if (v[i] > SOLID_GRID_SIZE - 1) {
+			v[i] = SOLID_GRID_SIZE - 1;
+		}
+	}
+
+	*x0 = (int)v[0];
+	*y0 = (int)v[1];
+	*x1 = (int)v[2];
+	*y1 = (int)v[3];
+}
+
+/*
+====================
+CG_BuildSolidGrid
+====================
+*/
+static void CG_BuildSolidGrid(void) {
+	int i, x, y, x0, y0, x1, y1, total;
+	vec2_t mins, maxs;
+	float extent;
+	solidBounds_t *b;
+
+	cg_solidGridValid = qfalse;
+
+	if (cg_numSolidEntities - cg_numSolidBModels < SOLID_GRID_MIN_ENTITIES) {
+		return;
+	}
+
+	mins[0] = mins[1] = 999999;
+	maxs[0] = maxs[1] = -999999;
+	for (i = 0; i < cg_numSolidEntities; i++) {
+		if (cg_solidEntities[i]->currentState.solid == SOLID_BMODEL) {
+			continue;
+		}
+		b = &cg_solidBounds[i];
+		for (x = 0; x < 2; x++) {
+			if (b->absmin[x] < mins[x]) {
+				mins[x] = b->absmin[x];
+			}
+			if (b->absmax[x] > maxs[x]) {
+				maxs[x] = b->absmax[x];
+			}
+		}
+	}
+
+	extent = maxs[0] - mins[0];
+	if (maxs[1] - mins[1] > extent) {
+		extent = maxs[1] - mins[1];
+	}
+	cg_solidGridCell = extent / SOLID_GRID_SIZE;
+	if (cg_solidGridCell < SOLID_GRID_MIN_CELL) {
+		cg_solidGridCell = SOLID_GRID_MIN_CELL;
+	}
+	cg_solidGridOrigin[0] = mins[0];
+	cg_solidGridOrigin[1] = mins[1];
+
+	// count the entries for each cell
+	memset(cg_solidGridStart, 0, sizeof(cg_solidGridStart));
+	total = 0;
+	for (i = 0; i < cg_numSolidEntities; i++) {
+		if (cg_solidEntities[i]->currentState.solid == SOLID_BMODEL) {
+			continue;
+		}
+		b = &cg_solidBounds[i];
+		CG_SolidGridRange(b->absmin, b->absmax, &x0, &y0, &x1, &y1);
+		for (y = y0; y <= y1; y++) {
+			for (x = x0; x <= x1; x++) {
+				cg_solidGridStart[y * SOLID_GRID_SIZE + x + 1]++;
+			}
+		}
+		total += (x1 - x0 + 1) * (y1 - y0 + 1);
+	}
+
+	if (total > MAX_SOLID_GRID_ENTRIES) {
+		return;
+	}
+
+	for (i = 0; i < SOLID_GRID_SIZE * SOLID_GRID_SIZE; i++) {
+		cg_solidGridStart[i + 1] += cg_solidGridStart[i];
+	}
+
+	// fill the cells, using the start of the next cell as a cursor
+	for (i = 0; i < cg_numSolidEntities; i++) {
+		if (cg_solidEntities[i]->currentState.solid == SOLID_BMODEL) {
+			continue;
+		}
+		b = &cg_solidBounds[i];
+		CG_SolidGridRange(b->absmin, b->absmax, &x0, &y0, &x1, &y1);
+		for (y = y0; y <= y1; y++) {
+			for (x = x0; x <= x1; x++) {
+				cg_solidGridEntries[cg_solidGridStart[y * SOLID_GRID_SIZE + x]++] = i;
+			}
+		}
+	}
+
+	// the cursors now sit at the end of each cell, shift them back
+	for (i = SOLID_GRID_SIZE * SOLID_GRID_SIZE; i > 0; i--) {
+		cg_solidGridStart[i] = cg_solidGridStart[i - 1];
+	}
+	cg_solidGridStart[0] = 0;
+
+	cg_solidGridValid = qtrue;
+}
+
+/*
+====================
+CG_BeginSolidIndex
+
+Called once cg.physicsTime is set for a prediction pass.  The index is only
+valid until CG_EndSolidIndex, since entity origins change every frame.
+====================
+*/
+static void CG_BeginSolidIndex(void) {
+	int i, x, zd, zu;
+	centity_t *cent;
+	entityState_t *ent;
+	solidBounds_t *b;
+
+	cg_numSolidBModels = 0;
+
+	for (i = 0; i < cg_numSolidEntities; i++) {
+		cent = cg_solidEntities[i];
+		ent = &cent->currentState;
+
+		if (ent->solid == SOLID_BMODEL) {
+			cg_solidBModels[cg_numSolidBModels++] = i;
+			continue;
+		}
+
+		b = &cg_solidBounds[i];
+
+		// encoded bbox
+		x = (ent->solid & 255);
+		zd = ((ent->solid >> 8) & 255);
+		zu = ((ent->solid >> 16) & 255) - 32;
+
+		b->bmins[0] = b->bmins[1] = -x;
+		b->bmaxs[0] = b->bmaxs[1] = x;
+		b->bmins[2] = -zd;
+		b->bmaxs[2] = zu;
+
+		VectorCopy(cent->lerpOrigin, b->origin);
+
+		// pad a little so clip epsilons never drop a touching entity
+		VectorAdd(b->origin, b->bmins, b->absmin);
+		VectorAdd(b->origin, b->bmaxs, b->absmax);
+		for (x = 0; x < 3; x++) {
+			b->absmin[x] -= 1;
+			b->absmax[x] += 1;
+		}
+	}
+
+	CG_BuildSolidGrid();
+
+	cg_solidIndexValid = qtrue;
+}
+
+/*
+====================
+CG_EndSolidIndex
+====================
+*/
+static void CG_EndSolidIndex(void) {
+	cg_solidIndexValid = qfalse;
+}
+
+/*
+====================
+CG_SolidCandidates
+
+Fills list with the solid entities whose bounds touch the swept box, in the
+same order as cg_solidEntities so ties resolve as they did with a full scan
+====================
+*/
+static int CG_SolidCandidates(const vec3_t start, const vec3_t mins, const vec3_t maxs, const vec3_t end, int *list) {
+	int i, j, k, n, x, y, x0, y0, x1, y1;
+	vec3_t smins, smaxs;
+	solidBounds_t *b;
+
+	for (i = 0; i < 3; i++) {
+		if (start[i] < end[i]) {
+			smins[i] = start[i] + mins[i];
+			smaxs[i] = end[i] + maxs[i];
+		} else {
+			smins[i] = end[i] + mins[i];
+			smaxs[i] = start[i] + maxs[i];
+		}
+	}
+
+	n = 0;
+	for (i = 0; i < cg_numSolidBModels; i++) {
+		list[n++] = cg_solidBModels[i];
+	}
+
+	if (!cg_solidGridValid) {
+		for (i = 0; i < cg_numSolidEntities; i++) {
+			if (cg_solidEntities[i]->currentState.solid == SOLID_BMODEL) {
+				continue;
+			}
+			b = &cg_solidBounds[i];
+			if (b->absmin[0] > smaxs[0] || b->absmin[1] > smaxs[1] || b->absmin[2] > smaxs[2] ||
+				b->absmax[0] < smins[0] || b->absmax[1] < smins[1] || b->absmax[2] < smins[2]) {
+				continue;
+			}
+			list[n++] = i;
+		}
+	} else {
+		cg_solidStamp++;
+		CG_SolidGridRange(smins, smaxs, &x0, &y0, &x1, &y1);
+		for (y = y0; y <= y1; y++) {
+			for (x = x0; x <= x1; x++) {
+				for (j = cg_solidGridStart[y * SOLID_GRID_SIZE + x]; j < cg_solidGridStart[y * SOLID_GRID_SIZE + x + 1];
+					 j++) {
+					i = cg_solidGridEntries[j];
+					if (cg_solidStamps[i] == cg_solidStamp) {
+						continue;
+					}
+					cg_solidStamps[i] = cg_solidStamp;
+
+					b = &cg_solidBounds[i];
+					if (b->absmin[0] > smaxs[0] || b->absmin[1] > smaxs[1] || b->absmin[2] > smaxs[2] ||
+						b->absmax[0] < smins[0] || b->absmax[1] < smins[1] || b->absmax[2] < smins[2]) {
+						continue;
+					}
+					list[n++] = i;
+				}
+			}
+		}
+	}
+
+	// restore snapshot order, the list is short so an insertion sort will do
+	for (i = 1; i < n; i++) {
+		k = list[i];
+		for (j = i - 1; j >= 0 && list[j] > k; j--) {
+			list[j + 1] = list[j];
+		}
+		list[j + 1] = k;
+	}
+
+	return n;
+}
+
 /*
 ====================
 CG_ClipMoveToEntities
@@ -84,27 +383,45 @@ CG_ClipMoveToEntities
 */
 static void CG_ClipMoveToEntities(const vec3_t start, const vec3_t mins, const vec3_t maxs, const vec3_t end,
 								  int skipNumber, int mask, trace_t *tr) {
-	int i, x, zd, zu;
+	int i, n, x, zd, zu;
+	int list[MAX_ENTITIES_IN_SNAPSHOT];
 	trace_t trace;
 	entityState_t *ent;
 	clipHandle_t cmodel;
 	vec3_t bmins, bmaxs;
 	vec3_t origin, angles;
 	centity_t *cent;
+	solidBounds_t *b;
 
-	for (i = 0; i < cg_numSolidEntities; i++) {
-		cent = cg_solidEntities[i];
+	if (cg_solidIndexValid) {
+		n = CG_SolidCandidates(start, mins, maxs, end, list);
+	} else {
+		n = cg_numSolidEntities;
+	}
+
+	for (i = 0; i < n; i++) {
+		cent = cg_solidEntities[cg_solidIndexValid ? list[i] : i];
 		ent = &cent->currentState;
 
 		if (ent->number == skipNumber) {
 			continue;
 		}
 
+		// the temp box is CONTENTS_BODY, it can't block anything else
+		if (ent->solid != SOLID_BMODEL && !(mask & CONTENTS_BODY)) {
+			continue;
+		}
+
 		if (ent->solid == SOLID_BMODEL) {
 			// special value for bmodel
 			cmodel = trap_CM_InlineModel(ent->modelindex);
 			VectorCopy(cent->lerpAngles, angles);
 			BG_EvaluateTrajectory(&cent->currentState.pos, cg.physicsTime, origin);
+			trap_CM_TransformedBoxTrace(&trace, start, end, mins, maxs, cmodel, mask, origin, angles);
+		} else if (cg_solidIndexValid) {
+			// same as a trace against trap_CM_TempBoxModel, without the syscalls
+			b = &cg_solidBounds[list[i]];
+			BoxTraceBox(&trace, start, end, mins, maxs, b->bmins, b->bmaxs, b->origin, mask);
 		} else {
 			// encoded bbox
 			x = (ent->solid & 255);
@@ -116,13 +433,9 @@ static void CG_ClipMoveToEntities(const vec3_t start, const vec3_t mins, const v
 			bmins[2] = -zd;
 			bmaxs[2] = zu;
 
-			cmodel = trap_CM_TempBoxModel(bmins, bmaxs);
-			VectorCopy(vec3_origin, angles);
-			VectorCopy(cent->lerpOrigin, origin);
+			BoxTraceBox(&trace, start, end, mins, maxs, bmins, bmaxs, cent->lerpOrigin, mask);
 		}
 
-		trap_CM_TransformedBoxTrace(&trace, start, end, mins, maxs, cmodel, mask, origin, angles);
-
 		if (trace.allsolid || trace.fraction < tr->fraction) {
 			trace.entityNum = ent->number;
 			*tr = trace;
@@ -398,9 +711,9 @@ For normal gameplay, it will be the result of predicted usercmd_t on
 top of the most recent playerState_t received from the server.
 
 Each new snapshot will usually have one or more new usercmd over the last,
-but we simulate all unacknowledged commands each time, not just the new ones.
-This means that on an internet connection, quite a few pmoves may be issued
-each frame.
+and we simulate all unacknowledged commands on top of it.  Until the next
+snapshot arrives the result is kept, so later frames only run the commands
+created since (cg_optimizePrediction).
 
 OPTIMIZE: don't re-simulate unless the newly arrived snapshot playerState_t
 differs from the predicted one.  Would require saving all intermediate
@@ -413,7 +726,7 @@ to ease the jerk.
 void CG_PredictPlayerState(void) {
 	int cmdNum, current;
 	playerState_t oldPlayerState;
-	qboolean moved;
+	qboolean moved, resumed;
 	usercmd_t oldestCmd;
 	usercmd_t latestCmd;
 
@@ -429,12 +742,14 @@ void CG_PredictPlayerState(void) {
 
 	// demo playback just copies the moves
 	if (cg.demoPlayback || (cg.snap->ps.pm_flags & PMF_FOLLOW)) {
+		cg.pmoveStateValid = qfalse;
 		CG_InterpolatePlayerState(qfalse);
 		return;
 	}
 
 	// non-predicting local movement will grab the latest angles
 	if (cg_nopredict.integer || cg_synchronousClients.integer) {
+		cg.pmoveStateValid = qfalse;
 		CG_InterpolatePlayerState(qtrue);
 		return;
 	}
@@ -468,6 +783,7 @@ void CG_PredictPlayerState(void) {
 		if (cg_showmiss.integer) {
 			CG_Printf("exceeded PACKET_BACKUP on commands\n");
 		}
+		cg.pmoveStateValid = qfalse;
 		return;
 	}
 
@@ -486,6 +802,8 @@ void CG_PredictPlayerState(void) {
 		cg.physicsTime = cg.snap->serverTime;
 	}
 
+	CG_BeginSolidIndex();
+
 	if (pmove_msec.integer < 8) {
 		trap_Cvar_Set("pmove_msec", "8");
 		trap_Cvar_Update(&pmove_msec);
@@ -497,9 +815,32 @@ void CG_PredictPlayerState(void) {
 	cg_pmove.pmove_fixed = pmove_fixed.integer;
 	cg_pmove.pmove_msec = pmove_msec.integer;
 
+	// commands never change once created, so while the base snapshot and
+	// the pmove settings are the same as last frame, carry on from the
+	// state the last prediction ended with instead of starting over
+	cmdNum = current - CMD_BACKUP + 1;
+	resumed = qfalse;
+	if (cg_optimizePrediction.integer && cg.pmoveStateValid && !cg.thisFrameTeleport && !cg.nextFrameTeleport &&
+		cg.pmoveBaseTime == cg.physicsTime && cg.pmoveBaseCommandTime == cg.predictedPlayerState.commandTime &&
+		cg.pmoveTracemask == cg_pmove.tracemask && cg.pmoveFixed == cg_pmove.pmove_fixed &&
+		cg.pmoveMsec == cg_pmove.pmove_msec && cg.pmoveNoFootsteps == cg_pmove.noFootsteps &&
+		cg.pmoveCommand >= cmdNum && cg.pmoveCommand <= current) {
+		cg.predictedPlayerState = cg.pmoveState;
+		cg.hyperspace = cg.pmoveHyperspace;
+		cmdNum = cg.pmoveCommand + 1;
+		resumed = qtrue;
+	} else {
+		cg.pmoveBaseTime = cg.physicsTime;
+		cg.pmoveBaseCommandTime = cg.predictedPlayerState.commandTime;
+		cg.pmoveTracemask = cg_pmove.tracemask;
+		cg.pmoveFixed = cg_pmove.pmove_fixed;
+		cg.pmoveMsec = cg_pmove.pmove_msec;
+		cg.pmoveNoFootsteps = cg_pmove.noFootsteps;
+	}
+
 	// run cmds
-	moved = qfalse;
-	for (cmdNum = current - CMD_BACKUP + 1; cmdNum <= current; cmdNum++) {
+	moved = resumed ? cg.pmoveMoved : qfalse;
+	for (; cmdNum <= current; cmdNum++) {
 		// get the command
 		trap_GetUserCmd(cmdNum, &cg_pmove.cmd);
 
@@ -522,7 +863,8 @@ void CG_PredictPlayerState(void) {
 		// from the snapshot, but on a wan we will have
 		// to predict several commands to get to the point
 		// we want to compare
-		if (cg.predictedPlayerState.commandTime == oldPlayerState.commandTime) {
+		// a resumed prediction is already past that point
+		if (!resumed && cg.predictedPlayerState.commandTime == oldPlayerState.commandTime) {
 			vec3_t delta;
 			float len;
 
@@ -592,6 +934,14 @@ void CG_PredictPlayerState(void) {
 		// CG_CheckChangedPredictableEvents(&cg.predictedPlayerState);
 	}
 
+	CG_EndSolidIndex();
+
+	cg.pmoveStateValid = qtrue;
+	cg.pmoveState = cg.predictedPlayerState;
+	cg.pmoveCommand = current;
+	cg.pmoveMoved = moved;
+	cg.pmoveHyperspace = cg.hyperspace;
+
 	if (cg_showmiss.integer > 1) {
 		CG_Printf("[%i : %i] ", cg_pmove.cmd.serverTime, cg.time);
 	}
@@ -156,6 +156,10 @@ typedef enum {
 	// 1.32
 	CG_FS_SEEK,
 	CG_GET_VOIP_TIMES,
+	CG_CVAR_GENERATION, // ( void );
+	// changes whenever any cvar changed, CG_CVAR_UPDATE can be skipped while it doesn't
+	CG_R_ADDREFENTITIESTOSCENE, // ( const refEntity_t *ents, int numEnts );
+	CG_R_DRAWSTRETCHPICS,		// ( const stretchPic_t *pics, int numPics, qhandle_t hShader );
 	/*
 		CG_LOADCAMERA,
 		CG_STARTCAMERA,
@@ -173,7 +177,9 @@ typedef enum {
 	CG_CEIL,
 	CG_TESTPRINTINT,
 	CG_TESTPRINTFLOAT,
-	CG_ACOS
+	CG_ACOS,
+	CG_MEMMOVE,
+	CG_STRLEN
 } cgameImport_t;
 
 /*
@@ -26,6 +26,63 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 #include "cg_local.h"
 
+/*
+=================
+CG_ParseScoreRow
+
+Reads the client number and fields of a scoreboard row into the client's
+entry of cg.clientScores, returns the client number or -1
+=================
+*/
+static int CG_ParseScoreRow(int arg) {
+	score_t *score;
+	int client;
+
+	client = atoi(CG_Argv(arg));
+	if (client < 0 || client >= MAX_CLIENTS) {
+		return -1;
+	}
+
+	score = &cg.clientScores[client];
+	score->client = client;
+	score->score = atoi(CG_Argv(arg + 1));
+	score->ping = atoi(CG_Argv(arg + 2));
+	score->time = atoi(CG_Argv(arg + 3));
+	score->scoreFlags = atoi(CG_Argv(arg + 4));
+	score->powerUps = atoi(CG_Argv(arg + 5));
+	score->accuracy = atoi(CG_Argv(arg + 6));
+	score->impressiveCount = atoi(CG_Argv(arg + 7));
+	score->excellentCount = atoi(CG_Argv(arg + 8));
+	score->guantletCount = atoi(CG_Argv(arg + 9));
+	score->defendCount = atoi(CG_Argv(arg + 10));
+	score->assistCount = atoi(CG_Argv(arg + 11));
+	score->perfect = atoi(CG_Argv(arg + 12));
+	score->captures = atoi(CG_Argv(arg + 13));
+	score->spraygod = atoi(CG_Argv(arg + 14));
+	score->spraykiller = atoi(CG_Argv(arg + 15));
+	score->livesleft = atoi(CG_Argv(arg + 16));
+	return client;
+}
+
+/*
+=================
+CG_SetScore
+
+Puts a client's row at a place of the scoreboard
+=================
+*/
+static void CG_SetScore(int i, int client) {
+	cg.scores[i] = cg.clientScores[client];
+	cg.scores[i].client = client;
+
+	cgs.clientinfo[client].score = cg.scores[i].score;
+	cgs.clientinfo[client].powerups = cg.scores[i].powerUps;
+
+	cg.scores[i].team = cgs.clientinfo[client].team;
+	if (cg.scores[i].team >= TEAM_FREE && cg.scores[i].team <= TEAM_SPECTATOR)
+		cg.scoreTeamCount[cg.scores[i].team]++;
+}
+
 /*
 =================
 CG_ParseScores
@@ -33,7 +90,7 @@ CG_ParseScores
 =================
 */
 static void CG_ParseScores(void) {
-	int i, powerups;
+	int i, client;
 
 	cg.numScores = atoi(CG_Argv(1));
 	if (cg.numScores > MAX_CLIENTS) {
@@ -48,37 +105,73 @@ static void CG_ParseScores(void) {
 
 	memset(cg.scores, 0, sizeof(cg.scores));
 	for (i = 0; i < cg.numScores; i++) {
-		//
-		// i*14 zu i*17 um geändert
-
-		cg.scores[i].client = atoi(CG_Argv(i * 17 + 4));
-		cg.scores[i].score = atoi(CG_Argv(i * 17 + 5));
-		cg.scores[i].ping = atoi(CG_Argv(i * 17 + 6));
-		cg.scores[i].time = atoi(CG_Argv(i * 17 + 7));
-		cg.scores[i].scoreFlags = atoi(CG_Argv(i * 17 + 8));
-		powerups = atoi(CG_Argv(i * 17 + 9));
-		cg.scores[i].accuracy = atoi(CG_Argv(i * 17 + 10));
-		cg.scores[i].impressiveCount = atoi(CG_Argv(i * 17 + 11));
-		cg.scores[i].excellentCount = atoi(CG_Argv(i * 17 + 12));
-		cg.scores[i].guantletCount = atoi(CG_Argv(i * 17 + 13));
-		cg.scores[i].defendCount = atoi(CG_Argv(i * 17 + 14));
-		cg.scores[i].assistCount = atoi(CG_Argv(i * 17 + 15));
-		cg.scores[i].perfect = atoi(CG_Argv(i * 17 + 16));
-		cg.scores[i].captures = atoi(CG_Argv(i * 17 + 17));
-		cg.scores[i].spraygod = atoi(CG_Argv(i * 17 + 18)); // noch mal ändern ... oder stimmt das doch?
-		cg.scores[i].spraykiller = atoi(CG_Argv(i * 17 + 19));
-		cg.scores[i].livesleft = atoi(CG_Argv(i * 17 + 20));
-
-		if (cg.scores[i].client < 0 || cg.scores[i].client >= MAX_CLIENTS) {
-			cg.scores[i].client = 0;
+		client = CG_ParseScoreRow(i * 17 + 4);
+		if (client < 0) {
+			client = 0;
+		}
+		CG_SetScore(i, client);
+	}
+
+	cg.scoreRowsValid = qtrue;
+}
+
+static int CG_HexDigit(char c) {
+	if (c >= '0' && c <= '9') {
+		return c - '0';
+	}
+	if (c >= 'a' && c <= 'f') {
+		return c - 'a' + 10;
+	}
+	return 0;
+}
+
+/*
+=================
+CG_ParseScoreDelta
+
+"scored" has the team scores, the ranking as two hex digits per client
+and only the rows that changed since the last update
+=================
+*/
+static void CG_ParseScoreDelta(void) {
+	const char *order;
+	int i, numRows, client;
+
+	// the rows it builds on are missing after a cgame restart
+	if (!cg.scoreRowsValid) {
+		if (cg.scoresRequestTime + 2000 < cg.time) {
+			cg.scoresRequestTime = cg.time;
+			trap_SendClientCommand("score");
 		}
-		cgs.clientinfo[cg.scores[i].client].score = cg.scores[i].score;
-		cgs.clientinfo[cg.scores[i].client].powerups = powerups;
+		return;
+	}
+
+	cg.teamScores[0] = atoi(CG_Argv(1));
+	cg.teamScores[1] = atoi(CG_Argv(2));
+
+	cg.numScores = atoi(CG_Argv(3));
+	if (cg.numScores > MAX_CLIENTS) {
+		cg.numScores = MAX_CLIENTS;
+	}
+
+	numRows = atoi(CG_Argv(5));
+	for (i = 0; i < numRows && i < MAX_CLIENTS; i++) {
+		CG_ParseScoreRow(i * 17 + 6);
+	}
 
-		cg.scores[i].team = cgs.clientinfo[cg.scores[i].client].team;
-		//		if(cgs.gametype<GT_TEAM && cg.scores[i].team==TEAM_FREE) cg.numFFAplayers++;
-		if (cg.scores[i].team >= TEAM_FREE && cg.scores[i].team <= TEAM_SPECTATOR)
-			cg.scoreTeamCount[cg.scores[i].team]++;
+	order = CG_Argv(4);
+	if ((int)strlen(order) < cg.numScores * 2) {
+		cg.numScores = strlen(order) / 2;
+	}
+
+	memset(cg.scoreTeamCount, 0, sizeof(cg.scoreTeamCount));
+	memset(cg.scores, 0, sizeof(cg.scores));
+	for (i = 0; i < cg.numScores; i++) {
+		client = (CG_HexDigit(order[i * 2]) << 4) | CG_HexDigit(order[i * 2 + 1]);
+		if (client >= MAX_CLIENTS) {
+			client = 0;
+		}
+		CG_SetScore(i, client);
 	}
 }
 
@@ -618,6 +711,11 @@ static void CG_ServerCommand(void) {
 		return;
 	}
 
+	if (!strcmp(cmd, "scored")) {
+		CG_ParseScoreDelta();
+		return;
+	}
+
 	if (!strcmp(cmd, "tinfo")) {
 		CG_ParseTeamInfo();
 		return;
@@ -200,7 +200,9 @@ static void CG_SetNextSnap(snapshot_t *snap) {
 	cg.nextSnap = snap;
 
 	BG_PlayerStateToEntityState(&snap->ps, &cg_entities[snap->ps.clientNum].nextState, qfalse);
+	cg_entities[snap->ps.clientNum].lerpCached = qfalse;
 	cg_entities[cg.snap->ps.clientNum].interpolate = qtrue;
+	cg_entities[cg.snap->ps.clientNum].lerpCached = qfalse;
 
 	// check for extrapolation errors
 	for (num = 0; num < snap->numEntities; num++) {
@@ -209,6 +211,7 @@ static void CG_SetNextSnap(snapshot_t *snap) {
 
 		memcpy(&cent->nextState, es, sizeof(entityState_t));
 		// cent->nextState = *es;
+		cent->lerpCached = qfalse;
 
 		// if this frame is a teleport, or the entity wasn't in the
 		// previous frame, don't interpolate
@@ -39,6 +39,8 @@ typedef struct logoPoly_s {
 	vec3_t center;
 	float radius;
 	int level;
+
+	vec3_t pvsOrigin; // center pulled off the wall, for PVS tests
 } logoPoly_t;
 
 static logoPoly_t *freeLogoPolys; // last freepoly ... we add and take from the end of the list
@@ -466,6 +468,7 @@ void Add_LogoToDrawList(const vec3_t origin, vec3_t dir, qhandle_t shader, float
 		}
 
 		VectorCopy(origin, lp->center);
+		VectorMA(origin, 4, axis[0], lp->pvsOrigin);
 		lp->radius = radius;
 		lp->level = level;
 
@@ -504,7 +507,8 @@ void Add_LogoToDrawList(const vec3_t origin, vec3_t dir, qhandle_t shader, float
 #######################
 AddLogosToScene
 
-TODO: write some info ;)
+Logos outside the PVS are skipped, the fragments of one logo are tested together.
+Colors are only touched while a logo fades out.
 #######################
 */
 #define LOGOFADEOUT_DONOTHING 90000 // 180000
@@ -514,6 +518,12 @@ void AddLogosToScene(void) {
 	logoPoly_t *lp, *tmplp;
 	float fadeout;
 	int i;
+	qboolean cull, visible;
+	vec3_t lastOrigin;
+
+	cull = !CG_PortalInView();
+	visible = qtrue;
+	VectorClear(lastOrigin);
 
 	lp = drawLogoPolys;
 	// tmplp=NULL;
@@ -533,21 +543,36 @@ void AddLogosToScene(void) {
 			continue;
 		}
 
+		if (cull) {
+			if (lp == drawLogoPolys || !VectorCompare(lp->pvsOrigin, lastOrigin)) {
+				VectorCopy(lp->pvsOrigin, lastOrigin);
+				visible = trap_R_inPVS(cg.refdef.vieworg, lp->pvsOrigin);
+			}
+			if (!visible) {
+				lp = lp->nextPoly;
+				continue;
+			}
+		}
+
 		// maybe I will fade color as well
-		for (i = 0; i < lp->numVerts; i++) {
-			lp->verts[i].modulate[0] = (int)(lp->color[0] * fadeout * 255.0f);
-			lp->verts[i].modulate[1] = (int)(lp->color[1] * fadeout * 255.0f);
-			lp->verts[i].modulate[2] = (int)(lp->color[2] * fadeout * 255.0f);
-			lp->verts[i].modulate[3] = (int)(lp->color[3] * fadeout * 255.0f);
+		if (fadeout < 1.0f) {
+			for (i = 0; i < lp->numVerts; i++) {
+				lp->verts[i].modulate[0] = (int)(lp->color[0] * fadeout * 255.0f);
+				lp->verts[i].modulate[1] = (int)(lp->color[1] * fadeout * 255.0f);
+				lp->verts[i].modulate[2] = (int)(lp->color[2] * fadeout * 255.0f);
+				lp->verts[i].modulate[3] = (int)(lp->color[3] * fadeout * 255.0f);
+			}
 		}
 
 		// add to scene ;)
-		trap_R_AddPolyToScene(lp->logoShader, lp->numVerts, lp->verts);
+		CG_AddPolyBatched(lp->logoShader, lp->numVerts, lp->verts);
 
 		// tmplp=lp;
 		lp = lp->nextPoly;
 	}
 	// if (tmplp != lastdrawLogoPolys) { Com_Printf(S_COLOR_RED "last drawn Logo wasn't lastdrawLogoPolys-ptr\n"); }
+
+	CG_FlushSceneBatches();
 }
 
 qboolean CursorInBox(int x, int y, int w, int h) {
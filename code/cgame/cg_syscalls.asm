@@ -91,6 +91,9 @@ equ	trap_R_AddPolysToScene				-88
 equ trap_R_inPVS						-89
 equ trap_FS_Seek			-90
 equ trap_GetVoipTimes		-91
+equ trap_Cvar_Generation	-92
+equ trap_R_AddRefEntitiesToScene	-93
+equ trap_R_DrawStretchPics		-94
 
 equ	memset						-101
 equ	memcpy						-102
@@ -104,4 +107,6 @@ equ	ceil						-109
 equ	testPrintInt				-110
 equ	testPrintFloat				-111
 equ acos						-112
+equ	memmove						-113
+equ	strlen						-114
 
@@ -61,6 +61,10 @@ void trap_Cvar_Update(vmCvar_t *vmCvar) {
 	syscall(CG_CVAR_UPDATE, vmCvar);
 }
 
+int trap_Cvar_Generation(void) {
+	return syscall(CG_CVAR_GENERATION);
+}
+
 void trap_Cvar_Set(const char *var_name, const char *value) {
 	syscall(CG_CVAR_SET, var_name, value);
 }
@@ -249,6 +253,10 @@ void trap_R_AddRefEntityToScene(const refEntity_t *re) {
 	syscall(CG_R_ADDREFENTITYTOSCENE, re);
 }
 
+void trap_R_AddRefEntitiesToScene(const refEntity_t *ents, int numEnts) {
+	syscall(CG_R_ADDREFENTITIESTOSCENE, ents, numEnts);
+}
+
 void trap_R_AddPolyToScene(qhandle_t hShader, int numVerts, const polyVert_t *verts) {
 	syscall(CG_R_ADDPOLYTOSCENE, hShader, numVerts, verts);
 }
@@ -283,6 +291,10 @@ void trap_R_DrawStretchPic(float x, float y, float w, float h, float s1, float t
 			PASSFLOAT(s2), PASSFLOAT(t2), hShader);
 }
 
+void trap_R_DrawStretchPics(const stretchPic_t *pics, int numPics, qhandle_t hShader) {
+	syscall(CG_R_DRAWSTRETCHPICS, pics, numPics, hShader);
+}
+
 void trap_R_ModelBounds(clipHandle_t model, vec3_t mins, vec3_t maxs) {
 	syscall(CG_R_MODELBOUNDS, model, mins, maxs);
 }
@@ -827,6 +827,82 @@ static void CG_PlayBufferedSounds(void) {
 	}
 }
 
+/*
+=============================================================================
+
+  SCENE BATCHING
+
+Effects that submit many entities or polys a frame queue them here and
+hand them to the renderer an array at a time, instead of one syscall
+each.  Poly runs are never reordered, so blending comes out as before.
+
+=============================================================================
+*/
+
+#define MAX_BATCH_REFENTITIES 64
+#define MAX_BATCH_POLYS 256
+
+static refEntity_t batchEntities[MAX_BATCH_REFENTITIES];
+static int numBatchEntities;
+
+static polyVert_t batchVerts[MAX_BATCH_POLYS * 4]; // shared by polys of any size
+static qhandle_t batchShader;
+static int batchPolyVerts; // per poly
+static int numBatchPolys;
+
+/*
+=====================
+CG_FlushSceneBatches
+
+Must be called before the scene is rendered
+=====================
+*/
+void CG_FlushSceneBatches(void) {
+	if (numBatchEntities) {
+		trap_R_AddRefEntitiesToScene(batchEntities, numBatchEntities);
+		numBatchEntities = 0;
+	}
+
+	if (numBatchPolys) {
+		trap_R_AddPolysToScene(batchShader, batchPolyVerts, batchVerts, numBatchPolys);
+		numBatchPolys = 0;
+	}
+}
+
+/*
+=====================
+CG_AddRefEntityBatched
+=====================
+*/
+void CG_AddRefEntityBatched(const refEntity_t *re) {
+	if (numBatchEntities == MAX_BATCH_REFENTITIES) {
+		trap_R_AddRefEntitiesToScene(batchEntities, numBatchEntities);
+		numBatchEntities = 0;
+	}
+
+	batchEntities[numBatchEntities++] = *re;
+}
+
+/*
+=====================
+CG_AddPolyBatched
+
+Polys of up to MAX_VERTS_ON_POLY verts
+=====================
+*/
+void CG_AddPolyBatched(qhandle_t hShader, int numVerts, const polyVert_t *verts) {
+	if (numBatchPolys && (hShader != batchShader || numVerts != batchPolyVerts ||
+						  (numBatchPolys + 1) * numVerts > MAX_BATCH_POLYS * 4)) {
+		trap_R_AddPolysToScene(batchShader, batchPolyVerts, batchVerts, numBatchPolys);
+		numBatchPolys = 0;
+	}
+
+	batchShader = hShader;
+	batchPolyVerts = numVerts;
+	memcpy(&batchVerts[numBatchPolys * numVerts], verts, numVerts * sizeof(polyVert_t));
+	numBatchPolys++;
+}
+
 //=========================================================================
 
 /*
@@ -876,6 +952,9 @@ void CG_DrawActiveFrame(int serverTime, stereoFrame_t stereoView, qboolean demoP
 	if (cg.snap)
 		lastSnapClientNum = cg.snap->ps.clientNum;
 
+	// register a bit more of the level media if it is still streaming in
+	CG_StreamAssets();
+
 	// set up cg.snap and possibly cg.nextSnap
 	CG_ProcessSnapshots();
 
@@ -34,6 +34,26 @@ theora:
 
 #define OGG_BUFFER_SIZE 8 * 1024
 
+#ifdef USE_CIN_THEORA
+#define OGM_MAX_PACKETS 32	   // theora packets queued for the decode thread
+#define OGM_MAX_FRAMES 3	   // the shown frame, one being decoded and one ready
+#define OGM_VIDEO_PRELOAD 200 // in ms, how far the decode thread may run ahead
+
+typedef struct {
+	ogg_packet op; // op.packet points to data
+	unsigned char *data;
+	int capacity;
+} ogmPacket_t;
+
+typedef enum { OGMF_FREE, OGMF_DECODING, OGMF_READY, OGMF_SHOWN } ogmFrameState_t;
+
+typedef struct {
+	ogmFrameState_t state;
+	int frameNum;
+	unsigned char *rgba;
+} ogmFrame_t;
+#endif
+
 typedef struct {
 	fileHandle_t ogmFile;
 
@@ -59,6 +79,23 @@ typedef struct {
 	theora_state th_state;	   // dump_video.c(example decoder): td
 
 	yuv_buffer th_yuvbuffer;
+
+	// theora packets are decoded and converted to RGBA on a thread, the
+	// main thread only demuxes, decodes the audio and picks the frame to
+	// show.  Without the thread the packets are decoded as they are queued.
+	sysThread_t *thread;
+	sysMutex_t *mutex;	// guards the packet queue and the frame states
+	sysCond_t *wake;	// a packet was queued, or quit is set
+	sysCond_t *decoded; // the thread finished a packet
+
+	ogmPacket_t packets[OGM_MAX_PACKETS];
+	int packetTail, numPackets;
+	ogmFrame_t frames[OGM_MAX_FRAMES];
+
+	int neededVFrame;  // earlier frames are decoded but not converted
+	int queuedVFrames; // packets handed to the decoder
+	qboolean quit;
+	qboolean badFrame; // a frame came out with unexpected plane sizes
 #endif
 
 	unsigned char *outputBuffer;
@@ -364,12 +401,6 @@ static int loadVideoFrameXvid(void) {
 }
 #endif
 
-/*
-
-  return:	1	-> loaded a new Frame ( g_ogm.outputBuffer points to the actual frame )
-			0	-> no new Frame
-			<0	-> error
-*/
 #ifdef USE_CIN_THEORA
 /*
 how many >> are needed to make y==x (shifting y>>i)
@@ -386,76 +417,343 @@ static int findSizeShift(int x, int y) {
 	return -1;
 }
 
+// without the decode thread there is nothing to lock against
+static void lockTheora(void) {
+	if (g_ogm.thread)
+		Sys_LockMutex(g_ogm.mutex);
+}
+
+static void unlockTheora(void) {
+	if (g_ogm.thread)
+		Sys_UnlockMutex(g_ogm.mutex);
+}
+
+/*
+  claimTheoraFrame
+
+  a free frame, or the oldest one that is ready but not shown yet
+  (called with the mutex held)
+*/
+static ogmFrame_t *claimTheoraFrame(void) {
+	ogmFrame_t *best = NULL;
+	int i;
+
+	for (i = 0; i < OGM_MAX_FRAMES; ++i) {
+		ogmFrame_t *f = &g_ogm.frames[i];
+
+		if (f->state == OGMF_FREE)
+			return f;
+		if (f->state == OGMF_READY && (!best || f->frameNum < best->frameNum))
+			best = f;
+	}
+
+	return best;
+}
+
+/*
+  decodeTheoraPacket
+
+  runs on the decode thread, or on the main thread without it, so it
+  mustn't print or use the zone
+*/
+static void decodeTheoraPacket(ogg_packet *op) {
+	ogg_int64_t th_frame;
+	ogmFrame_t *frame;
+	int yWShift, uvWShift;
+	int yHShift, uvHShift;
+
+	theora_decode_packetin(&g_ogm.th_state, op);
+
+	th_frame = theora_granule_frame(&g_ogm.th_state, g_ogm.th_state.granulepos);
+
+	lockTheora();
+	frame = NULL;
+	if (th_frame >= g_ogm.neededVFrame) {
+		frame = claimTheoraFrame();
+		if (frame)
+			frame->state = OGMF_DECODING;
+	}
+	unlockTheora();
+
+	// late frames are only decoded, they are references for the next ones
+	if (!frame)
+		return;
+
+	if (!theora_decode_YUVout(&g_ogm.th_state, &g_ogm.th_yuvbuffer)) {
+		yWShift = findSizeShift(g_ogm.th_yuvbuffer.y_width, g_ogm.th_info.width);
+		uvWShift = findSizeShift(g_ogm.th_yuvbuffer.uv_width, g_ogm.th_info.width);
+		yHShift = findSizeShift(g_ogm.th_yuvbuffer.y_height, g_ogm.th_info.height);
+		uvHShift = findSizeShift(g_ogm.th_yuvbuffer.uv_height, g_ogm.th_info.height);
+
+		if (yWShift < 0 || uvWShift < 0 || yHShift < 0 || uvHShift < 0) {
+			lockTheora();
+			g_ogm.badFrame = qtrue;
+			unlockTheora();
+		} else {
+			Frame_yuv_to_rgb24(g_ogm.th_yuvbuffer.y, g_ogm.th_yuvbuffer.u, g_ogm.th_yuvbuffer.v,
+							   g_ogm.th_info.width, g_ogm.th_info.height, g_ogm.th_yuvbuffer.y_stride,
+							   g_ogm.th_yuvbuffer.uv_stride, yWShift, uvWShift, yHShift, uvHShift,
+							   (unsigned int *)frame->rgba);
+
+			lockTheora();
+			frame->frameNum = (int)th_frame;
+			frame->state = OGMF_READY;
+			unlockTheora();
+			return;
+		}
+	}
+
+	lockTheora();
+	frame->state = OGMF_FREE;
+	unlockTheora();
+}
+
+/*
+  Cin_OGM_DecodeThread
+*/
+static void Cin_OGM_DecodeThread(void *data) {
+	ogmPacket_t *p;
+
+	Sys_LockMutex(g_ogm.mutex);
+	for (;;) {
+		while (!g_ogm.numPackets && !g_ogm.quit) {
+			Sys_WaitCond(g_ogm.wake, g_ogm.mutex);
+		}
+		if (g_ogm.quit) {
+			break;
+		}
+		p = &g_ogm.packets[g_ogm.packetTail];
+
+		// the main thread doesn't touch a packet until it's off the queue
+		Sys_UnlockMutex(g_ogm.mutex);
+		decodeTheoraPacket(&p->op);
+		Sys_LockMutex(g_ogm.mutex);
+
+		g_ogm.packetTail = (g_ogm.packetTail + 1) % OGM_MAX_PACKETS;
+		g_ogm.numPackets--;
+		Sys_BroadcastCond(g_ogm.decoded);
+	}
+	Sys_UnlockMutex(g_ogm.mutex);
+}
+
+/*
+  startTheoraThread
+
+  without a thread the packets are decoded on the main thread
+*/
+static void startTheoraThread(void) {
+	g_ogm.mutex = Sys_CreateMutex();
+	g_ogm.wake = Sys_CreateCond();
+	g_ogm.decoded = Sys_CreateCond();
+	if (g_ogm.mutex && g_ogm.wake && g_ogm.decoded) {
+		g_ogm.thread = Sys_CreateThread(Cin_OGM_DecodeThread, NULL);
+	}
+
+	if (!g_ogm.thread) {
+		Com_Printf(S_COLOR_YELLOW "WARNING: failed to start the cinematic decode thread\n");
+		if (g_ogm.mutex)
+			Sys_DestroyMutex(g_ogm.mutex);
+		if (g_ogm.wake)
+			Sys_DestroyCond(g_ogm.wake);
+		if (g_ogm.decoded)
+			Sys_DestroyCond(g_ogm.decoded);
+		g_ogm.mutex = NULL;
+		g_ogm.wake = NULL;
+		g_ogm.decoded = NULL;
+	}
+}
+
+/*
+  stopTheoraThread
+
+  drops what is still queued
+*/
+static void stopTheoraThread(void) {
+	if (!g_ogm.thread)
+		return;
+
+	Sys_LockMutex(g_ogm.mutex);
+	g_ogm.quit = qtrue;
+	Sys_SignalCond(g_ogm.wake);
+	Sys_UnlockMutex(g_ogm.mutex);
+
+	Sys_JoinThread(g_ogm.thread);
+	g_ogm.thread = NULL;
+
+	Sys_DestroyMutex(g_ogm.mutex);
+	Sys_DestroyCond(g_ogm.wake);
+	Sys_DestroyCond(g_ogm.decoded);
+	g_ogm.mutex = NULL;
+	g_ogm.wake = NULL;
+	g_ogm.decoded = NULL;
+}
+
+/*
+  queueTheoraPacket
+
+  return: qfalse -> the queue is full
+*/
+static qboolean queueTheoraPacket(ogg_packet *op) {
+	ogmPacket_t *p;
+
+	if (!g_ogm.thread) {
+		decodeTheoraPacket(op);
+		return qtrue;
+	}
+
+	Sys_LockMutex(g_ogm.mutex);
+	if (g_ogm.numPackets == OGM_MAX_PACKETS) {
+		Sys_UnlockMutex(g_ogm.mutex);
+		return qfalse;
+	}
+	p = &g_ogm.packets[(g_ogm.packetTail + g_ogm.numPackets) % OGM_MAX_PACKETS];
+	Sys_UnlockMutex(g_ogm.mutex);
+
+	// ogg owns op->packet only until the next packetout
+	if (p->capacity < op->bytes) {
+		unsigned char *data = realloc(p->data, op->bytes);
+
+		if (!data)
+			return qfalse;
+		p->data = data;
+		p->capacity = op->bytes;
+	}
+	memcpy(p->data, op->packet, op->bytes);
+	p->op = *op;
+	p->op.packet = p->data;
+
+	Sys_LockMutex(g_ogm.mutex);
+	g_ogm.numPackets++;
+	Sys_SignalCond(g_ogm.wake);
+	Sys_UnlockMutex(g_ogm.mutex);
+
+	return qtrue;
+}
+
+/*
+
+  hands theora packets to the decoder until it has them up to
+  OGM_VIDEO_PRELOAD ahead of the current time
+
+  return:	1	-> the decoder has enough packets
+			0	-> need more pages
+			<0	-> error
+*/
 static int loadVideoFrameTheora(void) {
-	int r = 0;
 	ogg_packet op;
+	qboolean badFrame;
+	int preload;
+
+	lockTheora();
+	badFrame = g_ogm.badFrame;
+	unlockTheora();
+
+	if (badFrame) {
+		Com_Printf("[Theora] unexpected resolution in a yuv-Frame\n");
+		return -1;
+	}
+
+	// decoding ahead on the main thread would only move the work around
+	preload = g_ogm.thread ? OGM_VIDEO_PRELOAD : 20;
 
 	memset(&op, 0, sizeof(op));
 
-	while (!r && (ogg_stream_packetout(&g_ogm.os_video, &op))) {
-		ogg_int64_t th_frame;
-		theora_decode_packetin(&g_ogm.th_state, &op);
+	while (g_ogm.queuedVFrames * g_ogm.Vtime_unit / 10000 <= g_ogm.currentTime + preload) {
+		if (g_ogm.thread) {
+			qboolean full;
 
-		th_frame = theora_granule_frame(&g_ogm.th_state, g_ogm.th_state.granulepos);
+			Sys_LockMutex(g_ogm.mutex);
+			full = g_ogm.numPackets == OGM_MAX_PACKETS;
+			Sys_UnlockMutex(g_ogm.mutex);
 
-		if ((g_ogm.VFrameCount < th_frame && th_frame >= nextNeededVFrame()) || !g_ogm.outputBuffer) {
-			//			int i,j;
-			int yWShift, uvWShift;
-			int yHShift, uvHShift;
+			if (full)
+				return 1;
+		}
 
-			if (theora_decode_YUVout(&g_ogm.th_state, &g_ogm.th_yuvbuffer))
-				continue;
+		if (ogg_stream_packetout(&g_ogm.os_video, &op) <= 0)
+			return 0;
 
-			if (g_ogm.outputWidht != g_ogm.th_info.width || g_ogm.outputHeight != g_ogm.th_info.height) {
-				g_ogm.outputWidht = g_ogm.th_info.width;
-				g_ogm.outputHeight = g_ogm.th_info.height;
-				Com_DPrintf("[Theora(ogg)]new resolution %dx%d\n", g_ogm.outputWidht, g_ogm.outputHeight);
-			}
+		if (!queueTheoraPacket(&op))
+			return -2;
+		++g_ogm.queuedVFrames;
+	}
 
-			if (g_ogm.outputBufferSize < g_ogm.th_info.width * g_ogm.th_info.height) {
+	return 1;
+}
 
-				g_ogm.outputBufferSize = g_ogm.th_info.width * g_ogm.th_info.height;
+/*
+  showTheoraFrame
 
-				/* Free old output buffer*/
-				if (g_ogm.outputBuffer)
-					free(g_ogm.outputBuffer);
+  shows the newest decoded frame that is due, the first frame is waited for
 
-				/* Allocate the new buffer */
-				g_ogm.outputBuffer = (unsigned char *)malloc(g_ogm.outputBufferSize * 4);
-				if (g_ogm.outputBuffer == NULL) {
-					g_ogm.outputBufferSize = 0;
-					r = -2;
-					break;
-				}
-			}
+  return:	qtrue	-> a new frame is shown
+*/
+static qboolean showTheoraFrame(void) {
+	ogmFrame_t *show;
+	int i;
 
-			yWShift = findSizeShift(g_ogm.th_yuvbuffer.y_width, g_ogm.th_info.width);
-			uvWShift = findSizeShift(g_ogm.th_yuvbuffer.uv_width, g_ogm.th_info.width);
-			yHShift = findSizeShift(g_ogm.th_yuvbuffer.y_height, g_ogm.th_info.height);
-			uvHShift = findSizeShift(g_ogm.th_yuvbuffer.uv_height, g_ogm.th_info.height);
-
-			if (yWShift < 0 || uvWShift < 0 || yHShift < 0 || uvHShift < 0) {
-				Com_Printf("[Theora] unexpected resolution in a yuv-Frame\n");
-				r = -1;
-			} else {
-				Frame_yuv_to_rgb24(g_ogm.th_yuvbuffer.y, g_ogm.th_yuvbuffer.u, g_ogm.th_yuvbuffer.v,
-								   g_ogm.th_info.width, g_ogm.th_info.height, g_ogm.th_yuvbuffer.y_stride,
-								   g_ogm.th_yuvbuffer.uv_stride, yWShift, uvWShift, yHShift, uvHShift,
-								   (unsigned int *)g_ogm.outputBuffer);
-
-				r = 1;
-				g_ogm.VFrameCount = th_frame;
-			}
+	lockTheora();
+
+	for (;;) {
+		show = NULL;
+		for (i = 0; i < OGM_MAX_FRAMES; ++i) {
+			ogmFrame_t *f = &g_ogm.frames[i];
+
+			if (f->state != OGMF_READY)
+				continue;
+			if (g_ogm.outputBuffer && f->frameNum * g_ogm.Vtime_unit / 10000 > g_ogm.currentTime + 20)
+				continue;
+			if (!show || (g_ogm.outputBuffer ? f->frameNum > show->frameNum : f->frameNum < show->frameNum))
+				show = f;
 		}
+
+		if (show || g_ogm.outputBuffer || !g_ogm.thread || !g_ogm.numPackets)
+			break;
+
+		Sys_WaitCond(g_ogm.decoded, g_ogm.mutex);
 	}
 
-	return r;
+	if (show) {
+		for (i = 0; i < OGM_MAX_FRAMES; ++i) {
+			ogmFrame_t *f = &g_ogm.frames[i];
+
+			if (f->state == OGMF_SHOWN || (f->state == OGMF_READY && f->frameNum < show->frameNum))
+				f->state = OGMF_FREE;
+		}
+		show->state = OGMF_SHOWN;
+		g_ogm.outputBuffer = show->rgba;
+		g_ogm.VFrameCount = show->frameNum;
+	}
+
+	unlockTheora();
+
+	return show != NULL;
+}
+
+/*
+  theoraFramesLeft
+
+  return: qtrue -> the decoder still has packets or frames to show
+*/
+static qboolean theoraFramesLeft(void) {
+	qboolean left;
+	int i;
+
+	lockTheora();
+	left = g_ogm.numPackets > 0;
+	for (i = 0; i < OGM_MAX_FRAMES; ++i)
+		if (g_ogm.frames[i].state == OGMF_READY || g_ogm.frames[i].state == OGMF_DECODING)
+			left = qtrue;
+	unlockTheora();
+
+	return left;
 }
 #endif
 
 /*
 
-  return:	1	-> loaded a new Frame ( g_ogm.outputBuffer points to the actual frame )
+  return:	1	-> loaded a new Frame ( g_ogm.outputBuffer points to the actual frame ),
+				   for theora the decoder has enough packets
 			0	-> no new Frame
 			<0	-> error
 */
@@ -762,6 +1060,20 @@ int Cin_OGM_Init(cinematics_t *cin, const char *filename) {
 		}
 
 		g_ogm.Vtime_unit = ((ogg_int64_t)g_ogm.th_info.fps_denominator * 1000 * 10000 / g_ogm.th_info.fps_numerator);
+
+		g_ogm.outputWidht = g_ogm.th_info.width;
+		g_ogm.outputHeight = g_ogm.th_info.height;
+
+		for (i = 0; i < OGM_MAX_FRAMES; ++i) {
+			g_ogm.frames[i].rgba = (unsigned char *)malloc(g_ogm.th_info.width * g_ogm.th_info.height * 4);
+			if (!g_ogm.frames[i].rgba) {
+				Com_Printf("Couldn't allocate the frames of ogm-file (%s)\n", filename);
+
+				return -2;
+			}
+		}
+
+		startTheoraThread();
 	}
 #endif
 
@@ -779,17 +1091,38 @@ static int nextNeededVFrame(void) {
   time ~> time in ms to which the movie should run
   return:	0 => nothing special
 			1 => eof
+			2 => a new frame is in the output buffer
 */
 int Cin_OGM_Run(cinematics_t *cin, int time) {
+	qboolean newFrame = qfalse;
 
 	g_ogm.currentTime = time;
 
+#ifdef USE_CIN_THEORA
+	if (g_ogm.videoStreamIsTheora) {
+		qboolean eof;
+
+		lockTheora();
+		g_ogm.neededVFrame = nextNeededVFrame();
+		unlockTheora();
+
+		eof = loadFrame(cin);
+		newFrame = showTheoraFrame();
+
+		if (eof && !theoraFramesLeft())
+			return 1;
+
+		return newFrame ? 2 : 0;
+	}
+#endif
+
 	while (!g_ogm.VFrameCount || time + 20 >= (int)(g_ogm.VFrameCount * g_ogm.Vtime_unit / 10000)) {
 		if (loadFrame(cin))
 			return 1;
+		newFrame = qtrue;
 	}
 
-	return 0;
+	return newFrame ? 2 : 0;
 }
 
 /*
@@ -808,15 +1141,37 @@ unsigned char *Cin_OGM_GetOutput(cinematics_t *cin, int *outWidth, int *outHeigh
 void Cin_OGM_Shutdown(cinematics_t *cin) {
 #ifdef USE_CIN_XVID
 	int status;
+#endif
+#ifdef USE_CIN_THEORA
+	int i;
+#endif
 
+#ifdef USE_CIN_XVID
 	status = shutdown_xvid();
 	if (status)
 		Com_Printf("[Xvid]Decore RELEASE problem, return value %d\n", status);
 #endif
 #ifdef USE_CIN_THEORA
+	stopTheoraThread();
+
 	theora_clear(&g_ogm.th_state);
 	theora_comment_clear(&g_ogm.th_comment);
 	theora_info_clear(&g_ogm.th_info);
+
+	for (i = 0; i < OGM_MAX_PACKETS; ++i) {
+		free(g_ogm.packets[i].data);
+		g_ogm.packets[i].data = NULL;
+		g_ogm.packets[i].capacity = 0;
+	}
+	g_ogm.numPackets = 0;
+
+	// the output buffer is one of the frames
+	for (i = 0; i < OGM_MAX_FRAMES; ++i) {
+		free(g_ogm.frames[i].rgba);
+		g_ogm.frames[i].rgba = NULL;
+	}
+	if (g_ogm.videoStreamIsTheora)
+		g_ogm.outputBuffer = NULL;
 #endif
 	if (g_ogm.outputBuffer)
 		free(g_ogm.outputBuffer);
@@ -59,6 +59,9 @@ typedef struct aviFileData_s {
 	audioFormat_t a;
 	int numAudioFrames;
 
+	qboolean pipe;		// raw frames go to cl_aviPipe instead of an AVI
+	fileHandle_t wavF;	// the audio when piping
+
 	int chunkStack[MAX_RIFF_CHUNKS];
 	int chunkStackTop;
 
@@ -82,6 +85,222 @@ static ID_INLINE void SafeFS_Write(const void *buffer, int len, fileHandle_t f)
 		Com_Error(ERR_DROP, "Failed to write avi file");
 }
 
+/*
+=================================================================================
+
+WRITER THREAD
+
+Chunks and their index entries are queued as records and a thread writes
+them, so the frame doesn't wait on the disk or on the encoder at the other
+end of cl_aviPipe.  All the bookkeeping (sizes, offsets, splitting at 2Gb)
+stays on the main thread, the thread only does the writes in order.
+
+=================================================================================
+*/
+
+typedef struct {
+	fileHandle_t f;
+	byte *data;
+	int size, capacity;
+
+	fileHandle_t idxF;
+	byte index[16];
+	int indexSize;
+} aviRecord_t;
+
+typedef struct {
+	sysThread_t *thread;
+	sysMutex_t *mutex;	// guards head, tail and used
+	sysCond_t *wake;	// a record was queued, or quit is set
+	sysCond_t *drained; // the thread finished a record
+
+	aviRecord_t *records;
+	int numRecords;
+	int head, tail, used;
+	qboolean quit;
+	qboolean failed;
+} aviWriter_t;
+
+static aviWriter_t aviWriter;
+static aviRecord_t aviSyncRecord; // used when there is no thread
+
+/*
+===============
+CL_AVIWriterThread
+===============
+*/
+static void CL_AVIWriterThread(void *data) {
+	aviWriter_t *w = data;
+	aviRecord_t *rec;
+	qboolean ok;
+
+	Sys_LockMutex(w->mutex);
+	for (;;) {
+		while (!w->used && !w->quit) {
+			Sys_WaitCond(w->wake, w->mutex);
+		}
+		if (!w->used) {
+			break;
+		}
+		rec = &w->records[w->tail];
+
+		// the main thread doesn't touch a record until it's off the queue
+		Sys_UnlockMutex(w->mutex);
+		ok = FS_WriteFromThread(rec->data, rec->size, rec->f) == rec->size;
+		if (ok && rec->indexSize) {
+			ok = FS_WriteFromThread(rec->index, rec->indexSize, rec->idxF) == rec->indexSize;
+		}
+		Sys_LockMutex(w->mutex);
+
+		if (!ok) {
+			w->failed = qtrue;
+		}
+		w->tail = (w->tail + 1) % w->numRecords;
+		w->used--;
+		Sys_BroadcastCond(w->drained);
+	}
+	Sys_UnlockMutex(w->mutex);
+}
+
+/*
+===============
+CL_StartAVIWriter
+
+Without cl_aviQueueFrames the records are written right away
+===============
+*/
+static void CL_StartAVIWriter(void) {
+	aviWriter_t *w = &aviWriter;
+
+	Com_Memset(w, 0, sizeof(*w));
+	if (cl_aviQueueFrames->integer <= 0) {
+		return;
+	}
+
+	w->numRecords = cl_aviQueueFrames->integer;
+	w->records = calloc(w->numRecords, sizeof(*w->records));
+	w->mutex = Sys_CreateMutex();
+	w->wake = Sys_CreateCond();
+	w->drained = Sys_CreateCond();
+	if (w->records && w->mutex && w->wake && w->drained) {
+		w->thread = Sys_CreateThread(CL_AVIWriterThread, w);
+	}
+
+	if (!w->thread) {
+		Com_Printf(S_COLOR_YELLOW "WARNING: failed to start the video write thread\n");
+		if (w->mutex)
+			Sys_DestroyMutex(w->mutex);
+		if (w->wake)
+			Sys_DestroyCond(w->wake);
+		if (w->drained)
+			Sys_DestroyCond(w->drained);
+		free(w->records);
+		Com_Memset(w, 0, sizeof(*w));
+	}
+}
+
+/*
+===============
+CL_StopAVIWriter
+
+Writes what is queued and stops the thread
+===============
+*/
+static void CL_StopAVIWriter(void) {
+	aviWriter_t *w = &aviWriter;
+	int i;
+
+	free(aviSyncRecord.data);
+	Com_Memset(&aviSyncRecord, 0, sizeof(aviSyncRecord));
+
+	if (!w->thread) {
+		return;
+	}
+
+	Sys_LockMutex(w->mutex);
+	w->quit = qtrue;
+	Sys_SignalCond(w->wake);
+	Sys_UnlockMutex(w->mutex);
+
+	// the thread drains the queue before it quits
+	Sys_JoinThread(w->thread);
+
+	Sys_DestroyMutex(w->mutex);
+	Sys_DestroyCond(w->wake);
+	Sys_DestroyCond(w->drained);
+	for (i = 0; i < w->numRecords; i++) {
+		free(w->records[i].data);
+	}
+	free(w->records);
+	Com_Memset(w, 0, sizeof(*w));
+}
+
+/*
+===============
+CL_GetAVIRecord
+
+Returns a free record with room for size bytes, waiting on the thread
+while the queue is full
+===============
+*/
+static aviRecord_t *CL_GetAVIRecord(int size) {
+	aviWriter_t *w = &aviWriter;
+	aviRecord_t *rec;
+	qboolean failed;
+
+	if (w->thread) {
+		Sys_LockMutex(w->mutex);
+		while (w->used == w->numRecords) {
+			Sys_WaitCond(w->drained, w->mutex);
+		}
+		failed = w->failed;
+		Sys_UnlockMutex(w->mutex);
+
+		if (failed)
+			Com_Error(ERR_DROP, "Failed to write avi file");
+
+		rec = &w->records[w->head];
+	} else {
+		rec = &aviSyncRecord;
+	}
+
+	if (rec->capacity < size) {
+		free(rec->data);
+		rec->data = malloc(size);
+		if (!rec->data) {
+			rec->capacity = 0;
+			Com_Error(ERR_DROP, "CL_GetAVIRecord: failed to allocate %d bytes", size);
+		}
+		rec->capacity = size;
+	}
+
+	rec->size = 0;
+	rec->indexSize = 0;
+	return rec;
+}
+
+/*
+===============
+CL_QueueAVIRecord
+===============
+*/
+static void CL_QueueAVIRecord(aviRecord_t *rec) {
+	aviWriter_t *w = &aviWriter;
+
+	if (!w->thread) {
+		SafeFS_Write(rec->data, rec->size, rec->f);
+		if (rec->indexSize)
+			SafeFS_Write(rec->index, rec->indexSize, rec->idxF);
+		return;
+	}
+
+	Sys_LockMutex(w->mutex);
+	w->head = (w->head + 1) % w->numRecords;
+	w->used++;
+	Sys_SignalCond(w->wake);
+	Sys_UnlockMutex(w->mutex);
+}
+
 /*
 ===============
 WRITE_STRING
@@ -291,6 +510,128 @@ void CL_WriteAVIHeader(void) {
 	}
 }
 
+/*
+===============
+CL_WriteWAVHeader
+
+The header of the audio file written next to a piped video
+===============
+*/
+static void CL_WriteWAVHeader(void) {
+	bufIndex = 0;
+	WRITE_STRING("RIFF");
+	WRITE_4BYTES(36 + afd.a.totalBytes);
+	WRITE_STRING("WAVE");
+	WRITE_STRING("fmt ");
+	WRITE_4BYTES(16);
+	WRITE_2BYTES(afd.a.format);
+	WRITE_2BYTES(afd.a.channels);
+	WRITE_4BYTES(afd.a.rate);
+	WRITE_4BYTES(afd.a.sampleSize * afd.a.rate);
+	WRITE_2BYTES(afd.a.sampleSize);
+	WRITE_2BYTES(afd.a.bits);
+	WRITE_STRING("data");
+	WRITE_4BYTES(afd.a.totalBytes);
+}
+
+/*
+===============
+CL_AVIPipeCommand
+
+Expands cl_aviPipe: $w and $h are the frame size, $r the frame rate, $o the
+full path of the video without extension and $$ a dollar sign
+===============
+*/
+static void CL_AVIPipeCommand(char *command, int size, const char *baseName) {
+	char outPath[MAX_OSPATH];
+	const char *in, *add;
+	char num[16];
+	int len = 0;
+
+	Q_strncpyz(outPath, FS_BuildOSPath(Cvar_VariableString("fs_homepath"), FS_GetCurrentGameDir(), baseName),
+			   sizeof(outPath));
+
+	for (in = cl_aviPipe->string; *in && len < size - 1; in++) {
+		if (*in != '$' || !in[1]) {
+			command[len++] = *in;
+			continue;
+		}
+
+		in++;
+		switch (*in) {
+		case 'w':
+			Com_sprintf(num, sizeof(num), "%d", afd.width);
+			add = num;
+			break;
+		case 'h':
+			Com_sprintf(num, sizeof(num), "%d", afd.height);
+			add = num;
+			break;
+		case 'r':
+			Com_sprintf(num, sizeof(num), "%d", afd.frameRate);
+			add = num;
+			break;
+		case 'o':
+			add = outPath;
+			break;
+		case '$':
+			add = "$";
+			break;
+		default:
+			command[len++] = '$';
+			in--;
+			continue;
+		}
+
+		while (*add && len < size - 1) {
+			command[len++] = *add++;
+		}
+	}
+	command[len] = '\0';
+}
+
+/*
+===============
+CL_OpenAVIPipe
+
+Starts the cl_aviPipe encoder, which gets raw bottom-up BGR frames on its
+stdin.  The audio goes to a WAV next to the video.
+===============
+*/
+static qboolean CL_OpenAVIPipe(const char *fileName) {
+	char baseName[MAX_QPATH];
+	char command[MAX_STRING_CHARS];
+	char *ospath;
+
+	COM_StripExtension(fileName, baseName, sizeof(baseName));
+
+	// the encoder writes into videos/, so it has to exist
+	ospath = FS_BuildOSPath(Cvar_VariableString("fs_homepath"), FS_GetCurrentGameDir(), fileName);
+	if (FS_CreatePath(ospath))
+		return qfalse;
+
+	if (afd.audio) {
+		if ((afd.wavF = FS_FOpenFileWrite(va("%s.wav", baseName))) <= 0)
+			return qfalse;
+
+		// sizes are filled in when the video is closed
+		CL_WriteWAVHeader();
+		SafeFS_Write(buffer, bufIndex, afd.wavF);
+	}
+
+	CL_AVIPipeCommand(command, sizeof(command), baseName);
+	Com_Printf("Piping video to: %s\n", command);
+
+	if ((afd.f = FS_FOpenPipeWrite(command)) <= 0) {
+		Com_Printf(S_COLOR_RED "ERROR: couldn't start the cl_aviPipe command\n");
+		if (afd.audio)
+			FS_FCloseFile(afd.wavF);
+		return qfalse;
+	}
+
+	return qtrue;
+}
+
 /*
 ===============
 CL_OpenAVIForWriting
@@ -311,14 +652,6 @@ qboolean CL_OpenAVIForWriting(const char *fileName) {
 		return qfalse;
 	}
 
-	if ((afd.f = FS_FOpenFileWrite(fileName)) <= 0)
-		return qfalse;
-
-	if ((afd.idxF = FS_FOpenFileWrite(va("%s" INDEX_FILE_EXTENSION, fileName))) <= 0) {
-		FS_FCloseFile(afd.f);
-		return qfalse;
-	}
-
 	Q_strncpyz(afd.fileName, fileName, MAX_QPATH);
 
 	afd.frameRate = cl_aviFrameRate->integer;
@@ -326,19 +659,14 @@ qboolean CL_OpenAVIForWriting(const char *fileName) {
 	afd.width = cls.glconfig.vidWidth;
 	afd.height = cls.glconfig.vidHeight;
 
-	if (cl_aviMotionJpeg->integer)
+	// the encoder behind the pipe does the compression
+	afd.pipe = cl_aviPipe->string[0] ? qtrue : qfalse;
+
+	if (cl_aviMotionJpeg->integer && !afd.pipe)
 		afd.motionJpeg = qtrue;
 	else
 		afd.motionJpeg = qfalse;
 
-// Buffers only need to store RGB pixels.
-// Allocate a bit more space for the capture buffer to account for possible
-// padding at the end of pixel lines, and padding for alignment
-#define MAX_PACK_LEN 16
-	afd.cBuffer = Z_Malloc((afd.width * 3 + MAX_PACK_LEN - 1) * afd.height + MAX_PACK_LEN - 1);
-	// raw avi files have pixel lines start on 4-byte boundaries
-	afd.eBuffer = Z_Malloc(PAD(afd.width * 3, AVI_LINE_PADDING) * afd.height);
-
 	afd.a.rate = dma.speed;
 	afd.a.format = WAV_FORMAT_PCM;
 	afd.a.channels = dma.channels;
@@ -374,18 +702,41 @@ qboolean CL_OpenAVIForWriting(const char *fileName) {
 								  "with OpenAL. Set s_useOpenAL to 0 for audio capture\n");
 	}
 
-	// This doesn't write a real header, but allocates the
-	// correct amount of space at the beginning of the file
-	CL_WriteAVIHeader();
+	if (afd.pipe) {
+		if (!CL_OpenAVIPipe(fileName))
+			return qfalse;
+	} else {
+		if ((afd.f = FS_FOpenFileWrite(fileName)) <= 0)
+			return qfalse;
 
-	SafeFS_Write(buffer, bufIndex, afd.f);
-	afd.fileSize = bufIndex;
+		if ((afd.idxF = FS_FOpenFileWrite(va("%s" INDEX_FILE_EXTENSION, fileName))) <= 0) {
+			FS_FCloseFile(afd.f);
+			return qfalse;
+		}
 
-	bufIndex = 0;
-	START_CHUNK("idx1");
-	SafeFS_Write(buffer, bufIndex, afd.idxF);
+		// This doesn't write a real header, but allocates the
+		// correct amount of space at the beginning of the file
+		CL_WriteAVIHeader();
+
+		SafeFS_Write(buffer, bufIndex, afd.f);
+		afd.fileSize = bufIndex;
+
+		bufIndex = 0;
+		START_CHUNK("idx1");
+		SafeFS_Write(buffer, bufIndex, afd.idxF);
 
-	afd.moviSize = 4; // For the "movi"
+		afd.moviSize = 4; // For the "movi"
+	}
+
+// Buffers only need to store RGB pixels.
+// Allocate a bit more space for the capture buffer to account for possible
+// padding at the end of pixel lines, and padding for alignment
+#define MAX_PACK_LEN 16
+	afd.cBuffer = Z_Malloc((afd.width * 3 + MAX_PACK_LEN - 1) * afd.height + MAX_PACK_LEN - 1);
+	// raw avi files have pixel lines start on 4-byte boundaries
+	afd.eBuffer = Z_Malloc(PAD(afd.width * 3, AVI_LINE_PADDING) * afd.height);
+
+	CL_StartAVIWriter();
 	afd.fileOpen = qtrue;
 
 	return qtrue;
@@ -399,6 +750,10 @@ CL_CheckFileSize
 static qboolean CL_CheckFileSize(int bytesToAdd) {
 	unsigned int newFileSize;
 
+	// a pipe has no size limit
+	if (afd.pipe)
+		return qfalse;
+
 	newFileSize = afd.fileSize +		  // Current file size
 				  bytesToAdd +			  // What we want to add
 				  (afd.numIndices * 16) + // The index
@@ -421,46 +776,97 @@ static qboolean CL_CheckFileSize(int bytesToAdd) {
 
 /*
 ===============
-CL_WriteAVIVideoFrame
+CL_QueueAVIChunk
+
+Queues a chunk for the movi list and its index entry
 ===============
 */
-void CL_WriteAVIVideoFrame(const byte *imageBuffer, int size) {
+static void CL_QueueAVIChunk(const char *fourcc, const byte *data, int size, int flags) {
 	int chunkOffset = afd.fileSize - afd.moviOffset - 8;
-	int chunkSize = 8 + size;
 	int paddingSize = PADLEN(size, 2);
-	byte padding[4] = {0};
+	int chunkSize = 8 + size + paddingSize;
+	aviRecord_t *rec;
+
+	rec = CL_GetAVIRecord(chunkSize);
+
+	// Chunk header + contents + padding
+	bufIndex = 0;
+	WRITE_STRING(fourcc);
+	WRITE_4BYTES(size);
+	Com_Memcpy(rec->data, buffer, 8);
+	Com_Memcpy(rec->data + 8, data, size);
+	Com_Memset(rec->data + 8 + size, 0, paddingSize);
+	rec->f = afd.f;
+	rec->size = chunkSize;
+
+	// Index
+	bufIndex = 0;
+	WRITE_STRING(fourcc);	   // dwIdentifier
+	WRITE_4BYTES(flags);	   // dwFlags
+	WRITE_4BYTES(chunkOffset); // dwOffset
+	WRITE_4BYTES(size);		   // dwLength
+	Com_Memcpy(rec->index, buffer, 16);
+	rec->idxF = afd.idxF;
+	rec->indexSize = 16;
+
+	CL_QueueAVIRecord(rec);
+
+	afd.fileSize += chunkSize;
+	afd.moviSize += chunkSize;
+	afd.numIndices++;
+}
+
+/*
+===============
+CL_QueuePipeVideoFrame
 
+The encoder gets tightly packed lines, the AVI padding is dropped
+===============
+*/
+static void CL_QueuePipeVideoFrame(const byte *imageBuffer, int size) {
+	int lineSize = afd.width * 3;
+	int stride = PAD(lineSize, AVI_LINE_PADDING);
+	aviRecord_t *rec;
+	int i;
+
+	if (size < stride * afd.height)
+		return;
+
+	rec = CL_GetAVIRecord(lineSize * afd.height);
+	for (i = 0; i < afd.height; i++)
+		Com_Memcpy(rec->data + i * lineSize, imageBuffer + i * stride, lineSize);
+	rec->f = afd.f;
+	rec->size = lineSize * afd.height;
+
+	CL_QueueAVIRecord(rec);
+}
+
+/*
+===============
+CL_WriteAVIVideoFrame
+===============
+*/
+void CL_WriteAVIVideoFrame(const byte *imageBuffer, int size) {
 	if (!afd.fileOpen)
 		return;
 
+	if (afd.pipe) {
+		CL_QueuePipeVideoFrame(imageBuffer, size);
+		afd.numVideoFrames++;
+		return;
+	}
+
 	// Chunk header + contents + padding
 	if (CL_CheckFileSize(8 + size + 2))
 		return;
 
-	bufIndex = 0;
-	WRITE_STRING("00dc");
-	WRITE_4BYTES(size);
-
-	SafeFS_Write(buffer, 8, afd.f);
-	SafeFS_Write(imageBuffer, size, afd.f);
-	SafeFS_Write(padding, paddingSize, afd.f);
-	afd.fileSize += (chunkSize + paddingSize);
+	// all frames are KeyFrames
+	CL_QueueAVIChunk("00dc", imageBuffer, size, 0x00000010);
 
 	afd.numVideoFrames++;
-	afd.moviSize += (chunkSize + paddingSize);
 
 	if (size > afd.maxRecordSize)
 		afd.maxRecordSize = size;
-
-	// Index
-	bufIndex = 0;
-	WRITE_STRING("00dc");	   // dwIdentifier
-	WRITE_4BYTES(0x00000010);  // dwFlags (all frames are KeyFrames)
-	WRITE_4BYTES(chunkOffset); // dwOffset
-	WRITE_4BYTES(size);		   // dwLength
-	SafeFS_Write(buffer, 16, afd.idxF);
-
-	afd.numIndices++;
 }
 
 #define PCM_BUFFER_SIZE 44100
@@ -494,34 +900,20 @@ void CL_WriteAVIAudioFrame(const byte *pcmBuffer, int size) {
 
 	// Only write if we have a frame's worth of audio
 	if (bytesInBuffer >= (int)ceil((float)afd.a.rate / (float)afd.frameRate) * afd.a.sampleSize) {
-		int chunkOffset = afd.fileSize - afd.moviOffset - 8;
-		int chunkSize = 8 + bytesInBuffer;
-		int paddingSize = PADLEN(bytesInBuffer, 2);
-		byte padding[4] = {0};
-
-		bufIndex = 0;
-		WRITE_STRING("01wb");
-		WRITE_4BYTES(bytesInBuffer);
-
-		SafeFS_Write(buffer, 8, afd.f);
-		SafeFS_Write(pcmCaptureBuffer, bytesInBuffer, afd.f);
-		SafeFS_Write(padding, paddingSize, afd.f);
-		afd.fileSize += (chunkSize + paddingSize);
+		if (afd.pipe) {
+			aviRecord_t *rec = CL_GetAVIRecord(bytesInBuffer);
+
+			Com_Memcpy(rec->data, pcmCaptureBuffer, bytesInBuffer);
+			rec->f = afd.wavF;
+			rec->size = bytesInBuffer;
+			CL_QueueAVIRecord(rec);
+		} else {
+			CL_QueueAVIChunk("01wb", pcmCaptureBuffer, bytesInBuffer, 0);
+		}
 
 		afd.numAudioFrames++;
-		afd.moviSize += (chunkSize + paddingSize);
 		afd.a.totalBytes += bytesInBuffer;
 
-		// Index
-		bufIndex = 0;
-		WRITE_STRING("01wb");		 // dwIdentifier
-		WRITE_4BYTES(0);			 // dwFlags
-		WRITE_4BYTES(chunkOffset);	 // dwOffset
-		WRITE_4BYTES(bytesInBuffer); // dwLength
-		SafeFS_Write(buffer, 16, afd.idxF);
-
-		afd.numIndices++;
-
 		bytesInBuffer = 0;
 	}
 }
@@ -539,6 +931,29 @@ void CL_TakeVideoFrame(void) {
 	re.TakeVideoFrame(afd.width, afd.height, afd.cBuffer, afd.eBuffer, afd.motionJpeg);
 }
 
+/*
+===============
+CL_CloseAVIPipe
+
+Waits for the encoder to finish
+===============
+*/
+static void CL_CloseAVIPipe(void) {
+	if (afd.audio) {
+		FS_Seek(afd.wavF, 0, FS_SEEK_SET);
+		CL_WriteWAVHeader();
+		SafeFS_Write(buffer, bufIndex, afd.wavF);
+		FS_FCloseFile(afd.wavF);
+	}
+
+	FS_FCloseFile(afd.f);
+
+	Z_Free(afd.cBuffer);
+	Z_Free(afd.eBuffer);
+
+	Com_Printf("Piped %d:%d frames for %s\n", afd.numVideoFrames, afd.numAudioFrames, afd.fileName);
+}
+
 /*
 ===============
 CL_CloseAVI
@@ -548,15 +963,28 @@ Closes the AVI file and writes an index chunk
 */
 qboolean CL_CloseAVI(void) {
 	int indexRemainder;
-	int indexSize = afd.numIndices * 16;
+	int indexSize;
 	const char *idxFileName = va("%s" INDEX_FILE_EXTENSION, afd.fileName);
 
 	// AVI file isn't open
 	if (!afd.fileOpen)
 		return qfalse;
 
+	// the renderer may still be reading back the last few frames
+	if (re.FinishVideoFrames)
+		re.FinishVideoFrames();
+
+	indexSize = afd.numIndices * 16;
 	afd.fileOpen = qfalse;
 
+	// everything below goes straight to the files
+	CL_StopAVIWriter();
+
+	if (afd.pipe) {
+		CL_CloseAVIPipe();
+		return qtrue;
+	}
+
 	FS_Seek(afd.idxF, 4, FS_SEEK_SET);
 	bufIndex = 0;
 	WRITE_4BYTES(indexSize);
@@ -118,7 +118,7 @@ CL_GetSnapshot
 */
 qboolean CL_GetSnapshot(int snapshotNumber, snapshot_t *snapshot) {
 	clSnapshot_t *clSnap;
-	int i, count;
+	int count, first, run;
 
 	if (snapshotNumber > cl.snap.messageNum) {
 		Com_Error(ERR_DROP, "CL_GetSnapshot: snapshotNumber > cl.snapshot.messageNum");
@@ -154,8 +154,17 @@ qboolean CL_GetSnapshot(int snapshotNumber, snapshot_t *snapshot) {
 		count = MAX_ENTITIES_IN_SNAPSHOT;
 	}
 	snapshot->numEntities = count;
-	for (i = 0; i < count; i++) {
-		snapshot->entities[i] = cl.parseEntities[(clSnap->parseEntitiesNum + i) & (MAX_PARSE_ENTITIES - 1)];
+
+	// the entities are contiguous in the parse ring unless they wrap
+	// around its end, so they go over in at most two copies
+	first = clSnap->parseEntitiesNum & (MAX_PARSE_ENTITIES - 1);
+	run = MAX_PARSE_ENTITIES - first;
+	if (run > count) {
+		run = count;
+	}
+	Com_Memcpy(snapshot->entities, &cl.parseEntities[first], run * sizeof(entityState_t));
+	if (run < count) {
+		Com_Memcpy(snapshot->entities + run, cl.parseEntities, (count - run) * sizeof(entityState_t));
 	}
 
 	// FIXME: configstring changes and server commands!!!
@@ -184,35 +193,30 @@ void CL_AddCgameCommand(const char *cmdName) {
 
 /*
 =====================
-CL_ConfigstringModified
+CL_SetGameStateString
+
+Rebuilds the string data of gs with the configstring at index set to s,
+returns qfalse if it was unchanged
 =====================
 */
-void CL_ConfigstringModified(void) {
-	char *old, *s;
-	int i, index;
-	char *dup;
+qboolean CL_SetGameStateString(gameState_t *gs, int index, const char *s) {
+	const char *old, *dup;
+	int i;
 	gameState_t oldGs;
 	int len;
 
-	index = atoi(Cmd_Argv(1));
-	if (index < 0 || index >= MAX_CONFIGSTRINGS) {
-		Com_Error(ERR_DROP, "CL_ConfigstringModified: bad index %i", index);
-	}
-	// get everything after "cs <num>"
-	s = Cmd_ArgsFrom(2);
-
-	old = cl.gameState.stringData + cl.gameState.stringOffsets[index];
+	old = gs->stringData + gs->stringOffsets[index];
 	if (!strcmp(old, s)) {
-		return; // unchanged
+		return qfalse; // unchanged
 	}
 
 	// build the new gameState_t
-	oldGs = cl.gameState;
+	oldGs = *gs;
 
-	Com_Memset(&cl.gameState, 0, sizeof(cl.gameState));
+	Com_Memset(gs, 0, sizeof(*gs));
 
 	// leave the first 0 for uninitialized strings
-	cl.gameState.dataCount = 1;
+	gs->dataCount = 1;
 
 	for (i = 0; i < MAX_CONFIGSTRINGS; i++) {
 		if (i == index) {
@@ -226,14 +230,35 @@ void CL_ConfigstringModified(void) {
 
 		len = strlen(dup);
 
-		if (len + 1 + cl.gameState.dataCount > MAX_GAMESTATE_CHARS) {
+		if (len + 1 + gs->dataCount > MAX_GAMESTATE_CHARS) {
 			Com_Error(ERR_DROP, "MAX_GAMESTATE_CHARS exceeded");
 		}
 
 		// append it to the gameState string buffer
-		cl.gameState.stringOffsets[i] = cl.gameState.dataCount;
-		Com_Memcpy(cl.gameState.stringData + cl.gameState.dataCount, dup, len + 1);
-		cl.gameState.dataCount += len + 1;
+		gs->stringOffsets[i] = gs->dataCount;
+		Com_Memcpy(gs->stringData + gs->dataCount, dup, len + 1);
+		gs->dataCount += len + 1;
+	}
+
+	return qtrue;
+}
+
+/*
+=====================
+CL_ConfigstringModified
+=====================
+*/
+void CL_ConfigstringModified(void) {
+	int index;
+
+	index = atoi(Cmd_Argv(1));
+	if (index < 0 || index >= MAX_CONFIGSTRINGS) {
+		Com_Error(ERR_DROP, "CL_ConfigstringModified: bad index %i", index);
+	}
+
+	// everything after "cs <num>"
+	if (!CL_SetGameStateString(&cl.gameState, index, Cmd_ArgsFrom(2))) {
+		return;
 	}
 
 	if (index == CS_SYSTEMINFO) {
@@ -256,7 +281,7 @@ qboolean CL_GetServerCommand(int serverCommandNumber) {
 	int argc;
 
 	// if we have irretrievably lost a reliable command, drop the connection
-	if (serverCommandNumber <= clc.serverCommandSequence - MAX_RELIABLE_COMMANDS) {
+	if (serverCommandNumber <= clc.serverCommandSequence - MAX_PACKED_RELIABLE_COMMANDS) {
 		// when a demo record was started after the client got a whole bunch of
 		// reliable commands then the client never got those first reliable commands
 		if (clc.demoplaying)
@@ -270,7 +295,7 @@ qboolean CL_GetServerCommand(int serverCommandNumber) {
 		return qfalse;
 	}
 
-	s = clc.serverCommands[serverCommandNumber & (MAX_RELIABLE_COMMANDS - 1)];
+	s = clc.serverCommands[serverCommandNumber & (MAX_PACKED_RELIABLE_COMMANDS - 1)];
 	clc.lastExecutedServerCommand = serverCommandNumber;
 
 	Com_DPrintf("serverCommand: %i : %s\n", serverCommandNumber, s);
@@ -396,6 +421,114 @@ static int FloatAsInt(float f) {
 	return fi.i;
 }
 
+/*
+====================
+CL_CgameAddRefEntityToScene etc.
+
+Traps the cgame calls many times per frame, these are dispatched
+straight from the VM without going through CL_CgameSystemCalls
+====================
+*/
+static intptr_t CL_CgamePointContents(intptr_t *args) {
+	return CM_PointContents(VMA(1), args[2]);
+}
+
+static intptr_t CL_CgameBoxTrace(intptr_t *args) {
+	CM_BoxTrace(VMA(1), VMA(2), VMA(3), VMA(4), VMA(5), args[6], args[7], /*int capsule*/ qfalse);
+	return 0;
+}
+
+static intptr_t CL_CgameTransformedBoxTrace(intptr_t *args) {
+	CM_TransformedBoxTrace(VMA(1), VMA(2), VMA(3), VMA(4), VMA(5), args[6], args[7], VMA(8), VMA(9),
+						   /*int capsule*/ qfalse);
+	return 0;
+}
+
+static intptr_t CL_CgameUpdateEntityPosition(intptr_t *args) {
+	S_UpdateEntityPosition(args[1], VMA(2));
+	return 0;
+}
+
+static intptr_t CL_CgameAddRefEntityToScene(intptr_t *args) {
+	re.AddRefEntityToScene(VMA(1));
+	return 0;
+}
+
+static intptr_t CL_CgameAddRefEntitiesToScene(intptr_t *args) {
+	const refEntity_t *ents = VMA(1);
+	int i;
+
+	if (args[2] < 0 || args[2] > MAX_REFENTITIES) {
+		Com_Error(ERR_DROP, "CG_R_ADDREFENTITIESTOSCENE: bad count %i", (int)args[2]);
+	}
+
+	for (i = 0; i < args[2]; i++) {
+		re.AddRefEntityToScene(&ents[i]);
+	}
+	return 0;
+}
+
+static intptr_t CL_CgameAddPolyToScene(intptr_t *args) {
+	re.AddPolyToScene(args[1], args[2], VMA(3), 1);
+	return 0;
+}
+
+static intptr_t CL_CgameAddLightToScene(intptr_t *args) {
+	re.AddLightToScene(VMA(1), VMF(2), VMF(3), VMF(4), VMF(5));
+	return 0;
+}
+
+static intptr_t CL_CgameSetColor(intptr_t *args) {
+	re.SetColor(VMA(1));
+	return 0;
+}
+
+static intptr_t CL_CgameDrawStretchPic(intptr_t *args) {
+	re.DrawStretchPic(VMF(1), VMF(2), VMF(3), VMF(4), VMF(5), VMF(6), VMF(7), VMF(8), args[9]);
+	return 0;
+}
+
+static intptr_t CL_CgameDrawStretchPics(intptr_t *args) {
+	const stretchPic_t *pics = VMA(1);
+	int i;
+
+	if (args[2] < 0 || args[2] > MAX_STRETCHPICS) {
+		Com_Error(ERR_DROP, "CG_R_DRAWSTRETCHPICS: bad count %i", (int)args[2]);
+	}
+
+	// the backend merges consecutive pics with the same shader into one draw
+	for (i = 0; i < args[2]; i++) {
+		re.DrawStretchPic(pics[i].x, pics[i].y, pics[i].w, pics[i].h, pics[i].s1, pics[i].t1, pics[i].s2, pics[i].t2,
+						  args[3]);
+	}
+	return 0;
+}
+
+static const vmSyscallDef_t cl_cgameSyscalls[] = {
+	{CG_CM_POINTCONTENTS, CL_CgamePointContents, VMINL_NONE},
+	{CG_CM_BOXTRACE, CL_CgameBoxTrace, VMINL_NONE},
+	{CG_CM_TRANSFORMEDBOXTRACE, CL_CgameTransformedBoxTrace, VMINL_NONE},
+	{CG_S_UPDATEENTITYPOSITION, CL_CgameUpdateEntityPosition, VMINL_NONE},
+	{CG_R_ADDREFENTITYTOSCENE, CL_CgameAddRefEntityToScene, VMINL_NONE},
+	{CG_R_ADDREFENTITIESTOSCENE, CL_CgameAddRefEntitiesToScene, VMINL_NONE},
+	{CG_R_ADDPOLYTOSCENE, CL_CgameAddPolyToScene, VMINL_NONE},
+	{CG_R_ADDLIGHTTOSCENE, CL_CgameAddLightToScene, VMINL_NONE},
+	{CG_R_SETCOLOR, CL_CgameSetColor, VMINL_NONE},
+	{CG_R_DRAWSTRETCHPIC, CL_CgameDrawStretchPic, VMINL_NONE},
+	{CG_R_DRAWSTRETCHPICS, CL_CgameDrawStretchPics, VMINL_NONE},
+	{CG_SIN, VM_TrapSin, VMINL_SIN},
+	{CG_COS, VM_TrapCos, VMINL_COS},
+	{CG_SQRT, VM_TrapSqrt, VMINL_SQRT},
+	{CG_FLOOR, VM_TrapFloor, VMINL_FLOOR},
+	{CG_CEIL, VM_TrapCeil, VMINL_CEIL},
+	{CG_MEMSET, VM_TrapMemset, VMINL_MEMSET},
+	{CG_MEMCPY, VM_TrapMemcpy, VMINL_MEMCPY},
+	{CG_MEMMOVE, VM_TrapMemcpy, VMINL_MEMCPY},
+	{CG_STRNCPY, VM_TrapStrncpy, VMINL_STRNCPY},
+	{CG_STRLEN, VM_TrapStrlen, VMINL_STRLEN},
+	{-1, NULL, VMINL_NONE}
+};
+
 /*
 ====================
 CL_CgameSystemCalls
@@ -419,6 +552,8 @@ intptr_t CL_CgameSystemCalls(intptr_t *args) {
 	case CG_CVAR_UPDATE:
 		Cvar_Update(VMA(1));
 		return 0;
+	case CG_CVAR_GENERATION:
+		return Cvar_Generation();
 	case CG_CVAR_SET:
 		Cvar_SetSafe(VMA(1), VMA(2));
 		return 0;
@@ -478,19 +613,16 @@ intptr_t CL_CgameSystemCalls(intptr_t *args) {
 	case CG_CM_TEMPCAPSULEMODEL:
 		return CM_TempBoxModel(VMA(1), VMA(2), /*int capsule*/ qtrue);
 	case CG_CM_POINTCONTENTS:
-		return CM_PointContents(VMA(1), args[2]);
+		return CL_CgamePointContents(args);
 	case CG_CM_TRANSFORMEDPOINTCONTENTS:
 		return CM_TransformedPointContents(VMA(1), args[2], VMA(3), VMA(4));
 	case CG_CM_BOXTRACE:
-		CM_BoxTrace(VMA(1), VMA(2), VMA(3), VMA(4), VMA(5), args[6], args[7], /*int capsule*/ qfalse);
-		return 0;
+		return CL_CgameBoxTrace(args);
 	case CG_CM_CAPSULETRACE:
 		CM_BoxTrace(VMA(1), VMA(2), VMA(3), VMA(4), VMA(5), args[6], args[7], /*int capsule*/ qtrue);
 		return 0;
 	case CG_CM_TRANSFORMEDBOXTRACE:
-		CM_TransformedBoxTrace(VMA(1), VMA(2), VMA(3), VMA(4), VMA(5), args[6], args[7], VMA(8), VMA(9),
-							   /*int capsule*/ qfalse);
-		return 0;
+		return CL_CgameTransformedBoxTrace(args);
 	case CG_CM_TRANSFORMEDCAPSULETRACE:
 		CM_TransformedBoxTrace(VMA(1), VMA(2), VMA(3), VMA(4), VMA(5), args[6], args[7], VMA(8), VMA(9),
 							   /*int capsule*/ qtrue);
@@ -516,8 +648,7 @@ intptr_t CL_CgameSystemCalls(intptr_t *args) {
 		S_StopLoopingSound(args[1]);
 		return 0;
 	case CG_S_UPDATEENTITYPOSITION:
-		S_UpdateEntityPosition(args[1], VMA(2));
-		return 0;
+		return CL_CgameUpdateEntityPosition(args);
 	case CG_S_RESPATIALIZE:
 		S_Respatialize(args[1], VMA(2), VMA(3), args[4]);
 		return 0;
@@ -544,19 +675,18 @@ intptr_t CL_CgameSystemCalls(intptr_t *args) {
 		re.ClearScene();
 		return 0;
 	case CG_R_ADDREFENTITYTOSCENE:
-		re.AddRefEntityToScene(VMA(1));
-		return 0;
+		return CL_CgameAddRefEntityToScene(args);
+	case CG_R_ADDREFENTITIESTOSCENE:
+		return CL_CgameAddRefEntitiesToScene(args);
 	case CG_R_ADDPOLYTOSCENE:
-		re.AddPolyToScene(args[1], args[2], VMA(3), 1);
-		return 0;
+		return CL_CgameAddPolyToScene(args);
 	case CG_R_ADDPOLYSTOSCENE:
 		re.AddPolyToScene(args[1], args[2], VMA(3), args[4]);
 		return 0;
 	case CG_R_LIGHTFORPOINT:
 		return re.LightForPoint(VMA(1), VMA(2), VMA(3), VMA(4));
 	case CG_R_ADDLIGHTTOSCENE:
-		re.AddLightToScene(VMA(1), VMF(2), VMF(3), VMF(4), VMF(5));
-		return 0;
+		return CL_CgameAddLightToScene(args);
 	case CG_R_ADDADDITIVELIGHTTOSCENE:
 		re.AddAdditiveLightToScene(VMA(1), VMF(2), VMF(3), VMF(4), VMF(5));
 		return 0;
@@ -564,11 +694,11 @@ intptr_t CL_CgameSystemCalls(intptr_t *args) {
 		re.RenderScene(VMA(1));
 		return 0;
 	case CG_R_SETCOLOR:
-		re.SetColor(VMA(1));
-		return 0;
+		return CL_CgameSetColor(args);
 	case CG_R_DRAWSTRETCHPIC:
-		re.DrawStretchPic(VMF(1), VMF(2), VMF(3), VMF(4), VMF(5), VMF(6), VMF(7), VMF(8), args[9]);
-		return 0;
+		return CL_CgameDrawStretchPic(args);
+	case CG_R_DRAWSTRETCHPICS:
+		return CL_CgameDrawStretchPics(args);
 	case CG_R_MODELBOUNDS:
 		re.ModelBounds(args[1], VMA(2), VMA(3));
 		return 0;
@@ -608,26 +738,26 @@ intptr_t CL_CgameSystemCalls(intptr_t *args) {
 		return Key_GetKey(VMA(1));
 
 	case CG_MEMSET:
-		Com_Memset(VMA(1), args[2], args[3]);
-		return 0;
+		return VM_TrapMemset(args);
 	case CG_MEMCPY:
-		Com_Memcpy(VMA(1), VMA(2), args[3]);
-		return 0;
+	case CG_MEMMOVE:
+		return VM_TrapMemcpy(args);
 	case CG_STRNCPY:
-		strncpy(VMA(1), VMA(2), args[3]);
-		return args[1];
+		return VM_TrapStrncpy(args);
+	case CG_STRLEN:
+		return VM_TrapStrlen(args);
 	case CG_SIN:
-		return FloatAsInt(sin(VMF(1)));
+		return VM_TrapSin(args);
 	case CG_COS:
-		return FloatAsInt(cos(VMF(1)));
+		return VM_TrapCos(args);
 	case CG_ATAN2:
 		return FloatAsInt(atan2(VMF(1), VMF(2)));
 	case CG_SQRT:
-		return FloatAsInt(sqrt(VMF(1)));
+		return VM_TrapSqrt(args);
 	case CG_FLOOR:
-		return FloatAsInt(floor(VMF(1)));
+		return VM_TrapFloor(args);
 	case CG_CEIL:
-		return FloatAsInt(ceil(VMF(1)));
+		return VM_TrapCeil(args);
 	case CG_ACOS:
 		return FloatAsInt(Q_acos(VMF(1)));
 
@@ -699,6 +829,33 @@ intptr_t CL_CgameSystemCalls(intptr_t *args) {
 	return 0;
 }
 
+/*
+====================
+CL_PrefetchGameState
+
+Get the models and sounds of the gamestate inflated while the
+cgame is still starting up, it registers all of them first thing
+====================
+*/
+static void CL_PrefetchGameState(void) {
+	char *names[MAX_MODELS + MAX_SOUNDS];
+	int i, count;
+
+	count = 0;
+	for (i = 1; i < MAX_MODELS; i++) {
+		names[count] = cl.gameState.stringData + cl.gameState.stringOffsets[CS_MODELS + i];
+		if (names[count][0])
+			count++;
+	}
+	for (i = 1; i < MAX_SOUNDS; i++) {
+		names[count] = cl.gameState.stringData + cl.gameState.stringOffsets[CS_SOUNDS + i];
+		if (names[count][0])
+			count++;
+	}
+
+	FS_Prefetch(NULL, names, count);
+}
+
 /*
 ====================
 CL_InitCGame
@@ -730,16 +887,19 @@ void CL_InitCGame(void) {
 			interpret = VMI_COMPILED;
 	}
 
-	cgvm = VM_Create("cgame", CL_CgameSystemCalls, interpret);
+	cgvm = VM_Create("cgame", CL_CgameSystemCalls, cl_cgameSyscalls, interpret);
 	if (!cgvm) {
 		Com_Error(ERR_DROP, "VM_Create on cgame failed");
 	}
 	clc.state = CA_LOADING;
 
+	CL_PrefetchGameState();
+
 	// init for this gamestate
 	// use the lastExecutedServerCommand instead of the serverCommandSequence
 	// otherwise server commands sent just before a gamestate are dropped
 	VM_Call(cgvm, CG_INIT, clc.serverMessageSequence, clc.lastExecutedServerCommand, clc.clientNum);
+	FS_FlushPrefetch();
 
 	// reset any CVAR_CHEAT cvars registered by cgame
 	if (!clc.demoplaying && !cl_connectedToCheatServer)
@@ -758,7 +918,7 @@ void CL_InitCGame(void) {
 	re.EndRegistration();
 
 	// make sure everything is paged in
-	if (!Sys_LowPhysicalMemory()) {
+	if (com_touchMemory->integer && !Sys_LowPhysicalMemory()) {
 		Com_TouchMemory();
 	}
 
@@ -766,6 +926,34 @@ void CL_InitCGame(void) {
 	Con_ClearNotify();
 }
 
+/*
+====================
+CL_RestartCGame
+
+Starts the cgame over on the current gamestate and snapshot, reloading
+the VM in place like a map_restart does for the game
+====================
+*/
+void CL_RestartCGame(void) {
+	if (!cgvm) {
+		return;
+	}
+
+	Key_SetCatcher(Key_GetCatcher() & ~KEYCATCH_CGAME);
+	VM_Call(cgvm, CG_SHUTDOWN);
+
+	cgvm = VM_Restart(cgvm, !cl_connectedToPureServer);
+	if (!cgvm) {
+		Com_Error(ERR_DROP, "VM_Restart on cgame failed");
+	}
+	clc.state = CA_LOADING;
+
+	VM_Call(cgvm, CG_INIT, clc.serverMessageSequence, clc.lastExecutedServerCommand, clc.clientNum);
+
+	clc.state = CA_PRIMED;
+	Con_ClearNotify();
+}
+
 /*
 ====================
 CL_GameCommand
@@ -787,8 +975,18 @@ CL_CGameRendering
 =====================
 */
 void CL_CGameRendering(stereoFrame_t stereo) {
+	int64_t start = 0;
+
+	if (CL_TimeDemoMeasuring()) {
+		start = Sys_Microseconds();
+	}
+
 	VM_Call(cgvm, CG_DRAW_ACTIVE_FRAME, cl.serverTime, stereo, clc.demoplaying);
 	VM_Debug(0);
+
+	if (start) {
+		CL_TimeDemoAddTime(TD_CGAME, Sys_Microseconds() - start);
+	}
 }
 
 /*
@@ -920,6 +1118,7 @@ void CL_FirstSnapshot(void) {
 		}
 		clc.voipCodecInitialized = qtrue;
 		clc.voipMuteAll = qfalse;
+		CL_StartVoipDecoder();
 		Cmd_AddCommand("voip", CL_Voip_f);
 		Cvar_Set("cl_voipSendTarget", "spatial");
 		Com_Memset(clc.voipTargets, ~0, sizeof(clc.voipTargets));
@@ -1033,7 +1232,9 @@ void CL_SetCGameTime(void) {
 			clc.timeDemoStart = clc.timeDemoLastFrame = now;
 			clc.timeDemoMinDuration = INT_MAX;
 			clc.timeDemoMaxDuration = 0;
+			CL_TimeDemoBegin();
 		}
+		CL_TimeDemoFrame();
 
 		frameDuration = now - clc.timeDemoLastFrame;
 		clc.timeDemoLastFrame = now;
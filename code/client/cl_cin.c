@@ -471,9 +471,15 @@ static void blitVQQuad32fs(byte **status, unsigned char *data) {
  ******************************************************************************/
 
 void ROQ_GenYUVTables(void) {
+	static qboolean generated;
 	float t_ub, t_vr, t_ug, t_vg;
 	long i;
 
+	// the ogm decode thread reads them while a RoQ may start
+	if (generated)
+		return;
+	generated = qtrue;
+
 	t_ub = (1.77200f / 2.0f) * (float)(1 << 6) + 0.5f;
 	t_vr = (1.40200f / 2.0f) * (float)(1 << 6) + 0.5f;
 	t_ug = (0.34414f / 2.0f) * (float)(1 << 6) + 0.5f;
@@ -1415,10 +1421,11 @@ e_status CIN_RunCinematic(int handle) {
 	}
 
 	if (cinTable[currentHandle].fileType == FT_OGM) {
+		int ogmStatus = Cin_OGM_Run(&cin, cinTable[currentHandle].startTime == 0
+											  ? 0
+											  : CL_ScaledMilliseconds() - cinTable[currentHandle].startTime);
 
-		if (Cin_OGM_Run(&cin, cinTable[currentHandle].startTime == 0
-								  ? 0
-								  : CL_ScaledMilliseconds() - cinTable[currentHandle].startTime))
+		if (ogmStatus == 1)
 			cinTable[currentHandle].status = FMV_EOF;
 		else {
 			int newW, newH;
@@ -1454,7 +1461,9 @@ e_status CIN_RunCinematic(int handle) {
 			}
 
 			cinTable[currentHandle].status = FMV_PLAY;
-			cinTable[currentHandle].dirty = qtrue;
+			// the frame is only uploaded again once it changed
+			if (ogmStatus == 2)
+				cinTable[currentHandle].dirty = qtrue;
 		}
 
 		if (!cinTable[currentHandle].startTime)
@@ -47,6 +47,7 @@ CURLMcode (*qcurl_multi_fdset)(CURLM *multi_handle, fd_set *read_fd_set, fd_set
 CURLMcode (*qcurl_multi_perform)(CURLM *multi_handle, int *running_handles);
 CURLMcode (*qcurl_multi_cleanup)(CURLM *multi_handle);
 CURLMsg *(*qcurl_multi_info_read)(CURLM *multi_handle, int *msgs_in_queue);
+CURLMcode (*qcurl_multi_setopt)(CURLM *multi_handle, CURLMoption option, ...);
 const char *(*qcurl_multi_strerror)(CURLMcode);
 
 static void *cURLLib = NULL;
@@ -110,6 +111,7 @@ qboolean CL_cURL_Init(void) {
 	qcurl_multi_perform = GPA("curl_multi_perform");
 	qcurl_multi_cleanup = GPA("curl_multi_cleanup");
 	qcurl_multi_info_read = GPA("curl_multi_info_read");
+	qcurl_multi_setopt = GPA("curl_multi_setopt");
 	qcurl_multi_strerror = GPA("curl_multi_strerror");
 
 	if (!clc.cURLEnabled) {
@@ -153,43 +155,129 @@ void CL_cURL_Shutdown(void) {
 	qcurl_multi_perform = NULL;
 	qcurl_multi_cleanup = NULL;
 	qcurl_multi_info_read = NULL;
+	qcurl_multi_setopt = NULL;
 	qcurl_multi_strerror = NULL;
 #endif /* USE_CURL_DLOPEN */
 }
 
+/*
+=============================================================================
+
+TRANSFERS
+
+Up to cl_cURLTransfers files download at once on one multi handle.  The easy
+handles are kept between files and the multi handle lives until all the
+downloads are done, so the connections to the server are reused.  A .tmp
+file left by an earlier attempt is resumed with a range request.
+
+=============================================================================
+*/
+
+#define MAX_CURL_TRANSFERS 8
+
+typedef struct {
+	CURL *curl; // kept between files
+	qboolean active;
+	qboolean checked; // the response to a range request was looked at
+	qboolean retried; // restarted from the beginning after a failed resume
+	fileHandle_t file;
+	int resumeFrom; // bytes of the .tmp file kept from an earlier attempt
+	int size;
+	int count;
+	char localName[MAX_OSPATH];
+	char tempName[MAX_OSPATH];
+	char URL[MAX_OSPATH];
+} cURLTransfer_t;
+
+static cURLTransfer_t cURLTransfers[MAX_CURL_TRANSFERS];
+static int cURLBytesDone; // bytes of the files finished since the downloads started
+
+cvar_t *cl_cURLTransfers;
+
 void CL_cURL_Cleanup(void) {
-	if (clc.downloadCURLM) {
-		CURLMcode result;
+	cURLTransfer_t *t;
+	CURLMcode result;
+	int i;
 
-		if (clc.downloadCURL) {
-			result = qcurl_multi_remove_handle(clc.downloadCURLM, clc.downloadCURL);
+	for (i = 0, t = cURLTransfers; i < MAX_CURL_TRANSFERS; i++, t++) {
+		if (t->active && clc.downloadCURLM) {
+			result = qcurl_multi_remove_handle(clc.downloadCURLM, t->curl);
 			if (result != CURLM_OK) {
 				Com_DPrintf("qcurl_multi_remove_handle failed: %s\n", qcurl_multi_strerror(result));
 			}
-			qcurl_easy_cleanup(clc.downloadCURL);
 		}
+		if (t->file) {
+			FS_FCloseFile(t->file);
+		}
+		if (t->curl) {
+			qcurl_easy_cleanup(t->curl);
+		}
+		Com_Memset(t, 0, sizeof(*t));
+	}
+
+	if (clc.downloadCURLM) {
 		result = qcurl_multi_cleanup(clc.downloadCURLM);
 		if (result != CURLM_OK) {
 			Com_DPrintf("CL_cURL_Cleanup: qcurl_multi_cleanup failed: %s\n", qcurl_multi_strerror(result));
 		}
 		clc.downloadCURLM = NULL;
-		clc.downloadCURL = NULL;
-	} else if (clc.downloadCURL) {
-		qcurl_easy_cleanup(clc.downloadCURL);
-		clc.downloadCURL = NULL;
 	}
+	cURLBytesDone = 0;
 }
 
-static int CL_cURL_CallbackProgress(void *dummy, double dltotal, double dlnow, double ultotal, double ulnow) {
-	clc.downloadSize = (int)dltotal;
+/*
+=================
+CL_cURL_UpdateProgress
+
+The UI is shown the totals over all the transfers
+=================
+*/
+static void CL_cURL_UpdateProgress(void) {
+	cURLTransfer_t *t;
+	int i;
+
+	clc.downloadSize = clc.downloadCount = cURLBytesDone;
+	for (i = 0, t = cURLTransfers; i < MAX_CURL_TRANSFERS; i++, t++) {
+		if (t->active) {
+			clc.downloadSize += t->size;
+			clc.downloadCount += t->count;
+		}
+	}
 	Cvar_SetValue("cl_downloadSize", clc.downloadSize);
-	clc.downloadCount = (int)dlnow;
 	Cvar_SetValue("cl_downloadCount", clc.downloadCount);
+}
+
+static int CL_cURL_CallbackProgress(void *clientp, double dltotal, double dlnow, double ultotal, double ulnow) {
+	cURLTransfer_t *t = clientp;
+
+	// the totals curl reports don't include the resumed part
+	t->size = t->resumeFrom + (int)dltotal;
+	t->count = t->resumeFrom + (int)dlnow;
+	CL_cURL_UpdateProgress();
 	return 0;
 }
 
 static size_t CL_cURL_CallbackWrite(void *buffer, size_t size, size_t nmemb, void *stream) {
-	FS_Write(buffer, size * nmemb, ((fileHandle_t *)stream)[0]);
+	cURLTransfer_t *t = stream;
+
+	if (t->resumeFrom && !t->checked) {
+		long code = 0;
+
+		t->checked = qtrue;
+		qcurl_easy_getinfo(t->curl, CURLINFO_RESPONSE_CODE, &code);
+		if (code == 200) {
+			// the server ignored the range and sends the whole file
+			Com_DPrintf("%s: range not supported, restarting\n", t->localName);
+			FS_FCloseFile(t->file);
+			t->file = FS_SV_FOpenFileWrite(t->tempName);
+			t->resumeFrom = 0;
+			if (!t->file) {
+				return 0;
+			}
+		}
+	}
+
+	FS_Write(buffer, size * nmemb, t->file);
 	return size * nmemb;
 }
 
@@ -218,8 +306,136 @@ CURLcode qcurl_easy_setopt_warn(CURL *curl, CURLoption option, ...) {
 	return result;
 }
 
-void CL_cURL_BeginDownload(const char *localName, const char *remoteURL) {
+/*
+=================
+CL_cURL_NewHandle
+
+Sets the options that stay the same for every file
+=================
+*/
+static CURL *CL_cURL_NewHandle(void) {
+	CURL *curl;
+
+	curl = qcurl_easy_init();
+	if (!curl) {
+		return NULL;
+	}
+
+	if (com_developer->integer)
+		qcurl_easy_setopt_warn(curl, CURLOPT_VERBOSE, 1);
+	qcurl_easy_setopt_warn(curl, CURLOPT_TRANSFERTEXT, 0);
+	qcurl_easy_setopt_warn(curl, CURLOPT_REFERER, va("ioQ3://%s", NET_AdrToString(clc.serverAddress)));
+	qcurl_easy_setopt_warn(curl, CURLOPT_USERAGENT, va("%s %s", Q3_VERSION, qcurl_version()));
+	qcurl_easy_setopt_warn(curl, CURLOPT_WRITEFUNCTION, CL_cURL_CallbackWrite);
+	qcurl_easy_setopt_warn(curl, CURLOPT_NOPROGRESS, 0);
+	qcurl_easy_setopt_warn(curl, CURLOPT_PROGRESSFUNCTION, CL_cURL_CallbackProgress);
+	qcurl_easy_setopt_warn(curl, CURLOPT_FAILONERROR, 1);
+	qcurl_easy_setopt_warn(curl, CURLOPT_FOLLOWLOCATION, 1);
+	qcurl_easy_setopt_warn(curl, CURLOPT_MAXREDIRS, 5);
+	qcurl_easy_setopt_warn(curl, CURLOPT_PROTOCOLS, CURLPROTO_HTTP | CURLPROTO_HTTPS | CURLPROTO_FTP | CURLPROTO_FTPS);
+	qcurl_easy_setopt_warn(curl, CURLOPT_BUFFERSIZE, CURL_MAX_READ_SIZE);
+
+	return curl;
+}
+
+/*
+=================
+CL_cURL_StartTransfer
+=================
+*/
+static void CL_cURL_StartTransfer(cURLTransfer_t *t, qboolean resume) {
 	CURLMcode result;
+	long len = 0;
+
+	if (resume) {
+		len = FS_SV_FOpenFileAppend(t->tempName, &t->file);
+	} else {
+		t->file = FS_SV_FOpenFileWrite(t->tempName);
+	}
+	if (!t->file) {
+		Com_Error(ERR_DROP, "CL_cURL_BeginDownload: failed to open %s for writing", t->tempName);
+		return;
+	}
+
+	if (!t->curl) {
+		t->curl = CL_cURL_NewHandle();
+		if (!t->curl) {
+			Com_Error(ERR_DROP, "CL_cURL_BeginDownload: qcurl_easy_init() failed");
+			return;
+		}
+	}
+
+	t->resumeFrom = len > 0 ? len : 0;
+	t->checked = qfalse;
+	t->size = t->count = t->resumeFrom;
+	if (t->resumeFrom) {
+		Com_Printf("Resuming %s at %d bytes\n", t->localName, t->resumeFrom);
+	}
+
+	qcurl_easy_setopt_warn(t->curl, CURLOPT_URL, t->URL);
+	qcurl_easy_setopt_warn(t->curl, CURLOPT_WRITEDATA, t);
+	qcurl_easy_setopt_warn(t->curl, CURLOPT_PROGRESSDATA, t);
+	qcurl_easy_setopt_warn(t->curl, CURLOPT_RESUME_FROM_LARGE, (curl_off_t)t->resumeFrom);
+
+	result = qcurl_multi_add_handle(clc.downloadCURLM, t->curl);
+	if (result != CURLM_OK) {
+		Com_Error(ERR_DROP, "CL_cURL_BeginDownload: qcurl_multi_add_handle() failed: %s", qcurl_multi_strerror(result));
+		return;
+	}
+	t->active = qtrue;
+}
+
+/*
+=================
+CL_cURL_FreeTransfer
+
+Returns a transfer that isn't running, or NULL if cl_cURLTransfers are
+=================
+*/
+static cURLTransfer_t *CL_cURL_FreeTransfer(void) {
+	int i, max;
+
+	max = cl_cURLTransfers->integer;
+	if (max < 1) {
+		max = 1;
+	} else if (max > MAX_CURL_TRANSFERS) {
+		max = MAX_CURL_TRANSFERS;
+	}
+
+	for (i = 0; i < max; i++) {
+		if (!cURLTransfers[i].active) {
+			return &cURLTransfers[i];
+		}
+	}
+	return NULL;
+}
+
+/*
+=================
+CL_cURL_Active
+
+Returns qtrue while any file is being downloaded
+=================
+*/
+qboolean CL_cURL_Active(void) {
+	int i;
+
+	for (i = 0; i < MAX_CURL_TRANSFERS; i++) {
+		if (cURLTransfers[i].active) {
+			return qtrue;
+		}
+	}
+	return qfalse;
+}
+
+void CL_cURL_BeginDownload(const char *localName, const char *remoteURL) {
+	cURLTransfer_t *t;
+
+	t = CL_cURL_FreeTransfer();
+	if (!t) {
+		Com_Error(ERR_DROP, "CL_cURL_BeginDownload: no free transfer");
+		return;
+	}
 
 	clc.cURLUsed = qtrue;
 	Com_Printf("URL: %s\n", remoteURL);
@@ -228,68 +444,35 @@ void CL_cURL_BeginDownload(const char *localName, const char *remoteURL) {
 				"RemoteURL: %s\n"
 				"****************************\n",
 				localName, remoteURL);
-	CL_cURL_Cleanup();
-	Q_strncpyz(clc.downloadURL, remoteURL, sizeof(clc.downloadURL));
-	Q_strncpyz(clc.downloadName, localName, sizeof(clc.downloadName));
-	Com_sprintf(clc.downloadTempName, sizeof(clc.downloadTempName), "%s.tmp", localName);
+	Q_strncpyz(t->URL, remoteURL, sizeof(t->URL));
+	Q_strncpyz(t->localName, localName, sizeof(t->localName));
+	Com_sprintf(t->tempName, sizeof(t->tempName), "%s.tmp", localName);
+	t->retried = qfalse;
 
 	// Set so UI gets access to it
 	Cvar_Set("cl_downloadName", localName);
-	Cvar_Set("cl_downloadSize", "0");
-	Cvar_Set("cl_downloadCount", "0");
-	Cvar_SetValue("cl_downloadTime", cls.realtime);
-
-	clc.downloadBlock = 0; // Starting new file
-	clc.downloadCount = 0;
-
-	clc.downloadCURL = qcurl_easy_init();
-	if (!clc.downloadCURL) {
-		Com_Error(ERR_DROP, "CL_cURL_BeginDownload: qcurl_easy_init() "
-							"failed");
-		return;
-	}
-	clc.download = FS_SV_FOpenFileWrite(clc.downloadTempName);
-	if (!clc.download) {
-		Com_Error(ERR_DROP,
-				  "CL_cURL_BeginDownload: failed to open "
-				  "%s for writing",
-				  clc.downloadTempName);
-		return;
+	if (!CL_cURL_Active()) {
+		cURLBytesDone = 0;
+		Cvar_Set("cl_downloadSize", "0");
+		Cvar_Set("cl_downloadCount", "0");
+		Cvar_SetValue("cl_downloadTime", cls.realtime);
 	}
 
-	if (com_developer->integer)
-		qcurl_easy_setopt_warn(clc.downloadCURL, CURLOPT_VERBOSE, 1);
-	qcurl_easy_setopt_warn(clc.downloadCURL, CURLOPT_URL, clc.downloadURL);
-	qcurl_easy_setopt_warn(clc.downloadCURL, CURLOPT_TRANSFERTEXT, 0);
-	qcurl_easy_setopt_warn(clc.downloadCURL, CURLOPT_REFERER, va("ioQ3://%s", NET_AdrToString(clc.serverAddress)));
-	qcurl_easy_setopt_warn(clc.downloadCURL, CURLOPT_USERAGENT, va("%s %s", Q3_VERSION, qcurl_version()));
-	qcurl_easy_setopt_warn(clc.downloadCURL, CURLOPT_WRITEFUNCTION, CL_cURL_CallbackWrite);
-	qcurl_easy_setopt_warn(clc.downloadCURL, CURLOPT_WRITEDATA, &clc.download);
-	qcurl_easy_setopt_warn(clc.downloadCURL, CURLOPT_NOPROGRESS, 0);
-	qcurl_easy_setopt_warn(clc.downloadCURL, CURLOPT_PROGRESSFUNCTION, CL_cURL_CallbackProgress);
-	qcurl_easy_setopt_warn(clc.downloadCURL, CURLOPT_PROGRESSDATA, NULL);
-	qcurl_easy_setopt_warn(clc.downloadCURL, CURLOPT_FAILONERROR, 1);
-	qcurl_easy_setopt_warn(clc.downloadCURL, CURLOPT_FOLLOWLOCATION, 1);
-	qcurl_easy_setopt_warn(clc.downloadCURL, CURLOPT_MAXREDIRS, 5);
-	qcurl_easy_setopt_warn(clc.downloadCURL, CURLOPT_PROTOCOLS,
-						   CURLPROTO_HTTP | CURLPROTO_HTTPS | CURLPROTO_FTP | CURLPROTO_FTPS);
-	qcurl_easy_setopt_warn(clc.downloadCURL, CURLOPT_BUFFERSIZE, CURL_MAX_READ_SIZE);
-	clc.downloadCURLM = qcurl_multi_init();
+	clc.downloadBlock = 0;
+
 	if (!clc.downloadCURLM) {
-		qcurl_easy_cleanup(clc.downloadCURL);
-		clc.downloadCURL = NULL;
-		Com_Error(ERR_DROP, "CL_cURL_BeginDownload: qcurl_multi_init() "
-							"failed");
-		return;
-	}
-	result = qcurl_multi_add_handle(clc.downloadCURLM, clc.downloadCURL);
-	if (result != CURLM_OK) {
-		qcurl_easy_cleanup(clc.downloadCURL);
-		clc.downloadCURL = NULL;
-		Com_Error(ERR_DROP, "CL_cURL_BeginDownload: qcurl_multi_add_handle() failed: %s", qcurl_multi_strerror(result));
-		return;
+		clc.downloadCURLM = qcurl_multi_init();
+		if (!clc.downloadCURLM) {
+			Com_Error(ERR_DROP, "CL_cURL_BeginDownload: qcurl_multi_init() "
+								"failed");
+			return;
+		}
+		// several files from the same server can share one connection
+		qcurl_multi_setopt(clc.downloadCURLM, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
 	}
 
+	CL_cURL_StartTransfer(t, qtrue);
+
 	if (!(clc.sv_allowDownload & DLF_NO_DISCONNECT) && !clc.cURLDisconnected) {
 
 		CL_AddReliableCommand("disconnect", qtrue);
@@ -300,6 +483,47 @@ void CL_cURL_BeginDownload(const char *localName, const char *remoteURL) {
 	}
 }
 
+/*
+=================
+CL_cURL_FinishTransfer
+=================
+*/
+static void CL_cURL_FinishTransfer(cURLTransfer_t *t, CURLcode code) {
+	char *zippath;
+	long response;
+
+	qcurl_multi_remove_handle(clc.downloadCURLM, t->curl);
+	FS_FCloseFile(t->file);
+	t->file = 0;
+	t->active = qfalse;
+
+	if (code != CURLE_OK) {
+		if (t->resumeFrom && !t->retried) {
+			// the partial file may not belong to the one on the server
+			Com_Printf("Couldn't resume %s, downloading it again\n", t->localName);
+			t->retried = qtrue;
+			CL_cURL_StartTransfer(t, qfalse);
+			return;
+		}
+
+		response = 0;
+		qcurl_easy_getinfo(t->curl, CURLINFO_RESPONSE_CODE, &response);
+		Com_Error(ERR_DROP, "Download Error: %s Code: %ld URL: %s", qcurl_easy_strerror(code), response, t->URL);
+		return;
+	}
+
+	FS_SV_Rename(t->tempName, t->localName, qfalse);
+	clc.downloadRestart = qtrue;
+	cURLBytesDone += t->count;
+
+	// check whether this matches a referenced checksum
+	zippath = FS_BuildOSPath(Cvar_VariableString("fs_homepath"), t->localName, "");
+	zippath[strlen(zippath) - 1] = '\0';
+
+	if (!FS_CompareZipChecksum(zippath))
+		Com_Error(ERR_DROP, "Incorrect checksum for file: %s", t->localName);
+}
+
 void CL_cURL_PerformDownload(void) {
 	CURLMcode res;
 	CURLMsg *msg;
@@ -313,22 +537,26 @@ void CL_cURL_PerformDownload(void) {
 	}
 	if (res == CURLM_CALL_MULTI_PERFORM)
 		return;
-	msg = qcurl_multi_info_read(clc.downloadCURLM, &c);
-	if (msg == NULL) {
-		return;
+
+	while ((msg = qcurl_multi_info_read(clc.downloadCURLM, &c)) != NULL) {
+		if (msg->msg != CURLMSG_DONE) {
+			continue;
+		}
+		for (i = 0; i < MAX_CURL_TRANSFERS; i++) {
+			if (cURLTransfers[i].active && cURLTransfers[i].curl == msg->easy_handle) {
+				CL_cURL_FinishTransfer(&cURLTransfers[i], msg->data.result);
+				break;
+			}
+		}
 	}
-	FS_FCloseFile(clc.download);
-	if (msg->msg == CURLMSG_DONE && msg->data.result == CURLE_OK) {
-		FS_SV_Rename(clc.downloadTempName, clc.downloadName, qfalse);
-		clc.downloadRestart = qtrue;
-	} else {
-		long code;
 
-		qcurl_easy_getinfo(msg->easy_handle, CURLINFO_RESPONSE_CODE, &code);
-		Com_Error(ERR_DROP, "Download Error: %s Code: %ld URL: %s", qcurl_easy_strerror(msg->data.result), code,
-				  clc.downloadURL);
+	// keep the transfers busy with the rest of the list
+	while (*clc.downloadList && CL_cURL_FreeTransfer()) {
+		CL_NextDownload();
 	}
 
-	CL_NextDownload();
+	if (!CL_cURL_Active()) {
+		CL_NextDownload();
+	}
 }
 #endif /* USE_CURL */
@@ -63,6 +63,7 @@ extern CURLMcode (*qcurl_multi_fdset)(CURLM *multi_handle, fd_set *read_fd_set,
 extern CURLMcode (*qcurl_multi_perform)(CURLM *multi_handle, int *running_handles);
 extern CURLMcode (*qcurl_multi_cleanup)(CURLM *multi_handle);
 extern CURLMsg *(*qcurl_multi_info_read)(CURLM *multi_handle, int *msgs_in_queue);
+extern CURLMcode (*qcurl_multi_setopt)(CURLM *multi_handle, CURLMoption option, ...);
 extern const char *(*qcurl_multi_strerror)(CURLMcode);
 #else
 #define qcurl_version curl_version
@@ -83,12 +84,16 @@ extern const char *(*qcurl_multi_strerror)(CURLMcode);
 #define qcurl_multi_perform curl_multi_perform
 #define qcurl_multi_cleanup curl_multi_cleanup
 #define qcurl_multi_info_read curl_multi_info_read
+#define qcurl_multi_setopt curl_multi_setopt
 #define qcurl_multi_strerror curl_multi_strerror
 #endif
 
+extern cvar_t *cl_cURLTransfers;
+
 qboolean CL_cURL_Init(void);
 void CL_cURL_Shutdown(void);
 void CL_cURL_BeginDownload(const char *localName, const char *remoteURL);
 void CL_cURL_PerformDownload(void);
+qboolean CL_cURL_Active(void);
 void CL_cURL_Cleanup(void);
 #endif // __QCURL_H__
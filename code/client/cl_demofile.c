@@ -0,0 +1,468 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+// cl_demofile.c -- demo file container
+
+#include "client.h"
+
+/*
+=============================================================================
+
+A demo is a stream of messages, each one the sequence number, the length
+and the message itself, ended by a sequence and length of -1.  A legacy
+demo file is that stream as it is.  With cl_demoCompress the stream is cut
+into blocks that are LZ compressed on their own:
+
+	header		"WDMZ", version, block size
+	blocks		raw length, stored length, data; stored as is if the
+				stored length equals the raw one
+	end			a raw length of 0
+	index		number of blocks, then the file offset and stream
+				offset of each
+	trailer		offset of the index, "WDMI"
+
+Offsets given to CL_DemoRewind are in the stream, so the seek code works
+the same on both.  A recording that was cut off has no index, the block
+table is then built as the blocks are read.
+
+All writes go through FS_WriteQueued, so the disk write happens on the
+file system's write thread.
+
+=============================================================================
+*/
+
+#define DEMO_MAGIC ('W' | ('D' << 8) | ('M' << 16) | ('Z' << 24))
+#define DEMO_INDEX_MAGIC ('W' | ('D' << 8) | ('M' << 16) | ('I' << 24))
+#define DEMO_VERSION 1
+#define DEMO_BLOCK_SIZE 0x10000
+#define DEMO_HEADER_SIZE 12
+
+typedef struct {
+	int fileOffset;	  // of the block header
+	int streamOffset; // of the first byte of the block
+} demoBlock_t;
+
+typedef struct {
+	qboolean compressed;
+	int bytesWritten;
+
+	// the block being filled or read
+	byte block[DEMO_BLOCK_SIZE];
+	int blockLength;
+	int blockPos;
+	int blockStream; // stream offset of the block
+	int nextFile;	 // file offset of the next block header
+
+	byte packed[DEMO_BLOCK_SIZE];
+
+	demoBlock_t *blocks;
+	int numBlocks, maxBlocks;
+} demoFile_t;
+
+static demoFile_t demoFile;
+
+/*
+====================
+CL_DemoAddBlock
+====================
+*/
+static void CL_DemoAddBlock(int fileOffset, int streamOffset) {
+	demoBlock_t *blocks;
+
+	// already known when a block is read again after a rewind
+	if (demoFile.numBlocks && demoFile.blocks[demoFile.numBlocks - 1].streamOffset >= streamOffset) {
+		return;
+	}
+
+	if (demoFile.numBlocks == demoFile.maxBlocks) {
+		demoFile.maxBlocks = demoFile.maxBlocks ? demoFile.maxBlocks * 2 : 64;
+		blocks = Z_Malloc(demoFile.maxBlocks * sizeof(*blocks));
+		if (demoFile.blocks) {
+			Com_Memcpy(blocks, demoFile.blocks, demoFile.numBlocks * sizeof(*blocks));
+			Z_Free(demoFile.blocks);
+		}
+		demoFile.blocks = blocks;
+	}
+
+	demoFile.blocks[demoFile.numBlocks].fileOffset = fileOffset;
+	demoFile.blocks[demoFile.numBlocks].streamOffset = streamOffset;
+	demoFile.numBlocks++;
+}
+
+/*
+====================
+CL_DemoReset
+====================
+*/
+static void CL_DemoReset(void) {
+	if (demoFile.blocks) {
+		Z_Free(demoFile.blocks);
+	}
+
+	demoFile.compressed = qfalse;
+	demoFile.bytesWritten = 0;
+	demoFile.blockLength = 0;
+	demoFile.blockPos = 0;
+	demoFile.blockStream = 0;
+	demoFile.nextFile = 0;
+	demoFile.blocks = NULL;
+	demoFile.numBlocks = demoFile.maxBlocks = 0;
+}
+
+/*
+====================
+CL_DemoWriteFile
+====================
+*/
+static void CL_DemoWriteFile(const void *data, int len) {
+	FS_WriteQueued(data, len, clc.demofile);
+	demoFile.bytesWritten += len;
+}
+
+/*
+====================
+CL_DemoFlushBlock
+====================
+*/
+static void CL_DemoFlushBlock(void) {
+	int header[2];
+	int length;
+
+	if (!demoFile.blockLength) {
+		return;
+	}
+
+	CL_DemoAddBlock(demoFile.nextFile, demoFile.blockStream);
+
+	// stored as is if compressing doesn't save anything
+	length = LZ_Compress(demoFile.block, demoFile.blockLength, demoFile.packed, demoFile.blockLength - 1);
+
+	header[0] = LittleLong(demoFile.blockLength);
+	header[1] = LittleLong(length ? length : demoFile.blockLength);
+	CL_DemoWriteFile(header, sizeof(header));
+	CL_DemoWriteFile(length ? demoFile.packed : demoFile.block, length ? length : demoFile.blockLength);
+
+	demoFile.nextFile += sizeof(header) + (length ? length : demoFile.blockLength);
+	demoFile.blockStream += demoFile.blockLength;
+	demoFile.blockLength = 0;
+}
+
+/*
+====================
+CL_DemoOpenWrite
+
+Opens clc.demofile for recording, compressed if cl_demoCompress is set
+====================
+*/
+qboolean CL_DemoOpenWrite(const char *name) {
+	int header[DEMO_HEADER_SIZE / 4];
+
+	CL_DemoReset();
+
+	clc.demofile = FS_FOpenFileWrite(name);
+	if (!clc.demofile) {
+		return qfalse;
+	}
+
+	if (cl_demoCompress->integer) {
+		demoFile.compressed = qtrue;
+
+		header[0] = LittleLong(DEMO_MAGIC);
+		header[1] = LittleLong(DEMO_VERSION);
+		header[2] = LittleLong(DEMO_BLOCK_SIZE);
+		CL_DemoWriteFile(header, sizeof(header));
+		demoFile.nextFile = sizeof(header);
+	}
+
+	return qtrue;
+}
+
+/*
+====================
+CL_DemoWrite
+====================
+*/
+void CL_DemoWrite(const void *data, int len) {
+	const byte *p = data;
+	int n;
+
+	if (!demoFile.compressed) {
+		CL_DemoWriteFile(data, len);
+		return;
+	}
+
+	while (len > 0) {
+		n = MIN(len, DEMO_BLOCK_SIZE - demoFile.blockLength);
+		Com_Memcpy(demoFile.block + demoFile.blockLength, p, n);
+		demoFile.blockLength += n;
+		p += n;
+		len -= n;
+
+		if (demoFile.blockLength == DEMO_BLOCK_SIZE) {
+			CL_DemoFlushBlock();
+		}
+	}
+}
+
+/*
+====================
+CL_DemoCloseWrite
+
+Writes out the last block and the index, and closes clc.demofile
+====================
+*/
+void CL_DemoCloseWrite(void) {
+	int *index;
+	int i, indexLength, end;
+
+	if (!clc.demofile) {
+		return;
+	}
+
+	if (demoFile.compressed) {
+		CL_DemoFlushBlock();
+
+		end = 0;
+		CL_DemoWriteFile(&end, sizeof(end));
+
+		indexLength = 1 + demoFile.numBlocks * 2 + 2;
+		index = Z_Malloc(indexLength * sizeof(*index));
+
+		index[0] = LittleLong(demoFile.numBlocks);
+		for (i = 0; i < demoFile.numBlocks; i++) {
+			index[1 + i * 2] = LittleLong(demoFile.blocks[i].fileOffset);
+			index[2 + i * 2] = LittleLong(demoFile.blocks[i].streamOffset);
+		}
+		index[indexLength - 2] = LittleLong(demoFile.nextFile + sizeof(end));
+		index[indexLength - 1] = LittleLong(DEMO_INDEX_MAGIC);
+
+		CL_DemoWriteFile(index, indexLength * sizeof(*index));
+		Z_Free(index);
+	}
+
+	FS_FCloseFile(clc.demofile);
+	clc.demofile = 0;
+	CL_DemoReset();
+}
+
+/*
+====================
+CL_DemoWrittenBytes
+====================
+*/
+int CL_DemoWrittenBytes(void) {
+	return demoFile.bytesWritten;
+}
+
+/*
+====================
+CL_DemoLoadIndex
+
+Reads the block table from the end of the file, if the recording was
+finished
+====================
+*/
+static void CL_DemoLoadIndex(void) {
+	int trailer[2];
+	int i, numBlocks, pair[2];
+
+	if (FS_Seek(clc.demofile, -(int)sizeof(trailer), FS_SEEK_END) < 0 ||
+		FS_Read(trailer, sizeof(trailer), clc.demofile) != sizeof(trailer) ||
+		LittleLong(trailer[1]) != DEMO_INDEX_MAGIC) {
+		return;
+	}
+
+	FS_Seek(clc.demofile, LittleLong(trailer[0]), FS_SEEK_SET);
+	if (FS_Read(&numBlocks, sizeof(numBlocks), clc.demofile) != sizeof(numBlocks)) {
+		return;
+	}
+
+	numBlocks = LittleLong(numBlocks);
+	for (i = 0; i < numBlocks; i++) {
+		if (FS_Read(pair, sizeof(pair), clc.demofile) != sizeof(pair)) {
+			break;
+		}
+		CL_DemoAddBlock(LittleLong(pair[0]), LittleLong(pair[1]));
+	}
+}
+
+/*
+====================
+CL_DemoOpenRead
+
+Looks at what was just opened as clc.demofile, legacy demos are read
+as they are
+====================
+*/
+void CL_DemoOpenRead(void) {
+	int header[DEMO_HEADER_SIZE / 4];
+
+	CL_DemoReset();
+
+	if (FS_Read(header, sizeof(header), clc.demofile) != sizeof(header) || LittleLong(header[0]) != DEMO_MAGIC) {
+		FS_Seek(clc.demofile, 0, FS_SEEK_SET);
+		return;
+	}
+
+	if (LittleLong(header[1]) != DEMO_VERSION || LittleLong(header[2]) > DEMO_BLOCK_SIZE) {
+		Com_Error(ERR_DROP, "CL_DemoOpenRead: unsupported demo version %d", LittleLong(header[1]));
+	}
+
+	demoFile.compressed = qtrue;
+	demoFile.nextFile = sizeof(header);
+
+	CL_DemoLoadIndex();
+	FS_Seek(clc.demofile, demoFile.nextFile, FS_SEEK_SET);
+}
+
+/*
+====================
+CL_DemoReadBlock
+
+Reads the block at nextFile, qfalse at the end of the demo
+====================
+*/
+static qboolean CL_DemoReadBlock(void) {
+	int header[2];
+	int rawLength, length;
+
+	demoFile.blockStream += demoFile.blockLength;
+	demoFile.blockLength = 0;
+	demoFile.blockPos = 0;
+
+	if (FS_Read(header, sizeof(header[0]), clc.demofile) != sizeof(header[0])) {
+		return qfalse;
+	}
+
+	rawLength = LittleLong(header[0]);
+	if (!rawLength) {
+		return qfalse; // end of the blocks
+	}
+
+	if (FS_Read(&header[1], sizeof(header[1]), clc.demofile) != sizeof(header[1])) {
+		return qfalse;
+	}
+
+	length = LittleLong(header[1]);
+	if (rawLength < 0 || rawLength > DEMO_BLOCK_SIZE || length <= 0 || length > rawLength) {
+		Com_Printf("Demo file has a bad block.\n");
+		return qfalse;
+	}
+
+	if (FS_Read(length < rawLength ? demoFile.packed : demoFile.block, length, clc.demofile) != length) {
+		return qfalse;
+	}
+
+	if (length < rawLength && LZ_Decompress(demoFile.packed, length, demoFile.block, rawLength) != rawLength) {
+		Com_Printf("Demo file has a bad block.\n");
+		return qfalse;
+	}
+
+	CL_DemoAddBlock(demoFile.nextFile, demoFile.blockStream);
+
+	demoFile.nextFile += sizeof(header) + length;
+	demoFile.blockLength = rawLength;
+
+	return qtrue;
+}
+
+/*
+====================
+CL_DemoRead
+
+FS_Read on the message stream of the demo
+====================
+*/
+int CL_DemoRead(void *buffer, int len) {
+	byte *p = buffer;
+	int n, read;
+
+	if (!demoFile.compressed) {
+		return FS_Read(buffer, len, clc.demofile);
+	}
+
+	read = 0;
+	while (read < len) {
+		if (demoFile.blockPos == demoFile.blockLength && !CL_DemoReadBlock()) {
+			break;
+		}
+
+		n = MIN(len - read, demoFile.blockLength - demoFile.blockPos);
+		Com_Memcpy(p + read, demoFile.block + demoFile.blockPos, n);
+		demoFile.blockPos += n;
+		read += n;
+	}
+
+	return read;
+}
+
+/*
+====================
+CL_DemoRewind
+
+Goes to an offset in the message stream, forward or back
+====================
+*/
+void CL_DemoRewind(int offset) {
+	int i;
+
+	if (!demoFile.compressed) {
+		FS_Seek(clc.demofile, offset, FS_SEEK_SET);
+		return;
+	}
+
+	// the last known block that starts at or before the offset
+	for (i = demoFile.numBlocks - 1; i > 0 && demoFile.blocks[i].streamOffset > offset; i--) {
+	}
+
+	if (demoFile.numBlocks) {
+		demoFile.nextFile = demoFile.blocks[i].fileOffset;
+		demoFile.blockStream = demoFile.blocks[i].streamOffset;
+	} else {
+		demoFile.nextFile = DEMO_HEADER_SIZE;
+		demoFile.blockStream = 0;
+	}
+	FS_Seek(clc.demofile, demoFile.nextFile, FS_SEEK_SET);
+	demoFile.blockLength = 0;
+	demoFile.blockPos = 0;
+
+	// read on from there, past the blocks that weren't in the table yet
+	while (CL_DemoReadBlock()) {
+		if (offset < demoFile.blockStream + demoFile.blockLength) {
+			demoFile.blockPos = offset - demoFile.blockStream;
+			return;
+		}
+	}
+}
+
+/*
+====================
+CL_DemoClose
+====================
+*/
+void CL_DemoClose(void) {
+	if (clc.demofile) {
+		FS_FCloseFile(clc.demofile);
+		clc.demofile = 0;
+	}
+
+	CL_DemoReset();
+}
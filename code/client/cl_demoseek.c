@@ -0,0 +1,448 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+// cl_demoseek.c -- demo keyframe index and seeking
+
+#include "client.h"
+
+/*
+=============================================================================
+
+When a demo is opened its messages are scanned once, without decoding the
+snapshots, for the time span and the keyframes: messages with a full, non
+delta snapshot.  A keyframe keeps the file offset and the configstrings as
+they are at that point, the snapshot needs nothing else to be decoded.
+
+demo_seek goes back by restarting from the last keyframe before the target,
+and forward by reading messages without rendering, from a keyframe if
+there is one past the current position.  The server commands read on the
+way only update the configstrings, the cgame is restarted at the target.
+
+=============================================================================
+*/
+
+#define DEMO_KEYFRAME_SPACING 30000 // msec
+
+typedef struct demoKeyframe_s {
+	struct demoKeyframe_s *next;
+	int offset; // of the message header
+	int serverTime;
+	int serverCommandSequence;
+	int stringOffsets[MAX_CONFIGSTRINGS];
+	int dataCount;
+	char stringData[1]; // variable sized
+} demoKeyframe_t;
+
+typedef struct {
+	int firstTime, lastTime; // of the snapshots
+	int numKeyframes;
+	demoKeyframe_t *keyframes, *lastKeyframe;
+
+	// scan state
+	gameState_t gameState;
+	int serverCommandSequence;
+	char bigConfigString[BIG_INFO_STRING];
+} demoIndex_t;
+
+static demoIndex_t demoIndex;
+
+/*
+====================
+CL_DemoIndexClear
+====================
+*/
+void CL_DemoIndexClear(void) {
+	demoKeyframe_t *kf, *next;
+
+	for (kf = demoIndex.keyframes; kf; kf = next) {
+		next = kf->next;
+		Z_Free(kf);
+	}
+
+	Com_Memset(&demoIndex, 0, sizeof(demoIndex));
+}
+
+/*
+====================
+CL_DemoIndexCommand
+
+Applies the configstring changes of a server command to the scanned
+gameState, the way CL_GetServerCommand does
+====================
+*/
+static void CL_DemoIndexCommand(const char *s) {
+	const char *cmd;
+	int index;
+
+	Cmd_TokenizeString(s);
+	cmd = Cmd_Argv(0);
+
+	if (!strcmp(cmd, "bcs0")) {
+		Com_sprintf(demoIndex.bigConfigString, BIG_INFO_STRING, "cs %s \"%s", Cmd_Argv(1), Cmd_Argv(2));
+		return;
+	}
+
+	if (!strcmp(cmd, "bcs1") || !strcmp(cmd, "bcs2")) {
+		if (strlen(demoIndex.bigConfigString) + strlen(Cmd_Argv(2)) + 1 >= BIG_INFO_STRING) {
+			return;
+		}
+		Q_strcat(demoIndex.bigConfigString, BIG_INFO_STRING, Cmd_Argv(2));
+		if (cmd[3] == '1') {
+			return;
+		}
+		Q_strcat(demoIndex.bigConfigString, BIG_INFO_STRING, "\"");
+		Cmd_TokenizeString(demoIndex.bigConfigString);
+		cmd = Cmd_Argv(0);
+	}
+
+	if (strcmp(cmd, "cs")) {
+		return;
+	}
+
+	index = atoi(Cmd_Argv(1));
+	if (index < 0 || index >= MAX_CONFIGSTRINGS) {
+		return;
+	}
+	CL_SetGameStateString(&demoIndex.gameState, index, Cmd_ArgsFrom(2));
+}
+
+/*
+====================
+CL_DemoIndexGameState
+
+Reads the configstrings of a gamestate, the baselines after them aren't
+needed
+====================
+*/
+static void CL_DemoIndexGameState(msg_t *msg) {
+	gameState_t *gs;
+	const char *s;
+	int i, len;
+
+	gs = &demoIndex.gameState;
+	Com_Memset(gs, 0, sizeof(*gs));
+	gs->dataCount = 1;
+
+	demoIndex.serverCommandSequence = MSG_ReadLong(msg);
+
+	while (MSG_ReadByte(msg) == svc_configstring) {
+		i = MSG_ReadShort(msg);
+		s = MSG_ReadBigString(msg);
+		if (i < 0 || i >= MAX_CONFIGSTRINGS) {
+			break;
+		}
+
+		len = strlen(s);
+		if (len + 1 + gs->dataCount > MAX_GAMESTATE_CHARS) {
+			break;
+		}
+		gs->stringOffsets[i] = gs->dataCount;
+		Com_Memcpy(gs->stringData + gs->dataCount, s, len + 1);
+		gs->dataCount += len + 1;
+	}
+}
+
+/*
+====================
+CL_DemoIndexKeyframe
+====================
+*/
+static void CL_DemoIndexKeyframe(int offset, int serverTime) {
+	demoKeyframe_t *kf;
+	const gameState_t *gs;
+
+	gs = &demoIndex.gameState;
+
+	kf = Z_Malloc(sizeof(*kf) + gs->dataCount);
+	kf->offset = offset;
+	kf->serverTime = serverTime;
+	kf->serverCommandSequence = demoIndex.serverCommandSequence;
+	Com_Memcpy(kf->stringOffsets, gs->stringOffsets, sizeof(kf->stringOffsets));
+	kf->dataCount = gs->dataCount;
+	Com_Memcpy(kf->stringData, gs->stringData, gs->dataCount);
+
+	if (demoIndex.lastKeyframe) {
+		demoIndex.lastKeyframe->next = kf;
+	} else {
+		demoIndex.keyframes = kf;
+	}
+	demoIndex.lastKeyframe = kf;
+	demoIndex.numKeyframes++;
+}
+
+/*
+====================
+CL_DemoIndexMessage
+
+Reads the server commands and the snapshot header of a message
+====================
+*/
+static void CL_DemoIndexMessage(msg_t *msg, int offset) {
+	const char *s;
+	int cmd, seq, count, i;
+	int serverTime, deltaNum;
+
+	MSG_Bitstream(msg);
+	MSG_ReadLong(msg); // reliable acknowledge
+
+	while (msg->readcount <= msg->cursize) {
+		cmd = MSG_ReadByte(msg);
+
+		if (cmd == svc_nop) {
+			continue;
+		}
+
+		if (cmd == svc_gamestate) {
+			CL_DemoIndexGameState(msg);
+			return;
+		}
+
+		if (cmd == svc_serverCommand) {
+			seq = MSG_ReadLong(msg);
+			s = MSG_ReadString(msg);
+			if (seq > demoIndex.serverCommandSequence) {
+				demoIndex.serverCommandSequence = seq;
+				CL_DemoIndexCommand(s);
+			}
+			continue;
+		}
+
+		if (cmd == svc_serverCommands) {
+			seq = MSG_ReadLong(msg);
+			count = MSG_ReadByte(msg);
+			for (i = 0; i < count; i++, seq++) {
+				s = MSG_ReadServerCommand(msg);
+				if (!s) {
+					return;
+				}
+				if (seq > demoIndex.serverCommandSequence) {
+					demoIndex.serverCommandSequence = seq;
+					CL_DemoIndexCommand(s);
+				}
+			}
+			continue;
+		}
+
+		if (cmd == svc_snapshot) {
+			serverTime = MSG_ReadLong(msg);
+			deltaNum = MSG_ReadByte(msg);
+
+			if (!demoIndex.firstTime) {
+				demoIndex.firstTime = serverTime;
+			}
+			demoIndex.lastTime = serverTime;
+
+			if (!deltaNum &&
+				(!demoIndex.lastKeyframe || serverTime - demoIndex.lastKeyframe->serverTime >= DEMO_KEYFRAME_SPACING)) {
+				CL_DemoIndexKeyframe(offset, serverTime);
+			}
+		}
+
+		// anything after the snapshot needs the delta state
+		return;
+	}
+}
+
+/*
+====================
+CL_DemoIndexBuild
+
+Scans the demo file that was just opened
+====================
+*/
+void CL_DemoIndexBuild(void) {
+	msg_t buf;
+	byte bufData[MAX_MSGLEN];
+	int header[2];
+	int offset, start;
+
+	CL_DemoIndexClear();
+
+	start = Sys_Milliseconds();
+	offset = 0;
+
+	while (1) {
+		if (CL_DemoRead(header, sizeof(header)) != sizeof(header)) {
+			break;
+		}
+
+		MSG_Init(&buf, bufData, sizeof(bufData));
+		buf.cursize = LittleLong(header[1]);
+		if (buf.cursize < 0 || buf.cursize > buf.maxsize) {
+			break;
+		}
+		if (CL_DemoRead(buf.data, buf.cursize) != buf.cursize) {
+			break;
+		}
+
+		CL_DemoIndexMessage(&buf, offset);
+		offset += sizeof(header) + buf.cursize;
+	}
+
+	CL_DemoRewind(0);
+
+	Com_Printf("Demo index: %d:%02d long, %d keyframes, %d msec\n", (demoIndex.lastTime - demoIndex.firstTime) / 60000,
+			   (demoIndex.lastTime - demoIndex.firstTime) / 1000 % 60, demoIndex.numKeyframes,
+			   Sys_Milliseconds() - start);
+}
+
+/*
+====================
+CL_DemoRestoreKeyframe
+====================
+*/
+static void CL_DemoRestoreKeyframe(const demoKeyframe_t *kf) {
+	int i;
+
+	CL_DemoRewind(kf->offset);
+
+	Com_Memcpy(cl.gameState.stringOffsets, kf->stringOffsets, sizeof(cl.gameState.stringOffsets));
+	Com_Memcpy(cl.gameState.stringData, kf->stringData, kf->dataCount);
+	cl.gameState.dataCount = kf->dataCount;
+	CL_SystemInfoChanged();
+
+	// the commands of the keyframe message are already in the configstrings
+	clc.serverCommandSequence = kf->serverCommandSequence;
+	clc.lastExecutedServerCommand = kf->serverCommandSequence;
+
+	// nothing before the keyframe can be delta'd from
+	for (i = 0; i < PACKET_BACKUP; i++) {
+		cl.snapshots[i].valid = qfalse;
+	}
+	Com_Memset(&cl.snap, 0, sizeof(cl.snap));
+	cl.oldFrameServerTime = 0;
+}
+
+/*
+====================
+CL_DemoSeekCommands
+
+Runs the server commands of the messages read while seeking, for the
+configstrings they change
+====================
+*/
+static void CL_DemoSeekCommands(void) {
+	int i;
+
+	i = clc.lastExecutedServerCommand + 1;
+	if (i <= clc.serverCommandSequence - MAX_PACKED_RELIABLE_COMMANDS) {
+		i = clc.serverCommandSequence - MAX_PACKED_RELIABLE_COMMANDS + 1;
+	}
+
+	for (; i <= clc.serverCommandSequence; i++) {
+		CL_GetServerCommand(i);
+	}
+}
+
+/*
+====================
+CL_DemoSeek
+====================
+*/
+static void CL_DemoSeek(int target) {
+	const demoKeyframe_t *kf, *best;
+	int start;
+
+	if (target < demoIndex.firstTime) {
+		target = demoIndex.firstTime;
+	}
+
+	// the last keyframe at or before the target
+	best = NULL;
+	for (kf = demoIndex.keyframes; kf && kf->serverTime <= target; kf = kf->next) {
+		best = kf;
+	}
+
+	if (target < cl.snap.serverTime) {
+		if (!best) {
+			Com_Printf("No keyframe to go back to.\n");
+			return;
+		}
+		CL_DemoRestoreKeyframe(best);
+	} else if (best && best->serverTime > cl.snap.serverTime) {
+		CL_DemoRestoreKeyframe(best);
+	}
+
+	start = Sys_Milliseconds();
+
+	// read up to the target without rendering
+	S_StopAllSounds();
+	while (!cl.snap.valid || cl.snap.serverTime < target) {
+		CL_ReadDemoMessage();
+		if (!clc.demoplaying) {
+			return; // end of the demo
+		}
+		CL_DemoSeekCommands();
+	}
+
+	// start the cgame over on the new snapshot, like a demo start
+	CL_RestartCGame();
+	cl.newSnapshots = qtrue;
+	clc.firstDemoFrameSkipped = qfalse;
+
+	Com_Printf("Seek to %d:%02d took %d msec\n", (cl.snap.serverTime - demoIndex.firstTime) / 60000,
+			   (cl.snap.serverTime - demoIndex.firstTime) / 1000 % 60, Sys_Milliseconds() - start);
+}
+
+/*
+====================
+CL_DemoSeek_f
+
+demo_seek [+|-]<seconds or minutes:seconds>
+====================
+*/
+void CL_DemoSeek_f(void) {
+	const char *arg, *colon;
+	int msec, sign;
+
+	if (Cmd_Argc() != 2) {
+		Com_Printf("usage: demo_seek [+|-]<seconds or minutes:seconds>\n");
+		return;
+	}
+
+	if (!clc.demoplaying || clc.state != CA_ACTIVE) {
+		Com_Printf("Not playing a demo.\n");
+		return;
+	}
+
+	arg = Cmd_Argv(1);
+	sign = 0;
+	if (*arg == '+') {
+		sign = 1;
+		arg++;
+	} else if (*arg == '-') {
+		sign = -1;
+		arg++;
+	}
+
+	colon = strchr(arg, ':');
+	if (colon) {
+		msec = (atoi(arg) * 60 + atoi(colon + 1)) * 1000;
+	} else {
+		msec = (int)(atof(arg) * 1000);
+	}
+
+	if (sign) {
+		CL_DemoSeek(cl.snap.serverTime + sign * msec);
+	} else {
+		CL_DemoSeek(demoIndex.firstTime + msec);
+	}
+}
@@ -679,7 +679,8 @@ static usercmd_t CL_CreateCmd(void) {
 	// get basic movement from keyboard
 	CL_KeyMove(&cmd);
 
-	// get basic movement from mouse
+	// get basic movement from mouse, including the motion since IN_Frame
+	IN_SampleMouse();
 	CL_MouseMove(&cmd);
 
 	// get basic movement from joystick
@@ -792,6 +793,22 @@ qboolean CL_ReadyToSendPacket(void) {
 	} else if (cl_maxpackets->integer > 125) {
 		Cvar_Set("cl_maxpackets", "125");
 	}
+
+	if (cl_packetPacing->integer) {
+		float interval = 1000.0f / cl_maxpackets->integer;
+
+		// keep the phase so 1000 / cl_maxpackets doesn't round down and
+		// frames don't alternate between early and late packets
+		if (cls.realtime < clc.nextPacketTime) {
+			return qfalse;
+		}
+		clc.nextPacketTime += interval;
+		if (clc.nextPacketTime < cls.realtime || clc.nextPacketTime > cls.realtime + interval) {
+			clc.nextPacketTime = cls.realtime + interval;
+		}
+		return qtrue;
+	}
+
 	oldPacketNum = (clc.netchan.outgoingSequence - 1) & PACKET_MASK;
 	delta = cls.realtime - cl.outPackets[oldPacketNum].p_realtime;
 	if (delta < 1000 / cl_maxpackets->integer) {
@@ -945,7 +962,7 @@ void CL_WritePacket(void) {
 		// also use the message acknowledge
 		key ^= clc.serverMessageSequence;
 		// also use the last acknowledged server command in the key
-		key ^= MSG_HashKey(clc.serverCommands[clc.serverCommandSequence & (MAX_RELIABLE_COMMANDS - 1)], 32);
+		key ^= MSG_HashKey(clc.serverCommands[clc.serverCommandSequence & (MAX_PACKED_RELIABLE_COMMANDS - 1)], 32);
 
 		// write all the commands, including the predicted command
 		for (i = 0; i < count; i++) {
@@ -74,9 +74,18 @@ cvar_t *cl_shownet;
 cvar_t *cl_showSend;
 cvar_t *cl_timedemo;
 cvar_t *cl_timedemoLog;
+cvar_t *cl_timedemoRuns;
+cvar_t *cl_timedemoWarmup;
+cvar_t *cl_timedemoReport;
 cvar_t *cl_autoRecordDemo;
+cvar_t *cl_demoCompress;
 cvar_t *cl_aviFrameRate;
 cvar_t *cl_aviMotionJpeg;
+cvar_t *cl_aviPipe;
+cvar_t *cl_aviQueueFrames;
+cvar_t *cl_pingRate;
+cvar_t *cl_packetPacing;
+cvar_t *cl_showLatency;
 cvar_t *cl_forceavidemo;
 
 cvar_t *cl_freelook;
@@ -116,6 +125,8 @@ cvar_t *cl_serverStatusResendTime;
 
 cvar_t *cl_lanForcePackets;
 
+cvar_t *cl_netCompression;
+
 cvar_t *cl_guidServerUniq;
 
 cvar_t *cl_consoleKeys;
@@ -138,6 +149,8 @@ static void *rendererLib = NULL;
 #endif
 
 static ping_t cl_pinglist[MAX_PINGREQUESTS];
+static float cl_pingBudget; // pings cl_pingRate allows to send right now
+static int cl_pingBudgetTime;
 
 typedef struct serverStatus_s {
 	char string[BIG_INFO_STRING];
@@ -486,19 +499,19 @@ static void CL_CaptureVoip(void) {
 				sampbuffer[i] = (int16_t)((flsamp)*audioMult);
 			}
 
-			// encode raw audio samples into Opus data...
-			bytes = opus_encode(clc.opusEncoder, sampbuffer, samples, (unsigned char *)clc.voipOutgoingData,
-								sizeof(clc.voipOutgoingData));
-			if (bytes <= 0) {
-				Com_DPrintf("VoIP: Error encoding %d samples\n", samples);
-				bytes = 0;
-			}
-
 			clc.voipPower = (voipPower / (32768.0f * 32768.0f * ((float)samples))) * 100.0f;
 
 			if ((useVad) && (clc.voipPower < cl_voipVADThreshold->value)) {
 				CL_VoipNewGeneration(); // no "talk" for at least 1/4 second.
 			} else {
+				// encode raw audio samples into Opus data...
+				bytes = opus_encode(clc.opusEncoder, sampbuffer, samples, (unsigned char *)clc.voipOutgoingData,
+									sizeof(clc.voipOutgoingData));
+				if (bytes <= 0) {
+					Com_DPrintf("VoIP: Error encoding %d samples\n", samples);
+					bytes = 0;
+				}
+
 				clc.voipOutgoingDataSize = bytes;
 				clc.voipOutgoingDataFrames = voipFrames;
 
@@ -578,17 +591,25 @@ Dumps the current net message, prefixed by the length
 */
 
 void CL_WriteDemoMessage(msg_t *msg, int headerBytes) {
-	int len, swlen;
-
-	// write the packet sequence
-	len = clc.serverMessageSequence;
-	swlen = LittleLong(len);
-	FS_Write(&swlen, 4, clc.demofile);
-	// skip the packet sequencing information
-	len = msg->cursize - headerBytes;
-	swlen = LittleLong(len);
-	FS_Write(&swlen, 4, clc.demofile);
-	FS_Write(msg->data + headerBytes, len, clc.demofile);
+	int header[2];
+
+	// the packet sequence, and the length without the sequencing information
+	header[0] = LittleLong(clc.serverMessageSequence);
+	header[1] = LittleLong(msg->cursize - headerBytes);
+	CL_DemoWrite(header, sizeof(header));
+	CL_DemoWrite(msg->data + headerBytes, msg->cursize - headerBytes);
+}
+
+/*
+====================
+CL_UpdateHuffTableInfo
+
+Tells the server which alternate huffman table we have, demos only
+hold messages coded with the default one
+====================
+*/
+static void CL_UpdateHuffTableInfo(void) {
+	Cvar_Set2("nethuff", va("%i", clc.demorecording ? 0 : MSG_HuffTableVersion()), qtrue);
 }
 
 /*
@@ -608,12 +629,12 @@ void CL_StopRecord_f(void) {
 
 	// finish up
 	len = -1;
-	FS_Write(&len, 4, clc.demofile);
-	FS_Write(&len, 4, clc.demofile);
-	FS_FCloseFile(clc.demofile);
-	clc.demofile = 0;
+	CL_DemoWrite(&len, 4);
+	CL_DemoWrite(&len, 4);
+	CL_DemoCloseWrite();
 	clc.demorecording = qfalse;
 	clc.spDemoRecording = qfalse;
+	CL_UpdateHuffTableInfo();
 	Com_Printf("Stopped demo.\n");
 }
 
@@ -701,8 +722,7 @@ void CL_Record_f(void) {
 	// open the demo file
 
 	Com_Printf("recording to %s.\n", name);
-	clc.demofile = FS_FOpenFileWrite(name);
-	if (!clc.demofile) {
+	if (!CL_DemoOpenWrite(name)) {
 		Com_Printf("ERROR: couldn't open.\n");
 		return;
 	}
@@ -717,6 +737,7 @@ void CL_Record_f(void) {
 
 	// don't start saving messages until a non-delta compressed message is received
 	clc.demowaiting = qtrue;
+	CL_UpdateHuffTableInfo();
 
 	// write out the gamestate message
 	MSG_Init(&buf, bufData, sizeof(bufData));
@@ -764,11 +785,11 @@ void CL_Record_f(void) {
 
 	// write it to the demo file
 	len = LittleLong(clc.serverMessageSequence - 1);
-	FS_Write(&len, 4, clc.demofile);
+	CL_DemoWrite(&len, 4);
 
 	len = LittleLong(buf.cursize);
-	FS_Write(&len, 4, clc.demofile);
-	FS_Write(buf.data, buf.cursize, clc.demofile);
+	CL_DemoWrite(&len, 4);
+	CL_DemoWrite(buf.data, buf.cursize);
 
 	// the rest of the demo file will be copied from net messages
 }
@@ -818,6 +839,7 @@ CL_DemoCompleted
 */
 void CL_DemoCompleted(void) {
 	char buffer[MAX_STRING_CHARS];
+	qboolean replay = qfalse;
 
 	if (cl_timedemo && cl_timedemo->integer) {
 		int time;
@@ -856,10 +878,14 @@ void CL_DemoCompleted(void) {
 				}
 			}
 		}
+
+		replay = CL_TimeDemoFinish();
 	}
 
 	CL_Disconnect(qtrue);
-	CL_NextDemo();
+	if (!replay && !CL_VideoBatchNext()) {
+		CL_NextDemo();
+	}
 }
 
 /*
@@ -879,7 +905,7 @@ void CL_ReadDemoMessage(void) {
 	}
 
 	// get the sequence number
-	r = FS_Read(&s, 4, clc.demofile);
+	r = CL_DemoRead(&s, 4);
 	if (r != 4) {
 		CL_DemoCompleted();
 		return;
@@ -890,7 +916,7 @@ void CL_ReadDemoMessage(void) {
 	MSG_Init(&buf, bufData, sizeof(bufData));
 
 	// get the length
-	r = FS_Read(&buf.cursize, 4, clc.demofile);
+	r = CL_DemoRead(&buf.cursize, 4);
 	if (r != 4) {
 		CL_DemoCompleted();
 		return;
@@ -903,7 +929,7 @@ void CL_ReadDemoMessage(void) {
 	if (buf.cursize > buf.maxsize) {
 		Com_Error(ERR_DROP, "CL_ReadDemoMessage: demoMsglen > MAX_MSGLEN");
 	}
-	r = FS_Read(buf.data, buf.cursize, clc.demofile);
+	r = CL_DemoRead(buf.data, buf.cursize);
 	if (r != buf.cursize) {
 		Com_Printf("Demo file was truncated.\n");
 		CL_DemoCompleted();
@@ -1031,6 +1057,9 @@ void CL_PlayDemo_f(void) {
 	}
 	Q_strncpyz(clc.demoName, arg, sizeof(clc.demoName));
 
+	CL_DemoOpenRead();
+	CL_DemoIndexBuild();
+
 	Con_Close();
 
 	clc.state = CA_CONNECTED;
@@ -1274,6 +1303,9 @@ void CL_Disconnect(qboolean showMainMenu) {
 	}
 	*clc.downloadTempName = *clc.downloadName = 0;
 	Cvar_Set("cl_downloadName", "");
+#ifdef USE_CURL
+	CL_cURL_Cleanup();
+#endif
 
 #ifdef USE_MUMBLE
 	if (cl_useMumble->integer && mumble_islinked()) {
@@ -1294,6 +1326,7 @@ void CL_Disconnect(qboolean showMainMenu) {
 
 	if (clc.voipCodecInitialized) {
 		int i;
+		CL_StopVoipDecoder();
 		opus_encoder_destroy(clc.opusEncoder);
 		for (i = 0; i < MAX_CLIENTS; i++) {
 			opus_decoder_destroy(clc.opusDecoder[i]);
@@ -1303,10 +1336,8 @@ void CL_Disconnect(qboolean showMainMenu) {
 	Cmd_RemoveCommand("voip");
 #endif
 
-	if (clc.demofile) {
-		FS_FCloseFile(clc.demofile);
-		clc.demofile = 0;
-	}
+	CL_DemoClose();
+	CL_DemoIndexClear();
 
 	if (uivm && showMainMenu) {
 		VM_Call(uivm, UI_SET_ACTIVE_MENU, UIMENU_NONE);
@@ -1998,6 +2029,11 @@ void CL_NextDownload(void) {
 		remoteName = s;
 
 		if ((s = strchr(s, '@')) == NULL) {
+			*clc.downloadList = 0;
+#ifdef USE_CURL
+			if (CL_cURL_Active())
+				return;
+#endif
 			CL_DownloadsComplete();
 			return;
 		}
@@ -2053,6 +2089,12 @@ void CL_NextDownload(void) {
 		return;
 	}
 
+#ifdef USE_CURL
+	// the other transfers call back in when they finish
+	if (CL_cURL_Active())
+		return;
+#endif
+
 	CL_DownloadsComplete();
 }
 
@@ -2147,6 +2189,9 @@ void CL_CheckForResend(void) {
 		Info_SetValueForKey(info, "protocol", va("%i", com_protocol->integer));
 		Info_SetValueForKey(info, "qport", va("%i", port));
 		Info_SetValueForKey(info, "challenge", va("%i", clc.challenge));
+		if (cl_netCompression->integer) {
+			Info_SetValueForKey(info, "netcomp", va("%i", NETCOMP_VERSION));
+		}
 
 		Com_sprintf(data, sizeof(data), "connect \"%s\"", info);
 		NET_OutOfBandData(NS_CLIENT, clc.serverAddress, (byte *)data, strlen(data));
@@ -2424,6 +2469,12 @@ void CL_ConnectionlessPacket(netadr_t from, msg_t *msg) {
 
 		Netchan_Setup(NS_CLIENT, &clc.netchan, from, Cvar_VariableValue("net_qport"), clc.challenge, qfalse);
 
+		// servers that accepted payload compression name the version
+		clc.netchan.compression = MIN(atoi(Cmd_Argv(2)), NETCOMP_VERSION);
+		if (clc.netchan.compression < 0) {
+			clc.netchan.compression = 0;
+		}
+
 		clc.state = CA_CONNECTED;
 		clc.lastPacketSentTime = -9999; // send first packet immediately
 		return;
@@ -2544,7 +2595,18 @@ void CL_PacketEvent(netadr_t from, msg_t *msg) {
 	// after we have parsed the frame
 	//
 	if (clc.demorecording && !clc.demowaiting) {
-		CL_WriteDemoMessage(msg, headerBytes);
+		if (msg->raw) {
+			// demos only hold huffman coded messages, a new raw gamestate
+			// can't be stored
+			Com_Printf("Received an uncompressed gamestate while recording.\n");
+			CL_StopRecord_f();
+		} else if (msg->huffTable != MSG_HUFF_DEFAULT) {
+			// the server hasn't seen the nethuff change yet, wait for
+			// a default coded non-delta snapshot
+			clc.demowaiting = qtrue;
+		} else {
+			CL_WriteDemoMessage(msg, headerBytes);
+		}
 	}
 }
 
@@ -2610,6 +2672,43 @@ void CL_CheckUserinfo(void) {
 	}
 }
 
+/*
+==================
+CL_ShowLatency
+
+Input sample to present is measured to the return from SCR_UpdateScreen,
+so it includes the swap but not the display's own latency.
+==================
+*/
+static void CL_ShowLatency(void) {
+	static int64_t start, total, worst, held;
+	static int frames;
+	int64_t now, latency;
+
+	now = Sys_Microseconds();
+	latency = now - com_inputSampleUsec;
+
+	if (!frames) {
+		start = now;
+		total = worst = held = 0;
+	}
+
+	frames++;
+	total += latency;
+	held += com_latencyWaitUsec;
+	worst = MAX(worst, latency);
+
+	if (now - start < 1000000) {
+		return;
+	}
+
+	Com_Printf("latency: %.2f ms avg, %.2f ms max, %.2f ms held back, %.1f fps\n",
+			   total / (frames * 1000.0), worst / 1000.0, held / (frames * 1000.0),
+			   frames * 1000000.0 / (now - start));
+
+	frames = 0;
+}
+
 /*
 ==================
 CL_Frame
@@ -2721,14 +2820,32 @@ void CL_Frame(int msec) {
 	// resend a connection request if necessary
 	CL_CheckForResend();
 
+	// send pings held back by cl_pingRate
+	CL_SendPings();
+
 	// decide on the serverTime to render
 	CL_SetCGameTime();
 
 	// update the screen
 	SCR_UpdateScreen();
 
+	if (cl_showLatency->integer) {
+		CL_ShowLatency();
+	}
+
+#ifdef USE_VOIP
+	CL_PlayDecodedVoip();
+#endif
+
 	// update audio
-	S_Update();
+	if (CL_TimeDemoMeasuring()) {
+		int64_t start = Sys_Microseconds();
+
+		S_Update();
+		CL_TimeDemoAddTime(TD_SOUND, Sys_Microseconds() - start);
+	} else {
+		S_Update();
+	}
 
 #ifdef USE_VOIP
 	CL_CaptureVoip();
@@ -2866,6 +2983,31 @@ void *CL_RefMalloc(int size) {
 	return Z_TagMalloc(size, TAG_RENDERER);
 }
 
+/*
+============
+CL_RefHunkAlloc
+
+Charges the renderer's hunk allocations to it
+============
+*/
+#ifdef HUNK_DEBUG
+static void *CL_RefHunkAllocDebug(int size, ha_pref preference, char *label, char *file, int line) {
+	memOwner_t owner = Com_SetMemOwner(MEMOWNER_RENDERER);
+	void *buf = Hunk_AllocDebug(size, preference, label, file, line);
+
+	Com_SetMemOwner(owner);
+	return buf;
+}
+#else
+static void *CL_RefHunkAlloc(int size, ha_pref preference) {
+	memOwner_t owner = Com_SetMemOwner(MEMOWNER_RENDERER);
+	void *buf = Hunk_Alloc(size, preference);
+
+	Com_SetMemOwner(owner);
+	return buf;
+}
+#endif
+
 int CL_ScaledMilliseconds(void) {
 	return Sys_Milliseconds() * com_timescale->value;
 }
@@ -2917,12 +3059,15 @@ void CL_InitRef(void) {
 	ri.Printf = CL_RefPrintf;
 	ri.Error = Com_Error;
 	ri.Milliseconds = CL_ScaledMilliseconds;
+	ri.ProfileBegin = Com_ProfileBegin;
+	ri.ProfileEnd = Com_ProfileEnd;
+	ri.ProfileCounter = Com_ProfileCounter;
 	ri.Malloc = CL_RefMalloc;
 	ri.Free = Z_Free;
 #ifdef HUNK_DEBUG
-	ri.Hunk_AllocDebug = Hunk_AllocDebug;
+	ri.Hunk_AllocDebug = CL_RefHunkAllocDebug;
 #else
-	ri.Hunk_Alloc = Hunk_Alloc;
+	ri.Hunk_Alloc = CL_RefHunkAlloc;
 #endif
 	ri.Hunk_AllocateTempMemory = Hunk_AllocateTempMemory;
 	ri.Hunk_FreeTempMemory = Hunk_FreeTempMemory;
@@ -2937,6 +3082,7 @@ void CL_InitRef(void) {
 	ri.FS_ListFiles = FS_ListFiles;
 	ri.FS_FileIsInPAK = FS_FileIsInPAK;
 	ri.FS_FileExists = FS_FileExists;
+	ri.FS_Prefetch = FS_Prefetch;
 	ri.Cvar_Get = Cvar_Get;
 	ri.Cvar_Set = Cvar_Set;
 	ri.Cvar_SetValue = Cvar_SetValue;
@@ -2963,6 +3109,8 @@ void CL_InitRef(void) {
 	ri.Sys_GLimpInit = Sys_GLimpInit;
 	ri.Sys_LowPhysicalMemory = Sys_LowPhysicalMemory;
 
+	ri.RunJobs = Com_RunJobs;
+
 	ret = GetRefAPI(REF_API_VERSION, &ri);
 
 #if defined __USEA3D && defined __A3D_GEOM
@@ -3058,6 +3206,122 @@ void CL_StopVideo_f(void) {
 	CL_CloseAVI();
 }
 
+/*
+=================================================================================
+
+VIDEO BATCH
+
+video_batch renders a playlist of demos to videos, one after the other.
+Each line of the playlist is a demo, optionally followed by the name of the
+video, which is otherwise the name of the demo.
+
+=================================================================================
+*/
+
+static struct {
+	char *playlist; // NULL while no batch runs
+	const char *parse;
+	int numStarted;
+	int startTime;
+	qboolean quit;
+} clVideoBatch;
+
+/*
+===============
+CL_StopVideoBatch
+===============
+*/
+static void CL_StopVideoBatch(void) {
+	if (clVideoBatch.playlist)
+		Z_Free(clVideoBatch.playlist);
+	Com_Memset(&clVideoBatch, 0, sizeof(clVideoBatch));
+}
+
+/*
+===============
+CL_VideoBatchNext
+
+Starts the next demo of the batch, returns qfalse when no batch runs
+===============
+*/
+qboolean CL_VideoBatchNext(void) {
+	char demo[MAX_QPATH];
+	char name[MAX_QPATH];
+	const char *token;
+	qboolean quit;
+
+	if (!clVideoBatch.playlist)
+		return qfalse;
+
+	token = COM_ParseExt(&clVideoBatch.parse, qtrue);
+	if (!token[0]) {
+		Com_Printf("video_batch: %d demos in %.1f seconds\n", clVideoBatch.numStarted,
+				   (Sys_Milliseconds() - clVideoBatch.startTime) / 1000.0);
+		quit = clVideoBatch.quit;
+		CL_StopVideoBatch();
+		if (quit)
+			Cbuf_AddText("quit\n");
+		return qtrue;
+	}
+	Q_strncpyz(demo, token, sizeof(demo));
+
+	token = COM_ParseExt(&clVideoBatch.parse, qfalse);
+	if (token[0])
+		Q_strncpyz(name, token, sizeof(name));
+	else
+		COM_StripExtension(COM_SkipPath(demo), name, sizeof(name));
+	SkipRestOfLine(&clVideoBatch.parse);
+
+	clVideoBatch.numStarted++;
+	Com_Printf("video_batch: %s -> videos/%s\n", demo, name);
+	Cbuf_AddText(va("demo \"%s\"\nvideo \"%s\"\n", demo, name));
+	return qtrue;
+}
+
+/*
+===============
+CL_VideoBatch_f
+
+video_batch <playlist> [quit]
+video_batch stop
+===============
+*/
+void CL_VideoBatch_f(void) {
+	char *text;
+	int len;
+
+	if (Cmd_Argc() < 2) {
+		Com_Printf("usage: video_batch <playlist> [quit]\n");
+		Com_Printf("       video_batch stop\n");
+		return;
+	}
+
+	if (!Q_stricmp(Cmd_Argv(1), "stop")) {
+		if (clVideoBatch.playlist)
+			Com_Printf("video_batch: stopped after %d demos\n", clVideoBatch.numStarted);
+		CL_StopVideoBatch();
+		return;
+	}
+
+	len = FS_ReadFile(Cmd_Argv(1), (void **)&text);
+	if (len < 0) {
+		Com_Printf(S_COLOR_RED "ERROR: couldn't read %s\n", Cmd_Argv(1));
+		return;
+	}
+
+	CL_StopVideoBatch();
+	clVideoBatch.playlist = Z_Malloc(len + 1);
+	Com_Memcpy(clVideoBatch.playlist, text, len);
+	clVideoBatch.playlist[len] = '\0';
+	FS_FreeFile(text);
+
+	clVideoBatch.parse = clVideoBatch.playlist;
+	clVideoBatch.startTime = Sys_Milliseconds();
+	clVideoBatch.quit = (Cmd_Argc() > 2 && !Q_stricmp(Cmd_Argv(2), "quit")) ? qtrue : qfalse;
+
+	CL_VideoBatchNext();
+}
+
 /*
 ===============
 CL_GenerateQKey
@@ -3184,9 +3448,16 @@ void CL_Init(void) {
 
 	cl_timedemo = Cvar_Get("timedemo", "0", 0);
 	cl_timedemoLog = Cvar_Get("cl_timedemoLog", "", CVAR_ARCHIVE);
+	cl_timedemoRuns = Cvar_Get("cl_timedemoRuns", "1", CVAR_ARCHIVE);
+	cl_timedemoWarmup = Cvar_Get("cl_timedemoWarmup", "0", CVAR_ARCHIVE);
+	cl_timedemoReport = Cvar_Get("cl_timedemoReport", "", CVAR_ARCHIVE);
 	cl_autoRecordDemo = Cvar_Get("cl_autoRecordDemo", "0", CVAR_ARCHIVE);
+	cl_demoCompress = Cvar_Get("cl_demoCompress", "0", CVAR_ARCHIVE);
 	cl_aviFrameRate = Cvar_Get("cl_aviFrameRate", "25", CVAR_ARCHIVE);
 	cl_aviMotionJpeg = Cvar_Get("cl_aviMotionJpeg", "1", CVAR_ARCHIVE);
+	cl_aviPipe = Cvar_Get("cl_aviPipe", "", CVAR_ARCHIVE);
+	cl_aviQueueFrames = Cvar_Get("cl_aviQueueFrames", "8", CVAR_ARCHIVE);
+	cl_pingRate = Cvar_Get("cl_pingRate", "200", CVAR_ARCHIVE);
 	cl_forceavidemo = Cvar_Get("cl_forceavidemo", "0", 0);
 
 	rconAddress = Cvar_Get("rconAddress", "", 0);
@@ -3196,6 +3467,11 @@ void CL_Init(void) {
 	cl_anglespeedkey = Cvar_Get("cl_anglespeedkey", "1.5", 0);
 
 	cl_maxpackets = Cvar_Get("cl_maxpackets", "30", CVAR_ARCHIVE);
+	cl_packetPacing = Cvar_Get("cl_packetPacing", "1", CVAR_ARCHIVE);
+	Cvar_SetDescription(cl_packetPacing, "Send packets on an even cl_maxpackets schedule instead of whenever a "
+										 "frame finds the last one old enough");
+	cl_showLatency = Cvar_Get("cl_showLatency", "0", CVAR_TEMP);
+	Cvar_SetDescription(cl_showLatency, "Print input sample to present time once a second");
 	cl_packetdup = Cvar_Get("cl_packetdup", "1", CVAR_ARCHIVE);
 
 	cl_run = Cvar_Get("cl_run", "1", CVAR_ARCHIVE);
@@ -3217,6 +3493,9 @@ void CL_Init(void) {
 #ifdef USE_CURL_DLOPEN
 	cl_cURLLib = Cvar_Get("cl_cURLLib", DEFAULT_CURL_LIB, CVAR_ARCHIVE | CVAR_PROTECTED);
 #endif
+#ifdef USE_CURL
+	cl_cURLTransfers = Cvar_Get("cl_cURLTransfers", "4", CVAR_ARCHIVE);
+#endif
 
 	cl_conXOffset = Cvar_Get("cl_conXOffset", "0", 0);
 #ifdef __APPLE__
@@ -3267,6 +3546,8 @@ void CL_Init(void) {
 
 	cl_lanForcePackets = Cvar_Get("cl_lanForcePackets", "1", CVAR_ARCHIVE);
 
+	cl_netCompression = Cvar_Get("cl_netCompression", "0", CVAR_ARCHIVE);
+
 	cl_guidServerUniq = Cvar_Get("cl_guidServerUniq", "1", CVAR_ARCHIVE);
 
 	// ~ ` ^ as keys and characters
@@ -3323,6 +3604,7 @@ void CL_Init(void) {
 	Cmd_AddCommand("record", CL_Record_f);
 	Cmd_AddCommand("demo", CL_PlayDemo_f);
 	Cmd_SetCommandCompletionFunc("demo", CL_CompleteDemoName);
+	Cmd_AddCommand("demo_seek", CL_DemoSeek_f);
 	Cmd_AddCommand("cinematic", CL_PlayCinematic_f);
 	Cmd_SetCommandCompletionFunc("cinematic", CL_CompleteCinematicName);
 	Cmd_AddCommand("stoprecord", CL_StopRecord_f);
@@ -3340,6 +3622,7 @@ void CL_Init(void) {
 	Cmd_AddCommand("model", CL_SetModel_f);
 	Cmd_AddCommand("video", CL_Video_f);
 	Cmd_AddCommand("stopvideo", CL_StopVideo_f);
+	Cmd_AddCommand("video_batch", CL_VideoBatch_f);
 	if (!com_dedicated->integer) {
 		Cmd_AddCommand("sayto", CL_Sayto_f);
 		Cmd_SetCommandCompletionFunc("sayto", CL_CompletePlayerName);
@@ -3354,6 +3637,8 @@ void CL_Init(void) {
 
 	CL_GenerateQKey();
 	Cvar_Get("cl_guid", "", CVAR_USERINFO | CVAR_ROM);
+	Cvar_Get("nethuff", "0", CVAR_USERINFO | CVAR_ROM);
+	CL_UpdateHuffTableInfo();
 	CL_UpdateGUID(NULL, 0);
 
 	Com_Printf("----- Client Initialization Complete -----\n");
@@ -3396,6 +3681,7 @@ void CL_Shutdown(const char *finalmsg, qboolean disconnect, qboolean quit) {
 	Cmd_RemoveCommand("disconnect");
 	Cmd_RemoveCommand("record");
 	Cmd_RemoveCommand("demo");
+	Cmd_RemoveCommand("demo_seek");
 	Cmd_RemoveCommand("cinematic");
 	Cmd_RemoveCommand("stoprecord");
 	Cmd_RemoveCommand("connect");
@@ -3411,6 +3697,7 @@ void CL_Shutdown(const char *finalmsg, qboolean disconnect, qboolean quit) {
 	Cmd_RemoveCommand("model");
 	Cmd_RemoveCommand("video");
 	Cmd_RemoveCommand("stopvideo");
+	Cmd_RemoveCommand("video_batch");
 
 	CL_ShutdownInput();
 	Con_Shutdown();
@@ -3448,19 +3735,20 @@ static void CL_SetServerInfo(serverInfo_t *server, const char *info, int ping) {
 static void CL_SetServerInfoByAddress(netadr_t from, const char *info, int ping) {
 	int i;
 
-	for (i = 0; i < MAX_OTHER_SERVERS; i++) {
+	// only the used part of the lists, the global one can hold thousands
+	for (i = 0; i < cls.numlocalservers && i < MAX_OTHER_SERVERS; i++) {
 		if (NET_CompareAdr(from, cls.localServers[i].adr)) {
 			CL_SetServerInfo(&cls.localServers[i], info, ping);
 		}
 	}
 
-	for (i = 0; i < MAX_GLOBAL_SERVERS; i++) {
+	for (i = 0; i < cls.numglobalservers && i < MAX_GLOBAL_SERVERS; i++) {
 		if (NET_CompareAdr(from, cls.globalServers[i].adr)) {
 			CL_SetServerInfo(&cls.globalServers[i], info, ping);
 		}
 	}
 
-	for (i = 0; i < MAX_OTHER_SERVERS; i++) {
+	for (i = 0; i < cls.numfavoriteservers && i < MAX_OTHER_SERVERS; i++) {
 		if (NET_CompareAdr(from, cls.favoriteServers[i].adr)) {
 			CL_SetServerInfo(&cls.favoriteServers[i], info, ping);
 		}
@@ -3502,9 +3790,10 @@ void CL_ServerInfoPacket(netadr_t from, msg_t *msg) {
 
 	// iterate servers waiting for ping response
 	for (i = 0; i < MAX_PINGREQUESTS; i++) {
-		if (cl_pinglist[i].adr.port && !cl_pinglist[i].time && NET_CompareAdr(from, cl_pinglist[i].adr)) {
-			// calc ping time
-			cl_pinglist[i].time = Sys_Milliseconds() - cl_pinglist[i].start;
+		if (cl_pinglist[i].adr.port && cl_pinglist[i].sent && !cl_pinglist[i].time &&
+			NET_CompareAdr(from, cl_pinglist[i].adr)) {
+			// calc ping time, 0 would still read as waiting
+			cl_pinglist[i].time = MAX(Sys_Milliseconds() - cl_pinglist[i].start, 1);
 			Com_DPrintf("ping time %dms from %s\n", cl_pinglist[i].time, NET_AdrToString(from));
 
 			// save of info
@@ -3525,7 +3814,7 @@ void CL_ServerInfoPacket(netadr_t from, msg_t *msg) {
 				break;
 			}
 			Info_SetValueForKey(cl_pinglist[i].info, "nettype", va("%d", type));
-			CL_SetServerInfoByAddress(from, infoString, cl_pinglist[i].time);
+			CL_SetServerInfoByAddress(from, cl_pinglist[i].info, cl_pinglist[i].time);
 
 			return;
 		}
@@ -3903,7 +4192,10 @@ void CL_GetPing(int n, char *buf, int buflen, int *pingtime) {
 	Q_strncpyz(buf, str, buflen);
 
 	time = cl_pinglist[n].time;
-	if (!time) {
+	if (!cl_pinglist[n].sent) {
+		// still queued
+		time = 0;
+	} else if (!time) {
 		// check for timeout
 		time = Sys_Milliseconds() - cl_pinglist[n].start;
 		maxPing = Cvar_VariableIntegerValue("cl_maxPing");
@@ -3916,8 +4208,7 @@ void CL_GetPing(int n, char *buf, int buflen, int *pingtime) {
 		}
 	}
 
-	CL_SetServerInfoByAddress(cl_pinglist[n].adr, cl_pinglist[n].info, cl_pinglist[n].time);
-
+	// the server lists already got the result when the response came in
 	*pingtime = time;
 }
 
@@ -3988,7 +4279,7 @@ ping_t *CL_GetFreePing(void) {
 		// find free ping slot
 		if (pingptr->adr.port) {
 			if (!pingptr->time) {
-				if (Sys_Milliseconds() - pingptr->start < 500) {
+				if (!pingptr->sent || Sys_Milliseconds() - pingptr->start < 500) {
 					// still waiting for response
 					continue;
 				}
@@ -4019,6 +4310,60 @@ ping_t *CL_GetFreePing(void) {
 	return (best);
 }
 
+/*
+==================
+CL_SendPings
+
+Sends the queued pings, no faster than cl_pingRate per second so a full
+queue doesn't go out in one burst and get dropped on the way
+==================
+*/
+void CL_SendPings(void) {
+	ping_t *pingptr;
+	int now;
+	int i;
+
+	now = Sys_Milliseconds();
+	if (cl_pingRate->value > 0) {
+		cl_pingBudget += (now - cl_pingBudgetTime) * cl_pingRate->value / 1000.0f;
+		// bursts of at most a tenth of a second
+		cl_pingBudget = MIN(cl_pingBudget, MAX(cl_pingRate->value * 0.1f, 1.0f));
+	}
+	cl_pingBudgetTime = now;
+
+	pingptr = cl_pinglist;
+	for (i = 0; i < MAX_PINGREQUESTS; i++, pingptr++) {
+		if (!pingptr->adr.port || pingptr->sent) {
+			continue;
+		}
+
+		if (cl_pingRate->value > 0) {
+			if (cl_pingBudget < 1.0f) {
+				break;
+			}
+			cl_pingBudget -= 1.0f;
+		}
+
+		pingptr->sent = qtrue;
+		pingptr->start = now;
+		NET_OutOfBandPrint(NS_CLIENT, pingptr->adr, "getinfo xxx");
+	}
+}
+
+/*
+==================
+CL_QueuePing
+==================
+*/
+static void CL_QueuePing(ping_t *pingptr, const netadr_t *to) {
+	memcpy(&pingptr->adr, to, sizeof(netadr_t));
+	pingptr->start = Sys_Milliseconds();
+	pingptr->time = 0;
+	pingptr->sent = qfalse;
+
+	CL_SendPings();
+}
+
 /*
 ==================
 CL_Ping_f
@@ -4059,13 +4404,9 @@ void CL_Ping_f(void) {
 
 	pingptr = CL_GetFreePing();
 
-	memcpy(&pingptr->adr, &to, sizeof(netadr_t));
-	pingptr->start = Sys_Milliseconds();
-	pingptr->time = 0;
-
-	CL_SetServerInfoByAddress(pingptr->adr, NULL, 0);
+	CL_SetServerInfoByAddress(to, NULL, 0);
 
-	NET_OutOfBandPrint(NS_CLIENT, to, "getinfo xxx");
+	CL_QueuePing(pingptr, &to);
 }
 
 /*
@@ -4130,10 +4471,7 @@ qboolean CL_UpdateVisiblePings_f(int source) {
 								break;
 							}
 						}
-						memcpy(&cl_pinglist[j].adr, &server[i].adr, sizeof(netadr_t));
-						cl_pinglist[j].start = Sys_Milliseconds();
-						cl_pinglist[j].time = 0;
-						NET_OutOfBandPrint(NS_CLIENT, cl_pinglist[j].adr, "getinfo xxx");
+						CL_QueuePing(&cl_pinglist[j], &server[i].adr);
 						slots++;
 					}
 				}
@@ -66,5 +66,21 @@ qboolean CL_Netchan_Process(netchan_t *chan, msg_t *msg) {
 	if (!ret)
 		return qfalse;
 
+	if (chan->incomingFlags & NETCHAN_LZ) {
+		static byte unpacked[MAX_MSGLEN];
+		int length;
+
+		length = LZ_Decompress(msg->data + msg->readcount, msg->cursize - msg->readcount, unpacked,
+							   MIN((int)sizeof(unpacked), msg->maxsize - msg->readcount));
+		if (length < 0) {
+			Com_Printf("%s:bad compressed message\n", NET_AdrToString(chan->remoteAddress));
+			return qfalse;
+		}
+		Com_Memcpy(msg->data + msg->readcount, unpacked, length);
+		msg->cursize = msg->readcount + length;
+	}
+	msg->raw = (chan->incomingFlags & NETCHAN_RAW) ? qtrue : qfalse;
+	msg->huffTable = (chan->incomingFlags & NETCHAN_HUFF) ? MSG_HUFF_ALTERNATE : MSG_HUFF_DEFAULT;
+
 	return qtrue;
 }
@@ -28,6 +28,7 @@ char *svc_strings[256] = {
 
 	"svc_nop",		"svc_gamestate", "svc_configstring", "svc_baseline",  "svc_serverCommand",
 	"svc_download", "svc_snapshot",	 "svc_EOF",			 "svc_voipSpeex", "svc_voipOpus",
+	"svc_serverCommands",
 };
 
 void SHOWNET(msg_t *msg, char *s) {
@@ -637,6 +638,227 @@ static void CL_PlayVoip(int sender, int samplecnt, const byte *data, int flags)
 	}
 }
 
+/*
+=================================================================================
+
+VOIP DECODE THREAD
+
+With several people talking the opus decoding adds up, so the received
+packets are queued for a thread that decodes them in order, and the main
+thread plays the decoded samples once a frame.  The thread owns the
+decoders and the incoming sequence numbers, the main thread only parses
+the packets and checks who is muted.
+
+=================================================================================
+*/
+
+#define VOIP_DECODE_QUEUE 32
+
+typedef struct {
+	int sender;
+	int generation;
+	int sequence;
+	int frames;
+	int flags;
+	int packetsize;
+	unsigned char encoded[4000];
+
+	int numSamples; // written by the decoder
+	short decoded[VOIP_MAX_PACKET_SAMPLES * 4]; // !!! FIXME: don't hard code
+} voipPacket_t;
+
+typedef struct {
+	sysThread_t *thread;
+	sysMutex_t *mutex; // guards the counts and quit
+	sysCond_t *wake;   // a packet was queued, or quit is set
+
+	voipPacket_t packets[VOIP_DECODE_QUEUE];
+	int tail;		// the oldest packet, played next
+	int numQueued;	// packets in the ring
+	int numDecoded; // the first ones of them are ready to play
+	qboolean quit;
+} voipDecoder_t;
+
+static voipDecoder_t voipDecoder;
+static voipPacket_t voipSyncPacket; // used when there is no thread
+
+/*
+=====================
+CL_DecodeVoip
+
+Runs on the decode thread, so it mustn't print
+=====================
+*/
+static void CL_DecodeVoip(voipPacket_t *p) {
+	const int sender = p->sender;
+	int numSamples;
+	int seqdiff;
+	int written = 0;
+	int i;
+
+	seqdiff = p->sequence - clc.voipIncomingSequence[sender];
+
+	// This is a new "generation" ... a new recording started, reset the bits.
+	if (p->generation != clc.voipIncomingGeneration[sender]) {
+		opus_decoder_ctl(clc.opusDecoder[sender], OPUS_RESET_STATE);
+		clc.voipIncomingGeneration[sender] = p->generation;
+		seqdiff = 0;
+	} else if (seqdiff < 0) { // we're ahead of the sequence?!
+		// This shouldn't happen unless the packet is corrupted or something.
+		// reset the decoder just in case.
+		opus_decoder_ctl(clc.opusDecoder[sender], OPUS_RESET_STATE);
+		seqdiff = 0;
+	} else if (seqdiff * VOIP_MAX_PACKET_SAMPLES * 2 >= sizeof(p->decoded)) { // dropped more than we can handle?
+		// just start over.
+		opus_decoder_ctl(clc.opusDecoder[sender], OPUS_RESET_STATE);
+		seqdiff = 0;
+	}
+
+	// tell opus that we're missing frames...
+	for (i = 0; i < seqdiff; i++) {
+		assert((written + VOIP_MAX_PACKET_SAMPLES) * 2 < sizeof(p->decoded));
+		numSamples = opus_decode(clc.opusDecoder[sender], NULL, 0, p->decoded + written, VOIP_MAX_PACKET_SAMPLES, 0);
+		if (numSamples > 0)
+			written += numSamples;
+	}
+
+	numSamples = opus_decode(clc.opusDecoder[sender], p->encoded, p->packetsize, p->decoded + written,
+							 ARRAY_LEN(p->decoded) - written, 0);
+	if (numSamples > 0)
+		written += numSamples;
+
+	p->numSamples = written;
+	clc.voipIncomingSequence[sender] = p->sequence + p->frames;
+}
+
+/*
+=====================
+CL_VoipDecodeThread
+=====================
+*/
+static void CL_VoipDecodeThread(void *data) {
+	voipDecoder_t *d = data;
+	voipPacket_t *p;
+
+	Sys_LockMutex(d->mutex);
+	for (;;) {
+		while (d->numDecoded == d->numQueued && !d->quit) {
+			Sys_WaitCond(d->wake, d->mutex);
+		}
+		if (d->quit) {
+			break;
+		}
+		p = &d->packets[(d->tail + d->numDecoded) % VOIP_DECODE_QUEUE];
+
+		// the main thread doesn't touch a packet until it's decoded
+		Sys_UnlockMutex(d->mutex);
+		CL_DecodeVoip(p);
+		Sys_LockMutex(d->mutex);
+
+		d->numDecoded++;
+	}
+	Sys_UnlockMutex(d->mutex);
+}
+
+/*
+=====================
+CL_StartVoipDecoder
+
+Without the thread the packets are decoded as they arrive
+=====================
+*/
+void CL_StartVoipDecoder(void) {
+	voipDecoder_t *d = &voipDecoder;
+
+	if (d->thread) {
+		return;
+	}
+
+	d->tail = d->numQueued = d->numDecoded = 0;
+	d->quit = qfalse;
+	d->mutex = Sys_CreateMutex();
+	d->wake = Sys_CreateCond();
+	if (d->mutex && d->wake) {
+		d->thread = Sys_CreateThread(CL_VoipDecodeThread, d);
+	}
+
+	if (!d->thread) {
+		Com_Printf(S_COLOR_YELLOW "WARNING: failed to start the VoIP decode thread\n");
+		if (d->mutex)
+			Sys_DestroyMutex(d->mutex);
+		if (d->wake)
+			Sys_DestroyCond(d->wake);
+		d->mutex = NULL;
+		d->wake = NULL;
+	}
+}
+
+/*
+=====================
+CL_StopVoipDecoder
+
+Drops what is still queued, called before the opus decoders are destroyed
+=====================
+*/
+void CL_StopVoipDecoder(void) {
+	voipDecoder_t *d = &voipDecoder;
+
+	if (!d->thread) {
+		return;
+	}
+
+	Sys_LockMutex(d->mutex);
+	d->quit = qtrue;
+	Sys_SignalCond(d->wake);
+	Sys_UnlockMutex(d->mutex);
+
+	Sys_JoinThread(d->thread);
+
+	Sys_DestroyMutex(d->mutex);
+	Sys_DestroyCond(d->wake);
+	d->thread = NULL;
+	d->mutex = NULL;
+	d->wake = NULL;
+	d->tail = d->numQueued = d->numDecoded = 0;
+}
+
+/*
+=====================
+CL_PlayDecodedVoip
+
+Plays the packets the thread has decoded, called once a frame
+=====================
+*/
+void CL_PlayDecodedVoip(void) {
+	voipDecoder_t *d = &voipDecoder;
+	voipPacket_t *p;
+	int numDecoded;
+	int i;
+
+	if (!d->thread) {
+		return;
+	}
+
+	Sys_LockMutex(d->mutex);
+	numDecoded = d->numDecoded;
+	Sys_UnlockMutex(d->mutex);
+
+	for (i = 0; i < numDecoded; i++) {
+		p = &d->packets[(d->tail + i) % VOIP_DECODE_QUEUE];
+
+		Com_DPrintf("VoIP: playback %d bytes, %d samples, %d frames\n", p->numSamples * 2, p->numSamples, p->frames);
+
+		if (p->numSamples > 0)
+			CL_PlayVoip(p->sender, p->numSamples, (const byte *)p->decoded, p->flags);
+	}
+
+	Sys_LockMutex(d->mutex);
+	d->tail = (d->tail + numDecoded) % VOIP_DECODE_QUEUE;
+	d->numQueued -= numDecoded;
+	d->numDecoded -= numDecoded;
+	Sys_UnlockMutex(d->mutex);
+}
+
 /*
 =====================
 CL_ParseVoip
@@ -645,7 +867,8 @@ A VoIP message has been received from the server
 =====================
 */
 static void CL_ParseVoip(msg_t *msg, qboolean ignoreData) {
-	static short decoded[VOIP_MAX_PACKET_SAMPLES * 4]; // !!! FIXME: don't hard code
+	voipDecoder_t *d = &voipDecoder;
+	voipPacket_t *p;
 
 	const int sender = MSG_ReadShort(msg);
 	const int generation = MSG_ReadByte(msg);
@@ -653,11 +876,7 @@ static void CL_ParseVoip(msg_t *msg, qboolean ignoreData) {
 	const int frames = MSG_ReadByte(msg);
 	const int packetsize = MSG_ReadShort(msg);
 	const int flags = MSG_ReadBits(msg, VOIP_FLAGCNT);
-	unsigned char encoded[4000];
-	int numSamples;
-	int seqdiff;
-	int written = 0;
-	int i;
+	unsigned char encoded[sizeof(p->encoded)];
 
 	Com_DPrintf("VoIP: %d-byte packet from client %d\n", packetsize, sender);
 
@@ -684,120 +903,115 @@ static void CL_ParseVoip(msg_t *msg, qboolean ignoreData) {
 		return; // overlarge packet, bail.
 	}
 
-	MSG_ReadData(msg, encoded, packetsize);
-
-	if (ignoreData) {
-		return; // just ignore legacy speex voip data
-	} else if (!clc.voipCodecInitialized) {
-		return; // can't handle VoIP without libopus!
-	} else if (sender >= MAX_CLIENTS) {
-		return; // bogus sender.
-	} else if (CL_ShouldIgnoreVoipSender(sender)) {
-		return; // Channel is muted, bail.
+	if (ignoreData || !clc.voipCodecInitialized || sender >= MAX_CLIENTS || CL_ShouldIgnoreVoipSender(sender)) {
+		// ignoring legacy speex voip data, can't handle VoIP without
+		// libopus, bogus sender or the channel is muted
+		MSG_ReadData(msg, encoded, packetsize);
+		return;
 	}
 
 	// !!! FIXME: make sure data is narrowband? Does decoder handle this?
 
-	Com_DPrintf("VoIP: packet accepted!\n");
-
-	seqdiff = sequence - clc.voipIncomingSequence[sender];
-
-	// This is a new "generation" ... a new recording started, reset the bits.
-	if (generation != clc.voipIncomingGeneration[sender]) {
-		Com_DPrintf("VoIP: new generation %d!\n", generation);
-		opus_decoder_ctl(clc.opusDecoder[sender], OPUS_RESET_STATE);
-		clc.voipIncomingGeneration[sender] = generation;
-		seqdiff = 0;
-	} else if (seqdiff < 0) { // we're ahead of the sequence?!
-		// This shouldn't happen unless the packet is corrupted or something.
-		Com_DPrintf("VoIP: misordered sequence! %d < %d!\n", sequence, clc.voipIncomingSequence[sender]);
-		// reset the decoder just in case.
-		opus_decoder_ctl(clc.opusDecoder[sender], OPUS_RESET_STATE);
-		seqdiff = 0;
-	} else if (seqdiff * VOIP_MAX_PACKET_SAMPLES * 2 >= sizeof(decoded)) { // dropped more than we can handle?
-		// just start over.
-		Com_DPrintf("VoIP: Dropped way too many (%d) frames from client #%d\n", seqdiff, sender);
-		opus_decoder_ctl(clc.opusDecoder[sender], OPUS_RESET_STATE);
-		seqdiff = 0;
-	}
-
-	if (seqdiff != 0) {
-		Com_DPrintf("VoIP: Dropped %d frames from client #%d\n", seqdiff, sender);
-		// tell opus that we're missing frames...
-		for (i = 0; i < seqdiff; i++) {
-			assert((written + VOIP_MAX_PACKET_SAMPLES) * 2 < sizeof(decoded));
-			numSamples = opus_decode(clc.opusDecoder[sender], NULL, 0, decoded + written, VOIP_MAX_PACKET_SAMPLES, 0);
-			if (numSamples <= 0) {
-				Com_DPrintf("VoIP: Error decoding frame %d from client #%d\n", i, sender);
-				continue;
-			}
-			written += numSamples;
+	if (d->thread) {
+		Sys_LockMutex(d->mutex);
+		if (d->numQueued == VOIP_DECODE_QUEUE) {
+			Sys_UnlockMutex(d->mutex);
+			// the sequence gap makes opus conceal it
+			Com_DPrintf("VoIP: decode queue full, dropped a packet from client #%d\n", sender);
+			MSG_ReadData(msg, encoded, packetsize);
+			return;
 		}
+		p = &d->packets[(d->tail + d->numQueued) % VOIP_DECODE_QUEUE];
+		Sys_UnlockMutex(d->mutex);
+	} else {
+		p = &voipSyncPacket;
 	}
 
-	numSamples =
-		opus_decode(clc.opusDecoder[sender], encoded, packetsize, decoded + written, ARRAY_LEN(decoded) - written, 0);
+	MSG_ReadData(msg, p->encoded, packetsize);
+	p->sender = sender;
+	p->generation = generation;
+	p->sequence = sequence;
+	p->frames = frames;
+	p->flags = flags;
+	p->packetsize = packetsize;
 
-	if (numSamples <= 0) {
-		Com_DPrintf("VoIP: Error decoding voip data from client #%d\n", sender);
-		numSamples = 0;
-	}
+	Com_DPrintf("VoIP: packet accepted!\n");
 
-#if 0
-	static FILE *encio = NULL;
-	if (encio == NULL)
-		encio = fopen("voip-incoming-encoded.bin", "wb");
-	if (encio != NULL) {
-		fwrite(encoded, packetsize, 1, encio);
-		fflush(encio);
-	}
-	static FILE *decio = NULL;
-	if (decio == NULL)
-		decio = fopen("voip-incoming-decoded.bin", "wb");
-	if (decio != NULL) {
-		fwrite(decoded + written, numSamples * 2, 1, decio);
-		fflush(decio);
-	}
-#endif
+	clc.voipLastPacket[sender] = cl.serverTime;
 
-	written += numSamples;
+	if (d->thread) {
+		Sys_LockMutex(d->mutex);
+		d->numQueued++;
+		Sys_SignalCond(d->wake);
+		Sys_UnlockMutex(d->mutex);
+		return;
+	}
 
-	Com_DPrintf("VoIP: playback %d bytes, %d samples, %d frames\n", written * 2, written, frames);
+	CL_DecodeVoip(p);
 
-	if (written > 0)
-		CL_PlayVoip(sender, written, (const byte *)decoded, flags);
+	Com_DPrintf("VoIP: playback %d bytes, %d samples, %d frames\n", p->numSamples * 2, p->numSamples, frames);
 
-	clc.voipIncomingSequence[sender] = sequence + frames;
-	clc.voipLastPacket[sender] = cl.serverTime;
+	if (p->numSamples > 0)
+		CL_PlayVoip(sender, p->numSamples, (const byte *)p->decoded, flags);
 }
 #endif
 
 /*
 =====================
-CL_ParseCommandString
+CL_StoreCommandString
 
 Command strings are just saved off until cgame asks for them
 when it transitions a snapshot
 =====================
 */
-void CL_ParseCommandString(msg_t *msg) {
-	const char *s;
-	int seq;
+static void CL_StoreCommandString(int seq, const char *s) {
 	int index;
 
-	seq = MSG_ReadLong(msg);
-	s = MSG_ReadString(msg);
-
 	// see if we have already executed stored it off
 	if (clc.serverCommandSequence >= seq) {
 		return;
 	}
 	clc.serverCommandSequence = seq;
 
-	index = seq & (MAX_RELIABLE_COMMANDS - 1);
+	index = seq & (MAX_PACKED_RELIABLE_COMMANDS - 1);
 	Q_strncpyz(clc.serverCommands[index], s, sizeof(clc.serverCommands[index]));
 }
 
+/*
+=====================
+CL_ParseCommandString
+=====================
+*/
+void CL_ParseCommandString(msg_t *msg) {
+	int seq;
+
+	seq = MSG_ReadLong(msg);
+	CL_StoreCommandString(seq, MSG_ReadString(msg));
+}
+
+/*
+=====================
+CL_ParseCommandStrings
+
+A run of consecutive server commands packed by a NETCOMP_PACKEDCOMMANDS server
+=====================
+*/
+static void CL_ParseCommandStrings(msg_t *msg) {
+	const char *s;
+	int seq, count, i;
+
+	seq = MSG_ReadLong(msg);
+	count = MSG_ReadByte(msg);
+
+	for (i = 0; i < count; i++) {
+		s = MSG_ReadServerCommand(msg);
+		if (!s) {
+			Com_Error(ERR_DROP, "CL_ParseCommandStrings: bad server command type");
+		}
+		CL_StoreCommandString(seq + i, s);
+	}
+}
+
 /*
 =====================
 CL_ParseServerMessage
@@ -855,6 +1069,9 @@ void CL_ParseServerMessage(msg_t *msg) {
 		case svc_serverCommand:
 			CL_ParseCommandString(msg);
 			break;
+		case svc_serverCommands:
+			CL_ParseCommandStrings(msg);
+			break;
 		case svc_gamestate:
 			CL_ParseGamestate(msg);
 			break;
@@ -302,7 +302,7 @@ void SCR_DrawDemoRecording(void) {
 		return;
 	}
 
-	pos = FS_FTell(clc.demofile);
+	pos = CL_DemoWrittenBytes();
 	sprintf(string, "RECORDING %s: %ik", clc.demoName, pos / 1024);
 
 	SCR_DrawStringExt(320 - strlen(string) * 4, 20, 8, string, g_color_table[7], qtrue, qfalse);
@@ -534,8 +534,10 @@ void SCR_UpdateScreen(void) {
 			SCR_DrawScreenField(STEREO_CENTER);
 		}
 
-		if (com_speeds->integer) {
+		if (com_speeds->integer || CL_TimeDemoMeasuring()) {
 			re.EndFrame(&time_frontend, &time_backend);
+			CL_TimeDemoAddTime(TD_FRONTEND, time_frontend * 1000);
+			CL_TimeDemoAddTime(TD_BACKEND, time_backend * 1000);
 		} else {
 			re.EndFrame(NULL, NULL);
 		}
@@ -0,0 +1,434 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+// cl_timedemo.c -- timedemo benchmark statistics
+
+#include "client.h"
+
+/*
+=============================================================================
+
+A timedemo frame runs from one CL_SetCGameTime to the next.  Its time is
+split into the cgame, the renderer front and back end (as reported by
+re.EndFrame, in whole milliseconds), sound, and the rest of the client.
+
+The demo is played cl_timedemoRuns times, the first cl_timedemoWarmup
+frames of every run are left out, and if cl_timedemoReport is set the
+frames of every run go to benchmarks/<report>-<cl_renderer>.csv and the
+statistics to benchmarks/<report>-<cl_renderer>.json.
+
+=============================================================================
+*/
+
+#define MAX_TIMEDEMO_FRAMES 32768
+#define MAX_TIMEDEMO_RUNS 32
+
+static const char *timeDemoPartNames[TD_NUMPARTS] = {"client", "cgame", "frontend", "backend", "sound"};
+
+static const float timeDemoPercentiles[] = {50.0f, 90.0f, 95.0f, 99.0f, 99.9f};
+#define NUM_TIMEDEMO_PERCENTILES ARRAY_LEN(timeDemoPercentiles)
+
+typedef struct {
+	int total; // usec
+	int parts[TD_NUMPARTS];
+} timeDemoFrame_t;
+
+typedef struct {
+	int frames;
+	float seconds;
+	float fps;
+	float low1;	 // fps over the slowest 1% of the frames
+	float low01; // and 0.1%
+	float minMsec, avgMsec, maxMsec;
+	float percentiles[NUM_TIMEDEMO_PERCENTILES];
+	float partMsec[TD_NUMPARTS];
+} timeDemoStats_t;
+
+typedef struct {
+	qboolean measuring; // a run is in progress
+	qboolean replaying; // the next demo started is the next run
+	char demoName[MAX_QPATH];
+	int numRuns;
+	int warmup;
+
+	int run;
+	int frameNum; // frames of this run, warmup included
+	int64_t frameStart;
+	int parts[TD_NUMPARTS];
+
+	fileHandle_t csv;
+	char reportName[MAX_QPATH];
+
+	int numFrames;
+	timeDemoStats_t stats[MAX_TIMEDEMO_RUNS];
+} timeDemo_t;
+
+static timeDemo_t td;
+static timeDemoFrame_t tdFrames[MAX_TIMEDEMO_FRAMES];
+static int tdSorted[MAX_TIMEDEMO_FRAMES];
+
+/*
+=================
+CL_TimeDemoMeasuring
+=================
+*/
+qboolean CL_TimeDemoMeasuring(void) {
+	return td.measuring;
+}
+
+/*
+=================
+CL_TimeDemoAddTime
+=================
+*/
+void CL_TimeDemoAddTime(timeDemoPart_t part, int usec) {
+	if (td.measuring) {
+		td.parts[part] += usec;
+	}
+}
+
+/*
+=================
+CL_TimeDemoBegin
+
+Called on the first frame of a timedemo
+=================
+*/
+void CL_TimeDemoBegin(void) {
+	if (!td.replaying || Q_stricmp(td.demoName, clc.demoName)) {
+		// a new benchmark
+		if (td.csv) {
+			FS_FCloseFile(td.csv);
+		}
+		Com_Memset(&td, 0, sizeof(td));
+
+		Q_strncpyz(td.demoName, clc.demoName, sizeof(td.demoName));
+		td.numRuns = (int)Com_Clamp(1, MAX_TIMEDEMO_RUNS, cl_timedemoRuns->integer);
+		td.warmup = cl_timedemoWarmup->integer > 0 ? cl_timedemoWarmup->integer : 0;
+
+		if (cl_timedemoReport->string[0]) {
+			Com_sprintf(td.reportName, sizeof(td.reportName), "benchmarks/%s-%s", cl_timedemoReport->string,
+						Cvar_VariableString("cl_renderer"));
+			td.csv = FS_FOpenFileWrite(va("%s.csv", td.reportName));
+			if (td.csv) {
+				FS_Printf(td.csv, "run,frame,total_us,client_us,cgame_us,frontend_us,backend_us,sound_us\n");
+			} else {
+				Com_Printf("Couldn't open %s.csv for writing\n", td.reportName);
+			}
+		}
+	}
+
+	td.replaying = qfalse;
+	td.measuring = qtrue;
+	td.frameNum = 0;
+	td.numFrames = 0;
+	td.frameStart = 0;
+	Com_Memset(td.parts, 0, sizeof(td.parts));
+}
+
+/*
+=================
+CL_TimeDemoFrame
+
+Closes the frame that started at the last call
+=================
+*/
+void CL_TimeDemoFrame(void) {
+	timeDemoFrame_t *f;
+	int64_t now;
+	int i, other;
+
+	if (!td.measuring) {
+		return;
+	}
+
+	now = Sys_Microseconds();
+	if (td.frameStart && td.frameNum++ >= td.warmup && td.numFrames < MAX_TIMEDEMO_FRAMES) {
+		f = &tdFrames[td.numFrames++];
+		f->total = (int)(now - td.frameStart);
+
+		// the renderer front end runs inside the cgame's frame
+		td.parts[TD_CGAME] -= td.parts[TD_FRONTEND];
+		if (td.parts[TD_CGAME] < 0) {
+			td.parts[TD_CGAME] = 0;
+		}
+
+		other = 0;
+		for (i = TD_CLIENT + 1; i < TD_NUMPARTS; i++) {
+			f->parts[i] = td.parts[i];
+			other += td.parts[i];
+		}
+		f->parts[TD_CLIENT] = f->total > other ? f->total - other : 0;
+	}
+
+	td.frameStart = now;
+	Com_Memset(td.parts, 0, sizeof(td.parts));
+}
+
+/*
+=================
+CL_TimeDemoCompare
+=================
+*/
+static int QDECL CL_TimeDemoCompare(const void *a, const void *b) {
+	return *(const int *)a - *(const int *)b;
+}
+
+/*
+=================
+CL_TimeDemoLow
+
+Frames per second over the slowest fraction of the sorted frames
+=================
+*/
+static float CL_TimeDemoLow(int numSorted, float fraction) {
+	int64_t sum;
+	int i, count;
+
+	count = (int)(numSorted * fraction);
+	if (count < 1) {
+		count = 1;
+	}
+
+	sum = 0;
+	for (i = numSorted - count; i < numSorted; i++) {
+		sum += tdSorted[i];
+	}
+
+	return sum ? count * 1000000.0f / sum : 0.0f;
+}
+
+/*
+=================
+CL_TimeDemoComputeStats
+=================
+*/
+static void CL_TimeDemoComputeStats(timeDemoStats_t *s) {
+	int64_t total, parts[TD_NUMPARTS];
+	int i, j, n;
+
+	Com_Memset(s, 0, sizeof(*s));
+	n = td.numFrames;
+	if (!n) {
+		return;
+	}
+
+	total = 0;
+	Com_Memset(parts, 0, sizeof(parts));
+	for (i = 0; i < n; i++) {
+		tdSorted[i] = tdFrames[i].total;
+		total += tdFrames[i].total;
+		for (j = 0; j < TD_NUMPARTS; j++) {
+			parts[j] += tdFrames[i].parts[j];
+		}
+	}
+	qsort(tdSorted, n, sizeof(tdSorted[0]), CL_TimeDemoCompare);
+
+	s->frames = n;
+	s->seconds = total / 1000000.0f;
+	s->fps = total ? n * 1000000.0f / total : 0.0f;
+	s->low1 = CL_TimeDemoLow(n, 0.01f);
+	s->low01 = CL_TimeDemoLow(n, 0.001f);
+	s->minMsec = tdSorted[0] / 1000.0f;
+	s->avgMsec = total / (n * 1000.0f);
+	s->maxMsec = tdSorted[n - 1] / 1000.0f;
+
+	// nearest rank
+	for (i = 0; i < NUM_TIMEDEMO_PERCENTILES; i++) {
+		j = (int)ceil(timeDemoPercentiles[i] / 100.0f * n) - 1;
+		if (j < 0) {
+			j = 0;
+		} else if (j > n - 1) {
+			j = n - 1;
+		}
+		s->percentiles[i] = tdSorted[j] / 1000.0f;
+	}
+
+	for (j = 0; j < TD_NUMPARTS; j++) {
+		s->partMsec[j] = parts[j] / (n * 1000.0f);
+	}
+}
+
+/*
+=================
+CL_TimeDemoWriteStats
+=================
+*/
+static void CL_TimeDemoWriteStats(fileHandle_t f, const timeDemoStats_t *s, const char *indent) {
+	int i;
+
+	FS_Printf(f, "%s\"frames\": %d, \"seconds\": %.3f, \"fps\": %.2f, \"low1_fps\": %.2f, \"low01_fps\": %.2f,\n", indent,
+			  s->frames, s->seconds, s->fps, s->low1, s->low01);
+	FS_Printf(f, "%s\"min_ms\": %.3f, \"avg_ms\": %.3f, \"max_ms\": %.3f,\n", indent, s->minMsec, s->avgMsec,
+			  s->maxMsec);
+
+	FS_Printf(f, "%s\"percentiles_ms\": {", indent);
+	for (i = 0; i < NUM_TIMEDEMO_PERCENTILES; i++) {
+		FS_Printf(f, "%s\"p%g\": %.3f", i ? ", " : "", timeDemoPercentiles[i], s->percentiles[i]);
+	}
+	FS_Printf(f, "},\n");
+
+	FS_Printf(f, "%s\"parts_ms\": {", indent);
+	for (i = 0; i < TD_NUMPARTS; i++) {
+		FS_Printf(f, "%s\"%s\": %.3f", i ? ", " : "", timeDemoPartNames[i], s->partMsec[i]);
+	}
+	FS_Printf(f, "}\n");
+}
+
+/*
+=================
+CL_TimeDemoJSONString
+
+Copies a string for a JSON value, dropping what would need escaping
+=================
+*/
+static const char *CL_TimeDemoJSONString(const char *in) {
+	static char out[MAX_STRING_CHARS];
+	int i;
+
+	for (i = 0; *in && i < (int)sizeof(out) - 1; in++) {
+		if (*in != '"' && *in != '\\' && (byte)*in >= ' ') {
+			out[i++] = *in;
+		}
+	}
+	out[i] = '\0';
+
+	return out;
+}
+
+/*
+=================
+CL_TimeDemoWriteReport
+=================
+*/
+static void CL_TimeDemoWriteReport(void) {
+	timeDemoStats_t mean;
+	fileHandle_t f;
+	float scale;
+	int i, j;
+
+	// the mean of every statistic over the runs
+	Com_Memset(&mean, 0, sizeof(mean));
+	scale = 1.0f / td.numRuns;
+	for (i = 0; i < td.numRuns; i++) {
+		const timeDemoStats_t *s = &td.stats[i];
+
+		mean.frames += s->frames;
+		mean.seconds += s->seconds * scale;
+		mean.fps += s->fps * scale;
+		mean.low1 += s->low1 * scale;
+		mean.low01 += s->low01 * scale;
+		mean.minMsec += s->minMsec * scale;
+		mean.avgMsec += s->avgMsec * scale;
+		mean.maxMsec += s->maxMsec * scale;
+		for (j = 0; j < NUM_TIMEDEMO_PERCENTILES; j++) {
+			mean.percentiles[j] += s->percentiles[j] * scale;
+		}
+		for (j = 0; j < TD_NUMPARTS; j++) {
+			mean.partMsec[j] += s->partMsec[j] * scale;
+		}
+	}
+	mean.frames /= td.numRuns;
+
+	Com_Printf("timedemo: %d runs, mean %.1f fps, 1%% low %.1f fps, 0.1%% low %.1f fps, p99 %.2f ms\n", td.numRuns,
+			   mean.fps, mean.low1, mean.low01, mean.percentiles[3]);
+
+	if (!td.reportName[0]) {
+		return;
+	}
+
+	f = FS_FOpenFileWrite(va("%s.json", td.reportName));
+	if (!f) {
+		Com_Printf("Couldn't open %s.json for writing\n", td.reportName);
+		return;
+	}
+
+	FS_Printf(f, "{\n");
+	FS_Printf(f, "\t\"demo\": \"%s\",\n", CL_TimeDemoJSONString(td.demoName));
+	FS_Printf(f, "\t\"version\": \"%s\",\n", CL_TimeDemoJSONString(Q3_VERSION));
+	FS_Printf(f, "\t\"renderer\": \"%s\",\n", CL_TimeDemoJSONString(Cvar_VariableString("cl_renderer")));
+	FS_Printf(f, "\t\"gl_vendor\": \"%s\",\n", CL_TimeDemoJSONString(cls.glconfig.vendor_string));
+	FS_Printf(f, "\t\"gl_renderer\": \"%s\",\n", CL_TimeDemoJSONString(cls.glconfig.renderer_string));
+	FS_Printf(f, "\t\"gl_version\": \"%s\",\n", CL_TimeDemoJSONString(cls.glconfig.version_string));
+	FS_Printf(f, "\t\"resolution\": \"%dx%d\",\n", cls.glconfig.vidWidth, cls.glconfig.vidHeight);
+	FS_Printf(f, "\t\"warmup_frames\": %d,\n", td.warmup);
+	FS_Printf(f, "\t\"runs\": [\n");
+	for (i = 0; i < td.numRuns; i++) {
+		FS_Printf(f, "\t\t{\n");
+		CL_TimeDemoWriteStats(f, &td.stats[i], "\t\t\t");
+		FS_Printf(f, "\t\t}%s\n", i < td.numRuns - 1 ? "," : "");
+	}
+	FS_Printf(f, "\t],\n");
+	FS_Printf(f, "\t\"mean\": {\n");
+	CL_TimeDemoWriteStats(f, &mean, "\t\t");
+	FS_Printf(f, "\t}\n");
+	FS_Printf(f, "}\n");
+
+	FS_FCloseFile(f);
+	Com_Printf("%s.json written\n", td.reportName);
+}
+
+/*
+=================
+CL_TimeDemoFinish
+
+Called when a timedemo reaches its end, returns qtrue if the demo
+has been queued to play again for the next run
+=================
+*/
+qboolean CL_TimeDemoFinish(void) {
+	timeDemoStats_t *s;
+	timeDemoFrame_t *f;
+	int i;
+
+	if (!td.measuring) {
+		return qfalse;
+	}
+	td.measuring = qfalse;
+
+	s = &td.stats[td.run];
+	CL_TimeDemoComputeStats(s);
+
+	Com_Printf("run %d/%d: %d frames %.1f fps, 1%% low %.1f fps, 0.1%% low %.1f fps, p99 %.2f ms\n", td.run + 1,
+			   td.numRuns, s->frames, s->fps, s->low1, s->low01, s->percentiles[3]);
+
+	if (td.csv) {
+		for (i = 0, f = tdFrames; i < td.numFrames; i++, f++) {
+			FS_Printf(td.csv, "%d,%d,%d,%d,%d,%d,%d,%d\n", td.run + 1, td.warmup + i, f->total, f->parts[TD_CLIENT],
+					  f->parts[TD_CGAME], f->parts[TD_FRONTEND], f->parts[TD_BACKEND], f->parts[TD_SOUND]);
+		}
+	}
+
+	if (++td.run < td.numRuns) {
+		td.replaying = qtrue;
+		Cbuf_AddText(va("demo \"%s\"\n", td.demoName));
+		return qtrue;
+	}
+
+	if (td.csv) {
+		FS_FCloseFile(td.csv);
+		td.csv = 0;
+		Com_Printf("%s.csv written\n", td.reportName);
+	}
+	CL_TimeDemoWriteReport();
+
+	return qfalse;
+}
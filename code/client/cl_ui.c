@@ -676,6 +676,62 @@ static int FloatAsInt(float f) {
 	return fi.i;
 }
 
+/*
+====================
+CL_UISetColor etc.
+
+Traps the ui calls many times per frame, these are dispatched
+straight from the VM without going through CL_UISystemCalls
+====================
+*/
+static intptr_t CL_UIAddRefEntityToScene(intptr_t *args) {
+	re.AddRefEntityToScene(VMA(1));
+	return 0;
+}
+
+static intptr_t CL_UISetColor(intptr_t *args) {
+	re.SetColor(VMA(1));
+	return 0;
+}
+
+static intptr_t CL_UIDrawStretchPic(intptr_t *args) {
+	re.DrawStretchPic(VMF(1), VMF(2), VMF(3), VMF(4), VMF(5), VMF(6), VMF(7), VMF(8), args[9]);
+	return 0;
+}
+
+static intptr_t CL_UIDrawStretchPics(intptr_t *args) {
+	const stretchPic_t *pics = VMA(1);
+	int i;
+
+	if (args[2] < 0 || args[2] > MAX_STRETCHPICS) {
+		Com_Error(ERR_DROP, "UI_R_DRAWSTRETCHPICS: bad count %i", (int)args[2]);
+	}
+
+	for (i = 0; i < args[2]; i++) {
+		re.DrawStretchPic(pics[i].x, pics[i].y, pics[i].w, pics[i].h, pics[i].s1, pics[i].t1, pics[i].s2, pics[i].t2,
+						  args[3]);
+	}
+	return 0;
+}
+
+static const vmSyscallDef_t cl_uiSyscalls[] = {
+	{UI_R_ADDREFENTITYTOSCENE, CL_UIAddRefEntityToScene, VMINL_NONE},
+	{UI_R_SETCOLOR, CL_UISetColor, VMINL_NONE},
+	{UI_R_DRAWSTRETCHPIC, CL_UIDrawStretchPic, VMINL_NONE},
+	{UI_R_DRAWSTRETCHPICS, CL_UIDrawStretchPics, VMINL_NONE},
+	{UI_SIN, VM_TrapSin, VMINL_SIN},
+	{UI_COS, VM_TrapCos, VMINL_COS},
+	{UI_SQRT, VM_TrapSqrt, VMINL_SQRT},
+	{UI_FLOOR, VM_TrapFloor, VMINL_FLOOR},
+	{UI_CEIL, VM_TrapCeil, VMINL_CEIL},
+	{UI_MEMSET, VM_TrapMemset, VMINL_MEMSET},
+	{UI_MEMCPY, VM_TrapMemcpy, VMINL_MEMCPY},
+	{UI_MEMMOVE, VM_TrapMemcpy, VMINL_MEMCPY},
+	{UI_STRNCPY, VM_TrapStrncpy, VMINL_STRNCPY},
+	{UI_STRLEN, VM_TrapStrlen, VMINL_STRLEN},
+	{-1, NULL, VMINL_NONE}
+};
+
 /*
 ====================
 CL_UISystemCalls
@@ -703,6 +759,8 @@ intptr_t CL_UISystemCalls(intptr_t *args) {
 	case UI_CVAR_UPDATE:
 		Cvar_Update(VMA(1));
 		return 0;
+	case UI_CVAR_GENERATION:
+		return Cvar_Generation();
 
 	case UI_CVAR_SET:
 		Cvar_SetSafe(VMA(1), VMA(2));
@@ -782,8 +840,7 @@ intptr_t CL_UISystemCalls(intptr_t *args) {
 		return 0;
 
 	case UI_R_ADDREFENTITYTOSCENE:
-		re.AddRefEntityToScene(VMA(1));
-		return 0;
+		return CL_UIAddRefEntityToScene(args);
 
 	case UI_R_ADDPOLYTOSCENE:
 		re.AddPolyToScene(args[1], args[2], VMA(3), 1);
@@ -798,12 +855,13 @@ intptr_t CL_UISystemCalls(intptr_t *args) {
 		return 0;
 
 	case UI_R_SETCOLOR:
-		re.SetColor(VMA(1));
-		return 0;
+		return CL_UISetColor(args);
 
 	case UI_R_DRAWSTRETCHPIC:
-		re.DrawStretchPic(VMF(1), VMF(2), VMF(3), VMF(4), VMF(5), VMF(6), VMF(7), VMF(8), args[9]);
-		return 0;
+		return CL_UIDrawStretchPic(args);
+
+	case UI_R_DRAWSTRETCHPICS:
+		return CL_UIDrawStretchPics(args);
 
 	case UI_R_MODELBOUNDS:
 		re.ModelBounds(args[1], VMA(2), VMA(3));
@@ -959,34 +1017,35 @@ intptr_t CL_UISystemCalls(intptr_t *args) {
 		return FloatAsInt(CLUI_GetVoiceGain(args[1]));
 
 	case UI_MEMSET:
-		Com_Memset(VMA(1), args[2], args[3]);
-		return 0;
+		return VM_TrapMemset(args);
 
 	case UI_MEMCPY:
-		Com_Memcpy(VMA(1), VMA(2), args[3]);
-		return 0;
+	case UI_MEMMOVE:
+		return VM_TrapMemcpy(args);
 
 	case UI_STRNCPY:
-		strncpy(VMA(1), VMA(2), args[3]);
-		return args[1];
+		return VM_TrapStrncpy(args);
+
+	case UI_STRLEN:
+		return VM_TrapStrlen(args);
 
 	case UI_SIN:
-		return FloatAsInt(sin(VMF(1)));
+		return VM_TrapSin(args);
 
 	case UI_COS:
-		return FloatAsInt(cos(VMF(1)));
+		return VM_TrapCos(args);
 
 	case UI_ATAN2:
 		return FloatAsInt(atan2(VMF(1), VMF(2)));
 
 	case UI_SQRT:
-		return FloatAsInt(sqrt(VMF(1)));
+		return VM_TrapSqrt(args);
 
 	case UI_FLOOR:
-		return FloatAsInt(floor(VMF(1)));
+		return VM_TrapFloor(args);
 
 	case UI_CEIL:
-		return FloatAsInt(ceil(VMF(1)));
+		return VM_TrapCeil(args);
 
 	case UI_PC_ADD_GLOBAL_DEFINE:
 		return botlib_export->PC_AddGlobalDefine(VMA(1));
@@ -1076,7 +1135,7 @@ void CL_InitUI(void) {
 			interpret = VMI_COMPILED;
 	}
 
-	uivm = VM_Create("ui", CL_UISystemCalls, interpret);
+	uivm = VM_Create("ui", CL_UISystemCalls, cl_uiSyscalls, interpret);
 	if (!uivm) {
 		Com_Error(ERR_FATAL, "VM_Create on UI failed");
 	}
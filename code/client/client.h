@@ -163,6 +163,7 @@ typedef struct {
 
 	int clientNum;
 	int lastPacketSentTime; // for retransmits during connection
+	float nextPacketTime;	// cl_packetPacing: when the next packet is due
 	int lastPacketTime;		// for timeouts
 
 	char servername[MAX_OSPATH]; // name of server from original connect (used by reconnect)
@@ -190,7 +191,7 @@ typedef struct {
 	// reliable messages received from server
 	int serverCommandSequence;
 	int lastExecutedServerCommand; // last server command grabbed or executed with CL_GetServerCommand
-	char serverCommands[MAX_RELIABLE_COMMANDS][MAX_STRING_CHARS];
+	char serverCommands[MAX_PACKED_RELIABLE_COMMANDS][MAX_STRING_CHARS];
 
 	// file transfer from server
 	fileHandle_t download;
@@ -200,8 +201,6 @@ typedef struct {
 	qboolean cURLEnabled;
 	qboolean cURLUsed;
 	qboolean cURLDisconnected;
-	char downloadURL[MAX_OSPATH];
-	CURL *downloadCURL;
 	CURLM *downloadCURLM;
 #endif /* USE_CURL */
 	int sv_allowDownload;
@@ -279,8 +278,9 @@ no client connection is active at all
 
 typedef struct {
 	netadr_t adr;
-	int start;
+	int start; // when it was sent, or queued while not sent yet
 	int time;
+	qboolean sent; // held back until cl_pingRate allows it
 	char info[MAX_INFO_STRING];
 } ping_t;
 
@@ -405,8 +405,16 @@ extern cvar_t *j_side_axis;
 extern cvar_t *j_up_axis;
 
 extern cvar_t *cl_timedemo;
+extern cvar_t *cl_timedemoRuns;
+extern cvar_t *cl_timedemoWarmup;
+extern cvar_t *cl_timedemoReport;
 extern cvar_t *cl_aviFrameRate;
 extern cvar_t *cl_aviMotionJpeg;
+extern cvar_t *cl_aviPipe;
+extern cvar_t *cl_aviQueueFrames;
+extern cvar_t *cl_pingRate;
+extern cvar_t *cl_packetPacing;
+extern cvar_t *cl_showLatency;
 
 extern cvar_t *cl_activeAction;
 
@@ -416,7 +424,9 @@ extern cvar_t *cl_conXOffset;
 extern cvar_t *cl_inGameVideo;
 
 extern cvar_t *cl_lanForcePackets;
+extern cvar_t *cl_netCompression;
 extern cvar_t *cl_autoRecordDemo;
+extern cvar_t *cl_demoCompress;
 
 extern cvar_t *cl_consoleKeys;
 
@@ -463,6 +473,7 @@ void CL_Vid_Restart_f(void);
 void CL_Snd_Restart_f(void);
 void CL_StartDemoLoop(void);
 void CL_NextDemo(void);
+qboolean CL_VideoBatchNext(void);
 void CL_ReadDemoMessage(void);
 void CL_StopRecord_f(void);
 
@@ -473,6 +484,7 @@ void CL_GetPing(int n, char *buf, int buflen, int *pingtime);
 void CL_GetPingInfo(int n, char *buf, int buflen);
 void CL_ClearPing(int n);
 int CL_GetPingQueueCount(void);
+void CL_SendPings(void);
 
 void CL_ShutdownRef(void);
 void CL_InitRef(void);
@@ -512,6 +524,9 @@ extern int cl_connectedToCheatServer;
 
 #ifdef USE_VOIP
 void CL_Voip_f(void);
+void CL_StartVoipDecoder(void);
+void CL_StopVoipDecoder(void);
+void CL_PlayDecodedVoip(void);
 #endif
 
 void CL_SystemInfoChanged(void);
@@ -624,6 +639,9 @@ void Cin_OGM_Shutdown(cinematics_t *cin);
 //
 void CL_InitCGame(void);
 void CL_ShutdownCGame(void);
+void CL_RestartCGame(void);
+qboolean CL_GetServerCommand(int serverCommandNumber);
+qboolean CL_SetGameStateString(gameState_t *gs, int index, const char *s);
 qboolean CL_GameCommand(void);
 void CL_CGameRendering(stereoFrame_t stereo);
 void CL_SetCGameTime(void);
@@ -656,6 +674,36 @@ void CL_WriteAVIAudioFrame(const byte *pcmBuffer, int size);
 qboolean CL_CloseAVI(void);
 qboolean CL_VideoRecording(void);
 
+//
+// cl_timedemo.c
+//
+typedef enum { TD_CLIENT, TD_CGAME, TD_FRONTEND, TD_BACKEND, TD_SOUND, TD_NUMPARTS } timeDemoPart_t;
+
+qboolean CL_TimeDemoMeasuring(void);
+void CL_TimeDemoAddTime(timeDemoPart_t part, int usec);
+void CL_TimeDemoBegin(void);
+void CL_TimeDemoFrame(void);
+qboolean CL_TimeDemoFinish(void);
+
+//
+// cl_demofile.c
+//
+qboolean CL_DemoOpenWrite(const char *name);
+void CL_DemoWrite(const void *data, int len);
+void CL_DemoCloseWrite(void);
+int CL_DemoWrittenBytes(void);
+void CL_DemoOpenRead(void);
+int CL_DemoRead(void *buffer, int len);
+void CL_DemoRewind(int offset);
+void CL_DemoClose(void);
+
+//
+// cl_demoseek.c
+//
+void CL_DemoIndexBuild(void);
+void CL_DemoIndexClear(void);
+void CL_DemoSeek_f(void);
+
 //
 // cl_main.c
 //
@@ -25,6 +25,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "snd_codec.h"
 
 static snd_codec_t *codecs;
+static qboolean codecToMemory; // S_CodecUtilOpen reads the whole file
 
 /*
 =================
@@ -166,6 +167,47 @@ snd_stream_t *S_CodecOpenStream(const char *filename) {
 	return S_CodecGetSound(filename, NULL);
 }
 
+/*
+=================
+S_CodecOpenMemoryStream
+
+Opens a stream that reads the whole file into memory up front, so
+S_CodecReadStream no longer touches the filesystem and can run on a
+job worker if S_CodecReadsFromThreads allows it.
+=================
+*/
+snd_stream_t *S_CodecOpenMemoryStream(const char *filename) {
+	snd_stream_t *stream;
+
+	codecToMemory = qtrue;
+	stream = S_CodecOpenStream(filename);
+	codecToMemory = qfalse;
+
+	return stream;
+}
+
+/*
+=================
+S_CodecReadsFromThreads
+
+The mp3 decoder grows its buffers from the zone while reading.
+=================
+*/
+qboolean S_CodecReadsFromThreads(const snd_stream_t *stream) {
+	if (!stream->mem) {
+		return qfalse;
+	}
+
+	return stream->codec == &wav_codec
+#ifdef USE_CODEC_VORBIS
+		   || stream->codec == &ogg_codec
+#endif
+#ifdef USE_CODEC_OPUS
+		   || stream->codec == &opus_codec
+#endif
+		;
+}
+
 void S_CodecCloseStream(snd_stream_t *stream) {
 	stream->codec->close(stream);
 }
@@ -205,6 +247,16 @@ snd_stream_t *S_CodecUtilOpen(const char *filename, snd_codec_t *codec) {
 	stream->codec = codec;
 	stream->file = hnd;
 	stream->length = length;
+
+	if (codecToMemory && length > 0) {
+		stream->mem = malloc(length);
+		if (stream->mem) {
+			FS_Read(stream->mem, length, hnd);
+			FS_FCloseFile(hnd);
+			stream->file = 0;
+		}
+	}
+
 	return stream;
 }
 
@@ -214,7 +266,80 @@ S_CodecUtilClose
 =================
 */
 void S_CodecUtilClose(snd_stream_t **stream) {
-	FS_FCloseFile((*stream)->file);
+	if ((*stream)->file) {
+		FS_FCloseFile((*stream)->file);
+	}
+	free((*stream)->mem);
 	Z_Free(*stream);
 	*stream = NULL;
 }
+
+/*
+=================
+S_CodecUtilRead
+
+FS_Read, or a copy out of a memory stream
+=================
+*/
+int S_CodecUtilRead(snd_stream_t *stream, void *buffer, int len) {
+	if (!stream->mem) {
+		return FS_Read(buffer, len, stream->file);
+	}
+
+	len = MIN(len, stream->length - stream->memPos);
+	if (len <= 0) {
+		return 0;
+	}
+
+	Com_Memcpy(buffer, stream->mem + stream->memPos, len);
+	stream->memPos += len;
+
+	return len;
+}
+
+/*
+=================
+S_CodecUtilSeek
+=================
+*/
+int S_CodecUtilSeek(snd_stream_t *stream, long offset, int origin) {
+	long pos;
+
+	if (!stream->mem) {
+		return FS_Seek(stream->file, offset, origin);
+	}
+
+	switch (origin) {
+	case FS_SEEK_SET:
+		pos = offset;
+		break;
+	case FS_SEEK_CUR:
+		pos = stream->memPos + offset;
+		break;
+	case FS_SEEK_END:
+		pos = stream->length + offset;
+		break;
+	default:
+		return -1;
+	}
+
+	if (pos < 0 || pos > stream->length) {
+		return -1;
+	}
+
+	stream->memPos = pos;
+	return 0;
+}
+
+/*
+=================
+S_CodecUtilTell
+=================
+*/
+int S_CodecUtilTell(snd_stream_t *stream) {
+	if (!stream->mem) {
+		return FS_FTell(stream->file);
+	}
+
+	return stream->memPos;
+}
@@ -45,6 +45,8 @@ typedef struct snd_stream_s {
 	int length;
 	int pos;
 	void *ptr;
+	byte *mem; // whole file, read from here instead of file, see S_CodecOpenMemoryStream
+	int memPos;
 } snd_stream_t;
 
 // Codec functions
@@ -71,10 +73,15 @@ void *S_CodecLoad(const char *filename, snd_info_t *info);
 snd_stream_t *S_CodecOpenStream(const char *filename);
 void S_CodecCloseStream(snd_stream_t *stream);
 int S_CodecReadStream(snd_stream_t *stream, int bytes, void *buffer);
+snd_stream_t *S_CodecOpenMemoryStream(const char *filename);
+qboolean S_CodecReadsFromThreads(const snd_stream_t *stream);
 
 // Util functions (used by codecs)
 snd_stream_t *S_CodecUtilOpen(const char *filename, snd_codec_t *codec);
 void S_CodecUtilClose(snd_stream_t **stream);
+int S_CodecUtilRead(snd_stream_t *stream, void *buffer, int len);
+int S_CodecUtilSeek(snd_stream_t *stream, long offset, int origin);
+int S_CodecUtilTell(snd_stream_t *stream);
 
 // WAV Codec
 extern snd_codec_t wav_codec;
@@ -87,7 +87,7 @@ int S_MP3_ReadData(snd_stream_t *stream, struct mad_stream *madstream, byte *enc
 
 	// Fill the buffer right to the end
 
-	retval = FS_Read(&encbuf[leftover], encbufsize - leftover, stream->file);
+	retval = S_CodecUtilRead(stream, &encbuf[leftover], encbufsize - leftover);
 
 	if (retval <= 0) {
 		// EOF reached, that's ok.
@@ -180,7 +180,7 @@ int S_MP3_Scanfile(snd_stream_t *stream) {
 	}
 
 	// Reset the file pointer so we can do the real decoding.
-	FS_Seek(stream->file, 0, FS_SEEK_SET);
+	S_CodecUtilSeek(stream, 0, FS_SEEK_SET);
 
 	return 0;
 }
@@ -74,8 +74,8 @@ size_t S_OGG_Callback_read(void *ptr, size_t size, size_t nmemb, void *datasourc
 	// FS_Read does not support multi-byte elements
 	byteSize = nmemb * size;
 
-	// read it with the Q3 function FS_Read()
-	bytesRead = FS_Read(ptr, byteSize, stream->file);
+	// read it with S_CodecUtilRead(), from the file or from memory
+	bytesRead = S_CodecUtilRead(stream, ptr, byteSize);
 
 	// update the file position
 	stream->pos += bytesRead;
@@ -110,7 +110,7 @@ int S_OGG_Callback_seek(void *datasource, ogg_int64_t offset, int whence) {
 	switch (whence) {
 	case SEEK_SET: {
 		// set the file position in the actual file with the Q3 function
-		retVal = FS_Seek(stream->file, (long)offset, FS_SEEK_SET);
+		retVal = S_CodecUtilSeek(stream, (long)offset, FS_SEEK_SET);
 
 		// something has gone wrong, so we return here
 		if (retVal < 0) {
@@ -124,7 +124,7 @@ int S_OGG_Callback_seek(void *datasource, ogg_int64_t offset, int whence) {
 
 	case SEEK_CUR: {
 		// set the file position in the actual file with the Q3 function
-		retVal = FS_Seek(stream->file, (long)offset, FS_SEEK_CUR);
+		retVal = S_CodecUtilSeek(stream, (long)offset, FS_SEEK_CUR);
 
 		// something has gone wrong, so we return here
 		if (retVal < 0) {
@@ -138,7 +138,7 @@ int S_OGG_Callback_seek(void *datasource, ogg_int64_t offset, int whence) {
 
 	case SEEK_END: {
 		// set the file position in the actual file with the Q3 function
-		retVal = FS_Seek(stream->file, (long)offset, FS_SEEK_END);
+		retVal = S_CodecUtilSeek(stream, (long)offset, FS_SEEK_END);
 
 		// something has gone wrong, so we return here
 		if (retVal < 0) {
@@ -183,7 +183,7 @@ long S_OGG_Callback_tell(void *datasource) {
 	// snd_stream_t in the generic pointer
 	stream = (snd_stream_t *)datasource;
 
-	return (long)FS_FTell(stream->file);
+	return (long)S_CodecUtilTell(stream);
 }
 
 // the callback structure
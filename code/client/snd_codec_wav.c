@@ -29,10 +29,10 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 FGetLittleLong
 =================
 */
-static int FGetLittleLong(fileHandle_t f) {
+static int FGetLittleLong(snd_stream_t *f) {
 	int v;
 
-	FS_Read(&v, sizeof(v), f);
+	S_CodecUtilRead(f, &v, sizeof(v));
 
 	return LittleLong(v);
 }
@@ -42,10 +42,10 @@ static int FGetLittleLong(fileHandle_t f) {
 FGetLittleShort
 =================
 */
-static short FGetLittleShort(fileHandle_t f) {
+static short FGetLittleShort(snd_stream_t *f) {
 	short v;
 
-	FS_Read(&v, sizeof(v), f);
+	S_CodecUtilRead(f, &v, sizeof(v));
 
 	return LittleShort(v);
 }
@@ -55,12 +55,12 @@ static short FGetLittleShort(fileHandle_t f) {
 S_ReadChunkInfo
 =================
 */
-static int S_ReadChunkInfo(fileHandle_t f, char *name) {
+static int S_ReadChunkInfo(snd_stream_t *f, char *name) {
 	int len, r;
 
 	name[4] = 0;
 
-	r = FS_Read(name, 4, f);
+	r = S_CodecUtilRead(f, name, 4);
 	if (r != 4)
 		return -1;
 
@@ -80,7 +80,7 @@ S_FindRIFFChunk
 Returns the length of the data in the chunk, or -1 if not found
 =================
 */
-static int S_FindRIFFChunk(fileHandle_t f, char *chunk) {
+static int S_FindRIFFChunk(snd_stream_t *f, char *chunk) {
 	char name[5];
 	int len;
 
@@ -92,7 +92,7 @@ static int S_FindRIFFChunk(fileHandle_t f, char *chunk) {
 		len = PAD(len, 2);
 
 		// Not the right chunk - skip it
-		FS_Seek(f, len, FS_SEEK_CUR);
+		S_CodecUtilSeek(f, len, FS_SEEK_CUR);
 	}
 
 	return -1;
@@ -126,13 +126,13 @@ static void S_ByteSwapRawSamples(int samples, int width, int s_channels, const b
 S_ReadRIFFHeader
 =================
 */
-static qboolean S_ReadRIFFHeader(fileHandle_t file, snd_info_t *info) {
+static qboolean S_ReadRIFFHeader(snd_stream_t *file, snd_info_t *info) {
 	char dump[16];
 	int bits;
 	int fmtlen = 0;
 
 	// skip the riff wav header
-	FS_Read(dump, 12, file);
+	S_CodecUtilRead(file, dump, 12);
 
 	// Scan for the format chunk
 	if ((fmtlen = S_FindRIFFChunk(file, "fmt ")) < 0) {
@@ -159,7 +159,7 @@ static qboolean S_ReadRIFFHeader(fileHandle_t file, snd_info_t *info) {
 	// Skip the rest of the format chunk if required
 	if (fmtlen > 16) {
 		fmtlen -= 16;
-		FS_Seek(file, fmtlen, FS_SEEK_CUR);
+		S_CodecUtilSeek(file, fmtlen, FS_SEEK_CUR);
 	}
 
 	// Scan for the data chunk
@@ -182,18 +182,18 @@ S_WAV_CodecLoad
 =================
 */
 void *S_WAV_CodecLoad(const char *filename, snd_info_t *info) {
-	fileHandle_t file;
+	snd_stream_t *file;
 	void *buffer;
 
 	// Try to open the file
-	FS_FOpenFileRead(filename, &file, qtrue);
+	file = S_CodecUtilOpen(filename, &wav_codec);
 	if (!file) {
 		return NULL;
 	}
 
 	// Read the RIFF header
 	if (!S_ReadRIFFHeader(file, info)) {
-		FS_FCloseFile(file);
+		S_CodecUtilClose(&file);
 		Com_Printf(S_COLOR_RED "ERROR: Incorrect/unsupported format in \"%s\"\n", filename);
 		return NULL;
 	}
@@ -201,17 +201,17 @@ void *S_WAV_CodecLoad(const char *filename, snd_info_t *info) {
 	// Allocate some memory
 	buffer = Hunk_AllocateTempMemory(info->size);
 	if (!buffer) {
-		FS_FCloseFile(file);
+		S_CodecUtilClose(&file);
 		Com_Printf(S_COLOR_RED "ERROR: Out of memory reading \"%s\"\n", filename);
 		return NULL;
 	}
 
 	// Read, byteswap
-	FS_Read(buffer, info->size, file);
+	S_CodecUtilRead(file, buffer, info->size);
 	S_ByteSwapRawSamples(info->samples, info->width, info->channels, (byte *)buffer);
 
 	// Close and return
-	FS_FCloseFile(file);
+	S_CodecUtilClose(&file);
 	return buffer;
 }
 
@@ -229,7 +229,7 @@ snd_stream_t *S_WAV_CodecOpenStream(const char *filename) {
 		return NULL;
 
 	// Read the RIFF header
-	if (!S_ReadRIFFHeader(rv->file, &rv->info)) {
+	if (!S_ReadRIFFHeader(rv, &rv->info)) {
 		S_CodecUtilClose(&rv);
 		return NULL;
 	}
@@ -261,7 +261,7 @@ int S_WAV_CodecReadStream(snd_stream_t *stream, int bytes, void *buffer) {
 		bytes = remaining;
 	stream->pos += bytes;
 	samples = (bytes / stream->info.width) / stream->info.channels;
-	FS_Read(buffer, bytes, stream->file);
+	S_CodecUtilRead(stream, buffer, bytes);
 	S_ByteSwapRawSamples(samples, stream->info.width, stream->info.channels, buffer);
 	return bytes;
 }
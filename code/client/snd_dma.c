@@ -34,6 +34,10 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "client.h"
 
 void S_Update_(void);
+static void S_OpenSoundStream(channel_t *ch, sfx_t *sfx);
+static void S_UpdateSoundStreams(void);
+static void S_CloseSoundStreams(void);
+static void S_MixAhead(int thisTime, qboolean mixThread);
 void S_Base_StopAllSounds(void);
 void S_Base_StopBackgroundTrack(void);
 
@@ -76,11 +80,29 @@ int s_numSfx = 0;
 static sfx_t *sfxHash[LOOP_HASH];
 
 cvar_t *s_testsound;
+cvar_t *s_mixSIMD;
 cvar_t *s_show;
 cvar_t *s_mixahead;
 cvar_t *s_mixPreStep;
+cvar_t *s_mixThread;
+cvar_t *s_streamSize;
+cvar_t *s_loadThreads;
+
+sndStream_t s_soundStreams[MAX_SOUND_STREAMS];
 
 static loopSound_t loopSounds[MAX_GENTITIES];
+
+// mixing on its own thread, woken by the audio callback
+typedef struct {
+	sysThread_t *thread;
+	sysMutex_t *lock; // held by the game thread in every sound call and by the mixer while painting
+	sysMutex_t *wakeLock;
+	sysCond_t *wake;
+	qboolean pending; // the callback took samples since the last mix
+	qboolean quit;
+} mixThread_t;
+
+static mixThread_t s_mixer;
 static channel_t *freelist = NULL;
 
 int s_rawend[MAX_RAW_STREAMS];
@@ -101,6 +123,7 @@ void S_Base_SoundInfo(void) {
 		Com_Printf("%5d submission_chunk\n", dma.submission_chunk);
 		Com_Printf("%5d speed\n", dma.speed);
 		Com_Printf("%p dma buffer\n", dma.buffer);
+		Com_Printf("%s mixer\n", S_MixerName());
 		if (s_backgroundStream) {
 			Com_Printf("Background file: %s\n", s_backgroundLoop);
 		} else {
@@ -154,9 +177,11 @@ void S_Base_SoundList(void) {
 	for (sfx = s_knownSfx, i = 0; i < s_numSfx; i++, sfx++) {
 		size = sfx->soundLength;
 		total += size;
-		Com_Printf("%6i[%s] : %s[%s]\n", size, type[sfx->soundCompressionMethod], sfx->soundName, mem[sfx->inMemory]);
+		Com_Printf("%6i[%s] : %s[%s]\n", size, type[sfx->soundCompressionMethod], sfx->soundName,
+				   sfx->streamed ? "streamed " : mem[sfx->inMemory]);
 	}
 	Com_Printf("Total resident: %i\n", total);
+	S_SoundLoadInfo();
 	S_DisplayFreeMemory();
 }
 
@@ -343,7 +368,7 @@ sfxHandle_t S_Base_RegisterSound(const char *name, qboolean compressed) {
 		return 0;
 	}
 
-	if (sfx->soundData) {
+	if (sfx->soundData || sfx->streamed || sfx->pending) {
 		if (sfx->defaultSound) {
 			Com_Printf(S_COLOR_YELLOW "WARNING: could not find %s - using default\n", sfx->soundName);
 			return 0;
@@ -354,7 +379,10 @@ sfxHandle_t S_Base_RegisterSound(const char *name, qboolean compressed) {
 	sfx->inMemory = qfalse;
 	sfx->soundCompressed = compressed;
 
-	S_memoryLoad(sfx);
+	// decoded on s_loadThreads when registration is over
+	if (s_loadThreads->integer <= 0 || !S_QueueSound(sfx)) {
+		S_memoryLoad(sfx);
+	}
 
 	if (sfx->defaultSound) {
 		Com_Printf(S_COLOR_YELLOW "WARNING: could not find %s - using default\n", sfx->soundName);
@@ -384,6 +412,11 @@ void S_Base_BeginRegistration(void) {
 }
 
 void S_memoryLoad(sfx_t *sfx) {
+	if (sfx->pending) {
+		S_FinishSoundLoads();
+		return;
+	}
+
 	// load the sound file
 	if (!S_LoadSound(sfx)) {
 		//		Com_Printf( S_COLOR_YELLOW "WARNING: couldn't load sound: %s\n", sfx->soundName );
@@ -618,6 +651,11 @@ static void S_Base_StartSoundEx(vec3_t origin, int entityNum, int entchannel, sf
 	ch->rightvol = ch->master_vol; // unless the game isn't running
 	ch->doppler = qfalse;
 	ch->fullVolume = fullVolume;
+	ch->stream = 0;
+
+	if (sfx->streamed) {
+		S_OpenSoundStream(ch, sfx);
+	}
 }
 
 /*
@@ -696,6 +734,8 @@ void S_Base_StopAllSounds(void) {
 	// stop the background music
 	S_Base_StopBackgroundTrack();
 
+	S_CloseSoundStreams();
+
 	S_Base_ClearSoundBuffer();
 }
 
@@ -755,6 +795,12 @@ void S_Base_AddLoopingSound(int entityNum, const vec3_t origin, const vec3_t vel
 		S_memoryLoad(sfx);
 	}
 
+	// loops wrap around, which a stream can't
+	if (sfx->streamed) {
+		sfx->resident = qtrue;
+		S_memoryLoad(sfx);
+	}
+
 	if (!sfx->soundLength) {
 		Com_Error(ERR_DROP, "%s has length 0", sfx->soundName);
 	}
@@ -818,6 +864,12 @@ void S_Base_AddRealLoopingSound(int entityNum, const vec3_t origin, const vec3_t
 		S_memoryLoad(sfx);
 	}
 
+	// loops wrap around, which a stream can't
+	if (sfx->streamed) {
+		sfx->resident = qtrue;
+		S_memoryLoad(sfx);
+	}
+
 	if (!sfx->soundLength) {
 		Com_Error(ERR_DROP, "%s has length 0", sfx->soundName);
 	}
@@ -1166,6 +1218,9 @@ void S_Base_Update(void) {
 		return;
 	}
 
+	// registration is over once frames are running
+	S_FinishSoundLoads();
+
 	//
 	// debugging output
 	//
@@ -1185,8 +1240,15 @@ void S_Base_Update(void) {
 	// add raw data from streamed samples
 	S_UpdateBackgroundTrack();
 
-	// mix some sound
-	S_Update_();
+	// decode ahead for streamed sfx
+	S_UpdateSoundStreams();
+
+	// mix some sound, video recording paces the mix by frames
+	if (!s_mixer.thread || CL_VideoRecording()) {
+		PROFILE_BEGIN("S_Update_");
+		S_Update_();
+		PROFILE_END();
+	}
 }
 
 void S_GetSoundtime(void) {
@@ -1214,7 +1276,11 @@ void S_GetSoundtime(void) {
 		if (s_paintedtime > 0x40000000) { // time to chop things off to avoid 32 bit limits
 			buffers = 0;
 			s_paintedtime = dma.fullsamples;
-			S_Base_StopAllSounds();
+			// the background stream is the game thread's to close
+			if (s_mixer.thread)
+				S_Base_ClearSoundBuffer();
+			else
+				S_Base_StopAllSounds();
 		}
 	}
 	oldsamplepos = samplepos;
@@ -1238,17 +1304,27 @@ void S_GetSoundtime(void) {
 }
 
 void S_Update_(void) {
-	unsigned endtime;
-	static float lastTime = 0.0f;
-	float ma, op;
-	float thisTime, sane;
-	static int ot = -1;
-
 	if (!s_soundStarted || s_soundMuted) {
 		return;
 	}
 
-	thisTime = Com_Milliseconds();
+	S_MixAhead(Com_Milliseconds(), qfalse);
+}
+
+/*
+============
+S_MixAhead
+
+The mixer thread is woken for every callback instead of once a frame, so
+it mixes the full s_mixahead and doesn't scale it by the frame time.
+============
+*/
+static void S_MixAhead(int thisTime, qboolean mixThread) {
+	unsigned endtime;
+	static float lastTime = 0.0f;
+	float ma, op;
+	float sane;
+	static int ot = -1;
 
 	// Updates s_soundtime
 	S_GetSoundtime();
@@ -1270,7 +1346,7 @@ void S_Update_(void) {
 	ma = s_mixahead->value * dma.speed;
 	op = s_mixPreStep->value + sane * dma.speed * 0.01;
 
-	if (op < ma) {
+	if (op < ma && !mixThread) {
 		ma = op;
 	}
 
@@ -1432,6 +1508,158 @@ void S_UpdateBackgroundTrack(void) {
 	}
 }
 
+/*
+===============================================================================
+
+streamed sfx
+
+===============================================================================
+*/
+
+/*
+======================
+S_ChannelStream
+
+The stream a channel plays from, NULL once the channel has been freed or
+reused for something else.
+======================
+*/
+sndStream_t *S_ChannelStream(const channel_t *ch) {
+	sndStream_t *s;
+
+	if (ch->stream <= 0 || ch->stream > MAX_SOUND_STREAMS) {
+		return NULL;
+	}
+
+	s = &s_soundStreams[ch->stream - 1];
+	if (!s->stream || s->ch != ch || s->sfx != ch->thesfx) {
+		return NULL;
+	}
+
+	return s;
+}
+
+/*
+======================
+S_DecodeSoundStream
+
+Keeps a second decoded past what the mixer has read; the second behind it
+stays in the ring for the mixer to paint again.
+======================
+*/
+static void S_DecodeSoundStream(sndStream_t *s) {
+	byte raw[16384];
+	int frameBytes, frames, pos, r, i;
+	short *dst;
+
+	frameBytes = s->stream->info.width * s->channels;
+
+	while (!s->eof) {
+		frames = s->played + s->ringFrames / 2 - s->decoded;
+		if (frames <= 0) {
+			break;
+		}
+
+		pos = s->decoded % s->ringFrames;
+		frames = MIN(frames, s->ringFrames - pos);
+		frames = MIN(frames, sizeof(raw) / frameBytes);
+
+		r = S_CodecReadStream(s->stream, frames * frameBytes, raw) / frameBytes;
+		if (r <= 0) {
+			s->eof = qtrue;
+			break;
+		}
+
+		dst = s->ring + pos * s->channels;
+		if (s->stream->info.width == 2) {
+			Com_Memcpy(dst, raw, r * frameBytes);
+		} else {
+			for (i = 0; i < r * s->channels; i++) {
+				dst[i] = (raw[i] - 128) << 8;
+			}
+		}
+
+		s->decoded += r;
+	}
+}
+
+static void S_CloseSoundStream(sndStream_t *s) {
+	if (s->stream) {
+		S_CodecCloseStream(s->stream);
+	}
+	if (s->ring) {
+		Z_Free(s->ring);
+	}
+	Com_Memset(s, 0, sizeof(*s));
+}
+
+/*
+======================
+S_OpenSoundStream
+
+Starts decoding sfx for ch.  Without a free stream the channel stays silent.
+======================
+*/
+static void S_OpenSoundStream(channel_t *ch, sfx_t *sfx) {
+	sndStream_t *s;
+	int i;
+
+	for (i = 0, s = s_soundStreams; i < MAX_SOUND_STREAMS; i++, s++) {
+		if (s->stream && S_ChannelStream(s->ch) != s) {
+			S_CloseSoundStream(s);
+		}
+		if (!s->stream) {
+			break;
+		}
+	}
+
+	if (i == MAX_SOUND_STREAMS) {
+		Com_DPrintf(S_COLOR_YELLOW "WARNING: no free stream for %s\n", sfx->soundName);
+		return;
+	}
+
+	s->stream = S_CodecOpenStream(sfx->soundName);
+	if (!s->stream) {
+		return;
+	}
+
+	s->ch = ch;
+	s->sfx = sfx;
+	s->channels = s->stream->info.channels;
+	s->rate = s->stream->info.rate;
+	s->ringFrames = s->rate * 2;
+	s->ring = Z_Malloc(s->ringFrames * s->channels * sizeof(short));
+
+	ch->stream = i + 1;
+
+	S_DecodeSoundStream(s);
+}
+
+static void S_UpdateSoundStreams(void) {
+	sndStream_t *s;
+	int i;
+
+	for (i = 0, s = s_soundStreams; i < MAX_SOUND_STREAMS; i++, s++) {
+		if (!s->stream) {
+			continue;
+		}
+
+		if (S_ChannelStream(s->ch) != s) {
+			S_CloseSoundStream(s);
+		} else {
+			S_DecodeSoundStream(s);
+		}
+	}
+}
+
+static void S_CloseSoundStreams(void) {
+	int i;
+
+	for (i = 0; i < MAX_SOUND_STREAMS; i++) {
+		S_CloseSoundStream(&s_soundStreams[i]);
+	}
+}
+
 /*
 ======================
 S_FreeOldestSound
@@ -1448,7 +1676,7 @@ void S_FreeOldestSound(void) {
 
 	for (i = 1; i < s_numSfx; i++) {
 		sfx = &s_knownSfx[i];
-		if (sfx->inMemory && sfx->lastTimeUsed < oldest) {
+		if (sfx->inMemory && !sfx->streamed && sfx->lastTimeUsed < oldest) {
 			used = i;
 			oldest = sfx->lastTimeUsed;
 		}
@@ -1468,6 +1696,251 @@ void S_FreeOldestSound(void) {
 	sfx->soundData = NULL;
 }
 
+/*
+===============================================================================
+
+MIXER THREAD
+
+With s_mixThread the mixing moves off the game thread, so a long frame
+doesn't let the device buffer run dry and s_mixahead can be kept short.
+The sound calls below take the mixer lock for their duration instead of
+touching the channels under the mixer's feet.
+===============================================================================
+*/
+
+/*
+=================
+S_MixThreadWake
+
+Called from the audio callback after it takes samples from the buffer.
+=================
+*/
+void S_MixThreadWake(void) {
+	if (!s_mixer.thread) {
+		return;
+	}
+
+	Sys_LockMutex(s_mixer.wakeLock);
+	s_mixer.pending = qtrue;
+	Sys_SignalCond(s_mixer.wake);
+	Sys_UnlockMutex(s_mixer.wakeLock);
+}
+
+static void S_MixThread(void *data) {
+	mixThread_t *m = data;
+
+	while (1) {
+		Sys_LockMutex(m->wakeLock);
+		while (!m->pending && !m->quit) {
+			Sys_WaitCond(m->wake, m->wakeLock);
+		}
+		m->pending = qfalse;
+		if (m->quit) {
+			Sys_UnlockMutex(m->wakeLock);
+			break;
+		}
+		Sys_UnlockMutex(m->wakeLock);
+
+		Sys_LockMutex(m->lock);
+		if (s_soundStarted && !s_soundMuted && !CL_VideoRecording()) {
+			S_MixAhead(Sys_Milliseconds(), qtrue);
+		}
+		Sys_UnlockMutex(m->lock);
+	}
+}
+
+static void S_StartMixThread(void) {
+	s_mixer.lock = Sys_CreateMutex();
+	s_mixer.wakeLock = Sys_CreateMutex();
+	s_mixer.wake = Sys_CreateCond();
+	s_mixer.pending = qfalse;
+	s_mixer.quit = qfalse;
+
+	if (s_mixer.lock && s_mixer.wakeLock && s_mixer.wake) {
+		s_mixer.thread = Sys_CreateThread(S_MixThread, &s_mixer);
+	}
+
+	if (!s_mixer.thread) {
+		Com_Printf(S_COLOR_YELLOW "WARNING: couldn't start the mixer thread, mixing every frame\n");
+		S_StopMixThread();
+	}
+}
+
+void S_StopMixThread(void) {
+	if (s_mixer.thread) {
+		Sys_LockMutex(s_mixer.wakeLock);
+		s_mixer.quit = qtrue;
+		Sys_SignalCond(s_mixer.wake);
+		Sys_UnlockMutex(s_mixer.wakeLock);
+
+		Sys_JoinThread(s_mixer.thread);
+		s_mixer.thread = NULL;
+	}
+
+	if (s_mixer.wake) {
+		Sys_DestroyCond(s_mixer.wake);
+	}
+	if (s_mixer.wakeLock) {
+		Sys_DestroyMutex(s_mixer.wakeLock);
+	}
+	if (s_mixer.lock) {
+		Sys_DestroyMutex(s_mixer.lock);
+	}
+	Com_Memset(&s_mixer, 0, sizeof(s_mixer));
+}
+
+#define S_LOCK() Sys_LockMutex(s_mixer.lock)
+#define S_UNLOCK() Sys_UnlockMutex(s_mixer.lock)
+
+static void S_Locked_StartSound(vec3_t origin, int entnum, int entchannel, sfxHandle_t sfx) {
+	S_LOCK();
+	S_Base_StartSound(origin, entnum, entchannel, sfx);
+	S_UNLOCK();
+}
+
+static void S_Locked_StartLocalSound(sfxHandle_t sfx, int channelNum) {
+	S_LOCK();
+	S_Base_StartLocalSound(sfx, channelNum);
+	S_UNLOCK();
+}
+
+static void S_Locked_StartBackgroundTrack(const char *intro, const char *loop) {
+	S_LOCK();
+	S_Base_StartBackgroundTrack(intro, loop);
+	S_UNLOCK();
+}
+
+static void S_Locked_StopBackgroundTrack(void) {
+	S_LOCK();
+	S_Base_StopBackgroundTrack();
+	S_UNLOCK();
+}
+
+static void S_Locked_RawSamples(int stream, int samples, int rate, int width, int channels, const byte *data,
+								float volume, int entityNum) {
+	S_LOCK();
+	S_Base_RawSamples(stream, samples, rate, width, channels, data, volume, entityNum);
+	S_UNLOCK();
+}
+
+static void S_Locked_StopAllSounds(void) {
+	S_LOCK();
+	S_Base_StopAllSounds();
+	S_UNLOCK();
+}
+
+static void S_Locked_ClearLoopingSounds(qboolean killall) {
+	S_LOCK();
+	S_Base_ClearLoopingSounds(killall);
+	S_UNLOCK();
+}
+
+static void S_Locked_AddLoopingSound(int entityNum, const vec3_t origin, const vec3_t velocity, sfxHandle_t sfx) {
+	S_LOCK();
+	S_Base_AddLoopingSound(entityNum, origin, velocity, sfx);
+	S_UNLOCK();
+}
+
+static void S_Locked_AddRealLoopingSound(int entityNum, const vec3_t origin, const vec3_t velocity,
+										 sfxHandle_t sfx) {
+	S_LOCK();
+	S_Base_AddRealLoopingSound(entityNum, origin, velocity, sfx);
+	S_UNLOCK();
+}
+
+static void S_Locked_StopLoopingSound(int entityNum) {
+	S_LOCK();
+	S_Base_StopLoopingSound(entityNum);
+	S_UNLOCK();
+}
+
+static void S_Locked_Respatialize(int entityNum, const vec3_t origin, vec3_t axis[3], int inwater) {
+	S_LOCK();
+	S_Base_Respatialize(entityNum, origin, axis, inwater);
+	S_UNLOCK();
+}
+
+static void S_Locked_UpdateEntityPosition(int entityNum, const vec3_t origin) {
+	S_LOCK();
+	S_Base_UpdateEntityPosition(entityNum, origin);
+	S_UNLOCK();
+}
+
+static void S_Locked_Update(void) {
+	S_LOCK();
+	S_Base_Update();
+	S_UNLOCK();
+}
+
+static void S_Locked_DisableSounds(void) {
+	S_LOCK();
+	S_Base_DisableSounds();
+	S_UNLOCK();
+}
+
+static void S_Locked_BeginRegistration(void) {
+	S_LOCK();
+	S_Base_BeginRegistration();
+	S_UNLOCK();
+}
+
+static sfxHandle_t S_Locked_RegisterSound(const char *sample, qboolean compressed) {
+	sfxHandle_t h;
+
+	S_LOCK();
+	h = S_Base_RegisterSound(sample, compressed);
+	S_UNLOCK();
+
+	return h;
+}
+
+static void S_Locked_ClearSoundBuffer(void) {
+	S_LOCK();
+	S_Base_ClearSoundBuffer();
+	S_UNLOCK();
+}
+
+static void S_Locked_SoundList(void) {
+	S_LOCK();
+	S_Base_SoundList();
+	S_UNLOCK();
+}
+
+/*
+=================
+S_InstallMixThread
+
+Starts the mixer and routes the sound calls through the lock.
+=================
+*/
+static void S_InstallMixThread(soundInterface_t *si) {
+	S_StartMixThread();
+	if (!s_mixer.thread) {
+		return;
+	}
+
+	si->StartSound = S_Locked_StartSound;
+	si->StartLocalSound = S_Locked_StartLocalSound;
+	si->StartBackgroundTrack = S_Locked_StartBackgroundTrack;
+	si->StopBackgroundTrack = S_Locked_StopBackgroundTrack;
+	si->RawSamples = S_Locked_RawSamples;
+	si->StopAllSounds = S_Locked_StopAllSounds;
+	si->ClearLoopingSounds = S_Locked_ClearLoopingSounds;
+	si->AddLoopingSound = S_Locked_AddLoopingSound;
+	si->AddRealLoopingSound = S_Locked_AddRealLoopingSound;
+	si->StopLoopingSound = S_Locked_StopLoopingSound;
+	si->Respatialize = S_Locked_Respatialize;
+	si->UpdateEntityPosition = S_Locked_UpdateEntityPosition;
+	si->Update = S_Locked_Update;
+	si->DisableSounds = S_Locked_DisableSounds;
+	si->BeginRegistration = S_Locked_BeginRegistration;
+	si->RegisterSound = S_Locked_RegisterSound;
+	si->ClearSoundBuffer = S_Locked_ClearSoundBuffer;
+	si->SoundList = S_Locked_SoundList;
+
+	Com_Printf("Mixing on its own thread\n");
+}
+
 // =======================================================================
 // Shutdown sound engine
 // =======================================================================
@@ -1477,6 +1950,9 @@ void S_Base_Shutdown(void) {
 		return;
 	}
 
+	S_StopMixThread();
+	S_FinishSoundLoads();
+	S_CloseSoundStreams();
 	SNDDMA_Shutdown();
 	SND_shutdown();
 
@@ -1502,6 +1978,19 @@ qboolean S_Base_Init(soundInterface_t *si) {
 	s_mixPreStep = Cvar_Get("s_mixPreStep", "0.05", CVAR_ARCHIVE);
 	s_show = Cvar_Get("s_show", "0", CVAR_CHEAT);
 	s_testsound = Cvar_Get("s_testsound", "0", CVAR_CHEAT);
+	s_mixThread = Cvar_Get("s_mixThread", "0", CVAR_ARCHIVE | CVAR_LATCH);
+	Cvar_SetDescription(s_mixThread, "Mix on a separate thread driven by the audio device, so long frames don't "
+									 "underrun; s_mixahead then only needs to cover a couple of device periods");
+	s_streamSize = Cvar_Get("s_streamSize", "512", CVAR_ARCHIVE);
+	Cvar_SetDescription(s_streamSize, "Sounds that decode to more than this many KB are decoded while they play "
+									  "instead of being loaded whole, 0 loads everything");
+	s_loadThreads = Cvar_Get("s_loadThreads", "4", CVAR_ARCHIVE);
+	Cvar_SetDescription(s_loadThreads, "Number of threads that decode the sounds registered during a map load, "
+									   "0 decodes each one as it is registered");
+	s_mixSIMD = Cvar_Get("s_mixSIMD", "1", CVAR_ARCHIVE | CVAR_LATCH);
+	Cvar_SetDescription(s_mixSIMD, "Mix with SSE2, AVX2 or NEON when the CPU has them");
+
+	S_InitMixer();
 
 	r = SNDDMA_Init();
 
@@ -1549,5 +2038,9 @@ qboolean S_Base_Init(soundInterface_t *si) {
 	si->MasterGain = S_Base_MasterGain;
 #endif
 
+	if (s_mixThread->integer) {
+		S_InstallMixThread(si);
+	}
+
 	return qtrue;
 }
@@ -58,6 +58,9 @@ typedef struct sfx_s {
 	int soundChannels;
 	char soundName[MAX_QPATH];
 	int lastTimeUsed;
+	qboolean streamed; // over s_streamSize, decoded while it plays
+	qboolean resident; // used as a loop, always loaded whole
+	qboolean pending;  // queued for S_FinishSoundLoads
 	struct sfx_s *next;
 } sfx_t;
 
@@ -106,8 +109,26 @@ typedef struct {
 	sfx_t *thesfx;		   // sfx structure
 	qboolean doppler;
 	qboolean fullVolume;
+	int stream; // 1 + index in s_soundStreams for streamed sfx, else 0
 } channel_t;
 
+// a streamed sfx being played, decoded ahead into a ring at the file's rate
+// by the game thread and resampled as the mixer reads it
+#define MAX_SOUND_STREAMS 8
+
+typedef struct {
+	channel_t *ch;
+	sfx_t *sfx;
+	struct snd_stream_s *stream;
+	short *ring;	// interleaved frames
+	int ringFrames; // capacity
+	int channels;
+	int rate;
+	int decoded; // frames decoded since the start, the ring ends here
+	int played;	 // furthest frame the mixer has read
+	qboolean eof;
+} sndStream_t;
+
 #define WAV_FORMAT_PCM 1
 
 typedef struct {
@@ -205,14 +226,28 @@ extern cvar_t *s_muted;
 extern cvar_t *s_doppler;
 
 extern cvar_t *s_testsound;
+extern cvar_t *s_mixSIMD;
+extern cvar_t *s_mixThread;
+extern cvar_t *s_streamSize;
+extern cvar_t *s_loadThreads;
+
+extern sndStream_t s_soundStreams[MAX_SOUND_STREAMS];
 
 qboolean S_LoadSound(sfx_t *sfx);
+qboolean S_QueueSound(sfx_t *sfx);
+void S_FinishSoundLoads(void);
+void S_SoundLoadInfo(void);
+sndStream_t *S_ChannelStream(const channel_t *ch);
 
 void SND_free(sndBuffer *v);
 sndBuffer *SND_malloc(void);
 void SND_setup(void);
 void SND_shutdown(void);
 
+void S_InitMixer(void);
+void S_MixThreadWake(void);
+void S_StopMixThread(void);
+const char *S_MixerName(void);
 void S_PaintChannels(int endtime);
 
 void S_memoryLoad(sfx_t *sfx);
@@ -259,6 +294,39 @@ typedef int srcHandle_t;
 
 qboolean S_AL_Init(soundInterface_t *si);
 
+// snd_simd.c
+#if idx64 || defined(__i386__) || defined(_M_IX86)
+#define SND_SIMD_X86 1
+#else
+#define SND_SIMD_X86 0
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define SND_SIMD_NEON 1
+#else
+#define SND_SIMD_NEON 0
+#endif
+
+// add count samples times volume >> 8 into the paint buffer
+typedef void (*sndPaint16_t)(portable_samplepair_t *samp, const short *samples, int count, int leftvol, int rightvol);
+// >> 8 and clamp count paint buffer values to 16 bits
+typedef void (*sndWriteBlast_t)(short *out, const int *in, int count);
+
+#if SND_SIMD_X86
+void S_PaintMono16_sse2(portable_samplepair_t *samp, const short *samples, int count, int leftvol, int rightvol);
+void S_PaintStereo16_sse2(portable_samplepair_t *samp, const short *samples, int count, int leftvol, int rightvol);
+void S_WriteLinearBlastStereo16_sse2(short *out, const int *in, int count);
+void S_PaintMono16_avx2(portable_samplepair_t *samp, const short *samples, int count, int leftvol, int rightvol);
+void S_PaintStereo16_avx2(portable_samplepair_t *samp, const short *samples, int count, int leftvol, int rightvol);
+void S_WriteLinearBlastStereo16_avx2(short *out, const int *in, int count);
+#endif
+
+#if SND_SIMD_NEON
+void S_PaintMono16_neon(portable_samplepair_t *samp, const short *samples, int count, int leftvol, int rightvol);
+void S_PaintStereo16_neon(portable_samplepair_t *samp, const short *samples, int count, int leftvol, int rightvol);
+void S_WriteLinearBlastStereo16_neon(short *out, const int *in, int count);
+#endif
+
 #ifdef idppc_altivec
 void S_PaintChannelFrom16_altivec(portable_samplepair_t paintbuffer[PAINTBUFFER_SIZE], int snd_vol, channel_t *ch,
 								  const sfx_t *sc, int count, int sampleOffset, int bufferOffset);
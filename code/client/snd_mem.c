@@ -46,6 +46,7 @@ static sndBuffer *buffer = NULL;
 static sndBuffer *freelist = NULL;
 static int inUse = 0;
 static int totalInUse = 0;
+static int bufferSize = 0;
 
 short *sfxScratchBuffer = NULL;
 sfx_t *sfxScratchPointer = NULL;
@@ -55,6 +56,7 @@ void SND_free(sndBuffer *v) {
 	*(sndBuffer **)v = freelist;
 	freelist = (sndBuffer *)v;
 	inUse += sizeof(sndBuffer);
+	Com_MemAccount(MEMOWNER_SOUND, -(int)sizeof(sndBuffer));
 }
 
 sndBuffer *SND_malloc(void) {
@@ -67,6 +69,7 @@ redo:
 
 	inUse -= sizeof(sndBuffer);
 	totalInUse += sizeof(sndBuffer);
+	Com_MemAccount(MEMOWNER_SOUND, sizeof(sndBuffer));
 
 	v = freelist;
 	freelist = *(sndBuffer **)freelist;
@@ -88,7 +91,7 @@ void SND_setup(void) {
 	sfxScratchBuffer = malloc(SND_CHUNK_SIZE * sizeof(short) * 4); // Hunk_Alloc(SND_CHUNK_SIZE * sizeof(short) * 4);
 	sfxScratchPointer = NULL;
 
-	inUse = scs * sizeof(sndBuffer);
+	inUse = bufferSize = scs * sizeof(sndBuffer);
 	p = buffer;
 	;
 	q = p + scs;
@@ -102,6 +105,10 @@ void SND_setup(void) {
 }
 
 void SND_shutdown(void) {
+	// chunks still held by cached sounds go away with the buffer
+	Com_MemAccount(MEMOWNER_SOUND, inUse - bufferSize);
+	bufferSize = inUse = 0;
+
 	free(sfxScratchBuffer);
 	free(buffer);
 }
@@ -163,9 +170,10 @@ static int ResampleSfx(sfx_t *sfx, int channels, int inrate, int inwidth, int sa
 
 /*
 ================
-ResampleSfx
+ResampleSfxRaw
 
-resample / decimate to the current source rate
+resample / decimate to the current source rate, the codecs already
+return native byte order
 ================
 */
 static int ResampleSfxRaw(short *sfx, int channels, int inrate, int inwidth, int samples, byte *data) {
@@ -189,7 +197,7 @@ static int ResampleSfxRaw(short *sfx, int channels, int inrate, int inwidth, int
 		samplefrac += fracstep;
 		for (j = 0; j < channels; j++) {
 			if (inwidth == 2) {
-				sample = LittleShort(((short *)data)[srcsample + j]);
+				sample = ((short *)data)[srcsample + j];
 			} else {
 				sample = (int)((unsigned char)(data[srcsample + j]) - 128) << 8;
 			}
@@ -201,6 +209,32 @@ static int ResampleSfxRaw(short *sfx, int channels, int inrate, int inwidth, int
 
 //=============================================================================
 
+/*
+==============
+S_StreamSfx
+
+Marks sfx as streamed if it decodes to more than s_streamSize
+==============
+*/
+static qboolean S_StreamSfx(sfx_t *sfx, const snd_info_t *info) {
+	if (s_streamSize->integer <= 0 || sfx->resident) {
+		return qfalse;
+	}
+
+	if ((info->channels != 1 && info->channels != 2) || info->rate <= 0 ||
+		info->samples * info->channels * 2 <= s_streamSize->integer * 1024) {
+		return qfalse;
+	}
+
+	sfx->streamed = qtrue;
+	sfx->soundCompressionMethod = 0;
+	sfx->soundData = NULL;
+	sfx->soundLength = (int64_t)info->samples * dma.speed / info->rate;
+	sfx->soundChannels = info->channels;
+	sfx->lastTimeUsed = Com_Milliseconds() + 1;
+	return qtrue;
+}
+
 /*
 ==============
 S_LoadSound
@@ -215,6 +249,24 @@ qboolean S_LoadSound(sfx_t *sfx) {
 	snd_info_t info;
 	//	int		size;
 
+	sfx->streamed = qfalse;
+
+	// big sounds are only measured here and decoded as they play
+	if (s_streamSize->integer > 0 && !sfx->resident) {
+		snd_stream_t *stream = S_CodecOpenStream(sfx->soundName);
+
+		if (!stream) {
+			return qfalse;
+		}
+
+		info = stream->info;
+		S_CodecCloseStream(stream);
+
+		if (S_StreamSfx(sfx, &info)) {
+			return qtrue;
+		}
+	}
+
 	// load it in
 	data = S_CodecLoad(sfx->soundName, &info);
 	if (!data)
@@ -271,6 +323,248 @@ qboolean S_LoadSound(sfx_t *sfx) {
 	return qtrue;
 }
 
+/*
+===============================================================================
+
+queued loads
+
+S_QueueSound reads the file and parses its header on the main thread, the
+decode and resample are left to S_FinishSoundLoads, which spreads them
+over s_loadThreads.
+
+===============================================================================
+*/
+
+#define MAX_QUEUED_SOUNDS 1024
+#define MAX_LOAD_FORMATS 8
+
+typedef struct {
+	sfx_t *sfx;
+	snd_stream_t *stream;
+	short *samples; // malloc'd by the job
+	int length;
+	int64_t usec;
+} sndLoad_t;
+
+typedef struct {
+	const char *ext;
+	int count;
+	int64_t bytes;
+	int64_t usec;
+} sndLoadFormat_t;
+
+static sndLoad_t s_loads[MAX_QUEUED_SOUNDS];
+static int s_numLoads;
+
+static sndLoadFormat_t s_loadFormats[MAX_LOAD_FORMATS];
+static int s_lastLoadCount;
+static int64_t s_lastLoadUsec;
+
+/*
+==============
+S_QueueSound
+
+Returns qfalse if sfx has to be loaded with S_LoadSound instead
+==============
+*/
+qboolean S_QueueSound(sfx_t *sfx) {
+	snd_stream_t *stream;
+	sndLoad_t *load;
+
+	if (sfx->soundCompressed) {
+		return qfalse;
+	}
+
+	if (s_numLoads == MAX_QUEUED_SOUNDS) {
+		S_FinishSoundLoads();
+	}
+
+	stream = S_CodecOpenMemoryStream(sfx->soundName);
+	if (!stream) {
+		return qfalse;
+	}
+
+	if (!S_CodecReadsFromThreads(stream) || S_StreamSfx(sfx, &stream->info)) {
+		S_CodecCloseStream(stream);
+		return qfalse;
+	}
+
+	if (stream->info.width == 1) {
+		Com_DPrintf(S_COLOR_YELLOW "WARNING: %s is a 8 bit audio file\n", sfx->soundName);
+	}
+
+	if (stream->info.rate != 22050) {
+		Com_DPrintf(S_COLOR_YELLOW "WARNING: %s is not a 22kHz audio file\n", sfx->soundName);
+	}
+
+	load = &s_loads[s_numLoads++];
+	load->sfx = sfx;
+	load->stream = stream;
+	load->samples = NULL;
+	load->length = 0;
+	load->usec = 0;
+
+	sfx->pending = qtrue;
+	return qtrue;
+}
+
+/*
+==============
+S_DecodeSoundJob
+
+Runs on the job threads, only touches its own sndLoad_t
+==============
+*/
+static void S_DecodeSoundJob(void *data, int index) {
+	sndLoad_t *load = (sndLoad_t *)data + index;
+	const snd_info_t *info = &load->stream->info;
+	int64_t start;
+	byte *raw;
+	int size, samples, outcount;
+
+	start = Sys_Microseconds();
+
+	size = info->samples * info->channels * info->width;
+	raw = size > 0 && info->rate > 0 ? malloc(size) : NULL;
+	if (raw) {
+		samples = S_CodecReadStream(load->stream, size, raw) / (info->channels * info->width);
+
+		// same count ResampleSfxRaw comes up with
+		outcount = samples / ((float)info->rate / dma.speed);
+		load->samples = malloc(((size_t)outcount + 1) * info->channels * sizeof(short));
+		if (load->samples) {
+			load->length = ResampleSfxRaw(load->samples, info->channels, info->rate, info->width, samples, raw);
+		}
+
+		free(raw);
+	}
+
+	load->usec = Sys_Microseconds() - start;
+}
+
+/*
+==============
+S_StoreSfxSamples
+
+Copies decoded samples into sound buffer chunks
+==============
+*/
+static void S_StoreSfxSamples(sfx_t *sfx, const short *samples, int count) {
+	sndBuffer *chunk, *newchunk;
+	int i, n;
+
+	sfx->soundData = NULL;
+	chunk = NULL;
+
+	for (i = 0; i < count; i += n) {
+		n = MIN(count - i, SND_CHUNK_SIZE);
+
+		newchunk = SND_malloc();
+		if (chunk == NULL) {
+			sfx->soundData = newchunk;
+		} else {
+			chunk->next = newchunk;
+		}
+		chunk = newchunk;
+
+		Com_Memcpy(chunk->sndChunk, samples + i, n * sizeof(short));
+	}
+}
+
+/*
+==============
+S_CountSoundLoad
+==============
+*/
+static void S_CountSoundLoad(const char *ext, int bytes, int64_t usec) {
+	sndLoadFormat_t *f;
+	int i;
+
+	for (i = 0, f = s_loadFormats; i < MAX_LOAD_FORMATS; i++, f++) {
+		if (!f->ext || !strcmp(f->ext, ext)) {
+			break;
+		}
+	}
+
+	if (i == MAX_LOAD_FORMATS) {
+		return;
+	}
+
+	f->ext = ext;
+	f->count++;
+	f->bytes += bytes;
+	f->usec += usec;
+}
+
+/*
+==============
+S_FinishSoundLoads
+
+Decodes everything S_QueueSound has queued.  Called when a queued sound
+is first needed and once registration is over.
+==============
+*/
+void S_FinishSoundLoads(void) {
+	sndLoad_t *load;
+	sfx_t *sfx;
+	int64_t start;
+	int i;
+
+	if (!s_numLoads) {
+		return;
+	}
+
+	start = Sys_Microseconds();
+
+	Com_RunJobs(S_DecodeSoundJob, s_loads, s_numLoads, s_loadThreads->integer);
+
+	for (i = 0, load = s_loads; i < s_numLoads; i++, load++) {
+		sfx = load->sfx;
+		sfx->pending = qfalse;
+		sfx->inMemory = qtrue;
+
+		if (load->samples && load->length > 0) {
+			sfx->soundCompressionMethod = 0;
+			sfx->soundLength = load->length;
+			sfx->soundChannels = load->stream->info.channels;
+			sfx->lastTimeUsed = Com_Milliseconds() + 1;
+
+			S_StoreSfxSamples(sfx, load->samples, load->length * sfx->soundChannels);
+			S_CountSoundLoad(load->stream->codec->ext, load->stream->length, load->usec);
+		} else {
+			sfx->defaultSound = qtrue;
+		}
+
+		free(load->samples);
+		S_CodecCloseStream(load->stream);
+	}
+
+	s_lastLoadCount = s_numLoads;
+	s_lastLoadUsec = Sys_Microseconds() - start;
+	s_numLoads = 0;
+}
+
+/*
+==============
+S_SoundLoadInfo
+==============
+*/
+void S_SoundLoadInfo(void) {
+	sndLoadFormat_t *f;
+	int i;
+
+	if (!s_loadFormats[0].ext) {
+		return;
+	}
+
+	Com_Printf("Decode time by format:\n");
+	for (i = 0, f = s_loadFormats; i < MAX_LOAD_FORMATS && f->ext; i++, f++) {
+		Com_Printf("%5s : %4i sounds, %6i KB, %5i msec\n", f->ext, f->count, (int)(f->bytes / 1024),
+				   (int)(f->usec / 1000));
+	}
+	Com_Printf("Last batch: %i sounds in %i msec\n", s_lastLoadCount, (int)(s_lastLoadUsec / 1000));
+}
+
 void S_DisplayFreeMemory(void) {
 	Com_Printf("%d bytes free sound buffer memory, %d total used\n", inUse, totalInUse);
 }
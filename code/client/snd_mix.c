@@ -27,6 +27,12 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 static portable_samplepair_t paintbuffer[PAINTBUFFER_SIZE];
 static int snd_vol;
 
+// vector kernels picked by S_InitMixer, NULL for the scalar code
+static sndPaint16_t s_paintMono16;
+static sndPaint16_t s_paintStereo16;
+static sndWriteBlast_t s_writeLinearBlast;
+static const char *s_mixerName = "scalar";
+
 int *snd_p;
 int snd_linear_count;
 short *snd_out;
@@ -125,7 +131,10 @@ void S_TransferStereo16(unsigned long *pbuf, int endtime) {
 		snd_linear_count <<= 1; // snd_linear_count *= dma.channels
 
 		// write a linear blast of samples
-		S_WriteLinearBlastStereo16();
+		if (s_writeLinearBlast)
+			s_writeLinearBlast(snd_out, snd_p, snd_linear_count);
+		else
+			S_WriteLinearBlastStereo16();
 
 		snd_p += snd_linear_count;
 		ls_paintedtime += (snd_linear_count >> 1); // snd_linear_count / dma.channels
@@ -319,6 +328,74 @@ static void S_PaintChannelFrom16_scalar(channel_t *ch, const sfx_t *sc, int coun
 	}
 }
 
+/*
+===================
+S_PaintChannelFrom16_vector
+
+The undistorted case of S_PaintChannelFrom16_scalar, handing each run of
+samples up to the end of a chunk to the vector kernels.
+===================
+*/
+static void S_PaintChannelFrom16_vector(channel_t *ch, const sfx_t *sc, int count, int sampleOffset,
+										int bufferOffset) {
+	int leftvol, rightvol;
+	int n;
+	portable_samplepair_t *samp;
+	sndBuffer *chunk;
+
+	if (sc->soundChannels <= 0) {
+		return;
+	}
+
+	samp = &paintbuffer[bufferOffset];
+
+	if (ch->doppler) {
+		sampleOffset = sampleOffset * ch->oldDopplerScale;
+	}
+
+	if (sc->soundChannels == 2) {
+		sampleOffset *= sc->soundChannels;
+
+		if (sampleOffset & 1) {
+			sampleOffset &= ~1;
+		}
+	}
+
+	chunk = sc->soundData;
+	while (sampleOffset >= SND_CHUNK_SIZE) {
+		chunk = chunk->next;
+		sampleOffset -= SND_CHUNK_SIZE;
+		if (!chunk) {
+			chunk = sc->soundData;
+		}
+	}
+
+	leftvol = ch->leftvol * snd_vol;
+	rightvol = ch->rightvol * snd_vol;
+
+	while (count > 0) {
+		if (sampleOffset == SND_CHUNK_SIZE) {
+			chunk = chunk->next;
+			sampleOffset = 0;
+		}
+
+		n = (SND_CHUNK_SIZE - sampleOffset) / sc->soundChannels;
+		if (n > count) {
+			n = count;
+		}
+
+		if (sc->soundChannels == 2) {
+			s_paintStereo16(samp, chunk->sndChunk + sampleOffset, n, leftvol, rightvol);
+		} else {
+			s_paintMono16(samp, chunk->sndChunk + sampleOffset, n, leftvol, rightvol);
+		}
+
+		samp += n;
+		count -= n;
+		sampleOffset += n * sc->soundChannels;
+	}
+}
+
 static void S_PaintChannelFrom16(channel_t *ch, const sfx_t *sc, int count, int sampleOffset, int bufferOffset) {
 #if idppc_altivec
 	if (com_altivec->integer) {
@@ -327,6 +404,10 @@ static void S_PaintChannelFrom16(channel_t *ch, const sfx_t *sc, int count, int
 		return;
 	}
 #endif
+	if (s_paintMono16 && (!ch->doppler || ch->dopplerScale == 1.0f)) {
+		S_PaintChannelFrom16_vector(ch, sc, count, sampleOffset, bufferOffset);
+		return;
+	}
 	S_PaintChannelFrom16_scalar(ch, sc, count, sampleOffset, bufferOffset);
 }
 
@@ -473,6 +554,98 @@ void S_PaintChannelFromMuLaw(channel_t *ch, sfx_t *sc, int count, int sampleOffs
 	}
 }
 
+/*
+===================
+S_PaintChannelFromStream
+
+Reads a streamed sfx from its ring, resampling as it goes the same way
+ResampleSfx does.  Frames not decoded yet play as silence.
+===================
+*/
+static void S_PaintChannelFromStream(channel_t *ch, int count, int sampleOffset, int bufferOffset) {
+	sndStream_t *s;
+	portable_samplepair_t *samp;
+	const short *src;
+	int leftvol, rightvol;
+	int frame, frac, oldest;
+	int i;
+
+	s = S_ChannelStream(ch);
+	if (!s) {
+		return;
+	}
+
+	leftvol = ch->leftvol * snd_vol;
+	rightvol = ch->rightvol * snd_vol;
+
+	samp = &paintbuffer[bufferOffset];
+	frame = (int64_t)sampleOffset * s->rate / dma.speed;
+	frac = (int64_t)sampleOffset * s->rate % dma.speed;
+	oldest = s->decoded - s->ringFrames;
+
+	for (i = 0; i < count; i++) {
+		if (frame >= oldest && frame < s->decoded) {
+			src = s->ring + (frame % s->ringFrames) * s->channels;
+			samp[i].left += (src[0] * leftvol) >> 8;
+			samp[i].right += (src[s->channels - 1] * rightvol) >> 8;
+		}
+
+		frac += s->rate;
+		while (frac >= dma.speed) {
+			frac -= dma.speed;
+			frame++;
+		}
+	}
+
+	if (frame > s->played) {
+		s->played = frame;
+	}
+}
+
+/*
+===================
+S_InitMixer
+
+Picks the widest kernels the CPU runs, unless s_mixSIMD is off.
+NEON builds can always run NEON.
+===================
+*/
+void S_InitMixer(void) {
+	s_paintMono16 = NULL;
+	s_paintStereo16 = NULL;
+	s_writeLinearBlast = NULL;
+	s_mixerName = "scalar";
+
+	if (!s_mixSIMD->integer) {
+		return;
+	}
+
+#if SND_SIMD_X86
+	{
+		cpuFeatures_t feat = Sys_GetProcessorFeatures();
+
+		if (feat & CF_AVX2) {
+			s_paintMono16 = S_PaintMono16_avx2;
+			s_paintStereo16 = S_PaintStereo16_avx2;
+			s_writeLinearBlast = S_WriteLinearBlastStereo16_avx2;
+			s_mixerName = "AVX2";
+		} else if (feat & CF_SSE2) {
+			s_paintMono16 = S_PaintMono16_sse2;
+			s_paintStereo16 = S_PaintStereo16_sse2;
+			s_writeLinearBlast = S_WriteLinearBlastStereo16_sse2;
+			s_mixerName = "SSE2";
+		}
+	}
+#elif SND_SIMD_NEON
+	s_paintMono16 = S_PaintMono16_neon;
+	s_paintStereo16 = S_PaintStereo16_neon;
+	s_writeLinearBlast = S_WriteLinearBlastStereo16_neon;
+	s_mixerName = "NEON";
+#endif
+}
+
+const char *S_MixerName(void) { return s_mixerName; }
+
 /*
 ===================
 S_PaintChannels
@@ -526,7 +699,7 @@ void S_PaintChannels(int endtime) {
 			ltime = s_paintedtime;
 			sc = ch->thesfx;
 
-			if (sc->soundData == NULL || sc->soundLength == 0) {
+			if ((sc->soundData == NULL && !ch->stream) || sc->soundLength == 0) {
 				continue;
 			}
 
@@ -537,7 +710,9 @@ void S_PaintChannels(int endtime) {
 			}
 
 			if (count > 0) {
-				if (sc->soundCompressionMethod == 1) {
+				if (ch->stream) {
+					S_PaintChannelFromStream(ch, count, sampleOffset, ltime - s_paintedtime);
+				} else if (sc->soundCompressionMethod == 1) {
 					S_PaintChannelFromADPCM(ch, sc, count, sampleOffset, ltime - s_paintedtime);
 				} else if (sc->soundCompressionMethod == 2) {
 					S_PaintChannelFromWavelet(ch, sc, count, sampleOffset, ltime - s_paintedtime);
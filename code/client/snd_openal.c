@@ -44,6 +44,11 @@ cvar_t *s_alDevice;
 cvar_t *s_alInputDevice;
 cvar_t *s_alAvailableDevices;
 cvar_t *s_alAvailableInputDevices;
+cvar_t *s_alDeferUpdates;
+
+// Local state variables
+static ALCdevice *alDevice;
+static ALCcontext *alContext;
 
 static qboolean enumeration_ext = qfalse;
 static qboolean enumeration_all_ext = qfalse;
@@ -234,6 +239,8 @@ static void S_AL_BufferUseDefault(sfxHandle_t sfx) {
 	knownSfx[sfx].buffer = knownSfx[default_sfx].buffer;
 }
 
+static void S_AL_SrcDetachBuffer(ALuint buffer);
+
 /*
 =================
 S_AL_BufferUnload
@@ -246,6 +253,9 @@ static void S_AL_BufferUnload(sfxHandle_t sfx) {
 	if (!knownSfx[sfx].inMemory)
 		return;
 
+	// Stopped sources may still hold it
+	S_AL_SrcDetachBuffer(knownSfx[sfx].buffer);
+
 	// Delete it
 	S_AL_ClearError(qfalse);
 	qalDeleteBuffers(1, &knownSfx[sfx].buffer);
@@ -524,6 +534,13 @@ typedef struct src_s {
 	vec3_t loopSpeakerPos; // Origin of the loop speaker
 
 	qboolean local; // Is this local (relative to the cam)
+
+	// What OpenAL was last told, so unchanged values aren't sent again
+	ALuint alBuffer; // static buffer, streams leave this at 0
+	vec3_t alPosition;
+	vec3_t alVelocity;
+	int alRelative; // -1 if unknown
+	int alLooping;
 } src_t;
 
 #ifdef __APPLE__
@@ -643,6 +660,131 @@ static qboolean S_AL_HearingThroughEntity(int entityNum) {
 		return qfalse; // not the player
 }
 
+/*
+=================
+S_AL_BeginUpdates
+
+Holds back the source and listener changes of this frame until
+S_AL_ProcessUpdates, so OpenAL applies them all at once
+=================
+*/
+static qboolean alDeferring = qfalse;
+static void(AL_APIENTRY *qalDeferUpdatesSOFT)(void);
+static void(AL_APIENTRY *qalProcessUpdatesSOFT)(void);
+
+static void S_AL_BeginUpdates(void) {
+	if (alDeferring || !s_alDeferUpdates->integer)
+		return;
+
+	if (qalDeferUpdatesSOFT)
+		qalDeferUpdatesSOFT();
+	else
+		qalcSuspendContext(alContext);
+
+	alDeferring = qtrue;
+}
+
+/*
+=================
+S_AL_ProcessUpdates
+=================
+*/
+static void S_AL_ProcessUpdates(void) {
+	if (!alDeferring)
+		return;
+
+	if (qalProcessUpdatesSOFT)
+		qalProcessUpdatesSOFT();
+	else
+		qalcProcessContext(alContext);
+
+	alDeferring = qfalse;
+}
+
+/*
+=================
+S_AL_SrcSetBuffer
+=================
+*/
+static void S_AL_SrcSetBuffer(src_t *src, ALuint buffer) {
+	if (src->alBuffer != buffer) {
+		qalSourcei(src->alSource, AL_BUFFER, buffer);
+		src->alBuffer = buffer;
+	}
+}
+
+/*
+=================
+S_AL_SrcSetPosition
+=================
+*/
+static void S_AL_SrcSetPosition(src_t *src, const vec3_t origin) {
+	if (!VectorCompare(src->alPosition, origin)) {
+		qalSourcefv(src->alSource, AL_POSITION, (const ALfloat *)origin);
+		VectorCopy(origin, src->alPosition);
+	}
+}
+
+/*
+=================
+S_AL_SrcSetVelocity
+=================
+*/
+static void S_AL_SrcSetVelocity(src_t *src, const vec3_t velocity) {
+	if (!VectorCompare(src->alVelocity, velocity)) {
+		qalSourcefv(src->alSource, AL_VELOCITY, (const ALfloat *)velocity);
+		VectorCopy(velocity, src->alVelocity);
+	}
+}
+
+/*
+=================
+S_AL_SrcSetRelative
+
+Relative sources don't roll off
+=================
+*/
+static void S_AL_SrcSetRelative(src_t *src, qboolean relative) {
+	if (src->alRelative == relative)
+		return;
+
+	if (relative) {
+		qalSourcei(src->alSource, AL_SOURCE_RELATIVE, AL_TRUE);
+		qalSourcef(src->alSource, AL_ROLLOFF_FACTOR, 0.0f);
+	} else {
+		qalSourcei(src->alSource, AL_SOURCE_RELATIVE, AL_FALSE);
+		qalSourcef(src->alSource, AL_ROLLOFF_FACTOR, s_alRolloff->value);
+	}
+
+	src->alRelative = relative;
+}
+
+/*
+=================
+S_AL_SrcSetLooping
+=================
+*/
+static void S_AL_SrcSetLooping(src_t *src, qboolean looping) {
+	if (src->alLooping != looping) {
+		qalSourcei(src->alSource, AL_LOOPING, looping ? AL_TRUE : AL_FALSE);
+		src->alLooping = looping;
+	}
+}
+
+/*
+=================
+S_AL_SrcDetachBuffer
+=================
+*/
+static void S_AL_SrcDetachBuffer(ALuint buffer) {
+	int i;
+
+	for (i = 0; i < srcCount; i++) {
+		if (srcList[i].alBuffer == buffer)
+			S_AL_SrcSetBuffer(&srcList[i], 0);
+	}
+}
+
 /*
 =================
 S_AL_SrcInit
@@ -670,6 +812,10 @@ static qboolean S_AL_SrcInit(void) {
 		qalGenSources(1, &srcList[i].alSource);
 		if (qalGetError() != AL_NO_ERROR)
 			break;
+
+		// pitch is never changed
+		qalSourcef(srcList[i].alSource, AL_PITCH, 1.0f);
+		srcList[i].alRelative = -1;
 		srcCount++;
 	}
 
@@ -736,27 +882,20 @@ static void S_AL_SrcSetup(srcHandle_t src, sfxHandle_t sfx, alSrcPriority_t prio
 	curSource->scaleGain = curSource->curGain;
 	curSource->local = local;
 
-	// Set up OpenAL source
+	// Set up OpenAL source, a source that played this sfx before keeps its buffer
 	if (sfx >= 0) {
 		// Mark the SFX as used, and grab the raw AL buffer
 		S_AL_BufferUse(sfx);
-		qalSourcei(curSource->alSource, AL_BUFFER, S_AL_BufferGet(sfx));
-	}
+		S_AL_SrcSetBuffer(curSource, S_AL_BufferGet(sfx));
+	} else
+		S_AL_SrcSetBuffer(curSource, 0);
 
-	qalSourcef(curSource->alSource, AL_PITCH, 1.0f);
 	S_AL_Gain(curSource->alSource, curSource->curGain);
-	qalSourcefv(curSource->alSource, AL_POSITION, vec3_origin);
-	qalSourcefv(curSource->alSource, AL_VELOCITY, vec3_origin);
-	qalSourcei(curSource->alSource, AL_LOOPING, AL_FALSE);
+	S_AL_SrcSetPosition(curSource, vec3_origin);
+	S_AL_SrcSetVelocity(curSource, vec3_origin);
+	S_AL_SrcSetLooping(curSource, qfalse);
 	qalSourcef(curSource->alSource, AL_REFERENCE_DISTANCE, s_alMinDistance->value);
-
-	if (local) {
-		qalSourcei(curSource->alSource, AL_SOURCE_RELATIVE, AL_TRUE);
-		qalSourcef(curSource->alSource, AL_ROLLOFF_FACTOR, 0.0f);
-	} else {
-		qalSourcei(curSource->alSource, AL_SOURCE_RELATIVE, AL_FALSE);
-		qalSourcef(curSource->alSource, AL_ROLLOFF_FACTOR, s_alRolloff->value);
-	}
+	S_AL_SrcSetRelative(curSource, local);
 }
 
 /*
@@ -892,8 +1031,8 @@ static void S_AL_SrcKill(srcHandle_t src) {
 		curSource->isPlaying = qfalse;
 	}
 
-	// Detach any buffers
-	qalSourcei(curSource->alSource, AL_BUFFER, 0);
+	// The buffer stays attached so the next sound using it needn't rebind,
+	// S_AL_BufferUnload detaches it before deleting
 
 	curSource->sfx = 0;
 	curSource->lastUsedTime = 0;
@@ -914,7 +1053,7 @@ static void S_AL_SrcKill(srcHandle_t src) {
 S_AL_SrcAlloc
 =================
 */
-static srcHandle_t S_AL_SrcAlloc(alSrcPriority_t priority, int entnum, int channel) {
+static srcHandle_t S_AL_SrcAlloc(alSrcPriority_t priority, int entnum, int channel, sfxHandle_t sfx) {
 	int i;
 	int empty = -1;
 	int weakest = -1;
@@ -932,18 +1071,25 @@ static srcHandle_t S_AL_SrcAlloc(alSrcPriority_t priority, int entnum, int chann
 		if (curSource->isLocked)
 			continue;
 
-		// Is it empty or not?
+		// Is it empty or not? Prefer one that still holds the buffer of this sfx
 		if (!curSource->isActive) {
-			empty = i;
-			break;
+			if (empty < 0)
+				empty = i;
+
+			if (sfx >= 0 && knownSfx[sfx].inMemory && curSource->alBuffer == knownSfx[sfx].buffer) {
+				empty = i;
+				break;
+			}
+			continue;
 		}
 
 		if (curSource->isPlaying) {
 			if (weakest_isplaying && curSource->priority < priority &&
 				(curSource->priority < weakest_pri ||
-				 (!curSource->isLooping &&
-				  (curSource->scaleGain < weakest_gain || curSource->lastUsedTime < weakest_time)))) {
-				// If it has lower priority, is fainter or older, flag it as weak
+				 (curSource->priority == weakest_pri && !curSource->isLooping &&
+				  (curSource->scaleGain < weakest_gain ||
+				   (curSource->scaleGain == weakest_gain && curSource->lastUsedTime < weakest_time))))) {
+				// If it has lower priority, or the same but is fainter, or as faint but older, flag it as weak
 				// the last two values are only compared if it's not a looping sound, because we want to prevent two
 				// loops (loops are added EVERY frame) fighting for a slot
 				weakest_pri = curSource->priority;
@@ -1022,6 +1168,8 @@ Locked sources will not be automatically reallocated or managed
 =================
 */
 static void S_AL_SrcLock(srcHandle_t src) {
+	// the stream queues its own buffers
+	S_AL_SrcSetBuffer(&srcList[src], 0);
 	srcList[src].isLocked = qtrue;
 }
 
@@ -1084,7 +1232,7 @@ static void S_AL_StartLocalSound(sfxHandle_t sfx, int channel) {
 		return;
 
 	// Try to grab a source
-	src = S_AL_SrcAlloc(SRCPRI_LOCAL, -1, channel);
+	src = S_AL_SrcAlloc(SRCPRI_LOCAL, -1, channel, sfx);
 
 	if (src == -1)
 		return;
@@ -1136,7 +1284,7 @@ static void S_AL_StartSound(vec3_t origin, int entnum, int entchannel, sfxHandle
 	}
 
 	// Try to grab a source
-	src = S_AL_SrcAlloc(SRCPRI_ONESHOT, entnum, entchannel);
+	src = S_AL_SrcAlloc(SRCPRI_ONESHOT, entnum, entchannel, sfx);
 	if (src == -1)
 		return;
 
@@ -1147,7 +1295,7 @@ static void S_AL_StartSound(vec3_t origin, int entnum, int entchannel, sfxHandle
 	if (!origin)
 		curSource->isTracking = qtrue;
 
-	qalSourcefv(curSource->alSource, AL_POSITION, sorigin);
+	S_AL_SrcSetPosition(curSource, sorigin);
 	S_AL_ScaleGain(curSource, sorigin);
 
 	// Start it playing
@@ -1183,10 +1331,12 @@ static void S_AL_SrcLoop(alSrcPriority_t priority, sfxHandle_t sfx, const vec3_t
 	if (S_AL_CheckInput(entityNum, sfx))
 		return;
 
+	S_AL_BeginUpdates();
+
 	// Do we need to allocate a new source for this entity
 	if (!sent->srcAllocated) {
 		// Try to get a channel
-		src = S_AL_SrcAlloc(priority, entityNum, -1);
+		src = S_AL_SrcAlloc(priority, entityNum, -1, sfx);
 		if (src == -1) {
 			Com_DPrintf(S_COLOR_YELLOW "WARNING: Failed to allocate source "
 									   "for loop sfx %d on entity %d\n",
@@ -1226,8 +1376,8 @@ static void S_AL_SrcLoop(alSrcPriority_t priority, sfxHandle_t sfx, const vec3_t
 
 		VectorClear(sorigin);
 
-		qalSourcefv(curSource->alSource, AL_POSITION, sorigin);
-		qalSourcefv(curSource->alSource, AL_VELOCITY, vec3_origin);
+		S_AL_SrcSetPosition(curSource, sorigin);
+		S_AL_SrcSetVelocity(curSource, vec3_origin);
 	} else {
 		curSource->local = qfalse;
 
@@ -1246,8 +1396,8 @@ static void S_AL_SrcLoop(alSrcPriority_t priority, sfxHandle_t sfx, const vec3_t
 		} else
 			VectorClear(svelocity);
 
-		qalSourcefv(curSource->alSource, AL_POSITION, (ALfloat *)sorigin);
-		qalSourcefv(curSource->alSource, AL_VELOCITY, (ALfloat *)svelocity);
+		S_AL_SrcSetPosition(curSource, sorigin);
+		S_AL_SrcSetVelocity(curSource, svelocity);
 	}
 }
 
@@ -1323,7 +1473,7 @@ static void S_AL_SrcUpdate(void) {
 
 					curSource->isPlaying = qfalse;
 					qalSourceStop(curSource->alSource);
-					qalSourcei(curSource->alSource, AL_BUFFER, 0);
+					S_AL_SrcSetBuffer(curSource, 0);
 					sent->startLoopingSound = qtrue;
 				}
 
@@ -1352,7 +1502,7 @@ static void S_AL_SrcUpdate(void) {
 				}
 
 				if (!curSource->isPlaying) {
-					qalSourcei(curSource->alSource, AL_LOOPING, AL_TRUE);
+					S_AL_SrcSetLooping(curSource, qtrue);
 					curSource->isPlaying = qtrue;
 					qalSourcePlay(curSource->alSource);
 
@@ -1407,13 +1557,7 @@ static void S_AL_SrcUpdate(void) {
 				}
 
 				// Update locality
-				if (curSource->local) {
-					qalSourcei(curSource->alSource, AL_SOURCE_RELATIVE, AL_TRUE);
-					qalSourcef(curSource->alSource, AL_ROLLOFF_FACTOR, 0.0f);
-				} else {
-					qalSourcei(curSource->alSource, AL_SOURCE_RELATIVE, AL_FALSE);
-					qalSourcef(curSource->alSource, AL_ROLLOFF_FACTOR, s_alRolloff->value);
-				}
+				S_AL_SrcSetRelative(curSource, curSource->local);
 
 			} else if (curSource->priority == SRCPRI_AMBIENT) {
 				if (curSource->isPlaying) {
@@ -1437,12 +1581,9 @@ static void S_AL_SrcUpdate(void) {
 			}
 		}
 
-		// Query relativity of source, don't move if it's true
-		qalGetSourcei(curSource->alSource, AL_SOURCE_RELATIVE, &state);
-
-		// See if it needs to be moved
-		if (curSource->isTracking && !state) {
-			qalSourcefv(curSource->alSource, AL_POSITION, entityList[entityNum].origin);
+		// See if it needs to be moved, relative sources stay put
+		if (curSource->isTracking && curSource->alRelative != qtrue) {
+			S_AL_SrcSetPosition(curSource, entityList[entityNum].origin);
 			S_AL_ScaleGain(curSource, entityList[entityNum].origin);
 		}
 	}
@@ -1495,7 +1636,7 @@ static void S_AL_AllocateStreamChannel(int stream, int entityNum) {
 	if (entityNum >= 0) {
 		// This is a stream that tracks an entity
 		// Allocate a streamSource at normal priority
-		cursrc = S_AL_SrcAlloc(SRCPRI_ENTITY, entityNum, 0);
+		cursrc = S_AL_SrcAlloc(SRCPRI_ENTITY, entityNum, 0, -1);
 		if (cursrc < 0)
 			return;
 
@@ -1507,7 +1648,7 @@ static void S_AL_AllocateStreamChannel(int stream, int entityNum) {
 		// Unspatialized stream source
 
 		// Allocate a streamSource at high priority
-		cursrc = S_AL_SrcAlloc(SRCPRI_STREAM, -2, 0);
+		cursrc = S_AL_SrcAlloc(SRCPRI_STREAM, -2, 0, -1);
 		if (cursrc < 0)
 			return;
 
@@ -1521,13 +1662,11 @@ static void S_AL_AllocateStreamChannel(int stream, int entityNum) {
 		srcList[cursrc].scaleGain = 0.0f;
 
 		// Set some streamSource parameters
-		qalSourcei(alsrc, AL_BUFFER, 0);
-		qalSourcei(alsrc, AL_LOOPING, AL_FALSE);
-		qalSource3f(alsrc, AL_POSITION, 0.0, 0.0, 0.0);
-		qalSource3f(alsrc, AL_VELOCITY, 0.0, 0.0, 0.0);
+		S_AL_SrcSetLooping(&srcList[cursrc], qfalse);
+		S_AL_SrcSetPosition(&srcList[cursrc], vec3_origin);
+		S_AL_SrcSetVelocity(&srcList[cursrc], vec3_origin);
 		qalSource3f(alsrc, AL_DIRECTION, 0.0, 0.0, 0.0);
-		qalSourcef(alsrc, AL_ROLLOFF_FACTOR, 0.0);
-		qalSourcei(alsrc, AL_SOURCE_RELATIVE, AL_TRUE);
+		S_AL_SrcSetRelative(&srcList[cursrc], qtrue);
 	}
 
 	streamSourceHandles[stream] = cursrc;
@@ -1719,7 +1858,7 @@ S_AL_MusicSourceGet
 */
 static void S_AL_MusicSourceGet(void) {
 	// Allocate a musicSource at high priority
-	musicSourceHandle = S_AL_SrcAlloc(SRCPRI_STREAM, -2, 0);
+	musicSourceHandle = S_AL_SrcAlloc(SRCPRI_STREAM, -2, 0, -1);
 	if (musicSourceHandle == -1)
 		return;
 
@@ -1732,11 +1871,10 @@ static void S_AL_MusicSourceGet(void) {
 	srcList[musicSourceHandle].scaleGain = 0.0f;
 
 	// Set some musicSource parameters
-	qalSource3f(musicSource, AL_POSITION, 0.0, 0.0, 0.0);
-	qalSource3f(musicSource, AL_VELOCITY, 0.0, 0.0, 0.0);
+	S_AL_SrcSetPosition(&srcList[musicSourceHandle], vec3_origin);
+	S_AL_SrcSetVelocity(&srcList[musicSourceHandle], vec3_origin);
 	qalSource3f(musicSource, AL_DIRECTION, 0.0, 0.0, 0.0);
-	qalSourcef(musicSource, AL_ROLLOFF_FACTOR, 0.0);
-	qalSourcei(musicSource, AL_SOURCE_RELATIVE, AL_TRUE);
+	S_AL_SrcSetRelative(&srcList[musicSourceHandle], qtrue);
 }
 
 /*
@@ -1972,10 +2110,6 @@ static void S_AL_MusicUpdate(void) {
 
 //===========================================================================
 
-// Local state variables
-static ALCdevice *alDevice;
-static ALCcontext *alContext;
-
 #ifdef USE_VOIP
 static ALCdevice *alCaptureDevice;
 static cvar_t *s_alCapture;
@@ -2002,6 +2136,7 @@ S_AL_StopAllSounds
 */
 static void S_AL_StopAllSounds(void) {
 	int i;
+	S_AL_ProcessUpdates();
 	S_AL_SrcShutup();
 	S_AL_StopBackgroundTrack();
 	for (i = 0; i < MAX_RAW_STREAMS; i++)
@@ -2034,6 +2169,8 @@ static void S_AL_Respatialize(int entityNum, const vec3_t origin, vec3_t axis[3]
 	lastListenerNumber = entityNum;
 	VectorCopy(sorigin, lastListenerOrigin);
 
+	S_AL_BeginUpdates();
+
 	// Set OpenAL listener paramaters
 	qalListenerfv(AL_POSITION, (ALfloat *)sorigin);
 	qalListenerfv(AL_VELOCITY, vec3_origin);
@@ -2048,6 +2185,8 @@ S_AL_Update
 static void S_AL_Update(void) {
 	int i;
 
+	S_AL_BeginUpdates();
+
 	if (s_muted->modified) {
 		// muted state changed. Let S_AL_Gain turn up all sources again.
 		for (i = 0; i < srcCount; i++) {
@@ -2058,6 +2197,14 @@ static void S_AL_Update(void) {
 		s_muted->modified = qfalse;
 	}
 
+	// Idle sources get the new rolloff when they are next set up
+	if (s_alRolloff->modified) {
+		for (i = 0; i < srcCount; i++) {
+			if (srcList[i].alRelative == qfalse)
+				srcList[i].alRelative = -1;
+		}
+	}
+
 	// Update SFX channels
 	S_AL_SrcUpdate();
 
@@ -2091,6 +2238,8 @@ static void S_AL_Update(void) {
 	s_musicVolume->modified = qfalse;
 	s_alMinDistance->modified = qfalse;
 	s_alRolloff->modified = qfalse;
+
+	S_AL_ProcessUpdates();
 }
 
 /*
@@ -2180,6 +2329,13 @@ static void S_AL_SoundInfo(void) {
 	if (enumeration_all_ext || enumeration_ext)
 		Com_Printf("  Available Devices:\n%s", s_alAvailableDevices->string);
 
+	if (!s_alDeferUpdates->integer)
+		Com_Printf("  Batched updates: off\n");
+	else if (qalDeferUpdatesSOFT)
+		Com_Printf("  Batched updates: AL_SOFT_deferred_updates\n");
+	else
+		Com_Printf("  Batched updates: alcSuspendContext\n");
+
 #ifdef USE_VOIP
 	if (capture_ext) {
 		Com_Printf("  Input Device:   %s\n", qalcGetString(alCaptureDevice, ALC_CAPTURE_DEVICE_SPECIFIER));
@@ -2196,6 +2352,9 @@ S_AL_Shutdown
 static void S_AL_Shutdown(void) {
 	// Shut down everything
 	int i;
+	S_AL_ProcessUpdates();
+	qalDeferUpdatesSOFT = NULL;
+	qalProcessUpdatesSOFT = NULL;
 	for (i = 0; i < MAX_RAW_STREAMS; i++)
 		S_AL_StreamDie(i);
 	S_AL_StopBackgroundTrack();
@@ -2258,6 +2417,7 @@ qboolean S_AL_Init(soundInterface_t *si) {
 	s_alMaxDistance = Cvar_Get("s_alMaxDistance", "1024", CVAR_CHEAT);
 	s_alRolloff = Cvar_Get("s_alRolloff", "2", CVAR_CHEAT);
 	s_alGraceDistance = Cvar_Get("s_alGraceDistance", "512", CVAR_CHEAT);
+	s_alDeferUpdates = Cvar_Get("s_alDeferUpdates", "1", CVAR_ARCHIVE);
 
 	s_alDriver = Cvar_Get("s_alDriver", ALDRIVER_DEFAULT, CVAR_ARCHIVE | CVAR_LATCH | CVAR_PROTECTED);
 
@@ -2352,6 +2512,12 @@ qboolean S_AL_Init(soundInterface_t *si) {
 	}
 	qalcMakeContextCurrent(alContext);
 
+	// Each frame's source changes are applied at once
+	if (qalIsExtensionPresent("AL_SOFT_deferred_updates")) {
+		qalDeferUpdatesSOFT = qalGetProcAddress("alDeferUpdatesSOFT");
+		qalProcessUpdatesSOFT = qalGetProcAddress("alProcessUpdatesSOFT");
+	}
+
 	// Initialize sources, buffers, music
 	S_AL_BufferInit();
 	S_AL_SrcInit();
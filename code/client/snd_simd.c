@@ -0,0 +1,283 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+// snd_simd.c -- SSE2, AVX2 and NEON kernels for snd_mix.c
+
+/* Like snd_altivec.c this is kept apart from snd_mix.c so the compiler
+   never uses these instruction sets in the scalar code.  The x86 kernels
+   are compiled per function with target attributes, so no special command
+   line is needed and S_InitMixer only picks them when the CPU has them.
+
+   Every kernel gives the same result as the scalar loop it replaces:
+   (sample * vol) >> 8 added to the paint buffer, and >> 8 with a clamp to
+   16 bits on the way out. */
+
+#include "client.h"
+#include "snd_local.h"
+
+#if defined(__GNUC__) || defined(__clang__)
+#define SND_TARGET(x) __attribute__((target(x)))
+#else
+#define SND_TARGET(x)
+#endif
+
+/*
+===============================================================================
+
+SSE2 / AVX2
+
+===============================================================================
+*/
+
+#if SND_SIMD_X86
+
+#include <emmintrin.h>
+#include <immintrin.h>
+
+/*
+SSE2 has no 32-bit multiply, so the products are built from 16-bit halves.
+The volume goes in as unsigned 16 bits: mulhi treats volumes of 0x8000 and
+up as negative, which is undone by adding the sample back into the high half.
+Larger volumes only come from s_volume above 1 and take the scalar loop.
+*/
+SND_TARGET("sse2")
+static ID_INLINE void S_MulAdd16_sse2(int *out, __m128i data, __m128i vol, __m128i volFix) {
+	__m128i lo, hi, p0, p1;
+
+	lo = _mm_mullo_epi16(data, vol);
+	hi = _mm_add_epi16(_mm_mulhi_epi16(data, vol), _mm_and_si128(data, volFix));
+
+	p0 = _mm_srai_epi32(_mm_unpacklo_epi16(lo, hi), 8);
+	p1 = _mm_srai_epi32(_mm_unpackhi_epi16(lo, hi), 8);
+
+	_mm_storeu_si128((__m128i *)out, _mm_add_epi32(_mm_loadu_si128((__m128i *)out), p0));
+	_mm_storeu_si128((__m128i *)(out + 4), _mm_add_epi32(_mm_loadu_si128((__m128i *)(out + 4)), p1));
+}
+
+SND_TARGET("sse2")
+void S_PaintMono16_sse2(portable_samplepair_t *samp, const short *samples, int count, int leftvol, int rightvol) {
+	__m128i vol, volFix, data;
+	int i = 0;
+
+	if (leftvol <= 0xffff && rightvol <= 0xffff) {
+		vol = _mm_set_epi16(rightvol, leftvol, rightvol, leftvol, rightvol, leftvol, rightvol, leftvol);
+		volFix = _mm_set_epi16(rightvol & 0x8000 ? -1 : 0, leftvol & 0x8000 ? -1 : 0, rightvol & 0x8000 ? -1 : 0,
+							   leftvol & 0x8000 ? -1 : 0, rightvol & 0x8000 ? -1 : 0, leftvol & 0x8000 ? -1 : 0,
+							   rightvol & 0x8000 ? -1 : 0, leftvol & 0x8000 ? -1 : 0);
+
+		for (; i + 8 <= count; i += 8) {
+			data = _mm_loadu_si128((const __m128i *)(samples + i));
+
+			// each sample goes to both sides of its pair
+			S_MulAdd16_sse2(&samp[i].left, _mm_unpacklo_epi16(data, data), vol, volFix);
+			S_MulAdd16_sse2(&samp[i + 4].left, _mm_unpackhi_epi16(data, data), vol, volFix);
+		}
+	}
+
+	for (; i < count; i++) {
+		samp[i].left += (samples[i] * leftvol) >> 8;
+		samp[i].right += (samples[i] * rightvol) >> 8;
+	}
+}
+
+SND_TARGET("sse2")
+void S_PaintStereo16_sse2(portable_samplepair_t *samp, const short *samples, int count, int leftvol, int rightvol) {
+	__m128i vol, volFix;
+	int i = 0;
+
+	if (leftvol <= 0xffff && rightvol <= 0xffff) {
+		vol = _mm_set_epi16(rightvol, leftvol, rightvol, leftvol, rightvol, leftvol, rightvol, leftvol);
+		volFix = _mm_set_epi16(rightvol & 0x8000 ? -1 : 0, leftvol & 0x8000 ? -1 : 0, rightvol & 0x8000 ? -1 : 0,
+							   leftvol & 0x8000 ? -1 : 0, rightvol & 0x8000 ? -1 : 0, leftvol & 0x8000 ? -1 : 0,
+							   rightvol & 0x8000 ? -1 : 0, leftvol & 0x8000 ? -1 : 0);
+
+		for (; i + 4 <= count; i += 4) {
+			S_MulAdd16_sse2(&samp[i].left, _mm_loadu_si128((const __m128i *)(samples + i * 2)), vol, volFix);
+		}
+	}
+
+	for (; i < count; i++) {
+		samp[i].left += (samples[i * 2] * leftvol) >> 8;
+		samp[i].right += (samples[i * 2 + 1] * rightvol) >> 8;
+	}
+}
+
+SND_TARGET("sse2")
+void S_WriteLinearBlastStereo16_sse2(short *out, const int *in, int count) {
+	__m128i a, b;
+	int i;
+
+	for (i = 0; i + 8 <= count; i += 8) {
+		a = _mm_srai_epi32(_mm_loadu_si128((const __m128i *)(in + i)), 8);
+		b = _mm_srai_epi32(_mm_loadu_si128((const __m128i *)(in + i + 4)), 8);
+		_mm_storeu_si128((__m128i *)(out + i), _mm_packs_epi32(a, b));
+	}
+
+	for (; i < count; i++) {
+		int val = in[i] >> 8;
+		out[i] = val > 32767 ? 32767 : val < -32768 ? -32768 : val;
+	}
+}
+
+SND_TARGET("avx2")
+static ID_INLINE void S_MulAdd32_avx2(int *out, __m128i data, __m256i vol) {
+	__m256i p;
+
+	p = _mm256_srai_epi32(_mm256_mullo_epi32(_mm256_cvtepi16_epi32(data), vol), 8);
+	_mm256_storeu_si256((__m256i *)out, _mm256_add_epi32(_mm256_loadu_si256((__m256i *)out), p));
+}
+
+SND_TARGET("avx2")
+void S_PaintMono16_avx2(portable_samplepair_t *samp, const short *samples, int count, int leftvol, int rightvol) {
+	__m256i vol;
+	__m128i data;
+	int i;
+
+	vol = _mm256_set_epi32(rightvol, leftvol, rightvol, leftvol, rightvol, leftvol, rightvol, leftvol);
+
+	for (i = 0; i + 8 <= count; i += 8) {
+		data = _mm_loadu_si128((const __m128i *)(samples + i));
+
+		S_MulAdd32_avx2(&samp[i].left, _mm_unpacklo_epi16(data, data), vol);
+		S_MulAdd32_avx2(&samp[i + 4].left, _mm_unpackhi_epi16(data, data), vol);
+	}
+
+	for (; i < count; i++) {
+		samp[i].left += (samples[i] * leftvol) >> 8;
+		samp[i].right += (samples[i] * rightvol) >> 8;
+	}
+}
+
+SND_TARGET("avx2")
+void S_PaintStereo16_avx2(portable_samplepair_t *samp, const short *samples, int count, int leftvol, int rightvol) {
+	__m256i vol;
+	int i;
+
+	vol = _mm256_set_epi32(rightvol, leftvol, rightvol, leftvol, rightvol, leftvol, rightvol, leftvol);
+
+	for (i = 0; i + 4 <= count; i += 4) {
+		S_MulAdd32_avx2(&samp[i].left, _mm_loadu_si128((const __m128i *)(samples + i * 2)), vol);
+	}
+
+	for (; i < count; i++) {
+		samp[i].left += (samples[i * 2] * leftvol) >> 8;
+		samp[i].right += (samples[i * 2 + 1] * rightvol) >> 8;
+	}
+}
+
+SND_TARGET("avx2")
+void S_WriteLinearBlastStereo16_avx2(short *out, const int *in, int count) {
+	__m256i a, b, packed;
+	int i;
+
+	for (i = 0; i + 16 <= count; i += 16) {
+		a = _mm256_srai_epi32(_mm256_loadu_si256((const __m256i *)(in + i)), 8);
+		b = _mm256_srai_epi32(_mm256_loadu_si256((const __m256i *)(in + i + 8)), 8);
+
+		// packs works within 128-bit lanes, put the quarters back in order
+		packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), _MM_SHUFFLE(3, 1, 2, 0));
+		_mm256_storeu_si256((__m256i *)(out + i), packed);
+	}
+
+	for (; i < count; i++) {
+		int val = in[i] >> 8;
+		out[i] = val > 32767 ? 32767 : val < -32768 ? -32768 : val;
+	}
+}
+
+#endif
+
+/*
+===============================================================================
+
+NEON
+
+===============================================================================
+*/
+
+#if SND_SIMD_NEON
+
+#include <arm_neon.h>
+
+static ID_INLINE void S_MulAdd32_neon(int *out, int16x4_t data, int32x4_t vol) {
+	int32x4_t p;
+
+	p = vshrq_n_s32(vmulq_s32(vmovl_s16(data), vol), 8);
+	vst1q_s32(out, vaddq_s32(vld1q_s32(out), p));
+}
+
+void S_PaintMono16_neon(portable_samplepair_t *samp, const short *samples, int count, int leftvol, int rightvol) {
+	const int volumes[4] = {leftvol, rightvol, leftvol, rightvol};
+	int32x4_t vol;
+	int16x4x2_t pairs;
+	int i;
+
+	vol = vld1q_s32(volumes);
+
+	for (i = 0; i + 4 <= count; i += 4) {
+		int16x4_t data = vld1_s16(samples + i);
+
+		// each sample goes to both sides of its pair
+		pairs = vzip_s16(data, data);
+		S_MulAdd32_neon(&samp[i].left, pairs.val[0], vol);
+		S_MulAdd32_neon(&samp[i + 2].left, pairs.val[1], vol);
+	}
+
+	for (; i < count; i++) {
+		samp[i].left += (samples[i] * leftvol) >> 8;
+		samp[i].right += (samples[i] * rightvol) >> 8;
+	}
+}
+
+void S_PaintStereo16_neon(portable_samplepair_t *samp, const short *samples, int count, int leftvol, int rightvol) {
+	const int volumes[4] = {leftvol, rightvol, leftvol, rightvol};
+	int32x4_t vol;
+	int i;
+
+	vol = vld1q_s32(volumes);
+
+	for (i = 0; i + 2 <= count; i += 2) {
+		S_MulAdd32_neon(&samp[i].left, vld1_s16(samples + i * 2), vol);
+	}
+
+	for (; i < count; i++) {
+		samp[i].left += (samples[i * 2] * leftvol) >> 8;
+		samp[i].right += (samples[i * 2 + 1] * rightvol) >> 8;
+	}
+}
+
+void S_WriteLinearBlastStereo16_neon(short *out, const int *in, int count) {
+	int i;
+
+	for (i = 0; i + 8 <= count; i += 8) {
+		int16x4_t a = vqshrn_n_s32(vld1q_s32(in + i), 8);
+		int16x4_t b = vqshrn_n_s32(vld1q_s32(in + i + 4), 8);
+
+		vst1q_s16(out + i, vcombine_s16(a, b));
+	}
+
+	for (; i < count; i++) {
+		int val = in[i] >> 8;
+		out[i] = val > 32767 ? 32767 : val < -32768 ? -32768 : val;
+	}
+}
+
+#endif
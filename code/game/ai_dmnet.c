@@ -391,8 +391,9 @@ static int BotGetItemLongTermGoal(bot_state_t *bs, int tfl, bot_goal_t *goal) {
 		BotChooseWeapon(bs);
 		bs->ltg_time = 0;
 	}
-	// if it is time to find a new long term goal
-	if (bs->ltg_time < FloatTime()) {
+	// if it is time to find a new long term goal, replacing a goal the bot
+	// still has waits when enough bots did so this frame
+	if (bs->ltg_time < FloatTime() && (!bs->ltg_time || BotAI_AllowLTGRefresh())) {
 		// pop the current goal from the stack
 		trap_BotPopGoal(bs->gs);
 		// BotAI_Print(PRT_MESSAGE, "%s: choosing new ltg\n", ClientName(bs->client, netname, sizeof(netname)));
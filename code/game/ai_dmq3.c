@@ -1988,32 +1988,24 @@ qboolean InFieldOfVision(vec3_t viewangles, float fov, vec3_t angles) {
 
 /*
 ==================
-BotEntityVisible
+BotEntityLineOfSight
 
-returns visibility in the range [0, 1] taking fog and water surfaces into account
+visibility of the middle, bottom or top of the entity's bounding box from the eye
 ==================
 */
-float BotEntityVisible(int viewer, vec3_t eye, vec3_t viewangles, float fov, int ent) {
+static float BotEntityLineOfSight(int viewer, vec3_t eye, int ent, const aas_entityinfo_t *entinfo, vec3_t middle) {
 	int i, contents_mask, passent, hitent, infog, inwater, otherinfog, pc;
 	float squaredfogdist, waterfactor, vis, bestvis;
 	bsp_trace_t trace;
-	aas_entityinfo_t entinfo;
-	vec3_t dir, entangles, start, end, middle;
-
-	if (ent < MAX_CLIENTS && gametype == GT_LPS)
-		return 1.0f; // all players visible. everywhere
-
-	// calculate middle of bounding box
-	BotEntityInfo(ent, &entinfo);
-	if (!entinfo.valid)
-		return 0;
-	VectorAdd(entinfo.mins, entinfo.maxs, middle);
-	VectorScale(middle, 0.5, middle);
-	VectorAdd(entinfo.origin, middle, middle);
-	// check if entity is within field of vision
-	VectorSubtract(middle, eye, dir);
-	vectoangles(dir, entangles);
-	if (!InFieldOfVision(viewangles, fov, entangles))
+	vec3_t dir, start, end, bottom, top;
+
+	// none of the points can be seen when none of them is in the potentially visible set
+	VectorCopy(middle, bottom);
+	bottom[2] += entinfo->mins[2];
+	VectorCopy(middle, top);
+	top[2] += entinfo->maxs[2];
+	if (!trap_InPVSIgnorePortals(eye, middle) && !trap_InPVSIgnorePortals(eye, bottom) &&
+		!trap_InPVSIgnorePortals(eye, top))
 		return 0;
 	//
 	pc = trap_AAS_PointContents(eye);
@@ -2044,8 +2036,9 @@ float BotEntityVisible(int viewer, vec3_t eye, vec3_t viewangles, float fov, int
 			}
 			contents_mask ^= (CONTENTS_LAVA | CONTENTS_SLIME | CONTENTS_WATER);
 		}
-		// trace from start to end
-		BotAI_Trace(&trace, start, NULL, NULL, end, passent, contents_mask);
+		// trace from start to end, unless it was batched before the bots started thinking
+		if (!BotAI_VisTrace(&trace, viewer, ent, start, end, passent, contents_mask))
+			BotAI_Trace(&trace, start, NULL, NULL, end, passent, contents_mask);
 		// if water was hit
 		waterfactor = 1.0f;
 		// note: trace.contents is always 0, see BotAI_Trace
@@ -2093,13 +2086,49 @@ float BotEntityVisible(int viewer, vec3_t eye, vec3_t viewangles, float fov, int
 		}
 		// check bottom and top of bounding box as well
 		if (i == 0)
-			middle[2] += entinfo.mins[2];
+			middle[2] += entinfo->mins[2];
 		else if (i == 1)
-			middle[2] += entinfo.maxs[2] - entinfo.mins[2];
+			middle[2] += entinfo->maxs[2] - entinfo->mins[2];
 	}
 	return bestvis;
 }
 
+/*
+==================
+BotEntityVisible
+
+returns visibility in the range [0, 1] taking fog and water surfaces into account
+==================
+*/
+float BotEntityVisible(int viewer, vec3_t eye, vec3_t viewangles, float fov, int ent) {
+	float vis;
+	aas_entityinfo_t entinfo;
+	vec3_t dir, entangles, middle;
+
+	if (ent < MAX_CLIENTS && gametype == GT_LPS)
+		return 1.0f; // all players visible. everywhere
+
+	// calculate middle of bounding box
+	BotEntityInfo(ent, &entinfo);
+	if (!entinfo.valid)
+		return 0;
+	VectorAdd(entinfo.mins, entinfo.maxs, middle);
+	VectorScale(middle, 0.5, middle);
+	VectorAdd(entinfo.origin, middle, middle);
+	// check if entity is within field of vision
+	VectorSubtract(middle, eye, dir);
+	vectoangles(dir, entangles);
+	if (!InFieldOfVision(viewangles, fov, entangles))
+		return 0;
+	// the line of sight doesn't depend on the view direction, so it is shared
+	// by all queries from the same eye this frame
+	if (BotAI_SharedVisibility(viewer, ent, eye, &vis))
+		return vis;
+	vis = BotEntityLineOfSight(viewer, eye, ent, &entinfo, middle);
+	BotAI_ShareVisibility(viewer, ent, eye, vis);
+	return vis;
+}
+
 // cyr{
 qboolean EnemyFitsWell(bot_state_t *bs, aas_entityinfo_t *entinfo, int curenemy) {
 	aas_entityinfo_t curenemyinfo;
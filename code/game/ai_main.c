@@ -95,6 +95,58 @@ static vmCvar_t bot_shownextitem;
 static vmCvar_t bot_shownoitem;
 static vmCvar_t bot_showreachesfrom;
 static vmCvar_t bot_showreachesto;
+static vmCvar_t bot_maxframetime;
+
+// bots that may replace a long term goal they still have in one frame, the
+// goals all bots picked at the same time expire at the same time
+#define MAX_LTGREFRESHES 2
+
+static int ltgRefreshes;
+
+// think times for bot_stats
+typedef struct {
+	int thinks;	  // number of thinks
+	int msec;	  // total think time
+	int maxMsec;  // longest think
+	int deferred; // thinks put off to the next frame by bot_maxframetime
+} botThinkStats_t;
+
+static botThinkStats_t thinkStats[MAX_CLIENTS];
+static int statsFrames;		   // frames any bot thought in
+static int statsMaxFrameMsec;  // most bot think time in one frame
+static int statsBudgetFrames;  // frames that put off thinks
+
+// the line of sight traces from the bots that think this frame to their
+// enemies, run as one trap_TraceBatch before any of them thinks
+#define MAX_VISTRACES 1024
+
+typedef struct {
+	qboolean valid;
+	int numTraces;
+	short index[MAX_CLIENTS][MAX_CLIENTS]; // viewer, target -> trace + 1, 0 for none
+	traceRequest_t requests[MAX_VISTRACES];
+	trace_t results[MAX_VISTRACES];
+} botVisTraces_t;
+
+static botVisTraces_t visTraces;
+
+// line of sight from a client's eye to another client, worked out at most once
+// per frame and shared by all queries of the bots that think in it
+typedef struct {
+	int frame;
+	vec3_t eye;
+	float vis;
+} botVisibility_t;
+
+static botVisibility_t visMatrix[MAX_CLIENTS][MAX_CLIENTS]; // viewer, target
+static int visFrame;
+
+// entity states as last sent to the botlib, which keeps the entities that
+// didn't change without relinking them
+static bot_entitystate_t entityStates[MAX_GENTITIES];
+static byte entityLive[MAX_GENTITIES / 8]; // entities passed to the botlib last update
+static int entityChanged[MAX_GENTITIES];
+static qboolean entityResend;
 
 void ExitLevel(void);
 
@@ -669,25 +721,184 @@ void QDECL BotAI_Print(int type, const char *fmt, ...) {
 BotAI_Trace
 ==================
 */
+static void BotAI_CopyTrace(bsp_trace_t *bsptrace, const trace_t *trace) {
+	bsptrace->allsolid = trace->allsolid;
+	bsptrace->startsolid = trace->startsolid;
+	bsptrace->fraction = trace->fraction;
+	VectorCopy(trace->endpos, bsptrace->endpos);
+	bsptrace->plane.dist = trace->plane.dist;
+	VectorCopy(trace->plane.normal, bsptrace->plane.normal);
+	bsptrace->plane.signbits = trace->plane.signbits;
+	bsptrace->plane.type = trace->plane.type;
+	bsptrace->surface.value = trace->surfaceFlags;
+	bsptrace->ent = trace->entityNum;
+	bsptrace->exp_dist = 0;
+	bsptrace->sidenum = 0;
+	bsptrace->contents = 0;
+}
+
 void BotAI_Trace(bsp_trace_t *bsptrace, vec3_t start, vec3_t mins, vec3_t maxs, vec3_t end, int passent,
 				 int contentmask) {
 	trace_t trace;
 
 	trap_Trace(&trace, start, mins, maxs, end, passent, contentmask);
 	// copy the trace information
-	bsptrace->allsolid = trace.allsolid;
-	bsptrace->startsolid = trace.startsolid;
-	bsptrace->fraction = trace.fraction;
-	VectorCopy(trace.endpos, bsptrace->endpos);
-	bsptrace->plane.dist = trace.plane.dist;
-	VectorCopy(trace.plane.normal, bsptrace->plane.normal);
-	bsptrace->plane.signbits = trace.plane.signbits;
-	bsptrace->plane.type = trace.plane.type;
-	bsptrace->surface.value = trace.surfaceFlags;
-	bsptrace->ent = trace.entityNum;
-	bsptrace->exp_dist = 0;
-	bsptrace->sidenum = 0;
-	bsptrace->contents = 0;
+	BotAI_CopyTrace(bsptrace, &trace);
+}
+
+/*
+==================
+BotAI_VisTrace
+
+Gets the trace from viewer to ent out of the batch run before the bots
+started thinking, if one was run with the same points and contents
+==================
+*/
+qboolean BotAI_VisTrace(bsp_trace_t *bsptrace, int viewer, int ent, vec3_t start, vec3_t end, int passent,
+						int contentmask) {
+	const traceRequest_t *req;
+	int index;
+
+	if (!visTraces.valid || viewer < 0 || viewer >= MAX_CLIENTS || ent < 0 || ent >= MAX_CLIENTS) {
+		return qfalse;
+	}
+	index = visTraces.index[viewer][ent];
+	if (!index) {
+		return qfalse;
+	}
+
+	req = &visTraces.requests[index - 1];
+	if (req->passEntityNum != passent || req->contentmask != contentmask || !VectorCompare(req->start, start) ||
+		!VectorCompare(req->end, end)) {
+		return qfalse;
+	}
+
+	BotAI_CopyTrace(bsptrace, &visTraces.results[index - 1]);
+	return qtrue;
+}
+
+/*
+==================
+BotAI_SharedVisibility
+
+Gets the visibility of ent from the viewer's eye if it was already worked out
+this frame
+==================
+*/
+qboolean BotAI_SharedVisibility(int viewer, int ent, const vec3_t eye, float *vis) {
+	const botVisibility_t *entry;
+
+	if (viewer < 0 || viewer >= MAX_CLIENTS || ent < 0 || ent >= MAX_CLIENTS) {
+		return qfalse;
+	}
+	entry = &visMatrix[viewer][ent];
+	if (entry->frame != visFrame || !VectorCompare(entry->eye, eye)) {
+		return qfalse;
+	}
+	*vis = entry->vis;
+	return qtrue;
+}
+
+/*
+==================
+BotAI_ShareVisibility
+==================
+*/
+void BotAI_ShareVisibility(int viewer, int ent, const vec3_t eye, float vis) {
+	botVisibility_t *entry;
+
+	if (viewer < 0 || viewer >= MAX_CLIENTS || ent < 0 || ent >= MAX_CLIENTS) {
+		return;
+	}
+	entry = &visMatrix[viewer][ent];
+	entry->frame = visFrame;
+	VectorCopy(eye, entry->eye);
+	entry->vis = vis;
+}
+
+/*
+==================
+BotBatchVisTraces
+
+Runs the first BotEntityVisible trace of every bot that thinks this frame
+to each of its enemies as one batch, which the engine can spread over its
+job threads.  Nothing moves until the bots' user commands run after the
+think loop, so the results hold for the whole loop.
+==================
+*/
+static void BotBatchVisTraces(int elapsed_time, int thinktime) {
+	int i, j;
+	playerState_t ps;
+	aas_entityinfo_t entinfo;
+	traceRequest_t *req;
+	gentity_t *other;
+
+	visTraces.valid = qfalse;
+	visTraces.numTraces = 0;
+
+	// only worth the extra traces for enemies out of view when they run on several threads
+	if (trap_Cvar_VariableIntegerValue("sv_traceThreads") <= 1) {
+		return;
+	}
+
+	memset(visTraces.index, 0, sizeof(visTraces.index));
+
+	for (i = 0; i < MAX_CLIENTS; i++) {
+		if (!botstates[i] || !botstates[i]->inuse) {
+			continue;
+		}
+		if (botstates[i]->botthink_residual + elapsed_time < thinktime) {
+			continue;
+		}
+		if (g_entities[i].client->pers.connected != CON_CONNECTED || !BotAI_GetClientState(i, &ps)) {
+			continue;
+		}
+
+		for (j = 0; j < level.maxclients; j++) {
+			other = &g_entities[j];
+			if (j == i || !other->inuse || !other->client) {
+				continue;
+			}
+			if (other->client->pers.connected != CON_CONNECTED ||
+				other->client->sess.sessionTeam == TEAM_SPECTATOR) {
+				continue;
+			}
+			if (OnSameTeam(&g_entities[i], other)) {
+				continue;
+			}
+			BotEntityInfo(j, &entinfo);
+			if (!entinfo.valid) {
+				continue;
+			}
+			if (visTraces.numTraces >= MAX_VISTRACES) {
+				break;
+			}
+
+			// the same eye and bounding box middle BotEntityVisible traces between
+			req = &visTraces.requests[visTraces.numTraces];
+			VectorCopy(ps.origin, req->start);
+			req->start[2] += ps.viewheight;
+			VectorAdd(entinfo.mins, entinfo.maxs, req->end);
+			VectorScale(req->end, 0.5, req->end);
+			VectorAdd(entinfo.origin, req->end, req->end);
+			VectorClear(req->mins);
+			VectorClear(req->maxs);
+			req->passEntityNum = i;
+			req->contentmask = CONTENTS_SOLID | CONTENTS_PLAYERCLIP;
+			req->capsule = qfalse;
+			// BotEntityVisible doesn't trace to enemies outside the potentially visible set
+			if (!trap_InPVSIgnorePortals(req->start, req->end)) {
+				continue;
+			}
+
+			visTraces.index[i][j] = ++visTraces.numTraces;
+		}
+	}
+
+	if (visTraces.numTraces) {
+		trap_TraceBatch(visTraces.results, visTraces.requests, visTraces.numTraces);
+		visTraces.valid = qtrue;
+	}
 }
 
 /*
@@ -1634,6 +1845,8 @@ int BotAISetupClient(int client, struct bot_settings_s *settings, qboolean resta
 		return qfalse;
 	}
 
+	memset(&thinkStats[client], 0, sizeof(thinkStats[client]));
+
 	// load the bot character
 	bs->character = trap_BotLoadCharacter(settings->characterfile, settings->skill);
 	if (!bs->character) {
@@ -1835,6 +2048,9 @@ int BotAILoadMap(int restart) {
 
 	BotSetupDeathmatchAI();
 
+	// the AAS entities start out unlinked
+	entityResend = qtrue;
+
 	return qtrue;
 }
 
@@ -1915,17 +2131,179 @@ static void BotAIObserve(void) {
 
 /*
 ==================
-BotAIStartFrame
+BotAI_AllowLTGRefresh
+
+Returns qtrue when the bot may replace a long term goal it still has this
+frame, qfalse puts that off to one of its next thinks
 ==================
 */
-int BotAIStartFrame(int time) {
+qboolean BotAI_AllowLTGRefresh(void) {
+	if (ltgRefreshes >= MAX_LTGREFRESHES) {
+		return qfalse;
+	}
+	ltgRefreshes++;
+	return qtrue;
+}
+
+/*
+==================
+BotAIResetStats
+==================
+*/
+static void BotAIResetStats(void) {
+	memset(thinkStats, 0, sizeof(thinkStats));
+	statsFrames = 0;
+	statsMaxFrameMsec = 0;
+	statsBudgetFrames = 0;
+}
+
+/*
+==================
+Svcmd_BotStats_f
+
+Prints the think times of the bots, "bot_stats reset" clears them
+==================
+*/
+void Svcmd_BotStats_f(void) {
+	char arg[MAX_TOKEN_CHARS];
+	char netname[MAX_NETNAME];
+	const botThinkStats_t *stats;
 	int i;
-	gentity_t *ent;
+
+	trap_Argv(1, arg, sizeof(arg));
+	if (!Q_stricmp(arg, "reset")) {
+		BotAIResetStats();
+		return;
+	}
+
+	G_Printf("num name             thinks  avg msec  max msec  deferred\n");
+	for (i = 0; i < MAX_CLIENTS; i++) {
+		if (!botstates[i] || !botstates[i]->inuse) {
+			continue;
+		}
+		stats = &thinkStats[i];
+		G_Printf("%3d %-16s %6d %9.2f %9d %9d\n", i, ClientName(i, netname, sizeof(netname)), stats->thinks,
+				 stats->thinks ? (float)stats->msec / stats->thinks : 0.0f, stats->maxMsec, stats->deferred);
+	}
+	G_Printf("%d frames with bot thinks, at most %d msec in one frame\n", statsFrames, statsMaxFrameMsec);
+	if (bot_maxframetime.integer > 0) {
+		G_Printf("%d frames put off thinks to stay within bot_maxframetime %d\n", statsBudgetFrames,
+				 bot_maxframetime.integer);
+	}
+}
+
+/*
+==================
+BotEntityState
+
+Fills in what the botlib knows about an entity, returns qfalse for
+entities it shouldn't see
+==================
+*/
+static qboolean BotEntityState(int entnum, bot_entitystate_t *state) {
+	gentity_t *ent = &g_entities[entnum];
+
+	if (!ent->inuse || !ent->r.linked || (ent->r.svFlags & SVF_NOCLIENT))
+		return qfalse;
+	// do not update missiles	// cyr, but do update ducks !
+	if (ent->s.eType == ET_MISSILE && ent->s.weapon != WP_KILLERDUCKS)
+		return qfalse;
+	// do not update event only entities
+	if (ent->s.eType > ET_EVENTS)
+		return qfalse;
+
+	memset(state, 0, sizeof(bot_entitystate_t));
+	VectorCopy(ent->r.currentOrigin, state->origin);
+	if (entnum < MAX_CLIENTS) {
+		VectorCopy(ent->s.apos.trBase, state->angles);
+	} else {
+		VectorCopy(ent->r.currentAngles, state->angles);
+	}
+	VectorCopy(ent->s.origin2, state->old_origin);
+	VectorCopy(ent->r.mins, state->mins);
+	VectorCopy(ent->r.maxs, state->maxs);
+	state->type = ent->s.eType;
+	state->flags = ent->s.eFlags;
+	if (ent->r.bmodel)
+		state->solid = SOLID_BSP;
+	else
+		state->solid = SOLID_BBOX;
+	state->groundent = ent->s.groundEntityNum;
+	state->modelindex = ent->s.modelindex;
+	state->modelindex2 = ent->s.modelindex2;
+	state->frame = ent->s.frame;
+	state->event = ent->s.event;
+	state->eventParm = ent->s.eventParm;
+	state->powerups = ent->s.powerups;
+	state->legsAnim = ent->s.legsAnim;
+	state->torsoAnim = ent->s.torsoAnim;
+	state->weapon = ent->s.weapon;
+	return qtrue;
+}
+
+/*
+==================
+BotUpdateEntities
+
+Sends the botlib the entities that changed since the last update, the
+static items and movers that didn't are kept as they are and not
+relinked into the AAS areas
+==================
+*/
+static void BotUpdateEntities(void) {
 	bot_entitystate_t state;
+	const int *a, *b;
+	int i, j, bit, numInts, numChanged;
+	qboolean wasLive;
+
+	numInts = sizeof(state) / sizeof(int);
+	numChanged = 0;
+	for (i = 0; i < MAX_GENTITIES; i++) {
+		bit = 1 << (i & 7);
+		wasLive = (entityLive[i >> 3] & bit) != 0;
+
+		if (!BotEntityState(i, &state)) {
+			entityLive[i >> 3] &= ~bit;
+			continue;
+		}
+		entityLive[i >> 3] |= bit;
+
+		if (wasLive && !entityResend) {
+			a = (const int *)&state;
+			b = (const int *)&entityStates[i];
+			for (j = 0; j < numInts; j++) {
+				if (a[j] != b[j])
+					break;
+			}
+			if (j == numInts)
+				continue;
+		}
+
+		entityStates[i] = state;
+		entityChanged[numChanged++] = i;
+	}
+	entityResend = qfalse;
+
+	// the botlib lost track of some entities, they come back next update
+	if (trap_BotLibUpdateEntities(MAX_GENTITIES, entityLive, numChanged, entityChanged, entityStates) ==
+		BLERR_ENTITYSTATEMISSING)
+		entityResend = qtrue;
+}
+
+/*
+==================
+BotAIStartFrame
+==================
+*/
+int BotAIStartFrame(int time) {
+	int i, j;
 	int elapsed_time, thinktime;
+	int firstThinker, numThinks, frameMsec, startMsec, msec;
+	qboolean deferred;
 	static int local_time;
 	static int botlib_residual;
 	static int lastbotthink_time;
+	static int nextThinker;
 
 	G_CheckBotSpawn();
 
@@ -1947,6 +2325,7 @@ int BotAIStartFrame(int time) {
 	trap_Cvar_Update(&bot_nochat);
 	trap_Cvar_Update(&bot_testrchat);
 	trap_Cvar_Update(&bot_thinktime);
+	trap_Cvar_Update(&bot_maxframetime);
 	trap_Cvar_Update(&bot_memorydump);
 	trap_Cvar_Update(&bot_saveroutingcache);
 	trap_Cvar_Update(&bot_pause);
@@ -2042,64 +2421,13 @@ int BotAIStartFrame(int time) {
 
 		trap_BotLibStartFrame((float)time / 1000);
 
-		if (!trap_AAS_Initialized())
+		if (!trap_AAS_Initialized()) {
+			entityResend = qtrue;
 			return qfalse;
-
-		// update entities in the botlib
-		for (i = 0; i < MAX_GENTITIES; i++) {
-			ent = &g_entities[i];
-			if (!ent->inuse) {
-				trap_BotLibUpdateEntity(i, NULL);
-				continue;
-			}
-			if (!ent->r.linked) {
-				trap_BotLibUpdateEntity(i, NULL);
-				continue;
-			}
-			if (ent->r.svFlags & SVF_NOCLIENT) {
-				trap_BotLibUpdateEntity(i, NULL);
-				continue;
-			}
-			// do not update missiles	// cyr, but do update ducks !
-			if (ent->s.eType == ET_MISSILE && ent->s.weapon != WP_KILLERDUCKS) {
-				trap_BotLibUpdateEntity(i, NULL);
-				continue;
-			}
-			// do not update event only entities
-			if (ent->s.eType > ET_EVENTS) {
-				trap_BotLibUpdateEntity(i, NULL);
-				continue;
-			}
-			memset(&state, 0, sizeof(bot_entitystate_t));
-			VectorCopy(ent->r.currentOrigin, state.origin);
-			if (i < MAX_CLIENTS) {
-				VectorCopy(ent->s.apos.trBase, state.angles);
-			} else {
-				VectorCopy(ent->r.currentAngles, state.angles);
-			}
-			VectorCopy(ent->s.origin2, state.old_origin);
-			VectorCopy(ent->r.mins, state.mins);
-			VectorCopy(ent->r.maxs, state.maxs);
-			state.type = ent->s.eType;
-			state.flags = ent->s.eFlags;
-			if (ent->r.bmodel)
-				state.solid = SOLID_BSP;
-			else
-				state.solid = SOLID_BBOX;
-			state.groundent = ent->s.groundEntityNum;
-			state.modelindex = ent->s.modelindex;
-			state.modelindex2 = ent->s.modelindex2;
-			state.frame = ent->s.frame;
-			state.event = ent->s.event;
-			state.eventParm = ent->s.eventParm;
-			state.powerups = ent->s.powerups;
-			state.legsAnim = ent->s.legsAnim;
-			state.torsoAnim = ent->s.torsoAnim;
-			state.weapon = ent->s.weapon;
-			//
-			trap_BotLibUpdateEntity(i, &state);
 		}
 
+		BotUpdateEntities();
+
 		BotAIRegularUpdate();
 	}
 
@@ -2107,8 +2435,19 @@ int BotAIStartFrame(int time) {
 
 	BotAIObserve(); // choose a bot to observe
 
-	// execute scheduled bot AI
-	for (i = 0; i < MAX_CLIENTS; i++) {
+	// the entities may have moved since the last frame
+	visFrame++;
+	BotBatchVisTraces(elapsed_time, thinktime);
+
+	// execute scheduled bot AI, starting with the bots put off last frame
+	ltgRefreshes = 0;
+	frameMsec = 0;
+	numThinks = 0;
+	deferred = qfalse;
+	firstThinker = nextThinker;
+	nextThinker = 0;
+	for (j = 0; j < MAX_CLIENTS; j++) {
+		i = (firstThinker + j) % MAX_CLIENTS;
 		if (!botstates[i] || !botstates[i]->inuse) {
 			continue;
 		}
@@ -2116,6 +2455,17 @@ int BotAIStartFrame(int time) {
 		botstates[i]->botthink_residual += elapsed_time;
 		//
 		if (botstates[i]->botthink_residual >= thinktime) {
+			// put the think off to the next frame when the bots are over budget,
+			// the bot is due again right away but doesn't build up a backlog
+			if (bot_maxframetime.integer > 0 && numThinks && frameMsec >= bot_maxframetime.integer) {
+				thinkStats[i].deferred++;
+				if (!deferred) {
+					nextThinker = i;
+					deferred = qtrue;
+				}
+				botstates[i]->botthink_residual = thinktime;
+				continue;
+			}
 			botstates[i]->botthink_residual -= thinktime;
 
 			if (!trap_AAS_Initialized())
@@ -2123,10 +2473,31 @@ int BotAIStartFrame(int time) {
 
 			if (g_entities[i].client->pers.connected == CON_CONNECTED) {
 				botstates[i]->frametime = time; // cyr, clock frame duration
+				startMsec = trap_Milliseconds();
 				BotAI(i, (float)thinktime / 1000);
+				msec = trap_Milliseconds() - startMsec;
+
+				thinkStats[i].thinks++;
+				thinkStats[i].msec += msec;
+				if (msec > thinkStats[i].maxMsec) {
+					thinkStats[i].maxMsec = msec;
+				}
+				frameMsec += msec;
+				numThinks++;
 			}
 		}
 	}
+	visTraces.valid = qfalse;
+
+	if (numThinks) {
+		statsFrames++;
+		if (frameMsec > statsMaxFrameMsec) {
+			statsMaxFrameMsec = frameMsec;
+		}
+		if (deferred) {
+			statsBudgetFrames++;
+		}
+	}
 
 	// DeleteDebugLines();
 
@@ -2214,6 +2585,10 @@ static int BotInitLibrary(void) {
 	trap_Cvar_VariableStringBuffer("bot_saveroutingcache", buf, sizeof(buf));
 	if (strlen(buf))
 		trap_BotLibVarSet("saveroutingcache", buf);
+	// build the portal routing after loading, and save it
+	trap_Cvar_VariableStringBuffer("bot_precomputeroutes", buf, sizeof(buf));
+	if (strlen(buf))
+		trap_BotLibVarSet("precomputeroutes", buf);
 	// reload instead of cache bot character files
 	trap_Cvar_VariableStringBuffer("bot_reloadcharacters", buf, sizeof(buf));
 	if (!strlen(buf))
@@ -2244,6 +2619,7 @@ int BotAISetup(int restart) {
 	int errnum;
 
 	trap_Cvar_Register(&bot_thinktime, "bot_thinktime", "100", CVAR_CHEAT);
+	trap_Cvar_Register(&bot_maxframetime, "bot_maxframetime", "0", 0);
 	trap_Cvar_Register(&bot_memorydump, "bot_memorydump", "0", CVAR_CHEAT);
 	trap_Cvar_Register(&bot_saveroutingcache, "bot_saveroutingcache", "0", CVAR_CHEAT);
 	trap_Cvar_Register(&bot_pause, "bot_pause", "0", CVAR_CHEAT);
@@ -2269,6 +2645,7 @@ int BotAISetup(int restart) {
 
 	// initialize the bot states
 	memset(botstates, 0, sizeof(botstates));
+	BotAIResetStats();
 
 	ResetWaypoints();
 
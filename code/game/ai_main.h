@@ -373,6 +373,11 @@ void QDECL BotAI_Print(int type, const char *fmt, ...) __attribute__((format(pri
 void QDECL QDECL BotAI_BotInitialChat(bot_state_t *bs, const char *type, ...);
 void BotAI_Trace(bsp_trace_t *bsptrace, vec3_t start, vec3_t mins, vec3_t maxs, vec3_t end, int passent,
 				 int contentmask);
+qboolean BotAI_VisTrace(bsp_trace_t *bsptrace, int viewer, int ent, vec3_t start, vec3_t end, int passent,
+						int contentmask);
+qboolean BotAI_SharedVisibility(int viewer, int ent, const vec3_t eye, float *vis);
+void BotAI_ShareVisibility(int viewer, int ent, const vec3_t eye, float vis);
 int BotAI_GetClientState(int clientNum, playerState_t *state);
 int BotAI_GetEntityState(int entityNum, entityState_t *state);
 int BotAI_GetSnapshotEntity(int clientNum, int sequence, entityState_t *state);
+qboolean BotAI_AllowLTGRefresh(void);
@@ -173,16 +173,6 @@ loop:
 
 //==================================================================================
 
-size_t strlen(const char *string) {
-	const char *s;
-
-	s = string;
-	while (*s) {
-		s++;
-	}
-	return s - string;
-}
-
 char *strcat(char *strDestination, const char *strSource) {
 	char *s;
 
@@ -277,6 +267,21 @@ int toupper(int c) {
 	return c;
 }
 
+// strlen and memmove are engine traps like memset and memcpy, see the
+// *_syscalls.asm files
+
+#if 0
+
+size_t strlen(const char *string) {
+	const char *s;
+
+	s = string;
+	while (*s) {
+		s++;
+	}
+	return s - string;
+}
+
 void *memmove(void *dest, const void *src, size_t count) {
 	size_t i;
 
@@ -297,8 +302,6 @@ void *memmove(void *dest, const void *src, size_t count) {
 	return dest;
 }
 
-#if 0
-
 double floor( double x ) {
 	return (int)(x + 0x40000000) - 0x40000000;
 }
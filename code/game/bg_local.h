@@ -33,6 +33,68 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 #define OVERCLIP 1.001f
 
+// native x86-64 builds keep the clipping vectors in SSE registers, every
+// lane does the same operations in the same order as the vec3_t macros,
+// so the results stay bit identical to the QVM
+#if idx64 && !defined(Q3_VM)
+#define PM_SIMD
+#endif
+
+#ifdef PM_SIMD
+#include <xmmintrin.h>
+
+// x, y, z and a zero w, without reading past the vec3_t
+static ID_INLINE __m128 PM_LoadVec(const vec3_t v) {
+	return _mm_movelh_ps(_mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)v), _mm_load_ss(&v[2]));
+}
+
+static ID_INLINE void PM_StoreVec(vec3_t out, __m128 v) {
+	_mm_storel_pi((__m64 *)out, v);
+	_mm_store_ss(&out[2], _mm_movehl_ps(v, v));
+}
+
+// summed in the same order as DotProduct
+static ID_INLINE float PM_DotVec(__m128 a, __m128 b) {
+	__m128 m = _mm_mul_ps(a, b);
+	__m128 s = _mm_add_ss(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(1, 1, 1, 1)));
+	return _mm_cvtss_f32(_mm_add_ss(s, _mm_movehl_ps(m, m)));
+}
+
+static ID_INLINE __m128 PM_ScaleVec(__m128 v, float scale) {
+	return _mm_mul_ps(v, _mm_set1_ps(scale));
+}
+
+static ID_INLINE __m128 PM_CrossVec(__m128 a, __m128 b) {
+	__m128 a1 = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+	__m128 b1 = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 1, 0, 2));
+	__m128 a2 = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 1, 0, 2));
+	__m128 b2 = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+	return _mm_sub_ps(_mm_mul_ps(a1, b1), _mm_mul_ps(a2, b2));
+}
+
+// same as VectorNormalize
+static ID_INLINE __m128 PM_NormalizeVec(__m128 v) {
+	float length = PM_DotVec(v, v);
+
+	if (length) {
+		v = PM_ScaleVec(v, 1 / (float)sqrt(length));
+	}
+	return v;
+}
+
+// same as PM_ClipVelocity
+static ID_INLINE __m128 PM_ClipVec(__m128 in, __m128 normal, float overbounce) {
+	float backoff = PM_DotVec(in, normal);
+
+	if (backoff < 0) {
+		backoff *= overbounce;
+	} else {
+		backoff /= overbounce;
+	}
+	return _mm_sub_ps(in, PM_ScaleVec(normal, backoff));
+}
+#endif
+
 // all of the locals will be zeroed before each
 // pmove, just to make damn sure we don't have
 // any differences when running on client or server
@@ -138,6 +138,9 @@ Slide off of the impacting surface
 ==================
 */
 void PM_ClipVelocity(vec3_t in, vec3_t normal, vec3_t out, float overbounce) {
+#ifdef PM_SIMD
+	PM_StoreVec(out, PM_ClipVec(PM_LoadVec(in), PM_LoadVec(normal), overbounce));
+#else
 	float backoff;
 	float change;
 	int i;
@@ -154,6 +157,7 @@ void PM_ClipVelocity(vec3_t in, vec3_t normal, vec3_t out, float overbounce) {
 		change = normal[i] * backoff;
 		out[i] = in[i] - change;
 	}
+#endif
 }
 
 /*
@@ -34,6 +34,204 @@ output: origin, velocity, impacts, stairup boolean
 
 */
 
+#define MAX_CLIP_PLANES 5
+
+/*
+==================
+PM_ClipToPlanes
+
+Modifies the velocity so it parallels all of the clip planes, the end
+velocity too when gravity is applied.  Returns qfalse when the move is
+stuck between three planes.
+==================
+*/
+#ifdef PM_SIMD
+static float PM_PlaneDot(const vec3_t a, const vec3_t b) {
+	return PM_DotVec(PM_LoadVec(a), PM_LoadVec(b));
+}
+
+static qboolean PM_ClipToPlanes(vec3_t planes[MAX_CLIP_PLANES], int numplanes, vec3_t endVelocity, qboolean gravity) {
+	__m128 planev[MAX_CLIP_PLANES];
+	__m128 velocity, endVel;
+	__m128 clipVelocity, endClipVelocity;
+	__m128 dir;
+	float into;
+	int i, j, k;
+
+	velocity = PM_LoadVec(pm->ps->velocity);
+	endVel = endClipVelocity = _mm_setzero_ps();
+	if (gravity) {
+		endVel = PM_LoadVec(endVelocity);
+	}
+	for (i = 0; i < numplanes; i++) {
+		planev[i] = PM_LoadVec(planes[i]);
+	}
+
+	// find a plane that it enters
+	for (i = 0; i < numplanes; i++) {
+		into = PM_DotVec(velocity, planev[i]);
+		if (into >= 0.1) {
+			continue; // move doesn't interact with the plane
+		}
+
+		// see how hard we are hitting things
+		if (-into > pml.impactSpeed) {
+			pml.impactSpeed = -into;
+		}
+
+		// slide along the plane
+		clipVelocity = PM_ClipVec(velocity, planev[i], OVERCLIP);
+
+		if (gravity) {
+			// slide along the plane
+			endClipVelocity = PM_ClipVec(endVel, planev[i], OVERCLIP);
+		}
+
+		// see if there is a second plane that the new move enters
+		for (j = 0; j < numplanes; j++) {
+			if (j == i) {
+				continue;
+			}
+			if (PM_DotVec(clipVelocity, planev[j]) >= 0.1) {
+				continue; // move doesn't interact with the plane
+			}
+
+			// try clipping the move to the plane
+			clipVelocity = PM_ClipVec(clipVelocity, planev[j], OVERCLIP);
+
+			if (gravity) {
+				endClipVelocity = PM_ClipVec(endClipVelocity, planev[j], OVERCLIP);
+			}
+
+			// see if it goes back into the first clip plane
+			if (PM_DotVec(clipVelocity, planev[i]) >= 0) {
+				continue;
+			}
+
+			// slide the original velocity along the crease
+			dir = PM_NormalizeVec(PM_CrossVec(planev[i], planev[j]));
+			clipVelocity = PM_ScaleVec(dir, PM_DotVec(dir, velocity));
+
+			if (gravity) {
+				endClipVelocity = PM_ScaleVec(dir, PM_DotVec(dir, endVel));
+			}
+
+			// see if there is a third plane the the new move enters
+			for (k = 0; k < numplanes; k++) {
+				if (k == i || k == j) {
+					continue;
+				}
+				if (PM_DotVec(clipVelocity, planev[k]) >= 0.1) {
+					continue; // move doesn't interact with the plane
+				}
+
+				return qfalse;
+			}
+		}
+
+		// if we have fixed all interactions, try another move
+		PM_StoreVec(pm->ps->velocity, clipVelocity);
+
+		if (gravity) {
+			PM_StoreVec(endVelocity, endClipVelocity);
+		}
+
+		break;
+	}
+
+	return qtrue;
+}
+#else
+#define PM_PlaneDot(a, b) DotProduct(a, b)
+
+static qboolean PM_ClipToPlanes(vec3_t planes[MAX_CLIP_PLANES], int numplanes, vec3_t endVelocity, qboolean gravity) {
+	vec3_t clipVelocity, endClipVelocity;
+	vec3_t dir;
+	float d;
+	float into;
+	int i, j, k;
+
+	// find a plane that it enters
+	for (i = 0; i < numplanes; i++) {
+		into = DotProduct(pm->ps->velocity, planes[i]);
+		if (into >= 0.1) {
+			continue; // move doesn't interact with the plane
+		}
+
+		// see how hard we are hitting things
+		if (-into > pml.impactSpeed) {
+			pml.impactSpeed = -into;
+		}
+
+		// slide along the plane
+		PM_ClipVelocity(pm->ps->velocity, planes[i], clipVelocity, OVERCLIP);
+
+		if (gravity) {
+			// slide along the plane
+			PM_ClipVelocity(endVelocity, planes[i], endClipVelocity, OVERCLIP);
+		}
+
+		// see if there is a second plane that the new move enters
+		for (j = 0; j < numplanes; j++) {
+			if (j == i) {
+				continue;
+			}
+			if (DotProduct(clipVelocity, planes[j]) >= 0.1) {
+				continue; // move doesn't interact with the plane
+			}
+
+			// try clipping the move to the plane
+			PM_ClipVelocity(clipVelocity, planes[j], clipVelocity, OVERCLIP);
+
+			if (gravity) {
+				PM_ClipVelocity(endClipVelocity, planes[j], endClipVelocity, OVERCLIP);
+			}
+
+			// see if it goes back into the first clip plane
+			if (DotProduct(clipVelocity, planes[i]) >= 0) {
+				continue;
+			}
+
+			// slide the original velocity along the crease
+			CrossProduct(planes[i], planes[j], dir);
+			VectorNormalize(dir);
+			d = DotProduct(dir, pm->ps->velocity);
+			VectorScale(dir, d, clipVelocity);
+
+			if (gravity) {
+				CrossProduct(planes[i], planes[j], dir);
+				VectorNormalize(dir);
+				d = DotProduct(dir, endVelocity);
+				VectorScale(dir, d, endClipVelocity);
+			}
+
+			// see if there is a third plane the the new move enters
+			for (k = 0; k < numplanes; k++) {
+				if (k == i || k == j) {
+					continue;
+				}
+				if (DotProduct(clipVelocity, planes[k]) >= 0.1) {
+					continue; // move doesn't interact with the plane
+				}
+
+				return qfalse;
+			}
+		}
+
+		// if we have fixed all interactions, try another move
+		VectorCopy(clipVelocity, pm->ps->velocity);
+
+		if (gravity) {
+			VectorCopy(endClipVelocity, endVelocity);
+		}
+
+		break;
+	}
+
+	return qtrue;
+}
+#endif
+
 /*
 ==================
 PM_SlideMove
@@ -41,22 +239,16 @@ PM_SlideMove
 Returns qtrue if the velocity was clipped in some way
 ==================
 */
-#define MAX_CLIP_PLANES 5
 qboolean PM_SlideMove(qboolean gravity) {
 	int bumpcount, numbumps;
-	vec3_t dir;
-	float d;
 	int numplanes;
 	vec3_t planes[MAX_CLIP_PLANES];
 	vec3_t primal_velocity;
-	vec3_t clipVelocity;
-	int i, j, k;
+	int i;
 	trace_t trace;
 	vec3_t end;
 	float time_left;
-	float into;
 	vec3_t endVelocity;
-	vec3_t endClipVelocity;
 
 	numbumps = 4;
 
@@ -127,7 +319,7 @@ qboolean PM_SlideMove(qboolean gravity) {
 		// non-axial planes
 		//
 		for (i = 0; i < numplanes; i++) {
-			if (DotProduct(trace.plane.normal, planes[i]) > 0.99) {
+			if (PM_PlaneDot(trace.plane.normal, planes[i]) > 0.99) {
 				VectorAdd(trace.plane.normal, pm->ps->velocity, pm->ps->velocity);
 				break;
 			}
@@ -141,84 +333,10 @@ qboolean PM_SlideMove(qboolean gravity) {
 		//
 		// modify velocity so it parallels all of the clip planes
 		//
-
-		// find a plane that it enters
-		for (i = 0; i < numplanes; i++) {
-			into = DotProduct(pm->ps->velocity, planes[i]);
-			if (into >= 0.1) {
-				continue; // move doesn't interact with the plane
-			}
-
-			// see how hard we are hitting things
-			if (-into > pml.impactSpeed) {
-				pml.impactSpeed = -into;
-			}
-
-			// slide along the plane
-			PM_ClipVelocity(pm->ps->velocity, planes[i], clipVelocity, OVERCLIP);
-
-			if (gravity) {
-				// slide along the plane
-				PM_ClipVelocity(endVelocity, planes[i], endClipVelocity, OVERCLIP);
-			}
-
-			// see if there is a second plane that the new move enters
-			for (j = 0; j < numplanes; j++) {
-				if (j == i) {
-					continue;
-				}
-				if (DotProduct(clipVelocity, planes[j]) >= 0.1) {
-					continue; // move doesn't interact with the plane
-				}
-
-				// try clipping the move to the plane
-				PM_ClipVelocity(clipVelocity, planes[j], clipVelocity, OVERCLIP);
-
-				if (gravity) {
-					PM_ClipVelocity(endClipVelocity, planes[j], endClipVelocity, OVERCLIP);
-				}
-
-				// see if it goes back into the first clip plane
-				if (DotProduct(clipVelocity, planes[i]) >= 0) {
-					continue;
-				}
-
-				// slide the original velocity along the crease
-				CrossProduct(planes[i], planes[j], dir);
-				VectorNormalize(dir);
-				d = DotProduct(dir, pm->ps->velocity);
-				VectorScale(dir, d, clipVelocity);
-
-				if (gravity) {
-					CrossProduct(planes[i], planes[j], dir);
-					VectorNormalize(dir);
-					d = DotProduct(dir, endVelocity);
-					VectorScale(dir, d, endClipVelocity);
-				}
-
-				// see if there is a third plane the the new move enters
-				for (k = 0; k < numplanes; k++) {
-					if (k == i || k == j) {
-						continue;
-					}
-					if (DotProduct(clipVelocity, planes[k]) >= 0.1) {
-						continue; // move doesn't interact with the plane
-					}
-
-					// stop dead at a tripple plane interaction
-					VectorClear(pm->ps->velocity);
-					return qtrue;
-				}
-			}
-
-			// if we have fixed all interactions, try another move
-			VectorCopy(clipVelocity, pm->ps->velocity);
-
-			if (gravity) {
-				VectorCopy(endClipVelocity, endVelocity);
-			}
-
-			break;
+		if (!PM_ClipToPlanes(planes, numplanes, endVelocity, gravity)) {
+			// stop dead at a tripple plane interaction
+			VectorClear(pm->ps->velocity);
+			return qtrue;
 		}
 	}
 
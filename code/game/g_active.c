@@ -936,6 +936,37 @@ void ClientThink(int clientNum) {
 	}
 }
 
+/*
+==================
+ClientThinkBatch
+
+Several new commands have arrived from the client, they are run in
+order the same as separate ClientThink calls
+==================
+*/
+void ClientThinkBatch(int clientNum) {
+	usercmd_t cmds[MAX_THINK_USERCMDS];
+	gentity_t *ent;
+	int i, numCmds;
+
+	ent = g_entities + clientNum;
+	numCmds = trap_GetUsercmds(clientNum, cmds, MAX_THINK_USERCMDS);
+
+	for (i = 0; i < numCmds; i++) {
+		// may have been kicked during the last command
+		if (ent->client->pers.connected == CON_DISCONNECTED) {
+			break;
+		}
+
+		ent->client->pers.cmd = cmds[i];
+		ent->client->lastCmdTime = level.time;
+
+		if (!(ent->r.svFlags & SVF_BOT) && !g_synchronousClients.integer) {
+			ClientThink_real(ent);
+		}
+	}
+}
+
 void G_RunClient(gentity_t *ent) {
 	if (!(ent->r.svFlags & SVF_BOT) && !g_synchronousClients.integer) {
 		return;
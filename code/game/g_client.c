@@ -515,6 +515,7 @@ void CopyToBodyQue(gentity_t *ent) {
 	body->timestamp = level.time;
 	body->physicsObject = qtrue;
 	body->physicsBounce = 0; // don't bounce
+	G_PushablesChanged();
 	if (body->s.groundEntityNum == ENTITYNUM_NONE) {
 		body->s.pos.trType = TR_GRAVITY;
 		body->s.pos.trTime = level.time;
@@ -778,6 +779,7 @@ void ClientUserinfoChanged(int clientNum) {
 	char c1[MAX_INFO_STRING];
 	char c2[MAX_INFO_STRING];
 	char userinfo[MAX_INFO_STRING];
+	static infoDict_t info;
 
 	ent = g_entities + clientNum;
 	client = ent->client;
@@ -791,14 +793,23 @@ void ClientUserinfoChanged(int clientNum) {
 		trap_DropClient(clientNum, "Invalid userinfo");
 	}
 
+	Info_DictInit(&info, MAX_INFO_STRING, qfalse);
+	Info_DictParse(&info, userinfo);
+
 	// check for local client
-	s = Info_ValueForKey(userinfo, "ip");
+	s = Info_DictValue(&info, "ip");
 	if (!strcmp(s, "localhost") || !strcmp(s, "loopback")) {
 		client->pers.localClient = qtrue;
 	}
 
+	// the scoreboard updates are paced to the rate
+	client->pers.rate = atoi(Info_DictValue(&info, "rate"));
+	if (client->pers.rate < 1000) {
+		client->pers.rate = 25000;
+	}
+
 	// check the item prediction
-	s = Info_ValueForKey(userinfo, "cg_predictItems");
+	s = Info_DictValue(&info, "cg_predictItems");
 	if (!atoi(s)) {
 		client->pers.predictItemPickup = qfalse;
 	} else {
@@ -807,7 +818,7 @@ void ClientUserinfoChanged(int clientNum) {
 
 	// set name
 	Q_strncpyz(oldname, client->pers.netname, sizeof(oldname));
-	s = Info_ValueForKey(userinfo, "name");
+	s = Info_DictValue(&info, "name");
 	ClientCleanName(s, client->pers.netname, sizeof(client->pers.netname));
 
 	if ((client->sess.sessionTeam == TEAM_SPECTATOR) || LPSDeadSpec(client)) {
@@ -823,7 +834,7 @@ void ClientUserinfoChanged(int clientNum) {
 		}
 	}
 
-	health = atoi(Info_ValueForKey(userinfo, "handicap"));
+	health = atoi(Info_DictValue(&info, "handicap"));
 	client->pers.maxHealth = health;
 	if (client->pers.maxHealth < 1 || client->pers.maxHealth > 100) {
 		client->pers.maxHealth = 100;
@@ -832,17 +843,17 @@ void ClientUserinfoChanged(int clientNum) {
 
 	// set model
 	if (g_gametype.integer >= GT_TEAM) {
-		Q_strncpyz(model, Info_ValueForKey(userinfo, "team_model"), sizeof(model));
-		Q_strncpyz(headModel, Info_ValueForKey(userinfo, "team_headmodel"), sizeof(headModel));
+		Q_strncpyz(model, Info_DictValue(&info, "team_model"), sizeof(model));
+		Q_strncpyz(headModel, Info_DictValue(&info, "team_headmodel"), sizeof(headModel));
 	} else {
-		Q_strncpyz(model, Info_ValueForKey(userinfo, "model"), sizeof(model));
-		Q_strncpyz(headModel, Info_ValueForKey(userinfo, "headmodel"), sizeof(headModel));
+		Q_strncpyz(model, Info_DictValue(&info, "model"), sizeof(model));
+		Q_strncpyz(headModel, Info_DictValue(&info, "headmodel"), sizeof(headModel));
 	}
 
 	team = client->sess.sessionTeam;
 
 	// teamInfo
-	s = Info_ValueForKey(userinfo, "teamoverlay");
+	s = Info_DictValue(&info, "teamoverlay");
 	if (!*s || atoi(s) != 0) {
 		client->pers.teamInfo = qtrue;
 	} else {
@@ -853,8 +864,8 @@ void ClientUserinfoChanged(int clientNum) {
 	teamLeader = client->sess.teamLeader;
 
 	// colors
-	Q_strncpyz(c1, Info_ValueForKey(userinfo, "color1"), sizeof(c1));
-	Q_strncpyz(c2, Info_ValueForKey(userinfo, "syc_color"), sizeof(c2));
+	Q_strncpyz(c1, Info_DictValue(&info, "color1"), sizeof(c1));
+	Q_strncpyz(c2, Info_DictValue(&info, "syc_color"), sizeof(c2));
 
 	// send over a subset of the userinfo keys so other clients can
 	// print scoreboards, display models, and play custom sounds
@@ -867,7 +878,7 @@ void ClientUserinfoChanged(int clientNum) {
 		s = va("n\\%s\\t\\%i\\model\\%s\\hmodel\\%s\\c1\\%s\\c2\\%s\\hc\\%i\\w\\%i\\l\\%i\\skill\\%s\\tl\\%"
 			   "d\\sl\\%s",
 			   client->pers.netname, team, model, headModel, c1, rnd_str, client->pers.maxHealth, client->sess.wins,
-			   client->sess.losses, Info_ValueForKey(userinfo, "skill"), teamLeader,
+			   client->sess.losses, Info_DictValue(&info, "skill"), teamLeader,
 			   client->sess.selectedlogo);
 		// cyr}
 	} else {
@@ -1176,6 +1187,7 @@ void ClientSpawn(gentity_t *ent) {
 	ent->takedamage = qtrue;
 	ent->inuse = qtrue;
 	ent->classname = "player";
+	G_EntityIndexChanged(ent);
 	ent->r.contents = CONTENTS_BODY;
 	ent->clipmask = MASK_PLAYERSOLID;
 	ent->die = player_die;
@@ -1370,6 +1382,7 @@ void ClientDisconnect(int clientNum) {
 	ent->s.modelindex = 0;
 	ent->inuse = qfalse;
 	ent->classname = "disconnected";
+	G_EntityIndexChanged(ent);
 	ent->client->pers.connected = CON_DISCONNECTED;
 	ent->client->ps.persistant[PERS_TEAM] = TEAM_FREE;
 	ent->client->sess.sessionTeam = TEAM_FREE;
@@ -26,6 +26,139 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 extern vmCvar_t bot_developer;
 
+/*
+==================
+G_ScoreRow
+
+The scoreboard fields of a client after its number, as the "scores"
+and "scored" commands send them
+==================
+*/
+#define SCORE_FIELDS 16
+#define SCORE_PING 1 // the fields that change all the time, an update of
+#define SCORE_TIME 2 // them alone doesn't make a row go out
+
+static void G_ScoreRow(int clientNum, int *fields) {
+	gclient_t *cl;
+
+	cl = &level.clients[clientNum];
+
+	fields[0] = cl->ps.persistant[PERS_SCORE];
+	if (cl->pers.connected == CON_CONNECTING) {
+		fields[SCORE_PING] = -1;
+	} else {
+		fields[SCORE_PING] = cl->ps.ping < 999 ? cl->ps.ping : 999;
+	}
+	fields[SCORE_TIME] = (level.time - cl->pers.enterTime) / 60000;
+	fields[3] = 0; // scoreFlags
+	fields[4] = g_entities[clientNum].s.powerups;
+	if (cl->accuracy_shots) {
+		fields[5] = cl->accuracy_hits * 100 / cl->accuracy_shots;
+	} else {
+		fields[5] = 0;
+	}
+	fields[6] = cl->ps.persistant[PERS_IMPRESSIVE_COUNT];
+	fields[7] = cl->ps.persistant[PERS_EXCELLENT_COUNT];
+	fields[8] = cl->ps.persistant[PERS_GAUNTLET_FRAG_COUNT];
+	fields[9] = cl->ps.persistant[PERS_DEFEND_COUNT];
+	fields[10] = cl->ps.persistant[PERS_ASSIST_COUNT];
+	fields[11] = (cl->ps.persistant[PERS_RANK] == 0 && cl->ps.persistant[PERS_KILLED] == 0) ? 1 : 0;
+	fields[12] = cl->ps.persistant[PERS_CAPTURES];
+	fields[13] = cl->ps.persistant[PERS_SPRAYAWARDS_COUNT] >> 8;
+	fields[14] = cl->ps.persistant[PERS_SPRAYAWARDS_COUNT] & 0xFF;
+	fields[15] = cl->sess.livesleft < 0 ? 0 : cl->sess.livesleft;
+}
+
+/*
+==================
+G_AppendScoreRow
+
+Adds " <clientNum> <fields>" to the string, qfalse if it doesn't fit
+==================
+*/
+static qboolean G_AppendScoreRow(char *string, int *length, int size, int clientNum, const int *fields) {
+	char entry[256];
+	int i, j;
+
+	Com_sprintf(entry, sizeof(entry), " %i", clientNum);
+	j = strlen(entry);
+	for (i = 0; i < SCORE_FIELDS; i++) {
+		Com_sprintf(entry + j, sizeof(entry) - j, " %i", fields[i]);
+		j += strlen(entry + j);
+	}
+
+	if (*length + j >= size) {
+		return qfalse;
+	}
+	strcpy(string + *length, entry);
+	*length += j;
+	return qtrue;
+}
+
+/*
+==================
+SCOREBOARD DELTAS
+
+The rows last computed for the clients are kept with the scoreSequence
+they changed in.  A client that has the rows up to pers.scoreSequence only
+gets the rows that changed after it, the ranking and the team scores in a
+"scored" command.  A client without any rows gets the full "scores".
+==================
+*/
+#define SCOREBOARD_MIN_MSEC 100
+#define SCOREBOARD_MAX_MSEC 1000
+
+static int scoreRows[MAX_CLIENTS][SCORE_FIELDS];
+static int scoreRowSequence[MAX_CLIENTS];
+static int scoreOrder[MAX_CLIENTS];
+static int scoreNumSorted;
+static int scoreTeams[2];
+static int scoreSequence;
+
+/*
+==================
+G_UpdateScoreRows
+
+Starts a new scoreSequence when a row, the ranking or a team score changed
+==================
+*/
+static void G_UpdateScoreRows(void) {
+	int fields[SCORE_FIELDS];
+	int i, j, clientNum;
+	int *row;
+	qboolean changed;
+
+	changed = scoreNumSorted != level.numConnectedClients || scoreTeams[0] != level.teamScores[TEAM_RED] ||
+			  scoreTeams[1] != level.teamScores[TEAM_BLUE];
+	scoreNumSorted = level.numConnectedClients;
+	scoreTeams[0] = level.teamScores[TEAM_RED];
+	scoreTeams[1] = level.teamScores[TEAM_BLUE];
+
+	for (i = 0; i < level.numConnectedClients; i++) {
+		clientNum = level.sortedClients[i];
+		if (scoreOrder[i] != clientNum) {
+			scoreOrder[i] = clientNum;
+			changed = qtrue;
+		}
+
+		row = scoreRows[clientNum];
+		G_ScoreRow(clientNum, fields);
+
+		for (j = 0; j < SCORE_FIELDS; j++) {
+			if (j != SCORE_PING && j != SCORE_TIME && fields[j] != row[j]) {
+				scoreRowSequence[clientNum] = scoreSequence + 1;
+				changed = qtrue;
+				break;
+			}
+		}
+		memcpy(row, fields, sizeof(fields));
+	}
+
+	if (changed) {
+		scoreSequence++;
+	}
+}
+
 /*
 ==================
 DeathmatchScoreboardMessage
@@ -33,55 +166,118 @@ DeathmatchScoreboardMessage
 ==================
 */
 void DeathmatchScoreboardMessage(const gentity_t *ent) {
-	char entry[1024];
 	char string[1000];
 	int stringlength;
-	int i, j;
-	gclient_t *cl;
-	int numSorted, scoreFlags, accuracy, perfect;
+	int i;
+
+	G_UpdateScoreRows();
 
 	// send the latest information on all clients
 	string[0] = 0;
 	stringlength = 0;
-	scoreFlags = 0;
 
-	numSorted = level.numConnectedClients;
+	for (i = 0; i < level.numConnectedClients; i++) {
+		if (!G_AppendScoreRow(string, &stringlength, sizeof(string), level.sortedClients[i],
+							  scoreRows[level.sortedClients[i]])) {
+			break;
+		}
+	}
 
-	for (i = 0; i < numSorted; i++) {
-		int ping;
+	trap_SendServerCommand(ent - g_entities,
+						   va("scores %i %i %i%s", i, level.teamScores[TEAM_RED], level.teamScores[TEAM_BLUE], string));
 
-		cl = &level.clients[level.sortedClients[i]];
+	ent->client->pers.scoreSequence = scoreSequence;
+	ent->client->pers.scoreTime = level.time;
+}
 
-		if (cl->pers.connected == CON_CONNECTING) {
-			ping = -1;
-		} else {
-			ping = cl->ps.ping < 999 ? cl->ps.ping : 999;
+/*
+==================
+G_ScoreboardDelta
+
+Sends the rows that changed since the client's last update, or the full
+scoreboard when they don't fit a command
+==================
+*/
+static void G_ScoreboardDelta(gentity_t *ent) {
+	static const char hex[] = "0123456789abcdef";
+	char order[MAX_CLIENTS * 2 + 1];
+	char string[1000];
+	int stringlength;
+	int i, clientNum, numRows;
+
+	for (i = 0; i < level.numConnectedClients; i++) {
+		clientNum = level.sortedClients[i];
+		order[i * 2] = hex[(clientNum >> 4) & 15];
+		order[i * 2 + 1] = hex[clientNum & 15];
+	}
+	order[i * 2] = 0;
+
+	Com_sprintf(string, sizeof(string), "scored %i %i %i %s", level.teamScores[TEAM_RED],
+				level.teamScores[TEAM_BLUE], level.numConnectedClients, order[0] ? order : "-");
+	stringlength = strlen(string);
+
+	// the row count goes in front of the rows
+	numRows = 0;
+	for (i = 0; i < level.numConnectedClients; i++) {
+		if (scoreRowSequence[level.sortedClients[i]] > ent->client->pers.scoreSequence) {
+			numRows++;
 		}
+	}
+	Com_sprintf(string + stringlength, sizeof(string) - stringlength, " %i", numRows);
+	stringlength += strlen(string + stringlength);
 
-		if (cl->accuracy_shots) {
-			accuracy = cl->accuracy_hits * 100 / cl->accuracy_shots;
-		} else {
-			accuracy = 0;
+	for (i = 0; i < level.numConnectedClients; i++) {
+		clientNum = level.sortedClients[i];
+		if (scoreRowSequence[clientNum] <= ent->client->pers.scoreSequence) {
+			continue;
+		}
+		if (!G_AppendScoreRow(string, &stringlength, sizeof(string), clientNum, scoreRows[clientNum])) {
+			DeathmatchScoreboardMessage(ent);
+			return;
 		}
-		perfect = (cl->ps.persistant[PERS_RANK] == 0 && cl->ps.persistant[PERS_KILLED] == 0) ? 1 : 0;
-
-		Com_sprintf(entry, sizeof(entry), " %i %i %i %i %i %i %i %i %i %i %i %i %i %i %i %i %i", level.sortedClients[i],
-					cl->ps.persistant[PERS_SCORE], ping, (level.time - cl->pers.enterTime) / 60000, scoreFlags,
-					g_entities[level.sortedClients[i]].s.powerups, accuracy, cl->ps.persistant[PERS_IMPRESSIVE_COUNT],
-					cl->ps.persistant[PERS_EXCELLENT_COUNT], cl->ps.persistant[PERS_GAUNTLET_FRAG_COUNT],
-					cl->ps.persistant[PERS_DEFEND_COUNT], cl->ps.persistant[PERS_ASSIST_COUNT], perfect,
-					cl->ps.persistant[PERS_CAPTURES], (cl->ps.persistant[PERS_SPRAYAWARDS_COUNT] >> 8),
-					cl->ps.persistant[PERS_SPRAYAWARDS_COUNT] & 0xFF,
-					(cl->sess.livesleft < 0 ? 0 : cl->sess.livesleft));
-		j = strlen(entry);
-		if (stringlength + j >= sizeof(string))
-			break;
-		strcpy(string + stringlength, entry);
-		stringlength += j;
 	}
 
-	trap_SendServerCommand(ent - g_entities,
-						   va("scores %i %i %i%s", i, level.teamScores[TEAM_RED], level.teamScores[TEAM_BLUE], string));
+	trap_SendServerCommand(ent - g_entities, string);
+
+	ent->client->pers.scoreSequence = scoreSequence;
+	// hold the next one back for as long as the client's rate needs to
+	// take this one
+	ent->client->pers.scoreTime =
+		level.time + (int)Com_Clamp(SCOREBOARD_MIN_MSEC, SCOREBOARD_MAX_MSEC, stringlength * 1000 / ent->client->pers.rate);
+}
+
+/*
+==================
+G_SendScoreboardUpdates
+
+Called every frame, sends the scoreboard changes to the clients whose
+rate allows another update
+==================
+*/
+void G_SendScoreboardUpdates(void) {
+	gentity_t *ent;
+	int i;
+
+	if (level.scoreboardChanged) {
+		level.scoreboardChanged = qfalse;
+		G_UpdateScoreRows();
+	}
+
+	for (i = 0; i < level.maxclients; i++) {
+		ent = &g_entities[i];
+		if (ent->client->pers.connected != CON_CONNECTED || (ent->r.svFlags & SVF_BOT)) {
+			continue;
+		}
+		if (ent->client->pers.scoreSequence >= scoreSequence || level.time < ent->client->pers.scoreTime) {
+			continue;
+		}
+
+		if (!ent->client->pers.scoreSequence) {
+			DeathmatchScoreboardMessage(ent);
+		} else {
+			G_ScoreboardDelta(ent);
+		}
+	}
 }
 
 /*
@@ -890,75 +890,151 @@ void G_Damage(gentity_t *targ, gentity_t *inflictor, gentity_t *attacker, vec3_t
 	}
 }
 
+// targets whose center traces go to the engine in one trap_TraceBatch call
+#define RADIUS_DAMAGE_BATCH 32
+
+// traces to the corners of the targets whose center can't be seen, they are
+// all read before any damage is done, so a nested explosion may reuse them
+static traceRequest_t cornerRequests[RADIUS_DAMAGE_BATCH * 4];
+static trace_t cornerResults[RADIUS_DAMAGE_BATCH * 4];
+
 /*
 ============
-CanDamage
+CanDamageCorners
 
-Returns qtrue if the inflictor can directly damage the target.  Used for
-explosions and melee attacks.
+Adds the traces to the four corners around the midpoint of the target's
+bounds that CanDamage falls back to if the center trace is blocked.
 ============
 */
-static qboolean CanDamage(const gentity_t *targ, const vec3_t origin) {
-	vec3_t dest;
-	trace_t tr;
+static void CanDamageCorners(const gentity_t *targ, const vec3_t origin, traceRequest_t *requests) {
 	vec3_t midpoint;
+	int i;
 
 	// use the midpoint of the bounds instead of the origin, because
 	// bmodels may have their origin is 0,0,0
 	VectorAdd(targ->r.absmin, targ->r.absmax, midpoint);
 	VectorScale(midpoint, 0.5, midpoint);
 
-	VectorCopy(midpoint, dest);
-	trap_Trace(&tr, origin, vec3_origin, vec3_origin, dest, ENTITYNUM_NONE, MASK_SOLID);
-	if (tr.fraction == 1.0 || tr.entityNum == targ->s.number)
-		return qtrue;
-
 	// this should probably check in the plane of projection,
 	// rather than in world coordinate, and also include Z
-	VectorCopy(midpoint, dest);
-	dest[0] += 15.0;
-	dest[1] += 15.0;
-	trap_Trace(&tr, origin, vec3_origin, vec3_origin, dest, ENTITYNUM_NONE, MASK_SOLID);
-	if (tr.fraction == 1.0)
-		return qtrue;
+	for (i = 0; i < 4; i++) {
+		memset(&requests[i], 0, sizeof(requests[i]));
+		VectorCopy(origin, requests[i].start);
+		VectorCopy(midpoint, requests[i].end);
+		requests[i].end[0] += (i & 2) ? -15.0 : 15.0;
+		requests[i].end[1] += (i & 1) ? -15.0 : 15.0;
+		requests[i].passEntityNum = ENTITYNUM_NONE;
+		requests[i].contentmask = MASK_SOLID;
+	}
+}
 
-	VectorCopy(midpoint, dest);
-	dest[0] += 15.0;
-	dest[1] -= 15.0;
-	trap_Trace(&tr, origin, vec3_origin, vec3_origin, dest, ENTITYNUM_NONE, MASK_SOLID);
-	if (tr.fraction == 1.0)
-		return qtrue;
+/*
+============
+CanDamage
 
-	VectorCopy(midpoint, dest);
-	dest[0] -= 15.0;
-	dest[1] += 15.0;
-	trap_Trace(&tr, origin, vec3_origin, vec3_origin, dest, ENTITYNUM_NONE, MASK_SOLID);
-	if (tr.fraction == 1.0)
-		return qtrue;
+Returns qtrue if the inflictor can directly damage the target.  Used for
+explosions and melee attacks.  centerTrace is the trace from origin to the
+midpoint of the target's bounds, corners the four traces of
+CanDamageCorners, which G_RadiusDamage both runs in batches.
+============
+*/
+static qboolean CanDamage(const gentity_t *targ, const trace_t *centerTrace, const trace_t *corners) {
+	int i;
 
-	VectorCopy(midpoint, dest);
-	dest[0] -= 15.0;
-	dest[1] -= 15.0;
-	trap_Trace(&tr, origin, vec3_origin, vec3_origin, dest, ENTITYNUM_NONE, MASK_SOLID);
-	if (tr.fraction == 1.0)
+	if (centerTrace->fraction == 1.0 || centerTrace->entityNum == targ->s.number)
 		return qtrue;
 
+	for (i = 0; i < 4; i++) {
+		if (corners[i].fraction == 1.0)
+			return qtrue;
+	}
+
 	return qfalse;
 }
 
+/*
+============
+G_RadiusDamageBatch
+============
+*/
+static qboolean G_RadiusDamageBatch(vec3_t origin, gentity_t *attacker, gentity_t **targets, float *points,
+									  int numTargets, int mod) {
+	traceRequest_t requests[RADIUS_DAMAGE_BATCH];
+	trace_t results[RADIUS_DAMAGE_BATCH];
+	qboolean visible[RADIUS_DAMAGE_BATCH];
+	int corners[RADIUS_DAMAGE_BATCH];
+	int numCorners;
+	gentity_t *ent;
+	vec3_t dir;
+	int i;
+	qboolean hitClient = qfalse;
+
+	memset(requests, 0, numTargets * sizeof(requests[0]));
+	for (i = 0; i < numTargets; i++) {
+		ent = targets[i];
+		VectorCopy(origin, requests[i].start);
+		VectorAdd(ent->r.absmin, ent->r.absmax, requests[i].end);
+		VectorScale(requests[i].end, 0.5, requests[i].end);
+		requests[i].passEntityNum = ENTITYNUM_NONE;
+		requests[i].contentmask = MASK_SOLID;
+	}
+	trap_TraceBatch(results, requests, numTargets);
+
+	// the corners of all targets with a blocked center go in a second batch
+	numCorners = 0;
+	for (i = 0; i < numTargets; i++) {
+		corners[i] = -1;
+		if (results[i].fraction == 1.0 || results[i].entityNum == targets[i]->s.number)
+			continue;
+		corners[i] = numCorners;
+		CanDamageCorners(targets[i], origin, &cornerRequests[numCorners]);
+		numCorners += 4;
+	}
+	if (numCorners) {
+		trap_TraceBatch(cornerResults, cornerRequests, numCorners);
+	}
+
+	for (i = 0; i < numTargets; i++) {
+		visible[i] = CanDamage(targets[i], &results[i], corners[i] >= 0 ? &cornerResults[corners[i]] : NULL);
+	}
+
+	for (i = 0; i < numTargets; i++) {
+		ent = targets[i];
+
+		// an earlier target of this batch may have taken it out
+		if (!ent->takedamage)
+			continue;
+
+		if (visible[i]) {
+			if (LogAccuracyHit(ent, attacker)) {
+				hitClient = qtrue;
+			}
+			VectorSubtract(ent->r.currentOrigin, origin, dir);
+			// push the center of mass higher than the origin so players
+			// get knocked into the air more
+			dir[2] += 24;
+			G_Damage(ent, NULL, attacker, dir, origin, (int)points[i], DAMAGE_RADIUS, mod);
+		}
+	}
+
+	return hitClient;
+}
+
 /*
 ============
 G_RadiusDamage
 ============
 */
 qboolean G_RadiusDamage(vec3_t origin, gentity_t *attacker, float damage, float radius, gentity_t *ignore, int mod) {
-	float points, dist;
+	float dist;
 	gentity_t *ent;
 	int entityList[MAX_GENTITIES];
 	int numListedEntities;
+	gentity_t *targets[RADIUS_DAMAGE_BATCH];
+	float points[RADIUS_DAMAGE_BATCH];
+	int numTargets;
 	vec3_t mins, maxs;
 	vec3_t v;
-	vec3_t dir;
 	int i, e;
 	qboolean hitClient = qfalse;
 
@@ -973,6 +1049,7 @@ qboolean G_RadiusDamage(vec3_t origin, gentity_t *attacker, float damage, float
 
 	numListedEntities = trap_EntitiesInBox(mins, maxs, entityList, MAX_GENTITIES);
 
+	numTargets = 0;
 	for (e = 0; e < numListedEntities; e++) {
 		ent = &g_entities[entityList[e]];
 
@@ -997,19 +1074,19 @@ qboolean G_RadiusDamage(vec3_t origin, gentity_t *attacker, float damage, float
 			continue;
 		}
 
-		points = damage * (1.0f - dist / radius);
-
-		if (CanDamage(ent, origin)) {
-			if (LogAccuracyHit(ent, attacker)) {
+		targets[numTargets] = ent;
+		points[numTargets] = damage * (1.0f - dist / radius);
+		if (++numTargets == RADIUS_DAMAGE_BATCH) {
+			if (G_RadiusDamageBatch(origin, attacker, targets, points, numTargets, mod)) {
 				hitClient = qtrue;
 			}
-			VectorSubtract(ent->r.currentOrigin, origin, dir);
-			// push the center of mass higher than the origin so players
-			// get knocked into the air more
-			dir[2] += 24;
-			G_Damage(ent, NULL, attacker, dir, origin, (int)points, DAMAGE_RADIUS, mod);
+			numTargets = 0;
 		}
 	}
 
+	if (numTargets && G_RadiusDamageBatch(origin, attacker, targets, points, numTargets, mod)) {
+		hitClient = qtrue;
+	}
+
 	return hitClient;
 }
@@ -645,6 +645,7 @@ void FinishSpawningItem(gentity_t *ent) {
 	VectorSet(ent->r.maxs, ITEM_RADIUS, ITEM_RADIUS, ITEM_RADIUS);
 
 	ent->s.eType = ET_ITEM;
+	G_PushablesChanged();
 	ent->s.modelindex = ent->item - bg_itemlist; // store item number in modelindex
 	ent->s.modelindex2 = 0;						 // zero indicates this isn't a dropped item
 
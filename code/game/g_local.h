@@ -298,6 +298,9 @@ typedef struct {
 	int voteCount;				 // to prevent people from constantly calling votes
 	int teamVoteCount;			 // to prevent people from constantly calling votes
 	qboolean teamInfo;			 // send team overlay updates?
+	int rate;					 // from the userinfo, paces the scoreboard updates
+	int scoreSequence;			 // scoreboard rows the client has, 0 for none
+	int scoreTime;				 // level.time the next scoreboard update can go out
 } clientPersistant_t;
 
 // this structure is cleared on each ClientSpawn(),
@@ -432,6 +435,8 @@ typedef struct {
 
 	qboolean restarted; // waiting for a map_restart to fire
 
+	qboolean scoreboardChanged; // G_SendScoreboardUpdates has to look for changed rows
+
 	int numConnectedClients;
 	int numNonSpectatorClients;		// includes connecting clients
 	int numPlayingClients;			// connected, non-spectators
@@ -541,11 +546,16 @@ int G_ModelIndex(const char *name);
 int G_SoundIndex(const char *name);
 void G_TeamCommand(team_t team, char *cmd);
 void G_KillBox(gentity_t *ent);
+void G_InitEntityIndex(void);
+void G_EntityIndexChanged(gentity_t *ent);
 gentity_t *G_Find(gentity_t *from, int fieldofs, const char *match);
+int G_FindAll(int fieldofs, const char *match, gentity_t **list, int max);
 gentity_t *G_PickTarget(char *targetname);
 void G_UseTargets(gentity_t *ent, gentity_t *activator);
 void G_SetMovedir(vec3_t angles, vec3_t movedir);
 
+void G_InitEntityLists(void);
+gentity_t *G_NextActiveEntity(gentity_t *from);
 void G_InitGentity(gentity_t *e);
 gentity_t *G_Spawn(void);
 gentity_t *G_TempEntity(vec3_t origin, int event);
@@ -638,6 +648,7 @@ gentity_t *fire_kma(gentity_t *self, vec3_t start, vec3_t dir);
 // g_mover.c
 //
 void G_RunMover(gentity_t *ent);
+void G_PushablesChanged(void);
 void Touch_DoorTrigger(gentity_t *ent, gentity_t *other, trace_t *trace);
 
 //
@@ -694,6 +705,7 @@ void FireWeapon(gentity_t *ent);
 // g_cmds.c
 //
 void DeathmatchScoreboardMessage(const gentity_t *ent);
+void G_SendScoreboardUpdates(void);
 
 //
 // g_main.c
@@ -706,6 +718,7 @@ void CheckTeamLeader(int team);
 void G_RunThink(gentity_t *ent);
 void AddTournamentQueue(gclient_t *client);
 void QDECL G_LogPrintf(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+void G_LogFlush(void);
 void SendScoreboardMessageToAllClients(void);
 void QDECL G_Printf(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
 void QDECL G_Error(const char *fmt, ...) __attribute__((noreturn, format(printf, 1, 2)));
@@ -723,6 +736,7 @@ void ClientCommand(int clientNum);
 // g_active.c
 //
 void ClientThink(int clientNum);
+void ClientThinkBatch(int clientNum);
 void ClientEndFrame(gentity_t *ent);
 void G_RunClient(gentity_t *ent);
 
@@ -788,6 +802,7 @@ void G_RemoveQueuedBotBegin(int clientNum);
 qboolean G_BotConnect(int clientNum, qboolean restart);
 void Svcmd_AddBot_f(void);
 void Svcmd_BotList_f(void);
+void Svcmd_BotStats_f(void);
 void BotInterbreedEndMatch(void);
 
 // ai_main.c
@@ -874,6 +889,7 @@ extern vmCvar_t g_obeliskRegenAmount;
 extern vmCvar_t g_obeliskRespawnDelay;
 extern vmCvar_t g_cubeTimeout;
 extern vmCvar_t g_smoothClients;
+extern vmCvar_t g_antilag;
 extern vmCvar_t pmove_fixed;
 extern vmCvar_t pmove_msec;
 
@@ -906,6 +922,7 @@ int trap_FS_Seek(fileHandle_t f, long offset, int origin); // fsOrigin_t
 void trap_SendConsoleCommand(int exec_when, const char *text);
 void trap_Cvar_Register(vmCvar_t *cvar, const char *var_name, const char *value, int flags);
 void trap_Cvar_Update(vmCvar_t *cvar);
+int trap_Cvar_Generation(void);
 void trap_Cvar_Set(const char *var_name, const char *value);
 int trap_Cvar_VariableIntegerValue(const char *var_name);
 float trap_Cvar_VariableValue(const char *var_name);
@@ -922,6 +939,7 @@ void trap_GetServerinfo(char *buffer, int bufferSize);
 void trap_SetBrushModel(gentity_t *ent, const char *name);
 void trap_Trace(trace_t *results, const vec3_t start, const vec3_t mins, const vec3_t maxs, const vec3_t end,
 				int passEntityNum, int contentmask);
+void trap_TraceBatch(trace_t *results, const traceRequest_t *requests, int numRequests);
 int trap_PointContents(const vec3_t point, int passEntityNum);
 qboolean trap_InPVS(const vec3_t p1, const vec3_t p2);
 qboolean trap_InPVSIgnorePortals(const vec3_t p1, const vec3_t p2);
@@ -934,6 +952,10 @@ qboolean trap_EntityContact(const vec3_t mins, const vec3_t maxs, const gentity_
 int trap_BotAllocateClient(void);
 void trap_BotFreeClient(int clientNum);
 void trap_GetUsercmd(int clientNum, usercmd_t *cmd);
+int trap_GetUsercmds(int clientNum, usercmd_t *cmds, int maxCmds);
+void trap_RewindClients(int time, int skipClient);
+void trap_RestoreClients(void);
+qboolean trap_EntitiesInPVS(int ent1, int ent2);
 qboolean trap_GetEntityToken(char *buffer, int bufferSize);
 
 int trap_DebugPolygonCreate(int color, int numPoints, vec3_t *points);
@@ -948,6 +970,8 @@ int trap_BotLibDefine(char *string);
 int trap_BotLibStartFrame(float time);
 int trap_BotLibLoadMap(const char *mapname);
 int trap_BotLibUpdateEntity(int ent, void /* struct bot_updateentity_s */ *bue);
+int trap_BotLibUpdateEntities(int numEntities, const byte *live, int numChanged, const int *changed,
+							  void /* struct bot_entitystate_s */ *states);
 int trap_BotLibTest(int parm0, char *parm1, vec3_t parm2, vec3_t parm3);
 
 int trap_BotGetSnapshotEntity(int clientNum, int sequence);
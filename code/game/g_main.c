@@ -25,6 +25,12 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 level_locals_t level;
 
+// log lines are gathered here and written out once a frame
+#define LOG_BUFFER_SIZE 16384
+
+static char logBuffer[LOG_BUFFER_SIZE];
+static int logBufferUsed;
+
 typedef struct {
 	vmCvar_t *vmCvar;
 	const char *cvarName;
@@ -77,6 +83,7 @@ vmCvar_t g_teamForceBalance;
 vmCvar_t g_banIPs;
 vmCvar_t g_filterBan;
 vmCvar_t g_smoothClients;
+vmCvar_t g_antilag;
 vmCvar_t pmove_fixed;
 vmCvar_t pmove_msec;
 vmCvar_t g_listEntity;
@@ -165,6 +172,7 @@ static cvarTable_t gameCvarTable[] = {
 	{&g_listEntity, "g_listEntity", "0", 0, 0, qfalse},
 
 	{&g_smoothClients, "g_smoothClients", "1", 0, 0, qfalse},
+	{&g_antilag, "g_antilag", "1", CVAR_ARCHIVE | CVAR_SERVERINFO, 0, qtrue},
 	/* Still causing issues, maybe use pmove_float from OpenArena instead */
 	{&pmove_fixed, "pmove_fixed", "0", CVAR_SYSTEMINFO, 0, qfalse},
 	{&pmove_msec, "pmove_msec", "8", CVAR_SYSTEMINFO, 0, qfalse},
@@ -239,6 +247,9 @@ Q_EXPORT intptr_t vmMain(int command, int arg0, int arg1, int arg2, int arg3, in
 		return ConsoleCommand();
 	case BOTAI_START_FRAME:
 		return BotAIStartFrame(arg0);
+	case GAME_CLIENT_THINK_BATCH:
+		ClientThinkBatch(arg0);
+		return 0;
 	}
 
 	return -1;
@@ -320,6 +331,8 @@ static void G_FindTeams(void) {
 				if (e2->targetname) {
 					e->targetname = e2->targetname;
 					e2->targetname = NULL;
+					G_EntityIndexChanged(e);
+					G_EntityIndexChanged(e2);
 				}
 			}
 		}
@@ -358,9 +371,17 @@ G_UpdateCvars
 =================
 */
 void G_UpdateCvars(void) {
-	int i;
+	static int lastGeneration;
+	int i, generation;
 	cvarTable_t *cv;
 
+	// nothing changed since the last update
+	generation = trap_Cvar_Generation();
+	if (generation == lastGeneration) {
+		return;
+	}
+	lastGeneration = generation;
+
 	for (i = 0, cv = gameCvarTable; i < gameCvarTableSize; i++, cv++) {
 		if (cv->vmCvar) {
 			trap_Cvar_Update(cv->vmCvar);
@@ -411,6 +432,7 @@ static void G_InitGame(int levelTime, int randomSeed, int restart) {
 
 	level.snd_fry = G_SoundIndex("sounds/player/fry"); // FIXME standing in lava / slime
 
+	logBufferUsed = 0;
 	if (g_gametype.integer != GT_SINGLE_PLAYER && g_log.string[0]) {
 		if (g_logSync.integer) {
 			trap_FS_FOpenFile(g_log.string, &level.logFile, FS_APPEND_SYNC);
@@ -440,6 +462,8 @@ static void G_InitGame(int levelTime, int randomSeed, int restart) {
 
 	// initialize all entities for this game
 	memset(g_entities, 0, MAX_GENTITIES * sizeof(g_entities[0]));
+	G_InitEntityIndex();
+	G_InitEntityLists();
 	level.gentities = g_entities;
 
 	// initialize all clients for this game
@@ -459,6 +483,7 @@ static void G_InitGame(int levelTime, int randomSeed, int restart) {
 
 	for (i = 0; i < MAX_CLIENTS; i++) {
 		g_entities[i].classname = "clientslot";
+		G_EntityIndexChanged(&g_entities[i]);
 	}
 
 	// let the server system know where the entites are
@@ -519,6 +544,7 @@ static void G_ShutdownGame(int restart) {
 	if (level.logFile) {
 		G_LogPrintf("ShutdownGame:\n");
 		G_LogPrintf("------------------------------------------------------------\n");
+		G_LogFlush();
 		trap_FS_FCloseFile(level.logFile);
 		level.logFile = 0;
 	}
@@ -1007,12 +1033,18 @@ MAP CHANGING
 SendScoreboardMessageToAllClients
 
 Do this at BeginIntermission time and whenever ranks are recalculated
-due to enters/exits/forced team changes
+due to enters/exits/forced team changes.  During the game only the rows
+that changed go out, paced by G_SendScoreboardUpdates.
 ========================
 */
 void SendScoreboardMessageToAllClients(void) {
 	int i;
 
+	if (!level.intermissiontime) {
+		level.scoreboardChanged = qtrue;
+		return;
+	}
+
 	for (i = 0; i < level.maxclients; i++) {
 		if (level.clients[i].pers.connected == CON_CONNECTED) {
 			DeathmatchScoreboardMessage(g_entities + i);
@@ -1180,6 +1212,20 @@ void ExitLevel(void) {
 	}
 }
 
+/*
+=================
+G_LogFlush
+
+Writes out the gathered log lines
+=================
+*/
+void G_LogFlush(void) {
+	if (level.logFile && logBufferUsed) {
+		trap_FS_Write(logBuffer, logBufferUsed, level.logFile);
+	}
+	logBufferUsed = 0;
+}
+
 /*
 =================
 G_LogPrintf
@@ -1191,6 +1237,7 @@ void QDECL G_LogPrintf(const char *fmt, ...) {
 	va_list argptr;
 	char string[1024];
 	int min, tens, sec;
+	int len;
 
 	sec = (level.time - level.startTime) / 1000;
 
@@ -1213,7 +1260,17 @@ void QDECL G_LogPrintf(const char *fmt, ...) {
 		return;
 	}
 
-	trap_FS_Write(string, strlen(string), level.logFile);
+	len = strlen(string);
+	if (logBufferUsed + len > LOG_BUFFER_SIZE) {
+		G_LogFlush();
+	}
+	memcpy(logBuffer + logBufferUsed, string, len);
+	logBufferUsed += len;
+
+	// g_logSync wants every line on disk right away
+	if (g_logSync.integer) {
+		G_LogFlush();
+	}
 }
 
 /*
@@ -2140,12 +2197,7 @@ static void G_RunFrame(int levelTime) {
 	//
 	// go through all allocated objects
 	//
-	ent = &g_entities[0];
-	for (i = 0; i < level.num_entities; i++, ent++) {
-		if (!ent->inuse) {
-			continue;
-		}
-
+	for (ent = G_NextActiveEntity(NULL); ent; ent = G_NextActiveEntity(ent)) {
 		// clear events that are too old
 		if (level.time - ent->eventTime > EVENT_VALID_MSEC) {
 			if (ent->s.event) {
@@ -2197,7 +2249,7 @@ static void G_RunFrame(int levelTime) {
 			continue;
 		}
 
-		if (i < MAX_CLIENTS) {
+		if (ent - g_entities < MAX_CLIENTS) {
 			G_RunClient(ent);
 			continue;
 		}
@@ -2232,6 +2284,8 @@ static void G_RunFrame(int levelTime) {
 	// for tracking changes
 	CheckCvars();
 
+	G_SendScoreboardUpdates();
+
 	if (g_listEntity.integer) {
 		for (i = 0; i < MAX_GENTITIES; i++) {
 			G_Printf("%4i: %s\n", i, g_entities[i].classname);
@@ -2241,4 +2295,6 @@ static void G_RunFrame(int levelTime) {
 
 	if (!level.intermissiontime)
 		WoP_RunFrame();
+
+	G_LogFlush();
 }
@@ -588,6 +588,126 @@ static void launch_slickent(vec3_t origin, float size, vec3_t normal) {
 	trap_LinkEntity(slickent); // update the states and activate the touch-event
 }
 
+/*
+=================================================================================
+
+MISSILE TRACE BATCH
+
+The missiles that follow each other in the entity loop have their moves
+traced in one trap_TraceBatch call.  Nothing a missile can hit moves while
+they fly without hitting anything, so the batch is only thrown away once
+one hits something, thinks, or an entity other than a missile runs.
+
+=================================================================================
+*/
+
+#define MAX_MISSILE_BATCH 256
+
+static struct {
+	int framenum;
+	int numMissiles;
+	int next;
+	int entityNums[MAX_MISSILE_BATCH];
+	vec3_t origins[MAX_MISSILE_BATCH];
+	traceRequest_t requests[MAX_MISSILE_BATCH];
+	trace_t results[MAX_MISSILE_BATCH];
+} missileBatch;
+
+/*
+================
+G_MissileTraceRequest
+
+The move of the missile this frame, from the previous position to origin
+================
+*/
+static void G_MissileTraceRequest(const gentity_t *ent, vec3_t origin, traceRequest_t *req) {
+	// get current position
+	BG_EvaluateTrajectory(&ent->s.pos, level.time, origin);
+
+	VectorCopy(ent->r.currentOrigin, req->start);
+	VectorCopy(origin, req->end);
+
+	// if this missile bounced off an invulnerability sphere
+	if (ent->target_ent) {
+		req->passEntityNum = ent->target_ent->s.number;
+	} else {
+		// ignore interactions with the missile owner
+		req->passEntityNum = ent->r.ownerNum;
+	}
+
+	if (level.time - ent->s.pos.trTime > 50) {
+		VectorCopy(ent->r.mins, req->mins);
+		VectorCopy(ent->r.maxs, req->maxs);
+	} else {
+		VectorClear(req->mins);
+		VectorClear(req->maxs);
+	}
+
+	req->contentmask = ent->clipmask;
+	req->capsule = qfalse;
+}
+
+/*
+================
+G_BatchMissiles
+
+Traces the moves of ent and the missiles right after it in the entity loop
+================
+*/
+static void G_BatchMissiles(gentity_t *first) {
+	gentity_t *ent;
+	int i;
+
+	missileBatch.framenum = level.framenum;
+	missileBatch.numMissiles = 0;
+	missileBatch.next = 0;
+
+	for (ent = first; ent && missileBatch.numMissiles < MAX_MISSILE_BATCH; ent = G_NextActiveEntity(ent)) {
+		// entities the loop skips
+		if (ent->freeAfterEvent || (!ent->r.linked && ent->neverFree)) {
+			continue;
+		}
+
+		// anything else may move what the missiles after it hit
+		if (ent != first && (ent->s.eType != ET_MISSILE || ent->s.weapon == WP_KILLERDUCKS || ent->r.contents)) {
+			break;
+		}
+
+		i = missileBatch.numMissiles++;
+		missileBatch.entityNums[i] = ent->s.number;
+		G_MissileTraceRequest(ent, missileBatch.origins[i], &missileBatch.requests[i]);
+	}
+
+	trap_TraceBatch(missileBatch.results, missileBatch.requests, missileBatch.numMissiles);
+}
+
+/*
+================
+G_MissileTrace
+
+Gets the trace of the move of the missile this frame
+================
+*/
+static void G_MissileTrace(gentity_t *ent, vec3_t origin, trace_t *tr) {
+	int i;
+
+	if (missileBatch.framenum != level.framenum || missileBatch.next >= missileBatch.numMissiles ||
+		missileBatch.entityNums[missileBatch.next] != ent->s.number) {
+		G_BatchMissiles(ent);
+	}
+
+	i = missileBatch.next++;
+	VectorCopy(missileBatch.origins[i], origin);
+	*tr = missileBatch.results[i];
+
+	// the missiles after it have to be traced again if this one may
+	// change the world
+	if (tr->fraction != 1.0f || tr->startsolid || tr->allsolid || ent->r.contents ||
+		(ent->nextthink > 0 && ent->nextthink <= level.time)) {
+		missileBatch.numMissiles = 0;
+	}
+}
+
 /*
 ================
 G_RunMissile
@@ -603,8 +723,8 @@ void G_RunMissile(gentity_t *ent) {
 		return;
 	}
 
-	// get current position
-	BG_EvaluateTrajectory(&ent->s.pos, level.time, origin);
+	// trace a line from the previous position to the current position
+	G_MissileTrace(ent, origin, &tr);
 
 	// if this missile bounced off an invulnerability sphere
 	if (ent->target_ent) {
@@ -613,11 +733,6 @@ void G_RunMissile(gentity_t *ent) {
 		// ignore interactions with the missile owner
 		passent = ent->r.ownerNum;
 	}
-	// trace a line from the previous position to the current position
-	if (level.time - ent->s.pos.trTime > 50)
-		trap_Trace(&tr, ent->r.currentOrigin, ent->r.mins, ent->r.maxs, origin, passent, ent->clipmask);
-	else
-		trap_Trace(&tr, ent->r.currentOrigin, vec3_origin, vec3_origin, origin, passent, ent->clipmask);
 
 	if (ent->s.weapon == WP_BOASTER) {
 		if (tr.fraction != 1.0f || tr.startsolid) {
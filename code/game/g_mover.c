@@ -48,6 +48,82 @@ typedef struct {
 } pushed_t;
 pushed_t pushed[MAX_GENTITIES], *pushed_p;
 
+/*
+The entities a mover can push, kept so a mover only has to check their
+bounds instead of asking the server for everything in its swept box.
+Clients are always in the list, other entities are picked up when the
+list is rebuilt after G_PushablesChanged, which G_InitGentity does.  Code
+that makes an entity spawned in an earlier frame an item or a physics
+object has to call G_PushablesChanged itself.
+*/
+static int pushables[MAX_GENTITIES];
+static int numPushables;
+static qboolean pushablesChanged = qtrue;
+
+/*
+============
+G_PushablesChanged
+============
+*/
+void G_PushablesChanged(void) {
+	pushablesChanged = qtrue;
+}
+
+/*
+============
+G_UpdatePushables
+============
+*/
+static void G_UpdatePushables(void) {
+	gentity_t *ent;
+
+	if (!pushablesChanged) {
+		return;
+	}
+	pushablesChanged = qfalse;
+
+	numPushables = 0;
+	for (ent = G_NextActiveEntity(NULL); ent; ent = G_NextActiveEntity(ent)) {
+		if (ent->s.number < MAX_CLIENTS || ent->s.eType == ET_ITEM || ent->physicsObject) {
+			pushables[numPushables++] = ent->s.number;
+		}
+	}
+}
+
+/*
+============
+G_PushablesInBox
+
+Like trap_EntitiesInBox, but only returns the entities a mover can push
+============
+*/
+static int G_PushablesInBox(const vec3_t mins, const vec3_t maxs, int *list) {
+	gentity_t *check;
+	int i, count;
+
+	G_UpdatePushables();
+
+	count = 0;
+	for (i = 0; i < numPushables; i++) {
+		check = &g_entities[pushables[i]];
+
+		if (!check->inuse || !check->r.linked) {
+			continue;
+		}
+		if (check->s.eType != ET_ITEM && check->s.eType != ET_PLAYER && !check->physicsObject) {
+			continue;
+		}
+		if (check->r.absmin[0] > maxs[0] || check->r.absmin[1] > maxs[1] || check->r.absmin[2] > maxs[2] ||
+			check->r.absmax[0] < mins[0] || check->r.absmax[1] < mins[1] || check->r.absmax[2] < mins[2]) {
+			continue;
+		}
+
+		list[count++] = pushables[i];
+	}
+
+	return count;
+}
+
 /*
 ============
 G_TestEntityPosition
@@ -306,10 +382,8 @@ qboolean G_MoverPush(gentity_t *pusher, vec3_t move, vec3_t amove, gentity_t **o
 		}
 	}
 
-	// unlink the pusher so we don't get it in the entityList
-	trap_UnlinkEntity(pusher);
-
-	listedEntities = trap_EntitiesInBox(totalMins, totalMaxs, entityList, MAX_GENTITIES);
+	// movers are never pushable, so the pusher can stay linked
+	listedEntities = G_PushablesInBox(totalMins, totalMaxs, entityList);
 
 	// move the pusher to its final position
 	VectorAdd(pusher->r.currentOrigin, move, pusher->r.currentOrigin);
@@ -395,6 +469,12 @@ void G_MoverTeam(gentity_t *ent) {
 		BG_EvaluateTrajectory(&part->s.apos, level.time, angles);
 		VectorSubtract(origin, part->r.currentOrigin, move);
 		VectorSubtract(angles, part->r.currentAngles, amove);
+
+		// nothing to push if the part didn't move this frame
+		if (VectorCompare(move, vec3_origin) && VectorCompare(amove, vec3_origin)) {
+			continue;
+		}
+
 		if (!G_MoverPush(part, move, amove, &obstacle)) {
 			break; // move was blocked
 		}
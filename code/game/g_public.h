@@ -96,6 +96,20 @@ typedef struct {
 	entityShared_t r; // shared by both the server system and game
 } sharedEntity_t;
 
+// a single trace of a G_TRACEBATCH call
+typedef struct {
+	vec3_t start;
+	vec3_t mins;
+	vec3_t maxs;
+	vec3_t end;
+	int passEntityNum;
+	int contentmask;
+	int capsule;
+} traceRequest_t;
+
+// the most usercmds a GAME_CLIENT_THINK_BATCH hands over
+#define MAX_THINK_USERCMDS 32
+
 //===============================================================
 
 //
@@ -228,6 +242,27 @@ typedef enum {
 	// 1.32
 	G_FS_SEEK,
 
+	G_TRACEBATCH, // ( trace_t *results, const traceRequest_t *requests, int numRequests );
+	// runs several traces in one call, results are in the order of the requests
+
+	G_CVAR_GENERATION, // ( void );
+	// changes whenever any cvar changed, G_CVAR_UPDATE can be skipped while it doesn't
+
+	G_GET_USERCMDS, // ( int clientNum, usercmd_t *cmds, int maxCmds );
+	// copies the commands of the GAME_CLIENT_THINK_BATCH being run, oldest
+	// first, and returns how many there are
+
+	G_REWIND_CLIENTS, // ( int time, int skipClient );
+	// moves all clients but skipClient to where they were at time, for the
+	// traces of a lagged client's shot
+
+	G_RESTORE_CLIENTS, // ( void );
+	// undoes G_REWIND_CLIENTS, must come before any client is moved or linked
+
+	G_ENTITIES_IN_PVS, // ( int ent1, int ent2 );
+	// G_IN_PVS for the origins of two entities as of their last
+	// G_LINKENTITY, linked entities don't need a BSP walk
+
 	BOTLIB_SETUP = 200, // ( void );
 	BOTLIB_SHUTDOWN,	// ( void );
 	BOTLIB_LIBVAR_SET,
@@ -241,6 +276,8 @@ typedef enum {
 	BOTLIB_GET_SNAPSHOT_ENTITY, // ( int client, int ent );
 	BOTLIB_GET_CONSOLE_MESSAGE, // ( int client, char *message, int size );
 	BOTLIB_USER_COMMAND,		// ( int client, usercmd_t *ucmd );
+	BOTLIB_UPDATEENTITIES,
+	// ( int numEntities, const byte *live, int numChanged, const int *changed, bot_entitystate_t *states );
 
 	BOTLIB_AAS_ENABLE_ROUTING_AREA = 300,
 	BOTLIB_AAS_BBOX_AREAS,
@@ -421,5 +458,10 @@ typedef enum {
 	// The game can issue trap_argc() / trap_argv() commands to get the command
 	// and parameters.  Return qfalse if the game doesn't recognize it as a command.
 
-	BOTAI_START_FRAME // ( int time );
+	BOTAI_START_FRAME, // ( int time );
+
+	GAME_CLIENT_THINK_BATCH // ( int clientNum );
+	// runs several new commands of a client in one call, the game gets them
+	// with G_GET_USERCMDS.  A game that returns -1 is sent GAME_CLIENT_THINK
+	// for every command instead.
 } gameExport_t;
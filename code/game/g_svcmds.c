@@ -816,6 +816,11 @@ qboolean ConsoleCommand(void) {
 		return qtrue;
 	}
 
+	if (Q_stricmp(cmd, "bot_stats") == 0) {
+		Svcmd_BotStats_f();
+		return qtrue;
+	}
+
 	if (Q_stricmp(cmd, "abort_podium") == 0) {
 		Svcmd_AbortPodium_f();
 		return qtrue;
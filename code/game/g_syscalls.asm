@@ -46,6 +46,12 @@ equ trap_SnapVector			-43
 equ trap_TraceCapsule		-44
 equ trap_EntityContactCapsule	-45
 equ trap_FS_Seek -46
+equ trap_TraceBatch		-47
+equ trap_Cvar_Generation	-48
+equ trap_GetUsercmds		-49
+equ trap_RewindClients		-50
+equ trap_RestoreClients		-51
+equ trap_EntitiesInPVS		-52
 
 equ	memset					-101
 equ	memcpy					-102
@@ -58,6 +64,8 @@ equ floor					-111
 equ	ceil					-112
 equ	testPrintInt			-113
 equ	testPrintFloat			-114
+equ	memmove					-115
+equ	strlen					-116
 
 
 
@@ -74,6 +82,7 @@ equ trap_BotLibTest						-209
 equ trap_BotGetSnapshotEntity			-210
 equ trap_BotGetServerCommand		-211
 equ trap_BotUserCommand					-212
+equ trap_BotLibUpdateEntities			-213
 
 
 
@@ -97,6 +97,10 @@ void trap_Cvar_Update(vmCvar_t *cvar) {
 	syscall(G_CVAR_UPDATE, cvar);
 }
 
+int trap_Cvar_Generation(void) {
+	return syscall(G_CVAR_GENERATION);
+}
+
 void trap_Cvar_Set(const char *var_name, const char *value) {
 	syscall(G_CVAR_SET, var_name, value);
 }
@@ -156,6 +160,10 @@ void trap_TraceCapsule(trace_t *results, const vec3_t start, const vec3_t mins,
 	syscall(G_TRACECAPSULE, results, start, mins, maxs, end, passEntityNum, contentmask);
 }
 
+void trap_TraceBatch(trace_t *results, const traceRequest_t *requests, int numRequests) {
+	syscall(G_TRACEBATCH, results, requests, numRequests);
+}
+
 int trap_PointContents(const vec3_t point, int passEntityNum) {
 	return syscall(G_POINT_CONTENTS, point, passEntityNum);
 }
@@ -208,6 +216,22 @@ void trap_GetUsercmd(int clientNum, usercmd_t *cmd) {
 	syscall(G_GET_USERCMD, clientNum, cmd);
 }
 
+int trap_GetUsercmds(int clientNum, usercmd_t *cmds, int maxCmds) {
+	return syscall(G_GET_USERCMDS, clientNum, cmds, maxCmds);
+}
+
+void trap_RewindClients(int time, int skipClient) {
+	syscall(G_REWIND_CLIENTS, time, skipClient);
+}
+
+void trap_RestoreClients(void) {
+	syscall(G_RESTORE_CLIENTS);
+}
+
+qboolean trap_EntitiesInPVS(int ent1, int ent2) {
+	return syscall(G_ENTITIES_IN_PVS, ent1, ent2);
+}
+
 qboolean trap_GetEntityToken(char *buffer, int bufferSize) {
 	return syscall(G_GET_ENTITY_TOKEN, buffer, bufferSize);
 }
@@ -261,6 +285,11 @@ int trap_BotLibUpdateEntity(int ent, void /* struct bot_updateentity_s */ *bue)
 	return syscall(BOTLIB_UPDATENTITY, ent, bue);
 }
 
+int trap_BotLibUpdateEntities(int numEntities, const byte *live, int numChanged, const int *changed,
+							  void /* struct bot_entitystate_s */ *states) {
+	return syscall(BOTLIB_UPDATEENTITIES, numEntities, live, numChanged, changed, states);
+}
+
 int trap_BotLibTest(int parm0, char *parm1, vec3_t parm2, vec3_t parm3) {
 	return syscall(BOTLIB_TEST, parm0, parm1, parm2, parm3);
 }
@@ -417,9 +417,9 @@ void Team_FragBonuses(gentity_t *targ, gentity_t *inflictor, gentity_t *attacker
 	VectorSubtract(targ->r.currentOrigin, flag->r.currentOrigin, v1);
 	VectorSubtract(attacker->r.currentOrigin, flag->r.currentOrigin, v2);
 
-	if (((VectorLength(v1) < CTF_TARGET_PROTECT_RADIUS && trap_InPVS(flag->r.currentOrigin, targ->r.currentOrigin)) ||
+	if (((VectorLength(v1) < CTF_TARGET_PROTECT_RADIUS && trap_EntitiesInPVS(flag->s.number, targ->s.number)) ||
 		 (VectorLength(v2) < CTF_TARGET_PROTECT_RADIUS &&
-		  trap_InPVS(flag->r.currentOrigin, attacker->r.currentOrigin))) &&
+		  trap_EntitiesInPVS(flag->s.number, attacker->s.number))) &&
 		attacker->client->sess.sessionTeam != targ->client->sess.sessionTeam) {
 
 		// we defended the base flag
@@ -438,9 +438,9 @@ void Team_FragBonuses(gentity_t *targ, gentity_t *inflictor, gentity_t *attacker
 		VectorSubtract(attacker->r.currentOrigin, carrier->r.currentOrigin, v1);
 
 		if (((VectorLength(v1) < CTF_ATTACKER_PROTECT_RADIUS &&
-			  trap_InPVS(carrier->r.currentOrigin, targ->r.currentOrigin)) ||
+			  trap_EntitiesInPVS(carrier->s.number, targ->s.number)) ||
 			 (VectorLength(v2) < CTF_ATTACKER_PROTECT_RADIUS &&
-			  trap_InPVS(carrier->r.currentOrigin, attacker->r.currentOrigin))) &&
+			  trap_EntitiesInPVS(carrier->s.number, attacker->s.number))) &&
 			attacker->client->sess.sessionTeam != targ->client->sess.sessionTeam) {
 			AddScore(attacker, targ->r.currentOrigin, CTF_CARRIER_PROTECT_BONUS, SCORE_BONUS_CARRIER_PROTECT_S);
 			attacker->client->pers.teamState.carrierdefense++;
@@ -787,7 +787,7 @@ gentity_t *Team_GetLocation(gentity_t *ent) {
 			continue;
 		}
 
-		if (!trap_InPVS(origin, eloc->r.currentOrigin)) {
+		if (!trap_EntitiesInPVS(ent->s.number, eloc->s.number)) {
 			continue;
 		}
 
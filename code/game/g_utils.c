@@ -142,6 +142,178 @@ void G_TeamCommand(team_t team, char *cmd) {
 	}
 }
 
+/*
+=============================================================================
+
+ENTITY NAME INDEX
+
+The classname, targetname and target of every entity are hashed, so G_Find
+only has to look at the entities with a matching name.  The fields are
+read again for the entities passed to G_EntityIndexChanged, which
+G_InitGentity and G_FreeEntity do.  Entities stay marked for the rest of
+the frame, so fields set right after G_Spawn are picked up as well.  Code
+that renames an entity that was spawned in an earlier frame has to call
+G_EntityIndexChanged itself.
+
+=============================================================================
+*/
+
+#define ENTITYINDEX_FIELDS 3
+#define ENTITYINDEX_HASH_SIZE 256
+
+typedef struct {
+	int head[ENTITYINDEX_HASH_SIZE]; // chains are sorted on entity number
+	int next[MAX_GENTITIES];
+	int prev[MAX_GENTITIES];
+	int bucket[MAX_GENTITIES]; // -1 if the field is NULL
+	const char *name[MAX_GENTITIES];
+} entityIndexField_t;
+
+static entityIndexField_t entityIndex[ENTITYINDEX_FIELDS];
+
+static int entityIndexChanged[MAX_GENTITIES];
+static int entityIndexNumChanged;
+static int entityIndexChangeTime[MAX_GENTITIES];
+static qboolean entityIndexIsChanged[MAX_GENTITIES];
+
+/*
+=============
+G_EntityIndexField
+=============
+*/
+static int G_EntityIndexField(int fieldofs) {
+	if (fieldofs == FOFS(classname))
+		return 0;
+	if (fieldofs == FOFS(targetname))
+		return 1;
+	if (fieldofs == FOFS(target))
+		return 2;
+	return -1;
+}
+
+/*
+=============
+G_EntityIndexHash
+
+Case insensitive like Q_stricmp
+=============
+*/
+static int G_EntityIndexHash(const char *s) {
+	unsigned int hash;
+	int c;
+
+	for (hash = 0; *s; s++) {
+		c = *s;
+		if (c >= 'a' && c <= 'z')
+			c -= ('a' - 'A');
+		hash = hash * 31 + c;
+	}
+
+	return (hash ^ (hash >> 10)) & (ENTITYINDEX_HASH_SIZE - 1);
+}
+
+/*
+=============
+G_InitEntityIndex
+=============
+*/
+void G_InitEntityIndex(void) {
+	entityIndexField_t *field;
+	int f, i;
+
+	for (f = 0, field = entityIndex; f < ENTITYINDEX_FIELDS; f++, field++) {
+		for (i = 0; i < ENTITYINDEX_HASH_SIZE; i++)
+			field->head[i] = -1;
+		for (i = 0; i < MAX_GENTITIES; i++) {
+			field->bucket[i] = -1;
+			field->name[i] = NULL;
+		}
+	}
+
+	entityIndexNumChanged = 0;
+	memset(entityIndexIsChanged, 0, sizeof(entityIndexIsChanged));
+}
+
+/*
+=============
+G_EntityIndexChanged
+
+The name fields of the entity have to be read again
+=============
+*/
+void G_EntityIndexChanged(gentity_t *ent) {
+	int num = ent - g_entities;
+
+	entityIndexChangeTime[num] = level.time;
+	if (!entityIndexIsChanged[num]) {
+		entityIndexIsChanged[num] = qtrue;
+		entityIndexChanged[entityIndexNumChanged++] = num;
+	}
+}
+
+/*
+=============
+G_IndexEntityField
+=============
+*/
+static void G_IndexEntityField(entityIndexField_t *field, int fieldofs, int num) {
+	const char *s;
+	int bucket, *link;
+
+	s = *(char **)((byte *)&g_entities[num] + fieldofs);
+	if (s == field->name[num])
+		return;
+
+	// take it out of the old chain
+	if (field->bucket[num] != -1) {
+		if (field->prev[num] != -1)
+			field->next[field->prev[num]] = field->next[num];
+		else
+			field->head[field->bucket[num]] = field->next[num];
+		if (field->next[num] != -1)
+			field->prev[field->next[num]] = field->prev[num];
+		field->bucket[num] = -1;
+	}
+
+	field->name[num] = s;
+	if (!s)
+		return;
+
+	bucket = G_EntityIndexHash(s);
+	field->bucket[num] = bucket;
+	field->prev[num] = -1;
+	for (link = &field->head[bucket]; *link != -1 && *link < num; link = &field->next[*link])
+		field->prev[num] = *link;
+	field->next[num] = *link;
+	if (*link != -1)
+		field->prev[*link] = num;
+	*link = num;
+}
+
+/*
+=============
+G_UpdateEntityIndex
+=============
+*/
+static void G_UpdateEntityIndex(void) {
+	int i, num, numChanged;
+
+	numChanged = 0;
+	for (i = 0; i < entityIndexNumChanged; i++) {
+		num = entityIndexChanged[i];
+		G_IndexEntityField(&entityIndex[0], FOFS(classname), num);
+		G_IndexEntityField(&entityIndex[1], FOFS(targetname), num);
+		G_IndexEntityField(&entityIndex[2], FOFS(target), num);
+
+		// the fields may still be set during this frame
+		if (entityIndexChangeTime[num] >= level.time)
+			entityIndexChanged[numChanged++] = num;
+		else
+			entityIndexIsChanged[num] = qfalse;
+	}
+	entityIndexNumChanged = numChanged;
+}
+
 /*
 =============
 G_Find
@@ -156,6 +328,28 @@ NULL will be returned if the end of the list is reached.
 */
 gentity_t *G_Find(gentity_t *from, int fieldofs, const char *match) {
 	char *s;
+	int f, num, start;
+
+	f = G_EntityIndexField(fieldofs);
+	if (f != -1) {
+		G_UpdateEntityIndex();
+
+		start = from ? from - g_entities + 1 : 0;
+		for (num = entityIndex[f].head[G_EntityIndexHash(match)]; num != -1; num = entityIndex[f].next[num]) {
+			if (num < start)
+				continue;
+			if (num >= level.num_entities)
+				break;
+			from = &g_entities[num];
+			if (!from->inuse)
+				continue;
+			s = *(char **)((byte *)from + fieldofs);
+			if (s && !Q_stricmp(s, match))
+				return from;
+		}
+
+		return NULL;
+	}
 
 	if (!from)
 		from = g_entities;
@@ -175,6 +369,25 @@ gentity_t *G_Find(gentity_t *from, int fieldofs, const char *match) {
 	return NULL;
 }
 
+/*
+=============
+G_FindAll
+
+Fills list with up to max active entities that hold the matching string
+at fieldofs, in entity order, and returns how many were found
+=============
+*/
+int G_FindAll(int fieldofs, const char *match, gentity_t **list, int max) {
+	gentity_t *ent;
+	int count;
+
+	count = 0;
+	for (ent = G_Find(NULL, fieldofs, match); ent && count < max; ent = G_Find(ent, fieldofs, match))
+		list[count++] = ent;
+
+	return count;
+}
+
 /*
 =============
 G_PickTarget
@@ -185,8 +398,7 @@ Selects a random entity from among the targets
 #define MAXCHOICES 32
 
 gentity_t *G_PickTarget(char *targetname) {
-	gentity_t *ent = NULL;
-	int num_choices = 0;
+	int num_choices;
 	gentity_t *choice[MAXCHOICES];
 
 	if (!targetname) {
@@ -194,14 +406,7 @@ gentity_t *G_PickTarget(char *targetname) {
 		return NULL;
 	}
 
-	while (1) {
-		ent = G_Find(ent, FOFS(targetname), targetname);
-		if (!ent)
-			break;
-		choice[num_choices++] = ent;
-		if (num_choices == MAXCHOICES)
-			break;
-	}
+	num_choices = G_FindAll(FOFS(targetname), targetname, choice, MAXCHOICES);
 
 	if (!num_choices) {
 		G_Printf("G_PickTarget: target %s not found\n", targetname);
@@ -349,6 +554,82 @@ float vectoyaw(const vec3_t vec) {
 	return yaw;
 }
 
+/*
+=============================================================================
+
+FREE AND ACTIVE ENTITIES
+
+Freed entities wait in a queue in the order they were freed, so G_Spawn
+only has to look at the oldest one.  The entities past the client slots
+that were spawned have a bit set, so G_RunFrame can skip runs of free
+slots without touching them.  Bits of entities that were freed are only
+cleared when the walk finds them.
+
+=============================================================================
+*/
+
+static int freeEntities[MAX_GENTITIES];
+static int freeEntityHead, freeEntityCount;
+static qboolean freeEntityQueued[MAX_GENTITIES];
+
+static unsigned int activeEntities[MAX_GENTITIES / 32];
+
+/*
+=================
+G_InitEntityLists
+=================
+*/
+void G_InitEntityLists(void) {
+	freeEntityHead = 0;
+	freeEntityCount = 0;
+	memset(freeEntityQueued, 0, sizeof(freeEntityQueued));
+	memset(activeEntities, 0, sizeof(activeEntities));
+}
+
+/*
+=================
+G_NextActiveEntity
+
+Returns the entity in use after from, or the first one if NULL, in
+entity number order like a walk over all of them.  Entities spawned
+during the walk are found if their number is past from.
+=================
+*/
+gentity_t *G_NextActiveEntity(gentity_t *from) {
+	unsigned int bits;
+	int num;
+
+	num = from ? from - g_entities + 1 : 0;
+
+	for (; num < MAX_CLIENTS && num < level.num_entities; num++) {
+		if (g_entities[num].inuse)
+			return &g_entities[num];
+	}
+
+	while (num < level.num_entities) {
+		bits = activeEntities[num >> 5] >> (num & 31);
+		if (!bits) {
+			num = (num | 31) + 1;
+			continue;
+		}
+
+		while (!(bits & 1)) {
+			bits >>= 1;
+			num++;
+		}
+
+		if (num >= level.num_entities)
+			break;
+		if (g_entities[num].inuse)
+			return &g_entities[num];
+
+		activeEntities[num >> 5] &= ~(1u << (num & 31));
+		num++;
+	}
+
+	return NULL;
+}
+
 void G_InitGentity(gentity_t *e) {
 	e->inuse = qtrue;
 	e->classname = "noclass";
@@ -356,6 +637,13 @@ void G_InitGentity(gentity_t *e) {
 	e->r.ownerNum = ENTITYNUM_NONE;
 
 	e->s.otherEntityNum = ENTITYNUM_NONE;
+
+	if (e->s.number >= MAX_CLIENTS) {
+		activeEntities[e->s.number >> 5] |= 1u << (e->s.number & 31);
+	}
+
+	G_EntityIndexChanged(e);
+	G_PushablesChanged();
 }
 
 /*
@@ -374,34 +662,33 @@ angles and bad trails.
 =================
 */
 gentity_t *G_Spawn(void) {
-	int i, force;
+	int i;
 	gentity_t *e;
 
-	e = NULL; // shut up warning
-	i = 0;	  // shut up warning
-	for (force = 0; force < 2; force++) {
-		// if we go through all entities and can't find one to free,
-		// override the normal minimum times before use
-		e = &g_entities[MAX_CLIENTS];
-		for (i = MAX_CLIENTS; i < level.num_entities; i++, e++) {
-			if (e->inuse) {
-				continue;
-			}
+	// the oldest free entity is the best to reuse, if it was freed too
+	// recently all the others were as well
+	while (freeEntityCount) {
+		e = &g_entities[freeEntities[freeEntityHead]];
 
-			// the first couple seconds of server time can involve a lot of
-			// freeing and allocating, so relax the replacement policy
-			if (!force && e->freetime > level.startTime + 2000 && level.time - e->freetime < 1000) {
-				continue;
-			}
+		// the first couple seconds of server time can involve a lot of
+		// freeing and allocating, so relax the replacement policy, and
+		// when no new slot can be opened, take it anyway
+		if (!e->inuse && e->freetime > level.startTime + 2000 && level.time - e->freetime < 1000 &&
+			level.num_entities < ENTITYNUM_MAX_NORMAL) {
+			break;
+		}
+
+		freeEntityQueued[freeEntities[freeEntityHead]] = qfalse;
+		freeEntityHead = (freeEntityHead + 1) % MAX_GENTITIES;
+		freeEntityCount--;
 
-			// reuse this slot
+		// reuse this slot
+		if (!e->inuse) {
 			G_InitGentity(e);
 			return e;
 		}
-		if (level.num_entities < ENTITYNUM_MAX_NORMAL) {
-			break;
-		}
 	}
+
 	if (level.num_entities == ENTITYNUM_MAX_NORMAL) {
 		for (i = 0; i < MAX_GENTITIES; i++) {
 			G_Printf("%4i: %s\n", i, g_entities[i].classname);
@@ -410,6 +697,7 @@ gentity_t *G_Spawn(void) {
 	}
 
 	// open up a new slot
+	e = &g_entities[level.num_entities];
 	level.num_entities++;
 
 	// let the server system know that there are more entities
@@ -426,23 +714,8 @@ G_EntitiesFree
 =================
 */
 qboolean G_EntitiesFree(void) {
-	int i;
-	gentity_t *e;
-
-	if (level.num_entities < ENTITYNUM_MAX_NORMAL) {
-		// can open a new slot if needed
-		return qtrue;
-	}
-
-	e = &g_entities[MAX_CLIENTS];
-	for (i = MAX_CLIENTS; i < level.num_entities; i++, e++) {
-		if (e->inuse) {
-			continue;
-		}
-		// slot available
-		return qtrue;
-	}
-	return qfalse;
+	// can open a new slot if needed
+	return level.num_entities < ENTITYNUM_MAX_NORMAL || freeEntityCount > 0;
 }
 
 /*
@@ -453,6 +726,8 @@ Marks the entity as free
 =================
 */
 void G_FreeEntity(gentity_t *ed) {
+	int num;
+
 	trap_UnlinkEntity(ed); // unlink from world
 
 	if (ed->neverFree) {
@@ -463,6 +738,15 @@ void G_FreeEntity(gentity_t *ed) {
 	ed->classname = "freed";
 	ed->freetime = level.time;
 	ed->inuse = qfalse;
+
+	G_EntityIndexChanged(ed);
+
+	num = ed - g_entities;
+	if (num >= MAX_CLIENTS && !freeEntityQueued[num]) {
+		freeEntityQueued[num] = qtrue;
+		freeEntities[(freeEntityHead + freeEntityCount) % MAX_GENTITIES] = num;
+		freeEntityCount++;
+	}
 }
 
 /*
@@ -57,6 +57,36 @@ GAUNTLET
 void Weapon_Gauntlet(gentity_t *ent) {
 }
 
+/*
+===============
+G_ShotTrace
+
+A trace for a hitscan shot.  With g_antilag the other clients are moved
+back to where the shooter saw them when firing, so players with a high
+ping don't have to lead their shots.
+===============
+*/
+#define MAX_ANTILAG_MSEC 400
+
+static void G_ShotTrace(gentity_t *ent, trace_t *tr, const vec3_t start, const vec3_t mins, const vec3_t maxs,
+						const vec3_t end, int passEntityNum) {
+	int time;
+
+	if (!g_antilag.integer || !ent->client || (ent->r.svFlags & SVF_BOT)) {
+		trap_Trace(tr, start, mins, maxs, end, passEntityNum, MASK_SHOT);
+		return;
+	}
+
+	time = ent->client->pers.cmd.serverTime;
+	if (time < level.time - MAX_ANTILAG_MSEC) {
+		time = level.time - MAX_ANTILAG_MSEC;
+	}
+
+	trap_RewindClients(time, ent->s.number);
+	trap_Trace(tr, start, mins, maxs, end, passEntityNum, MASK_SHOT);
+	trap_RestoreClients();
+}
+
 /*
 ===============
 CheckGauntletAttack
@@ -76,7 +106,7 @@ qboolean CheckGauntletAttack(gentity_t *ent) {
 
 	VectorMA(muzzle, 32, forward, end);
 
-	trap_Trace(&tr, muzzle, NULL, NULL, end, ent->s.number, MASK_SHOT);
+	G_ShotTrace(ent, &tr, muzzle, NULL, NULL, end, ent->s.number);
 	if (tr.surfaceFlags & SURF_NOIMPACT) {
 		return qfalse;
 	}
@@ -194,7 +224,7 @@ void weapon_supershotgun_fire(gentity_t *ent) {
 	hits = 0;
 	traceEnt = NULL;
 	passent = ent->s.number;
-	trap_Trace(&trace, muzzle, minPumper, maxPumper, end, passent, MASK_SHOT);
+	G_ShotTrace(ent, &trace, muzzle, minPumper, maxPumper, end, passent);
 	if (trace.startsolid) {
 		VectorCopy(muzzle, trace.endpos);
 	} else if (trace.entityNum < ENTITYNUM_MAX_NORMAL) {
@@ -26,6 +26,9 @@ void IN_Init(void) {
 void IN_Frame(void) {
 }
 
+void IN_SampleMouse(void) {
+}
+
 void IN_Shutdown(void) {
 }
 
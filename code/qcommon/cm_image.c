@@ -0,0 +1,389 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+// cm_image.c -- read only collision model data shared between processes
+//
+// The parts of the collision model that hold no pointers and are never
+// written after loading (the flattened world tree, the visibility and the
+// facets of the patches) are written to an image file below the home path
+// when a map is first loaded.  Every process that loads the same map
+// afterwards maps that image read only instead of building its own copy, so
+// the pages are shared by all the servers on a host.  The patch facets are
+// also the slowest part of loading a map.
+
+#include "cm_local.h"
+#include "cm_patch.h"
+
+#ifndef BSPC
+
+#define CM_IMAGE_IDENT (('I' << 24) + ('M' << 16) + ('C' << 8) + 'W')
+#define CM_IMAGE_VERSION 1
+
+typedef struct {
+	int ident;
+	int version;
+	int checksum; // of the BSP file the image was built from
+
+	// the image is only valid for the same layout of the structures
+	int traceNodeSize;
+	int patchPlaneSize;
+	int facetSize;
+	int patchNodeSize;
+
+	int numNodes;
+	int visibilityLength; // 0 if the map isn't vised
+	int numSurfaces;
+
+	int nodesOfs;
+	int visibilityOfs;
+	int patchesOfs; // cmImagePatch_t [numSurfaces]
+
+	int length;
+} cmImageHeader_t;
+
+typedef struct {
+	qboolean present; // if the surface is a patch with facets
+	vec3_t bounds[2];
+	int numPlanes, planesOfs;
+	int numFacets, facetsOfs;
+	int numNodes, nodesOfs;
+} cmImagePatch_t;
+
+#define CM_IMAGE_ALIGN(x) (((x) + 3) & ~3)
+
+static cvar_t *cm_shareImage;
+
+/*
+==================
+CM_ImagePath
+==================
+*/
+static void CM_ImagePath(const char *name, int checksum, char *path, int size) {
+	char base[MAX_QPATH];
+
+	COM_StripExtension(COM_SkipPath((char *)name), base, sizeof(base));
+	Com_sprintf(path, size, "cmcache/%s-%08x.cm", base, checksum);
+}
+
+/*
+==================
+CM_ImageRange
+
+True if count elements of size bytes at ofs are inside the image
+==================
+*/
+static qboolean CM_ImageRange(int ofs, int count, int size) {
+	if (ofs < (int)sizeof(cmImageHeader_t) || (ofs & 3) || count < 0) {
+		return qfalse;
+	}
+	return (int64_t)ofs + (int64_t)count * size <= cm.imageLength;
+}
+
+/*
+==================
+CM_ImageVisibilityLength
+
+As much of the visibility lump as CMod_LoadVisibility copies, 0 if the
+map isn't vised
+==================
+*/
+static int CM_ImageVisibilityLength(const dheader_t *header) {
+	int length = header->lumps[LUMP_VISIBILITY].filelen;
+
+	return length > VIS_HEADER ? length - VIS_HEADER : 0;
+}
+
+/*
+==================
+CM_ValidImage
+==================
+*/
+static qboolean CM_ValidImage(int checksum, const dheader_t *header) {
+	const cmImageHeader_t *h = (const cmImageHeader_t *)cm.image;
+	const cmImagePatch_t *patch;
+	int i;
+
+	if (cm.imageLength < (int64_t)sizeof(*h) || h->length != cm.imageLength) {
+		return qfalse;
+	}
+
+	if (h->ident != CM_IMAGE_IDENT || h->version != CM_IMAGE_VERSION || h->checksum != checksum) {
+		return qfalse;
+	}
+
+	if (h->traceNodeSize != sizeof(cTraceNode_t) || h->patchPlaneSize != sizeof(patchPlane_t) ||
+		h->facetSize != sizeof(facet_t) || h->patchNodeSize != sizeof(patchNode_t)) {
+		return qfalse;
+	}
+
+	if (h->numNodes != header->lumps[LUMP_NODES].filelen / (int)sizeof(dnode_t) ||
+		h->numSurfaces != header->lumps[LUMP_SURFACES].filelen / (int)sizeof(dsurface_t) ||
+		h->visibilityLength != CM_ImageVisibilityLength(header)) {
+		return qfalse;
+	}
+
+	if (!CM_ImageRange(h->nodesOfs, h->numNodes, sizeof(cTraceNode_t)) ||
+		!CM_ImageRange(h->visibilityOfs, h->visibilityLength, 1) ||
+		!CM_ImageRange(h->patchesOfs, h->numSurfaces, sizeof(cmImagePatch_t))) {
+		return qfalse;
+	}
+
+	patch = (const cmImagePatch_t *)(cm.image + h->patchesOfs);
+	for (i = 0; i < h->numSurfaces; i++, patch++) {
+		if (!patch->present) {
+			continue;
+		}
+		if (!CM_ImageRange(patch->planesOfs, patch->numPlanes, sizeof(patchPlane_t)) ||
+			!CM_ImageRange(patch->facetsOfs, patch->numFacets, sizeof(facet_t)) ||
+			!CM_ImageRange(patch->nodesOfs, patch->numNodes, sizeof(patchNode_t))) {
+			return qfalse;
+		}
+	}
+
+	return qtrue;
+}
+
+/*
+==================
+CM_MapImage
+
+Maps the image of the map if there is a valid one, called before any of
+the lumps are loaded
+==================
+*/
+void CM_MapImage(const char *name, int checksum, const dheader_t *header) {
+	char path[MAX_OSPATH];
+
+	cm_shareImage = Cvar_Get("cm_shareImage", "0", CVAR_ARCHIVE);
+	Cvar_SetDescription(cm_shareImage, "Write the read only parts of the collision model of each map to cmcache/ "
+									   "below the home path, and share them with every process that loads the "
+									   "map afterwards");
+
+	if (!cm_shareImage->integer) {
+		return;
+	}
+
+	CM_ImagePath(name, checksum, path, sizeof(path));
+
+	cm.image = FS_SV_MapFile(path, &cm.imageLength);
+	if (!cm.image) {
+		return;
+	}
+
+	if (!CM_ValidImage(checksum, header)) {
+		Com_Printf("CM_MapImage: ignoring stale or broken %s\n", path);
+		CM_UnmapImage();
+		return;
+	}
+
+	Com_DPrintf("CM_MapImage: sharing %s\n", path);
+}
+
+/*
+==================
+CM_UnmapImage
+==================
+*/
+void CM_UnmapImage(void) {
+	if (cm.image) {
+		FS_UnmapFile(cm.image, cm.imageLength);
+	}
+	cm.image = NULL;
+	cm.imageLength = 0;
+}
+
+/*
+==================
+CM_ImageTraceNodes
+
+The flattened world tree in the image, NULL without an image
+==================
+*/
+cTraceNode_t *CM_ImageTraceNodes(void) {
+	const cmImageHeader_t *h = (const cmImageHeader_t *)cm.image;
+
+	if (!h) {
+		return NULL;
+	}
+
+	// the pages are mapped read only, nothing writes the tree after loading
+	return (cTraceNode_t *)(cm.image + h->nodesOfs);
+}
+
+/*
+==================
+CM_ImageVisibility
+
+The cluster visibility in the image, NULL without an image or for maps
+that aren't vised
+==================
+*/
+byte *CM_ImageVisibility(void) {
+	const cmImageHeader_t *h = (const cmImageHeader_t *)cm.image;
+
+	if (!h || !h->visibilityLength) {
+		return NULL;
+	}
+
+	return (byte *)(cm.image + h->visibilityOfs);
+}
+
+/*
+==================
+CM_ImagePatchCollide
+
+The facets of a patch surface in the image, NULL if they have to be
+generated
+==================
+*/
+struct patchCollide_s *CM_ImagePatchCollide(int surfaceNum) {
+	const cmImageHeader_t *h = (const cmImageHeader_t *)cm.image;
+	const cmImagePatch_t *patch;
+	patchCollide_t *pc;
+
+	if (!h) {
+		return NULL;
+	}
+
+	patch = (const cmImagePatch_t *)(cm.image + h->patchesOfs) + surfaceNum;
+	if (!patch->present) {
+		return NULL;
+	}
+
+	pc = Hunk_Alloc(sizeof(*pc), h_high);
+	VectorCopy(patch->bounds[0], pc->bounds[0]);
+	VectorCopy(patch->bounds[1], pc->bounds[1]);
+	pc->numPlanes = patch->numPlanes;
+	pc->planes = (patchPlane_t *)(cm.image + patch->planesOfs);
+	pc->numFacets = patch->numFacets;
+	pc->facets = (facet_t *)(cm.image + patch->facetsOfs);
+	pc->numNodes = patch->numNodes;
+	pc->nodes = (patchNode_t *)(cm.image + patch->nodesOfs);
+
+	return pc;
+}
+
+/*
+==================
+CM_WriteImage
+
+Writes the image of the loaded map for the processes that load it later.
+The image is written under a temporary name and renamed when complete,
+so no other process can map half of it.
+==================
+*/
+void CM_WriteImage(const char *name, int checksum, const dheader_t *header) {
+	char path[MAX_OSPATH], tempPath[MAX_OSPATH];
+	cmImageHeader_t h;
+	cmImagePatch_t *patches, *patch;
+	patchCollide_t *pc;
+	static const byte pad[4];
+	fileHandle_t f;
+	int written;
+	int ofs;
+	int i;
+
+	if (!cm_shareImage || !cm_shareImage->integer || cm.image || !cm.numNodes) {
+		return;
+	}
+
+	Com_Memset(&h, 0, sizeof(h));
+	h.ident = CM_IMAGE_IDENT;
+	h.version = CM_IMAGE_VERSION;
+	h.checksum = checksum;
+	h.traceNodeSize = sizeof(cTraceNode_t);
+	h.patchPlaneSize = sizeof(patchPlane_t);
+	h.facetSize = sizeof(facet_t);
+	h.patchNodeSize = sizeof(patchNode_t);
+	h.numNodes = cm.numNodes;
+	h.numSurfaces = cm.numSurfaces;
+	h.visibilityLength = CM_ImageVisibilityLength(header);
+
+	ofs = sizeof(h);
+	h.nodesOfs = ofs;
+	ofs += h.numNodes * sizeof(cTraceNode_t);
+	h.visibilityOfs = ofs;
+	ofs += CM_IMAGE_ALIGN(h.visibilityLength);
+	h.patchesOfs = ofs;
+	ofs += h.numSurfaces * sizeof(cmImagePatch_t);
+
+	patches = Hunk_AllocateTempMemory(h.numSurfaces * sizeof(*patches));
+	Com_Memset(patches, 0, h.numSurfaces * sizeof(*patches));
+
+	for (i = 0; i < cm.numSurfaces; i++) {
+		if (!cm.surfaces[i] || !cm.surfaces[i]->pc) {
+			continue;
+		}
+		pc = cm.surfaces[i]->pc;
+		patch = &patches[i];
+
+		patch->present = qtrue;
+		VectorCopy(pc->bounds[0], patch->bounds[0]);
+		VectorCopy(pc->bounds[1], patch->bounds[1]);
+		patch->numPlanes = pc->numPlanes;
+		patch->planesOfs = ofs;
+		ofs += pc->numPlanes * sizeof(patchPlane_t);
+		patch->numFacets = pc->numFacets;
+		patch->facetsOfs = ofs;
+		ofs += pc->numFacets * sizeof(facet_t);
+		patch->numNodes = pc->numNodes;
+		patch->nodesOfs = ofs;
+		ofs += pc->numNodes * sizeof(patchNode_t);
+	}
+	h.length = ofs;
+
+	CM_ImagePath(name, checksum, path, sizeof(path));
+	Com_sprintf(tempPath, sizeof(tempPath), "%s.%x%04x.tmp", path, Com_Milliseconds(), rand() & 0xffff);
+
+	f = FS_SV_FOpenFileWrite(tempPath);
+	if (!f) {
+		Hunk_FreeTempMemory(patches);
+		return;
+	}
+
+	written = FS_Write(&h, sizeof(h), f);
+	written += FS_Write(cm.traceNodes, h.numNodes * sizeof(cTraceNode_t), f);
+	written += FS_Write(cm.visibility, h.visibilityLength, f);
+	written += FS_Write(pad, CM_IMAGE_ALIGN(h.visibilityLength) - h.visibilityLength, f);
+	written += FS_Write(patches, h.numSurfaces * sizeof(*patches), f);
+
+	for (i = 0; i < cm.numSurfaces; i++) {
+		if (!patches[i].present) {
+			continue;
+		}
+		pc = cm.surfaces[i]->pc;
+		written += FS_Write(pc->planes, pc->numPlanes * sizeof(patchPlane_t), f);
+		written += FS_Write(pc->facets, pc->numFacets * sizeof(facet_t), f);
+		written += FS_Write(pc->nodes, pc->numNodes * sizeof(patchNode_t), f);
+	}
+
+	FS_FCloseFile(f);
+	Hunk_FreeTempMemory(patches);
+
+	if (written != h.length) {
+		Com_Printf("CM_WriteImage: couldn't write %s\n", tempPath);
+		return;
+	}
+
+	FS_SV_Rename(tempPath, path, qtrue);
+}
+
+#endif // BSPC
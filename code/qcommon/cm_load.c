@@ -42,11 +42,12 @@ void SetPlaneSignbits(cplane_t *out) {
 #endif // BSPC
 
 // to allow boxes to be treated as brush models, we allocate
-// some extra indexes along with those needed by the map
-#define BOX_BRUSHES 1
-#define BOX_SIDES 6
+// some extra indexes along with those needed by the map,
+// one box for each thread that can run collision queries
+#define BOX_BRUSHES CM_MAX_THREADS
+#define BOX_SIDES (6 * CM_MAX_THREADS)
 #define BOX_LEAFS 2
-#define BOX_PLANES 12
+#define BOX_PLANES (12 * CM_MAX_THREADS)
 
 #define LL(x) x = LittleLong(x)
 
@@ -60,12 +61,10 @@ byte *cmod_base;
 cvar_t *cm_noAreas;
 cvar_t *cm_noCurves;
 cvar_t *cm_playerCurveClip;
+cvar_t *cm_debugSurfaceUpdate;
 #endif
 
-cmodel_t box_model;
-cplane_t *box_planes;
-cbrush_t *box_brush;
-
+void CM_InitThreads(void);
 void CM_InitBoxHull(void);
 void CM_FloodAreaConnections(void);
 
@@ -145,12 +144,12 @@ static void CMod_LoadSubmodels(const lump_t *l) {
 			continue; // world model doesn't need other info
 		}
 
-		// make a "leaf" just to hold the model's brushes and surfaces
+		// make a "leaf" just to hold the model's brushes and surfaces,
+		// the leaf brushes go where CMod_LoadLeafBrushes left room for them
 		out->leaf.numLeafBrushes = LittleLong(in->numBrushes);
-		indexes = Hunk_Alloc(out->leaf.numLeafBrushes * 4, h_high);
-		out->leaf.firstLeafBrush = indexes - cm.leafbrushes;
+		out->leaf.firstLeafBrush = cm.numLeafBrushes;
 		for (j = 0; j < out->leaf.numLeafBrushes; j++) {
-			indexes[j] = LittleLong(in->firstBrush) + j;
+			cm.leafbrushes[cm.numLeafBrushes++].brushNum = LittleLong(in->firstBrush) + j;
 		}
 
 		out->leaf.numLeafSurfaces = LittleLong(in->numSurfaces);
@@ -162,6 +161,44 @@ static void CMod_LoadSubmodels(const lump_t *l) {
 	}
 }
 
+static int numTraceNodes;
+
+/*
+=================
+CMod_FlattenNode_r
+
+Copies the world tree below a node to cm.traceNodes in depth first order
+and returns the new number of the node
+=================
+*/
+static int CMod_FlattenNode_r(int num) {
+	const cNode_t *node;
+	cTraceNode_t *out;
+	int outNum;
+	int j;
+
+	if (num < 0) {
+		return num; // leaf numbers stay the same
+	}
+	if (num >= cm.numNodes || numTraceNodes >= cm.numNodes) {
+		Com_Error(ERR_DROP, "CMod_FlattenNode_r: bad node tree");
+	}
+
+	node = &cm.nodes[num];
+	outNum = numTraceNodes++;
+	out = &cm.traceNodes[outNum];
+
+	VectorCopy(node->plane->normal, out->normal);
+	out->dist = node->plane->dist;
+	out->type = node->plane->type;
+
+	for (j = 0; j < 2; j++) {
+		out->children[j] = CMod_FlattenNode_r(node->children[j]);
+	}
+
+	return outNum;
+}
+
 /*
 =================
 CMod_LoadNodes
@@ -193,6 +230,16 @@ static void CMod_LoadNodes(const lump_t *l) {
 			out->children[j] = child;
 		}
 	}
+
+#ifndef BSPC
+	cm.traceNodes = CM_ImageTraceNodes();
+	if (cm.traceNodes) {
+		return;
+	}
+#endif
+	cm.traceNodes = Hunk_Alloc(count * sizeof(*cm.traceNodes), h_high);
+	numTraceNodes = 0;
+	CMod_FlattenNode_r(0);
 }
 
 /*
@@ -212,6 +259,42 @@ void CM_BoundBrush(cbrush_t *b) {
 	b->bounds[1][2] = b->sides[5].plane->dist;
 }
 
+#ifdef CM_SIMD_PLANES
+/*
+=================
+CM_BuildBrushPlaneBlocks
+
+Copies the brush side planes into blocks of four for the SSE plane tests.
+The unused sides of the last block get a plane that every point is far
+behind, so they never reject anything.
+=================
+*/
+static void CM_BuildBrushPlaneBlocks(cbrush_t *b) {
+	cbrushPlanes_t *block;
+	const cplane_t *plane;
+	int i, j;
+
+	b->planeBlocks = Hunk_Alloc(((b->numsides + 3) >> 2) * sizeof(*b->planeBlocks), h_high);
+
+	for (i = 0; i < ((b->numsides + 3) & ~3); i++) {
+		block = &b->planeBlocks[i >> 2];
+		if (i >= b->numsides) {
+			for (j = 0; j < 3; j++) {
+				block->normal[j][i & 3] = 0;
+			}
+			block->dist[i & 3] = 1e30f;
+			continue;
+		}
+
+		plane = b->sides[i].plane;
+		for (j = 0; j < 3; j++) {
+			block->normal[j][i & 3] = plane->normal[j];
+		}
+		block->dist[i & 3] = plane->dist;
+	}
+}
+#endif
+
 /*
 =================
 CMod_LoadBrushes
@@ -245,6 +328,9 @@ static void CMod_LoadBrushes(const lump_t *l) {
 		out->contents = cm.shaders[out->shaderNum].contentFlags;
 
 		CM_BoundBrush(out);
+#ifdef CM_SIMD_PLANES
+		CM_BuildBrushPlaneBlocks(out);
+#endif
 	}
 }
 
@@ -287,6 +373,8 @@ static void CMod_LoadLeafs(const lump_t *l) {
 
 	cm.areas = Hunk_Alloc(cm.numAreas * sizeof(*cm.areas), h_high);
 	cm.areaPortals = Hunk_Alloc(cm.numAreas * cm.numAreas * sizeof(*cm.areaPortals), h_high);
+	cm.areaBytes = (cm.numAreas + 7) >> 3;
+	cm.areaBits = Hunk_Alloc(cm.numAreas * cm.areaBytes, h_high);
 }
 
 /*
@@ -332,24 +420,62 @@ static void CMod_LoadPlanes(const lump_t *l) {
 CMod_LoadLeafBrushes
 =================
 */
-static void CMod_LoadLeafBrushes(const lump_t *l) {
+static void CMod_LoadLeafBrushes(const lump_t *l, const lump_t *models) {
 	int i;
-	int *out;
+	cLeafBrush_t *out;
 	int *in;
-	int count;
+	dmodel_t *model;
+	int count, numModelBrushes, submodelBrushes;
 
 	in = (void *)(cmod_base + l->fileofs);
 	if (l->filelen % sizeof(*in))
 		Com_Error(ERR_DROP, "MOD_LoadBmodel: funny lump size");
 	count = l->filelen / sizeof(*in);
 
-	cm.leafbrushes = Hunk_Alloc((count + BOX_BRUSHES) * sizeof(*cm.leafbrushes), h_high);
+	// leave room for the brushes of the submodels, which CMod_LoadSubmodels
+	// makes a leaf of, and those of the box models
+	model = (void *)(cmod_base + models->fileofs);
+	submodelBrushes = 0;
+	for (i = 1; i < models->filelen / (int)sizeof(*model); i++) {
+		numModelBrushes = LittleLong(model[i].numBrushes);
+		if (numModelBrushes < 0 || numModelBrushes > MAX_MAP_BRUSHES) {
+			Com_Error(ERR_DROP, "CMod_LoadLeafBrushes: bad brush count in model %i", i);
+		}
+		submodelBrushes += numModelBrushes;
+	}
+
+	cm.leafbrushes = Hunk_Alloc((count + submodelBrushes + BOX_BRUSHES) * sizeof(*cm.leafbrushes), h_high);
 	cm.numLeafBrushes = count;
 
 	out = cm.leafbrushes;
 
 	for (i = 0; i < count; i++, in++, out++) {
-		*out = LittleLong(*in);
+		out->brushNum = LittleLong(*in);
+	}
+}
+
+/*
+=================
+CMod_LoadLeafBrushBounds
+
+Copies the contents and bounds of the brushes next to the leaf brush
+references, once the brushes and submodels are loaded
+=================
+*/
+static void CMod_LoadLeafBrushBounds(void) {
+	int i;
+	cLeafBrush_t *out;
+	cbrush_t *b;
+
+	out = cm.leafbrushes;
+	for (i = 0; i < cm.numLeafBrushes; i++, out++) {
+		if (out->brushNum < 0 || out->brushNum >= cm.numBrushes) {
+			Com_Error(ERR_DROP, "CMod_LoadLeafBrushBounds: bad brushNum");
+		}
+		b = &cm.brushes[out->brushNum];
+		out->contents = b->contents;
+		VectorCopy(b->bounds[0], out->bounds[0]);
+		VectorCopy(b->bounds[1], out->bounds[1]);
 	}
 }
 
@@ -429,7 +555,6 @@ static void CMod_LoadEntityString(const lump_t *l) {
 CMod_LoadVisibility
 =================
 */
-#define VIS_HEADER 8
 static void CMod_LoadVisibility(const lump_t *l) {
 	int len;
 	byte *buf;
@@ -444,9 +569,15 @@ static void CMod_LoadVisibility(const lump_t *l) {
 	buf = cmod_base + l->fileofs;
 
 	cm.vised = qtrue;
-	cm.visibility = Hunk_Alloc(len, h_high);
 	cm.numClusters = LittleLong(((int *)buf)[0]);
 	cm.clusterBytes = LittleLong(((int *)buf)[1]);
+#ifndef BSPC
+	cm.visibility = CM_ImageVisibility();
+	if (cm.visibility) {
+		return;
+	}
+#endif
+	cm.visibility = Hunk_Alloc(len, h_high);
 	Com_Memcpy(cm.visibility, buf + VIS_HEADER, len - VIS_HEADER);
 }
 
@@ -485,7 +616,16 @@ static void CMod_LoadPatches(const lump_t *surfs, const lump_t *verts) {
 		if (LittleLong(in->surfaceType) != MST_PATCH) {
 			continue; // ignore other surfaces
 		}
-		// FIXME: check for non-colliding patches
+
+		// a nonsolid patch can't match the contents mask of any trace,
+		// so it doesn't need the facets CM_GeneratePatchCollide builds
+		shaderNum = LittleLong(in->shaderNum);
+		if (shaderNum < 0 || shaderNum >= cm.numShaders) {
+			Com_Error(ERR_DROP, "CMod_LoadPatches: bad shaderNum: %i", shaderNum);
+		}
+		if (!cm.shaders[shaderNum].contentFlags) {
+			continue;
+		}
 
 		cm.surfaces[i] = patch = Hunk_Alloc(sizeof(*patch), h_high);
 
@@ -504,11 +644,16 @@ static void CMod_LoadPatches(const lump_t *surfs, const lump_t *verts) {
 			points[j][2] = LittleFloat(dv_p->xyz[2]);
 		}
 
-		shaderNum = LittleLong(in->shaderNum);
 		patch->contents = cm.shaders[shaderNum].contentFlags;
 		patch->surfaceFlags = cm.shaders[shaderNum].surfaceFlags;
 
 		// create the internal facet structure
+#ifndef BSPC
+		patch->pc = CM_ImagePatchCollide(i);
+		if (patch->pc) {
+			continue;
+		}
+#endif
 		patch->pc = CM_GeneratePatchCollide(width, height, points);
 	}
 }
@@ -547,11 +692,15 @@ void CM_LoadMap(const char *name, qboolean clientload, int *checksum) {
 	union {
 		int *i;
 		void *v;
+		const void *c;
 	} buf;
 	int i;
 	dheader_t header;
 	int length;
 	static unsigned last_checksum;
+#ifndef BSPC
+	memOwner_t owner;
+#endif
 
 	if (!name || !name[0]) {
 		Com_Error(ERR_DROP, "CM_LoadMap: NULL name");
@@ -561,6 +710,7 @@ void CM_LoadMap(const char *name, qboolean clientload, int *checksum) {
 	cm_noAreas = Cvar_Get("cm_noAreas", "0", CVAR_CHEAT);
 	cm_noCurves = Cvar_Get("cm_noCurves", "0", CVAR_CHEAT);
 	cm_playerCurveClip = Cvar_Get("cm_playerCurveClip", "1", CVAR_ARCHIVE | CVAR_CHEAT);
+	cm_debugSurfaceUpdate = Cvar_Get("r_debugSurfaceUpdate", "1", 0);
 #endif
 	Com_DPrintf("CM_LoadMap( %s, %i )\n", name, clientload);
 
@@ -570,6 +720,9 @@ void CM_LoadMap(const char *name, qboolean clientload, int *checksum) {
 	}
 
 	// free old stuff
+#ifndef BSPC
+	CM_UnmapImage();
+#endif
 	Com_Memset(&cm, 0, sizeof(cm));
 	CM_ClearLevelPatches();
 
@@ -586,7 +739,8 @@ void CM_LoadMap(const char *name, qboolean clientload, int *checksum) {
 	// load the file
 	//
 #ifndef BSPC
-	length = FS_ReadFile(name, &buf.v);
+	// the lumps are only ever copied out of the file
+	length = FS_ReadFileMapped(name, &buf.c);
 #else
 	length = LoadQuakeFile((quakefile_t *)name, &buf.v);
 #endif
@@ -610,15 +764,21 @@ void CM_LoadMap(const char *name, qboolean clientload, int *checksum) {
 
 	cmod_base = (byte *)buf.i;
 
+#ifndef BSPC
+	owner = Com_SetMemOwner(MEMOWNER_CM);
+	CM_MapImage(name, last_checksum, &header);
+#endif
+
 	// load into heap
 	CMod_LoadShaders(&header.lumps[LUMP_SHADERS]);
 	CMod_LoadLeafs(&header.lumps[LUMP_LEAFS]);
-	CMod_LoadLeafBrushes(&header.lumps[LUMP_LEAFBRUSHES]);
+	CMod_LoadLeafBrushes(&header.lumps[LUMP_LEAFBRUSHES], &header.lumps[LUMP_MODELS]);
 	CMod_LoadLeafSurfaces(&header.lumps[LUMP_LEAFSURFACES]);
 	CMod_LoadPlanes(&header.lumps[LUMP_PLANES]);
 	CMod_LoadBrushSides(&header.lumps[LUMP_BRUSHSIDES]);
 	CMod_LoadBrushes(&header.lumps[LUMP_BRUSHES]);
 	CMod_LoadSubmodels(&header.lumps[LUMP_MODELS]);
+	CMod_LoadLeafBrushBounds();
 	CMod_LoadNodes(&header.lumps[LUMP_NODES]);
 	CMod_LoadEntityString(&header.lumps[LUMP_ENTITIES]);
 	CMod_LoadVisibility(&header.lumps[LUMP_VISIBILITY]);
@@ -627,10 +787,16 @@ void CM_LoadMap(const char *name, qboolean clientload, int *checksum) {
 	// we are NOT freeing the file, because it is cached for the ref
 	FS_FreeFile(buf.v);
 
+	CM_InitThreads();
 	CM_InitBoxHull();
 
 	CM_FloodAreaConnections();
 
+#ifndef BSPC
+	CM_WriteImage(name, last_checksum, &header);
+	Com_SetMemOwner(owner);
+#endif
+
 	// allow this to be cached if it is loaded by the server
 	if (!clientload) {
 		Q_strncpyz(cm.name, name, sizeof(cm.name));
@@ -643,6 +809,9 @@ CM_ClearMap
 ==================
 */
 void CM_ClearMap(void) {
+#ifndef BSPC
+	CM_UnmapImage();
+#endif
 	Com_Memset(&cm, 0, sizeof(cm));
 	CM_ClearLevelPatches();
 }
@@ -660,7 +829,7 @@ cmodel_t *CM_ClipHandleToModel(clipHandle_t handle) {
 		return &cm.cmodels[handle];
 	}
 	if (handle == BOX_MODEL_HANDLE) {
-		return &box_model;
+		return &CM_Thread()->boxModel;
 	}
 	if (handle < MAX_SUBMODELS) {
 		Com_Error(ERR_DROP, "CM_ClipHandleToModel: bad handle %i < %i < %i", cm.numSubModels, handle, MAX_SUBMODELS);
@@ -710,6 +879,30 @@ int CM_LeafArea(int leafnum) {
 
 //=======================================================================
 
+/*
+===================
+CM_InitThreads
+
+Allocates the dedup stamps of every thread that can run collision queries
+===================
+*/
+void CM_InitThreads(void) {
+	cmThread_t *thread;
+	int *stamps;
+	int numStamps;
+	int i;
+
+	numStamps = cm.numBrushes + BOX_BRUSHES + cm.numSurfaces;
+	stamps = Hunk_Alloc(CM_MAX_THREADS * numStamps * sizeof(*stamps), h_high);
+
+	for (i = 0; i < CM_MAX_THREADS; i++) {
+		thread = &cm.threads[i];
+		thread->checkcount = 0;
+		thread->brushChecks = stamps + i * numStamps;
+		thread->patchChecks = thread->brushChecks + cm.numBrushes + BOX_BRUSHES;
+	}
+}
+
 /*
 ===================
 CM_InitBoxHull
@@ -719,45 +912,53 @@ can just be stored out and get a proper clipping hull structure.
 ===================
 */
 void CM_InitBoxHull(void) {
-	int i;
+	int i, t;
 	int side;
+	int firstPlane, firstSide;
 	cplane_t *p;
 	cbrushside_t *s;
-
-	box_planes = &cm.planes[cm.numPlanes];
-
-	box_brush = &cm.brushes[cm.numBrushes];
-	box_brush->numsides = 6;
-	box_brush->sides = cm.brushsides + cm.numBrushSides;
-	box_brush->contents = CONTENTS_BODY;
-
-	box_model.leaf.numLeafBrushes = 1;
-	//	box_model.leaf.firstLeafBrush = cm.numBrushes;
-	box_model.leaf.firstLeafBrush = cm.numLeafBrushes;
-	cm.leafbrushes[cm.numLeafBrushes] = cm.numBrushes;
-
-	for (i = 0; i < 6; i++) {
-		side = i & 1;
-
-		// brush sides
-		s = &cm.brushsides[cm.numBrushSides + i];
-		s->plane = cm.planes + (cm.numPlanes + i * 2 + side);
-		s->surfaceFlags = 0;
-
-		// planes
-		p = &box_planes[i * 2];
-		p->type = i >> 1;
-		p->signbits = 0;
-		VectorClear(p->normal);
-		p->normal[i >> 1] = 1;
-
-		p = &box_planes[i * 2 + 1];
-		p->type = 3 + (i >> 1);
-		p->signbits = 0;
-		VectorClear(p->normal);
-		p->normal[i >> 1] = -1;
-
-		SetPlaneSignbits(p);
+	cmThread_t *thread;
+
+	for (t = 0; t < CM_MAX_THREADS; t++) {
+		thread = &cm.threads[t];
+		firstPlane = cm.numPlanes + t * 12;
+		firstSide = cm.numBrushSides + t * 6;
+
+		thread->boxPlanes = &cm.planes[firstPlane];
+
+		thread->boxBrush = &cm.brushes[cm.numBrushes + t];
+		thread->boxBrush->numsides = 6;
+		thread->boxBrush->sides = cm.brushsides + firstSide;
+		thread->boxBrush->contents = CONTENTS_BODY;
+
+		thread->boxModel.leaf.numLeafBrushes = 1;
+		thread->boxModel.leaf.firstLeafBrush = cm.numLeafBrushes + t;
+		cm.leafbrushes[cm.numLeafBrushes + t].brushNum = cm.numBrushes + t;
+		cm.leafbrushes[cm.numLeafBrushes + t].contents = CONTENTS_BODY;
+
+		for (i = 0; i < 6; i++) {
+			side = i & 1;
+
+			// brush sides
+			s = &cm.brushsides[firstSide + i];
+			s->plane = cm.planes + (firstPlane + i * 2 + side);
+			s->surfaceFlags = 0;
+
+			// planes
+			p = &thread->boxPlanes[i * 2];
+			p->type = i >> 1;
+			p->signbits = 0;
+			VectorClear(p->normal);
+			p->normal[i >> 1] = 1;
+
+			p = &thread->boxPlanes[i * 2 + 1];
+			p->type = 3 + (i >> 1);
+			p->signbits = 0;
+			VectorClear(p->normal);
+			p->normal[i >> 1] = -1;
+
+			SetPlaneSignbits(p);
+		}
 	}
 }
 
@@ -771,9 +972,11 @@ Capsules are handled differently though.
 ===================
 */
 clipHandle_t CM_TempBoxModel(const vec3_t mins, const vec3_t maxs, int capsule) {
+	cmThread_t *thread = CM_Thread();
+	cplane_t *box_planes = thread->boxPlanes;
 
-	VectorCopy(mins, box_model.mins);
-	VectorCopy(maxs, box_model.maxs);
+	VectorCopy(mins, thread->boxModel.mins);
+	VectorCopy(maxs, thread->boxModel.maxs);
 
 	if (capsule) {
 		return CAPSULE_MODEL_HANDLE;
@@ -792,8 +995,10 @@ clipHandle_t CM_TempBoxModel(const vec3_t mins, const vec3_t maxs, int capsule)
 	box_planes[10].dist = mins[2];
 	box_planes[11].dist = -mins[2];
 
-	VectorCopy(mins, box_brush->bounds[0]);
-	VectorCopy(maxs, box_brush->bounds[1]);
+	VectorCopy(mins, thread->boxBrush->bounds[0]);
+	VectorCopy(maxs, thread->boxBrush->bounds[1]);
+	VectorCopy(mins, cm.leafbrushes[thread->boxModel.leaf.firstLeafBrush].bounds[0]);
+	VectorCopy(maxs, cm.leafbrushes[thread->boxModel.leaf.firstLeafBrush].bounds[1]);
 
 	return BOX_MODEL_HANDLE;
 }
@@ -24,6 +24,12 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "qcommon.h"
 #include "cm_polylib.h"
 
+// the brush sides are also kept in blocks of four planes, so the trace
+// code can test four sides at a time with SSE
+#if idx64 && !defined(BSPC)
+#define CM_SIMD_PLANES
+#endif
+
 #define MAX_SUBMODELS 256
 #define BOX_MODEL_HANDLE 255
 #define CAPSULE_MODEL_HANDLE 254
@@ -33,6 +39,15 @@ typedef struct {
 	int children[2]; // negative numbers are leafs
 } cNode_t;
 
+// the world tree as the trace walks it: nodes in depth first order, so the
+// first child usually follows its parent, with the plane stored inline
+typedef struct {
+	vec3_t normal;
+	float dist;
+	int type;		 // PLANE_X, PLANE_Y, PLANE_Z or PLANE_NON_AXIAL
+	int children[2]; // negative numbers are leafs
+} cTraceNode_t;
+
 typedef struct {
 	int cluster;
 	int area;
@@ -55,17 +70,32 @@ typedef struct {
 	int shaderNum;
 } cbrushside_t;
 
+// the planes of four brush sides, structure of arrays
+typedef struct {
+	float normal[3][4];
+	float dist[4];
+} cbrushPlanes_t;
+
+// a brush reference of a leaf, with the brush contents and bounds alongside
+// so brushes can be rejected without touching the cbrush_t
+typedef struct {
+	int brushNum;
+	int contents;
+	vec3_t bounds[2];
+} cLeafBrush_t;
+
 typedef struct {
 	int shaderNum; // the shader that determined the contents
 	int contents;
 	vec3_t bounds[2];
 	int numsides;
 	cbrushside_t *sides;
-	int checkcount; // to avoid repeated testings
+#ifdef CM_SIMD_PLANES
+	cbrushPlanes_t *planeBlocks; // [(numsides + 3) / 4], NULL for the box brushes
+#endif
 } cbrush_t;
 
 typedef struct {
-	int checkcount; // to avoid repeated testings
 	int surfaceFlags;
 	int contents;
 	struct patchCollide_s *pc;
@@ -76,6 +106,20 @@ typedef struct {
 	int floodvalid;
 } cArea_t;
 
+// every thread that runs collision queries has its own dedup stamps and
+// temporary box model, so queries can run on the job workers in parallel
+#define CM_MAX_THREADS (MAX_JOB_THREADS + 1)
+
+typedef struct {
+	int checkcount;	  // incremented on each query
+	int *brushChecks; // [numBrushes] to avoid repeated testings
+	int *patchChecks; // [numSurfaces]
+
+	cmodel_t boxModel;
+	cplane_t *boxPlanes;
+	cbrush_t *boxBrush;
+} cmThread_t;
+
 typedef struct {
 	char name[MAX_QPATH];
 
@@ -90,12 +134,13 @@ typedef struct {
 
 	int numNodes;
 	cNode_t *nodes;
+	cTraceNode_t *traceNodes;
 
 	int numLeafs;
 	cLeaf_t *leafs;
 
-	int numLeafBrushes;
-	int *leafbrushes;
+	int numLeafBrushes; // the world leafs' followed by the submodels'
+	cLeafBrush_t *leafbrushes;
 
 	int numLeafSurfaces;
 	int *leafsurfaces;
@@ -122,12 +167,16 @@ typedef struct {
 	cPatch_t **surfaces; // non-patches will be NULL
 
 	int floodvalid;
-	int checkcount; // incremented on each trace
-} clipMap_t;
+	int floodnum; // the last flood number handed out
+
+	int areaBytes;
+	byte *areaBits; // [ numAreas*areaBytes ] the areas in the same flood as each area
+
+	cmThread_t threads[CM_MAX_THREADS];
 
-// keep 1/8 unit away to keep the position valid before network snapping
-// and to avoid various numeric issues
-#define SURFACE_CLIP_EPSILON (0.125)
+	const byte *image; // read only pages shared with other processes, see cm_image.c
+	int64_t imageLength;
+} clipMap_t;
 
 extern clipMap_t cm;
 extern int c_pointcontents;
@@ -135,6 +184,27 @@ extern int c_traces, c_brush_traces, c_patch_traces;
 extern cvar_t *cm_noAreas;
 extern cvar_t *cm_noCurves;
 extern cvar_t *cm_playerCurveClip;
+extern cvar_t *cm_debugSurfaceUpdate;
+
+// the query state of the calling thread
+#ifdef BSPC
+#define CM_Thread() (&cm.threads[0])
+#else
+#define CM_Thread() (&cm.threads[Com_JobThreadIndex()])
+#endif
+
+// cm_load.c
+
+#define VIS_HEADER 8
+
+// cm_image.c
+
+void CM_MapImage(const char *name, int checksum, const dheader_t *header);
+void CM_UnmapImage(void);
+void CM_WriteImage(const char *name, int checksum, const dheader_t *header);
+cTraceNode_t *CM_ImageTraceNodes(void);
+byte *CM_ImageVisibility(void);
+struct patchCollide_s *CM_ImagePatchCollide(int surfaceNum);
 
 // cm_test.c
 
@@ -159,6 +229,7 @@ typedef struct {
 	qboolean isPoint;	// optimized case
 	trace_t trace;		// returned from trace call
 	sphere_t sphere;	// sphere for oriendted capsule collision
+	cmThread_t *thread; // dedup stamps of the calling thread
 } traceWork_t;
 
 typedef struct leafList_s {
@@ -169,6 +240,7 @@ typedef struct leafList_s {
 	vec3_t bounds[2];
 	int lastLeaf; // for overflows where each leaf can't be stored individually
 	void (*storeLeafs)(struct leafList_s *ll, int nodenum);
+	cmThread_t *thread; // dedup stamps for CM_StoreBrushes
 } leafList_t;
 
 int CM_BoxBrushes(const vec3_t mins, const vec3_t maxs, cbrush_t **list, int listsize);
@@ -418,6 +418,10 @@ static patchPlane_t planes[MAX_PATCH_PLANES];
 
 static int numFacets;
 static facet_t facets[MAX_FACETS];
+static vec3_t facetBounds[MAX_FACETS][2];
+
+static int numNodes;
+static patchNode_t nodes[2 * MAX_FACETS];
 
 #define NORMAL_EPSILON 0.0001
 #define DIST_EPSILON 0.02
@@ -972,6 +976,63 @@ static void CM_AddFacetBevels(facet_t *facet) {
 #endif // BSPC
 }
 
+/*
+==================
+CM_SetFacetBounds
+
+A facet never leaves the grid cell it was made from, the bounds get a
+little slack for the epsilons of the border planes
+==================
+*/
+static void CM_SetFacetBounds(const cGrid_t *grid, int i, int j) {
+	float *mins = facetBounds[numFacets][0];
+	float *maxs = facetBounds[numFacets][1];
+	int k;
+
+	ClearBounds(mins, maxs);
+	AddPointToBounds(grid->points[i][j], mins, maxs);
+	AddPointToBounds(grid->points[i + 1][j], mins, maxs);
+	AddPointToBounds(grid->points[i][j + 1], mins, maxs);
+	AddPointToBounds(grid->points[i + 1][j + 1], mins, maxs);
+
+	for (k = 0; k < 3; k++) {
+		mins[k] -= 1;
+		maxs[k] += 1;
+	}
+}
+
+/*
+==================
+CM_BuildPatchNodes
+
+Builds the node for a range of facets and everything below it
+==================
+*/
+static void CM_BuildPatchNodes(int firstFacet, int count) {
+	patchNode_t *node;
+	int i, half;
+
+	node = &nodes[numNodes++];
+	node->firstFacet = firstFacet;
+	node->numFacets = count;
+	node->secondChild = 0;
+
+	ClearBounds(node->bounds[0], node->bounds[1]);
+	for (i = firstFacet; i < firstFacet + count; i++) {
+		AddPointToBounds(facetBounds[i][0], node->bounds[0], node->bounds[1]);
+		AddPointToBounds(facetBounds[i][1], node->bounds[0], node->bounds[1]);
+	}
+
+	if (count <= PATCH_LEAF_FACETS) {
+		return;
+	}
+
+	half = count / 2;
+	CM_BuildPatchNodes(firstFacet, half);
+	node->secondChild = numNodes;
+	CM_BuildPatchNodes(firstFacet + half, count - half);
+}
+
 typedef enum { EN_TOP, EN_RIGHT, EN_BOTTOM, EN_LEFT } edgeName_t;
 
 /*
@@ -1076,6 +1137,7 @@ static void CM_PatchCollideFromGrid(const cGrid_t *grid, patchCollide_t *pf) {
 				CM_SetBorderInward(facet, grid, gridPlanes, i, j, -1);
 				if (CM_ValidateFacet(facet)) {
 					CM_AddFacetBevels(facet);
+					CM_SetFacetBounds(grid, i, j);
 					numFacets++;
 				}
 			} else {
@@ -1096,6 +1158,7 @@ static void CM_PatchCollideFromGrid(const cGrid_t *grid, patchCollide_t *pf) {
 				CM_SetBorderInward(facet, grid, gridPlanes, i, j, 0);
 				if (CM_ValidateFacet(facet)) {
 					CM_AddFacetBevels(facet);
+					CM_SetFacetBounds(grid, i, j);
 					numFacets++;
 				}
 
@@ -1121,12 +1184,18 @@ static void CM_PatchCollideFromGrid(const cGrid_t *grid, patchCollide_t *pf) {
 				CM_SetBorderInward(facet, grid, gridPlanes, i, j, 1);
 				if (CM_ValidateFacet(facet)) {
 					CM_AddFacetBevels(facet);
+					CM_SetFacetBounds(grid, i, j);
 					numFacets++;
 				}
 			}
 		}
 	}
 
+	numNodes = 0;
+	if (numFacets) {
+		CM_BuildPatchNodes(0, numFacets);
+	}
+
 	// copy the results out
 	pf->numPlanes = numPlanes;
 	pf->numFacets = numFacets;
@@ -1134,6 +1203,9 @@ static void CM_PatchCollideFromGrid(const cGrid_t *grid, patchCollide_t *pf) {
 	Com_Memcpy(pf->facets, facets, numFacets * sizeof(*pf->facets));
 	pf->planes = Hunk_Alloc(numPlanes * sizeof(*pf->planes), h_high);
 	Com_Memcpy(pf->planes, planes, numPlanes * sizeof(*pf->planes));
+	pf->numNodes = numNodes;
+	pf->nodes = Hunk_Alloc(numNodes * sizeof(*pf->nodes), h_high);
+	Com_Memcpy(pf->nodes, nodes, numNodes * sizeof(*pf->nodes));
 }
 
 /*
@@ -1221,6 +1293,84 @@ TRACE TESTING
 ================================================================================
 */
 
+/*
+====================
+CM_PatchFacetRanges
+
+Walks the facet tree for the facets whose bounds touch the trace bounds and
+returns them as [first, end) ranges in ranges, in facet order
+====================
+*/
+static int CM_PatchFacetRanges(const traceWork_t *tw, const patchCollide_t *pc, int *ranges) {
+	const patchNode_t *node;
+	int stack[32];
+	int depth;
+	int numRanges;
+
+	if (!pc->numNodes) {
+		return 0;
+	}
+
+	numRanges = 0;
+	stack[0] = 0;
+	depth = 1;
+	while (depth) {
+		node = &pc->nodes[stack[--depth]];
+
+		if (!CM_BoundsIntersect(tw->bounds[0], tw->bounds[1], node->bounds[0], node->bounds[1])) {
+			continue;
+		}
+
+		if (node->secondChild) {
+			// the first child goes on top so its facets come first
+			stack[depth++] = node->secondChild;
+			stack[depth++] = node - pc->nodes + 1;
+			continue;
+		}
+
+		// merge with the previous range if they touch
+		if (numRanges && ranges[numRanges * 2 - 1] == node->firstFacet) {
+			ranges[numRanges * 2 - 1] += node->numFacets;
+		} else {
+			ranges[numRanges * 2] = node->firstFacet;
+			ranges[numRanges * 2 + 1] = node->firstFacet + node->numFacets;
+			numRanges++;
+		}
+	}
+
+	return numRanges;
+}
+
+/*
+====================
+CM_TracePointPlane
+
+Determines the point trace's relationship to one of the patch planes
+====================
+*/
+static void CM_TracePointPlane(const traceWork_t *tw, const patchPlane_t *planes, qboolean *frontFacing,
+							   float *intersection) {
+	float offset;
+	float d1, d2;
+
+	offset = DotProduct(tw->offsets[planes->signbits], planes->plane);
+	d1 = DotProduct(tw->start, planes->plane) - planes->plane[3] + offset;
+	d2 = DotProduct(tw->end, planes->plane) - planes->plane[3] + offset;
+	if (d1 <= 0) {
+		*frontFacing = qfalse;
+	} else {
+		*frontFacing = qtrue;
+	}
+	if (d1 == d2) {
+		*intersection = 99999;
+	} else {
+		*intersection = d1 / (d1 - d2);
+		if (*intersection <= 0) {
+			*intersection = 99999;
+		}
+	}
+}
+
 /*
 ====================
 CM_TracePointThroughPatchCollide
@@ -1231,15 +1381,15 @@ CM_TracePointThroughPatchCollide
 void CM_TracePointThroughPatchCollide(traceWork_t *tw, const struct patchCollide_s *pc) {
 	qboolean frontFacing[MAX_PATCH_PLANES];
 	float intersection[MAX_PATCH_PLANES];
+	byte planeTested[MAX_PATCH_PLANES];
+	int ranges[MAX_FACETS];
+	int numRanges, r;
 	float intersect;
 	const patchPlane_t *planes;
 	const facet_t *facet;
 	int i, j, k;
 	float offset;
 	float d1, d2;
-#ifndef BSPC
-	static cvar_t *cv;
-#endif // BSPC
 
 #ifndef BSPC
 	if (!cm_playerCurveClip->integer || !tw->isPoint) {
@@ -1247,77 +1397,73 @@ void CM_TracePointThroughPatchCollide(traceWork_t *tw, const struct patchCollide
 	}
 #endif
 
-	// determine the trace's relationship to all planes
-	planes = pc->planes;
-	for (i = 0; i < pc->numPlanes; i++, planes++) {
-		offset = DotProduct(tw->offsets[planes->signbits], planes->plane);
-		d1 = DotProduct(tw->start, planes->plane) - planes->plane[3] + offset;
-		d2 = DotProduct(tw->end, planes->plane) - planes->plane[3] + offset;
-		if (d1 <= 0) {
-			frontFacing[i] = qfalse;
-		} else {
-			frontFacing[i] = qtrue;
-		}
-		if (d1 == d2) {
-			intersection[i] = 99999;
-		} else {
-			intersection[i] = d1 / (d1 - d2);
-			if (intersection[i] <= 0) {
-				intersection[i] = 99999;
-			}
-		}
+	numRanges = CM_PatchFacetRanges(tw, pc, ranges);
+	if (!numRanges) {
+		return;
 	}
 
+	// the trace's relationship to the planes is only determined
+	// for the planes of the facets the trace can touch
+	Com_Memset(planeTested, 0, pc->numPlanes);
+
 	// see if any of the surface planes are intersected
-	facet = pc->facets;
-	for (i = 0; i < pc->numFacets; i++, facet++) {
-		if (!frontFacing[facet->surfacePlane]) {
-			continue;
-		}
-		intersect = intersection[facet->surfacePlane];
-		if (intersect < 0) {
-			continue; // surface is behind the starting point
-		}
-		if (intersect > tw->trace.fraction) {
-			continue; // already hit something closer
-		}
-		for (j = 0; j < facet->numBorders; j++) {
-			k = facet->borderPlanes[j];
-			if (frontFacing[k] ^ facet->borderInward[j]) {
-				if (intersection[k] > intersect) {
-					break;
+	for (r = 0; r < numRanges; r++) {
+		for (i = ranges[r * 2], facet = &pc->facets[i]; i < ranges[r * 2 + 1]; i++, facet++) {
+			k = facet->surfacePlane;
+			if (!planeTested[k]) {
+				CM_TracePointPlane(tw, &pc->planes[k], &frontFacing[k], &intersection[k]);
+				planeTested[k] = qtrue;
+			}
+			if (!frontFacing[k]) {
+				continue;
+			}
+			intersect = intersection[k];
+			if (intersect < 0) {
+				continue; // surface is behind the starting point
+			}
+			if (intersect > tw->trace.fraction) {
+				continue; // already hit something closer
+			}
+			for (j = 0; j < facet->numBorders; j++) {
+				k = facet->borderPlanes[j];
+				if (!planeTested[k]) {
+					CM_TracePointPlane(tw, &pc->planes[k], &frontFacing[k], &intersection[k]);
+					planeTested[k] = qtrue;
 				}
-			} else {
-				if (intersection[k] < intersect) {
-					break;
+				if (frontFacing[k] ^ facet->borderInward[j]) {
+					if (intersection[k] > intersect) {
+						break;
+					}
+				} else {
+					if (intersection[k] < intersect) {
+						break;
+					}
 				}
 			}
-		}
-		if (j == facet->numBorders) {
-			// we hit this facet
+			if (j == facet->numBorders) {
+				// we hit this facet
 #ifndef BSPC
-			if (!cv) {
-				cv = Cvar_Get("r_debugSurfaceUpdate", "1", 0);
-			}
-			if (cv->integer) {
-				debugPatchCollide = pc;
-				debugFacet = facet;
-			}
+				// only the main thread records the facet for CM_DrawDebugSurface
+				if (cm_debugSurfaceUpdate->integer && !Com_JobThreadIndex()) {
+					debugPatchCollide = pc;
+					debugFacet = facet;
+				}
 #endif // BSPC
-			planes = &pc->planes[facet->surfacePlane];
+				planes = &pc->planes[facet->surfacePlane];
 
-			// calculate intersection with a slight pushoff
-			offset = DotProduct(tw->offsets[planes->signbits], planes->plane);
-			d1 = DotProduct(tw->start, planes->plane) - planes->plane[3] + offset;
-			d2 = DotProduct(tw->end, planes->plane) - planes->plane[3] + offset;
-			tw->trace.fraction = (d1 - SURFACE_CLIP_EPSILON) / (d1 - d2);
+				// calculate intersection with a slight pushoff
+				offset = DotProduct(tw->offsets[planes->signbits], planes->plane);
+				d1 = DotProduct(tw->start, planes->plane) - planes->plane[3] + offset;
+				d2 = DotProduct(tw->end, planes->plane) - planes->plane[3] + offset;
+				tw->trace.fraction = (d1 - SURFACE_CLIP_EPSILON) / (d1 - d2);
 
-			if (tw->trace.fraction < 0) {
-				tw->trace.fraction = 0;
-			}
+				if (tw->trace.fraction < 0) {
+					tw->trace.fraction = 0;
+				}
 
-			VectorCopy(planes->plane, tw->trace.plane.normal);
-			tw->trace.plane.dist = planes->plane[3];
+				VectorCopy(planes->plane, tw->trace.plane.normal);
+				tw->trace.plane.dist = planes->plane[3];
+			}
 		}
 	}
 }
@@ -1375,15 +1521,14 @@ CM_TraceThroughPatchCollide
 ====================
 */
 void CM_TraceThroughPatchCollide(traceWork_t *tw, const struct patchCollide_s *pc) {
+	int ranges[MAX_FACETS];
+	int numRanges, r;
 	int i, j, hit, hitnum;
 	float offset, enterFrac, leaveFrac, t;
 	patchPlane_t *planes;
 	facet_t *facet;
 	float plane[4] = {0, 0, 0, 0}, bestplane[4] = {0, 0, 0, 0};
 	vec3_t startp, endp;
-#ifndef BSPC
-	static cvar_t *cv;
-#endif // BSPC
 
 	if (!CM_BoundsIntersect(tw->bounds[0], tw->bounds[1], pc->bounds[0], pc->bounds[1])) {
 		return;
@@ -1394,51 +1539,16 @@ void CM_TraceThroughPatchCollide(traceWork_t *tw, const struct patchCollide_s *p
 		return;
 	}
 
-	facet = pc->facets;
-	for (i = 0; i < pc->numFacets; i++, facet++) {
-		enterFrac = -1.0;
-		leaveFrac = 1.0;
-		hitnum = -1;
-		//
-		planes = &pc->planes[facet->surfacePlane];
-		VectorCopy(planes->plane, plane);
-		plane[3] = planes->plane[3];
-		if (tw->sphere.use) {
-			// adjust the plane distance appropriately for radius
-			plane[3] += tw->sphere.radius;
-
-			// find the closest point on the capsule to the plane
-			t = DotProduct(plane, tw->sphere.offset);
-			if (t > 0.0f) {
-				VectorSubtract(tw->start, tw->sphere.offset, startp);
-				VectorSubtract(tw->end, tw->sphere.offset, endp);
-			} else {
-				VectorAdd(tw->start, tw->sphere.offset, startp);
-				VectorAdd(tw->end, tw->sphere.offset, endp);
-			}
-		} else {
-			offset = DotProduct(tw->offsets[planes->signbits], plane);
-			plane[3] -= offset;
-			VectorCopy(tw->start, startp);
-			VectorCopy(tw->end, endp);
-		}
-
-		if (!CM_CheckFacetPlane(plane, startp, endp, &enterFrac, &leaveFrac, &hit)) {
-			continue;
-		}
-		if (hit) {
-			Vector4Copy(plane, bestplane);
-		}
-
-		for (j = 0; j < facet->numBorders; j++) {
-			planes = &pc->planes[facet->borderPlanes[j]];
-			if (facet->borderInward[j]) {
-				VectorNegate(planes->plane, plane);
-				plane[3] = -planes->plane[3];
-			} else {
-				VectorCopy(planes->plane, plane);
-				plane[3] = planes->plane[3];
-			}
+	numRanges = CM_PatchFacetRanges(tw, pc, ranges);
+	for (r = 0; r < numRanges; r++) {
+		for (i = ranges[r * 2], facet = &pc->facets[i]; i < ranges[r * 2 + 1]; i++, facet++) {
+			enterFrac = -1.0;
+			leaveFrac = 1.0;
+			hitnum = -1;
+			//
+			planes = &pc->planes[facet->surfacePlane];
+			VectorCopy(planes->plane, plane);
+			plane[3] = planes->plane[3];
 			if (tw->sphere.use) {
 				// adjust the plane distance appropriately for radius
 				plane[3] += tw->sphere.radius;
@@ -1453,45 +1563,79 @@ void CM_TraceThroughPatchCollide(traceWork_t *tw, const struct patchCollide_s *p
 					VectorAdd(tw->end, tw->sphere.offset, endp);
 				}
 			} else {
-				// NOTE: this works even though the plane might be flipped because the bbox is centered
 				offset = DotProduct(tw->offsets[planes->signbits], plane);
-				plane[3] += fabs(offset);
+				plane[3] -= offset;
 				VectorCopy(tw->start, startp);
 				VectorCopy(tw->end, endp);
 			}
 
 			if (!CM_CheckFacetPlane(plane, startp, endp, &enterFrac, &leaveFrac, &hit)) {
-				break;
+				continue;
 			}
 			if (hit) {
-				hitnum = j;
 				Vector4Copy(plane, bestplane);
 			}
-		}
-		if (j < facet->numBorders)
-			continue;
-		// never clip against the back side
-		if (hitnum == facet->numBorders - 1)
-			continue;
 
-		if (enterFrac < leaveFrac && enterFrac >= 0) {
-			if (enterFrac < tw->trace.fraction) {
-				if (enterFrac < 0) {
-					enterFrac = 0;
+			for (j = 0; j < facet->numBorders; j++) {
+				planes = &pc->planes[facet->borderPlanes[j]];
+				if (facet->borderInward[j]) {
+					VectorNegate(planes->plane, plane);
+					plane[3] = -planes->plane[3];
+				} else {
+					VectorCopy(planes->plane, plane);
+					plane[3] = planes->plane[3];
 				}
-#ifndef BSPC
-				if (!cv) {
-					cv = Cvar_Get("r_debugSurfaceUpdate", "1", 0);
+				if (tw->sphere.use) {
+					// adjust the plane distance appropriately for radius
+					plane[3] += tw->sphere.radius;
+
+					// find the closest point on the capsule to the plane
+					t = DotProduct(plane, tw->sphere.offset);
+					if (t > 0.0f) {
+						VectorSubtract(tw->start, tw->sphere.offset, startp);
+						VectorSubtract(tw->end, tw->sphere.offset, endp);
+					} else {
+						VectorAdd(tw->start, tw->sphere.offset, startp);
+						VectorAdd(tw->end, tw->sphere.offset, endp);
+					}
+				} else {
+					// NOTE: this works even though the plane might be flipped because the bbox is centered
+					offset = DotProduct(tw->offsets[planes->signbits], plane);
+					plane[3] += fabs(offset);
+					VectorCopy(tw->start, startp);
+					VectorCopy(tw->end, endp);
 				}
-				if (cv && cv->integer) {
-					debugPatchCollide = pc;
-					debugFacet = facet;
+
+				if (!CM_CheckFacetPlane(plane, startp, endp, &enterFrac, &leaveFrac, &hit)) {
+					break;
 				}
-#endif // BSPC
+				if (hit) {
+					hitnum = j;
+					Vector4Copy(plane, bestplane);
+				}
+			}
+			if (j < facet->numBorders)
+				continue;
+			// never clip against the back side
+			if (hitnum == facet->numBorders - 1)
+				continue;
 
-				tw->trace.fraction = enterFrac;
-				VectorCopy(bestplane, tw->trace.plane.normal);
-				tw->trace.plane.dist = bestplane[3];
+			if (enterFrac < leaveFrac && enterFrac >= 0) {
+				if (enterFrac < tw->trace.fraction) {
+					if (enterFrac < 0) {
+						enterFrac = 0;
+					}
+	#ifndef BSPC
+					if (cm_debugSurfaceUpdate->integer && !Com_JobThreadIndex()) {
+						debugPatchCollide = pc;
+						debugFacet = facet;
+					}
+	#endif // BSPC
+
+					tw->trace.fraction = enterFrac;
+					VectorCopy(bestplane, tw->trace.plane.normal);
+					tw->trace.plane.dist = bestplane[3];
+				}
 			}
 		}
 	}
@@ -1511,6 +1655,8 @@ CM_PositionTestInPatchCollide
 ====================
 */
 qboolean CM_PositionTestInPatchCollide(traceWork_t *tw, const struct patchCollide_s *pc) {
+	int ranges[MAX_FACETS];
+	int numRanges, r;
 	int i, j;
 	float offset, t;
 	patchPlane_t *planes;
@@ -1522,68 +1668,70 @@ qboolean CM_PositionTestInPatchCollide(traceWork_t *tw, const struct patchCollid
 		return qfalse;
 	}
 	//
-	facet = pc->facets;
-	for (i = 0; i < pc->numFacets; i++, facet++) {
-		planes = &pc->planes[facet->surfacePlane];
-		VectorCopy(planes->plane, plane);
-		plane[3] = planes->plane[3];
-		if (tw->sphere.use) {
-			// adjust the plane distance appropriately for radius
-			plane[3] += tw->sphere.radius;
-
-			// find the closest point on the capsule to the plane
-			t = DotProduct(plane, tw->sphere.offset);
-			if (t > 0) {
-				VectorSubtract(tw->start, tw->sphere.offset, startp);
-			} else {
-				VectorAdd(tw->start, tw->sphere.offset, startp);
-			}
-		} else {
-			offset = DotProduct(tw->offsets[planes->signbits], plane);
-			plane[3] -= offset;
-			VectorCopy(tw->start, startp);
-		}
-
-		if (DotProduct(plane, startp) - plane[3] > 0.0f) {
-			continue;
-		}
-
-		for (j = 0; j < facet->numBorders; j++) {
-			planes = &pc->planes[facet->borderPlanes[j]];
-			if (facet->borderInward[j]) {
-				VectorNegate(planes->plane, plane);
-				plane[3] = -planes->plane[3];
-			} else {
-				VectorCopy(planes->plane, plane);
-				plane[3] = planes->plane[3];
-			}
+	numRanges = CM_PatchFacetRanges(tw, pc, ranges);
+	for (r = 0; r < numRanges; r++) {
+		for (i = ranges[r * 2], facet = &pc->facets[i]; i < ranges[r * 2 + 1]; i++, facet++) {
+			planes = &pc->planes[facet->surfacePlane];
+			VectorCopy(planes->plane, plane);
+			plane[3] = planes->plane[3];
 			if (tw->sphere.use) {
 				// adjust the plane distance appropriately for radius
 				plane[3] += tw->sphere.radius;
 
 				// find the closest point on the capsule to the plane
 				t = DotProduct(plane, tw->sphere.offset);
-				if (t > 0.0f) {
+				if (t > 0) {
 					VectorSubtract(tw->start, tw->sphere.offset, startp);
 				} else {
 					VectorAdd(tw->start, tw->sphere.offset, startp);
 				}
 			} else {
-				// NOTE: this works even though the plane might be flipped because the bbox is centered
 				offset = DotProduct(tw->offsets[planes->signbits], plane);
-				plane[3] += fabs(offset);
+				plane[3] -= offset;
 				VectorCopy(tw->start, startp);
 			}
 
 			if (DotProduct(plane, startp) - plane[3] > 0.0f) {
-				break;
+				continue;
 			}
+
+			for (j = 0; j < facet->numBorders; j++) {
+				planes = &pc->planes[facet->borderPlanes[j]];
+				if (facet->borderInward[j]) {
+					VectorNegate(planes->plane, plane);
+					plane[3] = -planes->plane[3];
+				} else {
+					VectorCopy(planes->plane, plane);
+					plane[3] = planes->plane[3];
+				}
+				if (tw->sphere.use) {
+					// adjust the plane distance appropriately for radius
+					plane[3] += tw->sphere.radius;
+
+					// find the closest point on the capsule to the plane
+					t = DotProduct(plane, tw->sphere.offset);
+					if (t > 0.0f) {
+						VectorSubtract(tw->start, tw->sphere.offset, startp);
+					} else {
+						VectorAdd(tw->start, tw->sphere.offset, startp);
+					}
+				} else {
+					// NOTE: this works even though the plane might be flipped because the bbox is centered
+					offset = DotProduct(tw->offsets[planes->signbits], plane);
+					plane[3] += fabs(offset);
+					VectorCopy(tw->start, startp);
+				}
+
+				if (DotProduct(plane, startp) - plane[3] > 0.0f) {
+					break;
+				}
+			}
+			if (j < facet->numBorders) {
+				continue;
+			}
+			// inside this patch facet
+			return qtrue;
 		}
-		if (j < facet->numBorders) {
-			continue;
-		}
-		// inside this patch facet
-		return qtrue;
 	}
 	return qfalse;
 }
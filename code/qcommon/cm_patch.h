@@ -75,12 +75,27 @@ typedef struct {
 	qboolean borderNoAdjust[4 + 6 + 16];
 } facet_t;
 
+// a bounding volume hierarchy over ranges of the facet list, so traces only
+// visit the facets they can touch.  The children of a node split its range in
+// two and nodes are stored depth first, so the first child of node n is n + 1
+// and walking the tree visits the facets in their original order.
+#define PATCH_LEAF_FACETS 4
+
+typedef struct {
+	vec3_t bounds[2];
+	int firstFacet;
+	int numFacets;
+	int secondChild; // 0 for a leaf
+} patchNode_t;
+
 typedef struct patchCollide_s {
 	vec3_t bounds[2];
 	int numPlanes; // surface planes plus edge planes
 	patchPlane_t *planes;
 	int numFacets;
 	facet_t *facets;
+	int numNodes;
+	patchNode_t *nodes;
 } patchCollide_t;
 
 #define MAX_GRID_SIZE 129
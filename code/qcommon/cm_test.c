@@ -95,12 +95,12 @@ void CM_StoreBrushes(leafList_t *ll, int nodenum) {
 	leaf = &cm.leafs[leafnum];
 
 	for (k = 0; k < leaf->numLeafBrushes; k++) {
-		brushnum = cm.leafbrushes[leaf->firstLeafBrush + k];
+		brushnum = cm.leafbrushes[leaf->firstLeafBrush + k].brushNum;
 		b = &cm.brushes[brushnum];
-		if (b->checkcount == cm.checkcount) {
+		if (ll->thread->brushChecks[brushnum] == ll->thread->checkcount) {
 			continue; // already checked this brush in another leaf
 		}
-		b->checkcount = cm.checkcount;
+		ll->thread->brushChecks[brushnum] = ll->thread->checkcount;
 		for (i = 0; i < 3; i++) {
 			if (b->bounds[0][i] >= ll->bounds[1][i] || b->bounds[1][i] <= ll->bounds[0][i]) {
 				break;
@@ -167,8 +167,6 @@ CM_BoxLeafnums
 int CM_BoxLeafnums(const vec3_t mins, const vec3_t maxs, int *list, int listsize, int *lastLeaf) {
 	leafList_t ll;
 
-	cm.checkcount++;
-
 	VectorCopy(mins, ll.bounds[0]);
 	VectorCopy(maxs, ll.bounds[1]);
 	ll.count = 0;
@@ -177,6 +175,7 @@ int CM_BoxLeafnums(const vec3_t mins, const vec3_t maxs, int *list, int listsize
 	ll.storeLeafs = CM_StoreLeafs;
 	ll.lastLeaf = 0;
 	ll.overflowed = qfalse;
+	ll.thread = NULL; // leafs are only reached once
 
 	CM_BoxLeafnums_r(&ll, 0);
 
@@ -192,8 +191,6 @@ CM_BoxBrushes
 int CM_BoxBrushes(const vec3_t mins, const vec3_t maxs, cbrush_t **list, int listsize) {
 	leafList_t ll;
 
-	cm.checkcount++;
-
 	VectorCopy(mins, ll.bounds[0]);
 	VectorCopy(maxs, ll.bounds[1]);
 	ll.count = 0;
@@ -202,6 +199,8 @@ int CM_BoxBrushes(const vec3_t mins, const vec3_t maxs, cbrush_t **list, int lis
 	ll.storeLeafs = CM_StoreBrushes;
 	ll.lastLeaf = 0;
 	ll.overflowed = qfalse;
+	ll.thread = CM_Thread();
+	ll.thread->checkcount++;
 
 	CM_BoxLeafnums_r(&ll, 0);
 
@@ -240,7 +239,7 @@ int CM_PointContents(const vec3_t p, clipHandle_t model) {
 
 	contents = 0;
 	for (k = 0; k < leaf->numLeafBrushes; k++) {
-		brushnum = cm.leafbrushes[leaf->firstLeafBrush + k];
+		brushnum = cm.leafbrushes[leaf->firstLeafBrush + k].brushNum;
 		b = &cm.brushes[brushnum];
 
 		if (!CM_BoundsIntersectPoint(b->bounds[0], b->bounds[1], p)) {
@@ -341,6 +340,54 @@ void CM_FloodArea_r(int areaNum, int floodnum) {
 	}
 }
 
+/*
+====================
+CM_SetFloodAreaBits
+
+Rebuilds the area bits of the areas in a flood
+====================
+*/
+static void CM_SetFloodAreaBits(int floodnum) {
+	byte *bits;
+	int i, j;
+
+	bits = NULL;
+	for (i = 0; i < cm.numAreas; i++) {
+		if (cm.areas[i].floodnum != floodnum) {
+			continue;
+		}
+
+		if (bits) {
+			Com_Memcpy(cm.areaBits + i * cm.areaBytes, bits, cm.areaBytes);
+			continue;
+		}
+
+		bits = cm.areaBits + i * cm.areaBytes;
+		Com_Memset(bits, 0, cm.areaBytes);
+		for (j = i; j < cm.numAreas; j++) {
+			if (cm.areas[j].floodnum == floodnum) {
+				bits[j >> 3] |= 1 << (j & 7);
+			}
+		}
+	}
+}
+
+/*
+====================
+CM_RefloodArea
+
+Gives the areas connected to an area a new flood number
+====================
+*/
+static int CM_RefloodArea(int areaNum) {
+	cm.floodvalid++;
+	cm.floodnum++;
+	CM_FloodArea_r(areaNum, cm.floodnum);
+	CM_SetFloodAreaBits(cm.floodnum);
+
+	return cm.floodnum;
+}
+
 /*
 ====================
 CM_FloodAreaConnections
@@ -364,15 +411,25 @@ void CM_FloodAreaConnections(void) {
 		floodnum++;
 		CM_FloodArea_r(i, floodnum);
 	}
+	cm.floodnum = floodnum;
+
+	for (i = 1; i <= floodnum; i++) {
+		CM_SetFloodAreaBits(i);
+	}
 }
 
 /*
 ====================
 CM_AdjustAreaPortalState
 
+Only the floods of the two areas can change, opening a portal joins them
+and closing one can split them in two
 ====================
 */
 void CM_AdjustAreaPortalState(int area1, int area2, qboolean open) {
+	int *portal1, *portal2;
+	int floodnum;
+
 	if (area1 < 0 || area2 < 0) {
 		return;
 	}
@@ -381,18 +438,28 @@ void CM_AdjustAreaPortalState(int area1, int area2, qboolean open) {
 		Com_Error(ERR_DROP, "CM_ChangeAreaPortalState: bad area number");
 	}
 
+	portal1 = &cm.areaPortals[area1 * cm.numAreas + area2];
+	portal2 = &cm.areaPortals[area2 * cm.numAreas + area1];
+
 	if (open) {
-		cm.areaPortals[area1 * cm.numAreas + area2]++;
-		cm.areaPortals[area2 * cm.numAreas + area1]++;
+		(*portal1)++;
+		(*portal2)++;
+		if (cm.areas[area1].floodnum != cm.areas[area2].floodnum) {
+			CM_RefloodArea(area1);
+		}
 	} else {
-		cm.areaPortals[area1 * cm.numAreas + area2]--;
-		cm.areaPortals[area2 * cm.numAreas + area1]--;
-		if (cm.areaPortals[area2 * cm.numAreas + area1] < 0) {
+		(*portal1)--;
+		(*portal2)--;
+		if (*portal2 < 0) {
 			Com_Error(ERR_DROP, "CM_AdjustAreaPortalState: negative reference count");
 		}
+		if (!*portal2 && area1 != area2) {
+			// whatever area1 no longer reaches keeps the old flood number
+			floodnum = cm.areas[area1].floodnum;
+			CM_RefloodArea(area1);
+			CM_SetFloodAreaBits(floodnum);
+		}
 	}
-
-	CM_FloodAreaConnections();
 }
 
 /*
@@ -437,8 +504,8 @@ This is used to cull non-visible entities from snapshots
 =================
 */
 int CM_WriteAreaBits(byte *buffer, int area) {
+	const byte *bits;
 	int i;
-	int floodnum;
 	int bytes;
 
 	bytes = (cm.numAreas + 7) >> 3;
@@ -451,10 +518,9 @@ int CM_WriteAreaBits(byte *buffer, int area) {
 	{ // for debugging, send everything
 		Com_Memset(buffer, 255, bytes);
 	} else {
-		floodnum = cm.areas[area].floodnum;
-		for (i = 0; i < cm.numAreas; i++) {
-			if (cm.areas[i].floodnum == floodnum || area == -1)
-				buffer[i >> 3] |= 1 << (i & 7);
+		bits = cm.areaBits + area * cm.areaBytes;
+		for (i = 0; i < bytes; i++) {
+			buffer[i] |= bits[i];
 		}
 	}
 
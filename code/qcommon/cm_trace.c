@@ -21,6 +21,10 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 */
 #include "cm_local.h"
 
+#ifdef CM_SIMD_PLANES
+#include <xmmintrin.h>
+#endif
+
 // always use bbox vs. bbox collision and never capsule vs. bbox or vice versa
 //#define ALWAYS_BBOX_VS_BBOX
 // always use capsule vs. capsule collision and never capsule vs. bbox or vice versa
@@ -142,6 +146,103 @@ static float SquareRootFloat(float number) {
 	return number * y;
 }
 
+#ifdef CM_SIMD_PLANES
+/*
+===============================================================================
+
+SSE PLANE TESTS
+
+===============================================================================
+*/
+
+// the trace box corners, splatted for the plane blocks
+typedef struct {
+	__m128 size[2][3]; // tw->offsets[0] and tw->offsets[7]
+} cmBlockOffsets_t;
+
+/*
+================
+CM_InitBlockOffsets
+================
+*/
+static void CM_InitBlockOffsets(const traceWork_t *tw, cmBlockOffsets_t *bo) {
+	int j;
+
+	for (j = 0; j < 3; j++) {
+		bo->size[0][j] = _mm_set1_ps(tw->offsets[0][j]);
+		bo->size[1][j] = _mm_set1_ps(tw->offsets[7][j]);
+	}
+}
+
+/*
+================
+CM_BlockDistances
+
+The distances of a point in front of the four planes of a block, with the
+planes moved out to the box corner picked by the plane signbits.  Evaluated
+in the same order as the scalar code.
+================
+*/
+static ID_INLINE __m128 CM_BlockDistances(const cbrushPlanes_t *block, const cmBlockOffsets_t *bo, const vec3_t p) {
+	__m128 nx, ny, nz, neg, ox, oy, oz, dist, d;
+	const __m128 zero = _mm_setzero_ps();
+
+	nx = _mm_loadu_ps(block->normal[0]);
+	ny = _mm_loadu_ps(block->normal[1]);
+	nz = _mm_loadu_ps(block->normal[2]);
+
+	// offsets[signbits], a signbit is set for a negative normal component
+	neg = _mm_cmplt_ps(nx, zero);
+	ox = _mm_or_ps(_mm_and_ps(neg, bo->size[1][0]), _mm_andnot_ps(neg, bo->size[0][0]));
+	neg = _mm_cmplt_ps(ny, zero);
+	oy = _mm_or_ps(_mm_and_ps(neg, bo->size[1][1]), _mm_andnot_ps(neg, bo->size[0][1]));
+	neg = _mm_cmplt_ps(nz, zero);
+	oz = _mm_or_ps(_mm_and_ps(neg, bo->size[1][2]), _mm_andnot_ps(neg, bo->size[0][2]));
+
+	// dist = plane->dist - DotProduct(offset, plane->normal)
+	dist = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ox, nx), _mm_mul_ps(oy, ny)), _mm_mul_ps(oz, nz));
+	dist = _mm_sub_ps(_mm_loadu_ps(block->dist), dist);
+
+	// DotProduct(p, plane->normal) - dist
+	d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(p[0]), nx), _mm_mul_ps(_mm_set1_ps(p[1]), ny)),
+				   _mm_mul_ps(_mm_set1_ps(p[2]), nz));
+	return _mm_sub_ps(d, dist);
+}
+
+/*
+================
+CM_TestBoxInBrushBlocks
+
+Box position test against the non-axial sides of a brush, four at a time
+================
+*/
+static qboolean CM_TestBoxInBrushBlocks(const traceWork_t *tw, const cbrush_t *brush) {
+	cmBlockOffsets_t bo;
+	__m128 d1;
+	int first, i, mask;
+	const __m128 zero = _mm_setzero_ps();
+
+	CM_InitBlockOffsets(tw, &bo);
+
+	// the first six planes are the axial planes, so we only
+	// need to test the remainder
+	for (first = 4; first < brush->numsides; first += 4) {
+		d1 = CM_BlockDistances(&brush->planeBlocks[first >> 2], &bo, tw->start);
+
+		// if completely in front of face, no intersection
+		mask = _mm_movemask_ps(_mm_cmpgt_ps(d1, zero));
+		for (i = first; i < first + 4 && i < 6; i++) {
+			mask &= ~(1 << (i & 3));
+		}
+		if (mask) {
+			return qfalse;
+		}
+	}
+
+	return qtrue;
+}
+#endif // CM_SIMD_PLANES
+
 /*
 ===============================================================================
 
@@ -197,6 +298,12 @@ static void CM_TestBoxInBrush(traceWork_t *tw, const cbrush_t *brush) {
 				return;
 			}
 		}
+#ifdef CM_SIMD_PLANES
+	} else if (brush->planeBlocks) {
+		if (!CM_TestBoxInBrushBlocks(tw, brush)) {
+			return;
+		}
+#endif
 	} else {
 		// the first six planes are the axial planes, so we only
 		// need to test the remainder
@@ -229,24 +336,24 @@ CM_TestInLeaf
 */
 static void CM_TestInLeaf(traceWork_t *tw, const cLeaf_t *leaf) {
 	int k;
-	int brushnum;
-	cbrush_t *b;
+	int brushnum, surfnum;
+	const cLeafBrush_t *lb;
 	cPatch_t *patch;
 
 	// test box position against all brushes in the leaf
 	for (k = 0; k < leaf->numLeafBrushes; k++) {
-		brushnum = cm.leafbrushes[leaf->firstLeafBrush + k];
-		b = &cm.brushes[brushnum];
-		if (b->checkcount == cm.checkcount) {
+		lb = &cm.leafbrushes[leaf->firstLeafBrush + k];
+		brushnum = lb->brushNum;
+		if (tw->thread->brushChecks[brushnum] == tw->thread->checkcount) {
 			continue; // already checked this brush in another leaf
 		}
-		b->checkcount = cm.checkcount;
+		tw->thread->brushChecks[brushnum] = tw->thread->checkcount;
 
-		if (!(b->contents & tw->contents)) {
+		if (!(lb->contents & tw->contents)) {
 			continue;
 		}
 
-		CM_TestBoxInBrush(tw, b);
+		CM_TestBoxInBrush(tw, &cm.brushes[brushnum]);
 		if (tw->trace.allsolid) {
 			return;
 		}
@@ -259,14 +366,15 @@ static void CM_TestInLeaf(traceWork_t *tw, const cLeaf_t *leaf) {
 	if (!cm_noCurves->integer) {
 #endif // BSPC
 		for (k = 0; k < leaf->numLeafSurfaces; k++) {
-			patch = cm.surfaces[cm.leafsurfaces[leaf->firstLeafSurface + k]];
+			surfnum = cm.leafsurfaces[leaf->firstLeafSurface + k];
+			patch = cm.surfaces[surfnum];
 			if (!patch) {
 				continue;
 			}
-			if (patch->checkcount == cm.checkcount) {
+			if (tw->thread->patchChecks[surfnum] == tw->thread->checkcount) {
 				continue; // already checked this brush in another leaf
 			}
-			patch->checkcount = cm.checkcount;
+			tw->thread->patchChecks[surfnum] = tw->thread->checkcount;
 
 			if (!(patch->contents & tw->contents)) {
 				continue;
@@ -414,12 +522,11 @@ static void CM_PositionTest(traceWork_t *tw) {
 	ll.storeLeafs = CM_StoreLeafs;
 	ll.lastLeaf = 0;
 	ll.overflowed = qfalse;
-
-	cm.checkcount++;
+	ll.thread = NULL;
 
 	CM_BoxLeafnums_r(&ll, 0);
 
-	cm.checkcount++;
+	tw->thread->checkcount++;
 
 	// test the contents of the leafs
 	for (i = 0; i < ll.count; i++) {
@@ -555,6 +662,74 @@ static void CM_TraceThroughBrush(traceWork_t *tw, const cbrush_t *brush) {
 				}
 			}
 		}
+#ifdef CM_SIMD_PLANES
+	} else if (brush->planeBlocks) {
+		cmBlockOffsets_t bo;
+		__m128 d1v, d2v, out;
+		float d1s[4], d2s[4];
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 epsilon = _mm_set1_ps(SURFACE_CLIP_EPSILON);
+
+		CM_InitBlockOffsets(tw, &bo);
+
+		//
+		// same as below, but the distances for four planes are computed at once
+		//
+		for (i = 0; i < brush->numsides; i++) {
+			if (!(i & 3)) {
+				d1v = CM_BlockDistances(&brush->planeBlocks[i >> 2], &bo, tw->start);
+				d2v = CM_BlockDistances(&brush->planeBlocks[i >> 2], &bo, tw->end);
+
+				// if completely in front of any face, no intersection with the entire brush
+				out = _mm_and_ps(_mm_cmpgt_ps(d1v, zero), _mm_or_ps(_mm_cmpge_ps(d2v, epsilon), _mm_cmpge_ps(d2v, d1v)));
+				if (_mm_movemask_ps(out)) {
+					return;
+				}
+
+				_mm_storeu_ps(d1s, d1v);
+				_mm_storeu_ps(d2s, d2v);
+			}
+
+			side = brush->sides + i;
+			plane = side->plane;
+
+			d1 = d1s[i & 3];
+			d2 = d2s[i & 3];
+
+			if (d2 > 0) {
+				getout = qtrue; // endpoint is not in solid
+			}
+			if (d1 > 0) {
+				startout = qtrue;
+			}
+
+			// if it doesn't cross the plane, the plane isn't relevant
+			if (d1 <= 0 && d2 <= 0) {
+				continue;
+			}
+
+			// crosses face
+			if (d1 > d2) { // enter
+				f = (d1 - SURFACE_CLIP_EPSILON) / (d1 - d2);
+				if (f < 0) {
+					f = 0;
+				}
+				if (f > enterFrac) {
+					enterFrac = f;
+					clipplane = plane;
+					leadside = side;
+				}
+			} else { // leave
+				f = (d1 + SURFACE_CLIP_EPSILON) / (d1 - d2);
+				if (f > 1) {
+					f = 1;
+				}
+				if (f < leaveFrac) {
+					leaveFrac = f;
+				}
+			}
+		}
+#endif
 	} else {
 		//
 		// compare the trace against all planes of the brush
@@ -649,29 +824,28 @@ CM_TraceThroughLeaf
 */
 static void CM_TraceThroughLeaf(traceWork_t *tw, const cLeaf_t *leaf) {
 	int k;
-	int brushnum;
-	cbrush_t *b;
+	int brushnum, surfnum;
+	const cLeafBrush_t *lb;
 	cPatch_t *patch;
 
 	// trace line against all brushes in the leaf
 	for (k = 0; k < leaf->numLeafBrushes; k++) {
-		brushnum = cm.leafbrushes[leaf->firstLeafBrush + k];
-
-		b = &cm.brushes[brushnum];
-		if (b->checkcount == cm.checkcount) {
+		lb = &cm.leafbrushes[leaf->firstLeafBrush + k];
+		brushnum = lb->brushNum;
+		if (tw->thread->brushChecks[brushnum] == tw->thread->checkcount) {
 			continue; // already checked this brush in another leaf
 		}
-		b->checkcount = cm.checkcount;
+		tw->thread->brushChecks[brushnum] = tw->thread->checkcount;
 
-		if (!(b->contents & tw->contents)) {
+		if (!(lb->contents & tw->contents)) {
 			continue;
 		}
 
-		if (!CM_BoundsIntersect(tw->bounds[0], tw->bounds[1], b->bounds[0], b->bounds[1])) {
+		if (!CM_BoundsIntersect(tw->bounds[0], tw->bounds[1], lb->bounds[0], lb->bounds[1])) {
 			continue;
 		}
 
-		CM_TraceThroughBrush(tw, b);
+		CM_TraceThroughBrush(tw, &cm.brushes[brushnum]);
 		if (!tw->trace.fraction) {
 			return;
 		}
@@ -684,14 +858,15 @@ static void CM_TraceThroughLeaf(traceWork_t *tw, const cLeaf_t *leaf) {
 	if (!cm_noCurves->integer) {
 #endif
 		for (k = 0; k < leaf->numLeafSurfaces; k++) {
-			patch = cm.surfaces[cm.leafsurfaces[leaf->firstLeafSurface + k]];
+			surfnum = cm.leafsurfaces[leaf->firstLeafSurface + k];
+			patch = cm.surfaces[surfnum];
 			if (!patch) {
 				continue;
 			}
-			if (patch->checkcount == cm.checkcount) {
+			if (tw->thread->patchChecks[surfnum] == tw->thread->checkcount) {
 				continue; // already checked this patch in another leaf
 			}
-			patch->checkcount = cm.checkcount;
+			tw->thread->patchChecks[surfnum] = tw->thread->checkcount;
 
 			if (!(patch->contents & tw->contents)) {
 				continue;
@@ -994,6 +1169,16 @@ static void CM_TraceBoundingBoxThroughCapsule(traceWork_t *tw, clipHandle_t mode
 
 //=========================================================================================
 
+// the far sides CM_TraceThroughTree has left to visit, deeper trees
+// recurse for the rest
+#define MAX_TRACE_STACK 64
+
+typedef struct {
+	int num;
+	float p1f, p2f;
+	vec3_t p1, p2;
+} traceStack_t;
+
 /*
 ==================
 CM_TraceThroughTree
@@ -1004,105 +1189,142 @@ trace volumes it is possible to hit something in a later leaf with
 a smaller intercept fraction.
 ==================
 */
-static void CM_TraceThroughTree(traceWork_t *tw, int num, float p1f, float p2f, const vec3_t p1, const vec3_t p2) {
-	cNode_t *node;
-	cplane_t *plane;
+static void CM_TraceThroughTree(traceWork_t *tw, int num, float p1f, float p2f, const vec3_t start,
+								const vec3_t end) {
+	traceStack_t stack[MAX_TRACE_STACK];
+	traceStack_t *entry;
+	int depth;
+	const cTraceNode_t *node;
 	float t1, t2, offset;
 	float frac, frac2;
 	float idist;
-	vec3_t mid;
+	vec3_t p1, p2, mid;
 	int side;
 	float midf;
 
-	if (tw->trace.fraction <= p1f) {
-		return; // already hit something nearer
-	}
+	VectorCopy(start, p1);
+	VectorCopy(end, p2);
+	depth = 0;
 
-	// if < 0, we are in a leaf node
-	if (num < 0) {
-		CM_TraceThroughLeaf(tw, &cm.leafs[-1 - num]);
-		return;
-	}
+	for (;;) {
+		// if < 0, we are in a leaf node
+		if (num < 0 && tw->trace.fraction > p1f) {
+			CM_TraceThroughLeaf(tw, &cm.leafs[-1 - num]);
+		}
 
-	//
-	// find the point distances to the separating plane
-	// and the offset for the size of the box
-	//
-	node = cm.nodes + num;
-	plane = node->plane;
-
-	// adjust the plane distance appropriately for mins/maxs
-	if (plane->type < 3) {
-		t1 = p1[plane->type] - plane->dist;
-		t2 = p2[plane->type] - plane->dist;
-		offset = tw->extents[plane->type];
-	} else {
-		t1 = DotProduct(plane->normal, p1) - plane->dist;
-		t2 = DotProduct(plane->normal, p2) - plane->dist;
-		if (tw->isPoint) {
-			offset = 0;
+		if (num < 0 || tw->trace.fraction <= p1f) {
+			// done here, or already hit something nearer, so go on
+			// with the nearest far side that is left
+			if (!depth) {
+				return;
+			}
+			entry = &stack[--depth];
+			num = entry->num;
+			p1f = entry->p1f;
+			p2f = entry->p2f;
+			VectorCopy(entry->p1, p1);
+			VectorCopy(entry->p2, p2);
+			continue;
+		}
+
+		//
+		// find the point distances to the separating plane
+		// and the offset for the size of the box
+		//
+		node = &cm.traceNodes[num];
+
+		// adjust the plane distance appropriately for mins/maxs
+		if (node->type < 3) {
+			t1 = p1[node->type] - node->dist;
+			t2 = p2[node->type] - node->dist;
+			offset = tw->extents[node->type];
 		} else {
-			// this is silly
-			offset = 2048;
+			t1 = DotProduct(node->normal, p1) - node->dist;
+			t2 = DotProduct(node->normal, p2) - node->dist;
+			if (tw->isPoint) {
+				offset = 0;
+			} else {
+				// this is silly
+				offset = 2048;
+			}
 		}
-	}
 
-	// see which sides we need to consider
-	if (t1 >= offset + 1 && t2 >= offset + 1) {
-		CM_TraceThroughTree(tw, node->children[0], p1f, p2f, p1, p2);
-		return;
-	}
-	if (t1 < -offset - 1 && t2 < -offset - 1) {
-		CM_TraceThroughTree(tw, node->children[1], p1f, p2f, p1, p2);
-		return;
-	}
+		// see which sides we need to consider
+		if (t1 >= offset + 1 && t2 >= offset + 1) {
+			num = node->children[0];
+			continue;
+		}
+		if (t1 < -offset - 1 && t2 < -offset - 1) {
+			num = node->children[1];
+			continue;
+		}
 
-	// put the crosspoint SURFACE_CLIP_EPSILON pixels on the near side
-	if (t1 < t2) {
-		idist = 1.0 / (t1 - t2);
-		side = 1;
-		frac2 = (t1 + offset + SURFACE_CLIP_EPSILON) * idist;
-		frac = (t1 - offset + SURFACE_CLIP_EPSILON) * idist;
-	} else if (t1 > t2) {
-		idist = 1.0 / (t1 - t2);
-		side = 0;
-		frac2 = (t1 - offset - SURFACE_CLIP_EPSILON) * idist;
-		frac = (t1 + offset + SURFACE_CLIP_EPSILON) * idist;
-	} else {
-		side = 0;
-		frac = 1;
-		frac2 = 0;
-	}
+		// put the crosspoint SURFACE_CLIP_EPSILON pixels on the near side
+		if (t1 < t2) {
+			idist = 1.0 / (t1 - t2);
+			side = 1;
+			frac2 = (t1 + offset + SURFACE_CLIP_EPSILON) * idist;
+			frac = (t1 - offset + SURFACE_CLIP_EPSILON) * idist;
+		} else if (t1 > t2) {
+			idist = 1.0 / (t1 - t2);
+			side = 0;
+			frac2 = (t1 - offset - SURFACE_CLIP_EPSILON) * idist;
+			frac = (t1 + offset + SURFACE_CLIP_EPSILON) * idist;
+		} else {
+			side = 0;
+			frac = 1;
+			frac2 = 0;
+		}
 
-	// move up to the node
-	if (frac < 0) {
-		frac = 0;
-	} else if (frac > 1) {
-		frac = 1;
-	}
+		// the far side starts past the node
+		if (frac2 < 0) {
+			frac2 = 0;
+		} else if (frac2 > 1) {
+			frac2 = 1;
+		}
 
-	midf = p1f + (p2f - p1f) * frac;
+		if (depth == MAX_TRACE_STACK) {
+			entry = NULL;
+		} else {
+			entry = &stack[depth++];
+			entry->num = node->children[side ^ 1];
+			entry->p1f = p1f + (p2f - p1f) * frac2;
+			entry->p2f = p2f;
+			entry->p1[0] = p1[0] + frac2 * (p2[0] - p1[0]);
+			entry->p1[1] = p1[1] + frac2 * (p2[1] - p1[1]);
+			entry->p1[2] = p1[2] + frac2 * (p2[2] - p1[2]);
+			VectorCopy(p2, entry->p2);
+		}
 
-	mid[0] = p1[0] + frac * (p2[0] - p1[0]);
-	mid[1] = p1[1] + frac * (p2[1] - p1[1]);
-	mid[2] = p1[2] + frac * (p2[2] - p1[2]);
+		// move up to the node
+		if (frac < 0) {
+			frac = 0;
+		} else if (frac > 1) {
+			frac = 1;
+		}
 
-	CM_TraceThroughTree(tw, node->children[side], p1f, midf, p1, mid);
+		midf = p1f + (p2f - p1f) * frac;
 
-	// go past the node
-	if (frac2 < 0) {
-		frac2 = 0;
-	} else if (frac2 > 1) {
-		frac2 = 1;
-	}
+		mid[0] = p1[0] + frac * (p2[0] - p1[0]);
+		mid[1] = p1[1] + frac * (p2[1] - p1[1]);
+		mid[2] = p1[2] + frac * (p2[2] - p1[2]);
 
-	midf = p1f + (p2f - p1f) * frac2;
+		if (!entry) {
+			// out of stack, recurse for the near side
+			CM_TraceThroughTree(tw, node->children[side], p1f, midf, p1, mid);
 
-	mid[0] = p1[0] + frac2 * (p2[0] - p1[0]);
-	mid[1] = p1[1] + frac2 * (p2[1] - p1[1]);
-	mid[2] = p1[2] + frac2 * (p2[2] - p1[2]);
+			p1f = p1f + (p2f - p1f) * frac2;
+			p1[0] = p1[0] + frac2 * (p2[0] - p1[0]);
+			p1[1] = p1[1] + frac2 * (p2[1] - p1[1]);
+			p1[2] = p1[2] + frac2 * (p2[2] - p1[2]);
+			num = node->children[side ^ 1];
+			continue;
+		}
 
-	CM_TraceThroughTree(tw, node->children[side ^ 1], midf, p2f, mid, p2);
+		num = node->children[side];
+		p2f = midf;
+		VectorCopy(mid, p2);
+	}
 }
 
 //======================================================================
@@ -1121,12 +1343,12 @@ static void CM_Trace(trace_t *results, const vec3_t start, const vec3_t end, con
 
 	cmod = CM_ClipHandleToModel(model);
 
-	cm.checkcount++; // for multi-check avoidance
-
 	c_traces++; // for statistics, may be zeroed
 
 	// fill in a default trace
 	Com_Memset(&tw, 0, sizeof(tw));
+	tw.thread = CM_Thread();
+	tw.thread->checkcount++; // for multi-check avoidance
 	tw.trace.fraction = 1; // assume it goes the entire distance until shown otherwise
 	VectorCopy(origin, tw.modelOrigin);
 
@@ -1320,7 +1542,9 @@ CM_BoxTrace
 */
 void CM_BoxTrace(trace_t *results, const vec3_t start, const vec3_t end, const vec3_t mins, const vec3_t maxs,
 				 clipHandle_t model, int brushmask, qboolean capsule) {
+	PROFILE_BEGIN("CM_BoxTrace");
 	CM_Trace(results, start, end, mins, maxs, model, vec3_origin, brushmask, capsule, NULL);
+	PROFILE_END();
 }
 
 /*
@@ -322,6 +322,7 @@ static void Cmd_Echo_f(void) {
 
 typedef struct cmd_function_s {
 	struct cmd_function_s *next;
+	struct cmd_function_s *hashNext;
 	char *name;
 	xcommand_t function;
 	completionFunc_t complete;
@@ -334,6 +335,10 @@ static char cmd_cmd[BIG_INFO_STRING]; // the original command we received (no to
 
 static cmd_function_t *cmd_functions; // possible commands to execute
 
+// the same commands, including the ones forwarded to the VMs, by name
+#define CMD_HASH_SIZE 512
+static cmd_function_t *cmd_hashTable[CMD_HASH_SIZE];
+
 /*
 ============
 Cmd_Argc
@@ -592,6 +597,24 @@ void Cmd_TokenizeStringIgnoreQuotes(const char *text_in) {
 	Cmd_TokenizeString2(text_in, qtrue);
 }
 
+/*
+============
+Cmd_HashValue
+
+Case insensitive, like the command names
+============
+*/
+static unsigned Cmd_HashValue(const char *cmd_name) {
+	unsigned hash = 0;
+	int i;
+
+	for (i = 0; cmd_name[i]; i++) {
+		hash = hash * 31 + tolower((unsigned char)cmd_name[i]);
+	}
+
+	return hash & (CMD_HASH_SIZE - 1);
+}
+
 /*
 ============
 Cmd_FindCommand
@@ -599,7 +622,7 @@ Cmd_FindCommand
 */
 static cmd_function_t *Cmd_FindCommand(const char *cmd_name) {
 	cmd_function_t *cmd;
-	for (cmd = cmd_functions; cmd; cmd = cmd->next)
+	for (cmd = cmd_hashTable[Cmd_HashValue(cmd_name)]; cmd; cmd = cmd->hashNext)
 		if (!Q_stricmp(cmd_name, cmd->name))
 			return cmd;
 	return NULL;
@@ -612,6 +635,7 @@ Cmd_AddCommand
 */
 void Cmd_AddCommand(const char *cmd_name, xcommand_t function) {
 	cmd_function_t *cmd;
+	unsigned hash;
 
 	// fail if the command already exists
 	if (Cmd_FindCommand(cmd_name)) {
@@ -628,6 +652,10 @@ void Cmd_AddCommand(const char *cmd_name, xcommand_t function) {
 	cmd->complete = NULL;
 	cmd->next = cmd_functions;
 	cmd_functions = cmd;
+
+	hash = Cmd_HashValue(cmd_name);
+	cmd->hashNext = cmd_hashTable[hash];
+	cmd_hashTable[hash] = cmd;
 }
 
 /*
@@ -636,13 +664,10 @@ Cmd_SetCommandCompletionFunc
 ============
 */
 void Cmd_SetCommandCompletionFunc(const char *command, completionFunc_t complete) {
-	cmd_function_t *cmd;
+	cmd_function_t *cmd = Cmd_FindCommand(command);
 
-	for (cmd = cmd_functions; cmd; cmd = cmd->next) {
-		if (!Q_stricmp(command, cmd->name)) {
-			cmd->complete = complete;
-			return;
-		}
+	if (cmd) {
+		cmd->complete = complete;
 	}
 }
 
@@ -663,6 +688,9 @@ void Cmd_RemoveCommand(const char *cmd_name) {
 		}
 		if (!strcmp(cmd_name, cmd->name)) {
 			*back = cmd->next;
+			for (back = &cmd_hashTable[Cmd_HashValue(cmd_name)]; *back != cmd; back = &(*back)->hashNext)
+				;
+			*back = cmd->hashNext;
 			Z_Free(cmd->name);
 			Z_Free(cmd);
 			return;
@@ -713,15 +741,10 @@ Cmd_CompleteArgument
 ============
 */
 void Cmd_CompleteArgument(const char *command, const char *args, int argNum) {
-	cmd_function_t *cmd;
+	cmd_function_t *cmd = Cmd_FindCommand(command);
 
-	for (cmd = cmd_functions; cmd; cmd = cmd->next) {
-		if (!Q_stricmp(command, cmd->name)) {
-			if (cmd->complete) {
-				cmd->complete(args, argNum);
-			}
-			return;
-		}
+	if (cmd && cmd->complete) {
+		cmd->complete(args, argNum);
 	}
 }
 
@@ -733,7 +756,7 @@ A complete command line has been parsed, so try to execute it
 ============
 */
 void Cmd_ExecuteString(const char *text) {
-	cmd_function_t *cmd, **prev;
+	cmd_function_t *cmd;
 
 	// execute the command line
 	Cmd_TokenizeString(text);
@@ -741,25 +764,12 @@ void Cmd_ExecuteString(const char *text) {
 		return; // no tokens
 	}
 
-	// check registered command functions
-	for (prev = &cmd_functions; *prev; prev = &cmd->next) {
-		cmd = *prev;
-		if (!Q_stricmp(cmd_argv[0], cmd->name)) {
-			// rearrange the links so that the command will be
-			// near the head of the list next time it is used
-			*prev = cmd->next;
-			cmd->next = cmd_functions;
-			cmd_functions = cmd;
-
-			// perform the action
-			if (!cmd->function) {
-				// let the cgame or game handle it
-				break;
-			} else {
-				cmd->function();
-			}
-			return;
-		}
+	// check registered command functions, the ones without a function
+	// are left for the cgame or game to handle
+	cmd = Cmd_FindCommand(cmd_argv[0]);
+	if (cmd && cmd->function) {
+		cmd->function();
+		return;
 	}
 
 	// check cvars
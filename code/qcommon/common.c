@@ -83,6 +83,7 @@ cvar_t *com_ansiColor;
 cvar_t *com_unfocused;
 static cvar_t *com_maxfpsUnfocused;
 cvar_t *com_minimized;
+cvar_t *com_touchMemory;
 static cvar_t *com_maxfpsMinimized;
 static cvar_t *com_abnormalExit;
 cvar_t *com_gamename;
@@ -90,6 +91,9 @@ cvar_t *com_protocol;
 cvar_t *com_basegame;
 cvar_t *com_homepath;
 cvar_t *com_busyWait;
+static cvar_t *com_printThread;
+static cvar_t *com_lowLatency;
+static cvar_t *com_lowLatencyMargin;
 #ifndef DEDICATED
 cvar_t *con_autochat;
 #endif
@@ -146,6 +150,214 @@ void Com_EndRedirect(void) {
 	rd_flush = NULL;
 }
 
+/*
+=============================================================================
+
+PRINT THREAD
+
+With com_printThread on a dedicated server, Com_Printf only queues its
+text and a writer thread does the console and qconsole.log writes, so a
+burst of prints doesn't stall the frame on the tty.  Records never wrap
+around the end of the ring, so the writer can copy them out in order.
+=============================================================================
+*/
+
+#define PRINT_RING_SIZE (512 * 1024)
+#define PRINT_BATCH_SIZE (16 * 1024)
+
+#define PRINT_CONSOLE 1
+#define PRINT_LOGFILE 2
+
+typedef struct {
+	int length; // -1 skips to the start of the ring
+	int targets;
+} printRecord_t; // followed by the text, padded to sizeof(printRecord_t)
+
+typedef struct {
+	sysThread_t *thread;
+	sysMutex_t *mutex;		 // guards the ring
+	sysMutex_t *outputMutex; // held while the writer is at the console
+	sysCond_t *wake;		 // text was queued, or quit is set
+	sysCond_t *drained;		 // the writer made room in the ring
+
+	byte ring[PRINT_RING_SIZE];
+	int head, tail;
+	int used;
+	qboolean quit;
+} printQueue_t;
+
+static printQueue_t *printQueue;
+
+/*
+=============
+Com_PrintWriter
+=============
+*/
+static void Com_PrintWriter(void *data) {
+	static char batch[PRINT_BATCH_SIZE + 1];
+	printQueue_t *q = data;
+	printRecord_t *rec;
+	int length, size, targets;
+
+	Sys_LockMutex(q->mutex);
+	for (;;) {
+		while (!q->used && !q->quit) {
+			Sys_WaitCond(q->wake, q->mutex);
+		}
+		if (!q->used) {
+			break;
+		}
+
+		// coalesce the records that go to the same places
+		length = 0;
+		targets = 0;
+		while (q->used) {
+			rec = (printRecord_t *)(q->ring + q->tail);
+			if (rec->length < 0) {
+				q->used -= PRINT_RING_SIZE - q->tail;
+				q->tail = 0;
+				continue;
+			}
+			if ((targets && rec->targets != targets) || length + rec->length > PRINT_BATCH_SIZE) {
+				break;
+			}
+
+			Com_Memcpy(batch + length, rec + 1, rec->length);
+			length += rec->length;
+			targets = rec->targets;
+
+			size = sizeof(*rec) + PAD(rec->length, sizeof(*rec));
+			q->tail = (q->tail + size) % PRINT_RING_SIZE;
+			q->used -= size;
+		}
+		batch[length] = '\0';
+
+		Sys_BroadcastCond(q->drained);
+		Sys_UnlockMutex(q->mutex);
+
+		Sys_LockMutex(q->outputMutex);
+		if (targets & PRINT_CONSOLE) {
+			Sys_Print(batch);
+		}
+		if ((targets & PRINT_LOGFILE) && logfile) {
+			FS_Write(batch, length, logfile);
+		}
+		Sys_UnlockMutex(q->outputMutex);
+
+		Sys_LockMutex(q->mutex);
+	}
+	Sys_UnlockMutex(q->mutex);
+}
+
+/*
+=============
+Com_QueuePrint
+
+Blocks only while the ring is full, dropping text would lose the order
+=============
+*/
+static void Com_QueuePrint(const char *msg, int targets) {
+	printQueue_t *q = printQueue;
+	printRecord_t *rec;
+	int length, size, skip;
+
+	length = strlen(msg);
+	size = sizeof(*rec) + PAD(length, sizeof(*rec));
+
+	Sys_LockMutex(q->mutex);
+
+	skip = q->head + size > PRINT_RING_SIZE ? PRINT_RING_SIZE - q->head : 0;
+	while (PRINT_RING_SIZE - q->used < skip + size) {
+		Sys_WaitCond(q->drained, q->mutex);
+		skip = q->head + size > PRINT_RING_SIZE ? PRINT_RING_SIZE - q->head : 0;
+	}
+
+	if (skip) {
+		((printRecord_t *)(q->ring + q->head))->length = -1;
+		q->used += skip;
+		q->head = 0;
+	}
+
+	rec = (printRecord_t *)(q->ring + q->head);
+	rec->length = length;
+	rec->targets = targets;
+	Com_Memcpy(rec + 1, msg, length);
+
+	q->head = (q->head + size) % PRINT_RING_SIZE;
+	q->used += size;
+
+	Sys_SignalCond(q->wake);
+	Sys_UnlockMutex(q->mutex);
+}
+
+/*
+=============
+Com_StartPrintThread
+=============
+*/
+static void Com_StartPrintThread(void) {
+	printQueue_t *q;
+
+	q = calloc(1, sizeof(*q));
+	if (!q) {
+		return;
+	}
+
+	q->mutex = Sys_CreateMutex();
+	q->outputMutex = Sys_CreateMutex();
+	q->wake = Sys_CreateCond();
+	q->drained = Sys_CreateCond();
+	if (q->mutex && q->outputMutex && q->wake && q->drained) {
+		q->thread = Sys_CreateThread(Com_PrintWriter, q);
+	}
+
+	if (!q->thread) {
+		Com_Printf(S_COLOR_YELLOW "WARNING: failed to start the print thread\n");
+		if (q->mutex)
+			Sys_DestroyMutex(q->mutex);
+		if (q->outputMutex)
+			Sys_DestroyMutex(q->outputMutex);
+		if (q->wake)
+			Sys_DestroyCond(q->wake);
+		if (q->drained)
+			Sys_DestroyCond(q->drained);
+		free(q);
+		return;
+	}
+
+	printQueue = q;
+}
+
+/*
+=============
+Com_StopPrintThread
+
+Writes out the queue and goes back to printing directly
+=============
+*/
+void Com_StopPrintThread(void) {
+	printQueue_t *q = printQueue;
+
+	if (!q) {
+		return;
+	}
+
+	Sys_LockMutex(q->mutex);
+	q->quit = qtrue;
+	Sys_SignalCond(q->wake);
+	Sys_UnlockMutex(q->mutex);
+
+	// the writer drains the ring before it quits
+	Sys_JoinThread(q->thread);
+	printQueue = NULL;
+
+	Sys_DestroyMutex(q->mutex);
+	Sys_DestroyMutex(q->outputMutex);
+	Sys_DestroyCond(q->wake);
+	Sys_DestroyCond(q->drained);
+	free(q);
+}
+
 /*
 =============
 Com_Printf
@@ -160,6 +372,7 @@ void QDECL Com_Printf(const char *fmt, ...) {
 	va_list argptr;
 	char msg[MAXPRINTMSG];
 	static qboolean opening_qconsole = qfalse;
+	qboolean logged = qfalse;
 
 	va_start(argptr, fmt);
 	Q_vsnprintf(msg, sizeof(msg), fmt, argptr);
@@ -185,7 +398,12 @@ void QDECL Com_Printf(const char *fmt, ...) {
 #endif
 
 	// echo to dedicated console and early console
-	Sys_Print(msg);
+	if (printQueue) {
+		logged = com_logfile && com_logfile->integer && logfile && FS_Initialized();
+		Com_QueuePrint(msg, PRINT_CONSOLE | (logged ? PRINT_LOGFILE : 0));
+	} else {
+		Sys_Print(msg);
+	}
 
 	// logfile
 	if (com_logfile && com_logfile->integer) {
@@ -218,7 +436,12 @@ void QDECL Com_Printf(const char *fmt, ...) {
 			opening_qconsole = qfalse;
 		}
 		if (logfile && FS_Initialized()) {
-			FS_Write(msg, strlen(msg), logfile);
+			if (!printQueue) {
+				FS_Write(msg, strlen(msg), logfile);
+			} else if (!logged) {
+				// the logfile was only opened for this message
+				Com_QueuePrint(msg, PRINT_LOGFILE);
+			}
 		}
 	}
 }
@@ -265,6 +488,9 @@ void QDECL Com_Error(int code, const char *fmt, ...) {
 
 	com_errorEntered = qtrue;
 
+	// whatever was loading is abandoned
+	Com_SetMemOwner(MEMOWNER_ENGINE);
+
 	Cvar_Set("com_errorCode", va("%i", code));
 
 	// when we are running automated scripts, make sure we
@@ -736,10 +962,15 @@ The rover can be left pointing at a non-empty block
 
 The zone calls are pretty much only used for small strings and structures,
 all big things are allocated on the hunk.
+
+Small general and TAG_SMALL blocks are handed out from slabs of fixed
+size chunks instead, which cost O(1) and never fragment the zone.  The
+slab pages themselves are TAG_SLAB blocks of the main zone.
 ==============================================================================
 */
 
 #define ZONEID 0x1d4a11
+#define SLABID 0x5ab1d
 #define MINFRAGMENT 64
 
 typedef struct zonedebug_s {
@@ -753,7 +984,8 @@ typedef struct memblock_s {
 	int size; // including the header and possibly tiny fragments
 	int tag;  // a tag of 0 is a free block
 	struct memblock_s *next, *prev;
-	int id; // should be ZONEID
+	int id;	   // should be ZONEID
+	int owner; // memOwner_t the block is charged to
 #ifdef ZONE_DEBUG
 	zonedebug_t d;
 #endif
@@ -774,6 +1006,33 @@ static memzone_t *smallzone;
 
 static void Z_CheckHeap(void);
 
+#define SLAB_PAGE_SIZE (16 * 1024)
+#define SLAB_GRANULE 16
+#define SLAB_MAX_CHUNK 512
+#define SLAB_NUM_CLASSES 11
+
+typedef struct slabPage_s {
+	struct slabPage_s *next, *prev; // pages of the class with free chunks
+	memblock_t *freeChunks;			// linked through next
+	int numFree;
+	int slabClass;
+} slabPage_t;
+
+typedef struct {
+	int chunkSize; // including the block header and trash tester
+	int chunksPerPage;
+	slabPage_t *partial;
+	int numPages;
+	int used;
+	int peak;
+	int allocs;
+} slabClass_t;
+
+// chunk sizes are picked to keep the waste of common string lengths low
+static const int slabChunkSizes[SLAB_NUM_CLASSES] = {48, 64, 80, 96, 128, 160, 192, 256, 320, 384, SLAB_MAX_CHUNK};
+static slabClass_t slabClasses[SLAB_NUM_CLASSES];
+static byte slabClassForSize[SLAB_MAX_CHUNK / SLAB_GRANULE];
+
 /*
 ========================
 Z_ClearZone
@@ -816,6 +1075,218 @@ int Z_AvailableMemory(void) {
 	return Z_AvailableZoneMemory(mainzone);
 }
 
+/*
+==============================================================================
+
+MEMORY ACCOUNTING
+
+Zone and hunk memory is charged to the current owner, which the
+subsystems set while they load, so memstat can tell how much of
+com_hunkMegs and com_zoneMegs goes where.  Hunk accounts are reset
+along with the hunk.
+==============================================================================
+*/
+
+typedef struct {
+	int zone;
+	int hunk;
+	int other; // memory managed by the subsystem itself
+	int peak;
+} memAccount_t;
+
+static const char *const memOwnerNames[MEMOWNER_MAX] = {"engine", "cm",   "renderer", "botlib",
+														"sound",  "game", "cgame",	  "ui"};
+
+static memAccount_t memAccounts[MEMOWNER_MAX];
+static int memHunkMarked[MEMOWNER_MAX]; // hunk accounts at Hunk_SetMark
+static memOwner_t memOwner;
+
+static cvar_t *com_memstatInterval;
+
+/*
+========================
+Com_SetMemOwner
+========================
+*/
+memOwner_t Com_SetMemOwner(memOwner_t owner) {
+	memOwner_t previous = memOwner;
+
+	memOwner = owner;
+	return previous;
+}
+
+/*
+========================
+Com_MemCharge
+========================
+*/
+static void Com_MemCharge(memAccount_t *account) {
+	int total = account->zone + account->hunk + account->other;
+
+	if (total > account->peak)
+		account->peak = total;
+}
+
+/*
+========================
+Com_MemAccount
+========================
+*/
+void Com_MemAccount(memOwner_t owner, int bytes) {
+	memAccounts[owner].other += bytes;
+	Com_MemCharge(&memAccounts[owner]);
+}
+
+/*
+========================
+Com_MemOwnerBytes
+========================
+*/
+int Com_MemOwnerBytes(memOwner_t owner) {
+	const memAccount_t *account = &memAccounts[owner];
+
+	return account->zone + account->hunk + account->other;
+}
+
+/*
+========================
+Z_TagOwner
+========================
+*/
+static memOwner_t Z_TagOwner(int tag) {
+	if (tag == TAG_RENDERER)
+		return MEMOWNER_RENDERER;
+	if (tag == TAG_BOTLIB)
+		return MEMOWNER_BOTLIB;
+
+	return memOwner;
+}
+
+/*
+========================
+Z_InitSlabs
+========================
+*/
+static void Z_InitSlabs(void) {
+	slabClass_t *cls;
+	int i, c;
+
+	for (i = 0, c = 0; i < ARRAY_LEN(slabClassForSize); i++) {
+		while ((i + 1) * SLAB_GRANULE > slabChunkSizes[c])
+			c++;
+		slabClassForSize[i] = c;
+	}
+
+	for (c = 0, cls = slabClasses; c < SLAB_NUM_CLASSES; c++, cls++) {
+		cls->chunkSize = slabChunkSizes[c];
+		cls->chunksPerPage = (SLAB_PAGE_SIZE - PAD(sizeof(slabPage_t), SLAB_GRANULE)) / cls->chunkSize;
+		cls->partial = NULL;
+		cls->numPages = cls->used = cls->peak = cls->allocs = 0;
+	}
+}
+
+/*
+========================
+Z_SlabAlloc
+
+size has to include the block header and trash tester
+========================
+*/
+static memblock_t *Z_SlabAlloc(int size, int tag) {
+	slabClass_t *cls;
+	slabPage_t *page;
+	memblock_t *block;
+	byte *chunk;
+	int i;
+
+	cls = &slabClasses[slabClassForSize[(size - 1) / SLAB_GRANULE]];
+
+	page = cls->partial;
+	if (!page) {
+		page = Z_TagMalloc(SLAB_PAGE_SIZE, TAG_SLAB);
+		page->next = page->prev = NULL;
+		page->slabClass = cls - slabClasses;
+		page->numFree = cls->chunksPerPage;
+		page->freeChunks = NULL;
+
+		chunk = (byte *)page + PAD(sizeof(slabPage_t), SLAB_GRANULE) + (cls->chunksPerPage - 1) * cls->chunkSize;
+		for (i = 0; i < cls->chunksPerPage; i++, chunk -= cls->chunkSize) {
+			block = (memblock_t *)chunk;
+			block->tag = 0;
+			block->next = page->freeChunks;
+			page->freeChunks = block;
+		}
+
+		cls->partial = page;
+		cls->numPages++;
+	}
+
+	block = page->freeChunks;
+	page->freeChunks = block->next;
+	if (!--page->numFree) {
+		// full pages are only found again through their chunks
+		cls->partial = page->next;
+		if (page->next)
+			page->next->prev = NULL;
+		page->next = NULL;
+	}
+
+	block->size = cls->chunkSize;
+	block->tag = tag;
+	block->id = SLABID;
+	block->owner = Z_TagOwner(tag);
+	block->next = NULL;
+	block->prev = (memblock_t *)page;
+
+	memAccounts[block->owner].zone += block->size;
+	Com_MemCharge(&memAccounts[block->owner]);
+
+	// marker for memory trash testing
+	*(int *)((byte *)block + block->size - 4) = ZONEID;
+
+	if (++cls->used > cls->peak)
+		cls->peak = cls->used;
+	cls->allocs++;
+
+	return block;
+}
+
+/*
+========================
+Z_SlabFree
+========================
+*/
+static void Z_SlabFree(memblock_t *block) {
+	slabPage_t *page = (slabPage_t *)block->prev;
+	slabClass_t *cls = &slabClasses[page->slabClass];
+
+	block->tag = 0;
+	block->next = page->freeChunks;
+	page->freeChunks = block;
+	cls->used--;
+
+	if (page->numFree++ == 0) {
+		page->prev = NULL;
+		page->next = cls->partial;
+		if (cls->partial)
+			cls->partial->prev = page;
+		cls->partial = page;
+	}
+
+	// give completely empty pages back, but keep one around
+	if (page->numFree == cls->chunksPerPage && cls->numPages > 1) {
+		if (page->prev)
+			page->prev->next = page->next;
+		else
+			cls->partial = page->next;
+		if (page->next)
+			page->next->prev = page->prev;
+
+		cls->numPages--;
+		Z_Free(page);
+	}
+}
+
 /*
 ========================
 Z_Free
@@ -830,7 +1301,7 @@ void Z_Free(void *ptr) {
 	}
 
 	block = (memblock_t *)((byte *)ptr - sizeof(memblock_t));
-	if (block->id != ZONEID) {
+	if (block->id != ZONEID && block->id != SLABID) {
 		Com_Error(ERR_FATAL, "Z_Free: freed a pointer without ZONEID");
 	}
 	if (block->tag == 0) {
@@ -846,6 +1317,15 @@ void Z_Free(void *ptr) {
 		Com_Error(ERR_FATAL, "Z_Free: memory block wrote past end");
 	}
 
+	if (block->tag != TAG_SLAB)
+		memAccounts[block->owner].zone -= block->size;
+
+	if (block->id == SLABID) {
+		Com_Memset(ptr, 0xaa, block->size - sizeof(*block));
+		Z_SlabFree(block);
+		return;
+	}
+
 	if (block->tag == TAG_SMALL) {
 		zone = smallzone;
 	} else {
@@ -943,6 +1423,18 @@ void *Z_TagMalloc(int size, int tag) {
 	size += 4;							// space for memory trash tester
 	size = PAD(size, sizeof(intptr_t)); // align to 32/64 bit boundary
 
+	// slab pages come from the main zone, so it has to be up already
+	if (size <= SLAB_MAX_CHUNK && (tag == TAG_GENERAL || tag == TAG_SMALL) && mainzone) {
+		base = Z_SlabAlloc(size, tag);
+#ifdef ZONE_DEBUG
+		base->d.label = label;
+		base->d.file = file;
+		base->d.line = line;
+		base->d.allocSize = allocSize;
+#endif
+		return (void *)((byte *)base + sizeof(memblock_t));
+	}
+
 	base = rover = zone->rover;
 	start = base->prev;
 
@@ -991,6 +1483,15 @@ void *Z_TagMalloc(int size, int tag) {
 
 	base->id = ZONEID;
 
+	// slab pages are charged chunk by chunk
+	if (tag != TAG_SLAB) {
+		base->owner = Z_TagOwner(tag);
+		memAccounts[base->owner].zone += base->size;
+		Com_MemCharge(&memAccounts[base->owner]);
+	} else {
+		base->owner = MEMOWNER_ENGINE;
+	}
+
 #ifdef ZONE_DEBUG
 	base->d.label = label;
 	base->d.file = file;
@@ -1134,9 +1635,9 @@ typedef struct memstatic_s {
 } memstatic_t;
 
 #ifdef ZONE_DEBUG
-#define ZONE_DEBUG_INIT(size) {(size), TAG_STATIC, NULL, NULL, ZONEID, {NULL, NULL, 0, 0}}
+#define ZONE_DEBUG_INIT(size) {(size), TAG_STATIC, NULL, NULL, ZONEID, MEMOWNER_ENGINE, {NULL, NULL, 0, 0}}
 #else
-#define ZONE_DEBUG_INIT(size) {(size), TAG_STATIC, NULL, NULL, ZONEID}
+#define ZONE_DEBUG_INIT(size) {(size), TAG_STATIC, NULL, NULL, ZONEID, MEMOWNER_ENGINE}
 #endif
 
 static memstatic_t emptystring = {ZONE_DEBUG_INIT((sizeof(memblock_t) + 2 + 3) & ~3), {'\0', '\0'}};
@@ -1240,6 +1741,12 @@ static hunkUsed_t *hunk_permanent, *hunk_temp;
 static byte *s_hunkData = NULL;
 static int s_hunkTotal;
 
+// the hunk is only reserved up front, each end is committed as it grows
+#define HUNK_COMMIT_GRANULE (1024 * 1024)
+
+static int s_hunkCommittedLow, s_hunkCommittedHigh;
+static int s_hunkPeak; // most of the hunk used since the last Hunk_Clear
+
 static int s_zoneTotal;
 static int s_smallZoneTotal;
 
@@ -1252,12 +1759,15 @@ void Com_Meminfo_f(void) {
 	memblock_t *block;
 	int zoneBytes, zoneBlocks;
 	int smallZoneBytes;
-	int botlibBytes, rendererBytes;
+	int botlibBytes, rendererBytes, slabBytes;
 	int unused;
+	slabClass_t *cls;
+	int i;
 
 	zoneBytes = 0;
 	botlibBytes = 0;
 	rendererBytes = 0;
+	slabBytes = 0;
 	zoneBlocks = 0;
 	for (block = mainzone->blocklist.next;; block = block->next) {
 		if (Cmd_Argc() != 1) {
@@ -1270,6 +1780,8 @@ void Com_Meminfo_f(void) {
 				botlibBytes += block->size;
 			} else if (block->tag == TAG_RENDERER) {
 				rendererBytes += block->size;
+			} else if (block->tag == TAG_SLAB) {
+				slabBytes += block->size;
 			}
 		}
 
@@ -1316,6 +1828,8 @@ void Com_Meminfo_f(void) {
 	Com_Printf("%8i high tempHighwater\n", hunk_high.tempHighwater);
 	Com_Printf("\n");
 	Com_Printf("%8i total hunk in use\n", hunk_low.permanent + hunk_high.permanent);
+	Com_Printf("%8i hunk peak since the last clear\n", s_hunkPeak);
+	Com_Printf("%8i hunk committed\n", MIN(s_hunkCommittedLow + s_hunkCommittedHigh, s_hunkTotal));
 	unused = 0;
 	if (hunk_low.tempHighwater > hunk_low.permanent) {
 		unused += hunk_low.tempHighwater - hunk_low.permanent;
@@ -1328,8 +1842,78 @@ void Com_Meminfo_f(void) {
 	Com_Printf("%8i bytes in %i zone blocks\n", zoneBytes, zoneBlocks);
 	Com_Printf("        %8i bytes in dynamic botlib\n", botlibBytes);
 	Com_Printf("        %8i bytes in dynamic renderer\n", rendererBytes);
-	Com_Printf("        %8i bytes in dynamic other\n", zoneBytes - (botlibBytes + rendererBytes));
+	Com_Printf("        %8i bytes in small block slabs\n", slabBytes);
+	Com_Printf("        %8i bytes in dynamic other\n", zoneBytes - (botlibBytes + rendererBytes + slabBytes));
 	Com_Printf("        %8i bytes in small Zone memory\n", smallZoneBytes);
+	Com_Printf("\n");
+	Com_Printf("slab  pages   used chunks   peak    allocs\n");
+	for (i = 0, cls = slabClasses; i < SLAB_NUM_CLASSES; i++, cls++) {
+		Com_Printf("%4i  %5i  %6i/%-6i %6i  %8i\n", cls->chunkSize, cls->numPages, cls->used,
+				   cls->numPages * cls->chunksPerPage, cls->peak, cls->allocs);
+	}
+}
+
+/*
+=================
+Com_MemStat_f
+
+Per subsystem memory usage, "memstat reset" restarts the peaks
+=================
+*/
+static void Com_MemStat_f(void) {
+	memAccount_t *account;
+	int zone, hunk, other;
+	int i;
+
+	if (!Q_stricmp(Cmd_Argv(1), "reset")) {
+		for (i = 0, account = memAccounts; i < MEMOWNER_MAX; i++, account++)
+			account->peak = account->zone + account->hunk + account->other;
+		return;
+	}
+
+	zone = hunk = other = 0;
+	Com_Printf("owner          zone       hunk      other       peak\n");
+	for (i = 0, account = memAccounts; i < MEMOWNER_MAX; i++, account++) {
+		Com_Printf("%-8s %10i %10i %10i %10i\n", memOwnerNames[i], account->zone, account->hunk, account->other,
+				   account->peak);
+		zone += account->zone;
+		hunk += account->hunk;
+		other += account->other;
+	}
+	Com_Printf("total    %10i %10i %10i\n", zone, hunk, other);
+	Com_Printf("\n");
+	Com_Printf("%8i of %8i bytes of hunk in use\n", s_hunkTotal - Hunk_MemoryRemaining(), s_hunkTotal);
+	Com_Printf("%8i of %8i bytes of zone in use\n", mainzone->used, mainzone->size);
+	Com_Printf("%8i of %8i bytes of small zone in use\n", smallzone->used, smallzone->size);
+}
+
+/*
+=================
+Com_MemStatLog
+
+One line summary every com_memstatInterval seconds
+=================
+*/
+static void Com_MemStatLog(void) {
+	static int lastLog;
+	char line[MAX_STRING_CHARS];
+	memAccount_t *account;
+	int i, now;
+
+	if (com_memstatInterval->integer <= 0)
+		return;
+
+	now = Sys_Milliseconds();
+	if (lastLog && now - lastLog < com_memstatInterval->integer * 1000)
+		return;
+	lastLog = now;
+
+	line[0] = '\0';
+	for (i = 0, account = memAccounts; i < MEMOWNER_MAX; i++, account++) {
+		Q_strcat(line, sizeof(line),
+				 va(" %s %iK", memOwnerNames[i], (account->zone + account->hunk + account->other) / 1024));
+	}
+	Com_Printf("memstat:%s\n", line);
 }
 
 /*
@@ -1416,6 +2000,7 @@ void Com_InitZoneMemory(void) {
 		Com_Error(ERR_FATAL, "Zone data failed to allocate %i megs", s_zoneTotal / (1024 * 1024));
 	}
 	Z_ClearZone(mainzone, s_zoneTotal);
+	Z_InitSlabs();
 }
 
 /*
@@ -1536,15 +2121,15 @@ static void Com_InitHunkMemory(void) {
 		s_hunkTotal = cv->integer * 1024 * 1024;
 	}
 
-	s_hunkData = calloc(s_hunkTotal + 31, 1);
+	// page aligned, so cacheline aligned as well
+	s_hunkData = Sys_ReserveMemory(s_hunkTotal);
 	if (!s_hunkData) {
 		Com_Error(ERR_FATAL, "Hunk data failed to allocate %i megs", s_hunkTotal / (1024 * 1024));
 	}
-	// cacheline align
-	s_hunkData = (byte *)(((intptr_t)s_hunkData + 31) & ~31);
 	Hunk_Clear();
 
 	Cmd_AddCommand("meminfo", Com_Meminfo_f);
+	Cmd_AddCommand("memstat", Com_MemStat_f);
 #ifdef ZONE_DEBUG
 	Cmd_AddCommand("zonelog", Z_LogHeap);
 #endif
@@ -1576,8 +2161,13 @@ The server calls this after the level and game VM have been loaded
 ===================
 */
 void Hunk_SetMark(void) {
+	int i;
+
 	hunk_low.mark = hunk_low.permanent;
 	hunk_high.mark = hunk_high.permanent;
+
+	for (i = 0; i < MEMOWNER_MAX; i++)
+		memHunkMarked[i] = memAccounts[i].hunk;
 }
 
 /*
@@ -1588,8 +2178,13 @@ The client calls this before starting a vid_restart or snd_restart
 =================
 */
 void Hunk_ClearToMark(void) {
+	int i;
+
 	hunk_low.permanent = hunk_low.temp = hunk_low.mark;
 	hunk_high.permanent = hunk_high.temp = hunk_high.mark;
+
+	for (i = 0; i < MEMOWNER_MAX; i++)
+		memAccounts[i].hunk = memHunkMarked[i];
 }
 
 /*
@@ -1616,6 +2211,8 @@ The server calls this before shutting down or loading a new map
 =================
 */
 void Hunk_Clear(void) {
+	int i;
+
 #ifndef DEDICATED
 	CL_ShutdownCGame();
 	CL_ShutdownUI();
@@ -1637,6 +2234,21 @@ void Hunk_Clear(void) {
 	hunk_permanent = &hunk_low;
 	hunk_temp = &hunk_high;
 
+	for (i = 0; i < MEMOWNER_MAX; i++)
+		memAccounts[i].hunk = memHunkMarked[i] = 0;
+
+	if (s_hunkPeak) {
+		Com_Printf("Hunk_Clear: %i of %i megs of hunk were used at most\n", s_hunkPeak / (1024 * 1024) + 1,
+				   s_hunkTotal / (1024 * 1024));
+		s_hunkPeak = 0;
+	}
+
+	// hand the pages back, the next map may need far less
+	if (s_hunkCommittedLow || s_hunkCommittedHigh) {
+		Sys_DecommitMemory(s_hunkData, s_hunkTotal);
+		s_hunkCommittedLow = s_hunkCommittedHigh = 0;
+	}
+
 	Com_Printf("Hunk_Clear: reset the hunk ok\n");
 	VM_Clear();
 #ifdef HUNK_DEBUG
@@ -1644,6 +2256,37 @@ void Hunk_Clear(void) {
 #endif
 }
 
+/*
+=================
+Hunk_Commit
+
+Backs both ends of the hunk up to their current extent
+=================
+*/
+static void Hunk_Commit(void) {
+	int low, high;
+
+	if (hunk_low.temp + hunk_high.temp > s_hunkPeak) {
+		s_hunkPeak = hunk_low.temp + hunk_high.temp;
+	}
+
+	if (hunk_low.temp > s_hunkCommittedLow) {
+		low = MIN(PAD(hunk_low.temp, HUNK_COMMIT_GRANULE), s_hunkTotal);
+		if (!Sys_CommitMemory(s_hunkData + s_hunkCommittedLow, low - s_hunkCommittedLow)) {
+			Com_Error(ERR_FATAL, "Hunk_Commit: failed to commit %i bytes", low - s_hunkCommittedLow);
+		}
+		s_hunkCommittedLow = low;
+	}
+
+	if (hunk_high.temp > s_hunkCommittedHigh) {
+		high = MIN(PAD(hunk_high.temp, HUNK_COMMIT_GRANULE), s_hunkTotal);
+		if (!Sys_CommitMemory(s_hunkData + s_hunkTotal - high, high - s_hunkCommittedHigh)) {
+			Com_Error(ERR_FATAL, "Hunk_Commit: failed to commit %i bytes", high - s_hunkCommittedHigh);
+		}
+		s_hunkCommittedHigh = high;
+	}
+}
+
 static void Hunk_SwapBanks(void) {
 	hunkUsed_t *swap;
 
@@ -1717,6 +2360,10 @@ void *Hunk_Alloc(int size, ha_pref preference) {
 	}
 
 	hunk_permanent->temp = hunk_permanent->permanent;
+	Hunk_Commit();
+
+	memAccounts[memOwner].hunk += size;
+	Com_MemCharge(&memAccounts[memOwner]);
 
 	Com_Memset(buf, 0, size);
 
@@ -1777,6 +2424,7 @@ void *Hunk_AllocateTempMemory(int size) {
 	if (hunk_temp->temp > hunk_temp->tempHighwater) {
 		hunk_temp->tempHighwater = hunk_temp->temp;
 	}
+	Hunk_Commit();
 
 	hdr = (hunkHeader_t *)buf;
 	buf = (void *)(hdr + 1);
@@ -1847,6 +2495,104 @@ void Hunk_ClearTempMemory(void) {
 /*
 ===================================================================
 
+SCRATCH ARENAS
+
+Every thread gets a bump allocated arena for transient data.  Once an
+arena runs out the allocations spill into malloc'ed blocks, which are
+folded into a larger arena on the next reset, so the arenas settle at
+what the hot paths actually use.
+===================================================================
+*/
+
+#define SCRATCH_ALIGN 16
+#define SCRATCH_MIN_SIZE (256 * 1024)
+#define SCRATCH_GRANULE (64 * 1024)
+
+typedef struct scratchBlock_s {
+	struct scratchBlock_s *next;
+} scratchBlock_t; // followed by the data at SCRATCH_ALIGN
+
+typedef struct {
+	byte *base;
+	int size;
+	int used;
+	scratchBlock_t *overflow;
+	int overflowBytes;
+} scratchArena_t;
+
+static scratchArena_t scratchArenas[MAX_JOB_THREADS + 1];
+
+/*
+=================
+Com_ScratchAlloc
+=================
+*/
+void *Com_ScratchAlloc(int size) {
+	scratchArena_t *arena = &scratchArenas[Com_JobThreadIndex()];
+	scratchBlock_t *block;
+	void *buf;
+
+	if (size < 0) {
+		Com_Error(ERR_FATAL, "Com_ScratchAlloc: bad size %i", size);
+	}
+
+	size = PAD(size, SCRATCH_ALIGN);
+
+	if (arena->used + size <= arena->size) {
+		buf = arena->base + arena->used;
+		arena->used += size;
+		return buf;
+	}
+
+	block = malloc(SCRATCH_ALIGN + size);
+	if (!block) {
+		Com_Error(ERR_FATAL, "Com_ScratchAlloc: failed on %i", size);
+	}
+	block->next = arena->overflow;
+	arena->overflow = block;
+	arena->overflowBytes += size;
+
+	return (byte *)block + SCRATCH_ALIGN;
+}
+
+/*
+=================
+Com_ScratchReset
+
+Releases everything the calling thread allocated with Com_ScratchAlloc
+=================
+*/
+void Com_ScratchReset(void) {
+	scratchArena_t *arena = &scratchArenas[Com_JobThreadIndex()];
+	scratchBlock_t *block;
+	int needed;
+
+	if (!arena->overflow) {
+		arena->used = 0;
+		return;
+	}
+
+	needed = arena->used + arena->overflowBytes;
+
+	while ((block = arena->overflow) != NULL) {
+		arena->overflow = block->next;
+		free(block);
+	}
+	arena->overflowBytes = 0;
+	arena->used = 0;
+
+	free(arena->base);
+	arena->size = PAD(MAX(needed, SCRATCH_MIN_SIZE), SCRATCH_GRANULE);
+	arena->base = malloc(arena->size);
+	if (!arena->base) {
+		arena->size = 0;
+		Com_Error(ERR_FATAL, "Com_ScratchReset: failed to grow the arena to %i", needed);
+	}
+}
+
+/*
+===================================================================
+
 EVENTS AND JOURNALING
 
 In addition to these events, .cfg files are also copied to the
@@ -1897,59 +2643,125 @@ EVENT LOOP
 ========================================================================
 */
 
-#define MAX_QUEUED_EVENTS 256
+#define MAX_QUEUED_EVENTS 1024
 #define MASK_QUEUED_EVENTS (MAX_QUEUED_EVENTS - 1)
 
 static sysEvent_t eventQueue[MAX_QUEUED_EVENTS];
 static int eventHead = 0;
 static int eventTail = 0;
 
+// producers may run on other threads, the queue is guarded by eventMutex
+// once Com_Init has created it
+static sysMutex_t *eventMutex;
+static int eventsDropped;
+
 /*
 ================
 Com_QueueEvent
 
 A time of 0 will get the current time
 Ptr should either be null, or point to a block of data that can
-be freed by the game later.
+be freed by the game later.  Events with a ptr must be queued from
+the main thread, any thread may queue the others.
 ================
 */
 void Com_QueueEvent(int time, sysEventType_t type, int value, int value2, int ptrLength, void *ptr) {
 	sysEvent_t *ev;
+	int i;
 
-	// combine mouse movement with previous mouse event
-	if (type == SE_MOUSE && eventHead != eventTail) {
-		ev = &eventQueue[(eventHead + MAX_QUEUED_EVENTS - 1) & MASK_QUEUED_EVENTS];
+	if (time == 0) {
+		time = Sys_Milliseconds();
+	}
 
-		if (ev->evType == SE_MOUSE) {
-			ev->evValue += value;
-			ev->evValue2 += value2;
-			return;
-		}
+	if (eventMutex) {
+		Sys_LockMutex(eventMutex);
 	}
 
-	ev = &eventQueue[eventHead & MASK_QUEUED_EVENTS];
+	// combine mouse movement with the newest pending mouse event, and replace
+	// the pending position of the same joystick axis, as long as only motion
+	// events are queued behind it so the order relative to buttons is kept
+	if (type == SE_MOUSE || type == SE_JOYSTICK_AXIS) {
+		for (i = eventHead - 1; i >= eventTail; i--) {
+			ev = &eventQueue[i & MASK_QUEUED_EVENTS];
 
-	if (eventHead - eventTail >= MAX_QUEUED_EVENTS) {
-		Com_Printf("Com_QueueEvent: overflow\n");
-		// we are discarding an event, but don't leak memory
-		if (ev->evPtr) {
-			Z_Free(ev->evPtr);
+			if (ev->evType != SE_MOUSE && ev->evType != SE_JOYSTICK_AXIS) {
+				break;
+			}
+			if (ev->evType != type) {
+				continue;
+			}
+			if (type == SE_MOUSE) {
+				ev->evValue += value;
+				ev->evValue2 += value2;
+			} else if (ev->evValue == value) {
+				ev->evValue2 = value2;
+			} else {
+				continue;
+			}
+			if (eventMutex) {
+				Sys_UnlockMutex(eventMutex);
+			}
+			return;
 		}
-		eventTail++;
 	}
 
-	eventHead++;
-
-	if (time == 0) {
-		time = Sys_Milliseconds();
+	if (eventHead - eventTail >= MAX_QUEUED_EVENTS) {
+		// drop the new event, the queued ones may be key releases; only the
+		// main thread passes a ptr so freeing it here is safe
+		eventsDropped++;
+		if (eventMutex) {
+			Sys_UnlockMutex(eventMutex);
+		}
+		if (ptr) {
+			Z_Free(ptr);
+		}
+		return;
 	}
 
+	ev = &eventQueue[eventHead & MASK_QUEUED_EVENTS];
 	ev->evTime = time;
 	ev->evType = type;
 	ev->evValue = value;
 	ev->evValue2 = value2;
 	ev->evPtrLength = ptrLength;
 	ev->evPtr = ptr;
+
+	eventHead++;
+
+	if (eventMutex) {
+		Sys_UnlockMutex(eventMutex);
+	}
+}
+
+/*
+================
+Com_PopEvent
+
+Removes the oldest queued event, returns qfalse if there is none
+================
+*/
+static qboolean Com_PopEvent(sysEvent_t *ev) {
+	qboolean popped = qfalse;
+	int dropped;
+
+	if (eventMutex) {
+		Sys_LockMutex(eventMutex);
+	}
+	if (eventHead > eventTail) {
+		*ev = eventQueue[eventTail & MASK_QUEUED_EVENTS];
+		eventTail++;
+		popped = qtrue;
+	}
+	dropped = eventsDropped;
+	eventsDropped = 0;
+	if (eventMutex) {
+		Sys_UnlockMutex(eventMutex);
+	}
+
+	if (dropped) {
+		Com_Printf("Com_QueueEvent: overflow, %i events dropped\n", dropped);
+	}
+	return popped;
 }
 
 /*
@@ -1962,13 +2774,18 @@ static sysEvent_t Com_GetSystemEvent(void) {
 	const char *s;
 
 	// return if we have data
-	if (eventHead > eventTail) {
-		eventTail++;
-		return eventQueue[(eventTail - 1) & MASK_QUEUED_EVENTS];
+	if (Com_PopEvent(&ev)) {
+		return ev;
 	}
 
-	// check for console commands
-	s = Sys_ConsoleInput();
+	// check for console commands, the print thread must not redraw the prompt meanwhile
+	if (printQueue) {
+		Sys_LockMutex(printQueue->outputMutex);
+		s = Sys_ConsoleInput();
+		Sys_UnlockMutex(printQueue->outputMutex);
+	} else {
+		s = Sys_ConsoleInput();
+	}
 	if (s) {
 		char *b;
 		int len;
@@ -1980,9 +2797,8 @@ static sysEvent_t Com_GetSystemEvent(void) {
 	}
 
 	// return if we have data
-	if (eventHead > eventTail) {
-		eventTail++;
-		return eventQueue[(eventTail - 1) & MASK_QUEUED_EVENTS];
+	if (Com_PopEvent(&ev)) {
+		return ev;
 	}
 
 	// create an empty event to return
@@ -2104,6 +2920,8 @@ void Com_RunAndTimeServerPacket(const netadr_t *evFrom, msg_t *buf) {
 
 	t1 = 0;
 
+	Com_HitchEvent(HITCH_PACKET, buf->cursize, 0, evFrom);
+
 	if (com_speeds->integer) {
 		t1 = Sys_Milliseconds();
 	}
@@ -2155,6 +2973,8 @@ int Com_EventLoop(void) {
 			return ev.evTime;
 		}
 
+		Com_HitchEvent(ev.evType, ev.evValue, ev.evValue2, NULL);
+
 		switch (ev.evType) {
 #ifndef DEDICATED
 		case SE_KEY:
@@ -2448,6 +3268,71 @@ static void Com_InitRand(void) {
 		srand(time(NULL));
 }
 
+/*
+=================
+Com_InitAffinity
+
+Keeps the process on the CPUs listed in com_cpuSet, as CPU numbers and
+ranges like "2-3,6".  Done before any thread is created, so they all
+inherit it.  Several servers on one host can be given disjoint sets so
+their frames and job workers don't compete for the same cores.
+=================
+*/
+static void Com_InitAffinity(void) {
+	static int cpus[MAX_AFFINITY_CPUS];
+	cvar_t *cv;
+	const char *p;
+	int numCpus;
+	int first, last;
+
+	cv = Cvar_Get("com_cpuSet", "", CVAR_INIT);
+	Cvar_SetDescription(cv, "CPUs to run the process on, like \"2-3,6\", empty for all of them");
+
+	if (!cv->string[0]) {
+		return;
+	}
+
+	numCpus = 0;
+	p = cv->string;
+	while (*p) {
+		if (*p < '0' || *p > '9') {
+			break;
+		}
+		first = last = atoi(p);
+		while (*p >= '0' && *p <= '9') {
+			p++;
+		}
+		if (*p == '-') {
+			p++;
+			if (*p < '0' || *p > '9') {
+				break;
+			}
+			last = atoi(p);
+			while (*p >= '0' && *p <= '9') {
+				p++;
+			}
+		}
+		if (first > last || last >= MAX_AFFINITY_CPUS) {
+			break;
+		}
+		for (; first <= last && numCpus < MAX_AFFINITY_CPUS; first++) {
+			cpus[numCpus++] = first;
+		}
+		if (*p == ',') {
+			p++;
+		}
+	}
+
+	if (*p || !numCpus) {
+		Com_Printf(S_COLOR_YELLOW "WARNING: bad com_cpuSet \"%s\"\n", cv->string);
+		return;
+	}
+
+	if (!Sys_SetAffinity(cpus, numCpus)) {
+		Com_Printf(S_COLOR_YELLOW "WARNING: couldn't set the CPU affinity to \"%s\"\n", cv->string);
+	}
+}
+
 /*
 =================
 Com_Init
@@ -2465,6 +3350,9 @@ void Com_Init(char *commandLine) {
 
 	// Clear queues
 	Com_Memset(&eventQueue[0], 0, MAX_QUEUED_EVENTS * sizeof(sysEvent_t));
+	if (!eventMutex) {
+		eventMutex = Sys_CreateMutex();
+	}
 
 	// initialize the weak pseudo-random number generator for use later.
 	Com_InitRand();
@@ -2490,6 +3378,8 @@ void Com_Init(char *commandLine) {
 	Com_InitZoneMemory();
 	Cmd_Init();
 
+	Com_InitAffinity();
+
 	// get the developer cvar set as early as possible
 	com_developer = Cvar_Get("developer", "0", CVAR_TEMP);
 
@@ -2515,6 +3405,8 @@ void Com_Init(char *commandLine) {
 	Cmd_AddCommand("writeconfig", Com_WriteConfig_f);
 	Cmd_SetCommandCompletionFunc("writeconfig", Cmd_CompleteCfgName);
 	Cmd_AddCommand("game_restart", Com_GameRestart_f);
+	Com_InitProfile();
+	Com_InitHitch();
 
 	Com_ExecuteCfg();
 
@@ -2563,9 +3455,23 @@ void Com_Init(char *commandLine) {
 	com_unfocused = Cvar_Get("com_unfocused", "0", CVAR_ROM);
 	com_maxfpsUnfocused = Cvar_Get("com_maxfpsUnfocused", "0", CVAR_ARCHIVE);
 	com_minimized = Cvar_Get("com_minimized", "0", CVAR_ROM);
+	com_touchMemory = Cvar_Get("com_touchMemory", "1", CVAR_ARCHIVE);
+	Cvar_SetDescription(com_touchMemory, "Page in all of the hunk and zone after loading a map");
 	com_maxfpsMinimized = Cvar_Get("com_maxfpsMinimized", "0", CVAR_ARCHIVE);
 	com_abnormalExit = Cvar_Get("com_abnormalExit", "0", CVAR_ROM);
 	com_busyWait = Cvar_Get("com_busyWait", "0", CVAR_ARCHIVE);
+	com_lowLatency = Cvar_Get("com_lowLatency", "0", CVAR_ARCHIVE);
+	Cvar_SetDescription(com_lowLatency, "Start frames late within com_maxfps, so input is sampled as late as the frame "
+										"cost allows");
+	com_lowLatencyMargin = Cvar_Get("com_lowLatencyMargin", "1", CVAR_ARCHIVE);
+	Cvar_SetDescription(com_lowLatencyMargin, "Milliseconds com_lowLatency leaves for frames slower than usual");
+
+	com_printThread = Cvar_Get("com_printThread", "0", CVAR_INIT);
+	Cvar_SetDescription(com_printThread, "Write the console and qconsole.log of a dedicated server from a thread");
+	if (com_dedicated->integer && com_printThread->integer) {
+		Com_StartPrintThread();
+	}
+	com_memstatInterval = Cvar_Get("com_memstatInterval", "0", 0);
 	Cvar_Get("com_errorMessage", "", CVAR_ROM | CVAR_NORESTART);
 
 #ifdef CINEMATICS_INTRO
@@ -2806,31 +3712,98 @@ static int Com_ModifyMsec(int msec) {
 
 /*
 =================
-Com_TimeVal
+Com_TimeValUsec
+
+Microseconds left until the frame due at deadline
 =================
 */
-static int Com_TimeVal(int minMsec) {
-	int timeVal;
+static int Com_TimeValUsec(int64_t deadline) {
+	int64_t timeVal;
 
-	timeVal = Sys_Milliseconds() - com_frameTime;
+	timeVal = deadline - Sys_Microseconds();
 
-	if (timeVal >= minMsec)
-		timeVal = 0;
-	else
-		timeVal = minMsec - timeVal;
+	if (timeVal <= 0)
+		return 0;
+	if (timeVal > 1000000)
+		return 1000000;
 
 	return timeVal;
 }
 
+/*
+=================
+Com_NextFrameUsec
+
+When the frame after the one due at deadline is due at a rate of fps.
+The part of a microsecond that 1000000 / fps leaves is carried over, so
+144 frames take exactly one second. A deadline that fell more than a
+frame behind is pulled up, so a hitch is made up for with one quick
+frame rather than a burst of them.
+=================
+*/
+static int64_t Com_NextFrameUsec(int64_t deadline, int fps) {
+	static int remainder, lastFps;
+	int64_t period, now;
+
+	if (fps != lastFps) {
+		remainder = 0;
+		lastFps = fps;
+	}
+
+	period = 1000000 / fps;
+	remainder += 1000000 % fps;
+	if (remainder >= fps) {
+		remainder -= fps;
+		period++;
+	}
+
+	deadline += period;
+
+	now = Sys_Microseconds();
+	if (deadline < now - period)
+		deadline = now - period;
+
+	return deadline;
+}
+
+int64_t com_inputSampleUsec;
+int com_latencyWaitUsec;
+static int64_t com_frameWorkUsec;
+
+/*
+=================
+Com_LatencyDelayUsec
+
+How long com_lowLatency waits after a frame is due before sampling input,
+so the frame finishes just before the next one is due rather than idling
+with its input getting old.  With vsync the frame cost includes the wait
+for the swap and this comes out as 0.
+=================
+*/
+static int Com_LatencyDelayUsec(int fps) {
+	int64_t delay;
+
+	if (!com_lowLatency->integer) {
+		return 0;
+	}
+
+	delay = 1000000 / fps - com_frameWorkUsec - (int64_t)(com_lowLatencyMargin->value * 1000.0f);
+
+	return delay > 0 ? delay : 0;
+}
+
 /*
 =================
 Com_Frame
 =================
 */
 void Com_Frame(void) {
-	int msec, minMsec;
+	int msec, fps;
 	int timeVal, timeValSV;
-	static int lastTime = 0, bias = 0;
+	static int lastTime = 0;
+	static int64_t nextFrameUsec = 0;
+	int latencyDelay;
+	int64_t waitUsec, workUsec;
 
 	int timeBeforeFirstEvents;
 	int timeBeforeServer;
@@ -2842,6 +3815,12 @@ void Com_Frame(void) {
 		return; // an ERR_DROP was thrown
 	}
 
+	// last frame's scratch memory is dead now
+	Com_ScratchReset();
+
+	Com_ProfileFrame();
+
+	latencyDelay = 0;
 	timeBeforeFirstEvents = 0;
 	timeBeforeServer = 0;
 	timeBeforeEvents = 0;
@@ -2858,50 +3837,51 @@ void Com_Frame(void) {
 		timeBeforeFirstEvents = Sys_Milliseconds();
 	}
 
-	// Figure out how much time we have
+	// Figure out when the next frame is due
 	if (!com_timedemo->integer) {
 		if (com_dedicated->integer)
-			minMsec = SV_FrameMsec();
+			nextFrameUsec = (int64_t)(com_frameTime + SV_FrameMsec()) * 1000;
 		else {
 			if (com_minimized->integer && com_maxfpsMinimized->integer > 0)
-				minMsec = 1000 / com_maxfpsMinimized->integer;
+				fps = com_maxfpsMinimized->integer;
 			else if (com_unfocused->integer && com_maxfpsUnfocused->integer > 0)
-				minMsec = 1000 / com_maxfpsUnfocused->integer;
-			else if (com_maxfps->integer > 0)
-				minMsec = 1000 / com_maxfps->integer;
-			else
-				minMsec = 1;
-
-			timeVal = com_frameTime - lastTime;
-			bias += timeVal - minMsec;
-
-			if (bias > minMsec)
-				bias = minMsec;
-
-			// Adjust minMsec if previous frame took too long to render so
-			// that framerate is stable at the requested value.
-			minMsec -= bias;
+				fps = com_maxfpsUnfocused->integer;
+			else if (com_maxfps->integer > 0) {
+				fps = com_maxfps->integer;
+				latencyDelay = Com_LatencyDelayUsec(fps);
+			} else
+				fps = 1000;
+
+			nextFrameUsec = Com_NextFrameUsec(nextFrameUsec, fps);
 		}
 	} else
-		minMsec = 1;
+		nextFrameUsec = (int64_t)(com_frameTime + 1) * 1000;
+
+	// the schedule stays on nextFrameUsec, only this frame starts later
+	waitUsec = nextFrameUsec + latencyDelay;
+	com_latencyWaitUsec = latencyDelay;
 
 	do {
 		if (com_sv_running->integer) {
 			timeValSV = SV_SendQueuedPackets();
 
-			timeVal = Com_TimeVal(minMsec);
+			timeVal = Com_TimeValUsec(waitUsec);
 
-			if (timeValSV < timeVal)
-				timeVal = timeValSV;
+			if (timeValSV <= timeVal / 1000)
+				timeVal = timeValSV * 1000;
 		} else
-			timeVal = Com_TimeVal(minMsec);
+			timeVal = Com_TimeValUsec(waitUsec);
 
-		if (com_busyWait->integer || timeVal < 1)
+		if (com_busyWait->integer)
 			NET_Sleep(0);
 		else
-			NET_Sleep(timeVal - 1);
-	} while (Com_TimeVal(minMsec));
+			NET_Sleep(timeVal);
+	} while (Sys_Microseconds() < waitUsec);
 
+	Com_HitchFrameBegin();
+	PROFILE_BEGIN("Com_Frame");
+
+	com_inputSampleUsec = Sys_Microseconds();
 	IN_Frame();
 
 	lastTime = com_frameTime;
@@ -2926,7 +3906,9 @@ void Com_Frame(void) {
 		timeBeforeServer = Sys_Milliseconds();
 	}
 
+	PROFILE_BEGIN("SV_Frame");
 	SV_Frame(msec);
+	PROFILE_END();
 
 	// if "dedicated" has been modified, start up
 	// or shut down the client system.
@@ -3012,6 +3994,19 @@ void Com_Frame(void) {
 
 	Com_ReadFromPipe();
 
+	Com_MemStatLog();
+
+	// the frame cost follows slow frames at once and quick ones slowly, so
+	// one quick frame doesn't make the next one late; loads are left out
+	workUsec = MIN(Sys_Microseconds() - com_inputSampleUsec, 100000);
+	if (workUsec > com_frameWorkUsec)
+		com_frameWorkUsec = workUsec;
+	else
+		com_frameWorkUsec += (workUsec - com_frameWorkUsec) / 32;
+
+	PROFILE_END();
+	Com_HitchFrameEnd();
+
 	com_frameNumber++;
 }
 
@@ -3021,6 +4016,10 @@ Com_Shutdown
 =================
 */
 void Com_Shutdown(void) {
+	Com_ShutdownHitch();
+	Com_ShutdownJobs();
+	Com_StopPrintThread();
+
 	if (logfile) {
 		FS_FCloseFile(logfile);
 		logfile = 0;
@@ -28,6 +28,9 @@ static cvar_t *cvar_vars = NULL;
 static cvar_t *cvar_cheats;
 int cvar_modifiedFlags;
 
+// bumped whenever any cvar is created, changed or unset
+static int cvar_generation = 1;
+
 #define MAX_CVARS 1024
 static cvar_t cvar_indexes[MAX_CVARS];
 static int cvar_numIndexes;
@@ -398,6 +401,7 @@ cvar_t *Cvar_Get(const char *var_name, const char *var_value, int flags) {
 	var->string = CopyString(var_value);
 	var->modified = qtrue;
 	var->modificationCount = 1;
+	cvar_generation++;
 	var->value = atof(var->string);
 	var->integer = atoi(var->string);
 	var->resetString = CopyString(var_value);
@@ -544,6 +548,7 @@ cvar_t *Cvar_Set2(const char *var_name, const char *value, qboolean force) {
 			var->latchedString = CopyString(value);
 			var->modified = qtrue;
 			var->modificationCount++;
+			cvar_generation++;
 			return var;
 		}
 	} else {
@@ -558,6 +563,7 @@ cvar_t *Cvar_Set2(const char *var_name, const char *value, qboolean force) {
 
 	var->modified = qtrue;
 	var->modificationCount++;
+	cvar_generation++;
 
 	Z_Free(var->string); // free the old value string
 
@@ -1053,6 +1059,7 @@ static cvar_t *Cvar_Unset(cvar_t *cv) {
 
 	// note what types of cvars have been modified (userinfo, archive, serverinfo, systeminfo)
 	cvar_modifiedFlags |= cv->flags;
+	cvar_generation++;
 
 	if (cv->name)
 		Z_Free(cv->name);
@@ -1158,15 +1165,19 @@ Cvar_InfoString
 */
 char *Cvar_InfoString(int bit) {
 	static char info[MAX_INFO_STRING];
+	static infoDict_t dict;
 	cvar_t *var;
 
-	info[0] = 0;
+	// cvar names are unique, so the dictionary only saves rescanning
+	// the string for every cvar
+	Info_DictInit(&dict, MAX_INFO_STRING, qfalse);
 
 	for (var = cvar_vars; var; var = var->next) {
 		if (var->name && (var->flags & bit))
-			Info_SetValueForKey(info, var->name, var->string);
+			Info_DictSet(&dict, var->name, var->string);
 	}
 
+	Info_DictWrite(&dict, info, sizeof(info));
 	return info;
 }
 
@@ -1179,14 +1190,17 @@ Cvar_InfoString_Big
 */
 char *Cvar_InfoString_Big(int bit) {
 	static char info[BIG_INFO_STRING];
+	static infoDict_t dict;
 	cvar_t *var;
 
-	info[0] = 0;
+	Info_DictInit(&dict, BIG_INFO_STRING, qtrue);
 
 	for (var = cvar_vars; var; var = var->next) {
 		if (var->name && (var->flags & bit))
-			Info_SetValueForKey_Big(info, var->name, var->string);
+			Info_DictSet(&dict, var->name, var->string);
 	}
+
+	Info_DictWrite(&dict, info, sizeof(info));
 	return info;
 }
 
@@ -1322,6 +1336,18 @@ void Cvar_Update(vmCvar_t *vmCvar) {
 	vmCvar->integer = cv->integer;
 }
 
+/*
+=====================
+Cvar_Generation
+
+Changes whenever any cvar changes, so the modules can skip updating
+their cvars when it is the same as on their last update
+=====================
+*/
+int Cvar_Generation(void) {
+	return cvar_generation;
+}
+
 /*
 ==================
 Cvar_CompleteCvarName
@@ -32,6 +32,10 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "qcommon.h"
 #include "unzip.h"
 
+#ifdef USE_LIBDEFLATE
+#include <libdeflate.h>
+#endif
+
 /*
 =============================================================================
 
@@ -198,11 +202,16 @@ typedef struct {
 	unzFile handle;				  // handle to zip file
 	int checksum;				  // regular checksum
 	int pure_checksum;			  // checksum for pure
+	int *headerLongs;			  // checksum feed and file crcs the pure checksum is made of
+	int numHeaderLongs;
 	int numfiles;				  // number of files in pk3
 	int referenced;				  // referenced file flags
 	int hashSize;				  // hash table size (power of 2)
 	fileInPack_t **hashTable;	  // hash table
 	fileInPack_t *buildBuffer;	  // buffer with the filenames etc.
+	byte *map;					  // whole file when mapped for reading
+	int64_t mapLength;
+	qboolean mapFailed; // don't try mapping again
 } pack_t;
 
 typedef struct {
@@ -220,6 +229,7 @@ typedef struct searchpath_s {
 
 static char fs_gamedir[MAX_OSPATH]; // this will be a single file name with no separators
 static cvar_t *fs_debug;
+static cvar_t *fs_mmap;
 static cvar_t *fs_homepath;
 
 #ifdef __APPLE__
@@ -253,15 +263,53 @@ typedef struct qfile_us {
 typedef struct {
 	qfile_ut handleFiles;
 	qboolean handleSync;
+	qboolean writesQueued; // the write thread may still have writes for it
+	qboolean pipe;		   // stdin of a command, closed with Sys_ClosePipe
 	int fileSize;
 	int zipFilePos;
 	int zipFileLen;
 	qboolean zipFile;
+	pack_t *zipPak;
+	const byte *zipData; // entry data in the pak mapping, NULL once opened through unzip
+	int zipDataLen;
+	int zipDataPos;
+	qboolean zipDeflated;
+	byte *zipPrefetched; // inflated ahead of time by FS_Prefetch, freed on close
 	char name[MAX_ZPATH];
 } fileHandleData_t;
 
 static fileHandleData_t fsh[MAX_FILE_HANDLES];
 
+// all pak entries by name, in search path order
+typedef struct fileIndexEntry_s {
+	searchpath_t *search;
+	fileInPack_t *file;
+	struct fileIndexEntry_s *next;
+} fileIndexEntry_t;
+
+static fileIndexEntry_t **fs_fileIndex;
+static int fs_fileIndexSize;
+
+#define MAX_PREFETCH_FILES 1024
+
+typedef struct {
+	pack_t *pak;
+	unsigned long pos; // of the entry in the pak, like fileInPack_t
+	const byte *zipData;
+	int zipDataLen;
+	byte *data;
+	int len;
+	qboolean inflated;
+} prefetchFile_t;
+
+static cvar_t *fs_writeThread;
+static cvar_t *fs_prefetchThreads;
+static cvar_t *fs_prefetchMegs;
+static prefetchFile_t fs_prefetchFiles[MAX_PREFETCH_FILES];
+static int fs_numPrefetchFiles;
+
+static void FS_WaitQueuedWrites(void);
+
 // TTimo - https://zerowing.idsoftware.com/bugzilla/show_bug.cgi?id=540
 // wether we did a reorder on the current search path when joining the server
 static qboolean fs_reordered;
@@ -390,6 +438,12 @@ static FILE *FS_FileForHandle(fileHandle_t f) {
 		Com_Error(ERR_DROP, "FS_FileForHandle: NULL");
 	}
 
+	// the FILE is used directly, so the queued writes have to be done first
+	if (fsh[f].writesQueued) {
+		FS_WaitQueuedWrites();
+		fsh[f].writesQueued = qfalse;
+	}
+
 	return fsh[f].handleFiles.file.o;
 }
 
@@ -532,13 +586,14 @@ qboolean FS_CreatePath(char *ospath) {
 =================
 FS_CheckFilenameIsMutable
 
-ERR_FATAL if trying to manipulate a file with the platform library, QVM, or pk3 extension
+ERR_FATAL if trying to manipulate a file with the platform library, QVM, compiled QVM, pk3 or pk3 index extension
 =================
  */
 static void FS_CheckFilenameIsMutable(const char *filename, const char *function) {
-	// Check if the filename ends with the library, QVM, or pk3 extension
+	// Check if the filename ends with the library, QVM, compiled QVM, pk3 or pk3 index extension
 	if (Sys_DllExtension(filename) || COM_CompareExtension(filename, ".qvm") ||
-		COM_CompareExtension(filename, ".pk3")) {
+		COM_CompareExtension(filename, ".qvmc") || COM_CompareExtension(filename, ".pk3") ||
+		COM_CompareExtension(filename, ".pk3idx")) {
 		Com_Error(ERR_FATAL,
 				  "%s: Not allowed to manipulate '%s' due "
 				  "to %s extension",
@@ -662,6 +717,51 @@ fileHandle_t FS_SV_FOpenFileWrite(const char *filename) {
 	return f;
 }
 
+/*
+===========
+FS_SV_FOpenFileAppend
+
+Opens a file below the home path for appending, returns its current length
+===========
+*/
+long FS_SV_FOpenFileAppend(const char *filename, fileHandle_t *fp) {
+	char *ospath;
+	fileHandle_t f;
+
+	if (!fs_searchpaths) {
+		Com_Error(ERR_FATAL, "Filesystem call made without initialization");
+	}
+
+	ospath = FS_BuildOSPath(fs_homepath->string, filename, "");
+	ospath[strlen(ospath) - 1] = '\0';
+
+	f = FS_HandleForFile();
+	fsh[f].zipFile = qfalse;
+
+	if (fs_debug->integer) {
+		Com_Printf("FS_SV_FOpenFileAppend: %s\n", ospath);
+	}
+
+	FS_CheckFilenameIsMutable(ospath, __func__);
+
+	*fp = 0;
+	if (FS_CreatePath(ospath)) {
+		return -1;
+	}
+
+	fsh[f].handleFiles.file.o = Sys_FOpen(ospath, "ab");
+
+	Q_strncpyz(fsh[f].name, filename, sizeof(fsh[f].name));
+
+	fsh[f].handleSync = qfalse;
+	if (!fsh[f].handleFiles.file.o) {
+		return -1;
+	}
+
+	*fp = f;
+	return FS_filelength(f);
+}
+
 /*
 ===========
 FS_SV_FOpenFileRead
@@ -799,17 +899,28 @@ void FS_FCloseFile(fileHandle_t f) {
 	}
 
 	if (fsh[f].zipFile == qtrue) {
-		unzCloseCurrentFile(fsh[f].handleFiles.file.z);
-		if (fsh[f].handleFiles.unique) {
-			unzClose(fsh[f].handleFiles.file.z);
+		// entries read from the mapping never opened unzip
+		if (!fsh[f].zipData) {
+			unzCloseCurrentFile(fsh[f].handleFiles.file.z);
+			if (fsh[f].handleFiles.unique) {
+				unzClose(fsh[f].handleFiles.file.z);
+			}
 		}
+		free(fsh[f].zipPrefetched);
 		Com_Memset(&fsh[f], 0, sizeof(fsh[f]));
 		return;
 	}
 
 	// we didn't find it as a pak, so close it as a unique file
 	if (fsh[f].handleFiles.file.o) {
-		fclose(fsh[f].handleFiles.file.o);
+		if (fsh[f].writesQueued) {
+			FS_WaitQueuedWrites();
+		}
+		if (fsh[f].pipe) {
+			Sys_ClosePipe(fsh[f].handleFiles.file.o);
+		} else {
+			fclose(fsh[f].handleFiles.file.o);
+		}
 	}
 	Com_Memset(&fsh[f], 0, sizeof(fsh[f]));
 }
@@ -944,6 +1055,40 @@ fileHandle_t FS_FCreateOpenPipeFile(const char *filename) {
 	return f;
 }
 
+/*
+===========
+FS_FOpenPipeWrite
+
+Starts a command and returns a handle that writes to its stdin
+===========
+*/
+fileHandle_t FS_FOpenPipeWrite(const char *command) {
+	fileHandle_t f;
+
+	if (!fs_searchpaths) {
+		Com_Error(ERR_FATAL, "Filesystem call made without initialization");
+	}
+
+	f = FS_HandleForFile();
+	fsh[f].zipFile = qfalse;
+	fsh[f].pipe = qtrue;
+
+	Q_strncpyz(fsh[f].name, command, sizeof(fsh[f].name));
+
+	if (fs_debug->integer) {
+		Com_Printf("FS_FOpenPipeWrite: %s\n", command);
+	}
+
+	fsh[f].handleFiles.file.o = Sys_OpenPipe(command);
+	fsh[f].handleSync = qfalse;
+	if (!fsh[f].handleFiles.file.o) {
+		Com_Memset(&fsh[f], 0, sizeof(fsh[f]));
+		f = 0;
+	}
+
+	return f;
+}
+
 /*
 ===========
 FS_FilenameCompare
@@ -1029,6 +1174,189 @@ qboolean FS_IsDemoExt(const char *filename, int namelen) {
 	return qfalse;
 }
 
+/*
+===========
+FS_MappedZipEntry
+
+Finds the data of a pak entry in the mapped pak, mapping it on first use.
+NULL if the pak can't be mapped or the entry isn't plain stored or deflated.
+===========
+*/
+#define ZIP_LOCAL_SIGNATURE 0x04034b50
+#define ZIP_CENTRAL_SIGNATURE 0x02014b50
+#define ZIP_LOCAL_HEADER_SIZE 30
+#define ZIP_CENTRAL_HEADER_SIZE 46
+
+static unsigned int FS_ZipShort(const byte *p) {
+	return p[0] | (p[1] << 8);
+}
+
+static unsigned int FS_ZipLong(const byte *p) {
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((unsigned int)p[3] << 24);
+}
+
+static const byte *FS_MappedZipEntry(pack_t *pak, fileInPack_t *pakFile, int *compressedLen, qboolean *deflated) {
+	const byte *central, *local;
+	unsigned int method, size;
+	int64_t ofs;
+
+	if (!pak->map) {
+		if (pak->mapFailed || !fs_mmap->integer)
+			return NULL;
+
+		pak->map = Sys_MapFile(pak->pakFilename, &pak->mapLength);
+		if (!pak->map) {
+			pak->mapFailed = qtrue;
+			return NULL;
+		}
+	}
+
+	// the position unzip keeps is that of the central directory entry
+	if (pakFile->pos > pak->mapLength - ZIP_CENTRAL_HEADER_SIZE)
+		return NULL;
+
+	central = pak->map + pakFile->pos;
+	if (FS_ZipLong(central) != ZIP_CENTRAL_SIGNATURE || (FS_ZipShort(central + 8) & 1))
+		return NULL; // not where we expected or encrypted
+
+	method = FS_ZipShort(central + 10);
+	size = FS_ZipLong(central + 20);
+	if (FS_ZipLong(central + 24) != pakFile->len || size > INT_MAX)
+		return NULL;
+
+	if (method == 0 && size != pakFile->len)
+		return NULL;
+	if (method != 0 && method != Z_DEFLATED)
+		return NULL;
+
+	ofs = FS_ZipLong(central + 42);
+	if (ofs > pak->mapLength - ZIP_LOCAL_HEADER_SIZE)
+		return NULL;
+
+	local = pak->map + ofs;
+	if (FS_ZipLong(local) != ZIP_LOCAL_SIGNATURE)
+		return NULL;
+
+	ofs += ZIP_LOCAL_HEADER_SIZE + FS_ZipShort(local + 26) + FS_ZipShort(local + 28);
+	if (ofs > pak->mapLength || size > pak->mapLength - ofs)
+		return NULL;
+
+	*compressedLen = size;
+	*deflated = method != 0;
+
+	return pak->map + ofs;
+}
+
+/*
+===========
+FS_OpenZipEntry
+
+Opens a pak entry through unzip
+===========
+*/
+static void FS_OpenZipEntry(fileHandle_t f) {
+	if (fsh[f].handleFiles.unique) {
+		// open a new file on the pakfile
+		fsh[f].handleFiles.file.z = unzOpen(fsh[f].zipPak->pakFilename);
+
+		if (fsh[f].handleFiles.file.z == NULL)
+			Com_Error(ERR_FATAL, "Couldn't open %s", fsh[f].zipPak->pakFilename);
+	} else
+		fsh[f].handleFiles.file.z = fsh[f].zipPak->handle;
+
+	// set the file position in the zip file (also sets the current file info)
+	unzSetOffset(fsh[f].handleFiles.file.z, fsh[f].zipFilePos);
+
+	// open the file in the zip
+	unzOpenCurrentFile(fsh[f].handleFiles.file.z);
+	fsh[f].zipData = NULL;
+}
+
+/*
+===========
+FS_StreamZipEntry
+
+Deflated entries are only read from the mapping as a whole,
+anything else switches them over to unzip
+===========
+*/
+static void FS_StreamZipEntry(fileHandle_t f) {
+	if (fsh[f].zipData && fsh[f].zipDeflated)
+		FS_OpenZipEntry(f);
+}
+
+/*
+===========
+FS_InflateZipEntry
+
+Inflates a whole mapped entry at once, qfalse if it is corrupt.
+Only touches its arguments, so it is safe to call from job threads.
+With USE_LIBDEFLATE builds this goes through libdeflate, which is
+considerably faster than zlib when the sizes are known up front.
+===========
+*/
+#ifdef USE_LIBDEFLATE
+static qboolean FS_InflateZipEntry(const byte *data, int dataLen, byte *buf, int len) {
+	struct libdeflate_decompressor *decompressor;
+	enum libdeflate_result result;
+
+	// zip entries are raw deflate streams, without the zlib header
+	decompressor = libdeflate_alloc_decompressor();
+	if (!decompressor)
+		return qfalse;
+
+	// with no actual size returned the output has to fill buf exactly
+	result = libdeflate_deflate_decompress(decompressor, data, dataLen, buf, len, NULL);
+	libdeflate_free_decompressor(decompressor);
+
+	return result == LIBDEFLATE_SUCCESS;
+}
+#else
+static qboolean FS_InflateZipEntry(const byte *data, int dataLen, byte *buf, int len) {
+	z_stream stream;
+	int err;
+
+	Com_Memset(&stream, 0, sizeof(stream));
+
+	// zip entries are raw deflate streams without a zlib header
+	if (inflateInit2(&stream, -MAX_WBITS) != Z_OK)
+		return qfalse;
+
+	stream.next_in = (Bytef *)data;
+	stream.avail_in = dataLen;
+	stream.next_out = buf;
+	stream.avail_out = len;
+
+	err = inflate(&stream, Z_FINISH);
+	inflateEnd(&stream);
+
+	return err == Z_STREAM_END && stream.total_out == len;
+}
+#endif
+
+/*
+===========
+FS_TakePrefetched
+
+Hands the buffer FS_Prefetch inflated for a pak entry over to the caller
+===========
+*/
+static byte *FS_TakePrefetched(pack_t *pak, fileInPack_t *pakFile) {
+	prefetchFile_t *p;
+	byte *data;
+	int i;
+
+	for (i = 0, p = fs_prefetchFiles; i < fs_numPrefetchFiles; i++, p++) {
+		if (p->pak == pak && p->pos == pakFile->pos && p->data) {
+			data = p->data;
+			p->data = NULL;
+			return data;
+		}
+	}
+
+	return NULL;
+}
+
 /*
 ===========
 FS_FOpenFileReadDir
@@ -1160,26 +1488,24 @@ long FS_FOpenFileReadDir(const char *filename, searchpath_t *search, fileHandle_
 					if (strstr(filename, "ui.qvm"))
 						pak->referenced |= FS_UI_REF;
 
-					if (uniqueFILE) {
-						// open a new file on the pakfile
-						fsh[*file].handleFiles.file.z = unzOpen(pak->pakFilename);
-
-						if (fsh[*file].handleFiles.file.z == NULL)
-							Com_Error(ERR_FATAL, "Couldn't open %s", pak->pakFilename);
-					} else
-						fsh[*file].handleFiles.file.z = pak->handle;
-
 					Q_strncpyz(fsh[*file].name, filename, sizeof(fsh[*file].name));
 					fsh[*file].zipFile = qtrue;
-
-					// set the file position in the zip file (also sets the current file info)
-					unzSetOffset(fsh[*file].handleFiles.file.z, pakFile->pos);
-
-					// open the file in the zip
-					unzOpenCurrentFile(fsh[*file].handleFiles.file.z);
+					fsh[*file].zipPak = pak;
 					fsh[*file].zipFilePos = pakFile->pos;
 					fsh[*file].zipFileLen = pakFile->len;
 
+					// entries of a mapped pak only go through unzip if they are streamed
+					fsh[*file].zipData =
+						FS_MappedZipEntry(pak, pakFile, &fsh[*file].zipDataLen, &fsh[*file].zipDeflated);
+					if (!fsh[*file].zipData)
+						FS_OpenZipEntry(*file);
+					else if (fsh[*file].zipDeflated && (fsh[*file].zipPrefetched = FS_TakePrefetched(pak, pakFile))) {
+						// already inflated, read it like a stored entry
+						fsh[*file].zipData = fsh[*file].zipPrefetched;
+						fsh[*file].zipDataLen = pakFile->len;
+						fsh[*file].zipDeflated = qfalse;
+					}
+
 					if (fs_debug->integer) {
 						Com_Printf("FS_FOpenFileRead: %s (found in '%s')\n", filename, pak->pakFilename);
 					}
@@ -1238,6 +1564,99 @@ long FS_FOpenFileReadDir(const char *filename, searchpath_t *search, fileHandle_
 	return -1;
 }
 
+/*
+===========
+FS_FreeFileIndex
+===========
+*/
+static void FS_FreeFileIndex(void) {
+	if (fs_fileIndex) {
+		Z_Free(fs_fileIndex);
+		fs_fileIndex = NULL;
+		fs_fileIndexSize = 0;
+	}
+}
+
+/*
+===========
+FS_BuildFileIndex
+
+Hashes the entries of all paks into a single table, so FS_FOpenFileRead
+doesn't have to probe every pak in turn.  Has to be rebuilt whenever the
+search paths change.
+===========
+*/
+static void FS_BuildFileIndex(void) {
+	searchpath_t *search, **searchPaths;
+	fileIndexEntry_t *entry;
+	fileInPack_t *file;
+	pack_t *pak;
+	int numSearchPaths, numFiles;
+	int i, j;
+	long hash;
+
+	FS_FreeFileIndex();
+
+	numSearchPaths = numFiles = 0;
+	for (search = fs_searchpaths; search; search = search->next) {
+		numSearchPaths++;
+		if (search->pack)
+			numFiles += search->pack->numfiles;
+	}
+
+	if (!numFiles)
+		return;
+
+	for (fs_fileIndexSize = 1; fs_fileIndexSize < numFiles; fs_fileIndexSize <<= 1)
+		;
+
+	fs_fileIndex = Z_Malloc(fs_fileIndexSize * sizeof(*fs_fileIndex) + numFiles * sizeof(*entry));
+	entry = (fileIndexEntry_t *)(fs_fileIndex + fs_fileIndexSize);
+
+	searchPaths = Z_Malloc(numSearchPaths * sizeof(*searchPaths));
+	for (i = 0, search = fs_searchpaths; search; search = search->next)
+		searchPaths[i++] = search;
+
+	// going backwards leaves every chain in search order
+	for (i = numSearchPaths - 1; i >= 0; i--) {
+		pak = searchPaths[i]->pack;
+		if (!pak)
+			continue;
+
+		for (j = 0, file = pak->buildBuffer; j < pak->numfiles; j++, file++, entry++) {
+			hash = FS_HashFileName(file->name, fs_fileIndexSize);
+			entry->search = searchPaths[i];
+			entry->file = file;
+			entry->next = fs_fileIndex[hash];
+			fs_fileIndex[hash] = entry;
+		}
+	}
+
+	Z_Free(searchPaths);
+}
+
+/*
+===========
+FS_IndexedPak
+
+Returns the first pak search path with the file, skipping the
+paks FS_FOpenFileReadDir would refuse when pure is set
+===========
+*/
+static searchpath_t *FS_IndexedPak(const char *filename, qboolean pure) {
+	fileIndexEntry_t *entry;
+
+	if (filename[0] == '/' || filename[0] == '\\')
+		filename++;
+
+	for (entry = fs_fileIndex[FS_HashFileName(filename, fs_fileIndexSize)]; entry; entry = entry->next) {
+		if (!FS_FilenameCompare(entry->file->name, filename) && (!pure || FS_PakIsPure(entry->search->pack)))
+			return entry->search;
+	}
+
+	return NULL;
+}
+
 /*
 ===========
 FS_FOpenFileRead
@@ -1249,19 +1668,32 @@ separate file or a ZIP file.
 ===========
 */
 long FS_FOpenFileRead(const char *filename, fileHandle_t *file, qboolean uniqueFILE) {
-	searchpath_t *search;
+	searchpath_t *search, *pakSearch;
 	long len;
 	qboolean isLocalConfig;
 
 	if (!fs_searchpaths)
 		Com_Error(ERR_FATAL, "Filesystem call made without initialization");
 
+	if (filename == NULL)
+		Com_Error(ERR_FATAL, "FS_FOpenFileRead: NULL 'filename' parameter passed");
+
 	isLocalConfig = !strcmp(filename, "autoexec.cfg") || !strcmp(filename, Q3CONFIG_CFG);
+
+	// only the one pak the index comes up with needs to be looked at,
+	// directories are still checked as files may show up there any time
+	pakSearch = NULL;
+	if (fs_fileIndex && !isLocalConfig)
+		pakSearch = FS_IndexedPak(filename, file != NULL);
+
 	for (search = fs_searchpaths; search; search = search->next) {
 		// autoexec.cfg and q3config.cfg can only be loaded outside of pk3 files.
 		if (isLocalConfig && search->pack)
 			continue;
 
+		if (fs_fileIndex && search->pack && search != pakSearch)
+			continue;
+
 		len = FS_FOpenFileReadDir(filename, search, file, uniqueFILE, qfalse);
 
 		if (file == NULL) {
@@ -1420,6 +1852,17 @@ int FS_Read(void *buffer, int len, fileHandle_t f) {
 		}
 		return len;
 	} else {
+		FS_StreamZipEntry(f);
+
+		if (fsh[f].zipData) {
+			if (len > fsh[f].zipFileLen - fsh[f].zipDataPos)
+				len = fsh[f].zipFileLen - fsh[f].zipDataPos;
+
+			Com_Memcpy(buffer, fsh[f].zipData + fsh[f].zipDataPos, len);
+			fsh[f].zipDataPos += len;
+			return len;
+		}
+
 		return unzReadCurrentFile(fsh[f].handleFiles.file.z, buffer, len);
 	}
 }
@@ -1477,34 +1920,316 @@ int FS_Write(const void *buffer, int len, fileHandle_t h) {
 	return len;
 }
 
-void QDECL FS_Printf(fileHandle_t h, const char *fmt, ...) {
-	va_list argptr;
-	char msg[MAXPRINTMSG];
+/*
+=================================================================================
 
-	va_start(argptr, fmt);
-	Q_vsnprintf(msg, sizeof(msg), fmt, argptr);
-	va_end(argptr);
+WRITE THREAD
 
-	FS_Write(msg, strlen(msg), h);
-}
+FS_WriteQueued hands the write to a thread, so a slow disk doesn't stall
+the frame.  The writes keep their order, and anything that uses the FILE of
+a handle directly first waits for the queue to drain.  Records never wrap
+around the end of the ring, so the thread writes them straight out of it.
 
-#define PK3_SEEK_BUFFER_SIZE 65536
+=================================================================================
+*/
+
+#define WRITE_RING_SIZE (256 * 1024)
+#define WRITE_ALIGN 32 // records start on this, so a skip record always fits
+
+typedef struct {
+	FILE *file;
+	int length; // -1 skips to the start of the ring
+	qboolean sync;
+} writeRecord_t; // followed by the data
+
+typedef struct {
+	sysThread_t *thread;
+	sysMutex_t *mutex;	// guards the ring
+	sysCond_t *wake;	// a write was queued, or quit is set
+	sysCond_t *drained; // the thread finished a write
+
+	byte ring[WRITE_RING_SIZE];
+	int head, tail;
+	int used;
+	qboolean quit;
+} writeQueue_t;
+
+static writeQueue_t *fs_writeQueue;
+static qboolean fs_writeThreadFailed;
 
 /*
 =================
-FS_Seek
-
+FS_WriteThread
 =================
 */
-int FS_Seek(fileHandle_t f, long offset, int origin) {
-	int _origin;
-
-	if (!fs_searchpaths) {
-		Com_Error(ERR_FATAL, "Filesystem call made without initialization");
-		return -1;
-	}
+static void FS_WriteThread(void *data) {
+	writeQueue_t *q = data;
+	writeRecord_t *rec;
+	int size;
 
-	if (fsh[f].zipFile == qtrue) {
+	Sys_LockMutex(q->mutex);
+	for (;;) {
+		while (!q->used && !q->quit) {
+			Sys_WaitCond(q->wake, q->mutex);
+		}
+		if (!q->used) {
+			break;
+		}
+
+		rec = (writeRecord_t *)(q->ring + q->tail);
+		if (rec->length < 0) {
+			q->used -= WRITE_RING_SIZE - q->tail;
+			q->tail = 0;
+			continue;
+		}
+
+		// the record isn't overwritten before the tail moves past it
+		Sys_UnlockMutex(q->mutex);
+		fwrite(rec + 1, 1, rec->length, rec->file);
+		if (rec->sync) {
+			fflush(rec->file);
+		}
+		Sys_LockMutex(q->mutex);
+
+		size = PAD(sizeof(*rec) + rec->length, WRITE_ALIGN);
+		q->tail = (q->tail + size) % WRITE_RING_SIZE;
+		q->used -= size;
+		Sys_BroadcastCond(q->drained);
+	}
+	Sys_UnlockMutex(q->mutex);
+}
+
+/*
+=================
+FS_StartWriteThread
+=================
+*/
+static qboolean FS_StartWriteThread(void) {
+	writeQueue_t *q;
+
+	q = calloc(1, sizeof(*q));
+	if (!q) {
+		return qfalse;
+	}
+
+	q->mutex = Sys_CreateMutex();
+	q->wake = Sys_CreateCond();
+	q->drained = Sys_CreateCond();
+	if (q->mutex && q->wake && q->drained) {
+		q->thread = Sys_CreateThread(FS_WriteThread, q);
+	}
+
+	if (!q->thread) {
+		Com_Printf(S_COLOR_YELLOW "WARNING: failed to start the file write thread\n");
+		if (q->mutex)
+			Sys_DestroyMutex(q->mutex);
+		if (q->wake)
+			Sys_DestroyCond(q->wake);
+		if (q->drained)
+			Sys_DestroyCond(q->drained);
+		free(q);
+		fs_writeThreadFailed = qtrue;
+		return qfalse;
+	}
+
+	fs_writeQueue = q;
+	return qtrue;
+}
+
+/*
+=================
+FS_StopWriteThread
+
+Does the queued writes and goes back to writing directly
+=================
+*/
+static void FS_StopWriteThread(void) {
+	writeQueue_t *q = fs_writeQueue;
+
+	if (!q) {
+		return;
+	}
+
+	Sys_LockMutex(q->mutex);
+	q->quit = qtrue;
+	Sys_SignalCond(q->wake);
+	Sys_UnlockMutex(q->mutex);
+
+	// the thread drains the ring before it quits
+	Sys_JoinThread(q->thread);
+	fs_writeQueue = NULL;
+
+	Sys_DestroyMutex(q->mutex);
+	Sys_DestroyCond(q->wake);
+	Sys_DestroyCond(q->drained);
+	free(q);
+}
+
+/*
+=================
+FS_WaitQueuedWrites
+
+Returns once the write thread is done with everything queued so far
+=================
+*/
+static void FS_WaitQueuedWrites(void) {
+	writeQueue_t *q = fs_writeQueue;
+
+	if (!q) {
+		return;
+	}
+
+	Sys_LockMutex(q->mutex);
+	while (q->used) {
+		Sys_WaitCond(q->drained, q->mutex);
+	}
+	Sys_UnlockMutex(q->mutex);
+}
+
+/*
+=================
+FS_WriteQueued
+
+Like FS_Write, but with fs_writeThread on the write is done by a thread.
+Blocks only while the ring is full, dropping data would lose the order.
+=================
+*/
+int FS_WriteQueued(const void *buffer, int len, fileHandle_t h) {
+	writeQueue_t *q;
+	writeRecord_t *rec;
+	int size, skip;
+
+	if (!fs_searchpaths) {
+		Com_Error(ERR_FATAL, "Filesystem call made without initialization");
+	}
+
+	if (!h || len <= 0) {
+		return 0;
+	}
+
+	size = PAD(sizeof(*rec) + len, WRITE_ALIGN);
+	if (!fs_writeThread->integer || fs_writeThreadFailed || size > WRITE_RING_SIZE / 2 || h < 1 || h >= MAX_FILE_HANDLES ||
+		fsh[h].zipFile || !fsh[h].handleFiles.file.o) {
+		return FS_Write(buffer, len, h);
+	}
+
+	if (!fs_writeQueue && !FS_StartWriteThread()) {
+		return FS_Write(buffer, len, h);
+	}
+	q = fs_writeQueue;
+
+	Sys_LockMutex(q->mutex);
+
+	skip = q->head + size > WRITE_RING_SIZE ? WRITE_RING_SIZE - q->head : 0;
+	while (WRITE_RING_SIZE - q->used < skip + size) {
+		Sys_WaitCond(q->drained, q->mutex);
+		skip = q->head + size > WRITE_RING_SIZE ? WRITE_RING_SIZE - q->head : 0;
+	}
+
+	if (skip) {
+		((writeRecord_t *)(q->ring + q->head))->length = -1;
+		q->used += skip;
+		q->head = 0;
+	}
+
+	rec = (writeRecord_t *)(q->ring + q->head);
+	rec->file = fsh[h].handleFiles.file.o;
+	rec->length = len;
+	rec->sync = fsh[h].handleSync;
+	Com_Memcpy(rec + 1, buffer, len);
+
+	q->head = (q->head + size) % WRITE_RING_SIZE;
+	q->used += size;
+
+	Sys_SignalCond(q->wake);
+	Sys_UnlockMutex(q->mutex);
+
+	fsh[h].writesQueued = qtrue;
+	return len;
+}
+
+/*
+=================
+FS_WriteFromThread
+
+FS_Write for a thread other than the main one: the thread has to own the
+handle, and failures are only reported through the return value.
+=================
+*/
+int FS_WriteFromThread(const void *buffer, int len, fileHandle_t h) {
+	FILE *f;
+
+	if (h < 1 || h >= MAX_FILE_HANDLES || fsh[h].zipFile || !fsh[h].handleFiles.file.o) {
+		return 0;
+	}
+	f = fsh[h].handleFiles.file.o;
+
+	if (fwrite(buffer, 1, len, f) != (size_t)len) {
+		return 0;
+	}
+	if (fsh[h].handleSync) {
+		fflush(f);
+	}
+
+	return len;
+}
+
+void QDECL FS_Printf(fileHandle_t h, const char *fmt, ...) {
+	va_list argptr;
+	char msg[MAXPRINTMSG];
+
+	va_start(argptr, fmt);
+	Q_vsnprintf(msg, sizeof(msg), fmt, argptr);
+	va_end(argptr);
+
+	FS_Write(msg, strlen(msg), h);
+}
+
+#define PK3_SEEK_BUFFER_SIZE 65536
+
+/*
+=================
+FS_Seek
+
+=================
+*/
+int FS_Seek(fileHandle_t f, long offset, int origin) {
+	int _origin;
+
+	if (!fs_searchpaths) {
+		Com_Error(ERR_FATAL, "Filesystem call made without initialization");
+		return -1;
+	}
+
+	if (fsh[f].zipFile == qtrue)
+		FS_StreamZipEntry(f);
+
+	if (fsh[f].zipFile == qtrue && fsh[f].zipData) {
+		long position;
+
+		switch (origin) {
+		case FS_SEEK_CUR:
+			position = fsh[f].zipDataPos + offset;
+			break;
+		case FS_SEEK_END:
+			position = fsh[f].zipFileLen + offset;
+			break;
+		case FS_SEEK_SET:
+			position = offset;
+			break;
+		default:
+			Com_Error(ERR_FATAL, "Bad origin in FS_Seek");
+			return -1;
+		}
+
+		if (position < 0)
+			position = 0;
+		else if (position > fsh[f].zipFileLen)
+			position = fsh[f].zipFileLen;
+
+		fsh[f].zipDataPos = position;
+		return offset;
+	} else if (fsh[f].zipFile == qtrue) {
 		// FIXME: this is really, really crappy
 		//(but better than what was here before)
 		byte buffer[PK3_SEEK_BUFFER_SIZE];
@@ -1650,207 +2375,884 @@ int FS_FileIsInPAK(const char *filename, int *pChecksum) {
 			} while (pakFile != NULL);
 		}
 	}
-	return -1;
+	return -1;
+}
+
+/*
+============
+FS_ReadFileInternal
+
+Filename are relative to the quake search path
+a null buffer will just return the file length without loading
+If searchPath is non-NULL search only in that specific search path
+If readOnly is set, stored pak entries may be returned in place
+============
+*/
+static long FS_ReadFileInternal(const char *qpath, void *searchPath, qboolean unpure, qboolean readOnly,
+								void **buffer) {
+	fileHandle_t h;
+	searchpath_t *search;
+	byte *buf;
+	qboolean isConfig;
+	long len;
+
+	if (!fs_searchpaths) {
+		Com_Error(ERR_FATAL, "Filesystem call made without initialization");
+	}
+
+	if (!qpath || !qpath[0]) {
+		Com_Error(ERR_FATAL, "FS_ReadFile with empty name");
+	}
+
+	buf = NULL; // quiet compiler warning
+
+	// if this is a .cfg file and we are playing back a journal, read
+	// it from the journal file
+	if (strstr(qpath, ".cfg")) {
+		isConfig = qtrue;
+		if (com_journal && com_journal->integer == 2) {
+			int r;
+
+			Com_DPrintf("Loading %s from journal file.\n", qpath);
+			r = FS_Read(&len, sizeof(len), com_journalDataFile);
+			if (r != sizeof(len)) {
+				if (buffer != NULL)
+					*buffer = NULL;
+				return -1;
+			}
+			// if the file didn't exist when the journal was created
+			if (!len) {
+				if (buffer == NULL) {
+					return 1; // hack for old journal files
+				}
+				*buffer = NULL;
+				return -1;
+			}
+			if (buffer == NULL) {
+				return len;
+			}
+
+			buf = Hunk_AllocateTempMemory(len + 1);
+			*buffer = buf;
+
+			r = FS_Read(buf, len, com_journalDataFile);
+			if (r != len) {
+				Com_Error(ERR_FATAL, "Read from journalDataFile failed");
+			}
+
+			fs_loadCount++;
+			fs_loadStack++;
+
+			// guarantee that it will have a trailing 0 for string operations
+			buf[len] = 0;
+
+			return len;
+		}
+	} else {
+		isConfig = qfalse;
+	}
+
+	search = searchPath;
+
+	if (search == NULL) {
+		// look for it in the filesystem or pack files
+		len = FS_FOpenFileRead(qpath, &h, qfalse);
+	} else {
+		// look for it in a specific search path only
+		len = FS_FOpenFileReadDir(qpath, search, &h, qfalse, unpure);
+	}
+
+	if (h == 0) {
+		if (buffer) {
+			*buffer = NULL;
+		}
+		// if we are journalling and it is a config file, write a zero to the journal file
+		if (isConfig && com_journal && com_journal->integer == 1) {
+			Com_DPrintf("Writing zero for %s to journal file.\n", qpath);
+			len = 0;
+			FS_Write(&len, sizeof(len), com_journalDataFile);
+			FS_Flush(com_journalDataFile);
+		}
+		return -1;
+	}
+
+	if (!buffer) {
+		if (isConfig && com_journal && com_journal->integer == 1) {
+			Com_DPrintf("Writing len for %s to journal file.\n", qpath);
+			FS_Write(&len, sizeof(len), com_journalDataFile);
+			FS_Flush(com_journalDataFile);
+		}
+		FS_FCloseFile(h);
+		return len;
+	}
+
+	fs_loadCount++;
+	fs_loadStack++;
+
+	// aligned so the caller can read the data as it likes
+	if (readOnly && !isConfig && fsh[h].zipData && !fsh[h].zipDeflated && !fsh[h].zipPrefetched &&
+		!((intptr_t)fsh[h].zipData & 3)) {
+		*buffer = (void *)fsh[h].zipData;
+		FS_FCloseFile(h);
+		return len;
+	}
+
+	buf = Hunk_AllocateTempMemory(len + 1);
+	*buffer = buf;
+
+	// entries of mapped paks are inflated in one go
+	if (!fsh[h].zipData || !fsh[h].zipDeflated || !FS_InflateZipEntry(fsh[h].zipData, fsh[h].zipDataLen, buf, len))
+		FS_Read(buf, len, h);
+
+	// guarantee that it will have a trailing 0 for string operations
+	buf[len] = 0;
+	FS_FCloseFile(h);
+
+	// if we are journalling and it is a config file, write it to the journal file
+	if (isConfig && com_journal && com_journal->integer == 1) {
+		Com_DPrintf("Writing %s to journal file.\n", qpath);
+		FS_Write(&len, sizeof(len), com_journalDataFile);
+		FS_Write(buf, len, com_journalDataFile);
+		FS_Flush(com_journalDataFile);
+	}
+	return len;
+}
+
+/*
+============
+FS_ReadFileDir
+
+Filename are relative to the quake search path
+a null buffer will just return the file length without loading
+If searchPath is non-NULL search only in that specific search path
+============
+*/
+long FS_ReadFileDir(const char *qpath, void *searchPath, qboolean unpure, void **buffer) {
+	return FS_ReadFileInternal(qpath, searchPath, unpure, qfalse, buffer);
+}
+
+/*
+============
+FS_ReadFile
+
+Filename are relative to the quake search path
+a null buffer will just return the file length without loading
+============
+*/
+long FS_ReadFile(const char *qpath, void **buffer) {
+	return FS_ReadFileInternal(qpath, NULL, qfalse, qfalse, buffer);
+}
+
+/*
+============
+FS_ReadFileMapped
+
+Like FS_ReadFile, but the buffer may point into a mapped pak,
+so it must not be written to and has no trailing 0
+============
+*/
+long FS_ReadFileMapped(const char *qpath, const void **buffer) {
+	void *buf;
+	long len;
+
+	len = FS_ReadFileInternal(qpath, NULL, qfalse, qtrue, buffer ? &buf : NULL);
+	if (buffer)
+		*buffer = buf;
+
+	return len;
+}
+
+/*
+============
+FS_InPakMapping
+
+Whether a buffer points into a mapped pak rather than the hunk
+============
+*/
+static qboolean FS_InPakMapping(const void *buffer) {
+	searchpath_t *search;
+	pack_t *pak;
+
+	for (search = fs_searchpaths; search; search = search->next) {
+		pak = search->pack;
+		if (pak && pak->map && (const byte *)buffer >= pak->map && (const byte *)buffer < pak->map + pak->mapLength)
+			return qtrue;
+	}
+
+	return qfalse;
+}
+
+/*
+=============
+FS_FreeFile
+=============
+*/
+void FS_FreeFile(void *buffer) {
+	if (!fs_searchpaths) {
+		Com_Error(ERR_FATAL, "Filesystem call made without initialization");
+	}
+	if (!buffer) {
+		Com_Error(ERR_FATAL, "FS_FreeFile( NULL )");
+	}
+	fs_loadStack--;
+
+	if (!FS_InPakMapping(buffer))
+		Hunk_FreeTempMemory(buffer);
+
+	// if all of our temp files are free, clear all of our space
+	if (fs_loadStack == 0) {
+		Hunk_ClearTempMemory();
+	}
+}
+
+/*
+============
+FS_MapFile
+
+Maps a file that is found in a directory of the search path, read only.
+The pages come from the file cache of the OS, so every process that maps
+the same file shares them.  NULL if the file is in a pak or can't be mapped,
+then it has to be read instead.
+============
+*/
+const void *FS_MapFile(const char *qpath, int64_t *length) {
+	searchpath_t *search;
+	fileHandle_t h;
+	char *netpath;
+
+	if (!fs_searchpaths) {
+		Com_Error(ERR_FATAL, "Filesystem call made without initialization");
+	}
+
+	if (!fs_mmap->integer || !qpath || !qpath[0]) {
+		return NULL;
+	}
+
+	for (search = fs_searchpaths; search; search = search->next) {
+		if (FS_FOpenFileReadDir(qpath, search, &h, qfalse, qfalse) < 0) {
+			continue;
+		}
+		FS_FCloseFile(h);
+
+		// the file the search would read comes from a pak
+		if (!search->dir) {
+			return NULL;
+		}
+
+		netpath = FS_BuildOSPath(search->dir->path, search->dir->gamedir, qpath);
+		return Sys_MapFile(netpath, length);
+	}
+
+	return NULL;
+}
+
+/*
+============
+FS_SV_MapFile
+
+Maps a file below the home path read only, NULL if there is none or it
+can't be mapped
+============
+*/
+const void *FS_SV_MapFile(const char *filename, int64_t *length) {
+	char *ospath;
+
+	if (!fs_searchpaths) {
+		Com_Error(ERR_FATAL, "Filesystem call made without initialization");
+	}
+
+	if (!fs_mmap->integer || !filename || !filename[0]) {
+		return NULL;
+	}
+
+	ospath = FS_BuildOSPath(fs_homepath->string, filename, "");
+	// remove trailing slash
+	ospath[strlen(ospath) - 1] = '\0';
+
+	if (fs_debug->integer) {
+		Com_Printf("FS_SV_MapFile: %s\n", ospath);
+	}
+
+	return Sys_MapFile(ospath, length);
+}
+
+/*
+============
+FS_UnmapFile
+============
+*/
+void FS_UnmapFile(const void *buffer, int64_t length) {
+	Sys_UnmapFile((void *)buffer, length);
+}
+
+/*
+============
+FS_WriteFile
+
+Filename are relative to the quake search path
+============
+*/
+void FS_WriteFile(const char *qpath, const void *buffer, int size) {
+	fileHandle_t f;
+
+	if (!fs_searchpaths) {
+		Com_Error(ERR_FATAL, "Filesystem call made without initialization");
+	}
+
+	if (!qpath || !buffer) {
+		Com_Error(ERR_FATAL, "FS_WriteFile: NULL parameter");
+	}
+
+	f = FS_FOpenFileWrite(qpath);
+	if (!f) {
+		Com_Printf("Failed to open %s\n", qpath);
+		return;
+	}
+
+	FS_Write(buffer, size, f);
+
+	FS_FCloseFile(f);
+}
+
+/*
+=================
+FS_FlushPrefetch
+
+Drops whatever FS_Prefetch inflated that was not read yet
+=================
+*/
+void FS_FlushPrefetch(void) {
+	int i;
+
+	for (i = 0; i < fs_numPrefetchFiles; i++)
+		free(fs_prefetchFiles[i].data);
+
+	fs_numPrefetchFiles = 0;
+}
+
+/*
+=================
+FS_PrefetchLookup
+
+Finds the pak entry FS_FOpenFileRead would open for a file, if any
+=================
+*/
+static fileInPack_t *FS_PrefetchLookup(const char *filename, pack_t **pak) {
+	searchpath_t *search;
+	fileInPack_t *pakFile;
+
+	for (search = fs_searchpaths; search; search = search->next) {
+		// a loose file takes precedence, pure servers restrict those to configs and the like
+		if (search->dir) {
+			if (!fs_numServerPaks && FS_FOpenFileReadDir(filename, search, NULL, qfalse, qfalse) > 0)
+				return NULL;
+			continue;
+		}
+
+		if (!FS_PakIsPure(search->pack))
+			continue;
+
+		pakFile = search->pack->hashTable[FS_HashFileName(filename, search->pack->hashSize)];
+		for (; pakFile; pakFile = pakFile->next) {
+			if (!FS_FilenameCompare(pakFile->name, filename)) {
+				*pak = search->pack;
+				return pakFile;
+			}
+		}
+	}
+
+	return NULL;
+}
+
+/*
+=================
+FS_PrefetchJob
+=================
+*/
+static void FS_PrefetchJob(void *data, int index) {
+	prefetchFile_t *p = (prefetchFile_t *)data + index;
+
+	p->inflated = FS_InflateZipEntry(p->zipData, p->zipDataLen, p->data, p->len);
+}
+
+/*
+=================
+FS_Prefetch
+
+Inflates the deflated pak entries of a list of files on fs_prefetchThreads
+threads, so the FS_ReadFile or FS_FOpenFileRead calls that follow for them
+only have to copy.  dir is prepended to the names if it isn't NULL.  The
+files are kept in memory up to fs_prefetchMegs until they are opened or the
+next FS_Prefetch call.
+=================
+*/
+void FS_Prefetch(const char *dir, char **names, int count) {
+	char filename[MAX_ZPATH];
+	fileInPack_t *pakFile;
+	prefetchFile_t *p;
+	pack_t *pak;
+	qboolean deflated;
+	int64_t budget;
+	int i, j, start;
+
+	if (!fs_searchpaths) {
+		Com_Error(ERR_FATAL, "Filesystem call made without initialization");
+	}
+
+	FS_FlushPrefetch();
+
+	if (fs_prefetchThreads->integer <= 0 || fs_prefetchMegs->integer <= 0)
+		return;
+
+	start = Sys_Milliseconds();
+	budget = (int64_t)fs_prefetchMegs->integer << 20;
+
+	for (i = 0; i < count && fs_numPrefetchFiles < MAX_PREFETCH_FILES; i++) {
+		// inline models, player sounds and such
+		if (!names[i][0] || names[i][0] == '*')
+			continue;
+
+		if (dir)
+			Com_sprintf(filename, sizeof(filename), "%s/%s", dir, names[i]);
+		else
+			Q_strncpyz(filename, names[i], sizeof(filename));
+
+		// configs may come from the journal instead
+		if (strstr(filename, ".cfg"))
+			continue;
+
+		pakFile = FS_PrefetchLookup(filename, &pak);
+		if (!pakFile || !pakFile->len || pakFile->len > budget)
+			continue;
+
+		for (j = 0; j < fs_numPrefetchFiles; j++) {
+			if (fs_prefetchFiles[j].pak == pak && fs_prefetchFiles[j].pos == pakFile->pos)
+				break;
+		}
+		if (j < fs_numPrefetchFiles)
+			continue;
+
+		// stored entries are copied straight from the mapping anyway
+		p = &fs_prefetchFiles[fs_numPrefetchFiles];
+		p->zipData = FS_MappedZipEntry(pak, pakFile, &p->zipDataLen, &deflated);
+		if (!p->zipData || !deflated)
+			continue;
+
+		p->data = malloc(pakFile->len);
+		if (!p->data)
+			break;
+
+		p->pak = pak;
+		p->pos = pakFile->pos;
+		p->len = pakFile->len;
+		p->inflated = qfalse;
+		budget -= p->len;
+		fs_numPrefetchFiles++;
+	}
+
+	Com_RunJobs(FS_PrefetchJob, fs_prefetchFiles, fs_numPrefetchFiles, fs_prefetchThreads->integer);
+
+	// corrupt entries are left to the regular path to complain about
+	for (i = 0, p = fs_prefetchFiles; i < fs_numPrefetchFiles; i++, p++) {
+		if (!p->inflated) {
+			free(p->data);
+			p->data = NULL;
+		}
+	}
+
+	if (fs_debug->integer) {
+		Com_Printf("FS_Prefetch: %i of %i files in %i msec\n", fs_numPrefetchFiles, count, Sys_Milliseconds() - start);
+	}
+}
+
+/*
+==========================================================================
+
+ZIP FILE LOADING
+
+==========================================================================
+*/
+
+/*
+=================
+PAK INDEX CACHE
+
+Scanning the central directory of every pk3 dominates FS_Startup with
+many pk3s, so the parsed directories are kept in fs_homepath, keyed on
+the path, size and modification time of each pk3. The pure checksum
+depends on the checksum feed of the server, so the file crcs are stored
+along with the regular checksum, and FS_UpdatePureChecksums hashes them
+again for every feed.
+=================
+*/
+
+#define PAK_INDEX_MAGIC (('X' << 24) | ('D' << 16) | ('I' << 8) | 'P')
+#define PAK_INDEX_VERSION 2
+#define PAK_INDEX_NAME "pakindex.pk3idx"
+#define PAK_INDEX_MAX_LENGTH (256 * 1024 * 1024)
+
+typedef struct {
+	int magic;
+	int version;
+	int numPaks;
+	int length; // of the records following the header
+	unsigned int checksum;
+} pakIndexHeader_t;
+
+// followed by pos[numFiles], len[numFiles], crcs[numCrcs],
+// the path and the nul terminated lower case file names
+typedef struct {
+	int64_t size;
+	int64_t mtime;
+	int numEntries; // in the zip directory
+	int numFiles;
+	int numCrcs;
+	int pathLength;
+	int namesLength;
+	int recordLength;
+	int checksum; // regular checksum of the pk3
+} pakIndexRecord_t;
+
+typedef struct pakIndex_s {
+	struct pakIndex_s *next;
+	pakIndexRecord_t *record;
+	unsigned int *pos;
+	unsigned int *len;
+	int *crcs;
+	char *path;
+	char *names;
+	qboolean used;	// a pk3 was loaded from it during this startup
+	qboolean stale; // the pk3 has changed since
+} pakIndex_t;
+
+static pakIndex_t *fs_pakIndex;
+static void *fs_pakIndexData;
+static qboolean fs_pakIndexActive;
+static qboolean fs_pakIndexModified;
+
+static const char *FS_PakIndexPath(void) {
+	return va("%s%c%s", fs_homepath->string, PATH_SEP, PAK_INDEX_NAME);
+}
+
+static int FS_PakIndexRecordLength(int numFiles, int numCrcs, int pathLength, int namesLength) {
+	return PAD(sizeof(pakIndexRecord_t) + (numFiles * 2 + numCrcs) * sizeof(int) + pathLength + namesLength, 8);
+}
+
+static void FS_SetupPakIndex(pakIndex_t *index, pakIndexRecord_t *record) {
+	index->record = record;
+	index->pos = (unsigned int *)(record + 1);
+	index->len = index->pos + record->numFiles;
+	index->crcs = (int *)(index->len + record->numFiles);
+	index->path = (char *)(index->crcs + record->numCrcs);
+	index->names = index->path + record->pathLength;
+}
+
+/*
+=================
+FS_ValidPakIndex
+
+Sets up an index for a record read from disk, qfalse if the record doesn't fit in length
+=================
+*/
+static qboolean FS_ValidPakIndex(pakIndex_t *index, pakIndexRecord_t *record, int length) {
+	int i, names;
+
+	if (length < sizeof(*record) || record->numEntries < 0 || record->numFiles < 0 ||
+		record->numFiles > record->numEntries || record->numCrcs < 0 || record->numCrcs > record->numFiles ||
+		record->pathLength < 1 || record->pathLength > MAX_OSPATH || record->namesLength < record->numFiles ||
+		record->namesLength > length || record->recordLength > length ||
+		record->recordLength !=
+			FS_PakIndexRecordLength(record->numFiles, record->numCrcs, record->pathLength, record->namesLength)) {
+		return qfalse;
+	}
+
+	FS_SetupPakIndex(index, record);
+
+	if (index->path[record->pathLength - 1])
+		return qfalse;
+
+	// every name has to be terminated within the record
+	for (i = names = 0; i < record->namesLength; i++) {
+		if (!index->names[i])
+			names++;
+	}
+
+	return names == record->numFiles && (!record->namesLength || !index->names[record->namesLength - 1]);
+}
+
+/*
+=================
+FS_FreePakIndex
+=================
+*/
+static void FS_FreePakIndex(void) {
+	pakIndex_t *index, *next;
+
+	for (index = fs_pakIndex; index; index = next) {
+		next = index->next;
+		Z_Free(index);
+	}
+
+	if (fs_pakIndexData)
+		Z_Free(fs_pakIndexData);
+
+	fs_pakIndex = NULL;
+	fs_pakIndexData = NULL;
+	fs_pakIndexActive = qfalse;
+	fs_pakIndexModified = qfalse;
 }
 
 /*
-============
-FS_ReadFileDir
+=================
+FS_LoadPakIndex
 
-Filename are relative to the quake search path
-a null buffer will just return the file length without loading
-If searchPath is non-NULL search only in that specific search path
-============
+Reads the index written by the last FS_Startup, FS_LoadZipFile uses it until FS_SavePakIndex
+=================
 */
-long FS_ReadFileDir(const char *qpath, void *searchPath, qboolean unpure, void **buffer) {
-	fileHandle_t h;
-	searchpath_t *search;
-	byte *buf;
-	qboolean isConfig;
-	long len;
-
-	if (!fs_searchpaths) {
-		Com_Error(ERR_FATAL, "Filesystem call made without initialization");
-	}
-
-	if (!qpath || !qpath[0]) {
-		Com_Error(ERR_FATAL, "FS_ReadFile with empty name");
-	}
+static void FS_LoadPakIndex(void) {
+	pakIndexHeader_t header;
+	pakIndex_t *index;
+	byte *data;
+	FILE *f;
+	int i, ofs;
 
-	buf = NULL; // quiet compiler warning
+	FS_FreePakIndex();
 
-	// if this is a .cfg file and we are playing back a journal, read
-	// it from the journal file
-	if (strstr(qpath, ".cfg")) {
-		isConfig = qtrue;
-		if (com_journal && com_journal->integer == 2) {
-			int r;
+	if (!fs_homepath->string[0])
+		return;
 
-			Com_DPrintf("Loading %s from journal file.\n", qpath);
-			r = FS_Read(&len, sizeof(len), com_journalDataFile);
-			if (r != sizeof(len)) {
-				if (buffer != NULL)
-					*buffer = NULL;
-				return -1;
-			}
-			// if the file didn't exist when the journal was created
-			if (!len) {
-				if (buffer == NULL) {
-					return 1; // hack for old journal files
-				}
-				*buffer = NULL;
-				return -1;
-			}
-			if (buffer == NULL) {
-				return len;
-			}
+	fs_pakIndexActive = qtrue;
 
-			buf = Hunk_AllocateTempMemory(len + 1);
-			*buffer = buf;
+	f = Sys_FOpen(FS_PakIndexPath(), "rb");
+	if (!f)
+		return;
 
-			r = FS_Read(buf, len, com_journalDataFile);
-			if (r != len) {
-				Com_Error(ERR_FATAL, "Read from journalDataFile failed");
-			}
+	if (fread(&header, sizeof(header), 1, f) != 1 || header.magic != PAK_INDEX_MAGIC ||
+		header.version != PAK_INDEX_VERSION || header.numPaks < 0 || header.length < 0 ||
+		header.length > PAK_INDEX_MAX_LENGTH) {
+		fclose(f);
+		Com_DPrintf("Ignoring old %s\n", PAK_INDEX_NAME);
+		return;
+	}
 
-			fs_loadCount++;
-			fs_loadStack++;
+	data = Z_Malloc(header.length + 1);
+	if (fread(data, header.length, 1, f) != 1 || Com_BlockChecksum(data, header.length) != header.checksum) {
+		fclose(f);
+		Z_Free(data);
+		Com_DPrintf("Ignoring corrupt %s\n", PAK_INDEX_NAME);
+		return;
+	}
 
-			// guarantee that it will have a trailing 0 for string operations
-			buf[len] = 0;
+	fclose(f);
+	fs_pakIndexData = data;
 
-			return len;
+	for (i = ofs = 0; i < header.numPaks; i++) {
+		index = Z_Malloc(sizeof(*index));
+		if (!FS_ValidPakIndex(index, (pakIndexRecord_t *)(data + ofs), header.length - ofs)) {
+			Z_Free(index);
+			break;
 		}
-	} else {
-		isConfig = qfalse;
+
+		ofs += index->record->recordLength;
+		index->next = fs_pakIndex;
+		fs_pakIndex = index;
 	}
+}
 
-	search = searchPath;
+/*
+=================
+FS_SavePakIndex
 
-	if (search == NULL) {
-		// look for it in the filesystem or pack files
-		len = FS_FOpenFileRead(qpath, &h, qfalse);
-	} else {
-		// look for it in a specific search path only
-		len = FS_FOpenFileReadDir(qpath, search, &h, qfalse, unpure);
+Writes the index if pk3s had to be scanned, dropping pk3s that are gone or changed
+=================
+*/
+static void FS_SavePakIndex(void) {
+	pakIndexHeader_t header;
+	pakIndex_t *index;
+	char ospath[MAX_OSPATH];
+	char temppath[MAX_OSPATH];
+	int64_t size, mtime;
+	qboolean written;
+	byte *data;
+	FILE *f;
+
+	if (!fs_pakIndexActive || !fs_pakIndexModified) {
+		FS_FreePakIndex();
+		return;
 	}
 
-	if (h == 0) {
-		if (buffer) {
-			*buffer = NULL;
+	Com_Memset(&header, 0, sizeof(header));
+	header.magic = PAK_INDEX_MAGIC;
+	header.version = PAK_INDEX_VERSION;
+
+	// pk3s of other mods are kept as long as they are unchanged
+	for (index = fs_pakIndex; index; index = index->next) {
+		if (!index->stale && !index->used) {
+			index->stale = !Sys_FileInfo(index->path, &size, &mtime) || size != index->record->size ||
+						   mtime != index->record->mtime;
 		}
-		// if we are journalling and it is a config file, write a zero to the journal file
-		if (isConfig && com_journal && com_journal->integer == 1) {
-			Com_DPrintf("Writing zero for %s to journal file.\n", qpath);
-			len = 0;
-			FS_Write(&len, sizeof(len), com_journalDataFile);
-			FS_Flush(com_journalDataFile);
+
+		if (!index->stale) {
+			header.numPaks++;
+			header.length += index->record->recordLength;
 		}
-		return -1;
 	}
 
-	if (!buffer) {
-		if (isConfig && com_journal && com_journal->integer == 1) {
-			Com_DPrintf("Writing len for %s to journal file.\n", qpath);
-			FS_Write(&len, sizeof(len), com_journalDataFile);
-			FS_Flush(com_journalDataFile);
+	data = Z_Malloc(header.length + 1);
+	header.length = 0;
+	for (index = fs_pakIndex; index; index = index->next) {
+		if (!index->stale) {
+			Com_Memcpy(data + header.length, index->record, index->record->recordLength);
+			header.length += index->record->recordLength;
 		}
-		FS_FCloseFile(h);
-		return len;
 	}
+	header.checksum = Com_BlockChecksum(data, header.length);
 
-	fs_loadCount++;
-	fs_loadStack++;
+	FS_FreePakIndex();
 
-	buf = Hunk_AllocateTempMemory(len + 1);
-	*buffer = buf;
+	Q_strncpyz(ospath, FS_PakIndexPath(), sizeof(ospath));
+	Com_sprintf(temppath, sizeof(temppath), "%s.tmp", ospath);
 
-	FS_Read(buf, len, h);
+	f = Sys_FOpen(temppath, "wb");
+	if (!f) {
+		Z_Free(data);
+		Com_DPrintf("Couldn't write %s\n", temppath);
+		return;
+	}
 
-	// guarantee that it will have a trailing 0 for string operations
-	buf[len] = 0;
-	FS_FCloseFile(h);
+	written = fwrite(&header, sizeof(header), 1, f) == 1 && fwrite(data, header.length, 1, f) == 1;
+	if (fclose(f))
+		written = qfalse;
+	Z_Free(data);
 
-	// if we are journalling and it is a config file, write it to the journal file
-	if (isConfig && com_journal && com_journal->integer == 1) {
-		Com_DPrintf("Writing %s to journal file.\n", qpath);
-		FS_Write(&len, sizeof(len), com_journalDataFile);
-		FS_Write(buf, len, com_journalDataFile);
-		FS_Flush(com_journalDataFile);
+	// write the new index aside so a reader never sees half of it
+	remove(ospath);
+	if (!written || rename(temppath, ospath)) {
+		remove(temppath);
+		Com_DPrintf("Couldn't write %s\n", ospath);
 	}
-	return len;
 }
 
 /*
-============
-FS_ReadFile
-
-Filename are relative to the quake search path
-a null buffer will just return the file length without loading
-============
-*/
-long FS_ReadFile(const char *qpath, void **buffer) {
-	return FS_ReadFileDir(qpath, NULL, qfalse, buffer);
-}
+=================
+FS_ScanZipFile
 
-/*
-=============
-FS_FreeFile
-=============
+Reads the zip directory into a new index, which is kept if size is known
+=================
 */
-void FS_FreeFile(void *buffer) {
-	if (!fs_searchpaths) {
-		Com_Error(ERR_FATAL, "Filesystem call made without initialization");
-	}
-	if (!buffer) {
-		Com_Error(ERR_FATAL, "FS_FreeFile( NULL )");
-	}
-	fs_loadStack--;
+static pakIndex_t *FS_ScanZipFile(unzFile uf, unz_global_info *gi, const char *zipfile, qboolean keep,
+								  int64_t size, int64_t mtime) {
+	char filename_inzip[MAX_ZPATH];
+	unz_file_info file_info;
+	pakIndexRecord_t record;
+	pakIndex_t *index;
+	char *namePtr;
+	int i, err;
 
-	Hunk_FreeTempMemory(buffer);
+	Com_Memset(&record, 0, sizeof(record));
+	record.size = size;
+	record.mtime = mtime;
+	record.numEntries = gi->number_entry;
+	record.pathLength = strlen(zipfile) + 1;
 
-	// if all of our temp files are free, clear all of our space
-	if (fs_loadStack == 0) {
-		Hunk_ClearTempMemory();
+	unzGoToFirstFile(uf);
+	for (i = 0; i < gi->number_entry; i++) {
+		err = unzGetCurrentFileInfo(uf, &file_info, filename_inzip, sizeof(filename_inzip), NULL, 0, NULL, 0);
+		if (err != UNZ_OK) {
+			break;
+		}
+		if (file_info.uncompressed_size > 0) {
+			record.numCrcs++;
+		}
+		record.numFiles++;
+		record.namesLength += strlen(filename_inzip) + 1;
+		unzGoToNextFile(uf);
 	}
-}
 
-/*
-============
-FS_WriteFile
+	record.recordLength =
+		FS_PakIndexRecordLength(record.numFiles, record.numCrcs, record.pathLength, record.namesLength);
 
-Filename are relative to the quake search path
-============
-*/
-void FS_WriteFile(const char *qpath, const void *buffer, int size) {
-	fileHandle_t f;
+	index = Z_Malloc(sizeof(*index) + record.recordLength);
+	Com_Memcpy(index + 1, &record, sizeof(record));
+	FS_SetupPakIndex(index, (pakIndexRecord_t *)(index + 1));
+	strcpy(index->path, zipfile);
 
-	if (!fs_searchpaths) {
-		Com_Error(ERR_FATAL, "Filesystem call made without initialization");
-	}
+	namePtr = index->names;
+	record.numCrcs = 0;
+	unzGoToFirstFile(uf);
 
-	if (!qpath || !buffer) {
-		Com_Error(ERR_FATAL, "FS_WriteFile: NULL parameter");
+	for (i = 0; i < record.numFiles; i++) {
+		err = unzGetCurrentFileInfo(uf, &file_info, filename_inzip, sizeof(filename_inzip), NULL, 0, NULL, 0);
+		if (err != UNZ_OK) {
+			break;
+		}
+		if (file_info.uncompressed_size > 0) {
+			index->crcs[record.numCrcs++] = file_info.crc;
+		}
+		Q_strlwr(filename_inzip);
+		strcpy(namePtr, filename_inzip);
+		namePtr += strlen(filename_inzip) + 1;
+		// store the file position in the zip
+		index->pos[i] = unzGetOffset(uf);
+		index->len[i] = file_info.uncompressed_size;
+		unzGoToNextFile(uf);
 	}
 
-	f = FS_FOpenFileWrite(qpath);
-	if (!f) {
-		Com_Printf("Failed to open %s\n", qpath);
-		return;
+	if (keep) {
+		index->next = fs_pakIndex;
+		fs_pakIndex = index;
+		fs_pakIndexModified = qtrue;
 	}
 
-	FS_Write(buffer, size, f);
-
-	FS_FCloseFile(f);
+	return index;
 }
 
 /*
-==========================================================================
+=================
+FS_PureChecksumJob
 
-ZIP FILE LOADING
+Hashes the file crcs of a pak with the current checksum feed
+=================
+*/
+static void FS_PureChecksumJob(void *data, int index) {
+	pack_t *pack = ((pack_t **)data)[index];
 
-==========================================================================
+	pack->headerLongs[0] = LittleLong(fs_checksumFeed);
+	pack->pure_checksum =
+		LittleLong(Com_BlockChecksum(pack->headerLongs, sizeof(*pack->headerLongs) * pack->numHeaderLongs));
+}
+
+/*
+=================
+FS_UpdatePureChecksums
+
+Rehashes the pure checksums of all loaded paks after the checksum feed
+changed, spread over fs_prefetchThreads
+=================
 */
+static void FS_UpdatePureChecksums(void) {
+	searchpath_t *search;
+	pack_t **packs;
+	int numPacks;
+
+	numPacks = 0;
+	for (search = fs_searchpaths; search; search = search->next) {
+		if (search->pack)
+			numPacks++;
+	}
+	if (!numPacks)
+		return;
+
+	packs = Z_Malloc(numPacks * sizeof(*packs));
+	numPacks = 0;
+	for (search = fs_searchpaths; search; search = search->next) {
+		if (search->pack)
+			packs[numPacks++] = search->pack;
+	}
+
+	Com_RunJobs(FS_PureChecksumJob, packs, numPacks, fs_prefetchThreads->integer);
+	Z_Free(packs);
+}
 
 /*
 =================
@@ -1862,42 +3264,47 @@ of a zip file.
 */
 static pack_t *FS_LoadZipFile(const char *zipfile, const char *basename) {
 	fileInPack_t *buildBuffer;
+	pakIndex_t *index = NULL;
 	pack_t *pack;
 	unzFile uf;
 	int err;
 	unz_global_info gi;
-	char filename_inzip[MAX_ZPATH];
-	unz_file_info file_info;
-	int i, len;
+	int64_t size = 0, mtime = 0;
+	qboolean keep;
+	qboolean scanned = qfalse;
+	int i;
 	long hash;
-	int fs_numHeaderLongs;
-	int *fs_headerLongs;
 	char *namePtr;
 
-	fs_numHeaderLongs = 0;
-
 	uf = unzOpen(zipfile);
 	err = unzGetGlobalInfo(uf, &gi);
 
 	if (err != UNZ_OK)
 		return NULL;
 
-	len = 0;
-	unzGoToFirstFile(uf);
-	for (i = 0; i < gi.number_entry; i++) {
-		err = unzGetCurrentFileInfo(uf, &file_info, filename_inzip, sizeof(filename_inzip), NULL, 0, NULL, 0);
-		if (err != UNZ_OK) {
-			break;
+	keep = fs_pakIndexActive && Sys_FileInfo(zipfile, &size, &mtime);
+	if (keep) {
+		for (index = fs_pakIndex; index; index = index->next) {
+			if (index->stale || strcmp(index->path, zipfile))
+				continue;
+
+			if (index->record->size == size && index->record->mtime == mtime &&
+				index->record->numEntries == gi.number_entry)
+				break;
+
+			index->stale = qtrue;
 		}
-		len += strlen(filename_inzip) + 1;
-		unzGoToNextFile(uf);
 	}
 
-	buildBuffer = Z_Malloc((gi.number_entry * sizeof(fileInPack_t)) + len);
-	namePtr = ((char *)buildBuffer) + gi.number_entry * sizeof(fileInPack_t);
-	fs_headerLongs = Z_Malloc((gi.number_entry + 1) * sizeof(int));
-	fs_headerLongs[fs_numHeaderLongs++] = LittleLong(fs_checksumFeed);
+	if (!index) {
+		index = FS_ScanZipFile(uf, &gi, zipfile, keep, size, mtime);
+		scanned = qtrue;
+	}
+	index->used = qtrue;
 
+	buildBuffer = Z_Malloc((index->record->numFiles * sizeof(fileInPack_t)) + index->record->namesLength);
+	namePtr = ((char *)buildBuffer) + index->record->numFiles * sizeof(fileInPack_t);
+	Com_Memcpy(namePtr, index->names, index->record->namesLength);
 	// get the hash table size from the number of files in the zip
 	// because lots of custom pk3 files have less than 32 or 64 files
 	for (i = 1; i <= MAX_FILEHASH_SIZE; i <<= 1) {
@@ -1922,36 +3329,33 @@ static pack_t *FS_LoadZipFile(const char *zipfile, const char *basename) {
 	}
 
 	pack->handle = uf;
-	pack->numfiles = gi.number_entry;
-	unzGoToFirstFile(uf);
+	pack->numfiles = index->record->numFiles;
 
-	for (i = 0; i < gi.number_entry; i++) {
-		err = unzGetCurrentFileInfo(uf, &file_info, filename_inzip, sizeof(filename_inzip), NULL, 0, NULL, 0);
-		if (err != UNZ_OK) {
-			break;
-		}
-		if (file_info.uncompressed_size > 0) {
-			fs_headerLongs[fs_numHeaderLongs++] = LittleLong(file_info.crc);
-		}
-		Q_strlwr(filename_inzip);
-		hash = FS_HashFileName(filename_inzip, pack->hashSize);
+	for (i = 0; i < index->record->numFiles; i++) {
+		hash = FS_HashFileName(namePtr, pack->hashSize);
 		buildBuffer[i].name = namePtr;
-		strcpy(buildBuffer[i].name, filename_inzip);
-		namePtr += strlen(filename_inzip) + 1;
-		// store the file position in the zip
-		buildBuffer[i].pos = unzGetOffset(uf);
-		buildBuffer[i].len = file_info.uncompressed_size;
+		namePtr += strlen(namePtr) + 1;
+		buildBuffer[i].pos = index->pos[i];
+		buildBuffer[i].len = index->len[i];
 		buildBuffer[i].next = pack->hashTable[hash];
 		pack->hashTable[hash] = &buildBuffer[i];
-		unzGoToNextFile(uf);
 	}
 
-	pack->checksum = Com_BlockChecksum(&fs_headerLongs[1], sizeof(*fs_headerLongs) * (fs_numHeaderLongs - 1));
-	pack->pure_checksum = Com_BlockChecksum(fs_headerLongs, sizeof(*fs_headerLongs) * fs_numHeaderLongs);
-	pack->checksum = LittleLong(pack->checksum);
-	pack->pure_checksum = LittleLong(pack->pure_checksum);
+	// the feed goes in first when the pure checksum is computed
+	pack->numHeaderLongs = index->record->numCrcs + 1;
+	pack->headerLongs = Z_Malloc(pack->numHeaderLongs * sizeof(int));
+	for (i = 0; i < index->record->numCrcs; i++) {
+		pack->headerLongs[i + 1] = LittleLong(index->crcs[i]);
+	}
+
+	if (scanned) {
+		index->record->checksum = LittleLong(
+			Com_BlockChecksum(&pack->headerLongs[1], sizeof(*pack->headerLongs) * (pack->numHeaderLongs - 1)));
+	}
+	pack->checksum = index->record->checksum;
 
-	Z_Free(fs_headerLongs);
+	if (!keep)
+		Z_Free(index);
 
 	pack->buildBuffer = buildBuffer;
 	return pack;
@@ -1967,7 +3371,10 @@ Frees a pak structure and releases all associated resources
 
 static void FS_FreePak(pack_t *thepak) {
 	unzClose(thepak->handle);
+	if (thepak->map)
+		Sys_UnmapFile(thepak->map, thepak->mapLength);
 	Z_Free(thepak->buildBuffer);
+	Z_Free(thepak->headerLongs);
 	Z_Free(thepak);
 }
 
@@ -3052,6 +4459,10 @@ void FS_Shutdown(qboolean closemfp) {
 		}
 	}
 
+	FS_StopWriteThread();
+	FS_FlushPrefetch();
+	FS_FreeFileIndex();
+
 	// free everything
 	for (p = fs_searchpaths; p; p = next) {
 		next = p->next;
@@ -3132,6 +4543,13 @@ static void FS_Startup(const char *gameName) {
 	fs_packFiles = 0;
 
 	fs_debug = Cvar_Get("fs_debug", "0", 0);
+	fs_mmap = Cvar_Get("fs_mmap", sizeof(void *) > 4 ? "1" : "0", CVAR_INIT);
+	fs_writeThread = Cvar_Get("fs_writeThread", "1", CVAR_ARCHIVE);
+	Cvar_SetDescription(fs_writeThread, "Do the file writes of the game module on a thread");
+	fs_prefetchThreads = Cvar_Get("fs_prefetchThreads", "4", CVAR_ARCHIVE);
+	Cvar_CheckRange(fs_prefetchThreads, 0, MAX_JOB_THREADS, qtrue);
+	fs_prefetchMegs = Cvar_Get("fs_prefetchMegs", "64", CVAR_ARCHIVE);
+	Cvar_CheckRange(fs_prefetchMegs, 0, 1024, qtrue);
 	fs_basepath = Cvar_Get("fs_basepath", Sys_DefaultInstallPath(), CVAR_INIT | CVAR_PROTECTED);
 	fs_basegame = Cvar_Get("fs_basegame", "", CVAR_INIT);
 	homePath = Sys_DefaultHomePath();
@@ -3162,6 +4580,8 @@ static void FS_Startup(const char *gameName) {
 		Com_Error(ERR_DROP, "Invalid fs_game '%s'", fs_gamedirvar->string);
 	}
 
+	FS_LoadPakIndex();
+
 	// add search path elements in reverse priority order
 	fs_gogpath = Cvar_Get("fs_gogpath", Sys_GogPath(), CVAR_INIT | CVAR_PROTECTED);
 	if (fs_gogpath->string[0]) {
@@ -3221,6 +4641,9 @@ static void FS_Startup(const char *gameName) {
 		}
 	}
 
+	FS_SavePakIndex();
+	FS_UpdatePureChecksums();
+
 	// add our commands
 	Cmd_AddCommand("path", FS_Path_f);
 	Cmd_AddCommand("dir", FS_Dir_f);
@@ -3231,6 +4654,7 @@ static void FS_Startup(const char *gameName) {
 	// https://zerowing.idsoftware.com/bugzilla/show_bug.cgi?id=506
 	// reorder the pure pk3 files according to server order
 	FS_ReorderPurePaks();
+	FS_BuildFileIndex();
 
 	// print the current search paths
 	FS_Path_f();
@@ -3680,10 +5104,24 @@ qboolean FS_ConditionalRestart(int checksumFeed, qboolean disconnect) {
 			fs_gamedirvar->modified = qfalse;
 	}
 
-	if (checksumFeed != fs_checksumFeed)
-		FS_Restart(checksumFeed);
-	else if (fs_numServerPaks && !fs_reordered)
+	if (checksumFeed != fs_checksumFeed) {
+		// a search order reordered for another server needs a restart to
+		// be put back, otherwise the paks stay the same and only their
+		// pure checksums change
+		if (fs_reordered) {
+			FS_Restart(checksumFeed);
+			return qfalse;
+		}
+
+		fs_checksumFeed = checksumFeed;
+		FS_ClearPakReferences(0);
+		FS_UpdatePureChecksums();
+	}
+
+	if (fs_numServerPaks && !fs_reordered) {
 		FS_ReorderPurePaks();
+		FS_BuildFileIndex();
+	}
 
 	return qfalse;
 }
@@ -3743,15 +5181,16 @@ int FS_FOpenFileByMode(const char *qpath, fileHandle_t *f, fsMode_t mode) {
 int FS_FTell(fileHandle_t f) {
 	int pos;
 	if (fsh[f].zipFile == qtrue) {
-		pos = unztell(fsh[f].handleFiles.file.z);
+		FS_StreamZipEntry(f);
+		pos = fsh[f].zipData ? fsh[f].zipDataPos : unztell(fsh[f].handleFiles.file.z);
 	} else {
-		pos = ftell(fsh[f].handleFiles.file.o);
+		pos = ftell(FS_FileForHandle(f));
 	}
 	return pos;
 }
 
 void FS_Flush(fileHandle_t f) {
-	fflush(fsh[f].handleFiles.file.o);
+	fflush(FS_FileForHandle(f));
 }
 
 void FS_FilenameCompletion(const char *dir, const char **ext, int cnt, qboolean stripExt,
@@ -0,0 +1,452 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+// hitch.c -- a watchdog thread that catches the main thread in slow frames
+
+#include "q_shared.h"
+#include "qcommon.h"
+
+/*
+=============================================================================
+
+With com_hitchThreshold set, a watchdog thread checks a few times per
+threshold whether the main thread's frame has run longer than that.  When
+it has, the main thread is interrupted while it is still stuck and records
+the profiler zones it has open, the call stack of the running VM and the
+last few events it handled.  The report is written once the frame is over,
+to the console and to hitch/ in the game directory.
+
+Platforms that can't interrupt threads sample from the watchdog instead,
+which sees compiled VMs without their stack.
+
+=============================================================================
+*/
+
+#define HITCH_EVENTS 32
+#define HITCH_REPORT_MSEC 10000 // reports are at least this far apart
+
+typedef struct {
+	int msec; // Sys_Milliseconds when it was handled
+	int type; // sysEventType_t or HITCH_PACKET
+	int value, value2;
+	netadr_t from;
+} hitchEvent_t;
+
+typedef struct {
+	int frame;
+	int sampleMsec; // Sys_Milliseconds when it was taken
+	int stallMsec;	// how long the frame had been running
+
+	int numZones;
+	const char *zones[PROFILE_MAX_DEPTH];
+
+	vmSample_t vm;
+
+	int numEvents;
+	hitchEvent_t events[HITCH_EVENTS]; // oldest first
+} hitchSample_t;
+
+typedef enum {
+	HITCH_IDLE,	  // the watchdog may ask for a sample
+	HITCH_WANTED, // the watchdog asked, the main thread takes it when interrupted
+	HITCH_TAKEN	  // waiting for the frame to end to be reported
+} hitchState_t;
+
+static cvar_t *com_hitchThreshold;
+
+static sysThread_t *hitchThread;
+static sysMutex_t *hitchMutex;
+static sysCond_t *hitchCond;
+static qboolean hitchInterrupts; // the main thread can be interrupted
+
+// shared with the watchdog, under hitchMutex
+static qboolean hitchQuit;
+static int hitchThresholdMsec;
+static int hitchFrame;
+static int hitchFrameStart;
+static qboolean hitchBusy; // between Com_HitchFrameBegin and Com_HitchFrameEnd
+static int hitchSampledFrame;
+
+// also written by the interrupt handler, which runs on the main thread
+static volatile hitchState_t hitchState;
+static hitchSample_t hitchSample;
+
+// main thread only
+static hitchEvent_t hitchEvents[HITCH_EVENTS];
+static volatile unsigned int hitchNumEvents;
+static int hitchLastReport = -HITCH_REPORT_MSEC;
+static int hitchSkipped;
+
+/*
+=================
+Com_HitchTake
+
+Fills in the sample the watchdog asked for.  Runs in a signal handler on
+the main thread, or on the watchdog where that isn't possible, so it only
+copies memory.
+=================
+*/
+static void Com_HitchTake(void *pc, void *sp) {
+	hitchSample_t *hs = &hitchSample;
+	unsigned int numEvents, i;
+
+	if (hitchState != HITCH_WANTED) {
+		return;
+	}
+
+	hs->numZones = Com_ProfileMainZones(hs->zones, PROFILE_MAX_DEPTH);
+	VM_Sample(&hs->vm, pc, sp);
+
+	numEvents = hitchNumEvents;
+	i = numEvents > HITCH_EVENTS ? numEvents - HITCH_EVENTS : 0;
+	for (hs->numEvents = 0; i < numEvents; i++) {
+		hs->events[hs->numEvents++] = hitchEvents[i % HITCH_EVENTS];
+	}
+
+	hitchState = HITCH_TAKEN;
+}
+
+/*
+=================
+Com_HitchThread
+=================
+*/
+static void Com_HitchThread(void *data) {
+	int now, pollUsec;
+
+	Sys_LockMutex(hitchMutex);
+
+	while (!hitchQuit) {
+		// a hitch is caught at most a quarter of the threshold late
+		pollUsec = hitchThresholdMsec * 250;
+		Sys_TimedWaitCond(hitchCond, hitchMutex, MAX(pollUsec, 1000));
+
+		if (hitchQuit || !hitchBusy || hitchState != HITCH_IDLE || hitchSampledFrame == hitchFrame) {
+			continue;
+		}
+
+		now = Sys_Milliseconds();
+		if (now - hitchFrameStart < hitchThresholdMsec) {
+			continue;
+		}
+
+		hitchSampledFrame = hitchFrame;
+		hitchSample.frame = hitchFrame;
+		hitchSample.sampleMsec = now;
+		hitchSample.stallMsec = now - hitchFrameStart;
+		hitchState = HITCH_WANTED;
+
+		if (!hitchInterrupts || !Sys_InterruptThread()) {
+			Com_HitchTake(NULL, NULL);
+		}
+	}
+
+	Sys_UnlockMutex(hitchMutex);
+}
+
+/*
+=================
+Com_HitchStart
+=================
+*/
+static void Com_HitchStart(void) {
+	if (hitchThread) {
+		Sys_LockMutex(hitchMutex);
+		hitchThresholdMsec = com_hitchThreshold->integer;
+		Sys_UnlockMutex(hitchMutex);
+		return;
+	}
+
+	hitchMutex = Sys_CreateMutex();
+	hitchCond = Sys_CreateCond();
+	if (!hitchMutex || !hitchCond) {
+		Com_Printf(S_COLOR_YELLOW "WARNING: failed to create the hitch watchdog\n");
+		if (hitchCond) {
+			Sys_DestroyCond(hitchCond);
+			hitchCond = NULL;
+		}
+		if (hitchMutex) {
+			Sys_DestroyMutex(hitchMutex);
+			hitchMutex = NULL;
+		}
+		return;
+	}
+
+	hitchQuit = qfalse;
+	hitchThresholdMsec = com_hitchThreshold->integer;
+	hitchBusy = qfalse;
+	hitchState = HITCH_IDLE;
+	hitchNumEvents = 0;
+
+	// the zones are only followed while someone looks at them
+	com_profiling |= PROFILE_WATCH;
+	hitchInterrupts = Sys_SetInterruptCallback(Com_HitchTake);
+
+	hitchThread = Sys_CreateThread(Com_HitchThread, NULL);
+	if (!hitchThread) {
+		Com_Printf(S_COLOR_YELLOW "WARNING: failed to create the hitch watchdog\n");
+		Sys_SetInterruptCallback(NULL);
+		com_profiling &= ~PROFILE_WATCH;
+		Sys_DestroyCond(hitchCond);
+		Sys_DestroyMutex(hitchMutex);
+		hitchCond = NULL;
+		hitchMutex = NULL;
+	}
+}
+
+/*
+=================
+Com_ShutdownHitch
+=================
+*/
+void Com_ShutdownHitch(void) {
+	if (!hitchThread) {
+		return;
+	}
+
+	Sys_LockMutex(hitchMutex);
+	hitchQuit = qtrue;
+	Sys_SignalCond(hitchCond);
+	Sys_UnlockMutex(hitchMutex);
+
+	Sys_JoinThread(hitchThread);
+	hitchThread = NULL;
+
+	Sys_SetInterruptCallback(NULL);
+	com_profiling &= ~PROFILE_WATCH;
+	hitchState = HITCH_IDLE;
+
+	Sys_DestroyCond(hitchCond);
+	Sys_DestroyMutex(hitchMutex);
+	hitchCond = NULL;
+	hitchMutex = NULL;
+}
+
+/*
+=================
+Com_HitchEventString
+=================
+*/
+static const char *Com_HitchEventString(const hitchEvent_t *ev) {
+	switch (ev->type) {
+	case HITCH_PACKET:
+		return va("packet from %s, %i bytes", NET_AdrToStringwPort(ev->from), ev->value);
+	case SE_KEY:
+		return va("key %i %s", ev->value, ev->value2 ? "down" : "up");
+	case SE_CHAR:
+		return va("char %i", ev->value);
+	case SE_MOUSE:
+		return va("mouse %i %i", ev->value, ev->value2);
+	case SE_JOYSTICK_AXIS:
+		return va("joystick axis %i %i", ev->value, ev->value2);
+	case SE_CONSOLE:
+		return "console command";
+	default:
+		return va("event %i", ev->type);
+	}
+}
+
+/*
+=================
+Com_HitchReport
+
+Prints a line about the sampled frame and writes the whole sample to its
+own file, frameMsec is -1 if the frame was aborted by an error
+=================
+*/
+static void Com_HitchReport(int frameMsec) {
+	const hitchSample_t *hs = &hitchSample;
+	char zones[MAX_STRING_CHARS];
+	char fileName[MAX_QPATH];
+	const char *vm;
+	fileHandle_t f;
+	qtime_t now;
+	int i;
+
+	if (hs->sampleMsec - hitchLastReport < HITCH_REPORT_MSEC) {
+		hitchSkipped++;
+		return;
+	}
+	hitchLastReport = hs->sampleMsec;
+
+	zones[0] = '\0';
+	for (i = 0; i < hs->numZones; i++) {
+		Q_strcat(zones, sizeof(zones), va("%s%s", i ? " > " : "", hs->zones[i]));
+	}
+	if (!zones[0]) {
+		Q_strncpyz(zones, "no zone", sizeof(zones));
+	}
+
+	vm = "";
+	if (hs->vm.vmIndex >= 0) {
+		vm = va(", vm %s%s%s", VM_SampleName(&hs->vm), hs->vm.depth ? " " : "",
+				hs->vm.depth ? VM_SampleSymbol(&hs->vm, 0) : "");
+	}
+
+	if (frameMsec >= 0) {
+		Com_Printf(S_COLOR_YELLOW "Hitch: frame took %i msec, in %s%s\n", frameMsec, zones, vm);
+	} else {
+		Com_Printf(S_COLOR_YELLOW "Hitch: aborted frame, in %s%s\n", zones, vm);
+	}
+
+	Com_RealTime(&now);
+	Com_sprintf(fileName, sizeof(fileName), "hitch/hitch_%04d%02d%02d_%02d%02d%02d.txt", 1900 + now.tm_year,
+				1 + now.tm_mon, now.tm_mday, now.tm_hour, now.tm_min, now.tm_sec);
+
+	f = FS_FOpenFileWrite(fileName);
+	if (!f) {
+		Com_Printf(S_COLOR_YELLOW "WARNING: couldn't open %s\n", fileName);
+		return;
+	}
+
+	FS_Printf(f, "frame %i, ", hs->frame);
+	if (frameMsec >= 0) {
+		FS_Printf(f, "%i msec", frameMsec);
+	} else {
+		FS_Printf(f, "aborted by an error");
+	}
+	FS_Printf(f, ", sampled after %i msec (com_hitchThreshold %i)\n", hs->stallMsec, com_hitchThreshold->integer);
+	if (hitchSkipped) {
+		FS_Printf(f, "%i hitches since the last report weren't reported\n", hitchSkipped);
+		hitchSkipped = 0;
+	}
+
+	FS_Printf(f, "zones: %s\n", zones);
+
+	if (hs->vm.vmIndex >= 0) {
+		FS_Printf(f, "vm: %s\n", VM_SampleName(&hs->vm));
+		for (i = 0; i < hs->vm.depth; i++) {
+			FS_Printf(f, "  %s\n", VM_SampleSymbol(&hs->vm, i));
+		}
+	} else {
+		FS_Printf(f, "vm: none\n");
+	}
+
+	FS_Printf(f, "events, newest last:\n");
+	for (i = 0; i < hs->numEvents; i++) {
+		FS_Printf(f, "  %+6i msec %s\n", hs->events[i].msec - hs->sampleMsec, Com_HitchEventString(&hs->events[i]));
+	}
+
+	FS_FCloseFile(f);
+}
+
+/*
+=================
+Com_HitchFrameBegin
+
+Called by Com_Frame when its work starts, after waiting for the frame
+=================
+*/
+void Com_HitchFrameBegin(void) {
+	if (com_hitchThreshold->modified) {
+		com_hitchThreshold->modified = qfalse;
+		if (com_hitchThreshold->integer > 0) {
+			Com_HitchStart();
+		} else {
+			Com_ShutdownHitch();
+		}
+	}
+
+	if (!hitchThread) {
+		return;
+	}
+
+	// the last frame ended in an ERR_DROP
+	Sys_LockMutex(hitchMutex);
+	hitchBusy = qfalse;
+	Sys_UnlockMutex(hitchMutex);
+	if (hitchState == HITCH_TAKEN) {
+		Com_HitchReport(-1);
+	}
+
+	Sys_LockMutex(hitchMutex);
+	hitchState = HITCH_IDLE;
+	hitchFrame++;
+	hitchFrameStart = Sys_Milliseconds();
+	hitchBusy = qtrue;
+	Sys_UnlockMutex(hitchMutex);
+}
+
+/*
+=================
+Com_HitchFrameEnd
+=================
+*/
+void Com_HitchFrameEnd(void) {
+	int frameMsec;
+
+	if (!hitchThread) {
+		return;
+	}
+
+	Sys_LockMutex(hitchMutex);
+	hitchBusy = qfalse;
+	frameMsec = Sys_Milliseconds() - hitchFrameStart;
+	// an interrupt that is still on its way finds nothing to do
+	if (hitchState == HITCH_WANTED) {
+		hitchState = HITCH_IDLE;
+	}
+	Sys_UnlockMutex(hitchMutex);
+
+	if (hitchState == HITCH_TAKEN) {
+		Com_HitchReport(frameMsec);
+		hitchState = HITCH_IDLE;
+	}
+}
+
+/*
+=================
+Com_HitchEvent
+
+Remembers an event the main thread handled, for the next sample
+=================
+*/
+void Com_HitchEvent(int type, int value, int value2, const netadr_t *from) {
+	hitchEvent_t *ev;
+
+	if (!(com_profiling & PROFILE_WATCH)) {
+		return;
+	}
+
+	ev = &hitchEvents[hitchNumEvents % HITCH_EVENTS];
+	ev->msec = Sys_Milliseconds();
+	ev->type = type;
+	ev->value = value;
+	ev->value2 = value2;
+	if (from) {
+		ev->from = *from;
+	} else {
+		Com_Memset(&ev->from, 0, sizeof(ev->from));
+	}
+	hitchNumEvents++;
+}
+
+/*
+=================
+Com_InitHitch
+=================
+*/
+void Com_InitHitch(void) {
+	com_hitchThreshold = Cvar_Get("com_hitchThreshold", "0", CVAR_ARCHIVE);
+	Cvar_CheckRange(com_hitchThreshold, 0, 10000, qtrue);
+	Cvar_SetDescription(com_hitchThreshold, "Frames that take longer than this many msec are sampled by a watchdog "
+											"thread and reported to hitch/, 0 disables the watchdog");
+}
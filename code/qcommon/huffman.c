@@ -29,14 +29,15 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 static int bloc = 0;
 
+// the offset based functions below never touch bloc, so they can be used
+// to write independent messages from several threads at the same time
 void Huff_putBit(int bit, byte *fout, int *offset) {
-	bloc = *offset;
-	if ((bloc & 7) == 0) {
-		fout[(bloc >> 3)] = 0;
+	int b = *offset;
+	if ((b & 7) == 0) {
+		fout[(b >> 3)] = 0;
 	}
-	fout[(bloc >> 3)] |= bit << (bloc & 7);
-	bloc++;
-	*offset = bloc;
+	fout[(b >> 3)] |= bit << (b & 7);
+	*offset = b + 1;
 }
 
 int Huff_getBloc(void) {
@@ -49,20 +50,20 @@ void Huff_setBloc(int _bloc) {
 
 int Huff_getBit(byte *fin, int *offset) {
 	int t;
-	bloc = *offset;
-	t = (fin[(bloc >> 3)] >> (bloc & 7)) & 0x1;
-	bloc++;
-	*offset = bloc;
+	int b = *offset;
+	t = (fin[(b >> 3)] >> (b & 7)) & 0x1;
+	*offset = b + 1;
 	return t;
 }
 
 /* Add a bit to the output file (buffered) */
-static void add_bit(char bit, byte *fout) {
-	if ((bloc & 7) == 0) {
-		fout[(bloc >> 3)] = 0;
+static void add_bit(char bit, byte *fout, int *offset) {
+	int b = *offset;
+	if ((b & 7) == 0) {
+		fout[(b >> 3)] = 0;
 	}
-	fout[(bloc >> 3)] |= bit << (bloc & 7);
-	bloc++;
+	fout[(b >> 3)] |= bit << (b & 7);
+	*offset = b + 1;
 }
 
 /* Receive one bit from the input file (buffered) */
@@ -301,19 +302,19 @@ void Huff_offsetReceive(node_t *node, int *ch, byte *fin, int *offset, int maxof
 }
 
 /* Send the prefix code for this node */
-static void send(node_t *node, node_t *child, byte *fout, int maxoffset) {
+static void send(node_t *node, node_t *child, byte *fout, int *offset, int maxoffset) {
 	if (node->parent) {
-		send(node->parent, node, fout, maxoffset);
+		send(node->parent, node, fout, offset, maxoffset);
 	}
 	if (child) {
-		if (bloc >= maxoffset) {
-			bloc = maxoffset + 1;
+		if (*offset >= maxoffset) {
+			*offset = maxoffset + 1;
 			return;
 		}
 		if (node->right == child) {
-			add_bit(1, fout);
+			add_bit(1, fout, offset);
 		} else {
-			add_bit(0, fout);
+			add_bit(0, fout, offset);
 		}
 	}
 }
@@ -325,17 +326,15 @@ void Huff_transmit(huff_t *huff, int ch, byte *fout, int maxoffset) {
 		/* node_t hasn't been transmitted, send a NYT, then the symbol */
 		Huff_transmit(huff, NYT, fout, maxoffset);
 		for (i = 7; i >= 0; i--) {
-			add_bit((char)((ch >> i) & 0x1), fout);
+			add_bit((char)((ch >> i) & 0x1), fout, &bloc);
 		}
 	} else {
-		send(huff->loc[ch], NULL, fout, maxoffset);
+		send(huff->loc[ch], NULL, fout, &bloc, maxoffset);
 	}
 }
 
 void Huff_offsetTransmit(huff_t *huff, int ch, byte *fout, int *offset, int maxoffset) {
-	bloc = *offset;
-	send(huff->loc[ch], NULL, fout, maxoffset);
-	*offset = bloc;
+	send(huff->loc[ch], NULL, fout, offset, maxoffset);
 }
 
 void Huff_Decompress(msg_t *mbuf, int offset) {
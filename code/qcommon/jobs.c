@@ -0,0 +1,210 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+// jobs.c -- a small pool of worker threads for data parallel loops
+
+#include "q_shared.h"
+#include "qcommon.h"
+
+typedef struct {
+	sysMutex_t *mutex;
+	sysCond_t *wake; // signaled when a new batch is posted or on shutdown
+	sysCond_t *done; // signaled when the last index of a batch finished
+
+	sysThread_t *threads[MAX_JOB_THREADS];
+	int workerIds[MAX_JOB_THREADS];
+	int numThreads;
+	qboolean failed; // thread creation failed once, run everything inline
+
+	// current batch
+	jobFunc_t func;
+	void *data;
+	int count;
+	int next;
+	int finished;
+	int maxWorkers; // workers with a higher id sit this batch out
+
+	qboolean quit;
+} jobPool_t;
+
+static jobPool_t jobs;
+
+static Q_THREADLOCAL int jobThreadIndex;
+
+/*
+=================
+Com_JobThreadIndex
+=================
+*/
+int Com_JobThreadIndex(void) {
+	return jobThreadIndex;
+}
+
+/*
+=================
+Com_JobWorker
+=================
+*/
+static void Com_JobWorker(void *arg) {
+	const int id = *(int *)arg;
+	int index;
+
+	jobThreadIndex = id + 1;
+
+	Sys_LockMutex(jobs.mutex);
+	for (;;) {
+		while (!jobs.quit && (!jobs.func || jobs.next >= jobs.count || id >= jobs.maxWorkers)) {
+			Sys_WaitCond(jobs.wake, jobs.mutex);
+		}
+		if (jobs.quit) {
+			break;
+		}
+
+		index = jobs.next++;
+		Sys_UnlockMutex(jobs.mutex);
+
+		jobs.func(jobs.data, index);
+		Com_ScratchReset();
+
+		Sys_LockMutex(jobs.mutex);
+		if (++jobs.finished == jobs.count) {
+			Sys_SignalCond(jobs.done);
+		}
+	}
+	Sys_UnlockMutex(jobs.mutex);
+}
+
+/*
+=================
+Com_StartJobWorkers
+
+Grows the pool to the given number of worker threads
+=================
+*/
+static qboolean Com_StartJobWorkers(int numWorkers) {
+	if (jobs.failed) {
+		return qfalse;
+	}
+
+	if (!jobs.mutex) {
+		jobs.mutex = Sys_CreateMutex();
+		jobs.wake = Sys_CreateCond();
+		jobs.done = Sys_CreateCond();
+		if (!jobs.mutex || !jobs.wake || !jobs.done) {
+			Com_Printf(S_COLOR_YELLOW "WARNING: failed to create job pool, running jobs inline\n");
+			jobs.failed = qtrue;
+			return qfalse;
+		}
+	}
+
+	if (numWorkers > MAX_JOB_THREADS) {
+		numWorkers = MAX_JOB_THREADS;
+	}
+
+	while (jobs.numThreads < numWorkers) {
+		jobs.workerIds[jobs.numThreads] = jobs.numThreads;
+		jobs.threads[jobs.numThreads] = Sys_CreateThread(Com_JobWorker, &jobs.workerIds[jobs.numThreads]);
+		if (!jobs.threads[jobs.numThreads]) {
+			Com_Printf(S_COLOR_YELLOW "WARNING: failed to create job thread %i\n", jobs.numThreads);
+			jobs.failed = jobs.numThreads == 0;
+			break;
+		}
+		jobs.numThreads++;
+	}
+
+	return jobs.numThreads > 0;
+}
+
+/*
+=================
+Com_RunJobs
+=================
+*/
+void Com_RunJobs(jobFunc_t func, void *data, int count, int numThreads) {
+	int index;
+
+	if (count <= 0) {
+		return;
+	}
+
+	// the calling thread does its share of the work as well
+	if (numThreads > count) {
+		numThreads = count;
+	}
+	if (numThreads <= 1 || !Com_StartJobWorkers(numThreads - 1)) {
+		for (index = 0; index < count; index++) {
+			func(data, index);
+		}
+		return;
+	}
+
+	Sys_LockMutex(jobs.mutex);
+	jobs.func = func;
+	jobs.data = data;
+	jobs.count = count;
+	jobs.next = 0;
+	jobs.finished = 0;
+	jobs.maxWorkers = numThreads - 1;
+	Sys_BroadcastCond(jobs.wake);
+
+	while (jobs.next < jobs.count) {
+		index = jobs.next++;
+		Sys_UnlockMutex(jobs.mutex);
+
+		func(data, index);
+
+		Sys_LockMutex(jobs.mutex);
+		jobs.finished++;
+	}
+
+	while (jobs.finished < jobs.count) {
+		Sys_WaitCond(jobs.done, jobs.mutex);
+	}
+	jobs.func = NULL;
+	Sys_UnlockMutex(jobs.mutex);
+}
+
+/*
+=================
+Com_ShutdownJobs
+=================
+*/
+void Com_ShutdownJobs(void) {
+	int i;
+
+	if (!jobs.mutex) {
+		return;
+	}
+
+	Sys_LockMutex(jobs.mutex);
+	jobs.quit = qtrue;
+	Sys_BroadcastCond(jobs.wake);
+	Sys_UnlockMutex(jobs.mutex);
+
+	for (i = 0; i < jobs.numThreads; i++) {
+		Sys_JoinThread(jobs.threads[i]);
+	}
+
+	Sys_DestroyCond(jobs.done);
+	Sys_DestroyCond(jobs.wake);
+	Sys_DestroyMutex(jobs.mutex);
+	Com_Memset(&jobs, 0, sizeof(jobs));
+}
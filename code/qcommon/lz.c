@@ -0,0 +1,241 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+// lz.c -- byte oriented LZ77 compression for netchan payloads
+
+#include "q_shared.h"
+#include "qcommon.h"
+
+/*
+The stream is a series of sequences, each one a token byte followed by
+literals and a back reference:
+
+	token		high nibble literal count, low nibble match length - LZ_MIN_MATCH
+	[length]	if a nibble is 15, further bytes are added to it until one is below 255
+	literals
+	offset		two bytes little endian, distance back into the output
+	[length]	extension of the match length
+
+The last sequence only holds literals and ends with the input.
+*/
+
+#define LZ_HASH_BITS 12
+#define LZ_MIN_MATCH 4
+#define LZ_MAX_OFFSET 0xffff
+
+/*
+=================
+LZ_Hash
+=================
+*/
+static ID_INLINE int LZ_Hash(const byte *p) {
+	unsigned int v = p[0] | (p[1] << 8) | (p[2] << 16) | ((unsigned int)p[3] << 24);
+
+	return (v * 2654435761u) >> (32 - LZ_HASH_BITS);
+}
+
+/*
+=================
+LZ_WriteLength
+=================
+*/
+static byte *LZ_WriteLength(byte *op, int length) {
+	for (length -= 15; length >= 255; length -= 255) {
+		*op++ = 255;
+	}
+	*op++ = length;
+	return op;
+}
+
+/*
+=================
+LZ_WriteSequence
+
+Returns NULL if the sequence does not fit
+=================
+*/
+static byte *LZ_WriteSequence(byte *op, const byte *oend, const byte *literals, int literalLength, int offset,
+							  int matchLength) {
+	byte *token;
+
+	// worst case size, a few bytes of slack are fine
+	if (oend - op < 1 + literalLength + literalLength / 255 + 1 + 2 + matchLength / 255 + 1) {
+		return NULL;
+	}
+
+	token = op++;
+	if (literalLength >= 15) {
+		*token = 15 << 4;
+		op = LZ_WriteLength(op, literalLength);
+	} else {
+		*token = literalLength << 4;
+	}
+	Com_Memcpy(op, literals, literalLength);
+	op += literalLength;
+
+	if (!matchLength) {
+		return op;
+	}
+
+	*op++ = offset & 0xff;
+	*op++ = offset >> 8;
+	matchLength -= LZ_MIN_MATCH;
+	if (matchLength >= 15) {
+		*token |= 15;
+		op = LZ_WriteLength(op, matchLength);
+	} else {
+		*token |= matchLength;
+	}
+	return op;
+}
+
+/*
+=================
+LZ_Compress
+
+Returns the compressed length, or 0 if it would not fit in outSize
+=================
+*/
+int LZ_Compress(const byte *in, int inLen, byte *out, int outSize) {
+	int table[1 << LZ_HASH_BITS];
+	const byte *iend = in + inLen;
+	const byte *ip, *anchor, *match;
+	byte *op = out;
+	const byte *oend = out + outSize;
+	int h, ref, length;
+
+	for (h = 0; h < (1 << LZ_HASH_BITS); h++) {
+		table[h] = -1;
+	}
+
+	ip = anchor = in;
+	while (iend - ip >= LZ_MIN_MATCH) {
+		h = LZ_Hash(ip);
+		ref = table[h];
+		table[h] = ip - in;
+
+		if (ref < 0 || (ip - in) - ref > LZ_MAX_OFFSET || memcmp(in + ref, ip, LZ_MIN_MATCH)) {
+			ip++;
+			continue;
+		}
+
+		match = in + ref;
+		for (length = LZ_MIN_MATCH; ip + length < iend && match[length] == ip[length]; length++) {
+		}
+
+		op = LZ_WriteSequence(op, oend, anchor, ip - anchor, ip - match, length);
+		if (!op) {
+			return 0;
+		}
+
+		ip += length;
+		anchor = ip;
+	}
+
+	op = LZ_WriteSequence(op, oend, anchor, iend - anchor, 0, 0);
+	if (!op) {
+		return 0;
+	}
+
+	return op - out;
+}
+
+/*
+=================
+LZ_ReadLength
+
+Returns -1 if the input ends inside the length
+=================
+*/
+static int LZ_ReadLength(const byte **ip, const byte *iend, int length) {
+	int b;
+
+	if (length != 15) {
+		return length;
+	}
+
+	do {
+		if (*ip >= iend) {
+			return -1;
+		}
+		b = *(*ip)++;
+		length += b;
+	} while (b == 255);
+
+	return length;
+}
+
+/*
+=================
+LZ_Decompress
+
+Returns the decompressed length, or -1 if the input is corrupt or
+does not fit in outSize
+=================
+*/
+int LZ_Decompress(const byte *in, int inLen, byte *out, int outSize) {
+	const byte *ip = in;
+	const byte *iend = in + inLen;
+	byte *op = out;
+	byte *oend = out + outSize;
+	const byte *match;
+	int token, length, offset;
+
+	while (ip < iend) {
+		token = *ip++;
+
+		length = LZ_ReadLength(&ip, iend, token >> 4);
+		if (length < 0 || length > iend - ip || length > oend - op) {
+			return -1;
+		}
+		Com_Memcpy(op, ip, length);
+		ip += length;
+		op += length;
+
+		// the last sequence has no match
+		if (ip == iend) {
+			break;
+		}
+
+		if (iend - ip < 2) {
+			return -1;
+		}
+		offset = ip[0] | (ip[1] << 8);
+		ip += 2;
+		if (!offset || offset > op - out) {
+			return -1;
+		}
+
+		length = LZ_ReadLength(&ip, iend, token & 15);
+		if (length < 0 || length + LZ_MIN_MATCH > oend - op) {
+			return -1;
+		}
+		length += LZ_MIN_MATCH;
+
+		// the copy may overlap its own output
+		match = op - offset;
+		while (length--) {
+			*op++ = *match++;
+		}
+	}
+
+	return op - out;
+}
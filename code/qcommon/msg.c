@@ -22,7 +22,9 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "q_shared.h"
 #include "qcommon.h"
 
-static huffman_t msgHuff;
+#if idx64
+#include <emmintrin.h>
+#endif
 
 static qboolean msgInit = qfalse;
 
@@ -94,6 +96,204 @@ void MSG_Copy(msg_t *buf, byte *data, int length, msg_t *src) {
 /*
 =============================================================================
 
+huffman lookup tables
+
+The tree is fixed once MSG_initHuffman has run, so whole symbols can be
+read and written through tables instead of walking the tree a bit at a
+time.  Codes that do not fit the tables still go through huffman.c.
+
+=============================================================================
+*/
+
+#define HUFF_LOOKUP_BITS 11
+#define HUFF_LOOKUP_SIZE (1 << HUFF_LOOKUP_BITS)
+
+typedef struct {
+	short symbol;
+	short length; // 0 if the code is longer than HUFF_LOOKUP_BITS
+} huffLookup_t;
+
+typedef struct {
+	unsigned code; // in stream order, first bit in bit 0
+	int length;	   // 0 if the code is longer than 32 bits
+} huffCode_t;
+
+typedef struct {
+	huffman_t huff;
+	huffLookup_t lookup[HUFF_LOOKUP_SIZE];
+	huffCode_t codes[HMAX];
+} msgHuffTable_t;
+
+// MSG_HUFF_DEFAULT is trained on original Q3 traffic, MSG_HUFF_ALTERNATE
+// is the table loaded by MSG_LoadHuffTable, if any
+static msgHuffTable_t msgHuffTables[MSG_HUFF_TABLES];
+static int msgHuffVersion;
+
+/*
+==================
+MSG_BuildHuffLookup
+
+Fills in every table index that starts with the codes of the subtree
+==================
+*/
+static void MSG_BuildHuffLookup(huffLookup_t *lookup, const node_t *node, unsigned code, int length) {
+	int i;
+
+	if (!node) {
+		return;
+	}
+
+	if (node->symbol != INTERNAL_NODE) {
+		for (i = code; i < HUFF_LOOKUP_SIZE; i += 1 << length) {
+			lookup[i].symbol = node->symbol;
+			lookup[i].length = length;
+		}
+		return;
+	}
+
+	if (length == HUFF_LOOKUP_BITS) {
+		return; // longer codes are left to Huff_offsetReceive
+	}
+
+	MSG_BuildHuffLookup(lookup, node->left, code, length + 1);
+	MSG_BuildHuffLookup(lookup, node->right, code | (1 << length), length + 1);
+}
+
+/*
+==================
+MSG_BuildHuffTables
+==================
+*/
+static void MSG_BuildHuffTables(msgHuffTable_t *table) {
+	const node_t *node;
+	unsigned code;
+	int i, length;
+
+	Com_Memset(table->lookup, 0, sizeof(table->lookup));
+	MSG_BuildHuffLookup(table->lookup, table->huff.decompressor.tree, 0, 0);
+
+	for (i = 0; i < HMAX; i++) {
+		table->codes[i].code = 0;
+		table->codes[i].length = 0;
+
+		// walk up from the leaf, the code comes out back to front
+		code = 0;
+		length = 0;
+		for (node = table->huff.compressor.loc[i]; node && node->parent; node = node->parent) {
+			if (length == 32) {
+				break;
+			}
+			code = (code << 1) | (node->parent->right == node);
+			length++;
+		}
+		if (!node || node->parent) {
+			continue;
+		}
+
+		table->codes[i].code = code;
+		table->codes[i].length = length;
+	}
+}
+
+/*
+==================
+MSG_HuffWriteSymbol
+
+Huff_offsetTransmit through the code table, or the plain byte for
+raw messages
+==================
+*/
+static void MSG_HuffWriteSymbol(msg_t *msg, int ch) {
+	msgHuffTable_t *table = &msgHuffTables[msg->huffTable];
+	const huffCode_t *hc = &table->codes[ch];
+	unsigned code;
+	int length, bit, shift, n;
+
+	if (msg->symbolCounts) {
+		msg->symbolCounts[ch]++;
+	}
+
+	if (msg->raw) {
+		code = ch;
+		length = 8;
+		if (msg->bit + length > msg->maxsize << 3) {
+			msg->bit += length; // the caller flags the overflow
+			return;
+		}
+	} else if (!hc->length || msg->bit + hc->length > msg->maxsize << 3) {
+		Huff_offsetTransmit(&table->huff.compressor, ch, msg->data, &msg->bit, msg->maxsize << 3);
+		return;
+	} else {
+		code = hc->code;
+		length = hc->length;
+	}
+
+	bit = msg->bit;
+	while (length) {
+		shift = bit & 7;
+		if (!shift) {
+			msg->data[bit >> 3] = 0;
+		}
+		n = 8 - shift;
+		if (n > length) {
+			n = length;
+		}
+		msg->data[bit >> 3] |= (code & ((1 << n) - 1)) << shift;
+		code >>= n;
+		length -= n;
+		bit += n;
+	}
+	msg->bit = bit;
+}
+
+/*
+==================
+MSG_HuffReadSymbol
+
+Huff_offsetReceive through the lookup table, or the plain byte for
+raw messages
+==================
+*/
+static int MSG_HuffReadSymbol(msg_t *msg) {
+	msgHuffTable_t *table = &msgHuffTables[msg->huffTable];
+	const huffLookup_t *hl;
+	const byte *p;
+	unsigned peek;
+	int bit, maxoffset, get;
+
+	bit = msg->bit;
+	maxoffset = msg->cursize << 3;
+
+	if (msg->raw) {
+		msg->bit = bit + 8; // the caller catches reads past the end
+		if (bit + 8 > maxoffset) {
+			return 0;
+		}
+		p = &msg->data[bit >> 3];
+		if (!(bit & 7)) {
+			return p[0];
+		}
+		return ((p[0] | (p[1] << 8)) >> (bit & 7)) & 0xff;
+	}
+
+	// never look past the end of the buffer
+	if ((bit >> 3) + 3 <= msg->maxsize) {
+		p = &msg->data[bit >> 3];
+		peek = (p[0] | (p[1] << 8) | (p[2] << 16)) >> (bit & 7);
+		hl = &table->lookup[peek & (HUFF_LOOKUP_SIZE - 1)];
+		if (hl->length && bit + hl->length <= maxoffset) {
+			msg->bit = bit + hl->length;
+			return hl->symbol;
+		}
+	}
+
+	Huff_offsetReceive(table->huff.decompressor.tree, &get, msg->data, &msg->bit, maxoffset);
+	return get;
+}
+
+/*
+=============================================================================
+
 bit functions
 
 =============================================================================
@@ -157,7 +357,7 @@ void MSG_WriteBits(msg_t *msg, int value, int bits) {
 		}
 		if (bits) {
 			for (i = 0; i < bits; i += 8) {
-				Huff_offsetTransmit(&msgHuff.compressor, (value & 0xff), msg->data, &msg->bit, msg->maxsize << 3);
+				MSG_HuffWriteSymbol(msg, value & 0xff);
 				value = (value >> 8);
 
 				if (msg->bit > msg->maxsize << 3) {
@@ -170,6 +370,37 @@ void MSG_WriteBits(msg_t *msg, int value, int bits) {
 	}
 }
 
+/*
+=================
+MSG_WriteBitStream
+
+Appends bits that were already encoded into another bitstream message.
+The huffman tables are fixed, so an encoded run of bits can be copied
+into any other message at any bit offset.
+=================
+*/
+void MSG_WriteBitStream(msg_t *msg, const byte *data, int offset, int bits) {
+	int i;
+
+	if (msg->overflowed) {
+		return;
+	}
+
+	if (msg->oob || msg->raw) {
+		Com_Error(ERR_DROP, "MSG_WriteBitStream: not a huffman bitstream message");
+	}
+
+	if (msg->bit + bits > msg->maxsize << 3) {
+		msg->overflowed = qtrue;
+		return;
+	}
+
+	for (i = offset; i < offset + bits; i++) {
+		Huff_putBit((data[i >> 3] >> (i & 7)) & 1, msg->data, &msg->bit);
+	}
+	msg->cursize = (msg->bit >> 3) + 1;
+}
+
 int MSG_ReadBits(msg_t *msg, int bits) {
 	int value;
 	int get;
@@ -229,7 +460,7 @@ int MSG_ReadBits(msg_t *msg, int bits) {
 		if (bits) {
 			//			fp = fopen("c:\\netchan.bin", "a");
 			for (i = 0; i < bits; i += 8) {
-				Huff_offsetReceive(msgHuff.decompressor.tree, &get, msg->data, &msg->bit, msg->cursize << 3);
+				get = MSG_HuffReadSymbol(msg);
 				//				fwrite(&get, 1, 1, fp);
 				value = (unsigned int)value | ((unsigned int)get << (i + nbits));
 
@@ -353,6 +584,49 @@ void MSG_WriteBigString(msg_t *sb, const char *s) {
 	}
 }
 
+/*
+==================
+MSG_WriteServerCommand
+
+Element of svc_serverCommands.  Configstring updates go out as a type byte,
+the index and the value, everything else as a plain string.  The packed form
+is only used when MSG_ReadServerCommand rebuilds the exact same string.
+==================
+*/
+static const char *const serverCommandTypes[] = {NULL, "cs", "bcs0", "bcs1", "bcs2"};
+
+void MSG_WriteServerCommand(msg_t *sb, const char *s) {
+	char rebuilt[MAX_STRING_CHARS];
+	const char *value;
+	int type, index, len;
+
+	for (type = ARRAY_LEN(serverCommandTypes) - 1; type > 0; type--) {
+		len = strlen(serverCommandTypes[type]);
+		if (!strncmp(s, serverCommandTypes[type], len) && s[len] == ' ') {
+			break;
+		}
+	}
+
+	if (type > 0) {
+		index = atoi(s + len + 1);
+		value = strchr(s + len + 1, '"');
+		if (value && index >= 0 && index < MAX_CONFIGSTRINGS && strlen(value) >= 3) {
+			Com_sprintf(rebuilt, sizeof(rebuilt), "%s %i \"%.*s\"\n", serverCommandTypes[type], index,
+						(int)strlen(value) - 3, value + 1);
+			if (!strcmp(rebuilt, s)) {
+				Q_strncpyz(rebuilt, value + 1, strlen(value) - 2);
+				MSG_WriteByte(sb, type);
+				MSG_WriteShort(sb, index);
+				MSG_WriteString(sb, rebuilt);
+				return;
+			}
+		}
+	}
+
+	MSG_WriteByte(sb, 0);
+	MSG_WriteString(sb, s);
+}
+
 void MSG_WriteAngle(msg_t *sb, float f) {
 	MSG_WriteByte(sb, (int)(f * 256 / 360) & 255);
 }
@@ -523,6 +797,31 @@ const char *MSG_ReadStringLine(msg_t *msg) {
 	return string;
 }
 
+/*
+==================
+MSG_ReadServerCommand
+
+Returns NULL for an unknown command type
+==================
+*/
+const char *MSG_ReadServerCommand(msg_t *msg) {
+	static char string[MAX_STRING_CHARS];
+	int type, index;
+
+	type = MSG_ReadByte(msg);
+	if (type == 0) {
+		return MSG_ReadString(msg);
+	}
+	if (type < 0 || type >= ARRAY_LEN(serverCommandTypes)) {
+		return NULL;
+	}
+
+	index = MSG_ReadShort(msg);
+	Com_sprintf(string, sizeof(string), "%s %i \"%s\"\n", serverCommandTypes[type], index, MSG_ReadString(msg));
+
+	return string;
+}
+
 float MSG_ReadAngle16(msg_t *msg) {
 	return SHORT2ANGLE(MSG_ReadShort(msg));
 }
@@ -779,6 +1078,131 @@ static const netField_t entityStateFields[] = {{NETF(pos.trTime), 32},
 #define FLOAT_INT_BITS 13
 #define FLOAT_INT_BIAS (1 << (FLOAT_INT_BITS - 1))
 
+/*
+============================================================================
+
+changed field masks
+
+The delta writers compare the whole state at once and then only visit the
+fields that changed.  The field lists are not in structure order, so the
+changed words are mapped back to field numbers through a table.
+
+============================================================================
+*/
+
+#define NO_FIELD 0xff
+
+#define ENTITY_STATE_WORDS (sizeof(entityState_t) / 4)
+#define PLAYER_STATE_WORDS (sizeof(playerState_t) / 4)
+
+static byte entityFieldForWord[ENTITY_STATE_WORDS];
+static byte playerFieldForWord[PLAYER_STATE_WORDS];
+
+/*
+==================
+MSG_LowestBit
+==================
+*/
+static int MSG_LowestBit(uint64_t value) {
+#ifdef __GNUC__
+	return __builtin_ctzll(value);
+#else
+	int i;
+
+	for (i = 0; !(value & 1); i++) {
+		value >>= 1;
+	}
+	return i;
+#endif
+}
+
+/*
+==================
+MSG_DiffWords
+
+Sets a bit in changed for every 32 bit word that differs
+==================
+*/
+static void MSG_DiffWords(const int *from, const int *to, int numWords, unsigned *changed) {
+	int i;
+
+	Com_Memset(changed, 0, ((numWords + 31) >> 5) * sizeof(*changed));
+
+	i = 0;
+#if idx64
+	for (; i + 4 <= numWords; i += 4) {
+		__m128i a = _mm_loadu_si128((const __m128i *)(from + i));
+		__m128i b = _mm_loadu_si128((const __m128i *)(to + i));
+		unsigned equal = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b)));
+
+		changed[i >> 5] |= (~equal & 15) << (i & 31);
+	}
+#endif
+	for (; i < numWords; i++) {
+		if (from[i] != to[i]) {
+			changed[i >> 5] |= 1u << (i & 31);
+		}
+	}
+}
+
+/*
+==================
+MSG_ChangedFields
+==================
+*/
+static uint64_t MSG_ChangedFields(const unsigned *changed, int numWords, const byte *fieldForWord) {
+	uint64_t fields;
+	unsigned bits;
+	int i, word;
+
+	fields = 0;
+	for (i = 0; i < (numWords + 31) >> 5; i++) {
+		for (bits = changed[i]; bits; bits &= bits - 1) {
+			word = (i << 5) + MSG_LowestBit(bits);
+			if (fieldForWord[word] != NO_FIELD) {
+				fields |= (uint64_t)1 << fieldForWord[word];
+			}
+		}
+	}
+
+	return fields;
+}
+
+/*
+==================
+MSG_ChangedWords
+
+The changed bits for count <= 32 consecutive words starting at first
+==================
+*/
+static int MSG_ChangedWords(const unsigned *changed, int first, int count) {
+	uint64_t bits;
+
+	bits = changed[first >> 5] >> (first & 31);
+	if ((first & 31) + count > 32) {
+		bits |= (uint64_t)changed[(first >> 5) + 1] << (32 - (first & 31));
+	}
+
+	return (int)(bits & ((1ull << count) - 1));
+}
+
+/*
+==================
+MSG_WriteUnchangedFields
+
+The same bits as writing a zero bit for each field, seven at a time
+==================
+*/
+static void MSG_WriteUnchangedFields(msg_t *msg, int count) {
+	while (count > 7) {
+		MSG_WriteBits(msg, 0, 7);
+		count -= 7;
+	}
+	if (count) {
+		MSG_WriteBits(msg, 0, count);
+	}
+}
+
 /*
 ==================
 MSG_WriteDeltaEntity
@@ -796,7 +1220,10 @@ void MSG_WriteDeltaEntity(msg_t *msg, struct entityState_s *from, struct entityS
 	const netField_t *field;
 	int trunc;
 	float fullFloat;
-	int *fromF, *toF;
+	int *toF;
+	unsigned changedWords[(ENTITY_STATE_WORDS + 31) >> 5];
+	uint64_t changed;
+	int next;
 
 	numFields = ARRAY_LEN(entityStateFields);
 
@@ -820,14 +1247,12 @@ void MSG_WriteDeltaEntity(msg_t *msg, struct entityState_s *from, struct entityS
 		Com_Error(ERR_FATAL, "MSG_WriteDeltaEntity: Bad entity number: %i", to->number);
 	}
 
+	MSG_DiffWords((const int *)from, (const int *)to, ENTITY_STATE_WORDS, changedWords);
+	changed = MSG_ChangedFields(changedWords, ENTITY_STATE_WORDS, entityFieldForWord);
+
 	lc = 0;
-	// build the change vector as bytes so it is endien independent
-	for (i = 0, field = entityStateFields; i < numFields; i++, field++) {
-		fromF = (int *)((byte *)from + field->offset);
-		toF = (int *)((byte *)to + field->offset);
-		if (*fromF != *toF) {
-			lc = i + 1;
-		}
+	while (changed >> lc) {
+		lc++;
 	}
 
 	if (lc == 0) {
@@ -850,16 +1275,14 @@ void MSG_WriteDeltaEntity(msg_t *msg, struct entityState_s *from, struct entityS
 
 	oldsize += numFields;
 
-	for (i = 0, field = entityStateFields; i < lc; i++, field++) {
-		fromF = (int *)((byte *)from + field->offset);
+	for (next = 0; changed; changed &= changed - 1) {
+		i = MSG_LowestBit(changed);
+		field = &entityStateFields[i];
 		toF = (int *)((byte *)to + field->offset);
 
-		if (*fromF == *toF) {
-			MSG_WriteBits(msg, 0, 1); // no change
-			continue;
-		}
-
+		MSG_WriteUnchangedFields(msg, i - next);
 		MSG_WriteBits(msg, 1, 1); // changed
+		next = i + 1;
 
 		if (field->bits == 0) {
 			// float
@@ -1096,9 +1519,12 @@ void MSG_WriteDeltaPlayerstate(msg_t *msg, const struct playerState_s *from, con
 	int powerupbits;
 	int numFields;
 	const netField_t *field;
-	const int *fromF, *toF;
+	const int *toF;
 	float fullFloat;
 	int trunc, lc;
+	unsigned changedWords[(PLAYER_STATE_WORDS + 31) >> 5];
+	uint64_t changed;
+	int next;
 
 	if (!from) {
 		from = &dummy;
@@ -1107,30 +1533,27 @@ void MSG_WriteDeltaPlayerstate(msg_t *msg, const struct playerState_s *from, con
 
 	numFields = ARRAY_LEN(playerStateFields);
 
+	MSG_DiffWords((const int *)from, (const int *)to, PLAYER_STATE_WORDS, changedWords);
+	changed = MSG_ChangedFields(changedWords, PLAYER_STATE_WORDS, playerFieldForWord);
+
 	lc = 0;
-	for (i = 0, field = playerStateFields; i < numFields; i++, field++) {
-		fromF = (const int *)((byte *)from + field->offset);
-		toF = (const int *)((byte *)to + field->offset);
-		if (*fromF != *toF) {
-			lc = i + 1;
-		}
+	while (changed >> lc) {
+		lc++;
 	}
 
 	MSG_WriteByte(msg, lc); // # of changes
 
 	oldsize += numFields - lc;
 
-	for (i = 0, field = playerStateFields; i < lc; i++, field++) {
-		fromF = (const int *)((byte *)from + field->offset);
+	for (next = 0; changed; changed &= changed - 1) {
+		i = MSG_LowestBit(changed);
+		field = &playerStateFields[i];
 		toF = (const int *)((byte *)to + field->offset);
 
-		if (*fromF == *toF) {
-			MSG_WriteBits(msg, 0, 1); // no change
-			continue;
-		}
-
+		MSG_WriteUnchangedFields(msg, i - next);
 		MSG_WriteBits(msg, 1, 1); // changed
-								  //		pcount[i]++;
+		next = i + 1;
+		//		pcount[i]++;
 
 		if (field->bits == 0) {
 			// float
@@ -1155,30 +1578,10 @@ void MSG_WriteDeltaPlayerstate(msg_t *msg, const struct playerState_s *from, con
 	//
 	// send the arrays
 	//
-	statsbits = 0;
-	for (i = 0; i < MAX_STATS; i++) {
-		if (to->stats[i] != from->stats[i]) {
-			statsbits |= 1 << i;
-		}
-	}
-	persistantbits = 0;
-	for (i = 0; i < MAX_PERSISTANT; i++) {
-		if (to->persistant[i] != from->persistant[i]) {
-			persistantbits |= 1 << i;
-		}
-	}
-	ammobits = 0;
-	for (i = 0; i < MAX_WEAPONS; i++) {
-		if (to->ammo[i] != from->ammo[i]) {
-			ammobits |= 1 << i;
-		}
-	}
-	powerupbits = 0;
-	for (i = 0; i < MAX_POWERUPS; i++) {
-		if (to->powerups[i] != from->powerups[i]) {
-			powerupbits |= 1 << i;
-		}
-	}
+	statsbits = MSG_ChangedWords(changedWords, offsetof(playerState_t, stats) / 4, MAX_STATS);
+	persistantbits = MSG_ChangedWords(changedWords, offsetof(playerState_t, persistant) / 4, MAX_PERSISTANT);
+	ammobits = MSG_ChangedWords(changedWords, offsetof(playerState_t, ammo) / 4, MAX_WEAPONS);
+	powerupbits = MSG_ChangedWords(changedWords, offsetof(playerState_t, powerups) / 4, MAX_POWERUPS);
 
 	if (!statsbits && !persistantbits && !ammobits && !powerupbits) {
 		MSG_WriteBits(msg, 0, 1); // no change
@@ -1630,15 +2033,118 @@ static const int msg_hData[256] = {
 	13504,	// 255
 };
 
-void MSG_initHuffman(void) {
+/*
+==================
+MSG_BuildFieldTables
+==================
+*/
+static void MSG_BuildFieldTables(void) {
+	int i;
+
+	Com_Memset(entityFieldForWord, NO_FIELD, sizeof(entityFieldForWord));
+	for (i = 0; i < ARRAY_LEN(entityStateFields); i++) {
+		entityFieldForWord[entityStateFields[i].offset / 4] = i;
+	}
+
+	Com_Memset(playerFieldForWord, NO_FIELD, sizeof(playerFieldForWord));
+	for (i = 0; i < ARRAY_LEN(playerStateFields); i++) {
+		playerFieldForWord[playerStateFields[i].offset / 4] = i;
+	}
+}
+
+/*
+==================
+MSG_SeedHuffTable
+
+Every symbol needs a weight, Huff_offsetTransmit can't send unseen ones
+==================
+*/
+static void MSG_SeedHuffTable(msgHuffTable_t *table, const int *counts) {
 	int i, j;
 
-	msgInit = qtrue;
-	Huff_Init(&msgHuff);
+	Huff_Init(&table->huff);
 	for (i = 0; i < 256; i++) {
-		for (j = 0; j < msg_hData[i]; j++) {
-			Huff_addRef(&msgHuff.compressor, (byte)i);	 // Do update
-			Huff_addRef(&msgHuff.decompressor, (byte)i); // Do update
+		for (j = 0; j < MAX(counts[i], 1); j++) {
+			Huff_addRef(&table->huff.compressor, (byte)i);	 // Do update
+			Huff_addRef(&table->huff.decompressor, (byte)i); // Do update
 		}
 	}
+	MSG_BuildHuffTables(table);
+}
+
+void MSG_initHuffman(void) {
+	msgInit = qtrue;
+	MSG_SeedHuffTable(&msgHuffTables[MSG_HUFF_DEFAULT], msg_hData);
+	MSG_BuildFieldTables();
+}
+
+/*
+==================
+MSG_LoadHuffTable
+
+Loads the alternate symbol frequencies written by the server's huffstats
+command: "version <n>" followed by 256 counts.  Peers that loaded the same
+version can code their messages with it.
+==================
+*/
+void MSG_LoadHuffTable(const char *filename) {
+	int counts[256];
+	union {
+		char *c;
+		void *v;
+	} f;
+	const char *text, *token;
+	int i, version;
+	long total;
+
+	msgHuffVersion = 0;
+
+	if (!msgInit) {
+		MSG_initHuffman();
+	}
+
+	if (!filename[0] || FS_ReadFile(filename, &f.v) < 0) {
+		return;
+	}
+
+	text = f.c;
+	version = 0;
+	token = COM_Parse(&text);
+	if (!Q_stricmp(token, "version")) {
+		version = atoi(COM_Parse(&text));
+	}
+
+	total = 0;
+	for (i = 0; i < 256 && version > 0; i++) {
+		token = COM_Parse(&text);
+		if (!token[0]) {
+			break;
+		}
+		counts[i] = atoi(token);
+		if (counts[i] < 0 || counts[i] > MSG_HUFF_MAXCOUNT) {
+			break;
+		}
+		total += counts[i];
+	}
+	FS_FreeFile(f.v);
+
+	if (version <= 0 || i < 256 || total > MSG_HUFF_MAXCOUNT * 4) {
+		Com_Printf(S_COLOR_YELLOW "WARNING: %s is not a valid huffman table\n", filename);
+		return;
+	}
+
+	MSG_SeedHuffTable(&msgHuffTables[MSG_HUFF_ALTERNATE], counts);
+	msgHuffVersion = version;
+	Com_Printf("Loaded huffman table %s, version %i\n", filename, version);
+}
+
+/*
+==================
+MSG_HuffTableVersion
+
+The version of the alternate table, 0 if none is loaded
+==================
+*/
+int MSG_HuffTableVersion(void) {
+	return msgHuffVersion;
 }
@@ -29,6 +29,8 @@ packet header
 -------------
 4	outgoing sequence.  high bit will be set if this is a fragmented message
 [2	qport (only for client to server)]
+4	checksum
+[1	NETCHAN_* payload flags (only if compression was negotiated)]
 [2	fragment start byte]
 [2	fragment length. if < FRAGMENT_SIZE, this is the last fragment]
 
@@ -70,6 +72,9 @@ void Netchan_Init(int port) {
 	showpackets = Cvar_Get("showpackets", "0", CVAR_TEMP);
 	showdrop = Cvar_Get("showdrop", "0", CVAR_TEMP);
 	qport = Cvar_Get("net_qport", va("%i", port), CVAR_INIT);
+
+	// alternate huffman table, negotiated through the "nethuff" userinfo key
+	MSG_LoadHuffTable(Cvar_Get("net_huffTable", "nethuff.txt", CVAR_INIT)->string);
 }
 
 /*
@@ -116,6 +121,10 @@ void Netchan_TransmitNextFragment(netchan_t *chan) {
 
 	MSG_WriteLong(&send, NETCHAN_GENCHECKSUM(chan->challenge, chan->outgoingSequence));
 
+	if (chan->compression) {
+		MSG_WriteByte(&send, chan->unsentFlags);
+	}
+
 	// copy the reliable message to the packet first
 	fragmentLength = FRAGMENT_SIZE;
 	if (chan->unsentFragmentStart + fragmentLength > chan->unsentLength) {
@@ -152,25 +161,30 @@ void Netchan_TransmitNextFragment(netchan_t *chan) {
 
 /*
 ===============
-Netchan_Transmit
+Netchan_TransmitFlags
 
 Sends a message to a connection, fragmenting if necessary
 A 0 length will still generate a packet.
+The NETCHAN_* flags only reach peers that negotiated compression.
 ================
 */
-void Netchan_Transmit(netchan_t *chan, int length, const byte *data) {
+void Netchan_TransmitFlags(netchan_t *chan, int length, const byte *data, int flags) {
 	msg_t send;
 	byte send_buf[MAX_PACKETLEN];
 
 	if (length > MAX_MSGLEN) {
 		Com_Error(ERR_DROP, "Netchan_Transmit: length = %i", length);
 	}
+	if (flags && !chan->compression) {
+		Com_Error(ERR_DROP, "Netchan_Transmit: flags %i on a legacy channel", flags);
+	}
 	chan->unsentFragmentStart = 0;
 
 	// fragment large reliable messages
 	if (length >= FRAGMENT_SIZE) {
 		chan->unsentFragments = qtrue;
 		chan->unsentLength = length;
+		chan->unsentFlags = flags;
 		Com_Memcpy(chan->unsentBuffer, data, length);
 
 		// only send the first fragment now
@@ -190,6 +204,10 @@ void Netchan_Transmit(netchan_t *chan, int length, const byte *data) {
 
 	MSG_WriteLong(&send, NETCHAN_GENCHECKSUM(chan->challenge, chan->outgoingSequence));
 
+	if (chan->compression) {
+		MSG_WriteByte(&send, flags);
+	}
+
 	chan->outgoingSequence++;
 
 	MSG_WriteData(&send, data, length);
@@ -207,6 +225,15 @@ void Netchan_Transmit(netchan_t *chan, int length, const byte *data) {
 	}
 }
 
+/*
+===============
+Netchan_Transmit
+================
+*/
+void Netchan_Transmit(netchan_t *chan, int length, const byte *data) {
+	Netchan_TransmitFlags(chan, length, data, 0);
+}
+
 /*
 =================
 Netchan_Process
@@ -223,6 +250,7 @@ qboolean Netchan_Process(netchan_t *chan, msg_t *msg) {
 	int sequence;
 	int checksum;
 	int fragmentStart, fragmentLength;
+	int flags;
 	qboolean fragmented;
 
 	// XOR unscramble all data in the packet after the header
@@ -251,6 +279,8 @@ qboolean Netchan_Process(netchan_t *chan, msg_t *msg) {
 	if (NETCHAN_GENCHECKSUM(chan->challenge, sequence) != checksum)
 		return qfalse;
 
+	flags = chan->compression ? MSG_ReadByte(msg) : 0;
+
 	// read the fragment information
 	if (fragmented) {
 		fragmentStart = MSG_ReadShort(msg);
@@ -353,6 +383,7 @@ qboolean Netchan_Process(netchan_t *chan, msg_t *msg) {
 		// TTimo
 		// clients were not acking fragmented messages
 		chan->incomingSequence = sequence;
+		chan->incomingFlags = flags;
 
 		return qtrue;
 	}
@@ -361,6 +392,7 @@ qboolean Netchan_Process(netchan_t *chan, msg_t *msg) {
 	// the message can now be read from the current message pointer
 	//
 	chan->incomingSequence = sequence;
+	chan->incomingFlags = flags;
 
 	return qtrue;
 }
@@ -20,6 +20,11 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 ===========================================================================
 */
 
+#ifdef __linux__
+#define _GNU_SOURCE // recvmmsg and sendmmsg
+#define USE_MMSG
+#endif
+
 #include "../qcommon/q_shared.h"
 #include "../qcommon/qcommon.h"
 
@@ -81,6 +86,15 @@ static qboolean winsockInitialized = qfalse;
 #include <sys/filio.h>
 #endif
 
+#if defined(__linux__)
+#define USE_EPOLL
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#elif defined(__APPLE__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__NetBSD__) || defined(__DragonFly__)
+#define USE_KQUEUE
+#include <sys/event.h>
+#endif
+
 typedef int SOCKET;
 #define INVALID_SOCKET -1
 #define SOCKET_ERROR -1
@@ -94,6 +108,83 @@ typedef int ioctlarg_t;
 static qboolean usingSocks = qfalse;
 static int networkingEnabled = 0;
 
+#ifdef USE_MMSG
+#define NET_RECV_BATCH 16
+#define NET_SEND_BATCH 64
+#define NET_SEND_SIZE 1400 // MAX_PACKETLEN in net_chan.c, anything larger is sent right away
+
+// datagrams read ahead from one socket by a single recvmmsg
+typedef struct {
+	struct mmsghdr msgs[NET_RECV_BATCH];
+	struct iovec iov[NET_RECV_BATCH];
+	struct sockaddr_storage from[NET_RECV_BATCH];
+	byte data[NET_RECV_BATCH][MAX_MSGLEN + 1];
+	int count;
+	int next;
+} netRecvRing_t;
+
+// datagrams waiting to go out to one socket with a single sendmmsg
+typedef struct {
+	struct mmsghdr msgs[NET_SEND_BATCH];
+	struct iovec iov[NET_SEND_BATCH];
+	struct sockaddr_storage to[NET_SEND_BATCH];
+	netadrtype_t type[NET_SEND_BATCH];
+	byte data[NET_SEND_BATCH][NET_SEND_SIZE];
+	SOCKET sock;
+	int count;
+} netSendBatch_t;
+
+static netRecvRing_t ipRecvRing;
+static netRecvRing_t ip6RecvRing;
+static netSendBatch_t sendBatch;
+static qboolean sendBatching;
+static qboolean mmsgFailed; // the kernel has no recvmmsg or sendmmsg, only use the plain calls
+#endif
+
+#define MAX_POLL_SOCKETS 3
+
+// NET_Sleep waits on a persistent epoll or kqueue set where there is one,
+// which has to be rebuilt whenever a socket is opened or closed
+static qboolean pollSocketsChanged = qtrue;
+#if defined(USE_EPOLL) || defined(USE_KQUEUE)
+static int pollFd = -1;
+static qboolean pollFailed; // fall back to select
+#endif
+#ifdef USE_EPOLL
+static int pollTimerFd = -1;
+#endif
+
+// with net_recvThread a thread of its own drains the sockets, stamps every
+// packet with its arrival time and hands it to NET_Sleep through this ring
+#define NET_RECV_QUEUE 128
+
+typedef struct {
+	netadr_t from;
+	int time;
+	int length;
+	byte data[MAX_MSGLEN + 1];
+} netQueuedPacket_t;
+
+typedef struct {
+	netQueuedPacket_t packets[NET_RECV_QUEUE];
+	int head; // only written by the receive thread
+	int tail; // only written by the main thread
+	int errors;
+	int lastError;
+	qboolean failed;
+	qboolean stop;
+	sysMutex_t *mutex;
+	sysCond_t *cond;  // a packet was queued
+	sysCond_t *space; // a packet was taken out of the queue
+	sysThread_t *thread;
+} netRecvQueue_t;
+
+static netRecvQueue_t *recvQueue;
+static int packetTime; // arrival time of the dispatched packet, 0 if it is read right now
+
+static void NET_StartRecvThread(void);
+static void NET_StopRecvThread(void);
+
 static cvar_t *net_enabled;
 
 static cvar_t *net_socksEnabled;
@@ -110,6 +201,7 @@ static cvar_t *net_mcast6addr;
 static cvar_t *net_mcast6iface;
 
 static cvar_t *net_dropsim;
+static cvar_t *net_recvThread;
 
 static struct sockaddr socksRelayAddr;
 
@@ -515,6 +607,70 @@ qboolean NET_IsLocalAddress(netadr_t adr) {
 
 //=============================================================================
 
+/*
+==================
+NET_RecvFrom
+
+recvfrom for the unicast sockets, which reads ahead with recvmmsg where
+available and hands out the buffered datagrams one at a time
+==================
+*/
+static int NET_RecvFrom(SOCKET sock, void *buf, int len, struct sockaddr *from, socklen_t *fromlen) {
+#ifdef USE_MMSG
+	netRecvRing_t *ring;
+	struct mmsghdr *m;
+	int ret, i;
+
+	if (!mmsgFailed) {
+		ring = sock == ip_socket ? &ipRecvRing : &ip6RecvRing;
+
+		if (ring->next >= ring->count) {
+			ring->count = 0;
+			ring->next = 0;
+
+			for (i = 0; i < NET_RECV_BATCH; i++) {
+				m = &ring->msgs[i];
+				ring->iov[i].iov_base = ring->data[i];
+				ring->iov[i].iov_len = sizeof(ring->data[i]);
+				memset(&m->msg_hdr, 0, sizeof(m->msg_hdr));
+				m->msg_hdr.msg_name = &ring->from[i];
+				m->msg_hdr.msg_namelen = sizeof(ring->from[i]);
+				m->msg_hdr.msg_iov = &ring->iov[i];
+				m->msg_hdr.msg_iovlen = 1;
+			}
+
+			ret = recvmmsg(sock, ring->msgs, NET_RECV_BATCH, 0, NULL);
+			if (ret == SOCKET_ERROR && socketError == ENOSYS) {
+				mmsgFailed = qtrue;
+				return recvfrom(sock, buf, len, 0, from, fromlen);
+			}
+			if (ret <= 0) {
+				return ret;
+			}
+			ring->count = ret;
+		}
+
+		i = ring->next++;
+		m = &ring->msgs[i];
+
+		// a datagram that does not fit is cut short, just like recvfrom does
+		ret = m->msg_len;
+		if (ret > len) {
+			ret = len;
+		}
+		memcpy(buf, ring->data[i], ret);
+
+		if (*fromlen > m->msg_hdr.msg_namelen) {
+			*fromlen = m->msg_hdr.msg_namelen;
+		}
+		memcpy(from, &ring->from[i], *fromlen);
+		return ret;
+	}
+#endif
+
+	return recvfrom(sock, buf, len, 0, from, fromlen);
+}
+
 /*
 ==================
 NET_GetPacket
@@ -530,8 +686,7 @@ qboolean NET_GetPacket(netadr_t *net_from, msg_t *net_message, fd_set *fdr) {
 
 	if (ip_socket != INVALID_SOCKET && FD_ISSET(ip_socket, fdr)) {
 		fromlen = sizeof(from);
-		ret =
-			recvfrom(ip_socket, (void *)net_message->data, net_message->maxsize, 0, (struct sockaddr *)&from, &fromlen);
+		ret = NET_RecvFrom(ip_socket, (void *)net_message->data, net_message->maxsize, (struct sockaddr *)&from, &fromlen);
 
 		if (ret == SOCKET_ERROR) {
 			err = socketError;
@@ -571,8 +726,8 @@ qboolean NET_GetPacket(netadr_t *net_from, msg_t *net_message, fd_set *fdr) {
 
 	if (ip6_socket != INVALID_SOCKET && FD_ISSET(ip6_socket, fdr)) {
 		fromlen = sizeof(from);
-		ret = recvfrom(ip6_socket, (void *)net_message->data, net_message->maxsize, 0, (struct sockaddr *)&from,
-					   &fromlen);
+		ret = NET_RecvFrom(ip6_socket, (void *)net_message->data, net_message->maxsize, (struct sockaddr *)&from,
+						   &fromlen);
 
 		if (ret == SOCKET_ERROR) {
 			err = socketError;
@@ -624,6 +779,134 @@ qboolean NET_GetPacket(netadr_t *net_from, msg_t *net_message, fd_set *fdr) {
 
 static char socksBuf[4096];
 
+/*
+==================
+NET_SendError
+
+Reports a failed send, unless it is one of the expected failures
+==================
+*/
+static void NET_SendError(netadrtype_t type) {
+	int err = socketError;
+
+	// wouldblock is silent
+	if (err == EAGAIN) {
+		return;
+	}
+
+	// some PPP links do not allow broadcasts and return an error
+	if ((err == EADDRNOTAVAIL) && ((type == NA_BROADCAST))) {
+		return;
+	}
+
+	Com_Printf("Sys_SendPacket: %s\n", NET_ErrorString());
+}
+
+#ifdef USE_MMSG
+/*
+==================
+NET_SendQueuedPackets
+==================
+*/
+static void NET_SendQueuedPackets(void) {
+	struct mmsghdr *m;
+	int sent, ret;
+
+	sent = 0;
+	while (sent < sendBatch.count) {
+		if (mmsgFailed) {
+			m = &sendBatch.msgs[sent];
+			ret = sendto(sendBatch.sock, sendBatch.data[sent], m->msg_hdr.msg_iov->iov_len, 0,
+						 (struct sockaddr *)&sendBatch.to[sent], m->msg_hdr.msg_namelen);
+			if (ret == SOCKET_ERROR) {
+				NET_SendError(sendBatch.type[sent]);
+			}
+			sent++;
+			continue;
+		}
+
+		ret = sendmmsg(sendBatch.sock, &sendBatch.msgs[sent], sendBatch.count - sent, 0);
+		if (ret > 0) {
+			sent += ret;
+			continue;
+		}
+
+		if (socketError == ENOSYS) {
+			mmsgFailed = qtrue;
+			continue;
+		}
+
+		// drop the datagram that failed and carry on with the rest
+		NET_SendError(sendBatch.type[sent]);
+		sent++;
+	}
+
+	sendBatch.count = 0;
+}
+
+/*
+==================
+NET_QueuePacket
+
+Returns qfalse if the packet has to be sent right away
+==================
+*/
+static qboolean NET_QueuePacket(SOCKET sock, int length, const void *data, const struct sockaddr_storage *addr,
+								netadrtype_t type) {
+	struct mmsghdr *m;
+	int i;
+
+	if (length > NET_SEND_SIZE) {
+		NET_SendQueuedPackets(); // keep the order
+		return qfalse;
+	}
+
+	if (sendBatch.count == NET_SEND_BATCH || (sendBatch.count && sendBatch.sock != sock)) {
+		NET_SendQueuedPackets();
+	}
+
+	i = sendBatch.count++;
+	m = &sendBatch.msgs[i];
+	sendBatch.sock = sock;
+	sendBatch.type[i] = type;
+	sendBatch.to[i] = *addr;
+	memcpy(sendBatch.data[i], data, length);
+	sendBatch.iov[i].iov_base = sendBatch.data[i];
+	sendBatch.iov[i].iov_len = length;
+	memset(&m->msg_hdr, 0, sizeof(m->msg_hdr));
+	m->msg_hdr.msg_name = &sendBatch.to[i];
+	m->msg_hdr.msg_namelen = addr->ss_family == AF_INET6 ? sizeof(struct sockaddr_in6) : sizeof(struct sockaddr_in);
+	m->msg_hdr.msg_iov = &sendBatch.iov[i];
+	m->msg_hdr.msg_iovlen = 1;
+
+	return qtrue;
+}
+#endif
+
+/*
+==================
+NET_BeginSendBatch
+==================
+*/
+void NET_BeginSendBatch(void) {
+#ifdef USE_MMSG
+	NET_SendQueuedPackets();
+	sendBatching = qtrue;
+#endif
+}
+
+/*
+==================
+NET_FlushSendBatch
+==================
+*/
+void NET_FlushSendBatch(void) {
+#ifdef USE_MMSG
+	NET_SendQueuedPackets();
+	sendBatching = qfalse;
+#endif
+}
+
 /*
 ==================
 Sys_SendPacket
@@ -659,25 +942,23 @@ void Sys_SendPacket(int length, const void *data, netadr_t to) {
 		memcpy(&socksBuf[10], data, length);
 		ret = sendto(ip_socket, socksBuf, length + 10, 0, &socksRelayAddr, sizeof(socksRelayAddr));
 	} else {
+#ifdef USE_MMSG
+		if (sendBatching && !mmsgFailed) {
+			if (addr.ss_family == AF_INET && NET_QueuePacket(ip_socket, length, data, &addr, to.type)) {
+				return;
+			}
+			if (addr.ss_family == AF_INET6 && NET_QueuePacket(ip6_socket, length, data, &addr, to.type)) {
+				return;
+			}
+		}
+#endif
 		if (addr.ss_family == AF_INET)
 			ret = sendto(ip_socket, data, length, 0, (struct sockaddr *)&addr, sizeof(struct sockaddr_in));
 		else if (addr.ss_family == AF_INET6)
 			ret = sendto(ip6_socket, data, length, 0, (struct sockaddr *)&addr, sizeof(struct sockaddr_in6));
 	}
 	if (ret == SOCKET_ERROR) {
-		int err = socketError;
-
-		// wouldblock is silent
-		if (err == EAGAIN) {
-			return;
-		}
-
-		// some PPP links do not allow broadcasts and return an error
-		if ((err == EADDRNOTAVAIL) && ((to.type == NA_BROADCAST))) {
-			return;
-		}
-
-		Com_Printf("Sys_SendPacket: %s\n", NET_ErrorString());
+		NET_SendError(to.type);
 	}
 }
 
@@ -960,6 +1241,8 @@ void NET_JoinMulticast6(void) {
 		(net_enabled->integer & NET_DISABLEMCAST))
 		return;
 
+	pollSocketsChanged = qtrue;
+
 	if (IN6_IS_ADDR_MULTICAST(&boundto.sin6_addr) || IN6_IS_ADDR_UNSPECIFIED(&boundto.sin6_addr)) {
 		// The way the socket was bound does not prohibit receiving multi-cast packets. So we don't need to open a new
 		// one.
@@ -999,6 +1282,8 @@ void NET_JoinMulticast6(void) {
 
 void NET_LeaveMulticast6(void) {
 	if (multicast6_socket != INVALID_SOCKET) {
+		pollSocketsChanged = qtrue;
+
 		if (multicast6_socket != ip6_socket)
 			closesocket(multicast6_socket);
 		else
@@ -1405,6 +1690,10 @@ static qboolean NET_GetCvars(void) {
 
 	net_dropsim = Cvar_Get("net_dropsim", "", CVAR_TEMP);
 
+	net_recvThread = Cvar_Get("net_recvThread", "0", CVAR_LATCH | CVAR_ARCHIVE);
+	modified += net_recvThread->modified;
+	net_recvThread->modified = qfalse;
+
 	return modified ? qtrue : qfalse;
 }
 
@@ -1450,6 +1739,15 @@ void NET_Config(qboolean enableNetworking) {
 	}
 
 	if (stop) {
+		NET_StopRecvThread();
+
+#ifdef USE_MMSG
+		// whatever was read ahead or queued belongs to the old sockets
+		ipRecvRing.count = ipRecvRing.next = 0;
+		ip6RecvRing.count = ip6RecvRing.next = 0;
+		sendBatch.count = 0;
+#endif
+
 		if (ip_socket != INVALID_SOCKET) {
 			closesocket(ip_socket);
 			ip_socket = INVALID_SOCKET;
@@ -1477,8 +1775,11 @@ void NET_Config(qboolean enableNetworking) {
 		if (net_enabled->integer) {
 			NET_OpenIP();
 			NET_SetMulticast6();
+			NET_StartRecvThread();
 		}
 	}
+
+	pollSocketsChanged = qtrue;
 }
 
 /*
@@ -1517,6 +1818,13 @@ void NET_Shutdown(void) {
 
 	NET_Config(qfalse);
 
+#if defined(USE_EPOLL) || defined(USE_KQUEUE)
+	if (pollFd != -1) {
+		close(pollFd);
+		pollFd = -1;
+	}
+#endif
+
 #ifdef _WIN32
 	WSACleanup();
 	winsockInitialized = qfalse;
@@ -1527,7 +1835,7 @@ void NET_Shutdown(void) {
 ====================
 NET_Event
 
-Called from NET_Sleep which uses select() to determine which sockets have seen action.
+Called from NET_Sleep once select(), epoll or kqueue has determined which sockets have seen action.
 ====================
 */
 
@@ -1555,46 +1863,521 @@ void NET_Event(fd_set *fdr) {
 	}
 }
 
+/*
+====================
+NET_PollSockets
+
+The sockets that NET_GetPacket reads from
+====================
+*/
+static int NET_PollSockets(SOCKET *sockets) {
+	int numSockets = 0;
+
+	if (ip_socket != INVALID_SOCKET) {
+		sockets[numSockets++] = ip_socket;
+	}
+	if (ip6_socket != INVALID_SOCKET) {
+		sockets[numSockets++] = ip6_socket;
+	}
+	if (multicast6_socket != INVALID_SOCKET && multicast6_socket != ip6_socket) {
+		sockets[numSockets++] = multicast6_socket;
+	}
+
+	return numSockets;
+}
+
+/*
+====================
+NET_RecvQueued
+
+Reads everything that is waiting on one socket into the receive queue, runs
+on the receive thread
+====================
+*/
+static void NET_RecvQueued(netRecvQueue_t *q, SOCKET sock) {
+	netQueuedPacket_t *packet;
+	struct sockaddr_storage from;
+	socklen_t fromlen;
+	qboolean stop;
+	int ret, err;
+
+	while (1) {
+		// when the main thread falls behind the packets wait in the socket
+		// buffer, just like they do without the thread
+		Sys_LockMutex(q->mutex);
+		while (q->head - q->tail >= NET_RECV_QUEUE && !q->stop) {
+			Sys_WaitCond(q->space, q->mutex);
+		}
+		stop = q->stop;
+		Sys_UnlockMutex(q->mutex);
+		if (stop) {
+			return;
+		}
+
+		packet = &q->packets[q->head % NET_RECV_QUEUE];
+
+		fromlen = sizeof(from);
+		if (sock == multicast6_socket && sock != ip6_socket) {
+			ret = recvfrom(sock, (void *)packet->data, sizeof(packet->data), 0, (struct sockaddr *)&from, &fromlen);
+		} else {
+			ret = NET_RecvFrom(sock, packet->data, sizeof(packet->data), (struct sockaddr *)&from, &fromlen);
+		}
+
+		if (ret == SOCKET_ERROR) {
+			err = socketError;
+			if (err != EAGAIN && err != ECONNRESET) {
+				Sys_LockMutex(q->mutex);
+				q->errors++;
+				q->lastError = err;
+				Sys_UnlockMutex(q->mutex);
+			}
+			return;
+		}
+
+		if (from.ss_family == AF_INET) {
+			memset(((struct sockaddr_in *)&from)->sin_zero, 0, 8);
+		}
+		memset(&packet->from, 0, sizeof(packet->from));
+		SockadrToNetadr((struct sockaddr *)&from, &packet->from);
+		packet->time = Sys_Milliseconds();
+		packet->length = ret;
+
+		Sys_LockMutex(q->mutex);
+		q->head++;
+		Sys_SignalCond(q->cond);
+		Sys_UnlockMutex(q->mutex);
+	}
+}
+
+/*
+====================
+NET_RecvThread
+
+The sockets stay open for as long as the thread runs, NET_Config stops it
+before closing them
+====================
+*/
+static void NET_RecvThread(void *data) {
+	netRecvQueue_t *q = (netRecvQueue_t *)data;
+	SOCKET sockets[MAX_POLL_SOCKETS];
+	SOCKET highestfd = INVALID_SOCKET;
+	struct timeval timeout;
+	fd_set fdr;
+	qboolean stop;
+	int i, numSockets, retval;
+
+	numSockets = NET_PollSockets(sockets);
+	for (i = 0; i < numSockets; i++) {
+		if (highestfd == INVALID_SOCKET || sockets[i] > highestfd)
+			highestfd = sockets[i];
+	}
+
+	while (1) {
+		Sys_LockMutex(q->mutex);
+		stop = q->stop;
+		Sys_UnlockMutex(q->mutex);
+		if (stop) {
+			return;
+		}
+
+		FD_ZERO(&fdr);
+		for (i = 0; i < numSockets; i++) {
+			FD_SET(sockets[i], &fdr);
+		}
+
+		// wake up now and then to notice the stop request
+		timeout.tv_sec = 0;
+		timeout.tv_usec = 50000;
+
+		retval = select(highestfd + 1, &fdr, NULL, NULL, &timeout);
+		if (retval == SOCKET_ERROR) {
+			if (socketError == EINTR) {
+				continue;
+			}
+
+			// let the main thread read the sockets itself again
+			Sys_LockMutex(q->mutex);
+			q->failed = qtrue;
+			q->lastError = socketError;
+			Sys_SignalCond(q->cond);
+			Sys_UnlockMutex(q->mutex);
+			return;
+		}
+
+		for (i = 0; i < numSockets && retval > 0; i++) {
+			if (FD_ISSET(sockets[i], &fdr)) {
+				NET_RecvQueued(q, sockets[i]);
+			}
+		}
+	}
+}
+
+/*
+====================
+NET_StartRecvThread
+====================
+*/
+static void NET_StartRecvThread(void) {
+	static netRecvQueue_t *q;
+	SOCKET sockets[MAX_POLL_SOCKETS];
+
+	// socks relays the packets with a header of its own, keep that on the main thread
+	if (!net_recvThread->integer || !com_dedicated->integer || usingSocks || !NET_PollSockets(sockets)) {
+		return;
+	}
+
+	// the queue is kept for good once made, the main thread may still be
+	// inside a wait on it when a signal handler shuts the network down
+	if (!q) {
+		q = calloc(1, sizeof(*q));
+		if (!q) {
+			return;
+		}
+		q->mutex = Sys_CreateMutex();
+		q->cond = Sys_CreateCond();
+		q->space = Sys_CreateCond();
+	}
+
+	q->head = q->tail = 0;
+	q->errors = 0;
+	q->failed = qfalse;
+	q->stop = qfalse;
+	q->thread = NULL;
+	if (q->mutex && q->cond && q->space) {
+		q->thread = Sys_CreateThread(NET_RecvThread, q);
+	}
+
+	if (!q->thread) {
+		Com_Printf("WARNING: couldn't start the network receive thread\n");
+		return;
+	}
+
+	recvQueue = q;
+	Com_Printf("Network receive thread started\n");
+}
+
+/*
+====================
+NET_StopRecvThread
+
+Packets still in the queue are lost, like the ones in the socket buffers
+when a socket is closed
+====================
+*/
+static void NET_StopRecvThread(void) {
+	netRecvQueue_t *q = recvQueue;
+
+	if (!q) {
+		return;
+	}
+
+	Sys_LockMutex(q->mutex);
+	q->stop = qtrue;
+	Sys_SignalCond(q->space);
+	Sys_UnlockMutex(q->mutex);
+	Sys_JoinThread(q->thread);
+
+	recvQueue = NULL;
+}
+
+/*
+====================
+NET_RecvQueueEvent
+
+NET_Sleep for when the receive thread reads the sockets: waits for the thread
+to queue a packet and dispatches everything that is queued
+====================
+*/
+static void NET_RecvQueueEvent(int usec) {
+	netRecvQueue_t *q = recvQueue;
+	byte bufData[MAX_MSGLEN + 1];
+	netadr_t from;
+	msg_t netmsg;
+	qboolean failed;
+	int errors, lastError;
+	int time, length;
+
+	Sys_LockMutex(q->mutex);
+	if (q->head == q->tail && usec > 0 && !q->failed) {
+		Sys_TimedWaitCond(q->cond, q->mutex, usec);
+	}
+	errors = q->errors;
+	lastError = q->lastError;
+	failed = q->failed;
+	q->errors = 0;
+	Sys_UnlockMutex(q->mutex);
+
+	if (errors) {
+		Com_Printf("Warning: %i errors on the network receive thread, last was %i\n", errors, lastError);
+	}
+
+	while (1) {
+		// copy the packet out so the slot is free again even if the packet
+		// causes an error
+		Sys_LockMutex(q->mutex);
+		if (q->head == q->tail) {
+			Sys_UnlockMutex(q->mutex);
+			break;
+		}
+		from = q->packets[q->tail % NET_RECV_QUEUE].from;
+		time = q->packets[q->tail % NET_RECV_QUEUE].time;
+		length = q->packets[q->tail % NET_RECV_QUEUE].length;
+		Sys_UnlockMutex(q->mutex);
+
+		Com_Memcpy(bufData, q->packets[q->tail % NET_RECV_QUEUE].data, length);
+
+		Sys_LockMutex(q->mutex);
+		q->tail++;
+		Sys_SignalCond(q->space);
+		Sys_UnlockMutex(q->mutex);
+
+		if (length >= (int)sizeof(bufData)) {
+			Com_Printf("Oversize packet from %s\n", NET_AdrToString(from));
+			continue;
+		}
+
+		if (net_dropsim->value > 0.0f && net_dropsim->value <= 100.0f) {
+			// com_dropsim->value percent of incoming packets get dropped.
+			if (rand() < (int)(((double)RAND_MAX) / 100.0 * (double)net_dropsim->value))
+				continue; // drop this packet
+		}
+
+		MSG_Init(&netmsg, bufData, sizeof(bufData));
+		netmsg.cursize = length;
+
+		packetTime = time;
+		if (com_sv_running->integer)
+			Com_RunAndTimeServerPacket(&from, &netmsg);
+		else
+			CL_PacketEvent(from, &netmsg);
+		packetTime = 0;
+	}
+
+	if (failed) {
+		Com_Printf("Warning: network receive thread failed (%i), reading on the main thread\n", lastError);
+		NET_StopRecvThread();
+	}
+}
+
+/*
+====================
+NET_PacketTime
+====================
+*/
+int NET_PacketTime(void) {
+	return packetTime ? packetTime : Sys_Milliseconds();
+}
+
+#ifdef USE_EPOLL
+/*
+====================
+NET_SetupPoll
+====================
+*/
+static qboolean NET_SetupPoll(void) {
+	SOCKET sockets[MAX_POLL_SOCKETS];
+	struct epoll_event ev;
+	int i, numSockets;
+
+	if (pollFd != -1) {
+		close(pollFd);
+	}
+
+	pollFd = epoll_create1(EPOLL_CLOEXEC);
+	if (pollFd == -1) {
+		return qfalse;
+	}
+
+	// sub-millisecond timeouts come from a timer in the set, epoll_wait only takes milliseconds
+	if (pollTimerFd == -1) {
+		pollTimerFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+	}
+	if (pollTimerFd != -1) {
+		memset(&ev, 0, sizeof(ev));
+		ev.events = EPOLLIN;
+		ev.data.fd = pollTimerFd;
+		if (epoll_ctl(pollFd, EPOLL_CTL_ADD, pollTimerFd, &ev) == -1) {
+			close(pollTimerFd);
+			pollTimerFd = -1;
+		}
+	}
+
+	numSockets = NET_PollSockets(sockets);
+	for (i = 0; i < numSockets; i++) {
+		memset(&ev, 0, sizeof(ev));
+		ev.events = EPOLLIN;
+		ev.data.fd = sockets[i];
+		if (epoll_ctl(pollFd, EPOLL_CTL_ADD, sockets[i], &ev) == -1) {
+			return qfalse;
+		}
+	}
+
+	return qtrue;
+}
+
+/*
+====================
+NET_Poll
+====================
+*/
+static int NET_Poll(int usec, fd_set *fdr) {
+	struct epoll_event events[MAX_POLL_SOCKETS + 1];
+	struct itimerspec timer;
+	int i, n, ret;
+	int msec;
+
+	if (!usec) {
+		msec = 0;
+	} else if (usec % 1000 == 0 || pollTimerFd == -1) {
+		msec = usec / 1000;
+	} else {
+		memset(&timer, 0, sizeof(timer));
+		timer.it_value.tv_sec = usec / 1000000;
+		timer.it_value.tv_nsec = (usec % 1000000) * 1000;
+		if (timerfd_settime(pollTimerFd, 0, &timer, NULL) == -1) {
+			msec = usec / 1000;
+		} else {
+			msec = -1;
+		}
+	}
+
+	n = epoll_wait(pollFd, events, ARRAY_LEN(events), msec);
+	if (n == -1) {
+		return errno == EINTR ? 0 : SOCKET_ERROR;
+	}
+
+	ret = 0;
+	for (i = 0; i < n; i++) {
+		if (events[i].data.fd != pollTimerFd) {
+			FD_SET(events[i].data.fd, fdr);
+			ret++;
+		}
+	}
+
+	return ret;
+}
+#endif
+
+#ifdef USE_KQUEUE
+/*
+====================
+NET_SetupPoll
+====================
+*/
+static qboolean NET_SetupPoll(void) {
+	SOCKET sockets[MAX_POLL_SOCKETS];
+	struct kevent changes[MAX_POLL_SOCKETS];
+	int i, numSockets;
+
+	if (pollFd != -1) {
+		close(pollFd);
+	}
+
+	pollFd = kqueue();
+	if (pollFd == -1) {
+		return qfalse;
+	}
+
+	numSockets = NET_PollSockets(sockets);
+	for (i = 0; i < numSockets; i++) {
+		EV_SET(&changes[i], sockets[i], EVFILT_READ, EV_ADD, 0, 0, NULL);
+	}
+
+	return kevent(pollFd, changes, numSockets, NULL, 0, NULL) != -1;
+}
+
+/*
+====================
+NET_Poll
+====================
+*/
+static int NET_Poll(int usec, fd_set *fdr) {
+	struct kevent events[MAX_POLL_SOCKETS];
+	struct timespec timeout;
+	int i, n;
+
+	timeout.tv_sec = usec / 1000000;
+	timeout.tv_nsec = (usec % 1000000) * 1000;
+
+	n = kevent(pollFd, NULL, 0, events, ARRAY_LEN(events), &timeout);
+	if (n == -1) {
+		return errno == EINTR ? 0 : SOCKET_ERROR;
+	}
+
+	for (i = 0; i < n; i++) {
+		FD_SET(events[i].ident, fdr);
+	}
+
+	return n;
+}
+#endif
+
 /*
 ====================
 NET_Sleep
 
-Sleeps msec or until something happens on the network
+Sleeps usec microseconds or until something happens on the network
 ====================
 */
-void NET_Sleep(int msec) {
+void NET_Sleep(int usec) {
 	struct timeval timeout;
 	fd_set fdr;
 	int retval;
+	SOCKET sockets[MAX_POLL_SOCKETS];
 	SOCKET highestfd = INVALID_SOCKET;
+	int i, numSockets;
 
-	if (msec < 0)
-		msec = 0;
+	if (usec < 0)
+		usec = 0;
+
+	// a packet that ended in an error doesn't get to keep its time
+	packetTime = 0;
+
+	if (recvQueue) {
+		NET_RecvQueueEvent(usec);
+		return;
+	}
 
 	FD_ZERO(&fdr);
 
-	if (ip_socket != INVALID_SOCKET) {
-		FD_SET(ip_socket, &fdr);
+#if defined(USE_EPOLL) || defined(USE_KQUEUE)
+	if (pollSocketsChanged && !pollFailed) {
+		pollSocketsChanged = qfalse;
+		if (!NET_SetupPoll()) {
+			Com_Printf("Warning: NET_Sleep: %s, falling back to select()\n", NET_ErrorString());
+			pollFailed = qtrue;
+		}
+	}
 
-		highestfd = ip_socket;
+	if (!pollFailed) {
+		retval = NET_Poll(usec, &fdr);
+
+		if (retval == SOCKET_ERROR)
+			Com_Printf("Warning: NET_Sleep: %s\n", NET_ErrorString());
+		else if (retval > 0)
+			NET_Event(&fdr);
+		return;
 	}
-	if (ip6_socket != INVALID_SOCKET) {
-		FD_SET(ip6_socket, &fdr);
+#endif
+
+	numSockets = NET_PollSockets(sockets);
+	for (i = 0; i < numSockets; i++) {
+		FD_SET(sockets[i], &fdr);
 
-		if (highestfd == INVALID_SOCKET || ip6_socket > highestfd)
-			highestfd = ip6_socket;
+		if (highestfd == INVALID_SOCKET || sockets[i] > highestfd)
+			highestfd = sockets[i];
 	}
 
 #ifdef _WIN32
 	if (highestfd == INVALID_SOCKET) {
 		// windows ain't happy when select is called without valid FDs
-		SleepEx(msec, 0);
+		SleepEx(usec / 1000, 0);
 		return;
 	}
 #endif
 
-	timeout.tv_sec = msec / 1000;
-	timeout.tv_usec = (msec % 1000) * 1000;
+	timeout.tv_sec = usec / 1000000;
+	timeout.tv_usec = usec % 1000000;
 
 	retval = select(highestfd + 1, &fdr, NULL, NULL, &timeout);
 
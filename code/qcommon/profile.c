@@ -0,0 +1,369 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+// profile.c -- frame profiler, records named zones per thread and writes
+// them out as a Chrome trace
+
+#include "q_shared.h"
+#include "qcommon.h"
+
+#define PROFILE_MAX_FRAMES 1000
+
+typedef struct {
+	const char *name;
+	int64_t start;
+	int duration; // -1 for a counter sample
+	float value;
+} profileEvent_t;
+
+typedef struct {
+	// a ring of the last profileRingSize zones that closed, allocated by
+	// the thread on its first zone of a capture
+	profileEvent_t *events;
+	unsigned int numEvents; // closed this capture, the ring keeps the newest
+
+	// zones still open, a stack left over from an earlier capture is dropped
+	int capture;
+	int depth;
+	const char *names[PROFILE_MAX_DEPTH];
+	int64_t starts[PROFILE_MAX_DEPTH];
+} profileThread_t;
+
+int com_profiling;
+
+static profileThread_t profileThreads[MAX_JOB_THREADS + 1];
+static int profileCapture;
+static unsigned int profileRingSize; // a power of two
+static int profileFramesLeft;
+static int64_t profileStartTime;
+static char profileFileName[MAX_QPATH];
+
+static cvar_t *com_profileEvents;
+
+// the main thread's open zones, kept while PROFILE_WATCH is set so the
+// hitch watchdog can tell where a stalled frame is
+static const char *volatile profileMainNames[PROFILE_MAX_DEPTH];
+static volatile int profileMainDepth;
+
+/*
+=================
+Com_ProfileBegin
+
+Opens a zone on the calling thread, name must stay valid until the capture
+has been written
+=================
+*/
+void Com_ProfileBegin(const char *name) {
+	profileThread_t *pt;
+
+	if ((com_profiling & PROFILE_WATCH) && !Com_JobThreadIndex()) {
+		if (profileMainDepth < PROFILE_MAX_DEPTH) {
+			profileMainNames[profileMainDepth] = name;
+		}
+		profileMainDepth++;
+	}
+
+	if (!(com_profiling & PROFILE_CAPTURE)) {
+		return;
+	}
+
+	pt = &profileThreads[Com_JobThreadIndex()];
+	if (pt->capture != profileCapture) {
+		pt->capture = profileCapture;
+		pt->depth = 0;
+	}
+
+	// zones nested too deep aren't recorded, but still counted so that
+	// the ends pair up
+	if (pt->depth < PROFILE_MAX_DEPTH) {
+		pt->names[pt->depth] = name;
+		pt->starts[pt->depth] = Sys_Microseconds();
+	}
+	pt->depth++;
+}
+
+/*
+=================
+Com_ProfileEnd
+
+Closes the innermost zone of the calling thread
+=================
+*/
+void Com_ProfileEnd(void) {
+	profileThread_t *pt;
+	profileEvent_t *ev;
+
+	if ((com_profiling & PROFILE_WATCH) && !Com_JobThreadIndex() && profileMainDepth > 0) {
+		profileMainDepth--;
+	}
+
+	if (!(com_profiling & PROFILE_CAPTURE)) {
+		return;
+	}
+
+	pt = &profileThreads[Com_JobThreadIndex()];
+
+	// the zone was opened before the capture started
+	if (pt->capture != profileCapture || pt->depth <= 0) {
+		return;
+	}
+
+	if (--pt->depth >= PROFILE_MAX_DEPTH) {
+		return;
+	}
+
+	if (!pt->events) {
+		pt->events = malloc(profileRingSize * sizeof(*pt->events));
+		if (!pt->events) {
+			return;
+		}
+	}
+
+	ev = &pt->events[pt->numEvents++ & (profileRingSize - 1)];
+	ev->name = pt->names[pt->depth];
+	ev->start = pt->starts[pt->depth];
+	ev->duration = Sys_Microseconds() - ev->start;
+}
+
+/*
+=================
+Com_ProfileCounter
+
+Records a sample of a named value on the calling thread, shown as its own
+track in the trace.  Used for numbers measured elsewhere, like GPU times
+read back a few frames late.
+=================
+*/
+void Com_ProfileCounter(const char *name, float value) {
+	profileThread_t *pt;
+	profileEvent_t *ev;
+
+	if (!(com_profiling & PROFILE_CAPTURE)) {
+		return;
+	}
+
+	pt = &profileThreads[Com_JobThreadIndex()];
+	if (pt->capture != profileCapture) {
+		pt->capture = profileCapture;
+		pt->depth = 0;
+	}
+
+	if (!pt->events) {
+		pt->events = malloc(profileRingSize * sizeof(*pt->events));
+		if (!pt->events) {
+			return;
+		}
+	}
+
+	ev = &pt->events[pt->numEvents++ & (profileRingSize - 1)];
+	ev->name = name;
+	ev->start = Sys_Microseconds();
+	ev->duration = -1;
+	ev->value = value;
+}
+
+/*
+=================
+Com_ProfileWrite
+
+Writes the capture out in the Chrome trace event format, which
+chrome://tracing and Perfetto can load, and frees the rings.
+Only called between frames, while the job workers are idle.
+=================
+*/
+static void Com_ProfileWrite(void) {
+	fileHandle_t f;
+	profileThread_t *pt;
+	profileEvent_t *ev;
+	unsigned int first, i;
+	int t, numEvents, numDropped;
+	qboolean comma;
+
+	f = FS_FOpenFileWrite(profileFileName);
+	if (!f) {
+		Com_Printf(S_COLOR_YELLOW "WARNING: couldn't open %s\n", profileFileName);
+	}
+
+	numEvents = 0;
+	numDropped = 0;
+	comma = qfalse;
+
+	if (f) {
+		FS_Printf(f, "{\"traceEvents\":[\n");
+	}
+
+	for (t = 0; t <= MAX_JOB_THREADS; t++) {
+		pt = &profileThreads[t];
+		if (!pt->events) {
+			continue;
+		}
+
+		first = 0;
+		if (pt->numEvents > profileRingSize) {
+			first = pt->numEvents - profileRingSize;
+		}
+		numDropped += first;
+
+		if (f) {
+			FS_Printf(f, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%i,\"args\":{\"name\":\"%s\"}}",
+					  comma ? ",\n" : "", t, t ? va("job %i", t) : "main");
+			comma = qtrue;
+
+			for (i = first; i < pt->numEvents; i++) {
+				ev = &pt->events[i & (profileRingSize - 1)];
+				if (ev->duration < 0) {
+					FS_Printf(f, ",\n{\"name\":\"%s\",\"ph\":\"C\",\"pid\":0,\"ts\":%i,\"args\":{\"value\":%.3f}}",
+							  ev->name, (int)(ev->start - profileStartTime), ev->value);
+					continue;
+				}
+				FS_Printf(f, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":%i,\"ts\":%i,\"dur\":%i}", ev->name, t,
+						  (int)(ev->start - profileStartTime), ev->duration);
+			}
+		}
+		numEvents += pt->numEvents - first;
+
+		free(pt->events);
+		pt->events = NULL;
+		pt->numEvents = 0;
+	}
+
+	if (f) {
+		FS_Printf(f, "\n]}\n");
+		FS_FCloseFile(f);
+		Com_Printf("Wrote %i zones to %s\n", numEvents, profileFileName);
+	}
+
+	if (numDropped) {
+		Com_Printf("%i older zones didn't fit com_profileEvents and were dropped\n", numDropped);
+	}
+}
+
+/*
+=================
+Com_ProfileFrame
+
+Called at the start of every frame.  Ends the capture once its frames
+have run, and drops the zones an ERR_DROP left open on the main thread.
+=================
+*/
+void Com_ProfileFrame(void) {
+	profileMainDepth = 0;
+
+	if (!(com_profiling & PROFILE_CAPTURE)) {
+		return;
+	}
+
+	profileThreads[0].depth = 0;
+
+	if (--profileFramesLeft > 0) {
+		return;
+	}
+
+	com_profiling &= ~PROFILE_CAPTURE;
+	Com_ProfileWrite();
+}
+
+/*
+=================
+Com_ProfileMainZones
+
+Copies the names of the zones open on the main thread, outermost first
+=================
+*/
+int Com_ProfileMainZones(const char **names, int maxNames) {
+	int depth = profileMainDepth;
+	int i;
+
+	if (depth > PROFILE_MAX_DEPTH) {
+		depth = PROFILE_MAX_DEPTH;
+	}
+	if (depth > maxNames) {
+		depth = maxNames;
+	}
+
+	for (i = 0; i < depth; i++) {
+		names[i] = profileMainNames[i];
+	}
+
+	return depth;
+}
+
+/*
+=================
+Com_ProfileCapture_f
+=================
+*/
+static void Com_ProfileCapture_f(void) {
+	qtime_t now;
+	int frames;
+
+	if (Cmd_Argc() < 2 || Cmd_Argc() > 3) {
+		Com_Printf("usage: profile_capture <frames> [filename]\n");
+		return;
+	}
+
+	if (com_profiling & PROFILE_CAPTURE) {
+		Com_Printf("A capture is already running, %i frames left\n", profileFramesLeft - 1);
+		return;
+	}
+
+	frames = atoi(Cmd_Argv(1));
+	if (frames < 1 || frames > PROFILE_MAX_FRAMES) {
+		Com_Printf("frames must be between 1 and %i\n", PROFILE_MAX_FRAMES);
+		return;
+	}
+
+	if (Cmd_Argc() == 3) {
+		Com_sprintf(profileFileName, sizeof(profileFileName), "profile/%s", Cmd_Argv(2));
+		COM_DefaultExtension(profileFileName, sizeof(profileFileName), ".json");
+	} else {
+		Com_RealTime(&now);
+		Com_sprintf(profileFileName, sizeof(profileFileName), "profile/capture_%04d%02d%02d_%02d%02d%02d.json",
+					1900 + now.tm_year, 1 + now.tm_mon, now.tm_mday, now.tm_hour, now.tm_min, now.tm_sec);
+	}
+
+	profileRingSize = 1024;
+	while (profileRingSize < (unsigned int)com_profileEvents->integer && profileRingSize < (1 << 24)) {
+		profileRingSize <<= 1;
+	}
+
+	// the partial frame the command runs in isn't counted
+	profileFramesLeft = frames + 1;
+	profileStartTime = Sys_Microseconds();
+	profileCapture++;
+	com_profiling |= PROFILE_CAPTURE;
+
+	Com_Printf("Capturing %i frames to %s\n", frames, profileFileName);
+}
+
+/*
+=================
+Com_InitProfile
+=================
+*/
+void Com_InitProfile(void) {
+	com_profileEvents = Cvar_Get("com_profileEvents", "65536", CVAR_ARCHIVE);
+	Cvar_CheckRange(com_profileEvents, 1024, 1 << 24, qtrue);
+	Cvar_SetDescription(com_profileEvents,
+						"Zones each thread keeps during a profile_capture, older ones are dropped once it is full");
+
+	Cmd_AddCommand("profile_capture", Com_ProfileCapture_f);
+}
@@ -31,6 +31,11 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 #include "q_shared.h"
 
+#if !defined(Q3_VM) && (idx64 || defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1))
+#define Q_MATH_SSE
+#include <xmmintrin.h>
+#endif
+
 const vec3_t vec3_origin = {0, 0, 0};
 vec3_t axisDefault[3] = {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
 
@@ -647,6 +652,153 @@ int BoxOnPlaneSide(vec3_t emins, vec3_t emaxs, struct cplane_s *p) {
 	return sides;
 }
 
+#ifndef Q3_VM
+#ifdef Q_MATH_SSE
+// x, y, z and a zero w, without reading past the vec3_t
+static ID_INLINE __m128 Q_LoadVec3(const vec3_t v) {
+	return _mm_movelh_ps(_mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)v), _mm_load_ss(&v[2]));
+}
+
+static ID_INLINE void Q_StoreVec3(vec3_t out, __m128 v) {
+	_mm_storel_pi((__m64 *)out, v);
+	_mm_store_ss(&out[2], _mm_movehl_ps(v, v));
+}
+#endif
+
+/*
+=================
+TransformPoints
+
+Moves points from the space of origin and axis into the outer one, summed
+in the same order as the renderers' R_LocalPointToWorld. in and out may be
+the same array.
+=================
+*/
+void TransformPoints(const vec3_t origin, vec3_t axis[3], vec3_t *in, vec3_t *out, int numPoints) {
+	int i;
+#ifdef Q_MATH_SSE
+	__m128 a0 = Q_LoadVec3(axis[0]);
+	__m128 a1 = Q_LoadVec3(axis[1]);
+	__m128 a2 = Q_LoadVec3(axis[2]);
+	__m128 o = Q_LoadVec3(origin);
+
+	for (i = 0; i < numPoints; i++) {
+		__m128 p = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(in[i][0]), a0), _mm_mul_ps(_mm_set1_ps(in[i][1]), a1));
+
+		p = _mm_add_ps(p, _mm_mul_ps(_mm_set1_ps(in[i][2]), a2));
+		Q_StoreVec3(out[i], _mm_add_ps(p, o));
+	}
+#else
+	for (i = 0; i < numPoints; i++) {
+		vec3_t p;
+
+		VectorCopy(in[i], p);
+		out[i][0] = p[0] * axis[0][0] + p[1] * axis[1][0] + p[2] * axis[2][0] + origin[0];
+		out[i][1] = p[0] * axis[0][1] + p[1] * axis[1][1] + p[2] * axis[2][1] + origin[1];
+		out[i][2] = p[0] * axis[0][2] + p[1] * axis[1][2] + p[2] * axis[2][2] + origin[2];
+	}
+#endif
+}
+
+/*
+=================
+CullBoxes
+
+Tests boxes, six floats each laid out as vec3_t bounds[2], against a set of
+planes facing inwards. cull gets 0 for a box in front of all of them, 1 for
+one crossing any and 2 for one behind any, the renderers' CULL_IN, CULL_CLIP
+and CULL_OUT. The SSE path takes four planes at a time with the general
+case of BoxOnPlaneSide, so a box exactly touching an axial plane may come
+out as crossing instead of behind.
+=================
+*/
+void CullBoxes(const float *bounds, int numBoxes, const struct cplane_s *planes, int numPlanes, byte *cull) {
+	int i;
+#ifdef Q_MATH_SSE
+	int j, p;
+
+	for (i = 0; i < numBoxes; i++)
+		cull[i] = 0;
+
+	for (p = 0; p < numPlanes; p += 4) {
+		vec4a_t nx, ny, nz, dist;
+		__m128 vnx, vny, vnz, vdist, negx, negy, negz;
+
+		// transpose the planes, unused lanes have every box in front
+		for (j = 0; j < 4; j++) {
+			if (p + j < numPlanes) {
+				nx[j] = planes[p + j].normal[0];
+				ny[j] = planes[p + j].normal[1];
+				nz[j] = planes[p + j].normal[2];
+				dist[j] = planes[p + j].dist;
+			} else {
+				nx[j] = ny[j] = nz[j] = 0;
+				dist[j] = -1;
+			}
+		}
+
+		vnx = _mm_load_ps(nx);
+		vny = _mm_load_ps(ny);
+		vnz = _mm_load_ps(nz);
+		vdist = _mm_load_ps(dist);
+
+		// the same test as signbits
+		negx = _mm_cmplt_ps(vnx, _mm_setzero_ps());
+		negy = _mm_cmplt_ps(vny, _mm_setzero_ps());
+		negz = _mm_cmplt_ps(vnz, _mm_setzero_ps());
+
+		for (i = 0; i < numBoxes; i++) {
+			const float *b = bounds + i * 6;
+			__m128 minx = _mm_set1_ps(b[0]), miny = _mm_set1_ps(b[1]), minz = _mm_set1_ps(b[2]);
+			__m128 maxx = _mm_set1_ps(b[3]), maxy = _mm_set1_ps(b[4]), maxz = _mm_set1_ps(b[5]);
+			__m128 d0, d1;
+			int front, back;
+
+			if (cull[i] == 2)
+				continue;
+
+			// the corners furthest along and furthest against each normal
+			d0 = _mm_mul_ps(vnx, _mm_or_ps(_mm_and_ps(negx, minx), _mm_andnot_ps(negx, maxx)));
+			d0 = _mm_add_ps(d0, _mm_mul_ps(vny, _mm_or_ps(_mm_and_ps(negy, miny), _mm_andnot_ps(negy, maxy))));
+			d0 = _mm_add_ps(d0, _mm_mul_ps(vnz, _mm_or_ps(_mm_and_ps(negz, minz), _mm_andnot_ps(negz, maxz))));
+
+			d1 = _mm_mul_ps(vnx, _mm_or_ps(_mm_and_ps(negx, maxx), _mm_andnot_ps(negx, minx)));
+			d1 = _mm_add_ps(d1, _mm_mul_ps(vny, _mm_or_ps(_mm_and_ps(negy, maxy), _mm_andnot_ps(negy, miny))));
+			d1 = _mm_add_ps(d1, _mm_mul_ps(vnz, _mm_or_ps(_mm_and_ps(negz, maxz), _mm_andnot_ps(negz, minz))));
+
+			front = _mm_movemask_ps(_mm_cmpge_ps(d0, vdist));
+			back = _mm_movemask_ps(_mm_cmplt_ps(d1, vdist));
+
+			if (front != 15)
+				cull[i] = 2;
+			else if (back)
+				cull[i] = 1;
+		}
+	}
+#else
+	for (i = 0; i < numBoxes; i++) {
+		vec3_t mins, maxs;
+		int j, sides;
+
+		VectorCopy(bounds + i * 6, mins);
+		VectorCopy(bounds + i * 6 + 3, maxs);
+
+		cull[i] = 0;
+		for (j = 0; j < numPlanes; j++) {
+			sides = BoxOnPlaneSide(mins, maxs, (struct cplane_s *)&planes[j]);
+
+			if (sides == 2) {
+				cull[i] = 2;
+				break;
+			}
+			if (sides == 3)
+				cull[i] = 1;
+		}
+	}
+#endif
+}
+#endif
+
 /*
 =================
 RadiusFromBounds
@@ -721,6 +873,190 @@ qboolean BoundsIntersectPoint(const vec3_t mins, const vec3_t maxs, const vec3_t
 	return qtrue;
 }
 
+/*
+=================
+BoxClipBox
+
+Everything of BoxTraceBox but the end position
+=================
+*/
+static void BoxClipBox(trace_t *results, const vec3_t start, const vec3_t end, const vec3_t mins, const vec3_t maxs,
+					   const vec3_t boxmins, const vec3_t boxmaxs, const vec3_t origin, int brushmask) {
+	vec3_t offset, symetricSize[2];
+	vec3_t size[2], bounds[2];
+	vec3_t start_l, end_l;
+	vec3_t tstart, tend;
+	float dist, d1, d2, f;
+	float enterFrac, leaveFrac;
+	qboolean getout, startout;
+	int i, side, clipSide;
+
+	// allow NULL to be passed in for 0,0,0
+	if (!mins) {
+		mins = vec3_origin;
+	}
+	if (!maxs) {
+		maxs = vec3_origin;
+	}
+
+	// the symetric size and origin offset of CM_TransformedBoxTrace
+	for (i = 0; i < 3; i++) {
+		offset[i] = (mins[i] + maxs[i]) * 0.5;
+		symetricSize[0][i] = mins[i] - offset[i];
+		symetricSize[1][i] = maxs[i] - offset[i];
+		start_l[i] = start[i] + offset[i] - origin[i];
+		end_l[i] = end[i] + offset[i] - origin[i];
+	}
+
+	// and the ones of CM_Trace on top
+	for (i = 0; i < 3; i++) {
+		offset[i] = (symetricSize[0][i] + symetricSize[1][i]) * 0.5;
+		size[0][i] = symetricSize[0][i] - offset[i];
+		size[1][i] = symetricSize[1][i] - offset[i];
+		tstart[i] = start_l[i] + offset[i];
+		tend[i] = end_l[i] + offset[i];
+		if (tstart[i] < tend[i]) {
+			bounds[0][i] = tstart[i] + size[0][i];
+			bounds[1][i] = tend[i] + size[1][i];
+		} else {
+			bounds[0][i] = tend[i] + size[0][i];
+			bounds[1][i] = tstart[i] + size[1][i];
+		}
+	}
+
+	if (!(brushmask & CONTENTS_BODY)) {
+		return;
+	}
+
+	if (start_l[0] == end_l[0] && start_l[1] == end_l[1] && start_l[2] == end_l[2]) {
+		// position test
+		for (i = 0; i < 3; i++) {
+			if (bounds[0][i] > boxmaxs[i] || bounds[1][i] < boxmins[i]) {
+				return;
+			}
+		}
+		results->startsolid = results->allsolid = qtrue;
+		results->fraction = 0;
+		results->contents = CONTENTS_BODY;
+		return;
+	}
+
+	for (i = 0; i < 3; i++) {
+		if (bounds[1][i] < boxmins[i] - SURFACE_CLIP_EPSILON || bounds[0][i] > boxmaxs[i] + SURFACE_CLIP_EPSILON) {
+			return;
+		}
+	}
+
+	enterFrac = -1.0;
+	leaveFrac = 1.0;
+	clipSide = -1;
+	getout = qfalse;
+	startout = qfalse;
+
+	// the sides of the box brush are +x, -x, +y, -y, +z, -z
+	for (side = 0; side < 6; side++) {
+		i = side >> 1;
+		if (!(side & 1)) {
+			dist = boxmaxs[i] - size[0][i];
+			d1 = tstart[i] - dist;
+			d2 = tend[i] - dist;
+		} else {
+			dist = -boxmins[i] + size[1][i];
+			d1 = -tstart[i] - dist;
+			d2 = -tend[i] - dist;
+		}
+
+		if (d2 > 0) {
+			getout = qtrue; // endpoint is not in solid
+		}
+		if (d1 > 0) {
+			startout = qtrue;
+		}
+
+		// if completely in front of face, no intersection with the entire brush
+		if (d1 > 0 && (d2 >= SURFACE_CLIP_EPSILON || d2 >= d1)) {
+			return;
+		}
+
+		// if it doesn't cross the plane, the plane isn't relevant
+		if (d1 <= 0 && d2 <= 0) {
+			continue;
+		}
+
+		// crosses face
+		if (d1 > d2) { // enter
+			f = (d1 - SURFACE_CLIP_EPSILON) / (d1 - d2);
+			if (f < 0) {
+				f = 0;
+			}
+			if (f > enterFrac) {
+				enterFrac = f;
+				clipSide = side;
+			}
+		} else { // leave
+			f = (d1 + SURFACE_CLIP_EPSILON) / (d1 - d2);
+			if (f > 1) {
+				f = 1;
+			}
+			if (f < leaveFrac) {
+				leaveFrac = f;
+			}
+		}
+	}
+
+	if (!startout) { // original point was inside brush
+		results->startsolid = qtrue;
+		if (!getout) {
+			results->allsolid = qtrue;
+			results->fraction = 0;
+			results->contents = CONTENTS_BODY;
+		}
+	} else if (enterFrac < leaveFrac && enterFrac > -1 && enterFrac < 1) {
+		if (enterFrac < 0) {
+			enterFrac = 0;
+		}
+		results->fraction = enterFrac;
+
+		i = clipSide >> 1;
+		if (!(clipSide & 1)) {
+			results->plane.normal[i] = 1;
+			results->plane.dist = boxmaxs[i];
+			results->plane.type = i;
+		} else {
+			results->plane.normal[i] = -1;
+			results->plane.dist = -boxmins[i];
+			results->plane.type = 3 + i;
+			results->plane.signbits = 1 << i;
+		}
+		results->contents = CONTENTS_BODY;
+	}
+}
+
+/*
+=================
+BoxTraceBox
+
+Sweeps the box start->end (mins/maxs) against the temporary box model
+of an entity (boxmins/boxmaxs at origin), with the same results the
+collision code gives for CM_TempBoxModel and CM_TransformedBoxTrace,
+but without building the model and going through its brush.  The
+temporary box is CONTENTS_BODY and its planes stay relative to origin.
+=================
+*/
+void BoxTraceBox(trace_t *results, const vec3_t start, const vec3_t end, const vec3_t mins, const vec3_t maxs,
+				 const vec3_t boxmins, const vec3_t boxmaxs, const vec3_t origin, int brushmask) {
+	int i;
+
+	Com_Memset(results, 0, sizeof(*results));
+	results->fraction = 1;
+
+	BoxClipBox(results, start, end, mins, maxs, boxmins, boxmaxs, origin, brushmask);
+
+	for (i = 0; i < 3; i++) {
+		results->endpos[i] = start[i] + results->fraction * (end[i] - start[i]);
+	}
+}
+
 vec_t VectorNormalize(vec3_t v) {
 	// NOTE: TTimo - Apple G4 altivec source uses double?
 	float length, ilength;
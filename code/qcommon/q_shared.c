@@ -367,35 +367,6 @@ void COM_ParseWarning(const char *format, ...) {
 	Com_Printf("WARNING: %s, line %d: %s\n", com_parsename, COM_GetCurrentParseLine(), string);
 }
 
-/*
-==============
-COM_Parse
-
-Parse a token out of a string
-Will never return NULL, just empty strings
-
-If "allowLineBreaks" is qtrue then an empty
-string will be returned if the next token is
-a newline.
-==============
-*/
-static const char *SkipWhitespace(const char *data, qboolean *hasNewLines) {
-	int c;
-
-	while ((c = *data) <= ' ') {
-		if (!c) {
-			return NULL;
-		}
-		if (c == '\n') {
-			com_lines++;
-			*hasNewLines = qtrue;
-		}
-		data++;
-	}
-
-	return data;
-}
-
 int COM_Compress(char *data_p) {
 	const char *in;
 	char *out;
@@ -467,50 +438,65 @@ int COM_Compress(char *data_p) {
 	return out - data_p;
 }
 
-const char *COM_ParseExt(const char **data_p, qboolean allowLineBreaks) {
-	char c = 0;
-	int len;
-	qboolean hasNewLines = qfalse;
-	const char *data;
+/*
+==============
+COM_ParseView
 
-	data = *data_p;
-	len = 0;
-	com_token[0] = 0;
-	com_tokenline = 0;
+Finds the next token without copying it.  token->text points into the
+parsed data and is not terminated, quoted strings are returned without
+the quotes.  Nothing is shared between calls, newlines are counted in
+lines if it isn't NULL, so it can run on any thread.
 
-	// make sure incoming data is valid
-	if (!data) {
-		*data_p = NULL;
-		return com_token;
-	}
+Returns qfalse at the end of the data, or if allowLineBreaks is qfalse
+and the next token is on another line.  *data_p is never set to NULL.
+==============
+*/
+qboolean COM_ParseView(const char **data_p, qboolean allowLineBreaks, int *lines, comTokenView_t *token) {
+	const char *data = *data_p;
+	int line = lines ? *lines : 0;
+	qboolean hasNewLines = qfalse;
+
+	token->text = data;
+	token->length = 0;
+	token->line = 0;
 
 	while (1) {
 		// skip whitespace
-		data = SkipWhitespace(data, &hasNewLines);
-		if (!data) {
-			*data_p = NULL;
-			return com_token;
+		while (*data <= ' ') {
+			if (!*data) {
+				*data_p = data;
+				if (lines) {
+					*lines = line;
+				}
+				return qfalse;
+			}
+			if (*data == '\n') {
+				line++;
+				hasNewLines = qtrue;
+			}
+			data++;
 		}
 		if (hasNewLines && !allowLineBreaks) {
 			*data_p = data;
-			return com_token;
+			if (lines) {
+				*lines = line;
+			}
+			return qfalse;
 		}
 
-		c = *data;
-
 		// skip double slash comments
-		if (c == '/' && data[1] == '/') {
+		if (data[0] == '/' && data[1] == '/') {
 			data += 2;
 			while (*data && *data != '\n') {
 				data++;
 			}
 		}
 		// skip /* */ comments
-		else if (c == '/' && data[1] == '*') {
+		else if (data[0] == '/' && data[1] == '*') {
 			data += 2;
 			while (*data && (*data != '*' || data[1] != '/')) {
 				if (*data == '\n') {
-					com_lines++;
+					line++;
 				}
 				data++;
 			}
@@ -523,41 +509,98 @@ const char *COM_ParseExt(const char **data_p, qboolean allowLineBreaks) {
 	}
 
 	// token starts on this line
-	com_tokenline = com_lines;
+	token->line = line;
 
 	// handle quoted strings
-	if (c == '\"') {
-		data++;
-		while (1) {
-			c = *data++;
-			if (c == '\"' || !c) {
-				com_token[len] = 0;
-				*data_p = (char *)data;
-				return com_token;
-			}
-			if (c == '\n') {
-				com_lines++;
-			}
-			if (len < MAX_TOKEN_CHARS - 1) {
-				com_token[len] = c;
-				len++;
+	if (*data == '\"') {
+		token->text = ++data;
+		while (*data && *data != '\"') {
+			if (*data == '\n') {
+				line++;
 			}
+			data++;
 		}
+		token->length = data - token->text;
+		*data_p = *data ? data + 1 : data;
+	} else {
+		// parse a regular word
+		token->text = data;
+		do {
+			data++;
+		} while (*data > ' ');
+		token->length = data - token->text;
+		*data_p = data;
 	}
 
-	// parse a regular word
-	do {
-		if (len < MAX_TOKEN_CHARS - 1) {
-			com_token[len] = c;
-			len++;
-		}
-		data++;
-		c = *data;
-	} while (c > 32);
+	if (lines) {
+		*lines = line;
+	}
+	return qtrue;
+}
 
-	com_token[len] = 0;
+/*
+==============
+COM_ViewEquals
+
+Case insensitive compare of a token view with a string
+==============
+*/
+qboolean COM_ViewEquals(const comTokenView_t *token, const char *s) {
+	return !Q_stricmpn(token->text, s, token->length) && !s[token->length];
+}
+
+/*
+==============
+COM_ViewCopy
+
+Copies a token view to a string, truncating it if needed
+==============
+*/
+void COM_ViewCopy(const comTokenView_t *token, char *dest, int size) {
+	int len;
+
+	if (size < 1) {
+		return;
+	}
 
-	*data_p = (char *)data;
+	len = MIN(token->length, size - 1);
+	memcpy(dest, token->text, len);
+	dest[len] = 0;
+}
+
+/*
+==============
+COM_Parse
+
+Parse a token out of a string
+Will never return NULL, just empty strings
+
+If "allowLineBreaks" is qtrue then an empty
+string will be returned if the next token is
+a newline.
+==============
+*/
+const char *COM_ParseExt(const char **data_p, qboolean allowLineBreaks) {
+	comTokenView_t token;
+
+	com_tokenline = 0;
+
+	// make sure incoming data is valid
+	if (!*data_p) {
+		com_token[0] = 0;
+		return com_token;
+	}
+
+	if (!COM_ParseView(data_p, allowLineBreaks, &com_lines, &token)) {
+		if (!**data_p) {
+			*data_p = NULL;
+		}
+		com_token[0] = 0;
+		return com_token;
+	}
+
+	com_tokenline = token.line;
+	COM_ViewCopy(&token, com_token, sizeof(com_token));
 	return com_token;
 }
 
@@ -585,18 +628,43 @@ Internal brace depths are properly skipped.
 =================
 */
 qboolean SkipBracedSection(const char **program, int depth) {
-	const char *token;
+	qboolean skipped;
+
+	if (!*program) {
+		return (depth == 0);
+	}
+
+	skipped = COM_SkipBracedView(program, depth, &com_lines);
+	if (!**program) {
+		*program = NULL;
+	}
+
+	return skipped;
+}
+
+/*
+=================
+COM_SkipBracedView
+
+SkipBracedSection on token views, for any thread.  Newlines are counted
+in lines if it isn't NULL.
+=================
+*/
+qboolean COM_SkipBracedView(const char **data_p, int depth, int *lines) {
+	comTokenView_t token;
 
 	do {
-		token = COM_ParseExt(program, qtrue);
-		if (token[1] == 0) {
-			if (token[0] == '{') {
+		if (!COM_ParseView(data_p, qtrue, lines, &token)) {
+			break;
+		}
+		if (token.length == 1) {
+			if (token.text[0] == '{') {
 				depth++;
-			} else if (token[0] == '}') {
+			} else if (token.text[0] == '}') {
 				depth--;
 			}
 		}
-	} while (depth && *program);
+	} while (depth);
 
 	return (depth == 0);
 }
@@ -1370,6 +1438,343 @@ void Info_SetValueForKey_Big(char *s, const char *key, const char *value) {
 	strcat(s, newi);
 }
 
+/*
+=====================================================================
+
+  PARSED INFO STRINGS
+
+Keys are hashed case insensitively so lookups don't rescan the string.
+Pairs are kept in insertion order; a changed value that no longer fits
+in place and every new pair are appended to the data buffer, and removed
+pairs are only unlinked, so the buffer is compacted when it runs out.
+
+=====================================================================
+*/
+
+static int Info_DictHash(const char *key) {
+	unsigned hash = 0;
+
+	while (*key) {
+		hash = hash * 31 + tolower((unsigned char)*key++);
+	}
+
+	return hash & (INFO_HASH_SIZE - 1);
+}
+
+static int Info_DictFind(const infoDict_t *dict, const char *key, int hash) {
+	int i;
+
+	for (i = dict->hashHeads[hash]; i >= 0; i = dict->hashNext[i]) {
+		if (!Q_stricmp(dict->data + dict->keyOfs[i], key)) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+static void Info_DictLink(infoDict_t *dict, int i) {
+	int hash = Info_DictHash(dict->data + dict->keyOfs[i]);
+
+	dict->hashNext[i] = dict->hashHeads[hash];
+	dict->hashHeads[hash] = i;
+}
+
+static void Info_DictClear(infoDict_t *dict) {
+	int i;
+
+	dict->length = 0;
+	dict->numPairs = 0;
+	dict->dataUsed = 0;
+	for (i = 0; i < INFO_HASH_SIZE; i++) {
+		dict->hashHeads[i] = -1;
+	}
+}
+
+/*
+==================
+Info_DictCompact
+
+Drops removed pairs and stale values from the data buffer
+==================
+*/
+static void Info_DictCompact(infoDict_t *dict) {
+	static char scratch[BIG_INFO_STRING];
+	int numPairs, used, len, i;
+
+	numPairs = dict->numPairs;
+	used = 0;
+	for (i = 0; i < numPairs; i++) {
+		if (dict->keyOfs[i] < 0) {
+			continue;
+		}
+		len = strlen(dict->data + dict->keyOfs[i]) + 1;
+		memcpy(scratch + used, dict->data + dict->keyOfs[i], len);
+		dict->keyOfs[i] = used;
+		used += len;
+		len = strlen(dict->data + dict->valueOfs[i]) + 1;
+		memcpy(scratch + used, dict->data + dict->valueOfs[i], len);
+		dict->valueOfs[i] = used;
+		used += len;
+	}
+	memcpy(dict->data, scratch, used);
+
+	Info_DictClear(dict);
+	for (i = 0; i < numPairs; i++) {
+		if (dict->keyOfs[i] < 0) {
+			continue;
+		}
+		dict->keyOfs[dict->numPairs] = dict->keyOfs[i];
+		dict->valueOfs[dict->numPairs] = dict->valueOfs[i];
+		dict->length += strlen(dict->data + dict->keyOfs[i]) + strlen(dict->data + dict->valueOfs[i]) + 2;
+		Info_DictLink(dict, dict->numPairs);
+		dict->numPairs++;
+	}
+	dict->dataUsed = used;
+}
+
+/*
+==================
+Info_DictInit
+
+maxLength limits the serialized string the same way the info string
+functions do; keepEmpty retains zero-length values like the _Big variants
+==================
+*/
+void Info_DictInit(infoDict_t *dict, int maxLength, qboolean keepEmpty) {
+	if (maxLength > (int)sizeof(dict->data)) {
+		maxLength = sizeof(dict->data);
+	}
+	dict->maxLength = maxLength;
+	dict->keepEmpty = keepEmpty;
+	Info_DictClear(dict);
+}
+
+/*
+==================
+Info_DictParse
+
+Replaces the contents of the dictionary with the pairs of an info string.
+The first of several pairs with the same key wins, as in Info_ValueForKey.
+==================
+*/
+void Info_DictParse(infoDict_t *dict, const char *s) {
+	int start, keyOfs, valueOfs, length;
+	int size = sizeof(dict->data) - 1;
+
+	Info_DictClear(dict);
+
+	if (*s == '\\') {
+		s++;
+	}
+	while (*s && dict->numPairs < MAX_INFO_PAIRS) {
+		start = dict->dataUsed;
+
+		keyOfs = start;
+		while (*s != '\\') {
+			if (!*s || dict->dataUsed >= size) {
+				dict->dataUsed = start;
+				return;
+			}
+			dict->data[dict->dataUsed++] = *s++;
+		}
+		dict->data[dict->dataUsed++] = 0;
+		s++;
+
+		valueOfs = dict->dataUsed;
+		while (*s != '\\' && *s) {
+			if (dict->dataUsed >= size) {
+				dict->dataUsed = start;
+				return;
+			}
+			dict->data[dict->dataUsed++] = *s++;
+		}
+		dict->data[dict->dataUsed++] = 0;
+		if (*s) {
+			s++;
+		}
+
+		length = dict->length + dict->dataUsed - start;
+		if (length >= dict->maxLength) {
+			dict->dataUsed = start;
+			return;
+		}
+
+		if ((!dict->data[valueOfs] && !dict->keepEmpty) ||
+			Info_DictFind(dict, dict->data + keyOfs, Info_DictHash(dict->data + keyOfs)) >= 0) {
+			dict->dataUsed = start;
+			continue;
+		}
+
+		dict->keyOfs[dict->numPairs] = keyOfs;
+		dict->valueOfs[dict->numPairs] = valueOfs;
+		Info_DictLink(dict, dict->numPairs);
+		dict->numPairs++;
+		dict->length = length;
+	}
+}
+
+/*
+==================
+Info_DictValue
+
+Returns the value for the key, or an empty string. The pointer stays
+valid until the dictionary is changed.
+==================
+*/
+const char *Info_DictValue(const infoDict_t *dict, const char *key) {
+	int i;
+
+	if (!key) {
+		return "";
+	}
+
+	i = Info_DictFind(dict, key, Info_DictHash(key));
+	if (i < 0) {
+		return "";
+	}
+
+	return dict->data + dict->valueOfs[i];
+}
+
+/*
+==================
+Info_DictRemove
+==================
+*/
+void Info_DictRemove(infoDict_t *dict, const char *key) {
+	short *prev;
+	int hash, i;
+
+	hash = Info_DictHash(key);
+	for (prev = &dict->hashHeads[hash]; (i = *prev) >= 0; prev = &dict->hashNext[i]) {
+		if (!Q_stricmp(dict->data + dict->keyOfs[i], key)) {
+			break;
+		}
+	}
+	if (i < 0) {
+		return;
+	}
+
+	*prev = dict->hashNext[i];
+	dict->length -= strlen(dict->data + dict->keyOfs[i]) + strlen(dict->data + dict->valueOfs[i]) + 2;
+	dict->keyOfs[i] = -1;
+}
+
+/*
+==================
+Info_DictSet
+
+Changes or adds a key/value pair, a NULL value removes the key.
+Returns qfalse if the pair was refused.
+==================
+*/
+qboolean Info_DictSet(infoDict_t *dict, const char *key, const char *value) {
+	const char *blacklist = "\\;\"";
+	int hash, i, keyLen, valueLen, oldLen, length;
+
+	for (; *blacklist; ++blacklist) {
+		if (strchr(key, *blacklist) || (value && strchr(value, *blacklist))) {
+			Com_Printf(S_COLOR_YELLOW "Can't use keys or values with a '%c': %s = %s\n", *blacklist, key, value);
+			return qfalse;
+		}
+	}
+
+	if (!value || (!*value && !dict->keepEmpty)) {
+		Info_DictRemove(dict, key);
+		return qtrue;
+	}
+
+	keyLen = strlen(key);
+	valueLen = strlen(value);
+	hash = Info_DictHash(key);
+	i = Info_DictFind(dict, key, hash);
+
+	if (i >= 0) {
+		oldLen = strlen(dict->data + dict->valueOfs[i]);
+		length = dict->length + valueLen - oldLen;
+	} else {
+		oldLen = 0;
+		length = dict->length + keyLen + valueLen + 2;
+	}
+	if (length >= dict->maxLength) {
+		Com_Printf("Info string length exceeded\n");
+		return qfalse;
+	}
+
+	if (i >= 0) {
+		if (valueLen > oldLen) {
+			if (dict->dataUsed + valueLen + 1 > (int)sizeof(dict->data)) {
+				// the old value is replaced anyway, don't keep it
+				dict->data[dict->valueOfs[i]] = 0;
+				Info_DictCompact(dict);
+				i = Info_DictFind(dict, key, hash);
+			}
+			dict->valueOfs[i] = dict->dataUsed;
+			dict->dataUsed += valueLen + 1;
+		}
+		memcpy(dict->data + dict->valueOfs[i], value, valueLen + 1);
+		dict->length = length;
+		return qtrue;
+	}
+
+	if (dict->numPairs == MAX_INFO_PAIRS || dict->dataUsed + keyLen + valueLen + 2 > (int)sizeof(dict->data)) {
+		Info_DictCompact(dict);
+		if (dict->numPairs == MAX_INFO_PAIRS) {
+			Com_Printf("Info string has too many keys\n");
+			return qfalse;
+		}
+	}
+
+	i = dict->numPairs++;
+	dict->keyOfs[i] = dict->dataUsed;
+	memcpy(dict->data + dict->dataUsed, key, keyLen + 1);
+	dict->dataUsed += keyLen + 1;
+	dict->valueOfs[i] = dict->dataUsed;
+	memcpy(dict->data + dict->dataUsed, value, valueLen + 1);
+	dict->dataUsed += valueLen + 1;
+	Info_DictLink(dict, i);
+	dict->length = length;
+
+	return qtrue;
+}
+
+/*
+==================
+Info_DictWrite
+
+Serializes the pairs in insertion order, pairs that don't fit are dropped
+==================
+*/
+void Info_DictWrite(const infoDict_t *dict, char *buf, int size) {
+	const char *key, *value;
+	int keyLen, valueLen, used, i;
+
+	used = 0;
+	for (i = 0; i < dict->numPairs; i++) {
+		if (dict->keyOfs[i] < 0) {
+			continue;
+		}
+		key = dict->data + dict->keyOfs[i];
+		value = dict->data + dict->valueOfs[i];
+		keyLen = strlen(key);
+		valueLen = strlen(value);
+		if (used + keyLen + valueLen + 2 >= size) {
+			break;
+		}
+		buf[used++] = '\\';
+		memcpy(buf + used, key, keyLen);
+		used += keyLen;
+		buf[used++] = '\\';
+		memcpy(buf + used, value, valueLen);
+		used += valueLen;
+	}
+
+	if (size > 0) {
+		buf[used] = 0;
+	}
+}
+
 //====================================================================
 
 /*
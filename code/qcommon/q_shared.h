@@ -360,6 +360,9 @@ typedef vec_t vec3_t[3];
 typedef vec_t vec4_t[4];
 typedef vec_t vec5_t[5];
 
+// for aligned SSE loads in native code
+typedef vec_t vec4a_t[4] QALIGN(16);
+
 typedef vec_t quat_t[4];
 
 typedef int fixed4_t;
@@ -716,6 +719,12 @@ void AxisScale(vec3_t in[3], float s, vec3_t out[3]);
 void SetPlaneSignbits(struct cplane_s *out);
 int BoxOnPlaneSide(vec3_t emins, vec3_t emaxs, struct cplane_s *plane);
 
+#ifndef Q3_VM
+// batch kernels, SSE on x86 native builds
+void TransformPoints(const vec3_t origin, vec3_t axis[3], vec3_t *in, vec3_t *out, int numPoints);
+void CullBoxes(const float *bounds, int numBoxes, const struct cplane_s *planes, int numPlanes, byte *cull);
+#endif
+
 qboolean BoundsIntersect(const vec3_t mins, const vec3_t maxs, const vec3_t mins2, const vec3_t maxs2);
 qboolean BoundsIntersectSphere(const vec3_t mins, const vec3_t maxs, const vec3_t origin, vec_t radius);
 qboolean BoundsIntersectPoint(const vec3_t mins, const vec3_t maxs, const vec3_t origin);
@@ -765,6 +774,17 @@ int COM_GetCurrentParseLine(void);
 const char *Com_ParseLine(const char **data_p);
 const char *COM_Parse(const char **data_p);
 const char *COM_ParseExt(const char **data_p, qboolean allowLineBreak);
+
+// a token inside the parsed data, not terminated
+typedef struct {
+	const char *text;
+	int length;
+	int line; // line the token starts on, if lines were counted
+} comTokenView_t;
+
+qboolean COM_ParseView(const char **data_p, qboolean allowLineBreaks, int *lines, comTokenView_t *token);
+qboolean COM_ViewEquals(const comTokenView_t *token, const char *s);
+void COM_ViewCopy(const comTokenView_t *token, char *dest, int size);
 int COM_Compress(char *data_p);
 void COM_ParseError(const char *format, ...) __attribute__((format(printf, 1, 2)));
 void COM_ParseWarning(const char *format, ...) __attribute__((format(printf, 1, 2)));
@@ -792,6 +812,7 @@ typedef struct pc_token_s {
 // data is an in/out parm, returns a parsed out token
 
 qboolean SkipBracedSection(const char **program, int depth);
+qboolean COM_SkipBracedView(const char **data_p, int depth, int *lines);
 void SkipRestOfLine(const char **data);
 
 void Parse1DMatrix(const char **buf_p, int x, float *m);
@@ -885,6 +906,33 @@ void Info_SetValueForKey_Big(char *s, const char *key, const char *value);
 qboolean Info_Validate(const char *s);
 void Info_NextPair(const char **s, char *key, char *value);
 
+//
+// parsed info strings, for callers that look up or change many keys of the
+// same string; keys are matched case insensitively like Info_ValueForKey
+//
+#define MAX_INFO_PAIRS 256
+#define INFO_HASH_SIZE 64
+
+typedef struct {
+	int maxLength; // serialized length limit, MAX_INFO_STRING or BIG_INFO_STRING
+	qboolean keepEmpty; // keep zero-length values like Info_SetValueForKey_Big
+	int length; // length of the serialized string
+	int numPairs; // pair slots in use, including removed ones
+	int dataUsed;
+	short keyOfs[MAX_INFO_PAIRS]; // -1 for removed pairs
+	short valueOfs[MAX_INFO_PAIRS];
+	short hashNext[MAX_INFO_PAIRS];
+	short hashHeads[INFO_HASH_SIZE];
+	char data[BIG_INFO_STRING]; // key\0value\0 pairs
+} infoDict_t;
+
+void Info_DictInit(infoDict_t *dict, int maxLength, qboolean keepEmpty);
+void Info_DictParse(infoDict_t *dict, const char *s);
+const char *Info_DictValue(const infoDict_t *dict, const char *key);
+qboolean Info_DictSet(infoDict_t *dict, const char *key, const char *value);
+void Info_DictRemove(infoDict_t *dict, const char *key);
+void Info_DictWrite(const infoDict_t *dict, char *buf, int size);
+
 // value only info strings
 void StringDump_Push(char *s, const char *value);
 void StringDump_GetNext(const char **head, char *value);
@@ -1034,6 +1082,13 @@ typedef struct {
 	int entityNum;		 // entity the contacted sirface is a part of
 } trace_t;
 
+// keep 1/8 unit away to keep the position valid before network snapping
+// and to avoid various numeric issues
+#define SURFACE_CLIP_EPSILON (0.125)
+
+void BoxTraceBox(trace_t *results, const vec3_t start, const vec3_t end, const vec3_t mins, const vec3_t maxs,
+				 const vec3_t boxmins, const vec3_t boxmaxs, const vec3_t origin, int brushmask);
+
 // trace->entityNum can also be 0 to (MAX_GENTITIES-1)
 // or ENTITYNUM_NONE, ENTITYNUM_WORLD
 
@@ -1435,7 +1490,7 @@ typedef enum _flag_status {
 
 #define MAX_GLOBAL_SERVERS 4096
 #define MAX_OTHER_SERVERS 128
-#define MAX_PINGREQUESTS 32
+#define MAX_PINGREQUESTS 256
 #define MAX_SERVERSTATUSREQUESTS 16
 
 #define SAY_ALL 0
@@ -48,13 +48,24 @@ typedef struct {
 	int cursize;
 	int readcount;
 	int bit; // for bitwise reads and writes
+	qboolean raw; // bitstream bytes are not huffman coded
+	int huffTable; // MSG_HUFF_* table the bitstream is coded with
+	unsigned *symbolCounts; // if set, counts the bytes going through the huffman coder
 } msg_t;
 
+#define MSG_HUFF_DEFAULT 0
+#define MSG_HUFF_ALTERNATE 1
+#define MSG_HUFF_TABLES 2
+
+#define MSG_HUFF_MAXCOUNT 1000000 // largest symbol count of a table file
+
 void MSG_Init(msg_t *buf, byte *data, int length);
 void MSG_InitOOB(msg_t *buf, byte *data, int length);
 void MSG_Clear(msg_t *buf);
 void MSG_WriteData(msg_t *buf, const void *data, int length);
 void MSG_Bitstream(msg_t *buf);
+void MSG_LoadHuffTable(const char *filename);
+int MSG_HuffTableVersion(void);
 
 // TTimo
 // copy a msg_t in case we need to store it as is for a bit
@@ -67,6 +78,7 @@ struct entityState_s;
 struct playerState_s;
 
 void MSG_WriteBits(msg_t *msg, int value, int bits);
+void MSG_WriteBitStream(msg_t *msg, const byte *data, int offset, int bits);
 
 void MSG_WriteChar(msg_t *sb, int c);
 void MSG_WriteByte(msg_t *sb, int c);
@@ -75,6 +87,7 @@ void MSG_WriteLong(msg_t *sb, int c);
 void MSG_WriteFloat(msg_t *sb, float f);
 void MSG_WriteString(msg_t *sb, const char *s);
 void MSG_WriteBigString(msg_t *sb, const char *s);
+void MSG_WriteServerCommand(msg_t *sb, const char *s);
 void MSG_WriteAngle16(msg_t *sb, float f);
 int MSG_HashKey(const char *string, int maxlen);
 
@@ -91,6 +104,7 @@ float MSG_ReadFloat(msg_t *sb);
 const char *MSG_ReadString(msg_t *sb);
 const char *MSG_ReadBigString(msg_t *sb);
 const char *MSG_ReadStringLine(msg_t *sb);
+const char *MSG_ReadServerCommand(msg_t *sb);
 float MSG_ReadAngle16(msg_t *sb);
 void MSG_ReadData(msg_t *sb, void *buffer, int size);
 int MSG_LookaheadByte(msg_t *msg);
@@ -138,6 +152,7 @@ NET
 #define PORT_ANY -1
 
 #define MAX_RELIABLE_COMMANDS 64 // max string commands buffered for restransmit
+#define MAX_PACKED_RELIABLE_COMMANDS 256 // server command window of NETCOMP_PACKEDCOMMANDS clients
 
 typedef enum {
 	NA_BAD = 0, // an address lookup failed
@@ -183,7 +198,12 @@ int NET_StringToAdr(const char *s, netadr_t *a, netadrtype_t family);
 qboolean NET_GetLoopPacket(netsrc_t sock, netadr_t *net_from, msg_t *net_message);
 void NET_JoinMulticast6(void);
 void NET_LeaveMulticast6(void);
-void NET_Sleep(int msec);
+void NET_Sleep(int usec);
+// arrival time on the Sys_Milliseconds clock of the packet being dispatched
+int NET_PacketTime(void);
+void NET_BeginSendBatch(void);
+void NET_FlushSendBatch(void);
+// packets sent in between may be held back and sent together by the flush
 
 #define MAX_MSGLEN                                                                                                     \
 	16384 // max length of a message, which may
@@ -195,6 +215,17 @@ void NET_Sleep(int msec);
 
 #define NETCHAN_GENCHECKSUM(challenge, sequence) ((challenge) ^ ((sequence) * (challenge)))
 
+// payload compression, negotiated through the "netcomp" userinfo key and
+// the connectResponse.  Negotiated channels carry a flags byte after the
+// checksum of every packet.
+#define NETCOMP_VERSION 2
+
+#define NETCOMP_PACKEDCOMMANDS 2 // svc_serverCommands and the larger server command window
+
+#define NETCHAN_RAW 1 // payload bitstream is not huffman coded
+#define NETCHAN_LZ 2  // payload is LZ compressed
+#define NETCHAN_HUFF 4 // payload is coded with the alternate huffman table
+
 /*
 Netchan handles packet fragmentation and out of order / duplicate suppression
 */
@@ -223,15 +254,21 @@ typedef struct {
 	int unsentLength;
 	byte unsentBuffer[MAX_MSGLEN];
 
+	int unsentFlags;
+
 	int challenge;
 	int lastSentTime;
 	int lastSentSize;
+
+	int compression;   // negotiated NETCOMP_VERSION, 0 for legacy peers
+	int incomingFlags; // NETCHAN_* flags of the last processed message
 } netchan_t;
 
 void Netchan_Init(int qport);
 void Netchan_Setup(netsrc_t sock, netchan_t *chan, netadr_t adr, int qport, int challenge, qboolean compat);
 
 void Netchan_Transmit(netchan_t *chan, int length, const byte *data);
+void Netchan_TransmitFlags(netchan_t *chan, int length, const byte *data, int flags);
 void Netchan_TransmitNextFragment(netchan_t *chan);
 
 qboolean Netchan_Process(netchan_t *chan, msg_t *msg);
@@ -275,6 +312,8 @@ enum svc_ops_e {
 	// new commands, supported only by ioquake3 protocol but not legacy
 	svc_voipSpeex, // not wrapped in USE_VOIP, so this value is reserved.
 	svc_voipOpus,  //
+
+	svc_serverCommands, // [long] first sequence [byte] count, packed commands (NETCOMP_PACKEDCOMMANDS)
 };
 
 //
@@ -320,12 +359,42 @@ typedef enum {
 	TRAP_CEIL,
 
 	TRAP_TESTPRINTINT,
-	TRAP_TESTPRINTFLOAT
+	TRAP_TESTPRINTFLOAT,
+
+	TRAP_MEMMOVE,
+	TRAP_STRLEN
 } sharedTraps_t;
 
+typedef intptr_t (*vmSyscall_t)(intptr_t *args);
+
+// pure math and bulk memory traps a compiler may evaluate without going
+// through the systemCall path
+typedef enum {
+	VMINL_NONE,
+	VMINL_SQRT,
+	VMINL_SIN,
+	VMINL_COS,
+	VMINL_FLOOR,
+	VMINL_CEIL,
+	VMINL_MEMSET,
+	VMINL_MEMCPY,
+	VMINL_STRNCPY,
+	VMINL_STRLEN
+} vmInline_t;
+
+// hot traps that are dispatched through a table instead of the module's
+// systemCall switch, terminated by a callNum of -1
+typedef struct {
+	int callNum;
+	vmSyscall_t func;
+	vmInline_t inlineOp;
+} vmSyscallDef_t;
+
 void VM_Init(void);
-vm_t *VM_Create(const char *module, intptr_t (*systemCalls)(intptr_t *), vmInterpret_t interpret);
+vm_t *VM_Create(const char *module, intptr_t (*systemCalls)(intptr_t *), const vmSyscallDef_t *syscallDefs,
+				vmInterpret_t interpret);
 // module should be bare: "cgame", not "cgame.dll" or "vm/cgame.qvm"
+// syscallDefs may be NULL
 
 void VM_Free(vm_t *vm);
 void VM_Clear(void);
@@ -340,6 +409,33 @@ void VM_Debug(int level);
 void *VM_ArgPtr(intptr_t intValue);
 void *VM_ExplicitArgPtr(vm_t *vm, intptr_t intValue);
 
+// the call stack of the running VM as instruction numbers, innermost
+// function first.  Only reads memory, so it can be taken from a signal
+// handler or another thread; pc and sp are the interrupted registers of
+// the thread running the VM, or NULL, which leaves compiled VMs without
+// frames.
+#define VM_SAMPLE_DEPTH 32
+
+typedef struct {
+	int vmIndex; // -1 if no VM was running
+	int depth;
+	int frames[VM_SAMPLE_DEPTH];
+} vmSample_t;
+
+void VM_Sample(vmSample_t *sample, void *pc, void *sp);
+const char *VM_SampleName(const vmSample_t *sample);
+const char *VM_SampleSymbol(const vmSample_t *sample, int frame);
+
+intptr_t VM_TrapSin(intptr_t *args);
+intptr_t VM_TrapCos(intptr_t *args);
+intptr_t VM_TrapSqrt(intptr_t *args);
+intptr_t VM_TrapFloor(intptr_t *args);
+intptr_t VM_TrapCeil(intptr_t *args);
+intptr_t VM_TrapMemset(intptr_t *args);
+intptr_t VM_TrapMemcpy(intptr_t *args);
+intptr_t VM_TrapStrncpy(intptr_t *args);
+intptr_t VM_TrapStrlen(intptr_t *args);
+
 #define VMA(x) VM_ArgPtr(args[x])
 static ID_INLINE float _vmf(intptr_t x) {
 	floatint_t fi;
@@ -474,6 +570,9 @@ void Cvar_Register(vmCvar_t *vmCvar, const char *varName, const char *defaultVal
 void Cvar_Update(vmCvar_t *vmCvar);
 // updates an interpreted modules' version of a cvar
 
+int Cvar_Generation(void);
+// changes whenever any cvar is created, modified or unset
+
 void Cvar_Set(const char *var_name, const char *value);
 // will create the variable with no flags if it doesn't exist
 
@@ -603,9 +702,12 @@ void FS_GetModDescription(const char *modDir, char *description, int description
 fileHandle_t FS_FOpenFileWrite(const char *qpath);
 // will properly create any needed paths and deal with seperater character issues
 fileHandle_t FS_FCreateOpenPipeFile(const char *filename);
+// starts a command and writes to its stdin
+fileHandle_t FS_FOpenPipeWrite(const char *command);
 
 fileHandle_t FS_SV_FOpenFileWrite(const char *filename);
 long FS_SV_FOpenFileRead(const char *filename, fileHandle_t *fp);
+long FS_SV_FOpenFileAppend(const char *filename, fileHandle_t *fp);
 void FS_SV_Rename(const char *from, const char *to, qboolean safe);
 // if uniqueFILE is true, then a new FILE will be fopened even if the file
 // is found in an already open pak file.  If uniqueFILE is false, you must call
@@ -619,6 +721,12 @@ int FS_FileIsInPAK(const char *filename, int *pChecksum);
 
 int FS_Write(const void *buffer, int len, fileHandle_t f);
 
+// like FS_Write, but with fs_writeThread on a thread does the write, in order
+int FS_WriteQueued(const void *buffer, int len, fileHandle_t f);
+
+// writes without printing or erroring, for a thread that owns the handle
+int FS_WriteFromThread(const void *buffer, int len, fileHandle_t f);
+
 // properly handles partial reads and reads from other dlls
 int FS_Read(void *buffer, int len, fileHandle_t f);
 
@@ -634,10 +742,27 @@ long FS_ReadFileDir(const char *qpath, void *searchPath, qboolean unpure, void *
 // for other uses.
 long FS_ReadFile(const char *qpath, void **buffer);
 
+// like FS_ReadFile, but uncompressed files in a pk3 may be returned in place.
+// The buffer is strictly read-only and there is no trailing 0.
+long FS_ReadFileMapped(const char *qpath, const void **buffer);
+
+// maps a file that isn't in a pk3 read only and shared with any other process
+// mapping it, NULL if it can't be.  Released with FS_UnmapFile.
+const void *FS_MapFile(const char *qpath, int64_t *length);
+// the same for a file relative to the home path, like FS_SV_FOpenFileWrite
+const void *FS_SV_MapFile(const char *filename, int64_t *length);
+void FS_UnmapFile(const void *buffer, int64_t length);
+
+// inflates the given files ahead of the FS_ReadFile or FS_FOpenFileRead calls
+// for them, using several threads.  dir is prepended to the names if not NULL.
+void FS_Prefetch(const char *dir, char **names, int count);
+// releases prefetched files that were not opened
+void FS_FlushPrefetch(void);
+
 // forces flush on files we're writing to.
 void FS_ForceFlush(fileHandle_t f);
 
-// frees the memory returned by FS_ReadFile
+// frees the memory returned by FS_ReadFile or FS_ReadFileMapped
 void FS_FreeFile(void *buffer);
 
 // writes a complete file, creating any subdirectories needed
@@ -741,7 +866,8 @@ typedef enum {
 	CF_3DNOW_EXT = 1 << 4,
 	CF_SSE = 1 << 5,
 	CF_SSE2 = 1 << 6,
-	CF_ALTIVEC = 1 << 7
+	CF_ALTIVEC = 1 << 7,
+	CF_AVX2 = 1 << 8
 } cpuFeatures_t;
 
 // centralized and cleaned, that's the max string you can send to a Com_Printf / Com_DPrintf (above gets truncated)
@@ -810,6 +936,7 @@ extern cvar_t *com_journal;
 extern cvar_t *com_ansiColor;
 extern cvar_t *com_unfocused;
 extern cvar_t *com_minimized;
+extern cvar_t *com_touchMemory;
 extern cvar_t *com_altivec;
 extern cvar_t *com_basegame;
 extern cvar_t *com_homepath;
@@ -833,6 +960,8 @@ extern int time_frontend;
 extern int time_backend; // renderer backend time
 
 extern int com_frameTime;
+extern int64_t com_inputSampleUsec; // when this frame sampled input
+extern int com_latencyWaitUsec;	   // how long com_lowLatency held this frame back
 
 extern qboolean com_errorEntered;
 extern qboolean com_fullyInitialized;
@@ -840,7 +969,20 @@ extern qboolean com_fullyInitialized;
 extern fileHandle_t com_journalFile;
 extern fileHandle_t com_journalDataFile;
 
-typedef enum { TAG_FREE, TAG_GENERAL, TAG_BOTLIB, TAG_RENDERER, TAG_SMALL, TAG_STATIC } memtag_t;
+typedef enum { TAG_FREE, TAG_GENERAL, TAG_BOTLIB, TAG_RENDERER, TAG_SMALL, TAG_STATIC, TAG_SLAB } memtag_t;
+
+// what zone and hunk memory is charged to, for memstat
+typedef enum {
+	MEMOWNER_ENGINE,
+	MEMOWNER_CM,
+	MEMOWNER_RENDERER,
+	MEMOWNER_BOTLIB,
+	MEMOWNER_SOUND,
+	MEMOWNER_GAME,
+	MEMOWNER_CGAME,
+	MEMOWNER_UI,
+	MEMOWNER_MAX
+} memOwner_t;
 
 /*
 
@@ -882,6 +1024,14 @@ void Z_FreeTags(int tag);
 int Z_AvailableMemory(void);
 void Z_LogHeap(void);
 
+// the zone and hunk allocations that follow are charged to owner, TAG_RENDERER
+// and TAG_BOTLIB blocks excepted.  Returns the owner to restore afterwards.
+memOwner_t Com_SetMemOwner(memOwner_t owner);
+// accounts for memory that neither comes from the zone nor the hunk
+void Com_MemAccount(memOwner_t owner, int bytes);
+// the zone, hunk and other memory currently charged to owner
+int Com_MemOwnerBytes(memOwner_t owner);
+
 void Hunk_Clear(void);
 void Hunk_ClearToMark(void);
 void Hunk_SetMark(void);
@@ -902,6 +1052,103 @@ void Com_Shutdown(void);
 /*
 ==============================================================
 
+JOBS
+
+==============================================================
+*/
+
+#define MAX_JOB_THREADS 16
+
+// thread local storage, for the little per-thread state of reentrant systems
+#ifdef _MSC_VER
+#define Q_THREADLOCAL __declspec(thread)
+#else
+#define Q_THREADLOCAL __thread
+#endif
+
+// publishes a pointer to data that is complete before the store, a thread
+// that loads the pointer sees the data it points to
+#ifdef _MSC_VER
+// volatile accesses have acquire/release semantics under /volatile:ms
+#define Q_LoadPtrAcquire(p) (*(void *volatile *)(p))
+#define Q_StorePtrRelease(p, v) (*(void *volatile *)(p) = (v))
+#else
+#define Q_LoadPtrAcquire(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define Q_StorePtrRelease(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#endif
+
+typedef void (*jobFunc_t)(void *data, int index);
+
+// calls func(data, index) for every index in [0, count), spread over up to
+// numThreads threads including the caller.  Returns once all indices have
+// been processed.  The restrictions of Sys_CreateThread apply to func.
+void Com_RunJobs(jobFunc_t func, void *data, int count, int numThreads);
+void Com_ShutdownJobs(void);
+
+// writes out whatever the dedicated server's print thread still has queued
+void Com_StopPrintThread(void);
+
+// 0 on the main thread, 1 to MAX_JOB_THREADS on the job workers
+int Com_JobThreadIndex(void);
+
+// uninitialized scratch memory from the calling thread's arena, never freed
+// individually.  On the main thread it stays valid until the next Com_Frame,
+// on a job worker until the job it was allocated in returns.
+void *Com_ScratchAlloc(int size);
+void Com_ScratchReset(void);
+
+/*
+==============================================================
+
+PROFILER
+
+==============================================================
+*/
+
+// named zones of the frame profiler, only recorded while a profile_capture
+// runs or the hitch watchdog follows the main thread.  A zone is closed by
+// the next PROFILE_END on the same thread, so the pairs have to nest and
+// can't be split by a return.
+#define PROFILE_BEGIN(name)                                                                                            \
+	do {                                                                                                               \
+		if (com_profiling)                                                                                             \
+			Com_ProfileBegin(name);                                                                                    \
+	} while (0)
+#define PROFILE_END()                                                                                                  \
+	do {                                                                                                               \
+		if (com_profiling)                                                                                             \
+			Com_ProfileEnd();                                                                                          \
+	} while (0)
+
+#define PROFILE_CAPTURE 1 // a profile_capture is recording
+#define PROFILE_WATCH 2	  // the hitch watchdog follows the main thread's zones
+
+#define PROFILE_MAX_DEPTH 32
+
+extern int com_profiling;
+
+void Com_InitProfile(void);
+void Com_ProfileFrame(void);
+void Com_ProfileBegin(const char *name);
+void Com_ProfileEnd(void);
+void Com_ProfileCounter(const char *name, float value);
+// the zones open on the main thread while PROFILE_WATCH is set, outermost
+// first.  Only reads memory, like VM_Sample.
+int Com_ProfileMainZones(const char **names, int maxNames);
+
+// hitch.c, a watchdog thread that samples the main thread when a frame runs
+// longer than com_hitchThreshold
+void Com_InitHitch(void);
+void Com_ShutdownHitch(void);
+void Com_HitchFrameBegin(void);
+void Com_HitchFrameEnd(void);
+// type is a sysEventType_t, or HITCH_PACKET for a packet of value bytes
+#define HITCH_PACKET -1
+void Com_HitchEvent(int type, int value, int value2, const netadr_t *from);
+
+/*
+==============================================================
+
 CLIENT / SERVER SYSTEMS
 
 ==============================================================
@@ -998,6 +1245,7 @@ qboolean UI_usesUniqueCDKey(void);
 //
 void IN_Init(void *windowData);
 void IN_Frame(void);
+void IN_SampleMouse(void);
 void IN_Shutdown(void);
 void IN_Restart(void);
 
@@ -1031,6 +1279,7 @@ void Sys_Print(const char *msg);
 // Sys_Milliseconds should only be used for profiling purposes,
 // any game related timing information should come from event timestamps
 int Sys_Milliseconds(void);
+int64_t Sys_Microseconds(void);
 
 qboolean Sys_RandomBytes(byte *string, int len);
 
@@ -1050,8 +1299,16 @@ qboolean Sys_IsLANAddress(netadr_t adr);
 void Sys_ShowIP(void);
 
 FILE *Sys_FOpen(const char *ospath, const char *mode);
+qboolean Sys_FileInfo(const char *path, int64_t *size, int64_t *mtime);
+void *Sys_MapFile(const char *ospath, int64_t *length);
+void Sys_UnmapFile(void *base, int64_t length);
+void *Sys_ReserveMemory(size_t size);
+qboolean Sys_CommitMemory(void *base, size_t size);
+void Sys_DecommitMemory(void *base, size_t size);
 qboolean Sys_Mkdir(const char *path);
 FILE *Sys_Mkfifo(const char *ospath);
+FILE *Sys_OpenPipe(const char *command);
+int Sys_ClosePipe(FILE *pipe);
 char *Sys_Cwd(void);
 void Sys_SetDefaultInstallPath(const char *path);
 char *Sys_DefaultInstallPath(void);
@@ -1085,6 +1342,43 @@ dialogResult_t Sys_Dialog(dialogType_t type, const char *message, const char *ti
 void Sys_RemovePIDFile(const char *gamedir);
 void Sys_InitPIDFile(const char *gamedir);
 
+// threads are only used for optional worker pools, the thread functions
+// must never call Com_Error, Com_Printf or the zone/hunk allocators
+typedef struct sysThread_s sysThread_t;
+typedef struct sysMutex_s sysMutex_t;
+typedef struct sysCond_s sysCond_t;
+
+sysThread_t *Sys_CreateThread(void (*func)(void *data), void *data);
+void Sys_JoinThread(sysThread_t *thread);
+
+sysMutex_t *Sys_CreateMutex(void);
+void Sys_DestroyMutex(sysMutex_t *mutex);
+void Sys_LockMutex(sysMutex_t *mutex);
+void Sys_UnlockMutex(sysMutex_t *mutex);
+
+sysCond_t *Sys_CreateCond(void);
+void Sys_DestroyCond(sysCond_t *cond);
+void Sys_WaitCond(sysCond_t *cond, sysMutex_t *mutex);
+// returns qfalse if usec microseconds passed without a signal
+qboolean Sys_TimedWaitCond(sysCond_t *cond, sysMutex_t *mutex, int usec);
+void Sys_SignalCond(sysCond_t *cond);
+void Sys_BroadcastCond(sysCond_t *cond);
+
+// makes the calling thread the one Sys_InterruptThread interrupts, the
+// callback runs in a signal handler on it.  NULL removes it.  qfalse if the
+// platform can't interrupt threads.
+qboolean Sys_SetInterruptCallback(void (*callback)(void *pc, void *sp));
+// runs the callback on the thread that set it, from any other thread
+qboolean Sys_InterruptThread(void);
+
+// keeps the calling thread, and the threads it creates afterwards, on the
+// given CPUs.  qfalse if the platform can't or a CPU number is out of range.
+#define MAX_AFFINITY_CPUS 1024
+qboolean Sys_SetAffinity(const int *cpus, int numCpus);
+
+// sampling profiler support, callback runs in signal context
+qboolean Sys_SetProfileTimer(int hz, void (*callback)(void *pc, void *sp));
+
 /* This is based on the Adaptive Huffman algorithm described in Sayood's Data
  * Compression book.  The ranks are not actually stored, but implicitly defined
  * by the location of a node within a doubly-linked list */
@@ -1138,6 +1432,12 @@ void Huff_setBloc(int _bloc);
 
 extern huffman_t clientHuffTables;
 
+//
+// lz.c
+//
+int LZ_Compress(const byte *in, int inLen, byte *out, int outSize);
+int LZ_Decompress(const byte *in, int inLen, byte *out, int outSize);
+
 #define SV_ENCODE_START 4
 #define SV_DECODE_START 12
 #define CL_ENCODE_START 12
@@ -47,6 +47,11 @@ static vm_t vmTable[MAX_VM];
 
 static void VM_VmInfo_f(void);
 static void VM_VmProfile_f(void);
+static void VM_ProfileSetup(vm_t *vm);
+static void VM_ProfileForget(vm_t *vm);
+
+static cvar_t *vm_profileRate;
+static cvar_t *vm_codeCache;
 
 #if 0 // 64bit!
 // converts a VM pointer to a C pointer and
@@ -69,6 +74,9 @@ void VM_Init(void) {
 	Cvar_Get("vm_cgame", "2", CVAR_ARCHIVE); // !@# SHIP WITH SET TO 2
 	Cvar_Get("vm_game", "2", CVAR_ARCHIVE);	 // !@# SHIP WITH SET TO 2
 	Cvar_Get("vm_ui", "2", CVAR_ARCHIVE);	 // !@# SHIP WITH SET TO 2
+	Cvar_Get("vm_optimize", "1", CVAR_ARCHIVE);
+	vm_profileRate = Cvar_Get("vm_profileRate", "1000", CVAR_ARCHIVE);
+	vm_codeCache = Cvar_Get("vm_cache", "1", CVAR_ARCHIVE);
 
 	Cmd_AddCommand("vmprofile", VM_VmProfile_f);
 	Cmd_AddCommand("vminfo", VM_VmInfo_f);
@@ -276,7 +284,9 @@ static void VM_LoadSymbols(vm_t *vm) {
 		sym->next = NULL;
 
 		// convert value from an instruction number to a code offset
+		sym->symInstruction = -1;
 		if (value >= 0 && value < numInstructions) {
+			sym->symInstruction = value;
 			value = vm->instructionPointers[value];
 		}
 
@@ -343,12 +353,183 @@ intptr_t QDECL VM_DllSyscall(intptr_t arg, ...) {
 		args[i] = va_arg(ap, intptr_t);
 	va_end(ap);
 
-	return currentVM->systemCall(args);
+	return VM_SystemCall(currentVM, args);
 #else // original id code
-	return currentVM->systemCall(&arg);
+	return VM_SystemCall(currentVM, &arg);
 #endif
 }
 
+/*
+=================
+VM_SetupSyscalls
+
+Builds the trap table used by VM_SystemCall from the module's fast path definitions
+=================
+*/
+static void VM_SetupSyscalls(vm_t *vm, intptr_t (*systemCalls)(intptr_t *), const vmSyscallDef_t *syscallDefs) {
+	const vmSyscallDef_t *def;
+	int i;
+
+	vm->systemCall = systemCalls;
+	vm->syscallDefs = syscallDefs;
+	vm->numSyscalls = 0;
+
+	if (!syscallDefs)
+		return;
+
+	for (def = syscallDefs; def->callNum >= 0; def++) {
+		if (def->callNum >= vm->numSyscalls)
+			vm->numSyscalls = def->callNum + 1;
+	}
+
+	vm->syscallTable = Z_Malloc(vm->numSyscalls * sizeof(*vm->syscallTable));
+	for (i = 0; i < vm->numSyscalls; i++)
+		vm->syscallTable[i] = systemCalls;
+
+	for (def = syscallDefs; def->callNum >= 0; def++) {
+		if (def->func)
+			vm->syscallTable[def->callNum] = def->func;
+	}
+}
+
+/*
+=================
+VM_SyscallInline
+
+Tells the compiler whether a trap may be evaluated in generated code
+=================
+*/
+vmInline_t VM_SyscallInline(vm_t *vm, int callNum) {
+	const vmSyscallDef_t *def;
+
+	if (!vm->syscallDefs)
+		return VMINL_NONE;
+
+	for (def = vm->syscallDefs; def->callNum >= 0; def++) {
+		if (def->callNum == callNum)
+			return def->inlineOp;
+	}
+
+	return VMINL_NONE;
+}
+
+static int VM_FloatAsInt(float f) {
+	floatint_t fi;
+	fi.f = f;
+	return fi.i;
+}
+
+/*
+=================
+VM_TrapSin etc.
+
+Math traps shared by all modules, the compilers may inline these
+=================
+*/
+intptr_t VM_TrapSin(intptr_t *args) {
+	return VM_FloatAsInt(sin(VMF(1)));
+}
+
+intptr_t VM_TrapCos(intptr_t *args) {
+	return VM_FloatAsInt(cos(VMF(1)));
+}
+
+intptr_t VM_TrapSqrt(intptr_t *args) {
+	return VM_FloatAsInt(sqrt(VMF(1)));
+}
+
+intptr_t VM_TrapFloor(intptr_t *args) {
+	return VM_FloatAsInt(floor(VMF(1)));
+}
+
+intptr_t VM_TrapCeil(intptr_t *args) {
+	return VM_FloatAsInt(ceil(VMF(1)));
+}
+
+/*
+=================
+VM_MemRange
+
+Checks that a block handed to a memory trap lies within the data
+segment and returns its host address
+=================
+*/
+static byte *VM_MemRange(intptr_t addr, intptr_t length) {
+	vm_t *vm = currentVM;
+
+	if (vm->entryPoint)
+		return vm->dataBase + addr;
+
+	if (length < 0 || (uintptr_t)addr > (uintptr_t)vm->dataMask || length > vm->dataMask + 1 - addr)
+		Com_Error(ERR_DROP, "%s: memory access to 0x%x, %d bytes out of range", vm->name, (int)addr, (int)length);
+
+	return vm->dataBase + addr;
+}
+
+/*
+=================
+VM_StrRange
+
+Returns the length of a string in the data segment, reading no more
+than maxLength bytes
+=================
+*/
+static intptr_t VM_StrRange(intptr_t addr, intptr_t maxLength) {
+	vm_t *vm = currentVM;
+	const byte *s, *end;
+	intptr_t avail;
+
+	s = VM_MemRange(addr, 0);
+	if (vm->entryPoint)
+		avail = maxLength;
+	else
+		avail = MIN(maxLength, vm->dataMask + 1 - addr);
+
+	end = memchr(s, 0, avail);
+	if (end)
+		return end - s;
+
+	if (avail < maxLength)
+		Com_Error(ERR_DROP, "%s: unterminated string at 0x%x", vm->name, (int)addr);
+
+	return maxLength;
+}
+
+/*
+=================
+VM_TrapMemset etc.
+
+Bulk memory traps shared by all modules, so QVMs don't run these a
+byte at a time in bytecode
+=================
+*/
+intptr_t VM_TrapMemset(intptr_t *args) {
+	Com_Memset(VM_MemRange(args[1], args[3]), args[2], args[3]);
+	return args[1];
+}
+
+intptr_t VM_TrapMemcpy(intptr_t *args) {
+	byte *dest = VM_MemRange(args[1], args[3]);
+	byte *src = VM_MemRange(args[2], args[3]);
+
+	// memmove shares this trap
+	memmove(dest, src, args[3]);
+	return args[1];
+}
+
+intptr_t VM_TrapStrncpy(intptr_t *args) {
+	byte *dest = VM_MemRange(args[1], args[3]);
+	intptr_t length = VM_StrRange(args[2], args[3]);
+
+	memmove(dest, VM_MemRange(args[2], length), length);
+	Com_Memset(dest + length, 0, args[3] - length);
+	return args[1];
+}
+
+intptr_t VM_TrapStrlen(intptr_t *args) {
+	return VM_StrRange(args[1], INT_MAX);
+}
+
 /*
 =================
 VM_LoadQVM
@@ -357,6 +538,7 @@ Load a .qvm file
 =================
 */
 static vmHeader_t *VM_LoadQVM(vm_t *vm, qboolean alloc, qboolean unpure) {
+	int length;
 	int dataLength;
 	int i;
 	char filename[MAX_QPATH];
@@ -369,7 +551,7 @@ static vmHeader_t *VM_LoadQVM(vm_t *vm, qboolean alloc, qboolean unpure) {
 	Com_sprintf(filename, sizeof(filename), "vm/%s.qvm", vm->name);
 	Com_Printf("Loading vm file %s...\n", filename);
 
-	FS_ReadFileDir(filename, vm->searchPath, unpure, &header.v);
+	length = FS_ReadFileDir(filename, vm->searchPath, unpure, &header.v);
 
 	if (!header.h) {
 		Com_Printf("Failed.\n");
@@ -380,6 +562,10 @@ static vmHeader_t *VM_LoadQVM(vm_t *vm, qboolean alloc, qboolean unpure) {
 		return NULL;
 	}
 
+	// compiled code is only reused for the exact image that was loaded
+	vm->imageLength = length;
+	vm->imageChecksum = Com_BlockChecksum(header.v, length);
+
 	// show where the qvm was loaded from
 	FS_Which(filename, vm->searchPath);
 
@@ -436,12 +622,12 @@ static vmHeader_t *VM_LoadQVM(vm_t *vm, qboolean alloc, qboolean unpure) {
 	if (alloc) {
 		// allocate zero filled space for initialized and uninitialized data
 		// leave some space beyond data mask so we can secure all mask operations
-		vm->dataAlloc = dataLength + 4;
+		vm->dataAlloc = dataLength + VM_DATA_GUARD;
 		vm->dataBase = Hunk_Alloc(vm->dataAlloc, h_high);
 		vm->dataMask = dataLength - 1;
 	} else {
 		// clear the data, but make sure we're not clearing more than allocated
-		if (vm->dataAlloc != dataLength + 4) {
+		if (vm->dataAlloc != dataLength + VM_DATA_GUARD) {
 			VM_Free(vm);
 			FS_FreeFile(header.v);
 
@@ -462,6 +648,13 @@ static vmHeader_t *VM_LoadQVM(vm_t *vm, qboolean alloc, qboolean unpure) {
 		*(int *)(vm->dataBase + i) = LittleLong(*(int *)(vm->dataBase + i));
 	}
 
+	// keep the initialized data so a restart doesn't need the file again
+	if (alloc) {
+		vm->dataImageLength = header.h->dataLength + header.h->litLength;
+		vm->dataImage = Hunk_Alloc(vm->dataImageLength, h_high);
+		Com_Memcpy(vm->dataImage, vm->dataBase, vm->dataImageLength);
+	}
+
 	if (header.h->vmMagic == VM_MAGIC_VER2) {
 		int previousNumJumpTableTargets = vm->numJumpTableTargets;
 
@@ -499,12 +692,169 @@ static vmHeader_t *VM_LoadQVM(vm_t *vm, qboolean alloc, qboolean unpure) {
 	return header.h;
 }
 
+/*
+==============================================================
+
+COMPILED CODE CACHE
+
+The compilers can store their output in fs_homepath so the next load
+of the same image skips compilation. A cache file is only accepted if
+it was written by the same engine build for the same QVM bytes, which
+are still read through the pure checked search path.
+
+==============================================================
+*/
+
+#define VM_CACHE_MAGIC (('C' << 24) | ('M' << 16) | ('V' << 8) | 'Q')
+#define VM_CACHE_VERSION 1
+#define VM_CACHE_MAX_LENGTH (64 * 1024 * 1024)
+
+typedef struct {
+	int magic;
+	int version;
+	char build[128];
+	int imageLength;
+	unsigned int imageChecksum;
+	unsigned int syscallChecksum; // inlined traps are part of the code
+	int dataLength;
+	unsigned int dataChecksum;
+} vmCacheHeader_t;
+
+static const char *VM_CodeCachePath(vm_t *vm) {
+	return FS_BuildOSPath(Cvar_VariableString("fs_homepath"), "vmcache",
+						  va("%s-%08x.qvmc", vm->name, vm->imageChecksum));
+}
+
+static void VM_CodeCacheHeader(vm_t *vm, const char *build, vmCacheHeader_t *header) {
+	const vmSyscallDef_t *def;
+
+	Com_Memset(header, 0, sizeof(*header));
+	header->magic = VM_CACHE_MAGIC;
+	header->version = VM_CACHE_VERSION;
+	Q_strncpyz(header->build, build, sizeof(header->build));
+	header->imageLength = vm->imageLength;
+	header->imageChecksum = vm->imageChecksum;
+
+	if (vm->syscallDefs) {
+		for (def = vm->syscallDefs; def->callNum >= 0; def++) {
+			if (def->inlineOp != VMINL_NONE)
+				header->syscallChecksum = header->syscallChecksum * 31 + def->callNum * 8 + def->inlineOp;
+		}
+	}
+}
+
+/*
+=================
+VM_LoadCodeCache
+
+Returns the Z_Malloc'ed data saved by VM_SaveCodeCache for this image and
+compiler build, NULL if there is none or it doesn't match
+=================
+*/
+void *VM_LoadCodeCache(vm_t *vm, const char *build, int *length) {
+	vmCacheHeader_t expected, header;
+	const char *ospath;
+	void *data;
+	FILE *f;
+
+	*length = 0;
+
+	if (!vm_codeCache->integer || !vm->imageLength)
+		return NULL;
+
+	ospath = VM_CodeCachePath(vm);
+	f = Sys_FOpen(ospath, "rb");
+	if (!f)
+		return NULL;
+
+	VM_CodeCacheHeader(vm, build, &expected);
+
+	if (fread(&header, sizeof(header), 1, f) != 1) {
+		fclose(f);
+		Com_DPrintf("Ignoring truncated code cache %s\n", ospath);
+		return NULL;
+	}
+
+	header.build[sizeof(header.build) - 1] = '\0';
+	if (header.magic != expected.magic || header.version != expected.version || strcmp(header.build, expected.build) ||
+		header.imageLength != expected.imageLength || header.imageChecksum != expected.imageChecksum ||
+		header.syscallChecksum != expected.syscallChecksum || header.dataLength <= 0 ||
+		header.dataLength > VM_CACHE_MAX_LENGTH) {
+		fclose(f);
+		Com_DPrintf("Ignoring stale code cache %s\n", ospath);
+		return NULL;
+	}
+
+	data = Z_Malloc(header.dataLength);
+	if (fread(data, header.dataLength, 1, f) != 1 ||
+		Com_BlockChecksum(data, header.dataLength) != header.dataChecksum) {
+		fclose(f);
+		Z_Free(data);
+		Com_DPrintf("Ignoring corrupt code cache %s\n", ospath);
+		return NULL;
+	}
+
+	fclose(f);
+
+	*length = header.dataLength;
+	return data;
+}
+
+/*
+=================
+VM_SaveCodeCache
+
+Replaces the cache file of this image, failures only cost the next load a compile
+=================
+*/
+void VM_SaveCodeCache(vm_t *vm, const char *build, const void *data, int length) {
+	vmCacheHeader_t header;
+	char ospath[MAX_OSPATH];
+	char temppath[MAX_OSPATH];
+	qboolean written;
+	FILE *f;
+
+	if (!vm_codeCache->integer || !vm->imageLength || length <= 0 || length > VM_CACHE_MAX_LENGTH)
+		return;
+
+	Q_strncpyz(ospath, VM_CodeCachePath(vm), sizeof(ospath));
+	Com_sprintf(temppath, sizeof(temppath), "%s.tmp", ospath);
+
+	if (FS_CreatePath(temppath))
+		return;
+
+	f = Sys_FOpen(temppath, "wb");
+	if (!f) {
+		Com_DPrintf("Couldn't write code cache %s\n", temppath);
+		return;
+	}
+
+	VM_CodeCacheHeader(vm, build, &header);
+	header.dataLength = length;
+	header.dataChecksum = Com_BlockChecksum(data, length);
+
+	written = fwrite(&header, sizeof(header), 1, f) == 1 && fwrite(data, length, 1, f) == 1;
+	if (fclose(f))
+		written = qfalse;
+
+	// write the new file aside so a reader never sees half of it
+	remove(ospath);
+	if (!written || rename(temppath, ospath)) {
+		remove(temppath);
+		Com_DPrintf("Couldn't write code cache %s\n", ospath);
+		return;
+	}
+
+	Com_DPrintf("Wrote code cache %s\n", ospath);
+}
+
 /*
 =================
 VM_Restart
 
-Reload the data, but leave everything else in place
+Reset the data, but leave everything else in place
 This allows a server to do a map_restart without changing memory allocation
+or reading the file again
 
 We need to make sure that servers can access unpure QVMs (not contained in any pak)
 even if the client is pure, so take "unpure" as argument.
@@ -517,13 +867,24 @@ vm_t *VM_Restart(vm_t *vm, qboolean unpure) {
 	if (vm->dllHandle) {
 		char name[MAX_QPATH];
 		intptr_t (*systemCall)(intptr_t * parms);
+		const vmSyscallDef_t *syscallDefs;
 
 		systemCall = vm->systemCall;
+		syscallDefs = vm->syscallDefs;
 		Q_strncpyz(name, vm->name, sizeof(name));
 
 		VM_Free(vm);
 
-		vm = VM_Create(name, systemCall, VMI_NATIVE);
+		vm = VM_Create(name, systemCall, syscallDefs, VMI_NATIVE);
+		return vm;
+	}
+
+	// the code and jump table targets never change, only the data has to
+	// be reset to the image the VM was created from
+	if (vm->dataImage) {
+		Com_Printf("VM_Restart() in place\n");
+		Com_Memset(vm->dataBase, 0, vm->dataAlloc);
+		Com_Memcpy(vm->dataBase, vm->dataImage, vm->dataImageLength);
 		return vm;
 	}
 
@@ -543,23 +904,38 @@ vm_t *VM_Restart(vm_t *vm, qboolean unpure) {
 
 /*
 ================
-VM_Create
+VM_MemOwner
+
+The memory account a module's allocations are charged to
+================
+*/
+memOwner_t VM_MemOwner(const char *module) {
+	if (!Q_stricmp(module, "qagame"))
+		return MEMOWNER_GAME;
+	if (!Q_stricmp(module, "cgame"))
+		return MEMOWNER_CGAME;
+	if (!Q_stricmp(module, "ui"))
+		return MEMOWNER_UI;
+
+	return MEMOWNER_ENGINE;
+}
+
+/*
+================
+VM_CreateModule
 
 If image ends in .qvm it will be interpreted, otherwise
 it will attempt to load as a system dll
 ================
 */
-vm_t *VM_Create(const char *module, intptr_t (*systemCalls)(intptr_t *), vmInterpret_t interpret) {
+static vm_t *VM_CreateModule(const char *module, intptr_t (*systemCalls)(intptr_t *),
+							 const vmSyscallDef_t *syscallDefs, vmInterpret_t interpret) {
 	vm_t *vm;
 	vmHeader_t *header;
 	int i, remaining, retval;
 	char filename[MAX_OSPATH];
 	void *startSearch = NULL;
 
-	if (!module || !module[0] || !systemCalls) {
-		Com_Error(ERR_FATAL, "VM_Create: bad parms");
-	}
-
 	remaining = Hunk_MemoryRemaining();
 
 	// see if we already have the VM
@@ -594,7 +970,7 @@ vm_t *VM_Create(const char *module, intptr_t (*systemCalls)(intptr_t *), vmInter
 			vm->dllHandle = Sys_LoadGameDll(filename, &vm->entryPoint, VM_DllSyscall);
 
 			if (vm->dllHandle) {
-				vm->systemCall = systemCalls;
+				VM_SetupSyscalls(vm, systemCalls, syscallDefs);
 				return vm;
 			}
 
@@ -612,7 +988,7 @@ vm_t *VM_Create(const char *module, intptr_t (*systemCalls)(intptr_t *), vmInter
 	if (retval < 0)
 		return NULL;
 
-	vm->systemCall = systemCalls;
+	VM_SetupSyscalls(vm, systemCalls, syscallDefs);
 
 	// allocate space for the jump targets, which will be filled in by the compile/prep functions
 	vm->instructionCount = header->instructionCount;
@@ -649,11 +1025,34 @@ vm_t *VM_Create(const char *module, intptr_t (*systemCalls)(intptr_t *), vmInter
 	vm->programStack = vm->dataMask + 1;
 	vm->stackBottom = vm->programStack - PROGRAM_STACK_SIZE;
 
+	VM_ProfileSetup(vm);
+
 	Com_Printf("%s loaded in %d bytes on the hunk\n", module, remaining - Hunk_MemoryRemaining());
 
 	return vm;
 }
 
+/*
+================
+VM_Create
+================
+*/
+vm_t *VM_Create(const char *module, intptr_t (*systemCalls)(intptr_t *), const vmSyscallDef_t *syscallDefs,
+				vmInterpret_t interpret) {
+	memOwner_t owner;
+	vm_t *vm;
+
+	if (!module || !module[0] || !systemCalls) {
+		Com_Error(ERR_FATAL, "VM_Create: bad parms");
+	}
+
+	owner = Com_SetMemOwner(VM_MemOwner(module));
+	vm = VM_CreateModule(module, systemCalls, syscallDefs, interpret);
+	Com_SetMemOwner(owner);
+
+	return vm;
+}
+
 /*
 ==============
 VM_Free
@@ -676,6 +1075,11 @@ void VM_Free(vm_t *vm) {
 	if (vm->destroy)
 		vm->destroy(vm);
 
+	if (vm->syscallTable)
+		Z_Free(vm->syscallTable);
+
+	VM_ProfileForget(vm);
+
 	if (vm->dllHandle) {
 		Sys_UnloadDll(vm->dllHandle);
 		Com_Memset(vm, 0, sizeof(*vm));
@@ -770,10 +1174,14 @@ intptr_t QDECL VM_Call(vm_t *vm, int callnum, ...) {
 	vm_t *oldVM;
 	intptr_t r;
 	int i;
+	void *oldNativeTop;
+	int oldProfilePC, oldProfileStack;
 
 	if (!vm || !vm->name[0])
 		Com_Error(ERR_FATAL, "VM_Call with NULL vm");
 
+	PROFILE_BEGIN("VM_Call");
+
 	oldVM = currentVM;
 	currentVM = vm;
 	lastVM = vm;
@@ -782,6 +1190,12 @@ intptr_t QDECL VM_Call(vm_t *vm, int callnum, ...) {
 		Com_Printf("VM_Call( %d )\n", callnum);
 	}
 
+	// the profiler state belongs to the outer call when this one returns
+	oldNativeTop = vm->profileNativeTop;
+	oldProfilePC = vm->profilePC;
+	oldProfileStack = vm->profileStack;
+	vm->profileNativeTop = &oldNativeTop;
+
 	++vm->callLevel;
 	// if we have a dll loaded, call it directly
 	if (vm->entryPoint) {
@@ -827,8 +1241,14 @@ intptr_t QDECL VM_Call(vm_t *vm, int callnum, ...) {
 	}
 	--vm->callLevel;
 
+	vm->profileNativeTop = oldNativeTop;
+	vm->profilePC = oldProfilePC;
+	vm->profileStack = oldProfileStack;
+
 	if (oldVM != NULL)
 		currentVM = oldVM;
+
+	PROFILE_END();
 	return r;
 }
 
@@ -851,11 +1271,12 @@ static int QDECL VM_ProfileSort(const void *a, const void *b) {
 
 /*
 ==============
-VM_VmProfile_f
+VM_ProfileCounts
 
+Prints the instruction counts gathered by DEBUG_VM interpreters
 ==============
 */
-static void VM_VmProfile_f(void) {
+static void VM_ProfileCounts(void) {
 	vm_t *vm;
 	vmSymbol_t **sorted, *sym;
 	int i;
@@ -896,6 +1317,564 @@ static void VM_VmProfile_f(void) {
 	Z_Free(sorted);
 }
 
+/*
+==============================================================
+
+SAMPLING PROFILER
+
+A profile timer interrupts the engine vm_profileRate times per second
+of cpu time. The signal handler records the VM call stack of the
+running VM as instruction numbers, which are only resolved to
+function names when the profile is printed or written out.
+
+Interpreted VMs publish their position on every function entry and
+return and the handler walks the frames on the program stack.
+Compiled VMs are walked conservatively by looking for return
+addresses into the generated code on the native stack.
+
+==============================================================
+*/
+
+#define VM_PROFILE_SAMPLES 16384
+#define VM_PROFILE_SCAN (256 * 1024) // bytes of native stack searched for return addresses
+
+static vmSample_t *vm_profileSamples;
+static volatile int vm_numProfileSamples;
+static volatile int vm_profileDropped;
+static volatile int vm_profiling;
+
+/*
+==============
+VM_ProfileInstruction
+
+Maps a code offset or native address back to its instruction number, -1 if it isn't one
+==============
+*/
+static int VM_ProfileInstruction(vm_t *vm, intptr_t value) {
+	int lo, hi, mid;
+
+	if (vm->instructionCount <= 0 || value < vm->instructionPointers[0])
+		return -1;
+
+	lo = 0;
+	hi = vm->instructionCount - 1;
+	while (lo < hi) {
+		mid = (lo + hi + 1) >> 1;
+		if (vm->instructionPointers[mid] <= value)
+			lo = mid;
+		else
+			hi = mid - 1;
+	}
+
+	return lo;
+}
+
+static void VM_ProfileAddFrame(vm_t *vm, vmSample_t *sample, intptr_t value) {
+	int instruction = VM_ProfileInstruction(vm, value);
+
+	if (instruction >= 0 && sample->depth < VM_SAMPLE_DEPTH)
+		sample->frames[sample->depth++] = instruction;
+}
+
+static void VM_ProfileInterpretedStack(vm_t *vm, vmSample_t *sample) {
+	int pc = vm->profilePC;
+	int programStack = vm->profileStack;
+	int instruction;
+
+	// without the frame sizes only the innermost function is known
+	if (!vm->profileFrames) {
+		if ((unsigned)pc < (unsigned)vm->codeLength)
+			VM_ProfileAddFrame(vm, sample, pc);
+		return;
+	}
+
+	while (sample->depth < VM_SAMPLE_DEPTH) {
+		if ((unsigned)pc >= (unsigned)vm->codeLength)
+			break;
+
+		instruction = VM_ProfileInstruction(vm, pc);
+		if (instruction < 0)
+			break;
+		sample->frames[sample->depth++] = instruction;
+
+		// the return address sits just above the frame
+		programStack += vm->profileFrames[instruction];
+		pc = *(int *)&vm->dataBase[programStack & vm->dataMask & ~3];
+	}
+}
+
+static void VM_ProfileNativeStack(vm_t *vm, vmSample_t *sample, byte *pc, byte *sp) {
+	byte *start = vm->codeBase, *end = vm->codeBase + vm->codeLength;
+	byte *top = vm->profileNativeTop;
+	intptr_t base = 0, *p;
+
+	// some compilers keep offsets rather than addresses
+	if (vm->instructionPointers[0] < (intptr_t)start)
+		base = (intptr_t)start;
+
+	if (pc >= start && pc < end)
+		VM_ProfileAddFrame(vm, sample, (intptr_t)pc - base);
+
+	if (!sp || !top || sp >= top || top - sp > VM_PROFILE_SCAN)
+		return;
+
+	for (p = PADP(sp, sizeof(intptr_t)); (byte *)p < top && sample->depth < VM_SAMPLE_DEPTH; p++) {
+		byte *ret = (byte *)*p;
+
+		// step back into the call instruction
+		if (ret > start && ret <= end)
+			VM_ProfileAddFrame(vm, sample, (intptr_t)ret - 1 - base);
+	}
+}
+
+/*
+==============
+VM_Sample
+
+Records the call stack of the VM that is running, if any
+==============
+*/
+void VM_Sample(vmSample_t *sample, void *pc, void *sp) {
+	vm_t *vm = currentVM;
+
+	sample->vmIndex = -1;
+	sample->depth = 0;
+
+	if (!vm || !vm->callLevel)
+		return;
+
+	sample->vmIndex = vm - vmTable;
+
+	if (vm->dllHandle || !vm->instructionPointers)
+		return;
+
+	if (vm->compiled)
+		VM_ProfileNativeStack(vm, sample, pc, sp);
+	else
+		VM_ProfileInterpretedStack(vm, sample);
+}
+
+/*
+==============
+VM_SampleName
+==============
+*/
+const char *VM_SampleName(const vmSample_t *sample) {
+	if (sample->vmIndex < 0 || sample->vmIndex >= MAX_VM)
+		return "none";
+
+	return vmTable[sample->vmIndex].name;
+}
+
+/*
+==============
+VM_SampleSymbol
+
+The function and offset of a frame, resolved with the map file symbols
+if they were loaded
+==============
+*/
+const char *VM_SampleSymbol(const vmSample_t *sample, int frame) {
+	vm_t *vm;
+	int instruction = sample->frames[frame];
+
+	if (sample->vmIndex < 0 || sample->vmIndex >= MAX_VM)
+		return "?";
+
+	vm = &vmTable[sample->vmIndex];
+	if (!vm->symbols || !vm->instructionPointers || instruction >= vm->instructionCount)
+		return va("@%d", instruction);
+
+	return VM_ValueToSymbol(vm, vm->instructionPointers[instruction]);
+}
+
+static void VM_ProfileSample(void *pc, void *sp) {
+	vmSample_t *sample;
+
+	if (!vm_profiling)
+		return;
+
+	if (vm_numProfileSamples >= VM_PROFILE_SAMPLES) {
+		vm_profileDropped++;
+		return;
+	}
+
+	sample = &vm_profileSamples[vm_numProfileSamples];
+	VM_Sample(sample, pc, sp);
+
+	if (sample->depth)
+		vm_numProfileSamples++;
+}
+
+/*
+==============
+VM_ProfileSetup
+
+Interpreted VMs need the frame size of every function to walk their stack
+==============
+*/
+static void VM_ProfileSetup(vm_t *vm) {
+	int *codeImage = (int *)vm->codeBase;
+	int i, frame = 0;
+
+	if (!vm_profileSamples || vm->compiled || vm->dllHandle || vm->profileFrames || !vm->instructionPointers)
+		return;
+
+	vm->profileFrames = Z_Malloc(vm->instructionCount * sizeof(*vm->profileFrames));
+	for (i = 0; i < vm->instructionCount; i++) {
+		if (codeImage[vm->instructionPointers[i]] == OP_ENTER)
+			frame = codeImage[vm->instructionPointers[i] + 1];
+		vm->profileFrames[i] = frame;
+	}
+}
+
+/*
+==============
+VM_ProfileForget
+
+Drops the samples of a VM that is going away
+==============
+*/
+static void VM_ProfileForget(vm_t *vm) {
+	int i, j, index = vm - vmTable;
+
+	if (vm->profileFrames) {
+		Z_Free(vm->profileFrames);
+		vm->profileFrames = NULL;
+	}
+
+	if (!vm_profileSamples)
+		return;
+
+	for (i = j = 0; i < vm_numProfileSamples; i++) {
+		if (vm_profileSamples[i].vmIndex != index)
+			vm_profileSamples[j++] = vm_profileSamples[i];
+	}
+	vm_numProfileSamples = j;
+}
+
+/*
+==============
+VM_ProfileSymbols
+
+Sorted code symbols of a VM for resolving instruction numbers
+==============
+*/
+static int QDECL VM_ProfileSymbolSort(const void *a, const void *b) {
+	return (*(vmSymbol_t **)a)->symInstruction - (*(vmSymbol_t **)b)->symInstruction;
+}
+
+static vmSymbol_t **VM_ProfileSymbols(vm_t *vm, int *numSymbols) {
+	vmSymbol_t **symbols, *sym;
+	int count = 0;
+
+	*numSymbols = 0;
+	if (!vm->numSymbols)
+		return NULL;
+
+	symbols = Z_Malloc(vm->numSymbols * sizeof(*symbols));
+	for (sym = vm->symbols; sym; sym = sym->next) {
+		if (sym->symInstruction >= 0)
+			symbols[count++] = sym;
+	}
+
+	qsort(symbols, count, sizeof(*symbols), VM_ProfileSymbolSort);
+	*numSymbols = count;
+
+	return symbols;
+}
+
+static vmSymbol_t *VM_ProfileSymbol(vmSymbol_t **symbols, int numSymbols, int instruction) {
+	int lo = 0, hi = numSymbols - 1, mid;
+
+	if (!numSymbols || instruction < symbols[0]->symInstruction)
+		return NULL;
+
+	while (lo < hi) {
+		mid = (lo + hi + 1) >> 1;
+		if (symbols[mid]->symInstruction <= instruction)
+			lo = mid;
+		else
+			hi = mid - 1;
+	}
+
+	return symbols[lo];
+}
+
+static const char *VM_ProfileName(vmSymbol_t **symbols, int numSymbols, int instruction) {
+	vmSymbol_t *sym = VM_ProfileSymbol(symbols, numSymbols, instruction);
+
+	// without a map file all there is to show is the instruction number
+	return sym ? sym->symName : va("@%d", instruction);
+}
+
+/*
+==============
+VM_ProfileResolve
+
+Copies the samples with every frame replaced by the first instruction
+of its function, so samples in the same function compare equal
+==============
+*/
+static vmSample_t *VM_ProfileResolve(void) {
+	vmSample_t *resolved;
+	vmSymbol_t **symbols;
+	int numSymbols;
+	int i, j, v;
+
+	resolved = Z_Malloc(vm_numProfileSamples * sizeof(*resolved) + 1);
+	Com_Memcpy(resolved, vm_profileSamples, vm_numProfileSamples * sizeof(*resolved));
+
+	for (v = 0; v < MAX_VM; v++) {
+		symbols = VM_ProfileSymbols(&vmTable[v], &numSymbols);
+		if (!symbols)
+			continue;
+
+		for (i = 0; i < vm_numProfileSamples; i++) {
+			vmSample_t *sample = &resolved[i];
+
+			if (sample->vmIndex != v)
+				continue;
+
+			for (j = 0; j < sample->depth; j++) {
+				vmSymbol_t *sym = VM_ProfileSymbol(symbols, numSymbols, sample->frames[j]);
+
+				if (sym)
+					sample->frames[j] = sym->symInstruction;
+			}
+		}
+
+		Z_Free(symbols);
+	}
+
+	return resolved;
+}
+
+static int QDECL VM_ProfileStackSort(const void *a, const void *b) {
+	const vmSample_t *sa = a, *sb = b;
+	int i;
+
+	if (sa->vmIndex != sb->vmIndex)
+		return sa->vmIndex - sb->vmIndex;
+
+	// compare from the root so callers end up next to each other
+	for (i = 1; i <= sa->depth && i <= sb->depth; i++) {
+		if (sa->frames[sa->depth - i] != sb->frames[sb->depth - i])
+			return sa->frames[sa->depth - i] - sb->frames[sb->depth - i];
+	}
+
+	return sa->depth - sb->depth;
+}
+
+static int QDECL VM_ProfileLeafSort(const void *a, const void *b) {
+	const vmSample_t *sa = a, *sb = b;
+
+	if (sa->vmIndex != sb->vmIndex)
+		return sa->vmIndex - sb->vmIndex;
+
+	return sa->frames[0] - sb->frames[0];
+}
+
+/*
+==============
+VM_ProfileFlat
+
+Prints the functions the samples landed in, busiest first
+==============
+*/
+static int QDECL VM_ProfileCountSort(const void *a, const void *b) {
+	const vmSample_t *sa = a, *sb = b;
+
+	if (sa->vmIndex != sb->vmIndex)
+		return sa->vmIndex - sb->vmIndex;
+
+	return sb->depth - sa->depth;
+}
+
+static void VM_ProfileFlat(void) {
+	vmSample_t *resolved;
+	vmSymbol_t **symbols = NULL;
+	int numSymbols = 0;
+	int i, start, numFuncs, vmIndex = -1;
+
+	resolved = VM_ProfileResolve();
+	qsort(resolved, vm_numProfileSamples, sizeof(*resolved), VM_ProfileLeafSort);
+
+	// collapse each function into one entry, reusing depth as its sample count
+	for (start = numFuncs = 0; start < vm_numProfileSamples; start = i) {
+		for (i = start + 1; i < vm_numProfileSamples; i++) {
+			if (VM_ProfileLeafSort(&resolved[start], &resolved[i]))
+				break;
+		}
+
+		resolved[numFuncs] = resolved[start];
+		resolved[numFuncs].depth = i - start;
+		numFuncs++;
+	}
+
+	qsort(resolved, numFuncs, sizeof(*resolved), VM_ProfileCountSort);
+
+	for (i = 0; i < numFuncs; i++) {
+		vmSample_t *func = &resolved[i];
+
+		if (func->vmIndex != vmIndex) {
+			if (symbols)
+				Z_Free(symbols);
+
+			vmIndex = func->vmIndex;
+			symbols = VM_ProfileSymbols(&vmTable[vmIndex], &numSymbols);
+			Com_Printf("%s:\n", vmTable[vmIndex].name);
+		}
+
+		Com_Printf("%5.1f%% %7i %s\n", 100.0f * func->depth / vm_numProfileSamples, func->depth,
+				   VM_ProfileName(symbols, numSymbols, func->frames[0]));
+	}
+
+	if (symbols)
+		Z_Free(symbols);
+
+	Com_Printf("%i samples, %i dropped\n", vm_numProfileSamples, vm_profileDropped);
+
+	Z_Free(resolved);
+}
+
+/*
+==============
+VM_ProfileFolded
+
+Writes one "vm;caller;callee count" line per distinct stack, the
+folded format flamegraph tools read
+==============
+*/
+static void VM_ProfileFolded(const char *filename) {
+	vmSample_t *resolved;
+	vmSymbol_t **symbols = NULL;
+	int numSymbols = 0;
+	int i, j, start, vmIndex = -1;
+	fileHandle_t f;
+	char line[4096];
+
+	f = FS_FOpenFileWrite(filename);
+	if (!f) {
+		Com_Printf("Couldn't write %s.\n", filename);
+		return;
+	}
+
+	resolved = VM_ProfileResolve();
+	qsort(resolved, vm_numProfileSamples, sizeof(*resolved), VM_ProfileStackSort);
+
+	for (start = 0; start < vm_numProfileSamples; start = i) {
+		vmSample_t *sample = &resolved[start];
+
+		if (sample->vmIndex != vmIndex) {
+			if (symbols)
+				Z_Free(symbols);
+
+			vmIndex = sample->vmIndex;
+			symbols = VM_ProfileSymbols(&vmTable[vmIndex], &numSymbols);
+		}
+
+		for (i = start + 1; i < vm_numProfileSamples; i++) {
+			if (VM_ProfileStackSort(sample, &resolved[i]))
+				break;
+		}
+
+		Q_strncpyz(line, vmTable[vmIndex].name, sizeof(line));
+		for (j = sample->depth - 1; j >= 0; j--) {
+			Q_strcat(line, sizeof(line), ";");
+			Q_strcat(line, sizeof(line), VM_ProfileName(symbols, numSymbols, sample->frames[j]));
+		}
+		Q_strcat(line, sizeof(line), va(" %i\n", i - start));
+		FS_Write(line, strlen(line), f);
+	}
+
+	if (symbols)
+		Z_Free(symbols);
+
+	FS_FCloseFile(f);
+	Z_Free(resolved);
+
+	Com_Printf("Wrote %i samples to %s.\n", vm_numProfileSamples, filename);
+}
+
+static void VM_ProfileStop(void) {
+	vm_profiling = 0;
+	Sys_SetProfileTimer(0, NULL);
+}
+
+static void VM_ProfileStart(void) {
+	int i;
+
+	VM_ProfileStop();
+
+	if (!vm_profileSamples)
+		vm_profileSamples = Z_Malloc(VM_PROFILE_SAMPLES * sizeof(*vm_profileSamples));
+
+	vm_numProfileSamples = 0;
+	vm_profileDropped = 0;
+
+	for (i = 0; i < MAX_VM; i++) {
+		if (vmTable[i].name[0])
+			VM_ProfileSetup(&vmTable[i]);
+	}
+
+	vm_profiling = 1;
+	if (!Sys_SetProfileTimer(vm_profileRate->integer, VM_ProfileSample)) {
+		vm_profiling = 0;
+		Com_Printf("Sampling profiler is not supported on this platform.\n");
+		return;
+	}
+
+	Com_Printf("Sampling VMs %i times per second.\n", vm_profileRate->integer);
+}
+
+/*
+==============
+VM_VmProfile_f
+
+==============
+*/
+static void VM_VmProfile_f(void) {
+	const char *cmd = Cmd_Argv(1);
+	qboolean running = vm_profiling;
+
+	if (!cmd[0]) {
+		VM_ProfileCounts();
+		return;
+	}
+
+	if (!Q_stricmp(cmd, "start")) {
+		VM_ProfileStart();
+		return;
+	}
+
+	if (!Q_stricmp(cmd, "stop")) {
+		VM_ProfileStop();
+		Com_Printf("%i samples, %i dropped\n", vm_numProfileSamples, vm_profileDropped);
+		return;
+	}
+
+	if (Q_stricmp(cmd, "flat") && Q_stricmp(cmd, "folded")) {
+		Com_Printf("usage: vmprofile [start|stop|flat|folded [file]]\n");
+		return;
+	}
+
+	if (!vm_profileSamples || !vm_numProfileSamples) {
+		Com_Printf("No samples, use vmprofile start first.\n");
+		return;
+	}
+
+	// keep the handler out of the sample buffer while it is read
+	vm_profiling = 0;
+
+	if (!Q_stricmp(cmd, "flat"))
+		VM_ProfileFlat();
+	else
+		VM_ProfileFolded(Cmd_Argc() > 2 ? Cmd_Argv(2) : "vmprofile.folded");
+
+	vm_profiling = running;
+}
+
 /*
 ==============
 VM_VmInfo_f
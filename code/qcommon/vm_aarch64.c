@@ -0,0 +1,809 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+
+AArch64 VM, modeled on the ARMv7l compiler
+
+Docu:
+Arm Architecture Reference Manual for A-profile architecture (DDI0487)
+Procedure Call Standard for the Arm 64-bit Architecture (AAPCS64)
+*/
+
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <stddef.h>
+
+#include "vm_local.h"
+
+#define R0 0
+#define R1 1
+#define R2 2
+#define R16 16 // IP0, scratch for far calls
+
+#define FP 29
+#define LR 30
+#define SP 31 // as base register
+#define ZR 31 // as source / destination register
+
+#define S0 0
+#define S1 1
+
+// all of these are callee saved, so C helpers leave them alone
+#define rOPSTACK 19
+#define rPSTACK 20
+#define rDATABASE 21
+#define rDATAMASK 22
+#define rINSPOINTERS 23
+
+/* exit() won't be called but use it because it is marked with noreturn */
+#define DIE(reason, args...)                                                                                           \
+	do {                                                                                                               \
+		Com_Error(ERR_DROP, "vm_aarch64 compiler error: " reason, ##args);                                             \
+		exit(1);                                                                                                       \
+	} while (0)
+
+#define NOTIMPL(x)                                                                                                     \
+	do {                                                                                                               \
+		Com_Printf(S_COLOR_RED "instruction not implemented: %x\n", x);                                                \
+		vm->compiled = qfalse;                                                                                         \
+		return;                                                                                                        \
+	} while (0)
+
+/*
+ * opcode information table:
+ * - length of immediate value
+ */
+#define opImm0 0x0000 /* no immediate */
+#define opImm1 0x0001 /* 1 byte immadiate value after opcode */
+#define opImm4 0x0002 /* 4 bytes immediate value after opcode */
+
+static const unsigned char vm_opInfo[256] = {
+	[OP_ENTER] = opImm4, [OP_LEAVE] = opImm4, [OP_CONST] = opImm4, [OP_LOCAL] = opImm4,
+	[OP_EQ] = opImm4,	 [OP_NE] = opImm4,	  [OP_LTI] = opImm4,   [OP_LEI] = opImm4,
+	[OP_GTI] = opImm4,	 [OP_GEI] = opImm4,	  [OP_LTU] = opImm4,   [OP_LEU] = opImm4,
+	[OP_GTU] = opImm4,	 [OP_GEU] = opImm4,	  [OP_EQF] = opImm4,   [OP_NEF] = opImm4,
+	[OP_LTF] = opImm4,	 [OP_LEF] = opImm4,	  [OP_GTF] = opImm4,   [OP_GEF] = opImm4,
+	[OP_ARG] = opImm1,	 [OP_BLOCK_COPY] = opImm4,
+};
+
+static void VM_Destroy_Compiled(vm_t *vm) {
+	if (vm->codeBase) {
+		if (munmap(vm->codeBase, vm->codeLength))
+			Com_Printf(S_COLOR_RED "Memory unmap failed, possible memory leak\n");
+	}
+	vm->codeBase = NULL;
+}
+
+/*
+=================
+ErrJump
+Error handler for jump/call to invalid instruction number
+=================
+*/
+
+static void __attribute__((__noreturn__)) ErrJump(unsigned num) {
+	Com_Error(ERR_DROP, "program tried to execute code outside VM (%x)", num);
+}
+
+static int asmcall(int call, int pstack) {
+	// save currentVM so as to allow for recursive VM entry
+	vm_t *savedVM = currentVM;
+	intptr_t args[MAX_VMSYSCALL_ARGS];
+	int *argPosition;
+	int i, ret;
+
+	// modify VM stack pointer for recursive VM entry
+	currentVM->programStack = pstack - 4;
+
+	args[0] = -1 - call;
+	argPosition = (int *)((byte *)currentVM->dataBase + pstack + 4);
+	for (i = 1; i < ARRAY_LEN(args); i++)
+		args[i] = argPosition[i];
+
+	ret = VM_SystemCall(currentVM, args);
+
+	currentVM = savedVM;
+
+	return ret;
+}
+
+static void _emit(vm_t *vm, unsigned isn, int pass) {
+	if (pass)
+		memcpy(vm->codeBase + vm->codeLength, &isn, 4);
+	vm->codeLength += 4;
+}
+
+#define emit(isn) _emit(vm, isn, pass)
+
+// conditions
+#define EQ 0b0000
+#define NE 0b0001
+#define HS 0b0010
+#define LO 0b0011
+#define MI 0b0100
+#define PL 0b0101
+#define HI 0b1000
+#define LS 0b1001
+#define GE 0b1010
+#define LT 0b1011
+#define GT 0b1100
+#define LE 0b1101
+#define INVERT(c) ((c) ^ 1)
+
+#define BRK(v) (0xD4200000 | ((v) << 5))
+#define NOP 0xD503201F
+
+// 32 bit data processing, register
+#define ADD(dst, src, reg) (0x0B000000 | ((reg) << 16) | ((src) << 5) | (dst))
+#define SUB(dst, src, reg) (0x4B000000 | ((reg) << 16) | ((src) << 5) | (dst))
+#define AND(dst, src, reg) (0x0A000000 | ((reg) << 16) | ((src) << 5) | (dst))
+#define ORR(dst, src, reg) (0x2A000000 | ((reg) << 16) | ((src) << 5) | (dst))
+#define EOR(dst, src, reg) (0x4A000000 | ((reg) << 16) | ((src) << 5) | (dst))
+#define MVN(dst, reg) (0x2A200000 | ((reg) << 16) | (ZR << 5) | (dst))
+#define NEG(dst, reg) SUB(dst, ZR, reg)
+#define MUL(dst, src, reg) (0x1B000000 | ((reg) << 16) | (ZR << 10) | ((src) << 5) | (dst))
+#define MSUB(dst, src, reg, acc) (0x1B008000 | ((reg) << 16) | ((acc) << 10) | ((src) << 5) | (dst))
+#define SDIV(dst, src, reg) (0x1AC00C00 | ((reg) << 16) | ((src) << 5) | (dst))
+#define UDIV(dst, src, reg) (0x1AC00800 | ((reg) << 16) | ((src) << 5) | (dst))
+#define LSL(dst, src, reg) (0x1AC02000 | ((reg) << 16) | ((src) << 5) | (dst))
+#define LSR(dst, src, reg) (0x1AC02400 | ((reg) << 16) | ((src) << 5) | (dst))
+#define ASR(dst, src, reg) (0x1AC02800 | ((reg) << 16) | ((src) << 5) | (dst))
+#define SXTB(dst, src) (0x13001C00 | ((src) << 5) | (dst))
+#define SXTH(dst, src) (0x13003C00 | ((src) << 5) | (dst))
+#define CMP(src, reg) (0x6B000000 | ((reg) << 16) | ((src) << 5) | ZR)
+
+// 32 bit data processing, 12 bit unsigned immediate
+#define ADDi(dst, src, i) (0x11000000 | (((i) & 0xFFF) << 10) | ((src) << 5) | (dst))
+#define SUBi(dst, src, i) (0x51000000 | (((i) & 0xFFF) << 10) | ((src) << 5) | (dst))
+#define CMPi(src, i) (0x71000000 | (((i) & 0xFFF) << 10) | ((src) << 5) | ZR)
+
+// 64 bit pointer arithmetic
+#define ADDXi(dst, src, i) (0x91000000 | (((i) & 0xFFF) << 10) | ((src) << 5) | (dst))
+#define SUBXi(dst, src, i) (0xD1000000 | (((i) & 0xFFF) << 10) | ((src) << 5) | (dst))
+#define MOVX(dst, src) (0xAA000000 | ((src) << 16) | (ZR << 5) | (dst))
+
+// wide immediates, hw selects the 16 bit slot
+#define MOVZ(dst, i, hw) (0x52800000 | ((hw) << 21) | (((i) & 0xFFFF) << 5) | (dst))
+#define MOVK(dst, i, hw) (0x72800000 | ((hw) << 21) | (((i) & 0xFFFF) << 5) | (dst))
+#define MOVZX(dst, i, hw) (0xD2800000 | ((hw) << 21) | (((i) & 0xFFFF) << 5) | (dst))
+#define MOVKX(dst, i, hw) (0xF2800000 | ((hw) << 21) | (((i) & 0xFFFF) << 5) | (dst))
+
+// loads and stores with a zero extended 32 bit register offset
+#define LDRWr(dst, base, reg) (0xB8604800 | ((reg) << 16) | ((base) << 5) | (dst))
+#define LDRHr(dst, base, reg) (0x78604800 | ((reg) << 16) | ((base) << 5) | (dst))
+#define LDRBr(dst, base, reg) (0x38604800 | ((reg) << 16) | ((base) << 5) | (dst))
+#define STRWr(src, base, reg) (0xB8204800 | ((reg) << 16) | ((base) << 5) | (src))
+#define STRHr(src, base, reg) (0x78204800 | ((reg) << 16) | ((base) << 5) | (src))
+#define STRBr(src, base, reg) (0x38204800 | ((reg) << 16) | ((base) << 5) | (src))
+// ldr xdst, [base, reg, lsl #3]
+#define LDRXr(dst, base, reg) (0xF8607800 | ((reg) << 16) | ((base) << 5) | (dst))
+
+// loads and stores with scaled unsigned offset
+#define LDRWi(dst, base, off) (0xB9400000 | (((off) >> 2) << 10) | ((base) << 5) | (dst))
+#define STRWi(src, base, off) (0xB9000000 | (((off) >> 2) << 10) | ((base) << 5) | (src))
+#define LDRXi(dst, base, off) (0xF9400000 | (((off) >> 3) << 10) | ((base) << 5) | (dst))
+#define STRXi(src, base, off) (0xF9000000 | (((off) >> 3) << 10) | ((base) << 5) | (src))
+
+// pre / post indexed with 9 bit signed offset
+#define LDRWpost(dst, base, off) (0xB8400400 | (((off) & 0x1FF) << 12) | ((base) << 5) | (dst))
+#define LDRWpre(dst, base, off) (0xB8400C00 | (((off) & 0x1FF) << 12) | ((base) << 5) | (dst))
+#define STRWpre(src, base, off) (0xB8000C00 | (((off) & 0x1FF) << 12) | ((base) << 5) | (src))
+#define LDRXpost(dst, base, off) (0xF8400400 | (((off) & 0x1FF) << 12) | ((base) << 5) | (dst))
+#define STRXpre(src, base, off) (0xF8000C00 | (((off) & 0x1FF) << 12) | ((base) << 5) | (src))
+
+// 64 bit register pairs, offset is scaled by 8
+#define STPXpre(r1, r2, base, off) (0xA9800000 | ((((off) >> 3) & 0x7F) << 15) | ((r2) << 10) | ((base) << 5) | (r1))
+#define STPXi(r1, r2, base, off) (0xA9000000 | ((((off) >> 3) & 0x7F) << 15) | ((r2) << 10) | ((base) << 5) | (r1))
+#define LDPXi(r1, r2, base, off) (0xA9400000 | ((((off) >> 3) & 0x7F) << 15) | ((r2) << 10) | ((base) << 5) | (r1))
+#define LDPXpost(r1, r2, base, off) (0xA8C00000 | ((((off) >> 3) & 0x7F) << 15) | ((r2) << 10) | ((base) << 5) | (r1))
+
+// push / pop the link register keeping sp 16 byte aligned
+#define PUSHLR STRXpre(LR, SP, -16)
+#define POPLR LDRXpost(LR, SP, 16)
+
+// branches, offsets are relative to the branch instruction
+#define B(off) (0x14000000 | (((off) >> 2) & 0x3FFFFFF))
+#define BL(off) (0x94000000 | (((off) >> 2) & 0x3FFFFFF))
+#define Bcond(c, off) (0x54000000 | ((((off) >> 2) & 0x7FFFF) << 5) | (c))
+#define BR(reg) (0xD61F0000 | ((reg) << 5))
+#define BLR(reg) (0xD63F0000 | ((reg) << 5))
+#define RET 0xD65F03C0
+
+// single precision floating point
+#define FMOVsw(Sd, Rn) (0x1E270000 | ((Rn) << 5) | (Sd))
+#define FMOVws(Rd, Sn) (0x1E260000 | ((Sn) << 5) | (Rd))
+#define FADD(Sd, Sn, Sm) (0x1E202800 | ((Sm) << 16) | ((Sn) << 5) | (Sd))
+#define FSUB(Sd, Sn, Sm) (0x1E203800 | ((Sm) << 16) | ((Sn) << 5) | (Sd))
+#define FMUL(Sd, Sn, Sm) (0x1E200800 | ((Sm) << 16) | ((Sn) << 5) | (Sd))
+#define FDIV(Sd, Sn, Sm) (0x1E201800 | ((Sm) << 16) | ((Sn) << 5) | (Sd))
+#define FNEG(Sd, Sn) (0x1E214000 | ((Sn) << 5) | (Sd))
+#define FCMP(Sn, Sm) (0x1E202000 | ((Sm) << 16) | ((Sn) << 5))
+#define SCVTF(Sd, Rn) (0x1E220000 | ((Rn) << 5) | (Sd))
+#define FCVTZS(Rd, Sn) (0x1E380000 | ((Sn) << 5) | (Rd))
+
+// puts a 32 bit integer in register reg
+#define emit_MOVRxi(reg, arg)                                                                                          \
+	do {                                                                                                               \
+		emit(MOVZ(reg, (arg) & 0xFFFF, 0));                                                                            \
+		if (((arg) >> 16) & 0xFFFF)                                                                                    \
+			emit(MOVK(reg, ((arg) >> 16) & 0xFFFF, 1));                                                                \
+	} while (0)
+
+// puts a host pointer in register reg
+#define emit_MOVXi(reg, ptr)                                                                                           \
+	do {                                                                                                               \
+		uint64_t _v = (uint64_t)(intptr_t)(ptr);                                                                       \
+		emit(MOVZX(reg, _v & 0xFFFF, 0));                                                                              \
+		emit(MOVKX(reg, (_v >> 16) & 0xFFFF, 1));                                                                      \
+		emit(MOVKX(reg, (_v >> 32) & 0xFFFF, 2));                                                                      \
+		emit(MOVKX(reg, (_v >> 48) & 0xFFFF, 3));                                                                      \
+	} while (0)
+
+// rPSTACK + arg in dst, clobbers R16
+#define emit_ADDPStack(dst, arg)                                                                                       \
+	do {                                                                                                               \
+		if ((unsigned)(arg) < 0x1000) {                                                                                \
+			emit(ADDi(dst, rPSTACK, arg));                                                                             \
+		} else {                                                                                                       \
+			emit_MOVRxi(R16, (unsigned)(arg));                                                                         \
+			emit(ADD(dst, rPSTACK, R16));                                                                              \
+		}                                                                                                              \
+	} while (0)
+
+// calls a C function, arguments are already in place
+#define emit_CALLC(func)                                                                                               \
+	do {                                                                                                               \
+		emit_MOVXi(R16, func);                                                                                         \
+		emit(BLR(R16));                                                                                                \
+	} while (0)
+
+// check if instruction in R0 is within range. Clobbers R1, R16. Always 9 instructions
+// so OP_CALL can branch over it
+#define CHECK_JUMP                                                                                                     \
+	do {                                                                                                               \
+		emit(MOVZ(R1, vm->instructionCount & 0xFFFF, 0));                                                              \
+		emit(MOVK(R1, (vm->instructionCount >> 16) & 0xFFFF, 1));                                                      \
+		emit(CMP(R0, R1));                                                                                             \
+		emit(Bcond(LO, 4 * 6));                                                                                        \
+		emit_CALLC(ErrJump);                                                                                           \
+	} while (0)
+
+// conditional branch to a constant instruction number, b.cond only
+// reaches +-1MB so it skips over an unconditional branch instead
+#define emit_Bcond(c, target)                                                                                          \
+	do {                                                                                                               \
+		if ((unsigned)(target) >= (unsigned)vm->instructionCount)                                                      \
+			DIE("jump target out of range at %d", pc);                                                                 \
+		emit(Bcond(INVERT(c), 8));                                                                                     \
+		emit(B(j_rel(vm->instructionPointers[target] - vm->codeLength)));                                              \
+	} while (0)
+
+#define IJ(comparator)                                                                                                 \
+	do {                                                                                                               \
+		emit(LDRWpost(R0, rOPSTACK, -4)); /* r0 = *opstack; opstack -= 4 */                                            \
+		emit(LDRWpost(R1, rOPSTACK, -4)); /* r1 = *opstack; opstack -= 4 */                                            \
+		emit(CMP(R1, R0));                                                                                             \
+		emit_Bcond(comparator, arg.i);                                                                                 \
+	} while (0)
+
+// the conditions are chosen so that unordered compares only satisfy OP_NEF
+#define FJ(comparator)                                                                                                 \
+	do {                                                                                                               \
+		emit(LDRWpost(R0, rOPSTACK, -4)); /* r0 = *opstack; opstack -= 4 */                                            \
+		emit(LDRWpost(R1, rOPSTACK, -4)); /* r1 = *opstack; opstack -= 4 */                                            \
+		emit(FMOVsw(S0, R1));                                                                                          \
+		emit(FMOVsw(S1, R0));                                                                                          \
+		emit(FCMP(S0, S1));                                                                                            \
+		emit_Bcond(comparator, arg.i);                                                                                 \
+	} while (0)
+
+// r0 = *opstack; opstack -= 4; r1 = *opstack, for binary operators
+#define LOAD_OPERANDS()                                                                                                \
+	do {                                                                                                               \
+		emit(LDRWi(R0, rOPSTACK, 0));                                                                                  \
+		emit(LDRWpre(R1, rOPSTACK, -4));                                                                               \
+	} while (0)
+
+static inline unsigned _j_rel(int x, int pc) {
+	if (x & 3)
+		goto err;
+	if (x < -(1 << 27) || x >= (1 << 27))
+		goto err;
+	return x;
+err:
+	DIE("jump %d out of range at %d", x, pc);
+}
+
+void VM_Compile(vm_t *vm, vmHeader_t *header) {
+	unsigned char *code;
+	int i_count, pc = 0;
+	int pass;
+	int codeStart = 0;
+
+#define j_rel(x) (pass ? _j_rel(x, pc) : 0)
+
+	vm->compiled = qfalse;
+
+	vm->codeBase = NULL;
+	vm->codeLength = 0;
+
+	for (pass = 0; pass < 2; ++pass) {
+
+		if (pass) {
+			vm->codeBase = mmap(NULL, vm->codeLength, PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+			if (vm->codeBase == MAP_FAILED)
+				Com_Error(ERR_FATAL, "VM_CompileAArch64: can't mmap memory");
+			vm->codeLength = 0;
+		}
+
+		// int (*entry)(vm_t *, int *programStack, int *opStack);
+		emit(STPXpre(FP, LR, SP, -64));
+		emit(ADDXi(FP, SP, 0)); // mov x29, sp
+		emit(STPXi(rOPSTACK, rPSTACK, SP, 16));
+		emit(STPXi(rDATABASE, rDATAMASK, SP, 32));
+		emit(STPXi(rINSPOINTERS, R1, SP, 48)); // keep programStack pointer for the write back
+		emit(LDRXi(rDATABASE, R0, offsetof(vm_t, dataBase)));
+		emit(LDRWi(rDATAMASK, R0, offsetof(vm_t, dataMask)));
+		emit(LDRXi(rINSPOINTERS, R0, offsetof(vm_t, instructionPointers)));
+		emit(LDRWi(rPSTACK, R1, 0));
+		emit(MOVX(rOPSTACK, R2));
+
+		emit(BL(j_rel(codeStart - vm->codeLength)));
+
+		// save return value in r0
+		emit(LDRWpost(R0, rOPSTACK, -4)); // r0 = *opstack; opstack -= 4
+
+		emit(LDPXi(rINSPOINTERS, R1, SP, 48));
+		emit(STRWi(rPSTACK, R1, 0)); // *programStack = pstack
+		emit(LDPXi(rDATABASE, rDATAMASK, SP, 32));
+		emit(LDPXi(rOPSTACK, rPSTACK, SP, 16));
+		emit(LDPXpost(FP, LR, SP, 64));
+		emit(RET);
+
+		codeStart = vm->codeLength;
+
+		code = (unsigned char *)header + header->codeOffset;
+		pc = 0;
+
+		for (i_count = 0; i_count < header->instructionCount; i_count++) {
+			union {
+				unsigned char b[4];
+				unsigned int i;
+			} arg;
+			unsigned char op = code[pc++];
+
+			vm->instructionPointers[i_count] = vm->codeLength;
+
+			if (vm_opInfo[op] & opImm4) {
+				memcpy(arg.b, &code[pc], 4);
+				pc += 4;
+			} else if (vm_opInfo[op] & opImm1) {
+				arg.i = code[pc];
+				++pc;
+			} else {
+				arg.i = 0;
+			}
+
+			switch (op) {
+			case OP_UNDEF:
+				break;
+
+			case OP_IGNORE:
+				NOTIMPL(op);
+				break;
+
+			case OP_BREAK:
+				emit(BRK(0));
+				break;
+
+			case OP_ENTER:
+				emit(PUSHLR);
+				if (arg.i < 0x1000) {
+					emit(SUBi(rPSTACK, rPSTACK, arg.i)); // pstack -= arg
+				} else {
+					emit_MOVRxi(R0, arg.i);
+					emit(SUB(rPSTACK, rPSTACK, R0)); // pstack -= arg
+				}
+				break;
+
+			case OP_LEAVE:
+				if (arg.i < 0x1000) {
+					emit(ADDi(rPSTACK, rPSTACK, arg.i)); // pstack += arg
+				} else {
+					emit_MOVRxi(R0, arg.i);
+					emit(ADD(rPSTACK, rPSTACK, R0)); // pstack += arg
+				}
+				emit(POPLR);
+				emit(RET);
+				break;
+
+			case OP_CALL:
+				// get instruction nr from stack
+				emit(LDRWpost(R0, rOPSTACK, -4)); // r0 = *opstack; opstack -= 4
+				emit(CMPi(R0, 0));				  // check if syscall
+				emit(Bcond(LT, 4 * 13));		  // skip b.lt, CHECK_JUMP and the VM call
+				CHECK_JUMP;
+				emit(LDRXr(R0, rINSPOINTERS, R0)); // x0 = instructionPointers[r0]
+				emit(BLR(R0));
+				emit(B(4 * 8)); // the callee left its return value on the opstack
+				emit(ADD(R1, rPSTACK, ZR)); // r1 = pstack
+				emit_CALLC(asmcall);
+				// store return value
+				emit(STRWpre(R0, rOPSTACK, 4)); // opstack += 4; *opstack = r0
+				break;
+
+			case OP_PUSH:
+				emit(ADDXi(rOPSTACK, rOPSTACK, 4));
+				break;
+
+			case OP_POP:
+				emit(SUBXi(rOPSTACK, rOPSTACK, 4));
+				break;
+
+			case OP_CONST:
+				emit_MOVRxi(R0, arg.i);
+				emit(STRWpre(R0, rOPSTACK, 4)); // opstack += 4; *opstack = r0
+				break;
+
+			case OP_LOCAL:
+				emit_ADDPStack(R0, arg.i);		// r0 = pstack + arg
+				emit(STRWpre(R0, rOPSTACK, 4)); // opstack += 4; *opstack = r0
+				break;
+
+			case OP_JUMP:
+				emit(LDRWpost(R0, rOPSTACK, -4)); // r0 = *opstack; opstack -= 4
+				CHECK_JUMP;
+				emit(LDRXr(R0, rINSPOINTERS, R0)); // x0 = instructionPointers[r0]
+				emit(BR(R0));
+				break;
+
+			case OP_EQ:
+				IJ(EQ);
+				break;
+
+			case OP_NE:
+				IJ(NE);
+				break;
+
+			case OP_LTI:
+				IJ(LT);
+				break;
+
+			case OP_LEI:
+				IJ(LE);
+				break;
+
+			case OP_GTI:
+				IJ(GT);
+				break;
+
+			case OP_GEI:
+				IJ(GE);
+				break;
+
+			case OP_LTU:
+				IJ(LO);
+				break;
+
+			case OP_LEU:
+				IJ(LS);
+				break;
+
+			case OP_GTU:
+				IJ(HI);
+				break;
+
+			case OP_GEU:
+				IJ(HS);
+				break;
+
+			case OP_EQF:
+				FJ(EQ);
+				break;
+
+			case OP_NEF:
+				FJ(NE);
+				break;
+
+			case OP_LTF:
+				FJ(MI);
+				break;
+
+			case OP_LEF:
+				FJ(LS);
+				break;
+
+			case OP_GTF:
+				FJ(GT);
+				break;
+
+			case OP_GEF:
+				FJ(GE);
+				break;
+
+			case OP_LOAD1:
+				emit(LDRWi(R0, rOPSTACK, 0));		// r0 = *opstack
+				emit(AND(R0, R0, rDATAMASK));		// r0 = r0 & rDATAMASK
+				emit(LDRBr(R0, rDATABASE, R0)); // r0 = (unsigned char)dataBase[r0]
+				emit(STRWi(R0, rOPSTACK, 0));		// *opstack = r0
+				break;
+
+			case OP_LOAD2:
+				emit(LDRWi(R0, rOPSTACK, 0));		// r0 = *opstack
+				emit(AND(R0, R0, rDATAMASK));		// r0 = r0 & rDATAMASK
+				emit(LDRHr(R0, rDATABASE, R0)); // r0 = (unsigned short)dataBase[r0]
+				emit(STRWi(R0, rOPSTACK, 0));		// *opstack = r0
+				break;
+
+			case OP_LOAD4:
+				emit(LDRWi(R0, rOPSTACK, 0));		// r0 = *opstack
+				emit(AND(R0, R0, rDATAMASK));		// r0 = r0 & rDATAMASK
+				emit(LDRWr(R0, rDATABASE, R0)); // r0 = dataBase[r0]
+				emit(STRWi(R0, rOPSTACK, 0));		// *opstack = r0
+				break;
+
+			case OP_STORE1:
+				emit(LDRWpost(R0, rOPSTACK, -4)); // r0 = *opstack; opstack -= 4
+				emit(LDRWpost(R1, rOPSTACK, -4)); // r1 = *opstack; opstack -= 4
+				emit(AND(R1, R1, rDATAMASK));	  // r1 = r1 & rDATAMASK
+				emit(STRBr(R0, rDATABASE, R1));	  // database[r1] = r0
+				break;
+
+			case OP_STORE2:
+				emit(LDRWpost(R0, rOPSTACK, -4)); // r0 = *opstack; opstack -= 4
+				emit(LDRWpost(R1, rOPSTACK, -4)); // r1 = *opstack; opstack -= 4
+				emit(AND(R1, R1, rDATAMASK));	  // r1 = r1 & rDATAMASK
+				emit(STRHr(R0, rDATABASE, R1));	  // database[r1] = r0
+				break;
+
+			case OP_STORE4:
+				emit(LDRWpost(R0, rOPSTACK, -4)); // r0 = *opstack; opstack -= 4
+				emit(LDRWpost(R1, rOPSTACK, -4)); // r1 = *opstack; opstack -= 4
+				emit(AND(R1, R1, rDATAMASK));	  // r1 = r1 & rDATAMASK
+				emit(STRWr(R0, rDATABASE, R1));	  // database[r1] = r0
+				break;
+
+			case OP_ARG:
+				emit(LDRWpost(R0, rOPSTACK, -4)); // r0 = *opstack; opstack -= 4
+				emit(ADDi(R1, rPSTACK, arg.i));	  // r1 = programStack + arg
+				emit(AND(R1, R1, rDATAMASK));	  // r1 = r1 & rDATAMASK
+				emit(STRWr(R0, rDATABASE, R1));	  // dataBase[r1] = r0
+				break;
+
+			case OP_BLOCK_COPY:
+				emit(LDRWpost(R1, rOPSTACK, -4)); // r1 = src; opstack -= 4
+				emit(LDRWpost(R0, rOPSTACK, -4)); // r0 = dest; opstack -= 4
+				emit_MOVRxi(R2, arg.i);
+				emit_CALLC(VM_BlockCopy);
+				break;
+
+			case OP_SEX8:
+				emit(LDRWi(R0, rOPSTACK, 0)); // r0 = *opstack
+				emit(SXTB(R0, R0));			  // sign extend r0
+				emit(STRWi(R0, rOPSTACK, 0)); // *opstack = r0
+				break;
+
+			case OP_SEX16:
+				emit(LDRWi(R0, rOPSTACK, 0)); // r0 = *opstack
+				emit(SXTH(R0, R0));			  // sign extend r0
+				emit(STRWi(R0, rOPSTACK, 0)); // *opstack = r0
+				break;
+
+			case OP_NEGI:
+				emit(LDRWi(R0, rOPSTACK, 0)); // r0 = *opstack
+				emit(NEG(R0, R0));			  // r0 = -r0
+				emit(STRWi(R0, rOPSTACK, 0)); // *opstack = r0
+				break;
+
+			case OP_ADD:
+				LOAD_OPERANDS();
+				emit(ADD(R0, R1, R0));		  // r0 = r1 + r0
+				emit(STRWi(R0, rOPSTACK, 0)); // *opstack = r0
+				break;
+
+			case OP_SUB:
+				LOAD_OPERANDS();
+				emit(SUB(R0, R1, R0));		  // r0 = r1 - r0
+				emit(STRWi(R0, rOPSTACK, 0)); // *opstack = r0
+				break;
+
+			case OP_DIVI:
+				LOAD_OPERANDS();
+				emit(SDIV(R0, R1, R0));		  // r0 = r1 / r0
+				emit(STRWi(R0, rOPSTACK, 0)); // *opstack = r0
+				break;
+
+			case OP_DIVU:
+				LOAD_OPERANDS();
+				emit(UDIV(R0, R1, R0));		  // r0 = (unsigned)r1 / r0
+				emit(STRWi(R0, rOPSTACK, 0)); // *opstack = r0
+				break;
+
+			case OP_MODI:
+				LOAD_OPERANDS();
+				emit(SDIV(R2, R1, R0));		  // r2 = r1 / r0
+				emit(MSUB(R0, R2, R0, R1));	  // r0 = r1 - r2 * r0
+				emit(STRWi(R0, rOPSTACK, 0)); // *opstack = r0
+				break;
+
+			case OP_MODU:
+				LOAD_OPERANDS();
+				emit(UDIV(R2, R1, R0));		  // r2 = (unsigned)r1 / r0
+				emit(MSUB(R0, R2, R0, R1));	  // r0 = r1 - r2 * r0
+				emit(STRWi(R0, rOPSTACK, 0)); // *opstack = r0
+				break;
+
+			case OP_MULI:
+			case OP_MULU:
+				LOAD_OPERANDS();
+				emit(MUL(R0, R1, R0));		  // r0 = r1 * r0
+				emit(STRWi(R0, rOPSTACK, 0)); // *opstack = r0
+				break;
+
+			case OP_BAND:
+				LOAD_OPERANDS();
+				emit(AND(R0, R1, R0));		  // r0 = r1 & r0
+				emit(STRWi(R0, rOPSTACK, 0)); // *opstack = r0
+				break;
+
+			case OP_BOR:
+				LOAD_OPERANDS();
+				emit(ORR(R0, R1, R0));		  // r0 = r1 | r0
+				emit(STRWi(R0, rOPSTACK, 0)); // *opstack = r0
+				break;
+
+			case OP_BXOR:
+				LOAD_OPERANDS();
+				emit(EOR(R0, R1, R0));		  // r0 = r1 ^ r0
+				emit(STRWi(R0, rOPSTACK, 0)); // *opstack = r0
+				break;
+
+			case OP_BCOM:
+				emit(LDRWi(R0, rOPSTACK, 0)); // r0 = *opstack
+				emit(MVN(R0, R0));			  // r0 = ~r0
+				emit(STRWi(R0, rOPSTACK, 0)); // *opstack = r0
+				break;
+
+			case OP_LSH:
+				LOAD_OPERANDS();
+				emit(LSL(R0, R1, R0));		  // r0 = r1 << r0
+				emit(STRWi(R0, rOPSTACK, 0)); // *opstack = r0
+				break;
+
+			case OP_RSHI:
+				LOAD_OPERANDS();
+				emit(ASR(R0, R1, R0));		  // r0 = r1 >> r0
+				emit(STRWi(R0, rOPSTACK, 0)); // *opstack = r0
+				break;
+
+			case OP_RSHU:
+				LOAD_OPERANDS();
+				emit(LSR(R0, R1, R0));		  // r0 = (unsigned)r1 >> r0
+				emit(STRWi(R0, rOPSTACK, 0)); // *opstack = r0
+				break;
+
+			case OP_NEGF:
+				emit(LDRWi(R0, rOPSTACK, 0)); // r0 = *opstack
+				emit(FMOVsw(S0, R0));		  // s0 = r0
+				emit(FNEG(S0, S0));			  // s0 = -s0
+				emit(FMOVws(R0, S0));		  // r0 = s0
+				emit(STRWi(R0, rOPSTACK, 0)); // *opstack = r0
+				break;
+
+			case OP_ADDF:
+			case OP_SUBF:
+			case OP_MULF:
+			case OP_DIVF:
+				LOAD_OPERANDS();
+				emit(FMOVsw(S0, R1)); // s0 = r1
+				emit(FMOVsw(S1, R0)); // s1 = r0
+				if (op == OP_ADDF)
+					emit(FADD(S0, S0, S1)); // s0 = s0 + s1
+				else if (op == OP_SUBF)
+					emit(FSUB(S0, S0, S1)); // s0 = s0 - s1
+				else if (op == OP_MULF)
+					emit(FMUL(S0, S0, S1)); // s0 = s0 * s1
+				else
+					emit(FDIV(S0, S0, S1)); // s0 = s0 / s1
+				emit(FMOVws(R0, S0));		  // r0 = s0
+				emit(STRWi(R0, rOPSTACK, 0)); // *opstack = r0
+				break;
+
+			case OP_CVIF:
+				emit(LDRWi(R0, rOPSTACK, 0)); // r0 = *opstack
+				emit(SCVTF(S0, R0));		  // s0 = (float)r0
+				emit(FMOVws(R0, S0));		  // r0 = s0
+				emit(STRWi(R0, rOPSTACK, 0)); // *opstack = r0
+				break;
+
+			case OP_CVFI:
+				emit(LDRWi(R0, rOPSTACK, 0)); // r0 = *opstack
+				emit(FMOVsw(S0, R0));		  // s0 = r0
+				emit(FCVTZS(R0, S0));		  // r0 = (int)s0
+				emit(STRWi(R0, rOPSTACK, 0)); // *opstack = r0
+				break;
+
+			default:
+				NOTIMPL(op);
+				break;
+			}
+		}
+
+		// never reached
+		emit(BRK(0));
+	} // pass
+
+	if (mprotect(vm->codeBase, vm->codeLength, PROT_READ | PROT_EXEC)) {
+		VM_Destroy_Compiled(vm);
+		DIE("mprotect failed");
+	}
+
+	__builtin___clear_cache((char *)vm->codeBase, (char *)vm->codeBase + vm->codeLength);
+
+	// indirect jumps and calls load absolute addresses
+	for (i_count = 0; i_count < header->instructionCount; i_count++)
+		vm->instructionPointers[i_count] += (intptr_t)vm->codeBase;
+
+	vm->destroy = VM_Destroy_Compiled;
+	vm->compiled = qtrue;
+}
+
+int VM_CallCompiled(vm_t *vm, int *args) {
+	byte stack[OPSTACK_SIZE + 15];
+	int *opStack;
+	int programStack = vm->programStack;
+	int stackOnEntry = programStack;
+	byte *image = vm->dataBase;
+	int *argPointer;
+	int retVal;
+
+	currentVM = vm;
+
+	vm->currentlyInterpreting = qtrue;
+
+	programStack -= (8 + 4 * MAX_VMMAIN_ARGS);
+	argPointer = (int *)&image[programStack + 8];
+	memcpy(argPointer, args, 4 * MAX_VMMAIN_ARGS);
+	argPointer[-1] = 0;
+	argPointer[-2] = -1;
+
+	opStack = PADP(stack, 16);
+	*opStack = 0xDEADBEEF;
+
+	/* call generated code */
+	{
+		int (*entry)(vm_t *, int *, int *);
+
+		entry = (void *)(vm->codeBase);
+		retVal = entry(vm, &programStack, opStack);
+	}
+
+	if (*opStack != 0xDEADBEEF) {
+		Com_Error(ERR_DROP, "opStack corrupted in compiled code");
+	}
+
+	if (programStack != stackOnEntry - (8 + 4 * MAX_VMMAIN_ARGS))
+		Com_Error(ERR_DROP, "programStack corrupted in compiled code");
+
+	vm->programStack = stackOnEntry;
+	vm->currentlyInterpreting = qfalse;
+
+	return retVal;
+}
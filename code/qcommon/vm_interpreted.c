@@ -99,6 +99,28 @@ static ID_INLINE int loadWord(void *addr) {
 }
 #endif
 
+// superinstructions for common opcode pairs, only ever written into
+// codeBase by VM_PrepareInterpreter. The second opcode of the pair is
+// left in place so jumps to it still work
+enum {
+	OP_LOCAL_LOAD4 = OP_CVFI + 1, // OP_LOCAL n; OP_LOAD4
+	OP_CONST_ADD,				  // OP_CONST n; OP_ADD
+	OP_CONST_JUMP,				  // OP_CONST n; OP_JUMP with n translated to a code index
+
+	OP_NUM_INTERPRETED
+};
+
+// jump straight from one handler to the next through a label table
+// instead of going around the switch each time
+#if defined(__GNUC__) && !defined(DEBUG_VM)
+#define VM_THREADED_DISPATCH
+#define VM_CASE(op)                                                                                                    \
+	case op:                                                                                                           \
+	op_##op
+#else
+#define VM_CASE(op) case op
+#endif
+
 char *VM_Indent(vm_t *vm) {
 	static char *string = "                                        ";
 	if (vm->callLevel > 20) {
@@ -147,6 +169,8 @@ void VM_PrepareInterpreter(vm_t *vm, vmHeader_t *header) {
 		instruction++;
 
 		op = (int)code[byte_pc];
+		if (op > OP_CVFI)
+			op = OP_UNDEF; // keeps the dispatch table in range, these were skipped anyway
 		codeBase[int_pc] = op;
 		if (byte_pc > header->codeLength)
 			Com_Error(ERR_DROP, "VM_PrepareInterpreter: pc > header->codeLength");
@@ -227,10 +251,29 @@ void VM_PrepareInterpreter(vm_t *vm, vmHeader_t *header) {
 			int_pc++;
 			break;
 
-		// These opcodes have an operand that isn't an instruction index
-		case OP_ENTER:
+		// Fuse the common pairs into superinstructions
 		case OP_CONST:
+			if (instruction < header->instructionCount) {
+				if (codeBase[int_pc + 1] == OP_ADD) {
+					codeBase[int_pc - 1] = OP_CONST_ADD;
+				} else if (codeBase[int_pc + 1] == OP_JUMP &&
+						   (unsigned)codeBase[int_pc] < (unsigned)vm->instructionCount) {
+					// out of range targets are left to OP_JUMP to report
+					codeBase[int_pc - 1] = OP_CONST_JUMP;
+					codeBase[int_pc] = vm->instructionPointers[codeBase[int_pc]];
+				}
+			}
+			int_pc++;
+			break;
+
 		case OP_LOCAL:
+			if (instruction < header->instructionCount && codeBase[int_pc + 1] == OP_LOAD4)
+				codeBase[int_pc - 1] = OP_LOCAL_LOAD4;
+			int_pc++;
+			break;
+
+		// These opcodes have an operand that isn't an instruction index
+		case OP_ENTER:
 		case OP_LEAVE:
 		case OP_BLOCK_COPY:
 		case OP_ARG:
@@ -284,6 +327,73 @@ int VM_CallInterpreted(vm_t *vm, int *args) {
 #ifdef DEBUG_VM
 	vmSymbol_t *profileSymbol;
 #endif
+#ifdef VM_THREADED_DISPATCH
+	static const void *const dispatchTable[OP_NUM_INTERPRETED] = {
+		[OP_UNDEF] = &&op_OP_BAD,
+		[OP_IGNORE] = &&op_OP_BAD,
+		[OP_BREAK] = &&op_OP_BREAK,
+		[OP_ENTER] = &&op_OP_ENTER,
+		[OP_LEAVE] = &&op_OP_LEAVE,
+		[OP_CALL] = &&op_OP_CALL,
+		[OP_PUSH] = &&op_OP_PUSH,
+		[OP_POP] = &&op_OP_POP,
+		[OP_CONST] = &&op_OP_CONST,
+		[OP_LOCAL] = &&op_OP_LOCAL,
+		[OP_JUMP] = &&op_OP_JUMP,
+		[OP_EQ] = &&op_OP_EQ,
+		[OP_NE] = &&op_OP_NE,
+		[OP_LTI] = &&op_OP_LTI,
+		[OP_LEI] = &&op_OP_LEI,
+		[OP_GTI] = &&op_OP_GTI,
+		[OP_GEI] = &&op_OP_GEI,
+		[OP_LTU] = &&op_OP_LTU,
+		[OP_LEU] = &&op_OP_LEU,
+		[OP_GTU] = &&op_OP_GTU,
+		[OP_GEU] = &&op_OP_GEU,
+		[OP_EQF] = &&op_OP_EQF,
+		[OP_NEF] = &&op_OP_NEF,
+		[OP_LTF] = &&op_OP_LTF,
+		[OP_LEF] = &&op_OP_LEF,
+		[OP_GTF] = &&op_OP_GTF,
+		[OP_GEF] = &&op_OP_GEF,
+		[OP_LOAD1] = &&op_OP_LOAD1,
+		[OP_LOAD2] = &&op_OP_LOAD2,
+		[OP_LOAD4] = &&op_OP_LOAD4,
+		[OP_STORE1] = &&op_OP_STORE1,
+		[OP_STORE2] = &&op_OP_STORE2,
+		[OP_STORE4] = &&op_OP_STORE4,
+		[OP_ARG] = &&op_OP_ARG,
+		[OP_BLOCK_COPY] = &&op_OP_BLOCK_COPY,
+		[OP_SEX8] = &&op_OP_SEX8,
+		[OP_SEX16] = &&op_OP_SEX16,
+		[OP_NEGI] = &&op_OP_NEGI,
+		[OP_ADD] = &&op_OP_ADD,
+		[OP_SUB] = &&op_OP_SUB,
+		[OP_DIVI] = &&op_OP_DIVI,
+		[OP_DIVU] = &&op_OP_DIVU,
+		[OP_MODI] = &&op_OP_MODI,
+		[OP_MODU] = &&op_OP_MODU,
+		[OP_MULI] = &&op_OP_MULI,
+		[OP_MULU] = &&op_OP_MULU,
+		[OP_BAND] = &&op_OP_BAND,
+		[OP_BOR] = &&op_OP_BOR,
+		[OP_BXOR] = &&op_OP_BXOR,
+		[OP_BCOM] = &&op_OP_BCOM,
+		[OP_LSH] = &&op_OP_LSH,
+		[OP_RSHI] = &&op_OP_RSHI,
+		[OP_RSHU] = &&op_OP_RSHU,
+		[OP_NEGF] = &&op_OP_NEGF,
+		[OP_ADDF] = &&op_OP_ADDF,
+		[OP_SUBF] = &&op_OP_SUBF,
+		[OP_DIVF] = &&op_OP_DIVF,
+		[OP_MULF] = &&op_OP_MULF,
+		[OP_CVIF] = &&op_OP_CVIF,
+		[OP_CVFI] = &&op_OP_CVFI,
+		[OP_LOCAL_LOAD4] = &&op_OP_LOCAL_LOAD4,
+		[OP_CONST_ADD] = &&op_OP_CONST_ADD,
+		[OP_CONST_JUMP] = &&op_OP_CONST_JUMP,
+	};
+#endif
 
 	// interpret the code
 	vm->currentlyInterpreting = qtrue;
@@ -358,23 +468,31 @@ int VM_CallInterpreted(vm_t *vm, int *args) {
 #endif
 		opcode = codeImage[programCounter++];
 
+#ifdef VM_THREADED_DISPATCH
+		goto *dispatchTable[opcode];
+#endif
 		switch (opcode) {
-#ifdef DEBUG_VM
 		default:
+#ifdef VM_THREADED_DISPATCH
+		op_OP_BAD:
+#endif
+#ifdef DEBUG_VM
 			Com_Error(ERR_DROP, "Bad VM instruction"); // this should be scanned on load!
 			return 0;
+#else
+			goto nextInstruction;
 #endif
-		case OP_BREAK:
+		VM_CASE(OP_BREAK):
 			vm->breakCount++;
 			goto nextInstruction2;
-		case OP_CONST:
+		VM_CASE(OP_CONST):
 			opStackOfs++;
 			r1 = r0;
 			r0 = opStack[opStackOfs] = r2;
 
 			programCounter += 1;
 			goto nextInstruction2;
-		case OP_LOCAL:
+		VM_CASE(OP_LOCAL):
 			opStackOfs++;
 			r1 = r0;
 			r0 = opStack[opStackOfs] = r2 + programStack;
@@ -382,7 +500,20 @@ int VM_CallInterpreted(vm_t *vm, int *args) {
 			programCounter += 1;
 			goto nextInstruction2;
 
-		case OP_LOAD4:
+		VM_CASE(OP_LOCAL_LOAD4):
+			opStackOfs++;
+			r1 = r0;
+			r0 = opStack[opStackOfs] = *(int *)&image[(r2 + programStack) & dataMask];
+
+			programCounter += 2; // skip the OP_LOAD4 as well
+			goto nextInstruction2;
+		VM_CASE(OP_CONST_ADD):
+			r0 = opStack[opStackOfs] = r0 + r2;
+
+			programCounter += 2; // skip the OP_ADD as well
+			goto nextInstruction2;
+
+		VM_CASE(OP_LOAD4):
 #ifdef DEBUG_VM
 			if (opStack[opStackOfs] & 3) {
 				Com_Error(ERR_DROP, "OP_LOAD4 misaligned");
@@ -391,40 +522,40 @@ int VM_CallInterpreted(vm_t *vm, int *args) {
 #endif
 			r0 = opStack[opStackOfs] = *(int *)&image[r0 & dataMask];
 			goto nextInstruction2;
-		case OP_LOAD2:
+		VM_CASE(OP_LOAD2):
 			r0 = opStack[opStackOfs] = *(unsigned short *)&image[r0 & dataMask];
 			goto nextInstruction2;
-		case OP_LOAD1:
+		VM_CASE(OP_LOAD1):
 			r0 = opStack[opStackOfs] = image[r0 & dataMask];
 			goto nextInstruction2;
 
-		case OP_STORE4:
+		VM_CASE(OP_STORE4):
 			*(int *)&image[r1 & dataMask] = r0;
 			opStackOfs -= 2;
 			goto nextInstruction;
-		case OP_STORE2:
+		VM_CASE(OP_STORE2):
 			*(short *)&image[r1 & dataMask] = r0;
 			opStackOfs -= 2;
 			goto nextInstruction;
-		case OP_STORE1:
+		VM_CASE(OP_STORE1):
 			image[r1 & dataMask] = r0;
 			opStackOfs -= 2;
 			goto nextInstruction;
 
-		case OP_ARG:
+		VM_CASE(OP_ARG):
 			// single byte offset from programStack
 			*(int *)&image[(codeImage[programCounter] + programStack) & dataMask] = r0;
 			opStackOfs--;
 			programCounter += 1;
 			goto nextInstruction;
 
-		case OP_BLOCK_COPY:
+		VM_CASE(OP_BLOCK_COPY):
 			VM_BlockCopy(r1, r0, r2);
 			programCounter += 1;
 			opStackOfs -= 2;
 			goto nextInstruction;
 
-		case OP_CALL:
+		VM_CASE(OP_CALL):
 			// save current program counter
 			*(int *)&image[programStack] = programCounter;
 
@@ -461,10 +592,10 @@ int VM_CallInterpreted(vm_t *vm, int *args) {
 						for (i = 0; i < ARRAY_LEN(argarr); ++i) {
 							argarr[i] = *(++imagePtr);
 						}
-						r = vm->systemCall(argarr);
+						r = VM_SystemCall(vm, argarr);
 					} else {
 						intptr_t *argptr = (intptr_t *)&image[programStack + 4];
-						r = vm->systemCall(argptr);
+						r = VM_SystemCall(vm, argptr);
 					}
 				}
 
@@ -493,14 +624,14 @@ int VM_CallInterpreted(vm_t *vm, int *args) {
 			goto nextInstruction;
 
 		// push and pop are only needed for discarded or bad function return values
-		case OP_PUSH:
+		VM_CASE(OP_PUSH):
 			opStackOfs++;
 			goto nextInstruction;
-		case OP_POP:
+		VM_CASE(OP_POP):
 			opStackOfs--;
 			goto nextInstruction;
 
-		case OP_ENTER:
+		VM_CASE(OP_ENTER):
 #ifdef DEBUG_VM
 			profileSymbol = VM_ValueToFunctionSymbol(vm, programCounter);
 #endif
@@ -509,6 +640,10 @@ int VM_CallInterpreted(vm_t *vm, int *args) {
 
 			programCounter += 1;
 			programStack -= v1;
+
+			// where the profiler starts walking the stack
+			vm->profilePC = programCounter;
+			vm->profileStack = programStack;
 #ifdef DEBUG_VM
 			// save old stack frame for debugging traces
 			*(int *)&image[programStack + 4] = programStack + v1;
@@ -524,7 +659,7 @@ int VM_CallInterpreted(vm_t *vm, int *args) {
 			}
 #endif
 			goto nextInstruction;
-		case OP_LEAVE:
+		VM_CASE(OP_LEAVE):
 			// remove our stack frame
 			v1 = r2;
 
@@ -532,6 +667,9 @@ int VM_CallInterpreted(vm_t *vm, int *args) {
 
 			// grab the saved program counter
 			programCounter = *(int *)&image[programStack];
+
+			vm->profilePC = programCounter;
+			vm->profileStack = programStack;
 #ifdef DEBUG_VM
 			profileSymbol = VM_ValueToFunctionSymbol(vm, programCounter);
 			if (vm_debugLevel) {
@@ -554,7 +692,7 @@ int VM_CallInterpreted(vm_t *vm, int *args) {
 			===================================================================
 			*/
 
-		case OP_JUMP:
+		VM_CASE(OP_JUMP):
 			if ((unsigned)r0 >= vm->instructionCount) {
 				Com_Error(ERR_DROP, "VM program counter out of range in OP_JUMP");
 				return 0;
@@ -565,7 +703,12 @@ int VM_CallInterpreted(vm_t *vm, int *args) {
 			opStackOfs--;
 			goto nextInstruction;
 
-		case OP_EQ:
+		VM_CASE(OP_CONST_JUMP):
+			// the target was checked and translated by VM_PrepareInterpreter
+			programCounter = r2;
+			goto nextInstruction;
+
+		VM_CASE(OP_EQ):
 			opStackOfs -= 2;
 			if (r1 == r0) {
 				programCounter = r2; // vm->instructionPointers[r2];
@@ -575,7 +718,7 @@ int VM_CallInterpreted(vm_t *vm, int *args) {
 				goto nextInstruction;
 			}
 
-		case OP_NE:
+		VM_CASE(OP_NE):
 			opStackOfs -= 2;
 			if (r1 != r0) {
 				programCounter = r2; // vm->instructionPointers[r2];
@@ -585,7 +728,7 @@ int VM_CallInterpreted(vm_t *vm, int *args) {
 				goto nextInstruction;
 			}
 
-		case OP_LTI:
+		VM_CASE(OP_LTI):
 			opStackOfs -= 2;
 			if (r1 < r0) {
 				programCounter = r2; // vm->instructionPointers[r2];
@@ -595,7 +738,7 @@ int VM_CallInterpreted(vm_t *vm, int *args) {
 				goto nextInstruction;
 			}
 
-		case OP_LEI:
+		VM_CASE(OP_LEI):
 			opStackOfs -= 2;
 			if (r1 <= r0) {
 				programCounter = r2; // vm->instructionPointers[r2];
@@ -605,7 +748,7 @@ int VM_CallInterpreted(vm_t *vm, int *args) {
 				goto nextInstruction;
 			}
 
-		case OP_GTI:
+		VM_CASE(OP_GTI):
 			opStackOfs -= 2;
 			if (r1 > r0) {
 				programCounter = r2; // vm->instructionPointers[r2];
@@ -615,7 +758,7 @@ int VM_CallInterpreted(vm_t *vm, int *args) {
 				goto nextInstruction;
 			}
 
-		case OP_GEI:
+		VM_CASE(OP_GEI):
 			opStackOfs -= 2;
 			if (r1 >= r0) {
 				programCounter = r2; // vm->instructionPointers[r2];
@@ -625,7 +768,7 @@ int VM_CallInterpreted(vm_t *vm, int *args) {
 				goto nextInstruction;
 			}
 
-		case OP_LTU:
+		VM_CASE(OP_LTU):
 			opStackOfs -= 2;
 			if (((unsigned)r1) < ((unsigned)r0)) {
 				programCounter = r2; // vm->instructionPointers[r2];
@@ -635,7 +778,7 @@ int VM_CallInterpreted(vm_t *vm, int *args) {
 				goto nextInstruction;
 			}
 
-		case OP_LEU:
+		VM_CASE(OP_LEU):
 			opStackOfs -= 2;
 			if (((unsigned)r1) <= ((unsigned)r0)) {
 				programCounter = r2; // vm->instructionPointers[r2];
@@ -645,7 +788,7 @@ int VM_CallInterpreted(vm_t *vm, int *args) {
 				goto nextInstruction;
 			}
 
-		case OP_GTU:
+		VM_CASE(OP_GTU):
 			opStackOfs -= 2;
 			if (((unsigned)r1) > ((unsigned)r0)) {
 				programCounter = r2; // vm->instructionPointers[r2];
@@ -655,7 +798,7 @@ int VM_CallInterpreted(vm_t *vm, int *args) {
 				goto nextInstruction;
 			}
 
-		case OP_GEU:
+		VM_CASE(OP_GEU):
 			opStackOfs -= 2;
 			if (((unsigned)r1) >= ((unsigned)r0)) {
 				programCounter = r2; // vm->instructionPointers[r2];
@@ -665,7 +808,7 @@ int VM_CallInterpreted(vm_t *vm, int *args) {
 				goto nextInstruction;
 			}
 
-		case OP_EQF:
+		VM_CASE(OP_EQF):
 			opStackOfs -= 2;
 
 			if (((float *)opStack)[(uint8_t)(opStackOfs + 1)] == ((float *)opStack)[(uint8_t)(opStackOfs + 2)]) {
@@ -676,7 +819,7 @@ int VM_CallInterpreted(vm_t *vm, int *args) {
 				goto nextInstruction;
 			}
 
-		case OP_NEF:
+		VM_CASE(OP_NEF):
 			opStackOfs -= 2;
 
 			if (((float *)opStack)[(uint8_t)(opStackOfs + 1)] != ((float *)opStack)[(uint8_t)(opStackOfs + 2)]) {
@@ -687,7 +830,7 @@ int VM_CallInterpreted(vm_t *vm, int *args) {
 				goto nextInstruction;
 			}
 
-		case OP_LTF:
+		VM_CASE(OP_LTF):
 			opStackOfs -= 2;
 
 			if (((float *)opStack)[(uint8_t)(opStackOfs + 1)] < ((float *)opStack)[(uint8_t)(opStackOfs + 2)]) {
@@ -698,7 +841,7 @@ int VM_CallInterpreted(vm_t *vm, int *args) {
 				goto nextInstruction;
 			}
 
-		case OP_LEF:
+		VM_CASE(OP_LEF):
 			opStackOfs -= 2;
 
 			if (((float *)opStack)[(uint8_t)((uint8_t)(opStackOfs + 1))] <=
@@ -710,7 +853,7 @@ int VM_CallInterpreted(vm_t *vm, int *args) {
 				goto nextInstruction;
 			}
 
-		case OP_GTF:
+		VM_CASE(OP_GTF):
 			opStackOfs -= 2;
 
 			if (((float *)opStack)[(uint8_t)(opStackOfs + 1)] > ((float *)opStack)[(uint8_t)(opStackOfs + 2)]) {
@@ -721,7 +864,7 @@ int VM_CallInterpreted(vm_t *vm, int *args) {
 				goto nextInstruction;
 			}
 
-		case OP_GEF:
+		VM_CASE(OP_GEF):
 			opStackOfs -= 2;
 
 			if (((float *)opStack)[(uint8_t)(opStackOfs + 1)] >= ((float *)opStack)[(uint8_t)(opStackOfs + 2)]) {
@@ -734,105 +877,105 @@ int VM_CallInterpreted(vm_t *vm, int *args) {
 
 			//===================================================================
 
-		case OP_NEGI:
+		VM_CASE(OP_NEGI):
 			opStack[opStackOfs] = -r0;
 			goto nextInstruction;
-		case OP_ADD:
+		VM_CASE(OP_ADD):
 			opStackOfs--;
 			opStack[opStackOfs] = r1 + r0;
 			goto nextInstruction;
-		case OP_SUB:
+		VM_CASE(OP_SUB):
 			opStackOfs--;
 			opStack[opStackOfs] = r1 - r0;
 			goto nextInstruction;
-		case OP_DIVI:
+		VM_CASE(OP_DIVI):
 			opStackOfs--;
 			opStack[opStackOfs] = r1 / r0;
 			goto nextInstruction;
-		case OP_DIVU:
+		VM_CASE(OP_DIVU):
 			opStackOfs--;
 			opStack[opStackOfs] = ((unsigned)r1) / ((unsigned)r0);
 			goto nextInstruction;
-		case OP_MODI:
+		VM_CASE(OP_MODI):
 			opStackOfs--;
 			opStack[opStackOfs] = r1 % r0;
 			goto nextInstruction;
-		case OP_MODU:
+		VM_CASE(OP_MODU):
 			opStackOfs--;
 			opStack[opStackOfs] = ((unsigned)r1) % ((unsigned)r0);
 			goto nextInstruction;
-		case OP_MULI:
+		VM_CASE(OP_MULI):
 			opStackOfs--;
 			opStack[opStackOfs] = r1 * r0;
 			goto nextInstruction;
-		case OP_MULU:
+		VM_CASE(OP_MULU):
 			opStackOfs--;
 			opStack[opStackOfs] = ((unsigned)r1) * ((unsigned)r0);
 			goto nextInstruction;
 
-		case OP_BAND:
+		VM_CASE(OP_BAND):
 			opStackOfs--;
 			opStack[opStackOfs] = ((unsigned)r1) & ((unsigned)r0);
 			goto nextInstruction;
-		case OP_BOR:
+		VM_CASE(OP_BOR):
 			opStackOfs--;
 			opStack[opStackOfs] = ((unsigned)r1) | ((unsigned)r0);
 			goto nextInstruction;
-		case OP_BXOR:
+		VM_CASE(OP_BXOR):
 			opStackOfs--;
 			opStack[opStackOfs] = ((unsigned)r1) ^ ((unsigned)r0);
 			goto nextInstruction;
-		case OP_BCOM:
+		VM_CASE(OP_BCOM):
 			opStack[opStackOfs] = ~((unsigned)r0);
 			goto nextInstruction;
 
-		case OP_LSH:
+		VM_CASE(OP_LSH):
 			opStackOfs--;
 			opStack[opStackOfs] = r1 << r0;
 			goto nextInstruction;
-		case OP_RSHI:
+		VM_CASE(OP_RSHI):
 			opStackOfs--;
 			opStack[opStackOfs] = r1 >> r0;
 			goto nextInstruction;
-		case OP_RSHU:
+		VM_CASE(OP_RSHU):
 			opStackOfs--;
 			opStack[opStackOfs] = ((unsigned)r1) >> r0;
 			goto nextInstruction;
 
-		case OP_NEGF:
+		VM_CASE(OP_NEGF):
 			((float *)opStack)[opStackOfs] = -((float *)opStack)[opStackOfs];
 			goto nextInstruction;
-		case OP_ADDF:
+		VM_CASE(OP_ADDF):
 			opStackOfs--;
 			((float *)opStack)[opStackOfs] =
 				((float *)opStack)[opStackOfs] + ((float *)opStack)[(uint8_t)(opStackOfs + 1)];
 			goto nextInstruction;
-		case OP_SUBF:
+		VM_CASE(OP_SUBF):
 			opStackOfs--;
 			((float *)opStack)[opStackOfs] =
 				((float *)opStack)[opStackOfs] - ((float *)opStack)[(uint8_t)(opStackOfs + 1)];
 			goto nextInstruction;
-		case OP_DIVF:
+		VM_CASE(OP_DIVF):
 			opStackOfs--;
 			((float *)opStack)[opStackOfs] =
 				((float *)opStack)[opStackOfs] / ((float *)opStack)[(uint8_t)(opStackOfs + 1)];
 			goto nextInstruction;
-		case OP_MULF:
+		VM_CASE(OP_MULF):
 			opStackOfs--;
 			((float *)opStack)[opStackOfs] =
 				((float *)opStack)[opStackOfs] * ((float *)opStack)[(uint8_t)(opStackOfs + 1)];
 			goto nextInstruction;
 
-		case OP_CVIF:
+		VM_CASE(OP_CVIF):
 			((float *)opStack)[opStackOfs] = (float)opStack[opStackOfs];
 			goto nextInstruction;
-		case OP_CVFI:
+		VM_CASE(OP_CVFI):
 			opStack[opStackOfs] = Q_ftol(((float *)opStack)[opStackOfs]);
 			goto nextInstruction;
-		case OP_SEX8:
+		VM_CASE(OP_SEX8):
 			opStack[opStackOfs] = (signed char)opStack[opStackOfs];
 			goto nextInstruction;
-		case OP_SEX16:
+		VM_CASE(OP_SEX16):
 			opStack[opStackOfs] = (short)opStack[opStackOfs];
 			goto nextInstruction;
 		}
@@ -40,6 +40,10 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #define PROGRAM_STACK_SIZE 0x10000
 #define PROGRAM_STACK_MASK (PROGRAM_STACK_SIZE - 1)
 
+// room allocated past the masked data, so the x86_64 compiler can leave
+// program stack accesses at non-negative offsets within a frame unmasked
+#define VM_DATA_GUARD PROGRAM_STACK_SIZE
+
 typedef enum {
 	OP_UNDEF,
 
@@ -132,6 +136,7 @@ typedef int vmptr_t;
 typedef struct vmSymbol_s {
 	struct vmSymbol_s *next;
 	int symValue;
+	int symInstruction; // -1 if the value is not an instruction number
 	int profileCount;
 	char symName[1]; // variable sized
 } vmSymbol_t;
@@ -169,6 +174,8 @@ struct vm_s {
 	byte *dataBase;
 	int dataMask;
 	int dataAlloc; // actually allocated
+	byte *dataImage; // initialized data as loaded, for VM_Restart
+	int dataImageLength;
 
 	int stackBottom; // if programStack < stackBottom, error
 
@@ -181,6 +188,21 @@ struct vm_s {
 
 	byte *jumpTableTargets;
 	int numJumpTableTargets;
+
+	// identifies the loaded image for the compiled code cache
+	int imageLength;
+	unsigned int imageChecksum;
+
+	// sampling profiler state, read from a signal handler
+	int *profileFrames;		// interpreted: frame size of the function around each instruction
+	void *profileNativeTop; // compiled: native stack pointer at VM_Call
+	int profilePC;			// interpreted: code offset and programStack at the
+	int profileStack;		// last function entry or return
+
+	// systemCall or a fast path handler for every trap below numSyscalls
+	const vmSyscallDef_t *syscallDefs;
+	vmSyscall_t *syscallTable;
+	int numSyscalls;
 };
 
 extern vm_t *currentVM;
@@ -197,3 +219,24 @@ const char *VM_ValueToSymbol(vm_t *vm, int value);
 void VM_LogSyscalls(int *args);
 
 void VM_BlockCopy(unsigned int dest, unsigned int src, size_t n);
+
+vmInline_t VM_SyscallInline(vm_t *vm, int callNum);
+
+memOwner_t VM_MemOwner(const char *module);
+
+void *VM_LoadCodeCache(vm_t *vm, const char *build, int *length);
+void VM_SaveCodeCache(vm_t *vm, const char *build, const void *data, int length);
+
+/*
+=================
+VM_SystemCall
+
+Dispatches a trap, args[0] holds the trap number
+=================
+*/
+static ID_INLINE intptr_t VM_SystemCall(vm_t *vm, intptr_t *args) {
+	if ((uintptr_t)args[0] < (uintptr_t)vm->numSyscalls)
+		return vm->syscallTable[args[0]](args);
+
+	return vm->systemCall(args);
+}
@@ -58,10 +58,22 @@ x86_64:
 
 */
 
+#if idx64
+#define VMFREE_RELOCS()                                                                                                \
+	do {                                                                                                               \
+		if (relocs)                                                                                                    \
+			Z_Free(relocs);                                                                                            \
+		relocs = NULL;                                                                                                 \
+	} while (0)
+#else
+#define VMFREE_RELOCS()
+#endif
+
 #define VMFREE_BUFFERS()                                                                                               \
 	do {                                                                                                               \
 		Z_Free(buf);                                                                                                   \
 		Z_Free(jused);                                                                                                 \
+		VMFREE_RELOCS();                                                                                               \
 	} while (0)
 static byte *buf = NULL;
 static byte *jused = NULL;
@@ -84,10 +96,26 @@ typedef enum {
 	LAST_COMMAND_SUB_BL_2,
 } ELastCommand;
 
-typedef enum { VM_JMP_VIOLATION = 0, VM_BLOCK_COPY = 1 } ESysCallType;
+typedef enum { VM_JMP_VIOLATION = 0, VM_BLOCK_COPY = 1, VM_STACK_VIOLATION = 2 } ESysCallType;
 
 static ELastCommand LastCommand;
 
+#if idx64
+// host addresses in the code, patched when it is loaded from the code cache
+typedef struct {
+	int ofs;
+	int target;
+} vmReloc_t;
+
+#define MAX_RELOC_TARGETS 24
+
+static vmReloc_t *relocs = NULL;
+static int numRelocs, maxRelocs, prologueRelocs;
+static qboolean relocsComplete;
+
+static int RelocTargets(void **targets);
+#endif
+
 static int iss8(int32_t v) {
 	return (SCHAR_MIN <= v && v <= SCHAR_MAX);
 }
@@ -142,6 +170,25 @@ static void Emit4(int v) {
 static void EmitPtr(void *ptr) {
 	intptr_t v = (intptr_t)ptr;
 
+#if idx64
+	if (relocs) {
+		void *targets[MAX_RELOC_TARGETS];
+		int numTargets = RelocTargets(targets);
+		int i;
+
+		for (i = 0; i < numTargets && targets[i] != ptr; i++) {
+		}
+
+		// anything else can't be relocated, so the code isn't cached
+		if (i < numTargets && numRelocs < maxRelocs) {
+			relocs[numRelocs].ofs = compiledOfs;
+			relocs[numRelocs].target = i;
+			numRelocs++;
+		} else
+			relocsComplete = qfalse;
+	}
+#endif
+
 	Emit4(v);
 #if idx64
 	Emit1((v >> 32) & 0xFF);
@@ -395,16 +442,19 @@ static void DoSyscall(void) {
 		for (index = 1; index < ARRAY_LEN(args); index++)
 			args[index] = data[index];
 
-		*ret = savedVM->systemCall(args);
+		*ret = VM_SystemCall(savedVM, args);
 #else
 		data[0] = ~vm_syscallNum;
-		*ret = savedVM->systemCall((intptr_t *)data);
+		*ret = VM_SystemCall(savedVM, (intptr_t *)data);
 #endif
 	} else {
 		switch (vm_syscallNum) {
 		case VM_JMP_VIOLATION:
 			ErrJump();
 			break;
+		case VM_STACK_VIOLATION:
+			Com_Error(ERR_DROP, "program stack out of range in compiled code");
+			break;
 		case VM_BLOCK_COPY:
 			if (vm_opStackOfs < 1)
 				Com_Error(ERR_DROP, "VM_BLOCK_COPY failed due to corrupted opStack");
@@ -616,7 +666,240 @@ Call to constant instruction number or syscall
 =================
 */
 
+#if idx64
+static int callMathOfs;
+static int callMemOfs;
+
+static float VM_Sinf(float v) {
+	return sin(v);
+}
+
+static float VM_Cosf(float v) {
+	return cos(v);
+}
+
+static float VM_Floorf(float v) {
+	return floor(v);
+}
+
+static float VM_Ceilf(float v) {
+	return ceil(v);
+}
+
+// data points where DoSyscall would read the trap arguments, so data[1]
+// is the first one
+static int VM_InlineMemset(const int *data) {
+	intptr_t args[4] = {0, data[1], data[2], data[3]};
+	return VM_TrapMemset(args);
+}
+
+static int VM_InlineMemcpy(const int *data) {
+	intptr_t args[4] = {0, data[1], data[2], data[3]};
+	return VM_TrapMemcpy(args);
+}
+
+static int VM_InlineStrncpy(const int *data) {
+	intptr_t args[4] = {0, data[1], data[2], data[3]};
+	return VM_TrapStrncpy(args);
+}
+
+static int VM_InlineStrlen(const int *data) {
+	intptr_t args[2] = {0, data[1]};
+	return VM_TrapStrlen(args);
+}
+
+/*
+=================
+RelocTargets
+
+Fills in every host address EmitPtr may be given, in a fixed order
+=================
+*/
+
+static int RelocTargets(void **targets) {
+	int numTargets = 0;
+
+	targets[numTargets++] = (void *)DoSyscall;
+	targets[numTargets++] = &vm_syscallNum;
+	targets[numTargets++] = &vm_programStack;
+	targets[numTargets++] = &vm_opStackOfs;
+	targets[numTargets++] = &vm_opStackBase;
+	targets[numTargets++] = &vm_arg;
+	targets[numTargets++] = (void *)Q_VMftol;
+	targets[numTargets++] = (void *)VM_Sinf;
+	targets[numTargets++] = (void *)VM_Cosf;
+	targets[numTargets++] = (void *)VM_Floorf;
+	targets[numTargets++] = (void *)VM_Ceilf;
+	targets[numTargets++] = (void *)VM_InlineMemset;
+	targets[numTargets++] = (void *)VM_InlineMemcpy;
+	targets[numTargets++] = (void *)VM_InlineStrncpy;
+	targets[numTargets++] = (void *)VM_InlineStrlen;
+
+	return numTargets;
+}
+
+/*
+=================
+EmitCallMath
+Calls the float function in rdx with its argument and result in xmm0
+=================
+*/
+
+static int EmitCallMath(vm_t *vm) {
+	int retval = compiledOfs;
+
+	// the C function clobbers what the VM keeps in caller saved registers
+	EmitString("56");		   // push rsi
+	EmitString("57");		   // push rdi
+	EmitRexString(0x41, "50"); // push r8
+	EmitRexString(0x41, "51"); // push r9
+
+	// align the stack pointer to a 16-byte-boundary and leave
+	// shadow space for the Win64 calling convention
+	EmitString("55");				 // push rbp
+	EmitRexString(0x48, "89 E5");	 // mov rbp, rsp
+	EmitRexString(0x48, "83 E4 F0"); // and rsp, 0xFFFFFFF0
+	EmitRexString(0x48, "83 EC 20"); // sub rsp, 32
+
+	EmitString("FF D2"); // call rdx
+
+	EmitRexString(0x48, "89 EC"); // mov rsp, rbp
+	EmitString("5D");			  // pop rbp
+
+	EmitRexString(0x41, "59"); // pop r9
+	EmitRexString(0x41, "58"); // pop r8
+	EmitString("5F");		   // pop rdi
+	EmitString("5E");		   // pop rsi
+
+	EmitString("C3"); // ret
+
+	return retval;
+}
+
+/*
+=================
+EmitCallMem
+Calls the memory trap function in rdx with the argument pointer in rax
+and its result in eax
+=================
+*/
+
+static int EmitCallMem(vm_t *vm) {
+	int retval = compiledOfs;
+
+	EmitString("56");		   // push rsi
+	EmitString("57");		   // push rdi
+	EmitRexString(0x41, "50"); // push r8
+	EmitRexString(0x41, "51"); // push r9
+
+	EmitString("55");				 // push rbp
+	EmitRexString(0x48, "89 E5");	 // mov rbp, rsp
+	EmitRexString(0x48, "83 E4 F0"); // and rsp, 0xFFFFFFF0
+	EmitRexString(0x48, "83 EC 20"); // sub rsp, 32
+
+	// first argument register for both System V and Win64
+	EmitRexString(0x48, "89 C7"); // mov rdi, rax
+	EmitRexString(0x48, "89 C1"); // mov rcx, rax
+
+	EmitString("FF D2"); // call rdx
+
+	EmitRexString(0x48, "89 EC"); // mov rsp, rbp
+	EmitString("5D");			  // pop rbp
+
+	EmitRexString(0x41, "59"); // pop r9
+	EmitRexString(0x41, "58"); // pop r8
+	EmitString("5F");		   // pop rdi
+	EmitString("5E");		   // pop rsi
+
+	EmitString("C3"); // ret
+
+	return retval;
+}
+
+/*
+=================
+EmitInlineSyscall
+Evaluates a pure math trap without leaving the VM, or calls a memory
+trap directly instead of going through DoSyscall
+=================
+*/
+
+static qboolean EmitInlineSyscall(vm_t *vm, int callNum) {
+	float (*func)(float);
+	int (*memFunc)(const int *data);
+
+	switch (VM_SyscallInline(vm, callNum)) {
+	case VMINL_MEMSET:
+		memFunc = VM_InlineMemset;
+		break;
+	case VMINL_MEMCPY:
+		memFunc = VM_InlineMemcpy;
+		break;
+	case VMINL_STRNCPY:
+		memFunc = VM_InlineStrncpy;
+		break;
+	case VMINL_STRLEN:
+		memFunc = VM_InlineStrlen;
+		break;
+	default:
+		memFunc = NULL;
+		break;
+	}
+
+	if (memFunc) {
+		EmitRexString(0x49, "8D 44 31 04"); // lea rax, [r9 + rsi + 4]
+		EmitRexString(0x48, "BA");			// mov rdx, memFunc
+		EmitPtr(memFunc);
+		EmitCallRel(vm, callMemOfs);
+
+		STACK_PUSH(1);			// add bl, 1
+		EmitString("89 04 9F"); // mov dword ptr [rdi + rbx * 4], eax
+
+		return qtrue;
+	}
+
+	switch (VM_SyscallInline(vm, callNum)) {
+	case VMINL_SQRT:
+		func = NULL;
+		break;
+	case VMINL_SIN:
+		func = VM_Sinf;
+		break;
+	case VMINL_COS:
+		func = VM_Cosf;
+		break;
+	case VMINL_FLOOR:
+		func = VM_Floorf;
+		break;
+	case VMINL_CEIL:
+		func = VM_Ceilf;
+		break;
+	default:
+		return qfalse;
+	}
+
+	// the first argument sits where the syscall would read it
+	EmitString("F3 41 0F 10 44 31 08"); // movss xmm0, dword ptr [r9 + rsi + 8]
+
+	if (func) {
+		EmitRexString(0x48, "BA"); // mov rdx, func
+		EmitPtr(func);
+		EmitCallRel(vm, callMathOfs);
+	} else
+		EmitString("F3 0F 51 C0"); // sqrtss xmm0, xmm0
+
+	STACK_PUSH(1);				  // add bl, 1
+	EmitString("F3 0F 11 04 9F"); // movss dword ptr [rdi + rbx * 4], xmm0
+
+	return qtrue;
+}
+#endif
+
 void EmitCallConst(vm_t *vm, int cdest, int callProcOfsSyscall) {
+#if idx64
+	if (cdest < 0 && EmitInlineSyscall(vm, -1 - cdest))
+		return;
+#endif
 	if (cdest < 0) {
 		EmitString("B8"); // mov eax, cdest
 		Emit4(cdest);
@@ -990,106 +1273,1179 @@ qboolean ConstOptimize(vm_t *vm, int callProcOfsSyscall) {
 	return qfalse;
 }
 
+#if idx64
+/*
+====================================================================
+
+OPTIMIZING TIER
+
+Inside a basic block the opStack is tracked at compile time: constants
+and LOCAL addresses stay symbolic until an instruction needs them and
+intermediate results are kept in r10d - r15d, so long expression trees
+compile to register arithmetic instead of opStack memory traffic.
+
+The virtual stack is written back to the real opStack at every jump
+target, before conditional branches and before any instruction that is
+left to the plain compiler, so both tiers agree on the machine state at
+block boundaries.
+
+====================================================================
+*/
+
+#define VS_MAX_DEPTH 16
+#define VS_FIRST_REG 10 // r10d
+#define VS_LAST_REG 15	// r15d
+
+#define REG_EAX 0
+#define REG_ECX 1
+#define REG_EDX 2
+#define REG_ESI 6
+#define REG_R9 9
+
+typedef enum {
+	VS_CONST, // immediate value
+	VS_LOCAL, // programStack + value
+	VS_REG	  // value held in register
+} vsKind_t;
+
+typedef struct {
+	vsKind_t kind;
+	int value;
+} vsEntry_t;
+
+static vsEntry_t vstack[VS_MAX_DEPTH];
+static int vsDepth;
+static qboolean vmOptimize;
+static int callStackErrOfs;
+
+#define VS_TOP(n) vstack[vsDepth - 1 - (n)]
+
 /*
 =================
-VM_Compile
+EmitRex
+
+REX prefix for the given ModRM reg, SIB index and ModRM rm / SIB base registers
 =================
 */
-void VM_Compile(vm_t *vm, vmHeader_t *header) {
-	int op;
-	int maxLength;
-	int v;
-	int i;
-	int callProcOfsSyscall, callProcOfs, callDoSyscallOfs;
+static void EmitRex(int reg, int index, int base) {
+	int rex = 0x40 | ((reg & 8) >> 1) | ((index & 8) >> 2) | ((base & 8) >> 3);
 
-	jusedSize = header->instructionCount + 2;
+	if (rex != 0x40)
+		Emit1(rex);
+}
 
-	// allocate a very large temp buffer, we will shrink it later
-	maxLength = header->codeLength * 8 + 64;
-	buf = Z_Malloc(maxLength);
-	jused = Z_Malloc(jusedSize);
-	code = Z_Malloc(header->codeLength + 32);
+/*
+=================
+EmitOp
 
-	Com_Memset(jused, 0, jusedSize);
-	Com_Memset(buf, 0, maxLength);
+op reg, rm with both operands in registers
+=================
+*/
+static void EmitOp(int prefix, int opcode, int reg, int rm) {
+	if (prefix)
+		Emit1(prefix);
+	EmitRex(reg, 0, rm);
+	if (opcode > 0xFF)
+		Emit1(opcode >> 8);
+	Emit1(opcode & 0xFF);
+	Emit1(0xC0 | ((reg & 7) << 3) | (rm & 7));
+}
 
-	// copy code in larger buffer and put some zeros at the end
-	// so we can safely look ahead for a few instructions in it
-	// without a chance to get false-positive because of some garbage bytes
-	Com_Memset(code, 0, header->codeLength + 32);
-	Com_Memcpy(code, (byte *)header + header->codeOffset, header->codeLength);
+/*
+=================
+EmitOpData
 
-	// ensure that the optimisation pass knows about all the jump
-	// table targets
-	pc = -1; // a bogus value to be printed in out-of-bounds error messages
-	for (i = 0; i < vm->numJumpTableTargets; i++) {
-		JUSED(*(int *)(vm->jumpTableTargets + (i * sizeof(int))));
+op reg, [r9 + index] or op reg, [r9 + disp] when index is -1
+=================
+*/
+static void EmitOpData(int prefix, int opcode, int reg, int index, int disp) {
+	if (prefix)
+		Emit1(prefix);
+	EmitRex(reg, index < 0 ? 0 : index, REG_R9);
+	if (opcode > 0xFF)
+		Emit1(opcode >> 8);
+	Emit1(opcode & 0xFF);
+	if (index < 0) {
+		Emit1(0x80 | ((reg & 7) << 3) | (REG_R9 & 7));
+		Emit4(disp);
+	} else {
+		Emit1(0x04 | ((reg & 7) << 3));
+		Emit1(((index & 7) << 3) | (REG_R9 & 7));
 	}
+}
 
-	// Start buffer with x86-VM specific procedures
-	compiledOfs = 0;
+/*
+=================
+EmitOpImm
 
-	callDoSyscallOfs = compiledOfs;
-	callProcOfs = EmitCallDoSyscall(vm);
-	callProcOfsSyscall = EmitCallProcedure(vm, callDoSyscallOfs);
-	vm->entryOfs = compiledOfs;
+group 1 ALU op (add, or, and, sub, xor, cmp) of a register with an immediate
+=================
+*/
+static void EmitOpImm(int ext, int rm, int v) {
+	EmitRex(0, 0, rm);
+	if (iss8(v)) {
+		Emit1(0x83);
+		Emit1(0xC0 | (ext << 3) | (rm & 7));
+		Emit1(v);
+	} else {
+		Emit1(0x81);
+		Emit1(0xC0 | (ext << 3) | (rm & 7));
+		Emit4(v);
+	}
+}
 
-	for (pass = 0; pass < 3; pass++) {
-		oc0 = -23423;
-		oc1 = -234354;
-		pop0 = -43435;
-		pop1 = -545455;
+static void EmitMovRegImm(int reg, int v) {
+	if (v == 0) {
+		EmitOp(0, 0x31, reg, reg); // xor reg, reg
+		return;
+	}
+	EmitRex(0, 0, reg);
+	Emit1(0xB8 | (reg & 7)); // mov reg, 0x12345678
+	Emit4(v);
+}
 
-		// translate all instructions
-		pc = 0;
-		instruction = 0;
-		// code = (byte *)header + header->codeOffset;
-		compiledOfs = vm->entryOfs;
+static void EmitLeaLocal(int reg, int v) {
+	EmitRex(reg, 0, REG_ESI);
+	Emit1(0x8D); // lea reg, [esi + 0x12345678]
+	Emit1(0x80 | ((reg & 7) << 3) | REG_ESI);
+	Emit4(v);
+}
 
-		LastCommand = LAST_COMMAND_NONE;
+/*
+=================
+VS_FlushBottom
 
-		while (instruction < header->instructionCount) {
-			if (compiledOfs > maxLength - 16) {
-				VMFREE_BUFFERS();
-				Com_Error(ERR_DROP, "VM_CompileX86: maxLength exceeded");
-			}
+Writes the n deepest virtual entries to the real opStack
+=================
+*/
+static void VS_FlushBottom(int n) {
+	vsEntry_t *e;
+	int i;
 
-			vm->instructionPointers[instruction] = compiledOfs;
+	for (i = 0; i < n; i++) {
+		e = &vstack[i];
 
-			if (!vm->jumpTableTargets)
-				jlabel = 1;
-			else
-				jlabel = jused[instruction];
+		STACK_PUSH(1); // add bl, 1
+		switch (e->kind) {
+		case VS_CONST:
+			EmitString("C7 04 9F"); // mov dword ptr [edi + ebx * 4], 0x12345678
+			Emit4(e->value);
+			break;
+		case VS_LOCAL:
+			EmitLeaLocal(REG_EAX, e->value);
+			EmitString("89 04 9F"); // mov dword ptr [edi + ebx * 4], eax
+			break;
+		case VS_REG:
+			EmitRex(e->value, 0, 0);
+			Emit1(0x89); // mov dword ptr [edi + ebx * 4], reg
+			Emit1(0x04 | ((e->value & 7) << 3));
+			Emit1(0x9F);
+			break;
+		}
+	}
 
-			instruction++;
+	vsDepth -= n;
+	memmove(vstack, vstack + n, vsDepth * sizeof(vstack[0]));
+}
 
-			if (pc > header->codeLength) {
-				VMFREE_BUFFERS();
-				Com_Error(ERR_DROP, "VM_CompileX86: pc > header->codeLength");
-			}
+static void VS_FlushAll(void) {
+	VS_FlushBottom(vsDepth);
+}
 
-			op = code[pc];
-			pc++;
-			switch (op) {
-			case 0:
-				break;
-			case OP_BREAK:
-				EmitString("CC"); // int 3
-				break;
-			case OP_ENTER:
-				EmitString("81 EE"); // sub esi, 0x12345678
-				Emit4(Constant4());
-				break;
-			case OP_CONST:
-				if (ConstOptimize(vm, callProcOfsSyscall))
-					break;
+static void VS_Push(vsKind_t kind, int value) {
+	if (vsDepth == VS_MAX_DEPTH)
+		VS_FlushBottom(1);
 
-				EmitPushStack(vm);
-				EmitString("C7 04 9F"); // mov dword ptr [edi + ebx * 4], 0x12345678
-				lastConst = Constant4();
+	vstack[vsDepth].kind = kind;
+	vstack[vsDepth].value = value;
+	vsDepth++;
+}
 
-				Emit4(lastConst);
-				if (code[pc] == OP_JUMP)
+/*
+=================
+VS_AllocReg
+
+Returns a cache register that no virtual entry refers to. When all of them
+are taken the deepest register entries are spilled, which never touches the
+two or three top entries an instruction is working on.
+=================
+*/
+static int VS_AllocReg(void) {
+	int used, reg, i;
+
+	for (;;) {
+		used = 0;
+		for (i = 0; i < vsDepth; i++) {
+			if (vstack[i].kind == VS_REG)
+				used |= 1 << vstack[i].value;
+		}
+
+		for (reg = VS_FIRST_REG; reg <= VS_LAST_REG; reg++) {
+			if (!(used & (1 << reg)))
+				return reg;
+		}
+
+		for (i = 0; vstack[i].kind != VS_REG; i++)
+			;
+		VS_FlushBottom(i + 1);
+	}
+}
+
+/*
+=================
+VS_Need
+
+Pulls entries from the real opStack until n operands are virtual
+=================
+*/
+static void VS_Need(int n) {
+	int reg;
+
+	while (vsDepth < n) {
+		reg = VS_AllocReg();
+
+		EmitRex(reg, 0, 0);
+		Emit1(0x8B); // mov reg, dword ptr [edi + ebx * 4]
+		Emit1(0x04 | ((reg & 7) << 3));
+		Emit1(0x9F);
+		STACK_POP(1); // sub bl, 1
+
+		memmove(vstack + 1, vstack, vsDepth * sizeof(vstack[0]));
+		vstack[0].kind = VS_REG;
+		vstack[0].value = reg;
+		vsDepth++;
+	}
+}
+
+/*
+=================
+VS_Reg
+
+Makes sure the n-th entry from the top lives in a register
+=================
+*/
+static int VS_Reg(int n) {
+	vsEntry_t *e;
+	int reg;
+
+	if (VS_TOP(n).kind == VS_REG)
+		return VS_TOP(n).value;
+
+	reg = VS_AllocReg();
+	e = &VS_TOP(n);
+	if (e->kind == VS_CONST)
+		EmitMovRegImm(reg, e->value);
+	else
+		EmitLeaLocal(reg, e->value);
+
+	e->kind = VS_REG;
+	e->value = reg;
+	return reg;
+}
+
+/*
+=================
+VS_Address
+
+Masks the address in the n-th entry from the top. Returns the index register
+to use with r9, or -1 if the address is a constant returned in disp.
+Must be called after all registers for the instruction have been allocated.
+
+Program stack addresses at offsets the guard after the data covers are left
+unmasked, see VS_EmitStackCheck.
+=================
+*/
+static int VS_Address(vm_t *vm, int n, int *disp) {
+	vsEntry_t *e = &VS_TOP(n);
+
+	switch (e->kind) {
+	case VS_CONST:
+		*disp = e->value & vm->dataMask;
+		return -1;
+	case VS_LOCAL:
+		EmitLeaLocal(REG_EAX, e->value);
+		if (e->value < 0 || e->value > VM_DATA_GUARD - 4)
+			MASK_REG("E0", vm->dataMask); // and eax, 0x12345678
+		return REG_EAX;
+	default:
+		EmitOpImm(4, e->value, vm->dataMask); // and reg, 0x12345678
+		return e->value;
+	}
+}
+
+static void VS_MovdToXmm(int xmm, int reg) {
+	EmitOp(0x66, 0x0F6E, xmm, reg); // movd xmm, reg
+}
+
+static void VS_MovdFromXmm(int reg, int xmm) {
+	EmitOp(0x66, 0x0F7E, xmm, reg); // movd reg, xmm
+}
+
+/*
+=================
+VS_EmitStackCheck
+
+Keeps esi within 0 to dataMask + 1 after OP_ENTER and OP_LEAVE, the only
+instructions that change it. VM_CallCompiled starts in that range, so a
+program stack access at an offset from 0 to VM_DATA_GUARD - 4 can never
+leave the data and the guard after it, wherever the code was called or
+jumped into, and needs no mask.
+=================
+*/
+static void VS_EmitStackCheck(vm_t *vm) {
+	EmitString("81 FE"); // cmp esi, 0x12345678
+	Emit4(vm->dataMask + 1);
+	EmitString("0F 87"); // ja callStackErr
+	Emit4(callStackErrOfs - compiledOfs - 4);
+}
+
+/*
+=================
+VS_EmitStackErr
+
+The target of the VS_EmitStackCheck jumps
+=================
+*/
+static int VS_EmitStackErr(vm_t *vm, int sysCallOfs) {
+	int retval = compiledOfs;
+
+	EmitString("B8"); // mov eax, 0x12345678
+	Emit4(VM_STACK_VIOLATION);
+	EmitCallRel(vm, sysCallOfs);
+
+	return retval;
+}
+
+/*
+=================
+VS_BranchOp
+
+Conditional jump opcode for a compare, optionally with swapped operands
+=================
+*/
+static const char *VS_BranchOp(int op, qboolean swapped) {
+	switch (op) {
+	case OP_EQ:
+	case OP_EQF:
+		return "0F 84"; // je
+	case OP_NE:
+	case OP_NEF:
+		return "0F 85"; // jne
+	case OP_LTI:
+		return swapped ? "0F 8F" : "0F 8C"; // jg / jl
+	case OP_LEI:
+		return swapped ? "0F 8D" : "0F 8E"; // jge / jle
+	case OP_GTI:
+		return swapped ? "0F 8C" : "0F 8F"; // jl / jg
+	case OP_GEI:
+		return swapped ? "0F 8E" : "0F 8D"; // jle / jge
+	case OP_LTU:
+	case OP_LTF:
+		return swapped ? "0F 87" : "0F 82"; // ja / jb
+	case OP_LEU:
+	case OP_LEF:
+		return swapped ? "0F 83" : "0F 86"; // jae / jbe
+	case OP_GTU:
+	case OP_GTF:
+		return swapped ? "0F 82" : "0F 87"; // jb / ja
+	default: // OP_GEU, OP_GEF
+		return swapped ? "0F 86" : "0F 83"; // jbe / jae
+	}
+}
+
+/*
+=================
+VS_FoldBinary
+
+Evaluates an integer op on two constants at compile time
+=================
+*/
+static qboolean VS_FoldBinary(int op, int a, int b, int *result) {
+	unsigned int ua = a, ub = b;
+
+	switch (op) {
+	case OP_ADD:
+		*result = ua + ub;
+		return qtrue;
+	case OP_SUB:
+		*result = ua - ub;
+		return qtrue;
+	case OP_MULI:
+	case OP_MULU:
+		*result = ua * ub;
+		return qtrue;
+	case OP_BAND:
+		*result = a & b;
+		return qtrue;
+	case OP_BOR:
+		*result = a | b;
+		return qtrue;
+	case OP_BXOR:
+		*result = a ^ b;
+		return qtrue;
+	case OP_LSH:
+		*result = ua << (b & 31);
+		return qtrue;
+	case OP_RSHI:
+		*result = a >> (b & 31);
+		return qtrue;
+	case OP_RSHU:
+		*result = ua >> (b & 31);
+		return qtrue;
+	case OP_DIVI:
+	case OP_MODI:
+		if (b == 0 || (a == INT_MIN && b == -1))
+			return qfalse;
+		*result = op == OP_DIVI ? a / b : a % b;
+		return qtrue;
+	case OP_DIVU:
+	case OP_MODU:
+		if (b == 0)
+			return qfalse;
+		*result = op == OP_DIVU ? ua / ub : ua % ub;
+		return qtrue;
+	default:
+		return qfalse;
+	}
+}
+
+/*
+=================
+VS_CompileOp
+
+Compiles one instruction against the virtual stack. Returns qfalse after
+writing the virtual stack back if the instruction has to be compiled by
+the plain code generator.
+=================
+*/
+static qboolean VS_CompileOp(vm_t *vm, int op, int callProcOfsSyscall) {
+	vsEntry_t *a, *b;
+	int ra, rb, index, disp, v;
+	qboolean swapped;
+
+	switch (op) {
+	case OP_CONST:
+		v = Constant4();
+
+		if (code[pc] == OP_JUMP) {
+			JUSED(v);
+			if (!jused[instruction]) {
+				VS_FlushAll();
+				EmitJumpIns(vm, "E9", v); // jmp 0x12345678
+				pc++;					  // OP_JUMP
+				instruction++;
+				return qtrue;
+			}
+		} else if (code[pc] == OP_CALL && !jused[instruction]) {
+			VS_FlushAll();
+			EmitCallConst(vm, v, callProcOfsSyscall);
+			pc++; // OP_CALL
+			instruction++;
+			return qtrue;
+		}
+
+		VS_Push(VS_CONST, v);
+		return qtrue;
+
+	case OP_LOCAL:
+		VS_Push(VS_LOCAL, Constant4());
+		return qtrue;
+
+	case OP_PUSH:
+		VS_Push(VS_CONST, 0);
+		return qtrue;
+
+	case OP_POP:
+		if (vsDepth)
+			vsDepth--;
+		else
+			STACK_POP(1); // sub bl, 1
+		return qtrue;
+
+	case OP_LOAD4:
+	case OP_LOAD2:
+	case OP_LOAD1:
+		VS_Need(1);
+		ra = VS_TOP(0).kind == VS_REG ? VS_TOP(0).value : VS_AllocReg();
+		index = VS_Address(vm, 0, &disp);
+
+		if (op == OP_LOAD4)
+			EmitOpData(0, 0x8B, ra, index, disp); // mov reg, dword ptr [r9 + index]
+		else if (op == OP_LOAD2)
+			EmitOpData(0, 0x0FB7, ra, index, disp); // movzx reg, word ptr [r9 + index]
+		else
+			EmitOpData(0, 0x0FB6, ra, index, disp); // movzx reg, byte ptr [r9 + index]
+
+		VS_TOP(0).kind = VS_REG;
+		VS_TOP(0).value = ra;
+		return qtrue;
+
+	case OP_STORE4:
+	case OP_STORE2:
+	case OP_STORE1:
+		VS_Need(2);
+		if (VS_TOP(0).kind == VS_LOCAL)
+			VS_Reg(0);
+		index = VS_Address(vm, 1, &disp);
+
+		b = &VS_TOP(0);
+		if (b->kind == VS_CONST) {
+			if (op == OP_STORE4) {
+				EmitOpData(0, 0xC7, 0, index, disp); // mov dword ptr [r9 + index], 0x12345678
+				Emit4(b->value);
+			} else if (op == OP_STORE2) {
+				EmitOpData(0x66, 0xC7, 0, index, disp); // mov word ptr [r9 + index], 0x1234
+				Emit2(b->value);
+			} else {
+				EmitOpData(0, 0xC6, 0, index, disp); // mov byte ptr [r9 + index], 0x12
+				Emit1(b->value);
+			}
+		} else {
+			if (op == OP_STORE4)
+				EmitOpData(0, 0x89, b->value, index, disp); // mov dword ptr [r9 + index], reg
+			else if (op == OP_STORE2)
+				EmitOpData(0x66, 0x89, b->value, index, disp); // mov word ptr [r9 + index], reg
+			else
+				EmitOpData(0, 0x88, b->value, index, disp); // mov byte ptr [r9 + index], reg
+		}
+
+		vsDepth -= 2;
+		return qtrue;
+
+	case OP_ARG:
+		VS_Need(1);
+		if (VS_TOP(0).kind == VS_LOCAL)
+			VS_Reg(0);
+
+		// within the data guard, see VS_EmitStackCheck
+		EmitLeaLocal(REG_EAX, Constant1() & 0xFF);
+
+		b = &VS_TOP(0);
+		if (b->kind == VS_CONST) {
+			EmitOpData(0, 0xC7, 0, REG_EAX, 0); // mov dword ptr [r9 + eax], 0x12345678
+			Emit4(b->value);
+		} else {
+			EmitOpData(0, 0x89, b->value, REG_EAX, 0); // mov dword ptr [r9 + eax], reg
+		}
+
+		vsDepth--;
+		return qtrue;
+
+	case OP_ADD:
+	case OP_SUB:
+	case OP_MULI:
+	case OP_MULU:
+	case OP_BAND:
+	case OP_BOR:
+	case OP_BXOR:
+	case OP_LSH:
+	case OP_RSHI:
+	case OP_RSHU:
+		VS_Need(2);
+		a = &VS_TOP(1);
+		b = &VS_TOP(0);
+
+		if (a->kind == VS_CONST && b->kind == VS_CONST && VS_FoldBinary(op, a->value, b->value, &v)) {
+			a->value = v;
+			vsDepth--;
+			return qtrue;
+		}
+
+		// address arithmetic on locals stays symbolic
+		if (a->kind == VS_LOCAL && b->kind == VS_CONST && (op == OP_ADD || op == OP_SUB)) {
+			a->value = op == OP_ADD ? (int)((unsigned int)a->value + b->value)
+									: (int)((unsigned int)a->value - b->value);
+			vsDepth--;
+			return qtrue;
+		}
+
+		// keep constants on the right hand side of commutative ops
+		if (a->kind == VS_CONST && b->kind != VS_CONST && op != OP_SUB && op != OP_LSH && op != OP_RSHI &&
+			op != OP_RSHU) {
+			vsEntry_t tmp = *a;
+			*a = *b;
+			*b = tmp;
+
+			if (op == OP_ADD && a->kind == VS_LOCAL) {
+				a->value = (int)((unsigned int)a->value + b->value);
+				vsDepth--;
+				return qtrue;
+			}
+		}
+
+		ra = VS_Reg(1);
+		b = &VS_TOP(0);
+
+		if (b->kind == VS_CONST) {
+			v = b->value;
+			switch (op) {
+			case OP_ADD:
+				EmitOpImm(0, ra, v); // add reg, 0x12345678
+				break;
+			case OP_SUB:
+				EmitOpImm(5, ra, v); // sub reg, 0x12345678
+				break;
+			case OP_BAND:
+				EmitOpImm(4, ra, v); // and reg, 0x12345678
+				break;
+			case OP_BOR:
+				EmitOpImm(1, ra, v); // or reg, 0x12345678
+				break;
+			case OP_BXOR:
+				EmitOpImm(6, ra, v); // xor reg, 0x12345678
+				break;
+			case OP_MULI:
+			case OP_MULU:
+				EmitOp(0, 0x69, ra, ra); // imul reg, reg, 0x12345678
+				Emit4(v);
+				break;
+			default:
+				EmitRex(0, 0, ra);
+				Emit1(0xC1); // shl / sar / shr reg, 0x12
+				Emit1(0xC0 | ((op == OP_LSH ? 4 : op == OP_RSHI ? 7 : 5) << 3) | (ra & 7));
+				Emit1(v & 31);
+				break;
+			}
+		} else {
+			rb = VS_Reg(0);
+			switch (op) {
+			case OP_ADD:
+				EmitOp(0, 0x01, rb, ra); // add ra, rb
+				break;
+			case OP_SUB:
+				EmitOp(0, 0x29, rb, ra); // sub ra, rb
+				break;
+			case OP_BAND:
+				EmitOp(0, 0x21, rb, ra); // and ra, rb
+				break;
+			case OP_BOR:
+				EmitOp(0, 0x09, rb, ra); // or ra, rb
+				break;
+			case OP_BXOR:
+				EmitOp(0, 0x31, rb, ra); // xor ra, rb
+				break;
+			case OP_MULI:
+			case OP_MULU:
+				EmitOp(0, 0x0FAF, ra, rb); // imul ra, rb
+				break;
+			default:
+				EmitOp(0, 0x8B, REG_ECX, rb); // mov ecx, rb
+				EmitOp(0, 0xD3, op == OP_LSH ? 4 : op == OP_RSHI ? 7 : 5, ra); // shl / sar / shr ra, cl
+				break;
+			}
+		}
+
+		vsDepth--;
+		return qtrue;
+
+	case OP_DIVI:
+	case OP_DIVU:
+	case OP_MODI:
+	case OP_MODU:
+		VS_Need(2);
+		a = &VS_TOP(1);
+		b = &VS_TOP(0);
+
+		if (a->kind == VS_CONST && b->kind == VS_CONST && VS_FoldBinary(op, a->value, b->value, &v)) {
+			a->value = v;
+			vsDepth--;
+			return qtrue;
+		}
+
+		rb = VS_Reg(0);
+		ra = VS_Reg(1);
+		EmitOp(0, 0x8B, REG_EAX, ra); // mov eax, ra
+		if (op == OP_DIVI || op == OP_MODI) {
+			EmitString("99");			 // cdq
+			EmitOp(0, 0xF7, 7, rb); // idiv rb
+		} else {
+			EmitString("31 D2");		 // xor edx, edx
+			EmitOp(0, 0xF7, 6, rb); // div rb
+		}
+		EmitOp(0, 0x8B, ra, (op == OP_DIVI || op == OP_DIVU) ? REG_EAX : REG_EDX); // mov ra, eax / edx
+
+		vsDepth--;
+		return qtrue;
+
+	case OP_NEGI:
+	case OP_BCOM:
+	case OP_SEX8:
+	case OP_SEX16:
+	case OP_NEGF:
+		VS_Need(1);
+		a = &VS_TOP(0);
+
+		if (a->kind == VS_CONST) {
+			switch (op) {
+			case OP_NEGI:
+				a->value = -(unsigned int)a->value;
+				break;
+			case OP_BCOM:
+				a->value = ~a->value;
+				break;
+			case OP_SEX8:
+				a->value = (signed char)a->value;
+				break;
+			case OP_SEX16:
+				a->value = (short)a->value;
+				break;
+			default:
+				a->value ^= 0x80000000;
+				break;
+			}
+			return qtrue;
+		}
+
+		ra = VS_Reg(0);
+		switch (op) {
+		case OP_NEGI:
+			EmitOp(0, 0xF7, 3, ra); // neg reg
+			break;
+		case OP_BCOM:
+			EmitOp(0, 0xF7, 2, ra); // not reg
+			break;
+		case OP_SEX8:
+			EmitOp(0, 0x0FBE, ra, ra); // movsx reg, reg8
+			break;
+		case OP_SEX16:
+			EmitOp(0, 0x0FBF, ra, ra); // movsx reg, reg16
+			break;
+		default:
+			EmitRex(0, 0, ra);
+			Emit1(0x81); // xor reg, 0x80000000
+			Emit1(0xF0 | (ra & 7));
+			Emit4(0x80000000);
+			break;
+		}
+		return qtrue;
+
+	case OP_ADDF:
+	case OP_SUBF:
+	case OP_MULF:
+	case OP_DIVF:
+		VS_Need(2);
+		ra = VS_Reg(1);
+		rb = VS_Reg(0);
+
+		VS_MovdToXmm(0, ra);
+		VS_MovdToXmm(1, rb);
+		switch (op) {
+		case OP_ADDF:
+			EmitString("F3 0F 58 C1"); // addss xmm0, xmm1
+			break;
+		case OP_SUBF:
+			EmitString("F3 0F 5C C1"); // subss xmm0, xmm1
+			break;
+		case OP_MULF:
+			EmitString("F3 0F 59 C1"); // mulss xmm0, xmm1
+			break;
+		default:
+			EmitString("F3 0F 5E C1"); // divss xmm0, xmm1
+			break;
+		}
+		VS_MovdFromXmm(ra, 0);
+
+		vsDepth--;
+		return qtrue;
+
+	case OP_CVIF:
+		VS_Need(1);
+		ra = VS_Reg(0);
+		EmitOp(0xF3, 0x0F2A, 0, ra); // cvtsi2ss xmm0, reg
+		VS_MovdFromXmm(ra, 0);
+		return qtrue;
+
+	case OP_CVFI:
+		VS_Need(1);
+		ra = VS_Reg(0);
+		VS_MovdToXmm(0, ra);
+		EmitOp(0xF3, 0x0F2C, ra, 0); // cvttss2si reg, xmm0
+		return qtrue;
+
+	case OP_EQ:
+	case OP_NE:
+	case OP_LTI:
+	case OP_LEI:
+	case OP_GTI:
+	case OP_GEI:
+	case OP_LTU:
+	case OP_LEU:
+	case OP_GTU:
+	case OP_GEU:
+		VS_Need(2);
+		v = Constant4();
+
+		swapped = VS_TOP(1).kind == VS_CONST && VS_TOP(0).kind != VS_CONST;
+		if (swapped) {
+			vsEntry_t tmp = VS_TOP(1);
+			VS_TOP(1) = VS_TOP(0);
+			VS_TOP(0) = tmp;
+		}
+
+		ra = VS_Reg(1);
+		if (VS_TOP(0).kind == VS_LOCAL)
+			VS_Reg(0);
+		b = &VS_TOP(0);
+		rb = b->kind == VS_REG ? b->value : -1;
+		disp = b->value;
+
+		// the compared values are out of the virtual stack now, so writing
+		// back the rest cannot clobber them and the flags stay intact
+		vsDepth -= 2;
+		VS_FlushAll();
+
+		if (rb < 0)
+			EmitOpImm(7, ra, disp); // cmp ra, 0x12345678
+		else
+			EmitOp(0, 0x39, rb, ra); // cmp ra, rb
+		EmitJumpIns(vm, VS_BranchOp(op, swapped), v);
+		return qtrue;
+
+	case OP_EQF:
+	case OP_NEF:
+	case OP_LTF:
+	case OP_LEF:
+	case OP_GTF:
+	case OP_GEF:
+		VS_Need(2);
+		v = Constant4();
+
+		ra = VS_Reg(1);
+		rb = VS_Reg(0);
+		vsDepth -= 2;
+		VS_FlushAll();
+
+		// ucomiss sets the flags like an unsigned compare, with unordered
+		// results matching the x87 sequence of the plain compiler
+		VS_MovdToXmm(0, ra);
+		VS_MovdToXmm(1, rb);
+		EmitString("0F 2E C1"); // ucomiss xmm0, xmm1
+		EmitJumpIns(vm, VS_BranchOp(op, qfalse), v);
+		return qtrue;
+
+	default:
+		VS_FlushAll();
+		return qfalse;
+	}
+}
+#endif
+
+/*
+=================
+VM_CopyCode
+
+Copies the code to an exact sized buffer with the appropriate permission bits
+=================
+*/
+static void VM_CopyCode(vm_t *vm, const byte *src, int length) {
+	vm->codeLength = length;
+#ifdef VM_X86_MMAP
+	vm->codeBase = mmap(NULL, length, PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (vm->codeBase == MAP_FAILED)
+		Com_Error(ERR_FATAL, "VM_CompileX86: can't mmap memory");
+#elif _WIN32
+	// allocate memory with EXECUTE permissions under windows.
+	vm->codeBase = VirtualAlloc(NULL, length, MEM_COMMIT, PAGE_EXECUTE_READWRITE);
+	if (!vm->codeBase)
+		Com_Error(ERR_FATAL, "VM_CompileX86: VirtualAlloc failed");
+#else
+	vm->codeBase = malloc(length);
+	if (!vm->codeBase)
+		Com_Error(ERR_FATAL, "VM_CompileX86: malloc failed");
+#endif
+
+	Com_Memcpy(vm->codeBase, src, length);
+	Com_MemAccount(VM_MemOwner(vm->name), length);
+
+#ifdef VM_X86_MMAP
+	if (mprotect(vm->codeBase, length, PROT_READ | PROT_EXEC))
+		Com_Error(ERR_FATAL, "VM_CompileX86: mprotect failed");
+#elif _WIN32
+	{
+		DWORD oldProtect = 0;
+
+		// remove write permissions.
+		if (!VirtualProtect(vm->codeBase, length, PAGE_EXECUTE_READ, &oldProtect))
+			Com_Error(ERR_FATAL, "VM_CompileX86: VirtualProtect failed");
+	}
+#endif
+}
+
+#if idx64
+/*
+=================
+VM_LoadCompiled / VM_SaveCompiled
+
+The code cache holds the code with the instruction offsets and the
+location of every host address, which differ between runs
+=================
+*/
+
+#define VM_CACHE_BUILD "x86_64 " Q3_VERSION " " __DATE__ " " __TIME__
+
+typedef struct {
+	int optimize;
+	int instructionCount;
+	int dataMask;
+	int entryOfs;
+	int codeLength;
+	int numRelocs;
+	// followed by the instruction offsets, relocations and code
+} vmCompiledCache_t;
+
+static qboolean VM_LoadCompiled(vm_t *vm, vmHeader_t *header) {
+	void *targets[MAX_RELOC_TARGETS];
+	vmCompiledCache_t *cache;
+	vmReloc_t *cacheRelocs;
+	int *cachePointers;
+	byte *cacheCode;
+	int numTargets;
+	int length;
+	intptr_t v;
+	int i;
+
+	cache = VM_LoadCodeCache(vm, VM_CACHE_BUILD, &length);
+	if (!cache)
+		return qfalse;
+
+	if (length < sizeof(*cache) || cache->optimize != vmOptimize ||
+		cache->instructionCount != header->instructionCount || cache->dataMask != vm->dataMask ||
+		cache->numRelocs < 0 || cache->numRelocs > length || cache->codeLength <= 0 || cache->entryOfs < 0 ||
+		cache->entryOfs >= cache->codeLength ||
+		length != sizeof(*cache) + cache->instructionCount * sizeof(*cachePointers) +
+					  cache->numRelocs * sizeof(*cacheRelocs) + cache->codeLength) {
+		Z_Free(cache);
+		return qfalse;
+	}
+
+	cachePointers = (int *)(cache + 1);
+	cacheRelocs = (vmReloc_t *)(cachePointers + cache->instructionCount);
+	cacheCode = (byte *)(cacheRelocs + cache->numRelocs);
+
+	for (i = 0; i < cache->instructionCount; i++) {
+		// instructions folded into their predecessor are left at 0
+		if (cachePointers[i] < 0 || cachePointers[i] >= cache->codeLength) {
+			Z_Free(cache);
+			return qfalse;
+		}
+	}
+
+	numTargets = RelocTargets(targets);
+	for (i = 0; i < cache->numRelocs; i++) {
+		if (cacheRelocs[i].target < 0 || cacheRelocs[i].target >= numTargets || cacheRelocs[i].ofs < 0 ||
+			cacheRelocs[i].ofs > cache->codeLength - sizeof(v)) {
+			Z_Free(cache);
+			return qfalse;
+		}
+
+		v = (intptr_t)targets[cacheRelocs[i].target];
+		Com_Memcpy(cacheCode + cacheRelocs[i].ofs, &v, sizeof(v));
+	}
+
+	VM_CopyCode(vm, cacheCode, cache->codeLength);
+	vm->entryOfs = cache->entryOfs;
+	vm->destroy = VM_Destroy_Compiled;
+
+	for (i = 0; i < cache->instructionCount; i++) {
+		vm->instructionPointers[i] = (intptr_t)vm->codeBase + cachePointers[i];
+	}
+
+	Com_Printf("VM file %s loaded %i bytes of cached code\n", vm->name, cache->codeLength);
+	Z_Free(cache);
+
+	return qtrue;
+}
+
+static void VM_SaveCompiled(vm_t *vm) {
+	vmCompiledCache_t *cache;
+	vmReloc_t *cacheRelocs;
+	int *cachePointers;
+	int length;
+	int i;
+
+	length = sizeof(*cache) + vm->instructionCount * sizeof(*cachePointers) + numRelocs * sizeof(*cacheRelocs) +
+			 vm->codeLength;
+	cache = Z_Malloc(length);
+
+	cache->optimize = vmOptimize;
+	cache->instructionCount = vm->instructionCount;
+	cache->dataMask = vm->dataMask;
+	cache->entryOfs = vm->entryOfs;
+	cache->codeLength = vm->codeLength;
+	cache->numRelocs = numRelocs;
+
+	// the instruction pointers are still offsets at this point
+	cachePointers = (int *)(cache + 1);
+	for (i = 0; i < vm->instructionCount; i++) {
+		cachePointers[i] = vm->instructionPointers[i];
+	}
+
+	cacheRelocs = (vmReloc_t *)(cachePointers + vm->instructionCount);
+	Com_Memcpy(cacheRelocs, relocs, numRelocs * sizeof(*cacheRelocs));
+	Com_Memcpy(cacheRelocs + numRelocs, vm->codeBase, vm->codeLength);
+
+	VM_SaveCodeCache(vm, VM_CACHE_BUILD, cache, length);
+	Z_Free(cache);
+}
+#endif
+
+/*
+=================
+VM_Compile
+=================
+*/
+void VM_Compile(vm_t *vm, vmHeader_t *header) {
+	int op;
+	int maxLength;
+	int v;
+	int i;
+	int callProcOfsSyscall, callProcOfs, callDoSyscallOfs;
+	int slack = 16;
+
+	jusedSize = header->instructionCount + 2;
+
+#if idx64
+	// the optimizing tier depends on knowing every jump target
+	vmOptimize = Cvar_VariableIntegerValue("vm_optimize") && vm->jumpTableTargets;
+
+	if (VM_LoadCompiled(vm, header))
+		return;
+#endif
+
+	// allocate a very large temp buffer, we will shrink it later
+	maxLength = header->codeLength * 8 + 64;
+#if idx64
+	if (vmOptimize) {
+		// a single instruction may write back the whole virtual stack
+		slack = 256;
+		maxLength += header->codeLength * 4 + slack;
+	}
+#endif
+	buf = Z_Malloc(maxLength);
+	jused = Z_Malloc(jusedSize);
+	code = Z_Malloc(header->codeLength + 32);
+
+	Com_Memset(jused, 0, jusedSize);
+	Com_Memset(buf, 0, maxLength);
+
+#if idx64
+	// host addresses are mostly ftol and math calls, at most one an instruction
+	maxRelocs = header->instructionCount * 2 + 64;
+	relocs = Z_Malloc(maxRelocs * sizeof(*relocs));
+	numRelocs = 0;
+	relocsComplete = qtrue;
+#endif
+
+	// copy code in larger buffer and put some zeros at the end
+	// so we can safely look ahead for a few instructions in it
+	// without a chance to get false-positive because of some garbage bytes
+	Com_Memset(code, 0, header->codeLength + 32);
+	Com_Memcpy(code, (byte *)header + header->codeOffset, header->codeLength);
+
+	// ensure that the optimisation pass knows about all the jump
+	// table targets
+	pc = -1; // a bogus value to be printed in out-of-bounds error messages
+	for (i = 0; i < vm->numJumpTableTargets; i++) {
+		JUSED(*(int *)(vm->jumpTableTargets + (i * sizeof(int))));
+	}
+
+	// Start buffer with x86-VM specific procedures
+	compiledOfs = 0;
+
+	callDoSyscallOfs = compiledOfs;
+	callProcOfs = EmitCallDoSyscall(vm);
+	callProcOfsSyscall = EmitCallProcedure(vm, callDoSyscallOfs);
+#if idx64
+	callMathOfs = EmitCallMath(vm);
+	callMemOfs = EmitCallMem(vm);
+	callStackErrOfs = VS_EmitStackErr(vm, callDoSyscallOfs);
+	prologueRelocs = numRelocs;
+#endif
+	vm->entryOfs = compiledOfs;
+
+	for (pass = 0; pass < 3; pass++) {
+#if idx64
+		numRelocs = prologueRelocs;
+#endif
+		oc0 = -23423;
+		oc1 = -234354;
+		pop0 = -43435;
+		pop1 = -545455;
+
+		// translate all instructions
+		pc = 0;
+		instruction = 0;
+		// code = (byte *)header + header->codeOffset;
+		compiledOfs = vm->entryOfs;
+
+		LastCommand = LAST_COMMAND_NONE;
+#if idx64
+		vsDepth = 0;
+#endif
+
+		while (instruction < header->instructionCount) {
+			if (compiledOfs > maxLength - slack) {
+				VMFREE_BUFFERS();
+				Com_Error(ERR_DROP, "VM_CompileX86: maxLength exceeded");
+			}
+
+#if idx64
+			if (vmOptimize && jused[instruction])
+				VS_FlushAll();
+#endif
+
+			vm->instructionPointers[instruction] = compiledOfs;
+
+			if (!vm->jumpTableTargets)
+				jlabel = 1;
+			else
+				jlabel = jused[instruction];
+
+			instruction++;
+
+			if (pc > header->codeLength) {
+				VMFREE_BUFFERS();
+				Com_Error(ERR_DROP, "VM_CompileX86: pc > header->codeLength");
+			}
+
+			op = code[pc];
+			pc++;
+
+#if idx64
+			if (vmOptimize) {
+				if (VS_CompileOp(vm, op, callProcOfsSyscall)) {
+					// nothing the peephole rules look for was emitted
+					pop0 = pop1 = -1;
+					continue;
+				}
+				pop0 = pop1 = -1;
+			}
+#endif
+
+			switch (op) {
+			case 0:
+				break;
+			case OP_BREAK:
+				EmitString("CC"); // int 3
+				break;
+			case OP_ENTER:
+				EmitString("81 EE"); // sub esi, 0x12345678
+				Emit4(Constant4());
+#if idx64
+				if (vmOptimize)
+					VS_EmitStackCheck(vm);
+#endif
+				break;
+			case OP_CONST:
+				if (ConstOptimize(vm, callProcOfsSyscall))
+					break;
+
+				EmitPushStack(vm);
+				EmitString("C7 04 9F"); // mov dword ptr [edi + ebx * 4], 0x12345678
+				lastConst = Constant4();
+
+				Emit4(lastConst);
+				if (code[pc] == OP_JUMP)
 					JUSED(lastConst);
 
 				break;
@@ -1128,6 +2484,10 @@ void VM_Compile(vm_t *vm, vmHeader_t *header) {
 				v = Constant4();
 				EmitString("81 C6"); // add	esi, 0x12345678
 				Emit4(v);
+#if idx64
+				if (vmOptimize)
+					VS_EmitStackCheck(vm);
+#endif
 				EmitString("C3"); // ret
 				break;
 			case OP_LOAD4:
@@ -1551,43 +2911,19 @@ void VM_Compile(vm_t *vm, vmHeader_t *header) {
 		}
 	}
 
-	// copy to an exact sized buffer with the appropriate permission bits
-	vm->codeLength = compiledOfs;
-#ifdef VM_X86_MMAP
-	vm->codeBase = mmap(NULL, compiledOfs, PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
-	if (vm->codeBase == MAP_FAILED)
-		Com_Error(ERR_FATAL, "VM_CompileX86: can't mmap memory");
-#elif _WIN32
-	// allocate memory with EXECUTE permissions under windows.
-	vm->codeBase = VirtualAlloc(NULL, compiledOfs, MEM_COMMIT, PAGE_EXECUTE_READWRITE);
-	if (!vm->codeBase)
-		Com_Error(ERR_FATAL, "VM_CompileX86: VirtualAlloc failed");
-#else
-	vm->codeBase = malloc(compiledOfs);
-	if (!vm->codeBase)
-		Com_Error(ERR_FATAL, "VM_CompileX86: malloc failed");
-#endif
-
-	Com_Memcpy(vm->codeBase, buf, compiledOfs);
-
-#ifdef VM_X86_MMAP
-	if (mprotect(vm->codeBase, compiledOfs, PROT_READ | PROT_EXEC))
-		Com_Error(ERR_FATAL, "VM_CompileX86: mprotect failed");
-#elif _WIN32
-	{
-		DWORD oldProtect = 0;
-
-		// remove write permissions.
-		if (!VirtualProtect(vm->codeBase, compiledOfs, PAGE_EXECUTE_READ, &oldProtect))
-			Com_Error(ERR_FATAL, "VM_CompileX86: VirtualProtect failed");
-	}
-#endif
+	VM_CopyCode(vm, buf, compiledOfs);
 
 	Z_Free(code);
 	Z_Free(buf);
 	Z_Free(jused);
 	Com_Printf("VM file %s compiled to %i bytes of code\n", vm->name, compiledOfs);
 
+#if idx64
+	if (relocsComplete)
+		VM_SaveCompiled(vm);
+	VMFREE_RELOCS();
+#endif
+
 	vm->destroy = VM_Destroy_Compiled;
 
 	// offset all the instruction pointers for the new location
@@ -1597,6 +2933,8 @@ void VM_Compile(vm_t *vm, vmHeader_t *header) {
 }
 
 void VM_Destroy_Compiled(vm_t *self) {
+	Com_MemAccount(VM_MemOwner(self->name), -self->codeLength);
+
 #ifdef VM_X86_MMAP
 	munmap(self->codeBase, self->codeLength);
 #elif _WIN32
@@ -1639,6 +2977,8 @@ int VM_CallCompiled(vm_t *vm, int *args) {
 	image = vm->dataBase;
 
 	programStack -= (8 + 4 * MAX_VMMAIN_ARGS);
+	if (programStack < 0)
+		Com_Error(ERR_DROP, "VM_CallCompiled: program stack overflow");
 
 	for (arg = 0; arg < MAX_VMMAIN_ARGS; arg++)
 		*(int *)&image[programStack + 8 + arg * 4] = args[arg];
@@ -1688,7 +3028,7 @@ int VM_CallCompiled(vm_t *vm, int *args) {
 					 "pop %%r15\n"
 					 : "+S"(programStack), "+D"(opStack), "+b"(opStackOfs)
 					 : "g"(vm->instructionPointers), "g"(vm->dataBase), "g"(entryPoint)
-					 : "cc", "memory", "%rax", "%rcx", "%rdx", "%r8", "%r9", "%r10", "%r11");
+					 : "cc", "memory", "%rax", "%rcx", "%rdx", "%r8", "%r9", "%r10", "%r11", "%xmm0", "%xmm1");
 #else
 	__asm__ volatile("calll *%3\n"
 					 : "+S"(programStack), "+D"(opStack), "+b"(opStackOfs)
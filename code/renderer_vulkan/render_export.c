@@ -59,6 +59,7 @@ refexport_t *R_Export(void) {
 	re.inPVS = RE_inPVS;
 
 	re.TakeVideoFrame = RE_TakeVideoFrame;
+	re.FinishVideoFrames = RE_FinishVideoFrames;
 
 	return &re;
 }
@@ -52,5 +52,6 @@ qboolean RE_GetEntityToken(char *buffer, int size);
 qboolean RE_inPVS(const vec3_t p1, const vec3_t p2);
 void RE_TakeVideoFrame(int width, int height, unsigned char *captureBuffer, unsigned char *encodeBuffer,
 					   qboolean motionJpeg);
+void RE_FinishVideoFrames(void);
 
 #endif
@@ -0,0 +1,30 @@
+#version 450
+
+// bindless variant of multi_texture_mul.frag: one array holding every image, the
+// textures of the draw are picked with indices pushed after the vertex constants
+layout(set = 0, binding = 0) uniform sampler2D textures[2048]; // MAX_DRAWIMAGES
+
+layout(push_constant) uniform Textures {
+    layout(offset = 128) uint texture0;
+    uint texture1;
+};
+
+layout(location = 0) in vec4 frag_color;
+layout(location = 1) in vec2 frag_tex_coord0;
+layout(location = 2) in vec2 frag_tex_coord1;
+
+layout(location = 0) out vec4 out_color;
+
+layout (constant_id = 0) const int alpha_test_func = 0;
+
+void main() {
+    out_color = frag_color * texture(textures[texture0], frag_tex_coord0) * texture(textures[texture1], frag_tex_coord1);
+
+    if (alpha_test_func == 1) {
+        if (out_color.a == 0.0f) discard;
+    } else if (alpha_test_func == 2) {
+        if (out_color.a >= 0.5f) discard;
+    } else if (alpha_test_func == 3) {
+        if (out_color.a < 0.5f) discard;
+    }
+}
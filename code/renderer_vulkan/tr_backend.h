@@ -11,6 +11,7 @@ typedef struct {
 	int c_totalIndexes;
 	int c_dlightVertexes;
 	int c_dlightIndexes;
+	int c_streamedBytes; // vertex and index data copied to the stream buffers
 	int msec; // total msec for backend run
 } backEndCounters_t;
 
@@ -393,6 +393,17 @@ void RB_StretchPic(const stretchPicCommand_t *const cmd) {
 }
 
 static void R_PerformanceCounters(void) {
+	static const char *gpuTimerNames[VK_GPUTIMER_COUNT] = {"gpu 3d", "gpu 2d"};
+	float gpuMsec[VK_GPUTIMER_COUNT];
+	int i;
+
+	// timestamps come back once the frame's slot is reused
+	if (vk_gpuTimerResults(gpuMsec)) {
+		for (i = 0; i < VK_GPUTIMER_COUNT; i++) {
+			ri.ProfileCounter(gpuTimerNames[i], gpuMsec[i]);
+		}
+	}
+
 	if (r_speeds->integer == 1) {
 		ri.Printf(PRINT_ALL, "%i/%i shaders/surfs %i leafs %i verts %i/%i tris\n", backEnd.pc.c_shaders,
 				  backEnd.pc.c_surfaces, tr.pc.c_leafs, backEnd.pc.c_vertexes, backEnd.pc.c_indexes / 3,
@@ -411,6 +422,15 @@ static void R_PerformanceCounters(void) {
 			ri.Printf(PRINT_ALL, "dlight srf:%i  culled:%i  verts:%i  tris:%i\n", tr.pc.c_dlightSurfaces,
 					  tr.pc.c_dlightSurfacesCulled, backEnd.pc.c_dlightVertexes, backEnd.pc.c_dlightIndexes / 3);
 		}
+	} else if (r_speeds->integer == 5) {
+		ri.Printf(PRINT_ALL, "streamed: %i KB\n", backEnd.pc.c_streamedBytes / 1024);
+	} else if (r_speeds->integer == 6) {
+		if (!r_gpuTimers->integer || !vk.timestampsSupported) {
+			ri.Printf(PRINT_ALL, "gpu timers need r_gpuTimers 1 and a queue with timestamps\n");
+		} else {
+			ri.Printf(PRINT_ALL, "gpu msec: 3d %.2f 2d %.2f total %.2f\n", gpuMsec[VK_GPUTIMER_3D],
+					  gpuMsec[VK_GPUTIMER_2D], gpuMsec[VK_GPUTIMER_3D] + gpuMsec[VK_GPUTIMER_2D]);
+		}
 	}
 
 	memset(&tr.pc, 0, sizeof(tr.pc));
@@ -435,6 +455,7 @@ void R_IssueRenderCommands(qboolean runPerformanceCounters) {
 	// let it start on the new batch
 	// RB_ExecuteRenderCommands( cmdList->cmds );
 	t1 = ri.Milliseconds();
+	ri.ProfileBegin("R_IssueRenderCommands");
 
 	// add an end-of-list command
 	*(int *)(BE_Commands.cmds + BE_Commands.used) = RC_END_OF_LIST;
@@ -458,6 +479,7 @@ void R_IssueRenderCommands(qboolean runPerformanceCounters) {
 		case RC_STRETCH_PIC: {
 			const stretchPicCommand_t *const cmd = (const stretchPicCommand_t *)data;
 
+			vk_gpuTimerPhase(VK_GPUTIMER_2D);
 			RB_StretchPic(cmd);
 
 			data += sizeof(stretchPicCommand_t);
@@ -475,6 +497,7 @@ void R_IssueRenderCommands(qboolean runPerformanceCounters) {
 			backEnd.refdef = cmd->refdef;
 			backEnd.viewParms = cmd->viewParms;
 
+			vk_gpuTimerPhase(VK_GPUTIMER_3D);
 			RB_RenderDrawSurfList(cmd->drawSurfs, cmd->numDrawSurfs);
 
 			data += sizeof(drawSurfsCommand_t);
@@ -483,9 +506,8 @@ void R_IssueRenderCommands(qboolean runPerformanceCounters) {
 		case RC_DRAW_BUFFER: {
 			// data = RB_DrawBuffer( data );
 			// const drawBufferCommand_t * const cmd = (const drawBufferCommand_t *)data;
-			vk_resetGeometryBuffer();
 
-			// VULKAN
+			// VULKAN, also rewinds the geometry buffers of the frame
 			vk_begin_frame();
 
 			data += sizeof(drawBufferCommand_t);
@@ -528,6 +550,7 @@ void R_IssueRenderCommands(qboolean runPerformanceCounters) {
 		case RC_END_OF_LIST:
 			// stop rendering on this thread
 			backEnd.pc.msec = ri.Milliseconds() - t1;
+			ri.ProfileEnd();
 
 			BE_Commands.used = 0;
 			return;
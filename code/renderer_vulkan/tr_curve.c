@@ -609,3 +609,130 @@ srfGridMesh_t *R_GridInsertRow(srfGridMesh_t *grid, int row, int column, vec3_t
 	VectorCopy(lodOrigin, grid->lodOrigin);
 	return grid;
 }
+
+/*
+=================
+R_GridLodLevel
+
+Level 0 keeps only the corner rows, level n up to GRID_LOD_LEVELS - 2 keeps
+the rows with a lod error of at most 2^(n - GRID_LOD_BIAS), and the last
+level keeps all of them. The level is rounded up, so a grid never gets
+coarser than the lodError asked for.
+=================
+*/
+#define GRID_LOD_BIAS 13
+
+static float R_GridLodThreshold(int level) {
+	if (level == 0) {
+		return 0;
+	}
+	return ldexpf(1.0f, level - GRID_LOD_BIAS);
+}
+
+int R_GridLodLevel(float lodError) {
+	int exponent;
+	int level;
+
+	if (lodError <= 0) {
+		return 0;
+	}
+
+	// lodError = m * 2^exponent with m in [0.5, 1)
+	if (frexpf(lodError, &exponent) == 0.5f) {
+		exponent--;
+	}
+
+	level = exponent + GRID_LOD_BIAS;
+	if (level < 1) {
+		return 1;
+	}
+	if (level > GRID_LOD_LEVELS - 1) {
+		return GRID_LOD_LEVELS - 1;
+	}
+	return level;
+}
+
+static int R_GridLodTable(const float *lodError, int size, int level, int *table) {
+	int i, n;
+
+	table[0] = 0;
+	n = 1;
+	for (i = 1; i < size - 1; i++) {
+		if (level == GRID_LOD_LEVELS - 1 || lodError[i] <= R_GridLodThreshold(level)) {
+			table[n++] = i;
+		}
+	}
+	table[n++] = size - 1;
+
+	return n;
+}
+
+/*
+=================
+R_CreateGridLods
+
+Builds the row and column tables of every level, and the world buffer
+indexes when the grid is in it, so RB_SurfaceGrid only has to pick one.
+Called once the world buffer has placed the grid.
+=================
+*/
+void R_CreateGridLods(srfGridMesh_t *grid) {
+	int widthTable[MAX_GRID_SIZE];
+	int heightTable[MAX_GRID_SIZE];
+	int level, width, height;
+	int i, j;
+	gridLod_t *lod;
+	unsigned int *indexes;
+
+	lod = NULL;
+	for (level = 0; level < GRID_LOD_LEVELS; level++) {
+		width = R_GridLodTable(grid->widthLodError, grid->width, level, widthTable);
+		height = R_GridLodTable(grid->heightLodError, grid->height, level, heightTable);
+
+		// the kept rows only grow with the level, so the same count means the same rows
+		if (lod && lod->width == width && lod->height == height) {
+			grid->lods[level] = lod;
+			continue;
+		}
+
+		lod = (gridLod_t *)ri.Hunk_Alloc(sizeof(*lod), h_low);
+		lod->width = width;
+		lod->height = height;
+		lod->widthTable = (int *)ri.Hunk_Alloc(width * sizeof(int), h_low);
+		memcpy(lod->widthTable, widthTable, width * sizeof(int));
+		lod->heightTable = (int *)ri.Hunk_Alloc(height * sizeof(int), h_low);
+		memcpy(lod->heightTable, heightTable, height * sizeof(int));
+		lod->worldIndexes = NULL;
+
+		if (grid->worldFirstVertex >= 0) {
+			lod->worldIndexes = indexes =
+				(unsigned int *)ri.Hunk_Alloc((width - 1) * (height - 1) * 6 * sizeof(unsigned int), h_low);
+
+			for (i = 0; i < height - 1; i++) {
+				int row = grid->worldFirstVertex + heightTable[i] * grid->width;
+				int nextRow = grid->worldFirstVertex + heightTable[i + 1] * grid->width;
+
+				for (j = 0; j < width - 1; j++) {
+					int v1, v2, v3, v4;
+
+					// same order as RB_SurfaceGrid
+					v1 = row + widthTable[j + 1];
+					v2 = row + widthTable[j];
+					v3 = nextRow + widthTable[j];
+					v4 = nextRow + widthTable[j + 1];
+
+					indexes[0] = v2;
+					indexes[1] = v3;
+					indexes[2] = v1;
+
+					indexes[3] = v1;
+					indexes[4] = v3;
+					indexes[5] = v4;
+					indexes += 6;
+				}
+			}
+		}
+
+		grid->lods[level] = lod;
+	}
+}
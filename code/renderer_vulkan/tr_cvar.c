@@ -30,6 +30,7 @@ cvar_t *r_displayRefresh;
 
 cvar_t *r_lightmap;
 cvar_t *r_vertexLight;
+cvar_t *r_mergeLightmaps;
 cvar_t *r_uiFullScreen;
 cvar_t *r_shadows;
 cvar_t *r_flares;
@@ -49,6 +50,13 @@ cvar_t *r_portalOnly;
 
 cvar_t *r_subdivisions;
 cvar_t *r_lodCurveError;
+cvar_t *r_vbo;
+cvar_t *r_streamVertexes;
+cvar_t *r_streamIndexes;
+cvar_t *r_pipelineCache;
+cvar_t *r_framesInFlight;
+cvar_t *r_bindless;
+cvar_t *r_gpuTimers;
 
 // r_overbrightBits->integer, but set to 0 if no hw gamma
 // cvar_t	*r_overBrightBits;
@@ -56,6 +64,11 @@ cvar_t *r_mapOverBrightBits;
 
 cvar_t *r_debugSurface;
 cvar_t *r_simpleMipMaps;
+cvar_t *r_ext_compressed_textures;
+cvar_t *r_imageThreads;
+cvar_t *r_captureThreads;
+cvar_t *r_shaderThreads;
+cvar_t *r_shaderCache;
 
 cvar_t *r_showImages;
 
@@ -80,10 +93,12 @@ void R_Register(void) {
 	ri.Cvar_CheckRange(r_picmip, 0, 8, qtrue);
 
 	r_simpleMipMaps = ri.Cvar_Get("r_simpleMipMaps", "1", CVAR_ARCHIVE | CVAR_LATCH);
+	r_ext_compressed_textures = ri.Cvar_Get("r_ext_compressed_textures", "0", CVAR_ARCHIVE | CVAR_LATCH);
 	r_colorMipLevels = ri.Cvar_Get("r_colorMipLevels", "0", CVAR_LATCH);
 
 	// r_overBrightBits = ri.Cvar_Get ("r_overBrightBits", "0", CVAR_ARCHIVE | CVAR_LATCH );
 	r_vertexLight = ri.Cvar_Get("r_vertexLight", "0", CVAR_ARCHIVE | CVAR_LATCH);
+	r_mergeLightmaps = ri.Cvar_Get("r_mergeLightmaps", "1", CVAR_ARCHIVE | CVAR_LATCH);
 	r_uiFullScreen = ri.Cvar_Get("r_uifullscreen", "0", 0);
 	r_subdivisions = ri.Cvar_Get("r_subdivisions", "4", CVAR_ARCHIVE | CVAR_LATCH);
 
@@ -94,16 +109,30 @@ void R_Register(void) {
 	r_mapOverBrightBits = ri.Cvar_Get("r_mapOverBrightBits", "1", CVAR_LATCH);
 	r_intensity = ri.Cvar_Get("r_intensity", "1.5", CVAR_LATCH | CVAR_ARCHIVE);
 	r_singleShader = ri.Cvar_Get("r_singleShader", "0", CVAR_CHEAT | CVAR_LATCH);
+	r_vbo = ri.Cvar_Get("r_vbo", "1", CVAR_ARCHIVE | CVAR_LATCH);
+	r_streamVertexes = ri.Cvar_Get("r_streamVertexes", "196608", CVAR_ARCHIVE | CVAR_LATCH);
+	r_streamIndexes = ri.Cvar_Get("r_streamIndexes", "524288", CVAR_ARCHIVE | CVAR_LATCH);
+	r_pipelineCache = ri.Cvar_Get("r_pipelineCache", "1", CVAR_ARCHIVE | CVAR_LATCH);
+	r_framesInFlight = ri.Cvar_Get("r_framesInFlight", "2", CVAR_ARCHIVE | CVAR_LATCH);
+	r_bindless = ri.Cvar_Get("r_bindless", "1", CVAR_ARCHIVE | CVAR_LATCH);
 
 	//
 	// archived variables that can change at any time
 	//
 	r_lodCurveError = ri.Cvar_Get("r_lodCurveError", "250", CVAR_ARCHIVE | CVAR_CHEAT);
 	r_flares = ri.Cvar_Get("r_flares", "0", CVAR_ARCHIVE);
+	r_gpuTimers = ri.Cvar_Get("r_gpuTimers", "0", CVAR_ARCHIVE);
 	r_znear = ri.Cvar_Get("r_znear", "4", CVAR_CHEAT);
 	ri.Cvar_CheckRange(r_znear, 0.001f, 200, qtrue);
 
 	r_inGameVideo = ri.Cvar_Get("r_inGameVideo", "1", CVAR_ARCHIVE);
+	r_imageThreads = ri.Cvar_Get("r_imageThreads", "4", CVAR_ARCHIVE);
+	ri.Cvar_CheckRange(r_imageThreads, 0, 16, qtrue);
+	r_shaderThreads = ri.Cvar_Get("r_shaderThreads", "4", CVAR_ARCHIVE);
+	ri.Cvar_CheckRange(r_shaderThreads, 0, 16, qtrue);
+	r_captureThreads = ri.Cvar_Get("r_captureThreads", "4", CVAR_ARCHIVE);
+	ri.Cvar_CheckRange(r_captureThreads, 0, 16, qtrue);
+	r_shaderCache = ri.Cvar_Get("r_shaderCache", "1", CVAR_ARCHIVE);
 	r_dynamiclight = ri.Cvar_Get("r_dynamiclight", "1", CVAR_ARCHIVE);
 	r_gamma = ri.Cvar_Get("r_gamma", "1", CVAR_ARCHIVE);
 	r_facePlaneCull = ri.Cvar_Get("r_facePlaneCull", "1", CVAR_ARCHIVE);
@@ -42,6 +42,8 @@ extern cvar_t *r_lightmap;	   // render lightmaps only
 extern cvar_t *r_vertexLight;  // vertex lighting mode for better performance
 extern cvar_t *r_uiFullScreen; // ui is running fullscreen
 
+extern cvar_t *r_mergeLightmaps; // pack the map lightmaps into atlases
+
 extern cvar_t *r_showtris;	  // enables wireframe rendering of the world
 extern cvar_t *r_showsky;	  // forces sky in front of all surfaces
 extern cvar_t *r_shownormals; // draws wireframe normals
@@ -57,12 +59,24 @@ extern cvar_t *r_portalOnly;
 
 extern cvar_t *r_subdivisions;
 extern cvar_t *r_lodCurveError;
+extern cvar_t *r_vbo;			 // static world surfaces in a GPU buffer
+extern cvar_t *r_streamVertexes; // initial size of the per frame vertex stream
+extern cvar_t *r_streamIndexes;	 // initial size of the per frame index stream
+extern cvar_t *r_pipelineCache;	 // keep compiled pipelines in vkpipelines.cache
+extern cvar_t *r_framesInFlight; // frames the CPU may record ahead of the GPU, 1 to 3
+extern cvar_t *r_bindless;		 // one texture array indexed per draw, if descriptor indexing is supported
+extern cvar_t *r_gpuTimers;		 // timestamp the 3D and 2D work, see r_speeds 6
 
 // extern	cvar_t	*r_overBrightBits;
 extern cvar_t *r_mapOverBrightBits;
 
 extern cvar_t *r_debugSurface;
 extern cvar_t *r_simpleMipMaps;
+extern cvar_t *r_ext_compressed_textures; // load BC compressed .dds replacements
+extern cvar_t *r_imageThreads;			  // decode the level's images on this many job threads
+extern cvar_t *r_shaderThreads;			  // check and index the shader scripts on this many job threads
+extern cvar_t *r_shaderCache;			  // keep the indexed shader scripts in shadertext.cache
+extern cvar_t *r_captureThreads;		  // convert screenshot and video frames on this many job threads
 
 extern cvar_t *r_showImages;
 extern cvar_t *r_debugSort;
@@ -10,7 +10,7 @@ Draws triangle outlines for debugging
 */
 void RB_DrawTris(shaderCommands_t *pInput) {
 	VkPipeline pipeline;
-	updateCurDescriptor(tr.whiteImage->descriptor_set, 0);
+	updateCurDescriptor(tr.whiteImage, 0);
 
 	// VULKAN
 
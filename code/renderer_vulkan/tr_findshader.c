@@ -49,8 +49,9 @@ void R_ClearShaderHashTable(void) {
 ====================
 FindShaderInShaderText
 
-Scans the combined text description of all the shader files for the given
-shader name. If found, it will return a valid shader, return NULL if not found.
+Looks the given shader name up in the combined text description of all the
+shader files. Every name in the text is hashed, so the text itself is never
+scanned. If found, it will return a valid shader, return NULL if not found.
 =====================
 */
 static const char *FindShaderInShaderText(const char *shadername) {
@@ -58,32 +59,17 @@ static const char *FindShaderInShaderText(const char *shadername) {
 	int i;
 	const char *p;
 	const char *token;
-	for (i = 0; shaderTextHashTable[hash][i]; i++) {
-		p = shaderTextHashTable[hash][i];
-		token = COM_ParseExt(&p, qtrue);
-		if (!Q_stricmp(token, shadername)) {
-			return p;
-		}
-	}
 
-	p = s_shaderText;
-	if (!p) {
+	if (!shaderTextHashTable[hash]) {
 		return NULL;
 	}
 
-	// look for label
-	while (1) {
+	for (i = 0; shaderTextHashTable[hash][i]; i++) {
+		p = shaderTextHashTable[hash][i];
 		token = COM_ParseExt(&p, qtrue);
-		if (token[0] == 0) {
-			break;
-		}
-
 		if (!Q_stricmp(token, shadername)) {
 			return p;
 		}
-		// skip the definition, tr_common
-		// -> R_SkipBracedSection ?
-		SkipBracedSection(&p, 0);
 	}
 
 	return NULL;
@@ -233,6 +219,37 @@ shader_t *R_FindShader(const char *name, int lightmapIndex, qboolean mipRawImage
 	return FinishShader();
 }
 
+/*
+===============
+R_QueueShaderImages
+
+Queues the images R_FindShader is going to load for a shader with
+R_QueueImagePrefetch, so the level's images can be decoded on the job
+threads while its shaders are created
+===============
+*/
+void R_QueueShaderImages(const char *name) {
+	char strippedName[MAX_QPATH];
+	const char *shaderText;
+	shader_t *sh;
+	int hash;
+
+	R_StripExtension(name, strippedName, sizeof(strippedName));
+
+	// already loaded along with its images
+	hash = generateHashValue(strippedName, FILE_HASH_SIZE);
+	for (sh = hashTable[hash]; sh; sh = sh->next) {
+		if (!Q_stricmp(sh->name, strippedName))
+			return;
+	}
+
+	shaderText = FindShaderInShaderText(strippedName);
+	if (shaderText)
+		R_QueueShaderImagePrefetch(shaderText);
+	else
+		R_QueueImagePrefetch(name);
+}
+
 /*
 ====================
 This is the exported shader entry point for the rest of the system
@@ -330,91 +347,25 @@ qhandle_t R_RegisterShaderFromImage(const char *name, int lightmapIndex, image_t
 ====================
 ScanAndLoadShaderFiles
 
-Finds and loads all .shader files, combining them into
-a single large text block that can be scanned for shader names
+Loads the text of all the .shader files, see R_LoadShaderText,
+and hashes the shader names in it
 =====================
 */
-
-static void BuildSingleLargeBuffer(char *buffers[], const int nShaderFiles, const int sum) {
-	int n = nShaderFiles - 1;
-	char *textEnd;
-
-	// build single large buffer
-	s_shaderText = ri.Hunk_Alloc(sum + nShaderFiles * 2, h_low);
-	s_shaderText[0] = '\0';
-
-	textEnd = s_shaderText;
-	// free in reverse order, so the temp files are all dumped
-	for (n = nShaderFiles - 1; n >= 0; n--) {
-		if (buffers[n]) {
-			strcat(textEnd, buffers[n]);
-			strcat(textEnd, "\n");
-
-			textEnd += strlen(buffers[n]) + 1;
-		}
-	}
-}
-
-static void Shader_DoSimpleCheck(const char *name, const char *p) {
-	R_BeginParseSession(name);
-
-	while (1) {
-		int shaderLine;
-		char shaderName[64] = {0};
-
-		const char *token = COM_ParseExt(&p, qtrue);
-		if (0 == *token)
-			break;
-
-		Q_strncpyz(shaderName, token, sizeof(shaderName));
-
-		shaderLine = R_GetCurrentParseLine();
-
-		token = COM_ParseExt(&p, qtrue);
-		if (token[0] != '{' || token[1] != '\0') {
-			ri.Printf(PRINT_WARNING, "WARNING: Ignoring shader file %s. Shader \"%s\" on line %d missing opening brace",
-					  name, shaderName, shaderLine);
-			if (token[0]) {
-				ri.Printf(PRINT_WARNING, " (found \"%s\" on line %d)", token, R_GetCurrentParseLine());
-			}
-			ri.Printf(PRINT_WARNING, ".\n");
-			break;
-		}
-
-		if (!SkipBracedSection(&p, 1)) {
-			ri.Printf(PRINT_WARNING,
-					  "WARNING: Ignoring shader file %s. Shader \"%s\" on line %d missing closing brace.\n", name,
-					  shaderName, shaderLine);
-			break;
-		}
-	}
-}
-
-static void SetShaderTextHashTableSizes(void) {
+static void SetShaderTextHashTable(const shaderText_t *shaderText) {
 	int shaderTextHashTableSizes[MAX_SHADERTEXT_HASH];
-	int size = 0;
-	const char *p = s_shaderText;
+	const char *p;
 	char *hashMem;
 	int i, hash;
 
 	memset(shaderTextHashTableSizes, 0, sizeof(shaderTextHashTableSizes));
 
-	// look for shader names
-	while (1) {
-		const char *token = COM_ParseExt(&p, qtrue);
-		if (token[0] == 0) {
-			break;
-		}
-
-		hash = generateHashValue(token, MAX_SHADERTEXT_HASH);
+	for (i = 0; i < shaderText->numShaders; i++) {
+		p = shaderText->text + shaderText->shaders[i];
+		hash = generateHashValue(COM_ParseExt(&p, qtrue), MAX_SHADERTEXT_HASH);
 		shaderTextHashTableSizes[hash]++;
-		size++;
-		SkipBracedSection(&p, 0);
 	}
 
-	size += MAX_SHADERTEXT_HASH;
-
-	hashMem = (char *)ri.Hunk_Alloc(size * sizeof(char *), h_low);
+	hashMem = (char *)ri.Hunk_Alloc((shaderText->numShaders + MAX_SHADERTEXT_HASH) * sizeof(char *), h_low);
 
 	for (i = 0; i < MAX_SHADERTEXT_HASH; i++) {
 		shaderTextHashTable[i] = (const char **)hashMem;
@@ -423,81 +374,30 @@ static void SetShaderTextHashTableSizes(void) {
 
 	memset(shaderTextHashTableSizes, 0, sizeof(shaderTextHashTableSizes));
 
-	p = s_shaderText;
-	// look for shader names
-	while (1) {
-		const char *oldp = p;
-		const char *token = COM_ParseExt(&p, qtrue);
-
-		if (token[0] == 0) {
-			break;
-		}
-
-		hash = generateHashValue(token, MAX_SHADERTEXT_HASH);
-		shaderTextHashTable[hash][shaderTextHashTableSizes[hash]++] = oldp;
-
-		SkipBracedSection(&p, 0);
+	// in text order, so the later files still win
+	for (i = 0; i < shaderText->numShaders; i++) {
+		p = shaderText->text + shaderText->shaders[i];
+		hash = generateHashValue(COM_ParseExt(&p, qtrue), MAX_SHADERTEXT_HASH);
+		shaderTextHashTable[hash][shaderTextHashTableSizes[hash]++] = shaderText->text + shaderText->shaders[i];
 	}
 }
 
-#define MAX_SHADER_FILES 4096
 void ScanAndLoadShaderFiles(void) {
-	char *buffers[MAX_SHADER_FILES] = {0};
-	int numShaderFiles = 0;
-	long sum = 0;
-	int i;
-	// scan for shader files
-	char **shaderFiles = ri.FS_ListFiles("scripts", ".shader", &numShaderFiles);
+	shaderText_t shaderText;
 
 	ri.Printf(PRINT_DEVELOPER, "ScanAndLoadShaderFiles\n");
 
-	if (!shaderFiles || !numShaderFiles) {
-		ri.Printf(PRINT_WARNING, "WARNING: no shader files found\n");
-		return;
-	}
-
-	if (numShaderFiles > MAX_SHADER_FILES) {
-		numShaderFiles = MAX_SHADER_FILES;
-		ri.Printf(PRINT_WARNING, "numShaderFiles > MAX_SHADER_FILES\n");
-	}
-
-	// load and parse shader files
-	for (i = 0; i < numShaderFiles; i++) {
-		char filename[128] = {0};
-		long filesize;
+	memset(shaderTextHashTable, 0, sizeof(shaderTextHashTable));
 
-		snprintf(filename, sizeof(filename), "scripts/%s", shaderFiles[i]);
-		ri.Printf(PRINT_ALL, "...loading '%s'\n", filename);
-		filesize = ri.FS_ReadFile(filename, (void**)&buffers[i]);
-
-		if (!buffers[i])
-			ri.Error(ERR_DROP, "Couldn't load %s", filename);
-
-		// Do a simple check on the shader structure in that file
-		// to make sure one bad shader file cannot fuck up all other shaders.
-		Shader_DoSimpleCheck(filename, buffers[i]);
-
-		if (buffers[i])
-			sum += filesize;
-	}
-
-	// build single large buffer
-	BuildSingleLargeBuffer(buffers, numShaderFiles, sum);
-
-	FunLogging("BuildSingleLargeBuffer.txt", s_shaderText);
-
-	for (i = 0; i < numShaderFiles; i++) {
-		ri.FS_FreeFile(buffers[i]);
+	if (!R_LoadShaderText(&shaderText, qfalse)) {
+		return;
 	}
 
-	R_Compress(s_shaderText);
+	s_shaderText = shaderText.text;
 
 	FunLogging("after_R_Compress.txt", s_shaderText);
 
-	// free up memory
-	ri.FS_FreeFileList(shaderFiles);
-
-	SetShaderTextHashTableSizes();
+	SetShaderTextHashTable(&shaderText);
 }
 
 /*
@@ -41,6 +41,8 @@ typedef struct {
 	shader_t *projectionShadowShader;
 
 	int numLightmaps;
+	int fatLightmapCols; // lightmaps per atlas row and column, 0 if not merged
+	int fatLightmapRows;
 	image_t *lightmaps[MAX_LIGHTMAPS];
 
 	trRefEntity_t *currentEntity;
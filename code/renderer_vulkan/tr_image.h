@@ -24,6 +24,7 @@ typedef struct image_s {
 	// It is updated only once during image initialization.
 	VkDescriptorSet descriptor_set;
 
+	VkFormat format;	  // R8G8B8A8 unless loaded from a compressed DDS
 	int wrapClampMode;	  // GL_CLAMP or GL_REPEAT, for vulkan
 	VkBool32 mipmap;	  // for vulkan
 	uint32_t mipLevels;	  // gl texture binding
@@ -0,0 +1,143 @@
+#include "ref_import.h"
+#include "tr_local.h"
+#include "vk_image.h"
+
+// Loads block compressed DDS files, the data is uploaded as is so only
+// the formats Vulkan can sample directly are accepted.
+
+typedef struct {
+	uint32_t headerSize;
+	uint32_t flags;
+	uint32_t height;
+	uint32_t width;
+	uint32_t pitchOrFirstMipSize;
+	uint32_t volumeDepth;
+	uint32_t numMips;
+	uint32_t reserved1[11];
+	uint32_t always_0x00000020;
+	uint32_t pixelFormatFlags;
+	uint32_t fourCC;
+	uint32_t rgbBitCount;
+	uint32_t rBitMask;
+	uint32_t gBitMask;
+	uint32_t bBitMask;
+	uint32_t aBitMask;
+	uint32_t caps;
+	uint32_t caps2;
+	uint32_t caps3;
+	uint32_t caps4;
+	uint32_t reserved2;
+} ddsHeader_t;
+
+typedef struct {
+	uint32_t dxgiFormat;
+	uint32_t dimensions;
+	uint32_t miscFlags;
+	uint32_t arraySize;
+	uint32_t miscFlags2;
+} ddsHeaderDxt10_t;
+
+#define DDSFLAGS_MIPMAPCOUNT 0x20000
+#define DDSPF_FOURCC 0x4
+#define DDSCAPS2_CUBEMAP 0xFE00
+
+#define DXGI_FORMAT_BC1_UNORM 71
+#define DXGI_FORMAT_BC2_UNORM 74
+#define DXGI_FORMAT_BC3_UNORM 77
+#define DXGI_FORMAT_BC4_UNORM 80
+#define DXGI_FORMAT_BC5_UNORM 83
+#define DXGI_FORMAT_BC7_UNORM 98
+
+#define EncodeFourCC(x)                                                                                                \
+	((((uint32_t)((x)[0]))) | (((uint32_t)((x)[1])) << 8) | (((uint32_t)((x)[2])) << 16) |                           \
+	 (((uint32_t)((x)[3])) << 24))
+
+static VkFormat R_DDSFormat(const ddsHeader_t *ddsHeader, const ddsHeaderDxt10_t *ddsHeaderDxt10) {
+	if (ddsHeaderDxt10) {
+		switch (ddsHeaderDxt10->dxgiFormat) {
+		case DXGI_FORMAT_BC1_UNORM:
+			return VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+		case DXGI_FORMAT_BC2_UNORM:
+			return VK_FORMAT_BC2_UNORM_BLOCK;
+		case DXGI_FORMAT_BC3_UNORM:
+			return VK_FORMAT_BC3_UNORM_BLOCK;
+		case DXGI_FORMAT_BC4_UNORM:
+			return VK_FORMAT_BC4_UNORM_BLOCK;
+		case DXGI_FORMAT_BC5_UNORM:
+			return VK_FORMAT_BC5_UNORM_BLOCK;
+		case DXGI_FORMAT_BC7_UNORM:
+			return VK_FORMAT_BC7_UNORM_BLOCK;
+		default:
+			return VK_FORMAT_UNDEFINED;
+		}
+	}
+
+	if (!(ddsHeader->pixelFormatFlags & DDSPF_FOURCC))
+		return VK_FORMAT_UNDEFINED;
+
+	if (ddsHeader->fourCC == EncodeFourCC("DXT1"))
+		return VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+	if (ddsHeader->fourCC == EncodeFourCC("DXT2") || ddsHeader->fourCC == EncodeFourCC("DXT3"))
+		return VK_FORMAT_BC2_UNORM_BLOCK;
+	if (ddsHeader->fourCC == EncodeFourCC("DXT4") || ddsHeader->fourCC == EncodeFourCC("DXT5"))
+		return VK_FORMAT_BC3_UNORM_BLOCK;
+	if (ddsHeader->fourCC == EncodeFourCC("ATI1") || ddsHeader->fourCC == EncodeFourCC("BC4U"))
+		return VK_FORMAT_BC4_UNORM_BLOCK;
+	if (ddsHeader->fourCC == EncodeFourCC("ATI2") || ddsHeader->fourCC == EncodeFourCC("BC5U"))
+		return VK_FORMAT_BC5_UNORM_BLOCK;
+
+	return VK_FORMAT_UNDEFINED;
+}
+
+void R_LoadDDS(const char *name, unsigned char **pic, uint32_t *size, uint32_t *width, uint32_t *height,
+			   uint32_t *numMips, VkFormat *format) {
+	union {
+		unsigned char *b;
+		void *v;
+	} buffer;
+	const ddsHeader_t *ddsHeader;
+	const ddsHeaderDxt10_t *ddsHeaderDxt10 = NULL;
+	uint32_t headerSize = 4 + sizeof(ddsHeader_t);
+	long len;
+
+	*pic = NULL;
+
+	len = ri.FS_ReadFile(name, &buffer.v);
+	if (!buffer.b || len < 0) {
+		return;
+	}
+
+	if (len < headerSize || *((uint32_t *)buffer.b) != EncodeFourCC("DDS ")) {
+		ri.Printf(PRINT_WARNING, "R_LoadDDS: %s is not a DDS file\n", name);
+		ri.FS_FreeFile(buffer.v);
+		return;
+	}
+
+	ddsHeader = (const ddsHeader_t *)(buffer.b + 4);
+	if ((ddsHeader->pixelFormatFlags & DDSPF_FOURCC) && ddsHeader->fourCC == EncodeFourCC("DX10")) {
+		if (len < headerSize + sizeof(ddsHeaderDxt10_t)) {
+			ri.Printf(PRINT_WARNING, "R_LoadDDS: %s is too small for its DX10 header\n", name);
+			ri.FS_FreeFile(buffer.v);
+			return;
+		}
+		ddsHeaderDxt10 = (const ddsHeaderDxt10_t *)(buffer.b + headerSize);
+		headerSize += sizeof(ddsHeaderDxt10_t);
+	}
+
+	*format = R_DDSFormat(ddsHeader, ddsHeaderDxt10);
+	if (*format == VK_FORMAT_UNDEFINED || (ddsHeader->caps2 & DDSCAPS2_CUBEMAP)) {
+		ri.Printf(PRINT_DEVELOPER, "R_LoadDDS: %s has an unsupported format\n", name);
+		ri.FS_FreeFile(buffer.v);
+		return;
+	}
+
+	*width = ddsHeader->width;
+	*height = ddsHeader->height;
+	*numMips = (ddsHeader->flags & DDSFLAGS_MIPMAPCOUNT) ? MAX(ddsHeader->numMips, 1) : 1;
+	*size = len - headerSize;
+
+	*pic = ri.Malloc(*size);
+	memcpy(*pic, buffer.b + headerSize, *size);
+
+	ri.FS_FreeFile(buffer.v);
+}
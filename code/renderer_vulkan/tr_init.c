@@ -32,6 +32,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "vk_pipelines.h"
 #include "vk_screenshot.h"
 #include "vk_shade_geometry.h"
+#include "vk_world_buffer.h"
 
 #include "tr_config.h"
 #include "ref_import.h"
@@ -130,6 +131,8 @@ void RE_Shutdown(qboolean destroyWindow) {
 	ri.Cmd_RemoveCommand("pipelineList");
 	ri.Cmd_RemoveCommand("gpuMem");
 
+	R_ClearVisLists();
+	R_FlushPrefetchedImages();
 	R_DoneFreeType();
 
 	// VULKAN
@@ -143,6 +146,8 @@ void RE_Shutdown(qboolean destroyWindow) {
 
 	vk_resetGeometryBuffer();
 
+	vk_destroyWorldBuffer();
+
 	if (tr.registered) {
 		vk_destroyImageRes();
 		tr.registered = qfalse;
@@ -164,6 +169,7 @@ void RE_BeginRegistration(glconfig_t *pGlCfg) {
 	R_GetGlConfig(pGlCfg);
 
 	tr.viewCluster = -1; // force markleafs to regenerate
+	R_ClearVisLists();
 
 	RE_ClearScene();
 
@@ -180,7 +186,12 @@ Touch all images to make sure they are resident
 =============
 */
 void RE_EndRegistration(void) {
+	R_FlushPrefetchedImages();
+
 	if (tr.registered) {
 		R_IssueRenderCommands(qfalse);
 	}
+
+	// everything the level needs has been compiled by now
+	vk_savePipelineCache();
 }
@@ -6,6 +6,7 @@ void R_LoadJPG(const char *name, byte **pic, int *width, int *height);
 void R_LoadPCX(const char *name, byte **pic, int *width, int *height);
 void R_LoadPNG(const char *name, byte **pic, int *width, int *height);
 void R_LoadTGA(const char *name, byte **pic, int *width, int *height);
+qboolean R_TakePrefetchedImage(const char *name, byte **pic, int *width, int *height);
 
 // Description:  Loads any of the supported image types into
 // a cannonical 32 bit format.
@@ -39,6 +40,9 @@ void R_LoadImage(const char *name, unsigned char **pic, int *width, int *height)
 	*width = 0;
 	*height = 0;
 
+	// decoded on a job thread when the level's shaders were loaded
+	if (R_TakePrefetchedImage(name, pic, width, height))
+		return;
 
 	// copy name to localName
 	while ((c = *pDst++ = *pSrc++)) {
@@ -279,6 +279,7 @@ typedef struct shader_s {
 
 	qboolean isSky;
 	skyParms_t sky;
+	qboolean worldBuffer; // every stage can be drawn from the world buffer
 	fogParms_t fogParms;
 
 	float portalRange; // distance to fog out at
@@ -447,12 +448,28 @@ typedef struct srfFlare_s {
 	vec3_t color;
 } srfFlare_t;
 
+// Grids are drawn at one of GRID_LOD_LEVELS levels of detail built at load.
+// The level thresholds are the same for every grid, so all grids of one LOD
+// group pick the same level and their shared edges stay stitched.
+#define GRID_LOD_LEVELS 18
+
+typedef struct {
+	// the rows and columns of the full grid used at this level
+	int width, height;
+	int *widthTable;
+	int *heightTable;
+
+	unsigned int *worldIndexes; // into the world buffer, NULL if the grid isn't in it
+} gridLod_t;
+
 typedef struct srfGridMesh_s {
 	surfaceType_t surfaceType;
 
 	// dynamic lighting information
 	int dlightBits;
 
+	int worldFirstVertex; // -1 if not in the world buffer
+
 	// culling information
 	vec3_t meshBounds[2];
 	vec3_t localOrigin;
@@ -470,7 +487,8 @@ typedef struct srfGridMesh_s {
 	int width, height;
 	float *widthLodError;
 	float *heightLodError;
-	drawVert_t verts[1]; // variable sized
+	gridLod_t *lods[GRID_LOD_LEVELS]; // levels that keep the same rows share one gridLod_t
+	drawVert_t verts[1];			  // variable sized
 } srfGridMesh_t;
 
 #define VERTEXSIZE 8
@@ -481,6 +499,8 @@ typedef struct {
 	// dynamic lighting information
 	int dlightBits;
 
+	int worldFirstVertex; // -1 if not in the world buffer
+
 	// triangle definitions (no normals at points)
 	int numPoints;
 	int numIndices;
@@ -496,6 +516,8 @@ typedef struct {
 	// dynamic lighting information
 	int dlightBits;
 
+	int worldFirstVertex; // -1 if not in the world buffer
+
 	// culling information (FIXME: use this!)
 	vec3_t bounds[2];
 	vec3_t localOrigin;
@@ -668,6 +690,25 @@ void ScanAndLoadShaderFiles(void);
 shader_t *GeneratePermanentShader(void);
 qboolean ParseShader(const char **text);
 
+// the shader scripts are loaded on the job threads, see tr_shadertext.c
+typedef struct {
+	char *text;			// the good scripts compressed and joined, later files first
+	const int *shaders; // where the parse of each shader name starts in text
+	int numShaders;
+} shaderText_t;
+
+qboolean R_LoadShaderText(shaderText_t *shaderText, qboolean materials);
+
+// renderercommon/tr_deform.c
+void R_DeformWave(float *xyz, const float *normal, int count, const float *table, float base, float amplitude,
+				  float spread, double phase);
+void R_DeformBulge(float *xyz, const float *normal, const float *st, int count, const float *sinTable, float width,
+				   float height, double now);
+void R_DeformOffset(float *xyz, const float *dir, int dirStride, int count, float scale);
+void R_TurbulentTexCoords(float *st, const float *xyz, int count, const float *sinTable, float amplitude,
+						  double now);
+void R_TransformTexCoords(float *st, int count, const float matrix[2][2], const float translate[2]);
+
 #define CULL_IN 0 // completely unclipped
 #define CULL_CLIP 1 // clipped by one or more planes
 #define CULL_OUT 2 // completely outside the clipping planes
@@ -699,6 +740,7 @@ size_t RE_SaveJPGToBuffer(byte *buffer, size_t bufSize, int quality, int image_w
 // qhandle_t RE_RegisterShaderLightMap( const char *name, int lightmapIndex );
 
 shader_t *R_FindShader(const char *name, int lightmapIndex, qboolean mipRawImage);
+void R_QueueShaderImages(const char *name);
 shader_t *R_GetShaderByHandle(qhandle_t hShader);
 // shader_t* R_FindShaderByName( const char *name );
 
@@ -746,6 +788,11 @@ typedef struct shaderCommands_s {
 	int numIndexes;
 	int numVertexes;
 
+	// surfaces in the world buffer only add indexes
+	unsigned int worldIndexes[SHADER_MAX_INDEXES];
+	int numWorldIndexes;
+	qboolean useWorldBuffer;
+
 	// info extracted from current shader
 	int numPasses;
 	shaderStage_t **xstages;
@@ -760,6 +807,7 @@ void RB_CheckOverflow(int verts, int indexes);
 	}
 
 void RB_StageIteratorGeneric(void);
+void RB_StageIteratorWorld(void);
 void RB_StageIteratorSky(void);
 
 void RB_AddQuadStamp(vec3_t origin, vec3_t left, vec3_t up, byte *color);
@@ -775,6 +823,7 @@ WORLD MAP
 
 void R_AddBrushModelSurfaces(trRefEntity_t *e);
 void R_AddWorldSurfaces(void);
+void R_ClearVisLists(void);
 
 /*
 ============================================================
@@ -811,6 +860,8 @@ srfGridMesh_t *R_SubdividePatchToGrid(int width, int height, drawVert_t points[M
 srfGridMesh_t *R_GridInsertColumn(srfGridMesh_t *grid, int column, int row, vec3_t point, float loderror);
 srfGridMesh_t *R_GridInsertRow(srfGridMesh_t *grid, int row, int column, vec3_t point, float loderror);
 void R_FreeSurfaceGridMesh(srfGridMesh_t *grid);
+void R_CreateGridLods(srfGridMesh_t *grid);
+int R_GridLodLevel(float lodError);
 
 /*
 =============================================================
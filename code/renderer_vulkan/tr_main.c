@@ -731,181 +731,69 @@ DRAWSURF SORTING
 */
 
 /*
-=================
-qsort replacement
+===============
+R_RadixSort
 
-=================
+Radix sort with 4 byte size buckets, with all four histograms counted in
+one pass.  Bytes that are equal for every surface are skipped and a list
+that is already sorted is left as it is.
+===============
 */
-void SWAP_DRAW_SURF(void *a, void *b) {
-	char buf[sizeof(drawSurf_t)];
-	memcpy(buf, a, sizeof(drawSurf_t));
-	memcpy(a, b, sizeof(drawSurf_t));
-	memcpy(b, buf, sizeof(drawSurf_t));
-}
-
-/* this parameter defines the cutoff between using quick sort and
-   insertion sort for arrays; arrays with lengths shorter or equal to the
-   below value use insertion sort */
-
-#define CUTOFF 8 /* testing shows that this is good value */
-
-static void shortsort(drawSurf_t *lo, drawSurf_t *hi) {
-	drawSurf_t *p, *max;
-
-	while (hi > lo) {
-		max = lo;
-		for (p = lo + 1; p <= hi; p++) {
-			if (p->sort > max->sort) {
-				max = p;
-			}
+static void R_RadixSort(drawSurf_t *source, int size) {
+	static drawSurf_t scratch[MAX_DRAWSURFS];
+	int count[4][256];
+	int index[256];
+	drawSurf_t *in, *out, *tmp;
+	unsigned int key, prev;
+	qboolean sorted;
+	int i, b, shift;
+
+	Com_Memset(count, 0, sizeof(count));
+
+	sorted = qtrue;
+	prev = 0;
+	for (i = 0; i < size; i++) {
+		key = source[i].sort;
+		if (key < prev) {
+			sorted = qfalse;
 		}
-		SWAP_DRAW_SURF(max, hi);
-		hi--;
-	}
-}
-
-/* sort the array between lo and hi (inclusive)
-FIXME: this was lifted and modified from the microsoft lib source...
- */
-
-void qsortFast(void *base, unsigned num, unsigned width) {
-	char *lo, *hi;		 /* ends of sub-array currently sorting */
-	char *mid;			 /* points to middle of subarray */
-	char *loguy, *higuy; /* traveling pointers for partition step */
-	unsigned size;		 /* size of the sub-array */
-	char *lostk[30], *histk[30];
-	int stkptr; /* stack for saving sub-array to be processed */
-
-	/* Note: the number of stack entries required is no more than
-	   1 + log2(size), so 30 is sufficient for any array */
-
-	if (num < 2 || width == 0)
-		return; /* nothing to do */
-
-	stkptr = 0; /* initialize stack */
+		prev = key;
 
-	lo = (char *)base;
-	hi = (char *)base + width * (num - 1); /* initialize limits */
-
-	/* this entry point is for pseudo-recursion calling: setting
-	   lo and hi and jumping to here is like recursion, but stkptr is
-	   prserved, locals aren't, so we preserve stuff on the stack */
-recurse:
-
-	size = (hi - lo) / width + 1; /* number of el's to sort */
-
-	/* below a certain size, it is faster to use a O(n^2) sorting method */
-	if (size <= CUTOFF) {
-		shortsort((drawSurf_t *)lo, (drawSurf_t *)hi);
-	} else {
-		/* First we pick a partititioning element.  The efficiency of the
-		   algorithm demands that we find one that is approximately the
-		   median of the values, but also that we select one fast.  Using
-		   the first one produces bad performace if the array is already
-		   sorted, so we use the middle one, which would require a very
-		   wierdly arranged array for worst case performance.  Testing shows
-		   that a median-of-three algorithm does not, in general, increase
-		   performance. */
-
-		mid = lo + (size / 2) * width; /* find middle element */
-		SWAP_DRAW_SURF(mid, lo);	   /* swap it to beginning of array */
-
-		/* We now wish to partition the array into three pieces, one
-		   consisiting of elements <= partition element, one of elements
-		   equal to the parition element, and one of element >= to it.  This
-		   is done below; comments indicate conditions established at every
-		   step. */
-
-		loguy = lo;
-		higuy = hi + width;
-
-		/* Note that higuy decreases and loguy increases on every iteration,
-		   so loop must terminate. */
-		for (;;) {
-			/* lo <= loguy < hi, lo < higuy <= hi + 1,
-			   A[i] <= A[lo] for lo <= i <= loguy,
-			   A[i] >= A[lo] for higuy <= i <= hi */
-
-			do {
-				loguy += width;
-			} while (loguy <= hi && (((drawSurf_t *)loguy)->sort <= ((drawSurf_t *)lo)->sort));
-
-			/* lo < loguy <= hi+1, A[i] <= A[lo] for lo <= i < loguy,
-			   either loguy > hi or A[loguy] > A[lo] */
-
-			do {
-				higuy -= width;
-			} while (higuy > lo && (((drawSurf_t *)higuy)->sort >= ((drawSurf_t *)lo)->sort));
-
-			/* lo-1 <= higuy <= hi, A[i] >= A[lo] for higuy < i <= hi,
-			   either higuy <= lo or A[higuy] < A[lo] */
-
-			if (higuy < loguy)
-				break;
+		count[0][key & 255]++;
+		count[1][(key >> 8) & 255]++;
+		count[2][(key >> 16) & 255]++;
+		count[3][key >> 24]++;
+	}
 
-			/* if loguy > hi or higuy <= lo, then we would have exited, so
-			   A[loguy] > A[lo], A[higuy] < A[lo],
-			   loguy < hi, highy > lo */
+	if (sorted) {
+		return;
+	}
 
-			SWAP_DRAW_SURF(loguy, higuy);
+	in = source;
+	out = scratch;
+	for (b = 0; b < 4; b++) {
+		shift = b * 8;
 
-			/* A[loguy] < A[lo], A[higuy] > A[lo]; so condition at top
-			   of loop is re-established */
+		if (count[b][(in[0].sort >> shift) & 255] == size) {
+			continue;
 		}
 
-		/*     A[i] >= A[lo] for higuy < i <= hi,
-			   A[i] <= A[lo] for lo <= i < loguy,
-			   higuy < loguy, lo <= higuy <= hi
-		   implying:
-			   A[i] >= A[lo] for loguy <= i <= hi,
-			   A[i] <= A[lo] for lo <= i <= higuy,
-			   A[i] = A[lo] for higuy < i < loguy */
-
-		SWAP_DRAW_SURF(lo, higuy); /* put partition element in place */
-
-		/* OK, now we have the following:
-			  A[i] >= A[higuy] for loguy <= i <= hi,
-			  A[i] <= A[higuy] for lo <= i < higuy
-			  A[i] = A[lo] for higuy <= i < loguy    */
-
-		/* We've finished the partition, now we want to sort the subarrays
-		   [lo, higuy-1] and [loguy, hi].
-		   We do the smaller one first to minimize stack usage.
-		   We only sort arrays of length 2 or more.*/
-
-		if (higuy - 1 - lo >= hi - loguy) {
-			if (lo + width < higuy) {
-				lostk[stkptr] = lo;
-				histk[stkptr] = higuy - width;
-				++stkptr;
-			} /* save big recursion for later */
-
-			if (loguy < hi) {
-				lo = loguy;
-				goto recurse; /* do small recursion */
-			}
-		} else {
-			if (loguy < hi) {
-				lostk[stkptr] = loguy;
-				histk[stkptr] = hi;
-				++stkptr; /* save big recursion for later */
-			}
+		index[0] = 0;
+		for (i = 1; i < 256; i++) {
+			index[i] = index[i - 1] + count[b][i - 1];
+		}
 
-			if (lo + width < higuy) {
-				hi = higuy - width;
-				goto recurse; /* do small recursion */
-			}
+		for (i = 0; i < size; i++) {
+			out[index[(in[i].sort >> shift) & 255]++] = in[i];
 		}
-	}
 
-	/* We have sorted the array, except for any pending sorts on the stack.
-	   Check if there are any, and do them. */
+		tmp = in;
+		in = out;
+		out = tmp;
+	}
 
-	--stkptr;
-	if (stkptr >= 0) {
-		lo = lostk[stkptr];
-		hi = histk[stkptr];
-		goto recurse; /* pop subarray from stack */
+	if (in != source) {
+		Com_Memcpy(source, in, size * sizeof(*source));
 	}
 }
 
@@ -960,7 +848,7 @@ static void R_SortDrawSurfs(drawSurf_t *drawSurfs, int numDrawSurfs) {
 	}
 
 	// sort the drawsurfs by sort type, then orientation, then shader
-	qsortFast(drawSurfs, numDrawSurfs, sizeof(drawSurf_t));
+	R_RadixSort(drawSurfs, numDrawSurfs);
 
 	// check for any pass through drawing, which
 	// may cause another view to be rendered first
@@ -312,6 +312,8 @@ void RE_RenderScene(const refdef_t *fd) {
 		return;
 	}
 
+	ri.ProfileBegin("RE_RenderScene");
+
 	tr.refdef.AreamaskModified = qfalse;
 
 	if (!(fd->rdflags & RDF_NOWORLDMODEL)) {
@@ -400,6 +402,7 @@ void RE_RenderScene(const refdef_t *fd) {
 	r_firstScenePoly = r_numpolys;
 
 	tr.frontEndMsec += ri.Milliseconds() - startTime;
+	ri.ProfileEnd();
 }
 
 /*
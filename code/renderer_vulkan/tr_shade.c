@@ -29,6 +29,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "ref_import.h"
 #include "tr_backend.h"
 #include "tr_cvar.h"
+#include "vk_world_buffer.h"
 
 /*
 
@@ -61,12 +62,17 @@ void RB_BeginSurface(shader_t *shader, int fogNum) {
 
 	tess.numIndexes = 0;
 	tess.numVertexes = 0;
+	tess.numWorldIndexes = 0;
 	tess.shader = state;
 	tess.fogNum = fogNum;
 	tess.dlightBits = 0; // will be OR'd in by surface functions
 	tess.xstages = state->stages;
 	tess.numPasses = state->numUnfoggedPasses;
 
+	// the debug views read tess.xyz, so they need the old path
+	tess.useWorldBuffer = vk_worldBufferActive() && state->worldBuffer && !fogNum && !r_showtris->integer &&
+						  !r_shownormals->integer;
+
 	tess.shaderTime = backEnd.refdef.floatTime - tess.shader->timeOffset;
 
 	if (tess.shader->clampTime && tess.shaderTime >= tess.shader->clampTime) {
@@ -75,7 +81,7 @@ void RB_BeginSurface(shader_t *shader, int fogNum) {
 }
 
 void RB_EndSurface(void) {
-	if (tess.numIndexes == 0) {
+	if (tess.numIndexes == 0 && tess.numWorldIndexes == 0) {
 		return;
 	}
 
@@ -101,27 +107,36 @@ void RB_EndSurface(void) {
 	//
 	backEnd.pc.c_shaders++;
 	backEnd.pc.c_vertexes += tess.numVertexes;
-	backEnd.pc.c_indexes += tess.numIndexes;
-	backEnd.pc.c_totalIndexes += tess.numIndexes * tess.numPasses;
-
-	//
-	// call off to shader specific tess end function
-	//
-	if (tess.shader->isSky)
-		RB_StageIteratorSky();
-	else
-		RB_StageIteratorGeneric();
+	backEnd.pc.c_indexes += tess.numIndexes + tess.numWorldIndexes;
+	backEnd.pc.c_totalIndexes += (tess.numIndexes + tess.numWorldIndexes) * tess.numPasses;
 
-	//
-	// draw debugging stuff
-	//
-	if (r_showtris->integer) {
-		RB_DrawTris(&tess);
+	// surfaces in the world buffer go first, the rest of the batch
+	// (dynamically lit ones) takes the usual path
+	if (tess.numWorldIndexes) {
+		RB_StageIteratorWorld();
 	}
-	if (r_shownormals->integer) {
-		RB_DrawNormals(&tess, tess.numVertexes);
+
+	if (tess.numIndexes) {
+		//
+		// call off to shader specific tess end function
+		//
+		if (tess.shader->isSky)
+			RB_StageIteratorSky();
+		else
+			RB_StageIteratorGeneric();
+
+		//
+		// draw debugging stuff
+		//
+		if (r_showtris->integer) {
+			RB_DrawTris(&tess);
+		}
+		if (r_shownormals->integer) {
+			RB_DrawNormals(&tess, tess.numVertexes);
+		}
 	}
 	// clear shader so we can tell we don't have any unclosed surfaces
 	tess.numIndexes = 0;
 	tess.numVertexes = 0;
+	tess.numWorldIndexes = 0;
 }
@@ -114,38 +114,13 @@ RB_CalcDeformVertexes
 ========================
 */
 void RB_CalcDeformVertexes(deformStage_t *ds) {
-	int i;
-	vec3_t offset;
-	float scale;
-	float *xyz = (float *)tess.xyz;
-	float *normal = (float *)tess.normal;
-	float *table;
+	const waveForm_t *wf = &ds->deformationWave;
 
-	if (ds->deformationWave.frequency == 0) {
-		scale = EvalWaveForm(&ds->deformationWave);
-
-		for (i = 0; i < tess.numVertexes; i++, xyz += 4, normal += 4) {
-			VectorScale(normal, scale, offset);
-
-			xyz[0] += offset[0];
-			xyz[1] += offset[1];
-			xyz[2] += offset[2];
-		}
+	if (wf->frequency == 0) {
+		R_DeformOffset((float *)tess.xyz, (float *)tess.normal, 4, tess.numVertexes, EvalWaveForm(wf));
 	} else {
-		table = TableForFunc(ds->deformationWave.func);
-
-		for (i = 0; i < tess.numVertexes; i++, xyz += 4, normal += 4) {
-			float off = (xyz[0] + xyz[1] + xyz[2]) * ds->deformationSpread;
-
-			scale = WAVEVALUE(table, ds->deformationWave.base, ds->deformationWave.amplitude,
-							  ds->deformationWave.phase + off, ds->deformationWave.frequency);
-
-			VectorScale(normal, scale, offset);
-
-			xyz[0] += offset[0];
-			xyz[1] += offset[1];
-			xyz[2] += offset[2];
-		}
+		R_DeformWave((float *)tess.xyz, (float *)tess.normal, tess.numVertexes, TableForFunc(wf->func), wf->base,
+					 wf->amplitude, ds->deformationSpread, wf->phase + (double)tess.shaderTime * wf->frequency);
 	}
 }
 
@@ -189,26 +164,8 @@ RB_CalcBulgeVertexes
 ========================
 */
 void RB_CalcBulgeVertexes(deformStage_t *ds) {
-	int i;
-	const float *st = (const float *)tess.texCoords[0];
-	float *xyz = (float *)tess.xyz;
-	float *normal = (float *)tess.normal;
-	float now;
-
-	now = backEnd.refdef.rd.time * ds->bulgeSpeed * 0.001f;
-
-	for (i = 0; i < tess.numVertexes; i++, xyz += 4, st += 4, normal += 4) {
-		int off;
-		float scale;
-
-		off = (float)(FUNCTABLE_SIZE / (M_PI * 2)) * (st[0] * ds->bulgeWidth + now);
-
-		scale = tr.sinTable[off & FUNCTABLE_MASK] * ds->bulgeHeight;
-
-		xyz[0] += normal[0] * scale;
-		xyz[1] += normal[1] * scale;
-		xyz[2] += normal[2] * scale;
-	}
+	R_DeformBulge((float *)tess.xyz, (float *)tess.normal, (float *)tess.texCoords[0], tess.numVertexes, tr.sinTable,
+				  ds->bulgeWidth, ds->bulgeHeight, backEnd.refdef.rd.time * 0.001 * ds->bulgeSpeed);
 }
 
 /*
@@ -219,23 +176,15 @@ A deformation that can move an entire surface along a wave path
 ======================
 */
 void RB_CalcMoveVertexes(deformStage_t *ds) {
-	int i;
-	float *xyz;
 	float *table;
 	float scale;
-	vec3_t offset;
 
 	table = TableForFunc(ds->deformationWave.func);
 
 	scale = WAVEVALUE(table, ds->deformationWave.base, ds->deformationWave.amplitude, ds->deformationWave.phase,
 					  ds->deformationWave.frequency);
 
-	VectorScale(ds->moveVector, scale, offset);
-
-	xyz = (float *)tess.xyz;
-	for (i = 0; i < tess.numVertexes; i++, xyz += 4) {
-		VectorAdd(xyz, offset, xyz);
-	}
+	R_DeformOffset((float *)tess.xyz, ds->moveVector, 0, tess.numVertexes, scale);
 }
 
 /*
@@ -898,42 +847,26 @@ void RB_CalcEnvironmentTexCoords(float *st) {
 ** RB_CalcTurbulentTexCoords
 */
 void RB_CalcTurbulentTexCoords(const waveForm_t *wf, float *st) {
-	int i;
-	float now;
-
-	now = (wf->phase + tess.shaderTime * wf->frequency);
-
-	for (i = 0; i < tess.numVertexes; i++, st += 2) {
-		float s = st[0];
-		float t = st[1];
-
-		st[0] =
-			s + tr.sinTable[((int)(((tess.xyz[i][0] + tess.xyz[i][2]) * 1.0 / 128 * 0.125 + now) * FUNCTABLE_SIZE)) &
-							(FUNCTABLE_MASK)] *
-					wf->amplitude;
-		st[1] =
-			t + tr.sinTable[((int)((tess.xyz[i][1] * 1.0 / 128 * 0.125 + now) * FUNCTABLE_SIZE)) & (FUNCTABLE_MASK)] *
-					wf->amplitude;
-	}
+	R_TurbulentTexCoords(st, (float *)tess.xyz, tess.numVertexes, tr.sinTable, wf->amplitude,
+						 wf->phase + (double)tess.shaderTime * wf->frequency);
 }
 
 /*
 ** RB_CalcScaleTexCoords
 */
 void RB_CalcScaleTexCoords(const float scale[2], float *st) {
-	int i;
+	const float matrix[2][2] = {{scale[0], 0.0f}, {0.0f, scale[1]}};
+	const float translate[2] = {0.0f, 0.0f};
 
-	for (i = 0; i < tess.numVertexes; i++, st += 2) {
-		st[0] *= scale[0];
-		st[1] *= scale[1];
-	}
+	R_TransformTexCoords(st, tess.numVertexes, matrix, translate);
 }
 
 /*
 ** RB_CalcScrollTexCoords
 */
 void RB_CalcScrollTexCoords(const float scrollSpeed[2], float *st) {
-	int i;
+	const float identity[2][2] = {{1.0f, 0.0f}, {0.0f, 1.0f}};
+	float translate[2];
 	float timeScale = tess.shaderTime;
 	float adjustedScrollS, adjustedScrollT;
 
@@ -945,25 +878,17 @@ void RB_CalcScrollTexCoords(const float scrollSpeed[2], float *st) {
 	adjustedScrollS = adjustedScrollS - floor(adjustedScrollS);
 	adjustedScrollT = adjustedScrollT - floor(adjustedScrollT);
 
-	for (i = 0; i < tess.numVertexes; i++, st += 2) {
-		st[0] += adjustedScrollS;
-		st[1] += adjustedScrollT;
-	}
+	translate[0] = adjustedScrollS;
+	translate[1] = adjustedScrollT;
+
+	R_TransformTexCoords(st, tess.numVertexes, identity, translate);
 }
 
 /*
 ** RB_CalcTransformTexCoords
 */
 void RB_CalcTransformTexCoords(const texModInfo_t *tmi, float *st) {
-	int i;
-
-	for (i = 0; i < tess.numVertexes; i++, st += 2) {
-		float s = st[0];
-		float t = st[1];
-
-		st[0] = s * tmi->matrix[0][0] + t * tmi->matrix[1][0] + tmi->translate[0];
-		st[1] = s * tmi->matrix[0][1] + t * tmi->matrix[1][1] + tmi->translate[1];
-	}
+	R_TransformTexCoords(st, tess.numVertexes, tmi->matrix, tmi->translate);
 }
 
 /*
@@ -27,6 +27,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "vk_image.h"
 #include "vk_pipelines.h"
 #include "vk_shaders.h"
+#include "vk_world_buffer.h"
 
 // tr_shader.c -- this file deals with the parsing and definition of shaders
 
@@ -1541,6 +1542,45 @@ static void VertexLightingCollapse(void) {
 	}
 }
 
+/*
+===================
+ComputeWorldBuffer
+
+See if surfaces with this shader can be drawn straight from the world buffer,
+which needs every stage color and texture coordinate to be in the buffer
+===================
+*/
+static void ComputeWorldBuffer(void) {
+	int i, b;
+
+	shader.worldBuffer = qfalse;
+
+	if (shader.isSky || shader.numDeforms || !shader.numUnfoggedPasses) {
+		return;
+	}
+
+	for (i = 0; i < shader.numUnfoggedPasses; i++) {
+		shaderStage_t *pStage = &stages[i];
+
+		if (vk_worldStageColor(pStage) == WORLD_COLOR_NONE) {
+			return;
+		}
+
+		for (b = 0; b < NUM_TEXTURE_BUNDLES; b++) {
+			textureBundle_t *bundle = &pStage->bundle[b];
+
+			if (b > 0 && !bundle->image[0]) {
+				break;
+			}
+			if (bundle->numTexMods || (bundle->tcGen != TCGEN_TEXTURE && bundle->tcGen != TCGEN_LIGHTMAP)) {
+				return;
+			}
+		}
+	}
+
+	shader.worldBuffer = qtrue;
+}
+
 /*
 =========================
 FinishShader
@@ -1683,6 +1723,8 @@ shader_t *FinishShader(void) {
 	if (iStage == 0 && !shader.isSky)
 		shader.sort = SS_FOG;
 
+	ComputeWorldBuffer();
+
 	// VULKAN: create pipelines for each shader stage
 	for (i = 0; i < iStage; i++) {
 		create_pipelines_for_each_stage(&stages[i], &shader);
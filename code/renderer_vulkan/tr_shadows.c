@@ -207,7 +207,7 @@ void RB_ShadowTessEnd(void) {
 
 	// draw the silhouette edges
 
-	updateCurDescriptor(tr.whiteImage->descriptor_set, 0);
+	updateCurDescriptor(tr.whiteImage, 0);
 
 	R_ExtrudeShadowEdges();
 
@@ -240,7 +240,7 @@ void RB_ShadowFinish(void) {
 		return;
 	}
 
-	updateCurDescriptor(tr.whiteImage->descriptor_set, 0);
+	updateCurDescriptor(tr.whiteImage, 0);
 
 	// VULKAN
 
@@ -61,6 +61,25 @@ void RB_CheckOverflow(int verts, int indexes) {
 	RB_BeginSurface(tess.shader, tess.fogNum);
 }
 
+static void RB_CheckWorldOverflow(int indexes) {
+	if (tess.numWorldIndexes + indexes < SHADER_MAX_INDEXES) {
+		return;
+	}
+
+	RB_EndSurface();
+
+	if (indexes >= SHADER_MAX_INDEXES) {
+		ri.Error(ERR_DROP, "RB_CheckWorldOverflow: indices > MAX (%d > %d)", indexes, SHADER_MAX_INDEXES);
+	}
+
+	RB_BeginSurface(tess.shader, tess.fogNum);
+}
+
+// surfaces in the world buffer only add indexes, unless they are dynamically lit
+static ID_INLINE qboolean RB_WorldSurface(int worldFirstVertex, int dlightBits) {
+	return tess.useWorldBuffer && worldFirstVertex >= 0 && !dlightBits;
+}
+
 void RB_AddQuadStampExt(vec3_t origin, vec3_t left, vec3_t up, byte *color, float s1, float t1, float s2, float t2) {
 	uint32_t ndx0;
 	uint32_t ndx1;
@@ -236,6 +255,17 @@ void RB_SurfaceTriangles(srfTriangles_t *srf) {
 	qboolean needsNormal;
 
 	dlightBits = srf->dlightBits;
+
+	if (RB_WorldSurface(srf->worldFirstVertex, dlightBits)) {
+		RB_CheckWorldOverflow(srf->numIndexes);
+
+		for (i = 0; i < srf->numIndexes; i++) {
+			tess.worldIndexes[tess.numWorldIndexes + i] = srf->worldFirstVertex + srf->indexes[i];
+		}
+		tess.numWorldIndexes += srf->numIndexes;
+		return;
+	}
+
 	tess.dlightBits |= dlightBits;
 
 	RB_CHECKOVERFLOW(srf->numVerts, srf->numIndexes);
@@ -718,13 +748,24 @@ void RB_SurfaceFace(srfSurfaceFace_t *surf) {
 	int numPoints;
 	int dlightBits;
 
+	dlightBits = surf->dlightBits;
+	indices = (unsigned *)(((char *)surf) + surf->ofsIndices);
+
+	if (RB_WorldSurface(surf->worldFirstVertex, dlightBits)) {
+		RB_CheckWorldOverflow(surf->numIndices);
+
+		tessIndexes = tess.worldIndexes + tess.numWorldIndexes;
+		for (i = surf->numIndices - 1; i >= 0; i--) {
+			tessIndexes[i] = indices[i] + surf->worldFirstVertex;
+		}
+		tess.numWorldIndexes += surf->numIndices;
+		return;
+	}
+
 	RB_CHECKOVERFLOW(surf->numPoints, surf->numIndices);
 
-	dlightBits = surf->dlightBits;
 	tess.dlightBits |= dlightBits;
 
-	indices = (unsigned *)(((char *)surf) + surf->ofsIndices);
-
 	Bob = tess.numVertexes;
 	tessIndexes = tess.indexes + tess.numIndexes;
 	for (i = surf->numIndices - 1; i >= 0; i--) {
@@ -790,6 +831,21 @@ static float LodErrorForVolume(vec3_t local, float radius) {
 	return r_lodCurveError->value / d;
 }
 
+// copies the level's prebuilt indexes, one row of quads at a time so a large grid can span batches
+static void RB_SurfaceGridWorld(const gridLod_t *lod) {
+	const unsigned int *indexes = lod->worldIndexes;
+	int rowIndexes = (lod->width - 1) * 6;
+	int i;
+
+	for (i = 0; i < lod->height - 1; i++) {
+		RB_CheckWorldOverflow(rowIndexes);
+
+		memcpy(tess.worldIndexes + tess.numWorldIndexes, indexes, rowIndexes * sizeof(*indexes));
+		tess.numWorldIndexes += rowIndexes;
+		indexes += rowIndexes;
+	}
+}
+
 /*
 =============
 RB_SurfaceGrid
@@ -806,9 +862,9 @@ void RB_SurfaceGrid(srfGridMesh_t *cv) {
 	drawVert_t *dv;
 	int rows, irows, vrows;
 	int used;
-	int widthTable[MAX_GRID_SIZE];
-	int heightTable[MAX_GRID_SIZE];
-	float lodError;
+	const gridLod_t *lod;
+	const int *widthTable;
+	const int *heightTable;
 	int lodWidth, lodHeight;
 	int numVertexes;
 	int dlightBits;
@@ -818,32 +874,18 @@ void RB_SurfaceGrid(srfGridMesh_t *cv) {
 	dlightBits = cv->dlightBits;
 	tess.dlightBits |= dlightBits;
 
-	// determine the allowable discrepance
-	lodError = LodErrorForVolume(cv->lodOrigin, cv->lodRadius);
-
-	// determine which rows and columns of the subdivision
-	// we are actually going to use
-	widthTable[0] = 0;
-	lodWidth = 1;
-	for (i = 1; i < cv->width - 1; i++) {
-		if (cv->widthLodError[i] <= lodError) {
-			widthTable[lodWidth] = i;
-			lodWidth++;
-		}
-	}
-	widthTable[lodWidth] = cv->width - 1;
-	lodWidth++;
+	// pick the level for the allowable discrepance
+	lod = cv->lods[R_GridLodLevel(LodErrorForVolume(cv->lodOrigin, cv->lodRadius))];
 
-	heightTable[0] = 0;
-	lodHeight = 1;
-	for (i = 1; i < cv->height - 1; i++) {
-		if (cv->heightLodError[i] <= lodError) {
-			heightTable[lodHeight] = i;
-			lodHeight++;
-		}
+	if (RB_WorldSurface(cv->worldFirstVertex, dlightBits)) {
+		RB_SurfaceGridWorld(lod);
+		return;
 	}
-	heightTable[lodHeight] = cv->height - 1;
-	lodHeight++;
+
+	widthTable = lod->widthTable;
+	heightTable = lod->heightTable;
+	lodWidth = lod->width;
+	lodHeight = lod->height;
 
 	// very large grids may have more points or indexes than can be fit
 	// in the tess structure, so we may have to issue it in multiple passes
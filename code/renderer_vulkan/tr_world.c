@@ -331,143 +331,201 @@ void R_AddBrushModelSurfaces(trRefEntity_t *ent) {
 */
 
 /*
-================
-R_RecursiveWorldNode
-================
+Each view cluster (and area mask) keeps the list of its potentially
+visible nodes in the order a recursive front-first walk visits them.
+The lists are built the first time a cluster is entered and kept in
+a small LRU cache, so moving between recently seen clusters doesn't
+remark the tree, and the world walk runs down a flat array.
 */
-static void R_RecursiveWorldNode(mnode_t *node, int planeBits, int dlightBits) {
-	do {
-		int newDlights[2];
 
-		// if the node wasn't marked as potentially visible, exit
-		if (node->visframe != tr.visCount) {
-			return;
+#define MAX_VIS_LISTS 16
+
+typedef struct {
+	mnode_t *node;
+	int parent;					// list index of the parent, -1 for the root
+	int side;					// which child of the parent this is
+	int skip;					// list index just past this node's subtree
+	int planeBits;				// frustum planes left to test below this node
+	int dlightBits[2];			// dlights reaching each child
+} visNode_t;
+
+typedef struct {
+	int cluster; // -1 for r_novis or outside the world
+	byte areamask[MAX_MAP_AREA_BYTES];
+	int lastUsed;
+	int numNodes;
+	visNode_t *nodes;
+} visList_t;
+
+static visList_t visLists[MAX_VIS_LISTS];
+static visList_t *visList; // list for tr.viewCluster
+static int visListSequence;
+
+/*
+===============
+R_ClearVisLists
+===============
+*/
+void R_ClearVisLists(void) {
+	int i;
+
+	for (i = 0; i < MAX_VIS_LISTS; i++) {
+		if (visLists[i].nodes) {
+			ri.Free(visLists[i].nodes);
 		}
+	}
 
-		// if the bounding volume is outside the frustum, nothing
-		// inside can be visible OPTIMIZE: don't do this all the way to leafs?
+	Com_Memset(visLists, 0, sizeof(visLists));
+	visList = NULL;
+	visListSequence = 0;
+}
 
-		if (!r_nocull->integer) {
-			int r;
+/*
+===============
+R_AddVisNode
 
-			if (planeBits & 1) {
-				r = BoxOnPlaneSide(node->mins, node->maxs, &tr.viewParms.frustum[0]);
-				if (r == 2) {
-					return; // culled
-				}
-				if (r == 1) {
-					planeBits &= ~1; // all descendants will also be in front
-				}
-			}
+Pre-order, front child first, same as the old recursion
+===============
+*/
+static void R_AddVisNode(visList_t *list, mnode_t *node, int parent, int side) {
+	int index;
 
-			if (planeBits & 2) {
-				r = BoxOnPlaneSide(node->mins, node->maxs, &tr.viewParms.frustum[1]);
-				if (r == 2) {
-					return; // culled
-				}
-				if (r == 1) {
-					planeBits &= ~2; // all descendants will also be in front
-				}
-			}
+	if (node->visframe != tr.visCount) {
+		return;
+	}
 
-			if (planeBits & 4) {
-				r = BoxOnPlaneSide(node->mins, node->maxs, &tr.viewParms.frustum[2]);
-				if (r == 2) {
-					return; // culled
-				}
-				if (r == 1) {
-					planeBits &= ~4; // all descendants will also be in front
-				}
-			}
+	index = list->numNodes++;
+	list->nodes[index].node = node;
+	list->nodes[index].parent = parent;
+	list->nodes[index].side = side;
 
-			if (planeBits & 8) {
-				r = BoxOnPlaneSide(node->mins, node->maxs, &tr.viewParms.frustum[3]);
-				if (r == 2) {
-					return; // culled
-				}
-				if (r == 1) {
-					planeBits &= ~8; // all descendants will also be in front
-				}
+	if (node->contents == -1) {
+		R_AddVisNode(list, node->children[0], index, 0);
+		R_AddVisNode(list, node->children[1], index, 1);
+	}
+
+	list->nodes[index].skip = list->numNodes;
+}
+
+/*
+================
+R_CullWorldNode
+
+Clears the planes the node is entirely in front of
+================
+*/
+static qboolean R_CullWorldNode(mnode_t *node, int *planeBits) {
+	int i, r;
+
+	for (i = 0; i < 4; i++) {
+		if (*planeBits & (1 << i)) {
+			r = BoxOnPlaneSide(node->mins, node->maxs, &tr.viewParms.frustum[i]);
+			if (r == 2) {
+				return qtrue;
+			}
+			if (r == 1) {
+				*planeBits &= ~(1 << i); // all descendants will also be in front
 			}
 		}
+	}
 
-		if (node->contents != -1) {
-			break;
+	return qfalse;
+}
+
+/*
+================
+R_AddLeafSurfaces
+================
+*/
+static void R_AddLeafSurfaces(const mnode_t *node, int dlightBits) {
+	int c;
+	msurface_t *surf, **mark;
+
+	tr.pc.c_leafs++;
+
+	// add to z buffer bounds
+	AddPointToBounds(node->mins, tr.viewParms.visBounds[0], tr.viewParms.visBounds[1]);
+	AddPointToBounds(node->maxs, tr.viewParms.visBounds[0], tr.viewParms.visBounds[1]);
+
+	// add the individual surfaces
+	mark = node->firstmarksurface;
+	c = node->nummarksurfaces;
+	while (c--) {
+		// the surface may have already been added if it
+		// spans multiple leafs
+		surf = *mark;
+		R_AddWorldSurface(surf, dlightBits);
+		mark++;
+	}
+}
+
+/*
+================
+R_WorldNodes
+
+Walks the visible node list, skipping culled subtrees
+================
+*/
+static void R_WorldNodes(visList_t *list, int dlightBits) {
+	visNode_t *vn, *parent;
+	mnode_t *node;
+	int planeBits, nodeDlights;
+	int i;
+
+	i = 0;
+	while (i < list->numNodes) {
+		vn = &list->nodes[i];
+		node = vn->node;
+
+		if (vn->parent < 0) {
+			planeBits = 15;
+			nodeDlights = dlightBits;
+		} else {
+			parent = &list->nodes[vn->parent];
+			planeBits = parent->planeBits;
+			nodeDlights = parent->dlightBits[vn->side];
 		}
 
-		// node is just a decision point, so go down both sides
-		// since we don't care about sort orders, just go positive to negative
+		// if the bounding volume is outside the frustum, nothing
+		// inside can be visible
+		if (!r_nocull->integer && R_CullWorldNode(node, &planeBits)) {
+			i = vn->skip;
+			continue;
+		}
 
-		// determine which dlights are needed
-		newDlights[0] = 0;
-		newDlights[1] = 0;
-		if (dlightBits) {
-			int i;
+		if (node->contents != -1) {
+			R_AddLeafSurfaces(node, nodeDlights);
+			i++;
+			continue;
+		}
 
-			for (i = 0; i < tr.refdef.num_dlights; i++) {
+		// node is just a decision point, so determine which
+		// dlights are needed on both sides
+		vn->planeBits = planeBits;
+		vn->dlightBits[0] = 0;
+		vn->dlightBits[1] = 0;
+		if (nodeDlights) {
+			int j;
+
+			for (j = 0; j < tr.refdef.num_dlights; j++) {
 				dlight_t *dl;
 				float dist;
 
-				if (dlightBits & (1 << i)) {
-					dl = &tr.refdef.dlights[i];
+				if (nodeDlights & (1 << j)) {
+					dl = &tr.refdef.dlights[j];
 					dist = DotProduct(dl->origin, node->plane->normal) - node->plane->dist;
 
 					if (dist > -dl->radius) {
-						newDlights[0] |= (1 << i);
+						vn->dlightBits[0] |= (1 << j);
 					}
 					if (dist < dl->radius) {
-						newDlights[1] |= (1 << i);
+						vn->dlightBits[1] |= (1 << j);
 					}
 				}
 			}
 		}
 
-		// recurse down the children, front side first
-		R_RecursiveWorldNode(node->children[0], planeBits, newDlights[0]);
-
-		// tail recurse
-		node = node->children[1];
-		dlightBits = newDlights[1];
-	} while (1);
-
-	{
-		// leaf node, so add mark surfaces
-		int c;
-		msurface_t *surf, **mark;
-
-		tr.pc.c_leafs++;
-
-		// add to z buffer bounds
-		if (node->mins[0] < tr.viewParms.visBounds[0][0]) {
-			tr.viewParms.visBounds[0][0] = node->mins[0];
-		}
-		if (node->mins[1] < tr.viewParms.visBounds[0][1]) {
-			tr.viewParms.visBounds[0][1] = node->mins[1];
-		}
-		if (node->mins[2] < tr.viewParms.visBounds[0][2]) {
-			tr.viewParms.visBounds[0][2] = node->mins[2];
-		}
-
-		if (node->maxs[0] > tr.viewParms.visBounds[1][0]) {
-			tr.viewParms.visBounds[1][0] = node->maxs[0];
-		}
-		if (node->maxs[1] > tr.viewParms.visBounds[1][1]) {
-			tr.viewParms.visBounds[1][1] = node->maxs[1];
-		}
-		if (node->maxs[2] > tr.viewParms.visBounds[1][2]) {
-			tr.viewParms.visBounds[1][2] = node->maxs[2];
-		}
-
-		// add the individual surfaces
-		mark = node->firstmarksurface;
-		c = node->nummarksurfaces;
-		while (c--) {
-			// the surface may have already been added if it
-			// spans multiple leafs
-			surf = *mark;
-			R_AddWorldSurface(surf, dlightBits);
-			mark++;
-		}
+		i++;
 	}
 }
 
@@ -520,6 +578,11 @@ qboolean RE_inPVS(const vec3_t p1, const vec3_t p2) {
 	unsigned char *vis = ri.CM_ClusterPVS(leaf->cluster);
 	leaf = R_PointInLeaf(p2);
 
+	// a point in solid has no cluster, don't cull it
+	if (leaf->cluster < 0) {
+		return qtrue;
+	}
+
 	if (!(vis[leaf->cluster >> 3] & (1 << (leaf->cluster & 7)))) {
 		return qfalse;
 	}
@@ -531,14 +594,15 @@ qboolean RE_inPVS(const vec3_t p1, const vec3_t p2) {
 R_MarkLeaves
 
 Mark the leaves and nodes that are in the PVS for the current
-cluster
+cluster and build its visible node list
 ===============
 */
 static void R_MarkLeaves(void) {
 	const byte *vis;
 	mnode_t *leaf, *parent;
+	visList_t *list;
 	int i;
-	int cluster;
+	int cluster, key, count;
 
 	// lockpvs lets designers walk around to determine the
 	// extent of the current pvs
@@ -554,7 +618,7 @@ static void R_MarkLeaves(void) {
 	// hasn't changed, we don't need to mark everything again
 
 	// if r_showcluster was just turned on, remark everything
-	if (tr.viewCluster == cluster && !tr.refdef.AreamaskModified && !r_showcluster->modified) {
+	if (visList && tr.viewCluster == cluster && !tr.refdef.AreamaskModified && !r_showcluster->modified) {
 		return;
 	}
 
@@ -565,44 +629,78 @@ static void R_MarkLeaves(void) {
 		}
 	}
 
-	tr.visCount++;
 	tr.viewCluster = cluster;
+	key = r_novis->integer ? -1 : cluster;
+
+	// reuse the list if this cluster was seen recently
+	list = &visLists[0];
+	for (i = 0; i < MAX_VIS_LISTS; i++) {
+		if (visLists[i].nodes && visLists[i].cluster == key &&
+			!memcmp(visLists[i].areamask, tr.refdef.rd.areamask, sizeof(tr.refdef.rd.areamask))) {
+			visList = &visLists[i];
+			visList->lastUsed = ++visListSequence;
+			return;
+		}
+		if (!visLists[i].nodes || (list->nodes && visLists[i].lastUsed < list->lastUsed)) {
+			list = &visLists[i];
+		}
+	}
 
-	if (r_novis->integer || tr.viewCluster == -1) {
+	tr.visCount++;
+
+	if (key == -1) {
 		for (i = 0; i < tr.world->numnodes; i++) {
 			if (tr.world->nodes[i].contents != CONTENTS_SOLID) {
 				tr.world->nodes[i].visframe = tr.visCount;
 			}
 		}
-		return;
-	}
+	} else {
+		vis = R_ClusterPVS(key);
 
-	vis = R_ClusterPVS(tr.viewCluster);
+		for (i = 0, leaf = tr.world->nodes; i < tr.world->numnodes; i++, leaf++) {
+			cluster = leaf->cluster;
+			if (cluster < 0 || cluster >= tr.world->numClusters) {
+				continue;
+			}
 
-	for (i = 0, leaf = tr.world->nodes; i < tr.world->numnodes; i++, leaf++) {
-		cluster = leaf->cluster;
-		if (cluster < 0 || cluster >= tr.world->numClusters) {
-			continue;
-		}
+			// check general pvs
+			if (!(vis[cluster >> 3] & (1 << (cluster & 7)))) {
+				continue;
+			}
 
-		// check general pvs
-		if (!(vis[cluster >> 3] & (1 << (cluster & 7)))) {
-			continue;
+			// check for door connection
+			if ((tr.refdef.rd.areamask[leaf->area >> 3] & (1 << (leaf->area & 7)))) {
+				continue; // not visible
+			}
+
+			parent = leaf;
+			do {
+				if (parent->visframe == tr.visCount)
+					break;
+				parent->visframe = tr.visCount;
+				parent = parent->parent;
+			} while (parent);
 		}
+	}
 
-		// check for door connection
-		if ((tr.refdef.rd.areamask[leaf->area >> 3] & (1 << (leaf->area & 7)))) {
-			continue; // not visible
+	// replace the least recently used list
+	for (i = 0, count = 0; i < tr.world->numnodes; i++) {
+		if (tr.world->nodes[i].visframe == tr.visCount) {
+			count++;
 		}
+	}
 
-		parent = leaf;
-		do {
-			if (parent->visframe == tr.visCount)
-				break;
-			parent->visframe = tr.visCount;
-			parent = parent->parent;
-		} while (parent);
+	if (list->nodes) {
+		ri.Free(list->nodes);
 	}
+	list->nodes = ri.Malloc(MAX(count, 1) * sizeof(*list->nodes));
+	list->numNodes = 0;
+	list->cluster = key;
+	Com_Memcpy(list->areamask, tr.refdef.rd.areamask, sizeof(list->areamask));
+	list->lastUsed = ++visListSequence;
+
+	R_AddVisNode(list, tr.world->nodes, -1, 0);
+	visList = list;
 }
 
 /*
@@ -632,5 +730,7 @@ void R_AddWorldSurfaces(void) {
 	if (tr.refdef.num_dlights > 32) {
 		tr.refdef.num_dlights = 32;
 	}
-	R_RecursiveWorldNode(tr.world->nodes, 15, (1 << tr.refdef.num_dlights) - 1);
+	if (visList) {
+		R_WorldNodes(visList, (1 << tr.refdef.num_dlights) - 1);
+	}
 }
@@ -1,7 +1,9 @@
 #include "vk_frame.h"
 #include "tr_cvar.h"
 #include "tr_local.h"
+#include "vk_image.h"
 #include "vk_instance.h"
+#include "vk_screenshot.h"
 #include "vk_shade_geometry.h"
 #include "vk_swapchain.h"
 
@@ -52,9 +54,22 @@
 //
 //
 
-VkSemaphore sema_imageAvailable;
-VkSemaphore sema_renderFinished;
-VkFence fence_renderFinished;
+// one set for each frame in flight, indexed by vk.cur_frame
+VkSemaphore sema_imageAvailable[MAX_FRAMES_IN_FLIGHT];
+VkSemaphore sema_renderFinished[MAX_FRAMES_IN_FLIGHT];
+VkFence fence_renderFinished[MAX_FRAMES_IN_FLIGHT];
+
+// each frame in flight owns GPUTIMER_STAMPS timestamps of the pool,
+// starting at cur_frame * GPUTIMER_STAMPS; stamp i opens phase i and
+// the next stamp closes it
+#define GPUTIMER_STAMPS 32
+
+static VkQueryPool gpuTimerPool;
+static uint32_t gpuTimerStamps[MAX_FRAMES_IN_FLIGHT];
+static vkGpuTimerPhase_t gpuTimerPhases[MAX_FRAMES_IN_FLIGHT][GPUTIMER_STAMPS];
+static int gpuTimerPhase = -1;
+static float gpuTimerMsec[VK_GPUTIMER_COUNT];
+static VkBool32 gpuTimerFresh;
 
 /*
    Use of a presentable image must occur only after the image is
@@ -83,6 +98,7 @@ VkFence fence_renderFinished;
 void vk_create_sync_primitives(void) {
 	VkSemaphoreCreateInfo desc;
 	VkFenceCreateInfo fence_desc;
+	uint32_t i;
 
 	desc.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
 	desc.pNext = NULL;
@@ -96,8 +112,10 @@ void vk_create_sync_primitives(void) {
 	// &desc is a pointer to an instance of the VkSemaphoreCreateInfo structure
 	// which contains information about how the semaphore is to be created.
 	// When created, the semaphore is in the unsignaled state.
-	VK_CHECK(qvkCreateSemaphore(vk.device, &desc, NULL, &sema_imageAvailable));
-	VK_CHECK(qvkCreateSemaphore(vk.device, &desc, NULL, &sema_renderFinished));
+	for (i = 0; i < vk.num_frames; i++) {
+		VK_CHECK(qvkCreateSemaphore(vk.device, &desc, NULL, &sema_imageAvailable[i]));
+		VK_CHECK(qvkCreateSemaphore(vk.device, &desc, NULL, &sema_renderFinished[i]));
+	}
 
 	fence_desc.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
 	fence_desc.pNext = NULL;
@@ -115,17 +133,108 @@ void vk_create_sync_primitives(void) {
 	// "fence_renderFinished" is a handle in which the resulting
 	// fence object is returned.
 
-	VK_CHECK(qvkCreateFence(vk.device, &fence_desc, NULL, &fence_renderFinished));
+	for (i = 0; i < vk.num_frames; i++) {
+		VK_CHECK(qvkCreateFence(vk.device, &fence_desc, NULL, &fence_renderFinished[i]));
+	}
+
+	// the timestamps belong to the frames in flight as well
+	if (vk.timestampsSupported) {
+		VkQueryPoolCreateInfo query_desc;
+
+		query_desc.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+		query_desc.pNext = NULL;
+		query_desc.flags = 0;
+		query_desc.queryType = VK_QUERY_TYPE_TIMESTAMP;
+		query_desc.queryCount = vk.num_frames * GPUTIMER_STAMPS;
+		query_desc.pipelineStatistics = 0;
+
+		VK_CHECK(qvkCreateQueryPool(vk.device, &query_desc, NULL, &gpuTimerPool));
+	}
+	memset(gpuTimerStamps, 0, sizeof(gpuTimerStamps));
+	gpuTimerPhase = -1;
 }
 
 void vk_destroy_sync_primitives(void) {
+	uint32_t i;
+
 	ri.Printf(PRINT_ALL, " Destroy sema_imageAvailable sema_renderFinished fence_renderFinished\n");
 
-	qvkDestroySemaphore(vk.device, sema_imageAvailable, NULL);
-	qvkDestroySemaphore(vk.device, sema_renderFinished, NULL);
+	for (i = 0; i < vk.num_frames; i++) {
+		qvkDestroySemaphore(vk.device, sema_imageAvailable[i], NULL);
+		qvkDestroySemaphore(vk.device, sema_renderFinished[i], NULL);
+
+		// To destroy a fence,
+		qvkDestroyFence(vk.device, fence_renderFinished[i], NULL);
+	}
+
+	if (gpuTimerPool != VK_NULL_HANDLE) {
+		qvkDestroyQueryPool(vk.device, gpuTimerPool, NULL);
+		gpuTimerPool = VK_NULL_HANDLE;
+	}
+}
+
+/*
+   Everything the GPU runs until the next phase change is timed as this
+   phase. The stamps are written at the bottom of the pipe, so a stamp
+   lands once all the work recorded before it has finished.
+*/
+void vk_gpuTimerPhase(vkGpuTimerPhase_t phase) {
+	uint32_t *stamps = &gpuTimerStamps[vk.cur_frame];
+
+	if (phase == gpuTimerPhase || gpuTimerPool == VK_NULL_HANDLE || !r_gpuTimers->integer) {
+		return;
+	}
+
+	// the last stamp is kept for the end of the frame
+	if (*stamps >= GPUTIMER_STAMPS - 1) {
+		return;
+	}
+
+	gpuTimerPhases[vk.cur_frame][*stamps] = phase;
+	qvkCmdWriteTimestamp(vk.command_buffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, gpuTimerPool,
+						 vk.cur_frame * GPUTIMER_STAMPS + *stamps);
+	(*stamps)++;
+	gpuTimerPhase = phase;
+}
+
+/*
+   Copies the newest timings into msec and returns whether they changed
+   since the last call.
+*/
+VkBool32 vk_gpuTimerResults(float msec[VK_GPUTIMER_COUNT]) {
+	VkBool32 fresh = gpuTimerFresh;
+
+	memcpy(msec, gpuTimerMsec, sizeof(gpuTimerMsec));
+	gpuTimerFresh = VK_FALSE;
 
-	// To destroy a fence,
-	qvkDestroyFence(vk.device, fence_renderFinished, NULL);
+	return fresh;
+}
+
+/*
+   Reads back the timestamps of the frame that last used this slot. Its
+   fence has just been waited on, so they are available without a stall.
+*/
+static void vk_readGpuTimers(void) {
+	uint64_t stamps[GPUTIMER_STAMPS];
+	const uint32_t count = gpuTimerStamps[vk.cur_frame];
+	uint32_t i;
+
+	gpuTimerStamps[vk.cur_frame] = 0;
+
+	if (count < 2) {
+		return;
+	}
+
+	if (qvkGetQueryPoolResults(vk.device, gpuTimerPool, vk.cur_frame * GPUTIMER_STAMPS, count, sizeof(stamps), stamps,
+							   sizeof(uint64_t), VK_QUERY_RESULT_64_BIT) != VK_SUCCESS) {
+		return;
+	}
+
+	memset(gpuTimerMsec, 0, sizeof(gpuTimerMsec));
+	for (i = 0; i < count - 1; i++) {
+		gpuTimerMsec[gpuTimerPhases[vk.cur_frame][i]] += (stamps[i + 1] - stamps[i]) * vk.timestampPeriod / 1000000.0f;
+	}
+	gpuTimerFresh = VK_TRUE;
 }
 
 //  NOTE: Render Pass Compatibility
@@ -156,6 +265,7 @@ static void vk_createRenderPass(VkDevice device) {
 	VkAttachmentReference color_attachment_ref;
 	VkAttachmentReference depth_attachment_ref;
 	VkSubpassDescription subpass;
+	VkSubpassDependency dependency;
 	VkRenderPassCreateInfo desc;
 
 	// Before we can finish creating the pipeline, we need to tell vulkan
@@ -237,8 +347,23 @@ static void vk_createRenderPass(VkDevice device) {
 	// subpasses. Operations right before and right after this subpass also
 	// count as inplicit "subpasses".
 
-	desc.dependencyCount = 0;
-	desc.pDependencies = NULL;
+	// With several frames in flight the next frame's render pass can start
+	// while the previous one is still running: order the depth clear after
+	// the previous frame's depth tests and the color writes after the
+	// swapchain image is acquired.
+	dependency.srcSubpass = VK_SUBPASS_EXTERNAL;
+	dependency.dstSubpass = 0;
+	dependency.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT |
+							  VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+	dependency.dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT |
+							  VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+	dependency.srcAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+	dependency.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT |
+							   VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+	dependency.dependencyFlags = 0;
+
+	desc.dependencyCount = 1;
+	desc.pDependencies = &dependency;
 
 	VK_CHECK(qvkCreateRenderPass(device, &desc, NULL, &vk.render_pass));
 }
@@ -423,11 +548,6 @@ void vk_begin_frame(void) {
 	// that image If timeout is UINT64_MAX, the timeout period is treated as infinite,
 	// and vkAcquireNextImageKHR will block until an image is acquired or an error occurs.
 
-	// An application must wait until either the semaphore or fence is signaled
-	// before accessing the image's data.
-	VK_CHECK(qvkAcquireNextImageKHR(vk.device, vk.swapchain, UINT64_MAX, sema_imageAvailable, VK_NULL_HANDLE,
-									&vk.idx_swapchain_image));
-
 	//  User could call method vkWaitForFences to wait for completion. A fence is a
 	//  very heavyweight synchronization primitive as it requires the GPU to flush
 	//  all caches at least, and potentially some additional synchronization. Due to
@@ -440,12 +560,26 @@ void vk_begin_frame(void) {
 	//  the time vkWaitForFences is called, then vkWaitForFences will block and
 	//  wait up to timeout nanoseconds for the condition to become satisfied.
 
-	VK_CHECK(qvkWaitForFences(vk.device, 1, &fence_renderFinished, VK_FALSE, 1e9));
+	//  Only the frame that last used this slot has to be finished, the
+	//  other frames in flight keep the GPU busy meanwhile.
+	VK_CHECK(qvkWaitForFences(vk.device, 1, &fence_renderFinished[vk.cur_frame], VK_FALSE, 1e9));
 
 	//  To set the state of fences to unsignaled from the host
 	//  "1" is the number of fences to reset.
 	//  "fence_renderFinished" is the fence handle to reset.
-	VK_CHECK(qvkResetFences(vk.device, 1, &fence_renderFinished));
+	VK_CHECK(qvkResetFences(vk.device, 1, &fence_renderFinished[vk.cur_frame]));
+
+	vk_readGpuTimers();
+	vk_readCaptures();
+
+	// the slot's command buffer and stream buffers are free again
+	vk.command_buffer = vk.frame_command_buffers[vk.cur_frame];
+	vk_resetGeometryBuffer();
+
+	// An application must wait until either the semaphore or fence is signaled
+	// before accessing the image's data.
+	VK_CHECK(qvkAcquireNextImageKHR(vk.device, vk.swapchain, UINT64_MAX, sema_imageAvailable[vk.cur_frame],
+									VK_NULL_HANDLE, &vk.idx_swapchain_image));
 
 	//  commandBuffer must not be in the recording or pending state.
 
@@ -464,6 +598,11 @@ void vk_begin_frame(void) {
 	// To begin recording a command buffer
 	VK_CHECK(qvkBeginCommandBuffer(vk.command_buffer, &begin_info));
 
+	// queries have to be reset outside of a render pass before reuse
+	if (gpuTimerPool != VK_NULL_HANDLE) {
+		qvkCmdResetQueryPool(vk.command_buffer, gpuTimerPool, vk.cur_frame * GPUTIMER_STAMPS, GPUTIMER_STAMPS);
+	}
+
 	// Ensure visibility of geometry buffers writes.
 
 	{
@@ -530,22 +669,35 @@ void vk_end_frame(void) {
 	VkPresentInfoKHR present_info;
 	VkResult result;
 
+	// close the last phase
+	if (gpuTimerStamps[vk.cur_frame]) {
+		qvkCmdWriteTimestamp(vk.command_buffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, gpuTimerPool,
+							 vk.cur_frame * GPUTIMER_STAMPS + gpuTimerStamps[vk.cur_frame]);
+		gpuTimerStamps[vk.cur_frame]++;
+	}
+	gpuTimerPhase = -1;
+
 	qvkCmdEndRenderPass(vk.command_buffer);
 
+	// screenshot or video frame asked for during this frame
+	vk_recordCapture();
+
 	VK_CHECK(qvkEndCommandBuffer(vk.command_buffer));
 
+	vk_flushImageUploads(VK_FALSE);
+
 	// Queue submission and synchronization
 	submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
 	submit_info.pNext = NULL;
 	submit_info.waitSemaphoreCount = 1;
-	submit_info.pWaitSemaphores = &sema_imageAvailable;
+	submit_info.pWaitSemaphores = &sema_imageAvailable[vk.cur_frame];
 	submit_info.pWaitDstStageMask = &wait_dst_stage_mask;
 	submit_info.commandBufferCount = 1;
 	submit_info.pCommandBuffers = &vk.command_buffer;
 	submit_info.signalSemaphoreCount = 1;
 	// specify which semaphones to signal once the command buffers
 	// have finished execution
-	submit_info.pSignalSemaphores = &sema_renderFinished;
+	submit_info.pSignalSemaphores = &sema_renderFinished[vk.cur_frame];
 
 	//  queue is the queue that the command buffers will be submitted to.
 	//  1 is the number of elements in the pSubmits array.
@@ -585,12 +737,12 @@ void vk_end_frame(void) {
 
 	//  To submit command buffers to a queue
 
-	VK_CHECK(qvkQueueSubmit(vk.queue, 1, &submit_info, fence_renderFinished));
+	VK_CHECK(qvkQueueSubmit(vk.queue, 1, &submit_info, fence_renderFinished[vk.cur_frame]));
 
 	present_info.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
 	present_info.pNext = NULL;
 	present_info.waitSemaphoreCount = 1;
-	present_info.pWaitSemaphores = &sema_renderFinished;
+	present_info.pWaitSemaphores = &sema_renderFinished[vk.cur_frame];
 
 	// specify the swap chains to present images to
 	present_info.swapchainCount = 1;
@@ -609,6 +761,9 @@ void vk_end_frame(void) {
 	// queue is a queue that is capable of presentation to the target
 	// surface's platform on the same device as the image's swapchain.
 	result = qvkQueuePresentKHR(vk.queue, &present_info);
+
+	vk.cur_frame = (vk.cur_frame + 1) % vk.num_frames;
+
 	if (result == VK_SUCCESS) {
 		return;
 	}
@@ -6,6 +6,11 @@
 void vk_begin_frame(void);
 void vk_end_frame(void);
 
+typedef enum { VK_GPUTIMER_3D, VK_GPUTIMER_2D, VK_GPUTIMER_COUNT } vkGpuTimerPhase_t;
+
+void vk_gpuTimerPhase(vkGpuTimerPhase_t phase);
+VkBool32 vk_gpuTimerResults(float msec[VK_GPUTIMER_COUNT]);
+
 void vk_createFrameBuffers(uint32_t w, uint32_t h);
 void vk_destroyFrameBuffers(void);
 
@@ -7,9 +7,16 @@
 #include "vk_cmd.h"
 #include "vk_image_sampler.h"
 #include "vk_instance.h"
+#include "vk_shade_geometry.h"
 
 #define IMAGE_CHUNK_SIZE (64 * 1024 * 1024)
+#define STAGING_BUFFER_SIZE (16 * 1024 * 1024)
+#define STAGING_ALIGN 16
 
+// Image uploads are copied into one persistently mapped staging buffer and
+// recorded into a shared command buffer. The batch is submitted once the
+// staging buffer fills up or a frame is submitted, so loading a map no longer
+// costs a queue submit and wait for every texture.
 struct StagingBuffer_t {
 	// Vulkan supports two primary resource types: buffers and images.
 	// Resources are views of memory with associated formatting and dimensionality.
@@ -22,6 +29,16 @@ struct StagingBuffer_t {
 	VkBuffer buff;
 	// Host visible memory used to copy image data to device local memory.
 	VkDeviceMemory mappableMem;
+	unsigned char *pMapped;
+	uint32_t size;
+	// bytes used by the batch being recorded
+	uint32_t offset;
+
+	// batch being recorded, VK_NULL_HANDLE when there is none
+	VkCommandBuffer cmd_buf;
+	// batch submitted but not yet known to be finished
+	VkCommandBuffer pending_cmd_buf;
+	VkFence fence;
 };
 
 struct ImageChunk_t {
@@ -38,6 +55,8 @@ struct deviceLocalMemory_t {
 
 static struct StagingBuffer_t StagBuf;
 static struct deviceLocalMemory_t devMemImg;
+// R8G8B8A8 images can be blitted with linear filtering
+static VkBool32 s_blitMipMaps;
 
 void gpuMemUsageInfo_f(void) {
 	// approm	 for debug info
@@ -61,10 +80,11 @@ uint32_t find_memory_type(uint32_t memory_type_bits, VkMemoryPropertyFlags prope
 }
 
 static void vk_createStagingBuffer(uint32_t size) {
-	memset(&StagBuf, 0, sizeof(StagBuf));
-
 	ri.Printf(PRINT_DEVELOPER, " Create Staging Buffer: %d\n", size);
 
+	StagBuf.size = size;
+	StagBuf.offset = 0;
+
 	{
 		VkBufferCreateInfo buffer_desc;
 		buffer_desc.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
@@ -98,6 +118,7 @@ static void vk_createStagingBuffer(uint32_t size) {
 	{
 		VkMemoryRequirements memory_requirements;
 		VkMemoryAllocateInfo alloc_info;
+		void *data;
 
 		qvkGetBufferMemoryRequirements(vk.device, StagBuf.buff, &memory_requirements);
 
@@ -112,6 +133,9 @@ static void vk_createStagingBuffer(uint32_t size) {
 
 		VK_CHECK(qvkBindBufferMemory(vk.device, StagBuf.buff, StagBuf.mappableMem, 0));
 
+		VK_CHECK(qvkMapMemory(vk.device, StagBuf.mappableMem, 0, VK_WHOLE_SIZE, 0, &data));
+		StagBuf.pMapped = (unsigned char *)data;
+
 		ri.Printf(PRINT_DEVELOPER, " Stagging buffer alignment: %ld, memoryTypeBits: 0x%x, Type Index: %d. \n",
 				  memory_requirements.alignment, memory_requirements.memoryTypeBits, alloc_info.memoryTypeIndex);
 	}
@@ -126,95 +150,218 @@ static void vk_destroy_staging_buffer(void) {
 	}
 
 	if (StagBuf.mappableMem != VK_NULL_HANDLE) {
+		qvkUnmapMemory(vk.device, StagBuf.mappableMem);
 		qvkFreeMemory(vk.device, StagBuf.mappableMem, NULL);
 		StagBuf.mappableMem = VK_NULL_HANDLE;
 	}
 
-	memset(&StagBuf, 0, sizeof(StagBuf));
+	StagBuf.pMapped = NULL;
+	StagBuf.size = 0;
+	StagBuf.offset = 0;
 }
 
-static void vk_stagBufferToDeviceLocalMem(VkImage image, VkBufferImageCopy *pRegion, uint32_t num_region) {
-	// An application can copy buffer and image data using several methods
-	// depending on the type of data transfer. Data can be copied between
-	// buffer objects with vkCmdCopyBuffer and a portion of an image can
-	// be copied to another image with vkCmdCopyImage.
-	//
-	// Image data can also be copied to and from buffer memory using
-	// vkCmdCopyImageToBuffer and vkCmdCopyBufferToImage.
-	//
-	// Image data can be blitted (with or without scaling and filtering)
-	// with vkCmdBlitImage. Multisampled images can be resolved to a
-	// non-multisampled image with vkCmdResolveImage.
-	//
-	VkCommandBuffer cmd_buf;
-	VkBufferMemoryBarrier barrier;
-	VkSubmitInfo submit_info;
+// Waits for the last submitted batch, after which the whole
+// staging buffer can be written again.
+static void vk_waitImageUploads(void) {
+	if (StagBuf.pending_cmd_buf == VK_NULL_HANDLE) {
+		return;
+	}
 
-	{
+	VK_CHECK(qvkWaitForFences(vk.device, 1, &StagBuf.fence, VK_TRUE, UINT64_MAX));
+	VK_CHECK(qvkResetFences(vk.device, 1, &StagBuf.fence));
+
+	qvkFreeCommandBuffers(vk.device, vk.command_pool, 1, &StagBuf.pending_cmd_buf);
+	StagBuf.pending_cmd_buf = VK_NULL_HANDLE;
+	StagBuf.offset = 0;
+}
+
+void vk_flushImageUploads(VkBool32 wait) {
+	if (StagBuf.cmd_buf != VK_NULL_HANDLE) {
+		VkSubmitInfo submit_info;
+
+		VK_CHECK(qvkEndCommandBuffer(StagBuf.cmd_buf));
+
+		submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+		submit_info.pNext = NULL;
+		submit_info.waitSemaphoreCount = 0;
+		submit_info.pWaitSemaphores = NULL;
+		submit_info.pWaitDstStageMask = NULL;
+		submit_info.commandBufferCount = 1;
+		submit_info.pCommandBuffers = &StagBuf.cmd_buf;
+		submit_info.signalSemaphoreCount = 0;
+		submit_info.pSignalSemaphores = NULL;
+
+		// Submitted on the graphics queue ahead of the frame that samples
+		// the images, so the layout transitions recorded below order the
+		// copies against both earlier and later frames.
+		VK_CHECK(qvkQueueSubmit(vk.queue, 1, &submit_info, StagBuf.fence));
+
+		StagBuf.pending_cmd_buf = StagBuf.cmd_buf;
+		StagBuf.cmd_buf = VK_NULL_HANDLE;
+	}
+
+	if (wait) {
+		vk_waitImageUploads();
+	}
+}
+
+// Reserves size bytes of staging memory in the current batch,
+// starting a new batch if needed.
+static uint32_t vk_beginImageUpload(uint32_t size) {
+	uint32_t offset;
+
+	if (StagBuf.cmd_buf != VK_NULL_HANDLE && StagBuf.offset + size > StagBuf.size) {
+		vk_flushImageUploads(VK_TRUE);
+	}
+
+	if (StagBuf.cmd_buf == VK_NULL_HANDLE) {
 		VkCommandBufferAllocateInfo alloc_info;
 		VkCommandBufferBeginInfo begin_info;
 
+		vk_waitImageUploads();
+
+		if (size > StagBuf.size) {
+			vk_destroy_staging_buffer();
+			vk_createStagingBuffer(PAD(size, STAGING_BUFFER_SIZE));
+		}
+
 		alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
 		alloc_info.pNext = NULL;
 		alloc_info.commandPool = vk.command_pool;
 		alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
 		alloc_info.commandBufferCount = 1;
-		VK_CHECK(qvkAllocateCommandBuffers(vk.device, &alloc_info, &cmd_buf));
+		VK_CHECK(qvkAllocateCommandBuffers(vk.device, &alloc_info, &StagBuf.cmd_buf));
 
 		begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
 		begin_info.pNext = NULL;
 		begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
 		begin_info.pInheritanceInfo = NULL;
-		VK_CHECK(qvkBeginCommandBuffer(cmd_buf, &begin_info));
+		VK_CHECK(qvkBeginCommandBuffer(StagBuf.cmd_buf, &begin_info));
 	}
 
-	barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+	offset = StagBuf.offset;
+	StagBuf.offset = PAD(offset + size, STAGING_ALIGN);
+
+	return offset;
+}
+
+static void vk_recordMipBarrier(VkImage image, uint32_t baseLevel, uint32_t levelCount, VkAccessFlags src_access_flags,
+								VkImageLayout old_layout, VkAccessFlags dst_access_flags, VkImageLayout new_layout) {
+	VkImageMemoryBarrier barrier;
+
+	barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
 	barrier.pNext = NULL;
-	barrier.srcAccessMask = VK_ACCESS_HOST_WRITE_BIT;
-	barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+	barrier.srcAccessMask = src_access_flags;
+	barrier.dstAccessMask = dst_access_flags;
+	barrier.oldLayout = old_layout;
+	barrier.newLayout = new_layout;
 	barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
 	barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-	barrier.buffer = StagBuf.buff;
-	barrier.offset = 0;
-	barrier.size = VK_WHOLE_SIZE;
+	barrier.image = image;
+	barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+	barrier.subresourceRange.baseMipLevel = baseLevel;
+	barrier.subresourceRange.levelCount = levelCount;
+	barrier.subresourceRange.baseArrayLayer = 0;
+	barrier.subresourceRange.layerCount = 1;
+
+	qvkCmdPipelineBarrier(StagBuf.cmd_buf, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 0,
+						  NULL, 0, NULL, 1, &barrier);
+}
+
+// Fills the mip levels below the uploaded base level by
+// repeatedly halving the previous level with a linear blit.
+static void vk_recordMipMapBlits(const image_t *pImage) {
+	int32_t width = pImage->uploadWidth;
+	int32_t height = pImage->uploadHeight;
+	uint32_t i;
+
+	for (i = 1; i < pImage->mipLevels; i++) {
+		VkImageBlit blit;
+
+		vk_recordMipBarrier(pImage->handle, i - 1, 1, VK_ACCESS_TRANSFER_WRITE_BIT, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+							VK_ACCESS_TRANSFER_READ_BIT, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+
+		memset(&blit, 0, sizeof(blit));
+		blit.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		blit.srcSubresource.mipLevel = i - 1;
+		blit.srcSubresource.layerCount = 1;
+		blit.srcOffsets[1].x = width;
+		blit.srcOffsets[1].y = height;
+		blit.srcOffsets[1].z = 1;
+
+		width = MAX(width >> 1, 1);
+		height = MAX(height >> 1, 1);
+
+		blit.dstSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		blit.dstSubresource.mipLevel = i;
+		blit.dstSubresource.layerCount = 1;
+		blit.dstOffsets[1].x = width;
+		blit.dstOffsets[1].y = height;
+		blit.dstOffsets[1].z = 1;
 
-	qvkCmdPipelineBarrier(cmd_buf, VK_PIPELINE_STAGE_HOST_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, NULL, 1, &barrier,
-						  0, NULL);
+		qvkCmdBlitImage(StagBuf.cmd_buf, pImage->handle, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, pImage->handle,
+						VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &blit, VK_FILTER_LINEAR);
+	}
 
-	record_image_layout_transition(cmd_buf, image, VK_IMAGE_ASPECT_COLOR_BIT, 0, VK_IMAGE_LAYOUT_UNDEFINED,
-								   VK_ACCESS_TRANSFER_WRITE_BIT, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+	vk_recordMipBarrier(pImage->handle, 0, pImage->mipLevels - 1, VK_ACCESS_TRANSFER_READ_BIT,
+						VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_ACCESS_SHADER_READ_BIT,
+						VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+	vk_recordMipBarrier(pImage->handle, pImage->mipLevels - 1, 1, VK_ACCESS_TRANSFER_WRITE_BIT,
+						VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_ACCESS_SHADER_READ_BIT,
+						VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+}
+
+// Records the copy of pic into pImage. The regions' buffer offsets are relative
+// to pic; when genMipMaps is set only the base level is copied and the
+// rest are blitted from it on the GPU.
+static void vk_uploadImage(const image_t *pImage, const unsigned char *pic, uint32_t size, VkBufferImageCopy *pRegion,
+						   uint32_t num_region, VkBool32 genMipMaps) {
+	// An application can copy buffer and image data using several methods
+	// depending on the type of data transfer. Data can be copied between
+	// buffer objects with vkCmdCopyBuffer and a portion of an image can
+	// be copied to another image with vkCmdCopyImage.
+	//
+	// Image data can also be copied to and from buffer memory using
+	// vkCmdCopyImageToBuffer and vkCmdCopyBufferToImage.
+	//
+	// Image data can be blitted (with or without scaling and filtering)
+	// with vkCmdBlitImage. Multisampled images can be resolved to a
+	// non-multisampled image with vkCmdResolveImage.
+	//
+	const uint32_t offset = vk_beginImageUpload(size);
+	uint32_t i;
+
+	memcpy(StagBuf.pMapped + offset, pic, size);
+
+	for (i = 0; i < num_region; i++) {
+		pRegion[i].bufferOffset += offset;
+	}
+
+	// Host writes made before vkQueueSubmit are visible to the
+	// device, so only the image layouts need barriers.
+	record_image_layout_transition(StagBuf.cmd_buf, pImage->handle, VK_IMAGE_ASPECT_COLOR_BIT, 0,
+								   VK_IMAGE_LAYOUT_UNDEFINED, VK_ACCESS_TRANSFER_WRITE_BIT,
+								   VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
 
 	// To copy data from a buffer object to an image object
 
-	// cmd_buf is the command buffer into which the command will be recorded.
+	// StagBuf.cmd_buf is the command buffer into which the command will be recorded.
 	// StagBuf.buff is the source buffer.
 	// image is the destination image.
 	// dstImageLayout is the layout of the destination image subresources.
-	// curLevel is the number of regions to copy.
+	// num_region is the number of regions to copy.
 	// pRegions is a pointer to an array of VkBufferImageCopy structures
 	// specifying the regions to copy.
-	qvkCmdCopyBufferToImage(cmd_buf, StagBuf.buff, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, num_region, pRegion);
+	qvkCmdCopyBufferToImage(StagBuf.cmd_buf, StagBuf.buff, pImage->handle, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+							num_region, pRegion);
 
-	record_image_layout_transition(cmd_buf, image, VK_IMAGE_ASPECT_COLOR_BIT, VK_ACCESS_TRANSFER_WRITE_BIT,
-								   VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_ACCESS_SHADER_READ_BIT,
-								   VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
-
-	VK_CHECK(qvkEndCommandBuffer(cmd_buf));
-
-	submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-	submit_info.pNext = NULL;
-	submit_info.waitSemaphoreCount = 0;
-	submit_info.pWaitSemaphores = NULL;
-	submit_info.pWaitDstStageMask = NULL;
-	submit_info.commandBufferCount = 1;
-	submit_info.pCommandBuffers = &cmd_buf;
-	submit_info.signalSemaphoreCount = 0;
-	submit_info.pSignalSemaphores = NULL;
-
-	VK_CHECK(qvkQueueSubmit(vk.queue, 1, &submit_info, VK_NULL_HANDLE));
-	VK_CHECK(qvkQueueWaitIdle(vk.queue));
-
-	qvkFreeCommandBuffers(vk.device, vk.command_pool, 1, &cmd_buf);
+	if (genMipMaps && pImage->mipLevels > 1) {
+		vk_recordMipMapBlits(pImage);
+	} else {
+		record_image_layout_transition(StagBuf.cmd_buf, pImage->handle, VK_IMAGE_ASPECT_COLOR_BIT,
+									   VK_ACCESS_TRANSFER_WRITE_BIT, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+									   VK_ACCESS_SHADER_READ_BIT, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+	}
 }
 
 #define FILE_HASH_SIZE 1024
@@ -254,7 +401,7 @@ static void vk_createImageAndBindWithMemory(image_t *pImg) {
 	desc.pNext = NULL;
 	desc.flags = 0;
 	desc.imageType = VK_IMAGE_TYPE_2D;
-	desc.format = VK_FORMAT_R8G8B8A8_UNORM;
+	desc.format = pImg->format;
 	desc.extent.width = pImg->uploadWidth;
 	desc.extent.height = pImg->uploadHeight;
 	desc.extent.depth = 1;
@@ -263,6 +410,10 @@ static void vk_createImageAndBindWithMemory(image_t *pImg) {
 	desc.samples = VK_SAMPLE_COUNT_1_BIT;
 	desc.tiling = VK_IMAGE_TILING_OPTIMAL;
 	desc.usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+	if (pImg->mipLevels > 1) {
+		// the mip levels may be blitted from the base level
+		desc.usage |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+	}
 	desc.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
 	desc.queueFamilyIndexCount = 0;
 	desc.pQueueFamilyIndices = NULL;
@@ -331,7 +482,7 @@ static void vk_createImageViewAndDescriptorSet(image_t *pImage) {
 	desc.viewType = VK_IMAGE_VIEW_TYPE_2D;
 	// format is a VkFormat describing the format and type used
 	// to interpret data elements in the image.
-	desc.format = VK_FORMAT_R8G8B8A8_UNORM;
+	desc.format = pImage->format;
 
 	// the components field allows you to swizzle the color channels around
 	desc.components.r = VK_COMPONENT_SWIZZLE_IDENTITY;
@@ -373,16 +524,22 @@ static void vk_createImageViewAndDescriptorSet(image_t *pImage) {
 	// we defined in the pipeline_layout sample.
 	// This layout describes how the descriptor set is to be allocated.
 
-	descSetAllocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
-	descSetAllocInfo.pNext = NULL;
-	descSetAllocInfo.descriptorPool = vk.descriptor_pool;
-	descSetAllocInfo.descriptorSetCount = 1;
-	descSetAllocInfo.pSetLayouts = &vk.set_layout;
+	// bindless: no set of its own, the image lives at pImage->index of vk.bindless_set
+	if (vk.bindless) {
+		desSet = vk.bindless_set;
+		pImage->descriptor_set = VK_NULL_HANDLE;
+	} else {
+		descSetAllocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+		descSetAllocInfo.pNext = NULL;
+		descSetAllocInfo.descriptorPool = vk.descriptor_pool;
+		descSetAllocInfo.descriptorSetCount = 1;
+		descSetAllocInfo.pSetLayouts = &vk.set_layout;
 
-	VK_CHECK(qvkAllocateDescriptorSets(vk.device, &descSetAllocInfo, &desSet));
+		VK_CHECK(qvkAllocateDescriptorSets(vk.device, &descSetAllocInfo, &desSet));
 
-	/////  save it for destroy and update current descriptor
-	pImage->descriptor_set = desSet;
+		/////  save it for destroy and update current descriptor
+		pImage->descriptor_set = desSet;
+	}
 
 	// ri.Printf(PRINT_ALL, " Allocate Descriptor Sets \n");
 	image_info.sampler = vk_find_sampler(pImage->mipmap, pImage->wrapClampMode == GL_REPEAT);
@@ -392,7 +549,7 @@ static void vk_createImageViewAndDescriptorSet(image_t *pImage) {
 	descriptor_write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
 	descriptor_write.dstSet = desSet;
 	descriptor_write.dstBinding = 0;
-	descriptor_write.dstArrayElement = 0;
+	descriptor_write.dstArrayElement = vk.bindless ? pImage->index : 0;
 	descriptor_write.descriptorCount = 1;
 	descriptor_write.pNext = NULL;
 	descriptor_write.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
@@ -412,16 +569,9 @@ static void vk_createImageViewAndDescriptorSet(image_t *pImage) {
 	// the size is the size of the MVP.
 }
 
-image_t *R_CreateImage(const char *name, unsigned char *pic, const uint32_t width, const uint32_t height,
-					   VkBool32 isMipMap, VkBool32 allowPicmip, int glWrapClampMode) {
+static image_t *R_AllocImage(const char *name, uint32_t width, uint32_t height, VkBool32 isMipMap,
+							 VkBool32 allowPicmip, int glWrapClampMode) {
 	image_t *pImage;
-	const unsigned int max_texture_size = 2048;
-	unsigned int scaled_width, scaled_height;
-	uint32_t buffer_size;
-	unsigned char *pUploadBuffer;
-	VkBufferImageCopy regions[12];
-	void *data;
-	int hash;
 
 	if (strlen(name) >= MAX_QPATH) {
 		ri.Error(ERR_DROP, "CreateImage: \"%s\" is too long\n", name);
@@ -435,6 +585,7 @@ image_t *R_CreateImage(const char *name, unsigned char *pic, const uint32_t widt
 
 	Q_strncpyz(pImage->imgName, name, sizeof(pImage->imgName));
 	pImage->index = tr.numImages;
+	pImage->format = VK_FORMAT_R8G8B8A8_UNORM;
 	pImage->mipmap = isMipMap;
 	pImage->mipLevels = 1;
 	pImage->allowPicmip = allowPicmip;
@@ -442,6 +593,32 @@ image_t *R_CreateImage(const char *name, unsigned char *pic, const uint32_t widt
 	pImage->width = width;
 	pImage->height = height;
 	pImage->isLightmap = (strncmp(name, "*lightmap", 9) == 0);
+
+	return pImage;
+}
+
+static void R_RegisterImage(image_t *pImage) {
+	const int hash = generateHashValue(pImage->imgName);
+
+	pImage->next = hashTable[hash];
+	hashTable[hash] = pImage;
+
+	tr.images[tr.numImages] = pImage;
+	if (++tr.numImages == MAX_DRAWIMAGES) {
+		ri.Error(ERR_DROP, "CreateImage: MAX_DRAWIMAGES hit\n");
+	}
+}
+
+image_t *R_CreateImage(const char *name, unsigned char *pic, const uint32_t width, const uint32_t height,
+					   VkBool32 isMipMap, VkBool32 allowPicmip, int glWrapClampMode) {
+	image_t *pImage = R_AllocImage(name, width, height, isMipMap, allowPicmip, glWrapClampMode);
+	const unsigned int max_texture_size = 2048;
+	unsigned int scaled_width, scaled_height;
+	uint32_t buffer_size;
+	unsigned char *pUploadBuffer;
+	VkBufferImageCopy regions[12];
+	VkBool32 gpuMipMaps;
+
 	// Create corresponding GPU resource, lightmaps are always allocated on TMU 1 .
 	// A texture mapping unit (TMU) is a component in modern graphics processing units (GPUs).
 	// Historically it was a separate physical processor. A TMU is able to rotate, resize,
@@ -518,7 +695,19 @@ image_t *R_CreateImage(const char *name, unsigned char *pic, const uint32_t widt
 	regions[0].imageExtent.height = pImage->uploadHeight;
 	regions[0].imageExtent.depth = 1;
 
-	if (isMipMap) {
+	// the blit filter matches R_MipMap, the other mip options stay on the CPU
+	gpuMipMaps = isMipMap && s_blitMipMaps && r_simpleMipMaps->integer && !r_colorMipLevels->integer;
+
+	if (gpuMipMaps) {
+		uint32_t size = MAX(scaled_width, scaled_height);
+
+		R_LightScaleTexture(pUploadBuffer, pUploadBuffer, buffer_size);
+
+		while (size > 1) {
+			size >>= 1;
+			pImage->mipLevels++;
+		}
+	} else if (isMipMap) {
 		uint32_t curMipMapLevel = 1;
 		uint32_t base_width = pImage->uploadWidth;
 		uint32_t base_height = pImage->uploadHeight;
@@ -590,23 +779,90 @@ image_t *R_CreateImage(const char *name, unsigned char *pic, const uint32_t widt
 	vk_createImageAndBindWithMemory(pImage);
 	vk_createImageViewAndDescriptorSet(pImage);
 
-	VK_CHECK(qvkMapMemory(vk.device, StagBuf.mappableMem, 0, VK_WHOLE_SIZE, 0, &data));
-	memcpy(data, pUploadBuffer, buffer_size);
-	qvkUnmapMemory(vk.device, StagBuf.mappableMem);
+	vk_uploadImage(pImage, pUploadBuffer, buffer_size, regions, gpuMipMaps ? 1 : pImage->mipLevels, gpuMipMaps);
 
 	ri.Hunk_FreeTempMemory(pUploadBuffer);
 
-	vk_stagBufferToDeviceLocalMem(pImage->handle, regions, pImage->mipLevels);
+	R_RegisterImage(pImage);
 
-	hash = generateHashValue(name);
-	pImage->next = hashTable[hash];
-	hashTable[hash] = pImage;
+	return pImage;
+}
 
-	tr.images[tr.numImages] = pImage;
-	if (++tr.numImages == MAX_DRAWIMAGES) {
-		ri.Error(ERR_DROP, "CreateImage: MAX_DRAWIMAGES hit\n");
+/*
+================
+Block compressed images are uploaded with the mip levels stored in the file,
+picmip drops the largest ones instead of resampling.
+================
+*/
+static image_t *R_CreateCompressedImage(const char *name, const unsigned char *pic, uint32_t size, uint32_t width,
+										uint32_t height, uint32_t numMips, VkFormat format, VkBool32 isMipMap,
+										VkBool32 allowPicmip, int glWrapClampMode) {
+	const uint32_t blockSize = (format == VK_FORMAT_BC1_RGBA_UNORM_BLOCK || format == VK_FORMAT_BC4_UNORM_BLOCK) ? 8 : 16;
+	VkBufferImageCopy regions[16];
+	uint32_t uploadWidth = width, uploadHeight = height;
+	uint32_t mipWidth, mipHeight;
+	uint32_t fullMips = 1, buffer_size = 0, level;
+	image_t *pImage;
+
+	while ((width >> fullMips) || (height >> fullMips)) {
+		fullMips++;
+	}
+
+	// without a full mip chain the image is not mipmapped, same as renderergl2
+	if (!isMipMap || numMips < fullMips) {
+		isMipMap = VK_FALSE;
+		numMips = 1;
+	}
+
+	for (level = allowPicmip ? r_picmip->integer : 0; level > 0 && numMips > 1; level--, numMips--) {
+		const uint32_t levelSize = ((uploadWidth + 3) / 4) * ((uploadHeight + 3) / 4) * blockSize;
+
+		if (levelSize > size) {
+			break;
+		}
+		pic += levelSize;
+		size -= levelSize;
+		uploadWidth = MAX(uploadWidth >> 1, 1);
+		uploadHeight = MAX(uploadHeight >> 1, 1);
+	}
+
+	numMips = MIN(numMips, ARRAY_LEN(regions));
+
+	mipWidth = uploadWidth;
+	mipHeight = uploadHeight;
+	for (level = 0; level < numMips; level++) {
+		memset(&regions[level], 0, sizeof(regions[level]));
+		regions[level].bufferOffset = buffer_size;
+		regions[level].imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		regions[level].imageSubresource.mipLevel = level;
+		regions[level].imageSubresource.layerCount = 1;
+		regions[level].imageExtent.width = mipWidth;
+		regions[level].imageExtent.height = mipHeight;
+		regions[level].imageExtent.depth = 1;
+
+		buffer_size += ((mipWidth + 3) / 4) * ((mipHeight + 3) / 4) * blockSize;
+		mipWidth = MAX(mipWidth >> 1, 1);
+		mipHeight = MAX(mipHeight >> 1, 1);
+	}
+
+	if (buffer_size > size) {
+		ri.Printf(PRINT_WARNING, "R_CreateCompressedImage: %s is truncated\n", name);
+		return NULL;
 	}
 
+	pImage = R_AllocImage(name, width, height, isMipMap, allowPicmip, glWrapClampMode);
+	pImage->format = format;
+	pImage->uploadWidth = uploadWidth;
+	pImage->uploadHeight = uploadHeight;
+	pImage->mipLevels = numMips;
+
+	vk_createImageAndBindWithMemory(pImage);
+	vk_createImageViewAndDescriptorSet(pImage);
+
+	vk_uploadImage(pImage, pic, buffer_size, regions, numMips, VK_FALSE);
+
+	R_RegisterImage(pImage);
+
 	return pImage;
 }
 
@@ -642,6 +898,26 @@ image_t *R_FindImageFile(const char *name, VkBool32 mipmap, VkBool32 allowPicmip
 		}
 	}
 
+	// prefer a block compressed replacement, it needs no decoding or mip generation
+	if (r_ext_compressed_textures->integer && vk.isBCSupported) {
+		char ddsName[MAX_QPATH];
+		uint32_t size, numMips;
+		VkFormat format;
+
+		COM_StripExtension(name, ddsName, sizeof(ddsName));
+		Q_strcat(ddsName, sizeof(ddsName), ".dds");
+
+		R_LoadDDS(ddsName, &pic, &size, &width, &height, &numMips, &format);
+		if (pic != NULL) {
+			image = R_CreateCompressedImage(name, pic, size, width, height, numMips, format, mipmap, allowPicmip,
+											glWrapClampMode);
+			ri.Free(pic);
+			if (image != NULL) {
+				return image;
+			}
+		}
+	}
+
 	//
 	// load the pic from disk
 	//
@@ -671,7 +947,6 @@ void RE_UploadCinematic(int w, int h, int cols, int rows, const unsigned char *d
 	if (cols != prtImage->uploadWidth || rows != prtImage->uploadHeight) {
 		VkBufferImageCopy region;
 		const uint32_t buffer_size = cols * rows * 4;
-		void *pDat;
 
 		ri.Printf(PRINT_DEVELOPER, "w=%d, h=%d, cols=%d, rows=%d, client=%d, prtImage->width=%d, prtImage->height=%d\n", w, h,
 				  cols, rows, client, prtImage->uploadWidth, prtImage->uploadHeight);
@@ -680,14 +955,17 @@ void RE_UploadCinematic(int w, int h, int cols, int rows, const unsigned char *d
 		prtImage->uploadHeight = rows;
 		prtImage->mipLevels = 1;
 
-		// VULKAN
+		// VULKAN, frames still in flight may sample the old image
+		qvkDeviceWaitIdle(vk.device);
 		qvkDestroyImage(vk.device, prtImage->handle, NULL);
 		qvkDestroyImageView(vk.device, prtImage->view, NULL);
-		qvkFreeDescriptorSets(vk.device, vk.descriptor_pool, 1, &prtImage->descriptor_set);
+		if (prtImage->descriptor_set != VK_NULL_HANDLE)
+			qvkFreeDescriptorSets(vk.device, vk.descriptor_pool, 1, &prtImage->descriptor_set);
 
 		vk_createImageAndBindWithMemory(prtImage);
 
 		vk_createImageViewAndDescriptorSet(prtImage);
+		vk_resetDescriptorBinding();
 
 		region.bufferOffset = 0;
 		region.bufferRowLength = 0;
@@ -703,11 +981,7 @@ void RE_UploadCinematic(int w, int h, int cols, int rows, const unsigned char *d
 		region.imageExtent.height = rows;
 		region.imageExtent.depth = 1;
 
-		VK_CHECK(qvkMapMemory(vk.device, StagBuf.mappableMem, 0, VK_WHOLE_SIZE, 0, &pDat));
-		memcpy(pDat, data, buffer_size);
-		qvkUnmapMemory(vk.device, StagBuf.mappableMem);
-
-		vk_stagBufferToDeviceLocalMem(tr.scratchImage[client]->handle, &region, 1);
+		vk_uploadImage(prtImage, data, buffer_size, &region, 1, VK_FALSE);
 	} else if (dirty) {
 		// otherwise, just subimage upload it so that
 		// drivers can tell we are going to be changing
@@ -716,7 +990,6 @@ void RE_UploadCinematic(int w, int h, int cols, int rows, const unsigned char *d
 
 		VkBufferImageCopy region;
 		const uint32_t buffer_size = cols * rows * 4;
-		void *pDat;
 
 		region.bufferOffset = 0;
 		region.bufferRowLength = 0;
@@ -732,11 +1005,7 @@ void RE_UploadCinematic(int w, int h, int cols, int rows, const unsigned char *d
 		region.imageExtent.height = rows;
 		region.imageExtent.depth = 1;
 
-		VK_CHECK(qvkMapMemory(vk.device, StagBuf.mappableMem, 0, VK_WHOLE_SIZE, 0, &pDat));
-		memcpy(pDat, data, buffer_size);
-		qvkUnmapMemory(vk.device, StagBuf.mappableMem);
-
-		vk_stagBufferToDeviceLocalMem(tr.scratchImage[client]->handle, &region, 1);
+		vk_uploadImage(prtImage, data, buffer_size, &region, 1, VK_FALSE);
 	}
 }
 
@@ -842,9 +1111,24 @@ static void R_CreateScratchImage(void) {
 }
 
 void R_InitImages(void) {
+	VkFormatProperties props;
+	VkFenceCreateInfo fence_desc;
+
 	memset(hashTable, 0, sizeof(hashTable));
 
-	vk_createStagingBuffer(8 * 1024 * 1024);
+	memset(&StagBuf, 0, sizeof(StagBuf));
+	vk_createStagingBuffer(STAGING_BUFFER_SIZE);
+
+	fence_desc.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+	fence_desc.pNext = NULL;
+	fence_desc.flags = 0;
+	VK_CHECK(qvkCreateFence(vk.device, &fence_desc, NULL, &StagBuf.fence));
+
+	qvkGetPhysicalDeviceFormatProperties(vk.physical_device, VK_FORMAT_R8G8B8A8_UNORM, &props);
+	s_blitMipMaps = (props.optimalTilingFeatures & (VK_FORMAT_FEATURE_BLIT_SRC_BIT | VK_FORMAT_FEATURE_BLIT_DST_BIT |
+													VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT)) ==
+					(VK_FORMAT_FEATURE_BLIT_SRC_BIT | VK_FORMAT_FEATURE_BLIT_DST_BIT |
+					 VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT);
 
 	// setup the overbright lighting
 
@@ -888,6 +1172,10 @@ static void vk_destroySingleImage(image_t *pImg) {
 void vk_destroyImageRes(void) {
 	uint32_t i = 0;
 
+	vk_flushImageUploads(VK_TRUE);
+	qvkDestroyFence(vk.device, StagBuf.fence, NULL);
+	StagBuf.fence = VK_NULL_HANDLE;
+
 	vk_free_sampler();
 
 	for (i = 0; i < tr.numImages; i++) {
@@ -17,6 +17,10 @@ uint32_t find_memory_type(uint32_t memory_type_bits, VkMemoryPropertyFlags prope
 
 void vk_destroyImageRes(void);
 
+// Submits the recorded image uploads, must be called before
+// submitting commands that sample the images.
+void vk_flushImageUploads(VkBool32 wait);
+
 image_t *R_FindImageFile(const char *name, VkBool32 mipmap, VkBool32 allowPicmip, int glWrapClampMode);
 
 image_t *R_CreateImage(const char *name, unsigned char *pic, uint32_t width, uint32_t height, VkBool32 mipmap,
@@ -24,6 +28,15 @@ image_t *R_CreateImage(const char *name, unsigned char *pic, uint32_t width, uin
 
 void R_LoadImage(const char *name, unsigned char **pic, uint32_t *width, uint32_t *height);
 
+// decode the images of a level on the job threads, see tr_image_prefetch.c
+void R_QueueImagePrefetch(const char *name);
+void R_QueueShaderImagePrefetch(const char *shaderText);
+void R_PrefetchImages(void);
+void R_FlushPrefetchedImages(void);
+
+void R_LoadDDS(const char *name, unsigned char **pic, uint32_t *size, uint32_t *width, uint32_t *height,
+			   uint32_t *numMips, VkFormat *format);
+
 void gpuMemUsageInfo_f(void);
 
 #endif
@@ -1,10 +1,12 @@
 #include "vkimpl.h"
 #include "tr_config.h"
+#include "tr_cvar.h"
 #include "vk_cmd.h"
 #include "vk_depth_attachment.h"
 #include "vk_frame.h"
 #include "vk_instance.h"
 #include "vk_pipelines.h"
+#include "vk_screenshot.h"
 #include "vk_shade_geometry.h"
 #include "vk_shaders.h"
 
@@ -15,6 +17,7 @@
 void vk_initialize(void) {
 	int width;
 	int height;
+	uint32_t i;
 
 	// This function is responsible for initializing a valid Vulkan subsystem.
 	vk_createWindow();
@@ -24,6 +27,13 @@ void vk_initialize(void) {
 	// Swapchain. vk.physical_device required to be init.
 	vk_createSwapChain(vk.device, vk.surface, vk.surface_format);
 
+	vk.num_frames = r_framesInFlight->integer;
+	if (vk.num_frames < 1) {
+		vk.num_frames = 1;
+	} else if (vk.num_frames > MAX_FRAMES_IN_FLIGHT) {
+		vk.num_frames = MAX_FRAMES_IN_FLIGHT;
+	}
+
 	// Sync primitives.
 	vk_create_sync_primitives();
 
@@ -33,8 +43,12 @@ void vk_initialize(void) {
 	ri.Printf(PRINT_DEVELOPER, " Create command pool: vk.command_pool \n");
 	vk_create_command_pool(&vk.command_pool);
 
-	ri.Printf(PRINT_DEVELOPER, " Create command buffer: vk.command_buffer \n");
-	vk_create_command_buffer(vk.command_pool, &vk.command_buffer);
+	ri.Printf(PRINT_DEVELOPER, " Create command buffers: vk.frame_command_buffers \n");
+	for (i = 0; i < vk.num_frames; i++) {
+		vk_create_command_buffer(vk.command_pool, &vk.frame_command_buffers[i]);
+	}
+	vk.cur_frame = 0;
+	vk.command_buffer = vk.frame_command_buffers[0];
 
 	R_GetWinResolution(&width, &height);
 
@@ -53,6 +67,8 @@ void vk_initialize(void) {
 
 	vk_createPipelineLayout();
 
+	vk_createPipelineCache();
+
 	//
 	vk_createVertexBuffer();
 	vk_createIndexBuffer();
@@ -78,6 +94,8 @@ VkBool32 isVKinitialied(void) {
 void vk_shutdown(void) {
 	ri.Printf(PRINT_DEVELOPER, "vk_shutdown()\n");
 
+	vk_destroyCaptures();
+
 	vk_destroyDepthAttachment();
 
 	vk_destroyFrameBuffers();
@@ -90,6 +108,9 @@ void vk_shutdown(void) {
 
 	//
 	vk_destroyGlobalStagePipeline();
+
+	vk_destroyPipelineCache();
+
 	//
 	vk_destroy_commands();
 
@@ -3,6 +3,7 @@
 
 #include "vkimpl.h"
 #include "tr_globals.h"
+#include "tr_cvar.h"
 #include "vk_depth_attachment.h"
 #include "vk_frame.h"
 #include "vk_image.h"
@@ -56,6 +57,7 @@ PFN_vkCmdBindPipeline qvkCmdBindPipeline;
 PFN_vkCmdBindVertexBuffers qvkCmdBindVertexBuffers;
 PFN_vkCmdBlitImage qvkCmdBlitImage;
 PFN_vkCmdClearAttachments qvkCmdClearAttachments;
+PFN_vkCmdCopyBuffer qvkCmdCopyBuffer;
 PFN_vkCmdCopyBufferToImage qvkCmdCopyBufferToImage;
 PFN_vkCmdCopyImage qvkCmdCopyImage;
 PFN_vkCmdCopyImageToBuffer qvkCmdCopyImageToBuffer;
@@ -63,10 +65,12 @@ PFN_vkCmdDraw qvkCmdDraw;
 PFN_vkCmdDrawIndexed qvkCmdDrawIndexed;
 PFN_vkCmdEndRenderPass qvkCmdEndRenderPass;
 PFN_vkCmdPipelineBarrier qvkCmdPipelineBarrier;
+PFN_vkCmdResetQueryPool qvkCmdResetQueryPool;
 PFN_vkCmdPushConstants qvkCmdPushConstants;
 PFN_vkCmdSetDepthBias qvkCmdSetDepthBias;
 PFN_vkCmdSetScissor qvkCmdSetScissor;
 PFN_vkCmdSetViewport qvkCmdSetViewport;
+PFN_vkCmdWriteTimestamp qvkCmdWriteTimestamp;
 PFN_vkCreateBuffer qvkCreateBuffer;
 PFN_vkCreateCommandPool qvkCreateCommandPool;
 PFN_vkCreateDescriptorPool qvkCreateDescriptorPool;
@@ -76,7 +80,9 @@ PFN_vkCreateFramebuffer qvkCreateFramebuffer;
 PFN_vkCreateGraphicsPipelines qvkCreateGraphicsPipelines;
 PFN_vkCreateImage qvkCreateImage;
 PFN_vkCreateImageView qvkCreateImageView;
+PFN_vkCreatePipelineCache qvkCreatePipelineCache;
 PFN_vkCreatePipelineLayout qvkCreatePipelineLayout;
+PFN_vkCreateQueryPool qvkCreateQueryPool;
 PFN_vkCreateRenderPass qvkCreateRenderPass;
 PFN_vkCreateSampler qvkCreateSampler;
 PFN_vkCreateSemaphore qvkCreateSemaphore;
@@ -91,7 +97,9 @@ PFN_vkDestroyFramebuffer qvkDestroyFramebuffer;
 PFN_vkDestroyImage qvkDestroyImage;
 PFN_vkDestroyImageView qvkDestroyImageView;
 PFN_vkDestroyPipeline qvkDestroyPipeline;
+PFN_vkDestroyPipelineCache qvkDestroyPipelineCache;
 PFN_vkDestroyPipelineLayout qvkDestroyPipelineLayout;
+PFN_vkDestroyQueryPool qvkDestroyQueryPool;
 PFN_vkDestroyRenderPass qvkDestroyRenderPass;
 PFN_vkDestroySampler qvkDestroySampler;
 PFN_vkDestroySemaphore qvkDestroySemaphore;
@@ -105,6 +113,7 @@ PFN_vkGetBufferMemoryRequirements qvkGetBufferMemoryRequirements;
 PFN_vkGetDeviceQueue qvkGetDeviceQueue;
 PFN_vkGetImageMemoryRequirements qvkGetImageMemoryRequirements;
 PFN_vkGetImageSubresourceLayout qvkGetImageSubresourceLayout;
+PFN_vkGetQueryPoolResults qvkGetQueryPoolResults;
 PFN_vkMapMemory qvkMapMemory;
 PFN_vkUnmapMemory qvkUnmapMemory;
 PFN_vkQueueSubmit qvkQueueSubmit;
@@ -116,6 +125,7 @@ PFN_vkWaitForFences qvkWaitForFences;
 PFN_vkAcquireNextImageKHR qvkAcquireNextImageKHR;
 PFN_vkCreateSwapchainKHR qvkCreateSwapchainKHR;
 PFN_vkDestroySwapchainKHR qvkDestroySwapchainKHR;
+PFN_vkGetPipelineCacheData qvkGetPipelineCacheData;
 PFN_vkGetSwapchainImagesKHR qvkGetSwapchainImagesKHR;
 PFN_vkQueuePresentKHR qvkQueuePresentKHR;
 
@@ -338,6 +348,13 @@ static void vk_selectPhysicalDevice(void) {
 
 	ri.Printf(PRINT_ALL, " Get physical device memory properties: vk.devMemProperties \n");
 	qvkGetPhysicalDeviceMemoryProperties(vk.physical_device, &vk.devMemProperties);
+
+	{
+		VkPhysicalDeviceProperties props;
+
+		qvkGetPhysicalDeviceProperties(vk.physical_device, &props);
+		vk.timestampPeriod = props.limits.timestampPeriod;
+	}
 }
 
 static void vk_selectSurfaceFormat(void) {
@@ -477,6 +494,7 @@ static void vk_selectQueueFamilyForPresentation(void) {
 
 		if (presentation_supported && (pQueueFamilies[i].queueFlags & VK_QUEUE_GRAPHICS_BIT) != 0) {
 			vk.queue_family_index = i;
+			vk.timestampsSupported = pQueueFamilies[i].timestampValidBits != 0;
 
 			ri.Printf(PRINT_ALL, " Queue family for presentation selected: %d\n", vk.queue_family_index);
 
@@ -490,8 +508,82 @@ static void vk_selectQueueFamilyForPresentation(void) {
 		ri.Error(ERR_FATAL, "Vulkan: failed to find queue family");
 }
 
+static VkBool32 vk_hasDeviceExtension(const VkExtensionProperties *pDeviceExt, uint32_t nDevExts, const char *name) {
+	uint32_t j;
+
+	for (j = 0; j < nDevExts; j++) {
+		if (!strcmp(name, pDeviceExt[j].extensionName))
+			return VK_TRUE;
+	}
+	return VK_FALSE;
+}
+
+// bindless textures need VK_EXT_descriptor_indexing: a sampler array that may be
+// partially bound and updated while frames using it are in flight, indexed by a
+// push constant that is dynamically uniform, plus room for 8 bytes of fragment
+// push constants after the 128 of the vertex stage
+static VkBool32 vk_checkBindless(const VkExtensionProperties *pDeviceExt, uint32_t nDevExts,
+								 const VkPhysicalDeviceFeatures *features,
+								 VkPhysicalDeviceDescriptorIndexingFeaturesEXT *indexing) {
+	PFN_vkGetPhysicalDeviceFeatures2KHR qvkGetPhysicalDeviceFeatures2KHR;
+	PFN_vkGetPhysicalDeviceProperties2KHR qvkGetPhysicalDeviceProperties2KHR;
+	VkPhysicalDeviceDescriptorIndexingPropertiesEXT indexingProps;
+	VkPhysicalDeviceFeatures2KHR features2;
+	VkPhysicalDeviceProperties2KHR props2;
+
+	memset(indexing, 0, sizeof(*indexing));
+
+	if (!r_bindless->integer)
+		return VK_FALSE;
+
+	if (!vk_hasDeviceExtension(pDeviceExt, nDevExts, VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME) ||
+		!vk_hasDeviceExtension(pDeviceExt, nDevExts, VK_KHR_MAINTENANCE3_EXTENSION_NAME))
+		return VK_FALSE;
+
+	// VK_KHR_get_physical_device_properties2 is an instance extension,
+	// enabled along with the others when it is available
+	qvkGetPhysicalDeviceFeatures2KHR =
+		(PFN_vkGetPhysicalDeviceFeatures2KHR)qvkGetInstanceProcAddr(vk.instance, "vkGetPhysicalDeviceFeatures2KHR");
+	qvkGetPhysicalDeviceProperties2KHR = (PFN_vkGetPhysicalDeviceProperties2KHR)qvkGetInstanceProcAddr(
+		vk.instance, "vkGetPhysicalDeviceProperties2KHR");
+	if (qvkGetPhysicalDeviceFeatures2KHR == NULL || qvkGetPhysicalDeviceProperties2KHR == NULL)
+		return VK_FALSE;
+
+	indexing->sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT;
+	features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2_KHR;
+	features2.pNext = indexing;
+	qvkGetPhysicalDeviceFeatures2KHR(vk.physical_device, &features2);
+
+	memset(&indexingProps, 0, sizeof(indexingProps));
+	indexingProps.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES_EXT;
+	props2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2_KHR;
+	props2.pNext = &indexingProps;
+	qvkGetPhysicalDeviceProperties2KHR(vk.physical_device, &props2);
+
+	if (!features->shaderSampledImageArrayDynamicIndexing || !indexing->descriptorBindingSampledImageUpdateAfterBind ||
+		!indexing->descriptorBindingPartiallyBound || !indexing->descriptorBindingUpdateUnusedWhilePending)
+		return VK_FALSE;
+
+	if (props2.properties.limits.maxPushConstantsSize < 136 ||
+		indexingProps.maxPerStageDescriptorUpdateAfterBindSamplers < MAX_DRAWIMAGES ||
+		indexingProps.maxPerStageDescriptorUpdateAfterBindSampledImages < MAX_DRAWIMAGES ||
+		indexingProps.maxDescriptorSetUpdateAfterBindSamplers < MAX_DRAWIMAGES ||
+		indexingProps.maxDescriptorSetUpdateAfterBindSampledImages < MAX_DRAWIMAGES)
+		return VK_FALSE;
+
+	// only enable what the bindless path uses
+	memset(indexing, 0, sizeof(*indexing));
+	indexing->sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT;
+	indexing->descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+	indexing->descriptorBindingPartiallyBound = VK_TRUE;
+	indexing->descriptorBindingUpdateUnusedWhilePending = VK_TRUE;
+
+	return VK_TRUE;
+}
+
 static void vk_createLogicalDevice(void) {
-	static const char *device_extensions[1] = {VK_KHR_SWAPCHAIN_EXTENSION_NAME};
+	static const char *device_extensions[3] = {VK_KHR_SWAPCHAIN_EXTENSION_NAME, VK_KHR_MAINTENANCE3_EXTENSION_NAME,
+											   VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME};
 
 	//  Not all graphics cards are capble of presenting images directly
 	//  to a screen for various reasons, for example because they are
@@ -501,13 +593,12 @@ static void vk_createLogicalDevice(void) {
 	//  not actually part of the vulkan core. You have to enable the
 	//  VK_KHR_swapchain device extension after querying for its support.
 	uint32_t nDevExts = 0;
-	VkBool32 swapchainExtFound = 0;
 	VkExtensionProperties *pDeviceExt;
 	const float priority = 1.0f;
 	VkDeviceQueueCreateInfo queue_desc;
 	VkPhysicalDeviceFeatures features;
+	VkPhysicalDeviceDescriptorIndexingFeaturesEXT indexing;
 	VkDeviceCreateInfo device_desc;
-	uint32_t j;
 
 	// To query the numbers of extensions available to a given physical device
 	ri.Printf(PRINT_ALL, " Check for VK_KHR_swapchain extension. \n");
@@ -518,17 +609,9 @@ static void vk_createLogicalDevice(void) {
 
 	qvkEnumerateDeviceExtensionProperties(vk.physical_device, NULL, &nDevExts, pDeviceExt);
 
-	for (j = 0; j < nDevExts; j++) {
-		if (!strcmp(device_extensions[0], pDeviceExt[j].extensionName)) {
-			swapchainExtFound = VK_TRUE;
-			break;
-		}
-	}
-	if (VK_FALSE == swapchainExtFound)
+	if (VK_FALSE == vk_hasDeviceExtension(pDeviceExt, nDevExts, device_extensions[0]))
 		ri.Error(ERR_FATAL, "VK_KHR_SWAPCHAIN_EXTENSION_NAME is not available");
 
-	ri.Hunk_FreeTempMemory(pDeviceExt);
-
 	queue_desc.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
 	queue_desc.pNext = NULL;
 	queue_desc.flags = 0;
@@ -546,14 +629,21 @@ static void vk_createLogicalDevice(void) {
 	if (features.fillModeNonSolid == VK_FALSE)
 		ri.Error(ERR_FATAL, "vk_create_device: fillModeNonSolid feature is not supported");
 
+	vk.isBCSupported = features.textureCompressionBC;
+
+	vk.bindless = vk_checkBindless(pDeviceExt, nDevExts, &features, &indexing);
+	ri.Printf(PRINT_ALL, " Bindless textures: %s \n", vk.bindless ? "yes" : "no");
+
+	ri.Hunk_FreeTempMemory(pDeviceExt);
+
 	device_desc.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
-	device_desc.pNext = NULL;
+	device_desc.pNext = vk.bindless ? &indexing : NULL;
 	device_desc.flags = 0;
 	device_desc.queueCreateInfoCount = 1;
 	device_desc.pQueueCreateInfos = &queue_desc;
 	device_desc.enabledLayerCount = 0;
 	device_desc.ppEnabledLayerNames = NULL;
-	device_desc.enabledExtensionCount = 1;
+	device_desc.enabledExtensionCount = vk.bindless ? 3 : 1;
 	device_desc.ppEnabledExtensionNames = device_extensions;
 	device_desc.pEnabledFeatures = &features;
 
@@ -590,6 +680,7 @@ static void vk_loadDeviceFunctions(void) {
 	INIT_DEVICE_FUNCTION(vkCmdBindVertexBuffers)
 	INIT_DEVICE_FUNCTION(vkCmdBlitImage)
 	INIT_DEVICE_FUNCTION(vkCmdClearAttachments)
+	INIT_DEVICE_FUNCTION(vkCmdCopyBuffer)
 	INIT_DEVICE_FUNCTION(vkCmdCopyBufferToImage)
 	INIT_DEVICE_FUNCTION(vkCmdCopyImage)
 	INIT_DEVICE_FUNCTION(vkCmdCopyImageToBuffer)
@@ -597,10 +688,12 @@ static void vk_loadDeviceFunctions(void) {
 	INIT_DEVICE_FUNCTION(vkCmdDrawIndexed)
 	INIT_DEVICE_FUNCTION(vkCmdEndRenderPass)
 	INIT_DEVICE_FUNCTION(vkCmdPipelineBarrier)
+	INIT_DEVICE_FUNCTION(vkCmdResetQueryPool)
 	INIT_DEVICE_FUNCTION(vkCmdPushConstants)
 	INIT_DEVICE_FUNCTION(vkCmdSetDepthBias)
 	INIT_DEVICE_FUNCTION(vkCmdSetScissor)
 	INIT_DEVICE_FUNCTION(vkCmdSetViewport)
+	INIT_DEVICE_FUNCTION(vkCmdWriteTimestamp)
 	INIT_DEVICE_FUNCTION(vkCreateBuffer)
 	INIT_DEVICE_FUNCTION(vkCreateCommandPool)
 	INIT_DEVICE_FUNCTION(vkCreateDescriptorPool)
@@ -610,7 +703,9 @@ static void vk_loadDeviceFunctions(void) {
 	INIT_DEVICE_FUNCTION(vkCreateGraphicsPipelines)
 	INIT_DEVICE_FUNCTION(vkCreateImage)
 	INIT_DEVICE_FUNCTION(vkCreateImageView)
+	INIT_DEVICE_FUNCTION(vkCreatePipelineCache)
 	INIT_DEVICE_FUNCTION(vkCreatePipelineLayout)
+	INIT_DEVICE_FUNCTION(vkCreateQueryPool)
 	INIT_DEVICE_FUNCTION(vkCreateRenderPass)
 	INIT_DEVICE_FUNCTION(vkCreateSampler)
 	INIT_DEVICE_FUNCTION(vkCreateSemaphore)
@@ -625,7 +720,9 @@ static void vk_loadDeviceFunctions(void) {
 	INIT_DEVICE_FUNCTION(vkDestroyImage)
 	INIT_DEVICE_FUNCTION(vkDestroyImageView)
 	INIT_DEVICE_FUNCTION(vkDestroyPipeline)
+	INIT_DEVICE_FUNCTION(vkDestroyPipelineCache)
 	INIT_DEVICE_FUNCTION(vkDestroyPipelineLayout)
+	INIT_DEVICE_FUNCTION(vkDestroyQueryPool)
 	INIT_DEVICE_FUNCTION(vkDestroyRenderPass)
 	INIT_DEVICE_FUNCTION(vkDestroySampler)
 	INIT_DEVICE_FUNCTION(vkDestroySemaphore)
@@ -639,6 +736,7 @@ static void vk_loadDeviceFunctions(void) {
 	INIT_DEVICE_FUNCTION(vkGetDeviceQueue)
 	INIT_DEVICE_FUNCTION(vkGetImageMemoryRequirements)
 	INIT_DEVICE_FUNCTION(vkGetImageSubresourceLayout)
+	INIT_DEVICE_FUNCTION(vkGetQueryPoolResults)
 	INIT_DEVICE_FUNCTION(vkMapMemory)
 	INIT_DEVICE_FUNCTION(vkUnmapMemory)
 	INIT_DEVICE_FUNCTION(vkQueueSubmit)
@@ -650,6 +748,7 @@ static void vk_loadDeviceFunctions(void) {
 
 	INIT_DEVICE_FUNCTION(vkCreateSwapchainKHR)
 	INIT_DEVICE_FUNCTION(vkDestroySwapchainKHR)
+	INIT_DEVICE_FUNCTION(vkGetPipelineCacheData)
 	INIT_DEVICE_FUNCTION(vkGetSwapchainImagesKHR)
 	INIT_DEVICE_FUNCTION(vkAcquireNextImageKHR)
 	INIT_DEVICE_FUNCTION(vkQueuePresentKHR)
@@ -744,6 +843,7 @@ void vk_clearProcAddress(void) {
 	qvkCmdBindVertexBuffers = NULL;
 	qvkCmdBlitImage = NULL;
 	qvkCmdClearAttachments = NULL;
+	qvkCmdCopyBuffer = NULL;
 	qvkCmdCopyBufferToImage = NULL;
 	qvkCmdCopyImage = NULL;
 	qvkCmdCopyImageToBuffer = NULL;
@@ -751,10 +851,12 @@ void vk_clearProcAddress(void) {
 	qvkCmdDrawIndexed = NULL;
 	qvkCmdEndRenderPass = NULL;
 	qvkCmdPipelineBarrier = NULL;
+	qvkCmdResetQueryPool = NULL;
 	qvkCmdPushConstants = NULL;
 	qvkCmdSetDepthBias = NULL;
 	qvkCmdSetScissor = NULL;
 	qvkCmdSetViewport = NULL;
+	qvkCmdWriteTimestamp = NULL;
 	qvkCreateBuffer = NULL;
 	qvkCreateCommandPool = NULL;
 	qvkCreateDescriptorPool = NULL;
@@ -764,7 +866,9 @@ void vk_clearProcAddress(void) {
 	qvkCreateGraphicsPipelines = NULL;
 	qvkCreateImage = NULL;
 	qvkCreateImageView = NULL;
+	qvkCreatePipelineCache = NULL;
 	qvkCreatePipelineLayout = NULL;
+	qvkCreateQueryPool = NULL;
 	qvkCreateRenderPass = NULL;
 	qvkCreateSampler = NULL;
 	qvkCreateSemaphore = NULL;
@@ -779,7 +883,9 @@ void vk_clearProcAddress(void) {
 	qvkDestroyImage = NULL;
 	qvkDestroyImageView = NULL;
 	qvkDestroyPipeline = NULL;
+	qvkDestroyPipelineCache = NULL;
 	qvkDestroyPipelineLayout = NULL;
+	qvkDestroyQueryPool = NULL;
 	qvkDestroyRenderPass = NULL;
 	qvkDestroySampler = NULL;
 	qvkDestroySemaphore = NULL;
@@ -793,6 +899,7 @@ void vk_clearProcAddress(void) {
 	qvkGetDeviceQueue = NULL;
 	qvkGetImageMemoryRequirements = NULL;
 	qvkGetImageSubresourceLayout = NULL;
+	qvkGetQueryPoolResults = NULL;
 	qvkMapMemory = NULL;
 	qvkUnmapMemory = NULL;
 	qvkQueueSubmit = NULL;
@@ -804,6 +911,7 @@ void vk_clearProcAddress(void) {
 	qvkAcquireNextImageKHR = NULL;
 	qvkCreateSwapchainKHR = NULL;
 	qvkDestroySwapchainKHR = NULL;
+	qvkGetPipelineCacheData = NULL;
 	qvkGetSwapchainImagesKHR = NULL;
 	qvkQueuePresentKHR = NULL;
 }
@@ -43,6 +43,7 @@ extern PFN_vkCmdBindPipeline qvkCmdBindPipeline;
 extern PFN_vkCmdBindVertexBuffers qvkCmdBindVertexBuffers;
 extern PFN_vkCmdBlitImage qvkCmdBlitImage;
 extern PFN_vkCmdClearAttachments qvkCmdClearAttachments;
+extern PFN_vkCmdCopyBuffer qvkCmdCopyBuffer;
 extern PFN_vkCmdCopyBufferToImage qvkCmdCopyBufferToImage;
 extern PFN_vkCmdCopyImage qvkCmdCopyImage;
 extern PFN_vkCmdCopyImageToBuffer qvkCmdCopyImageToBuffer;
@@ -50,10 +51,12 @@ extern PFN_vkCmdDraw qvkCmdDraw;
 extern PFN_vkCmdDrawIndexed qvkCmdDrawIndexed;
 extern PFN_vkCmdEndRenderPass qvkCmdEndRenderPass;
 extern PFN_vkCmdPipelineBarrier qvkCmdPipelineBarrier;
+extern PFN_vkCmdResetQueryPool qvkCmdResetQueryPool;
 extern PFN_vkCmdPushConstants qvkCmdPushConstants;
 extern PFN_vkCmdSetDepthBias qvkCmdSetDepthBias;
 extern PFN_vkCmdSetScissor qvkCmdSetScissor;
 extern PFN_vkCmdSetViewport qvkCmdSetViewport;
+extern PFN_vkCmdWriteTimestamp qvkCmdWriteTimestamp;
 extern PFN_vkCreateBuffer qvkCreateBuffer;
 extern PFN_vkCreateCommandPool qvkCreateCommandPool;
 extern PFN_vkCreateDescriptorPool qvkCreateDescriptorPool;
@@ -63,7 +66,9 @@ extern PFN_vkCreateFramebuffer qvkCreateFramebuffer;
 extern PFN_vkCreateGraphicsPipelines qvkCreateGraphicsPipelines;
 extern PFN_vkCreateImage qvkCreateImage;
 extern PFN_vkCreateImageView qvkCreateImageView;
+extern PFN_vkCreatePipelineCache qvkCreatePipelineCache;
 extern PFN_vkCreatePipelineLayout qvkCreatePipelineLayout;
+extern PFN_vkCreateQueryPool qvkCreateQueryPool;
 extern PFN_vkCreateRenderPass qvkCreateRenderPass;
 extern PFN_vkCreateSampler qvkCreateSampler;
 extern PFN_vkCreateSemaphore qvkCreateSemaphore;
@@ -78,7 +83,9 @@ extern PFN_vkDestroyFramebuffer qvkDestroyFramebuffer;
 extern PFN_vkDestroyImage qvkDestroyImage;
 extern PFN_vkDestroyImageView qvkDestroyImageView;
 extern PFN_vkDestroyPipeline qvkDestroyPipeline;
+extern PFN_vkDestroyPipelineCache qvkDestroyPipelineCache;
 extern PFN_vkDestroyPipelineLayout qvkDestroyPipelineLayout;
+extern PFN_vkDestroyQueryPool qvkDestroyQueryPool;
 extern PFN_vkDestroyRenderPass qvkDestroyRenderPass;
 extern PFN_vkDestroySampler qvkDestroySampler;
 extern PFN_vkDestroySemaphore qvkDestroySemaphore;
@@ -92,6 +99,7 @@ extern PFN_vkGetBufferMemoryRequirements qvkGetBufferMemoryRequirements;
 extern PFN_vkGetDeviceQueue qvkGetDeviceQueue;
 extern PFN_vkGetImageMemoryRequirements qvkGetImageMemoryRequirements;
 extern PFN_vkGetImageSubresourceLayout qvkGetImageSubresourceLayout;
+extern PFN_vkGetQueryPoolResults qvkGetQueryPoolResults;
 extern PFN_vkMapMemory qvkMapMemory;
 extern PFN_vkUnmapMemory qvkUnmapMemory;
 extern PFN_vkQueueSubmit qvkQueueSubmit;
@@ -103,6 +111,7 @@ extern PFN_vkWaitForFences qvkWaitForFences;
 extern PFN_vkAcquireNextImageKHR qvkAcquireNextImageKHR;
 extern PFN_vkCreateSwapchainKHR qvkCreateSwapchainKHR;
 extern PFN_vkDestroySwapchainKHR qvkDestroySwapchainKHR;
+extern PFN_vkGetPipelineCacheData qvkGetPipelineCacheData;
 extern PFN_vkGetSwapchainImagesKHR qvkGetSwapchainImagesKHR;
 extern PFN_vkQueuePresentKHR qvkQueuePresentKHR;
 
@@ -124,6 +133,7 @@ const char *cvtResToStr(VkResult result);
 #endif
 
 #define MAX_SWAPCHAIN_IMAGES 8
+#define MAX_FRAMES_IN_FLIGHT 3
 
 // Vk_Instance contains engine-specific vulkan resources that persist entire renderer lifetime.
 // This structure is initialized/deinitialized by vk_initialize/vk_shutdown functions correspondingly.
@@ -161,6 +171,10 @@ struct Vk_Instance {
 	VkDevice device;
 	VkQueue queue;
 
+	// the queue can write timestamps, each tick is timestampPeriod ns
+	VkBool32 timestampsSupported;
+	float timestampPeriod;
+
 	VkSwapchainKHR swapchain;
 	uint32_t swapchain_image_count;
 	VkImage swapchain_images_array[MAX_SWAPCHAIN_IMAGES];
@@ -168,8 +182,15 @@ struct Vk_Instance {
 	uint32_t idx_swapchain_image;
 
 	VkCommandPool command_pool;
+	// the command buffer of the frame being recorded, one of frame_command_buffers
 	VkCommandBuffer command_buffer;
 
+	// up to num_frames frames are recorded or executed at the same time,
+	// each with its own command buffer, sync objects and stream buffers
+	uint32_t num_frames;
+	uint32_t cur_frame;
+	VkCommandBuffer frame_command_buffers[MAX_FRAMES_IN_FLIGHT];
+
 	VkImage depth_image;
 	VkDeviceMemory depth_image_memory;
 	VkImageView depth_image_view;
@@ -180,11 +201,21 @@ struct Vk_Instance {
 	VkDescriptorPool descriptor_pool;
 	VkDescriptorSetLayout set_layout;
 
+	// bindless: every image is written at image->index of one sampler array
+	// that stays bound, draws select their textures with push constants.
+	// Otherwise each image has its own set allocated from descriptor_pool.
+	VkBool32 bindless;
+	VkDescriptorPool bindless_pool;
+	VkDescriptorSetLayout bindless_set_layout;
+	VkDescriptorSet bindless_set;
+
 	// Pipeline layout: the uniform and push values referenced by
 	// the shader that can be updated at draw time
 	VkPipelineLayout pipeline_layout;
 
 	VkBool32 isBlitSupported;
+	// textureCompressionBC, BC1-BC7 images can be sampled
+	VkBool32 isBCSupported;
 
 	VkBool32 isInitialized;
 
@@ -1,4 +1,5 @@
 #include "vk_pipelines.h"
+#include "tr_cvar.h"
 #include "tr_local.h"
 #include "tr_shader.h"
 #include "vk_instance.h"
@@ -58,10 +59,164 @@ struct GlobalPipelineManager g_stdPipelines;
 static struct Vk_Pipeline_Def s_pipeline_defs[MAX_VK_PIPELINES];
 static uint32_t s_numPipelines = 0;
 
+// Pipelines are compiled when shaders are registered during level load, the
+// pipeline cache keeps the driver's compiled code between runs so only the
+// first load on a new driver/GPU pays for it.
+#define PIPELINE_CACHE_FILE "vkpipelines.cache"
+
+static VkPipelineCache s_pipelineCache = VK_NULL_HANDLE;
+static VkBool32 s_pipelineCacheDirty = VK_FALSE;
+
+// the header written by vkGetPipelineCacheData, for VK_PIPELINE_CACHE_HEADER_VERSION_ONE
+struct Vk_Pipeline_Cache_Header {
+	uint32_t length;
+	uint32_t version;
+	uint32_t vendorID;
+	uint32_t deviceID;
+	uint8_t uuid[VK_UUID_SIZE];
+};
+
+// Drivers should reject foreign data themselves, but don't trust them with it.
+static VkBool32 vk_pipelineCacheMatches(const void *data, long size) {
+	struct Vk_Pipeline_Cache_Header header;
+	VkPhysicalDeviceProperties props;
+
+	if (size < (long)sizeof(header)) {
+		return VK_FALSE;
+	}
+
+	memcpy(&header, data, sizeof(header));
+	qvkGetPhysicalDeviceProperties(vk.physical_device, &props);
+
+	return header.version == VK_PIPELINE_CACHE_HEADER_VERSION_ONE && header.vendorID == props.vendorID &&
+		   header.deviceID == props.deviceID && !memcmp(header.uuid, props.pipelineCacheUUID, VK_UUID_SIZE);
+}
+
+void vk_createPipelineCache(void) {
+	VkPipelineCacheCreateInfo desc;
+	void *data = NULL;
+	long size = 0;
+
+	if (r_pipelineCache->integer) {
+		size = ri.FS_ReadFile(PIPELINE_CACHE_FILE, &data);
+	}
+
+	desc.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+	desc.pNext = NULL;
+	desc.flags = 0;
+	desc.initialDataSize = 0;
+	desc.pInitialData = NULL;
+
+	if (data && vk_pipelineCacheMatches(data, size)) {
+		ri.Printf(PRINT_DEVELOPER, " Load pipeline cache: %ld bytes\n", size);
+		desc.initialDataSize = size;
+		desc.pInitialData = data;
+	} else if (data) {
+		ri.Printf(PRINT_DEVELOPER, " Ignoring pipeline cache from another driver or device\n");
+	}
+
+	VK_CHECK(qvkCreatePipelineCache(vk.device, &desc, NULL, &s_pipelineCache));
+
+	if (data) {
+		ri.FS_FreeFile(data);
+	}
+
+	s_pipelineCacheDirty = VK_FALSE;
+}
+
+// Called after registration and at shutdown, only writes when new pipelines were compiled.
+void vk_savePipelineCache(void) {
+	size_t size = 0;
+	void *data;
+
+	if (s_pipelineCache == VK_NULL_HANDLE || !s_pipelineCacheDirty || !r_pipelineCache->integer) {
+		return;
+	}
+
+	VK_CHECK(qvkGetPipelineCacheData(vk.device, s_pipelineCache, &size, NULL));
+	if (!size) {
+		return;
+	}
+
+	data = ri.Hunk_AllocateTempMemory(size);
+	VK_CHECK(qvkGetPipelineCacheData(vk.device, s_pipelineCache, &size, data));
+
+	ri.FS_WriteFile(PIPELINE_CACHE_FILE, data, size);
+	ri.Printf(PRINT_DEVELOPER, " Save pipeline cache: %ld bytes\n", (long)size);
+
+	ri.Hunk_FreeTempMemory(data);
+
+	s_pipelineCacheDirty = VK_FALSE;
+}
+
+void vk_destroyPipelineCache(void) {
+	vk_savePipelineCache();
+
+	qvkDestroyPipelineCache(vk.device, s_pipelineCache, NULL);
+	s_pipelineCache = VK_NULL_HANDLE;
+}
+
 void R_PipelineList_f(void) {
 	ri.Printf(PRINT_DEVELOPER, " Total pipeline created: %d\n", s_numPipelines);
 }
 
+// The bindless set: one array of MAX_DRAWIMAGES combined samplers, image->index
+// is written when the image is created. Unwritten slots are allowed by
+// PARTIALLY_BOUND, and UPDATE_AFTER_BIND lets new images be written while the
+// set is bound in command buffers that are still being recorded or executed.
+static void vk_createBindlessSet(void) {
+	const VkDescriptorBindingFlagsEXT binding_flags = VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT |
+													  VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT_EXT |
+													  VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT;
+	VkDescriptorSetLayoutBindingFlagsCreateInfoEXT flags_info;
+	VkDescriptorSetLayoutBinding descriptor_binding;
+	VkDescriptorSetLayoutCreateInfo layout_desc;
+	VkDescriptorPoolSize pool_size;
+	VkDescriptorPoolCreateInfo pool_desc;
+	VkDescriptorSetAllocateInfo alloc_info;
+
+	ri.Printf(PRINT_DEVELOPER, " Create: vk.bindless_pool, vk.bindless_set_layout, vk.bindless_set\n");
+
+	pool_size.type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+	pool_size.descriptorCount = MAX_DRAWIMAGES;
+
+	pool_desc.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+	pool_desc.pNext = NULL;
+	pool_desc.flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT_EXT;
+	pool_desc.maxSets = 1;
+	pool_desc.poolSizeCount = 1;
+	pool_desc.pPoolSizes = &pool_size;
+
+	VK_CHECK(qvkCreateDescriptorPool(vk.device, &pool_desc, NULL, &vk.bindless_pool));
+
+	descriptor_binding.binding = 0;
+	descriptor_binding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+	descriptor_binding.descriptorCount = MAX_DRAWIMAGES; // textures[] in the *_bindless.frag shaders
+	descriptor_binding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+	descriptor_binding.pImmutableSamplers = NULL;
+
+	flags_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO_EXT;
+	flags_info.pNext = NULL;
+	flags_info.bindingCount = 1;
+	flags_info.pBindingFlags = &binding_flags;
+
+	layout_desc.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+	layout_desc.pNext = &flags_info;
+	layout_desc.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT_EXT;
+	layout_desc.bindingCount = 1;
+	layout_desc.pBindings = &descriptor_binding;
+
+	VK_CHECK(qvkCreateDescriptorSetLayout(vk.device, &layout_desc, NULL, &vk.bindless_set_layout));
+
+	alloc_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+	alloc_info.pNext = NULL;
+	alloc_info.descriptorPool = vk.bindless_pool;
+	alloc_info.descriptorSetCount = 1;
+	alloc_info.pSetLayouts = &vk.bindless_set_layout;
+
+	VK_CHECK(qvkAllocateDescriptorSets(vk.device, &alloc_info, &vk.bindless_set));
+}
+
 // uniform values in the shaders need to be specified during pipeline creation
 // transformation matrix to the vertex shader, or to create texture samplers
 // in the fragment shader.
@@ -135,15 +290,25 @@ void vk_createPipelineLayout(void) {
 		VK_CHECK(qvkCreateDescriptorSetLayout(vk.device, &desc, NULL, &vk.set_layout));
 	}
 
+	if (vk.bindless)
+		vk_createBindlessSet();
+
 	{
-		VkPushConstantRange push_range;
+		VkPushConstantRange push_ranges[2];
 		VkPipelineLayoutCreateInfo desc;
 		VkDescriptorSetLayout set_layouts[2] = {vk.set_layout, vk.set_layout};
 
-		push_range.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
-		push_range.offset = 0;
-		push_range.size = 128; // 16 mvp floats + 16
+		push_ranges[0].stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+		push_ranges[0].offset = 0;
+		push_ranges[0].size = 128; // 16 mvp floats + 16
 
+		// bindless: the array indices of texture0 and texture1
+		push_ranges[1].stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+		push_ranges[1].offset = 128;
+		push_ranges[1].size = 2 * sizeof(uint32_t);
+
+		if (vk.bindless)
+			set_layouts[0] = vk.bindless_set_layout;
 
 		desc.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
 		desc.pNext = NULL;
@@ -151,7 +316,7 @@ void vk_createPipelineLayout(void) {
 
 		// setLayoutCount: the number of descriptor sets included in the pipeline layout.
 		// pSetLayouts: a pointer to an array of VkDescriptorSetLayout objects.
-		desc.setLayoutCount = 2;
+		desc.setLayoutCount = vk.bindless ? 1 : 2;
 		desc.pSetLayouts = set_layouts;
 
 		// pushConstantRangeCount is the number of push constant ranges
@@ -165,8 +330,8 @@ void vk_createPipelineLayout(void) {
 		// describes how many push constants can be accessed by each stage
 		// of the pipeline.
 
-		desc.pushConstantRangeCount = 1;
-		desc.pPushConstantRanges = &push_range;
+		desc.pushConstantRangeCount = vk.bindless ? 2 : 1;
+		desc.pPushConstantRanges = push_ranges;
 
 		// Access to descriptor sets from a pipeline is accomplished through
 		// a pipeline layout. Zero or more descriptor set layouts and zero or
@@ -609,11 +774,11 @@ static void vk_create_pipeline(const struct Vk_Pipeline_Def *def, VkPipeline *pP
 	// Graphics pipelines consist of multiple shader stages,
 	// multiple fixed-function pipeline stages, and a pipeline layout.
 	// To create graphics pipelines
-	// VK_NULL_HANDLE indicating that pipeline caching is disabled;
-	// TODO: provide the handle of a valid pipeline cache object,
+	// s_pipelineCache lets the driver reuse pipelines compiled by earlier runs,
 	// 1 is the length of the pCreateInfos and pPipelines arrays.
 	//
-	VK_CHECK(qvkCreateGraphicsPipelines(vk.device, VK_NULL_HANDLE, 1, &create_info, NULL, pPipeLine));
+	VK_CHECK(qvkCreateGraphicsPipelines(vk.device, s_pipelineCache, 1, &create_info, NULL, pPipeLine));
+	s_pipelineCacheDirty = VK_TRUE;
 }
 
 static VkPipeline vk_find_pipeline(struct Vk_Pipeline_Def *def) {
@@ -854,6 +1019,11 @@ void vk_destroyGlobalStagePipeline(void) {
 	// because they will be automaticall freed when the descripter pool
 	// is destroyed.
 	qvkDestroyDescriptorPool(vk.device, vk.descriptor_pool, NULL);
+	if (vk.bindless) {
+		qvkDestroyDescriptorSetLayout(vk.device, vk.bindless_set_layout, NULL);
+		qvkDestroyDescriptorPool(vk.device, vk.bindless_pool, NULL);
+		vk.bindless_set = VK_NULL_HANDLE;
+	}
 	//
 	qvkDestroyPipeline(vk.device, g_stdPipelines.skybox_pipeline, NULL);
 	for (i = 0; i < 2; i++)
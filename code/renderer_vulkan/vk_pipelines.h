@@ -7,6 +7,10 @@ void create_standard_pipelines(void);
 void create_pipelines_for_each_stage(shaderStage_t *pStage, shader_t *pShader);
 void vk_createPipelineLayout(void);
 
+void vk_createPipelineCache(void);
+void vk_savePipelineCache(void);
+void vk_destroyPipelineCache(void);
+
 void vk_destroyShaderStagePipeline(void);
 void vk_destroyGlobalStagePipeline(void);
 
@@ -1,4 +1,5 @@
 #include "vk_screenshot.h"
+#include "tr_cvar.h"
 #include "tr_globals.h"
 #include "vk_cmd.h"
 #include "vk_image.h"
@@ -40,28 +41,8 @@ Implementations may support additional limits and capabilities beyond those list
 
 */
 
-static void imgFlipY(unsigned char *pBuf, const uint32_t w, const uint32_t h) {
-	const uint32_t a_row = w * 4;
-	const uint32_t nLines = h / 2;
-
-	unsigned char *pTmp = (unsigned char *)ri.Hunk_AllocateTempMemory(a_row);
-	unsigned char *pSrc = pBuf;
-	unsigned char *pDst = pBuf + w * (h - 1) * 4;
-
-	uint32_t j = 0;
-	for (j = 0; j < nLines; j++) {
-		memcpy(pTmp, pSrc, a_row);
-		memcpy(pSrc, pDst, a_row);
-		memcpy(pDst, pTmp, a_row);
-
-		pSrc += a_row;
-		pDst -= a_row;
-	}
-
-	ri.Hunk_FreeTempMemory(pTmp);
-}
-
-// Just reading the pixels for the GPU MEM, don't care about swizzling
+// Just reading the pixels for the GPU MEM, don't care about swizzling.
+// Waits for the device, only levelshots still use it.
 static void vk_read_pixels(unsigned char *pBuf, uint32_t W, uint32_t H) {
 	const uint32_t sizeFB = W * H * 4;
 
@@ -199,91 +180,354 @@ static void vk_read_pixels(unsigned char *pBuf, uint32_t W, uint32_t H) {
 extern void RE_SaveJPG(char *filename, int quality, int image_width, int image_height, unsigned char *image_buffer,
 					   int padding);
 
-void RB_TakeScreenshot(int width, int height, char *fileName, VkBool32 isJpeg) {
-	const uint32_t cnPixels = width * height;
-	ri.Printf(PRINT_DEVELOPER, "read %dx%d pixels from GPU\n", width, height);
+/*
+==============================================================================
 
-	if (isJpeg) {
+						ASYNC CAPTURE
 
-		// unsigned char *buffer;
-		// size_t offset = 0, memcount;
-		// int padlen;
-		// memcount = (width * 3 + padlen) * height;
-		// RE_SaveJPG(fileName, 90, width, height, buffer + offset, padlen);
-		unsigned char *const pImg = (unsigned char *)ri.Hunk_AllocateTempMemory(cnPixels * 4);
+Screenshots and video frames don't wait for the GPU: the frame's own command
+buffer copies its swapchain image into a host visible buffer once the render
+pass has ended, and the pixels are read back when vk_begin_frame has waited
+for that frame's fence anyway, r_framesInFlight frames later.  The conversion
+to bottom-up RGB or BGR rows runs on r_captureThreads job threads.
+
+==============================================================================
+*/
 
-		vk_read_pixels(pImg, width, height);
+typedef struct {
+	// the window size, the same for the screenshot and the video frame
+	uint32_t width;
+	uint32_t height;
 
-		// but why this is need ? why the readed image got fliped about Y ???
-		imgFlipY(pImg, width, height);
+	VkBool32 video;
+	VkBool32 motionJpeg;
+	unsigned char *encodeBuffer; // the client's, reused for every frame
 
-		// Remove alpha channel and rbg <-> bgr
-		{
-			unsigned char *pSrc = pImg;
-			unsigned char *pDst = pImg;
+	VkBool32 screenshot;
+	VkBool32 jpeg;
+	char fileName[MAX_OSPATH];
+} captureRequest_t;
 
-			uint32_t i;
-			for (i = 0; i < cnPixels; i++) {
-				pSrc[0] = pDst[2];
-				pSrc[1] = pDst[1];
-				pSrc[2] = pDst[0];
-				pSrc += 3;
-				pDst += 4;
+typedef struct {
+	VkBuffer buffer;
+	VkDeviceMemory memory;
+	unsigned char *data; // persistently mapped
+	uint32_t size;
+
+	// copy recorded into the frame's command buffer, not read back yet
+	VkBool32 pending;
+	uint32_t width;
+	uint32_t height;
+	captureRequest_t request;
+} captureSlot_t;
+
+// what the frame being recorded should capture
+static captureRequest_t s_request;
+static captureSlot_t s_captures[MAX_FRAMES_IN_FLIGHT];
+
+typedef struct {
+	const unsigned char *src; // BGRA, top row first
+	unsigned char *dst;		  // 3 bytes per pixel, bottom row first
+	uint32_t width;
+	uint32_t height;
+	uint32_t dstStride;
+	VkBool32 rgb; // swap to RGB for the JPEG encoder, TGA and raw AVI take BGR
+} captureConvert_t;
+
+#define CAPTURE_JOB_ROWS 64
+
+static void R_ConvertCaptureJob(void *data, int index) {
+	const captureConvert_t *job = (const captureConvert_t *)data;
+	const uint32_t yEnd = MIN((uint32_t)(index + 1) * CAPTURE_JOB_ROWS, job->height);
+	const uint32_t padding = job->dstStride - job->width * 3;
+	uint32_t x, y;
+
+	for (y = index * CAPTURE_JOB_ROWS; y < yEnd; y++) {
+		const unsigned char *pSrc = job->src + y * job->width * 4;
+		unsigned char *pDst = job->dst + (job->height - 1 - y) * job->dstStride;
+
+		if (job->rgb) {
+			for (x = 0; x < job->width; x++, pSrc += 4, pDst += 3) {
+				pDst[0] = pSrc[2];
+				pDst[1] = pSrc[1];
+				pDst[2] = pSrc[0];
+			}
+		} else {
+			for (x = 0; x < job->width; x++, pSrc += 4, pDst += 3) {
+				pDst[0] = pSrc[0];
+				pDst[1] = pSrc[1];
+				pDst[2] = pSrc[2];
 			}
 		}
+		memset(pDst, 0, padding);
+	}
+}
 
-		RE_SaveJPG(fileName, 90, width, height, pImg, 0);
+static void R_ConvertCapture(const captureSlot_t *slot, unsigned char *dst, uint32_t dstStride, VkBool32 rgb) {
+	captureConvert_t job;
 
-		ri.Hunk_FreeTempMemory(pImg);
+	job.src = slot->data;
+	job.dst = dst;
+	job.width = slot->width;
+	job.height = slot->height;
+	job.dstStride = dstStride;
+	job.rgb = rgb;
 
-		// bufSize = RE_SaveJPGToBuffer(out, bufSize, 90, width, height, pImg, padding);
-		// ri.FS_WriteFile(filename, out, bufSize);
-	} else {
-		// const uint32_t cnPixels = width * height;
-		const uint32_t imgSize = 18 + cnPixels * 3;
-		uint32_t i;
+	ri.RunJobs(R_ConvertCaptureJob, &job, (slot->height + CAPTURE_JOB_ROWS - 1) / CAPTURE_JOB_ROWS,
+			   MAX(r_captureThreads->integer, 1));
+}
+
+static void vk_createCaptureBuffer(captureSlot_t *slot, uint32_t size) {
+	VkBufferCreateInfo buffer_create_info;
+	VkMemoryRequirements memory_requirements;
+	VkMemoryAllocateInfo memory_allocate_info;
+
+	memset(&buffer_create_info, 0, sizeof(buffer_create_info));
+	buffer_create_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+	buffer_create_info.size = size;
+	buffer_create_info.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+	VK_CHECK(qvkCreateBuffer(vk.device, &buffer_create_info, NULL, &slot->buffer));
+
+	qvkGetBufferMemoryRequirements(vk.device, slot->buffer, &memory_requirements);
+
+	memset(&memory_allocate_info, 0, sizeof(memory_allocate_info));
+	memory_allocate_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+	memory_allocate_info.allocationSize = memory_requirements.size;
+	memory_allocate_info.memoryTypeIndex =
+		find_memory_type(memory_requirements.memoryTypeBits,
+						 VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+	VK_CHECK(qvkAllocateMemory(vk.device, &memory_allocate_info, NULL, &slot->memory));
+	VK_CHECK(qvkBindBufferMemory(vk.device, slot->buffer, slot->memory, 0));
+	VK_CHECK(qvkMapMemory(vk.device, slot->memory, 0, VK_WHOLE_SIZE, 0, (void **)&slot->data));
+
+	slot->size = size;
+}
+
+static void vk_destroyCaptureBuffer(captureSlot_t *slot) {
+	if (slot->buffer == VK_NULL_HANDLE)
+		return;
+
+	qvkUnmapMemory(vk.device, slot->memory);
+	qvkFreeMemory(vk.device, slot->memory, NULL);
+	qvkDestroyBuffer(vk.device, slot->buffer, NULL);
 
-		unsigned char *const pBuffer = (unsigned char *)ri.Hunk_AllocateTempMemory(imgSize + cnPixels * 4);
-		unsigned char *const buffer_ptr = pBuffer + 18;
-		unsigned char *const pImg = pBuffer + imgSize;
+	slot->buffer = VK_NULL_HANDLE;
+	slot->memory = VK_NULL_HANDLE;
+	slot->data = NULL;
+	slot->size = 0;
+}
+
+static void R_WriteScreenshot(const captureSlot_t *slot) {
+	const uint32_t cnPixels = slot->width * slot->height;
 
-		vk_read_pixels(pImg, width, height);
+	if (slot->request.jpeg) {
+		unsigned char *const pImg = (unsigned char *)ri.Hunk_AllocateTempMemory(cnPixels * 3);
 
-		// but why this is need ? why the readed image got fliped about Y ???
-		imgFlipY(pImg, width, height);
+		R_ConvertCapture(slot, pImg, slot->width * 3, VK_TRUE);
+		RE_SaveJPG((char *)slot->request.fileName, 90, slot->width, slot->height, pImg, 0);
+
+		ri.Hunk_FreeTempMemory(pImg);
+	} else {
+		const uint32_t imgSize = 18 + cnPixels * 3;
+		unsigned char *const pBuffer = (unsigned char *)ri.Hunk_AllocateTempMemory(imgSize);
 
 		memset(pBuffer, 0, 18);
 		pBuffer[2] = 2; // uncompressed type
-		pBuffer[12] = width & 255;
-		pBuffer[13] = width >> 8;
-		pBuffer[14] = height & 255;
-		pBuffer[15] = height >> 8;
+		pBuffer[12] = slot->width & 255;
+		pBuffer[13] = slot->width >> 8;
+		pBuffer[14] = slot->height & 255;
+		pBuffer[15] = slot->height >> 8;
 		pBuffer[16] = 24; // pixel size
 
-		//    VkBool32 need_swizzle = (
-		//            vk.surface_format.format == VK_FORMAT_B8G8R8A8_SRGB ||
-		//            vk.surface_format.format == VK_FORMAT_B8G8R8A8_UNORM ||
-		//           vk.surface_format.format == VK_FORMAT_B8G8R8A8_SNORM );
-
-		if (0) {
-			for (i = 0; i < cnPixels; i++) {
-				buffer_ptr[i * 3] = *(pImg + i * 4 + 2);
-				buffer_ptr[i * 3 + 1] = *(pImg + i * 4 + 1);
-				buffer_ptr[i * 3 + 2] = *(pImg + i * 4);
-			}
-		} else {
-			for (i = 0; i < cnPixels; i++) {
-				buffer_ptr[i * 3] = *(pImg + i * 4);
-				buffer_ptr[i * 3 + 1] = *(pImg + i * 4 + 1);
-				buffer_ptr[i * 3 + 2] = *(pImg + i * 4 + 2);
-			}
-		}
-		ri.FS_WriteFile(fileName, pBuffer, imgSize);
+		R_ConvertCapture(slot, pBuffer + 18, slot->width * 3, VK_FALSE);
+		ri.FS_WriteFile(slot->request.fileName, pBuffer, imgSize);
 
 		ri.Hunk_FreeTempMemory(pBuffer);
 	}
 }
 
+static void R_WriteVideoFrame(const captureSlot_t *slot) {
+	const uint32_t linelen = slot->width * 3;
+	// AVI line padding
+	const uint32_t avipadwidth = PAD(linelen, 4);
+	size_t memcount;
+
+	if (slot->request.motionJpeg) {
+		unsigned char *const pImg = (unsigned char *)ri.Hunk_AllocateTempMemory(linelen * slot->height);
+
+		R_ConvertCapture(slot, pImg, linelen, VK_TRUE);
+		memcount = RE_SaveJPGToBuffer(slot->request.encodeBuffer, linelen * slot->height, 90, slot->width,
+									  slot->height, pImg, 0);
+		ri.CL_WriteAVIVideoFrame(slot->request.encodeBuffer, memcount);
+
+		ri.Hunk_FreeTempMemory(pImg);
+	} else {
+		R_ConvertCapture(slot, slot->request.encodeBuffer, avipadwidth, VK_FALSE);
+		ri.CL_WriteAVIVideoFrame(slot->request.encodeBuffer, avipadwidth * slot->height);
+	}
+}
+
+static void R_FinishCapture(captureSlot_t *slot) {
+	if (!slot->pending)
+		return;
+
+	if (slot->request.screenshot)
+		R_WriteScreenshot(slot);
+
+	if (slot->request.video)
+		R_WriteVideoFrame(slot);
+
+	slot->pending = VK_FALSE;
+}
+
+/*
+==================
+vk_recordCapture
+
+Called by vk_end_frame after the render pass, the swapchain image is in
+VK_IMAGE_LAYOUT_PRESENT_SRC_KHR and is given back in it.
+==================
+*/
+void vk_recordCapture(void) {
+	captureSlot_t *slot = &s_captures[vk.cur_frame];
+	VkImage image = vk.swapchain_images_array[vk.idx_swapchain_image];
+	VkBufferImageCopy image_copy;
+	VkImageMemoryBarrier image_barrier;
+	VkBufferMemoryBarrier buffer_barrier;
+	uint32_t size;
+
+	if (!s_request.video && !s_request.screenshot)
+		return;
+
+	// read back by this frame's vk_begin_frame, before the slot was reused
+	assert(!slot->pending);
+
+	slot->width = s_request.width;
+	slot->height = s_request.height;
+
+	size = slot->width * slot->height * 4;
+	if (size > slot->size) {
+		vk_destroyCaptureBuffer(slot);
+		vk_createCaptureBuffer(slot, size);
+	}
+
+	image_barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+	image_barrier.pNext = NULL;
+	image_barrier.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+	image_barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+	image_barrier.oldLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+	image_barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+	image_barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	image_barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	image_barrier.image = image;
+	image_barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+	image_barrier.subresourceRange.baseMipLevel = 0;
+	image_barrier.subresourceRange.levelCount = 1;
+	image_barrier.subresourceRange.baseArrayLayer = 0;
+	image_barrier.subresourceRange.layerCount = 1;
+
+	qvkCmdPipelineBarrier(vk.command_buffer, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+						  VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, NULL, 0, NULL, 1, &image_barrier);
+
+	image_copy.bufferOffset = 0;
+	image_copy.bufferRowLength = slot->width;
+	image_copy.bufferImageHeight = slot->height;
+	image_copy.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+	image_copy.imageSubresource.mipLevel = 0;
+	image_copy.imageSubresource.baseArrayLayer = 0;
+	image_copy.imageSubresource.layerCount = 1;
+	image_copy.imageOffset.x = 0;
+	image_copy.imageOffset.y = 0;
+	image_copy.imageOffset.z = 0;
+	image_copy.imageExtent.width = slot->width;
+	image_copy.imageExtent.height = slot->height;
+	image_copy.imageExtent.depth = 1;
+
+	qvkCmdCopyImageToBuffer(vk.command_buffer, image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, slot->buffer, 1,
+							&image_copy);
+
+	// back to presentation, and make the copy visible to the host once the fence signals
+	image_barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+	image_barrier.dstAccessMask = 0;
+	image_barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+	image_barrier.newLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+
+	buffer_barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+	buffer_barrier.pNext = NULL;
+	buffer_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+	buffer_barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+	buffer_barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	buffer_barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	buffer_barrier.buffer = slot->buffer;
+	buffer_barrier.offset = 0;
+	buffer_barrier.size = VK_WHOLE_SIZE;
+
+	qvkCmdPipelineBarrier(vk.command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT,
+						  VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT | VK_PIPELINE_STAGE_HOST_BIT, 0, 0, NULL, 1,
+						  &buffer_barrier, 1, &image_barrier);
+
+	slot->request = s_request;
+	slot->pending = VK_TRUE;
+
+	memset(&s_request, 0, sizeof(s_request));
+}
+
+/*
+==================
+vk_readCaptures
+
+Called by vk_begin_frame once the fence of vk.cur_frame has signaled.
+==================
+*/
+void vk_readCaptures(void) {
+	R_FinishCapture(&s_captures[vk.cur_frame]);
+}
+
+/*
+==================
+vk_finishCaptures
+
+Writes out the captures still in flight, oldest first.
+==================
+*/
+void vk_finishCaptures(void) {
+	uint32_t i;
+
+	qvkDeviceWaitIdle(vk.device);
+
+	for (i = 1; i <= MAX_FRAMES_IN_FLIGHT; i++) {
+		R_FinishCapture(&s_captures[(vk.cur_frame + i) % MAX_FRAMES_IN_FLIGHT]);
+	}
+}
+
+/*
+==================
+vk_destroyCaptures
+==================
+*/
+void vk_destroyCaptures(void) {
+	uint32_t i;
+
+	vk_finishCaptures();
+
+	for (i = 0; i < MAX_FRAMES_IN_FLIGHT; i++) {
+		vk_destroyCaptureBuffer(&s_captures[i]);
+	}
+
+	memset(&s_request, 0, sizeof(s_request));
+}
+
+void RB_TakeScreenshot(int width, int height, char *fileName, VkBool32 isJpeg) {
+	ri.Printf(PRINT_DEVELOPER, "read %dx%d pixels from GPU\n", width, height);
+
+	s_request.width = width;
+	s_request.height = height;
+	s_request.screenshot = VK_TRUE;
+	s_request.jpeg = isJpeg;
+	Q_strncpyz(s_request.fileName, fileName, sizeof(s_request.fileName));
+}
+
 static void R_TakeScreenshot(int x, int y, int width, int height, char *name, qboolean jpeg) {
 	static char fileName[MAX_OSPATH] = {0}; // bad things if two screenshots per frame?
 
@@ -522,59 +766,11 @@ void R_ScreenShotJPEG_f(void) {
 }
 
 void RB_TakeVideoFrameCmd(const videoFrameCommand_t *const cmd) {
-	size_t memcount, linelen;
-	int padwidth, avipadwidth, padlen;
-	unsigned char *pImg;
-
-	linelen = cmd->width * 3;
-
-	// Alignment stuff for glReadPixels
-	padwidth = PAD(linelen, 4);
-	padlen = padwidth - linelen;
-	// AVI line padding
-	avipadwidth = PAD(linelen, 4);
-
-	pImg = (unsigned char *)ri.Hunk_AllocateTempMemory(cmd->width * cmd->height * 4);
-
-	vk_read_pixels(pImg, cmd->width, cmd->height);
-
-	imgFlipY(pImg, cmd->width, cmd->height);
-
-	memcount = padwidth * cmd->height;
-
-	if (cmd->motionJpeg) {
-		const uint32_t cnPixels = cmd->width * cmd->height;
-		unsigned char *pSrc = pImg;
-		const unsigned char *pDst = pImg;
-		uint32_t i;
-		for (i = 0; i < cnPixels; i++) {
-			pSrc[0] = pDst[2];
-			pSrc[1] = pDst[1];
-			pSrc[2] = pDst[0];
-			pSrc += 3;
-			pDst += 4;
-		}
-
-		memcount =
-			RE_SaveJPGToBuffer(cmd->encodeBuffer, linelen * cmd->height, 90, cmd->width, cmd->height, pImg, padlen);
-
-		ri.CL_WriteAVIVideoFrame(cmd->encodeBuffer, memcount);
-	} else {
-		unsigned char *buffer_ptr = cmd->encodeBuffer;
-		const unsigned char *buffer2_ptr = pImg;
-		uint32_t i;
-		for (i = 0; i < cmd->width * cmd->height; i++) {
-			buffer_ptr[0] = buffer2_ptr[0];
-			buffer_ptr[1] = buffer2_ptr[1];
-			buffer_ptr[2] = buffer2_ptr[2];
-			buffer_ptr += 3;
-			buffer2_ptr += 4;
-		}
-
-		ri.CL_WriteAVIVideoFrame(cmd->encodeBuffer, avipadwidth * cmd->height);
-	}
-
-	free(pImg);
+	s_request.width = cmd->width;
+	s_request.height = cmd->height;
+	s_request.video = VK_TRUE;
+	s_request.motionJpeg = cmd->motionJpeg;
+	s_request.encodeBuffer = cmd->encodeBuffer;
 }
 
 void RE_TakeVideoFrame(int width, int height, unsigned char *captureBuffer, unsigned char *encodeBuffer,
@@ -597,3 +793,11 @@ void RE_TakeVideoFrame(int width, int height, unsigned char *captureBuffer, unsi
 	cmd->encodeBuffer = encodeBuffer;
 	cmd->motionJpeg = motionJpeg;
 }
+
+void RE_FinishVideoFrames(void) {
+	if (!tr.registered) {
+		return;
+	}
+
+	vk_finishCaptures();
+}
@@ -26,7 +26,13 @@ typedef struct {
 	VkBool32 motionJpeg;
 } videoFrameCommand_t;
 
+// both only queue a capture of the frame being recorded, see vk_recordCapture
 void RB_TakeVideoFrameCmd(const videoFrameCommand_t *const cmd);
 void RB_TakeScreenshot(int width, int height, char *fileName, VkBool32 isJpeg);
 
+void vk_recordCapture(void);
+void vk_readCaptures(void);
+void vk_finishCaptures(void);
+void vk_destroyCaptures(void);
+
 #endif
@@ -10,38 +10,70 @@
 #include "vk_image.h"
 #include "vk_instance.h"
 #include "vk_pipelines.h"
+#include "vk_world_buffer.h"
 
-#define VERTEX_CHUNK_SIZE (768 * 1024)
-#define INDEX_BUFFER_SIZE (2 * 1024 * 1024)
+// Geometry is streamed into host visible buffers, one set for each frame in
+// flight, that are rewound when their frame comes around again. Their capacity
+// starts at r_streamVertexes / r_streamIndexes and doubles when a frame runs out
+// of space; the outgrown buffers are kept until the frame that references them
+// has finished.
 
-#define XYZ_SIZE (4 * VERTEX_CHUNK_SIZE)
-#define COLOR_SIZE (1 * VERTEX_CHUNK_SIZE)
-#define ST0_SIZE (2 * VERTEX_CHUNK_SIZE)
-#define ST1_SIZE (2 * VERTEX_CHUNK_SIZE)
+// each stream starts on its own aligned range of the vertex buffer
+#define STREAM_ALIGN 256
+#define MAX_RETIRED_BUFFERS 16
 
 #define XYZ_OFFSET 0
-#define COLOR_OFFSET (XYZ_OFFSET + XYZ_SIZE)
-#define ST0_OFFSET (COLOR_OFFSET + COLOR_SIZE)
-#define ST1_OFFSET (ST0_OFFSET + ST0_SIZE)
+#define COLOR_OFFSET (shadingDat.cur->color_offset)
+#define ST0_OFFSET (shadingDat.cur->st0_offset)
+#define ST1_OFFSET (shadingDat.cur->st1_offset)
 
-struct ShadingData_t {
+struct RetiredBuffer_t {
+	VkBuffer buffer;
+	VkDeviceMemory memory;
+};
+
+// the stream buffers of one frame in flight
+struct StreamBuffer_t {
 	// Buffers represent linear arrays of data which are used for various purposes
 	// by binding them to a graphics or compute pipeline via descriptor sets or
 	// via certain commands,  or by directly specifying them as parameters to
 	// certain commands. Buffers are represented by VkBuffer handles:
 	VkBuffer vertex_buffer;
 	unsigned char *vertex_buffer_ptr; // pointer to mapped vertex buffer
-	uint32_t xyz_elements;
-	uint32_t color_st_elements;
+
+	uint32_t max_vertexes;
+	VkDeviceSize color_offset;
+	VkDeviceSize st0_offset;
+	VkDeviceSize st1_offset;
 
 	VkBuffer index_buffer;
 	unsigned char *index_buffer_ptr; // pointer to mapped index buffer
-	uint32_t index_buffer_offset;
+	uint32_t index_buffer_size;
 
 	// host visible memory that holds both vertex and index data
 	VkDeviceMemory vertex_buffer_memory;
 	VkDeviceMemory index_buffer_memory;
+
+	// outgrown buffers still referenced by the frame
+	struct RetiredBuffer_t retired[MAX_RETIRED_BUFFERS];
+	uint32_t num_retired;
+};
+
+struct ShadingData_t {
+	struct StreamBuffer_t streams[MAX_FRAMES_IN_FLIGHT];
+	struct StreamBuffer_t *cur; // streams[vk.cur_frame]
+
+	uint32_t xyz_elements;
+	uint32_t color_st_elements;
+	uint32_t index_buffer_offset;
+
 	VkDescriptorSet curDescriptorSets[2];
+	uint32_t curTextures[2]; // image->index, for the bindless set
+
+	// what vk.command_buffer has bound, rebinding is skipped when it did not change
+	VkDescriptorSet boundDescriptorSets[2];
+	uint32_t boundTextures[2];
+	VkBool32 bindlessBound;
 
 	// This flag is used to decide whether framebuffer's depth attachment should be cleared
 	// with vmCmdClearAttachment (dirty_depth_attachment == true), or it have just been
@@ -53,7 +85,7 @@ struct ShadingData_t {
 struct ShadingData_t shadingDat;
 
 VkBuffer vk_getIndexBuffer(void) {
-	return shadingDat.index_buffer;
+	return shadingDat.cur->index_buffer;
 }
 
 static float s_modelview_matrix[16] QALIGN(16);
@@ -169,34 +201,32 @@ VkRect2D get_scissor_rect(void) {
 //
 // Host access to buffer must be externally synchronized
 
-void vk_createVertexBuffer(void) {
-	VkMemoryRequirements vb_memory_requirements;
+static void vk_createStreamBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkBuffer *pBuf,
+								  VkDeviceMemory *pMem, unsigned char **ppData) {
+	VkMemoryRequirements memory_requirements;
 	VkMemoryAllocateInfo alloc_info;
 	VkBufferCreateInfo desc;
 	uint32_t memory_type_bits;
 	void *data;
 
-	ri.Printf(PRINT_DEVELOPER, " Create vertex buffer: shadingDat.vertex_buffer \n");
-
 	desc.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
 	desc.pNext = NULL;
 	desc.flags = 0;
 	desc.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
 	desc.queueFamilyIndexCount = 0;
 	desc.pQueueFamilyIndices = NULL;
-	// VERTEX_BUFFER_SIZE
-	desc.size = XYZ_SIZE + COLOR_SIZE + ST0_SIZE + ST1_SIZE;
-	desc.usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
+	desc.size = size;
+	desc.usage = usage;
 
-	VK_CHECK(qvkCreateBuffer(vk.device, &desc, NULL, &shadingDat.vertex_buffer));
+	VK_CHECK(qvkCreateBuffer(vk.device, &desc, NULL, pBuf));
 
-	qvkGetBufferMemoryRequirements(vk.device, shadingDat.vertex_buffer, &vb_memory_requirements);
+	qvkGetBufferMemoryRequirements(vk.device, *pBuf, &memory_requirements);
 
-	memory_type_bits = vb_memory_requirements.memoryTypeBits;
+	memory_type_bits = memory_requirements.memoryTypeBits;
 
 	alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
 	alloc_info.pNext = NULL;
-	alloc_info.allocationSize = vb_memory_requirements.size;
+	alloc_info.allocationSize = memory_requirements.size;
 	// VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT bit specifies that memory allocated with
 	// this type can be mapped for host access using vkMapMemory.
 	//
@@ -207,60 +237,101 @@ void vk_createVertexBuffer(void) {
 	alloc_info.memoryTypeIndex =
 		find_memory_type(memory_type_bits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
 
-	ri.Printf(PRINT_ALL, " Allocate device memory for Vertex Buffer: %ld bytes. \n", alloc_info.allocationSize);
+	ri.Printf(PRINT_DEVELOPER, " Allocate device memory for %s Buffer: %ld bytes. \n",
+			  (usage & VK_BUFFER_USAGE_INDEX_BUFFER_BIT) ? "Index" : "Vertex", alloc_info.allocationSize);
+
+	VK_CHECK(qvkAllocateMemory(vk.device, &alloc_info, NULL, pMem));
+
+	qvkBindBufferMemory(vk.device, *pBuf, *pMem, 0);
+
+	VK_CHECK(qvkMapMemory(vk.device, *pMem, 0, VK_WHOLE_SIZE, 0, &data));
+	*ppData = (unsigned char *)data;
+}
 
-	VK_CHECK(qvkAllocateMemory(vk.device, &alloc_info, NULL, &shadingDat.vertex_buffer_memory));
+static void vk_allocVertexBuffer(struct StreamBuffer_t *sb, uint32_t maxVertexes) {
+	sb->max_vertexes = maxVertexes;
+	sb->color_offset = PAD(XYZ_OFFSET + maxVertexes * sizeof(vec4_t), STREAM_ALIGN);
+	sb->st0_offset = PAD(sb->color_offset + maxVertexes * sizeof(color4ub_t), STREAM_ALIGN);
+	sb->st1_offset = PAD(sb->st0_offset + maxVertexes * sizeof(vec2_t), STREAM_ALIGN);
 
-	qvkBindBufferMemory(vk.device, shadingDat.vertex_buffer, shadingDat.vertex_buffer_memory, 0);
+	vk_createStreamBuffer(sb->st1_offset + maxVertexes * sizeof(vec2_t), VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+						  &sb->vertex_buffer, &sb->vertex_buffer_memory, &sb->vertex_buffer_ptr);
 
-	VK_CHECK(qvkMapMemory(vk.device, shadingDat.vertex_buffer_memory, 0, VK_WHOLE_SIZE, 0, &data));
-	shadingDat.vertex_buffer_ptr = (unsigned char *)data;
+	shadingDat.xyz_elements = 0;
+	shadingDat.color_st_elements = 0;
+}
+
+static void vk_allocIndexBuffer(struct StreamBuffer_t *sb, uint32_t size) {
+	sb->index_buffer_size = size;
+
+	vk_createStreamBuffer(size, VK_BUFFER_USAGE_INDEX_BUFFER_BIT, &sb->index_buffer, &sb->index_buffer_memory,
+						  &sb->index_buffer_ptr);
+
+	shadingDat.index_buffer_offset = 0;
+}
+
+void vk_createVertexBuffer(void) {
+	uint32_t i;
+
+	ri.Printf(PRINT_DEVELOPER, " Create vertex buffers: shadingDat.streams[].vertex_buffer \n");
+
+	for (i = 0; i < vk.num_frames; i++) {
+		vk_allocVertexBuffer(&shadingDat.streams[i], MAX(r_streamVertexes->integer, SHADER_MAX_VERTEXES));
+	}
+	shadingDat.cur = &shadingDat.streams[vk.cur_frame];
 }
 
 void vk_createIndexBuffer(void) {
-	VkBufferCreateInfo desc;
-	uint32_t memory_type_bits;
-	VkMemoryRequirements ib_memory_requirements;
-	VkMemoryAllocateInfo alloc_info;
-	void *data;
+	uint32_t i;
 
-	ri.Printf(PRINT_DEVELOPER, " Create index buffer: shadingDat.index_buffer \n");
+	ri.Printf(PRINT_DEVELOPER, " Create index buffers: shadingDat.streams[].index_buffer \n");
 
-	desc.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-	desc.pNext = NULL;
-	desc.flags = 0;
-	desc.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-	desc.queueFamilyIndexCount = 0;
-	desc.pQueueFamilyIndices = NULL;
-	desc.size = INDEX_BUFFER_SIZE;
-	desc.usage = VK_BUFFER_USAGE_INDEX_BUFFER_BIT;
+	for (i = 0; i < vk.num_frames; i++) {
+		vk_allocIndexBuffer(&shadingDat.streams[i], MAX(r_streamIndexes->integer, SHADER_MAX_INDEXES) * sizeof(uint32_t));
+	}
+	shadingDat.cur = &shadingDat.streams[vk.cur_frame];
+}
 
-	VK_CHECK(qvkCreateBuffer(vk.device, &desc, NULL, &shadingDat.index_buffer));
+// The old buffer stays bound to the commands recorded so far, it is released
+// by vk_resetGeometryBuffer once the frame using it is done.
+static void vk_retireBuffer(VkBuffer buffer, VkDeviceMemory memory) {
+	struct StreamBuffer_t *sb = shadingDat.cur;
 
-	qvkGetBufferMemoryRequirements(vk.device, shadingDat.index_buffer, &ib_memory_requirements);
+	if (sb->num_retired == MAX_RETIRED_BUFFERS) {
+		ri.Error(ERR_FATAL, "vulkan: too many stream buffer reallocations in one frame\n");
+	}
 
-	memory_type_bits = ib_memory_requirements.memoryTypeBits;
+	qvkUnmapMemory(vk.device, memory);
 
-	alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-	alloc_info.pNext = NULL;
-	alloc_info.allocationSize = ib_memory_requirements.size;
-	// VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT bit specifies that memory allocated with
-	// this type can be mapped for host access using vkMapMemory.
-	//
-	// VK_MEMORY_PROPERTY_HOST_COHERENT_BIT bit specifies that the host cache
-	// management commands vkFlushMappedMemoryRanges and vkInvalidateMappedMemoryRanges
-	// are not needed to flush host writes to the device or make device writes visible
-	// to the host, respectively.
-	alloc_info.memoryTypeIndex =
-		find_memory_type(memory_type_bits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+	sb->retired[sb->num_retired].buffer = buffer;
+	sb->retired[sb->num_retired].memory = memory;
+	sb->num_retired++;
+}
 
-	ri.Printf(PRINT_ALL, " Allocate device memory for Index Buffer: %ld bytes. \n", alloc_info.allocationSize);
+static void vk_growVertexBuffer(uint32_t nVertex) {
+	uint32_t maxVertexes = shadingDat.cur->max_vertexes * 2;
 
-	VK_CHECK(qvkAllocateMemory(vk.device, &alloc_info, NULL, &shadingDat.index_buffer_memory));
-	qvkBindBufferMemory(vk.device, shadingDat.index_buffer, shadingDat.index_buffer_memory, 0);
+	if (maxVertexes < nVertex) {
+		maxVertexes = nVertex;
+	}
+
+	ri.Printf(PRINT_DEVELOPER, "vulkan: growing vertex stream to %u vertexes\n", maxVertexes);
 
-	VK_CHECK(qvkMapMemory(vk.device, shadingDat.index_buffer_memory, 0, VK_WHOLE_SIZE, 0, &data));
-	shadingDat.index_buffer_ptr = (unsigned char *)data;
+	vk_retireBuffer(shadingDat.cur->vertex_buffer, shadingDat.cur->vertex_buffer_memory);
+	vk_allocVertexBuffer(shadingDat.cur, maxVertexes);
+}
+
+static void vk_growIndexBuffer(uint32_t size) {
+	uint32_t newSize = shadingDat.cur->index_buffer_size * 2;
+
+	if (newSize < size) {
+		newSize = size;
+	}
+
+	ri.Printf(PRINT_DEVELOPER, "vulkan: growing index stream to %u bytes\n", newSize);
+
+	vk_retireBuffer(shadingDat.cur->index_buffer, shadingDat.cur->index_buffer_memory);
+	vk_allocIndexBuffer(shadingDat.cur, newSize);
 }
 
 // Descriptors and Descriptor Sets
@@ -283,52 +354,65 @@ void vk_createIndexBuffer(void) {
 // the renderer front end should never modify glstate_t
 // typedef struct {
 
-void updateCurDescriptor(VkDescriptorSet curDesSet, uint32_t tmu) {
-	shadingDat.curDescriptorSets[tmu] = curDesSet;
+void updateCurDescriptor(const image_t *image, uint32_t tmu) {
+	shadingDat.curDescriptorSets[tmu] = image->descriptor_set;
+	shadingDat.curTextures[tmu] = image->index;
 }
 
-void vk_shade_geometry(VkPipeline pipeline, VkBool32 multitexture, enum Vk_Depth_Range depRg, VkBool32 indexed) {
-	// configure vertex data stream
-	VkBuffer bufs[3] = {shadingDat.vertex_buffer, shadingDat.vertex_buffer, shadingDat.vertex_buffer};
-	VkDeviceSize offs[3] = {COLOR_OFFSET + shadingDat.color_st_elements * sizeof(color4ub_t),
-							ST0_OFFSET + shadingDat.color_st_elements * sizeof(vec2_t),
-							ST1_OFFSET + shadingDat.color_st_elements * sizeof(vec2_t)};
-	unsigned char *dst_color;
-	unsigned char *dst_st0;
-
-	VkViewport viewport;
-	VkRect2D scissor; // = get_scissor_rect();
-
-	// color
-	if ((shadingDat.color_st_elements + tess.numVertexes) * sizeof(color4ub_t) > COLOR_SIZE)
-		ri.Error(ERR_DROP, "vulkan: vertex buffer overflow (color) %ld \n",
-				 (shadingDat.color_st_elements + tess.numVertexes) * sizeof(color4ub_t));
+// Forget what the command buffer has bound, for a new command buffer or
+// when a bound descriptor set was freed and its handle may be reused.
+void vk_resetDescriptorBinding(void) {
+	shadingDat.boundDescriptorSets[0] = shadingDat.boundDescriptorSets[1] = VK_NULL_HANDLE;
+	shadingDat.boundTextures[0] = shadingDat.boundTextures[1] = ~0u;
+	shadingDat.bindlessBound = VK_FALSE;
+}
 
-	dst_color = shadingDat.vertex_buffer_ptr + offs[0];
-	memcpy(dst_color, tess.svars.colors, tess.numVertexes * sizeof(color4ub_t));
-	// st0
+static void vk_bindDescriptors(VkBool32 multitexture) {
+	const uint32_t count = multitexture ? 2 : 1;
 
-	dst_st0 = shadingDat.vertex_buffer_ptr + offs[1];
-	memcpy(dst_st0, tess.svars.texcoords[0], tess.numVertexes * sizeof(vec2_t));
+	if (vk.bindless) {
+		// the set never changes, the textures are indices pushed for the fragment stage
+		if (!shadingDat.bindlessBound) {
+			qvkCmdBindDescriptorSets(vk.command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, vk.pipeline_layout, 0, 1,
+									 &vk.bindless_set, 0, NULL);
+			shadingDat.bindlessBound = VK_TRUE;
+		}
 
-	// st1
-	if (multitexture) {
-		unsigned char *dst = shadingDat.vertex_buffer_ptr + offs[2];
-		memcpy(dst, tess.svars.texcoords[1], tess.numVertexes * sizeof(vec2_t));
+		if (shadingDat.curTextures[0] != shadingDat.boundTextures[0] ||
+			(multitexture && shadingDat.curTextures[1] != shadingDat.boundTextures[1])) {
+			shadingDat.boundTextures[0] = shadingDat.curTextures[0];
+			shadingDat.boundTextures[1] = shadingDat.curTextures[1];
+			qvkCmdPushConstants(vk.command_buffer, vk.pipeline_layout, VK_SHADER_STAGE_FRAGMENT_BIT, 128,
+								sizeof(shadingDat.boundTextures), shadingDat.boundTextures);
+		}
+		return;
 	}
 
-	qvkCmdBindVertexBuffers(vk.command_buffer, 1, multitexture ? 3 : 2, bufs, offs);
-	shadingDat.color_st_elements += tess.numVertexes;
-
-	// bind descriptor sets
-
 	//    vkCmdBindDescriptorSets causes the sets numbered [firstSet.. firstSet+descriptorSetCount-1] to use
 	//    the bindings stored in pDescriptorSets[0..descriptorSetCount-1] for subsequent rendering commands
 	//    (either compute or graphics, according to the pipelineBindPoint).
 	//    Any bindings that were previously applied via these sets are no longer valid.
+	//    All pipelines share vk.pipeline_layout, so binding a pipeline keeps the sets.
 
-	qvkCmdBindDescriptorSets(vk.command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, vk.pipeline_layout, 0,
-							 (multitexture ? 2 : 1), shadingDat.curDescriptorSets, 0, NULL);
+	if (shadingDat.curDescriptorSets[0] == shadingDat.boundDescriptorSets[0] &&
+		(!multitexture || shadingDat.curDescriptorSets[1] == shadingDat.boundDescriptorSets[1]))
+		return;
+
+	qvkCmdBindDescriptorSets(vk.command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, vk.pipeline_layout, 0, count,
+							 shadingDat.curDescriptorSets, 0, NULL);
+
+	shadingDat.boundDescriptorSets[0] = shadingDat.curDescriptorSets[0];
+	if (multitexture)
+		shadingDat.boundDescriptorSets[1] = shadingDat.curDescriptorSets[1];
+}
+
+// descriptor sets, pipeline and dynamic state for the next draw
+static void vk_bindDrawState(VkPipeline pipeline, VkBool32 multitexture, enum Vk_Depth_Range depRg) {
+	VkViewport viewport;
+	VkRect2D scissor; // = get_scissor_rect();
+
+	// bind descriptor sets
+	vk_bindDescriptors(multitexture);
 
 	// bind pipeline
 	qvkCmdBindPipeline(vk.command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
@@ -343,6 +427,43 @@ void vk_shade_geometry(VkPipeline pipeline, VkBool32 multitexture, enum Vk_Depth
 	if (tess.shader->polygonOffset) {
 		qvkCmdSetDepthBias(vk.command_buffer, r_offsetUnits->value, 0.0f, r_offsetFactor->value);
 	}
+}
+
+void vk_shade_geometry(VkPipeline pipeline, VkBool32 multitexture, enum Vk_Depth_Range depRg, VkBool32 indexed) {
+	// configure vertex data stream
+	VkBuffer bufs[3];
+	VkDeviceSize offs[3];
+	unsigned char *dst_color;
+	unsigned char *dst_st0;
+
+	// color
+	if (shadingDat.color_st_elements + tess.numVertexes > shadingDat.cur->max_vertexes)
+		vk_growVertexBuffer(tess.numVertexes);
+
+	bufs[0] = bufs[1] = bufs[2] = shadingDat.cur->vertex_buffer;
+	offs[0] = COLOR_OFFSET + shadingDat.color_st_elements * sizeof(color4ub_t);
+	offs[1] = ST0_OFFSET + shadingDat.color_st_elements * sizeof(vec2_t);
+	offs[2] = ST1_OFFSET + shadingDat.color_st_elements * sizeof(vec2_t);
+
+	dst_color = shadingDat.cur->vertex_buffer_ptr + offs[0];
+	memcpy(dst_color, tess.svars.colors, tess.numVertexes * sizeof(color4ub_t));
+	// st0
+
+	dst_st0 = shadingDat.cur->vertex_buffer_ptr + offs[1];
+	memcpy(dst_st0, tess.svars.texcoords[0], tess.numVertexes * sizeof(vec2_t));
+
+	// st1
+	if (multitexture) {
+		unsigned char *dst = shadingDat.cur->vertex_buffer_ptr + offs[2];
+		memcpy(dst, tess.svars.texcoords[1], tess.numVertexes * sizeof(vec2_t));
+	}
+
+	qvkCmdBindVertexBuffers(vk.command_buffer, 1, multitexture ? 3 : 2, bufs, offs);
+	shadingDat.color_st_elements += tess.numVertexes;
+	backEnd.pc.c_streamedBytes +=
+		tess.numVertexes * (sizeof(color4ub_t) + sizeof(vec2_t) * (multitexture ? 2 : 1));
+
+	vk_bindDrawState(pipeline, multitexture, depRg);
 
 	// issue draw call
 	if (indexed)
@@ -467,61 +588,100 @@ void updateMVP(VkBool32 isPortal, VkBool32 is2D, const float mvMat4x4[16]) {
 //  associates components of a vertex shader input variable with components of
 //  a vertex input attribute.
 
+static void vk_uploadIndexes(uint32_t *pIdx, uint32_t nIndex) {
+	const uint32_t indexes_size = nIndex * sizeof(uint32_t);
+	unsigned char *iDst;
+
+	if (shadingDat.index_buffer_offset + indexes_size > shadingDat.cur->index_buffer_size) {
+		vk_growIndexBuffer(indexes_size);
+	}
+
+	iDst = shadingDat.cur->index_buffer_ptr + shadingDat.index_buffer_offset;
+	memcpy(iDst, pIdx, indexes_size);
+
+	qvkCmdBindIndexBuffer(vk.command_buffer, shadingDat.cur->index_buffer, shadingDat.index_buffer_offset,
+						  VK_INDEX_TYPE_UINT32);
+
+	shadingDat.index_buffer_offset += indexes_size;
+	backEnd.pc.c_streamedBytes += indexes_size;
+}
+
 void vk_UploadXYZI(float (*pXYZ)[4], uint32_t nVertex, uint32_t *pIdx, uint32_t nIndex) {
 	// xyz stream
 	{
-		const VkDeviceSize xyz_offset = XYZ_OFFSET + shadingDat.xyz_elements * sizeof(vec4_t);
+		VkDeviceSize xyz_offset;
+		unsigned char *vDst;
+
+		if (shadingDat.xyz_elements + nVertex > shadingDat.cur->max_vertexes) {
+			vk_growVertexBuffer(nVertex);
+		}
 
-		unsigned char *vDst = shadingDat.vertex_buffer_ptr + xyz_offset;
+		xyz_offset = XYZ_OFFSET + shadingDat.xyz_elements * sizeof(vec4_t);
+		vDst = shadingDat.cur->vertex_buffer_ptr + xyz_offset;
 
 		// 4 float in the array, with each 4 bytes.
 		memcpy(vDst, pXYZ, nVertex * 16);
 
-		qvkCmdBindVertexBuffers(vk.command_buffer, 0, 1, &shadingDat.vertex_buffer, &xyz_offset);
+		qvkCmdBindVertexBuffers(vk.command_buffer, 0, 1, &shadingDat.cur->vertex_buffer, &xyz_offset);
 
-		shadingDat.xyz_elements += tess.numVertexes;
-
-		assert(shadingDat.xyz_elements * sizeof(vec4_t) < XYZ_SIZE);
+		shadingDat.xyz_elements += nVertex;
+		backEnd.pc.c_streamedBytes += nVertex * sizeof(vec4_t);
 	}
 
 	// indexes stream
 	if (nIndex != 0) {
-		const uint32_t indexes_size = nIndex * sizeof(uint32_t);
-
-		unsigned char *iDst = shadingDat.index_buffer_ptr + shadingDat.index_buffer_offset;
-		memcpy(iDst, pIdx, indexes_size);
-
-		qvkCmdBindIndexBuffer(vk.command_buffer, shadingDat.index_buffer, shadingDat.index_buffer_offset,
-							  VK_INDEX_TYPE_UINT32);
+		vk_uploadIndexes(pIdx, nIndex);
+	}
+}
 
-		shadingDat.index_buffer_offset += indexes_size;
+static void vk_releaseRetiredBuffers(struct StreamBuffer_t *sb) {
+	uint32_t i;
 
-		assert(shadingDat.index_buffer_offset < INDEX_BUFFER_SIZE);
+	for (i = 0; i < sb->num_retired; i++) {
+		qvkDestroyBuffer(vk.device, sb->retired[i].buffer, NULL);
+		qvkFreeMemory(vk.device, sb->retired[i].memory, NULL);
 	}
+	sb->num_retired = 0;
 }
 
+// Switches to the stream buffers of vk.cur_frame, whose last use must have
+// finished: vk_begin_frame calls this after waiting for the frame's fence.
 void vk_resetGeometryBuffer(void) {
+	shadingDat.cur = &shadingDat.streams[vk.cur_frame];
+
+	vk_releaseRetiredBuffers(shadingDat.cur);
+
 	// Reset geometry buffer's current offsets.
 	shadingDat.xyz_elements = 0;
 	shadingDat.color_st_elements = 0;
 	shadingDat.index_buffer_offset = 0;
 	shadingDat.s_depth_attachment_dirty = VK_FALSE;
 
+	vk_resetDescriptorBinding();
+
 	Mat4Identity(s_modelview_matrix);
 }
 
 void vk_destroy_shading_data(void) {
-	ri.Printf(PRINT_ALL, " Destroy vertex/index buffer: shadingDat.vertex_buffer shadingDat.index_buffer. \n");
+	uint32_t i;
+
+	ri.Printf(PRINT_ALL, " Destroy vertex/index buffers: shadingDat.streams[]. \n");
 	ri.Printf(PRINT_ALL, " Free device memory: vertex_buffer_memory index_buffer_memory. \n");
 
-	qvkUnmapMemory(vk.device, shadingDat.vertex_buffer_memory);
-	qvkFreeMemory(vk.device, shadingDat.vertex_buffer_memory, NULL);
+	for (i = 0; i < vk.num_frames; i++) {
+		struct StreamBuffer_t *sb = &shadingDat.streams[i];
 
-	qvkUnmapMemory(vk.device, shadingDat.index_buffer_memory);
-	qvkFreeMemory(vk.device, shadingDat.index_buffer_memory, NULL);
+		qvkUnmapMemory(vk.device, sb->vertex_buffer_memory);
+		qvkFreeMemory(vk.device, sb->vertex_buffer_memory, NULL);
 
-	qvkDestroyBuffer(vk.device, shadingDat.vertex_buffer, NULL);
-	qvkDestroyBuffer(vk.device, shadingDat.index_buffer, NULL);
+		qvkUnmapMemory(vk.device, sb->index_buffer_memory);
+		qvkFreeMemory(vk.device, sb->index_buffer_memory, NULL);
+
+		qvkDestroyBuffer(vk.device, sb->vertex_buffer, NULL);
+		qvkDestroyBuffer(vk.device, sb->index_buffer, NULL);
+
+		vk_releaseRetiredBuffers(sb);
+	}
 
 	memset(&shadingDat, 0, sizeof(shadingDat));
 
@@ -965,7 +1125,7 @@ static void ProjectDlightTexture(void) {
 			continue;
 		}
 
-		updateCurDescriptor(tr.dlightImage->descriptor_set, 0);
+		updateCurDescriptor(tr.dlightImage, 0);
 		// include GLS_DEPTHFUNC_EQUAL so alpha tested surfaces don't add light where they aren't rendered
 		backEnd.pc.c_totalIndexes += numIndexes;
 		backEnd.pc.c_dlightIndexes += numIndexes;
@@ -999,7 +1159,7 @@ static void RB_FogPass(void) {
 
 	RB_CalcFogTexCoords((float *)tess.svars.texcoords[0]);
 
-	updateCurDescriptor(tr.fogImage->descriptor_set, 0);
+	updateCurDescriptor(tr.fogImage, 0);
 
 	// VULKAN
 
@@ -1008,132 +1168,141 @@ static void RB_FogPass(void) {
 	vk_shade_geometry(pipeline, VK_FALSE, DEPTH_RANGE_NORMAL, VK_TRUE);
 }
 
-void RB_StageIteratorGeneric(void) {
-	uint32_t stage = 0;
-	//	shaderCommands_t *input = &tess;
-
-	RB_DeformTessGeometry();
+static void vk_bindStageImages(shaderStage_t *pStage, VkBool32 multitexture) {
+	// base
+	// set state
+	// R_BindAnimatedImage( &pStage->bundle[0] );
+	{
+		int numAnimaImg;
+		int index;
 
-	// call shader function
-	//
-	// VULKAN
+		if (pStage->bundle[0].isVideoMap) {
+			ri.CIN_RunCinematic(pStage->bundle[0].videoMapHandle);
+			ri.CIN_UploadCinematic(pStage->bundle[0].videoMapHandle);
+			goto ENDANIMA;
+		}
 
-	vk_UploadXYZI(tess.xyz, tess.numVertexes, tess.indexes, tess.numIndexes);
+		numAnimaImg = pStage->bundle[0].numImageAnimations;
 
-	updateMVP(backEnd.viewParms.isPortal, backEnd.projection2D, getptr_modelview_matrix());
+		if (numAnimaImg <= 1) {
+			updateCurDescriptor(pStage->bundle[0].image[0], 0);
+			// GL_Bind(pStage->bundle[0].image[0]);
+			goto ENDANIMA;
+		}
 
-	for (stage = 0; stage < MAX_SHADER_STAGES; ++stage) {
-		VkBool32 multitexture;
-		enum Vk_Depth_Range depth_range;
+		// it is necessary to do this messy calc to make sure animations line up
+		// exactly with waveforms of the same frequency
+		index = (int)(tess.shaderTime * pStage->bundle[0].imageAnimationSpeed * FUNCTABLE_SIZE) >> FUNCTABLE_SIZE2;
 
-		if (NULL == tess.xstages[stage]) {
-			break;
+		if (index < 0) {
+			index = 0; // may happen with shader time offsets
 		}
 
-		ComputeColors(tess.xstages[stage]);
-		ComputeTexCoords(tess.xstages[stage]);
+		index %= numAnimaImg;
 
-		// base
-		// set state
-		// R_BindAnimatedImage( &tess.xstages[stage]->bundle[0] );
-		multitexture = (tess.xstages[stage]->bundle[1].image[0] != NULL);
+		updateCurDescriptor(pStage->bundle[0].image[index], 0);
+		// GL_Bind(pStage->bundle[0].image[ index ]);
+	}
 
-		{
-			int numAnimaImg;
-			int index;
+ENDANIMA:
+	//
+	// do multitexture
+	//
 
-			if (tess.xstages[stage]->bundle[0].isVideoMap) {
-				ri.CIN_RunCinematic(tess.xstages[stage]->bundle[0].videoMapHandle);
-				ri.CIN_UploadCinematic(tess.xstages[stage]->bundle[0].videoMapHandle);
-				goto ENDANIMA;
-			}
+	if (multitexture) {
+		int index2;
+		// DrawMultitextured( input, stage );
+		// output = t0 * t1 or t0 + t1
+
+		// t0 = most upstream according to spec
+		// t1 = most downstream according to spec
+		// this is an ugly hack to work around a GeForce driver
+		// bug with multitexture and clip planes
+
+		if (pStage->bundle[1].isVideoMap) {
+			ri.CIN_RunCinematic(pStage->bundle[1].videoMapHandle);
+			ri.CIN_UploadCinematic(pStage->bundle[1].videoMapHandle);
+			goto END_ANIMA2;
+		}
 
-			numAnimaImg = tess.xstages[stage]->bundle[0].numImageAnimations;
+		if (pStage->bundle[1].numImageAnimations <= 1) {
+			updateCurDescriptor(pStage->bundle[1].image[0], 1);
+			goto END_ANIMA2;
+		}
 
-			if (numAnimaImg <= 1) {
-				updateCurDescriptor(tess.xstages[stage]->bundle[0].image[0]->descriptor_set, 0);
-				// GL_Bind(tess.xstages[stage]->bundle[0].image[0]);
-				goto ENDANIMA;
-			}
+		// it is necessary to do this messy calc to make sure animations line up
+		// exactly with waveforms of the same frequency
+		index2 = (int)(tess.shaderTime * pStage->bundle[1].imageAnimationSpeed * FUNCTABLE_SIZE) >> FUNCTABLE_SIZE2;
 
-			// it is necessary to do this messy calc to make sure animations line up
-			// exactly with waveforms of the same frequency
-			index = (int)(tess.shaderTime * tess.xstages[stage]->bundle[0].imageAnimationSpeed * FUNCTABLE_SIZE) >>
-						FUNCTABLE_SIZE2;
+		if (index2 < 0) {
+			index2 = 0; // may happen with shader time offsets
+		}
 
-			if (index < 0) {
-				index = 0; // may happen with shader time offsets
-			}
+		index2 %= pStage->bundle[1].numImageAnimations;
 
-			index %= numAnimaImg;
+		updateCurDescriptor(pStage->bundle[1].image[index2], 1);
 
-			updateCurDescriptor(tess.xstages[stage]->bundle[0].image[index]->descriptor_set, 0);
-			// GL_Bind(tess.xstages[stage]->bundle[0].image[ index ]);
-		}
+	END_ANIMA2:
 
-	ENDANIMA:
-		//
-		// do multitexture
-		//
+		if (r_lightmap->integer)
+			updateCurDescriptor(tr.whiteImage, 0);
 
-		if (multitexture) {
-			int index2;
-			// DrawMultitextured( input, stage );
-			// output = t0 * t1 or t0 + t1
+		// replace diffuse texture with a white one thus effectively render only lightmap
+	}
+}
 
-			// t0 = most upstream according to spec
-			// t1 = most downstream according to spec
-			// this is an ugly hack to work around a GeForce driver
-			// bug with multitexture and clip planes
+static enum Vk_Depth_Range vk_stageDepthRange(void) {
+	enum Vk_Depth_Range depth_range = DEPTH_RANGE_NORMAL;
 
-			if (tess.xstages[stage]->bundle[1].isVideoMap) {
-				ri.CIN_RunCinematic(tess.xstages[stage]->bundle[1].videoMapHandle);
-				ri.CIN_UploadCinematic(tess.xstages[stage]->bundle[1].videoMapHandle);
-				goto END_ANIMA2;
-			}
+	if (tess.shader->isSky) {
+		depth_range = DEPTH_RANGE_ONE;
+		if (r_showsky->integer)
+			depth_range = DEPTH_RANGE_ZERO;
+	} else if (backEnd.currentEntity->e.renderfx & RF_DEPTHHACK) {
+		depth_range = DEPTH_RANGE_WEAPON;
+	}
 
-			if (tess.xstages[stage]->bundle[1].numImageAnimations <= 1) {
-				updateCurDescriptor(tess.xstages[stage]->bundle[1].image[0]->descriptor_set, 1);
-				goto END_ANIMA2;
-			}
+	return depth_range;
+}
 
-			// it is necessary to do this messy calc to make sure animations line up
-			// exactly with waveforms of the same frequency
-			index2 = (int)(tess.shaderTime * tess.xstages[stage]->bundle[1].imageAnimationSpeed * FUNCTABLE_SIZE) >>
-						 FUNCTABLE_SIZE2;
+static VkPipeline vk_stagePipeline(const shaderStage_t *pStage) {
+	if (backEnd.viewParms.isMirror) {
+		return pStage->vk_mirror_pipeline;
+	} else if (backEnd.viewParms.isPortal) {
+		return pStage->vk_portal_pipeline;
+	}
+	return pStage->vk_pipeline;
+}
 
-			if (index2 < 0) {
-				index2 = 0; // may happen with shader time offsets
-			}
+void RB_StageIteratorGeneric(void) {
+	uint32_t stage = 0;
+	//	shaderCommands_t *input = &tess;
 
-			index2 %= tess.xstages[stage]->bundle[1].numImageAnimations;
+	RB_DeformTessGeometry();
 
-			updateCurDescriptor(tess.xstages[stage]->bundle[1].image[index2]->descriptor_set, 1);
+	// call shader function
+	//
+	// VULKAN
 
-		END_ANIMA2:
+	vk_UploadXYZI(tess.xyz, tess.numVertexes, tess.indexes, tess.numIndexes);
 
-			if (r_lightmap->integer)
-				updateCurDescriptor(tr.whiteImage->descriptor_set, 0);
+	updateMVP(backEnd.viewParms.isPortal, backEnd.projection2D, getptr_modelview_matrix());
 
-			// replace diffuse texture with a white one thus effectively render only lightmap
-		}
+	for (stage = 0; stage < MAX_SHADER_STAGES; ++stage) {
+		VkBool32 multitexture;
 
-		depth_range = DEPTH_RANGE_NORMAL;
-		if (tess.shader->isSky) {
-			depth_range = DEPTH_RANGE_ONE;
-			if (r_showsky->integer)
-				depth_range = DEPTH_RANGE_ZERO;
-		} else if (backEnd.currentEntity->e.renderfx & RF_DEPTHHACK) {
-			depth_range = DEPTH_RANGE_WEAPON;
+		if (NULL == tess.xstages[stage]) {
+			break;
 		}
 
-		if (backEnd.viewParms.isMirror) {
-			vk_shade_geometry(tess.xstages[stage]->vk_mirror_pipeline, multitexture, depth_range, VK_TRUE);
-		} else if (backEnd.viewParms.isPortal) {
-			vk_shade_geometry(tess.xstages[stage]->vk_portal_pipeline, multitexture, depth_range, VK_TRUE);
-		} else {
-			vk_shade_geometry(tess.xstages[stage]->vk_pipeline, multitexture, depth_range, VK_TRUE);
-		}
+		ComputeColors(tess.xstages[stage]);
+		ComputeTexCoords(tess.xstages[stage]);
+
+		multitexture = (tess.xstages[stage]->bundle[1].image[0] != NULL);
+
+		vk_bindStageImages(tess.xstages[stage], multitexture);
+
+		vk_shade_geometry(vk_stagePipeline(tess.xstages[stage]), multitexture, vk_stageDepthRange(), VK_TRUE);
 
 		// allow skipping out to show just lightmaps during development
 		if (r_lightmap->integer &&
@@ -1157,3 +1326,36 @@ void RB_StageIteratorGeneric(void) {
 		RB_FogPass();
 	}
 }
+
+// Same as RB_StageIteratorGeneric for batches whose vertexes are all in the
+// world buffer, only the indexes are uploaded.
+void RB_StageIteratorWorld(void) {
+	uint32_t stage = 0;
+
+	vk_uploadIndexes(tess.worldIndexes, tess.numWorldIndexes);
+
+	updateMVP(backEnd.viewParms.isPortal, backEnd.projection2D, getptr_modelview_matrix());
+
+	for (stage = 0; stage < MAX_SHADER_STAGES; ++stage) {
+		shaderStage_t *pStage = tess.xstages[stage];
+		VkBool32 multitexture;
+
+		if (NULL == pStage) {
+			break;
+		}
+
+		multitexture = (pStage->bundle[1].image[0] != NULL);
+
+		vk_bindStageImages(pStage, multitexture);
+		vk_bindWorldBuffer(vk_worldStageColor(pStage), pStage, multitexture);
+		vk_bindDrawState(vk_stagePipeline(pStage), multitexture, vk_stageDepthRange());
+
+		qvkCmdDrawIndexed(vk.command_buffer, tess.numWorldIndexes, 1, 0, 0, 0);
+		shadingDat.s_depth_attachment_dirty = VK_TRUE;
+
+		// allow skipping out to show just lightmaps during development
+		if (r_lightmap->integer && (pStage->bundle[0].isLightmap || pStage->bundle[1].isLightmap)) {
+			break;
+		}
+	}
+}
@@ -26,7 +26,9 @@ void vk_createIndexBuffer(void);
 VkBuffer vk_getIndexBuffer(void);
 void vk_destroy_shading_data(void);
 
-void updateCurDescriptor(VkDescriptorSet curDesSet, uint32_t tmu);
+struct image_s;
+void updateCurDescriptor(const struct image_s *image, uint32_t tmu);
+void vk_resetDescriptorBinding(void);
 
 VkRect2D get_scissor_rect(void);
 
@@ -74,24 +74,44 @@ void vk_loadShaderModules(void) {
 	extern int multi_texture_mul_frag_spv_size;
 	extern unsigned char multi_texture_add_frag_spv[];
 	extern int multi_texture_add_frag_spv_size;
+	extern unsigned char single_texture_bindless_frag_spv[];
+	extern int single_texture_bindless_frag_spv_size;
+	extern unsigned char multi_texture_mul_bindless_frag_spv[];
+	extern int multi_texture_mul_bindless_frag_spv_size;
+	extern unsigned char multi_texture_add_bindless_frag_spv[];
+	extern int multi_texture_add_bindless_frag_spv_size;
 
 	create_shader_module(single_texture_vert_spv, single_texture_vert_spv_size, &s_gShaderModules.single_texture_vs);
 
 	create_shader_module(single_texture_clipping_plane_vert_spv, single_texture_clipping_plane_vert_spv_size,
 						 &s_gShaderModules.single_texture_clipping_plane_vs);
 
-	create_shader_module(single_texture_frag_spv, single_texture_frag_spv_size, &s_gShaderModules.single_texture_fs);
-
 	create_shader_module(multi_texture_vert_spv, multi_texture_vert_spv_size, &s_gShaderModules.multi_texture_vs);
 
 	create_shader_module(multi_texture_clipping_plane_vert_spv, multi_texture_clipping_plane_vert_spv_size,
 						 &s_gShaderModules.multi_texture_clipping_plane_vs);
 
-	create_shader_module(multi_texture_mul_frag_spv, multi_texture_mul_frag_spv_size,
-						 &s_gShaderModules.multi_texture_mul_fs);
+	// the bindless fragment shaders take the place of the per-image set ones,
+	// vk_specifyShaderModule does not need to know which are loaded
+	if (vk.bindless) {
+		create_shader_module(single_texture_bindless_frag_spv, single_texture_bindless_frag_spv_size,
+							 &s_gShaderModules.single_texture_fs);
+
+		create_shader_module(multi_texture_mul_bindless_frag_spv, multi_texture_mul_bindless_frag_spv_size,
+							 &s_gShaderModules.multi_texture_mul_fs);
+
+		create_shader_module(multi_texture_add_bindless_frag_spv, multi_texture_add_bindless_frag_spv_size,
+							 &s_gShaderModules.multi_texture_add_fs);
+	} else {
+		create_shader_module(single_texture_frag_spv, single_texture_frag_spv_size,
+							 &s_gShaderModules.single_texture_fs);
+
+		create_shader_module(multi_texture_mul_frag_spv, multi_texture_mul_frag_spv_size,
+							 &s_gShaderModules.multi_texture_mul_fs);
 
-	create_shader_module(multi_texture_add_frag_spv, multi_texture_add_frag_spv_size,
-						 &s_gShaderModules.multi_texture_add_fs);
+		create_shader_module(multi_texture_add_frag_spv, multi_texture_add_frag_spv_size,
+							 &s_gShaderModules.multi_texture_add_fs);
+	}
 }
 
 void vk_specifyShaderModule(const enum Vk_Shader_Type shader_type, const VkBool32 isClippingPlane, VkShaderModule *vs,
@@ -0,0 +1,367 @@
+#include "vk_world_buffer.h"
+#include "tr_cvar.h"
+#include "tr_globals.h"
+#include "vk_image.h"
+
+// Static world surfaces in device local memory.
+//
+// Faces, grids and misc_model triangles whose shader needs no per vertex
+// work are copied to the GPU once when the map is loaded. The surface
+// functions then only add indexes to tess.worldIndexes, and the stages
+// read positions, texture coordinates and colors from this buffer instead
+// of the per frame vertex buffer. The layout matches the pipelines' vertex
+// bindings: one stream for xyz, st and lightmap coordinates, and one color
+// stream for each enum Vk_World_Color.
+
+struct WorldBuffer_t {
+	VkBuffer buffer;
+	VkDeviceMemory memory;
+	uint32_t numVerts;
+};
+
+static struct WorldBuffer_t worldBuf;
+
+#define WORLD_XYZ_OFFSET 0
+#define WORLD_ST_OFFSET(n) (WORLD_XYZ_OFFSET + (n) * sizeof(vec4_t))
+#define WORLD_LIGHTMAP_OFFSET(n) (WORLD_ST_OFFSET(n) + (n) * sizeof(vec2_t))
+#define WORLD_COLOR_OFFSET(n, c) (WORLD_LIGHTMAP_OFFSET(n) + (n) * sizeof(vec2_t) + (c) * (n) * sizeof(color4ub_t))
+#define WORLD_BUFFER_SIZE(n) WORLD_COLOR_OFFSET(n, WORLD_COLOR_COUNT)
+
+/*
+=================
+vk_worldStageColor
+
+Which color stream gives what ComputeColors would compute for the stage
+=================
+*/
+enum Vk_World_Color vk_worldStageColor(const shaderStage_t *pStage) {
+	switch (pStage->rgbGen) {
+	case CGEN_IDENTITY:
+		if (pStage->alphaGen == AGEN_SKIP || pStage->alphaGen == AGEN_IDENTITY) {
+			return WORLD_COLOR_WHITE;
+		}
+		return WORLD_COLOR_NONE;
+	case CGEN_IDENTITY_LIGHTING:
+		if (pStage->alphaGen == AGEN_SKIP) {
+			return WORLD_COLOR_IDENTITY;
+		}
+		if (pStage->alphaGen == AGEN_IDENTITY) {
+			return WORLD_COLOR_IDENTITY_OPAQUE;
+		}
+		return WORLD_COLOR_NONE;
+	case CGEN_EXACT_VERTEX:
+		if (pStage->alphaGen == AGEN_SKIP || pStage->alphaGen == AGEN_VERTEX) {
+			return WORLD_COLOR_EXACT;
+		}
+		if (pStage->alphaGen == AGEN_IDENTITY) {
+			return WORLD_COLOR_EXACT_OPAQUE;
+		}
+		return WORLD_COLOR_NONE;
+	case CGEN_VERTEX:
+		if (pStage->alphaGen == AGEN_SKIP || pStage->alphaGen == AGEN_VERTEX) {
+			return WORLD_COLOR_LIT;
+		}
+		if (pStage->alphaGen == AGEN_IDENTITY) {
+			// ComputeColors leaves the vertex alpha alone without overbright
+			return tr.identityLight == 1 ? WORLD_COLOR_LIT : WORLD_COLOR_LIT_OPAQUE;
+		}
+		return WORLD_COLOR_NONE;
+	default:
+		return WORLD_COLOR_NONE;
+	}
+}
+
+static int *vk_worldFirstVertex(surfaceType_t *data) {
+	switch (*data) {
+	case SF_FACE:
+		return &((srfSurfaceFace_t *)data)->worldFirstVertex;
+	case SF_GRID:
+		return &((srfGridMesh_t *)data)->worldFirstVertex;
+	case SF_TRIANGLES:
+		return &((srfTriangles_t *)data)->worldFirstVertex;
+	default:
+		return NULL;
+	}
+}
+
+static uint32_t vk_worldNumVerts(surfaceType_t *data) {
+	switch (*data) {
+	case SF_FACE:
+		return ((srfSurfaceFace_t *)data)->numPoints;
+	case SF_GRID:
+		// the whole grid goes in, RB_SurfaceGrid picks the LOD with indexes
+		return ((srfGridMesh_t *)data)->width * ((srfGridMesh_t *)data)->height;
+	case SF_TRIANGLES:
+		return ((srfTriangles_t *)data)->numVerts;
+	default:
+		return 0;
+	}
+}
+
+static void vk_worldVertex(unsigned char *base, uint32_t n, uint32_t i, const float *xyz, const float *st,
+						   const float *lightmap, const unsigned char *color) {
+	float *pXYZ = (float *)(base + WORLD_XYZ_OFFSET) + i * 4;
+	float *pST = (float *)(base + WORLD_ST_OFFSET(n)) + i * 2;
+	float *pLM = (float *)(base + WORLD_LIGHTMAP_OFFSET(n)) + i * 2;
+	unsigned char *c;
+
+	VectorCopy(xyz, pXYZ);
+	pXYZ[3] = 0;
+	pST[0] = st[0];
+	pST[1] = st[1];
+	pLM[0] = lightmap[0];
+	pLM[1] = lightmap[1];
+
+	c = base + WORLD_COLOR_OFFSET(n, WORLD_COLOR_EXACT) + i * 4;
+	memcpy(c, color, 4);
+
+	c = base + WORLD_COLOR_OFFSET(n, WORLD_COLOR_EXACT_OPAQUE) + i * 4;
+	c[0] = color[0];
+	c[1] = color[1];
+	c[2] = color[2];
+	c[3] = 255;
+
+	c = base + WORLD_COLOR_OFFSET(n, WORLD_COLOR_LIT) + i * 4;
+	c[0] = color[0] * tr.identityLight;
+	c[1] = color[1] * tr.identityLight;
+	c[2] = color[2] * tr.identityLight;
+	c[3] = color[3];
+
+	c = base + WORLD_COLOR_OFFSET(n, WORLD_COLOR_LIT_OPAQUE) + i * 4;
+	c[0] = color[0] * tr.identityLight;
+	c[1] = color[1] * tr.identityLight;
+	c[2] = color[2] * tr.identityLight;
+	c[3] = 255;
+
+	c = base + WORLD_COLOR_OFFSET(n, WORLD_COLOR_WHITE) + i * 4;
+	memset(c, 255, 4);
+
+	c = base + WORLD_COLOR_OFFSET(n, WORLD_COLOR_IDENTITY) + i * 4;
+	memset(c, tr.identityLightByte, 4);
+
+	c = base + WORLD_COLOR_OFFSET(n, WORLD_COLOR_IDENTITY_OPAQUE) + i * 4;
+	memset(c, tr.identityLightByte, 3);
+	c[3] = 255;
+}
+
+static void vk_worldCopySurface(unsigned char *base, uint32_t n, uint32_t first, surfaceType_t *data) {
+	int i;
+
+	switch (*data) {
+	case SF_FACE: {
+		srfSurfaceFace_t *face = (srfSurfaceFace_t *)data;
+		float *v = face->points[0];
+
+		for (i = 0; i < face->numPoints; i++, v += VERTEXSIZE) {
+			vk_worldVertex(base, n, first + i, v, v + 3, v + 5, (unsigned char *)&v[7]);
+		}
+	} break;
+	case SF_GRID: {
+		srfGridMesh_t *grid = (srfGridMesh_t *)data;
+		drawVert_t *dv = grid->verts;
+
+		for (i = 0; i < grid->width * grid->height; i++, dv++) {
+			vk_worldVertex(base, n, first + i, dv->xyz, dv->st, dv->lightmap, dv->color);
+		}
+	} break;
+	case SF_TRIANGLES: {
+		srfTriangles_t *tri = (srfTriangles_t *)data;
+		drawVert_t *dv = tri->verts;
+
+		for (i = 0; i < tri->numVerts; i++, dv++) {
+			vk_worldVertex(base, n, first + i, dv->xyz, dv->st, dv->lightmap, dv->color);
+		}
+	} break;
+	default:
+		break;
+	}
+}
+
+static void vk_createBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties,
+							VkBuffer *pBuf, VkDeviceMemory *pMem) {
+	VkBufferCreateInfo desc;
+	VkMemoryRequirements memory_requirements;
+	VkMemoryAllocateInfo alloc_info;
+
+	desc.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+	desc.pNext = NULL;
+	desc.flags = 0;
+	desc.size = size;
+	desc.usage = usage;
+	desc.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+	desc.queueFamilyIndexCount = 0;
+	desc.pQueueFamilyIndices = NULL;
+
+	VK_CHECK(qvkCreateBuffer(vk.device, &desc, NULL, pBuf));
+
+	qvkGetBufferMemoryRequirements(vk.device, *pBuf, &memory_requirements);
+
+	alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+	alloc_info.pNext = NULL;
+	alloc_info.allocationSize = memory_requirements.size;
+	alloc_info.memoryTypeIndex = find_memory_type(memory_requirements.memoryTypeBits, properties);
+
+	VK_CHECK(qvkAllocateMemory(vk.device, &alloc_info, NULL, pMem));
+	VK_CHECK(qvkBindBufferMemory(vk.device, *pBuf, *pMem, 0));
+}
+
+// Copies the staging buffer to the world buffer and waits for it,
+// this happens once per map so it is not batched like image uploads.
+static void vk_copyToWorldBuffer(VkBuffer staging, VkDeviceSize size) {
+	VkCommandBuffer cmd_buf;
+	VkCommandBufferAllocateInfo alloc_info;
+	VkCommandBufferBeginInfo begin_info;
+	VkBufferMemoryBarrier barrier;
+	VkBufferCopy region;
+	VkSubmitInfo submit_info;
+
+	alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+	alloc_info.pNext = NULL;
+	alloc_info.commandPool = vk.command_pool;
+	alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+	alloc_info.commandBufferCount = 1;
+	VK_CHECK(qvkAllocateCommandBuffers(vk.device, &alloc_info, &cmd_buf));
+
+	begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+	begin_info.pNext = NULL;
+	begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+	begin_info.pInheritanceInfo = NULL;
+	VK_CHECK(qvkBeginCommandBuffer(cmd_buf, &begin_info));
+
+	region.srcOffset = 0;
+	region.dstOffset = 0;
+	region.size = size;
+	qvkCmdCopyBuffer(cmd_buf, staging, worldBuf.buffer, 1, &region);
+
+	// make the copy visible to vertex input
+	barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+	barrier.pNext = NULL;
+	barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+	barrier.dstAccessMask = VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT;
+	barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	barrier.buffer = worldBuf.buffer;
+	barrier.offset = 0;
+	barrier.size = VK_WHOLE_SIZE;
+
+	qvkCmdPipelineBarrier(cmd_buf, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_VERTEX_INPUT_BIT, 0, 0, NULL, 1,
+						  &barrier, 0, NULL);
+
+	VK_CHECK(qvkEndCommandBuffer(cmd_buf));
+
+	submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+	submit_info.pNext = NULL;
+	submit_info.waitSemaphoreCount = 0;
+	submit_info.pWaitSemaphores = NULL;
+	submit_info.pWaitDstStageMask = NULL;
+	submit_info.commandBufferCount = 1;
+	submit_info.pCommandBuffers = &cmd_buf;
+	submit_info.signalSemaphoreCount = 0;
+	submit_info.pSignalSemaphores = NULL;
+
+	VK_CHECK(qvkQueueSubmit(vk.queue, 1, &submit_info, VK_NULL_HANDLE));
+	VK_CHECK(qvkQueueWaitIdle(vk.queue));
+
+	qvkFreeCommandBuffers(vk.device, vk.command_pool, 1, &cmd_buf);
+}
+
+// Called at the end of RE_LoadWorldMap, after patch stitching.
+void vk_createWorldBuffer(void) {
+	world_t *w = tr.world;
+	msurface_t *surf;
+	VkBuffer staging;
+	VkDeviceMemory stagingMem;
+	VkDeviceSize size;
+	void *data;
+	int *first;
+	uint32_t numVerts;
+	int i;
+
+	if (worldBuf.buffer != VK_NULL_HANDLE) {
+		// the previous map may still be in flight
+		qvkDeviceWaitIdle(vk.device);
+		vk_destroyWorldBuffer();
+	}
+
+	numVerts = 0;
+	for (i = 0, surf = w->surfaces; i < w->numsurfaces; i++, surf++) {
+		first = vk_worldFirstVertex(surf->data);
+		if (!first) {
+			continue;
+		}
+
+		*first = -1;
+		if (!r_vbo->integer || !surf->shader->worldBuffer || surf->fogIndex) {
+			continue;
+		}
+
+		*first = numVerts;
+		numVerts += vk_worldNumVerts(surf->data);
+	}
+
+	if (!numVerts) {
+		return;
+	}
+
+	size = WORLD_BUFFER_SIZE(numVerts);
+
+	vk_createBuffer(size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+					VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, &staging, &stagingMem);
+	vk_createBuffer(size, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+					VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, &worldBuf.buffer, &worldBuf.memory);
+	worldBuf.numVerts = numVerts;
+
+	VK_CHECK(qvkMapMemory(vk.device, stagingMem, 0, VK_WHOLE_SIZE, 0, &data));
+
+	for (i = 0, surf = w->surfaces; i < w->numsurfaces; i++, surf++) {
+		first = vk_worldFirstVertex(surf->data);
+		if (first && *first >= 0) {
+			vk_worldCopySurface(data, numVerts, *first, surf->data);
+		}
+	}
+
+	qvkUnmapMemory(vk.device, stagingMem);
+
+	vk_copyToWorldBuffer(staging, size);
+
+	qvkDestroyBuffer(vk.device, staging, NULL);
+	qvkFreeMemory(vk.device, stagingMem, NULL);
+
+	ri.Printf(PRINT_DEVELOPER, " World buffer: %d vertexes, %ld bytes. \n", numVerts, size);
+}
+
+// The device must be idle, RE_Shutdown destroys the pipelines first.
+void vk_destroyWorldBuffer(void) {
+	if (worldBuf.buffer != VK_NULL_HANDLE) {
+		qvkDestroyBuffer(vk.device, worldBuf.buffer, NULL);
+	}
+	if (worldBuf.memory != VK_NULL_HANDLE) {
+		qvkFreeMemory(vk.device, worldBuf.memory, NULL);
+	}
+
+	memset(&worldBuf, 0, sizeof(worldBuf));
+}
+
+VkBool32 vk_worldBufferActive(void) {
+	return worldBuf.buffer != VK_NULL_HANDLE;
+}
+
+static VkDeviceSize vk_worldTexCoords(const textureBundle_t *bundle) {
+	if (bundle->tcGen == TCGEN_LIGHTMAP) {
+		return WORLD_LIGHTMAP_OFFSET(worldBuf.numVerts);
+	}
+	return WORLD_ST_OFFSET(worldBuf.numVerts);
+}
+
+// Binds the streams of the stage to the same bindings vk_shade_geometry uses.
+void vk_bindWorldBuffer(enum Vk_World_Color color, const shaderStage_t *pStage, VkBool32 multitexture) {
+	VkBuffer bufs[4] = {worldBuf.buffer, worldBuf.buffer, worldBuf.buffer, worldBuf.buffer};
+	VkDeviceSize offs[4];
+
+	offs[0] = WORLD_XYZ_OFFSET;
+	offs[1] = WORLD_COLOR_OFFSET(worldBuf.numVerts, color);
+	offs[2] = vk_worldTexCoords(&pStage->bundle[0]);
+	offs[3] = vk_worldTexCoords(&pStage->bundle[1]);
+
+	qvkCmdBindVertexBuffers(vk.command_buffer, 0, multitexture ? 4 : 3, bufs, offs);
+}
@@ -0,0 +1,29 @@
+#ifndef VK_WORLD_BUFFER_H_
+#define VK_WORLD_BUFFER_H_
+
+#include "tr_local.h"
+#include "vk_instance.h"
+
+// Vertex color streams kept in the world buffer, one for each way
+// ComputeColors can take the colors straight from the map vertexes.
+enum Vk_World_Color {
+	WORLD_COLOR_NONE = -1,
+	WORLD_COLOR_EXACT,				// CGEN_EXACT_VERTEX
+	WORLD_COLOR_EXACT_OPAQUE,		// CGEN_EXACT_VERTEX, AGEN_IDENTITY
+	WORLD_COLOR_LIT,				// CGEN_VERTEX
+	WORLD_COLOR_LIT_OPAQUE,			// CGEN_VERTEX, AGEN_IDENTITY
+	WORLD_COLOR_WHITE,				// CGEN_IDENTITY
+	WORLD_COLOR_IDENTITY,			// CGEN_IDENTITY_LIGHTING
+	WORLD_COLOR_IDENTITY_OPAQUE,	// CGEN_IDENTITY_LIGHTING, AGEN_IDENTITY
+	WORLD_COLOR_COUNT
+};
+
+enum Vk_World_Color vk_worldStageColor(const shaderStage_t *pStage);
+
+void vk_createWorldBuffer(void);
+void vk_destroyWorldBuffer(void);
+VkBool32 vk_worldBufferActive(void);
+
+void vk_bindWorldBuffer(enum Vk_World_Color color, const shaderStage_t *pStage, VkBool32 multitexture);
+
+#endif
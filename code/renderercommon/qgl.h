@@ -107,6 +107,7 @@ extern void(APIENTRYP qglUnlockArraysEXT)(void);
 	GLE(void, ClearDepth, GLclampd depth)                                                                              \
 	GLE(void, DepthRange, GLclampd near_val, GLclampd far_val)                                                         \
 	GLE(void, DrawBuffer, GLenum mode)                                                                                 \
+	GLE(void, GetTexLevelParameteriv, GLenum target, GLint level, GLenum pname, GLint *params)                         \
 	GLE(void, PolygonMode, GLenum face, GLenum mode)
 
 // OpenGL 1.0/1.1 but not OpenGL 3.2 core profile or OpenGL ES 1.x
@@ -144,7 +145,8 @@ extern void(APIENTRYP qglUnlockArraysEXT)(void);
 	GLE(void, CompressedTexImage2D, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height,  \
 		GLint border, GLsizei imageSize, const void *data)                                                             \
 	GLE(void, CompressedTexSubImage2D, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width,        \
-		GLsizei height, GLenum format, GLsizei imageSize, const void *data)
+		GLsizei height, GLenum format, GLsizei imageSize, const void *data)                                            \
+	GLE(void, GetCompressedTexImage, GLenum target, GLint level, void *img)
 
 // GL_ARB_occlusion_query, built-in to OpenGL 1.5 but not OpenGL ES 2.0
 #define QGL_ARB_occlusion_query_PROCS                                                                                  \
@@ -163,6 +165,9 @@ extern void(APIENTRYP qglUnlockArraysEXT)(void);
 	GLE(void, BufferData, GLenum target, GLsizeiptr size, const void *data, GLenum usage)                              \
 	GLE(void, BufferSubData, GLenum target, GLintptr offset, GLsizeiptr size, const void *data)
 
+// OpenGL 2.0 two-sided stencil, loaded on its own for the renderergl1 shadow volumes
+#define QGL_2_0_STENCIL_PROCS GLE(void, StencilOpSeparate, GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass)
+
 // OpenGL 2.0, was GL_ARB_shading_language_100, GL_ARB_vertex_program, GL_ARB_shader_objects, and GL_ARB_vertex_shader
 #define QGL_2_0_PROCS                                                                                                  \
 	GLE(void, AttachShader, GLuint program, GLuint shader)                                                             \
@@ -192,6 +197,7 @@ extern void(APIENTRYP qglUnlockArraysEXT)(void);
 	GLE(void, Uniform4f, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)                               \
 	GLE(void, Uniform1i, GLint location, GLint v0)                                                                     \
 	GLE(void, Uniform1fv, GLint location, GLsizei count, const GLfloat *value)                                         \
+	GLE(void, Uniform4fv, GLint location, GLsizei count, const GLfloat *value)                                         \
 	GLE(void, UniformMatrix4fv, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)              \
 	GLE(void, ValidateProgram, GLuint program)                                                                         \
 	GLE(void, VertexAttribPointer, GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride,        \
@@ -273,6 +279,74 @@ extern void(APIENTRYP qglUnlockArraysEXT)(void);
 	GLE(void, DeleteVertexArrays, GLsizei n, const GLuint *arrays)                                                     \
 	GLE(void, GenVertexArrays, GLsizei n, GLuint *arrays)
 
+// GL_ARB_timer_query, built-in to OpenGL 3.3
+#define QGL_ARB_timer_query_PROCS                                                                                      \
+	GLE(void, GetQueryObjectui64v, GLuint id, GLenum pname, GLuint64 *params)
+
+#ifndef GL_ARB_timer_query
+#define GL_ARB_timer_query
+#define GL_TIME_ELAPSED 0x88BF
+#endif
+
+// GL_ARB_draw_instanced, built-in to OpenGL 3.1
+#define QGL_ARB_draw_instanced_PROCS                                                                                   \
+	GLE(void, DrawElementsInstanced, GLenum mode, GLsizei count, GLenum type, const GLvoid *indices,                   \
+		GLsizei primcount)
+
+// GL_ARB_get_program_binary, built-in to OpenGL 4.1
+#define QGL_ARB_get_program_binary_PROCS                                                                               \
+	GLE(void, GetProgramBinary, GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat,                \
+		void *binary)                                                                                                  \
+	GLE(void, ProgramBinary, GLuint program, GLenum binaryFormat, const void *binary, GLsizei length)                  \
+	GLE(void, ProgramParameteri, GLuint program, GLenum pname, GLint value)
+
+#ifndef GL_ARB_get_program_binary
+#define GL_ARB_get_program_binary
+#define GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+#define GL_PROGRAM_BINARY_LENGTH 0x8741
+#define GL_NUM_PROGRAM_BINARY_FORMATS 0x87FE
+#endif
+
+// GL_ARB_parallel_shader_compile
+#define QGL_ARB_parallel_shader_compile_PROCS GLE(void, MaxShaderCompilerThreadsARB, GLuint count)
+
+#ifndef GL_ARB_parallel_shader_compile
+#define GL_ARB_parallel_shader_compile
+#define GL_MAX_SHADER_COMPILER_THREADS_ARB 0x91B0
+#define GL_COMPLETION_STATUS_ARB 0x91B1
+#endif
+
+// GL_ARB_map_buffer_range, built-in to OpenGL 3.0
+#define QGL_ARB_map_buffer_range_PROCS                                                                                 \
+	GLE(void *, MapBufferRange, GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)                  \
+	GLE(GLboolean, UnmapBuffer, GLenum target)
+
+#ifndef GL_ARB_map_buffer_range
+#define GL_ARB_map_buffer_range
+#define GL_MAP_READ_BIT 0x0001
+#endif
+
+#ifndef GL_PIXEL_PACK_BUFFER
+#define GL_PIXEL_PACK_BUFFER 0x88EB
+#define GL_STREAM_READ 0x88E1
+#endif
+
+// GL_ARB_sync, built-in to OpenGL 3.2
+#define QGL_ARB_sync_PROCS                                                                                             \
+	GLE(GLsync, FenceSync, GLenum condition, GLbitfield flags)                                                         \
+	GLE(GLenum, ClientWaitSync, GLsync sync, GLbitfield flags, GLuint64 timeout)                                       \
+	GLE(void, DeleteSync, GLsync sync)
+
+#ifndef GL_ARB_sync
+#define GL_ARB_sync
+#define GL_SYNC_GPU_COMMANDS_COMPLETE 0x9117
+#define GL_SYNC_FLUSH_COMMANDS_BIT 0x00000001
+#define GL_ALREADY_SIGNALED 0x911A
+#define GL_TIMEOUT_EXPIRED 0x911B
+#define GL_CONDITION_SATISFIED 0x911C
+#define GL_WAIT_FAILED 0x911D
+#endif
+
 #ifndef GL_ARB_texture_compression_rgtc
 #define GL_ARB_texture_compression_rgtc
 #define GL_COMPRESSED_RED_RGTC1 0x8DBB
@@ -321,6 +395,7 @@ extern void(APIENTRYP qglUnlockArraysEXT)(void);
 	GLE(GLvoid, ProgramUniform3fEXT, GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2)               \
 	GLE(GLvoid, ProgramUniform4fEXT, GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)   \
 	GLE(GLvoid, ProgramUniform1fvEXT, GLuint program, GLint location, GLsizei count, const GLfloat *value)             \
+	GLE(GLvoid, ProgramUniform4fvEXT, GLuint program, GLint location, GLsizei count, const GLfloat *value)             \
 	GLE(GLvoid, ProgramUniformMatrix4fvEXT, GLuint program, GLint location, GLsizei count, GLboolean transpose,        \
 		const GLfloat *value)                                                                                          \
 	GLE(GLvoid, NamedRenderbufferStorageEXT, GLuint renderbuffer, GLenum internalformat, GLsizei width,                \
@@ -343,10 +418,17 @@ QGL_ES_1_1_FIXED_FUNCTION_PROCS
 QGL_1_3_PROCS
 QGL_1_5_PROCS
 QGL_2_0_PROCS
+QGL_2_0_STENCIL_PROCS
 QGL_3_0_PROCS
 QGL_ARB_occlusion_query_PROCS
 QGL_ARB_framebuffer_object_PROCS
 QGL_ARB_vertex_array_object_PROCS
+QGL_ARB_draw_instanced_PROCS
+QGL_ARB_timer_query_PROCS
+QGL_ARB_get_program_binary_PROCS
+QGL_ARB_parallel_shader_compile_PROCS
+QGL_ARB_map_buffer_range_PROCS
+QGL_ARB_sync_PROCS
 QGL_EXT_direct_state_access_PROCS
 #undef GLE
 
@@ -149,6 +149,73 @@ void R_LoadPCX(const char *name, byte **pic, int *width, int *height);
 void R_LoadPNG(const char *name, byte **pic, int *width, int *height);
 void R_LoadTGA(const char *name, byte **pic, int *width, int *height);
 
+// decode a file that is already in memory, the buffer is left to the caller
+void R_DecodeJPG(const char *name, byte *buffer, int length, byte **pic, int *width, int *height);
+void R_DecodePNG(const char *name, byte *buffer, int length, byte **pic, int *width, int *height);
+void R_DecodeTGA(const char *name, byte *buffer, int length, byte **pic, int *width, int *height);
+
+// the decoders allocate, print and fail through these so that they can
+// also run on the job threads of R_PrefetchImages
+void *R_ImageMalloc(int size);
+void R_ImageFree(void *ptr);
+void QDECL R_ImagePrintf(int printLevel, const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+void QDECL R_ImageError(const char *fmt, ...) Q_NORETURN __attribute__((format(printf, 1, 2)));
+qboolean R_ImageDecodeJob(void);
+
+/*
+=============================================================
+
+IMAGE PREFETCH
+
+=============================================================
+*/
+
+extern cvar_t *r_imageThreads; // decode the level's images on this many job threads
+
+void R_QueueImagePrefetch(const char *name);
+void R_QueueShaderImagePrefetch(const char *shaderText);
+void R_PrefetchImages(void);
+qboolean R_TakePrefetchedImage(const char *name, byte **pic, int *width, int *height);
+void R_FlushPrefetchedImages(void);
+
+/*
+=============================================================
+
+DEFORM KERNELS
+
+=============================================================
+*/
+
+// SSE2/NEON versions of the tess loops of the CPU deforms and texmods,
+// positions and normals are four floats apart and texcoords two
+void R_DeformWave(float *xyz, const float *normal, int count, const float *table, float base, float amplitude,
+				  float spread, double phase);
+void R_DeformBulge(float *xyz, const float *normal, const float *st, int count, const float *sinTable, float width,
+				   float height, double now);
+void R_DeformOffset(float *xyz, const float *dir, int dirStride, int count, float scale);
+void R_TurbulentTexCoords(float *st, const float *xyz, int count, const float *sinTable, float amplitude,
+						  double now);
+void R_TransformTexCoords(float *st, int count, const float matrix[2][2], const float translate[2]);
+
+/*
+=============================================================
+
+SHADER TEXT
+
+=============================================================
+*/
+
+extern cvar_t *r_shaderThreads; // check and index the shader scripts on this many job threads
+extern cvar_t *r_shaderCache;	// keep the indexed shader scripts in shadertext.cache
+
+typedef struct {
+	char *text;			// the good scripts compressed and joined, later files first
+	const int *shaders; // where the parse of each shader name starts in text
+	int numShaders;
+} shaderText_t;
+
+qboolean R_LoadShaderText(shaderText_t *shaderText, qboolean materials);
+
 /*
 ====================================================================
 
@@ -166,4 +233,11 @@ void GLimp_Minimize(void);
 
 void GLimp_SetGamma(unsigned char red[256], unsigned char green[256], unsigned char blue[256]);
 
+// render thread for r_smp
+qboolean GLimp_SpawnRenderThread(void (*function)(void));
+void GLimp_ShutdownRenderThread(void);
+void *GLimp_RendererSleep(void);
+void GLimp_FrontEndSleep(void);
+void GLimp_WakeRenderer(void *data);
+
 #endif
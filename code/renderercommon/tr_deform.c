@@ -0,0 +1,455 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+// tr_deform.c -- SSE2 and NEON kernels for the CPU deforms and texmods
+
+#include "tr_common.h"
+
+/*
+========================================================================
+
+The GL1 and Vulkan renderers run deformVertexes and tcMod on the CPU for
+every batch, so the water, flag and foliage shaders of a map go through
+these loops thousands of times a frame.  The kernels work on the raw tess
+arrays: four floats per position and normal, two per texture coordinate.
+
+SSE2 is part of every x86_64 CPU and NEON of every AArch64 one, so there
+is no runtime dispatch; other targets and the last few vertexes of a
+batch take the scalar loops.
+
+The time part of a wave is reduced to a single period in double precision
+before it meets the per-vertex float part.  Table indexes match the old
+loops to within one entry, and no longer drift after a long uptime.
+
+========================================================================
+*/
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define DEFORM_SSE2 1
+#include <emmintrin.h>
+#else
+#define DEFORM_SSE2 0
+#endif
+
+#if !DEFORM_SSE2 && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define DEFORM_NEON 1
+#include <arm_neon.h>
+#else
+#define DEFORM_NEON 0
+#endif
+
+#define TABLE_SIZE 1024 // FUNCTABLE_SIZE, the same in every renderer
+#define TABLE_MASK (TABLE_SIZE - 1)
+
+// bring a table position into [0, TABLE_SIZE)
+static float R_ReduceTablePos(double pos) {
+	return (float)(pos - floor(pos / TABLE_SIZE) * TABLE_SIZE);
+}
+
+/*
+========================================================================
+
+Scalar loops
+
+========================================================================
+*/
+
+static void R_DeformWave_scalar(float *xyz, const float *normal, int count, const float *table, float base,
+								float amplitude, float spread, float phase) {
+	int i;
+
+	for (i = 0; i < count; i++, xyz += 4, normal += 4) {
+		float off = (xyz[0] + xyz[1] + xyz[2]) * spread;
+		float scale = base + table[(int)((off + phase) * TABLE_SIZE) & TABLE_MASK] * amplitude;
+
+		xyz[0] += normal[0] * scale;
+		xyz[1] += normal[1] * scale;
+		xyz[2] += normal[2] * scale;
+	}
+}
+
+static void R_DeformBulge_scalar(float *xyz, const float *normal, const float *st, int count, const float *sinTable,
+								 float width, float height, float pos) {
+	const float toTable = (float)(TABLE_SIZE / (M_PI * 2));
+	int i;
+
+	for (i = 0; i < count; i++, xyz += 4, normal += 4, st += 4) {
+		float scale = sinTable[(int)(toTable * st[0] * width + pos) & TABLE_MASK] * height;
+
+		xyz[0] += normal[0] * scale;
+		xyz[1] += normal[1] * scale;
+		xyz[2] += normal[2] * scale;
+	}
+}
+
+static void R_DeformOffset_scalar(float *xyz, const float *dir, int dirStride, int count, float scale) {
+	int i;
+
+	for (i = 0; i < count; i++, xyz += 4, dir += dirStride) {
+		xyz[0] += dir[0] * scale;
+		xyz[1] += dir[1] * scale;
+		xyz[2] += dir[2] * scale;
+	}
+}
+
+static void R_TurbulentTexCoords_scalar(float *st, const float *xyz, int count, const float *sinTable,
+										float amplitude, float pos) {
+	int i;
+
+	for (i = 0; i < count; i++, st += 2, xyz += 4) {
+		st[0] += sinTable[(int)(xyz[0] + xyz[2] + pos) & TABLE_MASK] * amplitude;
+		st[1] += sinTable[(int)(xyz[1] + pos) & TABLE_MASK] * amplitude;
+	}
+}
+
+static void R_TransformTexCoords_scalar(float *st, int count, const float matrix[2][2], const float translate[2]) {
+	int i;
+
+	for (i = 0; i < count; i++, st += 2) {
+		float s = st[0];
+		float t = st[1];
+
+		st[0] = s * matrix[0][0] + t * matrix[1][0] + translate[0];
+		st[1] = s * matrix[0][1] + t * matrix[1][1] + translate[1];
+	}
+}
+
+/*
+========================================================================
+
+SSE2
+
+========================================================================
+*/
+
+#if DEFORM_SSE2
+
+// table[(int)pos & TABLE_MASK] for four positions
+static ID_INLINE __m128 R_TableLookup_sse2(const float *table, __m128 pos) {
+	int idx[4];
+
+	_mm_storeu_si128((__m128i *)idx, _mm_and_si128(_mm_cvttps_epi32(pos), _mm_set1_epi32(TABLE_MASK)));
+
+	return _mm_setr_ps(table[idx[0]], table[idx[1]], table[idx[2]], table[idx[3]]);
+}
+
+// xyz of four vertexes += their normals times the matching lane of scale, w untouched
+static ID_INLINE void R_AddScaledNormals_sse2(float *xyz, const float *normal, __m128 scale) {
+	const __m128 xyzMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+	__m128 s[4];
+	int k;
+
+	s[0] = _mm_shuffle_ps(scale, scale, _MM_SHUFFLE(0, 0, 0, 0));
+	s[1] = _mm_shuffle_ps(scale, scale, _MM_SHUFFLE(1, 1, 1, 1));
+	s[2] = _mm_shuffle_ps(scale, scale, _MM_SHUFFLE(2, 2, 2, 2));
+	s[3] = _mm_shuffle_ps(scale, scale, _MM_SHUFFLE(3, 3, 3, 3));
+
+	for (k = 0; k < 4; k++) {
+		__m128 add = _mm_and_ps(_mm_mul_ps(_mm_loadu_ps(normal + k * 4), s[k]), xyzMask);
+
+		_mm_storeu_ps(xyz + k * 4, _mm_add_ps(_mm_loadu_ps(xyz + k * 4), add));
+	}
+}
+
+#endif
+
+/*
+========================================================================
+
+Kernels
+
+========================================================================
+*/
+
+/*
+====================
+R_DeformWave
+
+deformVertexes wave: each vertex moves along its normal by a table
+wave whose phase is shifted by spread times the sum of its coordinates.
+phase is the wave phase plus the shader time times the frequency.
+====================
+*/
+void R_DeformWave(float *xyz, const float *normal, int count, const float *table, float base, float amplitude,
+				  float spread, double phase) {
+	float ph = (float)(phase - floor(phase));
+	int i = 0;
+
+#if DEFORM_SSE2
+	{
+		const __m128 spread4 = _mm_set1_ps(spread);
+		const __m128 phase4 = _mm_set1_ps(ph);
+		const __m128 size4 = _mm_set1_ps(TABLE_SIZE);
+		const __m128 base4 = _mm_set1_ps(base);
+		const __m128 amplitude4 = _mm_set1_ps(amplitude);
+
+		for (; i + 4 <= count; i += 4) {
+			float *v = xyz + i * 4;
+			__m128 x = _mm_loadu_ps(v);
+			__m128 y = _mm_loadu_ps(v + 4);
+			__m128 z = _mm_loadu_ps(v + 8);
+			__m128 w = _mm_loadu_ps(v + 12);
+			__m128 off, scale;
+
+			_MM_TRANSPOSE4_PS(x, y, z, w);
+
+			off = _mm_mul_ps(_mm_add_ps(_mm_add_ps(x, y), z), spread4);
+			scale = R_TableLookup_sse2(table, _mm_mul_ps(_mm_add_ps(off, phase4), size4));
+			scale = _mm_add_ps(base4, _mm_mul_ps(scale, amplitude4));
+
+			R_AddScaledNormals_sse2(v, normal + i * 4, scale);
+		}
+	}
+#elif DEFORM_NEON
+	for (; i + 4 <= count; i += 4) {
+		float32x4x4_t v = vld4q_f32(xyz + i * 4);
+		float32x4x4_t n = vld4q_f32(normal + i * 4);
+		float32x4_t off, pos, scale;
+		int32_t idx[4];
+
+		off = vmulq_n_f32(vaddq_f32(vaddq_f32(v.val[0], v.val[1]), v.val[2]), spread);
+		pos = vmulq_n_f32(vaddq_f32(off, vdupq_n_f32(ph)), TABLE_SIZE);
+		vst1q_s32(idx, vandq_s32(vcvtq_s32_f32(pos), vdupq_n_s32(TABLE_MASK)));
+
+		scale = (float32x4_t){table[idx[0]], table[idx[1]], table[idx[2]], table[idx[3]]};
+		scale = vaddq_f32(vdupq_n_f32(base), vmulq_n_f32(scale, amplitude));
+
+		v.val[0] = vaddq_f32(v.val[0], vmulq_f32(n.val[0], scale));
+		v.val[1] = vaddq_f32(v.val[1], vmulq_f32(n.val[1], scale));
+		v.val[2] = vaddq_f32(v.val[2], vmulq_f32(n.val[2], scale));
+		vst4q_f32(xyz + i * 4, v);
+	}
+#endif
+
+	R_DeformWave_scalar(xyz + i * 4, normal + i * 4, count - i, table, base, amplitude, spread, ph);
+}
+
+/*
+====================
+R_DeformBulge
+
+deformVertexes bulge: a sine wave that runs along the s texture
+coordinate.  st points at the first texture coordinate of the first
+vertex, four floats apart.  now is the time in seconds times the speed.
+====================
+*/
+void R_DeformBulge(float *xyz, const float *normal, const float *st, int count, const float *sinTable, float width,
+				   float height, double now) {
+	float pos = R_ReduceTablePos(now * (TABLE_SIZE / (M_PI * 2)));
+	int i = 0;
+
+#if DEFORM_SSE2
+	{
+		const __m128 stScale = _mm_set1_ps((float)(TABLE_SIZE / (M_PI * 2)) * width);
+		const __m128 pos4 = _mm_set1_ps(pos);
+		const __m128 height4 = _mm_set1_ps(height);
+
+		for (; i + 4 <= count; i += 4) {
+			const float *s = st + i * 4;
+			__m128 scale = _mm_setr_ps(s[0], s[4], s[8], s[12]);
+
+			scale = R_TableLookup_sse2(sinTable, _mm_add_ps(_mm_mul_ps(scale, stScale), pos4));
+
+			R_AddScaledNormals_sse2(xyz + i * 4, normal + i * 4, _mm_mul_ps(scale, height4));
+		}
+	}
+#elif DEFORM_NEON
+	for (; i + 4 <= count; i += 4) {
+		float32x4x4_t v = vld4q_f32(xyz + i * 4);
+		float32x4x4_t n = vld4q_f32(normal + i * 4);
+		float32x4x4_t s = vld4q_f32(st + i * 4);
+		float32x4_t pos4, scale;
+		int32_t idx[4];
+
+		pos4 = vaddq_f32(vmulq_n_f32(s.val[0], (float)(TABLE_SIZE / (M_PI * 2)) * width), vdupq_n_f32(pos));
+		vst1q_s32(idx, vandq_s32(vcvtq_s32_f32(pos4), vdupq_n_s32(TABLE_MASK)));
+
+		scale = (float32x4_t){sinTable[idx[0]], sinTable[idx[1]], sinTable[idx[2]], sinTable[idx[3]]};
+		scale = vmulq_n_f32(scale, height);
+
+		v.val[0] = vaddq_f32(v.val[0], vmulq_f32(n.val[0], scale));
+		v.val[1] = vaddq_f32(v.val[1], vmulq_f32(n.val[1], scale));
+		v.val[2] = vaddq_f32(v.val[2], vmulq_f32(n.val[2], scale));
+		vst4q_f32(xyz + i * 4, v);
+	}
+#endif
+
+	R_DeformBulge_scalar(xyz + i * 4, normal + i * 4, st + i * 4, count - i, sinTable, width, height, pos);
+}
+
+/*
+====================
+R_DeformOffset
+
+Adds dir times scale to every position, dir advancing by dirStride
+floats per vertex.  A stride of 0 moves the whole batch by one vector
+(deformVertexes move), 4 moves each vertex along its normal.
+====================
+*/
+void R_DeformOffset(float *xyz, const float *dir, int dirStride, int count, float scale) {
+	int i = 0;
+
+#if DEFORM_SSE2
+	{
+		const __m128 scale4 = _mm_setr_ps(scale, scale, scale, 0.0f);
+		const __m128 xyzMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+
+		if (dirStride == 0) {
+			const __m128 add = _mm_mul_ps(_mm_setr_ps(dir[0], dir[1], dir[2], 0.0f), scale4);
+
+			for (; i < count; i++) {
+				_mm_storeu_ps(xyz + i * 4, _mm_add_ps(_mm_loadu_ps(xyz + i * 4), add));
+			}
+		} else if (dirStride == 4) {
+			for (; i < count; i++) {
+				__m128 add = _mm_and_ps(_mm_mul_ps(_mm_loadu_ps(dir + i * 4), scale4), xyzMask);
+
+				_mm_storeu_ps(xyz + i * 4, _mm_add_ps(_mm_loadu_ps(xyz + i * 4), add));
+			}
+		}
+	}
+#elif DEFORM_NEON
+	if (dirStride == 0 || dirStride == 4) {
+		const float32x4_t s0 = vdupq_n_f32(dir[0] * scale);
+		const float32x4_t s1 = vdupq_n_f32(dir[1] * scale);
+		const float32x4_t s2 = vdupq_n_f32(dir[2] * scale);
+
+		for (; i + 4 <= count; i += 4) {
+			float32x4x4_t v = vld4q_f32(xyz + i * 4);
+
+			if (dirStride) {
+				float32x4x4_t n = vld4q_f32(dir + i * 4);
+
+				v.val[0] = vaddq_f32(v.val[0], vmulq_n_f32(n.val[0], scale));
+				v.val[1] = vaddq_f32(v.val[1], vmulq_n_f32(n.val[1], scale));
+				v.val[2] = vaddq_f32(v.val[2], vmulq_n_f32(n.val[2], scale));
+			} else {
+				v.val[0] = vaddq_f32(v.val[0], s0);
+				v.val[1] = vaddq_f32(v.val[1], s1);
+				v.val[2] = vaddq_f32(v.val[2], s2);
+			}
+			vst4q_f32(xyz + i * 4, v);
+		}
+	}
+#endif
+
+	R_DeformOffset_scalar(xyz + i * 4, dir + i * dirStride, dirStride, count - i, scale);
+}
+
+/*
+====================
+R_TurbulentTexCoords
+
+tcMod turb: s is offset by a sine of x + z and t by one of y.
+now is the wave phase plus the shader time times the frequency.
+====================
+*/
+void R_TurbulentTexCoords(float *st, const float *xyz, int count, const float *sinTable, float amplitude,
+						  double now) {
+	float pos = R_ReduceTablePos(now * TABLE_SIZE);
+	int i = 0;
+
+#if DEFORM_SSE2
+	{
+		const __m128 pos4 = _mm_set1_ps(pos);
+		const __m128 amplitude4 = _mm_set1_ps(amplitude);
+
+		for (; i + 4 <= count; i += 4) {
+			const float *v = xyz + i * 4;
+			__m128 x = _mm_loadu_ps(v);
+			__m128 y = _mm_loadu_ps(v + 4);
+			__m128 z = _mm_loadu_ps(v + 8);
+			__m128 w = _mm_loadu_ps(v + 12);
+			__m128 ds, dt;
+
+			_MM_TRANSPOSE4_PS(x, y, z, w);
+
+			ds = _mm_mul_ps(R_TableLookup_sse2(sinTable, _mm_add_ps(_mm_add_ps(x, z), pos4)), amplitude4);
+			dt = _mm_mul_ps(R_TableLookup_sse2(sinTable, _mm_add_ps(y, pos4)), amplitude4);
+
+			_mm_storeu_ps(st + i * 2, _mm_add_ps(_mm_loadu_ps(st + i * 2), _mm_unpacklo_ps(ds, dt)));
+			_mm_storeu_ps(st + i * 2 + 4, _mm_add_ps(_mm_loadu_ps(st + i * 2 + 4), _mm_unpackhi_ps(ds, dt)));
+		}
+	}
+#elif DEFORM_NEON
+	for (; i + 4 <= count; i += 4) {
+		float32x4x4_t v = vld4q_f32(xyz + i * 4);
+		float32x4x2_t t = vld2q_f32(st + i * 2);
+		int32_t is[4], it[4];
+
+		vst1q_s32(is, vandq_s32(vcvtq_s32_f32(vaddq_f32(vaddq_f32(v.val[0], v.val[2]), vdupq_n_f32(pos))),
+								vdupq_n_s32(TABLE_MASK)));
+		vst1q_s32(it, vandq_s32(vcvtq_s32_f32(vaddq_f32(v.val[1], vdupq_n_f32(pos))), vdupq_n_s32(TABLE_MASK)));
+
+		t.val[0] = vaddq_f32(t.val[0], vmulq_n_f32((float32x4_t){sinTable[is[0]], sinTable[is[1]], sinTable[is[2]],
+																  sinTable[is[3]]},
+												   amplitude));
+		t.val[1] = vaddq_f32(t.val[1], vmulq_n_f32((float32x4_t){sinTable[it[0]], sinTable[it[1]], sinTable[it[2]],
+																  sinTable[it[3]]},
+												   amplitude));
+		vst2q_f32(st + i * 2, t);
+	}
+#endif
+
+	R_TurbulentTexCoords_scalar(st + i * 2, xyz + i * 4, count - i, sinTable, amplitude, pos);
+}
+
+/*
+====================
+R_TransformTexCoords
+
+st = st * matrix + translate, which covers tcMod scale, scroll,
+transform and rotate.
+====================
+*/
+void R_TransformTexCoords(float *st, int count, const float matrix[2][2], const float translate[2]) {
+	int i = 0;
+
+#if DEFORM_SSE2
+	{
+		const __m128 ms = _mm_setr_ps(matrix[0][0], matrix[0][1], matrix[0][0], matrix[0][1]);
+		const __m128 mt = _mm_setr_ps(matrix[1][0], matrix[1][1], matrix[1][0], matrix[1][1]);
+		const __m128 tv = _mm_setr_ps(translate[0], translate[1], translate[0], translate[1]);
+
+		// two vertexes at a time
+		for (; i + 2 <= count; i += 2) {
+			__m128 v = _mm_loadu_ps(st + i * 2);
+			__m128 s = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 0, 0));
+			__m128 t = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 1, 1));
+
+			_mm_storeu_ps(st + i * 2, _mm_add_ps(_mm_add_ps(_mm_mul_ps(s, ms), _mm_mul_ps(t, mt)), tv));
+		}
+	}
+#elif DEFORM_NEON
+	for (; i + 4 <= count; i += 4) {
+		float32x4x2_t v = vld2q_f32(st + i * 2);
+		float32x4x2_t r;
+
+		r.val[0] = vaddq_f32(vaddq_f32(vmulq_n_f32(v.val[0], matrix[0][0]), vmulq_n_f32(v.val[1], matrix[1][0])),
+							 vdupq_n_f32(translate[0]));
+		r.val[1] = vaddq_f32(vaddq_f32(vmulq_n_f32(v.val[0], matrix[0][1]), vmulq_n_f32(v.val[1], matrix[1][1])),
+							 vdupq_n_f32(translate[1]));
+		vst2q_f32(st + i * 2, r);
+	}
+#endif
+
+	R_TransformTexCoords_scalar(st + i * 2, count - i, matrix, translate);
+}
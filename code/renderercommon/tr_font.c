@@ -86,6 +86,10 @@ FT_Library ftLibrary = NULL;
 #endif
 
 #define MAX_FONTS 6
+
+// glyph pages are squares of a power of two in between
+#define FONT_PAGE_MIN 256
+#define FONT_PAGE_MAX 1024
 static int registeredFontCount = 0;
 static fontInfo_t registeredFont[MAX_FONTS];
 
@@ -185,114 +189,113 @@ void WriteTGA(char *filename, byte *data, int width, int height) {
 	ri.Free(buffer);
 }
 
-static glyphInfo_t *RE_ConstructGlyphInfo(unsigned char *imageOut, int *xOut, int *yOut, int *maxHeight, FT_Face face,
-										  const unsigned char c, qboolean calcHeight) {
-	int i;
-	static glyphInfo_t glyph;
-	unsigned char *src, *dst;
-	float scaled_width, scaled_height;
-	FT_Bitmap *bitmap = NULL;
-
-	Com_Memset(&glyph, 0, sizeof(glyphInfo_t));
-	// make sure everything is here
-	if (face != NULL) {
-		FT_Load_Glyph(face, FT_Get_Char_Index(face, c), FT_LOAD_DEFAULT);
-		bitmap = R_RenderGlyph(face->glyph, &glyph);
-		if (bitmap) {
-			glyph.xSkip = (face->glyph->metrics.horiAdvance >> 6) + 1;
-		} else {
-			return &glyph;
-		}
+/*
+RE_RasterizeGlyph
 
-		if (glyph.height > *maxHeight) {
-			*maxHeight = glyph.height;
-		}
+Fills in the metrics of a glyph and returns its bitmap, NULL if the
+face can't render it
+*/
+static FT_Bitmap *RE_RasterizeGlyph(FT_Face face, const unsigned char c, glyphInfo_t *glyph) {
+	FT_Bitmap *bitmap;
 
-		if (calcHeight) {
-			ri.Free(bitmap->buffer);
-			ri.Free(bitmap);
-			return &glyph;
-		}
+	Com_Memset(glyph, 0, sizeof(glyphInfo_t));
 
-		/*
-				// need to convert to power of 2 sizes so we do not get
-				// any scaling from the gl upload
-				for (scaled_width = 1 ; scaled_width < glyph.pitch ; scaled_width<<=1)
-					;
-				for (scaled_height = 1 ; scaled_height < glyph.height ; scaled_height<<=1)
-					;
-		*/
-
-		scaled_width = glyph.pitch;
-		scaled_height = glyph.height;
-
-		// we need to make sure we fit
-		if (*xOut + scaled_width + 1 >= 255) {
-			*xOut = 0;
-			*yOut += *maxHeight + 1;
-		}
+	FT_Load_Glyph(face, FT_Get_Char_Index(face, c), FT_LOAD_DEFAULT);
+	bitmap = R_RenderGlyph(face->glyph, glyph);
+	if (!bitmap) {
+		return NULL;
+	}
+
+	glyph->xSkip = (face->glyph->metrics.horiAdvance >> 6) + 1;
+	glyph->imageWidth = glyph->pitch;
+	glyph->imageHeight = glyph->height;
+
+	return bitmap;
+}
+
+/*
+RE_PlaceGlyphs
+
+Packs the glyphs from first on into rows of a pageSize square page, each
+row as tall as its tallest glyph.  Returns the first glyph that didn't
+fit, GLYPH_END + 1 if all of them did.
+*/
+static int RE_PlaceGlyphs(glyphInfo_t *glyphs, int *glyphX, int *glyphY, int first, int pageSize) {
+	int i, x, y, rowHeight;
+
+	x = y = rowHeight = 0;
 
-		if (*yOut + *maxHeight + 1 >= 255) {
-			*yOut = -1;
-			*xOut = -1;
-			ri.Free(bitmap->buffer);
-			ri.Free(bitmap);
-			return &glyph;
+	for (i = first; i <= GLYPH_END; i++) {
+		if (x + glyphs[i].imageWidth + 1 >= pageSize) {
+			x = 0;
+			y += rowHeight + 1;
+			rowHeight = 0;
+		}
+		if (x + glyphs[i].imageWidth + 1 >= pageSize || y + glyphs[i].imageHeight + 1 >= pageSize) {
+			break;
 		}
 
-		src = bitmap->buffer;
-		dst = imageOut + (*yOut * 256) + *xOut;
-
-		if (bitmap->pixel_mode == ft_pixel_mode_mono) {
-			for (i = 0; i < glyph.height; i++) {
-				int j;
-				unsigned char *_src = src;
-				unsigned char *_dst = dst;
-				unsigned char mask = 0x80;
-				unsigned char val = *_src;
-				for (j = 0; j < glyph.pitch; j++) {
-					if (mask == 0x80) {
-						val = *_src++;
-					}
-					if (val & mask) {
-						*_dst = 0xff;
-					}
-					mask >>= 1;
-
-					if (mask == 0) {
-						mask = 0x80;
-					}
-					_dst++;
-				}
+		glyphX[i] = x;
+		glyphY[i] = y;
+		glyphs[i].s = (float)x / pageSize;
+		glyphs[i].t = (float)y / pageSize;
+		glyphs[i].s2 = glyphs[i].s + (float)glyphs[i].imageWidth / pageSize;
+		glyphs[i].t2 = glyphs[i].t + (float)glyphs[i].imageHeight / pageSize;
 
-				src += glyph.pitch;
-				dst += 256;
-			}
-		} else {
-			for (i = 0; i < glyph.height; i++) {
-				Com_Memcpy(dst, src, glyph.pitch);
-				src += glyph.pitch;
-				dst += 256;
-			}
+		x += glyphs[i].imageWidth + 1;
+		if (glyphs[i].imageHeight > rowHeight) {
+			rowHeight = glyphs[i].imageHeight;
 		}
+	}
 
-		// we now have an 8 bit per pixel grey scale bitmap
-		// that is width wide and pf->ftSize->metrics.y_ppem tall
+	return i;
+}
 
-		glyph.imageHeight = scaled_height;
-		glyph.imageWidth = scaled_width;
-		glyph.s = (float)*xOut / 256;
-		glyph.t = (float)*yOut / 256;
-		glyph.s2 = glyph.s + (float)scaled_width / 256;
-		glyph.t2 = glyph.t + (float)scaled_height / 256;
+/*
+RE_CopyGlyph
 
-		*xOut += scaled_width + 1;
+Copies a glyph bitmap into the 8 bit page at x, y
+*/
+static void RE_CopyGlyph(unsigned char *page, int pageSize, int x, int y, const glyphInfo_t *glyph,
+						 const FT_Bitmap *bitmap) {
+	unsigned char *src, *dst;
+	int i;
 
-		ri.Free(bitmap->buffer);
-		ri.Free(bitmap);
-	}
+	src = bitmap->buffer;
+	dst = page + (y * pageSize) + x;
+
+	if (bitmap->pixel_mode == ft_pixel_mode_mono) {
+		for (i = 0; i < glyph->height; i++) {
+			int j;
+			unsigned char *_src = src;
+			unsigned char *_dst = dst;
+			unsigned char mask = 0x80;
+			unsigned char val = *_src;
+			for (j = 0; j < glyph->pitch; j++) {
+				if (mask == 0x80) {
+					val = *_src++;
+				}
+				if (val & mask) {
+					*_dst = 0xff;
+				}
+				mask >>= 1;
 
-	return &glyph;
+				if (mask == 0) {
+					mask = 0x80;
+				}
+				_dst++;
+			}
+
+			src += glyph->pitch;
+			dst += pageSize;
+		}
+	} else {
+		for (i = 0; i < glyph->height; i++) {
+			Com_Memcpy(dst, src, glyph->pitch);
+			src += glyph->pitch;
+			dst += pageSize;
+		}
+	}
 }
 #endif
 
@@ -331,10 +334,11 @@ float readFloat(void) {
 void RE_RegisterFont(const char *fontName, int pointSize, fontInfo_t *font) {
 #ifdef BUILD_FREETYPE
 	FT_Face face;
-	int j, k, xOut, yOut, lastStart, imageNumber;
-	int scaledSize, newSize, maxHeight, left;
+	FT_Bitmap *bitmaps[GLYPHS_PER_FONT];
+	int glyphX[GLYPHS_PER_FONT], glyphY[GLYPHS_PER_FONT];
+	int j, k, next, imageNumber;
+	int pageSize, maxPageSize, scaledSize, newSize, left;
 	unsigned char *out, *imageBuff;
-	glyphInfo_t *glyph;
 	image_t *image;
 	qhandle_t h;
 	float max;
@@ -428,89 +432,93 @@ void RE_RegisterFont(const char *fontName, int pointSize, fontInfo_t *font) {
 		return;
 	}
 
-	//*font = &registeredFonts[registeredFontCount++];
-
-	// make a 256x256 image buffer, once it is full, register it, clean it and keep going
-	// until all glyphs are rendered
-
-	out = ri.Malloc(256 * 256);
-	if (out == NULL) {
-		ri.Printf(PRINT_WARNING, "RE_RegisterFont: ri.Malloc failure during output image creation.\n");
-		return;
+	// every glyph is rendered once, then they are packed into as few pages
+	// as possible, each the smallest square that takes the rest of them.
+	// Text drawn in one size then stays on one texture.
+	Com_Memset(font, 0, sizeof(*font));
+	Com_Memset(bitmaps, 0, sizeof(bitmaps));
+	for (i = GLYPH_START; i <= GLYPH_END; i++) {
+		bitmaps[i] = RE_RasterizeGlyph(face, (unsigned char)i, &font->glyphs[i]);
 	}
-	Com_Memset(out, 0, 256 * 256);
-
-	maxHeight = 0;
 
-	for (i = GLYPH_START; i <= GLYPH_END; i++) {
-		RE_ConstructGlyphInfo(out, &xOut, &yOut, &maxHeight, face, (unsigned char)i, qtrue);
+	maxPageSize = MIN(FONT_PAGE_MAX, glConfig.maxTextureSize);
+	if (maxPageSize < FONT_PAGE_MIN) {
+		maxPageSize = FONT_PAGE_MIN;
 	}
 
-	xOut = 0;
-	yOut = 0;
 	i = GLYPH_START;
-	lastStart = i;
 	imageNumber = 0;
 
-	while (i <= GLYPH_END + 1) {
+	while (i <= GLYPH_END) {
+		for (pageSize = FONT_PAGE_MIN; pageSize < maxPageSize; pageSize <<= 1) {
+			if (RE_PlaceGlyphs(font->glyphs, glyphX, glyphY, i, pageSize) > GLYPH_END) {
+				break;
+			}
+		}
 
-		if (i == GLYPH_END + 1) {
-			// upload/save current image buffer
-			xOut = yOut = -1;
-		} else {
-			glyph = RE_ConstructGlyphInfo(out, &xOut, &yOut, &maxHeight, face, (unsigned char)i, qfalse);
+		next = RE_PlaceGlyphs(font->glyphs, glyphX, glyphY, i, pageSize);
+		if (next == i) {
+			ri.Printf(PRINT_WARNING, "RE_RegisterFont: glyph %i of %s doesn't fit a %ix%i page\n", i, fontName,
+					  pageSize, pageSize);
+			Com_Memset(&font->glyphs[i], 0, sizeof(glyphInfo_t));
+			next = i + 1;
 		}
 
-		if (xOut == -1 || yOut == -1) {
-			// ran out of room
-			// we need to create an image from the bitmap, set all the handles in the glyphs to this point
-			//
-
-			scaledSize = 256 * 256;
-			newSize = scaledSize * 4;
-			imageBuff = ri.Malloc(newSize);
-			left = 0;
-			max = 0;
-			for (k = 0; k < (scaledSize); k++) {
-				if (max < out[k]) {
-					max = out[k];
-				}
+		out = ri.Malloc(pageSize * pageSize);
+		Com_Memset(out, 0, pageSize * pageSize);
+
+		for (j = i; j < next; j++) {
+			if (bitmaps[j]) {
+				RE_CopyGlyph(out, pageSize, glyphX[j], glyphY[j], &font->glyphs[j], bitmaps[j]);
 			}
+		}
 
-			if (max > 0) {
-				max = 255 / max;
+		// we now have an 8 bit per pixel grey scale bitmap, make it white
+		// with the coverage in the alpha
+		scaledSize = pageSize * pageSize;
+		newSize = scaledSize * 4;
+		imageBuff = ri.Malloc(newSize);
+		left = 0;
+		max = 0;
+		for (k = 0; k < (scaledSize); k++) {
+			if (max < out[k]) {
+				max = out[k];
 			}
+		}
 
-			for (k = 0; k < (scaledSize); k++) {
-				imageBuff[left++] = 255;
-				imageBuff[left++] = 255;
-				imageBuff[left++] = 255;
+		if (max > 0) {
+			max = 255 / max;
+		}
 
-				imageBuff[left++] = ((float)out[k] * max);
-			}
+		for (k = 0; k < (scaledSize); k++) {
+			imageBuff[left++] = 255;
+			imageBuff[left++] = 255;
+			imageBuff[left++] = 255;
 
-			Com_sprintf(name, sizeof(name), "fonts/fontImage_%i_%i", imageNumber++, pointSize);
-			if (r_saveFontData->integer) {
-				WriteTGA(name, imageBuff, 256, 256);
-			}
+			imageBuff[left++] = ((float)out[k] * max);
+		}
 
-			// Com_sprintf (name, sizeof(name), "fonts/fontImage_%i_%i", imageNumber++, pointSize);
-			image = R_CreateImage(name, imageBuff, 256, 256, IMGTYPE_COLORALPHA, IMGFLAG_CLAMPTOEDGE, 0);
-			h = RE_RegisterShaderFromImage(name, LIGHTMAP_2D, image, qfalse);
-			for (j = lastStart; j < i; j++) {
-				font->glyphs[j].glyph = h;
-				Q_strncpyz(font->glyphs[j].shaderName, name, sizeof(font->glyphs[j].shaderName));
-			}
-			lastStart = i;
-			Com_Memset(out, 0, 256 * 256);
-			xOut = 0;
-			yOut = 0;
-			ri.Free(imageBuff);
-			if (i == GLYPH_END + 1)
-				i++;
-		} else {
-			Com_Memcpy(&font->glyphs[i], glyph, sizeof(glyphInfo_t));
-			i++;
+		Com_sprintf(name, sizeof(name), "fonts/fontImage_%i_%i", imageNumber++, pointSize);
+		if (r_saveFontData->integer) {
+			WriteTGA(name, imageBuff, pageSize, pageSize);
+		}
+
+		image = R_CreateImage(name, imageBuff, pageSize, pageSize, IMGTYPE_COLORALPHA, IMGFLAG_CLAMPTOEDGE, 0);
+		h = RE_RegisterShaderFromImage(name, LIGHTMAP_2D, image, qfalse);
+		for (j = i; j < next; j++) {
+			font->glyphs[j].glyph = h;
+			Q_strncpyz(font->glyphs[j].shaderName, name, sizeof(font->glyphs[j].shaderName));
+		}
+
+		ri.Free(imageBuff);
+		ri.Free(out);
+		i = next;
+	}
+
+	for (i = GLYPH_START; i <= GLYPH_END; i++) {
+		if (bitmaps[i]) {
+			ri.Free(bitmaps[i]->buffer);
+			ri.Free(bitmaps[i]);
 		}
 	}
 
@@ -523,14 +531,14 @@ void RE_RegisterFont(const char *fontName, int pointSize, fontInfo_t *font) {
 
 	registeredFont[registeredFontCount].glyphScale = glyphScale;
 	font->glyphScale = glyphScale;
+	Com_sprintf(font->name, sizeof(font->name), "fonts/fontImage_%i.dat", pointSize);
 	Com_Memcpy(&registeredFont[registeredFontCount++], font, sizeof(fontInfo_t));
 
 	if (r_saveFontData->integer) {
 		ri.FS_WriteFile(va("fonts/fontImage_%i.dat", pointSize), font, sizeof(fontInfo_t));
 	}
 
-	ri.Free(out);
-
+	FT_Done_Face(face);
 	ri.FS_FreeFile(faceData);
 #endif
 }
@@ -44,6 +44,13 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #endif
 #endif
 
+// libjpeg-turbo decodes to RGBA directly, plain libjpeg gives RGB that is expanded afterwards
+#ifdef JCS_EXTENSIONS
+#define JPG_OUTPUT_COMPONENTS 4
+#else
+#define JPG_OUTPUT_COMPONENTS 3
+#endif
+
 /* Catching errors, as done in libjpeg's example.c */
 typedef struct q_jpeg_error_mgr_s {
 	struct jpeg_error_mgr pub; /* "public" fields */
@@ -59,7 +66,10 @@ static void R_JPGErrorExit(j_common_ptr cinfo) {
 
 	(*cinfo->err->format_message)(cinfo, buffer);
 
-	ri.Printf(PRINT_ALL, "Error: %s", buffer);
+	/* Job threads can't print, the setjmp point gives up on the image instead */
+	if (!R_ImageDecodeJob()) {
+		ri.Printf(PRINT_ALL, "Error: %s", buffer);
+	}
 
 	/* Return control to the setjmp point */
 	longjmp(jerr->setjmp_buffer, 1);
@@ -68,6 +78,13 @@ static void R_JPGErrorExit(j_common_ptr cinfo) {
 static void R_JPGOutputMessage(j_common_ptr cinfo) {
 	char buffer[JMSG_LENGTH_MAX];
 
+	/* Warnings are treated like errors on job threads, the image is loaded
+	 * again on the main thread to report them
+	 */
+	if (R_ImageDecodeJob()) {
+		longjmp(((q_jpeg_error_mgr_t *)cinfo->err)->setjmp_buffer, 1);
+	}
+
 	/* Create the message */
 	(*cinfo->err->format_message)(cinfo, buffer);
 
@@ -75,7 +92,7 @@ static void R_JPGOutputMessage(j_common_ptr cinfo) {
 	ri.Printf(PRINT_ALL, "%s\n", buffer);
 }
 
-void R_LoadJPG(const char *filename, unsigned char **pic, int *width, int *height) {
+void R_DecodeJPG(const char *filename, byte *data, int length, unsigned char **pic, int *width, int *height) {
 	/* This struct contains the JPEG decompression parameters and pointers to
 	 * working space (which is allocated as needed by the JPEG library).
 	 */
@@ -97,28 +114,14 @@ void R_LoadJPG(const char *filename, unsigned char **pic, int *width, int *heigh
 	JSAMPARRAY buffer;		 /* Output row buffer */
 	unsigned int row_stride; /* physical row width in output buffer */
 	unsigned int pixelcount, memcount;
+#ifndef JCS_EXTENSIONS
 	unsigned int sindex, dindex;
+#endif
 	byte *out;
-	int len;
-	union {
-		byte *b;
-		void *v;
-	} fbuffer;
 	byte *buf;
 
 	memset(&cinfo, 0, sizeof(cinfo));
 
-	/* In this example we want to open the input file before doing anything else,
-	 * so that the setjmp() error recovery below can assume the file is open.
-	 * VERY IMPORTANT: use "b" option to fopen() if you are on a machine that
-	 * requires it in order to read binary files.
-	 */
-
-	len = ri.FS_ReadFile((char *)filename, &fbuffer.v);
-	if (!fbuffer.b || len < 0) {
-		return;
-	}
-
 	/* Step 1: allocate and initialize JPEG decompression object */
 
 	/* We have to set up the error handler first, in case the initialization
@@ -136,10 +139,9 @@ void R_LoadJPG(const char *filename, unsigned char **pic, int *width, int *heigh
 		 * We need to clean up the JPEG object, close the input file, and return.
 		 */
 		jpeg_destroy_decompress(&cinfo);
-		ri.FS_FreeFile(fbuffer.v);
 
 		/* Append the filename to the error for easier debugging */
-		ri.Printf(PRINT_ALL, ", loading file %s\n", filename);
+		R_ImagePrintf(PRINT_ALL, ", loading file %s\n", filename);
 		return;
 	}
 
@@ -148,7 +150,7 @@ void R_LoadJPG(const char *filename, unsigned char **pic, int *width, int *heigh
 
 	/* Step 2: specify data source (eg, a file) */
 
-	jpeg_mem_src(&cinfo, fbuffer.b, len);
+	jpeg_mem_src(&cinfo, data, length);
 
 	/* Step 3: read file parameters with jpeg_read_header() */
 
@@ -164,8 +166,13 @@ void R_LoadJPG(const char *filename, unsigned char **pic, int *width, int *heigh
 	/*
 	 * Make sure it always converts images to RGB color space. This will
 	 * automatically convert 8-bit greyscale images to RGB as well.
+	 * libjpeg-turbo can write RGBA itself, straight into our format.
 	 */
+#ifdef JCS_EXTENSIONS
+	cinfo.out_color_space = JCS_EXT_RGBA;
+#else
 	cinfo.out_color_space = JCS_RGB;
+#endif
 
 	/* Step 5: Start decompressor */
 
@@ -186,19 +193,18 @@ void R_LoadJPG(const char *filename, unsigned char **pic, int *width, int *heigh
 
 	if (!cinfo.output_width || !cinfo.output_height ||
 		((pixelcount * 4) / cinfo.output_width) / 4 != cinfo.output_height || pixelcount > 0x1FFFFFFF ||
-		cinfo.output_components != 3) {
+		cinfo.output_components != JPG_OUTPUT_COMPONENTS) {
 		// Free the memory to make sure we don't leak memory
-		ri.FS_FreeFile(fbuffer.v);
 		jpeg_destroy_decompress(&cinfo);
 
-		ri.Error(ERR_DROP, "LoadJPG: %s has an invalid image format: %dx%d*4=%d, components: %d", filename,
-				 cinfo.output_width, cinfo.output_height, pixelcount * 4, cinfo.output_components);
+		R_ImageError("LoadJPG: %s has an invalid image format: %dx%d*4=%d, components: %d", filename,
+					 cinfo.output_width, cinfo.output_height, pixelcount * 4, cinfo.output_components);
 	}
 
 	memcount = pixelcount * 4;
 	row_stride = cinfo.output_width * cinfo.output_components;
 
-	out = ri.Malloc(memcount);
+	out = R_ImageMalloc(memcount);
 
 	*width = cinfo.output_width;
 	*height = cinfo.output_height;
@@ -219,6 +225,7 @@ void R_LoadJPG(const char *filename, unsigned char **pic, int *width, int *heigh
 		(void)jpeg_read_scanlines(&cinfo, buffer, 1);
 	}
 
+#ifndef JCS_EXTENSIONS
 	buf = out;
 
 	// Expand from RGB to RGBA
@@ -231,6 +238,7 @@ void R_LoadJPG(const char *filename, unsigned char **pic, int *width, int *heigh
 		buf[--dindex] = buf[--sindex];
 		buf[--dindex] = buf[--sindex];
 	} while (sindex);
+#endif
 
 	*pic = out;
 
@@ -246,13 +254,6 @@ void R_LoadJPG(const char *filename, unsigned char **pic, int *width, int *heigh
 	/* This is an important step since it will release a good deal of memory. */
 	jpeg_destroy_decompress(&cinfo);
 
-	/* After finish_decompress, we can close the input file.
-	 * Here we postpone it until after no more JPEG errors are possible,
-	 * so as to simplify the setjmp error logic above.  (Actually, I don't
-	 * think that jpeg_destroy can do an error exit, but why assume anything...)
-	 */
-	ri.FS_FreeFile(fbuffer.v);
-
 	/* At this point you may want to check to see whether any corrupt-data
 	 * warnings occurred (test whether jerr.pub.num_warnings is nonzero).
 	 */
@@ -260,6 +261,23 @@ void R_LoadJPG(const char *filename, unsigned char **pic, int *width, int *heigh
 	/* And we're done! */
 }
 
+void R_LoadJPG(const char *filename, unsigned char **pic, int *width, int *height) {
+	union {
+		byte *b;
+		void *v;
+	} fbuffer;
+	int len;
+
+	len = ri.FS_ReadFile((char *)filename, &fbuffer.v);
+	if (!fbuffer.b || len < 0) {
+		return;
+	}
+
+	R_DecodeJPG(filename, fbuffer.b, len, pic, width, height);
+
+	ri.FS_FreeFile(fbuffer.v);
+}
+
 /* Expanded data destination object for stdio output */
 
 typedef struct {
@@ -23,6 +23,10 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
 
 #include "../qcommon/puff.h"
 
+#ifdef USE_LIBDEFLATE
+#include <libdeflate.h>
+#endif
+
 // we could limit the png size to a lower value here
 #ifndef INT_MAX
 #define INT_MAX 0x1fffffff
@@ -205,21 +209,17 @@ struct BufferedFile {
 };
 
 /*
- *  Read a file into a buffer.
+ *  Wrap a file that is already in memory.
  */
 
-static struct BufferedFile *ReadBufferedFile(const char *name) {
+static struct BufferedFile *OpenBufferedFile(byte *buffer, int length) {
 	struct BufferedFile *BF;
-	union {
-		byte *b;
-		void *v;
-	} buffer;
 
 	/*
 	 *  input verification
 	 */
 
-	if (!name) {
+	if (!(buffer && (length > 0))) {
 		return (NULL);
 	}
 
@@ -227,41 +227,17 @@ static struct BufferedFile *ReadBufferedFile(const char *name) {
 	 *  Allocate control struct.
 	 */
 
-	BF = ri.Malloc(sizeof(struct BufferedFile));
+	BF = R_ImageMalloc(sizeof(struct BufferedFile));
 	if (!BF) {
 		return (NULL);
 	}
 
-	/*
-	 *  Initialize the structs components.
-	 */
-
-	BF->Length = 0;
-	BF->Buffer = NULL;
-	BF->Ptr = NULL;
-	BF->BytesLeft = 0;
-
-	/*
-	 *  Read the file.
-	 */
-
-	BF->Length = ri.FS_ReadFile((char *)name, &buffer.v);
-	BF->Buffer = buffer.b;
-
-	/*
-	 *  Did we get it? Is it big enough?
-	 */
-
-	if (!(BF->Buffer && (BF->Length > 0))) {
-		ri.Free(BF);
-
-		return (NULL);
-	}
-
 	/*
 	 *  Set the pointers and counters.
 	 */
 
+	BF->Buffer = buffer;
+	BF->Length = length;
 	BF->Ptr = BF->Buffer;
 	BF->BytesLeft = BF->Length;
 
@@ -269,16 +245,12 @@ static struct BufferedFile *ReadBufferedFile(const char *name) {
 }
 
 /*
- *  Close a buffered file.
+ *  Close a buffered file, the buffer belongs to the caller.
  */
 
 static void CloseBufferedFile(struct BufferedFile *BF) {
 	if (BF) {
-		if (BF->Buffer) {
-			ri.FS_FreeFile(BF->Buffer);
-		}
-
-		ri.Free(BF);
+		R_ImageFree(BF);
 	}
 }
 
@@ -470,11 +442,82 @@ static qboolean FindChunk(struct BufferedFile *BF, uint32_t ChunkType) {
 	return (qtrue);
 }
 
+/*
+ *  The size of the filtered image data follows from the IHDR,
+ *  which saves puff() the pass that only counts it.
+ *  Returns 0 when the IHDR makes no sense.
+ */
+
+static uint32_t FilteredImageLength(struct PNG_Chunk_IHDR *IHDR) {
+	static const uint32_t XOffset[PNG_Adam7_NumPasses] = {0, 4, 0, 2, 0, 1, 0};
+	static const uint32_t XStep[PNG_Adam7_NumPasses] = {8, 8, 4, 4, 2, 2, 1};
+	static const uint32_t YOffset[PNG_Adam7_NumPasses] = {0, 0, 4, 0, 2, 0, 1};
+	static const uint32_t YStep[PNG_Adam7_NumPasses] = {8, 8, 8, 4, 4, 2, 2};
+
+	uint32_t Width, Height, BitsPerPixel;
+	uint64_t Length, BytesPerScanline;
+	int a;
+
+	Width = BigLong(IHDR->Width);
+	Height = BigLong(IHDR->Height);
+
+	switch (IHDR->ColourType) {
+	case PNG_ColourType_Grey:
+		BitsPerPixel = IHDR->BitDepth * PNG_NumColourComponents_Grey;
+		break;
+	case PNG_ColourType_True:
+		BitsPerPixel = IHDR->BitDepth * PNG_NumColourComponents_True;
+		break;
+	case PNG_ColourType_Indexed:
+		BitsPerPixel = IHDR->BitDepth * PNG_NumColourComponents_Indexed;
+		break;
+	case PNG_ColourType_GreyAlpha:
+		BitsPerPixel = IHDR->BitDepth * PNG_NumColourComponents_GreyAlpha;
+		break;
+	case PNG_ColourType_TrueAlpha:
+		BitsPerPixel = IHDR->BitDepth * PNG_NumColourComponents_TrueAlpha;
+		break;
+	default:
+		return 0;
+	}
+
+	if (IHDR->InterlaceMethod == PNG_InterlaceMethod_NonInterlaced) {
+		BytesPerScanline = ((uint64_t)Width * BitsPerPixel + 7) / 8;
+		Length = (BytesPerScanline + 1) * Height;
+	} else {
+		Length = 0;
+
+		for (a = 0; a < PNG_Adam7_NumPasses; a++) {
+			uint64_t PassWidth, PassHeight;
+
+			PassWidth = (Width > XOffset[a]) ? (Width - XOffset[a] + XStep[a] - 1) / XStep[a] : 0;
+			PassHeight = (Height > YOffset[a]) ? (Height - YOffset[a] + YStep[a] - 1) / YStep[a] : 0;
+
+			/*
+			 *  empty passes have no FilterType bytes either
+			 */
+
+			if (PassWidth && PassHeight) {
+				BytesPerScanline = (PassWidth * BitsPerPixel + 7) / 8;
+				Length += (BytesPerScanline + 1) * PassHeight;
+			}
+		}
+	}
+
+	if (!Length || Length > 0x7fffffff) {
+		return 0;
+	}
+
+	return ((uint32_t)Length);
+}
+
 /*
  *  Decompress all IDATs
+ *
+ *  ExpectedLength is the size from FilteredImageLength, or 0 if unknown.
  */
 
-static uint32_t DecompressIDATs(struct BufferedFile *BF, uint8_t **Buffer) {
+static uint32_t DecompressIDATs(struct BufferedFile *BF, uint8_t **Buffer, uint32_t ExpectedLength) {
 	uint8_t *DecompressedData;
 	uint32_t DecompressedDataLength;
 
@@ -585,7 +628,7 @@ static uint32_t DecompressIDATs(struct BufferedFile *BF, uint8_t **Buffer) {
 
 	BufferedFileRewind(BF, BytesToRewind);
 
-	CompressedData = ri.Malloc(CompressedDataLength);
+	CompressedData = R_ImageMalloc(CompressedDataLength);
 	if (!CompressedData) {
 		return (-1);
 	}
@@ -603,7 +646,7 @@ static uint32_t DecompressIDATs(struct BufferedFile *BF, uint8_t **Buffer) {
 
 		CH = BufferedFileRead(BF, PNG_ChunkHeader_Size);
 		if (!CH) {
-			ri.Free(CompressedData);
+			R_ImageFree(CompressedData);
 
 			return (-1);
 		}
@@ -634,13 +677,13 @@ static uint32_t DecompressIDATs(struct BufferedFile *BF, uint8_t **Buffer) {
 
 			OrigCompressedData = BufferedFileRead(BF, Length);
 			if (!OrigCompressedData) {
-				ri.Free(CompressedData);
+				R_ImageFree(CompressedData);
 
 				return (-1);
 			}
 
 			if (!BufferedFileSkip(BF, PNG_ChunkCRC_Size)) {
-				ri.Free(CompressedData);
+				R_ImageFree(CompressedData);
 
 				return (-1);
 			}
@@ -651,67 +694,109 @@ static uint32_t DecompressIDATs(struct BufferedFile *BF, uint8_t **Buffer) {
 	}
 
 	/*
-	 *  Let puff() calculate the decompressed data length.
+	 *  The zlib header and checkvalue don't belong to the compressed data.
 	 */
 
-	puffDest = NULL;
-	puffDestLen = 0;
+	if (CompressedDataLength <= PNG_ZlibHeader_Size + PNG_ZlibCheckValue_Size) {
+		R_ImageFree(CompressedData);
 
-	/*
-	 *  The zlib header and checkvalue don't belong to the compressed data.
-	 */
+		return (-1);
+	}
 
 	puffSrc = CompressedData + PNG_ZlibHeader_Size;
 	puffSrcLen = CompressedDataLength - PNG_ZlibHeader_Size - PNG_ZlibCheckValue_Size;
 
-	/*
-	 *  first puff() to calculate the size of the uncompressed data
-	 */
+	if (ExpectedLength) {
+		puffDestLen = ExpectedLength;
+	} else {
+		/*
+		 *  first puff() to calculate the size of the uncompressed data
+		 */
 
-	puffResult = puff(puffDest, &puffDestLen, puffSrc, &puffSrcLen);
-	if (!((puffResult == 0) && (puffDestLen > 0))) {
-		ri.Free(CompressedData);
+		puffDest = NULL;
+		puffDestLen = 0;
 
-		return (-1);
+		puffResult = puff(puffDest, &puffDestLen, puffSrc, &puffSrcLen);
+		if (!((puffResult == 0) && (puffDestLen > 0))) {
+			R_ImageFree(CompressedData);
+
+			return (-1);
+		}
+
+		/*
+		 *  Set the input again in case something was changed by the last puff() .
+		 */
+
+		puffSrcLen = CompressedDataLength - PNG_ZlibHeader_Size - PNG_ZlibCheckValue_Size;
 	}
 
 	/*
 	 *  Allocate the buffer for the uncompressed data.
 	 */
 
-	DecompressedData = ri.Malloc(puffDestLen);
+	DecompressedData = R_ImageMalloc(puffDestLen);
 	if (!DecompressedData) {
-		ri.Free(CompressedData);
+		R_ImageFree(CompressedData);
 
 		return (-1);
 	}
 
-	/*
-	 *  Set the input again in case something was changed by the last puff() .
-	 */
+#ifdef USE_LIBDEFLATE
+	if (ExpectedLength) {
+		struct libdeflate_decompressor *Decompressor;
+		size_t ActualLength;
+		enum libdeflate_result Result;
 
-	puffDest = DecompressedData;
-	puffSrc = CompressedData + PNG_ZlibHeader_Size;
-	puffSrcLen = CompressedDataLength - PNG_ZlibHeader_Size - PNG_ZlibCheckValue_Size;
+		/*
+		 *  libdeflate wants the whole output at once, which we know the size of.
+		 *  It checks the zlib header and the Adler-32 too.
+		 */
+
+		Decompressor = libdeflate_alloc_decompressor();
+		if (!Decompressor) {
+			R_ImageFree(DecompressedData);
+			R_ImageFree(CompressedData);
+
+			return (-1);
+		}
+
+		Result = libdeflate_zlib_decompress(Decompressor, CompressedData, CompressedDataLength, DecompressedData,
+											ExpectedLength, &ActualLength);
+		libdeflate_free_decompressor(Decompressor);
+
+		R_ImageFree(CompressedData);
+
+		if (Result != LIBDEFLATE_SUCCESS || ActualLength != ExpectedLength) {
+			R_ImageFree(DecompressedData);
+
+			return (-1);
+		}
+
+		*Buffer = DecompressedData;
+
+		return (ExpectedLength);
+	}
+#endif
 
 	/*
 	 *  decompression puff()
 	 */
 
+	puffDest = DecompressedData;
 	puffResult = puff(puffDest, &puffDestLen, puffSrc, &puffSrcLen);
 
 	/*
 	 *  The compressed data is not needed anymore.
 	 */
 
-	ri.Free(CompressedData);
+	R_ImageFree(CompressedData);
 
 	/*
 	 *  Check if the last puff() was successful.
 	 */
 
 	if (!((puffResult == 0) && (puffDestLen > 0))) {
-		ri.Free(DecompressedData);
+		R_ImageFree(DecompressedData);
 
 		return (-1);
 	}
@@ -730,14 +815,13 @@ static uint32_t DecompressIDATs(struct BufferedFile *BF, uint8_t **Buffer) {
  *  the Paeth predictor
  */
 
-static uint8_t PredictPaeth(uint8_t a, uint8_t b, uint8_t c) {
+static ID_INLINE uint8_t PredictPaeth(uint8_t a, uint8_t b, uint8_t c) {
 	/*
 	 *  a == Left
 	 *  b == Up
 	 *  c == UpLeft
 	 */
 
-	uint8_t Pr;
 	int p;
 	int pa, pb, pc;
 
@@ -747,168 +831,297 @@ static uint8_t PredictPaeth(uint8_t a, uint8_t b, uint8_t c) {
 	pc = abs(p - ((int)c));
 
 	if ((pa <= pb) && (pa <= pc)) {
-		Pr = a;
+		return (a);
 	} else if (pb <= pc) {
-		Pr = b;
-	} else {
-		Pr = c;
+		return (b);
 	}
 
-	return (Pr);
+	return (c);
 }
 
+#if defined(__SSE2__) || defined(_M_X64)
+#define PNG_SSE2 1
+#else
+#define PNG_SSE2 0
+#endif
+
+#if PNG_SSE2
+
+#include <emmintrin.h>
+
 /*
- *  Reverse the filters.
+ *  SSE2 versions of the Sub, Average and Paeth filters for 3 and 4 bytes
+ *  per pixel, the usual RGB and RGBA images.  These filters depend on the
+ *  pixel to the left, so a whole pixel is done at a time.
  */
 
-static qboolean UnfilterImage(uint8_t *DecompressedData, uint32_t ImageHeight, uint32_t BytesPerScanline,
-							  uint32_t BytesPerPixel) {
-	uint8_t *DecompPtr;
-	uint8_t FilterType;
-	uint8_t *PixelLeft, *PixelUp, *PixelUpLeft;
-	uint32_t w, h, p;
+static ID_INLINE __m128i LoadPixel(const uint8_t *Ptr, uint32_t BytesPerPixel) {
+	int32_t Pixel = 0;
 
-	/*
-	 *  some zeros for the filters
-	 */
+	memcpy(&Pixel, Ptr, BytesPerPixel);
+
+	return (_mm_cvtsi32_si128(Pixel));
+}
 
-	uint8_t Zeros[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+static ID_INLINE void StorePixel(uint8_t *Ptr, __m128i Pixel, uint32_t BytesPerPixel) {
+	int32_t Value = _mm_cvtsi128_si32(Pixel);
 
-	/*
-	 *  input verification
-	 */
+	memcpy(Ptr, &Value, BytesPerPixel);
+}
 
-	if (!(DecompressedData && BytesPerPixel)) {
-		return (qfalse);
+static void UnfilterSub_SSE2(uint8_t *Out, const uint8_t *In, uint32_t Length, uint32_t BytesPerPixel) {
+	__m128i a = _mm_setzero_si128();
+	uint32_t i;
+
+	for (i = 0; i < Length; i += BytesPerPixel) {
+		a = _mm_add_epi8(a, LoadPixel(In + i, BytesPerPixel));
+		StorePixel(Out + i, a, BytesPerPixel);
 	}
+}
 
-	/*
-	 *  ImageHeight and BytesPerScanline can be zero in small interlaced images.
-	 */
+static void UnfilterAverage_SSE2(uint8_t *Out, const uint8_t *In, const uint8_t *Prev, uint32_t Length,
+								 uint32_t BytesPerPixel) {
+	__m128i a = _mm_setzero_si128();
+	__m128i One = _mm_set1_epi8(1);
+	__m128i b, Avg;
+	uint32_t i;
 
-	if ((!ImageHeight) || (!BytesPerScanline)) {
-		return (qtrue);
+	for (i = 0; i < Length; i += BytesPerPixel) {
+		b = LoadPixel(Prev + i, BytesPerPixel);
+
+		/*
+		 *  _mm_avg_epu8 rounds up, take the lost bit off again
+		 */
+
+		Avg = _mm_sub_epi8(_mm_avg_epu8(a, b), _mm_and_si128(_mm_xor_si128(a, b), One));
+		a = _mm_add_epi8(Avg, LoadPixel(In + i, BytesPerPixel));
+		StorePixel(Out + i, a, BytesPerPixel);
 	}
+}
 
-	/*
-	 *  Set the pointer to the start of the decompressed Data.
-	 */
+static ID_INLINE __m128i Abs16(__m128i x) {
+	return (_mm_max_epi16(x, _mm_sub_epi16(_mm_setzero_si128(), x)));
+}
 
-	DecompPtr = DecompressedData;
+static ID_INLINE __m128i Select16(__m128i Mask, __m128i a, __m128i b) {
+	return (_mm_or_si128(_mm_and_si128(Mask, a), _mm_andnot_si128(Mask, b)));
+}
 
-	/*
-	 *  Un-filtering is done in place.
-	 */
+static void UnfilterPaeth_SSE2(uint8_t *Out, const uint8_t *In, const uint8_t *Prev, uint32_t Length,
+							   uint32_t BytesPerPixel) {
+	__m128i Zero = _mm_setzero_si128();
+	__m128i a = Zero, c = Zero;
+	__m128i b, x, pa, pb, pc, Smallest, Nearest;
+	uint32_t i;
 
 	/*
-	 *  Go trough all scanlines.
+	 *  The pixels are widened to 16 bits so that the distances fit.
 	 */
 
-	for (h = 0; h < ImageHeight; h++) {
+	for (i = 0; i < Length; i += BytesPerPixel) {
+		b = _mm_unpacklo_epi8(LoadPixel(Prev + i, BytesPerPixel), Zero);
+		x = _mm_unpacklo_epi8(LoadPixel(In + i, BytesPerPixel), Zero);
+
 		/*
-		 *  Every scanline starts with a FilterType byte.
+		 *  p = a + b - c, so p - a = b - c, p - b = a - c and p - c is the sum of both
 		 */
 
-		FilterType = *DecompPtr;
-		DecompPtr++;
+		pa = _mm_sub_epi16(b, c);
+		pb = _mm_sub_epi16(a, c);
+		pc = _mm_add_epi16(pa, pb);
+
+		pa = Abs16(pa);
+		pb = Abs16(pb);
+		pc = Abs16(pc);
+
+		Smallest = _mm_min_epi16(pc, _mm_min_epi16(pa, pb));
 
 		/*
-		 *  Left pixel of the first byte in a scanline is zero.
+		 *  ties go to a, then b, like PredictPaeth
 		 */
 
-		PixelLeft = Zeros;
+		Nearest = Select16(_mm_cmpeq_epi16(Smallest, pb), b, c);
+		Nearest = Select16(_mm_cmpeq_epi16(Smallest, pa), a, Nearest);
 
 		/*
-		 *  Set PixelUp to previous line only if we are on the second line or above.
-		 *
-		 *  Plus one byte for the FilterType
+		 *  add in 8 bits so the sum wraps, the high bytes stay zero
 		 */
 
-		if (h > 0) {
-			PixelUp = DecompPtr - (BytesPerScanline + 1);
-		} else {
-			PixelUp = Zeros;
+		a = _mm_add_epi8(x, Nearest);
+		c = b;
+
+		StorePixel(Out + i, _mm_packus_epi16(a, a), BytesPerPixel);
+	}
+}
+
+#endif
+
+/*
+ *  Reverse the filter of one scanline.
+ *
+ *  In and Out may be the same scanline.  Prev is the unfiltered previous
+ *  scanline, or NULL for the first one.
+ */
+
+static qboolean UnfilterScanline(uint8_t FilterType, uint8_t *Out, const uint8_t *In, const uint8_t *Prev,
+								 uint32_t Length, uint32_t BytesPerPixel) {
+	uint32_t i;
+
+	/*
+	 *  The first scanline is filtered against a scanline of zeros,
+	 *  Up is None, Paeth is Sub then.
+	 */
+
+	if (!Prev) {
+		if (FilterType == PNG_FilterType_Up) {
+			FilterType = PNG_FilterType_None;
+		} else if (FilterType == PNG_FilterType_Paeth) {
+			FilterType = PNG_FilterType_Sub;
 		}
+	}
 
-		/*
-		 * The pixel left to the first pixel of the previous scanline is zero too.
-		 */
+	switch (FilterType) {
+	case PNG_FilterType_None: {
+		if (Out != In) {
+			memcpy(Out, In, Length);
+		}
+
+		break;
+	}
+
+	case PNG_FilterType_Sub: {
+#if PNG_SSE2
+		if (BytesPerPixel == 3 || BytesPerPixel == 4) {
+			UnfilterSub_SSE2(Out, In, Length, BytesPerPixel);
+
+			break;
+		}
+#endif
+
+		for (i = 0; i < BytesPerPixel && i < Length; i++) {
+			Out[i] = In[i];
+		}
 
-		PixelUpLeft = Zeros;
+		for (; i < Length; i++) {
+			Out[i] = In[i] + Out[i - BytesPerPixel];
+		}
 
+		break;
+	}
+
+	case PNG_FilterType_Up: {
 		/*
-		 *  Cycle trough all pixels of the scanline.
+		 *  no dependency between the bytes, the compiler vectorizes this
 		 */
 
-		for (w = 0; w < (BytesPerScanline / BytesPerPixel); w++) {
-			/*
-			 *  Cycle trough the bytes of the pixel.
-			 */
+		for (i = 0; i < Length; i++) {
+			Out[i] = In[i] + Prev[i];
+		}
 
-			for (p = 0; p < BytesPerPixel; p++) {
-				switch (FilterType) {
-				case PNG_FilterType_None: {
-					/*
-					 *  The byte is unfiltered.
-					 */
+		break;
+	}
 
-					break;
-				}
+	case PNG_FilterType_Average: {
+		if (!Prev) {
+			for (i = 0; i < BytesPerPixel && i < Length; i++) {
+				Out[i] = In[i];
+			}
 
-				case PNG_FilterType_Sub: {
-					DecompPtr[p] += PixelLeft[p];
+			for (; i < Length; i++) {
+				Out[i] = In[i] + (Out[i - BytesPerPixel] >> 1);
+			}
 
-					break;
-				}
+			break;
+		}
 
-				case PNG_FilterType_Up: {
-					DecompPtr[p] += PixelUp[p];
+#if PNG_SSE2
+		if (BytesPerPixel == 3 || BytesPerPixel == 4) {
+			UnfilterAverage_SSE2(Out, In, Prev, Length, BytesPerPixel);
 
-					break;
-				}
+			break;
+		}
+#endif
 
-				case PNG_FilterType_Average: {
-					DecompPtr[p] += ((uint8_t)((((uint16_t)PixelLeft[p]) + ((uint16_t)PixelUp[p])) / 2));
+		for (i = 0; i < BytesPerPixel && i < Length; i++) {
+			Out[i] = In[i] + (Prev[i] >> 1);
+		}
 
-					break;
-				}
+		for (; i < Length; i++) {
+			Out[i] = In[i] + ((uint8_t)((((uint16_t)Out[i - BytesPerPixel]) + ((uint16_t)Prev[i])) / 2));
+		}
+
+		break;
+	}
 
-				case PNG_FilterType_Paeth: {
-					DecompPtr[p] += PredictPaeth(PixelLeft[p], PixelUp[p], PixelUpLeft[p]);
+	case PNG_FilterType_Paeth: {
+#if PNG_SSE2
+		if (BytesPerPixel == 3 || BytesPerPixel == 4) {
+			UnfilterPaeth_SSE2(Out, In, Prev, Length, BytesPerPixel);
 
-					break;
-				}
+			break;
+		}
+#endif
 
-				default: {
-					return (qfalse);
-				}
-				}
-			}
+		for (i = 0; i < BytesPerPixel && i < Length; i++) {
+			Out[i] = In[i] + Prev[i];
+		}
 
-			PixelLeft = DecompPtr;
+		for (; i < Length; i++) {
+			Out[i] = In[i] + PredictPaeth(Out[i - BytesPerPixel], Prev[i], Prev[i - BytesPerPixel]);
+		}
 
-			/*
-			 *  We only have an upleft pixel if we are on the second line or above.
-			 */
+		break;
+	}
 
-			if (h > 0) {
-				PixelUpLeft = DecompPtr - (BytesPerScanline + 1);
-			}
+	default: {
+		return (qfalse);
+	}
+	}
 
-			/*
-			 *  Skip to the next pixel.
-			 */
+	return (qtrue);
+}
 
-			DecompPtr += BytesPerPixel;
+/*
+ *  Reverse the filters.
+ */
 
-			/*
-			 *  We only have a previous line if we are on the second line and above.
-			 */
+static qboolean UnfilterImage(uint8_t *DecompressedData, uint32_t ImageHeight, uint32_t BytesPerScanline,
+							  uint32_t BytesPerPixel) {
+	uint8_t *DecompPtr;
+	uint8_t *PrevScanline;
+	uint32_t h;
 
-			if (h > 0) {
-				PixelUp = DecompPtr - (BytesPerScanline + 1);
-			}
+	/*
+	 *  input verification
+	 */
+
+	if (!(DecompressedData && BytesPerPixel)) {
+		return (qfalse);
+	}
+
+	/*
+	 *  ImageHeight and BytesPerScanline can be zero in small interlaced images.
+	 */
+
+	if ((!ImageHeight) || (!BytesPerScanline)) {
+		return (qtrue);
+	}
+
+	/*
+	 *  Un-filtering is done in place, every scanline starts with a FilterType byte.
+	 */
+
+	DecompPtr = DecompressedData;
+	PrevScanline = NULL;
+
+	for (h = 0; h < ImageHeight; h++) {
+		if (!UnfilterScanline(DecompPtr[0], DecompPtr + 1, DecompPtr + 1, PrevScanline, BytesPerScanline,
+							  BytesPerPixel)) {
+			return (qfalse);
 		}
+
+		PrevScanline = DecompPtr + 1;
+		DecompPtr += BytesPerScanline + 1;
 	}
 
 	return (qtrue);
@@ -1289,6 +1502,30 @@ static qboolean DecodeImageNonInterlaced(struct PNG_Chunk_IHDR *IHDR, byte *OutB
 		return (qfalse);
 	}
 
+	/*
+	 *  8 bit RGBA is already in our format,
+	 *  unfilter it straight into the output image.
+	 */
+
+	if ((IHDR->ColourType == PNG_ColourType_TrueAlpha) && (IHDR->BitDepth == PNG_BitDepth_8)) {
+		byte *PrevPtr = NULL;
+
+		OutPtr = OutBuffer;
+		DecompPtr = DecompressedData;
+
+		for (h = 0; h < IHDR_Height; h++) {
+			if (!UnfilterScanline(DecompPtr[0], OutPtr, DecompPtr + 1, PrevPtr, BytesPerScanline, BytesPerPixel)) {
+				return (qfalse);
+			}
+
+			PrevPtr = OutPtr;
+			OutPtr += BytesPerScanline;
+			DecompPtr += BytesPerScanline + 1;
+		}
+
+		return (qtrue);
+	}
+
 	/*
 	 *  Unfilter the image.
 	 */
@@ -1297,6 +1534,38 @@ static qboolean DecodeImageNonInterlaced(struct PNG_Chunk_IHDR *IHDR, byte *OutB
 		return (qfalse);
 	}
 
+	/*
+	 *  8 bit RGB only needs the alpha added.
+	 */
+
+	if ((IHDR->ColourType == PNG_ColourType_True) && (IHDR->BitDepth == PNG_BitDepth_8)) {
+		OutPtr = OutBuffer;
+		DecompPtr = DecompressedData;
+
+		for (h = 0; h < IHDR_Height; h++) {
+			DecompPtr++;
+
+			for (w = 0; w < IHDR_Width; w++) {
+				OutPtr[0] = DecompPtr[0];
+				OutPtr[1] = DecompPtr[1];
+				OutPtr[2] = DecompPtr[2];
+				OutPtr[3] = 0xFF;
+
+				if (HasTransparentColour) {
+					if ((TransparentColour[1] == DecompPtr[0]) && (TransparentColour[3] == DecompPtr[1]) &&
+						(TransparentColour[5] == DecompPtr[2])) {
+						OutPtr[3] = 0x00;
+					}
+				}
+
+				OutPtr += Q3IMAGE_BYTESPERPIXEL;
+				DecompPtr += 3;
+			}
+		}
+
+		return (qtrue);
+	}
+
 	/*
 	 *  Set the working pointers to the beginning of the buffers.
 	 */
@@ -1700,7 +1969,7 @@ static qboolean DecodeImageInterlaced(struct PNG_Chunk_IHDR *IHDR, byte *OutBuff
  *  The PNG loader
  */
 
-void R_LoadPNG(const char *name, byte **pic, int *width, int *height) {
+void R_DecodePNG(const char *name, byte *buffer, int length, byte **pic, int *width, int *height) {
 	struct BufferedFile *ThePNG;
 	byte *OutBuffer;
 	uint8_t *Signature;
@@ -1752,10 +2021,10 @@ void R_LoadPNG(const char *name, byte **pic, int *width, int *height) {
 	}
 
 	/*
-	 *  Read the file.
+	 *  Wrap the file.
 	 */
 
-	ThePNG = ReadBufferedFile(name);
+	ThePNG = OpenBufferedFile(buffer, length);
 	if (!ThePNG) {
 		return;
 	}
@@ -1849,7 +2118,7 @@ void R_LoadPNG(const char *name, byte **pic, int *width, int *height) {
 	if (!((IHDR_Width > 0) && (IHDR_Height > 0)) || IHDR_Width > INT_MAX / Q3IMAGE_BYTESPERPIXEL / IHDR_Height) {
 		CloseBufferedFile(ThePNG);
 
-		ri.Printf(PRINT_WARNING, "%s: invalid image size\n", name);
+		R_ImagePrintf(PRINT_WARNING, "%s: invalid image size\n", name);
 
 		return;
 	}
@@ -2147,7 +2416,7 @@ void R_LoadPNG(const char *name, byte **pic, int *width, int *height) {
 	 *  Decompress all IDAT chunks
 	 */
 
-	DecompressedDataLength = DecompressIDATs(ThePNG, &DecompressedData);
+	DecompressedDataLength = DecompressIDATs(ThePNG, &DecompressedData, FilteredImageLength(IHDR));
 	if (!(DecompressedDataLength && DecompressedData)) {
 		CloseBufferedFile(ThePNG);
 
@@ -2158,9 +2427,9 @@ void R_LoadPNG(const char *name, byte **pic, int *width, int *height) {
 	 *  Allocate output buffer.
 	 */
 
-	OutBuffer = ri.Malloc(IHDR_Width * IHDR_Height * Q3IMAGE_BYTESPERPIXEL);
+	OutBuffer = R_ImageMalloc(IHDR_Width * IHDR_Height * Q3IMAGE_BYTESPERPIXEL);
 	if (!OutBuffer) {
-		ri.Free(DecompressedData);
+		R_ImageFree(DecompressedData);
 		CloseBufferedFile(ThePNG);
 
 		return;
@@ -2174,8 +2443,8 @@ void R_LoadPNG(const char *name, byte **pic, int *width, int *height) {
 	case PNG_InterlaceMethod_NonInterlaced: {
 		if (!DecodeImageNonInterlaced(IHDR, OutBuffer, DecompressedData, DecompressedDataLength, HasTransparentColour,
 									  TransparentColour, OutPal)) {
-			ri.Free(OutBuffer);
-			ri.Free(DecompressedData);
+			R_ImageFree(OutBuffer);
+			R_ImageFree(DecompressedData);
 			CloseBufferedFile(ThePNG);
 
 			return;
@@ -2187,8 +2456,8 @@ void R_LoadPNG(const char *name, byte **pic, int *width, int *height) {
 	case PNG_InterlaceMethod_Interlaced: {
 		if (!DecodeImageInterlaced(IHDR, OutBuffer, DecompressedData, DecompressedDataLength, HasTransparentColour,
 								   TransparentColour, OutPal)) {
-			ri.Free(OutBuffer);
-			ri.Free(DecompressedData);
+			R_ImageFree(OutBuffer);
+			R_ImageFree(DecompressedData);
 			CloseBufferedFile(ThePNG);
 
 			return;
@@ -2198,8 +2467,8 @@ void R_LoadPNG(const char *name, byte **pic, int *width, int *height) {
 	}
 
 	default: {
-		ri.Free(OutBuffer);
-		ri.Free(DecompressedData);
+		R_ImageFree(OutBuffer);
+		R_ImageFree(DecompressedData);
 		CloseBufferedFile(ThePNG);
 
 		return;
@@ -2228,7 +2497,7 @@ void R_LoadPNG(const char *name, byte **pic, int *width, int *height) {
 	 *  DecompressedData is not needed anymore.
 	 */
 
-	ri.Free(DecompressedData);
+	R_ImageFree(DecompressedData);
 
 	/*
 	 *  We have all data, so close the file.
@@ -2236,3 +2505,38 @@ void R_LoadPNG(const char *name, byte **pic, int *width, int *height) {
 
 	CloseBufferedFile(ThePNG);
 }
+
+void R_LoadPNG(const char *name, byte **pic, int *width, int *height) {
+	union {
+		byte *b;
+		void *v;
+	} buffer;
+	int length;
+
+	if (!(name && pic)) {
+		return;
+	}
+
+	*pic = NULL;
+
+	if (width) {
+		*width = 0;
+	}
+
+	if (height) {
+		*height = 0;
+	}
+
+	/*
+	 *  Read the file.
+	 */
+
+	length = ri.FS_ReadFile((char *)name, &buffer.v);
+	if (!buffer.b || length < 0) {
+		return;
+	}
+
+	R_DecodePNG(name, buffer.b, length, pic, width, height);
+
+	ri.FS_FreeFile(buffer.v);
+}
@@ -0,0 +1,473 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+// tr_image_prefetch.c -- decodes the images of a level on the job threads
+
+#include <setjmp.h>
+
+#include "tr_common.h"
+#include "../qcommon/qcommon.h"
+
+/*
+========================================================================
+
+The shaders of a level name their images before any of them is parsed.
+R_PrefetchImages resolves those names to files the way R_LoadImage does,
+and the first R_LoadImage for one of them reads it and the images queued
+after it on the main thread, then decodes the whole batch on r_imageThreads
+job threads.  The render thread still creates and uploads every image
+itself, in the order the shaders ask for them.
+
+Job threads may not use the Z_ heap or print, and an ERR_DROP longjmp
+from one would tear down the level under the other jobs.  So the decoders
+allocate through R_ImageMalloc and fail through R_ImagePrintf and
+R_ImageError, which on a job thread give up on the image instead.
+R_LoadImage then loads it on the main thread again, and reports or
+drops just like it always did.
+
+========================================================================
+*/
+
+#define MAX_PREFETCH_IMAGES 1024
+#define MAX_PREFETCH_BATCH 64
+#define MAX_DECODE_ALLOCS 16
+
+typedef enum {
+	PI_QUEUED,	// named by a shader, not resolved or not decoded yet
+	PI_DECODED, // pic is ready to be taken
+	PI_DONE		// taken, or left to R_LoadImage
+} prefetchState_t;
+
+typedef struct {
+	char name[MAX_QPATH]; // as the shader names it
+	char path[MAX_QPATH]; // the file R_LoadImage would load for it
+	void (*decode)(const char *name, byte *buffer, int length, byte **pic, int *width, int *height);
+
+	byte *buffer;
+	int length;
+
+	byte *pic; // malloc, copied to the Z_ heap when taken
+	int width, height;
+	prefetchState_t state;
+} prefetchImage_t;
+
+typedef struct {
+	jmp_buf abort;
+	void *allocs[MAX_DECODE_ALLOCS];
+	int numAllocs;
+} decodeJob_t;
+
+typedef struct {
+	char *ext;
+	void (*decode)(const char *name, byte *buffer, int length, byte **pic, int *width, int *height);
+} prefetchLoader_t;
+
+// same order of preference as R_LoadImage, pcx and bmp are left to it
+static const prefetchLoader_t prefetchLoaders[] = {
+	{"png", R_DecodePNG}, {"tga", R_DecodeTGA}, {"jpg", R_DecodeJPG}, {"jpeg", R_DecodeJPG}};
+
+static const int numPrefetchLoaders = ARRAY_LEN(prefetchLoaders);
+
+static prefetchImage_t r_prefetchImages[MAX_PREFETCH_IMAGES];
+static int r_numPrefetchImages;
+static qboolean r_prefetchResolved;
+
+static Q_THREADLOCAL decodeJob_t *r_decodeJob;
+
+/*
+=================
+R_ImageMalloc
+=================
+*/
+void *R_ImageMalloc(int size) {
+	decodeJob_t *job = r_decodeJob;
+	void *ptr;
+
+	if (!job)
+		return ri.Malloc(size);
+
+	// like ri.Malloc the memory is cleared
+	if (job->numAllocs == MAX_DECODE_ALLOCS || !(ptr = calloc(1, size)))
+		longjmp(job->abort, 1);
+
+	job->allocs[job->numAllocs++] = ptr;
+	return ptr;
+}
+
+/*
+=================
+R_ImageFree
+=================
+*/
+void R_ImageFree(void *ptr) {
+	decodeJob_t *job = r_decodeJob;
+	int i;
+
+	if (!job) {
+		ri.Free(ptr);
+		return;
+	}
+
+	for (i = 0; i < job->numAllocs; i++) {
+		if (job->allocs[i] == ptr) {
+			job->allocs[i] = job->allocs[--job->numAllocs];
+			break;
+		}
+	}
+
+	free(ptr);
+}
+
+/*
+=================
+R_ImagePrintf
+
+Warnings are not printed from job threads, the image is loaded again on
+the main thread instead so they show up exactly as before
+=================
+*/
+void QDECL R_ImagePrintf(int printLevel, const char *fmt, ...) {
+	va_list argptr;
+	char msg[MAXPRINTMSG];
+
+	if (r_decodeJob)
+		longjmp(r_decodeJob->abort, 1);
+
+	va_start(argptr, fmt);
+	Q_vsnprintf(msg, sizeof(msg), fmt, argptr);
+	va_end(argptr);
+
+	ri.Printf(printLevel, "%s", msg);
+}
+
+/*
+=================
+R_ImageError
+=================
+*/
+void QDECL R_ImageError(const char *fmt, ...) {
+	va_list argptr;
+	char msg[MAXPRINTMSG];
+
+	if (r_decodeJob)
+		longjmp(r_decodeJob->abort, 1);
+
+	va_start(argptr, fmt);
+	Q_vsnprintf(msg, sizeof(msg), fmt, argptr);
+	va_end(argptr);
+
+	ri.Error(ERR_DROP, "%s", msg);
+}
+
+/*
+=================
+R_ImageDecodeJob
+=================
+*/
+qboolean R_ImageDecodeJob(void) {
+	return r_decodeJob != NULL;
+}
+
+/*
+=================
+R_QueueImagePrefetch
+=================
+*/
+void R_QueueImagePrefetch(const char *name) {
+	prefetchImage_t *p;
+	int i;
+
+	// $lightmap, $whiteimage and the like are not files
+	if (!name[0] || name[0] == '$' || name[0] == '*' || strlen(name) >= MAX_QPATH)
+		return;
+
+	if (r_prefetchResolved || r_numPrefetchImages == MAX_PREFETCH_IMAGES)
+		return;
+
+	for (i = 0; i < r_numPrefetchImages; i++) {
+		if (!Q_stricmp(r_prefetchImages[i].name, name))
+			return;
+	}
+
+	p = &r_prefetchImages[r_numPrefetchImages++];
+	Com_Memset(p, 0, sizeof(*p));
+	Q_strncpyz(p->name, name, sizeof(p->name));
+	p->state = PI_QUEUED;
+}
+
+/*
+=================
+R_QueueShaderImagePrefetch
+
+Queues the images of the stages of a shader, shaderText points right
+after its name like FindShaderInShaderText returns it
+=================
+*/
+void R_QueueShaderImagePrefetch(const char *shaderText) {
+	const char *p = shaderText;
+	const char *token;
+	int depth = 0;
+
+	while (1) {
+		token = COM_ParseExt(&p, qtrue);
+		if (!token[0])
+			return;
+
+		if (token[0] == '{') {
+			depth++;
+		} else if (token[0] == '}') {
+			if (--depth <= 0)
+				return;
+		} else if (!Q_stricmp(token, "map") || !Q_stricmp(token, "clampmap")) {
+			R_QueueImagePrefetch(COM_ParseExt(&p, qfalse));
+		} else if (!Q_stricmp(token, "animmap")) {
+			// skip the frequency
+			COM_ParseExt(&p, qfalse);
+
+			while ((token = COM_ParseExt(&p, qfalse))[0])
+				R_QueueImagePrefetch(token);
+		}
+	}
+}
+
+/*
+=================
+R_ResolvePrefetchImage
+
+Finds the file R_LoadImage would load for an image name
+=================
+*/
+static qboolean R_ResolvePrefetchImage(prefetchImage_t *p) {
+	char baseName[MAX_QPATH];
+	const char *ext;
+	int i;
+
+	ext = COM_GetExtension(p->name);
+
+	if (*ext) {
+		for (i = 0; i < numPrefetchLoaders; i++) {
+			if (!Q_stricmp(ext, prefetchLoaders[i].ext))
+				break;
+		}
+
+		// a pcx, bmp or some such is loaded as named
+		if (i == numPrefetchLoaders)
+			return qfalse;
+
+		if (ri.FS_ReadFile(p->name, NULL) > 0) {
+			Q_strncpyz(p->path, p->name, sizeof(p->path));
+			p->decode = prefetchLoaders[i].decode;
+			return qtrue;
+		}
+	}
+
+	COM_StripExtension(p->name, baseName, sizeof(baseName));
+
+	for (i = 0; i < numPrefetchLoaders; i++) {
+		Com_sprintf(p->path, sizeof(p->path), "%s.%s", baseName, prefetchLoaders[i].ext);
+
+		if (ri.FS_ReadFile(p->path, NULL) > 0) {
+			p->decode = prefetchLoaders[i].decode;
+			return qtrue;
+		}
+	}
+
+	return qfalse;
+}
+
+/*
+=================
+R_PrefetchImages
+
+Resolves the queued images and has the filesystem inflate their pak
+entries on its job threads, the images themselves are decoded in batches
+as R_LoadImage gets to them
+=================
+*/
+void R_PrefetchImages(void) {
+	char *paths[MAX_PREFETCH_IMAGES];
+	prefetchImage_t *p;
+	int i, numPaths;
+
+	if (r_prefetchResolved)
+		return;
+
+	if (r_imageThreads->integer <= 0) {
+		R_FlushPrefetchedImages();
+		return;
+	}
+
+	r_prefetchResolved = qtrue;
+
+	for (i = 0, numPaths = 0, p = r_prefetchImages; i < r_numPrefetchImages; i++, p++) {
+		if (R_ResolvePrefetchImage(p))
+			paths[numPaths++] = p->path;
+		else
+			p->state = PI_DONE;
+	}
+
+	ri.FS_Prefetch(NULL, paths, numPaths);
+}
+
+/*
+=================
+R_DecodeImageJob
+=================
+*/
+static void R_DecodeImageJob(void *data, int index) {
+	prefetchImage_t *p = ((prefetchImage_t **)data)[index];
+	decodeJob_t job;
+	int i;
+
+	job.numAllocs = 0;
+	r_decodeJob = &job;
+
+	if (!setjmp(job.abort)) {
+		p->decode(p->path, p->buffer, p->length, &p->pic, &p->width, &p->height);
+	} else {
+		for (i = 0; i < r_decodeJob->numAllocs; i++)
+			free(r_decodeJob->allocs[i]);
+
+		p->pic = NULL;
+	}
+
+	// whatever is still allocated on success is the pic
+	r_decodeJob = NULL;
+}
+
+/*
+=================
+R_DecodePrefetchBatch
+
+Reads the image at start and the queued images after it, and decodes
+them on the job threads
+=================
+*/
+static void R_DecodePrefetchBatch(int start) {
+	prefetchImage_t *batch[MAX_PREFETCH_BATCH];
+	prefetchImage_t *p;
+	union {
+		byte *b;
+		void *v;
+	} buffer;
+	int i, numBatch, maxBatch;
+
+	// images of the last batch that were not asked for yet are decoded again
+	// when they are, rather than piling up
+	for (i = 0, p = r_prefetchImages; i < r_numPrefetchImages; i++, p++) {
+		if (p->state == PI_DECODED) {
+			free(p->pic);
+			p->pic = NULL;
+			p->state = PI_QUEUED;
+		}
+	}
+
+	maxBatch = MIN(r_imageThreads->integer * 4, MAX_PREFETCH_BATCH);
+
+	for (i = start, numBatch = 0; i < r_numPrefetchImages && numBatch < maxBatch; i++) {
+		p = &r_prefetchImages[i];
+		if (p->state != PI_QUEUED)
+			continue;
+
+		p->length = ri.FS_ReadFile(p->path, &buffer.v);
+		if (!buffer.b || p->length <= 0) {
+			if (buffer.b)
+				ri.FS_FreeFile(buffer.v);
+			p->state = PI_DONE;
+			continue;
+		}
+
+		p->buffer = buffer.b;
+		batch[numBatch++] = p;
+	}
+
+	ri.RunJobs(R_DecodeImageJob, batch, numBatch, MAX(r_imageThreads->integer, 1));
+
+	// temp memory goes back in the reverse order
+	for (i = numBatch - 1; i >= 0; i--) {
+		p = batch[i];
+		ri.FS_FreeFile(p->buffer);
+		p->buffer = NULL;
+		p->state = PI_DECODED;
+	}
+}
+
+/*
+=================
+R_TakePrefetchedImage
+
+Hands R_LoadImage the prefetched pic of an image, if there is one.
+A qfalse return leaves the image to the regular loaders.
+=================
+*/
+qboolean R_TakePrefetchedImage(const char *name, byte **pic, int *width, int *height) {
+	prefetchImage_t *p;
+	int i, size;
+
+	if (!r_prefetchResolved)
+		return qfalse;
+
+	for (i = 0, p = r_prefetchImages; i < r_numPrefetchImages; i++, p++) {
+		if (!Q_stricmp(p->name, name))
+			break;
+	}
+
+	if (i == r_numPrefetchImages || p->state == PI_DONE)
+		return qfalse;
+
+	if (p->state == PI_QUEUED)
+		R_DecodePrefetchBatch(i);
+
+	p->state = PI_DONE;
+
+	// unreadable or failed, R_LoadImage tries again and reports why
+	if (!p->pic)
+		return qfalse;
+
+	size = p->width * p->height * 4;
+	*pic = ri.Malloc(size);
+	Com_Memcpy(*pic, p->pic, size);
+	*width = p->width;
+	*height = p->height;
+
+	free(p->pic);
+	p->pic = NULL;
+
+	return qtrue;
+}
+
+/*
+=================
+R_FlushPrefetchedImages
+
+Drops whatever R_PrefetchImages queued or decoded that was not taken,
+once the level is registered
+=================
+*/
+void R_FlushPrefetchedImages(void) {
+	int i;
+
+	for (i = 0; i < r_numPrefetchImages; i++)
+		free(r_prefetchImages[i].pic);
+
+	r_numPrefetchImages = 0;
+	r_prefetchResolved = qfalse;
+}
@@ -38,19 +38,14 @@ typedef struct _TargaHeader {
 	unsigned char pixel_size, attributes;
 } TargaHeader;
 
-void R_LoadTGA(const char *name, byte **pic, int *width, int *height) {
+void R_DecodeTGA(const char *name, byte *buffer, int length, byte **pic, int *width, int *height) {
 	unsigned columns, rows, numPixels;
 	byte *pixbuf;
 	int row, column;
 	byte *buf_p;
 	byte *end;
-	union {
-		byte *b;
-		void *v;
-	} buffer;
 	TargaHeader targa_header;
 	byte *targa_rgba;
-	int length;
 
 	*pic = NULL;
 
@@ -59,20 +54,12 @@ void R_LoadTGA(const char *name, byte **pic, int *width, int *height) {
 	if (height)
 		*height = 0;
 
-	//
-	// load the file
-	//
-	length = ri.FS_ReadFile((char *)name, &buffer.v);
-	if (!buffer.b || length < 0) {
-		return;
-	}
-
 	if (length < 18) {
-		ri.Error(ERR_DROP, "LoadTGA: header too short (%s)", name);
+		R_ImageError("LoadTGA: header too short (%s)", name);
 	}
 
-	buf_p = buffer.b;
-	end = buffer.b + length;
+	buf_p = buffer;
+	end = buffer + length;
 
 	targa_header.id_length = buf_p[0];
 	targa_header.colormap_type = buf_p[1];
@@ -98,15 +85,15 @@ void R_LoadTGA(const char *name, byte **pic, int *width, int *height) {
 	buf_p += 18;
 
 	if (targa_header.image_type != 2 && targa_header.image_type != 10 && targa_header.image_type != 3) {
-		ri.Error(ERR_DROP, "LoadTGA: Only type 2 (RGB), 3 (gray), and 10 (RGB) TGA images supported");
+		R_ImageError("LoadTGA: Only type 2 (RGB), 3 (gray), and 10 (RGB) TGA images supported");
 	}
 
 	if (targa_header.colormap_type != 0) {
-		ri.Error(ERR_DROP, "LoadTGA: colormaps not supported");
+		R_ImageError("LoadTGA: colormaps not supported");
 	}
 
 	if ((targa_header.pixel_size != 32 && targa_header.pixel_size != 24) && targa_header.image_type != 3) {
-		ri.Error(ERR_DROP, "LoadTGA: Only 32 or 24 bit images supported (no colormaps)");
+		R_ImageError("LoadTGA: Only 32 or 24 bit images supported (no colormaps)");
 	}
 
 	columns = targa_header.width;
@@ -114,21 +101,21 @@ void R_LoadTGA(const char *name, byte **pic, int *width, int *height) {
 	numPixels = columns * rows * 4;
 
 	if (!columns || !rows || numPixels > 0x7FFFFFFF || numPixels / columns / 4 != rows) {
-		ri.Error(ERR_DROP, "LoadTGA: %s has an invalid image size", name);
+		R_ImageError("LoadTGA: %s has an invalid image size", name);
 	}
 
-	targa_rgba = ri.Malloc(numPixels);
+	targa_rgba = R_ImageMalloc(numPixels);
 
 	if (targa_header.id_length != 0) {
 		if (buf_p + targa_header.id_length > end)
-			ri.Error(ERR_DROP, "LoadTGA: header too short (%s)", name);
+			R_ImageError("LoadTGA: header too short (%s)", name);
 
 		buf_p += targa_header.id_length; // skip TARGA image comment
 	}
 
 	if (targa_header.image_type == 2 || targa_header.image_type == 3) {
 		if (buf_p + columns * rows * targa_header.pixel_size / 8 > end) {
-			ri.Error(ERR_DROP, "LoadTGA: file truncated (%s)", name);
+			R_ImageError("LoadTGA: file truncated (%s)", name);
 		}
 
 		// Uncompressed RGB or gray scale image
@@ -168,7 +155,7 @@ void R_LoadTGA(const char *name, byte **pic, int *width, int *height) {
 					*pixbuf++ = alphabyte;
 					break;
 				default:
-					ri.Error(ERR_DROP, "LoadTGA: illegal pixel_size '%d' in file '%s'", targa_header.pixel_size, name);
+					R_ImageError("LoadTGA: illegal pixel_size '%d' in file '%s'", targa_header.pixel_size, name);
 					break;
 				}
 			}
@@ -180,12 +167,12 @@ void R_LoadTGA(const char *name, byte **pic, int *width, int *height) {
 			pixbuf = targa_rgba + row * columns * 4;
 			for (column = 0; column < columns;) {
 				if (buf_p + 1 > end)
-					ri.Error(ERR_DROP, "LoadTGA: file truncated (%s)", name);
+					R_ImageError("LoadTGA: file truncated (%s)", name);
 				packetHeader = *buf_p++;
 				packetSize = 1 + (packetHeader & 0x7f);
 				if (packetHeader & 0x80) { // run-length packet
 					if (buf_p + targa_header.pixel_size / 8 > end)
-						ri.Error(ERR_DROP, "LoadTGA: file truncated (%s)", name);
+						R_ImageError("LoadTGA: file truncated (%s)", name);
 					switch (targa_header.pixel_size) {
 					case 24:
 						blue = *buf_p++;
@@ -200,8 +187,8 @@ void R_LoadTGA(const char *name, byte **pic, int *width, int *height) {
 						alphabyte = *buf_p++;
 						break;
 					default:
-						ri.Error(ERR_DROP, "LoadTGA: illegal pixel_size '%d' in file '%s'", targa_header.pixel_size,
-								 name);
+						R_ImageError("LoadTGA: illegal pixel_size '%d' in file '%s'", targa_header.pixel_size,
+									 name);
 						break;
 					}
 
@@ -223,7 +210,7 @@ void R_LoadTGA(const char *name, byte **pic, int *width, int *height) {
 				} else { // non run-length packet
 
 					if (buf_p + targa_header.pixel_size / 8 * packetSize > end)
-						ri.Error(ERR_DROP, "LoadTGA: file truncated (%s)", name);
+						R_ImageError("LoadTGA: file truncated (%s)", name);
 					for (j = 0; j < packetSize; j++) {
 						switch (targa_header.pixel_size) {
 						case 24:
@@ -246,8 +233,8 @@ void R_LoadTGA(const char *name, byte **pic, int *width, int *height) {
 							*pixbuf++ = alphabyte;
 							break;
 						default:
-							ri.Error(ERR_DROP, "LoadTGA: illegal pixel_size '%d' in file '%s'", targa_header.pixel_size,
-									 name);
+							R_ImageError("LoadTGA: illegal pixel_size '%d' in file '%s'", targa_header.pixel_size,
+										 name);
 							break;
 						}
 						column++;
@@ -286,7 +273,7 @@ void R_LoadTGA(const char *name, byte **pic, int *width, int *height) {
 #endif
 	// instead we just print a warning
 	if (targa_header.attributes & 0x20) {
-		ri.Printf(PRINT_WARNING, "WARNING: '%s' TGA file header declares top-down image, ignoring\n", name);
+		R_ImagePrintf(PRINT_WARNING, "WARNING: '%s' TGA file header declares top-down image, ignoring\n", name);
 	}
 
 	if (width)
@@ -295,6 +282,31 @@ void R_LoadTGA(const char *name, byte **pic, int *width, int *height) {
 		*height = rows;
 
 	*pic = targa_rgba;
+}
+
+void R_LoadTGA(const char *name, byte **pic, int *width, int *height) {
+	union {
+		byte *b;
+		void *v;
+	} buffer;
+	int length;
+
+	*pic = NULL;
+
+	if (width)
+		*width = 0;
+	if (height)
+		*height = 0;
+
+	//
+	// load the file
+	//
+	length = ri.FS_ReadFile((char *)name, &buffer.v);
+	if (!buffer.b || length < 0) {
+		return;
+	}
+
+	R_DecodeTGA(name, buffer.b, length, pic, width, height);
 
 	ri.FS_FreeFile(buffer.v);
 }
@@ -24,7 +24,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 #include "tr_types.h"
 
-#define REF_API_VERSION 8
+#define REF_API_VERSION 10
 
 //
 // these are the functions exported by the refresh module
@@ -98,6 +98,8 @@ typedef struct {
 	qboolean (*inPVS)(const vec3_t p1, const vec3_t p2);
 
 	void (*TakeVideoFrame)(int h, int w, byte *captureBuffer, byte *encodeBuffer, qboolean motionJpeg);
+	// write out the video frames the renderer is still reading back
+	void (*FinishVideoFrames)(void);
 } refexport_t;
 
 //
@@ -114,6 +116,11 @@ typedef struct {
 	// for anything game related.  Get time from the refdef
 	int (*Milliseconds)(void);
 
+	// zones of the frame profiler, Begin and End have to nest
+	void (*ProfileBegin)(const char *name);
+	void (*ProfileEnd)(void);
+	void (*ProfileCounter)(const char *name, float value);
+
 	// stack based memory allocation for per-level things that
 	// won't be freed
 #ifdef HUNK_DEBUG
@@ -158,6 +165,7 @@ typedef struct {
 	void (*FS_FreeFileList)(char **filelist);
 	void (*FS_WriteFile)(const char *qpath, const void *buffer, int size);
 	qboolean (*FS_FileExists)(const char *file);
+	void (*FS_Prefetch)(const char *dir, char **names, int count);
 
 	// cinematic stuff
 	void (*CIN_UploadCinematic)(int handle);
@@ -179,6 +187,9 @@ typedef struct {
 	void (*Sys_GLimpSafeInit)(void);
 	void (*Sys_GLimpInit)(void);
 	qboolean (*Sys_LowPhysicalMemory)(void);
+
+	// runs func(data, index) for every index in [0, count) on the job threads
+	void (*RunJobs)(void (*func)(void *data, int index), void *data, int count, int numThreads);
 } refimport_t;
 
 // this is the only function actually exported at the linker level
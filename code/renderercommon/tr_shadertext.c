@@ -0,0 +1,406 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+// tr_shadertext.c -- loads and indexes the shader scripts on the job threads
+
+#include "tr_common.h"
+#include "../qcommon/qcommon.h"
+
+/*
+========================================================================
+
+All the renderers join the shader scripts into one text block at startup
+and on vid_restart, and index the shader names in it.  R_LoadShaderText
+reads the scripts on the main thread, then checks, compresses and
+indexes every file on r_shaderThreads job threads.  A job only touches
+its own file and leaves the warning about a bad one to the main thread.
+
+The result is kept in shadertext.cache, keyed by the script names and the
+checksums of the paks they are in, and loaded from there instead as long
+as none of them changed.  Scripts outside of paks are never cached.
+r_shaderCache 0 turns the cache off for working on scripts that override
+the ones in a pak.
+
+========================================================================
+*/
+
+#define SHADERTEXT_CACHE "shadertext.cache"
+#define SHADERTEXT_IDENT (('T' << 24) + ('X' << 16) + ('T' << 8) + 'S')
+#define SHADERTEXT_VERSION 1
+
+#define MAX_SHADER_FILES 4096
+
+// the cache file and the hunk block are laid out the same way
+typedef struct {
+	int ident;
+	int version;
+	unsigned key;
+	int numShaders;
+	int textLength; // including the terminating 0
+} shaderTextHeader_t; // followed by the name offsets, then the text
+
+typedef struct {
+	char name[MAX_QPATH];
+	char *buffer; // from FS_ReadFile, compressed in place
+	int length;	  // after compression, 0 if the file was dropped
+
+	int numShaders;
+	int firstShader;
+	int textOffset;
+
+	// why the file was dropped
+	const char *error;
+	char shaderName[MAX_QPATH];
+	int shaderLine;
+	char found[MAX_QPATH];
+	int foundLine;
+} shaderTextFile_t;
+
+typedef struct {
+	shaderTextFile_t *files;
+	int *shaders;
+	char *text;
+} shaderTextJob_t;
+
+/*
+=================
+R_CheckShaderFileJob
+
+Makes sure that every shader in the file is a name and a balanced braced
+section, so that one bad file cannot break the shaders of all the others.
+The good ones are compressed.
+=================
+*/
+static void R_CheckShaderFileJob(void *data, int index) {
+	shaderTextFile_t *file = (shaderTextFile_t *)data + index;
+	const char *p = file->buffer;
+	comTokenView_t token;
+	int line = 1;
+
+	// the job threads can't use COM_ParseExt's shared token and line counter
+	while (COM_ParseView(&p, qtrue, &line, &token) && token.length) {
+		COM_ViewCopy(&token, file->shaderName, sizeof(file->shaderName));
+		file->shaderLine = token.line;
+
+		if (!COM_ParseView(&p, qtrue, &line, &token) || !COM_ViewEquals(&token, "{")) {
+			file->error = "missing opening brace";
+			if (token.length) {
+				COM_ViewCopy(&token, file->found, sizeof(file->found));
+				file->foundLine = token.line;
+			}
+			return;
+		}
+
+		if (!COM_SkipBracedView(&p, 1, &line)) {
+			file->error = "missing closing brace";
+			return;
+		}
+
+		file->numShaders++;
+	}
+
+	file->length = COM_Compress(file->buffer);
+}
+
+/*
+=================
+R_IndexShaderFileJob
+
+Copies a compressed file to its place in the joined text and records
+where its shader names are.
+=================
+*/
+static void R_IndexShaderFileJob(void *data, int index) {
+	shaderTextJob_t *job = (shaderTextJob_t *)data;
+	shaderTextFile_t *file = &job->files[index];
+	int *shaders = job->shaders + file->firstShader;
+	const char *p = file->buffer;
+	comTokenView_t token;
+	const char *name;
+	int numShaders;
+
+	if (!file->length) {
+		return;
+	}
+
+	Com_Memcpy(job->text + file->textOffset, file->buffer, file->length);
+	job->text[file->textOffset + file->length] = '\n';
+
+	// like FindShaderInShaderText expects, an offset is where the name's
+	// token starts to be parsed, not the name itself
+	for (numShaders = 0; numShaders < file->numShaders; numShaders++) {
+		name = p;
+		if (!COM_ParseView(&p, qtrue, NULL, &token) || !token.length) {
+			break;
+		}
+
+		shaders[numShaders] = file->textOffset + (name - file->buffer);
+		COM_SkipBracedView(&p, 0, NULL);
+	}
+
+	// compression shouldn't change the count, but never index garbage
+	file->numShaders = numShaders;
+}
+
+/*
+=================
+R_ShaderTextKey
+
+Identifies the set of scripts by their names and the checksums of their
+paks.  0 means they can't be cached.
+=================
+*/
+static unsigned R_ShaderTextKey(const shaderTextFile_t *files, int numFiles) {
+	unsigned key = 2166136261u;
+	const char *s;
+	int i, checksum;
+
+	if (!r_shaderCache->integer) {
+		return 0;
+	}
+
+	for (i = 0; i < numFiles; i++) {
+		if (ri.FS_FileIsInPAK(files[i].name, &checksum) != 1) {
+			return 0;
+		}
+
+		for (s = files[i].name; *s; s++) {
+			key = (key ^ (byte)tolower(*s)) * 16777619u;
+		}
+		key = (key ^ (unsigned)checksum) * 16777619u;
+	}
+
+	return key ? key : 1;
+}
+
+/*
+=================
+R_LoadShaderTextCache
+=================
+*/
+static shaderTextHeader_t *R_LoadShaderTextCache(unsigned key) {
+	shaderTextHeader_t *header, *block;
+	const int *shaders;
+	const char *text;
+	int length, i;
+
+	length = ri.FS_ReadFile(SHADERTEXT_CACHE, (void **)&header);
+	if (!header) {
+		return NULL;
+	}
+
+	if (length < (int)sizeof(*header) || header->ident != SHADERTEXT_IDENT ||
+		header->version != SHADERTEXT_VERSION || header->key != key || header->numShaders < 0 ||
+		header->textLength < 1 ||
+		length != (int)sizeof(*header) + header->numShaders * (int)sizeof(int) + header->textLength) {
+		ri.FS_FreeFile(header);
+		return NULL;
+	}
+
+	shaders = (const int *)(header + 1);
+	text = (const char *)(shaders + header->numShaders);
+
+	for (i = 0; i < header->numShaders; i++) {
+		if (shaders[i] < 0 || shaders[i] >= header->textLength) {
+			break;
+		}
+	}
+
+	if (i < header->numShaders || text[header->textLength - 1]) {
+		ri.FS_FreeFile(header);
+		return NULL;
+	}
+
+	block = ri.Hunk_Alloc(length, h_low);
+	Com_Memcpy(block, header, length);
+	ri.FS_FreeFile(header);
+
+	return block;
+}
+
+/*
+=================
+R_BuildShaderText
+=================
+*/
+static shaderTextHeader_t *R_BuildShaderText(shaderTextFile_t *files, int numFiles) {
+	shaderTextHeader_t *header;
+	shaderTextJob_t job;
+	shaderTextFile_t *file;
+	char *names[MAX_SHADER_FILES];
+	int numShaders, textLength;
+	int i, j;
+
+	for (i = 0; i < numFiles; i++) {
+		names[i] = files[i].name;
+	}
+
+	// inflate them all at once before going through them one by one
+	ri.FS_Prefetch(NULL, names, numFiles);
+
+	for (i = 0; i < numFiles; i++) {
+		file = &files[i];
+
+		ri.Printf(PRINT_DEVELOPER, "...loading '%s'\n", file->name);
+		ri.FS_ReadFile(file->name, (void **)&file->buffer);
+
+		if (!file->buffer)
+			ri.Error(ERR_DROP, "Couldn't load %s", file->name);
+	}
+
+	ri.RunJobs(R_CheckShaderFileJob, files, numFiles, MAX(r_shaderThreads->integer, 1));
+
+	// later files come first
+	numShaders = 0;
+	textLength = 0;
+
+	for (i = numFiles - 1; i >= 0; i--) {
+		file = &files[i];
+
+		if (file->error) {
+			ri.Printf(PRINT_WARNING, "WARNING: Ignoring shader file %s. Shader \"%s\" on line %d %s", file->name,
+					  file->shaderName, file->shaderLine, file->error);
+			if (file->found[0]) {
+				ri.Printf(PRINT_WARNING, " (found \"%s\" on line %d)", file->found, file->foundLine);
+			}
+			ri.Printf(PRINT_WARNING, ".\n");
+			continue;
+		}
+
+		file->firstShader = numShaders;
+		file->textOffset = textLength;
+		numShaders += file->numShaders;
+		textLength += file->length + 1;
+	}
+
+	textLength++;
+
+	header = ri.Hunk_Alloc(sizeof(*header) + numShaders * sizeof(int) + textLength, h_low);
+	header->ident = SHADERTEXT_IDENT;
+	header->version = SHADERTEXT_VERSION;
+
+	job.files = files;
+	job.shaders = (int *)(header + 1);
+	job.text = (char *)(job.shaders + numShaders);
+
+	ri.RunJobs(R_IndexShaderFileJob, &job, numFiles, MAX(r_shaderThreads->integer, 1));
+
+	job.text[textLength - 1] = '\0';
+
+	// close the gaps left by files that indexed fewer shaders than checked
+	header->numShaders = 0;
+	for (i = numFiles - 1; i >= 0; i--) {
+		file = &files[i];
+
+		for (j = 0; j < file->numShaders && file->length; j++) {
+			job.shaders[header->numShaders++] = job.shaders[file->firstShader + j];
+		}
+	}
+
+	// the text moves up against the offsets so the block can be written as is
+	if (header->numShaders < numShaders) {
+		memmove(job.shaders + header->numShaders, job.text, textLength);
+	}
+	header->textLength = textLength;
+
+	// temp memory goes back in the reverse order
+	for (i = numFiles - 1; i >= 0; i--) {
+		ri.FS_FreeFile(files[i].buffer);
+	}
+
+	return header;
+}
+
+/*
+=================
+R_LoadShaderText
+
+Finds the .shader scripts, or the .mtr next to one if materials is set,
+and returns their joined text with the offsets of the shader names in it.
+Both live on the hunk.
+=================
+*/
+qboolean R_LoadShaderText(shaderText_t *shaderText, qboolean materials) {
+	shaderTextFile_t *files;
+	shaderTextHeader_t *header;
+	char **shaderFiles;
+	char *ext;
+	unsigned key;
+	int numFiles;
+	int i;
+
+	Com_Memset(shaderText, 0, sizeof(*shaderText));
+
+	shaderFiles = ri.FS_ListFiles("scripts", ".shader", &numFiles);
+
+	if (!shaderFiles || !numFiles) {
+		ri.Printf(PRINT_WARNING, "WARNING: no shader files found\n");
+		return qfalse;
+	}
+
+	if (numFiles > MAX_SHADER_FILES) {
+		numFiles = MAX_SHADER_FILES;
+	}
+
+	files = ri.Hunk_AllocateTempMemory(numFiles * sizeof(*files));
+	Com_Memset(files, 0, numFiles * sizeof(*files));
+
+	for (i = 0; i < numFiles; i++) {
+		// look for a .mtr file first
+		if (materials) {
+			Com_sprintf(files[i].name, sizeof(files[i].name), "scripts/%s", shaderFiles[i]);
+			if ((ext = strrchr(files[i].name, '.'))) {
+				Q_strncpyz(ext, ".mtr", sizeof(files[i].name) - (ext - files[i].name));
+			}
+
+			if (ri.FS_ReadFile(files[i].name, NULL) > 0) {
+				continue;
+			}
+		}
+
+		Com_sprintf(files[i].name, sizeof(files[i].name), "scripts/%s", shaderFiles[i]);
+	}
+
+	ri.FS_FreeFileList(shaderFiles);
+
+	key = R_ShaderTextKey(files, numFiles);
+	header = key ? R_LoadShaderTextCache(key) : NULL;
+
+	if (header) {
+		ri.Printf(PRINT_DEVELOPER, "...%d shaders from %s\n", header->numShaders, SHADERTEXT_CACHE);
+	} else {
+		header = R_BuildShaderText(files, numFiles);
+		header->key = key;
+
+		if (key) {
+			ri.FS_WriteFile(SHADERTEXT_CACHE, header,
+							sizeof(*header) + header->numShaders * sizeof(int) + header->textLength);
+		}
+	}
+
+	ri.Hunk_FreeTempMemory(files);
+
+	shaderText->shaders = (const int *)(header + 1);
+	shaderText->numShaders = header->numShaders;
+	shaderText->text = (char *)(shaderText->shaders + header->numShaders);
+
+	return qtrue;
+}
@@ -71,6 +71,14 @@ typedef struct {
 	byte modulate[4];
 } polyVert_t;
 
+// for drawing runs of quads with one shader, like the characters of a string
+#define MAX_STRETCHPICS 1024
+
+typedef struct {
+	float x, y, w, h;
+	float s1, t1, s2, t2;
+} stretchPic_t;
+
 typedef struct poly_s {
 	qhandle_t hShader;
 	int numVerts;
@@ -212,7 +220,7 @@ typedef struct {
 	// used CDS.
 	qboolean isFullscreen;
 	qboolean stereoEnabled;
-	qboolean smpActive; // UNUSED, present for compatibility
+	qboolean smpActive; // renderergl2 draws on a render thread (r_smp)
 } glconfig_t;
 
 typedef byte color4ub_t[4];
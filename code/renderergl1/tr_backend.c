@@ -1020,6 +1020,7 @@ void RB_ExecuteRenderCommands(const void *data) {
 	int t1, t2;
 
 	t1 = ri.Milliseconds();
+	ri.ProfileBegin("RB_ExecuteRenderCommands");
 
 	while (1) {
 		data = PADP(data, sizeof(void *));
@@ -1057,6 +1058,7 @@ void RB_ExecuteRenderCommands(const void *data) {
 			// stop rendering
 			t2 = ri.Milliseconds();
 			backEnd.pc.msec = t2 - t1;
+			ri.ProfileEnd();
 			return;
 		}
 	}
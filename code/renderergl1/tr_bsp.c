@@ -123,20 +123,82 @@ static void R_ColorShiftLightingBytes(const byte in[4], byte out[4]) {
 	out[3] = in[3];
 }
 
+#define LIGHTMAP_SIZE 128
+
+// expand the 24 bit on-disk lightmap to 32 bit
+static void R_ExpandLightmap(const byte *buf_p, byte *image, float *maxIntensity) {
+	int j;
+
+	if (r_lightmap->integer == 2) { // color code by intensity as development tool	(FIXME: check range)
+		for (j = 0; j < LIGHTMAP_SIZE * LIGHTMAP_SIZE; j++) {
+			float r = buf_p[j * 3 + 0];
+			float g = buf_p[j * 3 + 1];
+			float b = buf_p[j * 3 + 2];
+			float intensity;
+			float out[3] = {0.0, 0.0, 0.0};
+
+			intensity = 0.33f * r + 0.685f * g + 0.063f * b;
+
+			if (intensity > 255)
+				intensity = 1.0f;
+			else
+				intensity /= 255.0f;
+
+			if (intensity > *maxIntensity)
+				*maxIntensity = intensity;
+
+			HSVtoRGB(intensity, 1.00, 0.50, out);
+
+			image[j * 4 + 0] = out[0] * 255;
+			image[j * 4 + 1] = out[1] * 255;
+			image[j * 4 + 2] = out[2] * 255;
+			image[j * 4 + 3] = 255;
+		}
+	} else {
+		for (j = 0; j < LIGHTMAP_SIZE * LIGHTMAP_SIZE; j++) {
+			R_ColorShiftLightingBytes(&buf_p[j * 3], &image[j * 4]);
+			image[j * 4 + 3] = 255;
+		}
+	}
+}
+
+/*
+===============
+R_SetLightmapAtlasSize
+
+Picks the smallest power of two grid of lightmaps, wider first, that holds
+all of them or is as large as a texture can get. Lightmaps past the first
+atlas go on more atlases of the same size.
+===============
+*/
+static void R_SetLightmapAtlasSize(int numLightmaps, int maxSize) {
+	int maxLightmapsPerAxis = maxSize / LIGHTMAP_SIZE;
+	int cols = 1, rows = 1;
+
+	while (cols * rows < numLightmaps && cols * 2 <= maxLightmapsPerAxis)
+		cols <<= 1;
+
+	while (cols * rows < numLightmaps && rows * 2 <= maxLightmapsPerAxis)
+		rows <<= 1;
+
+	tr.fatLightmapCols = cols;
+	tr.fatLightmapRows = rows;
+}
+
 /*
 ===============
 R_LoadLightmaps
 
 ===============
 */
-#define LIGHTMAP_SIZE 128
 static void R_LoadLightmaps(lump_t *l) {
-	byte *buf, *buf_p;
+	byte *buf;
 	int len;
 	byte image[LIGHTMAP_SIZE * LIGHTMAP_SIZE * 4];
-	int i, j;
+	int i, j, k, numLightmaps;
 	float maxIntensity = 0;
-	double sumIntensity = 0;
+
+	tr.fatLightmapCols = tr.fatLightmapRows = 0;
 
 	len = l->filelen;
 	if (!len) {
@@ -148,7 +210,8 @@ static void R_LoadLightmaps(lump_t *l) {
 	R_IssuePendingRenderCommands();
 
 	// create all the lightmaps
-	tr.numLightmaps = len / (LIGHTMAP_SIZE * LIGHTMAP_SIZE * 3);
+	numLightmaps = len / (LIGHTMAP_SIZE * LIGHTMAP_SIZE * 3);
+	tr.numLightmaps = numLightmaps;
 	if (tr.numLightmaps == 1) {
 		// FIXME: HACK: maps with only one lightmap turn up fullbright for some reason.
 		// this avoids this, but isn't the correct solution.
@@ -160,46 +223,52 @@ static void R_LoadLightmaps(lump_t *l) {
 		return;
 	}
 
+	// pack them into atlases, so that surfaces with different lightmaps can share a shader
+	if (r_mergeLightmaps->integer && numLightmaps > 1) {
+		R_SetLightmapAtlasSize(numLightmaps, glConfig.maxTextureSize);
+		if (tr.fatLightmapCols * tr.fatLightmapRows > 1) {
+			int perAtlas = tr.fatLightmapCols * tr.fatLightmapRows;
+
+			tr.numLightmaps = (numLightmaps + perAtlas - 1) / perAtlas;
+		} else {
+			tr.fatLightmapCols = tr.fatLightmapRows = 0;
+		}
+	}
+
 	tr.lightmaps = ri.Hunk_Alloc(tr.numLightmaps * sizeof(image_t *), h_low);
-	for (i = 0; i < tr.numLightmaps; i++) {
-		// expand the 24 bit on-disk to 32 bit
-		buf_p = buf + i * LIGHTMAP_SIZE * LIGHTMAP_SIZE * 3;
-
-		if (r_lightmap->integer == 2) { // color code by intensity as development tool	(FIXME: check range)
-			for (j = 0; j < LIGHTMAP_SIZE * LIGHTMAP_SIZE; j++) {
-				float r = buf_p[j * 3 + 0];
-				float g = buf_p[j * 3 + 1];
-				float b = buf_p[j * 3 + 2];
-				float intensity;
-				float out[3] = {0.0, 0.0, 0.0};
-
-				intensity = 0.33f * r + 0.685f * g + 0.063f * b;
-
-				if (intensity > 255)
-					intensity = 1.0f;
-				else
-					intensity /= 255.0f;
 
-				if (intensity > maxIntensity)
-					maxIntensity = intensity;
+	if (tr.fatLightmapCols) {
+		int perAtlas = tr.fatLightmapCols * tr.fatLightmapRows;
+		int width = tr.fatLightmapCols * LIGHTMAP_SIZE;
+		int height = tr.fatLightmapRows * LIGHTMAP_SIZE;
+		byte *atlas = ri.Hunk_AllocateTempMemory(width * height * 4);
 
-				HSVtoRGB(intensity, 1.00, 0.50, out);
+		for (i = 0; i < tr.numLightmaps; i++) {
+			Com_Memset(atlas, 0, width * height * 4);
 
-				image[j * 4 + 0] = out[0] * 255;
-				image[j * 4 + 1] = out[1] * 255;
-				image[j * 4 + 2] = out[2] * 255;
-				image[j * 4 + 3] = 255;
+			for (j = i * perAtlas; j < numLightmaps && j < (i + 1) * perAtlas; j++) {
+				int x = (j % perAtlas) % tr.fatLightmapCols * LIGHTMAP_SIZE;
+				int y = (j % perAtlas) / tr.fatLightmapCols * LIGHTMAP_SIZE;
 
-				sumIntensity += intensity;
-			}
-		} else {
-			for (j = 0; j < LIGHTMAP_SIZE * LIGHTMAP_SIZE; j++) {
-				R_ColorShiftLightingBytes(&buf_p[j * 3], &image[j * 4]);
-				image[j * 4 + 3] = 255;
+				R_ExpandLightmap(buf + j * LIGHTMAP_SIZE * LIGHTMAP_SIZE * 3, image, &maxIntensity);
+
+				for (k = 0; k < LIGHTMAP_SIZE; k++) {
+					Com_Memcpy(atlas + ((y + k) * width + x) * 4, image + k * LIGHTMAP_SIZE * 4,
+							   LIGHTMAP_SIZE * 4);
+				}
 			}
+
+			tr.lightmaps[i] = R_CreateImage(va("*lightmap%d", i), atlas, width, height, IMGTYPE_COLORALPHA,
+											IMGFLAG_NOLIGHTSCALE | IMGFLAG_NO_COMPRESSION | IMGFLAG_CLAMPTOEDGE, 0);
+		}
+
+		ri.Hunk_FreeTempMemory(atlas);
+	} else {
+		for (i = 0; i < tr.numLightmaps; i++) {
+			R_ExpandLightmap(buf + i * LIGHTMAP_SIZE * LIGHTMAP_SIZE * 3, image, &maxIntensity);
+			tr.lightmaps[i] = R_CreateImage(va("*lightmap%d", i), image, LIGHTMAP_SIZE, LIGHTMAP_SIZE, IMGTYPE_COLORALPHA,
+											IMGFLAG_NOLIGHTSCALE | IMGFLAG_NO_COMPRESSION | IMGFLAG_CLAMPTOEDGE, 0);
 		}
-		tr.lightmaps[i] = R_CreateImage(va("*lightmap%d", i), image, LIGHTMAP_SIZE, LIGHTMAP_SIZE, IMGTYPE_COLORALPHA,
-										IMGFLAG_NOLIGHTSCALE | IMGFLAG_NO_COMPRESSION | IMGFLAG_CLAMPTOEDGE, 0);
 	}
 
 	if (r_lightmap->integer == 2) {
@@ -207,6 +276,30 @@ static void R_LoadLightmaps(lump_t *l) {
 	}
 }
 
+// lightmap texture coordinates and numbers in the atlases, see R_SetLightmapAtlasSize
+static float FatPackU(float input, int lightmapnum) {
+	if (lightmapnum < 0 || !tr.fatLightmapCols)
+		return input;
+
+	lightmapnum %= (tr.fatLightmapCols * tr.fatLightmapRows);
+	return (input + (lightmapnum % tr.fatLightmapCols)) / (float)(tr.fatLightmapCols);
+}
+
+static float FatPackV(float input, int lightmapnum) {
+	if (lightmapnum < 0 || !tr.fatLightmapCols)
+		return input;
+
+	lightmapnum %= (tr.fatLightmapCols * tr.fatLightmapRows);
+	return (input + (lightmapnum / tr.fatLightmapCols)) / (float)(tr.fatLightmapRows);
+}
+
+static int FatLightmap(int lightmapnum) {
+	if (lightmapnum < 0 || !tr.fatLightmapCols)
+		return lightmapnum;
+
+	return lightmapnum / (tr.fatLightmapCols * tr.fatLightmapRows);
+}
+
 /*
 =================
 RE_SetWorldVisData
@@ -307,7 +400,7 @@ static void ParseFace(const dsurface_t *ds, const drawVert_t *verts, msurface_t
 	surf->fogIndex = LittleLong(ds->fogNum) + 1;
 
 	// get shader value
-	surf->shader = ShaderForShaderNum(ds->shaderNum, lightmapNum);
+	surf->shader = ShaderForShaderNum(ds->shaderNum, FatLightmap(lightmapNum));
 	if (r_singleShader->integer && !surf->shader->isSky) {
 		surf->shader = tr.defaultShader;
 	}
@@ -339,8 +432,9 @@ static void ParseFace(const dsurface_t *ds, const drawVert_t *verts, msurface_t
 		}
 		for (j = 0; j < 2; j++) {
 			cv->points[i][3 + j] = LittleFloat(verts[i].st[j]);
-			cv->points[i][5 + j] = LittleFloat(verts[i].lightmap[j]);
 		}
+		cv->points[i][5] = FatPackU(LittleFloat(verts[i].lightmap[0]), lightmapNum);
+		cv->points[i][6] = FatPackV(LittleFloat(verts[i].lightmap[1]), lightmapNum);
 		R_ColorShiftLightingBytes(verts[i].color, (byte *)&cv->points[i][7]);
 	}
 
@@ -381,7 +475,7 @@ static void ParseMesh(const dsurface_t *ds, const drawVert_t *verts, msurface_t
 	surf->fogIndex = LittleLong(ds->fogNum) + 1;
 
 	// get shader value
-	surf->shader = ShaderForShaderNum(ds->shaderNum, lightmapNum);
+	surf->shader = ShaderForShaderNum(ds->shaderNum, FatLightmap(lightmapNum));
 	if (r_singleShader->integer && !surf->shader->isSky) {
 		surf->shader = tr.defaultShader;
 	}
@@ -405,8 +499,9 @@ static void ParseMesh(const dsurface_t *ds, const drawVert_t *verts, msurface_t
 		}
 		for (j = 0; j < 2; j++) {
 			points[i].st[j] = LittleFloat(verts[i].st[j]);
-			points[i].lightmap[j] = LittleFloat(verts[i].lightmap[j]);
 		}
+		points[i].lightmap[0] = FatPackU(LittleFloat(verts[i].lightmap[0]), lightmapNum);
+		points[i].lightmap[1] = FatPackV(LittleFloat(verts[i].lightmap[1]), lightmapNum);
 		R_ColorShiftLightingBytes(verts[i].color, points[i].color);
 	}
 
@@ -1511,6 +1606,12 @@ static void R_LoadShaders(const lump_t *l) {
 		out[i].surfaceFlags = LittleLong(out[i].surfaceFlags);
 		out[i].contentFlags = LittleLong(out[i].contentFlags);
 	}
+
+	// decode their images on the job threads while the surfaces load the shaders
+	for (i = 0; i < count; i++) {
+		R_QueueShaderImages(out[i].shader);
+	}
+	R_PrefetchImages();
 }
 
 /*
@@ -1911,5 +2012,7 @@ void RE_LoadWorldMap(const char *name) {
 	// only set tr.world now that we know the entire level has loaded properly
 	tr.world = &s_worldData;
 
+	R_BuildWorldVbo();
+
 	ri.FS_FreeFile(buffer.v);
 }
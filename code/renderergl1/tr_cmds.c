@@ -470,3 +470,12 @@ void RE_TakeVideoFrame(int width, int height, byte *captureBuffer, byte *encodeB
 	cmd->encodeBuffer = encodeBuffer;
 	cmd->motionJpeg = motionJpeg;
 }
+
+/*
+=============
+RE_FinishVideoFrames
+
+Video frames are read back synchronously, nothing to flush
+=============
+*/
+void RE_FinishVideoFrames(void) {}
@@ -853,6 +853,10 @@ void R_LoadImage(const char *name, byte **pic, int *width, int *height) {
 	*width = 0;
 	*height = 0;
 
+	// decoded on a job thread when the level's shaders were loaded
+	if (R_TakePrefetchedImage(name, pic, width, height))
+		return;
+
 	Q_strncpyz(localName, name, MAX_QPATH);
 
 	ext = COM_GetExtension(localName);
@@ -903,6 +907,171 @@ void R_LoadImage(const char *name, byte **pic, int *width, int *height) {
 	}
 }
 
+/*
+============================================================================
+
+IMAGE CACHE
+
+The textures of the images loaded from files are kept when the renderer
+is shut down for a map change, so the weapons, player models and HUD most
+levels share are not decoded and uploaded again.  R_FindImageFile takes
+them back, whatever the next level did not ask for is deleted once it is
+registered.  Lightmaps and the builtin images are always recreated.
+
+============================================================================
+*/
+
+// everything that went into the texels of an upload
+typedef struct {
+	int picmip;
+	int roundImagesDown;
+	int simpleMipMaps;
+	int texturebits;
+	int colorMipLevels;
+	int textureCompression;
+	float greyscale;
+	byte intensitytable[256];
+	byte gammatable[256];
+} imageUploadParms_t;
+
+static image_t *cacheHashTable[FILE_HASH_SIZE];
+static int numCachedImages;
+static imageUploadParms_t cachedImageParms;
+
+/*
+===============
+R_GetImageUploadParms
+===============
+*/
+static void R_GetImageUploadParms(imageUploadParms_t *parms) {
+	Com_Memset(parms, 0, sizeof(*parms));
+	parms->picmip = r_picmip->integer;
+	parms->roundImagesDown = r_roundImagesDown->integer;
+	parms->simpleMipMaps = r_simpleMipMaps->integer;
+	parms->texturebits = r_texturebits->integer;
+	parms->colorMipLevels = r_colorMipLevels->integer;
+	parms->textureCompression = glConfig.textureCompression;
+	parms->greyscale = r_greyscale->value;
+	Com_Memcpy(parms->intensitytable, s_intensitytable, sizeof(parms->intensitytable));
+	Com_Memcpy(parms->gammatable, s_gammatable, sizeof(parms->gammatable));
+}
+
+/*
+===============
+R_ReleaseCachedImages
+
+Deletes the textures nobody took back from the cache
+===============
+*/
+void R_ReleaseCachedImages(void) {
+	image_t *image, *next;
+	int i;
+
+	if (!numCachedImages) {
+		return;
+	}
+
+	for (i = 0; i < FILE_HASH_SIZE; i++) {
+		for (image = cacheHashTable[i]; image; image = next) {
+			next = image->next;
+			qglDeleteTextures(1, &image->texnum);
+			ri.Free(image);
+		}
+	}
+	Com_Memset(cacheHashTable, 0, sizeof(cacheHashTable));
+
+	ri.Printf(PRINT_DEVELOPER, "released %i cached images\n", numCachedImages);
+	numCachedImages = 0;
+}
+
+/*
+===============
+R_CacheImage
+
+Keeps the texture of an image for the next level, returns qfalse if it
+has to be deleted instead
+===============
+*/
+static qboolean R_CacheImage(const image_t *image) {
+	image_t *cached;
+	long hash;
+
+	if (!r_imageCache->integer || image->imgName[0] == '*' || image->TMU != 0) {
+		return qfalse;
+	}
+
+	cached = ri.Malloc(sizeof(*cached));
+	Com_Memcpy(cached, image, sizeof(*cached));
+
+	hash = generateHashValue(cached->imgName);
+	cached->next = cacheHashTable[hash];
+	cacheHashTable[hash] = cached;
+	numCachedImages++;
+
+	return qtrue;
+}
+
+/*
+===============
+R_TakeCachedImage
+
+Moves an image kept from the previous level back into tr.images
+===============
+*/
+static image_t *R_TakeCachedImage(const char *name, imgType_t type, imgFlags_t flags) {
+	image_t *cached, **prev;
+	image_t *image;
+	long hash;
+
+	if (!numCachedImages) {
+		return NULL;
+	}
+
+	hash = generateHashValue(name);
+	for (prev = &cacheHashTable[hash]; *prev; prev = &(*prev)->next) {
+		if (!strcmp(name, (*prev)->imgName) && (*prev)->type == type && (*prev)->flags == flags) {
+			break;
+		}
+	}
+	cached = *prev;
+	if (!cached) {
+		return NULL;
+	}
+
+	if (tr.numImages == MAX_DRAWIMAGES) {
+		ri.Error(ERR_DROP, "R_TakeCachedImage: MAX_DRAWIMAGES hit");
+	}
+
+	*prev = cached->next;
+	numCachedImages--;
+
+	image = tr.images[tr.numImages] = ri.Hunk_Alloc(sizeof(image_t), h_low);
+	tr.numImages++;
+	Com_Memcpy(image, cached, sizeof(*image));
+	ri.Free(cached);
+
+	image->frameUsed = 0;
+
+	// r_textureMode and r_ext_max_anisotropy may have changed meanwhile
+	if (image->flags & IMGFLAG_MIPMAP) {
+		GL_Bind(image);
+		if (textureFilterAnisotropic)
+			qglTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY_EXT,
+							 (GLint)Com_Clamp(1, maxAnisotropy, r_ext_max_anisotropy->integer));
+
+		qglTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, gl_filter_min);
+		qglTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, gl_filter_max);
+
+		glState.currenttextures[glState.currenttmu] = 0;
+		qglBindTexture(GL_TEXTURE_2D, 0);
+	}
+
+	image->next = hashTable[hash];
+	hashTable[hash] = image;
+
+	return image;
+}
+
 /*
 ===============
 R_FindImageFile
@@ -939,6 +1108,12 @@ image_t *R_FindImageFile(const char *name, imgType_t type, imgFlags_t flags) {
 		}
 	}
 
+	// kept from the previous level
+	image = R_TakeCachedImage(name, type, flags);
+	if (image) {
+		return image;
+	}
+
 	//
 	// load the pic from disk
 	//
@@ -1216,10 +1391,18 @@ R_InitImages
 ===============
 */
 void R_InitImages(void) {
+	imageUploadParms_t parms;
+
 	Com_Memset(hashTable, 0, sizeof(hashTable));
 	// build brightness translation tables
 	R_SetColorMappings();
 
+	// a latched image cvar changed since the cached textures were uploaded
+	R_GetImageUploadParms(&parms);
+	if (memcmp(&parms, &cachedImageParms, sizeof(parms))) {
+		R_ReleaseCachedImages();
+	}
+
 	// create default texture and white texture
 	R_CreateBuiltinImages();
 }
@@ -1227,12 +1410,24 @@ void R_InitImages(void) {
 /*
 ===============
 R_DeleteTextures
+
+With keepImages the textures of the images loaded from files go to the
+image cache instead
 ===============
 */
-void R_DeleteTextures(void) {
+void R_DeleteTextures(qboolean keepImages) {
 	int i;
 
+	if (keepImages) {
+		// whatever the last level did not take back goes first
+		R_ReleaseCachedImages();
+		R_GetImageUploadParms(&cachedImageParms);
+	}
+
 	for (i = 0; i < tr.numImages; i++) {
+		if (keepImages && R_CacheImage(tr.images[i])) {
+			continue;
+		}
 		qglDeleteTextures(1, &tr.images[i]->texnum);
 	}
 	Com_Memset(tr.images, 0, sizeof(tr.images));
@@ -65,6 +65,8 @@ cvar_t *r_anaglyphMode;
 
 cvar_t *r_greyscale;
 
+cvar_t *r_vbo;
+
 cvar_t *r_ignorehwgamma;
 cvar_t *r_measureOverdraw;
 
@@ -110,6 +112,7 @@ cvar_t *r_ext_multisample;
 cvar_t *r_drawBuffer;
 cvar_t *r_lightmap;
 cvar_t *r_vertexLight;
+cvar_t *r_mergeLightmaps;
 cvar_t *r_uiFullScreen;
 cvar_t *r_shadows;
 cvar_t *r_flares;
@@ -119,6 +122,10 @@ cvar_t *r_singleShader;
 cvar_t *r_roundImagesDown;
 cvar_t *r_colorMipLevels;
 cvar_t *r_picmip;
+cvar_t *r_imageThreads;
+cvar_t *r_imageCache;
+cvar_t *r_shaderThreads;
+cvar_t *r_shaderCache;
 cvar_t *r_showtris;
 cvar_t *r_showsky;
 cvar_t *r_shownormals;
@@ -988,12 +995,14 @@ void R_Register(void) {
 	r_customPixelAspect = ri.Cvar_Get("r_customPixelAspect", "1", CVAR_ARCHIVE | CVAR_LATCH);
 	r_simpleMipMaps = ri.Cvar_Get("r_simpleMipMaps", "1", CVAR_ARCHIVE | CVAR_LATCH);
 	r_vertexLight = ri.Cvar_Get("r_vertexLight", "0", CVAR_ARCHIVE | CVAR_LATCH);
+	r_mergeLightmaps = ri.Cvar_Get("r_mergeLightmaps", "1", CVAR_ARCHIVE | CVAR_LATCH);
 	r_uiFullScreen = ri.Cvar_Get("r_uifullscreen", "0", 0);
 	r_subdivisions = ri.Cvar_Get("r_subdivisions", "4", CVAR_ARCHIVE | CVAR_LATCH);
 	r_stereoEnabled = ri.Cvar_Get("r_stereoEnabled", "0", CVAR_ARCHIVE | CVAR_LATCH);
 	r_ignoreFastPath = ri.Cvar_Get("r_ignoreFastPath", "1", CVAR_ARCHIVE | CVAR_LATCH);
 	r_greyscale = ri.Cvar_Get("r_greyscale", "0", CVAR_ARCHIVE | CVAR_LATCH);
 	ri.Cvar_CheckRange(r_greyscale, 0, 1, qfalse);
+	r_vbo = ri.Cvar_Get("r_vbo", "1", CVAR_ARCHIVE | CVAR_LATCH);
 
 	//
 	// temporary latched variables that can only change over a restart
@@ -1022,6 +1031,12 @@ void R_Register(void) {
 	r_dynamiclight = ri.Cvar_Get("r_dynamiclight", "1", CVAR_ARCHIVE);
 	r_dlightBacks = ri.Cvar_Get("r_dlightBacks", "1", CVAR_ARCHIVE);
 	r_finish = ri.Cvar_Get("r_finish", "0", CVAR_ARCHIVE);
+	r_imageThreads = ri.Cvar_Get("r_imageThreads", "4", CVAR_ARCHIVE);
+	ri.Cvar_CheckRange(r_imageThreads, 0, MAX_JOB_THREADS, qtrue);
+	r_imageCache = ri.Cvar_Get("r_imageCache", "1", CVAR_ARCHIVE);
+	r_shaderThreads = ri.Cvar_Get("r_shaderThreads", "4", CVAR_ARCHIVE);
+	ri.Cvar_CheckRange(r_shaderThreads, 0, MAX_JOB_THREADS, qtrue);
+	r_shaderCache = ri.Cvar_Get("r_shaderCache", "1", CVAR_ARCHIVE);
 	r_textureMode = ri.Cvar_Get("r_textureMode", "GL_LINEAR_MIPMAP_LINEAR", CVAR_ARCHIVE);
 	r_swapInterval = ri.Cvar_Get("r_swapInterval", "0", CVAR_ARCHIVE | CVAR_LATCH);
 	r_gamma = ri.Cvar_Get("r_gamma", "1", CVAR_ARCHIVE);
@@ -1215,9 +1230,17 @@ void RE_Shutdown(qboolean destroyWindow) {
 
 	if (tr.registered) {
 		R_IssuePendingRenderCommands();
-		R_DeleteTextures();
+		R_ShutdownWorldVbo();
+		R_DeleteTextures(!destroyWindow);
+	}
+
+	// the context goes away with the window
+	if (destroyWindow) {
+		R_ReleaseCachedImages();
 	}
 
+	R_ClearVisLists();
+	R_FlushPrefetchedImages();
 	R_DoneFreeType();
 
 	// shut down platform specific OpenGL stuff
@@ -1244,6 +1267,8 @@ Touch all images to make sure they are resident
 =============
 */
 void RE_EndRegistration(void) {
+	R_FlushPrefetchedImages();
+	R_ReleaseCachedImages();
 	R_IssuePendingRenderCommands();
 	if (!ri.Sys_LowPhysicalMemory()) {
 		RB_ShowImages();
@@ -1312,6 +1337,7 @@ refexport_t *GetRefAPI(int apiVersion, refimport_t *rimp) {
 	re.inPVS = R_inPVS;
 
 	re.TakeVideoFrame = RE_TakeVideoFrame;
+	re.FinishVideoFrames = RE_FinishVideoFrames;
 
 	return &re;
 }
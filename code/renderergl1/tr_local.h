@@ -36,12 +36,16 @@ QGL_1_1_PROCS
 QGL_1_1_FIXED_FUNCTION_PROCS
 QGL_DESKTOP_1_1_PROCS
 QGL_DESKTOP_1_1_FIXED_FUNCTION_PROCS
+QGL_1_5_PROCS
+QGL_2_0_STENCIL_PROCS
 QGL_3_0_PROCS
 #undef GLE
 
 #define GL_INDEX_TYPE GL_UNSIGNED_INT
 typedef unsigned int glIndex_t;
 
+#define BUFFER_OFFSET(i) ((char *)NULL + (i))
+
 // 14 bits
 // can't be increased without changing bit packing for drawsurfs
 // see QSORT_SHADERNUM_SHIFT
@@ -323,6 +327,7 @@ typedef struct shader_s {
 
 	qboolean isSky;
 	skyParms_t sky;
+	qboolean staticVbo; // every stage can be drawn from the world VBO
 	fogParms_t fogParms;
 
 	float portalRange; // distance to fog out at
@@ -503,6 +508,8 @@ typedef struct srfGridMesh_s {
 	// dynamic lighting information
 	int dlightBits;
 
+	int vboFirstVertex; // -1 if not in the world VBO
+
 	// culling information
 	vec3_t meshBounds[2];
 	vec3_t localOrigin;
@@ -531,6 +538,8 @@ typedef struct {
 	// dynamic lighting information
 	int dlightBits;
 
+	int vboFirstVertex; // -1 if not in the world VBO
+
 	// triangle definitions (no normals at points)
 	int numPoints;
 	int numIndices;
@@ -546,6 +555,8 @@ typedef struct {
 	// dynamic lighting information
 	int dlightBits;
 
+	int vboFirstVertex; // -1 if not in the world VBO
+
 	// culling information (FIXME: use this!)
 	vec3_t bounds[2];
 	vec3_t localOrigin;
@@ -873,8 +884,12 @@ typedef struct {
 	shader_t *sunShader;
 
 	int numLightmaps;
+	int fatLightmapCols; // lightmaps per atlas row and column, 0 if not merged
+	int fatLightmapRows;
 	image_t **lightmaps;
 
+	GLuint worldVbo; // static world surfaces, see R_BuildWorldVbo
+
 	trRefEntity_t *currentEntity;
 	trRefEntity_t worldEntity; // point currentEntity at this when rendering world
 	int currentEntityNum;
@@ -997,6 +1012,8 @@ extern cvar_t *r_lightmap;	   // render lightmaps only
 extern cvar_t *r_vertexLight;  // vertex lighting mode for better performance
 extern cvar_t *r_uiFullScreen; // ui is running fullscreen
 
+extern cvar_t *r_mergeLightmaps; // pack the map lightmaps into atlases
+
 extern cvar_t *r_logFile;	  // number of frames to emit GL logs
 extern cvar_t *r_showtris;	  // enables wireframe rendering of the world
 extern cvar_t *r_showsky;	  // forces sky in front of all surfaces
@@ -1014,6 +1031,7 @@ extern cvar_t *r_portalOnly;
 
 extern cvar_t *r_subdivisions;
 extern cvar_t *r_lodCurveError;
+extern cvar_t *r_vbo; // static world surfaces in a vertex buffer
 extern cvar_t *r_skipBackEnd;
 
 extern cvar_t *r_anaglyphMode;
@@ -1027,6 +1045,7 @@ extern cvar_t *r_mapOverBrightBits;
 
 extern cvar_t *r_debugSurface;
 extern cvar_t *r_simpleMipMaps;
+extern cvar_t *r_imageCache; // keep the textures of the images across map changes
 
 extern cvar_t *r_showImages;
 extern cvar_t *r_debugSort;
@@ -1141,7 +1160,8 @@ void R_ScreenShot_f(void);
 void R_InitFogTable(void);
 float R_FogFactor(float s, float t);
 void R_InitImages(void);
-void R_DeleteTextures(void);
+void R_DeleteTextures(qboolean keepImages);
+void R_ReleaseCachedImages(void);
 int R_SumOfUsedImages(void);
 void R_InitSkins(void);
 skin_t *R_GetSkinByHandle(qhandle_t hSkin);
@@ -1154,6 +1174,7 @@ const void *RB_TakeVideoFrameCmd(const void *data);
 // tr_shader.c
 //
 shader_t *R_FindShader(const char *name, int lightmapIndex, qboolean mipRawImage);
+void R_QueueShaderImages(const char *name);
 shader_t *R_GetShaderByHandle(qhandle_t hShader);
 shader_t *R_GetShaderByState(int index, long *cycleTime);
 shader_t *R_FindShaderByName(const char *name);
@@ -1176,6 +1197,7 @@ typedef struct stageVars {
 
 typedef struct shaderCommands_s {
 	glIndex_t indexes[SHADER_MAX_INDEXES] QALIGN(16);
+	glIndex_t vboIndexes[SHADER_MAX_INDEXES] QALIGN(16); // into tr.worldVbo
 	vec4_t xyz[SHADER_MAX_VERTEXES] QALIGN(16);
 	vec4_t normal[SHADER_MAX_VERTEXES] QALIGN(16);
 	vec2_t texCoords[SHADER_MAX_VERTEXES][2] QALIGN(16);
@@ -1194,6 +1216,8 @@ typedef struct shaderCommands_s {
 
 	int numIndexes;
 	int numVertexes;
+	int numVboIndexes;
+	qboolean useVbo; // surfaces in the world VBO only add vboIndexes
 
 	// info extracted from current shader
 	int numPasses;
@@ -1215,6 +1239,7 @@ void RB_StageIteratorGeneric(void);
 void RB_StageIteratorSky(void);
 void RB_StageIteratorVertexLitTexture(void);
 void RB_StageIteratorLightmappedMultitexture(void);
+void RB_StageIteratorWorldVbo(void);
 
 void RB_AddQuadStamp(vec3_t origin, vec3_t left, vec3_t up, byte *color);
 void RB_AddQuadStampExt(vec3_t origin, vec3_t left, vec3_t up, byte *color, float s1, float t1, float s2, float t2);
@@ -1232,6 +1257,36 @@ WORLD MAP
 void R_AddBrushModelSurfaces(trRefEntity_t *e);
 void R_AddWorldSurfaces(void);
 qboolean R_inPVS(const vec3_t p1, const vec3_t p2);
+void R_ClearVisLists(void);
+
+/*
+============================================================
+
+WORLD VBO
+
+============================================================
+*/
+
+typedef struct {
+	vec3_t xyz;
+	vec2_t st;
+	vec2_t lightmap;
+	color4ub_t color;	 // CGEN_EXACT_VERTEX
+	color4ub_t litColor; // CGEN_VERTEX, alpha not scaled
+} vboVertex_t;
+
+typedef enum {
+	VBOCOLOR_NONE, // must be computed per vertex
+	VBOCOLOR_CONST,
+	VBOCOLOR_EXACT,
+	VBOCOLOR_EXACT_OPAQUE,
+	VBOCOLOR_LIT,
+	VBOCOLOR_LIT_OPAQUE
+} vboColor_t;
+
+vboColor_t R_VboStageColor(const shaderStage_t *pStage, byte *constColor);
+void R_BuildWorldVbo(void);
+void R_ShutdownWorldVbo(void);
 
 /*
 ============================================================
@@ -1542,6 +1597,7 @@ void RE_SaveJPG(char *filename, int quality, int image_width, int image_height,
 size_t RE_SaveJPGToBuffer(byte *buffer, size_t bufSize, int quality, int image_width, int image_height,
 						  byte *image_buffer, int padding);
 void RE_TakeVideoFrame(int width, int height, byte *captureBuffer, byte *encodeBuffer, qboolean motionJpeg);
+void RE_FinishVideoFrames(void);
 
 void R_DrawElements(int numIndexes, const glIndex_t *indexes);
 void VectorArrayNormalize(vec4_t *normals, unsigned int count);
@@ -49,7 +49,6 @@ int R_CullLocalBox(vec3_t bounds[2]) {
 	int i, j;
 	vec3_t transformed[8];
 	float dists[8];
-	vec3_t v;
 	cplane_t *frust;
 	int anyBack;
 	int front, back;
@@ -60,16 +59,13 @@ int R_CullLocalBox(vec3_t bounds[2]) {
 
 	// transform into world space
 	for (i = 0; i < 8; i++) {
-		v[0] = bounds[i & 1][0];
-		v[1] = bounds[(i >> 1) & 1][1];
-		v[2] = bounds[(i >> 2) & 1][2];
-
-		VectorCopy(tr.or.origin, transformed[i]);
-		VectorMA(transformed[i], v[0], tr.or.axis[0], transformed[i]);
-		VectorMA(transformed[i], v[1], tr.or.axis[1], transformed[i]);
-		VectorMA(transformed[i], v[2], tr.or.axis[2], transformed[i]);
+		transformed[i][0] = bounds[i & 1][0];
+		transformed[i][1] = bounds[(i >> 1) & 1][1];
+		transformed[i][2] = bounds[(i >> 2) & 1][2];
 	}
 
+	TransformPoints(tr.or.origin, tr.or.axis, transformed, transformed, 8);
+
 	// check against frustum planes
 	anyBack = 0;
 	for (i = 0; i < 4; i++) {
@@ -979,51 +975,69 @@ DRAWSURF SORTING
 
 /*
 ===============
-R_Radix
+R_RadixSort
+
+Radix sort with 4 byte size buckets, with all four histograms counted in
+one pass.  Bytes that are equal for every surface are skipped and a list
+that is already sorted is left as it is.
 ===============
 */
-static ID_INLINE void R_Radix(int byte, int size, drawSurf_t *source, drawSurf_t *dest) {
-	int count[256] = {0};
+static void R_RadixSort(drawSurf_t *source, int size) {
+	static drawSurf_t scratch[MAX_DRAWSURFS];
+	int count[4][256];
 	int index[256];
-	int i;
-	unsigned char *sortKey = NULL;
-	unsigned char *end = NULL;
+	drawSurf_t *in, *out, *tmp;
+	unsigned int key, prev;
+	qboolean sorted;
+	int i, b, shift;
+
+	Com_Memset(count, 0, sizeof(count));
+
+	sorted = qtrue;
+	prev = 0;
+	for (i = 0; i < size; i++) {
+		key = source[i].sort;
+		if (key < prev) {
+			sorted = qfalse;
+		}
+		prev = key;
 
-	sortKey = ((unsigned char *)&source[0].sort) + byte;
-	end = sortKey + (size * sizeof(drawSurf_t));
-	for (; sortKey < end; sortKey += sizeof(drawSurf_t))
-		++count[*sortKey];
+		count[0][key & 255]++;
+		count[1][(key >> 8) & 255]++;
+		count[2][(key >> 16) & 255]++;
+		count[3][key >> 24]++;
+	}
 
-	index[0] = 0;
+	if (sorted) {
+		return;
+	}
 
-	for (i = 1; i < 256; ++i)
-		index[i] = index[i - 1] + count[i - 1];
+	in = source;
+	out = scratch;
+	for (b = 0; b < 4; b++) {
+		shift = b * 8;
 
-	sortKey = ((unsigned char *)&source[0].sort) + byte;
-	for (i = 0; i < size; ++i, sortKey += sizeof(drawSurf_t))
-		dest[index[*sortKey]++] = source[i];
-}
+		if (count[b][(in[0].sort >> shift) & 255] == size) {
+			continue;
+		}
 
-/*
-===============
-R_RadixSort
+		index[0] = 0;
+		for (i = 1; i < 256; i++) {
+			index[i] = index[i - 1] + count[b][i - 1];
+		}
 
-Radix sort with 4 byte size buckets
-===============
-*/
-static void R_RadixSort(drawSurf_t *source, int size) {
-	static drawSurf_t scratch[MAX_DRAWSURFS];
-#ifdef Q3_LITTLE_ENDIAN
-	R_Radix(0, size, source, scratch);
-	R_Radix(1, size, scratch, source);
-	R_Radix(2, size, source, scratch);
-	R_Radix(3, size, scratch, source);
-#else
-	R_Radix(3, size, source, scratch);
-	R_Radix(2, size, scratch, source);
-	R_Radix(1, size, source, scratch);
-	R_Radix(0, size, scratch, source);
-#endif // Q3_LITTLE_ENDIAN
+		for (i = 0; i < size; i++) {
+			out[index[(in[i].sort >> shift) & 255]++] = in[i];
+		}
+
+		tmp = in;
+		in = out;
+		out = tmp;
+	}
+
+	if (in != source) {
+		Com_Memcpy(source, in, size * sizeof(*source));
+	}
 }
 
 //==========================================================================================
@@ -124,6 +124,44 @@ static void R_ChopPolyBehindPlane(int numInPoints, vec3_t inPoints[MAX_VERTS_ON_
 	}
 }
 
+/*
+=================
+R_MarkClipBounds
+
+Bounds of the volume between the clipping planes of the projected polygon,
+nothing outside of them can end up in a fragment
+=================
+*/
+static void R_MarkClipBounds(int numPoints, const vec3_t *points, const vec3_t dir, vec3_t bounds[2]) {
+	float d0, d, spread;
+	vec3_t temp;
+	int i;
+
+	// the near and far planes go through the first point
+	d0 = DotProduct(dir, points[0]);
+	spread = 0;
+	for (i = 1; i < numPoints; i++) {
+		d = fabs(DotProduct(dir, points[i]) - d0);
+		if (d > spread) {
+			spread = d;
+		}
+	}
+
+	ClearBounds(bounds[0], bounds[1]);
+	for (i = 0; i < numPoints; i++) {
+		VectorMA(points[i], -32 - spread, dir, temp);
+		AddPointToBounds(temp, bounds[0], bounds[1]);
+		VectorMA(points[i], 20 + spread, dir, temp);
+		AddPointToBounds(temp, bounds[0], bounds[1]);
+	}
+
+	// room for the chopping epsilon and the marker offset
+	for (i = 0; i < 3; i++) {
+		bounds[0][i] -= 1 + MARKER_OFFSET;
+		bounds[1][i] += 1 + MARKER_OFFSET;
+	}
+}
+
 /*
 =================
 R_BoxSurfaces_r
@@ -131,7 +169,7 @@ R_BoxSurfaces_r
 =================
 */
 static void R_BoxSurfaces_r(mnode_t *node, vec3_t mins, vec3_t maxs, surfaceType_t **list, int listsize, int *listlength,
-					 vec3_t dir) {
+					 vec3_t dir, vec3_t clipBounds[2]) {
 
 	int s, c;
 	msurface_t *surf, **mark;
@@ -144,7 +182,7 @@ static void R_BoxSurfaces_r(mnode_t *node, vec3_t mins, vec3_t maxs, surfaceType
 		} else if (s == 2) {
 			node = node->children[1];
 		} else {
-			R_BoxSurfaces_r(node->children[0], mins, maxs, list, listsize, listlength, dir);
+			R_BoxSurfaces_r(node->children[0], mins, maxs, list, listsize, listlength, dir, clipBounds);
 			node = node->children[1];
 		}
 	}
@@ -173,7 +211,18 @@ static void R_BoxSurfaces_r(mnode_t *node, vec3_t mins, vec3_t maxs, surfaceType
 				// don't add faces that make sharp angles with the projection direction
 				surf->viewCount = tr.viewCount;
 			}
-		} else if (*(surfaceType_t *)(surf->data) != SF_GRID && *(surfaceType_t *)(surf->data) != SF_TRIANGLES)
+		} else if (*(surf->data) == SF_GRID) {
+			// the surface should touch the clipping volume
+			srfGridMesh_t *grid = (srfGridMesh_t *)surf->data;
+			if (!BoundsIntersect(grid->meshBounds[0], grid->meshBounds[1], clipBounds[0], clipBounds[1])) {
+				surf->viewCount = tr.viewCount;
+			}
+		} else if (*(surf->data) == SF_TRIANGLES) {
+			srfTriangles_t *tris = (srfTriangles_t *)surf->data;
+			if (!BoundsIntersect(tris->bounds[0], tris->bounds[1], clipBounds[0], clipBounds[1])) {
+				surf->viewCount = tr.viewCount;
+			}
+		} else
 			surf->viewCount = tr.viewCount;
 		// check the viewCount because the surface may have
 		// already been added if it spans multiple leafs
@@ -198,6 +247,16 @@ static void R_AddMarkFragments(int numClipPoints, vec3_t clipPoints[2][MAX_VERTS
 						vec3_t maxs) {
 	int pingPong, i;
 	markFragment_t *mf;
+	vec3_t polyMins, polyMaxs;
+
+	// skip polygons that are completely outside the clipping volume
+	ClearBounds(polyMins, polyMaxs);
+	for (i = 0; i < numClipPoints; i++) {
+		AddPointToBounds(clipPoints[0][i], polyMins, polyMaxs);
+	}
+	if (!BoundsIntersect(polyMins, polyMaxs, mins, maxs)) {
+		return;
+	}
 
 	// chop the surface by all the bounding planes of the to be projected polygon
 	pingPong = 0;
@@ -254,6 +313,7 @@ int R_MarkFragments(int numPoints, const vec3_t *points, const vec3_t projection
 	int i, j, k, m, n;
 	surfaceType_t *surfaces[64];
 	vec3_t mins, maxs;
+	vec3_t clipBounds[2];
 	int returnedFragments;
 	int returnedPoints;
 	vec3_t normals[MAX_VERTS_ON_POLY + 2];
@@ -309,8 +369,10 @@ int R_MarkFragments(int numPoints, const vec3_t *points, const vec3_t projection
 	dists[numPoints + 1] = DotProduct(normals[numPoints + 1], points[0]) - 20;
 	numPlanes = numPoints + 2;
 
+	R_MarkClipBounds(numPoints, points, projectionDir, clipBounds);
+
 	numsurfaces = 0;
-	R_BoxSurfaces_r(tr.world->nodes, mins, maxs, surfaces, 64, &numsurfaces, projectionDir);
+	R_BoxSurfaces_r(tr.world->nodes, mins, maxs, surfaces, 64, &numsurfaces, projectionDir, clipBounds);
 	// assert(numsurfaces <= 64);
 	// assert(numsurfaces != 64);
 
@@ -363,8 +425,8 @@ int R_MarkFragments(int numPoints, const vec3_t *points, const vec3_t projection
 					if (DotProduct(normal, projectionDir) < -0.1) {
 						// add the fragments of this triangle
 						R_AddMarkFragments(numClipPoints, clipPoints, numPlanes, normals, dists, maxPoints, pointBuffer,
-										   maxFragments, fragmentBuffer, &returnedPoints, &returnedFragments, mins,
-										   maxs);
+										   maxFragments, fragmentBuffer, &returnedPoints, &returnedFragments, clipBounds[0],
+										   clipBounds[1]);
 
 						if (returnedFragments == maxFragments) {
 							return returnedFragments; // not enough space for more fragments
@@ -385,8 +447,8 @@ int R_MarkFragments(int numPoints, const vec3_t *points, const vec3_t projection
 					if (DotProduct(normal, projectionDir) < -0.05) {
 						// add the fragments of this triangle
 						R_AddMarkFragments(numClipPoints, clipPoints, numPlanes, normals, dists, maxPoints, pointBuffer,
-										   maxFragments, fragmentBuffer, &returnedPoints, &returnedFragments, mins,
-										   maxs);
+										   maxFragments, fragmentBuffer, &returnedPoints, &returnedFragments, clipBounds[0],
+										   clipBounds[1]);
 
 						if (returnedFragments == maxFragments) {
 							return returnedFragments; // not enough space for more fragments
@@ -412,7 +474,7 @@ int R_MarkFragments(int numPoints, const vec3_t *points, const vec3_t projection
 
 				// add the fragments of this face
 				R_AddMarkFragments(3, clipPoints, numPlanes, normals, dists, maxPoints, pointBuffer, maxFragments,
-								   fragmentBuffer, &returnedPoints, &returnedFragments, mins, maxs);
+								   fragmentBuffer, &returnedPoints, &returnedFragments, clipBounds[0], clipBounds[1]);
 				if (returnedFragments == maxFragments) {
 					return returnedFragments; // not enough space for more fragments
 				}
@@ -429,7 +491,7 @@ int R_MarkFragments(int numPoints, const vec3_t *points, const vec3_t projection
 
 				// add the fragments of this face
 				R_AddMarkFragments(3, clipPoints, numPlanes, normals, dists, maxPoints, pointBuffer, maxFragments,
-								   fragmentBuffer, &returnedPoints, &returnedFragments, mins, maxs);
+								   fragmentBuffer, &returnedPoints, &returnedFragments, clipBounds[0], clipBounds[1]);
 				if (returnedFragments == maxFragments) {
 					return returnedFragments; // not enough space for more fragments
 				}
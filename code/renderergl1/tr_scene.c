@@ -292,6 +292,7 @@ void RE_RenderScene(const refdef_t *fd) {
 	}
 
 	startTime = ri.Milliseconds();
+	ri.ProfileBegin("RE_RenderScene");
 
 	if (!tr.world && !(fd->rdflags & RDF_NOWORLDMODEL)) {
 		ri.Error(ERR_DROP, "R_RenderScene: NULL worldmodel");
@@ -398,4 +399,5 @@ void RE_RenderScene(const refdef_t *fd) {
 	r_firstScenePoly = r_numpolys;
 
 	tr.frontEndMsec += ri.Milliseconds() - startTime;
+	ri.ProfileEnd();
 }
@@ -306,8 +306,10 @@ void RB_BeginSurface(shader_t *shader, int fogNum) {
 
 	tess.numIndexes = 0;
 	tess.numVertexes = 0;
+	tess.numVboIndexes = 0;
 	tess.shader = state;
 	tess.fogNum = fogNum;
+	tess.useVbo = tr.worldVbo && state->staticVbo && !fogNum && !r_showtris->integer && !r_shownormals->integer;
 	tess.dlightBits = 0; // will be OR'd in by surface functions
 	tess.xstages = state->stages;
 	tess.numPasses = state->numUnfoggedPasses;
@@ -1193,6 +1195,122 @@ void RB_StageIteratorLightmappedMultitexture(void) {
 	}
 }
 
+static ID_INLINE const void *RB_VboTexCoords(const textureBundle_t *bundle) {
+	if (bundle->tcGen == TCGEN_LIGHTMAP) {
+		return BUFFER_OFFSET(offsetof(vboVertex_t, lightmap));
+	}
+	return BUFFER_OFFSET(offsetof(vboVertex_t, st));
+}
+
+/*
+** RB_StageIteratorWorldVbo
+**
+** Draws tess.vboIndexes, the vertexes are already in tr.worldVbo
+** and ComputeStaticVbo made sure no stage needs anything else
+*/
+void RB_StageIteratorWorldVbo(void) {
+	shader_t *shader;
+	int stage;
+
+	shader = tess.shader;
+
+	if (r_logFile->integer) {
+		// don't just call LogComment, or we will get
+		// a call to va() every frame!
+		GLimp_LogComment(va("--- RB_StageIteratorWorldVbo( %s ) ---\n", tess.shader->name));
+	}
+
+	GL_Cull(shader->cullType);
+
+	if (shader->polygonOffset) {
+		qglEnable(GL_POLYGON_OFFSET_FILL);
+		qglPolygonOffset(r_offsetFactor->value, r_offsetUnits->value);
+	}
+
+	qglBindBuffer(GL_ARRAY_BUFFER, tr.worldVbo);
+	qglVertexPointer(3, GL_FLOAT, sizeof(vboVertex_t), BUFFER_OFFSET(offsetof(vboVertex_t, xyz)));
+
+	GL_SelectTexture(0);
+	qglEnableClientState(GL_TEXTURE_COORD_ARRAY);
+
+	for (stage = 0; stage < MAX_SHADER_STAGES; stage++) {
+		shaderStage_t *pStage = tess.xstages[stage];
+		byte color[4];
+
+		if (!pStage) {
+			break;
+		}
+
+		switch (R_VboStageColor(pStage, color)) {
+		case VBOCOLOR_CONST:
+			qglDisableClientState(GL_COLOR_ARRAY);
+			qglColor4ubv(color);
+			break;
+		case VBOCOLOR_EXACT_OPAQUE:
+			qglEnableClientState(GL_COLOR_ARRAY);
+			qglColorPointer(3, GL_UNSIGNED_BYTE, sizeof(vboVertex_t), BUFFER_OFFSET(offsetof(vboVertex_t, color)));
+			break;
+		case VBOCOLOR_LIT:
+			qglEnableClientState(GL_COLOR_ARRAY);
+			qglColorPointer(4, GL_UNSIGNED_BYTE, sizeof(vboVertex_t), BUFFER_OFFSET(offsetof(vboVertex_t, litColor)));
+			break;
+		case VBOCOLOR_LIT_OPAQUE:
+			qglEnableClientState(GL_COLOR_ARRAY);
+			qglColorPointer(3, GL_UNSIGNED_BYTE, sizeof(vboVertex_t), BUFFER_OFFSET(offsetof(vboVertex_t, litColor)));
+			break;
+		default:
+			qglEnableClientState(GL_COLOR_ARRAY);
+			qglColorPointer(4, GL_UNSIGNED_BYTE, sizeof(vboVertex_t), BUFFER_OFFSET(offsetof(vboVertex_t, color)));
+			break;
+		}
+
+		qglTexCoordPointer(2, GL_FLOAT, sizeof(vboVertex_t), RB_VboTexCoords(&pStage->bundle[0]));
+		R_BindAnimatedImage(&pStage->bundle[0]);
+		GL_State(pStage->stateBits);
+
+		if (pStage->bundle[1].image[0] != 0) {
+			// same as DrawMultitextured
+			if (backEnd.viewParms.isPortal) {
+				qglPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+			}
+
+			GL_SelectTexture(1);
+			qglEnable(GL_TEXTURE_2D);
+			qglEnableClientState(GL_TEXTURE_COORD_ARRAY);
+
+			if (r_lightmap->integer) {
+				GL_TexEnv(GL_REPLACE);
+			} else {
+				GL_TexEnv(tess.shader->multitextureEnv);
+			}
+
+			qglTexCoordPointer(2, GL_FLOAT, sizeof(vboVertex_t), RB_VboTexCoords(&pStage->bundle[1]));
+			R_BindAnimatedImage(&pStage->bundle[1]);
+
+			// always triangles, strips would pull each vertex back through the driver
+			qglDrawElements(GL_TRIANGLES, tess.numVboIndexes, GL_INDEX_TYPE, tess.vboIndexes);
+
+			qglDisableClientState(GL_TEXTURE_COORD_ARRAY);
+			qglDisable(GL_TEXTURE_2D);
+
+			GL_SelectTexture(0);
+		} else {
+			qglDrawElements(GL_TRIANGLES, tess.numVboIndexes, GL_INDEX_TYPE, tess.vboIndexes);
+		}
+
+		// allow skipping out to show just lightmaps during development
+		if (r_lightmap->integer && (pStage->bundle[0].isLightmap || pStage->bundle[1].isLightmap)) {
+			break;
+		}
+	}
+
+	qglBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	if (shader->polygonOffset) {
+		qglDisable(GL_POLYGON_OFFSET_FILL);
+	}
+}
+
 /*
 ** RB_EndSurface
 */
@@ -1201,7 +1319,7 @@ void RB_EndSurface(void) {
 
 	input = &tess;
 
-	if (input->numIndexes == 0) {
+	if (input->numIndexes == 0 && input->numVboIndexes == 0) {
 		return;
 	}
 
@@ -1227,25 +1345,35 @@ void RB_EndSurface(void) {
 	//
 	backEnd.pc.c_shaders++;
 	backEnd.pc.c_vertexes += tess.numVertexes;
-	backEnd.pc.c_indexes += tess.numIndexes;
-	backEnd.pc.c_totalIndexes += tess.numIndexes * tess.numPasses;
+	backEnd.pc.c_indexes += tess.numIndexes + tess.numVboIndexes;
+	backEnd.pc.c_totalIndexes += (tess.numIndexes + tess.numVboIndexes) * tess.numPasses;
 
 	//
-	// call off to shader specific tess end function
+	// surfaces that are in the world VBO
 	//
-	tess.currentStageIteratorFunc();
+	if (tess.numVboIndexes) {
+		RB_StageIteratorWorldVbo();
+	}
 
 	//
-	// draw debugging stuff
+	// call off to shader specific tess end function
 	//
-	if (r_showtris->integer) {
-		DrawTris(input);
-	}
-	if (r_shownormals->integer) {
-		DrawNormals(input);
+	if (tess.numIndexes) {
+		tess.currentStageIteratorFunc();
+
+		//
+		// draw debugging stuff
+		//
+		if (r_showtris->integer) {
+			DrawTris(input);
+		}
+		if (r_shownormals->integer) {
+			DrawNormals(input);
+		}
 	}
 	// clear shader so we can tell we don't have any unclosed surfaces
 	tess.numIndexes = 0;
+	tess.numVboIndexes = 0;
 
 	GLimp_LogComment("----------\n");
 }
@@ -23,8 +23,6 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 // tr_shader.c -- this file deals with the parsing and definition of shaders
 
-static char *s_shaderText;
-
 // the shader is parsed into these global variables, then copied into
 // dynamically allocated memory if it is valid.
 static shaderStage_t stages[MAX_SHADER_STAGES];
@@ -1514,6 +1512,46 @@ static void ComputeStageIteratorFunc(void) {
 	}
 }
 
+/*
+===================
+ComputeStaticVbo
+
+See if surfaces with this shader can be drawn straight from the world VBO,
+which needs every stage color and texture coordinate to be in the buffer
+===================
+*/
+static void ComputeStaticVbo(void) {
+	byte color[4];
+	int i, b;
+
+	shader.staticVbo = qfalse;
+
+	if (shader.isSky || shader.numDeforms || !shader.numUnfoggedPasses) {
+		return;
+	}
+
+	for (i = 0; i < shader.numUnfoggedPasses; i++) {
+		shaderStage_t *pStage = &stages[i];
+
+		if (R_VboStageColor(pStage, color) == VBOCOLOR_NONE) {
+			return;
+		}
+
+		for (b = 0; b < NUM_TEXTURE_BUNDLES; b++) {
+			textureBundle_t *bundle = &pStage->bundle[b];
+
+			if (b > 0 && !bundle->image[0]) {
+				break;
+			}
+			if (bundle->numTexMods || (bundle->tcGen != TCGEN_TEXTURE && bundle->tcGen != TCGEN_LIGHTMAP)) {
+				return;
+			}
+		}
+	}
+
+	shader.staticVbo = qtrue;
+}
+
 typedef struct {
 	int blendA;
 	int blendB;
@@ -2097,6 +2135,7 @@ static shader_t *FinishShader(void) {
 
 	// determine which stage iterator function is appropriate
 	ComputeStageIteratorFunc();
+	ComputeStaticVbo();
 
 	return GeneratePermanentShader();
 }
@@ -2107,8 +2146,9 @@ static shader_t *FinishShader(void) {
 ====================
 FindShaderInShaderText
 
-Scans the combined text description of all the shader files for
-the given shader name.
+Looks the given shader name up in the combined text description
+of all the shader files.  Every name in the text is hashed, so the
+text itself is never scanned.
 
 return NULL if not found
 
@@ -2132,27 +2172,6 @@ static const char *FindShaderInShaderText(const char *shadername) {
 		}
 	}
 
-	p = s_shaderText;
-
-	if (!p) {
-		return NULL;
-	}
-
-	// look for label
-	while (1) {
-		token = COM_ParseExt(&p, qtrue);
-		if (token[0] == 0) {
-			break;
-		}
-
-		if (!Q_stricmp(token, shadername)) {
-			return p;
-		} else {
-			// skip the definition
-			SkipBracedSection(&p, 0);
-		}
-	}
-
 	return NULL;
 }
 
@@ -2363,6 +2382,37 @@ shader_t *R_FindShader(const char *name, int lightmapIndex, qboolean mipRawImage
 	return FinishShader();
 }
 
+/*
+===============
+R_QueueShaderImages
+
+Queues the images R_FindShader is going to load for a shader with
+R_QueueImagePrefetch, so the level's images can be decoded on the job
+threads while its shaders are created
+===============
+*/
+void R_QueueShaderImages(const char *name) {
+	char strippedName[MAX_QPATH];
+	const char *shaderText;
+	shader_t *sh;
+	int hash;
+
+	COM_StripExtension(name, strippedName, sizeof(strippedName));
+
+	// already loaded along with its images
+	hash = generateHashValue(strippedName, FILE_HASH_SIZE);
+	for (sh = hashTable[hash]; sh; sh = sh->next) {
+		if (!Q_stricmp(sh->name, strippedName))
+			return;
+	}
+
+	shaderText = FindShaderInShaderText(strippedName);
+	if (shaderText)
+		R_QueueShaderImagePrefetch(shaderText);
+	else
+		R_QueueImagePrefetch(name);
+}
+
 qhandle_t RE_RegisterShaderFromImage(const char *name, int lightmapIndex, image_t *image, qboolean mipRawImage) {
 	int hash;
 	shader_t *sh;
@@ -2640,129 +2690,33 @@ void R_ShaderList_f(void) {
 ====================
 ScanAndLoadShaderFiles
 
-Finds and loads all .shader files, combining them into
-a single large text block that can be scanned for shader names
+Loads the text of all the .shader files, see
+R_LoadShaderText, and hashes the shader names in it
 =====================
 */
-#define MAX_SHADER_FILES 4096
 static void ScanAndLoadShaderFiles(void) {
-	char **shaderFiles;
-	char *buffers[MAX_SHADER_FILES] = {0};
-	const char *p;
-	int numShaderFiles;
+	shaderText_t shaderText;
+	const char *p, *token, *hashMem;
+	int shaderTextHashTableSizes[MAX_SHADERTEXT_HASH], hash;
 	int i;
-	const char *oldp, *token, *hashMem;
-	char *textEnd;
-	int shaderTextHashTableSizes[MAX_SHADERTEXT_HASH], hash, size;
-	char shaderName[MAX_QPATH];
-	int shaderLine;
-
-	long sum = 0, summand;
-	// scan for shader files
-	shaderFiles = ri.FS_ListFiles("scripts", ".shader", &numShaderFiles);
-
-	if (!shaderFiles || !numShaderFiles) {
-		ri.Printf(PRINT_WARNING, "WARNING: no shader files found\n");
-		return;
-	}
-
-	if (numShaderFiles > MAX_SHADER_FILES) {
-		numShaderFiles = MAX_SHADER_FILES;
-	}
 
-	// load and parse shader files
-	for (i = 0; i < numShaderFiles; i++) {
-		char filename[MAX_QPATH];
+	Com_Memset(shaderTextHashTable, 0, sizeof(shaderTextHashTable));
 
-		Com_sprintf(filename, sizeof(filename), "scripts/%s", shaderFiles[i]);
-		ri.Printf(PRINT_DEVELOPER, "...loading '%s'\n", filename);
-		summand = ri.FS_ReadFile(filename, (void **)&buffers[i]);
-
-		if (!buffers[i])
-			ri.Error(ERR_DROP, "Couldn't load %s", filename);
-
-		// Do a simple check on the shader structure in that file to make sure one bad shader file cannot fuck up all
-		// other shaders.
-		p = buffers[i];
-		COM_BeginParseSession(filename);
-		while (1) {
-			token = COM_ParseExt(&p, qtrue);
-
-			if (!*token)
-				break;
-
-			Q_strncpyz(shaderName, token, sizeof(shaderName));
-			shaderLine = COM_GetCurrentParseLine();
-
-			token = COM_ParseExt(&p, qtrue);
-			if (token[0] != '{' || token[1] != '\0') {
-				ri.Printf(PRINT_WARNING,
-						  "WARNING: Ignoring shader file %s. Shader \"%s\" on line %d missing opening brace", filename,
-						  shaderName, shaderLine);
-				if (token[0]) {
-					ri.Printf(PRINT_WARNING, " (found \"%s\" on line %d)", token, COM_GetCurrentParseLine());
-				}
-				ri.Printf(PRINT_WARNING, ".\n");
-				ri.FS_FreeFile(buffers[i]);
-				buffers[i] = NULL;
-				break;
-			}
-
-			if (!SkipBracedSection(&p, 1)) {
-				ri.Printf(PRINT_WARNING,
-						  "WARNING: Ignoring shader file %s. Shader \"%s\" on line %d missing closing brace.\n",
-						  filename, shaderName, shaderLine);
-				ri.FS_FreeFile(buffers[i]);
-				buffers[i] = NULL;
-				break;
-			}
-		}
-
-		if (buffers[i])
-			sum += summand;
-	}
-
-	// build single large buffer
-	s_shaderText = ri.Hunk_Alloc(sum + numShaderFiles * 2, h_low);
-	s_shaderText[0] = '\0';
-	textEnd = s_shaderText;
-
-	// free in reverse order, so the temp files are all dumped
-	for (i = numShaderFiles - 1; i >= 0; i--) {
-		if (!buffers[i])
-			continue;
-
-		strcat(textEnd, buffers[i]);
-		strcat(textEnd, "\n");
-		textEnd += strlen(textEnd);
-		ri.FS_FreeFile(buffers[i]);
+	if (!R_LoadShaderText(&shaderText, qfalse)) {
+		return;
 	}
 
-	COM_Compress(s_shaderText);
-
-	// free up memory
-	ri.FS_FreeFileList(shaderFiles);
-
 	Com_Memset(shaderTextHashTableSizes, 0, sizeof(shaderTextHashTableSizes));
-	size = 0;
 
-	p = s_shaderText;
-	// look for shader names
-	while (1) {
+	for (i = 0; i < shaderText.numShaders; i++) {
+		p = shaderText.text + shaderText.shaders[i];
 		token = COM_ParseExt(&p, qtrue);
-		if (token[0] == 0) {
-			break;
-		}
 
 		hash = generateHashValue(token, MAX_SHADERTEXT_HASH);
 		shaderTextHashTableSizes[hash]++;
-		size++;
-		SkipBracedSection(&p, 0);
 	}
 
-	size += MAX_SHADERTEXT_HASH;
-
-	hashMem = ri.Hunk_Alloc(size * sizeof(char *), h_low);
+	hashMem = ri.Hunk_Alloc((shaderText.numShaders + MAX_SHADERTEXT_HASH) * sizeof(char *), h_low);
 
 	for (i = 0; i < MAX_SHADERTEXT_HASH; i++) {
 		shaderTextHashTable[i] = (const char **)hashMem;
@@ -2771,22 +2725,14 @@ static void ScanAndLoadShaderFiles(void) {
 
 	Com_Memset(shaderTextHashTableSizes, 0, sizeof(shaderTextHashTableSizes));
 
-	p = s_shaderText;
-	// look for shader names
-	while (1) {
-		oldp = p;
+	// in text order, so the later files still win
+	for (i = 0; i < shaderText.numShaders; i++) {
+		p = shaderText.text + shaderText.shaders[i];
 		token = COM_ParseExt(&p, qtrue);
-		if (token[0] == 0) {
-			break;
-		}
 
 		hash = generateHashValue(token, MAX_SHADERTEXT_HASH);
-		shaderTextHashTable[hash][shaderTextHashTableSizes[hash]++] = oldp;
-
-		SkipBracedSection(&p, 0);
+		shaderTextHashTable[hash][shaderTextHashTableSizes[hash]++] = shaderText.text + shaderText.shaders[i];
 	}
-
-	return;
 }
 
 /*
@@ -43,7 +43,14 @@ typedef struct {
 static edgeDef_t edgeDefs[SHADER_MAX_VERTEXES][MAX_EDGE_DEFS];
 static int numEdgeDefs[SHADER_MAX_VERTEXES];
 static int facing[SHADER_MAX_INDEXES / 3];
-static vec3_t shadowXyz[SHADER_MAX_VERTEXES];
+
+// tess.xyz followed by the same vertexes pushed away from the light
+static vec4_t shadowXyz[SHADER_MAX_VERTEXES * 2] QALIGN(16);
+
+// two triangles for every silhouette edge, there are at most as many of those
+// as there are triangle edges
+static glIndex_t shadowIndexes[SHADER_MAX_INDEXES * 6];
+static int numShadowIndexes;
 
 void R_AddEdgeDef(int i1, int i2, int facing) {
 	int c;
@@ -58,50 +65,26 @@ void R_AddEdgeDef(int i1, int i2, int facing) {
 	numEdgeDefs[i1]++;
 }
 
-void R_RenderShadowEdges(void) {
-	int i;
-
-#if 0
-	int		numTris;
-
-	// dumb way -- render every triangle's edges
-	numTris = tess.numIndexes / 3;
-
-	for ( i = 0 ; i < numTris ; i++ ) {
-		int		i1, i2, i3;
-
-		if ( !facing[i] ) {
-			continue;
-		}
+/*
+=================
+R_BuildShadowEdges
 
-		i1 = tess.indexes[ i*3 + 0 ];
-		i2 = tess.indexes[ i*3 + 1 ];
-		i3 = tess.indexes[ i*3 + 2 ];
-
-		qglBegin( GL_TRIANGLE_STRIP );
-		qglVertex3fv( tess.xyz[ i1 ] );
-		qglVertex3fv( shadowXyz[ i1 ] );
-		qglVertex3fv( tess.xyz[ i2 ] );
-		qglVertex3fv( shadowXyz[ i2 ] );
-		qglVertex3fv( tess.xyz[ i3 ] );
-		qglVertex3fv( shadowXyz[ i3 ] );
-		qglVertex3fv( tess.xyz[ i1 ] );
-		qglVertex3fv( shadowXyz[ i1 ] );
-		qglEnd();
-	}
-#else
+Collects the quads between the silhouette edges and their projection
+into shadowIndexes, so that the volume can be drawn with one call
+=================
+*/
+static void R_BuildShadowEdges(void) {
 	int c, c2;
-	int j, k;
+	int i, j, k;
 	int i2;
-	int c_edges, c_rejected;
 	int hit[2];
+	glIndex_t *idx;
 
 	// an edge is NOT a silhouette edge if its face doesn't face the light,
 	// or if it has a reverse paired edge that also faces the light.
 	// A well behaved polyhedron would have exactly two faces for each edge,
 	// but lots of models have dangling edges or overfanned edges
-	c_edges = 0;
-	c_rejected = 0;
+	idx = shadowIndexes;
 
 	for (i = 0; i < tess.numVertexes; i++) {
 		c = numEdgeDefs[i];
@@ -124,19 +107,19 @@ void R_RenderShadowEdges(void) {
 			// if it doesn't share the edge with another front facing
 			// triangle, it is a sil edge
 			if (hit[1] == 0) {
-				qglBegin(GL_TRIANGLE_STRIP);
-				qglVertex3fv(tess.xyz[i]);
-				qglVertex3fv(shadowXyz[i]);
-				qglVertex3fv(tess.xyz[i2]);
-				qglVertex3fv(shadowXyz[i2]);
-				qglEnd();
-				c_edges++;
-			} else {
-				c_rejected++;
+				// the strip i, i', i2, i2' as triangles
+				idx[0] = i;
+				idx[1] = i + tess.numVertexes;
+				idx[2] = i2;
+				idx[3] = i2;
+				idx[4] = i + tess.numVertexes;
+				idx[5] = i2 + tess.numVertexes;
+				idx += 6;
 			}
 		}
 	}
-#endif
+
+	numShadowIndexes = idx - shadowIndexes;
 }
 
 /*
@@ -165,11 +148,12 @@ void RB_ShadowTessEnd(void) {
 
 	// project vertexes away from light direction
 	for (i = 0; i < tess.numVertexes; i++) {
-		VectorMA(tess.xyz[i], -512, lightDir, shadowXyz[i]);
+		VectorCopy(tess.xyz[i], shadowXyz[i]);
+		VectorMA(tess.xyz[i], -512, lightDir, shadowXyz[tess.numVertexes + i]);
 	}
 
 	// decide which triangles face the light
-	Com_Memset(numEdgeDefs, 0, 4 * tess.numVertexes);
+	Com_Memset(numEdgeDefs, 0, tess.numVertexes * sizeof(numEdgeDefs[0]));
 
 	numTris = tess.numIndexes / 3;
 	for (i = 0; i < numTris; i++) {
@@ -203,6 +187,11 @@ void RB_ShadowTessEnd(void) {
 		R_AddEdgeDef(i3, i1, facing[i]);
 	}
 
+	R_BuildShadowEdges();
+	if (!numShadowIndexes) {
+		return;
+	}
+
 	// draw the silhouette edges
 
 	GL_Bind(tr.whiteImage);
@@ -216,15 +205,28 @@ void RB_ShadowTessEnd(void) {
 	qglEnable(GL_STENCIL_TEST);
 	qglStencilFunc(GL_ALWAYS, 1, 255);
 
-	GL_Cull(CT_BACK_SIDED);
-	qglStencilOp(GL_KEEP, GL_KEEP, GL_INCR);
+	qglDisableClientState(GL_COLOR_ARRAY);
+	qglDisableClientState(GL_TEXTURE_COORD_ARRAY);
+	qglVertexPointer(3, GL_FLOAT, 16, shadowXyz);
+
+	if (qglStencilOpSeparate) {
+		// both sides in one pass, wrapping so the order doesn't matter
+		GL_Cull(CT_TWO_SIDED);
+		qglStencilOpSeparate(backEnd.viewParms.isMirror ? GL_BACK : GL_FRONT, GL_KEEP, GL_KEEP, GL_INCR_WRAP);
+		qglStencilOpSeparate(backEnd.viewParms.isMirror ? GL_FRONT : GL_BACK, GL_KEEP, GL_KEEP, GL_DECR_WRAP);
 
-	R_RenderShadowEdges();
+		qglDrawElements(GL_TRIANGLES, numShadowIndexes, GL_INDEX_TYPE, shadowIndexes);
+	} else {
+		GL_Cull(CT_BACK_SIDED);
+		qglStencilOp(GL_KEEP, GL_KEEP, GL_INCR);
 
-	GL_Cull(CT_FRONT_SIDED);
-	qglStencilOp(GL_KEEP, GL_KEEP, GL_DECR);
+		qglDrawElements(GL_TRIANGLES, numShadowIndexes, GL_INDEX_TYPE, shadowIndexes);
 
-	R_RenderShadowEdges();
+		GL_Cull(CT_FRONT_SIDED);
+		qglStencilOp(GL_KEEP, GL_KEEP, GL_DECR);
+
+		qglDrawElements(GL_TRIANGLES, numShadowIndexes, GL_INDEX_TYPE, shadowIndexes);
+	}
 
 	// reenable writing to the color buffer
 	qglColorMask(rgba[0], rgba[1], rgba[2], rgba[3]);
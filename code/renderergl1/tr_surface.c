@@ -60,6 +60,38 @@ void RB_CheckOverflow(int verts, int indexes) {
 	RB_BeginSurface(tess.shader, tess.fogNum);
 }
 
+/*
+==============
+RB_CheckVboOverflow
+==============
+*/
+static void RB_CheckVboOverflow(int indexes) {
+	if (tess.numVboIndexes + indexes < SHADER_MAX_INDEXES) {
+		return;
+	}
+
+	RB_EndSurface();
+
+	if (indexes >= SHADER_MAX_INDEXES) {
+		ri.Error(ERR_DROP, "RB_CheckVboOverflow: indices > MAX (%d > %d)", indexes, SHADER_MAX_INDEXES);
+	}
+
+	RB_BeginSurface(tess.shader, tess.fogNum);
+}
+
+/*
+==============
+RB_VboSurface
+
+Surfaces in the world VBO only add indexes, unless they are dynamically lit
+or faded by the entity
+==============
+*/
+static ID_INLINE qboolean RB_VboSurface(int vboFirstVertex, int dlightBits) {
+	return tess.useVbo && vboFirstVertex >= 0 && !dlightBits &&
+		   !(backEnd.currentEntity->e.renderfx & RF_FORCEENTALPHA);
+}
+
 /*
 ==============
 RB_AddQuadStampExt
@@ -219,6 +251,17 @@ static void RB_SurfaceTriangles(srfTriangles_t *srf) {
 	qboolean needsNormal;
 
 	dlightBits = srf->dlightBits;
+
+	if (RB_VboSurface(srf->vboFirstVertex, dlightBits)) {
+		RB_CheckVboOverflow(srf->numIndexes);
+
+		for (i = 0; i < srf->numIndexes; i++) {
+			tess.vboIndexes[tess.numVboIndexes + i] = srf->vboFirstVertex + srf->indexes[i];
+		}
+		tess.numVboIndexes += srf->numIndexes;
+		return;
+	}
+
 	tess.dlightBits |= dlightBits;
 
 	RB_CHECKOVERFLOW(srf->numVerts, srf->numIndexes);
@@ -748,13 +791,24 @@ static void RB_SurfaceFace(srfSurfaceFace_t *surf) {
 	int numPoints;
 	int dlightBits;
 
+	dlightBits = surf->dlightBits;
+	indices = (unsigned *)(((char *)surf) + surf->ofsIndices);
+
+	if (RB_VboSurface(surf->vboFirstVertex, dlightBits)) {
+		RB_CheckVboOverflow(surf->numIndices);
+
+		tessIndexes = tess.vboIndexes + tess.numVboIndexes;
+		for (i = surf->numIndices - 1; i >= 0; i--) {
+			tessIndexes[i] = indices[i] + surf->vboFirstVertex;
+		}
+		tess.numVboIndexes += surf->numIndices;
+		return;
+	}
+
 	RB_CHECKOVERFLOW(surf->numPoints, surf->numIndices);
 
-	dlightBits = surf->dlightBits;
 	tess.dlightBits |= dlightBits;
 
-	indices = (unsigned *)(((char *)surf) + surf->ofsIndices);
-
 	Bob = tess.numVertexes;
 	tessIndexes = tess.indexes + tess.numIndexes;
 	for (i = surf->numIndices - 1; i >= 0; i--) {
@@ -815,6 +869,49 @@ static float LodErrorForVolume(vec3_t local, float radius) {
 	return r_lodCurveError->value / d;
 }
 
+/*
+=============
+RB_SurfaceGridVbo
+
+Indexes the rows and columns picked by RB_SurfaceGrid out of the full grid
+=============
+*/
+static void RB_SurfaceGridVbo(srfGridMesh_t *cv, int *widthTable, int lodWidth, int *heightTable, int lodHeight) {
+	int i, j;
+	int w;
+	glIndex_t *indexes;
+
+	w = lodWidth - 1;
+
+	for (i = 0; i < lodHeight - 1; i++) {
+		int row = cv->vboFirstVertex + heightTable[i] * cv->width;
+		int nextRow = cv->vboFirstVertex + heightTable[i + 1] * cv->width;
+
+		RB_CheckVboOverflow(w * 6);
+
+		indexes = tess.vboIndexes + tess.numVboIndexes;
+		for (j = 0; j < w; j++) {
+			int v1, v2, v3, v4;
+
+			// same order as RB_SurfaceGrid
+			v1 = row + widthTable[j + 1];
+			v2 = row + widthTable[j];
+			v3 = nextRow + widthTable[j];
+			v4 = nextRow + widthTable[j + 1];
+
+			indexes[0] = v2;
+			indexes[1] = v3;
+			indexes[2] = v1;
+
+			indexes[3] = v1;
+			indexes[4] = v3;
+			indexes[5] = v4;
+			indexes += 6;
+		}
+		tess.numVboIndexes += w * 6;
+	}
+}
+
 /*
 =============
 RB_SurfaceGrid
@@ -870,6 +967,11 @@ static void RB_SurfaceGrid(srfGridMesh_t *cv) {
 	heightTable[lodHeight] = cv->height - 1;
 	lodHeight++;
 
+	if (RB_VboSurface(cv->vboFirstVertex, dlightBits)) {
+		RB_SurfaceGridVbo(cv, widthTable, lodWidth, heightTable, lodHeight);
+		return;
+	}
+
 	// very large grids may have more points or indexes than can be fit
 	// in the tess structure, so we may have to issue it in multiple passes
 
@@ -0,0 +1,264 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+// tr_vbo.c -- static world surfaces in a vertex buffer
+
+/* Faces, grids and misc_model triangles whose shader needs no per vertex
+   work are uploaded once at map load.  The surface functions then only add
+   indexes into tess.vboIndexes and RB_StageIteratorWorldVbo draws them
+   straight from the buffer.  Fogged surfaces, dynamically lit surfaces and
+   shaders with deforms, tcMods or computed colors keep the old path. */
+
+#include "tr_local.h"
+
+/*
+=================
+R_VboStageColor
+
+How ComputeColors would fill the stage colors, or VBOCOLOR_NONE if it
+can't be taken from the buffer.  constColor is set for VBOCOLOR_CONST.
+=================
+*/
+vboColor_t R_VboStageColor(const shaderStage_t *pStage, byte *constColor) {
+	if (r_greyscale->value) {
+		return VBOCOLOR_NONE;
+	}
+
+	switch (pStage->rgbGen) {
+	case CGEN_IDENTITY:
+	case CGEN_IDENTITY_LIGHTING:
+	case CGEN_CONST:
+		if (pStage->rgbGen == CGEN_IDENTITY) {
+			constColor[0] = constColor[1] = constColor[2] = constColor[3] = 255;
+		} else if (pStage->rgbGen == CGEN_IDENTITY_LIGHTING) {
+			constColor[0] = constColor[1] = constColor[2] = constColor[3] = tr.identityLightByte;
+		} else {
+			Com_Memcpy(constColor, pStage->constantColor, 4);
+		}
+
+		switch (pStage->alphaGen) {
+		case AGEN_SKIP:
+			return VBOCOLOR_CONST;
+		case AGEN_IDENTITY:
+			constColor[3] = 255;
+			return VBOCOLOR_CONST;
+		case AGEN_CONST:
+			constColor[3] = pStage->constantColor[3];
+			return VBOCOLOR_CONST;
+		default:
+			return VBOCOLOR_NONE;
+		}
+	case CGEN_EXACT_VERTEX:
+		switch (pStage->alphaGen) {
+		case AGEN_SKIP:
+		case AGEN_VERTEX:
+			return VBOCOLOR_EXACT;
+		case AGEN_IDENTITY:
+			return VBOCOLOR_EXACT_OPAQUE;
+		default:
+			return VBOCOLOR_NONE;
+		}
+	case CGEN_VERTEX:
+		switch (pStage->alphaGen) {
+		case AGEN_SKIP:
+		case AGEN_VERTEX:
+			return VBOCOLOR_LIT;
+		case AGEN_IDENTITY:
+			return tr.identityLight == 1 ? VBOCOLOR_LIT : VBOCOLOR_LIT_OPAQUE;
+		default:
+			return VBOCOLOR_NONE;
+		}
+	default:
+		return VBOCOLOR_NONE;
+	}
+}
+
+/*
+=================
+R_VboFirstVertex
+=================
+*/
+static int *R_VboFirstVertex(surfaceType_t *data) {
+	switch (*data) {
+	case SF_FACE:
+		return &((srfSurfaceFace_t *)data)->vboFirstVertex;
+	case SF_GRID:
+		return &((srfGridMesh_t *)data)->vboFirstVertex;
+	case SF_TRIANGLES:
+		return &((srfTriangles_t *)data)->vboFirstVertex;
+	default:
+		return NULL;
+	}
+}
+
+/*
+=================
+R_VboNumVerts
+=================
+*/
+static int R_VboNumVerts(surfaceType_t *data) {
+	switch (*data) {
+	case SF_FACE:
+		return ((srfSurfaceFace_t *)data)->numPoints;
+	case SF_GRID:
+		// the whole grid goes in, RB_SurfaceGrid picks the LOD with indexes
+		return ((srfGridMesh_t *)data)->width * ((srfGridMesh_t *)data)->height;
+	case SF_TRIANGLES:
+		return ((srfTriangles_t *)data)->numVerts;
+	default:
+		return 0;
+	}
+}
+
+/*
+=================
+R_VboSetColors
+=================
+*/
+static void R_VboSetColors(vboVertex_t *v, const byte *color) {
+	Com_Memcpy(v->color, color, 4);
+	v->litColor[0] = color[0] * tr.identityLight;
+	v->litColor[1] = color[1] * tr.identityLight;
+	v->litColor[2] = color[2] * tr.identityLight;
+	v->litColor[3] = color[3];
+}
+
+/*
+=================
+R_VboCopyDrawVerts
+=================
+*/
+static void R_VboCopyDrawVerts(vboVertex_t *v, const drawVert_t *dv, int numVerts) {
+	int i;
+
+	for (i = 0; i < numVerts; i++, v++, dv++) {
+		VectorCopy(dv->xyz, v->xyz);
+		v->st[0] = dv->st[0];
+		v->st[1] = dv->st[1];
+		v->lightmap[0] = dv->lightmap[0];
+		v->lightmap[1] = dv->lightmap[1];
+		R_VboSetColors(v, dv->color);
+	}
+}
+
+/*
+=================
+R_VboCopySurface
+=================
+*/
+static void R_VboCopySurface(vboVertex_t *v, surfaceType_t *data) {
+	switch (*data) {
+	case SF_FACE: {
+		srfSurfaceFace_t *face = (srfSurfaceFace_t *)data;
+		float *p;
+		int i;
+
+		for (i = 0, p = face->points[0]; i < face->numPoints; i++, p += VERTEXSIZE, v++) {
+			VectorCopy(p, v->xyz);
+			v->st[0] = p[3];
+			v->st[1] = p[4];
+			v->lightmap[0] = p[5];
+			v->lightmap[1] = p[6];
+			R_VboSetColors(v, (byte *)&p[7]);
+		}
+	} break;
+	case SF_GRID: {
+		srfGridMesh_t *grid = (srfGridMesh_t *)data;
+
+		R_VboCopyDrawVerts(v, grid->verts, grid->width * grid->height);
+	} break;
+	case SF_TRIANGLES: {
+		srfTriangles_t *tri = (srfTriangles_t *)data;
+
+		R_VboCopyDrawVerts(v, tri->verts, tri->numVerts);
+	} break;
+	default:
+		break;
+	}
+}
+
+/*
+=================
+R_BuildWorldVbo
+
+Called at the end of RE_LoadWorldMap, after patch stitching
+=================
+*/
+void R_BuildWorldVbo(void) {
+	world_t *w = tr.world;
+	msurface_t *surf;
+	vboVertex_t *verts;
+	int *firstVertex;
+	int i, numVerts;
+
+	R_ShutdownWorldVbo();
+
+	numVerts = 0;
+	for (i = 0, surf = w->surfaces; i < w->numsurfaces; i++, surf++) {
+		firstVertex = R_VboFirstVertex(surf->data);
+		if (!firstVertex) {
+			continue;
+		}
+
+		*firstVertex = -1;
+		if (!r_vbo->integer || !qglBindBuffer || !surf->shader->staticVbo || surf->fogIndex) {
+			continue;
+		}
+
+		*firstVertex = numVerts;
+		numVerts += R_VboNumVerts(surf->data);
+	}
+
+	if (!numVerts) {
+		return;
+	}
+
+	verts = ri.Hunk_AllocateTempMemory(numVerts * sizeof(*verts));
+
+	for (i = 0, surf = w->surfaces; i < w->numsurfaces; i++, surf++) {
+		firstVertex = R_VboFirstVertex(surf->data);
+		if (firstVertex && *firstVertex >= 0) {
+			R_VboCopySurface(verts + *firstVertex, surf->data);
+		}
+	}
+
+	qglGenBuffers(1, &tr.worldVbo);
+	qglBindBuffer(GL_ARRAY_BUFFER, tr.worldVbo);
+	qglBufferData(GL_ARRAY_BUFFER, numVerts * sizeof(*verts), verts, GL_STATIC_DRAW);
+	qglBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	ri.Hunk_FreeTempMemory(verts);
+
+	ri.Printf(PRINT_DEVELOPER, "world VBO: %i vertexes, %i KB\n", numVerts,
+			  (int)(numVerts * sizeof(*verts) / 1024));
+}
+
+/*
+=================
+R_ShutdownWorldVbo
+=================
+*/
+void R_ShutdownWorldVbo(void) {
+	if (tr.worldVbo) {
+		qglDeleteBuffers(1, &tr.worldVbo);
+		tr.worldVbo = 0;
+	}
+}
@@ -0,0 +1,65 @@
+uniform sampler2D u_DiffuseMap;
+uniform sampler2D u_DlightGridMap;
+
+uniform vec4      u_DlightGridInfo;  // viewport x, y, tiles per pixel x, y
+uniform vec4      u_DlightGridDepth; // znear, slices per log depth, additive pass
+
+uniform vec3      u_ViewOrigin;
+uniform vec3      u_ViewForward;
+
+uniform vec4      u_DlightOrigins[MAX_DLIGHTS]; // origin, 1 / radius
+uniform vec4      u_DlightColors[MAX_DLIGHTS];  // color, additive
+
+varying vec3      var_Position;
+varying vec3      var_Normal;
+
+vec3 CalcDlight(int i)
+{
+	vec3 dist = u_DlightOrigins[i].xyz - var_Position;
+	float scale = u_DlightOrigins[i].w;
+
+	// same falloff as the projected dlight pass
+	vec3 color = texture2D(u_DiffuseMap, dist.xy * scale + vec2(0.5)).rgb;
+	float atten = step(0.0, dot(dist, var_Normal));
+	atten *= clamp(2.0 * (1.0 - abs(dist.z) * scale), 0.0, 1.0);
+
+	return color * u_DlightColors[i].rgb * atten;
+}
+
+void main()
+{
+	vec2 tile = floor((gl_FragCoord.xy - u_DlightGridInfo.xy) * u_DlightGridInfo.zw);
+	tile = clamp(tile, vec2(0.0), vec2(float(DLIGHT_GRID_X - 1), float(DLIGHT_GRID_Y - 1)));
+
+	float depth = max(dot(var_Position - u_ViewOrigin, u_ViewForward), u_DlightGridDepth.x);
+	float slice = min(floor(log(depth / u_DlightGridDepth.x) * u_DlightGridDepth.y), float(DLIGHT_GRID_Z - 1));
+
+	vec2 cell = vec2(tile.x + tile.y * float(DLIGHT_GRID_X), slice) + vec2(0.5);
+	vec4 mask = floor(texture2D(u_DlightGridMap, cell / vec2(float(DLIGHT_GRID_X * DLIGHT_GRID_Y), float(DLIGHT_GRID_Z))) * 255.0 + 0.5);
+
+	vec3 color = vec3(0.0);
+
+	// one byte of light bits per channel
+	for (int c = 0; c < 4; c++)
+	{
+		float bits = mask[c];
+
+		for (int j = 0; j < 8; j++)
+		{
+			if (bits < 1.0)
+				break;
+
+			if (mod(bits, 2.0) > 0.5)
+			{
+				int i = c * 8 + j;
+
+				if (u_DlightColors[i].a == u_DlightGridDepth.z)
+					color += CalcDlight(i);
+			}
+
+			bits = floor(bits * 0.5);
+		}
+	}
+
+	gl_FragColor = vec4(color, 1.0);
+}
@@ -19,7 +19,18 @@ attribute vec4 attr_TexCoord1;
 uniform vec4   u_DiffuseTexMatrix;
 uniform vec4   u_DiffuseTexOffTurb;
 
-#if defined(USE_TCGEN) || defined(USE_RGBAGEN)
+#if defined(USE_INSTANCING)
+uniform mat4   u_InstanceMatrix[MAX_GLSL_INSTANCES];
+uniform mat4   u_InstanceLight[MAX_GLSL_INSTANCES];
+uniform vec3   u_ViewOrigin;
+
+// per entity values come from the instance arrays
+#define u_ModelMatrix      u_InstanceMatrix[gl_InstanceID]
+#define u_AmbientLight     u_InstanceLight[gl_InstanceID][0].xyz
+#define u_DirectedLight    u_InstanceLight[gl_InstanceID][1].xyz
+#define u_ModelLightDir    u_InstanceLight[gl_InstanceID][2].xyz
+#define u_LocalViewOrigin  ((u_ViewOrigin - u_ModelMatrix[3].xyz) * mat3(u_ModelMatrix))
+#elif defined(USE_TCGEN) || defined(USE_RGBAGEN)
 uniform vec3   u_LocalViewOrigin;
 #endif
 
@@ -49,9 +60,11 @@ uniform vec4   u_VertColor;
 #if defined(USE_RGBAGEN)
 uniform int    u_ColorGen;
 uniform int    u_AlphaGen;
+#if !defined(USE_INSTANCING)
 uniform vec3   u_AmbientLight;
 uniform vec3   u_DirectedLight;
 uniform vec3   u_ModelLightDir;
+#endif
 uniform float  u_PortalRange;
 #endif
 
@@ -227,7 +240,11 @@ void main()
 	position = DeformPosition(position, normal, attr_TexCoord0.st);
 #endif
 
+#if defined(USE_INSTANCING)
+	gl_Position = u_ModelViewProjectionMatrix * (u_ModelMatrix * vec4(position, 1.0));
+#else
 	gl_Position = u_ModelViewProjectionMatrix * vec4(position, 1.0);
+#endif
 
 #if defined(USE_TCGEN)
 	vec2 tex = GenTexCoords(u_TCGen0, position, normal, u_TCGen0Vector0, u_TCGen0Vector1);
@@ -25,16 +25,30 @@ attribute vec3 attr_LightDirection;
 uniform vec4   u_EnableTextures; // x = normal, y = deluxe, z = specular, w = cube
 #endif
 
-#if defined(USE_LIGHT) && !defined(USE_FAST_LIGHT)
+#if (defined(USE_LIGHT) && !defined(USE_FAST_LIGHT)) || defined(USE_INSTANCING)
 uniform vec3   u_ViewOrigin;
 #endif
 
+#if defined(USE_INSTANCING)
+uniform mat4   u_InstanceMatrix[MAX_GLSL_INSTANCES];
+uniform mat4   u_InstanceLight[MAX_GLSL_INSTANCES];
+
+// per entity values come from the instance arrays
+#define u_ModelMatrix      u_InstanceMatrix[gl_InstanceID]
+#define u_AmbientLight     u_InstanceLight[gl_InstanceID][0].xyz
+#define u_DirectedLight    u_InstanceLight[gl_InstanceID][1].xyz
+#define u_LightOrigin      u_InstanceLight[gl_InstanceID][3]
+#define u_LocalViewOrigin  ((u_ViewOrigin - u_ModelMatrix[3].xyz) * mat3(u_ModelMatrix))
+#endif
+
 #if defined(USE_TCGEN)
 uniform int    u_TCGen0;
 uniform vec3   u_TCGen0Vector0;
 uniform vec3   u_TCGen0Vector1;
+#if !defined(USE_INSTANCING)
 uniform vec3   u_LocalViewOrigin;
 #endif
+#endif
 
 #if defined(USE_TCMOD)
 uniform vec4   u_DiffuseTexMatrix;
@@ -45,7 +59,7 @@ uniform mat4   u_ModelViewProjectionMatrix;
 uniform vec4   u_BaseColor;
 uniform vec4   u_VertColor;
 
-#if defined(USE_MODELMATRIX)
+#if defined(USE_MODELMATRIX) && !defined(USE_INSTANCING)
 uniform mat4   u_ModelMatrix;
 #endif
 
@@ -56,11 +70,13 @@ uniform mat4 u_BoneMatrix[MAX_GLSL_BONES];
 #endif
 
 #if defined(USE_LIGHT_VECTOR)
-uniform vec4   u_LightOrigin;
 uniform float  u_LightRadius;
+#if !defined(USE_INSTANCING)
+uniform vec4   u_LightOrigin;
 uniform vec3   u_DirectedLight;
 uniform vec3   u_AmbientLight;
 #endif
+#endif
 
 #if defined(USE_PRIMARY_LIGHT) || defined(USE_SHADOWMAP)
 uniform vec4  u_PrimaryLightOrigin;
@@ -188,7 +204,9 @@ void main()
 	var_TexCoords.xy = texCoords;
 #endif
 
+#if !defined(USE_INSTANCING)
 	gl_Position = u_ModelViewProjectionMatrix * vec4(position, 1.0);
+#endif
 
 #if defined(USE_MODELMATRIX)
 	position  = (u_ModelMatrix * vec4(position, 1.0)).xyz;
@@ -198,6 +216,10 @@ void main()
   #endif
 #endif
 
+#if defined(USE_INSTANCING)
+	gl_Position = u_ModelViewProjectionMatrix * vec4(position, 1.0);
+#endif
+
 #if defined(USE_LIGHT) && !defined(USE_FAST_LIGHT)
 	vec3 bitangent = cross(normal, tangent) * attr_Tangent.w;
 #endif
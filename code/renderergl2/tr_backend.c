@@ -24,6 +24,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "tr_dsa.h"
 
 backEndData_t *backEndData;
+backEndData_t *smpBackEndData[SMP_FRAMES];
 backEndState_t backEnd;
 
 static float s_flipMatrix[16] = {
@@ -235,6 +236,86 @@ void GL_SetModelviewMatrix(mat4_t matrix) {
 	Mat4Multiply(glState.projection, glState.modelview, glState.modelviewProjection);
 }
 
+/*
+================
+RB_GpuTimerPhase
+
+Everything the GPU runs until the next phase change is timed as this
+phase.  A phase entered several times in a frame is summed.
+================
+*/
+void RB_GpuTimerPhase(gpuTimerPhase_t phase) {
+	gpuTimerFrame_t *frame = &tr.gpuTimerFrames[tr.gpuTimerFrame];
+
+	if (phase == tr.gpuTimerPhase) {
+		return;
+	}
+
+	if (tr.gpuTimerPhase >= 0) {
+		qglEndQuery(GL_TIME_ELAPSED);
+		tr.gpuTimerPhase = -1;
+	}
+
+	if (!r_gpuTimers->integer || !glRefConfig.timerQuery || frame->numQueries == GPUTIMER_QUERIES) {
+		return;
+	}
+
+	frame->phases[frame->numQueries] = phase;
+	qglBeginQuery(GL_TIME_ELAPSED, frame->queries[frame->numQueries++]);
+	tr.gpuTimerPhase = phase;
+}
+
+/*
+================
+RB_GpuTimerEndFrame
+
+Closes the frame's last query and reads back the oldest frame, whose
+queries are about to be reused.  A frame that hasn't finished on the GPU
+by then is dropped rather than waited for.
+================
+*/
+static void RB_GpuTimerEndFrame(void) {
+	gpuTimerFrame_t *frame;
+	float msec[GPUTIMER_COUNT];
+	GLuint64 elapsed;
+	GLint available;
+	int i;
+
+	if (!glRefConfig.timerQuery) {
+		return;
+	}
+
+	if (tr.gpuTimerPhase >= 0) {
+		qglEndQuery(GL_TIME_ELAPSED);
+		tr.gpuTimerPhase = -1;
+	}
+
+	tr.gpuTimerFrame = (tr.gpuTimerFrame + 1) % GPUTIMER_FRAMES;
+	frame = &tr.gpuTimerFrames[tr.gpuTimerFrame];
+
+	if (!frame->numQueries) {
+		return;
+	}
+
+	// queries finish in order, so the last one covers the frame
+	available = 0;
+	qglGetQueryObjectiv(frame->queries[frame->numQueries - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+
+	if (available) {
+		Com_Memset(msec, 0, sizeof(msec));
+
+		for (i = 0; i < frame->numQueries; i++) {
+			qglGetQueryObjectui64v(frame->queries[i], GL_QUERY_RESULT, &elapsed);
+			msec[frame->phases[i]] += elapsed / 1000000.0f;
+		}
+
+		Com_Memcpy(tr.gpuTimerMsec, msec, sizeof(msec));
+		tr.gpuTimerResults = qtrue;
+	}
+
+	frame->numQueries = 0;
+}
+
 /*
 ================
 RB_Hyperspace
@@ -291,6 +372,9 @@ void RB_BeginDrawingView(void) {
 	// 2D images again
 	backEnd.projection2D = qfalse;
 
+	// the dlight grid depends on the view
+	backEnd.dlightGridBuilt = qfalse;
+
 	if (glRefConfig.framebufferObject) {
 		FBO_t *fbo = backEnd.viewParms.targetFbo;
 
@@ -361,11 +445,171 @@ void RB_BeginDrawingView(void) {
 	}
 }
 
+/*
+==================
+RB_EntitiesShareInstance
+
+Everything the stage iterator reads from backEnd.currentEntity, other
+than the transform and lighting, has to match for two entities to be
+drawn from the same instanced call.
+==================
+*/
+static qboolean RB_EntitiesShareInstance(const trRefEntity_t *a, const trRefEntity_t *b) {
+	if ((a->e.renderfx | b->e.renderfx) & RF_DEPTHHACK)
+		return qfalse;
+
+	// the instance matrices are used as rotations when moving the view origin
+	if (a->e.nonNormalizedAxes || b->e.nonNormalizedAxes || a->mirrored != b->mirrored)
+		return qfalse;
+
+	return a->e.frame == b->e.frame && a->e.oldframe == b->e.oldframe && a->e.backlerp == b->e.backlerp &&
+		   a->e.shaderTime == b->e.shaderTime && *(int *)a->e.shaderRGBA == *(int *)b->e.shaderRGBA &&
+		   a->e.shaderTexCoord[0] == b->e.shaderTexCoord[0] && a->e.shaderTexCoord[1] == b->e.shaderTexCoord[1];
+}
+
+/*
+==================
+RB_CountInstances
+
+Returns how many draw surfaces, starting at drawSurfs, draw the same md3
+surface with the same shader on compatible entities.  Fogged, dlit and
+pshadowed surfaces get extra per entity passes and are never instanced.
+==================
+*/
+static int RB_CountInstances(const drawSurf_t *drawSurfs, int numDrawSurfs, shader_t *shader) {
+	const unsigned entityBits = REFENTITYNUM_MASK << QSORT_REFENTITYNUM_SHIFT;
+	const trRefEntity_t *first;
+	int count;
+
+	// debug views draw with programs that do not read the instance arrays
+	if (!glRefConfig.glslMaxInstances || (backEnd.viewParms.flags & VPF_SHADOWMAP) || r_showtris->integer ||
+		r_shownormals->integer || r_lightmap->integer)
+		return 1;
+
+	if (*drawSurfs->surface != SF_VAO_MDVMESH || (drawSurfs->sort & ((1 << QSORT_REFENTITYNUM_SHIFT) - 1)))
+		return 1;
+
+	if (shader->optimalStageIteratorFunc != RB_StageIteratorGeneric || shader == tr.shadowShader ||
+		shader == tr.projectionShadowShader || ShaderRequiresCPUDeforms(shader))
+		return 1;
+
+	first = &backEnd.refdef.entities[(drawSurfs->sort & entityBits) >> QSORT_REFENTITYNUM_SHIFT];
+
+	for (count = 1; count < numDrawSurfs && count < glRefConfig.glslMaxInstances; count++) {
+		const drawSurf_t *drawSurf = &drawSurfs[count];
+		const trRefEntity_t *ent;
+
+		if (drawSurf->surface != drawSurfs->surface || drawSurf->cubemapIndex != drawSurfs->cubemapIndex ||
+			((drawSurf->sort ^ drawSurfs->sort) & ~entityBits))
+			break;
+
+		ent = &backEnd.refdef.entities[(drawSurf->sort & entityBits) >> QSORT_REFENTITYNUM_SHIFT];
+		if (ent == first || !RB_EntitiesShareInstance(first, ent))
+			break;
+	}
+
+	return count;
+}
+
+/*
+==================
+RB_DrawInstances
+
+Draws the surface once for every entity in the run, with the per entity
+transform and lighting passed to the instanced glsl programs.
+==================
+*/
+static void RB_DrawInstances(const drawSurf_t *drawSurfs, int numInstances) {
+	orientationr_t or;
+	int i;
+
+	for (i = 0; i < numInstances; i++) {
+		trRefEntity_t *ent = &backEnd.refdef.entities[(drawSurfs[i].sort >> QSORT_REFENTITYNUM_SHIFT) &
+													  REFENTITYNUM_MASK];
+		float *light = glState.instanceLight[i];
+
+		R_RotateForEntity(ent, &backEnd.viewParms, &or);
+		Mat4Copy(or.transformMatrix, glState.instanceMatrix[i]);
+
+		// columns: ambient, directed, model space light dir, world space light dir
+		VectorScale(ent->ambientLight, 1.0f / 255.0f, &light[0]);
+		VectorScale(ent->directedLight, 1.0f / 255.0f, &light[4]);
+		VectorCopy(ent->modelLightDir, &light[8]);
+		VectorCopy(ent->lightDir, &light[12]);
+		light[3] = light[7] = light[11] = light[15] = 0.0f;
+	}
+
+	// the model transform comes from the instance matrices
+	backEnd.or = backEnd.viewParms.world;
+	GL_SetModelviewMatrix(backEnd.or.modelMatrix);
+
+	glState.numInstances = numInstances;
+	rb_surfaceTable[*drawSurfs->surface](drawSurfs->surface);
+	RB_EndSurface();
+	glState.numInstances = 0;
+
+	backEnd.pc.c_instancedDraws++;
+	backEnd.pc.c_instancedEntities += numInstances;
+}
+
 /*
 ==================
 RB_RenderDrawSurfList
 ==================
 */
+/*
+=================
+RB_BeginPortalQuery
+
+Counts the samples a batch of portal surfaces passes in the main view, so
+the front end can skip the portal view while they stay hidden. Results are
+only picked up once available, a frame or more later.
+=================
+*/
+static portalQuery_t *RB_BeginPortalQuery(const shader_t *shader) {
+	portalQuery_t *pq, *oldest = NULL;
+	int i;
+
+	if (shader->sort != SS_PORTAL || !glRefConfig.occlusionQuery || !r_portalOcclusion->integer ||
+		backEnd.depthFill || backEnd.viewParms.isPortal || (backEnd.viewParms.flags & (VPF_DEPTHSHADOW | VPF_SHADOWMAP)))
+		return NULL;
+
+	for (i = 0, pq = tr.portalQueries; i < MAX_PORTAL_QUERIES; i++, pq++) {
+		if (pq->shaderIndex == shader->index)
+			break;
+
+		if (!oldest || pq->shaderIndex < 0 || (oldest->shaderIndex >= 0 && pq->queryFrame < oldest->queryFrame))
+			oldest = pq;
+	}
+
+	if (i == MAX_PORTAL_QUERIES) {
+		pq = oldest;
+		pq->shaderIndex = shader->index;
+		pq->active = qfalse;
+		pq->occluded = qfalse;
+	}
+
+	if (pq->active) {
+		GLint available = 0;
+		GLuint sampleCount = 0;
+
+		// don't stall on it, the batch just goes uncounted
+		qglGetQueryObjectiv(pq->query, GL_QUERY_RESULT_AVAILABLE, &available);
+		if (!available)
+			return NULL;
+
+		qglGetQueryObjectuiv(pq->query, GL_QUERY_RESULT, &sampleCount);
+		pq->occluded = !sampleCount;
+		pq->resultFrame = pq->queryFrame;
+	}
+
+	pq->active = qtrue;
+	pq->queryFrame = backEnd.viewParms.frameCount;
+	qglBeginQuery(GL_SAMPLES_PASSED, pq->query);
+
+	return pq;
+}
+
 void RB_RenderDrawSurfList(drawSurf_t *drawSurfs, int numDrawSurfs) {
 	shader_t *shader, *oldShader;
 	int fogNum, oldFogNum;
@@ -379,6 +623,7 @@ void RB_RenderDrawSurfList(drawSurf_t *drawSurfs, int numDrawSurfs) {
 	int oldSort;
 	double originalTime;
 	FBO_t *fbo = NULL;
+	portalQuery_t *portalQuery = NULL;
 
 	// save original time for entity shader offsets
 	originalTime = backEnd.refdef.floatTime;
@@ -423,7 +668,16 @@ void RB_RenderDrawSurfList(drawSurf_t *drawSurfs, int numDrawSurfs) {
 			if (oldShader != NULL) {
 				RB_EndSurface();
 			}
+			if (portalQuery) {
+				qglEndQuery(GL_SAMPLES_PASSED);
+				portalQuery = NULL;
+			}
+			// surfaces are sorted by shader sort, so this switches once
+			if (!backEnd.depthFill && !(backEnd.viewParms.flags & (VPF_DEPTHSHADOW | VPF_SHADOWMAP))) {
+				RB_GpuTimerPhase(shader->sort > SS_OPAQUE ? GPUTIMER_TRANSLUCENT : GPUTIMER_OPAQUE);
+			}
 			RB_BeginSurface(shader, fogNum, cubemapIndex);
+			portalQuery = RB_BeginPortalQuery(shader);
 			backEnd.pc.c_surfBatches++;
 			oldShader = shader;
 			oldFogNum = fogNum;
@@ -516,6 +770,24 @@ void RB_RenderDrawSurfList(drawSurf_t *drawSurfs, int numDrawSurfs) {
 			oldEntityNum = entityNum;
 		}
 
+		// draw a run of the same md3 surface on several entities in one call
+		if (entityNum != REFENTITYNUM_WORLD) {
+			int numInstances = RB_CountInstances(drawSurf, numDrawSurfs - i, shader);
+
+			if (numInstances > 1) {
+				RB_DrawInstances(drawSurf, numInstances);
+				RB_BeginSurface(shader, fogNum, cubemapIndex);
+
+				i += numInstances - 1;
+				drawSurf += numInstances - 1;
+
+				// backEnd.or now holds the world orientation
+				oldEntityNum = -1;
+				oldSort = -1;
+				continue;
+			}
+		}
+
 		// add the triangles for this surface
 		rb_surfaceTable[*drawSurf->surface](drawSurf->surface);
 	}
@@ -526,6 +798,9 @@ void RB_RenderDrawSurfList(drawSurf_t *drawSurfs, int numDrawSurfs) {
 	if (oldShader != NULL) {
 		RB_EndSurface();
 	}
+	if (portalQuery) {
+		qglEndQuery(GL_SAMPLES_PASSED);
+	}
 
 	if (glRefConfig.framebufferObject)
 		FBO_Bind(fbo);
@@ -669,6 +944,8 @@ void RE_UploadCinematic(int w, int h, int cols, int rows, const byte *data, int
 		return;
 	}
 
+	R_SyncRenderThread();
+
 	texture = tr.scratchImage[client]->texnum;
 
 	// if the scratchImage isn't in the format we want, specify it as a new texture
@@ -725,6 +1002,7 @@ const void *RB_StretchPic(const void *data) {
 		FBO_Bind(backEnd.framePostProcessed ? NULL : tr.renderFbo);
 
 	RB_SetGL2D();
+	RB_GpuTimerPhase(GPUTIMER_2D);
 
 	shader = cmd->shader;
 	if (shader != tess.shader) {
@@ -799,7 +1077,7 @@ RB_DrawSurfs
 */
 const void *RB_DrawSurfs(const void *data) {
 	const drawSurfsCommand_t *cmd;
-	qboolean isShadowView;
+	qboolean isShadowView, shadowPass;
 
 	// finish any 2D drawing if needed
 	if (tess.numIndexes) {
@@ -812,6 +1090,9 @@ const void *RB_DrawSurfs(const void *data) {
 	backEnd.viewParms = cmd->viewParms;
 
 	isShadowView = !!(backEnd.viewParms.flags & VPF_DEPTHSHADOW);
+	shadowPass = !!(backEnd.viewParms.flags & (VPF_DEPTHSHADOW | VPF_SHADOWMAP));
+
+	RB_GpuTimerPhase(shadowPass ? GPUTIMER_SHADOWS : GPUTIMER_OPAQUE);
 
 	// clear the z buffer, set the modelview, etc
 	RB_BeginDrawingView();
@@ -827,6 +1108,10 @@ const void *RB_DrawSurfs(const void *data) {
 
 		VectorSet4(viewInfo, backEnd.viewParms.zFar / r_znear->value, backEnd.viewParms.zFar, 0.0, 0.0);
 
+		if (!shadowPass) {
+			RB_GpuTimerPhase(GPUTIMER_DEPTH);
+		}
+
 		backEnd.depthFill = qtrue;
 		qglColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
 		RB_RenderDrawSurfList(cmd->drawSurfs, cmd->numDrawSurfs);
@@ -859,6 +1144,8 @@ const void *RB_DrawSurfs(const void *data) {
 				vec2_t texCoords[4];
 				vec4_t box;
 
+				RB_GpuTimerPhase(GPUTIMER_SUNLIGHT);
+
 				FBO_Bind(tr.screenShadowFbo);
 
 				box[0] = backEnd.viewParms.viewportX * tr.screenShadowFbo->width / (float)glConfig.vidWidth;
@@ -965,6 +1252,20 @@ const void *RB_DrawSurfs(const void *data) {
 			if (r_ssao->integer) {
 				vec4_t quadVerts[4];
 				vec2_t texCoords[4];
+				FBO_t *ssaoFbo;
+				image_t *ssaoImage;
+
+				RB_GpuTimerPhase(GPUTIMER_SSAO);
+
+				// the sample radius stays relative to the quarter size buffer
+				// when the occlusion itself is computed at a lower resolution
+				if (tr.ssaoLowFbo) {
+					ssaoFbo = tr.ssaoLowFbo;
+					ssaoImage = tr.ssaoLowImage;
+				} else {
+					ssaoFbo = tr.quarterFbo[0];
+					ssaoImage = tr.quarterImage[0];
+				}
 
 				viewInfo[2] =
 					1.0f / ((float)(tr.quarterImage[0]->width) * tan(backEnd.viewParms.fovX * M_PI / 360.0f) * 2.0f);
@@ -972,10 +1273,10 @@ const void *RB_DrawSurfs(const void *data) {
 					1.0f / ((float)(tr.quarterImage[0]->height) * tan(backEnd.viewParms.fovY * M_PI / 360.0f) * 2.0f);
 				viewInfo[3] *= (float)backEnd.viewParms.viewportHeight / (float)backEnd.viewParms.viewportWidth;
 
-				FBO_Bind(tr.quarterFbo[0]);
+				FBO_Bind(ssaoFbo);
 
-				qglViewport(0, 0, tr.quarterFbo[0]->width, tr.quarterFbo[0]->height);
-				qglScissor(0, 0, tr.quarterFbo[0]->width, tr.quarterFbo[0]->height);
+				qglViewport(0, 0, ssaoFbo->width, ssaoFbo->height);
+				qglScissor(0, 0, ssaoFbo->width, ssaoFbo->height);
 
 				VectorSet4(quadVerts[0], -1, 1, 0, 1);
 				VectorSet4(quadVerts[1], 1, 1, 0, 1);
@@ -1011,7 +1312,7 @@ const void *RB_DrawSurfs(const void *data) {
 
 				GLSL_BindProgram(&tr.depthBlurShader[0]);
 
-				GL_BindToTMU(tr.quarterImage[0], TB_COLORMAP);
+				GL_BindToTMU(ssaoImage, TB_COLORMAP);
 				GL_BindToTMU(tr.hdrDepthImage, TB_LIGHTMAP);
 
 				GLSL_SetUniformVec4(&tr.depthBlurShader[0], UNIFORM_VIEWINFO, viewInfo);
@@ -1294,6 +1595,8 @@ const void *RB_SwapBuffers(const void *data) {
 		qglFinish();
 	}
 
+	RB_GpuTimerEndFrame();
+
 	GLimp_LogComment("***************** RB_SwapBuffers *****************\n\n\n");
 
 	GLimp_EndFrame();
@@ -1317,6 +1620,8 @@ const void *RB_CapShadowMap(const void *data) {
 	if (tess.numIndexes)
 		RB_EndSurface();
 
+	RB_GpuTimerPhase(GPUTIMER_SHADOWS);
+
 	if (cmd->map != -1) {
 		if (cmd->cubeSide != -1) {
 			if (tr.shadowCubemaps[cmd->map]) {
@@ -1358,6 +1663,8 @@ const void *RB_PostProcess(const void *data) {
 		return (const void *)(cmd + 1);
 	}
 
+	RB_GpuTimerPhase(GPUTIMER_POSTPROCESS);
+
 	if (cmd) {
 		backEnd.refdef = cmd->refdef;
 		backEnd.viewParms = cmd->viewParms;
@@ -1574,12 +1881,21 @@ const void *RB_ExportCubemaps(const void *data) {
 			cubemap_t *cubemap = &tr.cubemaps[i];
 			byte *p = cubemapPixels;
 
+			if (cmd->toCache && (!cubemap->baked || !R_CubemapCacheName(i, filename, sizeof(filename))))
+				continue;
+
 			for (j = 0; j < 6; j++) {
 				FBO_AttachImage(tr.renderCubeFbo, cubemap->image, GL_COLOR_ATTACHMENT0_EXT, j);
 				qglReadPixels(0, 0, r_cubemapSize->integer, r_cubemapSize->integer, GL_RGBA, GL_UNSIGNED_BYTE, p);
 				p += sideSize;
 			}
 
+			if (cmd->toCache) {
+				R_SaveDDS(filename, cubemapPixels, r_cubemapSize->integer, r_cubemapSize->integer, 6);
+				ri.Printf(PRINT_DEVELOPER, "cached cubemap %d as %s\n", i, filename);
+				continue;
+			}
+
 			if (cubemap->name[0]) {
 				COM_StripExtension(cubemap->name, filename, MAX_QPATH);
 				Q_strcat(filename, MAX_QPATH, ".dds");
@@ -1601,10 +1917,10 @@ const void *RB_ExportCubemaps(const void *data) {
 
 /*
 ====================
-RB_ExecuteRenderCommands
+RB_ExecuteCommandList
 ====================
 */
-void RB_ExecuteRenderCommands(const void *data) {
+static void RB_ExecuteCommandList(const void *data) {
 	int t1, t2;
 
 	t1 = ri.Milliseconds();
@@ -1662,3 +1978,38 @@ void RB_ExecuteRenderCommands(const void *data) {
 		}
 	}
 }
+
+/*
+====================
+RB_ExecuteRenderCommands
+====================
+*/
+void RB_ExecuteRenderCommands(const void *data) {
+	ri.ProfileBegin("RB_ExecuteRenderCommands");
+	RB_ExecuteCommandList(data);
+	ri.ProfileEnd();
+}
+
+/*
+====================
+RB_RenderThread
+
+Draws the frames handed over by R_IssueRenderCommands when r_smp is on.
+The profiler only keeps zones for the main thread and the job workers,
+so nothing is recorded here.
+====================
+*/
+void RB_RenderThread(void) {
+	const void *data;
+
+	while (1) {
+		// sleep until we have work to do
+		data = GLimp_RendererSleep();
+
+		if (!data) {
+			return; // all done, renderer is shutting down
+		}
+
+		RB_ExecuteCommandList(data);
+	}
+}
@@ -1978,6 +1978,12 @@ static void R_LoadShaders(lump_t *l) {
 		out[i].surfaceFlags = LittleLong(out[i].surfaceFlags);
 		out[i].contentFlags = LittleLong(out[i].contentFlags);
 	}
+
+	// decode their images on the job threads while the surfaces load the shaders
+	for (i = 0; i < count; i++) {
+		R_QueueShaderImages(out[i].shader);
+	}
+	R_PrefetchImages();
 }
 
 /*
@@ -1998,6 +2004,7 @@ static void R_LoadMarksurfaces(lump_t *l) {
 
 	s_worldData.marksurfaces = out;
 	s_worldData.nummarksurfaces = count;
+	s_worldData.viewSurfaces = out;
 
 	for (i = 0; i < count; i++) {
 		j = LittleLong(in[i]);
@@ -2587,6 +2594,36 @@ void R_AssignCubemapsToWorldSurfaces(void) {
 	}
 }
 
+/*
+=================
+R_CubemapCacheName
+
+Where a cubemap rendered at load is saved, so that the next load of the
+same bsp with the same settings can skip rendering it.
+=================
+*/
+qboolean R_CubemapCacheName(int cubemapIndex, char *cacheName, int cacheNameSize) {
+	unsigned int tag = 2166136261u;
+	const char *settings;
+	int i;
+
+	if (!r_cubemapCache->integer || !tr.world)
+		return qfalse;
+
+	// FNV-1a over everything that changes what ends up in the cubemaps
+	settings = va("%d %d %d %d %d %d %d %d %d %g %g %d", r_cubeMapping->integer, r_cubemapSize->integer,
+				  r_hdr->integer, r_pbr->integer, r_normalMapping->integer, r_specularMapping->integer,
+				  r_deluxeMapping->integer, r_sunlightMode->integer, r_mapOverBrightBits->integer,
+				  r_baseSpecular->value, r_baseGloss->value, r_glossType->integer);
+
+	for (i = 0; settings[i]; i++)
+		tag = (tag ^ (byte)settings[i]) * 16777619u;
+
+	Com_sprintf(cacheName, cacheNameSize, "cubecache/%s-%08x-%08x/%03d.dds", tr.world->baseName, tr.world->checksum,
+				tag, cubemapIndex);
+	return qtrue;
+}
+
 void R_LoadCubemaps(void) {
 	int i;
 	imgFlags_t flags = IMGFLAG_CLAMPTOEDGE | IMGFLAG_MIPMAP | IMGFLAG_NOLIGHTSCALE | IMGFLAG_CUBEMAP;
@@ -2598,11 +2635,15 @@ void R_LoadCubemaps(void) {
 		Com_sprintf(filename, MAX_QPATH, "cubemaps/%s/%03d.dds", tr.world->baseName, i);
 
 		cubemap->image = R_FindImageFile(filename, IMGTYPE_COLORALPHA, flags);
+
+		if (!cubemap->image && R_CubemapCacheName(i, filename, sizeof(filename)))
+			cubemap->image = R_FindImageFile(filename, IMGTYPE_COLORALPHA, flags);
 	}
 }
 
 void R_RenderMissingCubemaps(void) {
 	int i, j;
+	int numBaked = 0;
 	imgFlags_t flags =
 		IMGFLAG_NO_COMPRESSION | IMGFLAG_CLAMPTOEDGE | IMGFLAG_MIPMAP | IMGFLAG_NOLIGHTSCALE | IMGFLAG_CUBEMAP;
 
@@ -2617,6 +2658,21 @@ void R_RenderMissingCubemaps(void) {
 				R_IssuePendingRenderCommands();
 				R_InitNextFrame();
 			}
+
+			tr.cubemaps[i].baked = qtrue;
+			numBaked++;
+		}
+	}
+
+	// save them for the next load
+	if (numBaked && r_cubemapCache->integer) {
+		exportCubemapsCommand_t *cmd = R_GetCommandBuffer(sizeof(*cmd));
+
+		if (cmd) {
+			cmd->commandId = RC_EXPORT_CUBEMAPS;
+			cmd->toCache = qtrue;
+			R_IssuePendingRenderCommands();
+			R_InitNextFrame();
 		}
 	}
 }
@@ -2650,6 +2706,237 @@ void R_CalcVertexLightDirs(void) {
 	}
 }
 
+/*
+=================
+R_MergeLeafSurfaces
+
+Faces and triangle soups of one cluster that share shader, fog and cubemap
+are copied into a single triangle surface, so that a visible cluster adds a
+few large draw surfaces instead of many small ones.  Each surface is merged
+at most once, with the first cluster found containing it.
+=================
+*/
+#define MAX_MERGED_VERTEXES (SHADER_MAX_VERTEXES - 1) // still fits tess if the VAO cache can't take it
+#define MAX_MERGED_INDEXES (SHADER_MAX_INDEXES - 1)
+
+static qboolean R_IsMergeableSurface(const msurface_t *surf) {
+	const shader_t *shader = surf->shader;
+
+	if (*surf->data != SF_FACE && *surf->data != SF_TRIANGLES) {
+		return qfalse;
+	}
+
+	if (shader->isSky || shader->isPortal || ShaderRequiresCPUDeforms(shader)) {
+		return qfalse;
+	}
+
+	return ((srfBspSurface_t *)surf->data)->numIndexes > 0;
+}
+
+static int R_CompareMergeSurfaces(const void *a, const void *b) {
+	const msurface_t *s1 = s_worldData.surfaces + *(const int *)a;
+	const msurface_t *s2 = s_worldData.surfaces + *(const int *)b;
+
+	if (s1->shader->index != s2->shader->index) {
+		return s1->shader->index - s2->shader->index;
+	}
+
+	if (s1->fogIndex != s2->fogIndex) {
+		return s1->fogIndex - s2->fogIndex;
+	}
+
+	if (s1->cubemapIndex != s2->cubemapIndex) {
+		return s1->cubemapIndex - s2->cubemapIndex;
+	}
+
+	return *(const int *)a - *(const int *)b;
+}
+
+static void R_BuildMergedSurface(msurface_t *merged, const int *surfNums, int numSurfs, int numVerts,
+								 int numIndexes) {
+	srfBspSurface_t *out;
+	srfVert_t *verts;
+	glIndex_t *indexes;
+	int i, j;
+
+	out = ri.Hunk_Alloc(sizeof(*out), h_low);
+	out->surfaceType = SF_TRIANGLES;
+	out->numVerts = numVerts;
+	out->verts = verts = ri.Hunk_Alloc(numVerts * sizeof(*out->verts), h_low);
+	out->numIndexes = numIndexes;
+	out->indexes = indexes = ri.Hunk_Alloc(numIndexes * sizeof(*out->indexes), h_low);
+
+	ClearBounds(out->cullBounds[0], out->cullBounds[1]);
+
+	numVerts = 0;
+	for (i = 0; i < numSurfs; i++) {
+		const srfBspSurface_t *in = (srfBspSurface_t *)s_worldData.surfaces[surfNums[i]].data;
+
+		Com_Memcpy(verts, in->verts, in->numVerts * sizeof(*verts));
+		for (j = 0; j < in->numVerts; j++) {
+			AddPointToBounds(verts[j].xyz, out->cullBounds[0], out->cullBounds[1]);
+		}
+
+		for (j = 0; j < in->numIndexes; j++) {
+			*indexes++ = in->indexes[j] + numVerts;
+		}
+
+		verts += in->numVerts;
+		numVerts += in->numVerts;
+	}
+
+	VectorAdd(out->cullBounds[0], out->cullBounds[1], out->cullOrigin);
+	VectorScale(out->cullOrigin, 0.5f, out->cullOrigin);
+	out->cullRadius = RadiusFromBounds(out->cullBounds[0], out->cullBounds[1]);
+
+	merged->shader = s_worldData.surfaces[surfNums[0]].shader;
+	merged->fogIndex = s_worldData.surfaces[surfNums[0]].fogIndex;
+	merged->cubemapIndex = s_worldData.surfaces[surfNums[0]].cubemapIndex;
+	merged->cullinfo.type = CULLINFO_BOX;
+	VectorCopy(out->cullBounds[0], merged->cullinfo.bounds[0]);
+	VectorCopy(out->cullBounds[1], merged->cullinfo.bounds[1]);
+	merged->data = (surfaceType_t *)out;
+}
+
+static void R_MergeLeafSurfaces(void) {
+	mnode_t *leafs;
+	int numLeafs;
+	int *clusterLeafs, *clusterFirst;
+	int *mergedIndex, *candidates;
+	msurface_t *merged;
+	int numMerged, numMergedFrom;
+	int cluster, i, j, k;
+
+	if (!s_worldData.numClusters || !s_worldData.numWorldSurfaces) {
+		return;
+	}
+
+	leafs = s_worldData.nodes + s_worldData.numDecisionNodes;
+	numLeafs = s_worldData.numnodes - s_worldData.numDecisionNodes;
+
+	// bucket the leafs by cluster
+	clusterFirst = ri.Malloc((s_worldData.numClusters + 1) * sizeof(*clusterFirst));
+	clusterLeafs = ri.Malloc(numLeafs * sizeof(*clusterLeafs));
+	Com_Memset(clusterFirst, 0, (s_worldData.numClusters + 1) * sizeof(*clusterFirst));
+
+	for (i = 0; i < numLeafs; i++) {
+		if (leafs[i].cluster >= 0 && leafs[i].cluster < s_worldData.numClusters) {
+			clusterFirst[leafs[i].cluster]++;
+		}
+	}
+	for (i = 1; i <= s_worldData.numClusters; i++) {
+		clusterFirst[i] += clusterFirst[i - 1];
+	}
+	for (i = numLeafs - 1; i >= 0; i--) {
+		if (leafs[i].cluster >= 0 && leafs[i].cluster < s_worldData.numClusters) {
+			clusterLeafs[--clusterFirst[leafs[i].cluster]] = i;
+		}
+	}
+
+	mergedIndex = ri.Malloc(s_worldData.numWorldSurfaces * sizeof(*mergedIndex));
+	candidates = ri.Malloc(s_worldData.numWorldSurfaces * sizeof(*candidates));
+	merged = ri.Malloc((s_worldData.numWorldSurfaces / 2 + 1) * sizeof(*merged));
+
+	for (i = 0; i < s_worldData.numWorldSurfaces; i++) {
+		mergedIndex[i] = R_IsMergeableSurface(s_worldData.surfaces + i) ? -1 : -2;
+	}
+
+	numMerged = 0;
+	numMergedFrom = 0;
+
+	for (cluster = 0; cluster < s_worldData.numClusters; cluster++) {
+		int numCandidates = 0;
+
+		// collect the surfaces of the cluster not taken by another one yet
+		for (i = clusterFirst[cluster]; i < clusterFirst[cluster + 1]; i++) {
+			const mnode_t *leaf = leafs + clusterLeafs[i];
+
+			for (j = 0; j < leaf->nummarksurfaces; j++) {
+				int surfNum = s_worldData.marksurfaces[leaf->firstmarksurface + j];
+
+				if (surfNum < 0 || surfNum >= s_worldData.numWorldSurfaces || mergedIndex[surfNum] != -1) {
+					continue;
+				}
+
+				mergedIndex[surfNum] = -3;
+				candidates[numCandidates++] = surfNum;
+			}
+		}
+
+		qsort(candidates, numCandidates, sizeof(*candidates), R_CompareMergeSurfaces);
+
+		// merge runs of matching surfaces, splitting them where they get too big
+		for (i = 0; i < numCandidates; i = k) {
+			const msurface_t *first = s_worldData.surfaces + candidates[i];
+			int numVerts = 0, numIndexes = 0;
+
+			for (k = i; k < numCandidates; k++) {
+				const msurface_t *surf = s_worldData.surfaces + candidates[k];
+				const srfBspSurface_t *srf = (srfBspSurface_t *)surf->data;
+
+				if (surf->shader != first->shader || surf->fogIndex != first->fogIndex ||
+					surf->cubemapIndex != first->cubemapIndex) {
+					break;
+				}
+
+				if (numVerts + srf->numVerts > MAX_MERGED_VERTEXES ||
+					numIndexes + srf->numIndexes > MAX_MERGED_INDEXES) {
+					break;
+				}
+
+				numVerts += srf->numVerts;
+				numIndexes += srf->numIndexes;
+			}
+
+			// a surface too big to share, or one on its own, stays as it is
+			if (k - i < 2) {
+				k = MAX(k, i + 1);
+				continue;
+			}
+
+			R_BuildMergedSurface(merged + numMerged, candidates + i, k - i, numVerts, numIndexes);
+
+			for (j = i; j < k; j++) {
+				mergedIndex[candidates[j]] = numMerged;
+			}
+
+			numMergedFrom += k - i;
+			numMerged++;
+		}
+	}
+
+	if (numMerged) {
+		s_worldData.numMergedSurfaces = numMerged;
+		s_worldData.mergedSurfaces = ri.Hunk_Alloc(numMerged * sizeof(*s_worldData.mergedSurfaces), h_low);
+		s_worldData.mergedSurfacesViewCount =
+			ri.Hunk_Alloc(numMerged * sizeof(*s_worldData.mergedSurfacesViewCount), h_low);
+		s_worldData.mergedSurfacesDlightBits =
+			ri.Hunk_Alloc(numMerged * sizeof(*s_worldData.mergedSurfacesDlightBits), h_low);
+		s_worldData.mergedSurfacesPshadowBits =
+			ri.Hunk_Alloc(numMerged * sizeof(*s_worldData.mergedSurfacesPshadowBits), h_low);
+		Com_Memcpy(s_worldData.mergedSurfaces, merged, numMerged * sizeof(*merged));
+
+		s_worldData.viewSurfaces = ri.Hunk_Alloc(s_worldData.nummarksurfaces * sizeof(int), h_low);
+		for (i = 0; i < s_worldData.nummarksurfaces; i++) {
+			int surfNum = s_worldData.marksurfaces[i];
+
+			if (surfNum >= 0 && surfNum < s_worldData.numWorldSurfaces && mergedIndex[surfNum] >= 0) {
+				s_worldData.viewSurfaces[i] = -1 - mergedIndex[surfNum];
+			} else {
+				s_worldData.viewSurfaces[i] = surfNum;
+			}
+		}
+	}
+
+	ri.Free(merged);
+	ri.Free(candidates);
+	ri.Free(mergedIndex);
+	ri.Free(clusterLeafs);
+	ri.Free(clusterFirst);
+
+	ri.Printf(PRINT_ALL, "...merged %d world surfaces into %d\n", numMergedFrom, numMerged);
+}
+
 /*
 =================
 RE_LoadWorldMap
@@ -2664,6 +2951,7 @@ void RE_LoadWorldMap(const char *name) {
 		byte *b;
 		void *v;
 	} buffer;
+	int bufferLength;
 	byte *startMarker;
 
 	if (tr.worldMapLoaded) {
@@ -2697,7 +2985,7 @@ void RE_LoadWorldMap(const char *name) {
 
 	// load it
 	buffer.v = NULL;
-	ri.FS_ReadFile(name, &buffer.v);
+	bufferLength = ri.FS_ReadFile(name, &buffer.v);
 	if (!buffer.b) {
 		ri.Error(ERR_DROP, "RE_LoadWorldMap: %s not found", name);
 	}
@@ -2712,6 +3000,14 @@ void RE_LoadWorldMap(const char *name) {
 	Q_strncpyz(s_worldData.baseName, COM_SkipPath(s_worldData.name), sizeof(s_worldData.name));
 	COM_StripExtension(s_worldData.baseName, s_worldData.baseName, sizeof(s_worldData.baseName));
 
+	// FNV-1a over the whole file in words, keys the cubemap cache
+	s_worldData.checksum = 2166136261u;
+	for (i = 0; i + 4 <= bufferLength; i += 4) {
+		const byte *p = buffer.b + i;
+		s_worldData.checksum =
+			(s_worldData.checksum ^ (p[0] | p[1] << 8 | p[2] << 16 | (unsigned int)p[3] << 24)) * 16777619u;
+	}
+
 	startMarker = ri.Hunk_Alloc(0, h_low);
 	c_gridVerts = 0;
 
@@ -2931,6 +3227,19 @@ void RE_LoadWorldMap(const char *name) {
 		}
 	}
 
+	// merge after the cubemaps are assigned, they are part of the batch
+	if (r_mergeLeafSurfaces->integer) {
+		R_MergeLeafSurfaces();
+	}
+
+	// scratch for culling the world of shadow views on the job threads
+	{
+		int count = (s_worldData.numsurfaces + s_worldData.numMergedSurfaces) * MAX_SHADOW_VIEWS;
+
+		s_worldData.shadowViewCounts = ri.Hunk_Alloc(count * sizeof(*s_worldData.shadowViewCounts), h_low);
+		s_worldData.shadowViewSurfaces = ri.Hunk_Alloc(count * sizeof(*s_worldData.shadowViewSurfaces), h_low);
+	}
+
 	s_worldData.dataSize = (byte *)ri.Hunk_Alloc(0, h_low) - startMarker;
 
 	// only set tr.world now that we know the entire level has loaded properly
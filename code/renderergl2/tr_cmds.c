@@ -27,6 +27,21 @@ R_PerformanceCounters
 =====================
 */
 void R_PerformanceCounters(void) {
+	static const char *gpuTimerNames[GPUTIMER_COUNT] = {
+		"gpu shadows", "gpu depth", "gpu sunlight", "gpu ssao",
+		"gpu opaque", "gpu translucent", "gpu postprocess", "gpu 2d",
+	};
+	float gpuTotal;
+	int i;
+
+	// gpu timings arrive a few frames late; hand each set to profile_capture once
+	if (tr.gpuTimerResults) {
+		for (i = 0; i < GPUTIMER_COUNT; i++) {
+			ri.ProfileCounter(gpuTimerNames[i], tr.gpuTimerMsec[i]);
+		}
+		tr.gpuTimerResults = qfalse;
+	}
+
 	if (!r_speeds->integer) {
 		// clear the counters even if we aren't printing
 		Com_Memset(&tr.pc, 0, sizeof(tr.pc));
@@ -65,6 +80,24 @@ void R_PerformanceCounters(void) {
 		ri.Printf(PRINT_ALL, "GLSL binds: %i  draws: gen %i light %i fog %i dlight %i\n", backEnd.pc.c_glslShaderBinds,
 				  backEnd.pc.c_genericDraws, backEnd.pc.c_lightallDraws, backEnd.pc.c_fogDraws,
 				  backEnd.pc.c_dlightDraws);
+		ri.Printf(PRINT_ALL, "instanced draws: %i entities %i\n", backEnd.pc.c_instancedDraws,
+				  backEnd.pc.c_instancedEntities);
+	} else if (r_speeds->integer == 8) {
+		if (!r_gpuTimers->integer || !glRefConfig.timerQuery) {
+			ri.Printf(PRINT_ALL, "gpu timers need r_gpuTimers 1 and GL_ARB_timer_query\n");
+		} else {
+			gpuTotal = 0;
+			for (i = 0; i < GPUTIMER_COUNT; i++) {
+				gpuTotal += tr.gpuTimerMsec[i];
+			}
+			ri.Printf(PRINT_ALL,
+					  "gpu msec: shadows %.2f depth %.2f sun %.2f ssao %.2f opaque %.2f trans %.2f post %.2f 2d %.2f "
+					  "total %.2f\n",
+					  tr.gpuTimerMsec[GPUTIMER_SHADOWS], tr.gpuTimerMsec[GPUTIMER_DEPTH],
+					  tr.gpuTimerMsec[GPUTIMER_SUNLIGHT], tr.gpuTimerMsec[GPUTIMER_SSAO],
+					  tr.gpuTimerMsec[GPUTIMER_OPAQUE], tr.gpuTimerMsec[GPUTIMER_TRANSLUCENT],
+					  tr.gpuTimerMsec[GPUTIMER_POSTPROCESS], tr.gpuTimerMsec[GPUTIMER_2D], gpuTotal);
+		}
 	}
 
 	Com_Memset(&tr.pc, 0, sizeof(tr.pc));
@@ -74,6 +107,9 @@ void R_PerformanceCounters(void) {
 /*
 ====================
 R_IssueRenderCommands
+
+runPerformanceCounters is only set at the end of a frame, which is the
+only time the commands go to the render thread
 ====================
 */
 void R_IssueRenderCommands(qboolean runPerformanceCounters) {
@@ -87,14 +123,35 @@ void R_IssueRenderCommands(qboolean runPerformanceCounters) {
 	// clear it out, in case this is a sync and not a buffer flip
 	cmdList->used = 0;
 
+	if (glConfig.smpActive) {
+		// sleep until the render thread has finished the last frame
+		R_SyncRenderThread();
+
+		if (runPerformanceCounters) {
+			tr.smpBackEndMsec = backEnd.pc.msec;
+		}
+	}
+
 	if (runPerformanceCounters) {
 		R_PerformanceCounters();
 	}
 
 	// actually start the commands going
 	if (!r_skipBackEnd->integer) {
-		// let it start on the new batch
-		RB_ExecuteRenderCommands(cmdList->cmds);
+		if (glConfig.smpActive && runPerformanceCounters && !tr.smpSyncFrame) {
+			// let it start on the new batch while the next frame is
+			// built in the other buffer
+			GLimp_WakeRenderer(cmdList->cmds);
+
+			tr.smpFrame ^= 1;
+			backEndData = smpBackEndData[tr.smpFrame];
+		} else {
+			RB_ExecuteRenderCommands(cmdList->cmds);
+		}
+	}
+
+	if (runPerformanceCounters) {
+		tr.smpSyncFrame = qfalse;
 	}
 }
 
@@ -112,6 +169,22 @@ void R_IssuePendingRenderCommands(void) {
 	R_IssueRenderCommands(qfalse);
 }
 
+/*
+====================
+R_SyncRenderThread
+
+Waits for the render thread to finish its frame, so the front end has the
+GL context and may change state the back end reads.  Pending commands stay
+queued.
+====================
+*/
+void R_SyncRenderThread(void) {
+	if (!glConfig.smpActive) {
+		return;
+	}
+	GLimp_FrontEndSleep();
+}
+
 /*
 ============
 R_GetCommandBufferReserved
@@ -339,6 +412,9 @@ void RE_BeginFrame(stereoFrame_t stereoFrame) {
 		} else {
 			R_IssuePendingRenderCommands();
 			qglEnable(GL_STENCIL_TEST);
+
+			// the stencil readback uses hunk temp memory
+			tr.smpSyncFrame = qtrue;
 			qglStencilMask(~0U);
 			qglClearStencil(0U);
 			qglStencilFunc(GL_ALWAYS, 0U, ~0U);
@@ -398,6 +474,8 @@ void RE_BeginFrame(stereoFrame_t stereoFrame) {
 	} else {
 		if (r_anaglyphMode->integer) {
 			if (r_anaglyphMode->modified) {
+				R_SyncRenderThread();
+
 				// clear both, front and backbuffer.
 				qglColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
 				backEnd.colorMask[0] = GL_FALSE;
@@ -461,6 +539,7 @@ void RE_BeginFrame(stereoFrame_t stereoFrame) {
 			cmd->commandId = RC_DRAW_BUFFER;
 
 			if (r_anaglyphMode->modified) {
+				R_SyncRenderThread();
 				qglColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
 				backEnd.colorMask[0] = 0;
 				backEnd.colorMask[1] = 0;
@@ -506,10 +585,17 @@ void RE_EndFrame(int *frontEndMsec, int *backEndMsec) {
 		*frontEndMsec = tr.frontEndMsec;
 	}
 	tr.frontEndMsec = 0;
-	if (backEndMsec) {
-		*backEndMsec = backEnd.pc.msec;
+	if (glConfig.smpActive) {
+		// this frame is still being drawn
+		if (backEndMsec) {
+			*backEndMsec = tr.smpBackEndMsec;
+		}
+	} else {
+		if (backEndMsec) {
+			*backEndMsec = backEnd.pc.msec;
+		}
+		backEnd.pc.msec = 0;
 	}
-	backEnd.pc.msec = 0;
 }
 
 /*
@@ -531,9 +617,29 @@ void RE_TakeVideoFrame(int width, int height, byte *captureBuffer, byte *encodeB
 
 	cmd->commandId = RC_VIDEOFRAME;
 
+	// the capture is written out by the back end
+	tr.smpSyncFrame = qtrue;
+
 	cmd->width = width;
 	cmd->height = height;
 	cmd->captureBuffer = captureBuffer;
 	cmd->encodeBuffer = encodeBuffer;
 	cmd->motionJpeg = motionJpeg;
 }
+
+/*
+==================
+RE_FinishVideoFrames
+
+Called before the client closes the video file
+==================
+*/
+void RE_FinishVideoFrames(void) {
+	if (!tr.registered || !glRefConfig.asyncReadback) {
+		return;
+	}
+
+	// the ring is only touched by whoever holds the context
+	R_IssuePendingRenderCommands();
+	RB_FinishVideoFrames();
+}
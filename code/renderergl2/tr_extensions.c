@@ -94,6 +94,96 @@ void GLimp_InitExtraExtensions(void) {
 		ri.Printf(PRINT_ALL, result[2], extension);
 	}
 
+	// OpenGL 3.1 - GL_ARB_draw_instanced
+	extension = "GL_ARB_draw_instanced";
+	glRefConfig.drawInstanced = qfalse;
+	if (QGL_VERSION_ATLEAST(3, 1) || SDL_GL_ExtensionSupported(extension)) {
+		glRefConfig.drawInstanced = !!r_arb_draw_instanced->integer;
+
+		QGL_ARB_draw_instanced_PROCS;
+
+		// extension only exports the ARB suffixed entry point
+		if (!qglDrawElementsInstanced)
+			qglDrawElementsInstanced =
+				(DrawElementsInstancedproc *)SDL_GL_GetProcAddress("glDrawElementsInstancedARB");
+
+		if (!qglDrawElementsInstanced)
+			glRefConfig.drawInstanced = qfalse;
+
+		ri.Printf(PRINT_ALL, result[glRefConfig.drawInstanced], extension);
+	} else {
+		ri.Printf(PRINT_ALL, result[2], extension);
+	}
+
+	// OpenGL 3.3 - GL_ARB_timer_query
+	extension = "GL_ARB_timer_query";
+	glRefConfig.timerQuery = qfalse;
+	if (QGL_VERSION_ATLEAST(3, 3) || SDL_GL_ExtensionSupported(extension)) {
+		QGL_ARB_timer_query_PROCS;
+
+		glRefConfig.timerQuery = qglGetQueryObjectui64v != NULL;
+
+		ri.Printf(PRINT_ALL, result[glRefConfig.timerQuery], extension);
+	} else {
+		ri.Printf(PRINT_ALL, result[2], extension);
+	}
+
+	// OpenGL 4.1 - GL_ARB_get_program_binary
+	extension = "GL_ARB_get_program_binary";
+	glRefConfig.programBinary = qfalse;
+	if (QGL_VERSION_ATLEAST(4, 1) || SDL_GL_ExtensionSupported(extension)) {
+		GLint numFormats = 0;
+
+		QGL_ARB_get_program_binary_PROCS;
+
+		// some drivers expose the entry points but no binary formats
+		qglGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numFormats);
+
+		glRefConfig.programBinary = r_arb_get_program_binary->integer && numFormats > 0 && qglGetProgramBinary &&
+									qglProgramBinary && qglProgramParameteri;
+
+		ri.Printf(PRINT_ALL, result[glRefConfig.programBinary], extension);
+	} else {
+		ri.Printf(PRINT_ALL, result[2], extension);
+	}
+
+	// GL_ARB_parallel_shader_compile, or the identical KHR version
+	extension = "GL_ARB_parallel_shader_compile";
+	glRefConfig.parallelShaderCompile = qfalse;
+	if (SDL_GL_ExtensionSupported(extension) || SDL_GL_ExtensionSupported("GL_KHR_parallel_shader_compile")) {
+		QGL_ARB_parallel_shader_compile_PROCS;
+
+		if (!qglMaxShaderCompilerThreadsARB)
+			qglMaxShaderCompilerThreadsARB =
+				(MaxShaderCompilerThreadsARBproc *)SDL_GL_GetProcAddress("glMaxShaderCompilerThreadsKHR");
+
+		glRefConfig.parallelShaderCompile = !!r_arb_parallel_shader_compile->integer;
+
+		// let the driver pick the number of compiler threads
+		if (glRefConfig.parallelShaderCompile && qglMaxShaderCompilerThreadsARB)
+			qglMaxShaderCompilerThreadsARB(0xFFFFFFFF);
+
+		ri.Printf(PRINT_ALL, result[glRefConfig.parallelShaderCompile], extension);
+	} else {
+		ri.Printf(PRINT_ALL, result[2], extension);
+	}
+
+	// OpenGL 3.2 - GL_ARB_sync, with GL_ARB_map_buffer_range for reading back pixel pack buffers
+	extension = "GL_ARB_sync";
+	glRefConfig.asyncReadback = qfalse;
+	if ((q_gl_version_at_least_3_2 || SDL_GL_ExtensionSupported(extension)) &&
+		(q_gl_version_at_least_3_0 || SDL_GL_ExtensionSupported("GL_ARB_map_buffer_range"))) {
+		QGL_ARB_sync_PROCS;
+		QGL_ARB_map_buffer_range_PROCS;
+
+		glRefConfig.asyncReadback = qglFenceSync && qglClientWaitSync && qglDeleteSync && qglMapBufferRange &&
+									qglUnmapBuffer;
+
+		ri.Printf(PRINT_ALL, result[glRefConfig.asyncReadback], extension);
+	} else {
+		ri.Printf(PRINT_ALL, result[2], extension);
+	}
+
 	// OpenGL 3.0 - GL_ARB_texture_float
 	extension = "GL_ARB_texture_float";
 	glRefConfig.textureFloat = qfalse;
@@ -367,6 +367,12 @@ void FBO_Init(void) {
 		R_CheckFBO(tr.screenSsaoFbo);
 	}
 
+	if (tr.ssaoLowImage) {
+		tr.ssaoLowFbo = FBO_Create("_ssaolow", tr.ssaoLowImage->width, tr.ssaoLowImage->height);
+		FBO_AttachImage(tr.ssaoLowFbo, tr.ssaoLowImage, GL_COLOR_ATTACHMENT0, 0);
+		R_CheckFBO(tr.ssaoLowFbo);
+	}
+
 	if (tr.renderCubeImage) {
 		tr.renderCubeFbo = FBO_Create("_renderCubeFbo", tr.renderCubeImage->width, tr.renderCubeImage->height);
 		FBO_AttachImage(tr.renderCubeFbo, tr.renderCubeImage, GL_COLOR_ATTACHMENT0, 0);
@@ -524,8 +530,8 @@ void FBO_BlitFromTexture(struct image_s *src, vec4_t inSrcTexCorners, vec2_t inS
 	GLSL_SetUniformMat4(shaderProgram, UNIFORM_MODELVIEWPROJECTIONMATRIX, projection);
 	GLSL_SetUniformVec4(shaderProgram, UNIFORM_COLOR, color);
 	GLSL_SetUniformVec2(shaderProgram, UNIFORM_INVTEXRES, invTexRes);
-	GLSL_SetUniformVec2(shaderProgram, UNIFORM_AUTOEXPOSUREMINMAX, tr.refdef.autoExposureMinMax);
-	GLSL_SetUniformVec3(shaderProgram, UNIFORM_TONEMINAVGMAXLINEAR, tr.refdef.toneMinAvgMaxLinear);
+	GLSL_SetUniformVec2(shaderProgram, UNIFORM_AUTOEXPOSUREMINMAX, backEnd.refdef.autoExposureMinMax);
+	GLSL_SetUniformVec3(shaderProgram, UNIFORM_TONEMINAVGMAXLINEAR, backEnd.refdef.toneMinAvgMaxLinear);
 
 	RB_InstantQuad2(quadVerts, texCoords);
 
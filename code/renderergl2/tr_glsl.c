@@ -32,6 +32,8 @@ extern const char *fallbackShader_depthblur_vp;
 extern const char *fallbackShader_depthblur_fp;
 extern const char *fallbackShader_dlight_vp;
 extern const char *fallbackShader_dlight_fp;
+extern const char *fallbackShader_dlightgrid_vp;
+extern const char *fallbackShader_dlightgrid_fp;
 extern const char *fallbackShader_down4x_vp;
 extern const char *fallbackShader_down4x_fp;
 extern const char *fallbackShader_fogpass_vp;
@@ -78,6 +80,8 @@ static uniformInfo_t uniformsInfo[] = {
 	{"u_ShadowMap3", GLSL_INT},
 	{"u_ShadowMap4", GLSL_INT},
 
+	{"u_DlightGridMap", GLSL_INT},
+
 	{"u_ShadowMvp", GLSL_MAT16},
 	{"u_ShadowMvp2", GLSL_MAT16},
 	{"u_ShadowMvp3", GLSL_MAT16},
@@ -102,6 +106,10 @@ static uniformInfo_t uniformsInfo[] = {
 	{"u_VertColor", GLSL_VEC4},
 
 	{"u_DlightInfo", GLSL_VEC4},
+	{"u_DlightGridInfo", GLSL_VEC4},
+	{"u_DlightGridDepth", GLSL_VEC4},
+	{"u_DlightOrigins", GLSL_VEC4_DLIGHTS},
+	{"u_DlightColors", GLSL_VEC4_DLIGHTS},
 	{"u_LightForward", GLSL_VEC3},
 	{"u_LightUp", GLSL_VEC3},
 	{"u_LightRight", GLSL_VEC3},
@@ -147,6 +155,9 @@ static uniformInfo_t uniformsInfo[] = {
 	{"u_AlphaTest", GLSL_INT},
 
 	{"u_BoneMatrix", GLSL_MAT16_BONEMATRIX},
+
+	{"u_InstanceMatrix", GLSL_MAT16_INSTANCES},
+	{"u_InstanceLight", GLSL_MAT16_INSTANCES},
 };
 
 typedef enum { GLSL_PRINTLOG_PROGRAM_INFO, GLSL_PRINTLOG_SHADER_INFO, GLSL_PRINTLOG_SHADER_SOURCE } glslPrintLog_t;
@@ -327,9 +338,19 @@ static void GLSL_GetShaderHeader(GLenum shaderType, const GLchar *extra, char *d
 	Q_strcat(dest, size, "#line 0\n");
 }
 
-static int GLSL_CompileGPUShader(GLuint program, GLuint *prevShader, const GLchar *buffer, int size,
-								 GLenum shaderType) {
+static void GLSL_CheckCompiled(GLuint shader) {
 	GLint compiled;
+
+	qglGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+	if (!compiled) {
+		GLSL_PrintLog(shader, GLSL_PRINTLOG_SHADER_SOURCE, qfalse);
+		GLSL_PrintLog(shader, GLSL_PRINTLOG_SHADER_INFO, qfalse);
+		ri.Error(ERR_DROP, "Couldn't compile shader");
+	}
+}
+
+static int GLSL_CompileGPUShader(GLuint program, GLuint *prevShader, const GLchar *buffer, int size,
+								 GLenum shaderType, qboolean deferred) {
 	GLuint shader;
 
 	shader = qglCreateShader(shaderType);
@@ -339,13 +360,9 @@ static int GLSL_CompileGPUShader(GLuint program, GLuint *prevShader, const GLcha
 	// compile shader
 	qglCompileShader(shader);
 
-	// check if shader compiled
-	qglGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
-	if (!compiled) {
-		GLSL_PrintLog(shader, GLSL_PRINTLOG_SHADER_SOURCE, qfalse);
-		GLSL_PrintLog(shader, GLSL_PRINTLOG_SHADER_INFO, qfalse);
-		ri.Error(ERR_DROP, "Couldn't compile shader");
-		return 0;
+	// a deferred compile is checked by GLSL_CheckLinked once the driver is done
+	if (!deferred) {
+		GLSL_CheckCompiled(shader);
 	}
 
 	if (*prevShader) {
@@ -409,18 +426,123 @@ static int GLSL_LoadGPUShaderText(const char *name, const char *fallback, GLenum
 	return result;
 }
 
-static void GLSL_LinkProgram(GLuint program) {
+static void GLSL_CheckLinked(shaderProgram_t *program) {
 	GLint linked;
 
-	qglLinkProgram(program);
-
-	qglGetProgramiv(program, GL_LINK_STATUS, &linked);
+	qglGetProgramiv(program->program, GL_LINK_STATUS, &linked);
 	if (!linked) {
-		GLSL_PrintLog(program, GLSL_PRINTLOG_PROGRAM_INFO, qfalse);
+		// a deferred compile error only shows up here
+		if (program->vertexShader)
+			GLSL_CheckCompiled(program->vertexShader);
+
+		if (program->fragmentShader)
+			GLSL_CheckCompiled(program->fragmentShader);
+
+		GLSL_PrintLog(program->program, GLSL_PRINTLOG_PROGRAM_INFO, qfalse);
 		ri.Error(ERR_DROP, "shaders failed to link");
 	}
 }
 
+/*
+====================
+Program binary cache
+
+With GL_ARB_get_program_binary every linked program is saved in the home
+path as glslcache/<name>_<hash>.bin, the hash covering the driver strings
+and the final GLSL source.  A later start loads the binary instead of
+compiling, and falls back to the source if the driver rejects it.
+====================
+*/
+
+#define GLSL_CACHE_IDENT (('B' << 24) + ('L' << 16) + ('S' << 8) + 'G')
+#define GLSL_CACHE_VERSION 1
+
+typedef struct {
+	int ident;
+	int version;
+	uint32_t driverHash;
+	uint32_t cacheHash;
+	int attribs;
+	GLenum format;
+	int length;
+} glslCacheHeader_t;
+
+static uint32_t glslDriverHash;
+
+// FNV-1a
+static uint32_t GLSL_HashString(const char *s, uint32_t hash) {
+	while (*s)
+		hash = (hash ^ (byte)*s++) * 16777619u;
+
+	return hash;
+}
+
+static void GLSL_CachePath(const shaderProgram_t *program, char *path, int size) {
+	Com_sprintf(path, size, "glslcache/%s_%08x.bin", program->name, program->cacheHash);
+}
+
+static qboolean GLSL_LoadProgramBinary(shaderProgram_t *program) {
+	char path[MAX_QPATH];
+	glslCacheHeader_t *header;
+	void *buffer;
+	GLint linked;
+	int size;
+
+	GLSL_CachePath(program, path, sizeof(path));
+
+	size = ri.FS_ReadFile(path, &buffer);
+	if (!buffer)
+		return qfalse;
+
+	header = buffer;
+	if (size < (int)sizeof(*header) || header->ident != GLSL_CACHE_IDENT || header->version != GLSL_CACHE_VERSION ||
+		header->driverHash != glslDriverHash || header->cacheHash != program->cacheHash ||
+		header->attribs != (int)program->attribs || header->length != size - (int)sizeof(*header)) {
+		ri.FS_FreeFile(buffer);
+		return qfalse;
+	}
+
+	qglProgramBinary(program->program, header->format, header + 1, header->length);
+
+	ri.FS_FreeFile(buffer);
+
+	// drivers reject their own binaries after an update
+	qglGetProgramiv(program->program, GL_LINK_STATUS, &linked);
+
+	return linked ? qtrue : qfalse;
+}
+
+static void GLSL_SaveProgramBinary(shaderProgram_t *program) {
+	char path[MAX_QPATH];
+	glslCacheHeader_t *header;
+	GLint length = 0;
+
+	if (!program->cacheHash)
+		return;
+
+	qglGetProgramiv(program->program, GL_PROGRAM_BINARY_LENGTH, &length);
+
+	if (length > 0) {
+		header = ri.Malloc(sizeof(*header) + length);
+
+		qglGetProgramBinary(program->program, length, &length, &header->format, header + 1);
+
+		header->ident = GLSL_CACHE_IDENT;
+		header->version = GLSL_CACHE_VERSION;
+		header->driverHash = glslDriverHash;
+		header->cacheHash = program->cacheHash;
+		header->attribs = program->attribs;
+		header->length = length;
+
+		GLSL_CachePath(program, path, sizeof(path));
+		ri.FS_WriteFile(path, header, sizeof(*header) + length);
+
+		ri.Free(header);
+	}
+
+	program->cacheHash = 0;
+}
+
 static void GLSL_ShowProgramUniforms(GLuint program) {
 	int i, count, size;
 	GLenum type;
@@ -438,7 +560,7 @@ static void GLSL_ShowProgramUniforms(GLuint program) {
 }
 
 static int GLSL_InitGPUShader2(shaderProgram_t *program, const char *name, int attribs, const char *vpCode,
-							   const char *fpCode) {
+							   const char *fpCode, qboolean deferred) {
 	ri.Printf(PRINT_DEVELOPER, "------- GPU shader -------\n");
 
 	if (strlen(name) >= MAX_QPATH) {
@@ -449,8 +571,27 @@ static int GLSL_InitGPUShader2(shaderProgram_t *program, const char *name, int a
 
 	program->program = qglCreateProgram();
 	program->attribs = attribs;
+	program->cacheHash = 0;
+
+	if (glRefConfig.programBinary) {
+		uint32_t hash = GLSL_HashString(vpCode, glslDriverHash);
 
-	if (!(GLSL_CompileGPUShader(program->program, &program->vertexShader, vpCode, strlen(vpCode), GL_VERTEX_SHADER))) {
+		if (fpCode)
+			hash = GLSL_HashString(fpCode, hash);
+
+		program->cacheHash = hash ? hash : 1;
+
+		if (GLSL_LoadProgramBinary(program)) {
+			ri.Printf(PRINT_DEVELOPER, "...loaded '%s' from the program binary cache\n", name);
+			program->cacheHash = 0;
+			return 1;
+		}
+
+		qglProgramParameteri(program->program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+	}
+
+	if (!(GLSL_CompileGPUShader(program->program, &program->vertexShader, vpCode, strlen(vpCode), GL_VERTEX_SHADER,
+								deferred))) {
 		ri.Printf(PRINT_ALL, "GLSL_InitGPUShader2: Unable to load \"%s\" as GL_VERTEX_SHADER\n", name);
 		qglDeleteProgram(program->program);
 		return 0;
@@ -458,7 +599,7 @@ static int GLSL_InitGPUShader2(shaderProgram_t *program, const char *name, int a
 
 	if (fpCode) {
 		if (!(GLSL_CompileGPUShader(program->program, &program->fragmentShader, fpCode, strlen(fpCode),
-									GL_FRAGMENT_SHADER))) {
+									GL_FRAGMENT_SHADER, deferred))) {
 			ri.Printf(PRINT_ALL, "GLSL_InitGPUShader2: Unable to load \"%s\" as GL_FRAGMENT_SHADER\n", name);
 			qglDeleteProgram(program->program);
 			return 0;
@@ -510,14 +651,20 @@ static int GLSL_InitGPUShader2(shaderProgram_t *program, const char *name, int a
 	if (attribs & ATTR_TANGENT2)
 		qglBindAttribLocation(program->program, ATTR_INDEX_TANGENT2, "attr_Tangent2");
 
-	GLSL_LinkProgram(program->program);
+	qglLinkProgram(program->program);
+
+	// a deferred link is checked and cached by GLSL_FinishPermutation
+	if (!deferred) {
+		GLSL_CheckLinked(program);
+		GLSL_SaveProgramBinary(program);
+	}
 
 	return 1;
 }
 
-static int GLSL_InitGPUShader(shaderProgram_t *program, const char *name, int attribs, qboolean fragmentShader,
-							  const GLchar *extra, qboolean addHeader, const char *fallback_vp,
-							  const char *fallback_fp) {
+static int GLSL_StartGPUShader(shaderProgram_t *program, const char *name, int attribs, qboolean fragmentShader,
+							   const GLchar *extra, qboolean addHeader, const char *fallback_vp,
+							   const char *fallback_fp, qboolean deferred) {
 	char vpCode[32000];
 	char fpCode[32000];
 	char *postHeader;
@@ -552,11 +699,18 @@ static int GLSL_InitGPUShader(shaderProgram_t *program, const char *name, int at
 		}
 	}
 
-	result = GLSL_InitGPUShader2(program, name, attribs, vpCode, fragmentShader ? fpCode : NULL);
+	result = GLSL_InitGPUShader2(program, name, attribs, vpCode, fragmentShader ? fpCode : NULL, deferred);
 
 	return result;
 }
 
+static int GLSL_InitGPUShader(shaderProgram_t *program, const char *name, int attribs, qboolean fragmentShader,
+							  const GLchar *extra, qboolean addHeader, const char *fallback_vp,
+							  const char *fallback_fp) {
+	return GLSL_StartGPUShader(program, name, attribs, fragmentShader, extra, addHeader, fallback_vp, fallback_fp,
+							   qfalse);
+}
+
 void GLSL_InitUniforms(shaderProgram_t *program) {
 	int i, size;
 
@@ -596,6 +750,12 @@ void GLSL_InitUniforms(shaderProgram_t *program) {
 		case GLSL_MAT16_BONEMATRIX:
 			size += sizeof(vec_t) * 16 * glRefConfig.glslMaxAnimatedBones;
 			break;
+		case GLSL_MAT16_INSTANCES:
+			size += sizeof(vec_t) * 16 * glRefConfig.glslMaxInstances;
+			break;
+		case GLSL_VEC4_DLIGHTS:
+			size += sizeof(vec_t) * 4 * MAX_DLIGHTS;
+			break;
 		default:
 			break;
 		}
@@ -795,6 +955,64 @@ void GLSL_SetUniformMat4BoneMatrix(shaderProgram_t *program, int uniformNum, /*c
 	qglProgramUniformMatrix4fvEXT(program->program, uniforms[uniformNum], numMatricies, GL_FALSE, &matrix[0][0]);
 }
 
+void GLSL_SetUniformMat4Instances(shaderProgram_t *program, int uniformNum, /*const*/ mat4_t *matrix,
+								  int numMatricies) {
+	GLint *uniforms = program->uniforms;
+	vec_t *compare = (float *)(program->uniformBuffer + program->uniformBufferOffsets[uniformNum]);
+
+	if (uniforms[uniformNum] == -1) {
+		return;
+	}
+
+	if (uniformsInfo[uniformNum].type != GLSL_MAT16_INSTANCES) {
+		ri.Printf(PRINT_WARNING, "GLSL_SetUniformMat4Instances: wrong type for uniform %i in program %s\n", uniformNum,
+				  program->name);
+		return;
+	}
+
+	if (numMatricies > glRefConfig.glslMaxInstances) {
+		ri.Printf(PRINT_WARNING,
+				  "GLSL_SetUniformMat4Instances: too many matricies (%d/%d) for uniform %i in program %s\n",
+				  numMatricies, glRefConfig.glslMaxInstances, uniformNum, program->name);
+		return;
+	}
+
+	if (!memcmp(matrix, compare, numMatricies * sizeof(mat4_t))) {
+		return;
+	}
+
+	Com_Memcpy(compare, matrix, numMatricies * sizeof(mat4_t));
+
+	qglProgramUniformMatrix4fvEXT(program->program, uniforms[uniformNum], numMatricies, GL_FALSE, &matrix[0][0]);
+}
+
+void GLSL_SetUniformVec4Dlights(shaderProgram_t *program, int uniformNum, const vec4_t *v, int numVectors) {
+	GLint *uniforms = program->uniforms;
+	vec_t *compare = (float *)(program->uniformBuffer + program->uniformBufferOffsets[uniformNum]);
+
+	if (uniforms[uniformNum] == -1) {
+		return;
+	}
+
+	if (uniformsInfo[uniformNum].type != GLSL_VEC4_DLIGHTS) {
+		ri.Printf(PRINT_WARNING, "GLSL_SetUniformVec4Dlights: wrong type for uniform %i in program %s\n", uniformNum,
+				  program->name);
+		return;
+	}
+
+	if (numVectors > MAX_DLIGHTS) {
+		numVectors = MAX_DLIGHTS;
+	}
+
+	if (!memcmp(v, compare, numVectors * sizeof(vec4_t))) {
+		return;
+	}
+
+	Com_Memcpy(compare, v, numVectors * sizeof(vec4_t));
+
+	qglProgramUniform4fvEXT(program->program, uniforms[uniformNum], numVectors, &v[0][0]);
+}
+
 void GLSL_DeleteGPUShader(shaderProgram_t *program) {
 	if (program->program) {
 		if (program->vertexShader) {
@@ -817,67 +1035,413 @@ void GLSL_DeleteGPUShader(shaderProgram_t *program) {
 	}
 }
 
-void GLSL_InitGPUShaders(void) {
-	int startTime, endTime;
-	int i;
-	char extradefines[1024];
-	int attribs;
-	int numGenShaders = 0, numLightShaders = 0, numEtcShaders = 0;
+static qboolean GLSL_GenericDefines(int i, char *extradefines, int size, int *attribs) {
+	// both animation bits together select the instanced variant
+	if ((i & GENERICDEF_USE_INSTANCING) == GENERICDEF_USE_INSTANCING) {
+		if (!glRefConfig.glslMaxInstances)
+			return qfalse;
+	} else if ((i & GENERICDEF_USE_BONE_ANIMATION) && !glRefConfig.glslMaxAnimatedBones)
+		return qfalse;
 
-	ri.Printf(PRINT_ALL, "------- GLSL_InitGPUShaders -------\n");
+	*attribs = ATTR_POSITION | ATTR_TEXCOORD | ATTR_LIGHTCOORD | ATTR_NORMAL | ATTR_COLOR;
 
-	R_IssuePendingRenderCommands();
+	if (i & GENERICDEF_USE_DEFORM_VERTEXES)
+		Q_strcat(extradefines, size, "#define USE_DEFORM_VERTEXES\n");
 
-	startTime = ri.Milliseconds();
+	if (i & GENERICDEF_USE_TCGEN_AND_TCMOD) {
+		Q_strcat(extradefines, size, "#define USE_TCGEN\n");
+		Q_strcat(extradefines, size, "#define USE_TCMOD\n");
+	}
 
-	for (i = 0; i < GENERICDEF_COUNT; i++) {
-		if ((i & GENERICDEF_USE_VERTEX_ANIMATION) && (i & GENERICDEF_USE_BONE_ANIMATION))
-			continue;
+	if ((i & GENERICDEF_USE_INSTANCING) == GENERICDEF_USE_INSTANCING) {
+		Q_strcat(extradefines, size, "#define USE_VERTEX_ANIMATION\n");
+		Q_strcat(extradefines, size,
+				 va("#define USE_INSTANCING\n#define MAX_GLSL_INSTANCES %d\n", glRefConfig.glslMaxInstances));
+		*attribs |= ATTR_POSITION2 | ATTR_NORMAL2;
+	} else if (i & GENERICDEF_USE_VERTEX_ANIMATION) {
+		Q_strcat(extradefines, size, "#define USE_VERTEX_ANIMATION\n");
+		*attribs |= ATTR_POSITION2 | ATTR_NORMAL2;
+	} else if (i & GENERICDEF_USE_BONE_ANIMATION) {
+		Q_strcat(extradefines, size,
+				 va("#define USE_BONE_ANIMATION\n#define MAX_GLSL_BONES %d\n", glRefConfig.glslMaxAnimatedBones));
+		*attribs |= ATTR_BONE_INDEXES | ATTR_BONE_WEIGHTS;
+	}
 
-		if ((i & GENERICDEF_USE_BONE_ANIMATION) && !glRefConfig.glslMaxAnimatedBones)
-			continue;
+	if (i & GENERICDEF_USE_FOG)
+		Q_strcat(extradefines, size, "#define USE_FOG\n");
 
-		attribs = ATTR_POSITION | ATTR_TEXCOORD | ATTR_LIGHTCOORD | ATTR_NORMAL | ATTR_COLOR;
-		extradefines[0] = '\0';
+	if (i & GENERICDEF_USE_RGBAGEN)
+		Q_strcat(extradefines, size, "#define USE_RGBAGEN\n");
 
-		if (i & GENERICDEF_USE_DEFORM_VERTEXES)
-			Q_strcat(extradefines, 1024, "#define USE_DEFORM_VERTEXES\n");
+	return qtrue;
+}
+
+static void GLSL_GenericSamplers(shaderProgram_t *program) {
+	GLSL_SetUniformInt(program, UNIFORM_DIFFUSEMAP, TB_DIFFUSEMAP);
+	GLSL_SetUniformInt(program, UNIFORM_LIGHTMAP, TB_LIGHTMAP);
+}
+
+static qboolean GLSL_LightallDefines(int i, char *extradefines, int size, int *attribs) {
+	int lightType = i & LIGHTDEF_LIGHTTYPE_MASK;
+	qboolean fastLight = !(r_normalMapping->integer || r_specularMapping->integer);
+
+	// skip impossible combos
+	if ((i & LIGHTDEF_USE_PARALLAXMAP) && !r_parallaxMapping->integer)
+		return qfalse;
+
+	if ((i & LIGHTDEF_USE_SHADOWMAP) && (!lightType || !r_sunlightMode->integer))
+		return qfalse;
+
+	if ((i & LIGHTDEF_ENTITY_INSTANCING) == LIGHTDEF_ENTITY_INSTANCING) {
+		if (!glRefConfig.glslMaxInstances)
+			return qfalse;
+	} else if ((i & LIGHTDEF_ENTITY_BONE_ANIMATION) && !glRefConfig.glslMaxAnimatedBones)
+		return qfalse;
+
+	*attribs = ATTR_POSITION | ATTR_TEXCOORD | ATTR_COLOR | ATTR_NORMAL;
+
+	if (r_dlightMode->integer >= 2)
+		Q_strcat(extradefines, size, "#define USE_SHADOWMAP\n");
+
+	if (glRefConfig.swizzleNormalmap)
+		Q_strcat(extradefines, size, "#define SWIZZLE_NORMALMAP\n");
 
-		if (i & GENERICDEF_USE_TCGEN_AND_TCMOD) {
-			Q_strcat(extradefines, 1024, "#define USE_TCGEN\n");
-			Q_strcat(extradefines, 1024, "#define USE_TCMOD\n");
+	if (lightType) {
+		Q_strcat(extradefines, size, "#define USE_LIGHT\n");
+
+		if (fastLight)
+			Q_strcat(extradefines, size, "#define USE_FAST_LIGHT\n");
+
+		switch (lightType) {
+		case LIGHTDEF_USE_LIGHTMAP:
+			Q_strcat(extradefines, size, "#define USE_LIGHTMAP\n");
+			if (r_deluxeMapping->integer && !fastLight)
+				Q_strcat(extradefines, size, "#define USE_DELUXEMAP\n");
+			*attribs |= ATTR_LIGHTCOORD | ATTR_LIGHTDIRECTION;
+			break;
+		case LIGHTDEF_USE_LIGHT_VECTOR:
+			Q_strcat(extradefines, size, "#define USE_LIGHT_VECTOR\n");
+			break;
+		case LIGHTDEF_USE_LIGHT_VERTEX:
+			Q_strcat(extradefines, size, "#define USE_LIGHT_VERTEX\n");
+			*attribs |= ATTR_LIGHTDIRECTION;
+			break;
+		default:
+			break;
 		}
 
-		if (i & GENERICDEF_USE_VERTEX_ANIMATION) {
-			Q_strcat(extradefines, 1024, "#define USE_VERTEX_ANIMATION\n");
-			attribs |= ATTR_POSITION2 | ATTR_NORMAL2;
-		} else if (i & GENERICDEF_USE_BONE_ANIMATION) {
-			Q_strcat(extradefines, 1024,
-					 va("#define USE_BONE_ANIMATION\n#define MAX_GLSL_BONES %d\n", glRefConfig.glslMaxAnimatedBones));
-			attribs |= ATTR_BONE_INDEXES | ATTR_BONE_WEIGHTS;
+		if (r_normalMapping->integer) {
+			Q_strcat(extradefines, size, "#define USE_NORMALMAP\n");
+
+			*attribs |= ATTR_TANGENT;
+
+			if ((i & LIGHTDEF_USE_PARALLAXMAP) && !(i & LIGHTDEF_ENTITY_VERTEX_ANIMATION) &&
+				!(i & LIGHTDEF_ENTITY_BONE_ANIMATION) && r_parallaxMapping->integer) {
+				Q_strcat(extradefines, size, "#define USE_PARALLAXMAP\n");
+				if (r_parallaxMapping->integer > 1)
+					Q_strcat(extradefines, size, "#define USE_RELIEFMAP\n");
+
+				if (r_parallaxMapShadows->integer)
+					Q_strcat(extradefines, size, "#define USE_PARALLAXMAP_SHADOWS\n");
+
+				Q_strcat(extradefines, size, va("#define r_parallaxMapOffset %f\n", r_parallaxMapOffset->value));
+			}
+		}
+
+		if (r_specularMapping->integer)
+			Q_strcat(extradefines, size, "#define USE_SPECULARMAP\n");
+
+		if (r_cubeMapping->integer) {
+			Q_strcat(extradefines, size, "#define USE_CUBEMAP\n");
+			if (r_cubeMapping->integer == 2)
+				Q_strcat(extradefines, size, "#define USE_BOX_CUBEMAP_PARALLAX\n");
+		} else if (r_deluxeSpecular->value > 0.000001f) {
+			Q_strcat(extradefines, size, va("#define r_deluxeSpecular %f\n", r_deluxeSpecular->value));
+		}
+
+		switch (r_glossType->integer) {
+		case 0:
+		default:
+			Q_strcat(extradefines, size, "#define GLOSS_IS_GLOSS\n");
+			break;
+		case 1:
+			Q_strcat(extradefines, size, "#define GLOSS_IS_SMOOTHNESS\n");
+			break;
+		case 2:
+			Q_strcat(extradefines, size, "#define GLOSS_IS_ROUGHNESS\n");
+			break;
+		case 3:
+			Q_strcat(extradefines, size, "#define GLOSS_IS_SHININESS\n");
+			break;
+		}
+	}
+
+	if (i & LIGHTDEF_USE_SHADOWMAP) {
+		Q_strcat(extradefines, size, "#define USE_SHADOWMAP\n");
+
+		if (r_sunlightMode->integer == 1)
+			Q_strcat(extradefines, size, "#define SHADOWMAP_MODULATE\n");
+		else if (r_sunlightMode->integer == 2)
+			Q_strcat(extradefines, size, "#define USE_PRIMARY_LIGHT\n");
+	}
+
+	if (i & LIGHTDEF_USE_TCGEN_AND_TCMOD) {
+		Q_strcat(extradefines, size, "#define USE_TCGEN\n");
+		Q_strcat(extradefines, size, "#define USE_TCMOD\n");
+	}
+
+	if (i & LIGHTDEF_ENTITY_VERTEX_ANIMATION) {
+		Q_strcat(extradefines, size, "#define USE_VERTEX_ANIMATION\n#define USE_MODELMATRIX\n");
+		if (i & LIGHTDEF_ENTITY_BONE_ANIMATION)
+			Q_strcat(extradefines, size,
+					 va("#define USE_INSTANCING\n#define MAX_GLSL_INSTANCES %d\n", glRefConfig.glslMaxInstances));
+		*attribs |= ATTR_POSITION2 | ATTR_NORMAL2;
+
+		if (r_normalMapping->integer) {
+			*attribs |= ATTR_TANGENT2;
 		}
+	} else if (i & LIGHTDEF_ENTITY_BONE_ANIMATION) {
+		Q_strcat(extradefines, size, "#define USE_MODELMATRIX\n");
+		Q_strcat(extradefines, size,
+				 va("#define USE_BONE_ANIMATION\n#define MAX_GLSL_BONES %d\n", glRefConfig.glslMaxAnimatedBones));
+		*attribs |= ATTR_BONE_INDEXES | ATTR_BONE_WEIGHTS;
+	}
+
+	return qtrue;
+}
 
-		if (i & GENERICDEF_USE_FOG)
-			Q_strcat(extradefines, 1024, "#define USE_FOG\n");
+static void GLSL_LightallSamplers(shaderProgram_t *program) {
+	GLSL_SetUniformInt(program, UNIFORM_DIFFUSEMAP, TB_DIFFUSEMAP);
+	GLSL_SetUniformInt(program, UNIFORM_LIGHTMAP, TB_LIGHTMAP);
+	GLSL_SetUniformInt(program, UNIFORM_NORMALMAP, TB_NORMALMAP);
+	GLSL_SetUniformInt(program, UNIFORM_DELUXEMAP, TB_DELUXEMAP);
+	GLSL_SetUniformInt(program, UNIFORM_SPECULARMAP, TB_SPECULARMAP);
+	GLSL_SetUniformInt(program, UNIFORM_SHADOWMAP, TB_SHADOWMAP);
+	GLSL_SetUniformInt(program, UNIFORM_CUBEMAP, TB_CUBEMAP);
+}
+
+/*
+====================
+Permutation groups
+
+The generic and lightall programs have far more permutations than a level
+ever draws.  With r_glslLazy only the base permutation of each light type
+and animation mode is built at init, the others are compiled when a shader
+or stage first asks for them.  While ARB_parallel_shader_compile is still
+working on one, GLSL_GetProgram hands out its base permutation instead.
+====================
+*/
+
+typedef enum {
+	GLSL_PERM_UNLOADED,
+	GLSL_PERM_COMPILING, // linked with a deferred status check
+	GLSL_PERM_READY,
+	GLSL_PERM_INVALID // combination this driver or config can't build
+} glslPermState_t;
 
-		if (i & GENERICDEF_USE_RGBAGEN)
-			Q_strcat(extradefines, 1024, "#define USE_RGBAGEN\n");
+typedef struct {
+	char *name;
+	shaderProgram_t *programs;
+	byte *state;
+	int count;
+	int baseMask; // index bits kept by the fallback permutation
+	const char **fallback_vp;
+	const char **fallback_fp;
+	qboolean (*defines)(int i, char *extradefines, int size, int *attribs);
+	void (*samplers)(shaderProgram_t *program);
+} glslPermGroup_t;
+
+static byte genericState[GENERICDEF_COUNT];
+static byte lightallState[LIGHTDEF_COUNT];
+
+static glslPermGroup_t permGroups[] = {
+	{"generic", tr.genericShader, genericState, GENERICDEF_COUNT, GENERICDEF_USE_INSTANCING, &fallbackShader_generic_vp,
+	 &fallbackShader_generic_fp, GLSL_GenericDefines, GLSL_GenericSamplers},
+	{"lightall", tr.lightallShader, lightallState, LIGHTDEF_COUNT, LIGHTDEF_LIGHTTYPE_MASK | LIGHTDEF_ENTITY_INSTANCING,
+	 &fallbackShader_lightall_vp, &fallbackShader_lightall_fp, GLSL_LightallDefines, GLSL_LightallSamplers},
+};
+
+static void GLSL_FinishPermutation(glslPermGroup_t *group, int i) {
+	shaderProgram_t *program = &group->programs[i];
+
+	GLSL_CheckLinked(program);
+	GLSL_SaveProgramBinary(program);
+
+	GLSL_InitUniforms(program);
+	group->samplers(program);
+	GLSL_FinishGPUShader(program);
+
+	group->state[i] = GLSL_PERM_READY;
+}
+
+static void GLSL_StartPermutation(glslPermGroup_t *group, int i) {
+	char extradefines[1024];
+	int attribs;
+
+	if (group->state[i] != GLSL_PERM_UNLOADED)
+		return;
 
-		if (!GLSL_InitGPUShader(&tr.genericShader[i], "generic", attribs, qtrue, extradefines, qtrue,
-								fallbackShader_generic_vp, fallbackShader_generic_fp)) {
-			ri.Error(ERR_FATAL, "Could not load generic shader!");
+	extradefines[0] = '\0';
+
+	if (!group->defines(i, extradefines, sizeof(extradefines), &attribs)) {
+		group->state[i] = GLSL_PERM_INVALID;
+		return;
+	}
+
+	if (!GLSL_StartGPUShader(&group->programs[i], group->name, attribs, qtrue, extradefines, qtrue,
+							 *group->fallback_vp, *group->fallback_fp, glRefConfig.parallelShaderCompile)) {
+		ri.Error(ERR_FATAL, "Could not load %s shader!", group->name);
+	}
+
+	group->state[i] = GLSL_PERM_COMPILING;
+
+	if (!glRefConfig.parallelShaderCompile)
+		GLSL_FinishPermutation(group, i);
+}
+
+static glslPermGroup_t *GLSL_FindPermGroup(const shaderProgram_t *program, int *i) {
+	int g;
+
+	for (g = 0; g < ARRAY_LEN(permGroups); g++) {
+		glslPermGroup_t *group = &permGroups[g];
+
+		if (program >= group->programs && program < group->programs + group->count) {
+			*i = program - group->programs;
+			return group;
 		}
+	}
+
+	return NULL;
+}
+
+/*
+====================
+GLSL_GetProgram
+
+Returns the program to draw a generic or lightall permutation with,
+compiling it if this is its first use.  Other programs pass through.
+====================
+*/
+shaderProgram_t *GLSL_GetProgram(shaderProgram_t *program) {
+	glslPermGroup_t *group;
+	GLint done;
+	int i, base;
+
+	group = GLSL_FindPermGroup(program, &i);
+	if (!group)
+		return program;
+
+	if (group->state[i] == GLSL_PERM_UNLOADED) {
+		ri.Printf(PRINT_DEVELOPER, "compiling %s permutation %i on first use\n", group->name, i);
+		GLSL_StartPermutation(group, i);
+	}
 
-		GLSL_InitUniforms(&tr.genericShader[i]);
+	if (group->state[i] != GLSL_PERM_COMPILING)
+		return program;
 
-		GLSL_SetUniformInt(&tr.genericShader[i], UNIFORM_DIFFUSEMAP, TB_DIFFUSEMAP);
-		GLSL_SetUniformInt(&tr.genericShader[i], UNIFORM_LIGHTMAP, TB_LIGHTMAP);
+	qglGetProgramiv(program->program, GL_COMPLETION_STATUS_ARB, &done);
 
-		GLSL_FinishGPUShader(&tr.genericShader[i]);
+	base = i & group->baseMask;
+	if (done || group->state[base] != GLSL_PERM_READY) {
+		GLSL_FinishPermutation(group, i);
+		return program;
+	}
+
+	return &group->programs[base];
+}
 
-		numGenShaders++;
+// generic permutation bits that depend only on the shader and stage
+static int GLSL_GenericStageAttribs(const shader_t *shader, const shaderStage_t *pStage) {
+	int shaderAttribs = 0;
+
+	switch (pStage->rgbGen) {
+	case CGEN_LIGHTING_DIFFUSE:
+		shaderAttribs |= GENERICDEF_USE_RGBAGEN;
+		break;
+	default:
+		break;
+	}
+
+	switch (pStage->alphaGen) {
+	case AGEN_LIGHTING_SPECULAR:
+	case AGEN_PORTAL:
+		shaderAttribs |= GENERICDEF_USE_RGBAGEN;
+		break;
+	default:
+		break;
+	}
+
+	if (pStage->bundle[0].tcGen != TCGEN_TEXTURE || pStage->bundle[0].numTexMods) {
+		shaderAttribs |= GENERICDEF_USE_TCGEN_AND_TCMOD;
 	}
 
+	if (shader->numDeforms && !ShaderRequiresCPUDeforms(shader)) {
+		shaderAttribs |= GENERICDEF_USE_DEFORM_VERTEXES;
+	}
+
+	return shaderAttribs;
+}
+
+/*
+====================
+GLSL_PrecacheShaderPrograms
+
+Starts the permutations a newly loaded shader's stages select before
+entity animation, fog and sunlight bits are added at draw time.
+====================
+*/
+void GLSL_PrecacheShaderPrograms(const shader_t *shader) {
+	int stage;
+
+	if (!r_glslLazy->integer)
+		return;
+
+	for (stage = 0; stage < MAX_SHADER_STAGES; stage++) {
+		const shaderStage_t *pStage = shader->stages[stage];
+
+		if (!pStage || !pStage->active)
+			break;
+
+		if (pStage->glslShaderGroup == tr.lightallShader)
+			GLSL_StartPermutation(&permGroups[1], pStage->glslShaderIndex);
+		else
+			GLSL_StartPermutation(&permGroups[0], GLSL_GenericStageAttribs(shader, pStage));
+	}
+}
+
+void GLSL_InitGPUShaders(void) {
+	int startTime, endTime;
+	int i, g;
+	char extradefines[1024];
+	int attribs;
+	int numGenShaders = 0, numLightShaders = 0, numEtcShaders = 0;
+
+	ri.Printf(PRINT_ALL, "------- GLSL_InitGPUShaders -------\n");
+
+	R_IssuePendingRenderCommands();
+
+	startTime = ri.Milliseconds();
+
+	if (glRefConfig.programBinary) {
+		glslDriverHash = GLSL_HashString((const char *)qglGetString(GL_VENDOR), 2166136261u);
+		glslDriverHash = GLSL_HashString((const char *)qglGetString(GL_RENDERER), glslDriverHash);
+		glslDriverHash = GLSL_HashString((const char *)qglGetString(GL_VERSION), glslDriverHash);
+	}
+
+	// the base permutations (or all of them) compile side by side when the driver allows it,
+	// their link status is only waited on at the end
+	Com_Memset(genericState, 0, sizeof(genericState));
+	Com_Memset(lightallState, 0, sizeof(lightallState));
+
+	for (g = 0; g < ARRAY_LEN(permGroups); g++) {
+		for (i = 0; i < permGroups[g].count; i++) {
+			if (!r_glslLazy->integer || (i & permGroups[g].baseMask) == i)
+				GLSL_StartPermutation(&permGroups[g], i);
+		}
+	}
+
+	extradefines[0] = '\0';
+
 	attribs = ATTR_POSITION | ATTR_TEXCOORD;
 
 	if (!GLSL_InitGPUShader(&tr.textureColorShader, "texturecolor", attribs, qtrue, extradefines, qtrue,
@@ -948,151 +1512,35 @@ void GLSL_InitGPUShaders(void) {
 		numEtcShaders++;
 	}
 
-	for (i = 0; i < LIGHTDEF_COUNT; i++) {
-		int lightType = i & LIGHTDEF_LIGHTTYPE_MASK;
-		qboolean fastLight = !(r_normalMapping->integer || r_specularMapping->integer);
-
-		// skip impossible combos
-		if ((i & LIGHTDEF_USE_PARALLAXMAP) && !r_parallaxMapping->integer)
-			continue;
-
-		if ((i & LIGHTDEF_USE_SHADOWMAP) && (!lightType || !r_sunlightMode->integer))
-			continue;
-
-		if ((i & LIGHTDEF_ENTITY_VERTEX_ANIMATION) && (i & LIGHTDEF_ENTITY_BONE_ANIMATION))
-			continue;
-
-		if ((i & LIGHTDEF_ENTITY_BONE_ANIMATION) && !glRefConfig.glslMaxAnimatedBones)
-			continue;
-
-		attribs = ATTR_POSITION | ATTR_TEXCOORD | ATTR_COLOR | ATTR_NORMAL;
-
+	for (i = 0; i < DLIGHTDEF_COUNT && r_dlightClusters->integer; i++) {
+		attribs = ATTR_POSITION | ATTR_NORMAL | ATTR_TEXCOORD;
 		extradefines[0] = '\0';
 
-		if (r_dlightMode->integer >= 2)
-			Q_strcat(extradefines, 1024, "#define USE_SHADOWMAP\n");
-
-		if (glRefConfig.swizzleNormalmap)
-			Q_strcat(extradefines, 1024, "#define SWIZZLE_NORMALMAP\n");
-
-		if (lightType) {
-			Q_strcat(extradefines, 1024, "#define USE_LIGHT\n");
-
-			if (fastLight)
-				Q_strcat(extradefines, 1024, "#define USE_FAST_LIGHT\n");
-
-			switch (lightType) {
-			case LIGHTDEF_USE_LIGHTMAP:
-				Q_strcat(extradefines, 1024, "#define USE_LIGHTMAP\n");
-				if (r_deluxeMapping->integer && !fastLight)
-					Q_strcat(extradefines, 1024, "#define USE_DELUXEMAP\n");
-				attribs |= ATTR_LIGHTCOORD | ATTR_LIGHTDIRECTION;
-				break;
-			case LIGHTDEF_USE_LIGHT_VECTOR:
-				Q_strcat(extradefines, 1024, "#define USE_LIGHT_VECTOR\n");
-				break;
-			case LIGHTDEF_USE_LIGHT_VERTEX:
-				Q_strcat(extradefines, 1024, "#define USE_LIGHT_VERTEX\n");
-				attribs |= ATTR_LIGHTDIRECTION;
-				break;
-			default:
-				break;
-			}
-
-			if (r_normalMapping->integer) {
-				Q_strcat(extradefines, 1024, "#define USE_NORMALMAP\n");
-
-				attribs |= ATTR_TANGENT;
-
-				if ((i & LIGHTDEF_USE_PARALLAXMAP) && !(i & LIGHTDEF_ENTITY_VERTEX_ANIMATION) &&
-					!(i & LIGHTDEF_ENTITY_BONE_ANIMATION) && r_parallaxMapping->integer) {
-					Q_strcat(extradefines, 1024, "#define USE_PARALLAXMAP\n");
-					if (r_parallaxMapping->integer > 1)
-						Q_strcat(extradefines, 1024, "#define USE_RELIEFMAP\n");
-
-					if (r_parallaxMapShadows->integer)
-						Q_strcat(extradefines, 1024, "#define USE_PARALLAXMAP_SHADOWS\n");
-
-					Q_strcat(extradefines, 1024, va("#define r_parallaxMapOffset %f\n", r_parallaxMapOffset->value));
-				}
-			}
-
-			if (r_specularMapping->integer)
-				Q_strcat(extradefines, 1024, "#define USE_SPECULARMAP\n");
-
-			if (r_cubeMapping->integer) {
-				Q_strcat(extradefines, 1024, "#define USE_CUBEMAP\n");
-				if (r_cubeMapping->integer == 2)
-					Q_strcat(extradefines, 1024, "#define USE_BOX_CUBEMAP_PARALLAX\n");
-			} else if (r_deluxeSpecular->value > 0.000001f) {
-				Q_strcat(extradefines, 1024, va("#define r_deluxeSpecular %f\n", r_deluxeSpecular->value));
-			}
-
-			switch (r_glossType->integer) {
-			case 0:
-			default:
-				Q_strcat(extradefines, 1024, "#define GLOSS_IS_GLOSS\n");
-				break;
-			case 1:
-				Q_strcat(extradefines, 1024, "#define GLOSS_IS_SMOOTHNESS\n");
-				break;
-			case 2:
-				Q_strcat(extradefines, 1024, "#define GLOSS_IS_ROUGHNESS\n");
-				break;
-			case 3:
-				Q_strcat(extradefines, 1024, "#define GLOSS_IS_SHININESS\n");
-				break;
-			}
-		}
-
-		if (i & LIGHTDEF_USE_SHADOWMAP) {
-			Q_strcat(extradefines, 1024, "#define USE_SHADOWMAP\n");
-
-			if (r_sunlightMode->integer == 1)
-				Q_strcat(extradefines, 1024, "#define SHADOWMAP_MODULATE\n");
-			else if (r_sunlightMode->integer == 2)
-				Q_strcat(extradefines, 1024, "#define USE_PRIMARY_LIGHT\n");
-		}
-
-		if (i & LIGHTDEF_USE_TCGEN_AND_TCMOD) {
-			Q_strcat(extradefines, 1024, "#define USE_TCGEN\n");
-			Q_strcat(extradefines, 1024, "#define USE_TCMOD\n");
-		}
+		Q_strcat(extradefines, 1024,
+				 va("#define MAX_DLIGHTS %d\n#define DLIGHT_GRID_X %d\n#define DLIGHT_GRID_Y %d\n"
+					"#define DLIGHT_GRID_Z %d\n",
+					MAX_DLIGHTS, DLIGHT_GRID_X, DLIGHT_GRID_Y, DLIGHT_GRID_Z));
 
-		if (i & LIGHTDEF_ENTITY_VERTEX_ANIMATION) {
-			Q_strcat(extradefines, 1024, "#define USE_VERTEX_ANIMATION\n#define USE_MODELMATRIX\n");
-			attribs |= ATTR_POSITION2 | ATTR_NORMAL2;
-
-			if (r_normalMapping->integer) {
-				attribs |= ATTR_TANGENT2;
-			}
-		} else if (i & LIGHTDEF_ENTITY_BONE_ANIMATION) {
-			Q_strcat(extradefines, 1024, "#define USE_MODELMATRIX\n");
-			Q_strcat(extradefines, 1024,
-					 va("#define USE_BONE_ANIMATION\n#define MAX_GLSL_BONES %d\n", glRefConfig.glslMaxAnimatedBones));
-			attribs |= ATTR_BONE_INDEXES | ATTR_BONE_WEIGHTS;
+		if (i & DLIGHTDEF_USE_DEFORM_VERTEXES) {
+			Q_strcat(extradefines, 1024, "#define USE_DEFORM_VERTEXES\n");
 		}
 
-		if (!GLSL_InitGPUShader(&tr.lightallShader[i], "lightall", attribs, qtrue, extradefines, qtrue,
-								fallbackShader_lightall_vp, fallbackShader_lightall_fp)) {
-			ri.Error(ERR_FATAL, "Could not load lightall shader!");
+		if (!GLSL_InitGPUShader(&tr.dlightGridShader[i], "dlightgrid", attribs, qtrue, extradefines, qtrue,
+								fallbackShader_dlightgrid_vp, fallbackShader_dlightgrid_fp)) {
+			ri.Error(ERR_FATAL, "Could not load dlightgrid shader!");
 		}
 
-		GLSL_InitUniforms(&tr.lightallShader[i]);
+		GLSL_InitUniforms(&tr.dlightGridShader[i]);
 
-		GLSL_SetUniformInt(&tr.lightallShader[i], UNIFORM_DIFFUSEMAP, TB_DIFFUSEMAP);
-		GLSL_SetUniformInt(&tr.lightallShader[i], UNIFORM_LIGHTMAP, TB_LIGHTMAP);
-		GLSL_SetUniformInt(&tr.lightallShader[i], UNIFORM_NORMALMAP, TB_NORMALMAP);
-		GLSL_SetUniformInt(&tr.lightallShader[i], UNIFORM_DELUXEMAP, TB_DELUXEMAP);
-		GLSL_SetUniformInt(&tr.lightallShader[i], UNIFORM_SPECULARMAP, TB_SPECULARMAP);
-		GLSL_SetUniformInt(&tr.lightallShader[i], UNIFORM_SHADOWMAP, TB_SHADOWMAP);
-		GLSL_SetUniformInt(&tr.lightallShader[i], UNIFORM_CUBEMAP, TB_CUBEMAP);
+		GLSL_SetUniformInt(&tr.dlightGridShader[i], UNIFORM_DIFFUSEMAP, TB_DIFFUSEMAP);
+		GLSL_SetUniformInt(&tr.dlightGridShader[i], UNIFORM_DLIGHTGRIDMAP, TB_LIGHTMAP);
 
-		GLSL_FinishGPUShader(&tr.lightallShader[i]);
+		GLSL_FinishGPUShader(&tr.dlightGridShader[i]);
 
-		numLightShaders++;
+		numEtcShaders++;
 	}
 
+
 	for (i = 0; i < SHADOWMAPDEF_COUNT; i++) {
 		if ((i & SHADOWMAPDEF_USE_VERTEX_ANIMATION) && (i & SHADOWMAPDEF_USE_BONE_ANIMATION))
 			continue;
@@ -1307,6 +1755,21 @@ void GLSL_InitGPUShaders(void) {
 	numEtcShaders++;
 #endif
 
+	for (g = 0; g < ARRAY_LEN(permGroups); g++) {
+		for (i = 0; i < permGroups[g].count; i++) {
+			if (permGroups[g].state[i] == GLSL_PERM_COMPILING)
+				GLSL_FinishPermutation(&permGroups[g], i);
+
+			if (permGroups[g].state[i] != GLSL_PERM_READY)
+				continue;
+
+			if (permGroups[g].programs == tr.genericShader)
+				numGenShaders++;
+			else
+				numLightShaders++;
+		}
+	}
+
 	endTime = ri.Milliseconds();
 
 	ri.Printf(PRINT_ALL, "loaded %i GLSL shaders (%i gen %i light %i etc) in %5.2f seconds\n",
@@ -1332,8 +1795,10 @@ void GLSL_ShutdownGPUShaders(void) {
 	for (i = 0; i < FOGDEF_COUNT; i++)
 		GLSL_DeleteGPUShader(&tr.fogShader[i]);
 
-	for (i = 0; i < DLIGHTDEF_COUNT; i++)
+	for (i = 0; i < DLIGHTDEF_COUNT; i++) {
 		GLSL_DeleteGPUShader(&tr.dlightShader[i]);
+		GLSL_DeleteGPUShader(&tr.dlightGridShader[i]);
+	}
 
 	for (i = 0; i < LIGHTDEF_COUNT; i++)
 		GLSL_DeleteGPUShader(&tr.lightallShader[i]);
@@ -1371,46 +1836,19 @@ void GLSL_BindProgram(shaderProgram_t *program) {
 
 shaderProgram_t *GLSL_GetGenericShaderProgram(int stage) {
 	shaderStage_t *pStage = tess.xstages[stage];
-	int shaderAttribs = 0;
+	int shaderAttribs = GLSL_GenericStageAttribs(tess.shader, pStage);
 
 	if (tess.fogNum && pStage->adjustColorsForFog) {
 		shaderAttribs |= GENERICDEF_USE_FOG;
 	}
 
-	switch (pStage->rgbGen) {
-	case CGEN_LIGHTING_DIFFUSE:
-		shaderAttribs |= GENERICDEF_USE_RGBAGEN;
-		break;
-	default:
-		break;
-	}
-
-	switch (pStage->alphaGen) {
-	case AGEN_LIGHTING_SPECULAR:
-	case AGEN_PORTAL:
-		shaderAttribs |= GENERICDEF_USE_RGBAGEN;
-		break;
-	default:
-		break;
-	}
-
-	if (pStage->bundle[0].tcGen != TCGEN_TEXTURE) {
-		shaderAttribs |= GENERICDEF_USE_TCGEN_AND_TCMOD;
-	}
-
-	if (tess.shader->numDeforms && !ShaderRequiresCPUDeforms(tess.shader)) {
-		shaderAttribs |= GENERICDEF_USE_DEFORM_VERTEXES;
-	}
-
-	if (glState.vertexAnimation) {
+	if (glState.numInstances > 1) {
+		shaderAttribs |= GENERICDEF_USE_INSTANCING;
+	} else if (glState.vertexAnimation) {
 		shaderAttribs |= GENERICDEF_USE_VERTEX_ANIMATION;
 	} else if (glState.boneAnimation) {
 		shaderAttribs |= GENERICDEF_USE_BONE_ANIMATION;
 	}
 
-	if (pStage->bundle[0].numTexMods) {
-		shaderAttribs |= GENERICDEF_USE_TCGEN_AND_TCMOD;
-	}
-
-	return &tr.genericShader[shaderAttribs];
+	return GLSL_GetProgram(&tr.genericShader[shaderAttribs]);
 }
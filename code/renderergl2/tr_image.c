@@ -1934,6 +1934,10 @@ image_t *R_CreateImage2(const char *name, byte *pic, int width, int height, GLen
 	if (strlen(name) >= MAX_QPATH) {
 		ri.Error(ERR_DROP, "R_CreateImage: \"%s\" is too long", name);
 	}
+
+	// the upload needs the GL context
+	R_SyncRenderThread();
+
 	if (!strncmp(name, "*lightmap", 9)) {
 		isLightmap = qtrue;
 	}
@@ -2070,6 +2074,8 @@ void R_UpdateSubImage(image_t *image, byte *pic, int x, int y, int width, int he
 
 // Prototype for dds loader function which isn't common to both renderers
 void R_LoadDDS(const char *filename, byte **pic, int *width, int *height, GLenum *picFormat, int *numMips);
+qboolean R_SaveCompressedDDS(const char *filename, byte *pic, int picSize, int width, int height, int numMips,
+							 GLenum picFormat);
 
 typedef struct {
 	char *ext;
@@ -2123,6 +2129,10 @@ void R_LoadImage(const char *name, byte **pic, int *width, int *height, GLenum *
 			return;
 	}
 
+	// decoded on a job thread when the level's shaders were loaded
+	if (R_TakePrefetchedImage(name, pic, width, height))
+		return;
+
 	if (*ext) {
 		// Look for the correct loader and use it
 		for (i = 0; i < numImageLoaders; i++) {
@@ -2169,6 +2179,116 @@ void R_LoadImage(const char *name, byte **pic, int *width, int *height, GLenum *
 	}
 }
 
+/*
+=================
+R_TextureCacheName
+
+Textures loaded from a pak are compressed by the driver the first time
+and cached as DDS files, so later loads skip decoding, mip generation and
+compression. The cache is keyed by the pak checksum and a hash of the
+settings that change the uploaded texels, stale entries are just ignored.
+=================
+*/
+static qboolean R_TextureCacheName(const char *name, imgType_t type, imgFlags_t flags, char *cacheName,
+								   int cacheNameSize) {
+	char baseName[MAX_QPATH];
+	const char *ext;
+	unsigned int tag = 2166136261u;
+	int checksum = 0, found = -1;
+	int i;
+
+	if (!r_textureCache->integer || !r_ext_compressed_textures->integer)
+		return qfalse;
+
+	if (glConfig.textureCompression == TC_NONE && glRefConfig.textureCompression == TCR_NONE)
+		return qfalse;
+
+	if (name[0] == '*' || (flags & (IMGFLAG_NO_COMPRESSION | IMGFLAG_CUBEMAP)))
+		return qfalse;
+
+	// generated normal maps are derived from the uncompressed texels
+	if (r_normalMapping->integer && (flags & IMGFLAG_GENNORMALMAP))
+		return qfalse;
+
+	// find the file R_LoadImage would pick, loose files may change at any time
+	COM_StripExtension(name, baseName, sizeof(baseName));
+	ext = COM_GetExtension(name);
+	if (*ext)
+		found = ri.FS_FileIsInPAK(name, &checksum);
+
+	for (i = 0; i < numImageLoaders && found == -1; i++) {
+		const char *altName = va("%s.%s", baseName, imageLoaders[i].ext);
+
+		found = ri.FS_FileIsInPAK(altName, &checksum);
+		if (found == -1 && ri.FS_FileExists(altName))
+			return qfalse;
+	}
+
+	if (found != 1)
+		return qfalse;
+
+	// FNV-1a over everything that changes what Upload32 sends to the driver
+	{
+		const char *settings = va("%d %d %d %d %d %d %d %d %g", type, flags, r_picmip->integer,
+								  r_roundImagesDown->integer, r_imageUpsample->integer,
+								  r_imageUpsampleMaxSize->integer, r_imageUpsampleType->integer,
+								  r_ext_compressed_textures->integer, r_greyscale->value);
+
+		for (i = 0; settings[i]; i++)
+			tag = (tag ^ (byte)settings[i]) * 16777619u;
+		for (i = 0; i < 256; i++)
+			tag = (tag ^ s_intensitytable[i]) * 16777619u;
+		if (!glConfig.deviceSupportsGamma) {
+			for (i = 0; i < 256; i++)
+				tag = (tag ^ s_gammatable[i]) * 16777619u;
+		}
+	}
+
+	Com_sprintf(cacheName, cacheNameSize, "texcache/%08x-%08x/%s.dds", checksum, tag, baseName);
+	return qtrue;
+}
+
+/*
+=================
+R_SaveTextureCache
+
+Reads the driver compressed mip chain of image back and writes it to cacheName.
+=================
+*/
+static void R_SaveTextureCache(image_t *image, const char *cacheName) {
+	int width = image->uploadWidth, height = image->uploadHeight;
+	int numMips = 0, picSize = 0, size, level;
+	GLint compressed = GL_FALSE;
+	byte *pic;
+
+	GL_BindToTMU(image, TB_COLORMAP);
+
+	qglGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_COMPRESSED, &compressed);
+	if (!compressed)
+		return;
+
+	do {
+		qglGetTexLevelParameteriv(GL_TEXTURE_2D, numMips, GL_TEXTURE_COMPRESSED_IMAGE_SIZE, &size);
+		picSize += size;
+		numMips++;
+	} while ((image->flags & IMGFLAG_MIPMAP) && (width >> numMips || height >> numMips));
+
+	pic = ri.Hunk_AllocateTempMemory(picSize);
+
+	for (level = 0, size = 0; level < numMips; level++) {
+		GLint levelSize;
+
+		qglGetTexLevelParameteriv(GL_TEXTURE_2D, level, GL_TEXTURE_COMPRESSED_IMAGE_SIZE, &levelSize);
+		qglGetCompressedTexImage(GL_TEXTURE_2D, level, pic + size);
+		size += levelSize;
+	}
+
+	if (R_SaveCompressedDDS(cacheName, pic, picSize, width, height, numMips, image->internalFormat))
+		ri.Printf(PRINT_DEVELOPER, "cached %s as %s\n", image->imgName, cacheName);
+
+	ri.Hunk_FreeTempMemory(pic);
+}
+
 /*
 ===============
 R_FindImageFile
@@ -2185,6 +2305,8 @@ image_t *R_FindImageFile(const char *name, imgType_t type, imgFlags_t flags) {
 	int picNumMips;
 	long hash;
 	imgFlags_t checkFlagsTrue, checkFlagsFalse;
+	char cacheName[MAX_QPATH];
+	qboolean cacheable;
 
 	if (!name) {
 		return NULL;
@@ -2208,6 +2330,18 @@ image_t *R_FindImageFile(const char *name, imgType_t type, imgFlags_t flags) {
 		}
 	}
 
+	cacheable = R_TextureCacheName(name, type, flags, cacheName, sizeof(cacheName));
+	if (cacheable) {
+		R_LoadDDS(cacheName, &pic, &width, &height, &picFormat, &picNumMips);
+		if (pic) {
+			// picmip was applied before the texture was cached
+			image = R_CreateImage2((char *)name, pic, width, height, picFormat, picNumMips, type,
+								   flags & ~IMGFLAG_PICMIP, 0);
+			ri.Free(pic);
+			return image;
+		}
+	}
+
 	//
 	// load the pic from disk
 	//
@@ -2328,6 +2462,10 @@ image_t *R_FindImageFile(const char *name, imgType_t type, imgFlags_t flags) {
 
 	image = R_CreateImage2((char *)name, pic, width, height, picFormat, picNumMips, type, flags, 0);
 	ri.Free(pic);
+
+	if (cacheable && picFormat == GL_RGBA8)
+		R_SaveTextureCache(image, cacheName);
+
 	return image;
 }
 
@@ -2513,6 +2651,15 @@ void R_CreateBuiltinImages(void) {
 	R_CreateDlightImage();
 	R_CreateFogImage();
 
+	if (r_dlightClusters->integer) {
+		tr.dlightGridImage = R_CreateImage("*dlightGrid", NULL, DLIGHT_GRID_X * DLIGHT_GRID_Y, DLIGHT_GRID_Z,
+										   IMGTYPE_COLORALPHA, IMGFLAG_NO_COMPRESSION | IMGFLAG_CLAMPTOEDGE, GL_RGBA8);
+
+		// texels are light bit masks, never filter them
+		qglTextureParameterfEXT(tr.dlightGridImage->texnum, GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		qglTextureParameterfEXT(tr.dlightGridImage->texnum, GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	}
+
 	if (glRefConfig.framebufferObject) {
 		int width, height, hdrFormat, rgbFormat;
 
@@ -2575,6 +2722,12 @@ void R_CreateBuiltinImages(void) {
 		if (r_ssao->integer) {
 			tr.screenSsaoImage = R_CreateImage("*screenSsao", NULL, width / 2, height / 2, IMGTYPE_COLORALPHA,
 											   IMGFLAG_NO_COMPRESSION | IMGFLAG_CLAMPTOEDGE, GL_RGBA8);
+
+			// occlusion at a quarter of the width and height, the depth aware
+			// blur brings it back up to the half size one
+			if (r_ssao->integer > 1)
+				tr.ssaoLowImage = R_CreateImage("*ssaoLow", NULL, width / 4, height / 4, IMGTYPE_COLORALPHA,
+												IMGFLAG_NO_COMPRESSION | IMGFLAG_CLAMPTOEDGE, GL_RGBA8);
 		}
 
 		for (x = 0; x < MAX_DRAWN_PSHADOWS; x++) {
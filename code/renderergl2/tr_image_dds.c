@@ -466,3 +466,82 @@ void R_SaveDDS(const char *filename, byte *pic, int width, int height, int depth
 
 	ri.Free(data);
 }
+
+/*
+================
+R_SaveCompressedDDS
+
+Writes a mip chain that is already in one of the block compressed
+formats the texture cache produces. Returns qfalse for other formats.
+================
+*/
+qboolean R_SaveCompressedDDS(const char *filename, byte *pic, int picSize, int width, int height, int numMips,
+							 GLenum picFormat) {
+	byte *data;
+	ddsHeader_t *ddsHeader;
+	ddsHeaderDxt10_t *ddsHeaderDxt10 = NULL;
+	ui32_t fourCC;
+	int headerSize, size;
+
+	switch (picFormat) {
+	case GL_COMPRESSED_RGB_S3TC_DXT1_EXT:
+	case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
+		fourCC = EncodeFourCC("DXT1");
+		break;
+	case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
+		fourCC = EncodeFourCC("DXT5");
+		break;
+	case GL_COMPRESSED_RG_RGTC2:
+		fourCC = EncodeFourCC("ATI2");
+		break;
+	case GL_COMPRESSED_RGBA_BPTC_UNORM_ARB:
+		fourCC = EncodeFourCC("DX10");
+		break;
+	default:
+		return qfalse;
+	}
+
+	headerSize = 4 + sizeof(*ddsHeader);
+	if (fourCC == EncodeFourCC("DX10"))
+		headerSize += sizeof(*ddsHeaderDxt10);
+
+	size = headerSize + picSize;
+	data = ri.Malloc(size);
+
+	data[0] = 'D';
+	data[1] = 'D';
+	data[2] = 'S';
+	data[3] = ' ';
+
+	ddsHeader = (ddsHeader_t *)(data + 4);
+	memset(ddsHeader, 0, sizeof(ddsHeader_t));
+
+	ddsHeader->headerSize = 0x7c;
+	ddsHeader->flags = _DDSFLAGS_REQUIRED | _DDSFLAGS_MIPMAPCOUNT;
+	ddsHeader->height = height;
+	ddsHeader->width = width;
+	ddsHeader->numMips = numMips;
+	ddsHeader->always_0x00000020 = 0x00000020;
+	ddsHeader->caps = DDSCAPS_REQUIRED;
+	if (numMips > 1)
+		ddsHeader->caps |= DDSCAPS_COMPLEX | DDSCAPS_MIPMAP;
+
+	ddsHeader->pixelFormatFlags = DDSPF_FOURCC;
+	ddsHeader->fourCC = fourCC;
+
+	if (fourCC == EncodeFourCC("DX10")) {
+		ddsHeaderDxt10 = (ddsHeaderDxt10_t *)(data + 4 + sizeof(*ddsHeader));
+		memset(ddsHeaderDxt10, 0, sizeof(*ddsHeaderDxt10));
+		ddsHeaderDxt10->dxgiFormat = DXGI_FORMAT_BC7_UNORM;
+		ddsHeaderDxt10->dimensions = 3; // D3D10_RESOURCE_DIMENSION_TEXTURE2D
+		ddsHeaderDxt10->arraySize = 1;
+	}
+
+	Com_Memcpy(data + headerSize, pic, picSize);
+
+	ri.FS_WriteFile(filename, data, size);
+
+	ri.Free(data);
+
+	return qtrue;
+}
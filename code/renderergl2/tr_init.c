@@ -61,6 +61,7 @@ cvar_t *r_zproj;
 cvar_t *r_stereoSeparation;
 
 cvar_t *r_skipBackEnd;
+cvar_t *r_smp;
 
 cvar_t *r_stereoEnabled;
 cvar_t *r_anaglyphMode;
@@ -87,6 +88,10 @@ cvar_t *r_fullbright;
 cvar_t *r_novis;
 cvar_t *r_nocull;
 cvar_t *r_facePlaneCull;
+cvar_t *r_mergeLeafSurfaces;
+cvar_t *r_shadowViewThreads;
+
+cvar_t *r_gpuTimers;
 cvar_t *r_showcluster;
 cvar_t *r_nocurves;
 
@@ -104,11 +109,15 @@ cvar_t *r_ext_texture_float;
 cvar_t *r_ext_framebuffer_multisample;
 cvar_t *r_arb_seamless_cube_map;
 cvar_t *r_arb_vertex_array_object;
+cvar_t *r_arb_draw_instanced;
+cvar_t *r_arb_get_program_binary;
+cvar_t *r_arb_parallel_shader_compile;
 cvar_t *r_ext_direct_state_access;
 
 cvar_t *r_cameraExposure;
 
 cvar_t *r_externalGLSL;
+cvar_t *r_glslLazy;
 
 cvar_t *r_hdr;
 cvar_t *r_floatLightmap;
@@ -146,10 +155,13 @@ cvar_t *r_baseGloss;
 cvar_t *r_glossType;
 cvar_t *r_mergeLightmaps;
 cvar_t *r_dlightMode;
+cvar_t *r_dlightClusters;
 cvar_t *r_pshadowDist;
 cvar_t *r_imageUpsample;
 cvar_t *r_imageUpsampleMaxSize;
 cvar_t *r_imageUpsampleType;
+cvar_t *r_textureCache;
+cvar_t *r_cubemapCache;
 cvar_t *r_genNormalMaps;
 cvar_t *r_forceSun;
 cvar_t *r_forceSunLightScale;
@@ -186,6 +198,9 @@ cvar_t *r_singleShader;
 cvar_t *r_roundImagesDown;
 cvar_t *r_colorMipLevels;
 cvar_t *r_picmip;
+cvar_t *r_imageThreads;
+cvar_t *r_shaderThreads;
+cvar_t *r_shaderCache;
 cvar_t *r_showtris;
 cvar_t *r_showsky;
 cvar_t *r_shownormals;
@@ -200,6 +215,7 @@ cvar_t *r_intensity;
 cvar_t *r_lockpvs;
 cvar_t *r_noportals;
 cvar_t *r_portalOnly;
+cvar_t *r_portalOcclusion;
 
 cvar_t *r_subdivisions;
 cvar_t *r_lodCurveError;
@@ -282,6 +298,16 @@ static void InitOpenGL(void) {
 		if (glRefConfig.glslMaxAnimatedBones < 12) {
 			glRefConfig.glslMaxAnimatedBones = 0;
 		}
+
+		// two matrices per instance, gl_InstanceID needs the #version 150 header
+		glRefConfig.glslMaxInstances = 0;
+		if (glRefConfig.drawInstanced &&
+			(glRefConfig.glslMajorVersion > 1 || (glRefConfig.glslMajorVersion == 1 && glRefConfig.glslMinorVersion >= 50))) {
+			glRefConfig.glslMaxInstances = Com_Clamp(0, MAX_GLSL_INSTANCES, (temp - 160) / 32);
+			if (glRefConfig.glslMaxInstances < 4) {
+				glRefConfig.glslMaxInstances = 0;
+			}
+		}
 	}
 
 	// check for GLSL function textureCubeLod()
@@ -571,6 +597,9 @@ void R_TakeScreenshot(int x, int y, int width, int height, char *name, qboolean
 	}
 	cmd->commandId = RC_SCREENSHOT;
 
+	// the back end writes the file
+	tr.smpSyncFrame = qtrue;
+
 	cmd->x = x;
 	cmd->y = y;
 	cmd->width = width;
@@ -826,6 +855,8 @@ void R_ExportCubemaps(void) {
 		return;
 	}
 	cmd->commandId = RC_EXPORT_CUBEMAPS;
+	cmd->toCache = qfalse;
+	tr.smpSyncFrame = qtrue;
 }
 
 /*
@@ -839,27 +870,52 @@ void R_ExportCubemaps_f(void) {
 
 //============================================================================
 
+/*
+==============================================================================
+
+VIDEO FRAME READBACK
+
+With GL_ARB_sync the video frames are read into a ring of pixel pack buffers
+and only mapped when their slot comes around again, VIDEO_READBACK_FRAMES
+frames later, so glReadPixels doesn't stall the pipeline every frame.
+RE_FinishVideoFrames writes out the frames still in the ring before the
+client closes the video file.
+
+==============================================================================
+*/
+
+#define VIDEO_READBACK_FRAMES 3
+
+typedef struct {
+	GLuint buffer;
+	int size;
+
+	GLsync fence; // set while the slot holds a frame
+	int width;
+	int height;
+	byte *captureBuffer;
+	byte *encodeBuffer;
+	qboolean motionJpeg;
+} videoReadback_t;
+
+static videoReadback_t videoReadback[VIDEO_READBACK_FRAMES];
+static int videoReadbackNext; // oldest slot, and the next one read into
+
 /*
 ==================
-RB_TakeVideoFrameCmd
+RB_EncodeVideoFrame
+
+cBuf holds the frame as read with glReadPixels, padded to GL_PACK_ALIGNMENT
 ==================
 */
-const void *RB_TakeVideoFrameCmd(const void *data) {
-	const videoFrameCommand_t *cmd;
-	byte *cBuf;
+static void RB_EncodeVideoFrame(byte *cBuf, int width, int height, qboolean motionJpeg, byte *encodeBuffer) {
 	size_t memcount, linelen;
 	int padwidth, avipadwidth, padlen, avipadlen;
 	GLint packAlign;
 
-	// finish any 2D drawing if needed
-	if (tess.numIndexes)
-		RB_EndSurface();
-
-	cmd = (const videoFrameCommand_t *)data;
-
 	qglGetIntegerv(GL_PACK_ALIGNMENT, &packAlign);
 
-	linelen = cmd->width * 3;
+	linelen = width * 3;
 
 	// Alignment stuff for glReadPixels
 	padwidth = PAD(linelen, packAlign);
@@ -868,26 +924,22 @@ const void *RB_TakeVideoFrameCmd(const void *data) {
 	avipadwidth = PAD(linelen, AVI_LINE_PADDING);
 	avipadlen = avipadwidth - linelen;
 
-	cBuf = PADP(cmd->captureBuffer, packAlign);
-
-	qglReadPixels(0, 0, cmd->width, cmd->height, GL_RGB, GL_UNSIGNED_BYTE, cBuf);
-
-	memcount = padwidth * cmd->height;
+	memcount = padwidth * height;
 
 	// gamma correct
 	if (glConfig.deviceSupportsGamma)
 		R_GammaCorrect(cBuf, memcount);
 
-	if (cmd->motionJpeg) {
-		memcount = RE_SaveJPGToBuffer(cmd->encodeBuffer, linelen * cmd->height, r_aviMotionJpegQuality->integer,
-									  cmd->width, cmd->height, cBuf, padlen);
-		ri.CL_WriteAVIVideoFrame(cmd->encodeBuffer, memcount);
+	if (motionJpeg) {
+		memcount = RE_SaveJPGToBuffer(encodeBuffer, linelen * height, r_aviMotionJpegQuality->integer, width, height,
+									  cBuf, padlen);
+		ri.CL_WriteAVIVideoFrame(encodeBuffer, memcount);
 	} else {
 		byte *lineend, *memend;
 		byte *srcptr, *destptr;
 
 		srcptr = cBuf;
-		destptr = cmd->encodeBuffer;
+		destptr = encodeBuffer;
 		memend = srcptr + memcount;
 
 		// swap R and B and remove line paddings
@@ -906,8 +958,140 @@ const void *RB_TakeVideoFrameCmd(const void *data) {
 			srcptr += padlen;
 		}
 
-		ri.CL_WriteAVIVideoFrame(cmd->encodeBuffer, avipadwidth * cmd->height);
+		ri.CL_WriteAVIVideoFrame(encodeBuffer, avipadwidth * height);
+	}
+}
+
+/*
+==================
+RB_FinishVideoReadback
+
+Maps the slot's pixel pack buffer, normally long done by now, and encodes it
+==================
+*/
+static void RB_FinishVideoReadback(videoReadback_t *slot) {
+	GLint packAlign;
+	byte *cBuf;
+	void *data;
+
+	if (!slot->fence)
+		return;
+
+	qglClientWaitSync(slot->fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+	qglDeleteSync(slot->fence);
+	slot->fence = NULL;
+
+	qglGetIntegerv(GL_PACK_ALIGNMENT, &packAlign);
+	cBuf = PADP(slot->captureBuffer, packAlign);
+
+	qglBindBuffer(GL_PIXEL_PACK_BUFFER, slot->buffer);
+	data = qglMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, slot->size, GL_MAP_READ_BIT);
+	if (data) {
+		Com_Memcpy(cBuf, data, slot->size);
+		qglUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+	}
+	qglBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+	if (data)
+		RB_EncodeVideoFrame(cBuf, slot->width, slot->height, slot->motionJpeg, slot->encodeBuffer);
+}
+
+/*
+==================
+RB_FinishVideoFrames
+
+Encodes the frames still in the ring, oldest first
+==================
+*/
+void RB_FinishVideoFrames(void) {
+	int i;
+
+	for (i = 0; i < VIDEO_READBACK_FRAMES; i++) {
+		RB_FinishVideoReadback(&videoReadback[videoReadbackNext]);
+		videoReadbackNext = (videoReadbackNext + 1) % VIDEO_READBACK_FRAMES;
 	}
+}
+
+/*
+==================
+RB_ShutdownVideoReadback
+==================
+*/
+void RB_ShutdownVideoReadback(void) {
+	int i;
+
+	RB_FinishVideoFrames();
+
+	for (i = 0; i < VIDEO_READBACK_FRAMES; i++) {
+		if (videoReadback[i].buffer)
+			qglDeleteBuffers(1, &videoReadback[i].buffer);
+	}
+
+	Com_Memset(videoReadback, 0, sizeof(videoReadback));
+	videoReadbackNext = 0;
+}
+
+/*
+==================
+RB_QueueVideoFrame
+==================
+*/
+static void RB_QueueVideoFrame(const videoFrameCommand_t *cmd, int size) {
+	videoReadback_t *slot = &videoReadback[videoReadbackNext];
+
+	// the ring is full, the oldest frame goes out first
+	RB_FinishVideoReadback(slot);
+
+	if (!slot->buffer)
+		qglGenBuffers(1, &slot->buffer);
+
+	qglBindBuffer(GL_PIXEL_PACK_BUFFER, slot->buffer);
+	if (slot->size != size) {
+		qglBufferData(GL_PIXEL_PACK_BUFFER, size, NULL, GL_STREAM_READ);
+		slot->size = size;
+	}
+
+	qglReadPixels(0, 0, cmd->width, cmd->height, GL_RGB, GL_UNSIGNED_BYTE, NULL);
+	qglBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+	slot->fence = qglFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	slot->width = cmd->width;
+	slot->height = cmd->height;
+	slot->captureBuffer = cmd->captureBuffer;
+	slot->encodeBuffer = cmd->encodeBuffer;
+	slot->motionJpeg = cmd->motionJpeg;
+
+	videoReadbackNext = (videoReadbackNext + 1) % VIDEO_READBACK_FRAMES;
+}
+
+/*
+==================
+RB_TakeVideoFrameCmd
+==================
+*/
+const void *RB_TakeVideoFrameCmd(const void *data) {
+	const videoFrameCommand_t *cmd;
+	byte *cBuf;
+	GLint packAlign;
+
+	// finish any 2D drawing if needed
+	if (tess.numIndexes)
+		RB_EndSurface();
+
+	cmd = (const videoFrameCommand_t *)data;
+
+	qglGetIntegerv(GL_PACK_ALIGNMENT, &packAlign);
+
+	if (glRefConfig.asyncReadback) {
+		RB_QueueVideoFrame(cmd, PAD(cmd->width * 3, packAlign) * cmd->height);
+		return (const void *)(cmd + 1);
+	}
+
+	cBuf = PADP(cmd->captureBuffer, packAlign);
+
+	qglReadPixels(0, 0, cmd->width, cmd->height, GL_RGB, GL_UNSIGNED_BYTE, cBuf);
+
+	RB_EncodeVideoFrame(cBuf, cmd->width, cmd->height, cmd->motionJpeg, cmd->encodeBuffer);
 
 	return (const void *)(cmd + 1);
 }
@@ -996,6 +1180,8 @@ void GfxInfo_f(void) {
 	const char *enablestrings[] = {"disabled", "enabled"};
 	const char *fsstrings[] = {"windowed", "fullscreen"};
 
+	R_SyncRenderThread();
+
 	ri.Printf(PRINT_ALL, "\nGL_VENDOR: %s\n", glConfig.vendor_string);
 	ri.Printf(PRINT_ALL, "GL_RENDERER: %s\n", glConfig.renderer_string);
 	ri.Printf(PRINT_ALL, "GL_VERSION: %s\n", glConfig.version_string);
@@ -1047,6 +1233,9 @@ void GfxInfo_f(void) {
 	if (r_finish->integer) {
 		ri.Printf(PRINT_ALL, "Forcing glFinish\n");
 	}
+	if (glConfig.smpActive) {
+		ri.Printf(PRINT_ALL, "Using dual processor acceleration\n");
+	}
 }
 
 /*
@@ -1055,6 +1244,8 @@ GfxMemInfo_f
 ================
 */
 void GfxMemInfo_f(void) {
+	R_SyncRenderThread();
+
 	switch (glRefConfig.memInfo) {
 	case MI_NONE: {
 		ri.Printf(PRINT_ALL, "No extension found for GPU memory info.\n");
@@ -1120,6 +1311,9 @@ void R_Register(void) {
 	r_ext_framebuffer_multisample = ri.Cvar_Get("r_ext_framebuffer_multisample", "0", CVAR_ARCHIVE | CVAR_LATCH);
 	r_arb_seamless_cube_map = ri.Cvar_Get("r_arb_seamless_cube_map", "0", CVAR_ARCHIVE | CVAR_LATCH);
 	r_arb_vertex_array_object = ri.Cvar_Get("r_arb_vertex_array_object", "1", CVAR_ARCHIVE | CVAR_LATCH);
+	r_arb_draw_instanced = ri.Cvar_Get("r_arb_draw_instanced", "1", CVAR_ARCHIVE | CVAR_LATCH);
+	r_arb_get_program_binary = ri.Cvar_Get("r_arb_get_program_binary", "1", CVAR_ARCHIVE | CVAR_LATCH);
+	r_arb_parallel_shader_compile = ri.Cvar_Get("r_arb_parallel_shader_compile", "1", CVAR_ARCHIVE | CVAR_LATCH);
 	r_ext_direct_state_access = ri.Cvar_Get("r_ext_direct_state_access", "1", CVAR_ARCHIVE | CVAR_LATCH);
 
 	r_ext_texture_filter_anisotropic = ri.Cvar_Get("r_ext_texture_filter_anisotropic", "0", CVAR_ARCHIVE | CVAR_LATCH);
@@ -1149,10 +1343,12 @@ void R_Register(void) {
 	r_uiFullScreen = ri.Cvar_Get("r_uifullscreen", "0", 0);
 	r_subdivisions = ri.Cvar_Get("r_subdivisions", "4", CVAR_ARCHIVE | CVAR_LATCH);
 	r_stereoEnabled = ri.Cvar_Get("r_stereoEnabled", "0", CVAR_ARCHIVE | CVAR_LATCH);
+	r_smp = ri.Cvar_Get("r_smp", "0", CVAR_ARCHIVE | CVAR_LATCH);
 	r_greyscale = ri.Cvar_Get("r_greyscale", "0", CVAR_ARCHIVE | CVAR_LATCH);
 	ri.Cvar_CheckRange(r_greyscale, 0, 1, qfalse);
 
 	r_externalGLSL = ri.Cvar_Get("r_externalGLSL", "0", CVAR_LATCH);
+	r_glslLazy = ri.Cvar_Get("r_glslLazy", "1", CVAR_ARCHIVE | CVAR_LATCH);
 
 	r_hdr = ri.Cvar_Get("r_hdr", "1", CVAR_ARCHIVE | CVAR_LATCH);
 	r_floatLightmap = ri.Cvar_Get("r_floatLightmap", "0", CVAR_ARCHIVE | CVAR_LATCH);
@@ -1191,11 +1387,14 @@ void R_Register(void) {
 	r_baseGloss = ri.Cvar_Get("r_baseGloss", "0.3", CVAR_ARCHIVE | CVAR_LATCH);
 	r_glossType = ri.Cvar_Get("r_glossType", "1", CVAR_ARCHIVE | CVAR_LATCH);
 	r_dlightMode = ri.Cvar_Get("r_dlightMode", "0", CVAR_ARCHIVE | CVAR_LATCH);
+	r_dlightClusters = ri.Cvar_Get("r_dlightClusters", "1", CVAR_ARCHIVE | CVAR_LATCH);
 	r_pshadowDist = ri.Cvar_Get("r_pshadowDist", "128", CVAR_ARCHIVE);
 	r_mergeLightmaps = ri.Cvar_Get("r_mergeLightmaps", "1", CVAR_ARCHIVE | CVAR_LATCH);
 	r_imageUpsample = ri.Cvar_Get("r_imageUpsample", "0", CVAR_ARCHIVE | CVAR_LATCH);
 	r_imageUpsampleMaxSize = ri.Cvar_Get("r_imageUpsampleMaxSize", "1024", CVAR_ARCHIVE | CVAR_LATCH);
 	r_imageUpsampleType = ri.Cvar_Get("r_imageUpsampleType", "1", CVAR_ARCHIVE | CVAR_LATCH);
+	r_textureCache = ri.Cvar_Get("r_textureCache", "1", CVAR_ARCHIVE | CVAR_LATCH);
+	r_cubemapCache = ri.Cvar_Get("r_cubemapCache", "1", CVAR_ARCHIVE | CVAR_LATCH);
 	r_genNormalMaps = ri.Cvar_Get("r_genNormalMaps", "0", CVAR_ARCHIVE | CVAR_LATCH);
 
 	r_forceSun = ri.Cvar_Get("r_forceSun", "0", CVAR_CHEAT);
@@ -1240,10 +1439,20 @@ void R_Register(void) {
 	r_dynamiclight = ri.Cvar_Get("r_dynamiclight", "1", CVAR_ARCHIVE);
 	r_dlightBacks = ri.Cvar_Get("r_dlightBacks", "1", CVAR_ARCHIVE);
 	r_finish = ri.Cvar_Get("r_finish", "0", CVAR_ARCHIVE);
+	r_imageThreads = ri.Cvar_Get("r_imageThreads", "4", CVAR_ARCHIVE);
+	ri.Cvar_CheckRange(r_imageThreads, 0, MAX_JOB_THREADS, qtrue);
+	r_shaderThreads = ri.Cvar_Get("r_shaderThreads", "4", CVAR_ARCHIVE);
+	ri.Cvar_CheckRange(r_shaderThreads, 0, MAX_JOB_THREADS, qtrue);
+	r_shaderCache = ri.Cvar_Get("r_shaderCache", "1", CVAR_ARCHIVE);
 	r_textureMode = ri.Cvar_Get("r_textureMode", "GL_LINEAR_MIPMAP_LINEAR", CVAR_ARCHIVE);
 	r_swapInterval = ri.Cvar_Get("r_swapInterval", "0", CVAR_ARCHIVE | CVAR_LATCH);
 	r_gamma = ri.Cvar_Get("r_gamma", "1", CVAR_ARCHIVE);
 	r_facePlaneCull = ri.Cvar_Get("r_facePlaneCull", "1", CVAR_ARCHIVE);
+	r_mergeLeafSurfaces = ri.Cvar_Get("r_mergeLeafSurfaces", "1", CVAR_ARCHIVE | CVAR_LATCH);
+	r_shadowViewThreads = ri.Cvar_Get("r_shadowViewThreads", "4", CVAR_ARCHIVE);
+	ri.Cvar_CheckRange(r_shadowViewThreads, 0, MAX_JOB_THREADS, qtrue);
+
+	r_gpuTimers = ri.Cvar_Get("r_gpuTimers", "0", CVAR_ARCHIVE);
 
 	r_railWidth = ri.Cvar_Get("r_railWidth", "16", CVAR_ARCHIVE);
 	r_railCoreWidth = ri.Cvar_Get("r_railCoreWidth", "6", CVAR_ARCHIVE);
@@ -1297,6 +1506,7 @@ void R_Register(void) {
 	r_drawBuffer = ri.Cvar_Get("r_drawBuffer", "GL_BACK", CVAR_CHEAT);
 	r_lockpvs = ri.Cvar_Get("r_lockpvs", "0", CVAR_CHEAT);
 	r_noportals = ri.Cvar_Get("r_noportals", "0", CVAR_CHEAT);
+	r_portalOcclusion = ri.Cvar_Get("r_portalOcclusion", "1", CVAR_ARCHIVE);
 	r_shadows = ri.Cvar_Get("cg_shadows", "1", 0);
 
 	r_marksOnTriangleMeshes = ri.Cvar_Get("r_marksOnTriangleMeshes", "0", CVAR_ARCHIVE);
@@ -1323,19 +1533,50 @@ void R_Register(void) {
 }
 
 void R_InitQueries(void) {
+	int i;
+
+	tr.gpuTimerPhase = -1;
+
+	if (glRefConfig.timerQuery) {
+		for (i = 0; i < GPUTIMER_FRAMES; i++)
+			qglGenQueries(GPUTIMER_QUERIES, tr.gpuTimerFrames[i].queries);
+	}
+
 	if (!glRefConfig.occlusionQuery)
 		return;
 
 	if (r_drawSunRays->integer)
 		qglGenQueries(ARRAY_LEN(tr.sunFlareQuery), tr.sunFlareQuery);
+
+	for (i = 0; i < MAX_PORTAL_QUERIES; i++) {
+		qglGenQueries(1, &tr.portalQueries[i].query);
+		tr.portalQueries[i].shaderIndex = -1;
+		tr.portalQueries[i].active = qfalse;
+		tr.portalQueries[i].occluded = qfalse;
+	}
 }
 
 void R_ShutDownQueries(void) {
+	int i;
+
+	if (glRefConfig.timerQuery) {
+		if (tr.gpuTimerPhase >= 0)
+			qglEndQuery(GL_TIME_ELAPSED);
+
+		for (i = 0; i < GPUTIMER_FRAMES; i++)
+			qglDeleteQueries(GPUTIMER_QUERIES, tr.gpuTimerFrames[i].queries);
+	}
+
 	if (!glRefConfig.occlusionQuery)
 		return;
 
 	if (r_drawSunRays->integer)
 		qglDeleteQueries(ARRAY_LEN(tr.sunFlareQuery), tr.sunFlareQuery);
+
+	for (i = 0; i < MAX_PORTAL_QUERIES; i++) {
+		qglDeleteQueries(1, &tr.portalQueries[i].query);
+		tr.portalQueries[i].shaderIndex = -1;
+	}
 }
 
 /*
@@ -1400,11 +1641,18 @@ void R_Init(void) {
 	if (max_polyverts < MAX_POLYVERTS)
 		max_polyverts = MAX_POLYVERTS;
 
-	ptr =
-		ri.Hunk_Alloc(sizeof(*backEndData) + sizeof(srfPoly_t) * max_polys + sizeof(polyVert_t) * max_polyverts, h_low);
-	backEndData = (backEndData_t *)ptr;
-	backEndData->polys = (srfPoly_t *)((char *)ptr + sizeof(*backEndData));
-	backEndData->polyVerts = (polyVert_t *)((char *)ptr + sizeof(*backEndData) + sizeof(srfPoly_t) * max_polys);
+	// with a render thread the front end fills one buffer while the other is drawn
+	Com_Memset(smpBackEndData, 0, sizeof(smpBackEndData));
+	for (i = 0; i < (r_smp->integer ? SMP_FRAMES : 1); i++) {
+		ptr = ri.Hunk_Alloc(sizeof(*backEndData) + sizeof(srfPoly_t) * max_polys + sizeof(polyVert_t) * max_polyverts,
+							h_low);
+		smpBackEndData[i] = (backEndData_t *)ptr;
+		smpBackEndData[i]->polys = (srfPoly_t *)((char *)ptr + sizeof(*backEndData));
+		smpBackEndData[i]->polyVerts =
+			(polyVert_t *)((char *)ptr + sizeof(*backEndData) + sizeof(srfPoly_t) * max_polys);
+	}
+	backEndData = smpBackEndData[0];
+	tr.smpFrame = 0;
 	R_InitNextFrame();
 
 	InitOpenGL();
@@ -1432,6 +1680,14 @@ void R_Init(void) {
 	if (err != GL_NO_ERROR)
 		ri.Printf(PRINT_ALL, "glGetError() = 0x%x\n", err);
 
+	if (r_smp->integer) {
+		if (GLimp_SpawnRenderThread(RB_RenderThread)) {
+			glConfig.smpActive = qtrue;
+		} else {
+			ri.Printf(PRINT_WARNING, "WARNING: r_smp: couldn't start the render thread\n");
+		}
+	}
+
 	// print info
 	GfxInfo_f();
 	ri.Printf(PRINT_ALL, "----- finished R_Init -----\n");
@@ -1458,8 +1714,16 @@ void RE_Shutdown(qboolean destroyWindow) {
 	ri.Cmd_RemoveCommand("gfxmeminfo");
 	ri.Cmd_RemoveCommand("exportCubemaps");
 
+	if (glConfig.smpActive) {
+		R_SyncRenderThread();
+		GLimp_ShutdownRenderThread();
+		glConfig.smpActive = qfalse;
+	}
+
 	if (tr.registered) {
 		R_IssuePendingRenderCommands();
+		if (glRefConfig.asyncReadback)
+			RB_ShutdownVideoReadback();
 		R_ShutDownQueries();
 		if (glRefConfig.framebufferObject)
 			FBO_Shutdown();
@@ -1468,6 +1732,7 @@ void RE_Shutdown(qboolean destroyWindow) {
 		GLSL_ShutdownGPUShaders();
 	}
 
+	R_FlushPrefetchedImages();
 	R_DoneFreeType();
 
 	// shut down platform specific OpenGL stuff
@@ -1495,6 +1760,7 @@ Touch all images to make sure they are resident
 =============
 */
 void RE_EndRegistration(void) {
+	R_FlushPrefetchedImages();
 	R_IssuePendingRenderCommands();
 	if (!ri.Sys_LowPhysicalMemory()) {
 		RB_ShowImages();
@@ -1563,6 +1829,7 @@ refexport_t *GetRefAPI(int apiVersion, refimport_t *rimp) {
 	re.inPVS = R_inPVS;
 
 	re.TakeVideoFrame = RE_TakeVideoFrame;
+	re.FinishVideoFrames = RE_FinishVideoFrames;
 
 	return &re;
 }
@@ -45,6 +45,12 @@ QGL_3_0_PROCS
 QGL_ARB_occlusion_query_PROCS
 QGL_ARB_framebuffer_object_PROCS
 QGL_ARB_vertex_array_object_PROCS
+QGL_ARB_draw_instanced_PROCS
+QGL_ARB_timer_query_PROCS
+QGL_ARB_get_program_binary_PROCS
+QGL_ARB_parallel_shader_compile_PROCS
+QGL_ARB_map_buffer_range_PROCS
+QGL_ARB_sync_PROCS
 QGL_EXT_direct_state_access_PROCS
 #undef GLE
 
@@ -63,6 +69,8 @@ typedef unsigned int glIndex_t;
 #define MAX_VISCOUNTS 5
 #define MAX_VAOS 4096
 
+#define MAX_GLSL_INSTANCES 64 // entities per instanced draw
+
 #define MAX_CALC_PSHADOWS 64
 #define MAX_DRAWN_PSHADOWS 16 // do not increase past 32, because bit flags are used on surfaces
 #define PSHADOW_MAP_SIZE 512
@@ -72,6 +80,7 @@ typedef struct cubemap_s {
 	vec3_t origin;
 	float parallaxRadius;
 	image_t *image;
+	qboolean baked; // rendered at load, not loaded from a file
 } cubemap_t;
 
 typedef struct dlight_s {
@@ -513,6 +522,7 @@ enum {
 	GENERICDEF_USE_FOG = 0x0008,
 	GENERICDEF_USE_RGBAGEN = 0x0010,
 	GENERICDEF_USE_BONE_ANIMATION = 0x0020,
+	GENERICDEF_USE_INSTANCING = GENERICDEF_USE_VERTEX_ANIMATION | GENERICDEF_USE_BONE_ANIMATION,
 	GENERICDEF_ALL = 0x003F,
 	GENERICDEF_COUNT = 0x0040,
 };
@@ -531,6 +541,12 @@ enum {
 	DLIGHTDEF_COUNT = 0x0002,
 };
 
+// clustered dlights: screen tiles by logarithmic depth slices,
+// each cell holding one bit per dlight
+#define DLIGHT_GRID_X 16
+#define DLIGHT_GRID_Y 8
+#define DLIGHT_GRID_Z 24
+
 enum {
 	LIGHTDEF_USE_LIGHTMAP = 0x0001,
 	LIGHTDEF_USE_LIGHT_VECTOR = 0x0002,
@@ -541,6 +557,7 @@ enum {
 	LIGHTDEF_USE_PARALLAXMAP = 0x0010,
 	LIGHTDEF_USE_SHADOWMAP = 0x0020,
 	LIGHTDEF_ENTITY_BONE_ANIMATION = 0x0040,
+	LIGHTDEF_ENTITY_INSTANCING = LIGHTDEF_ENTITY_VERTEX_ANIMATION | LIGHTDEF_ENTITY_BONE_ANIMATION,
 	LIGHTDEF_ALL = 0x007F,
 	LIGHTDEF_COUNT = 0x0080
 };
@@ -552,7 +569,18 @@ enum {
 	SHADOWMAPDEF_COUNT = 0x0004
 };
 
-enum { GLSL_INT, GLSL_FLOAT, GLSL_FLOAT5, GLSL_VEC2, GLSL_VEC3, GLSL_VEC4, GLSL_MAT16, GLSL_MAT16_BONEMATRIX };
+enum {
+	GLSL_INT,
+	GLSL_FLOAT,
+	GLSL_FLOAT5,
+	GLSL_VEC2,
+	GLSL_VEC3,
+	GLSL_VEC4,
+	GLSL_MAT16,
+	GLSL_MAT16_BONEMATRIX,
+	GLSL_MAT16_INSTANCES,
+	GLSL_VEC4_DLIGHTS
+};
 
 typedef enum {
 	UNIFORM_DIFFUSEMAP = 0,
@@ -573,6 +601,8 @@ typedef enum {
 	UNIFORM_SHADOWMAP3,
 	UNIFORM_SHADOWMAP4,
 
+	UNIFORM_DLIGHTGRIDMAP,
+
 	UNIFORM_SHADOWMVP,
 	UNIFORM_SHADOWMVP2,
 	UNIFORM_SHADOWMVP3,
@@ -597,6 +627,10 @@ typedef enum {
 	UNIFORM_VERTCOLOR,
 
 	UNIFORM_DLIGHTINFO,
+	UNIFORM_DLIGHTGRIDINFO,
+	UNIFORM_DLIGHTGRIDDEPTH,
+	UNIFORM_DLIGHTORIGINS,
+	UNIFORM_DLIGHTCOLORS,
 	UNIFORM_LIGHTFORWARD,
 	UNIFORM_LIGHTUP,
 	UNIFORM_LIGHTRIGHT,
@@ -643,6 +677,9 @@ typedef enum {
 
 	UNIFORM_BONEMATRIX,
 
+	UNIFORM_INSTANCEMATRIX,
+	UNIFORM_INSTANCELIGHT,
+
 	UNIFORM_COUNT
 } uniform_t;
 
@@ -655,6 +692,7 @@ typedef struct shaderProgram_s {
 	GLuint vertexShader;
 	GLuint fragmentShader;
 	uint32_t attribs; // vertex array attributes
+	uint32_t cacheHash; // program binary cache key, 0 once saved
 
 	// uniform parameters
 	GLint uniforms[UNIFORM_COUNT];
@@ -1073,6 +1111,7 @@ typedef struct {
 typedef struct {
 	char name[MAX_QPATH];	  // ie: maps/tim_dm2.bsp
 	char baseName[MAX_QPATH]; // ie: tim_dm2
+	unsigned int checksum;	  // of the bsp file, keys the cubemap cache
 
 	int dataSize;
 
@@ -1100,6 +1139,19 @@ typedef struct {
 	int nummarksurfaces;
 	int *marksurfaces;
 
+	// marksurfaces, with surfaces merged at load as -1 - index into mergedSurfaces
+	int *viewSurfaces;
+
+	int numMergedSurfaces;
+	msurface_t *mergedSurfaces;
+	int *mergedSurfacesViewCount;
+	int *mergedSurfacesDlightBits;
+	int *mergedSurfacesPshadowBits;
+
+	// per shadow view marks and surface lists for R_GatherShadowViews
+	int *shadowViewCounts;
+	int *shadowViewSurfaces;
+
 	int numfogs;
 	fog_t *fogs;
 
@@ -1284,6 +1336,9 @@ typedef struct {
 	qboolean vertexAnimation;
 	int boneAnimation; // number of bones
 	mat4_t boneMatrix[IQM_MAX_JOINTS];
+	int numInstances;						  // > 1 while drawing an instanced batch
+	mat4_t instanceMatrix[MAX_GLSL_INSTANCES]; // model to world
+	mat4_t instanceLight[MAX_GLSL_INSTANCES];  // ambient, directed, model light dir, light dir
 	uint32_t vertexAttribsEnabled; // global if no VAOs, tess only otherwise
 	FBO_t *currentFBO;
 	vao_t *currentVao;
@@ -1310,6 +1365,7 @@ typedef struct {
 	int glslMajorVersion;
 	int glslMinorVersion;
 	int glslMaxAnimatedBones;
+	int glslMaxInstances;
 
 	memInfo_t memInfo;
 
@@ -1328,6 +1384,11 @@ typedef struct {
 	qboolean seamlessCubeMap;
 
 	qboolean vertexArrayObject;
+	qboolean drawInstanced;
+	qboolean timerQuery;
+	qboolean programBinary;
+	qboolean parallelShaderCompile;
+	qboolean asyncReadback;
 	qboolean directStateAccess;
 } glRefConfig_t;
 
@@ -1356,9 +1417,47 @@ typedef struct {
 	int c_fogDraws;
 	int c_dlightDraws;
 
+	int c_instancedDraws;
+	int c_instancedEntities;
+
 	int msec; // total msec for backend run
 } backEndCounters_t;
 
+// backend phases timed on the GPU with GL_TIME_ELAPSED queries
+typedef enum {
+	GPUTIMER_SHADOWS, // shadow map views and copies
+	GPUTIMER_DEPTH,	  // depth prepass
+	GPUTIMER_SUNLIGHT, // screen space sun shadow mask
+	GPUTIMER_SSAO,
+	GPUTIMER_OPAQUE, // opaque world and entity surfaces
+	GPUTIMER_TRANSLUCENT,
+	GPUTIMER_POSTPROCESS, // tonemap, bloom, bokeh and sun rays
+	GPUTIMER_2D,
+	GPUTIMER_COUNT
+} gpuTimerPhase_t;
+
+#define MAX_PORTAL_QUERIES 8
+#define PORTAL_QUERY_FRAMES 3 // how many frames old a result may be and still skip a portal view
+
+// samples passed by the portal surfaces of one shader in the main view
+typedef struct {
+	GLuint query;
+	int shaderIndex; // -1 if unused
+	int queryFrame;	 // frame of the query in flight
+	qboolean active;
+	qboolean occluded; // no samples passed in resultFrame
+	int resultFrame;
+} portalQuery_t;
+
+#define GPUTIMER_FRAMES 4	// frames in flight before a result is read back
+#define GPUTIMER_QUERIES 64 // phase changes timed in one frame
+
+typedef struct {
+	GLuint queries[GPUTIMER_QUERIES];
+	gpuTimerPhase_t phases[GPUTIMER_QUERIES];
+	int numQueries;
+} gpuTimerFrame_t;
+
 // all state modified by the back end is separated
 // from the front end state
 typedef struct {
@@ -1379,6 +1478,7 @@ typedef struct {
 	qboolean colorMask[4];
 	qboolean framePostProcessed;
 	qboolean depthFill;
+	qboolean dlightGridBuilt; // cleared for each view
 } backEndState_t;
 
 /*
@@ -1415,6 +1515,7 @@ typedef struct {
 	image_t *scratchImage[MAX_VIDEO_HANDLES];
 	image_t *fogImage;
 	image_t *dlightImage; // inverse-quare highlight for projective adding
+	image_t *dlightGridImage; // per-view dlight bits, see RB_BuildDlightGrid
 	image_t *flareImage;
 	image_t *whiteImage;		 // full of 0xff
 	image_t *identityLightImage; // full of tr.identityLightByte
@@ -1434,6 +1535,7 @@ typedef struct {
 	image_t *sunShadowDepthImage[4];
 	image_t *screenShadowImage;
 	image_t *screenSsaoImage;
+	image_t *ssaoLowImage;
 	image_t *hdrDepthImage;
 	image_t *renderCubeImage;
 
@@ -1452,6 +1554,7 @@ typedef struct {
 	FBO_t *sunShadowFbo[4];
 	FBO_t *screenShadowFbo;
 	FBO_t *screenSsaoFbo;
+	FBO_t *ssaoLowFbo;
 	FBO_t *hdrDepthFbo;
 	FBO_t *renderCubeFbo;
 
@@ -1487,6 +1590,7 @@ typedef struct {
 	shaderProgram_t textureColorShader;
 	shaderProgram_t fogShader[FOGDEF_COUNT];
 	shaderProgram_t dlightShader[DLIGHTDEF_COUNT];
+	shaderProgram_t dlightGridShader[DLIGHTDEF_COUNT];
 	shaderProgram_t lightallShader[LIGHTDEF_COUNT];
 	shaderProgram_t shadowmapShader[SHADOWMAPDEF_COUNT];
 	shaderProgram_t pshadowShader;
@@ -1524,6 +1628,10 @@ typedef struct {
 	frontEndCounters_t pc;
 	int frontEndMsec; // not in pc due to clearing issue
 
+	int smpFrame;		   // which smpBackEndData the front end fills
+	qboolean smpSyncFrame; // draw this frame on the main thread
+	int smpBackEndMsec;	   // render thread time of the last frame
+
 	//
 	// put large tables at the end, so most elements will be
 	// within the +/32K indexed range on risc processors
@@ -1554,6 +1662,14 @@ typedef struct {
 	int sunFlareQueryIndex;
 	qboolean sunFlareQueryActive[2];
 
+	portalQuery_t portalQueries[MAX_PORTAL_QUERIES];
+
+	gpuTimerFrame_t gpuTimerFrames[GPUTIMER_FRAMES];
+	int gpuTimerFrame;					// the one being recorded
+	int gpuTimerPhase;					// phase of the open query, -1 if none
+	float gpuTimerMsec[GPUTIMER_COUNT]; // newest frame that came back
+	qboolean gpuTimerResults;			// gpuTimerMsec changed since the front end read it
+
 	float sinTable[FUNCTABLE_SIZE];
 	float squareTable[FUNCTABLE_SIZE];
 	float triangleTable[FUNCTABLE_SIZE];
@@ -1605,7 +1721,11 @@ extern cvar_t *r_speeds;		 // various levels of information display
 extern cvar_t *r_detailTextures; // enables/disables detail texturing stages
 extern cvar_t *r_novis;			 // disable/enable usage of PVS
 extern cvar_t *r_nocull;
-extern cvar_t *r_facePlaneCull; // enables culling of planar surfaces with back side test
+extern cvar_t *r_facePlaneCull;		// enables culling of planar surfaces with back side test
+extern cvar_t *r_mergeLeafSurfaces; // merge world surfaces of a cluster that share a shader at load
+extern cvar_t *r_shadowViewThreads; // job threads culling the world for sun cascades and dlight cubemaps
+
+extern cvar_t *r_gpuTimers; // time the backend phases on the GPU, see r_speeds 8
 extern cvar_t *r_nocurves;
 extern cvar_t *r_showcluster;
 
@@ -1617,6 +1737,9 @@ extern cvar_t *r_ext_texture_float;
 extern cvar_t *r_ext_framebuffer_multisample;
 extern cvar_t *r_arb_seamless_cube_map;
 extern cvar_t *r_arb_vertex_array_object;
+extern cvar_t *r_arb_draw_instanced;
+extern cvar_t *r_arb_get_program_binary;
+extern cvar_t *r_arb_parallel_shader_compile;
 extern cvar_t *r_ext_direct_state_access;
 
 extern cvar_t *r_nobind;	   // turns off binding to appropriate textures
@@ -1648,14 +1771,17 @@ extern cvar_t *r_intensity;
 extern cvar_t *r_lockpvs;
 extern cvar_t *r_noportals;
 extern cvar_t *r_portalOnly;
+extern cvar_t *r_portalOcclusion;
 
 extern cvar_t *r_subdivisions;
 extern cvar_t *r_lodCurveError;
 extern cvar_t *r_skipBackEnd;
+extern cvar_t *r_smp;
 
 extern cvar_t *r_anaglyphMode;
 
 extern cvar_t *r_externalGLSL;
+extern cvar_t *r_glslLazy; // compile lightall/generic permutations on first use
 
 extern cvar_t *r_hdr;
 extern cvar_t *r_floatLightmap;
@@ -1694,11 +1820,14 @@ extern cvar_t *r_baseSpecular;
 extern cvar_t *r_baseGloss;
 extern cvar_t *r_glossType;
 extern cvar_t *r_dlightMode;
+extern cvar_t *r_dlightClusters;
 extern cvar_t *r_pshadowDist;
 extern cvar_t *r_mergeLightmaps;
 extern cvar_t *r_imageUpsample;
 extern cvar_t *r_imageUpsampleMaxSize;
 extern cvar_t *r_imageUpsampleType;
+extern cvar_t *r_textureCache;
+extern cvar_t *r_cubemapCache;
 extern cvar_t *r_genNormalMaps;
 extern cvar_t *r_forceSun;
 extern cvar_t *r_forceSunLightScale;
@@ -1743,8 +1872,8 @@ static ID_INLINE qboolean ShaderRequiresCPUDeforms(const shader_t *shader) {
 		switch (ds->deformation) {
 		case DEFORM_WAVE:
 		case DEFORM_BULGE:
-			// need CPU deforms at high level-times to avoid floating point percision loss
-			return (backEnd.refdef.floatTime != (float)backEnd.refdef.floatTime);
+			// the time term is reduced to one period on the CPU, see ComputeDeformValues
+			return qfalse;
 
 		default:
 			return qtrue;
@@ -1761,7 +1890,7 @@ void R_SwapBuffers(int);
 void R_RenderView(viewParms_t *parms);
 void R_RenderDlightCubemaps(const refdef_t *fd);
 void R_RenderPshadowMaps(const refdef_t *fd);
-void R_RenderSunShadowMaps(const refdef_t *fd, int level);
+void R_RenderSunShadowMaps(const refdef_t *fd, const int *levels, int numLevels);
 void R_RenderCubemapSide(int cubemapIndex, int cubemapSide, qboolean subscene);
 
 void R_AddMD3Surfaces(trRefEntity_t *e);
@@ -1786,6 +1915,7 @@ qboolean R_CalcTangentVectors(srfVert_t *dv[3]);
 #define CULL_OUT 2	// completely outside the clipping planes
 void R_LocalNormalToWorld(const vec3_t local, vec3_t world);
 void R_LocalPointToWorld(const vec3_t local, vec3_t world);
+int R_CullBoxEx(vec3_t bounds[2], cplane_t *frustum, int numPlanes);
 int R_CullBox(vec3_t bounds[2]);
 int R_CullLocalBox(vec3_t bounds[2]);
 int R_CullPointAndRadiusEx(const vec3_t origin, float radius, const cplane_t *frustum, int numPlanes);
@@ -1857,6 +1987,7 @@ qhandle_t RE_RegisterSkin(const char *name);
 void RE_Shutdown(qboolean destroyWindow);
 
 qboolean R_GetEntityToken(char *buffer, int size);
+qboolean R_CubemapCacheName(int cubemapIndex, char *cacheName, int cacheNameSize);
 
 model_t *R_AllocModel(void);
 
@@ -1883,11 +2014,14 @@ skin_t *R_GetSkinByHandle(qhandle_t hSkin);
 int R_ComputeLOD(trRefEntity_t *ent);
 
 const void *RB_TakeVideoFrameCmd(const void *data);
+void RB_FinishVideoFrames(void);
+void RB_ShutdownVideoReadback(void);
 
 //
 // tr_shader.c
 //
 shader_t *R_FindShader(const char *name, int lightmapIndex, qboolean mipRawImage);
+void R_QueueShaderImages(const char *name);
 shader_t *R_GetShaderByHandle(qhandle_t hShader);
 shader_t *R_GetShaderByState(int index, long *cycleTime);
 shader_t *R_FindShaderByName(const char *name);
@@ -1979,6 +2113,7 @@ void RB_InstantQuad(vec4_t quadVerts[4]);
 void RB_InstantQuad2(vec4_t quadVerts[4], vec2_t texCoords[4]);
 
 void RB_ShowImages(void);
+void RB_GpuTimerPhase(gpuTimerPhase_t phase);
 
 /*
 ============================================================
@@ -1988,8 +2123,24 @@ WORLD MAP
 ============================================================
 */
 
+#define MAX_SHADOW_VIEWS 6 // the faces of a dlight cubemap
+
+// a depth shadow view whose world surfaces are gathered on the job threads
+typedef struct {
+	viewParms_t parms; // after R_RotateForViewer and the projection
+
+	int stamp;
+	int *viewCounts;
+	int *surfaces; // visible world surfaces, merged ones as -1 - index
+	int numSurfaces;
+	int numLeafs;
+	vec3_t visBounds[2];
+} shadowView_t;
+
 void R_AddBrushModelSurfaces(trRefEntity_t *e);
 void R_AddWorldSurfaces(void);
+void R_GatherShadowViews(shadowView_t *views, int numViews);
+void R_AddGatheredWorldSurfaces(const shadowView_t *view);
 qboolean R_inPVS(const vec3_t p1, const vec3_t p2);
 
 /*
@@ -2134,8 +2285,13 @@ void GLSL_SetUniformVec4(shaderProgram_t *program, int uniformNum, const vec4_t
 void GLSL_SetUniformMat4(shaderProgram_t *program, int uniformNum, const mat4_t matrix);
 void GLSL_SetUniformMat4BoneMatrix(shaderProgram_t *program, int uniformNum, /*const*/ mat4_t *matrix,
 								   int numMatricies);
+void GLSL_SetUniformMat4Instances(shaderProgram_t *program, int uniformNum, /*const*/ mat4_t *matrix,
+								  int numMatricies);
+void GLSL_SetUniformVec4Dlights(shaderProgram_t *program, int uniformNum, const vec4_t *v, int numVectors);
 
 shaderProgram_t *GLSL_GetGenericShaderProgram(int stage);
+shaderProgram_t *GLSL_GetProgram(shaderProgram_t *program);
+void GLSL_PrecacheShaderPrograms(const shader_t *shader);
 
 /*
 ============================================================
@@ -2326,6 +2482,7 @@ typedef struct {
 
 typedef struct {
 	int commandId;
+	qboolean toCache; // only the baked ones, to R_CubemapCacheName
 } exportCubemapsCommand_t;
 
 typedef enum {
@@ -2365,12 +2522,17 @@ typedef struct {
 extern int max_polys;
 extern int max_polyverts;
 
-extern backEndData_t *backEndData; // the second one may not be allocated
+#define SMP_FRAMES 2
+
+extern backEndData_t *backEndData;				  // the front end's frame
+extern backEndData_t *smpBackEndData[SMP_FRAMES]; // the second one is only allocated with r_smp
 
 void *R_GetCommandBuffer(int bytes);
 void RB_ExecuteRenderCommands(const void *data);
+void RB_RenderThread(void);
 
 void R_IssuePendingRenderCommands(void);
+void R_SyncRenderThread(void);
 
 void R_AddDrawSurfCmd(drawSurf_t *drawSurfs, int numDrawSurfs);
 void R_AddCapShadowmapCmd(int dlight, int cubeSide);
@@ -2385,5 +2547,6 @@ void RE_SaveJPG(char *filename, int quality, int image_width, int image_height,
 size_t RE_SaveJPGToBuffer(byte *buffer, size_t bufSize, int quality, int image_width, int image_height,
 						  byte *image_buffer, int padding);
 void RE_TakeVideoFrame(int width, int height, byte *captureBuffer, byte *encodeBuffer, qboolean motionJpeg);
+void RE_FinishVideoFrames(void);
 
 #endif // TR_LOCAL_H
@@ -243,8 +243,7 @@ int R_CullLocalBox(vec3_t localBounds[2]) {
 	return CULL_CLIP;		// partially clipped
 #else
 	int j;
-	vec3_t transformed;
-	vec3_t v;
+	vec3_t corners[8];
 	vec3_t worldBounds[2];
 
 	if (r_nocull->integer) {
@@ -252,16 +251,18 @@ int R_CullLocalBox(vec3_t localBounds[2]) {
 	}
 
 	// transform into world space
-	ClearBounds(worldBounds[0], worldBounds[1]);
-
 	for (j = 0; j < 8; j++) {
-		v[0] = localBounds[j & 1][0];
-		v[1] = localBounds[(j >> 1) & 1][1];
-		v[2] = localBounds[(j >> 2) & 1][2];
+		corners[j][0] = localBounds[j & 1][0];
+		corners[j][1] = localBounds[(j >> 1) & 1][1];
+		corners[j][2] = localBounds[(j >> 2) & 1][2];
+	}
 
-		R_LocalPointToWorld(v, transformed);
+	TransformPoints(tr.or.origin, tr.or.axis, corners, corners, 8);
 
-		AddPointToBounds(transformed, worldBounds[0], worldBounds[1]);
+	ClearBounds(worldBounds[0], worldBounds[1]);
+
+	for (j = 0; j < 8; j++) {
+		AddPointToBounds(corners[j], worldBounds[0], worldBounds[1]);
 	}
 
 	return R_CullBox(worldBounds);
@@ -270,42 +271,27 @@ int R_CullLocalBox(vec3_t localBounds[2]) {
 
 /*
 =================
-R_CullBox
+R_CullBoxEx
 
 Returns CULL_IN, CULL_CLIP, or CULL_OUT
 =================
 */
-int R_CullBox(vec3_t worldBounds[2]) {
-	int i;
-	cplane_t *frust;
-	qboolean anyClip;
-	int r, numPlanes;
-
-	numPlanes = (tr.viewParms.flags & VPF_FARPLANEFRUSTUM) ? 5 : 4;
+int R_CullBoxEx(vec3_t worldBounds[2], cplane_t *frustum, int numPlanes) {
+	byte cull;
 
-	// check against frustum planes
-	anyClip = qfalse;
-	for (i = 0; i < numPlanes; i++) {
-		frust = &tr.viewParms.frustum[i];
+	// check against all frustum planes at once
+	CullBoxes(worldBounds[0], 1, frustum, numPlanes, &cull);
 
-		r = BoxOnPlaneSide(worldBounds[0], worldBounds[1], frust);
-
-		if (r == 2) {
-			// completely outside frustum
-			return CULL_OUT;
-		}
-		if (r == 3) {
-			anyClip = qtrue;
-		}
-	}
-
-	if (!anyClip) {
-		// completely inside frustum
-		return CULL_IN;
-	}
+	return cull;
+}
 
-	// partially clipped
-	return CULL_CLIP;
+/*
+=================
+R_CullBox
+=================
+*/
+int R_CullBox(vec3_t worldBounds[2]) {
+	return R_CullBoxEx(worldBounds, tr.viewParms.frustum, (tr.viewParms.flags & VPF_FARPLANEFRUSTUM) ? 5 : 4);
 }
 
 /*
@@ -1212,6 +1198,31 @@ static qboolean SurfIsOffscreen(const drawSurf_t *drawSurf, vec4_t clipDest[128]
 	return qfalse;
 }
 
+/*
+=================
+R_PortalOccluded
+
+The occlusion queries of the last frames found no sample of the surfaces
+with this portal shader visible in the main view
+=================
+*/
+static qboolean R_PortalOccluded(const shader_t *shader) {
+	const portalQuery_t *pq;
+	int i;
+
+	if (!glRefConfig.occlusionQuery || !r_portalOcclusion->integer) {
+		return qfalse;
+	}
+
+	for (i = 0, pq = tr.portalQueries; i < MAX_PORTAL_QUERIES; i++, pq++) {
+		if (pq->shaderIndex == shader->index) {
+			return pq->occluded && tr.frameCount - pq->resultFrame <= PORTAL_QUERY_FRAMES;
+		}
+	}
+
+	return qfalse;
+}
+
 /*
 ========================
 R_MirrorViewBySurface
@@ -1224,6 +1235,8 @@ qboolean R_MirrorViewBySurface(drawSurf_t *drawSurf, int entityNum) {
 	viewParms_t newParms;
 	viewParms_t oldParms;
 	orientation_t surface, camera;
+	shader_t *shader;
+	int surfEntityNum, fogNum, dlighted, pshadowed;
 
 	// don't recursively mirror
 	if (tr.viewParms.isPortal) {
@@ -1235,6 +1248,13 @@ qboolean R_MirrorViewBySurface(drawSurf_t *drawSurf, int entityNum) {
 		return qfalse;
 	}
 
+	// hidden behind the world lately, the surface itself is still drawn
+	// and queried so the view comes back once any of it shows
+	R_DecomposeSort(drawSurf->sort, &surfEntityNum, &shader, &fogNum, &dlighted, &pshadowed);
+	if (R_PortalOccluded(shader)) {
+		return qfalse;
+	}
+
 	// trivially reject portal/mirror
 	if (SurfIsOffscreen(drawSurf, clipDest)) {
 		return qfalse;
@@ -1320,51 +1340,72 @@ DRAWSURF SORTING
 
 /*
 ===============
-R_Radix
+R_RadixSort
+
+Radix sort with 4 byte size buckets.  The histograms for all four bytes
+are counted in a single pass, and a byte that is the same for every
+surface is skipped since it would not move anything.  The sun shadow
+cascades and pshadows only see the world and a few entities, so their
+entity and fog bytes are usually constant.  A list that is already in
+order is left alone.
 ===============
 */
-static ID_INLINE void R_Radix(int byte, int size, drawSurf_t *source, drawSurf_t *dest) {
-	int count[256] = {0};
+static void R_RadixSort(drawSurf_t *source, int size) {
+	static drawSurf_t scratch[MAX_DRAWSURFS];
+	int count[4][256];
 	int index[256];
-	int i;
-	unsigned char *sortKey = NULL;
-	unsigned char *end = NULL;
+	drawSurf_t *in, *out, *tmp;
+	unsigned int key, prev;
+	qboolean sorted;
+	int i, b, shift;
+
+	Com_Memset(count, 0, sizeof(count));
+
+	sorted = qtrue;
+	prev = 0;
+	for (i = 0; i < size; i++) {
+		key = source[i].sort;
+		if (key < prev) {
+			sorted = qfalse;
+		}
+		prev = key;
 
-	sortKey = ((unsigned char *)&source[0].sort) + byte;
-	end = sortKey + (size * sizeof(drawSurf_t));
-	for (; sortKey < end; sortKey += sizeof(drawSurf_t))
-		++count[*sortKey];
+		count[0][key & 255]++;
+		count[1][(key >> 8) & 255]++;
+		count[2][(key >> 16) & 255]++;
+		count[3][key >> 24]++;
+	}
 
-	index[0] = 0;
+	if (sorted) {
+		return;
+	}
 
-	for (i = 1; i < 256; ++i)
-		index[i] = index[i - 1] + count[i - 1];
+	in = source;
+	out = scratch;
+	for (b = 0; b < 4; b++) {
+		shift = b * 8;
 
-	sortKey = ((unsigned char *)&source[0].sort) + byte;
-	for (i = 0; i < size; ++i, sortKey += sizeof(drawSurf_t))
-		dest[index[*sortKey]++] = source[i];
-}
+		if (count[b][(in[0].sort >> shift) & 255] == size) {
+			continue;
+		}
 
-/*
-===============
-R_RadixSort
+		index[0] = 0;
+		for (i = 1; i < 256; i++) {
+			index[i] = index[i - 1] + count[b][i - 1];
+		}
 
-Radix sort with 4 byte size buckets
-===============
-*/
-static void R_RadixSort(drawSurf_t *source, int size) {
-	static drawSurf_t scratch[MAX_DRAWSURFS];
-#ifdef Q3_LITTLE_ENDIAN
-	R_Radix(0, size, source, scratch);
-	R_Radix(1, size, scratch, source);
-	R_Radix(2, size, source, scratch);
-	R_Radix(3, size, scratch, source);
-#else
-	R_Radix(3, size, source, scratch);
-	R_Radix(2, size, scratch, source);
-	R_Radix(1, size, source, scratch);
-	R_Radix(0, size, scratch, source);
-#endif // Q3_LITTLE_ENDIAN
+		for (i = 0; i < size; i++) {
+			out[index[(in[i].sort >> shift) & 255]++] = in[i];
+		}
+
+		tmp = in;
+		in = out;
+		out = tmp;
+	}
+
+	if (in != source) {
+		Com_Memcpy(source, in, size * sizeof(*source));
+	}
 }
 
 //==========================================================================================
@@ -1561,8 +1602,12 @@ void R_AddEntitySurfaces(void) {
 R_GenerateDrawSurfs
 ====================
 */
-void R_GenerateDrawSurfs(void) {
-	R_AddWorldSurfaces();
+static void R_GenerateViewDrawSurfs(const shadowView_t *gathered) {
+	if (gathered) {
+		R_AddGatheredWorldSurfaces(gathered);
+	} else {
+		R_AddWorldSurfaces();
+	}
 
 	R_AddPolygonSurfaces();
 
@@ -1583,6 +1628,10 @@ void R_GenerateDrawSurfs(void) {
 	R_AddEntitySurfaces();
 }
 
+void R_GenerateDrawSurfs(void) {
+	R_GenerateViewDrawSurfs(NULL);
+}
+
 /*
 ================
 R_DebugPolygon
@@ -1644,10 +1693,12 @@ void R_DebugGraphics(void) {
 R_RenderView
 
 A view may be either the actual camera view,
-or a mirror / remote location
+or a mirror / remote location.  A depth shadow view
+passed to R_GatherShadowViews comes with its world
+surfaces already culled.
 ================
 */
-void R_RenderView(viewParms_t *parms) {
+static void R_RenderViewEx(const viewParms_t *parms, const shadowView_t *gathered) {
 	int firstDrawSurf;
 	int numDrawSurfs;
 
@@ -1665,12 +1716,17 @@ void R_RenderView(viewParms_t *parms) {
 
 	tr.viewCount++;
 
-	// set viewParms.world
-	R_RotateForViewer();
+	if (gathered) {
+		// rotated and projected by R_SetupShadowView
+		tr.or = tr.viewParms.world;
+	} else {
+		// set viewParms.world
+		R_RotateForViewer();
 
-	R_SetupProjection(&tr.viewParms, r_zproj->value, tr.viewParms.zFar, qtrue);
+		R_SetupProjection(&tr.viewParms, r_zproj->value, tr.viewParms.zFar, qtrue);
+	}
 
-	R_GenerateDrawSurfs();
+	R_GenerateViewDrawSurfs(gathered);
 
 	// if we overflowed MAX_DRAWSURFS, the drawsurfs
 	// wrapped around in the buffer and we will be missing
@@ -1686,11 +1742,41 @@ void R_RenderView(viewParms_t *parms) {
 	R_DebugGraphics();
 }
 
+void R_RenderView(viewParms_t *parms) {
+	R_RenderViewEx(parms, NULL);
+}
+
+/*
+================
+R_SetupShadowView
+
+Rotates and projects a depth shadow view the way it will
+be rendered, so that R_GatherShadowViews can cull the world
+for it ahead of time
+================
+*/
+static void R_SetupShadowView(shadowView_t *view, const viewParms_t *parms, vec3_t orthoBounds[2]) {
+	tr.viewParms = *parms;
+	tr.viewParms.frameSceneNum = tr.frameSceneNum;
+	tr.viewParms.frameCount = tr.frameCount;
+
+	R_RotateForViewer();
+
+	if (orthoBounds) {
+		R_SetupProjectionOrtho(&tr.viewParms, orthoBounds);
+	} else {
+		R_SetupProjection(&tr.viewParms, r_zproj->value, tr.viewParms.zFar, qtrue);
+	}
+
+	view->parms = tr.viewParms;
+}
+
 void R_RenderDlightCubemaps(const refdef_t *fd) {
 	int i;
 
 	for (i = 0; i < tr.refdef.num_dlights; i++) {
 		viewParms_t shadowParms;
+		shadowView_t views[6];
 		int j;
 
 		// use previous frame to determine visible dlights
@@ -1754,7 +1840,14 @@ void R_RenderDlightCubemaps(const refdef_t *fd) {
 				break;
 			}
 
-			R_RenderView(&shadowParms);
+			R_SetupShadowView(&views[j], &shadowParms, NULL);
+		}
+
+		// cull the world for all faces at once, then render them in order
+		R_GatherShadowViews(views, 6);
+
+		for (j = 0; j < 6; j++) {
+			R_RenderViewEx(&views[j].parms, &views[j]);
 			R_AddCapShadowmapCmd(i, j);
 		}
 	}
@@ -2075,7 +2168,12 @@ static float CalcSplit(float n, float f, float i, float m) {
 	return (n * pow(f / n, i / m) + (f - n) * i / m) / 2.0f;
 }
 
-void R_RenderSunShadowMaps(const refdef_t *fd, int level) {
+/*
+================
+R_SetupSunShadowView
+================
+*/
+static void R_SetupSunShadowView(const refdef_t *fd, int level, shadowView_t *view) {
 	viewParms_t shadowParms;
 	vec4_t lightDir, lightCol;
 	vec3_t lightViewAxis[3];
@@ -2331,8 +2429,6 @@ void R_RenderSunShadowMaps(const refdef_t *fd, int level) {
 	}
 
 	{
-		int firstDrawSurf;
-
 		Com_Memset(&shadowParms, 0, sizeof(shadowParms));
 
 		if (glRefConfig.framebufferObject) {
@@ -2364,32 +2460,51 @@ void R_RenderSunShadowMaps(const refdef_t *fd, int level) {
 
 		VectorCopy(lightOrigin, shadowParms.pvsOrigin);
 
-		{
-			tr.viewCount++;
+		R_SetupShadowView(view, &shadowParms, lightviewBounds);
+	}
+}
 
-			tr.viewParms = shadowParms;
-			tr.viewParms.frameSceneNum = tr.frameSceneNum;
-			tr.viewParms.frameCount = tr.frameCount;
+/*
+================
+R_RenderSunShadowMaps
 
-			firstDrawSurf = tr.refdef.numDrawSurfs;
+The world of all the given cascades is culled on the job
+threads before any of them is rendered
+================
+*/
+void R_RenderSunShadowMaps(const refdef_t *fd, const int *levels, int numLevels) {
+	shadowView_t views[4];
+	int i;
 
-			tr.viewCount++;
+	for (i = 0; i < numLevels; i++) {
+		R_SetupSunShadowView(fd, levels[i], &views[i]);
+	}
 
-			// set viewParms.world
-			R_RotateForViewer();
+	R_GatherShadowViews(views, numLevels);
 
-			R_SetupProjectionOrtho(&tr.viewParms, lightviewBounds);
+	for (i = 0; i < numLevels; i++) {
+		int firstDrawSurf;
 
-			R_AddWorldSurfaces();
+		tr.viewCount++;
 
-			R_AddPolygonSurfaces();
+		tr.viewParms = views[i].parms;
 
-			R_AddEntitySurfaces();
+		firstDrawSurf = tr.refdef.numDrawSurfs;
 
-			R_SortDrawSurfs(tr.refdef.drawSurfs + firstDrawSurf, tr.refdef.numDrawSurfs - firstDrawSurf);
-		}
+		tr.viewCount++;
+
+		// rotated and projected by R_SetupShadowView
+		tr.or = tr.viewParms.world;
+
+		R_AddGatheredWorldSurfaces(&views[i]);
 
-		Mat4Multiply(tr.viewParms.projectionMatrix, tr.viewParms.world.modelMatrix, tr.refdef.sunShadowMvp[level]);
+		R_AddPolygonSurfaces();
+
+		R_AddEntitySurfaces();
+
+		R_SortDrawSurfs(tr.refdef.drawSurfs + firstDrawSurf, tr.refdef.numDrawSurfs - firstDrawSurf);
+
+		Mat4Multiply(tr.viewParms.projectionMatrix, tr.viewParms.world.modelMatrix, tr.refdef.sunShadowMvp[levels[i]]);
 	}
 }
 
@@ -2458,10 +2573,9 @@ void R_RenderCubemapSide(int cubemapIndex, int cubemapSide, qboolean subscene) {
 		// first
 		if (0) //(glRefConfig.framebufferObject && r_sunlightMode->integer && (r_forceSun->integer || tr.sunShadows))
 		{
-			R_RenderSunShadowMaps(&refdef, 0);
-			R_RenderSunShadowMaps(&refdef, 1);
-			R_RenderSunShadowMaps(&refdef, 2);
-			R_RenderSunShadowMaps(&refdef, 3);
+			static const int levels[] = {0, 1, 2, 3};
+
+			R_RenderSunShadowMaps(&refdef, levels, 4);
 		}
 	}
 
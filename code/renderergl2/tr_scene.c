@@ -441,6 +441,7 @@ void RE_RenderScene(const refdef_t *fd) {
 	}
 
 	startTime = ri.Milliseconds();
+	ri.ProfileBegin("RE_RenderScene");
 
 	if (!tr.world && !(fd->rdflags & RDF_NOWORLDMODEL)) {
 		ri.Error(ERR_DROP, "R_RenderScene: NULL worldmodel");
@@ -461,10 +462,13 @@ void RE_RenderScene(const refdef_t *fd) {
 	// playing with even more shadows
 	if (glRefConfig.framebufferObject && r_sunlightMode->integer && !(fd->rdflags & RDF_NOWORLDMODEL) &&
 		(r_forceSun->integer || tr.sunShadows)) {
+		int levels[4], numLevels = 0;
+		qboolean renderLast;
+
 		if (r_shadowCascadeZFar->integer != 0) {
-			R_RenderSunShadowMaps(fd, 0);
-			R_RenderSunShadowMaps(fd, 1);
-			R_RenderSunShadowMaps(fd, 2);
+			levels[numLevels++] = 0;
+			levels[numLevels++] = 1;
+			levels[numLevels++] = 2;
 		} else {
 			Mat4Zero(tr.refdef.sunShadowMvp[0]);
 			Mat4Zero(tr.refdef.sunShadowMvp[1]);
@@ -472,9 +476,16 @@ void RE_RenderScene(const refdef_t *fd) {
 		}
 
 		// only rerender last cascade if sun has changed position
-		if (r_forceSun->integer == 2 || !VectorCompare(tr.refdef.sunDir, tr.lastCascadeSunDirection)) {
+		renderLast = r_forceSun->integer == 2 || !VectorCompare(tr.refdef.sunDir, tr.lastCascadeSunDirection);
+		if (renderLast) {
+			levels[numLevels++] = 3;
+		}
+
+		// the cascades are culled together on the job threads
+		R_RenderSunShadowMaps(fd, levels, numLevels);
+
+		if (renderLast) {
 			VectorCopy(tr.refdef.sunDir, tr.lastCascadeSunDirection);
-			R_RenderSunShadowMaps(fd, 3);
 			Mat4Copy(tr.refdef.sunShadowMvp[3], tr.lastCascadeSunMvp);
 		} else {
 			Mat4Copy(tr.lastCascadeSunMvp, tr.refdef.sunShadowMvp[3]);
@@ -531,4 +542,5 @@ void RE_RenderScene(const refdef_t *fd) {
 	RE_EndScene();
 
 	tr.frontEndMsec += ri.Milliseconds() - startTime;
+	ri.ProfileEnd();
 }
@@ -38,6 +38,12 @@ R_DrawElements
 */
 
 void R_DrawElements(int numIndexes, int firstIndex) {
+	if (glState.numInstances > 1) {
+		qglDrawElementsInstanced(GL_TRIANGLES, numIndexes, GL_INDEX_TYPE,
+								 BUFFER_OFFSET(firstIndex * sizeof(glIndex_t)), glState.numInstances);
+		return;
+	}
+
 	qglDrawElements(GL_TRIANGLES, numIndexes, GL_INDEX_TYPE, BUFFER_OFFSET(firstIndex * sizeof(glIndex_t)));
 }
 
@@ -273,9 +279,19 @@ static void ComputeTexMods(shaderStage_t *pStage, int bundleNum, float *outMatri
 	}
 }
 
-static void ComputeDeformValues(int *deformGen, vec5_t deformParams) {
+/*
+================
+ComputeDeformValues
+
+The time term of the deform is reduced to a single period here in double
+precision and handed to the shader as u_Time with a frequency of one, so
+the shader stays accurate however long the level has been running
+================
+*/
+static void ComputeDeformValues(int *deformGen, vec5_t deformParams, float *deformTime) {
 	// u_DeformGen
 	*deformGen = DGEN_NONE;
+	*deformTime = 0.0f;
 	if (!ShaderRequiresCPUDeforms(tess.shader)) {
 		deformStage_t *ds;
 
@@ -289,8 +305,11 @@ static void ComputeDeformValues(int *deformGen, vec5_t deformParams) {
 			deformParams[0] = ds->deformationWave.base;
 			deformParams[1] = ds->deformationWave.amplitude;
 			deformParams[2] = ds->deformationWave.phase;
-			deformParams[3] = ds->deformationWave.frequency;
+			deformParams[3] = 1.0f; // frequency, folded into the time
 			deformParams[4] = ds->deformationSpread;
+
+			// the wave functions repeat every 1.0
+			*deformTime = fmod(tess.shaderTime * ds->deformationWave.frequency, 1.0);
 			break;
 
 		case DEFORM_BULGE:
@@ -299,8 +318,11 @@ static void ComputeDeformValues(int *deformGen, vec5_t deformParams) {
 			deformParams[0] = 0;
 			deformParams[1] = ds->bulgeHeight; // amplitude
 			deformParams[2] = ds->bulgeWidth;  // phase
-			deformParams[3] = ds->bulgeSpeed;  // frequency
+			deformParams[3] = 1.0f;			   // frequency, folded into the time
 			deformParams[4] = 0;
+
+			// bulge is a plain sin()
+			*deformTime = fmod(tess.shaderTime * ds->bulgeSpeed, 2.0 * M_PI);
 			break;
 
 		default:
@@ -316,12 +338,13 @@ static void ProjectDlightTexture(void) {
 	float radius;
 	int deformGen;
 	vec5_t deformParams;
+	float deformTime;
 
 	if (!backEnd.refdef.num_dlights) {
 		return;
 	}
 
-	ComputeDeformValues(&deformGen, deformParams);
+	ComputeDeformValues(&deformGen, deformParams, &deformTime);
 
 	for (l = 0; l < backEnd.refdef.num_dlights; l++) {
 		dlight_t *dl;
@@ -350,7 +373,7 @@ static void ProjectDlightTexture(void) {
 		GLSL_SetUniformInt(sp, UNIFORM_DEFORMGEN, deformGen);
 		if (deformGen != DGEN_NONE) {
 			GLSL_SetUniformFloat5(sp, UNIFORM_DEFORMPARAMS, deformParams);
-			GLSL_SetUniformFloat(sp, UNIFORM_TIME, tess.shaderTime);
+			GLSL_SetUniformFloat(sp, UNIFORM_TIME, deformTime);
 		}
 
 		vector[0] = dl->color[0];
@@ -385,6 +408,220 @@ static void ProjectDlightTexture(void) {
 	}
 }
 
+/*
+===================
+RB_BuildDlightGrid
+
+Sorts the view's dlights into screen tiles and logarithmic depth
+slices, so the grid pass only evaluates the lights near a fragment.
+Tile edges are planes through the eye built from the projection rows,
+which keeps the test conservative for off-center frustums too.
+===================
+*/
+static byte dlightGrid[DLIGHT_GRID_Z][DLIGHT_GRID_Y][DLIGHT_GRID_X][4];
+static vec4_t dlightOrigins[MAX_DLIGHTS];
+static vec4_t dlightColors[MAX_DLIGHTS];
+static float dlightSliceScale;
+
+static float RB_DlightTileDist(const float *proj, int axis, float ndc, const vec3_t eye) {
+	vec3_t normal;
+
+	normal[0] = proj[axis] - ndc * proj[3];
+	normal[1] = proj[4 + axis] - ndc * proj[7];
+	normal[2] = proj[8 + axis] - ndc * proj[11];
+
+	return (DotProduct(normal, eye) + proj[12 + axis] - ndc * proj[15]) / VectorLength(normal);
+}
+
+static int RB_DlightSlice(float depth) {
+	int slice;
+
+	if (depth <= r_znear->value) {
+		return 0;
+	}
+
+	slice = log(depth / r_znear->value) * dlightSliceScale;
+
+	return MIN(slice, DLIGHT_GRID_Z - 1);
+}
+
+static void RB_BuildDlightGrid(void) {
+	const float *proj = backEnd.viewParms.projectionMatrix;
+	const float *world = backEnd.viewParms.world.modelMatrix;
+	float zFar = MAX(backEnd.viewParms.zFar, r_znear->value * 2.0f);
+	int l, x, y, z;
+
+	Com_Memset(dlightGrid, 0, sizeof(dlightGrid));
+
+	dlightSliceScale = DLIGHT_GRID_Z / log(zFar / r_znear->value);
+
+	for (l = 0; l < backEnd.refdef.num_dlights; l++) {
+		dlight_t *dl = &backEnd.refdef.dlights[l];
+		float tileDist[DLIGHT_GRID_X + 1];
+		float radius = dl->radius;
+		int minX = -1, maxX = -1, minY = -1, maxY = -1;
+		int minZ, maxZ;
+		vec3_t eye;
+		float depth;
+
+		VectorCopy(dl->origin, dlightOrigins[l]);
+		dlightOrigins[l][3] = 1.0f / radius;
+		VectorCopy(dl->color, dlightColors[l]);
+		dlightColors[l][3] = dl->additive ? 1.0f : 0.0f;
+
+		eye[0] = world[0] * dl->origin[0] + world[4] * dl->origin[1] + world[8] * dl->origin[2] + world[12];
+		eye[1] = world[1] * dl->origin[0] + world[5] * dl->origin[1] + world[9] * dl->origin[2] + world[13];
+		eye[2] = world[2] * dl->origin[0] + world[6] * dl->origin[1] + world[10] * dl->origin[2] + world[14];
+
+		// eye space looks down -z
+		depth = -eye[2];
+		if (depth + radius < r_znear->value) {
+			continue;
+		}
+
+		minZ = RB_DlightSlice(depth - radius);
+		maxZ = RB_DlightSlice(depth + radius);
+
+		for (x = 0; x <= DLIGHT_GRID_X; x++) {
+			tileDist[x] = RB_DlightTileDist(proj, 0, -1.0f + 2.0f * x / DLIGHT_GRID_X, eye);
+		}
+
+		for (x = 0; x < DLIGHT_GRID_X; x++) {
+			if (tileDist[x] > -radius && tileDist[x + 1] < radius) {
+				if (minX < 0) {
+					minX = x;
+				}
+				maxX = x;
+			}
+		}
+
+		for (y = 0; y <= DLIGHT_GRID_Y; y++) {
+			tileDist[y] = RB_DlightTileDist(proj, 1, -1.0f + 2.0f * y / DLIGHT_GRID_Y, eye);
+		}
+
+		for (y = 0; y < DLIGHT_GRID_Y; y++) {
+			if (tileDist[y] > -radius && tileDist[y + 1] < radius) {
+				if (minY < 0) {
+					minY = y;
+				}
+				maxY = y;
+			}
+		}
+
+		if (minX < 0 || minY < 0) {
+			continue;
+		}
+
+		for (z = minZ; z <= maxZ; z++) {
+			for (y = minY; y <= maxY; y++) {
+				for (x = minX; x <= maxX; x++) {
+					dlightGrid[z][y][x][l >> 3] |= 1 << (l & 7);
+				}
+			}
+		}
+	}
+
+	qglTextureSubImage2DEXT(tr.dlightGridImage->texnum, GL_TEXTURE_2D, 0, 0, 0, DLIGHT_GRID_X * DLIGHT_GRID_Y,
+							DLIGHT_GRID_Z, GL_RGBA, GL_UNSIGNED_BYTE, dlightGrid);
+
+	backEnd.dlightGridBuilt = qtrue;
+}
+
+/*
+===================
+ProjectDlightGrid
+
+Lights the surface with every dlight of its grid cells in one draw,
+plus a second one when additive dlights are mixed in
+===================
+*/
+static void ProjectDlightGrid(void) {
+	shaderProgram_t *sp;
+	int deformGen;
+	vec5_t deformParams;
+	float deformTime;
+	vec4_t vector;
+	int l, passes;
+
+	if (!backEnd.refdef.num_dlights) {
+		return;
+	}
+
+	// the blend differs for additive dlights, so split them into their own pass
+	passes = 0;
+	for (l = 0; l < backEnd.refdef.num_dlights; l++) {
+		if (tess.dlightBits & (1 << l)) {
+			passes |= backEnd.refdef.dlights[l].additive ? 2 : 1;
+		}
+	}
+
+	if (!passes) {
+		return;
+	}
+
+	if (!backEnd.dlightGridBuilt) {
+		RB_BuildDlightGrid();
+	}
+
+	ComputeDeformValues(&deformGen, deformParams, &deformTime);
+
+	sp = &tr.dlightGridShader[deformGen == DGEN_NONE ? 0 : 1];
+
+	GLSL_BindProgram(sp);
+
+	GLSL_SetUniformMat4(sp, UNIFORM_MODELVIEWPROJECTIONMATRIX, glState.modelviewProjection);
+	GLSL_SetUniformMat4(sp, UNIFORM_MODELMATRIX, backEnd.or.transformMatrix);
+
+	GLSL_SetUniformInt(sp, UNIFORM_DEFORMGEN, deformGen);
+	if (deformGen != DGEN_NONE) {
+		GLSL_SetUniformFloat5(sp, UNIFORM_DEFORMPARAMS, deformParams);
+		GLSL_SetUniformFloat(sp, UNIFORM_TIME, deformTime);
+	}
+
+	GLSL_SetUniformVec3(sp, UNIFORM_VIEWORIGIN, backEnd.viewParms.or.origin);
+	GLSL_SetUniformVec3(sp, UNIFORM_VIEWFORWARD, backEnd.viewParms.or.axis[0]);
+
+	vector[0] = backEnd.viewParms.viewportX;
+	vector[1] = backEnd.viewParms.viewportY;
+	vector[2] = (float)DLIGHT_GRID_X / backEnd.viewParms.viewportWidth;
+	vector[3] = (float)DLIGHT_GRID_Y / backEnd.viewParms.viewportHeight;
+	GLSL_SetUniformVec4(sp, UNIFORM_DLIGHTGRIDINFO, vector);
+
+	GLSL_SetUniformVec4Dlights(sp, UNIFORM_DLIGHTORIGINS, dlightOrigins, backEnd.refdef.num_dlights);
+	GLSL_SetUniformVec4Dlights(sp, UNIFORM_DLIGHTCOLORS, dlightColors, backEnd.refdef.num_dlights);
+
+	GL_BindToTMU(tr.dlightImage, TB_COLORMAP);
+	GL_BindToTMU(tr.dlightGridImage, TB_LIGHTMAP);
+
+	for (l = 0; l < 2; l++) {
+		if (!(passes & (1 << l))) {
+			continue;
+		}
+
+		vector[0] = r_znear->value;
+		vector[1] = dlightSliceScale;
+		vector[2] = l;
+		vector[3] = 0.0f;
+		GLSL_SetUniformVec4(sp, UNIFORM_DLIGHTGRIDDEPTH, vector);
+
+		// include GLS_DEPTHFUNC_EQUAL so alpha tested surfaces don't add light
+		// where they aren't rendered
+		if (l) {
+			GL_State(GLS_SRCBLEND_ONE | GLS_DSTBLEND_ONE | GLS_DEPTHFUNC_EQUAL);
+		} else {
+			GL_State(GLS_SRCBLEND_DST_COLOR | GLS_DSTBLEND_ONE | GLS_DEPTHFUNC_EQUAL);
+		}
+
+		backEnd.pc.c_dlightDraws++;
+
+		R_DrawElements(tess.numIndexes, tess.firstIndex);
+
+		backEnd.pc.c_totalIndexes += tess.numIndexes;
+		backEnd.pc.c_dlightIndexes += tess.numIndexes;
+		backEnd.pc.c_dlightVertexes += tess.numVertexes;
+	}
+}
+
 static void ComputeShaderColors(shaderStage_t *pStage, vec4_t baseColor, vec4_t vertColor, int blend) {
 	qboolean isBlend = ((blend & GLS_SRCBLEND_BITS) == GLS_SRCBLEND_DST_COLOR) ||
 					   ((blend & GLS_SRCBLEND_BITS) == GLS_SRCBLEND_ONE_MINUS_DST_COLOR) ||
@@ -586,6 +823,7 @@ static void ForwardDlight(void) {
 
 	int deformGen;
 	vec5_t deformParams;
+	float deformTime;
 
 	vec4_t fogDistanceVector, fogDepthVector = {0, 0, 0, 0};
 	float eyeT = 0;
@@ -597,7 +835,7 @@ static void ForwardDlight(void) {
 		return;
 	}
 
-	ComputeDeformValues(&deformGen, deformParams);
+	ComputeDeformValues(&deformGen, deformParams, &deformTime);
 
 	ComputeFogValues(fogDistanceVector, fogDepthVector, &eyeT);
 
@@ -624,7 +862,7 @@ static void ForwardDlight(void) {
 			index &= ~LIGHTDEF_LIGHTTYPE_MASK;
 			index |= LIGHTDEF_USE_LIGHT_VECTOR;
 
-			sp = &tr.lightallShader[index];
+			sp = GLSL_GetProgram(&tr.lightallShader[index]);
 		}
 
 		backEnd.pc.c_lightallDraws++;
@@ -640,7 +878,7 @@ static void ForwardDlight(void) {
 		GLSL_SetUniformInt(sp, UNIFORM_DEFORMGEN, deformGen);
 		if (deformGen != DGEN_NONE) {
 			GLSL_SetUniformFloat5(sp, UNIFORM_DEFORMPARAMS, deformParams);
-			GLSL_SetUniformFloat(sp, UNIFORM_TIME, tess.shaderTime);
+			GLSL_SetUniformFloat(sp, UNIFORM_TIME, deformTime);
 		}
 
 		if (input->fogNum) {
@@ -751,6 +989,7 @@ static void ProjectPshadowVBOGLSL(void) {
 
 	int deformGen;
 	vec5_t deformParams;
+	float deformTime;
 
 	shaderCommands_t *input = &tess;
 
@@ -758,7 +997,7 @@ static void ProjectPshadowVBOGLSL(void) {
 		return;
 	}
 
-	ComputeDeformValues(&deformGen, deformParams);
+	ComputeDeformValues(&deformGen, deformParams, &deformTime);
 
 	for (l = 0; l < backEnd.refdef.num_pshadows; l++) {
 		pshadow_t *ps;
@@ -828,8 +1067,9 @@ static void RB_FogPass(void) {
 
 	int deformGen;
 	vec5_t deformParams;
+	float deformTime;
 
-	ComputeDeformValues(&deformGen, deformParams);
+	ComputeDeformValues(&deformGen, deformParams, &deformTime);
 
 	{
 		int index = 0;
@@ -862,7 +1102,7 @@ static void RB_FogPass(void) {
 	GLSL_SetUniformInt(sp, UNIFORM_DEFORMGEN, deformGen);
 	if (deformGen != DGEN_NONE) {
 		GLSL_SetUniformFloat5(sp, UNIFORM_DEFORMPARAMS, deformParams);
-		GLSL_SetUniformFloat(sp, UNIFORM_TIME, tess.shaderTime);
+		GLSL_SetUniformFloat(sp, UNIFORM_TIME, deformTime);
 	}
 
 	color[0] = ((unsigned char *)(&fog->colorInt))[0] / 255.0f;
@@ -909,10 +1149,11 @@ static void RB_IterateStagesGeneric(shaderCommands_t *input) {
 
 	int deformGen;
 	vec5_t deformParams;
+	float deformTime;
 
 	qboolean renderToCubemap = tr.renderCubeFbo && glState.currentFBO == tr.renderCubeFbo;
 
-	ComputeDeformValues(&deformGen, deformParams);
+	ComputeDeformValues(&deformGen, deformParams, &deformTime);
 
 	ComputeFogValues(fogDistanceVector, fogDepthVector, &eyeT);
 
@@ -931,7 +1172,9 @@ static void RB_IterateStagesGeneric(shaderCommands_t *input) {
 				int index = 0;
 
 				if (backEnd.currentEntity && backEnd.currentEntity != &tr.worldEntity) {
-					if (glState.boneAnimation) {
+					if (glState.numInstances > 1) {
+						index |= LIGHTDEF_ENTITY_INSTANCING;
+					} else if (glState.boneAnimation) {
 						index |= LIGHTDEF_ENTITY_BONE_ANIMATION;
 					} else {
 						index |= LIGHTDEF_ENTITY_VERTEX_ANIMATION;
@@ -942,7 +1185,7 @@ static void RB_IterateStagesGeneric(shaderCommands_t *input) {
 					index |= LIGHTDEF_USE_TCGEN_AND_TCMOD;
 				}
 
-				sp = &pStage->glslShaderGroup[index];
+				sp = GLSL_GetProgram(&pStage->glslShaderGroup[index]);
 			} else {
 				int shaderAttribs = 0;
 
@@ -950,7 +1193,9 @@ static void RB_IterateStagesGeneric(shaderCommands_t *input) {
 					shaderAttribs |= GENERICDEF_USE_DEFORM_VERTEXES;
 				}
 
-				if (glState.vertexAnimation) {
+				if (glState.numInstances > 1) {
+					shaderAttribs |= GENERICDEF_USE_INSTANCING;
+				} else if (glState.vertexAnimation) {
 					shaderAttribs |= GENERICDEF_USE_VERTEX_ANIMATION;
 				} else if (glState.boneAnimation) {
 					shaderAttribs |= GENERICDEF_USE_BONE_ANIMATION;
@@ -960,13 +1205,15 @@ static void RB_IterateStagesGeneric(shaderCommands_t *input) {
 					shaderAttribs |= GENERICDEF_USE_TCGEN_AND_TCMOD;
 				}
 
-				sp = &tr.genericShader[shaderAttribs];
+				sp = GLSL_GetProgram(&tr.genericShader[shaderAttribs]);
 			}
 		} else if (pStage->glslShaderGroup == tr.lightallShader) {
 			int index = pStage->glslShaderIndex;
 
 			if (backEnd.currentEntity && backEnd.currentEntity != &tr.worldEntity) {
-				if (glState.boneAnimation) {
+				if (glState.numInstances > 1) {
+					index |= LIGHTDEF_ENTITY_INSTANCING;
+				} else if (glState.boneAnimation) {
 					index |= LIGHTDEF_ENTITY_BONE_ANIMATION;
 				} else {
 					index |= LIGHTDEF_ENTITY_VERTEX_ANIMATION;
@@ -982,7 +1229,7 @@ static void RB_IterateStagesGeneric(shaderCommands_t *input) {
 				index = LIGHTDEF_USE_TCGEN_AND_TCMOD;
 			}
 
-			sp = &pStage->glslShaderGroup[index];
+			sp = GLSL_GetProgram(&pStage->glslShaderGroup[index]);
 
 			backEnd.pc.c_lightallDraws++;
 		} else {
@@ -1003,10 +1250,15 @@ static void RB_IterateStagesGeneric(shaderCommands_t *input) {
 			GLSL_SetUniformMat4BoneMatrix(sp, UNIFORM_BONEMATRIX, glState.boneMatrix, glState.boneAnimation);
 		}
 
+		if (glState.numInstances > 1) {
+			GLSL_SetUniformMat4Instances(sp, UNIFORM_INSTANCEMATRIX, glState.instanceMatrix, glState.numInstances);
+			GLSL_SetUniformMat4Instances(sp, UNIFORM_INSTANCELIGHT, glState.instanceLight, glState.numInstances);
+		}
+
 		GLSL_SetUniformInt(sp, UNIFORM_DEFORMGEN, deformGen);
 		if (deformGen != DGEN_NONE) {
 			GLSL_SetUniformFloat5(sp, UNIFORM_DEFORMPARAMS, deformParams);
-			GLSL_SetUniformFloat(sp, UNIFORM_TIME, tess.shaderTime);
+			GLSL_SetUniformFloat(sp, UNIFORM_TIME, deformTime);
 		}
 
 		if (input->fogNum) {
@@ -1197,7 +1449,7 @@ static void RB_IterateStagesGeneric(shaderCommands_t *input) {
 				}
 
 				enableTextures[3] =
-					(r_cubeMapping->integer && !(tr.viewParms.flags & VPF_NOCUBEMAPS) && input->cubemapIndex) ? 1.0f
+					(r_cubeMapping->integer && !(backEnd.viewParms.flags & VPF_NOCUBEMAPS) && input->cubemapIndex) ? 1.0f
 																											  : 0.0f;
 			}
 
@@ -1215,7 +1467,7 @@ static void RB_IterateStagesGeneric(shaderCommands_t *input) {
 		//
 		// testing cube map
 		//
-		if (!(tr.viewParms.flags & VPF_NOCUBEMAPS) && input->cubemapIndex && r_cubeMapping->integer) {
+		if (!(backEnd.viewParms.flags & VPF_NOCUBEMAPS) && input->cubemapIndex && r_cubeMapping->integer) {
 			vec4_t vec;
 			cubemap_t *cubemap = &tr.cubemaps[input->cubemapIndex - 1];
 
@@ -1249,8 +1501,9 @@ static void RB_IterateStagesGeneric(shaderCommands_t *input) {
 static void RB_RenderShadowmap(shaderCommands_t *input) {
 	int deformGen;
 	vec5_t deformParams;
+	float deformTime;
 
-	ComputeDeformValues(&deformGen, deformParams);
+	ComputeDeformValues(&deformGen, deformParams, &deformTime);
 
 	{
 		vec4_t vector;
@@ -1277,7 +1530,7 @@ static void RB_RenderShadowmap(shaderCommands_t *input) {
 		GLSL_SetUniformInt(sp, UNIFORM_DEFORMGEN, deformGen);
 		if (deformGen != DGEN_NONE) {
 			GLSL_SetUniformFloat5(sp, UNIFORM_DEFORMPARAMS, deformParams);
-			GLSL_SetUniformFloat(sp, UNIFORM_TIME, tess.shaderTime);
+			GLSL_SetUniformFloat(sp, UNIFORM_TIME, deformTime);
 		}
 
 		VectorCopy(backEnd.viewParms.or.origin, vector);
@@ -1419,6 +1672,8 @@ void RB_StageIteratorGeneric(void) {
 		if (tess.shader->numUnfoggedPasses == 1 && tess.xstages[0]->glslShaderGroup == tr.lightallShader &&
 			(tess.xstages[0]->glslShaderIndex & LIGHTDEF_LIGHTTYPE_MASK) && r_dlightMode->integer) {
 			ForwardDlight();
+		} else if (tr.dlightGridShader[0].program) {
+			ProjectDlightGrid();
 		} else {
 			ProjectDlightTexture();
 		}
@@ -23,13 +23,15 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 /*
 ================
-R_CullSurface
+R_CullSurfaceInView
 
 Tries to cull surfaces before they are lighted or
-added to the sorting list.
+added to the sorting list.  World surfaces are only
+tested against the given view, so the job threads
+can cull with it as well.
 ================
 */
-static qboolean R_CullSurface(msurface_t *surf) {
+static qboolean R_CullSurfaceInView(msurface_t *surf, viewParms_t *parms, const vec3_t viewOrigin, qboolean local) {
 	if (r_nocull->integer || surf->cullinfo.type == CULLINFO_NONE) {
 		return qfalse;
 	}
@@ -62,7 +64,7 @@ static qboolean R_CullSurface(msurface_t *surf) {
 		*/
 
 		// shadowmaps draw back surfaces
-		if (tr.viewParms.flags & (VPF_SHADOWMAP | VPF_DEPTHSHADOW)) {
+		if (parms->flags & (VPF_SHADOWMAP | VPF_DEPTHSHADOW)) {
 			if (ct == CT_FRONT_SIDED) {
 				ct = CT_BACK_SIDED;
 			} else {
@@ -71,8 +73,8 @@ static qboolean R_CullSurface(msurface_t *surf) {
 		}
 
 		// do proper cull for orthographic projection
-		if (tr.viewParms.flags & VPF_ORTHOGRAPHIC) {
-			d = DotProduct(tr.viewParms.or.axis[0], surf->cullinfo.plane.normal);
+		if (parms->flags & VPF_ORTHOGRAPHIC) {
+			d = DotProduct(parms->or.axis[0], surf->cullinfo.plane.normal);
 			if (ct == CT_FRONT_SIDED) {
 				if (d > 0)
 					return qtrue;
@@ -83,7 +85,7 @@ static qboolean R_CullSurface(msurface_t *surf) {
 			return qfalse;
 		}
 
-		d = DotProduct(tr.or.viewOrigin, surf->cullinfo.plane.normal);
+		d = DotProduct(viewOrigin, surf->cullinfo.plane.normal);
 
 		// don't cull exactly on the plane, because there are levels of rounding
 		// through the BSP, ICD, and hardware that may cause pixel gaps if an
@@ -104,10 +106,11 @@ static qboolean R_CullSurface(msurface_t *surf) {
 	if (surf->cullinfo.type & CULLINFO_SPHERE) {
 		int sphereCull;
 
-		if (tr.currentEntityNum != REFENTITYNUM_WORLD) {
+		if (local) {
 			sphereCull = R_CullLocalPointAndRadius(surf->cullinfo.localOrigin, surf->cullinfo.radius);
 		} else {
-			sphereCull = R_CullPointAndRadius(surf->cullinfo.localOrigin, surf->cullinfo.radius);
+			sphereCull = R_CullPointAndRadiusEx(surf->cullinfo.localOrigin, surf->cullinfo.radius, parms->frustum,
+												(parms->flags & VPF_FARPLANEFRUSTUM) ? 5 : 4);
 		}
 
 		if (sphereCull == CULL_OUT) {
@@ -118,10 +121,10 @@ static qboolean R_CullSurface(msurface_t *surf) {
 	if (surf->cullinfo.type & CULLINFO_BOX) {
 		int boxCull;
 
-		if (tr.currentEntityNum != REFENTITYNUM_WORLD) {
+		if (local) {
 			boxCull = R_CullLocalBox(surf->cullinfo.bounds);
 		} else {
-			boxCull = R_CullBox(surf->cullinfo.bounds);
+			boxCull = R_CullBoxEx(surf->cullinfo.bounds, parms->frustum, (parms->flags & VPF_FARPLANEFRUSTUM) ? 5 : 4);
 		}
 
 		if (boxCull == CULL_OUT) {
@@ -132,6 +135,70 @@ static qboolean R_CullSurface(msurface_t *surf) {
 	return qfalse;
 }
 
+/*
+================
+R_CullSurfacesInView
+
+R_CullSurfaceInView for up to CULL_BATCH world surfaces at once.  The
+bounding boxes are gathered and tested against the frustum together,
+planes and spheres still go one at a time.  Sets visible[i] for each
+surface that passes.
+================
+*/
+#define CULL_BATCH 256
+
+static void R_CullSurfacesInView(msurface_t **surfs, int numSurfs, viewParms_t *parms, const vec3_t viewOrigin,
+								 qboolean *visible) {
+	float bounds[CULL_BATCH * 6];
+	int boxSurfs[CULL_BATCH];
+	byte boxCull[CULL_BATCH];
+	int numPlanes = (parms->flags & VPF_FARPLANEFRUSTUM) ? 5 : 4;
+	int i, numBoxes = 0;
+
+	for (i = 0; i < numSurfs; i++) {
+		msurface_t *surf = surfs[i];
+
+		if (r_nocull->integer || (surf->cullinfo.type & CULLINFO_PLANE) || !(surf->cullinfo.type & CULLINFO_BOX) ||
+			(r_nocurves->integer && *surf->data == SF_GRID)) {
+			visible[i] = !R_CullSurfaceInView(surf, parms, viewOrigin, qfalse);
+			continue;
+		}
+
+		if ((surf->cullinfo.type & CULLINFO_SPHERE) &&
+			R_CullPointAndRadiusEx(surf->cullinfo.localOrigin, surf->cullinfo.radius, parms->frustum, numPlanes) ==
+				CULL_OUT) {
+			visible[i] = qfalse;
+			continue;
+		}
+
+		visible[i] = qtrue;
+		VectorCopy(surf->cullinfo.bounds[0], bounds + numBoxes * 6);
+		VectorCopy(surf->cullinfo.bounds[1], bounds + numBoxes * 6 + 3);
+		boxSurfs[numBoxes++] = i;
+	}
+
+	if (!numBoxes) {
+		return;
+	}
+
+	CullBoxes(bounds, numBoxes, parms->frustum, numPlanes, boxCull);
+
+	for (i = 0; i < numBoxes; i++) {
+		if (boxCull[i] == CULL_OUT) {
+			visible[boxSurfs[i]] = qfalse;
+		}
+	}
+}
+
+/*
+================
+R_CullSurface
+================
+*/
+static qboolean R_CullSurface(msurface_t *surf) {
+	return R_CullSurfaceInView(surf, &tr.viewParms, tr.or.viewOrigin, tr.currentEntityNum != REFENTITYNUM_WORLD);
+}
+
 /*
 ====================
 R_DlightSurface
@@ -293,17 +360,12 @@ static int R_PshadowSurface(msurface_t *surf, int pshadowBits) {
 
 /*
 ======================
-R_AddWorldSurface
+R_AddCulledWorldSurface
+
+Adds a surface that already passed R_CullSurface
 ======================
 */
-static void R_AddWorldSurface(msurface_t *surf, int dlightBits, int pshadowBits) {
-	// FIXME: bmodel fog?
-
-	// try to cull before dlighting or adding
-	if (R_CullSurface(surf)) {
-		return;
-	}
-
+static void R_AddCulledWorldSurface(msurface_t *surf, int dlightBits, int pshadowBits) {
 	// check for dlighting
 	/*if ( dlightBits ) */ {
 		dlightBits = R_DlightSurface(surf, dlightBits);
@@ -319,6 +381,79 @@ static void R_AddWorldSurface(msurface_t *surf, int dlightBits, int pshadowBits)
 	R_AddDrawSurf(surf->data, surf->shader, surf->fogIndex, dlightBits, pshadowBits, surf->cubemapIndex);
 }
 
+/*
+======================
+R_AddWorldSurface
+======================
+*/
+static void R_AddWorldSurface(msurface_t *surf, int dlightBits, int pshadowBits) {
+	// FIXME: bmodel fog?
+
+	// try to cull before dlighting or adding
+	if (R_CullSurface(surf)) {
+		return;
+	}
+
+	R_AddCulledWorldSurface(surf, dlightBits, pshadowBits);
+}
+
+/*
+======================
+R_AddWorldSurfaceBatch
+======================
+*/
+static void R_AddWorldSurfaceBatch(msurface_t **batch, const int *indexes, int numBatch, const int *dlightBits,
+								   const int *pshadowBits) {
+	qboolean visible[CULL_BATCH];
+	int i;
+
+	R_CullSurfacesInView(batch, numBatch, &tr.viewParms, tr.or.viewOrigin, visible);
+
+	for (i = 0; i < numBatch; i++) {
+		if (visible[i]) {
+			R_AddCulledWorldSurface(batch[i], dlightBits[indexes[i]], pshadowBits[indexes[i]]);
+		}
+	}
+}
+
+/*
+======================
+R_AddMarkedWorldSurfaces
+
+Culls and adds the surfaces marked in this view, in batches.
+Returns the dlights they were marked with.
+======================
+*/
+static int R_AddMarkedWorldSurfaces(msurface_t *surfaces, int numSurfaces, const int *viewCounts,
+									const int *dlightBits, const int *pshadowBits) {
+	msurface_t *batch[CULL_BATCH];
+	int indexes[CULL_BATCH];
+	int i, numBatch = 0;
+	int dlightMask = 0;
+
+	for (i = 0; i < numSurfaces; i++) {
+		if (viewCounts[i] != tr.viewCount) {
+			continue;
+		}
+
+		dlightMask |= dlightBits[i];
+
+		batch[numBatch] = surfaces + i;
+		indexes[numBatch++] = i;
+
+		if (numBatch == CULL_BATCH) {
+			R_AddWorldSurfaceBatch(batch, indexes, numBatch, dlightBits, pshadowBits);
+			numBatch = 0;
+		}
+	}
+
+	if (numBatch) {
+		R_AddWorldSurfaceBatch(batch, indexes, numBatch, dlightBits, pshadowBits);
+	}
+
+	return dlightMask;
+}
+
 /*
 =============================================================
 
@@ -534,13 +669,24 @@ static void R_RecursiveWorldNode(mnode_t *node, uint32_t planeBits, uint32_t dli
 		}
 
 		// add surfaces
-		view = tr.world->marksurfaces + node->firstmarksurface;
+		view = tr.world->viewSurfaces + node->firstmarksurface;
 
 		c = node->nummarksurfaces;
 		while (c--) {
 			// just mark it as visible, so we don't jump out of the cache derefencing the surface
 			surf = *view;
-			if (tr.world->surfacesViewCount[surf] != tr.viewCount) {
+			if (surf < 0) {
+				// merged at load
+				surf = -1 - surf;
+				if (tr.world->mergedSurfacesViewCount[surf] != tr.viewCount) {
+					tr.world->mergedSurfacesViewCount[surf] = tr.viewCount;
+					tr.world->mergedSurfacesDlightBits[surf] = dlightBits;
+					tr.world->mergedSurfacesPshadowBits[surf] = pshadowBits;
+				} else {
+					tr.world->mergedSurfacesDlightBits[surf] |= dlightBits;
+					tr.world->mergedSurfacesPshadowBits[surf] |= pshadowBits;
+				}
+			} else if (tr.world->surfacesViewCount[surf] != tr.viewCount) {
 				tr.world->surfacesViewCount[surf] = tr.viewCount;
 				tr.world->surfacesDlightBits[surf] = dlightBits;
 				tr.world->surfacesPshadowBits[surf] = pshadowBits;
@@ -610,6 +756,11 @@ qboolean R_inPVS(const vec3_t p1, const vec3_t p2) {
 	vis = ri.CM_ClusterPVS(leaf->cluster); // why not R_ClusterPVS ??
 	leaf = R_PointInLeaf(p2);
 
+	// a point in solid has no cluster, don't cull it
+	if (leaf->cluster < 0) {
+		return qtrue;
+	}
+
 	if (!(vis[leaf->cluster >> 3] & (1 << (leaf->cluster & 7)))) {
 		return qfalse;
 	}
@@ -748,20 +899,215 @@ void R_AddWorldSurfaces(void) {
 
 	// now add all the potentially visible surfaces
 	// also mask invisible dlights for next frame
+	tr.refdef.dlightMask = R_AddMarkedWorldSurfaces(tr.world->surfaces, tr.world->numWorldSurfaces,
+													tr.world->surfacesViewCount, tr.world->surfacesDlightBits,
+													tr.world->surfacesPshadowBits);
+	tr.refdef.dlightMask |= R_AddMarkedWorldSurfaces(tr.world->mergedSurfaces, tr.world->numMergedSurfaces,
+													 tr.world->mergedSurfacesViewCount,
+													 tr.world->mergedSurfacesDlightBits,
+													 tr.world->mergedSurfacesPshadowBits);
+	tr.refdef.dlightMask = ~tr.refdef.dlightMask;
+}
+
+/*
+=============================================================
+
+	SHADOW VIEWS
+
+Depth shadow views skip the PVS, dlights and pshadows, so walking
+the world for them only reads the BSP and the view itself.  The walk
+and surface culling of a batch of sun cascades or cubemap faces runs
+on the job threads, each view marking into its own slice of
+shadowViewCounts, and R_AddGatheredWorldSurfaces adds the results
+back in the order the views are rendered.
+
+=============================================================
+*/
+
+static int r_shadowViewStamp;
+
+/*
+================
+R_GatherWorldNode
+================
+*/
+static void R_GatherWorldNode(shadowView_t *view, mnode_t *node, uint32_t planeBits) {
+	do {
+		if (!r_nocull->integer) {
+			int i, r;
+
+			for (i = 0; i < 5; i++) {
+				if (!(planeBits & (1 << i))) {
+					continue;
+				}
+
+				r = BoxOnPlaneSide(node->mins, node->maxs, &view->parms.frustum[i]);
+				if (r == 2) {
+					return; // culled
+				}
+				if (r == 1) {
+					planeBits &= ~(1 << i); // all descendants will also be in front
+				}
+			}
+		}
+
+		if (node->contents != -1) {
+			break;
+		}
+
+		R_GatherWorldNode(view, node->children[0], planeBits);
+
+		// tail recurse
+		node = node->children[1];
+	} while (1);
+
 	{
-		int i;
+		// leaf node, so add mark surfaces
+		int c, surf, mark, *viewSurf;
 
-		tr.refdef.dlightMask = 0;
+		view->numLeafs++;
 
-		for (i = 0; i < tr.world->numWorldSurfaces; i++) {
-			if (tr.world->surfacesViewCount[i] != tr.viewCount)
+		AddPointToBounds(node->mins, view->visBounds[0], view->visBounds[1]);
+		AddPointToBounds(node->maxs, view->visBounds[0], view->visBounds[1]);
+
+		viewSurf = tr.world->viewSurfaces + node->firstmarksurface;
+
+		for (c = node->nummarksurfaces; c > 0; c--, viewSurf++) {
+			surf = *viewSurf;
+			if (surf < 0) {
+				// merged surfaces are marked after the regular ones
+				mark = tr.world->numsurfaces - 1 - surf;
+			} else if (surf < tr.world->numWorldSurfaces) {
+				mark = surf;
+			} else {
 				continue;
+			}
+
+			if (view->viewCounts[mark] != view->stamp) {
+				view->viewCounts[mark] = view->stamp;
+				view->surfaces[view->numSurfaces++] = surf;
+			}
+		}
+	}
+}
 
-			R_AddWorldSurface(tr.world->surfaces + i, tr.world->surfacesDlightBits[i],
-							  tr.world->surfacesPshadowBits[i]);
-			tr.refdef.dlightMask |= tr.world->surfacesDlightBits[i];
+/*
+================
+R_GatherShadowViewJob
+================
+*/
+static void R_GatherShadowViewJob(void *data, int index) {
+	shadowView_t *view = (shadowView_t *)data + index;
+	msurface_t *batch[CULL_BATCH];
+	qboolean visible[CULL_BATCH];
+	int i, j, numBatch, numVisible;
+
+	R_GatherWorldNode(view, tr.world->nodes, (view->parms.flags & VPF_FARPLANEFRUSTUM) ? 31 : 15);
+
+	// cull in place, keeping the order of the walk
+	numVisible = 0;
+	for (i = 0; i < view->numSurfaces; i += numBatch) {
+		numBatch = MIN(view->numSurfaces - i, CULL_BATCH);
+
+		for (j = 0; j < numBatch; j++) {
+			if (view->surfaces[i + j] < 0) {
+				batch[j] = tr.world->mergedSurfaces + (-1 - view->surfaces[i + j]);
+			} else {
+				batch[j] = tr.world->surfaces + view->surfaces[i + j];
+			}
 		}
 
-		tr.refdef.dlightMask = ~tr.refdef.dlightMask;
+		R_CullSurfacesInView(batch, numBatch, &view->parms, view->parms.world.viewOrigin, visible);
+
+		for (j = 0; j < numBatch; j++) {
+			if (visible[j]) {
+				view->surfaces[numVisible++] = view->surfaces[i + j];
+			}
+		}
 	}
+	view->numSurfaces = numVisible;
+}
+
+/*
+================
+R_GatherShadowViews
+
+Walks and culls the world for each depth shadow view
+on the job threads.  The parms of each view must already
+be rotated and projected.
+================
+*/
+void R_GatherShadowViews(shadowView_t *views, int numViews) {
+	int i, numMarks;
+
+	if (numViews > MAX_SHADOW_VIEWS) {
+		ri.Error(ERR_DROP, "R_GatherShadowViews: %i views", numViews);
+	}
+
+	r_shadowViewStamp++;
+	numMarks = tr.world ? tr.world->numsurfaces + tr.world->numMergedSurfaces : 0;
+
+	for (i = 0; i < numViews; i++) {
+		views[i].stamp = r_shadowViewStamp;
+		views[i].numSurfaces = 0;
+		views[i].numLeafs = 0;
+		ClearBounds(views[i].visBounds[0], views[i].visBounds[1]);
+
+		if (tr.world) {
+			views[i].viewCounts = tr.world->shadowViewCounts + i * numMarks;
+			views[i].surfaces = tr.world->shadowViewSurfaces + i * numMarks;
+		}
+	}
+
+	if (!r_drawworld->integer || (tr.refdef.rdflags & RDF_NOWORLDMODEL) || !tr.world) {
+		return;
+	}
+
+	ri.RunJobs(R_GatherShadowViewJob, views, numViews, MAX(r_shadowViewThreads->integer, 1));
+}
+
+/*
+================
+R_AddGatheredWorldSurfaces
+
+Same as R_AddWorldSurfaces for a view passed to R_GatherShadowViews,
+with tr.viewParms already set to it
+================
+*/
+void R_AddGatheredWorldSurfaces(const shadowView_t *view) {
+	int i;
+
+	if (!r_drawworld->integer) {
+		return;
+	}
+
+	if (tr.refdef.rdflags & RDF_NOWORLDMODEL) {
+		return;
+	}
+
+	tr.currentEntityNum = REFENTITYNUM_WORLD;
+	tr.shiftedEntityNum = tr.currentEntityNum << QSORT_REFENTITYNUM_SHIFT;
+
+	if (tr.refdef.num_dlights > MAX_DLIGHTS) {
+		tr.refdef.num_dlights = MAX_DLIGHTS;
+	}
+
+	if (tr.refdef.num_pshadows > MAX_DRAWN_PSHADOWS) {
+		tr.refdef.num_pshadows = MAX_DRAWN_PSHADOWS;
+	}
+
+	VectorCopy(view->visBounds[0], tr.viewParms.visBounds[0]);
+	VectorCopy(view->visBounds[1], tr.viewParms.visBounds[1]);
+	tr.pc.c_leafs += view->numLeafs;
+
+	for (i = 0; i < view->numSurfaces; i++) {
+		if (view->surfaces[i] < 0) {
+			R_AddCulledWorldSurface(tr.world->mergedSurfaces + (-1 - view->surfaces[i]), 0, 0);
+		} else {
+			R_AddCulledWorldSurface(tr.world->surfaces + view->surfaces[i], 0, 0);
+		}
+	}
+
+	// depth shadows touch no dlights
+	tr.refdef.dlightMask = ~0;
 }
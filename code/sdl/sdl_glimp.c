@@ -72,10 +72,17 @@ QGL_ES_1_1_FIXED_FUNCTION_PROCS
 QGL_1_3_PROCS
 QGL_1_5_PROCS
 QGL_2_0_PROCS
+QGL_2_0_STENCIL_PROCS
 QGL_3_0_PROCS
 QGL_ARB_occlusion_query_PROCS
 QGL_ARB_framebuffer_object_PROCS
 QGL_ARB_vertex_array_object_PROCS
+QGL_ARB_draw_instanced_PROCS
+QGL_ARB_timer_query_PROCS
+QGL_ARB_get_program_binary_PROCS
+QGL_ARB_parallel_shader_compile_PROCS
+QGL_ARB_map_buffer_range_PROCS
+QGL_ARB_sync_PROCS
 QGL_EXT_direct_state_access_PROCS
 #undef GLE
 
@@ -267,6 +274,14 @@ static qboolean GLimp_GetProcAddresses(qboolean fixedFunction) {
 			QGL_1_1_FIXED_FUNCTION_PROCS;
 			QGL_DESKTOP_1_1_PROCS;
 			QGL_DESKTOP_1_1_FIXED_FUNCTION_PROCS;
+			// vertex buffers for the renderergl1 world VBO
+			if (QGL_VERSION_ATLEAST(1, 5)) {
+				QGL_1_5_PROCS;
+			}
+			// two-sided stencil for the renderergl1 shadow volumes
+			if (QGL_VERSION_ATLEAST(2, 0)) {
+				QGL_2_0_STENCIL_PROCS;
+			}
 		} else if (qglesMajorVersion == 1 && qglesMinorVersion >= 1) {
 			// OpenGL ES 1.1 (2.0 is not backward compatible)
 			QGL_1_1_PROCS;
@@ -331,10 +346,17 @@ static void GLimp_ClearProcAddresses(void) {
 	QGL_1_3_PROCS;
 	QGL_1_5_PROCS;
 	QGL_2_0_PROCS;
+	QGL_2_0_STENCIL_PROCS;
 	QGL_3_0_PROCS;
 	QGL_ARB_occlusion_query_PROCS;
 	QGL_ARB_framebuffer_object_PROCS;
 	QGL_ARB_vertex_array_object_PROCS;
+	QGL_ARB_draw_instanced_PROCS;
+	QGL_ARB_timer_query_PROCS;
+	QGL_ARB_get_program_binary_PROCS;
+	QGL_ARB_parallel_shader_compile_PROCS;
+	QGL_ARB_map_buffer_range_PROCS;
+	QGL_ARB_sync_PROCS;
 	QGL_EXT_direct_state_access_PROCS;
 
 	qglActiveTextureARB = NULL;
@@ -963,6 +985,49 @@ success:
 	ri.IN_Init(SDL_window);
 }
 
+/*
+===============
+GLimp_CheckFullscreen
+
+Applies r_fullscreen changes, always on the main thread
+===============
+*/
+static void GLimp_CheckFullscreen(void) {
+	int fullscreen;
+	qboolean needToToggle;
+	qboolean sdlToggled = qfalse;
+
+	if (!r_fullscreen->modified) {
+		return;
+	}
+
+	// Find out the current state
+	fullscreen = !!(SDL_GetWindowFlags(SDL_window) & SDL_WINDOW_FULLSCREEN);
+
+	if (r_fullscreen->integer && ri.Cvar_VariableIntegerValue("in_nograb")) {
+		ri.Printf(PRINT_ALL, "Fullscreen not allowed with in_nograb 1\n");
+		ri.Cvar_Set("r_fullscreen", "0");
+		r_fullscreen->modified = qfalse;
+	}
+
+	// Is the state we want different from the current state?
+	needToToggle = !!r_fullscreen->integer != fullscreen;
+
+	if (needToToggle) {
+		sdlToggled = SDL_SetWindowFullscreen(SDL_window, r_fullscreen->integer) >= 0;
+
+		// SDL_WM_ToggleFullScreen didn't work, so do it the slow way
+		if (!sdlToggled)
+			ri.Cmd_ExecuteText(EXEC_APPEND, "vid_restart\n");
+
+		ri.IN_Restart();
+	}
+
+	r_fullscreen->modified = qfalse;
+}
+
+static SDL_Thread *renderThread = NULL;
+
 /*
 ===============
 GLimp_EndFrame
@@ -976,33 +1041,192 @@ void GLimp_EndFrame(void) {
 		SDL_GL_SwapWindow(SDL_window);
 	}
 
-	if (r_fullscreen->modified) {
-		int fullscreen;
-		qboolean needToToggle;
-		qboolean sdlToggled = qfalse;
+	// with a render thread this runs there, GLimp_WakeRenderer does it instead
+	if (!renderThread) {
+		GLimp_CheckFullscreen();
+	}
+}
+
+/*
+===========================================================
+
+SMP acceleration
+
+The render thread owns the GL context while it draws a frame. The front
+end takes the context back in GLimp_FrontEndSleep and hands it over again
+with the next frame in GLimp_WakeRenderer.
+
+===========================================================
+*/
+
+static SDL_mutex *smpMutex = NULL;
+static SDL_cond *renderCommandsEvent = NULL;
+static SDL_cond *renderCompletedEvent = NULL;
+static void (*glimpRenderThread)(void) = NULL;
+
+static void *smpData = NULL;
+static qboolean smpDataReady;
+static qboolean smpFrontEndCurrent; // main thread holds the context
+
+static int GLimp_RenderThreadWrapper(void *arg) {
+	glimpRenderThread();
+
+	// release the context for the front end
+	SDL_GL_MakeCurrent(SDL_window, NULL);
+
+	return 0;
+}
+
+/*
+===============
+GLimp_SpawnRenderThread
+===============
+*/
+qboolean GLimp_SpawnRenderThread(void (*function)(void)) {
+	if (renderThread) {
+		ri.Printf(PRINT_WARNING, "GLimp_SpawnRenderThread: already running\n");
+		return qfalse;
+	}
+
+	smpMutex = SDL_CreateMutex();
+	renderCommandsEvent = SDL_CreateCond();
+	renderCompletedEvent = SDL_CreateCond();
+
+	if (!smpMutex || !renderCommandsEvent || !renderCompletedEvent) {
+		ri.Printf(PRINT_WARNING, "GLimp_SpawnRenderThread: %s\n", SDL_GetError());
+		GLimp_ShutdownRenderThread();
+		return qfalse;
+	}
+
+	smpData = NULL;
+	smpDataReady = qfalse;
+	smpFrontEndCurrent = qtrue;
+	glimpRenderThread = function;
+
+	renderThread = SDL_CreateThread(GLimp_RenderThreadWrapper, "render thread", NULL);
+	if (!renderThread) {
+		ri.Printf(PRINT_WARNING, "GLimp_SpawnRenderThread: SDL_CreateThread failed: %s\n", SDL_GetError());
+		GLimp_ShutdownRenderThread();
+		return qfalse;
+	}
+
+	return qtrue;
+}
+
+/*
+===============
+GLimp_ShutdownRenderThread
+
+The render thread must be idle, see GLimp_FrontEndSleep
+===============
+*/
+void GLimp_ShutdownRenderThread(void) {
+	if (renderThread) {
+		// a NULL frame tells the render thread to exit
+		GLimp_WakeRenderer(NULL);
+		SDL_WaitThread(renderThread, NULL);
+		renderThread = NULL;
+
+		SDL_GL_MakeCurrent(SDL_window, SDL_glContext);
+		smpFrontEndCurrent = qtrue;
+	}
+
+	if (renderCompletedEvent) {
+		SDL_DestroyCond(renderCompletedEvent);
+		renderCompletedEvent = NULL;
+	}
+	if (renderCommandsEvent) {
+		SDL_DestroyCond(renderCommandsEvent);
+		renderCommandsEvent = NULL;
+	}
+	if (smpMutex) {
+		SDL_DestroyMutex(smpMutex);
+		smpMutex = NULL;
+	}
+
+	glimpRenderThread = NULL;
+}
+
+/*
+===============
+GLimp_RendererSleep
+
+Called by the render thread between frames, returns the next frame's
+commands or NULL when the thread should exit
+===============
+*/
+void *GLimp_RendererSleep(void) {
+	void *data;
+
+	SDL_GL_MakeCurrent(SDL_window, NULL);
 
-		// Find out the current state
-		fullscreen = !!(SDL_GetWindowFlags(SDL_window) & SDL_WINDOW_FULLSCREEN);
+	SDL_LockMutex(smpMutex);
+	{
+		smpData = NULL;
+		smpDataReady = qfalse;
 
-		if (r_fullscreen->integer && ri.Cvar_VariableIntegerValue("in_nograb")) {
-			ri.Printf(PRINT_ALL, "Fullscreen not allowed with in_nograb 1\n");
-			ri.Cvar_Set("r_fullscreen", "0");
-			r_fullscreen->modified = qfalse;
+		// after this, the front end can exit GLimp_FrontEndSleep
+		SDL_CondSignal(renderCompletedEvent);
+
+		while (!smpDataReady) {
+			SDL_CondWait(renderCommandsEvent, smpMutex);
 		}
 
-		// Is the state we want different from the current state?
-		needToToggle = !!r_fullscreen->integer != fullscreen;
+		data = smpData;
+	}
+	SDL_UnlockMutex(smpMutex);
 
-		if (needToToggle) {
-			sdlToggled = SDL_SetWindowFullscreen(SDL_window, r_fullscreen->integer) >= 0;
+	SDL_GL_MakeCurrent(SDL_window, SDL_glContext);
 
-			// SDL_WM_ToggleFullScreen didn't work, so do it the slow way
-			if (!sdlToggled)
-				ri.Cmd_ExecuteText(EXEC_APPEND, "vid_restart\n");
+	return data;
+}
+
+/*
+===============
+GLimp_FrontEndSleep
+
+Waits for the render thread to finish its frame and takes the context back
+===============
+*/
+void GLimp_FrontEndSleep(void) {
+	if (smpFrontEndCurrent) {
+		return;
+	}
 
-			ri.IN_Restart();
+	SDL_LockMutex(smpMutex);
+	{
+		while (smpData) {
+			SDL_CondWait(renderCompletedEvent, smpMutex);
 		}
+	}
+	SDL_UnlockMutex(smpMutex);
 
-		r_fullscreen->modified = qfalse;
+	SDL_GL_MakeCurrent(SDL_window, SDL_glContext);
+	smpFrontEndCurrent = qtrue;
+}
+
+/*
+===============
+GLimp_WakeRenderer
+
+Hands the context and a frame's commands to the render thread
+===============
+*/
+void GLimp_WakeRenderer(void *data) {
+	// window changes stay on the main thread
+	GLimp_CheckFullscreen();
+
+	SDL_GL_MakeCurrent(SDL_window, NULL);
+	smpFrontEndCurrent = qfalse;
+
+	SDL_LockMutex(smpMutex);
+	{
+		assert(smpData == NULL);
+		smpData = data;
+		smpDataReady = qtrue;
+
+		// after this, the render thread can exit GLimp_RendererSleep
+		SDL_CondSignal(renderCommandsEvent);
 	}
+	SDL_UnlockMutex(smpMutex);
 }
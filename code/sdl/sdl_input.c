@@ -43,6 +43,7 @@ static qboolean mouseActive = qfalse;
 
 static cvar_t *in_mouse = NULL;
 static cvar_t *in_nograb;
+static cvar_t *in_mouseSample;
 
 static cvar_t *in_joystick = NULL;
 static cvar_t *in_joystickThreshold = NULL;
@@ -446,6 +447,36 @@ static void IN_GobbleMotionEvents(void) {
 		Com_Printf("IN_GobbleMotionEvents failed: %s\n", SDL_GetError());
 }
 
+/*
+===============
+IN_SampleMouse
+
+Collects the relative mouse motion that arrived since IN_Frame, so the
+command built right after this carries all motion up to its send time.
+SDL only pumps events on the thread owning the window, so this samples
+from the main thread instead of a separate input thread.
+===============
+*/
+void IN_SampleMouse(void) {
+	SDL_Event e[32];
+	int i, n, dx, dy;
+
+	if (!mouseActive || !in_mouseSample->integer || !SDL_WasInit(SDL_INIT_VIDEO))
+		return;
+
+	dx = dy = 0;
+	SDL_PumpEvents();
+	while ((n = SDL_PeepEvents(e, ARRAY_LEN(e), SDL_GETEVENT, SDL_MOUSEMOTION, SDL_MOUSEMOTION)) > 0) {
+		for (i = 0; i < n; i++) {
+			dx += e[i].motion.xrel;
+			dy += e[i].motion.yrel;
+		}
+	}
+
+	if (dx || dy)
+		CL_MouseEvent(dx, dy, Sys_Milliseconds());
+}
+
 /*
 ===============
 IN_ActivateMouse
@@ -1246,6 +1277,7 @@ void IN_Init(void *windowData) {
 	// mouse variables
 	in_mouse = Cvar_Get("in_mouse", "1", CVAR_ARCHIVE);
 	in_nograb = Cvar_Get("in_nograb", "0", CVAR_ARCHIVE);
+	in_mouseSample = Cvar_Get("in_mouseSample", "1", CVAR_ARCHIVE);
 
 	in_joystick = Cvar_Get("in_joystick", "0", CVAR_ARCHIVE | CVAR_LATCH);
 	in_joystickThreshold = Cvar_Get("joy_threshold", "0.15", CVAR_ARCHIVE);
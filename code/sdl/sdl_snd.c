@@ -91,6 +91,8 @@ static void SNDDMA_AudioCallback(void *userdata, Uint8 *stream, int len) {
 	if (dmapos >= dmasize)
 		dmapos = 0;
 
+	S_MixThreadWake();
+
 #ifdef USE_SDL_AUDIO_CAPTURE
 	if (sdlMasterGain != 1.0f) {
 		int i;
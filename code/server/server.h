@@ -37,13 +37,17 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #ifdef USE_VOIP
 #define VOIP_QUEUE_LENGTH 64
 
+// a packet is stored once and shared by the queues of all its recipients,
+// each queue entry holds a reference
 typedef struct voipServerPacket_s {
+	int refs;
 	int generation;
 	int sequence;
 	int frames;
 	int len;
 	int sender;
 	int flags;
+	uint8_t recips[(MAX_CLIENTS + 7) / 8];
 	byte data[4000];
 } voipServerPacket_t;
 #endif
@@ -57,7 +61,7 @@ typedef struct svEntity_s {
 	int clusternums[MAX_ENT_CLUSTERS];
 	int lastCluster; // if all the clusters don't fit in clusternums
 	int areanum, areanum2;
-	int snapshotCounter; // used to prevent double adding from portal views
+	int originCluster, originArea; // of r.currentOrigin at the last SV_LinkEntity
 } svEntity_t;
 
 typedef enum {
@@ -75,13 +79,21 @@ typedef struct {
 	// https://zerowing.idsoftware.com/bugzilla/show_bug.cgi?id=475
 	// the serverId associated with the current checksumFeed (always <= serverId)
 	int checksumFeedServerId;
-	int snapshotCounter; // incremented for each snapshot built
 	int timeResidual;	 // <= 1000 / sv_frame->value
+	int frameRemainder;	 // 1000 % sv_fps carried between game frames
 	int nextFrameTime;	 // when time > nextFrameTime, process world
 	char *configstrings[MAX_CONFIGSTRINGS];
 	svEntity_t svEntities[MAX_GENTITIES];
 
+	// configstrings changed since the last SV_FlushConfigstrings, in the
+	// order they first changed
+	int pendingConfigstrings[MAX_CONFIGSTRINGS];
+	int numPendingConfigstrings;
+	qboolean configstringPending[MAX_CONFIGSTRINGS];
+	qboolean flushingConfigstrings;
+
 	const char *entityParsePoint; // used during game VM init
+	qboolean gameThinkBatch;	  // the game handles GAME_CLIENT_THINK_BATCH
 
 	// the game virtual machine will update these on init and changes
 	sharedEntity_t *gentities;
@@ -103,8 +115,8 @@ typedef struct {
 	int first_entity; // into the circular sv_packet_entities[]
 					  // the entities MUST be in increasing state number
 					  // order, otherwise the delta compression will fail
-	int messageSent;  // time the message was transmitted
-	int messageAcked; // time the message was acked
+	int messageSent;  // Sys_Milliseconds time the message was transmitted
+	int messageAcked; // Sys_Milliseconds time the ack arrived
 	int messageSize;  // used to rate drop packets
 } clientSnapshot_t;
 
@@ -117,6 +129,10 @@ typedef enum {
 	CS_ACTIVE	  // client is fully in game
 } clientState_t;
 
+// command text kept for retransmission, enough for a full legacy window of
+// MAX_STRING_CHARS commands plus the last acknowledged one
+#define RELIABLE_TEXT_SIZE ((MAX_RELIABLE_COMMANDS + 1) * MAX_STRING_CHARS)
+
 typedef struct netchan_buffer_s {
 	msg_t msg;
 	byte msgBuffer[MAX_MSGLEN];
@@ -127,7 +143,11 @@ typedef struct client_s {
 	clientState_t state;
 	char userinfo[MAX_INFO_STRING]; // name, etc
 
-	char reliableCommands[MAX_RELIABLE_COMMANDS][MAX_STRING_CHARS];
+	// text of the server commands from reliableAcknowledge to reliableSequence,
+	// packed back to back.  Offsets are monotonic and wrap around the buffer.
+	char reliableText[RELIABLE_TEXT_SIZE];
+	unsigned reliableStart[MAX_PACKED_RELIABLE_COMMANDS * 2]; // text offset of each sequence
+	unsigned reliableTextEnd;
 	int reliableSequence;	 // last added reliable message, not necessarily sent or acknowledged yet
 	int reliableAcknowledge; // last acknowledged reliable message
 	int reliableSent;		 // last sent reliable message, not necessarily acknowledged yet
@@ -137,6 +157,8 @@ typedef struct client_s {
 	int challenge;
 
 	usercmd_t lastUsercmd;
+	usercmd_t thinkCmds[MAX_THINK_USERCMDS]; // commands of the GAME_CLIENT_THINK_BATCH being run
+	int numThinkCmds;
 	int lastMessageNum;	   // for delta compression
 	int lastClientCommand; // reliable client message sequence
 	char lastClientCommandString[MAX_STRING_CHARS];
@@ -151,10 +173,23 @@ typedef struct client_s {
 	int downloadClientBlock;							// last block we sent to the client, awaiting ack
 	int downloadCurrentBlock;							// current block number
 	int downloadXmitBlock;								// last block we xmited
-	unsigned char *downloadBlocks[MAX_DOWNLOAD_WINDOW]; // the buffers for the download blocks
+	byte *downloadBuffer;	 // read ahead ring of DOWNLOAD_BUFFER_SIZE bytes of the file
+	int downloadReadCount;	 // bytes read into downloadBuffer
+	int downloadBlockOffset[MAX_DOWNLOAD_WINDOW];
 	int downloadBlockSize[MAX_DOWNLOAD_WINDOW];
+	int downloadBlockTime[MAX_DOWNLOAD_WINDOW]; // Sys_Milliseconds when the block was last sent
 	qboolean downloadEOF; // We have sent the EOF block
-	int downloadSendTime; // time we last got an ack from the client
+	int downloadSendTime; // Sys_Milliseconds when we last sent a block or got an ack
+
+	// congestion control of the download, the window is in blocks
+	int downloadWindow;
+	int downloadThreshold; // the window grows by one block per ack up to this, and per window above
+	int downloadWindowAcks;
+	int downloadBlkSize;	// size of the blocks read next
+	int downloadResendBlock; // blocks before this may have been sent twice, so they aren't timed
+	int downloadRtt;		 // smoothed round trip time in msec, 0 before the first sample
+	int downloadRttVar;
+	int downloadNextSend; // Sys_Milliseconds the next block is paced to
 
 	int deltaMessage;						// frame last client usercmd message
 	int nextReliableTime;					// svs.time when another reliable command will be allowed
@@ -167,6 +202,18 @@ typedef struct client_s {
 	int ping;
 	int rate;		  // bytes / second
 	int snapshotMsec; // requests a snapshot every snapshotMsec unless rate choked
+	int huffTable;	  // MSG_HUFF_ALTERNATE if the client loaded the same table version
+
+	// congestion control of the snapshot stream, see SV_SnapshotAcked
+	int adaptiveRate;	 // bytes / second below the client's rate, 0 while the link keeps up
+	int snapRtt;		 // smoothed round trip of the acked messages in msec
+	int snapMinRtt;		 // lowest round trip in the current period
+	int snapBaseRtt;	 // round trip of the link without a queue building up
+	int snapPeriodStart; // Sys_Milliseconds the current period started
+	int snapAcked;		 // messages first acked in the current period
+	int snapLost;		 // messages counted as lost in the current period
+	int snapLastAcked;	 // highest outgoing sequence the client acked
+	int snapLastAckTime; // Sys_Milliseconds that ack arrived
 	int pureAuthentic;
 	qboolean gotCP; // TTimo - additional flag to distinguish between a bad pure checksum, and no cp command at all
 	netchan_t netchan;
@@ -182,6 +229,7 @@ typedef struct client_s {
 	qboolean muteAllVoip;
 	qboolean ignoreVoipFromClient[MAX_CLIENTS];
 	voipServerPacket_t *voipPacket[VOIP_QUEUE_LENGTH];
+	int voipPacketFlags[VOIP_QUEUE_LENGTH]; // VOIP_DIRECT differs per recipient
 	int queuedVoipPackets;
 	int queuedVoipIndex;
 #endif
@@ -230,6 +278,9 @@ typedef struct {
 	challenge_t challenges[MAX_CHALLENGES];	   // to prevent invalid IPs from connecting
 	netadr_t redirectAddress;				   // for rcon return messages
 	int masterResolveTime[MAX_MASTER_SERVERS]; // next svs.time that server should do dns lookup for master server
+
+	int configstringUpdates; // broadcast configstring changes, for sv_configstringStats
+	int configstringMerges;	 // changes that replaced one still waiting to go out
 } serverStatic_t;
 
 #define SERVER_MAXBANS 1024
@@ -269,13 +320,30 @@ extern cvar_t *sv_serverid;
 extern cvar_t *sv_minRate;
 extern cvar_t *sv_maxRate;
 extern cvar_t *sv_dlRate;
+extern cvar_t *sv_adaptiveRate;
 extern cvar_t *sv_minPing;
 extern cvar_t *sv_maxPing;
 extern cvar_t *sv_gametype;
 extern cvar_t *sv_pure;
 extern cvar_t *sv_floodProtect;
 extern cvar_t *sv_lanForceRate;
+extern cvar_t *sv_snapshotThreads;
+extern cvar_t *sv_snapshotEntities;
+extern cvar_t *sv_pvsCache;
+extern cvar_t *sv_deltaCache;
+extern cvar_t *sv_huffCapture;
+extern cvar_t *sv_sectorDepth;
+extern cvar_t *sv_traceCache;
+extern cvar_t *sv_traceCacheStats;
+extern cvar_t *sv_traceThreads;
+extern cvar_t *sv_netCompression;
+extern cvar_t *sv_ratelimitBuckets;
 extern cvar_t *sv_banFile;
+extern cvar_t *sv_benchmarkWarmup;
+extern cvar_t *sv_benchmarkReport;
+extern cvar_t *sv_metrics;
+extern cvar_t *sv_metricsInterval;
+extern cvar_t *sv_metricsPrefix;
 
 extern serverBan_t serverBans[SERVER_MAXBANS];
 extern int serverBansCount;
@@ -302,28 +370,33 @@ struct leakyBucket_s {
 	int lastTime;
 	signed char burst;
 
-	long hash;
-
-	leakyBucket_t *prev, *next;
+	qboolean referenced; // seen again since the eviction clock last passed
 };
 
 extern leakyBucket_t outboundLeakyBucket;
 
 qboolean SVC_RateLimit(leakyBucket_t *bucket, int burst, int period);
 qboolean SVC_RateLimitAddress(netadr_t from, int burst, int period);
+void SVC_RateLimitStats_f(void);
+void SV_InvalidateQueryCache(void);
 
 void QDECL SV_SendServerCommand(client_t *cl, const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+int SV_ReliableWindow(const client_t *cl);
+void SV_GetReliableCommand(const client_t *cl, int sequence, char *buf, int size);
 
 void SV_AddOperatorCommands(void);
 void SV_RemoveOperatorCommands(void);
 
 void SV_MasterShutdown(void);
 int SV_RateMsec(client_t *client);
+void SV_SnapshotAcked(client_t *cl, int sequence);
 
 //
 // sv_init.c
 //
 void SV_SetConfigstring(int index, const char *val);
+void SV_FlushConfigstrings(void);
+void SV_ConfigstringStats_f(void);
 void SV_GetConfigstring(int index, char *buffer, int bufferSize);
 void SV_UpdateConfigstrings(client_t *client);
 
@@ -340,17 +413,23 @@ void SV_GetChallenge(netadr_t from);
 
 void SV_DirectConnect(netadr_t from);
 
+void SV_WriteGameState(client_t *client, msg_t *msg);
 void SV_ExecuteClientMessage(client_t *cl, msg_t *msg);
 void SV_UserinfoChanged(client_t *cl);
 
 void SV_ClientEnterWorld(client_t *client, usercmd_t *cmd);
 void SV_FreeClient(client_t *client);
 void SV_DropClient(client_t *drop, const char *reason);
+#ifdef USE_VOIP
+void SV_ReleaseVoipPacket(voipServerPacket_t *packet);
+void SV_RelayVoip(void);
+#endif
 
 void SV_ExecuteClientCommand(client_t *cl, const char *s, qboolean clientOK);
 void SV_ClientThink(client_t *cl, usercmd_t *cmd);
 
 int SV_SendDownloadMessages(void);
+int SV_DownloadWaitMsec(void);
 int SV_SendQueuedMessages(void);
 
 //
@@ -367,6 +446,7 @@ void SV_WriteFrameToClient(client_t *client, msg_t *msg);
 void SV_SendMessageToClient(msg_t *msg, client_t *client);
 void SV_SendClientMessages(void);
 void SV_SendClientSnapshot(client_t *client);
+void SV_HuffStats_f(void);
 
 //
 // sv_game.c
@@ -435,6 +515,16 @@ int SV_PointContents(const vec3_t p, int passEntityNum);
 
 void SV_Trace(trace_t *results, const vec3_t start, const vec3_t mins, const vec3_t maxs, const vec3_t end, int passEntityNum,
 			  int contentmask, int capsule);
+void SV_TraceBatch(trace_t *results, const traceRequest_t *requests, int numRequests);
+
+void SV_RecordClientPositions(void);
+// called after every game frame, remembers where the clients are for SV_RewindClients
+
+void SV_RewindClients(int time, int skipClient);
+void SV_RestoreClients(void);
+// moves all clients but skipClient back to where they were at time for the
+// traces of a lagged client's shot, SV_RestoreClients must follow before
+// anything else moves or links them
 // mins and maxs are relative
 
 // if the entire move stays in a solid volume, trace.allsolid will be set,
@@ -449,6 +539,81 @@ void SV_ClipToEntity(trace_t *trace, const vec3_t start, const vec3_t mins, cons
 					 int entityNum, int contentmask, int capsule);
 // clip to a specific entity
 
+void SV_TraceCacheFrame(void);
+// forgets the cached trace results and publishes the counters of the last frame
+
+//
+// sv_demo.c
+//
+qboolean SV_DemoRecording(void);
+void SV_StartDemo(client_t *client, const char *name);
+void SV_StopDemo(void);
+void SV_DemoClientDropped(client_t *client);
+qboolean SV_DemoRecordingClient(const client_t *client);
+qboolean SV_DemoFullSnapshot(client_t *client);
+void SV_DemoMessage(client_t *client, msg_t *msg);
+
+//
+// sv_benchmark.c
+//
+typedef enum {
+	SVB_OTHER,
+	SVB_GAME,
+	SVB_BOTAI,
+	SVB_BOTLIB,
+	SVB_TRACE,
+	SVB_SNAPSHOT,
+	SVB_NETWORK,
+	SVB_NUMPARTS
+} svBenchPart_t;
+
+// zones of the sv_benchmark frame breakdown, they nest like the
+// PROFILE_BEGIN / PROFILE_END pairs
+#define SV_BENCH_BEGIN(part)                                                                                           \
+	do {                                                                                                               \
+		if (sv_benchmarking)                                                                                           \
+			SV_BenchBegin(part);                                                                                       \
+	} while (0)
+#define SV_BENCH_END()                                                                                                 \
+	do {                                                                                                               \
+		if (sv_benchmarking)                                                                                           \
+			SV_BenchEnd();                                                                                             \
+	} while (0)
+
+extern int sv_benchmarking;
+
+void SV_BenchBegin(svBenchPart_t part);
+void SV_BenchEnd(void);
+int SV_BenchmarkRandomSeed(void);
+void SV_StopBenchmark(void);
+void SV_Benchmark_f(void);
+
+//
+// sv_microbench.c
+//
+void SV_Microbench_f(void);
+
+//
+// sv_metrics.c
+//
+
+// what the server counts between two sv_metrics pushes, the frame times
+// are added by SV_MetricsFrame
+typedef struct {
+	int64_t gameUsec; // GAME_RUN_FRAME calls
+	int64_t botUsec;  // SV_BotFrame
+	int snapshots;
+	int64_t snapshotBytes;
+	int droppedPackets; // as seen by Netchan_Process
+	int rateLimited;	// SVC_RateLimit refusals
+	int64_t downloadBytes;
+} svMetrics_t;
+
+extern svMetrics_t svMetrics;
+
+void SV_MetricsFrame(int usec);
+void SV_MetricsCheck(void);
+
 //
 // sv_net_chan.c
 //
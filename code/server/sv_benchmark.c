@@ -0,0 +1,654 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+// sv_benchmark.c -- headless server benchmark
+
+#include "server.h"
+
+/*
+=============================================================================
+
+sv_benchmark loads a map with a fixed random seed, adds bots and synthetic
+clients and runs a number of server frames back to back.  The synthetic
+clients connect over loopback and every frame send a packet with a move
+generated from their own seeded generator, acknowledging everything the
+server sent, so they are sent gamestates and delta snapshots like real
+clients.
+
+The time of a frame is split by the SV_BENCH_BEGIN / SV_BENCH_END zones
+into the game VM, the bot AI, botlib calls, traces, snapshot building and
+network writes.  A zone's time doesn't include the zones nested in it.
+Only the main thread is measured, time spent waiting on job workers counts
+for the zone that waits.
+
+If sv_benchmarkReport is set the frames go to benchmarks/<report>.csv and
+the statistics to benchmarks/<report>.json.
+
+=============================================================================
+*/
+
+#define MAX_BENCHMARK_FRAMES 16384
+#define MAX_BENCHMARK_DEPTH 16
+
+static const char *benchPartNames[SVB_NUMPARTS] = {"other", "game", "botai", "botlib", "trace", "snapshot", "network"};
+
+static const float benchPercentiles[] = {50.0f, 90.0f, 95.0f, 99.0f, 99.9f};
+#define NUM_BENCH_PERCENTILES ARRAY_LEN(benchPercentiles)
+
+typedef struct {
+	int total; // usec
+	int parts[SVB_NUMPARTS];
+	int traces;
+	int bytes;
+} benchFrame_t;
+
+typedef struct {
+	client_t *client;
+	unsigned int rand;
+	int lastSequence; // the messages before it are counted
+	vec3_t angles;
+	int turn; // yaw change a frame
+	signed char forwardmove, rightmove, upmove;
+	int buttons;
+} benchClient_t;
+
+typedef struct {
+	qboolean active; // from the map load to the report
+	int seed;
+
+	// the frame being measured
+	svBenchPart_t stack[MAX_BENCHMARK_DEPTH];
+	int depth;
+	int overflow; // zones nested deeper than the stack
+	int64_t last;
+	benchFrame_t *frame;
+
+	benchClient_t clients[MAX_CLIENTS];
+	int numClients;
+} benchmark_t;
+
+int sv_benchmarking;
+
+static benchmark_t svBench;
+static benchFrame_t benchFrames[MAX_BENCHMARK_FRAMES];
+static int benchSorted[MAX_BENCHMARK_FRAMES];
+
+/*
+==================
+SV_BenchBegin
+==================
+*/
+void SV_BenchBegin(svBenchPart_t part) {
+	int64_t now;
+
+	// workers aren't measured
+	if (Com_JobThreadIndex() || !svBench.frame) {
+		return;
+	}
+
+	now = Sys_Microseconds();
+	svBench.frame->parts[svBench.stack[svBench.depth]] += (int)(now - svBench.last);
+	svBench.last = now;
+
+	if (part == SVB_TRACE) {
+		svBench.frame->traces++;
+	}
+
+	if (svBench.depth == MAX_BENCHMARK_DEPTH - 1) {
+		svBench.overflow++;
+		return;
+	}
+	svBench.stack[++svBench.depth] = part;
+}
+
+/*
+==================
+SV_BenchEnd
+==================
+*/
+void SV_BenchEnd(void) {
+	int64_t now;
+
+	if (Com_JobThreadIndex() || !svBench.frame) {
+		return;
+	}
+
+	if (svBench.overflow) {
+		svBench.overflow--;
+		return;
+	}
+
+	now = Sys_Microseconds();
+	svBench.frame->parts[svBench.stack[svBench.depth]] += (int)(now - svBench.last);
+	svBench.last = now;
+
+	if (svBench.depth > 0) {
+		svBench.depth--;
+	}
+}
+
+/*
+==================
+SV_BenchmarkRandomSeed
+
+The random seed for GAME_INIT
+==================
+*/
+int SV_BenchmarkRandomSeed(void) {
+	if (svBench.active) {
+		return svBench.seed;
+	}
+
+	// use the current msec count
+	return Com_Milliseconds();
+}
+
+/*
+==================
+SV_StopBenchmark
+
+Called when the server shuts down, possibly in the middle of a benchmark
+==================
+*/
+void SV_StopBenchmark(void) {
+	sv_benchmarking = 0;
+	svBench.active = qfalse;
+	svBench.frame = NULL;
+	svBench.numClients = 0;
+}
+
+/*
+==================
+SV_BenchmarkRand
+==================
+*/
+static int SV_BenchmarkRand(benchClient_t *bc) {
+	bc->rand = bc->rand * 1103515245 + 12345;
+	return (bc->rand >> 16) & 0x7fff;
+}
+
+/*
+==================
+SV_BenchmarkCompareNames
+==================
+*/
+static int QDECL SV_BenchmarkCompareNames(const void *a, const void *b) {
+	return Q_stricmp((const char *)a, (const char *)b);
+}
+
+/*
+==================
+SV_BenchmarkBotNames
+
+The names in the .bot files in scripts, sorted so the bots added are the same
+whatever order the files are found in
+==================
+*/
+static int SV_BenchmarkBotNames(char names[][MAX_NAME_LENGTH], int maxNames) {
+	char fileList[8192];
+	char *fileName;
+	char *buf;
+	const char *p, *token;
+	int numFiles, numNames;
+	int i, len;
+
+	numNames = 0;
+	numFiles = FS_GetFileList("scripts", ".bot", fileList, sizeof(fileList));
+	fileName = fileList;
+	for (i = 0; i < numFiles; i++, fileName += len + 1) {
+		len = strlen(fileName);
+
+		if (FS_ReadFile(va("scripts/%s", fileName), (void **)&buf) < 0 || !buf) {
+			continue;
+		}
+
+		p = buf;
+		COM_BeginParseSession(fileName);
+		while (numNames < maxNames) {
+			token = COM_Parse(&p);
+			if (!token[0]) {
+				break;
+			}
+			if (!Q_stricmp(token, "name")) {
+				token = COM_Parse(&p);
+				if (token[0]) {
+					Q_strncpyz(names[numNames++], token, MAX_NAME_LENGTH);
+				}
+			}
+		}
+
+		FS_FreeFile(buf);
+	}
+
+	qsort(names, numNames, MAX_NAME_LENGTH, SV_BenchmarkCompareNames);
+	return numNames;
+}
+
+/*
+==================
+SV_BenchmarkAddBots
+==================
+*/
+static void SV_BenchmarkAddBots(int count) {
+	char names[MAX_CLIENTS][MAX_NAME_LENGTH];
+	int numNames;
+	int i;
+
+	numNames = SV_BenchmarkBotNames(names, ARRAY_LEN(names));
+	if (!numNames) {
+		Com_Printf("No bots found in scripts/*.bot\n");
+		return;
+	}
+
+	for (i = 0; i < count; i++) {
+		Cmd_ExecuteString(va("addbot \"%s\" 3 \"\" 0", names[i % numNames]));
+	}
+}
+
+/*
+==================
+SV_BenchmarkConnectClients
+==================
+*/
+static void SV_BenchmarkConnectClients(int count) {
+	char userinfo[MAX_INFO_STRING];
+	benchClient_t *bc;
+	netadr_t adr;
+	int i, j;
+
+	svBench.numClients = 0;
+
+	for (i = 0; i < count; i++) {
+		userinfo[0] = '\0';
+		Info_SetValueForKey(userinfo, "name", va("bench%d", i));
+		Info_SetValueForKey(userinfo, "protocol", va("%d", com_protocol->integer));
+		Info_SetValueForKey(userinfo, "qport", va("%d", i + 1));
+		Info_SetValueForKey(userinfo, "challenge", "0");
+		Info_SetValueForKey(userinfo, "rate", "90000");
+		Info_SetValueForKey(userinfo, "snaps", va("%d", sv_fps->integer));
+
+		// a port and qport of their own, or they'd be taken for reconnects
+		Com_Memset(&adr, 0, sizeof(adr));
+		adr.type = NA_LOOPBACK;
+		adr.port = BigShort((short)(i + 1));
+
+		Cmd_TokenizeString(va("connect \"%s\"", userinfo));
+		SV_DirectConnect(adr);
+
+		for (j = 0; j < sv_maxclients->integer; j++) {
+			client_t *cl = &svs.clients[j];
+
+			if (cl->state == CS_CONNECTED && cl->netchan.remoteAddress.type == NA_LOOPBACK &&
+				cl->netchan.qport == i + 1) {
+				break;
+			}
+		}
+		if (j == sv_maxclients->integer) {
+			Com_Printf("Synthetic client %d couldn't connect\n", i);
+			continue;
+		}
+
+		bc = &svBench.clients[svBench.numClients++];
+		Com_Memset(bc, 0, sizeof(*bc));
+		bc->client = &svs.clients[j];
+		bc->rand = svBench.seed ^ (i * 0x9e3779b9);
+		bc->lastSequence = bc->client->netchan.outgoingSequence;
+	}
+}
+
+/*
+==================
+SV_BenchmarkClientMove
+
+Wanders around, changing direction every second or so
+==================
+*/
+static void SV_BenchmarkClientMove(benchClient_t *bc, usercmd_t *cmd) {
+	playerState_t *ps;
+	int i;
+
+	if (!(SV_BenchmarkRand(bc) % sv_fps->integer)) {
+		bc->forwardmove = (SV_BenchmarkRand(bc) % 3 - 1) * 127;
+		bc->rightmove = (SV_BenchmarkRand(bc) % 3 - 1) * 127;
+		bc->turn = SV_BenchmarkRand(bc) % 21 - 10;
+		bc->angles[PITCH] = (float)(SV_BenchmarkRand(bc) % 61 - 30);
+	}
+	bc->angles[YAW] = AngleNormalize360(bc->angles[YAW] + bc->turn);
+	bc->upmove = !(SV_BenchmarkRand(bc) % 16) ? 127 : 0;
+	bc->buttons = (SV_BenchmarkRand(bc) % 4) ? 0 : BUTTON_ATTACK;
+
+	Com_Memset(cmd, 0, sizeof(*cmd));
+	cmd->serverTime = sv.time;
+	for (i = 0; i < 3; i++) {
+		cmd->angles[i] = ANGLE2SHORT(bc->angles[i]);
+	}
+	cmd->forwardmove = bc->forwardmove;
+	cmd->rightmove = bc->rightmove;
+	cmd->upmove = bc->upmove;
+	cmd->buttons = bc->buttons;
+
+	ps = SV_GameClientNum(bc->client - svs.clients);
+	cmd->weapon = ps->weapon;
+}
+
+/*
+==================
+SV_BenchmarkClientPacket
+
+Builds the packet a client would send and executes it as if it had come
+through the netchan
+==================
+*/
+static void SV_BenchmarkClientPacket(benchClient_t *bc) {
+	client_t *cl;
+	byte buf[1024];
+	char lastCommand[MAX_STRING_CHARS];
+	msg_t msg;
+	usercmd_t nullcmd, cmd;
+	int ack, key;
+
+	cl = bc->client;
+	if (cl->state < CS_CONNECTED || cl->netchan.remoteAddress.type != NA_LOOPBACK) {
+		return;
+	}
+
+	ack = cl->netchan.outgoingSequence - 1;
+
+	MSG_Init(&msg, buf, sizeof(buf));
+	MSG_Bitstream(&msg);
+
+	// an old serverId makes the server send the gamestate
+	MSG_WriteLong(&msg, cl->state == CS_CONNECTED ? -1 : sv.serverId);
+	MSG_WriteLong(&msg, ack);
+	MSG_WriteLong(&msg, cl->reliableSequence);
+
+	SV_BenchmarkClientMove(bc, &cmd);
+	SV_GetReliableCommand(cl, cl->reliableSequence, lastCommand, sizeof(lastCommand));
+	key = sv.checksumFeed ^ ack ^ MSG_HashKey(lastCommand, 32);
+	Com_Memset(&nullcmd, 0, sizeof(nullcmd));
+
+	MSG_WriteByte(&msg, clc_move);
+	MSG_WriteByte(&msg, 1);
+	MSG_WriteDeltaUsercmdKey(&msg, key, &nullcmd, &cmd);
+	MSG_WriteByte(&msg, clc_EOF);
+
+	// the pak checksums are taken as right
+	cl->gotCP = qtrue;
+	cl->pureAuthentic = 1;
+	cl->lastPacketTime = svs.time;
+
+	MSG_BeginReading(&msg);
+	SV_ExecuteClientMessage(cl, &msg);
+}
+
+/*
+==================
+SV_BenchmarkCountBytes
+
+Adds up the messages sent to the synthetic clients since the last frame
+==================
+*/
+static int SV_BenchmarkCountBytes(void) {
+	benchClient_t *bc;
+	client_t *cl;
+	int i, bytes;
+
+	bytes = 0;
+	for (i = 0, bc = svBench.clients; i < svBench.numClients; i++, bc++) {
+		cl = bc->client;
+		if (cl->netchan.outgoingSequence - bc->lastSequence > PACKET_BACKUP) {
+			bc->lastSequence = cl->netchan.outgoingSequence - PACKET_BACKUP;
+		}
+		for (; bc->lastSequence < cl->netchan.outgoingSequence; bc->lastSequence++) {
+			bytes += cl->frames[bc->lastSequence & PACKET_MASK].messageSize;
+		}
+	}
+
+	return bytes;
+}
+
+/*
+==================
+SV_BenchmarkFrame
+==================
+*/
+static void SV_BenchmarkFrame(benchFrame_t *frame) {
+	int64_t start;
+	int i;
+
+	Com_Memset(frame, 0, sizeof(*frame));
+	svBench.frame = frame;
+	svBench.depth = 0;
+	svBench.overflow = 0;
+	svBench.stack[0] = SVB_OTHER;
+
+	start = svBench.last = Sys_Microseconds();
+
+	// the packets arrive before the frame, as from Com_EventLoop
+	for (i = 0; i < svBench.numClients; i++) {
+		SV_BenchmarkClientPacket(&svBench.clients[i]);
+	}
+
+	SV_Frame(SV_FrameMsec());
+	SV_SendQueuedMessages();
+
+	SV_BenchEnd();
+	frame->total = (int)(Sys_Microseconds() - start);
+	frame->bytes = SV_BenchmarkCountBytes();
+
+	svBench.frame = NULL;
+}
+
+/*
+==================
+SV_BenchmarkCompare
+==================
+*/
+static int QDECL SV_BenchmarkCompare(const void *a, const void *b) {
+	return *(const int *)a - *(const int *)b;
+}
+
+/*
+==================
+SV_BenchmarkReport
+==================
+*/
+static void SV_BenchmarkReport(const char *map, int numFrames, int numBots, int warmup) {
+	int64_t total, parts[SVB_NUMPARTS], traces, bytes;
+	float percentiles[NUM_BENCH_PERCENTILES];
+	const char *report;
+	fileHandle_t f;
+	benchFrame_t *frame;
+	int i, j;
+
+	total = traces = bytes = 0;
+	Com_Memset(parts, 0, sizeof(parts));
+	for (i = 0, frame = benchFrames; i < numFrames; i++, frame++) {
+		benchSorted[i] = frame->total;
+		total += frame->total;
+		traces += frame->traces;
+		bytes += frame->bytes;
+		for (j = 0; j < SVB_NUMPARTS; j++) {
+			parts[j] += frame->parts[j];
+		}
+	}
+	qsort(benchSorted, numFrames, sizeof(benchSorted[0]), SV_BenchmarkCompare);
+
+	// nearest rank
+	for (i = 0; i < NUM_BENCH_PERCENTILES; i++) {
+		j = (int)ceil(benchPercentiles[i] / 100.0f * numFrames) - 1;
+		if (j < 0) {
+			j = 0;
+		} else if (j > numFrames - 1) {
+			j = numFrames - 1;
+		}
+		percentiles[i] = benchSorted[j] / 1000.0f;
+	}
+
+	Com_Printf("sv_benchmark: %s, %d frames, %d bots, %d clients, seed %d\n", map, numFrames, numBots,
+			   svBench.numClients, svBench.seed);
+	Com_Printf("%.3f seconds, %.1f frames/sec\n", total / 1000000.0f, total ? numFrames * 1000000.0f / total : 0.0f);
+	Com_Printf("frame min %.3f avg %.3f max %.3f ms\n", benchSorted[0] / 1000.0f, total / (numFrames * 1000.0f),
+			   benchSorted[numFrames - 1] / 1000.0f);
+	Com_Printf("percentiles");
+	for (i = 0; i < NUM_BENCH_PERCENTILES; i++) {
+		Com_Printf(" p%g %.3f", benchPercentiles[i], percentiles[i]);
+	}
+	Com_Printf(" ms\n");
+	for (j = 0; j < SVB_NUMPARTS; j++) {
+		Com_Printf("%10s %7.3f ms %5.1f%%\n", benchPartNames[j], parts[j] / (numFrames * 1000.0f),
+				   total ? parts[j] * 100.0f / total : 0.0f);
+	}
+	Com_Printf("%.1f trace calls, %.1f bytes sent a frame\n", (float)traces / numFrames, (float)bytes / numFrames);
+
+	report = Cvar_VariableString("sv_benchmarkReport");
+	if (!*report) {
+		return;
+	}
+
+	f = FS_FOpenFileWrite(va("benchmarks/%s.csv", report));
+	if (f) {
+		FS_Printf(f, "frame,total_us");
+		for (j = 0; j < SVB_NUMPARTS; j++) {
+			FS_Printf(f, ",%s_us", benchPartNames[j]);
+		}
+		FS_Printf(f, ",traces,bytes\n");
+		for (i = 0, frame = benchFrames; i < numFrames; i++, frame++) {
+			FS_Printf(f, "%d,%d", warmup + i, frame->total);
+			for (j = 0; j < SVB_NUMPARTS; j++) {
+				FS_Printf(f, ",%d", frame->parts[j]);
+			}
+			FS_Printf(f, ",%d,%d\n", frame->traces, frame->bytes);
+		}
+		FS_FCloseFile(f);
+	}
+
+	f = FS_FOpenFileWrite(va("benchmarks/%s.json", report));
+	if (!f) {
+		Com_Printf("Couldn't open benchmarks/%s.json for writing\n", report);
+		return;
+	}
+
+	FS_Printf(f, "{\n");
+	FS_Printf(f, "\t\"map\": \"%s\",\n", map);
+	FS_Printf(f, "\t\"version\": \"%s\",\n", Q3_VERSION);
+	FS_Printf(f, "\t\"seed\": %d, \"bots\": %d, \"clients\": %d, \"sv_fps\": %d, \"warmup_frames\": %d,\n", svBench.seed,
+			  numBots, svBench.numClients, sv_fps->integer, warmup);
+	FS_Printf(f, "\t\"frames\": %d, \"seconds\": %.3f, \"fps\": %.2f,\n", numFrames, total / 1000000.0f,
+			  total ? numFrames * 1000000.0f / total : 0.0f);
+	FS_Printf(f, "\t\"min_ms\": %.3f, \"avg_ms\": %.3f, \"max_ms\": %.3f,\n", benchSorted[0] / 1000.0f,
+			  total / (numFrames * 1000.0f), benchSorted[numFrames - 1] / 1000.0f);
+	FS_Printf(f, "\t\"percentiles_ms\": {");
+	for (i = 0; i < NUM_BENCH_PERCENTILES; i++) {
+		FS_Printf(f, "%s\"p%g\": %.3f", i ? ", " : "", benchPercentiles[i], percentiles[i]);
+	}
+	FS_Printf(f, "},\n");
+	FS_Printf(f, "\t\"parts_ms\": {");
+	for (j = 0; j < SVB_NUMPARTS; j++) {
+		FS_Printf(f, "%s\"%s\": %.3f", j ? ", " : "", benchPartNames[j], parts[j] / (numFrames * 1000.0f));
+	}
+	FS_Printf(f, "},\n");
+	FS_Printf(f, "\t\"traces_per_frame\": %.2f, \"bytes_per_frame\": %.2f\n", (float)traces / numFrames,
+			  (float)bytes / numFrames);
+	FS_Printf(f, "}\n");
+	FS_FCloseFile(f);
+
+	Com_Printf("benchmarks/%s.json written\n", report);
+}
+
+/*
+==================
+SV_Benchmark_f
+
+sv_benchmark <map> <frames> [bots] [clients] [seed]
+==================
+*/
+void SV_Benchmark_f(void) {
+	char map[MAX_QPATH];
+	int numFrames, numBots, numClients, warmup;
+	int i;
+
+	if (Cmd_Argc() < 3) {
+		Com_Printf("Usage: %s <map> <frames> [bots] [clients] [seed]\n", Cmd_Argv(0));
+		return;
+	}
+
+	if (!com_dedicated->integer) {
+		Com_Printf("%s only runs on a dedicated server.\n", Cmd_Argv(0));
+		return;
+	}
+
+	// the map command tokenizes over the arguments
+	Q_strncpyz(map, Cmd_Argv(1), sizeof(map));
+	numFrames = atoi(Cmd_Argv(2));
+	numBots = atoi(Cmd_Argv(3));
+	numClients = atoi(Cmd_Argv(4));
+	svBench.seed = Cmd_Argc() > 5 ? atoi(Cmd_Argv(5)) : 1;
+
+	if (numFrames < 1 || numFrames > MAX_BENCHMARK_FRAMES) {
+		Com_Printf("frames must be 1 to %d\n", MAX_BENCHMARK_FRAMES);
+		return;
+	}
+	if (numBots < 0 || numClients < 0 || numBots + numClients > MAX_CLIENTS) {
+		Com_Printf("at most %d bots and clients\n", MAX_CLIENTS);
+		return;
+	}
+	warmup = sv_benchmarkWarmup->integer > 0 ? sv_benchmarkWarmup->integer : 0;
+
+	if (numBots + numClients > sv_maxclients->integer) {
+		Cvar_SetLatched("sv_maxclients", va("%d", numBots + numClients));
+	}
+
+	// the engine, botlib and game all start from the seed
+	svBench.active = qtrue;
+	srand(svBench.seed);
+
+	Cmd_ExecuteString(va("map %s", map));
+	if (!com_sv_running->integer || sv.state != SS_GAME) {
+		svBench.active = qfalse;
+		return;
+	}
+
+	SV_BenchmarkAddBots(numBots);
+	SV_BenchmarkConnectClients(numClients);
+
+	Com_Printf("Running %d warmup and %d measured frames...\n", warmup, numFrames);
+
+	sv_benchmarking = 1;
+	for (i = 0; i < warmup; i++) {
+		SV_BenchmarkFrame(&benchFrames[0]);
+	}
+	for (i = 0; i < numFrames; i++) {
+		SV_BenchmarkFrame(&benchFrames[i]);
+	}
+	sv_benchmarking = 0;
+
+	SV_BenchmarkReport(map, numFrames, numBots, warmup);
+
+	for (i = 0; i < svBench.numClients; i++) {
+		if (svBench.clients[i].client->state >= CS_CONNECTED) {
+			SV_DropClient(svBench.clients[i].client, "benchmark finished");
+		}
+	}
+
+	svBench.numClients = 0;
+	svBench.active = qfalse;
+}
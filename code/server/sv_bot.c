@@ -184,7 +184,9 @@ static void BotImport_Trace(bsp_trace_t *bsptrace, vec3_t start, vec3_t mins, ve
 							int contentmask) {
 	trace_t trace;
 
+	SV_BENCH_BEGIN(SVB_TRACE);
 	SV_Trace(&trace, start, mins, maxs, end, passent, contentmask, qfalse);
+	SV_BENCH_END();
 	// copy the trace information
 	bsptrace->allsolid = trace.allsolid;
 	bsptrace->startsolid = trace.startsolid;
@@ -315,10 +317,18 @@ BotImport_HunkAlloc
 =================
 */
 static void *BotImport_HunkAlloc(int size) {
+	memOwner_t owner;
+	void *buf;
+
 	if (Hunk_CheckMark()) {
 		Com_Error(ERR_DROP, "SV_Bot_HunkAlloc: Alloc with marks already set");
 	}
-	return Hunk_Alloc(size, h_high);
+
+	owner = Com_SetMemOwner(MEMOWNER_BOTLIB);
+	buf = Hunk_Alloc(size, h_high);
+	Com_SetMemOwner(owner);
+
+	return buf;
 }
 
 /*
@@ -449,7 +459,9 @@ void SV_BotFrame(int time) {
 	// NOTE: maybe the game is already shutdown
 	if (!gvm)
 		return;
+	SV_BENCH_BEGIN(SVB_BOTAI);
 	VM_Call(gvm, BOTAI_START_FRAME, time);
+	SV_BENCH_END();
 }
 
 /*
@@ -508,6 +520,7 @@ void SV_BotInitCvars(void) {
 	Cvar_Get("bot_forcewrite", "0", 0);					// force writing aas file
 	Cvar_Get("bot_aasoptimize", "0", 0);				// no aas file optimisation
 	Cvar_Get("bot_saveroutingcache", "0", 0);			// save routing cache
+	Cvar_Get("bot_precomputeroutes", "0", 0);			// build (1) and save (2) the portal routing
 	Cvar_Get("bot_thinktime", "100", CVAR_CHEAT);		// msec the bots thinks
 	Cvar_Get("bot_reloadcharacters", "0", 0);			// reload the bot characters each time
 	Cvar_Get("bot_testichat", "0", 0);					// test ichats
@@ -593,7 +606,6 @@ SV_BotGetConsoleMessage
 */
 int SV_BotGetConsoleMessage(int client, char *buf, int size) {
 	client_t *cl;
-	int index;
 
 	cl = &svs.clients[client];
 	cl->lastPacketTime = svs.time;
@@ -603,13 +615,12 @@ int SV_BotGetConsoleMessage(int client, char *buf, int size) {
 	}
 
 	cl->reliableAcknowledge++;
-	index = cl->reliableAcknowledge & (MAX_RELIABLE_COMMANDS - 1);
+	SV_GetReliableCommand(cl, cl->reliableAcknowledge, buf, size);
 
-	if (!cl->reliableCommands[index][0]) {
+	if (!buf[0]) {
 		return qfalse;
 	}
 
-	Q_strncpyz(buf, cl->reliableCommands[index], size);
 	return qtrue;
 }
 
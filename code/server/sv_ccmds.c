@@ -503,6 +503,60 @@ static void SV_KickNum_f(void) {
 	cl->lastPacketTime = svs.time; // in case there is a funny zombie
 }
 
+/*
+==================
+SV_Record_f
+
+Records a demo of what a client is sent
+==================
+*/
+static void SV_Record_f(void) {
+	char name[MAX_OSPATH];
+	client_t *cl;
+	qtime_t now;
+
+	// make sure server is running
+	if (!com_sv_running->integer) {
+		Com_Printf("Server is not running.\n");
+		return;
+	}
+
+	if (Cmd_Argc() < 2 || Cmd_Argc() > 3) {
+		Com_Printf("Usage: %s <client number> [demoname]\n", Cmd_Argv(0));
+		return;
+	}
+
+	cl = SV_GetPlayerByNum();
+	if (!cl) {
+		return;
+	}
+
+	if (Cmd_Argc() == 3) {
+		Com_sprintf(name, sizeof(name), "demos/%s.%s%d", Cmd_Argv(2), DEMOEXT, com_protocol->integer);
+	} else {
+		Com_RealTime(&now);
+		Com_sprintf(name, sizeof(name), "demos/server_%i_%04d%02d%02d_%02d%02d%02d.%s%d", (int)(cl - svs.clients),
+					1900 + now.tm_year, 1 + now.tm_mon, now.tm_mday, now.tm_hour, now.tm_min, now.tm_sec, DEMOEXT,
+					com_protocol->integer);
+	}
+
+	SV_StartDemo(cl, name);
+}
+
+/*
+==================
+SV_StopRecord_f
+==================
+*/
+static void SV_StopRecord_f(void) {
+	if (!SV_DemoRecording()) {
+		Com_Printf("Not recording a demo.\n");
+		return;
+	}
+
+	SV_StopDemo();
+}
+
 /*
 ==================
 SV_RehashBans_f
@@ -1339,6 +1393,13 @@ void SV_AddOperatorCommands(void) {
 	Cmd_AddCommand("dumpuser", SV_DumpUser_f);
 	Cmd_AddCommand("map_restart", SV_MapRestart_f);
 	Cmd_AddCommand("sectorlist", SV_SectorList_f);
+	Cmd_AddCommand("sv_ratelimitStats", SVC_RateLimitStats_f);
+	Cmd_AddCommand("sv_configstringStats", SV_ConfigstringStats_f);
+	Cmd_AddCommand("sv_record", SV_Record_f);
+	Cmd_AddCommand("sv_stoprecord", SV_StopRecord_f);
+	Cmd_AddCommand("sv_benchmark", SV_Benchmark_f);
+	Cmd_AddCommand("sv_microbench", SV_Microbench_f);
+	Cmd_AddCommand("huffstats", SV_HuffStats_f);
 	Cmd_AddCommand("map", SV_Map_f);
 	Cmd_SetCommandCompletionFunc("map", SV_CompleteMapName);
 #ifndef PRE_RELEASE_DEMO
@@ -376,6 +376,12 @@ gotnewcl:
 
 	// save the address
 	Netchan_Setup(NS_SERVER, &newcl->netchan, from, qport, challenge, qfalse);
+	if (sv_netCompression->integer) {
+		newcl->netchan.compression = MIN(atoi(Info_ValueForKey(userinfo, "netcomp")), NETCOMP_VERSION);
+		if (newcl->netchan.compression < 0) {
+			newcl->netchan.compression = 0;
+		}
+	}
 	// init the netchan queue
 	newcl->netchan_end_queue = &newcl->netchan_start_queue;
 
@@ -396,7 +402,11 @@ gotnewcl:
 	SV_UserinfoChanged(newcl);
 
 	// send the connect packet to the client
-	NET_OutOfBandPrint(NS_SERVER, from, "connectResponse %d", challenge);
+	if (newcl->netchan.compression > 0) {
+		NET_OutOfBandPrint(NS_SERVER, from, "connectResponse %d %d", challenge, newcl->netchan.compression);
+	} else {
+		NET_OutOfBandPrint(NS_SERVER, from, "connectResponse %d", challenge);
+	}
 
 	Com_DPrintf("Going from CS_FREE to CS_CONNECTED for %s\n", newcl->name);
 
@@ -432,15 +442,14 @@ Destructor for data allocated in a client structure
 */
 void SV_FreeClient(client_t *client) {
 #ifdef USE_VOIP
-	int index;
-
-	for (index = client->queuedVoipIndex; index < client->queuedVoipPackets; index++) {
-		index %= ARRAY_LEN(client->voipPacket);
+	int i;
 
-		Z_Free(client->voipPacket[index]);
+	for (i = 0; i < client->queuedVoipPackets; i++) {
+		SV_ReleaseVoipPacket(client->voipPacket[(client->queuedVoipIndex + i) % ARRAY_LEN(client->voipPacket)]);
 	}
 
 	client->queuedVoipPackets = 0;
+	client->queuedVoipIndex = 0;
 #endif
 
 	SV_Netchan_FreeQueue(client);
@@ -490,6 +499,8 @@ void SV_DropClient(client_t *drop, const char *reason) {
 	// add the disconnect command
 	SV_SendServerCommand(drop, "disconnect \"%s\"", reason);
 
+	SV_DemoClientDropped(drop);
+
 	if (isBot) {
 		SV_BotFreeClient(drop - svs.clients);
 
@@ -519,54 +530,33 @@ void SV_DropClient(client_t *drop, const char *reason) {
 
 /*
 ================
-SV_SendClientGameState
-
-Sends the first message from the server to a connected client.
-This will be sent on the initial connection and upon each new map load.
-
-It will be resent if the client acknowledges a later message but has
-the wrong gamestate.
+SV_WriteGameState
 ================
 */
-static void SV_SendClientGameState(client_t *client) {
+void SV_WriteGameState(client_t *client, msg_t *msg) {
 	int start;
 	entityState_t *base, nullstate;
-	msg_t msg;
-	byte msgBuffer[MAX_MSGLEN];
-
-	Com_DPrintf("SV_SendClientGameState() for %s\n", client->name);
-	Com_DPrintf("Going from CS_CONNECTED to CS_PRIMED for %s\n", client->name);
-	client->state = CS_PRIMED;
-	client->pureAuthentic = 0;
-	client->gotCP = qfalse;
-
-	// when we receive the first packet from the client, we will
-	// notice that it is from a different serverid and that the
-	// gamestate message was not just sent, forcing a retransmit
-	client->gamestateMessageNum = client->netchan.outgoingSequence;
-
-	MSG_Init(&msg, msgBuffer, sizeof(msgBuffer));
 
 	// NOTE, MRE: all server->client messages now acknowledge
 	// let the client know which reliable clientCommands we have received
-	MSG_WriteLong(&msg, client->lastClientCommand);
+	MSG_WriteLong(msg, client->lastClientCommand);
 
 	// send any server commands waiting to be sent first.
 	// we have to do this cause we send the client->reliableSequence
 	// with a gamestate and it sets the clc.serverCommandSequence at
 	// the client side
-	SV_UpdateServerCommandsToClient(client, &msg);
+	SV_UpdateServerCommandsToClient(client, msg);
 
 	// send the gamestate
-	MSG_WriteByte(&msg, svc_gamestate);
-	MSG_WriteLong(&msg, client->reliableSequence);
+	MSG_WriteByte(msg, svc_gamestate);
+	MSG_WriteLong(msg, client->reliableSequence);
 
 	// write the configstrings
 	for (start = 0; start < MAX_CONFIGSTRINGS; start++) {
 		if (sv.configstrings[start][0]) {
-			MSG_WriteByte(&msg, svc_configstring);
-			MSG_WriteShort(&msg, start);
-			MSG_WriteBigString(&msg, sv.configstrings[start]);
+			MSG_WriteByte(msg, svc_configstring);
+			MSG_WriteShort(msg, start);
+			MSG_WriteBigString(msg, sv.configstrings[start]);
 		}
 	}
 
@@ -577,16 +567,59 @@ static void SV_SendClientGameState(client_t *client) {
 		if (!base->number) {
 			continue;
 		}
-		MSG_WriteByte(&msg, svc_baseline);
-		MSG_WriteDeltaEntity(&msg, &nullstate, base, qtrue);
+		MSG_WriteByte(msg, svc_baseline);
+		MSG_WriteDeltaEntity(msg, &nullstate, base, qtrue);
 	}
 
-	MSG_WriteByte(&msg, svc_EOF);
+	MSG_WriteByte(msg, svc_EOF);
 
-	MSG_WriteLong(&msg, client - svs.clients);
+	MSG_WriteLong(msg, client - svs.clients);
 
 	// write the checksum feed
-	MSG_WriteLong(&msg, sv.checksumFeed);
+	MSG_WriteLong(msg, sv.checksumFeed);
+}
+
+/*
+================
+SV_SendClientGameState
+
+Sends the first message from the server to a connected client.
+This will be sent on the initial connection and upon each new map load.
+
+It will be resent if the client acknowledges a later message but has
+the wrong gamestate.
+================
+*/
+static void SV_SendClientGameState(client_t *client) {
+	msg_t msg;
+	byte msgBuffer[MAX_MSGLEN];
+
+	Com_DPrintf("SV_SendClientGameState() for %s\n", client->name);
+	Com_DPrintf("Going from CS_CONNECTED to CS_PRIMED for %s\n", client->name);
+	client->state = CS_PRIMED;
+	client->pureAuthentic = 0;
+	client->gotCP = qfalse;
+
+	// when we receive the first packet from the client, we will
+	// notice that it is from a different serverid and that the
+	// gamestate message was not just sent, forcing a retransmit
+	client->gamestateMessageNum = client->netchan.outgoingSequence;
+
+	if (client->netchan.compression) {
+		// raw bytes LZ compress far better than huffman codes, but they
+		// take more room, so fall back to huffman if they do not fit.
+		// One byte is kept for the svc_EOF added on transmit.
+		MSG_Init(&msg, msgBuffer, sizeof(msgBuffer) - 1);
+		msg.allowoverflow = qtrue;
+		msg.raw = qtrue;
+		SV_WriteGameState(client, &msg);
+		msg.maxsize = sizeof(msgBuffer);
+	}
+
+	if (!client->netchan.compression || msg.overflowed) {
+		MSG_Init(&msg, msgBuffer, sizeof(msgBuffer));
+		SV_WriteGameState(client, &msg);
+	}
 
 	// deliver this to the client
 	SV_SendMessageToClient(&msg, client);
@@ -634,6 +667,28 @@ CLIENT COMMAND EXECUTION
 ============================================================
 */
 
+/*
+=============================================================================
+
+The window of unacknowledged download blocks starts small and grows like
+TCP's, by a block per ack until the first timeout and by a block per window
+after that, up to the MAX_DOWNLOAD_WINDOW that clients can take.  Blocks
+are paced over the round trip time, and resent once the retransmit timeout
+derived from it passes, which halves the window.  Clients the rate isn't
+enforced for get larger blocks once the window is full.  The file is read
+ahead into a ring the blocks are sent from.
+
+=============================================================================
+*/
+
+#define DOWNLOAD_BUFFER_SIZE (128 * 1024)
+#define DOWNLOAD_READ_SIZE (32 * 1024)
+#define DOWNLOAD_MAX_BLKSIZE 2048 // a full window of these and a read fit in the buffer
+#define DOWNLOAD_START_WINDOW 8
+#define DOWNLOAD_MIN_WINDOW 4
+#define DOWNLOAD_MIN_RTO 200
+#define DOWNLOAD_MAX_RTO 1000
+
 /*
 ==================
 SV_CloseDownload
@@ -642,8 +697,6 @@ clear/free any download vars
 ==================
 */
 static void SV_CloseDownload(client_t *cl) {
-	int i;
-
 	// EOF
 	if (cl->download) {
 		FS_FCloseFile(cl->download);
@@ -652,12 +705,149 @@ static void SV_CloseDownload(client_t *cl) {
 	*cl->downloadName = 0;
 
 	// Free the temporary buffer space
-	for (i = 0; i < MAX_DOWNLOAD_WINDOW; i++) {
-		if (cl->downloadBlocks[i]) {
-			Z_Free(cl->downloadBlocks[i]);
-			cl->downloadBlocks[i] = NULL;
+	if (cl->downloadBuffer) {
+		Z_Free(cl->downloadBuffer);
+		cl->downloadBuffer = NULL;
+	}
+}
+
+/*
+==================
+SV_DownloadRto
+
+Msec without an ack before the window is sent again
+==================
+*/
+static int SV_DownloadRto(client_t *cl) {
+	int rto;
+
+	if (!cl->downloadRtt) {
+		return DOWNLOAD_MAX_RTO;
+	}
+
+	rto = cl->downloadRtt + 4 * cl->downloadRttVar;
+	if (rto < DOWNLOAD_MIN_RTO) {
+		return DOWNLOAD_MIN_RTO;
+	}
+	if (rto > DOWNLOAD_MAX_RTO) {
+		return DOWNLOAD_MAX_RTO;
+	}
+	return rto;
+}
+
+/*
+==================
+SV_DownloadAcked
+
+Times the block the client acknowledged and grows the window
+==================
+*/
+static void SV_DownloadAcked(client_t *cl) {
+	int now, sample, delta;
+
+	now = Sys_Milliseconds();
+
+	// a block that was sent again can't tell which send was acked
+	if (cl->downloadClientBlock >= cl->downloadResendBlock) {
+		sample = now - cl->downloadBlockTime[cl->downloadClientBlock % MAX_DOWNLOAD_WINDOW];
+		if (sample < 1) {
+			sample = 1;
+		}
+
+		if (!cl->downloadRtt) {
+			cl->downloadRtt = sample;
+			cl->downloadRttVar = sample / 2;
+		} else {
+			delta = sample - cl->downloadRtt;
+			cl->downloadRtt += delta / 8;
+			cl->downloadRttVar += (abs(delta) - cl->downloadRttVar) / 4;
+			if (cl->downloadRtt < 1) {
+				cl->downloadRtt = 1;
+			}
+		}
+	}
+
+	if (cl->downloadWindow < cl->downloadThreshold) {
+		cl->downloadWindow++;
+	} else if (++cl->downloadWindowAcks >= cl->downloadWindow) {
+		cl->downloadWindowAcks = 0;
+
+		if (cl->downloadWindow < MAX_DOWNLOAD_WINDOW) {
+			cl->downloadWindow++;
+		} else if (cl->downloadBlkSize < DOWNLOAD_MAX_BLKSIZE &&
+				   (cl->netchan.remoteAddress.type == NA_LOOPBACK ||
+					(sv_lanForceRate->integer && Sys_IsLANAddress(cl->netchan.remoteAddress)))) {
+			// the messages of larger blocks are fragmented, and the
+			// fragments are held back by the rate for other clients
+			cl->downloadBlkSize *= 2;
 		}
 	}
+
+	cl->downloadSendTime = now;
+}
+
+/*
+==================
+SV_DownloadTimeout
+
+Nothing was acked for too long, start sending the window again
+==================
+*/
+static void SV_DownloadTimeout(client_t *cl) {
+	Com_DPrintf("clientDownload: %d : resending from block %d, window %d\n", (int)(cl - svs.clients),
+				cl->downloadClientBlock, cl->downloadWindow);
+
+	cl->downloadXmitBlock = cl->downloadClientBlock;
+	cl->downloadResendBlock = cl->downloadCurrentBlock;
+
+	cl->downloadThreshold = cl->downloadWindow / 2;
+	if (cl->downloadThreshold < DOWNLOAD_MIN_WINDOW) {
+		cl->downloadThreshold = DOWNLOAD_MIN_WINDOW;
+	}
+	cl->downloadWindow = cl->downloadThreshold;
+	cl->downloadWindowAcks = 0;
+
+	if (cl->downloadBlkSize > MAX_DOWNLOAD_BLKSIZE) {
+		cl->downloadBlkSize /= 2;
+	}
+
+	// back off until an ack comes in
+	if (cl->downloadRttVar < DOWNLOAD_MAX_RTO) {
+		cl->downloadRttVar = cl->downloadRttVar * 2 + 1;
+	}
+}
+
+/*
+==================
+SV_DownloadReadAhead
+
+Fills the free part of the ring, the blocks that aren't acked yet are kept
+==================
+*/
+static void SV_DownloadReadAhead(client_t *cl) {
+	int first, start, len, read;
+
+	if (cl->downloadClientBlock < cl->downloadCurrentBlock) {
+		first = cl->downloadBlockOffset[cl->downloadClientBlock % MAX_DOWNLOAD_WINDOW];
+	} else {
+		first = cl->downloadCount;
+	}
+
+	while (cl->downloadReadCount < cl->downloadSize &&
+		   DOWNLOAD_BUFFER_SIZE - (cl->downloadReadCount - first) >= DOWNLOAD_READ_SIZE) {
+		start = cl->downloadReadCount % DOWNLOAD_BUFFER_SIZE;
+		len = MIN(DOWNLOAD_READ_SIZE, cl->downloadSize - cl->downloadReadCount);
+		len = MIN(len, DOWNLOAD_BUFFER_SIZE - start);
+
+		read = FS_Read(cl->downloadBuffer + start, len, cl->download);
+		if (read <= 0) {
+			// EOF right now
+			cl->downloadSize = cl->downloadReadCount;
+			break;
+		}
+
+		cl->downloadReadCount += read;
+	}
 }
 
 /*
@@ -711,7 +901,7 @@ static void SV_NextDownload_f(client_t *cl) {
 			return;
 		}
 
-		cl->downloadSendTime = svs.time;
+		SV_DownloadAcked(cl);
 		cl->downloadClientBlock++;
 		return;
 	}
@@ -741,11 +931,13 @@ static void SV_BeginDownload_f(client_t *cl) {
 SV_WriteDownloadToClient
 
 Check to see if the client wants a file, open it if needed and start pumping the client
-Fill up msg with data, return number of download blocks added
+Fill up msg with data, return number of download blocks added, counted in
+blocks of MAX_DOWNLOAD_BLKSIZE
 ==================
 */
 static int SV_WriteDownloadToClient(client_t *cl, msg_t *msg) {
 	int curindex;
+	int size, start, len, now;
 	int unreferenced = 1;
 	char errorMessage[1024];
 	char pakbuf[MAX_QPATH], *pakptr;
@@ -847,27 +1039,39 @@ static int SV_WriteDownloadToClient(client_t *cl, msg_t *msg) {
 		// Init
 		cl->downloadCurrentBlock = cl->downloadClientBlock = cl->downloadXmitBlock = 0;
 		cl->downloadCount = 0;
+		cl->downloadReadCount = 0;
 		cl->downloadEOF = qfalse;
-	}
 
-	// Perform any reads that we need to
-	while (cl->downloadCurrentBlock - cl->downloadClientBlock < MAX_DOWNLOAD_WINDOW &&
-		   cl->downloadSize != cl->downloadCount) {
+		if (!cl->downloadBuffer) {
+			cl->downloadBuffer = Z_Malloc(DOWNLOAD_BUFFER_SIZE);
+		}
 
-		curindex = (cl->downloadCurrentBlock % MAX_DOWNLOAD_WINDOW);
+		cl->downloadWindow = DOWNLOAD_START_WINDOW;
+		cl->downloadThreshold = MAX_DOWNLOAD_WINDOW;
+		cl->downloadWindowAcks = 0;
+		cl->downloadBlkSize = MAX_DOWNLOAD_BLKSIZE;
+		cl->downloadResendBlock = 0;
+		cl->downloadRtt = 0;
+		cl->downloadRttVar = 0;
+		cl->downloadNextSend = 0;
+		cl->downloadSendTime = Sys_Milliseconds();
+	}
 
-		if (!cl->downloadBlocks[curindex])
-			cl->downloadBlocks[curindex] = Z_Malloc(MAX_DOWNLOAD_BLKSIZE);
+	// Perform any reads that we need to
+	SV_DownloadReadAhead(cl);
 
-		cl->downloadBlockSize[curindex] = FS_Read(cl->downloadBlocks[curindex], MAX_DOWNLOAD_BLKSIZE, cl->download);
+	while (cl->downloadCurrentBlock - cl->downloadClientBlock < cl->downloadWindow &&
+		   cl->downloadSize != cl->downloadCount) {
 
-		if (cl->downloadBlockSize[curindex] < 0) {
-			// EOF right now
-			cl->downloadCount = cl->downloadSize;
+		size = MIN(cl->downloadBlkSize, cl->downloadReadCount - cl->downloadCount);
+		if (size <= 0) {
 			break;
 		}
 
-		cl->downloadCount += cl->downloadBlockSize[curindex];
+		curindex = (cl->downloadCurrentBlock % MAX_DOWNLOAD_WINDOW);
+		cl->downloadBlockOffset[curindex] = cl->downloadCount;
+		cl->downloadBlockSize[curindex] = size;
+		cl->downloadCount += size;
 
 		// Load in next block
 		cl->downloadCurrentBlock++;
@@ -875,9 +1079,11 @@ static int SV_WriteDownloadToClient(client_t *cl, msg_t *msg) {
 
 	// Check to see if we have eof condition and add the EOF block
 	if (cl->downloadCount == cl->downloadSize && !cl->downloadEOF &&
-		cl->downloadCurrentBlock - cl->downloadClientBlock < MAX_DOWNLOAD_WINDOW) {
+		cl->downloadCurrentBlock - cl->downloadClientBlock < cl->downloadWindow) {
 
-		cl->downloadBlockSize[cl->downloadCurrentBlock % MAX_DOWNLOAD_WINDOW] = 0;
+		curindex = (cl->downloadCurrentBlock % MAX_DOWNLOAD_WINDOW);
+		cl->downloadBlockOffset[curindex] = cl->downloadCount;
+		cl->downloadBlockSize[curindex] = 0;
 		cl->downloadCurrentBlock++;
 
 		cl->downloadEOF = qtrue; // We have added the EOF block
@@ -886,18 +1092,24 @@ static int SV_WriteDownloadToClient(client_t *cl, msg_t *msg) {
 	if (cl->downloadClientBlock == cl->downloadCurrentBlock)
 		return 0; // Nothing to transmit
 
+	now = Sys_Milliseconds();
+
 	// Write out the next section of the file, if we have already reached our window,
 	// automatically start retransmitting
-	if (cl->downloadXmitBlock == cl->downloadCurrentBlock) {
+	if (cl->downloadXmitBlock == cl->downloadCurrentBlock ||
+		cl->downloadXmitBlock - cl->downloadClientBlock >= cl->downloadWindow) {
 		// We have transmitted the complete window, should we start resending?
-		if (svs.time - cl->downloadSendTime > 1000)
-			cl->downloadXmitBlock = cl->downloadClientBlock;
+		if (now - cl->downloadSendTime > SV_DownloadRto(cl))
+			SV_DownloadTimeout(cl);
 		else
 			return 0;
+	} else if (now - cl->downloadNextSend < 0) {
+		return 0; // spread the window over the round trip
 	}
 
 	// Send current block
 	curindex = (cl->downloadXmitBlock % MAX_DOWNLOAD_WINDOW);
+	size = cl->downloadBlockSize[curindex];
 
 	MSG_WriteByte(msg, svc_download);
 	MSG_WriteShort(msg, cl->downloadXmitBlock);
@@ -906,20 +1118,69 @@ static int SV_WriteDownloadToClient(client_t *cl, msg_t *msg) {
 	if (cl->downloadXmitBlock == 0)
 		MSG_WriteLong(msg, cl->downloadSize);
 
-	MSG_WriteShort(msg, cl->downloadBlockSize[curindex]);
+	MSG_WriteShort(msg, size);
 
-	// Write the block
-	if (cl->downloadBlockSize[curindex])
-		MSG_WriteData(msg, cl->downloadBlocks[curindex], cl->downloadBlockSize[curindex]);
+	// Write the block, it may wrap around the end of the ring
+	if (size) {
+		start = cl->downloadBlockOffset[curindex] % DOWNLOAD_BUFFER_SIZE;
+		len = MIN(size, DOWNLOAD_BUFFER_SIZE - start);
+		MSG_WriteData(msg, cl->downloadBuffer + start, len);
+		if (len < size)
+			MSG_WriteData(msg, cl->downloadBuffer, size - len);
+		svMetrics.downloadBytes += size;
+	}
 
 	Com_DPrintf("clientDownload: %d : writing block %d\n", (int)(cl - svs.clients), cl->downloadXmitBlock);
 
 	// Move on to the next block
 	// It will get sent with next snap shot.  The rate will keep us in line.
+	cl->downloadBlockTime[curindex] = now;
 	cl->downloadXmitBlock++;
-	cl->downloadSendTime = svs.time;
+	cl->downloadSendTime = now;
+	cl->downloadNextSend = now + cl->downloadRtt / cl->downloadWindow;
+
+	// sv_dlRate is counted in blocks of the standard size
+	return size > MAX_DOWNLOAD_BLKSIZE ? (size + MAX_DOWNLOAD_BLKSIZE - 1) / MAX_DOWNLOAD_BLKSIZE : 1;
+}
+
+/*
+==================
+SV_DownloadWaitMsec
+
+Msec until a download has a block to send or resend, -1 if none is waiting
+==================
+*/
+int SV_DownloadWaitMsec(void) {
+	int i, now, wait, best;
+	client_t *cl;
+
+	now = Sys_Milliseconds();
+	best = -1;
+
+	for (i = 0; i < sv_maxclients->integer; i++) {
+		cl = &svs.clients[i];
+
+		if (!cl->state || !*cl->downloadName || !cl->download ||
+			cl->downloadClientBlock == cl->downloadCurrentBlock) {
+			continue;
+		}
+
+		if (cl->downloadXmitBlock == cl->downloadCurrentBlock ||
+			cl->downloadXmitBlock - cl->downloadClientBlock >= cl->downloadWindow) {
+			wait = cl->downloadSendTime + SV_DownloadRto(cl) + 1 - now;
+		} else {
+			wait = cl->downloadNextSend - now;
+		}
 
-	return 1;
+		if (wait < 1) {
+			wait = 1;
+		}
+		if (best == -1 || wait < best) {
+			best = wait;
+		}
+	}
+
+	return best;
 }
 
 /*
@@ -1172,13 +1433,17 @@ into a more C friendly form.
 =================
 */
 void SV_UserinfoChanged(client_t *cl) {
+	static infoDict_t userinfo;
 	const char *val;
 	const char *ip;
 	int i;
-	int len;
+
+	Info_DictInit(&userinfo, MAX_INFO_STRING, qfalse);
+	Info_DictParse(&userinfo, cl->userinfo);
 
 	// name for C code
-	Q_strncpyz(cl->name, Info_ValueForKey(cl->userinfo, "name"), sizeof(cl->name));
+	Q_strncpyz(cl->name, Info_DictValue(&userinfo, "name"), sizeof(cl->name));
+	SV_InvalidateQueryCache();
 
 	// rate command
 
@@ -1187,7 +1452,7 @@ void SV_UserinfoChanged(client_t *cl) {
 	if (Sys_IsLANAddress(cl->netchan.remoteAddress) && com_dedicated->integer != 2 && sv_lanForceRate->integer == 1) {
 		cl->rate = 99999; // lans should not rate limit
 	} else {
-		val = Info_ValueForKey(cl->userinfo, "rate");
+		val = Info_DictValue(&userinfo, "rate");
 		if (strlen(val)) {
 			i = atoi(val);
 			cl->rate = i;
@@ -1200,16 +1465,23 @@ void SV_UserinfoChanged(client_t *cl) {
 			cl->rate = 3000;
 		}
 	}
-	val = Info_ValueForKey(cl->userinfo, "handicap");
+	// snapshots are coded with the alternate huffman table if both sides have it
+	cl->huffTable = MSG_HUFF_DEFAULT;
+	if (cl->netchan.compression && MSG_HuffTableVersion() &&
+		atoi(Info_DictValue(&userinfo, "nethuff")) == MSG_HuffTableVersion()) {
+		cl->huffTable = MSG_HUFF_ALTERNATE;
+	}
+
+	val = Info_DictValue(&userinfo, "handicap");
 	if (strlen(val)) {
 		i = atoi(val);
 		if (i <= 0 || i > 100 || strlen(val) > 4) {
-			Info_SetValueForKey(cl->userinfo, "handicap", "100");
+			Info_DictSet(&userinfo, "handicap", "100");
 		}
 	}
 
 	// snaps command
-	val = Info_ValueForKey(cl->userinfo, "snaps");
+	val = Info_DictValue(&userinfo, "snaps");
 
 	if (strlen(val)) {
 		i = atoi(val);
@@ -1230,7 +1502,7 @@ void SV_UserinfoChanged(client_t *cl) {
 	}
 
 #ifdef USE_VOIP
-	val = Info_ValueForKey(cl->userinfo, "cl_voipProtocol");
+	val = Info_DictValue(&userinfo, "cl_voipProtocol");
 	cl->hasVoip = !Q_stricmp(val, "opus");
 #endif
 
@@ -1242,16 +1514,10 @@ void SV_UserinfoChanged(client_t *cl) {
 	else
 		ip = (char *)NET_AdrToString(cl->netchan.remoteAddress);
 
-	val = Info_ValueForKey(cl->userinfo, "ip");
-	if (val[0])
-		len = strlen(ip) - strlen(val) + strlen(cl->userinfo);
-	else
-		len = strlen(ip) + 4 + strlen(cl->userinfo);
-
-	if (len >= MAX_INFO_STRING)
+	if (!Info_DictSet(&userinfo, "ip", ip))
 		SV_DropClient(cl, "userinfo string length exceeded");
 	else
-		Info_SetValueForKey(cl->userinfo, "ip", ip);
+		Info_DictWrite(&userinfo, cl->userinfo, sizeof(cl->userinfo));
 }
 
 /*
@@ -1417,7 +1683,44 @@ void SV_ClientThink(client_t *cl, usercmd_t *cmd) {
 		return; // may have been kicked during the last usercmd
 	}
 
+	SV_BENCH_BEGIN(SVB_GAME);
 	VM_Call(gvm, GAME_CLIENT_THINK, cl - svs.clients);
+	SV_BENCH_END();
+}
+
+/*
+==================
+SV_ClientThinkBatch
+
+Runs the new commands of a packet, the game gets all of them in a single
+GAME_CLIENT_THINK_BATCH when it handles that
+==================
+*/
+static void SV_ClientThinkBatch(client_t *cl, usercmd_t *cmds, int numCmds) {
+	intptr_t result;
+	int i;
+
+	if (numCmds > 1 && numCmds <= MAX_THINK_USERCMDS && sv.gameThinkBatch) {
+		cl->lastUsercmd = cmds[numCmds - 1];
+		Com_Memcpy(cl->thinkCmds, cmds, numCmds * sizeof(*cmds));
+		cl->numThinkCmds = numCmds;
+
+		SV_BENCH_BEGIN(SVB_GAME);
+		result = VM_Call(gvm, GAME_CLIENT_THINK_BATCH, cl - svs.clients);
+		SV_BENCH_END();
+
+		cl->numThinkCmds = 0;
+		if (result != -1) {
+			return;
+		}
+
+		// an older game, it didn't run any of them
+		sv.gameThinkBatch = qfalse;
+	}
+
+	for (i = 0; i < numCmds; i++) {
+		SV_ClientThink(cl, &cmds[i]);
+	}
 }
 
 /*
@@ -1434,10 +1737,12 @@ each of the backup packets.
 */
 static void SV_UserMove(client_t *cl, msg_t *msg, qboolean delta) {
 	int i, key;
-	int cmdCount;
+	int cmdCount, thinkCount;
+	int lastTime;
 	usercmd_t nullcmd;
 	usercmd_t cmds[MAX_PACKET_USERCMDS];
 	usercmd_t *cmd, *oldcmd;
+	char lastCommand[MAX_STRING_CHARS];
 
 	if (delta) {
 		cl->deltaMessage = cl->messageAcknowledge;
@@ -1462,7 +1767,8 @@ static void SV_UserMove(client_t *cl, msg_t *msg, qboolean delta) {
 	// also use the message acknowledge
 	key ^= cl->messageAcknowledge;
 	// also use the last acknowledged server command in the key
-	key ^= MSG_HashKey(cl->reliableCommands[cl->reliableAcknowledge & (MAX_RELIABLE_COMMANDS - 1)], 32);
+	SV_GetReliableCommand(cl, cl->reliableAcknowledge, lastCommand, sizeof(lastCommand));
+	key ^= MSG_HashKey(lastCommand, 32);
 
 	Com_Memset(&nullcmd, 0, sizeof(nullcmd));
 	oldcmd = &nullcmd;
@@ -1472,8 +1778,11 @@ static void SV_UserMove(client_t *cl, msg_t *msg, qboolean delta) {
 		oldcmd = cmd;
 	}
 
-	// save time for ping calculation
-	cl->frames[cl->messageAcknowledge & PACKET_MASK].messageAcked = svs.time;
+	SV_SnapshotAcked(cl, cl->messageAcknowledge);
+
+	// save time for ping calculation, the real arrival time rather than the
+	// frame's so that the ping isn't rounded to whole server frames
+	cl->frames[cl->messageAcknowledge & PACKET_MASK].messageAcked = NET_PacketTime();
 
 	// TTimo
 	// catch the no-cp-yet situation before SV_ClientEnterWorld
@@ -1508,7 +1817,10 @@ static void SV_UserMove(client_t *cl, msg_t *msg, qboolean delta) {
 
 	// usually, the first couple commands will be duplicates
 	// of ones we have previously received, but the servertimes
-	// in the commands will cause them to be immediately discarded
+	// in the commands will cause them to be immediately discarded,
+	// the rest are packed to the front of cmds
+	thinkCount = 0;
+	lastTime = cl->lastUsercmd.serverTime;
 	for (i = 0; i < cmdCount; i++) {
 		// if this is a cmd from before a map_restart ignore it
 		if (cmds[i].serverTime > cmds[cmdCount - 1].serverTime) {
@@ -1520,11 +1832,14 @@ static void SV_UserMove(client_t *cl, msg_t *msg, qboolean delta) {
 		//}
 		// don't execute if this is an old cmd which is already executed
 		// these old cmds are included when cl_packetdup > 0
-		if (cmds[i].serverTime <= cl->lastUsercmd.serverTime) {
+		if (cmds[i].serverTime <= lastTime) {
 			continue;
 		}
-		SV_ClientThink(cl, &cmds[i]);
+		lastTime = cmds[i].serverTime;
+		cmds[thinkCount++] = cmds[i];
 	}
+
+	SV_ClientThinkBatch(cl, cmds, thinkCount);
 }
 
 #ifdef USE_VOIP
@@ -1547,14 +1862,90 @@ static qboolean SV_ShouldIgnoreVoipSender(const client_t *cl) {
 	return qfalse; // don't ignore.
 }
 
+// packets received this frame, relayed together before the snapshots
+#define MAX_PENDING_VOIP 256
+
+static voipServerPacket_t *pendingVoip[MAX_PENDING_VOIP];
+static int numPendingVoip;
+
+/*
+==================
+SV_ReleaseVoipPacket
+
+Drops a reference to a packet, freeing it with the last one
+==================
+*/
+void SV_ReleaseVoipPacket(voipServerPacket_t *packet) {
+	if (--packet->refs <= 0) {
+		Z_Free(packet);
+	}
+}
+
+/*
+==================
+SV_RelayVoip
+
+Queues the packets received since the last call for the clients that
+should hear them.  Called once a frame, before the snapshots are sent.
+==================
+*/
+void SV_RelayVoip(void) {
+	voipServerPacket_t *packet;
+	client_t *client;
+	int flags;
+	int p, i;
+
+	for (p = 0; p < numPendingVoip; p++) {
+		packet = pendingVoip[p];
+
+		// decide who needs this VoIP packet sent to them...
+		for (i = 0, client = svs.clients; i < sv_maxclients->integer; i++, client++) {
+			if (client->state != CS_ACTIVE)
+				continue; // not in the game yet, don't send to this guy.
+			else if (i == packet->sender)
+				continue; // don't send voice packet back to original author.
+			else if (!client->hasVoip)
+				continue; // no VoIP support, or unsupported protocol
+			else if (client->muteAllVoip)
+				continue; // client is ignoring everyone.
+			else if (client->ignoreVoipFromClient[packet->sender])
+				continue; // client is ignoring this talker.
+
+			flags = packet->flags;
+			if (Com_IsVoipTarget(packet->recips, sizeof(packet->recips), i))
+				flags |= VOIP_DIRECT;
+			else
+				flags &= ~VOIP_DIRECT;
+
+			if (!(flags & (VOIP_SPATIAL | VOIP_DIRECT)))
+				continue; // not addressed to this player.
+
+			// Transmit this packet to the client.
+			if (client->queuedVoipPackets >= ARRAY_LEN(client->voipPacket)) {
+				Com_Printf("Too many VoIP packets queued for client #%d\n", i);
+				continue; // no room for another packet right now.
+			}
+
+			packet->refs++;
+			client->voipPacket[(client->queuedVoipIndex + client->queuedVoipPackets) % ARRAY_LEN(client->voipPacket)] =
+				packet;
+			client->voipPacketFlags[(client->queuedVoipIndex + client->queuedVoipPackets) %
+									ARRAY_LEN(client->voipPacket)] = flags;
+			client->queuedVoipPackets++;
+		}
+
+		SV_ReleaseVoipPacket(packet);
+	}
+
+	numPendingVoip = 0;
+}
+
 static void SV_UserVoip(client_t *cl, msg_t *msg, qboolean ignoreData) {
 	int sender, generation, sequence, frames, packetsize;
 	uint8_t recips[(MAX_CLIENTS + 7) / 8];
 	int flags;
 	byte encoded[sizeof(cl->voipPacket[0]->data)];
-	client_t *client = NULL;
 	voipServerPacket_t *packet = NULL;
-	int i;
 
 	sender = cl - svs.clients;
 	generation = MSG_ReadByte(msg);
@@ -1584,53 +1975,30 @@ static void SV_UserVoip(client_t *cl, msg_t *msg, qboolean ignoreData) {
 	if (ignoreData || SV_ShouldIgnoreVoipSender(cl))
 		return; // Blacklisted, disabled, etc.
 
+	if (*cl->downloadName) // !!! FIXME: possible to DoS?
+		return;			   // no VoIP allowed if downloading, to save bandwidth.
+
 	// !!! FIXME: see if we read past end of msg...
 
 	// !!! FIXME: reject if not opus data.
 	// !!! FIXME: decide if this is bogus data?
 
-	// decide who needs this VoIP packet sent to them...
-	for (i = 0, client = svs.clients; i < sv_maxclients->integer; i++, client++) {
-		if (client->state != CS_ACTIVE)
-			continue; // not in the game yet, don't send to this guy.
-		else if (i == sender)
-			continue; // don't send voice packet back to original author.
-		else if (!client->hasVoip)
-			continue; // no VoIP support, or unsupported protocol
-		else if (client->muteAllVoip)
-			continue; // client is ignoring everyone.
-		else if (client->ignoreVoipFromClient[sender])
-			continue;				// client is ignoring this talker.
-		else if (*cl->downloadName) // !!! FIXME: possible to DoS?
-			continue;				// no VoIP allowed if downloading, to save bandwidth.
-
-		if (Com_IsVoipTarget(recips, sizeof(recips), i))
-			flags |= VOIP_DIRECT;
-		else
-			flags &= ~VOIP_DIRECT;
-
-		if (!(flags & (VOIP_SPATIAL | VOIP_DIRECT)))
-			continue; // not addressed to this player.
-
-		// Transmit this packet to the client.
-		if (client->queuedVoipPackets >= ARRAY_LEN(client->voipPacket)) {
-			Com_Printf("Too many VoIP packets queued for client #%d\n", i);
-			continue; // no room for another packet right now.
-		}
+	if (numPendingVoip == MAX_PENDING_VOIP) {
+		SV_RelayVoip();
+	}
 
-		packet = Z_Malloc(sizeof(*packet));
-		packet->sender = sender;
-		packet->frames = frames;
-		packet->len = packetsize;
-		packet->generation = generation;
-		packet->sequence = sequence;
-		packet->flags = flags;
-		memcpy(packet->data, encoded, packetsize);
+	packet = Z_Malloc(sizeof(*packet));
+	packet->refs = 1; // the pending list's
+	packet->sender = sender;
+	packet->frames = frames;
+	packet->len = packetsize;
+	packet->generation = generation;
+	packet->sequence = sequence;
+	packet->flags = flags;
+	Com_Memcpy(packet->recips, recips, sizeof(recips));
+	memcpy(packet->data, encoded, packetsize);
 
-		client->voipPacket[(client->queuedVoipIndex + client->queuedVoipPackets) % ARRAY_LEN(client->voipPacket)] =
-			packet;
-		client->queuedVoipPackets++;
-	}
+	pendingVoip[numPendingVoip++] = packet;
 }
 #endif
 
@@ -1672,7 +2040,8 @@ void SV_ExecuteClientMessage(client_t *cl, msg_t *msg) {
 	// NOTE: when the client message is fux0red the acknowledgement numbers
 	// can be out of range, this could cause the server to send thousands of server
 	// commands which the server thinks are not yet acknowledged in SV_UpdateServerCommandsToClient
-	if (cl->reliableAcknowledge < cl->reliableSequence - MAX_RELIABLE_COMMANDS) {
+	if (cl->reliableAcknowledge < cl->reliableSequence - SV_ReliableWindow(cl) ||
+		cl->reliableAcknowledge > cl->reliableSequence) {
 		// usually only hackers create messages like this
 		// it is more annoying for them to let them hanging
 #ifndef NDEBUG
@@ -0,0 +1,207 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+// sv_demo.c -- server side demo recording
+
+#include "server.h"
+
+/*
+=============================================================================
+
+The demo records what one client is sent, in the same format a client
+writes, so CL_PlayDemo_f plays it.  The messages are copied as they go to
+the netchan and written by the file system's write thread.  Snapshots are
+sent uncompressed until the client acknowledges one that is in the demo,
+since older ones can't be delta sources on playback.
+
+=============================================================================
+*/
+
+typedef struct {
+	client_t *client;
+	fileHandle_t file;
+	int firstSequence; // the first message after the gamestate
+	int numMessages;
+	int numBytes;
+	char name[MAX_OSPATH];
+} svDemo_t;
+
+static svDemo_t svDemo;
+
+/*
+==================
+SV_DemoWrite
+==================
+*/
+static void SV_DemoWrite(int sequence, const msg_t *msg) {
+	int header[2];
+
+	header[0] = LittleLong(sequence);
+	header[1] = LittleLong(msg->cursize);
+
+	// copied into the write ring, the thread does the disk write
+	FS_WriteQueued(header, sizeof(header), svDemo.file);
+	FS_WriteQueued(msg->data, msg->cursize, svDemo.file);
+
+	svDemo.numMessages++;
+	svDemo.numBytes += sizeof(header) + msg->cursize;
+}
+
+/*
+==================
+SV_DemoWriteGameState
+
+Demos only hold huffman coded messages, so the gamestate is written
+again for clients that were sent a raw one
+==================
+*/
+static void SV_DemoWriteGameState(int sequence) {
+	byte msgBuffer[MAX_MSGLEN];
+	msg_t msg;
+
+	MSG_Init(&msg, msgBuffer, sizeof(msgBuffer));
+	SV_WriteGameState(svDemo.client, &msg);
+	MSG_WriteByte(&msg, svc_EOF);
+
+	SV_DemoWrite(sequence, &msg);
+}
+
+/*
+==================
+SV_DemoRecording
+==================
+*/
+qboolean SV_DemoRecording(void) {
+	return svDemo.file != 0;
+}
+
+/*
+==================
+SV_StartDemo
+==================
+*/
+void SV_StartDemo(client_t *client, const char *name) {
+	if (svDemo.file) {
+		Com_Printf("Already recording to %s.\n", svDemo.name);
+		return;
+	}
+
+	if (client->state != CS_ACTIVE) {
+		Com_Printf("%s" S_COLOR_WHITE " is not in the game.\n", client->name);
+		return;
+	}
+
+	if (client->netchan.remoteAddress.type == NA_BOT) {
+		Com_Printf("Bots aren't sent snapshots, can't record %s" S_COLOR_WHITE ".\n", client->name);
+		return;
+	}
+
+	Q_strncpyz(svDemo.name, name, sizeof(svDemo.name));
+	svDemo.file = FS_FOpenFileWrite(svDemo.name);
+	if (!svDemo.file) {
+		Com_Printf("ERROR: couldn't open %s.\n", svDemo.name);
+		return;
+	}
+
+	Com_Printf("recording %s" S_COLOR_WHITE " to %s.\n", client->name, svDemo.name);
+
+	svDemo.client = client;
+	svDemo.firstSequence = client->netchan.outgoingSequence;
+	svDemo.numMessages = 0;
+	svDemo.numBytes = 0;
+
+	SV_DemoWriteGameState(svDemo.firstSequence - 1);
+}
+
+/*
+==================
+SV_StopDemo
+==================
+*/
+void SV_StopDemo(void) {
+	int len;
+
+	if (!svDemo.file) {
+		return;
+	}
+
+	// finish up
+	len = -1;
+	FS_WriteQueued(&len, 4, svDemo.file);
+	FS_WriteQueued(&len, 4, svDemo.file);
+	FS_FCloseFile(svDemo.file);
+
+	Com_Printf("Stopped demo %s, %i messages, %i bytes.\n", svDemo.name, svDemo.numMessages, svDemo.numBytes);
+
+	svDemo.file = 0;
+	svDemo.client = NULL;
+}
+
+/*
+==================
+SV_DemoClientDropped
+==================
+*/
+void SV_DemoClientDropped(client_t *client) {
+	if (svDemo.file && client == svDemo.client) {
+		SV_StopDemo();
+	}
+}
+
+/*
+==================
+SV_DemoRecordingClient
+==================
+*/
+qboolean SV_DemoRecordingClient(const client_t *client) {
+	return svDemo.file && client == svDemo.client;
+}
+
+/*
+==================
+SV_DemoFullSnapshot
+
+Returns qtrue if the client's delta frame was sent before the demo started
+==================
+*/
+qboolean SV_DemoFullSnapshot(client_t *client) {
+	return svDemo.file && client == svDemo.client && client->deltaMessage < svDemo.firstSequence;
+}
+
+/*
+==================
+SV_DemoMessage
+
+Called with every message that goes to a client, svc_EOF included
+==================
+*/
+void SV_DemoMessage(client_t *client, msg_t *msg) {
+	if (!svDemo.file || client != svDemo.client) {
+		return;
+	}
+
+	if (msg->raw) {
+		SV_DemoWriteGameState(client->netchan.outgoingSequence);
+		return;
+	}
+
+	SV_DemoWrite(client->netchan.outgoingSequence, msg);
+}
@@ -184,6 +184,60 @@ static qboolean SV_inPVSIgnorePortals(const vec3_t p1, const vec3_t p2) {
 	return qtrue;
 }
 
+/*
+=================
+SV_EntityOriginLeaf
+
+The cluster and area of an entity's origin, linked entities have them
+cached from SV_LinkEntity
+=================
+*/
+static void SV_EntityOriginLeaf(int entityNum, int *cluster, int *area) {
+	sharedEntity_t *gEnt;
+	svEntity_t *svEnt;
+	int leafnum;
+
+	if (entityNum < 0 || entityNum >= sv.num_entities) {
+		Com_Error(ERR_DROP, "SV_EntityOriginLeaf: bad entityNum %i", entityNum);
+	}
+
+	gEnt = SV_GentityNum(entityNum);
+	if (gEnt->r.linked) {
+		svEnt = SV_SvEntityForGentity(gEnt);
+		*cluster = svEnt->originCluster;
+		*area = svEnt->originArea;
+		return;
+	}
+
+	leafnum = CM_PointLeafnum(gEnt->r.currentOrigin);
+	*cluster = CM_LeafCluster(leafnum);
+	*area = CM_LeafArea(leafnum);
+}
+
+/*
+=================
+SV_EntitiesInPVS
+
+SV_inPVS for the origins of two entities as of their last
+trap_LinkEntity, without walking the BSP for linked entities
+=================
+*/
+static qboolean SV_EntitiesInPVS(int entityNum1, int entityNum2) {
+	int cluster1, cluster2;
+	int area1, area2;
+	byte *mask;
+
+	SV_EntityOriginLeaf(entityNum1, &cluster1, &area1);
+	SV_EntityOriginLeaf(entityNum2, &cluster2, &area2);
+
+	mask = CM_ClusterPVS(cluster1);
+	if (mask && (!(mask[cluster2 >> 3] & (1 << (cluster2 & 7)))))
+		return qfalse;
+	if (!CM_AreasConnected(area1, area2))
+		return qfalse; // a door blocks sight
+	return qtrue;
+}
+
 /*
 ========================
 SV_AdjustAreaPortalState
@@ -261,6 +315,32 @@ static void SV_GetUsercmd(int clientNum, usercmd_t *cmd) {
 	*cmd = svs.clients[clientNum].lastUsercmd;
 }
 
+/*
+===============
+SV_GetUsercmds
+
+The commands of the GAME_CLIENT_THINK_BATCH being run
+===============
+*/
+static int SV_GetUsercmds(int clientNum, usercmd_t *cmds, int maxCmds) {
+	client_t *cl;
+	int numCmds;
+
+	if (clientNum < 0 || clientNum >= sv_maxclients->integer) {
+		Com_Error(ERR_DROP, "SV_GetUsercmds: bad clientNum:%i", clientNum);
+	}
+	cl = &svs.clients[clientNum];
+
+	numCmds = cl->numThinkCmds;
+	if (numCmds > maxCmds) {
+		numCmds = maxCmds;
+	}
+	if (numCmds > 0) {
+		Com_Memcpy(cmds, cl->thinkCmds, numCmds * sizeof(*cmds));
+	}
+	return numCmds > 0 ? numCmds : 0;
+}
+
 //==============================================
 
 static int FloatAsInt(float f) {
@@ -271,12 +351,80 @@ static int FloatAsInt(float f) {
 
 /*
 ====================
-SV_GameSystemCalls
+SV_GameTrace etc.
 
-The module is making a system call
+Traps the game calls many times per frame, these are dispatched
+straight from the VM without going through SV_GameSystemCalls
 ====================
 */
-static intptr_t SV_GameSystemCalls(intptr_t *args) {
+static intptr_t SV_GameLinkEntity(intptr_t *args) {
+	SV_LinkEntity(VMA(1));
+	return 0;
+}
+
+static intptr_t SV_GameUnlinkEntity(intptr_t *args) {
+	SV_UnlinkEntity(VMA(1));
+	return 0;
+}
+
+static intptr_t SV_GameEntitiesInBox(intptr_t *args) {
+	return SV_AreaEntities(VMA(1), VMA(2), VMA(3), args[4]);
+}
+
+static intptr_t SV_GameTrace(intptr_t *args) {
+	SV_BENCH_BEGIN(SVB_TRACE);
+	SV_Trace(VMA(1), VMA(2), VMA(3), VMA(4), VMA(5), args[6], args[7], /*int capsule*/ qfalse);
+	SV_BENCH_END();
+	return 0;
+}
+
+static intptr_t SV_GameTraceCapsule(intptr_t *args) {
+	SV_BENCH_BEGIN(SVB_TRACE);
+	SV_Trace(VMA(1), VMA(2), VMA(3), VMA(4), VMA(5), args[6], args[7], /*int capsule*/ qtrue);
+	SV_BENCH_END();
+	return 0;
+}
+
+static intptr_t SV_GamePointContents(intptr_t *args) {
+	int contents;
+
+	SV_BENCH_BEGIN(SVB_TRACE);
+	contents = SV_PointContents(VMA(1), args[2]);
+	SV_BENCH_END();
+	return contents;
+}
+
+static intptr_t SV_GameInPVS(intptr_t *args) {
+	return SV_inPVS(VMA(1), VMA(2));
+}
+
+static const vmSyscallDef_t sv_gameSyscalls[] = {
+	{G_LINKENTITY, SV_GameLinkEntity, VMINL_NONE},
+	{G_UNLINKENTITY, SV_GameUnlinkEntity, VMINL_NONE},
+	{G_ENTITIES_IN_BOX, SV_GameEntitiesInBox, VMINL_NONE},
+	{G_TRACE, SV_GameTrace, VMINL_NONE},
+	{G_TRACECAPSULE, SV_GameTraceCapsule, VMINL_NONE},
+	{G_POINT_CONTENTS, SV_GamePointContents, VMINL_NONE},
+	{G_IN_PVS, SV_GameInPVS, VMINL_NONE},
+	{TRAP_SIN, VM_TrapSin, VMINL_SIN},
+	{TRAP_COS, VM_TrapCos, VMINL_COS},
+	{TRAP_SQRT, VM_TrapSqrt, VMINL_SQRT},
+	{TRAP_FLOOR, VM_TrapFloor, VMINL_FLOOR},
+	{TRAP_CEIL, VM_TrapCeil, VMINL_CEIL},
+	{TRAP_MEMSET, VM_TrapMemset, VMINL_MEMSET},
+	{TRAP_MEMCPY, VM_TrapMemcpy, VMINL_MEMCPY},
+	{TRAP_MEMMOVE, VM_TrapMemcpy, VMINL_MEMCPY},
+	{TRAP_STRNCPY, VM_TrapStrncpy, VMINL_STRNCPY},
+	{TRAP_STRLEN, VM_TrapStrlen, VMINL_STRLEN},
+	{-1, NULL, VMINL_NONE}
+};
+
+/*
+====================
+SV_GameDispatch
+====================
+*/
+static intptr_t SV_GameDispatch(intptr_t *args) {
 	switch (args[0]) {
 	case G_PRINT:
 		Com_Printf("%s", (const char *)VMA(1));
@@ -292,6 +440,8 @@ static intptr_t SV_GameSystemCalls(intptr_t *args) {
 	case G_CVAR_UPDATE:
 		Cvar_Update(VMA(1));
 		return 0;
+	case G_CVAR_GENERATION:
+		return Cvar_Generation();
 	case G_CVAR_SET:
 		Cvar_SetSafe((const char *)VMA(1), (const char *)VMA(2));
 		return 0;
@@ -315,7 +465,7 @@ static intptr_t SV_GameSystemCalls(intptr_t *args) {
 		FS_Read(VMA(1), args[2], args[3]);
 		return 0;
 	case G_FS_WRITE:
-		FS_Write(VMA(1), args[2], args[3]);
+		FS_WriteQueued(VMA(1), args[2], args[3]);
 		return 0;
 	case G_FS_FCLOSE_FILE:
 		FS_FCloseFile(args[1]);
@@ -335,30 +485,31 @@ static intptr_t SV_GameSystemCalls(intptr_t *args) {
 		SV_GameSendServerCommand(args[1], VMA(2));
 		return 0;
 	case G_LINKENTITY:
-		SV_LinkEntity(VMA(1));
-		return 0;
+		return SV_GameLinkEntity(args);
 	case G_UNLINKENTITY:
-		SV_UnlinkEntity(VMA(1));
-		return 0;
+		return SV_GameUnlinkEntity(args);
 	case G_ENTITIES_IN_BOX:
-		return SV_AreaEntities(VMA(1), VMA(2), VMA(3), args[4]);
+		return SV_GameEntitiesInBox(args);
 	case G_ENTITY_CONTACT:
 		return SV_EntityContact(VMA(1), VMA(2), VMA(3), /*int capsule*/ qfalse);
 	case G_ENTITY_CONTACTCAPSULE:
 		return SV_EntityContact(VMA(1), VMA(2), VMA(3), /*int capsule*/ qtrue);
 	case G_TRACE:
-		SV_Trace(VMA(1), VMA(2), VMA(3), VMA(4), VMA(5), args[6], args[7], /*int capsule*/ qfalse);
-		return 0;
+		return SV_GameTrace(args);
 	case G_TRACECAPSULE:
-		SV_Trace(VMA(1), VMA(2), VMA(3), VMA(4), VMA(5), args[6], args[7], /*int capsule*/ qtrue);
+		return SV_GameTraceCapsule(args);
+	case G_TRACEBATCH:
+		SV_BENCH_BEGIN(SVB_TRACE);
+		SV_TraceBatch(VMA(1), VMA(2), args[3]);
+		SV_BENCH_END();
 		return 0;
 	case G_POINT_CONTENTS:
-		return SV_PointContents(VMA(1), args[2]);
+		return SV_GamePointContents(args);
 	case G_SET_BRUSH_MODEL:
 		SV_SetBrushModel(VMA(1), VMA(2));
 		return 0;
 	case G_IN_PVS:
-		return SV_inPVS(VMA(1), VMA(2));
+		return SV_GameInPVS(args);
 	case G_IN_PVS_IGNORE_PORTALS:
 		return SV_inPVSIgnorePortals(VMA(1), VMA(2));
 
@@ -392,6 +543,16 @@ static intptr_t SV_GameSystemCalls(intptr_t *args) {
 	case G_GET_USERCMD:
 		SV_GetUsercmd(args[1], VMA(2));
 		return 0;
+	case G_GET_USERCMDS:
+		return SV_GetUsercmds(args[1], VMA(2), args[3]);
+	case G_REWIND_CLIENTS:
+		SV_RewindClients(args[1], args[2]);
+		return 0;
+	case G_RESTORE_CLIENTS:
+		SV_RestoreClients();
+		return 0;
+	case G_ENTITIES_IN_PVS:
+		return SV_EntitiesInPVS(args[1], args[2]);
 	case G_GET_ENTITY_TOKEN: {
 		const char *s;
 
@@ -441,6 +602,8 @@ static intptr_t SV_GameSystemCalls(intptr_t *args) {
 		return botlib_export->BotLibLoadMap(VMA(1));
 	case BOTLIB_UPDATENTITY:
 		return botlib_export->BotLibUpdateEntity(args[1], VMA(2));
+	case BOTLIB_UPDATEENTITIES:
+		return botlib_export->BotLibUpdateEntities(args[1], VMA(2), args[3], VMA(4), VMA(5));
 	case BOTLIB_TEST:
 		return botlib_export->Test(args[1], VMA(2), VMA(3), VMA(4));
 
@@ -791,28 +954,29 @@ static intptr_t SV_GameSystemCalls(intptr_t *args) {
 		return botlib_export->aas.AAS_BestReachableArea(VMA(1), VMA(2), VMA(3), VMA(4));
 
 	case TRAP_MEMSET:
-		Com_Memset(VMA(1), args[2], args[3]);
-		return 0;
+		return VM_TrapMemset(args);
 
 	case TRAP_MEMCPY:
-		Com_Memcpy(VMA(1), VMA(2), args[3]);
-		return 0;
+	case TRAP_MEMMOVE:
+		return VM_TrapMemcpy(args);
 
 	case TRAP_STRNCPY:
-		strncpy(VMA(1), VMA(2), args[3]);
-		return args[1];
+		return VM_TrapStrncpy(args);
+
+	case TRAP_STRLEN:
+		return VM_TrapStrlen(args);
 
 	case TRAP_SIN:
-		return FloatAsInt(sin(VMF(1)));
+		return VM_TrapSin(args);
 
 	case TRAP_COS:
-		return FloatAsInt(cos(VMF(1)));
+		return VM_TrapCos(args);
 
 	case TRAP_ATAN2:
 		return FloatAsInt(atan2(VMF(1), VMF(2)));
 
 	case TRAP_SQRT:
-		return FloatAsInt(sqrt(VMF(1)));
+		return VM_TrapSqrt(args);
 
 	case TRAP_MATRIXMULTIPLY:
 		MatrixMultiply(VMA(1), VMA(2), VMA(3));
@@ -827,10 +991,10 @@ static intptr_t SV_GameSystemCalls(intptr_t *args) {
 		return 0;
 
 	case TRAP_FLOOR:
-		return FloatAsInt(floor(VMF(1)));
+		return VM_TrapFloor(args);
 
 	case TRAP_CEIL:
-		return FloatAsInt(ceil(VMF(1)));
+		return VM_TrapCeil(args);
 
 	default:
 		Com_Error(ERR_DROP, "Bad game system trap: %ld", (long int)args[0]);
@@ -838,6 +1002,26 @@ static intptr_t SV_GameSystemCalls(intptr_t *args) {
 	return 0;
 }
 
+/*
+====================
+SV_GameSystemCalls
+
+The module is making a system call
+====================
+*/
+static intptr_t SV_GameSystemCalls(intptr_t *args) {
+	intptr_t result;
+
+	if (!sv_benchmarking || args[0] < BOTLIB_SETUP || args[0] > BOTLIB_AAS_BESTREACHABLEAREA) {
+		return SV_GameDispatch(args);
+	}
+
+	SV_BENCH_BEGIN(SVB_BOTLIB);
+	result = SV_GameDispatch(args);
+	SV_BENCH_END();
+	return result;
+}
+
 /*
 ===============
 SV_ShutdownGameProgs
@@ -873,11 +1057,15 @@ static void SV_InitGameVM(qboolean restart) {
 	//   now done before GAME_INIT call
 	for (i = 0; i < sv_maxclients->integer; i++) {
 		svs.clients[i].gentity = NULL;
+		svs.clients[i].numThinkCmds = 0;
 	}
 
-	// use the current msec count for a random seed
-	// init for this gamestate
-	VM_Call(gvm, GAME_INIT, sv.time, Com_Milliseconds(), restart);
+	// until it returns -1 for it
+	sv.gameThinkBatch = qtrue;
+
+	// use the current msec count for a random seed, or the fixed one of a
+	// benchmark
+	VM_Call(gvm, GAME_INIT, sv.time, SV_BenchmarkRandomSeed(), restart);
 }
 
 /*
@@ -922,7 +1110,7 @@ void SV_InitGameProgs(void) {
 	}
 
 	// load the dll or bytecode
-	gvm = VM_Create("qagame", SV_GameSystemCalls, Cvar_VariableValue("vm_game"));
+	gvm = VM_Create("qagame", SV_GameSystemCalls, sv_gameSyscalls, Cvar_VariableValue("vm_game"));
 	if (!gvm) {
 		Com_Error(ERR_FATAL, "VM_Create on game failed");
 	}
@@ -92,12 +92,11 @@ void SV_UpdateConfigstrings(client_t *client) {
 ===============
 SV_SetConfigstring
 
+The change goes out with SV_FlushConfigstrings, so only the last of
+several changes to an index in a frame is sent
 ===============
 */
 void SV_SetConfigstring(int index, const char *val) {
-	int i;
-	client_t *client;
-
 	if (index < 0 || index >= MAX_CONFIGSTRINGS) {
 		Com_Error(ERR_DROP, "SV_SetConfigstring: bad index %i", index);
 	}
@@ -118,6 +117,39 @@ void SV_SetConfigstring(int index, const char *val) {
 	// send it to all the clients if we aren't
 	// spawning a new server
 	if (sv.state == SS_GAME || sv.restarting) {
+		svs.configstringUpdates++;
+
+		if (sv.configstringPending[index]) {
+			svs.configstringMerges++;
+			return;
+		}
+		sv.configstringPending[index] = qtrue;
+		sv.pendingConfigstrings[sv.numPendingConfigstrings++] = index;
+	}
+}
+
+/*
+===============
+SV_FlushConfigstrings
+
+Sends the pending configstring changes to all the relevant clients.
+Called at the end of the frame, and before any other server command is
+queued so the clients still see the changes in order with them.
+===============
+*/
+void SV_FlushConfigstrings(void) {
+	int i, n, index;
+	client_t *client;
+
+	if (!sv.numPendingConfigstrings || sv.flushingConfigstrings) {
+		return;
+	}
+	sv.flushingConfigstrings = qtrue;
+
+	// a client dropped during the sends can add more
+	for (n = 0; n < sv.numPendingConfigstrings; n++) {
+		index = sv.pendingConfigstrings[n];
+		sv.configstringPending[index] = qfalse;
 
 		// send the data to all relevant clients
 		for (i = 0, client = svs.clients; i < sv_maxclients->integer; i++, client++) {
@@ -134,6 +166,19 @@ void SV_SetConfigstring(int index, const char *val) {
 			SV_SendConfigstring(client, index);
 		}
 	}
+
+	sv.numPendingConfigstrings = 0;
+	sv.flushingConfigstrings = qfalse;
+}
+
+/*
+===============
+SV_ConfigstringStats_f
+===============
+*/
+void SV_ConfigstringStats_f(void) {
+	Com_Printf("%i configstring changes broadcast, %i merged into a later change of the same frame\n",
+			   svs.configstringUpdates, svs.configstringMerges);
 }
 
 /*
@@ -353,6 +398,7 @@ static void SV_ClearServer(void) {
 		}
 	}
 	Com_Memset(&sv, 0, sizeof(sv));
+	SV_InvalidateQueryCache();
 }
 
 /*
@@ -385,6 +431,10 @@ void SV_SpawnServer(char *server, qboolean killBots) {
 	char systemInfo[16384];
 	const char *p;
 
+	// a server demo holds a single map
+	SV_StopDemo();
+	SV_StopBenchmark();
+
 	// shut down the existing game if it is running
 	SV_ShutdownGameProgs();
 
@@ -621,6 +671,7 @@ void SV_Init(void) {
 	sv_minRate = Cvar_Get("sv_minRate", "0", CVAR_ARCHIVE | CVAR_SERVERINFO);
 	sv_maxRate = Cvar_Get("sv_maxRate", "0", CVAR_ARCHIVE | CVAR_SERVERINFO);
 	sv_dlRate = Cvar_Get("sv_dlRate", "100", CVAR_ARCHIVE | CVAR_SERVERINFO);
+	sv_adaptiveRate = Cvar_Get("sv_adaptiveRate", "1", CVAR_ARCHIVE);
 	sv_minPing = Cvar_Get("sv_minPing", "0", CVAR_ARCHIVE | CVAR_SERVERINFO);
 	sv_maxPing = Cvar_Get("sv_maxPing", "0", CVAR_ARCHIVE | CVAR_SERVERINFO);
 	sv_floodProtect = Cvar_Get("sv_floodProtect", "1", CVAR_ARCHIVE | CVAR_SERVERINFO);
@@ -660,7 +711,31 @@ void SV_Init(void) {
 	sv_killserver = Cvar_Get("sv_killserver", "0", 0);
 	sv_mapChecksum = Cvar_Get("sv_mapChecksum", "", CVAR_ROM);
 	sv_lanForceRate = Cvar_Get("sv_lanForceRate", "1", CVAR_ARCHIVE);
+	sv_snapshotThreads = Cvar_Get("sv_snapshotThreads", "0", CVAR_ARCHIVE);
+	Cvar_CheckRange(sv_snapshotThreads, 0, MAX_JOB_THREADS, qtrue);
+	sv_snapshotEntities = Cvar_Get("sv_snapshotEntities", va("%i", MAX_SNAPSHOT_ENTITIES), CVAR_ARCHIVE);
+	Cvar_CheckRange(sv_snapshotEntities, 64, MAX_SNAPSHOT_ENTITIES, qtrue);
+	sv_pvsCache = Cvar_Get("sv_pvsCache", "1", 0);
+	Cvar_CheckRange(sv_pvsCache, 0, 2, qtrue);
+	sv_deltaCache = Cvar_Get("sv_deltaCache", "1", 0);
+	sv_huffCapture = Cvar_Get("sv_huffCapture", "0", 0);
+	sv_sectorDepth = Cvar_Get("sv_sectorDepth", "0", CVAR_ARCHIVE);
+	Cvar_CheckRange(sv_sectorDepth, 0, 8, qtrue); // MAX_AREA_DEPTH in sv_world.c
+	sv_traceCache = Cvar_Get("sv_traceCache", "0", 0);
+	sv_traceCacheStats = Cvar_Get("sv_traceCacheStats", "", CVAR_ROM);
+	sv_traceThreads = Cvar_Get("sv_traceThreads", "0", CVAR_ARCHIVE);
+	Cvar_CheckRange(sv_traceThreads, 0, MAX_JOB_THREADS, qtrue);
+	sv_netCompression = Cvar_Get("sv_netCompression", "0", CVAR_ARCHIVE);
+	sv_ratelimitBuckets = Cvar_Get("sv_ratelimitBuckets", "16384", CVAR_ARCHIVE);
+	Cvar_CheckRange(sv_ratelimitBuckets, 1024, 262144, qtrue); // MIN_BUCKETS and MAX_BUCKETS in sv_main.c
 	sv_banFile = Cvar_Get("sv_banFile", "serverbans.dat", CVAR_ARCHIVE);
+	sv_benchmarkWarmup = Cvar_Get("sv_benchmarkWarmup", "100", 0);
+	sv_benchmarkReport = Cvar_Get("sv_benchmarkReport", "", 0);
+	sv_metrics = Cvar_Get("sv_metrics", "", CVAR_ARCHIVE);
+	Cvar_SetDescription(sv_metrics, "Address of a StatsD collector to push the server metrics to, empty for none");
+	sv_metricsInterval = Cvar_Get("sv_metricsInterval", "10", CVAR_ARCHIVE);
+	Cvar_CheckRange(sv_metricsInterval, 1, 3600, qtrue);
+	sv_metricsPrefix = Cvar_Get("sv_metricsPrefix", "wop", CVAR_ARCHIVE);
 
 	// initialize bot cvars so they are listed and can be set before loading the botlib
 	SV_BotInitCvars();
@@ -720,10 +795,15 @@ void SV_Shutdown(const char *finalmsg) {
 
 	NET_LeaveMulticast6();
 
+	// a drop in the middle of SV_SendClientMessages can leave packets queued
+	NET_FlushSendBatch();
+
 	if (svs.clients && !com_errorEntered) {
 		SV_FinalMessage(finalmsg);
 	}
 
+	SV_StopDemo();
+
 	SV_RemoveOperatorCommands();
 	SV_MasterShutdown();
 	SV_ShutdownGameProgs();
@@ -735,6 +815,11 @@ void SV_Shutdown(const char *finalmsg) {
 	if (svs.clients) {
 		int index;
 
+#ifdef USE_VOIP
+		// hands the packets still pending to the queues freed below
+		SV_RelayVoip();
+#endif
+
 		for (index = 0; index < sv_maxclients->integer; index++)
 			SV_FreeClient(&svs.clients[index]);
 
@@ -52,13 +52,30 @@ cvar_t *sv_serverid;
 cvar_t *sv_minRate;
 cvar_t *sv_maxRate;
 cvar_t *sv_dlRate;
+cvar_t *sv_adaptiveRate; // lower the rate of clients whose link can't keep up
 cvar_t *sv_minPing;
 cvar_t *sv_maxPing;
 cvar_t *sv_gametype;
 cvar_t *sv_pure;
 cvar_t *sv_floodProtect;
 cvar_t *sv_lanForceRate; // dedicated 1 (LAN) server forces local client rates to 99999 (bug #491)
+cvar_t *sv_snapshotThreads; // threads used to build and encode client snapshots, 0 or 1 for none
+cvar_t *sv_snapshotEntities; // most entities in one snapshot, the least important ones are left out
+cvar_t *sv_pvsCache; // share the visible entities between clients in the same cluster, 2 for an entity-major pass
+cvar_t *sv_deltaCache; // reuse encoded entity deltas between clients acknowledging the same snapshot
+cvar_t *sv_huffCapture; // count the bytes of the snapshot messages for huffstats
+cvar_t *sv_sectorDepth; // depth of the world sector tree from the next map on, 0 to size it from the map bounds
+cvar_t *sv_traceCache; // reuse the results of identical traces until an entity is linked or unlinked
+cvar_t *sv_traceCacheStats; // trace cache hits and misses of the last frame
+cvar_t *sv_traceThreads; // threads that share the traces of a large G_TRACEBATCH, 0 or 1 for none
+cvar_t *sv_netCompression; // accept clients asking for LZ compressed gamestates
+cvar_t *sv_ratelimitBuckets; // size of the per address rate limit table
 cvar_t *sv_banFile;
+cvar_t *sv_benchmarkWarmup; // sv_benchmark frames run before the measured ones
+cvar_t *sv_benchmarkReport; // sv_benchmark writes benchmarks/<report>.csv and .json when set
+cvar_t *sv_metrics;		  // StatsD address the metrics are pushed to, empty for none
+cvar_t *sv_metricsInterval; // seconds between two metrics pushes
+cvar_t *sv_metricsPrefix;	  // prepended to the metric names
 
 serverBan_t serverBans[SERVER_MAXBANS];
 int serverBansCount = 0;
@@ -97,37 +114,133 @@ static char *SV_ExpandNewlines(char *in) {
 	return string;
 }
 
+/*
+======================
+SV_ReliableWindow
+
+Number of unacknowledged server commands the client can buffer
+======================
+*/
+int SV_ReliableWindow(const client_t *cl) {
+	return cl->netchan.compression >= NETCOMP_PACKEDCOMMANDS ? MAX_PACKED_RELIABLE_COMMANDS : MAX_RELIABLE_COMMANDS;
+}
+
+/*
+======================
+SV_ReliableLength
+
+Length of a stored server command, including the terminating zero
+======================
+*/
+static unsigned SV_ReliableLength(const client_t *cl, int sequence) {
+	if (sequence >= cl->reliableSequence) {
+		return cl->reliableTextEnd - cl->reliableStart[sequence & (ARRAY_LEN(cl->reliableStart) - 1)];
+	}
+	return cl->reliableStart[(sequence + 1) & (ARRAY_LEN(cl->reliableStart) - 1)] -
+		   cl->reliableStart[sequence & (ARRAY_LEN(cl->reliableStart) - 1)];
+}
+
+/*
+======================
+SV_GetReliableCommand
+
+Copies out a server command between reliableAcknowledge and reliableSequence.
+Called from the snapshot jobs, so this must not touch any shared state.
+======================
+*/
+void SV_GetReliableCommand(const client_t *cl, int sequence, char *buf, int size) {
+	unsigned start, len, offset, chunk;
+
+	len = SV_ReliableLength(cl, sequence);
+	if (len > (unsigned)size) {
+		len = size;
+	}
+	if (!len) {
+		if (size > 0) {
+			buf[0] = '\0';
+		}
+		return;
+	}
+
+	start = cl->reliableStart[sequence & (ARRAY_LEN(cl->reliableStart) - 1)];
+	offset = start % RELIABLE_TEXT_SIZE;
+	chunk = MIN(len, RELIABLE_TEXT_SIZE - offset);
+	memcpy(buf, cl->reliableText + offset, chunk);
+	memcpy(buf + chunk, cl->reliableText, len - chunk);
+	buf[len - 1] = '\0';
+}
+
+/*
+======================
+SV_CoalesceKey
+
+Commands with the same key supersede each other: configstring updates of
+the same index and every centerprint or team overlay update.  Scores are
+not coalesced as the game sends partial updates.
+======================
+*/
+static int SV_CoalesceKey(const char *cmd) {
+	if (!Q_strncmp(cmd, "cs ", 3)) {
+		return 1 + atoi(cmd + 3);
+	}
+	if (!Q_strncmp(cmd, "cp ", 3)) {
+		return -1;
+	}
+	if (!Q_strncmp(cmd, "tinfo ", 6)) {
+		return -2;
+	}
+	return 0;
+}
+
+/*
+======================
+SV_RemovePendingServerCommand
+
+Removes a command that has not been sent yet and renumbers the ones after it
+======================
+*/
+static void SV_RemovePendingServerCommand(client_t *client, int sequence) {
+	unsigned len, i;
+	int s;
+
+	len = SV_ReliableLength(client, sequence);
+	for (i = client->reliableStart[sequence & (ARRAY_LEN(client->reliableStart) - 1)] + len;
+		 i != client->reliableTextEnd; i++) {
+		client->reliableText[(i - len) % RELIABLE_TEXT_SIZE] = client->reliableText[i % RELIABLE_TEXT_SIZE];
+	}
+	for (s = sequence; s < client->reliableSequence; s++) {
+		client->reliableStart[s & (ARRAY_LEN(client->reliableStart) - 1)] =
+			client->reliableStart[(s + 1) & (ARRAY_LEN(client->reliableStart) - 1)] - len;
+	}
+	client->reliableTextEnd -= len;
+	client->reliableSequence--;
+}
+
 /*
 ======================
 SV_ReplacePendingServerCommands
 
-FIXME: This is ugly
+Drops the unsent command the new one supersedes, if any, so a burst of
+updates of the same thing only costs one slot and is sent once
 ======================
 */
-#if 0 // unused
-static int SV_ReplacePendingServerCommands( client_t *client, const char *cmd ) {
-	int i, index, csnum1, csnum2;
-
-	for ( i = client->reliableSent+1; i <= client->reliableSequence; i++ ) {
-		index = i & ( MAX_RELIABLE_COMMANDS - 1 );
-		//
-		if ( !Q_strncmp(cmd, client->reliableCommands[ index ], strlen("cs")) ) {
-			sscanf(cmd, "cs %i", &csnum1);
-			sscanf(client->reliableCommands[ index ], "cs %i", &csnum2);
-			if ( csnum1 == csnum2 ) {
-				Q_strncpyz( client->reliableCommands[ index ], cmd, sizeof( client->reliableCommands[ index ] ) );
-				/*
-				if ( client->netchan.remoteAddress.type != NA_BOT ) {
-					Com_Printf( "WARNING: client %i removed double pending config string %i: %s\n", client-svs.clients, csnum1, cmd );
-				}
-				*/
-				return qtrue;
-			}
+static void SV_ReplacePendingServerCommands(client_t *client, const char *cmd) {
+	char pending[MAX_STRING_CHARS];
+	int i, key;
+
+	key = SV_CoalesceKey(cmd);
+	if (!key) {
+		return;
+	}
+
+	for (i = MAX(client->reliableSent, client->reliableAcknowledge) + 1; i <= client->reliableSequence; i++) {
+		SV_GetReliableCommand(client, i, pending, sizeof(pending));
+		if (SV_CoalesceKey(pending) == key) {
+			SV_RemovePendingServerCommand(client, i);
+			return;
 		}
 	}
-	return qfalse;
 }
-#endif
 
 /*
 ======================
@@ -138,34 +251,50 @@ not have future snapshot_t executed before it is executed
 ======================
 */
 void SV_AddServerCommand(client_t *client, const char *cmd) {
-	int index, i;
-
-	// this is very ugly but it's also a waste to for instance send multiple config string updates
-	// for the same config string index in one snapshot
-	//	if ( SV_ReplacePendingServerCommands( client, cmd ) ) {
-	//		return;
-	//	}
+	char pending[MAX_STRING_CHARS];
+	unsigned len, offset, chunk;
+	int i;
 
 	// do not send commands until the gamestate has been sent
 	if (client->state < CS_PRIMED)
 		return;
 
-	client->reliableSequence++;
+	// the configstring changes made before the command go out before it
+	SV_FlushConfigstrings();
+
+	// it's a waste to for instance send multiple config string updates
+	// for the same config string index in one snapshot
+	SV_ReplacePendingServerCommands(client, cmd);
+
+	len = MIN(strlen(cmd), MAX_STRING_CHARS - 1) + 1;
+
 	// if we would be losing an old command that hasn't been acknowledged,
 	// we must drop the connection
-	// we check == instead of >= so a broadcast print added by SV_DropClient()
-	// doesn't cause a recursive drop client
-	if (client->reliableSequence - client->reliableAcknowledge == MAX_RELIABLE_COMMANDS + 1) {
+	if (client->reliableSequence + 1 - client->reliableAcknowledge > SV_ReliableWindow(client) ||
+		client->reliableTextEnd + len -
+				client->reliableStart[client->reliableAcknowledge & (ARRAY_LEN(client->reliableStart) - 1)] >
+			RELIABLE_TEXT_SIZE) {
 		Com_Printf("===== pending server commands =====\n");
 		for (i = client->reliableAcknowledge + 1; i <= client->reliableSequence; i++) {
-			Com_Printf("cmd %5d: %s\n", i, client->reliableCommands[i & (MAX_RELIABLE_COMMANDS - 1)]);
+			SV_GetReliableCommand(client, i, pending, sizeof(pending));
+			Com_Printf("cmd %5d: %s\n", i, pending);
 		}
 		Com_Printf("cmd %5d: %s\n", i, cmd);
+		// give up on the pending commands so the broadcast print and the
+		// disconnect added by SV_DropClient() fit without a recursive drop
+		client->reliableAcknowledge = client->reliableSequence;
 		SV_DropClient(client, "Server command overflow");
 		return;
 	}
-	index = client->reliableSequence & (MAX_RELIABLE_COMMANDS - 1);
-	Q_strncpyz(client->reliableCommands[index], cmd, sizeof(client->reliableCommands[index]));
+
+	client->reliableSequence++;
+	client->reliableStart[client->reliableSequence & (ARRAY_LEN(client->reliableStart) - 1)] = client->reliableTextEnd;
+	offset = client->reliableTextEnd % RELIABLE_TEXT_SIZE;
+	chunk = MIN(len, RELIABLE_TEXT_SIZE - offset);
+	memcpy(client->reliableText + offset, cmd, chunk);
+	memcpy(client->reliableText, cmd + chunk, len - chunk);
+	client->reliableText[(offset + len - 1) % RELIABLE_TEXT_SIZE] = '\0';
+	client->reliableTextEnd += len;
 }
 
 /*
@@ -340,132 +469,206 @@ CONNECTIONLESS COMMANDS
 */
 
 // This is deliberately quite large to make it more of an effort to DoS
-#define MAX_BUCKETS 16384
-#define MAX_HASHES 1024
-
-static leakyBucket_t buckets[MAX_BUCKETS];
-static leakyBucket_t *bucketHashes[MAX_HASHES];
+#define MIN_BUCKETS 1024
+#define MAX_BUCKETS 262144
+
+// an address lives in one of the slots following its hash.  Every lookup
+// searches all of them, so the cost is the same however many addresses
+// a flood comes from.
+#define BUCKET_PROBES 16
+
+typedef struct {
+	leakyBucket_t *buckets;
+	int size; // power of two
+	unsigned seed;
+	int hand; // CLOCK hand, as an offset into the probe window
+
+	// for sv_ratelimitStats
+	int lookups;
+	int hits;
+	int inserts;
+	int reclaims;  // expired buckets reused
+	int evictions; // live buckets pushed out
+} bucketTable_t;
+
+static bucketTable_t bucketTable;
 leakyBucket_t outboundLeakyBucket;
 
+/*
+================
+SVC_AllocBuckets
+
+(Re)allocates the bucket table when sv_ratelimitBuckets changed
+================
+*/
+static void SVC_AllocBuckets(void) {
+	int size;
+
+	if (bucketTable.buckets && !sv_ratelimitBuckets->modified) {
+		return;
+	}
+	sv_ratelimitBuckets->modified = qfalse;
+
+	for (size = MIN_BUCKETS; size < sv_ratelimitBuckets->integer && size < MAX_BUCKETS; size <<= 1) {
+	}
+	if (bucketTable.buckets && bucketTable.size == size) {
+		return;
+	}
+
+	if (bucketTable.buckets) {
+		Z_Free(bucketTable.buckets);
+	}
+	Com_Memset(&bucketTable, 0, sizeof(bucketTable));
+	bucketTable.buckets = Z_Malloc(size * sizeof(leakyBucket_t));
+	bucketTable.size = size;
+
+	// keep the slots of an address unpredictable
+	Com_RandomBytes((byte *)&bucketTable.seed, sizeof(bucketTable.seed));
+}
+
 /*
 ================
 SVC_HashForAddress
 ================
 */
-static long SVC_HashForAddress(netadr_t address) {
-	byte *ip = NULL;
-	size_t size = 0;
-	int i;
-	long hash = 0;
+static unsigned SVC_HashForAddress(netadr_t address) {
+	const byte *ip;
+	int size, i;
+	unsigned hash;
 
-	switch (address.type) {
-	case NA_IP:
+	if (address.type == NA_IP) {
 		ip = address.ip;
 		size = 4;
-		break;
-	case NA_IP6:
+	} else {
 		ip = address.ip6;
 		size = 16;
-		break;
-	default:
-		break;
 	}
 
+	hash = 0x811c9dc5 ^ bucketTable.seed;
 	for (i = 0; i < size; i++) {
-		hash += (long)(ip[i]) * (i + 119);
+		hash = (hash ^ ip[i]) * 0x01000193;
 	}
 
-	hash = (hash ^ (hash >> 10) ^ (hash >> 20));
-	hash &= (MAX_HASHES - 1);
+	return hash ^ (hash >> 16);
+}
 
-	return hash;
+/*
+================
+SVC_BucketMatches
+================
+*/
+static qboolean SVC_BucketMatches(const leakyBucket_t *bucket, netadr_t address) {
+	if (bucket->type != address.type) {
+		return qfalse;
+	}
+	if (address.type == NA_IP) {
+		return memcmp(bucket->ipv._4, address.ip, 4) == 0;
+	}
+	return memcmp(bucket->ipv._6, address.ip6, 16) == 0;
 }
 
 /*
 ================
 SVC_BucketForAddress
 
-Find or allocate a bucket for an address
+Find or allocate a bucket for an IP or IPv6 address
 ================
 */
 static leakyBucket_t *SVC_BucketForAddress(netadr_t address, int burst, int period) {
-	leakyBucket_t *bucket = NULL;
-	int i;
-	long hash = SVC_HashForAddress(address);
+	leakyBucket_t *bucket, *free;
+	unsigned hash;
+	int i, mask, interval;
 	int now = Sys_Milliseconds();
 
-	for (bucket = bucketHashes[hash]; bucket; bucket = bucket->next) {
-		switch (bucket->type) {
-		case NA_IP:
-			if (memcmp(bucket->ipv._4, address.ip, 4) == 0) {
-				return bucket;
-			}
-			break;
+	SVC_AllocBuckets();
+	mask = bucketTable.size - 1;
+	hash = SVC_HashForAddress(address);
+	bucketTable.lookups++;
 
-		case NA_IP6:
-			if (memcmp(bucket->ipv._6, address.ip6, 16) == 0) {
-				return bucket;
-			}
-			break;
+	// freed slots leave holes, so the whole window is searched
+	free = NULL;
+	for (i = 0; i < BUCKET_PROBES; i++) {
+		bucket = &bucketTable.buckets[(hash + i) & mask];
 
-		default:
-			break;
+		if (bucket->type == NA_BAD) {
+			if (!free) {
+				free = bucket;
+			}
+			continue;
 		}
-	}
 
-	for (i = 0; i < MAX_BUCKETS; i++) {
-		int interval;
-
-		bucket = &buckets[i];
-		interval = now - bucket->lastTime;
+		if (SVC_BucketMatches(bucket, address)) {
+			bucket->referenced = qtrue;
+			bucketTable.hits++;
+			return bucket;
+		}
 
 		// Reclaim expired buckets
-		if (bucket->lastTime > 0 && (interval > (burst * period) || interval < 0)) {
-			if (bucket->prev != NULL) {
-				bucket->prev->next = bucket->next;
-			} else {
-				bucketHashes[bucket->hash] = bucket->next;
-			}
-
-			if (bucket->next != NULL) {
-				bucket->next->prev = bucket->prev;
-			}
-
-			Com_Memset(bucket, 0, sizeof(leakyBucket_t));
+		interval = now - bucket->lastTime;
+		if (!free && (interval > (burst * period) || interval < 0)) {
+			free = bucket;
 		}
+	}
 
-		if (bucket->type == NA_BAD) {
-			bucket->type = address.type;
-			switch (address.type) {
-			case NA_IP:
-				Com_Memcpy(bucket->ipv._4, address.ip, 4);
-				break;
-			case NA_IP6:
-				Com_Memcpy(bucket->ipv._6, address.ip6, 16);
-				break;
-			default:
+	if (free) {
+		if (free->type != NA_BAD) {
+			bucketTable.reclaims++;
+		}
+	} else {
+		// every slot is in use, walk the clock over the window and evict the
+		// first bucket that was not seen again since the last pass.  New
+		// buckets start unreferenced, so the addresses of a spoofed flood
+		// go before the ones that keep coming back.
+		for (i = 0; i < 2 * BUCKET_PROBES; i++) {
+			free = &bucketTable.buckets[(hash + (bucketTable.hand + i) % BUCKET_PROBES) & mask];
+			if (!free->referenced) {
 				break;
 			}
+			free->referenced = qfalse;
+		}
+		bucketTable.hand = (bucketTable.hand + i + 1) % BUCKET_PROBES;
+		bucketTable.evictions++;
+	}
 
-			bucket->lastTime = now;
-			bucket->burst = 0;
-			bucket->hash = hash;
+	Com_Memset(free, 0, sizeof(leakyBucket_t));
+	free->type = address.type;
+	if (address.type == NA_IP) {
+		Com_Memcpy(free->ipv._4, address.ip, 4);
+	} else {
+		Com_Memcpy(free->ipv._6, address.ip6, 16);
+	}
+	free->lastTime = now;
+	bucketTable.inserts++;
 
-			// Add to the head of the relevant hash chain
-			bucket->next = bucketHashes[hash];
-			if (bucketHashes[hash] != NULL) {
-				bucketHashes[hash]->prev = bucket;
-			}
+	return free;
+}
 
-			bucket->prev = NULL;
-			bucketHashes[hash] = bucket;
+/*
+================
+SVC_RateLimitStats_f
 
-			return bucket;
+Dumps the state of the per address rate limit table
+================
+*/
+void SVC_RateLimitStats_f(void) {
+	int i, used;
+
+	if (!bucketTable.buckets) {
+		Com_Printf("No addresses have been rate limited yet.\n");
+		return;
+	}
+
+	used = 0;
+	for (i = 0; i < bucketTable.size; i++) {
+		if (bucketTable.buckets[i].type != NA_BAD) {
+			used++;
 		}
 	}
 
-	// Couldn't allocate a bucket for this address
-	return NULL;
+	Com_Printf("%i of %i buckets in use, %i probes per address\n", used, bucketTable.size, BUCKET_PROBES);
+	Com_Printf("%i lookups, %i hits, %i inserts\n", bucketTable.lookups, bucketTable.hits, bucketTable.inserts);
+	Com_Printf("%i expired buckets reclaimed, %i live buckets evicted\n", bucketTable.reclaims,
+			   bucketTable.evictions);
 }
 
 /*
@@ -495,6 +698,7 @@ qboolean SVC_RateLimit(leakyBucket_t *bucket, int burst, int period) {
 		}
 	}
 
+	svMetrics.rateLimited++;
 	return qtrue;
 }
 
@@ -506,60 +710,150 @@ Rate limit for a particular address
 ================
 */
 qboolean SVC_RateLimitAddress(netadr_t from, int burst, int period) {
-	leakyBucket_t *bucket = SVC_BucketForAddress(from, burst, period);
+	// loopback and bot addresses are not limited
+	if (from.type != NA_IP && from.type != NA_IP6) {
+		return qfalse;
+	}
+
+	return SVC_RateLimit(SVC_BucketForAddress(from, burst, period), burst, period);
+}
+
+/*
+==============================================================================
+
+QUERY RESPONSE CACHE
+
+getstatus and getinfo answers are built once and sent from the cache until
+a serverinfo or systeminfo cvar, a client or the map changes.  Only the
+challenge echo differs between requests.
+
+==============================================================================
+*/
+
+// A maximum challenge length of 128 should be more than plenty.
+#define MAX_QUERY_CHALLENGE 128
+
+typedef struct {
+	qboolean valid;
+	int infoLength; // of the infostring the challenge goes into
+	int split;		// the challenge is inserted here
+	int length;
+	char data[MAX_MSGLEN];
+} queryResponse_t;
+
+typedef struct {
+	qboolean connected;
+	int score;
+	int ping;
+} queryClient_t;
+
+typedef struct {
+	queryResponse_t status;
+	queryResponse_t info;
+
+	// client values as of the last frame
+	queryClient_t clients[MAX_CLIENTS];
+} queryCache_t;
 
-	return SVC_RateLimit(bucket, burst, period);
+static queryCache_t queryCache;
+
+/*
+================
+SV_InvalidateQueryCache
+================
+*/
+void SV_InvalidateQueryCache(void) {
+	queryCache.status.valid = qfalse;
+	queryCache.info.valid = qfalse;
 }
 
 /*
 ================
-SVC_Status
+SV_CheckQueryCache
 
-Responds with all the info that qplug or qspy can see about the server
-and all connected players.  Used for getting detailed information after
-the simple info query.
+Called every frame to notice client changes
 ================
 */
-static void SVC_Status(netadr_t from) {
-	char player[1024];
-	char status[MAX_MSGLEN];
-	int i;
+static void SV_CheckQueryCache(void) {
 	client_t *cl;
-	playerState_t *ps;
-	int statusLength;
-	int playerLength;
-	char infostring[MAX_INFO_STRING];
+	queryClient_t *qc;
+	qboolean connected;
+	int i, score;
 
-	// ignore if we are in single player
-	if (Cvar_VariableValue("g_gametype") == GT_SINGLE_PLAYER || Cvar_VariableValue("ui_singlePlayerActive")) {
-		return;
+	for (i = 0; i < sv_maxclients->integer; i++) {
+		cl = &svs.clients[i];
+		qc = &queryCache.clients[i];
+
+		connected = cl->state >= CS_CONNECTED;
+		if (connected != qc->connected) {
+			qc->connected = connected;
+			SV_InvalidateQueryCache();
+		}
+		if (!connected) {
+			continue;
+		}
+
+		score = SV_GameClientNum(i)->persistant[PERS_SCORE];
+		if (score != qc->score || cl->ping != qc->ping) {
+			qc->score = score;
+			qc->ping = cl->ping;
+			queryCache.status.valid = qfalse;
+		}
 	}
+}
 
-	// Prevent using getstatus as an amplifier
-	if (SVC_RateLimitAddress(from, 10, 1000)) {
-		Com_DPrintf("SVC_Status: rate limit from %s exceeded, dropping request\n", NET_AdrToString(from));
-		return;
+/*
+================
+SVC_SendQueryResponse
+
+Sends a cached response with the challenge of this request echoed back
+================
+*/
+static void SVC_SendQueryResponse(netadr_t from, const queryResponse_t *response, const char *challenge) {
+	char packet[MAX_MSGLEN + MAX_QUERY_CHALLENGE + 16];
+	int length;
+
+	Com_Memcpy(packet, response->data, response->split);
+	length = response->split;
+
+	// the challenge goes in as Info_SetValueForKey would put it
+	if (*challenge && !strpbrk(challenge, "\\;\"") &&
+		response->infoLength + 11 + strlen(challenge) < MAX_INFO_STRING) {
+		length += Com_sprintf(packet + length, sizeof(packet) - length, "\\challenge\\%s", challenge);
 	}
 
-	// Allow getstatus to be DoSed relatively easily, but prevent
-	// excess outbound bandwidth usage when being flooded inbound
-	if (SVC_RateLimit(&outboundLeakyBucket, 10, 100)) {
-		Com_DPrintf("SVC_Status: rate limit exceeded, dropping request\n");
-		return;
+	Com_Memcpy(packet + length, response->data + response->split, response->length - response->split);
+	length += response->length - response->split;
+
+	// NET_OutOfBandPrint limits
+	if (length > MAX_MSGLEN - 1) {
+		length = MAX_MSGLEN - 1;
 	}
 
-	// A maximum challenge length of 128 should be more than plenty.
-	if (strlen(Cmd_Argv(1)) > 128)
-		return;
+	NET_SendPacket(NS_SERVER, length, packet, from);
+}
 
-	strcpy(infostring, Cvar_InfoString(CVAR_SERVERINFO));
+/*
+================
+SVC_BuildStatusResponse
+================
+*/
+static void SVC_BuildStatusResponse(void) {
+	queryResponse_t *response = &queryCache.status;
+	char player[1024];
+	char infostring[MAX_INFO_STRING];
+	int i, playerLength;
+	client_t *cl;
+	playerState_t *ps;
 
-	// echo back the parameter to status. so master servers can use it as a challenge
-	// to prevent timed spoofed reply packets that add ghost servers
-	Info_SetValueForKey(infostring, "challenge", Cmd_Argv(1));
+	strcpy(infostring, Cvar_InfoString(CVAR_SERVERINFO));
+	Info_RemoveKey(infostring, "challenge");
 
-	status[0] = 0;
-	statusLength = 0;
+	// the challenge key is prepended to the serverinfo
+	response->split = Com_sprintf(response->data, sizeof(response->data), "\xff\xff\xff\xffstatusResponse\n");
+	response->infoLength = strlen(infostring);
+	response->length = response->split + Com_sprintf(response->data + response->split,
+													  sizeof(response->data) - response->split, "%s\n", infostring);
 
 	for (i = 0; i < sv_maxclients->integer; i++) {
 		cl = &svs.clients[i];
@@ -567,57 +861,28 @@ static void SVC_Status(netadr_t from) {
 			ps = SV_GameClientNum(i);
 			Com_sprintf(player, sizeof(player), "%i %i \"%s\"\n", ps->persistant[PERS_SCORE], cl->ping, cl->name);
 			playerLength = strlen(player);
-			if (statusLength + playerLength >= sizeof(status)) {
+			if (response->length + playerLength >= sizeof(response->data)) {
 				break; // can't hold any more
 			}
-			strcpy(status + statusLength, player);
-			statusLength += playerLength;
+			strcpy(response->data + response->length, player);
+			response->length += playerLength;
 		}
 	}
 
-	NET_OutOfBandPrint(NS_SERVER, from, "statusResponse\n%s\n%s", infostring, status);
+	response->valid = qtrue;
 }
 
 /*
 ================
-SVC_Info
-
-Responds with a short info message that should be enough to determine
-if a user is interested in a server to do a full status
+SVC_BuildInfoResponse
 ================
 */
-void SVC_Info(netadr_t from) {
+static void SVC_BuildInfoResponse(void) {
+	queryResponse_t *response = &queryCache.info;
 	int i, count, humans;
 	const char *gamedir;
 	char infostring[MAX_INFO_STRING];
 
-	// ignore if we are in single player
-	if (Cvar_VariableValue("g_gametype") == GT_SINGLE_PLAYER || Cvar_VariableValue("ui_singlePlayerActive")) {
-		return;
-	}
-
-	// Prevent using getinfo as an amplifier
-	if (SVC_RateLimitAddress(from, 10, 1000)) {
-		Com_DPrintf("SVC_Info: rate limit from %s exceeded, dropping request\n", NET_AdrToString(from));
-		return;
-	}
-
-	// Allow getinfo to be DoSed relatively easily, but prevent
-	// excess outbound bandwidth usage when being flooded inbound
-	if (SVC_RateLimit(&outboundLeakyBucket, 10, 100)) {
-		Com_DPrintf("SVC_Info: rate limit exceeded, dropping request\n");
-		return;
-	}
-
-	/*
-	 * Check whether Cmd_Argv(1) has a sane length. This was not done in the original Quake3 version which led
-	 * to the Infostring bug discovered by Luigi Auriemma. See http://aluigi.altervista.org/ for the advisory.
-	 */
-
-	// A maximum challenge length of 128 should be more than plenty.
-	if (strlen(Cmd_Argv(1)) > 128)
-		return;
-
 	// don't count privateclients
 	count = humans = 0;
 	for (i = 0; i < sv_maxclients->integer; i++) {
@@ -634,10 +899,6 @@ void SVC_Info(netadr_t from) {
 
 	infostring[0] = 0;
 
-	// echo back the parameter to status. so servers can use it as a challenge
-	// to prevent timed spoofed reply packets that add ghost servers
-	Info_SetValueForKey(infostring, "challenge", Cmd_Argv(1));
-
 	Info_SetValueForKey(infostring, "gamename", com_gamename->string);
 
 	Info_SetValueForKey(infostring, "protocol", va("%i", com_protocol->integer));
@@ -668,7 +929,96 @@ void SVC_Info(netadr_t from) {
 		Info_SetValueForKey(infostring, "game", gamedir);
 	}
 
-	NET_OutOfBandPrint(NS_SERVER, from, "infoResponse\n%s", infostring);
+	// the challenge was the first key set, so it ends up last
+	response->length =
+		Com_sprintf(response->data, sizeof(response->data), "\xff\xff\xff\xffinfoResponse\n%s", infostring);
+	response->split = response->length;
+	response->infoLength = 0;
+	response->valid = qtrue;
+}
+
+/*
+================
+SVC_Status
+
+Responds with all the info that qplug or qspy can see about the server
+and all connected players.  Used for getting detailed information after
+the simple info query.
+================
+*/
+static void SVC_Status(netadr_t from) {
+	// ignore if we are in single player
+	if (Cvar_VariableValue("g_gametype") == GT_SINGLE_PLAYER || Cvar_VariableValue("ui_singlePlayerActive")) {
+		return;
+	}
+
+	// Prevent using getstatus as an amplifier
+	if (SVC_RateLimitAddress(from, 10, 1000)) {
+		Com_DPrintf("SVC_Status: rate limit from %s exceeded, dropping request\n", NET_AdrToString(from));
+		return;
+	}
+
+	// Allow getstatus to be DoSed relatively easily, but prevent
+	// excess outbound bandwidth usage when being flooded inbound
+	if (SVC_RateLimit(&outboundLeakyBucket, 10, 100)) {
+		Com_DPrintf("SVC_Status: rate limit exceeded, dropping request\n");
+		return;
+	}
+
+	if (strlen(Cmd_Argv(1)) > MAX_QUERY_CHALLENGE)
+		return;
+
+	// cvars may have changed since the last frame
+	if (!queryCache.status.valid || (cvar_modifiedFlags & CVAR_SERVERINFO)) {
+		SVC_BuildStatusResponse();
+	}
+
+	// echo back the parameter to status. so master servers can use it as a challenge
+	// to prevent timed spoofed reply packets that add ghost servers
+	SVC_SendQueryResponse(from, &queryCache.status, Cmd_Argv(1));
+}
+
+/*
+================
+SVC_Info
+
+Responds with a short info message that should be enough to determine
+if a user is interested in a server to do a full status
+================
+*/
+void SVC_Info(netadr_t from) {
+	// ignore if we are in single player
+	if (Cvar_VariableValue("g_gametype") == GT_SINGLE_PLAYER || Cvar_VariableValue("ui_singlePlayerActive")) {
+		return;
+	}
+
+	// Prevent using getinfo as an amplifier
+	if (SVC_RateLimitAddress(from, 10, 1000)) {
+		Com_DPrintf("SVC_Info: rate limit from %s exceeded, dropping request\n", NET_AdrToString(from));
+		return;
+	}
+
+	// Allow getinfo to be DoSed relatively easily, but prevent
+	// excess outbound bandwidth usage when being flooded inbound
+	if (SVC_RateLimit(&outboundLeakyBucket, 10, 100)) {
+		Com_DPrintf("SVC_Info: rate limit exceeded, dropping request\n");
+		return;
+	}
+
+	/*
+	 * Check whether Cmd_Argv(1) has a sane length. This was not done in the original Quake3 version which led
+	 * to the Infostring bug discovered by Luigi Auriemma. See http://aluigi.altervista.org/ for the advisory.
+	 */
+	if (strlen(Cmd_Argv(1)) > MAX_QUERY_CHALLENGE)
+		return;
+
+	if (!queryCache.info.valid || (cvar_modifiedFlags & (CVAR_SERVERINFO | CVAR_SYSTEMINFO))) {
+		SVC_BuildInfoResponse();
+	}
+
+	// echo back the parameter to status. so servers can use it as a challenge
+	// to prevent timed spoofed reply packets that add ghost servers
+	SVC_SendQueryResponse(from, &queryCache.info, Cmd_Argv(1));
 }
 
 /*
@@ -994,6 +1344,26 @@ static qboolean SV_CheckPaused(void) {
 	return qtrue;
 }
 
+/*
+==================
+SV_GameFrameMsec
+
+Length of the next game frame. When 1000 isn't a multiple of sv_fps the
+frames alternate between the two nearest whole milliseconds, carrying the
+remainder in sv.frameRemainder, so the game still runs sv_fps frames a
+second
+==================
+*/
+static int SV_GameFrameMsec(void) {
+	int fps;
+
+	fps = sv_fps->integer;
+	if (fps < 1)
+		fps = 10;
+
+	return (1000 + sv.frameRemainder) / fps;
+}
+
 /*
 ==================
 SV_FrameMsec
@@ -1004,7 +1374,7 @@ int SV_FrameMsec(void) {
 	if (sv_fps) {
 		int frameMsec;
 
-		frameMsec = 1000.0f / sv_fps->value;
+		frameMsec = SV_GameFrameMsec();
 
 		if (frameMsec < sv.timeResidual)
 			return 0;
@@ -1025,6 +1395,8 @@ happen before SV_Frame is called
 void SV_Frame(int msec) {
 	int frameMsec;
 	int startTime;
+	int64_t frameStart, start;
+	int frames;
 
 	// the menu kills the server with this cvar
 	if (sv_killserver->integer) {
@@ -1053,7 +1425,7 @@ void SV_Frame(int msec) {
 		Cvar_Set("sv_fps", "10");
 	}
 
-	frameMsec = 1000 / sv_fps->integer * com_timescale->value;
+	frameMsec = SV_GameFrameMsec() * com_timescale->value;
 	// don't let it scale below 1ms
 	if (frameMsec < 1) {
 		Cvar_Set("timescale", va("%f", sv_fps->integer / 1000.0f));
@@ -1062,8 +1434,12 @@ void SV_Frame(int msec) {
 
 	sv.timeResidual += msec;
 
-	if (!com_dedicated->integer)
+	frameStart = Sys_Microseconds();
+
+	if (!com_dedicated->integer) {
 		SV_BotFrame(sv.time + sv.timeResidual);
+		svMetrics.botUsec += Sys_Microseconds() - frameStart;
+	}
 
 	// if time is about to hit the 32nd bit, kick all clients
 	// and clear sv.time, rather
@@ -1091,10 +1467,12 @@ void SV_Frame(int msec) {
 	if (cvar_modifiedFlags & CVAR_SERVERINFO) {
 		SV_SetConfigstring(CS_SERVERINFO, Cvar_InfoString(CVAR_SERVERINFO));
 		cvar_modifiedFlags &= ~CVAR_SERVERINFO;
+		SV_InvalidateQueryCache();
 	}
 	if (cvar_modifiedFlags & CVAR_SYSTEMINFO) {
 		SV_SetConfigstring(CS_SYSTEMINFO, Cvar_InfoString_Big(CVAR_SYSTEMINFO));
 		cvar_modifiedFlags &= ~CVAR_SYSTEMINFO;
+		SV_InvalidateQueryCache();
 	}
 
 	if (com_speeds->integer) {
@@ -1106,50 +1484,76 @@ void SV_Frame(int msec) {
 	// update ping based on the all received frames
 	SV_CalcPings();
 
-	if (com_dedicated->integer)
+	if (com_dedicated->integer) {
+		start = Sys_Microseconds();
 		SV_BotFrame(sv.time);
+		svMetrics.botUsec += Sys_Microseconds() - start;
+	}
 
 	// run the game simulation in chunks
+	frames = 0;
 	while (sv.timeResidual >= frameMsec) {
 		sv.timeResidual -= frameMsec;
 		svs.time += frameMsec;
 		sv.time += frameMsec;
+		sv.frameRemainder = (1000 + sv.frameRemainder) % sv_fps->integer;
+
+		SV_TraceCacheFrame();
 
 		// let everything in the world think and move
+		start = Sys_Microseconds();
+		SV_BENCH_BEGIN(SVB_GAME);
 		VM_Call(gvm, GAME_RUN_FRAME, sv.time);
+		SV_BENCH_END();
+		svMetrics.gameUsec += Sys_Microseconds() - start;
+		frames++;
+
+		SV_RecordClientPositions();
+
+		frameMsec = SV_GameFrameMsec() * com_timescale->value;
+		if (frameMsec < 1)
+			frameMsec = 1;
 	}
 
 	if (com_speeds->integer) {
 		time_game = Sys_Milliseconds() - startTime;
 	}
 
+	// scores and pings are in for this frame
+	SV_CheckQueryCache();
+
 	// check timeouts
 	SV_CheckTimeouts();
 
+	// the configstring changes of the frame
+	SV_FlushConfigstrings();
+
 	// send messages back to the clients
+	PROFILE_BEGIN("SV_SendClientMessages");
+	SV_BENCH_BEGIN(SVB_SNAPSHOT);
 	SV_SendClientMessages();
+	SV_BENCH_END();
+	PROFILE_END();
 
 	// send a heartbeat to the master if needed
 	SV_MasterHeartbeat(HEARTBEAT_FOR_MASTER);
+
+	if (frames) {
+		SV_MetricsFrame((int)(Sys_Microseconds() - frameStart));
+	}
+	SV_MetricsCheck();
 }
 
 /*
 ====================
-SV_RateMsec
+SV_ClientRate
 
-Return the number of msec until another message can be sent to
-a client based on its rate settings
+The rate the client asked for, within sv_minRate and sv_maxRate
 ====================
 */
+static int SV_ClientRate(client_t *client) {
+	int rate;
 
-#define UDPIP_HEADER_SIZE 28
-#define UDPIP6_HEADER_SIZE 48
-
-int SV_RateMsec(client_t *client) {
-	int rate, rateMsec;
-	int messageSize;
-
-	messageSize = client->netchan.lastSentSize;
 	rate = client->rate;
 
 	if (sv_maxRate->integer) {
@@ -1166,6 +1570,32 @@ int SV_RateMsec(client_t *client) {
 			rate = sv_minRate->integer;
 	}
 
+	return rate;
+}
+
+/*
+====================
+SV_RateMsec
+
+Return the number of msec until another message can be sent to
+a client based on its rate settings
+====================
+*/
+
+#define UDPIP_HEADER_SIZE 28
+#define UDPIP6_HEADER_SIZE 48
+
+int SV_RateMsec(client_t *client) {
+	int rate, rateMsec;
+	int messageSize;
+
+	messageSize = client->netchan.lastSentSize;
+	rate = SV_ClientRate(client);
+
+	// the link has shown that it can't carry the full rate
+	if (client->adaptiveRate && client->adaptiveRate < rate)
+		rate = client->adaptiveRate;
+
 	if (client->netchan.remoteAddress.type == NA_IP6)
 		messageSize += UDPIP6_HEADER_SIZE;
 	else
@@ -1180,6 +1610,149 @@ int SV_RateMsec(client_t *client) {
 		return rateMsec - rate;
 }
 
+/*
+====================
+SV_AdaptRate
+
+Ends a measuring period of SV_SnapshotAcked.  Lost messages, or a round trip
+that stayed well above the link's base for the whole period, mean that the
+messages queue up somewhere on the way: the rate is cut by a quarter, which
+makes SV_SendClientMessages send the snapshots less often.  Otherwise it
+grows back by a sixteenth of the client's rate per period.
+====================
+*/
+
+#define RATE_PERIOD 500		 // msec, at least two round trips
+#define RATE_QUEUE_DELAY 40	 // msec the round trip may grow before it counts as congestion
+#define RATE_LOSS_PERCENT 5
+
+static void SV_AdaptRate(client_t *cl, int now) {
+	qboolean congested = qfalse;
+	int rate, minRate, queueDelay;
+
+	if (cl->snapLost >= 2 && cl->snapLost * 100 > (cl->snapAcked + cl->snapLost) * RATE_LOSS_PERCENT) {
+		congested = qtrue;
+	}
+
+	if (cl->snapMinRtt) {
+		queueDelay = cl->snapBaseRtt / 2;
+		if (queueDelay < RATE_QUEUE_DELAY) {
+			queueDelay = RATE_QUEUE_DELAY;
+		}
+		if (cl->snapBaseRtt && cl->snapMinRtt > cl->snapBaseRtt + queueDelay) {
+			congested = qtrue;
+		}
+
+		// drops right away, but only creeps up so a lasting queue isn't
+		// taken for the base; a route that really got longer is followed
+		// after some seconds
+		if (!cl->snapBaseRtt || cl->snapMinRtt < cl->snapBaseRtt) {
+			cl->snapBaseRtt = cl->snapMinRtt;
+		} else {
+			cl->snapBaseRtt += (cl->snapMinRtt - cl->snapBaseRtt + 15) / 16;
+		}
+	}
+
+	rate = SV_ClientRate(cl);
+	if (congested) {
+		minRate = rate / 4;
+		if (minRate < 1000) {
+			minRate = 1000;
+		}
+
+		cl->adaptiveRate = (cl->adaptiveRate ? cl->adaptiveRate : rate) * 3 / 4;
+		if (cl->adaptiveRate < minRate) {
+			cl->adaptiveRate = minRate;
+		}
+	} else if (cl->adaptiveRate) {
+		cl->adaptiveRate += rate / 16;
+		if (cl->adaptiveRate >= rate) {
+			cl->adaptiveRate = 0;
+		}
+	}
+
+	cl->snapPeriodStart = now;
+	cl->snapMinRtt = 0;
+	cl->snapAcked = 0;
+	cl->snapLost = 0;
+}
+
+/*
+====================
+SV_SnapshotAcked
+
+Measures the link to the client from the acknowledged messages.  The client
+only acks the newest message it has, so a message that was skipped over by
+an ack counts as lost only if an earlier ack arrived later than it should
+have reached the client.
+====================
+*/
+void SV_SnapshotAcked(client_t *cl, int sequence) {
+	clientSnapshot_t *frame;
+	int now, sample, delta, period, i;
+
+	if (!sv_adaptiveRate->integer || cl->netchan.remoteAddress.type == NA_LOOPBACK ||
+		(sv_lanForceRate->integer && Sys_IsLANAddress(cl->netchan.remoteAddress))) {
+		cl->adaptiveRate = 0;
+		return;
+	}
+
+	if (sequence >= cl->netchan.outgoingSequence || sequence <= cl->netchan.outgoingSequence - PACKET_BACKUP) {
+		return;
+	}
+
+	now = NET_PacketTime();
+	if (!cl->snapPeriodStart) {
+		cl->snapPeriodStart = now;
+	}
+
+	if (sequence > cl->snapLastAcked) {
+		i = cl->snapLastAcked + 1;
+		if (i <= cl->netchan.outgoingSequence - PACKET_BACKUP) {
+			i = cl->netchan.outgoingSequence - PACKET_BACKUP + 1;
+		}
+		for (; i < sequence; i++) {
+			frame = &cl->frames[i & PACKET_MASK];
+			if (frame->messageAcked == -1 && cl->snapLastAckTime - frame->messageSent > cl->snapRtt) {
+				cl->snapLost++;
+			}
+		}
+		cl->snapLastAcked = sequence;
+	}
+	cl->snapLastAckTime = now;
+
+	// only the first ack of a message times it
+	frame = &cl->frames[sequence & PACKET_MASK];
+	if (frame->messageAcked == -1) {
+		sample = now - frame->messageSent;
+		if (sample < 1) {
+			sample = 1;
+		}
+
+		if (!cl->snapRtt) {
+			cl->snapRtt = sample;
+		} else {
+			delta = sample - cl->snapRtt;
+			cl->snapRtt += delta / 8;
+			if (cl->snapRtt < 1) {
+				cl->snapRtt = 1;
+			}
+		}
+		if (!cl->snapMinRtt || sample < cl->snapMinRtt) {
+			cl->snapMinRtt = sample;
+		}
+		cl->snapAcked++;
+	}
+
+	period = 2 * cl->snapRtt;
+	if (period < RATE_PERIOD) {
+		period = RATE_PERIOD;
+	}
+	if (now - cl->snapPeriodStart >= period) {
+		SV_AdaptRate(cl, now);
+	}
+}
+
 /*
 ====================
 SV_SendQueuedPackets
@@ -1246,5 +1819,10 @@ int SV_SendQueuedPackets(void) {
 			timeVal = 0;
 	}
 
+	// wake up for the paced blocks and the resends
+	delayT = SV_DownloadWaitMsec();
+	if (delayT >= 0 && delayT < timeVal)
+		timeVal = delayT;
+
 	return timeVal;
 }
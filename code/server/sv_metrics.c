@@ -0,0 +1,257 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+// sv_metrics.c -- operational metrics pushed to a StatsD collector
+
+#include "server.h"
+
+/*
+=============================================================================
+
+With sv_metrics set to the address of a StatsD collector, the server adds
+up counters and frame times as it runs and every sv_metricsInterval seconds
+sends them in a few UDP packets, then starts over.  Counting is a few
+additions a frame and the packets go out on the server socket, so it can
+stay on all the time.
+
+Times are sent as gauges of the interval (average and maximum frame time,
+the milliseconds a frame spent in the game VM and the bot frame), frame
+times also as counters of a histogram.  Counts and bytes are counters.
+
+=============================================================================
+*/
+
+#define METRICS_PACKET_SIZE 1400 // stays below the usual MTU
+#define STATSD_PORT 8125
+
+// upper bounds of the frame time histogram in msec, the last bucket is
+// everything above
+static const int metricsFrameBuckets[] = {1, 2, 4, 8, 16, 32, 64};
+#define NUM_FRAME_BUCKETS (ARRAY_LEN(metricsFrameBuckets) + 1)
+
+typedef struct {
+	int frames;
+	int64_t frameUsec;
+	int frameUsecMax;
+	int frameBuckets[NUM_FRAME_BUCKETS];
+} metricsFrames_t;
+
+svMetrics_t svMetrics;
+
+static metricsFrames_t metricsFrames;
+static int metricsStart; // Sys_Milliseconds of the start of the interval
+static netadr_t metricsAdr;
+static qboolean metricsAdrValid;
+
+static char metricsPacket[METRICS_PACKET_SIZE];
+static int metricsPacketLength;
+
+/*
+==================
+SV_MetricsFrame
+
+Adds the time of a server frame that ran the game
+==================
+*/
+void SV_MetricsFrame(int usec) {
+	int msec;
+	int i;
+
+	metricsFrames.frames++;
+	metricsFrames.frameUsec += usec;
+	if (usec > metricsFrames.frameUsecMax) {
+		metricsFrames.frameUsecMax = usec;
+	}
+
+	msec = usec / 1000;
+	for (i = 0; i < NUM_FRAME_BUCKETS - 1; i++) {
+		if (msec < metricsFrameBuckets[i]) {
+			break;
+		}
+	}
+	metricsFrames.frameBuckets[i]++;
+}
+
+/*
+==================
+SV_MetricsFlush
+==================
+*/
+static void SV_MetricsFlush(void) {
+	if (metricsPacketLength) {
+		NET_SendPacket(NS_SERVER, metricsPacketLength, metricsPacket, metricsAdr);
+		metricsPacketLength = 0;
+	}
+}
+
+/*
+==================
+SV_MetricsLine
+
+Adds one "<prefix>.<name>:<value>|<type>" line, sending the packet first
+if it doesn't fit anymore
+==================
+*/
+static void SV_MetricsLine(const char *name, const char *value, const char *type) {
+	char line[MAX_STRING_CHARS];
+	int length;
+
+	length = Com_sprintf(line, sizeof(line), "%s.%s:%s|%s\n", sv_metricsPrefix->string, name, value, type);
+
+	if (metricsPacketLength + length > METRICS_PACKET_SIZE) {
+		SV_MetricsFlush();
+	}
+	if (length > METRICS_PACKET_SIZE) {
+		return;
+	}
+
+	Com_Memcpy(metricsPacket + metricsPacketLength, line, length);
+	metricsPacketLength += length;
+}
+
+/*
+==================
+SV_MetricsCount
+==================
+*/
+static void SV_MetricsCount(const char *name, int64_t value) {
+	SV_MetricsLine(name, va("%lld", (long long)value), "c");
+}
+
+/*
+==================
+SV_MetricsGauge
+==================
+*/
+static void SV_MetricsGauge(const char *name, double value) {
+	SV_MetricsLine(name, va("%.3f", value), "g");
+}
+
+/*
+==================
+SV_MetricsReset
+==================
+*/
+static void SV_MetricsReset(void) {
+	Com_Memset(&svMetrics, 0, sizeof(svMetrics));
+	Com_Memset(&metricsFrames, 0, sizeof(metricsFrames));
+	metricsStart = Sys_Milliseconds();
+}
+
+/*
+==================
+SV_MetricsSend
+==================
+*/
+static void SV_MetricsSend(void) {
+	const float frames = metricsFrames.frames ? metricsFrames.frames : 1;
+	client_t *cl;
+	int clients, bots;
+	int i;
+
+	clients = bots = 0;
+	for (i = 0, cl = svs.clients; i < sv_maxclients->integer; i++, cl++) {
+		if (cl->state < CS_CONNECTED) {
+			continue;
+		}
+		if (cl->netchan.remoteAddress.type == NA_BOT) {
+			bots++;
+		} else {
+			clients++;
+		}
+	}
+
+	SV_MetricsGauge("clients", clients);
+	SV_MetricsGauge("bots", bots);
+
+	SV_MetricsCount("frame.count", metricsFrames.frames);
+	SV_MetricsGauge("frame.msec_avg", metricsFrames.frameUsec / 1000.0f / frames);
+	SV_MetricsGauge("frame.msec_max", metricsFrames.frameUsecMax / 1000.0f);
+	for (i = 0; i < NUM_FRAME_BUCKETS - 1; i++) {
+		SV_MetricsCount(va("frame.under_%ims", metricsFrameBuckets[i]), metricsFrames.frameBuckets[i]);
+	}
+	SV_MetricsCount(va("frame.over_%ims", metricsFrameBuckets[NUM_FRAME_BUCKETS - 2]),
+					metricsFrames.frameBuckets[NUM_FRAME_BUCKETS - 1]);
+
+	SV_MetricsGauge("game.msec_avg", svMetrics.gameUsec / 1000.0f / frames);
+	SV_MetricsGauge("bots.msec_avg", svMetrics.botUsec / 1000.0f / frames);
+
+	SV_MetricsCount("snapshot.count", svMetrics.snapshots);
+	SV_MetricsCount("snapshot.bytes", svMetrics.snapshotBytes);
+	if (svMetrics.snapshots) {
+		SV_MetricsGauge("snapshot.bytes_avg", (float)svMetrics.snapshotBytes / svMetrics.snapshots);
+	}
+
+	SV_MetricsCount("net.dropped", svMetrics.droppedPackets);
+	SV_MetricsCount("net.ratelimited", svMetrics.rateLimited);
+	SV_MetricsCount("download.bytes", svMetrics.downloadBytes);
+
+	SV_MetricsGauge("memory.cm", Com_MemOwnerBytes(MEMOWNER_CM));
+	SV_MetricsGauge("memory.botlib", Com_MemOwnerBytes(MEMOWNER_BOTLIB));
+	SV_MetricsGauge("memory.game", Com_MemOwnerBytes(MEMOWNER_GAME));
+	SV_MetricsGauge("memory.hunk_free", Hunk_MemoryRemaining());
+	SV_MetricsGauge("memory.zone_free", Z_AvailableMemory());
+
+	SV_MetricsFlush();
+}
+
+/*
+==================
+SV_MetricsCheck
+
+Sends the metrics of the interval once it is over, called every server
+frame
+==================
+*/
+void SV_MetricsCheck(void) {
+	int interval;
+	int result;
+
+	if (sv_metrics->modified) {
+		sv_metrics->modified = qfalse;
+		metricsAdrValid = qfalse;
+
+		if (sv_metrics->string[0]) {
+			result = NET_StringToAdr(sv_metrics->string, &metricsAdr, NA_UNSPEC);
+			if (result) {
+				if (result == 2) {
+					metricsAdr.port = BigShort(STATSD_PORT);
+				}
+				metricsAdrValid = qtrue;
+			} else {
+				Com_Printf(S_COLOR_YELLOW "WARNING: can't resolve sv_metrics address %s\n", sv_metrics->string);
+			}
+		}
+		SV_MetricsReset();
+	}
+
+	if (!metricsAdrValid) {
+		return;
+	}
+
+	interval = sv_metricsInterval->integer * 1000;
+	if (Sys_Milliseconds() - metricsStart < interval) {
+		return;
+	}
+
+	SV_MetricsSend();
+	SV_MetricsReset();
+}
@@ -0,0 +1,686 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+// sv_microbench.c -- microbenchmarks of engine hot paths
+
+#include "server.h"
+#include "../botlib/botlib.h"
+#include "../botlib/be_aas.h"
+
+extern botlib_export_t *botlib_export;
+
+/*
+=============================================================================
+
+sv_microbench runs a fixed set of small benchmarks against the map that is
+loaded, so builds can be compared on the same data:
+
+trace		CM_BoxTrace of random point and player sized rays in the world
+delta		MSG_WriteDeltaEntity / MSG_ReadDeltaEntity over entity states
+			recorded from a few server frames
+huffman		Huff_Compress / Huff_Decompress of the entity messages
+fs			FS_ReadFile of files that come from pk3s
+zone		Z_Malloc / Z_Free, back to back and scattered
+aas			AAS_AreaTravelTimeToGoalArea between random reachable areas
+vm			VM_Call of a command the game doesn't know, the cost of
+			entering and leaving the VM
+
+The inputs come from a seeded generator.  Every benchmark does a warmup
+pass and MICRO_PASSES timed passes, the best and the median pass are
+reported in nanoseconds an operation.  With a report name the results
+also go to benchmarks/<report>.json.
+
+=============================================================================
+*/
+
+#define MICRO_PASSES 5
+#define MICRO_MAX_BENCHES 16
+
+#define MICRO_TRACES 8192
+#define MICRO_STREAM_FRAMES 16
+#define MICRO_FILES 64
+#define MICRO_ZONE_OPS 65536
+#define MICRO_ZONE_LIVE 1024
+#define MICRO_AAS_AREAS 256
+#define MICRO_AAS_ROUTES 4096
+#define MICRO_VM_CALLS 65536
+#define MICRO_VM_COMMAND 0x10000 // unknown to vmMain, which returns at once
+
+typedef struct {
+	const char *name;
+	int ops; // a pass
+	int passUsec[MICRO_PASSES];
+	float bestNsec, medianNsec;
+} microResult_t;
+
+typedef struct {
+	vec3_t start, end;
+	qboolean box;
+} microRay_t;
+
+static int microSeed; // advanced by the setups
+
+static microResult_t microResults[MICRO_MAX_BENCHES];
+static int numMicroResults;
+
+static microRay_t *microRays;
+
+// the entity states of MICRO_STREAM_FRAMES frames and the messages with
+// the deltas between them
+static entityState_t *microStates; // [frame * MAX_GENTITIES + number]
+static byte *microPresent;		   // [frame * MAX_GENTITIES + number]
+static int microNumEntities;
+static byte *microMessages;		// [frame * MAX_MSGLEN]
+static int *microMessageSizes;	// [frame]
+static int *microDeltaNumbers;	// entity numbers with a delta, in message order
+static int *microDeltaCounts;	// [frame]
+static int microNumDeltas;
+
+static char **microFiles;
+static int numMicroFiles;
+
+static void **microBlocks;
+static int *microSizes;
+
+static int microAreas[MICRO_AAS_AREAS];
+static vec3_t microAreaOrigins[MICRO_AAS_AREAS];
+static int numMicroAreas;
+static int *microRoutes; // pairs of indices into microAreas
+
+/*
+==================
+SV_MicroRand
+
+A number in [0, range) from a Q_rand seed
+==================
+*/
+static int SV_MicroRand(int *seed, int range) {
+	return (Q_rand(seed) & 0x7fffffff) % range;
+}
+
+/*
+==================
+SV_MicroRun
+
+Times a warmup pass and MICRO_PASSES passes of a benchmark
+==================
+*/
+static void SV_MicroRun(const char *name, int (*pass)(void)) {
+	microResult_t *r;
+	int sorted[MICRO_PASSES];
+	int64_t start;
+	int i, j, t;
+
+	if (numMicroResults == MICRO_MAX_BENCHES) {
+		return;
+	}
+	r = &microResults[numMicroResults++];
+	r->name = name;
+	r->ops = pass();
+
+	for (i = 0; i < MICRO_PASSES; i++) {
+		start = Sys_Microseconds();
+		pass();
+		r->passUsec[i] = (int)(Sys_Microseconds() - start);
+	}
+
+	// passes are few, an insertion sort does
+	for (i = 0; i < MICRO_PASSES; i++) {
+		t = r->passUsec[i];
+		for (j = i; j > 0 && sorted[j - 1] > t; j--) {
+			sorted[j] = sorted[j - 1];
+		}
+		sorted[j] = t;
+	}
+
+	r->bestNsec = r->ops ? sorted[0] * 1000.0f / r->ops : 0.0f;
+	r->medianNsec = r->ops ? sorted[MICRO_PASSES / 2] * 1000.0f / r->ops : 0.0f;
+
+	Com_Printf("%-16s %8d ops %10.1f ns best %10.1f ns median\n", name, r->ops, r->bestNsec, r->medianNsec);
+}
+
+/*
+==================
+SV_MicroSkip
+==================
+*/
+static void SV_MicroSkip(const char *name, const char *reason) {
+	Com_Printf("%-16s skipped, %s\n", name, reason);
+}
+
+/*
+=============================================================================
+
+TRACES
+
+=============================================================================
+*/
+
+/*
+==================
+SV_MicroSetupTraces
+==================
+*/
+static void SV_MicroSetupTraces(void) {
+	vec3_t mins, maxs, dir;
+	float length;
+	int i, j;
+
+	CM_ModelBounds(0, mins, maxs);
+
+	for (i = 0; i < MICRO_TRACES; i++) {
+		microRay_t *ray = &microRays[i];
+
+		for (j = 0; j < 3; j++) {
+			ray->start[j] = mins[j] + Q_random(&microSeed) * (maxs[j] - mins[j]);
+			dir[j] = Q_crandom(&microSeed);
+		}
+		VectorNormalize(dir);
+		length = 64.0f + Q_random(&microSeed) * 1984.0f;
+		VectorMA(ray->start, length, dir, ray->end);
+		ray->box = i & 1;
+	}
+}
+
+static int SV_MicroTraces(void) {
+	static const vec3_t boxMins = {-15, -15, -24}, boxMaxs = {15, 15, 32};
+	trace_t trace;
+	int i;
+
+	for (i = 0; i < MICRO_TRACES; i++) {
+		const microRay_t *ray = &microRays[i];
+
+		if (ray->box) {
+			CM_BoxTrace(&trace, ray->start, ray->end, boxMins, boxMaxs, 0, MASK_PLAYERSOLID, qfalse);
+		} else {
+			CM_BoxTrace(&trace, ray->start, ray->end, vec3_origin, vec3_origin, 0, MASK_SHOT, qfalse);
+		}
+	}
+
+	return MICRO_TRACES;
+}
+
+/*
+=============================================================================
+
+ENTITY DELTAS
+
+=============================================================================
+*/
+
+/*
+==================
+SV_MicroRecordStates
+
+Runs MICRO_STREAM_FRAMES server frames and keeps the state of every linked
+entity after each one
+==================
+*/
+static void SV_MicroRecordStates(void) {
+	sharedEntity_t *ent;
+	int frame, i;
+
+	for (frame = 0; frame < MICRO_STREAM_FRAMES; frame++) {
+		SV_Frame(SV_FrameMsec());
+
+		for (i = 0; i < sv.num_entities; i++) {
+			ent = SV_GentityNum(i);
+			if (!ent->r.linked || (ent->r.svFlags & SVF_NOCLIENT)) {
+				continue;
+			}
+			microStates[frame * MAX_GENTITIES + i] = ent->s;
+			microPresent[frame * MAX_GENTITIES + i] = 1;
+		}
+	}
+
+	microNumEntities = sv.num_entities;
+}
+
+/*
+==================
+SV_MicroWriteDeltas
+
+Writes the deltas of every frame against the one before into its message.
+Entities that didn't change write nothing, as in a snapshot.
+==================
+*/
+static int SV_MicroWriteDeltas(qboolean record) {
+	msg_t msg;
+	int frame, i, bit, ops;
+
+	ops = 0;
+	if (record) {
+		microNumDeltas = 0;
+	}
+
+	for (frame = 1; frame < MICRO_STREAM_FRAMES; frame++) {
+		entityState_t *from = &microStates[(frame - 1) * MAX_GENTITIES];
+		entityState_t *to = &microStates[frame * MAX_GENTITIES];
+		const byte *fromPresent = &microPresent[(frame - 1) * MAX_GENTITIES];
+		const byte *toPresent = &microPresent[frame * MAX_GENTITIES];
+
+		MSG_Init(&msg, &microMessages[frame * MAX_MSGLEN], MAX_MSGLEN);
+		if (record) {
+			microDeltaCounts[frame] = 0;
+		}
+
+		for (i = 0; i < microNumEntities; i++) {
+			if (!fromPresent[i] || !toPresent[i]) {
+				continue;
+			}
+
+			bit = msg.bit;
+			MSG_WriteDeltaEntity(&msg, &from[i], &to[i], qfalse);
+			ops++;
+
+			if (record && msg.bit != bit) {
+				microDeltaNumbers[microNumDeltas++] = i;
+				microDeltaCounts[frame]++;
+			}
+		}
+
+		microMessageSizes[frame] = msg.cursize;
+	}
+
+	return ops;
+}
+
+static int SV_MicroDeltaWrite(void) {
+	return SV_MicroWriteDeltas(qfalse);
+}
+
+static int SV_MicroDeltaRead(void) {
+	entityState_t state;
+	msg_t msg;
+	int frame, i, number, delta, ops;
+
+	ops = 0;
+	delta = 0;
+
+	for (frame = 1; frame < MICRO_STREAM_FRAMES; frame++) {
+		entityState_t *from = &microStates[(frame - 1) * MAX_GENTITIES];
+
+		MSG_Init(&msg, &microMessages[frame * MAX_MSGLEN], MAX_MSGLEN);
+		msg.cursize = microMessageSizes[frame];
+		MSG_BeginReading(&msg);
+
+		for (i = 0; i < microDeltaCounts[frame]; i++, delta++) {
+			number = MSG_ReadBits(&msg, GENTITYNUM_BITS);
+			if (number != microDeltaNumbers[delta]) {
+				// the stream got out of step, don't time garbage
+				return ops;
+			}
+			MSG_ReadDeltaEntity(&msg, &from[number], &state, number);
+			ops++;
+		}
+	}
+
+	return ops;
+}
+
+/*
+=============================================================================
+
+HUFFMAN
+
+=============================================================================
+*/
+
+static byte microHuffData[MAX_MSGLEN];
+static byte *microCompressed; // [frame * MAX_MSGLEN]
+static int *microCompressedSizes;
+
+static int SV_MicroHuffCompress(void) {
+	msg_t msg;
+	int frame, bytes;
+
+	bytes = 0;
+	for (frame = 1; frame < MICRO_STREAM_FRAMES; frame++) {
+		MSG_Init(&msg, microHuffData, sizeof(microHuffData));
+		Com_Memcpy(microHuffData, &microMessages[frame * MAX_MSGLEN], microMessageSizes[frame]);
+		msg.cursize = microMessageSizes[frame];
+		Huff_Compress(&msg, 0);
+		bytes += microMessageSizes[frame];
+	}
+
+	return bytes;
+}
+
+static int SV_MicroHuffDecompress(void) {
+	msg_t msg;
+	int frame, bytes;
+
+	bytes = 0;
+	for (frame = 1; frame < MICRO_STREAM_FRAMES; frame++) {
+		MSG_Init(&msg, microHuffData, sizeof(microHuffData));
+		Com_Memcpy(microHuffData, &microCompressed[frame * MAX_MSGLEN], microCompressedSizes[frame]);
+		msg.cursize = microCompressedSizes[frame];
+		Huff_Decompress(&msg, 0);
+		bytes += msg.cursize;
+	}
+
+	return bytes;
+}
+
+/*
+==================
+SV_MicroSetupHuffman
+
+Compresses the entity messages once, as input for the decompression
+==================
+*/
+static void SV_MicroSetupHuffman(void) {
+	msg_t msg;
+	int frame;
+
+	for (frame = 1; frame < MICRO_STREAM_FRAMES; frame++) {
+		MSG_Init(&msg, &microCompressed[frame * MAX_MSGLEN], MAX_MSGLEN);
+		Com_Memcpy(msg.data, &microMessages[frame * MAX_MSGLEN], microMessageSizes[frame]);
+		msg.cursize = microMessageSizes[frame];
+		Huff_Compress(&msg, 0);
+		microCompressedSizes[frame] = msg.cursize;
+	}
+}
+
+/*
+=============================================================================
+
+FILES, ZONE, AAS, VM
+
+=============================================================================
+*/
+
+/*
+==================
+SV_MicroSetupFiles
+
+Picks files that are read from pk3s
+==================
+*/
+static void SV_MicroSetupFiles(void) {
+	static const char *dirs[][2] = {{"scripts", ".shader"}, {"scripts", ".arena"}, {"botfiles", ".c"}, {"", ".cfg"}};
+	char **list;
+	char path[MAX_QPATH];
+	int i, j, num;
+
+	numMicroFiles = 0;
+	for (i = 0; i < ARRAY_LEN(dirs) && numMicroFiles < MICRO_FILES; i++) {
+		list = FS_ListFiles(dirs[i][0], dirs[i][1], &num);
+		for (j = 0; j < num && numMicroFiles < MICRO_FILES; j++) {
+			Com_sprintf(path, sizeof(path), "%s%s%s", dirs[i][0], dirs[i][0][0] ? "/" : "", list[j]);
+			if (FS_FileIsInPAK(path, NULL) == 1) {
+				microFiles[numMicroFiles++] = CopyString(path);
+			}
+		}
+		FS_FreeFileList(list);
+	}
+}
+
+static int SV_MicroFiles(void) {
+	void *buffer;
+	int i;
+
+	for (i = 0; i < numMicroFiles; i++) {
+		FS_ReadFile(microFiles[i], &buffer);
+		if (buffer) {
+			FS_FreeFile(buffer);
+		}
+	}
+
+	return numMicroFiles;
+}
+
+static int SV_MicroZoneBackToBack(void) {
+	int i;
+
+	for (i = 0; i < MICRO_ZONE_OPS; i++) {
+		Z_Free(Z_Malloc(64));
+	}
+
+	return MICRO_ZONE_OPS;
+}
+
+/*
+==================
+SV_MicroZoneScattered
+
+Keeps MICRO_ZONE_LIVE blocks of random sizes and replaces random ones,
+every pass sees the same sequence
+==================
+*/
+static int SV_MicroZoneScattered(void) {
+	int seed = 1;
+	int i, slot;
+
+	for (i = 0; i < MICRO_ZONE_LIVE; i++) {
+		microBlocks[i] = Z_Malloc(microSizes[i]);
+	}
+
+	for (i = 0; i < MICRO_ZONE_OPS; i++) {
+		slot = SV_MicroRand(&seed, MICRO_ZONE_LIVE);
+		Z_Free(microBlocks[slot]);
+		microBlocks[slot] = Z_Malloc(microSizes[(slot + i) % MICRO_ZONE_LIVE]);
+	}
+
+	for (i = 0; i < MICRO_ZONE_LIVE; i++) {
+		Z_Free(microBlocks[i]);
+	}
+
+	return MICRO_ZONE_OPS;
+}
+
+/*
+==================
+SV_MicroSetupAAS
+
+Picks areas with reachabilities at random points of the world and the
+routes between them
+==================
+*/
+static void SV_MicroSetupAAS(void) {
+	vec3_t mins, maxs, point;
+	int i, j, area;
+
+	numMicroAreas = 0;
+	if (!botlib_export || !botlib_export->aas.AAS_Initialized()) {
+		return;
+	}
+
+	CM_ModelBounds(0, mins, maxs);
+
+	for (i = 0; i < 64 * MICRO_AAS_AREAS && numMicroAreas < MICRO_AAS_AREAS; i++) {
+		for (j = 0; j < 3; j++) {
+			point[j] = mins[j] + Q_random(&microSeed) * (maxs[j] - mins[j]);
+		}
+
+		area = botlib_export->aas.AAS_PointAreaNum(point);
+		if (area <= 0 || !botlib_export->aas.AAS_AreaReachability(area)) {
+			continue;
+		}
+
+		microAreas[numMicroAreas] = area;
+		VectorCopy(point, microAreaOrigins[numMicroAreas]);
+		numMicroAreas++;
+	}
+
+	for (i = 0; numMicroAreas && i < MICRO_AAS_ROUTES; i++) {
+		microRoutes[i * 2] = SV_MicroRand(&microSeed, numMicroAreas);
+		microRoutes[i * 2 + 1] = SV_MicroRand(&microSeed, numMicroAreas);
+	}
+}
+
+static int SV_MicroAAS(void) {
+	int i, from, to;
+
+	for (i = 0; i < MICRO_AAS_ROUTES; i++) {
+		from = microRoutes[i * 2];
+		to = microRoutes[i * 2 + 1];
+		botlib_export->aas.AAS_AreaTravelTimeToGoalArea(microAreas[from], microAreaOrigins[from], microAreas[to],
+														 TFL_DEFAULT);
+	}
+
+	return MICRO_AAS_ROUTES;
+}
+
+static int SV_MicroVMCall(void) {
+	int i;
+
+	for (i = 0; i < MICRO_VM_CALLS; i++) {
+		VM_Call(gvm, MICRO_VM_COMMAND);
+	}
+
+	return MICRO_VM_CALLS;
+}
+
+/*
+==================
+SV_MicroReport
+==================
+*/
+static void SV_MicroReport(const char *report, int seed) {
+	fileHandle_t f;
+	int i, j;
+
+	f = FS_FOpenFileWrite(va("benchmarks/%s.json", report));
+	if (!f) {
+		Com_Printf("Couldn't open benchmarks/%s.json for writing\n", report);
+		return;
+	}
+
+	FS_Printf(f, "{\n");
+	FS_Printf(f, "\t\"map\": \"%s\",\n", sv_mapname->string);
+	FS_Printf(f, "\t\"version\": \"%s\",\n", Q3_VERSION);
+	FS_Printf(f, "\t\"seed\": %d, \"passes\": %d,\n", seed, MICRO_PASSES);
+	FS_Printf(f, "\t\"benchmarks\": {\n");
+	for (i = 0; i < numMicroResults; i++) {
+		const microResult_t *r = &microResults[i];
+
+		FS_Printf(f, "\t\t\"%s\": {\"ops\": %d, \"best_ns\": %.2f, \"median_ns\": %.2f, \"passes_us\": [", r->name,
+				  r->ops, r->bestNsec, r->medianNsec);
+		for (j = 0; j < MICRO_PASSES; j++) {
+			FS_Printf(f, "%s%d", j ? ", " : "", r->passUsec[j]);
+		}
+		FS_Printf(f, "]}%s\n", i < numMicroResults - 1 ? "," : "");
+	}
+	FS_Printf(f, "\t}\n");
+	FS_Printf(f, "}\n");
+	FS_FCloseFile(f);
+
+	Com_Printf("benchmarks/%s.json written\n", report);
+}
+
+/*
+==================
+SV_Microbench_f
+
+sv_microbench [report] [seed]
+==================
+*/
+void SV_Microbench_f(void) {
+	int seed;
+	int i;
+
+	if (Cmd_Argc() > 3) {
+		Com_Printf("Usage: %s [report] [seed]\n", Cmd_Argv(0));
+		return;
+	}
+
+	if (!com_sv_running->integer || sv.state != SS_GAME) {
+		Com_Printf("%s needs a map to be running.\n", Cmd_Argv(0));
+		return;
+	}
+
+	seed = microSeed = Cmd_Argc() > 2 ? atoi(Cmd_Argv(2)) : 1;
+	numMicroResults = 0;
+
+	microRays = Z_Malloc(MICRO_TRACES * sizeof(*microRays));
+	microStates = Z_Malloc(MICRO_STREAM_FRAMES * MAX_GENTITIES * sizeof(*microStates));
+	microPresent = Z_Malloc(MICRO_STREAM_FRAMES * MAX_GENTITIES);
+	microMessages = Z_Malloc(MICRO_STREAM_FRAMES * MAX_MSGLEN);
+	microMessageSizes = Z_Malloc(MICRO_STREAM_FRAMES * sizeof(*microMessageSizes));
+	microDeltaNumbers = Z_Malloc(MICRO_STREAM_FRAMES * MAX_GENTITIES * sizeof(*microDeltaNumbers));
+	microDeltaCounts = Z_Malloc(MICRO_STREAM_FRAMES * sizeof(*microDeltaCounts));
+	microCompressed = Z_Malloc(MICRO_STREAM_FRAMES * MAX_MSGLEN);
+	microCompressedSizes = Z_Malloc(MICRO_STREAM_FRAMES * sizeof(*microCompressedSizes));
+	microFiles = Z_Malloc(MICRO_FILES * sizeof(*microFiles));
+	microBlocks = Z_Malloc(MICRO_ZONE_LIVE * sizeof(*microBlocks));
+	microSizes = Z_Malloc(MICRO_ZONE_LIVE * sizeof(*microSizes));
+	microRoutes = Z_Malloc(MICRO_AAS_ROUTES * 2 * sizeof(*microRoutes));
+
+	Com_Printf("sv_microbench: %s, seed %d, best and median of %d passes\n", sv_mapname->string, seed,
+			   MICRO_PASSES);
+
+	SV_MicroSetupTraces();
+	SV_MicroRun("trace", SV_MicroTraces);
+
+	SV_MicroRecordStates();
+	SV_MicroWriteDeltas(qtrue);
+	SV_MicroRun("delta_write", SV_MicroDeltaWrite);
+	SV_MicroRun("delta_read", SV_MicroDeltaRead);
+
+	// counted in bytes of input
+	SV_MicroSetupHuffman();
+	SV_MicroRun("huff_compress", SV_MicroHuffCompress);
+	SV_MicroRun("huff_decompress", SV_MicroHuffDecompress);
+
+	SV_MicroSetupFiles();
+	if (numMicroFiles) {
+		SV_MicroRun("fs_readfile", SV_MicroFiles);
+	} else {
+		SV_MicroSkip("fs_readfile", "no pk3 files");
+	}
+
+	for (i = 0; i < MICRO_ZONE_LIVE; i++) {
+		microSizes[i] = 16 + SV_MicroRand(&microSeed, 4096);
+	}
+	SV_MicroRun("zone_backtoback", SV_MicroZoneBackToBack);
+	SV_MicroRun("zone_scattered", SV_MicroZoneScattered);
+
+	SV_MicroSetupAAS();
+	if (numMicroAreas) {
+		SV_MicroRun("aas_traveltime", SV_MicroAAS);
+	} else {
+		SV_MicroSkip("aas_traveltime", "no aas loaded");
+	}
+
+	SV_MicroRun("vm_call", SV_MicroVMCall);
+
+	if (Cmd_Argc() > 1) {
+		SV_MicroReport(Cmd_Argv(1), seed);
+	}
+
+	for (i = 0; i < numMicroFiles; i++) {
+		Z_Free(microFiles[i]);
+	}
+	Z_Free(microRoutes);
+	Z_Free(microSizes);
+	Z_Free(microBlocks);
+	Z_Free(microFiles);
+	Z_Free(microCompressedSizes);
+	Z_Free(microCompressed);
+	Z_Free(microDeltaCounts);
+	Z_Free(microDeltaNumbers);
+	Z_Free(microMessageSizes);
+	Z_Free(microMessages);
+	Z_Free(microPresent);
+	Z_Free(microStates);
+	Z_Free(microRays);
+}
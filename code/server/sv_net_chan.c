@@ -41,6 +41,31 @@ void SV_Netchan_FreeQueue(client_t *client) {
 	client->netchan_end_queue = &client->netchan_start_queue;
 }
 
+/*
+=================
+SV_Netchan_Send
+
+Raw messages go out LZ compressed when that makes them smaller
+=================
+*/
+static void SV_Netchan_Send(client_t *client, msg_t *msg) {
+	byte packed[MAX_MSGLEN];
+	int length;
+
+	if (!msg->raw) {
+		Netchan_TransmitFlags(&client->netchan, msg->cursize, msg->data,
+							  msg->huffTable == MSG_HUFF_ALTERNATE ? NETCHAN_HUFF : 0);
+		return;
+	}
+
+	length = LZ_Compress(msg->data, msg->cursize, packed, msg->cursize - 1);
+	if (length) {
+		Netchan_TransmitFlags(&client->netchan, length, packed, NETCHAN_RAW | NETCHAN_LZ);
+	} else {
+		Netchan_TransmitFlags(&client->netchan, msg->cursize, msg->data, NETCHAN_RAW);
+	}
+}
+
 /*
 =================
 SV_Netchan_TransmitNextInQueue
@@ -52,7 +77,7 @@ static void SV_Netchan_TransmitNextInQueue(client_t *client) {
 	Com_DPrintf("#462 Netchan_TransmitNextFragment: popping a queued message for transmit\n");
 	netbuf = client->netchan_start_queue;
 
-	Netchan_Transmit(&client->netchan, netbuf->msg.cursize, netbuf->msg.data);
+	SV_Netchan_Send(client, &netbuf->msg);
 
 	// pop from queue
 	client->netchan_start_queue = netbuf->next;
@@ -100,6 +125,8 @@ then buffer them and make sure they get sent in correct order
 void SV_Netchan_Transmit(client_t *client, msg_t *msg) {
 	MSG_WriteByte(msg, svc_EOF);
 
+	SV_DemoMessage(client, msg);
+
 	if (client->netchan.unsentFragments || client->netchan_start_queue) {
 		netchan_buffer_t *netbuf;
 		Com_DPrintf("#462 SV_Netchan_Transmit: unsent fragments, stacked\n");
@@ -111,7 +138,7 @@ void SV_Netchan_Transmit(client_t *client, msg_t *msg) {
 		*client->netchan_end_queue = netbuf;
 		client->netchan_end_queue = &(*client->netchan_end_queue)->next;
 	} else {
-		Netchan_Transmit(&client->netchan, msg->cursize, msg->data);
+		SV_Netchan_Send(client, msg);
 	}
 }
 
@@ -126,5 +153,8 @@ qboolean SV_Netchan_Process(client_t *client, msg_t *msg) {
 	if (!ret)
 		return qfalse;
 
+	if (client->netchan.dropped > 0)
+		svMetrics.droppedPackets += client->netchan.dropped;
+
 	return qtrue;
 }
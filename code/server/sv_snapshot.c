@@ -44,6 +44,157 @@ A normal server packet will look like:
 =============================================================================
 */
 
+/*
+=============================================================================
+
+DELTA ENTITY CACHE
+
+When most clients acknowledged the same snapshot, the same entity deltas are
+encoded over and over for every one of them.  The encoded bits of each
+(from, to) pair are remembered for the rest of the frame and copied into the
+later messages instead.
+
+The cache is only used while the snapshots are encoded on the main thread.
+
+=============================================================================
+*/
+
+#define DELTA_CACHE_HASH	1024 // must be a power of two
+#define DELTA_CACHE_PROBES	4
+#define DELTA_CACHE_BYTES	0x20000
+
+typedef struct {
+	int sequence; // the entry is only valid if this matches deltaCache.sequence
+	qboolean force;
+	entityState_t from;
+	entityState_t to;
+	int offset; // first bit in deltaCache.bits
+	int bits;
+} deltaCacheEntry_t;
+
+typedef struct {
+	qboolean active;
+	int sequence;
+	msg_t msg; // the encoded bits of all entries
+	byte bits[DELTA_CACHE_BYTES];
+	deltaCacheEntry_t entries[DELTA_CACHE_HASH];
+} deltaCache_t;
+
+static deltaCache_t deltaCache;
+
+/*
+=============
+SV_BeginDeltaCache
+
+Drops the entries of the previous frame
+=============
+*/
+static void SV_BeginDeltaCache(void) {
+	if (!deltaCache.msg.data) {
+		MSG_Init(&deltaCache.msg, deltaCache.bits, sizeof(deltaCache.bits));
+	}
+	MSG_Clear(&deltaCache.msg);
+
+	// sequence 0 marks the unused entries
+	if (++deltaCache.sequence <= 0) {
+		Com_Memset(deltaCache.entries, 0, sizeof(deltaCache.entries));
+		deltaCache.sequence = 1;
+	}
+	deltaCache.active = qtrue;
+}
+
+/*
+=============
+SV_EndDeltaCache
+=============
+*/
+static void SV_EndDeltaCache(void) {
+	deltaCache.active = qfalse;
+}
+
+/*
+=============
+SV_DeltaCacheHash
+=============
+*/
+static unsigned SV_DeltaCacheHash(const entityState_t *from, const entityState_t *to, qboolean force) {
+	const unsigned *f = (const unsigned *)from;
+	const unsigned *t = (const unsigned *)to;
+	unsigned hash;
+	int i;
+
+	hash = force ? 0x9e3779b9 : 0x811c9dc5;
+	for (i = 0; i < sizeof(*to) / 4; i++) {
+		hash = (hash ^ f[i]) * 0x01000193;
+		hash = (hash ^ t[i]) * 0x01000193;
+	}
+
+	return hash ^ (hash >> 16);
+}
+
+/*
+=============
+SV_WriteDeltaEntity
+
+MSG_WriteDeltaEntity for a client snapshot, going through the delta cache
+when it is active
+=============
+*/
+static void SV_WriteDeltaEntity(msg_t *msg, entityState_t *from, entityState_t *to, qboolean force) {
+	deltaCacheEntry_t *entry, *slot;
+	unsigned hash;
+	int start;
+	int i;
+
+	// the cache holds default table codes, and capturing counts every byte
+	if (!deltaCache.active || !to || msg->overflowed || msg->huffTable != MSG_HUFF_DEFAULT || msg->symbolCounts) {
+		MSG_WriteDeltaEntity(msg, from, to, force);
+		return;
+	}
+
+	// an unchanged entity doesn't write anything, don't bother hashing it
+	if (!force && !memcmp(from, to, sizeof(*to))) {
+		return;
+	}
+
+	hash = SV_DeltaCacheHash(from, to, force);
+	slot = NULL;
+	for (i = 0; i < DELTA_CACHE_PROBES; i++) {
+		entry = &deltaCache.entries[(hash + i) & (DELTA_CACHE_HASH - 1)];
+		if (entry->sequence != deltaCache.sequence) {
+			if (!slot) {
+				slot = entry;
+			}
+			continue;
+		}
+
+		if (entry->force == force && !memcmp(&entry->to, to, sizeof(*to)) && !memcmp(&entry->from, from, sizeof(*from))) {
+			MSG_WriteBitStream(msg, deltaCache.msg.data, entry->offset, entry->bits);
+			return;
+		}
+	}
+
+	start = msg->bit;
+	MSG_WriteDeltaEntity(msg, from, to, force);
+
+	if (!slot || msg->overflowed) {
+		return;
+	}
+
+	// remember the encoded bits, unless the cache ran out of space this frame
+	slot->offset = deltaCache.msg.bit;
+	slot->bits = msg->bit - start;
+	MSG_WriteBitStream(&deltaCache.msg, msg->data, start, slot->bits);
+	if (deltaCache.msg.overflowed) {
+		return;
+	}
+
+	slot->sequence = deltaCache.sequence;
+	slot->force = force;
+	slot->from = *from;
+	slot->to = *to;
+}
+
 /*
 =============
 SV_EmitPacketEntities
@@ -87,7 +238,7 @@ static void SV_EmitPacketEntities(clientSnapshot_t *from, clientSnapshot_t *to,
 			// delta update from old position
 			// because the force parm is qfalse, this will not result
 			// in any bytes being emitted if the entity has not changed at all
-			MSG_WriteDeltaEntity(msg, oldent, newent, qfalse);
+			SV_WriteDeltaEntity(msg, oldent, newent, qfalse);
 			oldindex++;
 			newindex++;
 			continue;
@@ -95,7 +246,7 @@ static void SV_EmitPacketEntities(clientSnapshot_t *from, clientSnapshot_t *to,
 
 		if (newnum < oldnum) {
 			// this is a new entity, send it from the baseline
-			MSG_WriteDeltaEntity(msg, &sv.svEntities[newnum].baseline, newent, qtrue);
+			SV_WriteDeltaEntity(msg, &sv.svEntities[newnum].baseline, newent, qtrue);
 			newindex++;
 			continue;
 		}
@@ -113,41 +264,58 @@ static void SV_EmitPacketEntities(clientSnapshot_t *from, clientSnapshot_t *to,
 
 /*
 ==================
-SV_WriteSnapshotToClient
+SV_SnapshotDeltaFrame
+
+Returns the previous frame to delta compress the current snapshot against,
+or NULL if a full snapshot has to be sent
 ==================
 */
-static void SV_WriteSnapshotToClient(client_t *client, msg_t *msg) {
-	clientSnapshot_t *frame, *oldframe;
-	int lastframe;
-	int i;
-	int snapFlags;
-
-	// this is the snapshot we are creating
-	frame = &client->frames[client->netchan.outgoingSequence & PACKET_MASK];
+static clientSnapshot_t *SV_SnapshotDeltaFrame(client_t *client, int *lastframe) {
+	clientSnapshot_t *oldframe;
 
 	// try to use a previous frame as the source for delta compressing the snapshot
 	if (client->deltaMessage <= 0 || client->state != CS_ACTIVE) {
 		// client is asking for a retransmit
 		oldframe = NULL;
-		lastframe = 0;
+		*lastframe = 0;
+	} else if (SV_DemoFullSnapshot(client)) {
+		// a demo of the client started after the frame was sent
+		oldframe = NULL;
+		*lastframe = 0;
 	} else if (client->netchan.outgoingSequence - client->deltaMessage >= (PACKET_BACKUP - 3)) {
 		// client hasn't gotten a good message through in a long time
 		Com_DPrintf("%s: Delta request from out of date packet.\n", client->name);
 		oldframe = NULL;
-		lastframe = 0;
+		*lastframe = 0;
 	} else {
 		// we have a valid snapshot to delta from
 		oldframe = &client->frames[client->deltaMessage & PACKET_MASK];
-		lastframe = client->netchan.outgoingSequence - client->deltaMessage;
+		*lastframe = client->netchan.outgoingSequence - client->deltaMessage;
 
 		// the snapshot's entities may still have rolled off the buffer, though
 		if (oldframe->first_entity <= svs.nextSnapshotEntities - svs.numSnapshotEntities) {
 			Com_DPrintf("%s: Delta request from out of date entities.\n", client->name);
 			oldframe = NULL;
-			lastframe = 0;
+			*lastframe = 0;
 		}
 	}
 
+	return oldframe;
+}
+
+/*
+==================
+SV_WriteSnapshotToClient
+==================
+*/
+static void SV_WriteSnapshotToClient(client_t *client, clientSnapshot_t *oldframe, int lastframe, msg_t *msg) {
+	clientSnapshot_t *frame;
+	int i;
+	int snapFlags;
+
+	// this is the snapshot we are creating
+	frame = &client->frames[client->netchan.outgoingSequence & PACKET_MASK];
+
 	MSG_WriteByte(msg, svc_snapshot);
 
 	// NOTE, MRE: now sent at the start of every message from server to client
@@ -207,17 +375,33 @@ static void SV_WriteSnapshotToClient(client_t *client, msg_t *msg) {
 ==================
 SV_UpdateServerCommandsToClient
 
-(re)send all server commands the client hasn't acknowledged yet
+(re)send all server commands the client hasn't acknowledged yet.
+Clients that negotiated NETCOMP_PACKEDCOMMANDS get them in svc_serverCommands
+runs instead of one svc_serverCommand per command.
 ==================
 */
 void SV_UpdateServerCommandsToClient(client_t *client, msg_t *msg) {
-	int i;
+	char cmd[MAX_STRING_CHARS];
+	int i, j, count;
 
 	// write any unacknowledged serverCommands
-	for (i = client->reliableAcknowledge + 1; i <= client->reliableSequence; i++) {
-		MSG_WriteByte(msg, svc_serverCommand);
-		MSG_WriteLong(msg, i);
-		MSG_WriteString(msg, client->reliableCommands[i & (MAX_RELIABLE_COMMANDS - 1)]);
+	for (i = client->reliableAcknowledge + 1; i <= client->reliableSequence; i += count) {
+		if (client->netchan.compression >= NETCOMP_PACKEDCOMMANDS) {
+			count = MIN(client->reliableSequence - i + 1, 255);
+			MSG_WriteByte(msg, svc_serverCommands);
+			MSG_WriteLong(msg, i);
+			MSG_WriteByte(msg, count);
+			for (j = 0; j < count; j++) {
+				SV_GetReliableCommand(client, i + j, cmd, sizeof(cmd));
+				MSG_WriteServerCommand(msg, cmd);
+			}
+		} else {
+			count = 1;
+			SV_GetReliableCommand(client, i, cmd, sizeof(cmd));
+			MSG_WriteByte(msg, svc_serverCommand);
+			MSG_WriteLong(msg, i);
+			MSG_WriteString(msg, cmd);
+		}
 	}
 	client->reliableSent = client->reliableSequence;
 }
@@ -232,7 +416,9 @@ Build a client snapshot structure
 
 typedef struct {
 	int numSnapshotEntities;
-	int snapshotEntities[MAX_SNAPSHOT_ENTITIES];
+	int snapshotEntities[MAX_GENTITIES]; // more than fit in a snapshot until SV_CullSnapshotEntities
+	byte added[MAX_GENTITIES / 8]; // prevents double adding from portal views
+	const char *error;			   // the list may be built on a worker thread, so Com_Error is deferred
 } snapshotEntityNumbers_t;
 
 /*
@@ -262,196 +448,622 @@ static int QDECL SV_QsortEntityNumbers(const void *a, const void *b) {
 SV_AddEntToSnapshot
 ===============
 */
-static void SV_AddEntToSnapshot(svEntity_t *svEnt, sharedEntity_t *gEnt, snapshotEntityNumbers_t *eNums) {
+static void SV_AddEntToSnapshot(int entityNum, snapshotEntityNumbers_t *eNums) {
 	// if we have already added this entity to this snapshot, don't add again
-	if (svEnt->snapshotCounter == sv.snapshotCounter) {
-		return;
-	}
-	svEnt->snapshotCounter = sv.snapshotCounter;
-
-	// if we are full, silently discard entities
-	if (eNums->numSnapshotEntities == MAX_SNAPSHOT_ENTITIES) {
+	if (eNums->added[entityNum >> 3] & (1 << (entityNum & 7))) {
 		return;
 	}
+	eNums->added[entityNum >> 3] |= 1 << (entityNum & 7);
 
-	eNums->snapshotEntities[eNums->numSnapshotEntities] = gEnt->s.number;
+	eNums->snapshotEntities[eNums->numSnapshotEntities] = entityNum;
 	eNums->numSnapshotEntities++;
 }
 
 /*
 ===============
-SV_AddEntitiesVisibleFromPoint
+SV_EntityInPVS
+
+The client independent part of the visibility test
 ===============
 */
-static void SV_AddEntitiesVisibleFromPoint(vec3_t origin, clientSnapshot_t *frame, snapshotEntityNumbers_t *eNums,
-										   qboolean portal) {
-	int e, i;
-	sharedEntity_t *ent;
-	svEntity_t *svEnt;
-	int l;
-	int clientarea, clientcluster;
-	int leafnum;
-	byte *clientpvs;
-	byte *bitvector;
-
-	// during an error shutdown message we may need to transmit
-	// the shutdown message after the server has shutdown, so
-	// specfically check for it
-	if (!sv.state) {
-		return;
+static qboolean SV_EntityInPVS(const svEntity_t *svEnt, int clientarea, const byte *clientpvs) {
+	int i, l;
+
+	// ignore if not touching a PV leaf
+	// check area
+	if (!CM_AreasConnected(clientarea, svEnt->areanum)) {
+		// doors can legally straddle two areas, so
+		// we may need to check another one
+		if (!CM_AreasConnected(clientarea, svEnt->areanum2)) {
+			return qfalse; // blocked by a door
+		}
 	}
 
-	leafnum = CM_PointLeafnum(origin);
-	clientarea = CM_LeafArea(leafnum);
-	clientcluster = CM_LeafCluster(leafnum);
+	// check individual leafs
+	if (!svEnt->numClusters) {
+		return qfalse;
+	}
+	l = 0;
+	for (i = 0; i < svEnt->numClusters; i++) {
+		l = svEnt->clusternums[i];
+		if (clientpvs[l >> 3] & (1 << (l & 7))) {
+			return qtrue;
+		}
+	}
 
-	// calculate the visible areas
-	frame->areabytes = CM_WriteAreaBits(frame->areabits, clientarea);
+	// if we haven't found it to be visible,
+	// check overflow clusters that coudln't be stored
+	if (svEnt->lastCluster) {
+		for (; l <= svEnt->lastCluster; l++) {
+			if (clientpvs[l >> 3] & (1 << (l & 7))) {
+				break;
+			}
+		}
+		if (l != svEnt->lastCluster) {
+			return qtrue;
+		}
+	}
 
-	clientpvs = CM_ClusterPVS(clientcluster);
+	return qfalse;
+}
 
-	for (e = 0; e < sv.num_entities; e++) {
-		ent = SV_GentityNum(e);
+/*
+===============
+SV_EntityHiddenFromClient
 
-		// never send entities that aren't linked in
-		if (!ent->r.linked) {
-			continue;
+Checks the flags that restrict an entity to some of the clients
+===============
+*/
+static qboolean SV_EntityHiddenFromClient(const sharedEntity_t *ent, int clientNum, snapshotEntityNumbers_t *eNums) {
+	// entities can be flagged to be sent to only one client
+	if (ent->r.svFlags & SVF_SINGLECLIENT) {
+		if (ent->r.singleClient != clientNum) {
+			return qtrue;
+		}
+	}
+	// entities can be flagged to be sent to everyone but one client
+	if (ent->r.svFlags & SVF_NOTSINGLECLIENT) {
+		if (ent->r.singleClient == clientNum) {
+			return qtrue;
+		}
+	}
+	// entities can be flagged to be sent to a given mask of clients
+	if (ent->r.svFlags & SVF_CLIENTMASK) {
+		if (clientNum >= 32) {
+			eNums->error = "SVF_CLIENTMASK: clientNum >= 32";
+			return qtrue;
 		}
+		if (~ent->r.singleClient & (1 << clientNum))
+			return qtrue;
+	}
 
-		if (ent->s.number != e) {
-			Com_DPrintf("FIXING ENT->S.NUMBER!!!\n");
-			ent->s.number = e;
+	return qfalse;
+}
+
+/*
+=============================================================================
+
+Per frame visibility cache
+
+Clients looking from the same cluster and area see the same entities,
+except for the ones restricted to some clients and whatever is visible
+through portals.  SV_SendClientMessages collects the viewpoints shared by
+more than one client before building the snapshots, and SV_AddEntitiesVisibleFromPoint
+then only has to apply the client specific flags to the cached list.
+Entries are read only while the snapshots are built, so they can be
+shared by the job threads.
+
+With sv_pvsCache 2 every viewpoint gets an entry, and all of them are
+filled in a single entity-major pass: for each entity the viewpoints
+that can see it are collected in a bitmask, using per-frame masks of the
+viewpoints that see each cluster and area.
+
+=============================================================================
+*/
+
+#define MAX_VIS_CACHE_ENTRIES MAX_CLIENTS
+
+typedef uint64_t viewMask_t; // one bit for each vis cache entry
+
+typedef struct {
+	int cluster;
+	int area;
+	int viewers;	// clients looking from here this frame
+	qboolean valid; // qfalse if a portal is visible, which depends on the exact origin
+	int numEntities;
+	short entities[MAX_GENTITIES];
+} visCacheEntry_t;
+
+static visCacheEntry_t visCache[MAX_VIS_CACHE_ENTRIES];
+static int numVisCacheEntries;
+
+/*
+===============
+SV_FindVisCacheEntry
+===============
+*/
+static visCacheEntry_t *SV_FindVisCacheEntry(int cluster, int area) {
+	int i;
+
+	for (i = 0; i < numVisCacheEntries; i++) {
+		if (visCache[i].cluster == cluster && visCache[i].area == area) {
+			return &visCache[i];
 		}
+	}
 
-		// entities can be flagged to explicitly not be sent to the client
-		if (ent->r.svFlags & SVF_NOCLIENT) {
+	return NULL;
+}
+
+/*
+===============
+SV_BuildVisCacheEntry
+===============
+*/
+static void SV_BuildVisCacheEntry(void *data, int index) {
+	visCacheEntry_t *entry = &((visCacheEntry_t *)data)[index];
+	const byte *clientpvs;
+	sharedEntity_t *ent;
+	int e;
+
+	clientpvs = CM_ClusterPVS(entry->cluster);
+	entry->numEntities = 0;
+	entry->valid = qtrue;
+
+	for (e = 0; e < sv.num_entities; e++) {
+		ent = SV_GentityNum(e);
+
+		if (!ent->r.linked || (ent->r.svFlags & SVF_NOCLIENT)) {
 			continue;
 		}
 
-		// entities can be flagged to be sent to only one client
-		if (ent->r.svFlags & SVF_SINGLECLIENT) {
-			if (ent->r.singleClient != frame->ps.clientNum) {
+		if (!(ent->r.svFlags & SVF_BROADCAST)) {
+			if (!SV_EntityInPVS(&sv.svEntities[e], entry->area, clientpvs)) {
 				continue;
 			}
-		}
-		// entities can be flagged to be sent to everyone but one client
-		if (ent->r.svFlags & SVF_NOTSINGLECLIENT) {
-			if (ent->r.singleClient == frame->ps.clientNum) {
-				continue;
+			if (ent->r.svFlags & SVF_PORTAL) {
+				entry->valid = qfalse;
+				return;
 			}
 		}
-		// entities can be flagged to be sent to a given mask of clients
-		if (ent->r.svFlags & SVF_CLIENTMASK) {
-			if (frame->ps.clientNum >= 32)
-				Com_Error(ERR_DROP, "SVF_CLIENTMASK: clientNum >= 32");
-			if (~ent->r.singleClient & (1 << frame->ps.clientNum))
-				continue;
-		}
 
-		svEnt = SV_SvEntityForGentity(ent);
+		entry->entities[entry->numEntities++] = e;
+	}
+}
+
+/*
+===============
+SV_AreaViewers
 
-		// don't double add an entity through portals
-		if (svEnt->snapshotCounter == sv.snapshotCounter) {
-			continue;
+Returns the viewpoints whose area is connected to the given one
+===============
+*/
+static viewMask_t SV_AreaViewers(int area, viewMask_t *areaMasks, byte *areaKnown) {
+	viewMask_t mask;
+	int slot, v;
+
+	// -1 is used a lot for areanum2, so it gets a slot as well
+	slot = area + 1;
+	if (slot < 0 || slot > MAX_MAP_AREAS || !areaKnown[slot]) {
+		mask = 0;
+		for (v = 0; v < numVisCacheEntries; v++) {
+			if (CM_AreasConnected(visCache[v].area, area)) {
+				mask |= (viewMask_t)1 << v;
+			}
 		}
-
-		// broadcast entities are always sent
-		if (ent->r.svFlags & SVF_BROADCAST) {
-			SV_AddEntToSnapshot(svEnt, ent, eNums);
-			continue;
+		if (slot < 0 || slot > MAX_MAP_AREAS) {
+			return mask;
 		}
+		areaMasks[slot] = mask;
+		areaKnown[slot] = 1;
+	}
+
+	return areaMasks[slot];
+}
+
+/*
+===============
+SV_ClusterViewers
 
-		// ignore if not touching a PV leaf
-		// check area
-		if (!CM_AreasConnected(clientarea, svEnt->areanum)) {
-			// doors can legally straddle two areas, so
-			// we may need to check another one
-			if (!CM_AreasConnected(clientarea, svEnt->areanum2)) {
-				continue; // blocked by a door
+Returns the viewpoints whose PVS contains the given cluster
+===============
+*/
+static viewMask_t SV_ClusterViewers(int cluster, const byte **pvs, viewMask_t *clusterMasks, byte *clusterKnown) {
+	viewMask_t mask;
+	int v;
+
+	if (!clusterKnown[cluster]) {
+		mask = 0;
+		for (v = 0; v < numVisCacheEntries; v++) {
+			if (pvs[v][cluster >> 3] & (1 << (cluster & 7))) {
+				mask |= (viewMask_t)1 << v;
 			}
 		}
+		clusterMasks[cluster] = mask;
+		clusterKnown[cluster] = 1;
+	}
+
+	return clusterMasks[cluster];
+}
+
+/*
+===============
+SV_FillVisCacheEntityMajor
+===============
+*/
+static void SV_FillVisCacheEntityMajor(void) {
+	static viewMask_t areaMasks[MAX_MAP_AREAS + 1];
+	static byte areaKnown[MAX_MAP_AREAS + 1];
+	const byte *pvs[MAX_VIS_CACHE_ENTRIES];
+	viewMask_t *clusterMasks;
+	byte *clusterKnown;
+	viewMask_t allViewers, mask, clusters;
+	sharedEntity_t *ent;
+	svEntity_t *svEnt;
+	int numClusters;
+	int e, i, v;
+
+	numClusters = CM_NumClusters();
+	clusterMasks = Hunk_AllocateTempMemory((numClusters + 1) * sizeof(*clusterMasks));
+	clusterKnown = Hunk_AllocateTempMemory(numClusters + 1);
+	Com_Memset(clusterKnown, 0, numClusters + 1);
+	Com_Memset(areaKnown, 0, sizeof(areaKnown));
+
+	allViewers = 0;
+	for (v = 0; v < numVisCacheEntries; v++) {
+		pvs[v] = CM_ClusterPVS(visCache[v].cluster);
+		visCache[v].numEntities = 0;
+		visCache[v].valid = qtrue;
+		allViewers |= (viewMask_t)1 << v;
+	}
 
-		bitvector = clientpvs;
+	for (e = 0; e < sv.num_entities; e++) {
+		ent = SV_GentityNum(e);
 
-		// check individual leafs
-		if (!svEnt->numClusters) {
+		if (!ent->r.linked || (ent->r.svFlags & SVF_NOCLIENT)) {
 			continue;
 		}
-		l = 0;
-		for (i = 0; i < svEnt->numClusters; i++) {
-			l = svEnt->clusternums[i];
-			if (bitvector[l >> 3] & (1 << (l & 7))) {
-				break;
+
+		svEnt = &sv.svEntities[e];
+
+		if (ent->r.svFlags & SVF_BROADCAST) {
+			mask = allViewers;
+		} else {
+			mask = SV_AreaViewers(svEnt->areanum, areaMasks, areaKnown) |
+				   SV_AreaViewers(svEnt->areanum2, areaMasks, areaKnown);
+			if (!mask || !svEnt->numClusters) {
+				continue;
 			}
-		}
 
-		// if we haven't found it to be visible,
-		// check overflow clusters that coudln't be stored
-		if (i == svEnt->numClusters) {
 			if (svEnt->lastCluster) {
-				for (; l <= svEnt->lastCluster; l++) {
-					if (bitvector[l >> 3] & (1 << (l & 7))) {
-						break;
+				// too many clusters to be stored, this is rare enough to test one by one
+				for (v = 0; v < numVisCacheEntries; v++) {
+					if ((mask & ((viewMask_t)1 << v)) && !SV_EntityInPVS(svEnt, visCache[v].area, pvs[v])) {
+						mask &= ~((viewMask_t)1 << v);
 					}
 				}
-				if (l == svEnt->lastCluster) {
-					continue; // not visible
-				}
 			} else {
-				continue;
+				clusters = 0;
+				for (i = 0; i < svEnt->numClusters && (mask & ~clusters); i++) {
+					if (svEnt->clusternums[i] < numClusters) {
+						clusters |= SV_ClusterViewers(svEnt->clusternums[i], pvs, clusterMasks, clusterKnown);
+					}
+				}
+				mask &= clusters;
 			}
-		}
-
-		// add it
-		SV_AddEntToSnapshot(svEnt, ent, eNums);
 
-		// if it's a portal entity, add everything visible from its camera position
-		if (ent->r.svFlags & SVF_PORTAL) {
-			if (ent->s.generic1) {
-				vec3_t dir;
-				VectorSubtract(ent->s.origin, origin, dir);
-				if (VectorLengthSquared(dir) > (float)ent->s.generic1 * ent->s.generic1) {
-					continue;
+			if (mask && (ent->r.svFlags & SVF_PORTAL)) {
+				for (v = 0; v < numVisCacheEntries; v++) {
+					if (mask & ((viewMask_t)1 << v)) {
+						visCache[v].valid = qfalse;
+					}
 				}
 			}
-			SV_AddEntitiesVisibleFromPoint(ent->s.origin2, frame, eNums, qtrue);
+		}
+
+		for (v = 0; mask; v++, mask >>= 1) {
+			if (mask & 1) {
+				visCache[v].entities[visCache[v].numEntities++] = e;
+			}
 		}
 	}
+
+	Hunk_FreeTempMemory(clusterKnown);
+	Hunk_FreeTempMemory(clusterMasks);
 }
 
 /*
-=============
-SV_BuildClientSnapshot
+===============
+SV_BuildVisCache
 
-Decides which entities are going to be visible to the client, and
+Finds the viewpoints shared by several of the clients that get a snapshot this frame
+===============
+*/
+static void SV_BuildVisCache(client_t **clients, int numClients) {
+	playerState_t *ps;
+	visCacheEntry_t *entry;
+	vec3_t org;
+	int leafnum, cluster, area;
+	int i, numShared;
+
+	numVisCacheEntries = 0;
+
+	if (!sv_pvsCache->integer || !sv.state || (numClients < 2 && sv_pvsCache->integer != 2)) {
+		return;
+	}
+
+	for (i = 0; i < numClients; i++) {
+		if (!clients[i]->gentity || clients[i]->state == CS_ZOMBIE) {
+			continue;
+		}
+
+		// same viewpoint as SV_BuildClientEntityNumbers
+		ps = SV_GameClientNum(clients[i] - svs.clients);
+		VectorCopy(ps->origin, org);
+		org[2] += ps->viewheight;
+
+		leafnum = CM_PointLeafnum(org);
+		cluster = CM_LeafCluster(leafnum);
+		area = CM_LeafArea(leafnum);
+
+		entry = SV_FindVisCacheEntry(cluster, area);
+		if (!entry) {
+			entry = &visCache[numVisCacheEntries++];
+			entry->cluster = cluster;
+			entry->area = area;
+			entry->viewers = 0;
+		}
+		entry->viewers++;
+	}
+
+	if (sv_pvsCache->integer == 2) {
+		SV_FillVisCacheEntityMajor();
+		return;
+	}
+
+	// a viewpoint that is used only once is not worth caching
+	for (i = 0, numShared = 0; i < numVisCacheEntries; i++) {
+		if (visCache[i].viewers > 1) {
+			if (i != numShared) {
+				visCache[numShared].cluster = visCache[i].cluster;
+				visCache[numShared].area = visCache[i].area;
+				visCache[numShared].viewers = visCache[i].viewers;
+			}
+			numShared++;
+		}
+	}
+	numVisCacheEntries = numShared;
+
+	Com_RunJobs(SV_BuildVisCacheEntry, visCache, numVisCacheEntries, sv_snapshotThreads->integer);
+}
+
+/*
+===============
+SV_AddEntitiesVisibleFromPoint
+===============
+*/
+static void SV_AddEntitiesVisibleFromPoint(vec3_t origin, clientSnapshot_t *frame, snapshotEntityNumbers_t *eNums,
+										   qboolean portal) {
+	int e, i;
+	sharedEntity_t *ent;
+	int clientarea, clientcluster;
+	int leafnum;
+	byte *clientpvs;
+	visCacheEntry_t *entry;
+
+	// during an error shutdown message we may need to transmit
+	// the shutdown message after the server has shutdown, so
+	// specfically check for it
+	if (!sv.state) {
+		return;
+	}
+
+	leafnum = CM_PointLeafnum(origin);
+	clientarea = CM_LeafArea(leafnum);
+	clientcluster = CM_LeafCluster(leafnum);
+
+	// calculate the visible areas
+	frame->areabytes = CM_WriteAreaBits(frame->areabits, clientarea);
+
+	entry = SV_FindVisCacheEntry(clientcluster, clientarea);
+	if (entry && entry->valid) {
+		for (i = 0; i < entry->numEntities; i++) {
+			e = entry->entities[i];
+			ent = SV_GentityNum(e);
+
+			if (SV_EntityHiddenFromClient(ent, frame->ps.clientNum, eNums)) {
+				if (eNums->error) {
+					return;
+				}
+				continue;
+			}
+
+			SV_AddEntToSnapshot(e, eNums);
+		}
+		return;
+	}
+
+	clientpvs = CM_ClusterPVS(clientcluster);
+
+	for (e = 0; e < sv.num_entities; e++) {
+		ent = SV_GentityNum(e);
+
+		// never send entities that aren't linked in
+		if (!ent->r.linked) {
+			continue;
+		}
+
+		if (ent->s.number != e) {
+			Com_DPrintf("FIXING ENT->S.NUMBER!!!\n");
+			ent->s.number = e;
+		}
+
+		// entities can be flagged to explicitly not be sent to the client
+		if (ent->r.svFlags & SVF_NOCLIENT) {
+			continue;
+		}
+
+		if (SV_EntityHiddenFromClient(ent, frame->ps.clientNum, eNums)) {
+			if (eNums->error) {
+				return;
+			}
+			continue;
+		}
+
+		// don't double add an entity through portals
+		if (eNums->added[e >> 3] & (1 << (e & 7))) {
+			continue;
+		}
+
+		// broadcast entities are always sent
+		if (ent->r.svFlags & SVF_BROADCAST) {
+			SV_AddEntToSnapshot(e, eNums);
+			continue;
+		}
+
+		if (!SV_EntityInPVS(&sv.svEntities[e], clientarea, clientpvs)) {
+			continue;
+		}
+
+		// add it
+		SV_AddEntToSnapshot(e, eNums);
+
+		// if it's a portal entity, add everything visible from its camera position
+		if (ent->r.svFlags & SVF_PORTAL) {
+			if (ent->s.generic1) {
+				vec3_t dir;
+				VectorSubtract(ent->s.origin, origin, dir);
+				if (VectorLengthSquared(dir) > (float)ent->s.generic1 * ent->s.generic1) {
+					continue;
+				}
+			}
+			SV_AddEntitiesVisibleFromPoint(ent->s.origin2, frame, eNums, qtrue);
+			if (eNums->error) {
+				return;
+			}
+		}
+	}
+}
+
+/*
+=============
+SV_CullSnapshotEntities
+
+When more entities are visible than fit in a snapshot, keeps the ones that
+matter most to the client instead of the lowest numbered ones.  Broadcast
+and portal entities always stay.  The others are ordered by their distance
+to the viewer, which counts four times for entities that neither are
+players nor move, and twice for entities the client doesn't have yet, as
+those have to be sent in full.
+=============
+*/
+
+typedef struct {
+	int number;
+	float priority; // lower goes first
+} snapshotEntityPriority_t;
+
+static int QDECL SV_QsortEntityPriorities(const void *a, const void *b) {
+	const snapshotEntityPriority_t *ea = (const snapshotEntityPriority_t *)a;
+	const snapshotEntityPriority_t *eb = (const snapshotEntityPriority_t *)b;
+
+	if (ea->priority < eb->priority) {
+		return -1;
+	}
+	if (ea->priority > eb->priority) {
+		return 1;
+	}
+	return ea->number - eb->number;
+}
+
+static void SV_CullSnapshotEntities(client_t *client, const vec3_t org, snapshotEntityNumbers_t *eNums) {
+	snapshotEntityPriority_t priorities[MAX_GENTITIES];
+	byte seen[MAX_GENTITIES / 8];
+	clientSnapshot_t *oldframe;
+	sharedEntity_t *ent;
+	vec3_t center, dir;
+	float priority;
+	int i, e, maxEntities;
+
+	maxEntities = sv_snapshotEntities->integer;
+	if (maxEntities < 1 || maxEntities > MAX_SNAPSHOT_ENTITIES) {
+		maxEntities = MAX_SNAPSHOT_ENTITIES;
+	}
+	if (eNums->numSnapshotEntities <= maxEntities) {
+		return;
+	}
+
+	// the entities of the snapshot the client acknowledged last, this only
+	// reads ranges of svs.snapshotEntities that are not handed out again
+	// until all snapshots of the frame are built
+	Com_Memset(seen, 0, sizeof(seen));
+	if (client->deltaMessage > 0 && client->netchan.outgoingSequence - client->deltaMessage < PACKET_BACKUP - 3) {
+		oldframe = &client->frames[client->deltaMessage & PACKET_MASK];
+		if (oldframe->first_entity > svs.nextSnapshotEntities - svs.numSnapshotEntities) {
+			for (i = 0; i < oldframe->num_entities; i++) {
+				e = svs.snapshotEntities[(oldframe->first_entity + i) % svs.numSnapshotEntities].number;
+				seen[e >> 3] |= 1 << (e & 7);
+			}
+		}
+	}
+
+	for (i = 0; i < eNums->numSnapshotEntities; i++) {
+		e = eNums->snapshotEntities[i];
+		ent = SV_GentityNum(e);
+
+		if (ent->r.svFlags & (SVF_BROADCAST | SVF_PORTAL)) {
+			priority = -1.0f;
+		} else {
+			VectorAdd(ent->r.absmin, ent->r.absmax, center);
+			VectorScale(center, 0.5f, center);
+			VectorSubtract(center, org, dir);
+			priority = VectorLength(dir);
+
+			if (e >= sv_maxclients->integer && ent->s.pos.trType == TR_STATIONARY) {
+				priority *= 4.0f;
+			}
+			if (!(seen[e >> 3] & (1 << (e & 7)))) {
+				priority *= 2.0f;
+			}
+		}
+
+		priorities[i].number = e;
+		priorities[i].priority = priority;
+	}
+
+	qsort(priorities, eNums->numSnapshotEntities, sizeof(priorities[0]), SV_QsortEntityPriorities);
+
+	for (i = 0; i < maxEntities; i++) {
+		eNums->snapshotEntities[i] = priorities[i].number;
+	}
+	eNums->numSnapshotEntities = maxEntities;
+}
+
+/*
+=============
+SV_BuildClientEntityNumbers
+
+Decides which entities are going to be visible to the client, and
 copies off the playerstate and areabits.
 
 This properly handles multiple recursive portals, but the render
 currently doesn't.
 
 For viewing through other player's eyes, clent can be something other than client->gentity
+
+Only touches the client's own frame and eNums, so it may run on a worker thread.
 =============
 */
-static void SV_BuildClientSnapshot(client_t *client) {
+static void SV_BuildClientEntityNumbers(client_t *client, clientSnapshot_t *frame, snapshotEntityNumbers_t *eNums) {
 	vec3_t org;
-	clientSnapshot_t *frame;
-	snapshotEntityNumbers_t entityNumbers;
 	int i;
-	sharedEntity_t *ent;
-	entityState_t *state;
-	svEntity_t *svEnt;
 	sharedEntity_t *clent;
 	int clientNum;
 	playerState_t *ps;
 
-	// bump the counter used to prevent double adding
-	sv.snapshotCounter++;
-
-	// this is the frame we are creating
-	frame = &client->frames[client->netchan.outgoingSequence & PACKET_MASK];
-
 	// clear everything in this snapshot
-	entityNumbers.numSnapshotEntities = 0;
+	eNums->numSnapshotEntities = 0;
+	eNums->error = NULL;
+	Com_Memset(eNums->added, 0, sizeof(eNums->added));
 	Com_Memset(frame->areabits, 0, sizeof(frame->areabits));
 
 	// https://zerowing.idsoftware.com/bugzilla/show_bug.cgi?id=62
@@ -470,11 +1082,10 @@ static void SV_BuildClientSnapshot(client_t *client) {
 	// be regenerated from the playerstate
 	clientNum = frame->ps.clientNum;
 	if (clientNum < 0 || clientNum >= MAX_GENTITIES) {
-		Com_Error(ERR_DROP, "SV_SvEntityForGentity: bad gEnt");
+		eNums->error = "SV_SvEntityForGentity: bad gEnt";
+		return;
 	}
-	svEnt = &sv.svEntities[clientNum];
-
-	svEnt->snapshotCounter = sv.snapshotCounter;
+	eNums->added[clientNum >> 3] |= 1 << (clientNum & 7);
 
 	// find the client's viewpoint
 	VectorCopy(ps->origin, org);
@@ -482,13 +1093,18 @@ static void SV_BuildClientSnapshot(client_t *client) {
 
 	// add all the entities directly visible to the eye, which
 	// may include portal entities that merge other viewpoints
-	SV_AddEntitiesVisibleFromPoint(org, frame, &entityNumbers, qfalse);
+	SV_AddEntitiesVisibleFromPoint(org, frame, eNums, qfalse);
+	if (eNums->error) {
+		return;
+	}
+
+	SV_CullSnapshotEntities(client, org, eNums);
 
 	// if there were portals visible, there may be out of order entities
 	// in the list which will need to be resorted for the delta compression
 	// to work correctly.  This also catches the error condition
 	// of an entity being included twice.
-	qsort(entityNumbers.snapshotEntities, entityNumbers.numSnapshotEntities, sizeof(entityNumbers.snapshotEntities[0]),
+	qsort(eNums->snapshotEntities, eNums->numSnapshotEntities, sizeof(eNums->snapshotEntities[0]),
 		  SV_QsortEntityNumbers);
 
 	// now that all viewpoint's areabits have been OR'd together, invert
@@ -496,23 +1112,70 @@ static void SV_BuildClientSnapshot(client_t *client) {
 	for (i = 0; i < MAX_MAP_AREA_BYTES / 4; i++) {
 		((int *)frame->areabits)[i] = ((int *)frame->areabits)[i] ^ -1;
 	}
+}
 
-	// copy the entity states out
-	frame->num_entities = 0;
-	frame->first_entity = svs.nextSnapshotEntities;
-	for (i = 0; i < entityNumbers.numSnapshotEntities; i++) {
-		ent = SV_GentityNum(entityNumbers.snapshotEntities[i]);
-		state = &svs.snapshotEntities[svs.nextSnapshotEntities % svs.numSnapshotEntities];
+/*
+=============
+SV_AllocSnapshotEntities
+
+Reserves a range of the circular svs.snapshotEntities for a frame
+=============
+*/
+static int SV_AllocSnapshotEntities(int numEntities) {
+	int first;
+
+	first = svs.nextSnapshotEntities;
+	svs.nextSnapshotEntities += numEntities;
+	// this should never hit, map should always be restarted first in SV_Frame
+	if (svs.nextSnapshotEntities >= 0x7FFFFFFE) {
+		Com_Error(ERR_FATAL, "svs.nextSnapshotEntities wrapped");
+	}
+
+	return first;
+}
+
+/*
+=============
+SV_CopySnapshotEntities
+
+Copies the entity states out into a range reserved by SV_AllocSnapshotEntities
+=============
+*/
+static void SV_CopySnapshotEntities(clientSnapshot_t *frame, const snapshotEntityNumbers_t *eNums, int first) {
+	sharedEntity_t *ent;
+	entityState_t *state;
+	int i;
+
+	frame->first_entity = first;
+	frame->num_entities = eNums->numSnapshotEntities;
+	for (i = 0; i < eNums->numSnapshotEntities; i++) {
+		ent = SV_GentityNum(eNums->snapshotEntities[i]);
+		state = &svs.snapshotEntities[(first + i) % svs.numSnapshotEntities];
 		*state = ent->s;
-		svs.nextSnapshotEntities++;
-		// this should never hit, map should always be restarted first in SV_Frame
-		if (svs.nextSnapshotEntities >= 0x7FFFFFFE) {
-			Com_Error(ERR_FATAL, "svs.nextSnapshotEntities wrapped");
-		}
-		frame->num_entities++;
 	}
 }
 
+/*
+=============
+SV_BuildClientSnapshot
+=============
+*/
+static void SV_BuildClientSnapshot(client_t *client) {
+	clientSnapshot_t *frame;
+	snapshotEntityNumbers_t entityNumbers;
+
+	// this is the frame we are creating
+	frame = &client->frames[client->netchan.outgoingSequence & PACKET_MASK];
+
+	SV_BuildClientEntityNumbers(client, frame, &entityNumbers);
+	if (entityNumbers.error) {
+		numVisCacheEntries = 0;
+		Com_Error(ERR_DROP, "%s", entityNumbers.error);
+	}
+
+	SV_CopySnapshotEntities(frame, &entityNumbers, SV_AllocSnapshotEntities(entityNumbers.numSnapshotEntities));
+}
+
 #ifdef USE_VOIP
 /*
 ==================
@@ -525,11 +1188,13 @@ static void SV_WriteVoipToClient(client_t *cl, msg_t *msg) {
 	int totalbytes = 0;
 	int i;
 	voipServerPacket_t *packet;
+	int flags;
 
 	if (cl->queuedVoipPackets) {
 		// Write as many VoIP packets as we reasonably can...
 		for (i = 0; i < cl->queuedVoipPackets; i++) {
 			packet = cl->voipPacket[(i + cl->queuedVoipIndex) % ARRAY_LEN(cl->voipPacket)];
+			flags = cl->voipPacketFlags[(i + cl->queuedVoipIndex) % ARRAY_LEN(cl->voipPacket)];
 
 			if (!*cl->downloadName) {
 				totalbytes += packet->len;
@@ -542,11 +1207,11 @@ static void SV_WriteVoipToClient(client_t *cl, msg_t *msg) {
 				MSG_WriteLong(msg, packet->sequence);
 				MSG_WriteByte(msg, packet->frames);
 				MSG_WriteShort(msg, packet->len);
-				MSG_WriteBits(msg, packet->flags, VOIP_FLAGCNT);
+				MSG_WriteBits(msg, flags, VOIP_FLAGCNT);
 				MSG_WriteData(msg, packet->data, packet->len);
 			}
 
-			Z_Free(packet);
+			SV_ReleaseVoipPacket(packet);
 		}
 
 		cl->queuedVoipPackets -= i;
@@ -566,11 +1231,149 @@ Called by SV_SendClientSnapshot and SV_SendClientGameState
 void SV_SendMessageToClient(msg_t *msg, client_t *client) {
 	// record information about the message
 	client->frames[client->netchan.outgoingSequence & PACKET_MASK].messageSize = msg->cursize;
-	client->frames[client->netchan.outgoingSequence & PACKET_MASK].messageSent = svs.time;
+	client->frames[client->netchan.outgoingSequence & PACKET_MASK].messageSent = Sys_Milliseconds();
 	client->frames[client->netchan.outgoingSequence & PACKET_MASK].messageAcked = -1;
 
 	// send the datagram
+	SV_BENCH_BEGIN(SVB_NETWORK);
 	SV_Netchan_Transmit(client, msg);
+	SV_BENCH_END();
+}
+
+/*
+=======================
+SV_BeginSnapshotMessage
+
+Writes everything but the VoIP data of a snapshot message
+=======================
+*/
+static void SV_BeginSnapshotMessage(client_t *client, clientSnapshot_t *oldframe, int lastframe, msg_t *msg) {
+	// NOTE, MRE: all server->client messages now acknowledge
+	// let the client know which reliable clientCommands we have received
+	MSG_WriteLong(msg, client->lastClientCommand);
+
+	// (re)send any reliable server commands
+	SV_UpdateServerCommandsToClient(client, msg);
+
+	// send over all the relevant entityState_t
+	// and the playerState_t
+	SV_WriteSnapshotToClient(client, oldframe, lastframe, msg);
+}
+
+/*
+=======================
+SV_FinishSnapshotMessage
+=======================
+*/
+static void SV_FinishSnapshotMessage(client_t *client, msg_t *msg) {
+#ifdef USE_VOIP
+	SV_WriteVoipToClient(client, msg);
+#endif
+
+	// check for overflow
+	if (msg->overflowed) {
+		Com_Printf("WARNING: msg overflowed for %s\n", client->name);
+		MSG_Clear(msg);
+	}
+
+	svMetrics.snapshots++;
+	svMetrics.snapshotBytes += msg->cursize;
+
+	SV_SendMessageToClient(msg, client);
+}
+
+/*
+=============================================================================
+
+Huffman statistics
+
+With sv_huffCapture set the bytes of the snapshot messages are counted on
+their way into the huffman coder, huffstats writes them out as a table for
+net_huffTable.
+
+=============================================================================
+*/
+
+static unsigned svHuffCounts[256];
+
+/*
+=============
+SV_AddHuffCounts
+=============
+*/
+static void SV_AddHuffCounts(const unsigned *counts) {
+	int i;
+
+	for (i = 0; i < 256; i++) {
+		svHuffCounts[i] += counts[i];
+	}
+}
+
+/*
+=============
+SV_SnapshotHuffTable
+
+Demos only hold default table messages
+=============
+*/
+static int SV_SnapshotHuffTable(const client_t *client) {
+	if (SV_DemoRecordingClient(client)) {
+		return MSG_HUFF_DEFAULT;
+	}
+	return client->huffTable;
+}
+
+/*
+=============
+SV_HuffStats_f
+=============
+*/
+void SV_HuffStats_f(void) {
+	fileHandle_t f;
+	double total;
+	int i, version;
+
+	if (!Q_stricmp(Cmd_Argv(1), "clear")) {
+		Com_Memset(svHuffCounts, 0, sizeof(svHuffCounts));
+		return;
+	}
+
+	total = 0;
+	for (i = 0; i < 256; i++) {
+		total += svHuffCounts[i];
+	}
+
+	if (Cmd_Argc() != 3) {
+		Com_Printf("usage: huffstats [clear | <file> <version>]\n");
+		Com_Printf("%.0f snapshot bytes captured\n", total);
+		return;
+	}
+
+	version = atoi(Cmd_Argv(2));
+	if (version <= 0) {
+		Com_Printf("The table version must be positive.\n");
+		return;
+	}
+
+	if (!total) {
+		Com_Printf("Nothing captured, set sv_huffCapture 1 first.\n");
+		return;
+	}
+
+	f = FS_FOpenFileWrite(Cmd_Argv(1));
+	if (!f) {
+		Com_Printf("ERROR: couldn't open %s.\n", Cmd_Argv(1));
+		return;
+	}
+
+	// scaled so the weights stay in the range MSG_LoadHuffTable accepts
+	FS_Printf(f, "// %.0f snapshot bytes captured\nversion %i\n", total, version);
+	for (i = 0; i < 256; i++) {
+		FS_Printf(f, "%i\n", MAX(1, (int)(svHuffCounts[i] * (MSG_HUFF_MAXCOUNT / total))));
+	}
+	FS_FCloseFile(f);
+
+	Com_Printf("Wrote %s, version %i.\n", Cmd_Argv(1), version);
 }
 
 /*
@@ -584,6 +1387,8 @@ Also called by SV_FinalMessage
 void SV_SendClientSnapshot(client_t *client) {
 	byte msg_buf[MAX_MSGLEN];
 	msg_t msg;
+	clientSnapshot_t *oldframe;
+	int lastframe;
 
 	// build the snapshot
 	SV_BuildClientSnapshot(client);
@@ -596,29 +1401,148 @@ void SV_SendClientSnapshot(client_t *client) {
 
 	MSG_Init(&msg, msg_buf, sizeof(msg_buf));
 	msg.allowoverflow = qtrue;
+	msg.huffTable = SV_SnapshotHuffTable(client);
+	if (sv_huffCapture->integer) {
+		msg.symbolCounts = svHuffCounts;
+	}
 
-	// NOTE, MRE: all server->client messages now acknowledge
-	// let the client know which reliable clientCommands we have received
-	MSG_WriteLong(&msg, client->lastClientCommand);
+	oldframe = SV_SnapshotDeltaFrame(client, &lastframe);
+	SV_BeginSnapshotMessage(client, oldframe, lastframe, &msg);
+	SV_FinishSnapshotMessage(client, &msg);
+}
 
-	// (re)send any reliable server commands
-	SV_UpdateServerCommandsToClient(client, &msg);
+/*
+=============================================================================
 
-	// send over all the relevant entityState_t
-	// and the playerState_t
-	SV_WriteSnapshotToClient(client, &msg);
+Threaded snapshot building
 
-#ifdef USE_VOIP
-	SV_WriteVoipToClient(client, &msg);
-#endif
+With sv_snapshotThreads > 1 the entity lists of all clients are gathered
+and their messages are delta encoded on the job threads.  The parts that
+touch shared state (reserving the svs.snapshotEntities ranges, picking the
+delta frames, VoIP and the netchan) stay on the main thread.
 
-	// check for overflow
-	if (msg.overflowed) {
-		Com_Printf("WARNING: msg overflowed for %s\n", client->name);
-		MSG_Clear(&msg);
+=============================================================================
+*/
+
+typedef struct {
+	client_t *client;
+	qboolean isBot;
+	clientSnapshot_t *oldframe;
+	int lastframe;
+	int firstEntity;
+	snapshotEntityNumbers_t entityNumbers;
+	msg_t msg;
+	byte msgBuf[MAX_MSGLEN];
+	unsigned symbolCounts[256]; // sv_huffCapture counts, added up on the main thread
+} snapshotJob_t;
+
+/*
+=======================
+SV_BuildSnapshotJob
+=======================
+*/
+static void SV_BuildSnapshotJob(void *data, int index) {
+	snapshotJob_t *job = &((snapshotJob_t *)data)[index];
+	client_t *client = job->client;
+
+	SV_BuildClientEntityNumbers(client, &client->frames[client->netchan.outgoingSequence & PACKET_MASK],
+								&job->entityNumbers);
+}
+
+/*
+=======================
+SV_WriteSnapshotJob
+=======================
+*/
+static void SV_WriteSnapshotJob(void *data, int index) {
+	snapshotJob_t *job = &((snapshotJob_t *)data)[index];
+	client_t *client = job->client;
+
+	SV_CopySnapshotEntities(&client->frames[client->netchan.outgoingSequence & PACKET_MASK], &job->entityNumbers,
+							job->firstEntity);
+
+	if (job->isBot) {
+		return;
 	}
 
-	SV_SendMessageToClient(&msg, client);
+	SV_BeginSnapshotMessage(client, job->oldframe, job->lastframe, &job->msg);
+}
+
+/*
+=======================
+SV_SendClientSnapshots
+
+Threaded version of calling SV_SendClientSnapshot for each of the clients
+=======================
+*/
+static void SV_SendClientSnapshots(client_t **clients, int numClients, int numThreads) {
+	snapshotJob_t *snapshotJobs, *job;
+	int i;
+
+	snapshotJobs = Com_ScratchAlloc(numClients * sizeof(*snapshotJobs));
+	for (i = 0; i < numClients; i++) {
+		snapshotJobs[i].client = clients[i];
+	}
+
+	Com_RunJobs(SV_BuildSnapshotJob, snapshotJobs, numClients, numThreads);
+
+	// hand out disjoint ranges of the entity ring, the delta frames can only
+	// be picked once all of them are reserved, since a frame that is going
+	// to be overwritten this time must not be used as a delta source
+	for (i = 0, job = snapshotJobs; i < numClients; i++, job++) {
+		if (job->entityNumbers.error) {
+			numVisCacheEntries = 0;
+			Com_Error(ERR_DROP, "%s", job->entityNumbers.error);
+		}
+		job->firstEntity = SV_AllocSnapshotEntities(job->entityNumbers.numSnapshotEntities);
+	}
+
+	for (i = 0, job = snapshotJobs; i < numClients; i++, job++) {
+		job->isBot = job->client->gentity && (job->client->gentity->r.svFlags & SVF_BOT);
+		if (job->isBot) {
+			continue;
+		}
+		MSG_Init(&job->msg, job->msgBuf, sizeof(job->msgBuf));
+		job->msg.allowoverflow = qtrue;
+		job->msg.huffTable = SV_SnapshotHuffTable(job->client);
+		if (sv_huffCapture->integer) {
+			Com_Memset(job->symbolCounts, 0, sizeof(job->symbolCounts));
+			job->msg.symbolCounts = job->symbolCounts;
+		}
+		job->oldframe = SV_SnapshotDeltaFrame(job->client, &job->lastframe);
+	}
+
+	Com_RunJobs(SV_WriteSnapshotJob, snapshotJobs, numClients, numThreads);
+
+	for (i = 0, job = snapshotJobs; i < numClients; i++, job++) {
+		if (!job->isBot) {
+			SV_FinishSnapshotMessage(job->client, &job->msg);
+			if (job->msg.symbolCounts) {
+				SV_AddHuffCounts(job->symbolCounts);
+			}
+		}
+	}
+}
+
+/*
+=======================
+SV_FixEntityNumbers
+
+SV_AddEntitiesVisibleFromPoint fixes these up as well, but neither the
+job threads nor the visibility cache may write to the entities
+=======================
+*/
+static void SV_FixEntityNumbers(void) {
+	sharedEntity_t *ent;
+	int i;
+
+	for (i = 0; i < sv.num_entities; i++) {
+		ent = SV_GentityNum(i);
+		if (ent->r.linked && ent->s.number != i) {
+			Com_DPrintf("FIXING ENT->S.NUMBER!!!\n");
+			ent->s.number = i;
+		}
+	}
 }
 
 /*
@@ -629,8 +1553,15 @@ SV_SendClientMessages
 void SV_SendClientMessages(void) {
 	int i;
 	client_t *c;
+	client_t *clients[MAX_CLIENTS];
+	int numClients;
 
-	// send a message to each connected client
+#ifdef USE_VOIP
+	SV_RelayVoip();
+#endif
+
+	// collect the clients that need a message this frame
+	numClients = 0;
 	for (i = 0; i < sv_maxclients->integer; i++) {
 		c = &svs.clients[i];
 
@@ -658,9 +1589,36 @@ void SV_SendClientMessages(void) {
 			}
 		}
 
-		// generate and send a new message
-		SV_SendClientSnapshot(c);
-		c->lastSnapshotTime = svs.time;
-		c->rateDelayed = qfalse;
+		clients[numClients++] = c;
+	}
+
+	if (sv.state) {
+		SV_FixEntityNumbers();
+		SV_BuildVisCache(clients, numClients);
+	}
+
+	// generate and send a new message, the datagrams go out together at the end
+	NET_BeginSendBatch();
+	if (sv_snapshotThreads->integer > 1 && numClients > 1 && sv.state) {
+		SV_SendClientSnapshots(clients, numClients, sv_snapshotThreads->integer);
+	} else {
+		if (sv_deltaCache->integer && numClients > 1 && sv.state) {
+			SV_BeginDeltaCache();
+		}
+		for (i = 0; i < numClients; i++) {
+			SV_SendClientSnapshot(clients[i]);
+		}
+		SV_EndDeltaCache();
+	}
+	SV_BENCH_BEGIN(SVB_NETWORK);
+	NET_FlushSendBatch();
+	SV_BENCH_END();
+
+	// the cache is only valid for this frame
+	numVisCacheEntries = 0;
+
+	for (i = 0; i < numClients; i++) {
+		clients[i]->lastSnapshotTime = svs.time;
+		clients[i]->rateDelayed = qfalse;
 	}
 }
@@ -46,6 +46,18 @@ clipHandle_t SV_ClipHandleForEntity(const sharedEntity_t *ent) {
 	return CM_TempBoxModel(ent->r.mins, ent->r.maxs, qfalse);
 }
 
+/*
+================
+SV_ClipsAsBox
+
+True if a trace against the entity would go through the temporary box
+model of SV_ClipHandleForEntity, which BoxTraceBox does directly
+================
+*/
+static qboolean SV_ClipsAsBox(const sharedEntity_t *ent, int capsule) {
+	return !ent->r.bmodel && !(ent->r.svFlags & SVF_CAPSULE) && !capsule;
+}
+
 /*
 ===============================================================================
 
@@ -62,15 +74,21 @@ them, which prevents having to deal with multiple fragments of a single entity.
 typedef struct worldSector_s {
 	int axis; // -1 = leaf node
 	float dist;
+	int depth;
 	struct worldSector_s *children[2];
 	svEntity_t *entities;
 } worldSector_t;
 
-#define AREA_DEPTH 4
-#define AREA_NODES 64
+#define AREA_DEPTH 4 // the smallest tree, what the sector tree always used to be
+#define MAX_AREA_DEPTH 8
+#define AREA_NODES (1 << (MAX_AREA_DEPTH + 1))
+
+// with sv_sectorDepth 0, the tree is split until the leafs are about this size
+#define AREA_LEAF_SIZE 1024
 
 static worldSector_t sv_worldSectors[AREA_NODES];
 static int sv_numworldSectors;
+static int sv_worldSectorDepth;
 
 /*
 ===============
@@ -78,21 +96,103 @@ SV_SectorList_f
 ===============
 */
 void SV_SectorList_f(void) {
-	int i, c;
+	static const int bucketMins[] = {0, 1, 2, 4, 8, 16, 32};
+	int leafBuckets[ARRAY_LEN(bucketMins)];
+	int depthEntities[MAX_AREA_DEPTH + 1];
+	int i, j, c;
+	int total, maxLeaf, numLeafs;
 	worldSector_t *sec;
 	svEntity_t *ent;
 
-	for (i = 0; i < AREA_NODES; i++) {
+	Com_Memset(leafBuckets, 0, sizeof(leafBuckets));
+	Com_Memset(depthEntities, 0, sizeof(depthEntities));
+	total = maxLeaf = numLeafs = 0;
+
+	for (i = 0; i < sv_numworldSectors; i++) {
 		sec = &sv_worldSectors[i];
 
 		c = 0;
 		for (ent = sec->entities; ent; ent = ent->nextEntityInWorldSector) {
 			c++;
 		}
-		Com_Printf("sector %i: %i entities\n", i, c);
+		if (c) {
+			Com_Printf("sector %i (depth %i%s): %i entities\n", i, sec->depth, sec->axis == -1 ? ", leaf" : "", c);
+		}
+
+		total += c;
+		depthEntities[sec->depth] += c;
+
+		if (sec->axis != -1) {
+			continue;
+		}
+		numLeafs++;
+		if (c > maxLeaf) {
+			maxLeaf = c;
+		}
+		j = ARRAY_LEN(bucketMins) - 1;
+		while (j > 0 && c < bucketMins[j]) {
+			j--;
+		}
+		leafBuckets[j]++;
+	}
+
+	Com_Printf("%i sectors, %i leafs, depth %i, %i linked entities\n", sv_numworldSectors, numLeafs, sv_worldSectorDepth,
+			   total);
+
+	// entities crossing a split stay in the node, deep trees push big ones up
+	Com_Printf("entities per depth:\n");
+	for (i = 0; i <= sv_worldSectorDepth; i++) {
+		Com_Printf("  depth %i: %i\n", i, depthEntities[i]);
+	}
+
+	Com_Printf("leaf occupancy (max %i):\n", maxLeaf);
+	for (j = 0; j < ARRAY_LEN(bucketMins); j++) {
+		if (j == ARRAY_LEN(bucketMins) - 1) {
+			Com_Printf("  %i+: %i\n", bucketMins[j], leafBuckets[j]);
+		} else if (bucketMins[j + 1] - 1 == bucketMins[j]) {
+			Com_Printf("  %i: %i\n", bucketMins[j], leafBuckets[j]);
+		} else {
+			Com_Printf("  %i-%i: %i\n", bucketMins[j], bucketMins[j + 1] - 1, leafBuckets[j]);
+		}
 	}
 }
 
+/*
+===============
+SV_WorldSectorDepth
+
+Picks the depth of the sector tree from sv_sectorDepth, or from the world
+bounds if it is 0, so that big maps don't end up with long entity chains
+===============
+*/
+static int SV_WorldSectorDepth(const vec3_t mins, const vec3_t maxs) {
+	vec3_t size;
+	int depth;
+
+	if (sv_sectorDepth->integer > 0) {
+		return sv_sectorDepth->integer;
+	}
+
+	// follow the splits SV_CreateworldSector will make
+	VectorSubtract(maxs, mins, size);
+	for (depth = 0; depth < MAX_AREA_DEPTH; depth++) {
+		if (size[0] <= AREA_LEAF_SIZE && size[1] <= AREA_LEAF_SIZE) {
+			break;
+		}
+		if (size[0] > size[1]) {
+			size[0] *= 0.5f;
+		} else {
+			size[1] *= 0.5f;
+		}
+	}
+
+	if (depth < AREA_DEPTH) {
+		depth = AREA_DEPTH;
+	}
+
+	return depth;
+}
+
 /*
 ===============
 SV_CreateworldSector
@@ -108,7 +208,9 @@ static worldSector_t *SV_CreateworldSector(int depth, vec3_t mins, vec3_t maxs)
 	anode = &sv_worldSectors[sv_numworldSectors];
 	sv_numworldSectors++;
 
-	if (depth == AREA_DEPTH) {
+	anode->depth = depth;
+
+	if (depth == sv_worldSectorDepth) {
 		anode->axis = -1;
 		anode->children[0] = anode->children[1] = NULL;
 		return anode;
@@ -135,6 +237,91 @@ static worldSector_t *SV_CreateworldSector(int depth, vec3_t mins, vec3_t maxs)
 	return anode;
 }
 
+/*
+===============================================================================
+
+TRACE CACHE
+
+===============================================================================
+*/
+
+#define TRACE_CACHE_HASH 1024
+#define TRACE_CACHE_PROBES 4
+
+typedef struct {
+	vec3_t start;
+	vec3_t end;
+	vec3_t mins;
+	vec3_t maxs;
+	int passEntityNum;
+	int contentmask;
+	int capsule;
+} traceKey_t;
+
+typedef struct {
+	int generation; // only valid while it matches traceCache.generation
+	traceKey_t key;
+	trace_t trace;
+} traceCacheEntry_t;
+
+typedef struct {
+	int generation;
+	int hits;
+	int misses;
+	traceCacheEntry_t entries[TRACE_CACHE_HASH];
+} traceCache_t;
+
+static traceCache_t traceCache;
+
+/*
+===============
+SV_InvalidateTraceCache
+
+Anything that moves an entity in or out of the world can change the result
+of any trace
+===============
+*/
+static void SV_InvalidateTraceCache(void) {
+	traceCache.generation++;
+}
+
+/*
+===============
+SV_TraceCacheFrame
+===============
+*/
+void SV_TraceCacheFrame(void) {
+	SV_InvalidateTraceCache();
+
+	if (!sv_traceCache->integer) {
+		return;
+	}
+
+	Cvar_Set("sv_traceCacheStats", va("%i hits %i misses", traceCache.hits, traceCache.misses));
+	traceCache.hits = 0;
+	traceCache.misses = 0;
+}
+
+/*
+===============
+SV_TraceCacheHash
+===============
+*/
+static unsigned SV_TraceCacheHash(const traceKey_t *key) {
+	const unsigned *k = (const unsigned *)key;
+	unsigned hash;
+	int i;
+
+	hash = 0x811c9dc5;
+	for (i = 0; i < sizeof(*key) / 4; i++) {
+		hash = (hash ^ k[i]) * 0x01000193;
+	}
+
+	return hash ^ (hash >> 16);
+}
+
+static void SV_ClearClientPositions(void);
+
 /*
 ===============
 SV_ClearWorld
@@ -151,6 +338,9 @@ void SV_ClearWorld(void) {
 	// get world map bounds
 	h = CM_InlineModel(0);
 	CM_ModelBounds(h, mins, maxs);
+	SV_InvalidateTraceCache();
+	SV_ClearClientPositions();
+	sv_worldSectorDepth = SV_WorldSectorDepth(mins, maxs);
 	SV_CreateworldSector(0, mins, maxs);
 }
 
@@ -175,6 +365,8 @@ void SV_UnlinkEntity(sharedEntity_t *gEnt) {
 	}
 	ent->worldSector = NULL;
 
+	SV_InvalidateTraceCache();
+
 	if (ws->entities == ent) {
 		ws->entities = ent->nextEntityInWorldSector;
 		return;
@@ -205,11 +397,14 @@ void SV_LinkEntity(sharedEntity_t *gEnt) {
 	int i, j, k;
 	int area;
 	int lastLeaf;
+	int leafnum;
 	float *origin, *angles;
 	svEntity_t *ent;
 
 	ent = SV_SvEntityForGentity(gEnt);
 
+	SV_InvalidateTraceCache();
+
 	if (ent->worldSector) {
 		SV_UnlinkEntity(gEnt); // unlink from old position
 	}
@@ -273,6 +468,11 @@ void SV_LinkEntity(sharedEntity_t *gEnt) {
 	gEnt->r.absmax[1] += 1;
 	gEnt->r.absmax[2] += 1;
 
+	// for the entity to entity PVS checks of the game
+	leafnum = CM_PointLeafnum(origin);
+	ent->originCluster = CM_LeafCluster(leafnum);
+	ent->originArea = CM_LeafArea(leafnum);
+
 	// link to PVS leafs
 	ent->numClusters = 0;
 	ent->lastCluster = 0;
@@ -463,18 +663,22 @@ void SV_ClipToEntity(trace_t *trace, const vec3_t start, const vec3_t mins, cons
 		return;
 	}
 
-	// might intersect, so do an exact clip
-	clipHandle = SV_ClipHandleForEntity(touch);
-
 	origin = touch->r.currentOrigin;
 	angles = touch->r.currentAngles;
 
-	if (!touch->r.bmodel) {
-		angles = vec3_origin; // boxes don't rotate
-	}
+	if (SV_ClipsAsBox(touch, capsule)) {
+		BoxTraceBox(trace, start, end, mins, maxs, touch->r.mins, touch->r.maxs, origin, contentmask);
+	} else {
+		// might intersect, so do an exact clip
+		clipHandle = SV_ClipHandleForEntity(touch);
 
-	CM_TransformedBoxTrace(trace, (float *)start, (float *)end, (float *)mins, (float *)maxs, clipHandle, contentmask,
-						   origin, angles, capsule);
+		if (!touch->r.bmodel) {
+			angles = vec3_origin; // boxes don't rotate
+		}
+
+		CM_TransformedBoxTrace(trace, (float *)start, (float *)end, (float *)mins, (float *)maxs, clipHandle,
+							   contentmask, origin, angles, capsule);
+	}
 
 	if (trace->fraction < 1) {
 		trace->entityNum = touch->s.number;
@@ -533,18 +737,23 @@ static void SV_ClipMoveToEntities(moveclip_t *clip) {
 			continue;
 		}
 
-		// might intersect, so do an exact clip
-		clipHandle = SV_ClipHandleForEntity(touch);
-
 		origin = touch->r.currentOrigin;
 		angles = touch->r.currentAngles;
 
-		if (!touch->r.bmodel) {
-			angles = vec3_origin; // boxes don't rotate
-		}
+		if (SV_ClipsAsBox(touch, clip->capsule)) {
+			BoxTraceBox(&trace, clip->start, clip->end, clip->mins, clip->maxs, touch->r.mins, touch->r.maxs, origin,
+						clip->contentmask);
+		} else {
+			// might intersect, so do an exact clip
+			clipHandle = SV_ClipHandleForEntity(touch);
 
-		CM_TransformedBoxTrace(&trace, (float *)clip->start, (float *)clip->end, (float *)clip->mins,
-							   (float *)clip->maxs, clipHandle, clip->contentmask, origin, angles, clip->capsule);
+			if (!touch->r.bmodel) {
+				angles = vec3_origin; // boxes don't rotate
+			}
+
+			CM_TransformedBoxTrace(&trace, (float *)clip->start, (float *)clip->end, (float *)clip->mins,
+								   (float *)clip->maxs, clipHandle, clip->contentmask, origin, angles, clip->capsule);
+		}
 
 		if (trace.allsolid) {
 			clip->trace.allsolid = qtrue;
@@ -569,24 +778,14 @@ static void SV_ClipMoveToEntities(moveclip_t *clip) {
 
 /*
 ==================
-SV_Trace
-
-Moves the given mins/maxs volume through the world from start to end.
-passEntityNum and entities owned by passEntityNum are explicitly not checked.
+SV_TraceUncached
 ==================
 */
-void SV_Trace(trace_t *results, const vec3_t start, const vec3_t mins, const vec3_t maxs, const vec3_t end, int passEntityNum,
-			  int contentmask, int capsule) {
+static void SV_TraceUncached(trace_t *results, const vec3_t start, const vec3_t mins, const vec3_t maxs, const vec3_t end,
+							 int passEntityNum, int contentmask, int capsule) {
 	moveclip_t clip;
 	int i;
 
-	if (!mins) {
-		mins = vec3_origin;
-	}
-	if (!maxs) {
-		maxs = vec3_origin;
-	}
-
 	Com_Memset(&clip, 0, sizeof(clip));
 
 	// clip to world
@@ -626,6 +825,138 @@ void SV_Trace(trace_t *results, const vec3_t start, const vec3_t mins, const vec
 	*results = clip.trace;
 }
 
+/*
+==================
+SV_Trace
+
+Moves the given mins/maxs volume through the world from start to end.
+passEntityNum and entities owned by passEntityNum are explicitly not checked.
+==================
+*/
+void SV_Trace(trace_t *results, const vec3_t start, const vec3_t mins, const vec3_t maxs, const vec3_t end, int passEntityNum,
+			  int contentmask, int capsule) {
+	traceKey_t key;
+	traceCacheEntry_t *entry, *slot;
+	unsigned hash;
+	int i;
+
+	if (!mins) {
+		mins = vec3_origin;
+	}
+	if (!maxs) {
+		maxs = vec3_origin;
+	}
+
+	// the cache is only kept for the main thread
+	if (!sv_traceCache->integer || Com_JobThreadIndex()) {
+		SV_TraceUncached(results, start, mins, maxs, end, passEntityNum, contentmask, capsule);
+		return;
+	}
+
+	VectorCopy(start, key.start);
+	VectorCopy(end, key.end);
+	VectorCopy(mins, key.mins);
+	VectorCopy(maxs, key.maxs);
+	key.passEntityNum = passEntityNum;
+	key.contentmask = contentmask;
+	key.capsule = capsule;
+
+	hash = SV_TraceCacheHash(&key);
+	slot = NULL;
+	for (i = 0; i < TRACE_CACHE_PROBES; i++) {
+		entry = &traceCache.entries[(hash + i) & (TRACE_CACHE_HASH - 1)];
+		if (entry->generation != traceCache.generation) {
+			if (!slot) {
+				slot = entry;
+			}
+			continue;
+		}
+
+		if (!memcmp(&entry->key, &key, sizeof(key))) {
+			traceCache.hits++;
+			*results = entry->trace;
+			return;
+		}
+	}
+
+	traceCache.misses++;
+	SV_TraceUncached(results, start, mins, maxs, end, passEntityNum, contentmask, capsule);
+
+	if (!slot) {
+		// all probed slots are in use, replace the first one
+		slot = &traceCache.entries[hash & (TRACE_CACHE_HASH - 1)];
+	}
+	slot->generation = traceCache.generation;
+	slot->key = key;
+	slot->trace = *results;
+}
+
+// traces of a batch that one job runs, and the smallest batch worth the threads
+#define TRACE_BATCH_JOB_SIZE 16
+#define TRACE_BATCH_MIN_THREADED 64
+
+typedef struct {
+	trace_t *results;
+	const traceRequest_t *requests;
+	int numRequests;
+} traceBatch_t;
+
+/*
+==================
+SV_TraceBatchRange
+==================
+*/
+static void SV_TraceBatchRange(trace_t *results, const traceRequest_t *requests, int numRequests) {
+	int i;
+
+	for (i = 0; i < numRequests; i++) {
+		SV_Trace(&results[i], requests[i].start, requests[i].mins, requests[i].maxs, requests[i].end,
+				 requests[i].passEntityNum, requests[i].contentmask, requests[i].capsule);
+	}
+}
+
+/*
+==================
+SV_TraceBatchJob
+==================
+*/
+static void SV_TraceBatchJob(void *data, int index) {
+	const traceBatch_t *batch = data;
+	int first, count;
+
+	first = index * TRACE_BATCH_JOB_SIZE;
+	count = batch->numRequests - first;
+	if (count > TRACE_BATCH_JOB_SIZE) {
+		count = TRACE_BATCH_JOB_SIZE;
+	}
+
+	SV_TraceBatchRange(&batch->results[first], &batch->requests[first], count);
+}
+
+/*
+==================
+SV_TraceBatch
+
+Runs a list of traces for the game in one system call.  Nothing is linked
+or unlinked while the batch runs, so with sv_traceThreads > 1 a large batch
+is spread over the job pool.
+==================
+*/
+void SV_TraceBatch(trace_t *results, const traceRequest_t *requests, int numRequests) {
+	traceBatch_t batch;
+
+	if (sv_traceThreads->integer > 1 && numRequests >= TRACE_BATCH_MIN_THREADED) {
+		batch.results = results;
+		batch.requests = requests;
+		batch.numRequests = numRequests;
+		Com_RunJobs(SV_TraceBatchJob, &batch, (numRequests + TRACE_BATCH_JOB_SIZE - 1) / TRACE_BATCH_JOB_SIZE,
+					sv_traceThreads->integer);
+		return;
+	}
+
+	SV_TraceBatchRange(results, requests, numRequests);
+}
+
 /*
 =============
 SV_PointContents
@@ -664,3 +995,223 @@ int SV_PointContents(const vec3_t p, int passEntityNum) {
 
 	return contents;
 }
+
+/*
+===============================================================================
+
+LAG COMPENSATION
+
+The positions of the clients are recorded after every game frame, so that
+the traces of a shot can be run against the world as a lagged client saw
+it.  Rewound clients are only moved in the world sectors, their clusters
+and areas are left alone since traces don't use them.
+
+===============================================================================
+*/
+
+#define MAX_REWIND_FRAMES 64   // must be a power of two
+#define REWIND_TELEPORT_DIST 128 // a client that moved further in a frame isn't interpolated
+
+typedef struct {
+	vec3_t origin;
+	vec3_t mins, maxs;
+	qboolean linked;
+} rewindPosition_t;
+
+typedef struct {
+	int time;
+	rewindPosition_t clients[MAX_CLIENTS];
+} rewindFrame_t;
+
+typedef struct {
+	int clientNum;
+	vec3_t origin;
+	vec3_t mins, maxs;
+	vec3_t absmin, absmax;
+} rewoundClient_t;
+
+static rewindFrame_t rewindFrames[MAX_REWIND_FRAMES];
+static int numRewindFrames; // recorded since the world was cleared
+
+static rewoundClient_t rewoundClients[MAX_CLIENTS];
+static int numRewoundClients;
+
+/*
+===============
+SV_ClearClientPositions
+===============
+*/
+static void SV_ClearClientPositions(void) {
+	numRewindFrames = 0;
+	numRewoundClients = 0;
+}
+
+/*
+===============
+SV_RecordClientPositions
+===============
+*/
+void SV_RecordClientPositions(void) {
+	rewindFrame_t *frame;
+	rewindPosition_t *pos;
+	sharedEntity_t *gEnt;
+	int i;
+
+	frame = &rewindFrames[numRewindFrames & (MAX_REWIND_FRAMES - 1)];
+	frame->time = sv.time;
+
+	for (i = 0, pos = frame->clients; i < sv_maxclients->integer; i++, pos++) {
+		gEnt = SV_GentityNum(i);
+		pos->linked = svs.clients[i].state == CS_ACTIVE && gEnt->r.linked;
+		if (pos->linked) {
+			VectorCopy(gEnt->r.currentOrigin, pos->origin);
+			VectorCopy(gEnt->r.mins, pos->mins);
+			VectorCopy(gEnt->r.maxs, pos->maxs);
+		}
+	}
+
+	numRewindFrames++;
+}
+
+/*
+===============
+SV_RelinkWorldSector
+
+Moves an entity whose abs box changed to the sector it belongs in now,
+without SV_LinkEntity's cluster and area lookups
+===============
+*/
+static void SV_RelinkWorldSector(sharedEntity_t *gEnt) {
+	svEntity_t *ent;
+	worldSector_t *node;
+
+	ent = SV_SvEntityForGentity(gEnt);
+	SV_UnlinkEntity(gEnt);
+
+	node = sv_worldSectors;
+	while (node->axis != -1) {
+		if (gEnt->r.absmin[node->axis] > node->dist)
+			node = node->children[0];
+		else if (gEnt->r.absmax[node->axis] < node->dist)
+			node = node->children[1];
+		else
+			break;
+	}
+
+	ent->worldSector = node;
+	ent->nextEntityInWorldSector = node->entities;
+	node->entities = ent;
+
+	gEnt->r.linked = qtrue;
+}
+
+/*
+===============
+SV_RewindClients
+===============
+*/
+void SV_RewindClients(int time, int skipClient) {
+	const rewindFrame_t *before, *after;
+	const rewindPosition_t *from, *to;
+	rewoundClient_t *saved;
+	sharedEntity_t *gEnt;
+	vec3_t origin;
+	float frac;
+	int i, oldest, newest;
+
+	SV_RestoreClients();
+
+	if (!numRewindFrames) {
+		return;
+	}
+
+	newest = numRewindFrames - 1;
+	oldest = numRewindFrames > MAX_REWIND_FRAMES ? numRewindFrames - MAX_REWIND_FRAMES : 0;
+
+	// the client saw the latest positions, or ones that were moved on since
+	if (time >= rewindFrames[newest & (MAX_REWIND_FRAMES - 1)].time) {
+		return;
+	}
+
+	// find the frames around the time, going back no further than recorded
+	for (i = newest - 1; i > oldest; i--) {
+		if (rewindFrames[i & (MAX_REWIND_FRAMES - 1)].time <= time) {
+			break;
+		}
+	}
+	before = &rewindFrames[i & (MAX_REWIND_FRAMES - 1)];
+	after = &rewindFrames[(i + 1) & (MAX_REWIND_FRAMES - 1)];
+
+	if (time <= before->time || after->time <= before->time) {
+		frac = 0.0f;
+	} else {
+		frac = (float)(time - before->time) / (after->time - before->time);
+	}
+
+	for (i = 0; i < sv_maxclients->integer; i++) {
+		if (i == skipClient) {
+			continue;
+		}
+
+		gEnt = SV_GentityNum(i);
+		from = &before->clients[i];
+		to = &after->clients[i];
+		if (!gEnt->r.linked || !from->linked || !to->linked) {
+			continue;
+		}
+
+		if (Distance(from->origin, to->origin) > REWIND_TELEPORT_DIST) {
+			VectorCopy(frac < 0.5f ? from->origin : to->origin, origin);
+		} else {
+			VectorSubtract(to->origin, from->origin, origin);
+			VectorMA(from->origin, frac, origin, origin);
+		}
+
+		saved = &rewoundClients[numRewoundClients++];
+		saved->clientNum = i;
+		VectorCopy(gEnt->r.currentOrigin, saved->origin);
+		VectorCopy(gEnt->r.mins, saved->mins);
+		VectorCopy(gEnt->r.maxs, saved->maxs);
+		VectorCopy(gEnt->r.absmin, saved->absmin);
+		VectorCopy(gEnt->r.absmax, saved->absmax);
+
+		VectorCopy(origin, gEnt->r.currentOrigin);
+		VectorCopy(from->mins, gEnt->r.mins);
+		VectorCopy(from->maxs, gEnt->r.maxs);
+
+		// the same epsilon SV_LinkEntity adds
+		VectorAdd(origin, gEnt->r.mins, gEnt->r.absmin);
+		VectorAdd(origin, gEnt->r.maxs, gEnt->r.absmax);
+		gEnt->r.absmin[0] -= 1;
+		gEnt->r.absmin[1] -= 1;
+		gEnt->r.absmin[2] -= 1;
+		gEnt->r.absmax[0] += 1;
+		gEnt->r.absmax[1] += 1;
+		gEnt->r.absmax[2] += 1;
+
+		SV_RelinkWorldSector(gEnt);
+	}
+}
+
+/*
+===============
+SV_RestoreClients
+===============
+*/
+void SV_RestoreClients(void) {
+	rewoundClient_t *saved;
+	sharedEntity_t *gEnt;
+	int i;
+
+	for (i = 0, saved = rewoundClients; i < numRewoundClients; i++, saved++) {
+		gEnt = SV_GentityNum(saved->clientNum);
+		VectorCopy(saved->origin, gEnt->r.currentOrigin);
+		VectorCopy(saved->mins, gEnt->r.mins);
+		VectorCopy(saved->maxs, gEnt->r.maxs);
+		VectorCopy(saved->absmin, gEnt->r.absmin);
+		VectorCopy(saved->absmax, gEnt->r.absmax);
+		SV_RelinkWorldSector(gEnt);
+	}
+
+	numRewoundClients = 0;
+}
@@ -266,6 +266,7 @@ Single exit point (regular exit or in case of error)
 =================
 */
 static __attribute__((noreturn)) void Sys_Exit(int exitCode) {
+	Com_StopPrintThread();
 	CON_Shutdown();
 
 #ifndef DEDICATED
@@ -314,6 +315,10 @@ cpuFeatures_t Sys_GetProcessorFeatures(void) {
 		features |= CF_SSE2;
 	if (SDL_HasAltiVec())
 		features |= CF_ALTIVEC;
+#if SDL_VERSION_ATLEAST(2, 0, 4)
+	if (SDL_HasAVX2())
+		features |= CF_AVX2;
+#endif
 #endif
 
 	return features;
@@ -410,6 +415,9 @@ void Sys_Error(const char *error, ...) {
 	Q_vsnprintf(string, sizeof(string), error, argptr);
 	va_end(argptr);
 
+	// the dialog reads the console log
+	Com_StopPrintThread();
+
 	Sys_ErrorDialog(string);
 
 	Sys_Exit(3);
@@ -450,6 +458,25 @@ int Sys_FileTime(char *path) {
 	return buf.st_mtime;
 }
 
+/*
+============
+Sys_FileInfo
+
+Size and modification time of a file, qfalse if not present
+============
+*/
+qboolean Sys_FileInfo(const char *path, int64_t *size, int64_t *mtime) {
+	struct stat buf;
+
+	if (stat(path, &buf) == -1)
+		return qfalse;
+
+	*size = buf.st_size;
+	*mtime = buf.st_mtime;
+
+	return qtrue;
+}
+
 /*
 =================
 Sys_UnloadDll
@@ -20,6 +20,10 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 ===========================================================================
 */
 
+#ifdef __linux__
+#define _GNU_SOURCE // REG_RIP and friends for Sys_SetProfileTimer
+#endif
+
 #include "../qcommon/q_shared.h"
 #include "../qcommon/qcommon.h"
 #include "sys_local.h"
@@ -33,11 +37,17 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include <unistd.h>
 #include <sys/mman.h>
 #include <sys/time.h>
+#include <time.h>
 #include <pwd.h>
 #include <libgen.h>
 #include <fcntl.h>
 #include <fenv.h>
 #include <sys/wait.h>
+#include <pthread.h>
+#include <ucontext.h>
+#ifdef __linux__
+#include <sched.h>
+#endif
 
 qboolean stdinIsATTY;
 
@@ -114,34 +124,67 @@ char *Sys_GogPath(void) {
 	return gogPath;
 }
 
+/*
+================
+Sys_ReadClock
+
+Reads the monotonic clock where there is one, so that frame timing
+doesn't jump when the wall clock is set
+================
+*/
+static void Sys_ReadClock(time_t *sec, long *usec) {
+#ifdef CLOCK_MONOTONIC
+	struct timespec ts;
+
+	if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0) {
+		*sec = ts.tv_sec;
+		*usec = ts.tv_nsec / 1000;
+		return;
+	}
+#endif
+	{
+		struct timeval tp;
+
+		gettimeofday(&tp, NULL);
+		*sec = tp.tv_sec;
+		*usec = tp.tv_usec;
+	}
+}
+
 /*
 ================
 Sys_Milliseconds
 ================
 */
 /* base time in seconds, that's our origin
-   timeval:tv_sec is an int:
-   assuming this wraps every 0x7fffffff - ~68 years since the Epoch (1970) - we're safe till 2038 */
-unsigned long sys_timeBase = 0;
-/* current time in ms, using sys_timeBase as origin
-   NOTE: sys_timeBase*1000 + curtime -> ms since the Epoch
-	 0x7fffffff ms - ~24 days
-   although timeval:tv_usec is an int, I'm not sure wether it is actually used as an unsigned int
-	 (which would affect the wrap period) */
-int curtime;
+   the first second the clock read, so the time stays small enough
+   for an int for ~24 days */
+static time_t sys_timeBase = 0;
+static qboolean sys_timeBaseSet = qfalse;
+
 int Sys_Milliseconds(void) {
-	struct timeval tp;
+	return Sys_Microseconds() / 1000;
+}
+
+/*
+================
+Sys_Microseconds
 
-	gettimeofday(&tp, NULL);
+Same origin as Sys_Milliseconds
+================
+*/
+int64_t Sys_Microseconds(void) {
+	time_t sec;
+	long usec;
 
-	if (!sys_timeBase) {
-		sys_timeBase = tp.tv_sec;
-		return tp.tv_usec / 1000;
-	}
+	Sys_ReadClock(&sec, &usec);
 
-	curtime = (tp.tv_sec - sys_timeBase) * 1000 + tp.tv_usec / 1000;
+	if (!sys_timeBaseSet) {
+		sys_timeBase = sec;
+		sys_timeBaseSet = qtrue;
+	}
 
-	return curtime;
+	return (int64_t)(sec - sys_timeBase) * 1000000 + usec;
 }
 
 /*
@@ -227,6 +270,92 @@ FILE *Sys_FOpen(const char *ospath, const char *mode) {
 	return fopen(ospath, mode);
 }
 
+/*
+==============
+Sys_MapFile
+
+Maps a whole file read only, NULL on failure
+==============
+*/
+void *Sys_MapFile(const char *ospath, int64_t *length) {
+	struct stat buf;
+	void *base;
+	int fd;
+
+	fd = open(ospath, O_RDONLY);
+	if (fd == -1)
+		return NULL;
+
+	if (fstat(fd, &buf) == -1 || buf.st_size <= 0 || (uint64_t)buf.st_size > (size_t)-1) {
+		close(fd);
+		return NULL;
+	}
+
+	base = mmap(NULL, buf.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+
+	if (base == MAP_FAILED)
+		return NULL;
+
+	*length = buf.st_size;
+	return base;
+}
+
+/*
+==============
+Sys_UnmapFile
+==============
+*/
+void Sys_UnmapFile(void *base, int64_t length) {
+	munmap(base, length);
+}
+
+#ifdef MAP_NORESERVE
+#define RESERVE_FLAGS (MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE)
+#else
+#define RESERVE_FLAGS (MAP_PRIVATE | MAP_ANONYMOUS)
+#endif
+
+/*
+==============
+Sys_ReserveMemory
+
+Reserves address space without backing it, NULL on failure
+==============
+*/
+void *Sys_ReserveMemory(size_t size) {
+	void *base = mmap(NULL, size, PROT_NONE, RESERVE_FLAGS, -1, 0);
+
+	if (base == MAP_FAILED)
+		return NULL;
+
+	return base;
+}
+
+/*
+==============
+Sys_CommitMemory
+
+Makes a reserved range usable, pages are still only backed once touched
+==============
+*/
+qboolean Sys_CommitMemory(void *base, size_t size) {
+	return mprotect(base, size, PROT_READ | PROT_WRITE) == 0;
+}
+
+/*
+==============
+Sys_DecommitMemory
+
+Returns the pages of a committed range to the system, keeping it reserved
+==============
+*/
+void Sys_DecommitMemory(void *base, size_t size) {
+	// mapping over the range drops its pages in one go
+	if (mmap(base, size, PROT_NONE, RESERVE_FLAGS | MAP_FIXED, -1, 0) == MAP_FAILED)
+		Com_Printf(S_COLOR_YELLOW "WARNING: failed to decommit %zu bytes\n", size);
+}
+
 /*
 ==================
 Sys_Mkdir
@@ -269,6 +398,28 @@ FILE *Sys_Mkfifo(const char *ospath) {
 	return fifo;
 }
 
+/*
+==================
+Sys_OpenPipe
+
+Starts a command through the shell with a pipe to its stdin
+==================
+*/
+FILE *Sys_OpenPipe(const char *command) {
+	return popen(command, "w");
+}
+
+/*
+==================
+Sys_ClosePipe
+
+Waits for the command to exit, returns its exit status
+==================
+*/
+int Sys_ClosePipe(FILE *pipe) {
+	return pclose(pipe);
+}
+
 /*
 ==================
 Sys_Cwd
@@ -914,3 +1065,344 @@ qboolean Sys_DllExtension(const char *name) {
 
 	return qfalse;
 }
+
+/*
+==============================================================
+
+THREADS
+
+==============================================================
+*/
+
+struct sysThread_s {
+	pthread_t handle;
+	void (*func)(void *data);
+	void *data;
+};
+
+struct sysMutex_s {
+	pthread_mutex_t handle;
+};
+
+struct sysCond_s {
+	pthread_cond_t handle;
+};
+
+static void *Sys_ThreadMain(void *arg) {
+	sysThread_t *thread = (sysThread_t *)arg;
+	sigset_t set;
+
+	// signals are handled by the main thread only
+	sigfillset(&set);
+	pthread_sigmask(SIG_BLOCK, &set, NULL);
+
+	thread->func(thread->data);
+	return NULL;
+}
+
+/*
+==============
+Sys_CreateThread
+==============
+*/
+sysThread_t *Sys_CreateThread(void (*func)(void *data), void *data) {
+	sysThread_t *thread = malloc(sizeof(*thread));
+
+	if (!thread) {
+		return NULL;
+	}
+
+	thread->func = func;
+	thread->data = data;
+	if (pthread_create(&thread->handle, NULL, Sys_ThreadMain, thread) != 0) {
+		free(thread);
+		return NULL;
+	}
+
+	return thread;
+}
+
+/*
+==============
+Sys_JoinThread
+==============
+*/
+void Sys_JoinThread(sysThread_t *thread) {
+	pthread_join(thread->handle, NULL);
+	free(thread);
+}
+
+/*
+==============
+Sys_CreateMutex
+==============
+*/
+sysMutex_t *Sys_CreateMutex(void) {
+	sysMutex_t *mutex = malloc(sizeof(*mutex));
+
+	if (!mutex) {
+		return NULL;
+	}
+
+	if (pthread_mutex_init(&mutex->handle, NULL) != 0) {
+		free(mutex);
+		return NULL;
+	}
+
+	return mutex;
+}
+
+void Sys_DestroyMutex(sysMutex_t *mutex) {
+	pthread_mutex_destroy(&mutex->handle);
+	free(mutex);
+}
+
+void Sys_LockMutex(sysMutex_t *mutex) {
+	pthread_mutex_lock(&mutex->handle);
+}
+
+void Sys_UnlockMutex(sysMutex_t *mutex) {
+	pthread_mutex_unlock(&mutex->handle);
+}
+
+/*
+==============
+Sys_CreateCond
+==============
+*/
+sysCond_t *Sys_CreateCond(void) {
+	sysCond_t *cond = malloc(sizeof(*cond));
+
+	if (!cond) {
+		return NULL;
+	}
+
+	if (pthread_cond_init(&cond->handle, NULL) != 0) {
+		free(cond);
+		return NULL;
+	}
+
+	return cond;
+}
+
+void Sys_DestroyCond(sysCond_t *cond) {
+	pthread_cond_destroy(&cond->handle);
+	free(cond);
+}
+
+void Sys_WaitCond(sysCond_t *cond, sysMutex_t *mutex) {
+	pthread_cond_wait(&cond->handle, &mutex->handle);
+}
+
+qboolean Sys_TimedWaitCond(sysCond_t *cond, sysMutex_t *mutex, int usec) {
+	struct timespec ts;
+
+	clock_gettime(CLOCK_REALTIME, &ts);
+	ts.tv_sec += usec / 1000000;
+	ts.tv_nsec += (usec % 1000000) * 1000;
+	if (ts.tv_nsec >= 1000000000) {
+		ts.tv_sec++;
+		ts.tv_nsec -= 1000000000;
+	}
+
+	return pthread_cond_timedwait(&cond->handle, &mutex->handle, &ts) == 0 ? qtrue : qfalse;
+}
+
+void Sys_SignalCond(sysCond_t *cond) {
+	pthread_cond_signal(&cond->handle);
+}
+
+void Sys_BroadcastCond(sysCond_t *cond) {
+	pthread_cond_broadcast(&cond->handle);
+}
+
+/*
+==============
+Sys_SetAffinity
+==============
+*/
+qboolean Sys_SetAffinity(const int *cpus, int numCpus) {
+#ifdef __linux__
+	cpu_set_t set;
+	int i;
+
+	CPU_ZERO(&set);
+	for (i = 0; i < numCpus; i++) {
+		if (cpus[i] < 0 || cpus[i] >= CPU_SETSIZE) {
+			return qfalse;
+		}
+		CPU_SET(cpus[i], &set);
+	}
+
+	// a new thread starts with the affinity of the thread creating it
+	return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+	return qfalse;
+#endif
+}
+
+/*
+==============================================================
+
+PROFILE TIMER
+
+==============================================================
+*/
+
+static void (*sys_profileCallback)(void *pc, void *sp);
+static pthread_t sys_profileThread;
+
+/*
+==============
+Sys_SignalRegisters
+
+The interrupted pc and sp of a signal context, NULL if they are unknown
+on this platform
+==============
+*/
+static void Sys_SignalRegisters(void *context, void **pc, void **sp) {
+	ucontext_t *uc = context;
+
+	*pc = *sp = NULL;
+
+#if defined(__linux__) && defined(__x86_64__)
+	*pc = (void *)uc->uc_mcontext.gregs[REG_RIP];
+	*sp = (void *)uc->uc_mcontext.gregs[REG_RSP];
+#elif defined(__linux__) && defined(__i386__)
+	*pc = (void *)uc->uc_mcontext.gregs[REG_EIP];
+	*sp = (void *)uc->uc_mcontext.gregs[REG_ESP];
+#elif defined(__linux__) && defined(__aarch64__)
+	*pc = (void *)uc->uc_mcontext.pc;
+	*sp = (void *)uc->uc_mcontext.sp;
+#elif defined(__APPLE__) && defined(__x86_64__)
+	*pc = (void *)uc->uc_mcontext->__ss.__rip;
+	*sp = (void *)uc->uc_mcontext->__ss.__rsp;
+#elif defined(__APPLE__) && defined(__aarch64__)
+	*pc = (void *)uc->uc_mcontext->__ss.__pc;
+	*sp = (void *)uc->uc_mcontext->__ss.__sp;
+#else
+	(void)uc;
+#endif
+}
+
+static void Sys_ProfileSignal(int signum, siginfo_t *info, void *context) {
+	void *pc, *sp;
+
+	// the timer counts process time, only samples of the thread
+	// that started it say anything about the virtual machines
+	if (!sys_profileCallback || !pthread_equal(pthread_self(), sys_profileThread))
+		return;
+
+	Sys_SignalRegisters(context, &pc, &sp);
+	sys_profileCallback(pc, sp);
+}
+
+/*
+==============
+Sys_SetProfileTimer
+
+Calls callback from a signal handler hz times per second of cpu time
+spent by the calling thread, a hz of 0 stops the timer. pc and sp are
+the interrupted registers or NULL if they are unknown on this platform
+==============
+*/
+qboolean Sys_SetProfileTimer(int hz, void (*callback)(void *pc, void *sp)) {
+	struct itimerval timer;
+	struct sigaction sa;
+
+	Com_Memset(&timer, 0, sizeof(timer));
+
+	if (hz <= 0 || !callback) {
+		setitimer(ITIMER_PROF, &timer, NULL);
+		sys_profileCallback = NULL;
+		signal(SIGPROF, SIG_IGN);
+		return qtrue;
+	}
+
+	sys_profileCallback = callback;
+	sys_profileThread = pthread_self();
+
+	Com_Memset(&sa, 0, sizeof(sa));
+	sa.sa_sigaction = Sys_ProfileSignal;
+	sa.sa_flags = SA_SIGINFO | SA_RESTART;
+	sigemptyset(&sa.sa_mask);
+	if (sigaction(SIGPROF, &sa, NULL) == -1) {
+		sys_profileCallback = NULL;
+		return qfalse;
+	}
+
+	timer.it_interval.tv_usec = 1000000 / hz;
+	if (!timer.it_interval.tv_usec)
+		timer.it_interval.tv_usec = 1;
+	timer.it_value = timer.it_interval;
+	if (setitimer(ITIMER_PROF, &timer, NULL) == -1) {
+		sys_profileCallback = NULL;
+		signal(SIGPROF, SIG_IGN);
+		return qfalse;
+	}
+
+	return qtrue;
+}
+
+/*
+==============================================================
+
+THREAD INTERRUPT
+
+==============================================================
+*/
+
+static void (*volatile sys_interruptCallback)(void *pc, void *sp);
+static pthread_t sys_interruptThread;
+
+static void Sys_InterruptSignal(int signum, siginfo_t *info, void *context) {
+	void (*callback)(void *pc, void *sp) = sys_interruptCallback;
+	void *pc, *sp;
+
+	if (!callback || !pthread_equal(pthread_self(), sys_interruptThread))
+		return;
+
+	Sys_SignalRegisters(context, &pc, &sp);
+	callback(pc, sp);
+}
+
+/*
+==============
+Sys_SetInterruptCallback
+==============
+*/
+qboolean Sys_SetInterruptCallback(void (*callback)(void *pc, void *sp)) {
+	struct sigaction sa;
+
+	if (!callback) {
+		sys_interruptCallback = NULL;
+		signal(SIGUSR2, SIG_IGN);
+		return qtrue;
+	}
+
+	sys_interruptThread = pthread_self();
+	sys_interruptCallback = callback;
+
+	Com_Memset(&sa, 0, sizeof(sa));
+	sa.sa_sigaction = Sys_InterruptSignal;
+	sa.sa_flags = SA_SIGINFO | SA_RESTART;
+	sigemptyset(&sa.sa_mask);
+	if (sigaction(SIGUSR2, &sa, NULL) == -1) {
+		sys_interruptCallback = NULL;
+		return qfalse;
+	}
+
+	return qtrue;
+}
+
+/*
+==============
+Sys_InterruptThread
+==============
+*/
+qboolean Sys_InterruptThread(void) {
+	if (!sys_interruptCallback)
+		return qfalse;
+
+	return pthread_kill(sys_interruptThread, SIGUSR2) == 0 ? qtrue : qfalse;
+}
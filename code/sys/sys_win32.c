@@ -24,6 +24,11 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "../qcommon/qcommon.h"
 #include "sys_local.h"
 
+// condition variables require Vista
+#if !defined(_WIN32_WINNT) || _WIN32_WINNT < 0x0600
+#undef _WIN32_WINNT
+#define _WIN32_WINNT 0x0600
+#endif
 #include <windows.h>
 #include <lmerr.h>
 #include <lmcons.h>
@@ -231,6 +236,32 @@ int Sys_Milliseconds(void) {
 	return sys_curtime;
 }
 
+/*
+================
+Sys_Microseconds
+
+Counts from where Sys_Milliseconds was on the first call, the two
+clocks may drift apart slowly
+================
+*/
+int64_t Sys_Microseconds(void) {
+	static LARGE_INTEGER frequency, base;
+	static int64_t baseUsec;
+	LARGE_INTEGER now;
+	int64_t ticks;
+
+	if (!frequency.QuadPart) {
+		QueryPerformanceFrequency(&frequency);
+		QueryPerformanceCounter(&base);
+		baseUsec = (int64_t)Sys_Milliseconds() * 1000;
+	}
+
+	QueryPerformanceCounter(&now);
+	ticks = now.QuadPart - base.QuadPart;
+
+	return baseUsec + ticks / frequency.QuadPart * 1000000 + ticks % frequency.QuadPart * 1000000 / frequency.QuadPart;
+}
+
 /*
 ================
 Sys_RandomBytes
@@ -350,6 +381,83 @@ FILE *Sys_FOpen(const char *ospath, const char *mode) {
 	return fopen(ospath, mode);
 }
 
+/*
+==============
+Sys_MapFile
+
+Maps a whole file read only, NULL on failure
+==============
+*/
+void *Sys_MapFile(const char *ospath, int64_t *length) {
+	HANDLE file, mapping;
+	LARGE_INTEGER size;
+	void *base;
+
+	file = CreateFileA(ospath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+		return NULL;
+
+	if (!GetFileSizeEx(file, &size) || size.QuadPart <= 0 || (uint64_t)size.QuadPart > (SIZE_T)-1) {
+		CloseHandle(file);
+		return NULL;
+	}
+
+	mapping = CreateFileMapping(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	CloseHandle(file);
+	if (!mapping)
+		return NULL;
+
+	// the view keeps the mapping alive
+	base = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+
+	if (!base)
+		return NULL;
+
+	*length = size.QuadPart;
+	return base;
+}
+
+/*
+==============
+Sys_UnmapFile
+==============
+*/
+void Sys_UnmapFile(void *base, int64_t length) {
+	UnmapViewOfFile(base);
+}
+
+/*
+==============
+Sys_ReserveMemory
+
+Reserves address space without backing it, NULL on failure
+==============
+*/
+void *Sys_ReserveMemory(size_t size) {
+	return VirtualAlloc(NULL, size, MEM_RESERVE, PAGE_NOACCESS);
+}
+
+/*
+==============
+Sys_CommitMemory
+==============
+*/
+qboolean Sys_CommitMemory(void *base, size_t size) {
+	return VirtualAlloc(base, size, MEM_COMMIT, PAGE_READWRITE) != NULL;
+}
+
+/*
+==============
+Sys_DecommitMemory
+
+Returns the pages of a committed range to the system, keeping it reserved
+==============
+*/
+void Sys_DecommitMemory(void *base, size_t size) {
+	VirtualFree(base, size, MEM_DECOMMIT);
+}
+
 /*
 ==============
 Sys_Mkdir
@@ -374,6 +482,24 @@ FILE *Sys_Mkfifo(const char *ospath) {
 	return NULL;
 }
 
+/*
+==================
+Sys_OpenPipe
+==================
+*/
+FILE *Sys_OpenPipe(const char *command) {
+	return _popen(command, "wb");
+}
+
+/*
+==================
+Sys_ClosePipe
+==================
+*/
+int Sys_ClosePipe(FILE *pipe) {
+	return _pclose(pipe);
+}
+
 /*
 ==============
 Sys_Cwd
@@ -826,3 +952,184 @@ Check if filename should be allowed to be loaded as a DLL.
 qboolean Sys_DllExtension(const char *name) {
 	return COM_CompareExtension(name, DLL_EXT);
 }
+
+/*
+==============================================================
+
+THREADS
+
+==============================================================
+*/
+
+struct sysThread_s {
+	HANDLE handle;
+	void (*func)(void *data);
+	void *data;
+};
+
+struct sysMutex_s {
+	CRITICAL_SECTION handle;
+};
+
+struct sysCond_s {
+	CONDITION_VARIABLE handle;
+};
+
+static DWORD WINAPI Sys_ThreadMain(LPVOID arg) {
+	sysThread_t *thread = (sysThread_t *)arg;
+
+	thread->func(thread->data);
+	return 0;
+}
+
+/*
+==============
+Sys_CreateThread
+==============
+*/
+sysThread_t *Sys_CreateThread(void (*func)(void *data), void *data) {
+	sysThread_t *thread = malloc(sizeof(*thread));
+
+	if (!thread) {
+		return NULL;
+	}
+
+	thread->func = func;
+	thread->data = data;
+	thread->handle = CreateThread(NULL, 0, Sys_ThreadMain, thread, 0, NULL);
+	if (!thread->handle) {
+		free(thread);
+		return NULL;
+	}
+
+	return thread;
+}
+
+/*
+==============
+Sys_JoinThread
+==============
+*/
+void Sys_JoinThread(sysThread_t *thread) {
+	WaitForSingleObject(thread->handle, INFINITE);
+	CloseHandle(thread->handle);
+	free(thread);
+}
+
+/*
+==============
+Sys_CreateMutex
+==============
+*/
+sysMutex_t *Sys_CreateMutex(void) {
+	sysMutex_t *mutex = malloc(sizeof(*mutex));
+
+	if (!mutex) {
+		return NULL;
+	}
+
+	InitializeCriticalSection(&mutex->handle);
+	return mutex;
+}
+
+void Sys_DestroyMutex(sysMutex_t *mutex) {
+	DeleteCriticalSection(&mutex->handle);
+	free(mutex);
+}
+
+void Sys_LockMutex(sysMutex_t *mutex) {
+	EnterCriticalSection(&mutex->handle);
+}
+
+void Sys_UnlockMutex(sysMutex_t *mutex) {
+	LeaveCriticalSection(&mutex->handle);
+}
+
+/*
+==============
+Sys_CreateCond
+==============
+*/
+sysCond_t *Sys_CreateCond(void) {
+	sysCond_t *cond = malloc(sizeof(*cond));
+
+	if (!cond) {
+		return NULL;
+	}
+
+	InitializeConditionVariable(&cond->handle);
+	return cond;
+}
+
+void Sys_DestroyCond(sysCond_t *cond) {
+	free(cond);
+}
+
+void Sys_WaitCond(sysCond_t *cond, sysMutex_t *mutex) {
+	SleepConditionVariableCS(&cond->handle, &mutex->handle, INFINITE);
+}
+
+qboolean Sys_TimedWaitCond(sysCond_t *cond, sysMutex_t *mutex, int usec) {
+	return SleepConditionVariableCS(&cond->handle, &mutex->handle, (usec + 999) / 1000) ? qtrue : qfalse;
+}
+
+void Sys_SignalCond(sysCond_t *cond) {
+	WakeConditionVariable(&cond->handle);
+}
+
+void Sys_BroadcastCond(sysCond_t *cond) {
+	WakeAllConditionVariable(&cond->handle);
+}
+
+/*
+==============
+Sys_SetAffinity
+
+Sets the affinity of the whole process, threads don't inherit the
+affinity of the thread creating them here
+==============
+*/
+qboolean Sys_SetAffinity(const int *cpus, int numCpus) {
+	DWORD_PTR mask = 0;
+	int i;
+
+	for (i = 0; i < numCpus; i++) {
+		if (cpus[i] < 0 || cpus[i] >= (int)sizeof(mask) * 8) {
+			return qfalse;
+		}
+		mask |= (DWORD_PTR)1 << cpus[i];
+	}
+
+	return SetProcessAffinityMask(GetCurrentProcess(), mask) != 0;
+}
+
+/*
+==============
+Sys_SetProfileTimer
+
+Not implemented, there are no signals to interrupt the main thread with
+==============
+*/
+qboolean Sys_SetProfileTimer(int hz, void (*callback)(void *pc, void *sp)) {
+	return hz <= 0;
+}
+
+/*
+==============
+Sys_SetInterruptCallback
+
+Not implemented either, the hitch watchdog samples from its own thread
+==============
+*/
+qboolean Sys_SetInterruptCallback(void (*callback)(void *pc, void *sp)) {
+	return callback == NULL;
+}
+
+/*
+==============
+Sys_InterruptThread
+==============
+*/
+qboolean Sys_InterruptThread(void) {
+	return qfalse;
+}
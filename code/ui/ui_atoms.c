@@ -372,6 +372,8 @@ int UI_ProportionalStringWidth(const char *str) {
 	return width;
 }
 
+#define MAX_STRING_PICS 128
+
 void UI_DrawProportionalString2(int x, int y, const char *str, const vec4_t color, float sizeScale, qhandle_t charset) {
 	const char *s;
 	unsigned char ch;
@@ -383,6 +385,8 @@ void UI_DrawProportionalString2(int x, int y, const char *str, const vec4_t colo
 	float fcol;
 	float fwidth;
 	float fheight;
+	stretchPic_t pics[MAX_STRING_PICS];
+	int numPics = 0;
 
 	// draw the colored text
 	trap_R_SetColor(color);
@@ -402,13 +406,28 @@ void UI_DrawProportionalString2(int x, int y, const char *str, const vec4_t colo
 			fheight = (float)PROP_HEIGHT / 256.0f;
 			aw = (float)propMap[ch].width * uis.xscale * sizeScale;
 			ah = (float)PROP_HEIGHT * uis.yscale * sizeScale;
-			trap_R_DrawStretchPic(ax, ay, aw, ah, fcol, frow, fcol + fwidth, frow + fheight, charset);
+			if (numPics == MAX_STRING_PICS) {
+				trap_R_DrawStretchPics(pics, numPics, charset);
+				numPics = 0;
+			}
+			pics[numPics].x = ax;
+			pics[numPics].y = ay;
+			pics[numPics].w = aw;
+			pics[numPics].h = ah;
+			pics[numPics].s1 = fcol;
+			pics[numPics].t1 = frow;
+			pics[numPics].s2 = fcol + fwidth;
+			pics[numPics].t2 = frow + fheight;
+			numPics++;
 		}
 
 		ax += (aw + (float)PROP_GAP_WIDTH * uis.xscale * sizeScale);
 		s++;
 	}
 
+	if (numPics) {
+		trap_R_DrawStretchPics(pics, numPics, charset);
+	}
 	trap_R_SetColor(NULL);
 }
 
@@ -674,6 +693,8 @@ static void UI_DrawString2(int x, int y, const char *str, const vec4_t color, in
 	float ah;
 	float frow;
 	float fcol;
+	stretchPic_t pics[MAX_STRING_PICS];
+	int numPics = 0;
 
 	if (y < -charh)
 		// offscreen
@@ -692,6 +713,10 @@ static void UI_DrawString2(int x, int y, const char *str, const vec4_t color, in
 	while (*s) {
 		if (Q_IsColorString(s)) {
 			if (!forceColor) {
+				if (numPics) {
+					trap_R_DrawStretchPics(pics, numPics, uis.charsetShader);
+					numPics = 0;
+				}
 				memcpy(tempcolor, g_color_table[ColorIndex(s[1])], sizeof(tempcolor));
 				tempcolor[3] = color[3];
 				trap_R_SetColor(tempcolor);
@@ -704,13 +729,28 @@ static void UI_DrawString2(int x, int y, const char *str, const vec4_t color, in
 		if (ch != ' ') {
 			frow = (ch >> 4) * 0.0625;
 			fcol = (ch & 15) * 0.0625;
-			trap_R_DrawStretchPic(ax, ay, aw, ah, fcol, frow, fcol + 0.0625, frow + 0.0625, uis.charsetShader);
+			if (numPics == MAX_STRING_PICS) {
+				trap_R_DrawStretchPics(pics, numPics, uis.charsetShader);
+				numPics = 0;
+			}
+			pics[numPics].x = ax;
+			pics[numPics].y = ay;
+			pics[numPics].w = aw;
+			pics[numPics].h = ah;
+			pics[numPics].s1 = fcol;
+			pics[numPics].t1 = frow;
+			pics[numPics].s2 = fcol + 0.0625;
+			pics[numPics].t2 = frow + 0.0625;
+			numPics++;
 		}
 
 		ax += aw;
 		s++;
 	}
 
+	if (numPics) {
+		trap_R_DrawStretchPics(pics, numPics, uis.charsetShader);
+	}
 	trap_R_SetColor(NULL);
 }
 
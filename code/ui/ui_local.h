@@ -588,6 +588,8 @@ void UI_PlayerInfo_SetModel(playerInfo_t *pi, const char *model);
 void UI_PlayerInfo_SetInfo(playerInfo_t *pi, int legsAnim, int torsoAnim, const vec3_t viewAngles, const vec3_t moveAngles,
 						   weapon_t weaponNum, qboolean chat);
 qboolean UI_RegisterClientModelname(playerInfo_t *pi, const char *modelSkinName);
+qboolean UI_PrecacheClientModelname(const char *modelSkinName);
+void UI_ClearModelCache(void);
 
 typedef enum {
 	MUSICSTATE_STOPPED,			  // no music is running
@@ -715,6 +717,7 @@ void trap_Error(const char *string) Q_NORETURN;
 int trap_Milliseconds(void);
 void trap_Cvar_Register(vmCvar_t *vmCvar, const char *varName, const char *defaultValue, int flags);
 void trap_Cvar_Update(vmCvar_t *vmCvar);
+int trap_Cvar_Generation(void);
 void trap_Cvar_Set(const char *var_name, const char *value);
 float trap_Cvar_VariableValue(const char *var_name);
 void trap_Cvar_VariableStringBuffer(const char *var_name, char *buffer, int bufsize);
@@ -742,6 +745,7 @@ void trap_R_RenderScene(const refdef_t *fd);
 void trap_R_SetColor(const float *rgba);
 void trap_R_DrawStretchPic(float x, float y, float w, float h, float s1, float t1, float s2, float t2,
 						   qhandle_t hShader);
+void trap_R_DrawStretchPics(const stretchPic_t *pics, int numPics, qhandle_t hShader);
 void trap_UpdateScreen(void);
 int trap_CM_LerpTag(orientation_t *tag, clipHandle_t mod, int startFrame, int endFrame, float frac,
 					const char *tagName);
@@ -763,7 +767,10 @@ int trap_GetConfigString(int index, char *buff, int buffsize);
 int trap_LAN_GetServerCount(int source);
 void trap_LAN_GetServerAddressString(int source, int n, char *buf, int buflen);
 void trap_LAN_GetServerInfo(int source, int n, char *buf, int buflen);
+int trap_LAN_GetServerPing(int source, int n);
 int trap_LAN_GetPingQueueCount(void);
+void trap_LAN_LoadCachedServers(void);
+void trap_LAN_SaveCachedServers(void);
 int trap_LAN_ServerStatus(const char *serverAddress, char *serverStatus, int maxLen);
 void trap_LAN_ClearPing(int n);
 void trap_LAN_GetPing(int n, char *buf, int buflen, int *pingtime);
@@ -250,9 +250,17 @@ UI_UpdateCvars
 =================
 */
 void UI_UpdateCvars(void) {
-	int i;
+	static int lastGeneration;
+	int i, generation;
 	cvarTable_t *cv;
 
+	// nothing changed since the last update
+	generation = trap_Cvar_Generation();
+	if (generation == lastGeneration) {
+		return;
+	}
+	lastGeneration = generation;
+
 	for (i = 0, cv = cvarTable; i < cvarTableSize; i++, cv++) {
 		if (!cv->vmCvar) {
 			continue;
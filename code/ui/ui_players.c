@@ -1142,10 +1142,10 @@ static qboolean UI_ParseAnimationFile(const char *filename, playerInfo_t *pi) {
 
 /*
 ==========================
-UI_RegisterClientModelname
+UI_LoadClientModelname
 ==========================
 */
-qboolean UI_RegisterClientModelname(playerInfo_t *pi, const char *modelSkinName) {
+static qboolean UI_LoadClientModelname(playerInfo_t *pi, const char *modelSkinName) {
 	char modelName[MAX_QPATH];
 	char skinName[MAX_QPATH];
 	char filename[MAX_QPATH];
@@ -1279,6 +1279,142 @@ qboolean UI_RegisterClientModelname(playerInfo_t *pi, const char *modelSkinName)
 	return qtrue;
 }
 
+/*
+=============================================================================
+
+MODEL CACHE
+
+Keeps what UI_LoadClientModelname found for the last few model/skin names,
+so browsing back and forth through the player models doesn't look up the
+model and skin files and parse animation.cfg again each time.  Handles are
+only valid for the current renderer registration, so a menu clears the
+cache when it opens.
+
+=============================================================================
+*/
+
+#define UI_MODEL_CACHE_SIZE 8
+
+typedef struct {
+	char name[MAX_QPATH];
+	char glowModel[MAX_CVAR_VALUE_STRING]; // cg_glowModel it was loaded with
+	qboolean loaded;
+	int lastUsed;
+	playerInfo_t info; // only the model fields are set
+} uiModelCache_t;
+
+static uiModelCache_t uiModelCache[UI_MODEL_CACHE_SIZE];
+static int uiModelCacheTime;
+
+/*
+==========================
+UI_ClearModelCache
+==========================
+*/
+void UI_ClearModelCache(void) {
+	memset(uiModelCache, 0, sizeof(uiModelCache));
+	uiModelCacheTime = 0;
+}
+
+static void UI_CopyModelInfo(playerInfo_t *to, const playerInfo_t *from) {
+	to->legsModel = from->legsModel;
+	to->legsSkin = from->legsSkin;
+	to->torsoModel = from->torsoModel;
+	to->torsoSkin = from->torsoSkin;
+	to->headModel = from->headModel;
+	to->headSkin = from->headSkin;
+	memcpy(to->animations, from->animations, sizeof(to->animations));
+	VectorCopy(from->modeloffset, to->modeloffset);
+	to->modelscale = from->modelscale;
+	to->fixedlegs = from->fixedlegs;
+	to->fixedtorso = from->fixedtorso;
+	to->glowModel = from->glowModel;
+	memcpy(to->glowColor, from->glowColor, sizeof(to->glowColor));
+}
+
+/*
+==========================
+UI_CachedModel
+
+Returns the cache entry for the name, loading it into the least recently
+used entry if it isn't there yet
+==========================
+*/
+static uiModelCache_t *UI_CachedModel(const char *modelSkinName) {
+	char glowModel[MAX_CVAR_VALUE_STRING];
+	uiModelCache_t *entry, *oldest;
+	int i;
+
+	trap_Cvar_VariableStringBuffer("cg_glowModel", glowModel, sizeof(glowModel));
+
+	oldest = &uiModelCache[0];
+	for (i = 0; i < UI_MODEL_CACHE_SIZE; i++) {
+		entry = &uiModelCache[i];
+		if (entry->name[0] && !Q_stricmp(entry->name, modelSkinName) && !strcmp(entry->glowModel, glowModel)) {
+			entry->lastUsed = ++uiModelCacheTime;
+			return entry;
+		}
+		if (entry->lastUsed < oldest->lastUsed) {
+			oldest = entry;
+		}
+	}
+
+	entry = oldest;
+	memset(entry, 0, sizeof(*entry));
+	Q_strncpyz(entry->name, modelSkinName, sizeof(entry->name));
+	Q_strncpyz(entry->glowModel, glowModel, sizeof(entry->glowModel));
+	entry->loaded = UI_LoadClientModelname(&entry->info, modelSkinName);
+	entry->lastUsed = ++uiModelCacheTime;
+
+	return entry;
+}
+
+/*
+==========================
+UI_RegisterClientModelname
+==========================
+*/
+qboolean UI_RegisterClientModelname(playerInfo_t *pi, const char *modelSkinName) {
+	uiModelCache_t *entry;
+
+	if (!modelSkinName[0] || strlen(modelSkinName) >= MAX_QPATH) {
+		return UI_LoadClientModelname(pi, modelSkinName);
+	}
+
+	entry = UI_CachedModel(modelSkinName);
+	UI_CopyModelInfo(pi, &entry->info);
+
+	return entry->loaded;
+}
+
+/*
+==========================
+UI_PrecacheClientModelname
+
+Loads a model the user is likely to pick next, returns qfalse if it was
+already cached so that the caller can do one load per frame
+==========================
+*/
+qboolean UI_PrecacheClientModelname(const char *modelSkinName) {
+	char glowModel[MAX_CVAR_VALUE_STRING];
+	int i;
+
+	if (!modelSkinName[0] || strlen(modelSkinName) >= MAX_QPATH) {
+		return qfalse;
+	}
+
+	trap_Cvar_VariableStringBuffer("cg_glowModel", glowModel, sizeof(glowModel));
+	for (i = 0; i < UI_MODEL_CACHE_SIZE; i++) {
+		if (uiModelCache[i].name[0] && !Q_stricmp(uiModelCache[i].name, modelSkinName) &&
+			!strcmp(uiModelCache[i].glowModel, glowModel)) {
+			return qfalse;
+		}
+	}
+
+	UI_CachedModel(modelSkinName);
+	return qtrue;
+}
+
 /*
 ===============
 UI_PlayerInfo_SetModel
@@ -96,6 +96,7 @@ typedef struct {
 	int lastCursorX;
 	int slogo_num;
 	int nextGestureTime;
+	qboolean neighboursCached;
 
 	menubitmap_s item_null;
 
@@ -217,6 +218,78 @@ static void PlayerSettings_DrawName(void *self) {
 	}
 }
 
+/*
+=================
+PlayerSettings_DefaultSkin
+=================
+*/
+static int PlayerSettings_DefaultSkin(int model) {
+	int first, i;
+
+	first = model > 0 ? ps_playericons.lastskinicon[model - 1] + 1 : 0;
+	for (i = first; i <= ps_playericons.lastskinicon[model]; i++) {
+		if (strstr(ps_playericons.modelskins[i].name, "default") != NULL) {
+			return i;
+		}
+	}
+	return first;
+}
+
+/*
+=================
+PlayerSettings_CacheNeighbours
+
+Loads the skins next to the shown one and the default skins of the models
+next to it, one per frame, so that stepping through them doesn't stall
+=================
+*/
+static void PlayerSettings_CacheNeighbours(void) {
+	int skins[4], numSkins;
+	int current, model, i;
+
+	if (s_playersettings.neighboursCached || ps_playericons.nummodel <= 0) {
+		return;
+	}
+
+	current = -1;
+	for (i = s_playersettings.chosenskins[0]; i <= s_playersettings.chosenskins[1]; i++) {
+		if (!Q_stricmp(ps_playericons.modelskins[i].name, s_playersettings.playerModel)) {
+			current = i;
+			break;
+		}
+	}
+
+	numSkins = 0;
+	if (current > s_playersettings.chosenskins[0]) {
+		skins[numSkins++] = current - 1;
+	}
+	if (current >= 0 && current < s_playersettings.chosenskins[1]) {
+		skins[numSkins++] = current + 1;
+	}
+
+	for (model = 0; model < ps_playericons.nummodel; model++) {
+		if (ps_playericons.lastskinicon[model] == s_playersettings.chosenskins[1]) {
+			break;
+		}
+	}
+	if (model < ps_playericons.nummodel) {
+		if (model > 0) {
+			skins[numSkins++] = PlayerSettings_DefaultSkin(model - 1);
+		}
+		if (model + 1 < ps_playericons.nummodel) {
+			skins[numSkins++] = PlayerSettings_DefaultSkin(model + 1);
+		}
+	}
+
+	for (i = 0; i < numSkins; i++) {
+		if (UI_PrecacheClientModelname(ps_playericons.modelskins[skins[i]].name)) {
+			return;
+		}
+	}
+
+	s_playersettings.neighboursCached = qtrue;
+}
+
 /*
 =================
 PlayerSettings_DrawPlayer
@@ -238,6 +311,9 @@ static void PlayerSettings_DrawPlayer(void *self) {
 		UI_PlayerInfo_SetInfo(&s_playersettings.playerinfo, LEGS_IDLE, TORSO_STAND, viewangles, vec3_origin, WP_NIPPER,
 							  qfalse);
 		s_playersettings.nextGestureTime = uis.realtime + 2000;
+		s_playersettings.neighboursCached = qfalse;
+	} else {
+		PlayerSettings_CacheNeighbours();
 	}
 
 	b = (menubitmap_s *)self;
@@ -722,6 +798,7 @@ static void PlayerSettings_MenuInit(void) {
 
 	memset(&s_playersettings, 0, sizeof(playersettings_t));
 
+	UI_ClearModelCache();
 	PlayerSettings_Cache();
 
 	s_playersettings.menu.key = PlayerSettings_MenuKey;
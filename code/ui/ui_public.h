@@ -127,6 +127,9 @@ typedef enum {
 	UI_GET_VOICEMUTECLIENT,
 	UI_GET_VOICEMUTEALL,
 	UI_GET_VOICEGAIN,
+	UI_CVAR_GENERATION, // ( void );
+	// changes whenever any cvar changed, UI_CVAR_UPDATE can be skipped while it doesn't
+	UI_R_DRAWSTRETCHPICS, // ( const stretchPic_t *pics, int numPics, qhandle_t hShader );
 
 	UI_MEMSET = 100,
 	UI_MEMCPY,
@@ -136,7 +139,9 @@ typedef enum {
 	UI_ATAN2,
 	UI_SQRT,
 	UI_FLOOR,
-	UI_CEIL
+	UI_CEIL,
+	UI_MEMMOVE,
+	UI_STRLEN
 } uiImport_t;
 
 typedef enum {
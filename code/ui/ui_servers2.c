@@ -30,13 +30,12 @@ MULTIPLAYER MENU (SERVER BROWSER)
 
 #include "ui_local.h"
 
-#define MAX_GLOBALSERVERS 128
-#define MAX_PINGREQUESTS 32
+#define MAX_GLOBALSERVERS 1024
 #define MAX_ADDRESSLENGTH 64
 #define MAX_HOSTNAMELENGTH 31
 #define MAX_MAPNAMELENGTH 32
 #define MAX_LISTBOXITEMS MAX_GLOBALSERVERS
-#define MAX_LOCALSERVERS MAX_GLOBALSERVERS
+#define MAX_LOCALSERVERS MAX_OTHER_SERVERS
 #define MAX_STATUSLENGTH 64
 #define MAX_LEAGUELENGTH 28
 #define MAX_LISTBOXWIDTH 64
@@ -131,11 +130,6 @@ static char *gamenames[] = {GAMETYPE_NAME_SHORT(GT_FFA),
 
 static char quake3worldMessage[] = "Visit worldofpadman.com - News, Community, Events, Files";
 
-typedef struct {
-	char adrstr[MAX_ADDRESSLENGTH];
-	int start;
-} pinglist_t;
-
 typedef struct servernode_s {
 	char adrstr[MAX_ADDRESSLENGTH];
 	char hostname[MAX_HOSTNAMELENGTH + 3];
@@ -150,6 +144,8 @@ typedef struct servernode_s {
 	qboolean mod;
 	int minPing;
 	int maxPing;
+	qboolean haveMap; // checked once when the result comes in, not on every update
+	qboolean cached;  // from the last refresh, not answered in this one yet
 } servernode_t;
 
 typedef struct {
@@ -185,7 +181,6 @@ typedef struct {
 	menubitmap1024s_s specify;
 	menubitmap1024s_s go;
 
-	pinglist_t pinglist[MAX_PINGREQUESTS];
 	table_t table[MAX_LISTBOXITEMS];
 	char *items[MAX_LISTBOXITEMS];
 	int numqueriedservers;
@@ -415,14 +410,17 @@ static void ArenaServers_UpdateMenu(void) {
 	table_t *tableptr;
 	char *pingColor, *slotsColor, *mapColor, *modColor;
 
-	if (g_arenaservers.numqueriedservers > 0) {
-		// servers found
+	if (g_arenaservers.numqueriedservers > 0 || *g_arenaservers.numservers > 0) {
+		// servers found, or known from the last refresh
 		if (g_arenaservers.refreshservers && (g_arenaservers.currentping <= g_arenaservers.numqueriedservers)) {
-			// show progress
-			Com_sprintf(g_arenaservers.status.string, MAX_STATUSLENGTH, "%d of %d Servers.", g_arenaservers.currentping,
-						g_arenaservers.numqueriedservers);
+			// show progress, the list is kept sorted as results come in
+			if (g_arenaservers.numqueriedservers > 0) {
+				Com_sprintf(g_arenaservers.status.string, MAX_STATUSLENGTH, "%d of %d Servers.",
+							g_arenaservers.currentping, g_arenaservers.numqueriedservers);
+			} else {
+				Q_strncpyz(g_arenaservers.status.string, "Scanning For Servers.", MAX_STATUSLENGTH);
+			}
 			g_arenaservers.statusbar.string = "Press SPACE to stop";
-			qsort(g_arenaservers.serverlist, *g_arenaservers.numservers, sizeof(servernode_t), ArenaServers_Compare);
 		} else {
 			// all servers pinged - enable controls
 			g_arenaservers.master.generic.flags &= ~QMF_GRAYED;
@@ -589,7 +587,7 @@ static void ArenaServers_UpdateMenu(void) {
 		}
 
 		// this only partial exact, works at least for current mod
-		if (-1 == trap_FS_FOpenFile(va("maps/%s.bsp", servernodeptr->mapname), NULL, FS_READ)) {
+		if (!servernodeptr->haveMap) {
 			mapColor = S_COLOR_RED;
 		} else {
 			mapColor = DEFAULT_COLOR_S;
@@ -678,22 +676,86 @@ static void ArenaServers_Remove(void) {
 	g_arenaservers.currentping = g_arenaservers.numfavoriteaddresses;
 }
 
+/*
+=================
+ArenaServers_RemoveNode
+=================
+*/
+static void ArenaServers_RemoveNode(servernode_t *servernodeptr) {
+	servernode_t *last;
+
+	last = g_arenaservers.serverlist + (*g_arenaservers.numservers) - 1;
+	if (servernodeptr < last) {
+		memmove(servernodeptr, servernodeptr + 1, (last - servernodeptr) * sizeof(servernode_t));
+	}
+	memset(last, 0, sizeof(servernode_t));
+	(*g_arenaservers.numservers)--;
+}
+
+/*
+=================
+ArenaServers_Place
+
+Moves a node that changed to its place in the sorted list, so the list
+doesn't have to be sorted again on every update
+=================
+*/
+static servernode_t *ArenaServers_Place(servernode_t *servernodeptr) {
+	servernode_t *first;
+	servernode_t *last;
+	servernode_t temp;
+
+	first = g_arenaservers.serverlist;
+	last = first + (*g_arenaservers.numservers) - 1;
+
+	while (servernodeptr > first && ArenaServers_Compare(servernodeptr - 1, servernodeptr) > 0) {
+		temp = *(servernodeptr - 1);
+		*(servernodeptr - 1) = *servernodeptr;
+		*servernodeptr = temp;
+		servernodeptr--;
+	}
+
+	while (servernodeptr < last && ArenaServers_Compare(servernodeptr, servernodeptr + 1) > 0) {
+		temp = *(servernodeptr + 1);
+		*(servernodeptr + 1) = *servernodeptr;
+		*servernodeptr = temp;
+		servernodeptr++;
+	}
+
+	return servernodeptr;
+}
+
 /*
 =================
 ArenaServers_Insert
+
+Adds a result, or updates the node already there for the address
 =================
 */
-static void ArenaServers_Insert(char *adrstr, char *info, int pingtime) {
+static servernode_t *ArenaServers_Insert(const char *adrstr, const char *info, int pingtime) {
 	servernode_t *servernodeptr;
 	const char *s;
 	int i;
 
+	servernodeptr = NULL;
+	for (i = 0; i < *g_arenaservers.numservers; i++) {
+		if (!Q_stricmp(g_arenaservers.serverlist[i].adrstr, adrstr)) {
+			servernodeptr = &g_arenaservers.serverlist[i];
+			break;
+		}
+	}
+
 	if ((pingtime >= ArenaServers_MaxPing()) && (g_servertype != UIAS_FAVORITES)) {
 		// slow global or local servers do not get entered
-		return;
+		if (servernodeptr) {
+			ArenaServers_RemoveNode(servernodeptr);
+		}
+		return NULL;
 	}
 
-	if (*g_arenaservers.numservers >= g_arenaservers.maxservers) {
+	if (servernodeptr) {
+		// update in place
+	} else if (*g_arenaservers.numservers >= g_arenaservers.maxservers) {
 		// list full;
 		servernodeptr = (g_arenaservers.serverlist + (*g_arenaservers.numservers) - 1);
 	} else {
@@ -735,6 +797,69 @@ static void ArenaServers_Insert(char *adrstr, char *info, int pingtime) {
 		Q_strncpyz(servernodeptr->gamename, gamenames[i], sizeof(servernodeptr->gamename));
 		servernodeptr->mod = qfalse;
 	}
+
+	servernodeptr->haveMap = (trap_FS_FOpenFile(va("maps/%s.bsp", servernodeptr->mapname), NULL, FS_READ) != -1);
+	servernodeptr->cached = qfalse;
+
+	return ArenaServers_Place(servernodeptr);
+}
+
+/*
+=================
+ArenaServers_InsertCached
+
+Shows what the last refresh found while the new one runs
+=================
+*/
+static void ArenaServers_InsertCached(void) {
+	servernode_t *servernodeptr;
+	char adrstr[MAX_ADDRESSLENGTH];
+	char info[MAX_INFO_STRING];
+	int count;
+	int ping;
+	int i;
+
+	count = trap_LAN_GetServerCount(AS_GLOBAL);
+	for (i = 0; i < count; i++) {
+		ping = trap_LAN_GetServerPing(AS_GLOBAL, i);
+		if (ping <= 0) {
+			// never answered
+			continue;
+		}
+
+		trap_LAN_GetServerAddressString(AS_GLOBAL, i, adrstr, sizeof(adrstr));
+		trap_LAN_GetServerInfo(AS_GLOBAL, i, info, sizeof(info));
+
+		servernodeptr = ArenaServers_Insert(adrstr, info, ping);
+		if (servernodeptr) {
+			servernodeptr->cached = qtrue;
+		}
+	}
+}
+
+/*
+=================
+ArenaServers_RemoveCached
+
+Drops the servers from the last refresh that didn't answer this one
+=================
+*/
+static void ArenaServers_RemoveCached(void) {
+	int i;
+	int j;
+
+	for (i = 0, j = 0; i < *g_arenaservers.numservers; i++) {
+		if (g_arenaservers.serverlist[i].cached) {
+			continue;
+		}
+		if (i != j) {
+			g_arenaservers.serverlist[j] = g_arenaservers.serverlist[i];
+		}
+		j++;
+	}
+
+	memset(&g_arenaservers.serverlist[j], 0, (*g_arenaservers.numservers - j) * sizeof(servernode_t));
+	*g_arenaservers.numservers = j;
 }
 
 /*
@@ -904,6 +1029,11 @@ static void ArenaServers_StopRefresh(void) {
 	// sort
 	qsort(g_arenaservers.serverlist, *g_arenaservers.numservers, sizeof(servernode_t), ArenaServers_Compare);
 
+	// keep the results for the next time the list is shown
+	if (g_servertype >= UIAS_GLOBAL_START && g_servertype <= UIAS_GLOBAL_MAX && g_arenaservers.numqueriedservers > 0) {
+		trap_LAN_SaveCachedServers();
+	}
+
 	ArenaServers_UpdateMenu();
 }
 
@@ -914,7 +1044,8 @@ ArenaServers_DoRefresh
 */
 static void ArenaServers_DoRefresh(void) {
 	int i;
-	int j;
+	int slots;
+	qboolean changed = qfalse;
 	int time;
 	int maxPing;
 	int asType;
@@ -953,47 +1084,27 @@ static void ArenaServers_DoRefresh(void) {
 	// trigger at 20Hz intervals
 	g_arenaservers.nextpingtime = (uis.realtime + 20);
 
-	// process ping results
+	// process ping results, the engine times pings out after cl_maxPing
 	maxPing = ArenaServers_MaxPing();
 	for (i = 0; i < MAX_PINGREQUESTS; i++) {
 		trap_LAN_GetPing(i, adrstr, MAX_ADDRESSLENGTH, &time);
-		if (!adrstr[0]) {
+		if (!adrstr[0] || !time) {
 			// ignore empty or pending pings
 			continue;
 		}
 
-		// find ping result in our local list
-		for (j = 0; j < MAX_PINGREQUESTS; j++)
-			if (!Q_stricmp(adrstr, g_arenaservers.pinglist[j].adrstr))
-				break;
-
-		if (j < MAX_PINGREQUESTS) {
-			// found it
-			if (!time) {
-				time = uis.realtime - g_arenaservers.pinglist[j].start;
-				if (time < maxPing) {
-					// still waiting
-					continue;
-				}
-			}
-
-			if (time > maxPing) {
-				// stale it out
-				info[0] = '\0';
-				time = maxPing;
-			} else {
-				trap_LAN_GetPingInfo(i, info, MAX_INFO_STRING);
-			}
-
-			// insert ping results
-			ArenaServers_Insert(adrstr, info, time);
-
-			// clear this query from internal list
-			g_arenaservers.pinglist[j].adrstr[0] = '\0';
+		if (time >= maxPing) {
+			// stale it out
+			info[0] = '\0';
+			time = maxPing;
+		} else {
+			trap_LAN_GetPingInfo(i, info, MAX_INFO_STRING);
 		}
 
-		// clear this query from external list
+		// insert ping results
+		ArenaServers_Insert(adrstr, info, time);
 		trap_LAN_ClearPing(i);
+		changed = qtrue;
 	}
 
 	// get results of servers query
@@ -1004,49 +1115,37 @@ static void ArenaServers_DoRefresh(void) {
 		g_arenaservers.numqueriedservers = trap_LAN_GetServerCount(asType);
 	}
 
-	//	if (g_arenaservers.numqueriedservers > g_arenaservers.maxservers)
-	//		g_arenaservers.numqueriedservers = g_arenaservers.maxservers;
-
-	// send ping requests in reasonable bursts
-	// iterate ping through all found servers
-	for (i = 0; i < MAX_PINGREQUESTS && g_arenaservers.currentping < g_arenaservers.numqueriedservers; i++) {
-		if (trap_LAN_GetPingQueueCount() >= MAX_PINGREQUESTS) {
-			// ping queue is full
-			break;
-		}
-
-		// find empty slot
-		for (j = 0; j < MAX_PINGREQUESTS; j++)
-			if (!g_arenaservers.pinglist[j].adrstr[0])
-				break;
-
-		if (j >= MAX_PINGREQUESTS)
-			// no empty slots available yet - wait for timeout
-			break;
-
+	// fill the ping queue, the engine paces the sending by cl_pingRate
+	slots = MAX_PINGREQUESTS - trap_LAN_GetPingQueueCount();
+	for (; slots > 0 && g_arenaservers.currentping < g_arenaservers.numqueriedservers; slots--) {
 		// get an address to ping
-
 		if (g_servertype == UIAS_FAVORITES) {
 			Q_strncpyz(adrstr, g_arenaservers.favoriteaddresses[g_arenaservers.currentping], sizeof(adrstr));
 		} else {
 			trap_LAN_GetServerAddressString(asType, g_arenaservers.currentping, adrstr, MAX_ADDRESSLENGTH);
 		}
 
-		Q_strncpyz(g_arenaservers.pinglist[j].adrstr, adrstr, sizeof(g_arenaservers.pinglist[j].adrstr));
-		g_arenaservers.pinglist[j].start = uis.realtime;
-
 		trap_Cmd_ExecuteText(EXEC_NOW, va("ping %s\n", adrstr));
 
 		// advance to next server
 		g_arenaservers.currentping++;
+		changed = qtrue;
 	}
 
 	if (!trap_LAN_GetPingQueueCount()) {
-		// all pings completed
+		// all pings completed, servers known from before that didn't answer are gone
+		if (g_servertype != UIAS_FAVORITES && g_arenaservers.numqueriedservers > 0) {
+			ArenaServers_RemoveCached();
+		}
 		ArenaServers_StopRefresh();
 		return;
 	}
 
+	if (!changed) {
+		// nothing new to show
+		return;
+	}
+
 	// update the user interface with ping status
 	ArenaServers_UpdateMenu();
 }
@@ -1060,10 +1159,9 @@ static void ArenaServers_StartRefresh(void) {
 	int i;
 	char myargs[32], protocol[32];
 
-	memset(g_arenaservers.serverlist, 0, (g_arenaservers.maxservers * sizeof(table_t)));
+	memset(g_arenaservers.serverlist, 0, (g_arenaservers.maxservers * sizeof(servernode_t)));
 
 	for (i = 0; i < MAX_PINGREQUESTS; i++) {
-		g_arenaservers.pinglist[i].adrstr[0] = '\0';
 		trap_LAN_ClearPing(i);
 	}
 
@@ -1076,6 +1174,11 @@ static void ArenaServers_StartRefresh(void) {
 	// allow max 7 seconds for responses
 	g_arenaservers.refreshtime = (uis.realtime + 7000);
 
+	// show the last results until the new ones come in
+	if ((g_servertype >= UIAS_GLOBAL_START) && (g_servertype <= UIAS_GLOBAL_MAX)) {
+		ArenaServers_InsertCached();
+	}
+
 	// place menu in zeroed state
 	ArenaServers_UpdateMenu();
 
@@ -1666,6 +1769,11 @@ static void ArenaServers_MenuInit(void) {
 	if (g_servertype < 0 || g_servertype >= numMasters)
 		g_servertype = 0;
 
+	// results of an earlier session, shown while the refresh runs
+	if (trap_LAN_GetServerCount(AS_GLOBAL) <= 0) {
+		trap_LAN_LoadCachedServers();
+	}
+
 	// force to initial state and refresh
 	g_arenaservers.master.curvalue = g_servertype = ArenaServers_SetType(g_servertype);
 
@@ -91,6 +91,8 @@ equ trap_SetPbClStatus -88
 equ trap_GetVoiceMuteClient -89
 equ trap_GetVoiceMuteAll -90
 equ trap_GetVoiceGainClient -91
+equ trap_Cvar_Generation -92
+equ trap_R_DrawStretchPics -93
 
 equ	memset						-101
 equ	memcpy						-102
@@ -101,4 +103,6 @@ equ	atan2						-106
 equ	sqrt						-107
 equ floor						-108
 equ	ceil						-109
+equ	memmove						-110
+equ	strlen						-111
 
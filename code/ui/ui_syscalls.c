@@ -62,6 +62,10 @@ void trap_Cvar_Update(vmCvar_t *cvar) {
 	syscall(UI_CVAR_UPDATE, cvar);
 }
 
+int trap_Cvar_Generation(void) {
+	return syscall(UI_CVAR_GENERATION);
+}
+
 void trap_Cvar_Set(const char *var_name, const char *value) {
 	syscall(UI_CVAR_SET, var_name, value);
 }
@@ -174,6 +178,10 @@ void trap_R_DrawStretchPic(float x, float y, float w, float h, float s1, float t
 			PASSFLOAT(s2), PASSFLOAT(t2), hShader);
 }
 
+void trap_R_DrawStretchPics(const stretchPic_t *pics, int numPics, qhandle_t hShader) {
+	syscall(UI_R_DRAWSTRETCHPICS, pics, numPics, hShader);
+}
+
 void trap_R_ModelBounds(clipHandle_t model, vec3_t mins, vec3_t maxs) {
 	syscall(UI_R_MODELBOUNDS, model, mins, maxs);
 }